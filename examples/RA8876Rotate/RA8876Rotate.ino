@@ -8,11 +8,27 @@
 #define PINK        0xFC18
 #define REG_DUMP_CNT  0 //0x70
 #define USE_STATUS_LINE
+// Time a full screen writeRect at each rotation, sent as full width bands
+#define BENCHMARK_WRITERECT
+// Time writeRect8BPP/4BPP/2BPP/1BPP of the same image at each rotation
+#define BENCHMARK_PALETTE
 
 uint8_t reg_values[REG_DUMP_CNT];
 
 RA8876_t3 tft = RA8876_t3(RA8876_CS, RA8876_RESET); //Using standard SPI pins
 
+#ifdef BENCHMARK_WRITERECT
+#define BENCH_W 1024	// the longer side, so a band covers the width at any rotation
+#define BENCH_BAND_H 40
+uint16_t bench_band[BENCH_W * BENCH_BAND_H];
+#endif
+#ifdef BENCHMARK_PALETTE
+#define PALETTE_W 160
+#define PALETTE_H 100
+uint8_t palette_image[PALETTE_W * PALETTE_H];	// big enough for 8 bits per pixel
+uint16_t palette[256];
+#endif
+
 void setup() {
   Serial.begin(38400);
   long unsigned debug_start = millis ();
@@ -29,9 +45,65 @@ void setup() {
   tft.graphicMode(true);
   Serial.printf("Before W: %d H: %d\n", tft.width(), tft.height());
   tft.fillScreen(LIGHTYELLOW);
+#ifdef BENCHMARK_PALETTE
+  for (int i = 0; i < 256; i++) palette[i] = tft.color565(i, 255 - i, (i * 4) & 0xff);
+#endif
   drawTestScreen();
 }
 
+#ifdef BENCHMARK_WRITERECT
+// The whole screen, a band of BENCH_BAND_H rows at a time. Color bars
+// across with a stripe every 64 rows down, so a wrong rotation shows.
+void benchmarkWriteRect() {
+  int w = tft.width(), h = tft.height();
+  uint32_t fill_us = 0;
+  tft.resetSpiStats();
+  elapsedMicros em = 0;
+  for (int y = 0; y < h; y += BENCH_BAND_H) {
+    int band_h = min(BENCH_BAND_H, h - y);
+    while (!tft.DMAFinished()) ;	// the last band may still be going out of the buffer
+    elapsedMicros fill = 0;
+    for (int j = 0; j < band_h; j++) {
+      static const uint16_t bars[] = {RED, GREEN, BLUE, WHITE};
+      for (int i = 0; i < w; i++) bench_band[j * w + i] = (((y + j) & 63) < 4) ? BLACK : bars[i * 4 / w];
+    }
+    fill_us += fill;
+    tft.writeRect(0, y, w, band_h, bench_band);
+  }
+  while (!tft.DMAFinished()) ;
+  uint32_t dt = em;
+  Serial.printf("writeRect %dx%d rotation %d: %u us (%u us filling bands), %u transactions\n", w, h, tft.getRotation(),
+                dt, fill_us, tft.spiTransactionCount());
+}
+#endif
+
+#ifdef BENCHMARK_PALETTE
+void benchmarkPalette() {
+  int x = (tft.width() - PALETTE_W) / 2;
+  int y = 180;
+  for (uint8_t bpp = 8; bpp >= 1; bpp /= 2) {
+    // Diagonal stripes through every palette entry, packed bpp bits per pixel
+    uint16_t row_bytes = (PALETTE_W * bpp + 7) / 8;
+    memset(palette_image, 0, sizeof(palette_image));
+    for (int py = 0; py < PALETTE_H; py++) {
+      for (int px = 0; px < PALETTE_W; px++) {
+        uint8_t index = ((px + py) / 4) & ((1 << bpp) - 1);
+        uint32_t bit = px * bpp;
+        palette_image[py * row_bytes + bit / 8] |= index << (8 - bpp - (bit & 7));
+      }
+    }
+    tft.resetSpiStats();
+    elapsedMicros em = 0;
+    if (bpp == 8) tft.writeRect8BPP(x, y, PALETTE_W, PALETTE_H, palette_image, palette);
+    else tft.writeRectNBPP(x, y, PALETTE_W, PALETTE_H, bpp, palette_image, palette);
+    while (!tft.DMAFinished()) ;
+    uint32_t dt = em;
+    Serial.printf("writeRect%dBPP %dx%d rotation %d: %u us, %u transactions\n", bpp, PALETTE_W, PALETTE_H,
+                  tft.getRotation(), dt, tft.spiTransactionCount());
+  }
+}
+#endif
+
 void drawTestScreen() {
 #ifdef USE_STATUS_LINE
   int image_height = tft.height() - STATUS_LINE_HEIGHT; 
@@ -96,9 +168,15 @@ void loop() {
   tft.setRotation(rotation);
 
   Serial.printf("Rotation: %d After W: %d H: %d\n", tft.getRotation(), tft.width(), tft.height());
+#ifdef BENCHMARK_WRITERECT
+  benchmarkWriteRect();
+#endif
   tft.fillScreen(YELLOW);
   //wait_for_keyboard();  // see if all yellow
   drawTestScreen();
+#ifdef BENCHMARK_PALETTE
+  benchmarkPalette();
+#endif
   //tft.textRotate(false);
   Serial.printf("MACR and End: %x\n", tft.lcdRegDataRead(RA8876_MACR));
 
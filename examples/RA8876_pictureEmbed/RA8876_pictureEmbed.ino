@@ -33,6 +33,19 @@ uint8_t rotation = 0;
 #elif defined(ARDUINO_TEENSY36) 
 #include "TD_T4_TopCard.h"   // Top Dog card...
 #endif
+
+// The same pictures packed with extras/packimage, e.g.
+//   packimage -w 240 -h 320 -o teensy40_pinout1_packed.h teensy40_pinout1.h
+// At rotation 0 each is timed against putPicture_16bppData8 and writeRect,
+// one line per picture is printed with the time (until DMA is done) and the
+// SPI transactions of each. T3.x does not have the flash for both copies.
+#if defined(__IMXRT1062__)
+#define BENCHMARK_PACKED
+#include "teensy40_pinout1_packed.h"
+#include "teensy40_pinout2_packed.h"
+#include "teensy40_front_packed.h"
+#include "Teensy41_Cardlike_packed.h"
+#endif
 /* GIMP (https://www.gimp.org/) can also be used to export the image using the following steps:
 
     1. File -> Export As
@@ -99,6 +112,34 @@ void drawImage(uint16_t image_width, uint16_t image_height, uint16_t *image, uin
   Serial.printf("Image: %d Total: %d\n", dt, dt2);
 }
 
+#ifdef BENCHMARK_PACKED
+void benchmarkPacked(const char *name, uint16_t image_width, uint16_t image_height, const uint16_t *image,
+                     const uint8_t *packed, uint32_t packed_size) {
+  int16_t start_x = (tft.width() - image_width) / 2;
+  int16_t start_y = (tft.height() - image_height) / 2;
+  tft.resetSpiStats();
+  elapsedMicros em = 0;
+  tft.putPicture_16bppData8(start_x, start_y, image_width, image_height, (const unsigned char *)image);
+  uint32_t dt_put = em;
+  uint32_t tr_put = tft.spiTransactionCount();
+  tft.resetSpiStats();
+  em = 0;
+  tft.writeRect(start_x, start_y, image_width, image_height, image);
+  while (!tft.DMAFinished()) ;
+  uint32_t dt_write = em;
+  uint32_t tr_write = tft.spiTransactionCount();
+  tft.resetSpiStats();
+  em = 0;
+  tft.drawPackedImage(start_x, start_y, packed, packed_size);
+  while (!tft.DMAFinished()) ;
+  uint32_t dt_packed = em;
+  uint32_t tr_packed = tft.spiTransactionCount();
+  Serial.printf("%s %dx%d: putPicture_16bppData8 %u us (%u), writeRect %u us (%u), drawPackedImage %u us (%u) (%u of %u bytes)\n",
+                name, image_width, image_height, dt_put, tr_put, dt_write, tr_write, dt_packed, tr_packed,
+                packed_size, image_width * image_height * 2);
+}
+#endif
+
 void loop(void) {
   uint16_t *rotated_image = nullptr;
   Serial.printf("Set Rotation(%d)\n", rotation);
@@ -109,6 +150,16 @@ void loop(void) {
   tft.setTextColor(GREEN);
   tft.printf("Rotation: %d", rotation);
   if (DelayOrStep()) return;
+#ifdef BENCHMARK_PACKED
+  if (rotation == 0) {
+    Serial.println("Packed image benchmark");
+    benchmarkPacked("Front of card", 240, 320, (uint16_t*)teensy40_pinout1, teensy40_pinout1_packed, sizeof(teensy40_pinout1_packed));
+    benchmarkPacked("Back of card", 240, 320, (uint16_t*)teensy40_pinout2, teensy40_pinout2_packed, sizeof(teensy40_pinout2_packed));
+    benchmarkPacked("Front of chip", 240, 320, (uint16_t*)teensy40_front, teensy40_front_packed, sizeof(teensy40_front_packed));
+    benchmarkPacked("T4.1 Extended card", 575, 424, (uint16_t*)teensy41_Cardlike, Teensy41_Cardlike_packed, sizeof(Teensy41_Cardlike_packed));
+    if (DelayOrStep()) return;
+  }
+#endif
   rotation = (rotation + 1) & 0x3;
 
   Serial.print("Display Front of card ");
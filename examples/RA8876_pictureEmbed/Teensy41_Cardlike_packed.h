@@ -0,0 +1,7985 @@
+// Packed by packimage from Teensy41_Cardlike.h
+// 575x424 palette, 487600 bytes raw, 127664 bytes packed
+// tft.drawPackedImage(x, y, Teensy41_Cardlike_packed, sizeof(Teensy41_Cardlike_packed));
+
+const uint8_t Teensy41_Cardlike_packed[127664] PROGMEM = {
+0x52, 0x50, 0x01, 0xFE, 0x3F, 0x02, 0xA8, 0x01, 0xFF, 0xFF, 0x7D, 0xEF, 0x79, 0xCE, 0x55, 0xAD,
+0xD7, 0xBD, 0xFB, 0xDE, 0x00, 0x00, 0xE0, 0xFF, 0xD3, 0x9C, 0xD3, 0xFC, 0x50, 0x8C, 0xFD, 0xFF,
+0x29, 0x42, 0xE2, 0xFF, 0x8E, 0x73, 0x7D, 0xDF, 0xD3, 0xEC, 0x69, 0x23, 0xFF, 0xEF, 0x50, 0xEE,
+0x6E, 0x9E, 0xD5, 0xFC, 0xD7, 0xD5, 0x7D, 0xBE, 0x7F, 0xFE, 0xA9, 0x05, 0x6D, 0xB3, 0x55, 0xFD,
+0x77, 0xCE, 0xFF, 0x6E, 0x7F, 0xDF, 0xFD, 0xEE, 0x50, 0xDC, 0xF9, 0xDE, 0xFD, 0xD6, 0xAB, 0x52,
+0xA9, 0x96, 0x7B, 0xEF, 0x76, 0x95, 0x7F, 0xEF, 0x7C, 0xCE, 0x79, 0xDE, 0x68, 0x0B, 0xC5, 0x12,
+0xFF, 0x56, 0xFD, 0xEF, 0xE0, 0xEF, 0xAC, 0x2B, 0xD5, 0x94, 0x7F, 0xFF, 0x49, 0x2A, 0x8E, 0xD3,
+0x69, 0x6C, 0x88, 0x31, 0xD7, 0xA5, 0xDA, 0xA5, 0x63, 0xEF, 0x41, 0xAD, 0x7B, 0xDF, 0x89, 0x4B,
+0x5C, 0x6E, 0xF1, 0xEE, 0x6D, 0x74, 0x7A, 0xB6, 0x7F, 0xCF, 0x53, 0xFD, 0x67, 0x0A, 0x4A, 0x15,
+0xD5, 0xBD, 0xE2, 0xE6, 0x80, 0xD6, 0x7D, 0xFF, 0x11, 0xFC, 0x33, 0x84, 0x8D, 0x4B, 0x60, 0xEF,
+0xD0, 0xD5, 0xC1, 0xC5, 0x68, 0xAD, 0xFB, 0xF6, 0x72, 0xAD, 0x54, 0xBD, 0x8D, 0x95, 0xD0, 0x9C,
+0xB2, 0x5B, 0xA4, 0xD6, 0x6D, 0xCD, 0x7D, 0x56, 0xD3, 0x84, 0x72, 0x95, 0x71, 0x74, 0x8E, 0xAE,
+0xAA, 0x0B, 0xC0, 0xFC, 0xC9, 0x8D, 0x88, 0x04, 0x58, 0xA5, 0xA5, 0xAC, 0x33, 0xFC, 0xD5, 0xA5,
+0x89, 0x6B, 0x72, 0xDE, 0x69, 0x92, 0x91, 0xB6, 0x24, 0x21, 0xBB, 0x5D, 0xAD, 0xB4, 0x79, 0xFF,
+0x49, 0x2C, 0xD2, 0xAC, 0x85, 0xB5, 0x6A, 0xAC, 0x30, 0xA4, 0xAD, 0x8C, 0x4A, 0xB3, 0x82, 0x10,
+0x96, 0xAC, 0x25, 0x04, 0x6E, 0xB5, 0x89, 0x41, 0x8A, 0xAA, 0xE2, 0xEF, 0x53, 0xEE, 0x53, 0xEC,
+0xF6, 0xF6, 0xEE, 0xFE, 0x76, 0x4C, 0xC5, 0xCD, 0x50, 0xFE, 0xE6, 0xFF, 0x10, 0xEC, 0x68, 0x75,
+0x6E, 0x4C, 0x96, 0x6C, 0xD1, 0x8C, 0x84, 0x94, 0x89, 0x93, 0x76, 0xB6, 0x77, 0xDE, 0xF1, 0xFE,
+0x9A, 0xDD, 0x8D, 0x6A, 0x3D, 0xEE, 0x6D, 0x2C, 0xFB, 0xCE, 0x35, 0x34, 0x6E, 0x93, 0x7D, 0xCF,
+0xF3, 0xEE, 0x76, 0x96, 0x57, 0xBD, 0xD1, 0xFC, 0x13, 0x9C, 0xB1, 0xD3, 0x96, 0x75, 0x49, 0x54,
+0x66, 0x5C, 0x74, 0xCE, 0x88, 0x6A, 0xCB, 0x0D, 0x66, 0x9D, 0x71, 0xAF, 0xFF, 0xE6, 0xC4, 0xEC,
+0x7A, 0x96, 0xD1, 0xE4, 0xA4, 0x01, 0x91, 0x54, 0x57, 0x55, 0x69, 0x94, 0x7B, 0xDE, 0xAC, 0xBA,
+0x8A, 0xAE, 0xD7, 0xCC, 0xFF, 0xFE, 0x7B, 0xFF, 0x72, 0x75, 0x66, 0xE7, 0xEA, 0xFF, 0xFF, 0x8E,
+0xF2, 0xFF, 0x02, 0x29, 0xF5, 0xCE, 0x78, 0xEF, 0x75, 0xDE, 0xC1, 0xAC, 0x60, 0xFF, 0x81, 0x94,
+0x4B, 0x0C, 0xF9, 0xCE, 0x73, 0xFE, 0x39, 0x45, 0xFB, 0xFF, 0x84, 0xCB, 0x24, 0x5B, 0xE4, 0xEE,
+0x85, 0x51, 0xF7, 0xC6, 0x61, 0xDF, 0x6D, 0x6D, 0x71, 0x56, 0xAE, 0x22, 0x81, 0x20, 0x63, 0xFF,
+0x6E, 0xDE, 0x66, 0xCC, 0x92, 0x96, 0xAE, 0x92, 0xAA, 0x76, 0x6D, 0x25, 0x91, 0x55, 0xFB, 0xEF,
+0xF4, 0xDE, 0x42, 0xA3, 0xED, 0xFF, 0x22, 0xE4, 0x76, 0xFF, 0xFF, 0xDF, 0xFD, 0xFE, 0xAD, 0x12,
+0x28, 0xEF, 0x9F, 0x8F, 0xA7, 0x91, 0xF3, 0xFE, 0x85, 0x79, 0x7F, 0xBF, 0x22, 0xA7, 0x6E, 0x4D,
+0xF7, 0xDE, 0x5D, 0xFE, 0x61, 0x01, 0x76, 0xD7, 0xFC, 0xDF, 0xF9, 0xFF, 0x5F, 0xE6, 0x84, 0x20,
+0x61, 0x95, 0x8A, 0xD6, 0x6A, 0x97, 0x7A, 0xB7, 0xCB, 0x4D, 0x75, 0xB7, 0xAF, 0xB7, 0x76, 0x97,
+0x9F, 0x6F, 0x72, 0xE7, 0x79, 0x9F, 0xFC, 0xCF, 0xF9, 0xE7, 0x45, 0xFD, 0x7F, 0x57, 0xFF, 0xC7,
+0x6B, 0x16, 0x7F, 0x37, 0x41, 0xF5, 0x42, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x42, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x42, 0x45, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F,
+0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x41, 0x45, 0xC5,
+0xAA, 0x27, 0x1F, 0x0F, 0x01, 0x0F, 0x00, 0x41, 0x4F, 0x00, 0x41, 0x65, 0x5E, 0x4F, 0xC4, 0x4F,
+0x02, 0x01, 0x25, 0x01, 0x00, 0x65, 0x41, 0x00, 0x65, 0x41, 0x00, 0x65, 0x41, 0x00, 0xDD, 0xDA,
+0x0F, 0x02, 0x1F, 0x3A, 0x1F, 0xA2, 0x01, 0xA2, 0x01, 0xA2, 0x01, 0xA2, 0x1F, 0xA2, 0x0F, 0x1F,
+0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x05, 0x00, 0x41, 0x01,
+0x4F, 0x41, 0x00, 0x65, 0xC0, 0xDA, 0x00, 0x42, 0x4F, 0x41, 0x65, 0x5F, 0x65, 0x5F, 0x65, 0x5F,
+0x65, 0x5F, 0x65, 0x5F, 0x65, 0x5F, 0x65, 0x5F, 0x45, 0x42, 0x41, 0x4F, 0x65, 0x4F, 0x65, 0x4F,
+0x65, 0x4F, 0x41, 0x45, 0x41, 0xC5, 0xA2, 0x28, 0x25, 0x01, 0x1F, 0x01, 0x00, 0x5F, 0x41, 0x00,
+0x5F, 0x41, 0x00, 0x5F, 0x41, 0x00, 0x5F, 0x41, 0x65, 0x61, 0xC4, 0xAA, 0x25, 0x1F, 0x25, 0x1F,
+0x01, 0x65, 0x5F, 0x01, 0x65, 0x5F, 0xC7, 0x4F, 0x0F, 0x3A, 0x02, 0xAE, 0x1E, 0x0F, 0x01, 0x01,
+0x4F, 0x41, 0x00, 0x5F, 0x41, 0x5F, 0x41, 0xC1, 0xA2, 0x01, 0x01, 0x68, 0x45, 0x41, 0x00, 0x4F,
+0x10, 0x41, 0x4F, 0x41, 0xC3, 0x4F, 0x22, 0x90, 0x01, 0x08, 0x42, 0x45, 0x41, 0x00, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x42, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x42, 0x41, 0x07, 0x4F, 0x00, 0x42, 0x41, 0x4F, 0x5E,
+0x00, 0x4F, 0x10, 0x41, 0x42, 0x45, 0x41, 0x00, 0x4F, 0x5F, 0x67, 0x5F, 0x41, 0x5F, 0x41, 0x00,
+0x5F, 0x41, 0x00, 0x5F, 0x41, 0x65, 0x45, 0x68, 0x65, 0x7A, 0x4F, 0x5F, 0x65, 0x5F, 0x01, 0x41,
+0xC1, 0x4F, 0x1F, 0x02, 0x65, 0x42, 0x5F, 0x41, 0x5F, 0x41, 0x00, 0x5F, 0x41, 0x00, 0x5F, 0x41,
+0x00, 0x5F, 0x41, 0x00, 0x5F, 0x41, 0x00, 0x5F, 0x42, 0x65, 0x4F, 0x45, 0x65, 0x4F, 0x65, 0x4F,
+0x65, 0x4F, 0x65, 0x4F, 0x65, 0xC6, 0xBD, 0x89, 0xBD, 0xC5, 0xBD, 0xC5, 0x02, 0x08, 0xC9, 0xC5,
+0x02, 0xAA, 0x27, 0x1F, 0x47, 0x1F, 0x01, 0x1F, 0x25, 0x00, 0x67, 0x5C, 0x5F, 0x00, 0x4F, 0x5F,
+0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F,
+0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x41, 0xC5, 0xA2, 0x25, 0x02, 0x1F, 0x25, 0x01, 0x01, 0x65,
+0x41, 0x00, 0x65, 0x41, 0x00, 0x65, 0x41, 0x00, 0xC5, 0x4F, 0x01, 0x0F, 0x8A, 0x1F, 0x0F, 0x00,
+0x41, 0x4F, 0x00, 0x41, 0x4F, 0x00, 0x41, 0x4F, 0x00, 0x41, 0x4F, 0xC4, 0xA2, 0x21, 0xBD, 0x1E,
+0x1F, 0x01, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x42, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x42, 0x45, 0x41, 0x00, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x42, 0x41, 0x44, 0x42, 0x08, 0x44, 0x42, 0x0D, 0x5C, 0x42, 0x19, 0x68, 0x5C, 0xC0, 0x4C,
+0x01, 0xC6, 0x7A, 0x4C, 0x16, 0x4C, 0x7A, 0x16, 0x4C, 0x00, 0x53, 0xC0, 0x4C, 0x01, 0x77, 0xDC,
+0xA4, 0x3F, 0xA4, 0x3F, 0xA4, 0x3F, 0xA4, 0x3F, 0xA4, 0x3F, 0xA4, 0x17, 0x89, 0x3F, 0xA4, 0x89,
+0x65, 0xB6, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0xCC, 0xD4, 0xCC, 0x65, 0x00, 0xD3, 0x9D,
+0x65, 0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x63, 0x95, 0x89, 0x95,
+0x63, 0x89, 0x95, 0x01, 0xD7, 0x89, 0x36, 0x3F, 0x02, 0x3F, 0x02, 0x3F, 0x28, 0x3F, 0x02, 0x3F,
+0x02, 0x3F, 0x28, 0x3F, 0x02, 0x28, 0x02, 0x04, 0x8C, 0x28, 0x02, 0x8C, 0x02, 0x00, 0xC3, 0x8C,
+0x02, 0x8C, 0x29, 0x00, 0xD6, 0x8C, 0x28, 0x44, 0x89, 0x1C, 0x89, 0xC5, 0x1C, 0x89, 0xC5, 0x1C,
+0x89, 0xC5, 0x1C, 0x89, 0xC5, 0x1C, 0x89, 0x1C, 0xB6, 0x44, 0x3F, 0x02, 0x0B, 0x7F, 0xC2, 0xC5,
+0x04, 0x1C, 0x03, 0xC5, 0xB8, 0x1C, 0xB8, 0x1C, 0xB8, 0x1C, 0x00, 0xC5, 0x8A, 0x1C, 0xB8, 0x9D,
+0x1C, 0x16, 0x00, 0xC1, 0x8C, 0x16, 0x14, 0xC3, 0x8A, 0x16, 0x04, 0x02, 0x08, 0x44, 0x42, 0xE0,
+0x0A, 0x44, 0x42, 0x08, 0x7F, 0x56, 0x02, 0xC1, 0x8C, 0x16, 0x10, 0xC8, 0x8A, 0x16, 0xB8, 0x9D,
+0x1C, 0x9D, 0x8A, 0xB8, 0x1C, 0x00, 0xCE, 0xB8, 0x1C, 0xB8, 0x1C, 0xB8, 0x1C, 0xB8, 0x1C, 0xB8,
+0x1C, 0x04, 0x02, 0xC5, 0x3F, 0x02, 0x07, 0x68, 0x42, 0x00, 0xD6, 0x44, 0x89, 0xC5, 0x1C, 0x89,
+0x1C, 0xC5, 0x1C, 0x89, 0xC5, 0x1C, 0x89, 0xC5, 0x1C, 0x89, 0xC5, 0x1C, 0x89, 0x9D, 0x04, 0x02,
+0x8C, 0x02, 0x00, 0xC1, 0x8C, 0x02, 0x00, 0xC1, 0x8C, 0x02, 0x00, 0xD5, 0x8C, 0x02, 0x26, 0x4A,
+0xA7, 0x0E, 0xA7, 0x54, 0x3E, 0x84, 0x3E, 0xA7, 0x3E, 0x84, 0x3E, 0xA7, 0x3E, 0xA7, 0x54, 0x84,
+0x58, 0x95, 0x01, 0xC1, 0x89, 0x95, 0x01, 0xC3, 0x67, 0xA4, 0x5B, 0x65, 0x00, 0xCB, 0x9D, 0x65,
+0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x01, 0xC4, 0xCC, 0x65, 0xCC, 0x65,
+0x9D, 0x00, 0xC4, 0x65, 0x9D, 0x65, 0x9D, 0x65, 0x00, 0x7D, 0x76, 0x57, 0xCB, 0xA4, 0x3F, 0xA4,
+0x3F, 0xA4, 0x3F, 0xA4, 0x3F, 0xA4, 0x3F, 0xA4, 0x3F, 0x00, 0xD2, 0xA4, 0x3F, 0x17, 0x50, 0x4C,
+0x65, 0x1B, 0x4C, 0x16, 0x4C, 0x7A, 0x16, 0x4C, 0x7A, 0x16, 0x4C, 0x7A, 0x16, 0x4C, 0x00, 0x5C,
+0xC1, 0x90, 0x02, 0x19, 0x44, 0x42, 0x07, 0x44, 0x42, 0x0A, 0x44, 0x42, 0x00, 0x40, 0x41, 0x40,
+0x05, 0x41, 0x00, 0x40, 0x0C, 0x71, 0x4F, 0xDE, 0x47, 0x01, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x0B,
+0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B,
+0x00, 0x0B, 0x12, 0x47, 0x4F, 0xCD, 0xA3, 0x03, 0xC1, 0xCD, 0xA3, 0x01, 0xC1, 0xCD, 0xA3, 0x01,
+0xC2, 0xCD, 0xA4, 0x3C, 0x0D, 0xC2, 0xA1, 0xCB, 0x38, 0x00, 0xCA, 0x79, 0x4B, 0x38, 0x79, 0x4B,
+0x79, 0x4B, 0x79, 0x38, 0x79, 0x38, 0x00, 0xC1, 0x79, 0x38, 0x00, 0xC1, 0x79, 0x38, 0x00, 0xC1,
+0x79, 0x38, 0x00, 0xC9, 0x79, 0x38, 0xC6, 0xD1, 0x5F, 0x43, 0x5F, 0x43, 0x5F, 0x43, 0x01, 0xC3,
+0xBC, 0x9A, 0x28, 0x37, 0x00, 0x57, 0x77, 0x7F, 0x77, 0x7F, 0x77, 0x57, 0x77, 0x7F, 0x77, 0x57,
+0x77, 0x00, 0x68, 0x5F, 0xC2, 0x8E, 0x1F, 0x8E, 0x04, 0x58, 0xC0, 0x8E, 0x00, 0xC3, 0xAA, 0x89,
+0x76, 0x14, 0x00, 0xD0, 0x52, 0x14, 0x76, 0x14, 0x76, 0x14, 0x52, 0x14, 0x76, 0x14, 0x52, 0x67,
+0x52, 0x14, 0x63, 0x90, 0x22, 0x02, 0xC1, 0x90, 0x22, 0x01, 0xC1, 0x90, 0x22, 0x00, 0xC2, 0x93,
+0x22, 0x90, 0x00, 0xC3, 0x8A, 0x65, 0x13, 0x65, 0x07, 0x53, 0x01, 0xC0, 0x65, 0x01, 0xC4, 0x41,
+0x10, 0x09, 0x15, 0x10, 0x00, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49,
+0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0xC1, 0x97, 0x10, 0x00, 0x42, 0x00, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x01, 0x41, 0x00, 0x40, 0x41, 0x40, 0x16, 0x41, 0x40, 0x41, 0x01,
+0x40, 0x41, 0x40, 0x27, 0x42, 0x00, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x5C,
+0x5B, 0x50, 0x01, 0x49, 0x50, 0x00, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50,
+0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0xC5, 0xA5, 0x4C, 0x7A, 0x65, 0x13, 0x65, 0x00, 0x53, 0xC4,
+0x65, 0x13, 0x65, 0x13, 0x65, 0x00, 0xC3, 0x7A, 0x65, 0x7A, 0x65, 0x00, 0xC3, 0xB8, 0x21, 0x22,
+0x90, 0x00, 0xC1, 0x93, 0x22, 0x01, 0xC1, 0x90, 0x22, 0x00, 0xC1, 0x90, 0x22, 0x01, 0xC4, 0x93,
+0x89, 0x14, 0x76, 0x14, 0x00, 0xC5, 0x52, 0x14, 0x76, 0x14, 0x52, 0x14, 0x00, 0xC1, 0x76, 0x14,
+0x00, 0xC8, 0x52, 0x14, 0x50, 0x14, 0xAA, 0x18, 0x8E, 0x18, 0x8E, 0x05, 0x5F, 0xC6, 0x8E, 0x17,
+0x3F, 0xA4, 0x37, 0x3F, 0xA4, 0x01, 0x77, 0xC0, 0xA4, 0x00, 0x77, 0xC0, 0xA4, 0x01, 0x77, 0xC0,
+0xA4, 0x00, 0xC1, 0xD1, 0x43, 0x01, 0xC3, 0x5F, 0x43, 0xBC, 0x43, 0x00, 0xC4, 0x5F, 0xAC, 0x81,
+0x79, 0x38, 0x00, 0xC1, 0x79, 0x38, 0x00, 0xC1, 0x79, 0x38, 0x00, 0xC1, 0x79, 0x38, 0x00, 0xCD,
+0x79, 0x38, 0x79, 0x38, 0x79, 0x38, 0x79, 0x4B, 0x38, 0x79, 0x38, 0x4B, 0x81, 0x38, 0x01, 0xC1,
+0x67, 0x3C, 0x0E, 0xC2, 0x57, 0x50, 0xA3, 0x00, 0xC1, 0xCD, 0xA3, 0x01, 0xC1, 0xCD, 0xA3, 0x00,
+0xC1, 0xD7, 0xA3, 0x00, 0xC1, 0xCD, 0xA3, 0x01, 0xC7, 0xB7, 0x12, 0x47, 0x2D, 0x12, 0x0B, 0x12,
+0x00, 0x13, 0x41, 0x01, 0x40, 0x05, 0x4B, 0x41, 0x01, 0x40, 0x41, 0x40, 0x05, 0x41, 0x00, 0x40,
+0x45, 0x40, 0x02, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0xC2,
+0xD8, 0xA3, 0x5D, 0x00, 0xC1, 0xD7, 0x5D, 0x06, 0xCE, 0xD7, 0x5D, 0xA3, 0xA4, 0x2C, 0x1D, 0x2C,
+0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x01, 0x7C, 0xC2, 0x57, 0xA1, 0x07, 0x01, 0x4D,
+0x47, 0x01, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x0D, 0xC1, 0x79, 0x19, 0x07, 0xC2, 0x43, 0x95, 0x17,
+0x0B, 0x77, 0x57, 0x00, 0xC1, 0x8C, 0x18, 0x0A, 0x5F, 0xC1, 0x9D, 0x14, 0x0F, 0xC2, 0x67, 0x93,
+0x40, 0x0C, 0xCD, 0x93, 0xD4, 0x80, 0x7D, 0x13, 0x80, 0x7D, 0x13, 0x80, 0xBE, 0xDF, 0xBE, 0x80,
+0x13, 0x00, 0xC0, 0x7D, 0x01, 0xC8, 0x80, 0xBE, 0x97, 0x62, 0x15, 0x97, 0x09, 0x97, 0x09, 0x00,
+0xC1, 0x97, 0x09, 0x00, 0xC1, 0x97, 0x09, 0x00, 0xC1, 0x97, 0x09, 0x00, 0xC1, 0x97, 0x09, 0x03,
+0xC0, 0x97, 0x00, 0x50, 0x5C, 0x42, 0x09, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x09,
+0x50, 0x49, 0xC1, 0x97, 0x09, 0x01, 0xC1, 0x97, 0x09, 0x00, 0xC1, 0x97, 0x09, 0x00, 0xC1, 0x97,
+0x09, 0x00, 0xC1, 0x97, 0x09, 0x00, 0xC1, 0x97, 0x09, 0x02, 0xCE, 0x97, 0x41, 0x13, 0x7D, 0x13,
+0x7D, 0x13, 0x7D, 0x13, 0x80, 0x8B, 0xBE, 0x3D, 0x8B, 0x13, 0x01, 0xC1, 0x7D, 0x13, 0x00, 0x5F,
+0x62, 0xC0, 0x40, 0x06, 0xC0, 0x93, 0x00, 0xC1, 0x40, 0x93, 0x01, 0xC1, 0x89, 0x14, 0x0D, 0xC1,
+0x5B, 0x14, 0x00, 0xC1, 0x8E, 0x18, 0x0A, 0xC6, 0xEA, 0x17, 0x37, 0x28, 0x17, 0x37, 0x17, 0x09,
+0xC2, 0xA4, 0x43, 0x19, 0x03, 0xC1, 0x9F, 0x19, 0x00, 0xC3, 0x43, 0xE2, 0x2E, 0x07, 0x07, 0x4D,
+0x47, 0x02, 0x4D, 0x03, 0x47, 0x02, 0x4D, 0x47, 0x02, 0xD0, 0xF2, 0x57, 0x2C, 0x1D, 0x2C, 0x1D,
+0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x00, 0xC1, 0x76, 0x5D, 0x0D,
+0xC2, 0xD7, 0xD8, 0x00, 0x00, 0x52, 0x40, 0x17, 0x41, 0x40, 0x07, 0x41, 0x40, 0x03, 0x41, 0x40,
+0x04, 0x41, 0x40, 0x45, 0x40, 0x03, 0x41, 0x40, 0x02, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0xC2,
+0x7C, 0xA3, 0x5D, 0x02, 0xC1, 0xA3, 0x5D, 0x00, 0xC2, 0xA3, 0xD7, 0x5D, 0x02, 0xD2, 0xA3, 0xA4,
+0x2C, 0x57, 0x1D, 0x57, 0x1D, 0x57, 0x1D, 0x57, 0x1D, 0x57, 0x2C, 0x3C, 0x2C, 0x1D, 0x57, 0xA1,
+0x07, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x6E, 0x47, 0x00, 0x4D, 0x00, 0x47,
+0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x6E, 0xC1, 0x43, 0x19, 0x01, 0xC1,
+0x43, 0x19, 0x02, 0xD0, 0x43, 0x9A, 0x17, 0x37, 0x17, 0x37, 0x17, 0x37, 0x17, 0x37, 0x17, 0x37,
+0x17, 0x37, 0x17, 0xA4, 0x17, 0x01, 0x58, 0x0A, 0x5F, 0xC1, 0x67, 0x14, 0x04, 0xC1, 0x5B, 0x14,
+0x06, 0xD4, 0x5B, 0x14, 0xCE, 0x93, 0x22, 0x40, 0x93, 0x22, 0x40, 0x93, 0x22, 0x40, 0x93, 0x22,
+0x40, 0x93, 0x22, 0x40, 0x22, 0xD4, 0x80, 0x00, 0xC3, 0x7D, 0x13, 0x7D, 0x13, 0x00, 0xC5, 0x6F,
+0x1A, 0xA9, 0x6A, 0x3D, 0x13, 0x00, 0xC5, 0x7D, 0x13, 0x80, 0x41, 0x97, 0x09, 0x03, 0xC1, 0x97,
+0x09, 0x03, 0xC1, 0x97, 0x09, 0x04, 0xC1, 0x97, 0x09, 0x01, 0xC4, 0x97, 0x09, 0x10, 0x8A, 0x02,
+0x09, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x09, 0x5B, 0x49, 0xC3, 0x97, 0x09, 0x62,
+0x09, 0x03, 0xC1, 0x97, 0x09, 0x03, 0xC1, 0x97, 0x09, 0x01, 0xC1, 0x97, 0x09, 0x00, 0xC3, 0x97,
+0x41, 0x80, 0x7D, 0x00, 0xC6, 0x80, 0x13, 0x7D, 0x80, 0x76, 0x88, 0x6F, 0x00, 0xC3, 0xCC, 0x13,
+0x7D, 0x13, 0x01, 0x7D, 0x45, 0x62, 0xC3, 0x40, 0x22, 0x40, 0x22, 0x00, 0xC5, 0x40, 0x93, 0x22,
+0x40, 0x22, 0x40, 0x01, 0xC2, 0x93, 0xC5, 0x14, 0x03, 0xC1, 0x5B, 0x14, 0x0A, 0xC1, 0x8E, 0x18,
+0x0A, 0xC4, 0xEA, 0x28, 0x17, 0x37, 0x17, 0x02, 0x77, 0x57, 0x00, 0x77, 0x57, 0x77, 0x57, 0x01,
+0xC3, 0xA4, 0x43, 0x9F, 0x19, 0x02, 0xC0, 0x43, 0x00, 0x59, 0xC2, 0x43, 0xE2, 0x07, 0x00, 0x4D,
+0x47, 0x4D, 0x47, 0x4D, 0x47, 0x02, 0x6E, 0x47, 0x00, 0x4D, 0x47, 0x03, 0x4D, 0x47, 0x4D, 0x47,
+0x00, 0x4D, 0x47, 0xCF, 0xBA, 0x07, 0xF1, 0x57, 0x2C, 0x1D, 0x57, 0x1D, 0x57, 0x1D, 0x57, 0x1D,
+0x57, 0x2C, 0x3C, 0x2C, 0x00, 0xD0, 0x57, 0x2C, 0xFD, 0x56, 0x5D, 0xD7, 0xA3, 0x5D, 0xA3, 0x5D,
+0xA3, 0x5D, 0xD7, 0xA3, 0x5D, 0xA3, 0x5D, 0x02, 0xC1, 0xD8, 0x00, 0x1A, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x01, 0x42, 0x48, 0x00, 0x41, 0x40, 0x01, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x0C, 0x41, 0x40, 0x0B, 0xC2, 0xB7, 0xA3, 0x5D, 0x00, 0xC0, 0xA3, 0x00, 0xC3, 0x5D,
+0xD7, 0xA3, 0x5D, 0x00, 0xC0, 0xA3, 0x01, 0xCF, 0x5D, 0xA3, 0xA4, 0x57, 0x1D, 0x3C, 0x1D, 0x3C,
+0x2C, 0x3C, 0x1D, 0x3C, 0x1D, 0x3C, 0x1D, 0x3C, 0x00, 0x6C, 0xC3, 0x67, 0x07, 0xBA, 0x07, 0x01,
+0x6E, 0x47, 0x01, 0xC6, 0x79, 0x0D, 0x4D, 0xB9, 0x87, 0xB1, 0x07, 0x01, 0x6E, 0x47, 0x01, 0x6E,
+0x47, 0x01, 0xC4, 0x79, 0x43, 0x19, 0x43, 0x19, 0x04, 0xCE, 0x43, 0x9A, 0x90, 0x28, 0x37, 0x17,
+0x37, 0x17, 0x37, 0x17, 0x37, 0x17, 0x37, 0x28, 0x17, 0x00, 0x7F, 0x77, 0xC1, 0x8C, 0x18, 0x0A,
+0x5F, 0xC1, 0x67, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x03, 0xC1, 0x67, 0x14, 0x00, 0xC3, 0x67, 0x14,
+0x67, 0x14, 0x00, 0xC7, 0xAC, 0x67, 0x93, 0x22, 0x93, 0x22, 0x0F, 0x22, 0x00, 0xC1, 0x93, 0x22,
+0x00, 0x4F, 0x62, 0x00, 0xC4, 0x93, 0x40, 0x22, 0x7C, 0x80, 0x00, 0x53, 0xCB, 0x7D, 0x80, 0x3D,
+0x56, 0x66, 0x65, 0x88, 0x66, 0x56, 0x94, 0x3D, 0x13, 0x02, 0xC1, 0xA5, 0x09, 0x00, 0x50, 0x49,
+0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49,
+0x50, 0x49, 0x01, 0x50, 0x42, 0x0A, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x09, 0x5B,
+0x50, 0x49, 0x02, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50,
+0x49, 0x50, 0x49, 0x50, 0xC3, 0x62, 0x41, 0xBE, 0x13, 0x01, 0x7D, 0x53, 0xC8, 0x94, 0x88, 0x56,
+0x6D, 0x9E, 0x6F, 0x8B, 0x13, 0x3D, 0x00, 0xC3, 0x7D, 0x13, 0x1F, 0x40, 0x00, 0x62, 0x4F, 0x62,
+0xC7, 0x93, 0x22, 0x0F, 0x22, 0x93, 0x0F, 0x40, 0x22, 0x00, 0x4F, 0xC1, 0x89, 0x14, 0x01, 0xC1,
+0x67, 0x14, 0x01, 0xC3, 0x67, 0x14, 0x5B, 0x14, 0x00, 0xC1, 0x67, 0x14, 0x03, 0xC1, 0x8E, 0x18,
+0x0A, 0xC3, 0xEA, 0x17, 0x37, 0x17, 0x00, 0x77, 0x57, 0x77, 0x57, 0x00, 0x77, 0x57, 0x02, 0x77,
+0x57, 0xC4, 0xA4, 0xD1, 0x43, 0x9F, 0x19, 0x01, 0xC0, 0x43, 0x00, 0x59, 0xC3, 0x43, 0xE2, 0x4B,
+0x07, 0x01, 0x6E, 0x47, 0x01, 0xCB, 0x79, 0x07, 0x0D, 0x07, 0x45, 0x39, 0x87, 0x4D, 0x81, 0x07,
+0x2E, 0x07, 0x01, 0x6E, 0x47, 0x6E, 0x00, 0x47, 0x00, 0xD4, 0x79, 0xA1, 0x3C, 0x2C, 0x3C, 0x1D,
+0x3C, 0x2C, 0x3C, 0x1D, 0x3C, 0x1D, 0x3C, 0x2C, 0x3C, 0x2C, 0x1D, 0x3C, 0x2C, 0x76, 0x5D, 0x03,
+0xC1, 0xD7, 0x5D, 0x00, 0xC1, 0xA3, 0x5D, 0x00, 0xC6, 0xD7, 0x5D, 0xA3, 0xD7, 0x5D, 0xB7, 0x00,
+0x0B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x02, 0x45, 0x48, 0x00, 0x42, 0x40, 0x02,
+0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x4E, 0x41, 0x48, 0x44, 0x40, 0x01, 0x41, 0x40, 0x03, 0xC6,
+0xC0, 0x04, 0x30, 0x02, 0x0B, 0x12, 0x00, 0x02, 0x41, 0x40, 0x0A, 0x5F, 0x4A, 0x43, 0x00, 0x41,
+0x40, 0x09, 0xC4, 0x6B, 0xA3, 0xD7, 0xA3, 0x5D, 0x02, 0xC3, 0xA3, 0x5D, 0xD7, 0x5D, 0x02, 0xC2,
+0xA3, 0xA4, 0x1D, 0x00, 0x6C, 0x01, 0x5D, 0x02, 0xC3, 0x57, 0x2C, 0x3C, 0x2C, 0x01, 0xC3, 0xA1,
+0x07, 0x0D, 0x07, 0x05, 0xC6, 0xBA, 0x38, 0x87, 0x38, 0xC3, 0xBB, 0x07, 0x09, 0x6E, 0xC1, 0x43,
+0x19, 0x06, 0xC2, 0x43, 0x9A, 0x17, 0x02, 0x7F, 0x57, 0x00, 0x7F, 0x57, 0x01, 0x77, 0x57, 0x77,
+0x57, 0x01, 0x58, 0x0B, 0xC1, 0x44, 0x14, 0x03, 0xC1, 0x67, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x05,
+0xC2, 0x67, 0x93, 0x40, 0x00, 0xC2, 0x93, 0x22, 0x0F, 0x00, 0x5E, 0x00, 0xCB, 0x40, 0x93, 0x40,
+0x93, 0x22, 0x40, 0x22, 0xD4, 0x13, 0x3D, 0x80, 0x13, 0x00, 0x7D, 0x53, 0xCB, 0x6F, 0x70, 0xA9,
+0x6F, 0x56, 0x3D, 0x80, 0x3D, 0x7D, 0x13, 0x80, 0x09, 0x07, 0xC0, 0x97, 0x00, 0x49, 0xC1, 0x41,
+0x09, 0x06, 0x55, 0x49, 0x01, 0x5B, 0x5C, 0x42, 0x02, 0x4A, 0x00, 0xC2, 0x58, 0x74, 0x02, 0x01,
+0x6D, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0xC1, 0x51, 0x0A, 0x00, 0xC5, 0x58, 0x04,
+0x90, 0x02, 0x1B, 0x09, 0x06, 0xC1, 0x41, 0x09, 0x03, 0xC0, 0x97, 0x00, 0x49, 0x05, 0xCB, 0x41,
+0x13, 0x3D, 0x13, 0x80, 0x8B, 0x13, 0xBE, 0x76, 0x1A, 0x6A, 0x6F, 0x00, 0xC2, 0x94, 0x3D, 0x13,
+0x00, 0xC3, 0x7D, 0x65, 0x22, 0x40, 0x00, 0x62, 0xC4, 0x40, 0x93, 0x1E, 0x0F, 0x1E, 0x00, 0xC0,
+0x40, 0x00, 0x4F, 0x62, 0xC5, 0x40, 0x0F, 0x89, 0x14, 0x67, 0x14, 0x06, 0xC1, 0x67, 0x14, 0x01,
+0xC5, 0x67, 0x14, 0x5B, 0x14, 0x1F, 0x18, 0x09, 0xC2, 0x8E, 0xEA, 0x17, 0x02, 0x77, 0x57, 0x00,
+0x77, 0x57, 0x01, 0x77, 0x57, 0x77, 0x57, 0x00, 0xC1, 0xA4, 0x43, 0x00, 0x59, 0x00, 0xC0, 0x43,
+0x00, 0xC1, 0x9F, 0x19, 0x00, 0xC2, 0x5F, 0xE2, 0x07, 0x06, 0x4D, 0x00, 0x6E, 0x4D, 0xC6, 0xB9,
+0x46, 0x81, 0x39, 0x45, 0x0D, 0x07, 0x09, 0xC4, 0xA1, 0x57, 0x1D, 0x3C, 0x2C, 0x02, 0x5D, 0x01,
+0xC5, 0x57, 0x3C, 0x1D, 0x57, 0x1D, 0x2C, 0x00, 0xC1, 0x56, 0x5D, 0x04, 0xC4, 0xA3, 0x5D, 0xA3,
+0xD7, 0x5D, 0x02, 0xC5, 0xA3, 0x5D, 0xB7, 0x12, 0x0B, 0x00, 0x08, 0xC4, 0x51, 0x0A, 0x60, 0x05,
+0x00, 0x0A, 0x41, 0x40, 0x01, 0x42, 0x48, 0x44, 0x40, 0x01, 0x41, 0x40, 0x02, 0x48, 0x42, 0x00,
+0x48, 0x40, 0x67, 0x40, 0x00, 0x41, 0x40, 0x45, 0x40, 0x01, 0x42, 0x43, 0x00, 0x41, 0x4B, 0x40,
+0x00, 0x41, 0x40, 0x01, 0x52, 0x4B, 0x69, 0x4A, 0x6D, 0x4A, 0xC3, 0xA2, 0x0B, 0x01, 0x00, 0x01,
+0x41, 0x40, 0x0A, 0x42, 0x4A, 0xC3, 0x86, 0x0A, 0x01, 0x00, 0x09, 0xC2, 0x4F, 0xA3, 0x5D, 0x01,
+0xC2, 0xA3, 0x5D, 0xD7, 0x00, 0xC1, 0xA3, 0x5D, 0x03, 0xC4, 0xA3, 0x3C, 0x1D, 0x57, 0x2C, 0x01,
+0x5D, 0xCA, 0xA8, 0x7E, 0x69, 0x1D, 0x3C, 0x2C, 0x1D, 0x57, 0x2C, 0xA1, 0x07, 0x07, 0x4D, 0xC5,
+0x45, 0xB9, 0x81, 0xC6, 0xB9, 0x07, 0x01, 0x4D, 0x47, 0x05, 0x6E, 0x59, 0x04, 0xC1, 0x9F, 0x19,
+0x00, 0xC2, 0x43, 0x9A, 0x17, 0x00, 0x77, 0x57, 0x00, 0x77, 0x57, 0x77, 0x57, 0x77, 0x57, 0x00,
+0x7F, 0x57, 0x00, 0x77, 0x57, 0x58, 0x0B, 0xC1, 0x9D, 0x14, 0x00, 0xC3, 0x5B, 0x14, 0x67, 0x14,
+0x0A, 0xC5, 0x67, 0x93, 0x40, 0x22, 0x40, 0x22, 0x00, 0x66, 0x01, 0x76, 0x62, 0xC7, 0x40, 0x22,
+0x40, 0x0F, 0x40, 0x7C, 0x7D, 0x13, 0x00, 0xC1, 0x8B, 0x13, 0x00, 0xC8, 0x94, 0x4C, 0x88, 0x56,
+0x7A, 0x3D, 0x13, 0x80, 0x13, 0x00, 0xC3, 0x7D, 0x41, 0x10, 0x09, 0x06, 0xC5, 0x97, 0x09, 0x41,
+0x09, 0x15, 0x09, 0x08, 0xC2, 0x62, 0x10, 0x02, 0x03, 0x44, 0x4A, 0x00, 0xC2, 0x49, 0x28, 0x02,
+0x00, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0x5C, 0x48, 0x4A, 0x4E, 0x44, 0x42,
+0x00, 0x5B, 0xC1, 0x7B, 0x09, 0x04, 0x50, 0x49, 0x00, 0x5B, 0xC0, 0x41, 0x00, 0x49, 0xC0, 0x97,
+0x00, 0x49, 0x05, 0xD6, 0x41, 0x13, 0x7D, 0xCC, 0x8B, 0x13, 0x80, 0x3D, 0x13, 0x88, 0x6A, 0x13,
+0x3D, 0x80, 0x13, 0x3D, 0x7A, 0x13, 0x3D, 0x3A, 0x40, 0x22, 0x40, 0x01, 0x66, 0x43, 0x66, 0x76,
+0x62, 0x01, 0xC4, 0x40, 0x22, 0x93, 0x89, 0x14, 0x02, 0xC3, 0x5B, 0x14, 0x67, 0x14, 0x04, 0xC1,
+0x5B, 0x14, 0x02, 0xC1, 0xE5, 0x18, 0x0A, 0xC3, 0xEA, 0x3F, 0x37, 0x17, 0x02, 0x77, 0x57, 0x77,
+0x57, 0x77, 0x57, 0x00, 0x77, 0x57, 0x00, 0x77, 0xC4, 0xD1, 0x9F, 0x19, 0x43, 0x19, 0x00, 0xC1,
+0x9F, 0x19, 0x00, 0xC3, 0x43, 0xE2, 0x0D, 0x07, 0x05, 0x4D, 0x47, 0xC8, 0xBA, 0x0D, 0xB9, 0x45,
+0x0D, 0x39, 0x46, 0x0D, 0x07, 0x07, 0x4D, 0x47, 0xC3, 0xA1, 0x2C, 0x1D, 0x2C, 0x01, 0x5D, 0x00,
+0xC3, 0x69, 0x7E, 0xBF, 0x1D, 0x00, 0x6C, 0x5D, 0x00, 0x6C, 0x00, 0xC1, 0x56, 0x5D, 0x03, 0xC0,
+0xA3, 0x00, 0xC1, 0xD7, 0xA3, 0x00, 0xC0, 0x5D, 0x02, 0xC5, 0xA3, 0xD7, 0x6B, 0x12, 0x0B, 0x00,
+0x07, 0x4B, 0xC4, 0x6D, 0x0A, 0x58, 0x02, 0x00, 0x0A, 0x41, 0x40, 0x00, 0x45, 0x4A, 0x41, 0x48,
+0x61, 0x40, 0x00, 0x41, 0x40, 0x02, 0x45, 0x43, 0x48, 0x5F, 0x52, 0x40, 0x00, 0x4B, 0x41, 0x40,
+0x45, 0x40, 0x00, 0x45, 0x44, 0x43, 0x00, 0x45, 0x40, 0x01, 0x41, 0x40, 0x01, 0x67, 0x4B, 0xC6,
+0x4F, 0x0A, 0x03, 0x0E, 0x08, 0x0F, 0x00, 0x02, 0x41, 0x40, 0x0A, 0x41, 0x43, 0x00, 0x45, 0x40,
+0x09, 0x6D, 0xC7, 0x4F, 0xA3, 0x5D, 0xD7, 0x5D, 0xA3, 0xC1, 0xD5, 0x01, 0xC1, 0xA3, 0x5D, 0x02,
+0xC2, 0xA3, 0xA4, 0x1D, 0x00, 0x6C, 0x00, 0x5D, 0xC7, 0x69, 0x91, 0x69, 0x91, 0x69, 0x1D, 0x57,
+0x1D, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x08, 0x4D, 0xC1, 0x4D, 0x39, 0x00, 0xC1, 0x55, 0x07, 0x09,
+0x6E, 0xC1, 0x9F, 0x19, 0x03, 0xC1, 0x9F, 0x19, 0x00, 0xC2, 0x43, 0x95, 0x17, 0x00, 0x77, 0x57,
+0x77, 0x68, 0x77, 0x57, 0x00, 0x7F, 0x57, 0x77, 0x57, 0x77, 0x7F, 0x00, 0x57, 0x58, 0x0A, 0x5F,
+0xC1, 0x44, 0x14, 0x05, 0xCC, 0x5B, 0x14, 0x67, 0x14, 0x5B, 0x14, 0x5B, 0x14, 0x5B, 0x14, 0xCE,
+0x22, 0x40, 0x01, 0x4F, 0x62, 0x68, 0xDC, 0x58, 0x49, 0x26, 0x40, 0x22, 0x40, 0x22, 0x93, 0x22,
+0xB8, 0x13, 0x8B, 0x13, 0x80, 0x13, 0x7D, 0x4C, 0x88, 0x9D, 0x88, 0xCC, 0x13, 0x7D, 0x80, 0x3D,
+0x7D, 0x13, 0x80, 0x09, 0x00, 0xC1, 0x97, 0x09, 0x03, 0xC7, 0x97, 0x09, 0x82, 0x1A, 0x20, 0x33,
+0x20, 0x09, 0x04, 0x55, 0x49, 0x01, 0x5B, 0x42, 0x03, 0x48, 0x4E, 0x01, 0x42, 0x01, 0x41, 0x40,
+0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0x5C, 0x4E, 0x01, 0x70, 0xC5, 0x90, 0x02, 0x1B, 0x09,
+0x97, 0x09, 0x04, 0xC6, 0x41, 0x33, 0x1A, 0x20, 0x33, 0x10, 0x09, 0x07, 0xCF, 0x41, 0x13, 0x3D,
+0x13, 0x3D, 0x80, 0x13, 0xBE, 0x88, 0x56, 0xA9, 0x6F, 0x8B, 0x13, 0x3D, 0x13, 0x01, 0x7D, 0x62,
+0xCA, 0x40, 0x22, 0x40, 0x22, 0x40, 0x02, 0x30, 0x49, 0x30, 0x40, 0x93, 0x00, 0xC0, 0x40, 0x00,
+0x4F, 0xC1, 0x89, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x03, 0xC1, 0x67, 0x14, 0x00, 0xC1, 0x5B, 0x14,
+0x01, 0xC1, 0x67, 0x14, 0x00, 0xC1, 0x8E, 0x18, 0x0A, 0xC1, 0x8C, 0x17, 0x00, 0x77, 0x57, 0x77,
+0x57, 0x04, 0x77, 0x57, 0x00, 0x77, 0x57, 0xC3, 0xA4, 0xD1, 0x43, 0x19, 0x00, 0xC0, 0x43, 0x00,
+0x59, 0x01, 0xC2, 0x5F, 0xE2, 0x07, 0x09, 0x4D, 0xC1, 0x45, 0x39, 0x00, 0xC4, 0x6E, 0x0D, 0x07,
+0x0D, 0x07, 0x05, 0x6E, 0xC6, 0xBA, 0x07, 0xA1, 0x57, 0x1D, 0x3C, 0x2C, 0x01, 0x7C, 0xC8, 0x91,
+0x69, 0x91, 0x69, 0x1D, 0x57, 0x1D, 0x57, 0x2C, 0x00, 0xC1, 0x56, 0x5D, 0x02, 0xC2, 0xA3, 0xD7,
+0xD5, 0x01, 0xC2, 0xD7, 0xA3, 0x5D, 0x00, 0xC1, 0xA3, 0x5D, 0x00, 0xC3, 0x6B, 0x12, 0x0B, 0x00,
+0x05, 0x52, 0x40, 0x4B, 0x44, 0x48, 0x42, 0x40, 0x0B, 0x41, 0x40, 0x00, 0x41, 0x4A, 0x43, 0x4E,
+0x48, 0x41, 0x40, 0x41, 0x40, 0x01, 0x41, 0x44, 0x43, 0x00, 0x42, 0x71, 0x67, 0x40, 0x00, 0x41,
+0x40, 0x45, 0x40, 0x00, 0x42, 0x4A, 0x48, 0x4A, 0x45, 0x40, 0x00, 0x41, 0x00, 0x40, 0x03, 0x4B,
+0x5C, 0x48, 0x7F, 0x4B, 0x40, 0x4B, 0x40, 0x01, 0x41, 0x40, 0x0A, 0x41, 0x43, 0x48, 0x44, 0x40,
+0x0A, 0xC7, 0x6B, 0xA3, 0x5D, 0xA3, 0x5D, 0xA3, 0xD5, 0xA3, 0x00, 0xC3, 0xD5, 0xD7, 0xA3, 0x5D,
+0x01, 0xC2, 0xA3, 0x95, 0x2C, 0x01, 0x5D, 0x01, 0xCA, 0x7E, 0xA8, 0x91, 0x3C, 0x1D, 0x2C, 0x1D,
+0x57, 0x2C, 0xA1, 0x07, 0x07, 0xC6, 0xBA, 0x0D, 0x46, 0x55, 0x4D, 0x45, 0x07, 0x00, 0x4D, 0x47,
+0x06, 0x6E, 0xC1, 0x43, 0x19, 0x00, 0xC2, 0x5F, 0x19, 0x43, 0x00, 0x59, 0x00, 0xC2, 0x43, 0x9A,
+0x17, 0x01, 0x7F, 0x57, 0x01, 0x77, 0x57, 0x00, 0x77, 0x68, 0x57, 0x01, 0x77, 0x57, 0x58, 0x02,
+0xC3, 0xE5, 0x18, 0x1F, 0x18, 0x04, 0xC1, 0x44, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x00, 0xC1, 0x67,
+0x14, 0x08, 0xC8, 0x67, 0x93, 0x40, 0x22, 0x40, 0x22, 0x0F, 0x36, 0x54, 0x01, 0x62, 0xC7, 0x93,
+0x40, 0x22, 0x40, 0x22, 0xD4, 0x7D, 0x13, 0x00, 0xC1, 0xBE, 0x13, 0x01, 0xC5, 0xA9, 0x6A, 0x88,
+0x65, 0x8B, 0x13, 0x00, 0xC5, 0x80, 0x13, 0x7D, 0x13, 0x62, 0x09, 0x07, 0x60, 0xC0, 0x66, 0x00,
+0x5A, 0x60, 0x49, 0x07, 0xC2, 0x62, 0x10, 0x02, 0x03, 0x44, 0x4A, 0xC0, 0x49, 0x00, 0x68, 0x42,
+0x00, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x03, 0xC4, 0x70, 0x08, 0x0E, 0x36, 0x02,
+0x00, 0x5B, 0xC1, 0x7B, 0x09, 0x06, 0x5A, 0xC0, 0x66, 0x00, 0x73, 0x50, 0x49, 0x07, 0xCD, 0x41,
+0x13, 0x7D, 0xCC, 0xBE, 0x13, 0x7D, 0xDF, 0x76, 0x6A, 0x92, 0x56, 0x3D, 0x13, 0x00, 0x7D, 0x00,
+0xC3, 0x80, 0x3D, 0x05, 0x40, 0x00, 0xC1, 0x93, 0x40, 0x00, 0x7F, 0x4E, 0x00, 0xC8, 0x54, 0x17,
+0x93, 0x22, 0x93, 0x22, 0x93, 0xC5, 0x14, 0x02, 0xC1, 0x67, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x00,
+0xC1, 0x5B, 0x14, 0x00, 0xC1, 0x67, 0x14, 0x02, 0xC1, 0x8E, 0x18, 0x02, 0xC1, 0x8E, 0x18, 0x05,
+0xCB, 0xEA, 0x17, 0xA4, 0x17, 0x3F, 0x17, 0x37, 0x17, 0x37, 0x17, 0x37, 0x17, 0x00, 0x77, 0x68,
+0x57, 0x00, 0x77, 0xC1, 0xD1, 0x19, 0x00, 0xC0, 0x5F, 0x00, 0xC2, 0x43, 0x9F, 0x19, 0x00, 0xC3,
+0x9F, 0xE2, 0xBA, 0x07, 0x08, 0x4D, 0xC5, 0x45, 0x55, 0x4D, 0x45, 0x4B, 0x07, 0x08, 0x4D, 0x47,
+0xC6, 0xA1, 0x57, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x00, 0xC8, 0x7E, 0xA8, 0x91, 0x3C, 0x2C, 0x1D,
+0x2C, 0x1D, 0x2C, 0x00, 0xC1, 0x56, 0x5D, 0x01, 0xC0, 0xA3, 0x00, 0xC0, 0xC1, 0x00, 0xC1, 0xA3,
+0xC1, 0x00, 0xC1, 0xA3, 0x5D, 0x01, 0xC5, 0xA3, 0xD7, 0x6B, 0x27, 0x0B, 0x00, 0x06, 0x4B, 0x40,
+0x44, 0x48, 0x70, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x01, 0x42, 0x48, 0x42, 0x41, 0x40, 0x00, 0x41,
+0x40, 0x01, 0x41, 0x4A, 0x48, 0x00, 0x44, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x4E,
+0x45, 0x43, 0x44, 0x40, 0x01, 0x41, 0x40, 0x01, 0x52, 0x4B, 0x69, 0x4A, 0x41, 0x4A, 0xC2, 0xA2,
+0x0B, 0x00, 0x02, 0x41, 0x40, 0x0A, 0x41, 0x44, 0x4A, 0x48, 0x40, 0x41, 0x40, 0x07, 0x52, 0xC4,
+0x4F, 0xA3, 0x5D, 0xD7, 0x5D, 0x00, 0xC5, 0xD5, 0xC1, 0xD7, 0xD5, 0xA3, 0x5D, 0x02, 0xD2, 0xA3,
+0xA4, 0x2C, 0x1D, 0x57, 0x1D, 0x3C, 0x69, 0xA8, 0x7E, 0xA8, 0x3C, 0x2C, 0x3C, 0x2C, 0x1D, 0x57,
+0xA1, 0x07, 0x06, 0x4D, 0x00, 0x47, 0xC2, 0x6E, 0x4E, 0x7F, 0x00, 0x47, 0x09, 0x6E, 0xC8, 0x9F,
+0x19, 0x9F, 0x5F, 0x2A, 0x75, 0xBC, 0x43, 0x19, 0x00, 0xC4, 0x9A, 0x28, 0x17, 0x37, 0x17, 0x00,
+0x77, 0x57, 0x68, 0x77, 0x57, 0x00, 0x77, 0x57, 0x77, 0x7F, 0x57, 0x00, 0x58, 0x02, 0xC1, 0x8C,
+0x98, 0x00, 0xC2, 0x8D, 0x8C, 0x18, 0x01, 0xC2, 0x8E, 0x9D, 0x14, 0x02, 0xC1, 0x5B, 0x14, 0x03,
+0xC5, 0x5B, 0x14, 0x5B, 0x14, 0x5B, 0x14, 0x00, 0xC2, 0x67, 0x22, 0x40, 0x00, 0x62, 0x01, 0x7F,
+0xC3, 0x58, 0x30, 0x5A, 0x22, 0x00, 0xC9, 0x40, 0x22, 0x40, 0x22, 0x7C, 0x7D, 0x13, 0x8B, 0x13,
+0x3D, 0x00, 0xC1, 0x56, 0x6A, 0x01, 0x7D, 0x53, 0x00, 0xC5, 0x80, 0x3D, 0x7D, 0x13, 0x41, 0x09,
+0x07, 0xC6, 0x62, 0x41, 0x1B, 0x70, 0x66, 0x20, 0x09, 0x04, 0x55, 0x49, 0x01, 0x5B, 0x5C, 0x42,
+0x02, 0x48, 0x00, 0xC2, 0x96, 0x49, 0x02, 0x01, 0x6D, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42,
+0x02, 0x44, 0x4A, 0x42, 0x4A, 0x43, 0x68, 0x42, 0x5B, 0x49, 0xC1, 0x97, 0x09, 0x05, 0xC5, 0x41,
+0xAD, 0x1A, 0x72, 0x10, 0x09, 0x06, 0xC3, 0x62, 0x41, 0x13, 0x3D, 0x00, 0x53, 0xC4, 0x8B, 0x13,
+0x56, 0x6F, 0x6A, 0x00, 0xC3, 0x4C, 0x13, 0x3D, 0x13, 0x02, 0xC2, 0x65, 0x05, 0x40, 0x02, 0x62,
+0xCB, 0x90, 0x30, 0x26, 0x5A, 0x90, 0x40, 0x93, 0x22, 0x40, 0x0F, 0x89, 0x14, 0x00, 0xC1, 0x5B,
+0x14, 0x00, 0xC1, 0x5B, 0x14, 0x0A, 0x5F, 0x58, 0x01, 0xC6, 0x8C, 0x98, 0x74, 0x8D, 0x74, 0xAE,
+0x18, 0x01, 0x68, 0x57, 0x01, 0x77, 0x57, 0x00, 0x68, 0x77, 0x57, 0x68, 0x77, 0x7F, 0x57, 0x00,
+0x77, 0x57, 0xC2, 0xA4, 0xD1, 0x19, 0x00, 0xC8, 0x5F, 0x2A, 0x6C, 0x5F, 0x43, 0x19, 0x5F, 0xE2,
+0x07, 0x08, 0xC7, 0xBA, 0x0D, 0x46, 0x6E, 0x4E, 0x7F, 0x38, 0x0D, 0x00, 0x47, 0x07, 0x4D, 0xCB,
+0xA1, 0x3C, 0x2C, 0x3C, 0x2C, 0x1D, 0x3C, 0x69, 0x85, 0x7E, 0xA8, 0x3C, 0x01, 0x6C, 0x7C, 0x6C,
+0x00, 0xC1, 0x56, 0x5D, 0x03, 0xC0, 0xC1, 0x00, 0xC3, 0xA3, 0xD5, 0xC1, 0x5D, 0x00, 0xC1, 0xA3,
+0x5D, 0x01, 0xC3, 0x6B, 0x12, 0x0B, 0x00, 0x05, 0x52, 0x40, 0x4B, 0x69, 0x48, 0xC2, 0x49, 0x0F,
+0x00, 0x0A, 0x41, 0x40, 0x00, 0x45, 0x4A, 0x67, 0x4A, 0x42, 0x40, 0x00, 0x41, 0x40, 0x02, 0x4A,
+0x44, 0x42, 0xC1, 0x49, 0x00, 0x02, 0x41, 0x40, 0x45, 0x40, 0x01, 0x42, 0x43, 0x00, 0x45, 0x40,
+0x01, 0x41, 0x40, 0x03, 0xC5, 0xAF, 0x03, 0x08, 0x26, 0x2D, 0x00, 0x03, 0x41, 0x40, 0x0A, 0x42,
+0x4A, 0x44, 0x42, 0x40, 0x0A, 0xC2, 0xB7, 0xA3, 0x5D, 0x00, 0xC0, 0xA3, 0x00, 0xC1, 0xD7, 0xC1,
+0x01, 0xC0, 0x5D, 0x03, 0xCD, 0xA3, 0x3C, 0x57, 0x1D, 0x2C, 0x1D, 0x3C, 0xA8, 0x5A, 0x54, 0x7E,
+0x3C, 0x1D, 0x2C, 0x00, 0x5D, 0xC2, 0x57, 0xA1, 0x07, 0x07, 0x4D, 0x00, 0x78, 0xC3, 0x61, 0x6E,
+0x39, 0x07, 0x01, 0x4D, 0x47, 0x05, 0x6E, 0xC2, 0x9F, 0x19, 0x43, 0x00, 0x51, 0x00, 0x6A, 0xC5,
+0x43, 0x19, 0x43, 0x3C, 0x28, 0x17, 0x00, 0x77, 0x57, 0x77, 0x57, 0x01, 0x7F, 0x57, 0x03, 0x77,
+0x57, 0x58, 0x03, 0xC3, 0x8E, 0x98, 0x74, 0x18, 0x03, 0xC1, 0x9D, 0x14, 0x01, 0xC1, 0x67, 0x14,
+0x01, 0xC3, 0x5B, 0x14, 0x67, 0x14, 0x05, 0xC2, 0x67, 0x93, 0x40, 0x00, 0x62, 0xC4, 0x40, 0x22,
+0x3F, 0x60, 0x26, 0x00, 0xCB, 0x40, 0x0F, 0x40, 0x22, 0x93, 0x22, 0xE4, 0x13, 0x8B, 0x13, 0x80,
+0x13, 0x00, 0xC4, 0x4C, 0x6A, 0x71, 0x70, 0x13, 0x00, 0xC6, 0x7D, 0x13, 0x80, 0x13, 0x7D, 0x13,
+0x09, 0x08, 0x60, 0xC0, 0x66, 0x00, 0xC3, 0x92, 0x20, 0x10, 0x09, 0x06, 0xC2, 0x62, 0x10, 0x02,
+0x03, 0x4E, 0x00, 0x4A, 0xC1, 0x49, 0x02, 0x01, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42,
+0x02, 0xC9, 0x6D, 0x9E, 0x0A, 0x0E, 0x04, 0x90, 0x02, 0x1B, 0x7B, 0x09, 0x06, 0x5A, 0xC0, 0x66,
+0x00, 0x5A, 0x55, 0x49, 0x07, 0xC5, 0x41, 0x13, 0x7D, 0xCC, 0x8B, 0x13, 0x01, 0xC4, 0x76, 0x1A,
+0xA9, 0x4C, 0x13, 0x00, 0x7D, 0x53, 0x7D, 0xC4, 0x80, 0x3D, 0x93, 0x40, 0x22, 0x00, 0xC0, 0x40,
+0x00, 0x7F, 0x43, 0x66, 0x70, 0xC3, 0x40, 0x22, 0x0F, 0x40, 0x00, 0x62, 0xC1, 0xC5, 0x14, 0x05,
+0xC5, 0x67, 0x14, 0x5B, 0x14, 0x67, 0x14, 0x00, 0xC5, 0x5B, 0x14, 0x5B, 0x14, 0xE5, 0x18, 0x02,
+0xC4, 0xAE, 0x74, 0x98, 0x8E, 0x18, 0x02, 0xC3, 0x8E, 0x17, 0x37, 0x17, 0x00, 0x7F, 0x77, 0x57,
+0x04, 0x77, 0x57, 0x01, 0x77, 0xCC, 0x43, 0x9F, 0x19, 0x43, 0x75, 0x2B, 0x75, 0x43, 0x19, 0x9F,
+0xE2, 0x0D, 0x07, 0x07, 0x4D, 0x47, 0x4D, 0x79, 0xC3, 0x6E, 0x39, 0x45, 0x07, 0x07, 0x6E, 0x47,
+0x00, 0xC3, 0xA1, 0x2C, 0x1D, 0x2C, 0x00, 0x7C, 0x5D, 0xC5, 0xA8, 0x85, 0xA7, 0x7E, 0x3C, 0x2C,
+0x01, 0x5D, 0x6C, 0x00, 0xC1, 0x56, 0x5D, 0x02, 0xC5, 0xA3, 0x5D, 0xC1, 0xD5, 0xC1, 0x5D, 0x03,
+0xC5, 0xA3, 0xD7, 0x6B, 0x12, 0x0B, 0x00, 0x05, 0x52, 0x4B, 0x45, 0x4A, 0x43, 0x42, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x00, 0x41, 0x43, 0x00, 0x48, 0x41, 0x40, 0x00, 0x41, 0x40, 0x02, 0x42, 0x43,
+0x00, 0x68, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x00, 0x67, 0x5C, 0x48, 0x43, 0x45, 0x40, 0x01,
+0x41, 0x40, 0x01, 0x71, 0x40, 0x45, 0xC3, 0x44, 0x27, 0x0B, 0x00, 0x04, 0x41, 0x40, 0x0A, 0x42,
+0x43, 0x42, 0x43, 0x45, 0x40, 0x09, 0xC4, 0x4F, 0xA3, 0x5D, 0xD7, 0x5D, 0x00, 0xC0, 0xC1, 0x00,
+0xC4, 0xD5, 0xC1, 0xD7, 0xA3, 0x5D, 0x01, 0xC5, 0xA3, 0xA4, 0x2C, 0x3C, 0x2C, 0x1D, 0x00, 0xC6,
+0xBF, 0xC9, 0x69, 0x91, 0x69, 0x2C, 0x3C, 0x00, 0x6C, 0x00, 0xC1, 0xA1, 0x07, 0x08, 0x4D, 0xC6,
+0x4B, 0x64, 0xC2, 0x39, 0x07, 0x0D, 0x07, 0x07, 0x6E, 0xC4, 0x43, 0x19, 0x9F, 0x75, 0x2B, 0x00,
+0x6A, 0x59, 0x01, 0xC3, 0x9A, 0x17, 0x37, 0x17, 0x01, 0x68, 0x77, 0x57, 0xC2, 0x60, 0x17, 0x37,
+0x00, 0x57, 0x77, 0x57, 0x7F, 0x57, 0x58, 0x02, 0xC4, 0xAD, 0x8D, 0x74, 0x8E, 0x18, 0x02, 0xC2,
+0x8E, 0x89, 0x14, 0x02, 0xD0, 0x76, 0x5B, 0x67, 0xCE, 0x76, 0x67, 0x14, 0x67, 0x14, 0x5B, 0x14,
+0x5B, 0x14, 0x95, 0x93, 0x22, 0x40, 0x00, 0x4F, 0x62, 0x43, 0x66, 0x7F, 0x00, 0xC7, 0x93, 0x22,
+0x40, 0x22, 0x40, 0x22, 0x94, 0x13, 0x00, 0x7D, 0xC5, 0x80, 0x13, 0x7D, 0xCC, 0x66, 0x88, 0x00,
+0xC8, 0x4C, 0x3D, 0x13, 0x80, 0x3D, 0x7D, 0x3D, 0x41, 0x09, 0x07, 0x5B, 0x73, 0xC4, 0x66, 0x1A,
+0x20, 0x10, 0x09, 0x04, 0x55, 0x49, 0x01, 0x5B, 0x42, 0x03, 0x48, 0x4A, 0x00, 0x43, 0x68, 0x42,
+0x00, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0xC5, 0x44, 0x08, 0x0A, 0x30, 0x04,
+0x02, 0x00, 0x5B, 0x49, 0x07, 0xC5, 0x78, 0xCF, 0x70, 0x20, 0x10, 0x09, 0x07, 0xC3, 0x41, 0x13,
+0x3D, 0x13, 0x00, 0xC4, 0x7D, 0x13, 0x8B, 0x6F, 0x88, 0x00, 0xC2, 0x6F, 0x3D, 0x13, 0x00, 0x7D,
+0x53, 0x00, 0x7D, 0x45, 0xC0, 0x40, 0x02, 0x62, 0x76, 0x70, 0x44, 0x77, 0xD1, 0x40, 0x93, 0x22,
+0x40, 0x22, 0x93, 0x89, 0x14, 0x5B, 0x14, 0x67, 0x14, 0x5B, 0x52, 0x67, 0x14, 0x63, 0x14, 0x00,
+0xC1, 0x5B, 0x14, 0x03, 0xC1, 0x8E, 0x18, 0x01, 0xC3, 0x8E, 0x8D, 0x92, 0x8E, 0x00, 0x58, 0x02,
+0xC5, 0xEA, 0x17, 0x37, 0x17, 0x37, 0x17, 0x00, 0x77, 0x01, 0x7F, 0x77, 0x57, 0x77, 0x57, 0x77,
+0x57, 0xC2, 0xA4, 0xD1, 0x19, 0x00, 0xC8, 0x5F, 0x2B, 0x2A, 0x2B, 0x43, 0x19, 0x43, 0xE2, 0x07,
+0x0A, 0x4D, 0xC5, 0x61, 0xC2, 0xBB, 0x38, 0x0D, 0x07, 0x07, 0xC6, 0xBA, 0x07, 0xA1, 0x57, 0x1D,
+0x3C, 0x2C, 0x00, 0x5D, 0xC5, 0x69, 0xC9, 0x69, 0xC9, 0xBF, 0x1D, 0x00, 0x7C, 0xC1, 0x57, 0x2C,
+0x00, 0xC1, 0x56, 0x5D, 0x03, 0xC0, 0xC1, 0x02, 0xC1, 0xD7, 0x5D, 0x02, 0xC5, 0xA3, 0x5D, 0x6B,
+0x12, 0x0B, 0x00, 0x06, 0x4B, 0xC5, 0x4F, 0x03, 0x02, 0x03, 0x28, 0x00, 0x0A, 0x41, 0x40, 0x00,
+0x41, 0x44, 0x41, 0x40, 0x02, 0x41, 0x40, 0x02, 0x42, 0x43, 0x48, 0x42, 0x40, 0x67, 0x40, 0x4B,
+0x41, 0x40, 0x45, 0x40, 0x01, 0x41, 0x00, 0x43, 0x42, 0x40, 0x01, 0x41, 0x40, 0x02, 0xC6, 0x47,
+0x01, 0x0A, 0x08, 0x03, 0x27, 0x00, 0x03, 0x41, 0x40, 0x0A, 0x4A, 0x00, 0x43, 0x48, 0x41, 0x40,
+0x09, 0xC4, 0xB7, 0xA3, 0x5D, 0xA3, 0x5D, 0x00, 0xC5, 0xD7, 0xD5, 0xCD, 0xD7, 0xA3, 0x5D, 0x02,
+0xC2, 0xA3, 0xA4, 0x2C, 0x01, 0xCD, 0x57, 0x1D, 0x3C, 0x91, 0x9A, 0x91, 0x3C, 0x1D, 0x3C, 0x2C,
+0x1D, 0x57, 0xA1, 0x07, 0x07, 0x4D, 0x47, 0x78, 0xC4, 0x4D, 0x55, 0x4D, 0x0D, 0x07, 0x08, 0x6E,
+0xC1, 0x43, 0x19, 0x00, 0xC4, 0x5F, 0x75, 0x2A, 0x2B, 0x19, 0x01, 0xC1, 0x95, 0x17, 0x01, 0x77,
+0x57, 0xCC, 0x60, 0x49, 0x3F, 0x49, 0x30, 0x17, 0x28, 0x17, 0x37, 0x17, 0xA4, 0x28, 0x18, 0x02,
+0xC1, 0xAD, 0x74, 0x00, 0xC2, 0xCF, 0x96, 0x18, 0x02, 0xC1, 0x9D, 0x14, 0x02, 0xC3, 0x67, 0x5B,
+0x71, 0x34, 0x00, 0xC3, 0x9B, 0x52, 0x67, 0x14, 0x03, 0xC3, 0x67, 0x90, 0x22, 0x40, 0x01, 0x4F,
+0x44, 0xD1, 0x54, 0x36, 0x37, 0x22, 0x40, 0x0F, 0x40, 0x93, 0x22, 0xE4, 0x7D, 0x13, 0x3D, 0x80,
+0x7D, 0x13, 0x4C, 0x6F, 0x00, 0xC5, 0x88, 0x4C, 0x13, 0x3D, 0x80, 0x13, 0x00, 0xC2, 0x7D, 0x13,
+0x09, 0x08, 0xC6, 0x7B, 0x6A, 0xAB, 0x66, 0x33, 0x15, 0x09, 0x06, 0xC2, 0x62, 0x10, 0x02, 0x03,
+0x43, 0x4E, 0x4A, 0x4E, 0xC1, 0x53, 0x02, 0x00, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42,
+0x03, 0x4A, 0x00, 0x4E, 0x00, 0x76, 0x42, 0x5B, 0xC1, 0x7B, 0x09, 0x04, 0x50, 0x49, 0x73, 0x5A,
+0xC3, 0x66, 0xAB, 0x10, 0x09, 0x07, 0xC8, 0x41, 0x13, 0x7D, 0xCC, 0xBE, 0x80, 0x13, 0x8B, 0x6F,
+0x00, 0xDA, 0x88, 0x6A, 0x3D, 0x13, 0x3D, 0x13, 0x3D, 0x80, 0x65, 0x3A, 0x40, 0x22, 0x40, 0x93,
+0x40, 0x28, 0x0E, 0x36, 0x37, 0x22, 0x40, 0x93, 0x22, 0x40, 0x0F, 0x89, 0x14, 0x03, 0xC2, 0x67,
+0x52, 0x34, 0x00, 0xC3, 0x64, 0xC7, 0x5B, 0x14, 0x00, 0xC1, 0x67, 0x14, 0x01, 0xC1, 0x8E, 0x18,
+0x01, 0xC5, 0x8C, 0x74, 0xAD, 0x92, 0x98, 0x18, 0x02, 0xC3, 0xAA, 0x17, 0xA4, 0x17, 0x00, 0x7F,
+0x77, 0xC4, 0x49, 0x37, 0x30, 0x49, 0x17, 0x01, 0x7F, 0x57, 0x68, 0x77, 0xC1, 0xD1, 0x19, 0x00,
+0xC2, 0x5F, 0x75, 0x2A, 0x00, 0x59, 0xC3, 0x43, 0x19, 0xE2, 0x07, 0x0B, 0xC5, 0x4D, 0x55, 0x4D,
+0xC6, 0x0D, 0x07, 0x07, 0x4D, 0x47, 0xC3, 0xA1, 0x57, 0x1D, 0x2C, 0x00, 0x7C, 0x6C, 0x5D, 0xC8,
+0x91, 0x9A, 0x7E, 0x69, 0x1D, 0x3C, 0x2C, 0x1D, 0x2C, 0x00, 0xC1, 0x56, 0x5D, 0x01, 0xC0, 0xA3,
+0x00, 0xC3, 0xD7, 0x78, 0xC1, 0xD7, 0x00, 0xC0, 0x5D, 0x01, 0xC6, 0xA3, 0xD7, 0x5D, 0x7C, 0x12,
+0x0B, 0x00, 0x06, 0x6D, 0x44, 0x4E, 0xC3, 0x44, 0x49, 0x05, 0x00, 0x0A, 0x41, 0x40, 0x00, 0x41,
+0x4A, 0x48, 0x43, 0x41, 0x40, 0x00, 0x41, 0x40, 0x02, 0x41, 0x00, 0x42, 0x48, 0x40, 0xC6, 0x47,
+0x00, 0x0B, 0x01, 0x00, 0x05, 0x00, 0x01, 0x44, 0x00, 0x4A, 0x42, 0x40, 0x01, 0x41, 0x40, 0x02,
+0x71, 0x42, 0x48, 0x5F, 0x71, 0x40, 0x04, 0x41, 0x40, 0x0A, 0x45, 0x48, 0x4A, 0x43, 0x41, 0x40,
+0x09, 0xCA, 0x4F, 0xA3, 0x5D, 0xA3, 0x5D, 0xD7, 0xD5, 0xC1, 0xD5, 0xF9, 0x5D, 0x03, 0xC5, 0xCD,
+0xA4, 0x1D, 0x3C, 0x2C, 0x1D, 0x01, 0xCA, 0xA8, 0x7E, 0x85, 0x3C, 0x2C, 0x1D, 0x3C, 0x2C, 0x57,
+0xA1, 0x07, 0x09, 0xC2, 0x7F, 0x87, 0x61, 0x00, 0x47, 0x4D, 0x47, 0x07, 0x6E, 0xC1, 0x43, 0x19,
+0x00, 0xC4, 0x43, 0x6C, 0x75, 0x6C, 0x19, 0x01, 0xC1, 0x9A, 0x17, 0x03, 0xC0, 0x85, 0x00, 0x62,
+0x77, 0xC1, 0x54, 0x17, 0x00, 0x77, 0x57, 0x02, 0x58, 0x02, 0xC4, 0x8E, 0x96, 0xCF, 0x98, 0x18,
+0x03, 0xC1, 0x67, 0x14, 0x02, 0xC0, 0x5B, 0x00, 0xD3, 0x52, 0x64, 0x71, 0x67, 0x14, 0x76, 0x5B,
+0x14, 0x5B, 0x14, 0x5B, 0x95, 0x93, 0x22, 0x40, 0x22, 0x40, 0x22, 0x05, 0x26, 0x00, 0x77, 0xC9,
+0x40, 0x22, 0x40, 0x22, 0x40, 0x22, 0x94, 0x13, 0x8B, 0x13, 0x01, 0xC5, 0x7D, 0x8B, 0x56, 0x6A,
+0x6F, 0x13, 0x00, 0xC6, 0x7D, 0x80, 0x3D, 0x7D, 0x13, 0x41, 0x09, 0x08, 0xC5, 0x7B, 0x1A, 0x92,
+0x1A, 0xA5, 0x09, 0x04, 0x55, 0x49, 0x01, 0x5B, 0x5C, 0x42, 0x01, 0x45, 0x4A, 0x00, 0x44, 0xC2,
+0x8D, 0x0E, 0x02, 0x00, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0x5C, 0xC9, 0x8D,
+0x04, 0x0A, 0x0E, 0x58, 0x28, 0x1B, 0x09, 0x97, 0x09, 0x05, 0x60, 0x5A, 0x00, 0x73, 0x50, 0x49,
+0x07, 0xC9, 0x41, 0x13, 0x3D, 0x13, 0x3D, 0x80, 0x3D, 0xBE, 0x4C, 0x6A, 0x00, 0xC2, 0x4C, 0x3D,
+0x13, 0x00, 0x7D, 0x53, 0x00, 0x7D, 0x62, 0xC2, 0x40, 0x22, 0x40, 0x00, 0xC8, 0x93, 0x22, 0x60,
+0x30, 0x37, 0x40, 0x93, 0x22, 0x40, 0x00, 0x4F, 0xC1, 0x89, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x01,
+0xC3, 0x64, 0x71, 0x67, 0x14, 0x04, 0xC3, 0x5B, 0x14, 0x8E, 0x18, 0x02, 0xC4, 0x8C, 0x49, 0x8D,
+0x8E, 0x18, 0x02, 0xC1, 0xEA, 0x17, 0x00, 0x7F, 0x57, 0x00, 0xC5, 0x60, 0x54, 0x22, 0x17, 0x54,
+0x37, 0x00, 0x57, 0x00, 0x77, 0x57, 0xC2, 0xA4, 0x43, 0x19, 0x00, 0xC0, 0x43, 0x00, 0x51, 0xC5,
+0x5F, 0x43, 0x19, 0x43, 0xE2, 0x07, 0x0A, 0xC1, 0x4B, 0x87, 0x00, 0xC3, 0xA0, 0x46, 0x0D, 0x07,
+0x06, 0x6E, 0x47, 0x00, 0xC4, 0xA1, 0x57, 0x1D, 0x3C, 0x2C, 0x00, 0x5D, 0x7C, 0xC4, 0x69, 0x7E,
+0xA8, 0x3C, 0x2C, 0x00, 0x7C, 0x00, 0x6C, 0x00, 0xC1, 0x56, 0x5D, 0x03, 0xC1, 0xC1, 0xD5, 0x00,
+0xC0, 0x5D, 0x03, 0xC0, 0xA3, 0x00, 0xC4, 0x5D, 0x6B, 0x12, 0x0B, 0x00, 0x06, 0x4B, 0x00, 0x43,
+0x48, 0xC2, 0x49, 0x05, 0x00, 0x0A, 0x41, 0x40, 0x00, 0x42, 0x48, 0x45, 0x4B, 0x40, 0x01, 0x41,
+0x40, 0x02, 0x42, 0x43, 0x48, 0x43, 0x40, 0x41, 0x40, 0x4B, 0x41, 0x40, 0x45, 0x40, 0x01, 0x41,
+0x43, 0x4E, 0x45, 0x40, 0x01, 0x41, 0x40, 0x02, 0x41, 0xC3, 0x6D, 0x02, 0x03, 0x00, 0x05, 0x41,
+0x40, 0x0A, 0x42, 0x4A, 0x48, 0x4A, 0x41, 0x40, 0x09, 0xCC, 0xB7, 0xA3, 0x5D, 0xD7, 0x5D, 0xA3,
+0xDE, 0xC1, 0x9E, 0xD7, 0x5D, 0xA3, 0x5D, 0x01, 0xC2, 0xA3, 0x95, 0x2C, 0x01, 0x5D, 0xCC, 0x57,
+0x3C, 0x69, 0xA8, 0x91, 0x69, 0x2C, 0x3C, 0x1D, 0x2C, 0x57, 0xA1, 0x07, 0x08, 0x4D, 0x78, 0xC0,
+0xBB, 0x00, 0xC1, 0xA0, 0x07, 0x03, 0x4D, 0x47, 0x03, 0x6E, 0xC1, 0x43, 0x19, 0x00, 0xC4, 0x5F,
+0x2A, 0x6C, 0x2A, 0x19, 0x00, 0xC2, 0x43, 0x9A, 0x17, 0x00, 0x77, 0x57, 0x00, 0x77, 0xC6, 0x49,
+0x85, 0x49, 0x30, 0x17, 0x37, 0x17, 0x00, 0x7F, 0x77, 0x57, 0x58, 0x02, 0xC4, 0x74, 0xCF, 0x92,
+0x28, 0x18, 0x03, 0xC1, 0x44, 0x14, 0x01, 0xC7, 0x5B, 0x76, 0x67, 0x9C, 0xC7, 0x9B, 0x67, 0x14,
+0x05, 0xC3, 0x67, 0x93, 0x22, 0x40, 0x01, 0x5E, 0x44, 0xCB, 0x54, 0x26, 0x58, 0x22, 0x93, 0x40,
+0x22, 0x93, 0x22, 0xE4, 0x7D, 0x13, 0x00, 0xC9, 0x80, 0x7D, 0x80, 0x4C, 0x88, 0x56, 0x76, 0x13,
+0x7D, 0x13, 0x00, 0xC4, 0x80, 0x13, 0x7D, 0x13, 0x09, 0x08, 0xC2, 0x7B, 0x78, 0x1A, 0x00, 0xC1,
+0xAD, 0x09, 0x07, 0xC2, 0x62, 0x10, 0x02, 0x04, 0x4A, 0x00, 0x48, 0x00, 0x42, 0x00, 0x41, 0x40,
+0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0x69, 0xC8, 0x50, 0x0A, 0x58, 0x08, 0x60, 0x29, 0x1B,
+0x7B, 0x09, 0x04, 0x50, 0x49, 0x73, 0xC5, 0x72, 0x1A, 0x20, 0x1B, 0x10, 0x09, 0x06, 0xCC, 0x41,
+0x13, 0x7D, 0x3D, 0x13, 0x80, 0x7A, 0x8B, 0x6F, 0x6A, 0x56, 0x4C, 0x13, 0x00, 0x7D, 0x53, 0x7D,
+0xC2, 0x80, 0x13, 0x93, 0x00, 0xC2, 0x40, 0x22, 0x40, 0x00, 0x68, 0xCA, 0x5A, 0x0A, 0x30, 0x90,
+0x40, 0x22, 0x93, 0x22, 0x93, 0xC5, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x00, 0xC7, 0x67, 0x34, 0x71,
+0x9B, 0x59, 0x5B, 0x67, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x01, 0xC1, 0xE5, 0x18, 0x01, 0xC5, 0x8C,
+0x8D, 0xCF, 0xAD, 0xAE, 0x18, 0x02, 0xC7, 0xAA, 0x17, 0x37, 0x17, 0x37, 0x17, 0x3F, 0x49, 0x00,
+0xC2, 0x85, 0x30, 0x17, 0x00, 0x77, 0x57, 0x01, 0xC2, 0xA4, 0xD1, 0x19, 0x00, 0xC8, 0x5F, 0x2A,
+0x6C, 0x2A, 0x19, 0x43, 0x19, 0xE2, 0x07, 0x08, 0x4D, 0x01, 0xC5, 0x6E, 0xD5, 0xBB, 0xC6, 0x0D,
+0x07, 0x07, 0x4D, 0x47, 0xCD, 0xA1, 0x2C, 0x1D, 0x57, 0x1D, 0x2C, 0x1D, 0x3C, 0x69, 0xA8, 0x54,
+0x69, 0x2C, 0x3C, 0x00, 0x6C, 0x01, 0xC1, 0x56, 0x5D, 0x01, 0xC0, 0xA3, 0x00, 0xC3, 0xD5, 0xC1,
+0xE0, 0xD7, 0x00, 0xC0, 0x5D, 0x02, 0xC5, 0xA3, 0xD7, 0x6B, 0x12, 0x0B, 0x00, 0x06, 0x4B, 0x41,
+0xC4, 0x53, 0x08, 0x49, 0x02, 0x00, 0x0A, 0x41, 0x40, 0x00, 0x48, 0x42, 0x43, 0x40, 0x00, 0x67,
+0x40, 0x41, 0x40, 0x02, 0x41, 0x44, 0x4E, 0x44, 0x40, 0x01, 0x4B, 0x41, 0x40, 0x45, 0x40, 0x00,
+0x42, 0x4E, 0x00, 0x42, 0x40, 0x02, 0x41, 0x40, 0x02, 0x71, 0x4A, 0x43, 0x4E, 0x42, 0x41, 0x40,
+0x03, 0x41, 0x40, 0x0A, 0x41, 0x44, 0x43, 0x00, 0x40, 0x0A, 0xCB, 0x4F, 0xA3, 0x5D, 0xA3, 0x5D,
+0xA3, 0xC1, 0xD5, 0x78, 0xC1, 0xA3, 0x5D, 0x02, 0xC4, 0xA3, 0x3C, 0x1D, 0x3C, 0x2C, 0x00, 0x5D,
+0x7C, 0xCA, 0x69, 0x9A, 0x91, 0x69, 0x1D, 0x2C, 0x3C, 0x1D, 0x2C, 0xA1, 0x07, 0x06, 0x4D, 0x47,
+0x00, 0xC4, 0x4D, 0x6E, 0x61, 0x46, 0x07, 0x09, 0x6E, 0xC7, 0x9F, 0x19, 0x43, 0x75, 0x2B, 0x5F,
+0x2B, 0x19, 0x00, 0xC2, 0x43, 0x95, 0x17, 0x02, 0x7F, 0x57, 0x70, 0xC1, 0x85, 0x37, 0x00, 0x57,
+0x01, 0x77, 0x57, 0x01, 0x58, 0x03, 0xC4, 0x96, 0xCF, 0x98, 0x8E, 0x18, 0x01, 0xC2, 0x8E, 0x9D,
+0x14, 0x03, 0xCA, 0x5B, 0x64, 0x3E, 0xC2, 0x71, 0x52, 0x67, 0x5B, 0x14, 0x5B, 0x14, 0x00, 0xC8,
+0x67, 0x93, 0x22, 0x40, 0x22, 0x40, 0x22, 0x02, 0x54, 0x00, 0xD2, 0x5A, 0x22, 0x40, 0x22, 0x40,
+0x0F, 0x40, 0xB8, 0x80, 0x3D, 0x80, 0x13, 0x7D, 0x13, 0xCC, 0x66, 0x56, 0x4C, 0x13, 0x00, 0xC6,
+0x7D, 0x80, 0x3D, 0x7D, 0x13, 0x41, 0x09, 0x07, 0xC6, 0x62, 0xA5, 0x20, 0x92, 0xE0, 0x33, 0x09,
+0x04, 0x55, 0x49, 0x01, 0x5B, 0x42, 0x02, 0x44, 0x48, 0xC3, 0x86, 0x0A, 0x03, 0x02, 0x01, 0x41,
+0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0x43, 0x48, 0x4A, 0xC7, 0x49, 0x04, 0xBD, 0x02,
+0x1B, 0x09, 0x97, 0x09, 0x04, 0x50, 0xC2, 0x82, 0x70, 0x66, 0x00, 0x50, 0x49, 0x06, 0xCB, 0x62,
+0x41, 0x13, 0x3D, 0x13, 0x3D, 0x80, 0x13, 0x94, 0x88, 0x6F, 0x4C, 0x00, 0x53, 0x00, 0x7D, 0x53,
+0x00, 0xC3, 0x7D, 0x65, 0x05, 0x40, 0x00, 0x62, 0xCD, 0x40, 0x22, 0x3F, 0x0A, 0x54, 0x5A, 0x17,
+0x0F, 0x93, 0x40, 0x22, 0x93, 0x89, 0x14, 0x03, 0xC1, 0x5B, 0x34, 0x00, 0x7B, 0x74, 0xC1, 0x52,
+0x14, 0x02, 0xC1, 0x67, 0x14, 0x00, 0xC1, 0x8E, 0x18, 0x02, 0xC4, 0x8E, 0x98, 0x0E, 0x8C, 0x18,
+0x02, 0xC5, 0xEA, 0x17, 0x37, 0x17, 0x3F, 0x17, 0x00, 0x66, 0xC2, 0x85, 0x60, 0x37, 0x00, 0x57,
+0x7F, 0x57, 0x77, 0x68, 0xC2, 0xA4, 0xD1, 0x19, 0x00, 0xC8, 0x75, 0x2B, 0x5F, 0x2B, 0x43, 0x19,
+0x43, 0xE2, 0x07, 0x09, 0x4D, 0xC7, 0x46, 0x4D, 0x39, 0x6E, 0x79, 0x07, 0xBA, 0x07, 0x06, 0xD2,
+0xBA, 0x07, 0xA1, 0x57, 0x3C, 0x1D, 0x2C, 0x1D, 0x57, 0x1D, 0x9A, 0x69, 0x91, 0x69, 0x2C, 0x3C,
+0x2C, 0x1D, 0x2C, 0x00, 0xC1, 0x56, 0x5D, 0x03, 0xC1, 0xC1, 0xD5, 0x01, 0xC1, 0xCD, 0x5D, 0x04,
+0xC3, 0x6B, 0x12, 0x0B, 0x00, 0x05, 0x67, 0x4B, 0x40, 0x44, 0x42, 0x70, 0x5F, 0x40, 0x0A, 0x41,
+0x40, 0x00, 0x4A, 0x43, 0x4E, 0x42, 0x41, 0x40, 0x00, 0x41, 0x40, 0x01, 0x45, 0x4A, 0x4E, 0x43,
+0x40, 0x02, 0x4B, 0x41, 0x40, 0x45, 0x40, 0x00, 0x42, 0x48, 0x4E, 0x42, 0x40, 0x02, 0x41, 0x40,
+0x02, 0xC1, 0x47, 0x02, 0x02, 0x67, 0x40, 0x03, 0x41, 0x40, 0x0A, 0x44, 0x43, 0x00, 0x48, 0x41,
+0x40, 0x09, 0xC4, 0xB7, 0xA3, 0x5D, 0xD7, 0x5D, 0x00, 0xC0, 0xC1, 0x00, 0xC3, 0x66, 0xD5, 0xD7,
+0x5D, 0x02, 0xC3, 0xA3, 0xA4, 0x57, 0x2C, 0x00, 0x5D, 0xCC, 0x57, 0x1D, 0x69, 0x7E, 0x91, 0x3C,
+0x2C, 0x3C, 0x1D, 0x2C, 0x57, 0xA1, 0x07, 0x08, 0xC6, 0x45, 0x4D, 0x55, 0xED, 0x46, 0x0D, 0x07,
+0x08, 0x6E, 0xC1, 0x43, 0x19, 0x00, 0xC0, 0x6C, 0x00, 0xC2, 0x5F, 0x6C, 0x19, 0x00, 0xC2, 0x43,
+0x9A, 0x17, 0x00, 0x77, 0x57, 0x00, 0x70, 0xC1, 0x54, 0x49, 0x00, 0xC8, 0x54, 0x17, 0x37, 0x3F,
+0x17, 0x3F, 0x37, 0x17, 0x18, 0x01, 0xC0, 0x8E, 0x00, 0xC4, 0x8C, 0x1F, 0x98, 0x8C, 0x18, 0x02,
+0xC1, 0x9D, 0x14, 0x01, 0xC7, 0x67, 0x14, 0x5B, 0x52, 0x34, 0x3E, 0x34, 0x14, 0x01, 0xC1, 0x5B,
+0x14, 0x01, 0xC3, 0x67, 0x93, 0x22, 0x40, 0x01, 0x62, 0x45, 0x7F, 0xC6, 0x58, 0x17, 0x40, 0x0F,
+0x22, 0x40, 0x22, 0x00, 0xC2, 0xD4, 0x7D, 0x13, 0x00, 0xC2, 0x80, 0x7D, 0x13, 0x00, 0xC5, 0x56,
+0x6A, 0x9E, 0x4C, 0x3D, 0x13, 0x00, 0xC4, 0x80, 0x13, 0x7D, 0x13, 0x09, 0x07, 0xC4, 0x41, 0x20,
+0x66, 0x33, 0x1B, 0x00, 0x50, 0x49, 0x06, 0xC2, 0x62, 0x10, 0x02, 0x03, 0x43, 0x4E, 0x4A, 0x44,
+0x42, 0x01, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42, 0x02, 0x5C, 0x4A, 0xC7, 0x92, 0x59,
+0x02, 0x28, 0x02, 0x1B, 0x7B, 0x09, 0x06, 0xC5, 0x78, 0x72, 0x10, 0x1B, 0x15, 0x09, 0x07, 0xCC,
+0x41, 0x13, 0xCC, 0x3D, 0x13, 0x80, 0x7D, 0x8B, 0x4C, 0x6A, 0x9E, 0x6A, 0x3D, 0x00, 0x53, 0x7D,
+0x53, 0xC5, 0x80, 0x3D, 0x93, 0x40, 0x22, 0x40, 0x01, 0x62, 0x42, 0xC9, 0x58, 0x3F, 0x40, 0x22,
+0x93, 0x22, 0x40, 0x0F, 0x89, 0x14, 0x00, 0xC1, 0x67, 0x14, 0x00, 0xC6, 0x5B, 0x52, 0x34, 0x71,
+0x9B, 0x52, 0x14, 0x00, 0xC1, 0x67, 0x14, 0x02, 0xC1, 0x8E, 0x18, 0x01, 0xC5, 0x8E, 0x8C, 0xDA,
+0x98, 0x8C, 0x18, 0x02, 0xDA, 0xAA, 0x17, 0xA4, 0x17, 0x37, 0x17, 0x60, 0x54, 0x30, 0x49, 0x54,
+0x37, 0x28, 0x37, 0x17, 0x37, 0x17, 0xA4, 0x43, 0x9F, 0x43, 0x75, 0x5F, 0xBC, 0x5F, 0x43, 0x19,
+0x00, 0xC1, 0xE2, 0x07, 0x08, 0x4D, 0x78, 0xC0, 0x7F, 0x00, 0xC0, 0x55, 0x00, 0xC1, 0xC6, 0x07,
+0x07, 0x6E, 0x4D, 0x47, 0xCF, 0xA1, 0x2C, 0x1D, 0x2C, 0x57, 0x1D, 0x2C, 0x3C, 0x69, 0x7E, 0xC9,
+0x3C, 0x1D, 0x2C, 0x3C, 0x2C, 0x01, 0xC1, 0x56, 0x5D, 0x01, 0xC0, 0xA3, 0x00, 0xC6, 0xD7, 0xC1,
+0x72, 0xD5, 0xC1, 0xA3, 0x5D, 0x01, 0xC5, 0xD7, 0x5D, 0x4F, 0x12, 0x0B, 0x00, 0x07, 0x5C, 0x43,
+0x00, 0xC2, 0x49, 0x05, 0x00, 0x0A, 0x41, 0x40, 0x00, 0x45, 0x42, 0x01, 0x41, 0x40, 0x00, 0x41,
+0x40, 0x01, 0x41, 0x48, 0x4E, 0x48, 0x40, 0x02, 0x4B, 0x41, 0x40, 0x45, 0x40, 0x01, 0xC4, 0x47,
+0x02, 0x0A, 0x02, 0x00, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0A, 0x41, 0x42, 0x4E, 0x43, 0x40,
+0x09, 0x52, 0xC2, 0xB7, 0xA3, 0x5D, 0x00, 0xC9, 0xA3, 0xD7, 0xD5, 0xCD, 0xC1, 0xD5, 0xD7, 0x5D,
+0xA3, 0x5D, 0x00, 0xC2, 0xCD, 0xA4, 0x1D, 0x00, 0x7C, 0x00, 0xC7, 0xB3, 0xA8, 0xA7, 0xC9, 0xA8,
+0x1D, 0x2C, 0x3C, 0x00, 0x6C, 0x00, 0xC1, 0x67, 0x07, 0x00, 0xC1, 0x79, 0x07, 0x00, 0x4D, 0x47,
+0x01, 0x4D, 0xCB, 0x45, 0x6E, 0x46, 0x45, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x01,
+0x4D, 0x47, 0x6E, 0xC0, 0x9F, 0x00, 0xC6, 0x43, 0x2B, 0x6C, 0xBC, 0x2B, 0x43, 0x19, 0x00, 0xC1,
+0x9A, 0x17, 0x01, 0x77, 0x57, 0xC5, 0x60, 0x85, 0x17, 0x54, 0x8D, 0x17, 0x00, 0x77, 0x57, 0x01,
+0x68, 0x58, 0x02, 0xC5, 0x98, 0x8C, 0x18, 0x74, 0xAD, 0x18, 0x02, 0xC1, 0x44, 0x14, 0x02, 0xC8,
+0x67, 0x14, 0xC7, 0x71, 0x9B, 0x3B, 0x52, 0x67, 0x14, 0x03, 0xC1, 0x67, 0x93, 0x00, 0xCA, 0x40,
+0x22, 0x40, 0x90, 0x58, 0x36, 0x5A, 0x58, 0x22, 0x40, 0x93, 0x00, 0xC3, 0x40, 0x22, 0x7C, 0x80,
+0x00, 0x7D, 0x53, 0x00, 0xD4, 0x94, 0x56, 0x88, 0x9E, 0x50, 0x7A, 0x13, 0x80, 0xBE, 0x3D, 0x65,
+0x94, 0x41, 0x10, 0x15, 0x09, 0x10, 0x09, 0x97, 0x10, 0x09, 0x01, 0xC1, 0x99, 0x72, 0x00, 0x50,
+0x00, 0x49, 0x50, 0x49, 0xC2, 0x97, 0x10, 0x09, 0x00, 0xC5, 0x97, 0x09, 0x10, 0x1B, 0x1C, 0x02,
+0x01, 0x44, 0x4E, 0x42, 0x43, 0x4E, 0x42, 0x01, 0x67, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x45, 0x42,
+0x01, 0x69, 0x4A, 0x48, 0x42, 0x4E, 0x43, 0xC4, 0xBD, 0x3F, 0x1B, 0x09, 0x97, 0x01, 0x49, 0x01,
+0x50, 0xC1, 0x41, 0x1A, 0x01, 0xC2, 0x41, 0x10, 0x09, 0x01, 0xC2, 0x97, 0x10, 0x09, 0x00, 0x50,
+0x55, 0xC1, 0x41, 0x3D, 0x00, 0xC2, 0xCC, 0x3D, 0x13, 0x00, 0xC6, 0x4C, 0x6A, 0x9E, 0xA9, 0x65,
+0x80, 0x13, 0x00, 0xC5, 0x80, 0x7A, 0x7D, 0x65, 0x05, 0x40, 0x01, 0xC6, 0x93, 0x22, 0x49, 0x36,
+0x5A, 0x49, 0x93, 0x00, 0xC0, 0x40, 0x01, 0xC2, 0x93, 0xC5, 0x14, 0x02, 0xC3, 0x67, 0x14, 0x52,
+0x34, 0x00, 0xC3, 0x9B, 0x34, 0x67, 0x14, 0x04, 0xC1, 0x8E, 0x18, 0x00, 0xC6, 0xAE, 0xAD, 0x74,
+0x18, 0xAD, 0x98, 0x18, 0x02, 0xC1, 0xEA, 0x17, 0x03, 0x77, 0xC5, 0x54, 0x17, 0x85, 0x23, 0x37,
+0x17, 0x03, 0xCC, 0xA4, 0x43, 0x19, 0x43, 0x2A, 0x6C, 0x11, 0x2A, 0x19, 0x9F, 0x5F, 0xE2, 0x07,
+0x02, 0x4D, 0x47, 0x04, 0xC4, 0xCB, 0x39, 0x45, 0x4D, 0x0D, 0x00, 0x47, 0x03, 0x4D, 0x47, 0x00,
+0x6E, 0x4D, 0x47, 0xC2, 0x79, 0xF1, 0x3C, 0x01, 0x5D, 0x7C, 0xCA, 0xB3, 0x69, 0x7E, 0xC9, 0xA8,
+0x1D, 0x2C, 0x3C, 0x1D, 0x3C, 0x2C, 0x00, 0xC1, 0x76, 0x5D, 0x00, 0xC4, 0xD7, 0x5D, 0xA3, 0xD5,
+0xC1, 0x01, 0xC1, 0xD5, 0xA3, 0x00, 0xC7, 0xD7, 0xA3, 0xD7, 0xA3, 0x4F, 0x00, 0x0B, 0x00, 0x07,
+0x41, 0x65, 0x4A, 0x4E, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x03, 0x45, 0x48, 0x44,
+0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0A, 0x44, 0x4E, 0x45,
+0x40, 0x41, 0x40, 0x08, 0x52, 0xC2, 0xD8, 0xA3, 0x5D, 0x01, 0xC7, 0xFE, 0xD5, 0xC1, 0xA3, 0xD5,
+0xD7, 0xA3, 0x5D, 0x01, 0xC2, 0xA3, 0xA4, 0x2C, 0x02, 0x5D, 0xC4, 0x91, 0x4A, 0x91, 0x3C, 0x2C,
+0x00, 0x7C, 0x6C, 0x01, 0xC3, 0xA1, 0x07, 0xBA, 0x07, 0x05, 0xC6, 0xCB, 0x45, 0x61, 0xB9, 0x4D,
+0x0D, 0x07, 0x09, 0xC9, 0x4B, 0x9F, 0x19, 0x43, 0x5F, 0x2B, 0xE6, 0x5F, 0x9F, 0x19, 0x00, 0xC1,
+0xC8, 0x17, 0x00, 0x77, 0x57, 0x01, 0xC1, 0x60, 0x17, 0x00, 0x77, 0x57, 0x02, 0xC3, 0xA4, 0x17,
+0x8C, 0x18, 0x01, 0xC6, 0x8E, 0x98, 0xAD, 0x18, 0x74, 0xAD, 0x18, 0x02, 0xC2, 0x67, 0xAC, 0x14,
+0x02, 0xC4, 0x5B, 0x9C, 0x34, 0x9B, 0x34, 0x00, 0xD9, 0x5B, 0x14, 0x5B, 0x14, 0x5B, 0x14, 0x67,
+0x90, 0x40, 0x22, 0x93, 0x40, 0x3F, 0x5A, 0x85, 0x3F, 0x5A, 0xE1, 0x93, 0x22, 0x93, 0x40, 0x22,
+0xE4, 0x80, 0x13, 0x00, 0xC3, 0x7D, 0x13, 0x8B, 0x88, 0x01, 0xC2, 0x9D, 0x3D, 0x7D, 0x00, 0x53,
+0x7D, 0x53, 0xC0, 0xBE, 0x00, 0xC3, 0x97, 0x09, 0x62, 0x09, 0x04, 0x55, 0xC5, 0x72, 0x6A, 0xCF,
+0x6A, 0x15, 0x09, 0x04, 0xC0, 0x97, 0x00, 0x49, 0x00, 0x5B, 0x56, 0x42, 0x01, 0x43, 0x4A, 0x42,
+0x00, 0x4E, 0x42, 0x01, 0x41, 0x40, 0x00, 0x4B, 0x00, 0x41, 0x4B, 0x41, 0x52, 0x67, 0x6D, 0x67,
+0x6D, 0x67, 0x6D, 0x67, 0x6D, 0x67, 0x52, 0xC8, 0x47, 0x0B, 0x47, 0x01, 0x25, 0x00, 0x47, 0x0B,
+0x00, 0x00, 0x4B, 0x40, 0x4B, 0x40, 0x02, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x4B,
+0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x41, 0x65, 0x41, 0x4B, 0x6D, 0xCB, 0x47, 0x2D, 0x47, 0x2D,
+0x47, 0x2D, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x07, 0x45, 0x42, 0x02, 0x4E, 0x44, 0x42, 0x48,
+0x4A, 0x45, 0x42, 0x5B, 0x50, 0xC3, 0x97, 0x09, 0x10, 0x09, 0x02, 0xC4, 0xA5, 0x78, 0x20, 0x66,
+0x10, 0x00, 0x49, 0x07, 0xC3, 0x41, 0x13, 0x7D, 0x13, 0x00, 0xC7, 0x7D, 0x8B, 0x56, 0xC2, 0x64,
+0x76, 0x94, 0x13, 0x00, 0xC6, 0x80, 0x13, 0x80, 0x7D, 0x65, 0x0F, 0x40, 0x00, 0x62, 0x4F, 0xC6,
+0x90, 0x5A, 0x30, 0x36, 0x49, 0x3F, 0x40, 0x01, 0x62, 0xC2, 0x93, 0x89, 0x14, 0x00, 0xC1, 0x5B,
+0x14, 0x00, 0xC1, 0x67, 0x34, 0x00, 0xC4, 0x9B, 0x52, 0x9B, 0x67, 0x14, 0x00, 0xC5, 0x5B, 0x14,
+0x67, 0x14, 0x8E, 0x18, 0x01, 0xC5, 0xAD, 0x98, 0x18, 0x8C, 0x98, 0x18, 0x02, 0xC4, 0xEA, 0x37,
+0x17, 0xA4, 0x17, 0x01, 0xC4, 0x60, 0x37, 0x17, 0x60, 0x17, 0x01, 0x77, 0x57, 0x00, 0xC8, 0xA4,
+0xD1, 0x19, 0x43, 0x6C, 0xE6, 0x2B, 0xBC, 0x19, 0x01, 0x64, 0x47, 0x08, 0xC7, 0x4B, 0x0D, 0x87,
+0x7F, 0xB9, 0x81, 0xBA, 0x07, 0x07, 0xC5, 0xCB, 0x07, 0x79, 0xF1, 0x57, 0x2C, 0x02, 0x7C, 0xC4,
+0x7E, 0x2F, 0x91, 0x3C, 0x2C, 0x00, 0x7C, 0x6C, 0x7C, 0x6C, 0x00, 0xC1, 0x56, 0x5D, 0x02, 0xC1,
+0xA3, 0xC1, 0x00, 0xC4, 0xA3, 0xD5, 0xC1, 0xF9, 0x5D, 0x02, 0xC4, 0xA3, 0xB7, 0x00, 0xC0, 0x00,
+0x07, 0x45, 0x4A, 0x43, 0x40, 0x0C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x07, 0x41, 0x40, 0x00, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0A, 0x4A, 0x48, 0x43, 0x00, 0x40, 0x0A,
+0xC2, 0x4F, 0xA3, 0x5D, 0x02, 0xC1, 0xD7, 0xD5, 0x00, 0xC2, 0xD7, 0xA3, 0x5D, 0x02, 0xC2, 0xCD,
+0xA4, 0x2C, 0x02, 0x5D, 0x00, 0xC1, 0x69, 0x91, 0x00, 0x7C, 0x6C, 0x7C, 0x00, 0x6C, 0x00, 0xC1,
+0x67, 0x07, 0x07, 0xC2, 0x79, 0x38, 0xB9, 0x00, 0xC2, 0x87, 0x39, 0x07, 0x09, 0x6E, 0xC4, 0x9F,
+0x19, 0x5F, 0x75, 0x5F, 0x00, 0x6A, 0xC7, 0x43, 0x19, 0x5F, 0x95, 0x17, 0x3F, 0x17, 0x3F, 0x00,
+0x77, 0xC6, 0x54, 0x49, 0x54, 0x30, 0x17, 0x37, 0x17, 0x00, 0x77, 0x57, 0x68, 0xC1, 0xEA, 0x18,
+0x01, 0xC6, 0x8E, 0x74, 0x98, 0xAD, 0x18, 0xAE, 0x18, 0x01, 0xC2, 0x89, 0x76, 0x5B, 0x02, 0x54,
+0xC5, 0x52, 0x64, 0x52, 0x34, 0x14, 0x5B, 0x00, 0x54, 0xCC, 0x50, 0x5B, 0x14, 0x67, 0x93, 0x0F,
+0x93, 0x0F, 0x93, 0x22, 0x26, 0x58, 0x36, 0x00, 0x4F, 0x00, 0xC2, 0x40, 0x22, 0x40, 0x00, 0xCD,
+0x7C, 0x3D, 0xBE, 0x3D, 0x7D, 0x80, 0x3D, 0xBE, 0x56, 0x88, 0xA9, 0x13, 0x3D, 0x80, 0x00, 0xC3,
+0x8B, 0x80, 0x8B, 0x41, 0x00, 0xCA, 0x97, 0x09, 0x15, 0x09, 0x15, 0x09, 0x15, 0x09, 0x15, 0x20,
+0x66, 0x00, 0xC6, 0xCF, 0x20, 0x09, 0x15, 0x09, 0x15, 0x09, 0x02, 0x55, 0x01, 0x69, 0x42, 0x02,
+0x4E, 0x4A, 0x01, 0x42, 0x01, 0x40, 0x02, 0x6D, 0x4B, 0x41, 0x40, 0xC2, 0x47, 0x00, 0x47, 0x00,
+0x41, 0xC0, 0x47, 0x00, 0x41, 0xC0, 0x47, 0x00, 0x4B, 0x71, 0x41, 0x4B, 0x41, 0x45, 0x42, 0x5C,
+0x42, 0x45, 0x69, 0x61, 0x69, 0x45, 0xCF, 0x4F, 0x05, 0x4F, 0x05, 0x1F, 0x05, 0x1F, 0x05, 0x4F,
+0x05, 0x1F, 0x05, 0x1F, 0x05, 0x4F, 0x05, 0x00, 0x61, 0x4F, 0x41, 0x65, 0x41, 0x6D, 0xCC, 0x47,
+0x2D, 0x47, 0x2D, 0x0B, 0x01, 0x0B, 0x01, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x40, 0x05, 0x45,
+0x42, 0x02, 0x48, 0x4A, 0x00, 0x4E, 0xC4, 0x63, 0x28, 0x02, 0x1B, 0x09, 0x01, 0x55, 0x49, 0x00,
+0x55, 0x50, 0x5B, 0xC5, 0x72, 0xCF, 0x78, 0x1A, 0x09, 0x15, 0x01, 0x49, 0x55, 0x49, 0x00, 0x55,
+0xC3, 0x97, 0x41, 0x80, 0x7D, 0x00, 0xC0, 0x80, 0x00, 0x53, 0xC7, 0x8B, 0x13, 0x6F, 0x64, 0x4C,
+0x8B, 0x13, 0x3D, 0x02, 0xD4, 0x65, 0x0F, 0x22, 0x40, 0x0F, 0x22, 0x1E, 0x36, 0x30, 0x36, 0x60,
+0x1E, 0x0F, 0x22, 0x1E, 0x40, 0x0F, 0x89, 0x5B, 0x14, 0x5B, 0x00, 0x54, 0xC9, 0x5B, 0x52, 0x9C,
+0x71, 0x34, 0x52, 0x14, 0x5B, 0x14, 0x5B, 0x00, 0x54, 0xCF, 0x5B, 0x1F, 0x18, 0xDA, 0xA2, 0x18,
+0xAD, 0x98, 0x74, 0x8E, 0x18, 0xAE, 0x18, 0x1F, 0xEA, 0x17, 0x00, 0x77, 0x57, 0x68, 0x77, 0xC6,
+0x49, 0x54, 0x49, 0x30, 0x17, 0x37, 0x17, 0x02, 0xC2, 0xA4, 0x43, 0x19, 0x00, 0x6B, 0xC8, 0x5F,
+0xBC, 0x2A, 0x43, 0x19, 0x5F, 0xE2, 0x0D, 0x07, 0x08, 0x4D, 0xC6, 0x6E, 0x87, 0xBB, 0x39, 0x38,
+0x0D, 0x07, 0x06, 0x4D, 0x47, 0x6E, 0xC2, 0xA1, 0x3C, 0x2C, 0x03, 0x5D, 0xCC, 0x69, 0x54, 0x91,
+0x57, 0x2C, 0x3C, 0x1D, 0x3C, 0x2C, 0x1D, 0x56, 0xD7, 0x5D, 0x02, 0xC6, 0xD7, 0xC1, 0xD5, 0xC1,
+0x5D, 0xA3, 0x5D, 0x02, 0xC4, 0xA3, 0xB7, 0x00, 0x0B, 0x00, 0x07, 0x44, 0x4E, 0x43, 0x48, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x45, 0x41, 0x45, 0x00, 0x41,
+0x45, 0x00, 0x41, 0x45, 0x02, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x45,
+0x00, 0x41, 0x45, 0x02, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x01, 0x45,
+0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x45, 0x5F, 0x4F, 0xC2, 0x8A, 0x56,
+0xCD, 0x00, 0xCD, 0x56, 0xCD, 0xF9, 0xA3, 0x82, 0xA3, 0xCD, 0xA3, 0xCD, 0xA5, 0xCD, 0x56, 0x26,
+0x3C, 0x02, 0xC5, 0xA4, 0x9A, 0x37, 0xA4, 0x9A, 0x3C, 0x01, 0x77, 0x7C, 0x00, 0xC2, 0x44, 0xDC,
+0xB1, 0x00, 0xC8, 0x55, 0xDC, 0xB1, 0x55, 0xDC, 0xB1, 0x55, 0xB1, 0xDC, 0x00, 0xC1, 0xB1, 0xDC,
+0x00, 0xCF, 0xB1, 0x55, 0xDC, 0xB1, 0x55, 0xDC, 0xB1, 0x55, 0xDC, 0xB1, 0xED, 0xD1, 0xE3, 0xD1,
+0x8F, 0xD1, 0x00, 0xD7, 0xE3, 0x8F, 0xD1, 0x84, 0x9A, 0x3F, 0x04, 0x37, 0x04, 0x37, 0x04, 0x3F,
+0x37, 0x3F, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x8C, 0x28, 0xAA, 0x00, 0xC2, 0x8C, 0xAA,
+0x8E, 0x01, 0x68, 0xC2, 0xAA, 0x8C, 0xAA, 0x00, 0xC3, 0x44, 0x50, 0x14, 0x50, 0x00, 0xC1, 0x59,
+0x50, 0x00, 0xC0, 0x63, 0x01, 0xC0, 0x50, 0x01, 0x54, 0xC0, 0x50, 0x00, 0xC8, 0x52, 0x44, 0x89,
+0x90, 0x28, 0x3F, 0x90, 0x02, 0x90, 0x01, 0x68, 0xCE, 0xBD, 0x3F, 0x02, 0x28, 0x90, 0x28, 0x9D,
+0x4C, 0x9D, 0x4C, 0x65, 0x4C, 0x65, 0x4C, 0xB8, 0x00, 0xC5, 0x51, 0x4C, 0x65, 0x4C, 0x65, 0x4C,
+0x00, 0x56, 0xC2, 0x4C, 0xA5, 0x10, 0x00, 0xC2, 0xAD, 0xA5, 0x10, 0x00, 0xC2, 0xAD, 0xA5, 0x10,
+0x00, 0xC2, 0xAD, 0x1B, 0x10, 0x02, 0xC7, 0xAD, 0xA5, 0x10, 0xAD, 0xA5, 0xAD, 0xA5, 0xAD, 0x00,
+0x56, 0x44, 0x02, 0x42, 0x00, 0x44, 0x42, 0x44, 0x5C, 0x44, 0x45, 0x00, 0x4F, 0x61, 0x45, 0x02,
+0xC8, 0x4F, 0x05, 0x29, 0x05, 0x21, 0xAA, 0x05, 0x4F, 0x05, 0x00, 0x69, 0x45, 0x61, 0x45, 0x61,
+0x45, 0xCA, 0x70, 0x0A, 0x03, 0x51, 0x44, 0x03, 0x51, 0x03, 0x44, 0x03, 0x44, 0x04, 0x44, 0xC0,
+0x44, 0x00, 0x44, 0xC3, 0x44, 0x04, 0x1C, 0x02, 0x00, 0x5C, 0x42, 0x00, 0x69, 0x45, 0x0B, 0x61,
+0x45, 0x04, 0x41, 0x45, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44,
+0x42, 0xCA, 0xAD, 0xA5, 0x10, 0xAD, 0xA5, 0x10, 0xAD, 0xA5, 0x10, 0x51, 0x10, 0x01, 0xC1, 0xAD,
+0x10, 0x04, 0xC2, 0xAD, 0xA5, 0x10, 0x00, 0xC2, 0x51, 0x4C, 0x65, 0x01, 0xC0, 0x4C, 0x00, 0xC3,
+0x65, 0x4C, 0xB8, 0x4C, 0x01, 0xCC, 0x9D, 0x65, 0x4C, 0x9D, 0x4C, 0x9D, 0x02, 0x28, 0x3F, 0xBD,
+0x28, 0xBD, 0x28, 0x01, 0xC8, 0x90, 0x02, 0x90, 0x28, 0x17, 0x90, 0x02, 0x89, 0x50, 0x04, 0xC5,
+0x67, 0x50, 0x63, 0x14, 0x44, 0x50, 0x03, 0xC3, 0x76, 0x59, 0x29, 0xAA, 0x04, 0xC1, 0x8E, 0xAA,
+0x01, 0x68, 0xC1, 0xAA, 0x04, 0x00, 0x77, 0x44, 0x00, 0x77, 0x44, 0x7F, 0x44, 0x7F, 0x77, 0x44,
+0x77, 0x7F, 0x76, 0x00, 0x77, 0x76, 0xC1, 0xE3, 0xD1, 0x01, 0xC3, 0xE3, 0x8F, 0x84, 0xD1, 0x00,
+0xCE, 0x8F, 0xAC, 0xDC, 0xB1, 0x55, 0xDC, 0xB1, 0x55, 0xDC, 0xB1, 0x55, 0xDC, 0xB1, 0x55, 0xDC,
+0x00, 0xC0, 0xB1, 0x00, 0xC3, 0x45, 0xB1, 0x45, 0xB1, 0x00, 0xC4, 0x55, 0xDC, 0xB1, 0x55, 0xDC,
+0x00, 0xC4, 0x45, 0xB1, 0x67, 0xA4, 0x3C, 0x02, 0xC7, 0xA4, 0x3C, 0xA4, 0x3C, 0x9A, 0x3C, 0xA4,
+0x3C, 0x00, 0x77, 0x7C, 0xC4, 0x9A, 0x51, 0x56, 0xCD, 0xA3, 0x00, 0xC4, 0xCD, 0xA3, 0xCD, 0xA3,
+0xCD, 0x00, 0xD2, 0xA3, 0xCD, 0xA3, 0xCD, 0xA3, 0x6A, 0xB8, 0x25, 0x05, 0x93, 0x1F, 0x0F, 0x05,
+0x1F, 0x0F, 0x05, 0x1F, 0x05, 0x01, 0x02, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41,
+0x45, 0x00, 0x41, 0x45, 0x02, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x42, 0x45, 0x41, 0x45,
+0x00, 0x41, 0x45, 0x02, 0x41, 0x45, 0x02, 0x42, 0x41, 0x07, 0x45, 0x00, 0x41, 0x0D, 0x45, 0x41,
+0x18, 0x65, 0x4F, 0xCA, 0x4F, 0xB7, 0xAF, 0x25, 0x6B, 0xAF, 0x1F, 0x25, 0xDA, 0x01, 0xAF, 0x01,
+0x65, 0xC7, 0x4F, 0x25, 0x22, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x00, 0xCF, 0x40, 0x0F, 0x1E, 0x0F,
+0x1F, 0x1E, 0x0F, 0xA2, 0x0F, 0x21, 0xB7, 0x25, 0x0F, 0x25, 0x3A, 0x25, 0x00, 0x7A, 0x65, 0x00,
+0x4F, 0x5F, 0x7A, 0x65, 0x00, 0x7A, 0x65, 0x00, 0x7A, 0x65, 0x00, 0x7A, 0x65, 0x00, 0x7A, 0x65,
+0xCD, 0xB7, 0x3A, 0x25, 0x01, 0xD3, 0x01, 0x25, 0x93, 0x2D, 0x0F, 0x2D, 0x05, 0xAE, 0x01, 0x01,
+0x67, 0x41, 0x03, 0x67, 0x41, 0x03, 0x5F, 0x01, 0x41, 0x00, 0x5F, 0x41, 0x5F, 0x41, 0x5F, 0x00,
+0x41, 0x5F, 0x41, 0x61, 0x7A, 0x41, 0x4F, 0x65, 0x00, 0x4F, 0xC2, 0xD3, 0x3A, 0x25, 0x01, 0xC1,
+0xF8, 0x25, 0x00, 0x7A, 0xC6, 0xD3, 0x25, 0x3A, 0x05, 0x01, 0x0F, 0x01, 0x00, 0x4F, 0x5F, 0x4F,
+0x5F, 0x41, 0x4F, 0x41, 0x4F, 0x41, 0x4F, 0x67, 0x63, 0xC2, 0xCA, 0x73, 0xCA, 0x07, 0xC1, 0x73,
+0xCA, 0x00, 0xC1, 0x68, 0xCA, 0x00, 0xC1, 0xEB, 0x73, 0x01, 0xC3, 0xCA, 0x68, 0x73, 0xCA, 0x01,
+0xC3, 0xEB, 0x68, 0xCA, 0x73, 0x00, 0xC5, 0xCA, 0x73, 0xCA, 0xB5, 0x73, 0xCA, 0x00, 0xC2, 0xB5,
+0x73, 0xCA, 0x00, 0xC3, 0xB5, 0x73, 0xCA, 0x73, 0x00, 0xC1, 0xCA, 0x73, 0x05, 0x5C, 0x41, 0x00,
+0x65, 0x00, 0x45, 0x65, 0x45, 0xCC, 0x4F, 0x3A, 0x4F, 0x25, 0x1F, 0x25, 0x4F, 0x3A, 0x4F, 0x05,
+0x4F, 0x3A, 0x1F, 0x00, 0x65, 0xC9, 0x4F, 0x08, 0x0A, 0x04, 0x1C, 0x1F, 0x01, 0x02, 0x51, 0x04,
+0x09, 0x5C, 0x42, 0x44, 0x43, 0x61, 0xC3, 0x4F, 0x04, 0x44, 0x21, 0x00, 0x45, 0x65, 0x45, 0x7A,
+0x45, 0x7A, 0xCC, 0x4F, 0x0F, 0x4F, 0x0F, 0x3A, 0x4F, 0x0F, 0x05, 0x25, 0x05, 0x01, 0x05, 0x01,
+0x02, 0x4B, 0x4E, 0xC0, 0x73, 0x05, 0xC1, 0xEB, 0x73, 0x01, 0xC0, 0xCA, 0x00, 0xCF, 0x73, 0xCA,
+0xEB, 0x73, 0xCA, 0x68, 0x73, 0xCA, 0x73, 0x68, 0x73, 0xCA, 0x68, 0x73, 0xCA, 0x73, 0x00, 0xC0,
+0xCA, 0x00, 0xC2, 0x68, 0x73, 0xCA, 0x01, 0xC0, 0x73, 0x01, 0xC1, 0xEB, 0xCA, 0x00, 0xC1, 0xEB,
+0xCA, 0x00, 0xC1, 0x73, 0xCA, 0x00, 0xC1, 0x73, 0xCA, 0x02, 0xC1, 0xEB, 0x73, 0x0D, 0x72, 0x6D,
+0x65, 0x4F, 0xC4, 0xD3, 0x0F, 0x25, 0x3A, 0x25, 0x01, 0x7A, 0xC3, 0xD3, 0x0F, 0x25, 0x0F, 0x00,
+0x41, 0x65, 0x45, 0x41, 0x5F, 0x00, 0x41, 0x5F, 0x41, 0x5F, 0x41, 0x5F, 0x41, 0x5F, 0x41, 0x62,
+0x41, 0x00, 0x67, 0x41, 0x00, 0x67, 0x41, 0x67, 0x41, 0x06, 0x4F, 0x5F, 0x41, 0x65, 0x00, 0x4F,
+0x6D, 0xC6, 0xD9, 0x25, 0x0F, 0xE8, 0x05, 0xB7, 0x25, 0x00, 0x7A, 0x65, 0x00, 0x7A, 0x65, 0x00,
+0x7A, 0x65, 0x00, 0x4F, 0x65, 0x01, 0x4F, 0x65, 0x00, 0x45, 0x65, 0x00, 0x7A, 0x65, 0x4F, 0xC2,
+0xB7, 0x3A, 0x25, 0x00, 0xC2, 0xAA, 0xA2, 0x0F, 0x00, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x5E, 0x4F,
+0x00, 0x62, 0xCC, 0xA2, 0x0F, 0x05, 0x1E, 0x0F, 0x3A, 0xAF, 0x47, 0x01, 0x47, 0x01, 0x47, 0x01,
+0x00, 0xD0, 0x47, 0x01, 0x47, 0x01, 0x47, 0x01, 0x4F, 0x6B, 0x1F, 0x01, 0x25, 0x0F, 0x01, 0x25,
+0x01, 0x25, 0x01, 0x00, 0x65, 0x41, 0x10, 0x45, 0x41, 0x07, 0x45, 0x41, 0x0A, 0x45, 0x41, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x67, 0x40, 0x01, 0x52, 0x40, 0x00, 0x52,
+0x40, 0x01, 0x52, 0x00, 0x40, 0x00, 0x41, 0x40, 0x09, 0x4B, 0x00, 0x40, 0x00, 0x41, 0x71, 0x40,
+0x06, 0x4B, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0x41, 0x40, 0x0E, 0x4B, 0x41, 0x40, 0x02, 0x52,
+0x40, 0x52, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x41, 0x4B, 0x40, 0x0A, 0x4B, 0x40, 0x01, 0xC2, 0x47,
+0x27, 0x00, 0x0B, 0x4B, 0x40, 0x63, 0x46, 0x36, 0x42, 0x40, 0x00, 0xC4, 0x47, 0x31, 0x00, 0x0B,
+0x2D, 0x00, 0x4B, 0x6D, 0x4B, 0x6D, 0x4B, 0x6D, 0x4B, 0x6D, 0x4B, 0x6D, 0x4B, 0xCD, 0x47, 0x0B,
+0x31, 0x0B, 0x08, 0x0A, 0x51, 0x03, 0x01, 0x00, 0x1C, 0x0A, 0x04, 0x1C, 0x00, 0x56, 0x42, 0x5C,
+0x42, 0x5C, 0x42, 0x02, 0x69, 0xC4, 0x44, 0x08, 0x47, 0x2D, 0x08, 0x00, 0x41, 0x00, 0x4B, 0x40,
+0x14, 0x4E, 0x46, 0xE0, 0x01, 0xC1, 0x73, 0x06, 0x00, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x4B, 0x40, 0x02, 0x4B, 0x40, 0x52, 0x67, 0x71, 0x40, 0x09, 0x4B, 0x40,
+0x0E, 0x41, 0x4B, 0x00, 0x40, 0x03, 0x52, 0x40, 0x02, 0x4B, 0x40, 0x4B, 0x40, 0x6D, 0x40, 0x52,
+0x40, 0x52, 0x40, 0x28, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x02, 0x41,
+0x00, 0x40, 0x02, 0x41, 0x40, 0x01, 0x41, 0x00, 0x40, 0x00, 0x4B, 0x67, 0x4B, 0x41, 0x00, 0x40,
+0x01, 0x41, 0x40, 0x1A, 0x6D, 0x41, 0x40, 0x01, 0x4B, 0x40, 0x02, 0x4B, 0x40, 0x00, 0x52, 0x40,
+0x00, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x4B, 0x00, 0x40, 0x04, 0x4B, 0x00, 0x40, 0x0D, 0x52, 0x41,
+0x40, 0x52, 0x40, 0x52, 0x40, 0x03, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x00, 0x52, 0x40, 0x52,
+0x40, 0x52, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x41, 0x40, 0x0F, 0x67, 0x41, 0x40, 0x0D, 0x4C, 0x46,
+0x11, 0xC1, 0x73, 0x06, 0x16, 0x75, 0x4C, 0xC4, 0xCA, 0x73, 0x35, 0x06, 0x68, 0x00, 0x4C, 0x00,
+0xC3, 0x73, 0x06, 0x02, 0x00, 0x00, 0xC1, 0x89, 0xE3, 0x00, 0xCD, 0x84, 0x34, 0x84, 0x9B, 0xE3,
+0x84, 0x3E, 0xC7, 0x84, 0xC7, 0xE3, 0x84, 0xC7, 0x84, 0x01, 0x7E, 0xCA, 0x86, 0x08, 0x70, 0x44,
+0x6D, 0x04, 0x44, 0x08, 0x0A, 0x16, 0x02, 0x00, 0x56, 0x5C, 0x42, 0x02, 0x5C, 0x69, 0x42, 0x69,
+0x44, 0x4A, 0x48, 0xC5, 0x6D, 0x0E, 0x51, 0x01, 0x3A, 0x59, 0x00, 0xC1, 0xB0, 0x59, 0x00, 0xC3,
+0xB0, 0x59, 0xCE, 0x59, 0x00, 0xC3, 0xCE, 0xB0, 0xCE, 0x59, 0x01, 0xC3, 0xCE, 0x95, 0x90, 0x00,
+0x02, 0x4E, 0xC3, 0x73, 0x68, 0x06, 0x68, 0x00, 0xC1, 0x73, 0x06, 0x07, 0xC1, 0x73, 0x06, 0x34,
+0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x4B, 0x40, 0x0E, 0x4F, 0x40, 0x52, 0x40, 0x52, 0x40,
+0x03, 0x41, 0x40, 0x0A, 0x4B, 0x40, 0x0E, 0x65, 0x4B, 0x40, 0x0D, 0x4B, 0x40, 0x05, 0x4B, 0x40,
+0x00, 0x4B, 0x40, 0x02, 0x52, 0x40, 0x1C, 0x41, 0x40, 0x00, 0x41, 0x01, 0x40, 0x02, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x01, 0x42, 0x48, 0x00, 0x42, 0x40, 0x01, 0x41, 0x40, 0x00, 0x44,
+0x48, 0x00, 0x42, 0x70, 0x69, 0x44, 0xC4, 0x44, 0x49, 0x53, 0x44, 0x00, 0x00, 0x41, 0x40, 0x1A,
+0x41, 0x71, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x4B, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x29, 0x4C, 0x44, 0x66,
+0xCB, 0x6D, 0x0C, 0x05, 0x35, 0x70, 0x0A, 0x04, 0x03, 0x0A, 0x06, 0x02, 0x00, 0x00, 0xCB, 0xCE,
+0x5F, 0x6C, 0x3B, 0x9B, 0x34, 0x9B, 0x11, 0x6C, 0xBC, 0x5C, 0x6C, 0x00, 0xC5, 0x5C, 0x6C, 0x75,
+0x2B, 0x2A, 0x2B, 0x00, 0x7B, 0x48, 0xC4, 0x53, 0x04, 0x08, 0x70, 0x0A, 0x00, 0xCB, 0x6D, 0x1C,
+0x16, 0x02, 0x1C, 0x02, 0x16, 0x29, 0x1C, 0x29, 0x16, 0x02, 0x00, 0x69, 0x00, 0xCF, 0x53, 0x70,
+0x0A, 0x0E, 0x16, 0x47, 0x21, 0x3B, 0x2A, 0x6C, 0x11, 0x6C, 0x8F, 0x6C, 0x3B, 0x6C, 0x03, 0x7B,
+0x74, 0x00, 0xC3, 0x9B, 0x6C, 0x95, 0x00, 0x02, 0x4E, 0x75, 0x43, 0xC7, 0xB5, 0x03, 0x0E, 0x77,
+0x9E, 0x0E, 0x35, 0x06, 0x3B, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x4F, 0x40, 0x65, 0x48, 0x43, 0x44, 0x00, 0x40, 0x43,
+0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x48, 0x41, 0x45, 0x42, 0x40, 0x01,
+0x41, 0x40, 0x5F, 0xCF, 0x86, 0x00, 0x05, 0x29, 0x49, 0x03, 0x51, 0x03, 0x04, 0x00, 0x0A, 0x1F,
+0x00, 0x01, 0x0B, 0x00, 0x19, 0x6D, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x67, 0x41, 0x40, 0x0D, 0x4C,
+0x46, 0x29, 0xC7, 0x53, 0x23, 0x68, 0x0E, 0x23, 0x21, 0x03, 0x0A, 0x00, 0x63, 0xCA, 0x73, 0x50,
+0x73, 0x02, 0x12, 0x31, 0xCE, 0x6C, 0x9B, 0x52, 0x9D, 0x00, 0xC2, 0x76, 0xC7, 0x11, 0x04, 0x6B,
+0x00, 0xCD, 0x9B, 0x3E, 0x34, 0x4A, 0x0E, 0x6D, 0x0A, 0x16, 0x70, 0x08, 0x92, 0x0E, 0x6D, 0x02,
+0x00, 0x56, 0x00, 0x42, 0x04, 0x69, 0x00, 0x42, 0x69, 0x48, 0xD9, 0x6D, 0x0E, 0x9E, 0x29, 0x47,
+0x21, 0x86, 0x71, 0x86, 0x84, 0x3B, 0x2F, 0x84, 0x59, 0x84, 0x8F, 0x84, 0x11, 0x34, 0x76, 0x9D,
+0x65, 0x5B, 0x34, 0x63, 0x00, 0x02, 0x4E, 0x46, 0x43, 0x4A, 0x4E, 0x4A, 0x4E, 0x44, 0xC2, 0x6D,
+0x53, 0x06, 0x3B, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x61, 0x4E, 0x44, 0x68, 0x48, 0x45, 0x48, 0x40, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x48, 0x40, 0x43, 0x4A, 0x41, 0x40, 0x00, 0x41,
+0x40, 0x65, 0x48, 0x40, 0x43, 0x4A, 0xCA, 0x60, 0x1C, 0x0E, 0x51, 0x04, 0x00, 0x86, 0x1F, 0x00,
+0x01, 0x00, 0x1A, 0x41, 0x71, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x4B, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x29,
+0x4E, 0x48, 0xCC, 0x49, 0x05, 0x0E, 0x0A, 0x53, 0x02, 0x0E, 0x08, 0x0E, 0x6D, 0x06, 0x02, 0x00,
+0x00, 0xD3, 0xCE, 0x11, 0x71, 0x7A, 0x6B, 0x4F, 0x65, 0x76, 0x3B, 0x4A, 0x95, 0x36, 0x84, 0x42,
+0x2B, 0x42, 0x3E, 0x02, 0x08, 0x53, 0x00, 0x48, 0xD3, 0x53, 0x02, 0x0A, 0x70, 0x0A, 0x64, 0x74,
+0x1C, 0x16, 0x1C, 0x02, 0x1C, 0x16, 0x02, 0x16, 0x29, 0x02, 0x29, 0x02, 0x29, 0x00, 0xC1, 0x53,
+0x0A, 0x00, 0xC5, 0x92, 0x02, 0xAF, 0x05, 0x02, 0x21, 0x00, 0x66, 0x51, 0xCE, 0xC9, 0x58, 0x93,
+0x84, 0x26, 0x9A, 0x9B, 0x76, 0x7C, 0x6B, 0xD8, 0x4C, 0x76, 0x44, 0x00, 0x02, 0x4E, 0x46, 0x4E,
+0x41, 0xC6, 0x73, 0x49, 0x0E, 0x0A, 0x77, 0x53, 0x06, 0x3B, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x4F, 0x40, 0x45, 0xC2,
+0x4F, 0x3F, 0x04, 0x00, 0x48, 0x42, 0x40, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x01, 0x44,
+0x48, 0x43, 0x48, 0x40, 0x01, 0x41, 0x40, 0x00, 0x44, 0x48, 0xCC, 0x6D, 0x26, 0x74, 0x1F, 0x0A,
+0x44, 0x0A, 0x6D, 0x03, 0x00, 0x27, 0x01, 0x00, 0x1A, 0x6D, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x0D, 0x4C, 0x46, 0x29, 0xCE, 0x73, 0x0E, 0x08, 0x0C, 0x35, 0x9E, 0x68, 0x0E, 0x77, 0x08,
+0x70, 0x35, 0x06, 0x02, 0x00, 0x00, 0xC4, 0xCE, 0x3B, 0x76, 0x6B, 0x0B, 0x00, 0x65, 0xD8, 0x56,
+0x34, 0x3F, 0xA4, 0x58, 0xA4, 0x2B, 0x32, 0x42, 0x0E, 0x02, 0x51, 0x08, 0x0A, 0x50, 0x70, 0x1C,
+0x6D, 0x0A, 0x0E, 0x23, 0x6D, 0x02, 0x04, 0x16, 0x00, 0x42, 0x00, 0x56, 0x5C, 0x42, 0x5C, 0x69,
+0x42, 0x69, 0x45, 0x4A, 0xC0, 0x92, 0x00, 0x4E, 0x5C, 0x4B, 0xD4, 0x4F, 0x16, 0x02, 0x29, 0x26,
+0x4A, 0x11, 0x84, 0x36, 0x85, 0xA4, 0x36, 0x3B, 0x7A, 0x6B, 0x0B, 0xC0, 0x94, 0x56, 0xB8, 0x00,
+0x00, 0x4B, 0x40, 0x4A, 0x46, 0x75, 0x4E, 0x46, 0x63, 0x4C, 0x63, 0xC2, 0x68, 0x9E, 0x06, 0x3B,
+0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x3D, 0x41, 0x40, 0xC6, 0x4F, 0x08, 0x26, 0x05, 0x02, 0x0E, 0x00, 0x00, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x02, 0x45, 0x00, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x45,
+0x00, 0x40, 0x41, 0x4B, 0x41, 0x65, 0x45, 0x00, 0x4B, 0x40, 0x00, 0x41, 0x40, 0x1A, 0x41, 0x71,
+0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40,
+0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x63, 0x46, 0x2F, 0xC3, 0x73, 0x06, 0x73, 0x06,
+0x02, 0x42, 0x40, 0x00, 0xDF, 0xCE, 0x11, 0x76, 0x6B, 0x0B, 0x00, 0x6B, 0x56, 0x64, 0x2F, 0xB0,
+0x4A, 0x84, 0x42, 0x2B, 0x42, 0x23, 0x04, 0x96, 0x0A, 0x6D, 0x08, 0x53, 0x16, 0x04, 0x6D, 0x0E,
+0x9E, 0x03, 0x02, 0x16, 0x1C, 0x42, 0x00, 0x56, 0x42, 0x00, 0x69, 0x42, 0x69, 0x42, 0x69, 0x00,
+0xC2, 0x51, 0x08, 0x0A, 0x00, 0x69, 0x65, 0x45, 0x42, 0x00, 0x68, 0xC1, 0x59, 0x11, 0x00, 0xC8,
+0x58, 0x3F, 0xA7, 0x9A, 0x5A, 0x3B, 0x4C, 0xC0, 0x12, 0x00, 0xC3, 0x7C, 0x56, 0x1C, 0x00, 0x02,
+0x4E, 0x46, 0x03, 0xC1, 0x73, 0x06, 0x3E, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x4F, 0x40, 0x4B, 0x4F, 0x5F, 0x4B, 0x67,
+0x41, 0x40, 0x00, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x71, 0x40, 0x07, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0A, 0x67, 0x40, 0x10, 0x71, 0x40, 0x0D, 0x4C, 0x46, 0x2B, 0xC1, 0x73, 0x06, 0x00,
+0xC1, 0x73, 0x06, 0x05, 0x42, 0x40, 0x00, 0xD3, 0xCE, 0x11, 0x34, 0xD4, 0x6B, 0xAF, 0x7A, 0x76,
+0x3B, 0x32, 0x11, 0x32, 0x11, 0x42, 0x11, 0x2B, 0x4A, 0x96, 0x03, 0x0A, 0x00, 0xDF, 0x6D, 0x08,
+0x04, 0x02, 0x29, 0x02, 0x04, 0x16, 0x02, 0x04, 0x16, 0x02, 0x16, 0x1C, 0x02, 0x16, 0x02, 0x1C,
+0x02, 0x29, 0x02, 0x29, 0x05, 0x25, 0x05, 0x29, 0x21, 0x25, 0x05, 0x16, 0x02, 0x29, 0x66, 0x51,
+0x6F, 0x00, 0xC1, 0x84, 0x2F, 0x00, 0x7B, 0x51, 0xC7, 0x52, 0x7C, 0x0B, 0xC0, 0x65, 0x76, 0x9D,
+0x00, 0x02, 0x4A, 0x46, 0x06, 0xC1, 0x73, 0x06, 0x3B, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x00, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0xC4, 0x44, 0x03, 0x04, 0x03, 0x04, 0x00, 0x43,
+0xDC, 0x44, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x63, 0x00, 0xDF,
+0x50, 0x08, 0x63, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x00, 0xDA, 0x63, 0x26, 0x63, 0x26,
+0x63, 0x26, 0x03, 0x63, 0x59, 0x26, 0x96, 0x44, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x00, 0xC3, 0x96, 0x03, 0x04, 0x03, 0x00, 0x44, 0x43,
+0xC6, 0x96, 0x03, 0x04, 0x03, 0x96, 0x03, 0x63, 0x00, 0xCA, 0x50, 0x63, 0x03, 0x63, 0x03, 0x63,
+0x03, 0x63, 0x03, 0x63, 0x03, 0x01, 0xC2, 0x63, 0x50, 0x03, 0x00, 0x76, 0xD0, 0x63, 0x03, 0x36,
+0x04, 0x03, 0x36, 0x51, 0x36, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x0C, 0x06, 0x73, 0x0C, 0xC1,
+0xCA, 0x73, 0x01, 0xC2, 0xCA, 0x06, 0xCA, 0x00, 0x46, 0xC0, 0xCA, 0x00, 0x46, 0xC0, 0x73, 0x04,
+0xC3, 0xCA, 0x06, 0xCA, 0x73, 0x01, 0xC2, 0xCA, 0x06, 0xCA, 0x01, 0x46, 0xC4, 0x73, 0x06, 0x73,
+0x06, 0x73, 0x05, 0x48, 0x76, 0x44, 0xC9, 0xB0, 0x75, 0x11, 0xA9, 0x76, 0x65, 0x76, 0x64, 0x23,
+0x9E, 0x00, 0xC7, 0xC2, 0x23, 0x2B, 0xDB, 0x42, 0x0E, 0x44, 0x08, 0x00, 0xC5, 0x6D, 0x08, 0x6D,
+0x02, 0x04, 0x02, 0x02, 0x56, 0x42, 0x44, 0x42, 0x56, 0x42, 0x00, 0x69, 0x42, 0x69, 0x42, 0x69,
+0x42, 0x00, 0x69, 0x42, 0x69, 0x61, 0x45, 0xC0, 0x4F, 0x00, 0x42, 0x56, 0x69, 0x43, 0x51, 0x6F,
+0x00, 0x51, 0x63, 0x7B, 0x72, 0x7B, 0xCC, 0x64, 0x50, 0x7C, 0x94, 0x4C, 0x34, 0x86, 0x44, 0x03,
+0x36, 0x04, 0x23, 0x06, 0xE0, 0x04, 0xDF, 0x68, 0x04, 0x44, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x44, 0x03, 0x04, 0x03,
+0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0xC6, 0x44, 0x03, 0x04, 0x03,
+0x04, 0x03, 0x04, 0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x00, 0x43, 0x44, 0xC3, 0x51, 0x36, 0x03, 0x04, 0x00, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x42, 0x41, 0x44, 0x45, 0x42, 0x68,
+0x61, 0x45, 0x00, 0x42, 0x45, 0x00, 0x42, 0x00, 0x61, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00,
+0x42, 0x45, 0x68, 0x45, 0x61, 0x68, 0x61, 0x42, 0x68, 0x45, 0x68, 0x45, 0x00, 0x61, 0x45, 0x01,
+0x61, 0x68, 0x61, 0x45, 0x00, 0x61, 0x68, 0x45, 0x61, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x45,
+0x01, 0x42, 0xC5, 0xB6, 0x75, 0x2B, 0x11, 0x02, 0x05, 0x01, 0x42, 0x45, 0x00, 0x61, 0x45, 0x00,
+0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42,
+0x45, 0x00, 0x42, 0x01, 0x45, 0x42, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00,
+0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x61, 0x68, 0x45, 0x61, 0x45, 0x42, 0xC0, 0x5F, 0x07,
+0xC4, 0x75, 0xE3, 0x05, 0x28, 0x05, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x69,
+0x45, 0xC3, 0xAA, 0x05, 0x28, 0x8C, 0x0A, 0x56, 0xC6, 0x59, 0x71, 0x52, 0x71, 0x52, 0x71, 0x52,
+0x00, 0xC5, 0x71, 0x52, 0x71, 0x52, 0x71, 0x52, 0x00, 0xC1, 0x71, 0x52, 0x00, 0xC3, 0x86, 0x89,
+0x04, 0x3F, 0x00, 0x44, 0x77, 0x7F, 0x00, 0x44, 0x7F, 0x00, 0x44, 0x7F, 0x44, 0x7F, 0x44, 0x42,
+0x4F, 0x65, 0x7A, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F,
+0x4F, 0x42, 0x60, 0x50, 0x00, 0x60, 0xC5, 0xA5, 0x7B, 0x20, 0x10, 0x20, 0x7B, 0x00, 0x60, 0xC0,
+0x82, 0x00, 0x60, 0xCC, 0x7B, 0x10, 0x20, 0xA5, 0x20, 0xA5, 0x7B, 0x20, 0xA5, 0x20, 0xAD, 0x16,
+0x04, 0x08, 0x5C, 0x42, 0x68, 0x45, 0xC2, 0x59, 0x75, 0x2B, 0x00, 0x7B, 0x00, 0x51, 0x72, 0xC9,
+0xC2, 0x72, 0x56, 0x88, 0x3B, 0x11, 0x2B, 0x42, 0x2F, 0x58, 0x00, 0x4E, 0x4A, 0x48, 0x00, 0x44,
+0x56, 0x44, 0xC4, 0x96, 0x04, 0x02, 0x16, 0x02, 0x00, 0x56, 0x42, 0x56, 0x42, 0x5C, 0x42, 0x5C,
+0x42, 0x69, 0x42, 0x69, 0x61, 0x69, 0x42, 0x00, 0x45, 0x41, 0x45, 0x44, 0x76, 0xC3, 0x89, 0x58,
+0x23, 0x2F, 0x00, 0x7B, 0xC5, 0x66, 0x6F, 0x6A, 0x9E, 0xC2, 0x64, 0x00, 0x74, 0x7B, 0x51, 0xC1,
+0x59, 0x05, 0x00, 0x61, 0x5F, 0x4E, 0x46, 0xE0, 0x04, 0xC1, 0x68, 0x05, 0x00, 0x61, 0x68, 0x45,
+0x61, 0x68, 0x61, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x42, 0x00, 0x45, 0x68,
+0x61, 0x68, 0x45, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x00, 0x42,
+0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x61, 0x68, 0x45, 0x61, 0x45, 0x42, 0x00, 0x45, 0x68, 0x61,
+0x68, 0x45, 0x61, 0x68, 0x61, 0x42, 0x00, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45,
+0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45,
+0x00, 0x42, 0x45, 0x00, 0x42, 0x00, 0x45, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42,
+0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42,
+0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42,
+0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x00, 0x42, 0x45, 0x00, 0x61, 0x68, 0x61, 0x45, 0x61, 0x68,
+0x45, 0x61, 0x45, 0x42, 0x01, 0x45, 0x42, 0x45, 0x03, 0x42, 0x00, 0x68, 0x61, 0x68, 0x61, 0x45,
+0x01, 0x61, 0x45, 0x00, 0x42, 0x00, 0x45, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x6D, 0xC3, 0x6C, 0x75, 0xE7, 0x00, 0x1A, 0x41, 0x40, 0x18, 0x6D, 0xC1, 0x9F, 0x19, 0x03,
+0xC1, 0x9F, 0x19, 0x01, 0xC2, 0xC8, 0x0B, 0x00, 0x0E, 0xC1, 0xA2, 0x18, 0x08, 0xC3, 0xAE, 0xDA,
+0x9D, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x03, 0xC0, 0x5B, 0x00, 0x54, 0x00, 0xC6, 0x5B, 0x14, 0x5B,
+0x14, 0x67, 0x93, 0x40, 0x04, 0x62, 0xC1, 0x40, 0x22, 0x00, 0xC0, 0x40, 0x00, 0x5E, 0x62, 0x4F,
+0x67, 0x40, 0x0F, 0xC2, 0x47, 0x1B, 0x15, 0x00, 0x49, 0x55, 0x49, 0x05, 0xC1, 0x41, 0x09, 0x03,
+0x55, 0x49, 0x00, 0x55, 0x49, 0x01, 0x5B, 0xC1, 0x8A, 0x02, 0x09, 0x67, 0x40, 0x00, 0x76, 0xC1,
+0x6C, 0x2A, 0x00, 0x6B, 0x6A, 0x00, 0x63, 0xC7, 0x88, 0x56, 0xF9, 0x20, 0xC2, 0x23, 0x2B, 0x42,
+0x01, 0x75, 0xCA, 0xA6, 0x35, 0x59, 0x08, 0x04, 0x02, 0x05, 0x02, 0x51, 0x04, 0x02, 0x05, 0x56,
+0x69, 0x42, 0x69, 0x42, 0x69, 0x61, 0x45, 0x41, 0xC8, 0x4F, 0x1C, 0x4F, 0x01, 0x0F, 0x3B, 0x42,
+0x11, 0x2F, 0x01, 0xC9, 0x4A, 0x9E, 0x72, 0x80, 0x8B, 0x6A, 0x9E, 0x4A, 0x11, 0x2F, 0x00, 0xC2,
+0xBC, 0x95, 0x00, 0x02, 0x4E, 0x46, 0xE0, 0x04, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x01, 0x41, 0x40, 0x41, 0x45, 0x41,
+0x40, 0x02, 0x41, 0x45, 0x41, 0x40, 0x45, 0x40, 0x03, 0x41, 0x00, 0x40, 0x45, 0x41, 0x71, 0x40,
+0xC4, 0xC7, 0xC5, 0x00, 0x31, 0x00, 0x01, 0x41, 0x40, 0x41, 0x00, 0x40, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x18, 0x6D, 0xC1, 0x9F, 0x19, 0x01, 0xC4, 0x43, 0x19, 0x5F, 0x43, 0x19, 0x00, 0xC1, 0xC8,
+0x00, 0x0E, 0x71, 0x5F, 0x58, 0xC0, 0x8E, 0x02, 0x58, 0x01, 0xC0, 0x8E, 0x01, 0x58, 0xC1, 0x67,
+0x14, 0x00, 0xC6, 0xCE, 0x14, 0x5B, 0x52, 0x14, 0x5B, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x00, 0xC1,
+0x5B, 0x14, 0x00, 0xC9, 0x67, 0x93, 0x40, 0x22, 0x40, 0x90, 0x17, 0x93, 0x22, 0x40, 0x00, 0x62,
+0xC6, 0x40, 0x22, 0x0F, 0x40, 0x22, 0x0F, 0x00, 0x0E, 0x52, 0xC2, 0xDA, 0x10, 0x09, 0x01, 0xC1,
+0x97, 0x09, 0x04, 0x50, 0x49, 0x50, 0x49, 0xC3, 0x41, 0x10, 0x97, 0x09, 0x04, 0xC3, 0x97, 0x1B,
+0x29, 0x02, 0x09, 0x41, 0x40, 0x00, 0xC5, 0x63, 0x6C, 0x2A, 0x42, 0x2A, 0x2B, 0x00, 0xCA, 0x9E,
+0x66, 0x56, 0x80, 0x6A, 0x64, 0x32, 0x42, 0x11, 0x2B, 0x42, 0x01, 0xC7, 0x68, 0x26, 0x08, 0x02,
+0x1F, 0x00, 0x05, 0x03, 0x00, 0x56, 0x42, 0x00, 0x56, 0x42, 0x00, 0x69, 0x42, 0x01, 0x69, 0x01,
+0x45, 0x41, 0x4B, 0x45, 0x43, 0x42, 0xC4, 0x47, 0x25, 0x4A, 0x32, 0x11, 0x03, 0xC8, 0x9E, 0x88,
+0x80, 0x7D, 0x6A, 0x3B, 0x32, 0xC9, 0x11, 0x00, 0x6F, 0xC1, 0x95, 0x00, 0x02, 0x4E, 0x46, 0xC6,
+0xEB, 0x64, 0x35, 0x73, 0x77, 0x73, 0x68, 0x00, 0x4C, 0xC2, 0x64, 0x35, 0x06, 0x38, 0x75, 0x40,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D,
+0x41, 0x40, 0x02, 0x45, 0x41, 0x40, 0x01, 0x41, 0x40, 0x03, 0x41, 0x5F, 0x4B, 0x67, 0x40, 0x01,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x48, 0x4A, 0x40, 0x4A, 0x43,
+0x4A, 0x41, 0x40, 0x00, 0x41, 0x4A, 0x43, 0x00, 0x44, 0x48, 0x43, 0x40, 0x01, 0x42, 0x4A, 0x43,
+0x42, 0x48, 0x00, 0x71, 0x40, 0x41, 0x4B, 0x40, 0x00, 0x5F, 0x4A, 0x42, 0x40, 0x41, 0x48, 0x4A,
+0x68, 0x40, 0x11, 0x41, 0x40, 0x18, 0x6D, 0xCC, 0x43, 0x9F, 0x43, 0x2B, 0x75, 0x6C, 0x2A, 0x2B,
+0x5F, 0x19, 0xC8, 0x47, 0x00, 0x0D, 0xCA, 0x47, 0x1F, 0xE5, 0x92, 0x74, 0x98, 0x96, 0x74, 0x96,
+0x74, 0x98, 0x00, 0xC3, 0x96, 0x18, 0x9D, 0x14, 0x00, 0xC0, 0x67, 0x00, 0x74, 0x00, 0x7B, 0xC8,
+0x52, 0x9C, 0x64, 0x34, 0x14, 0x3B, 0x52, 0x67, 0x14, 0x00, 0xC7, 0x67, 0x93, 0x22, 0x40, 0x36,
+0x5A, 0x58, 0x26, 0x00, 0x77, 0x70, 0xC3, 0x90, 0x54, 0x36, 0x40, 0x00, 0x62, 0x5E, 0x40, 0x0F,
+0xC4, 0xAF, 0x10, 0x97, 0x10, 0x09, 0x04, 0xC0, 0x72, 0x00, 0x60, 0x5A, 0x00, 0x60, 0xC3, 0x72,
+0x78, 0x41, 0x09, 0x01, 0x55, 0x50, 0x49, 0x00, 0x50, 0x42, 0x06, 0x48, 0x4E, 0x48, 0x42, 0x41,
+0x40, 0x00, 0xCF, 0x63, 0x75, 0x2A, 0x3B, 0x64, 0x3E, 0x64, 0x32, 0xC2, 0x88, 0x6A, 0x66, 0xC2,
+0x32, 0x11, 0x42, 0x00, 0x72, 0xCC, 0x84, 0x23, 0x68, 0x63, 0x08, 0xAA, 0x0B, 0x01, 0x03, 0x08,
+0x02, 0xAA, 0x02, 0x04, 0x5C, 0x69, 0x02, 0x45, 0x41, 0xCE, 0x4F, 0x05, 0x44, 0x08, 0x51, 0xDA,
+0x2D, 0x4A, 0x2B, 0x11, 0x3B, 0x34, 0x3E, 0x64, 0x9E, 0x00, 0xCA, 0x6F, 0x6A, 0x64, 0x0C, 0x3B,
+0x3E, 0x34, 0x4A, 0x3B, 0x63, 0x00, 0x02, 0x4E, 0x46, 0x43, 0xC5, 0x58, 0x04, 0x77, 0x02, 0x3E,
+0x0E, 0x00, 0x44, 0x4A, 0x44, 0xC1, 0x68, 0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x00, 0x41, 0x44,
+0x48, 0x4A, 0x42, 0x40, 0x00, 0x41, 0x40, 0x02, 0x45, 0x48, 0x00, 0x43, 0x40, 0x4B, 0x40, 0x00,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x41, 0x48, 0x4A, 0x45, 0x43, 0x40,
+0x44, 0x43, 0x40, 0x00, 0x41, 0x4E, 0x43, 0x4A, 0x48, 0x41, 0x48, 0x41, 0x40, 0x00, 0x48, 0x45,
+0x43, 0x42, 0x00, 0x4A, 0x41, 0x40, 0x4B, 0x01, 0x40, 0x45, 0x4A, 0x42, 0x40, 0x41, 0x45, 0x4A,
+0x42, 0x40, 0x11, 0x41, 0x40, 0x18, 0x6D, 0xCB, 0x9F, 0x19, 0x43, 0x75, 0x5F, 0x19, 0x6C, 0x75,
+0x43, 0x19, 0xC8, 0x00, 0x0E, 0x71, 0xC8, 0xE5, 0x8E, 0x92, 0xEA, 0x49, 0x8C, 0x74, 0x54, 0x8E,
+0x00, 0xC0, 0x74, 0x00, 0x58, 0xC7, 0x67, 0x14, 0x76, 0x5B, 0x52, 0x3B, 0x67, 0x52, 0x00, 0x7B,
+0x7E, 0xC0, 0x52, 0x00, 0x7B, 0xC2, 0xC7, 0x67, 0x14, 0x00, 0xC2, 0x95, 0x93, 0x0F, 0x00, 0x76,
+0x70, 0x7F, 0xCC, 0x5A, 0x22, 0x4A, 0x36, 0x22, 0x5A, 0x60, 0x40, 0x93, 0x22, 0x0F, 0x12, 0x00,
+0x0E, 0xC3, 0xAF, 0x10, 0x97, 0x09, 0x04, 0x50, 0xC0, 0xAB, 0x00, 0x5B, 0xC6, 0x72, 0x78, 0x10,
+0x1A, 0x78, 0x1B, 0x09, 0x01, 0x55, 0x49, 0x00, 0x55, 0x5B, 0x69, 0x42, 0x05, 0x4E, 0x42, 0x4E,
+0x42, 0x41, 0x40, 0x00, 0xC4, 0xCE, 0x11, 0x3B, 0x53, 0x9D, 0x00, 0xC3, 0x4C, 0x34, 0xC2, 0x0C,
+0x01, 0x72, 0x51, 0xCE, 0xDB, 0x11, 0x32, 0x42, 0xA7, 0x59, 0x23, 0x03, 0x53, 0x92, 0x0E, 0x03,
+0x96, 0x51, 0x0A, 0x00, 0xC3, 0x98, 0x02, 0x16, 0x02, 0x00, 0x69, 0x42, 0x56, 0x42, 0x01, 0x4A,
+0x00, 0xC1, 0x9E, 0x0E, 0x00, 0xC8, 0x9E, 0x77, 0x03, 0x0B, 0x3E, 0x32, 0x3B, 0x67, 0x65, 0x00,
+0xC8, 0x44, 0xA9, 0x0C, 0x9E, 0xC4, 0x0C, 0x64, 0x56, 0x7A, 0x00, 0xC3, 0x67, 0x34, 0x59, 0x00,
+0x02, 0x4E, 0xCD, 0x68, 0x03, 0x06, 0x0A, 0x0C, 0x03, 0x04, 0x03, 0x0E, 0x08, 0x06, 0x0A, 0x23,
+0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x00, 0x45, 0x48, 0x40, 0x42, 0x00, 0x40, 0x00, 0x41, 0x40,
+0x02, 0x48, 0x45, 0x41, 0x44, 0x41, 0x67, 0x40, 0x00, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x42, 0x4E, 0x00, 0x48, 0x43, 0x40, 0x44, 0x43, 0x40, 0x00, 0x45, 0x4A, 0x45,
+0x4A, 0x00, 0x41, 0x48, 0x41, 0x40, 0x00, 0x48, 0x45, 0x43, 0x42, 0x41, 0x48, 0xC4, 0x90, 0x00,
+0x0B, 0xC0, 0x00, 0x01, 0x44, 0x42, 0x40, 0x41, 0x45, 0x42, 0x43, 0x40, 0x11, 0x41, 0x40, 0x18,
+0x6D, 0xC8, 0x43, 0x19, 0x43, 0x5F, 0x75, 0x43, 0x2A, 0x5F, 0x19, 0x00, 0xC1, 0xD2, 0x00, 0x0E,
+0x71, 0x58, 0xCA, 0xE5, 0xCF, 0x98, 0x8D, 0xAE, 0x74, 0x92, 0x18, 0xAD, 0x74, 0x18, 0x00, 0xC1,
+0x9D, 0x14, 0x01, 0xC4, 0x52, 0x9C, 0x67, 0x14, 0x52, 0x00, 0x7E, 0x7B, 0xC4, 0x67, 0x34, 0x83,
+0xCE, 0x14, 0x00, 0xCF, 0x67, 0x93, 0x22, 0x40, 0x60, 0x54, 0x4A, 0x60, 0x22, 0x54, 0x26, 0x27,
+0x36, 0x26, 0x40, 0x93, 0x00, 0x4F, 0x40, 0x0F, 0xC3, 0xDA, 0x10, 0x15, 0x09, 0x04, 0x55, 0xC3,
+0xA5, 0x72, 0x1B, 0x66, 0x00, 0x5B, 0x50, 0xC1, 0x78, 0x09, 0x00, 0x50, 0x49, 0x03, 0x50, 0x69,
+0x42, 0x05, 0x4E, 0x42, 0x4E, 0x42, 0x41, 0x40, 0x4B, 0xCA, 0xCE, 0x11, 0x6F, 0x65, 0xE9, 0xB7,
+0x65, 0x76, 0x64, 0x32, 0x4A, 0x00, 0x6B, 0xC1, 0x42, 0x32, 0x00, 0x51, 0xD4, 0x42, 0xA7, 0x23,
+0x32, 0x08, 0x0A, 0x0E, 0x9E, 0x8D, 0x0C, 0x23, 0x49, 0x8D, 0x0E, 0x02, 0x28, 0xAA, 0x1F, 0xAA,
+0x1F, 0xAA, 0x00, 0x42, 0x00, 0x4A, 0x4E, 0x4C, 0xC2, 0x4A, 0x23, 0x0E, 0x00, 0xC6, 0x51, 0x0B,
+0x86, 0x32, 0x4E, 0xD4, 0x6B, 0x00, 0xCD, 0x65, 0x67, 0x3B, 0x2F, 0x5A, 0x3B, 0x76, 0xDF, 0x6B,
+0x4F, 0x13, 0x76, 0x67, 0x00, 0x00, 0x4B, 0x40, 0x4E, 0xCD, 0x73, 0x04, 0x0A, 0x21, 0x0E, 0x03,
+0x23, 0x47, 0x0E, 0x04, 0x23, 0x04, 0x68, 0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x00, 0x45, 0x48,
+0x40, 0x48, 0x00, 0x40, 0x00, 0x41, 0x40, 0x02, 0x48, 0x45, 0x00, 0x4E, 0x45, 0x40, 0x01, 0x41,
+0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x43, 0x45, 0x41, 0x48, 0x4A, 0x48, 0x00,
+0x41, 0x40, 0x00, 0x41, 0x4E, 0x48, 0x43, 0x42, 0x4A, 0x43, 0x40, 0x01, 0x42, 0x4A, 0x43, 0x42,
+0x48, 0x43, 0x4F, 0x52, 0x40, 0x03, 0x44, 0x45, 0x01, 0x43, 0x48, 0x42, 0x40, 0x11, 0x41, 0x40,
+0x18, 0x67, 0xC1, 0x9F, 0x19, 0x00, 0xC4, 0x5F, 0x75, 0x43, 0x75, 0x19, 0x01, 0xC1, 0xC8, 0x00,
+0x0E, 0x71, 0x58, 0xC3, 0x8E, 0x74, 0xAE, 0x98, 0x00, 0xD7, 0x74, 0x8C, 0x98, 0xCF, 0x98, 0x8C,
+0x18, 0x67, 0x14, 0x67, 0x14, 0x67, 0x34, 0x9B, 0x64, 0x83, 0x9B, 0x34, 0x9C, 0x67, 0x34, 0x52,
+0x67, 0x14, 0x00, 0xCE, 0xCE, 0x93, 0x22, 0x1E, 0x36, 0x37, 0x90, 0x49, 0x5A, 0x28, 0x58, 0x90,
+0x37, 0x36, 0x40, 0x00, 0x62, 0x4F, 0x40, 0x0F, 0xC2, 0xAF, 0x10, 0x09, 0x06, 0xC4, 0x7B, 0x1A,
+0x33, 0x20, 0x33, 0x00, 0xC3, 0x97, 0xAB, 0x15, 0x09, 0x01, 0x55, 0x49, 0x01, 0x5B, 0x69, 0x42,
+0x05, 0xC5, 0x53, 0x0E, 0x08, 0x02, 0x01, 0x00, 0x00, 0xD0, 0x59, 0x3B, 0x50, 0xD8, 0x2D, 0x0B,
+0x25, 0x56, 0x0E, 0xA7, 0xF6, 0x36, 0xA7, 0x11, 0x42, 0x11, 0x42, 0x00, 0xC1, 0xA7, 0x32, 0x00,
+0x43, 0xCE, 0x50, 0xAA, 0x05, 0x04, 0x0E, 0x23, 0x0E, 0x0A, 0x03, 0x00, 0x31, 0x02, 0x03, 0x04,
+0x03, 0x00, 0x41, 0x40, 0x5F, 0x43, 0x4E, 0xD5, 0x64, 0x0A, 0x51, 0x04, 0x02, 0x25, 0x47, 0x86,
+0x9E, 0x65, 0x6B, 0x47, 0x0B, 0x8A, 0x4C, 0x0A, 0x9A, 0xA4, 0x0E, 0x65, 0x6B, 0x0B, 0x00, 0xC3,
+0x7A, 0xCC, 0x9D, 0x00, 0x02, 0x4E, 0x46, 0x75, 0x4A, 0x4E, 0xC8, 0x73, 0x23, 0x73, 0x23, 0x35,
+0x0E, 0x08, 0x23, 0x06, 0x38, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x01, 0x44, 0x48, 0x00, 0x44, 0x40, 0x00,
+0x41, 0x40, 0x02, 0x45, 0x48, 0x43, 0x48, 0x41, 0x40, 0x01, 0x41, 0x40, 0x45, 0x40, 0x07, 0x41,
+0x00, 0x40, 0x0D, 0x41, 0x40, 0x41, 0x40, 0x01, 0x41, 0x45, 0x40, 0x45, 0x43, 0x44, 0x42, 0x41,
+0x01, 0x40, 0x41, 0x00, 0x42, 0x44, 0x43, 0x45, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x67, 0x40,
+0x03, 0x41, 0x40, 0x01, 0x41, 0x00, 0x40, 0x12, 0x41, 0x40, 0x18, 0x6D, 0xC1, 0x9F, 0x19, 0x00,
+0xC3, 0x43, 0x19, 0x43, 0x19, 0x02, 0xC1, 0xD2, 0x00, 0x0E, 0x71, 0x5F, 0xC0, 0xE5, 0x00, 0x58,
+0x00, 0xC1, 0x8E, 0x18, 0x00, 0xC2, 0x8E, 0xEA, 0x8E, 0x00, 0x58, 0xC1, 0x44, 0x14, 0x00, 0xCC,
+0x5B, 0x14, 0x67, 0x52, 0x14, 0x67, 0x5B, 0x52, 0x67, 0x14, 0x5B, 0xCE, 0x14, 0x01, 0xC3, 0x89,
+0x93, 0x0F, 0x22, 0x00, 0xC1, 0x40, 0x22, 0x00, 0xC3, 0x90, 0x22, 0x40, 0x22, 0x01, 0xC2, 0x40,
+0x93, 0x0F, 0x00, 0x52, 0x40, 0x0E, 0xC2, 0x4F, 0x1B, 0x09, 0x00, 0x50, 0x49, 0x50, 0x49, 0x50,
+0x49, 0xC6, 0x62, 0x09, 0x62, 0x10, 0x09, 0x10, 0x09, 0x08, 0x50, 0x42, 0x07, 0x44, 0x42, 0x00,
+0x40, 0x01, 0xD8, 0x59, 0x6C, 0x76, 0x6B, 0x01, 0x0B, 0x6B, 0x56, 0x34, 0x32, 0xA4, 0x26, 0xA4,
+0x2F, 0x11, 0xDB, 0x2A, 0x42, 0xA7, 0x4A, 0x32, 0x03, 0x44, 0x1F, 0x00, 0x00, 0xC5, 0xA2, 0x02,
+0x49, 0x08, 0x02, 0x00, 0x00, 0x42, 0x44, 0x01, 0x48, 0x45, 0x40, 0x41, 0x42, 0x43, 0x4E, 0xC2,
+0x49, 0x04, 0x02, 0x00, 0xD5, 0xDA, 0x0B, 0x03, 0x0C, 0x65, 0xAF, 0x27, 0x0B, 0x6B, 0xA5, 0x71,
+0x95, 0x85, 0x3E, 0x4C, 0x6B, 0x47, 0x12, 0x7C, 0x4C, 0x65, 0x00, 0x00, 0x71, 0x40, 0x4E, 0x46,
+0x02, 0xC1, 0x73, 0x06, 0x3F, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x00, 0x41, 0x40, 0x41, 0x00, 0x40, 0x01,
+0x41, 0x40, 0x03, 0x41, 0x45, 0x40, 0x02, 0x41, 0x00, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x06, 0x41, 0x45, 0x00, 0x41, 0x40, 0x04, 0x45, 0x01, 0x40, 0x25, 0x41, 0x40, 0x18,
+0x52, 0xCB, 0x9F, 0x19, 0x9F, 0x19, 0x9F, 0x19, 0x43, 0x19, 0x43, 0x9F, 0xC8, 0x00, 0x0F, 0x58,
+0xC1, 0xAE, 0x18, 0x00, 0xC1, 0xAE, 0x18, 0x00, 0xC2, 0xAE, 0x18, 0xAE, 0x00, 0x58, 0xC2, 0xAE,
+0x9D, 0x14, 0x00, 0xC0, 0x67, 0x00, 0xC1, 0x5B, 0x67, 0x00, 0x54, 0xC0, 0x5B, 0x01, 0x54, 0xC7,
+0x67, 0x5B, 0x67, 0x14, 0x5B, 0x67, 0x93, 0x1E, 0x0A, 0xC0, 0x40, 0x00, 0x4F, 0x67, 0x40, 0x0F,
+0x41, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x02, 0x50, 0x49, 0x50, 0x49,
+0x02, 0x50, 0x55, 0x49, 0x50, 0x00, 0x5B, 0x69, 0x00, 0x42, 0x03, 0x68, 0x42, 0x45, 0x42, 0x00,
+0x40, 0x01, 0xD0, 0x63, 0x11, 0x34, 0xB8, 0xC0, 0x25, 0x65, 0x76, 0xC2, 0x11, 0x5C, 0x5A, 0x58,
+0x11, 0x42, 0x2A, 0x42, 0x00, 0xD4, 0xA7, 0x4A, 0x23, 0x63, 0x89, 0x29, 0x05, 0x00, 0x01, 0x22,
+0x36, 0x08, 0x04, 0x08, 0x02, 0x03, 0x44, 0x02, 0x08, 0x04, 0x08, 0x00, 0x42, 0x4A, 0x43, 0x00,
+0x5C, 0x41, 0x45, 0x44, 0xC6, 0x53, 0x50, 0x23, 0x32, 0x70, 0x6B, 0xC0, 0x00, 0xCD, 0x7C, 0x56,
+0x3B, 0x95, 0x93, 0x0E, 0x71, 0x7C, 0x0B, 0x47, 0xD4, 0x76, 0x44, 0x00, 0x02, 0x4E, 0x46, 0xE0,
+0x04, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B,
+0x41, 0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x43, 0x19, 0x48, 0x43, 0x06,
+0x44, 0x43, 0x00, 0x44, 0x43, 0x05, 0x44, 0x43, 0x07, 0xC4, 0x59, 0x53, 0x86, 0x59, 0x03, 0x19,
+0x48, 0x43, 0x18, 0x48, 0xC6, 0x5C, 0x75, 0x11, 0x2A, 0x11, 0x2A, 0x75, 0x02, 0xC2, 0x84, 0x51,
+0x03, 0x0C, 0xC3, 0x50, 0x03, 0x30, 0x74, 0x0A, 0xC1, 0x71, 0x34, 0x05, 0x7E, 0x74, 0x01, 0x7E,
+0x74, 0x03, 0x7E, 0xC1, 0x59, 0x30, 0x08, 0x66, 0x70, 0x66, 0x70, 0x00, 0x66, 0x43, 0x0D, 0x66,
+0xC2, 0x59, 0x6D, 0x1B, 0x0B, 0xC1, 0x7A, 0x1B, 0x07, 0xC1, 0x41, 0x1B, 0x00, 0xC1, 0x86, 0x0A,
+0x01, 0xC1, 0x58, 0x0A, 0x04, 0x48, 0x43, 0x66, 0x43, 0xCB, 0x59, 0xBC, 0x11, 0x34, 0x76, 0x9D,
+0x76, 0x9B, 0x11, 0x2A, 0x11, 0x42, 0x01, 0xC1, 0xC9, 0x11, 0x00, 0x72, 0xCF, 0xA7, 0xA4, 0x4A,
+0x11, 0x23, 0x04, 0x02, 0x0F, 0x22, 0x04, 0x23, 0x53, 0x89, 0x0C, 0x44, 0x0E, 0x00, 0xDD, 0x63,
+0x0C, 0x63, 0x3E, 0x23, 0x44, 0x23, 0x0A, 0x08, 0x03, 0x1F, 0x21, 0x0E, 0xE6, 0x35, 0x42, 0x32,
+0x2B, 0x6F, 0x7A, 0x7C, 0x4C, 0x3B, 0x11, 0x4A, 0xA7, 0x2F, 0x3B, 0x76, 0xE4, 0x00, 0xC3, 0x4C,
+0x9C, 0x3E, 0x03, 0x01, 0x44, 0x63, 0x46, 0xE0, 0x04, 0xC1, 0x68, 0x03, 0xE0, 0x6D, 0x48, 0x42,
+0x41, 0x42, 0x41, 0x45, 0x00, 0x41, 0x45, 0x01, 0x41, 0x45, 0x00, 0x42, 0x41, 0x45, 0x41, 0x45,
+0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x02, 0x5F, 0x65, 0x45, 0x02, 0x65, 0x45,
+0x03, 0x41, 0x45, 0x06, 0x4F, 0x5F, 0x45, 0x62, 0xC6, 0xE7, 0x3B, 0x2B, 0x3B, 0xBD, 0x01, 0x05,
+0x01, 0x41, 0x45, 0x00, 0x41, 0x45, 0x00, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01,
+0x41, 0x45, 0x01, 0x41, 0x45, 0x04, 0x5F, 0x4F, 0x45, 0x00, 0x5F, 0x4F, 0x45, 0x00, 0x5F, 0x4F,
+0x45, 0x00, 0x5F, 0x4F, 0x45, 0x00, 0x5F, 0x4F, 0x45, 0x00, 0x41, 0x61, 0xC0, 0x43, 0x00, 0xC6,
+0x5F, 0x19, 0x5F, 0x43, 0x6C, 0x43, 0x5F, 0x00, 0xC2, 0xD2, 0x01, 0x05, 0x00, 0x4F, 0x5F, 0x45,
+0x00, 0x4F, 0x5F, 0x45, 0x00, 0x4F, 0x5F, 0x45, 0x5F, 0x45, 0x00, 0xCB, 0x8E, 0x8C, 0x8E, 0x8C,
+0x8E, 0x8C, 0x8E, 0x8C, 0x8E, 0x8C, 0x8E, 0x8C, 0x00, 0xC1, 0x50, 0x52, 0x06, 0xC1, 0x59, 0x52,
+0x06, 0xC1, 0x59, 0x3F, 0x00, 0x57, 0xC4, 0x90, 0x3F, 0x17, 0x90, 0x3F, 0x00, 0xC3, 0x90, 0x3F,
+0x28, 0x3F, 0x02, 0xC4, 0xBD, 0x1F, 0x05, 0x01, 0x05, 0x00, 0x5F, 0x4F, 0x45, 0x00, 0x5F, 0x4F,
+0x45, 0x00, 0x5F, 0x65, 0x45, 0x4F, 0x69, 0x50, 0x00, 0xD8, 0x41, 0x10, 0x41, 0x09, 0x41, 0x10,
+0x41, 0x09, 0x10, 0x41, 0x15, 0x10, 0x1B, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x15, 0x41, 0x10,
+0x41, 0x10, 0x04, 0x0A, 0x45, 0x00, 0x4F, 0xCC, 0x63, 0x75, 0x2B, 0x11, 0x32, 0x3B, 0x11, 0x42,
+0x2F, 0x2A, 0x5C, 0x2A, 0x11, 0x01, 0x6A, 0xC9, 0xDB, 0x11, 0x32, 0xC9, 0x32, 0x42, 0x3B, 0x59,
+0x26, 0x36, 0x00, 0x66, 0x72, 0x4A, 0xD4, 0x89, 0x32, 0xBD, 0x64, 0x4A, 0x1C, 0x32, 0x63, 0x0A,
+0x4A, 0xBD, 0x23, 0x0E, 0x03, 0x89, 0x36, 0x30, 0x3B, 0xE6, 0xA6, 0x42, 0x00, 0x6B, 0xC5, 0xC4,
+0xC2, 0x64, 0x3B, 0x11, 0x2F, 0x01, 0x51, 0x00, 0xC7, 0xC2, 0x34, 0x3E, 0x3B, 0x6C, 0x59, 0x27,
+0x05, 0x00, 0x41, 0x4E, 0x46, 0xE0, 0x04, 0xC4, 0x68, 0x01, 0x05, 0x01, 0x05, 0x01, 0x41, 0x45,
+0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x04, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x42,
+0x45, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x04, 0x41, 0x45, 0x01,
+0x41, 0x45, 0x00, 0x42, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41,
+0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x42, 0x45, 0x5F, 0x45, 0x4F, 0x45,
+0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45,
+0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45,
+0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45,
+0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x5F, 0x45, 0x61, 0x45, 0x5F, 0x45, 0x4F, 0x5F,
+0x45, 0x02, 0x42, 0x45, 0x00, 0x5F, 0x4F, 0x45, 0x01, 0x5F, 0x45, 0x03, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x01, 0x52, 0x4B, 0x00, 0x40, 0x4B, 0x40, 0x01, 0x4B, 0x40, 0x0E,
+0x6D, 0xC0, 0x6C, 0x00, 0xC1, 0xE7, 0x00, 0x1A, 0x41, 0x40, 0x18, 0x6D, 0xC1, 0x9F, 0x19, 0x04,
+0xC1, 0x43, 0x19, 0x00, 0xC1, 0xC8, 0x00, 0x0E, 0x71, 0x58, 0x05, 0xC3, 0xAE, 0x18, 0x1F, 0x18,
+0x01, 0xC1, 0x67, 0x5B, 0x00, 0xC2, 0xCE, 0x5B, 0x14, 0x01, 0xC1, 0x67, 0x14, 0x00, 0xC0, 0x5B,
+0x00, 0xC1, 0xCE, 0x5B, 0x00, 0x54, 0xC6, 0x5B, 0x67, 0x93, 0x40, 0x0F, 0x22, 0x1E, 0x00, 0xC7,
+0x93, 0x40, 0x0F, 0xA2, 0x93, 0x22, 0x1E, 0x40, 0x00, 0x4F, 0x00, 0x40, 0x0F, 0xC2, 0xAF, 0x1B,
+0x09, 0x08, 0x55, 0x49, 0x01, 0xC2, 0x41, 0x10, 0x09, 0x05, 0xC2, 0x62, 0x1B, 0x02, 0x0A, 0x41,
+0x40, 0x00, 0xC3, 0x63, 0x5C, 0x11, 0x2A, 0x01, 0xC7, 0x42, 0x11, 0x2A, 0x11, 0x42, 0x11, 0x42,
+0x11, 0x00, 0xC6, 0x42, 0x11, 0x2B, 0xDB, 0x2B, 0x2A, 0x42, 0x01, 0x6B, 0x00, 0x51, 0xC0, 0x42,
+0x00, 0x51, 0x7E, 0x72, 0xD1, 0x4A, 0x11, 0x3B, 0x84, 0x32, 0x4A, 0x11, 0x3B, 0x3E, 0xC9, 0x11,
+0x32, 0x11, 0x32, 0x35, 0x32, 0x0E, 0x3E, 0x00, 0x4E, 0xC4, 0x84, 0x3E, 0x11, 0x2A, 0x11, 0x01,
+0x7B, 0xC2, 0x6C, 0x11, 0x2F, 0x00, 0x6A, 0x00, 0xC3, 0x5C, 0xBC, 0x95, 0x00, 0x02, 0x4E, 0x46,
+0x03, 0xC1, 0x73, 0x06, 0x02, 0xC1, 0x73, 0x06, 0x0A, 0xC1, 0x73, 0x06, 0x04, 0xC0, 0x73, 0x00,
+0x46, 0x01, 0xC2, 0x73, 0x06, 0x73, 0x00, 0x46, 0x1D, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x4F, 0x40, 0x4B, 0x00, 0x40,
+0x52, 0x40, 0x02, 0x41, 0x40, 0x01, 0x4B, 0x40, 0x01, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x71, 0x41, 0x4B, 0x7A, 0x45, 0xC1, 0x4F, 0x00, 0x02,
+0x61, 0x68, 0x41, 0x40, 0x45, 0x41, 0x40, 0x02, 0x45, 0x41, 0x40, 0x45, 0x5F, 0x40, 0x6D, 0xC4,
+0xC7, 0xE7, 0x12, 0x27, 0x00, 0x00, 0x41, 0x40, 0x00, 0x41, 0x45, 0x40, 0x12, 0x41, 0x40, 0x18,
+0x67, 0xC1, 0x9F, 0x19, 0x01, 0xC0, 0x43, 0x00, 0xC0, 0x5F, 0x00, 0x59, 0xC2, 0x43, 0xC8, 0x00,
+0x0E, 0x71, 0x58, 0x00, 0xC1, 0x8E, 0x8C, 0x00, 0xC0, 0x8E, 0x00, 0x5F, 0xC0, 0x8E, 0x01, 0x58,
+0x00, 0xC1, 0x67, 0x14, 0x01, 0xC1, 0x67, 0x14, 0x01, 0xC0, 0x52, 0x00, 0xC3, 0x67, 0x14, 0x52,
+0x14, 0x00, 0xC8, 0x5B, 0x52, 0x14, 0x67, 0x22, 0x93, 0x40, 0x22, 0x3F, 0x01, 0xC6, 0x90, 0x0F,
+0x90, 0x22, 0x0F, 0x22, 0x40, 0x00, 0x62, 0x4F, 0x52, 0x4B, 0x40, 0x0D, 0xC2, 0xDA, 0x10, 0x09,
+0x07, 0x50, 0xC1, 0xA5, 0x10, 0x01, 0xC3, 0x82, 0xA5, 0x10, 0x09, 0x01, 0x55, 0x49, 0x01, 0x50,
+0x69, 0x42, 0x09, 0x41, 0x40, 0x00, 0xC3, 0xCE, 0x6C, 0x11, 0x2B, 0x00, 0xC8, 0x42, 0x2B, 0x42,
+0xA7, 0x58, 0xC9, 0x11, 0x5C, 0x11, 0x01, 0xC1, 0xDB, 0x11, 0x00, 0xCB, 0x42, 0x11, 0xDB, 0x42,
+0x2A, 0x2B, 0xDB, 0x2A, 0x2B, 0x11, 0x42, 0x11, 0x01, 0xC5, 0x42, 0x11, 0x2F, 0x11, 0x4A, 0x11,
+0x01, 0x6F, 0x6A, 0xC8, 0xDB, 0x42, 0x32, 0x4A, 0x50, 0x21, 0x47, 0x12, 0x00, 0x00, 0xC2, 0x4F,
+0x44, 0x11, 0x00, 0x6F, 0xC3, 0x84, 0x6C, 0x3B, 0x11, 0x00, 0xC1, 0x5C, 0x11, 0x01, 0xC2, 0x6C,
+0x95, 0x00, 0x02, 0x4A, 0x46, 0x63, 0xD4, 0x8D, 0x73, 0x06, 0xEB, 0x0E, 0x35, 0x77, 0xEB, 0x68,
+0x0C, 0x06, 0x73, 0x0E, 0x0C, 0x73, 0x23, 0x0E, 0x73, 0x23, 0x0C, 0x06, 0x04, 0x63, 0xC1, 0xB5,
+0x06, 0x0A, 0xC1, 0x73, 0x06, 0x19, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x00, 0x45, 0x41, 0x01, 0x40, 0x41,
+0x40, 0x41, 0x4B, 0x67, 0x40, 0x45, 0x41, 0x40, 0x00, 0x41, 0x45, 0x40, 0x52, 0x4B, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x48, 0xC6, 0x49, 0x0B, 0x0A, 0x03, 0x0A,
+0x05, 0x00, 0x00, 0x65, 0x4E, 0x44, 0x48, 0x44, 0x4A, 0x43, 0x40, 0x01, 0x42, 0x4A, 0x43, 0x44,
+0x48, 0x00, 0x4F, 0x40, 0x41, 0x40, 0x52, 0x71, 0x4F, 0x4E, 0x69, 0x40, 0x45, 0x4A, 0x48, 0x44,
+0x40, 0x11, 0x41, 0x40, 0x18, 0x6D, 0xC6, 0x9F, 0x19, 0x43, 0x2A, 0x75, 0xBC, 0x75, 0x00, 0x59,
+0xC3, 0x43, 0xC8, 0x12, 0x00, 0x0D, 0x71, 0xC9, 0xDA, 0x18, 0x8C, 0xCF, 0x98, 0x8C, 0x98, 0x96,
+0x74, 0x98, 0x00, 0xC8, 0xAD, 0x18, 0x9D, 0x5E, 0x32, 0x14, 0xA9, 0xC2, 0x3E, 0x00, 0x74, 0xD7,
+0x9B, 0x52, 0x9B, 0x34, 0x3B, 0x52, 0x83, 0xC2, 0x14, 0x67, 0x22, 0x93, 0x40, 0x28, 0x26, 0x23,
+0x37, 0x26, 0x36, 0x30, 0x3F, 0x54, 0x26, 0x40, 0x00, 0x62, 0x4F, 0x40, 0x0F, 0xC3, 0xAF, 0x10,
+0x15, 0x09, 0x04, 0x50, 0xC0, 0x78, 0x00, 0xC7, 0xA5, 0x1A, 0x33, 0x1A, 0x78, 0x66, 0xA5, 0x09,
+0x05, 0x5B, 0x42, 0x06, 0x44, 0x63, 0x44, 0x42, 0x6D, 0x40, 0x00, 0xC4, 0x95, 0x75, 0x11, 0xC2,
+0x3E, 0x00, 0xC6, 0x64, 0x2B, 0x3B, 0x9A, 0xEF, 0xA7, 0x2F, 0x00, 0x51, 0xC1, 0xDB, 0x11, 0x00,
+0xCD, 0x42, 0xC9, 0x2B, 0x32, 0x11, 0x2A, 0x11, 0x2A, 0x11, 0x2A, 0x42, 0x11, 0x2B, 0x11, 0x03,
+0x6F, 0x51, 0x02, 0x6F, 0x00, 0x51, 0x00, 0x72, 0x7E, 0xC1, 0x70, 0x16, 0x00, 0xC0, 0x6D, 0x00,
+0x56, 0xC5, 0x96, 0x21, 0x84, 0x2F, 0x3B, 0x2F, 0x00, 0x51, 0x01, 0x7B, 0x74, 0x7E, 0xC3, 0x64,
+0x11, 0x95, 0x00, 0x02, 0x4E, 0x46, 0x48, 0x42, 0x75, 0x46, 0x4C, 0xC3, 0x44, 0x08, 0x0A, 0x0E,
+0x00, 0xCD, 0x92, 0x06, 0x4A, 0x03, 0x44, 0x23, 0x05, 0x0A, 0x23, 0x04, 0x03, 0x23, 0x08, 0x0A,
+0x00, 0x4C, 0xCA, 0x68, 0x01, 0x0E, 0x06, 0x73, 0x0E, 0x08, 0x0E, 0x0A, 0x68, 0x0A, 0x00, 0x75,
+0x4E, 0x00, 0x75, 0x46, 0x19, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x4F, 0x40, 0xC1, 0x4F, 0x08, 0x00, 0x43, 0x44, 0x40,
+0x48, 0x41, 0x00, 0x40, 0x00, 0x5C, 0x4A, 0x48, 0x40, 0x41, 0x43, 0x4A, 0x42, 0x40, 0x00, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x41, 0xC7, 0x53, 0x49, 0x02, 0x50, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x65, 0x4E, 0x43, 0x4A, 0x48, 0x41, 0x48, 0x41, 0x40, 0x00, 0x48, 0x41,
+0x48, 0x42, 0x67, 0xC2, 0x53, 0x0F, 0x00, 0x00, 0x71, 0x40, 0x00, 0x45, 0x48, 0x42, 0x40, 0x41,
+0x00, 0x43, 0x44, 0x40, 0x11, 0x41, 0x40, 0x18, 0x52, 0xC5, 0x43, 0x19, 0x5F, 0x75, 0x6C, 0x2A,
+0x00, 0xC4, 0x75, 0x19, 0x5F, 0xC8, 0x00, 0x0E, 0x71, 0xC1, 0x8E, 0x18, 0x00, 0xC7, 0x74, 0xAD,
+0xAE, 0x74, 0x92, 0x18, 0x8E, 0x74, 0x00, 0x58, 0xCA, 0x67, 0x14, 0xC2, 0x71, 0x34, 0x3B, 0x34,
+0x3E, 0x64, 0x71, 0x34, 0x00, 0xDA, 0xA1, 0x71, 0x34, 0x52, 0x3B, 0x14, 0x67, 0x93, 0x40, 0x22,
+0x1E, 0x22, 0x5A, 0x40, 0x22, 0x4A, 0x3F, 0x90, 0x58, 0x26, 0x1E, 0x40, 0x22, 0x0F, 0x00, 0x0B,
+0x00, 0x0D, 0x65, 0x55, 0x49, 0x05, 0x50, 0xC5, 0x72, 0x1A, 0x1B, 0x78, 0x72, 0x33, 0x00, 0x5A,
+0x73, 0xC4, 0x41, 0x09, 0x97, 0x15, 0x09, 0x01, 0x50, 0x69, 0x42, 0x05, 0xC5, 0x44, 0x0E, 0x04,
+0x02, 0x01, 0x00, 0x00, 0xCC, 0x63, 0x75, 0x3B, 0x53, 0x4C, 0x65, 0x4C, 0x71, 0x2B, 0x2A, 0x84,
+0x4A, 0x11, 0x02, 0xC3, 0x42, 0x11, 0x32, 0x11, 0x00, 0xC4, 0x42, 0x11, 0xDB, 0x2A, 0x11, 0x00,
+0xC8, 0x5C, 0x42, 0x11, 0x2A, 0x42, 0x2B, 0x11, 0x2A, 0x11, 0x00, 0xC6, 0x5C, 0x11, 0x5C, 0x2F,
+0x11, 0x2F, 0x11, 0x00, 0x72, 0x4E, 0xC2, 0x6D, 0x51, 0x4F, 0x00, 0xCD, 0xAA, 0x1F, 0x51, 0x1C,
+0x84, 0x4A, 0x95, 0x5A, 0x54, 0xA7, 0x3B, 0x34, 0x76, 0x7A, 0x00, 0xC3, 0x67, 0x34, 0x63, 0x00,
+0x02, 0x4E, 0x46, 0xC8, 0x68, 0x0A, 0x0C, 0x06, 0x73, 0x35, 0x08, 0x0C, 0x03, 0x00, 0xCB, 0x68,
+0x06, 0xEB, 0x32, 0x92, 0x23, 0x03, 0x08, 0x53, 0x23, 0x0A, 0x03, 0x00, 0x44, 0x48, 0xD1, 0x53,
+0x0E, 0x51, 0x53, 0x06, 0x73, 0x04, 0x58, 0x04, 0x03, 0x23, 0x64, 0x02, 0x35, 0x08, 0x1C, 0x73,
+0x06, 0x19, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x41, 0x61, 0xD6, 0x49, 0x02, 0x03, 0x02, 0x03, 0x00, 0x01,
+0x00, 0x27, 0x01, 0x02, 0x0A, 0x31, 0x2D, 0x4F, 0x08, 0x04, 0x00, 0x0B, 0x01, 0x00, 0x02, 0x00,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x44, 0x4E, 0x00, 0x48, 0xC4, 0x50, 0x00, 0x44, 0x60, 0x00,
+0x00, 0x65, 0x4A, 0x41, 0xC5, 0x49, 0x0A, 0x01, 0x0A, 0x01, 0x00, 0x00, 0x48, 0x45, 0x43, 0x42,
+0x43, 0x42, 0x40, 0x05, 0x44, 0x42, 0x40, 0x00, 0x44, 0x00, 0x4B, 0x67, 0x40, 0x10, 0x41, 0x40,
+0x18, 0x41, 0xC4, 0x9F, 0x19, 0x9F, 0x5F, 0x75, 0x00, 0xC6, 0x6C, 0x2A, 0x5F, 0x19, 0xC8, 0x0B,
+0x00, 0x0D, 0x71, 0x58, 0x01, 0xC3, 0x98, 0xAD, 0xAE, 0x98, 0x00, 0xC1, 0xEA, 0x74, 0x00, 0x58,
+0x00, 0xC4, 0x9D, 0x5E, 0x64, 0x3B, 0x64, 0x00, 0x74, 0xCC, 0x53, 0x52, 0x64, 0x3B, 0x34, 0x67,
+0x71, 0x9B, 0x67, 0x9B, 0x76, 0x67, 0x93, 0x00, 0xC1, 0x40, 0x22, 0x00, 0xCC, 0x54, 0x40, 0x3F,
+0x54, 0x30, 0x1E, 0x36, 0x26, 0x1E, 0x40, 0x22, 0x0F, 0x00, 0x0F, 0xC2, 0xDA, 0x10, 0x09, 0x06,
+0xC3, 0xA5, 0x1A, 0x10, 0x78, 0x00, 0x5A, 0xC7, 0x98, 0x33, 0x70, 0x15, 0x09, 0x97, 0x15, 0x09,
+0x01, 0x5B, 0x42, 0x06, 0x68, 0x4A, 0x43, 0x42, 0x71, 0x40, 0x00, 0xC4, 0xCE, 0x6C, 0xA9, 0xB8,
+0xAF, 0x00, 0xD2, 0xB8, 0x56, 0x34, 0x2A, 0x2B, 0x11, 0x42, 0x11, 0x32, 0x42, 0x11, 0x32, 0xDB,
+0x32, 0x11, 0x32, 0x11, 0x2B, 0x11, 0x01, 0x6F, 0x51, 0x00, 0xC1, 0x42, 0x11, 0x03, 0x6A, 0x51,
+0x00, 0x6F, 0xC1, 0x8F, 0x2F, 0x00, 0x51, 0x6B, 0x72, 0xC1, 0x4A, 0x0E, 0x00, 0xC2, 0x63, 0x59,
+0x58, 0x00, 0x7E, 0x00, 0x6F, 0x51, 0x7F, 0x66, 0xC0, 0xA4, 0x00, 0xC3, 0x64, 0x76, 0xD8, 0x6B,
+0x00, 0xC0, 0x4C, 0x00, 0xC1, 0x44, 0x00, 0x00, 0x4B, 0x40, 0x4E, 0xCB, 0x73, 0x36, 0x51, 0x0E,
+0x35, 0x0E, 0x03, 0x04, 0x73, 0x04, 0x03, 0x06, 0x00, 0x4C, 0x45, 0xD3, 0x64, 0x23, 0x0A, 0x03,
+0x0A, 0x04, 0x03, 0x0A, 0x0E, 0x0A, 0x0E, 0x08, 0x04, 0x50, 0x02, 0x68, 0x73, 0x60, 0x8D, 0x0A,
+0x00, 0x48, 0xC6, 0x44, 0x02, 0x0C, 0x50, 0x1C, 0x68, 0x06, 0x19, 0x75, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x4F, 0x40, 0xC2,
+0x4F, 0x05, 0x04, 0x01, 0x4E, 0x45, 0x40, 0x41, 0x4B, 0x40, 0x42, 0x41, 0x48, 0x45, 0x41, 0x61,
+0x45, 0x70, 0x40, 0x00, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x43, 0x4F,
+0x71, 0x48, 0xC4, 0x86, 0x08, 0x53, 0x01, 0x00, 0x00, 0x41, 0x4A, 0x48, 0x44, 0x42, 0x48, 0x44,
+0x40, 0x01, 0x68, 0x4A, 0xC8, 0x44, 0x04, 0x0E, 0x03, 0x01, 0x00, 0x12, 0x0B, 0x00, 0x01, 0x42,
+0x00, 0x41, 0x42, 0x4E, 0x43, 0x42, 0x40, 0x11, 0x41, 0x52, 0x40, 0x17, 0x52, 0xC1, 0x9F, 0x19,
+0x00, 0xC0, 0x5F, 0x01, 0x6A, 0xC1, 0x75, 0x43, 0x00, 0xC1, 0xC8, 0x00, 0x0E, 0x71, 0xC1, 0x8E,
+0x18, 0x00, 0xC1, 0xAD, 0x8C, 0x00, 0xDF, 0xAD, 0x8C, 0x98, 0xCF, 0x74, 0x8C, 0x18, 0x9D, 0x52,
+0x3E, 0x34, 0x71, 0x3E, 0x34, 0x71, 0x9B, 0x34, 0x52, 0x34, 0x64, 0x34, 0x52, 0x67, 0x34, 0x14,
+0x67, 0x90, 0x40, 0x22, 0x40, 0x22, 0x58, 0xC7, 0x40, 0x58, 0x90, 0x30, 0x90, 0x37, 0x36, 0x40,
+0x00, 0x62, 0x4F, 0x40, 0x4B, 0x40, 0x0D, 0xC2, 0xAF, 0x10, 0x09, 0x06, 0xC1, 0x7B, 0x33, 0x03,
+0xC0, 0xCF, 0x00, 0x50, 0x49, 0x05, 0x50, 0x69, 0x42, 0x06, 0x48, 0x44, 0x42, 0x6D, 0x40, 0x00,
+0xD4, 0x63, 0x3B, 0x76, 0xD8, 0x2D, 0x27, 0xAF, 0x4C, 0x3E, 0x42, 0x2A, 0x11, 0xA7, 0x95, 0xA4,
+0x89, 0xA4, 0x3F, 0x95, 0x3F, 0xA4, 0x00, 0xC2, 0x84, 0xDB, 0x11, 0x00, 0x6F, 0x00, 0x51, 0x01,
+0x72, 0x51, 0x01, 0x6F, 0xC0, 0x8F, 0x00, 0xC1, 0x5C, 0x11, 0x06, 0x72, 0x6B, 0x72, 0x01, 0xD2,
+0xA6, 0x32, 0x2B, 0x11, 0x2F, 0x58, 0x60, 0xA4, 0x36, 0xC2, 0x65, 0x6B, 0xD3, 0x2D, 0x7C, 0x56,
+0xB8, 0x00, 0x0B, 0x00, 0x40, 0x4E, 0x46, 0x4C, 0xC7, 0x64, 0x73, 0x0C, 0x68, 0x0E, 0x35, 0x06,
+0x35, 0x00, 0x46, 0x00, 0x75, 0x4E, 0x00, 0xC7, 0x68, 0x0E, 0x0C, 0x06, 0x0E, 0x0C, 0x68, 0x35,
+0x00, 0xC9, 0x68, 0x23, 0x0C, 0x06, 0xC4, 0x68, 0x06, 0x0C, 0x68, 0x35, 0x01, 0x4E, 0x63, 0x4C,
+0x75, 0x01, 0x46, 0x19, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07,
+0x65, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x4F, 0xC5, 0x6D, 0x26, 0x0F, 0x05, 0x08, 0x00,
+0x00, 0x41, 0x40, 0x00, 0x42, 0x48, 0xCB, 0x44, 0x0F, 0x1F, 0x03, 0x08, 0x02, 0x00, 0x0B, 0x01,
+0x00, 0x02, 0x00, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x40, 0x45, 0x43, 0x00,
+0x42, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x44, 0x43, 0x00, 0x45, 0x40, 0x67, 0x40, 0x00, 0x41,
+0x40, 0x0A, 0x41, 0x4B, 0x40, 0x01, 0x71, 0x40, 0x52, 0x40, 0x52, 0x40, 0x52, 0x40, 0x52, 0x40,
+0x52, 0x40, 0x52, 0x40, 0x00, 0x4B, 0x41, 0x67, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B,
+0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B,
+0x40, 0x41, 0xC1, 0x9F, 0x19, 0x05, 0xC3, 0x43, 0x19, 0xD2, 0x00, 0x0C, 0x4B, 0x40, 0x71, 0x5F,
+0x58, 0x07, 0xC6, 0x8E, 0x18, 0x1F, 0x44, 0x14, 0x5B, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x01, 0xC0,
+0x5B, 0x00, 0x54, 0x00, 0xC8, 0x5B, 0x14, 0xAC, 0x14, 0x67, 0xEF, 0x40, 0x22, 0x40, 0x01, 0x62,
+0xC0, 0x40, 0x01, 0x62, 0xC0, 0x40, 0x00, 0x62, 0xC3, 0x40, 0x0F, 0x1E, 0x00, 0x0D, 0x52, 0x40,
+0xC1, 0xDA, 0x10, 0x00, 0x49, 0x09, 0xC1, 0x41, 0x09, 0x05, 0x55, 0x49, 0x01, 0x5B, 0x69, 0x42,
+0x09, 0x41, 0x52, 0x40, 0xD8, 0x59, 0x11, 0x76, 0x6B, 0x47, 0x0B, 0x6B, 0x4C, 0x34, 0x2B, 0x5C,
+0x42, 0x63, 0x89, 0x5A, 0xD2, 0xB0, 0x3E, 0xB0, 0x58, 0xB0, 0x3F, 0x36, 0x2A, 0x11, 0x00, 0x6F,
+0x51, 0x72, 0x51, 0x6B, 0x00, 0x6F, 0x7B, 0xC8, 0x5C, 0x8F, 0x2F, 0x11, 0x42, 0x2B, 0x42, 0x2B,
+0x11, 0x05, 0x72, 0x51, 0x7B, 0x51, 0xD5, 0x42, 0x11, 0xDB, 0xB0, 0xA4, 0x84, 0x85, 0xA7, 0xC2,
+0x65, 0xC0, 0x2D, 0x31, 0x7C, 0x56, 0x9D, 0x00, 0x12, 0x2D, 0x00, 0x0E, 0x06, 0x0A, 0xC1, 0x73,
+0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x4F, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x03, 0x4B,
+0x40, 0x01, 0x4F, 0x4B, 0x00, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40,
+0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x00, 0x40, 0x00,
+0x41, 0xCD, 0x47, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00,
+0x01, 0x71, 0x40, 0x2C, 0x41, 0x40, 0x00, 0x4B, 0x67, 0x40, 0x03, 0x41, 0x40, 0x01, 0x67, 0x40,
+0x00, 0x4B, 0x40, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x06, 0x41, 0x00, 0x45, 0x41, 0x40, 0x04, 0x41, 0x45, 0x00, 0x40, 0x25, 0xC1, 0x47, 0x00,
+0x18, 0x6D, 0xC1, 0x9F, 0x19, 0x04, 0xC0, 0x43, 0x00, 0x59, 0xC1, 0xC8, 0x00, 0x0E, 0x71, 0xC0,
+0xAE, 0x01, 0x58, 0xC5, 0xAE, 0x18, 0xAE, 0x18, 0xAE, 0x18, 0x01, 0x5F, 0x5C, 0x54, 0x01, 0xC1,
+0x5B, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x03, 0xC1, 0x67, 0x14, 0x01, 0xC2, 0x89, 0x93, 0x1E, 0x0B,
+0xC3, 0x40, 0x1E, 0x01, 0x00, 0x0F, 0xDC, 0xAF, 0x1B, 0x15, 0x41, 0x1B, 0x15, 0x41, 0x1B, 0x15,
+0x41, 0x1B, 0x15, 0x41, 0x1B, 0x15, 0x1B, 0x41, 0x15, 0x41, 0x1B, 0x15, 0x41, 0x15, 0x1B, 0x09,
+0x10, 0x1B, 0x29, 0x02, 0x06, 0x61, 0x42, 0x00, 0x40, 0x01, 0xD8, 0x63, 0x11, 0x9B, 0x65, 0xAF,
+0x4F, 0xB8, 0x76, 0x3B, 0x2B, 0x5C, 0x42, 0x36, 0xB0, 0x42, 0xA6, 0x23, 0xC2, 0x23, 0x42, 0x2B,
+0x58, 0x36, 0x2A, 0x11, 0x00, 0xC5, 0x4A, 0x2F, 0x32, 0x11, 0x42, 0x32, 0x00, 0x51, 0xC5, 0x8F,
+0x84, 0x64, 0x3E, 0x63, 0x50, 0x00, 0x7E, 0x6F, 0x51, 0x6F, 0x51, 0x01, 0x6F, 0x7B, 0x6F, 0x51,
+0x01, 0x6F, 0x00, 0x51, 0xCC, 0x4A, 0xDB, 0x11, 0x2A, 0x32, 0x71, 0x6B, 0x0B, 0xAF, 0xB8, 0x76,
+0x44, 0x00, 0x02, 0x4E, 0x46, 0xE0, 0x04, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x11, 0x4B, 0x40, 0x29, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x02, 0x48, 0x00, 0x43, 0x01, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x05,
+0x48, 0x43, 0x01, 0x48, 0x43, 0x03, 0x48, 0x43, 0x01, 0x48, 0x43, 0xC2, 0x59, 0x0A, 0x3E, 0x00,
+0xC1, 0x58, 0x03, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0xC3, 0x58, 0x30, 0x58,
+0x30, 0x00, 0xC1, 0x58, 0x30, 0x00, 0xC1, 0x58, 0x30, 0x00, 0xC2, 0x58, 0x30, 0x58, 0x01, 0xDD,
+0x86, 0x76, 0x53, 0x6A, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53,
+0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x11, 0x2A, 0x03, 0xC0,
+0x75, 0x00, 0x6A, 0xC2, 0x75, 0x9B, 0x03, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43,
+0x01, 0x48, 0x43, 0x48, 0xC2, 0x74, 0x98, 0x74, 0x05, 0x48, 0xC0, 0x74, 0x00, 0xC1, 0x70, 0x3E,
+0x00, 0x4A, 0x7E, 0x01, 0xC1, 0x71, 0x3E, 0x01, 0xC1, 0x71, 0x3E, 0x04, 0x4A, 0x7E, 0x70, 0xCB,
+0x58, 0x30, 0x08, 0x30, 0x58, 0x30, 0x08, 0x30, 0x58, 0x30, 0x08, 0x30, 0x01, 0x48, 0x70, 0x43,
+0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48, 0xC3, 0x6D, 0x1A,
+0xAB, 0x1A, 0x00, 0xC1, 0x72, 0x1A, 0x06, 0xC1, 0x72, 0x1A, 0x06, 0xC1, 0x72, 0x1A, 0x01, 0x4A,
+0x0A, 0x48, 0x43, 0xD1, 0x6D, 0x59, 0xBC, 0x2A, 0xA9, 0x44, 0x4C, 0x50, 0x64, 0x2B, 0x11, 0x2A,
+0x42, 0xA4, 0x3E, 0x32, 0x71, 0x9D, 0x00, 0xC7, 0x50, 0x9B, 0x2A, 0x58, 0x36, 0x2A, 0x2F, 0x32,
+0x00, 0x63, 0xCB, 0x5A, 0x58, 0xB0, 0x59, 0x26, 0x59, 0x8F, 0x84, 0x0A, 0x51, 0xAF, 0x7C, 0x00,
+0x69, 0xC6, 0x5A, 0x11, 0x5C, 0x2F, 0x11, 0x2A, 0x11, 0x00, 0x6F, 0x51, 0x6F, 0x04, 0x51, 0x00,
+0xC4, 0x8F, 0x4A, 0x3B, 0x76, 0x7C, 0x00, 0xC5, 0x50, 0x9C, 0x3E, 0x26, 0x6D, 0x03, 0x00, 0x4E,
+0xC0, 0x68, 0x09, 0xC0, 0xB5, 0x01, 0xC1, 0xEB, 0xB5, 0x01, 0xC1, 0xEB, 0xB5, 0x01, 0xC1, 0xEB,
+0xB5, 0x01, 0xC1, 0xEB, 0xB5, 0x01, 0xC1, 0xEB, 0xB5, 0x01, 0xC1, 0xEB, 0xB5, 0x03, 0xC1, 0x68,
+0xB5, 0x0B, 0xC0, 0x68, 0x00, 0x75, 0xC0, 0x68, 0x0B, 0x4C, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0xD0, 0x74, 0x08, 0x74, 0x08, 0x74, 0x08,
+0x74, 0x08, 0x74, 0x08, 0x74, 0x08, 0x74, 0x26, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x01, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x01, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0xDE,
+0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76,
+0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x53, 0x76, 0x58, 0x00,
+0x70, 0xC1, 0x58, 0x30, 0x00, 0xC1, 0x58, 0x30, 0x00, 0xC1, 0x58, 0x30, 0x00, 0xC1, 0x58, 0x30,
+0x00, 0xC6, 0x58, 0x30, 0x58, 0x26, 0x50, 0x08, 0x03, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01,
+0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x01, 0x48, 0x43, 0x02, 0x48,
+0x00, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x00, 0x44, 0x41, 0x42, 0x41, 0x08,
+0x45, 0x41, 0x0D, 0x45, 0x41, 0x19, 0x5F, 0xC5, 0xB7, 0x6C, 0x2B, 0x3B, 0x05, 0x01, 0x05, 0x4F,
+0x65, 0x41, 0x5F, 0x7C, 0xC0, 0x57, 0x0D, 0xC4, 0x5B, 0xC6, 0x4B, 0xC6, 0x4B, 0x15, 0xC1, 0xC6,
+0x43, 0x00, 0x59, 0xC2, 0x43, 0x19, 0x43, 0x01, 0xC4, 0x5F, 0x43, 0xD2, 0x47, 0x01, 0x0D, 0x65,
+0x5F, 0x41, 0x06, 0x5F, 0x41, 0x00, 0x67, 0x45, 0x41, 0x03, 0x67, 0x41, 0x00, 0x67, 0x41, 0x00,
+0x67, 0x41, 0x03, 0x4F, 0x5F, 0x41, 0x0D, 0x45, 0x65, 0x41, 0x0E, 0x69, 0xD4, 0xA5, 0x62, 0x7B,
+0xA5, 0x7B, 0xA5, 0x7B, 0xA5, 0x7B, 0xA5, 0x7B, 0xA5, 0x7B, 0xA5, 0x7B, 0xA5, 0x7B, 0xA5, 0x7B,
+0xA5, 0x7B, 0x00, 0xC4, 0xA5, 0x7B, 0xA5, 0x10, 0x04, 0x0A, 0x4F, 0x41, 0xC5, 0x47, 0x63, 0xBC,
+0x2A, 0x32, 0x3B, 0x00, 0x51, 0x6B, 0x00, 0xCE, 0xDB, 0x2A, 0x42, 0x95, 0x86, 0x3B, 0xD4, 0xE9,
+0xC0, 0xD4, 0x52, 0x3B, 0x5A, 0xA4, 0x11, 0x00, 0xC4, 0x58, 0x86, 0x59, 0x0E, 0x23, 0x00, 0xC0,
+0x4A, 0x00, 0xCB, 0x89, 0xA7, 0x2F, 0x3E, 0x8A, 0xB7, 0x8A, 0x7C, 0x1C, 0x0E, 0x42, 0x11, 0x00,
+0x72, 0x51, 0x01, 0x72, 0x51, 0x6B, 0x6A, 0x51, 0x00, 0x6F, 0x02, 0xC3, 0xA4, 0x95, 0x32, 0x3B,
+0x00, 0xC5, 0x64, 0x3B, 0x11, 0x95, 0x27, 0x01, 0x01, 0x42, 0x09, 0x69, 0xC4, 0x8C, 0x10, 0x15,
+0x09, 0x15, 0x11, 0x50, 0xC6, 0x41, 0x7A, 0x94, 0x7A, 0xBE, 0x94, 0x7A, 0x0A, 0xC3, 0x65, 0x25,
+0x0B, 0x00, 0x0C, 0x41, 0x65, 0x41, 0x0F, 0xC0, 0x8E, 0x0C, 0x41, 0x0F, 0x45, 0x41, 0x03, 0x65,
+0x41, 0x00, 0x67, 0xC1, 0xDC, 0x4B, 0x1A, 0xC3, 0xC6, 0x5B, 0x69, 0x57, 0x0D, 0xC2, 0x69, 0x17,
+0x01, 0x2B, 0x45, 0x41, 0x07, 0x45, 0x41, 0x0B, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x1A, 0x6D, 0xC0, 0x6C, 0x00, 0xC2, 0xF8, 0x12, 0x00, 0x06, 0x4B, 0x71, 0x52, 0xCA, 0xB3,
+0x57, 0x1D, 0x2C, 0x3C, 0x2C, 0x1D, 0x2C, 0x1D, 0x57, 0x1D, 0x00, 0xC1, 0x57, 0x2C, 0x00, 0xC2,
+0x57, 0x67, 0x07, 0x01, 0x4D, 0x04, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x07, 0x47,
+0x78, 0x59, 0x06, 0xC3, 0x43, 0x19, 0xD2, 0x00, 0x0E, 0x71, 0x6D, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x67, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x02, 0x50, 0x49, 0x08, 0xC1,
+0x41, 0x09, 0x02, 0x55, 0x49, 0x01, 0x50, 0x42, 0x0A, 0xC1, 0x47, 0x00, 0x00, 0x76, 0xC1, 0xBC,
+0x2A, 0x00, 0x6B, 0x00, 0x6A, 0xC1, 0x42, 0x84, 0x00, 0x6A, 0xCF, 0x42, 0x36, 0x86, 0x71, 0x6B,
+0xD3, 0x2D, 0x6B, 0x4C, 0x64, 0x5A, 0x95, 0x11, 0x4A, 0x03, 0x04, 0x00, 0x4E, 0xD3, 0x68, 0x77,
+0x35, 0x77, 0x26, 0x5A, 0x8F, 0x3B, 0x0E, 0x3B, 0x32, 0x34, 0x4A, 0x32, 0xA6, 0x3B, 0x32, 0x3B,
+0x42, 0x32, 0x00, 0x7B, 0x51, 0xC0, 0x42, 0x00, 0x51, 0x6F, 0x00, 0x51, 0xC5, 0x89, 0xA4, 0x9A,
+0x84, 0x4A, 0x11, 0x01, 0x6F, 0xC2, 0xBC, 0x95, 0x00, 0x02, 0x45, 0x42, 0x08, 0x69, 0x50, 0x55,
+0x00, 0x49, 0x05, 0x55, 0x49, 0x03, 0x55, 0x49, 0x03, 0x55, 0x49, 0xC2, 0x41, 0x80, 0x7D, 0x00,
+0xC7, 0xBE, 0x80, 0x13, 0x8B, 0x3D, 0x80, 0x3D, 0x8B, 0x00, 0x53, 0xC7, 0x8B, 0x13, 0x8B, 0x7D,
+0x13, 0xB7, 0x0B, 0x00, 0x0C, 0x41, 0x40, 0x10, 0x58, 0x0B, 0xC2, 0xDA, 0x31, 0x00, 0x0E, 0x41,
+0x40, 0x03, 0x4B, 0x00, 0x52, 0x40, 0xC1, 0xB2, 0x0D, 0x08, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x47,
+0x4D, 0x00, 0x47, 0x4D, 0x04, 0x47, 0x4D, 0x47, 0x6E, 0xC1, 0xA1, 0x2C, 0x00, 0x5D, 0x6C, 0x5D,
+0x6C, 0x7C, 0x6C, 0x5D, 0x6C, 0x5D, 0xC3, 0x57, 0x1D, 0x57, 0x2C, 0x00, 0x7C, 0xC2, 0xE1, 0x12,
+0x00, 0x2A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x05,
+0x42, 0x41, 0x40, 0x04, 0x41, 0x40, 0x02, 0x41, 0x42, 0x00, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40,
+0x42, 0x45, 0x40, 0x02, 0x5F, 0x45, 0x40, 0x00, 0x41, 0x40, 0x02, 0x6D, 0xC4, 0x59, 0x3A, 0x12,
+0x31, 0x00, 0x00, 0x41, 0x40, 0x01, 0x41, 0x6D, 0x4B, 0x71, 0x6D, 0x5D, 0x6C, 0xC4, 0x57, 0x1D,
+0x2C, 0x1D, 0x69, 0x00, 0x7C, 0x6C, 0xC2, 0x69, 0x57, 0x1D, 0x00, 0x6C, 0x00, 0xC1, 0x67, 0x07,
+0x00, 0x4D, 0x47, 0x05, 0x4D, 0xC3, 0x4B, 0x2E, 0x0D, 0x07, 0x00, 0xC1, 0x4B, 0x07, 0x07, 0x6E,
+0xC1, 0x43, 0x19, 0x02, 0xC1, 0x5F, 0x19, 0x00, 0xC3, 0x43, 0x19, 0xC8, 0x00, 0x0E, 0x4B, 0x41,
+0x4B, 0x40, 0x06, 0x4B, 0x00, 0x40, 0x4F, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B,
+0x40, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x0A, 0x4B, 0x40, 0x00, 0x41, 0x40, 0x0F, 0xC2, 0x4F,
+0x10, 0x09, 0x07, 0xC1, 0x7B, 0x09, 0x00, 0x50, 0x49, 0x00, 0xC2, 0x99, 0x10, 0x09, 0x05, 0x5B,
+0xC1, 0x8A, 0x02, 0x06, 0x43, 0x42, 0x00, 0x41, 0x40, 0x4B, 0xC1, 0x95, 0x11, 0x00, 0x6A, 0x00,
+0x6B, 0xD8, 0xDB, 0x42, 0xA4, 0x90, 0x2F, 0x2A, 0x63, 0x0A, 0x71, 0x6B, 0xAF, 0x01, 0x6B, 0x44,
+0xC2, 0x5A, 0xA4, 0x42, 0x4A, 0x03, 0x29, 0x04, 0x8D, 0xC4, 0x77, 0x01, 0xD4, 0x63, 0xA7, 0x8F,
+0x2A, 0x5C, 0x2F, 0x2B, 0x4A, 0x89, 0x3E, 0x42, 0x59, 0x4A, 0x63, 0x4A, 0x63, 0x23, 0x26, 0x4A,
+0x32, 0x11, 0x00, 0x6F, 0xCD, 0x8F, 0x11, 0x84, 0x59, 0xC9, 0xA7, 0xE1, 0x4A, 0x2B, 0xC9, 0x5C,
+0xBC, 0x63, 0x00, 0x00, 0x52, 0x40, 0x45, 0x42, 0x44, 0x43, 0x42, 0x44, 0x00, 0x42, 0x02, 0xC4,
+0xBD, 0x1B, 0x09, 0x62, 0x97, 0x00, 0x49, 0x50, 0x49, 0x00, 0x50, 0x00, 0x49, 0x50, 0x00, 0x49,
+0x00, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0xC5, 0x41, 0x3D, 0xCC, 0x13, 0xBE, 0x3D,
+0x00, 0x53, 0xC1, 0xCC, 0x3D, 0x00, 0xC2, 0x56, 0x13, 0x3D, 0x01, 0x53, 0xC4, 0x7D, 0x13, 0x6B,
+0x2D, 0x00, 0x0C, 0x41, 0x40, 0x10, 0xC3, 0xAE, 0x18, 0x8E, 0x8C, 0x00, 0x58, 0xC5, 0x8E, 0x18,
+0x8E, 0x18, 0x8E, 0x18, 0x01, 0x40, 0x52, 0x40, 0x0D, 0x41, 0x40, 0x03, 0x4B, 0x00, 0x40, 0x00,
+0xC2, 0xD6, 0xBA, 0x07, 0x07, 0x4D, 0xC5, 0x4B, 0x45, 0x07, 0x0D, 0x07, 0x45, 0x00, 0x4D, 0x47,
+0x04, 0x6E, 0xC6, 0xCB, 0x07, 0x0D, 0xF1, 0x1D, 0x2C, 0x57, 0x00, 0x7C, 0xC2, 0x57, 0x2C, 0x69,
+0x00, 0x7C, 0xCA, 0x57, 0x1D, 0x2C, 0x1D, 0x3C, 0x57, 0x2C, 0xE1, 0x12, 0x0B, 0x00, 0x00, 0x41,
+0x40, 0x01, 0x42, 0x41, 0x40, 0x42, 0x45, 0x40, 0x04, 0x41, 0x00, 0x40, 0x41, 0x42, 0x45, 0x40,
+0x01, 0x45, 0x42, 0x41, 0x40, 0x41, 0x40, 0x03, 0x45, 0x41, 0x40, 0x42, 0x41, 0x40, 0x00, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x03, 0x41, 0x00, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x04, 0x43, 0x00, 0x48, 0x41, 0x40, 0x03, 0x41, 0x40, 0x02, 0xC8, 0x70, 0x03, 0x02, 0x1C, 0x0E,
+0x00, 0x53, 0x60, 0x03, 0x00, 0x48, 0xC1, 0x90, 0x00, 0x00, 0x45, 0xC8, 0x70, 0x53, 0x05, 0x47,
+0x0E, 0x22, 0x00, 0x0B, 0x00, 0x05, 0x43, 0x48, 0x40, 0x00, 0x41, 0x4E, 0x45, 0x40, 0x4B, 0x52,
+0xC2, 0xB3, 0x57, 0x1D, 0x00, 0x7C, 0xC2, 0xA8, 0x91, 0x7E, 0x00, 0xC8, 0xA8, 0x54, 0x91, 0x57,
+0x3C, 0x2C, 0x57, 0xA1, 0x07, 0x07, 0xCB, 0x79, 0x46, 0xD5, 0xB1, 0x4B, 0x07, 0x45, 0xC2, 0x0D,
+0x07, 0x79, 0x07, 0x04, 0x6E, 0xC1, 0x9F, 0x19, 0x00, 0xC8, 0x5F, 0x2A, 0x75, 0x5F, 0x19, 0x43,
+0x19, 0xD2, 0x00, 0x0E, 0x67, 0x4B, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41,
+0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0x55, 0x60, 0xCC, 0x9E, 0x15, 0xAB, 0xE0, 0x15, 0x78,
+0x72, 0xAB, 0x41, 0x10, 0x09, 0x15, 0x09, 0x00, 0xC2, 0x62, 0x10, 0x02, 0x06, 0x4E, 0x4A, 0x4E,
+0x42, 0x41, 0x40, 0x00, 0xC2, 0x95, 0x75, 0x11, 0x00, 0x74, 0x7E, 0xCA, 0x64, 0x2B, 0x11, 0xA7,
+0xA4, 0x9A, 0x26, 0xB0, 0x34, 0xB8, 0x6B, 0x00, 0xC7, 0xE4, 0x53, 0x32, 0xB0, 0x95, 0x42, 0x11,
+0x26, 0x00, 0x4A, 0x4C, 0x75, 0x4C, 0x00, 0x75, 0xD7, 0x64, 0x4A, 0x2F, 0x11, 0x2A, 0x2F, 0x11,
+0x2F, 0x3F, 0x0E, 0x23, 0x0E, 0x23, 0x0E, 0x23, 0x0E, 0x23, 0x0E, 0x9E, 0x23, 0x59, 0x4A, 0x11,
+0x2F, 0x00, 0x51, 0xC1, 0x84, 0x3F, 0x00, 0xC7, 0x5A, 0x4A, 0x3E, 0x71, 0x64, 0x6C, 0x59, 0x00,
+0x02, 0x45, 0x44, 0x4E, 0x4A, 0x48, 0x4A, 0x4E, 0x43, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09, 0x04,
+0x5B, 0xC9, 0x66, 0x1A, 0x15, 0xC4, 0x1A, 0x15, 0x78, 0xCF, 0x41, 0x09, 0x04, 0xC1, 0x41, 0x13,
+0x00, 0x7D, 0x53, 0x00, 0xC5, 0x80, 0x4C, 0xC4, 0x4C, 0x76, 0x88, 0x00, 0xC4, 0x65, 0x7A, 0x13,
+0x80, 0x13, 0x00, 0xC1, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x5F, 0x58, 0xCA, 0x98, 0x6D, 0x98,
+0x96, 0x98, 0x96, 0x74, 0x8C, 0x9E, 0x8E, 0x18, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2,
+0x07, 0x08, 0x78, 0x79, 0xC4, 0x87, 0x4D, 0x38, 0x46, 0x87, 0x00, 0xC1, 0x45, 0x07, 0x08, 0xD0,
+0xA1, 0x57, 0x3C, 0xC9, 0x3C, 0xA8, 0x91, 0x85, 0x7E, 0x91, 0xBF, 0x91, 0x3C, 0x2C, 0xBF, 0xC9,
+0x3C, 0x00, 0xC1, 0xE1, 0x00, 0x00, 0x41, 0x48, 0xC1, 0x53, 0x00, 0x00, 0x43, 0x00, 0x48, 0x44,
+0x4A, 0x42, 0x40, 0x04, 0x43, 0x4E, 0x40, 0x48, 0x43, 0x48, 0x42, 0x40, 0x45, 0x4A, 0x43, 0x48,
+0x4F, 0xC9, 0x64, 0x28, 0x12, 0x31, 0xC0, 0x04, 0x49, 0x03, 0x04, 0x08, 0x00, 0x41, 0x40, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x03, 0x43, 0x4E, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x04, 0x44, 0x48, 0x44, 0x40, 0x04, 0x41, 0x40, 0x00, 0x52, 0x4B, 0xC6, 0x70, 0x49, 0x04, 0x02,
+0x0E, 0x02, 0x53, 0x00, 0x43, 0x40, 0x6D, 0x5E, 0x52, 0x40, 0x44, 0xC8, 0x44, 0x02, 0x04, 0x02,
+0x0A, 0x1F, 0x12, 0x31, 0x00, 0x04, 0x45, 0x48, 0x43, 0x40, 0x00, 0x5C, 0x4A, 0x45, 0x52, 0xC3,
+0x47, 0x2D, 0xB3, 0x2C, 0x00, 0x7C, 0x5D, 0xC8, 0x91, 0x3C, 0xB3, 0x54, 0x69, 0x3C, 0x91, 0x57,
+0x1D, 0x00, 0x6C, 0xC1, 0xA1, 0x07, 0x07, 0xCB, 0x79, 0x45, 0xBB, 0xB1, 0x38, 0xBA, 0x6E, 0xA9,
+0x38, 0x07, 0x0D, 0x07, 0x04, 0x6E, 0xC1, 0x43, 0x19, 0x00, 0xC4, 0x43, 0x2B, 0x6C, 0x5F, 0x19,
+0x01, 0xC1, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x03, 0x50, 0x5A, 0xCB, 0x66, 0x10, 0x72, 0x8D, 0x20,
+0x10, 0x20, 0x78, 0x1B, 0x09, 0x10, 0x09, 0x02, 0x5B, 0x42, 0x07, 0x44, 0x4A, 0x42, 0x41, 0x40,
+0x00, 0xD0, 0x95, 0x75, 0x9C, 0x71, 0x4C, 0xB8, 0x4C, 0x71, 0x32, 0x11, 0x9A, 0x84, 0x9A, 0xB0,
+0x11, 0x34, 0x44, 0x00, 0xC5, 0x86, 0x11, 0x42, 0xB0, 0x26, 0x11, 0x00, 0x6B, 0xC2, 0x42, 0x32,
+0x35, 0x00, 0x4C, 0x00, 0xC6, 0x77, 0x0E, 0x59, 0x89, 0xB0, 0x11, 0x2F, 0x00, 0x72, 0x63, 0x72,
+0x4C, 0x01, 0xCA, 0x77, 0x23, 0x77, 0x0C, 0x77, 0x0C, 0x77, 0x3E, 0x84, 0x2B, 0x5C, 0x00, 0x51,
+0x00, 0xC9, 0x9A, 0x5A, 0x64, 0x4C, 0x65, 0x94, 0x67, 0x34, 0x63, 0x00, 0x02, 0x45, 0x42, 0x00,
+0x4A, 0x48, 0x42, 0x4E, 0x43, 0x42, 0x02, 0x5B, 0x49, 0x05, 0xC9, 0x82, 0x66, 0x70, 0x33, 0x92,
+0x66, 0x15, 0x33, 0x92, 0x09, 0x04, 0xD5, 0x62, 0x41, 0x7D, 0x3D, 0x13, 0x8B, 0x13, 0x8B, 0x6F,
+0x88, 0x71, 0xA9, 0x44, 0x88, 0x56, 0x7A, 0x8B, 0x13, 0x7D, 0x13, 0x6B, 0x00, 0x0D, 0x41, 0x40,
+0x10, 0xC3, 0xAE, 0xDA, 0x98, 0x74, 0x01, 0xC2, 0x8E, 0x8D, 0x8E, 0x00, 0x4A, 0xC4, 0x8E, 0x18,
+0xAE, 0x31, 0x00, 0x0E, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x08, 0xC9, 0xCB, 0xB1, 0x61, 0x6E,
+0x0D, 0xA0, 0x4D, 0xA0, 0x6E, 0x07, 0x06, 0xCB, 0xBA, 0x07, 0xA1, 0x2C, 0x3C, 0xC9, 0xA8, 0x7E,
+0x91, 0x2F, 0x1D, 0x3C, 0x00, 0xCD, 0x91, 0x3C, 0x2C, 0x69, 0x91, 0x57, 0x1D, 0xE1, 0x00, 0x0B,
+0x01, 0x04, 0x08, 0x00, 0x00, 0x65, 0x45, 0x48, 0x44, 0x43, 0x44, 0x41, 0x40, 0x02, 0x41, 0x48,
+0x4A, 0x42, 0x43, 0x40, 0x42, 0x48, 0x40, 0x45, 0x4E, 0x48, 0x00, 0x4F, 0xC2, 0x6D, 0x02, 0x00,
+0x00, 0x4B, 0x48, 0x41, 0x43, 0x4E, 0x42, 0x48, 0x42, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x02,
+0x41, 0x48, 0x4A, 0x42, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x03, 0x41, 0x42,
+0x45, 0x4A, 0x42, 0x40, 0x03, 0x41, 0x40, 0x02, 0x4A, 0x69, 0x40, 0x42, 0xC3, 0x74, 0x0A, 0x03,
+0x08, 0x00, 0x4B, 0x68, 0x45, 0x40, 0x00, 0x5C, 0xC8, 0x44, 0x16, 0x30, 0x0A, 0x64, 0x04, 0x00,
+0x0B, 0x00, 0x04, 0x48, 0x4E, 0x4A, 0x40, 0x45, 0x4A, 0xC2, 0x8D, 0x02, 0x00, 0x00, 0x52, 0xC2,
+0xB3, 0x57, 0x1D, 0x01, 0xCC, 0x91, 0x69, 0x3C, 0x91, 0x69, 0x91, 0x69, 0x1D, 0x57, 0x2C, 0x57,
+0xA1, 0x07, 0x07, 0xCA, 0x4B, 0x81, 0x39, 0xC3, 0x0D, 0x46, 0x87, 0xC2, 0x45, 0x0D, 0x07, 0x05,
+0xC2, 0x4B, 0x9F, 0x19, 0x00, 0xC1, 0x5F, 0x75, 0x01, 0xC0, 0x43, 0x00, 0x59, 0xC1, 0xD2, 0x00,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F,
+0x62, 0x09, 0x04, 0xC6, 0x41, 0x33, 0x66, 0x9E, 0x1A, 0x9E, 0x66, 0x00, 0x60, 0xC2, 0x78, 0x10,
+0x09, 0x01, 0x55, 0x49, 0x00, 0xC2, 0x62, 0x10, 0x02, 0x06, 0x43, 0x4E, 0x42, 0x00, 0x41, 0x40,
+0x00, 0xCA, 0x95, 0x6C, 0x71, 0x7A, 0xAF, 0xC0, 0xB8, 0x76, 0x34, 0x2B, 0x42, 0x00, 0xC2, 0x63,
+0xB0, 0x11, 0x00, 0x4C, 0x51, 0x6B, 0x00, 0xC3, 0x42, 0x30, 0x26, 0x2F, 0x00, 0x6A, 0xD0, 0x42,
+0x0E, 0x3B, 0x68, 0x9E, 0xC4, 0x77, 0x1C, 0x01, 0x47, 0x04, 0x11, 0x2F, 0x84, 0x4A, 0x32, 0x0C,
+0x00, 0x63, 0x4C, 0x01, 0xC1, 0x77, 0x0C, 0x01, 0xD1, 0x77, 0x0E, 0x4A, 0x2F, 0x5C, 0x11, 0x2F,
+0x2A, 0x11, 0x23, 0x76, 0xDF, 0xC0, 0x6B, 0x65, 0x4E, 0x67, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42,
+0x4A, 0x48, 0x42, 0x43, 0x00, 0x4A, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09, 0x01, 0xC1, 0x97, 0x09,
+0x00, 0xC1, 0x78, 0x66, 0x01, 0xC5, 0x78, 0xE0, 0x20, 0xA5, 0x72, 0x09, 0x05, 0xD5, 0x41, 0x13,
+0x7D, 0xCC, 0x3D, 0xBE, 0x4C, 0x9E, 0x6F, 0x9E, 0x56, 0x88, 0x64, 0x4C, 0x3D, 0x80, 0x13, 0x80,
+0x13, 0x4F, 0x0B, 0x00, 0x0C, 0x41, 0x40, 0x10, 0x58, 0x00, 0xCC, 0x98, 0x74, 0x8D, 0x8C, 0x96,
+0xCF, 0x96, 0x18, 0x98, 0x8C, 0x18, 0xAE, 0x00, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07,
+0x07, 0xC1, 0x4B, 0x55, 0x00, 0xC6, 0x87, 0x0D, 0x45, 0x87, 0x9C, 0x46, 0x07, 0x05, 0x6E, 0x4D,
+0x47, 0xC4, 0xA1, 0x2C, 0x3C, 0x54, 0x91, 0x00, 0xC7, 0xA7, 0x91, 0x3C, 0x69, 0xA8, 0x91, 0x3C,
+0x1D, 0x00, 0xC4, 0x91, 0x57, 0x2C, 0xE1, 0x00, 0x01, 0x7A, 0x48, 0x4B, 0x40, 0x42, 0x48, 0x41,
+0x42, 0x41, 0x48, 0x45, 0x40, 0x02, 0x42, 0x4E, 0x4A, 0x00, 0x43, 0x41, 0x42, 0x48, 0xD4, 0x51,
+0x03, 0x08, 0x01, 0x0A, 0x01, 0x44, 0x02, 0x12, 0x31, 0x0B, 0x08, 0x22, 0x08, 0x02, 0x08, 0x0E,
+0x05, 0x00, 0x01, 0x00, 0x07, 0x41, 0x40, 0x02, 0x44, 0x4E, 0x4A, 0x00, 0x40, 0x02, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x04, 0x44, 0x48, 0x43, 0x41, 0x40, 0x03, 0x41, 0x40, 0x01, 0x4B,
+0xC6, 0x50, 0x98, 0x26, 0x04, 0x02, 0x03, 0x02, 0x01, 0x48, 0x00, 0x41, 0x40, 0x00, 0xC1, 0x47,
+0x08, 0x00, 0x41, 0x5F, 0x48, 0x62, 0x40, 0x06, 0x41, 0x42, 0x76, 0x5F, 0x00, 0x65, 0xCB, 0x50,
+0x28, 0x00, 0x0B, 0x27, 0xB3, 0x57, 0x2C, 0x3C, 0x1D, 0x57, 0x91, 0x00, 0xC5, 0xBF, 0x7E, 0x91,
+0x7E, 0x57, 0x1D, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x08, 0x4D, 0xC9, 0x4D, 0x4B, 0x45, 0xC6, 0xC3,
+0xB9, 0x4B, 0x07, 0x0D, 0x07, 0x04, 0x6E, 0xC1, 0x43, 0x19, 0x01, 0xC0, 0x75, 0x00, 0xC5, 0x5F,
+0x19, 0x43, 0x19, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x0F, 0xC1, 0x4F, 0x09, 0x00, 0x50, 0x49, 0x04, 0x60, 0xC0, 0xAB, 0x00, 0xC6, 0x82, 0x1B,
+0x78, 0x66, 0x72, 0x33, 0x09, 0x05, 0x5B, 0x5C, 0x42, 0x05, 0x4E, 0x00, 0x48, 0x42, 0x41, 0x40,
+0x00, 0xDE, 0xCE, 0x6C, 0x53, 0x7C, 0x2D, 0x27, 0xAF, 0x4C, 0x71, 0x2B, 0x2A, 0x11, 0x95, 0x93,
+0x89, 0x3F, 0x89, 0xC5, 0xBD, 0x90, 0x3F, 0x22, 0x26, 0x11, 0x2F, 0x42, 0x2B, 0x32, 0x0C, 0x35,
+0x0C, 0x00, 0xC6, 0xC4, 0x96, 0x01, 0x0B, 0x89, 0x2B, 0x11, 0x00, 0xC2, 0x58, 0x08, 0x0C, 0x00,
+0x4E, 0x4C, 0x01, 0xC1, 0x77, 0x0C, 0x01, 0x75, 0x4E, 0xC2, 0x89, 0x3B, 0x8F, 0x00, 0x6F, 0x6A,
+0x51, 0xC9, 0x64, 0x7A, 0x6B, 0x0B, 0x31, 0x7C, 0x76, 0xB8, 0x00, 0x0B, 0x00, 0x40, 0x45, 0x43,
+0x4E, 0x4A, 0x43, 0x4A, 0x4E, 0x44, 0x42, 0x02, 0x5B, 0x49, 0xC1, 0x97, 0x09, 0x01, 0x50, 0x49,
+0x50, 0x5A, 0xC7, 0x72, 0x33, 0x16, 0x20, 0x1A, 0x10, 0x1A, 0x09, 0x05, 0xCA, 0x41, 0x13, 0x7D,
+0x3D, 0x13, 0xBE, 0x56, 0x6A, 0x7C, 0x6A, 0x6F, 0x01, 0x7D, 0x53, 0x7D, 0xC1, 0x80, 0x13, 0x00,
+0xC1, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x58, 0x00, 0xCA, 0xAD, 0xE5, 0x8C, 0x92, 0x74, 0x18,
+0x74, 0x18, 0xAD, 0x8E, 0x18, 0x00, 0x71, 0x40, 0x0E, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07,
+0x08, 0x4D, 0x79, 0xC1, 0xB9, 0x45, 0x01, 0xC3, 0x61, 0x39, 0xBA, 0x07, 0x06, 0xCA, 0xBA, 0x07,
+0xA1, 0x1D, 0x57, 0x7E, 0xA8, 0xBF, 0x85, 0x69, 0x91, 0x00, 0xC6, 0x69, 0x91, 0x7E, 0xBF, 0x1D,
+0xA8, 0x57, 0x00, 0xCE, 0xE1, 0x0B, 0x31, 0x0B, 0x01, 0x1C, 0x01, 0x21, 0x08, 0x0A, 0x04, 0x02,
+0x08, 0x04, 0x00, 0x03, 0x44, 0x45, 0x40, 0x43, 0x48, 0x01, 0x41, 0x40, 0x5F, 0x4A, 0xC5, 0x58,
+0x04, 0x00, 0x02, 0x28, 0x00, 0x01, 0x61, 0xC5, 0x58, 0x04, 0x02, 0x08, 0x04, 0x00, 0x00, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x02, 0x42, 0x45, 0x40, 0x43, 0x41, 0x40, 0x01, 0x41, 0x40, 0x42, 0x40,
+0x08, 0x41, 0x40, 0x05, 0x41, 0x40, 0x05, 0x41, 0x40, 0x01, 0x4B, 0xC6, 0xAF, 0x27, 0x2D, 0x47,
+0x31, 0x00, 0x0B, 0x01, 0x41, 0x40, 0x42, 0x48, 0x00, 0x42, 0x40, 0x00, 0x52, 0x40, 0x01, 0x52,
+0x40, 0x05, 0x4B, 0x40, 0x00, 0x67, 0x4B, 0x40, 0x02, 0xC7, 0x47, 0x12, 0xB3, 0x57, 0x1D, 0x57,
+0x2C, 0x1D, 0x02, 0x7C, 0x5D, 0x7C, 0x5D, 0x6C, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x07, 0x6E, 0x47,
+0xC3, 0x79, 0x0D, 0x2E, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x6E, 0x47, 0x04, 0xC6, 0x79, 0x43, 0x19,
+0x9F, 0x43, 0x19, 0x43, 0x00, 0x59, 0x01, 0xC1, 0xD2, 0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40,
+0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x7B, 0x09, 0x07, 0x55, 0xC6, 0x41,
+0x15, 0x62, 0x41, 0x15, 0x10, 0x09, 0x02, 0x55, 0x49, 0x00, 0xC2, 0x62, 0x10, 0x02, 0x0A, 0x41,
+0x40, 0x00, 0xCC, 0x63, 0x6C, 0x71, 0x7C, 0x0B, 0x12, 0x6B, 0x4C, 0x34, 0x2B, 0x5C, 0x6C, 0x36,
+0x00, 0xC1, 0xA7, 0x5A, 0x00, 0xC9, 0x84, 0xA7, 0x3E, 0x5A, 0x3F, 0x9A, 0x42, 0x11, 0x2F, 0x32,
+0x00, 0xCC, 0x73, 0x32, 0x0C, 0xC4, 0x0C, 0x3E, 0x58, 0x86, 0x84, 0x11, 0x8F, 0x2F, 0x4A, 0x00,
+0x4C, 0x01, 0xC6, 0x9E, 0x0C, 0x8D, 0x9E, 0x0C, 0x77, 0x0C, 0x00, 0xC2, 0x9E, 0x4A, 0x2F, 0x00,
+0xC2, 0x6C, 0x2F, 0x11, 0x00, 0xC9, 0x64, 0x9D, 0x6B, 0x12, 0x31, 0x4F, 0x56, 0x9D, 0x00, 0x0B,
+0x00, 0x40, 0x45, 0x42, 0x09, 0x5B, 0xC1, 0x7B, 0x09, 0x05, 0x55, 0x01, 0xC4, 0x97, 0x15, 0x09,
+0x1B, 0x09, 0x06, 0xD4, 0x41, 0x13, 0xCC, 0x3D, 0x80, 0x3D, 0x80, 0x8B, 0x80, 0x3D, 0xBE, 0x65,
+0x3D, 0x13, 0x3D, 0x80, 0x13, 0x80, 0x13, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x58, 0x01, 0xC2,
+0x8E, 0xAE, 0x18, 0x06, 0xC1, 0xAE, 0x00, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x0A, 0xC4,
+0x4B, 0x79, 0x0D, 0x81, 0x79, 0x00, 0x4D, 0x47, 0x06, 0x4D, 0x47, 0xC3, 0xA1, 0x57, 0x2C, 0x1D,
+0x00, 0x6C, 0x5D, 0x03, 0x7C, 0x00, 0xC1, 0x57, 0x1D, 0x00, 0x6C, 0x00, 0xC1, 0xE1, 0x00, 0x00,
+0x4B, 0x41, 0x4B, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x09, 0x41, 0x40, 0x00, 0x71,
+0x4B, 0x40, 0x41, 0x40, 0x52, 0x4B, 0x67, 0xC4, 0x63, 0x08, 0x6D, 0x05, 0x00, 0x05, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xC1,
+0xAF, 0x00, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x4B, 0x40, 0x00, 0x4B, 0x41, 0x01, 0x40, 0x11,
+0x4B, 0x40, 0x02, 0x52, 0xC3, 0xB3, 0x1D, 0x3C, 0x1D, 0x02, 0x6C, 0x5D, 0x02, 0x7C, 0x5D, 0x00,
+0x6C, 0xC2, 0xA1, 0x07, 0x0D, 0x0D, 0xC1, 0x81, 0x0D, 0x07, 0x78, 0xC2, 0x9F, 0x43, 0x19, 0x00,
+0xC0, 0x43, 0x01, 0x59, 0xC3, 0x43, 0x19, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC4, 0x4F, 0x09, 0x15, 0x41, 0x09, 0x00, 0xC1, 0x41, 0x09,
+0x00, 0xC1, 0x41, 0x09, 0x00, 0x5B, 0x50, 0x49, 0x5B, 0xC2, 0x41, 0x10, 0x09, 0x00, 0x55, 0x49,
+0x55, 0x49, 0x01, 0x5B, 0x42, 0x0A, 0x40, 0x01, 0xC4, 0xCE, 0x11, 0x34, 0x9D, 0x6B, 0x00, 0xC4,
+0x65, 0x76, 0x3B, 0x2B, 0x5C, 0x00, 0xC7, 0x95, 0x5A, 0x2B, 0x42, 0x2F, 0x3B, 0x11, 0x2B, 0x00,
+0xD5, 0xB0, 0x59, 0x42, 0x3B, 0x5A, 0x58, 0x53, 0x0C, 0x35, 0x9E, 0x23, 0x35, 0x26, 0x84, 0x2B,
+0x2A, 0x2F, 0x8F, 0x2F, 0x59, 0x08, 0x0C, 0x00, 0xC0, 0x8D, 0x00, 0xC3, 0x9E, 0x8D, 0x23, 0x0C,
+0x01, 0xD1, 0x77, 0x0A, 0x89, 0x3B, 0x5C, 0x11, 0x8F, 0xBC, 0x5C, 0x3B, 0x71, 0xD8, 0xC0, 0x0B,
+0xB8, 0x4E, 0x44, 0x00, 0x02, 0x41, 0x42, 0x07, 0xC3, 0xBD, 0x02, 0x1B, 0x09, 0x00, 0xC1, 0x41,
+0x09, 0x03, 0x55, 0x5B, 0x55, 0x49, 0x02, 0x55, 0x49, 0x01, 0xC1, 0x41, 0x09, 0x00, 0x55, 0xC2,
+0x41, 0x8B, 0x3D, 0x00, 0xC3, 0x80, 0x13, 0x3D, 0x13, 0x00, 0xC3, 0x80, 0x7D, 0x13, 0x3D, 0x00,
+0x53, 0xC5, 0x8B, 0x94, 0x8B, 0x13, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0xC1, 0xAE, 0x18, 0x00,
+0xC1, 0xDA, 0x18, 0x07, 0xC1, 0xAE, 0x00, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xD6, 0x07, 0x0D, 0x0A,
+0xC2, 0x81, 0xCB, 0x0D, 0x0C, 0xC8, 0xA1, 0x3C, 0x2C, 0x1D, 0x57, 0x2C, 0x1D, 0x57, 0x2C, 0x00,
+0x7C, 0x5D, 0x01, 0xC2, 0x57, 0x1D, 0x2C, 0x00, 0xC1, 0x93, 0x00, 0x19, 0x71, 0x4B, 0x40, 0x01,
+0x4B, 0x40, 0x65, 0x41, 0x00, 0x6D, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x06, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x00, 0x66, 0xC1, 0x6D, 0x08, 0x00, 0x66, 0xC7,
+0x6D, 0x08, 0x03, 0x3E, 0x0E, 0x4A, 0x53, 0x08, 0x00, 0x43, 0x48, 0x02, 0x66, 0x48, 0x01, 0xC0,
+0x7E, 0x02, 0xC7, 0xA7, 0x7E, 0xA7, 0x7E, 0xA7, 0x7E, 0xA7, 0x7E, 0x00, 0xC1, 0xA7, 0x7E, 0x00,
+0x7E, 0x79, 0xCE, 0x61, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0xB9, 0xA0, 0x61,
+0xA0, 0x61, 0x00, 0xCB, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x87, 0x11, 0x2A,
+0x04, 0xC1, 0x75, 0x2A, 0x00, 0xC4, 0x9B, 0x74, 0x08, 0x03, 0x08, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x00, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x00, 0x66, 0xC5, 0x59, 0x70, 0xAB, 0x72, 0x92, 0x72, 0x00, 0x5A, 0xCC,
+0x92, 0x72, 0x1A, 0x92, 0x72, 0x92, 0x72, 0x1A, 0xAB, 0x92, 0x1A, 0x92, 0x72, 0x00, 0x5A, 0xC0,
+0x72, 0x01, 0x5A, 0xC0, 0x92, 0x00, 0x7E, 0x4A, 0x00, 0x4E, 0x4A, 0x00, 0x4E, 0x4A, 0x02, 0x48,
+0x00, 0xDB, 0x50, 0x59, 0x6C, 0x2A, 0x34, 0x76, 0x4C, 0x76, 0x64, 0x2B, 0x2A, 0x5C, 0x6C, 0x36,
+0xB0, 0x2B, 0x71, 0x9D, 0xB8, 0x44, 0x9B, 0x42, 0xB0, 0x26, 0x2A, 0x32, 0x0E, 0x16, 0x00, 0x4E,
+0xC1, 0x68, 0x77, 0x00, 0x75, 0xCB, 0x89, 0x84, 0x2A, 0x5C, 0x2A, 0x5C, 0x11, 0x32, 0x4A, 0x77,
+0x0C, 0x23, 0x02, 0xC9, 0x8D, 0x23, 0x9E, 0x0C, 0x77, 0x23, 0x3E, 0x11, 0x5C, 0x11, 0x00, 0x6F,
+0xCD, 0xA7, 0x84, 0x3B, 0x6A, 0x94, 0x65, 0x56, 0x9B, 0x3E, 0x6D, 0x26, 0x08, 0x03, 0x0A, 0x00,
+0x4E, 0x4A, 0x4E, 0x4A, 0x00, 0x4E, 0x4A, 0x00, 0x4E, 0xC3, 0x5A, 0x92, 0x1A, 0x72, 0x01, 0xC3,
+0x92, 0x72, 0x92, 0x72, 0x00, 0xC8, 0x92, 0x72, 0x92, 0x72, 0x92, 0x1A, 0x92, 0x72, 0x1A, 0x00,
+0xC0, 0x72, 0x00, 0xC4, 0x92, 0x1A, 0x72, 0x70, 0xA9, 0x00, 0xD1, 0x88, 0x70, 0x88, 0x6F, 0x92,
+0x6F, 0xA9, 0x92, 0x6F, 0x92, 0x6F, 0x92, 0xA9, 0x6F, 0x1A, 0x53, 0x03, 0x08, 0x01, 0x43, 0x48,
+0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0xC0, 0x98, 0x01, 0xC1, 0x74,
+0x98, 0x00, 0xC5, 0x74, 0x98, 0x70, 0x98, 0x74, 0x98, 0x00, 0xC0, 0x74, 0x00, 0x48, 0x00, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x00, 0x43, 0x48, 0x01, 0x66, 0xCA, 0x74, 0x4E, 0xB9, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x61, 0x39,
+0x61, 0x00, 0xC1, 0xA0, 0x61, 0x00, 0xD1, 0xA0, 0xB9, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0xB9, 0xA0,
+0x61, 0xA0, 0x61, 0xEC, 0xA0, 0x61, 0xEC, 0xA9, 0x85, 0x00, 0xC0, 0x5A, 0x0C, 0xC3, 0x49, 0x30,
+0x74, 0x08, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x04, 0x43, 0x48, 0x03, 0x66, 0x48, 0x02, 0x43, 0x48, 0x66, 0x48, 0x03, 0x43, 0x48, 0x00,
+0x66, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x02, 0x43, 0x48, 0x01, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x00, 0x42, 0x41, 0x42, 0x40, 0x41, 0x00, 0x40, 0x41, 0x40, 0x41, 0x40,
+0x41, 0x01, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00,
+0x41, 0x02, 0x40, 0x41, 0x40, 0x41, 0x40, 0x04, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40,
+0x00, 0x41, 0x40, 0x52, 0xCD, 0x47, 0x0B, 0x27, 0x47, 0xD3, 0x6C, 0x2B, 0x84, 0x0F, 0x00, 0x27,
+0x0B, 0x27, 0x00, 0x01, 0x41, 0x52, 0xC4, 0x47, 0x01, 0xB3, 0x57, 0x3C, 0x01, 0xC3, 0x57, 0x3C,
+0x57, 0x3C, 0x00, 0xC1, 0x57, 0x3C, 0x03, 0xDC, 0xA1, 0xBA, 0x0D, 0x4B, 0x2E, 0x4B, 0x2E, 0x4B,
+0x2E, 0x4B, 0x2E, 0x4B, 0x07, 0x4B, 0x2E, 0xBA, 0x79, 0x07, 0x4B, 0x07, 0xBA, 0x2E, 0xBA, 0x2E,
+0x4B, 0x2E, 0x07, 0xC6, 0x43, 0x02, 0x59, 0xC0, 0x43, 0x01, 0xC9, 0x5F, 0x19, 0xD2, 0x00, 0x01,
+0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x02,
+0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x00, 0x4F, 0x71, 0x6D, 0x71, 0x6D, 0x71,
+0x6D, 0x71, 0x6D, 0x71, 0x6D, 0x71, 0x6D, 0x71, 0x6D, 0x71, 0x6D, 0x41, 0x01, 0x71, 0x6D, 0x71,
+0x6D, 0x71, 0x6D, 0x71, 0x6D, 0x71, 0x6D, 0x71, 0x40, 0x41, 0x40, 0x6D, 0x5F, 0x41, 0x4B, 0x67,
+0x4B, 0x67, 0x4B, 0x67, 0x4B, 0x67, 0x4B, 0x67, 0x4B, 0x67, 0x4B, 0x71, 0x41, 0x6D, 0xC1, 0x4F,
+0x10, 0x04, 0x49, 0x50, 0x00, 0x55, 0xC3, 0x62, 0x10, 0x15, 0x10, 0x00, 0xC3, 0xA5, 0x10, 0x09,
+0x10, 0x01, 0x55, 0x50, 0x02, 0x42, 0x00, 0x44, 0x42, 0x00, 0x44, 0x42, 0x01, 0x44, 0x42, 0x00,
+0x41, 0x00, 0x4B, 0x76, 0xC3, 0xBC, 0x75, 0x2B, 0x3B, 0x00, 0x72, 0x6B, 0x6A, 0x6B, 0x6A, 0x6F,
+0xDE, 0x95, 0x3E, 0x64, 0xE4, 0x6B, 0xC0, 0x7C, 0x50, 0x11, 0x58, 0xA4, 0x42, 0x11, 0x04, 0x12,
+0x21, 0x0E, 0x0C, 0x8D, 0x0C, 0x23, 0x37, 0x84, 0x2A, 0x5C, 0x11, 0x2A, 0x11, 0x59, 0x51, 0x0C,
+0x00, 0x63, 0x4E, 0x63, 0x4C, 0xCC, 0x8D, 0x23, 0x8D, 0x23, 0x0C, 0x0E, 0x36, 0x8F, 0x5C, 0x2F,
+0x3B, 0x4A, 0x95, 0x00, 0x72, 0x7B, 0xC9, 0x9B, 0x64, 0x3B, 0x11, 0x95, 0x0B, 0x27, 0x01, 0x00,
+0x02, 0x06, 0x44, 0x42, 0x01, 0x50, 0x00, 0x49, 0x50, 0x01, 0x49, 0x50, 0x04, 0x55, 0x50, 0x05,
+0x49, 0x50, 0x55, 0xC1, 0x41, 0x65, 0x01, 0x53, 0x0A, 0xDF, 0x65, 0x13, 0x3D, 0x7C, 0x01, 0x00,
+0x12, 0x47, 0x12, 0x47, 0x12, 0x47, 0x12, 0x47, 0x12, 0x47, 0x12, 0x01, 0x47, 0x0F, 0x47, 0x12,
+0x47, 0x12, 0x47, 0x12, 0x47, 0x12, 0x47, 0x12, 0x47, 0x12, 0xC6, 0x47, 0x12, 0x47, 0x12, 0x47,
+0x12, 0x18, 0x04, 0xC0, 0x8E, 0x00, 0x5F, 0xCF, 0x8E, 0x18, 0x1F, 0x8E, 0x18, 0x01, 0x00, 0x2D,
+0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x01, 0xD1,
+0x47, 0x12, 0x47, 0x12, 0x31, 0x0B, 0x01, 0x27, 0xD6, 0xCB, 0x4B, 0x2E, 0x4B, 0x2E, 0x4B, 0x2E,
+0x4B, 0x2E, 0x00, 0xD1, 0xBA, 0x2E, 0x07, 0x2E, 0x4B, 0x07, 0x4B, 0x2E, 0x4B, 0x2E, 0xBA, 0x2E,
+0x4B, 0x07, 0x4B, 0x2E, 0x4B, 0x2E, 0x00, 0xC4, 0x81, 0x47, 0x00, 0x27, 0x12, 0x00, 0x67, 0x52,
+0x02, 0x67, 0x52, 0x67, 0x52, 0xCE, 0xD9, 0x1E, 0x12, 0x2D, 0x27, 0x31, 0x00, 0x01, 0x00, 0x01,
+0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x02, 0x41, 0x40, 0x41,
+0x40, 0x01, 0xC3, 0x47, 0x2D, 0x31, 0x00, 0x00, 0x4B, 0x67, 0xCA, 0x47, 0x0B, 0x47, 0x00, 0x12,
+0x47, 0x0B, 0x01, 0x0B, 0x47, 0x01, 0x02, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x01, 0x45, 0x40, 0x42, 0x40, 0x07, 0x41,
+0x00, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x71, 0x6D, 0xC0, 0x6C, 0x00, 0xC1, 0xF8, 0x00, 0x08, 0x4B,
+0x52, 0xC1, 0xB3, 0x2C, 0x04, 0x5D, 0x6C, 0x01, 0x5D, 0x6C, 0xC4, 0x57, 0x3C, 0x57, 0xA1, 0x07,
+0x06, 0x4D, 0x47, 0x4D, 0x02, 0x47, 0x4D, 0x47, 0x02, 0x4D, 0x47, 0x03, 0xC1, 0x79, 0x19, 0x06,
+0xC3, 0x43, 0x19, 0xC8, 0x00, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40,
+0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x7B, 0x09, 0x01, 0xC5, 0x62, 0x09, 0x62, 0x09, 0x62, 0x09,
+0x05, 0x55, 0x49, 0x01, 0xC1, 0x62, 0x09, 0x02, 0x50, 0x69, 0x42, 0x09, 0xC8, 0x47, 0x12, 0x00,
+0x89, 0xBC, 0x75, 0x2A, 0x42, 0x2A, 0x01, 0x6F, 0xC1, 0xA7, 0x11, 0x00, 0xC4, 0x95, 0x58, 0x71,
+0xB7, 0xAF, 0x00, 0xC7, 0x6B, 0x44, 0x64, 0xB0, 0x95, 0x2B, 0x42, 0x4A, 0x01, 0xC8, 0x5A, 0x08,
+0x44, 0x03, 0x04, 0x89, 0x2F, 0x5C, 0x11, 0x00, 0x6A, 0x6F, 0xC2, 0x4A, 0x8D, 0x0C, 0x00, 0x63,
+0xC1, 0x8D, 0x23, 0x04, 0xC3, 0x77, 0x23, 0x3E, 0x11, 0x00, 0x6F, 0xC7, 0x95, 0x3F, 0x9A, 0x85,
+0xA7, 0x2A, 0x2B, 0x11, 0x00, 0xC4, 0xBC, 0x95, 0x00, 0x0B, 0x00, 0x00, 0x45, 0x42, 0x09, 0x5B,
+0x49, 0xC1, 0x97, 0x09, 0x03, 0xC1, 0x62, 0x09, 0x03, 0xC1, 0x62, 0x09, 0x01, 0xCA, 0x62, 0x09,
+0x62, 0x09, 0x62, 0x97, 0x41, 0xBE, 0x13, 0x7D, 0x13, 0x00, 0xC1, 0x7D, 0x13, 0x00, 0xC4, 0x7D,
+0x13, 0x80, 0x7D, 0x13, 0x01, 0xC1, 0x80, 0x13, 0x00, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10,
+0xC1, 0xAE, 0x18, 0x00, 0xC0, 0xAE, 0x00, 0x58, 0x07, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x04, 0x4B,
+0x40, 0x00, 0xC2, 0xB2, 0x2E, 0x07, 0x03, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x05, 0x4D,
+0x47, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D, 0x47, 0xC2, 0x81, 0x2D, 0x00, 0x04, 0x71, 0x4B, 0x40,
+0x34, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40, 0x01, 0x42, 0x41, 0x00,
+0x45, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x45, 0x42, 0x00, 0x45, 0x00, 0x40, 0x45,
+0x00, 0x41, 0x42, 0x45, 0x40, 0x71, 0x40, 0x00, 0x42, 0x61, 0x40, 0x42, 0x00, 0x41, 0x40, 0x4B,
+0x71, 0x6D, 0xC3, 0x59, 0x0F, 0x12, 0x00, 0x00, 0x41, 0x45, 0x40, 0x00, 0x42, 0x5C, 0x62, 0x40,
+0x00, 0x41, 0xCE, 0xB3, 0x2C, 0x57, 0x3C, 0x57, 0x2C, 0x3C, 0x69, 0xBF, 0x69, 0x1D, 0xBF, 0x69,
+0x1D, 0x2C, 0x00, 0xC1, 0xA1, 0x07, 0x07, 0x4D, 0xC5, 0xBA, 0x38, 0x4B, 0x0D, 0xBA, 0x46, 0x00,
+0xC3, 0x4B, 0x0D, 0x2E, 0x07, 0x04, 0x6E, 0xC1, 0x43, 0x19, 0x01, 0xC0, 0x5F, 0x01, 0xC1, 0x43,
+0x19, 0x00, 0xC1, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x07, 0xC2, 0x82, 0x10, 0x33, 0x00, 0x50, 0xC3, 0xA5, 0x33,
+0x10, 0x09, 0x01, 0xC1, 0x62, 0x09, 0x01, 0x5B, 0x69, 0x42, 0x06, 0x43, 0x42, 0x00, 0x41, 0x40,
+0x52, 0xCA, 0x67, 0x5C, 0xBC, 0x2A, 0x42, 0x2B, 0x2A, 0x42, 0x95, 0x9A, 0x11, 0x00, 0xCD, 0x95,
+0x58, 0x64, 0x25, 0xC0, 0xAF, 0xB7, 0x4C, 0x3B, 0x58, 0x9A, 0x2A, 0x11, 0x42, 0x01, 0x51, 0x72,
+0x51, 0xC3, 0x4A, 0x84, 0x8F, 0x11, 0x00, 0x6F, 0xC1, 0x84, 0x11, 0x00, 0xC2, 0x86, 0x63, 0x0C,
+0x01, 0x63, 0x4C, 0x00, 0xC1, 0x9E, 0x77, 0x02, 0x4E, 0xD1, 0xC5, 0x84, 0x5C, 0x2F, 0x3E, 0x58,
+0x4A, 0x58, 0xE1, 0x2F, 0x42, 0x11, 0x2B, 0x5C, 0x95, 0x00, 0x0B, 0x00, 0x00, 0x45, 0x42, 0x44,
+0x43, 0x42, 0x44, 0x43, 0x42, 0x03, 0x5B, 0xC1, 0x62, 0x09, 0x03, 0x50, 0xC1, 0x41, 0x10, 0x01,
+0xC7, 0x82, 0x10, 0x09, 0x20, 0x82, 0x15, 0x10, 0x09, 0x03, 0xC4, 0x97, 0x80, 0x13, 0x7D, 0x80,
+0x00, 0x53, 0x00, 0xC1, 0x56, 0x7A, 0x00, 0xC4, 0x56, 0x4C, 0x13, 0x7D, 0x80, 0x01, 0x53, 0xC1,
+0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x58, 0x00, 0xC3, 0x8E, 0x8C, 0x96, 0x8C, 0x00, 0x58, 0xC2,
+0x8C, 0x18, 0x8E, 0x00, 0x58, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xB2,
+0x07, 0x06, 0x4D, 0xC3, 0x4B, 0x46, 0x45, 0x0D, 0x00, 0xC7, 0x4B, 0x46, 0xCB, 0x38, 0x46, 0x4B,
+0x0D, 0x07, 0x04, 0xCA, 0xBA, 0x07, 0x81, 0x47, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x02,
+0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x00, 0x41, 0x01, 0x40, 0x00, 0x41, 0x44, 0x45,
+0x40, 0x41, 0x45, 0x40, 0x03, 0x41, 0x45, 0x40, 0x45, 0x42, 0x00, 0x41, 0x40, 0x01, 0x45, 0x44,
+0x61, 0x67, 0x40, 0x45, 0x40, 0x02, 0x45, 0x42, 0x40, 0x45, 0x42, 0x40, 0x4B, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x01, 0x63, 0x45, 0x42, 0x4E, 0x40, 0x01, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x02, 0x4A, 0x43, 0x42, 0x44, 0x4E, 0x40, 0x48, 0x43, 0x00, 0x44, 0x4A, 0xC1,
+0xAA, 0x00, 0x00, 0x61, 0xCA, 0x86, 0x53, 0x02, 0x0A, 0x03, 0x01, 0x27, 0x00, 0x2D, 0x31, 0x00,
+0x03, 0x48, 0x00, 0x40, 0x41, 0x4A, 0x43, 0x4F, 0x40, 0xD3, 0x47, 0x12, 0xB3, 0x2C, 0x3C, 0x69,
+0x91, 0x1D, 0x9A, 0x91, 0x9A, 0x91, 0x85, 0x7E, 0x91, 0x69, 0x1D, 0x57, 0xA1, 0x07, 0x01, 0x4D,
+0x47, 0x00, 0x4D, 0x47, 0x4D, 0xC4, 0x4B, 0x46, 0xC2, 0xCB, 0x45, 0x00, 0xC6, 0x88, 0x4E, 0x81,
+0x0D, 0x07, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0x00, 0xC9, 0x4B, 0xD1, 0x43, 0x19, 0x43, 0xBC, 0x2B,
+0x75, 0x43, 0x19, 0x00, 0xC1, 0xD2, 0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x00, 0x50, 0x49, 0x50, 0x49, 0x50, 0x5B,
+0x60, 0xCC, 0xDE, 0x33, 0x66, 0x1A, 0x92, 0x72, 0x1A, 0x78, 0x41, 0x15, 0x10, 0x15, 0x09, 0x01,
+0x50, 0x56, 0x42, 0x05, 0x4A, 0x4E, 0x4A, 0x42, 0x41, 0x40, 0x00, 0x76, 0xD8, 0x6C, 0x2A, 0x11,
+0x64, 0xC7, 0x84, 0x32, 0x84, 0x95, 0xF6, 0xB0, 0x37, 0x58, 0x32, 0x9D, 0xAF, 0x25, 0xE4, 0x71,
+0x2B, 0xB0, 0x95, 0x42, 0x2A, 0x42, 0x01, 0xC2, 0xA6, 0x2B, 0x42, 0x00, 0x6F, 0x51, 0x6A, 0x00,
+0x6F, 0xC7, 0x8F, 0x5C, 0x8F, 0x32, 0x23, 0x0C, 0x35, 0x0C, 0x01, 0xC1, 0x77, 0x0C, 0x02, 0xD3,
+0x77, 0x64, 0x4A, 0x2A, 0x5C, 0x6C, 0x11, 0xA7, 0x93, 0x9A, 0x3E, 0x3B, 0x3E, 0x71, 0x0E, 0x2A,
+0x95, 0x00, 0x12, 0x00, 0x00, 0x45, 0x44, 0x4E, 0x4A, 0x01, 0x4E, 0x48, 0x42, 0x02, 0x5B, 0x49,
+0x04, 0x50, 0x5B, 0xD1, 0x66, 0x72, 0x10, 0xE0, 0x33, 0x20, 0x78, 0x66, 0x20, 0x41, 0x09, 0x10,
+0x09, 0x10, 0x09, 0x41, 0x80, 0x13, 0x00, 0xCB, 0x7D, 0x13, 0x8B, 0x4C, 0xE0, 0x4C, 0x6A, 0x88,
+0xA9, 0x65, 0x7A, 0x80, 0x01, 0x53, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x5F, 0x58, 0xCC,
+0xAA, 0x98, 0xCF, 0x8E, 0x98, 0xAD, 0x74, 0x8C, 0x8D, 0x8C, 0x18, 0xAE, 0x00, 0x0F, 0x41, 0x40,
+0x07, 0xC4, 0xB2, 0x2E, 0x07, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0xC7, 0x79, 0x0D, 0x46, 0xA0, 0xBB,
+0x45, 0xB1, 0x61, 0x00, 0xC4, 0x6E, 0x87, 0x61, 0x39, 0x0D, 0x01, 0x47, 0x00, 0x4D, 0x47, 0x4D,
+0x47, 0xC1, 0x81, 0x00, 0x12, 0x41, 0x48, 0x00, 0x40, 0x00, 0x43, 0x00, 0x48, 0x40, 0x43, 0x4A,
+0x40, 0x03, 0x42, 0x63, 0x41, 0x44, 0x43, 0x01, 0x40, 0x41, 0x40, 0x4A, 0x43, 0x4A, 0x45, 0x48,
+0x4A, 0x40, 0x01, 0x45, 0x48, 0x00, 0x5C, 0x4A, 0x48, 0x42, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x00, 0x4B, 0x4A, 0x44, 0x00, 0x4A, 0x40, 0x01, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x02, 0x4A, 0x00, 0x44, 0x42, 0x4E, 0x42, 0x4A, 0x48, 0x43, 0x40, 0x00, 0x67, 0x40,
+0x00, 0x44, 0xC2, 0x44, 0x02, 0x03, 0x01, 0x42, 0x40, 0x01, 0x4B, 0x02, 0x40, 0x45, 0x48, 0x43,
+0x40, 0x41, 0x48, 0x44, 0x42, 0x52, 0xCC, 0x47, 0x00, 0x3C, 0x2C, 0xB3, 0x69, 0x7E, 0x1D, 0x3C,
+0x4A, 0xA8, 0x91, 0x3C, 0x00, 0xC2, 0x91, 0x69, 0x2C, 0x00, 0xC1, 0xA1, 0x07, 0x02, 0x4D, 0x47,
+0x02, 0xC9, 0x79, 0x45, 0x39, 0xB1, 0x79, 0x45, 0xA0, 0x39, 0x45, 0x07, 0x01, 0x4D, 0x47, 0x02,
+0xC2, 0x79, 0x43, 0x19, 0x01, 0xC3, 0x43, 0x2A, 0x43, 0x19, 0x01, 0xC1, 0xC8, 0x00, 0x0F, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x52, 0x00, 0xC2, 0x4F, 0x62,
+0x09, 0x05, 0xCA, 0x62, 0x1A, 0x66, 0x20, 0x9E, 0x92, 0x72, 0x1B, 0x33, 0xAB, 0x09, 0x04, 0x50,
+0x5B, 0x69, 0x42, 0x06, 0x4A, 0x00, 0x42, 0x67, 0x4B, 0x00, 0x76, 0x51, 0xC6, 0x6C, 0x6A, 0x65,
+0x7A, 0x4C, 0x71, 0x2B, 0x00, 0xCE, 0xD2, 0xA7, 0x36, 0xB0, 0x2B, 0x3B, 0x53, 0x5B, 0x71, 0x11,
+0x2B, 0x85, 0x95, 0x42, 0x11, 0x00, 0x72, 0xC0, 0x42, 0x00, 0x51, 0x6B, 0x51, 0x00, 0x6F, 0x51,
+0x6A, 0x6F, 0x51, 0x6A, 0xC2, 0xBC, 0x11, 0x0E, 0x00, 0x63, 0x06, 0xCE, 0x9E, 0x23, 0x58, 0x84,
+0x2A, 0x5C, 0x2A, 0x11, 0x2F, 0xA7, 0x4A, 0x0E, 0x4C, 0x94, 0x65, 0x00, 0xC4, 0x83, 0x63, 0x00,
+0x12, 0x00, 0x00, 0x45, 0x42, 0x00, 0x4A, 0x48, 0x45, 0x48, 0x00, 0x42, 0x02, 0x50, 0x49, 0x02,
+0xC1, 0x62, 0x09, 0x00, 0x60, 0xCA, 0x78, 0x1A, 0x99, 0x66, 0xCF, 0x1A, 0x20, 0x1A, 0x33, 0x15,
+0x09, 0x03, 0xC3, 0x41, 0x7A, 0x3D, 0x13, 0x01, 0x7D, 0xC8, 0xA9, 0x88, 0x6F, 0x51, 0x88, 0xA9,
+0x65, 0x3D, 0x7D, 0x01, 0x53, 0xC1, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x58, 0x01, 0xC5, 0x8C,
+0x98, 0xAE, 0x8C, 0x8D, 0x8E, 0x00, 0xC2, 0x98, 0xAA, 0x18, 0x00, 0x71, 0x40, 0x0E, 0x41, 0x40,
+0x06, 0x71, 0xC1, 0xD6, 0x07, 0x04, 0x4D, 0x47, 0x00, 0xCC, 0xBA, 0xED, 0xBB, 0x38, 0x45, 0xBB,
+0x81, 0x87, 0x39, 0x87, 0x4D, 0x0D, 0x79, 0x00, 0x6E, 0x01, 0x47, 0x00, 0x6E, 0xC2, 0x81, 0x0B,
+0x00, 0x0B, 0x52, 0x40, 0x03, 0x41, 0x42, 0x43, 0x40, 0x4B, 0x67, 0x61, 0x48, 0x45, 0x48, 0x43,
+0x40, 0x03, 0x48, 0xC6, 0x53, 0x03, 0x04, 0x02, 0x00, 0x0A, 0x00, 0x01, 0x4A, 0x48, 0x4E, 0x42,
+0x00, 0x43, 0x40, 0x01, 0x44, 0x00, 0x42, 0x48, 0x00, 0xC4, 0x53, 0xAA, 0x00, 0x01, 0x00, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x48, 0x4A, 0x48, 0x00, 0x40, 0x01, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x02, 0x4A, 0x45, 0x40, 0x42, 0x48, 0x01, 0x43, 0x4A, 0x41, 0x42, 0x00,
+0x40, 0x00, 0x42, 0x43, 0x44, 0x43, 0x61, 0x42, 0x43, 0x40, 0x00, 0x4B, 0x6D, 0x40, 0x02, 0x43,
+0x4E, 0x00, 0x40, 0x45, 0x42, 0x69, 0x66, 0x40, 0x4B, 0x52, 0xCD, 0xB3, 0x57, 0x1D, 0x69, 0x91,
+0x3C, 0x9A, 0x91, 0x7E, 0x91, 0x9A, 0x7E, 0x69, 0x3C, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x00, 0x6E,
+0x47, 0x04, 0x78, 0xCB, 0x81, 0x39, 0x45, 0x0D, 0x45, 0xDC, 0x7F, 0x4D, 0x0D, 0x07, 0x2E, 0x07,
+0x03, 0x6E, 0xC2, 0x9F, 0x19, 0x43, 0x00, 0xC0, 0x75, 0x00, 0xC5, 0x43, 0x19, 0x43, 0x19, 0xC8,
+0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0E, 0x52,
+0xC4, 0x4F, 0x10, 0x09, 0x10, 0x09, 0x00, 0x50, 0x49, 0x5B, 0x73, 0xCA, 0x66, 0xE0, 0x92, 0x1A,
+0x20, 0x66, 0x1A, 0x72, 0x10, 0x41, 0x09, 0x00, 0x55, 0x50, 0x49, 0x00, 0x50, 0x42, 0x06, 0x43,
+0x44, 0x4E, 0x42, 0x41, 0x40, 0x00, 0xCE, 0x95, 0x11, 0x3E, 0x7A, 0x6B, 0xAF, 0x7C, 0x76, 0x3E,
+0x2B, 0x2A, 0x11, 0x95, 0x5A, 0x11, 0x00, 0x6B, 0x51, 0x6B, 0x51, 0xD1, 0x42, 0x9A, 0x26, 0x42,
+0x8F, 0x4A, 0x42, 0xA6, 0x2B, 0x42, 0x32, 0x42, 0x2B, 0x8F, 0x5C, 0x2A, 0x11, 0x5C, 0x00, 0x51,
+0xCE, 0x8F, 0x3B, 0x59, 0x4A, 0x63, 0x0E, 0x44, 0x0E, 0x04, 0x0E, 0x36, 0x26, 0x58, 0xB0, 0x11,
+0x00, 0xC0, 0x5C, 0x00, 0x51, 0xCA, 0x5C, 0x11, 0x3B, 0x56, 0xD8, 0x25, 0x6B, 0x65, 0x56, 0x44,
+0x00, 0x02, 0x45, 0x42, 0x4E, 0x43, 0x42, 0x4E, 0x48, 0x42, 0x02, 0xC2, 0xBD, 0xAD, 0x09, 0x00,
+0xC1, 0x97, 0x09, 0x00, 0x55, 0x50, 0xC2, 0x78, 0x9E, 0x66, 0x00, 0xDB, 0x92, 0xDE, 0x66, 0x70,
+0x1A, 0x20, 0x15, 0x10, 0x09, 0x10, 0x09, 0x15, 0x41, 0x80, 0x13, 0x3D, 0x80, 0x3D, 0x13, 0x9E,
+0xA9, 0x9E, 0x88, 0x76, 0x88, 0x4C, 0x94, 0x13, 0x02, 0x65, 0x40, 0x00, 0x52, 0x40, 0x09, 0x52,
+0x41, 0x40, 0x10, 0xCC, 0xAE, 0x18, 0xAE, 0x8C, 0x98, 0xAE, 0x74, 0x98, 0xAD, 0xAE, 0x98, 0x8C,
+0x18, 0x00, 0x40, 0x00, 0x4B, 0x40, 0x0C, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07,
+0x05, 0xCF, 0x79, 0x0D, 0x55, 0xB1, 0xB9, 0x55, 0xDC, 0xBB, 0x55, 0xBB, 0xEC, 0x55, 0xBB, 0x81,
+0x0D, 0x07, 0x01, 0x6E, 0x47, 0x4D, 0x47, 0xC3, 0x79, 0x0B, 0x12, 0x00, 0x09, 0x52, 0x40, 0x4B,
+0x00, 0x40, 0x00, 0x71, 0x40, 0x45, 0x48, 0x40, 0x00, 0x42, 0x48, 0x41, 0x43, 0x4E, 0x00, 0x40,
+0x02, 0x45, 0x4E, 0x43, 0x4E, 0x43, 0x42, 0x45, 0x48, 0x40, 0x01, 0x4A, 0x45, 0x43, 0x42, 0x41,
+0x48, 0x40, 0x01, 0x42, 0x43, 0x44, 0x48, 0x43, 0x44, 0x43, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x42, 0x44, 0x42, 0x00, 0x40, 0x01, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x02, 0x43, 0x4A, 0x43, 0x42, 0x00, 0x44, 0x42, 0x01, 0x48, 0x43, 0x41, 0x40, 0x00,
+0x4B, 0x43, 0x00, 0x41, 0x43, 0x48, 0x41, 0x40, 0x00, 0x4B, 0x40, 0x03, 0x41, 0x42, 0x00, 0x45,
+0x41, 0x43, 0x48, 0x4F, 0x40, 0x4B, 0x67, 0xC9, 0xB3, 0x2C, 0x1D, 0x57, 0x91, 0x7E, 0xA8, 0x69,
+0x3C, 0x7E, 0x00, 0xC3, 0x91, 0x7E, 0x57, 0x2C, 0x00, 0xC3, 0xA1, 0x07, 0xBA, 0x07, 0x01, 0x6E,
+0x47, 0x00, 0x6E, 0x47, 0x00, 0xC2, 0x4D, 0x4B, 0x45, 0x00, 0xC3, 0xB9, 0x39, 0x38, 0x07, 0x03,
+0x6E, 0x47, 0x00, 0xC1, 0xC6, 0x9F, 0x00, 0x59, 0xC1, 0x9F, 0x5F, 0x00, 0x59, 0x01, 0xC2, 0x43,
+0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2,
+0x4F, 0x62, 0x09, 0x05, 0x55, 0x50, 0x5A, 0x60, 0xC6, 0x66, 0x1A, 0x20, 0x66, 0x72, 0x33, 0x09,
+0x05, 0x5B, 0x56, 0x42, 0x05, 0x43, 0x4E, 0x43, 0x61, 0x41, 0x40, 0x00, 0xCF, 0x63, 0x6C, 0x6A,
+0xD8, 0x2D, 0x27, 0xAF, 0x4C, 0x71, 0x2B, 0x5C, 0x11, 0x95, 0x85, 0x11, 0x5C, 0x01, 0x6A, 0xC8,
+0x5C, 0x2A, 0xB0, 0x36, 0x2F, 0xC5, 0x3F, 0x3B, 0x4A, 0x00, 0x7B, 0xC2, 0x5A, 0x0E, 0x84, 0x00,
+0x51, 0xDF, 0x5C, 0x11, 0x2A, 0x11, 0x5C, 0x8F, 0x42, 0x11, 0x32, 0xB0, 0x4A, 0x86, 0x4A, 0x58,
+0x4A, 0x26, 0xA7, 0x32, 0x2B, 0x11, 0x2A, 0x11, 0x6C, 0x4A, 0x5C, 0x11, 0x34, 0xB8, 0x6B, 0x00,
+0x0B, 0x7C, 0xC3, 0x56, 0xB8, 0x00, 0x0B, 0x00, 0x40, 0x45, 0x44, 0x4E, 0x00, 0x48, 0x4E, 0x00,
+0x43, 0x42, 0x02, 0x5B, 0x49, 0xC3, 0x97, 0x09, 0x62, 0x09, 0x01, 0xC9, 0xA5, 0x20, 0x1A, 0x33,
+0x1B, 0x20, 0x1A, 0x78, 0x1A, 0x09, 0x05, 0xC6, 0x97, 0x80, 0x7D, 0x13, 0x80, 0x7D, 0x56, 0x00,
+0xC6, 0xDF, 0x56, 0x6A, 0x88, 0x6F, 0x3D, 0x13, 0x01, 0xC3, 0x7D, 0x13, 0x6B, 0x00, 0x0D, 0x41,
+0x40, 0x10, 0x58, 0x01, 0xCE, 0x8C, 0xAD, 0x8E, 0x74, 0x18, 0x74, 0x18, 0xAD, 0x8E, 0x18, 0xAE,
+0x31, 0x00, 0x2D, 0x00, 0x0C, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x00, 0x6E, 0x47, 0x00, 0x6E,
+0x47, 0x01, 0xCD, 0x45, 0x39, 0x4D, 0x45, 0xB1, 0x7F, 0xBB, 0xDC, 0x7F, 0x87, 0x46, 0x0D, 0x2E,
+0x07, 0x03, 0xC4, 0xBA, 0x07, 0x81, 0x00, 0x12, 0x0B, 0x4B, 0x02, 0x40, 0x01, 0x41, 0x42, 0x41,
+0x45, 0x48, 0x00, 0x44, 0x40, 0x42, 0x44, 0x40, 0x02, 0x42, 0x00, 0x40, 0x44, 0x43, 0x48, 0x00,
+0x45, 0x40, 0x01, 0x43, 0x48, 0x00, 0x41, 0x00, 0x42, 0x40, 0x01, 0x41, 0x43, 0x00, 0x41, 0x43,
+0x48, 0x45, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x04, 0x41, 0x40,
+0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x42, 0x48, 0x00, 0x42, 0x40, 0x09, 0x71, 0x40, 0x03,
+0x41, 0x40, 0x00, 0x71, 0x4B, 0x67, 0xC5, 0x47, 0x12, 0xB3, 0x57, 0x2C, 0x1D, 0x00, 0x7C, 0x5D,
+0x00, 0x7C, 0x5D, 0x7C, 0xC9, 0xB3, 0x3C, 0x2C, 0x3C, 0x2C, 0xA1, 0xBA, 0x07, 0x0D, 0x07, 0x04,
+0x6E, 0x47, 0x6E, 0x47, 0x6E, 0x47, 0xC3, 0x79, 0x0D, 0x2E, 0x07, 0x00, 0x6E, 0x47, 0x03, 0x6E,
+0xC1, 0x9F, 0x19, 0x02, 0xC1, 0x9F, 0x19, 0x00, 0xC0, 0x43, 0x00, 0xC1, 0xD2, 0x00, 0x0E, 0x41,
+0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0E, 0x52, 0xC4, 0x4F, 0x10,
+0x09, 0x10, 0x09, 0x04, 0x55, 0x5B, 0x55, 0x02, 0x5B, 0x00, 0x50, 0x49, 0x00, 0xC3, 0x62, 0x15,
+0x62, 0x09, 0x00, 0x55, 0x69, 0x42, 0x09, 0x67, 0x52, 0x40, 0xDD, 0x89, 0x3B, 0x71, 0x7C, 0x0B,
+0x27, 0xAF, 0x51, 0x34, 0x42, 0x5C, 0x11, 0x95, 0xB0, 0x11, 0x5C, 0x2B, 0xDB, 0x11, 0x5C, 0x2B,
+0xB0, 0x36, 0x11, 0x4A, 0x54, 0x23, 0x3E, 0x58, 0x0A, 0x00, 0xC0, 0x5A, 0x01, 0x51, 0xC7, 0x5C,
+0x11, 0x5C, 0x2A, 0x2F, 0x8F, 0x2F, 0x11, 0x00, 0x6F, 0x7B, 0x6F, 0x51, 0x03, 0x6F, 0x02, 0xCD,
+0x5C, 0x11, 0x8F, 0x2F, 0x11, 0xC2, 0x44, 0xC0, 0x0B, 0x00, 0x29, 0x56, 0x1C, 0x0B, 0x00, 0x40,
+0x00, 0x45, 0x42, 0x02, 0x69, 0x42, 0x04, 0x50, 0x49, 0x03, 0xC1, 0x62, 0x09, 0x02, 0x5B, 0x49,
+0x00, 0x55, 0x49, 0x55, 0x49, 0x04, 0xC2, 0x62, 0x41, 0x13, 0x00, 0x7D, 0x00, 0x53, 0xC3, 0x80,
+0x7D, 0x13, 0xBE, 0x01, 0x7D, 0x53, 0x00, 0x7D, 0xC1, 0x7D, 0x13, 0x00, 0xC2, 0x6B, 0x47, 0x00,
+0x00, 0x4B, 0x40, 0x07, 0x4B, 0x40, 0x41, 0x40, 0x10, 0x58, 0x0B, 0xC4, 0xDA, 0x31, 0x00, 0x0B,
+0x00, 0x0C, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x6E, 0x47, 0x00, 0x6E, 0xC1, 0x4B,
+0x07, 0x00, 0x6E, 0x47, 0x6E, 0xC4, 0xBA, 0x07, 0x0D, 0x2E, 0x07, 0x01, 0x6E, 0x4D, 0x47, 0x4D,
+0x47, 0xC1, 0x81, 0x00, 0x00, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0x71,
+0x40, 0x4B, 0x00, 0x52, 0x40, 0x52, 0x40, 0x0A, 0x41, 0x40, 0x03, 0x41, 0x40, 0x02, 0x41, 0x43,
+0x48, 0x43, 0x41, 0x40, 0x03, 0x42, 0x48, 0x00, 0x42, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x06, 0x41, 0x40,
+0x03, 0x4B, 0x67, 0x41, 0x00, 0x40, 0x07, 0xC1, 0x47, 0x00, 0x01, 0x6D, 0x52, 0x40, 0x03, 0x71,
+0x52, 0x00, 0x4B, 0x52, 0xC4, 0xB3, 0x57, 0x1D, 0x2C, 0x1D, 0x00, 0x7C, 0x5D, 0x00, 0x7C, 0x00,
+0x5D, 0x6C, 0x7C, 0x5D, 0x7C, 0xC1, 0xA1, 0x0D, 0x00, 0xC1, 0x79, 0x0D, 0x00, 0xC1, 0x79, 0x0D,
+0x07, 0xC1, 0xCB, 0x0D, 0x08, 0x78, 0xC2, 0x9F, 0x19, 0x43, 0x05, 0x59, 0xC1, 0xD2, 0x00, 0x0E,
+0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0E, 0x52, 0xCA, 0x4F,
+0x09, 0x15, 0x41, 0x10, 0x15, 0x09, 0x10, 0x1B, 0x10, 0x15, 0x00, 0x50, 0x55, 0x50, 0xCA, 0x41,
+0x10, 0x41, 0x10, 0x15, 0x41, 0x10, 0x15, 0x41, 0x09, 0x10, 0x00, 0x42, 0x0A, 0x41, 0x40, 0x00,
+0xD3, 0x95, 0x11, 0x9B, 0x4C, 0x4F, 0xAF, 0x65, 0x56, 0x3B, 0x42, 0x2A, 0x5C, 0x95, 0xB0, 0x2B,
+0x11, 0x3B, 0x64, 0x3B, 0x2B, 0x00, 0xC4, 0x9A, 0x26, 0x2F, 0x3B, 0x23, 0x00, 0x4C, 0x01, 0xCA,
+0x77, 0x0C, 0x32, 0x58, 0x2F, 0x2A, 0x5C, 0x11, 0x2A, 0x11, 0x8F, 0x00, 0x51, 0xC3, 0x8F, 0x11,
+0x8F, 0x2F, 0x00, 0x51, 0x6F, 0x00, 0x51, 0x6A, 0x51, 0x6A, 0x6F, 0xC0, 0x8F, 0x00, 0x51, 0xCC,
+0x8F, 0x2F, 0x3B, 0x71, 0x7C, 0xC0, 0x6B, 0xB8, 0x52, 0x44, 0x00, 0x31, 0x00, 0x00, 0x45, 0x42,
+0x09, 0x5B, 0x50, 0x01, 0x55, 0x50, 0x01, 0x49, 0x50, 0x49, 0xC3, 0x7B, 0x09, 0x10, 0x09, 0x00,
+0x50, 0x49, 0x50, 0x49, 0x50, 0x00, 0x55, 0x50, 0xC1, 0x41, 0x13, 0x03, 0xCB, 0x65, 0x7A, 0x65,
+0x7A, 0x65, 0x94, 0x13, 0x3D, 0x7A, 0x13, 0x7A, 0x13, 0x00, 0xC1, 0x6B, 0x00, 0x04, 0x4B, 0x40,
+0x4B, 0x40, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x41, 0x40, 0x10, 0xC1, 0xAE, 0x18, 0x02, 0xC1, 0x8E,
+0x18, 0x00, 0x5F, 0x58, 0x00, 0x5F, 0x58, 0x5F, 0x40, 0x6D, 0x52, 0x40, 0x0C, 0x41, 0x40, 0x03,
+0x4B, 0x00, 0x40, 0x71, 0xC1, 0xD6, 0x0D, 0x02, 0xC1, 0x79, 0x0D, 0x00, 0xC1, 0xCB, 0x0D, 0x02,
+0xC2, 0x79, 0xCB, 0x0D, 0x02, 0xC2, 0x79, 0xCB, 0x0D, 0x02, 0xC2, 0x81, 0x38, 0x0D, 0x00, 0xC3,
+0x79, 0xB2, 0xC0, 0x00, 0x10, 0x71, 0x40, 0x05, 0x41, 0x40, 0x0D, 0x41, 0x01, 0x40, 0x05, 0x41,
+0x01, 0x40, 0x41, 0x40, 0x03, 0x41, 0x40, 0x07, 0x41, 0x40, 0x08, 0x41, 0x40, 0x41, 0x40, 0x43,
+0x48, 0x04, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x01, 0x43, 0x48, 0x05, 0x43, 0x48, 0x04, 0x43, 0x48, 0x43, 0x48,
+0x06, 0xC3, 0x74, 0x59, 0x3E, 0x3B, 0x00, 0xC1, 0x86, 0x08, 0x01, 0x43, 0x48, 0x01, 0x43, 0x48,
+0x00, 0x66, 0xC0, 0x7E, 0x01, 0xC3, 0xA7, 0x7E, 0x54, 0x7E, 0x04, 0xCD, 0x54, 0x7E, 0xA7, 0x7E,
+0x3E, 0x39, 0xA0, 0x87, 0x39, 0x61, 0xB9, 0x61, 0x39, 0x61, 0x03, 0xC4, 0xA0, 0xB9, 0xA0, 0xB9,
+0x61, 0x02, 0x79, 0xC6, 0x61, 0xB9, 0xA0, 0xB9, 0x87, 0x11, 0x2A, 0x03, 0xC1, 0x75, 0x2A, 0x00,
+0xC3, 0x75, 0x9B, 0x74, 0x08, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x02, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x04, 0xC1, 0x70,
+0xAB, 0x00, 0xC0, 0x72, 0x00, 0x5A, 0xC2, 0x72, 0x1A, 0x72, 0x02, 0x5A, 0xC0, 0x72, 0x00, 0x5A,
+0xC2, 0x72, 0x1A, 0x72, 0x00, 0x5A, 0xC2, 0x72, 0x1A, 0x72, 0x01, 0xC4, 0x92, 0x0A, 0x0E, 0x0A,
+0x0E, 0x00, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x01, 0x48, 0x00, 0xCA, 0x74, 0x59, 0x5F, 0x2A, 0x64,
+0x56, 0x44, 0x76, 0x64, 0x2B, 0x5C, 0x00, 0xCA, 0x6C, 0x63, 0x5A, 0x2B, 0x3E, 0xB8, 0xD4, 0x9D,
+0x9B, 0x2B, 0x9A, 0x00, 0x6B, 0xCF, 0x5A, 0x4A, 0x9E, 0x0E, 0x9E, 0x0E, 0x8D, 0x64, 0x23, 0x36,
+0x5A, 0x11, 0x5C, 0x11, 0x2A, 0x5C, 0x00, 0x51, 0xC5, 0x8F, 0x11, 0x5C, 0x2F, 0x8F, 0x11, 0x00,
+0x6F, 0xD6, 0x8F, 0x5C, 0x11, 0x2A, 0x5C, 0x11, 0x8F, 0x11, 0x2A, 0x5C, 0x8F, 0xC9, 0x3B, 0x53,
+0x9D, 0xD4, 0x52, 0x9C, 0x3E, 0x08, 0x74, 0x26, 0x08, 0x00, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A,
+0x4E, 0x00, 0x4A, 0x4E, 0x4A, 0xC1, 0x92, 0x70, 0x0A, 0x5A, 0xC0, 0x70, 0x09, 0xC0, 0xA9, 0x00,
+0xC2, 0x6F, 0x72, 0xA9, 0x00, 0xC1, 0x88, 0xA9, 0x00, 0xCD, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x1A,
+0xA9, 0x6F, 0x1A, 0x53, 0x58, 0x08, 0x58, 0x08, 0x00, 0xCA, 0x58, 0x08, 0x30, 0x08, 0x58, 0x30,
+0x08, 0x58, 0x08, 0x58, 0x08, 0x02, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x00, 0xCD, 0x98, 0x08, 0x98, 0x08, 0x74, 0x08, 0x74, 0x49, 0x74, 0x49,
+0x08, 0x74, 0x98, 0x08, 0x01, 0x66, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x04, 0x43, 0x48, 0x00, 0x43, 0x48, 0xD0, 0x59, 0x08, 0x74, 0xA0, 0xB9, 0x61, 0x39, 0x61, 0xB9,
+0x61, 0xA0, 0x61, 0xA0, 0xB9, 0x61, 0xA0, 0x61, 0x06, 0xC2, 0xA0, 0xB9, 0x61, 0x00, 0xC3, 0xA0,
+0x61, 0xA0, 0xB9, 0x00, 0xC1, 0xA9, 0x85, 0x00, 0xCB, 0x5A, 0x85, 0x5A, 0x85, 0x5A, 0x85, 0x5A,
+0x85, 0x5A, 0x85, 0x5A, 0x85, 0x01, 0xC2, 0x5A, 0x30, 0x08, 0x00, 0x43, 0x48, 0x02, 0x43, 0x48,
+0x43, 0x48, 0x01, 0x43, 0x48, 0x09, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x01, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x02, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x03, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x44, 0x41, 0x42, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x19, 0x71, 0xC5, 0xD3, 0x6C, 0x2B, 0x34, 0x2D, 0x00, 0x07, 0xCF, 0x47,
+0x12, 0xB3, 0x3C, 0x1D, 0x3C, 0x1D, 0x2C, 0x1D, 0x2C, 0x3C, 0x2C, 0x3C, 0x1D, 0x2C, 0x3C, 0x00,
+0x6C, 0xC1, 0xA1, 0x07, 0x00, 0x4D, 0x47, 0x01, 0xC1, 0x79, 0x07, 0x00, 0x6E, 0x47, 0x09, 0x6E,
+0x47, 0x02, 0x6E, 0xC1, 0x43, 0x19, 0x05, 0xC0, 0x43, 0x00, 0xC1, 0xC8, 0x00, 0x0E, 0x41, 0x00,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0E, 0x52, 0xC1, 0x4F, 0x09,
+0x00, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x00, 0x50, 0xC3, 0x41, 0x10, 0x15, 0x10, 0x00, 0x55,
+0x50, 0x55, 0x00, 0x50, 0x55, 0x00, 0x50, 0x55, 0x49, 0x50, 0x69, 0x42, 0x09, 0x41, 0x40, 0x52,
+0xC4, 0x89, 0xBC, 0x75, 0x2B, 0x3B, 0x00, 0x6B, 0x6A, 0x02, 0xD9, 0x5C, 0x95, 0x58, 0x64, 0x8A,
+0xC0, 0xAF, 0x7C, 0x76, 0x11, 0x5A, 0x95, 0x42, 0xA6, 0x32, 0x0C, 0x0E, 0x8D, 0x64, 0x8D, 0x9E,
+0x0C, 0x11, 0x4A, 0x8F, 0x5C, 0x00, 0x51, 0x6A, 0x51, 0x6A, 0x6F, 0x00, 0x6A, 0x51, 0xC0, 0x8F,
+0x00, 0x51, 0x02, 0xC6, 0x5C, 0x2A, 0x5C, 0x2A, 0x11, 0x2A, 0x5C, 0x00, 0xC2, 0x9A, 0x89, 0x11,
+0x00, 0x7B, 0x00, 0x51, 0x6A, 0xC6, 0xCE, 0x00, 0x31, 0x0B, 0x00, 0x05, 0x02, 0x07, 0xC3, 0xBD,
+0x3F, 0x05, 0x00, 0x15, 0xCC, 0x6B, 0x65, 0x13, 0x7A, 0xBE, 0x13, 0xBE, 0x13, 0x80, 0x3D, 0x13,
+0x7D, 0x13, 0x00, 0x7D, 0x00, 0xC4, 0x7A, 0x65, 0xD4, 0x21, 0x22, 0x00, 0xC1, 0x40, 0x22, 0x00,
+0xC1, 0x93, 0x22, 0x01, 0x4F, 0x62, 0x04, 0x40, 0x10, 0x41, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x00,
+0x4B, 0x40, 0x03, 0x41, 0x52, 0x6D, 0x40, 0x0D, 0x41, 0x40, 0x05, 0x52, 0x71, 0xC4, 0xD6, 0x0D,
+0x07, 0x2E, 0x07, 0x16, 0xC7, 0xCB, 0x79, 0xF2, 0x3C, 0x2C, 0x57, 0x2C, 0x57, 0x00, 0x6C, 0xCD,
+0x57, 0x2C, 0x57, 0x2C, 0x57, 0x2C, 0x57, 0x3C, 0x1D, 0x57, 0xE1, 0x00, 0x0B, 0x00, 0x29, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41,
+0x40, 0x01, 0x4B, 0x00, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x4B, 0x40, 0x00, 0x52, 0x40,
+0x00, 0x4B, 0x40, 0x00, 0x67, 0x40, 0x01, 0x67, 0x40, 0x71, 0x6D, 0xC5, 0x9B, 0xF0, 0xD3, 0x12,
+0x0B, 0x00, 0x00, 0x71, 0x40, 0x4B, 0x40, 0x52, 0x00, 0x4B, 0x52, 0xC1, 0xB3, 0x2C, 0x01, 0x5D,
+0xC5, 0x57, 0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x00, 0xC1, 0x57, 0x1D, 0x00, 0xC2, 0x57, 0xA1, 0x07,
+0x07, 0xC8, 0xBA, 0x07, 0x79, 0x0D, 0xBA, 0x2E, 0x07, 0x0D, 0x07, 0x07, 0x6E, 0xC1, 0x43, 0x19,
+0x01, 0xC0, 0x43, 0x01, 0x59, 0xC3, 0x43, 0x19, 0xD2, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x06, 0x5B, 0x50, 0x49, 0x00,
+0xC1, 0x41, 0x09, 0x00, 0x55, 0x49, 0x06, 0x5B, 0x5C, 0x42, 0x09, 0x40, 0x52, 0x40, 0xC2, 0x89,
+0xBC, 0x2A, 0x02, 0xC7, 0x5C, 0x2A, 0x11, 0x32, 0x11, 0x2F, 0x95, 0x3E, 0x00, 0xCC, 0x6B, 0x25,
+0x2D, 0xAF, 0x44, 0x64, 0xB0, 0x9A, 0x42, 0x2F, 0x4A, 0x0C, 0x0E, 0x01, 0x63, 0x4E, 0x63, 0xC6,
+0x63, 0x2F, 0x8F, 0x2F, 0x11, 0x2A, 0x5C, 0x00, 0x6A, 0xC3, 0x5C, 0x6C, 0x5C, 0x11, 0x00, 0x6F,
+0x51, 0xC3, 0x5C, 0x2A, 0x2F, 0x11, 0x00, 0x6A, 0x01, 0x51, 0xC6, 0xB0, 0x9A, 0x95, 0x26, 0xA7,
+0x2F, 0x2A, 0x01, 0xC2, 0x75, 0x95, 0x00, 0x00, 0x52, 0x40, 0x45, 0x42, 0x09, 0xC1, 0xAA, 0x00,
+0x00, 0x52, 0x40, 0x12, 0xC6, 0xB7, 0x3D, 0x80, 0x3D, 0x80, 0x3D, 0x13, 0x00, 0xC5, 0x8B, 0x13,
+0x80, 0x3D, 0x94, 0x13, 0x00, 0x7D, 0xC7, 0xBE, 0x13, 0x94, 0x05, 0x0F, 0x40, 0x22, 0x1E, 0x00,
+0x4F, 0xC4, 0x40, 0x22, 0x0F, 0x40, 0x1E, 0x00, 0xC4, 0x93, 0x40, 0x93, 0x40, 0x00, 0x10, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07, 0x07, 0xC9, 0x79, 0x0D, 0x07,
+0x2E, 0x4B, 0x2E, 0x0D, 0x79, 0x4B, 0x0D, 0x00, 0x47, 0x05, 0x4D, 0x47, 0xC7, 0xA1, 0x57, 0x2C,
+0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x03, 0x6C, 0x00, 0x7C, 0x5D, 0x6C, 0xC6, 0x57, 0xE1, 0x00, 0x47,
+0x00, 0x0B, 0x00, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x02, 0x41, 0x40, 0x03, 0x41, 0x40, 0x4B,
+0x01, 0x40, 0x0A, 0x41, 0x40, 0x01, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40,
+0x02, 0x45, 0x00, 0x40, 0x02, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xCF, 0x8A, 0x03, 0x04, 0x21,
+0x28, 0x00, 0x21, 0x05, 0x01, 0x04, 0x02, 0x12, 0x00, 0x27, 0x00, 0x02, 0x00, 0x40, 0x45, 0x44,
+0x41, 0x40, 0x01, 0xC8, 0xD3, 0x63, 0x3A, 0x2D, 0x31, 0x0B, 0x01, 0x05, 0x00, 0x00, 0x42, 0x44,
+0x41, 0x6D, 0x71, 0x6D, 0x5D, 0x6C, 0xC7, 0x69, 0xA8, 0x69, 0x1D, 0x69, 0xBF, 0x69, 0x57, 0x00,
+0x5D, 0x7C, 0xC4, 0xA8, 0x69, 0x2C, 0xA1, 0x07, 0x07, 0x4D, 0x00, 0xC7, 0x45, 0x38, 0x07, 0xCB,
+0x46, 0x4D, 0x4B, 0x07, 0x00, 0x4D, 0x47, 0x03, 0x6E, 0xC1, 0x43, 0x19, 0x01, 0xC7, 0x5F, 0x75,
+0x43, 0x19, 0x43, 0x19, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x15, 0x09, 0x05, 0x50, 0x73, 0x00, 0x5B, 0x50, 0x60, 0x55, 0xC7,
+0xA5, 0x33, 0x10, 0x09, 0x10, 0x09, 0x15, 0x09, 0x01, 0x50, 0x42, 0x08, 0x44, 0x42, 0x41, 0x40,
+0x71, 0xD9, 0x89, 0x6C, 0x5C, 0x2A, 0x2B, 0x42, 0x2B, 0x42, 0x84, 0x90, 0x36, 0x2A, 0x95, 0x5A,
+0x64, 0x6B, 0xC0, 0x47, 0x6B, 0x44, 0x3B, 0x5A, 0x95, 0x42, 0x32, 0x23, 0x00, 0xCD, 0x8D, 0x23,
+0x0E, 0x9E, 0x8D, 0x0C, 0x0E, 0x11, 0x8F, 0x2F, 0x42, 0x2A, 0xDB, 0x2A, 0x02, 0x6F, 0x6A, 0x51,
+0x01, 0x6A, 0x00, 0xCD, 0x8F, 0x2F, 0x11, 0x2A, 0x42, 0x2A, 0x42, 0x3E, 0xA4, 0x4A, 0xB0, 0x5A,
+0x2F, 0x2B, 0x00, 0x6A, 0x00, 0xC1, 0x95, 0x00, 0x00, 0x52, 0x40, 0x45, 0x42, 0x43, 0x48, 0x42,
+0x00, 0x44, 0x42, 0x03, 0x45, 0x40, 0x15, 0xC4, 0x6B, 0x3D, 0x13, 0xBE, 0x13, 0x02, 0xC5, 0x56,
+0x3D, 0x56, 0x6A, 0x76, 0x13, 0x01, 0xC9, 0xBE, 0x13, 0x94, 0x22, 0x93, 0x22, 0x90, 0x60, 0x26,
+0x3F, 0x00, 0x62, 0x7F, 0x68, 0x76, 0x00, 0x62, 0xC0, 0x40, 0x00, 0x4F, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0x4D, 0x00, 0xC4, 0x4B, 0x4D,
+0x45, 0x2E, 0x0D, 0x00, 0xC5, 0x45, 0x4B, 0x0D, 0x45, 0x4B, 0x07, 0x05, 0xD2, 0xBA, 0x07, 0xA1,
+0x2C, 0x1D, 0x69, 0xBF, 0x9A, 0x1D, 0x57, 0xBF, 0x69, 0x57, 0x69, 0x1D, 0x2C, 0x3C, 0x69, 0x2C,
+0x00, 0xC2, 0x40, 0x12, 0x00, 0x00, 0x41, 0x45, 0x40, 0x4B, 0x45, 0x44, 0x45, 0x42, 0x44, 0x42,
+0x41, 0x40, 0x03, 0x42, 0x40, 0x45, 0x44, 0x42, 0x41, 0x67, 0x4B, 0x40, 0x42, 0x43, 0x42, 0x40,
+0x41, 0x45, 0x40, 0x02, 0x41, 0x45, 0x40, 0x00, 0x45, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x03, 0x41, 0x42, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x40, 0x4E, 0x48, 0x40, 0x02,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xCC, 0x70, 0x03, 0x28, 0x1C, 0x8D, 0x00, 0x0A, 0x03, 0x08,
+0x1C, 0x08, 0x28, 0x00, 0x00, 0x61, 0x48, 0xCC, 0x6D, 0x04, 0x03, 0x04, 0x05, 0x00, 0x31, 0x00,
+0x0B, 0x2D, 0xC0, 0x0B, 0x00, 0x00, 0x4A, 0x48, 0x40, 0x45, 0x43, 0x44, 0x45, 0x52, 0x4B, 0x52,
+0xC9, 0xB3, 0x1D, 0x4A, 0x7E, 0x54, 0xBF, 0x91, 0x69, 0x91, 0x7E, 0x00, 0xC6, 0xB3, 0xA8, 0x7E,
+0x91, 0x69, 0xA1, 0x07, 0x07, 0xC3, 0x4B, 0x4D, 0xC2, 0x4B, 0x00, 0xC4, 0x55, 0x87, 0x55, 0xC6,
+0x0D, 0x00, 0x47, 0x04, 0x6E, 0xC1, 0x9F, 0x19, 0x00, 0xC8, 0x43, 0x2A, 0x2B, 0x5F, 0x19, 0x43,
+0x19, 0xD2, 0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40,
+0x0F, 0xC4, 0x4F, 0x7B, 0x09, 0x10, 0x09, 0x03, 0xCB, 0x82, 0x1A, 0x78, 0x20, 0x1A, 0xE0, 0x10,
+0x66, 0x1A, 0x72, 0x1B, 0x09, 0x00, 0x55, 0x49, 0x00, 0xC2, 0x62, 0x1B, 0x02, 0x07, 0x4E, 0x00,
+0x61, 0x67, 0x40, 0x00, 0xDF, 0x95, 0x6C, 0x11, 0x3B, 0x0E, 0x71, 0x3E, 0x11, 0x2A, 0x9A, 0xEF,
+0x84, 0x9A, 0xB0, 0x2B, 0x50, 0xC0, 0xAF, 0xE4, 0x71, 0x2B, 0xB0, 0x26, 0x42, 0x32, 0x35, 0x9E,
+0x8D, 0x23, 0x0C, 0x8D, 0x0E, 0xC2, 0x9E, 0x0E, 0x2F, 0x00, 0xCA, 0xA7, 0xB0, 0x9A, 0xB0, 0x58,
+0x59, 0x58, 0x9A, 0x59, 0x9A, 0xB0, 0x00, 0xC1, 0x58, 0x9A, 0x00, 0xD2, 0x5A, 0xB0, 0x26, 0xB0,
+0x5A, 0xD2, 0x58, 0x5A, 0x2F, 0x95, 0x26, 0x11, 0x9B, 0x71, 0x6A, 0x34, 0x11, 0x52, 0x00, 0x02,
+0x45, 0x44, 0x4E, 0x4A, 0x48, 0x4A, 0x63, 0x42, 0x03, 0x45, 0x40, 0x15, 0xD0, 0x6B, 0x94, 0x13,
+0x80, 0x13, 0x3D, 0xDF, 0x4C, 0xC4, 0x56, 0x13, 0x6A, 0x9E, 0x13, 0x3D, 0x7D, 0x13, 0x00, 0xD2,
+0x94, 0x1F, 0x93, 0x40, 0x04, 0x49, 0x3F, 0x5A, 0x36, 0x30, 0x26, 0x36, 0x54, 0x26, 0x22, 0x40,
+0x93, 0x40, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E,
+0x07, 0x04, 0x4D, 0x00, 0xCB, 0x4D, 0x39, 0xBB, 0x45, 0x38, 0x4D, 0xC2, 0x38, 0x46, 0xC2, 0x4B,
+0x07, 0x04, 0x6E, 0x4D, 0x47, 0xD6, 0xA1, 0x57, 0x1D, 0x91, 0x7E, 0x54, 0xBF, 0x91, 0xA8, 0x91,
+0x7E, 0xBF, 0x1D, 0x3C, 0x2F, 0x91, 0x2C, 0x57, 0x40, 0x12, 0x0B, 0x01, 0x0A, 0x00, 0x40, 0x00,
+0x48, 0x44, 0x4A, 0x45, 0x43, 0x4E, 0x40, 0x03, 0x42, 0x63, 0x41, 0x43, 0x00, 0xC9, 0x44, 0x08,
+0x00, 0x0B, 0x00, 0x0A, 0x04, 0x0A, 0x05, 0x0A, 0x00, 0x40, 0x02, 0x48, 0x4E, 0x40, 0x48, 0x4E,
+0x4B, 0x67, 0x41, 0x40, 0x07, 0x41, 0x40, 0x03, 0x43, 0x4E, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40,
+0x01, 0x42, 0x4A, 0x00, 0x45, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x01, 0x4B, 0x4A, 0xC8,
+0x49, 0x04, 0x1C, 0x49, 0x02, 0x86, 0x08, 0x03, 0x00, 0x00, 0x52, 0x40, 0x00, 0x44, 0x5C, 0x42,
+0x4A, 0x00, 0x43, 0x45, 0x40, 0x52, 0x40, 0x00, 0x4B, 0x00, 0x40, 0x00, 0x61, 0x48, 0x43, 0x40,
+0x42, 0x4E, 0x43, 0x62, 0x40, 0xCB, 0x47, 0xD9, 0xB3, 0x57, 0x54, 0x7E, 0x4A, 0x91, 0x85, 0xB3,
+0x1D, 0xBF, 0x00, 0x5D, 0x00, 0xC6, 0x69, 0x91, 0x57, 0xA1, 0x07, 0x2E, 0x07, 0x05, 0x4D, 0xCB,
+0xDC, 0xB9, 0xC3, 0x07, 0x39, 0x9C, 0xA0, 0x38, 0x0D, 0x07, 0x0D, 0x07, 0x03, 0x6E, 0xC1, 0x43,
+0x19, 0x00, 0xC4, 0x43, 0x75, 0x2B, 0x5F, 0x19, 0x01, 0xC1, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0x55, 0x50,
+0xC8, 0xCF, 0x20, 0x66, 0xCF, 0x92, 0x88, 0x10, 0x66, 0x10, 0x00, 0x49, 0x03, 0x50, 0x5C, 0x42,
+0x05, 0x43, 0x4E, 0x48, 0xC2, 0xAA, 0x01, 0x00, 0x00, 0xC1, 0x95, 0x6C, 0x00, 0xD5, 0x53, 0x9D,
+0xB8, 0x4C, 0x71, 0x11, 0x2B, 0x2F, 0x8F, 0x95, 0xB0, 0x2B, 0x3B, 0x53, 0x50, 0xA9, 0x11, 0x2B,
+0xB0, 0x26, 0xA6, 0x4A, 0x00, 0xC1, 0x77, 0x0C, 0x01, 0xC0, 0x77, 0x00, 0x63, 0x76, 0x6F, 0xC2,
+0x84, 0xE1, 0x26, 0x00, 0xC7, 0x59, 0x26, 0x59, 0x63, 0x26, 0x95, 0x26, 0x59, 0x00, 0x66, 0xC4,
+0x59, 0x26, 0x9A, 0x36, 0x26, 0x00, 0xC1, 0x63, 0x59, 0x00, 0xC0, 0xA4, 0x00, 0xC4, 0x84, 0x11,
+0x64, 0x4C, 0x7C, 0x00, 0xC3, 0xCC, 0x34, 0x63, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4A, 0x48, 0x42,
+0x4E, 0x42, 0x03, 0x45, 0x40, 0x15, 0x65, 0x53, 0x00, 0xC1, 0x8B, 0x13, 0x00, 0xC2, 0x94, 0x6F,
+0x88, 0x00, 0xD4, 0xDF, 0x6F, 0x56, 0x3D, 0x13, 0x80, 0x13, 0x80, 0x65, 0x22, 0x0F, 0x40, 0x89,
+0x54, 0x30, 0x49, 0x0F, 0x54, 0x26, 0x3F, 0x30, 0x00, 0x7F, 0xC3, 0x93, 0x40, 0x0F, 0x00, 0x10,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x05, 0xC6, 0xCB,
+0x0D, 0x81, 0x55, 0xBB, 0xB1, 0x38, 0x00, 0xC5, 0xB9, 0x45, 0xCB, 0xB9, 0x45, 0x07, 0x07, 0xC8,
+0xA1, 0x2C, 0xB3, 0x54, 0x91, 0x4A, 0x91, 0xA7, 0xB3, 0x00, 0xC6, 0xA8, 0x7E, 0xB3, 0x2C, 0xA8,
+0x7E, 0x2C, 0x00, 0xCE, 0x40, 0x12, 0x00, 0x0B, 0x02, 0x03, 0x00, 0x0B, 0x00, 0x02, 0x03, 0x00,
+0x03, 0x05, 0x00, 0x03, 0x48, 0x4A, 0x43, 0x44, 0x68, 0x40, 0x4A, 0x67, 0x4B, 0x00, 0x4A, 0x48,
+0x4E, 0x62, 0x42, 0x43, 0x40, 0x02, 0x45, 0x43, 0x40, 0x45, 0x48, 0x40, 0x00, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x02, 0x41, 0x4A, 0x00, 0x42, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x45, 0x40, 0x01,
+0x4A, 0x48, 0x4A, 0x43, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xD5, 0x70, 0x02, 0x2D,
+0x02, 0x74, 0x0A, 0x08, 0x03, 0x08, 0x1F, 0x04, 0xBD, 0x12, 0x00, 0x02, 0x03, 0x04, 0x0A, 0x03,
+0x02, 0x60, 0x00, 0x06, 0x43, 0x4E, 0x00, 0x40, 0x42, 0xCE, 0x50, 0x02, 0x26, 0x0B, 0x00, 0x12,
+0xB3, 0x3C, 0x91, 0x69, 0x7E, 0x91, 0xA7, 0x3C, 0x7E, 0x01, 0x7C, 0xC5, 0x69, 0x54, 0x69, 0x57,
+0xA1, 0x07, 0x08, 0xC5, 0x81, 0x39, 0xC6, 0x07, 0x4D, 0x6E, 0x00, 0xC1, 0x4D, 0x07, 0x00, 0x4D,
+0x47, 0x03, 0x6E, 0xC1, 0x43, 0x19, 0x00, 0xC8, 0x5F, 0x75, 0x6C, 0x75, 0x19, 0x43, 0x19, 0xD2,
+0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2,
+0x4F, 0x62, 0x09, 0x05, 0xCB, 0x82, 0x66, 0x20, 0x1A, 0x66, 0x1A, 0x66, 0x78, 0x33, 0x78, 0x1B,
+0x09, 0x00, 0x55, 0x49, 0x01, 0x5B, 0x42, 0x06, 0x4E, 0x63, 0x4E, 0x42, 0x41, 0x40, 0x00, 0xD3,
+0x89, 0x11, 0x34, 0xB8, 0xC0, 0x0B, 0x7C, 0xA5, 0x34, 0x2B, 0x5C, 0xBC, 0x63, 0xD2, 0x2A, 0x42,
+0x2B, 0x11, 0x2B, 0x11, 0x00, 0xC2, 0x58, 0x9A, 0x42, 0x00, 0x4E, 0xC4, 0x5A, 0x0E, 0x0A, 0x70,
+0x0A, 0x01, 0xCA, 0x84, 0x2A, 0xA7, 0xA4, 0x11, 0x3B, 0x50, 0x53, 0x3B, 0x2B, 0x2A, 0x00, 0x6B,
+0xC3, 0x84, 0x50, 0x86, 0x11, 0x01, 0xD1, 0xDB, 0x32, 0x71, 0x76, 0x64, 0x32, 0x4A, 0xA4, 0x11,
+0x3B, 0x76, 0xD8, 0x25, 0x6B, 0x65, 0x76, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x4E, 0x48, 0x42, 0x00,
+0x4E, 0x42, 0x03, 0x45, 0x40, 0x15, 0xCD, 0x6B, 0x3D, 0x13, 0xBE, 0x13, 0x3D, 0x13, 0x9E, 0x6A,
+0x9E, 0x56, 0xA9, 0x65, 0x13, 0x00, 0x7D, 0xC7, 0x80, 0x13, 0x94, 0x1F, 0x93, 0x40, 0x04, 0x58,
+0x00, 0xCB, 0x5A, 0x3F, 0x49, 0x58, 0x36, 0x17, 0x58, 0x37, 0x40, 0x22, 0x40, 0x00, 0x10, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x06, 0x4D, 0xCB, 0x4D, 0xB1,
+0x39, 0x55, 0x4B, 0x0D, 0x39, 0x45, 0x0D, 0x39, 0x45, 0x07, 0x05, 0x4D, 0x47, 0xC5, 0xA1, 0x57,
+0x1D, 0x91, 0x9A, 0x7E, 0x00, 0xDA, 0x91, 0x3C, 0xA8, 0x7E, 0x91, 0x3C, 0x1D, 0x69, 0x91, 0xFA,
+0x2C, 0x40, 0x12, 0x0B, 0x00, 0x05, 0x50, 0x0B, 0x01, 0x04, 0x08, 0x01, 0x05, 0x08, 0x00, 0x01,
+0x00, 0x01, 0x45, 0x4E, 0xC3, 0x44, 0x0E, 0x08, 0x02, 0x00, 0x48, 0x4B, 0x00, 0x40, 0x4A, 0x45,
+0x43, 0x44, 0x41, 0x43, 0x40, 0x02, 0x41, 0x48, 0x40, 0x00, 0x48, 0x40, 0x00, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x02, 0x44, 0x4E, 0x48, 0x4A, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x42,
+0x40, 0x41, 0x44, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xC1, 0x51, 0x08, 0x00, 0x42,
+0xC3, 0xAA, 0x04, 0x02, 0x21, 0x00, 0x48, 0x43, 0x41, 0x40, 0x00, 0xC7, 0x47, 0x03, 0x44, 0x27,
+0x04, 0x08, 0x05, 0x00, 0x02, 0x52, 0x00, 0x40, 0x00, 0x4B, 0x45, 0x42, 0x45, 0x5F, 0x5C, 0x48,
+0x45, 0x52, 0xC4, 0x47, 0x2D, 0x1D, 0x2C, 0x7E, 0x01, 0x5D, 0xC5, 0xA8, 0x91, 0xA8, 0x69, 0x91,
+0x7E, 0x00, 0xC4, 0x91, 0x7E, 0x57, 0xA1, 0x07, 0x09, 0xC4, 0x46, 0x4B, 0x45, 0xBA, 0x39, 0x00,
+0xC2, 0x4B, 0x0D, 0x07, 0x05, 0x6E, 0xC1, 0x43, 0x19, 0x00, 0xC1, 0x43, 0x75, 0x00, 0xC5, 0x5F,
+0x19, 0x43, 0x19, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x05, 0x60, 0xC1, 0x78, 0x1A, 0x00, 0x50, 0x00, 0x73, 0x00,
+0xC2, 0x78, 0x20, 0x09, 0x03, 0xC4, 0x62, 0x09, 0x10, 0x1C, 0x02, 0x06, 0x43, 0x00, 0x42, 0x41,
+0x52, 0x40, 0xC4, 0x95, 0x3B, 0x52, 0x7C, 0x47, 0x00, 0xC3, 0xAF, 0x4C, 0x71, 0x2A, 0x00, 0xC5,
+0xBC, 0x95, 0x85, 0x2A, 0x11, 0x5C, 0x00, 0x6A, 0x6F, 0x00, 0xC2, 0x9A, 0x63, 0x42, 0x00, 0xC1,
+0x84, 0x58, 0x00, 0x43, 0x4A, 0xC0, 0x86, 0x00, 0xCB, 0x58, 0x84, 0x2A, 0x84, 0xC5, 0x64, 0xB6,
+0xE9, 0x7C, 0x44, 0x11, 0x2A, 0x00, 0xC6, 0x84, 0xB7, 0xC0, 0xE7, 0x59, 0x2B, 0x2A, 0x00, 0xCB,
+0x71, 0x7C, 0xE9, 0xD4, 0x3E, 0x84, 0xA4, 0x11, 0x9B, 0x65, 0x6B, 0x2D, 0x00, 0xC5, 0x7C, 0x76,
+0x1C, 0x00, 0x12, 0x00, 0x00, 0x45, 0x44, 0x4E, 0x4A, 0x43, 0x42, 0x43, 0x42, 0x03, 0x45, 0x40,
+0x15, 0xC1, 0x6B, 0x13, 0x00, 0xC3, 0x8B, 0x13, 0x7D, 0x56, 0x00, 0xC1, 0xDF, 0x56, 0x01, 0xD8,
+0x7A, 0x3D, 0x7D, 0x13, 0x7A, 0x8B, 0x65, 0x22, 0x0F, 0x40, 0x3F, 0x04, 0x1E, 0x26, 0x30, 0x90,
+0x37, 0x36, 0x30, 0x26, 0x40, 0x93, 0x40, 0x0F, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0x4D, 0x47, 0xCB, 0x45, 0x39, 0x6E, 0x4B, 0x45, 0x0D,
+0x46, 0x4B, 0x0D, 0x46, 0x4B, 0x07, 0x04, 0x6E, 0xC3, 0xBA, 0x07, 0xA1, 0x1D, 0x00, 0xD0, 0xA8,
+0x91, 0x7E, 0x3C, 0xA8, 0x91, 0xA8, 0x57, 0x54, 0x7E, 0x57, 0x3C, 0xBF, 0x2C, 0x57, 0x40, 0x00,
+0x01, 0x41, 0x42, 0x41, 0x61, 0x43, 0x48, 0x44, 0x45, 0x42, 0x40, 0x03, 0x42, 0x00, 0x40, 0x42,
+0x43, 0x48, 0x43, 0x45, 0x52, 0x4B, 0x40, 0xC6, 0x44, 0x08, 0x03, 0x31, 0x01, 0x02, 0x00, 0x02,
+0x41, 0x42, 0x40, 0x41, 0x42, 0x67, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x02, 0x44, 0x41, 0x40,
+0x44, 0x41, 0x40, 0x01, 0x41, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x05,
+0x4B, 0x40, 0x05, 0x42, 0x48, 0x00, 0x42, 0x40, 0x06, 0x4B, 0xC1, 0x47, 0x31, 0x00, 0x40, 0x08,
+0x52, 0x40, 0x52, 0xC1, 0xB3, 0x1D, 0x01, 0x7C, 0x5D, 0x00, 0x6C, 0x00, 0x5D, 0x00, 0x6C, 0x00,
+0x5D, 0x00, 0x6C, 0xC1, 0xA1, 0x07, 0x0A, 0x4D, 0x47, 0x02, 0x4D, 0x47, 0x06, 0xC2, 0x79, 0x43,
+0x19, 0x02, 0xC1, 0x43, 0x19, 0x01, 0xC2, 0x43, 0xD2, 0x00, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x04,
+0xC0, 0x41, 0x00, 0x50, 0xC6, 0x41, 0x09, 0x41, 0x15, 0x41, 0x15, 0x09, 0x01, 0x55, 0x49, 0x01,
+0x5B, 0x42, 0x0A, 0x4B, 0x52, 0x40, 0xCE, 0x89, 0x6C, 0xA9, 0x7C, 0x47, 0x0B, 0x25, 0x44, 0x3E,
+0x2B, 0x2A, 0x6C, 0x36, 0xB0, 0x2A, 0x03, 0xC4, 0x5C, 0x2A, 0x58, 0x36, 0x2B, 0x00, 0xDF, 0x42,
+0xA6, 0x42, 0x23, 0x68, 0x32, 0xA6, 0x2B, 0x11, 0x2A, 0x84, 0x89, 0x86, 0xAF, 0xC0, 0xAF, 0x65,
+0x34, 0x2A, 0x11, 0x59, 0x6B, 0xC0, 0x6B, 0x9D, 0x2F, 0x2A, 0x11, 0x9D, 0x0B, 0x47, 0xD8, 0xCC,
+0x76, 0x54, 0xA4, 0x11, 0x3B, 0x4C, 0x6B, 0x12, 0x0B, 0x7C, 0x76, 0x8A, 0x00, 0x02, 0x45, 0x42,
+0x09, 0x45, 0x40, 0x15, 0x65, 0xC4, 0x94, 0x13, 0x7A, 0x3D, 0x13, 0x00, 0xC2, 0x7D, 0x13, 0x7D,
+0x00, 0x53, 0x05, 0xC3, 0x65, 0x3A, 0x40, 0x22, 0x00, 0xC2, 0x40, 0x22, 0x0F, 0x00, 0x62, 0x4F,
+0x01, 0xC5, 0x40, 0x22, 0x93, 0x22, 0x93, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x07, 0xC2, 0xD6, 0x2E, 0x07, 0x05, 0x4D, 0x00, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0xC1,
+0x79, 0x07, 0x0A, 0xC3, 0xA1, 0x3C, 0x2C, 0x1D, 0x03, 0x6C, 0x00, 0x5D, 0x01, 0x6C, 0x00, 0x5D,
+0x6C, 0x00, 0xC1, 0xE1, 0x00, 0x16, 0x41, 0x43, 0x48, 0x00, 0x41, 0x40, 0x03, 0x42, 0x48, 0x00,
+0x42, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x42, 0x40, 0x41, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x0E, 0x6D, 0x41, 0x00, 0x6D, 0xCA,
+0x47, 0x27, 0x2D, 0x31, 0x01, 0x2D, 0x31, 0x01, 0x2D, 0x27, 0x01, 0x04, 0x6D, 0xC7, 0x47, 0x01,
+0x2D, 0x31, 0x01, 0x25, 0x2D, 0x00, 0x01, 0x6D, 0x41, 0xCA, 0x47, 0x01, 0x27, 0x0B, 0x01, 0x27,
+0x2D, 0x01, 0x47, 0x27, 0x3C, 0x02, 0x6C, 0xC8, 0x57, 0x2C, 0x3C, 0x1D, 0x3C, 0x1D, 0x3C, 0x1D,
+0x3C, 0x00, 0xC5, 0x57, 0x67, 0x0D, 0x38, 0x79, 0x38, 0x0B, 0xC5, 0x81, 0x38, 0x81, 0x38, 0x79,
+0x38, 0x04, 0xC0, 0x43, 0x06, 0x59, 0xC4, 0x43, 0xC8, 0x2D, 0x31, 0x01, 0x0E, 0x40, 0x41, 0x08,
+0x40, 0x45, 0x40, 0x41, 0x0D, 0x40, 0x41, 0x45, 0x40, 0x41, 0x0F, 0x40, 0x41, 0x0C, 0xC3, 0x4F,
+0x7B, 0x09, 0x10, 0x13, 0xC1, 0xA5, 0x10, 0x00, 0x44, 0x42, 0x09, 0x41, 0x67, 0xC5, 0x47, 0x89,
+0x6C, 0x3B, 0x4C, 0x6B, 0x00, 0xC4, 0x7A, 0x76, 0x3B, 0x2B, 0x5C, 0x00, 0x76, 0xC2, 0xB0, 0x2B,
+0x11, 0x00, 0x4E, 0x7B, 0x6B, 0xC4, 0x42, 0xD2, 0xA4, 0x2B, 0x42, 0x01, 0x6B, 0x51, 0x63, 0x6B,
+0xDF, 0x42, 0x2B, 0x2F, 0x2A, 0xA7, 0x89, 0x3E, 0x25, 0xAF, 0xC0, 0x4C, 0x3E, 0x5C, 0x42, 0x86,
+0xC0, 0x47, 0x6B, 0x4C, 0x11, 0x42, 0x11, 0x65, 0xAF, 0x47, 0x6B, 0x52, 0x64, 0xA4, 0x3B, 0x2B,
+0xA9, 0xC7, 0x7C, 0x47, 0xAF, 0x7A, 0x52, 0x50, 0x00, 0x01, 0x00, 0x40, 0x42, 0x08, 0x44, 0x42,
+0x00, 0x40, 0x15, 0xC4, 0x4F, 0x4C, 0x13, 0x4C, 0x13, 0x01, 0xC1, 0x4C, 0x13, 0x00, 0xC3, 0x4C,
+0x13, 0x65, 0x13, 0x03, 0xC2, 0x65, 0x90, 0x22, 0x00, 0xC4, 0x90, 0x22, 0x90, 0x93, 0x90, 0x01,
+0x62, 0xC0, 0x90, 0x00, 0x62, 0xC0, 0x90, 0x00, 0x62, 0xC1, 0x47, 0x01, 0x11, 0x40, 0x41, 0x0A,
+0x40, 0x41, 0x0E, 0x40, 0x41, 0x05, 0x67, 0xC2, 0xD6, 0xCB, 0x38, 0x05, 0xC2, 0xDC, 0x81, 0x38,
+0x01, 0xC1, 0x79, 0x38, 0x00, 0x4D, 0x78, 0x07, 0xCC, 0x79, 0xCB, 0x38, 0xA1, 0x3C, 0x57, 0x1D,
+0x3C, 0x1D, 0x57, 0x3C, 0x1D, 0x3C, 0x00, 0x5D, 0xC1, 0x57, 0x3C, 0x02, 0xC5, 0x57, 0xE1, 0x0B,
+0x01, 0x47, 0x01, 0x00, 0x4B, 0x67, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x03, 0x4B, 0x67,
+0x41, 0x4B, 0x67, 0x41, 0x01, 0xC1, 0x47, 0x01, 0x01, 0x52, 0x41, 0x01, 0x40, 0x41, 0x02, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x02, 0x40, 0x41, 0x03, 0x40, 0x41, 0x04, 0x4B, 0x41, 0x00, 0x40, 0x41,
+0x03, 0x40, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x02, 0x43, 0x00, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x66, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0xC2, 0x59, 0x9B, 0x3B, 0x00, 0x4A, 0x43, 0x66, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x66, 0x48, 0x00, 0x66, 0xC1, 0x85, 0x7E, 0x05, 0xC3, 0x54, 0x7E, 0x54, 0x7E, 0x00, 0xC1,
+0x54, 0x7E, 0x00, 0x7E, 0x79, 0xC3, 0xA0, 0xEC, 0x61, 0x39, 0x02, 0xC8, 0xA0, 0x39, 0x61, 0x39,
+0x61, 0x6E, 0x61, 0x39, 0x61, 0x00, 0x79, 0xC1, 0x61, 0x39, 0x04, 0xC2, 0x87, 0x75, 0x2A, 0x05,
+0xC5, 0x75, 0x2A, 0x9B, 0x74, 0x08, 0x03, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43,
+0x01, 0x48, 0x01, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43,
+0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x48, 0x00,
+0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x66, 0xC2, 0x59, 0x70, 0xAB, 0x00,
+0xC0, 0x72, 0x05, 0x5A, 0xC0, 0x72, 0x08, 0x5A, 0xC1, 0xAB, 0x72, 0x01, 0xC1, 0x92, 0x0A, 0x00,
+0x4E, 0x00, 0x4A, 0x4E, 0x4A, 0x4E, 0x00, 0x4A, 0x00, 0x4E, 0x48, 0x00, 0x43, 0xC4, 0x59, 0x6C,
+0x11, 0x64, 0x76, 0x00, 0xC3, 0x6A, 0x64, 0x2B, 0x5C, 0x01, 0xC4, 0x63, 0xB0, 0x42, 0x71, 0xB8,
+0x00, 0xC6, 0x44, 0x34, 0x2B, 0xB0, 0x9A, 0x42, 0x2B, 0x00, 0xC4, 0x42, 0xA6, 0x42, 0xA6, 0x2B,
+0x00, 0x51, 0x00, 0xD1, 0x42, 0x84, 0x89, 0x3B, 0x50, 0xE9, 0xD4, 0x76, 0x9B, 0x5C, 0xBC, 0x2F,
+0x44, 0xAF, 0x8A, 0x34, 0x11, 0x5C, 0x00, 0xD4, 0x71, 0x7C, 0x25, 0x67, 0xC2, 0x4A, 0xA4, 0x85,
+0x84, 0x23, 0x53, 0x65, 0x4C, 0x53, 0x3B, 0x84, 0x26, 0x03, 0x08, 0x03, 0x0A, 0x00, 0x4E, 0x4A,
+0x4E, 0x00, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x43, 0x41, 0x15, 0xC2, 0xB8, 0xA9, 0x6F, 0x00,
+0xD3, 0x88, 0xA9, 0x1A, 0xA9, 0x6F, 0x92, 0x6F, 0xA9, 0x6F, 0x88, 0xA9, 0x92, 0x6F, 0x88, 0x6F,
+0x58, 0x30, 0x58, 0x30, 0x58, 0x00, 0x70, 0xC0, 0x58, 0x00, 0x70, 0xC0, 0x58, 0x03, 0x70, 0xC3,
+0x58, 0x26, 0x08, 0x03, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x02, 0x43, 0x00, 0x48, 0x43,
+0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x02, 0x43, 0x00, 0x48, 0x43, 0xC5, 0x50, 0x59,
+0x08, 0x74, 0x6F, 0x39, 0x05, 0xC3, 0x61, 0x39, 0x61, 0x39, 0x00, 0xC1, 0x61, 0x39, 0x01, 0xC8,
+0x61, 0x39, 0xA0, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x00, 0xC7, 0xA0, 0xB9, 0x39, 0x34, 0xBF,
+0x7E, 0x54, 0x7E, 0x00, 0xC3, 0x54, 0x7E, 0x54, 0x7E, 0x00, 0xC1, 0x54, 0x7E, 0x01, 0xC1, 0x54,
+0x7E, 0x00, 0xC7, 0x85, 0x03, 0x08, 0x26, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x66, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x00, 0x48, 0x00,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x44, 0x41, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x19, 0x71, 0x40, 0xC4, 0x6C, 0x2B, 0xC7, 0x2D, 0x00, 0x07, 0x4B, 0x52, 0xC6, 0xB3, 0x2C,
+0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x00, 0x6C, 0x5D, 0x6C, 0x5D, 0x02, 0x6C, 0xC1, 0xA1, 0x07, 0x04,
+0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x6E, 0x47, 0x02, 0x6E, 0x47, 0x00, 0x4D, 0x47, 0x4D, 0x47,
+0x4D, 0x47, 0x6E, 0xC1, 0x43, 0x19, 0x04, 0xC1, 0x43, 0x19, 0x00, 0xC1, 0xC8, 0x00, 0x0E, 0x41,
+0x40, 0x0B, 0x41, 0x40, 0x32, 0xC4, 0x4F, 0x15, 0x09, 0x1B, 0x15, 0x04, 0x50, 0x55, 0x5B, 0x55,
+0x01, 0x5B, 0x55, 0x02, 0xC1, 0x41, 0x15, 0x01, 0x49, 0x5B, 0x69, 0x42, 0x04, 0x61, 0x42, 0x02,
+0x40, 0x01, 0xC3, 0x95, 0x6C, 0x75, 0x2B, 0x00, 0xC5, 0xC2, 0x11, 0x2B, 0x42, 0x2B, 0x5C, 0x00,
+0xC4, 0x95, 0x5A, 0x64, 0x8A, 0xAF, 0x00, 0xDF, 0xD8, 0x76, 0x3B, 0x86, 0x9A, 0x2B, 0x2A, 0x32,
+0x2B, 0xA6, 0x32, 0x42, 0x2B, 0x42, 0x32, 0x3B, 0x42, 0x84, 0xA4, 0x2B, 0x11, 0x4A, 0x9B, 0x2A,
+0x11, 0xBC, 0x2F, 0x11, 0x3B, 0x84, 0x3B, 0x2B, 0x6A, 0xD2, 0x5C, 0x6C, 0x11, 0x4A, 0x9B, 0x3B,
+0x11, 0xB0, 0xA4, 0x95, 0x9A, 0x42, 0x2B, 0x11, 0x3B, 0x2A, 0x75, 0x63, 0x00, 0x02, 0x45, 0x42,
+0x09, 0x45, 0x40, 0x15, 0xC8, 0xB7, 0x7A, 0x3D, 0x7A, 0x8B, 0x94, 0x3D, 0x94, 0x3D, 0x00, 0xCD,
+0xBE, 0x7A, 0x94, 0xBE, 0x3D, 0x8B, 0x94, 0x8B, 0x7A, 0x0F, 0x40, 0x1E, 0x27, 0x1E, 0x00, 0x4F,
+0x5E, 0x07, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC7, 0xD6,
+0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x02, 0x4D, 0x6E, 0x47, 0x4D, 0x02, 0x47, 0x4D, 0x47,
+0x00, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x01, 0xC6, 0xA1, 0x3C, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x00,
+0x6C, 0x5D, 0x00, 0x6C, 0x5D, 0x02, 0x6C, 0x00, 0xC1, 0xE1, 0x00, 0x2B, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x71, 0x6D, 0xC5,
+0x6C, 0xC7, 0xE8, 0x00, 0x31, 0x00, 0x00, 0x6D, 0x40, 0x01, 0x52, 0x00, 0xC4, 0x47, 0x12, 0xB3,
+0x57, 0x1D, 0x00, 0x7C, 0x5D, 0x05, 0x6C, 0xC0, 0x57, 0x00, 0x6C, 0xC3, 0xF2, 0xBA, 0x0D, 0x07,
+0x04, 0x6E, 0x47, 0x00, 0x4D, 0x47, 0x6E, 0x4D, 0x00, 0x47, 0x01, 0xC1, 0x79, 0x07, 0x04, 0xC2,
+0x79, 0x43, 0x19, 0x07, 0xC1, 0xD2, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x31, 0x52, 0xC4,
+0x4F, 0x10, 0x09, 0x10, 0x09, 0x04, 0x55, 0xC4, 0x41, 0x7B, 0x41, 0x15, 0x09, 0x00, 0x55, 0x49,
+0x02, 0xC1, 0x62, 0x09, 0x01, 0x55, 0x56, 0x42, 0x06, 0x45, 0x42, 0x00, 0x41, 0x40, 0x00, 0xDF,
+0x89, 0xBC, 0x5C, 0x11, 0x2A, 0x2B, 0x2A, 0xDB, 0x8F, 0xA7, 0x11, 0x5C, 0x63, 0x5A, 0x34, 0x6B,
+0xAF, 0x47, 0x6B, 0x9D, 0x64, 0x3E, 0x26, 0xA6, 0x4A, 0x3A, 0x63, 0x68, 0xB0, 0xE8, 0x3E, 0xA6,
+0x76, 0xC4, 0x93, 0x3B, 0x4A, 0xA4, 0x5C, 0x00, 0x6A, 0x00, 0xC2, 0x75, 0x11, 0x2F, 0x00, 0xC1,
+0x5C, 0x2B, 0x00, 0x6A, 0x00, 0xC5, 0x5C, 0x8F, 0x11, 0xBC, 0x11, 0x2A, 0x00, 0x51, 0x76, 0x7A,
+0xC3, 0xB0, 0x26, 0xA8, 0x2A, 0x01, 0xC0, 0x75, 0x00, 0xC1, 0x95, 0x00, 0x00, 0x6D, 0x40, 0x45,
+0x42, 0x45, 0x00, 0x42, 0x45, 0x42, 0x04, 0x45, 0x40, 0x15, 0xC3, 0x6B, 0x13, 0x7D, 0x13, 0x01,
+0xC7, 0x7D, 0x13, 0x80, 0x13, 0x7D, 0x3D, 0x8B, 0x13, 0x01, 0xC8, 0x7D, 0x13, 0x7A, 0x0F, 0x1E,
+0xA2, 0x01, 0x1E, 0x27, 0x00, 0x4F, 0x01, 0x67, 0x5E, 0x67, 0x4F, 0x5E, 0xC2, 0xA2, 0x0F, 0x00,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x03, 0x6E,
+0x47, 0x6E, 0x47, 0x4D, 0x00, 0x47, 0x6E, 0x47, 0x4D, 0x6E, 0x47, 0x4D, 0x47, 0x6E, 0x47, 0x01,
+0x4D, 0x47, 0x6E, 0x4D, 0x00, 0xC5, 0xA1, 0x3C, 0x57, 0x1D, 0x57, 0x1D, 0x00, 0x6C, 0x5D, 0x03,
+0x6C, 0x7C, 0x6C, 0x5D, 0x6C, 0xC2, 0xE1, 0x0B, 0x00, 0x17, 0x41, 0x40, 0x10, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x02, 0x42, 0x45, 0x40, 0x02, 0x41, 0x40, 0x00, 0x45,
+0x42, 0x40, 0x00, 0x41, 0x44, 0x43, 0x42, 0x00, 0x45, 0x41, 0x45, 0x40, 0x41, 0x40, 0x02, 0x42,
+0x43, 0x44, 0x61, 0x42, 0x40, 0x42, 0x45, 0x41, 0x43, 0x42, 0x40, 0x01, 0x41, 0x42, 0x44, 0x40,
+0x42, 0x44, 0x40, 0x02, 0x6D, 0xC5, 0x44, 0x2D, 0x12, 0x01, 0x00, 0x05, 0x00, 0x40, 0x00, 0x42,
+0x44, 0x41, 0x52, 0x40, 0x41, 0xC5, 0xB3, 0x2C, 0x57, 0x2C, 0x57, 0x69, 0x00, 0xC3, 0x57, 0x69,
+0x57, 0xBF, 0x00, 0x5D, 0x01, 0xC2, 0x57, 0xA1, 0x07, 0x01, 0x6E, 0x47, 0x00, 0x6E, 0x47, 0x01,
+0x4D, 0xC2, 0x46, 0x38, 0x07, 0x00, 0xC3, 0x6E, 0x46, 0x38, 0x07, 0x00, 0x6E, 0x47, 0x00, 0x6E,
+0x47, 0x00, 0x6E, 0xC3, 0x9F, 0x43, 0x19, 0x43, 0x01, 0xC2, 0x75, 0x2A, 0x19, 0x00, 0xC1, 0xC8,
+0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x32, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0x50, 0x5A, 0x73,
+0x49, 0x60, 0x73, 0x5B, 0x49, 0xC2, 0x99, 0x10, 0x09, 0x01, 0x55, 0x49, 0x01, 0x50, 0x69, 0x42,
+0x05, 0x44, 0x4A, 0x43, 0x42, 0x41, 0x40, 0x52, 0xC3, 0x89, 0x6C, 0x5C, 0x2A, 0x02, 0xC1, 0x42,
+0x95, 0x00, 0xDB, 0x5A, 0x8F, 0x95, 0x5A, 0x64, 0x7C, 0xC0, 0x2D, 0x6B, 0x4C, 0x3B, 0xB0, 0x9A,
+0x42, 0x0E, 0x0F, 0x6D, 0x32, 0x86, 0x2D, 0x5A, 0x35, 0x44, 0x0F, 0x4A, 0x84, 0xA4, 0x2A, 0x01,
+0x51, 0xC5, 0x6C, 0x2A, 0x2F, 0xBC, 0x5C, 0x11, 0x01, 0x6B, 0x6A, 0x6F, 0x51, 0x6A, 0x6F, 0x6B,
+0x6A, 0x00, 0xC2, 0x5A, 0x3F, 0x26, 0x00, 0x7F, 0xC6, 0x5C, 0x2B, 0x11, 0x2A, 0x75, 0x95, 0x00,
+0x00, 0x52, 0x40, 0x45, 0x42, 0x48, 0x4A, 0x42, 0x43, 0x48, 0x42, 0x03, 0x45, 0x40, 0x15, 0xC2,
+0xB7, 0x3D, 0x13, 0x01, 0x7D, 0x53, 0x7D, 0xCC, 0x6A, 0x3D, 0x13, 0x56, 0x6A, 0x13, 0x94, 0x13,
+0x94, 0x80, 0x7A, 0x1F, 0x1E, 0x00, 0x5F, 0x76, 0x70, 0x76, 0x44, 0x62, 0x68, 0x00, 0x76, 0xC5,
+0x96, 0x22, 0x27, 0x0F, 0x27, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04,
+0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x01, 0x6E, 0x47, 0x01, 0x6E, 0x4D, 0x78, 0xCE, 0x6E, 0x46,
+0x0D, 0x07, 0x0D, 0x46, 0xCB, 0x45, 0x39, 0x4B, 0x07, 0x2E, 0x07, 0x2E, 0x07, 0x00, 0x6E, 0x47,
+0x00, 0xC4, 0xA1, 0x57, 0x1D, 0x69, 0x1D, 0x00, 0xC0, 0xBF, 0x01, 0xC2, 0x57, 0x69, 0xBF, 0x00,
+0x5D, 0x7C, 0xC9, 0x69, 0x1D, 0x57, 0xE1, 0x00, 0x2D, 0x00, 0x01, 0x05, 0x00, 0x00, 0x45, 0x43,
+0x45, 0x41, 0x44, 0x42, 0x40, 0x03, 0x41, 0x44, 0x40, 0xC4, 0xAA, 0x03, 0x04, 0x01, 0x00, 0x01,
+0x42, 0x43, 0x44, 0x41, 0x00, 0x45, 0x40, 0x02, 0x41, 0x42, 0x40, 0x42, 0x44, 0x41, 0x40, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x03, 0x45, 0x42, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40, 0x02, 0x4E, 0x48,
+0x40, 0x02, 0x41, 0x40, 0x00, 0x4A, 0x4E, 0x40, 0x00, 0x41, 0x4E, 0x42, 0x45, 0x48, 0x00, 0x42,
+0x44, 0x40, 0x41, 0x40, 0x02, 0x4A, 0x43, 0x45, 0x42, 0x63, 0x40, 0x4A, 0x48, 0x00, 0x42, 0x43,
+0x42, 0x40, 0x00, 0x42, 0x48, 0x43, 0x44, 0x4A, 0x48, 0x42, 0x40, 0x05, 0x71, 0x40, 0xCC, 0x53,
+0x0A, 0x00, 0x05, 0x0A, 0x08, 0x02, 0x00, 0x47, 0x12, 0xB3, 0x57, 0x1D, 0x00, 0xC4, 0x69, 0x7E,
+0xC9, 0x69, 0x7E, 0x00, 0xC7, 0xA8, 0x91, 0x69, 0x1D, 0x3C, 0x2C, 0xA1, 0x07, 0x00, 0x6E, 0x47,
+0x04, 0xC6, 0x79, 0x4D, 0xC2, 0x38, 0x45, 0x46, 0x87, 0x00, 0x78, 0x47, 0x06, 0xCC, 0x4B, 0xD1,
+0x19, 0x5F, 0x2B, 0x2A, 0x43, 0x5C, 0x2B, 0x43, 0x19, 0xD2, 0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41,
+0x40, 0x30, 0x52, 0x00, 0xC1, 0x4F, 0x09, 0x00, 0x50, 0x49, 0x00, 0x50, 0x49, 0x00, 0x73, 0x5A,
+0xC8, 0x78, 0x20, 0x72, 0xDE, 0x10, 0x33, 0xE0, 0x7B, 0x09, 0x01, 0x55, 0x50, 0x49, 0x00, 0x5B,
+0x42, 0x06, 0x4A, 0x4E, 0x44, 0x42, 0x41, 0x40, 0x00, 0xD0, 0x89, 0xBC, 0x2A, 0x3B, 0x9B, 0xA9,
+0x34, 0x32, 0x11, 0x95, 0x3F, 0x95, 0x59, 0xB0, 0x2B, 0x76, 0x6B, 0x00, 0xD5, 0xB8, 0x71, 0x42,
+0x5A, 0x9A, 0xA6, 0x23, 0x1C, 0x0A, 0x68, 0x64, 0x02, 0x0E, 0xB5, 0x53, 0x25, 0x0E, 0xA7, 0xA4,
+0x32, 0x3E, 0x67, 0x00, 0xC2, 0x71, 0x2B, 0x8F, 0x00, 0x51, 0xD7, 0x71, 0x4C, 0x50, 0x64, 0x42,
+0x8F, 0x11, 0x3B, 0x76, 0xB6, 0x52, 0x11, 0x3B, 0x1E, 0x90, 0x9A, 0x4A, 0x9B, 0x52, 0x53, 0x34,
+0x2A, 0xCE, 0x00, 0x00, 0x52, 0x40, 0x45, 0x44, 0x4A, 0x48, 0x4E, 0x4A, 0x00, 0x48, 0x42, 0x02,
+0x45, 0x40, 0x15, 0xC4, 0x6B, 0x3D, 0x13, 0x3D, 0x13, 0x00, 0xC9, 0xBE, 0x56, 0x9E, 0x56, 0x6A,
+0x6F, 0x76, 0x13, 0x3D, 0x13, 0x00, 0xC8, 0x7D, 0x7A, 0x3A, 0x1E, 0xA2, 0x0F, 0x28, 0x0E, 0x04,
+0x00, 0x70, 0x66, 0xC7, 0x60, 0x0E, 0x60, 0x0F, 0x1E, 0x0F, 0x27, 0x00, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07, 0x06, 0x4D, 0xCC, 0x46, 0x6E, 0xBB, 0x45,
+0x38, 0x4D, 0xC2, 0xDC, 0x87, 0x4D, 0x39, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0x00, 0x6E, 0x47, 0xC2,
+0xCB, 0xA1, 0x3C, 0x00, 0xC1, 0x91, 0x3C, 0x00, 0xD0, 0x91, 0x69, 0x7E, 0x85, 0x91, 0x69, 0x91,
+0x69, 0x91, 0x54, 0x1D, 0x2C, 0xE1, 0x0B, 0x00, 0x31, 0x0A, 0x00, 0x40, 0x00, 0x43, 0x42, 0x4A,
+0x43, 0x00, 0x42, 0x41, 0x40, 0x02, 0x42, 0x63, 0x45, 0x44, 0xC3, 0x44, 0x04, 0x08, 0x00, 0x01,
+0x4A, 0x44, 0x4A, 0x45, 0x4A, 0x00, 0x40, 0x02, 0x48, 0x4A, 0x45, 0x48, 0x43, 0x42, 0x40, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x03, 0x48, 0x4E, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40, 0x01, 0x42, 0x48,
+0x4E, 0x45, 0x40, 0x01, 0x41, 0x40, 0x45, 0x4A, 0x00, 0x42, 0x45, 0x42, 0x4E, 0x43, 0x42, 0x44,
+0x43, 0x48, 0x42, 0x40, 0x41, 0x40, 0x02, 0xC6, 0x53, 0x0A, 0x04, 0x02, 0x0A, 0x04, 0x08, 0x00,
+0x43, 0x40, 0x00, 0x71, 0x40, 0x00, 0x5C, 0xC3, 0x44, 0x02, 0x03, 0x08, 0x00, 0x68, 0x40, 0x06,
+0x42, 0x48, 0x43, 0x40, 0x5F, 0x48, 0x00, 0xC1, 0xBD, 0x00, 0x00, 0x41, 0xD1, 0xB3, 0x2C, 0x1D,
+0x3C, 0x69, 0x7E, 0xA7, 0x7E, 0x91, 0x3C, 0x69, 0x91, 0x1D, 0x3C, 0x2C, 0x57, 0xA1, 0x07, 0x02,
+0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x78, 0x79, 0xC3, 0xB1, 0x79, 0x46, 0x87, 0x00, 0x78, 0x47,
+0x02, 0x4D, 0x47, 0x4D, 0x47, 0xC2, 0x79, 0x43, 0x19, 0x00, 0xC8, 0x6C, 0x75, 0x9F, 0x75, 0x5F,
+0x19, 0x43, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x31, 0x52, 0xC2, 0x4F, 0x62, 0x09,
+0x00, 0x50, 0xC8, 0x97, 0x09, 0x97, 0x09, 0x41, 0x10, 0x78, 0x6D, 0x66, 0x00, 0x5A, 0x50, 0xC3,
+0x72, 0x20, 0x15, 0x09, 0x03, 0x50, 0x00, 0xC1, 0x8A, 0x02, 0x05, 0x48, 0x00, 0x4A, 0x42, 0x41,
+0x40, 0x00, 0xDF, 0x89, 0x75, 0x6C, 0x52, 0x9D, 0x7C, 0x56, 0x52, 0x11, 0x42, 0x8F, 0x84, 0x95,
+0x5A, 0x2B, 0xC2, 0x71, 0x50, 0x71, 0x32, 0x2B, 0x85, 0x59, 0xA6, 0x23, 0x02, 0x3E, 0x73, 0x64,
+0x02, 0x64, 0xCA, 0xC7, 0x86, 0x21, 0x0E, 0x4A, 0x89, 0x64, 0xE4, 0x6B, 0x00, 0xC9, 0x76, 0x9B,
+0x5C, 0x2F, 0x3E, 0xB7, 0xC0, 0x7C, 0x76, 0x11, 0x01, 0xD2, 0x52, 0xE9, 0xC0, 0xD4, 0x71, 0x84,
+0x37, 0xA7, 0x8F, 0x64, 0x67, 0x7A, 0x7C, 0x9D, 0x71, 0x59, 0x00, 0x12, 0x00, 0x00, 0x45, 0x42,
+0x00, 0x4A, 0x00, 0x48, 0x44, 0x4A, 0x42, 0x02, 0x45, 0x40, 0x15, 0x65, 0x7D, 0x53, 0xC4, 0x8B,
+0x3D, 0x13, 0xDF, 0x88, 0x01, 0x7E, 0xC9, 0x88, 0x6F, 0x4C, 0x94, 0x7D, 0x13, 0x7D, 0x7A, 0x3A,
+0x1E, 0x00, 0x4F, 0x00, 0xC6, 0x49, 0x22, 0x12, 0x0E, 0x60, 0x28, 0x26, 0x00, 0x68, 0x5E, 0x4F,
+0x5E, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07,
+0x00, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0xD1, 0x4B, 0x0D, 0x55, 0x87, 0xC3, 0x79, 0xCB, 0x39,
+0x46, 0xB9, 0x4B, 0x87, 0x81, 0x2E, 0x0D, 0xCB, 0x0D, 0x07, 0x02, 0xC4, 0xA1, 0x2C, 0x3C, 0x91,
+0x3C, 0x00, 0xC5, 0x91, 0xA7, 0x91, 0x7E, 0xA8, 0x1D, 0x01, 0xCA, 0xA8, 0x7E, 0x3C, 0x2C, 0x93,
+0x00, 0x0B, 0x12, 0x21, 0x03, 0x00, 0x01, 0x42, 0x43, 0x4A, 0x48, 0x44, 0x40, 0x03, 0x4A, 0xC7,
+0x86, 0x08, 0x04, 0x02, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x4A, 0x48, 0x4A, 0x42, 0x45, 0x43, 0x40,
+0x02, 0x45, 0x43, 0x42, 0x44, 0x42, 0x43, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x02, 0x41, 0x4A,
+0x00, 0x44, 0x40, 0x02, 0x41, 0x40, 0x42, 0x40, 0x01, 0x4A, 0x43, 0x4A, 0x43, 0x40, 0x01, 0x41,
+0x40, 0x48, 0x00, 0x43, 0x4E, 0x42, 0x44, 0x4A, 0x41, 0x00, 0x43, 0x42, 0x4E, 0x42, 0x40, 0x41,
+0x40, 0x01, 0x4B, 0x4A, 0x68, 0x41, 0x5C, 0x43, 0x4A, 0x43, 0x00, 0x48, 0x42, 0x76, 0x68, 0x40,
+0x00, 0x42, 0xC6, 0x50, 0x63, 0x08, 0x03, 0x04, 0x03, 0x00, 0x06, 0x48, 0x4A, 0x4E, 0x40, 0x42,
+0x48, 0x44, 0x43, 0x40, 0xC4, 0x47, 0x12, 0xB3, 0x57, 0x1D, 0x00, 0xCD, 0x69, 0x54, 0xA7, 0x9A,
+0xC9, 0x85, 0x91, 0x69, 0x3C, 0x1D, 0x57, 0x2C, 0xA1, 0x07, 0x07, 0xC9, 0xBA, 0x0D, 0x39, 0x45,
+0x0D, 0x4D, 0x4E, 0x61, 0x46, 0x0D, 0x00, 0x47, 0x04, 0xC2, 0x4B, 0x9F, 0x19, 0x00, 0xC0, 0x75,
+0x00, 0xC3, 0x43, 0x2A, 0x6C, 0x19, 0x00, 0xC2, 0xD2, 0x0B, 0x00, 0x0D, 0x41, 0x40, 0x0B, 0x41,
+0x40, 0x32, 0xC2, 0x4F, 0x62, 0x09, 0x02, 0x50, 0xCD, 0x41, 0x09, 0x20, 0x9E, 0xA5, 0x1A, 0x66,
+0x92, 0x66, 0x1B, 0x72, 0x20, 0x41, 0x09, 0x00, 0xC1, 0x62, 0x09, 0x01, 0x5B, 0x56, 0x42, 0x05,
+0x48, 0x44, 0x4E, 0x42, 0x41, 0x40, 0x00, 0xDC, 0x95, 0x6C, 0x3E, 0x65, 0xAF, 0x47, 0x4F, 0x76,
+0x3E, 0x42, 0x2A, 0x5C, 0x26, 0xB0, 0x42, 0x2A, 0x5C, 0x6C, 0x11, 0x2A, 0x42, 0xA7, 0xB0, 0xA6,
+0x35, 0x0C, 0x23, 0x0C, 0x23, 0x00, 0x4C, 0x00, 0x63, 0x4C, 0x00, 0xCB, 0x84, 0x89, 0x71, 0xD3,
+0xC0, 0x47, 0x65, 0x9B, 0x2A, 0x11, 0x52, 0xE9, 0x00, 0xD5, 0x6B, 0x9D, 0x6C, 0x11, 0x3B, 0x44,
+0xC0, 0xAF, 0xB7, 0x52, 0x0A, 0xA4, 0x5C, 0x11, 0x56, 0x6B, 0x47, 0x0B, 0xB8, 0x76, 0x9D, 0x00,
+0x02, 0x45, 0x42, 0x4E, 0x48, 0x44, 0x4E, 0x4A, 0x48, 0x42, 0x02, 0x45, 0x40, 0x15, 0xC2, 0x6B,
+0xCC, 0x13, 0x00, 0xCB, 0x7D, 0x3D, 0x13, 0x66, 0x76, 0x64, 0x88, 0x56, 0x92, 0x56, 0xBE, 0x13,
+0x00, 0xC4, 0x7D, 0x7A, 0x3A, 0x40, 0x0F, 0x00, 0x5E, 0xCA, 0x54, 0x1F, 0x3F, 0x49, 0x30, 0x36,
+0x02, 0x30, 0x3F, 0x0F, 0x1E, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x04, 0x4B, 0x40, 0x00, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x78, 0x4D, 0xCC, 0x4D, 0x55, 0x61, 0x55,
+0x38, 0x0D, 0x39, 0x45, 0xBB, 0x4D, 0x39, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0xD4,
+0xA1, 0x57, 0x3C, 0x2F, 0x69, 0xA4, 0x91, 0xA8, 0x2F, 0x69, 0x91, 0x3C, 0x7E, 0x57, 0x69, 0x91,
+0x1D, 0x2C, 0x93, 0x31, 0x00, 0x00, 0x5F, 0x48, 0x40, 0x41, 0x44, 0x48, 0x45, 0x48, 0x42, 0x48,
+0x45, 0x40, 0x01, 0x45, 0x4E, 0x44, 0x4A, 0x48, 0x42, 0x00, 0x48, 0x40, 0x01, 0x4A, 0x42, 0x43,
+0x44, 0x41, 0x48, 0x40, 0x02, 0x41, 0x43, 0x42, 0x43, 0x44, 0x00, 0x40, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x02, 0x44, 0x4A, 0x43, 0x4E, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x42, 0x40,
+0x41, 0x42, 0x40, 0x01, 0x41, 0x40, 0x42, 0x41, 0x40, 0x42, 0x40, 0x00, 0x43, 0x00, 0x42, 0x00,
+0x41, 0x42, 0x45, 0x40, 0x41, 0x40, 0x02, 0x5C, 0x48, 0xC4, 0x44, 0x02, 0x05, 0x02, 0x05, 0x01,
+0x43, 0x44, 0x41, 0x40, 0x41, 0x00, 0x44, 0xC5, 0x44, 0x00, 0x04, 0x03, 0x01, 0x00, 0x07, 0x41,
+0x42, 0x41, 0x00, 0x44, 0x43, 0x41, 0x40, 0xC7, 0x47, 0x12, 0xB3, 0x57, 0x2C, 0x1D, 0x57, 0x69,
+0x00, 0x7C, 0xC2, 0xA8, 0xBF, 0x7E, 0x00, 0x7C, 0x5D, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x07, 0x4D,
+0xC9, 0xCB, 0x46, 0xCB, 0x45, 0x38, 0x6E, 0x39, 0x79, 0xCB, 0x0D, 0x00, 0x47, 0x03, 0x6E, 0xC2,
+0x9F, 0x19, 0x43, 0x00, 0xC7, 0x5F, 0x19, 0x5F, 0x43, 0x19, 0x43, 0xC8, 0x00, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x32, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0xCA, 0x99, 0xAB, 0x1A, 0x33, 0x10, 0x1B,
+0x33, 0x10, 0x99, 0x7B, 0x09, 0x01, 0x55, 0x49, 0x01, 0x55, 0x69, 0x42, 0x05, 0x43, 0x4A, 0x44,
+0x42, 0x41, 0x40, 0x00, 0xCE, 0x95, 0x3B, 0x71, 0x7C, 0x0B, 0x27, 0x0B, 0x4C, 0x71, 0x2A, 0x75,
+0x5C, 0x95, 0x5A, 0x5C, 0x00, 0xC3, 0x5F, 0xBC, 0x5C, 0x2A, 0x00, 0xC4, 0x5A, 0x58, 0x2B, 0x35,
+0x0C, 0x00, 0x63, 0xC2, 0x9E, 0x35, 0x0C, 0x03, 0xD3, 0x5A, 0x89, 0x0E, 0xB7, 0x0B, 0xAF, 0x4C,
+0x3B, 0x2A, 0x11, 0x71, 0x6B, 0xC0, 0x6B, 0x76, 0x2B, 0x2A, 0x11, 0x76, 0xC0, 0x00, 0xCD, 0xD8,
+0x71, 0x64, 0xA4, 0x5C, 0x3B, 0x13, 0x6B, 0x12, 0x0B, 0xB7, 0x76, 0xB8, 0x00, 0x02, 0x45, 0x44,
+0x4E, 0x4A, 0x43, 0x00, 0x4A, 0x42, 0x03, 0x45, 0x40, 0x15, 0xC3, 0xE9, 0x13, 0x7D, 0x13, 0x00,
+0xC1, 0x7D, 0x56, 0x00, 0xDA, 0xDF, 0x56, 0x76, 0x6F, 0x76, 0x13, 0x3D, 0x13, 0x7D, 0x13, 0x7A,
+0x3A, 0xA2, 0x1E, 0x0F, 0x1F, 0x3F, 0x22, 0x04, 0x22, 0x02, 0x3F, 0x30, 0x36, 0x0F, 0x1E, 0x0F,
+0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05,
+0x4D, 0x47, 0x78, 0x79, 0xCD, 0x46, 0x4B, 0xC6, 0x0D, 0x46, 0xCB, 0x55, 0x39, 0x45, 0x0D, 0x2E,
+0x07, 0x0D, 0x07, 0x03, 0xD3, 0xA1, 0x2C, 0x3C, 0xBF, 0x7E, 0xBF, 0x69, 0x1D, 0x69, 0xA8, 0x69,
+0x7E, 0xA8, 0x1D, 0x57, 0x69, 0x2C, 0x57, 0xE1, 0x00, 0x01, 0x6D, 0x42, 0x40, 0x45, 0x43, 0x00,
+0x44, 0x41, 0x43, 0x42, 0x40, 0x02, 0x45, 0x00, 0x40, 0x42, 0x44, 0x48, 0x43, 0x41, 0x01, 0x40,
+0x44, 0x48, 0x44, 0x40, 0x00, 0x42, 0x40, 0x41, 0x01, 0x40, 0x42, 0x40, 0x44, 0x43, 0x40, 0x00,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x02, 0x42, 0x41, 0x40, 0x42, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40,
+0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x01, 0x4B, 0x40, 0x01, 0x4B, 0x40, 0x05,
+0x42, 0x48, 0x00, 0x42, 0x40, 0x13, 0x52, 0x40, 0x00, 0x52, 0xC4, 0xB3, 0x2C, 0x1D, 0x57, 0x1D,
+0x00, 0x7C, 0x6C, 0x5D, 0x6C, 0x02, 0x5D, 0x7C, 0x6C, 0xC1, 0xA1, 0x07, 0x02, 0x6E, 0x47, 0x00,
+0x6E, 0x47, 0x0C, 0x6E, 0x47, 0x01, 0x6E, 0xC7, 0x9F, 0x19, 0x9F, 0x19, 0x9F, 0x19, 0x9F, 0x19,
+0x00, 0xC3, 0x43, 0xD2, 0x0B, 0x00, 0x0D, 0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x32, 0xCB, 0x4F,
+0x7B, 0x15, 0x10, 0x09, 0x15, 0x09, 0x15, 0x09, 0x15, 0x1B, 0x15, 0x00, 0x49, 0x55, 0x00, 0x49,
+0xC1, 0x41, 0x09, 0x01, 0x55, 0x49, 0x02, 0x50, 0x69, 0x42, 0x06, 0x45, 0x42, 0x00, 0x40, 0x01,
+0xCF, 0x95, 0x6C, 0x71, 0x7C, 0x0B, 0x12, 0x6B, 0x51, 0xA9, 0x2B, 0x5C, 0xBC, 0x36, 0xA7, 0x11,
+0x2A, 0x00, 0x51, 0xCD, 0x5C, 0x2B, 0x42, 0xA7, 0x58, 0x32, 0x77, 0x0C, 0x9E, 0x23, 0x8D, 0x0C,
+0x23, 0x0C, 0x02, 0xDF, 0x54, 0x3F, 0x3B, 0x3E, 0x1C, 0x9D, 0x64, 0xA6, 0x2B, 0x42, 0x32, 0x71,
+0x7C, 0x44, 0xC2, 0x42, 0x2B, 0x11, 0x32, 0x76, 0x1C, 0x52, 0xC2, 0x64, 0xA4, 0x5C, 0x3B, 0x56,
+0xC0, 0x2D, 0x0B, 0xE4, 0xC2, 0x56, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x45, 0x61, 0x42, 0x68, 0x61,
+0x42, 0x03, 0x45, 0x40, 0x15, 0x65, 0x53, 0x00, 0x7D, 0x53, 0x00, 0x7D, 0x00, 0x53, 0x7D, 0xC1,
+0x94, 0x8B, 0x00, 0xC7, 0x7D, 0x13, 0x7D, 0x13, 0x7D, 0x13, 0x0F, 0x1E, 0x00, 0x4F, 0x00, 0x67,
+0x4F, 0x67, 0x5E, 0x67, 0x5E, 0x67, 0x5E, 0x01, 0x4F, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC3, 0xD6, 0x07, 0x2E, 0x07, 0x00, 0x6E, 0x47,
+0x03, 0x4D, 0x00, 0x47, 0x06, 0x6E, 0x47, 0x03, 0x6E, 0x47, 0x00, 0xC9, 0xA1, 0x3C, 0x2C, 0x1D,
+0x2C, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x02, 0xC3, 0x57, 0x2C, 0xF4, 0x2C, 0x00, 0xC3, 0xE1, 0x00,
+0x12, 0x00, 0x14, 0x41, 0xC4, 0x51, 0x26, 0x03, 0x01, 0x00, 0x03, 0x42, 0x48, 0x43, 0x42, 0x40,
+0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x41, 0x08, 0x45, 0x41, 0x0D, 0x45,
+0x4F, 0x41, 0x01, 0x65, 0x41, 0x00, 0x65, 0x41, 0x13, 0x71, 0x40, 0x71, 0x41, 0x06, 0x4F, 0x41,
+0x65, 0x5F, 0x7C, 0x0E, 0xC2, 0x67, 0xCB, 0xB1, 0x01, 0x78, 0xC4, 0xB1, 0x38, 0xB1, 0x38, 0xB1,
+0x00, 0x78, 0x00, 0xC0, 0xB1, 0x00, 0x78, 0xC0, 0xB1, 0x00, 0x78, 0xC8, 0xC3, 0xDC, 0x38, 0xB1,
+0x38, 0xB1, 0x38, 0xB1, 0x5F, 0x07, 0xC2, 0x75, 0xD2, 0x01, 0x0F, 0x45, 0x41, 0x0A, 0x45, 0x41,
+0x31, 0x4F, 0x69, 0x50, 0x00, 0xC1, 0xA5, 0x10, 0x0C, 0xC3, 0xA5, 0x10, 0xA5, 0x10, 0x01, 0xC3,
+0xA5, 0x10, 0x51, 0x04, 0x02, 0x42, 0x44, 0x00, 0x42, 0x44, 0x01, 0x42, 0x45, 0x4F, 0xCA, 0x4F,
+0x89, 0x6C, 0x3B, 0x76, 0xB7, 0x4F, 0x7A, 0x76, 0x3B, 0x2A, 0x00, 0x51, 0xC2, 0x95, 0x5A, 0x2B,
+0x00, 0xC1, 0x9B, 0x34, 0x00, 0x6B, 0xC1, 0x42, 0x5A, 0x00, 0x72, 0xC0, 0x77, 0x00, 0x63, 0x00,
+0xC1, 0x9E, 0x23, 0x01, 0x4C, 0x01, 0xCC, 0x4A, 0x93, 0x95, 0x59, 0x63, 0x03, 0x59, 0xB0, 0xA7,
+0x5A, 0x0A, 0x5A, 0x6D, 0x00, 0xCF, 0x84, 0x5A, 0x54, 0xB0, 0x58, 0x26, 0x04, 0x53, 0x86, 0x3F,
+0x95, 0x5C, 0x2A, 0x92, 0x7C, 0x6B, 0x00, 0xC3, 0xB8, 0x52, 0x50, 0x01, 0x02, 0x42, 0x44, 0x02,
+0x5C, 0x44, 0x01, 0x42, 0x44, 0x00, 0x45, 0x41, 0x08, 0x67, 0x41, 0x09, 0x67, 0xC3, 0xB7, 0x65,
+0x13, 0x4C, 0x00, 0xC0, 0x65, 0x00, 0xC4, 0x4C, 0x65, 0x4C, 0x65, 0x4C, 0x04, 0x53, 0xC2, 0x65,
+0xBD, 0x22, 0x02, 0x68, 0x62, 0x03, 0xC1, 0x90, 0x22, 0x01, 0xC2, 0x90, 0x22, 0x01, 0x10, 0x45,
+0x41, 0x0A, 0x45, 0x41, 0x0F, 0x45, 0x41, 0x04, 0x65, 0x4F, 0x67, 0xC7, 0x7D, 0xC3, 0x38, 0xB1,
+0x38, 0xB1, 0x38, 0xB1, 0x00, 0x78, 0xC3, 0xB1, 0xC3, 0xB1, 0x38, 0x04, 0xC1, 0xB1, 0x38, 0x01,
+0xC3, 0xB1, 0x38, 0xC3, 0xB1, 0x00, 0xC7, 0xDC, 0x38, 0xCE, 0x3C, 0x69, 0x3C, 0x69, 0x3C, 0x00,
+0xC3, 0x69, 0x3C, 0x69, 0x57, 0x01, 0x7C, 0x00, 0xC6, 0x69, 0x3C, 0x57, 0x3F, 0x01, 0x0F, 0x01,
+0x12, 0x4F, 0x7A, 0x41, 0x5F, 0x41, 0x11, 0x45, 0x41, 0x07, 0x45, 0x41, 0x09, 0x45, 0x00, 0x40,
+0x43, 0x00, 0x48, 0x43, 0x05, 0x48, 0x00, 0x43, 0x0D, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x05, 0x48, 0x43, 0x48, 0x43, 0xC4, 0x74, 0x03, 0x08, 0x03,
+0x08, 0x00, 0x7B, 0x6B, 0x72, 0xC1, 0x86, 0x03, 0x04, 0x48, 0x43, 0x66, 0xC2, 0x6D, 0x26, 0x7E,
+0x0E, 0x7E, 0x79, 0x06, 0xC1, 0x61, 0x39, 0x01, 0xC4, 0xA0, 0x39, 0xB9, 0x61, 0x39, 0x00, 0xC1,
+0x61, 0x39, 0x05, 0xC3, 0xB9, 0x83, 0x58, 0x86, 0x04, 0xC3, 0x59, 0xC7, 0x86, 0x03, 0x0E, 0x48,
+0x00, 0x43, 0x0A, 0x48, 0x43, 0x0F, 0x48, 0x00, 0x43, 0x0D, 0x48, 0x43, 0x0C, 0x48, 0x43, 0xCF,
+0x59, 0x70, 0x1A, 0xAB, 0x1A, 0x72, 0xAB, 0x72, 0x1A, 0x72, 0xAB, 0x72, 0x1A, 0x72, 0x1A, 0x72,
+0x01, 0x5A, 0xC7, 0x72, 0x1A, 0x72, 0x1A, 0xAB, 0x1A, 0x72, 0x1A, 0x00, 0x4A, 0x02, 0x4E, 0x4A,
+0x00, 0x4E, 0x4A, 0x02, 0x48, 0x43, 0x00, 0xC9, 0x63, 0x6C, 0x2A, 0x64, 0x53, 0x4C, 0x71, 0x64,
+0x2B, 0x2A, 0x00, 0xCC, 0x5C, 0x9A, 0xB0, 0x2B, 0x6A, 0xD4, 0x21, 0x9D, 0x3E, 0x2B, 0x5A, 0x85,
+0x35, 0x00, 0xC1, 0x77, 0x0C, 0x00, 0x63, 0xC8, 0x77, 0x0C, 0x23, 0x0C, 0x35, 0x0C, 0x2F, 0xC7,
+0xB0, 0x00, 0xD1, 0x9A, 0x63, 0xB0, 0xA7, 0x84, 0x5A, 0x4A, 0x3E, 0x0A, 0x3E, 0x84, 0x0E, 0x5A,
+0x54, 0x5A, 0xB0, 0x26, 0xB0, 0x00, 0x66, 0xCA, 0x84, 0x2A, 0x5C, 0x11, 0x3E, 0x65, 0x44, 0x71,
+0x6C, 0x3E, 0x03, 0x00, 0x48, 0x43, 0x48, 0x4A, 0x05, 0x4E, 0x4A, 0x01, 0xD7, 0x92, 0x1A, 0x70,
+0x1A, 0x92, 0x70, 0x1A, 0x92, 0x1A, 0x70, 0x92, 0x1A, 0x92, 0x70, 0x1A, 0x92, 0x70, 0x1A, 0x92,
+0x1A, 0x70, 0x1A, 0x92, 0x1A, 0x00, 0xC1, 0xA9, 0x6F, 0x02, 0x5A, 0xC1, 0xA9, 0x6F, 0x00, 0x5A,
+0xC0, 0x6F, 0x04, 0x5A, 0xCF, 0xA9, 0x08, 0x58, 0x30, 0x58, 0x08, 0x30, 0x08, 0x30, 0x58, 0x08,
+0x30, 0x58, 0x30, 0x58, 0x30, 0x00, 0x48, 0x43, 0x0F, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x07,
+0x4A, 0xC0, 0x49, 0x0F, 0xC1, 0x58, 0x03, 0x01, 0x48, 0x43, 0xC5, 0x74, 0x26, 0x03, 0x74, 0x4E,
+0x39, 0x04, 0xC3, 0x61, 0x39, 0x61, 0x39, 0x00, 0xC1, 0x61, 0x39, 0x00, 0xC5, 0x61, 0x39, 0x61,
+0x39, 0x61, 0x39, 0x00, 0xC2, 0xA0, 0x61, 0x39, 0x01, 0xC1, 0xEC, 0x39, 0x00, 0xC9, 0xA0, 0x26,
+0x30, 0x26, 0x30, 0x26, 0x30, 0x26, 0x30, 0x26, 0x00, 0x70, 0x66, 0x70, 0x00, 0x66, 0x70, 0x66,
+0x43, 0x00, 0xC1, 0x6D, 0x03, 0x10, 0x48, 0x43, 0x0A, 0x48, 0x43, 0x03, 0x48, 0x43, 0x02, 0x48,
+0x00, 0x43, 0x07, 0x48, 0x43, 0x48, 0x43, 0x07, 0x48, 0x42, 0x41, 0x42, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x08, 0x4B, 0x40, 0x4B, 0x00, 0x40, 0x0C, 0xC5, 0xD3, 0x6C, 0x75, 0xC7, 0x2D,
+0x00, 0x08, 0x52, 0xC1, 0xB3, 0x1D, 0x04, 0x6C, 0x5D, 0x6C, 0x00, 0x5D, 0x6C, 0x00, 0x5D, 0x6C,
+0xC1, 0xA1, 0x07, 0x02, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x05, 0x4D, 0x47, 0x02, 0x4D,
+0x47, 0x4D, 0x47, 0x4D, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x0F, 0xC4, 0xDA, 0x09, 0x15, 0x41, 0x09, 0x02, 0xC4, 0x41, 0x09, 0x15, 0x10,
+0x15, 0x02, 0x49, 0x55, 0x50, 0x55, 0x00, 0xC2, 0x41, 0x15, 0x09, 0x01, 0x55, 0x69, 0x42, 0x00,
+0x69, 0x42, 0x01, 0x69, 0x42, 0x02, 0x40, 0x01, 0xDB, 0x89, 0x8F, 0x5F, 0x11, 0x2B, 0x11, 0x2A,
+0x2B, 0x2A, 0x2B, 0x11, 0xBC, 0x95, 0x3E, 0x3B, 0x7A, 0xC0, 0x0B, 0xD8, 0x5B, 0x3B, 0x58, 0x90,
+0x32, 0x0C, 0x0E, 0x23, 0x8D, 0x00, 0x4E, 0x7B, 0x63, 0xC4, 0x64, 0x0E, 0x4A, 0x11, 0x2A, 0x01,
+0x51, 0x00, 0x6B, 0xC6, 0xA6, 0x32, 0x86, 0x3E, 0x0E, 0x04, 0x0A, 0x00, 0xC3, 0x4A, 0x86, 0xB5,
+0x42, 0x00, 0x6A, 0x00, 0xC6, 0x5C, 0x2B, 0x11, 0xB0, 0xD2, 0x2B, 0x11, 0x01, 0x6B, 0xC2, 0x75,
+0x95, 0x00, 0x02, 0x45, 0x42, 0x05, 0x68, 0x42, 0x01, 0x5B, 0x49, 0x04, 0x55, 0x49, 0x00, 0xC3,
+0x41, 0x97, 0x41, 0x09, 0x00, 0xC1, 0x97, 0x15, 0x00, 0x49, 0x01, 0x55, 0x01, 0xC2, 0x41, 0xBE,
+0x3D, 0x00, 0xC2, 0xBE, 0x3D, 0x8B, 0x00, 0xC4, 0x80, 0x8B, 0x7D, 0x8B, 0x94, 0x00, 0xC2, 0x8B,
+0x3D, 0x7D, 0x00, 0xC6, 0x94, 0x01, 0x1E, 0xD9, 0x01, 0x27, 0x1E, 0x01, 0x67, 0x5E, 0x67, 0x5E,
+0x67, 0x5E, 0x67, 0x5E, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0xC1, 0xA2, 0x17, 0x0F, 0x4F, 0x40,
+0x07, 0xC1, 0xB2, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x01, 0x4D, 0x00, 0x47,
+0x4D, 0x47, 0x0A, 0x4D, 0x47, 0xC1, 0x81, 0x00, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x52, 0xC3, 0x9B, 0xC7, 0x0B, 0x00,
+0x08, 0x4B, 0x52, 0xC3, 0xB3, 0x57, 0x3C, 0x1D, 0x02, 0x7C, 0x6C, 0x5D, 0x03, 0x7C, 0x6C, 0xC1,
+0xA1, 0x07, 0x0E, 0x4D, 0x47, 0x08, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC5, 0x4F, 0x7B, 0x09, 0x41,
+0x15, 0x09, 0x00, 0x5B, 0x50, 0x49, 0x5B, 0x49, 0x01, 0x50, 0x49, 0x5B, 0xCB, 0x41, 0x15, 0x09,
+0x10, 0x1B, 0x62, 0x09, 0x41, 0x09, 0x15, 0x1C, 0x02, 0x09, 0x41, 0x40, 0x4B, 0xC3, 0x89, 0x5C,
+0xBC, 0x2A, 0x02, 0xC0, 0x5C, 0x00, 0xDF, 0x5A, 0x11, 0x2A, 0x63, 0x5A, 0x64, 0x6B, 0xD3, 0x25,
+0x6B, 0x9D, 0x64, 0x0A, 0x90, 0x32, 0x0C, 0x4F, 0x08, 0x68, 0x0E, 0x00, 0x0E, 0x35, 0x1C, 0x01,
+0x3E, 0x2F, 0x5C, 0x11, 0x2A, 0x2B, 0x11, 0x4E, 0xC2, 0x86, 0x23, 0x0E, 0x01, 0x48, 0x4E, 0x02,
+0x63, 0xCC, 0x59, 0x4A, 0x11, 0x5C, 0x11, 0x2F, 0x86, 0x89, 0x26, 0x4A, 0x5C, 0x2A, 0x11, 0x00,
+0xC2, 0x5F, 0x95, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42, 0x03, 0x68, 0x42, 0x03, 0x5B, 0x49, 0x06,
+0x5B, 0xC4, 0x41, 0x97, 0x09, 0x1B, 0x09, 0x00, 0x5B, 0x49, 0x05, 0xC9, 0x41, 0x13, 0x7D, 0xCC,
+0xBE, 0x13, 0x7D, 0x13, 0xDF, 0x13, 0x00, 0xC2, 0x8B, 0xBE, 0x13, 0x01, 0xC7, 0x7D, 0x13, 0x3D,
+0x1F, 0x0F, 0x1E, 0x2D, 0x1E, 0x00, 0x52, 0x00, 0x5E, 0x00, 0x52, 0x5E, 0x4F, 0x52, 0x5E, 0x4F,
+0x5E, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x57, 0x02, 0x7F, 0x57, 0x01, 0x7F, 0x57, 0x7F,
+0x57, 0x01, 0x7F, 0x77, 0xC1, 0xA2, 0x00, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x07, 0x4D, 0x00, 0x47,
+0x00, 0x4D, 0x01, 0x47, 0x4D, 0x00, 0x6E, 0x47, 0x00, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0xC2, 0x81,
+0x0B, 0x00, 0x3C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x44, 0x45, 0x40, 0x44, 0x40, 0x00, 0x41, 0x44, 0x43, 0x41, 0x45, 0x43, 0x42, 0x40, 0x41, 0x40,
+0x05, 0x43, 0x00, 0x42, 0x41, 0x43, 0x42, 0x40, 0x02, 0x45, 0x00, 0x40, 0x43, 0x42, 0x40, 0x04,
+0x52, 0xC6, 0xC5, 0x2D, 0x01, 0x51, 0x04, 0x01, 0x00, 0x00, 0x42, 0x41, 0x00, 0x66, 0x45, 0x40,
+0x41, 0xC8, 0xB3, 0x2C, 0x1D, 0x3C, 0xBF, 0x7E, 0x69, 0xB3, 0x69, 0x00, 0x7C, 0xC0, 0x7E, 0x00,
+0xC4, 0x69, 0x1D, 0x57, 0xA1, 0x07, 0x06, 0xCC, 0x4B, 0x39, 0x4D, 0x0D, 0x07, 0x0D, 0x7F, 0x79,
+0x45, 0x39, 0x45, 0x0D, 0x07, 0x04, 0x6E, 0xC5, 0xB4, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC1, 0x4F,
+0x62, 0x00, 0x5A, 0x00, 0x49, 0xC6, 0x7B, 0x1A, 0x41, 0x20, 0xAB, 0x20, 0x09, 0x02, 0x5A, 0x00,
+0x60, 0x55, 0x50, 0x73, 0x55, 0xC4, 0x82, 0x20, 0x09, 0x15, 0x02, 0x06, 0x44, 0x4A, 0x43, 0x42,
+0x67, 0x4B, 0x00, 0xDF, 0x89, 0x6C, 0x5F, 0x2A, 0x42, 0x2A, 0x2B, 0x42, 0xB0, 0x93, 0x90, 0x84,
+0x59, 0x5A, 0x3B, 0x7C, 0xC0, 0x2D, 0xAF, 0x56, 0x32, 0x4A, 0x58, 0xE6, 0x77, 0x04, 0x5A, 0x68,
+0x0E, 0x01, 0x3E, 0x68, 0x43, 0x4F, 0xC9, 0x4A, 0x11, 0x5C, 0x11, 0x5C, 0x32, 0x42, 0x0E, 0x23,
+0x0C, 0x01, 0xD9, 0x77, 0x0C, 0x23, 0x77, 0x0C, 0x77, 0xC4, 0x4A, 0x3B, 0x11, 0x2F, 0x11, 0x8F,
+0x26, 0x36, 0x22, 0x26, 0x42, 0x2B, 0x2A, 0x2B, 0x2A, 0x95, 0x00, 0x12, 0x00, 0x00, 0x45, 0x42,
+0x00, 0x43, 0x42, 0x43, 0x4A, 0x42, 0x03, 0x5B, 0x49, 0x05, 0x60, 0xC9, 0xAB, 0x33, 0x41, 0x33,
+0x1A, 0x97, 0x20, 0xAB, 0x10, 0x15, 0x00, 0x49, 0x02, 0xC2, 0x41, 0x13, 0x3D, 0x00, 0x53, 0xC1,
+0x80, 0x13, 0x00, 0xC7, 0x6A, 0x3D, 0x65, 0x6F, 0x6A, 0x13, 0x3D, 0x13, 0x00, 0xC8, 0x7D, 0x65,
+0x1F, 0x1E, 0x3F, 0x58, 0x04, 0xBD, 0x30, 0x00, 0x7F, 0xC8, 0xBD, 0x30, 0x3F, 0x22, 0x30, 0x3F,
+0x1E, 0x0F, 0x00, 0x10, 0x41, 0x40, 0x0A, 0xD0, 0xA2, 0x37, 0x17, 0x26, 0x49, 0x30, 0x28, 0x85,
+0x49, 0x37, 0x30, 0x37, 0x17, 0x37, 0x54, 0x60, 0x17, 0x00, 0x4F, 0x52, 0x4B, 0x40, 0x05, 0xC1,
+0xB2, 0x07, 0x05, 0x6E, 0x47, 0x78, 0xCB, 0x6E, 0x46, 0x07, 0x0D, 0x45, 0x61, 0x38, 0x45, 0x39,
+0x38, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0x02, 0x6E, 0xC1, 0x81, 0x00, 0x13, 0x41, 0x42, 0x40, 0x01,
+0x42, 0x41, 0x00, 0x43, 0x42, 0x40, 0x03, 0x41, 0x44, 0x40, 0x42, 0x43, 0x00, 0x41, 0x40, 0x01,
+0x42, 0x43, 0x44, 0x40, 0x41, 0x42, 0x40, 0x02, 0x44, 0xC7, 0x44, 0x00, 0x04, 0x44, 0x01, 0x00,
+0x01, 0x00, 0x01, 0x41, 0x43, 0x44, 0x40, 0x01, 0x41, 0x40, 0x02, 0x41, 0x44, 0x43, 0x41, 0x40,
+0x02, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x4E, 0x43, 0x45, 0x4E, 0x41, 0x40, 0x43, 0x44,
+0x42, 0x43, 0x48, 0x44, 0x43, 0x41, 0x00, 0x40, 0x04, 0x41, 0x4E, 0x5C, 0x48, 0x00, 0xC7, 0x44,
+0x08, 0x27, 0x0B, 0x00, 0x05, 0x0E, 0x04, 0x00, 0x43, 0x48, 0x45, 0x40, 0x06, 0x69, 0x44, 0x43,
+0xDB, 0x63, 0x00, 0x02, 0x0E, 0x02, 0x6D, 0x04, 0x08, 0x47, 0x12, 0xB3, 0x57, 0x1D, 0xBF, 0x7E,
+0x69, 0x91, 0x69, 0x2F, 0x7E, 0x69, 0x7E, 0x69, 0x91, 0x3C, 0x57, 0xA1, 0x07, 0x00, 0x6E, 0x47,
+0x03, 0xCB, 0x46, 0xED, 0x87, 0x4D, 0x38, 0x7F, 0xC2, 0x4B, 0xBB, 0x6E, 0x39, 0x0D, 0x00, 0x47,
+0x04, 0xC1, 0xB4, 0x00, 0x02, 0x52, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40,
+0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xCF, 0x4F, 0x15, 0x82, 0x33, 0x1A, 0x33, 0x1A,
+0xE0, 0x10, 0x1A, 0x20, 0xDE, 0x41, 0x10, 0x15, 0x1A, 0x00, 0xCB, 0x7B, 0x78, 0x15, 0x1A, 0x9E,
+0x7B, 0xDE, 0x72, 0x10, 0x15, 0x1C, 0x02, 0x05, 0x4E, 0x48, 0x43, 0x42, 0x41, 0x4B, 0x40, 0xDF,
+0x89, 0x2F, 0x75, 0x3B, 0x34, 0xA9, 0x3E, 0x3B, 0x11, 0xB0, 0x3F, 0x95, 0x9A, 0xB0, 0x42, 0x53,
+0x25, 0xB7, 0xB8, 0x52, 0xA6, 0x84, 0x5A, 0xE6, 0x0C, 0x02, 0x59, 0x32, 0x0A, 0x01, 0x5A, 0x35,
+0xCB, 0x89, 0x01, 0x3E, 0x5C, 0x11, 0x5C, 0x2F, 0x3B, 0x3E, 0x0E, 0x23, 0x0C, 0x00, 0xC3, 0x9E,
+0x23, 0x0C, 0x9E, 0x00, 0x63, 0xC5, 0x9E, 0x0C, 0x8D, 0x53, 0x84, 0x5C, 0x00, 0x6B, 0xCA, 0xB0,
+0x40, 0x89, 0x11, 0x9B, 0x76, 0x50, 0x3E, 0x75, 0x95, 0x00, 0x02, 0x45, 0x42, 0x4E, 0x00, 0x43,
+0x4E, 0x48, 0x4A, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09, 0x03, 0x60, 0xCB, 0x78, 0xA5, 0x78, 0x33,
+0x1A, 0x78, 0x1A, 0x78, 0x33, 0x1A, 0x1B, 0x09, 0x01, 0xD2, 0x97, 0x10, 0x41, 0x13, 0x7D, 0xCC,
+0x8B, 0x13, 0x8B, 0x56, 0x9E, 0x56, 0x76, 0x9E, 0x56, 0x3D, 0x13, 0x3D, 0x13, 0x00, 0x7D, 0x41,
+0xD0, 0x90, 0x5A, 0x02, 0x30, 0x3F, 0x26, 0x49, 0x22, 0x54, 0x04, 0x26, 0x36, 0x26, 0x0A, 0x22,
+0x27, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x45, 0x7F, 0x57, 0xD1, 0x54, 0x30, 0x85, 0x49, 0x85, 0x60,
+0x85, 0x49, 0x60, 0x17, 0x54, 0x30, 0x54, 0x17, 0x37, 0x1F, 0x12, 0x00, 0x06, 0xC1, 0xB2, 0x07,
+0x05, 0x6E, 0x4D, 0xC3, 0x4D, 0x6E, 0xBB, 0x45, 0x00, 0xC7, 0xBB, 0x7F, 0xA0, 0x87, 0x7F, 0xEC,
+0x0D, 0x07, 0x00, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x11, 0x41, 0x4A, 0x00,
+0x40, 0x00, 0x42, 0x4E, 0x45, 0x43, 0x44, 0x42, 0x40, 0x03, 0x42, 0x63, 0x45, 0x44, 0x00, 0x42,
+0x48, 0x40, 0x01, 0x4A, 0x43, 0x48, 0x61, 0x4A, 0x00, 0x40, 0x01, 0x42, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x44, 0x40, 0x41, 0x40, 0x01, 0x48, 0x44, 0x43, 0x45, 0x40, 0x00, 0x41, 0x40, 0x02, 0x43,
+0x44, 0x42, 0x43, 0x4B, 0x67, 0x40, 0x00, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x48, 0x43,
+0x44, 0x4A, 0x42, 0x00, 0x4A, 0x41, 0x40, 0x00, 0x42, 0x48, 0x43, 0x41, 0x00, 0x40, 0x04, 0x41,
+0x4E, 0x43, 0x4A, 0xCD, 0x49, 0x01, 0x08, 0x1F, 0x0B, 0x00, 0x27, 0x02, 0x04, 0x03, 0x05, 0x03,
+0x02, 0x00, 0x02, 0x52, 0x40, 0x00, 0xD5, 0x47, 0x31, 0x25, 0x08, 0x05, 0x00, 0x01, 0x04, 0x02,
+0x08, 0x01, 0x08, 0x1F, 0x2D, 0xB3, 0x2C, 0x1D, 0x91, 0x3C, 0xB3, 0x7E, 0x69, 0x00, 0xC1, 0xBF,
+0xA8, 0x00, 0xC7, 0xB3, 0x91, 0x57, 0x3C, 0xA1, 0x07, 0x2E, 0x07, 0x04, 0x4D, 0xCC, 0x55, 0x39,
+0xCB, 0x07, 0x0D, 0x61, 0x45, 0x87, 0xDC, 0x87, 0x4B, 0x0D, 0x07, 0x03, 0x6E, 0xC5, 0xB4, 0x00,
+0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x0F, 0xC1, 0x4F, 0x10, 0x01, 0xC2, 0x78, 0x20, 0x66, 0x00, 0xC2, 0x78, 0x1B,
+0x1A, 0x00, 0xC1, 0x41, 0x09, 0x00, 0xC3, 0x78, 0x10, 0x1B, 0x1A, 0x01, 0xC6, 0x9E, 0x09, 0x20,
+0x72, 0x41, 0x15, 0x02, 0x06, 0x4E, 0x4A, 0x48, 0x42, 0x41, 0x40, 0x00, 0xDF, 0xC5, 0x11, 0x6C,
+0x53, 0x7A, 0xB8, 0x4C, 0x76, 0x32, 0x42, 0x4A, 0x8F, 0x95, 0xB0, 0x2B, 0x32, 0x64, 0x71, 0x3E,
+0x2B, 0xE6, 0x84, 0x5A, 0xE6, 0x23, 0x01, 0x44, 0xA6, 0x08, 0x00, 0x3E, 0x32, 0x42, 0x52, 0xC3,
+0x4A, 0x2A, 0x11, 0x2F, 0x01, 0x66, 0xC1, 0x70, 0x0C, 0x01, 0xC4, 0x77, 0x23, 0x9E, 0x0E, 0x23,
+0x00, 0x4E, 0x4C, 0xCB, 0x64, 0x04, 0x5A, 0x2A, 0x11, 0x5C, 0x2F, 0xA7, 0x11, 0x64, 0x9D, 0x7C,
+0x00, 0xC3, 0x4C, 0x83, 0x63, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4E, 0x44, 0x4E, 0xC2, 0x53, 0x0E,
+0x02, 0x02, 0x5B, 0x49, 0xC1, 0x97, 0x09, 0x01, 0x5B, 0x73, 0x5A, 0x5B, 0x50, 0xCA, 0xCF, 0x1B,
+0x72, 0xCF, 0x1A, 0xA5, 0xCF, 0x1B, 0x62, 0x09, 0x97, 0x00, 0x49, 0xC3, 0x41, 0x13, 0x3D, 0x13,
+0x01, 0xC1, 0x8B, 0x88, 0x00, 0xC6, 0x64, 0x4C, 0x56, 0x6F, 0x4C, 0x7A, 0x3D, 0x00, 0x53, 0xD2,
+0x7A, 0x01, 0x36, 0x30, 0x2D, 0x27, 0x1E, 0x36, 0x26, 0x01, 0x3F, 0x5A, 0x30, 0x27, 0x3F, 0x5A,
+0x22, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x45, 0x77, 0x57, 0x66, 0xD1, 0x54, 0x49, 0x54, 0x37,
+0x90, 0x17, 0x54, 0x37, 0x17, 0x54, 0x17, 0x54, 0x37, 0x17, 0x0F, 0x00, 0x0B, 0x00, 0x04, 0x71,
+0xC1, 0xB2, 0x07, 0x06, 0x6E, 0xCE, 0x81, 0x55, 0xBB, 0x38, 0xC3, 0xEC, 0x4B, 0x87, 0xB9, 0x79,
+0x87, 0x0D, 0x2E, 0x07, 0x0D, 0x00, 0x47, 0x02, 0xC1, 0x81, 0x00, 0x13, 0x45, 0x43, 0x40, 0x01,
+0x44, 0x42, 0x4A, 0x43, 0x00, 0x41, 0x40, 0x02, 0x4A, 0x00, 0x48, 0x44, 0x42, 0x40, 0x4A, 0x41,
+0x40, 0x00, 0x4A, 0x48, 0x4E, 0x68, 0x45, 0x43, 0x40, 0x01, 0x44, 0x42, 0x61, 0x4E, 0xC5, 0x44,
+0x21, 0x03, 0x00, 0x01, 0x00, 0x01, 0x45, 0x48, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x02, 0x4A,
+0x41, 0x40, 0x41, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x48, 0x43, 0x4A, 0x43,
+0x42, 0x00, 0x43, 0x00, 0x42, 0x43, 0x00, 0x45, 0x4A, 0x42, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x45,
+0x48, 0x00, 0x44, 0x48, 0x41, 0x4B, 0x40, 0x00, 0x42, 0x44, 0x00, 0xC3, 0x44, 0x08, 0x1F, 0x00,
+0x06, 0x45, 0x7E, 0x42, 0x41, 0x00, 0x40, 0x44, 0x42, 0xD6, 0x96, 0x04, 0x08, 0x47, 0x12, 0xB3,
+0x3C, 0x1D, 0xA8, 0x7E, 0x69, 0x91, 0x3C, 0xA8, 0x7E, 0xA8, 0x91, 0x69, 0x91, 0x3C, 0x1D, 0xA1,
+0x07, 0x00, 0x6E, 0x47, 0x03, 0xCC, 0x46, 0x87, 0xED, 0x4B, 0x38, 0x81, 0x39, 0x45, 0xBB, 0x6E,
+0x39, 0x81, 0x07, 0x05, 0xC5, 0xB4, 0x0B, 0x31, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40, 0x0E, 0x41,
+0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xCB, 0x4F, 0x15, 0x82,
+0x66, 0x70, 0x1A, 0x66, 0x70, 0x66, 0x78, 0x88, 0xA5, 0x00, 0x55, 0x5B, 0x73, 0x5A, 0xCB, 0xAB,
+0xDE, 0x1A, 0x92, 0x9E, 0x7B, 0x82, 0x72, 0x09, 0x1B, 0x1C, 0x02, 0x05, 0x4E, 0x43, 0x4E, 0x42,
+0x41, 0x40, 0x00, 0xCA, 0x89, 0x6C, 0x34, 0x7A, 0xAF, 0x0B, 0x25, 0x76, 0x3E, 0x2A, 0x2B, 0x00,
+0xC3, 0x95, 0x26, 0x4A, 0x11, 0x00, 0x7B, 0x01, 0x51, 0xC9, 0x86, 0x5A, 0xA6, 0x32, 0x64, 0x3B,
+0xE6, 0x23, 0x4A, 0x32, 0x00, 0xC0, 0x4A, 0x00, 0x51, 0x6A, 0x6F, 0xC6, 0x6C, 0x11, 0x4A, 0x63,
+0x08, 0x0C, 0x23, 0x01, 0x4C, 0x63, 0x03, 0x75, 0x4E, 0x42, 0xCE, 0x5A, 0x11, 0x8F, 0x2A, 0x5C,
+0x2F, 0x3B, 0x4C, 0x4F, 0x2D, 0xAF, 0x7A, 0x76, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4E, 0x42,
+0x4A, 0x4E, 0x48, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09, 0x03, 0x60, 0xC3, 0x72, 0x1A, 0xE0, 0x1A,
+0x00, 0x60, 0xC2, 0x66, 0x88, 0x1A, 0x00, 0x50, 0x55, 0x49, 0x00, 0xD1, 0x97, 0x09, 0x41, 0x80,
+0x13, 0x7D, 0x13, 0x80, 0x4C, 0x66, 0x4C, 0x64, 0xA9, 0x56, 0xA9, 0x56, 0x8B, 0x13, 0x01, 0x7D,
+0x65, 0xD0, 0x90, 0x5A, 0x3F, 0x58, 0x28, 0x36, 0x30, 0x0F, 0x30, 0x02, 0x5A, 0x30, 0x3F, 0x49,
+0x3F, 0x0F, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x77, 0xC3, 0x85, 0x60, 0x54, 0x49, 0x00,
+0x70, 0xCB, 0x49, 0x54, 0x49, 0x37, 0x54, 0x30, 0x54, 0x17, 0x37, 0x1F, 0x12, 0x00, 0x03, 0x4B,
+0x40, 0x00, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x4D, 0x00, 0xCC, 0x4D, 0x55, 0x39, 0x55, 0xB1, 0x87,
+0x4D, 0x61, 0x87, 0x4D, 0x39, 0x79, 0x07, 0x00, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0xC2, 0x81, 0x0B,
+0x00, 0x12, 0x45, 0x43, 0x40, 0x41, 0x40, 0x43, 0x42, 0x43, 0x42, 0x48, 0x41, 0x40, 0x01, 0x42,
+0x4A, 0x42, 0x4E, 0x48, 0x44, 0x00, 0x48, 0x40, 0x01, 0x4A, 0x42, 0x43, 0x42, 0x41, 0x48, 0x40,
+0x01, 0x42, 0x48, 0x43, 0x00, 0xC0, 0x50, 0x00, 0x44, 0x40, 0x41, 0x40, 0x00, 0x41, 0x43, 0x45,
+0x4A, 0x42, 0x40, 0x00, 0x41, 0x40, 0x02, 0x43, 0x00, 0x42, 0x43, 0x40, 0x02, 0x41, 0x40, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x45, 0x01, 0x42, 0x40, 0x00, 0x41, 0x44, 0x43, 0x41, 0x45, 0x43, 0x42,
+0x40, 0x41, 0x40, 0x04, 0x41, 0x43, 0x00, 0x45, 0x41, 0x43, 0x45, 0x41, 0x4F, 0x41, 0x40, 0x45,
+0x00, 0x40, 0x43, 0x42, 0x40, 0x07, 0xD5, 0xAA, 0x08, 0x04, 0x21, 0x1F, 0x00, 0x05, 0x01, 0x25,
+0x60, 0x05, 0x0B, 0x12, 0xB3, 0x57, 0x3C, 0x2C, 0xBF, 0x7E, 0x57, 0x1D, 0x57, 0x00, 0x7C, 0xC0,
+0x7E, 0x00, 0xC4, 0x69, 0x1D, 0x57, 0xA1, 0x07, 0x06, 0xC3, 0x46, 0x39, 0x4D, 0x45, 0x00, 0x4D,
+0xC8, 0x45, 0x79, 0x45, 0x39, 0x45, 0x0D, 0x07, 0x2E, 0x07, 0x02, 0x6E, 0xC6, 0xB4, 0x2D, 0x00,
+0x12, 0x0B, 0x12, 0x00, 0x02, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x0E, 0x52, 0xCB, 0x4F, 0x15, 0x82, 0x72, 0x1A, 0x33, 0x10, 0x1B, 0x20, 0x72,
+0x1A, 0x33, 0x00, 0xCF, 0x82, 0x09, 0x15, 0x1A, 0x72, 0x78, 0x10, 0x41, 0x33, 0x09, 0x10, 0x82,
+0x15, 0x10, 0x29, 0x02, 0x05, 0x44, 0x4A, 0x44, 0x69, 0x41, 0x40, 0x00, 0xDB, 0xC5, 0x3B, 0x71,
+0x7C, 0x2D, 0x12, 0x0B, 0x65, 0x71, 0x2B, 0x5C, 0x42, 0xD2, 0x93, 0x90, 0xC5, 0x3F, 0x89, 0x36,
+0x89, 0x36, 0x89, 0x3B, 0xA6, 0x42, 0x2B, 0x32, 0x42, 0x00, 0x6B, 0x00, 0x6A, 0x51, 0x6B, 0x51,
+0xC2, 0x5C, 0x11, 0x5C, 0x00, 0x7B, 0x4E, 0x00, 0x4C, 0xCF, 0x8D, 0x0E, 0x8D, 0x0E, 0x8D, 0x0C,
+0x9E, 0x23, 0x9E, 0x77, 0x8D, 0x03, 0x64, 0x2A, 0x2F, 0x5C, 0x00, 0x51, 0xC8, 0x64, 0x65, 0xC0,
+0x12, 0x00, 0x4F, 0x76, 0xB8, 0x00, 0x02, 0x45, 0x42, 0x00, 0x44, 0x42, 0x48, 0x00, 0x42, 0x03,
+0x5B, 0x49, 0x02, 0xC6, 0x62, 0x09, 0x15, 0x20, 0x1A, 0x66, 0x20, 0x00, 0x5A, 0x50, 0x60, 0x5A,
+0x50, 0x5B, 0x49, 0x02, 0xCA, 0x62, 0x41, 0x13, 0x3D, 0x13, 0x7D, 0x80, 0xCC, 0x56, 0xDF, 0x56,
+0x00, 0xC2, 0x6F, 0x56, 0x13, 0x01, 0x7D, 0x53, 0xD0, 0x65, 0x4F, 0x1E, 0x89, 0x30, 0x3F, 0x1E,
+0x28, 0x3F, 0x1E, 0x3F, 0x30, 0x3F, 0x22, 0x26, 0x3F, 0x1E, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x62, 0x7F, 0x57, 0x66, 0xC3, 0x49, 0x60, 0x17, 0x85, 0x00, 0x77, 0x70, 0xC5, 0x85, 0x30, 0x60,
+0x85, 0x60, 0x17, 0x00, 0x4F, 0x52, 0x4B, 0x40, 0x05, 0xC1, 0xB2, 0x07, 0x06, 0x4D, 0x78, 0xC0,
+0x4D, 0x00, 0x78, 0xC7, 0x4B, 0x55, 0x39, 0x38, 0x45, 0x39, 0xC6, 0x07, 0x00, 0x6E, 0x47, 0x03,
+0x6E, 0xC2, 0x81, 0x0B, 0x00, 0x12, 0x41, 0x45, 0x41, 0x45, 0x40, 0x45, 0x41, 0x00, 0x43, 0x42,
+0x40, 0x02, 0x41, 0x45, 0x40, 0x45, 0x42, 0x43, 0x44, 0x41, 0x00, 0x45, 0x41, 0x42, 0x43, 0x44,
+0x40, 0x41, 0x45, 0x41, 0x45, 0x41, 0x00, 0x42, 0x44, 0x40, 0x42, 0x44, 0x67, 0x40, 0x41, 0x40,
+0x01, 0x45, 0x43, 0x42, 0x41, 0x40, 0x00, 0x41, 0x40, 0x02, 0x41, 0x44, 0x43, 0x41, 0x40, 0x02,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0B, 0x44, 0x48, 0x43, 0x45, 0x40,
+0x0B, 0x52, 0x4B, 0x40, 0x09, 0x52, 0xC4, 0xB3, 0x2C, 0x1D, 0x2C, 0x1D, 0x01, 0xC1, 0x57, 0x1D,
+0x02, 0xC5, 0xF4, 0x1D, 0x3C, 0x57, 0xA1, 0x07, 0x02, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x03, 0x6E,
+0x47, 0x01, 0x4D, 0x47, 0x06, 0x4D, 0xC5, 0xB4, 0x00, 0x31, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC4, 0x4F,
+0x09, 0x15, 0x1B, 0x09, 0x02, 0x55, 0x00, 0x5B, 0x55, 0x49, 0x55, 0x49, 0x00, 0x5B, 0x00, 0x55,
+0x49, 0x00, 0x5B, 0x55, 0x49, 0xC3, 0x41, 0x09, 0x1B, 0x02, 0x06, 0x45, 0x42, 0x01, 0x52, 0x40,
+0x00, 0xC4, 0x95, 0x6C, 0x34, 0x7A, 0x0B, 0x00, 0xC4, 0x6B, 0x4C, 0x71, 0x2B, 0x2A, 0x00, 0xC3,
+0x42, 0x2F, 0x8F, 0x2F, 0x00, 0xC1, 0x42, 0x11, 0x02, 0xC0, 0xA6, 0x00, 0x6B, 0xC9, 0x42, 0x2B,
+0x11, 0x2B, 0x2A, 0x5C, 0x11, 0x2F, 0x5C, 0x2A, 0x00, 0x51, 0xC1, 0x8F, 0x11, 0x00, 0x42, 0x56,
+0x63, 0x00, 0xC3, 0x8D, 0x23, 0x8D, 0x23, 0x00, 0x4C, 0x63, 0x00, 0x4C, 0xC5, 0x92, 0x00, 0x59,
+0x11, 0x6C, 0x5C, 0x00, 0xC9, 0x6C, 0x3B, 0x4C, 0xAF, 0x0B, 0x31, 0x7C, 0x76, 0x65, 0x00, 0x02,
+0x45, 0x42, 0x03, 0x45, 0x42, 0x03, 0x5B, 0x50, 0x49, 0xC1, 0x41, 0x09, 0x02, 0x55, 0x5B, 0x00,
+0x55, 0x49, 0x5B, 0x49, 0x55, 0x49, 0xC3, 0x41, 0x09, 0x1B, 0x09, 0x00, 0xC4, 0x41, 0x09, 0x41,
+0x7A, 0x3D, 0x01, 0x53, 0x00, 0xC7, 0x7D, 0x13, 0x3D, 0xDF, 0x94, 0xDF, 0x3D, 0x94, 0x00, 0xD4,
+0xBE, 0x3D, 0x94, 0x01, 0x1E, 0x27, 0x12, 0x27, 0x0F, 0x12, 0x1E, 0x0F, 0x27, 0xD9, 0x27, 0x0F,
+0x27, 0x1E, 0x0F, 0x01, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x5F, 0x7F, 0x57, 0x04, 0x68, 0x57, 0x00,
+0x62, 0x57, 0x03, 0x7F, 0xC1, 0xA2, 0x00, 0x07, 0xC1, 0xD6, 0x07, 0x07, 0x6E, 0x4D, 0x00, 0x47,
+0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0xC2,
+0x81, 0xC0, 0x00, 0x27, 0x41, 0x43, 0x01, 0x41, 0x40, 0x03, 0x42, 0x43, 0x00, 0x42, 0x40, 0x05,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x41, 0x45, 0x25, 0x4F, 0x5F, 0x41, 0x00,
+0x45, 0x0A, 0x7A, 0xC2, 0x93, 0x3A, 0x05, 0x08, 0x61, 0x62, 0x7C, 0x00, 0xC0, 0x69, 0x01, 0x7C,
+0xC4, 0x69, 0x3C, 0x69, 0x3C, 0x69, 0x00, 0x7C, 0xCB, 0x69, 0x3C, 0x69, 0x14, 0x38, 0x45, 0xB1,
+0xC3, 0xB1, 0xC3, 0xB1, 0xC3, 0x00, 0xDE, 0xB1, 0xC3, 0xB1, 0xC3, 0xB1, 0x55, 0xC3, 0x45, 0xB1,
+0xC3, 0x55, 0xC3, 0xB1, 0x45, 0xB1, 0xC3, 0x45, 0xB1, 0xE4, 0x25, 0x01, 0x1F, 0x01, 0x1F, 0x0F,
+0x01, 0x1F, 0x0F, 0x05, 0x1F, 0x05, 0x1B, 0x69, 0x4F, 0x45, 0x11, 0x5F, 0x45, 0x5F, 0x45, 0x5F,
+0x45, 0x5F, 0x45, 0x5F, 0x45, 0x5F, 0x45, 0x4F, 0x45, 0x11, 0xC8, 0x8A, 0x99, 0x82, 0x20, 0xA5,
+0x20, 0xA5, 0x20, 0xA5, 0x00, 0x60, 0xC0, 0xA5, 0x00, 0x60, 0x00, 0xC1, 0xA5, 0x20, 0x00, 0xC0,
+0xA5, 0x00, 0x60, 0xC3, 0xA5, 0x7B, 0xA5, 0x20, 0x00, 0xC2, 0x6D, 0x51, 0x04, 0x09, 0x61, 0x5F,
+0xC5, 0x4F, 0x95, 0x6C, 0x3B, 0x50, 0x7C, 0x00, 0xC4, 0x7A, 0x53, 0x3B, 0xDB, 0x2A, 0x01, 0x6B,
+0xCA, 0x42, 0x2A, 0x11, 0xA6, 0xE6, 0xA6, 0x42, 0x2B, 0x42, 0xA6, 0x42, 0x00, 0xC0, 0xA6, 0x01,
+0xC1, 0x42, 0x2B, 0x00, 0x6A, 0xCB, 0x5C, 0x11, 0x2A, 0x5C, 0x2F, 0x2A, 0x11, 0x0A, 0x0E, 0x77,
+0x23, 0x0C, 0x00, 0x63, 0x00, 0xC0, 0x8D, 0x00, 0x63, 0xC1, 0x8D, 0x23, 0x00, 0x43, 0xC1, 0x84,
+0x11, 0x01, 0xC5, 0x5C, 0x8F, 0x2A, 0x64, 0x7A, 0x6B, 0x00, 0x53, 0xC0, 0x52, 0x00, 0x4F, 0x5F,
+0x45, 0x00, 0x42, 0x44, 0x08, 0xC3, 0x63, 0xAD, 0x82, 0x20, 0x01, 0xC2, 0xA5, 0x20, 0xA5, 0x00,
+0x60, 0x00, 0xC8, 0xA5, 0x20, 0xA5, 0x20, 0xA5, 0x10, 0x20, 0xA5, 0x20, 0x00, 0xC4, 0xA5, 0x7B,
+0x20, 0xA5, 0x4C, 0x09, 0xC1, 0x56, 0x4C, 0x04, 0x42, 0x68, 0x00, 0xCC, 0x90, 0x28, 0x90, 0x02,
+0x28, 0x02, 0x90, 0x02, 0x28, 0xBD, 0x28, 0x02, 0x28, 0x00, 0x45, 0x1C, 0x5F, 0x7F, 0xC1, 0x60,
+0x37, 0x01, 0xC3, 0x60, 0x37, 0x60, 0x37, 0x00, 0xC1, 0x60, 0x37, 0x00, 0xC1, 0x60, 0x37, 0x00,
+0xC5, 0x60, 0x37, 0x02, 0x05, 0x0F, 0x05, 0x04, 0x62, 0xCC, 0x7D, 0x45, 0xB1, 0xC3, 0xB1, 0x45,
+0xB1, 0xC3, 0x55, 0xC3, 0xB1, 0xC3, 0x55, 0x00, 0xC6, 0xC3, 0x45, 0xB1, 0x55, 0xC3, 0xB1, 0xC3,
+0x00, 0xC2, 0x55, 0xB1, 0xC3, 0x00, 0xC1, 0xB1, 0xC3, 0x00, 0xC2, 0x45, 0xDC, 0x05, 0x29, 0x41,
+0x45, 0x41, 0x45, 0x06, 0x41, 0x45, 0x1E, 0x40, 0x43, 0x36, 0xC6, 0x63, 0x3B, 0x2B, 0x32, 0x59,
+0x51, 0x03, 0x03, 0xC6, 0x51, 0x60, 0x03, 0x51, 0x26, 0xA8, 0x7E, 0x01, 0xC1, 0x85, 0x7E, 0x01,
+0xC3, 0xBF, 0x7E, 0xBF, 0x7E, 0x01, 0xC4, 0xD2, 0x7E, 0xC7, 0x4D, 0x39, 0x03, 0xC1, 0x6E, 0x39,
+0x01, 0xC1, 0x6E, 0x39, 0x06, 0xC1, 0x6E, 0x39, 0x04, 0xCD, 0xA0, 0x6C, 0x5C, 0x11, 0x6C, 0x5C,
+0x2F, 0x6C, 0x11, 0x6C, 0x5C, 0x84, 0x26, 0x03, 0x0C, 0xC1, 0x51, 0x03, 0x1D, 0x44, 0x43, 0x48,
+0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66,
+0x43, 0xC1, 0x51, 0x03, 0x0A, 0xC6, 0x51, 0x03, 0x63, 0x6D, 0x1A, 0x33, 0x1A, 0x14, 0x73, 0x5A,
+0x4A, 0x0A, 0x43, 0xCB, 0x60, 0x51, 0x63, 0x6C, 0x2A, 0x3B, 0x71, 0x50, 0x53, 0x3B, 0x2B, 0x2A,
+0x00, 0xC8, 0x42, 0x2A, 0x8F, 0xA7, 0xB0, 0x5A, 0x9B, 0x4A, 0x3B, 0x00, 0xC5, 0x4A, 0x84, 0x3B,
+0x4A, 0x0E, 0x4A, 0x01, 0xC0, 0x84, 0x00, 0xDF, 0xA7, 0xD2, 0xA7, 0x11, 0x2A, 0x11, 0x2F, 0x5C,
+0x4A, 0x03, 0x08, 0x23, 0x0C, 0x9E, 0x23, 0x0C, 0x9E, 0x8D, 0x23, 0x8D, 0x0E, 0x0C, 0x0E, 0x02,
+0x4A, 0x2B, 0x11, 0x2A, 0x11, 0x2F, 0x11, 0x2B, 0xC1, 0x71, 0x50, 0x00, 0x74, 0xC2, 0x6C, 0x3E,
+0x03, 0x01, 0x44, 0x48, 0x4A, 0x08, 0xC1, 0x86, 0x1A, 0x01, 0x73, 0x5A, 0x13, 0xC1, 0x6A, 0xA9,
+0x00, 0xCA, 0x6F, 0x6A, 0x6F, 0x6A, 0x6F, 0x6A, 0x6F, 0x6A, 0x6F, 0x6A, 0x6F, 0x01, 0xC0, 0x6A,
+0x00, 0xC4, 0x6D, 0x60, 0x03, 0x26, 0x03, 0x00, 0x66, 0x43, 0x00, 0x66, 0x43, 0x00, 0x66, 0x43,
+0x01, 0x66, 0x43, 0x1D, 0x48, 0xC2, 0x49, 0x85, 0x49, 0x01, 0xC5, 0x85, 0x49, 0x85, 0x49, 0x85,
+0x49, 0x00, 0xC1, 0x85, 0x49, 0x00, 0xC5, 0x85, 0x49, 0x30, 0x36, 0x50, 0x03, 0x02, 0xC4, 0x63,
+0x03, 0x96, 0x4E, 0x39, 0x05, 0xC1, 0x6E, 0x39, 0x02, 0xC0, 0x6E, 0x00, 0x79, 0x00, 0xC0, 0x6E,
+0x00, 0x79, 0x03, 0xC1, 0x6E, 0x39, 0x03, 0xC3, 0x6E, 0x60, 0x96, 0x03, 0xE0, 0x12, 0x42, 0x41,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x4B, 0xC3, 0x9B, 0x2B, 0x59, 0x00, 0x09,
+0x52, 0xC1, 0xB3, 0x1D, 0x08, 0x6C, 0x00, 0x5D, 0x7C, 0x5D, 0xC4, 0xA1, 0x07, 0x0D, 0x07, 0x0D,
+0x01, 0x47, 0x00, 0x4D, 0x03, 0x47, 0x05, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x6E, 0xC1, 0x43,
+0x19, 0x07, 0xC1, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x4F, 0x01, 0xCE, 0x93,
+0x0F, 0x93, 0x0F, 0x93, 0x0F, 0x93, 0x0F, 0x93, 0x0F, 0x22, 0x40, 0x0F, 0x01, 0x00, 0x0F, 0xC5,
+0x4F, 0x15, 0x09, 0x1B, 0x09, 0x15, 0x00, 0x49, 0x55, 0x49, 0x55, 0x00, 0x49, 0x5B, 0x55, 0xC1,
+0x41, 0x15, 0x00, 0x49, 0x55, 0x49, 0x55, 0x00, 0xC1, 0x41, 0x09, 0x00, 0x5B, 0x69, 0x42, 0x07,
+0x61, 0x68, 0x4B, 0x40, 0x00, 0xDA, 0xBD, 0x6C, 0x75, 0x11, 0x2B, 0x11, 0x2B, 0xDB, 0x2A, 0x42,
+0x2A, 0x42, 0x4A, 0x93, 0x89, 0x9A, 0x59, 0x6D, 0x50, 0x53, 0x6D, 0x53, 0x6D, 0x50, 0x59, 0x53,
+0x50, 0x00, 0xC2, 0x9D, 0x36, 0x63, 0x00, 0xC6, 0x89, 0x3A, 0x2F, 0x2A, 0x5C, 0x8F, 0x11, 0x00,
+0x4A, 0xC6, 0x92, 0x23, 0x0C, 0x23, 0x0C, 0x23, 0x0C, 0x00, 0x63, 0x01, 0x4C, 0x4E, 0x76, 0x7B,
+0x51, 0x00, 0xCB, 0xDB, 0x11, 0x26, 0xD2, 0x42, 0x2B, 0x11, 0x3B, 0x2B, 0x75, 0x95, 0x00, 0x02,
+0x41, 0x42, 0x08, 0x68, 0x5B, 0x49, 0x00, 0xC1, 0x41, 0x09, 0x00, 0x55, 0x49, 0x55, 0x49, 0x55,
+0x49, 0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x5B, 0x49, 0x5B, 0x55, 0xC6, 0x41, 0xBE,
+0x8B, 0x3D, 0x80, 0xBE, 0x94, 0x00, 0xCC, 0xBE, 0x94, 0x7A, 0x8B, 0x7A, 0x8B, 0x94, 0xBE, 0x94,
+0x7D, 0x3D, 0xAF, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x4F, 0x57, 0x0F, 0x4F, 0x40,
+0x07, 0xC1, 0xD6, 0x07, 0x01, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0x4D, 0x00,
+0x47, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x00, 0x47, 0x4D, 0x47, 0x4D, 0x01, 0x47, 0xC2, 0x81, 0x0B,
+0x00, 0x3C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x71, 0x6D, 0xC3, 0x9B, 0x14, 0xE8, 0x00, 0x02, 0x41, 0x40, 0x03, 0x4B, 0x52,
+0xC2, 0xB3, 0x2C, 0x1D, 0x03, 0x7C, 0x5D, 0x7C, 0x5D, 0x01, 0x6C, 0x5D, 0xC2, 0x57, 0xA1, 0x07,
+0x00, 0x4D, 0x00, 0x47, 0x01, 0x4D, 0x47, 0x01, 0x4D, 0x6E, 0x47, 0x01, 0x4D, 0x01, 0xC2, 0x79,
+0x0D, 0x07, 0x01, 0x4D, 0x47, 0xC2, 0xC6, 0x43, 0x19, 0x01, 0xC3, 0x43, 0x19, 0x43, 0x19, 0x01,
+0xC2, 0xC8, 0x47, 0x00, 0x0D, 0x41, 0x52, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x67, 0x45, 0xC3, 0x93,
+0x40, 0x93, 0x40, 0x02, 0xC1, 0x93, 0x40, 0x04, 0x62, 0x5E, 0x40, 0x4B, 0x40, 0x0C, 0x52, 0xC4,
+0x4F, 0x62, 0x09, 0x10, 0x09, 0x05, 0xC1, 0x41, 0x15, 0x00, 0x49, 0x55, 0x49, 0xC1, 0x41, 0x09,
+0x06, 0x5B, 0x69, 0x42, 0x05, 0x68, 0x61, 0x68, 0x42, 0x41, 0x52, 0x4B, 0x5C, 0xC1, 0x6C, 0x5C,
+0x01, 0x6A, 0x01, 0xCA, 0x5C, 0x84, 0x2B, 0x42, 0x4A, 0x36, 0x23, 0x86, 0x0A, 0x88, 0x51, 0x00,
+0xC1, 0x6A, 0x6D, 0x00, 0xD3, 0x6A, 0x6D, 0x6A, 0x50, 0x6A, 0x16, 0x44, 0x6D, 0x08, 0x4A, 0x89,
+0x4A, 0x2A, 0x11, 0x5C, 0x2A, 0x32, 0x59, 0x49, 0x0C, 0x02, 0xC1, 0x9E, 0x0C, 0x03, 0xC5, 0x8D,
+0x0E, 0x89, 0x84, 0x11, 0x2F, 0x00, 0xCC, 0x9A, 0x3F, 0xA4, 0xD2, 0x5C, 0x2A, 0x6C, 0x2A, 0xBC,
+0x95, 0x00, 0x31, 0x00, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x45, 0x00, 0x42, 0x02, 0x69, 0x5B,
+0x49, 0x05, 0x5B, 0x49, 0x5B, 0x50, 0x49, 0xC1, 0x41, 0x09, 0x00, 0x5B, 0x49, 0x05, 0xC2, 0x41,
+0x80, 0x13, 0x00, 0xC1, 0x7D, 0x13, 0x01, 0xC4, 0x8B, 0x7D, 0x13, 0x7D, 0x13, 0x03, 0xC3, 0x7D,
+0x13, 0x4F, 0x0B, 0x00, 0x40, 0x0B, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x57, 0x00,
+0x7F, 0x68, 0x57, 0x01, 0x68, 0x57, 0x01, 0x7F, 0x57, 0x02, 0x62, 0x40, 0x00, 0x4B, 0x40, 0x01,
+0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x05, 0x4D, 0x47, 0x01, 0x4D, 0x00, 0x47, 0x0C, 0x4D, 0x47,
+0xC1, 0x81, 0x00, 0x12, 0x41, 0x40, 0x28, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x41, 0x44, 0x4B, 0x00, 0x40, 0x41, 0x43, 0x48, 0x44, 0x42, 0x45,
+0x01, 0x40, 0x41, 0x40, 0x04, 0x41, 0x48, 0x43, 0x44, 0x40, 0x42, 0x45, 0x40, 0x41, 0x40, 0x45,
+0x43, 0x44, 0x40, 0x42, 0x00, 0x40, 0x03, 0x4B, 0x67, 0x42, 0x40, 0x41, 0x43, 0x00, 0x41, 0x40,
+0x00, 0x42, 0x45, 0x42, 0x48, 0x00, 0x41, 0x71, 0xC1, 0xB3, 0x57, 0x00, 0x7C, 0xC0, 0x7E, 0x00,
+0xC2, 0x69, 0x1D, 0x69, 0x00, 0x5D, 0xC0, 0xBF, 0x00, 0x5D, 0x6C, 0xC4, 0x57, 0xA1, 0x07, 0x38,
+0x39, 0x00, 0x78, 0xD7, 0xCB, 0x38, 0x4D, 0x38, 0x4D, 0xB9, 0x39, 0x2E, 0x0D, 0x07, 0x45, 0xEC,
+0x55, 0x0D, 0x07, 0xCB, 0x4D, 0x38, 0x39, 0x87, 0x4D, 0x79, 0x43, 0x19, 0x00, 0xC0, 0x5F, 0x00,
+0xC1, 0x43, 0x75, 0x00, 0xC0, 0x43, 0x00, 0xC1, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0E, 0x4B, 0x52, 0x62, 0xC0, 0x40, 0x00, 0x42, 0xC0, 0x49, 0x00, 0x7F, 0x76, 0xC5, 0x90, 0x36,
+0x37, 0x5A, 0x60, 0x40, 0x00, 0x62, 0x4F, 0x40, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x06, 0x60, 0x73,
+0xC8, 0xA5, 0x78, 0x1A, 0x20, 0x99, 0x78, 0x20, 0x15, 0x09, 0x00, 0x55, 0x49, 0xC3, 0x62, 0x09,
+0x10, 0x02, 0x06, 0x48, 0x4E, 0x4A, 0x42, 0x41, 0x6D, 0x4B, 0x42, 0xC2, 0xBC, 0x75, 0x2A, 0x00,
+0x51, 0x6B, 0x00, 0xC6, 0x5C, 0x95, 0x54, 0x42, 0x84, 0x36, 0x0E, 0x00, 0xC4, 0x70, 0x3E, 0x6A,
+0x56, 0x6A, 0x00, 0xC0, 0x6D, 0x00, 0xD1, 0x6A, 0x6D, 0x6A, 0x70, 0x6A, 0x44, 0x29, 0x00, 0x0A,
+0xF6, 0x2F, 0x2A, 0x5C, 0x2F, 0x2B, 0x11, 0x3B, 0x0C, 0x00, 0xC1, 0x9E, 0x0C, 0x00, 0xD1, 0x8D,
+0x0C, 0x77, 0x9E, 0x0C, 0x77, 0x0C, 0x4A, 0x2F, 0x11, 0x5C, 0x11, 0x2F, 0x36, 0x28, 0xA2, 0xA4,
+0x2B, 0x00, 0x51, 0x6B, 0xC2, 0x5C, 0x95, 0x00, 0x02, 0x45, 0x42, 0x44, 0x48, 0x69, 0x4A, 0x00,
+0x7F, 0x42, 0x02, 0x5B, 0x49, 0x03, 0x55, 0xCB, 0x41, 0x33, 0xAB, 0x1A, 0x10, 0x33, 0x72, 0xA5,
+0x09, 0x1A, 0x10, 0x09, 0x04, 0xC2, 0x41, 0x13, 0x3D, 0x00, 0x53, 0xC0, 0x80, 0x01, 0xC5, 0x88,
+0x4C, 0x3D, 0xCC, 0x4E, 0x13, 0x00, 0xC5, 0x7D, 0x13, 0x80, 0x13, 0xB7, 0x00, 0x0D, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0A, 0x62, 0x77, 0x57, 0x70, 0xC3, 0x49, 0x30, 0x60, 0x54, 0x00, 0x77, 0x57,
+0xC3, 0x49, 0x37, 0x17, 0x49, 0x00, 0x77, 0x57, 0x5F, 0x52, 0x40, 0x06, 0xC1, 0xB2, 0x07, 0x05,
+0x4D, 0x47, 0xCB, 0x45, 0x39, 0x4D, 0x2E, 0x0D, 0x46, 0xB9, 0x45, 0xCB, 0x6E, 0x4B, 0x07, 0x06,
+0x6E, 0xC1, 0x81, 0x00, 0x13, 0x45, 0x42, 0x40, 0x01, 0x42, 0x45, 0x42, 0x48, 0x00, 0x41, 0x40,
+0x01, 0x41, 0x00, 0x48, 0x40, 0x42, 0x48, 0x43, 0x45, 0x40, 0x41, 0x4B, 0x44, 0x48, 0xC4, 0x51,
+0x27, 0x21, 0x02, 0x00, 0x02, 0x43, 0x00, 0x40, 0x45, 0x44, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41,
+0x45, 0x43, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x02, 0x41, 0x43, 0x48, 0x45, 0x41, 0x40, 0x01,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x41, 0x4A, 0x4B, 0x40, 0x00, 0x41, 0x4E, 0x42, 0x45,
+0x48, 0x00, 0x44, 0x42, 0x40, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x44, 0x48, 0x45, 0x4E, 0x44, 0x40,
+0x01, 0x43, 0x42, 0x48, 0x42, 0x4E, 0x43, 0x40, 0x07, 0x42, 0x44, 0x43, 0x44, 0x40, 0x42, 0x4E,
+0x44, 0x40, 0x44, 0xC1, 0x58, 0x00, 0x00, 0xC8, 0xB3, 0x2C, 0x1D, 0x7E, 0xBF, 0x3C, 0x91, 0x69,
+0x91, 0x00, 0xDF, 0xB3, 0x91, 0xC9, 0x3C, 0x2C, 0x57, 0xA1, 0xBA, 0x46, 0x7F, 0xA0, 0x4D, 0xC3,
+0x46, 0xC2, 0x55, 0x81, 0x6E, 0x87, 0x0D, 0x07, 0x0D, 0x46, 0x6E, 0x87, 0x45, 0xC6, 0x4D, 0xC2,
+0xBA, 0x81, 0x61, 0xCD, 0x4D, 0x79, 0x43, 0x19, 0x43, 0x2B, 0x75, 0x5F, 0x2B, 0x75, 0x43, 0x19,
+0xC8, 0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x62, 0x00, 0xD1, 0x40, 0x03, 0x26,
+0x90, 0x5A, 0x37, 0x5A, 0x60, 0x26, 0x3F, 0x54, 0x17, 0x0F, 0x22, 0x0F, 0x00, 0x0B, 0x00, 0x0D,
+0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x03, 0xCB, 0x97, 0x66, 0x78, 0x33, 0x66, 0x1A, 0xAB, 0x33,
+0x1A, 0x72, 0x1B, 0x09, 0x00, 0x55, 0x49, 0x01, 0x50, 0x42, 0x07, 0x4A, 0x00, 0x42, 0xC1, 0x47,
+0x00, 0x00, 0xC2, 0x89, 0x8F, 0x11, 0x00, 0x74, 0xD0, 0x6A, 0x71, 0x3B, 0x42, 0x4A, 0xF6, 0x9A,
+0x4A, 0x36, 0x4A, 0x0E, 0x0A, 0x88, 0x50, 0x4C, 0x6A, 0x6D, 0x00, 0xCF, 0x6A, 0x6D, 0x6A, 0x6D,
+0x6A, 0x6D, 0x4C, 0x16, 0x47, 0x58, 0x3F, 0x2F, 0x2B, 0x11, 0x5C, 0x11, 0x00, 0x72, 0xC8, 0x54,
+0x5A, 0x23, 0x0A, 0x98, 0x0E, 0x6D, 0x98, 0x0E, 0x00, 0x4A, 0x4E, 0x66, 0xC1, 0x4A, 0x11, 0x00,
+0xCC, 0x5C, 0x2B, 0x5A, 0x90, 0x26, 0x11, 0x84, 0x50, 0x44, 0x83, 0x11, 0xCE, 0x00, 0x02, 0x45,
+0x42, 0x4E, 0x00, 0x5C, 0x4E, 0x4A, 0x66, 0x68, 0x42, 0x01, 0x5B, 0xC1, 0x7B, 0x09, 0x02, 0x55,
+0xC3, 0x82, 0x78, 0xA5, 0x1A, 0x00, 0x73, 0xC5, 0x92, 0x1A, 0x33, 0xE0, 0x10, 0x09, 0x04, 0xD1,
+0x41, 0x13, 0x7D, 0xCC, 0x8B, 0x13, 0x8B, 0x56, 0x9E, 0x56, 0xDF, 0x6F, 0x9E, 0x94, 0x3D, 0x13,
+0x80, 0x13, 0x00, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x57,
+0xCB, 0x54, 0x30, 0x49, 0x5A, 0x30, 0x36, 0x54, 0x36, 0xC9, 0x49, 0x30, 0x85, 0x00, 0xC3, 0x60,
+0x17, 0x22, 0x00, 0x00, 0x4B, 0x40, 0x04, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x4D, 0x00, 0xCB, 0x55,
+0x4D, 0xBB, 0xB1, 0x46, 0x87, 0x7F, 0x39, 0x7F, 0xC2, 0x4B, 0x07, 0x05, 0x4D, 0x47, 0xC2, 0x81,
+0x0B, 0x00, 0x11, 0x41, 0x4A, 0x48, 0x40, 0x00, 0x42, 0x4E, 0x42, 0x40, 0x44, 0x48, 0x40, 0x03,
+0x42, 0x4E, 0x42, 0x44, 0x42, 0x00, 0x48, 0x40, 0x4B, 0x40, 0x4A, 0x43, 0x4A, 0x45, 0x4A, 0x00,
+0x40, 0x01, 0x42, 0x43, 0x44, 0x00, 0x43, 0x4E, 0x40, 0x00, 0x41, 0x40, 0x01, 0x48, 0x43, 0x44,
+0x45, 0x40, 0x00, 0x41, 0x40, 0x02, 0x43, 0x42, 0x00, 0x44, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x41, 0x4A, 0x4B, 0x00, 0x42, 0x00, 0x4E, 0x44, 0x45, 0x43, 0x00, 0x48, 0x42,
+0x40, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x44, 0x4E, 0x41, 0x44, 0x42, 0x40, 0x01, 0x48, 0x45, 0x43,
+0x45, 0x42, 0x44, 0x40, 0x08, 0x45, 0x48, 0x41, 0x40, 0x00, 0x44, 0x42, 0x40, 0x48, 0x45, 0x40,
+0x41, 0xD6, 0xB3, 0x2C, 0x3C, 0x91, 0x69, 0xB3, 0x7E, 0xBF, 0x69, 0x7E, 0x3C, 0xC9, 0x54, 0xA8,
+0x1D, 0x57, 0xA1, 0x07, 0x0D, 0x55, 0x61, 0x38, 0x0D, 0x00, 0xC5, 0x4D, 0x46, 0x0D, 0x87, 0xC6,
+0x07, 0x01, 0xCD, 0xCB, 0x55, 0x87, 0x38, 0x0D, 0xCB, 0x39, 0x4B, 0x45, 0xBB, 0x0D, 0x2E, 0x43,
+0x19, 0x00, 0xC0, 0x75, 0x00, 0xC0, 0x6C, 0x00, 0xC4, 0x75, 0x5F, 0x43, 0xC8, 0x00, 0x0F, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0D, 0x4B, 0x40, 0x52, 0x62, 0xC0, 0x40, 0x00, 0xCA, 0x51, 0x54, 0x0E,
+0x26, 0xD9, 0x23, 0x36, 0x27, 0x37, 0x30, 0x40, 0x00, 0x62, 0x4F, 0x52, 0x40, 0x0E, 0xC2, 0x4F,
+0x62, 0x09, 0x06, 0x60, 0x5A, 0x60, 0xC9, 0x66, 0x92, 0x66, 0x1B, 0x1A, 0x72, 0x10, 0x09, 0x10,
+0x09, 0x02, 0x5B, 0x5C, 0x42, 0x06, 0x4E, 0x42, 0x00, 0x41, 0x40, 0x71, 0xCA, 0x89, 0x6C, 0x3B,
+0x76, 0xB8, 0x7C, 0x65, 0x6D, 0x3B, 0x42, 0x2F, 0x01, 0x76, 0x63, 0x4E, 0x4A, 0xC8, 0x88, 0x6D,
+0x7A, 0x6A, 0x6D, 0x6A, 0x51, 0x6A, 0x6D, 0x00, 0xC2, 0x6A, 0x6D, 0xB8, 0x00, 0x41, 0xC3, 0x58,
+0x89, 0x2F, 0x2B, 0x00, 0x51, 0x6F, 0x51, 0x6B, 0x72, 0x6F, 0x63, 0x66, 0x4A, 0x4E, 0x42, 0xD0,
+0x58, 0x08, 0x5A, 0x58, 0x32, 0x11, 0x3E, 0xA4, 0x84, 0x42, 0x2A, 0x5C, 0x84, 0x32, 0x71, 0xD4,
+0x7C, 0x00, 0xC3, 0x65, 0x52, 0x63, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4A, 0x44, 0x4E, 0x4A, 0x66,
+0x42, 0x02, 0x5B, 0x49, 0xC1, 0x97, 0x09, 0x01, 0x5B, 0x73, 0x00, 0x5B, 0x60, 0x5A, 0x55, 0x5A,
+0x00, 0x5B, 0xC2, 0x72, 0x7B, 0x09, 0x03, 0xC4, 0x62, 0x41, 0x13, 0x7D, 0x13, 0x01, 0x7D, 0xC0,
+0x88, 0x00, 0xC4, 0x64, 0x44, 0xA9, 0x88, 0x7A, 0x00, 0x53, 0x7D, 0xC3, 0x80, 0x13, 0xB7, 0x00,
+0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x57, 0x70, 0xC7, 0x54, 0x85, 0x49, 0x60,
+0x90, 0x54, 0x0E, 0x54, 0x01, 0xC6, 0x60, 0x30, 0x85, 0x17, 0x0F, 0x12, 0x00, 0x05, 0x71, 0xC1,
+0xB2, 0x07, 0x05, 0xCD, 0xBA, 0x0D, 0xCB, 0xDC, 0xBB, 0xB1, 0x45, 0x61, 0x79, 0x87, 0x0D, 0x39,
+0x45, 0x07, 0x07, 0xC1, 0x81, 0x00, 0x13, 0x45, 0x43, 0x40, 0x01, 0x44, 0x42, 0x40, 0x4A, 0x45,
+0x40, 0x03, 0x4E, 0x4A, 0x00, 0x5C, 0x68, 0x40, 0x4A, 0x41, 0x40, 0x00, 0x4A, 0x43, 0x4A, 0x42,
+0x45, 0x43, 0x40, 0x01, 0x44, 0x00, 0x42, 0xC6, 0x51, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01,
+0x45, 0x43, 0x48, 0x45, 0x40, 0x00, 0x41, 0x40, 0x02, 0x4A, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40,
+0x00, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x41, 0x4A, 0x42, 0xC1, 0xAA, 0x02, 0x00, 0x4E,
+0x45, 0x00, 0x43, 0x45, 0x4E, 0x44, 0x40, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x42, 0x48, 0x41, 0x5C,
+0x44, 0x40, 0x01, 0x44, 0x43, 0x48, 0x41, 0x42, 0x43, 0x40, 0x07, 0x45, 0x4E, 0x42, 0x41, 0x45,
+0x40, 0x44, 0x42, 0x41, 0xCE, 0x70, 0x00, 0x0B, 0x00, 0xB3, 0x57, 0x1D, 0xA8, 0xA7, 0x69, 0x91,
+0x3C, 0x69, 0xA8, 0x7E, 0x00, 0xC9, 0xA8, 0x91, 0x2C, 0x57, 0xA1, 0xBA, 0x46, 0xBB, 0x7F, 0x38,
+0x00, 0x4D, 0x79, 0xD4, 0x55, 0x38, 0xB9, 0x81, 0xC6, 0x4B, 0x0D, 0x4D, 0x7F, 0xA0, 0x45, 0x4B,
+0x0D, 0x61, 0x79, 0x4D, 0x6E, 0x0D, 0xC6, 0x9F, 0x19, 0x00, 0xC9, 0x5F, 0x75, 0x6C, 0x5F, 0x75,
+0x5F, 0x19, 0xC8, 0x0B, 0x00, 0x0D, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x62, 0xD2, 0x93,
+0x40, 0x03, 0x60, 0x36, 0x5A, 0x30, 0x26, 0x58, 0x30, 0x54, 0x3F, 0x40, 0x22, 0x93, 0x0F, 0x00,
+0x0B, 0x00, 0x0D, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x03, 0xCB, 0x41, 0x82, 0xAB, 0x33, 0x66,
+0x20, 0x92, 0x72, 0x20, 0x72, 0x10, 0x09, 0x00, 0x55, 0x49, 0x00, 0xC2, 0x62, 0x10, 0x02, 0x06,
+0x43, 0x4A, 0x42, 0x00, 0x52, 0x40, 0x00, 0xCA, 0xC5, 0x6C, 0x3E, 0x65, 0xC0, 0x0B, 0x6B, 0x4C,
+0x3E, 0x2B, 0x42, 0x00, 0xCA, 0x4A, 0x36, 0x23, 0x0A, 0x53, 0x0E, 0x51, 0x4C, 0x6D, 0x6A, 0x6D,
+0x00, 0xCE, 0x6A, 0x6D, 0x6A, 0x6D, 0x6A, 0x9D, 0x16, 0x47, 0x58, 0x95, 0x2F, 0x2B, 0x42, 0x2B,
+0x11, 0x02, 0x6B, 0x51, 0xC1, 0x4A, 0x23, 0x00, 0xD1, 0x4A, 0x23, 0x3B, 0x32, 0x3B, 0x42, 0x32,
+0xA7, 0xF1, 0x84, 0x11, 0x2A, 0x5C, 0x2F, 0x3B, 0x56, 0x6B, 0xC0, 0x00, 0xC3, 0xB8, 0x76, 0x65,
+0x00, 0x02, 0x45, 0x42, 0x00, 0x4E, 0x44, 0xC3, 0x92, 0x0A, 0x49, 0x02, 0x02, 0x5B, 0xC1, 0x7B,
+0x09, 0x03, 0xCC, 0x7B, 0x78, 0x1A, 0xE0, 0x1A, 0xAB, 0x99, 0x92, 0x15, 0xCF, 0x7B, 0x97, 0x09,
+0x03, 0xC2, 0x41, 0x13, 0x3D, 0x00, 0x53, 0xC4, 0x8B, 0x56, 0x88, 0x51, 0x88, 0x01, 0xC5, 0x9E,
+0x65, 0x7A, 0x8B, 0x80, 0x13, 0x00, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x62, 0x7F, 0x77, 0xC2, 0x54, 0x60, 0x54, 0x00, 0xC2, 0x85, 0x49, 0x54, 0x00, 0x70, 0xC0, 0x54,
+0x00, 0xC5, 0x49, 0x54, 0x60, 0x17, 0xA2, 0x00, 0x00, 0x4B, 0x40, 0x04, 0xC1, 0xB2, 0x07, 0x05,
+0x4D, 0x00, 0xC6, 0x4D, 0x7F, 0x39, 0x55, 0x38, 0x87, 0x39, 0x00, 0xC3, 0x81, 0x39, 0x45, 0x07,
+0x05, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x12, 0x45, 0x43, 0x40, 0x41, 0x40, 0x43, 0x42, 0x41,
+0x48, 0x40, 0x03, 0x42, 0x4A, 0x45, 0x4A, 0x00, 0x44, 0xC2, 0x51, 0x26, 0x00, 0x01, 0x4A, 0x42,
+0x48, 0x42, 0x41, 0x48, 0x40, 0x01, 0x42, 0x43, 0x48, 0x42, 0x52, 0x48, 0x40, 0x00, 0x41, 0x40,
+0x01, 0x43, 0x42, 0x48, 0x42, 0x40, 0x00, 0x41, 0x40, 0x02, 0x44, 0x43, 0x44, 0x43, 0x40, 0x02,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x4B, 0x44, 0xC2, 0x44, 0x02, 0x00, 0x00, 0x44, 0x00,
+0x42, 0x00, 0x40, 0x45, 0x00, 0x40, 0x41, 0x40, 0x04, 0x67, 0x44, 0xC4, 0x44, 0x05, 0x00, 0x1F,
+0x01, 0x00, 0x45, 0x00, 0x41, 0x44, 0x45, 0x40, 0x41, 0x45, 0x40, 0x07, 0x45, 0x43, 0x44, 0x45,
+0x00, 0x40, 0x5F, 0x41, 0x67, 0x45, 0x52, 0x40, 0x41, 0xC8, 0xB3, 0x2C, 0x57, 0x1D, 0x69, 0xBF,
+0x57, 0x1D, 0x57, 0x01, 0x7C, 0x5D, 0xC8, 0x69, 0x2C, 0x57, 0xA1, 0x07, 0x45, 0x39, 0x7F, 0x45,
+0x00, 0x4D, 0xC1, 0x45, 0x38, 0x00, 0xD2, 0x45, 0x0D, 0x46, 0x45, 0x07, 0xCB, 0x6E, 0x55, 0x4B,
+0xC6, 0xBA, 0x45, 0x79, 0x45, 0x38, 0x0D, 0x2E, 0x43, 0x19, 0x00, 0xC3, 0x43, 0x5F, 0x43, 0x5F,
+0x00, 0x59, 0xC2, 0x43, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0xD3, 0x47, 0x12,
+0x40, 0x22, 0x40, 0x21, 0x17, 0x22, 0x37, 0x36, 0x0F, 0x3F, 0x26, 0x60, 0x26, 0x22, 0x40, 0x22,
+0x0F, 0x00, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x05, 0x50, 0xC9, 0x97, 0x7B, 0x10, 0x1A, 0x33, 0x7B,
+0x82, 0x1A, 0x10, 0x09, 0x05, 0x5B, 0x42, 0x06, 0x44, 0x00, 0x42, 0x00, 0x41, 0x40, 0x00, 0xCA,
+0x89, 0x6C, 0x71, 0x7C, 0x2D, 0xD9, 0xC0, 0x65, 0x6A, 0x2A, 0x42, 0x00, 0xC8, 0x4A, 0x26, 0x4A,
+0x6D, 0x03, 0x6A, 0x16, 0x4C, 0x6D, 0x00, 0xD0, 0x51, 0x6A, 0x51, 0x6D, 0x56, 0x6D, 0x51, 0x4C,
+0x1C, 0x31, 0x3E, 0xA4, 0x2F, 0x2B, 0x2A, 0x42, 0x11, 0x00, 0x6A, 0xC2, 0x42, 0x11, 0x2B, 0x00,
+0x72, 0x6B, 0x72, 0x6B, 0x72, 0x51, 0xC1, 0x42, 0x11, 0x00, 0x6B, 0x51, 0x6B, 0x51, 0x00, 0x6A,
+0xC9, 0x5C, 0x3B, 0x65, 0x6B, 0x2D, 0x12, 0xD8, 0x76, 0xB8, 0x00, 0x02, 0x45, 0x42, 0x00, 0x44,
+0x42, 0x43, 0x48, 0xC1, 0xBD, 0x02, 0x02, 0x5B, 0x49, 0xC1, 0x97, 0x09, 0x02, 0x5B, 0x60, 0x73,
+0xC7, 0x72, 0x20, 0x7B, 0x1A, 0x10, 0x09, 0x20, 0x09, 0x05, 0xD4, 0x41, 0x13, 0x7D, 0x13, 0x3D,
+0x80, 0xCC, 0x4C, 0xBE, 0x65, 0x4C, 0x3D, 0x4C, 0x3D, 0x13, 0x3D, 0x13, 0x80, 0x13, 0xB7, 0x00,
+0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x57, 0x00, 0x77, 0xC5, 0x49, 0x96, 0x37, 0x85,
+0x30, 0x37, 0x00, 0x57, 0x77, 0xC7, 0x60, 0x30, 0x60, 0x17, 0x37, 0x0F, 0x12, 0x00, 0x06, 0xC1,
+0xB2, 0x07, 0x06, 0x4D, 0xCB, 0x79, 0x4D, 0x46, 0xC6, 0x38, 0x45, 0x4D, 0x4B, 0x07, 0x45, 0xBA,
+0x07, 0x06, 0x6E, 0xC1, 0x81, 0x00, 0x14, 0x45, 0x41, 0x45, 0x40, 0x41, 0x01, 0x45, 0x40, 0x03,
+0x45, 0x00, 0x40, 0x45, 0x42, 0x44, 0x00, 0xC1, 0x47, 0x05, 0x01, 0x42, 0x43, 0x5C, 0x40, 0x41,
+0x45, 0x41, 0x45, 0x00, 0x41, 0x42, 0x00, 0x40, 0x00, 0x45, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40,
+0x41, 0x43, 0x42, 0x41, 0x40, 0x00, 0x41, 0x40, 0x02, 0x41, 0x44, 0x00, 0x41, 0x40, 0x02, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0B, 0x44, 0x43, 0x00, 0x45, 0x40, 0x19,
+0xC1, 0xB3, 0x2C, 0x00, 0x5D, 0x03, 0x6C, 0x5D, 0x6C, 0x5D, 0x6C, 0x5D, 0x00, 0x6C, 0xC5, 0xA1,
+0x07, 0x0D, 0x81, 0x2E, 0x07, 0x06, 0xC1, 0x79, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47,
+0x01, 0x4D, 0x47, 0x00, 0x6E, 0xC1, 0x9F, 0x19, 0x04, 0xC1, 0x9F, 0x19, 0x00, 0xC1, 0xC8, 0x00,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x10, 0x62, 0xC0, 0x40, 0x00, 0x41, 0xC2, 0x40, 0x0F, 0x1E,
+0x00, 0x4F, 0x5E, 0x02, 0xC0, 0x40, 0x00, 0x4F, 0x5E, 0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x15, 0x41,
+0x09, 0x00, 0xC1, 0x41, 0x09, 0x00, 0xC4, 0x41, 0x15, 0x41, 0x09, 0x1B, 0x00, 0x55, 0x00, 0x5B,
+0x00, 0x49, 0x55, 0x49, 0x55, 0x49, 0x01, 0x5B, 0x42, 0x06, 0x45, 0x42, 0x01, 0x40, 0x01, 0xD3,
+0xC5, 0x6C, 0x71, 0x65, 0xC0, 0x2D, 0x6B, 0x4C, 0x92, 0x2B, 0x2A, 0x42, 0x4A, 0x36, 0x23, 0x0E,
+0x8D, 0x53, 0x21, 0x16, 0x02, 0xC3, 0x4C, 0x16, 0x4C, 0x16, 0x00, 0xC7, 0x7C, 0x16, 0x70, 0x08,
+0x0E, 0x3F, 0x11, 0x42, 0x01, 0x51, 0x00, 0x6A, 0x6B, 0x00, 0x51, 0xC6, 0x42, 0x2B, 0x32, 0x11,
+0x2B, 0x32, 0x11, 0x00, 0x6B, 0x6A, 0x00, 0x6B, 0x72, 0x51, 0x03, 0xC7, 0x76, 0x6B, 0x0B, 0x00,
+0x8A, 0x76, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x02, 0x69, 0x45, 0xC1, 0x90, 0x02, 0x01, 0x69, 0x5B,
+0x49, 0x02, 0x55, 0x49, 0x00, 0x5B, 0x01, 0x49, 0x55, 0x5B, 0xC3, 0x41, 0x15, 0x1B, 0x09, 0x04,
+0x55, 0xC3, 0x41, 0x3D, 0x13, 0x3D, 0x00, 0xC8, 0x80, 0xBE, 0x80, 0xBE, 0x3D, 0x8B, 0x3D, 0x13,
+0x3D, 0x00, 0xC1, 0xBE, 0x8B, 0x00, 0x53, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x62, 0x7F, 0x57, 0x00, 0x62, 0x57, 0x00, 0x68, 0x57, 0xC3, 0x90, 0x17, 0x3F, 0x17, 0x04,
+0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07, 0x08, 0x4D, 0x6E, 0x47, 0x00, 0x4D, 0x00, 0x47, 0x00, 0x4D,
+0x47, 0x06, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x27, 0x41, 0x44, 0x43, 0x44, 0x65, 0x40, 0x03,
+0x42, 0x43, 0x00, 0x42, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x44, 0x45,
+0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42,
+0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42,
+0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x02, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68,
+0x61, 0x68, 0x61, 0x68, 0x42, 0x45, 0x61, 0x45, 0x68, 0x00, 0x61, 0x68, 0x61, 0x68, 0x61, 0xC6,
+0xAA, 0x02, 0x05, 0x29, 0xBD, 0x3C, 0x69, 0x0B, 0xC3, 0x9A, 0x69, 0x14, 0x55, 0x19, 0xC1, 0x6C,
+0x5F, 0x00, 0xC5, 0x6C, 0x5F, 0xBC, 0x5F, 0x6C, 0x5F, 0x00, 0x7E, 0x45, 0x69, 0x45, 0x00, 0x61,
+0x45, 0x00, 0x61, 0x45, 0x01, 0x61, 0x45, 0x02, 0x68, 0x42, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68,
+0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x42, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61,
+0x68, 0x61, 0x68, 0x61, 0x68, 0x45, 0x42, 0x61, 0x68, 0x7F, 0x01, 0x44, 0x7F, 0x0B, 0x45, 0x00,
+0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0xC2, 0xBD,
+0x16, 0x20, 0x13, 0xC1, 0x82, 0x20, 0x02, 0xC2, 0x51, 0x44, 0x03, 0x01, 0x44, 0x43, 0x03, 0x44,
+0x42, 0x00, 0x61, 0xC4, 0x89, 0x6C, 0x11, 0x76, 0x7C, 0x00, 0xC4, 0x4C, 0x76, 0x3B, 0x2A, 0x42,
+0x00, 0x72, 0xC3, 0x89, 0x26, 0x08, 0x0A, 0x00, 0x48, 0x4A, 0x04, 0xC1, 0x86, 0x0A, 0x00, 0xC8,
+0x50, 0x03, 0x36, 0x63, 0xA4, 0x89, 0x11, 0xA6, 0x42, 0x01, 0x72, 0x51, 0xC3, 0x42, 0x11, 0x32,
+0x42, 0x00, 0x51, 0x6B, 0xC0, 0x42, 0x00, 0x51, 0x00, 0x6B, 0x72, 0x00, 0xC3, 0x42, 0x11, 0x2B,
+0x11, 0x00, 0x6F, 0x7B, 0x74, 0xCB, 0xB8, 0x6B, 0x7C, 0x7A, 0x71, 0x59, 0x21, 0xBD, 0x05, 0x29,
+0x02, 0x03, 0x01, 0xC1, 0x63, 0x03, 0x04, 0xC4, 0x51, 0x6D, 0x20, 0x99, 0x20, 0x02, 0xC3, 0x99,
+0x20, 0x99, 0x20, 0x00, 0xC5, 0x99, 0x20, 0x99, 0x20, 0x99, 0x20, 0x04, 0xC2, 0x70, 0xA5, 0x56,
+0x01, 0xC1, 0x4C, 0x56, 0x00, 0xC1, 0x4C, 0x56, 0x02, 0xD2, 0x4C, 0x56, 0xA5, 0x56, 0x51, 0x4C,
+0x56, 0x8A, 0x90, 0x05, 0xAA, 0x05, 0x29, 0x21, 0x05, 0x21, 0x29, 0x05, 0x21, 0x00, 0xC1, 0xAA,
+0x21, 0x00, 0x42, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68,
+0x61, 0x68, 0x61, 0x68, 0x61, 0x42, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61, 0x68, 0x61,
+0x68, 0x45, 0x44, 0x66, 0xC2, 0x60, 0x26, 0x60, 0x08, 0x77, 0xC0, 0x60, 0x01, 0x7F, 0x45, 0x61,
+0x42, 0x61, 0xC7, 0xAA, 0x05, 0x02, 0x21, 0xAA, 0xCC, 0x45, 0x55, 0x19, 0xDF, 0x45, 0xED, 0x29,
+0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05,
+0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x45, 0x42, 0x45,
+0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x04, 0x42, 0x45, 0x42, 0x45, 0x03,
+0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x01, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42,
+0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x40, 0x43,
+0x44, 0x43, 0x44, 0x05, 0x43, 0x00, 0x44, 0x0D, 0x43, 0x00, 0x44, 0x18, 0x76, 0xC5, 0x63, 0x3B,
+0x2B, 0x32, 0x26, 0x04, 0x05, 0x76, 0x44, 0xC4, 0x51, 0x36, 0xA8, 0xBF, 0xA8, 0x00, 0xC0, 0xBF,
+0x01, 0xC0, 0xA8, 0x00, 0xC0, 0xBF, 0x02, 0xC4, 0x85, 0xA8, 0xBF, 0x86, 0x4D, 0x0E, 0xC5, 0x6E,
+0x4D, 0x6E, 0x4D, 0x7F, 0x4D, 0x03, 0x79, 0xC2, 0x75, 0x5F, 0x75, 0x01, 0xC1, 0x5F, 0x75, 0x01,
+0xC5, 0x5F, 0x84, 0x30, 0x49, 0x58, 0x49, 0x02, 0xC1, 0x58, 0x49, 0x01, 0xC1, 0x58, 0x49, 0x03,
+0x76, 0x44, 0x76, 0x44, 0x08, 0x43, 0x44, 0x0B, 0x76, 0xD1, 0x44, 0x04, 0x51, 0x36, 0x26, 0x30,
+0x60, 0x26, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x26, 0x01, 0x43, 0x76, 0x43,
+0x44, 0x0B, 0x76, 0xC2, 0x63, 0x6D, 0x33, 0x00, 0x5A, 0x73, 0x5A, 0x73, 0x5A, 0x73, 0x5A, 0x73,
+0x00, 0x5A, 0x73, 0x5A, 0x73, 0x00, 0x5A, 0x73, 0x00, 0x5A, 0x73, 0x5A, 0x73, 0x5A, 0x73, 0xC1,
+0x70, 0x0A, 0x00, 0x48, 0x4A, 0x48, 0x4A, 0x00, 0x48, 0x4A, 0x48, 0x00, 0x4A, 0x44, 0x00, 0xCD,
+0x44, 0x36, 0x6C, 0x2A, 0x3B, 0x71, 0x50, 0x71, 0x23, 0x32, 0x2B, 0x42, 0x2B, 0x42, 0x00, 0xC6,
+0xA6, 0x32, 0x68, 0x35, 0x68, 0x35, 0x68, 0x00, 0xC7, 0xA6, 0x35, 0x32, 0xA6, 0x68, 0xA6, 0x35,
+0x32, 0x01, 0x6B, 0x72, 0x6B, 0xC3, 0x42, 0x2B, 0xA6, 0x11, 0x00, 0xC0, 0x42, 0x00, 0x51, 0x6B,
+0x51, 0xC1, 0xA6, 0x2B, 0x02, 0x51, 0xC0, 0x42, 0x00, 0x6B, 0x51, 0x6B, 0x51, 0xC1, 0x42, 0x11,
+0x00, 0x6F, 0x51, 0x6B, 0x4E, 0xC0, 0x50, 0x00, 0xCA, 0x71, 0x6C, 0x3E, 0x44, 0x04, 0x03, 0x04,
+0x26, 0x0A, 0x08, 0x0A, 0x01, 0x48, 0x4A, 0x00, 0x48, 0x4A, 0xC2, 0x86, 0x6D, 0x51, 0x00, 0xC7,
+0x96, 0x44, 0x51, 0x96, 0x44, 0x51, 0x04, 0x51, 0x00, 0x44, 0xCA, 0x51, 0x44, 0x96, 0x44, 0x51,
+0x96, 0x51, 0x96, 0x44, 0x96, 0x51, 0x00, 0xC1, 0x6F, 0x6A, 0x01, 0xC3, 0x6F, 0x6A, 0x6F, 0x6A,
+0x01, 0xC3, 0x6F, 0x6A, 0x6F, 0x6A, 0x01, 0xC3, 0x6F, 0x6A, 0x51, 0x26, 0x00, 0x43, 0x00, 0x66,
+0x43, 0x66, 0x43, 0x66, 0x43, 0x66, 0x43, 0x66, 0x43, 0x66, 0x43, 0x44, 0x0F, 0xC2, 0x44, 0x03,
+0x04, 0x0A, 0x70, 0xC1, 0x49, 0x85, 0x00, 0xCB, 0x49, 0x85, 0x49, 0x85, 0x49, 0x85, 0x49, 0x85,
+0x49, 0x85, 0x49, 0x85, 0x00, 0xC1, 0x49, 0x60, 0x00, 0xC1, 0x63, 0x04, 0x00, 0x43, 0x44, 0x00,
+0x76, 0xC2, 0x96, 0x4E, 0x4D, 0x07, 0xC1, 0x6E, 0x4D, 0x01, 0xC1, 0x6E, 0x4D, 0x00, 0x79, 0xC0,
+0x4D, 0x00, 0xC1, 0x6E, 0x4D, 0x03, 0xC5, 0x6E, 0x4D, 0x7F, 0x4D, 0x6E, 0x04, 0x2C, 0x43, 0x44,
+0x0E, 0x43, 0x44, 0x07, 0x43, 0xC1, 0x44, 0x04, 0x07, 0x43, 0x00, 0x42, 0x41, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x6D, 0xC3, 0x6C, 0x2B, 0x95, 0x00, 0x09, 0x52, 0xC1, 0xB3,
+0x1D, 0x04, 0x7C, 0x5D, 0x04, 0x7C, 0x5D, 0xCC, 0xF2, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07,
+0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x00, 0x47, 0x4D, 0x47, 0x04, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0xC2,
+0x79, 0x9F, 0x19, 0x00, 0xC3, 0x9F, 0x19, 0x9F, 0x19, 0x02, 0xC1, 0x95, 0x17, 0x0E, 0x68, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x10, 0x5E, 0x0B, 0xC0, 0x40, 0x00, 0x4F, 0x67, 0x40, 0x0F, 0xC1, 0x4F,
+0x15, 0x00, 0xDF, 0x41, 0x15, 0x41, 0x1B, 0x15, 0x41, 0x1B, 0x09, 0x1B, 0x09, 0x1B, 0x09, 0x15,
+0x41, 0x15, 0x41, 0x15, 0x41, 0x15, 0x1B, 0x15, 0x41, 0x09, 0x1B, 0x29, 0x28, 0x21, 0x28, 0x21,
+0x28, 0x21, 0x02, 0xC1, 0xAA, 0x02, 0x00, 0x45, 0x41, 0x40, 0x00, 0xC6, 0xC5, 0x8F, 0x75, 0x2A,
+0x2B, 0x32, 0x2B, 0x00, 0x6A, 0xC0, 0x42, 0x00, 0x6B, 0xC0, 0xA6, 0x00, 0xC0, 0xE6, 0x01, 0xC2,
+0xA6, 0x73, 0xE6, 0x02, 0xC0, 0xA6, 0x00, 0xC0, 0xE6, 0x02, 0xC4, 0xA6, 0xE6, 0x2B, 0xA6, 0x2B,
+0x00, 0xC0, 0xA6, 0x00, 0x6B, 0x00, 0xC3, 0x42, 0x11, 0xA6, 0x2B, 0x00, 0x51, 0x6B, 0xC4, 0xA6,
+0x42, 0x2B, 0x42, 0x2B, 0x01, 0x72, 0x6B, 0xC3, 0x42, 0x2B, 0xA6, 0x11, 0x00, 0xC5, 0xA4, 0xB0,
+0x2A, 0x2B, 0x11, 0x2B, 0x00, 0xC2, 0xBC, 0x95, 0x00, 0x02, 0x41, 0x42, 0x45, 0x69, 0x45, 0xC8,
+0xAA, 0x02, 0x05, 0x02, 0x05, 0x02, 0xBD, 0x1F, 0x00, 0x15, 0xC2, 0x6B, 0x3D, 0x8B, 0x00, 0xCC,
+0xBE, 0x3D, 0x8B, 0x3D, 0x8B, 0x3D, 0x8B, 0x3D, 0x8B, 0x3D, 0x8B, 0x3D, 0x8B, 0x00, 0xC6, 0xBE,
+0x01, 0x27, 0x1E, 0x0F, 0x27, 0x1E, 0x07, 0x52, 0x5E, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0xC1,
+0xA2, 0x17, 0x02, 0x68, 0x57, 0x07, 0x68, 0x57, 0x00, 0x4F, 0x40, 0x07, 0xC8, 0xD6, 0x0D, 0x07,
+0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x4D, 0x00,
+0x47, 0x4D, 0x47, 0x4D, 0x02, 0x47, 0x02, 0xC2, 0x81, 0xC0, 0x00, 0x3C, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x08, 0x41, 0x40, 0x02,
+0x41, 0x40, 0x04, 0x41, 0x40, 0x02, 0x71, 0x6D, 0xC4, 0x9B, 0x14, 0xD3, 0x31, 0x00, 0x04, 0xC9,
+0x47, 0x12, 0x00, 0x47, 0x12, 0xB3, 0x57, 0x1D, 0x57, 0x1D, 0x06, 0xCC, 0x57, 0x1D, 0x3C, 0x2C,
+0xA1, 0xBA, 0x07, 0x79, 0x0D, 0x4B, 0x07, 0x4B, 0x0D, 0x00, 0xC1, 0x4B, 0x0D, 0x00, 0x47, 0x4D,
+0x47, 0x00, 0x4D, 0x00, 0x47, 0x00, 0x6E, 0x4D, 0x47, 0x6E, 0x4D, 0x00, 0xC2, 0xC6, 0x9F, 0x43,
+0x00, 0xC2, 0xD1, 0x43, 0x19, 0x00, 0xC1, 0x43, 0x19, 0x00, 0xC1, 0x9A, 0x17, 0x07, 0x7F, 0x57,
+0x05, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x62, 0x02, 0x4F, 0x5E, 0x62, 0x4F, 0x62, 0xC1,
+0x40, 0x0F, 0x00, 0x5E, 0x62, 0xC3, 0x93, 0x22, 0x0F, 0x00, 0x0F, 0xC4, 0x4F, 0x7B, 0x09, 0x10,
+0x09, 0x04, 0x55, 0x49, 0x50, 0x49, 0x5B, 0x49, 0x00, 0x55, 0xC1, 0x41, 0x09, 0x01, 0x55, 0x49,
+0x01, 0x50, 0x69, 0x42, 0x06, 0x61, 0x42, 0x00, 0x41, 0x40, 0x00, 0xC3, 0xBD, 0x8F, 0xBC, 0x2A,
+0x00, 0xC0, 0x5C, 0x00, 0x6A, 0xC4, 0x8F, 0x9A, 0x2F, 0x42, 0xA6, 0x03, 0xC4, 0x68, 0xE6, 0xA6,
+0x73, 0xA6, 0x00, 0x75, 0xC3, 0xE6, 0xA6, 0xE6, 0xA6, 0x02, 0xC5, 0x42, 0xA6, 0x2B, 0x32, 0x42,
+0xA6, 0x00, 0x72, 0xCC, 0xA6, 0x32, 0x2B, 0x32, 0xA6, 0x2B, 0x32, 0xA6, 0x32, 0x2B, 0x32, 0x2B,
+0x32, 0x00, 0x6B, 0x72, 0xC8, 0xA6, 0x32, 0x2B, 0x11, 0x59, 0x9A, 0x5A, 0x59, 0x2A, 0x02, 0xC2,
+0xBC, 0x95, 0x00, 0x00, 0x71, 0x40, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x61, 0x42, 0x03, 0x62,
+0x40, 0x01, 0x52, 0x40, 0x11, 0x65, 0x7D, 0xC3, 0x80, 0x7A, 0x7D, 0x13, 0x01, 0xC1, 0x8B, 0x13,
+0x01, 0x7D, 0x53, 0x01, 0xC8, 0x7D, 0x13, 0x94, 0x1F, 0x1E, 0x0F, 0x1E, 0x27, 0x1E, 0x02, 0x4F,
+0x5E, 0x4F, 0x5E, 0x4F, 0xC1, 0x40, 0x1E, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x57,
+0x00, 0x68, 0x57, 0x00, 0xC1, 0x90, 0x17, 0x00, 0x7F, 0x62, 0x57, 0x77, 0x57, 0x02, 0x62, 0x40,
+0x07, 0xC1, 0xB2, 0x07, 0x05, 0x6E, 0x4D, 0x02, 0xC2, 0x4B, 0xCB, 0x07, 0x00, 0x4D, 0xC6, 0xCB,
+0x0D, 0x07, 0x4B, 0x0D, 0x2E, 0x07, 0x00, 0x4D, 0x00, 0xC4, 0xBA, 0x07, 0x81, 0x0B, 0x00, 0x15,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x48, 0x00, 0x44, 0x40, 0x44,
+0x42, 0x40, 0x01, 0x45, 0x48, 0x44, 0x41, 0x48, 0x44, 0x40, 0x03, 0x71, 0x4B, 0xC3, 0xE7, 0x2D,
+0x01, 0x08, 0x00, 0x45, 0x40, 0x41, 0x44, 0x45, 0x5F, 0x66, 0x43, 0x4B, 0x52, 0xC2, 0xB3, 0x57,
+0x1D, 0x00, 0xC8, 0x69, 0xBF, 0x7E, 0x3C, 0xBF, 0x3C, 0x7E, 0x69, 0x1D, 0x00, 0xC0, 0x57, 0x00,
+0xC5, 0xA1, 0x07, 0xC3, 0xBB, 0x39, 0x38, 0x00, 0x4D, 0x79, 0xC0, 0xC3, 0x00, 0xD4, 0xB9, 0x4D,
+0x0D, 0x79, 0x0D, 0x45, 0xB9, 0x4D, 0x79, 0x0D, 0xC3, 0x39, 0x38, 0x46, 0xB9, 0x46, 0x79, 0x43,
+0x19, 0x43, 0x5F, 0x00, 0x59, 0xC9, 0x43, 0x75, 0x43, 0x19, 0xA4, 0x17, 0x37, 0x17, 0x37, 0x17,
+0x00, 0x77, 0xC7, 0x85, 0x17, 0x37, 0x17, 0x60, 0x54, 0x85, 0x17, 0x00, 0x7F, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0D, 0x4B, 0x40, 0x52, 0x62, 0x00, 0x5E, 0x57, 0xCA, 0x58, 0x54, 0x30, 0x26, 0x90,
+0x36, 0x37, 0x5A, 0x30, 0x40, 0x93, 0x00, 0x4F, 0x40, 0x0F, 0xC1, 0x4F, 0x09, 0x06, 0xC1, 0x41,
+0x33, 0x00, 0x5B, 0x73, 0xC6, 0xAB, 0x1B, 0x33, 0x78, 0x99, 0x41, 0x10, 0x00, 0x49, 0x02, 0x5B,
+0xC1, 0x8A, 0x02, 0x05, 0x43, 0x4E, 0x43, 0x45, 0x41, 0x40, 0x00, 0x7F, 0xC5, 0xBC, 0x75, 0x2A,
+0x2B, 0x11, 0x42, 0x00, 0xC4, 0x9A, 0x90, 0x89, 0xB0, 0x59, 0x00, 0xC2, 0x4A, 0x0E, 0x5A, 0x00,
+0x4E, 0xC4, 0x54, 0x5A, 0x0E, 0x54, 0x5A, 0x00, 0xC2, 0x54, 0x5A, 0x58, 0x00, 0x66, 0x00, 0xC6,
+0x63, 0x60, 0x26, 0x63, 0x26, 0x63, 0x26, 0x00, 0xC6, 0x59, 0x26, 0x59, 0x26, 0x59, 0x26, 0x59,
+0x00, 0x48, 0xC2, 0x59, 0x58, 0x59, 0x00, 0x48, 0xCB, 0x59, 0x03, 0x63, 0x59, 0x26, 0xC5, 0x26,
+0x5A, 0x36, 0x95, 0x32, 0x11, 0x00, 0x72, 0xC2, 0x75, 0x95, 0x00, 0x02, 0x45, 0x42, 0x44, 0x4A,
+0x42, 0x4A, 0x4E, 0x48, 0x42, 0x02, 0x45, 0x40, 0x15, 0xC3, 0x6B, 0x94, 0x80, 0x13, 0x00, 0x7D,
+0x00, 0x53, 0xC1, 0x88, 0x13, 0x00, 0xC3, 0x88, 0x6A, 0x3D, 0x13, 0x00, 0xD4, 0x7D, 0x13, 0x94,
+0x1F, 0x40, 0x1E, 0x0F, 0x08, 0x5A, 0x30, 0x36, 0x28, 0x36, 0x90, 0x22, 0x26, 0x0F, 0x1E, 0x0F,
+0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x57, 0xC4, 0x85, 0x49, 0x58, 0x60, 0x54, 0x00,
+0x77, 0x57, 0xCA, 0x54, 0x60, 0x17, 0x26, 0x30, 0x17, 0x3F, 0x1F, 0x12, 0x0B, 0x00, 0x04, 0x71,
+0xC1, 0xB2, 0x07, 0x00, 0x6E, 0x47, 0x00, 0x6E, 0x47, 0x4D, 0x00, 0xCF, 0x45, 0xB9, 0x4D, 0x38,
+0x79, 0x7F, 0xBB, 0xC3, 0x46, 0xB9, 0x46, 0x0D, 0x4B, 0x0D, 0x2E, 0x07, 0x01, 0x4D, 0x6E, 0xC2,
+0x81, 0x31, 0x00, 0x12, 0x42, 0x44, 0x40, 0x00, 0x42, 0x4A, 0x42, 0x00, 0x4A, 0x44, 0x40, 0x03,
+0x41, 0x48, 0x40, 0x42, 0x48, 0x00, 0x45, 0x40, 0x41, 0x40, 0x43, 0x48, 0x43, 0x41, 0x42, 0x44,
+0x40, 0x01, 0x41, 0x43, 0x00, 0x41, 0x42, 0x48, 0x45, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x42, 0x4A, 0x45,
+0x4E, 0x42, 0x40, 0x01, 0x43, 0x42, 0x48, 0x00, 0x42, 0x48, 0x61, 0x40, 0x06, 0x69, 0x42, 0x44,
+0x00, 0x40, 0x45, 0x4E, 0x42, 0x43, 0x00, 0x42, 0x40, 0x52, 0xC1, 0xB3, 0x2C, 0x00, 0x5D, 0xC8,
+0x69, 0x7E, 0xC9, 0xBF, 0x7E, 0x69, 0x2F, 0x7E, 0x1D, 0x00, 0xCC, 0x57, 0x2C, 0xA1, 0x07, 0x45,
+0x55, 0x61, 0x4D, 0xC3, 0x55, 0xC2, 0x55, 0x39, 0x00, 0xD8, 0x55, 0x0D, 0x07, 0x0D, 0x55, 0x4E,
+0x87, 0x45, 0x4B, 0x4D, 0xD5, 0xB1, 0xBB, 0x7F, 0xB1, 0x38, 0x19, 0x43, 0x5F, 0x2A, 0x75, 0x9F,
+0x2A, 0x2B, 0x43, 0x00, 0xCA, 0x9A, 0x17, 0x28, 0x30, 0x4A, 0x30, 0x58, 0x4A, 0x8D, 0x26, 0x54,
+0x00, 0xC3, 0x49, 0x60, 0x54, 0x17, 0x00, 0x77, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x62,
+0xD0, 0x93, 0x22, 0x0F, 0x90, 0x54, 0x22, 0x3F, 0x54, 0x60, 0x36, 0x3F, 0x54, 0x3F, 0x40, 0x22,
+0x0F, 0x00, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0xC8, 0x7B, 0x66, 0x78, 0x1B, 0x72, 0xDE, 0xA5,
+0x20, 0x72, 0x00, 0x5B, 0x50, 0xC2, 0x41, 0x62, 0x09, 0x01, 0x50, 0x42, 0x06, 0x4E, 0x4A, 0x00,
+0x42, 0x71, 0x40, 0x00, 0xCC, 0xC5, 0x8F, 0x75, 0x6C, 0xA9, 0x50, 0x53, 0x4A, 0x32, 0x85, 0x3F,
+0x36, 0x23, 0x00, 0x4C, 0x01, 0x63, 0x4C, 0x63, 0x4C, 0x63, 0x00, 0x4C, 0x63, 0x00, 0x4C, 0x63,
+0x09, 0x4C, 0x63, 0x4C, 0x63, 0x0B, 0x4C, 0x00, 0x63, 0x4C, 0xCD, 0x54, 0x26, 0x9A, 0x8F, 0x32,
+0x71, 0x44, 0x4C, 0x52, 0x6C, 0x59, 0x00, 0x12, 0x00, 0x00, 0x45, 0x42, 0x4E, 0x00, 0x42, 0x00,
+0x4E, 0x44, 0x42, 0x01, 0x5C, 0x61, 0x40, 0x15, 0x65, 0x53, 0x01, 0x7D, 0x00, 0xC3, 0x7A, 0x56,
+0x9E, 0x56, 0x00, 0xC3, 0x6A, 0x88, 0x13, 0x3D, 0x00, 0x53, 0xD0, 0x7D, 0x65, 0x1F, 0x40, 0x1E,
+0x0F, 0x22, 0x0E, 0x22, 0x28, 0x0A, 0x30, 0x0F, 0x03, 0x4A, 0x1F, 0x0F, 0x00, 0x41, 0x40, 0x10,
+0x41, 0x40, 0x0A, 0x62, 0x7F, 0x77, 0xC1, 0x54, 0x30, 0x00, 0xC8, 0x85, 0x30, 0x37, 0x54, 0x36,
+0x23, 0x85, 0x37, 0x54, 0x00, 0x57, 0x00, 0x62, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x6E,
+0x47, 0xC7, 0x46, 0x6E, 0xBB, 0x45, 0x55, 0x87, 0x55, 0x87, 0x00, 0xC3, 0x55, 0x46, 0x2E, 0x07,
+0x06, 0xC1, 0x81, 0x00, 0x12, 0x41, 0x4A, 0x00, 0x40, 0x00, 0x44, 0x45, 0x4A, 0x44, 0x41, 0x4A,
+0x41, 0x40, 0x02, 0x44, 0x4E, 0x42, 0x44, 0x42, 0x45, 0x48, 0x41, 0x40, 0x00, 0x4A, 0x44, 0x4A,
+0x45, 0x4A, 0x00, 0x40, 0x01, 0x42, 0x43, 0x44, 0x48, 0x00, 0x42, 0x41, 0x40, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4E,
+0x44, 0x4A, 0x41, 0x42, 0x00, 0x40, 0x41, 0x40, 0x48, 0x45, 0x44, 0x4E, 0x45, 0x43, 0x42, 0x40,
+0x05, 0x67, 0x40, 0xC3, 0x4F, 0x08, 0x01, 0x00, 0x00, 0x44, 0x42, 0x4A, 0x43, 0x48, 0x65, 0x52,
+0xC5, 0xB3, 0x57, 0x3C, 0x1D, 0x69, 0x7E, 0x00, 0xC3, 0xA8, 0x2F, 0x3C, 0xBF, 0x00, 0x5D, 0xDF,
+0x57, 0x1D, 0x57, 0xA1, 0x07, 0xCB, 0x55, 0x6E, 0x38, 0x0D, 0x07, 0x4D, 0x55, 0xBB, 0x4E, 0x61,
+0x4B, 0x07, 0x4B, 0x0D, 0x55, 0xB9, 0x38, 0x07, 0x79, 0x39, 0x7F, 0x87, 0x4E, 0x39, 0x79, 0x9F,
+0x59, 0x00, 0xC5, 0x5F, 0x75, 0x5F, 0x2A, 0x2B, 0x19, 0x00, 0xC1, 0x95, 0x17, 0x00, 0xD1, 0x74,
+0x54, 0x49, 0x8D, 0x17, 0x54, 0x30, 0x49, 0x8D, 0x54, 0x17, 0x54, 0x37, 0x17, 0x3F, 0x27, 0x2D,
+0x00, 0x09, 0x41, 0x40, 0x0E, 0x71, 0x52, 0xCB, 0x93, 0x22, 0x0F, 0x22, 0x90, 0x5A, 0x22, 0x0F,
+0x4A, 0x36, 0x12, 0x26, 0x00, 0x4F, 0x00, 0x62, 0x4F, 0x52, 0x00, 0x40, 0x0D, 0xC2, 0x4F, 0x62,
+0x09, 0x05, 0xCB, 0x97, 0x20, 0x72, 0x20, 0x66, 0x9E, 0x92, 0x41, 0x70, 0x72, 0x10, 0x09, 0x00,
+0x55, 0x49, 0x01, 0x5B, 0x56, 0x42, 0x05, 0x4E, 0x48, 0x4A, 0x42, 0x41, 0x40, 0x00, 0xCC, 0xC5,
+0x6C, 0x3B, 0x76, 0xB8, 0x6B, 0x4C, 0x50, 0x3B, 0x42, 0x32, 0x54, 0x35, 0x06, 0xC2, 0x77, 0x35,
+0x0C, 0x00, 0xC1, 0x77, 0x0C, 0x01, 0x75, 0x4C, 0x75, 0x01, 0x4C, 0x75, 0x4C, 0x75, 0x00, 0x4C,
+0x75, 0x4C, 0x75, 0x4C, 0x75, 0x4C, 0x75, 0x4C, 0x75, 0x05, 0x4C, 0x75, 0x01, 0xC2, 0x8D, 0xD2,
+0x11, 0x00, 0xC2, 0x71, 0x7A, 0xB7, 0x00, 0xC3, 0x9D, 0x76, 0x63, 0x00, 0x00, 0x4B, 0x40, 0x45,
+0x42, 0x00, 0x4E, 0x42, 0x43, 0x4A, 0x42, 0x03, 0x45, 0x40, 0x15, 0xC4, 0xB7, 0x13, 0x7D, 0x3D,
+0x13, 0x00, 0x7D, 0xC0, 0x88, 0x01, 0x7D, 0xC5, 0x4C, 0x88, 0x4C, 0x7A, 0x3D, 0x13, 0x00, 0xC2,
+0x7A, 0x3A, 0x1E, 0x00, 0x4F, 0x00, 0xC9, 0x49, 0x22, 0x27, 0x0E, 0x26, 0x28, 0x58, 0x0A, 0x22,
+0x1E, 0x01, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x5F, 0x77, 0x57, 0xC6, 0x60, 0x49, 0x54, 0x49, 0x60,
+0x90, 0x54, 0x01, 0x63, 0x77, 0x00, 0xC6, 0x49, 0x17, 0x3F, 0x1F, 0x12, 0x0B, 0x00, 0x04, 0x71,
+0xC1, 0xB2, 0x07, 0x00, 0x6E, 0x47, 0x00, 0x6E, 0x47, 0x00, 0x4D, 0x00, 0xCB, 0xDC, 0x87, 0xC6,
+0xC3, 0xEC, 0x4B, 0x87, 0xBB, 0x4E, 0x39, 0x0D, 0x07, 0x00, 0x6E, 0x47, 0x4D, 0x47, 0x01, 0xC1,
+0x81, 0x00, 0x13, 0x45, 0x43, 0x40, 0x01, 0x43, 0x42, 0x40, 0x44, 0x00, 0x40, 0x03, 0x4E, 0x4A,
+0x00, 0x44, 0x42, 0x40, 0x4A, 0x40, 0x01, 0x4A, 0x43, 0x4A, 0x42, 0x41, 0x43, 0x40, 0x01, 0x44,
+0x00, 0x45, 0x4E, 0x4A, 0x43, 0x44, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x42, 0x4A, 0x40, 0x44, 0x00, 0x40,
+0x01, 0x44, 0x43, 0x48, 0x44, 0x43, 0x48, 0x41, 0x40, 0x03, 0x52, 0x40, 0x00, 0x42, 0x4E, 0x44,
+0x41, 0x00, 0x40, 0x44, 0x42, 0x44, 0x00, 0x48, 0x5F, 0x52, 0xC2, 0xB3, 0x57, 0x1D, 0x00, 0xC1,
+0x69, 0x7E, 0x00, 0x7C, 0xD5, 0xC9, 0x3C, 0x69, 0xBF, 0x3C, 0x1D, 0x3C, 0x57, 0xA1, 0xBA, 0x4D,
+0x87, 0x7F, 0xC3, 0x38, 0x0D, 0x6E, 0x55, 0x39, 0x7F, 0x87, 0x4B, 0x00, 0x4D, 0xCC, 0x4D, 0x6E,
+0xA0, 0x45, 0x4B, 0x81, 0x39, 0xB1, 0xB9, 0x4E, 0x39, 0x38, 0x19, 0x00, 0xC9, 0x43, 0x5F, 0x75,
+0x5F, 0x11, 0x2B, 0x19, 0x43, 0x9A, 0x17, 0x00, 0xC3, 0x60, 0x49, 0x4A, 0x49, 0x00, 0xC7, 0x8D,
+0x54, 0x0E, 0x23, 0x85, 0x49, 0x54, 0x17, 0x00, 0x7F, 0x4F, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52,
+0x62, 0xD1, 0x93, 0x40, 0x93, 0x22, 0x54, 0x93, 0x30, 0x26, 0x58, 0x5A, 0x54, 0x04, 0x93, 0x40,
+0x22, 0x0F, 0x12, 0x00, 0x0E, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x02, 0x55, 0xC3, 0x41, 0x20,
+0x72, 0x1A, 0x00, 0xC6, 0x6D, 0x66, 0x78, 0x33, 0x78, 0x15, 0x09, 0x00, 0x55, 0x49, 0x01, 0x50,
+0x69, 0x42, 0x05, 0x4E, 0x48, 0x4E, 0x42, 0x41, 0x40, 0x00, 0xD0, 0xC5, 0x6C, 0x34, 0xB8, 0xAF,
+0x0B, 0x6B, 0x56, 0x3E, 0x2B, 0xA6, 0xA7, 0x0C, 0x35, 0x77, 0x0C, 0x35, 0x03, 0x72, 0x4C, 0x75,
+0x4C, 0x72, 0x4C, 0x75, 0x4C, 0x00, 0x72, 0x4C, 0x00, 0x75, 0x4C, 0x02, 0x72, 0x4C, 0x00, 0x72,
+0x4C, 0x00, 0x75, 0x4C, 0x72, 0x4C, 0x07, 0x75, 0x00, 0x4E, 0xCA, 0xA7, 0x11, 0x3B, 0x4C, 0x6B,
+0xC0, 0x0B, 0x7C, 0x76, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4E, 0x69, 0x4A, 0x43, 0x42, 0x03,
+0x45, 0x40, 0x15, 0xC2, 0x6B, 0x3D, 0x13, 0x00, 0xC5, 0x7D, 0x7A, 0x4C, 0x88, 0x4C, 0x88, 0x00,
+0xC5, 0x6A, 0x6F, 0x56, 0x94, 0x13, 0x7D, 0x00, 0xC2, 0x7A, 0x3A, 0x1E, 0x00, 0x4F, 0x5E, 0xCC,
+0x49, 0x22, 0x03, 0x36, 0x30, 0x26, 0x30, 0x23, 0x22, 0x1E, 0x0F, 0x27, 0x00, 0x10, 0x41, 0x40,
+0x0A, 0x62, 0x7F, 0x77, 0xC6, 0x54, 0x26, 0x54, 0x5A, 0x54, 0x30, 0x54, 0x00, 0xC9, 0x60, 0x54,
+0x30, 0x37, 0x54, 0x17, 0x37, 0x0F, 0x12, 0x00, 0x03, 0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x00,
+0x4D, 0x47, 0x00, 0x4D, 0x47, 0x78, 0x4D, 0xC3, 0x4D, 0x6E, 0x61, 0x45, 0x00, 0xC8, 0xB9, 0x61,
+0x39, 0xB9, 0x4E, 0xB9, 0x81, 0x2E, 0x07, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0xC2, 0x81, 0x0B,
+0x00, 0x12, 0x41, 0x43, 0x41, 0x00, 0x4A, 0x00, 0x45, 0x48, 0x4A, 0x42, 0x40, 0x02, 0x42, 0x48,
+0x45, 0x4A, 0x00, 0x43, 0x01, 0x40, 0x01, 0x4A, 0x42, 0x48, 0x42, 0x41, 0x43, 0x40, 0x01, 0x45,
+0x48, 0x00, 0x44, 0x43, 0x44, 0xC3, 0x44, 0x00, 0x01, 0x00, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x05, 0x42, 0x44, 0x45, 0x40, 0x41, 0x00, 0x45,
+0x00, 0x42, 0x41, 0x42, 0x45, 0x40, 0x42, 0x45, 0x40, 0x07, 0x5F, 0x5C, 0x42, 0x45, 0x41, 0x40,
+0x45, 0x41, 0x71, 0x44, 0x45, 0x40, 0x6D, 0xC1, 0xB3, 0x2C, 0x01, 0x7C, 0xC5, 0x57, 0x69, 0x1D,
+0x69, 0x3C, 0x57, 0x00, 0x5D, 0x6C, 0x5D, 0xC9, 0x57, 0xA1, 0x07, 0x45, 0x4D, 0x46, 0x45, 0xC6,
+0x0D, 0x4B, 0x00, 0xC3, 0x79, 0x7F, 0x38, 0x45, 0x00, 0x4D, 0x00, 0xC2, 0x4D, 0x45, 0x4B, 0x00,
+0x47, 0xC6, 0x45, 0x0D, 0x4B, 0x4D, 0xBA, 0x2E, 0x19, 0x01, 0xC0, 0x43, 0x01, 0x59, 0xC1, 0x75,
+0x19, 0x00, 0xC1, 0x9A, 0x17, 0x00, 0x77, 0x70, 0x77, 0x57, 0xC1, 0x85, 0x37, 0x00, 0x66, 0xC8,
+0x60, 0x37, 0x30, 0x37, 0x17, 0x37, 0x17, 0x27, 0x00, 0x0A, 0x41, 0x40, 0x0E, 0x71, 0x52, 0x62,
+0xC0, 0x40, 0x01, 0xCD, 0x93, 0x17, 0xE1, 0x3F, 0x40, 0x90, 0x37, 0x36, 0x37, 0x22, 0x0F, 0x22,
+0x0F, 0x00, 0x0F, 0xC4, 0x4F, 0x10, 0x09, 0x10, 0x09, 0x01, 0x50, 0x49, 0x00, 0xC0, 0x97, 0x00,
+0xC7, 0x82, 0x10, 0x15, 0x10, 0x20, 0x33, 0x10, 0x09, 0x05, 0x50, 0x42, 0x07, 0x48, 0x42, 0x00,
+0x41, 0x40, 0x00, 0xD6, 0xEF, 0x3B, 0x71, 0x7A, 0x0B, 0x31, 0xC0, 0x65, 0xA9, 0x2B, 0x42, 0x54,
+0x0C, 0x35, 0x77, 0x35, 0x0C, 0x35, 0x0C, 0x35, 0x0C, 0x35, 0x0C, 0x03, 0x72, 0x4C, 0x02, 0x75,
+0x4C, 0x01, 0x72, 0x4C, 0x03, 0x72, 0x4C, 0x03, 0x72, 0x4C, 0x00, 0x72, 0x4C, 0x00, 0x75, 0x4C,
+0x00, 0x75, 0x4E, 0xCA, 0xD2, 0x11, 0x64, 0x65, 0x6B, 0x47, 0x0B, 0x7C, 0x56, 0xB8, 0x12, 0x00,
+0x40, 0x00, 0x45, 0x42, 0x00, 0x44, 0x42, 0x44, 0x42, 0x04, 0x45, 0x40, 0x15, 0x65, 0x7D, 0x00,
+0x53, 0x7D, 0xC9, 0x7D, 0x4C, 0xCC, 0x8B, 0x13, 0xCC, 0x56, 0x4C, 0x3D, 0x13, 0x00, 0xC1, 0x7D,
+0x13, 0x00, 0x4F, 0xC2, 0x40, 0xA2, 0x0F, 0x00, 0x68, 0x4F, 0x68, 0x4F, 0x62, 0x00, 0x5E, 0x62,
+0x4F, 0x5E, 0x4F, 0x5E, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x57, 0x00, 0x77, 0x70, 0x77, 0x00,
+0x70, 0xC1, 0x60, 0x37, 0x00, 0x57, 0x00, 0xC3, 0x60, 0x3F, 0x37, 0x3F, 0x00, 0xC3, 0xA2, 0x12,
+0x0B, 0x00, 0x05, 0xC4, 0xD6, 0x2E, 0x07, 0x2E, 0x07, 0x00, 0x6E, 0x47, 0x4D, 0x47, 0xCB, 0x79,
+0x46, 0x45, 0x79, 0xC6, 0x38, 0x7F, 0x0D, 0x4B, 0x46, 0x45, 0x0D, 0x00, 0x47, 0x6E, 0x47, 0x4D,
+0x47, 0x4D, 0x6E, 0xC1, 0x81, 0x00, 0x13, 0x41, 0x45, 0x40, 0x41, 0x42, 0x02, 0x44, 0x42, 0x40,
+0x02, 0x45, 0x41, 0x40, 0x41, 0x42, 0x01, 0x41, 0x45, 0x42, 0x45, 0x42, 0x44, 0x42, 0x40, 0x41,
+0x00, 0x45, 0x00, 0x42, 0x41, 0x42, 0x00, 0x40, 0x42, 0x00, 0x67, 0x40, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0B, 0x42, 0x44, 0x00,
+0x41, 0x40, 0x18, 0x52, 0xC4, 0xB3, 0x2C, 0x1D, 0x2C, 0x1D, 0x06, 0x6C, 0x5D, 0x7C, 0x5D, 0xC2,
+0xA1, 0x07, 0x0D, 0x00, 0x47, 0x06, 0x4D, 0x47, 0x02, 0x4D, 0x00, 0x47, 0x06, 0xC2, 0x79, 0xFC,
+0x19, 0x03, 0xC5, 0x9F, 0x19, 0x9F, 0x19, 0x95, 0x17, 0x0E, 0x68, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x10, 0x4F, 0xC0, 0x40, 0x02, 0x5E, 0xC2, 0x40, 0x1E, 0x40, 0x01, 0xC1, 0xD9, 0x40, 0x00, 0x4F,
+0x62, 0x67, 0x40, 0x0F, 0xC1, 0x4F, 0x15, 0x00, 0xCA, 0x41, 0x15, 0x41, 0x15, 0x41, 0x15, 0x41,
+0x09, 0x15, 0x41, 0x15, 0x00, 0x5B, 0x01, 0x49, 0x55, 0x49, 0x55, 0x00, 0xC5, 0x41, 0x09, 0x41,
+0x1B, 0x29, 0x02, 0x06, 0x45, 0x42, 0x00, 0x40, 0x01, 0xCF, 0xEF, 0x6C, 0x64, 0x7A, 0x47, 0x12,
+0xB7, 0x4C, 0x3E, 0x2B, 0x42, 0x54, 0x32, 0x0C, 0x77, 0x35, 0x02, 0x72, 0x4C, 0x75, 0x4C, 0x08,
+0x72, 0xC2, 0x77, 0x32, 0x0C, 0x01, 0x72, 0xC2, 0x77, 0x32, 0x0C, 0x0D, 0x72, 0x75, 0x4E, 0xC5,
+0xA7, 0x11, 0x3B, 0x76, 0x6B, 0x0B, 0x00, 0xC3, 0xB8, 0x56, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x09,
+0x45, 0x40, 0x15, 0xC4, 0xB7, 0x3D, 0x80, 0x94, 0x3D, 0x00, 0xD1, 0x80, 0x8B, 0x7D, 0x13, 0x3D,
+0x8B, 0x3D, 0x8B, 0x13, 0x3D, 0x13, 0x7D, 0xDF, 0x0F, 0x1E, 0x27, 0x0F, 0x27, 0x00, 0x5E, 0x67,
+0x01, 0x4F, 0x5E, 0x52, 0x5E, 0x01, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0xC2, 0xA2, 0x3F, 0x17,
+0x01, 0xC1, 0x90, 0x17, 0x01, 0xC3, 0x90, 0x17, 0x28, 0x17, 0x04, 0x4F, 0x40, 0x07, 0xC1, 0xD6,
+0x07, 0x09, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x47, 0x06, 0xC2, 0x81,
+0xC0, 0x00, 0x27, 0x41, 0x44, 0x01, 0x41, 0x40, 0x03, 0x45, 0x44, 0x00, 0x42, 0x40, 0x05, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x44, 0x42, 0x36, 0xC4, 0xC5, 0xBD, 0xC5, 0x1C,
+0x02, 0x09, 0xC2, 0x69, 0xA8, 0x69, 0x05, 0xC1, 0xA8, 0x69, 0x00, 0xC5, 0x9A, 0x69, 0xA8, 0x69,
+0x52, 0x55, 0x00, 0xC6, 0xED, 0x7F, 0x55, 0x7F, 0x55, 0x7F, 0x55, 0x05, 0xC1, 0x7F, 0x55, 0x00,
+0xC9, 0x7F, 0x55, 0x7F, 0x55, 0x7F, 0x55, 0x7F, 0x55, 0x7F, 0x75, 0x01, 0xC9, 0x5C, 0x75, 0x5C,
+0xBC, 0x5F, 0x75, 0x5C, 0x5A, 0x26, 0x30, 0x0E, 0x44, 0x42, 0x1C, 0x7F, 0x76, 0x44, 0x76, 0x44,
+0x76, 0x44, 0x76, 0x00, 0x44, 0x77, 0x44, 0x76, 0x77, 0x44, 0x77, 0x44, 0x00, 0x42, 0x0F, 0xC2,
+0x44, 0x99, 0x33, 0x00, 0x60, 0x73, 0x60, 0x73, 0x60, 0xC4, 0x99, 0x6A, 0x20, 0x33, 0x20, 0x01,
+0x73, 0x00, 0x60, 0x73, 0x60, 0x00, 0xC5, 0x99, 0x33, 0x20, 0x99, 0x70, 0x03, 0x0A, 0x42, 0x01,
+0xD2, 0xC5, 0x6C, 0x3B, 0x71, 0x7C, 0x21, 0x9D, 0x52, 0xC2, 0xA6, 0x42, 0x5A, 0x0C, 0x35, 0x77,
+0x35, 0x0C, 0x32, 0x35, 0x01, 0x4C, 0x02, 0x72, 0x4C, 0x00, 0xC2, 0x77, 0x32, 0x0C, 0x01, 0x75,
+0x4C, 0x02, 0xC1, 0x77, 0x0C, 0x03, 0x72, 0x4C, 0xC2, 0x77, 0x32, 0x0C, 0x02, 0xC3, 0xC9, 0x77,
+0x32, 0x0C, 0x00, 0x75, 0xC6, 0x4A, 0x5A, 0x2A, 0x11, 0x64, 0x9D, 0xB7, 0x00, 0xC3, 0x9D, 0x83,
+0x86, 0x02, 0x02, 0x44, 0x43, 0x09, 0x44, 0x6D, 0x71, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x71, 0x6D,
+0x41, 0x71, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x71, 0x61, 0xC1,
+0x6A, 0x56, 0x00, 0xC5, 0x6A, 0x56, 0x6D, 0x56, 0x6D, 0x56, 0x00, 0xC3, 0x6A, 0x56, 0x6A, 0x56,
+0x03, 0x76, 0x7F, 0x44, 0x7F, 0x44, 0x77, 0x44, 0x02, 0x7F, 0x44, 0x77, 0x44, 0x00, 0x7F, 0x44,
+0x42, 0x1D, 0x76, 0x70, 0xCA, 0x60, 0x26, 0x30, 0x26, 0x30, 0x26, 0x60, 0x30, 0x60, 0x30, 0x26,
+0x00, 0x70, 0x66, 0xC4, 0x60, 0x30, 0x37, 0xBD, 0x02, 0x06, 0xC4, 0xCC, 0x46, 0x55, 0x7F, 0x55,
+0x00, 0xC1, 0x7F, 0x55, 0x00, 0xC3, 0x7F, 0x55, 0x7F, 0x55, 0x00, 0xC1, 0x7F, 0x55, 0x00, 0xC3,
+0x7F, 0x55, 0x7F, 0x55, 0x03, 0xC1, 0x7F, 0x55, 0x00, 0xC3, 0x7F, 0x46, 0xED, 0x02, 0x2A, 0x61,
+0x68, 0x42, 0x27, 0x40, 0x44, 0x09, 0x43, 0x44, 0x17, 0x5C, 0x44, 0x01, 0x42, 0x44, 0x42, 0x44,
+0x0A, 0xC2, 0x63, 0x2F, 0x2B, 0x00, 0xC1, 0x50, 0x04, 0x09, 0xC1, 0x69, 0xA8, 0x00, 0xC5, 0x85,
+0xBF, 0xA8, 0xBF, 0x85, 0xA8, 0x01, 0xC2, 0x85, 0xBF, 0xA8, 0x00, 0xC2, 0xBF, 0x52, 0x4D, 0x03,
+0xC1, 0x7F, 0x4D, 0x0F, 0xC1, 0x7F, 0x4D, 0x00, 0xC1, 0x7F, 0x44, 0x00, 0x5C, 0xC0, 0x89, 0x01,
+0x44, 0xC4, 0x44, 0x04, 0x89, 0x50, 0x04, 0x07, 0x7F, 0x44, 0x01, 0x7F, 0x44, 0x0E, 0x43, 0x44,
+0x0B, 0xC1, 0x89, 0x04, 0x22, 0xC3, 0x89, 0x36, 0x51, 0x33, 0x06, 0x5A, 0x73, 0x00, 0x5A, 0x73,
+0x5A, 0x73, 0x5A, 0x73, 0x01, 0x5A, 0x73, 0x04, 0xC1, 0x53, 0x08, 0x09, 0x44, 0x00, 0x56, 0xC8,
+0x89, 0x6C, 0x75, 0xC2, 0x71, 0x6A, 0x71, 0x3B, 0x42, 0x01, 0xC4, 0x54, 0x32, 0x35, 0x0C, 0x35,
+0x02, 0x4C, 0x00, 0x72, 0x4C, 0x72, 0xC1, 0x77, 0x0C, 0x00, 0x72, 0x4C, 0x03, 0x75, 0x4C, 0x72,
+0xC3, 0x77, 0x0C, 0x32, 0x0C, 0x05, 0x72, 0x4C, 0xC3, 0x77, 0x32, 0x77, 0x0C, 0x02, 0xCE, 0x77,
+0x0C, 0x35, 0x0E, 0x84, 0x6C, 0x2F, 0x2B, 0x64, 0x71, 0x6A, 0x34, 0x75, 0xC7, 0x04, 0x02, 0x43,
+0x48, 0x08, 0x4A, 0x44, 0x41, 0x01, 0x71, 0x6D, 0x41, 0x02, 0x71, 0x6D, 0x41, 0x02, 0x71, 0x6D,
+0x41, 0x02, 0x71, 0x52, 0xC1, 0x8A, 0x6A, 0x05, 0xC1, 0x56, 0x6A, 0x08, 0x76, 0xC0, 0x60, 0x02,
+0x76, 0xC2, 0x60, 0x36, 0x60, 0x02, 0x76, 0xC4, 0x60, 0x36, 0x60, 0x36, 0x04, 0x10, 0x43, 0x44,
+0x09, 0x42, 0xCD, 0x60, 0x30, 0x85, 0x30, 0x85, 0x30, 0x85, 0x30, 0x85, 0x30, 0x85, 0x30, 0x85,
+0x30, 0x00, 0xC4, 0x85, 0x30, 0x49, 0x36, 0x04, 0x07, 0xC2, 0x4E, 0x7F, 0x4D, 0x05, 0xC1, 0x7F,
+0x4D, 0x03, 0xC1, 0x7F, 0x4D, 0x00, 0xC1, 0x7F, 0x4D, 0x06, 0xC1, 0x7F, 0x4D, 0x00, 0xC1, 0x6E,
+0x04, 0x26, 0x42, 0x44, 0x02, 0x5C, 0x44, 0x05, 0x5C, 0x44, 0x1E, 0x42, 0x41, 0x42, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x08, 0x4B, 0x40, 0x4B, 0x40, 0x0D, 0xC4, 0xD3, 0x9C, 0x2B, 0xC5,
+0x00, 0x0A, 0xC2, 0xB3, 0x2C, 0x1D, 0x01, 0x6C, 0x00, 0x5D, 0x02, 0x6C, 0x00, 0x5D, 0x00, 0x6C,
+0xC1, 0xA1, 0x07, 0x06, 0x4D, 0x00, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x47, 0x02, 0x4D, 0x00, 0x47,
+0x03, 0x6E, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x6D, 0x71, 0x40, 0x0A, 0x41, 0x40, 0x32,
+0xCB, 0x4F, 0x15, 0x10, 0x41, 0x15, 0x41, 0x10, 0x1B, 0x41, 0x15, 0x09, 0x1B, 0x00, 0x49, 0x55,
+0xC2, 0x41, 0x15, 0x41, 0x00, 0x5B, 0x00, 0x50, 0x5B, 0x50, 0xC4, 0x41, 0x15, 0x1B, 0x29, 0x02,
+0x09, 0x40, 0x01, 0xC6, 0xBD, 0x8F, 0xBC, 0x2A, 0x42, 0x11, 0x42, 0x02, 0x72, 0x00, 0x75, 0xC1,
+0x77, 0x35, 0x00, 0x72, 0xCA, 0x8D, 0x54, 0x0C, 0x35, 0x77, 0x0C, 0x77, 0x32, 0x0C, 0x35, 0x0C,
+0x01, 0xC1, 0x77, 0x0C, 0x00, 0xC0, 0x49, 0x00, 0xC5, 0x8D, 0x0C, 0x35, 0x0C, 0x77, 0x0C, 0x0E,
+0x75, 0x00, 0x4E, 0xCA, 0x5A, 0x9A, 0x58, 0x2B, 0x11, 0x2A, 0x11, 0x2A, 0x75, 0x95, 0x00, 0x02,
+0x41, 0x42, 0x01, 0x61, 0x42, 0x68, 0x61, 0x42, 0x00, 0xC3, 0xAA, 0x02, 0x05, 0x00, 0x15, 0xCE,
+0x6B, 0xDF, 0x8B, 0xDF, 0x8B, 0xDF, 0x8B, 0xBE, 0x3D, 0xBE, 0x8B, 0xDF, 0x8B, 0x3D, 0x8B, 0x00,
+0xCF, 0xBE, 0x8B, 0x94, 0x01, 0xD9, 0x1E, 0x2D, 0x27, 0x1E, 0x27, 0x12, 0x1E, 0x27, 0xD9, 0x01,
+0x1E, 0x00, 0x67, 0x5E, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x57, 0x01, 0x68, 0x57, 0x68,
+0x57, 0x01, 0x68, 0x57, 0x05, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07, 0x02, 0x4D, 0x47, 0x03, 0x4D,
+0x01, 0x47, 0x00, 0x4D, 0x00, 0x47, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x4D,
+0x47, 0xC1, 0x81, 0x00, 0x2C, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x08, 0x4B, 0x00, 0x41, 0x40, 0x4B, 0x40, 0x4B,
+0x40, 0x00, 0x4B, 0x40, 0x00, 0x41, 0x40, 0x03, 0x6D, 0xC3, 0x9B, 0xCE, 0x0B, 0x00, 0x08, 0x4B,
+0x52, 0xC4, 0xB3, 0x57, 0x2C, 0x1D, 0x3C, 0x00, 0x6C, 0x00, 0x5D, 0x02, 0x7C, 0x5D, 0x00, 0x6C,
+0xC1, 0xA1, 0x07, 0x03, 0x4D, 0x47, 0x01, 0x4D, 0x00, 0xC1, 0x79, 0x07, 0x00, 0x4D, 0x6E, 0x4D,
+0x01, 0x47, 0x06, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x71, 0x6D, 0x40, 0x0A, 0x41, 0x40,
+0x31, 0x52, 0xC2, 0x4F, 0x62, 0x09, 0x00, 0x50, 0x00, 0x5B, 0x50, 0x49, 0x01, 0x50, 0x49, 0x00,
+0x55, 0xCC, 0x41, 0x10, 0x1B, 0x10, 0x09, 0x1B, 0x09, 0x15, 0x41, 0x10, 0x09, 0x15, 0x02, 0x06,
+0x45, 0x42, 0x01, 0x41, 0x40, 0x00, 0xC3, 0xBD, 0x8F, 0x75, 0x2A, 0x00, 0x6B, 0x6A, 0x6B, 0xC5,
+0x8F, 0x85, 0x42, 0x4A, 0x23, 0x35, 0x02, 0xC5, 0x54, 0x60, 0x23, 0x35, 0x32, 0x0C, 0x01, 0xC2,
+0x77, 0x32, 0x0C, 0x00, 0xC4, 0x77, 0x0C, 0x35, 0x23, 0x49, 0x00, 0xC3, 0x60, 0x0A, 0x8D, 0x0C,
+0x00, 0xC2, 0x77, 0xC9, 0x0C, 0x08, 0x72, 0x4C, 0x72, 0x4C, 0x72, 0x75, 0xC6, 0x4A, 0x04, 0x37,
+0x17, 0xB0, 0x5C, 0x11, 0x00, 0x6A, 0xC2, 0x5F, 0x26, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42, 0x09,
+0x45, 0x40, 0x15, 0xCE, 0x6B, 0x3D, 0x13, 0x80, 0x3D, 0x13, 0x80, 0x7A, 0xBE, 0x3D, 0x13, 0x3D,
+0x94, 0x7D, 0x13, 0x00, 0xC4, 0x8B, 0x13, 0x94, 0x1F, 0x0F, 0x00, 0x5E, 0x4F, 0x00, 0x5E, 0x4F,
+0x00, 0x5E, 0x4F, 0x00, 0x52, 0x5E, 0x00, 0x4F, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x57,
+0x05, 0x68, 0x57, 0x05, 0x7F, 0x77, 0xC2, 0xA2, 0x12, 0x00, 0x06, 0xC1, 0xB2, 0x07, 0x06, 0x4D,
+0x01, 0x47, 0xC2, 0x79, 0x07, 0x0D, 0x00, 0x47, 0x00, 0xC2, 0xBA, 0x0D, 0x07, 0x07, 0xC2, 0x81,
+0x0B, 0x00, 0x11, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x01, 0x41,
+0x4B, 0x00, 0x71, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x03, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x48, 0x44, 0x61, 0x4A,
+0x44, 0x40, 0x00, 0x4B, 0x40, 0xC5, 0x44, 0x02, 0x00, 0x44, 0x02, 0x00, 0x03, 0x71, 0x6D, 0x45,
+0x40, 0x45, 0x48, 0x00, 0x45, 0x40, 0x41, 0x43, 0x45, 0x40, 0xCC, 0x60, 0x02, 0x00, 0x12, 0xB3,
+0x3C, 0x2C, 0x57, 0x7E, 0x91, 0xBF, 0x1D, 0xBF, 0x00, 0x7C, 0xC3, 0x7E, 0x91, 0x7E, 0x2C, 0x00,
+0xC1, 0xA1, 0x07, 0x00, 0x4D, 0x47, 0x03, 0xCB, 0x45, 0x87, 0x61, 0x38, 0x07, 0x38, 0x39, 0x4B,
+0x38, 0x39, 0x45, 0x07, 0x05, 0x6E, 0xC5, 0xB4, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x32, 0xDC, 0x4F, 0x62, 0x09, 0x20, 0x78, 0x72, 0x33, 0x66,
+0x72, 0x33, 0x1A, 0x78, 0x33, 0x15, 0x09, 0x1A, 0x78, 0x1A, 0x09, 0x15, 0x78, 0x7B, 0x78, 0x66,
+0x82, 0x10, 0x15, 0x1C, 0x02, 0x05, 0x48, 0x4E, 0x43, 0x42, 0x41, 0x40, 0x00, 0xD8, 0xBD, 0x8F,
+0x75, 0x2A, 0x2B, 0x11, 0x2B, 0x42, 0xA7, 0xE1, 0x85, 0x26, 0x0C, 0x77, 0x35, 0x0C, 0x35, 0x0C,
+0x23, 0x35, 0x0C, 0x77, 0x0C, 0x32, 0x0C, 0x00, 0xC2, 0x77, 0x32, 0x0C, 0x02, 0x75, 0xC5, 0x77,
+0x0E, 0x0A, 0x30, 0x54, 0x0C, 0x00, 0xC1, 0x77, 0x0C, 0x02, 0xC1, 0xC9, 0x0C, 0x00, 0x72, 0x4C,
+0x02, 0x75, 0x4C, 0x75, 0x4C, 0x75, 0xCB, 0x8D, 0x28, 0x22, 0x90, 0xA7, 0x3B, 0x4A, 0x3B, 0x11,
+0x2A, 0x95, 0x00, 0x02, 0x45, 0x42, 0x43, 0x4A, 0x42, 0x48, 0x4E, 0x44, 0x42, 0x02, 0x45, 0x40,
+0x15, 0x65, 0x53, 0xC1, 0x8B, 0x13, 0x00, 0xC1, 0x80, 0x13, 0x00, 0xD8, 0x88, 0x13, 0x4C, 0x88,
+0xA9, 0x13, 0x7D, 0x13, 0x80, 0x13, 0x3D, 0x1F, 0x40, 0x1E, 0x90, 0x49, 0x58, 0x60, 0x36, 0x02,
+0x36, 0x28, 0x90, 0x30, 0x1E, 0x00, 0x4F, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x77, 0x57,
+0x70, 0xCC, 0x54, 0x49, 0x37, 0x85, 0x54, 0x30, 0x49, 0x37, 0x17, 0x37, 0x54, 0x60, 0x17, 0x00,
+0x4F, 0x40, 0x4B, 0x40, 0x05, 0xC1, 0xB2, 0x07, 0x04, 0x4D, 0xCF, 0xBA, 0x0D, 0x45, 0xB9, 0x39,
+0x38, 0x81, 0x4D, 0xBB, 0x55, 0x4D, 0x87, 0xB9, 0x0D, 0x38, 0x07, 0x03, 0x4D, 0x6E, 0xC1, 0x81,
+0x00, 0x13, 0x5C, 0x44, 0x40, 0x4B, 0x44, 0x4A, 0x44, 0x42, 0x48, 0x44, 0x40, 0x03, 0x45, 0x4A,
+0x41, 0x42, 0x4A, 0x48, 0x42, 0x40, 0x4B, 0x00, 0x43, 0x48, 0x00, 0x5F, 0x5C, 0x44, 0x40, 0x01,
+0x41, 0x48, 0x00, 0x45, 0x43, 0x4E, 0x44, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x44, 0x4A, 0x48, 0x61, 0x48,
+0x65, 0x40, 0x00, 0x45, 0x4E, 0x44, 0x41, 0x4A, 0x43, 0x40, 0x06, 0x71, 0x45, 0x61, 0x44, 0x43,
+0x40, 0x45, 0x4E, 0x42, 0x5F, 0x4E, 0x44, 0x40, 0x52, 0xD1, 0xB3, 0x2C, 0x1D, 0x7E, 0xA8, 0x1D,
+0x91, 0x69, 0x91, 0x7E, 0xA8, 0x7E, 0x1D, 0xBF, 0x57, 0x2C, 0xA1, 0x07, 0x06, 0xCC, 0x46, 0xB1,
+0x87, 0x46, 0x4B, 0x7F, 0xD5, 0xC6, 0x46, 0xC2, 0xC3, 0x0D, 0x07, 0x05, 0xC1, 0xB4, 0x00, 0x02,
+0x52, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x31, 0x52, 0xDB, 0x4F, 0x7B,
+0x09, 0x33, 0xA5, 0x92, 0x66, 0x78, 0x92, 0x72, 0x82, 0x20, 0x78, 0x1B, 0x33, 0x1A, 0x1B, 0x72,
+0x99, 0x20, 0x9E, 0x33, 0x20, 0x6A, 0xAB, 0x09, 0x1B, 0x02, 0x06, 0x4E, 0x44, 0x4E, 0x42, 0x41,
+0x40, 0x00, 0xCD, 0xBD, 0x8F, 0x75, 0x3B, 0x71, 0x76, 0x53, 0x64, 0x42, 0xA7, 0x26, 0x36, 0x32,
+0x35, 0x00, 0x4C, 0x72, 0x4C, 0x75, 0x4C, 0x75, 0x72, 0x4C, 0x02, 0x72, 0x4C, 0xC3, 0x77, 0x0C,
+0x77, 0x0C, 0x00, 0xC6, 0x54, 0x30, 0x08, 0x0A, 0x0C, 0x77, 0x0C, 0x03, 0x72, 0x4C, 0x06, 0x72,
+0x4C, 0x00, 0x72, 0x75, 0xCB, 0x8D, 0x26, 0xA4, 0x84, 0xC2, 0x52, 0x44, 0xB8, 0x52, 0x3B, 0x50,
+0x00, 0x02, 0x45, 0x42, 0x4A, 0x4E, 0x44, 0x4E, 0x43, 0x44, 0x42, 0x02, 0x45, 0x40, 0x15, 0xCA,
+0x6B, 0x3D, 0x13, 0xBE, 0x13, 0x7D, 0x8B, 0x6A, 0x9E, 0x6A, 0x4C, 0x00, 0xD8, 0x88, 0x4C, 0x3D,
+0x13, 0x3D, 0x80, 0x7A, 0x05, 0x1E, 0x0F, 0x3F, 0x30, 0x0F, 0x5A, 0x28, 0x5A, 0x30, 0x0F, 0x26,
+0x4A, 0xA2, 0x1E, 0x0F, 0x27, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x7F, 0x57, 0xD1, 0x54, 0x49,
+0x30, 0x49, 0x30, 0x37, 0x26, 0x54, 0x60, 0x17, 0x60, 0x23, 0x60, 0x17, 0x37, 0x1F, 0x12, 0x00,
+0x06, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x4D, 0x00, 0xCC, 0x55, 0x7F, 0xBB, 0xC6, 0x55, 0xBB, 0x45,
+0xB9, 0x81, 0x4E, 0x4D, 0x0D, 0x07, 0x06, 0xC2, 0x81, 0x0B, 0x00, 0x11, 0x41, 0xC2, 0x86, 0x0A,
+0x00, 0x00, 0x42, 0x65, 0x4A, 0x42, 0x44, 0x48, 0x41, 0x40, 0x02, 0x44, 0x4E, 0x42, 0x44, 0x42,
+0x45, 0x4A, 0x40, 0x4B, 0x40, 0x4A, 0x43, 0x4A, 0x68, 0x48, 0x4A, 0x40, 0x01, 0x42, 0x43, 0x42,
+0x44, 0x40, 0x4A, 0x41, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x42, 0x4A, 0x00, 0x41, 0x48, 0x45, 0x40, 0x4B,
+0x40, 0x42, 0xC4, 0x44, 0x00, 0x02, 0x04, 0x00, 0x03, 0x4B, 0x40, 0x00, 0x4B, 0x71, 0x42, 0x43,
+0x41, 0x40, 0x00, 0x44, 0x42, 0x40, 0x42, 0x44, 0x40, 0x41, 0xCA, 0xB3, 0x2C, 0x3C, 0x91, 0x69,
+0xB3, 0x7E, 0x85, 0x69, 0x7E, 0xA8, 0x00, 0xC5, 0xB3, 0x3C, 0x1D, 0x57, 0xA1, 0x07, 0x03, 0x4D,
+0x47, 0x00, 0x4D, 0xCA, 0x6E, 0x39, 0x79, 0x0D, 0x79, 0x6E, 0x45, 0x0D, 0x6E, 0x55, 0x07, 0x05,
+0x6E, 0xC5, 0xB4, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x30, 0x52, 0x40, 0xDC, 0x4F, 0x62, 0x09, 0x41, 0x70, 0x1A, 0x33, 0x92, 0x1A, 0x78, 0x10,
+0x88, 0xA5, 0x1B, 0x1A, 0x33, 0x1B, 0x33, 0x72, 0xAB, 0x9E, 0xAD, 0x20, 0x72, 0xA5, 0x09, 0x15,
+0x1C, 0x02, 0x05, 0x4A, 0x00, 0x63, 0x42, 0x41, 0x40, 0x00, 0x42, 0xC0, 0x6C, 0x00, 0xCD, 0x50,
+0x7C, 0x4F, 0x7C, 0x76, 0x64, 0xA6, 0x42, 0x54, 0x0C, 0x35, 0x0C, 0x35, 0x0C, 0x00, 0x75, 0x72,
+0x4C, 0xC1, 0x77, 0x0C, 0x06, 0x75, 0xC6, 0x8D, 0x30, 0x98, 0x49, 0x30, 0x49, 0x0C, 0x00, 0xC1,
+0x77, 0x0C, 0x00, 0x72, 0x4C, 0x05, 0x72, 0x4C, 0x01, 0x72, 0x4C, 0x00, 0x75, 0xCB, 0x4A, 0x84,
+0x5C, 0x11, 0x71, 0x7A, 0x6B, 0xAF, 0xB6, 0x76, 0x63, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4A, 0x48,
+0x4E, 0x48, 0x00, 0x42, 0x02, 0x45, 0x40, 0x15, 0xC4, 0x6B, 0x3D, 0x13, 0x8B, 0x13, 0x00, 0x7D,
+0xC0, 0x88, 0x00, 0xC2, 0x9E, 0x94, 0x6A, 0x00, 0xC1, 0x94, 0x13, 0x00, 0xC4, 0x80, 0x13, 0x94,
+0x25, 0x1E, 0x00, 0x7F, 0x4E, 0xCA, 0x4A, 0x30, 0x27, 0x0E, 0x36, 0x04, 0x58, 0x54, 0x22, 0x1E,
+0x0F, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x62, 0x77, 0x7F, 0xC2, 0x60, 0x49, 0x54, 0x00, 0x77,
+0x68, 0x57, 0xC2, 0x54, 0x37, 0x17, 0x00, 0xC2, 0x85, 0x30, 0x17, 0x00, 0x62, 0x52, 0x4B, 0x40,
+0x04, 0x71, 0xC1, 0xB2, 0x07, 0x05, 0xCC, 0x4B, 0x07, 0x38, 0xB1, 0x87, 0x45, 0x38, 0xB9, 0xB1,
+0xBB, 0xC3, 0xBB, 0x0D, 0x00, 0x47, 0x04, 0x4D, 0x47, 0xC1, 0x81, 0x00, 0x13, 0x65, 0x43, 0x40,
+0x4B, 0x67, 0x43, 0x42, 0x41, 0x45, 0x48, 0x41, 0x40, 0x02, 0x4E, 0x4A, 0x00, 0x44, 0x45, 0x40,
+0xCA, 0x53, 0x27, 0x0B, 0x00, 0x53, 0x04, 0x0A, 0x02, 0x01, 0x03, 0x00, 0x01, 0x42, 0x44, 0x42,
+0x44, 0x42, 0x43, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x44, 0x48, 0xC1, 0x44, 0x08, 0x00, 0x40, 0x02,
+0x42, 0x44, 0x40, 0x42, 0x44, 0x40, 0x04, 0x4B, 0x40, 0x4B, 0x42, 0x4E, 0x43, 0x45, 0x00, 0x40,
+0x44, 0x42, 0x40, 0x44, 0x00, 0x40, 0x52, 0xD1, 0xB3, 0x57, 0x1D, 0x69, 0x91, 0x85, 0x91, 0x3C,
+0x69, 0xBF, 0x3C, 0x91, 0x7E, 0x91, 0x57, 0x2C, 0xA1, 0x07, 0x06, 0x79, 0xCC, 0x64, 0x55, 0x45,
+0x4B, 0x0D, 0x39, 0xC6, 0x79, 0x39, 0x45, 0x2E, 0x0D, 0x07, 0x04, 0xC1, 0xB4, 0x00, 0x02, 0x52,
+0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x32, 0xC8, 0x4F, 0x62, 0x09, 0x1A,
+0xDE, 0x20, 0x1A, 0xCF, 0x1A, 0x00, 0xC2, 0x66, 0x92, 0x20, 0x01, 0xCD, 0x72, 0xCF, 0xC4, 0x1A,
+0x33, 0x9E, 0x1A, 0xDE, 0x92, 0xA5, 0x09, 0x15, 0x1C, 0x02, 0x05, 0x48, 0x4E, 0x4A, 0x42, 0x4B,
+0x40, 0x00, 0xCE, 0xBD, 0x3B, 0x34, 0x7A, 0xAF, 0x2D, 0x6B, 0x4C, 0x0A, 0x2B, 0xA6, 0x23, 0x32,
+0x77, 0x35, 0x01, 0x72, 0x4C, 0xC4, 0x77, 0x35, 0x0C, 0x32, 0x0C, 0x00, 0x72, 0x4C, 0x72, 0xC9,
+0x77, 0x0C, 0x35, 0x8D, 0x49, 0x26, 0x49, 0x23, 0x35, 0x0C, 0x01, 0xC2, 0x77, 0xC9, 0x0C, 0x0D,
+0x75, 0x4E, 0xC5, 0x84, 0x5C, 0x2F, 0x67, 0x6B, 0x0B, 0x00, 0xC3, 0x7C, 0x76, 0x1C, 0x00, 0x02,
+0x45, 0x42, 0x00, 0x4E, 0x44, 0x4A, 0x00, 0x48, 0x42, 0x02, 0x45, 0x40, 0x15, 0xDF, 0x6B, 0x7A,
+0x13, 0x80, 0x3D, 0x80, 0x56, 0x88, 0x7A, 0xA9, 0x64, 0x88, 0x6D, 0x13, 0x3D, 0x13, 0x8B, 0x13,
+0x3D, 0x1F, 0x22, 0x40, 0x02, 0x26, 0x22, 0x0E, 0x30, 0x36, 0x30, 0x26, 0x08, 0x4A, 0x62, 0x5E,
+0x4F, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x45, 0x7F, 0x00, 0xC5, 0x54, 0x30, 0x0E, 0x30, 0x54,
+0x5A, 0x00, 0x4E, 0xC8, 0x49, 0x30, 0x17, 0x49, 0x60, 0x17, 0x3F, 0x22, 0x00, 0x07, 0xC1, 0xB2,
+0x07, 0x05, 0x4D, 0x47, 0xCA, 0x4D, 0x6E, 0x39, 0x46, 0x38, 0xEC, 0x61, 0x4D, 0x46, 0x39, 0x07,
+0x08, 0xC2, 0x81, 0x0B, 0x00, 0x11, 0x4B, 0x45, 0x43, 0x6D, 0x5F, 0xC7, 0x53, 0x0A, 0x02, 0x04,
+0x03, 0x08, 0x01, 0x00, 0x01, 0x42, 0x48, 0x41, 0x48, 0x4A, 0x43, 0x48, 0x44, 0x40, 0x4B, 0x40,
+0x4A, 0x43, 0x48, 0x68, 0x41, 0x43, 0x40, 0x01, 0x45, 0x48, 0x00, 0x45, 0x43, 0x42, 0x40, 0x00,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x05, 0x45, 0x42, 0x41, 0x40, 0x42, 0x41, 0x61, 0x42, 0x00, 0x41, 0x6D, 0x41, 0x40, 0x4B, 0x41,
+0x40, 0x05, 0x52, 0x40, 0x41, 0x69, 0x42, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x52, 0x67, 0x4B,
+0x52, 0xC2, 0xB3, 0x2C, 0x1D, 0x00, 0xCD, 0x57, 0xBF, 0x3C, 0x2C, 0x3C, 0x57, 0x1D, 0x57, 0x69,
+0x57, 0x1D, 0x2C, 0xA1, 0x07, 0x06, 0xC1, 0x4B, 0x46, 0x00, 0xC0, 0x4B, 0x00, 0x4D, 0xC5, 0x4B,
+0x2E, 0x0D, 0x4B, 0x2E, 0x07, 0x05, 0x6E, 0xC5, 0xB4, 0x31, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x32, 0xC1, 0x4F, 0x09, 0x00, 0xD9, 0x7B, 0x20, 0x99,
+0x7B, 0x20, 0x99, 0x7B, 0x82, 0x33, 0x7B, 0x33, 0x15, 0xA5, 0x33, 0x99, 0x10, 0x15, 0x09, 0x7B,
+0x20, 0x33, 0x82, 0x09, 0x1B, 0x29, 0x02, 0x05, 0x44, 0x43, 0x42, 0x00, 0x41, 0x71, 0x40, 0xC4,
+0xEF, 0x9B, 0x3E, 0xD4, 0x47, 0x00, 0x4B, 0xC8, 0x4C, 0x6A, 0x2B, 0x42, 0x85, 0x0C, 0x35, 0x77,
+0x0C, 0x01, 0xC5, 0x77, 0x32, 0x77, 0x0C, 0x77, 0x0C, 0x01, 0xC1, 0x77, 0x0C, 0x00, 0x75, 0x63,
+0x70, 0x00, 0xC3, 0x8D, 0x0C, 0x77, 0x0C, 0x03, 0xC1, 0x77, 0x0C, 0x0A, 0xC1, 0x77, 0x0C, 0x00,
+0x75, 0xC6, 0x8D, 0xA7, 0x11, 0x9B, 0x65, 0x6B, 0xD9, 0x00, 0xC5, 0x6B, 0x76, 0xD4, 0x00, 0x12,
+0x00, 0x00, 0x45, 0x42, 0x02, 0x44, 0x43, 0x42, 0x03, 0x45, 0x52, 0x00, 0x40, 0x12, 0x52, 0x65,
+0x53, 0xC1, 0x80, 0x13, 0x00, 0xC2, 0x7D, 0xCC, 0x13, 0x01, 0xC0, 0x56, 0x01, 0x53, 0x03, 0xC2,
+0x7A, 0x3A, 0x1E, 0x00, 0x45, 0x62, 0x5E, 0xC3, 0x90, 0x3F, 0x1E, 0x22, 0x00, 0x67, 0x62, 0x4F,
+0x5E, 0x4F, 0x5E, 0x40, 0x10, 0x41, 0x40, 0x09, 0x52, 0x62, 0x77, 0x57, 0x77, 0xC7, 0x60, 0x37,
+0x17, 0x37, 0x30, 0x17, 0x37, 0x26, 0x00, 0x57, 0x77, 0x57, 0x01, 0x45, 0x40, 0x04, 0x4B, 0x40,
+0x00, 0xC1, 0xB2, 0x07, 0x08, 0xC3, 0x46, 0x4B, 0x79, 0x4B, 0x00, 0xC4, 0x46, 0x07, 0x79, 0x4B,
+0x07, 0x06, 0x4D, 0x6E, 0xC1, 0x81, 0x00, 0x0D, 0x4B, 0x40, 0x04, 0x41, 0x4B, 0x41, 0x45, 0x42,
+0x00, 0x40, 0x42, 0x41, 0x40, 0x02, 0x41, 0x40, 0x00, 0x41, 0x45, 0x42, 0x00, 0x41, 0x42, 0x01,
+0x45, 0x42, 0x45, 0x40, 0x00, 0x41, 0x45, 0x42, 0x00, 0x45, 0x01, 0x40, 0x41, 0x40, 0x01, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x0B, 0x68, 0x5C, 0x44, 0x41, 0x40, 0x18, 0x52, 0xC1, 0xB3, 0x1D, 0x0D, 0xC1, 0xA1, 0x07, 0x02,
+0x4D, 0x47, 0x0C, 0x4D, 0x47, 0x05, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x32, 0xCA, 0x4F, 0x15, 0x09, 0x41, 0x1B, 0x41, 0x1B, 0x41, 0x1B, 0x41, 0x1B, 0x00,
+0xC2, 0x41, 0x09, 0x1B, 0x03, 0x49, 0x5B, 0x49, 0x5B, 0x00, 0xCB, 0x41, 0x09, 0x1B, 0x29, 0x02,
+0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x00, 0x42, 0x45, 0x40, 0x01, 0xD5, 0xBD, 0x9B, 0x6C,
+0x65, 0xAF, 0x0B, 0x25, 0x4C, 0x3E, 0xA6, 0x42, 0x4A, 0x0C, 0x35, 0x0C, 0x35, 0x0C, 0x77, 0x0C,
+0x35, 0x77, 0x0C, 0x01, 0xC1, 0x77, 0x0C, 0x03, 0x63, 0x4E, 0x4C, 0xC1, 0x77, 0x0C, 0x14, 0xCF,
+0x77, 0x32, 0x0E, 0xA7, 0x5C, 0x3B, 0x76, 0x6B, 0x47, 0x0B, 0xB8, 0x76, 0x67, 0x00, 0x12, 0x00,
+0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x45, 0x00, 0x42, 0x45, 0x42, 0x45, 0x42, 0x4F, 0x40, 0x15,
+0xD5, 0xAF, 0x94, 0x8B, 0xBE, 0x94, 0x3D, 0xBE, 0x8B, 0x3D, 0xDF, 0x3D, 0xDF, 0x3D, 0x8B, 0x3D,
+0x8B, 0x94, 0x7D, 0x7A, 0x2D, 0x1E, 0x27, 0x00, 0xCD, 0xD9, 0x27, 0x12, 0x27, 0x1E, 0x12, 0x1E,
+0xD9, 0x27, 0x1E, 0x27, 0x1E, 0x27, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x4F, 0x7F, 0x68, 0x57, 0x0C,
+0x7F, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07, 0x0C, 0x4D, 0x47, 0x05, 0x4D, 0x47, 0x00, 0x6E, 0x4D,
+0x00, 0x47, 0xC2, 0xB2, 0x0B, 0x00, 0x28, 0x42, 0x01, 0x41, 0x40, 0x03, 0x45, 0x42, 0x44, 0x45,
+0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x43, 0x42, 0x44, 0x42, 0x44, 0x42,
+0x44, 0x42, 0x44, 0x5C, 0x44, 0x00, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x5C, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x5C, 0x42, 0x01, 0x44, 0x00, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x5C,
+0x44, 0x5C, 0x44, 0xCA, 0x89, 0x04, 0x63, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x00,
+0x5C, 0x44, 0xC1, 0x69, 0xA8, 0x00, 0xC5, 0x69, 0xA8, 0x69, 0xA8, 0x69, 0xA8, 0x00, 0xC3, 0x69,
+0xA8, 0x69, 0xA8, 0x00, 0xC3, 0xBF, 0x52, 0x46, 0x7F, 0x18, 0xC1, 0x4C, 0x04, 0x00, 0x42, 0x44,
+0x01, 0x42, 0x44, 0x5C, 0x44, 0x00, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x00, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42,
+0x44, 0x42, 0x44, 0xDF, 0x44, 0x89, 0x04, 0x1C, 0x89, 0x04, 0x1C, 0x89, 0x04, 0x1C, 0x89, 0x04,
+0x1C, 0x89, 0x04, 0x1C, 0x89, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04,
+0x02, 0x04, 0x02, 0x04, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0xC2, 0x89, 0x51, 0x33, 0x12, 0xC1, 0x99, 0x33,
+0x02, 0xC2, 0x70, 0x6D, 0x08, 0x09, 0x44, 0x01, 0x42, 0xD6, 0x6C, 0x5C, 0x71, 0x1C, 0x7C, 0x4C,
+0x71, 0x3B, 0x2B, 0xA6, 0x54, 0x23, 0x35, 0x77, 0x0C, 0x35, 0x0C, 0x77, 0x0C, 0x35, 0x0C, 0x77,
+0x0C, 0x02, 0xC7, 0x77, 0x0C, 0x77, 0x0C, 0x77, 0x0C, 0x77, 0x0C, 0x14, 0xD1, 0x77, 0x35, 0x4A,
+0x84, 0x5C, 0x2A, 0x64, 0x4C, 0x7C, 0x21, 0x9D, 0x9C, 0x3E, 0x02, 0x3F, 0x04, 0x02, 0x03, 0x00,
+0x48, 0x08, 0x43, 0x5C, 0x56, 0x44, 0x56, 0x44, 0x00, 0x5C, 0x44, 0x00, 0x5C, 0x44, 0x00, 0x5C,
+0x44, 0x00, 0x5C, 0x44, 0x00, 0x5C, 0x44, 0x00, 0x5C, 0x56, 0x00, 0xC0, 0x6A, 0x00, 0xC1, 0x56,
+0x6A, 0x00, 0xC1, 0x76, 0x6A, 0x01, 0xC1, 0x56, 0x6A, 0x00, 0xC1, 0x56, 0x6A, 0x01, 0xC2, 0x56,
+0x6A, 0x36, 0x01, 0x44, 0x76, 0x04, 0x44, 0x76, 0x04, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42,
+0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x00, 0x42, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0xC2, 0x60, 0x58, 0x30, 0x0E, 0xC7, 0x51, 0x04,
+0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x00, 0x68, 0xC2, 0x4E, 0x46, 0x7F, 0x19, 0xC2, 0x4D, 0xAC,
+0x04, 0x00, 0x7F, 0x44, 0x7F, 0x44, 0x7F, 0x44, 0x7F, 0x44, 0x7F, 0x44, 0x7F, 0x44, 0x7F, 0x44,
+0x7F, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x00, 0x42, 0x02, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x02, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x00, 0x42, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x01, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x5C,
+0x44, 0x42, 0x40, 0x44, 0x42, 0x07, 0x44, 0x00, 0x42, 0x0D, 0x44, 0x42, 0x19, 0x44, 0xC2, 0x89,
+0x11, 0x2B, 0x00, 0xC1, 0x63, 0x02, 0x04, 0x44, 0x42, 0x01, 0x7F, 0xC3, 0x69, 0xA8, 0x69, 0xA8,
+0x01, 0xC3, 0x69, 0xA8, 0x69, 0xA8, 0x01, 0xC1, 0x69, 0xA8, 0x00, 0xC4, 0x69, 0x52, 0x46, 0x55,
+0x46, 0x17, 0xC1, 0x67, 0x02, 0x00, 0x5C, 0x42, 0xC1, 0x89, 0x02, 0x02, 0x44, 0x42, 0x0E, 0x44,
+0x5C, 0x42, 0x09, 0xC2, 0x89, 0x53, 0x71, 0x00, 0x74, 0xC2, 0x71, 0xC7, 0x71, 0x01, 0x74, 0xC2,
+0x71, 0xC7, 0x71, 0x00, 0x7E, 0xC1, 0xC7, 0x71, 0x01, 0x5C, 0x42, 0x1D, 0x44, 0x7F, 0xC3, 0x51,
+0x33, 0x99, 0x20, 0x00, 0x73, 0x60, 0x00, 0x73, 0x60, 0x00, 0x73, 0x60, 0x73, 0xD6, 0x6A, 0x33,
+0x20, 0x33, 0x20, 0x6A, 0x33, 0x20, 0x33, 0x20, 0x33, 0x20, 0x70, 0x6D, 0x26, 0x08, 0x03, 0x08,
+0x03, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x42, 0x01, 0x5C, 0xCF, 0x8F, 0x75, 0x3B, 0x34, 0x71,
+0x92, 0xC2, 0x2B, 0x11, 0x42, 0x4A, 0x23, 0x35, 0x77, 0x35, 0x0C, 0x00, 0xC3, 0x77, 0x0C, 0x35,
+0x0C, 0x01, 0xC3, 0x77, 0x0C, 0x77, 0x0C, 0x04, 0x75, 0x4C, 0x06, 0xC1, 0x77, 0x0C, 0x0B, 0xC4,
+0x77, 0x0C, 0x0E, 0x4A, 0x6C, 0x00, 0x6B, 0x7B, 0xC5, 0x71, 0x86, 0x64, 0x75, 0xB0, 0x02, 0x00,
+0x56, 0x42, 0x44, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0xC3, 0x70,
+0x33, 0x70, 0x33, 0x01, 0xC3, 0x99, 0x1A, 0x99, 0x33, 0x01, 0xC3, 0x99, 0x1A, 0x99, 0x33, 0x01,
+0xC3, 0x99, 0x1A, 0x99, 0x33, 0x00, 0xC6, 0x98, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0x56, 0x03, 0xC1,
+0x6A, 0x56, 0x00, 0xC1, 0x6D, 0x56, 0x02, 0xC4, 0x6A, 0x04, 0x37, 0x04, 0x36, 0x00, 0x77, 0x44,
+0x77, 0x44, 0x77, 0x76, 0x77, 0x44, 0x77, 0x44, 0x77, 0x44, 0x42, 0x10, 0x44, 0x42, 0x0A, 0x44,
+0x42, 0x01, 0x68, 0x42, 0x00, 0x7F, 0x42, 0x00, 0x7F, 0x42, 0x00, 0x7F, 0x42, 0x00, 0x7F, 0x42,
+0x44, 0x42, 0x06, 0xC2, 0x8C, 0xCC, 0x46, 0x17, 0xC2, 0x4D, 0x55, 0x46, 0x00, 0xC3, 0x52, 0x9A,
+0x69, 0x9A, 0x00, 0xC1, 0x69, 0x9A, 0x00, 0xC1, 0x69, 0x9A, 0x00, 0xC1, 0x69, 0x9A, 0x00, 0xC1,
+0x69, 0x9A, 0x01, 0x77, 0x42, 0x44, 0x42, 0x29, 0x44, 0x42, 0x07, 0x44, 0x42, 0x09, 0x44, 0x42,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x67, 0x40, 0x19, 0xC4, 0xD3, 0x9C, 0x75, 0xC5,
+0x00, 0x08, 0x71, 0x4B, 0xC1, 0xB3, 0x1D, 0x0B, 0x7C, 0x6C, 0xDF, 0xA1, 0x07, 0x79, 0x2E, 0x0D,
+0x2E, 0x0D, 0x79, 0x07, 0x79, 0x0D, 0x2E, 0x0D, 0x79, 0x07, 0x79, 0x0D, 0x2E, 0x0D, 0x79, 0x07,
+0x79, 0x0D, 0x2E, 0x0D, 0x79, 0x07, 0x79, 0xB4, 0x00, 0x0B, 0x00, 0x05, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x09, 0x52, 0xC2, 0xB6, 0x14, 0x5B, 0x03, 0x54, 0xC0, 0x5B, 0x03, 0x54, 0xC0, 0x5B, 0x01,
+0x54, 0xC2, 0x9D, 0x0B, 0x00, 0x1F, 0xDB, 0x4F, 0x15, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41,
+0x10, 0x15, 0x41, 0x10, 0x1B, 0x15, 0x41, 0x15, 0x41, 0x09, 0x15, 0x1B, 0x09, 0x1B, 0x10, 0x41,
+0x09, 0x1B, 0x29, 0x00, 0x42, 0x08, 0x6D, 0x40, 0x00, 0xC5, 0xBD, 0x8F, 0x75, 0x2A, 0x32, 0x2B,
+0x01, 0x6F, 0xCB, 0x9A, 0x5A, 0x54, 0x32, 0x35, 0x0C, 0x35, 0x0C, 0x35, 0x0C, 0x77, 0x0C, 0x00,
+0x75, 0x4C, 0x02, 0x75, 0x4C, 0xC3, 0x77, 0x0C, 0x35, 0x0C, 0x00, 0x63, 0x4C, 0x63, 0x4C, 0x03,
+0x63, 0x4C, 0x0C, 0xC8, 0x77, 0x4A, 0x63, 0xA4, 0xA7, 0x2F, 0x11, 0x6C, 0x11, 0x00, 0xC2, 0x6C,
+0x95, 0x00, 0x02, 0x45, 0x42, 0x08, 0x69, 0x5B, 0x55, 0x01, 0xC1, 0x41, 0x15, 0x11, 0xC6, 0x41,
+0x80, 0x3D, 0xDF, 0x94, 0xBE, 0x7A, 0x01, 0xC6, 0x94, 0xDF, 0x7A, 0x94, 0xBE, 0x94, 0x7A, 0x00,
+0xC3, 0x8B, 0xDF, 0x0F, 0x1E, 0x00, 0x67, 0x01, 0x5E, 0x67, 0x5E, 0x00, 0x67, 0x00, 0x5E, 0x67,
+0x5E, 0x00, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x52, 0xDF,
+0xD6, 0x07, 0x79, 0x0D, 0x79, 0x07, 0x79, 0x0D, 0x2E, 0x0D, 0x79, 0x07, 0x79, 0x0D, 0x2E, 0x0D,
+0x79, 0x07, 0x79, 0x0D, 0x2E, 0x0D, 0x79, 0x07, 0x79, 0x0D, 0x07, 0x0D, 0x79, 0x0D, 0xF2, 0xB3,
+0xC0, 0xDD, 0x0B, 0xC4, 0xF4, 0xDD, 0xB3, 0x40, 0x00, 0x2B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x6D, 0xC4, 0x84, 0x67, 0x12,
+0x31, 0x00, 0x07, 0x4B, 0x52, 0xC2, 0xB3, 0x57, 0x1D, 0x04, 0xC1, 0x57, 0x1D, 0x00, 0x7C, 0xC1,
+0x57, 0x1D, 0x00, 0x6C, 0xC2, 0xA1, 0xBA, 0x07, 0x04, 0x6E, 0x47, 0x10, 0x6E, 0xC3, 0xB4, 0x00,
+0x0B, 0x00, 0x00, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x09, 0x52, 0x6D, 0xC1, 0x67,
+0x14, 0x02, 0xC1, 0x5B, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x01, 0xC3, 0x5B, 0x14, 0xCE, 0x14, 0x01,
+0xC2, 0x44, 0x2D, 0x00, 0x1F, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0x55, 0x49, 0x50, 0x49, 0x00, 0x55,
+0x49, 0x00, 0x50, 0x49, 0x02, 0x55, 0x49, 0x01, 0x50, 0x69, 0x42, 0x09, 0x71, 0x40, 0x00, 0xC5,
+0xEF, 0x8F, 0xBC, 0x2A, 0x2B, 0x2A, 0x00, 0xC2, 0x5C, 0x85, 0x9A, 0x00, 0x76, 0x72, 0xC0, 0x77,
+0x00, 0x4C, 0x01, 0xC1, 0x77, 0x0C, 0x00, 0xCC, 0x54, 0x0C, 0x54, 0x8D, 0x54, 0x49, 0x0C, 0x54,
+0x8D, 0x54, 0x0E, 0x8D, 0x49, 0x00, 0x4E, 0xCF, 0x8D, 0x30, 0x54, 0x8D, 0x54, 0x0E, 0x98, 0x8D,
+0x54, 0x98, 0x23, 0x54, 0x49, 0x0E, 0x77, 0x0C, 0x01, 0xC1, 0x77, 0x0C, 0x00, 0x75, 0x63, 0x76,
+0xCB, 0xA7, 0xEF, 0x95, 0x5C, 0x2F, 0x5C, 0x2F, 0xBC, 0x95, 0x00, 0x2D, 0x00, 0x00, 0x45, 0x42,
+0x09, 0x5B, 0x50, 0xCC, 0x62, 0x97, 0x09, 0x10, 0x09, 0x10, 0x41, 0x10, 0x09, 0x10, 0x09, 0x10,
+0x09, 0x00, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x49, 0xC1, 0x41, 0x7D, 0x00, 0x53, 0xC5,
+0x80, 0x3D, 0x13, 0x3D, 0x8B, 0x13, 0x00, 0xC2, 0x8B, 0x3D, 0x13, 0x00, 0x7D, 0x53, 0xC3, 0x7D,
+0x7A, 0x3A, 0x1E, 0x00, 0x41, 0x4F, 0x62, 0x5E, 0x4F, 0x5E, 0x00, 0x4F, 0x5E, 0x4F, 0x5E, 0x4F,
+0x5E, 0x4F, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x03, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40,
+0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x08,
+0x6E, 0x47, 0x02, 0x6E, 0x47, 0x00, 0x6E, 0x47, 0x04, 0x6E, 0x4D, 0x47, 0x6E, 0xD0, 0xF2, 0xB3,
+0xDD, 0x1D, 0xDD, 0x1D, 0xDD, 0xF4, 0xB3, 0x1D, 0xDD, 0x1D, 0xB3, 0xF4, 0xDD, 0xF4, 0xB3, 0x00,
+0xC3, 0xE1, 0x00, 0x0B, 0x00, 0x29, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40,
+0x01, 0x42, 0x43, 0x48, 0x45, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x43,
+0x00, 0x42, 0x4A, 0x44, 0x40, 0x01, 0x45, 0x4A, 0x44, 0x45, 0x4A, 0x43, 0x40, 0x05, 0x41, 0x40,
+0x01, 0x44, 0x4A, 0x43, 0x40, 0x00, 0x48, 0x4A, 0x62, 0x40, 0x71, 0x6D, 0xC8, 0xB3, 0x2C, 0xA8,
+0x91, 0xB3, 0x91, 0xA8, 0x85, 0x91, 0x00, 0x7C, 0xC6, 0x91, 0x7E, 0x91, 0x3C, 0x57, 0xA1, 0x07,
+0x00, 0x4D, 0x47, 0x00, 0x4D, 0x79, 0xC7, 0x87, 0x6E, 0x4B, 0x38, 0xB9, 0xBB, 0xC6, 0x07, 0x0B,
+0xC5, 0xB4, 0x00, 0x0B, 0x00, 0x12, 0x00, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0xC1, 0x67,
+0x14, 0x01, 0xCC, 0x67, 0xC7, 0x64, 0x3B, 0x52, 0x34, 0x64, 0x71, 0xC7, 0x64, 0x34, 0x5B, 0x14,
+0x00, 0xC2, 0x67, 0x2D, 0x00, 0x1F, 0xC1, 0x4F, 0x09, 0x00, 0x50, 0x49, 0x03, 0xC1, 0x82, 0x78,
+0x00, 0xC8, 0x99, 0x1B, 0xAB, 0x33, 0xA5, 0x66, 0x72, 0x1B, 0x09, 0x04, 0x5B, 0x5C, 0x42, 0x03,
+0x4E, 0x42, 0x48, 0x4E, 0x43, 0x42, 0x41, 0x40, 0x00, 0xC3, 0xBD, 0x8F, 0x75, 0x2A, 0x00, 0x7B,
+0x72, 0x6B, 0xC5, 0xB0, 0x9A, 0x26, 0x58, 0x0C, 0x35, 0x00, 0x4C, 0xC2, 0x77, 0x0C, 0x35, 0x00,
+0x63, 0xC3, 0x74, 0x0E, 0x30, 0x0E, 0x00, 0xC3, 0x49, 0x0E, 0x49, 0x0E, 0x00, 0xC2, 0x49, 0x23,
+0x49, 0x00, 0xC5, 0x8D, 0x0C, 0x49, 0x0C, 0x8D, 0x49, 0x00, 0x70, 0x4E, 0x4A, 0xC5, 0x49, 0x8D,
+0x0C, 0x54, 0x8D, 0x0C, 0x07, 0x76, 0xC9, 0x58, 0xA4, 0x2F, 0x3B, 0x9B, 0x34, 0x3B, 0x75, 0x95,
+0x00, 0x02, 0x45, 0x42, 0xC3, 0x51, 0x0E, 0x02, 0x0A, 0x00, 0x44, 0x42, 0x02, 0x5B, 0x49, 0x05,
+0x5A, 0xC0, 0x78, 0x00, 0x50, 0x5A, 0xC6, 0x66, 0x20, 0x33, 0x66, 0x20, 0x1B, 0x09, 0x02, 0xC0,
+0x97, 0x00, 0x53, 0x7D, 0x53, 0xCB, 0x80, 0x13, 0x7D, 0x13, 0x9E, 0xCC, 0x13, 0x6F, 0x6A, 0xDF,
+0x3D, 0x13, 0x00, 0xCB, 0x7D, 0x65, 0x1F, 0x0F, 0x1E, 0x02, 0x5A, 0x30, 0x26, 0x36, 0x3F, 0x36,
+0x00, 0xC6, 0x58, 0x30, 0x0F, 0x1E, 0x0F, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x05, 0x6E, 0x47, 0xCE, 0x45, 0xB9, 0x39, 0x4B, 0x79,
+0x39, 0x87, 0x46, 0x4D, 0x87, 0x4D, 0x0D, 0x2E, 0x07, 0x0D, 0x00, 0x47, 0x02, 0xC2, 0xF2, 0xB3,
+0xDD, 0x00, 0xC1, 0xA8, 0x7E, 0x00, 0xC4, 0x9A, 0xA7, 0x7E, 0x9A, 0xA7, 0x00, 0xCB, 0x7E, 0x37,
+0xA8, 0xDD, 0x1D, 0x40, 0x12, 0x47, 0x00, 0x02, 0x03, 0x00, 0x00, 0x41, 0x48, 0x45, 0x42, 0x4A,
+0x44, 0x40, 0x03, 0x45, 0x4E, 0x40, 0x44, 0x4A, 0x48, 0x42, 0x40, 0x01, 0x43, 0x48, 0x00, 0x41,
+0x44, 0x43, 0x40, 0x01, 0x41, 0x48, 0x00, 0x45, 0x43, 0x48, 0x45, 0x40, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x02, 0x44, 0x42, 0x40, 0x43, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x01, 0x44, 0x48, 0x44,
+0x45, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x44, 0x4A, 0x48, 0x61, 0x48,
+0x45, 0x40, 0x00, 0x48, 0x45, 0x43, 0x4A, 0x68, 0x43, 0x42, 0x40, 0x08, 0x42, 0x41, 0x4A, 0x40,
+0x42, 0x43, 0x42, 0x76, 0x40, 0x4B, 0x52, 0x5D, 0x00, 0xCF, 0xA8, 0xC9, 0x9A, 0x91, 0x54, 0x7E,
+0x1D, 0x69, 0x91, 0xA7, 0x3C, 0xA7, 0xBF, 0x2C, 0xA1, 0x07, 0x04, 0xC8, 0x46, 0xB1, 0xBB, 0x45,
+0x46, 0xA0, 0x7F, 0x39, 0x07, 0x0B, 0xC1, 0xB4, 0x00, 0x02, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x0E,
+0x41, 0x40, 0x0B, 0xC7, 0x67, 0x14, 0x5B, 0x67, 0x52, 0x3B, 0x67, 0x52, 0x00, 0x7B, 0xC5, 0x71,
+0x83, 0x64, 0x52, 0x9B, 0x14, 0x01, 0xC2, 0x67, 0x0B, 0x00, 0x1F, 0xC2, 0x4F, 0x62, 0x09, 0x05,
+0xCB, 0x78, 0x20, 0x1B, 0xCF, 0x20, 0x66, 0x1A, 0x72, 0x20, 0xCF, 0x20, 0x09, 0x00, 0x55, 0x49,
+0x00, 0xC2, 0x62, 0x10, 0x02, 0x03, 0x43, 0x4E, 0x43, 0x4E, 0x44, 0x4E, 0x42, 0x41, 0x40, 0x00,
+0xD1, 0xBD, 0xD1, 0x2A, 0x9B, 0x71, 0x4C, 0x76, 0x9B, 0x2B, 0x2F, 0xA7, 0x4A, 0x32, 0x77, 0x0C,
+0x77, 0x32, 0x0C, 0x00, 0xC2, 0x77, 0x0C, 0x49, 0x00, 0x48, 0x4E, 0x00, 0xC7, 0x92, 0x30, 0x08,
+0x8D, 0x0E, 0x30, 0x8D, 0x49, 0x00, 0x4E, 0x4C, 0xC3, 0x49, 0x0C, 0x23, 0x49, 0x00, 0x4A, 0x4E,
+0x00, 0xC1, 0x49, 0x0E, 0x00, 0xC1, 0x49, 0x0C, 0x05, 0x72, 0x75, 0xCB, 0x4A, 0x37, 0x9A, 0x84,
+0x3B, 0x53, 0xB8, 0x8A, 0x50, 0x9B, 0x59, 0x00, 0x02, 0x45, 0x42, 0x4A, 0x4E, 0x42, 0xC4, 0x64,
+0x49, 0x04, 0x28, 0x02, 0x01, 0x50, 0x49, 0x04, 0x60, 0xCD, 0x78, 0x1B, 0x6A, 0x1A, 0x20, 0x78,
+0x1A, 0x20, 0xAB, 0x1A, 0x1B, 0x09, 0x62, 0x09, 0x01, 0xC3, 0x41, 0x13, 0x7D, 0x3D, 0x00, 0x53,
+0x7D, 0xC9, 0x6A, 0x88, 0x6A, 0x13, 0x88, 0x6F, 0xBE, 0x94, 0x13, 0x7D, 0x00, 0xD2, 0x7A, 0x0F,
+0x1E, 0x40, 0x3F, 0x30, 0x05, 0x5A, 0x28, 0x5A, 0x26, 0x28, 0x04, 0x54, 0x22, 0x1E, 0x0F, 0x27,
+0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x04,
+0xD1, 0xBA, 0x0D, 0x45, 0x6E, 0xBB, 0x38, 0x45, 0x87, 0x45, 0x87, 0x55, 0x6E, 0x39, 0x81, 0x2E,
+0x07, 0x0D, 0x07, 0x00, 0x6E, 0x47, 0x00, 0xC5, 0xF2, 0xB3, 0x1D, 0xDD, 0xA7, 0x9A, 0x00, 0xC3,
+0x85, 0x9A, 0x69, 0xA7, 0x00, 0xCA, 0xE1, 0xA8, 0x54, 0xA8, 0xDD, 0x1D, 0x0F, 0x00, 0x0B, 0x01,
+0x08, 0x00, 0x40, 0x00, 0x45, 0x4E, 0x42, 0xC4, 0x53, 0x1F, 0x0A, 0x05, 0x00, 0x02, 0x44, 0x4A,
+0x42, 0x44, 0x42, 0x41, 0x4A, 0x40, 0x01, 0x4A, 0x43, 0x4A, 0x45, 0x48, 0x00, 0x40, 0x01, 0x42,
+0x43, 0x42, 0x43, 0x42, 0x4A, 0x42, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x02, 0x42, 0x43, 0x42,
+0x48, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x45, 0x40, 0x01, 0x45, 0x42, 0x4A, 0x42, 0x40, 0x01,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x42, 0x4A, 0x00, 0x41, 0x48, 0x5F, 0x40, 0x00,
+0x48, 0x45, 0x43, 0x4A, 0x65, 0x43, 0x42, 0x40, 0x08, 0x41, 0x43, 0x45, 0x40, 0x42, 0x44, 0x42,
+0x43, 0x40, 0x00, 0x6D, 0xC5, 0xB3, 0x3C, 0x69, 0x54, 0x7E, 0x91, 0x00, 0xC3, 0xA8, 0xB3, 0x69,
+0x91, 0x00, 0xC5, 0x4A, 0xC9, 0x1D, 0x2C, 0xA1, 0x07, 0x03, 0x4D, 0x78, 0xC7, 0xA0, 0x55, 0x81,
+0x4D, 0x6E, 0xDC, 0x39, 0x07, 0x0A, 0x6E, 0xC3, 0xB4, 0x31, 0x0B, 0x00, 0x05, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0A, 0xC1, 0x67, 0x14, 0x01, 0xC2, 0x52, 0x3B, 0x67, 0x00, 0xC0, 0x52, 0x00, 0x74,
+0x7B, 0x00, 0xC2, 0x67, 0x64, 0x14, 0x01, 0xC2, 0x67, 0x2D, 0x00, 0x1F, 0xC4, 0x4F, 0x62, 0x09,
+0x10, 0x09, 0x03, 0xCB, 0x78, 0xAD, 0x10, 0x72, 0x10, 0x20, 0x33, 0x78, 0xA5, 0x72, 0x20, 0x09,
+0x04, 0x5B, 0x42, 0x04, 0x4A, 0x44, 0x4E, 0x42, 0x4E, 0x42, 0x41, 0x40, 0x00, 0xCF, 0xBD, 0xBC,
+0x9B, 0x50, 0x25, 0xAF, 0x7C, 0x76, 0x3B, 0x2B, 0xA6, 0x54, 0x0C, 0x35, 0x77, 0x0C, 0x00, 0xC7,
+0x77, 0x0C, 0x35, 0x0C, 0x23, 0x8D, 0x23, 0x8D, 0x00, 0x63, 0x00, 0x4E, 0x63, 0xCA, 0x8D, 0x23,
+0x8D, 0x23, 0x0C, 0x23, 0x0C, 0x8D, 0x0C, 0x23, 0x8D, 0x00, 0x4E, 0x63, 0x00, 0x4E, 0x63, 0x4E,
+0xC2, 0x54, 0x8D, 0x0C, 0x05, 0x75, 0x4E, 0xCA, 0x5A, 0x2A, 0x2B, 0x76, 0xB7, 0x0B, 0xAF, 0xB8,
+0x76, 0x44, 0x12, 0x00, 0x40, 0x00, 0x45, 0x42, 0x00, 0x4A, 0x44, 0xC3, 0x44, 0x04, 0x49, 0x02,
+0x02, 0x5B, 0x49, 0x04, 0x73, 0x5A, 0x5B, 0xC9, 0x99, 0x72, 0xAD, 0x99, 0x92, 0x10, 0x70, 0x72,
+0x15, 0x09, 0x03, 0xC3, 0x41, 0x13, 0x3D, 0x13, 0x02, 0xC7, 0x66, 0x88, 0x9E, 0x94, 0x56, 0x6F,
+0xDF, 0x13, 0x02, 0x7D, 0x5F, 0x5E, 0x4F, 0x7F, 0x4E, 0x00, 0xCB, 0x58, 0x27, 0x0E, 0x26, 0x0F,
+0x22, 0x30, 0x02, 0x1E, 0x0F, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0xC1, 0xB2, 0x07, 0x05, 0x4D, 0x47, 0x78, 0xCB, 0xDC, 0x87, 0x45, 0xC3, 0x39, 0x38, 0x87,
+0xDC, 0x55, 0xB9, 0x79, 0x07, 0x04, 0xC4, 0xBA, 0x07, 0xF2, 0xDD, 0xB3, 0x00, 0x7C, 0xD3, 0x9A,
+0xA7, 0x7E, 0x4A, 0x85, 0x3C, 0x7E, 0xDD, 0xA8, 0x54, 0xA8, 0xDD, 0x1D, 0x40, 0x12, 0x0B, 0x00,
+0x05, 0x03, 0x00, 0x01, 0x44, 0x42, 0x44, 0x70, 0x4E, 0x41, 0x40, 0x01, 0x41, 0x4E, 0x4A, 0x4E,
+0x44, 0x45, 0x40, 0x4A, 0x41, 0x4B, 0x40, 0x4A, 0x42, 0x4A, 0x42, 0x41, 0x43, 0x40, 0x01, 0x42,
+0x44, 0x42, 0x43, 0xC1, 0x47, 0x04, 0x00, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x03, 0x43, 0x48,
+0x45, 0x40, 0x02, 0x41, 0x40, 0x45, 0x40, 0x01, 0x44, 0x48, 0x43, 0x44, 0x40, 0x01, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x44, 0x43, 0x44, 0xC3, 0x53, 0x03, 0x0B, 0x00, 0x00, 0x42,
+0x48, 0x00, 0x42, 0x48, 0x00, 0x41, 0x40, 0x08, 0x4A, 0x00, 0x42, 0x45, 0x00, 0x48, 0x00, 0x68,
+0x52, 0x4B, 0x52, 0x5D, 0x00, 0xC8, 0xBF, 0x7E, 0x91, 0x7E, 0xA8, 0x7E, 0x91, 0x32, 0x7E, 0x00,
+0xC5, 0xB3, 0x91, 0xBF, 0x1D, 0xA1, 0x07, 0x02, 0x4D, 0x00, 0xC9, 0xBB, 0x87, 0x7F, 0x4B, 0x45,
+0x87, 0xBB, 0x46, 0x0D, 0x07, 0x0A, 0xC1, 0xB4, 0x00, 0x02, 0x6D, 0x40, 0x02, 0x41, 0x40, 0x0E,
+0x41, 0x40, 0x0B, 0xC2, 0x67, 0x14, 0x5B, 0x00, 0xC5, 0x67, 0x9C, 0x34, 0x64, 0xC7, 0x34, 0x02,
+0xC3, 0x64, 0x9B, 0x5B, 0x14, 0x00, 0xC2, 0x89, 0x2D, 0x00, 0x1F, 0xC2, 0x4F, 0x7B, 0x09, 0x05,
+0x73, 0xC1, 0x72, 0xE0, 0x00, 0x5B, 0x5A, 0x73, 0x60, 0xC6, 0x66, 0x78, 0x10, 0x15, 0x97, 0x15,
+0x09, 0x00, 0xC2, 0x62, 0x10, 0x02, 0x04, 0x4A, 0x44, 0x4A, 0x4E, 0x48, 0x42, 0x41, 0x52, 0x40,
+0x42, 0xCD, 0x84, 0x34, 0xB8, 0x0B, 0x47, 0x0B, 0x7A, 0x53, 0x42, 0xA6, 0x54, 0x23, 0x35, 0x0C,
+0x01, 0xC1, 0x77, 0x0C, 0x02, 0x75, 0x4C, 0x00, 0x75, 0x00, 0x4C, 0xC1, 0x77, 0x0C, 0x00, 0x75,
+0x00, 0x4C, 0x05, 0x75, 0x4C, 0x01, 0xC3, 0x77, 0x0C, 0x77, 0x0C, 0x06, 0x72, 0x4C, 0x75, 0xCB,
+0x54, 0xA7, 0x42, 0x3B, 0x65, 0x6B, 0x31, 0x0B, 0xB7, 0x56, 0xB8, 0x00, 0x02, 0x45, 0x42, 0x00,
+0x4A, 0x44, 0x4E, 0x4A, 0x48, 0x68, 0x42, 0x5C, 0x42, 0x5B, 0x50, 0x49, 0x03, 0x50, 0xC3, 0xAB,
+0x78, 0xC4, 0x1A, 0x05, 0x55, 0x49, 0x03, 0xCA, 0x41, 0x13, 0x3D, 0xCC, 0x8B, 0x3D, 0x56, 0xA9,
+0x7A, 0x88, 0x56, 0x00, 0xC1, 0x6A, 0x3D, 0x00, 0x53, 0x7D, 0xD0, 0x7D, 0x65, 0x1F, 0x0F, 0x1E,
+0x3F, 0x60, 0x0F, 0x54, 0x58, 0x04, 0x26, 0x30, 0x26, 0x58, 0x90, 0x1E, 0x00, 0x4F, 0x40, 0x10,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x06, 0x4D, 0xC7, 0x4D,
+0x6E, 0x39, 0x45, 0xB1, 0x39, 0x87, 0x4D, 0x00, 0xC3, 0x4E, 0x39, 0x79, 0x07, 0x03, 0x6E, 0x47,
+0x00, 0xC2, 0xF2, 0x1D, 0xB3, 0x00, 0xDD, 0x7E, 0x9A, 0x7E, 0xA7, 0x69, 0xE1, 0xF6, 0x8F, 0xA8,
+0xA7, 0x9A, 0xBF, 0xDD, 0xF4, 0x0F, 0x00, 0x0B, 0x31, 0x0F, 0x51, 0x12, 0x05, 0x00, 0x44, 0x21,
+0x02, 0x53, 0x03, 0x31, 0x00, 0x01, 0x42, 0x43, 0x71, 0x48, 0xC1, 0x53, 0x08, 0x00, 0x44, 0x40,
+0x01, 0x4A, 0x43, 0x48, 0x45, 0x00, 0x43, 0x40, 0x01, 0x45, 0x48, 0xC7, 0x53, 0x02, 0x08, 0x03,
+0x02, 0x00, 0x01, 0x00, 0x07, 0x41, 0x40, 0x03, 0x44, 0x4A, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40,
+0x02, 0x45, 0x00, 0x40, 0x02, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x05, 0x45, 0x42, 0x41, 0x4B, 0x61,
+0x41, 0x42, 0x44, 0x00, 0x41, 0x45, 0x41, 0x40, 0x45, 0x41, 0x40, 0x09, 0x45, 0x01, 0x41, 0x01,
+0x45, 0x4B, 0x52, 0x71, 0x6D, 0xC2, 0xB3, 0x2C, 0x3C, 0x01, 0x5D, 0x7C, 0x00, 0xC0, 0x69, 0x00,
+0xC0, 0x57, 0x00, 0x6C, 0x7C, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x00, 0xC0,
+0x45, 0x01, 0xC0, 0x4B, 0x00, 0x78, 0xC2, 0xC3, 0x0D, 0x07, 0x0A, 0x6E, 0xC3, 0xB4, 0x00, 0x0B,
+0x00, 0x05, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0xC4, 0x67, 0x14, 0x52, 0x5B, 0x14, 0x00, 0xC0,
+0x52, 0x00, 0x54, 0x00, 0xC1, 0x52, 0x14, 0x00, 0xC2, 0x52, 0x67, 0x14, 0x01, 0xC2, 0x67, 0x0B,
+0x00, 0x1F, 0xC4, 0x4F, 0x15, 0x09, 0x10, 0x09, 0x04, 0x50, 0x60, 0x00, 0x50, 0x01, 0xC4, 0x41,
+0x20, 0x7B, 0x1B, 0x09, 0x04, 0x5B, 0x5C, 0x42, 0x06, 0x44, 0x42, 0x00, 0x41, 0x52, 0x40, 0x42,
+0xCF, 0x9B, 0x34, 0xD4, 0x0B, 0x27, 0xAF, 0x16, 0x6A, 0x32, 0xA6, 0x3E, 0xC9, 0x35, 0x0C, 0x35,
+0x0C, 0x00, 0x75, 0x4C, 0x01, 0x63, 0x4C, 0x03, 0x75, 0x4C, 0x00, 0x63, 0x4C, 0x04, 0xC1, 0x77,
+0x0C, 0x01, 0xC1, 0x77, 0x0C, 0x0D, 0xCC, 0x8D, 0xA7, 0x2B, 0x3B, 0x65, 0x6B, 0x2D, 0x00, 0x7C,
+0x56, 0x9D, 0x0B, 0x00, 0x01, 0x45, 0x42, 0x02, 0x44, 0x00, 0x68, 0x42, 0x02, 0x50, 0x49, 0xC1,
+0x97, 0x09, 0x03, 0x50, 0xC0, 0x82, 0x00, 0xC6, 0x7B, 0x10, 0x20, 0x09, 0x10, 0x20, 0x15, 0x00,
+0x49, 0x02, 0x50, 0xC9, 0x41, 0x13, 0x7D, 0x3D, 0x13, 0x80, 0xCC, 0x13, 0x94, 0x13, 0x01, 0xC1,
+0x7D, 0x13, 0x01, 0xC5, 0x7D, 0x13, 0x3D, 0x1F, 0x40, 0x0F, 0x00, 0x62, 0x4F, 0x62, 0x68, 0x5E,
+0x62, 0xC7, 0x90, 0x28, 0x22, 0x0F, 0x1E, 0x0F, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x07, 0x4D, 0xC0, 0x45, 0x00, 0xCC, 0x79, 0x4B,
+0x38, 0x46, 0x0D, 0x4B, 0x45, 0x79, 0x0D, 0x2E, 0x07, 0x0D, 0x07, 0x03, 0xC3, 0xF2, 0xB3, 0xDD,
+0xB3, 0x00, 0x7C, 0xC0, 0xB3, 0x01, 0x5D, 0xC1, 0xDD, 0x3C, 0x00, 0x5D, 0xC0, 0xB3, 0x00, 0xC4,
+0xF4, 0x1D, 0x0F, 0x12, 0x00, 0x00, 0x41, 0x00, 0x40, 0x41, 0x40, 0x41, 0x6D, 0x41, 0xC2, 0xAA,
+0x27, 0x00, 0x02, 0x71, 0x6D, 0x40, 0x41, 0x5F, 0x45, 0x00, 0x41, 0x5C, 0x44, 0x42, 0x45, 0x68,
+0x61, 0x40, 0x6D, 0x41, 0x45, 0x44, 0x00, 0x45, 0x5F, 0x45, 0x4B, 0x5F, 0x61, 0x40, 0x00, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x03, 0x41, 0x00, 0x40, 0x03, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x08, 0x4B, 0x40, 0x00, 0x61, 0x42, 0x00, 0x41, 0x40, 0x18, 0x52, 0xC1, 0xB3,
+0x2C, 0x00, 0x5D, 0x00, 0x6C, 0x00, 0x5D, 0x03, 0x6C, 0x5D, 0x00, 0x6C, 0xC1, 0xA1, 0x07, 0x05,
+0x4D, 0xC5, 0x79, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0C, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0A, 0xC1, 0xB6, 0x5B, 0x02, 0xC1, 0x67, 0x5B, 0x00, 0xC3, 0x67, 0x5B, 0xCE, 0x5B,
+0x00, 0xC6, 0x67, 0xCE, 0x67, 0x14, 0x5B, 0x67, 0x00, 0x20, 0xC8, 0x4F, 0x15, 0x09, 0x41, 0x09,
+0x41, 0x15, 0x41, 0x09, 0x00, 0x5B, 0x55, 0x5B, 0x49, 0x5B, 0x49, 0x00, 0x5B, 0x00, 0x55, 0xC4,
+0x41, 0x09, 0x15, 0x1B, 0x09, 0x00, 0x5B, 0x69, 0x42, 0x02, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42,
+0x00, 0x40, 0x01, 0xC9, 0xBD, 0x6C, 0x9B, 0xCC, 0xAF, 0x00, 0xD8, 0x4C, 0x88, 0x42, 0x00, 0xC8,
+0xC9, 0x0C, 0x77, 0x0C, 0x77, 0x35, 0x0C, 0x77, 0x0C, 0x00, 0xC0, 0x49, 0x00, 0xC4, 0x8D, 0x0E,
+0x23, 0x0E, 0x23, 0x00, 0x4E, 0xC7, 0x8D, 0x30, 0x8D, 0x0C, 0x49, 0x8D, 0x35, 0x0C, 0x12, 0x75,
+0xC2, 0x54, 0xA7, 0x2B, 0x00, 0xC7, 0x76, 0x6B, 0xC0, 0xAF, 0xB8, 0x76, 0x9D, 0x00, 0x02, 0x41,
+0x42, 0x00, 0x45, 0x42, 0x61, 0xC1, 0xAA, 0x28, 0x00, 0x42, 0x61, 0x68, 0x5B, 0x55, 0x49, 0xCE,
+0x41, 0x15, 0x41, 0x15, 0x1B, 0x09, 0x1B, 0x15, 0x41, 0x09, 0x1B, 0x09, 0x15, 0x41, 0x15, 0x01,
+0x49, 0x00, 0xC7, 0x41, 0x15, 0x41, 0x8B, 0x3D, 0x7D, 0xBE, 0x7D, 0x01, 0xC6, 0x80, 0x3D, 0x8B,
+0x3D, 0x7D, 0x3D, 0x8B, 0x00, 0x7D, 0xC8, 0x80, 0x94, 0x01, 0xD9, 0x1E, 0x27, 0x01, 0x1E, 0x12,
+0x00, 0x5E, 0x52, 0x67, 0xC6, 0xD9, 0x27, 0x1E, 0x27, 0xD9, 0x27, 0x00, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x06, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x4D,
+0x00, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0x4D, 0x00, 0x47, 0x03, 0xC1, 0xF2, 0xDD, 0x03, 0xC1,
+0xF4, 0xDD, 0x07, 0xC3, 0xF4, 0xDD, 0x40, 0x00, 0x17, 0x42, 0x01, 0x4B, 0x40, 0x03, 0x41, 0x42,
+0x00, 0x45, 0x40, 0x01, 0x4B, 0x40, 0x01, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x43,
+0x44, 0x08, 0x43, 0x44, 0x0D, 0x43, 0x44, 0x05, 0x43, 0x44, 0x09, 0x43, 0x44, 0x05, 0xC1, 0x44,
+0x04, 0x00, 0x76, 0xC0, 0x63, 0x00, 0x44, 0x05, 0x76, 0x44, 0x00, 0x76, 0xC2, 0x58, 0x7E, 0x85,
+0x01, 0xC0, 0xA8, 0x00, 0xC0, 0x85, 0x01, 0xC1, 0x7E, 0x85, 0x02, 0xC3, 0x7E, 0x52, 0x4D, 0x6E,
+0x00, 0xC1, 0x7F, 0x6E, 0x03, 0xC1, 0x7F, 0x6E, 0x00, 0xC9, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E,
+0x7F, 0x6E, 0x7F, 0x6E, 0x00, 0xC1, 0x7F, 0x6E, 0x01, 0xC1, 0x76, 0x04, 0x01, 0xC2, 0x44, 0x36,
+0x04, 0x02, 0x43, 0x44, 0x0F, 0xC3, 0x96, 0x04, 0x96, 0x04, 0x03, 0xC1, 0x96, 0x04, 0x00, 0xCA,
+0x96, 0x04, 0x86, 0x34, 0x71, 0x34, 0x3E, 0x34, 0x3E, 0x34, 0x3E, 0x02, 0x74, 0x7E, 0x00, 0x74,
+0xC4, 0xC7, 0x3E, 0x71, 0x36, 0x04, 0x1F, 0xC1, 0x6D, 0x1A, 0x00, 0x73, 0x5A, 0x03, 0x73, 0x5A,
+0x00, 0x73, 0x5A, 0x07, 0x73, 0x5A, 0x73, 0x00, 0xC2, 0x92, 0x53, 0x08, 0x06, 0x4A, 0x48, 0x00,
+0xC1, 0x44, 0x04, 0x00, 0xC9, 0xC5, 0x8F, 0x11, 0x71, 0x4C, 0xB8, 0x4C, 0x52, 0x2B, 0x42, 0x00,
+0xC2, 0x54, 0x23, 0x35, 0x00, 0x4C, 0x00, 0x75, 0x4C, 0x00, 0xCA, 0x77, 0x49, 0x23, 0x5A, 0x8D,
+0x49, 0x54, 0x77, 0x0C, 0x0E, 0x49, 0x00, 0x4E, 0x4C, 0x70, 0xC1, 0x49, 0x0C, 0x10, 0xC1, 0xC9,
+0x0C, 0x00, 0x75, 0x4E, 0xCC, 0xA7, 0x2A, 0x2B, 0x3B, 0x50, 0x7C, 0x7A, 0x50, 0x9C, 0x86, 0x04,
+0x36, 0x04, 0x00, 0x43, 0x48, 0xC1, 0x86, 0x08, 0x05, 0xC3, 0x86, 0x08, 0x70, 0x33, 0x00, 0x5A,
+0x73, 0x5A, 0x00, 0x73, 0x5A, 0x06, 0x73, 0x5A, 0x73, 0x5A, 0x73, 0x5A, 0x73, 0x5A, 0x73, 0xC2,
+0x6A, 0x52, 0x6A, 0x0E, 0x43, 0xC5, 0x60, 0x36, 0x60, 0x36, 0x26, 0x60, 0x01, 0x66, 0xC0, 0x60,
+0x00, 0x76, 0xC0, 0x60, 0x00, 0x76, 0xC1, 0x60, 0x04, 0x10, 0x43, 0x44, 0x0A, 0x43, 0x44, 0x0F,
+0x43, 0x44, 0x05, 0x76, 0xC3, 0x8C, 0x4E, 0x4D, 0x6E, 0x00, 0xC1, 0x7F, 0x6E, 0x01, 0xC3, 0x7F,
+0x6E, 0x7F, 0x6E, 0x03, 0xC1, 0x4E, 0x6E, 0x01, 0xC1, 0x7F, 0x6E, 0x00, 0xC3, 0x7F, 0x4E, 0x7F,
+0x6E, 0x01, 0xC2, 0x4D, 0x52, 0xA8, 0x01, 0xC7, 0x9A, 0xA8, 0x9A, 0xD2, 0xA8, 0x85, 0xB0, 0x9A,
+0x00, 0xC1, 0x85, 0x9A, 0x00, 0xC5, 0xA8, 0x69, 0x26, 0x04, 0x44, 0x04, 0x1A, 0xC1, 0x44, 0x04,
+0x09, 0xC1, 0x44, 0x04, 0x00, 0x43, 0x44, 0x07, 0x43, 0x44, 0x0A, 0x42, 0x41, 0x44, 0x42, 0x28,
+0x61, 0x42, 0x09, 0x69, 0xC5, 0xBD, 0x11, 0x2B, 0x32, 0x89, 0x02, 0x05, 0x69, 0x42, 0x01, 0x61,
+0x00, 0xC3, 0xBD, 0x90, 0xBD, 0x02, 0x00, 0xC0, 0xBD, 0x00, 0xC1, 0x90, 0xBD, 0x00, 0xC7, 0x90,
+0x28, 0x02, 0x22, 0xCC, 0x46, 0x55, 0x46, 0x01, 0xC1, 0x45, 0x46, 0x00, 0xC1, 0x45, 0x46, 0x0A,
+0xC1, 0x45, 0x46, 0x01, 0xC3, 0x45, 0x46, 0xD4, 0x02, 0x19, 0xC2, 0x8C, 0x96, 0x8C, 0x00, 0xC7,
+0x96, 0x8C, 0x96, 0x8C, 0x96, 0x8C, 0x96, 0x8C, 0x00, 0xC2, 0x86, 0xC7, 0x52, 0x0A, 0xC1, 0x71,
+0x52, 0x00, 0xC3, 0xC7, 0x71, 0x89, 0x02, 0x1E, 0xC2, 0xBD, 0x16, 0x20, 0x17, 0xC2, 0x6D, 0x51,
+0x03, 0x09, 0x42, 0x00, 0x69, 0xD0, 0xC5, 0x84, 0x75, 0x11, 0x64, 0x71, 0x34, 0x42, 0x32, 0x11,
+0xA6, 0x54, 0x32, 0x0C, 0x77, 0x35, 0x0C, 0x00, 0x72, 0x75, 0x4C, 0xC1, 0x49, 0x0E, 0x00, 0x4C,
+0xC3, 0x74, 0x0E, 0x23, 0x49, 0x00, 0x4E, 0xC0, 0x49, 0x00, 0xC1, 0x8D, 0x49, 0x00, 0x4C, 0x04,
+0xC1, 0xC9, 0x0C, 0x0B, 0x75, 0x72, 0xD0, 0x8D, 0xA7, 0x2F, 0x84, 0x2B, 0x11, 0x34, 0x64, 0x3B,
+0x6C, 0xB0, 0x29, 0x28, 0x02, 0x29, 0x04, 0x03, 0x08, 0xC1, 0x63, 0x20, 0x08, 0xC1, 0x6D, 0x20,
+0x0C, 0xC2, 0x56, 0x76, 0x56, 0x04, 0xC1, 0x4C, 0x56, 0x04, 0xC4, 0x4C, 0x56, 0x4C, 0x04, 0x3F,
+0x00, 0x44, 0x7F, 0x44, 0x7F, 0x00, 0x44, 0x7F, 0x00, 0x44, 0x7F, 0x44, 0x7F, 0x44, 0x7F, 0x42,
+0x38, 0x68, 0xC4, 0xCC, 0x55, 0x46, 0x45, 0x46, 0x00, 0xC1, 0x45, 0x46, 0x05, 0xC1, 0x45, 0x46,
+0x00, 0xC0, 0x45, 0x00, 0xC0, 0x46, 0x05, 0xC0, 0x55, 0x02, 0x54, 0xC0, 0x69, 0x00, 0xC3, 0xA8,
+0x69, 0xBF, 0x69, 0x02, 0xC9, 0xA8, 0x69, 0xA8, 0x69, 0xA8, 0x69, 0xA8, 0x69, 0xA4, 0x02, 0x18,
+0x61, 0x42, 0x07, 0x69, 0x42, 0x1E, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19,
+0x71, 0xC4, 0xC0, 0x6C, 0x75, 0xEF, 0x00, 0x18, 0x4B, 0x40, 0xC9, 0xB4, 0x07, 0x0D, 0x07, 0x0D,
+0x07, 0x0D, 0x07, 0x0D, 0x07, 0x00, 0x4D, 0x01, 0x47, 0x03, 0x4D, 0x01, 0x47, 0x4D, 0x47, 0x4D,
+0x47, 0x6E, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x52, 0xC1, 0xAE, 0x18, 0x09, 0xC3, 0xDA,
+0xB6, 0x5B, 0x14, 0x0A, 0xC6, 0x67, 0x5B, 0x14, 0x67, 0x14, 0x25, 0x00, 0x0D, 0x41, 0x40, 0x0F,
+0xC4, 0x4F, 0x15, 0x09, 0x10, 0x09, 0x04, 0x55, 0x00, 0x49, 0x55, 0x01, 0x49, 0x00, 0x5B, 0x49,
+0x01, 0x55, 0x49, 0xC4, 0x97, 0x09, 0x1B, 0x29, 0x02, 0x09, 0x40, 0x01, 0x61, 0xC3, 0x84, 0xBC,
+0x2A, 0x42, 0x00, 0x51, 0x01, 0xC9, 0x9A, 0x54, 0x32, 0x0C, 0x35, 0x77, 0x0C, 0x35, 0x77, 0x0C,
+0x00, 0x75, 0x4E, 0xC1, 0x54, 0x0C, 0x00, 0x63, 0x4C, 0x00, 0x4E, 0x63, 0x4C, 0x4E, 0x4C, 0x63,
+0x4C, 0x63, 0x00, 0x4C, 0x72, 0x4C, 0x09, 0xC1, 0xC9, 0x0C, 0x04, 0x75, 0x4E, 0x66, 0xC9, 0xA4,
+0x2F, 0x11, 0x8F, 0x11, 0x2F, 0x11, 0xBC, 0x95, 0x00, 0x02, 0x45, 0x42, 0x09, 0x5B, 0x49, 0xC1,
+0x97, 0x09, 0x02, 0x50, 0x49, 0x01, 0x55, 0x49, 0x55, 0x01, 0x49, 0x55, 0x49, 0x01, 0x50, 0x49,
+0x00, 0x5B, 0xC1, 0xBE, 0x3D, 0x00, 0xC4, 0x8B, 0x3D, 0x80, 0x3D, 0x13, 0x00, 0xC1, 0x8B, 0x3D,
+0x02, 0x53, 0xC0, 0x7D, 0x00, 0xC2, 0x94, 0x01, 0x1E, 0x00, 0x4F, 0x67, 0x00, 0x5E, 0x00, 0x67,
+0x5E, 0x00, 0x67, 0x5E, 0x02, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0xC1, 0xD6, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x01, 0x47, 0x00,
+0x4D, 0x00, 0x47, 0x00, 0x4D, 0x01, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x6E, 0x47, 0x00, 0xC1, 0xA1,
+0x1D, 0x06, 0x6C, 0x5D, 0x6C, 0x5D, 0x6C, 0x00, 0xC4, 0xFA, 0x1D, 0x2C, 0xE1, 0x00, 0x2B, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x00, 0x45, 0x40, 0x00, 0x41, 0x40, 0x01,
+0x41, 0x00, 0x40, 0x01, 0x41, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x02, 0x41, 0x40,
+0x05, 0x41, 0x01, 0x40, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40,
+0x03, 0x71, 0x6D, 0x7E, 0xC2, 0xF1, 0x2D, 0x00, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40,
+0x05, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x71, 0x40, 0x00, 0xC3, 0xB4,
+0x07, 0x0D, 0x07, 0x06, 0x6E, 0xC1, 0x4B, 0x07, 0x00, 0x4D, 0xC0, 0x4B, 0x00, 0x4D, 0x47, 0x07,
+0xC6, 0xB4, 0x00, 0x0B, 0x00, 0x0B, 0x12, 0x00, 0x02, 0x41, 0x40, 0x0C, 0x52, 0x40, 0x71, 0x5F,
+0x58, 0xC0, 0x8E, 0x02, 0x58, 0x00, 0xC2, 0x8E, 0xAE, 0x18, 0x01, 0xC1, 0x9D, 0x14, 0x01, 0xC6,
+0x5B, 0x14, 0x5B, 0x14, 0x52, 0x5B, 0x14, 0x02, 0xC3, 0x67, 0x5B, 0x52, 0x14, 0x00, 0x7A, 0x40,
+0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x03, 0x55, 0x49, 0x55, 0x50, 0x00, 0x5B, 0x55,
+0xC3, 0x41, 0x15, 0x09, 0x10, 0x00, 0x49, 0x50, 0x49, 0x55, 0x49, 0x01, 0x55, 0x69, 0x42, 0x03,
+0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x41, 0x40, 0x00, 0x61, 0xC2, 0x84, 0xBC, 0x2A, 0x03, 0xCF,
+0x9A, 0x85, 0x5A, 0x9A, 0x23, 0x35, 0x0C, 0x35, 0x0C, 0x32, 0x77, 0x35, 0x32, 0x0C, 0x77, 0x0C,
+0x01, 0xC8, 0x77, 0x0C, 0x77, 0x35, 0x0C, 0x77, 0x0C, 0x77, 0x35, 0x00, 0x4C, 0x75, 0x4C, 0x05,
+0xC1, 0xC9, 0x0C, 0x05, 0xC1, 0xC9, 0x0C, 0x01, 0x75, 0xC5, 0x4A, 0x36, 0x30, 0xA4, 0xD2, 0x2F,
+0x01, 0xC5, 0x5C, 0xBC, 0x95, 0x00, 0x0B, 0x00, 0x00, 0x45, 0x42, 0xC1, 0xAA, 0x02, 0x07, 0x5B,
+0x49, 0x05, 0x5B, 0x50, 0x00, 0xC8, 0x41, 0x10, 0x97, 0x41, 0x10, 0xA5, 0x09, 0x10, 0x09, 0x03,
+0xC4, 0x41, 0x80, 0x13, 0x7D, 0x80, 0x00, 0x53, 0xC4, 0x80, 0x3D, 0x80, 0x7A, 0x13, 0x02, 0xC1,
+0x7D, 0x13, 0x01, 0x45, 0x5E, 0x4F, 0x00, 0x62, 0x00, 0xC2, 0x90, 0x22, 0x0F, 0x00, 0x5E, 0x62,
+0x4F, 0x00, 0x5E, 0x4F, 0x5E, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04,
+0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x07, 0x4D, 0xCA, 0x4B, 0x79, 0x07, 0x0D, 0xBA, 0x4B, 0x0D,
+0xCB, 0x4B, 0x0D, 0x07, 0x03, 0x4D, 0x47, 0x01, 0xC3, 0xA1, 0x57, 0x1D, 0x57, 0x00, 0x5D, 0xC0,
+0x57, 0x00, 0x5D, 0x7C, 0xC1, 0x57, 0x1D, 0x02, 0xC4, 0x57, 0x1D, 0x3C, 0xE1, 0x00, 0x00, 0x41,
+0x40, 0x06, 0x41, 0x40, 0x03, 0x41, 0x40, 0x41, 0x40, 0x41, 0x01, 0x40, 0x02, 0x41, 0x01, 0x40,
+0x05, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00,
+0x40, 0x42, 0x40, 0x44, 0x48, 0x00, 0x44, 0x4A, 0x40, 0x4A, 0x42, 0x40, 0x41, 0x40, 0x01, 0x44,
+0x4A, 0x40, 0x4A, 0x42, 0x00, 0x48, 0x41, 0x40, 0x02, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x43, 0x00,
+0x42, 0x4A, 0x43, 0x40, 0x01, 0x42, 0x4A, 0x43, 0x42, 0x4A, 0x48, 0x41, 0x40, 0x02, 0x4B, 0x67,
+0x41, 0x40, 0x01, 0x44, 0x4A, 0x43, 0x40, 0x45, 0x48, 0x4A, 0x42, 0x40, 0x0F, 0x4B, 0x40, 0xC1,
+0xD6, 0x07, 0x06, 0x4D, 0x78, 0xC5, 0xB9, 0x87, 0x7F, 0xB1, 0x46, 0x87, 0x00, 0xC4, 0xC3, 0x0D,
+0x79, 0x0D, 0x07, 0x03, 0xC6, 0x79, 0xB4, 0x31, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40, 0x0E,
+0x71, 0x58, 0x00, 0xD6, 0x8C, 0x8D, 0x98, 0x96, 0x74, 0x8C, 0xAD, 0x96, 0x92, 0x18, 0xE5, 0x9D,
+0x52, 0xC2, 0x14, 0x71, 0x9B, 0xC7, 0x64, 0x9B, 0xC7, 0x71, 0x34, 0x00, 0x7E, 0x00, 0x74, 0x7B,
+0xC3, 0x52, 0x14, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x01, 0x50, 0x49,
+0x50, 0xC7, 0x41, 0x20, 0x78, 0x66, 0x33, 0x10, 0x66, 0x33, 0x00, 0xC0, 0x78, 0x00, 0xC2, 0xA5,
+0x15, 0x09, 0x03, 0x5B, 0x56, 0x42, 0x02, 0x44, 0x4E, 0x44, 0x00, 0x4E, 0x44, 0x42, 0x41, 0x40,
+0x00, 0x61, 0xC1, 0x8F, 0x2A, 0x00, 0x51, 0x6F, 0x51, 0x72, 0x51, 0xCA, 0x9A, 0x36, 0x58, 0x23,
+0x35, 0x77, 0x35, 0x0C, 0x77, 0x32, 0x0C, 0x06, 0xC1, 0x77, 0x23, 0x00, 0x4C, 0x03, 0x63, 0x4C,
+0x63, 0x00, 0x4C, 0x0F, 0x75, 0x00, 0x4E, 0xCC, 0x5A, 0x90, 0x3F, 0x11, 0x8F, 0x3E, 0x86, 0x3B,
+0x5C, 0x95, 0x00, 0x0B, 0x00, 0x00, 0x45, 0x42, 0x48, 0x4E, 0x42, 0x00, 0x4E, 0x44, 0x42, 0x02,
+0x5B, 0xC1, 0x62, 0x09, 0x02, 0x55, 0x50, 0xC1, 0x72, 0x78, 0x00, 0xC4, 0xA5, 0x1A, 0x66, 0x20,
+0x78, 0x00, 0x5A, 0x5B, 0x50, 0x49, 0x01, 0xC5, 0x62, 0x41, 0x80, 0x13, 0x7D, 0x80, 0x01, 0x53,
+0xC7, 0x9E, 0x65, 0x4C, 0x88, 0x6F, 0x7A, 0x94, 0x13, 0x00, 0xD3, 0x7D, 0x94, 0x1F, 0x40, 0x0F,
+0x22, 0x03, 0x4A, 0x26, 0x60, 0x36, 0x60, 0x03, 0x5A, 0x58, 0x22, 0x1E, 0x0F, 0x1E, 0x00, 0x10,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0xD9, 0x79, 0x0D,
+0x46, 0xBB, 0x39, 0x4B, 0xDC, 0x39, 0x87, 0x55, 0x39, 0x87, 0x39, 0x0D, 0x2E, 0x07, 0x2E, 0x07,
+0x0D, 0x07, 0xBA, 0x07, 0xA1, 0x57, 0x3C, 0x91, 0x00, 0xC2, 0x69, 0x4A, 0x7E, 0x01, 0xC4, 0x54,
+0x91, 0x69, 0x9A, 0x91, 0x00, 0xC3, 0x7E, 0x3C, 0xE1, 0x00, 0x01, 0x43, 0x00, 0x40, 0x00, 0x41,
+0x4A, 0x45, 0x42, 0x4A, 0x44, 0x40, 0x03, 0x45, 0x4E, 0x41, 0x44, 0x48, 0x00, 0x42, 0x40, 0x41,
+0x40, 0x48, 0x01, 0x41, 0x44, 0x48, 0x40, 0x01, 0x41, 0x48, 0x00, 0x45, 0x4A, 0x00, 0x42, 0x40,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x48, 0x43, 0x42, 0x44, 0x4E, 0x45,
+0x4E, 0x42, 0x40, 0x41, 0x40, 0x01, 0x43, 0x4E, 0x41, 0x4E, 0x42, 0x44, 0x48, 0x45, 0x40, 0x02,
+0x41, 0x40, 0x04, 0x41, 0x4E, 0x44, 0x4A, 0x48, 0x45, 0x48, 0x41, 0x00, 0x40, 0x48, 0x45, 0x43,
+0x44, 0x41, 0x48, 0x42, 0x40, 0x02, 0x4B, 0x40, 0x02, 0x4B, 0x45, 0x00, 0x4A, 0x41, 0x00, 0x45,
+0x44, 0xC1, 0x51, 0x00, 0x11, 0xCB, 0xB4, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07,
+0x4B, 0x55, 0x00, 0xC7, 0x87, 0x38, 0x45, 0x81, 0x61, 0x55, 0x79, 0x07, 0x00, 0x4D, 0x47, 0x4D,
+0x47, 0x01, 0xC3, 0xB4, 0x00, 0x0B, 0x00, 0x00, 0x52, 0x40, 0x02, 0x41, 0x40, 0x0B, 0x52, 0x40,
+0x00, 0x71, 0xCB, 0xE5, 0x18, 0xAE, 0x74, 0x96, 0xAE, 0x74, 0x49, 0x8E, 0x74, 0x98, 0x18, 0x00,
+0xCC, 0x44, 0x14, 0x32, 0x83, 0x34, 0x3B, 0x64, 0x14, 0x67, 0x64, 0x34, 0x9B, 0x71, 0x00, 0xC6,
+0x64, 0x34, 0x52, 0x9B, 0x67, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0D, 0x52, 0x40, 0xC2, 0x4F, 0x7B,
+0x09, 0x05, 0xCB, 0x78, 0x10, 0x1B, 0x78, 0x20, 0x66, 0x33, 0x82, 0x10, 0x78, 0x6D, 0x09, 0x00,
+0xC1, 0x62, 0x09, 0x01, 0x50, 0x42, 0x03, 0x43, 0x4E, 0x44, 0x00, 0x4E, 0x43, 0x42, 0x40, 0x01,
+0xD5, 0xBD, 0x8F, 0x75, 0x9B, 0x50, 0x4C, 0x50, 0x71, 0x2B, 0x42, 0xC9, 0x84, 0x23, 0x35, 0x0C,
+0x77, 0x0C, 0x32, 0x77, 0x0C, 0x35, 0x0C, 0x05, 0xC4, 0x54, 0x98, 0x0E, 0x49, 0x0E, 0x01, 0x70,
+0xC0, 0x54, 0x00, 0x70, 0xC4, 0x8D, 0x54, 0x49, 0x23, 0x0C, 0x00, 0x72, 0x4C, 0x08, 0x72, 0x4C,
+0x63, 0xC2, 0x5A, 0xA7, 0x3B, 0x00, 0xC1, 0x76, 0x94, 0x00, 0xC5, 0x4C, 0x9B, 0xCE, 0x47, 0x12,
+0x00, 0x00, 0x45, 0x42, 0x48, 0x4E, 0x61, 0x43, 0x63, 0x43, 0x42, 0x02, 0x5B, 0x50, 0x49, 0x02,
+0x5B, 0x73, 0xCB, 0xAB, 0x1B, 0x20, 0xAB, 0x10, 0x78, 0x1A, 0x10, 0x20, 0x66, 0x1B, 0x09, 0x01,
+0xDF, 0x62, 0x09, 0x41, 0x7A, 0x13, 0x3D, 0x13, 0x80, 0x8B, 0x6A, 0xD5, 0x6A, 0x71, 0x4C, 0x88,
+0x4C, 0x13, 0x7D, 0x13, 0x7D, 0x65, 0x1F, 0x0F, 0x40, 0x0F, 0x27, 0x5A, 0x22, 0x0F, 0x54, 0x26,
+0x22, 0x44, 0xC5, 0x54, 0x05, 0x1E, 0x0F, 0x27, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x06, 0x71, 0xD6, 0xB2, 0x2E, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x38,
+0x7F, 0x87, 0x38, 0x55, 0xBB, 0xC6, 0x87, 0xC3, 0x55, 0xBB, 0x81, 0x07, 0x01, 0x4D, 0x47, 0x6E,
+0x47, 0x00, 0xC8, 0xA1, 0x1D, 0x69, 0x91, 0x85, 0xA8, 0x91, 0x3C, 0x91, 0x00, 0xCE, 0x69, 0x3C,
+0x91, 0x2F, 0x3C, 0xB3, 0x91, 0x69, 0x40, 0x0B, 0x00, 0x01, 0x03, 0x08, 0x00, 0x00, 0x45, 0x4A,
+0x45, 0x43, 0x4A, 0x43, 0x40, 0x03, 0x44, 0x4A, 0x42, 0x44, 0x42, 0x41, 0x4A, 0x41, 0x40, 0x00,
+0x4A, 0x43, 0x4E, 0x45, 0x43, 0x48, 0x40, 0x01, 0x42, 0x43, 0x42, 0x43, 0x41, 0x44, 0x43, 0x40,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x45, 0x42, 0x4A, 0x43, 0x48, 0x43,
+0x48, 0x42, 0x40, 0x41, 0x40, 0x01, 0x44, 0x48, 0x43, 0x48, 0x43, 0x42, 0x43, 0x45, 0x40, 0x02,
+0x41, 0x40, 0x04, 0x41, 0x4A, 0x45, 0x4A, 0x00, 0x41, 0x48, 0x45, 0x40, 0x00, 0x43, 0x45, 0x48,
+0x45, 0x44, 0x42, 0x40, 0x03, 0x4B, 0x6D, 0x4B, 0x00, 0x40, 0x00, 0x41, 0x43, 0x45, 0x40, 0x00,
+0x42, 0x66, 0x52, 0x71, 0x40, 0x0F, 0x52, 0xC4, 0xB4, 0x2E, 0x0D, 0x2E, 0x07, 0x05, 0xC8, 0x55,
+0x39, 0x38, 0x07, 0x0D, 0x6E, 0x4D, 0x0D, 0x07, 0x06, 0xC6, 0x79, 0xB4, 0x00, 0x0B, 0x00, 0x0B,
+0x00, 0x03, 0x41, 0x40, 0x0B, 0x52, 0x4B, 0x40, 0x71, 0x58, 0x01, 0xC8, 0x98, 0x96, 0xAE, 0x98,
+0xCF, 0x18, 0xE5, 0x98, 0x18, 0x00, 0xC2, 0x67, 0x5E, 0x64, 0x00, 0x74, 0xC5, 0x64, 0x3B, 0x63,
+0x67, 0x3B, 0x52, 0x00, 0x7B, 0xC7, 0x64, 0x3B, 0x34, 0x59, 0x34, 0x5B, 0x3A, 0x00, 0x0D, 0x41,
+0x40, 0x0E, 0x52, 0xC6, 0x4F, 0x15, 0x09, 0x10, 0x09, 0x10, 0x09, 0x00, 0x55, 0xD2, 0x78, 0xA5,
+0x10, 0x78, 0x10, 0x20, 0x1A, 0x1B, 0x72, 0x20, 0x41, 0x10, 0x09, 0x15, 0x09, 0x10, 0x41, 0x10,
+0x02, 0x04, 0x4A, 0x44, 0x42, 0x4A, 0x44, 0x42, 0x41, 0x40, 0x4B, 0x61, 0xD3, 0x6C, 0x9B, 0x50,
+0x6B, 0xAF, 0xB7, 0x4C, 0x0E, 0x42, 0xA6, 0x54, 0x23, 0x35, 0x0C, 0x35, 0x77, 0x0C, 0x77, 0x32,
+0x0C, 0x06, 0x4A, 0x48, 0xCC, 0x49, 0x0A, 0x49, 0x0E, 0x49, 0x30, 0x0A, 0x49, 0x30, 0x4A, 0x0E,
+0x30, 0x0C, 0x0D, 0x75, 0xCB, 0x4A, 0x5A, 0x2B, 0x23, 0x76, 0xD8, 0xC0, 0xAF, 0x7C, 0x76, 0x44,
+0x00, 0x02, 0x45, 0x42, 0x00, 0x4A, 0x44, 0x4E, 0x63, 0x43, 0x42, 0x01, 0xC6, 0xBD, 0x10, 0x09,
+0x97, 0x09, 0x10, 0x09, 0x00, 0x60, 0x5A, 0xC8, 0x41, 0x33, 0x92, 0x10, 0x70, 0x1A, 0x20, 0x72,
+0x10, 0x00, 0x5B, 0x50, 0x49, 0x00, 0x50, 0xC1, 0x41, 0x3D, 0x00, 0x53, 0xDD, 0x7A, 0x3D, 0x13,
+0x64, 0x88, 0xC2, 0x92, 0x4C, 0x6F, 0x56, 0x3D, 0x13, 0x7D, 0x13, 0x3D, 0x3A, 0x1E, 0x0F, 0x1E,
+0x22, 0x0A, 0x22, 0x01, 0x0E, 0x26, 0x22, 0x0F, 0x58, 0x3F, 0x1E, 0x00, 0x4F, 0x40, 0x10, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xD6, 0x07, 0x05, 0x4D,
+0x00, 0xCF, 0x45, 0xDC, 0xB9, 0x55, 0x38, 0xB9, 0x38, 0xB9, 0xB1, 0x39, 0x45, 0x0D, 0x2E, 0x07,
+0x2E, 0x07, 0x03, 0xC8, 0xA1, 0x57, 0x3C, 0x9A, 0x7E, 0xA7, 0xC9, 0xA7, 0xA8, 0x00, 0xC2, 0x69,
+0x3C, 0x91, 0x00, 0xCA, 0x69, 0xB3, 0x91, 0x69, 0xE1, 0x00, 0x0B, 0x00, 0x05, 0x03, 0x00, 0x01,
+0x44, 0x42, 0x43, 0x42, 0x48, 0x41, 0x40, 0x01, 0x41, 0x4E, 0x4A, 0x4E, 0x44, 0x45, 0x40, 0x4A,
+0x40, 0x01, 0x4A, 0x42, 0x48, 0x44, 0x41, 0x43, 0x40, 0x01, 0x44, 0x00, 0x42, 0x44, 0x42, 0x43,
+0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x43, 0x00, 0x48, 0x44,
+0x00, 0x4A, 0x44, 0x42, 0x40, 0x41, 0x40, 0x01, 0x44, 0x00, 0x4A, 0x44, 0x48, 0x41, 0x48, 0x4A,
+0x44, 0x41, 0x40, 0x00, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x43, 0x00, 0x44, 0xC2, 0x53, 0x03, 0x00,
+0x01, 0x42, 0x48, 0x43, 0x00, 0x4E, 0x44, 0x41, 0x40, 0x02, 0x4B, 0x40, 0x03, 0x4A, 0x00, 0x42,
+0x45, 0x42, 0x4E, 0x43, 0xC1, 0x90, 0x00, 0x02, 0x52, 0x0A, 0x40, 0x6D, 0x40, 0xC3, 0xB4, 0x07,
+0x0D, 0x07, 0x04, 0x6E, 0x78, 0xC8, 0xC2, 0x61, 0x55, 0xC3, 0x4D, 0x64, 0x6E, 0x45, 0x0D, 0x00,
+0xC1, 0x79, 0x07, 0x03, 0x6E, 0xC3, 0xB4, 0x00, 0x0B, 0x00, 0x00, 0x6D, 0x40, 0x02, 0x41, 0x40,
+0x0E, 0x71, 0x58, 0x01, 0xC1, 0x74, 0x8C, 0x00, 0xC5, 0x74, 0x8C, 0x74, 0x18, 0x98, 0x18, 0x00,
+0xCC, 0x67, 0x14, 0x3E, 0x9B, 0x34, 0x3E, 0x83, 0x34, 0x64, 0x34, 0x83, 0x64, 0x34, 0x00, 0x7E,
+0x74, 0x7B, 0xC3, 0x5E, 0x14, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x0E, 0x52, 0xC4, 0x4F, 0x62, 0x09,
+0x10, 0x09, 0x03, 0x73, 0xCC, 0x78, 0xE0, 0x9E, 0x10, 0x20, 0x33, 0x1A, 0x66, 0x1A, 0x10, 0x09,
+0x15, 0x09, 0x02, 0x5B, 0x56, 0x42, 0x03, 0x48, 0x44, 0x42, 0x48, 0x44, 0x42, 0x41, 0x40, 0x00,
+0x61, 0xD3, 0x6C, 0x3E, 0x94, 0xD3, 0x12, 0x0B, 0xB8, 0x71, 0x2B, 0x42, 0x54, 0x23, 0x35, 0x77,
+0x35, 0x32, 0x0C, 0x32, 0x77, 0x0C, 0x06, 0xC0, 0x49, 0x00, 0x4E, 0x00, 0xC0, 0x49, 0x00, 0x4E,
+0xC5, 0x98, 0x0E, 0x49, 0x0A, 0x8D, 0x49, 0x00, 0xC1, 0x4A, 0x0C, 0x01, 0xC1, 0xC9, 0x0C, 0x01,
+0xC1, 0xC9, 0x0C, 0x05, 0xCB, 0x4A, 0x54, 0x11, 0x64, 0x65, 0xC0, 0x31, 0x12, 0x4F, 0x56, 0xD4,
+0x00, 0x02, 0x45, 0x42, 0x00, 0x4A, 0x42, 0x43, 0x4E, 0x43, 0x42, 0x02, 0x5B, 0x49, 0x05, 0xC3,
+0x72, 0x66, 0xC4, 0x1A, 0x00, 0xC5, 0x72, 0x1A, 0x66, 0x92, 0x33, 0x09, 0x04, 0xC2, 0x41, 0x3D,
+0x13, 0x00, 0xCC, 0xBE, 0x3D, 0x56, 0xA9, 0x7A, 0x6A, 0xA9, 0x88, 0x6F, 0x65, 0x13, 0x3D, 0x7D,
+0x00, 0x53, 0xC2, 0x4F, 0x40, 0x1E, 0x00, 0x4F, 0xC4, 0x49, 0x22, 0x26, 0x3F, 0x26, 0x00, 0xC0,
+0x58, 0x00, 0x62, 0x4F, 0x01, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x52, 0x40, 0x0E, 0x41, 0x40,
+0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x02, 0x6E, 0x47, 0x6E, 0x4D, 0xC1, 0x46, 0x39, 0x00, 0xC5, 0x45,
+0xDC, 0x39, 0x87, 0x7F, 0x87, 0x00, 0xC1, 0x4D, 0x07, 0x00, 0x6E, 0x47, 0x02, 0xC6, 0xBA, 0x2E,
+0xF2, 0x1D, 0x69, 0x91, 0x7E, 0x01, 0x5D, 0xC7, 0xB3, 0xA8, 0x91, 0xA7, 0xA8, 0x69, 0xA7, 0x7E,
+0x00, 0xC2, 0x57, 0xE1, 0x00, 0x01, 0x41, 0x44, 0x41, 0x45, 0x40, 0x44, 0x45, 0x44, 0x48, 0x00,
+0x41, 0x40, 0x01, 0x42, 0x43, 0x40, 0x48, 0x01, 0x4A, 0x42, 0x40, 0x01, 0x4A, 0x48, 0x00, 0x45,
+0x41, 0x43, 0x40, 0x01, 0x41, 0x4A, 0x48, 0x42, 0x4E, 0x43, 0x42, 0x40, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x41, 0x45, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x00, 0x41,
+0x40, 0x01, 0x67, 0x4B, 0x67, 0x4B, 0x40, 0x41, 0x40, 0x45, 0x00, 0x40, 0x01, 0x41, 0x40, 0x05,
+0x41, 0x45, 0x41, 0x40, 0x5F, 0x41, 0x42, 0xC6, 0x63, 0x04, 0x05, 0x1F, 0x01, 0x0B, 0x05, 0x00,
+0x41, 0x40, 0x04, 0x71, 0x40, 0x01, 0x41, 0x45, 0x4F, 0x41, 0xC1, 0x47, 0x05, 0x00, 0x41, 0x4B,
+0x00, 0x40, 0x01, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0xC5,
+0xC0, 0x00, 0xD6, 0x07, 0xBA, 0x07, 0x01, 0x6E, 0x47, 0x00, 0x4D, 0x47, 0x78, 0xC2, 0x45, 0xC6,
+0x4B, 0x00, 0x78, 0xC2, 0x45, 0x4B, 0x07, 0x03, 0x6E, 0x47, 0x00, 0xC4, 0x79, 0xB4, 0x31, 0x0B,
+0x00, 0x05, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0x00, 0x71, 0xC1, 0x8E, 0x18, 0x0A, 0xC1, 0x44, 0x14,
+0x01, 0xC1, 0x67, 0x14, 0x00, 0xC3, 0x52, 0x14, 0x67, 0x14, 0x00, 0xC1, 0x52, 0x14, 0x04, 0xC1,
+0xB7, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x05, 0x55, 0x50, 0xC8, 0x7B, 0x82,
+0x09, 0x10, 0x09, 0x10, 0x20, 0x82, 0x09, 0x00, 0x55, 0xC1, 0x62, 0x09, 0x00, 0xC3, 0x62, 0x1B,
+0x16, 0x02, 0x09, 0x41, 0x52, 0x40, 0x61, 0xD1, 0x6C, 0x3E, 0x7A, 0x2D, 0x12, 0x0B, 0x8A, 0x71,
+0x2B, 0x42, 0x54, 0x0C, 0x35, 0x77, 0x0C, 0x77, 0x35, 0x0C, 0x00, 0x72, 0x4C, 0x03, 0x72, 0x75,
+0x4C, 0x4E, 0x4C, 0x00, 0xC2, 0x77, 0x0C, 0x23, 0x00, 0x4C, 0x63, 0x00, 0x4C, 0x63, 0x4C, 0x63,
+0x4C, 0x0C, 0x75, 0xC6, 0x8D, 0x84, 0x11, 0x64, 0x65, 0x6B, 0x0B, 0x00, 0xC3, 0x94, 0x56, 0x9D,
+0x00, 0x02, 0x45, 0x42, 0x09, 0x5B, 0xC1, 0x62, 0x09, 0x03, 0x55, 0x49, 0x50, 0x60, 0xC7, 0x7B,
+0x10, 0x7B, 0x15, 0x7B, 0x82, 0x10, 0x09, 0x03, 0xC3, 0x97, 0x41, 0x13, 0x7D, 0x00, 0xC7, 0x80,
+0x13, 0x7D, 0x13, 0x3D, 0x13, 0x7A, 0x13, 0x00, 0xC3, 0x8B, 0x13, 0x7D, 0x13, 0x00, 0xC4, 0x94,
+0x4F, 0x1E, 0x0F, 0x1E, 0x00, 0x62, 0x4F, 0x62, 0x4F, 0x62, 0x02, 0x4F, 0x5E, 0x01, 0x40, 0x10,
+0x41, 0x4B, 0x40, 0x09, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x00, 0x6E, 0x47,
+0x03, 0x6E, 0x4D, 0xC3, 0x45, 0x4B, 0x79, 0x4B, 0x00, 0xC2, 0xC6, 0x4B, 0x45, 0x00, 0xC4, 0xC6,
+0x0D, 0x2E, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0x00, 0x6E, 0xCC, 0xA1, 0x57, 0x2C, 0x3C, 0x57, 0x2C,
+0x3C, 0x2C, 0x3C, 0x1D, 0x69, 0x57, 0x1D, 0x00, 0xC5, 0x57, 0x69, 0x1D, 0x57, 0xE1, 0x00, 0x02,
+0x41, 0x40, 0x41, 0x40, 0x41, 0x00, 0x40, 0x45, 0x41, 0x40, 0x02, 0x41, 0x00, 0x40, 0x41, 0x00,
+0x45, 0x41, 0x00, 0x44, 0x01, 0x45, 0x00, 0x41, 0x40, 0x00, 0x41, 0x45, 0x43, 0x44, 0x42, 0x41,
+0x02, 0x45, 0x41, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x0B, 0x45, 0xC3, 0xAA, 0x02, 0x01, 0x00, 0x29, 0xC2, 0xB4, 0x07, 0x0D,
+0x00, 0x47, 0x00, 0x4D, 0x47, 0x01, 0x4D, 0x00, 0x47, 0x00, 0x4D, 0x00, 0x47, 0x00, 0x4D, 0x47,
+0x4D, 0x47, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0F, 0xC0,
+0xAE, 0x02, 0x58, 0xC3, 0xAE, 0x18, 0xAE, 0x18, 0x00, 0xC1, 0xAE, 0x18, 0x00, 0xC2, 0xB6, 0x14,
+0x67, 0x04, 0x54, 0xC0, 0x67, 0x04, 0xC5, 0x5B, 0xCE, 0x67, 0x5B, 0x25, 0x00, 0x0D, 0x41, 0x40,
+0x0F, 0xC1, 0x4F, 0x15, 0x00, 0x5B, 0x00, 0x55, 0x5B, 0x49, 0x5B, 0x00, 0xC1, 0x41, 0x1B, 0x01,
+0xC3, 0x41, 0x1B, 0x41, 0x1B, 0x01, 0xCA, 0x41, 0x1B, 0x15, 0x1B, 0x09, 0x41, 0x1B, 0x29, 0xAA,
+0x21, 0x02, 0x01, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x40, 0x52, 0x40, 0x45, 0xC8, 0x8F, 0x34,
+0x76, 0x6B, 0xAF, 0x7C, 0x51, 0x64, 0x2B, 0x00, 0xC7, 0x54, 0x23, 0x35, 0x77, 0x35, 0x0C, 0x32,
+0x0C, 0x06, 0xC1, 0x77, 0x0C, 0x04, 0x75, 0xC0, 0x77, 0x03, 0x4C, 0x03, 0x72, 0x4C, 0x01, 0x72,
+0x4C, 0x06, 0x72, 0xCB, 0x54, 0xA7, 0x11, 0x3B, 0x52, 0x7C, 0xE9, 0x6B, 0x65, 0x76, 0x9D, 0x00,
+0x02, 0x41, 0x42, 0x02, 0x45, 0x42, 0x45, 0x42, 0x00, 0x45, 0x42, 0x5B, 0x55, 0xC7, 0x41, 0x09,
+0x1B, 0x15, 0x41, 0x15, 0x41, 0x1B, 0x06, 0x55, 0x5B, 0x00, 0x55, 0x5B, 0x55, 0x49, 0xC1, 0x41,
+0x3D, 0x00, 0xC0, 0x8B, 0x00, 0xD1, 0x80, 0x3D, 0x80, 0x8B, 0xDF, 0xBE, 0xDF, 0x3D, 0xBE, 0x94,
+0xBE, 0x8B, 0x3D, 0xD4, 0x01, 0x12, 0x1E, 0x27, 0x00, 0xC5, 0xD9, 0x1E, 0xD9, 0x1E, 0xD9, 0x27,
+0x01, 0x5E, 0x67, 0x01, 0x40, 0x10, 0x41, 0x40, 0x0A, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x07,
+0xC1, 0xD6, 0x07, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x00, 0x4D,
+0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x47, 0xC3, 0xF2,
+0x3C, 0x1D, 0x2C, 0x00, 0x5D, 0x6C, 0x04, 0x5D, 0x6C, 0x00, 0x5D, 0x01, 0xC1, 0x93, 0x00, 0x17,
+0x45, 0x61, 0x45, 0x40, 0x04, 0x41, 0x45, 0x00, 0x41, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x43, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01, 0x44, 0x43, 0x02, 0x44, 0x43, 0x01,
+0x44, 0x43, 0x00, 0x44, 0x43, 0x01, 0x44, 0x43, 0x02, 0x44, 0x43, 0x00, 0xC7, 0x51, 0x36, 0x03,
+0x51, 0x03, 0x36, 0x51, 0x03, 0x00, 0x44, 0x02, 0x43, 0x00, 0xC2, 0x51, 0x36, 0x03, 0x00, 0xC2,
+0x51, 0x36, 0x03, 0x00, 0xC2, 0x51, 0x03, 0x59, 0x02, 0x44, 0x43, 0x00, 0xC2, 0x51, 0x36, 0x03,
+0x00, 0xD6, 0x51, 0x03, 0x51, 0x36, 0x26, 0x60, 0x26, 0x60, 0x26, 0x60, 0x26, 0x60, 0x26, 0x60,
+0x26, 0x60, 0x26, 0x03, 0x26, 0x60, 0x76, 0x39, 0x6E, 0x10, 0xC1, 0x61, 0x6E, 0x05, 0xC5, 0x76,
+0x60, 0x44, 0x03, 0x63, 0x03, 0x00, 0x76, 0xC1, 0x51, 0x03, 0x00, 0x76, 0xC2, 0x51, 0x36, 0x03,
+0x00, 0xC2, 0x51, 0x36, 0x03, 0x00, 0xC6, 0x51, 0x36, 0x03, 0x51, 0x03, 0x63, 0x03, 0x00, 0x48,
+0xC0, 0x74, 0x06, 0xC1, 0x6D, 0x74, 0x01, 0x4A, 0x74, 0x00, 0x7E, 0x74, 0x00, 0x7E, 0x74, 0x7E,
+0x74, 0x7E, 0x74, 0x7E, 0x74, 0x7E, 0x74, 0x7E, 0x00, 0x74, 0x66, 0x44, 0x43, 0x01, 0x44, 0x43,
+0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x02, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01,
+0x44, 0x43, 0x01, 0xC4, 0x63, 0x6D, 0x1A, 0x33, 0x1A, 0x16, 0xC1, 0x86, 0x0A, 0x01, 0x48, 0x4A,
+0x04, 0xCC, 0x58, 0x51, 0x36, 0x03, 0xC5, 0x8F, 0x11, 0x3E, 0x4C, 0x65, 0x56, 0xA9, 0x2B, 0x00,
+0xC6, 0x42, 0x54, 0x23, 0x35, 0x0C, 0x35, 0x77, 0x00, 0x75, 0x4C, 0x72, 0x4C, 0x72, 0x63, 0xC7,
+0x4A, 0x0C, 0x23, 0x54, 0x23, 0x0C, 0x23, 0x0C, 0x00, 0xC5, 0x8D, 0x4A, 0x0C, 0x4A, 0x0C, 0x23,
+0x00, 0x75, 0x4C, 0x00, 0xC2, 0x8D, 0x23, 0x0C, 0x00, 0x63, 0x4C, 0x07, 0x75, 0xCC, 0x4A, 0xA7,
+0x2A, 0x11, 0x3B, 0x50, 0x94, 0x65, 0x76, 0x9B, 0x3E, 0x36, 0x03, 0x00, 0x44, 0x48, 0x00, 0x4A,
+0x48, 0x4A, 0x05, 0xC4, 0x86, 0x70, 0x1A, 0x33, 0x1A, 0x14, 0xC6, 0x6A, 0x70, 0x6F, 0x70, 0x6A,
+0x71, 0x6A, 0x00, 0xC3, 0x71, 0x6A, 0x71, 0x6A, 0x00, 0xCE, 0x71, 0x6A, 0x70, 0x6A, 0x53, 0x08,
+0x30, 0x03, 0x26, 0x74, 0x26, 0x03, 0x26, 0x03, 0x26, 0x00, 0x43, 0x66, 0xD5, 0x74, 0x26, 0x03,
+0x26, 0x50, 0x26, 0x50, 0x26, 0x50, 0x26, 0x50, 0x26, 0x50, 0x26, 0x50, 0x26, 0x50, 0x26, 0x50,
+0x26, 0x50, 0x03, 0x00, 0xCE, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96,
+0x03, 0x6D, 0x96, 0x03, 0x02, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x02, 0x44, 0x43,
+0x01, 0xC7, 0x63, 0x51, 0x63, 0x03, 0x96, 0x4E, 0x39, 0x6E, 0x04, 0xC1, 0x4E, 0x6E, 0x03, 0xC1,
+0x61, 0x6E, 0x01, 0xC1, 0x61, 0x6E, 0x07, 0x79, 0xC2, 0x6E, 0x86, 0x85, 0x01, 0xC1, 0xA8, 0x85,
+0x00, 0xC1, 0xA8, 0x85, 0x07, 0xC4, 0xA7, 0x26, 0x51, 0x44, 0x03, 0x01, 0x44, 0x43, 0x01, 0x44,
+0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x44, 0x00, 0x43,
+0x44, 0x43, 0x01, 0xC7, 0x44, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x00, 0x44, 0x43, 0x02,
+0x44, 0x43, 0x44, 0x43, 0x01, 0x44, 0x43, 0x04, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x42, 0x41,
+0x44, 0x45, 0x61, 0x45, 0x06, 0x42, 0x45, 0x0D, 0x42, 0x45, 0x19, 0xC3, 0xAA, 0x3A, 0x6C, 0x2B,
+0x00, 0x42, 0x45, 0x08, 0xC2, 0x90, 0x3C, 0x69, 0x0D, 0x54, 0xC0, 0x45, 0x19, 0xC3, 0xF5, 0xAA,
+0x21, 0x05, 0x05, 0x42, 0x45, 0x0E, 0xC0, 0xAA, 0x00, 0x45, 0x09, 0xC3, 0xAA, 0x63, 0x5E, 0x52,
+0x0F, 0x42, 0x45, 0x0D, 0x42, 0x45, 0x0F, 0x56, 0xC0, 0x82, 0x00, 0x60, 0x04, 0xC9, 0x7B, 0x82,
+0x20, 0x82, 0x7B, 0x82, 0x20, 0x82, 0x7B, 0x20, 0x01, 0xC2, 0xA5, 0x7B, 0x20, 0x00, 0xC1, 0x82,
+0x51, 0x00, 0x44, 0x76, 0x43, 0x44, 0x43, 0x44, 0x01, 0x43, 0x44, 0x00, 0x42, 0x45, 0x5F, 0xCF,
+0x90, 0xD1, 0x75, 0x11, 0x3B, 0x34, 0x64, 0x42, 0x2A, 0xA7, 0x32, 0x4A, 0x23, 0x35, 0x77, 0x0C,
+0x00, 0x72, 0x4C, 0x00, 0xC1, 0x77, 0x0C, 0x00, 0xD9, 0x54, 0x49, 0x8D, 0x23, 0x30, 0x23, 0x0C,
+0x49, 0x23, 0x0E, 0x49, 0x0A, 0x23, 0x98, 0x0E, 0x0A, 0x49, 0x23, 0x49, 0x4A, 0x54, 0x49, 0x23,
+0x0C, 0x54, 0x0C, 0x01, 0xC1, 0xC9, 0x0C, 0x03, 0x75, 0xC2, 0x8D, 0x54, 0xA7, 0x00, 0x51, 0x00,
+0xC0, 0x9B, 0x00, 0x51, 0xC4, 0x8F, 0x59, 0x3A, 0xAA, 0x05, 0x00, 0x42, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x03, 0x76, 0x44, 0x60, 0x06, 0xC3, 0x7B, 0x20, 0x7B, 0x20, 0x00, 0xC3, 0x7B, 0x20, 0x7B,
+0x20, 0x03, 0xCA, 0xA5, 0x20, 0x7B, 0xAD, 0x44, 0x63, 0x03, 0x36, 0x03, 0x04, 0x03, 0x00, 0x44,
+0x43, 0xC0, 0x51, 0x01, 0x43, 0xC6, 0x96, 0x03, 0x44, 0x04, 0x02, 0x1F, 0x05, 0x0C, 0xC1, 0x44,
+0x52, 0x0F, 0xC2, 0xC7, 0x16, 0x8C, 0x0A, 0x69, 0xC1, 0xAA, 0x05, 0x0E, 0x42, 0x45, 0x06, 0x62,
+0xC1, 0x7D, 0x45, 0x18, 0xC1, 0x46, 0x45, 0x00, 0xC1, 0xDC, 0x05, 0x00, 0x5F, 0x45, 0x01, 0x5F,
+0x45, 0x7A, 0x45, 0x7A, 0x45, 0x7A, 0x45, 0x01, 0xC3, 0x93, 0x05, 0xAA, 0x05, 0x2A, 0x42, 0x45,
+0x07, 0x42, 0x45, 0x09, 0x42, 0x45, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A,
+0xC4, 0xD3, 0xC2, 0x6C, 0x3A, 0x00, 0x09, 0x41, 0xC1, 0xB3, 0x2C, 0x02, 0x5D, 0x6C, 0x00, 0x5D,
+0x01, 0x6C, 0x00, 0x5D, 0x6C, 0xC2, 0x57, 0xA1, 0x07, 0x0A, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x09,
+0xC1, 0xB4, 0x00, 0x01, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x0E, 0x4B, 0x52, 0x40, 0x0A, 0xC2, 0x67,
+0x14, 0x5B, 0x00, 0x54, 0xC5, 0x5B, 0x14, 0x5B, 0x14, 0x5B, 0x14, 0x00, 0xC2, 0x67, 0x14, 0x5B,
+0x00, 0xC1, 0xCE, 0x14, 0x00, 0x65, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC5, 0x4F, 0x09, 0x15, 0x09,
+0x41, 0x09, 0x01, 0xC1, 0x41, 0x09, 0x00, 0x55, 0x49, 0x00, 0x55, 0x00, 0x49, 0x00, 0x5B, 0x49,
+0x01, 0x55, 0x49, 0x01, 0x50, 0x69, 0x42, 0x69, 0x42, 0x04, 0x45, 0x42, 0x00, 0xC1, 0x47, 0x00,
+0x00, 0x61, 0xC3, 0x8F, 0x5C, 0x75, 0x2A, 0x00, 0x51, 0x6F, 0xC5, 0x9A, 0x26, 0x5A, 0x85, 0x32,
+0x35, 0x00, 0xCA, 0x77, 0x32, 0x77, 0x35, 0x0C, 0x32, 0x77, 0x23, 0x49, 0x0C, 0x23, 0x00, 0xC4,
+0x54, 0x0C, 0x23, 0x96, 0x0E, 0x00, 0x4A, 0xC8, 0x49, 0x23, 0x0E, 0x8D, 0x0A, 0x49, 0x23, 0x49,
+0x8D, 0x00, 0xC1, 0x54, 0x23, 0x00, 0xC1, 0x49, 0x0C, 0x04, 0xC1, 0x77, 0x0C, 0x00, 0x75, 0xC5,
+0x4A, 0x59, 0x89, 0x9A, 0x4A, 0x5C, 0x00, 0x51, 0x6F, 0xC2, 0xBC, 0xA4, 0x00, 0x02, 0x45, 0x42,
+0x09, 0x5B, 0x49, 0x03, 0xC1, 0x41, 0x09, 0x01, 0xC1, 0x41, 0x15, 0x01, 0x5B, 0x49, 0x55, 0x5B,
+0x55, 0x49, 0x02, 0x50, 0x5B, 0x69, 0x42, 0x68, 0x42, 0x68, 0x42, 0x68, 0x00, 0x42, 0x45, 0x42,
+0x61, 0xC2, 0xAA, 0x02, 0x28, 0x00, 0x42, 0x00, 0x41, 0x40, 0x0D, 0xC1, 0xB6, 0x14, 0x05, 0xC1,
+0x5B, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x00, 0xC2, 0x5B, 0x1F, 0x18, 0x0A,
+0xC1, 0xDA, 0x00, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07, 0x0C, 0x4D, 0x47, 0x01, 0x4D, 0x47,
+0x08, 0xC1, 0x81, 0x0B, 0x00, 0x40, 0x02, 0x4B, 0x40, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x31, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x71, 0x45, 0x41, 0x71, 0x41, 0x40, 0x71,
+0x52, 0x00, 0x41, 0x40, 0x03, 0xC5, 0x47, 0x01, 0x12, 0x31, 0x12, 0x00, 0x03, 0x41, 0x40, 0x05,
+0x41, 0x45, 0x41, 0x4B, 0x45, 0x41, 0x4B, 0x67, 0x41, 0x40, 0x45, 0x41, 0x40, 0x07, 0x6D, 0xD0,
+0xC7, 0xF1, 0x0B, 0x31, 0x2D, 0x05, 0x47, 0x00, 0x12, 0x0B, 0x31, 0x12, 0x00, 0x47, 0x12, 0xB3,
+0x2C, 0x00, 0x7C, 0x6C, 0x7C, 0x5D, 0x6C, 0xC6, 0x57, 0x3C, 0x1D, 0x57, 0x2C, 0x3C, 0x2C, 0x00,
+0xC1, 0xA1, 0x07, 0x00, 0x4D, 0x00, 0x47, 0x00, 0x78, 0xC8, 0xC6, 0x4B, 0x0D, 0x07, 0x0D, 0x38,
+0x0D, 0x2E, 0x07, 0x0A, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x67, 0xC1, 0x47, 0x00, 0x0A,
+0xC1, 0x67, 0x14, 0x01, 0xC1, 0x5B, 0x14, 0x00, 0xC2, 0x67, 0x52, 0x14, 0x00, 0xC5, 0x5B, 0x52,
+0x14, 0x5B, 0x52, 0x14, 0x01, 0x7A, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10,
+0x09, 0x03, 0x55, 0xC2, 0x7B, 0x82, 0x15, 0x00, 0x5B, 0x49, 0x00, 0x55, 0x50, 0x49, 0x01, 0x55,
+0x49, 0x01, 0x5B, 0x42, 0x07, 0x44, 0x42, 0x00, 0x52, 0x40, 0x00, 0x61, 0xC3, 0x84, 0x5F, 0x75,
+0x2A, 0x00, 0x6F, 0x00, 0xC5, 0xA4, 0x26, 0x23, 0x26, 0x0C, 0x35, 0x00, 0x72, 0xC5, 0x77, 0x0C,
+0x32, 0x0C, 0x77, 0x0C, 0x00, 0xC6, 0x54, 0x49, 0x23, 0x0C, 0x54, 0x0C, 0x0E, 0x00, 0xD1, 0x49,
+0x0E, 0x49, 0x0A, 0x23, 0x0E, 0x8D, 0x0A, 0x49, 0x0C, 0x0E, 0x4A, 0x26, 0x0E, 0x23, 0x30, 0x0E,
+0x0C, 0x06, 0x72, 0x75, 0xCB, 0x54, 0x36, 0x4A, 0x36, 0xA4, 0x5C, 0x11, 0x3B, 0x11, 0x8F, 0x95,
+0x00, 0x02, 0x45, 0x42, 0x03, 0x44, 0x42, 0x03, 0x5B, 0x50, 0x49, 0x03, 0x55, 0xC3, 0x41, 0x20,
+0x10, 0x15, 0x00, 0xC4, 0x82, 0x10, 0x09, 0x20, 0x15, 0x00, 0x49, 0xC1, 0x97, 0x09, 0x01, 0x5B,
+0x5C, 0x42, 0x05, 0x44, 0x00, 0x5C, 0xC4, 0x44, 0x04, 0x02, 0x28, 0x02, 0x01, 0x41, 0x40, 0x0C,
+0x4B, 0xC5, 0xC5, 0x5B, 0x14, 0x5B, 0x52, 0x14, 0x00, 0xC2, 0x5B, 0x52, 0x14, 0x00, 0xC1, 0x52,
+0x14, 0x00, 0xC3, 0x67, 0x52, 0x14, 0x5B, 0x00, 0xC1, 0x8E, 0x18, 0x01, 0xC2, 0xAE, 0xDA, 0x18,
+0x00, 0xC2, 0xAE, 0x8E, 0x18, 0x02, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x06, 0xCD,
+0x79, 0x0D, 0x45, 0x38, 0x0D, 0x79, 0x4B, 0x45, 0x0D, 0x4B, 0x45, 0x79, 0x2E, 0x07, 0x00, 0x4D,
+0x47, 0x01, 0x4D, 0x47, 0xC1, 0x81, 0x00, 0x13, 0x41, 0x40, 0x45, 0x41, 0x40, 0x00, 0x41, 0x45,
+0x40, 0x0A, 0x41, 0x45, 0x5F, 0x40, 0x41, 0x00, 0x40, 0x02, 0x41, 0x00, 0x40, 0x41, 0x45, 0x40,
+0x05, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x45,
+0x00, 0x40, 0x41, 0x40, 0x41, 0x67, 0x40, 0x00, 0x65, 0x40, 0x42, 0x40, 0x43, 0x02, 0x4A, 0x40,
+0x4A, 0x42, 0x40, 0x41, 0x40, 0x03, 0xC5, 0xAA, 0x0E, 0x00, 0x6D, 0x03, 0x00, 0x03, 0x41, 0x40,
+0x04, 0x41, 0x4E, 0x43, 0x48, 0x5C, 0x4A, 0x43, 0x4B, 0x40, 0x00, 0x42, 0x4A, 0x43, 0x41, 0x4A,
+0x43, 0x40, 0x03, 0x71, 0x4B, 0xC1, 0xD3, 0x2D, 0x00, 0x40, 0x43, 0xC6, 0x53, 0x30, 0x31, 0x00,
+0x44, 0x0A, 0x00, 0x01, 0x6D, 0xCD, 0xB3, 0x2C, 0x3C, 0xC9, 0x3C, 0xA8, 0x91, 0xBF, 0x91, 0x54,
+0x9A, 0x7E, 0x69, 0x1D, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x01, 0x4D, 0x47, 0x4D, 0x79, 0xC0, 0x87,
+0x00, 0xC5, 0x4B, 0x38, 0x4D, 0xBB, 0x0D, 0x07, 0x0A, 0x6E, 0xC5, 0xB4, 0x00, 0x0B, 0x00, 0x2D,
+0x00, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0xC6, 0x67, 0x52, 0xC2, 0x59, 0xA9, 0x3B, 0x34,
+0x00, 0x7E, 0xCB, 0x64, 0x52, 0x34, 0x9B, 0x64, 0x52, 0x34, 0x64, 0xC7, 0x14, 0x3A, 0x00, 0x0D,
+0x41, 0x40, 0x0F, 0xC1, 0x4F, 0x09, 0x04, 0x50, 0xCD, 0x41, 0x33, 0x78, 0xAB, 0x1A, 0x10, 0x66,
+0x33, 0x10, 0x78, 0x1A, 0x1B, 0x10, 0x09, 0x03, 0x50, 0x5C, 0x42, 0x02, 0x43, 0x4E, 0x44, 0x4A,
+0x4E, 0x4A, 0x42, 0x67, 0x4B, 0x40, 0x7A, 0xC3, 0x8F, 0x75, 0x11, 0x3B, 0x00, 0xCF, 0x64, 0x32,
+0x42, 0xB0, 0x36, 0x60, 0x32, 0x35, 0x77, 0x0C, 0x77, 0x32, 0x77, 0x0C, 0x32, 0x0C, 0x00, 0x63,
+0x01, 0x4C, 0x01, 0x63, 0x75, 0x4C, 0x00, 0x63, 0x00, 0xC1, 0x77, 0x0C, 0x00, 0x63, 0x4C, 0x02,
+0x63, 0x00, 0x4C, 0x63, 0x4C, 0x08, 0x75, 0x63, 0x7F, 0xC9, 0xA4, 0x89, 0x4A, 0x3B, 0x3E, 0x53,
+0x9B, 0x11, 0x63, 0x00, 0x02, 0x45, 0x42, 0x48, 0x4E, 0x42, 0x4E, 0x00, 0x43, 0x42, 0x02, 0x5B,
+0x49, 0x04, 0x50, 0xCB, 0x78, 0x1A, 0x78, 0x20, 0xCF, 0x78, 0x33, 0x72, 0x66, 0x33, 0x1B, 0x09,
+0x02, 0xC2, 0xA5, 0x1B, 0x02, 0x02, 0x4E, 0x42, 0x00, 0x4E, 0x4A, 0x48, 0xC5, 0x59, 0x0E, 0x0A,
+0x49, 0x28, 0x02, 0x01, 0x41, 0x40, 0x0C, 0x4B, 0x5C, 0x54, 0xC1, 0x67, 0x34, 0x00, 0xC2, 0x64,
+0x52, 0x34, 0x00, 0xC4, 0x64, 0x34, 0x52, 0x3E, 0x34, 0x00, 0x7B, 0xC4, 0x71, 0x67, 0x14, 0x8E,
+0x18, 0x00, 0xC8, 0x8E, 0x8C, 0xAD, 0x8E, 0x28, 0x8C, 0xCF, 0x8E, 0x18, 0x00, 0xC2, 0xAE, 0x31,
+0x00, 0x0E, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0x6E, 0x4D, 0xCD, 0x7F, 0x87, 0xBB, 0x45,
+0xDC, 0x39, 0x87, 0x46, 0x6E, 0x87, 0x7F, 0x0D, 0x2E, 0x07, 0x00, 0x4D, 0x47, 0x01, 0x6E, 0xC1,
+0x81, 0x00, 0x14, 0x48, 0x00, 0x43, 0x40, 0x45, 0x48, 0x00, 0x45, 0x40, 0x09, 0xC1, 0x59, 0x08,
+0x00, 0x42, 0x48, 0x00, 0x41, 0x40, 0x00, 0x41, 0x4A, 0x48, 0x42, 0x48, 0x00, 0x45, 0x40, 0x04,
+0x41, 0x40, 0x00, 0x45, 0x4E, 0x41, 0x43, 0x48, 0x40, 0x00, 0x41, 0x40, 0x00, 0x42, 0x43, 0x48,
+0x42, 0x4E, 0x4B, 0x43, 0x48, 0x40, 0x00, 0x41, 0x40, 0x45, 0x40, 0x43, 0x48, 0x42, 0x44, 0x4E,
+0x5F, 0xC4, 0x92, 0x3F, 0x00, 0x01, 0x00, 0x01, 0x52, 0x40, 0xC5, 0xAA, 0x0E, 0x28, 0x08, 0x03,
+0x00, 0x03, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x43, 0x4A, 0x00, 0x65, 0x48, 0x45, 0x40, 0x00, 0x48,
+0x45, 0x43, 0x42, 0x43, 0x00, 0x40, 0x05, 0x4B, 0x00, 0x40, 0x00, 0x45, 0x41, 0x4A, 0x71, 0x6D,
+0x44, 0x4A, 0x40, 0x00, 0xCC, 0x47, 0x12, 0xB3, 0x57, 0xA4, 0xC9, 0xA8, 0x7E, 0x54, 0x91, 0x3C,
+0x1D, 0x91, 0x00, 0xC2, 0xBF, 0x1D, 0x2C, 0x00, 0xC1, 0xA1, 0x07, 0x00, 0x4D, 0x00, 0x47, 0x00,
+0xC8, 0x45, 0xDC, 0xBB, 0xC6, 0x38, 0x7F, 0xBB, 0x79, 0x07, 0x0B, 0xC1, 0xB4, 0x00, 0x07, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0xC9, 0x67, 0x14, 0xC2, 0x3E, 0x34, 0x64, 0x34, 0x3E, 0x64, 0x3E,
+0x00, 0x74, 0xC8, 0x67, 0x52, 0x32, 0x34, 0x59, 0x9B, 0x5B, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0F,
+0xC4, 0x4F, 0x7B, 0x09, 0x10, 0x09, 0x03, 0xCE, 0x78, 0x10, 0x1B, 0x78, 0x20, 0x66, 0x33, 0x10,
+0x78, 0x1A, 0x41, 0x10, 0x09, 0x15, 0x09, 0x00, 0xC2, 0x62, 0x1B, 0x02, 0x03, 0x43, 0x4E, 0x44,
+0x01, 0x4E, 0x42, 0x41, 0x40, 0x00, 0xCD, 0xBD, 0xD1, 0x11, 0x34, 0x44, 0x9D, 0x16, 0x52, 0x2B,
+0x2A, 0x2F, 0x5A, 0x23, 0x35, 0x00, 0x4C, 0x75, 0x4C, 0xC3, 0x77, 0x32, 0x77, 0x0C, 0x03, 0x75,
+0x4C, 0x0D, 0x75, 0x4C, 0x01, 0x75, 0x4C, 0x06, 0x72, 0x4C, 0x75, 0xC1, 0x8D, 0x9A, 0x00, 0x7B,
+0x00, 0xC6, 0x9D, 0xD8, 0x7C, 0x9D, 0x71, 0xCE, 0x00, 0x02, 0x45, 0x42, 0x48, 0x4E, 0x42, 0x44,
+0x4E, 0x43, 0x42, 0x02, 0x5B, 0xC2, 0x7B, 0x97, 0x09, 0x01, 0x55, 0xCD, 0x99, 0x72, 0x1B, 0x20,
+0xAB, 0x10, 0x20, 0x66, 0x72, 0x10, 0x78, 0x1B, 0x97, 0x09, 0x02, 0x50, 0x42, 0x02, 0x4E, 0x44,
+0x42, 0x4E, 0x00, 0x43, 0xC5, 0x50, 0x53, 0x05, 0x0E, 0x04, 0x02, 0x01, 0x45, 0x40, 0x08, 0x4B,
+0x40, 0x02, 0xC3, 0xE4, 0x14, 0x5B, 0x34, 0x01, 0x7E, 0x74, 0xCB, 0x67, 0x14, 0x34, 0x3B, 0x64,
+0xCE, 0x64, 0x52, 0x9B, 0x67, 0x14, 0x18, 0x01, 0xC4, 0x8E, 0xCF, 0xAD, 0x0E, 0x96, 0x00, 0xC2,
+0x98, 0x8E, 0x18, 0x01, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x4D, 0x47,
+0xCE, 0xC6, 0x38, 0xB9, 0x46, 0x45, 0x61, 0x38, 0x87, 0xC3, 0x39, 0x87, 0x0D, 0x2E, 0x07, 0x0D,
+0x00, 0x47, 0x00, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x11, 0x41, 0x40, 0x45, 0x00, 0x48, 0x41,
+0x40, 0x45, 0x4A, 0x42, 0x40, 0x09, 0x4A, 0x48, 0x4A, 0x48, 0x42, 0x44, 0x00, 0x40, 0x00, 0x42,
+0x44, 0x42, 0x43, 0x41, 0x4A, 0x42, 0x40, 0x04, 0x41, 0x40, 0x00, 0x45, 0x4E, 0x42, 0x43, 0x48,
+0x40, 0x00, 0x41, 0x40, 0x00, 0x44, 0x48, 0x44, 0x42, 0x4E, 0x42, 0x48, 0x43, 0x40, 0x00, 0x65,
+0x40, 0x42, 0x40, 0x42, 0xC4, 0xAA, 0x0A, 0x6D, 0x26, 0x08, 0x00, 0x42, 0x40, 0x41, 0x40, 0x03,
+0x69, 0x48, 0x00, 0xC2, 0x74, 0x04, 0x00, 0x03, 0x41, 0x40, 0x04, 0x41, 0x4E, 0x41, 0x4A, 0x00,
+0x41, 0x48, 0x41, 0x00, 0x40, 0x43, 0x45, 0x48, 0x41, 0x42, 0x44, 0x40, 0x09, 0xC3, 0x4F, 0x26,
+0x1F, 0x00, 0x00, 0x4B, 0xCA, 0x6D, 0x00, 0x12, 0x00, 0x2D, 0xB3, 0x57, 0x3C, 0x91, 0x7E, 0x91,
+0x00, 0xC1, 0x7E, 0x3C, 0x00, 0xC3, 0xA7, 0x91, 0x69, 0x1D, 0x00, 0xC2, 0x57, 0xA1, 0x07, 0x02,
+0x4D, 0x00, 0xC8, 0x45, 0xEC, 0xDC, 0x07, 0x79, 0x81, 0x39, 0x38, 0x07, 0x0A, 0x6E, 0xC5, 0xB4,
+0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x09, 0x52, 0xC3, 0xB6, 0x52,
+0x3B, 0x64, 0x02, 0xC2, 0x59, 0x52, 0x3B, 0x00, 0x74, 0xC8, 0x67, 0x83, 0x3B, 0x34, 0x59, 0x9C,
+0x14, 0x25, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0xCD, 0x78, 0xA5, 0x10,
+0x72, 0x10, 0x20, 0x1A, 0x1B, 0x20, 0x1A, 0x1B, 0x09, 0x10, 0x09, 0x02, 0x50, 0x5C, 0x42, 0x03,
+0x4A, 0x44, 0x00, 0x4A, 0x42, 0x00, 0x41, 0x40, 0x00, 0x7A, 0xCE, 0x8F, 0x9B, 0x50, 0x6B, 0xC0,
+0xD8, 0xB8, 0x34, 0x2A, 0x42, 0x54, 0x23, 0x77, 0x35, 0x77, 0x00, 0x72, 0x4C, 0x01, 0x72, 0x4C,
+0x01, 0x72, 0x4C, 0x08, 0x72, 0x4C, 0x01, 0x72, 0x4C, 0x0E, 0x75, 0xCB, 0x8D, 0xA7, 0x2A, 0x3B,
+0x50, 0xD8, 0xE9, 0x47, 0x7C, 0x5B, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4E, 0x42, 0x44, 0x43,
+0x4A, 0x42, 0x02, 0x5B, 0x49, 0x03, 0xC4, 0x41, 0x82, 0xAB, 0x1B, 0x1A, 0x00, 0xC9, 0x99, 0x1A,
+0x20, 0x78, 0xA5, 0xCF, 0x15, 0x09, 0x97, 0x09, 0x00, 0x50, 0x5B, 0x42, 0x01, 0x69, 0x4E, 0x42,
+0x00, 0x4E, 0x44, 0x42, 0x48, 0xC4, 0x59, 0x28, 0x0E, 0x04, 0x02, 0x01, 0x41, 0x40, 0x0C, 0x4B,
+0x5C, 0x54, 0x00, 0xC0, 0x52, 0x00, 0xC6, 0x9C, 0x3B, 0x34, 0x67, 0x52, 0x34, 0x3B, 0x00, 0x7E,
+0xC6, 0x9B, 0x52, 0x34, 0x14, 0x67, 0x8E, 0x18, 0x00, 0xC8, 0x8C, 0x74, 0x18, 0x8D, 0x8C, 0x18,
+0x98, 0x8E, 0x18, 0x01, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x07, 0xCC, 0xDC,
+0x39, 0x55, 0x0D, 0x45, 0x87, 0x45, 0xBB, 0xC3, 0x55, 0xB9, 0x79, 0x07, 0x01, 0x4D, 0x47, 0x01,
+0x6E, 0xC1, 0x81, 0x00, 0x14, 0x45, 0x43, 0x41, 0x40, 0x41, 0x45, 0x44, 0x00, 0x40, 0x09, 0xC7,
+0x53, 0x02, 0x03, 0x0E, 0x02, 0x1C, 0x04, 0x00, 0x00, 0x42, 0x43, 0x42, 0x43, 0x45, 0x42, 0x43,
+0x40, 0x04, 0x41, 0x40, 0x00, 0x45, 0x48, 0x00, 0x43, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x42,
+0x45, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x40, 0x00, 0x41, 0x40, 0x42, 0x40, 0x43, 0x48, 0xC1,
+0x6D, 0x04, 0x00, 0xC5, 0x49, 0x16, 0x28, 0x12, 0x01, 0x00, 0x03, 0xC3, 0xAA, 0x04, 0x08, 0x04,
+0x00, 0x40, 0x03, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x43, 0x00, 0x42, 0x4A, 0x43, 0x40, 0x01, 0x42,
+0x4A, 0x43, 0x40, 0x45, 0x44, 0x40, 0x05, 0x52, 0x40, 0x01, 0x4A, 0x00, 0x44, 0x45, 0x41, 0x00,
+0x43, 0x52, 0x40, 0xCB, 0x47, 0x12, 0xB3, 0x2C, 0x3C, 0x7E, 0x91, 0x7E, 0xBF, 0x69, 0x91, 0xC9,
+0x00, 0xC6, 0xA8, 0x91, 0x7E, 0x57, 0x2C, 0xA1, 0x07, 0x01, 0x4D, 0x47, 0xC9, 0x81, 0xBB, 0xA9,
+0x6E, 0xC6, 0x4B, 0x38, 0x39, 0x0D, 0x07, 0x0B, 0xC1, 0xB4, 0x00, 0x02, 0x52, 0x40, 0x02, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0xC2, 0x67, 0x14, 0x34, 0x01, 0x7E, 0x74, 0x02, 0xC1, 0x52, 0x34,
+0x01, 0xC6, 0x52, 0x34, 0x3B, 0x5E, 0x14, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC4, 0x4F, 0x62,
+0x09, 0x10, 0x09, 0x03, 0x60, 0xC7, 0x78, 0x9E, 0xE0, 0x1B, 0x99, 0x33, 0x1B, 0x33, 0x00, 0xC1,
+0x41, 0x09, 0x00, 0x55, 0x49, 0x01, 0x5B, 0x42, 0x04, 0x48, 0xC1, 0x44, 0x0E, 0x00, 0x48, 0x42,
+0x41, 0x40, 0x00, 0xCF, 0xBD, 0x9B, 0xC7, 0x65, 0x47, 0x2D, 0xC0, 0xB8, 0x6A, 0x11, 0x2A, 0xA7,
+0x23, 0x35, 0x77, 0x0C, 0x00, 0x75, 0x4C, 0x72, 0xC1, 0x77, 0x0C, 0x04, 0x72, 0x4C, 0xC3, 0x77,
+0x0C, 0x77, 0x0C, 0x04, 0xC1, 0xC9, 0x0C, 0x01, 0xC1, 0xC9, 0x0C, 0x00, 0xC1, 0xC9, 0x0C, 0x06,
+0x72, 0xCE, 0x77, 0x0C, 0x35, 0x4A, 0xA7, 0x11, 0x9B, 0x65, 0xE9, 0x2D, 0x00, 0xB7, 0x56, 0x1C,
+0x00, 0x02, 0x45, 0x42, 0x44, 0x48, 0x42, 0x4E, 0x4A, 0x43, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09,
+0x02, 0x55, 0x50, 0xCD, 0x72, 0x78, 0xE0, 0x1A, 0x66, 0x72, 0x20, 0x1A, 0x66, 0x20, 0x15, 0x09,
+0x97, 0x09, 0x01, 0x5B, 0xC1, 0xC5, 0x02, 0x01, 0x4E, 0x00, 0x48, 0x4E, 0x00, 0xC6, 0x53, 0x08,
+0x0E, 0x0A, 0x49, 0xAA, 0x02, 0x01, 0x45, 0x40, 0x0C, 0x4B, 0xC3, 0xE4, 0x14, 0x5B, 0x34, 0x00,
+0xC8, 0x64, 0x52, 0x34, 0x9B, 0x64, 0x34, 0x83, 0x52, 0x34, 0x00, 0xC5, 0x64, 0xC7, 0x5B, 0x14,
+0x8E, 0x18, 0x00, 0xC3, 0x8E, 0xAD, 0x96, 0x74, 0x00, 0x58, 0xC2, 0x74, 0x8E, 0x18, 0x00, 0xC1,
+0xAE, 0x00, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0x6E, 0xD0, 0x81, 0x39, 0x88, 0x6E,
+0x45, 0x55, 0x4D, 0x87, 0x55, 0x4D, 0x87, 0x4D, 0x0D, 0x4B, 0x07, 0x0D, 0x07, 0x01, 0x4D, 0x47,
+0xC2, 0x81, 0x0B, 0x00, 0x13, 0x4A, 0x00, 0x44, 0x45, 0x00, 0x48, 0x43, 0x42, 0x40, 0x09, 0x48,
+0x4A, 0x48, 0xC4, 0xAA, 0x08, 0x0A, 0x01, 0x00, 0x00, 0x41, 0x48, 0x4A, 0x45, 0x43, 0x48, 0x42,
+0x40, 0x04, 0x41, 0x40, 0x00, 0x45, 0x44, 0x48, 0x44, 0xC1, 0x51, 0x00, 0x00, 0x41, 0x40, 0x00,
+0x42, 0x4A, 0x48, 0x44, 0x00, 0xC1, 0x53, 0x04, 0x00, 0x40, 0x00, 0x65, 0x40, 0x45, 0x40, 0x00,
+0x41, 0x00, 0x71, 0x40, 0x71, 0x40, 0x00, 0x52, 0x5F, 0x40, 0x04, 0x67, 0x40, 0x71, 0x40, 0x04,
+0x41, 0x00, 0x40, 0x04, 0x41, 0x5F, 0x4B, 0x40, 0x41, 0x00, 0x5C, 0x43, 0x00, 0x41, 0x01, 0x40,
+0x09, 0x52, 0x40, 0x00, 0x41, 0x01, 0x67, 0x40, 0x00, 0x71, 0x40, 0x00, 0x4B, 0xC2, 0xD9, 0x3C,
+0x2C, 0x00, 0x5D, 0x01, 0x7C, 0x6C, 0x7C, 0x01, 0x6C, 0xC0, 0x57, 0x00, 0x6C, 0xC2, 0x57, 0xA1,
+0x07, 0x04, 0xC0, 0x4B, 0x01, 0xC5, 0xBA, 0x2E, 0x0D, 0x4B, 0x0D, 0x07, 0x0A, 0x6E, 0xC2, 0xB4,
+0x0B, 0x00, 0x06, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0xC1, 0x67, 0x14, 0x00, 0xC7, 0xCE,
+0x14, 0x5B, 0xCE, 0x5B, 0x52, 0x14, 0x5B, 0x00, 0xC4, 0x52, 0x14, 0x5B, 0xAC, 0x14, 0x01, 0x7A,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x06, 0x50, 0x00, 0xC1, 0x7B, 0x10, 0x00,
+0x49, 0x07, 0xC4, 0x62, 0x09, 0x10, 0x8A, 0x02, 0x06, 0x44, 0x42, 0x00, 0x41, 0x52, 0x40, 0x7A,
+0xCC, 0x84, 0x34, 0x7A, 0xAF, 0x12, 0x2D, 0x4C, 0x71, 0x11, 0x2A, 0x54, 0x23, 0x77, 0x00, 0x4C,
+0xC5, 0x77, 0x32, 0x77, 0x0C, 0x32, 0x0C, 0x00, 0xC1, 0xC9, 0x0C, 0x07, 0xC1, 0x77, 0x0C, 0x00,
+0xC1, 0xC9, 0x0C, 0x01, 0xC1, 0xC9, 0x0C, 0x0B, 0xCA, 0x77, 0x32, 0x0C, 0x77, 0x4A, 0xA7, 0x2F,
+0x3B, 0x4C, 0x6B, 0x2D, 0x00, 0xC5, 0xE4, 0x76, 0xB8, 0x00, 0x12, 0x00, 0x00, 0x45, 0x42, 0x09,
+0x5B, 0x49, 0xC1, 0x97, 0x09, 0x04, 0x50, 0xC0, 0x7B, 0x00, 0x50, 0xC5, 0x7B, 0xA5, 0x10, 0xA5,
+0x15, 0x09, 0x02, 0x50, 0x49, 0x50, 0x69, 0x42, 0x02, 0x44, 0x5C, 0x42, 0x44, 0x42, 0x5C, 0x44,
+0x42, 0x04, 0x41, 0x40, 0x0D, 0xC1, 0xE4, 0x14, 0x07, 0xC1, 0x67, 0x14, 0x03, 0xC1, 0x5B, 0x14,
+0x00, 0xC1, 0x8E, 0x18, 0x0A, 0xC4, 0xAE, 0x31, 0x00, 0x0B, 0x00, 0x0C, 0x41, 0x40, 0x04, 0x4B,
+0x40, 0x00, 0xC1, 0xB2, 0x07, 0x07, 0x6E, 0xC4, 0x4B, 0xC6, 0x07, 0x2E, 0x4B, 0x00, 0x47, 0x4D,
+0xC4, 0x4B, 0x79, 0x07, 0x2E, 0x07, 0x05, 0xC2, 0x81, 0x47, 0x00, 0x13, 0x41, 0x02, 0x40, 0x41,
+0x00, 0x40, 0x0A, 0x4B, 0x41, 0x00, 0x40, 0x41, 0x40, 0x45, 0x43, 0x00, 0x42, 0x40, 0x41, 0x40,
+0x41, 0x00, 0x40, 0x05, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x52, 0x40, 0x01, 0x41, 0x40, 0x01,
+0x41, 0x00, 0x40, 0x00, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x0B, 0x41, 0x45, 0x00, 0x40, 0x19, 0xC2, 0xD9, 0xB3, 0x1D, 0x0C, 0x7C, 0xC3, 0xF1, 0x07,
+0x0D, 0x07, 0x16, 0x4D, 0xC2, 0xE9, 0x0B, 0x00, 0x06, 0x41, 0x40, 0x1C, 0xC2, 0xB6, 0x14, 0x5B,
+0x02, 0xC1, 0xCE, 0x5B, 0x00, 0xC3, 0xCE, 0x5B, 0x14, 0x5B, 0x00, 0x54, 0xC5, 0x5B, 0x14, 0x5B,
+0xCE, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC1, 0x4F, 0x1B, 0x00, 0x55, 0xC3, 0x41, 0x1B, 0x41,
+0x1B, 0x01, 0x55, 0x5B, 0x00, 0xC1, 0x41, 0x1B, 0x01, 0x49, 0x5B, 0x00, 0x55, 0x5B, 0xC1, 0x41,
+0x1B, 0x00, 0x55, 0x5B, 0x69, 0x45, 0x07, 0x42, 0x61, 0x67, 0x40, 0x00, 0xD4, 0x93, 0x8F, 0x9B,
+0x76, 0x7C, 0xAF, 0x7C, 0x4C, 0x0E, 0x2A, 0xDB, 0x5A, 0xC9, 0x77, 0x35, 0x77, 0x32, 0x35, 0x0C,
+0x32, 0x0C, 0x00, 0xC3, 0xC9, 0x0C, 0x77, 0x0C, 0x01, 0xC1, 0xC9, 0x0C, 0x03, 0xC3, 0x77, 0x0C,
+0x77, 0x0C, 0x01, 0xC1, 0x77, 0x0C, 0x04, 0xC1, 0x77, 0x0C, 0x01, 0xD2, 0x77, 0x0C, 0x35, 0x0C,
+0x77, 0x0C, 0x35, 0x4A, 0xA7, 0x8F, 0x3B, 0x71, 0x7C, 0x6B, 0x7C, 0x13, 0x52, 0x89, 0x00, 0x02,
+0x41, 0x42, 0x45, 0x07, 0x69, 0xC2, 0x8A, 0x15, 0x1B, 0x00, 0xC1, 0x41, 0x1B, 0x00, 0xC1, 0x41,
+0x1B, 0x00, 0xC1, 0x41, 0x1B, 0x02, 0x55, 0x5B, 0x00, 0xC9, 0x41, 0x15, 0x41, 0x1B, 0x41, 0x15,
+0x1B, 0x7C, 0x29, 0x05, 0x0E, 0x41, 0x40, 0x0D, 0x61, 0x54, 0xC0, 0x5B, 0x01, 0xC1, 0xCE, 0x5B,
+0x01, 0x54, 0xC7, 0x5B, 0x14, 0x67, 0x5B, 0x14, 0x5B, 0x14, 0x5B, 0x00, 0x5F, 0x58, 0x09, 0xC0,
+0xAE, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x4B, 0xC2, 0xD6, 0x0D, 0x07, 0x0A, 0x4D, 0x47, 0x00,
+0x4D, 0x47, 0x02, 0x4D, 0x47, 0x01, 0x4D, 0x01, 0x47, 0xC2, 0xB2, 0xC0, 0x00, 0x2C, 0x41, 0x45,
+0x00, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x43, 0x09, 0x48,
+0x43, 0x0D, 0x48, 0x43, 0x26, 0xC5, 0x6D, 0x03, 0x6D, 0x26, 0x5A, 0x85, 0x0C, 0xC2, 0x7E, 0x71,
+0x4E, 0x00, 0xC1, 0xA9, 0x4E, 0x15, 0xC2, 0xA0, 0x53, 0x03, 0x00, 0x48, 0xC1, 0x50, 0x03, 0x03,
+0x48, 0x43, 0x0F, 0x48, 0x43, 0x07, 0xC4, 0x74, 0x03, 0x59, 0x0A, 0x3E, 0x03, 0xC1, 0x71, 0x3E,
+0x00, 0xC1, 0x71, 0x3E, 0x07, 0xC1, 0x59, 0x03, 0x0D, 0x4A, 0x10, 0xC6, 0x92, 0x8D, 0x66, 0x88,
+0x66, 0xCF, 0x66, 0x02, 0xC3, 0x88, 0x66, 0xCF, 0x66, 0x02, 0xC1, 0x92, 0x66, 0x00, 0xC3, 0x88,
+0x66, 0x8D, 0x66, 0x00, 0xC2, 0x92, 0x66, 0x0E, 0x0A, 0x43, 0x01, 0xC5, 0x89, 0xE3, 0x11, 0x34,
+0x51, 0x4C, 0x00, 0xCC, 0x71, 0x2B, 0xD2, 0x5A, 0xA7, 0x23, 0x35, 0x0C, 0x77, 0x32, 0x0C, 0x32,
+0x0C, 0x05, 0xC1, 0x77, 0x0C, 0x03, 0xC3, 0x77, 0x0C, 0x77, 0x0C, 0x00, 0xC1, 0x77, 0x0C, 0x05,
+0xC0, 0x77, 0x00, 0x4C, 0x00, 0xC2, 0x77, 0xC9, 0x0C, 0x00, 0xC2, 0x77, 0x0C, 0x77, 0x00, 0x75,
+0x4E, 0xC5, 0xE3, 0x11, 0x2A, 0x3B, 0x71, 0xB8, 0x00, 0xC4, 0x52, 0x9B, 0x3E, 0x6D, 0x03, 0x01,
+0x4A, 0x4E, 0x09, 0xC2, 0x8D, 0xCF, 0x66, 0x00, 0xC3, 0x8D, 0x66, 0xCF, 0x66, 0x01, 0xC1, 0xCF,
+0x66, 0x02, 0xC1, 0x88, 0x66, 0x00, 0xC4, 0xCF, 0x88, 0x66, 0xCF, 0x66, 0x01, 0x4E, 0x11, 0x4A,
+0x0D, 0x4E, 0x7E, 0x02, 0x4A, 0x7E, 0x08, 0x4A, 0x7E, 0x00, 0xC1, 0x70, 0x74, 0x00, 0x48, 0xC0,
+0x74, 0x09, 0x43, 0x00, 0xC2, 0x50, 0x08, 0x03, 0x0A, 0x48, 0x43, 0x03, 0x66, 0xC4, 0x50, 0x74,
+0x03, 0x6A, 0x4E, 0x0B, 0xC3, 0xA0, 0x76, 0xA0, 0x4E, 0x00, 0xC3, 0xA0, 0x76, 0xA0, 0x4E, 0x03,
+0xC5, 0x6F, 0x4E, 0xA0, 0x52, 0x50, 0x03, 0x3C, 0x48, 0x43, 0x07, 0x48, 0x43, 0x09, 0x48, 0x42,
+0x41, 0x42, 0x41, 0x45, 0x00, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x01, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x00, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x01, 0x45, 0x00, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x5F, 0x4F, 0xC3, 0x4F, 0x1F, 0x01, 0x0F, 0x00, 0x65, 0x5F, 0x4F, 0x01, 0x65, 0x4F,
+0x01, 0x65, 0x4F, 0x5F, 0x4F, 0x41, 0x45, 0xC4, 0x4F, 0x1F, 0x01, 0x1E, 0xA2, 0x01, 0x5E, 0xC0,
+0xA2, 0x01, 0x5E, 0xC0, 0xA2, 0x01, 0x5E, 0xC0, 0xA2, 0x01, 0x5E, 0xC0, 0xA2, 0x01, 0x5E, 0xC0,
+0xA2, 0x01, 0x61, 0x65, 0x5F, 0x4F, 0x65, 0x45, 0x65, 0x5F, 0x4F, 0x5F, 0x61, 0x4F, 0x5F, 0x4F,
+0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x45, 0x00, 0x4F,
+0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0xC7, 0x4F, 0x3A, 0x25, 0x1F, 0x0F, 0x21, 0x25, 0x01, 0x0A,
+0x65, 0x01, 0x41, 0x5F, 0x45, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F,
+0x4F, 0x5F, 0x4F, 0xC2, 0x47, 0x0C, 0x06, 0x17, 0xC1, 0x73, 0x06, 0x04, 0xC1, 0x73, 0x06, 0x15,
+0x44, 0x41, 0x65, 0x45, 0xC6, 0x8F, 0x5F, 0x2A, 0xC2, 0x64, 0x3B, 0x2B, 0x00, 0xC6, 0x95, 0x36,
+0x5A, 0x4A, 0x0C, 0x32, 0x0C, 0x04, 0x72, 0x63, 0x02, 0xC1, 0x8D, 0x23, 0x00, 0xC3, 0xC9, 0x23,
+0x4A, 0x23, 0x01, 0xC4, 0xC9, 0x23, 0x4A, 0xC9, 0x4A, 0x01, 0xC2, 0x54, 0x8D, 0x23, 0x00, 0xC4,
+0x8D, 0x4A, 0xC9, 0x4A, 0x23, 0x00, 0xC1, 0xC9, 0x23, 0x01, 0xCE, 0x4A, 0x23, 0x4A, 0x8F, 0x11,
+0x84, 0x2F, 0x11, 0x4A, 0x3B, 0x11, 0xBC, 0x95, 0x27, 0x1F, 0x00, 0x41, 0x4E, 0x46, 0x16, 0xC1,
+0x73, 0x06, 0x2B, 0x75, 0x41, 0x10, 0x45, 0x5F, 0x65, 0x5F, 0x65, 0x4F, 0xD8, 0x4F, 0x0F, 0x25,
+0x05, 0x25, 0x0F, 0x1F, 0xAA, 0x1F, 0x01, 0x05, 0x01, 0x0F, 0x25, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F,
+0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x05, 0x00, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x65, 0x4F, 0x5F,
+0x45, 0x00, 0xC2, 0xA2, 0x1E, 0xA2, 0x01, 0x5E, 0xC0, 0xA2, 0x01, 0x5E, 0xC0, 0xA2, 0x00, 0x67,
+0xC2, 0xA2, 0x01, 0xA2, 0x00, 0x67, 0xC2, 0xA2, 0x01, 0xA2, 0x01, 0x5E, 0x5F, 0x41, 0x00, 0x5F,
+0x61, 0x62, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x00, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x00, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x01, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x01, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x2F,
+0x4B, 0x40, 0x01, 0x4B, 0x40, 0x01, 0x4B, 0x40, 0x00, 0x41, 0x71, 0x40, 0x01, 0x4B, 0x40, 0x06,
+0x4B, 0x40, 0x4B, 0x40, 0x06, 0x4B, 0x40, 0x4B, 0x41, 0x40, 0x02, 0x4B, 0x40, 0x02, 0x41, 0x40,
+0x0E, 0x52, 0xC1, 0x47, 0x00, 0x06, 0x4B, 0x40, 0x01, 0x41, 0x40, 0x0F, 0x6D, 0x41, 0x40, 0x0D,
+0x4C, 0x46, 0x15, 0xC1, 0x73, 0x06, 0x04, 0xC1, 0x73, 0x06, 0x05, 0xC1, 0x73, 0x06, 0x02, 0xC1,
+0x73, 0x06, 0x01, 0xC1, 0x73, 0x06, 0x06, 0x42, 0x40, 0x00, 0x7A, 0xC1, 0x84, 0x5F, 0x00, 0x6A,
+0x01, 0xC6, 0x5C, 0xA7, 0x84, 0x9A, 0xA4, 0x5A, 0x68, 0x00, 0xC2, 0xA6, 0x73, 0x68, 0x03, 0x75,
+0xC6, 0xDB, 0x32, 0x42, 0xDB, 0x42, 0x35, 0x11, 0x00, 0xC2, 0xC9, 0x32, 0xA6, 0x00, 0x51, 0x00,
+0x6F, 0x51, 0x00, 0x6F, 0x00, 0xC2, 0x42, 0xA6, 0x35, 0x00, 0xC5, 0xA6, 0xC9, 0x11, 0x32, 0xC9,
+0xA6, 0x00, 0xD2, 0x68, 0x32, 0xC9, 0x11, 0x8F, 0x2F, 0x84, 0x9A, 0xA4, 0x37, 0x2F, 0xBC, 0x6C,
+0x2F, 0xBC, 0x95, 0x00, 0x12, 0x00, 0x00, 0x4E, 0x46, 0x0D, 0xC1, 0x73, 0x06, 0x01, 0xC1, 0x73,
+0x06, 0x00, 0xC1, 0x73, 0x06, 0x03, 0xC1, 0x73, 0x06, 0x01, 0xC1, 0x73, 0x06, 0x23, 0x75, 0x40,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x00, 0x4B, 0x40, 0x07,
+0x4B, 0x40, 0x4B, 0x40, 0x02, 0x4B, 0x40, 0x01, 0x4B, 0x40, 0x03, 0x41, 0x4B, 0x40, 0x3C, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x28,
+0x52, 0x40, 0x0F, 0x41, 0x6D, 0xC1, 0xC0, 0x00, 0x17, 0x41, 0x40, 0x4B, 0x40, 0x05, 0x41, 0x40,
+0x0E, 0xC2, 0x47, 0x12, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0xC2, 0x47, 0x01, 0x00, 0x0D, 0x63, 0x46,
+0x2A, 0x75, 0x4E, 0xC1, 0x68, 0x06, 0x00, 0x63, 0x00, 0x75, 0x00, 0xC4, 0x73, 0x0C, 0x73, 0x02,
+0x00, 0x00, 0x45, 0xC2, 0xE3, 0xBC, 0x2A, 0x00, 0xC1, 0x42, 0x2A, 0x00, 0xD0, 0x9A, 0x93, 0x26,
+0x84, 0x32, 0x68, 0x73, 0x68, 0xA6, 0x68, 0x35, 0x32, 0x68, 0x73, 0xA6, 0x32, 0x42, 0x01, 0xC1,
+0xA6, 0x42, 0x00, 0x72, 0x51, 0xC0, 0xA6, 0x00, 0x72, 0x6A, 0x51, 0xCA, 0x8F, 0x2F, 0x11, 0x2F,
+0x5C, 0x11, 0x68, 0x35, 0x32, 0x68, 0x11, 0x00, 0xC1, 0x42, 0x32, 0x00, 0x75, 0x00, 0x72, 0xC2,
+0x4A, 0x11, 0x2F, 0x00, 0xC2, 0x95, 0x90, 0xB0, 0x00, 0x51, 0x6F, 0x7B, 0xC5, 0x6C, 0x5F, 0x95,
+0x00, 0x12, 0x00, 0x00, 0x4E, 0x46, 0xC6, 0x68, 0x0A, 0x23, 0x73, 0x23, 0xCA, 0x35, 0x00, 0xC3,
+0x64, 0x0A, 0xC4, 0x06, 0x38, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x05, 0x4B, 0x00, 0x41, 0x40, 0x17, 0x4B, 0x00, 0x40, 0x00, 0x41, 0x4B, 0x40, 0x3C, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x28, 0x52,
+0x4B, 0x40, 0x0B, 0x4B, 0x00, 0x40, 0x41, 0x52, 0x4B, 0x40, 0x17, 0x67, 0x4B, 0x40, 0x06, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x6D, 0x41, 0x40, 0x0D, 0x4C, 0x46, 0x2A, 0x4E,
+0x42, 0x4A, 0x46, 0xC9, 0x68, 0x08, 0x04, 0x64, 0x03, 0x35, 0x03, 0x06, 0x02, 0x00, 0x00, 0x61,
+0xD8, 0x84, 0x5F, 0x2A, 0x3B, 0x3E, 0x64, 0x11, 0x42, 0xA4, 0x85, 0x2F, 0x4A, 0x0E, 0x54, 0x5A,
+0x58, 0x54, 0x0A, 0x49, 0x58, 0x49, 0x0A, 0x59, 0x4A, 0xA6, 0x00, 0xC3, 0x68, 0x32, 0x4A, 0x32,
+0x00, 0x75, 0xC3, 0x68, 0x32, 0x2B, 0x11, 0x00, 0x6F, 0x51, 0x6F, 0xC7, 0x42, 0x2F, 0x0E, 0x44,
+0x0A, 0x63, 0x86, 0x32, 0x00, 0xD5, 0x64, 0x51, 0x59, 0x03, 0xC5, 0x5A, 0x11, 0x6C, 0x2F, 0x58,
+0xA4, 0xA7, 0x11, 0x34, 0x50, 0x76, 0xC7, 0x6C, 0x95, 0x00, 0x12, 0x00, 0x00, 0x4E, 0x46, 0x44,
+0x4E, 0x43, 0x4C, 0x42, 0x4A, 0x4E, 0x00, 0x44, 0x4E, 0xC2, 0x44, 0x35, 0x06, 0x37, 0x75, 0x40,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x4B, 0x65, 0x40, 0x18, 0x4B, 0x40,
+0x00, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x3A, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40,
+0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x63, 0x46, 0x28, 0xCF, 0x73, 0x06, 0x68, 0x23,
+0x0A, 0x06, 0x73, 0xCA, 0x58, 0x77, 0x08, 0x44, 0x0E, 0x06, 0x02, 0x00, 0x00, 0x45, 0xD0, 0x8F,
+0x6C, 0xA9, 0x44, 0x7C, 0x4C, 0x76, 0x3B, 0x2A, 0x5C, 0x11, 0x58, 0x08, 0x03, 0x08, 0x70, 0x08,
+0x02, 0xC0, 0x6D, 0x00, 0x4A, 0x51, 0xDF, 0xA6, 0x0E, 0x51, 0x03, 0x4A, 0x2B, 0x42, 0x0E, 0x6D,
+0x08, 0x4A, 0x42, 0x8F, 0x11, 0x8F, 0x2F, 0x2B, 0x4A, 0x0A, 0x44, 0x59, 0x04, 0x58, 0x32, 0x35,
+0x23, 0x03, 0x08, 0x51, 0x3F, 0x58, 0x11, 0x6F, 0xC2, 0x8F, 0x11, 0x2F, 0x00, 0xC2, 0x71, 0xB8,
+0x7C, 0x00, 0xC3, 0xD4, 0x71, 0x63, 0x00, 0x02, 0x4E, 0xC6, 0x68, 0x03, 0x73, 0x0A, 0x0C, 0x03,
+0x04, 0x00, 0x4E, 0x48, 0x46, 0x4A, 0x63, 0x46, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x3A, 0x41, 0x40, 0x19, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x4C, 0x46,
+0x2A, 0x48, 0x43, 0x00, 0x75, 0x4C, 0x44, 0x00, 0x4C, 0x4E, 0x41, 0xC3, 0x73, 0x06, 0x02, 0x00,
+0x00, 0x7A, 0xCE, 0x6C, 0x9B, 0x9D, 0xAF, 0x00, 0xAF, 0x9D, 0x0A, 0x11, 0x42, 0x11, 0x86, 0x0A,
+0x08, 0x0A, 0x00, 0xD0, 0x6D, 0x08, 0x70, 0x08, 0x74, 0x08, 0x0E, 0x2B, 0xA6, 0x63, 0x47, 0x00,
+0x59, 0xA6, 0x23, 0x3A, 0x00, 0x00, 0x7E, 0x51, 0x6F, 0x01, 0x51, 0x00, 0x72, 0x00, 0x75, 0x01,
+0x72, 0x00, 0xC7, 0x68, 0x35, 0x23, 0x0C, 0x23, 0x64, 0x11, 0x2F, 0x00, 0xC6, 0x8F, 0x5C, 0x6C,
+0x3B, 0x44, 0x6B, 0xC0, 0x00, 0xC3, 0xD8, 0x76, 0x9D, 0x00, 0x02, 0x4E, 0x46, 0xCC, 0x44, 0x08,
+0x21, 0x0E, 0x03, 0x0C, 0x05, 0x0E, 0x02, 0x0E, 0x16, 0x35, 0x06, 0x37, 0x75, 0x40, 0x10, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x3A, 0x41,
+0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00,
+0x40, 0x0D, 0x63, 0x46, 0x2A, 0xCA, 0x68, 0x0E, 0xCA, 0x0C, 0x68, 0x0C, 0x23, 0x06, 0x73, 0x35,
+0x06, 0x00, 0x42, 0x40, 0x00, 0xDF, 0xEF, 0x84, 0x3E, 0x7A, 0x2D, 0x12, 0x00, 0xB8, 0x6A, 0x11,
+0x42, 0x11, 0x0A, 0x98, 0x53, 0x0A, 0x6D, 0x74, 0x03, 0x08, 0x6D, 0x0A, 0x08, 0x0E, 0x2F, 0x11,
+0x0A, 0x6D, 0x08, 0x4A, 0x42, 0x32, 0xC4, 0x86, 0x70, 0x03, 0x3B, 0x11, 0x00, 0x6F, 0xC4, 0x6C,
+0x11, 0x84, 0x0A, 0x76, 0x00, 0xD8, 0x44, 0x71, 0x9E, 0x53, 0x64, 0x71, 0x51, 0x6A, 0x70, 0x04,
+0xB0, 0x11, 0x8F, 0x11, 0xBC, 0x6C, 0x9B, 0x65, 0x4F, 0x2D, 0x12, 0x7C, 0x56, 0xB8, 0x00, 0x02,
+0x4E, 0x46, 0xCB, 0x68, 0x0E, 0x23, 0x73, 0x0C, 0x06, 0x0C, 0x68, 0x23, 0x0E, 0x0C, 0x06, 0x38,
+0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00,
+0x40, 0x0D, 0x41, 0x00, 0x40, 0x39, 0x41, 0x00, 0x40, 0x17, 0x41, 0x00, 0x40, 0x07, 0x41, 0x40,
+0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x4C, 0x46, 0x36, 0x42, 0x40,
+0x00, 0xC9, 0xEF, 0x84, 0x34, 0x65, 0xAF, 0x12, 0x47, 0x4C, 0x76, 0x2A, 0x00, 0x72, 0x48, 0x4A,
+0xDF, 0x98, 0x0A, 0x08, 0x03, 0x6D, 0x70, 0x08, 0x98, 0x6D, 0x3E, 0x2F, 0x42, 0x0E, 0x6D, 0x53,
+0x0E, 0x42, 0x32, 0x3E, 0x70, 0x0A, 0x2F, 0x42, 0x11, 0x2F, 0x84, 0x2B, 0x0E, 0x70, 0x51, 0x4C,
+0x65, 0xC2, 0x4C, 0xCC, 0x4C, 0x02, 0xC0, 0x65, 0x00, 0xCA, 0x7C, 0x26, 0x5C, 0x8F, 0x6C, 0x5C,
+0xBC, 0x3B, 0x4C, 0x6B, 0x0B, 0x00, 0xC3, 0xB8, 0x56, 0x9D, 0x00, 0x00, 0x71, 0x40, 0x4E, 0x46,
+0xE0, 0x04, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x3A, 0x41, 0x40, 0x23, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x0F, 0x71, 0x6D,
+0x40, 0x0D, 0x63, 0x46, 0x36, 0x42, 0x40, 0x00, 0x7A, 0xCE, 0x84, 0x6C, 0x50, 0x7C, 0x25, 0x7A,
+0x4C, 0x3E, 0x2B, 0x42, 0x11, 0x0A, 0x70, 0x08, 0x70, 0x00, 0xC3, 0x74, 0x08, 0x0A, 0x08, 0x00,
+0xC5, 0x6D, 0x4A, 0x11, 0x42, 0x92, 0x70, 0x00, 0xD5, 0x84, 0x32, 0x2B, 0x0E, 0x70, 0x0A, 0x4A,
+0x11, 0x2F, 0x8F, 0x2F, 0x11, 0x0E, 0x6D, 0xA5, 0x65, 0x16, 0xB8, 0x16, 0xB8, 0x7A, 0xB8, 0x00,
+0xCC, 0x7A, 0x7C, 0x4F, 0xB0, 0x2F, 0x8F, 0x2F, 0xBC, 0x8F, 0x11, 0x71, 0x7C, 0xB7, 0x00, 0xC3,
+0x65, 0x52, 0x50, 0x00, 0x02, 0x4E, 0x46, 0xE0, 0x04, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x66, 0x7E, 0x00, 0x4E, 0xDC,
+0x86, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03,
+0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x00, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0xC1, 0x58, 0x08, 0x01, 0xC1, 0x58, 0x08, 0x00, 0xC1, 0x58, 0x08, 0x00, 0xC1, 0x58, 0x08,
+0x00, 0xC1, 0x58, 0x08, 0x00, 0x70, 0x4A, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x66, 0x48, 0x0B, 0x43, 0x4C, 0xC0, 0xB5, 0x0C,
+0xC1, 0x68, 0xB5, 0x02, 0xC1, 0x68, 0xB5, 0x16, 0xC0, 0x68, 0x0A, 0x48, 0x43, 0x48, 0x42, 0xD4,
+0xE3, 0x5F, 0x64, 0x76, 0x65, 0x56, 0xA9, 0x2B, 0x8F, 0x5C, 0x32, 0x03, 0x08, 0x70, 0x74, 0x70,
+0x0A, 0x08, 0x98, 0x6D, 0x08, 0x00, 0xC4, 0x5A, 0x11, 0xA6, 0x0A, 0x51, 0x00, 0x7E, 0x51, 0x72,
+0x48, 0xC5, 0x51, 0x50, 0x84, 0x2F, 0x11, 0x2F, 0x01, 0x4A, 0xC8, 0x70, 0x51, 0x29, 0x02, 0x8C,
+0x16, 0x02, 0x16, 0x02, 0x00, 0x68, 0xCB, 0x7C, 0x6B, 0xB0, 0x2F, 0xBC, 0x8F, 0x11, 0x2F, 0x8F,
+0x3B, 0x71, 0x9D, 0x00, 0xC5, 0x52, 0x9B, 0x3E, 0x03, 0x08, 0x03, 0x00, 0x4E, 0xC0, 0x68, 0x09,
+0xC1, 0xB5, 0x35, 0x16, 0xC1, 0x68, 0xB5, 0x00, 0xC1, 0x68, 0xB5, 0x07, 0xC1, 0x68, 0xB5, 0x02,
+0xC1, 0x68, 0x35, 0x0C, 0xC2, 0x68, 0x0C, 0x03, 0x00, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0xDF, 0x53, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x53,
+0x76, 0x71, 0x76, 0x53, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71,
+0x76, 0x53, 0x08, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x44, 0x41, 0x42, 0x41, 0x08, 0x45, 0x40, 0x41,
+0x0C, 0x45, 0x41, 0x03, 0x65, 0x41, 0x65, 0x41, 0x11, 0xC6, 0x47, 0x3A, 0x6C, 0x2B, 0x6C, 0x3A,
+0x01, 0x18, 0x40, 0x45, 0x41, 0x22, 0xC2, 0x47, 0x28, 0x37, 0x0F, 0x4F, 0x41, 0x0A, 0x45, 0x41,
+0x0E, 0x6D, 0x4F, 0x62, 0x0E, 0xC2, 0x94, 0x7D, 0x8B, 0x05, 0x7D, 0x00, 0xC0, 0x8B, 0x00, 0xC6,
+0xBE, 0x8B, 0xBE, 0x8B, 0x3D, 0x80, 0x15, 0x02, 0x49, 0x55, 0x00, 0x49, 0x55, 0x0D, 0x49, 0x55,
+0x5B, 0x42, 0x08, 0x69, 0x42, 0x41, 0x4F, 0x4B, 0x45, 0xCF, 0x84, 0xBC, 0x2A, 0x11, 0x3B, 0x11,
+0x2A, 0x2F, 0x3F, 0x9A, 0x32, 0x59, 0x26, 0x03, 0x74, 0x03, 0x01, 0x48, 0x43, 0x48, 0x66, 0xCA,
+0x59, 0x11, 0x32, 0x89, 0x31, 0x00, 0x59, 0x42, 0x2F, 0x21, 0x00, 0x00, 0xC2, 0x5A, 0x2B, 0x11,
+0x00, 0xC6, 0x6C, 0x11, 0x0A, 0x6D, 0x4C, 0x29, 0x16, 0x00, 0x44, 0x56, 0x44, 0x56, 0x42, 0x00,
+0xD1, 0x7C, 0x21, 0x3E, 0x2F, 0x6C, 0x2F, 0xB0, 0x90, 0xB0, 0x11, 0x84, 0x2F, 0x3B, 0x11, 0xBC,
+0x95, 0x31, 0x01, 0x01, 0x45, 0x42, 0x09, 0x71, 0x40, 0x15, 0xC4, 0x6B, 0x3D, 0x8B, 0xBE, 0x8B,
+0x01, 0xC1, 0x80, 0x8B, 0x02, 0x7D, 0xC7, 0xDF, 0x94, 0x8B, 0x3D, 0x8B, 0x3D, 0x6B, 0x00, 0x0D,
+0x41, 0x11, 0x45, 0x41, 0x0A, 0x45, 0x41, 0x18, 0x67, 0xC1, 0xDC, 0x4B, 0x00, 0xC7, 0xBA, 0x4B,
+0xBA, 0x4B, 0xBA, 0x4B, 0xBA, 0x4B, 0x02, 0xC1, 0xBA, 0x4B, 0x01, 0xC7, 0xBA, 0x4B, 0xBA, 0x4B,
+0xBA, 0x4B, 0xBA, 0x4B, 0x01, 0xC3, 0xBA, 0x4B, 0x38, 0x01, 0x39, 0x65, 0x41, 0x01, 0x45, 0x41,
+0x07, 0x45, 0x41, 0x0B, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x4B, 0x40,
+0x00, 0x4B, 0x40, 0x12, 0xC1, 0xC0, 0x6C, 0x00, 0xC1, 0xD3, 0x00, 0x1A, 0x41, 0x40, 0x19, 0x41,
+0x40, 0x07, 0x68, 0x57, 0x0F, 0x5E, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x5E, 0x4F, 0x5E,
+0xC5, 0xD9, 0x27, 0xD9, 0x1E, 0x0F, 0x1E, 0x00, 0x52, 0x5E, 0x4F, 0xD3, 0x40, 0x0F, 0x7C, 0x13,
+0x80, 0xBE, 0x3D, 0x80, 0x13, 0x94, 0x80, 0x3D, 0x8B, 0x3D, 0x8B, 0x13, 0x80, 0xBE, 0x8B, 0x13,
+0x00, 0x49, 0x55, 0x49, 0x11, 0x55, 0x49, 0x01, 0x50, 0x69, 0x42, 0x03, 0x45, 0x42, 0x03, 0xC1,
+0x47, 0x00, 0x00, 0x7A, 0xC6, 0x84, 0xBC, 0x5F, 0x2A, 0x5C, 0x2A, 0x5C, 0x00, 0xC5, 0x5A, 0x89,
+0x9A, 0x54, 0x11, 0x4A, 0x06, 0xC2, 0x84, 0x2F, 0x11, 0x00, 0x76, 0x6D, 0x00, 0xC6, 0x5A, 0x42,
+0x2F, 0x03, 0x08, 0x36, 0x11, 0x00, 0xC1, 0x5C, 0x2F, 0x00, 0x51, 0x63, 0xC5, 0x70, 0x51, 0x29,
+0x04, 0x16, 0x04, 0x00, 0x56, 0x44, 0x56, 0x42, 0xCB, 0x7C, 0x50, 0x23, 0x6C, 0x2F, 0x8F, 0xBD,
+0x3F, 0x84, 0xA7, 0x8F, 0x2F, 0x00, 0x51, 0xC2, 0x6C, 0x95, 0x00, 0x02, 0x45, 0x42, 0x09, 0x41,
+0x40, 0x15, 0xD0, 0x6B, 0x13, 0x3D, 0x80, 0x3D, 0x13, 0x3D, 0x8B, 0x3D, 0x13, 0x8B, 0x13, 0x8B,
+0x3D, 0xBE, 0x3D, 0x13, 0x01, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x0C, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x08, 0xC1,
+0x81, 0x00, 0x39, 0x4B, 0x40, 0x01, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x45, 0x42, 0x61, 0x40, 0x02, 0x45,
+0x42, 0x41, 0x40, 0x42, 0x41, 0x40, 0x02, 0x41, 0x40, 0x00, 0x42, 0x45, 0x40, 0x52, 0xC5, 0x59,
+0x3A, 0x0B, 0x31, 0x01, 0x00, 0x01, 0x41, 0x40, 0x00, 0x42, 0x41, 0x40, 0x10, 0x41, 0x40, 0x19,
+0x41, 0x40, 0x07, 0x68, 0x57, 0x7F, 0x77, 0x70, 0x77, 0x57, 0xC4, 0x60, 0x30, 0x17, 0x37, 0x17,
+0x00, 0x77, 0x70, 0x77, 0x57, 0x7F, 0x5E, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x5E, 0x4F,
+0x62, 0x7F, 0x01, 0x68, 0x5E, 0x62, 0x4F, 0x7F, 0x68, 0x4F, 0x5E, 0x00, 0xC2, 0x7C, 0x80, 0x13,
+0x00, 0xC3, 0x4C, 0x94, 0xBE, 0x13, 0x01, 0xC2, 0x56, 0x65, 0x13, 0x00, 0xC1, 0x8B, 0x13, 0x01,
+0xC2, 0x80, 0x62, 0x09, 0x06, 0xC8, 0x41, 0x7B, 0x10, 0xA5, 0x09, 0x10, 0x82, 0x20, 0x09, 0x02,
+0x55, 0x49, 0x00, 0xC2, 0x62, 0x1B, 0x02, 0x04, 0x43, 0x42, 0x03, 0x41, 0x40, 0x00, 0x45, 0xC4,
+0xE3, 0x5F, 0x75, 0x42, 0x2A, 0x01, 0xC5, 0x9A, 0x22, 0x9A, 0x95, 0x2F, 0x42, 0x01, 0x6B, 0x51,
+0x6B, 0x51, 0x6B, 0x51, 0x02, 0x6F, 0x51, 0xC3, 0x4A, 0xB0, 0x4A, 0x42, 0x00, 0x75, 0xC2, 0x68,
+0x42, 0x11, 0x00, 0xC8, 0x5C, 0x11, 0x6C, 0x11, 0x0E, 0x6A, 0x16, 0x8A, 0x04, 0x01, 0xC9, 0x44,
+0x04, 0x16, 0x04, 0x02, 0x7C, 0x1C, 0x5A, 0x2A, 0x8F, 0x00, 0xC5, 0x5A, 0x3E, 0xA4, 0x9A, 0x4A,
+0x3B, 0x00, 0x51, 0xC2, 0x6C, 0x63, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42, 0x00, 0x44, 0x42, 0x00,
+0x44, 0x42, 0x03, 0x41, 0x40, 0x41, 0x42, 0x45, 0x40, 0x45, 0x42, 0x40, 0x00, 0x41, 0x40, 0x0B,
+0xCC, 0x6B, 0x94, 0x13, 0xBE, 0x13, 0x8B, 0x13, 0x4C, 0xBE, 0x8B, 0x65, 0x13, 0x56, 0x00, 0xC6,
+0x4C, 0x94, 0x13, 0x7D, 0x13, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0x4D, 0x47, 0x00, 0x4D, 0x78, 0xC7, 0x45, 0x4B,
+0x0D, 0x07, 0x55, 0x45, 0x79, 0x07, 0x06, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x13, 0x41, 0x40,
+0x00, 0x41, 0x42, 0x41, 0x40, 0x41, 0x40, 0x05, 0x45, 0x40, 0x41, 0x42, 0x00, 0x40, 0x02, 0x45,
+0x42, 0x45, 0x40, 0x00, 0x41, 0x40, 0x02, 0x45, 0x61, 0x40, 0x45, 0x42, 0x41, 0x40, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x48,
+0x4E, 0x40, 0x4A, 0x44, 0x4A, 0x45, 0x40, 0x00, 0x41, 0x4E, 0x44, 0x48, 0x44, 0x48, 0x00, 0x40,
+0x01, 0x41, 0x4E, 0x44, 0x42, 0x48, 0xC8, 0x58, 0x1F, 0x00, 0x12, 0x00, 0x47, 0x08, 0x0A, 0x00,
+0x00, 0x45, 0x4E, 0x42, 0x44, 0x48, 0x00, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07,
+0x68, 0x57, 0x77, 0xCD, 0x54, 0x30, 0x49, 0x85, 0x49, 0x85, 0x49, 0x54, 0x37, 0x17, 0x54, 0x49,
+0x54, 0x17, 0x00, 0x4F, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x62, 0x4F, 0x5E, 0x62, 0x43, 0xC4, 0x54,
+0x04, 0x26, 0x60, 0x26, 0x00, 0x70, 0x66, 0x4F, 0x5E, 0x4F, 0xD3, 0x7A, 0x7D, 0x80, 0x76, 0xC4,
+0x3D, 0x4C, 0x9E, 0x56, 0x6F, 0x88, 0x6F, 0x94, 0x8B, 0x56, 0x9E, 0x56, 0x3D, 0x41, 0x09, 0x06,
+0x50, 0xC6, 0x66, 0x78, 0x7B, 0x72, 0x33, 0x1A, 0x78, 0x00, 0x73, 0x55, 0x49, 0x04, 0x50, 0x5C,
+0x42, 0x02, 0x4E, 0x4A, 0x4E, 0x42, 0x4E, 0x4A, 0x42, 0x41, 0x40, 0x00, 0xC9, 0x90, 0xE3, 0x75,
+0x11, 0x64, 0x71, 0x3E, 0x3B, 0x84, 0x3F, 0x00, 0xC0, 0x42, 0x03, 0xC2, 0xDB, 0x11, 0x42, 0x00,
+0x51, 0xC1, 0x42, 0x11, 0x02, 0x6B, 0x00, 0x51, 0x6F, 0x6B, 0xC2, 0xA6, 0xE6, 0xA6, 0x00, 0x6B,
+0x51, 0x6B, 0x51, 0x6F, 0x51, 0x4E, 0xC3, 0x70, 0x4C, 0x02, 0x16, 0x00, 0x44, 0x56, 0x44, 0x56,
+0x44, 0x42, 0xC5, 0x7C, 0xB7, 0xB0, 0x11, 0x6C, 0x2F, 0x00, 0xC9, 0xA4, 0x85, 0x23, 0x3E, 0x56,
+0x44, 0xC7, 0x9B, 0x63, 0x00, 0x02, 0x45, 0x42, 0x5C, 0x4C, 0x44, 0xC2, 0x53, 0x23, 0x02, 0x03,
+0x41, 0x00, 0x48, 0x44, 0x48, 0x42, 0x48, 0x43, 0x44, 0x00, 0x4E, 0x40, 0x0B, 0xCD, 0x6B, 0x3D,
+0x80, 0x3D, 0x13, 0x8B, 0x88, 0x64, 0x7A, 0xCD, 0x9E, 0x65, 0x56, 0x88, 0x00, 0xC2, 0xBE, 0x3D,
+0x13, 0x00, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x07, 0xC1, 0xB2, 0x07, 0x07, 0x4D, 0x78, 0xC8, 0xB9, 0x61, 0x4D, 0x38, 0x46, 0x87, 0x7F,
+0x4B, 0x07, 0x07, 0x6E, 0xC1, 0x81, 0x00, 0x12, 0x41, 0x48, 0x00, 0x40, 0x00, 0x43, 0x00, 0x48,
+0x45, 0x4E, 0x42, 0x40, 0x03, 0x42, 0x63, 0x41, 0x43, 0x48, 0x43, 0x00, 0x40, 0x01, 0x48, 0x43,
+0x48, 0x45, 0x48, 0x4A, 0x40, 0x01, 0x45, 0x48, 0x00, 0x42, 0x4A, 0x43, 0x5F, 0x40, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x41, 0xC7,
+0x53, 0x49, 0x02, 0x50, 0x00, 0x1C, 0x03, 0x00, 0x00, 0x41, 0x4E, 0x48, 0x4A, 0x48, 0x41, 0x48,
+0x41, 0x40, 0x00, 0x41, 0x43, 0x44, 0x40, 0x41, 0x4A, 0x41, 0x40, 0x00, 0x71, 0x41, 0x5C, 0x48,
+0x40, 0x00, 0x41, 0x48, 0x42, 0x4B, 0x45, 0x48, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x19, 0x41, 0x40,
+0x07, 0x68, 0x57, 0x77, 0xCD, 0x5A, 0x54, 0x26, 0x54, 0x3F, 0x17, 0x37, 0x54, 0x37, 0x28, 0x17,
+0x30, 0x49, 0x17, 0x00, 0x4F, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x5E, 0x4F, 0x5E, 0x4F,
+0x4A, 0x4F, 0x5E, 0xC2, 0x4A, 0x04, 0x49, 0x00, 0x76, 0x4F, 0xD6, 0x40, 0x1E, 0x7C, 0x13, 0x7D,
+0x88, 0xA9, 0x6A, 0x65, 0x6F, 0x56, 0x88, 0x94, 0x88, 0x4C, 0x13, 0xCC, 0x6F, 0x56, 0x3D, 0x80,
+0x97, 0x09, 0x05, 0xC4, 0x97, 0x1A, 0x72, 0x1B, 0x78, 0x00, 0x5B, 0xC3, 0xA5, 0x1A, 0x20, 0x09,
+0x01, 0x55, 0x49, 0x01, 0x5B, 0x42, 0x04, 0x43, 0x4A, 0x44, 0x4E, 0x48, 0x42, 0x40, 0x01, 0x7A,
+0xCB, 0x84, 0x6C, 0x71, 0xD4, 0xB7, 0x65, 0x9D, 0x3B, 0x42, 0x2F, 0x42, 0xA6, 0x01, 0xC3, 0x42,
+0x32, 0x42, 0x32, 0x00, 0xC5, 0x42, 0x23, 0x42, 0x32, 0x4A, 0x32, 0x00, 0x51, 0x00, 0xC5, 0x84,
+0x3B, 0x32, 0x23, 0x3B, 0x23, 0x00, 0x7B, 0x00, 0x51, 0x01, 0x4E, 0xC3, 0x70, 0x4C, 0x29, 0x02,
+0x00, 0x69, 0x42, 0x5C, 0x42, 0x5C, 0x69, 0xC6, 0x6B, 0x21, 0x86, 0x11, 0x8F, 0x11, 0x8F, 0x00,
+0x51, 0xC7, 0x71, 0xE4, 0xE9, 0x6B, 0x7C, 0x52, 0x63, 0x00, 0x02, 0x45, 0x42, 0x48, 0x4E, 0x44,
+0x43, 0x4E, 0x42, 0x03, 0x41, 0x42, 0x44, 0x41, 0x44, 0x45, 0x40, 0x43, 0x44, 0x45, 0x48, 0x40,
+0x0B, 0xC1, 0x6B, 0x13, 0x00, 0xCB, 0xBE, 0x8B, 0x56, 0x88, 0x0E, 0x4C, 0x13, 0x88, 0x65, 0x13,
+0x88, 0x7A, 0x00, 0x7D, 0x53, 0x00, 0xC1, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x07, 0xC9, 0xCB, 0x38, 0x61, 0x6E,
+0x0D, 0x55, 0xBB, 0x39, 0x45, 0x07, 0x06, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x11, 0x41, 0x42,
+0x48, 0x40, 0x00, 0x41, 0x45, 0x48, 0x41, 0x43, 0x42, 0x40, 0x03, 0x43, 0x48, 0x43, 0x44, 0x45,
+0x40, 0x4A, 0x40, 0x01, 0x4A, 0x48, 0x4E, 0x45, 0x42, 0x43, 0x40, 0x01, 0x42, 0x44, 0x42, 0x43,
+0x01, 0x42, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x43, 0x4E, 0xC6, 0x49, 0x53, 0x26, 0x31, 0x03, 0x04, 0x00, 0x00, 0x45, 0x4A,
+0x41, 0x4A, 0x00, 0x45, 0x48, 0x41, 0x40, 0x01, 0x42, 0x44, 0x45, 0x48, 0x45, 0x52, 0x40, 0x00,
+0x71, 0x4B, 0x7A, 0x43, 0x40, 0x01, 0x44, 0x42, 0x45, 0x48, 0x45, 0x40, 0x10, 0x41, 0x40, 0x19,
+0x41, 0x40, 0x07, 0x68, 0x7F, 0x77, 0xC0, 0x60, 0x00, 0xCA, 0x4A, 0x54, 0x36, 0x37, 0x30, 0x54,
+0x3F, 0x17, 0x30, 0x54, 0x17, 0x00, 0x7F, 0x5E, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x62,
+0x5E, 0x4F, 0x62, 0xC9, 0x54, 0x0F, 0x3F, 0x49, 0x26, 0x58, 0x3F, 0x58, 0x02, 0x1E, 0x00, 0xD6,
+0x94, 0x80, 0x56, 0x64, 0x92, 0x64, 0xBE, 0x6F, 0x56, 0x88, 0x4C, 0xA9, 0x6A, 0x6F, 0x13, 0x6F,
+0x56, 0x3D, 0x41, 0x97, 0x09, 0x97, 0x09, 0x03, 0xCB, 0x41, 0x20, 0x1A, 0x10, 0x72, 0x66, 0xA5,
+0x88, 0x1A, 0x41, 0x10, 0x09, 0x04, 0x50, 0x42, 0x03, 0x48, 0x4A, 0x42, 0x4A, 0x63, 0x4E, 0x42,
+0x41, 0x40, 0x00, 0x7A, 0xDF, 0xE3, 0x9B, 0x65, 0xAF, 0x0B, 0x6B, 0x7A, 0x53, 0x11, 0x42, 0x4A,
+0x11, 0x35, 0x49, 0x08, 0x73, 0x0E, 0x26, 0x73, 0x4A, 0x36, 0x73, 0x23, 0xC5, 0x32, 0x0E, 0x84,
+0x32, 0x53, 0x1C, 0x8A, 0x9D, 0xC6, 0x8A, 0x9D, 0x16, 0x3F, 0xC5, 0x32, 0x11, 0x00, 0x4E, 0xC3,
+0x51, 0xAF, 0x47, 0x31, 0x00, 0xC2, 0x47, 0x31, 0x47, 0x00, 0x40, 0xD3, 0x47, 0x6B, 0x3A, 0x59,
+0x11, 0x2F, 0x8F, 0x2F, 0x6C, 0x64, 0x65, 0x6B, 0x0B, 0xAF, 0x7C, 0x4C, 0x1C, 0x00, 0x12, 0x00,
+0x00, 0x45, 0x43, 0x4E, 0x4C, 0x48, 0x42, 0x4E, 0x42, 0x03, 0x41, 0x42, 0x48, 0x41, 0x4A, 0x48,
+0x44, 0x00, 0x40, 0x41, 0x48, 0x40, 0x0B, 0xC2, 0x6B, 0x3D, 0x13, 0x00, 0xCD, 0x8B, 0x6F, 0x88,
+0x64, 0x88, 0x8B, 0x88, 0x65, 0x56, 0x6F, 0xDF, 0x7A, 0x3D, 0x13, 0x00, 0xC1, 0x6B, 0x00, 0x0D,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07,
+0x05, 0x4D, 0x47, 0x00, 0x78, 0xC8, 0x46, 0x45, 0xBB, 0x0D, 0x55, 0x38, 0x6E, 0x4D, 0x07, 0x07,
+0x6E, 0xC1, 0x81, 0x00, 0x13, 0x45, 0x48, 0x40, 0x00, 0x42, 0x48, 0x41, 0x40, 0x44, 0x42, 0x40,
+0x02, 0x45, 0x4E, 0x48, 0x4E, 0x43, 0x42, 0x45, 0x4A, 0x41, 0x40, 0x00, 0x4A, 0x45, 0x43, 0x44,
+0x41, 0x48, 0x40, 0x01, 0x42, 0x43, 0x5C, 0x43, 0x45, 0x42, 0x43, 0x40, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x44, 0x41, 0x4B, 0x43,
+0x48, 0xC3, 0x53, 0x03, 0x01, 0x00, 0x00, 0x41, 0x4A, 0x48, 0x44, 0x45, 0x4A, 0x42, 0x40, 0x02,
+0x42, 0x45, 0x44, 0x4A, 0x43, 0x4F, 0x40, 0x71, 0x40, 0x00, 0x41, 0x44, 0x41, 0x45, 0x40, 0x42,
+0x45, 0x43, 0x4A, 0x44, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x68, 0x57, 0x00,
+0xC0, 0x54, 0x00, 0x70, 0x77, 0xC0, 0x54, 0x00, 0xC1, 0x60, 0x54, 0x00, 0xC1, 0x49, 0x54, 0x00,
+0x70, 0x77, 0x57, 0x4F, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x5E, 0x4F, 0x5E, 0x62, 0x66,
+0x4F, 0x66, 0x62, 0xC2, 0x60, 0x36, 0x30, 0x00, 0x4F, 0x5E, 0x00, 0xC7, 0x7C, 0x7D, 0x6A, 0x56,
+0x8B, 0x61, 0x13, 0x56, 0x00, 0xC6, 0x4C, 0x88, 0x76, 0x80, 0x94, 0x3D, 0x56, 0x00, 0xC2, 0xBE,
+0x13, 0x09, 0x07, 0x60, 0x73, 0x60, 0x01, 0xC7, 0x78, 0x9E, 0x1A, 0x20, 0x41, 0x09, 0x15, 0x09,
+0x01, 0xC3, 0x62, 0x1B, 0x16, 0x02, 0x02, 0x4E, 0x00, 0x48, 0x42, 0x48, 0x00, 0x42, 0x40, 0x01,
+0x7A, 0xCA, 0x84, 0x34, 0xB8, 0x01, 0xD9, 0x2D, 0x7C, 0x76, 0x11, 0x42, 0x5A, 0x00, 0x4C, 0x4E,
+0x00, 0xD3, 0x68, 0x4A, 0x0E, 0x68, 0x23, 0x0E, 0x35, 0x23, 0x0E, 0x23, 0x0E, 0x36, 0x4A, 0x23,
+0x92, 0x44, 0x4C, 0xB8, 0x7A, 0x8A, 0x00, 0xC1, 0x44, 0x11, 0x01, 0xC2, 0x5A, 0x02, 0x05, 0x00,
+0x4F, 0xC6, 0xC5, 0x26, 0x89, 0x0A, 0x05, 0x01, 0x0F, 0x00, 0x7A, 0xCE, 0x58, 0x2F, 0x8F, 0xBC,
+0x5C, 0x2F, 0x34, 0x65, 0x6B, 0x2D, 0x0B, 0x7C, 0x56, 0xB8, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42,
+0x5C, 0x4A, 0x44, 0x42, 0x48, 0x42, 0x02, 0x44, 0x41, 0x40, 0x44, 0x48, 0x43, 0x42, 0x4E, 0x43,
+0x42, 0x4B, 0x44, 0x40, 0x0B, 0xC2, 0xB7, 0x3D, 0x13, 0x00, 0xC2, 0x7D, 0x6F, 0x7A, 0x00, 0xC4,
+0x6F, 0xBE, 0x6A, 0x13, 0x56, 0x00, 0x53, 0x01, 0xC3, 0x80, 0x13, 0xB7, 0x00, 0x0D, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07,
+0x07, 0x4D, 0xCA, 0x79, 0x4D, 0x87, 0x46, 0x45, 0xC3, 0xEC, 0x39, 0x38, 0x0D, 0x07, 0x07, 0xC2,
+0x81, 0x0B, 0x00, 0x11, 0x4B, 0x41, 0x5C, 0x41, 0x45, 0xC4, 0x6D, 0x0A, 0x04, 0x00, 0x02, 0x00,
+0x40, 0x02, 0x42, 0x00, 0x40, 0x42, 0x48, 0x01, 0x45, 0x40, 0x01, 0x43, 0x4A, 0x48, 0x41, 0x00,
+0x44, 0x40, 0x01, 0x41, 0x43, 0x48, 0x5F, 0x43, 0x48, 0x45, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x05, 0x45, 0x48, 0x43,
+0x44, 0x40, 0x03, 0x41, 0x44, 0x48, 0x43, 0x45, 0x40, 0x03, 0x52, 0x40, 0x02, 0x4B, 0x40, 0x19,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x62, 0x77, 0x57, 0x0A, 0x7F, 0x57, 0x01, 0x41, 0x52, 0x40,
+0x09, 0x41, 0x40, 0x0F, 0x67, 0x5E, 0x4F, 0x5E, 0x4F, 0x5E, 0x4F, 0xC3, 0xA2, 0x1E, 0x0F, 0x1E,
+0x00, 0x4F, 0x5E, 0x4F, 0x5E, 0x62, 0xC1, 0x7C, 0x13, 0x00, 0xC4, 0x94, 0x13, 0x94, 0x13, 0x3D,
+0x00, 0x53, 0xC3, 0x8B, 0x13, 0x3D, 0x13, 0x00, 0xC4, 0xBE, 0x3D, 0x13, 0x7A, 0x09, 0x00, 0x50,
+0x49, 0x50, 0x49, 0x50, 0x49, 0x55, 0x49, 0x01, 0xC2, 0x62, 0x09, 0x15, 0x00, 0x49, 0x55, 0xC0,
+0x62, 0x01, 0x55, 0x50, 0x49, 0x00, 0x50, 0x69, 0x42, 0x09, 0x41, 0x40, 0x00, 0x7A, 0xC0, 0x84,
+0x00, 0xC9, 0x65, 0x6B, 0x0B, 0x47, 0x4C, 0x76, 0x11, 0x42, 0x5A, 0x0C, 0x01, 0x72, 0x4C, 0x00,
+0xC1, 0x77, 0x0C, 0x00, 0xC2, 0x77, 0x23, 0x0C, 0x01, 0x72, 0x66, 0xC2, 0x4A, 0x63, 0x44, 0x00,
+0x56, 0x00, 0xC1, 0x7A, 0x16, 0x00, 0xC1, 0x63, 0x32, 0x00, 0x6F, 0x7B, 0xC0, 0x4A, 0x00, 0x7B,
+0x00, 0xD7, 0x4A, 0x11, 0x32, 0x42, 0x23, 0x11, 0x84, 0x4A, 0x84, 0x3B, 0x2F, 0x8F, 0x2F, 0x5C,
+0x11, 0x3B, 0x4C, 0x6B, 0x47, 0xAF, 0x65, 0x5B, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x09, 0x41, 0x40,
+0x01, 0x41, 0x40, 0x01, 0x41, 0x40, 0x0D, 0xC2, 0x6B, 0x3D, 0x13, 0x01, 0x7D, 0x53, 0xC4, 0x7D,
+0x13, 0x7D, 0x3D, 0x13, 0x00, 0x7D, 0xC1, 0x94, 0x3D, 0x00, 0x53, 0x00, 0xC1, 0x6B, 0x00, 0x0D,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC3, 0xD6, 0x07,
+0x2E, 0x07, 0x00, 0x6E, 0x47, 0x00, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x4D, 0x6E, 0x47, 0x6E, 0x47,
+0x01, 0x6E, 0x47, 0x00, 0x6E, 0x47, 0x01, 0x4D, 0x47, 0xC2, 0x79, 0x0B, 0x00, 0x11, 0x4B, 0x41,
+0x40, 0xC0, 0x47, 0x00, 0x40, 0x00, 0x41, 0x40, 0x0C, 0x41, 0x43, 0x48, 0x43, 0x41, 0x40, 0x01,
+0x41, 0x40, 0x42, 0x48, 0x00, 0x42, 0x40, 0x00, 0x52, 0x4B, 0x40, 0x01, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x06, 0x41, 0x52, 0x41,
+0x00, 0x40, 0x04, 0x41, 0x01, 0x40, 0x25, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x62, 0x57, 0x01,
+0x7F, 0x57, 0x68, 0x57, 0x02, 0x77, 0x57, 0x00, 0x7F, 0x57, 0x77, 0x68, 0x4F, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x52, 0x41, 0x5E, 0x01, 0x4F, 0x5E, 0x4F, 0x5E, 0x4F, 0x5E, 0x4F, 0x5E, 0x00, 0x41,
+0x5E, 0x67, 0xC1, 0x7C, 0x13, 0x00, 0xC1, 0x94, 0x7A, 0x01, 0x53, 0xD7, 0x7A, 0x3D, 0x13, 0x94,
+0x3D, 0x13, 0x94, 0x13, 0x65, 0x3D, 0x13, 0x10, 0x09, 0x41, 0x10, 0x41, 0x09, 0x41, 0x15, 0x10,
+0x41, 0x10, 0x1B, 0x10, 0x00, 0xCD, 0x41, 0x10, 0x1B, 0x10, 0x09, 0x41, 0x15, 0x10, 0x41, 0x09,
+0x41, 0x16, 0x1C, 0x02, 0x09, 0x40, 0x01, 0xC4, 0x93, 0xD1, 0x6C, 0x76, 0x7C, 0x00, 0xC7, 0x7A,
+0x4C, 0x9B, 0x2B, 0x42, 0x5A, 0x23, 0x0C, 0x0C, 0xC1, 0x59, 0x4A, 0x00, 0x72, 0xC2, 0x77, 0x9E,
+0x64, 0x00, 0x4C, 0xC3, 0x64, 0x32, 0x2B, 0x11, 0x00, 0x6F, 0x51, 0x00, 0xC1, 0x42, 0x2B, 0x00,
+0x51, 0x6F, 0xC0, 0xA6, 0x00, 0xC2, 0x42, 0x2F, 0x11, 0x00, 0x6A, 0xC0, 0x8F, 0x00, 0x51, 0x6A,
+0xC9, 0x5C, 0x11, 0x34, 0xD4, 0x6B, 0x7C, 0xB6, 0x83, 0x59, 0x00, 0x02, 0x45, 0x42, 0x09, 0x41,
+0x40, 0x15, 0xC4, 0xAF, 0x7A, 0x3D, 0x7A, 0x13, 0x03, 0x7D, 0x53, 0x7D, 0xC2, 0x7A, 0x94, 0x7A,
+0x01, 0xC3, 0x8B, 0x13, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0xC1, 0xD6, 0x0D, 0x08, 0xC1, 0x79, 0x0D, 0x0F, 0x47, 0xC2, 0x81, 0x0B, 0x00,
+0x10, 0x4B, 0x40, 0x01, 0x4B, 0x40, 0x11, 0x41, 0x01, 0x40, 0x04, 0x41, 0x02, 0x40, 0x05, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x48, 0x43, 0x48, 0x08, 0x43, 0x48, 0x0E, 0x43, 0x48,
+0x03, 0x43, 0x48, 0x00, 0x43, 0x48, 0x06, 0x43, 0x48, 0x06, 0xC6, 0x59, 0x3E, 0x3B, 0x4A, 0x86,
+0x03, 0x08, 0x1B, 0x43, 0x48, 0x18, 0x43, 0x48, 0x00, 0xC2, 0x6D, 0x26, 0x08, 0x01, 0xC0, 0x49,
+0x01, 0xC7, 0x54, 0x49, 0x54, 0x49, 0x54, 0x49, 0x54, 0x49, 0x00, 0xC7, 0x54, 0x49, 0x54, 0x49,
+0x54, 0x49, 0x30, 0x08, 0x0B, 0x43, 0x48, 0x0B, 0xC3, 0x6D, 0x26, 0x08, 0x30, 0x00, 0x48, 0xCF,
+0x58, 0x30, 0x58, 0x30, 0x58, 0x30, 0x58, 0x30, 0x58, 0x30, 0x08, 0x58, 0x30, 0x49, 0xA9, 0x6F,
+0x00, 0xC1, 0x88, 0x6F, 0x00, 0xCA, 0x88, 0x6F, 0xA9, 0x1A, 0x6F, 0x88, 0x1A, 0x6F, 0x88, 0x6F,
+0xA9, 0x00, 0xC4, 0x72, 0xAB, 0x1A, 0x72, 0x1A, 0x00, 0xC2, 0x72, 0x1A, 0x72, 0x01, 0xC6, 0x92,
+0x72, 0x1A, 0x72, 0x1A, 0xAB, 0x72, 0x00, 0x5A, 0xC3, 0x72, 0x1A, 0xAB, 0x72, 0x00, 0xC1, 0xAB,
+0x92, 0x00, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x01, 0x4E, 0x4A, 0x01, 0x48, 0x01, 0x42, 0xC9, 0xE3,
+0x75, 0x9B, 0x53, 0x4C, 0x50, 0x3E, 0x2B, 0xA7, 0x5A, 0x00, 0x4C, 0x00, 0xC3, 0x77, 0x0C, 0x23,
+0x0C, 0x00, 0x63, 0x4C, 0x03, 0x63, 0x75, 0x66, 0x7B, 0xC1, 0x42, 0xE6, 0x00, 0xC5, 0xA6, 0x73,
+0xA6, 0x42, 0x11, 0xA6, 0x00, 0xC3, 0x42, 0x2B, 0x11, 0x8F, 0x00, 0x6F, 0x6A, 0xC9, 0x5C, 0x32,
+0x4A, 0x23, 0x4A, 0x32, 0x84, 0x2F, 0x2A, 0x2F, 0x00, 0xC0, 0x8F, 0x00, 0xCA, 0x4A, 0xB0, 0x84,
+0x11, 0x34, 0x50, 0x53, 0x34, 0x6C, 0xC7, 0x08, 0x01, 0x43, 0x4A, 0x00, 0x4E, 0x4A, 0x4E, 0x4A,
+0x4E, 0x4A, 0x4E, 0x00, 0x4A, 0x4E, 0x48, 0x43, 0x48, 0x14, 0xCC, 0x6D, 0xA9, 0x6F, 0x88, 0x6F,
+0x88, 0x6F, 0xA9, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x00, 0xC3, 0x88, 0x6F, 0x88, 0x6F, 0x00, 0xC3,
+0x53, 0x08, 0x26, 0x08, 0x0A, 0x43, 0x48, 0x13, 0x43, 0x48, 0x09, 0x43, 0x48, 0x10, 0x43, 0x48,
+0x03, 0x66, 0xCC, 0x74, 0x6F, 0x39, 0xA0, 0x61, 0xA0, 0xB9, 0xA0, 0x61, 0xA0, 0x61, 0xA0, 0x61,
+0x03, 0xC2, 0xB9, 0xA0, 0x61, 0x00, 0xC7, 0xA0, 0x61, 0xA0, 0xB9, 0xA0, 0x61, 0xA0, 0x61, 0x00,
+0xC4, 0xB9, 0xA0, 0x74, 0x30, 0x08, 0x0A, 0x66, 0x48, 0x00, 0xC4, 0x86, 0x34, 0x3B, 0x0E, 0x08,
+0x00, 0x43, 0x48, 0x13, 0x43, 0x48, 0x03, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x07, 0x43, 0x48,
+0x03, 0x43, 0x48, 0x0C, 0x42, 0x41, 0x42, 0x40, 0x41, 0x40, 0x05, 0x41, 0x00, 0x40, 0x0D, 0x41,
+0x00, 0x40, 0x41, 0x40, 0x16, 0x71, 0x6D, 0xC4, 0x6C, 0x2B, 0x34, 0x01, 0x00, 0x19, 0x41, 0x00,
+0x40, 0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x41, 0x40, 0x00, 0x52, 0x40, 0x4B, 0x40, 0x00, 0x68,
+0x7F, 0x77, 0x57, 0x77, 0x57, 0x77, 0x57, 0x77, 0x57, 0x77, 0x57, 0x77, 0x57, 0x7F, 0x57, 0x77,
+0x57, 0x4F, 0x52, 0x4B, 0x40, 0x08, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x67, 0x4F, 0x62, 0x4F,
+0x62, 0x4F, 0x62, 0x4F, 0x62, 0x4F, 0x62, 0x4F, 0x62, 0x4F, 0x62, 0x5E, 0xC2, 0xA2, 0x8A, 0x13,
+0x00, 0xC1, 0x7A, 0x13, 0x00, 0xC4, 0x7A, 0x13, 0x7A, 0x13, 0x7A, 0x00, 0xC2, 0x94, 0x65, 0x7A,
+0x00, 0x53, 0xCC, 0x65, 0x13, 0x10, 0x09, 0x10, 0x09, 0x10, 0x09, 0x10, 0x09, 0x15, 0x10, 0x09,
+0x00, 0x50, 0x00, 0x49, 0x50, 0x49, 0x55, 0x50, 0x49, 0x50, 0x49, 0x00, 0x50, 0x49, 0x50, 0x5C,
+0x42, 0x09, 0x41, 0x40, 0x00, 0x4F, 0xC3, 0x84, 0xBC, 0x2A, 0x11, 0x01, 0x6B, 0xC5, 0x5C, 0x36,
+0x3F, 0x5A, 0x0C, 0x8D, 0x01, 0x4E, 0x02, 0x63, 0x4E, 0x63, 0x4E, 0xC0, 0x8D, 0x00, 0x72, 0x66,
+0x51, 0xC7, 0xA6, 0x4A, 0x0E, 0x59, 0x3B, 0xA6, 0x2B, 0x32, 0x00, 0x7E, 0xC3, 0x59, 0x86, 0x11,
+0x8F, 0x01, 0x51, 0x6B, 0x63, 0xD1, 0x59, 0x0E, 0x35, 0x08, 0xBD, 0x84, 0x2A, 0x5C, 0x8F, 0x2F,
+0x84, 0xE8, 0x3F, 0x3E, 0x2F, 0x4A, 0x3B, 0x11, 0x00, 0xC4, 0x6C, 0x95, 0x00, 0x31, 0x00, 0x00,
+0x45, 0x42, 0x00, 0x44, 0x42, 0x06, 0x41, 0x40, 0x15, 0xC5, 0xB7, 0x65, 0x13, 0x7A, 0x3D, 0x7A,
+0x05, 0x53, 0xC3, 0x7A, 0x13, 0x7A, 0x13, 0x00, 0xC5, 0x7A, 0x7C, 0x00, 0x31, 0x0B, 0x00, 0x09,
+0x41, 0x00, 0x40, 0x10, 0x41, 0x40, 0x41, 0x40, 0x08, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x00, 0x40,
+0x41, 0x40, 0x02, 0x4B, 0x67, 0x71, 0xC3, 0xD6, 0x2E, 0xBA, 0x07, 0x00, 0xC1, 0xBA, 0x07, 0x01,
+0xC4, 0xBA, 0x07, 0x2E, 0x0D, 0x2E, 0x01, 0x47, 0x00, 0x6E, 0x47, 0xC1, 0xBA, 0x07, 0x00, 0xC1,
+0xBA, 0x07, 0x01, 0xC5, 0xBA, 0x0D, 0x07, 0x81, 0x47, 0x00, 0x0B, 0x4B, 0x71, 0x40, 0xC1, 0xC5,
+0x2B, 0x00, 0xC5, 0x44, 0x12, 0x2D, 0x47, 0x0B, 0x00, 0x24, 0x41, 0x00, 0x40, 0x05, 0x41, 0x01,
+0x40, 0x08, 0x41, 0x45, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x71, 0x6D,
+0xC4, 0x9C, 0x6C, 0xE8, 0x0B, 0x00, 0x19, 0x41, 0x40, 0x19, 0x41, 0x40, 0x03, 0x52, 0x40, 0x01,
+0x62, 0x77, 0x57, 0x03, 0x68, 0x57, 0x77, 0x57, 0x05, 0x7F, 0x41, 0x40, 0x52, 0x40, 0x08, 0x41,
+0x40, 0x0F, 0x52, 0x4F, 0x5E, 0x4F, 0x5E, 0x00, 0x67, 0x5E, 0x00, 0x4F, 0x5E, 0x00, 0x67, 0x5E,
+0x4F, 0x5E, 0x00, 0xC1, 0x94, 0x13, 0x01, 0x7D, 0x53, 0x04, 0xC8, 0x7D, 0x13, 0x7D, 0x13, 0x80,
+0x3D, 0x13, 0x41, 0x09, 0x0F, 0x50, 0x49, 0x01, 0x55, 0x49, 0x01, 0x5B, 0x69, 0x42, 0x09, 0x71,
+0x6D, 0x4B, 0x65, 0xC1, 0xE3, 0xBC, 0x00, 0x6A, 0x01, 0xCA, 0x5C, 0x3C, 0x4A, 0x54, 0x36, 0x0C,
+0x9E, 0x8D, 0x23, 0x0C, 0x23, 0x02, 0xC1, 0x8D, 0x23, 0x01, 0x4C, 0x00, 0xCF, 0x58, 0x23, 0xB5,
+0x53, 0x51, 0x4F, 0x44, 0x68, 0xA6, 0x68, 0x64, 0x51, 0x8A, 0x1C, 0x3B, 0x2F, 0x01, 0xD2, 0x84,
+0x11, 0x23, 0x03, 0x23, 0x35, 0x63, 0x02, 0x8F, 0x2F, 0x9B, 0x2F, 0x8F, 0x84, 0x63, 0x26, 0x3F,
+0xA4, 0x2F, 0x01, 0xC3, 0x8F, 0xBC, 0x89, 0x00, 0x02, 0x45, 0x42, 0x09, 0x41, 0x40, 0x15, 0xC1,
+0x6B, 0x13, 0x01, 0xC1, 0x7D, 0x13, 0x03, 0x7D, 0x53, 0x00, 0x7D, 0x53, 0x03, 0xC1, 0x6B, 0x00,
+0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00,
+0xC1, 0xB2, 0x07, 0x00, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x4D, 0x01, 0x47, 0x00, 0x4D, 0x00, 0x47,
+0x00, 0x4D, 0xC1, 0x79, 0x07, 0x01, 0x6E, 0x47, 0x02, 0x4D, 0x6E, 0xC1, 0x81, 0x00, 0x0F, 0xC4,
+0x67, 0x75, 0xCE, 0x00, 0x2D, 0x00, 0x52, 0x40, 0x4B, 0x40, 0x23, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x65, 0x62, 0x4B, 0x42,
+0x44, 0x42, 0x40, 0x02, 0x42, 0x44, 0x45, 0x40, 0x42, 0x45, 0x40, 0x02, 0x65, 0x5F, 0x40, 0x5C,
+0x45, 0x40, 0x67, 0xC8, 0x63, 0x01, 0x0B, 0x01, 0x05, 0x00, 0x01, 0x00, 0x01, 0x01, 0x5C, 0x62,
+0x40, 0x10, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x68, 0x57, 0x00, 0xC2, 0x60, 0x30, 0x37, 0x00,
+0x70, 0x00, 0x57, 0x00, 0xC8, 0x60, 0x17, 0x37, 0x30, 0x60, 0x17, 0x3F, 0x1E, 0x00, 0x0A, 0x41,
+0x40, 0x0F, 0x52, 0x4F, 0x5E, 0xC4, 0x40, 0x4F, 0x36, 0x03, 0x90, 0x00, 0x62, 0xC5, 0x90, 0x22,
+0x04, 0x3F, 0x0F, 0x1E, 0x00, 0xC1, 0x7C, 0x13, 0x01, 0xC3, 0x56, 0x94, 0x3D, 0x13, 0x01, 0xC0,
+0xCC, 0x00, 0x53, 0x01, 0xC6, 0xCC, 0x65, 0x80, 0x13, 0x97, 0x62, 0x09, 0x05, 0x50, 0xC2, 0x7B,
+0x20, 0x10, 0x00, 0x60, 0xC2, 0x82, 0x33, 0x09, 0x02, 0x55, 0x49, 0xC3, 0x97, 0x62, 0x10, 0x02,
+0x04, 0x48, 0x42, 0x00, 0x48, 0x44, 0x42, 0x41, 0x40, 0x00, 0x7A, 0xC2, 0xE3, 0xBC, 0x2A, 0x01,
+0xC6, 0x42, 0x2F, 0x3F, 0x85, 0x26, 0x58, 0x0C, 0x00, 0xC1, 0x8D, 0x23, 0x01, 0x4C, 0xC0, 0x8D,
+0x00, 0xCD, 0x64, 0x23, 0x9E, 0x23, 0x8D, 0x0C, 0x58, 0x84, 0x50, 0x76, 0x51, 0xB8, 0x04, 0x58,
+0x00, 0xC1, 0x70, 0x6D, 0x00, 0xC4, 0x4C, 0x9D, 0x44, 0x84, 0x2F, 0x02, 0x72, 0x01, 0x7B, 0x6F,
+0xD1, 0x9B, 0x2F, 0x11, 0x4A, 0x2F, 0x9B, 0x11, 0x84, 0x3F, 0x9A, 0x36, 0x11, 0x3B, 0x9B, 0x3B,
+0x8F, 0x63, 0x00, 0x02, 0x45, 0x42, 0x00, 0x44, 0x42, 0x43, 0x00, 0x42, 0x03, 0x45, 0x40, 0x15,
+0xC4, 0x6B, 0x3D, 0x13, 0x8B, 0x13, 0x00, 0xCB, 0xCC, 0x4C, 0x13, 0x7D, 0x4C, 0x7D, 0x13, 0x6A,
+0xCC, 0x3D, 0x7D, 0x13, 0x00, 0xC1, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0x4D, 0x00, 0x47, 0x4D, 0xC8, 0x45,
+0x4D, 0x0D, 0x07, 0xBA, 0x0D, 0x45, 0xBA, 0x07, 0x08, 0xC2, 0x81, 0x0B, 0x00, 0x0E, 0x61, 0x44,
+0x40, 0x6D, 0x41, 0x5F, 0x4B, 0x40, 0x65, 0x44, 0x45, 0x4B, 0x44, 0x45, 0x40, 0x02, 0x41, 0x40,
+0x42, 0x40, 0x45, 0x42, 0x00, 0x41, 0x40, 0x4B, 0x71, 0x61, 0x44, 0x42, 0x40, 0x41, 0x45, 0x40,
+0x02, 0x42, 0x00, 0x40, 0x00, 0x45, 0x41, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x48, 0x4E, 0x4B, 0x4A, 0x44, 0xC2,
+0x53, 0x28, 0x00, 0x00, 0x41, 0x4E, 0x44, 0x48, 0x43, 0x00, 0x48, 0x40, 0x01, 0x41, 0xC6, 0x64,
+0x04, 0x02, 0x53, 0x58, 0x31, 0x00, 0x01, 0x41, 0xC2, 0x53, 0x0A, 0x00, 0x00, 0x45, 0x4E, 0x42,
+0x56, 0x48, 0xC1, 0x58, 0x00, 0x00, 0x4B, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x62,
+0x77, 0x00, 0xD0, 0x54, 0x30, 0x49, 0x54, 0x85, 0x49, 0x30, 0x60, 0x0C, 0x60, 0x30, 0x49, 0x54,
+0x37, 0x17, 0x0F, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x62, 0x4F, 0xC6, 0x40, 0x51, 0x30, 0x04,
+0x58, 0x60, 0x26, 0x02, 0xCC, 0x60, 0x0F, 0x1E, 0x22, 0x7C, 0x80, 0xBE, 0x56, 0xC4, 0x7A, 0x56,
+0x9E, 0x56, 0x00, 0xCA, 0x9E, 0x56, 0x3D, 0x8B, 0x56, 0x9E, 0x56, 0x7D, 0x41, 0x10, 0x09, 0x06,
+0xC6, 0xDE, 0x78, 0x20, 0x72, 0x1A, 0x33, 0x78, 0x00, 0xC2, 0x82, 0x15, 0x09, 0x04, 0x5B, 0x42,
+0x03, 0x4E, 0x48, 0x4E, 0x4A, 0x4E, 0xC3, 0x44, 0x02, 0x01, 0x00, 0x00, 0x5F, 0xC8, 0xE3, 0x75,
+0x11, 0x34, 0x76, 0x53, 0x4A, 0x0E, 0xA4, 0x00, 0x66, 0x4C, 0x63, 0xC0, 0x8D, 0x00, 0x63, 0xC0,
+0x8D, 0x00, 0x63, 0x00, 0xC1, 0x8D, 0x23, 0x00, 0xD0, 0x9E, 0x0E, 0x0C, 0x5A, 0x4A, 0x8A, 0x4F,
+0xAF, 0x8A, 0x6D, 0x53, 0x50, 0x6D, 0x6A, 0x51, 0xAF, 0xC0, 0x00, 0x7E, 0x51, 0x00, 0x72, 0x7B,
+0xC0, 0x42, 0x00, 0xC1, 0x68, 0x42, 0x00, 0x6A, 0x51, 0x7B, 0x6F, 0x01, 0x51, 0xC5, 0x84, 0xA4,
+0x9A, 0x4A, 0x53, 0xB8, 0x00, 0xC5, 0x52, 0x9B, 0x63, 0x00, 0x31, 0x00, 0x00, 0x45, 0x42, 0x44,
+0x4C, 0x43, 0x4E, 0x00, 0x48, 0x42, 0x02, 0x41, 0x40, 0x15, 0xC6, 0x6B, 0x3D, 0x13, 0x80, 0x3D,
+0x80, 0x88, 0x00, 0xC8, 0x94, 0xCD, 0xC2, 0x4C, 0x6F, 0x6A, 0x56, 0x7D, 0x13, 0x01, 0xC1, 0x6B,
+0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2,
+0x07, 0x08, 0x78, 0x79, 0xC7, 0x61, 0x39, 0xC6, 0x0D, 0x55, 0xD5, 0x79, 0x07, 0x06, 0x4D, 0x6E,
+0xC1, 0x81, 0x00, 0x12, 0x41, 0x4A, 0xC1, 0x53, 0x00, 0x00, 0x48, 0x44, 0x48, 0x00, 0x43, 0x48,
+0x40, 0x03, 0x42, 0x63, 0x41, 0x43, 0x02, 0x40, 0x4B, 0x40, 0x4A, 0x43, 0x4A, 0x45, 0xC2, 0x86,
+0x0A, 0x00, 0x01, 0x45, 0xC8, 0x58, 0x08, 0x02, 0x1F, 0x0E, 0x05, 0x00, 0x01, 0x00, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x41, 0x4A, 0xC6, 0x49,
+0x02, 0x50, 0x00, 0x02, 0x30, 0x00, 0x00, 0x41, 0x4E, 0x48, 0x4A, 0x48, 0x41, 0x48, 0x41, 0x40,
+0x00, 0x41, 0xC6, 0x44, 0x04, 0x00, 0x02, 0x0A, 0x27, 0x00, 0x00, 0x41, 0x4B, 0x42, 0x43, 0x40,
+0x00, 0x41, 0x43, 0x42, 0x4B, 0x42, 0x4A, 0x52, 0x40, 0x0F, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07,
+0x68, 0x57, 0x7F, 0xC0, 0x54, 0x00, 0x66, 0xC1, 0x49, 0x37, 0x00, 0xC2, 0x54, 0x49, 0x54, 0x00,
+0x68, 0x77, 0xC4, 0x54, 0x37, 0x3F, 0x1E, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x41, 0xCD, 0x40,
+0x1E, 0x44, 0x5A, 0x30, 0x58, 0x1E, 0x4A, 0x02, 0x54, 0x49, 0x26, 0x0F, 0x1E, 0x00, 0xC3, 0x7C,
+0x13, 0x80, 0x88, 0x00, 0xD0, 0x6A, 0x65, 0xA9, 0x56, 0x3D, 0x6F, 0x6A, 0x13, 0x4C, 0x13, 0x6F,
+0x76, 0x80, 0x13, 0x97, 0x15, 0x09, 0x04, 0x50, 0x73, 0xC2, 0x72, 0x1B, 0x78, 0x00, 0xC8, 0x7A,
+0x10, 0x66, 0x20, 0x41, 0x10, 0x09, 0x15, 0x09, 0x00, 0xC2, 0x62, 0x10, 0x02, 0x04, 0x43, 0x4A,
+0x00, 0x48, 0x4A, 0x42, 0x41, 0x40, 0x00, 0x7A, 0xCB, 0xE3, 0x2F, 0x52, 0x7A, 0xD8, 0x7C, 0x9D,
+0x64, 0x2A, 0x4A, 0x5A, 0x0C, 0x00, 0x63, 0x00, 0x4C, 0x63, 0xC2, 0x9E, 0x0C, 0x23, 0x01, 0x4C,
+0x63, 0x00, 0x75, 0xDA, 0x5A, 0x4A, 0x28, 0x0B, 0xAF, 0x4C, 0x70, 0x71, 0x6A, 0x6F, 0x70, 0x6D,
+0x21, 0x00, 0x2D, 0x3E, 0x5C, 0x4A, 0x59, 0x71, 0x3E, 0x88, 0x0E, 0x86, 0x3E, 0x42, 0x4A, 0x00,
+0xCE, 0x84, 0x11, 0x2F, 0x8F, 0x5C, 0x2F, 0x3B, 0x52, 0x7C, 0x6B, 0xE9, 0xE4, 0x50, 0x63, 0x00,
+0x02, 0x45, 0x42, 0x48, 0x4E, 0x4A, 0x48, 0x44, 0x4A, 0x42, 0x02, 0x41, 0x40, 0x15, 0xC6, 0x6B,
+0x3D, 0x13, 0xBE, 0x3D, 0x4C, 0x64, 0x00, 0xCC, 0x56, 0x4C, 0xA9, 0x56, 0x66, 0x6F, 0x50, 0x3D,
+0x13, 0x80, 0x13, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x07, 0xC1, 0xB2, 0x07, 0x07, 0x4D, 0xC9, 0xCB, 0x81, 0x61, 0x6E, 0x79, 0x4B, 0x4E, 0x87,
+0xC6, 0x07, 0x08, 0xC2, 0x81, 0x0B, 0x00, 0x0F, 0x41, 0x40, 0x4B, 0x42, 0x43, 0x40, 0x4B, 0x40,
+0x42, 0x48, 0xC4, 0x53, 0x01, 0x53, 0x1F, 0x00, 0x02, 0x48, 0x00, 0x43, 0x44, 0x45, 0x40, 0x4A,
+0x41, 0x40, 0x00, 0x4A, 0x48, 0x4E, 0xC3, 0xAA, 0x02, 0x03, 0x00, 0x01, 0x44, 0x00, 0x42, 0xC6,
+0x51, 0x02, 0x0A, 0x05, 0x00, 0x01, 0x00, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0xC8, 0x51, 0x0A, 0x49, 0x0A, 0x53, 0x01, 0x03, 0x04, 0x00, 0x00,
+0x45, 0x4A, 0x41, 0x4A, 0x00, 0x42, 0x48, 0x41, 0x40, 0x01, 0x5C, 0x44, 0x42, 0x61, 0x43, 0x68,
+0x40, 0x02, 0x41, 0x48, 0x40, 0x01, 0x44, 0x42, 0x00, 0x45, 0x70, 0x5F, 0x40, 0x4B, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x68, 0x57, 0x77, 0x70, 0xC1, 0x60, 0x54, 0x00, 0x77, 0x70,
+0xC7, 0x54, 0x4A, 0x49, 0x23, 0x30, 0x0E, 0x37, 0x17, 0x00, 0x4F, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x52, 0x4F, 0x00, 0xD9, 0x40, 0x51, 0x30, 0x0A, 0x26, 0x3F, 0x49, 0x30, 0x58, 0x3F, 0x49, 0x3F,
+0x1E, 0x0F, 0x7C, 0x8B, 0x56, 0x9E, 0xA9, 0x64, 0x94, 0x6F, 0x4E, 0xDF, 0x6A, 0x56, 0x00, 0xC4,
+0x6A, 0x94, 0x6F, 0x56, 0x80, 0x00, 0x50, 0xC1, 0x62, 0x09, 0x04, 0xCD, 0x41, 0x82, 0x1A, 0x10,
+0x72, 0x78, 0x1A, 0x20, 0x33, 0x1A, 0x1B, 0x09, 0x10, 0x09, 0x02, 0x5B, 0x5C, 0x42, 0x02, 0x48,
+0x4E, 0x42, 0x43, 0x42, 0x4E, 0x42, 0x41, 0x40, 0x00, 0x4F, 0x7E, 0xCA, 0x9B, 0x9D, 0xAF, 0x31,
+0x0B, 0x8A, 0x76, 0x11, 0x42, 0x5A, 0x23, 0x00, 0xC2, 0x9E, 0x8D, 0x0E, 0x00, 0x63, 0x00, 0xC0,
+0x8D, 0x00, 0x4E, 0xD9, 0x64, 0x9E, 0x23, 0x77, 0x54, 0x4A, 0x05, 0x0B, 0x51, 0x6F, 0x56, 0x7A,
+0x94, 0x7A, 0x4C, 0x6D, 0x51, 0x1F, 0x0B, 0xA7, 0x11, 0x2F, 0x59, 0x53, 0x56, 0x4C, 0x00, 0xC6,
+0x8A, 0x71, 0x32, 0x0E, 0x89, 0x84, 0x2F, 0x02, 0x51, 0xC8, 0x64, 0x65, 0xE9, 0x47, 0x00, 0xB7,
+0x4C, 0xB8, 0x00, 0x02, 0x45, 0x43, 0x4E, 0x4C, 0x4A, 0x00, 0x48, 0x4A, 0x42, 0x02, 0x41, 0x40,
+0x15, 0xC2, 0x6B, 0x3D, 0x13, 0x00, 0xCC, 0x80, 0x6F, 0x88, 0x64, 0xA9, 0x94, 0xA9, 0x4C, 0x88,
+0x4C, 0x88, 0x3D, 0x13, 0x01, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x05, 0xC1, 0xCB, 0x0D, 0x00, 0x78, 0xC8,
+0x4D, 0xC3, 0xBB, 0x0D, 0x4D, 0x88, 0xC2, 0xC6, 0x07, 0x06, 0x4D, 0x47, 0xC1, 0x81, 0x00, 0x12,
+0xCC, 0x47, 0x0F, 0x08, 0x00, 0x0B, 0x04, 0x08, 0x01, 0x50, 0x02, 0x08, 0x01, 0x00, 0x01, 0x45,
+0x4E, 0x43, 0x4E, 0x43, 0x42, 0x00, 0x48, 0x40, 0x4B, 0x40, 0x4A, 0x45, 0x43, 0x44, 0x41, 0x48,
+0x40, 0x01, 0x42, 0x43, 0x44, 0x43, 0xC5, 0x53, 0x8D, 0x89, 0x00, 0x01, 0x00, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x44, 0x41, 0x40, 0xC5, 0x44,
+0x59, 0x98, 0x50, 0x27, 0x00, 0x01, 0x48, 0x00, 0x42, 0x45, 0x48, 0x42, 0x40, 0x02, 0x61, 0x68,
+0x41, 0x43, 0x00, 0x40, 0x03, 0x41, 0x42, 0x41, 0x45, 0x40, 0x42, 0x45, 0x61, 0x48, 0x42, 0x52,
+0x40, 0x0F, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x68, 0x57, 0x77, 0xC6, 0x49, 0x54, 0x26, 0x30,
+0x54, 0x49, 0x30, 0x00, 0x62, 0x66, 0xC0, 0x54, 0x00, 0xC4, 0x49, 0x37, 0x3F, 0x1E, 0x00, 0x0A,
+0x41, 0x40, 0x0F, 0x52, 0xCE, 0xA2, 0x0F, 0x40, 0x1C, 0x3F, 0x01, 0x58, 0x30, 0x0F, 0x36, 0x3F,
+0x58, 0x26, 0x0F, 0x1E, 0x00, 0xC2, 0x7C, 0x13, 0x56, 0x00, 0xC6, 0x7C, 0x6A, 0xCC, 0x56, 0xCC,
+0x94, 0x56, 0x00, 0xC5, 0xDF, 0x94, 0x8B, 0x56, 0x4C, 0x13, 0x00, 0xC1, 0x97, 0x09, 0x06, 0xC1,
+0x7B, 0x33, 0x00, 0x60, 0x00, 0x73, 0x5A, 0xC2, 0x72, 0x7B, 0x09, 0x01, 0x55, 0x49, 0x00, 0xC2,
+0x62, 0x10, 0x02, 0x03, 0x4E, 0x4A, 0x48, 0x43, 0x4E, 0x43, 0x42, 0x41, 0x40, 0x00, 0x7A, 0xCB,
+0xE3, 0x34, 0xD4, 0x0B, 0x27, 0x00, 0x7C, 0x76, 0x2B, 0x42, 0x85, 0x0C, 0x00, 0x63, 0x01, 0x4C,
+0xC2, 0x9E, 0x0C, 0x23, 0x00, 0xC2, 0x8D, 0x23, 0x0C, 0x00, 0xC8, 0x77, 0x5A, 0x4A, 0x96, 0x03,
+0x6A, 0x4C, 0x7A, 0x7C, 0x00, 0xDF, 0xD8, 0x7C, 0x1B, 0x50, 0x6D, 0x1C, 0x4A, 0x11, 0x2F, 0x50,
+0x70, 0x4C, 0x6B, 0x4F, 0x6B, 0x50, 0x32, 0x53, 0x3A, 0x5A, 0x6C, 0x11, 0x8F, 0x2F, 0x6C, 0x34,
+0x65, 0x6B, 0x0B, 0x31, 0x4F, 0x56, 0xC6, 0xD4, 0x12, 0x00, 0x0B, 0x00, 0x05, 0x02, 0x00, 0xC4,
+0x53, 0x04, 0x0A, 0x0E, 0x02, 0x03, 0x45, 0x40, 0x15, 0xC2, 0x6B, 0x7A, 0x13, 0x01, 0xCB, 0x6F,
+0x94, 0x65, 0x6F, 0x13, 0x76, 0x13, 0x56, 0x88, 0x4C, 0x3D, 0x80, 0x00, 0x53, 0xC1, 0xB7, 0x00,
+0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E,
+0x07, 0x07, 0x4D, 0xC8, 0x4D, 0x39, 0x45, 0xC6, 0x4B, 0xB1, 0x4D, 0x4B, 0x07, 0x08, 0xC2, 0x81,
+0x0B, 0x00, 0x11, 0x4B, 0x41, 0x5C, 0x41, 0x45, 0x48, 0x00, 0x44, 0x42, 0x48, 0x42, 0x40, 0x02,
+0x42, 0x00, 0x40, 0x5C, 0x43, 0x48, 0x00, 0x45, 0x40, 0x4B, 0x40, 0x43, 0x4A, 0x43, 0x41, 0x00,
+0x42, 0x40, 0x41, 0x40, 0x41, 0x43, 0x48, 0x41, 0x71, 0x44, 0x45, 0x40, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x52, 0x4B, 0x71, 0x4B,
+0x00, 0x40, 0x00, 0x68, 0x48, 0x00, 0x44, 0x40, 0x03, 0x41, 0x44, 0x48, 0x00, 0xC1, 0xAA, 0x0B,
+0x00, 0xC2, 0x47, 0x0B, 0x00, 0x04, 0x4B, 0x40, 0x06, 0x52, 0x40, 0x00, 0x4B, 0x40, 0x0D, 0x41,
+0x40, 0x19, 0x41, 0x40, 0x07, 0x68, 0x7F, 0x57, 0x02, 0x7F, 0x57, 0x09, 0x4F, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x52, 0x4F, 0x00, 0xC4, 0x40, 0x01, 0x1E, 0x0F, 0x1E, 0x00, 0x4F, 0x67, 0x5E, 0x67,
+0x5E, 0x4F, 0x5E, 0x00, 0xC5, 0x7A, 0x13, 0x80, 0x94, 0x7D, 0x13, 0x02, 0xC3, 0x7D, 0x13, 0x3D,
+0x13, 0x01, 0xC0, 0x94, 0x00, 0xC4, 0x7D, 0x41, 0x09, 0x15, 0x09, 0x07, 0x55, 0x49, 0x55, 0xC3,
+0x41, 0x15, 0x1B, 0x09, 0x06, 0x5B, 0x5C, 0x42, 0x02, 0x69, 0x42, 0x04, 0x41, 0x40, 0x00, 0x7A,
+0xC4, 0xE3, 0x9B, 0x4C, 0x6B, 0x01, 0x00, 0xC5, 0x7A, 0x6A, 0x11, 0x42, 0x5A, 0x0C, 0x01, 0xC3,
+0x9E, 0x23, 0x8D, 0x23, 0x00, 0xCC, 0x8D, 0x0C, 0x9E, 0x23, 0x9E, 0x0C, 0x35, 0x5A, 0x4A, 0x08,
+0x70, 0xA5, 0x7C, 0x01, 0xD5, 0xB7, 0x6B, 0x7C, 0x6B, 0x16, 0x6A, 0x02, 0xA7, 0x2B, 0x4A, 0x1C,
+0x6F, 0x8A, 0x4F, 0x29, 0x1F, 0x6D, 0x32, 0x04, 0x00, 0x59, 0x2F, 0x01, 0xCA, 0x5C, 0x2F, 0x3B,
+0x50, 0x6B, 0xAF, 0x25, 0x65, 0x56, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x09, 0x41, 0x40, 0x15, 0xD1,
+0x6B, 0x3D, 0x13, 0x8B, 0x13, 0x80, 0x3D, 0x7A, 0x8B, 0x80, 0x8B, 0x13, 0x3D, 0x7A, 0x94, 0x13,
+0x7D, 0x13, 0x00, 0xC1, 0x6B, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0x4D, 0x47, 0x00, 0xC1, 0x4B, 0x0D, 0x00, 0x6E, 0x47,
+0xC0, 0xBA, 0x00, 0x4D, 0xC1, 0x4B, 0x07, 0x07, 0x6E, 0xC1, 0x81, 0x00, 0x12, 0x4B, 0x40, 0x00,
+0x4B, 0x40, 0x00, 0x6D, 0xC4, 0x47, 0x0B, 0x00, 0x0B, 0x00, 0x04, 0x41, 0x52, 0x71, 0x40, 0x00,
+0x41, 0x48, 0x00, 0x43, 0x65, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x42, 0x48, 0x00, 0x42, 0x40, 0x01,
+0xC5, 0x47, 0x00, 0x27, 0x2D, 0x01, 0x00, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x41,
+0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40,
+0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x01, 0x41, 0x00, 0x40, 0x71, 0x52, 0xCC, 0x47, 0x12, 0x00,
+0x47, 0x12, 0x47, 0x2D, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x41, 0x00, 0x6D, 0x71, 0x6D,
+0x40, 0x52, 0x40, 0xDF, 0x47, 0x27, 0x31, 0x00, 0x31, 0x00, 0x2D, 0x31, 0x2D, 0x31, 0x2D, 0x00,
+0x31, 0x2D, 0x31, 0x0B, 0x12, 0x31, 0x0B, 0x12, 0x31, 0x0B, 0x12, 0x31, 0x0B, 0x12, 0x31, 0x0B,
+0x12, 0x31, 0x0B, 0x27, 0x40, 0x71, 0x41, 0x00, 0x52, 0x71, 0x40, 0x71, 0x40, 0x71, 0x40, 0x71,
+0x40, 0x00, 0x71, 0x40, 0x71, 0x40, 0x00, 0x71, 0x6D, 0x40, 0x71, 0x40, 0x00, 0x71, 0x40, 0x71,
+0x40, 0x41, 0x65, 0x40, 0x00, 0x6D, 0x71, 0x4B, 0x6D, 0x4B, 0x41, 0x40, 0x68, 0x77, 0x01, 0x7F,
+0x77, 0x00, 0x7F, 0x77, 0x07, 0x7F, 0x4F, 0x52, 0x40, 0xCC, 0x47, 0x12, 0x00, 0x47, 0x12, 0x00,
+0x12, 0x47, 0x00, 0x01, 0x0F, 0x12, 0x00, 0x0B, 0x4B, 0x40, 0x4B, 0xDA, 0xC0, 0xA2, 0x22, 0x0F,
+0x1F, 0x0F, 0x22, 0x0F, 0x22, 0x0F, 0x22, 0x0F, 0x22, 0x0F, 0xA2, 0x0F, 0x22, 0xE4, 0x13, 0x65,
+0x13, 0x65, 0x13, 0x65, 0x94, 0x65, 0x7A, 0x00, 0x53, 0xD3, 0x7A, 0x13, 0x65, 0x13, 0x65, 0x13,
+0x41, 0x10, 0x7B, 0x09, 0x10, 0x09, 0x10, 0x09, 0x10, 0x09, 0x15, 0x10, 0x09, 0x10, 0x01, 0xC8,
+0x7B, 0x09, 0x10, 0x15, 0x7B, 0x15, 0x10, 0x09, 0x10, 0x01, 0x5C, 0x42, 0x09, 0x41, 0x52, 0x4B,
+0x7A, 0xCD, 0xE3, 0x6C, 0x52, 0x7A, 0x7C, 0xBE, 0x4C, 0x9B, 0x11, 0x42, 0x5A, 0x23, 0x77, 0x8D,
+0x01, 0xC3, 0x9E, 0x23, 0x9E, 0x23, 0x02, 0xCA, 0x9E, 0x0C, 0x77, 0x5A, 0x23, 0x60, 0x70, 0x4C,
+0x7C, 0x6B, 0x7C, 0x02, 0xCA, 0x6B, 0x7C, 0x6A, 0x16, 0x3E, 0x11, 0x2F, 0x03, 0x6A, 0x8A, 0x16,
+0x00, 0xC7, 0xAF, 0x50, 0xA6, 0x08, 0x47, 0x59, 0x2F, 0x11, 0x00, 0x6F, 0x00, 0x7B, 0xCC, 0x64,
+0x9D, 0xD8, 0x7C, 0x65, 0xC7, 0xCE, 0x00, 0x2D, 0x31, 0x00, 0x05, 0x02, 0x09, 0x45, 0x40, 0x00,
+0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41,
+0x40, 0x00, 0x41, 0x40, 0x71, 0x65, 0xC4, 0x7A, 0x13, 0x7A, 0x13, 0x65, 0x00, 0xC5, 0x7A, 0x65,
+0x13, 0x65, 0x13, 0x7A, 0x01, 0xC1, 0x65, 0x13, 0x01, 0xCD, 0x4F, 0x0B, 0x12, 0x31, 0x0B, 0x12,
+0x31, 0x0B, 0x12, 0x31, 0x0B, 0x2D, 0x31, 0x00, 0x00, 0x6D, 0x65, 0x71, 0x40, 0x71, 0x40, 0x52,
+0x71, 0x40, 0x06, 0x71, 0x40, 0x00, 0x52, 0x65, 0x4B, 0x40, 0x71, 0x52, 0x4B, 0x71, 0x6D, 0x40,
+0x71, 0x6D, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40,
+0x00, 0x41, 0x40, 0x01, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x71, 0x6D, 0x40, 0x71, 0xC2,
+0xD6, 0x38, 0x0D, 0x00, 0xC6, 0xCB, 0x79, 0x0D, 0xCB, 0x0D, 0x38, 0x0D, 0x00, 0xC8, 0xCB, 0x79,
+0xCB, 0x81, 0x79, 0xCB, 0x79, 0xCB, 0x0D, 0x00, 0x78, 0xDF, 0x81, 0xCB, 0x81, 0x0D, 0xCB, 0x81,
+0xBA, 0x81, 0x01, 0x0B, 0x00, 0x27, 0x0B, 0x00, 0x27, 0x0B, 0x00, 0x27, 0x0B, 0x00, 0x27, 0x0B,
+0x00, 0x27, 0x0B, 0x00, 0x27, 0x0B, 0x27, 0x00, 0x0B, 0x27, 0x4B, 0x40, 0x71, 0x40, 0x6D, 0x71,
+0x6D, 0x71, 0x6D, 0x71, 0x40, 0x6D, 0x71, 0x40, 0xCF, 0x47, 0x00, 0x2D, 0x31, 0x2D, 0x31, 0x2D,
+0x01, 0x31, 0x12, 0x0B, 0x27, 0x00, 0x12, 0x47, 0x01, 0x01, 0x40, 0x52, 0xC6, 0x47, 0x12, 0x00,
+0x0B, 0x27, 0x01, 0x00, 0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x41, 0x40,
+0x00, 0x41, 0x40, 0x00, 0x41, 0x40, 0x41, 0x40, 0x41, 0x00, 0x40, 0x48, 0x43, 0x48, 0x01, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x02, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x04, 0x43, 0x48, 0x66, 0xC6, 0x6D, 0x26, 0x08, 0x03, 0x08, 0x03, 0x08, 0x00, 0x43, 0x48,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0xC2, 0x59, 0x84, 0x3B,
+0x00, 0xC4, 0x86, 0x03, 0x08, 0x03, 0x08, 0x00, 0x43, 0x48, 0x66, 0x48, 0xCF, 0x6D, 0x26, 0x08,
+0x6D, 0x26, 0x08, 0x6D, 0x26, 0x08, 0x6D, 0x26, 0x08, 0x03, 0x08, 0x03, 0x08, 0x01, 0xDF, 0x53,
+0xA0, 0x6F, 0xA0, 0xA9, 0xA0, 0xA9, 0x4E, 0xA9, 0xA0, 0x6F, 0xA9, 0xA0, 0xA9, 0x4E, 0xA9, 0xA0,
+0xA9, 0x4E, 0xA9, 0xA0, 0xA9, 0x4E, 0xA9, 0xA0, 0xA9, 0x4E, 0xA9, 0x52, 0x74, 0x08, 0x6D, 0x66,
+0x48, 0x00, 0x43, 0x48, 0x43, 0x4A, 0x48, 0xC9, 0x49, 0x58, 0x49, 0x30, 0x49, 0x30, 0x49, 0x30,
+0x58, 0x30, 0x00, 0xC9, 0x49, 0x30, 0x49, 0x08, 0x49, 0x08, 0x26, 0x08, 0x03, 0x08, 0x00, 0x43,
+0x48, 0x00, 0x66, 0x48, 0x00, 0xC3, 0x50, 0x0A, 0x71, 0x3E, 0x00, 0x4A, 0x7E, 0x00, 0xC1, 0x71,
+0x3E, 0x00, 0xC1, 0x71, 0x3E, 0x00, 0xC1, 0x71, 0x3E, 0x02, 0xC2, 0x71, 0x58, 0x30, 0x00, 0x48,
+0x70, 0x00, 0xC1, 0x59, 0x30, 0x00, 0x48, 0x66, 0x48, 0x70, 0x48, 0x70, 0x48, 0xD0, 0x70, 0x6F,
+0xA9, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0xA9, 0x00,
+0xC1, 0x6F, 0x70, 0x17, 0x4A, 0xC4, 0x92, 0x0A, 0x0E, 0x0A, 0x0E, 0x00, 0x4A, 0x4E, 0x4A, 0x4E,
+0x4A, 0x00, 0x48, 0x43, 0x48, 0x42, 0xCD, 0xC7, 0x5C, 0x2F, 0x71, 0x76, 0x53, 0x9B, 0x11, 0x2A,
+0xC9, 0x54, 0x0C, 0x23, 0x0C, 0x03, 0xC1, 0x77, 0x0C, 0x02, 0xCA, 0x77, 0x0C, 0x77, 0x5A, 0x4A,
+0x51, 0x6D, 0x4C, 0xD8, 0x4F, 0x7C, 0x02, 0xCA, 0xD8, 0x7C, 0x6A, 0x04, 0x4A, 0x5C, 0x2F, 0x3E,
+0x88, 0x7A, 0x16, 0x00, 0xC6, 0x4F, 0x51, 0xA6, 0x30, 0x2D, 0xB0, 0x11, 0x00, 0xC2, 0x8F, 0x2F,
+0x9A, 0x00, 0x7B, 0xC1, 0x64, 0x71, 0x00, 0xC7, 0x64, 0x6C, 0xB0, 0x6D, 0x26, 0x08, 0x03, 0x0A,
+0x00, 0x4E, 0x02, 0x4A, 0x4E, 0x02, 0x4A, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x66, 0xD1,
+0x6D, 0xA9, 0x72, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F, 0x88, 0x6F,
+0x88, 0x6F, 0x00, 0xC1, 0x53, 0x08, 0x00, 0x66, 0x48, 0xC8, 0x6D, 0x26, 0x08, 0x6D, 0x26, 0x08,
+0x6D, 0x26, 0x08, 0x00, 0x43, 0xC6, 0x71, 0x3E, 0x34, 0x71, 0x3E, 0x34, 0x3E, 0x01, 0x74, 0xC1,
+0x71, 0x3E, 0x00, 0x74, 0x7E, 0x02, 0x74, 0x4A, 0xC3, 0x50, 0x08, 0x03, 0x08, 0x00, 0x43, 0x48,
+0x00, 0x43, 0x48, 0x02, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x03, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x70, 0xC1, 0x6F, 0x39, 0x00,
+0xC7, 0x61, 0x39, 0x61, 0x39, 0x61, 0xB9, 0xA0, 0x61, 0x00, 0x79, 0xC4, 0x61, 0xB9, 0x61, 0x39,
+0x61, 0x00, 0xCD, 0xB9, 0xA0, 0xB9, 0x39, 0x61, 0x39, 0x61, 0xB9, 0xA0, 0x61, 0xB9, 0xA0, 0x74,
+0x08, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x00, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x66, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x66, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x02, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43,
+0x48, 0x00, 0x42, 0x41, 0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x6D, 0xC4,
+0x6C, 0x2B, 0x34, 0x2D, 0x00, 0x17, 0x4B, 0x40, 0xC2, 0xD6, 0x2E, 0x07, 0x03, 0x6E, 0x47, 0x00,
+0x6E, 0x47, 0x4D, 0x47, 0x6E, 0x47, 0x00, 0x6E, 0x00, 0x47, 0x6E, 0x47, 0x6E, 0x47, 0x01, 0x6E,
+0x47, 0xC1, 0xE9, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x52, 0x41, 0x40, 0x0A, 0xC1, 0x89, 0x14, 0x00,
+0xC1, 0x5B, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x06, 0xC2, 0x5B, 0x63, 0x14, 0x00, 0x7A, 0x40, 0x0D,
+0xD6, 0x7C, 0x13, 0x7A, 0x94, 0x13, 0xBE, 0x3D, 0xBE, 0x13, 0x94, 0x13, 0x94, 0x13, 0x94, 0x13,
+0x94, 0x13, 0xCC, 0xD4, 0x47, 0x00, 0x31, 0x00, 0x15, 0xC1, 0xBD, 0x02, 0x09, 0x41, 0x40, 0x00,
+0x41, 0xC5, 0xA7, 0xBC, 0x5C, 0x2A, 0x11, 0x2A, 0x00, 0xC9, 0x42, 0x2F, 0x17, 0x26, 0x35, 0x0C,
+0x77, 0x0C, 0x77, 0x0C, 0x01, 0xC2, 0xC4, 0x77, 0x0C, 0x00, 0xC1, 0xC4, 0x0C, 0x00, 0xC9, 0x5A,
+0x23, 0x60, 0x6A, 0x7A, 0x7C, 0x4F, 0x7C, 0x6B, 0x7C, 0x00, 0xCA, 0x6B, 0x7C, 0x4C, 0x16, 0x0E,
+0x2F, 0xA7, 0x63, 0x6F, 0x8A, 0x16, 0x00, 0xCF, 0x4F, 0x50, 0x32, 0x4A, 0x08, 0x4A, 0x11, 0x2F,
+0x95, 0x26, 0x3F, 0x9A, 0x4A, 0x2F, 0x8F, 0x11, 0x00, 0xC2, 0xD1, 0x36, 0x00, 0x02, 0x45, 0x42,
+0x01, 0x45, 0x42, 0x01, 0x69, 0x61, 0x42, 0x00, 0x41, 0x40, 0x15, 0xD4, 0xB7, 0x3D, 0x13, 0x3D,
+0x94, 0x13, 0xBE, 0x3D, 0x7A, 0xBE, 0x3D, 0x7A, 0x3D, 0x7A, 0x94, 0x7A, 0x3D, 0x80, 0x94, 0x6B,
+0x00, 0x0C, 0x4B, 0x5C, 0x64, 0xC2, 0xD0, 0x24, 0xD0, 0x01, 0x64, 0x01, 0xC0, 0xD0, 0x00, 0x64,
+0x01, 0xC7, 0xD0, 0x24, 0x5E, 0x24, 0xE4, 0x00, 0x12, 0x00, 0x08, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x04, 0x4B, 0x40, 0x00, 0xC2, 0xD6, 0x0D, 0x07, 0x12, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x01,
+0xC2, 0x81, 0xC0, 0x00, 0x3C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x12, 0x41, 0x40, 0x03, 0x71, 0x6D, 0xC4, 0x6C, 0xF0,
+0x2D, 0x31, 0x00, 0x19, 0xC1, 0xB4, 0x07, 0x07, 0x4D, 0x00, 0xC1, 0x4B, 0x07, 0x00, 0x4D, 0xC6,
+0x79, 0xBA, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x03, 0x6E, 0xC2, 0xB4, 0x0B, 0x00, 0x06, 0x41, 0x40,
+0x00, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x41,
+0x6D, 0x4B, 0x40, 0x08, 0xC6, 0xC0, 0x9D, 0x14, 0x5B, 0x14, 0x5B, 0x14, 0x00, 0xC2, 0x5B, 0x67,
+0x14, 0x01, 0xC1, 0x67, 0x14, 0x00, 0xC1, 0x5B, 0x14, 0x01, 0x7A, 0x40, 0x0D, 0xC1, 0x7C, 0x13,
+0x00, 0xC2, 0x8B, 0xBE, 0x13, 0x00, 0xC0, 0x8B, 0x00, 0x53, 0xC3, 0xBE, 0x3D, 0x13, 0x3D, 0x00,
+0xD9, 0xBE, 0x8B, 0x13, 0x65, 0x0B, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12,
+0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02, 0x67, 0x42, 0x04, 0x45,
+0x42, 0x00, 0x45, 0x42, 0x00, 0x41, 0x40, 0x00, 0x5F, 0xC1, 0xD2, 0xBC, 0x00, 0x6A, 0x01, 0xC0,
+0x5C, 0x00, 0x6F, 0xC3, 0x58, 0x22, 0x5A, 0x23, 0x01, 0x72, 0xC8, 0x64, 0x0E, 0x32, 0x64, 0x0E,
+0x0C, 0x3B, 0x3E, 0x0C, 0x00, 0xD5, 0x54, 0x4A, 0x96, 0x6A, 0x4C, 0x6B, 0xD8, 0x4F, 0x7C, 0x6B,
+0x7C, 0x6B, 0x7C, 0x50, 0x04, 0x84, 0x11, 0xA7, 0x36, 0x6F, 0xB8, 0x16, 0x00, 0xC2, 0x4F, 0x50,
+0x32, 0x00, 0x7E, 0x7B, 0x00, 0xC3, 0x8F, 0x9A, 0x36, 0x26, 0x00, 0xC7, 0x9A, 0x8F, 0x2F, 0x6C,
+0x5C, 0xBC, 0x95, 0x00, 0x02, 0x45, 0x42, 0x45, 0x42, 0x00, 0x61, 0x68, 0x42, 0x03, 0x41, 0x40,
+0x15, 0xCA, 0x6B, 0xCC, 0x7D, 0x13, 0x94, 0x8B, 0x13, 0x8B, 0x80, 0x13, 0x8B, 0x00, 0x53, 0x01,
+0xC2, 0x8B, 0x3D, 0x13, 0x00, 0xC1, 0x4F, 0x00, 0x0D, 0xC2, 0xB6, 0x5E, 0x24, 0x01, 0xC3, 0xAC,
+0x24, 0x5E, 0x24, 0x00, 0xC0, 0xAC, 0x00, 0x64, 0x00, 0xC1, 0xD0, 0x24, 0x01, 0xC3, 0xD0, 0xB6,
+0x0B, 0x00, 0x09, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xCB, 0xD6, 0x2E, 0x07, 0x2E, 0x07, 0x2E,
+0x07, 0x2E, 0x07, 0x0D, 0x79, 0x0D, 0x00, 0xCA, 0x4B, 0x79, 0x4B, 0x0D, 0x2E, 0x07, 0x0D, 0x79,
+0x07, 0x2E, 0x07, 0x00, 0x6E, 0x47, 0x4D, 0x00, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x20, 0x41, 0x40,
+0x05, 0x41, 0x40, 0x11, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x00, 0x45, 0x42, 0x40, 0x42, 0x43, 0x42, 0x40, 0x02, 0x44, 0x43, 0x45,
+0x40, 0x45, 0x41, 0x40, 0x02, 0x41, 0x45, 0x40, 0x41, 0x68, 0x40, 0x52, 0xC5, 0x89, 0x3A, 0x0B,
+0x1F, 0x05, 0x00, 0x00, 0x41, 0x43, 0x45, 0x40, 0x44, 0x45, 0x40, 0x0E, 0x4B, 0x40, 0xCC, 0xB4,
+0x07, 0x0D, 0xBA, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0xBA, 0x4D, 0x46, 0x0D, 0x01, 0xCF, 0x45, 0x4B,
+0x0D, 0xB1, 0x45, 0x07, 0x79, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0xB4, 0x2D, 0x00, 0x06, 0x41,
+0x4B, 0x40, 0x0A, 0x4B, 0x40, 0x00, 0x4B, 0x67, 0x40, 0x09, 0x4B, 0xC7, 0x67, 0x14, 0x83, 0x14,
+0x52, 0x5E, 0x14, 0x34, 0x00, 0x54, 0x00, 0x7E, 0xC5, 0x71, 0x14, 0x52, 0x14, 0x52, 0x14, 0x00,
+0x7A, 0x40, 0x0D, 0xC2, 0x7C, 0x80, 0x13, 0x00, 0xC3, 0x56, 0x94, 0x13, 0x4C, 0x00, 0x53, 0xCA,
+0x6F, 0x56, 0x94, 0x13, 0x4C, 0x6F, 0x4C, 0x7D, 0x94, 0xC0, 0x00, 0x16, 0x71, 0x42, 0x03, 0x44,
+0x48, 0x44, 0x42, 0x48, 0x43, 0x42, 0x41, 0x40, 0x00, 0x7A, 0xD8, 0xA7, 0x5F, 0x5C, 0x2A, 0x11,
+0x3B, 0x2B, 0xB0, 0xA4, 0x30, 0x36, 0xA4, 0x32, 0x95, 0x26, 0x32, 0xB0, 0x59, 0x35, 0x5A, 0x02,
+0x32, 0x84, 0x36, 0x32, 0x00, 0xC6, 0xA6, 0x23, 0x36, 0x6D, 0x7A, 0x6B, 0x7C, 0x00, 0xDD, 0x6B,
+0x4F, 0x6B, 0x4F, 0x6B, 0x50, 0x16, 0x3E, 0x42, 0xA7, 0x3E, 0x6F, 0xB8, 0x16, 0x8A, 0x4F, 0x50,
+0xA6, 0x0E, 0x03, 0x84, 0x11, 0x2F, 0x11, 0xA7, 0x93, 0xE1, 0xB0, 0x3B, 0x3E, 0x00, 0x7B, 0xC4,
+0x6C, 0x95, 0x00, 0x12, 0x00, 0x00, 0x45, 0x42, 0x43, 0x48, 0x42, 0x43, 0x48, 0x42, 0x03, 0x41,
+0x40, 0x15, 0xCF, 0xAF, 0x3D, 0x7D, 0x13, 0x56, 0x4C, 0xBE, 0x13, 0x56, 0x94, 0x56, 0x6A, 0x13,
+0x94, 0x13, 0x6A, 0x00, 0xC4, 0x8B, 0x13, 0xB7, 0x0B, 0x00, 0x0C, 0xC5, 0xB6, 0x24, 0xA0, 0x4E,
+0x5E, 0x4E, 0x00, 0xC1, 0xAC, 0xA0, 0x00, 0xC2, 0xAC, 0x5E, 0xA0, 0x00, 0xC0, 0xAC, 0x00, 0xC0,
+0x4E, 0x00, 0xC2, 0xD0, 0xE4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xCE, 0xB2, 0x07,
+0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x79, 0x4B, 0x4D, 0x45, 0x79, 0x0D, 0x00, 0xC1, 0x45,
+0x38, 0x00, 0xC6, 0x4D, 0x38, 0x0D, 0x79, 0x07, 0x0D, 0x07, 0x03, 0xC1, 0x81, 0x00, 0x13, 0x41,
+0x45, 0x40, 0x00, 0x45, 0x43, 0x45, 0x41, 0x44, 0x45, 0x40, 0x03, 0x41, 0x42, 0x40, 0x45, 0x44,
+0x00, 0x41, 0x40, 0x01, 0x42, 0x43, 0x42, 0x40, 0x41, 0x45, 0x40, 0x02, 0x41, 0x45, 0x40, 0x42,
+0x44, 0x41, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x00, 0x48, 0x4E, 0x41, 0x4A, 0x42, 0x48, 0x42, 0x40, 0x00, 0x41, 0x4E, 0x44,
+0x48, 0x45, 0x63, 0x42, 0x40, 0x01, 0x45, 0x4E, 0x44, 0x40, 0x44, 0x4E, 0x40, 0x6D, 0x40, 0x71,
+0x4B, 0x4A, 0x00, 0x40, 0x00, 0x44, 0x43, 0x02, 0x48, 0x40, 0x0F, 0x4B, 0xC3, 0xB4, 0x2E, 0x0D,
+0x07, 0x04, 0xCD, 0x45, 0x61, 0x87, 0x45, 0x4B, 0x7F, 0xC2, 0xC6, 0xCB, 0xBB, 0x39, 0x07, 0x0D,
+0x07, 0x03, 0x6E, 0xC1, 0xB4, 0x00, 0x02, 0x4B, 0x40, 0x02, 0x41, 0x4B, 0x00, 0x40, 0x0A, 0x4B,
+0x40, 0x71, 0x41, 0x40, 0x09, 0x4B, 0xC9, 0x9D, 0x52, 0x32, 0x52, 0x3E, 0x3B, 0x3E, 0x34, 0x71,
+0x34, 0x03, 0x7E, 0x74, 0xC4, 0xC2, 0x50, 0x5B, 0x3A, 0x00, 0x0C, 0x4B, 0xC9, 0x7C, 0x80, 0x8B,
+0x6F, 0x9E, 0x65, 0x56, 0x9E, 0x56, 0x6A, 0x00, 0xC9, 0x88, 0x7A, 0xBE, 0x6F, 0x6A, 0x88, 0xCC,
+0x94, 0xC0, 0x00, 0x16, 0xC1, 0x47, 0x02, 0x03, 0x4E, 0x48, 0x4E, 0x4A, 0x48, 0x43, 0x42, 0x41,
+0x40, 0x00, 0x7A, 0xCB, 0xE3, 0x75, 0x6C, 0x71, 0x50, 0x76, 0x64, 0x3E, 0x90, 0x40, 0x26, 0x42,
+0x00, 0x6F, 0xC2, 0x4A, 0x11, 0x2F, 0x00, 0x72, 0xC4, 0x4A, 0x3E, 0x32, 0x2B, 0x42, 0x00, 0x72,
+0xC7, 0x42, 0x11, 0x96, 0x6A, 0x65, 0x6B, 0x4F, 0x6B, 0x04, 0xC8, 0x50, 0x04, 0x3E, 0x2A, 0xDB,
+0x0E, 0x6F, 0xB8, 0x16, 0x00, 0xC6, 0x4F, 0x50, 0xA6, 0x0E, 0x01, 0x63, 0x11, 0x00, 0x6F, 0x00,
+0xC9, 0xB0, 0x84, 0x64, 0x44, 0x94, 0x7A, 0x9D, 0x84, 0x95, 0x00, 0x02, 0x45, 0x44, 0x4A, 0x4E,
+0x48, 0x4E, 0x4A, 0xC1, 0x53, 0x02, 0x02, 0x41, 0x40, 0x15, 0xC2, 0xAF, 0x65, 0x13, 0x00, 0xC3,
+0x9E, 0x6F, 0x94, 0x88, 0x00, 0xCB, 0x4C, 0x64, 0x6A, 0x7A, 0xDF, 0x56, 0x6A, 0x88, 0x56, 0x13,
+0x6B, 0x00, 0x0D, 0xC5, 0xC5, 0x4E, 0xD5, 0xCD, 0x4E, 0xC1, 0x00, 0xC0, 0x87, 0x00, 0xCB, 0x6F,
+0x4E, 0x87, 0xCD, 0x6F, 0x87, 0x4E, 0xD5, 0x56, 0xD0, 0xB6, 0x00, 0x02, 0x4B, 0x40, 0x05, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC2, 0xB2, 0x2E, 0x07, 0x00, 0x6E, 0x47, 0x00, 0x6E, 0x47,
+0x4D, 0xCB, 0x7F, 0x39, 0x87, 0x45, 0xC6, 0x7F, 0xC2, 0xC3, 0x39, 0x61, 0x39, 0x07, 0x01, 0x6E,
+0x47, 0x00, 0x4D, 0x47, 0x6E, 0xC2, 0x81, 0x31, 0x00, 0x11, 0x41, 0x4A, 0x00, 0x40, 0x00, 0x48,
+0x42, 0x48, 0x4A, 0x44, 0x48, 0x41, 0x40, 0x02, 0x42, 0x63, 0x41, 0x43, 0xCA, 0x44, 0x04, 0x08,
+0x00, 0x01, 0x00, 0x0A, 0x04, 0x0A, 0x05, 0x0A, 0x00, 0x40, 0x02, 0x48, 0x4E, 0x41, 0x43, 0x48,
+0x42, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x45, 0x4A, 0x00, 0x42, 0x43, 0x40, 0x42, 0x48, 0x40, 0x00, 0x41, 0x4E, 0x48, 0x4A,
+0x41, 0x44, 0x42, 0x40, 0x01, 0x41, 0x44, 0x00, 0x41, 0x43, 0xC2, 0x53, 0x0B, 0x00, 0x01, 0x4B,
+0x61, 0x43, 0x4B, 0x40, 0x00, 0x44, 0x48, 0x00, 0x41, 0x48, 0x41, 0x40, 0x0F, 0xC2, 0xB4, 0x2E,
+0x07, 0x05, 0x4D, 0xCC, 0x55, 0x87, 0xC6, 0x07, 0x38, 0x39, 0x4B, 0x55, 0xBB, 0x39, 0x0D, 0x2E,
+0x07, 0x03, 0x6E, 0xC3, 0xB4, 0x00, 0x0B, 0x00, 0x00, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41,
+0x40, 0x0B, 0xC3, 0x67, 0x14, 0x3B, 0x34, 0x00, 0xC2, 0x64, 0x3B, 0x67, 0x00, 0x7B, 0xC7, 0x52,
+0x64, 0x34, 0x71, 0x34, 0x14, 0x4A, 0x14, 0x00, 0xC1, 0xB7, 0x00, 0x0D, 0xD6, 0x7C, 0x7D, 0x13,
+0x88, 0x64, 0x6F, 0x7A, 0x6F, 0x76, 0x3D, 0x56, 0x6F, 0xCC, 0x4C, 0x94, 0x56, 0xA9, 0x3D, 0x7A,
+0x0B, 0x00, 0x12, 0x00, 0x14, 0x6D, 0x42, 0x04, 0x43, 0x4E, 0x01, 0x48, 0x42, 0x40, 0x01, 0x4F,
+0xDF, 0xE3, 0x6C, 0x76, 0xD8, 0xC0, 0x6B, 0xB8, 0xA9, 0xC9, 0x9A, 0xD2, 0xDB, 0x11, 0x2A, 0x2F,
+0x8F, 0x11, 0x42, 0x23, 0x3B, 0x4A, 0x2A, 0xDB, 0x42, 0x32, 0x2B, 0x32, 0x2F, 0x74, 0x6D, 0x51,
+0xE9, 0xC2, 0xC0, 0x25, 0xC0, 0x02, 0xC9, 0xB8, 0x6A, 0x04, 0x5A, 0x5C, 0x2F, 0x50, 0x6A, 0x8A,
+0x16, 0x00, 0xD3, 0x4F, 0x50, 0x32, 0x03, 0x00, 0x63, 0x3B, 0x8F, 0x2F, 0x5C, 0xDB, 0xC2, 0x50,
+0xE9, 0xD3, 0x47, 0x6B, 0x76, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4E, 0x4A, 0x00, 0x48, 0x4E,
+0x68, 0x42, 0x01, 0x41, 0x40, 0x15, 0x65, 0x7D, 0x00, 0xC1, 0x6F, 0x88, 0x00, 0xC4, 0x7A, 0x56,
+0x6F, 0x65, 0x6F, 0x00, 0xC8, 0x6A, 0x4C, 0x13, 0x3D, 0x88, 0x4C, 0x13, 0x6B, 0x00, 0x09, 0x4B,
+0x40, 0x01, 0xD4, 0xB6, 0x24, 0x6F, 0xC1, 0x6F, 0xC1, 0x33, 0x4E, 0x6F, 0xC1, 0xCD, 0x87, 0xCC,
+0x4E, 0x87, 0x5E, 0xCD, 0x4E, 0x24, 0xB6, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1,
+0xB2, 0x07, 0x07, 0x4D, 0xC2, 0x55, 0xBB, 0x4B, 0x00, 0x78, 0x79, 0xC2, 0x45, 0x81, 0x39, 0x00,
+0x4D, 0xC1, 0x79, 0x07, 0x05, 0xC2, 0x81, 0x0B, 0x00, 0x12, 0x42, 0x43, 0x40, 0x01, 0x42, 0x43,
+0x48, 0x42, 0x4E, 0x45, 0x40, 0x02, 0x48, 0x4A, 0x48, 0x44, 0x68, 0x40, 0x4A, 0x40, 0x01, 0x4A,
+0x48, 0x4E, 0x45, 0x00, 0x43, 0x40, 0x02, 0x45, 0x43, 0x40, 0x41, 0x48, 0x42, 0x40, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x43, 0x4A,
+0x48, 0x4A, 0x48, 0x45, 0x43, 0x44, 0x40, 0x00, 0x45, 0x4A, 0x41, 0x4A, 0x41, 0x44, 0x42, 0x40,
+0x02, 0x42, 0x44, 0x00, 0xC3, 0x92, 0x4A, 0x01, 0x12, 0x00, 0x40, 0x00, 0x65, 0x48, 0x40, 0x00,
+0x44, 0x45, 0x48, 0x4A, 0x42, 0x48, 0x41, 0x40, 0x0E, 0x4B, 0xC1, 0xB4, 0x07, 0x00, 0x4D, 0x47,
+0x03, 0xCD, 0x46, 0xED, 0xA0, 0x46, 0xBA, 0x81, 0x61, 0x45, 0xBB, 0x88, 0xBB, 0x81, 0x0D, 0x07,
+0x00, 0x6E, 0x47, 0x00, 0xC6, 0x79, 0xB4, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0A, 0xC5, 0x67, 0x52, 0x64, 0x3B, 0x64, 0x34, 0x00, 0xCD, 0xC7, 0x52, 0x64, 0x34,
+0x52, 0x9B, 0x3B, 0x3E, 0x5B, 0x9B, 0x14, 0x5B, 0x3A, 0x00, 0x0A, 0x4B, 0x40, 0x00, 0xC8, 0x7C,
+0x80, 0x76, 0x88, 0x6A, 0x9E, 0x94, 0x61, 0x56, 0x00, 0xC3, 0x88, 0x4C, 0x56, 0x6A, 0x00, 0xC1,
+0x88, 0x13, 0x00, 0xC2, 0x94, 0x47, 0x00, 0x16, 0x71, 0x42, 0x03, 0x4A, 0x00, 0x42, 0x4E, 0x44,
+0x4E, 0x42, 0x41, 0x40, 0x00, 0x65, 0xC9, 0x84, 0x9B, 0x7A, 0x6B, 0x12, 0x00, 0x7C, 0x76, 0x11,
+0x2A, 0x02, 0x6F, 0xC2, 0x5C, 0x2F, 0x11, 0x00, 0x72, 0x01, 0x6A, 0x6B, 0x72, 0x01, 0xC6, 0x42,
+0x23, 0x04, 0x50, 0x70, 0xB8, 0xC0, 0x02, 0x4B, 0xDF, 0x7C, 0x70, 0x6D, 0xE4, 0xB0, 0x5C, 0x4A,
+0x6D, 0x1A, 0x7A, 0x4F, 0x7C, 0x4F, 0x63, 0x32, 0x0A, 0x00, 0x59, 0x11, 0x8F, 0x2F, 0x5C, 0x2A,
+0x3B, 0x65, 0x6B, 0x00, 0x12, 0x6B, 0x4C, 0xB8, 0x00, 0x02, 0x5F, 0xC1, 0x51, 0x03, 0x00, 0x4A,
+0x00, 0x4E, 0x48, 0x42, 0x02, 0x41, 0x40, 0x15, 0xD1, 0x6B, 0x94, 0x13, 0x88, 0x6F, 0x9E, 0x56,
+0x4C, 0x6F, 0x4C, 0x56, 0x6A, 0x6F, 0x6A, 0x76, 0x88, 0x4C, 0x13, 0x00, 0xC1, 0xB7, 0x00, 0x0D,
+0xC3, 0xB6, 0x5E, 0xC1, 0xCD, 0x00, 0xCF, 0x61, 0xC1, 0x61, 0x4E, 0xCD, 0xC1, 0x61, 0x4E, 0x61,
+0xCD, 0x24, 0x61, 0x4E, 0x5E, 0xD4, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0xC1, 0xB2, 0x07, 0x00, 0x6E, 0x47, 0x00, 0x6E, 0x47, 0xCE, 0x79, 0x0D, 0x4D, 0xED, 0x4E,
+0x46, 0x79, 0x81, 0x39, 0x45, 0x6E, 0xDC, 0xBB, 0x0D, 0x07, 0x00, 0x6E, 0x47, 0x4D, 0x00, 0x47,
+0x6E, 0xC1, 0x81, 0x00, 0x13, 0x45, 0x43, 0x40, 0x41, 0x44, 0x48, 0x41, 0x42, 0x48, 0x4A, 0x41,
+0x40, 0x01, 0x45, 0x4E, 0x44, 0x4E, 0x48, 0x42, 0x00, 0x4A, 0x40, 0x01, 0x4A, 0x45, 0x43, 0x42,
+0x41, 0x43, 0x40, 0x02, 0x41, 0x48, 0x45, 0x44, 0x42, 0x43, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x42, 0x41, 0x40, 0x44, 0x43,
+0x48, 0x44, 0x4B, 0x40, 0x01, 0x48, 0x00, 0x42, 0x40, 0x45, 0x00, 0x40, 0x02, 0x45, 0x00, 0x40,
+0x41, 0x44, 0x52, 0x40, 0x02, 0x41, 0x42, 0x41, 0x45, 0x00, 0x43, 0x42, 0x41, 0x48, 0x42, 0x40,
+0x10, 0xC2, 0xD6, 0x2E, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0xCF, 0x4B, 0x39, 0x4D, 0x38,
+0x45, 0x0D, 0x46, 0x4B, 0x81, 0x45, 0x46, 0x0D, 0x07, 0x2E, 0x0D, 0x07, 0x01, 0x6E, 0xC3, 0xB4,
+0x31, 0x0B, 0x00, 0x00, 0x52, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0xCB, 0x67, 0x14,
+0xC7, 0x71, 0x5E, 0xC7, 0x52, 0x34, 0x64, 0x14, 0x52, 0x34, 0x00, 0xC0, 0x52, 0x00, 0x54, 0xC4,
+0xC7, 0x14, 0x5B, 0x21, 0x00, 0x0D, 0xD5, 0x7C, 0x7D, 0x56, 0x4C, 0xDF, 0x56, 0xCC, 0x56, 0xCC,
+0x6F, 0xA9, 0x6A, 0x7A, 0x94, 0x6F, 0xA9, 0x6A, 0x13, 0x7A, 0x0B, 0x12, 0x00, 0x15, 0x6D, 0x42,
+0x03, 0x4E, 0x4A, 0x43, 0x44, 0x4A, 0x43, 0x42, 0x41, 0x40, 0x52, 0x65, 0xC4, 0xC7, 0x34, 0x7A,
+0x47, 0x12, 0x00, 0xDC, 0x7C, 0x56, 0x11, 0x5C, 0x11, 0xDB, 0x11, 0xDB, 0x2A, 0x11, 0x2A, 0x4A,
+0x0E, 0x0A, 0x11, 0x2A, 0x42, 0x4A, 0x9E, 0x3B, 0x42, 0x4A, 0x02, 0x0B, 0x16, 0x6A, 0x51, 0x7C,
+0x4F, 0x00, 0x5C, 0xDF, 0x6D, 0x50, 0xAF, 0x2D, 0x5A, 0x8F, 0x3B, 0x63, 0x51, 0x4F, 0xAF, 0xDA,
+0xAF, 0x63, 0x23, 0x08, 0x12, 0x59, 0x11, 0x2F, 0x11, 0x8F, 0x11, 0x9C, 0x65, 0xE9, 0x0B, 0x47,
+0x7C, 0x56, 0xD4, 0x00, 0x02, 0x45, 0x42, 0xC5, 0x58, 0x0A, 0x02, 0x08, 0x0A, 0x02, 0x03, 0x41,
+0x40, 0x15, 0x65, 0xC9, 0x94, 0x4C, 0x56, 0xDF, 0xCC, 0x56, 0x13, 0x56, 0x13, 0x6F, 0x00, 0x53,
+0xC7, 0x94, 0x56, 0x88, 0x6F, 0x4C, 0x13, 0x6B, 0x00, 0x09, 0x4B, 0x40, 0x01, 0xC3, 0xB6, 0x24,
+0x4E, 0xA0, 0x01, 0xC0, 0x4E, 0x00, 0xCC, 0x87, 0x61, 0xAC, 0x4E, 0x87, 0xA0, 0x5E, 0x24, 0x4E,
+0x5E, 0x24, 0xB6, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC7, 0xB2,
+0x2E, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x01, 0xCD, 0x45, 0x39, 0x4D, 0x4B, 0x45, 0x0D, 0x46,
+0x38, 0x46, 0xB9, 0x46, 0x81, 0x4B, 0x07, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0xC2, 0x81, 0x47,
+0x00, 0x12, 0x41, 0x42, 0x41, 0x45, 0x43, 0x48, 0x44, 0x42, 0x43, 0x42, 0x40, 0x02, 0x42, 0x61,
+0x40, 0x42, 0xCA, 0x44, 0x08, 0x03, 0x05, 0x00, 0x01, 0x00, 0x04, 0x08, 0x03, 0x01, 0x00, 0x42,
+0x40, 0x02, 0x41, 0x42, 0x40, 0x44, 0x43, 0x41, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x06, 0x45, 0x48, 0x00, 0x44, 0x40, 0x03,
+0x41, 0x44, 0x48, 0x00, 0x45, 0x40, 0x03, 0x71, 0x40, 0x71, 0x40, 0x19, 0x4B, 0x00, 0x40, 0xC1,
+0xB4, 0x07, 0x00, 0x4D, 0x47, 0x08, 0xC2, 0xBA, 0x0D, 0x07, 0x01, 0x4D, 0x6E, 0x47, 0x04, 0xC6,
+0x79, 0xB4, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x09, 0x52, 0xC2,
+0xB6, 0x14, 0x5B, 0x00, 0xC3, 0x67, 0x5B, 0x14, 0x5B, 0x00, 0x54, 0xC0, 0x5B, 0x01, 0x54, 0xC3,
+0x67, 0x14, 0x67, 0x14, 0x00, 0x65, 0x40, 0x0A, 0x4B, 0x40, 0x00, 0xC1, 0x94, 0x13, 0x00, 0xC4,
+0x94, 0x13, 0x80, 0x3D, 0x80, 0x00, 0xC5, 0x8B, 0x94, 0x3D, 0x13, 0x3D, 0x94, 0x00, 0xC6, 0x7A,
+0x3D, 0x94, 0x47, 0x00, 0x12, 0x00, 0x14, 0x71, 0x42, 0x03, 0x61, 0x42, 0x04, 0x41, 0x40, 0x52,
+0x4F, 0xC0, 0x84, 0x00, 0xD0, 0x4C, 0x7C, 0x6B, 0xB7, 0x4C, 0x76, 0x11, 0x2A, 0x11, 0x2A, 0x5C,
+0x11, 0x2A, 0xDB, 0x11, 0x4A, 0x0E, 0x00, 0xCE, 0x4A, 0x2A, 0x32, 0x23, 0x8D, 0x0C, 0xA6, 0x2F,
+0x05, 0x0B, 0x47, 0x16, 0x70, 0x53, 0x6D, 0x00, 0xD4, 0x71, 0x6D, 0xAF, 0x0B, 0x2D, 0x5A, 0x2F,
+0x4A, 0x04, 0x1C, 0x21, 0x05, 0x21, 0x05, 0x59, 0x2B, 0x3E, 0x86, 0x84, 0x11, 0x2F, 0x00, 0xCA,
+0x8F, 0x5C, 0x3B, 0x76, 0x7C, 0x6B, 0x7C, 0x7A, 0x5B, 0x44, 0x00, 0x02, 0x45, 0x42, 0x02, 0x45,
+0x42, 0x04, 0x41, 0x40, 0x15, 0xC5, 0x6B, 0x3D, 0x13, 0xBE, 0x3D, 0x13, 0x01, 0x7D, 0x53, 0xC1,
+0x8B, 0x3D, 0x01, 0xC6, 0x7D, 0x8B, 0x3D, 0x7D, 0x13, 0xB7, 0x00, 0x0D, 0xC4, 0xB6, 0xD0, 0x24,
+0xAC, 0x24, 0x08, 0xC6, 0x5B, 0xD0, 0x14, 0x24, 0xD0, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xD6, 0x07, 0x02, 0x6E, 0x47, 0x04, 0x4D, 0x47, 0x05,
+0x4D, 0x47, 0x00, 0x6E, 0x47, 0x04, 0xC2, 0x81, 0xC0, 0x00, 0x27, 0x41, 0x43, 0x48, 0x43, 0x41,
+0x40, 0x03, 0x42, 0x48, 0x00, 0x42, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00,
+0x40, 0x42, 0x41, 0x08, 0x45, 0x41, 0x0D, 0x45, 0x41, 0x0B, 0x40, 0x41, 0x0D, 0x4B, 0x6D, 0x4B,
+0x41, 0x19, 0x67, 0xC3, 0xB4, 0xC6, 0x4B, 0x38, 0x17, 0xC2, 0xF5, 0x27, 0x01, 0x06, 0x45, 0x41,
+0x1C, 0xD4, 0x67, 0x52, 0x14, 0x52, 0x14, 0x52, 0x14, 0x52, 0x14, 0x52, 0x14, 0x52, 0x14, 0x59,
+0x14, 0x52, 0x14, 0x52, 0x76, 0x05, 0x01, 0x0D, 0xCB, 0xB8, 0x13, 0xCC, 0x4C, 0x13, 0x4C, 0x13,
+0x4C, 0x13, 0x65, 0x4C, 0x65, 0x00, 0xC6, 0x4C, 0x65, 0x4C, 0x65, 0x13, 0x65, 0x01, 0x18, 0x42,
+0x00, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x00, 0x5C, 0x42, 0x00, 0x41, 0x01, 0x65, 0xC9, 0xE3,
+0x6C, 0x71, 0xB8, 0x94, 0x9D, 0x44, 0x64, 0x2B, 0x2A, 0x00, 0xC1, 0xDB, 0x2A, 0x00, 0x51, 0x6A,
+0xC2, 0x42, 0x0C, 0x0E, 0x00, 0x51, 0xC5, 0x8F, 0x2B, 0x35, 0x8D, 0x23, 0x11, 0x00, 0xC1, 0x44,
+0x00, 0x00, 0xC7, 0x47, 0x44, 0x50, 0x08, 0x03, 0x04, 0x02, 0x00, 0x00, 0xCE, 0xBD, 0x2F, 0x11,
+0x2F, 0x4A, 0x3B, 0x2F, 0x4A, 0x3B, 0x4A, 0x2F, 0x3B, 0x11, 0xC9, 0x6C, 0x00, 0xC1, 0x8F, 0x2F,
+0x00, 0xCA, 0xA7, 0x9B, 0x64, 0x50, 0xF5, 0x7C, 0x50, 0x9B, 0x63, 0x2D, 0x01, 0x01, 0x45, 0x42,
+0x00, 0x44, 0x42, 0x44, 0x42, 0x00, 0x44, 0x42, 0x44, 0x42, 0x45, 0x41, 0x14, 0x67, 0xCE, 0xB7,
+0x65, 0x4C, 0x13, 0xCC, 0x4C, 0x13, 0x4C, 0x13, 0x4C, 0x13, 0x4C, 0x65, 0x4C, 0x65, 0x01, 0xC3,
+0x4C, 0x13, 0x7C, 0x01, 0x0C, 0x6D, 0xC1, 0x9D, 0x5E, 0x03, 0x64, 0xC4, 0x5E, 0xD0, 0x5E, 0xD0,
+0x5E, 0x00, 0x54, 0xC0, 0x5E, 0x03, 0xC1, 0xB6, 0x01, 0x0A, 0x5F, 0x41, 0x0F, 0x45, 0x41, 0x06,
+0x67, 0xC2, 0x7D, 0x4B, 0x38, 0x07, 0xC1, 0x81, 0x38, 0x10, 0xC1, 0xB1, 0x01, 0x3D, 0x45, 0x41,
+0x07, 0x45, 0x41, 0x0B, 0x40, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x00, 0x43, 0x01, 0x48, 0x43, 0x03, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0xC2, 0x6D, 0x59, 0x3B, 0x00, 0x72, 0xC3, 0x86, 0x03,
+0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x48, 0xC1, 0x6A, 0x39, 0x00, 0xCF, 0x61,
+0xA0, 0x39, 0xA0, 0x39, 0x61, 0xA0, 0x39, 0x61, 0x39, 0x61, 0x39, 0xA0, 0x61, 0x39, 0x61, 0x00,
+0x79, 0xC5, 0x61, 0x39, 0xA0, 0x39, 0xA0, 0x39, 0x00, 0xC8, 0x76, 0x74, 0x50, 0x03, 0x08, 0x59,
+0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0xC4, 0x6D, 0x08, 0x03, 0x3E, 0x34, 0x06, 0x7E, 0xC2, 0x64, 0x3E, 0x34, 0x02, 0xC1, 0x84, 0x34,
+0x00, 0xC3, 0x58, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x66, 0xC2, 0x6A, 0x88, 0x6F, 0x00, 0xC0, 0xA9, 0x00, 0xCE, 0x92, 0xA9, 0x71, 0x6F, 0x88,
+0x6F, 0x88, 0x6F, 0xA9, 0x6A, 0x88, 0x6F, 0xA9, 0x6D, 0x26, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x00, 0x4A, 0x01, 0x4E, 0x4A, 0x01, 0x4E, 0x4A, 0x4E, 0x4A, 0x00, 0x48, 0xCB, 0x6D, 0x03,
+0x1C, 0xD2, 0x75, 0x11, 0x9B, 0x52, 0x71, 0x11, 0x2A, 0xA7, 0x00, 0x6A, 0xCC, 0xDB, 0x11, 0x2A,
+0xDB, 0x11, 0x2B, 0x0E, 0x92, 0x0E, 0x11, 0xBC, 0x2F, 0x0E, 0x01, 0xC7, 0x4A, 0x5C, 0x64, 0xC5,
+0x01, 0x05, 0xBD, 0x4A, 0x01, 0xC7, 0x59, 0x05, 0x01, 0x05, 0x84, 0xDB, 0x5C, 0x2F, 0x00, 0x51,
+0x01, 0x6F, 0x00, 0x51, 0x00, 0x6F, 0x01, 0xC6, 0x9B, 0x2F, 0x84, 0x2F, 0xA4, 0x95, 0x3B, 0x00,
+0x74, 0xC0, 0x9B, 0x00, 0xC6, 0x6C, 0x5A, 0x03, 0x74, 0x08, 0x03, 0x0A, 0x00, 0x4E, 0x4A, 0x00,
+0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0xC4,
+0x6D, 0xA9, 0x6F, 0x1A, 0x6F, 0x00, 0xC1, 0x92, 0x6F, 0x00, 0xC7, 0x92, 0x6F, 0xA9, 0x1A, 0xA9,
+0x6F, 0x92, 0x6F, 0x01, 0xC4, 0x53, 0x03, 0x26, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x48, 0xC9, 0x6D, 0x03, 0x08, 0x26, 0x71, 0x9B, 0x9C, 0x9B, 0x34, 0x9B, 0x00, 0xC1, 0x64, 0x34,
+0x00, 0xD2, 0x64, 0x34, 0x9C, 0x9B, 0x9C, 0x34, 0x9C, 0x34, 0x9C, 0x71, 0x03, 0x30, 0x08, 0x03,
+0x6D, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x01, 0x48, 0x43, 0x48,
+0xC4, 0x59, 0x26, 0x74, 0x4E, 0x39, 0x00, 0xCC, 0xA0, 0x39, 0x61, 0x39, 0x61, 0xB9, 0xA0, 0x61,
+0x39, 0x61, 0x39, 0x61, 0x39, 0x00, 0xC2, 0xA0, 0x61, 0x39, 0x01, 0xC1, 0x61, 0x39, 0x00, 0xC9,
+0xA0, 0x39, 0x61, 0x39, 0xB9, 0x4E, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x44, 0x41, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x03, 0x4B, 0x40, 0x4B, 0x40, 0x12, 0x52, 0xC4, 0x6C, 0x2B,
+0xC7, 0x0B, 0x00, 0x19, 0xC2, 0xB4, 0x07, 0x0D, 0x00, 0x47, 0x06, 0x4D, 0x01, 0x47, 0x03, 0x4D,
+0x00, 0x47, 0x04, 0xC2, 0xB4, 0x12, 0x00, 0x06, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0xC1, 0x67,
+0x14, 0x00, 0xD1, 0x67, 0x14, 0x67, 0x14, 0x67, 0x14, 0x67, 0x14, 0x67, 0x14, 0x67, 0x14, 0x67,
+0x14, 0x5B, 0x67, 0x3A, 0x00, 0x0A, 0x4B, 0x40, 0x00, 0xD3, 0x7C, 0x7D, 0x8B, 0x7A, 0x94, 0xBE,
+0x8B, 0x94, 0x13, 0x94, 0xBE, 0x3D, 0xBE, 0x3D, 0xBE, 0x3D, 0x94, 0x13, 0x7C, 0x00, 0x00, 0x4B,
+0x40, 0x15, 0x42, 0x07, 0x68, 0x42, 0x00, 0x52, 0x40, 0x00, 0xC3, 0x4F, 0xE3, 0x6C, 0x5C, 0x00,
+0xC6, 0xDB, 0x11, 0x5C, 0xDB, 0x89, 0x90, 0x2F, 0x00, 0x6A, 0xC1, 0xDB, 0x5C, 0x00, 0x6A, 0xDA,
+0x4A, 0x0C, 0x4A, 0x2F, 0xDB, 0x11, 0x4A, 0xC9, 0x4A, 0x5C, 0x2F, 0x11, 0x3B, 0x4A, 0x2F, 0x4A,
+0x8F, 0x11, 0x42, 0xDB, 0x2F, 0x4A, 0x3B, 0x32, 0x8F, 0x5C, 0x11, 0x00, 0xC2, 0x5C, 0x2A, 0x2F,
+0x00, 0x51, 0x00, 0xC7, 0x5C, 0x2F, 0x8F, 0x6C, 0x5C, 0x8F, 0x89, 0x36, 0x00, 0xC8, 0x58, 0x5A,
+0x2F, 0x11, 0x2F, 0x8F, 0xBC, 0x89, 0x00, 0x02, 0x45, 0x42, 0x02, 0x69, 0x42, 0xC1, 0x90, 0x02,
+0x00, 0x69, 0x42, 0x41, 0x40, 0x15, 0xC3, 0xAF, 0x3D, 0x80, 0x3D, 0x00, 0xCF, 0x7A, 0x8B, 0x3D,
+0x7A, 0x8B, 0xBE, 0x94, 0x3D, 0x8B, 0x7A, 0xBE, 0x3D, 0x13, 0xBE, 0x6B, 0x00, 0x0D, 0xC2, 0xB6,
+0xD0, 0x24, 0x03, 0xC1, 0xEE, 0x24, 0x02, 0x54, 0x64, 0x00, 0xC0, 0xD0, 0x00, 0x64, 0x00, 0xC1,
+0xE4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xD6, 0x0D, 0x07, 0x08, 0x6E, 0x4D,
+0x02, 0x47, 0x01, 0x4D, 0x47, 0x01, 0x4D, 0x00, 0x47, 0x4D, 0x00, 0x47, 0xC2, 0x81, 0x0B, 0x00,
+0x19, 0x4B, 0x40, 0x0F, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x01, 0x71, 0x4B, 0x00, 0x40, 0x4B, 0x71, 0x40, 0x00,
+0x4B, 0x40, 0x00, 0x52, 0x4B, 0x00, 0x52, 0x40, 0x4B, 0x52, 0x40, 0x04, 0x71, 0x6D, 0xC3, 0x6C,
+0xC7, 0x2D, 0x00, 0x00, 0x67, 0x4B, 0xC3, 0x47, 0x00, 0x12, 0x00, 0x11, 0x4B, 0x40, 0xC3, 0xB4,
+0x07, 0x0D, 0x07, 0x05, 0x4D, 0x00, 0x6E, 0x47, 0x00, 0x4D, 0x6E, 0x4D, 0x47, 0x4D, 0x47, 0xC1,
+0xBA, 0x07, 0x03, 0x6E, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0xC5, 0x67,
+0x14, 0x67, 0x14, 0x67, 0x14, 0x01, 0xC1, 0x67, 0x14, 0x03, 0xC2, 0x5B, 0x67, 0x14, 0x01, 0xC1,
+0xB7, 0x00, 0x0D, 0xC5, 0x7C, 0x7D, 0x13, 0x94, 0xBE, 0x13, 0x00, 0xC5, 0x8B, 0x7D, 0x3D, 0xBE,
+0x8B, 0x13, 0x00, 0xC8, 0x80, 0x94, 0x3D, 0x13, 0x7A, 0x47, 0x00, 0x12, 0x00, 0x14, 0x41, 0x42,
+0x04, 0x45, 0x42, 0x00, 0x45, 0x69, 0x42, 0x41, 0x40, 0x00, 0xC3, 0x4F, 0xC7, 0xBC, 0x5C, 0x00,
+0x6A, 0x00, 0x51, 0xC6, 0x91, 0x11, 0x5A, 0x90, 0x9A, 0x42, 0x2A, 0x01, 0x6B, 0x6F, 0xC4, 0xDB,
+0x11, 0x8F, 0x2A, 0x42, 0x01, 0x51, 0x01, 0xC5, 0xDB, 0x2B, 0x2A, 0x5C, 0x42, 0x11, 0x00, 0x6F,
+0x00, 0x51, 0xC2, 0x42, 0x2B, 0x2F, 0x01, 0x51, 0x6B, 0x00, 0x51, 0x6F, 0x00, 0x51, 0x00, 0xC2,
+0x5C, 0x2F, 0x11, 0x00, 0x6F, 0x51, 0xCB, 0xA7, 0xA4, 0x37, 0xD9, 0x36, 0x0C, 0x11, 0x3B, 0x5C,
+0x6C, 0x95, 0x00, 0x02, 0x45, 0x42, 0x00, 0x45, 0x42, 0x69, 0x68, 0xC1, 0x90, 0x02, 0x02, 0x41,
+0x40, 0x15, 0x65, 0x53, 0xC3, 0x80, 0x13, 0x3D, 0x13, 0x00, 0xC0, 0x80, 0x00, 0x53, 0x00, 0xC9,
+0x94, 0x13, 0x80, 0x13, 0xBE, 0x3D, 0x7D, 0x13, 0xB7, 0x00, 0x09, 0x4B, 0x40, 0x01, 0xC1, 0xB6,
+0x24, 0x00, 0x54, 0x64, 0x00, 0xC4, 0xD0, 0x24, 0x14, 0xD0, 0x24, 0x01, 0xC2, 0xD0, 0xAC, 0x24,
+0x00, 0xC3, 0x5E, 0x24, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07,
+0xC1, 0xB2, 0x07, 0x06, 0x4D, 0x47, 0x4D, 0x00, 0x6E, 0x4D, 0x47, 0x4D, 0xC1, 0xBA, 0x0D, 0x01,
+0xC1, 0x4B, 0x07, 0x00, 0x4D, 0x00, 0x47, 0x02, 0xC1, 0x81, 0x00, 0x12, 0x4B, 0x40, 0x00, 0x4B,
+0x40, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x4B, 0x40, 0x09, 0x4B, 0x40, 0x41, 0x4B, 0x00, 0x40, 0x4B,
+0x40, 0x05, 0x4B, 0x40, 0x6D, 0x40, 0x02, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x45, 0x42, 0x4B, 0x44, 0x43, 0xC1, 0x44, 0x00,
+0x01, 0x4B, 0x43, 0x00, 0x68, 0x40, 0x69, 0x62, 0x40, 0x4B, 0x40, 0x00, 0x45, 0x00, 0x41, 0x44,
+0x00, 0x40, 0x52, 0xCB, 0x89, 0xD3, 0x2D, 0x05, 0x28, 0x00, 0x0B, 0x25, 0x03, 0x05, 0x00, 0x05,
+0x00, 0x40, 0x0E, 0x4B, 0x40, 0xC3, 0xB4, 0x07, 0x0D, 0x07, 0x04, 0xCD, 0x4B, 0x39, 0x46, 0x0D,
+0x07, 0x81, 0x46, 0x38, 0x45, 0x39, 0x46, 0x0D, 0x4B, 0x07, 0x04, 0xC3, 0xB4, 0x00, 0x0B, 0x00,
+0x00, 0x6D, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0xC1, 0x67, 0x14, 0x00, 0xC9, 0x52,
+0x34, 0xC7, 0x67, 0xC7, 0x34, 0x52, 0xC7, 0x14, 0x52, 0x00, 0xC3, 0x50, 0x83, 0xCE, 0x14, 0x00,
+0x7A, 0x40, 0x0A, 0x4B, 0x40, 0x00, 0xC1, 0x7C, 0x13, 0x00, 0xD3, 0x65, 0x6A, 0x94, 0x7A, 0x56,
+0x4C, 0x13, 0x6F, 0x56, 0xBE, 0x94, 0x56, 0x6F, 0x56, 0x3D, 0x94, 0x0B, 0x00, 0x12, 0x00, 0x15,
+0x42, 0x03, 0x43, 0x4A, 0x44, 0x43, 0x4A, 0x48, 0x42, 0x41, 0x40, 0x00, 0x7A, 0xC2, 0xD2, 0xBC,
+0x11, 0x00, 0x7B, 0x00, 0x6B, 0xC6, 0xD2, 0x9A, 0xC9, 0x9A, 0x2F, 0x2B, 0x3B, 0x01, 0xC2, 0x6C,
+0x2F, 0x2A, 0x00, 0xC1, 0x5C, 0x11, 0x00, 0x7B, 0xC2, 0x64, 0x3B, 0x2B, 0x00, 0xC1, 0xDB, 0x2A,
+0x00, 0x6B, 0x00, 0x7B, 0xC0, 0x64, 0x00, 0x51, 0x7B, 0x51, 0xC7, 0x5C, 0x2F, 0x11, 0x3B, 0x64,
+0x34, 0x64, 0x3B, 0x00, 0x6F, 0x00, 0x51, 0x6B, 0x7B, 0x74, 0xCE, 0x86, 0x34, 0x3B, 0x2B, 0x9A,
+0x3F, 0xF6, 0x64, 0x3B, 0x52, 0x53, 0x34, 0x6C, 0xCE, 0x00, 0x02, 0x45, 0x42, 0x43, 0x48, 0x42,
+0xC2, 0x50, 0x58, 0x02, 0x03, 0x41, 0x40, 0x15, 0xC9, 0x6B, 0x3D, 0x13, 0x8B, 0x6A, 0xCC, 0x8B,
+0x13, 0x56, 0x8B, 0x00, 0xC4, 0x56, 0x65, 0x7D, 0x13, 0x6A, 0x00, 0x53, 0x00, 0xC1, 0x6B, 0x00,
+0x0D, 0xCA, 0xB6, 0x24, 0x5E, 0x4E, 0x61, 0x4E, 0xAC, 0x87, 0xA0, 0x24, 0x4E, 0x00, 0xC1, 0xAC,
+0x24, 0x00, 0xC2, 0x61, 0x6F, 0x24, 0x00, 0xC1, 0xB6, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x04, 0xC5, 0xBA, 0x0D, 0x38, 0x39, 0x46, 0x0D, 0x00, 0xC7, 0xCB,
+0x46, 0x38, 0x46, 0x39, 0x45, 0x0D, 0x07, 0x04, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x12, 0x65,
+0x61, 0x40, 0x00, 0x61, 0x43, 0x42, 0x5F, 0x43, 0x61, 0x40, 0x03, 0x41, 0x44, 0x40, 0x42, 0x43,
+0x44, 0x41, 0x40, 0x4B, 0x00, 0x42, 0x43, 0x44, 0x67, 0x65, 0x68, 0x40, 0x02, 0x41, 0x42, 0xC6,
+0x47, 0x04, 0x03, 0x01, 0x00, 0x01, 0x00, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x4A, 0xC6, 0x49, 0xAF, 0x86, 0x02, 0x08, 0x02, 0x00, 0x00,
+0x65, 0x4E, 0x44, 0x48, 0x45, 0xCB, 0x9E, 0x3F, 0x00, 0x0B, 0x00, 0x05, 0x0E, 0x04, 0x02, 0x0E,
+0x02, 0x00, 0x00, 0x71, 0x40, 0x71, 0xCA, 0x86, 0x0A, 0x00, 0x0B, 0x04, 0x03, 0x30, 0x05, 0x23,
+0x02, 0x00, 0x0E, 0x52, 0x4B, 0xC3, 0xB4, 0x07, 0x0D, 0x07, 0x04, 0xCC, 0x45, 0x4E, 0x87, 0x45,
+0x4B, 0x4D, 0xC2, 0xB1, 0xB9, 0x87, 0x55, 0x0D, 0x07, 0x04, 0x6E, 0xC1, 0xB4, 0x00, 0x07, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0xC1, 0x67, 0x14, 0x00, 0x7B, 0xC1, 0x71, 0x34, 0x01, 0xC9, 0x52,
+0x34, 0x64, 0x71, 0x9B, 0x5E, 0x64, 0x3B, 0x67, 0x14, 0x00, 0xC1, 0xB7, 0x00, 0x0D, 0xD4, 0x7C,
+0x7D, 0x8B, 0x6A, 0x9E, 0x65, 0x56, 0xC2, 0x4C, 0x6A, 0x6F, 0x88, 0x94, 0x7A, 0x6F, 0x56, 0x88,
+0x13, 0x7A, 0x47, 0x00, 0x16, 0x41, 0x42, 0x03, 0x4A, 0x43, 0x4E, 0x42, 0x4A, 0x00, 0x42, 0x41,
+0x40, 0x00, 0x7A, 0xC4, 0xE3, 0x5C, 0x9B, 0x52, 0x9D, 0x00, 0xCC, 0x71, 0x23, 0x26, 0xEF, 0x54,
+0x2B, 0x64, 0x50, 0xD4, 0x65, 0x50, 0x2F, 0x2A, 0x01, 0xC9, 0x6C, 0x52, 0xD4, 0x7C, 0x65, 0x53,
+0xC2, 0x42, 0x2A, 0x2B, 0x00, 0xC5, 0x71, 0xE4, 0x7C, 0x65, 0x52, 0x11, 0x00, 0xC9, 0x5C, 0x2B,
+0x3B, 0x50, 0xB7, 0xD8, 0x94, 0x71, 0x3B, 0x11, 0x00, 0x6B, 0x7B, 0xC1, 0x9D, 0xB7, 0x00, 0xCD,
+0x7A, 0x71, 0x11, 0x8F, 0xB0, 0x3B, 0x9B, 0x9D, 0xB7, 0x6B, 0x65, 0x83, 0xCE, 0x00, 0x02, 0x45,
+0x44, 0x4A, 0x4E, 0x48, 0x4E, 0x00, 0x66, 0x42, 0x02, 0x41, 0x40, 0x15, 0x65, 0x53, 0xD2, 0x80,
+0x13, 0x9E, 0x6A, 0x65, 0xD5, 0x88, 0xDF, 0x56, 0x9E, 0x65, 0x8B, 0x56, 0x6A, 0xA9, 0x76, 0x80,
+0xB7, 0x00, 0x09, 0x4B, 0x40, 0x01, 0xD4, 0xB6, 0xD0, 0x4E, 0x61, 0xCD, 0xA9, 0x61, 0x6F, 0xCD,
+0x4E, 0x87, 0xC1, 0x14, 0xAC, 0x5E, 0xCD, 0xC1, 0x4E, 0xD0, 0xE7, 0x00, 0x01, 0x4B, 0x40, 0x06,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x05, 0x4D, 0x00, 0xCC, 0x46, 0x6E,
+0xBB, 0x45, 0x38, 0x4D, 0xC2, 0x45, 0x39, 0x7F, 0xBB, 0x0D, 0x07, 0x05, 0x6E, 0xC1, 0x81, 0x00,
+0x12, 0x41, 0x4A, 0x00, 0x40, 0x4B, 0x66, 0x42, 0x48, 0x02, 0x40, 0x03, 0x42, 0x63, 0x45, 0x44,
+0x01, 0x48, 0x40, 0x4B, 0x00, 0x4A, 0xC3, 0x60, 0x53, 0x28, 0x0A, 0x00, 0x40, 0x02, 0x48, 0x7E,
+0x45, 0x43, 0x44, 0x43, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x45, 0x4E, 0xC6, 0x49, 0x04, 0x50, 0x00, 0x02, 0x60, 0x00, 0x00,
+0x65, 0x4E, 0x43, 0x4A, 0x67, 0xC6, 0x44, 0x02, 0x00, 0x0B, 0x00, 0x12, 0x04, 0x00, 0x45, 0x44,
+0x48, 0x45, 0x40, 0x00, 0x71, 0x40, 0x61, 0x66, 0x40, 0x00, 0x4B, 0x42, 0x48, 0x52, 0x44, 0x42,
+0x40, 0x0E, 0x4B, 0x40, 0xC3, 0xB4, 0x07, 0x0D, 0x07, 0x04, 0x4D, 0xCB, 0x55, 0xBB, 0x45, 0x0D,
+0xCB, 0x39, 0x45, 0x7F, 0x55, 0xEC, 0x38, 0x07, 0x05, 0xC3, 0xB4, 0x00, 0x0B, 0x00, 0x00, 0x6D,
+0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0xC8, 0x67, 0x14, 0x5B, 0x71, 0x9C, 0x34, 0x64,
+0x59, 0x67, 0x00, 0xC6, 0x9B, 0x2B, 0x34, 0x67, 0x52, 0x9C, 0x14, 0x00, 0xC2, 0x67, 0x3A, 0x00,
+0x0A, 0x4B, 0x40, 0x00, 0xD5, 0x7C, 0x13, 0x7D, 0x64, 0x88, 0x6F, 0x7C, 0x6F, 0x56, 0x94, 0x56,
+0x88, 0x4C, 0x56, 0x94, 0x76, 0x6F, 0x13, 0x94, 0x0B, 0x12, 0x00, 0x16, 0x42, 0x03, 0x45, 0xC4,
+0x58, 0x08, 0x02, 0x0E, 0x02, 0x00, 0x52, 0x40, 0x00, 0x7A, 0xCE, 0x84, 0x6C, 0x76, 0x6B, 0x0B,
+0x6B, 0x7C, 0x53, 0x3B, 0xA7, 0xDB, 0x3B, 0x9D, 0xE9, 0x6B, 0x00, 0xCC, 0x7C, 0x71, 0x2B, 0x2A,
+0x2B, 0x34, 0x7C, 0x6B, 0xAF, 0x6B, 0x7C, 0xA9, 0x42, 0x00, 0x6B, 0xDB, 0x71, 0x7C, 0x6B, 0xAF,
+0x6B, 0x94, 0xA9, 0x2B, 0xBC, 0x3B, 0x76, 0xD8, 0xE9, 0x25, 0x7C, 0x94, 0x34, 0x32, 0x42, 0x2B,
+0x76, 0xD8, 0xC0, 0x0B, 0xD8, 0x65, 0x9B, 0x11, 0x00, 0x7B, 0xC7, 0x67, 0xE9, 0xC0, 0xAF, 0xD8,
+0x4C, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x00, 0x4E, 0x48, 0x4A, 0x4E, 0xC1, 0x60, 0x02, 0x02, 0x41,
+0x40, 0x15, 0xD4, 0x6B, 0x13, 0x80, 0x6F, 0x88, 0x64, 0x13, 0x4C, 0xA9, 0x13, 0x6F, 0x88, 0x4C,
+0x76, 0x13, 0x65, 0x88, 0x4C, 0x13, 0x6B, 0x00, 0x0D, 0xC4, 0xB6, 0xAC, 0xD5, 0x4E, 0x24, 0x00,
+0xC1, 0x4E, 0xC1, 0x00, 0xC3, 0x5E, 0x4E, 0xCD, 0x5E, 0x00, 0xC6, 0xC1, 0x4E, 0xA0, 0xCD, 0x24,
+0x1C, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x05, 0xCF, 0xCB, 0x07,
+0x81, 0x55, 0x87, 0x38, 0x79, 0x38, 0x39, 0x4B, 0x81, 0x6E, 0x4D, 0x0D, 0x4B, 0x07, 0x03, 0x4D,
+0x47, 0xC2, 0x81, 0x0B, 0x00, 0x11, 0x4B, 0x45, 0x43, 0x4B, 0x40, 0x00, 0x5C, 0x43, 0xC3, 0x44,
+0x08, 0x03, 0x00, 0x03, 0x4A, 0x00, 0x48, 0x44, 0x42, 0x40, 0x4A, 0x41, 0x40, 0x00, 0x4A, 0x48,
+0x4E, 0xC3, 0xAA, 0x05, 0x03, 0x00, 0x02, 0x45, 0x43, 0x4B, 0x67, 0x48, 0x68, 0x40, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x43, 0xC7,
+0x6D, 0x30, 0x0A, 0x53, 0x05, 0x53, 0x04, 0x00, 0x00, 0x65, 0x4A, 0x45, 0xC6, 0x49, 0x01, 0x44,
+0x3F, 0x00, 0x0B, 0x00, 0x00, 0x44, 0x5C, 0x42, 0x00, 0x43, 0x45, 0x40, 0x00, 0x6D, 0x4B, 0xC8,
+0x4F, 0x26, 0x00, 0x01, 0x44, 0x02, 0x08, 0x01, 0x04, 0x00, 0x40, 0x0F, 0x4B, 0xC3, 0xB4, 0x07,
+0x0D, 0x07, 0x04, 0xCD, 0x46, 0xED, 0xA0, 0x46, 0xBA, 0x81, 0x39, 0xC6, 0x6E, 0x55, 0x87, 0x0D,
+0x79, 0x07, 0x03, 0x6E, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0xCD, 0x67,
+0x14, 0x5B, 0x34, 0x52, 0x3B, 0x3E, 0x64, 0x52, 0x34, 0x64, 0x71, 0x64, 0x52, 0x00, 0x74, 0x54,
+0x01, 0x7A, 0x40, 0x0D, 0xD6, 0x7C, 0x7D, 0x6F, 0x88, 0x6A, 0x9E, 0x94, 0x6F, 0x56, 0x6A, 0x4C,
+0xA9, 0x6A, 0x76, 0x6F, 0x88, 0x4C, 0x65, 0x7C, 0xAF, 0x0B, 0x12, 0x00, 0x14, 0x41, 0x42, 0x03,
+0x4E, 0x4A, 0x42, 0x43, 0x4A, 0x42, 0x00, 0x41, 0x40, 0x00, 0x4F, 0xDC, 0xE3, 0x34, 0xD4, 0xAF,
+0x00, 0x31, 0x7C, 0x56, 0x11, 0x2A, 0x42, 0x3E, 0x7C, 0xAF, 0x0B, 0x2D, 0x7C, 0x4C, 0x32, 0x2A,
+0x2B, 0xA9, 0xD8, 0xAF, 0x31, 0x47, 0xE4, 0x56, 0x2B, 0x00, 0xD2, 0x42, 0x76, 0xD8, 0xD3, 0x47,
+0xAF, 0x7A, 0x76, 0x32, 0x2A, 0x3B, 0xCC, 0xD8, 0x47, 0x2D, 0x25, 0x13, 0x71, 0x11, 0x00, 0x72,
+0xD1, 0x65, 0x6B, 0x01, 0x2D, 0x7C, 0x13, 0x71, 0x42, 0x2A, 0x64, 0x65, 0xC0, 0x27, 0x0B, 0x7C,
+0x65, 0x8A, 0x00, 0x02, 0x45, 0x44, 0x48, 0x00, 0x4E, 0x4A, 0x48, 0xC6, 0x58, 0x28, 0x02, 0x1C,
+0x02, 0x01, 0x00, 0x15, 0x65, 0x7D, 0x53, 0xD1, 0x66, 0x6A, 0x88, 0x6A, 0xCC, 0xA9, 0x56, 0x88,
+0x23, 0x6A, 0x56, 0x6A, 0x88, 0x50, 0x94, 0x13, 0xB7, 0x00, 0x09, 0x4B, 0x40, 0x01, 0xCE, 0xB6,
+0x24, 0x4E, 0x6F, 0x4E, 0x61, 0x6F, 0x4E, 0xC1, 0x4E, 0x5E, 0xCD, 0x24, 0xA0, 0x61, 0x00, 0xC4,
+0x6F, 0x4E, 0x24, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1,
+0xB2, 0x07, 0x05, 0xCE, 0xBA, 0x07, 0x4D, 0x55, 0xA0, 0x46, 0x38, 0x07, 0xB9, 0xC6, 0x87, 0x61,
+0x38, 0x0D, 0x07, 0x05, 0x6E, 0xC1, 0x81, 0x00, 0x12, 0x52, 0xCB, 0x4F, 0x59, 0x00, 0x01, 0x03,
+0x0A, 0x01, 0x0A, 0x02, 0x0A, 0x01, 0x00, 0x01, 0x45, 0x4E, 0x5C, 0x4A, 0x48, 0x44, 0x42, 0x48,
+0x40, 0x4B, 0x00, 0x4A, 0x69, 0x66, 0x42, 0x45, 0x43, 0x40, 0x02, 0x65, 0x48, 0x41, 0x4A, 0x44,
+0x41, 0x40, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x42, 0x41, 0x40, 0x42, 0xCE, 0x44, 0x03, 0x04, 0x00, 0x01, 0x47, 0x01, 0x63, 0x03,
+0x05, 0x00, 0x05, 0x1F, 0x2D, 0x01, 0x00, 0x40, 0x45, 0x5F, 0x41, 0x43, 0x42, 0x40, 0x00, 0x6D,
+0x40, 0x00, 0x41, 0x45, 0x41, 0x5F, 0xC6, 0x4F, 0x03, 0x05, 0x00, 0x05, 0x25, 0x00, 0x0E, 0x4B,
+0x40, 0xC3, 0xD6, 0x2E, 0x0D, 0x07, 0x04, 0xCC, 0x4B, 0x4D, 0x46, 0x38, 0x45, 0x0D, 0x45, 0x38,
+0x46, 0x39, 0x45, 0x0D, 0x07, 0x05, 0xC1, 0xB4, 0x00, 0x01, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x0E,
+0x41, 0x40, 0x0A, 0x52, 0xC1, 0x67, 0x14, 0x00, 0xC4, 0x52, 0x34, 0x83, 0x67, 0x34, 0x00, 0xC0,
+0x52, 0x00, 0x54, 0xC4, 0x52, 0x83, 0x14, 0x52, 0x14, 0x00, 0xC2, 0x67, 0x3A, 0x00, 0x0C, 0x4B,
+0xC8, 0x7C, 0x7D, 0x56, 0xCC, 0xDF, 0x56, 0xCC, 0x56, 0xCC, 0x00, 0xCA, 0x6F, 0x56, 0x94, 0xBE,
+0x6A, 0x6F, 0x6A, 0x13, 0x7A, 0x2D, 0x0B, 0x00, 0x40, 0x12, 0x52, 0x40, 0x71, 0x42, 0x03, 0x4A,
+0x00, 0x43, 0x44, 0x43, 0x42, 0x00, 0x41, 0x40, 0x00, 0x4F, 0x7E, 0x00, 0xCC, 0x65, 0xAF, 0x12,
+0x0B, 0x8A, 0x56, 0x11, 0x2A, 0x2B, 0x34, 0x7A, 0x6B, 0x2D, 0x00, 0xDF, 0x65, 0x4C, 0x32, 0x2A,
+0x2B, 0x71, 0xDF, 0xC0, 0x12, 0x47, 0xB8, 0x76, 0x2B, 0x42, 0x2B, 0x71, 0xD8, 0x6B, 0xC0, 0x6B,
+0x65, 0x6A, 0x2B, 0x42, 0x2B, 0x56, 0xD8, 0x6B, 0x2D, 0xB7, 0x13, 0x71, 0x72, 0xC9, 0x42, 0x2B,
+0x4C, 0x6B, 0xAF, 0x6B, 0x94, 0x4C, 0x3E, 0x11, 0x00, 0x7B, 0xC7, 0xD4, 0x6B, 0xC0, 0x6B, 0x7A,
+0x76, 0x1C, 0x00, 0x02, 0x45, 0x42, 0x48, 0x4A, 0x42, 0xC3, 0x6D, 0x0A, 0x04, 0x02, 0x02, 0x41,
+0x40, 0x15, 0xD4, 0x6B, 0x13, 0xCC, 0x56, 0x94, 0xCC, 0x56, 0x13, 0x56, 0x94, 0x3D, 0x56, 0x65,
+0xDF, 0x56, 0x6F, 0x6A, 0x4C, 0x13, 0x6B, 0x00, 0x0D, 0xC3, 0xB6, 0xD0, 0xAC, 0x61, 0x00, 0xC0,
+0x4E, 0x00, 0xC2, 0x87, 0x6F, 0xAC, 0x00, 0xC9, 0x4E, 0x5E, 0x24, 0xAC, 0x61, 0xCD, 0x24, 0xD0,
+0xD4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x6D, 0x4B, 0x71, 0xC2, 0xB2, 0x2E, 0x07,
+0x04, 0x4D, 0x47, 0xC8, 0x4B, 0x39, 0x46, 0x4B, 0xC6, 0x07, 0x45, 0x4B, 0x39, 0x00, 0xC2, 0x46,
+0x0D, 0x07, 0x04, 0x4D, 0x47, 0xC2, 0x81, 0x31, 0x00, 0x12, 0x41, 0x45, 0x41, 0x5F, 0x44, 0x43,
+0x42, 0x45, 0x43, 0x42, 0x40, 0x02, 0x45, 0x00, 0x40, 0x68, 0x5C, 0x43, 0x00, 0x41, 0x01, 0x4B,
+0x44, 0x43, 0x44, 0x40, 0x41, 0x45, 0x41, 0x02, 0x40, 0x45, 0x65, 0x43, 0x00, 0x45, 0x40, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41,
+0x40, 0x06, 0x45, 0x66, 0x48, 0x42, 0x40, 0x03, 0xC2, 0x47, 0x04, 0x08, 0x00, 0x45, 0x40, 0x22,
+0x4B, 0x40, 0xC3, 0xB4, 0x07, 0x0D, 0x07, 0x16, 0xC3, 0x79, 0xB4, 0x0B, 0x00, 0x00, 0x4B, 0x40,
+0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x09, 0x52, 0xC1, 0x67, 0x14, 0x00, 0xC0, 0x5B, 0x04, 0x54,
+0xC2, 0x5B, 0x14, 0x5B, 0x00, 0xC2, 0xCE, 0x14, 0x5B, 0x00, 0xC2, 0x76, 0xE7, 0x00, 0x0C, 0x4B,
+0xD6, 0x7C, 0x13, 0x80, 0x8B, 0x13, 0x3D, 0x80, 0x3D, 0x80, 0x3D, 0x8B, 0x80, 0x13, 0x7D, 0x8B,
+0x94, 0x8B, 0x80, 0x7C, 0x2D, 0x00, 0x0B, 0x00, 0x11, 0x52, 0x00, 0x40, 0x4B, 0x42, 0x04, 0x45,
+0x69, 0x42, 0x02, 0x67, 0x4B, 0x40, 0x7A, 0xD7, 0xA7, 0x9B, 0x4C, 0x7C, 0xAF, 0x7C, 0x4C, 0x53,
+0x32, 0x2A, 0x2B, 0x3B, 0x65, 0x7C, 0x6B, 0x7C, 0x4C, 0x71, 0x2B, 0x32, 0x42, 0x3B, 0x7A, 0xD8,
+0x00, 0xCE, 0xB8, 0x4C, 0xA9, 0x42, 0x2B, 0xA6, 0x64, 0xB8, 0x7C, 0xD8, 0x7A, 0x65, 0x64, 0x32,
+0x2B, 0x00, 0xDB, 0x92, 0x7C, 0xD8, 0x7C, 0x7A, 0x4C, 0x3B, 0x32, 0x2B, 0xA6, 0xA9, 0x7C, 0xD8,
+0xDF, 0x65, 0x9D, 0x3B, 0x2F, 0x11, 0x3B, 0x52, 0x7C, 0xD8, 0xDF, 0x65, 0x14, 0x44, 0x00, 0x00,
+0x52, 0x40, 0x45, 0x42, 0x69, 0x45, 0x42, 0x00, 0x45, 0x42, 0x03, 0x4F, 0x52, 0x00, 0x40, 0x13,
+0x65, 0x7D, 0xC0, 0x7D, 0x00, 0x53, 0xCA, 0x8B, 0x3D, 0x80, 0x3D, 0x80, 0x13, 0x8B, 0x80, 0x13,
+0x3D, 0x8B, 0x00, 0xC3, 0x7D, 0x3D, 0x4F, 0x00, 0x09, 0x4B, 0x40, 0x01, 0xC2, 0xB6, 0x5E, 0x24,
+0x0F, 0xC1, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x52, 0x4B,
+0x40, 0xC2, 0xB2, 0x2E, 0x07, 0x1A, 0xC2, 0x81, 0x0B, 0x00, 0x27, 0x41, 0x43, 0x48, 0x43, 0x41,
+0x40, 0x03, 0x42, 0x48, 0x00, 0x42, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x42, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x00, 0x41, 0x00, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x00, 0x45, 0x00, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x00, 0x65, 0x41, 0x00, 0x45, 0x41, 0x00, 0x45, 0x41, 0x4F, 0x41, 0x02,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x65, 0x5F, 0x41, 0x67, 0x41, 0x7A, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F,
+0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F,
+0x5F, 0x4F, 0x5F, 0x4F, 0x65, 0x5F, 0xDF, 0xF5, 0xC6, 0xB1, 0x45, 0xB1, 0x45, 0xB1, 0x45, 0xB1,
+0x45, 0xB1, 0x45, 0xB1, 0x45, 0xB1, 0x45, 0xB1, 0x45, 0xB1, 0x45, 0xB1, 0x45, 0xB1, 0x45, 0xB1,
+0x45, 0x38, 0xB1, 0x94, 0x0F, 0x1F, 0x0F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x61, 0x41, 0x5F,
+0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x65, 0x45, 0x00,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x5F, 0x65, 0x5F, 0x4F, 0x00, 0xC1, 0x63, 0x52, 0x0F,
+0xC5, 0x59, 0xC5, 0x01, 0x0F, 0x01, 0x0F, 0x00, 0x41, 0x4F, 0x00, 0x41, 0x4F, 0x00, 0x41, 0x4F,
+0x00, 0x65, 0xC1, 0xB8, 0x4C, 0x04, 0xC1, 0xCC, 0x4C, 0x09, 0x41, 0x01, 0x4F, 0x65, 0x4F, 0x65,
+0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x41, 0x65,
+0x4F, 0x41, 0x45, 0x44, 0x09, 0x42, 0x45, 0x5F, 0x45, 0x7A, 0xCE, 0xE3, 0x6C, 0x34, 0x9D, 0x7A,
+0x13, 0x76, 0x3B, 0x84, 0x9A, 0x42, 0x2B, 0x64, 0x4C, 0x65, 0x00, 0xC2, 0x71, 0x32, 0x2B, 0x00,
+0xD1, 0x42, 0x32, 0x64, 0x9D, 0x3D, 0x5B, 0xA9, 0x35, 0x2B, 0x42, 0x2B, 0x32, 0x64, 0x4C, 0x65,
+0x4C, 0x64, 0x2B, 0x02, 0x72, 0xC1, 0xA9, 0x4C, 0x00, 0xC2, 0x56, 0xC2, 0x32, 0x00, 0x51, 0x72,
+0x6B, 0xC6, 0x88, 0x9D, 0x65, 0x76, 0x3B, 0x2A, 0x2F, 0x00, 0xC3, 0x9A, 0x3B, 0x50, 0x9D, 0x00,
+0xC8, 0x52, 0x9C, 0xCE, 0x1F, 0x25, 0x0F, 0x25, 0x02, 0x04, 0x08, 0xC2, 0x89, 0x05, 0x01, 0x02,
+0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65, 0x4F, 0x65,
+0x4F, 0x65, 0x41, 0x61, 0xC0, 0x4C, 0x09, 0xC1, 0xCC, 0x4C, 0x04, 0x61, 0x65, 0x5F, 0x4F, 0x65,
+0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x65, 0x5F, 0x4F, 0x5F, 0x4F, 0x65, 0xC1, 0x67, 0x5E, 0x02, 0xC1,
+0x52, 0x5E, 0x07, 0xC1, 0x52, 0x5E, 0x01, 0xCD, 0x9D, 0x0F, 0x1F, 0x0F, 0x1F, 0x25, 0x1F, 0x0F,
+0x1F, 0x0F, 0x1F, 0x0F, 0x25, 0x05, 0x00, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0xC1, 0x4F, 0x47, 0x00, 0x41, 0xC0, 0x47, 0x00, 0x5F,
+0x41, 0x00, 0x67, 0xDB, 0x7D, 0x45, 0xB1, 0xC3, 0x38, 0xC3, 0x38, 0xB1, 0xC3, 0xB1, 0xC3, 0x38,
+0xC3, 0x38, 0xC3, 0x38, 0xC3, 0x38, 0xC3, 0x38, 0xB1, 0xC3, 0xB1, 0xC3, 0x38, 0xC3, 0xB1, 0xC3,
+0x00, 0x78, 0xDF, 0xDC, 0x05, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F,
+0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F,
+0x0F, 0x1F, 0x0F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x45, 0x41, 0x03,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x02, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x01, 0x41,
+0x00, 0x45, 0x41, 0x45, 0x41, 0x00, 0x45, 0x01, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x01, 0x40, 0x43, 0x09, 0x48, 0x43, 0x0D, 0x48, 0x43, 0x1A, 0xC5, 0x59, 0x3B, 0x2B,
+0x32, 0x86, 0x03, 0x00, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01,
+0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x02, 0xC2, 0x53, 0x76, 0x50,
+0x18, 0xC1, 0x53, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x03, 0x48, 0x43, 0x01, 0xC1, 0x50, 0x03, 0x01,
+0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x03, 0x48, 0x43, 0x09, 0xC4, 0x50, 0x53, 0x59, 0x08,
+0x59, 0x09, 0x48, 0xC0, 0x59, 0x03, 0x70, 0x00, 0x48, 0x70, 0x48, 0x70, 0x48, 0x70, 0x48, 0x70,
+0x48, 0x70, 0x48, 0x00, 0x70, 0xC0, 0x53, 0x00, 0xD3, 0x6D, 0x03, 0x6D, 0x50, 0x08, 0x6D, 0x03,
+0x6D, 0x03, 0x6D, 0x50, 0x08, 0x50, 0x6D, 0x50, 0x6D, 0x53, 0x1A, 0x92, 0x1A, 0x00, 0xD3, 0x92,
+0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92,
+0x1A, 0x70, 0x1A, 0x00, 0xC1, 0x70, 0x0A, 0x0A, 0x43, 0x01, 0xCD, 0xBD, 0xD2, 0x5F, 0x11, 0x3B,
+0x34, 0x64, 0x11, 0x2A, 0x9A, 0x90, 0x4A, 0x2F, 0x2B, 0x00, 0xC2, 0x9E, 0xC2, 0x2B, 0x00, 0xC3,
+0xDB, 0x11, 0x42, 0x2B, 0x01, 0xC0, 0xC2, 0x00, 0x6B, 0x01, 0x72, 0x6B, 0x00, 0xC5, 0xA6, 0x2B,
+0x9E, 0x2B, 0xA6, 0x2B, 0x00, 0x72, 0x6B, 0xC0, 0xA6, 0x00, 0x72, 0xC4, 0xC2, 0x2B, 0x32, 0x3B,
+0x32, 0x00, 0xCD, 0xA6, 0x2B, 0xA6, 0x32, 0x3B, 0x32, 0x11, 0x84, 0x7E, 0x9A, 0x90, 0x84, 0x11,
+0x3B, 0x00, 0xC0, 0x6C, 0x00, 0xC1, 0x86, 0x03, 0x02, 0x48, 0x4A, 0x09, 0xC1, 0x70, 0x92, 0x00,
+0x5A, 0x01, 0xDF, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92,
+0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x6D, 0x50, 0x6D, 0x51, 0x6D, 0x08, 0x6D, 0x50, 0x08, 0x50,
+0x08, 0x6D, 0x03, 0xC6, 0x6D, 0x03, 0x6D, 0x03, 0x53, 0x6D, 0x03, 0x0D, 0xC1, 0x86, 0x9C, 0x00,
+0x74, 0xC0, 0x9C, 0x01, 0x74, 0xC6, 0x9C, 0x34, 0x9C, 0x34, 0x9C, 0x34, 0x9C, 0x00, 0x74, 0xC0,
+0x9C, 0x00, 0xC1, 0x71, 0x03, 0x05, 0xC1, 0x50, 0x03, 0x02, 0x48, 0x43, 0x0E, 0xCC, 0x59, 0x2F,
+0x11, 0x6C, 0x2F, 0x6C, 0x11, 0x2F, 0x6C, 0x2F, 0x11, 0x83, 0x39, 0x1B, 0xC1, 0x6E, 0x03, 0x03,
+0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01,
+0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x50, 0x03, 0x01,
+0xC1, 0x50, 0x03, 0x17, 0x48, 0x43, 0x07, 0x48, 0x43, 0x09, 0x48, 0x42, 0x41, 0x42, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0xC5, 0xD3, 0x6C, 0x2B, 0x14, 0x12, 0x00, 0x17, 0x4B, 0x40,
+0x41, 0x40, 0x18, 0x52, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x67, 0x4B, 0x40, 0x0A, 0x41, 0x40,
+0x10, 0x5E, 0x67, 0x5E, 0x67, 0x5E, 0x67, 0x5E, 0x67, 0x5E, 0x67, 0x5E, 0x67, 0xC2, 0xD9, 0x01,
+0x27, 0x00, 0x6D, 0x40, 0x0F, 0xC1, 0x4F, 0x41, 0x00, 0x49, 0x55, 0x10, 0x49, 0x00, 0x50, 0x55,
+0x5B, 0x69, 0x42, 0x09, 0x4B, 0x40, 0x00, 0x65, 0xC4, 0xD2, 0x5F, 0x6C, 0x5C, 0x2A, 0x00, 0x51,
+0xC0, 0x9A, 0x00, 0xC3, 0x5A, 0x90, 0xB0, 0xA6, 0x02, 0x6B, 0x7B, 0x72, 0x51, 0xC0, 0x42, 0x00,
+0x6B, 0xC0, 0x42, 0x01, 0x51, 0x02, 0xD0, 0xC2, 0x32, 0xC2, 0x42, 0xA6, 0x2B, 0x32, 0x42, 0x32,
+0x23, 0x32, 0x2B, 0x32, 0xA6, 0x42, 0x11, 0x32, 0x02, 0xC0, 0x42, 0x00, 0x72, 0x00, 0x51, 0x72,
+0x00, 0xC6, 0xA7, 0x3F, 0x03, 0x4A, 0x9A, 0xB0, 0x2F, 0x00, 0xC0, 0x6C, 0x00, 0xC1, 0x95, 0x00,
+0x02, 0x5F, 0x42, 0x08, 0x69, 0x5B, 0x55, 0x00, 0x5B, 0x49, 0x55, 0x11, 0x5B, 0x71, 0x40, 0x0E,
+0x4B, 0x67, 0x40, 0x0D, 0xC2, 0xB6, 0x24, 0x14, 0x00, 0x64, 0xC4, 0x5B, 0x24, 0x14, 0x24, 0x14,
+0x00, 0x64, 0x54, 0x64, 0x54, 0x64, 0x54, 0x64, 0x54, 0xC1, 0xE7, 0x00, 0x0A, 0x41, 0x40, 0x0E,
+0xC2, 0xD9, 0xD1, 0x19, 0x00, 0xC1, 0x9F, 0x19, 0x04, 0x64, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x47,
+0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x05, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x02, 0x47,
+0xC2, 0x81, 0x0B, 0x00, 0x3C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x71, 0x6D, 0xC3, 0x9B, 0xC7, 0x12, 0x00, 0x1A, 0x41, 0x71,
+0x40, 0x18, 0x41, 0x40, 0x4B, 0x40, 0x05, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0D,
+0x4B, 0x00, 0x52, 0x4F, 0x5E, 0x4F, 0x5E, 0xC4, 0xD9, 0x12, 0x1E, 0xD9, 0x1E, 0x00, 0xC4, 0xD9,
+0x27, 0xD9, 0x0F, 0x1E, 0x00, 0x67, 0x40, 0x0F, 0xC1, 0x4F, 0x97, 0x00, 0x49, 0x05, 0xC2, 0x41,
+0x15, 0x09, 0x00, 0x5B, 0x49, 0x00, 0x55, 0x49, 0x02, 0xC0, 0x97, 0x00, 0x49, 0x55, 0x50, 0x5C,
+0x42, 0x03, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x67, 0x40, 0x00, 0x65, 0xC1, 0xB0, 0xBC, 0x00,
+0x6A, 0x00, 0xC7, 0x5C, 0x2F, 0x36, 0x22, 0x3F, 0xA7, 0x2B, 0x42, 0x00, 0xC1, 0xA6, 0x42, 0x00,
+0x51, 0x72, 0xC3, 0x42, 0xA6, 0x42, 0xA6, 0x00, 0xC4, 0x42, 0x2B, 0xA6, 0x32, 0x2B, 0x00, 0xC1,
+0xA6, 0x32, 0x02, 0x6B, 0x72, 0xC5, 0x42, 0x32, 0x2B, 0x32, 0x2B, 0xA6, 0x00, 0x75, 0xC1, 0x42,
+0x32, 0x01, 0xC7, 0xA6, 0xE6, 0xA6, 0x42, 0x32, 0x23, 0x32, 0x23, 0x00, 0xCA, 0x4A, 0x5A, 0x9A,
+0x3F, 0xD2, 0x11, 0x3B, 0x11, 0x6C, 0x95, 0x00, 0x02, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45,
+0x42, 0x02, 0x69, 0x56, 0x55, 0xC2, 0x62, 0x97, 0x09, 0x03, 0x5B, 0x49, 0x55, 0xC5, 0x41, 0x15,
+0x09, 0x41, 0x15, 0x09, 0x05, 0x50, 0xC1, 0x47, 0x00, 0x0E, 0x52, 0x41, 0x40, 0x09, 0x4B, 0x40,
+0x01, 0xC1, 0xB6, 0x24, 0x01, 0xC1, 0xAC, 0x24, 0x01, 0xC1, 0xAC, 0x24, 0x00, 0xC3, 0xAC, 0x24,
+0xAC, 0x24, 0x03, 0xC1, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0E, 0xC7, 0xE8, 0xD1,
+0x43, 0x19, 0x9F, 0x19, 0x9F, 0x19, 0x01, 0xC2, 0x43, 0xE2, 0x07, 0x1B, 0xC2, 0x79, 0x0B, 0x00,
+0x3C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x02, 0x5C, 0x48, 0x44, 0x42, 0x44, 0x40, 0x42, 0x00, 0x45, 0x43, 0x44, 0x52, 0x40, 0x00,
+0x4B, 0x44, 0xC5, 0x51, 0x12, 0x04, 0x08, 0x01, 0x00, 0x02, 0xC6, 0xBD, 0x2D, 0x12, 0x03, 0x04,
+0x47, 0x00, 0x00, 0x42, 0x41, 0xC3, 0x4F, 0x26, 0x02, 0x00, 0x10, 0x41, 0x40, 0x4B, 0x40, 0x00,
+0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52,
+0x40, 0x00, 0x52, 0x40, 0x01, 0x6D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41,
+0x40, 0x0B, 0x4B, 0x01, 0x40, 0x52, 0x4F, 0xCD, 0xA2, 0x1E, 0x02, 0x30, 0x58, 0x3F, 0x04, 0x22,
+0x3F, 0x36, 0x30, 0x58, 0x22, 0x1E, 0x00, 0x67, 0x52, 0x40, 0x0E, 0xC5, 0x4F, 0x7B, 0x09, 0x15,
+0x10, 0x09, 0x00, 0x50, 0x49, 0x50, 0x5A, 0x73, 0xC7, 0xA5, 0xAB, 0x1A, 0x20, 0x10, 0x33, 0x10,
+0x09, 0x00, 0x50, 0x49, 0xC4, 0x97, 0x09, 0x62, 0x1B, 0x02, 0x03, 0x43, 0x4E, 0x44, 0x00, 0x4A,
+0x44, 0x42, 0x41, 0x40, 0x00, 0x7A, 0xC4, 0xC7, 0x5F, 0x11, 0x3B, 0x34, 0x00, 0x7B, 0xC5, 0x4A,
+0xA4, 0xE1, 0x2F, 0xC9, 0x32, 0x00, 0x63, 0x72, 0x51, 0xC2, 0x4A, 0x54, 0x4A, 0x01, 0xC5, 0x64,
+0x4A, 0x84, 0x4A, 0x3E, 0x64, 0x01, 0x4E, 0x7E, 0x00, 0x4E, 0xC0, 0x64, 0x00, 0x4E, 0x00, 0x7E,
+0x01, 0xC4, 0x64, 0x84, 0x0E, 0x64, 0x0E, 0x00, 0xC8, 0x4A, 0x64, 0x4A, 0x0E, 0x4A, 0x0E, 0xA6,
+0x3E, 0x44, 0x00, 0x5C, 0x7E, 0xC9, 0xD2, 0xA7, 0x3B, 0x3E, 0x76, 0x44, 0xC7, 0x6C, 0x63, 0x00,
+0x00, 0x4B, 0x40, 0x45, 0x42, 0x48, 0x4A, 0x42, 0x4A, 0x4E, 0x43, 0x42, 0x02, 0x50, 0x49, 0x01,
+0xCB, 0x97, 0x10, 0x09, 0x41, 0x33, 0x78, 0x20, 0x1A, 0x72, 0x1A, 0x10, 0x1A, 0x00, 0x49, 0x00,
+0x50, 0x49, 0x00, 0x50, 0x49, 0x50, 0xC2, 0x47, 0x12, 0x00, 0x0D, 0x52, 0x41, 0x40, 0x0D, 0xCC,
+0xB6, 0x5E, 0x24, 0x34, 0x9C, 0x83, 0x5E, 0x34, 0x9C, 0x24, 0x34, 0x9C, 0x24, 0x01, 0xC5, 0x5E,
+0x83, 0x24, 0x5E, 0xD4, 0x00, 0x0A, 0x41, 0x40, 0x0E, 0xC2, 0xE8, 0xD1, 0x19, 0x00, 0xC0, 0x5F,
+0x00, 0xC1, 0x43, 0x75, 0x00, 0xC0, 0x43, 0x00, 0xDC, 0xE2, 0x2E, 0x07, 0x0D, 0x45, 0x39, 0x4D,
+0x0D, 0x07, 0x2E, 0x4D, 0x0D, 0x55, 0xB9, 0x38, 0x79, 0x2E, 0x39, 0x4D, 0x07, 0x2E, 0x07, 0x46,
+0x38, 0x45, 0xB9, 0x45, 0x0D, 0x07, 0x00, 0xC1, 0x81, 0x00, 0x12, 0x41, 0x43, 0x00, 0x41, 0x40,
+0x00, 0x42, 0x41, 0x45, 0x48, 0x42, 0x40, 0x08, 0x5C, 0x48, 0x44, 0x71, 0x65, 0x42, 0x40, 0x02,
+0x44, 0x43, 0x40, 0x42, 0x43, 0x41, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x52, 0x4B, 0xD1, 0x70, 0x60, 0x21, 0x02,
+0x8D, 0x01, 0x0A, 0x03, 0x08, 0x05, 0x03, 0x90, 0x12, 0x00, 0x21, 0x51, 0x70, 0x04, 0x01, 0x43,
+0x40, 0x04, 0x5F, 0xCA, 0x51, 0x58, 0x05, 0x00, 0x05, 0x23, 0x02, 0x44, 0x53, 0x26, 0x00, 0x00,
+0x4B, 0x40, 0x0D, 0x41, 0x52, 0x40, 0x18, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x52, 0x5E, 0x62, 0xCB, 0xD9, 0x50, 0x26, 0x22, 0x49, 0x3F, 0x49, 0x26, 0x22,
+0x04, 0x54, 0x1E, 0x00, 0x4F, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0xC5, 0x82, 0x1A,
+0x66, 0x1A, 0xCF, 0x1A, 0x00, 0xC3, 0x6A, 0xE0, 0xA5, 0x09, 0x01, 0x55, 0x49, 0x01, 0x50, 0x42,
+0x03, 0x4A, 0xC1, 0x44, 0x0E, 0x01, 0x4A, 0x42, 0x41, 0x40, 0x00, 0x4F, 0xDB, 0xE3, 0x6C, 0x9B,
+0x44, 0x7C, 0xD4, 0x50, 0x3B, 0x42, 0x2F, 0x11, 0x36, 0x4A, 0x8D, 0x4A, 0x8D, 0x23, 0x0A, 0x5A,
+0x3E, 0x0A, 0x3E, 0x86, 0x04, 0x02, 0x04, 0x03, 0x59, 0x00, 0x43, 0xC5, 0x59, 0x50, 0x0E, 0x53,
+0x05, 0x21, 0x00, 0x7A, 0xCC, 0x86, 0x0E, 0x08, 0x59, 0x6D, 0x08, 0x53, 0x08, 0x53, 0x86, 0x0A,
+0x86, 0x0A, 0x01, 0xCF, 0x64, 0x0E, 0x92, 0x16, 0x29, 0x58, 0x2B, 0x11, 0x3E, 0x7C, 0xE9, 0x6B,
+0x94, 0x52, 0x67, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x44, 0x48, 0x4E, 0x43, 0x42, 0x4E, 0x43, 0x42,
+0x02, 0x5B, 0x49, 0x05, 0x5A, 0xC1, 0x6D, 0x66, 0x00, 0xC2, 0x70, 0xCF, 0x1A, 0x00, 0xC3, 0x66,
+0x7B, 0x1B, 0x09, 0x03, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xC6,
+0xD4, 0x5E, 0x83, 0x9C, 0x52, 0x34, 0x9C, 0x00, 0x74, 0x00, 0xC1, 0x9C, 0x34, 0x00, 0xC7, 0x5B,
+0x24, 0x3B, 0xC2, 0x14, 0x24, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0E, 0xC2, 0xE8,
+0xD1, 0x19, 0x00, 0x6B, 0x6A, 0xC6, 0x9F, 0x5C, 0x2B, 0x43, 0x5F, 0xE2, 0x07, 0x01, 0x79, 0xCE,
+0x55, 0x87, 0x46, 0xC6, 0x4D, 0xC2, 0x55, 0x87, 0x55, 0x87, 0x0D, 0x46, 0x6E, 0x87, 0x45, 0x00,
+0xC7, 0x46, 0xC2, 0x55, 0x87, 0x55, 0x87, 0x4B, 0x07, 0x00, 0xC1, 0x81, 0x00, 0x12, 0x42, 0x44,
+0x43, 0x44, 0x40, 0x42, 0x63, 0x61, 0x48, 0x42, 0x4A, 0x41, 0x40, 0x07, 0x4A, 0x44, 0x4A, 0x42,
+0xCC, 0x53, 0x0A, 0x00, 0x0B, 0x00, 0x02, 0x08, 0x04, 0x03, 0x04, 0x08, 0x02, 0x00, 0x04, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02,
+0x4A, 0xC5, 0x70, 0x3F, 0x02, 0x0A, 0x04, 0x08, 0x01, 0x40, 0x00, 0x52, 0x00, 0x71, 0x4B, 0x65,
+0x48, 0x42, 0x67, 0x48, 0x45, 0x40, 0x04, 0x6D, 0x41, 0x48, 0x42, 0x40, 0x00, 0x44, 0x42, 0x44,
+0x48, 0xC4, 0x74, 0x12, 0x00, 0x0B, 0x00, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0xC3, 0xA2, 0xD9, 0x44, 0x0E, 0x00, 0x66,
+0xC7, 0xD9, 0x4A, 0x04, 0x12, 0x58, 0x3F, 0x1E, 0x0F, 0x00, 0x67, 0x40, 0x52, 0x40, 0x0D, 0xC4,
+0x4F, 0x62, 0x09, 0x10, 0x09, 0x03, 0x50, 0xCA, 0xA5, 0x78, 0x1A, 0x9E, 0x1A, 0xCF, 0x41, 0x72,
+0x20, 0x15, 0x09, 0x00, 0x55, 0x49, 0x01, 0x5B, 0x5C, 0x42, 0x03, 0x4A, 0x43, 0x4A, 0x01, 0x42,
+0x41, 0x40, 0x00, 0x4F, 0xC9, 0xC7, 0x9B, 0x67, 0x6B, 0x31, 0x2D, 0xD4, 0x76, 0x2B, 0x42, 0x00,
+0x76, 0xC3, 0x54, 0x0E, 0x92, 0x0E, 0x00, 0xC2, 0x49, 0x0A, 0x71, 0x01, 0x4A, 0xD1, 0x51, 0x04,
+0x16, 0x02, 0x1C, 0x51, 0x04, 0x16, 0x04, 0x77, 0x23, 0x29, 0x4F, 0x29, 0x21, 0x35, 0x64, 0x29,
+0x00, 0x5C, 0x69, 0x01, 0x42, 0x00, 0x69, 0x42, 0x00, 0x5C, 0x00, 0x69, 0x4A, 0xCD, 0x9E, 0x1C,
+0x02, 0x5A, 0x11, 0x3B, 0x9D, 0x6B, 0xC0, 0x0B, 0xD8, 0xCC, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x00,
+0x4E, 0x43, 0x44, 0x4E, 0x45, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09, 0x04, 0x5B, 0x5A, 0x73, 0xC7,
+0x78, 0x92, 0x66, 0x20, 0x10, 0x66, 0x20, 0x09, 0x00, 0x55, 0x49, 0x01, 0x50, 0xC2, 0x47, 0x12,
+0x00, 0x0E, 0x41, 0x40, 0x0D, 0xC8, 0xB6, 0x24, 0x9C, 0x83, 0x5B, 0x14, 0x5E, 0x34, 0x9C, 0x00,
+0x74, 0xC3, 0x5E, 0x9C, 0x83, 0x5E, 0x00, 0xC4, 0x9C, 0x24, 0x5E, 0xB6, 0x00, 0x0A, 0x41, 0x40,
+0x0E, 0xC7, 0xE8, 0xD1, 0x19, 0x43, 0x5F, 0x75, 0x9F, 0x75, 0x00, 0xC0, 0x43, 0x00, 0xC3, 0xE2,
+0x2E, 0x4B, 0x0D, 0x00, 0xCF, 0x7F, 0x39, 0x0D, 0x4B, 0x79, 0x39, 0x38, 0x87, 0x6E, 0xBB, 0x0D,
+0x79, 0xC3, 0x87, 0x45, 0x79, 0x00, 0x79, 0xCA, 0x45, 0xEC, 0x6E, 0x9C, 0x4B, 0x0D, 0x07, 0x81,
+0x2D, 0x0B, 0x00, 0x11, 0x45, 0x48, 0x41, 0x40, 0x00, 0x44, 0x42, 0x43, 0x44, 0x4E, 0xC1, 0xA2,
+0x00, 0x07, 0x4A, 0x48, 0xCE, 0x49, 0x02, 0x25, 0x03, 0x00, 0x0B, 0x00, 0x02, 0x04, 0x02, 0x03,
+0x00, 0x03, 0x04, 0x00, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xC6, 0x70, 0x04, 0x05, 0x1C, 0x74, 0x0A, 0x03, 0x00, 0x48,
+0x42, 0x43, 0x42, 0x40, 0x00, 0xC7, 0xAA, 0x44, 0x04, 0x08, 0x0A, 0x04, 0x01, 0x00, 0x04, 0x42,
+0x44, 0x01, 0x41, 0x40, 0x44, 0x42, 0x43, 0x5C, 0xC4, 0x5A, 0x01, 0x00, 0x0B, 0x00, 0x0D, 0x41,
+0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x5E,
+0x4F, 0x5E, 0xCA, 0x51, 0x36, 0x26, 0x49, 0x26, 0x60, 0x58, 0x90, 0x49, 0x0F, 0x1E, 0x00, 0x4F,
+0x5E, 0x40, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x05, 0x60, 0x73, 0x5A, 0xC7, 0x78, 0x66, 0x20, 0x66,
+0x15, 0x72, 0x20, 0x09, 0x00, 0x50, 0x49, 0x02, 0x50, 0x42, 0x03, 0x4E, 0x00, 0x42, 0x4E, 0x43,
+0x4E, 0x42, 0x41, 0x40, 0x00, 0x4F, 0x7E, 0x74, 0xCA, 0xB8, 0xAF, 0x12, 0x00, 0xDF, 0x13, 0x34,
+0x11, 0xC9, 0x26, 0x0E, 0x00, 0x63, 0xC3, 0xEB, 0xB5, 0x77, 0xC4, 0x00, 0xC9, 0xB5, 0xCA, 0x64,
+0x04, 0x98, 0x0E, 0x0A, 0x51, 0x29, 0x8A, 0x01, 0xC2, 0x51, 0x6D, 0x29, 0x02, 0xC8, 0x6D, 0x04,
+0x29, 0x16, 0x29, 0x16, 0x29, 0x8A, 0x16, 0x00, 0x69, 0xC7, 0x8A, 0x29, 0x16, 0x02, 0x21, 0x92,
+0x0E, 0x4F, 0x00, 0x7E, 0x51, 0xC3, 0x64, 0xB8, 0xAF, 0x00, 0x00, 0xC3, 0x7C, 0x56, 0x65, 0x00,
+0x02, 0x45, 0x44, 0xC1, 0x53, 0x08, 0x00, 0x4A, 0x43, 0x42, 0x03, 0x5B, 0x49, 0xC1, 0x97, 0x09,
+0x00, 0xC1, 0x97, 0x09, 0x00, 0xC0, 0x78, 0x00, 0x50, 0xC7, 0x66, 0x20, 0x72, 0xAB, 0x99, 0x1A,
+0x33, 0x09, 0x04, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xC5, 0xB6,
+0x24, 0x83, 0x9C, 0x83, 0x9C, 0x00, 0x74, 0xC0, 0x9C, 0x00, 0x74, 0xC3, 0x9C, 0x34, 0x83, 0x5E,
+0x00, 0xC1, 0x9C, 0x24, 0x00, 0xC1, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0E, 0xC2,
+0xE8, 0xD1, 0x19, 0x00, 0xC5, 0x5F, 0x75, 0x19, 0x2A, 0xBC, 0x19, 0x00, 0xC7, 0xE2, 0x07, 0x2E,
+0x81, 0x6E, 0x87, 0x55, 0x4B, 0x00, 0x47, 0xD1, 0xB9, 0xC3, 0x6E, 0x87, 0xB9, 0x0D, 0x46, 0x55,
+0x61, 0x46, 0x4B, 0x07, 0x39, 0x45, 0x7F, 0x87, 0xBB, 0x0D, 0x00, 0x47, 0xC1, 0x81, 0x00, 0x12,
+0x45, 0x4E, 0x42, 0x41, 0x00, 0x40, 0xC1, 0x44, 0x02, 0x00, 0x4A, 0x48, 0x41, 0x40, 0x07, 0x4A,
+0x42, 0xCE, 0x74, 0x04, 0x25, 0x08, 0x00, 0x0B, 0x00, 0x05, 0x08, 0x03, 0x04, 0x03, 0x02, 0x03,
+0x00, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x01, 0x4B, 0x5C, 0xD4, 0x96, 0x36, 0x02, 0x05, 0x28, 0x05, 0x1F, 0x25, 0x03, 0x02,
+0x01, 0x1F, 0x0F, 0x01, 0x02, 0x04, 0x1F, 0x04, 0x03, 0x05, 0x00, 0x05, 0x42, 0x44, 0x41, 0x45,
+0x40, 0x45, 0x41, 0x00, 0x43, 0x42, 0x40, 0x10, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x00, 0xCF, 0x40, 0x21, 0x17, 0x01, 0x36,
+0x37, 0x0F, 0x3F, 0x28, 0x90, 0x0F, 0x1E, 0x0F, 0x1E, 0x01, 0x00, 0x0F, 0xC4, 0x4F, 0x62, 0x09,
+0x10, 0x09, 0x04, 0x73, 0x60, 0xC1, 0xA5, 0x1A, 0x00, 0x50, 0x5B, 0x60, 0x50, 0x49, 0x01, 0x55,
+0x49, 0x00, 0xC2, 0x62, 0x1B, 0x02, 0x03, 0x48, 0x00, 0x43, 0x44, 0x4A, 0x44, 0x42, 0x40, 0x01,
+0x65, 0xD2, 0xC7, 0x84, 0x7A, 0x6B, 0x0B, 0x47, 0x7A, 0x4C, 0x34, 0x2F, 0x3B, 0x26, 0x54, 0x0C,
+0x8D, 0x6D, 0x53, 0x6D, 0x50, 0x00, 0xC1, 0x44, 0x9E, 0x00, 0x69, 0x75, 0xC0, 0x73, 0x00, 0xC2,
+0x68, 0x8A, 0x29, 0x00, 0xC5, 0x8A, 0x29, 0x8A, 0x29, 0x16, 0x29, 0x02, 0xC6, 0x8A, 0x16, 0x29,
+0x16, 0x8A, 0x16, 0x8A, 0x00, 0x56, 0x69, 0x00, 0xC1, 0x8A, 0x29, 0x00, 0x4E, 0xCD, 0xC4, 0x02,
+0x21, 0x5A, 0x11, 0x3B, 0x65, 0x6B, 0x25, 0x01, 0x65, 0x56, 0x9D, 0x00, 0x02, 0x45, 0x42, 0x43,
+0x48, 0x42, 0x44, 0x42, 0x04, 0x5B, 0xC1, 0x7B, 0x09, 0x04, 0x73, 0x5A, 0xC5, 0x99, 0x20, 0x1A,
+0x33, 0x10, 0x33, 0x00, 0xC1, 0x41, 0x09, 0x04, 0x50, 0xC2, 0x47, 0x12, 0x00, 0x0E, 0x41, 0x40,
+0x0D, 0xC1, 0xB6, 0x24, 0x00, 0xC9, 0x83, 0x9C, 0x5E, 0xD0, 0x34, 0x83, 0x5E, 0x83, 0x34, 0x24,
+0x02, 0xC4, 0x83, 0x24, 0x5E, 0xB6, 0x00, 0x0A, 0x41, 0x40, 0x0E, 0xC2, 0xE8, 0xD1, 0x19, 0x00,
+0xDF, 0x43, 0x5F, 0x19, 0x5F, 0x43, 0x19, 0x43, 0xE2, 0x2E, 0xBA, 0x0D, 0x46, 0x39, 0x4D, 0x38,
+0x4B, 0x0D, 0x55, 0xBA, 0x46, 0x6E, 0x38, 0x4D, 0x38, 0x6E, 0x46, 0x4B, 0x45, 0x0D, 0x45, 0x38,
+0x45, 0xC7, 0x6E, 0x45, 0x07, 0xBA, 0x07, 0x81, 0x12, 0x00, 0x11, 0x45, 0x43, 0x44, 0x42, 0x5F,
+0x40, 0x45, 0x41, 0x45, 0x44, 0x5F, 0x40, 0x08, 0x42, 0x43, 0x44, 0x40, 0x41, 0x45, 0x41, 0x65,
+0x45, 0x41, 0x42, 0x44, 0x41, 0x42, 0x44, 0x41, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xC1, 0xC0, 0x00, 0x00, 0x4B,
+0x40, 0x00, 0x4B, 0x01, 0x40, 0x00, 0x42, 0x43, 0x48, 0x42, 0x40, 0x27, 0x41, 0x40, 0x19, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x5E, 0x52, 0xC8, 0x40, 0x47,
+0xD9, 0x27, 0x0F, 0xD9, 0x1E, 0x27, 0x1E, 0x04, 0x67, 0x40, 0x0F, 0xC3, 0x4F, 0x09, 0x15, 0x09,
+0x05, 0x50, 0xC2, 0x41, 0x09, 0x1B, 0x00, 0x55, 0x49, 0x55, 0x5B, 0x49, 0x55, 0x49, 0x55, 0x49,
+0x01, 0x50, 0x69, 0x42, 0x03, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x41, 0x40, 0x00, 0x4F, 0xC9,
+0xC7, 0x9B, 0x50, 0x7C, 0x6B, 0x94, 0x65, 0x52, 0x11, 0x42, 0x00, 0x4E, 0xC5, 0x49, 0x0C, 0x92,
+0x4F, 0x29, 0x8A, 0x00, 0x69, 0x00, 0xC0, 0x51, 0x00, 0x42, 0x75, 0xC4, 0x68, 0xE6, 0x68, 0x1C,
+0x29, 0x00, 0x56, 0x42, 0xC4, 0x8A, 0x29, 0x8A, 0x29, 0x1C, 0x01, 0x69, 0xC5, 0x8A, 0x29, 0x8A,
+0x29, 0x16, 0x1C, 0x00, 0xCB, 0x8A, 0x1C, 0x8A, 0x29, 0x8A, 0x29, 0x0E, 0x68, 0x0A, 0x50, 0x84,
+0x11, 0x00, 0xC7, 0x53, 0x7C, 0x6B, 0x7C, 0x94, 0x5E, 0x44, 0x00, 0x02, 0x45, 0x42, 0x00, 0x68,
+0x42, 0x06, 0x5B, 0x49, 0x05, 0x5B, 0x00, 0x55, 0xC1, 0x41, 0x1B, 0x00, 0x49, 0x5B, 0xC6, 0x41,
+0x15, 0x09, 0x15, 0x09, 0x15, 0x09, 0x00, 0x5B, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0xC1,
+0xB6, 0x24, 0x01, 0x54, 0x64, 0x01, 0xC1, 0x5B, 0x24, 0x02, 0xC1, 0xAC, 0x24, 0x03, 0xC1, 0xE7,
+0x00, 0x0A, 0x41, 0x40, 0x0E, 0xC3, 0xD9, 0xD1, 0x43, 0x19, 0x01, 0xC3, 0x9F, 0x19, 0x43, 0x19,
+0x00, 0xC1, 0xE2, 0x07, 0x02, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x00, 0x47, 0x03, 0x4D, 0x01,
+0x47, 0x00, 0x4D, 0x00, 0x47, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0xC1, 0x81, 0x00, 0x27, 0x4B, 0x40,
+0x01, 0x4B, 0x40, 0x42, 0x43, 0x00, 0x42, 0x40, 0x0A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x42, 0x45, 0x08, 0x42, 0x45, 0x0D, 0x42, 0x45, 0x01, 0x61, 0x69, 0x45, 0x00, 0x61, 0xC3,
+0xAA, 0x05, 0x21, 0x05, 0x04, 0x5F, 0x45, 0x09, 0x5F, 0x4F, 0x45, 0x61, 0x45, 0x19, 0x42, 0x45,
+0x19, 0x42, 0x45, 0x07, 0x42, 0x45, 0x0F, 0x42, 0x45, 0x0A, 0x42, 0x45, 0x0F, 0x62, 0x42, 0x7F,
+0x00, 0x42, 0x68, 0x42, 0xCB, 0x90, 0x28, 0x90, 0x02, 0x90, 0x02, 0x28, 0x3F, 0x90, 0x28, 0x02,
+0x05, 0x0F, 0x56, 0xC1, 0x82, 0x20, 0x07, 0xC1, 0x82, 0x20, 0x0B, 0xC5, 0x82, 0x20, 0x44, 0x36,
+0x03, 0x04, 0x02, 0x43, 0x44, 0x02, 0x42, 0x45, 0x01, 0xC4, 0xB0, 0x11, 0x34, 0x44, 0x65, 0x00,
+0xCD, 0x59, 0x32, 0x11, 0xDB, 0x3E, 0x23, 0x8D, 0x35, 0x0E, 0x29, 0x1C, 0x8A, 0x02, 0x29, 0x01,
+0x42, 0x00, 0x75, 0xC0, 0x73, 0x00, 0xCB, 0xA6, 0x8A, 0x02, 0x1C, 0x29, 0x1C, 0x29, 0x8A, 0x29,
+0x02, 0x8A, 0x02, 0x00, 0xC8, 0x8A, 0x02, 0x16, 0x29, 0x16, 0x8A, 0x1C, 0x16, 0x1C, 0x02, 0xD0,
+0x8A, 0x29, 0x92, 0x9E, 0x0E, 0x92, 0x4A, 0x2F, 0x11, 0x3B, 0x71, 0x50, 0x44, 0x71, 0x6C, 0x63,
+0x05, 0x00, 0x61, 0x45, 0x42, 0x44, 0xC4, 0x44, 0x04, 0x44, 0x03, 0x04, 0x00, 0x43, 0x44, 0x76,
+0x44, 0x60, 0x07, 0xC1, 0x82, 0x20, 0x02, 0xC1, 0xA5, 0x20, 0x06, 0xC3, 0x82, 0x20, 0x29, 0x05,
+0x0F, 0x42, 0x45, 0x0D, 0xC1, 0x67, 0x83, 0x00, 0xC5, 0x5E, 0xC7, 0x5E, 0x83, 0x5E, 0x83, 0x00,
+0xC0, 0x5E, 0x00, 0xC3, 0x83, 0x5E, 0x83, 0x5E, 0x00, 0xC0, 0x83, 0x00, 0xC1, 0x44, 0x05, 0x0A,
+0x42, 0x45, 0x0E, 0xC4, 0xBD, 0x6C, 0x5F, 0x43, 0x5F, 0x01, 0xD4, 0x43, 0xBC, 0x43, 0x5F, 0xEC,
+0x38, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xC3, 0x55,
+0x01, 0xCC, 0xC3, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xB1, 0x55, 0x45, 0x55, 0x05, 0x17,
+0x42, 0x45, 0x61, 0x45, 0x12, 0x65, 0x45, 0x0C, 0x42, 0x45, 0x07, 0x42, 0x45, 0x0B, 0x40, 0x48,
+0x44, 0x43, 0x08, 0x44, 0x43, 0x11, 0x76, 0x43, 0x01, 0xC1, 0x63, 0x03, 0x04, 0xC4, 0x51, 0x63,
+0x03, 0x04, 0x03, 0x06, 0xC7, 0x51, 0x63, 0x3B, 0x2B, 0x32, 0x53, 0x04, 0x03, 0x36, 0x44, 0x43,
+0x06, 0x44, 0x43, 0x10, 0x44, 0x43, 0x09, 0x44, 0x43, 0x0A, 0xC7, 0x51, 0x03, 0x36, 0x03, 0x60,
+0x26, 0x30, 0x26, 0x00, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66, 0x70, 0x66,
+0x43, 0x76, 0x43, 0x76, 0x43, 0x0A, 0xC0, 0x63, 0x00, 0xC1, 0x6D, 0x1A, 0x14, 0x73, 0x5A, 0x00,
+0xC1, 0x70, 0x0A, 0x0A, 0xCB, 0x51, 0x63, 0x51, 0x21, 0xB0, 0x8F, 0x5C, 0x11, 0x64, 0x2F, 0x11,
+0x2F, 0x00, 0x72, 0x7F, 0xDF, 0x58, 0x92, 0x8D, 0x6D, 0x02, 0x29, 0x16, 0x1C, 0x29, 0x1C, 0x02,
+0x21, 0x9D, 0xB5, 0x06, 0x73, 0x9E, 0x8A, 0x29, 0x1C, 0x29, 0x8A, 0x02, 0x16, 0x8A, 0x1C, 0x29,
+0x1C, 0x29, 0x16, 0x29, 0x8A, 0x56, 0x69, 0x56, 0x00, 0x42, 0xC4, 0x8A, 0x16, 0x29, 0x1C, 0x02,
+0x00, 0x4A, 0x4E, 0x01, 0xC2, 0x4A, 0x11, 0x2F, 0x00, 0x51, 0xC2, 0x4A, 0x11, 0x6C, 0x00, 0xC2,
+0xB0, 0x96, 0x03, 0x00, 0x44, 0x48, 0x4A, 0x08, 0xC5, 0x86, 0x70, 0x33, 0x1A, 0x33, 0x1A, 0x08,
+0xC1, 0x92, 0x1A, 0x08, 0xC1, 0x51, 0x03, 0x00, 0xC1, 0x63, 0x03, 0x0D, 0x44, 0x43, 0x06, 0xC3,
+0x51, 0x03, 0x51, 0x03, 0x00, 0x76, 0xC2, 0x71, 0x9C, 0x34, 0x00, 0xC1, 0x9C, 0x34, 0x0C, 0xC5,
+0x86, 0x44, 0x60, 0x03, 0x51, 0x03, 0x04, 0xC1, 0x51, 0x03, 0x0F, 0xC9, 0x51, 0x63, 0x6C, 0x11,
+0x75, 0x11, 0x75, 0x2A, 0x75, 0x2A, 0x00, 0xC5, 0xBC, 0xA0, 0x4D, 0x39, 0x6E, 0x39, 0x03, 0xC4,
+0x6E, 0x39, 0x6E, 0x4D, 0x39, 0x00, 0xC4, 0x6E, 0x4D, 0x39, 0x4D, 0x39, 0x00, 0xC3, 0x6E, 0x39,
+0x6E, 0x39, 0x00, 0xC6, 0x6E, 0x39, 0x6E, 0x39, 0x4E, 0x96, 0x03, 0x16, 0x44, 0x43, 0x15, 0x44,
+0x43, 0x0C, 0x44, 0x43, 0x04, 0x44, 0x43, 0x0C, 0x42, 0x41, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x1A, 0x52, 0xC3, 0x6C, 0x2B, 0xCE, 0x00, 0x1A, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x67, 0x52, 0x67, 0x5E, 0x52, 0x67, 0x5E,
+0x67, 0x5E, 0x67, 0xC7, 0xD9, 0x27, 0xD9, 0x27, 0x1E, 0x27, 0x12, 0x00, 0x0F, 0xC2, 0x4F, 0x15,
+0x1B, 0x00, 0x55, 0x0A, 0x5B, 0x49, 0x5B, 0x49, 0x5B, 0x55, 0x5B, 0x49, 0xC6, 0x41, 0x09, 0x1B,
+0x29, 0x02, 0x05, 0x02, 0x05, 0x68, 0x45, 0x40, 0x01, 0x41, 0xC1, 0xB0, 0xBC, 0x00, 0x51, 0xC0,
+0x5C, 0x00, 0x6F, 0x51, 0x01, 0x44, 0xC4, 0x49, 0x16, 0x6D, 0x29, 0x1C, 0x00, 0xCB, 0x8A, 0x02,
+0x16, 0x29, 0x8A, 0x02, 0x44, 0xCA, 0x0C, 0x64, 0x0C, 0x1C, 0x00, 0x56, 0x69, 0x5C, 0x69, 0x5C,
+0x69, 0x56, 0x69, 0x5C, 0x69, 0xC2, 0x8A, 0x16, 0x29, 0x00, 0x56, 0xC7, 0x8A, 0x02, 0x8A, 0x16,
+0x02, 0x8A, 0x16, 0x02, 0x00, 0xC8, 0x92, 0x23, 0x0E, 0x8D, 0x0E, 0x3E, 0x5C, 0x8F, 0x2F, 0x01,
+0xC0, 0x6C, 0x00, 0xC1, 0x95, 0x00, 0x02, 0x45, 0x68, 0x42, 0x00, 0x68, 0x42, 0x01, 0x45, 0x42,
+0x01, 0x5B, 0x49, 0xCC, 0x41, 0x09, 0x41, 0x15, 0x41, 0x1B, 0x15, 0x1B, 0x15, 0x1B, 0x15, 0x1B,
+0x15, 0x00, 0x5B, 0x55, 0x49, 0x5B, 0x49, 0x55, 0x49, 0x00, 0x5B, 0xC1, 0x47, 0x00, 0x0F, 0x41,
+0x40, 0x0D, 0xC1, 0xD4, 0x24, 0x0D, 0x54, 0x64, 0x00, 0xC1, 0xE7, 0x00, 0x0A, 0x41, 0x40, 0x0E,
+0x6D, 0xC1, 0xD1, 0x19, 0x00, 0xC5, 0x43, 0x19, 0x9F, 0x19, 0x9F, 0x19, 0x00, 0xC2, 0xE2, 0x0D,
+0x07, 0x01, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x6E, 0x4D, 0x01, 0xC1, 0x79, 0x0D, 0x01,
+0x47, 0x4D, 0x47, 0x4D, 0x47, 0x02, 0x4D, 0x47, 0xC2, 0x81, 0xC0, 0x00, 0x3C, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x71, 0x6D,
+0xC4, 0x6C, 0x14, 0x2D, 0x31, 0x00, 0x19, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E,
+0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x62, 0x5E, 0x4F, 0x5E, 0x52, 0x4F, 0x5E,
+0x4F, 0x5E, 0x00, 0x4F, 0x67, 0x5E, 0x00, 0x4F, 0x41, 0x40, 0x0C, 0x71, 0x40, 0x00, 0xC2, 0x4F,
+0x62, 0x09, 0x0D, 0x5B, 0x49, 0x02, 0xC1, 0x62, 0x09, 0x01, 0x5B, 0x69, 0x42, 0x02, 0x45, 0x00,
+0x61, 0x68, 0x61, 0x42, 0x00, 0x41, 0x40, 0x00, 0x5F, 0xC2, 0xD2, 0xBC, 0x5C, 0x00, 0x51, 0x01,
+0xC8, 0x8F, 0x11, 0x4A, 0x3F, 0x28, 0x92, 0xB5, 0x70, 0x29, 0x00, 0x56, 0x5C, 0xCA, 0x8A, 0x02,
+0x8A, 0x02, 0x9D, 0x0C, 0x9E, 0x64, 0x9E, 0x16, 0x29, 0x00, 0x5C, 0x56, 0x00, 0x5C, 0x69, 0x5C,
+0x69, 0x56, 0x69, 0x56, 0x69, 0xC3, 0x8A, 0x16, 0x8A, 0x16, 0x01, 0x5C, 0x56, 0x42, 0xC5, 0x8A,
+0x1C, 0x29, 0x0E, 0x77, 0x23, 0x00, 0x44, 0x76, 0xC1, 0x5C, 0x2F, 0x00, 0x7B, 0x00, 0x6F, 0xC2,
+0x6C, 0x89, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42, 0x45, 0x42, 0x00, 0x61, 0x45, 0x42, 0x03, 0x5B,
+0xC1, 0x62, 0x09, 0x05, 0xC4, 0x41, 0x09, 0x62, 0x41, 0x09, 0x09, 0x50, 0xC1, 0x47, 0x00, 0x0F,
+0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xC1, 0xB6, 0x24, 0x00, 0xC5, 0xAC, 0x24, 0xAC, 0x24, 0xEE,
+0x24, 0x05, 0xC1, 0xAC, 0x24, 0x01, 0xC1, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0E,
+0xC2, 0xE8, 0xD1, 0x19, 0x00, 0xC1, 0x43, 0x19, 0x04, 0xC3, 0xE2, 0x07, 0x2E, 0x07, 0x00, 0x4D,
+0x47, 0x05, 0x4D, 0x47, 0x02, 0x4D, 0x47, 0x05, 0x4D, 0x47, 0x00, 0x6E, 0xC2, 0x81, 0x0B, 0x00,
+0x3C, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x02, 0x44, 0x48, 0x43, 0x42, 0x43, 0x40, 0x44, 0x42, 0x00, 0x48, 0x43, 0x41, 0x40,
+0x67, 0x4B, 0x43, 0xC4, 0x50, 0x01, 0x05, 0x04, 0x00, 0x01, 0x67, 0x52, 0x61, 0x52, 0x00, 0x4B,
+0x44, 0x41, 0x40, 0x42, 0x48, 0x42, 0x40, 0x44, 0x42, 0x40, 0x10, 0x41, 0x40, 0x19, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x5E, 0x00, 0x62, 0x70,
+0xCC, 0x5A, 0x30, 0x36, 0x90, 0x04, 0x36, 0x30, 0x5A, 0x22, 0x1E, 0x0F, 0x27, 0x00, 0x0F, 0xC2,
+0x4F, 0x62, 0x09, 0x00, 0x50, 0x49, 0x00, 0x50, 0x49, 0x50, 0xC9, 0x72, 0x1A, 0x41, 0x33, 0x1A,
+0x41, 0x10, 0x1A, 0x10, 0x09, 0x01, 0x55, 0x49, 0x01, 0x50, 0x56, 0x42, 0x02, 0x43, 0x4E, 0x43,
+0x00, 0x4E, 0x43, 0x45, 0x41, 0x40, 0x00, 0x4F, 0xD7, 0xB0, 0xBC, 0x11, 0x64, 0x86, 0x71, 0x64,
+0x32, 0x5C, 0xDB, 0x4A, 0x9E, 0x68, 0x06, 0x70, 0x02, 0x1C, 0x29, 0x1C, 0x16, 0x02, 0x8A, 0x1C,
+0x8A, 0x00, 0xD2, 0x44, 0x51, 0x1C, 0x02, 0x16, 0x1C, 0x16, 0x29, 0x02, 0x29, 0x16, 0x1C, 0x16,
+0x29, 0x1C, 0x29, 0x16, 0x29, 0x16, 0x00, 0x69, 0x56, 0x5C, 0x56, 0x69, 0x5C, 0x56, 0xD0, 0x8A,
+0x29, 0x6D, 0x64, 0x9E, 0x0E, 0x96, 0x58, 0x2F, 0x4A, 0x52, 0x65, 0xD4, 0xCE, 0x9B, 0x63, 0x00,
+0x02, 0x45, 0x42, 0xC6, 0x53, 0x0A, 0x02, 0x03, 0x0E, 0x04, 0x02, 0x01, 0x69, 0x5B, 0x49, 0x04,
+0x55, 0x73, 0xC9, 0x78, 0x20, 0x41, 0x78, 0xA5, 0x10, 0xAB, 0x1A, 0x10, 0x09, 0x00, 0x50, 0x49,
+0x01, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0xC3, 0xB6, 0x24, 0x14, 0x9C, 0x00, 0xC2,
+0x83, 0x5E, 0x9C, 0x00, 0xC1, 0xD0, 0x9C, 0x00, 0x64, 0xC7, 0x5E, 0x24, 0x9B, 0x9C, 0x5E, 0x24,
+0xD4, 0x00, 0x0A, 0x41, 0x40, 0x0E, 0xC7, 0xE8, 0xD1, 0x19, 0x9F, 0xBC, 0x5F, 0x43, 0x75, 0x00,
+0x59, 0xD2, 0x43, 0xE2, 0x0D, 0xCB, 0x0D, 0x46, 0xBB, 0x4D, 0x38, 0x0D, 0xC3, 0x4D, 0xCB, 0x7F,
+0xB9, 0x45, 0x0D, 0x4B, 0x39, 0x00, 0xC0, 0xCB, 0x00, 0x78, 0xC5, 0x4D, 0xC3, 0x55, 0xB9, 0x46,
+0x0D, 0x00, 0x47, 0xC2, 0x81, 0x12, 0x00, 0x11, 0x41, 0x48, 0x00, 0x41, 0x40, 0x41, 0x44, 0x45,
+0x00, 0x48, 0x42, 0x40, 0x08, 0x44, 0x48, 0x43, 0x41, 0x45, 0x44, 0x40, 0x02, 0x44, 0x48, 0x41,
+0x43, 0x48, 0x45, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x4A, 0x43, 0x42, 0x00, 0x4E, 0x41, 0x4A, 0x48, 0x00, 0x41,
+0x44, 0xC1, 0xAA, 0x00, 0x00, 0x61, 0xC5, 0x44, 0x53, 0x02, 0x03, 0x0E, 0x00, 0x02, 0x67, 0x40,
+0x71, 0x40, 0x42, 0x63, 0x41, 0x40, 0x42, 0x44, 0x48, 0x45, 0x4E, 0x44, 0x40, 0x10, 0x41, 0x40,
+0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x62,
+0x4F, 0x00, 0xC9, 0x90, 0x0E, 0x22, 0x3F, 0x5A, 0x60, 0x0F, 0x04, 0x5A, 0x1E, 0x00, 0x4F, 0x5E,
+0x40, 0x0E, 0x52, 0xC2, 0x4F, 0x62, 0x09, 0x01, 0x50, 0x49, 0x00, 0xCC, 0x41, 0x20, 0x1A, 0x66,
+0x10, 0xAB, 0x9E, 0x10, 0x33, 0xE0, 0x20, 0x15, 0x09, 0x04, 0x5B, 0x69, 0x42, 0x02, 0x48, 0x44,
+0x4E, 0x00, 0x44, 0x4E, 0x42, 0xD0, 0x47, 0x12, 0x00, 0x25, 0xC7, 0x11, 0x71, 0xB6, 0xB7, 0x7C,
+0x4C, 0x34, 0x2B, 0x32, 0x0E, 0x49, 0x70, 0x00, 0x56, 0x69, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x69,
+0x5C, 0x56, 0xCD, 0x8A, 0x1C, 0x16, 0x8A, 0x16, 0x1C, 0x16, 0x1C, 0x8A, 0x16, 0x1C, 0x29, 0x16,
+0x1C, 0x00, 0x56, 0xC5, 0x8A, 0x16, 0x8A, 0x16, 0x8A, 0x16, 0x00, 0x5C, 0x56, 0x69, 0x56, 0x5C,
+0x00, 0xC3, 0xB8, 0x1C, 0x29, 0x16, 0x00, 0x44, 0xC3, 0x49, 0x3B, 0x52, 0x6B, 0x01, 0xC3, 0xB7,
+0x76, 0x44, 0x00, 0x02, 0x45, 0x44, 0x48, 0x4E, 0x4A, 0x4E, 0x43, 0x44, 0x42, 0x02, 0x50, 0x49,
+0xC1, 0x97, 0x09, 0x02, 0xCB, 0x41, 0x1A, 0x20, 0x66, 0x10, 0xC4, 0x1A, 0x82, 0x33, 0x66, 0x20,
+0x09, 0x02, 0x50, 0x49, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xC5,
+0xB6, 0x5E, 0x83, 0x9C, 0x24, 0x9C, 0x01, 0x74, 0x00, 0xC1, 0x9C, 0x34, 0x00, 0xC7, 0xEE, 0x5E,
+0x83, 0x34, 0x9C, 0x24, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0E, 0x6D, 0xC8, 0xD1,
+0x19, 0x43, 0x2B, 0x5C, 0x75, 0x11, 0xBC, 0x43, 0x00, 0xC1, 0xE2, 0x0D, 0x01, 0xD7, 0x4D, 0xED,
+0x87, 0x46, 0x38, 0x39, 0xC2, 0x38, 0x87, 0x61, 0x4D, 0x0D, 0x45, 0x7F, 0x87, 0x55, 0x38, 0x4D,
+0xC2, 0x45, 0xB9, 0x6F, 0x39, 0x0D, 0x00, 0x6E, 0xC2, 0x79, 0x0B, 0x00, 0x11, 0x42, 0x00, 0x43,
+0x44, 0x40, 0x42, 0x4E, 0x45, 0x43, 0x48, 0x43, 0x40, 0x08, 0x4A, 0x43, 0x4A, 0x42, 0x4A, 0x00,
+0x40, 0x01, 0x42, 0x48, 0x44, 0x43, 0x42, 0x00, 0x43, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x4A, 0x43, 0x42, 0x00,
+0x4A, 0x44, 0x48, 0x00, 0x43, 0x40, 0x00, 0x67, 0x40, 0x00, 0x4B, 0x41, 0x48, 0x42, 0x41, 0x43,
+0x40, 0x01, 0x52, 0x4B, 0x00, 0x40, 0x61, 0xCA, 0x51, 0x0A, 0x05, 0x00, 0x01, 0x02, 0x08, 0x01,
+0x02, 0x04, 0x00, 0x10, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x4B, 0x40, 0x0D, 0x41, 0xC1,
+0x47, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0xC2, 0xA2, 0x0F, 0x1E, 0x00, 0x62, 0xC8, 0x5A, 0x0F,
+0x1E, 0x8D, 0x36, 0x12, 0x49, 0x3F, 0x1E, 0x00, 0x4F, 0x67, 0x40, 0x0D, 0x52, 0x40, 0xC2, 0x4F,
+0x7B, 0x09, 0x01, 0xC1, 0x97, 0x09, 0x02, 0x50, 0xC8, 0x92, 0x1A, 0x66, 0x9E, 0x1A, 0x1B, 0x1A,
+0x20, 0x09, 0x00, 0x55, 0x49, 0x50, 0x49, 0x00, 0x50, 0x42, 0x04, 0x4A, 0x43, 0x4E, 0x48, 0x63,
+0x42, 0x41, 0x40, 0x00, 0x7A, 0xD1, 0xC7, 0x9B, 0x9D, 0xD3, 0x2D, 0xC0, 0x7C, 0x76, 0x11, 0x32,
+0x63, 0x08, 0x6D, 0x16, 0x02, 0x16, 0x1C, 0x16, 0x00, 0x69, 0x56, 0x5C, 0x56, 0xC1, 0x8A, 0x16,
+0x00, 0x5C, 0x56, 0x02, 0x42, 0x56, 0x42, 0x56, 0x00, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x00, 0xC1,
+0x8A, 0x16, 0x00, 0x5C, 0xC5, 0x8A, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x04, 0x69, 0x00, 0xC9, 0x58,
+0x3B, 0xD4, 0x6B, 0x0B, 0xD3, 0x6B, 0x4C, 0x1C, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42, 0x00, 0x4A,
+0x4E, 0x00, 0x4A, 0x43, 0x42, 0x02, 0xC1, 0x8C, 0x09, 0x01, 0x50, 0x49, 0x01, 0x55, 0xC5, 0x72,
+0x20, 0xAB, 0x66, 0x9E, 0x10, 0x00, 0xC2, 0xCF, 0x82, 0x09, 0x00, 0x50, 0x49, 0x01, 0x50, 0xC3,
+0x47, 0x00, 0x12, 0x00, 0x0C, 0x6D, 0x41, 0x40, 0x0B, 0x52, 0x40, 0xD4, 0xB6, 0x24, 0x9C, 0x83,
+0x5B, 0x14, 0x5E, 0x34, 0x3B, 0x9C, 0x83, 0x52, 0x9C, 0x83, 0x5E, 0x14, 0x9C, 0x5E, 0x24, 0xB6,
+0x00, 0x0A, 0x41, 0x40, 0x0E, 0xC2, 0xE8, 0xD1, 0x19, 0x00, 0xDB, 0x6C, 0x75, 0x2A, 0x11, 0x2B,
+0x43, 0x19, 0xE2, 0x07, 0x2E, 0x07, 0x81, 0x7F, 0x4D, 0x0D, 0x79, 0x0D, 0x39, 0xC6, 0xB9, 0xA0,
+0x39, 0x0D, 0x79, 0xB1, 0x87, 0x45, 0x0D, 0x00, 0xC5, 0x6E, 0x45, 0x39, 0xA0, 0x39, 0x0D, 0x00,
+0x6E, 0xC1, 0x81, 0x00, 0x13, 0x45, 0x43, 0x41, 0x40, 0x00, 0x44, 0x42, 0x44, 0x43, 0x48, 0x41,
+0x40, 0x07, 0x4A, 0x43, 0x4A, 0x42, 0x41, 0x43, 0x40, 0x01, 0x42, 0x44, 0x42, 0x43, 0x41, 0x43,
+0x45, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x02, 0x4A, 0x44, 0x45, 0x44, 0x43, 0x4A, 0x43, 0x00, 0x48, 0x44, 0x48, 0x42,
+0x40, 0x00, 0x45, 0x43, 0x00, 0x44, 0x41, 0x48, 0x40, 0x05, 0x61, 0x48, 0x63, 0x42, 0x41, 0x43,
+0x42, 0x48, 0x40, 0x44, 0x42, 0x40, 0x10, 0x41, 0x40, 0x19, 0x41, 0x52, 0x40, 0x02, 0x52, 0x00,
+0x40, 0x52, 0x65, 0x6D, 0x40, 0x0E, 0x41, 0x4B, 0x40, 0x09, 0x41, 0x40, 0x10, 0x65, 0x5E, 0x01,
+0x62, 0xC8, 0x5A, 0x0F, 0x26, 0x36, 0x58, 0x90, 0x5A, 0x0F, 0x1E, 0x00, 0x4F, 0x67, 0x52, 0x40,
+0x0E, 0xC2, 0x4F, 0x10, 0x97, 0x00, 0x49, 0x03, 0x60, 0x5A, 0x00, 0xCA, 0x66, 0x1A, 0x20, 0x66,
+0x09, 0xAB, 0x20, 0x15, 0x09, 0x10, 0x09, 0x00, 0xC4, 0x97, 0x09, 0x1B, 0x1C, 0x02, 0x02, 0x4E,
+0x00, 0x44, 0x48, 0x4E, 0x4A, 0x42, 0x41, 0x40, 0x00, 0x65, 0x7E, 0x74, 0xC9, 0x7A, 0xAF, 0x12,
+0x00, 0x6B, 0x56, 0x3B, 0x32, 0x50, 0x6D, 0x00, 0xC2, 0x51, 0x44, 0x16, 0x01, 0x5C, 0x56, 0x5C,
+0x69, 0x56, 0xD6, 0x8A, 0x02, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16,
+0x1C, 0x16, 0x8A, 0x16, 0x02, 0x16, 0x1C, 0x16, 0x02, 0x16, 0x00, 0x42, 0x56, 0x5C, 0x56, 0x5C,
+0x69, 0xC1, 0x8C, 0x16, 0x01, 0xC6, 0x8A, 0x1F, 0x59, 0x9B, 0xD4, 0x6B, 0x2D, 0x00, 0xCB, 0x94,
+0xCC, 0x8A, 0x00, 0x2D, 0x0B, 0x00, 0x05, 0x04, 0x0A, 0x08, 0x0A, 0x00, 0x48, 0x4A, 0x42, 0x02,
+0x5B, 0xC2, 0x62, 0x97, 0x09, 0x01, 0x55, 0xCC, 0x41, 0x66, 0x78, 0x70, 0x66, 0x20, 0xAB, 0x66,
+0x33, 0x1A, 0x33, 0x1B, 0x09, 0x00, 0x55, 0x49, 0x00, 0x50, 0xC1, 0x47, 0x00, 0x0E, 0x52, 0x41,
+0x40, 0x08, 0x6D, 0x40, 0x52, 0x40, 0x00, 0xC5, 0xB6, 0x14, 0x83, 0x3B, 0x83, 0x9C, 0x00, 0xC6,
+0x83, 0x9C, 0x3B, 0x9C, 0x9B, 0x34, 0x83, 0x00, 0x6B, 0xC4, 0x83, 0x5E, 0x14, 0xE4, 0x00, 0x0A,
+0x41, 0x40, 0x0E, 0x41, 0xC4, 0xD1, 0x19, 0x9F, 0x5F, 0x75, 0x02, 0xCA, 0x5F, 0x43, 0xE2, 0xBA,
+0x0D, 0x81, 0x39, 0xBB, 0x55, 0x4B, 0x38, 0x00, 0x79, 0xD1, 0xC3, 0x87, 0x6E, 0xB9, 0x81, 0x4D,
+0x6E, 0x39, 0x46, 0x38, 0x0D, 0x4D, 0x55, 0x61, 0x7F, 0xBB, 0x4B, 0x07, 0x00, 0xC1, 0x81, 0x00,
+0x12, 0x42, 0x4E, 0x42, 0x41, 0x00, 0x40, 0x44, 0x42, 0x48, 0x44, 0x48, 0x41, 0x40, 0x07, 0x4A,
+0x44, 0x48, 0x42, 0x41, 0x43, 0x40, 0x01, 0x45, 0x48, 0x43, 0x44, 0x4E, 0x44, 0x41, 0x40, 0x04,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x02, 0x42, 0x44, 0x00, 0x45, 0x41, 0x45, 0x41, 0x01, 0x44, 0x42, 0x41, 0x45, 0x00, 0x41, 0x42,
+0x00, 0x40, 0x00, 0x45, 0x40, 0x07, 0x45, 0x41, 0x01, 0x44, 0x45, 0x40, 0x41, 0x00, 0x40, 0x10,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x03, 0x52, 0x71, 0x40, 0x71, 0x41, 0x40, 0x0E, 0x41, 0x6D, 0x40,
+0x0A, 0x41, 0x40, 0x10, 0x45, 0x5E, 0x4F, 0x5E, 0x62, 0x68, 0x62, 0x7F, 0x5E, 0xC0, 0x90, 0x00,
+0x68, 0x5E, 0x00, 0x4F, 0x5E, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x03, 0xC1, 0x97, 0x09,
+0x00, 0x73, 0x60, 0x00, 0x50, 0x55, 0xC4, 0x99, 0x09, 0x82, 0x97, 0x09, 0x03, 0xC4, 0x97, 0x62,
+0x10, 0x8A, 0x02, 0x02, 0x48, 0x00, 0xC3, 0x44, 0x04, 0x08, 0x02, 0x00, 0x40, 0x01, 0x4F, 0xC4,
+0xC7, 0x84, 0x7A, 0x7C, 0xAF, 0x00, 0xC8, 0x7A, 0x4C, 0x2B, 0x4A, 0x02, 0x44, 0x6D, 0x51, 0x16,
+0x00, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x42, 0xC5, 0x8A, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x00,
+0x5C, 0x56, 0xD3, 0x8A, 0x16, 0x1C, 0x16, 0x02, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C,
+0x16, 0x1C, 0x16, 0x1C, 0x16, 0x02, 0x16, 0x00, 0x69, 0x56, 0x5C, 0x56, 0xCB, 0x8A, 0x03, 0x4A,
+0x3B, 0x4C, 0xD8, 0xAF, 0x6B, 0x65, 0x5B, 0x9D, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42, 0x43, 0x00,
+0x42, 0x44, 0x48, 0x42, 0x03, 0x50, 0x49, 0x00, 0xC5, 0x97, 0x62, 0x09, 0x62, 0x09, 0x33, 0x01,
+0xC6, 0xA5, 0x1B, 0x10, 0x20, 0x33, 0x99, 0x09, 0x05, 0xC2, 0x41, 0x01, 0x00, 0x0E, 0x71, 0x41,
+0x40, 0x08, 0x4B, 0x40, 0x00, 0x4B, 0x00, 0xC1, 0xB6, 0x24, 0x00, 0xC7, 0x83, 0x9C, 0x5E, 0x24,
+0x34, 0x83, 0x24, 0x83, 0x00, 0x64, 0xC2, 0x5B, 0x24, 0x83, 0x01, 0x64, 0xC1, 0xB6, 0x00, 0x0A,
+0x41, 0x40, 0x0E, 0xC2, 0xE8, 0x43, 0x19, 0x00, 0xC3, 0x5F, 0x43, 0x9F, 0x5F, 0x00, 0x59, 0x00,
+0xC2, 0xE2, 0x07, 0x0D, 0x00, 0xCD, 0x55, 0x6E, 0x7F, 0x38, 0x4B, 0x0D, 0x45, 0x79, 0x45, 0x4D,
+0x38, 0x46, 0x4B, 0x46, 0x00, 0x78, 0xC8, 0xC6, 0x0D, 0x45, 0x4B, 0x38, 0x4D, 0xC6, 0x0D, 0x07,
+0x00, 0xC2, 0x81, 0x12, 0x00, 0x11, 0x45, 0x44, 0x00, 0x45, 0x00, 0x40, 0x45, 0x41, 0x00, 0x44,
+0x45, 0x40, 0x08, 0x45, 0x44, 0x42, 0x40, 0x41, 0x45, 0x41, 0x45, 0x00, 0x41, 0x42, 0x00, 0x41,
+0x44, 0x00, 0x45, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x45, 0x43, 0x44, 0x42, 0x40, 0x27, 0x41, 0x40, 0x19, 0x41,
+0x40, 0x07, 0x41, 0x52, 0x40, 0x0E, 0x67, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x67, 0x4F, 0x67,
+0x4F, 0x67, 0x4F, 0x67, 0x5E, 0x67, 0x01, 0x5E, 0x67, 0x5E, 0x4F, 0x67, 0x40, 0x0F, 0xC1, 0x4F,
+0x15, 0x00, 0x49, 0xC7, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x1B, 0x15, 0x00, 0x49, 0x5B, 0x49,
+0x5B, 0x49, 0x55, 0x49, 0x55, 0x49, 0x01, 0xC4, 0x97, 0x41, 0x1B, 0x29, 0x02, 0x02, 0x45, 0x00,
+0x42, 0x01, 0x45, 0x42, 0x41, 0x40, 0x00, 0x4F, 0xCF, 0xE3, 0x9B, 0x50, 0xBE, 0x7C, 0x7A, 0x9D,
+0xA9, 0x42, 0x4A, 0x05, 0x01, 0x6D, 0x51, 0x44, 0x16, 0x02, 0x42, 0x56, 0xC9, 0x8A, 0x16, 0x02,
+0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x01, 0x42, 0x56, 0xD4, 0x8A, 0x16, 0x1C, 0x16, 0x1C,
+0x16, 0x29, 0x16, 0x1C, 0x16, 0x02, 0x16, 0x1C, 0x16, 0x8A, 0x16, 0x02, 0x8A, 0x1C, 0x16, 0x8A,
+0x00, 0x69, 0xCA, 0x58, 0x4A, 0x3B, 0x34, 0xB8, 0xB7, 0x7C, 0x65, 0x34, 0x63, 0x00, 0x02, 0x45,
+0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x02, 0x61, 0x5B, 0x49, 0x01, 0x55, 0x49, 0x00, 0x55,
+0xC1, 0x41, 0x1B, 0x00, 0x49, 0x55, 0x49, 0x55, 0x5B, 0xC3, 0x41, 0x09, 0x15, 0x09, 0x02, 0x55,
+0x5B, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0xC4, 0xB6, 0x5E, 0x24, 0xEE, 0x24, 0x01, 0xC1,
+0xEE, 0x24, 0x09, 0xC1, 0xE4, 0x00, 0x0A, 0x41, 0x40, 0x0E, 0x6D, 0xC3, 0xD1, 0x19, 0x9F, 0x19,
+0x01, 0xC1, 0x9F, 0x19, 0x01, 0xC1, 0xE2, 0x07, 0x05, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D, 0x47,
+0x6E, 0x4D, 0x00, 0x47, 0x03, 0x4D, 0x47, 0x02, 0x6E, 0xC1, 0x81, 0x0B, 0x00, 0x40, 0x2B, 0x42,
+0x44, 0x43, 0x42, 0x40, 0x0A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x44, 0x42, 0x28,
+0x45, 0x01, 0x42, 0xE0, 0x04, 0x69, 0x45, 0x69, 0x00, 0x45, 0x69, 0x45, 0x00, 0xC2, 0xBD, 0x05,
+0x02, 0x0D, 0x61, 0x42, 0x01, 0x68, 0x69, 0x68, 0x69, 0x68, 0x69, 0x68, 0x69, 0x42, 0x69, 0x42,
+0x01, 0x69, 0x42, 0x10, 0x44, 0x7F, 0x42, 0x44, 0x7F, 0x42, 0x44, 0x7F, 0x44, 0x68, 0x7F, 0x44,
+0x7F, 0x42, 0x44, 0x42, 0x00, 0x69, 0x42, 0x0B, 0x68, 0x61, 0x44, 0xCF, 0x99, 0x20, 0x33, 0x20,
+0x6A, 0x99, 0x20, 0x6A, 0x99, 0x20, 0x33, 0x20, 0x33, 0x20, 0x99, 0x20, 0x04, 0xC1, 0x99, 0x20,
+0x01, 0xC2, 0x70, 0x51, 0x03, 0x09, 0x42, 0x00, 0x69, 0x7A, 0xC4, 0xB0, 0x8F, 0x3B, 0x50, 0x4C,
+0x00, 0xC7, 0x71, 0x11, 0x3E, 0x4A, 0x3F, 0x02, 0x6D, 0x16, 0x00, 0x5C, 0x02, 0x56, 0xC8, 0x8A,
+0x02, 0x16, 0x1C, 0x16, 0x8A, 0x16, 0x02, 0x16, 0x01, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x00, 0x5C,
+0x56, 0x42, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0xDC, 0x8A, 0x16, 0x1C, 0x16, 0x02, 0x16, 0x1C, 0x8A,
+0x1C, 0x16, 0x03, 0x44, 0x29, 0x26, 0x32, 0x59, 0x86, 0x64, 0x52, 0x53, 0x9B, 0x6C, 0x59, 0x05,
+0x02, 0x28, 0x29, 0x04, 0x03, 0x09, 0xC1, 0x6D, 0x20, 0x00, 0xC2, 0x70, 0x99, 0x20, 0x01, 0xC1,
+0x99, 0x20, 0x05, 0x73, 0x60, 0x03, 0xC5, 0x99, 0x33, 0x6D, 0x8C, 0x28, 0x02, 0x0C, 0x68, 0x42,
+0x00, 0x68, 0x42, 0xC3, 0xAA, 0x02, 0x21, 0x02, 0x00, 0x61, 0x42, 0x00, 0x61, 0x68, 0x42, 0x61,
+0x42, 0xC1, 0x63, 0x83, 0x00, 0xC1, 0x71, 0x83, 0x01, 0x74, 0xC0, 0x83, 0x03, 0x74, 0xC0, 0x83,
+0x01, 0xC6, 0x71, 0x83, 0x50, 0x21, 0x02, 0x28, 0x02, 0x06, 0x61, 0x42, 0x0E, 0xC5, 0xAA, 0xC5,
+0x6C, 0x5C, 0x5F, 0xBC, 0x00, 0xC7, 0x75, 0x5F, 0x75, 0x5F, 0xBC, 0xA0, 0x46, 0x55, 0x03, 0xC1,
+0xED, 0x55, 0x00, 0xC1, 0xED, 0x55, 0x07, 0xC3, 0xED, 0x55, 0xED, 0x55, 0x06, 0x42, 0x2D, 0x45,
+0x02, 0x42, 0x21, 0x45, 0x40, 0x43, 0x44, 0x18, 0x43, 0x44, 0x3A, 0x43, 0x44, 0x19, 0xC6, 0x5F,
+0xBC, 0x75, 0xBC, 0x75, 0x5F, 0x5C, 0x00, 0xC3, 0x75, 0x5C, 0x84, 0x04, 0x0E, 0xC3, 0x96, 0x74,
+0xAD, 0x74, 0x00, 0xCA, 0x96, 0x74, 0x96, 0x74, 0x96, 0x74, 0x96, 0x74, 0x96, 0x74, 0x04, 0x10,
+0x43, 0x44, 0x00, 0x76, 0x44, 0x00, 0x76, 0x44, 0x01, 0x76, 0x44, 0x01, 0x76, 0x44, 0xC1, 0x51,
+0x04, 0x0E, 0x76, 0xC0, 0x51, 0x01, 0xC5, 0x44, 0x96, 0x04, 0x44, 0x96, 0x04, 0x00, 0xC4, 0x44,
+0x04, 0x44, 0x04, 0x44, 0x00, 0x44, 0x00, 0x43, 0x44, 0xC1, 0x51, 0x04, 0x00, 0xC0, 0x44, 0x00,
+0xC0, 0x51, 0x00, 0x70, 0x48, 0x4A, 0x48, 0x4A, 0x48, 0x4A, 0x48, 0x4A, 0x48, 0x01, 0x44, 0x01,
+0x61, 0xCA, 0xB0, 0x8F, 0x6C, 0x11, 0x3B, 0x4A, 0x2B, 0x8F, 0x9A, 0x5A, 0x54, 0x00, 0x48, 0x56,
+0x5C, 0x56, 0x69, 0x56, 0x69, 0x00, 0x5C, 0x69, 0x5C, 0x69, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x5C,
+0x56, 0x5C, 0x56, 0x5C, 0x56, 0x42, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x42, 0x56, 0x5C,
+0x56, 0x5C, 0x56, 0x5C, 0x56, 0x00, 0x42, 0x69, 0x4A, 0xCD, 0x8D, 0x92, 0x6D, 0x3F, 0x26, 0xF6,
+0x5A, 0x11, 0x4A, 0x3B, 0x9B, 0x8F, 0x59, 0x04, 0x02, 0x43, 0x48, 0x4A, 0x48, 0x4A, 0xC7, 0x53,
+0x08, 0x0A, 0x08, 0x0A, 0x08, 0x58, 0x51, 0x00, 0x44, 0x56, 0x44, 0x00, 0xC1, 0x96, 0x04, 0x00,
+0xC7, 0x51, 0x96, 0x44, 0x51, 0x44, 0x51, 0x44, 0x04, 0x00, 0x43, 0x44, 0x43, 0x44, 0x01, 0xC3,
+0x96, 0x04, 0x36, 0x04, 0x0E, 0x66, 0xC1, 0x60, 0x26, 0x02, 0xC1, 0x60, 0x26, 0x00, 0xC1, 0x60,
+0x26, 0x01, 0xC1, 0x60, 0x26, 0x01, 0xC1, 0x44, 0x63, 0x00, 0xC3, 0x44, 0x36, 0x44, 0x04, 0x01,
+0x76, 0x44, 0x00, 0xC4, 0x44, 0x63, 0x04, 0x44, 0x63, 0x01, 0xC1, 0x44, 0x04, 0x09, 0x43, 0x44,
+0x0E, 0x76, 0xC2, 0x63, 0x04, 0x63, 0x01, 0x76, 0xC1, 0x44, 0x63, 0x00, 0x76, 0xC3, 0x4E, 0x4D,
+0x6E, 0x4D, 0x0B, 0xC1, 0x7F, 0x4D, 0x07, 0xC1, 0x6E, 0x4D, 0x01, 0xC1, 0x6E, 0x04, 0x3D, 0x43,
+0x44, 0x07, 0x43, 0x44, 0x09, 0x43, 0x42, 0x41, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x3A, 0x41, 0x40, 0x18, 0x6D, 0xC1, 0x9F, 0x19, 0x04, 0xC1, 0x9F, 0x19, 0x00, 0xC1, 0xD2, 0x00,
+0x0E, 0x71, 0xC1, 0xAE, 0x18, 0x00, 0xC1, 0xAE, 0x18, 0x01, 0xC7, 0xAE, 0x18, 0xAE, 0x18, 0xAE,
+0x18, 0x31, 0x00, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0xCA, 0x90, 0x02,
+0x05, 0x02, 0x05, 0x28, 0x21, 0x05, 0x02, 0x05, 0x02, 0x00, 0x40, 0x01, 0x41, 0xC1, 0xB0, 0xBC,
+0x00, 0xC0, 0x5C, 0x00, 0x6F, 0x01, 0x66, 0x77, 0x76, 0x00, 0x43, 0x56, 0x5C, 0xC3, 0x8A, 0x29,
+0x1C, 0x29, 0x01, 0x5C, 0x69, 0x00, 0x5C, 0x56, 0x42, 0x56, 0x04, 0x5C, 0x56, 0x5C, 0x56, 0x5C,
+0x56, 0x00, 0x5C, 0x56, 0xD5, 0x8A, 0x16, 0x1C, 0x16, 0x02, 0x16, 0x8A, 0x29, 0x16, 0x1C, 0x16,
+0x05, 0x0E, 0x68, 0x0C, 0x54, 0x60, 0x58, 0x5A, 0xA4, 0xA7, 0x2F, 0x00, 0xC0, 0x8F, 0x00, 0xC1,
+0x89, 0x00, 0x02, 0x45, 0x01, 0x42, 0x45, 0x68, 0x42, 0x45, 0x68, 0x61, 0x45, 0x7F, 0x67, 0x40,
+0x27, 0x52, 0x4F, 0x01, 0x5E, 0x4F, 0x5E, 0x04, 0xC2, 0x40, 0x1E, 0x40, 0x00, 0x5E, 0xC1, 0xE8,
+0x00, 0x10, 0x65, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07, 0x00, 0x4D,
+0x47, 0x4D, 0x47, 0x03, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x01, 0x4D, 0x47,
+0x00, 0x4D, 0x47, 0x01, 0xC1, 0xB2, 0x00, 0x3D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x01, 0x4B, 0xC4, 0xC0, 0x31, 0x2D, 0x0B, 0x00,
+0x00, 0x4B, 0x00, 0x40, 0x4B, 0x40, 0x00, 0x52, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x10, 0x4B, 0x40,
+0x00, 0x52, 0x40, 0x4B, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x6D, 0xC8, 0x9F, 0x19, 0x43, 0x19, 0x9F,
+0x43, 0x19, 0x43, 0x19, 0x00, 0xC1, 0xC8, 0x00, 0x0C, 0x4B, 0x40, 0x67, 0x58, 0x00, 0xC1, 0xDA,
+0x18, 0x00, 0xC0, 0xDA, 0x00, 0x58, 0x01, 0xC1, 0xAE, 0x18, 0x00, 0xC1, 0xDA, 0x00, 0x10, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x04, 0x71, 0x40, 0x00, 0x4B, 0x40, 0x41, 0x4B,
+0x52, 0x41, 0x40, 0x07, 0x67, 0x42, 0x03, 0x45, 0x42, 0x01, 0x45, 0x42, 0x00, 0x41, 0x40, 0x00,
+0x65, 0xC3, 0xD2, 0x6C, 0x5C, 0x11, 0x01, 0x6F, 0x57, 0x77, 0xC4, 0x85, 0x54, 0x26, 0x03, 0x16,
+0x00, 0x5C, 0x69, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x02, 0x5C, 0x56, 0x00, 0x5C, 0x56,
+0x5C, 0x56, 0x01, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x69, 0x56, 0x5C, 0x56, 0x42, 0x56,
+0x5C, 0x42, 0x56, 0xD1, 0xB8, 0x16, 0x02, 0x0A, 0x68, 0x0E, 0x36, 0x9A, 0xA4, 0x89, 0x0E, 0x34,
+0x3E, 0x84, 0x6C, 0x95, 0x0B, 0x00, 0x01, 0x45, 0x42, 0x02, 0x61, 0x68, 0x42, 0x03, 0x41, 0x40,
+0x27, 0x52, 0x4F, 0xC5, 0x40, 0x22, 0x40, 0x0F, 0x22, 0x0F, 0x00, 0x62, 0x4F, 0x00, 0xC6, 0x40,
+0x93, 0x22, 0x0F, 0x22, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07,
+0xC4, 0xB2, 0x07, 0x0D, 0x2E, 0x0D, 0x01, 0xC5, 0x4B, 0x2E, 0x0D, 0x07, 0x0D, 0x07, 0x00, 0x4D,
+0x6E, 0x47, 0x01, 0x6E, 0xC2, 0x4B, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0xC0, 0x79, 0x00, 0x47, 0x00,
+0xC1, 0x81, 0x00, 0x12, 0xC3, 0x47, 0x00, 0x12, 0x00, 0x01, 0x4B, 0x40, 0x4B, 0x01, 0x40, 0x08,
+0x4B, 0x40, 0x00, 0x52, 0xC8, 0x47, 0x00, 0x12, 0x0B, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x00, 0x40,
+0x06, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x02, 0xC9, 0x50, 0x98, 0x36, 0x02, 0x74, 0x00, 0x44, 0x04, 0x02, 0x08, 0x00, 0x4F, 0x40,
+0x71, 0x41, 0x43, 0x48, 0x45, 0x43, 0x4E, 0x42, 0x40, 0x03, 0x41, 0x00, 0x43, 0x48, 0x41, 0x40,
+0x42, 0x4A, 0x44, 0x61, 0x4A, 0x44, 0x40, 0x10, 0x41, 0x40, 0x18, 0x6D, 0xCB, 0x9F, 0x19, 0x5F,
+0x2A, 0x75, 0x5F, 0x75, 0x2A, 0x19, 0x43, 0xC8, 0x00, 0x0E, 0x71, 0x58, 0xC1, 0xE5, 0x98, 0x01,
+0xC9, 0x8C, 0x74, 0x8E, 0x96, 0x74, 0x98, 0xEA, 0x18, 0x1F, 0x00, 0x0F, 0x41, 0x00, 0x40, 0x0D,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x41, 0x66, 0xC8, 0x70, 0x3F, 0x00, 0x44, 0x02, 0x1F, 0x08,
+0x04, 0x00, 0x05, 0x4B, 0x42, 0x03, 0x48, 0x4E, 0x44, 0x43, 0x4E, 0x43, 0x42, 0x41, 0x40, 0x00,
+0x41, 0xD4, 0xC7, 0x5F, 0x11, 0x34, 0x76, 0x50, 0x34, 0x5A, 0x9A, 0xA4, 0x5A, 0x58, 0x6D, 0x1C,
+0x16, 0xB8, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x02, 0x5C, 0x56, 0x5C, 0x56, 0x04, 0x5C, 0x00, 0x56,
+0x69, 0x56, 0x42, 0x56, 0x5C, 0x56, 0x42, 0xCE, 0x8A, 0x1C, 0x16, 0x8A, 0x16, 0x29, 0x1C, 0x16,
+0x29, 0x1C, 0x8A, 0x29, 0x03, 0x68, 0x5A, 0x00, 0xCA, 0x9A, 0xB0, 0x64, 0x67, 0xE7, 0xB7, 0x89,
+0x34, 0x44, 0x0B, 0x00, 0x01, 0x45, 0x42, 0x4A, 0x00, 0x44, 0xC4, 0x86, 0x0A, 0x04, 0x28, 0x02,
+0x01, 0x41, 0x40, 0x28, 0x62, 0xD0, 0x40, 0x93, 0x22, 0x26, 0x0E, 0x58, 0x26, 0x3F, 0x36, 0x37,
+0x5A, 0x30, 0x93, 0x40, 0x22, 0x40, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0xDC, 0xB2, 0x2E, 0xBA, 0x0D, 0x55, 0x87, 0x39, 0x0D, 0x4B, 0x39, 0x87, 0x46, 0x4D, 0xBB,
+0x45, 0x0D, 0x45, 0xB9, 0x39, 0x4B, 0x0D, 0x4D, 0x87, 0x4D, 0x46, 0xBB, 0x46, 0x0D, 0x07, 0x00,
+0xC1, 0x81, 0x00, 0x12, 0x65, 0x48, 0x00, 0x4F, 0x40, 0x5C, 0x4A, 0x44, 0x42, 0x48, 0x44, 0x40,
+0x08, 0xC1, 0x44, 0x08, 0x00, 0x41, 0x69, 0x76, 0x40, 0x4B, 0x40, 0x52, 0x61, 0x43, 0x41, 0x43,
+0x4A, 0x45, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x01, 0x4B, 0xC2, 0x70, 0x03, 0x02, 0x00, 0xC3, 0x8D, 0x01, 0x0A, 0x08,
+0x00, 0x41, 0x42, 0x45, 0x40, 0x00, 0xC7, 0x4F, 0x04, 0x53, 0x02, 0x00, 0x0A, 0x05, 0x00, 0x04,
+0x45, 0x42, 0x4A, 0x45, 0x40, 0x44, 0x41, 0x4A, 0x42, 0x44, 0xC1, 0x58, 0x00, 0x00, 0x4B, 0x40,
+0x0D, 0x41, 0x40, 0x18, 0x41, 0xC0, 0x9F, 0x00, 0xC9, 0x5F, 0x6C, 0x75, 0x5C, 0x5F, 0x2B, 0x19,
+0x5F, 0xC8, 0x00, 0x0E, 0x67, 0x58, 0x5B, 0xC4, 0x98, 0xEA, 0x98, 0x96, 0x98, 0x00, 0xC6, 0x8C,
+0xAD, 0x98, 0x96, 0x18, 0xDA, 0x00, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40,
+0x00, 0x52, 0x40, 0x01, 0x71, 0x48, 0x42, 0x65, 0x44, 0x45, 0x4E, 0x44, 0x45, 0x44, 0x4A, 0x40,
+0x05, 0x67, 0x42, 0x03, 0x48, 0x4A, 0x00, 0x4E, 0x44, 0x4E, 0x42, 0x41, 0x40, 0x00, 0x41, 0xC4,
+0xD2, 0x11, 0x52, 0xE4, 0x6B, 0x00, 0xC7, 0x65, 0x0E, 0x3B, 0x2F, 0xC9, 0x30, 0x03, 0x16, 0x00,
+0x5C, 0x56, 0x02, 0x5C, 0x56, 0x00, 0x44, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x44, 0x56, 0x5C, 0x56,
+0x01, 0x5C, 0x56, 0x5C, 0x56, 0x69, 0x56, 0x5C, 0x56, 0x69, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0xD3,
+0x8A, 0x29, 0x1C, 0x8A, 0x29, 0x50, 0x8D, 0x68, 0x49, 0x5A, 0xDB, 0x11, 0x76, 0xE9, 0xC0, 0xAF,
+0x6B, 0x67, 0x44, 0x00, 0x02, 0x45, 0x44, 0x43, 0x4E, 0x48, 0xC5, 0x8D, 0x0A, 0x04, 0x02, 0x1C,
+0x02, 0x00, 0x41, 0x40, 0x27, 0x52, 0x62, 0xC0, 0x40, 0x00, 0x62, 0xC2, 0x90, 0x54, 0x90, 0x00,
+0xC5, 0x5A, 0x30, 0x36, 0x49, 0x5A, 0x22, 0x00, 0xC2, 0x40, 0x0F, 0x00, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xCB, 0xB2, 0x07, 0x79, 0x07, 0x4D, 0xC3, 0xBB, 0x55,
+0x45, 0x46, 0x55, 0x87, 0x00, 0xC6, 0x61, 0x4D, 0x0D, 0x45, 0x6E, 0x87, 0x45, 0x00, 0xCB, 0x46,
+0xC3, 0x87, 0x61, 0x87, 0x39, 0x79, 0x07, 0xBA, 0x81, 0x0B, 0x00, 0x11, 0x42, 0x45, 0x66, 0x44,
+0x40, 0x44, 0x41, 0x4A, 0x48, 0x01, 0x40, 0x08, 0x4A, 0x44, 0xCE, 0x49, 0x02, 0x53, 0x0A, 0x00,
+0x0B, 0x00, 0x01, 0x08, 0x0A, 0x01, 0x02, 0x04, 0x03, 0x00, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x4A, 0x43, 0x42, 0x00,
+0x4A, 0x44, 0xC8, 0x53, 0x08, 0x03, 0x00, 0x01, 0x27, 0x12, 0x00, 0x01, 0x00, 0x43, 0x42, 0x00,
+0x43, 0x40, 0x05, 0x41, 0x00, 0x43, 0x42, 0x40, 0x00, 0x44, 0x00, 0xC4, 0x47, 0x21, 0x30, 0x01,
+0x00, 0x0F, 0x41, 0x40, 0x18, 0x6D, 0xC3, 0x9F, 0x19, 0x43, 0x75, 0x00, 0xC0, 0x6C, 0x00, 0x6A,
+0xC0, 0x43, 0x00, 0xC2, 0xC8, 0x2D, 0x00, 0x0D, 0x71, 0x58, 0xC9, 0x4F, 0xCF, 0x92, 0x8D, 0x31,
+0x74, 0xCF, 0x18, 0x8E, 0x74, 0x00, 0x58, 0xC1, 0xDA, 0x00, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x06, 0x48, 0x41, 0x5C, 0xC8, 0x49, 0x01, 0x1C, 0x04, 0x00, 0x05, 0x08,
+0x05, 0x00, 0x04, 0x4B, 0x42, 0x04, 0x43, 0x4E, 0x00, 0x42, 0x4E, 0x42, 0x41, 0x40, 0x00, 0x41,
+0xD5, 0xC7, 0x9B, 0xB6, 0xC0, 0x2D, 0x00, 0xB7, 0x65, 0x3B, 0x42, 0x32, 0x59, 0x03, 0x16, 0x8A,
+0x1C, 0x29, 0x44, 0x16, 0x1C, 0x16, 0x1C, 0x00, 0x69, 0x56, 0x05, 0x5C, 0x56, 0x5C, 0x56, 0x00,
+0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x42, 0x56, 0x5C, 0x56, 0x42, 0x56, 0xC6,
+0x8A, 0x16, 0x29, 0x8D, 0xC4, 0x0C, 0x0E, 0x00, 0x6A, 0xC8, 0x9B, 0x8A, 0xC0, 0x00, 0x47, 0x7C,
+0x4C, 0xD4, 0x00, 0x02, 0x45, 0x42, 0x00, 0xC6, 0x86, 0x53, 0x63, 0x03, 0x49, 0x28, 0x02, 0x01,
+0x41, 0x40, 0x28, 0x4F, 0xD0, 0x40, 0x93, 0x22, 0x0F, 0x5A, 0x90, 0xA2, 0x54, 0x26, 0x36, 0x85,
+0x58, 0x17, 0x93, 0x40, 0x0F, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07,
+0xC1, 0xB2, 0x07, 0x00, 0x6E, 0xC3, 0x81, 0x4D, 0x7F, 0x0D, 0x00, 0xD7, 0xB1, 0x39, 0x55, 0x61,
+0x6E, 0x39, 0x0D, 0x2E, 0xC3, 0xB9, 0x55, 0x0D, 0x38, 0x6E, 0x55, 0x39, 0x4E, 0x39, 0x79, 0x0D,
+0x07, 0x81, 0x0B, 0x00, 0x12, 0x68, 0x43, 0x67, 0x40, 0x4B, 0x43, 0x42, 0x43, 0xC3, 0x44, 0x03,
+0x01, 0x00, 0x07, 0xD0, 0x86, 0x03, 0x0A, 0x3F, 0xAF, 0x26, 0x00, 0x0B, 0x00, 0x0B, 0x01, 0x03,
+0x0B, 0x05, 0x03, 0x1F, 0x00, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x4A, 0xCB, 0x96, 0x02, 0x04, 0x96, 0x0A, 0x03, 0x04,
+0x08, 0x04, 0x08, 0x28, 0x00, 0x00, 0x65, 0x43, 0x00, 0x42, 0x43, 0x42, 0x40, 0x05, 0x45, 0x43,
+0x00, 0x44, 0x41, 0x48, 0x4A, 0x45, 0xC6, 0x44, 0x04, 0x08, 0x0F, 0x00, 0x0B, 0x00, 0x0D, 0x41,
+0x40, 0x18, 0x52, 0xC0, 0x43, 0x00, 0xC4, 0x75, 0x2A, 0x6C, 0x5F, 0x75, 0x00, 0xC0, 0x43, 0x00,
+0xC1, 0xC8, 0x00, 0x0E, 0x71, 0x58, 0xC4, 0x8E, 0x98, 0xEA, 0x98, 0x74, 0x00, 0xC2, 0xAD, 0x98,
+0x74, 0x00, 0xC3, 0x96, 0x18, 0xDA, 0x00, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00,
+0x40, 0x05, 0x44, 0x48, 0xC4, 0x44, 0x5A, 0x01, 0x1C, 0x02, 0x00, 0xC3, 0x63, 0x03, 0x05, 0x00,
+0x04, 0x67, 0x42, 0x03, 0x4A, 0x48, 0x4A, 0x02, 0x42, 0x41, 0x40, 0x00, 0x41, 0xCD, 0xB0, 0x34,
+0x65, 0xAF, 0x12, 0x31, 0x7C, 0x65, 0x34, 0x11, 0xC9, 0x26, 0x03, 0x16, 0x02, 0xCD, 0x96, 0x44,
+0x51, 0x16, 0x51, 0x16, 0x44, 0x16, 0x44, 0x16, 0x04, 0x16, 0x1C, 0x16, 0x02, 0x5C, 0x56, 0x00,
+0x5C, 0x56, 0x5C, 0x56, 0x42, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x69, 0x56, 0x5C, 0xC1, 0x8A, 0x02,
+0x00, 0x69, 0xC9, 0x53, 0x9E, 0x0E, 0x6D, 0x3E, 0x11, 0x84, 0x7A, 0x6B, 0x0B, 0x00, 0xC4, 0x7A,
+0xCC, 0x9D, 0x12, 0x00, 0x01, 0x45, 0x44, 0x4A, 0x03, 0x48, 0x42, 0x02, 0x41, 0x40, 0x27, 0x52,
+0x62, 0xC0, 0x40, 0x00, 0xC6, 0x93, 0x0F, 0x54, 0x90, 0x26, 0x36, 0x58, 0x00, 0x70, 0xC5, 0x5A,
+0x3F, 0x40, 0x22, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xDC,
+0xB2, 0x2E, 0x07, 0x81, 0xB9, 0x88, 0x55, 0x4B, 0x46, 0xBB, 0x6F, 0x55, 0xBB, 0x4E, 0x61, 0x38,
+0x46, 0x6E, 0x61, 0x55, 0x38, 0xBB, 0xA9, 0x55, 0xB9, 0x4E, 0xBB, 0x79, 0x07, 0x00, 0xC1, 0x81,
+0x00, 0x12, 0x42, 0x4E, 0x44, 0x4F, 0x41, 0x48, 0x4A, 0x45, 0x48, 0x43, 0x4A, 0x41, 0x40, 0x07,
+0xC6, 0x86, 0x51, 0x30, 0x02, 0x4F, 0x03, 0x00, 0x02, 0x65, 0x43, 0x45, 0x4E, 0x43, 0x41, 0x40,
+0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x01, 0x4B, 0x61, 0x56, 0x7F, 0xC3, 0x4F, 0x01, 0x05, 0x01, 0x01, 0x42, 0x61, 0x4F, 0x42,
+0x00, 0x45, 0x61, 0x42, 0x40, 0x41, 0x00, 0x40, 0x06, 0x42, 0x00, 0x40, 0x41, 0x42, 0x01, 0x41,
+0x42, 0x4F, 0x40, 0x10, 0x41, 0x40, 0x18, 0x6D, 0xC2, 0x9F, 0x19, 0x5F, 0x01, 0xC1, 0x43, 0x5F,
+0x00, 0x59, 0xC3, 0x43, 0xC8, 0x0B, 0x00, 0x0B, 0x4B, 0x40, 0x71, 0x58, 0xCA, 0xE5, 0x8E, 0x18,
+0x8E, 0xAD, 0x8E, 0x18, 0x8C, 0x8E, 0x8C, 0x18, 0x00, 0xC1, 0xAE, 0x00, 0x0F, 0x41, 0x00, 0x40,
+0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x68, 0x5C, 0x41, 0x40, 0x65, 0x41, 0x52, 0x42, 0x45,
+0x40, 0x05, 0x4B, 0x42, 0x04, 0x48, 0x42, 0x00, 0x48, 0x42, 0x00, 0x52, 0x40, 0x00, 0x41, 0xC4,
+0xB0, 0x34, 0x65, 0x7C, 0xAF, 0x00, 0xC7, 0x7A, 0x13, 0x84, 0x2F, 0x3B, 0x0E, 0x03, 0x16, 0x01,
+0xC6, 0x44, 0x16, 0x44, 0x96, 0x16, 0x44, 0x51, 0x01, 0xC2, 0x44, 0x04, 0x16, 0x01, 0x44, 0x5C,
+0x56, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0xC6, 0x8A, 0x16, 0x1C,
+0x16, 0x1C, 0x29, 0x16, 0x00, 0x69, 0x56, 0x69, 0x01, 0xCB, 0x4F, 0x59, 0x11, 0x3B, 0x56, 0xD8,
+0xF8, 0x7C, 0x65, 0x56, 0x44, 0x00, 0x00, 0x4B, 0x40, 0x45, 0x42, 0x44, 0x43, 0x42, 0x44, 0x43,
+0x42, 0x03, 0x41, 0x40, 0x28, 0x62, 0xC1, 0x40, 0x22, 0x00, 0x4F, 0x7F, 0x4F, 0x7F, 0x62, 0x00,
+0x57, 0x77, 0x7F, 0x4F, 0xC3, 0x40, 0x22, 0x40, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0xC2, 0xB2, 0x07, 0x0D, 0x00, 0xC1, 0x45, 0x46, 0x00, 0xD4, 0xC6, 0x38, 0x46,
+0x4D, 0x38, 0x4B, 0x4D, 0x79, 0x46, 0x38, 0x46, 0x45, 0x79, 0x4B, 0x46, 0x4D, 0x45, 0x38, 0x4D,
+0xC6, 0x07, 0x01, 0xC2, 0x81, 0x31, 0x00, 0x11, 0xC6, 0x4F, 0x02, 0x3F, 0x1F, 0x01, 0x29, 0x02,
+0x00, 0x4B, 0x42, 0x65, 0x40, 0x08, 0x45, 0x44, 0x42, 0x40, 0x4B, 0x4F, 0x00, 0x69, 0x42, 0x45,
+0x4B, 0x45, 0x41, 0x42, 0x44, 0x5F, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x45, 0x44, 0x00, 0x45, 0x40, 0x27, 0x41,
+0x40, 0x18, 0x41, 0xC7, 0xD1, 0x19, 0x9F, 0x19, 0x9F, 0x19, 0xFC, 0x19, 0x01, 0xC1, 0xC8, 0x00,
+0x0E, 0x71, 0xC1, 0xAE, 0x18, 0x02, 0xC3, 0xAE, 0x18, 0xAE, 0x18, 0x00, 0xC1, 0xAE, 0x18, 0x00,
+0x71, 0x40, 0x20, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0x42, 0x04, 0x45, 0x42, 0x00, 0x45, 0x42,
+0x00, 0x40, 0x01, 0x65, 0xCE, 0xB0, 0x3B, 0x76, 0x94, 0xF5, 0x7A, 0x65, 0x70, 0x4A, 0x3B, 0x32,
+0x4A, 0x63, 0x1C, 0x16, 0x04, 0x44, 0x56, 0x01, 0xC1, 0x44, 0x16, 0x00, 0xC1, 0x44, 0x16, 0x05,
+0x5C, 0x56, 0x00, 0x42, 0x56, 0xDC, 0x8A, 0x16, 0x1C, 0x16, 0x02, 0x16, 0x02, 0x8A, 0x29, 0x16,
+0x1C, 0x16, 0x02, 0x8A, 0x02, 0x16, 0x1C, 0x29, 0x59, 0x11, 0x84, 0x3E, 0x67, 0x7C, 0x94, 0x9D,
+0x34, 0x95, 0x00, 0x02, 0x41, 0x42, 0x00, 0x45, 0x42, 0x68, 0x61, 0x68, 0x42, 0x02, 0x41, 0x40,
+0x28, 0x5E, 0xC0, 0x40, 0x00, 0x5E, 0x03, 0xC3, 0x40, 0x0F, 0xD9, 0x1E, 0x00, 0xC4, 0x40, 0x1E,
+0x40, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x6D, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x07, 0xC1, 0xD6,
+0x07, 0x01, 0x4D, 0x6E, 0x47, 0x04, 0x4D, 0x47, 0x4D, 0x47, 0x02, 0x4D, 0x47, 0x08, 0xC2, 0x81,
+0x0B, 0x00, 0x2C, 0x45, 0x44, 0x00, 0x42, 0x40, 0x0A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x44, 0x42, 0x08, 0x44, 0x42, 0x0D, 0x44, 0x42, 0x3A, 0x44, 0x42, 0x18, 0x44, 0xC1, 0x6C,
+0x5F, 0x04, 0xC4, 0x6C, 0x75, 0x5F, 0x84, 0x02, 0x0B, 0x44, 0x42, 0x00, 0x44, 0xC6, 0x96, 0x8C,
+0x96, 0x8C, 0x96, 0x8C, 0x96, 0x00, 0xC1, 0x8C, 0x96, 0x00, 0xC3, 0x8C, 0x96, 0x8C, 0x02, 0x0F,
+0x44, 0x42, 0x0E, 0x44, 0x42, 0x0F, 0x44, 0x42, 0x18, 0x43, 0x03, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x00, 0x44, 0x42, 0x00, 0x45, 0xD0, 0x59, 0x6C, 0x9B, 0x3E, 0x63, 0x76, 0x3E, 0x64, 0x0C,
+0x9E, 0xC4, 0x0C, 0x44, 0x1C, 0x16, 0x8C, 0x16, 0x04, 0x44, 0x56, 0x01, 0xC1, 0x44, 0x16, 0x01,
+0x5C, 0x56, 0x00, 0x44, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x42, 0x56, 0x5C, 0x56, 0x5C,
+0x56, 0xD5, 0x8A, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x29, 0x26, 0x84, 0x90,
+0x59, 0x3B, 0x9B, 0x3E, 0x3B, 0x6C, 0x59, 0x02, 0x00, 0x44, 0x42, 0x44, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x03, 0x44, 0x42, 0x28, 0x76, 0x77, 0x76, 0x01, 0x77, 0x76, 0x77, 0x76, 0x77,
+0x76, 0x00, 0x77, 0x76, 0x77, 0x76, 0x00, 0x42, 0x10, 0x44, 0x42, 0x04, 0x56, 0x42, 0x03, 0x44,
+0x42, 0x44, 0x5C, 0x42, 0x0B, 0x44, 0x42, 0x03, 0x5C, 0x00, 0x44, 0x42, 0x68, 0xC3, 0xED, 0x7F,
+0x55, 0x7F, 0x00, 0xC3, 0x55, 0x7F, 0x55, 0x7F, 0x00, 0xC1, 0x55, 0x7F, 0x00, 0xC1, 0x55, 0x7F,
+0x00, 0xC3, 0xED, 0x7F, 0x55, 0x7F, 0x00, 0xC1, 0x55, 0x7F, 0x01, 0xC3, 0x55, 0x7F, 0x55, 0x7F,
+0x00, 0xC1, 0xED, 0x02, 0x3D, 0x44, 0x42, 0x07, 0x44, 0x42, 0x08, 0x44, 0x00, 0x42, 0x40, 0x43,
+0x42, 0x44, 0x08, 0x42, 0x44, 0x0E, 0x42, 0x44, 0x01, 0x5C, 0x44, 0x01, 0x42, 0x44, 0x02, 0x5C,
+0x44, 0x00, 0x42, 0x44, 0x42, 0x44, 0x05, 0x42, 0x44, 0x03, 0x42, 0x44, 0x01, 0x42, 0x44, 0x00,
+0x5C, 0x44, 0x42, 0x44, 0x11, 0x42, 0x44, 0x15, 0x5C, 0x44, 0xC6, 0xBC, 0x5F, 0x75, 0x5F, 0x75,
+0x5F, 0x75, 0x00, 0xC4, 0x5F, 0x75, 0xE3, 0x02, 0x04, 0x09, 0x42, 0xC1, 0x89, 0x04, 0x00, 0xC2,
+0x8C, 0x96, 0xAD, 0x00, 0xC2, 0x96, 0xAD, 0x96, 0x01, 0xC0, 0xAD, 0x00, 0xC1, 0x96, 0xAD, 0x00,
+0xC1, 0x96, 0x04, 0x10, 0x43, 0x42, 0x44, 0x0E, 0x42, 0x44, 0x0F, 0x42, 0x44, 0x0C, 0x42, 0x44,
+0x07, 0x48, 0x0A, 0x44, 0x01, 0x45, 0xC4, 0x9A, 0x84, 0x8F, 0x11, 0x2F, 0x00, 0x51, 0xC7, 0x9E,
+0x88, 0x7D, 0x56, 0x9E, 0x51, 0x02, 0x1C, 0x00, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x00,
+0x44, 0x56, 0x01, 0x44, 0x56, 0x04, 0x5C, 0x56, 0xD9, 0x8A, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C,
+0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x29, 0x16, 0x1C, 0x29, 0x16, 0x1C, 0x29, 0x3F, 0x36,
+0x9A, 0x4A, 0x2F, 0x00, 0x51, 0x6F, 0xC4, 0xD1, 0xB0, 0x04, 0x02, 0x04, 0x00, 0x43, 0x48, 0x09,
+0x44, 0x42, 0x44, 0x27, 0x76, 0xC2, 0x60, 0x37, 0x60, 0x00, 0x76, 0x00, 0xCB, 0x60, 0x36, 0x60,
+0x36, 0x60, 0x36, 0x60, 0x36, 0x60, 0x36, 0x02, 0x04, 0x0F, 0xC5, 0xAD, 0x96, 0xAD, 0x74, 0x96,
+0xAD, 0x00, 0xC1, 0x96, 0xAD, 0x01, 0xC6, 0x74, 0x96, 0x03, 0x04, 0x89, 0x02, 0x04, 0x0A, 0x42,
+0x44, 0x00, 0x42, 0x44, 0x03, 0x5C, 0x7F, 0xC2, 0x96, 0xED, 0x4D, 0x00, 0xC1, 0x46, 0x4D, 0x00,
+0xC3, 0x46, 0x4D, 0x7F, 0x4D, 0x01, 0xC3, 0x7F, 0x4D, 0x46, 0x4D, 0x02, 0xC2, 0x55, 0x7F, 0x4D,
+0x00, 0xC2, 0x46, 0x7F, 0x4D, 0x02, 0xC2, 0x46, 0x4D, 0x04, 0x1A, 0x42, 0x44, 0x0B, 0x5C, 0x44,
+0x01, 0x42, 0x44, 0x00, 0x42, 0x44, 0x03, 0x42, 0x44, 0x07, 0x42, 0x44, 0x03, 0x5C, 0x44, 0x0A,
+0x42, 0x44, 0x42, 0x41, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x41, 0xC1, 0x9F, 0x19, 0x00, 0xC3, 0x9F, 0x19, 0x9F, 0x43,
+0x00, 0x59, 0x00, 0xC1, 0xC8, 0x00, 0x0F, 0xC3, 0xAE, 0x18, 0xAE, 0x18, 0x03, 0xC0, 0xAE, 0x00,
+0x58, 0x00, 0xC0, 0xAE, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18,
+0x42, 0x02, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x01, 0x40, 0x01, 0x41, 0xC1, 0x59, 0x8F, 0x01,
+0x6F, 0x01, 0xC7, 0x9E, 0x56, 0xBE, 0x4C, 0x88, 0x96, 0x02, 0x16, 0x00, 0x5C, 0x56, 0x00, 0x5C,
+0x56, 0x01, 0x5C, 0x56, 0x02, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x00, 0x5C, 0x56,
+0x42, 0x56, 0x5C, 0x56, 0x69, 0x56, 0x5C, 0x56, 0x02, 0x5C, 0x56, 0x69, 0xCF, 0x8A, 0x16, 0x29,
+0x1C, 0x29, 0x58, 0x85, 0x3F, 0x95, 0x8F, 0x2F, 0x11, 0x3B, 0xBC, 0xA4, 0x00, 0x02, 0x45, 0x42,
+0x61, 0x68, 0x61, 0x42, 0x05, 0x41, 0x40, 0x28, 0x5E, 0xC0, 0x40, 0x00, 0x4F, 0x5E, 0xC2, 0x40,
+0x1E, 0x40, 0x00, 0x5E, 0xC0, 0x40, 0x00, 0x5E, 0xC0, 0x40, 0x01, 0x5E, 0x40, 0x10, 0xC1, 0xAE,
+0x18, 0x07, 0xC1, 0xAE, 0x18, 0x00, 0xC1, 0xAE, 0x00, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x07,
+0x00, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x00,
+0x6E, 0x4D, 0x47, 0x00, 0x4D, 0xC7, 0x79, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x81, 0x00, 0x3D, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x03,
+0x41, 0x00, 0x40, 0x13, 0x41, 0x00, 0x40, 0x01, 0x41, 0x40, 0x01, 0x41, 0x40, 0x00, 0x41, 0x40,
+0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x6D, 0xC4, 0x9F, 0x19, 0x9F, 0x43, 0x19, 0x00, 0xC0,
+0x9F, 0x00, 0x59, 0x00, 0xC1, 0xC8, 0x00, 0x0E, 0x67, 0x58, 0x00, 0xC2, 0x8E, 0x18, 0x8E, 0x00,
+0x58, 0x00, 0x5F, 0x58, 0xC1, 0xAE, 0x18, 0x00, 0xC1, 0xDA, 0x00, 0x10, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x0F, 0x41, 0x00, 0x40, 0x07, 0x67, 0x40, 0x0D, 0x42, 0x0A, 0x41, 0x40, 0x4B, 0x4F, 0xC5,
+0xB0, 0x8F, 0x2F, 0x3B, 0x4A, 0x3B, 0x00, 0x63, 0xC7, 0x88, 0xB8, 0x6A, 0x9E, 0x51, 0x1C, 0x29,
+0x16, 0x01, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x01, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x02, 0x5C, 0x56,
+0x5C, 0x56, 0x5C, 0x56, 0xC8, 0x8A, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x00, 0x56,
+0x5C, 0x69, 0x5C, 0x42, 0x69, 0x5C, 0x69, 0x00, 0xCC, 0x5A, 0x36, 0x3F, 0x3E, 0x64, 0x71, 0x50,
+0x3E, 0x6C, 0x95, 0x00, 0x12, 0x00, 0x00, 0x45, 0x42, 0x09, 0x41, 0x40, 0x28, 0x4F, 0x62, 0x00,
+0x5E, 0xC6, 0x93, 0x22, 0x40, 0x22, 0x93, 0x0F, 0x22, 0x00, 0xC5, 0x40, 0x0F, 0x40, 0x22, 0x0F,
+0x00, 0x10, 0x58, 0x01, 0xC1, 0x8E, 0x18, 0x00, 0xC6, 0xEA, 0xAE, 0x18, 0x8E, 0xAE, 0x8E, 0x18,
+0x00, 0x40, 0x52, 0x40, 0x0D, 0x41, 0x40, 0x07, 0xD1, 0xB2, 0x07, 0x2E, 0x07, 0x0D, 0x38, 0x0D,
+0x2E, 0x07, 0x0D, 0x2E, 0x07, 0x0D, 0x79, 0x0D, 0x07, 0x2E, 0x0D, 0x00, 0x47, 0x00, 0x4D, 0x6E,
+0x47, 0x00, 0x78, 0x4D, 0x47, 0x00, 0x6E, 0xC1, 0x81, 0x00, 0x18, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x08, 0x41, 0x40, 0x07, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x02, 0x48, 0x00, 0x44, 0x42, 0x4A, 0x40, 0x43, 0x44, 0x42, 0x48, 0x00,
+0x41, 0x40, 0x00, 0x41, 0x48, 0x00, 0x41, 0x44, 0x48, 0x45, 0x40, 0x01, 0x41, 0x40, 0x00, 0x41,
+0x48, 0x00, 0x41, 0x40, 0x44, 0x4A, 0x44, 0x42, 0x4A, 0x43, 0x40, 0x00, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x18, 0x6D, 0xCB, 0xD1, 0x43, 0x5F, 0x2A, 0x75, 0xBC, 0x2B, 0x75, 0x43, 0x19, 0xD2, 0x00,
+0x0C, 0x52, 0x40, 0x71, 0xCE, 0xAE, 0x18, 0x8C, 0xCF, 0x49, 0x96, 0xAD, 0x8C, 0xAD, 0x74, 0x98,
+0x8E, 0x18, 0x1F, 0x00, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x41,
+0x48, 0x4A, 0x44, 0x40, 0x43, 0x42, 0x00, 0x4A, 0x43, 0x40, 0x05, 0x41, 0x42, 0x03, 0x48, 0x4E,
+0x43, 0x42, 0x4E, 0x42, 0x00, 0x41, 0x40, 0x4B, 0x65, 0xD1, 0xB0, 0x6C, 0x3B, 0x53, 0x44, 0x9D,
+0x53, 0xC2, 0x77, 0xC4, 0x68, 0x0C, 0x03, 0x8A, 0x16, 0x8C, 0x1C, 0x16, 0x00, 0x5C, 0x56, 0x5C,
+0x56, 0x5C, 0x56, 0x03, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56,
+0x42, 0x56, 0x5C, 0x56, 0x00, 0x69, 0x5C, 0x56, 0x69, 0x5C, 0x69, 0xC4, 0x8A, 0x29, 0x1C, 0x8A,
+0x29, 0x00, 0xCC, 0x86, 0x4A, 0x32, 0x3E, 0xB8, 0xE9, 0xD8, 0x7C, 0xC7, 0x44, 0x00, 0x12, 0x00,
+0x00, 0x45, 0x42, 0x4A, 0x4E, 0x42, 0x00, 0x4A, 0x44, 0x42, 0x02, 0x41, 0x40, 0x28, 0x62, 0xC0,
+0x40, 0x00, 0x42, 0xCD, 0x5A, 0x49, 0x26, 0x60, 0x37, 0x36, 0x26, 0x5A, 0x30, 0x90, 0x22, 0x40,
+0x1E, 0x00, 0x10, 0x58, 0xC2, 0xAE, 0x74, 0x98, 0x00, 0xC7, 0x8C, 0x74, 0x8E, 0x74, 0x8E, 0x98,
+0x8E, 0x18, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x00, 0x4D,
+0xC3, 0x4D, 0x87, 0x6E, 0x38, 0x00, 0xCE, 0xB9, 0x87, 0x55, 0x39, 0x87, 0x55, 0x07, 0x45, 0x87,
+0x39, 0x4B, 0x38, 0x39, 0x87, 0x7F, 0x00, 0xC2, 0x87, 0x4D, 0x0D, 0x00, 0x47, 0xC1, 0x79, 0x00,
+0x12, 0x45, 0x48, 0x00, 0x45, 0x40, 0x44, 0x4A, 0x44, 0x42, 0x4A, 0x44, 0x40, 0x08, 0x43, 0x48,
+0x00, 0x41, 0x42, 0x43, 0x40, 0x02, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x40, 0x04, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x4A,
+0x43, 0x61, 0x42, 0xC3, 0x8D, 0x01, 0x0A, 0x08, 0x00, 0x40, 0x42, 0x62, 0x40, 0x00, 0x65, 0x5C,
+0xC5, 0x53, 0x03, 0x08, 0x02, 0x05, 0x00, 0x01, 0x41, 0x00, 0x40, 0x45, 0x42, 0x4A, 0x42, 0x40,
+0x42, 0x41, 0x4A, 0x42, 0x41, 0x4A, 0x41, 0x40, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x41, 0xCB,
+0x9F, 0x19, 0x5F, 0x43, 0x2A, 0x75, 0x5F, 0x75, 0x5F, 0x43, 0xC8, 0x00, 0x0E, 0x71, 0xC1, 0x8E,
+0x18, 0x00, 0xC3, 0x74, 0xAD, 0xAE, 0x98, 0x00, 0xC6, 0x8E, 0x96, 0x98, 0x8C, 0x18, 0xDA, 0x00,
+0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x00, 0x52, 0x00, 0x40, 0x01, 0xCB,
+0x74, 0x02, 0x25, 0x04, 0x4F, 0x3E, 0x04, 0x05, 0x01, 0x0A, 0x05, 0x00, 0x05, 0x42, 0x03, 0x43,
+0x4A, 0x00, 0x44, 0x63, 0xC3, 0x51, 0x02, 0x12, 0x00, 0x00, 0x7A, 0xC4, 0xB0, 0x6C, 0x76, 0x7C,
+0xC0, 0x00, 0xC8, 0x7C, 0x56, 0x0C, 0x32, 0x68, 0x4A, 0x51, 0x29, 0x1C, 0x00, 0x56, 0x5C, 0x00,
+0x56, 0x02, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x01, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x00,
+0x42, 0x56, 0x5C, 0x56, 0xCC, 0x8A, 0x16, 0x02, 0x16, 0x1C, 0x16, 0x29, 0x1C, 0x16, 0x29, 0xB8,
+0x16, 0x8A, 0x00, 0x69, 0xCB, 0x4F, 0x5A, 0x11, 0x3B, 0x65, 0xC0, 0x2D, 0x12, 0x6B, 0x65, 0x9D,
+0x00, 0x02, 0x45, 0x42, 0x43, 0x4E, 0x43, 0x44, 0x4C, 0x44, 0x42, 0x02, 0x41, 0x40, 0x28, 0x4F,
+0x62, 0xCF, 0x40, 0x37, 0x30, 0x0F, 0x5A, 0x3F, 0x5A, 0x26, 0x37, 0x54, 0x58, 0x22, 0x40, 0x22,
+0x0F, 0x00, 0x10, 0xC3, 0xAE, 0x18, 0x98, 0x8C, 0x00, 0xCA, 0x98, 0x8C, 0x92, 0x8C, 0xAD, 0x8D,
+0x8C, 0x18, 0xAE, 0x31, 0x00, 0x0E, 0x41, 0x40, 0x06, 0x71, 0xC2, 0xD6, 0x2E, 0x0D, 0x00, 0xC3,
+0x46, 0xC3, 0xBB, 0x55, 0x00, 0xD6, 0x46, 0x55, 0x88, 0x87, 0xC3, 0xBB, 0x07, 0x45, 0x7F, 0xBB,
+0xB1, 0x45, 0x46, 0x55, 0xBB, 0x87, 0xC3, 0x87, 0x38, 0x07, 0x2E, 0x81, 0x00, 0x12, 0x45, 0x00,
+0x43, 0x44, 0x40, 0x42, 0x41, 0x4A, 0x4E, 0x41, 0x4A, 0x41, 0x40, 0x07, 0x48, 0x43, 0x4A, 0x42,
+0x48, 0x4A, 0x40, 0x01, 0x41, 0x43, 0x4A, 0x41, 0x42, 0x48, 0x42, 0x40, 0x04, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x02, 0xC6, 0x53,
+0x60, 0x05, 0x02, 0x08, 0x03, 0x08, 0x01, 0x40, 0x41, 0x4F, 0x40, 0x52, 0x41, 0x65, 0xC1, 0x44,
+0x0A, 0x00, 0x44, 0x00, 0x40, 0x01, 0x41, 0x40, 0x00, 0x41, 0x00, 0x43, 0x42, 0x40, 0x00, 0x43,
+0x42, 0x40, 0x43, 0x42, 0x40, 0x00, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x6D, 0xC3, 0x9F, 0x19,
+0x43, 0x75, 0x00, 0xC6, 0xD1, 0x5C, 0x75, 0x43, 0x19, 0xD2, 0x00, 0x0E, 0x71, 0x5F, 0x58, 0x00,
+0xC7, 0x98, 0xAD, 0xAE, 0x74, 0xCF, 0xEA, 0x8E, 0x74, 0x00, 0x58, 0xC1, 0xDA, 0x00, 0x0F, 0x41,
+0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x01, 0x52, 0x40, 0x01, 0x71, 0x48, 0x41, 0x5C,
+0xC7, 0x49, 0x47, 0x1C, 0x04, 0x00, 0x04, 0x02, 0x00, 0x05, 0x41, 0x42, 0x04, 0x43, 0x4E, 0x45,
+0x48, 0x43, 0x42, 0xC1, 0x47, 0x00, 0x00, 0x4F, 0xC4, 0xC7, 0x3E, 0xF5, 0xC0, 0x12, 0x00, 0xC3,
+0x6B, 0x13, 0xA9, 0x2F, 0x00, 0x66, 0xC6, 0x51, 0x1C, 0x16, 0x8A, 0x16, 0x02, 0x16, 0x00, 0x5C,
+0x56, 0x5C, 0x56, 0x01, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x42, 0x56, 0x5C, 0x56, 0x5C,
+0x56, 0x5C, 0x56, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x69, 0x5C, 0x56, 0x5C, 0x69, 0x42, 0xC0, 0x8A,
+0x00, 0x56, 0x5C, 0x56, 0x42, 0xC5, 0xB0, 0x2B, 0x34, 0xB8, 0x6B, 0x00, 0x00, 0xC3, 0x7C, 0x13,
+0xD4, 0x00, 0x02, 0x45, 0x42, 0x00, 0x48, 0x4E, 0x4A, 0x4E, 0x48, 0x42, 0x02, 0x41, 0x40, 0x28,
+0x62, 0xD0, 0x40, 0x22, 0x3F, 0x0E, 0x4A, 0x49, 0x1E, 0x0E, 0x26, 0x36, 0x26, 0x49, 0x17, 0x0F,
+0x22, 0x1E, 0x00, 0x10, 0xC2, 0xDA, 0x18, 0x98, 0x00, 0xC1, 0x8D, 0x8C, 0x00, 0xC8, 0xCF, 0x8C,
+0xAE, 0x6D, 0x8C, 0x18, 0xAE, 0x31, 0x00, 0x0E, 0x41, 0x40, 0x07, 0xDC, 0xB2, 0x07, 0x2E, 0x07,
+0x81, 0x39, 0x55, 0x0D, 0x07, 0xB1, 0x39, 0xB1, 0xB9, 0xEC, 0xBB, 0xCB, 0x4B, 0xB1, 0x61, 0x46,
+0x0D, 0x38, 0xA0, 0x55, 0x39, 0xEC, 0xD5, 0xB1, 0x07, 0x00, 0xC2, 0x81, 0x0B, 0x00, 0x12, 0x42,
+0xCA, 0x44, 0x27, 0x00, 0x01, 0x03, 0x05, 0x04, 0x03, 0x0E, 0x01, 0x00, 0x07, 0x4A, 0x44, 0x48,
+0x44, 0x41, 0x43, 0x40, 0x02, 0x41, 0x48, 0x41, 0x00, 0x44, 0x00, 0x40, 0x04, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x01, 0x4B, 0x4A,
+0x43, 0x5C, 0x00, 0x76, 0x4A, 0x44, 0x00, 0x43, 0x00, 0x48, 0x45, 0x40, 0x00, 0x45, 0xC1, 0x6D,
+0x03, 0x02, 0x44, 0x40, 0x01, 0x41, 0x00, 0x40, 0x45, 0x43, 0x00, 0x42, 0x41, 0x4A, 0x00, 0x42,
+0x48, 0x4E, 0x42, 0x40, 0x00, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x41, 0xCB, 0xD1, 0x43, 0x75,
+0x2A, 0x6C, 0x75, 0x2B, 0x5C, 0x43, 0x19, 0xC8, 0x00, 0x0E, 0x71, 0x5F, 0x58, 0x00, 0xC1, 0x74,
+0x8C, 0x00, 0xC8, 0x98, 0x8C, 0x98, 0x74, 0x98, 0xAD, 0x18, 0xDA, 0x00, 0x10, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x00, 0x52, 0x40, 0x02, 0x44, 0x48, 0xC9, 0x44, 0x49, 0x27,
+0x1C, 0x02, 0x04, 0x0E, 0x04, 0x01, 0x00, 0x05, 0x42, 0x03, 0x4A, 0x48, 0x4A, 0x42, 0x4A, 0x44,
+0x42, 0x67, 0x40, 0x00, 0xCF, 0x4F, 0xB0, 0x34, 0x65, 0x6B, 0x12, 0x0B, 0x7C, 0x7A, 0x34, 0x11,
+0x2F, 0x59, 0x51, 0x29, 0x16, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C,
+0x56, 0x00, 0x5C, 0x56, 0x00, 0x5C, 0x56, 0x5C, 0x56, 0x42, 0x56, 0x5C, 0x56, 0xCC, 0x8A, 0x16,
+0x02, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x8A, 0x02, 0x8A, 0x16, 0x29, 0x00, 0xCA, 0x51, 0x0C, 0x77,
+0x35, 0x98, 0xB0, 0x11, 0x3B, 0xD4, 0x6B, 0xAF, 0x00, 0xC3, 0x7A, 0x65, 0x9D, 0x00, 0x02, 0x45,
+0x44, 0x4A, 0x00, 0x48, 0x43, 0x63, 0x48, 0x42, 0x02, 0x41, 0x40, 0x28, 0x62, 0xC0, 0x40, 0x00,
+0x44, 0x66, 0xCC, 0x90, 0x54, 0x58, 0x37, 0x30, 0x58, 0x49, 0x5A, 0x3F, 0x40, 0x22, 0x0F, 0x00,
+0x10, 0x58, 0x00, 0xC3, 0x98, 0x8E, 0x74, 0x98, 0x00, 0xC5, 0x8C, 0x98, 0xAE, 0x98, 0x8E, 0x18,
+0x00, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC4, 0xB2, 0x07, 0x0D, 0x81, 0x87, 0x00,
+0xC1, 0x7F, 0x45, 0x00, 0xD6, 0xC2, 0x61, 0x55, 0x61, 0x87, 0x7F, 0x38, 0x55, 0x61, 0x4E, 0x46,
+0xC3, 0xBB, 0x87, 0xED, 0x4D, 0xA9, 0x39, 0x0D, 0x07, 0x2E, 0x81, 0x00, 0x12, 0x42, 0x4E, 0x44,
+0x45, 0x00, 0x48, 0x4A, 0x42, 0x00, 0x48, 0x00, 0x40, 0x08, 0x48, 0x43, 0x48, 0x42, 0x41, 0x43,
+0x40, 0x02, 0x41, 0x43, 0x41, 0x43, 0x00, 0x44, 0x40, 0x04, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x02, 0x65, 0x68, 0x42, 0x65,
+0x71, 0x41, 0x00, 0x40, 0x41, 0x42, 0x41, 0x45, 0x42, 0x00, 0x45, 0x4F, 0x61, 0x40, 0x41, 0x42,
+0x40, 0x02, 0x41, 0x40, 0x01, 0x45, 0x00, 0x40, 0x41, 0x00, 0x42, 0x45, 0x41, 0x61, 0x45, 0x40,
+0x67, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x6D, 0xC2, 0x9F, 0x43, 0x5F, 0x01, 0xC1, 0x43, 0x5F,
+0x00, 0x59, 0x00, 0xC1, 0xC8, 0x00, 0x0C, 0x52, 0x40, 0x71, 0x5F, 0x58, 0x00, 0xC3, 0xE5, 0x18,
+0x8E, 0x18, 0x00, 0xC0, 0x8E, 0x00, 0xC1, 0x8C, 0x18, 0x00, 0xC1, 0xDA, 0x00, 0x0F, 0x41, 0x00,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x45, 0x42, 0x41, 0x40, 0x4B, 0x41, 0x00, 0x42,
+0x45, 0x40, 0x05, 0x41, 0x42, 0x04, 0x43, 0x42, 0x03, 0x41, 0x52, 0x40, 0x65, 0xC9, 0xB0, 0x9C,
+0x4C, 0xD8, 0xE9, 0x7C, 0x7A, 0x4C, 0x3B, 0x11, 0x00, 0x66, 0xDF, 0x51, 0x02, 0x16, 0x29, 0x16,
+0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x02, 0x1C, 0x16, 0x29,
+0x1C, 0x16, 0x8A, 0x16, 0x29, 0x1C, 0x16, 0x02, 0x8A, 0x1C, 0x29, 0x56, 0x69, 0x5C, 0x56, 0x69,
+0x56, 0x69, 0x5C, 0x69, 0xC9, 0x6D, 0xEB, 0xB5, 0x68, 0x0E, 0xB0, 0x2F, 0x4A, 0x50, 0xD8, 0x00,
+0xC6, 0x7C, 0xD4, 0x76, 0x63, 0x00, 0x12, 0x00, 0x00, 0x45, 0x42, 0x44, 0x43, 0x42, 0x06, 0x41,
+0x40, 0x28, 0x4F, 0xC1, 0x40, 0x22, 0x01, 0x5E, 0xCB, 0x90, 0x3F, 0x0F, 0x90, 0x22, 0x3F, 0x17,
+0x1E, 0x22, 0x40, 0x1E, 0x00, 0x10, 0xC3, 0xAE, 0x18, 0xE5, 0x18, 0x00, 0xCA, 0x8C, 0x8E, 0x18,
+0xEA, 0x18, 0xE5, 0x8E, 0x18, 0xAE, 0x31, 0x00, 0x0E, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x00,
+0x4D, 0xC5, 0x4B, 0x46, 0x45, 0x4B, 0x38, 0x45, 0x00, 0xC6, 0xC6, 0x38, 0x45, 0x38, 0x46, 0x79,
+0x45, 0x00, 0x47, 0xC8, 0x4B, 0x45, 0x46, 0x45, 0x38, 0x45, 0x4B, 0x0D, 0x07, 0x00, 0xC2, 0x81,
+0x12, 0x00, 0x11, 0x41, 0x45, 0x42, 0x41, 0x00, 0x45, 0x01, 0x41, 0x42, 0x40, 0x09, 0x41, 0x42,
+0x45, 0x40, 0x00, 0x41, 0x45, 0x42, 0x01, 0x40, 0x41, 0x40, 0x41, 0x42, 0x40, 0x05, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40, 0x18, 0x41, 0x40, 0x0D, 0x45, 0x44, 0x42,
+0x45, 0x40, 0x17, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x52, 0xC2, 0x9F, 0x19, 0x9F, 0x00, 0x59,
+0xC0, 0x9F, 0x00, 0xC4, 0xD1, 0x19, 0x43, 0xC8, 0x00, 0x0E, 0x71, 0x58, 0xC1, 0xAE, 0x18, 0x01,
+0xC0, 0xAE, 0x05, 0x58, 0x71, 0x40, 0x20, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0x45, 0x42, 0x61,
+0x68, 0x42, 0x45, 0x42, 0x45, 0x42, 0x02, 0x40, 0x4B, 0x40, 0x41, 0xDF, 0x58, 0x6C, 0x71, 0xD4,
+0x94, 0x7A, 0x65, 0x64, 0xA7, 0x2F, 0x32, 0x58, 0x03, 0x29, 0x16, 0x8A, 0x16, 0x1C, 0x16, 0x02,
+0x16, 0x1C, 0x16, 0x02, 0x16, 0x1C, 0x16, 0x02, 0x8A, 0x16, 0x29, 0x1C, 0x56, 0x69, 0x56, 0x5C,
+0x56, 0x69, 0x56, 0x5C, 0x69, 0x56, 0x00, 0xC8, 0x8A, 0x02, 0x16, 0x1C, 0x29, 0x1C, 0x29, 0x1C,
+0x29, 0x00, 0xCA, 0x6D, 0x0C, 0x04, 0x28, 0x74, 0x58, 0xA7, 0x93, 0x3E, 0x52, 0x9D, 0x00, 0xC3,
+0x52, 0x6C, 0x63, 0x00, 0x02, 0x41, 0x42, 0x00, 0x45, 0x01, 0x42, 0x45, 0x42, 0x45, 0x42, 0x00,
+0x41, 0x40, 0x28, 0x5E, 0x00, 0xC1, 0x40, 0x1E, 0x00, 0x4F, 0x5E, 0x09, 0x40, 0x10, 0xC0, 0xAE,
+0x00, 0x58, 0xC2, 0xAE, 0x18, 0xAE, 0x00, 0x58, 0xC0, 0xAE, 0x02, 0x58, 0xC1, 0xAE, 0x00, 0x0F,
+0x41, 0x40, 0x07, 0xC2, 0xD6, 0x0D, 0x07, 0x02, 0x4D, 0x47, 0x02, 0x4D, 0x47, 0x01, 0x4D, 0x01,
+0x47, 0x4D, 0x00, 0x47, 0x05, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x2C, 0x45, 0x44, 0x42, 0x45,
+0x40, 0x0A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x44, 0x2A, 0x42, 0x44, 0x42, 0x44,
+0xE0, 0x03, 0x51, 0xCB, 0x75, 0x5C, 0x75, 0x5C, 0x75, 0x5C, 0x11, 0x75, 0x5C, 0x84, 0x1C, 0x04,
+0x0E, 0xC1, 0x96, 0xAD, 0x00, 0xC4, 0x96, 0xAD, 0x96, 0xAD, 0x96, 0x00, 0xC2, 0xAD, 0x96, 0xAD,
+0x00, 0xC1, 0x96, 0x04, 0x3F, 0xC1, 0x89, 0x04, 0x0B, 0x48, 0x09, 0x43, 0x44, 0x01, 0x45, 0xC6,
+0x9A, 0x8F, 0x2F, 0x34, 0x86, 0x52, 0x4A, 0x00, 0xC3, 0xE1, 0xA7, 0x4A, 0x03, 0x00, 0x5C, 0xD4,
+0x8A, 0x1C, 0x16, 0x02, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x8A, 0x16, 0x1C, 0x16, 0x02,
+0x8A, 0x16, 0x29, 0x1C, 0x16, 0x00, 0x5C, 0x56, 0x42, 0xCC, 0x8A, 0x16, 0x02, 0x8A, 0x16, 0x02,
+0x8A, 0x16, 0x29, 0x16, 0x02, 0x16, 0x29, 0x00, 0xC4, 0x53, 0x0E, 0x47, 0x2D, 0x36, 0x01, 0xC3,
+0x5A, 0x84, 0x2F, 0x3B, 0x00, 0x51, 0xC3, 0x8F, 0xB0, 0x02, 0x04, 0x01, 0x43, 0x48, 0x09, 0x44,
+0x29, 0xCC, 0x60, 0x36, 0x60, 0x36, 0x60, 0x26, 0x36, 0x60, 0x26, 0x36, 0x60, 0x36, 0x60, 0x02,
+0x76, 0x44, 0x10, 0xC0, 0x96, 0x04, 0xC8, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x96, 0x04,
+0x19, 0xC3, 0x56, 0x7F, 0x6E, 0x7F, 0x00, 0xC1, 0x6E, 0x7F, 0x00, 0xC9, 0x6E, 0x7F, 0x6E, 0x7F,
+0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x00, 0xC7, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F,
+0x01, 0xC2, 0x6E, 0xAC, 0x04, 0x2D, 0x42, 0x00, 0x5C, 0x44, 0x22, 0x42, 0x41, 0x44, 0x42, 0x08,
+0x44, 0x42, 0x0D, 0x44, 0x42, 0x1A, 0xC2, 0x9D, 0x75, 0x2B, 0x00, 0xC1, 0x63, 0x02, 0x08, 0x7F,
+0xC3, 0x9A, 0xBF, 0xA8, 0xBF, 0x0B, 0xC1, 0x52, 0x46, 0x0B, 0xC1, 0x4D, 0x46, 0x04, 0xC1, 0x4D,
+0x46, 0x04, 0xC0, 0x5F, 0x08, 0xC1, 0xE3, 0x02, 0x10, 0x68, 0x42, 0x68, 0x42, 0x68, 0x42, 0x00,
+0x68, 0x42, 0x00, 0x68, 0x42, 0x11, 0x5C, 0x42, 0x0E, 0x44, 0x42, 0x2A, 0x43, 0x02, 0x48, 0x43,
+0x01, 0x48, 0x43, 0x00, 0x48, 0x42, 0x01, 0x4F, 0xC1, 0x59, 0x8F, 0x00, 0xC5, 0x5C, 0x2F, 0x11,
+0x2F, 0x54, 0x58, 0x00, 0x76, 0x44, 0xD2, 0x51, 0x8C, 0x16, 0x02, 0x9D, 0x1B, 0x16, 0x02, 0x8A,
+0x16, 0x29, 0x16, 0x02, 0x16, 0x8A, 0x8C, 0x16, 0xB8, 0x16, 0x00, 0x69, 0xC8, 0x8A, 0x16, 0x02,
+0x29, 0x8C, 0x16, 0x1C, 0x8A, 0x16, 0x00, 0xCC, 0x8A, 0x29, 0x8A, 0x16, 0x29, 0x16, 0x29, 0x8A,
+0x1C, 0x29, 0x70, 0x23, 0x01, 0x00, 0x44, 0x7F, 0xC9, 0xA7, 0x5A, 0x90, 0x54, 0x2F, 0x6C, 0x2F,
+0x8F, 0x59, 0x02, 0x02, 0x44, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x66, 0xC2,
+0x51, 0x70, 0x33, 0x07, 0xC1, 0x99, 0x33, 0x0C, 0x56, 0x42, 0x0F, 0x7F, 0x42, 0x0D, 0x44, 0x42,
+0x10, 0xC1, 0x8C, 0xAD, 0x00, 0xCB, 0x8C, 0xAD, 0x8C, 0xAD, 0x8C, 0xAD, 0x8C, 0xAD, 0x8C, 0xAD,
+0x8C, 0x02, 0x0E, 0x44, 0xC0, 0x5F, 0x00, 0xC3, 0x75, 0x5F, 0x75, 0x5F, 0x00, 0xC1, 0x75, 0x5F,
+0x00, 0xC1, 0xEC, 0x46, 0x1B, 0xC2, 0x52, 0x69, 0xBF, 0x01, 0xC1, 0xA8, 0xBF, 0x01, 0xC5, 0xA8,
+0xBF, 0xA8, 0xBF, 0xA8, 0xBF, 0x02, 0x76, 0x42, 0x2B, 0x44, 0x42, 0x07, 0x44, 0x42, 0x0B, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x08, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x0C, 0x6D,
+0xC3, 0x6C, 0x75, 0xB6, 0x00, 0x09, 0x52, 0xC1, 0xB3, 0x1D, 0x08, 0x6C, 0x5D, 0x6C, 0x5D, 0x6C,
+0xC1, 0xA1, 0x07, 0x08, 0x6E, 0x47, 0x0D, 0x6E, 0xC1, 0x9F, 0x19, 0x07, 0xC1, 0xC8, 0x00, 0x0E,
+0x71, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x67, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x18, 0x42, 0x0A, 0x40, 0x01, 0x41, 0xCE, 0xB0, 0xD1, 0x8F, 0x4A, 0x2F, 0x3B, 0x4A, 0x90, 0x26,
+0x2F, 0x5A, 0x30, 0x96, 0x02, 0x16, 0x00, 0x69, 0xC1, 0x8A, 0x29, 0x00, 0xC5, 0x8A, 0xB8, 0x8A,
+0x02, 0x29, 0x8A, 0x00, 0x69, 0x42, 0xC0, 0x8A, 0x00, 0xC2, 0x8C, 0x29, 0x8A, 0x01, 0x42, 0x69,
+0xC0, 0x8A, 0x00, 0x69, 0x01, 0xC1, 0x8A, 0x29, 0x00, 0xC0, 0x8A, 0x00, 0x69, 0xC1, 0xAA, 0x29,
+0x00, 0x61, 0x48, 0xC9, 0xCA, 0x0A, 0x02, 0x6D, 0x04, 0x3F, 0xA4, 0x58, 0x4A, 0x3B, 0x01, 0xC2,
+0x8F, 0x89, 0x00, 0x02, 0x45, 0x42, 0x08, 0x69, 0x5B, 0x49, 0x00, 0xC5, 0x41, 0x09, 0x41, 0x09,
+0x41, 0x15, 0x01, 0xCB, 0x41, 0x15, 0x41, 0x10, 0x41, 0x15, 0x41, 0x15, 0x1B, 0x09, 0x1B, 0x09,
+0x00, 0x5B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0xC1, 0xAE, 0x18, 0x0A, 0xC1,
+0xAE, 0x00, 0x0E, 0x6D, 0xC1, 0xD1, 0x19, 0x01, 0xC1, 0x43, 0x9F, 0x00, 0x59, 0x01, 0xC1, 0xE2,
+0x07, 0x09, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x0A, 0x4D, 0x47, 0xC8, 0xA1, 0x2C, 0x1D, 0x2C, 0x1D,
+0x2C, 0x1D, 0x2C, 0x1D, 0x02, 0x6C, 0x5D, 0x01, 0xC3, 0xFA, 0x2C, 0xE1, 0x00, 0x2B, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x06, 0x41,
+0x40, 0x00, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x05, 0x41, 0xC5, 0x9B, 0xC5, 0x00, 0x01, 0x31, 0x00,
+0x04, 0x41, 0x40, 0xC6, 0x47, 0x12, 0xB3, 0x2C, 0x3C, 0x1D, 0x3C, 0x00, 0x5D, 0x01, 0x6C, 0x00,
+0x5D, 0xC2, 0x57, 0x1D, 0x2C, 0x00, 0xC1, 0xA1, 0x07, 0x00, 0x4D, 0x47, 0x04, 0x78, 0xC1, 0xBA,
+0x07, 0x01, 0x4D, 0x6E, 0x4D, 0x78, 0x4D, 0x47, 0x05, 0xC2, 0x4B, 0x9F, 0x19, 0x00, 0xC3, 0x43,
+0x19, 0x9F, 0x43, 0x00, 0x59, 0xC2, 0x43, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x4B, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x16, 0x41, 0x42, 0x0A, 0x41, 0x40,
+0x00, 0x6D, 0xC4, 0x59, 0x8F, 0x9B, 0xC2, 0x34, 0x00, 0xC8, 0x4A, 0x3E, 0x9A, 0x89, 0x54, 0x0E,
+0x51, 0x02, 0x29, 0x00, 0x5C, 0x69, 0x48, 0x4E, 0x4A, 0xDF, 0x8A, 0x53, 0x64, 0x0E, 0x9D, 0x44,
+0x92, 0x0E, 0x51, 0x29, 0x92, 0x0E, 0x50, 0x29, 0x53, 0x0E, 0x92, 0x29, 0x50, 0x0E, 0x0A, 0x8A,
+0xB8, 0x0E, 0x8D, 0x50, 0x7C, 0x0A, 0x0E, 0x0A, 0x26, 0x02, 0x5C, 0x4A, 0xCD, 0x92, 0x21, 0x08,
+0x0A, 0xA7, 0x4A, 0x3B, 0x71, 0x44, 0x89, 0x59, 0x9B, 0x63, 0x00, 0x02, 0x45, 0x42, 0x09, 0x5B,
+0x49, 0x05, 0x55, 0x50, 0x55, 0x49, 0xC5, 0x7B, 0x09, 0x15, 0x09, 0x10, 0x09, 0x05, 0x50, 0xC1,
+0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x58, 0x01, 0xC3, 0x8E, 0x18, 0x8E, 0x18,
+0x02, 0xC1, 0xAE, 0x18, 0x00, 0xC2, 0xAE, 0x31, 0x00, 0x0D, 0x6D, 0xC1, 0xD1, 0x19, 0x01, 0xC0,
+0x43, 0x00, 0xC1, 0x9F, 0x19, 0x01, 0xC1, 0xE2, 0x07, 0x0A, 0x4D, 0x47, 0x01, 0x78, 0xC2, 0x79,
+0x0D, 0x07, 0x05, 0x6E, 0x47, 0x00, 0xC3, 0xA1, 0x1D, 0x2C, 0x1D, 0x00, 0x6C, 0x5D, 0x00, 0x6C,
+0x7C, 0x5D, 0xC2, 0x57, 0x3C, 0x1D, 0x00, 0x7C, 0x5D, 0x6C, 0xC2, 0xE1, 0x0B, 0x00, 0x06, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x05, 0x41, 0x40, 0x03, 0x41, 0x40, 0x00, 0x41, 0x40, 0x03, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41,
+0x4A, 0x43, 0x00, 0x42, 0x4A, 0x43, 0x40, 0x02, 0x48, 0x42, 0x00, 0x48, 0x00, 0x41, 0x40, 0x03,
+0x41, 0x4F, 0x40, 0x45, 0xD0, 0x70, 0x08, 0x21, 0x00, 0x01, 0x08, 0x05, 0x02, 0x0A, 0x26, 0x47,
+0x12, 0xB3, 0x57, 0x1D, 0x57, 0x91, 0x00, 0xCB, 0xBF, 0x3C, 0x7E, 0xBF, 0x69, 0x54, 0x91, 0x69,
+0x2C, 0x57, 0xA1, 0x07, 0x06, 0xCB, 0x46, 0x87, 0x39, 0x45, 0xCB, 0x45, 0xB9, 0x38, 0x39, 0x87,
+0x39, 0x0D, 0x00, 0x47, 0x03, 0x6E, 0xC6, 0x43, 0x19, 0x43, 0x75, 0x5F, 0xBC, 0x75, 0x00, 0xC0,
+0x43, 0x00, 0xC1, 0xD2, 0x00, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x67, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0x42, 0x03, 0x48, 0x4E, 0x43, 0x4A, 0x4E, 0x4A, 0x42, 0x41,
+0x40, 0x00, 0x41, 0xDF, 0x59, 0x6C, 0x34, 0x44, 0xB8, 0x7C, 0x44, 0x64, 0x2F, 0x4A, 0x5A, 0x0E,
+0x51, 0x02, 0x29, 0x03, 0x6D, 0xB7, 0x0A, 0x23, 0x0A, 0x7C, 0x63, 0x32, 0x3B, 0x4C, 0x1C, 0x23,
+0x4A, 0x51, 0x4F, 0x0E, 0x4C, 0x4A, 0xDF, 0x4F, 0x59, 0x32, 0x0E, 0x29, 0x1C, 0x23, 0x0E, 0x1C,
+0xE4, 0x0E, 0x0C, 0x50, 0x21, 0x0A, 0x23, 0x4A, 0x32, 0x4A, 0x21, 0x1C, 0x70, 0x29, 0x50, 0x0F,
+0x59, 0x11, 0x52, 0xB7, 0xAF, 0xD3, 0xB7, 0xC2, 0x52, 0x44, 0x00, 0x02, 0x45, 0x42, 0x4E, 0x4A,
+0x44, 0x4A, 0x4E, 0x44, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09, 0x04, 0x5A, 0xC9, 0x78, 0x1A, 0x78,
+0x1A, 0x78, 0x20, 0x66, 0xAB, 0x10, 0x09, 0x04, 0x50, 0xC2, 0x47, 0x12, 0x00, 0x0E, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x10, 0x58, 0xCB, 0xAE, 0x8C, 0x98, 0xCF, 0xAD, 0x74, 0x8C, 0x74, 0x8E, 0x92,
+0x8E, 0x18, 0x00, 0x40, 0x0E, 0x6D, 0xC1, 0xD1, 0x19, 0x00, 0xC4, 0x43, 0x75, 0x2A, 0xBC, 0x19,
+0x00, 0xC2, 0x43, 0xE2, 0x07, 0x09, 0xC8, 0x45, 0xBB, 0x38, 0x2E, 0x45, 0xA0, 0xD5, 0x45, 0x07,
+0x06, 0x4D, 0x47, 0xC8, 0xA1, 0x57, 0x3C, 0xC9, 0x3C, 0x69, 0x91, 0x69, 0x91, 0x00, 0xC0, 0xBF,
+0x00, 0x5D, 0xC1, 0x57, 0x91, 0x00, 0xC6, 0xBF, 0x2C, 0x40, 0x0B, 0x00, 0x12, 0x00, 0x00, 0x44,
+0x43, 0x40, 0x41, 0x43, 0x4E, 0x44, 0x40, 0x06, 0x42, 0x4A, 0x43, 0x42, 0x4A, 0x45, 0x00, 0x4A,
+0x45, 0x48, 0x00, 0x42, 0x40, 0x01, 0x44, 0x4A, 0x42, 0x00, 0x4A, 0x48, 0x40, 0x02, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41,
+0x4E, 0x44, 0x4A, 0x48, 0x45, 0x48, 0x5F, 0x4B, 0x40, 0x45, 0x4A, 0x44, 0x45, 0x41, 0x48, 0x42,
+0x40, 0x03, 0x52, 0x41, 0x40, 0x45, 0x5F, 0x43, 0x44, 0x40, 0x45, 0x4E, 0x42, 0xD0, 0xAA, 0x01,
+0x0A, 0x25, 0x12, 0xB3, 0x57, 0x1D, 0x91, 0x69, 0xB3, 0x91, 0x69, 0x91, 0x7E, 0xA8, 0x54, 0x00,
+0xC4, 0x7E, 0x1D, 0x57, 0xA1, 0x07, 0x00, 0x4D, 0x47, 0x03, 0xCC, 0x45, 0xDC, 0x61, 0x46, 0x4B,
+0x7F, 0x87, 0x45, 0x55, 0xDC, 0xBB, 0x38, 0x07, 0x04, 0x6E, 0xC6, 0x9F, 0x19, 0x5F, 0x2A, 0x6C,
+0x2A, 0x75, 0x00, 0xC3, 0x5F, 0x19, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x16, 0x41, 0x42, 0x03, 0x43, 0x4A, 0x00, 0x44,
+0x00, 0x4E, 0x42, 0x41, 0x40, 0x00, 0x6D, 0xDF, 0x59, 0x9B, 0x67, 0x6B, 0x0B, 0xC0, 0xE9, 0x50,
+0x3B, 0x4A, 0x5A, 0x0A, 0x51, 0x29, 0x1C, 0x23, 0x03, 0x2D, 0x5A, 0x23, 0x58, 0x6B, 0x1C, 0x11,
+0x0E, 0x21, 0x4F, 0x4A, 0x3B, 0x1C, 0xDA, 0x5A, 0x72, 0xCB, 0x6D, 0x0B, 0x63, 0x23, 0x86, 0x25,
+0x04, 0x4A, 0x0E, 0x3A, 0x4F, 0x4A, 0x00, 0xC4, 0xB8, 0xAF, 0x86, 0x32, 0x2F, 0x00, 0x72, 0xCF,
+0x59, 0x1C, 0x51, 0x29, 0x03, 0x05, 0x59, 0x3B, 0xD4, 0xC0, 0x47, 0x00, 0x6B, 0xCC, 0xB6, 0x00,
+0x02, 0x45, 0x42, 0x44, 0x4E, 0x43, 0x44, 0x4E, 0x43, 0x42, 0x02, 0x5B, 0x49, 0x02, 0xCF, 0x97,
+0x09, 0x10, 0x20, 0x10, 0xCF, 0x66, 0x92, 0x66, 0x78, 0x6D, 0x1A, 0x33, 0x09, 0x15, 0x09, 0x02,
+0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x58, 0x01, 0xC5, 0x8C, 0x98,
+0xAE, 0x8C, 0xCF, 0x8C, 0x00, 0xC2, 0xCF, 0xAA, 0x18, 0x00, 0x40, 0x0E, 0x4F, 0xC1, 0xD1, 0x19,
+0x01, 0x6A, 0xC6, 0x5F, 0x2B, 0x43, 0x19, 0x43, 0xE2, 0x07, 0x06, 0x4D, 0x47, 0xC9, 0x79, 0x7F,
+0xD5, 0x38, 0x45, 0x81, 0x55, 0x87, 0x79, 0x07, 0x06, 0xC8, 0xBA, 0x07, 0xA1, 0x2C, 0x1D, 0xC9,
+0xA8, 0xBF, 0x54, 0x00, 0x7C, 0xC3, 0x57, 0x69, 0x91, 0x3C, 0x00, 0xC0, 0x69, 0x00, 0xC4, 0x91,
+0x2C, 0xE1, 0x0B, 0x00, 0x01, 0x41, 0x4E, 0x43, 0x40, 0x00, 0x41, 0x48, 0x41, 0x40, 0x06, 0x42,
+0x4E, 0x42, 0x45, 0x4E, 0x44, 0x42, 0x4A, 0x48, 0x45, 0x41, 0x42, 0x40, 0x00, 0x45, 0x48, 0x45,
+0x48, 0x40, 0x43, 0x42, 0x40, 0x02, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41, 0x4A, 0x61, 0x4A, 0xCA, 0x49, 0x25, 0x08, 0x1F,
+0x0B, 0x12, 0x00, 0x02, 0x04, 0x00, 0x04, 0x00, 0x40, 0x03, 0x52, 0xC6, 0x47, 0x27, 0x31, 0x0B,
+0x1C, 0x03, 0x00, 0x01, 0x44, 0x42, 0x40, 0x43, 0x42, 0x40, 0x52, 0xC7, 0xB3, 0x2C, 0x1D, 0x91,
+0x69, 0xB3, 0x7E, 0x69, 0x00, 0xC0, 0xA8, 0x00, 0xC3, 0x91, 0x85, 0x91, 0x2C, 0x00, 0xC1, 0xA1,
+0x07, 0x06, 0x4D, 0xCB, 0x6E, 0x7F, 0x0D, 0x07, 0x81, 0x39, 0x45, 0xB1, 0xEC, 0x55, 0x0D, 0x07,
+0x04, 0x6E, 0x59, 0x00, 0xC2, 0x43, 0x5F, 0x2A, 0x00, 0xC5, 0x6C, 0x75, 0x5F, 0x43, 0xC8, 0x00,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x18, 0x42, 0x03, 0x44, 0xC7, 0x44, 0x0A, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x00, 0x00, 0x41, 0xCA,
+0xCE, 0xC7, 0xB8, 0x0B, 0x00, 0x47, 0xB7, 0xB6, 0x9B, 0x32, 0x0A, 0x00, 0xCF, 0x51, 0x02, 0x1C,
+0x23, 0x1C, 0x0B, 0x5A, 0xC9, 0x63, 0x0B, 0x3F, 0x4A, 0x54, 0x47, 0x01, 0x4A, 0x00, 0xDA, 0xAA,
+0x47, 0x5A, 0x32, 0x1C, 0x0B, 0x63, 0x11, 0x58, 0x0B, 0x04, 0x3B, 0x4A, 0x12, 0x01, 0x0E, 0x2F,
+0x29, 0x0B, 0x58, 0x3B, 0x2F, 0x6C, 0x2B, 0x71, 0x29, 0x8A, 0x00, 0xCC, 0x44, 0x16, 0x0A, 0x64,
+0x7C, 0xAF, 0x00, 0x31, 0x7C, 0x3D, 0xB8, 0x12, 0x00, 0x01, 0x45, 0x42, 0x44, 0x48, 0x4A, 0x42,
+0x48, 0x4A, 0x42, 0x02, 0x5B, 0xC1, 0x7B, 0x09, 0x03, 0xCC, 0x41, 0x10, 0x78, 0xA5, 0x66, 0x20,
+0xCF, 0x66, 0x20, 0x1A, 0x33, 0x1B, 0x09, 0x03, 0x50, 0xC2, 0x47, 0x12, 0x00, 0x0E, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x10, 0xCE, 0xAE, 0x8E, 0x18, 0xAD, 0x98, 0xAE, 0x96, 0xCF, 0x8C, 0x27, 0x70,
+0x8C, 0x18, 0xAE, 0x00, 0x0E, 0x6D, 0xC1, 0xD1, 0x19, 0x00, 0xC1, 0x43, 0x2A, 0x01, 0x59, 0xC3,
+0x9F, 0x19, 0xE2, 0x07, 0x06, 0x4D, 0x47, 0xC9, 0xBA, 0x81, 0xB9, 0xC6, 0x07, 0x0D, 0xB9, 0x55,
+0x0D, 0x07, 0x05, 0x6E, 0x4D, 0x47, 0xC5, 0xA1, 0x57, 0x3C, 0x54, 0x7E, 0x91, 0x01, 0x7C, 0x00,
+0xC2, 0x69, 0x91, 0x1D, 0x00, 0x7C, 0xC5, 0x7E, 0x3C, 0x1D, 0x40, 0x0B, 0x00, 0x01, 0x48, 0x4A,
+0x48, 0x40, 0x00, 0x44, 0x00, 0x40, 0x07, 0x44, 0x48, 0x45, 0x41, 0x48, 0x43, 0x48, 0x00, 0x4A,
+0x41, 0x40, 0x45, 0x40, 0x00, 0x41, 0x48, 0x41, 0x48, 0x41, 0x48, 0x41, 0x40, 0x02, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x04, 0x41,
+0x4E, 0x43, 0x00, 0x44, 0xC2, 0x53, 0x03, 0x00, 0x02, 0x42, 0x44, 0x00, 0x4E, 0x44, 0x45, 0x40,
+0x03, 0x41, 0x00, 0x40, 0x42, 0x4E, 0xCB, 0x44, 0x28, 0x05, 0x00, 0x04, 0x29, 0x08, 0x0A, 0x04,
+0x47, 0x2D, 0x1D, 0x00, 0x7C, 0xCB, 0x69, 0x91, 0x7E, 0x91, 0x3C, 0x69, 0x7E, 0xA8, 0x54, 0x7E,
+0xBF, 0x2C, 0x00, 0xC5, 0x67, 0x07, 0x0D, 0x2E, 0x0D, 0x07, 0x00, 0x4D, 0x47, 0xCB, 0x4D, 0xC2,
+0x7F, 0x55, 0x38, 0x0D, 0x39, 0x55, 0xBB, 0x87, 0x55, 0x79, 0x00, 0x47, 0x00, 0x4D, 0x47, 0x00,
+0xC1, 0x79, 0x43, 0x00, 0x59, 0xC3, 0x5F, 0x75, 0x43, 0x2B, 0x00, 0xC3, 0x43, 0x19, 0xD2, 0x00,
+0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40,
+0x16, 0x41, 0x42, 0x03, 0x4A, 0x01, 0x4E, 0x00, 0x66, 0x42, 0x41, 0x52, 0x40, 0x6D, 0xDB, 0x59,
+0xC7, 0x7A, 0xAF, 0x00, 0xC0, 0x7C, 0x9D, 0x64, 0x4A, 0x58, 0x70, 0x96, 0x29, 0xC5, 0x23, 0x50,
+0x4F, 0x86, 0x32, 0x53, 0x4F, 0x04, 0x11, 0x3E, 0x29, 0x05, 0x4A, 0x00, 0x5C, 0xCC, 0x4F, 0x5A,
+0x32, 0x50, 0x4F, 0x59, 0x32, 0x3E, 0x4F, 0x44, 0x2F, 0x0E, 0x05, 0x00, 0xC5, 0x4A, 0x3B, 0x1C,
+0x4F, 0x26, 0x4A, 0x00, 0x63, 0x51, 0x7E, 0xC1, 0x8A, 0x29, 0x00, 0xCB, 0x8A, 0x02, 0x86, 0x3B,
+0x65, 0xD8, 0xD3, 0xB7, 0x94, 0xCC, 0xB6, 0x00, 0x02, 0x45, 0x44, 0x4E, 0x4A, 0x48, 0x4A, 0x4E,
+0x43, 0x42, 0x00, 0xC4, 0xC5, 0x3F, 0x1B, 0x09, 0x97, 0x00, 0x49, 0x50, 0x55, 0x50, 0xCE, 0x66,
+0xCF, 0x6D, 0x66, 0x1A, 0x72, 0x33, 0xCF, 0x78, 0x7B, 0x09, 0x10, 0x09, 0x10, 0x09, 0x00, 0x50,
+0xC1, 0xAF, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0xC1, 0xDA, 0x18, 0x00, 0xC9, 0x8C,
+0x74, 0xE5, 0x98, 0x8C, 0x98, 0xAE, 0x74, 0x8C, 0x18, 0x00, 0x71, 0x40, 0x0D, 0xC5, 0xE8, 0xD1,
+0x43, 0x19, 0x43, 0x75, 0x01, 0xC4, 0x43, 0x9F, 0x5F, 0xE2, 0x07, 0x00, 0x4D, 0x47, 0x00, 0x4D,
+0x47, 0x02, 0x4D, 0xC8, 0xCB, 0x39, 0x4B, 0x45, 0x4B, 0x39, 0x38, 0x0D, 0x07, 0x00, 0x4D, 0x47,
+0x00, 0x4D, 0x6E, 0x4D, 0x47, 0xC6, 0x79, 0xF1, 0x3C, 0x57, 0x7E, 0x91, 0x7E, 0x00, 0xCC, 0xA8,
+0x91, 0xA7, 0xA8, 0x91, 0xA7, 0xA8, 0xC9, 0x7E, 0x69, 0x57, 0xE1, 0x0B, 0x00, 0x40, 0x00, 0x42,
+0x48, 0x00, 0x41, 0x00, 0x43, 0x45, 0x40, 0x07, 0x42, 0x4A, 0x44, 0x42, 0x43, 0x48, 0x43, 0x00,
+0x42, 0x48, 0x00, 0x44, 0x40, 0x01, 0x43, 0xC4, 0x53, 0x04, 0x02, 0x04, 0x00, 0x03, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x05, 0x45,
+0x00, 0x41, 0x40, 0x45, 0x67, 0x42, 0x44, 0x00, 0x41, 0x40, 0x41, 0x00, 0x45, 0x00, 0x41, 0x40,
+0x03, 0x41, 0x40, 0x00, 0x41, 0x45, 0x00, 0x41, 0x6D, 0x40, 0x41, 0x40, 0x5F, 0x45, 0x62, 0x4B,
+0x52, 0xC2, 0xB3, 0x57, 0x1D, 0x00, 0xC0, 0x57, 0x00, 0x5D, 0x03, 0xC0, 0x69, 0x00, 0x5D, 0x6C,
+0x00, 0xC3, 0xA1, 0x07, 0xBA, 0x07, 0x01, 0xC1, 0xBA, 0x07, 0x00, 0xC3, 0xBA, 0x38, 0x45, 0x4B,
+0x00, 0x4D, 0xC6, 0x4B, 0x2E, 0xC6, 0x46, 0xC6, 0x4B, 0x07, 0x04, 0xC2, 0x4B, 0x9F, 0x19, 0x03,
+0xC0, 0x43, 0x00, 0x59, 0x00, 0xC2, 0xF0, 0x12, 0x00, 0x0D, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F,
+0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0x42, 0x04, 0x44, 0x42, 0x44, 0x01,
+0x42, 0x41, 0x40, 0x00, 0xDF, 0xAF, 0xCE, 0xF0, 0x4C, 0x7C, 0x6B, 0x7C, 0x65, 0x67, 0x3B, 0x2F,
+0x59, 0x04, 0x44, 0x29, 0x89, 0x4A, 0x63, 0x4F, 0x3E, 0x11, 0x86, 0xDA, 0x89, 0x2F, 0x3E, 0x4F,
+0x21, 0x3E, 0x2F, 0x1C, 0x4F, 0x7E, 0x6F, 0xD3, 0x44, 0xDA, 0x63, 0x2F, 0x86, 0x4F, 0x21, 0x4A,
+0x3E, 0x4F, 0x21, 0x3E, 0x4A, 0x02, 0x4F, 0x59, 0xA7, 0xF1, 0x89, 0x59, 0x00, 0x69, 0xC0, 0x8A,
+0x00, 0x69, 0xCA, 0xAF, 0x63, 0x6C, 0x5E, 0x7C, 0xD8, 0x7C, 0xF5, 0x14, 0x89, 0x00, 0x02, 0x45,
+0x42, 0x00, 0x44, 0x42, 0x00, 0x44, 0x42, 0x03, 0x5B, 0x50, 0xC0, 0x97, 0x00, 0x49, 0x00, 0x55,
+0x50, 0xC9, 0x7B, 0x20, 0xA5, 0x10, 0x20, 0x7B, 0x1B, 0x20, 0x7B, 0x09, 0x05, 0x50, 0xC1, 0xAF,
+0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x58, 0x01, 0xC6, 0xE5, 0x8E, 0x18, 0x8E, 0x18,
+0xEA, 0x18, 0x03, 0x40, 0x52, 0x40, 0x0C, 0xC2, 0xE8, 0x43, 0x19, 0x01, 0xC2, 0x43, 0x5F, 0x19,
+0x00, 0xC4, 0x9F, 0x19, 0xE2, 0xBA, 0x07, 0x07, 0x4D, 0x00, 0xC7, 0x4B, 0x0D, 0x4B, 0x0D, 0x4B,
+0x07, 0x2E, 0x07, 0x05, 0xC9, 0xCB, 0x07, 0x79, 0xF1, 0x57, 0x1D, 0x3C, 0x1D, 0x3C, 0x1D, 0x00,
+0xC5, 0x69, 0x57, 0x3C, 0x57, 0x69, 0x57, 0x00, 0xC6, 0x69, 0x57, 0x2C, 0xE1, 0x00, 0x0B, 0x00,
+0x02, 0x41, 0x02, 0x40, 0x08, 0x41, 0x45, 0x42, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x45, 0x00,
+0x41, 0x42, 0x44, 0x42, 0x41, 0x45, 0x40, 0x67, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0B, 0x45, 0x42, 0x00, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0B, 0x52, 0xC2, 0xB3, 0x1D, 0x2C, 0x00, 0x5D, 0x00, 0x6C, 0x5D, 0x6C,
+0x5D, 0x03, 0x6C, 0x5D, 0xC1, 0xA1, 0x07, 0x05, 0x4D, 0x47, 0x02, 0x4D, 0x47, 0x4D, 0x47, 0x4D,
+0x47, 0x01, 0x4D, 0x47, 0x03, 0x6E, 0xC1, 0x9F, 0x19, 0x07, 0xC1, 0xD2, 0x00, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0x45, 0x42, 0x01,
+0x45, 0x42, 0x02, 0x45, 0x42, 0x00, 0x40, 0x01, 0x6D, 0xC4, 0xCE, 0xF0, 0xD0, 0xD4, 0x94, 0x00,
+0xDF, 0xB6, 0xC7, 0xD1, 0xE3, 0x21, 0x25, 0x16, 0x25, 0x89, 0x3E, 0xBD, 0x47, 0x36, 0x84, 0x89,
+0x47, 0xC5, 0xE3, 0x59, 0x4F, 0x21, 0xB0, 0xC7, 0x4F, 0x2D, 0xCE, 0xC7, 0x25, 0x01, 0xC5, 0x84,
+0x89, 0x6D, 0x7A, 0xD4, 0x84, 0x63, 0xAF, 0x3A, 0x52, 0xB0, 0x25, 0x2D, 0xCE, 0xD2, 0xB0, 0xC8,
+0xD2, 0xCE, 0xE7, 0x1C, 0xE4, 0xE7, 0x3A, 0x95, 0xF0, 0x00, 0x54, 0xC5, 0xB6, 0xF1, 0x14, 0xF0,
+0xC5, 0x00, 0x02, 0x41, 0x42, 0x00, 0x45, 0x42, 0x01, 0x45, 0x42, 0x01, 0x68, 0x5B, 0x49, 0x00,
+0x5B, 0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x55, 0x00, 0x5B, 0x55, 0x49, 0x55, 0x5B, 0x49, 0x5B,
+0x55, 0x49, 0x55, 0x00, 0x5B, 0x56, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10,
+0xC3, 0xAE, 0x18, 0xAE, 0x18, 0x07, 0xC0, 0xAE, 0x00, 0x40, 0x0E, 0xC3, 0xD9, 0xD1, 0x19, 0x9F,
+0x00, 0x59, 0xC7, 0x9F, 0x19, 0x9F, 0x19, 0x5F, 0xE2, 0x0D, 0x07, 0x0A, 0x4D, 0x47, 0x00, 0x4D,
+0x00, 0x47, 0x06, 0x4D, 0x47, 0x00, 0xC5, 0xA1, 0x1D, 0x2C, 0x1D, 0x2C, 0x1D, 0x00, 0x6C, 0x5D,
+0x07, 0x6C, 0xC1, 0xE1, 0x00, 0x1D, 0x41, 0x42, 0x00, 0x45, 0x40, 0x08, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x43, 0x44, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x43, 0x00,
+0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x01, 0x43, 0x44,
+0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x00, 0x43, 0x44, 0x03, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0xC2, 0x96, 0x63, 0x85, 0x02, 0xC1, 0xA8, 0x85, 0x00, 0xC1,
+0xA8, 0x85, 0x05, 0xC6, 0x7E, 0x53, 0x4E, 0x6E, 0x4E, 0x6E, 0x4E, 0x00, 0xC3, 0x6E, 0x4E, 0x6E,
+0x4E, 0x01, 0xC1, 0x6E, 0x4E, 0x00, 0xC3, 0x6E, 0x4E, 0x6E, 0x4E, 0x01, 0xC1, 0x6E, 0x4E, 0x00,
+0xC4, 0x6E, 0x4E, 0xA0, 0x6C, 0x11, 0x00, 0xC1, 0x6C, 0x11, 0x00, 0xC5, 0x6C, 0x5C, 0x6C, 0x11,
+0x84, 0x04, 0x00, 0xCF, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04,
+0x51, 0x04, 0x03, 0x04, 0x00, 0xC2, 0x44, 0x03, 0x04, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x01,
+0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43,
+0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 0xC2, 0x44, 0x03, 0x04, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44,
+0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00,
+0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x01, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43,
+0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44,
+0x4A, 0x48, 0x01, 0x4A, 0x48, 0x05, 0x43, 0x44, 0xC3, 0x51, 0x05, 0xF3, 0xF0, 0x00, 0xC3, 0xC7,
+0x14, 0xD0, 0xF0, 0x00, 0xC0, 0xC8, 0x00, 0xC4, 0xCE, 0x95, 0xC8, 0xCE, 0xD2, 0x00, 0xDE, 0xB6,
+0x25, 0x67, 0xE3, 0xC5, 0x6B, 0xBD, 0xC7, 0x95, 0x6B, 0xB7, 0xB0, 0xCE, 0x1F, 0x25, 0xCE, 0xC7,
+0x21, 0x25, 0xC5, 0xC7, 0xC5, 0x3A, 0xB6, 0xC7, 0x67, 0x4F, 0xB7, 0x59, 0xB0, 0x25, 0x00, 0xC3,
+0x89, 0xC7, 0xD2, 0xC8, 0x00, 0xC6, 0xD2, 0xB0, 0xCE, 0xB0, 0xCE, 0xB0, 0xC8, 0x01, 0xC4, 0xF0,
+0xC8, 0xC7, 0xC8, 0xCE, 0x00, 0xC4, 0x60, 0x96, 0x44, 0x04, 0x08, 0x01, 0xC1, 0x53, 0x08, 0x06,
+0xC7, 0x70, 0x1A, 0x70, 0x1A, 0x70, 0x1A, 0x70, 0x1A, 0x00, 0xC1, 0x70, 0x1A, 0x02, 0xC1, 0x70,
+0x1A, 0x00, 0xC6, 0x70, 0x1A, 0x70, 0x1A, 0x70, 0x1A, 0x70, 0x00, 0xC4, 0x51, 0x04, 0x36, 0x03,
+0x04, 0x00, 0xCD, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x51, 0x04, 0x36, 0x03,
+0x04, 0x00, 0xCB, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x00,
+0x43, 0x44, 0xC2, 0x44, 0x03, 0x04, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00,
+0x43, 0x44, 0x00, 0x43, 0xC0, 0x74, 0x08, 0xC1, 0x96, 0x74, 0x00, 0x43, 0x44, 0xC3, 0x63, 0x04,
+0x03, 0x04, 0x00, 0xCD, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x51, 0x36, 0x04, 0x03, 0x63, 0x2F,
+0x11, 0x5C, 0x00, 0xC7, 0x6C, 0x5C, 0x11, 0x6C, 0x11, 0x6C, 0x34, 0x4E, 0x00, 0xC1, 0x6E, 0x4E,
+0x00, 0xC1, 0x6E, 0x4E, 0x00, 0xC1, 0x6E, 0x4E, 0x01, 0xC7, 0x6E, 0x4E, 0x6E, 0x4E, 0x6E, 0x4E,
+0x6E, 0x4E, 0x00, 0xC1, 0x6E, 0x4E, 0x00, 0xC1, 0x6E, 0x4E, 0x00, 0xC0, 0x6E, 0x00, 0xC2, 0x86,
+0x5A, 0x85, 0x05, 0xC1, 0xA8, 0x85, 0x02, 0xC1, 0x7E, 0x85, 0x00, 0xC2, 0xA8, 0x26, 0x44, 0x00,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0xC2, 0x44, 0x03, 0x04, 0x00, 0x43, 0x44,
+0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x02,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 0xC2, 0x44, 0x03,
+0x04, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00, 0x43, 0x44, 0x00,
+0x43, 0x44, 0x42, 0x41, 0x44, 0x45, 0x61, 0x42, 0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x00,
+0x61, 0x42, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x61, 0x68, 0x61, 0x42, 0x03, 0x45,
+0x42, 0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x00, 0x42, 0x45, 0x42, 0x45,
+0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x01, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42,
+0x45, 0x42, 0x45, 0x42, 0x61, 0xCD, 0xAA, 0x29, 0x02, 0xBD, 0x05, 0x90, 0x21, 0x05, 0xBD, 0x05,
+0x02, 0x05, 0x21, 0x90, 0x02, 0x61, 0x62, 0x42, 0x69, 0x45, 0x62, 0xC1, 0xAA, 0x05, 0x01, 0xC2,
+0xAA, 0x05, 0xAA, 0x00, 0x62, 0x45, 0xC1, 0xAA, 0x05, 0x0B, 0x42, 0x7A, 0x45, 0x01, 0x7A, 0x45,
+0x61, 0x01, 0x42, 0x69, 0x42, 0x45, 0x69, 0x68, 0x61, 0xCA, 0xAA, 0x02, 0x05, 0x29, 0x28, 0x21,
+0x28, 0x21, 0x28, 0x21, 0x02, 0x01, 0x68, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x04,
+0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x01,
+0x45, 0x42, 0x68, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x03, 0x45,
+0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x03, 0x45,
+0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42,
+0x00, 0x45, 0x42, 0x45, 0x42, 0x01, 0x45, 0x02, 0x68, 0x45, 0x01, 0x69, 0x45, 0x42, 0x00, 0x45,
+0xC4, 0xAA, 0x01, 0xC5, 0x95, 0xCE, 0x00, 0xC1, 0xC8, 0xCE, 0x00, 0xC1, 0xF3, 0x95, 0x00, 0xC1,
+0xC8, 0x95, 0x03, 0xC0, 0xB7, 0x00, 0xC9, 0xBD, 0x67, 0x3A, 0xB7, 0x3A, 0xC5, 0x3A, 0x4F, 0x25,
+0xC5, 0x00, 0x65, 0x00, 0xC0, 0xC5, 0x00, 0x61, 0xC3, 0xB7, 0xE7, 0xC5, 0xE7, 0x00, 0x7A, 0xD7,
+0xEF, 0x21, 0x25, 0x3A, 0xC5, 0x3A, 0x25, 0x0F, 0x3A, 0xEF, 0xE7, 0x3A, 0xF7, 0x3A, 0xEF, 0xF7,
+0x93, 0xBD, 0xF7, 0xEF, 0x3A, 0xE8, 0x3A, 0x93, 0x00, 0xC0, 0xF7, 0x00, 0xC3, 0x90, 0x05, 0x29,
+0x02, 0x01, 0x61, 0x68, 0x45, 0x68, 0x61, 0x45, 0x68, 0x61, 0x45, 0x68, 0xC6, 0xBD, 0x29, 0x21,
+0x29, 0x05, 0xAA, 0x21, 0x01, 0x45, 0x61, 0x00, 0x45, 0x01, 0x61, 0x45, 0x61, 0x69, 0x61, 0x69,
+0x61, 0x69, 0x61, 0x69, 0x42, 0x00, 0x45, 0x69, 0x45, 0x42, 0x68, 0x61, 0xCA, 0xAA, 0x02, 0x05,
+0x29, 0x28, 0x21, 0xAA, 0x02, 0x05, 0x29, 0x02, 0x00, 0x61, 0x68, 0x61, 0xCA, 0xAA, 0x02, 0x05,
+0x29, 0x28, 0x21, 0xAA, 0x02, 0x05, 0x29, 0x02, 0x02, 0x68, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00,
+0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x42, 0x45, 0x0A, 0x42, 0x69, 0x42,
+0x61, 0x69, 0x68, 0x42, 0x45, 0x69, 0x68, 0x61, 0xC8, 0xAA, 0x02, 0x05, 0x02, 0x21, 0xAA, 0x21,
+0x02, 0x21, 0x00, 0x7A, 0x61, 0x00, 0x7A, 0x61, 0x01, 0xC2, 0xBD, 0x21, 0x05, 0x02, 0x62, 0x61,
+0x62, 0x45, 0x00, 0x61, 0x45, 0x61, 0x45, 0x01, 0x61, 0x45, 0x07, 0x61, 0x45, 0x00, 0x42, 0x62,
+0x45, 0xCA, 0x90, 0x05, 0x90, 0x21, 0x90, 0x05, 0x29, 0x90, 0x05, 0x90, 0x05, 0x01, 0xC2, 0xAA,
+0x90, 0x02, 0x00, 0x61, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45,
+0x42, 0x01, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42,
+0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x02, 0x68,
+0x45, 0x42, 0x61, 0x68, 0x61, 0x42, 0x01, 0x45, 0x42, 0x00, 0x45, 0x42, 0x61, 0x68, 0x61, 0x42,
+0x01, 0x45, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x67,
+0x40, 0x0D, 0x41, 0x40, 0x00, 0x4B, 0x40, 0x09, 0x4B, 0x40, 0x03, 0x4B, 0x40, 0x04, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0E, 0x67, 0x4B, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x18, 0x41, 0x40, 0x08, 0x41, 0x40, 0x03, 0x52, 0xC1, 0xD9, 0x12, 0x05, 0x40,
+0x00, 0x52, 0x4B, 0x52, 0x40, 0x4B, 0x52, 0x6D, 0x52, 0x40, 0x4B, 0x6D, 0x4B, 0x6D, 0xC6, 0x47,
+0x0B, 0x01, 0x00, 0xC0, 0x0B, 0x00, 0x00, 0x6D, 0x40, 0x00, 0x52, 0x00, 0x40, 0x00, 0x4B, 0x00,
+0x40, 0x4B, 0x40, 0x4B, 0x00, 0x40, 0x03, 0x6D, 0x40, 0x01, 0x4B, 0x40, 0x06, 0x4B, 0x6D, 0x4B,
+0x40, 0x02, 0x41, 0x40, 0x09, 0x41, 0x40, 0x03, 0x52, 0x40, 0x0F, 0x71, 0x6D, 0x40, 0x0F, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x00, 0x4B, 0x40, 0x04, 0x52, 0x40, 0x00, 0x41, 0x6D,
+0x40, 0x0E, 0x41, 0x40, 0x05, 0x4B, 0x6D, 0x41, 0x40, 0x1B, 0x41, 0x4B, 0x40, 0x0E, 0x41, 0x40,
+0x52, 0x40, 0x0B, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x4B, 0x00,
+0x40, 0x05, 0x52, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41,
+0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x17, 0x41, 0x40, 0x08, 0x52,
+0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x71, 0x40, 0x0F,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x4B, 0x40, 0x0D, 0x6D, 0x41, 0x40,
+0x03, 0x52, 0x40, 0x01, 0x65, 0x52, 0x40, 0x09, 0x4B, 0x40, 0x52, 0x40, 0x4B, 0x52, 0x40, 0x09,
+0x65, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x41, 0x00, 0x40, 0x08,
+0x41, 0xC1, 0x47, 0x00, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x17, 0x41, 0x40, 0x08, 0x52,
+0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40,
+0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B,
+0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x41, 0x00, 0x40,
+0x08, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40, 0x10,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x17, 0x41, 0x40, 0x08, 0xC2, 0x47,
+0x01, 0x00, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40,
+0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B,
+0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x41, 0x00, 0x40,
+0x08, 0x41, 0x52, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x20, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x18, 0x41, 0x40, 0x09, 0xC1, 0x47, 0x00, 0x1C, 0x41, 0x40, 0x2A, 0x41,
+0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E,
+0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x43, 0xE1, 0xFB, 0x42, 0x41,
+0x42, 0x45, 0x18, 0x42, 0x45, 0x1A, 0x42, 0x45, 0x1D, 0x42, 0x45, 0x23, 0x42, 0x45, 0x1C, 0x42,
+0x45, 0x0F, 0x42, 0x45, 0x0E, 0x42, 0x45, 0xE0, 0x15, 0x42, 0x45, 0x2A, 0x42, 0x45, 0x09, 0x42,
+0x45, 0x15, 0x42, 0x45, 0x20, 0x42, 0x45, 0x10, 0x42, 0x45, 0x0A, 0x42, 0x45, 0x19, 0x42, 0x45,
+0x1B, 0x42, 0x45, 0x0F, 0x42, 0x45, 0x0D, 0x42, 0x45, 0x1B, 0x42, 0x45, 0x07, 0x42, 0x45, 0x09,
+0x42, 0x45, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x41, 0x00, 0x40, 0x08, 0x41, 0x40,
+0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x28, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x0F, 0x41, 0x00, 0x40, 0x17, 0x41, 0x40, 0x08, 0x41, 0x00, 0x40, 0x11, 0x41, 0x40, 0x08,
+0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x41, 0x00, 0x40, 0x08, 0x41, 0x40, 0x42, 0x48,
+0x44, 0x42, 0x48, 0x00, 0x42, 0x00, 0x41, 0x43, 0x48, 0x44, 0x4B, 0x40, 0x43, 0x4A, 0x43, 0x42,
+0x45, 0x40, 0x41, 0x40, 0x41, 0x00, 0x40, 0x04, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40,
+0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x4B, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x41, 0x40, 0x0F, 0x6D, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F,
+0x41, 0x6D, 0x40, 0x52, 0x40, 0x15, 0x41, 0x40, 0x08, 0x41, 0x40, 0x4A, 0x44, 0x02, 0x41, 0x4A,
+0x48, 0x66, 0xCA, 0x96, 0x00, 0x08, 0x02, 0x00, 0x0A, 0x05, 0x44, 0x08, 0x03, 0x0A, 0x00, 0x42,
+0xC3, 0x53, 0x03, 0x01, 0x00, 0x03, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41,
+0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x4B, 0x40, 0x05, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x4F, 0x40, 0x6D, 0x40, 0x52, 0x4B,
+0x52, 0x00, 0x6D, 0x52, 0x65, 0x40, 0x0E, 0x41, 0x40, 0x09, 0x4B, 0x00, 0x41, 0x40, 0x0F, 0x41,
+0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x52, 0x40, 0x02, 0x4B, 0x52, 0x40, 0x4B, 0x40, 0x00,
+0x4B, 0x52, 0x40, 0x4B, 0x40, 0x00, 0x4B, 0x52, 0x40, 0x02, 0x52, 0x00, 0x67, 0x41, 0x40, 0x08,
+0x41, 0x40, 0x45, 0x43, 0x48, 0x44, 0x5C, 0x40, 0x70, 0x48, 0x4A, 0x42, 0x40, 0x44, 0xC2, 0x60,
+0x00, 0x0A, 0x00, 0x43, 0x44, 0x48, 0x00, 0x5C, 0x48, 0x00, 0xC2, 0x58, 0x0F, 0x00, 0x03, 0x41,
+0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x52, 0x40, 0x00, 0x71, 0x40, 0x00, 0x4B, 0x52, 0x40, 0x4B,
+0x40, 0x00, 0x4B, 0x52, 0x40, 0x4B, 0x40, 0x00, 0x4B, 0x52, 0x40, 0x01, 0x41, 0x71, 0x40, 0x0F,
+0x41, 0x40, 0x02, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0x52, 0x41, 0x52, 0x00, 0x40, 0x6D, 0x40, 0x52, 0x6D,
+0x52, 0x6D, 0x4F, 0x4B, 0x40, 0x1A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40,
+0x4B, 0x40, 0x03, 0x71, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x52, 0x40, 0x41, 0xC2, 0x47, 0x31,
+0x00, 0x15, 0x4B, 0x41, 0x40, 0x08, 0x41, 0x00, 0x43, 0x44, 0x48, 0x01, 0x44, 0xD3, 0x74, 0x03,
+0x02, 0x30, 0x02, 0x0A, 0x1F, 0x00, 0x0A, 0x05, 0x00, 0x02, 0x70, 0x03, 0x16, 0x08, 0x04, 0x3E,
+0x22, 0x00, 0x03, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x52, 0x40, 0x13, 0x6D, 0xC2,
+0x47, 0x00, 0x12, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0C, 0x4B, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x5F, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41,
+0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x07, 0x41, 0x00, 0x40,
+0x0D, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x18, 0x71, 0x41, 0x40,
+0x52, 0x40, 0x00, 0x52, 0x40, 0x01, 0x52, 0x41, 0x52, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x0A, 0x41,
+0x40, 0x00, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x02, 0x41,
+0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x52, 0x40, 0x16, 0x41, 0x00, 0x40, 0x08, 0x41, 0x40,
+0x41, 0x44, 0x45, 0x41, 0x42, 0x00, 0x41, 0x00, 0x40, 0x45, 0x44, 0x5F, 0x40, 0x4B, 0x45, 0x71,
+0x4B, 0x65, 0x5F, 0x4F, 0x65, 0x4F, 0x42, 0x00, 0x40, 0x04, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09,
+0x41, 0x4B, 0x40, 0x14, 0x41, 0x52, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x00, 0x52, 0x40, 0x04, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40,
+0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x20, 0x41, 0x40, 0x0F, 0x6D, 0x40,
+0x52, 0x40, 0x15, 0x52, 0x6D, 0x40, 0x08, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x08,
+0x52, 0x6D, 0x40, 0x15, 0x41, 0x40, 0x20, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x2B, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x00,
+0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x00, 0xC6, 0x86, 0x5A, 0x86, 0x5A, 0x86, 0x5A, 0x86, 0x00, 0xC7, 0x5A,
+0x3E, 0x86, 0x51, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x01, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0xC1, 0x50,
+0x53, 0x00, 0xC2, 0x86, 0x53, 0x86, 0x00, 0xC1, 0x53, 0x86, 0x00, 0xC1, 0x53, 0x86, 0x00, 0xC1,
+0x53, 0x86, 0x00, 0xC7, 0x53, 0x86, 0x53, 0x86, 0x59, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x66, 0x48, 0x43, 0xD5, 0x6D, 0x98, 0x6D, 0x70, 0x6D, 0x70,
+0x53, 0x70, 0x53, 0x70, 0x6D, 0x70, 0x53, 0x70, 0x53, 0x70, 0x53, 0x70, 0x53, 0x70, 0x53, 0x70,
+0x00, 0xC5, 0x6D, 0x70, 0x6D, 0x0A, 0x53, 0x08, 0x09, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x48, 0xD2, 0x50, 0x30, 0x03, 0x08, 0x03, 0x50, 0x30, 0x03, 0x50, 0x08, 0x03, 0x08,
+0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x01, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x01, 0x48, 0x09, 0xC0, 0x53, 0x00, 0xC0, 0x70, 0x00, 0xDB, 0x6D, 0x70, 0x6D,
+0x70, 0x53, 0x70, 0x6D, 0x70, 0x53, 0x70, 0x53, 0x70, 0x53, 0x70, 0x53, 0x70, 0x53, 0x70, 0x53,
+0x70, 0x6D, 0x98, 0x6D, 0x03, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0xC6, 0x59, 0x5A, 0x86, 0x5A, 0x86, 0x5A, 0x86, 0x00, 0xCF, 0x5A,
+0xC7, 0x5A, 0x53, 0x6D, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x00,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x01, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x48, 0x00, 0x42, 0x41, 0x42, 0x41, 0x07, 0x45, 0x00, 0x41, 0x0D, 0x45, 0x00,
+0x41, 0x02, 0x6D, 0x67, 0x45, 0x41, 0x00, 0x65, 0x41, 0x67, 0x41, 0x65, 0xC4, 0x47, 0x0F, 0x01,
+0x25, 0x01, 0x05, 0x5F, 0x41, 0x45, 0x00, 0x41, 0x02, 0x45, 0x41, 0x06, 0x45, 0x00, 0x41, 0x0D,
+0x4F, 0x42, 0x45, 0x01, 0x61, 0x42, 0x45, 0x61, 0x45, 0x01, 0x61, 0x45, 0x00, 0x68, 0x61, 0x00,
+0x45, 0x61, 0x42, 0x61, 0x01, 0x42, 0x61, 0x45, 0xC2, 0xBD, 0x43, 0x5F, 0x00, 0xC3, 0x43, 0x5F,
+0x43, 0x5F, 0x00, 0x59, 0xC3, 0x5F, 0xE3, 0x0F, 0x01, 0x0E, 0x45, 0x41, 0x09, 0xC2, 0x4F, 0x5B,
+0x5E, 0x01, 0x64, 0xC0, 0x5E, 0x01, 0x64, 0xC0, 0x5E, 0x01, 0x64, 0xC0, 0x5E, 0x00, 0x64, 0xC0,
+0x5E, 0x01, 0xC1, 0xB6, 0x01, 0x0D, 0x45, 0x00, 0x41, 0x0A, 0x65, 0x41, 0x00, 0x67, 0x56, 0xC0,
+0x99, 0x02, 0xC3, 0x82, 0x99, 0x82, 0x99, 0x02, 0xC1, 0x48, 0x99, 0x00, 0xC1, 0x82, 0x99, 0x01,
+0xC1, 0x48, 0x99, 0x00, 0xC1, 0x48, 0x99, 0x01, 0x60, 0xC8, 0xAD, 0x04, 0x03, 0x04, 0x03, 0x51,
+0x04, 0x03, 0x04, 0x00, 0x43, 0x44, 0x45, 0x41, 0x04, 0x65, 0x41, 0x00, 0x65, 0x41, 0x00, 0x65,
+0x4F, 0x65, 0x41, 0x65, 0x41, 0x00, 0x65, 0x41, 0x06, 0x45, 0x41, 0x45, 0x41, 0x12, 0x4F, 0x41,
+0x13, 0x45, 0x41, 0x42, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43, 0x44, 0x02, 0xC2, 0x51, 0x20, 0x99,
+0x05, 0xC1, 0x82, 0x99, 0x01, 0xC1, 0x48, 0x99, 0x00, 0xC1, 0x48, 0x99, 0x01, 0xC1, 0x48, 0x99,
+0x00, 0xC1, 0x82, 0x99, 0x00, 0x5F, 0x41, 0x00, 0x4F, 0x41, 0x0B, 0x45, 0x00, 0x42, 0x68, 0x45,
+0x68, 0x03, 0x62, 0x68, 0x05, 0x41, 0x10, 0x45, 0x41, 0x0A, 0x45, 0x00, 0x41, 0x0D, 0xC1, 0x93,
+0x43, 0x00, 0xC6, 0x5F, 0x43, 0x5F, 0x43, 0x5F, 0x19, 0x5F, 0x00, 0xC2, 0xCE, 0x3A, 0x05, 0x00,
+0x61, 0x42, 0x45, 0x61, 0x45, 0x61, 0x45, 0x00, 0x61, 0x45, 0x00, 0x61, 0x45, 0x00, 0x61, 0x45,
+0x42, 0x61, 0x00, 0x42, 0x61, 0x01, 0x42, 0x61, 0x00, 0x45, 0x41, 0x0F, 0x45, 0x00, 0x41, 0xC4,
+0x47, 0x0F, 0x01, 0x25, 0x01, 0x05, 0x65, 0x41, 0x45, 0x00, 0x41, 0x40, 0x41, 0x07, 0x67, 0x41,
+0x65, 0x41, 0x0A, 0x45, 0x41, 0x45, 0x41, 0x07, 0x45, 0x00, 0x41, 0x09, 0x45, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x45, 0x44, 0x4F, 0x5F, 0x76, 0x42, 0x6D, 0x71, 0x40, 0x4B,
+0x42, 0x44, 0x45, 0x4B, 0x42, 0x62, 0x40, 0x4B, 0x40, 0x00, 0x68, 0x69, 0x40, 0x42, 0x45, 0x40,
+0x00, 0x6D, 0xC5, 0x47, 0x25, 0x04, 0x1F, 0x12, 0x00, 0x00, 0x45, 0x40, 0x45, 0x42, 0x45, 0x40,
+0x01, 0x41, 0x40, 0x0D, 0x41, 0x65, 0xD0, 0x44, 0x63, 0xC5, 0x01, 0x21, 0xBD, 0x0F, 0x89, 0x03,
+0x44, 0x05, 0x21, 0xBD, 0x25, 0x0F, 0xBD, 0x3A, 0x00, 0x4F, 0x7A, 0x01, 0x4F, 0x7A, 0x01, 0x59,
+0x05, 0xC4, 0x5F, 0x6C, 0x43, 0xC8, 0x00, 0x0E, 0x41, 0x40, 0x0A, 0x6D, 0xC4, 0x5B, 0x5E, 0x83,
+0x24, 0x5E, 0x00, 0x64, 0xC4, 0x5E, 0x83, 0x5E, 0x24, 0x83, 0x00, 0xC4, 0x5E, 0x24, 0x34, 0x5E,
+0x24, 0x00, 0xC1, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x48, 0x82, 0x00, 0xC7, 0x48,
+0x33, 0xAB, 0x99, 0x62, 0x48, 0x82, 0x48, 0x0D, 0xC1, 0x7B, 0x04, 0x01, 0x5C, 0x44, 0x42, 0xC4,
+0x96, 0x44, 0x04, 0x0A, 0x04, 0x00, 0x41, 0x40, 0x0B, 0x52, 0x71, 0x4B, 0x65, 0x45, 0x40, 0x0A,
+0x41, 0x40, 0x10, 0x71, 0x45, 0x40, 0x52, 0x40, 0x14, 0x45, 0x44, 0x42, 0x44, 0x00, 0x42, 0x44,
+0x43, 0x00, 0x4A, 0x48, 0x76, 0x55, 0xCA, 0x48, 0x82, 0x33, 0x62, 0x82, 0x99, 0x48, 0x82, 0xAB,
+0x82, 0x48, 0x0B, 0x60, 0xC1, 0xDA, 0x00, 0x0F, 0xC2, 0xA2, 0x02, 0x60, 0x00, 0x7F, 0x42, 0x45,
+0xCA, 0x90, 0x02, 0x60, 0x28, 0x1E, 0x22, 0xA2, 0x0F, 0xA2, 0x0F, 0x00, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0E, 0x6D, 0xC1, 0x43, 0x19, 0x03, 0xCD, 0x43, 0x75, 0x43, 0x19, 0x95, 0x3A, 0x44,
+0x63, 0x21, 0xD3, 0x02, 0xBD, 0x3A, 0x44, 0x00, 0x76, 0xCD, 0xB7, 0x02, 0x21, 0x3A, 0x89, 0x63,
+0x05, 0x3A, 0x0F, 0x3A, 0x0F, 0x3A, 0x0F, 0x3A, 0x00, 0x65, 0x4F, 0x00, 0x65, 0x40, 0x0F, 0x41,
+0x40, 0x69, 0x42, 0x52, 0x40, 0x4B, 0x5F, 0x4F, 0x4B, 0x42, 0x68, 0x40, 0x02, 0x41, 0x40, 0x41,
+0x44, 0x45, 0x41, 0x42, 0x44, 0x41, 0x40, 0x00, 0x71, 0x45, 0x44, 0x42, 0x40, 0x45, 0x42, 0x4B,
+0x40, 0x01, 0x45, 0x42, 0x41, 0x40, 0x41, 0x45, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x4A, 0xC6, 0x44, 0x60, 0x50, 0x96,
+0x50, 0x36, 0x00, 0x00, 0x4B, 0x4E, 0x44, 0x4A, 0x44, 0xC3, 0x58, 0x08, 0x05, 0x00, 0x00, 0x69,
+0x70, 0x48, 0x5C, 0x43, 0x4A, 0x45, 0x40, 0x41, 0x4B, 0x48, 0x44, 0x4A, 0x71, 0x40, 0x48, 0x4E,
+0x40, 0x4E, 0x43, 0x41, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x6D, 0x61, 0x4E, 0xCF, 0x44, 0x3E, 0x21,
+0x59, 0x23, 0x05, 0xC5, 0x23, 0x63, 0x01, 0x3E, 0x0E, 0xD3, 0x50, 0x3B, 0x3A, 0x00, 0x65, 0x7A,
+0x02, 0x65, 0x7A, 0x00, 0xC1, 0x9F, 0x19, 0x03, 0xC5, 0x43, 0x75, 0x2B, 0x5F, 0xC8, 0x00, 0x0F,
+0x41, 0x40, 0x09, 0x4B, 0xC4, 0xA1, 0x9C, 0x11, 0xAC, 0x3B, 0x00, 0xC0, 0x9C, 0x00, 0x74, 0xCB,
+0x9C, 0x83, 0x9C, 0x34, 0x9C, 0x83, 0x9C, 0x9B, 0x83, 0x24, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0F,
+0x69, 0xCB, 0x48, 0x78, 0xDE, 0x99, 0xDE, 0x1A, 0xDE, 0x99, 0xDE, 0x78, 0x62, 0x48, 0x04, 0xC1,
+0x82, 0x48, 0x02, 0xC1, 0x82, 0x48, 0x00, 0xC2, 0x7B, 0x16, 0x04, 0x02, 0x5C, 0xC7, 0x8D, 0x0A,
+0x0E, 0x0A, 0x0E, 0x04, 0x01, 0x00, 0x0B, 0x52, 0x4B, 0x40, 0xC2, 0x8A, 0x60, 0x00, 0x0A, 0x41,
+0x40, 0x10, 0x71, 0x48, 0x4B, 0x52, 0x40, 0x14, 0x45, 0x44, 0x02, 0x5C, 0x43, 0x4C, 0x44, 0x48,
+0x63, 0x48, 0xC2, 0x7B, 0x48, 0xDE, 0x00, 0xC8, 0x62, 0xAB, 0xC4, 0x7B, 0x78, 0xAB, 0x66, 0x82,
+0x48, 0x02, 0xC1, 0x82, 0x48, 0x01, 0xC1, 0x82, 0x48, 0x01, 0xC2, 0x7B, 0x4F, 0x00, 0x0F, 0x5F,
+0x7F, 0x4E, 0xCB, 0x49, 0x3F, 0x58, 0x26, 0x60, 0x0E, 0x30, 0x28, 0xA2, 0x0F, 0xA2, 0x22, 0x00,
+0x5E, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0x6D, 0xC1, 0xD1, 0x19, 0x03, 0xD7, 0x43,
+0x2B, 0x2A, 0x5F, 0xF3, 0x29, 0x3E, 0x44, 0x3E, 0x25, 0x3E, 0x0E, 0x3A, 0x44, 0x23, 0x1C, 0x3A,
+0x64, 0x58, 0x21, 0x86, 0x53, 0x26, 0x25, 0x00, 0x7A, 0x00, 0x65, 0x7A, 0x00, 0x65, 0x7A, 0x65,
+0x7A, 0x4F, 0x40, 0x0F, 0x41, 0x4F, 0x48, 0xC9, 0x53, 0x22, 0x00, 0xAA, 0x64, 0x02, 0x1C, 0x03,
+0x02, 0x00, 0x02, 0x41, 0x40, 0x48, 0x44, 0x43, 0x44, 0x4A, 0x42, 0x4A, 0x6D, 0x40, 0x00, 0x43,
+0x48, 0x00, 0x44, 0x48, 0x00, 0x44, 0x40, 0x00, 0x41, 0x48, 0x43, 0x44, 0x40, 0x4E, 0x44, 0x40,
+0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x00, 0x43, 0xD0, 0x53, 0x02, 0x50, 0x05, 0x25, 0x49, 0x0B, 0x31, 0x0B, 0x0A, 0x30, 0x0A, 0x58,
+0x22, 0x44, 0x02, 0x00, 0x00, 0xC8, 0x50, 0x29, 0x04, 0x02, 0x05, 0x0A, 0x1F, 0x00, 0x01, 0x00,
+0x4B, 0x42, 0x66, 0x40, 0x6D, 0xC6, 0xAA, 0x03, 0x01, 0x03, 0x04, 0x02, 0x00, 0x01, 0x41, 0x40,
+0x0D, 0x41, 0x61, 0xD1, 0x86, 0x0B, 0x03, 0x59, 0x0A, 0x0E, 0x63, 0x0B, 0x0A, 0x21, 0xBD, 0x0A,
+0x0E, 0xC5, 0x21, 0x0A, 0x21, 0x3A, 0x01, 0x65, 0x7A, 0x65, 0x7A, 0x01, 0xC1, 0x9F, 0x19, 0x04,
+0xC4, 0x5F, 0x75, 0x19, 0xC8, 0x00, 0x0E, 0x41, 0x40, 0x0A, 0x4B, 0xC6, 0x5B, 0x83, 0xC2, 0x83,
+0x3B, 0x64, 0x34, 0x00, 0xCC, 0x9C, 0x71, 0x3B, 0x14, 0x5B, 0x9C, 0x83, 0xAC, 0x3B, 0x5E, 0x24,
+0xB7, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC9, 0xE5, 0x48, 0x82, 0xDE, 0x82, 0xE0, 0xAB, 0x66, 0x99,
+0xAB, 0x00, 0xC1, 0x82, 0x48, 0x01, 0xC2, 0x62, 0x82, 0x48, 0x01, 0xC1, 0x82, 0x48, 0x01, 0xC3,
+0x82, 0x48, 0x7B, 0x04, 0x01, 0x42, 0x56, 0x48, 0x4E, 0x4A, 0x69, 0x48, 0x4E, 0x42, 0x41, 0x40,
+0x0B, 0x52, 0x4B, 0x40, 0x61, 0x43, 0x40, 0x0A, 0x41, 0x40, 0x11, 0x43, 0x40, 0x52, 0x40, 0x14,
+0x45, 0x44, 0x00, 0x42, 0x44, 0x00, 0x4A, 0x4E, 0x5C, 0x48, 0x4A, 0xC6, 0x89, 0x15, 0x48, 0x33,
+0x78, 0x48, 0x66, 0x00, 0x5A, 0x50, 0x5A, 0xC4, 0x78, 0x62, 0x48, 0x82, 0x48, 0x02, 0xC1, 0x82,
+0x48, 0x01, 0xC6, 0x82, 0x48, 0x82, 0x01, 0x00, 0x12, 0x00, 0x0C, 0x71, 0x62, 0x67, 0x70, 0x77,
+0x52, 0x43, 0x4E, 0x62, 0x70, 0x66, 0xC2, 0x60, 0x1E, 0x22, 0x00, 0x5E, 0x62, 0x67, 0x40, 0x10,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0xC2, 0xE8, 0xD1, 0x19, 0x03, 0xD8, 0x75, 0x2B, 0x75, 0x5F,
+0xF3, 0x1C, 0x50, 0x0B, 0x0A, 0x50, 0x0A, 0x0E, 0x21, 0xF8, 0x0A, 0x25, 0x89, 0x0A, 0x0E, 0x21,
+0x3A, 0x86, 0x04, 0xD3, 0x3A, 0x00, 0x65, 0x7A, 0x00, 0x65, 0x7A, 0x65, 0x7A, 0x65, 0x4F, 0x4B,
+0x40, 0x0E, 0x41, 0x40, 0x65, 0x4A, 0x42, 0x40, 0x65, 0x43, 0x42, 0x4A, 0xD0, 0x58, 0x03, 0x31,
+0x00, 0x0B, 0x00, 0x01, 0x00, 0x02, 0x0A, 0x04, 0x02, 0x04, 0x00, 0x0A, 0x05, 0x00, 0x00, 0xC2,
+0x50, 0x49, 0x0A, 0x00, 0xC3, 0x44, 0x05, 0x03, 0x00, 0x00, 0x45, 0x48, 0x41, 0x48, 0x42, 0x48,
+0x44, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x45, 0x42, 0x69, 0xC5, 0x5A, 0x6D, 0x22, 0x1C, 0x30, 0x00, 0x00, 0x6D, 0x4A, 0x5F,
+0x43, 0x4E, 0x7F, 0x48, 0x45, 0x40, 0x00, 0x56, 0x44, 0x43, 0x00, 0x45, 0x44, 0x00, 0x40, 0x6D,
+0x4B, 0x44, 0x48, 0x41, 0x71, 0x40, 0x41, 0x43, 0x45, 0x42, 0x00, 0x43, 0x40, 0x01, 0x41, 0x40,
+0x0D, 0xCD, 0xD3, 0x21, 0x86, 0x3A, 0x86, 0x0E, 0x3E, 0x86, 0x3E, 0x01, 0x3E, 0x21, 0x08, 0x3E,
+0x00, 0x4A, 0x6D, 0xC4, 0x86, 0x21, 0x3A, 0x25, 0x3A, 0x05, 0xC1, 0x43, 0x19, 0x04, 0xC4, 0x75,
+0x6C, 0x19, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0xC7, 0x5B, 0x83, 0x64, 0xC2, 0x9C, 0x9B,
+0x34, 0x83, 0x00, 0x7B, 0xCA, 0xC2, 0x83, 0x5E, 0x3B, 0x83, 0x9C, 0x83, 0x24, 0x5E, 0x3A, 0x00,
+0x0D, 0x41, 0x40, 0x0E, 0x4B, 0x69, 0xC0, 0x48, 0x00, 0xC9, 0x78, 0x99, 0x66, 0x20, 0xDE, 0x99,
+0x33, 0xAB, 0x7B, 0x48, 0x03, 0xC2, 0x62, 0x82, 0x48, 0x02, 0xC1, 0x82, 0x48, 0x00, 0xC2, 0x7B,
+0x1C, 0x04, 0x01, 0x56, 0x4E, 0xC7, 0x9E, 0x0E, 0x08, 0x0E, 0x04, 0x02, 0x01, 0x00, 0x0B, 0x52,
+0xC4, 0x47, 0x0B, 0x21, 0x26, 0x00, 0x0A, 0x41, 0x40, 0x10, 0x71, 0xC4, 0x6D, 0x12, 0x00, 0x12,
+0x00, 0x13, 0x45, 0x44, 0x01, 0x42, 0x48, 0x63, 0xD0, 0x77, 0x04, 0x0E, 0x03, 0x89, 0x7B, 0x48,
+0x33, 0xAB, 0x1A, 0xE0, 0x78, 0x66, 0xAB, 0xCF, 0x82, 0x48, 0x01, 0xC3, 0x82, 0x48, 0x82, 0x48,
+0x01, 0xC1, 0x82, 0x48, 0x01, 0x60, 0xC1, 0xDA, 0x00, 0x0F, 0x5F, 0x00, 0x70, 0x76, 0x62, 0xC9,
+0x49, 0x0A, 0x36, 0x04, 0x37, 0x30, 0x1E, 0x22, 0xA2, 0x22, 0x00, 0xC1, 0xA2, 0x00, 0x10, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0E, 0xC2, 0xE8, 0xD1, 0x19, 0x03, 0xD8, 0x6C, 0x75, 0x2A, 0x75, 0xF3,
+0x1C, 0x59, 0x21, 0x0A, 0x3E, 0x71, 0x0E, 0x86, 0x25, 0x3E, 0x25, 0x3E, 0x86, 0x0E, 0x59, 0x08,
+0x63, 0x3A, 0x0F, 0x3A, 0x01, 0x65, 0x7A, 0x01, 0x65, 0x7A, 0x65, 0x4F, 0x40, 0x0F, 0x41, 0xC4,
+0xAA, 0x02, 0x1C, 0x60, 0x00, 0x00, 0x44, 0x7F, 0xC7, 0x6D, 0x02, 0x30, 0x05, 0x00, 0x0B, 0x00,
+0x01, 0x00, 0x42, 0x45, 0x4A, 0x48, 0x44, 0x40, 0x4A, 0x5F, 0x40, 0x00, 0x43, 0x44, 0x42, 0xC4,
+0x49, 0x03, 0x02, 0x03, 0x00, 0x00, 0x41, 0x48, 0x42, 0x48, 0x00, 0x4E, 0x48, 0x40, 0x00, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x43,
+0x48, 0x42, 0x44, 0xC3, 0x58, 0x6D, 0x0F, 0x00, 0x00, 0x4B, 0x43, 0x48, 0x44, 0x65, 0x43, 0x76,
+0x40, 0x01, 0x6D, 0xCD, 0x74, 0x36, 0x01, 0x44, 0x03, 0x27, 0x00, 0x31, 0x01, 0x59, 0x08, 0x04,
+0x05, 0x01, 0x00, 0x42, 0x41, 0x43, 0x48, 0x41, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x6D, 0x61, 0xC0,
+0x86, 0x00, 0x43, 0xD4, 0x44, 0x05, 0x01, 0x50, 0x05, 0x63, 0x05, 0x44, 0x0F, 0x25, 0x03, 0x3A,
+0x44, 0x21, 0xE8, 0x3A, 0x25, 0x3A, 0x25, 0x3A, 0x25, 0x00, 0x7A, 0xC1, 0x9F, 0x19, 0x04, 0xC4,
+0x75, 0x43, 0x19, 0xC8, 0x00, 0x0E, 0x41, 0x40, 0x0B, 0xC1, 0x5B, 0x83, 0x02, 0x74, 0xCE, 0x5E,
+0x83, 0x9C, 0x83, 0x24, 0x34, 0x9C, 0x5E, 0x83, 0xC2, 0x9C, 0xD0, 0x24, 0xB7, 0x00, 0x0D, 0x41,
+0x40, 0x0F, 0xCB, 0xE5, 0x48, 0x82, 0xAB, 0x82, 0x78, 0x66, 0xAB, 0x62, 0x99, 0x33, 0x48, 0x00,
+0xC4, 0x62, 0x48, 0x62, 0x82, 0x48, 0x00, 0xC1, 0x62, 0x48, 0x00, 0xC2, 0x62, 0x82, 0x48, 0x00,
+0xC1, 0x7B, 0x04, 0x00, 0x42, 0x44, 0x42, 0x56, 0xC2, 0x74, 0x08, 0x0E, 0x00, 0xC3, 0x86, 0x04,
+0x01, 0x00, 0x0B, 0x52, 0x40, 0x00, 0x69, 0x43, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x71, 0x43, 0x52,
+0x40, 0x15, 0x45, 0x44, 0x42, 0x44, 0x5C, 0x42, 0x44, 0xC3, 0x86, 0x04, 0x08, 0x04, 0x00, 0x55,
+0xC0, 0x48, 0x00, 0xC5, 0xAB, 0x33, 0x99, 0x62, 0xAB, 0x78, 0x00, 0x5A, 0xC2, 0x48, 0x62, 0x48,
+0x00, 0xC1, 0x62, 0x48, 0x00, 0xC1, 0x62, 0x48, 0x00, 0xC1, 0x62, 0x48, 0x00, 0x60, 0xC1, 0x47,
+0x00, 0x0F, 0x5F, 0x5E, 0x76, 0x68, 0x7F, 0x44, 0x68, 0x66, 0x00, 0xC8, 0x49, 0x22, 0xA2, 0x0F,
+0xA2, 0x0F, 0xA2, 0x0F, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0x6D, 0xC1, 0xD1, 0x19,
+0x03, 0xC1, 0x43, 0x75, 0x00, 0xDA, 0x43, 0x95, 0x21, 0x0A, 0x86, 0x44, 0x63, 0x25, 0x0F, 0x50,
+0x3A, 0x63, 0x05, 0x50, 0xC0, 0x3A, 0x86, 0x0A, 0x86, 0x1C, 0x25, 0x3A, 0x25, 0x3A, 0x25, 0x3A,
+0x25, 0x00, 0x7A, 0x65, 0x4F, 0x65, 0x40, 0x0F, 0x41, 0x52, 0xCA, 0x51, 0x03, 0x0F, 0x05, 0x00,
+0x21, 0x22, 0x25, 0x08, 0x04, 0x00, 0x00, 0x4B, 0x40, 0x41, 0x40, 0x42, 0x4A, 0x44, 0x45, 0x48,
+0x00, 0x42, 0x40, 0x01, 0x42, 0x4A, 0x43, 0x45, 0x44, 0x48, 0x41, 0x40, 0x01, 0x44, 0x48, 0x45,
+0x40, 0x42, 0x00, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x41, 0x08,
+0x45, 0x41, 0x0D, 0x45, 0x5F, 0x41, 0x00, 0x4F, 0x41, 0x01, 0x61, 0x4A, 0x00, 0xC2, 0x53, 0x05,
+0x01, 0x00, 0x65, 0x00, 0x41, 0x43, 0x4A, 0x00, 0x76, 0x41, 0x00, 0x65, 0x41, 0x00, 0x5F, 0x41,
+0x4F, 0x45, 0xC3, 0x47, 0x01, 0x1F, 0x01, 0x06, 0x45, 0x41, 0x00, 0x45, 0x41, 0x0B, 0x4F, 0x65,
+0x45, 0xC1, 0xBD, 0x21, 0x01, 0xC1, 0xBD, 0x21, 0x00, 0xC1, 0x90, 0x21, 0x00, 0xC1, 0xBD, 0x21,
+0x02, 0xC2, 0xBD, 0x3A, 0x21, 0x00, 0xC1, 0xBD, 0x21, 0x02, 0xC9, 0xBD, 0x21, 0xC5, 0x43, 0x5F,
+0x43, 0x5F, 0x43, 0x5F, 0x43, 0x00, 0xC3, 0x5F, 0x43, 0xF0, 0x01, 0x0E, 0x45, 0x00, 0x41, 0x09,
+0x65, 0x54, 0x64, 0xC4, 0xC7, 0x5E, 0x24, 0x14, 0x5E, 0x00, 0xC1, 0x52, 0x5E, 0x00, 0xC2, 0x52,
+0x14, 0x5E, 0x00, 0x54, 0x00, 0xC0, 0x5E, 0x00, 0xC1, 0xBD, 0x01, 0x0D, 0x45, 0x41, 0x0D, 0x5F,
+0x65, 0xC2, 0x8A, 0x33, 0x82, 0x00, 0xC1, 0x99, 0x7B, 0x00, 0xC4, 0x99, 0x82, 0x99, 0x82, 0x99,
+0x00, 0xC1, 0x82, 0x99, 0x01, 0xD0, 0x82, 0x33, 0x82, 0x33, 0x82, 0x99, 0x82, 0x33, 0x82, 0x20,
+0x51, 0x36, 0x63, 0x04, 0x03, 0x51, 0x04, 0x02, 0x43, 0x44, 0x42, 0x48, 0x4A, 0x0C, 0x48, 0x5C,
+0xC1, 0x60, 0x01, 0x0A, 0x45, 0x41, 0x10, 0x5F, 0x43, 0x48, 0x4A, 0x0C, 0x42, 0x41, 0x06, 0x42,
+0x44, 0x43, 0x00, 0x76, 0x43, 0x00, 0x44, 0x43, 0x44, 0xC7, 0x63, 0x36, 0x20, 0x33, 0x99, 0x7B,
+0x82, 0x99, 0x00, 0xD5, 0x82, 0x99, 0x82, 0x99, 0x82, 0x33, 0x82, 0x99, 0x82, 0x33, 0x82, 0x33,
+0x82, 0x33, 0x82, 0x99, 0x82, 0x20, 0x29, 0x01, 0x0F, 0x01, 0x0C, 0x4F, 0x45, 0x68, 0x03, 0x42,
+0x62, 0x68, 0x62, 0x68, 0x00, 0xC2, 0x90, 0x22, 0x28, 0x01, 0x41, 0x10, 0x45, 0x41, 0x0A, 0x45,
+0x41, 0x0E, 0x7A, 0xC3, 0x8F, 0x43, 0x5F, 0x43, 0x00, 0xC3, 0x5F, 0x43, 0x6C, 0x5F, 0x00, 0xC3,
+0xCE, 0x21, 0x3A, 0x21, 0x07, 0x7A, 0x42, 0xC1, 0xBD, 0x21, 0x00, 0x45, 0xC0, 0xBD, 0x00, 0x61,
+0x00, 0xC1, 0xBD, 0x21, 0x00, 0xC1, 0xBD, 0x21, 0x03, 0x4F, 0x41, 0x0E, 0x45, 0x00, 0x65, 0x4F,
+0x5F, 0x4F, 0xC4, 0x4F, 0x0F, 0x1F, 0x25, 0x01, 0x04, 0x45, 0x00, 0x41, 0x05, 0x48, 0x4A, 0x00,
+0x42, 0xC3, 0x47, 0x01, 0x25, 0x01, 0x00, 0x42, 0x4A, 0x00, 0x48, 0x41, 0x01, 0x45, 0x41, 0x00,
+0x45, 0x41, 0x45, 0x41, 0x07, 0x45, 0x41, 0x09, 0x45, 0x41, 0x40, 0x43, 0x00, 0x48, 0x43, 0x01,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43,
+0x01, 0x48, 0x43, 0x02, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0xC3, 0x50, 0x03, 0x08, 0x03, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x66,
+0x43, 0x02, 0x48, 0x43, 0x03, 0x48, 0x00, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48,
+0x43, 0x01, 0xC1, 0x59, 0x53, 0x00, 0xC7, 0x59, 0x86, 0x08, 0x58, 0x59, 0x08, 0x59, 0x08, 0x00,
+0xC9, 0x53, 0x58, 0x08, 0x59, 0x53, 0x86, 0x59, 0x86, 0x08, 0x86, 0x00, 0xD2, 0x59, 0x86, 0x59,
+0x53, 0x86, 0x5C, 0x75, 0x2A, 0x75, 0x2A, 0x75, 0x2A, 0x11, 0x75, 0x2A, 0x8F, 0x51, 0x08, 0x03,
+0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01,
+0x48, 0x43, 0xC5, 0x59, 0x6D, 0x03, 0x26, 0x34, 0x9C, 0x00, 0x74, 0xC9, 0x9B, 0x9C, 0x9B, 0x34,
+0x9C, 0x34, 0x9B, 0x9C, 0x9B, 0x9C, 0x00, 0xC1, 0x9B, 0x9C, 0x00, 0x74, 0x70, 0x00, 0x48, 0x70,
+0x48, 0x70, 0xCD, 0x58, 0x49, 0x08, 0x30, 0x08, 0x30, 0x08, 0x58, 0x30, 0x08, 0x30, 0x03, 0x08,
+0x03, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x66, 0x48, 0x43, 0xC2, 0x70, 0xAB,
+0x78, 0x01, 0xC7, 0xCF, 0x78, 0xAB, 0x78, 0xAB, 0x78, 0xAB, 0x78, 0x09, 0xC7, 0x66, 0x78, 0xAB,
+0xCF, 0x3E, 0x0E, 0x0A, 0x0E, 0x00, 0x4A, 0x4E, 0x02, 0x4A, 0x4E, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0xC4, 0x50, 0x03,
+0x26, 0x08, 0x03, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x02, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x66, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48,
+0x43, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0xC2, 0x5A, 0xCF, 0x78,
+0x00, 0xC1, 0x88, 0x78, 0x01, 0xC2, 0x66, 0xAB, 0x78, 0x0E, 0xC6, 0x6D, 0x26, 0x03, 0x08, 0x03,
+0x08, 0x03, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0xC9, 0x58, 0x08, 0x30, 0x49,
+0x30, 0x08, 0x30, 0x58, 0x08, 0x30, 0x01, 0xC3, 0x49, 0x30, 0x49, 0x30, 0x00, 0x43, 0x00, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x02, 0x48,
+0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43,
+0x01, 0x48, 0x43, 0xC8, 0x59, 0x11, 0x75, 0x5C, 0x75, 0x2A, 0x75, 0x11, 0x75, 0x00, 0xD3, 0x5C,
+0x3E, 0x6D, 0x53, 0x59, 0x58, 0x53, 0x58, 0x53, 0x59, 0x53, 0x86, 0x53, 0x59, 0x53, 0x59, 0x58,
+0x08, 0x59, 0x08, 0x00, 0xC9, 0x86, 0x59, 0x53, 0x58, 0x59, 0x53, 0x86, 0x53, 0x58, 0x08, 0x00,
+0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x02,
+0x66, 0x43, 0xC7, 0x50, 0x08, 0x03, 0x26, 0x08, 0x03, 0x08, 0x03, 0x01, 0x48, 0x43, 0x03, 0x48,
+0x43, 0x01, 0x66, 0xC3, 0x6D, 0x26, 0x08, 0x03, 0x04, 0x48, 0x43, 0x07, 0x48, 0x43, 0x01, 0x48,
+0x43, 0x03, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48, 0x42, 0x41, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x08, 0x4B, 0x40, 0x01, 0x4B, 0x40, 0x0B, 0x4B, 0x41,
+0x40, 0x0C, 0x41, 0x40, 0x0D, 0x6D, 0x65, 0x4B, 0x41, 0x6D, 0x65, 0x4B, 0x6D, 0x65, 0x41, 0x6D,
+0x00, 0x41, 0x4B, 0x6D, 0x65, 0x6D, 0x00, 0xC5, 0xD3, 0x0F, 0xD3, 0x2D, 0xD3, 0x25, 0x01, 0xC3,
+0xD3, 0x3A, 0x9F, 0x19, 0x04, 0xC0, 0x9F, 0x00, 0x59, 0xC1, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x0A,
+0xC5, 0x67, 0xAC, 0x24, 0xAC, 0x24, 0xAC, 0x01, 0x64, 0x00, 0xC1, 0xEE, 0x24, 0x01, 0xC1, 0xEE,
+0x5B, 0x00, 0x64, 0x54, 0x7A, 0x67, 0x01, 0x4F, 0xC1, 0xA2, 0x27, 0x00, 0x4F, 0xC1, 0xA2, 0x27,
+0x01, 0x5E, 0x00, 0x62, 0x41, 0x40, 0x0E, 0x6D, 0xC2, 0xE5, 0x48, 0x10, 0x00, 0xC1, 0x7B, 0x62,
+0x00, 0xC2, 0x7B, 0x48, 0x62, 0x00, 0xC1, 0x48, 0x62, 0x01, 0xC2, 0x7B, 0x62, 0x7B, 0x03, 0xC2,
+0x62, 0x7B, 0x48, 0x00, 0xC2, 0x7B, 0x16, 0x02, 0x09, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x5F, 0x44,
+0x42, 0x01, 0x44, 0x42, 0x04, 0x55, 0xC2, 0x48, 0x62, 0x7B, 0x00, 0xC0, 0x62, 0x02, 0xC2, 0x7B,
+0x62, 0x7B, 0x0A, 0xC3, 0x82, 0xA5, 0x47, 0x00, 0x0F, 0x41, 0x4F, 0x67, 0x00, 0x4F, 0xC8, 0xA2,
+0x27, 0xA2, 0x27, 0x01, 0xA2, 0x0F, 0xA2, 0x1E, 0x00, 0xC2, 0xA2, 0x1E, 0x00, 0x10, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0E, 0x6D, 0xC1, 0xD1, 0x19, 0x02, 0xC2, 0x43, 0x9F, 0x43, 0x00, 0x59, 0xC1,
+0xF3, 0x2D, 0x00, 0x4B, 0x6D, 0x41, 0x4B, 0x6D, 0x65, 0x00, 0x6D, 0x00, 0x65, 0x6D, 0x41, 0x7A,
+0x6D, 0x01, 0x65, 0xC6, 0xD3, 0x0F, 0x25, 0xD3, 0x0F, 0x01, 0xD3, 0x00, 0x65, 0xC2, 0xD3, 0x01,
+0x00, 0x0F, 0x41, 0x40, 0x00, 0x4B, 0x40, 0x0B, 0x41, 0x40, 0x15, 0x4B, 0x00, 0x40, 0x4B, 0x40,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41,
+0x40, 0x44, 0x48, 0x42, 0x5C, 0xC4, 0x58, 0x6D, 0x0F, 0x00, 0x0B, 0x00, 0x43, 0x48, 0x43, 0x65,
+0x70, 0x44, 0x52, 0x4B, 0x40, 0x41, 0x43, 0x00, 0x41, 0x43, 0x48, 0x41, 0x40, 0x41, 0x40, 0x42,
+0x48, 0x42, 0x40, 0x00, 0x45, 0x44, 0x40, 0x00, 0x43, 0x45, 0x40, 0x01, 0x41, 0x40, 0x0B, 0x6D,
+0x40, 0x41, 0x7A, 0xC0, 0x86, 0x00, 0xD0, 0x50, 0x01, 0x04, 0x59, 0x25, 0x08, 0x3E, 0x0A, 0x3A,
+0x44, 0x26, 0x2D, 0x63, 0x0A, 0xBD, 0x25, 0x3A, 0x03, 0x4F, 0x7A, 0x00, 0xC1, 0x9F, 0x19, 0x03,
+0xC1, 0x9F, 0x75, 0x00, 0xC2, 0x43, 0xD2, 0x00, 0x0E, 0x41, 0x00, 0x40, 0x06, 0x4B, 0x40, 0x00,
+0x6D, 0xC7, 0x67, 0x83, 0x9C, 0x5B, 0x9C, 0x52, 0x83, 0x9C, 0x00, 0x54, 0xC2, 0x83, 0x64, 0x83,
+0x01, 0xC0, 0x9C, 0x00, 0x64, 0x54, 0x7A, 0x68, 0xCF, 0x49, 0x0A, 0x04, 0x26, 0x0E, 0x30, 0x28,
+0x30, 0x0A, 0x28, 0x60, 0x49, 0x02, 0x22, 0x27, 0x00, 0x0E, 0x52, 0x69, 0xC0, 0x82, 0x00, 0xC9,
+0x78, 0x62, 0x48, 0x66, 0x99, 0x48, 0x33, 0xAB, 0x62, 0x48, 0x03, 0xC1, 0x82, 0x48, 0x03, 0xC1,
+0x82, 0x48, 0x00, 0xC2, 0x7B, 0x16, 0x04, 0x02, 0x42, 0x4A, 0x43, 0x48, 0x4E, 0x48, 0x44, 0x41,
+0x40, 0x13, 0x42, 0x45, 0x40, 0x05, 0x41, 0x40, 0x0D, 0x41, 0x42, 0x40, 0x19, 0x45, 0x44, 0x02,
+0x42, 0x44, 0x4E, 0x44, 0x4A, 0x4E, 0x44, 0xC7, 0x7B, 0x48, 0x33, 0xAB, 0x82, 0x66, 0x78, 0x1A,
+0x00, 0xC2, 0x66, 0x33, 0x48, 0x0B, 0x60, 0xC2, 0xDA, 0x12, 0x00, 0x0E, 0x4F, 0x44, 0xC0, 0x49,
+0x00, 0x44, 0xC6, 0x60, 0x28, 0x36, 0x04, 0x49, 0x36, 0x22, 0x03, 0x4F, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0E, 0xC2, 0xE8, 0xD1, 0x19, 0x03, 0xC1, 0x43, 0x75, 0x00, 0xD5, 0x5F, 0xF3,
+0x21, 0x86, 0x0A, 0x44, 0x2D, 0x03, 0x63, 0x3A, 0x53, 0x0E, 0x50, 0x25, 0x59, 0x04, 0xD3, 0x08,
+0x86, 0x21, 0x0F, 0x3A, 0x05, 0x65, 0x7A, 0x4F, 0x65, 0x40, 0x0F, 0x41, 0x00, 0x43, 0x00, 0x4F,
+0x40, 0x4B, 0x44, 0x45, 0x42, 0x48, 0x4A, 0x41, 0x40, 0x01, 0x41, 0x40, 0x42, 0x48, 0x44, 0x45,
+0x48, 0x00, 0x42, 0x40, 0x01, 0x5C, 0x48, 0x00, 0x45, 0x44, 0x48, 0x41, 0x40, 0x01, 0x44, 0x48,
+0x45, 0x42, 0x48, 0x42, 0x40, 0x67, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x65, 0x4E, 0x42, 0x76, 0xC4, 0x6D, 0x22, 0x1C, 0x30, 0x00,
+0x00, 0x4B, 0x4E, 0x44, 0xC5, 0x53, 0x08, 0x3F, 0x08, 0x05, 0x00, 0x00, 0x44, 0x00, 0x76, 0xD2,
+0x96, 0x02, 0x60, 0x04, 0x00, 0x27, 0x01, 0x02, 0x03, 0x08, 0x00, 0x01, 0x08, 0x0A, 0x00, 0x05,
+0x0E, 0x05, 0x00, 0x01, 0x41, 0x40, 0x0D, 0x6D, 0x61, 0xD4, 0x86, 0x3A, 0x0A, 0x1C, 0x86, 0x0E,
+0x21, 0x01, 0x3E, 0x02, 0x25, 0x0A, 0x0E, 0x02, 0x86, 0x44, 0x86, 0xD3, 0x3A, 0x25, 0x3A, 0x00,
+0x65, 0x7A, 0x01, 0xC1, 0x9F, 0x19, 0x03, 0xC2, 0xBC, 0x2A, 0x5F, 0x00, 0xC1, 0xC8, 0x00, 0x0F,
+0x41, 0x40, 0x09, 0x4B, 0xC5, 0x67, 0x9C, 0xC2, 0x24, 0xC2, 0x9B, 0x00, 0x64, 0xC0, 0x9C, 0x00,
+0x7B, 0xD9, 0x83, 0x34, 0x9B, 0x9C, 0x52, 0x3B, 0x83, 0x67, 0x0F, 0x0A, 0x37, 0x02, 0x60, 0x1F,
+0x0E, 0x28, 0x03, 0x49, 0x37, 0x04, 0x0E, 0x58, 0x90, 0x1F, 0x0F, 0x00, 0x0E, 0x4B, 0xCC, 0xE5,
+0x48, 0xAB, 0xE0, 0x20, 0x33, 0xE0, 0xAB, 0x99, 0xDE, 0x78, 0x7B, 0x48, 0x01, 0xC1, 0x82, 0x48,
+0x03, 0xC8, 0x62, 0x48, 0x7B, 0x82, 0x48, 0x7B, 0x04, 0x02, 0x04, 0x00, 0x42, 0x44, 0x63, 0x4A,
+0x48, 0x4A, 0x4E, 0x42, 0x41, 0x40, 0x13, 0x44, 0x42, 0x40, 0x05, 0x41, 0x40, 0x0D, 0x41, 0x43,
+0x40, 0x19, 0x61, 0x44, 0x42, 0x44, 0x00, 0x42, 0x48, 0x63, 0x48, 0x4E, 0x48, 0x76, 0xCF, 0x7B,
+0x48, 0xDE, 0x78, 0x33, 0xDE, 0x1A, 0x66, 0x1A, 0x20, 0xDE, 0x82, 0x62, 0x48, 0x82, 0x48, 0x00,
+0xC1, 0x82, 0x48, 0x02, 0xC6, 0x82, 0x48, 0x20, 0xDA, 0x00, 0x12, 0x00, 0x0D, 0x4F, 0x48, 0x76,
+0x68, 0xCD, 0x49, 0x04, 0x49, 0x60, 0x49, 0x54, 0x02, 0xA2, 0x22, 0x0F, 0xA2, 0x22, 0xA2, 0x00,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0x6D, 0xC1, 0xD1, 0x19, 0x02, 0xDF, 0x43, 0x75, 0x5C,
+0x75, 0x2A, 0xF3, 0x1C, 0x08, 0x3A, 0x0A, 0x02, 0x3E, 0x0E, 0x0F, 0x21, 0x3E, 0x3A, 0x21, 0x0E,
+0x3E, 0x21, 0x63, 0x0A, 0x89, 0x01, 0x3A, 0x25, 0x3A, 0x25, 0x3A, 0x25, 0x3A, 0x65, 0x7A, 0x65,
+0x4F, 0x52, 0x40, 0x0E, 0x41, 0x00, 0x44, 0x4A, 0x42, 0x40, 0x69, 0xC5, 0x64, 0x3F, 0x00, 0x02,
+0x08, 0x00, 0x02, 0x41, 0x40, 0x48, 0x44, 0x02, 0x41, 0x4A, 0x41, 0x40, 0x00, 0x43, 0x48, 0x43,
+0x48, 0x00, 0x42, 0x43, 0x40, 0x00, 0x45, 0x48, 0x42, 0x43, 0x4A, 0x48, 0x45, 0x4B, 0x40, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x67, 0x42,
+0xC6, 0x6D, 0x26, 0x50, 0x1F, 0x25, 0x5A, 0x00, 0x00, 0x4B, 0x4A, 0x43, 0x4A, 0x00, 0x45, 0x76,
+0x42, 0x40, 0x4B, 0xC8, 0x51, 0x02, 0x04, 0x02, 0x1F, 0x03, 0x1F, 0x00, 0x01, 0x00, 0x40, 0x42,
+0x48, 0x41, 0x40, 0x41, 0x43, 0x45, 0x43, 0x4A, 0x42, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x61,
+0xC4, 0x53, 0x0B, 0x63, 0x0A, 0x0E, 0x00, 0xCC, 0x86, 0x2D, 0x0A, 0x21, 0x89, 0x64, 0x0E, 0x53,
+0x59, 0x21, 0x86, 0x25, 0x3A, 0x01, 0x65, 0x7A, 0x00, 0x65, 0x7A, 0x59, 0x04, 0x6A, 0x00, 0xC3,
+0x75, 0x5F, 0xC8, 0x00, 0x0E, 0x41, 0x40, 0x0A, 0x4B, 0xC3, 0x5B, 0x83, 0x3B, 0x9C, 0x00, 0x7B,
+0xDE, 0x9C, 0xEE, 0x5E, 0x9C, 0x5E, 0x64, 0x34, 0x64, 0xD0, 0x71, 0x9C, 0xAC, 0xCE, 0x22, 0x0A,
+0xEA, 0x3A, 0xEA, 0x3A, 0x54, 0x22, 0x28, 0x60, 0x0A, 0x60, 0x04, 0x37, 0x49, 0x22, 0x0F, 0x00,
+0x0E, 0x52, 0x69, 0xC0, 0x48, 0x00, 0xC9, 0x78, 0x82, 0xDE, 0x9E, 0xDE, 0x7B, 0x33, 0xAB, 0x7B,
+0x48, 0x01, 0xC7, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x48, 0x7B, 0x00, 0xC3, 0x82, 0x48, 0x7B,
+0x04, 0x01, 0x42, 0x44, 0x4A, 0x4E, 0x4A, 0x44, 0x48, 0x4E, 0x42, 0x41, 0x40, 0x13, 0x44, 0x42,
+0x40, 0x05, 0x41, 0x40, 0x0E, 0x43, 0x40, 0x19, 0x45, 0x44, 0x01, 0x42, 0x48, 0x4E, 0x03, 0x66,
+0x55, 0xCB, 0x48, 0x33, 0x78, 0x33, 0xDE, 0xAB, 0xDE, 0x62, 0x78, 0x99, 0x7B, 0x48, 0x00, 0xCC,
+0x62, 0x82, 0x62, 0x48, 0x62, 0x82, 0x62, 0x82, 0x62, 0x48, 0x82, 0xDA, 0x00, 0x0F, 0x41, 0x70,
+0x4E, 0xC5, 0x8D, 0x37, 0x22, 0x23, 0x28, 0x02, 0x00, 0xC3, 0x49, 0x28, 0xA2, 0x22, 0x00, 0x5E,
+0x4F, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0xC2, 0xE8, 0xD1, 0x19, 0x00, 0xC4, 0x9F,
+0x19, 0x9F, 0x5F, 0x2A, 0x01, 0xD4, 0xF3, 0x1C, 0x50, 0x00, 0x08, 0x86, 0x0E, 0x64, 0x44, 0x3A,
+0x3E, 0x25, 0x50, 0x0E, 0x4A, 0x02, 0x3A, 0x86, 0x63, 0x25, 0x3A, 0x04, 0x65, 0x7A, 0x65, 0x7A,
+0x65, 0x40, 0x0F, 0x45, 0x40, 0x41, 0xC2, 0x6D, 0x3F, 0x00, 0x00, 0x44, 0x42, 0x40, 0x48, 0x45,
+0x40, 0x02, 0x41, 0x40, 0x45, 0x43, 0x48, 0x44, 0x00, 0x40, 0x48, 0x45, 0x40, 0x00, 0xC7, 0x50,
+0x30, 0x6D, 0x49, 0x44, 0x05, 0x08, 0x00, 0x00, 0x45, 0x48, 0x41, 0x48, 0x42, 0x61, 0x48, 0x40,
+0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x45, 0x48, 0x42, 0xC5, 0x49, 0x53, 0x36, 0x6D, 0x36, 0x00, 0x00, 0x4B, 0x4A, 0x42, 0x48, 0x43,
+0x70, 0xC2, 0x58, 0x01, 0x00, 0x00, 0x69, 0x48, 0xCB, 0x74, 0x04, 0x0E, 0x04, 0x01, 0x00, 0x01,
+0x00, 0x03, 0x04, 0x03, 0x01, 0x01, 0x43, 0x45, 0x48, 0x4E, 0x42, 0x40, 0x01, 0x41, 0x40, 0x0B,
+0x4B, 0x40, 0x6D, 0x61, 0x7E, 0xCD, 0x44, 0x0A, 0x3E, 0x59, 0x1C, 0x3E, 0x21, 0x0A, 0x21, 0x53,
+0x26, 0x44, 0x3E, 0x86, 0x00, 0xC4, 0x63, 0xD3, 0x3A, 0x25, 0x3A, 0x00, 0x65, 0x7A, 0x01, 0xC1,
+0x43, 0x19, 0x00, 0xC3, 0x43, 0x19, 0x9F, 0x75, 0x01, 0xC2, 0x5F, 0xC8, 0x00, 0x0F, 0x41, 0x40,
+0x09, 0x6D, 0xCD, 0x5B, 0x83, 0x64, 0xC2, 0x9B, 0x34, 0x9C, 0x83, 0x9C, 0x34, 0x64, 0xC7, 0x3B,
+0x9C, 0x00, 0xC5, 0xC2, 0x83, 0x24, 0x5B, 0x3A, 0x30, 0x00, 0xC6, 0x59, 0x30, 0x05, 0x0A, 0x22,
+0x36, 0x30, 0x00, 0xC6, 0x49, 0x30, 0x60, 0x30, 0x0F, 0x1F, 0x00, 0x0E, 0x4B, 0xC1, 0x8E, 0x48,
+0x00, 0xC5, 0xAB, 0x1A, 0x66, 0x99, 0xDE, 0x33, 0x00, 0xC1, 0xAB, 0x48, 0x0A, 0xC0, 0x82, 0x00,
+0xC4, 0x48, 0x7B, 0x16, 0x02, 0x04, 0x01, 0x4A, 0x63, 0x4E, 0x4A, 0x48, 0x4E, 0x42, 0x41, 0x40,
+0x13, 0x42, 0x00, 0x40, 0x05, 0x41, 0x40, 0x0D, 0x41, 0x43, 0x40, 0x19, 0x45, 0x44, 0x5C, 0x44,
+0x42, 0x43, 0x4E, 0x4C, 0x4A, 0x01, 0x48, 0xC1, 0x7B, 0x48, 0x00, 0xC8, 0x78, 0x33, 0xDE, 0x1A,
+0x78, 0xDE, 0x66, 0x99, 0x48, 0x0B, 0xC2, 0x82, 0xDA, 0x00, 0x0E, 0x52, 0x41, 0x70, 0x44, 0x66,
+0xC0, 0x49, 0x00, 0x76, 0xC4, 0x49, 0x30, 0x60, 0x58, 0x22, 0x01, 0xC3, 0xA2, 0x22, 0xA2, 0x00,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x4B, 0x40, 0x0D, 0x41, 0xC1, 0xD1, 0x19, 0x00, 0xC2, 0x43, 0x19,
+0x43, 0x00, 0xC7, 0x75, 0x2B, 0x5F, 0x95, 0x89, 0x0A, 0x44, 0x0A, 0x00, 0xC0, 0x63, 0x00, 0x4A,
+0x61, 0x4A, 0x4F, 0x7E, 0xCC, 0x44, 0x50, 0x0E, 0x03, 0x59, 0x03, 0xE8, 0x25, 0x3A, 0x25, 0x3A,
+0x25, 0x3A, 0x00, 0x65, 0x7A, 0x4F, 0x65, 0x52, 0x40, 0x0E, 0x41, 0x45, 0x43, 0x00, 0x44, 0x41,
+0x40, 0x44, 0x7F, 0x41, 0x48, 0x40, 0x03, 0x41, 0x00, 0x43, 0x42, 0x48, 0x43, 0x48, 0x44, 0x48,
+0x40, 0x01, 0xC3, 0x51, 0x08, 0x04, 0x08, 0x01, 0x42, 0x40, 0x01, 0x4A, 0x43, 0x00, 0xC6, 0x44,
+0x04, 0x30, 0x0B, 0x00, 0x01, 0x00, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x45, 0x42, 0x41, 0x00, 0x42, 0x00, 0x40, 0x5F, 0x45, 0x4F, 0x69, 0x42,
+0x45, 0x40, 0x42, 0x45, 0x41, 0x45, 0x00, 0x52, 0x69, 0x45, 0x41, 0x42, 0x00, 0x41, 0x40, 0x01,
+0x41, 0x42, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x01, 0x41, 0x40, 0x0D,
+0x4B, 0x41, 0x5C, 0xDA, 0x44, 0xBD, 0x21, 0x25, 0x2D, 0x02, 0x0F, 0x21, 0x25, 0x21, 0x25, 0x0B,
+0x02, 0x21, 0x89, 0x25, 0x0F, 0xD3, 0x0F, 0xD3, 0x25, 0xE8, 0x25, 0x2D, 0x3A, 0x9F, 0x19, 0x04,
+0xC0, 0x5F, 0x00, 0x59, 0xC1, 0xC8, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0xC5, 0x5B, 0x24, 0x5E,
+0x24, 0x5E, 0x24, 0x00, 0x74, 0xC1, 0x5E, 0x24, 0x00, 0xD1, 0x83, 0x5E, 0x24, 0x83, 0xC7, 0x83,
+0x5E, 0x5B, 0xF7, 0x1E, 0x04, 0x36, 0xA2, 0x1E, 0x28, 0x22, 0x01, 0x04, 0x00, 0x67, 0x68, 0x44,
+0xC0, 0xA2, 0x00, 0x52, 0x40, 0x0F, 0xC2, 0xE5, 0x82, 0x48, 0x01, 0xC2, 0x82, 0x7B, 0x82, 0x00,
+0xC2, 0x48, 0x82, 0x62, 0x00, 0xC0, 0x48, 0x00, 0xC0, 0x62, 0x01, 0xC1, 0x48, 0x62, 0x03, 0xC0,
+0x48, 0x00, 0x50, 0x56, 0x5C, 0x42, 0x03, 0x44, 0x00, 0x48, 0x44, 0x42, 0x65, 0x45, 0x00, 0x4F,
+0x5F, 0x45, 0x00, 0x4F, 0x5F, 0x45, 0x00, 0x4F, 0x5F, 0x45, 0x00, 0x4F, 0x5F, 0x45, 0x02, 0x41,
+0x43, 0x45, 0x40, 0x05, 0x41, 0x40, 0x0E, 0x43, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x01,
+0x41, 0x45, 0x01, 0x41, 0x45, 0x01, 0x41, 0x45, 0x41, 0x40, 0x03, 0x45, 0x42, 0x04, 0x44, 0x42,
+0x43, 0x48, 0x42, 0x50, 0xC4, 0x62, 0x82, 0x99, 0x48, 0x33, 0x00, 0x60, 0xC1, 0x99, 0x33, 0x00,
+0xC0, 0x62, 0x09, 0xC0, 0x48, 0x00, 0xC2, 0x7B, 0x01, 0x00, 0x0F, 0x67, 0xC3, 0xAA, 0x27, 0xA2,
+0x02, 0x00, 0x67, 0xCA, 0x90, 0x28, 0x36, 0x22, 0x01, 0x1E, 0xA2, 0x1E, 0xA2, 0x01, 0x00, 0x10,
+0x41, 0x40, 0x0A, 0x52, 0x40, 0x0E, 0x52, 0xDC, 0xD1, 0x19, 0x43, 0x19, 0x43, 0x9F, 0x19, 0x5F,
+0x6C, 0x19, 0xF3, 0xAF, 0x89, 0x44, 0x3A, 0xC5, 0x25, 0x01, 0x21, 0x0F, 0x21, 0x3A, 0x02, 0x2D,
+0x25, 0xBD, 0xC5, 0x1C, 0x25, 0x00, 0xC7, 0xD3, 0x0F, 0x25, 0xD3, 0x0F, 0x25, 0xD3, 0x25, 0x00,
+0x6D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x45, 0x42, 0x40, 0x41, 0x40, 0x41, 0xC3, 0x47, 0x00, 0x01,
+0x00, 0x05, 0x41, 0x42, 0x45, 0x40, 0x42, 0x00, 0x41, 0x00, 0x45, 0x01, 0x42, 0x00, 0x40, 0x5F,
+0x61, 0x67, 0x45, 0x00, 0x41, 0x00, 0x42, 0x40, 0x41, 0x42, 0x41, 0x40, 0x00, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x43, 0x44, 0x1B, 0x42, 0x5C, 0x44, 0x42, 0x00, 0x43, 0x4E,
+0x01, 0x44, 0x00, 0x42, 0x44, 0x42, 0x00, 0x4A, 0x4E, 0x00, 0x48, 0x42, 0x44, 0x00, 0x42, 0x00,
+0x44, 0x03, 0x42, 0x44, 0x05, 0x42, 0x44, 0x10, 0xC3, 0x44, 0x04, 0x44, 0x03, 0x00, 0x44, 0xC0,
+0x63, 0x00, 0x43, 0xC2, 0x63, 0x44, 0x63, 0x00, 0x43, 0xC3, 0x44, 0x63, 0x51, 0x63, 0x00, 0xC1,
+0x44, 0x63, 0x00, 0x43, 0xC9, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x59, 0xBC, 0x6C, 0x5C, 0x00,
+0xC3, 0x75, 0x11, 0x75, 0x6C, 0x00, 0xC3, 0x5C, 0x84, 0x89, 0x04, 0x1A, 0xC4, 0x89, 0x83, 0x34,
+0x83, 0x34, 0x02, 0xC1, 0x83, 0x34, 0x01, 0xC1, 0x83, 0x34, 0x00, 0xC0, 0x71, 0x00, 0xC4, 0xC7,
+0x34, 0x71, 0x26, 0x60, 0x01, 0x76, 0xC2, 0x60, 0x63, 0x60, 0x00, 0x44, 0x43, 0x66, 0xC3, 0x60,
+0x96, 0x60, 0x03, 0x00, 0x44, 0x0F, 0xC1, 0x6D, 0xAB, 0x02, 0x5A, 0xC1, 0xAB, 0x1A, 0x0A, 0xC1,
+0x72, 0x1A, 0x05, 0x4A, 0x01, 0xC1, 0x53, 0x0A, 0x01, 0x48, 0x4A, 0x70, 0x48, 0x4A, 0xC1, 0x50,
+0x0E, 0x13, 0x4A, 0x43, 0x44, 0x16, 0xC1, 0x53, 0x0E, 0x13, 0x48, 0x44, 0x02, 0x42, 0x43, 0x4A,
+0x04, 0x48, 0x4A, 0x48, 0x00, 0xC3, 0x58, 0x1A, 0xAB, 0x1A, 0x00, 0x73, 0xC2, 0xAB, 0x33, 0x1A,
+0x00, 0x73, 0x5A, 0x00, 0xC2, 0xAB, 0x1A, 0xAB, 0x01, 0x5A, 0xC0, 0xAB, 0x04, 0x5A, 0xC1, 0x96,
+0x04, 0x0F, 0xC1, 0x60, 0x03, 0x01, 0xC2, 0x60, 0x36, 0x60, 0x00, 0x76, 0x43, 0xC1, 0x60, 0x03,
+0x00, 0xC4, 0x60, 0x03, 0x26, 0x03, 0x04, 0x10, 0xC1, 0x44, 0x04, 0x02, 0xC1, 0x44, 0x04, 0x17,
+0xCB, 0x8F, 0x5F, 0x6C, 0x75, 0x5C, 0x5F, 0x75, 0x5F, 0x6C, 0x75, 0x86, 0x44, 0x00, 0xC3, 0x89,
+0x50, 0x51, 0x63, 0x08, 0xC1, 0x44, 0x63, 0x02, 0xC1, 0x50, 0x63, 0x00, 0xC1, 0x50, 0x63, 0x00,
+0xC2, 0x50, 0x03, 0x63, 0x00, 0x44, 0x12, 0x42, 0x44, 0x0D, 0x42, 0x44, 0x00, 0x42, 0x00, 0x44,
+0x4A, 0x4E, 0x00, 0x43, 0x42, 0x00, 0x44, 0x01, 0x43, 0x4E, 0x01, 0x44, 0x42, 0x00, 0x44, 0x42,
+0x44, 0x18, 0x42, 0x41, 0x44, 0x42, 0x08, 0x44, 0x42, 0x17, 0x45, 0x42, 0x06, 0x45, 0x42, 0x08,
+0x44, 0x42, 0x0C, 0x44, 0x42, 0x0D, 0x5C, 0x42, 0x19, 0x5C, 0x42, 0x61, 0x00, 0x42, 0x61, 0xC2,
+0xBD, 0x29, 0x02, 0x00, 0xC2, 0xC5, 0x8C, 0x02, 0x1A, 0x7F, 0x44, 0x42, 0x01, 0x61, 0x42, 0x01,
+0x61, 0x42, 0x00, 0x69, 0x61, 0x00, 0xC1, 0xBD, 0x02, 0x0C, 0x68, 0x42, 0x02, 0x68, 0x4C, 0x46,
+0x28, 0xC1, 0xCA, 0x06, 0x0B, 0x43, 0x45, 0x00, 0x61, 0xD3, 0xAA, 0x21, 0x05, 0x21, 0x28, 0x21,
+0x05, 0x21, 0x28, 0x21, 0x05, 0x21, 0x28, 0x21, 0x05, 0x28, 0x21, 0x28, 0x21, 0x02, 0x06, 0x44,
+0x42, 0x0F, 0x68, 0x45, 0x61, 0x45, 0x68, 0x61, 0x45, 0x00, 0x68, 0x61, 0x45, 0x00, 0x68, 0x61,
+0x45, 0x00, 0x68, 0x61, 0x45, 0x00, 0x68, 0x42, 0x04, 0x44, 0x48, 0x06, 0x43, 0x48, 0xC1, 0x59,
+0x33, 0x03, 0xC4, 0xAB, 0x99, 0x33, 0x99, 0x33, 0x00, 0xC1, 0xAB, 0x33, 0x00, 0x5A, 0x73, 0x00,
+0x5A, 0x73, 0x00, 0x5A, 0x73, 0x02, 0x56, 0x42, 0xC1, 0xBD, 0x02, 0x1D, 0xC1, 0x50, 0x83, 0x02,
+0xC1, 0x9C, 0x83, 0x03, 0x74, 0xC0, 0x83, 0x04, 0x74, 0xC1, 0x50, 0x02, 0x0A, 0x44, 0x70, 0x66,
+0x00, 0x70, 0x66, 0x00, 0x70, 0x66, 0x70, 0x66, 0x70, 0x00, 0x66, 0x00, 0x70, 0x00, 0xC2, 0x60,
+0x8F, 0x5F, 0x01, 0xC3, 0x75, 0x5F, 0x6C, 0x5F, 0x01, 0xCA, 0x59, 0x89, 0x44, 0x89, 0x04, 0x44,
+0x04, 0x44, 0x04, 0x89, 0x04, 0x00, 0xD0, 0x44, 0x89, 0x04, 0x44, 0x89, 0x04, 0x44, 0x89, 0x04,
+0x89, 0x04, 0x44, 0x89, 0x04, 0x44, 0x89, 0x04, 0x01, 0x42, 0x20, 0x5C, 0x42, 0x06, 0x69, 0x42,
+0x06, 0x61, 0x68, 0x61, 0x42, 0x06, 0x44, 0x42, 0x07, 0x5C, 0x42, 0x0B, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x4B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19,
+0xC1, 0x47, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x4B, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x4B, 0x67,
+0x40, 0x0D, 0x4C, 0x46, 0x13, 0xC1, 0x73, 0x06, 0x11, 0xC1, 0x73, 0x06, 0x00, 0x4C, 0x4E, 0xC0,
+0x68, 0x00, 0x4C, 0x46, 0xC2, 0x77, 0x68, 0x0E, 0x00, 0xC3, 0x73, 0x06, 0x02, 0x00, 0x1C, 0x41,
+0x40, 0x2A, 0x45, 0x44, 0x42, 0x03, 0x5C, 0x42, 0x44, 0x43, 0x42, 0xCD, 0x7B, 0x48, 0x82, 0x7B,
+0x62, 0x7B, 0x82, 0x7B, 0x62, 0x99, 0x7B, 0x62, 0x7B, 0x62, 0x00, 0xC1, 0x82, 0x62, 0x00, 0xC1,
+0x7B, 0x62, 0x00, 0xC1, 0x7B, 0x48, 0x00, 0xC2, 0x7B, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0C, 0x4B,
+0xC1, 0xB6, 0x24, 0x00, 0xC6, 0xAC, 0xEE, 0x24, 0xAC, 0x24, 0xAC, 0x24, 0x00, 0xC1, 0xAC, 0x24,
+0x05, 0xC1, 0xE7, 0x00, 0x0A, 0x5F, 0x57, 0x01, 0xC1, 0x96, 0x17, 0x00, 0x77, 0xC2, 0x8C, 0x28,
+0x17, 0x02, 0x68, 0x57, 0x00, 0x68, 0xC5, 0xC8, 0x19, 0x43, 0x19, 0x43, 0x19, 0x00, 0xC0, 0x9F,
+0x00, 0x59, 0xC1, 0x95, 0x2D, 0x00, 0x65, 0x6D, 0xD6, 0xD3, 0x25, 0x2D, 0xD3, 0x01, 0xD3, 0x2D,
+0x01, 0x25, 0x0F, 0xD3, 0x3A, 0xD3, 0x0F, 0xD3, 0x25, 0x3A, 0x25, 0xE8, 0x25, 0x0F, 0xD3, 0x25,
+0x00, 0xC2, 0xD3, 0x01, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x67, 0x41, 0x40, 0x45, 0x41, 0x40, 0x41,
+0x45, 0x40, 0x03, 0x45, 0x41, 0x40, 0x41, 0x00, 0x40, 0x03, 0x41, 0x40, 0x00, 0x41, 0x40, 0x01,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x41, 0x67, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x4F, 0x52, 0x40, 0x52, 0x40,
+0x52, 0x40, 0x52, 0x40, 0x00, 0x41, 0x52, 0x40, 0x0D, 0x67, 0x4B, 0x40, 0x0A, 0x41, 0x40, 0x4B,
+0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x03, 0x41, 0x00, 0x40, 0x0A,
+0x4B, 0x40, 0x00, 0x63, 0x46, 0x10, 0xC1, 0x73, 0x06, 0x08, 0xC1, 0x73, 0x06, 0x01, 0xC1, 0x73,
+0x06, 0x01, 0xC1, 0x73, 0x06, 0x01, 0xD0, 0x73, 0x06, 0x23, 0x36, 0x0A, 0x58, 0x23, 0x01, 0x0C,
+0x6D, 0x0A, 0x96, 0x08, 0x0A, 0x06, 0x02, 0x00, 0x16, 0x45, 0x44, 0x40, 0x02, 0x41, 0x40, 0x08,
+0x42, 0x00, 0x40, 0x1E, 0x45, 0x44, 0x02, 0x42, 0x43, 0x63, 0x43, 0x4E, 0x00, 0x44, 0xCC, 0x7B,
+0x62, 0x78, 0xDE, 0x62, 0xAB, 0xDE, 0x7B, 0xAB, 0xDE, 0xAB, 0x62, 0x48, 0x0A, 0xC2, 0x82, 0x4F,
+0x00, 0x0F, 0x41, 0x40, 0x0B, 0x6D, 0x4B, 0xC3, 0xB6, 0x5E, 0x9C, 0x83, 0x00, 0xC1, 0x9C, 0x83,
+0x00, 0x74, 0xC3, 0x83, 0x9C, 0x83, 0x24, 0x05, 0xC2, 0xB6, 0x0B, 0x00, 0x09, 0x5F, 0x7F, 0x57,
+0xC0, 0x98, 0x00, 0xC2, 0x6D, 0x96, 0x98, 0x00, 0xC7, 0x74, 0x98, 0x37, 0x17, 0x96, 0x92, 0x96,
+0x17, 0x00, 0xC1, 0xC8, 0x19, 0x01, 0xC1, 0x9F, 0x19, 0x00, 0xC5, 0x43, 0x2A, 0x43, 0x95, 0xD3,
+0x59, 0x00, 0xC0, 0x50, 0x00, 0x6D, 0xC6, 0x50, 0x04, 0x59, 0x86, 0x04, 0xD3, 0x3A, 0x00, 0x65,
+0x7A, 0x04, 0x65, 0x7A, 0x00, 0x65, 0x7A, 0x00, 0x65, 0x4F, 0x65, 0x52, 0x40, 0x0E, 0x41, 0x00,
+0x43, 0x44, 0x40, 0x00, 0x44, 0x00, 0x41, 0x48, 0x42, 0x40, 0x03, 0x41, 0x40, 0x44, 0x43, 0x00,
+0x44, 0x4A, 0x43, 0x00, 0x40, 0x01, 0x44, 0x4A, 0x48, 0x42, 0x48, 0x00, 0x42, 0x40, 0x41, 0x40,
+0x48, 0x00, 0x42, 0x43, 0x4A, 0x42, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x4B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x08, 0x4B, 0x00, 0x41, 0x40,
+0x0F, 0x6D, 0x41, 0x40, 0x07, 0x52, 0x40, 0x01, 0x4B, 0x40, 0x4C, 0x46, 0x26, 0xC1, 0x73, 0x06,
+0x00, 0xCE, 0x58, 0x0C, 0x32, 0x0E, 0x23, 0x02, 0x51, 0x70, 0x49, 0x23, 0x73, 0x03, 0x73, 0x02,
+0x00, 0x16, 0x45, 0x43, 0x40, 0x02, 0x41, 0x40, 0x08, 0x44, 0x00, 0x40, 0x1E, 0x45, 0x44, 0x00,
+0x5C, 0x44, 0x00, 0x4A, 0x4E, 0x43, 0x4E, 0x4A, 0x76, 0x50, 0xC1, 0x82, 0x78, 0x00, 0xC1, 0x7B,
+0x66, 0x00, 0x5A, 0xC3, 0x66, 0x20, 0x66, 0x48, 0x02, 0xC1, 0x62, 0x48, 0x06, 0x60, 0x5F, 0x40,
+0x0E, 0x4B, 0x41, 0x40, 0x09, 0x52, 0x40, 0x4B, 0x00, 0xCD, 0xD4, 0x83, 0xC2, 0x83, 0x9C, 0x5E,
+0x83, 0xC2, 0x34, 0x52, 0x83, 0x9C, 0x14, 0x24, 0x04, 0xC2, 0xD4, 0x0B, 0x00, 0x09, 0x41, 0x77,
+0x00, 0xCD, 0x98, 0x99, 0xAD, 0x98, 0x96, 0x28, 0x04, 0x98, 0x96, 0x17, 0x96, 0x98, 0xAD, 0x17,
+0x00, 0xC1, 0xD2, 0x19, 0x03, 0xD2, 0x43, 0x75, 0x2B, 0x5F, 0xC5, 0x16, 0x50, 0x05, 0x53, 0x4A,
+0x21, 0x64, 0x59, 0x58, 0x21, 0x3E, 0x05, 0x25, 0x3A, 0x00, 0x65, 0x7A, 0x65, 0x7A, 0x65, 0x7A,
+0x00, 0x65, 0x7A, 0x00, 0x65, 0x7A, 0x65, 0x7A, 0x4F, 0x40, 0x0F, 0x41, 0x00, 0x42, 0x4A, 0x41,
+0x40, 0x42, 0x43, 0x40, 0x45, 0x4A, 0x41, 0x40, 0x02, 0x41, 0x40, 0x43, 0x48, 0x44, 0x42, 0x44,
+0x40, 0x4A, 0x45, 0x40, 0x00, 0x43, 0x4A, 0x00, 0x48, 0x43, 0x45, 0x43, 0x40, 0x00, 0x45, 0x48,
+0x41, 0x4A, 0x48, 0x41, 0x48, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x67, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x18, 0x71, 0x65, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x00, 0x71, 0x40, 0x0B,
+0x41, 0xC1, 0x47, 0x00, 0x08, 0x4B, 0x00, 0x41, 0x40, 0x0C, 0x6D, 0x4B, 0x40, 0x41, 0x00, 0x40,
+0x0D, 0x63, 0x46, 0x28, 0xC6, 0x73, 0x4A, 0x96, 0x03, 0x02, 0x0E, 0x0A, 0x00, 0x42, 0x4E, 0x43,
+0x4A, 0x48, 0x46, 0x42, 0x40, 0x16, 0x45, 0x43, 0x40, 0x02, 0x41, 0x40, 0x08, 0x42, 0x44, 0x40,
+0x1E, 0x45, 0x44, 0x01, 0x42, 0x48, 0x4E, 0x4C, 0x48, 0xCE, 0x44, 0x58, 0x49, 0x15, 0x48, 0x82,
+0x78, 0x33, 0xE0, 0x66, 0xDE, 0x66, 0x20, 0x66, 0x48, 0x02, 0xC1, 0x82, 0x48, 0x01, 0xC1, 0x82,
+0x48, 0x02, 0xC4, 0x82, 0xDA, 0x0B, 0x12, 0x00, 0x0D, 0x41, 0x40, 0x0C, 0x4B, 0xCC, 0xB6, 0x24,
+0x83, 0xC2, 0x3B, 0xAC, 0x5E, 0x2B, 0x9C, 0x5B, 0x9C, 0x5E, 0x24, 0x04, 0xC3, 0x5E, 0xB6, 0x0B,
+0x00, 0x09, 0x4F, 0x7F, 0x57, 0xCB, 0x60, 0x51, 0x92, 0x98, 0x96, 0x28, 0x96, 0x98, 0x8C, 0x17,
+0x28, 0x74, 0x00, 0x57, 0xC2, 0x90, 0xD2, 0x19, 0x00, 0xC1, 0x43, 0x19, 0x01, 0x6B, 0x00, 0xCF,
+0x75, 0xF3, 0x44, 0x50, 0x2D, 0x50, 0x71, 0x0E, 0x86, 0x59, 0x08, 0x3A, 0x0A, 0xBD, 0x0F, 0x3A,
+0x0F, 0x4B, 0x52, 0x40, 0x0D, 0x41, 0x40, 0x42, 0x4A, 0x41, 0x40, 0x45, 0x43, 0x40, 0x44, 0x42,
+0x40, 0x03, 0x41, 0x00, 0x42, 0x45, 0x4A, 0x43, 0x44, 0x40, 0x4A, 0x45, 0x40, 0x00, 0x43, 0x44,
+0x42, 0x4E, 0x44, 0x42, 0x43, 0x40, 0x00, 0x45, 0x48, 0x45, 0x4A, 0x43, 0x45, 0x48, 0x40, 0x00,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x4B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x71, 0x40, 0x18, 0x41, 0x71, 0x40, 0x52,
+0x71, 0x40, 0x03, 0x4F, 0x40, 0x00, 0x4B, 0x40, 0x4B, 0x52, 0x6D, 0x40, 0x08, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0C, 0x4B, 0x00, 0x40, 0x6D, 0x65, 0x40, 0x0D, 0x4C, 0x46, 0x2A, 0xCD, 0x8D, 0x0A,
+0x35, 0x68, 0x0C, 0xCA, 0x23, 0x35, 0x0A, 0x0E, 0x68, 0x06, 0x02, 0x00, 0x16, 0x45, 0x43, 0x40,
+0x02, 0x41, 0x40, 0x08, 0x42, 0x44, 0x40, 0x1E, 0x45, 0x44, 0x42, 0x44, 0x01, 0x48, 0x4E, 0x48,
+0x4E, 0x00, 0xC4, 0x96, 0x7B, 0x48, 0x33, 0xAB, 0x00, 0xC2, 0x99, 0x62, 0xAB, 0x00, 0xC3, 0xDE,
+0xAB, 0x62, 0x48, 0x05, 0xC1, 0x62, 0x48, 0x02, 0xC2, 0x82, 0x25, 0x00, 0x0F, 0x41, 0x40, 0x0C,
+0x4B, 0xC5, 0xB6, 0x5E, 0x9B, 0x9C, 0x83, 0x9C, 0x00, 0xC6, 0x83, 0x34, 0x9C, 0xC2, 0x83, 0x5E,
+0x24, 0x00, 0xC1, 0x5E, 0x24, 0x01, 0xC2, 0xE4, 0x0B, 0x00, 0x09, 0x5F, 0x68, 0x44, 0xC0, 0x74,
+0x00, 0xC5, 0x99, 0x8C, 0x98, 0x49, 0xAD, 0x98, 0x00, 0xC2, 0x60, 0x8C, 0x96, 0x00, 0x68, 0xC2,
+0x90, 0xD2, 0x19, 0x03, 0xCD, 0x9F, 0x5F, 0x75, 0x5F, 0x95, 0xB7, 0x0A, 0x59, 0x03, 0x44, 0x3E,
+0x04, 0x44, 0x86, 0x00, 0xC2, 0x59, 0x25, 0x3A, 0x00, 0x65, 0x7A, 0x65, 0x7A, 0x65, 0x7A, 0x65,
+0x7A, 0x65, 0x7A, 0x65, 0x7A, 0x4F, 0x65, 0x7A, 0x4F, 0x6D, 0x40, 0x0E, 0x41, 0x45, 0x48, 0x43,
+0x42, 0x00, 0x44, 0x4E, 0x5C, 0x4E, 0x44, 0x40, 0x03, 0x41, 0x40, 0x44, 0x48, 0x43, 0x42, 0x4A,
+0x48, 0x44, 0x40, 0x01, 0x44, 0x4A, 0x48, 0x42, 0x43, 0x4A, 0x45, 0x40, 0x01, 0x43, 0x48, 0x42,
+0x44, 0x4A, 0x42, 0x40, 0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x67, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19,
+0x41, 0x40, 0x07, 0xC1, 0x47, 0x00, 0x0E, 0x52, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x71, 0x41, 0x40,
+0x0D, 0x63, 0x46, 0x36, 0x42, 0x44, 0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x01, 0x44, 0x45, 0x44, 0x40, 0x02,
+0x41, 0x40, 0x08, 0x42, 0x00, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x42, 0x40, 0x0B, 0x45, 0x42, 0x08, 0x68, 0x50, 0xC0,
+0x62, 0x00, 0x49, 0xC0, 0x62, 0x00, 0xC0, 0x7B, 0x00, 0xC4, 0x62, 0x7B, 0x15, 0x62, 0x7B, 0x00,
+0xC7, 0x62, 0x7B, 0x62, 0x7B, 0x62, 0x7B, 0x62, 0x7B, 0x01, 0x50, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0D, 0xC1, 0xD4, 0x5E, 0x00, 0x64, 0x54, 0xC9, 0x5E, 0x24, 0xAC, 0x24, 0x5E, 0xD0, 0x5E, 0x24,
+0x5E, 0x14, 0x00, 0xC5, 0x5E, 0x14, 0x5E, 0xE4, 0x0B, 0x00, 0x09, 0x45, 0x76, 0x77, 0x76, 0x43,
+0x76, 0x04, 0xC0, 0x60, 0x00, 0xC3, 0xA4, 0x37, 0xA4, 0x37, 0x00, 0xC5, 0xD2, 0x43, 0xBC, 0x43,
+0x5F, 0x43, 0x03, 0xC6, 0xF3, 0x25, 0x3A, 0x21, 0x25, 0x0F, 0x25, 0x00, 0x4F, 0x7A, 0x45, 0x4F,
+0x65, 0x4F, 0x65, 0x7A, 0x65, 0x4F, 0x65, 0x7A, 0x65, 0x4F, 0x65, 0x7A, 0x65, 0x4F, 0x65, 0x00,
+0x4F, 0x65, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x41, 0x40, 0x02, 0x41, 0x40, 0x67, 0x41, 0x40, 0x03,
+0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x42, 0x43, 0x00, 0x45, 0x40, 0x41, 0x40,
+0x01, 0x45, 0x43, 0x00, 0x44, 0x41, 0x67, 0x40, 0x00, 0x41, 0x40, 0x01, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x4A, 0x43, 0x48, 0x08, 0x43, 0x48, 0x0D, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x02, 0x43, 0x48, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x00, 0x43, 0x48, 0x0C, 0x43, 0x48, 0x0D, 0xC1, 0x53, 0x08, 0x17, 0xC8,
+0x58, 0x3E, 0x84, 0x3E, 0x84, 0x3E, 0x84, 0x3E, 0x84, 0x00, 0x7E, 0xD2, 0x5A, 0x49, 0x58, 0x49,
+0x30, 0x49, 0x30, 0x49, 0x58, 0x0A, 0x58, 0x49, 0x0A, 0x58, 0x0A, 0x49, 0x0A, 0x58, 0x08, 0x0A,
+0xD6, 0x59, 0x86, 0x3E, 0x71, 0x3E, 0x71, 0x3E, 0x71, 0x3E, 0x71, 0x3E, 0x71, 0x3E, 0x71, 0x3E,
+0x0A, 0x71, 0x3E, 0x71, 0x86, 0x58, 0x03, 0x08, 0x0B, 0x43, 0x63, 0x4C, 0x0F, 0xC1, 0x77, 0xC4,
+0x00, 0xC1, 0xB5, 0xC4, 0x10, 0xC1, 0xB5, 0xC4, 0x00, 0xC3, 0xB5, 0xC4, 0x68, 0x35, 0x09, 0x4A,
+0x00, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E,
+0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x00, 0x4E, 0x4A, 0x48, 0x01, 0x43, 0x48, 0x03, 0x43, 0x48, 0x07,
+0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E,
+0x4A, 0x4E, 0x4A, 0x48, 0x0A, 0x43, 0x4E, 0x4C, 0x0A, 0xC3, 0xC4, 0xE0, 0x0C, 0xC4, 0x02, 0x4C,
+0xC0, 0xC4, 0x00, 0xC2, 0xE0, 0x0C, 0xC4, 0x00, 0xC5, 0xE0, 0x0C, 0xC4, 0xE0, 0x0C, 0xC4, 0x01,
+0xC4, 0xE0, 0x0C, 0x9E, 0x0E, 0x23, 0x00, 0x4E, 0x63, 0x00, 0xC9, 0x64, 0x23, 0x8D, 0x23, 0x64,
+0x23, 0x8D, 0x23, 0x0E, 0x23, 0x00, 0x4A, 0x43, 0x48, 0x0A, 0x43, 0x48, 0xC1, 0x86, 0x3E, 0x09,
+0x74, 0xC3, 0x71, 0x3E, 0x71, 0x3E, 0x01, 0x4A, 0x43, 0x48, 0x66, 0x48, 0x06, 0xC3, 0x59, 0x4A,
+0xA7, 0x5A, 0x02, 0xC1, 0xA7, 0x5A, 0x02, 0xC2, 0xA7, 0x5A, 0xA7, 0x01, 0xC9, 0x5A, 0x3E, 0x2F,
+0x84, 0x4A, 0x84, 0x9B, 0x84, 0x4A, 0x84, 0x00, 0xC3, 0x8F, 0x3E, 0x53, 0x08, 0x00, 0xC5, 0x53,
+0x08, 0x86, 0x08, 0x53, 0x08, 0x02, 0xC1, 0x53, 0x08, 0x00, 0xC3, 0x53, 0x08, 0x53, 0x08, 0x00,
+0xC6, 0x53, 0x08, 0x53, 0x08, 0x53, 0x58, 0x08, 0x01, 0xC2, 0x86, 0x03, 0x08, 0x10, 0x43, 0x48,
+0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x02, 0x43, 0x48, 0x02, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x4A, 0x4E, 0x4A, 0x00, 0x43, 0x48, 0x03, 0x4A, 0x4E, 0x4A, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x03, 0x43, 0x48, 0x03, 0x43, 0x48, 0x0C, 0x42, 0x41, 0x44, 0x40, 0x41, 0x40, 0x05, 0x41, 0x01,
+0x40, 0x0C, 0x41, 0x00, 0x40, 0x01, 0x67, 0x40, 0x00, 0x4B, 0x67, 0x4B, 0x41, 0x40, 0x01, 0x41,
+0x40, 0x06, 0x41, 0x40, 0x00, 0x41, 0x4B, 0x41, 0x00, 0x40, 0x0B, 0x41, 0x01, 0x40, 0x09, 0x4B,
+0x01, 0x65, 0x45, 0x7A, 0x17, 0xC1, 0xBD, 0x43, 0x00, 0xC1, 0x5F, 0x43, 0x00, 0xC1, 0x5F, 0x43,
+0x01, 0xCD, 0x5F, 0x9A, 0x3F, 0xA4, 0x17, 0x3F, 0x17, 0x3F, 0x37, 0x28, 0x37, 0x28, 0x3F, 0x37,
+0x00, 0x68, 0x77, 0x7F, 0x44, 0x41, 0x52, 0x6D, 0x40, 0x03, 0x4B, 0x00, 0x71, 0x52, 0x6D, 0xCF,
+0x67, 0x5E, 0x24, 0x5E, 0x24, 0x5E, 0x24, 0x5E, 0x24, 0x5E, 0x24, 0x5E, 0x24, 0x5E, 0x24, 0x5E,
+0x00, 0x64, 0xC2, 0x5E, 0xB6, 0x00, 0x0C, 0xC2, 0x47, 0x01, 0x00, 0x0F, 0xC2, 0x4F, 0x82, 0x7B,
+0x00, 0xC1, 0x62, 0x48, 0x0F, 0xC0, 0x62, 0x00, 0xC5, 0x48, 0x62, 0x10, 0x16, 0x02, 0x1C, 0x02,
+0x42, 0x00, 0x5C, 0x42, 0x00, 0x5C, 0x41, 0x40, 0x19, 0x41, 0x40, 0xC4, 0x47, 0x0F, 0x47, 0x12,
+0x00, 0x28, 0x4E, 0x46, 0x1E, 0xC1, 0x73, 0x06, 0x13, 0x48, 0x40, 0x07, 0x4B, 0x00, 0x40, 0x00,
+0x41, 0x4B, 0x7A, 0x4B, 0x52, 0x40, 0x52, 0x40, 0x52, 0x40, 0x52, 0x4B, 0x40, 0x6D, 0x40, 0x00,
+0xC2, 0x47, 0x2D, 0x0B, 0x01, 0x65, 0x41, 0x4B, 0x71, 0x4B, 0x01, 0x40, 0x03, 0x41, 0x4A, 0x52,
+0x00, 0x40, 0x03, 0x52, 0x40, 0x52, 0x40, 0x01, 0x52, 0x40, 0x00, 0x4F, 0x7E, 0xC1, 0xD9, 0x00,
+0x00, 0x52, 0x40, 0x01, 0xDF, 0x47, 0x00, 0x1F, 0x47, 0x12, 0x2D, 0x12, 0x0B, 0x12, 0x0B, 0x12,
+0x31, 0x0B, 0x12, 0x31, 0x00, 0x2D, 0x0B, 0x27, 0x0B, 0x00, 0x2D, 0x47, 0x00, 0x2D, 0x00, 0x0B,
+0x31, 0x0B, 0x00, 0x0B, 0x27, 0x41, 0x00, 0x40, 0x0E, 0x41, 0x01, 0x40, 0x01, 0x41, 0x40, 0x4B,
+0x67, 0x4B, 0x40, 0x02, 0x41, 0x01, 0x40, 0x00, 0x41, 0x40, 0x01, 0x41, 0x40, 0x03, 0x41, 0x40,
+0x06, 0x4B, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x01, 0x40, 0x04, 0x41, 0x02, 0x40, 0x07, 0x41,
+0x00, 0x45, 0x40, 0x44, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x42, 0x43, 0x5F, 0x61, 0x43,
+0x44, 0x67, 0x40, 0x01, 0x42, 0x43, 0x42, 0x40, 0x44, 0x42, 0x40, 0x02, 0x44, 0x42, 0x40, 0x41,
+0x42, 0x40, 0x00, 0x41, 0x02, 0x40, 0x01, 0x41, 0x40, 0x41, 0x00, 0x40, 0x03, 0x41, 0x40, 0x0B,
+0x4B, 0x00, 0x6D, 0x65, 0x00, 0x42, 0x61, 0x7A, 0x02, 0x61, 0x7A, 0x10, 0xC1, 0x9F, 0x19, 0x03,
+0xCB, 0x9F, 0x5F, 0x75, 0x43, 0x95, 0x17, 0x8C, 0x96, 0x98, 0x96, 0xAD, 0x74, 0x00, 0x77, 0x57,
+0x70, 0x68, 0x57, 0x77, 0x00, 0x68, 0x7F, 0x67, 0x6D, 0x40, 0x05, 0x4B, 0x40, 0x52, 0xC4, 0xD3,
+0x5B, 0x24, 0x5E, 0x24, 0x00, 0xC3, 0x5E, 0x24, 0x5E, 0x24, 0x09, 0xC1, 0xE7, 0x00, 0x0D, 0x41,
+0x40, 0x0E, 0x6D, 0xC1, 0x8E, 0x48, 0x00, 0xC9, 0x82, 0x48, 0x99, 0x82, 0x48, 0x99, 0x82, 0x48,
+0x99, 0x48, 0x0C, 0xC3, 0x7B, 0x44, 0x1C, 0x04, 0x02, 0x43, 0x00, 0x42, 0x43, 0x00, 0x42, 0x41,
+0x40, 0x19, 0x45, 0x41, 0x40, 0x41, 0x40, 0x00, 0x45, 0xC1, 0x47, 0x00, 0x26, 0x4E, 0x46, 0x0D,
+0xC1, 0x73, 0x06, 0x00, 0xC1, 0x73, 0x06, 0x00, 0xC1, 0x73, 0x06, 0x00, 0xC1, 0x73, 0x06, 0x01,
+0xC1, 0x73, 0x06, 0x0B, 0x75, 0x44, 0x4E, 0x46, 0x00, 0x4E, 0x43, 0x4C, 0x4A, 0xC4, 0x73, 0x0E,
+0x68, 0x0A, 0x00, 0x08, 0x4B, 0x00, 0x40, 0x01, 0x41, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B,
+0x40, 0x09, 0x65, 0x40, 0x02, 0x4B, 0x40, 0x04, 0x4F, 0x7E, 0x6D, 0x40, 0x02, 0x71, 0x40, 0x01,
+0x71, 0x40, 0x04, 0x4F, 0xC5, 0x5A, 0x2D, 0x31, 0x00, 0x12, 0x00, 0x02, 0x52, 0x4F, 0x52, 0x40,
+0x02, 0x52, 0x40, 0x15, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x76, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x45, 0x4A,
+0x5C, 0x76, 0xC4, 0x6D, 0x36, 0x51, 0x26, 0x00, 0x01, 0x4E, 0x44, 0x4A, 0x76, 0x66, 0x48, 0x45,
+0x40, 0x4B, 0x42, 0x66, 0x48, 0x69, 0x4A, 0x00, 0x52, 0x40, 0x41, 0x40, 0x42, 0x4A, 0x42, 0x40,
+0x45, 0x4A, 0x41, 0x44, 0x4A, 0x41, 0x40, 0x02, 0x41, 0x40, 0x0D, 0x6D, 0x5F, 0xC0, 0x86, 0x00,
+0xCA, 0x50, 0x89, 0x21, 0x59, 0x53, 0xBD, 0x25, 0x3A, 0x25, 0xB7, 0x3A, 0x00, 0x65, 0xC1, 0xB7,
+0x3A, 0x00, 0x65, 0xC1, 0xB7, 0x3A, 0x00, 0x65, 0x7A, 0x65, 0xC2, 0xE7, 0x43, 0x19, 0x00, 0xC1,
+0x43, 0x19, 0x00, 0xCD, 0x5F, 0x2B, 0x75, 0x5F, 0x95, 0x17, 0x04, 0x98, 0x74, 0xAD, 0x98, 0x60,
+0x98, 0xAD, 0x00, 0xC9, 0xCF, 0x96, 0x04, 0xAB, 0x74, 0x17, 0x3F, 0xD3, 0x0B, 0x00, 0x07, 0x71,
+0x40, 0xC2, 0x5B, 0x83, 0x9C, 0x00, 0x7B, 0xC5, 0x9C, 0x83, 0x9B, 0x9C, 0x14, 0x24, 0x01, 0xC1,
+0x5E, 0x24, 0x02, 0xC2, 0x5E, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC8, 0xE5, 0x48, 0xAB, 0x66,
+0x48, 0xDE, 0x66, 0x1A, 0x66, 0x00, 0xC2, 0x82, 0x7B, 0x48, 0x0C, 0xC2, 0x7B, 0x16, 0x04, 0x01,
+0x42, 0x00, 0x63, 0x4A, 0x42, 0xC4, 0x9E, 0x0E, 0x3F, 0x01, 0x00, 0x17, 0x52, 0x40, 0xC4, 0x44,
+0x02, 0x00, 0x01, 0x00, 0x00, 0x43, 0x41, 0x40, 0x26, 0x4E, 0x46, 0x28, 0xCD, 0x68, 0x0E, 0x03,
+0x06, 0x73, 0x0C, 0x03, 0x0E, 0x03, 0x0C, 0x44, 0x06, 0x08, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x09, 0x6D, 0xC2, 0x5A, 0x2D, 0x12, 0x00, 0x4B, 0x40, 0x0A, 0x41, 0x7E, 0x52, 0x40, 0x01,
+0x52, 0x40, 0x02, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x76, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0xC8, 0x47,
+0x04, 0x0A, 0x36, 0x50, 0x0F, 0x25, 0x5A, 0x00, 0x01, 0x4E, 0x48, 0x4A, 0x00, 0x45, 0x76, 0x42,
+0x40, 0x4B, 0xCD, 0x51, 0x02, 0x16, 0x44, 0x21, 0x03, 0x12, 0x00, 0x0B, 0x27, 0x05, 0x08, 0x02,
+0x00, 0x00, 0x48, 0x41, 0x45, 0x4A, 0x45, 0x40, 0x02, 0x41, 0x40, 0x0D, 0x4B, 0xCB, 0x89, 0x53,
+0x00, 0x44, 0x26, 0x4F, 0x0C, 0x50, 0x2D, 0x3A, 0xB7, 0x3A, 0x00, 0xC6, 0xB7, 0x3A, 0xB7, 0x25,
+0x3A, 0xB7, 0x3A, 0x00, 0xC4, 0xB7, 0x3A, 0xB7, 0x25, 0x3A, 0x00, 0xC1, 0x9F, 0x19, 0x03, 0xC1,
+0x5F, 0x75, 0x00, 0xC2, 0xBC, 0x95, 0x17, 0x00, 0xC7, 0x74, 0x70, 0x6D, 0x58, 0x8C, 0x04, 0x1A,
+0x99, 0x00, 0xC4, 0x98, 0x28, 0x20, 0x74, 0x17, 0x00, 0x41, 0x40, 0x09, 0x4B, 0xC4, 0x5B, 0x9C,
+0x83, 0x5B, 0x9C, 0x00, 0x54, 0xC2, 0x5E, 0x9B, 0x24, 0x08, 0x7A, 0x40, 0x0D, 0x41, 0x40, 0x0D,
+0x52, 0x6D, 0xCB, 0x8E, 0x48, 0x33, 0x78, 0x33, 0xDE, 0x66, 0xCF, 0x33, 0x72, 0x1A, 0x7B, 0x00,
+0xC9, 0x62, 0x48, 0x7B, 0x48, 0x99, 0x48, 0x82, 0x48, 0x99, 0x48, 0x02, 0x60, 0x56, 0x44, 0x42,
+0x44, 0x00, 0x48, 0x4E, 0xC6, 0x58, 0x08, 0x0E, 0x0A, 0x02, 0x01, 0x00, 0x19, 0xC4, 0x44, 0x3F,
+0x00, 0x1F, 0x00, 0x00, 0x43, 0x41, 0x40, 0x26, 0x4E, 0x46, 0x28, 0x75, 0x4C, 0x43, 0xC0, 0x73,
+0x00, 0x4C, 0x4E, 0x00, 0x63, 0x45, 0x4E, 0x46, 0x48, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x09, 0x6D, 0xC5, 0x5A, 0x2D, 0x12, 0x00, 0x31, 0x00, 0x0A, 0x41, 0x7E, 0x4B, 0x40, 0x00, 0x52,
+0x40, 0x03, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x76, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x76,
+0x69, 0xC5, 0x49, 0x53, 0x28, 0x44, 0x03, 0x00, 0x01, 0x4A, 0x45, 0x43, 0x4A, 0x44, 0x70, 0x45,
+0x40, 0x00, 0x5C, 0xC7, 0x60, 0x03, 0x02, 0xAF, 0x08, 0x12, 0x00, 0x01, 0x00, 0x45, 0x48, 0x44,
+0x45, 0x40, 0x48, 0x42, 0x45, 0x48, 0x42, 0x40, 0x02, 0x41, 0x40, 0x0D, 0x52, 0x5C, 0x4A, 0xC9,
+0xBD, 0x50, 0x26, 0xE4, 0x0E, 0x86, 0x05, 0x25, 0x3A, 0x25, 0x00, 0x7A, 0x65, 0x7A, 0x00, 0x65,
+0x7A, 0x65, 0x00, 0x7A, 0x65, 0x7A, 0x00, 0x65, 0x7A, 0x59, 0x04, 0xC1, 0x5F, 0x6C, 0x00, 0xCF,
+0x5C, 0x95, 0x17, 0x96, 0x74, 0x96, 0x1A, 0x99, 0x60, 0x30, 0x98, 0x1A, 0x98, 0xAB, 0x37, 0x74,
+0x00, 0x57, 0x7F, 0x41, 0x40, 0x09, 0x4B, 0xC1, 0x5B, 0x9C, 0x00, 0x54, 0xC5, 0x5E, 0x3B, 0x83,
+0xC2, 0x83, 0x24, 0x08, 0xC1, 0xE7, 0x00, 0x0D, 0x41, 0x40, 0x0D, 0x52, 0x00, 0x69, 0xC9, 0x48,
+0x99, 0x78, 0x33, 0x66, 0xCF, 0x9E, 0x72, 0x66, 0x82, 0x00, 0xC0, 0x48, 0x01, 0xC1, 0x82, 0x48,
+0x01, 0xC1, 0x82, 0x48, 0x02, 0xC4, 0x82, 0x48, 0x20, 0x16, 0x04, 0x01, 0x42, 0x4E, 0x4C, 0x4E,
+0xC5, 0x92, 0x23, 0x0E, 0x89, 0x1F, 0x00, 0x17, 0x52, 0x40, 0xC4, 0x44, 0x28, 0x00, 0x01, 0x00,
+0x00, 0x43, 0x41, 0x40, 0x26, 0x4E, 0x46, 0x28, 0x63, 0x42, 0x48, 0x63, 0x00, 0xC8, 0x53, 0x02,
+0x23, 0xCA, 0x05, 0x68, 0x06, 0x08, 0x00, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x09, 0x41, 0xC4,
+0x5A, 0x2D, 0x00, 0x0B, 0x00, 0x0B, 0x4F, 0x7E, 0x52, 0x40, 0x06, 0x41, 0x40, 0x1B, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0xC1,
+0x89, 0x00, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x44, 0x43, 0x45, 0x69, 0x66, 0xC2, 0x51, 0x01,
+0x00, 0x01, 0x44, 0x43, 0x44, 0x52, 0xC2, 0x60, 0x02, 0x00, 0x00, 0x41, 0x4B, 0x76, 0x44, 0x40,
+0x4B, 0x42, 0x40, 0x02, 0x42, 0x43, 0x45, 0x42, 0x45, 0x48, 0x42, 0x44, 0x00, 0x41, 0x40, 0x02,
+0x41, 0x40, 0x0D, 0x6D, 0x4F, 0xC8, 0x44, 0x08, 0x1C, 0x59, 0x44, 0xBD, 0x02, 0xC5, 0x25, 0x00,
+0x7A, 0x65, 0x7A, 0x65, 0x00, 0x4F, 0x65, 0x00, 0x7A, 0x65, 0x00, 0x7A, 0x65, 0x01, 0x7A, 0xC1,
+0x9F, 0x19, 0x04, 0xC0, 0x75, 0x00, 0xC4, 0x9F, 0x95, 0x17, 0x28, 0x74, 0x00, 0xC0, 0x96, 0x00,
+0xC9, 0x98, 0x74, 0x96, 0x8C, 0x17, 0x8C, 0x37, 0x8C, 0x96, 0x17, 0x00, 0x52, 0x40, 0x09, 0x4B,
+0xC3, 0x5B, 0x24, 0x9C, 0x83, 0x00, 0x74, 0xC3, 0x83, 0x9C, 0x83, 0x24, 0x05, 0xC1, 0xD0, 0x24,
+0x00, 0xC1, 0xE7, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC5, 0xE5, 0x48, 0xAB, 0x78, 0x33, 0xAB, 0x00,
+0xC4, 0x82, 0x78, 0x72, 0x62, 0x48, 0x0C, 0xC6, 0x82, 0x10, 0x16, 0x1C, 0x02, 0x04, 0x02, 0x00,
+0x43, 0xC7, 0x63, 0x02, 0x51, 0x03, 0x89, 0x01, 0x31, 0x00, 0x16, 0x67, 0x40, 0xC4, 0x50, 0x28,
+0x00, 0x01, 0x00, 0x00, 0x43, 0x45, 0x40, 0x41, 0x40, 0x24, 0x4E, 0x46, 0x29, 0xC1, 0x68, 0x73,
+0x02, 0xC1, 0x68, 0x06, 0x00, 0xC1, 0x68, 0x06, 0x00, 0x48, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x09, 0x52, 0x7E, 0xC1, 0x47, 0x12, 0x00, 0x40, 0x0B, 0x4F, 0xC2, 0x59, 0x2D, 0x00, 0x06,
+0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x66, 0x45, 0x42, 0x45, 0x05, 0x42, 0x00, 0x45, 0x0D, 0x42, 0x45, 0x04,
+0x4F, 0x42, 0x4E, 0x00, 0x4A, 0x45, 0x04, 0x48, 0x4E, 0x4A, 0x43, 0x45, 0x5F, 0x61, 0x45, 0x02,
+0x42, 0x00, 0x45, 0x41, 0x45, 0x0A, 0x42, 0x45, 0x0D, 0x42, 0x00, 0xC2, 0xBD, 0xC5, 0x02, 0x02,
+0x5C, 0x42, 0x00, 0x5C, 0x42, 0x5C, 0x42, 0x5C, 0xC2, 0x89, 0x02, 0x1C, 0x00, 0x42, 0x5C, 0xC6,
+0x89, 0x02, 0x1C, 0x89, 0x02, 0x89, 0x5F, 0x05, 0xC1, 0x6C, 0xBC, 0x00, 0xC1, 0xB0, 0x26, 0x00,
+0x76, 0xC0, 0x60, 0x04, 0x77, 0xC2, 0x9A, 0x37, 0x60, 0x01, 0x66, 0xC2, 0x60, 0x02, 0x05, 0x06,
+0xCD, 0xAA, 0x05, 0xAA, 0x05, 0x52, 0x83, 0x5E, 0x83, 0x52, 0x5E, 0x83, 0x5E, 0x52, 0x83, 0x00,
+0xC3, 0xA0, 0x83, 0x71, 0x83, 0x01, 0xC3, 0x52, 0x83, 0x9D, 0x05, 0x0D, 0x42, 0x45, 0x0D, 0x61,
+0x45, 0xC1, 0x96, 0x33, 0x00, 0xC1, 0x99, 0x33, 0x00, 0xC2, 0x99, 0x33, 0x99, 0x00, 0x73, 0xC0,
+0x99, 0x01, 0x73, 0xC6, 0x99, 0x33, 0x99, 0x33, 0x99, 0x33, 0x99, 0x00, 0x5A, 0x73, 0x00, 0xC2,
+0x70, 0x74, 0x08, 0x00, 0x43, 0x48, 0x00, 0x43, 0x66, 0x48, 0xDF, 0x51, 0x03, 0x26, 0x02, 0x0A,
+0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x03, 0x44, 0x77, 0x61, 0x42, 0x69, 0x45,
+0x43, 0x48, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A,
+0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A, 0x4E, 0x4A,
+0x4E, 0x00, 0x48, 0x42, 0x45, 0x03, 0x41, 0x4E, 0x46, 0x34, 0x4A, 0x45, 0x0D, 0x42, 0x45, 0x0F,
+0x42, 0x00, 0x45, 0x09, 0x42, 0x7E, 0x62, 0x7A, 0x4F, 0x00, 0x7A, 0x4F, 0x07, 0xC9, 0x93, 0x0F,
+0x59, 0x84, 0x89, 0x05, 0xAA, 0x05, 0xAA, 0x05, 0x02, 0x42, 0x45, 0x1B, 0x42, 0x45, 0x0F, 0x42,
+0x45, 0x0D, 0x42, 0x45, 0x1B, 0x42, 0x45, 0x07, 0x42, 0x45, 0x08, 0x42, 0x00, 0x45, 0x40, 0xC2,
+0x59, 0x36, 0x03, 0x00, 0xC3, 0x63, 0x03, 0x36, 0x03, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x44,
+0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43, 0xC1,
+0x44, 0x03, 0x00, 0x44, 0x00, 0x76, 0xC6, 0x51, 0x36, 0x51, 0x03, 0x44, 0x03, 0x04, 0x00, 0x43,
+0x76, 0xC2, 0x51, 0x63, 0x03, 0x02, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01, 0x44, 0x43, 0xC6, 0x44,
+0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x02, 0x44, 0x43, 0x00, 0xCD, 0x51, 0x36, 0x03, 0x51, 0x03,
+0x36, 0x51, 0x03, 0x36, 0x03, 0x63, 0x03, 0x50, 0x03, 0x00, 0xC1, 0x50, 0x63, 0x01, 0xC3, 0x50,
+0x03, 0x63, 0x03, 0x00, 0xC1, 0x63, 0x03, 0x00, 0xC1, 0x63, 0x03, 0x00, 0xC1, 0x63, 0x03, 0x00,
+0xC1, 0x63, 0x03, 0x00, 0xC1, 0x63, 0x03, 0x00, 0xC8, 0x59, 0x63, 0x59, 0x50, 0x59, 0x63, 0x59,
+0x50, 0x59, 0x00, 0x66, 0x43, 0xC7, 0x60, 0x03, 0x36, 0x03, 0x60, 0x36, 0x03, 0x26, 0x00, 0xC1,
+0x74, 0x60, 0x02, 0x43, 0x66, 0x43, 0xC4, 0x63, 0x03, 0x51, 0x36, 0x03, 0x00, 0xC6, 0x51, 0x36,
+0x51, 0x36, 0x96, 0x03, 0x59, 0x00, 0x43, 0xC2, 0x50, 0x63, 0x03, 0x00, 0x66, 0xC1, 0x50, 0x03,
+0x04, 0xC4, 0x63, 0x03, 0x59, 0x50, 0x03, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01, 0x44, 0x43,
+0x01, 0x44, 0x43, 0x02, 0x44, 0x43, 0x00, 0xC2, 0x51, 0x36, 0x03, 0x00, 0xC2, 0x51, 0x36, 0x03,
+0x00, 0xC2, 0x51, 0x36, 0x03, 0x00, 0xC3, 0x63, 0x03, 0x6D, 0x51, 0x09, 0xC2, 0x74, 0x51, 0x03,
+0x00, 0xC2, 0x51, 0x03, 0x51, 0x00, 0x43, 0xC0, 0x51, 0x02, 0xC1, 0x6D, 0x03, 0x0B, 0x44, 0x17,
+0x76, 0xC0, 0x51, 0x00, 0x76, 0x43, 0x00, 0x76, 0x44, 0x43, 0x44, 0x43, 0x44, 0x1F, 0x43, 0x44,
+0x43, 0xC3, 0x51, 0x36, 0x51, 0x08, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x01,
+0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44,
+0x43, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44,
+0xC5, 0x63, 0x5A, 0x3E, 0x5A, 0x3E, 0x5A, 0x0A, 0x66, 0x7E, 0x6B, 0xC7, 0x58, 0x63, 0x51, 0x03,
+0x44, 0x03, 0x04, 0x03, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43,
+0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01,
+0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44,
+0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x44, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43, 0x01, 0x44,
+0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43, 0x01, 0x44, 0x43,
+0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x03, 0x44, 0x43, 0x01, 0x44, 0x43, 0x00,
+0x44, 0x43, 0x42, 0x41, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x4B, 0x71, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x67, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0x67, 0x40, 0x08,
+0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x28, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0x52, 0x45, 0x00, 0x40, 0x07, 0x41,
+0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40,
+0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x52, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x67, 0x40, 0x16, 0x4B, 0x41,
+0x40, 0x08, 0x6D, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41,
+0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0xC2, 0x47,
+0x12, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x4B, 0x40,
+0x16, 0x67, 0x41, 0x40, 0x08, 0x41, 0x71, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41,
+0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40,
+0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x67,
+0x40, 0x16, 0x4B, 0x41, 0x40, 0x08, 0x6D, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09,
+0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41,
+0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x17, 0x67, 0x41, 0x40, 0x08, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41,
+0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40,
+0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00,
+0x40, 0x16, 0x4B, 0x41, 0x40, 0x08, 0x71, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09,
+0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41,
+0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x4B, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x17, 0x67, 0x41, 0x40, 0x08, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41,
+0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x2A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x10, 0x67, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x4B, 0x40, 0x0A,
+0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x44, 0x42, 0xE1, 0xFB, 0x40, 0x44, 0x09, 0x43, 0x44, 0x0D, 0x43, 0x44, 0x1B, 0x43,
+0x44, 0x0C, 0x43, 0x44, 0x0D, 0x43, 0x44, 0x23, 0x43, 0x44, 0x1C, 0x43, 0x44, 0x10, 0xC1, 0x44,
+0x04, 0x0D, 0x43, 0x44, 0x0F, 0x43, 0x44, 0x18, 0x43, 0x44, 0x08, 0xC1, 0x44, 0x04, 0xE0, 0x0A,
+0x43, 0x44, 0x09, 0x43, 0x44, 0x15, 0x43, 0x44, 0x10, 0xC1, 0x44, 0x04, 0x0D, 0x43, 0x44, 0x1D,
+0x43, 0x44, 0x19, 0x43, 0x44, 0x1B, 0x43, 0x44, 0x0F, 0x43, 0x44, 0x0D, 0x43, 0x44, 0x1B, 0x43,
+0x44, 0x07, 0x43, 0x44, 0x0A, 0x42, 0x41, 0x61, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A,
+0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E,
+0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x18, 0x41, 0x40, 0x08, 0x67, 0x41, 0x40, 0xE0, 0x09, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41,
+0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x4B, 0x41, 0x40, 0x1A, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x16, 0x41, 0x00,
+0x40, 0x09, 0x41, 0x40, 0xE0, 0x09, 0x41, 0x40, 0x09, 0x41, 0x40, 0x16, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x67, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41,
+0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x18, 0x41, 0x40, 0x08, 0x41,
+0x4B, 0x42, 0x44, 0x42, 0x40, 0x04, 0x45, 0x41, 0x40, 0x00, 0x45, 0x69, 0x40, 0x42, 0x41, 0x40,
+0x0E, 0x41, 0x44, 0x42, 0x41, 0x45, 0x40, 0x4B, 0x5F, 0x40, 0x1F, 0x41, 0x40, 0x09, 0x41, 0x40,
+0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x4B, 0x40, 0x1A,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x16,
+0x41, 0x00, 0x40, 0x08, 0x41, 0x6D, 0xC4, 0x92, 0x04, 0x0A, 0x02, 0x03, 0x00, 0x5F, 0x43, 0x42,
+0x48, 0x44, 0x42, 0x40, 0xC5, 0x51, 0x0E, 0x00, 0x0E, 0x02, 0x04, 0x00, 0x45, 0x43, 0x48, 0x43,
+0x42, 0x00, 0x48, 0x65, 0xCD, 0x44, 0x08, 0x21, 0x05, 0xAA, 0x00, 0x08, 0x44, 0x03, 0x04, 0x0E,
+0x08, 0x21, 0x04, 0x00, 0x48, 0x42, 0x00, 0x43, 0x41, 0x40, 0x19, 0x41, 0x40, 0x09, 0x41, 0x40,
+0x15, 0x41, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x67, 0x41, 0x40,
+0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x18, 0x41, 0x40, 0x08, 0x65, 0x4B, 0xD3, 0x49, 0x08, 0x0A, 0x02, 0x63, 0x0E, 0x49, 0x63,
+0x01, 0x08, 0x23, 0x05, 0x00, 0x04, 0x0A, 0x02, 0x0A, 0x08, 0x0E, 0x0A, 0x00, 0x48, 0x00, 0x43,
+0x4A, 0x43, 0x5C, 0x48, 0x4A, 0x42, 0x48, 0xC4, 0x60, 0x05, 0x01, 0x0A, 0x00, 0x00, 0x61, 0x4A,
+0xC9, 0x44, 0x58, 0x08, 0x0A, 0x02, 0x08, 0x0A, 0x08, 0x05, 0x00, 0x19, 0x41, 0x40, 0x09, 0x41,
+0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x4B, 0x40,
+0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40,
+0x16, 0x41, 0x00, 0x40, 0x08, 0x41, 0xD6, 0xAF, 0x49, 0x1F, 0x08, 0x0A, 0x08, 0x0E, 0x49, 0x04,
+0x01, 0x08, 0x0A, 0x02, 0x00, 0x51, 0x74, 0x0A, 0x03, 0x0A, 0x08, 0x02, 0x50, 0x03, 0x00, 0x42,
+0x4E, 0x43, 0x42, 0x48, 0xC4, 0x53, 0x0B, 0x08, 0x0A, 0x00, 0x00, 0x48, 0x61, 0x42, 0xC3, 0x51,
+0x30, 0x1C, 0x08, 0x00, 0xC6, 0x58, 0x02, 0x0A, 0x02, 0x0A, 0x03, 0x00, 0x19, 0x41, 0x40, 0x09,
+0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x67,
+0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x18, 0x41, 0x40, 0x08, 0x65, 0x4B, 0x43, 0xC3, 0x70, 0x44, 0x02, 0x03, 0x00,
+0x68, 0xC1, 0x59, 0x02, 0x00, 0x45, 0x44, 0x40, 0x42, 0x00, 0x44, 0x45, 0x00, 0x43, 0x00, 0x42,
+0x01, 0x61, 0x42, 0x00, 0xC6, 0x53, 0x21, 0x02, 0x0B, 0x04, 0x08, 0x00, 0x00, 0x45, 0x48, 0x43,
+0x45, 0x44, 0x61, 0x44, 0x42, 0x4E, 0x4A, 0x45, 0x44, 0x48, 0x45, 0x40, 0x19, 0x41, 0x40, 0x09,
+0x41, 0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x4B,
+0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x18, 0x41, 0x40, 0x08, 0xC2, 0x47, 0x2D, 0x00, 0x00, 0x4B, 0x40, 0x18, 0x41, 0x44, 0x67, 0x40,
+0x08, 0x44, 0x40, 0x1E, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x44, 0x42, 0x08, 0x44, 0x42, 0x0D, 0x44, 0x42, 0x1A, 0x44, 0x42, 0x0D, 0x44, 0x42, 0x0A, 0x5C,
+0x44, 0x42, 0x44, 0x56, 0xC1, 0x8C, 0x02, 0x16, 0x44, 0x5C, 0x42, 0x00, 0x5C, 0x42, 0x5C, 0x42,
+0x02, 0x44, 0x42, 0x0E, 0x44, 0x42, 0x0B, 0x44, 0x42, 0x0F, 0x44, 0x7F, 0x42, 0x56, 0x42, 0x03,
+0x44, 0x42, 0x02, 0x44, 0x42, 0x00, 0x44, 0x42, 0x0F, 0x44, 0x56, 0x5C, 0x00, 0x42, 0x05, 0x5C,
+0x42, 0x00, 0x5C, 0x42, 0x07, 0x5C, 0x42, 0x44, 0x00, 0x42, 0x08, 0x44, 0x5C, 0x44, 0x42, 0x44,
+0x42, 0x44, 0x00, 0x42, 0x44, 0x42, 0x00, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x01, 0x44, 0x42,
+0x44, 0x42, 0x5C, 0x42, 0x00, 0x5C, 0x42, 0x44, 0x42, 0x5C, 0x42, 0x01, 0x44, 0x42, 0x5C, 0x42,
+0x44, 0x42, 0x44, 0x42, 0x5C, 0x42, 0x00, 0x44, 0x42, 0x00, 0x44, 0x42, 0x19, 0x44, 0x42, 0xE0,
+0x17, 0x44, 0x42, 0x0A, 0x44, 0x42, 0x0F, 0x44, 0x42, 0x07, 0x44, 0x42, 0x1B, 0x44, 0x42, 0x0F,
+0x44, 0x42, 0x0D, 0x44, 0x00, 0x42, 0x1A, 0x44, 0x42, 0x07, 0x44, 0x42, 0x09, 0x44, 0x42, 0x40,
+0x43, 0x42, 0x44, 0x01, 0x42, 0x44, 0x00, 0x5C, 0x44, 0x01, 0x42, 0x44, 0x42, 0x44, 0x00, 0x42,
+0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x5C, 0x44, 0x00, 0x42, 0x44, 0x01, 0x42, 0x44,
+0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00,
+0x42, 0x44, 0x00, 0x42, 0x44, 0x01, 0x42, 0x44, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44,
+0x00, 0x42, 0x44, 0x02, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00,
+0x7F, 0x42, 0xC1, 0x5B, 0x4D, 0x19, 0xC3, 0x67, 0x04, 0x02, 0x04, 0x02, 0x42, 0x44, 0x01, 0x42,
+0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44,
+0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x01, 0x42, 0x44, 0x00,
+0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x5C, 0x44, 0x01, 0x42, 0x44, 0xC1, 0x60,
+0x36, 0x02, 0xC2, 0x96, 0x03, 0x36, 0x01, 0x43, 0xC7, 0x51, 0x36, 0x37, 0x36, 0x60, 0x04, 0x02,
+0x04, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x01, 0x5C, 0xD1,
+0x51, 0x1A, 0x33, 0x1A, 0x33, 0x1A, 0x6A, 0x1A, 0x33, 0x1A, 0x70, 0x33, 0x1A, 0x6A, 0x1A, 0x33,
+0x1A, 0x33, 0x00, 0x5A, 0x73, 0x5A, 0x73, 0x5A, 0x73, 0x00, 0xC2, 0x70, 0x6D, 0x03, 0x09, 0x44,
+0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x5C, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44,
+0x01, 0x42, 0x00, 0x44, 0x42, 0x44, 0x01, 0x42, 0x44, 0x42, 0x44, 0x03, 0x42, 0x44, 0x01, 0x42,
+0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x5C, 0x44, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42,
+0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44,
+0x00, 0x42, 0x44, 0x00, 0x42, 0x63, 0x46, 0xE0, 0x04, 0xC3, 0x68, 0x04, 0x02, 0x04, 0x00, 0x42,
+0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x5C, 0x44, 0x01, 0x42, 0x44,
+0x01, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x01, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00,
+0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x01, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42,
+0x44, 0x02, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44,
+0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x02,
+0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x5C, 0x44, 0x03, 0x42,
+0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x5C, 0x44, 0x42, 0x44, 0x01, 0x42, 0x44, 0x00,
+0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42,
+0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x02, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44,
+0x02, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x42, 0x44, 0x00, 0x5C, 0x42, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0xC3, 0xB4, 0x07, 0x0D,
+0x07, 0x13, 0x6E, 0x47, 0x4D, 0x47, 0xC1, 0xB4, 0x00, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x0E,
+0x41, 0x4B, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x67, 0xC3, 0xD9, 0x40, 0xD9, 0x1E, 0x01, 0x67, 0x5E,
+0x00, 0x67, 0x00, 0x5E, 0x00, 0x67, 0x5E, 0x67, 0x40, 0x0F, 0xC1, 0x4F, 0x15, 0x00, 0x50, 0x55,
+0x04, 0x49, 0x55, 0x03, 0x5B, 0x55, 0x49, 0x55, 0x00, 0x5B, 0x55, 0x00, 0xC4, 0x41, 0x09, 0x1B,
+0xE5, 0x05, 0x09, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x4E, 0x46, 0xE0, 0x04, 0x75, 0x40, 0x10, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x67, 0x41, 0x40, 0x42, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x01, 0x41, 0x40, 0x05, 0x41, 0x40, 0x00,
+0x41, 0x40, 0x0A, 0x4B, 0x52, 0x4B, 0xC4, 0xB4, 0x2E, 0x07, 0x0D, 0x07, 0x0B, 0x4D, 0x01, 0x47,
+0x00, 0x4D, 0x47, 0x4D, 0x01, 0xC7, 0x79, 0xB4, 0x31, 0x00, 0x0B, 0x00, 0x12, 0x00, 0x02, 0x41,
+0x40, 0x0E, 0x67, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0xC2, 0xA2, 0x27, 0x1E, 0x00,
+0x4F, 0x5E, 0x5F, 0x67, 0x5E, 0x01, 0x4F, 0x5E, 0x00, 0x4F, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x10,
+0x09, 0x00, 0xC6, 0x41, 0x97, 0x10, 0x97, 0x10, 0x97, 0x09, 0x03, 0x50, 0xC0, 0x41, 0x02, 0xC1,
+0x97, 0x09, 0x00, 0xC5, 0x97, 0x09, 0x97, 0x1B, 0x21, 0x05, 0x06, 0x5F, 0x45, 0x00, 0x41, 0x40,
+0x1C, 0x41, 0x40, 0x2A, 0x4E, 0x46, 0xC6, 0x73, 0x35, 0x68, 0x06, 0x68, 0x06, 0x73, 0x00, 0xC3,
+0x68, 0x35, 0xCA, 0x06, 0x38, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x09, 0x4B, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x43,
+0x00, 0x42, 0x00, 0x45, 0x40, 0x42, 0x41, 0x42, 0x43, 0x45, 0x40, 0x01, 0x45, 0x43, 0x42, 0x40,
+0x44, 0x00, 0x40, 0x05, 0x41, 0x00, 0x40, 0x45, 0x42, 0x40, 0x41, 0x44, 0x00, 0x41, 0x45, 0x43,
+0x45, 0x40, 0x01, 0x41, 0x40, 0x0D, 0xC2, 0xD6, 0x2E, 0x07, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x4D,
+0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x78, 0x00, 0xC5, 0x55, 0x2E, 0x07, 0x0D, 0x55, 0x38,
+0x00, 0x79, 0xC3, 0x4D, 0x0D, 0xB4, 0x00, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x0E, 0x4B, 0x67,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x67, 0xD0, 0x8C, 0xAD, 0x16, 0x4F, 0x02, 0x1F, 0x28, 0x1F,
+0xAA, 0x1F, 0x1E, 0x0F, 0x1E, 0xA2, 0x0F, 0x27, 0x00, 0x0F, 0xC4, 0x4F, 0x10, 0x09, 0x10, 0x09,
+0x01, 0xCC, 0x41, 0x09, 0x41, 0x72, 0x1A, 0x20, 0x66, 0x92, 0x33, 0xA5, 0x78, 0x20, 0x09, 0x01,
+0xC2, 0x62, 0x09, 0x97, 0x00, 0x50, 0x61, 0x00, 0x45, 0x01, 0x44, 0x48, 0x44, 0x00, 0x48, 0x44,
+0x45, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x4E, 0x46, 0x48, 0x76, 0x44, 0x75, 0x42, 0x4E, 0x01, 0x44,
+0xC3, 0x51, 0x04, 0x68, 0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x42,
+0x45, 0x4E, 0x48, 0x45, 0x4E, 0x44, 0x43, 0x42, 0x43, 0x40, 0x01, 0x43, 0x42, 0x48, 0x00, 0x44,
+0x42, 0x40, 0x06, 0x41, 0x40, 0x4A, 0x43, 0x40, 0x45, 0x43, 0x00, 0x48, 0x00, 0x42, 0x45, 0x40,
+0x01, 0x41, 0x40, 0x0A, 0x4B, 0x40, 0x00, 0xC4, 0xB4, 0x07, 0xCB, 0x0D, 0x07, 0x0A, 0xC1, 0xCB,
+0xBB, 0x00, 0xC5, 0xCB, 0x45, 0xC3, 0xC2, 0x46, 0x7F, 0x00, 0xC3, 0xBB, 0x45, 0xB4, 0x00, 0x00,
+0x4B, 0x52, 0x40, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x41, 0xCB,
+0xAD, 0x29, 0x16, 0xAD, 0x16, 0xAD, 0x02, 0x8C, 0x1A, 0xE5, 0x01, 0x0F, 0x00, 0x5E, 0x4F, 0x67,
+0x40, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x05, 0xC1, 0x62, 0x78, 0x00, 0x60, 0xC8, 0x66, 0x1A, 0x92,
+0x6A, 0xDE, 0xA5, 0x09, 0x10, 0x09, 0x02, 0x50, 0x5B, 0x69, 0x45, 0x02, 0x4A, 0x4E, 0x42, 0x48,
+0xC3, 0x63, 0x0E, 0x02, 0x00, 0x1D, 0x41, 0x40, 0x2A, 0x4E, 0xCD, 0x68, 0x03, 0x06, 0x0E, 0x35,
+0x51, 0x02, 0x53, 0x0E, 0x03, 0x06, 0x0A, 0x23, 0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41,
+0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x45, 0x4E, 0x43, 0x45, 0x43, 0x00, 0x42, 0x4A, 0x00, 0x42, 0x40, 0x00, 0x41, 0x40,
+0x01, 0x42, 0x43, 0x4A, 0x48, 0x43, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x42, 0x48, 0x43, 0x40, 0x00,
+0x41, 0x43, 0x00, 0x4E, 0x43, 0x42, 0x40, 0x01, 0x41, 0x40, 0x0D, 0xC2, 0xD6, 0x2E, 0x07, 0x02,
+0x6E, 0x47, 0x01, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x4D, 0xC3, 0xC3, 0x39, 0x38, 0x0D, 0x00, 0xC0,
+0x4D, 0x00, 0xC5, 0x81, 0x55, 0xBB, 0x79, 0xB4, 0x00, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x0E,
+0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x67, 0xCA, 0x6D, 0x10, 0x82, 0x1B, 0x29, 0x33, 0xDA,
+0x1F, 0xAD, 0x8E, 0x0F, 0x01, 0x5E, 0x4F, 0x67, 0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09,
+0x03, 0xCA, 0x41, 0x20, 0x72, 0x20, 0x66, 0x70, 0xCF, 0x1B, 0x1A, 0x20, 0x09, 0x01, 0x55, 0x50,
+0x49, 0x50, 0x5B, 0x42, 0x45, 0x02, 0x43, 0x00, 0x48, 0x45, 0x43, 0x48, 0x45, 0x40, 0x1D, 0x41,
+0x40, 0x2A, 0x4E, 0xCD, 0x73, 0x04, 0x4A, 0x05, 0x0E, 0x03, 0x4A, 0x47, 0x0E, 0x03, 0x68, 0x44,
+0x77, 0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x03, 0x4B,
+0x40, 0x01, 0x41, 0x40, 0x19, 0x4B, 0x00, 0x41, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0xC3,
+0x47, 0x05, 0x0A, 0x01, 0x00, 0x43, 0x48, 0x4A, 0x43, 0x01, 0x45, 0x43, 0x40, 0x01, 0x44, 0x4A,
+0x41, 0x43, 0x42, 0x48, 0x45, 0x40, 0x05, 0x41, 0x43, 0x4E, 0x00, 0x40, 0x41, 0x4E, 0x42, 0x00,
+0x43, 0x42, 0x43, 0x40, 0x01, 0x41, 0x40, 0x0A, 0x4B, 0x52, 0x40, 0xC1, 0xB4, 0x07, 0x04, 0x6E,
+0x47, 0x02, 0x6E, 0x47, 0x02, 0xCC, 0x4B, 0x39, 0x81, 0x4B, 0x0D, 0x4D, 0x55, 0x7F, 0xBB, 0xB1,
+0x38, 0xB4, 0x00, 0x00, 0x4B, 0x40, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x0F, 0x52, 0x4F, 0xC4, 0xAD, 0x1B, 0x99, 0x8C, 0x10, 0x00, 0xCA, 0x8C, 0x01, 0x96, 0x1F,
+0x1E, 0x0F, 0x1E, 0x0F, 0x1E, 0x01, 0x00, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x01, 0x50, 0x49, 0x02,
+0xC4, 0x82, 0xAB, 0x20, 0x66, 0x1A, 0x00, 0x49, 0xC2, 0xAB, 0x20, 0x09, 0x00, 0x50, 0x49, 0x02,
+0x50, 0xC7, 0x4F, 0x05, 0x02, 0x05, 0x02, 0x08, 0x02, 0x0A, 0x01, 0x42, 0x45, 0x41, 0x40, 0x1C,
+0x41, 0x40, 0x2A, 0x4E, 0x46, 0x63, 0x43, 0x4A, 0xC8, 0x68, 0x0E, 0xEB, 0x0E, 0x0C, 0x53, 0x63,
+0x92, 0x06, 0x38, 0x75, 0x40, 0x0F, 0x4B, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x03,
+0x4B, 0x40, 0x52, 0x40, 0x4F, 0x52, 0x40, 0x19, 0x4B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41,
+0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x4F, 0x43, 0x00, 0x44, 0x42, 0x45, 0x42, 0x45, 0x41, 0x44, 0x48, 0x42, 0x40, 0x41,
+0x40, 0x44, 0x43, 0x44, 0x45, 0x43, 0x42, 0x40, 0x05, 0x41, 0x00, 0x40, 0x45, 0x00, 0x65, 0x42,
+0x48, 0x44, 0x69, 0x42, 0x43, 0x41, 0x40, 0x01, 0x41, 0x40, 0x0D, 0xC2, 0xD6, 0x2E, 0x07, 0x00,
+0x4D, 0x00, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x78, 0xC4, 0x46,
+0x38, 0x45, 0x07, 0x45, 0x00, 0xC1, 0x7F, 0x39, 0x00, 0x78, 0xC2, 0xB4, 0x12, 0x00, 0x06, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x41, 0xCA, 0x8C, 0x3A, 0x93, 0x16, 0x1B,
+0x0F, 0x04, 0x01, 0x02, 0x1F, 0x0F, 0x00, 0x5E, 0x00, 0x4F, 0x67, 0x52, 0x40, 0x0D, 0x52, 0xC4,
+0x4F, 0x62, 0x09, 0x10, 0x09, 0x06, 0x50, 0x73, 0x60, 0xC3, 0x41, 0x09, 0x10, 0x09, 0x02, 0xC1,
+0x62, 0x09, 0x01, 0x55, 0x69, 0x45, 0x02, 0x44, 0x4A, 0x44, 0x48, 0x4A, 0x43, 0x42, 0x40, 0x1D,
+0x41, 0x40, 0x2A, 0x4E, 0x46, 0xE0, 0x04, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x04, 0x4B, 0x00, 0x40, 0x41, 0x40, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40,
+0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00,
+0x4B, 0x52, 0x40, 0x52, 0x41, 0x6D, 0x40, 0x0E, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0xC1, 0x47, 0x00, 0x09,
+0x41, 0x44, 0x43, 0x00, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D, 0xC1, 0xB4, 0x07, 0x00, 0x4D, 0x47,
+0x0C, 0x4D, 0x47, 0x04, 0x4D, 0x47, 0x6E, 0xC1, 0xD8, 0x00, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x10, 0x5E, 0x52, 0x5E, 0x67, 0x00, 0x52, 0x5E, 0x71, 0x67, 0x71, 0x67, 0x5E,
+0x52, 0x5E, 0x67, 0x5E, 0x52, 0x40, 0x0F, 0xC1, 0x4F, 0x15, 0x00, 0x5B, 0x49, 0x5B, 0x49, 0x5B,
+0x55, 0x00, 0x5B, 0x49, 0x5B, 0x01, 0xCD, 0x41, 0x1B, 0x09, 0x1B, 0x09, 0x15, 0x1B, 0x15, 0x1B,
+0x09, 0x10, 0x1B, 0x4F, 0x05, 0x03, 0x41, 0x45, 0x41, 0x00, 0x45, 0x00, 0x40, 0x1D, 0x41, 0x40,
+0x2A, 0x4E, 0x46, 0x01, 0xC1, 0x73, 0x06, 0x01, 0xC1, 0x73, 0x06, 0x3C, 0x75, 0x40, 0x10, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x67, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x43, 0x44, 0x25, 0x42,
+0x44, 0x2D, 0xC3, 0x76, 0x7F, 0x4E, 0x7F, 0x00, 0xD3, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E,
+0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0xAC, 0x6E, 0x00, 0xC3, 0x7F,
+0x6E, 0x67, 0x04, 0x39, 0x76, 0xC0, 0x60, 0x00, 0x76, 0xC7, 0x60, 0x36, 0x60, 0x36, 0x03, 0x60,
+0x36, 0x03, 0x00, 0x76, 0xC3, 0x60, 0x36, 0x03, 0x04, 0x0E, 0xC2, 0x89, 0x6D, 0x33, 0x0D, 0x5A,
+0x73, 0x05, 0x5A, 0x73, 0xC3, 0x70, 0x6D, 0x26, 0x03, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x01,
+0x44, 0xE0, 0x09, 0x42, 0x63, 0x46, 0x08, 0xC7, 0x73, 0x06, 0x73, 0x06, 0xCA, 0x06, 0x73, 0x06,
+0x01, 0xC1, 0x73, 0x06, 0x01, 0xC1, 0x73, 0x06, 0x01, 0xC1, 0x73, 0x06, 0x01, 0xC2, 0x73, 0x06,
+0xCA, 0x00, 0x46, 0x01, 0xC1, 0x73, 0x06, 0x0A, 0xC3, 0x73, 0x06, 0x73, 0x06, 0x0D, 0xD3, 0x68,
+0x04, 0x44, 0x36, 0x44, 0x89, 0x44, 0x36, 0x44, 0x89, 0x44, 0x36, 0x44, 0x89, 0x44, 0x36, 0x44,
+0x89, 0x63, 0x04, 0x27, 0xC2, 0x96, 0x44, 0x04, 0x16, 0xC1, 0x44, 0x04, 0x00, 0xC2, 0x44, 0x63,
+0x04, 0xE0, 0x14, 0x42, 0x41, 0x44, 0x42, 0x35, 0x5C, 0x42, 0x1D, 0x5C, 0x00, 0x42, 0x00, 0x68,
+0x11, 0x69, 0x68, 0x01, 0x42, 0x5C, 0x42, 0x02, 0x5C, 0x42, 0x33, 0x68, 0x44, 0x42, 0x77, 0x44,
+0x03, 0x42, 0x76, 0x7F, 0x44, 0x00, 0x77, 0x7F, 0x44, 0x7F, 0x42, 0x0F, 0x56, 0x73, 0x60, 0xC2,
+0x99, 0x6A, 0x20, 0x00, 0xC2, 0x99, 0x6A, 0x20, 0x00, 0x73, 0x60, 0x01, 0x73, 0x60, 0x00, 0x73,
+0x60, 0x00, 0x73, 0x60, 0x01, 0xC8, 0x99, 0x6D, 0x03, 0x44, 0x03, 0x51, 0x36, 0x51, 0x03, 0x00,
+0x44, 0x43, 0x00, 0x44, 0x42, 0x1D, 0x5C, 0x42, 0x2B, 0x44, 0x09, 0xC3, 0xAD, 0x20, 0x99, 0x20,
+0x14, 0x69, 0x61, 0x00, 0x68, 0x45, 0x09, 0x68, 0x45, 0xD2, 0x90, 0x28, 0x3F, 0x28, 0x3F, 0x28,
+0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x02, 0x3F, 0xC5, 0x02, 0x3F, 0x89, 0x63, 0x83, 0x02, 0x74, 0xC0,
+0x83, 0x01, 0x74, 0xC0, 0x83, 0x01, 0x74, 0xC0, 0x83, 0x00, 0x74, 0xC3, 0x83, 0x34, 0x63, 0x02,
+0x0A, 0x5C, 0x42, 0x15, 0xC1, 0xBD, 0x02, 0x01, 0xC1, 0xCC, 0x46, 0x1B, 0xC2, 0x55, 0x9D, 0x02,
+0x0E, 0x44, 0x42, 0x2B, 0x5C, 0x42, 0x07, 0x5C, 0x42, 0x0B, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x1A, 0x41, 0x67, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x4B, 0x40, 0x18, 0x41,
+0x40, 0x02, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52,
+0x5E, 0x00, 0x4F, 0x67, 0x5E, 0x02, 0x67, 0x4F, 0xC1, 0xD9, 0x27, 0x00, 0x5E, 0x01, 0x67, 0x40,
+0x0F, 0xD5, 0x4F, 0x15, 0x09, 0x41, 0x15, 0x09, 0x10, 0x41, 0x15, 0x09, 0x10, 0x09, 0x15, 0x10,
+0x09, 0x15, 0x41, 0x15, 0x41, 0x15, 0x10, 0x15, 0x00, 0xC1, 0x41, 0x09, 0x00, 0xC2, 0x41, 0x4F,
+0x05, 0x09, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x45, 0x08, 0xC2, 0x4F, 0x1B, 0x15, 0x00, 0x49,
+0x07, 0xC2, 0x41, 0x15, 0x09, 0x03, 0xC1, 0x41, 0x09, 0x02, 0x5B, 0xC1, 0xAF, 0x00, 0x0F, 0x5E,
+0x41, 0x5E, 0x03, 0x67, 0x5E, 0x67, 0x5E, 0x4F, 0x00, 0x5E, 0x6D, 0x5E, 0xC1, 0xC5, 0x24, 0x08,
+0xC4, 0xD0, 0xAC, 0x24, 0xAC, 0x24, 0x02, 0xC1, 0xE4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x11, 0x6E, 0x47, 0x05, 0x6E, 0xC2, 0x81, 0x0B, 0x00, 0x0E, 0x41,
+0x40, 0x0D, 0x41, 0xC1, 0x47, 0x00, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x00, 0x52, 0x71, 0x40, 0x52, 0x40, 0x00, 0x52, 0x40,
+0x11, 0x4B, 0x41, 0x4B, 0x40, 0x01, 0x41, 0x40, 0x00, 0x41, 0x40, 0x04, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F,
+0x41, 0x01, 0x5E, 0x67, 0x5E, 0xC4, 0x40, 0x3A, 0x01, 0xA2, 0x0F, 0x00, 0x5E, 0x00, 0x4F, 0x67,
+0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x04, 0xC9, 0x41, 0x09, 0x10, 0x15, 0x1B, 0x15,
+0x41, 0x1B, 0x10, 0x09, 0x00, 0x50, 0x49, 0x02, 0x50, 0x69, 0x45, 0x09, 0x41, 0x40, 0x1C, 0x41,
+0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0x61, 0x45, 0xC1, 0xA2, 0x05, 0x01, 0xC2, 0x90, 0x1B, 0x09,
+0x00, 0x55, 0x49, 0x02, 0x55, 0x5B, 0x49, 0xC6, 0x7B, 0x10, 0x15, 0x10, 0x15, 0x10, 0x09, 0x05,
+0x50, 0xC1, 0x47, 0x00, 0x0F, 0x4F, 0x00, 0x5E, 0x67, 0x4F, 0x67, 0x4F, 0x67, 0x4F, 0x67, 0x01,
+0x41, 0x5E, 0x00, 0xC6, 0x93, 0xC5, 0x24, 0x5E, 0xAC, 0xD0, 0x24, 0x00, 0x54, 0xC0, 0xAC, 0x00,
+0x64, 0x01, 0xC0, 0xAC, 0x00, 0x64, 0xC4, 0xAC, 0x24, 0xD0, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x0D, 0x4D, 0xC1, 0x4B, 0x07, 0x00, 0x4D,
+0x00, 0xC2, 0x79, 0x07, 0x0D, 0x00, 0x47, 0x6E, 0x4D, 0x00, 0xC1, 0x81, 0x00, 0x0F, 0x41, 0x40,
+0x0D, 0x6D, 0x41, 0x40, 0x02, 0x4B, 0x40, 0x4B, 0x41, 0x4B, 0x40, 0x06, 0x4B, 0x40, 0x4B, 0x40,
+0x06, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x00, 0x43, 0x66, 0x42, 0x44, 0x61, 0x71, 0x43, 0x41, 0x44, 0x43, 0x42, 0x40, 0x01, 0x45, 0x43,
+0x42, 0x41, 0x43, 0x44, 0x40, 0x05, 0x41, 0x00, 0x4B, 0x68, 0x69, 0x40, 0x41, 0x44, 0x43, 0x41,
+0x42, 0x43, 0x45, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x56, 0xC0, 0xAD, 0x00, 0x42, 0xC7, 0x8E,
+0x4F, 0x28, 0x4F, 0x16, 0x27, 0x93, 0x1E, 0x00, 0x4F, 0x5E, 0x41, 0x52, 0x40, 0x0E, 0xC2, 0x4F,
+0x62, 0x09, 0x06, 0xC9, 0xAB, 0x72, 0x1B, 0x1A, 0x66, 0x1B, 0x20, 0x66, 0x20, 0x09, 0x01, 0x55,
+0x49, 0x01, 0x50, 0x61, 0x45, 0x02, 0x44, 0x48, 0x44, 0x00, 0x48, 0x5C, 0x68, 0x4B, 0x40, 0x1C,
+0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x00, 0x61, 0x00, 0x48, 0x00, 0x68, 0x43, 0xC6, 0x59, 0x22,
+0x1B, 0x10, 0x09, 0x15, 0x09, 0x02, 0x60, 0xCB, 0x66, 0xA5, 0x78, 0x92, 0x66, 0x33, 0x66, 0x78,
+0x20, 0x15, 0x10, 0x09, 0x02, 0x50, 0xC2, 0x47, 0x12, 0x00, 0x0E, 0x4F, 0x41, 0x66, 0x70, 0x7F,
+0x44, 0x70, 0x00, 0x68, 0x76, 0x70, 0x62, 0x44, 0x66, 0x62, 0x4F, 0xC5, 0xB6, 0x5E, 0xCD, 0x24,
+0x4E, 0x5E, 0x00, 0xC0, 0x61, 0x00, 0xCB, 0xD0, 0x4E, 0xCD, 0xA0, 0x5E, 0x4E, 0x87, 0x6F, 0x24,
+0x5E, 0xE7, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x0E, 0x4D,
+0x47, 0xC2, 0x7F, 0xC6, 0x0D, 0x00, 0xC8, 0xC3, 0x4D, 0x79, 0x0D, 0x7F, 0x4B, 0x81, 0x47, 0x00,
+0x0E, 0x41, 0x40, 0x00, 0x44, 0x41, 0x40, 0x45, 0x43, 0x42, 0x41, 0x43, 0x42, 0x40, 0x02, 0x41,
+0xC8, 0x47, 0x04, 0x03, 0x36, 0x02, 0x04, 0x00, 0x1C, 0x05, 0x00, 0x48, 0x44, 0x41, 0x40, 0x00,
+0x41, 0x43, 0x00, 0x41, 0xC3, 0x44, 0x04, 0x01, 0x00, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x61, 0x4E, 0x42, 0x5F, 0x4A, 0xC7, 0x59,
+0x1F, 0x0E, 0x36, 0x03, 0x02, 0x03, 0x00, 0x01, 0x43, 0x42, 0x48, 0x43, 0x4E, 0x42, 0x40, 0x05,
+0x4B, 0x41, 0x4B, 0x4A, 0x48, 0x40, 0x45, 0x44, 0x00, 0x43, 0x4E, 0x43, 0x41, 0x40, 0x01, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x52, 0x5E, 0x61, 0xCF, 0x99, 0x8C, 0x21, 0x10, 0xAD, 0x05, 0x6A, 0x20, 0x27, 0xFB, 0x0F,
+0xA2, 0x1E, 0x0F, 0x27, 0x00, 0x0F, 0xC1, 0x4F, 0x09, 0x00, 0x50, 0x49, 0x03, 0xC6, 0x97, 0x78,
+0x72, 0x1B, 0x78, 0x66, 0x20, 0x00, 0xC2, 0xDE, 0x20, 0x09, 0x00, 0x50, 0x49, 0x02, 0x5B, 0x69,
+0x45, 0x00, 0x61, 0x5F, 0x4E, 0x00, 0x42, 0x48, 0x4A, 0x00, 0x65, 0x67, 0x40, 0x1C, 0x41, 0x40,
+0x2A, 0x41, 0x42, 0x45, 0x01, 0x44, 0xC1, 0x8D, 0x03, 0x00, 0x4A, 0x00, 0x76, 0x5B, 0x49, 0x55,
+0x49, 0x02, 0xCC, 0x41, 0x20, 0xDE, 0xA5, 0x66, 0x1A, 0x66, 0x20, 0x10, 0x72, 0x33, 0x15, 0x09,
+0x03, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x66, 0x00, 0x7F, 0x66, 0x62, 0x4E, 0x7F, 0x44, 0xC1,
+0x5A, 0x04, 0x00, 0xCF, 0x49, 0x58, 0x26, 0xD9, 0xC5, 0x4E, 0xD5, 0x4E, 0xC1, 0x61, 0xCD, 0x5E,
+0x87, 0x61, 0x6F, 0xCD, 0x00, 0xC7, 0x83, 0xCD, 0x4E, 0x87, 0x61, 0x24, 0xB6, 0x00, 0x01, 0x4B,
+0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x10, 0xCC, 0x45, 0xC2,
+0x46, 0xC6, 0x45, 0xB9, 0xBB, 0x0D, 0xC3, 0xC2, 0x46, 0x81, 0x00, 0x0F, 0x41, 0x40, 0x45, 0x63,
+0x45, 0x40, 0x43, 0x42, 0x48, 0x02, 0x40, 0x02, 0x41, 0x4B, 0x4A, 0x44, 0x45, 0x44, 0x4E, 0x4B,
+0x4E, 0x43, 0x48, 0x45, 0x43, 0x45, 0x40, 0x00, 0x42, 0x44, 0x43, 0x48, 0x4A, 0xC2, 0x53, 0x05,
+0x00, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x67, 0x45, 0x4E, 0xC2, 0x63, 0x02, 0x08, 0x00, 0x43, 0xC3, 0x70, 0x5A, 0x29, 0x00, 0x04, 0x42,
+0x44, 0x42, 0x00, 0x43, 0x45, 0x40, 0x04, 0x41, 0x4B, 0x5C, 0x48, 0x43, 0x40, 0x00, 0x41, 0x48,
+0x42, 0x01, 0x44, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x00, 0xCB, 0xAD, 0x29, 0xC0, 0x20, 0xAD,
+0x01, 0x8A, 0x10, 0x1E, 0x93, 0x01, 0x1E, 0x00, 0x4F, 0x67, 0x40, 0x0F, 0xC2, 0x4F, 0x7B, 0x09,
+0x05, 0xCB, 0x41, 0x20, 0x72, 0x20, 0xE0, 0x66, 0x78, 0x1B, 0x72, 0xA5, 0x15, 0x09, 0x00, 0x55,
+0x49, 0x00, 0xC5, 0x62, 0x10, 0x21, 0x05, 0x28, 0x05, 0x00, 0x43, 0x44, 0xC6, 0x53, 0x05, 0x03,
+0x0A, 0x05, 0x01, 0x00, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0x5C, 0x43, 0xC7, 0x60,
+0x0E, 0x04, 0x03, 0x26, 0x1B, 0x10, 0x09, 0x03, 0x50, 0x5B, 0xC8, 0x72, 0x20, 0x78, 0x70, 0x66,
+0x20, 0x33, 0x70, 0x09, 0x05, 0x50, 0xC2, 0x47, 0x12, 0x00, 0x0E, 0x41, 0x4A, 0x68, 0x52, 0x62,
+0x67, 0xCE, 0x49, 0x28, 0x0F, 0x60, 0x49, 0x36, 0x58, 0x49, 0x60, 0x1E, 0x67, 0x4E, 0xC1, 0x6F,
+0xC1, 0x00, 0xC1, 0x6F, 0xAC, 0x00, 0xCB, 0xC1, 0xCD, 0x61, 0xCD, 0x87, 0x6F, 0x4E, 0x61, 0x5E,
+0x24, 0xB8, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x11, 0xCD, 0x7F,
+0x46, 0x0D, 0x07, 0xC3, 0xB9, 0x4B, 0x39, 0x87, 0x46, 0x81, 0x0B, 0x12, 0x00, 0x0D, 0x41, 0x00,
+0x43, 0x48, 0x45, 0x40, 0x00, 0x42, 0x44, 0x00, 0x48, 0x43, 0x41, 0x40, 0x01, 0x41, 0x4B, 0xC9,
+0x92, 0x08, 0x04, 0x02, 0x0A, 0x04, 0x53, 0x0A, 0x03, 0x00, 0x00, 0x41, 0x40, 0x01, 0x41, 0x43,
+0x42, 0x48, 0x00, 0xC1, 0xAA, 0x00, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x61, 0x4A, 0x5F, 0x41, 0x43, 0x66, 0x4A, 0xC5, 0x51, 0x36,
+0x08, 0x02, 0x03, 0x00, 0x01, 0x43, 0x4A, 0x45, 0x42, 0x00, 0x48, 0x45, 0x40, 0x04, 0x67, 0x65,
+0x43, 0x4E, 0x00, 0x40, 0x45, 0x4E, 0x42, 0x45, 0xC1, 0x44, 0x04, 0x00, 0x40, 0x01, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x52, 0x4F, 0x41, 0xCF, 0x6D, 0xE5, 0xAA, 0x10, 0x51, 0x8E, 0x4F, 0xAD, 0xAE, 0x40, 0x0F, 0x1E,
+0x0F, 0x1E, 0x0F, 0x00, 0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x04, 0xC1, 0xA5, 0x1A, 0x00,
+0x60, 0x50, 0xC4, 0x78, 0x09, 0x1A, 0x20, 0x09, 0x00, 0x50, 0x49, 0x02, 0x5B, 0x69, 0x61, 0x45,
+0x01, 0x48, 0x43, 0x4A, 0x48, 0x44, 0x4A, 0x45, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42,
+0x45, 0x01, 0x44, 0x43, 0x48, 0xC6, 0x49, 0x86, 0x0A, 0x36, 0x1B, 0x09, 0x15, 0x00, 0x49, 0x03,
+0x5A, 0x60, 0xC9, 0x78, 0x72, 0x92, 0x72, 0x66, 0x1A, 0x10, 0x09, 0x15, 0x09, 0x02, 0x50, 0xC1,
+0x47, 0x00, 0x0F, 0x67, 0x66, 0x48, 0x77, 0x70, 0x52, 0x4A, 0x68, 0x7F, 0xC0, 0x60, 0x00, 0xD2,
+0x49, 0x0A, 0x37, 0x5A, 0x1E, 0xB6, 0x5E, 0x87, 0xC1, 0x61, 0x6F, 0x61, 0x4E, 0xA0, 0x6F, 0x61,
+0x76, 0xD5, 0x61, 0x00, 0xC5, 0x87, 0xCD, 0x5E, 0x24, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x0E, 0x4D, 0x47, 0x4D, 0x79, 0xCA, 0x46, 0x79,
+0xBA, 0x81, 0xEC, 0x45, 0xB9, 0xC2, 0x4D, 0x81, 0x00, 0x0F, 0x41, 0x45, 0x48, 0x63, 0x42, 0x40,
+0x43, 0x4A, 0x45, 0x43, 0x44, 0x4A, 0x41, 0x40, 0x00, 0x52, 0x4B, 0x41, 0xC6, 0x53, 0x02, 0x0F,
+0x04, 0x03, 0x0A, 0x03, 0x00, 0x48, 0x42, 0x48, 0x45, 0x40, 0x00, 0x45, 0x4E, 0x42, 0x5C, 0x43,
+0x00, 0x44, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x07, 0x41,
+0x00, 0x40, 0x0D, 0x41, 0x00, 0x43, 0x00, 0x42, 0xC8, 0xAA, 0x05, 0x21, 0x05, 0x27, 0x1C, 0x03,
+0x05, 0x01, 0x01, 0x44, 0x43, 0x42, 0x45, 0x44, 0x42, 0x40, 0x05, 0x41, 0x00, 0x40, 0x41, 0x45,
+0x41, 0x42, 0x43, 0x44, 0x45, 0x42, 0x44, 0x41, 0x4B, 0x40, 0x67, 0x41, 0x40, 0x0D, 0x41, 0x4B,
+0x40, 0x17, 0x6D, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x0E,
+0x52, 0x00, 0x4F, 0xCB, 0xAE, 0x28, 0x1F, 0x29, 0x1F, 0x4F, 0x28, 0x05, 0xAA, 0x1E, 0x0F, 0x1E,
+0x01, 0x4F, 0x67, 0x40, 0x52, 0x40, 0x0C, 0x52, 0xC2, 0x4F, 0x62, 0x09, 0x06, 0x50, 0xC1, 0x97,
+0x10, 0x02, 0x55, 0x50, 0x49, 0x02, 0x55, 0x49, 0x01, 0x50, 0x69, 0x45, 0x00, 0x61, 0x45, 0x44,
+0x48, 0x42, 0x00, 0x4A, 0x42, 0x45, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x61,
+0x45, 0x42, 0x48, 0x43, 0xC1, 0xAA, 0x03, 0x00, 0x62, 0x5B, 0x50, 0x49, 0x07, 0x50, 0x60, 0x50,
+0x00, 0xC3, 0x82, 0x20, 0x10, 0x09, 0x04, 0x50, 0xC3, 0x47, 0x00, 0x12, 0x00, 0x0C, 0x52, 0x4F,
+0x41, 0x76, 0x66, 0xCD, 0x90, 0x1E, 0x3F, 0x22, 0x1F, 0x36, 0x30, 0x22, 0x02, 0x26, 0x22, 0x1E,
+0xB6, 0x5E, 0x00, 0xC1, 0x4E, 0x5E, 0x00, 0xCE, 0xAC, 0x61, 0x6F, 0x24, 0x4E, 0x61, 0x4E, 0x5E,
+0xCD, 0x61, 0x6F, 0xAC, 0xD0, 0xD4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xD6,
+0x2E, 0x07, 0x10, 0xC6, 0x45, 0x4B, 0xC6, 0x4B, 0x0D, 0x46, 0x0D, 0x00, 0xC3, 0x55, 0x4B, 0x81,
+0x00, 0x0F, 0x41, 0x40, 0x00, 0x45, 0x41, 0x45, 0x42, 0x43, 0x42, 0x41, 0x43, 0x42, 0x40, 0x02,
+0x41, 0xC4, 0x47, 0x02, 0x03, 0x04, 0x05, 0x00, 0x42, 0x45, 0x41, 0x45, 0x43, 0x42, 0x41, 0x01,
+0x42, 0x44, 0xC5, 0x44, 0x05, 0x04, 0x44, 0x27, 0x00, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09,
+0x41, 0x00, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x09, 0x41, 0x44, 0x43, 0x44,
+0x41, 0x40, 0x1A, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0xC1, 0xD3, 0x00, 0x02, 0x4B, 0x40, 0x02,
+0x41, 0x40, 0x1C, 0x67, 0x40, 0x10, 0xD1, 0xD9, 0x1E, 0x12, 0x1E, 0x12, 0x27, 0x1E, 0x12, 0x27,
+0x12, 0x27, 0x1E, 0x27, 0x1E, 0x27, 0x1E, 0x27, 0x00, 0x0F, 0xC1, 0x4F, 0x15, 0x00, 0x5B, 0xC9,
+0x41, 0x1B, 0x41, 0x1B, 0x41, 0x1B, 0x41, 0x15, 0x41, 0x1B, 0x01, 0xC9, 0x41, 0x1B, 0x09, 0x1B,
+0x15, 0x1B, 0x15, 0x41, 0x09, 0x1B, 0x00, 0x5F, 0x45, 0x5F, 0x45, 0x00, 0x5F, 0x41, 0x45, 0x41,
+0x00, 0x45, 0x00, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x45, 0x00, 0x5F, 0x45, 0x00, 0x41, 0x00,
+0x45, 0x65, 0x4F, 0x7A, 0x5B, 0x49, 0x00, 0xC2, 0x41, 0x09, 0x1B, 0x00, 0xC2, 0x41, 0x15, 0x1B,
+0x00, 0x55, 0x5B, 0x00, 0x55, 0x5B, 0x00, 0xC4, 0x41, 0x15, 0x1B, 0x41, 0x1B, 0x00, 0x49, 0x5B,
+0xC1, 0x47, 0x00, 0x0F, 0x67, 0x00, 0x52, 0x67, 0x52, 0x67, 0x41, 0x52, 0x5E, 0x52, 0x00, 0x6D,
+0x67, 0x52, 0x00, 0x5E, 0xD4, 0xB6, 0x24, 0x5B, 0x24, 0xAC, 0x14, 0x24, 0x5B, 0x24, 0x14, 0x24,
+0x5B, 0xAC, 0x14, 0xEE, 0x5B, 0x24, 0x14, 0xAC, 0xE7, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0xC2, 0xD6, 0x0D, 0x07, 0x0A, 0x4D, 0x47, 0x05, 0x4D, 0x47, 0x03, 0x4D, 0x47, 0xC1, 0x81,
+0x00, 0x0F, 0x41, 0x40, 0x0D, 0x52, 0x40, 0x0A, 0x42, 0x43, 0x00, 0x45, 0x40, 0x0B, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x02, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0xC1, 0x44, 0x03, 0x00, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0xC1, 0x63, 0x03, 0x00, 0xC1, 0x51,
+0x50, 0x00, 0xD8, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44,
+0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x50, 0x00, 0xD9, 0x96, 0x63,
+0x51, 0x60, 0x44, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x01, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x76, 0xC0, 0x51, 0x00, 0x44, 0xC2, 0x50, 0x63, 0x03, 0x00, 0xC3, 0x63, 0x03, 0x63, 0x03,
+0x03, 0xCC, 0x63, 0x03, 0x63, 0x50, 0x03, 0x63, 0x50, 0x03, 0x26, 0x03, 0x26, 0x03, 0x26, 0x00,
+0x43, 0x66, 0x00, 0x43, 0x66, 0x43, 0x66, 0x43, 0x66, 0x43, 0x76, 0x00, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x76, 0xC4, 0x63, 0x6D, 0x1A, 0x33, 0x1A,
+0x0D, 0x73, 0x5A, 0x00, 0x73, 0x5A, 0x01, 0x73, 0xC2, 0x92, 0x53, 0x08, 0x09, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x01, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x00, 0x48, 0x08, 0xC4, 0x59, 0x70, 0x1A, 0x33,
+0x1A, 0x14, 0xD4, 0x51, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+0x03, 0x04, 0x03, 0x36, 0x03, 0x26, 0x60, 0x26, 0x00, 0x43, 0x66, 0x01, 0x43, 0x66, 0xC1, 0x74,
+0x26, 0x00, 0x43, 0x66, 0x43, 0xC3, 0x86, 0x34, 0x9C, 0x34, 0x0D, 0xDE, 0x9C, 0x86, 0x04, 0x03,
+0x04, 0x03, 0x51, 0x36, 0x51, 0x36, 0x51, 0x36, 0x51, 0x36, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x01, 0x44, 0x00, 0x43, 0x44,
+0x43, 0xC6, 0x44, 0x03, 0x36, 0x96, 0x4E, 0x4D, 0x6E, 0x11, 0xC1, 0x4E, 0x6E, 0x00, 0xC1, 0x4E,
+0x6E, 0x02, 0xD2, 0x4D, 0x4E, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x00, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x03, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44,
+0x43, 0x00, 0x44, 0x00, 0x43, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x00, 0x44, 0x43, 0x44, 0x43,
+0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x01, 0x42, 0x41, 0x42, 0x45, 0x68, 0x61, 0x45, 0x00, 0x42,
+0x45, 0x01, 0x42, 0x00, 0x45, 0x02, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x00, 0x42,
+0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x00, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42,
+0x45, 0x42, 0x61, 0x68, 0x45, 0x61, 0x68, 0x45, 0x00, 0x61, 0x68, 0x45, 0x42, 0x00, 0x45, 0x42,
+0x45, 0x42, 0x45, 0x00, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x00, 0x42, 0x00, 0x45, 0x61, 0x68,
+0x45, 0x00, 0x61, 0x68, 0x45, 0x00, 0x61, 0xC1, 0xAA, 0x05, 0x02, 0xC3, 0xCC, 0x46, 0x45, 0x46,
+0x17, 0xC5, 0xD4, 0x05, 0x28, 0x05, 0xAA, 0x21, 0x00, 0x45, 0x00, 0x42, 0x00, 0x45, 0x42, 0x45,
+0x00, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x00, 0x45, 0x61, 0x68, 0x45,
+0x00, 0x61, 0x68, 0x45, 0x61, 0x00, 0x45, 0x69, 0xC1, 0x52, 0x83, 0x06, 0xC1, 0x5E, 0x83, 0x05,
+0xCD, 0x5E, 0x83, 0x9D, 0x05, 0x28, 0x05, 0x28, 0x21, 0x28, 0x05, 0xAA, 0x21, 0x28, 0x05, 0x00,
+0x61, 0x68, 0x45, 0x42, 0x61, 0x68, 0x45, 0x61, 0x68, 0x45, 0x00, 0x61, 0x68, 0x45, 0x00, 0x61,
+0xC1, 0xAA, 0x05, 0x00, 0x69, 0x45, 0x56, 0xC0, 0x82, 0x00, 0x60, 0x01, 0xC3, 0x82, 0x20, 0x82,
+0x20, 0x05, 0xC1, 0x82, 0x20, 0x00, 0xC1, 0x82, 0x20, 0x00, 0xC1, 0x82, 0x20, 0x02, 0x44, 0x08,
+0x42, 0x44, 0x42, 0x61, 0x68, 0x45, 0x00, 0x61, 0x68, 0x45, 0x00, 0x61, 0x68, 0x45, 0x00, 0x61,
+0x68, 0x45, 0x00, 0x61, 0x68, 0x45, 0x00, 0x61, 0x68, 0x45, 0x61, 0x45, 0x68, 0x61, 0x45, 0x42,
+0x01, 0x61, 0x45, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42,
+0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45,
+0x01, 0x42, 0x45, 0x42, 0x44, 0x09, 0x60, 0x00, 0xC1, 0x82, 0x20, 0x01, 0xC1, 0x82, 0x20, 0x0C,
+0xC5, 0x82, 0x20, 0x82, 0x20, 0x29, 0x05, 0x01, 0x61, 0x45, 0x61, 0x68, 0x45, 0x00, 0x61, 0x68,
+0x45, 0x61, 0x45, 0xC1, 0xAA, 0x05, 0x00, 0x42, 0x45, 0x69, 0x45, 0x68, 0x45, 0xC3, 0xAA, 0x21,
+0x28, 0x05, 0x00, 0x68, 0x61, 0x45, 0x68, 0x61, 0xCE, 0x44, 0x83, 0xD0, 0x5E, 0x83, 0x5E, 0x83,
+0x5E, 0x83, 0x5E, 0x83, 0x5E, 0x83, 0x5E, 0x83, 0x01, 0xC0, 0x5E, 0x00, 0xC1, 0x63, 0x05, 0x00,
+0xC3, 0xAA, 0x21, 0xAA, 0x05, 0x00, 0xC1, 0xAA, 0x05, 0x01, 0xC7, 0xAA, 0x02, 0x21, 0xAA, 0x05,
+0x21, 0x28, 0x05, 0x00, 0x61, 0x68, 0x45, 0x61, 0x45, 0x68, 0x61, 0x45, 0x00, 0x68, 0x42, 0x61,
+0x68, 0x61, 0x68, 0x45, 0x61, 0x00, 0x69, 0x62, 0xC2, 0xCC, 0x46, 0x45, 0x10, 0xC1, 0x46, 0x45,
+0x02, 0xC1, 0x46, 0x45, 0x02, 0xC3, 0x55, 0x21, 0xAA, 0x05, 0x01, 0x42, 0x45, 0x01, 0x42, 0x45,
+0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x61, 0x68,
+0x61, 0x68, 0x61, 0x45, 0x42, 0x00, 0x45, 0x00, 0x61, 0x68, 0x45, 0x00, 0x61, 0x68, 0x61, 0x68,
+0x61, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x61, 0x68, 0x45, 0x61, 0x68, 0x45, 0x00,
+0x61, 0x68, 0x42, 0x61, 0x42, 0x45, 0x01, 0x42, 0x45, 0x01, 0x42, 0x00, 0x45, 0x00, 0x42, 0x45,
+0x01, 0x42, 0x45, 0x01, 0x42, 0x45, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x0D, 0xC2, 0xD6, 0x79, 0x07, 0x14, 0x4D, 0x47, 0x00, 0x4D, 0xC2,
+0xB4, 0x12, 0x00, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0xC1, 0x67, 0x24, 0x01, 0xC1, 0xEE,
+0x24, 0x09, 0xC4, 0xAC, 0x24, 0xD0, 0xB7, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xCB, 0x4F, 0x15, 0x10,
+0x09, 0x15, 0x09, 0x15, 0x09, 0x15, 0x09, 0x1B, 0x09, 0x00, 0x5B, 0x49, 0x00, 0x55, 0x49, 0x55,
+0x49, 0x00, 0x55, 0x00, 0x49, 0x01, 0x5B, 0x69, 0x45, 0x09, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41,
+0x45, 0x08, 0x5F, 0x5B, 0x49, 0x03, 0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x5B, 0x49, 0x00, 0x55,
+0x5B, 0x49, 0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D,
+0xC1, 0xB6, 0x24, 0x04, 0xC1, 0xEE, 0x24, 0x00, 0xC1, 0xD0, 0x24, 0x02, 0xC2, 0xD0, 0xEE, 0x24,
+0x00, 0xC1, 0xD4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x17, 0x4D,
+0x6E, 0x47, 0x00, 0xC1, 0x81, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00,
+0x40, 0x0C, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0xC2, 0xB4, 0x2E, 0x0D, 0x00, 0x47, 0x09, 0x4D, 0x47,
+0x00, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0xC2, 0x79, 0xB4, 0x00, 0x00, 0x4B, 0x40,
+0x04, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x4B, 0x40, 0x00, 0x4B, 0xC1, 0x5B, 0x24, 0x01, 0xC1,
+0x5E, 0x24, 0x00, 0xC0, 0xAC, 0x00, 0xC2, 0xD0, 0x24, 0xAC, 0x00, 0x64, 0x00, 0xC5, 0x5B, 0xAC,
+0xD0, 0x14, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0E, 0x52, 0xC1, 0x4F, 0x09, 0x00, 0x50, 0x49, 0x04,
+0xC1, 0x7B, 0x10, 0x00, 0x49, 0x50, 0x49, 0x00, 0x50, 0x00, 0x49, 0x05, 0x50, 0xC1, 0xE5, 0x05,
+0x09, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0x42, 0x45, 0x04, 0x5B, 0xC1,
+0x62, 0x09, 0x05, 0x55, 0x49, 0x00, 0x50, 0x00, 0x55, 0xC2, 0x97, 0x10, 0x09, 0x05, 0x50, 0xC1,
+0x47, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x00, 0x4B, 0xC4, 0xB6, 0x5E, 0xAC, 0x5E, 0x24,
+0x00, 0xC1, 0xAC, 0x24, 0x00, 0xC4, 0xAC, 0x24, 0xAC, 0x24, 0xAC, 0x00, 0x64, 0x01, 0xC2, 0x5E,
+0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x19,
+0x4D, 0x47, 0xC2, 0x79, 0x0B, 0x00, 0x0E, 0x41, 0x40, 0x01, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40,
+0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41,
+0x00, 0x48, 0x00, 0x42, 0x44, 0x42, 0x40, 0x43, 0x41, 0x44, 0x48, 0x42, 0x40, 0x01, 0x42, 0x48,
+0x44, 0x45, 0x48, 0x42, 0x40, 0x05, 0x41, 0x00, 0x40, 0x42, 0x00, 0x40, 0x41, 0x43, 0x48, 0x41,
+0x43, 0x48, 0x41, 0x40, 0x01, 0x41, 0x40, 0x0B, 0x52, 0x40, 0xC2, 0xB4, 0x2E, 0x07, 0x0C, 0x4D,
+0xCC, 0x45, 0x4D, 0x0D, 0x07, 0x0D, 0x4D, 0x45, 0x38, 0x39, 0x4D, 0x38, 0xB4, 0x00, 0x07, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0A, 0x52, 0xD4, 0x67, 0xA0, 0x87, 0xAC, 0x61, 0x4E, 0xA0, 0x4E, 0x61,
+0xA0, 0xAC, 0x61, 0x87, 0xA0, 0x4E, 0x87, 0x61, 0x24, 0x5E, 0xB7, 0x00, 0x0D, 0x41, 0x4B, 0x40,
+0x0D, 0x52, 0xC2, 0x4F, 0x7B, 0x09, 0x03, 0x50, 0x49, 0x60, 0xC0, 0x78, 0x00, 0x50, 0x5A, 0xCA,
+0xDE, 0x1B, 0x1A, 0x78, 0x33, 0x41, 0x10, 0x09, 0x15, 0x10, 0x09, 0x00, 0x50, 0x61, 0x00, 0x45,
+0x61, 0x68, 0x44, 0x4A, 0xC6, 0x44, 0x1F, 0x04, 0x03, 0x05, 0x01, 0x00, 0x1C, 0x41, 0x40, 0x2A,
+0x41, 0x42, 0x45, 0x03, 0x48, 0x42, 0x4A, 0x48, 0x45, 0x5B, 0x50, 0x49, 0x01, 0x50, 0x49, 0x55,
+0x60, 0xCB, 0xDE, 0xA5, 0x41, 0xE0, 0x33, 0xA5, 0x66, 0x78, 0x82, 0x15, 0x10, 0x09, 0x02, 0x50,
+0xC1, 0x47, 0x00, 0x0E, 0xC2, 0x47, 0x01, 0x00, 0x09, 0x4B, 0x40, 0x01, 0xC6, 0xB6, 0xAC, 0x61,
+0x87, 0x5E, 0x4E, 0x87, 0x00, 0xC8, 0x4E, 0xA0, 0xAC, 0x61, 0x4E, 0x87, 0x61, 0x4E, 0x24, 0x01,
+0xC1, 0xD4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC2, 0xB2, 0x2E,
+0x07, 0x01, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x00, 0xCB, 0x4D,
+0x45, 0x79, 0x0D, 0x45, 0x4D, 0x81, 0x4D, 0x39, 0xC6, 0x81, 0x00, 0x0F, 0x41, 0x40, 0x00, 0x44,
+0x41, 0x40, 0x42, 0x48, 0x44, 0x42, 0x48, 0x00, 0x41, 0x40, 0x01, 0x41, 0x40, 0xCC, 0x44, 0x08,
+0x04, 0x02, 0x03, 0x00, 0x04, 0x28, 0x02, 0x08, 0x04, 0x01, 0x00, 0x00, 0x41, 0x43, 0x00, 0x45,
+0x43, 0x4A, 0x42, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x42, 0x45, 0x4A, 0x48, 0x45, 0x4E, 0x43, 0x00, 0x41, 0x43,
+0x40, 0x01, 0x44, 0x45, 0x4A, 0x00, 0x42, 0x48, 0x45, 0x40, 0x05, 0x41, 0x40, 0x4E, 0x43, 0x40,
+0x45, 0x42, 0x5C, 0x4E, 0x43, 0x42, 0x43, 0x40, 0x01, 0x41, 0x40, 0x0A, 0x4B, 0x00, 0x40, 0xC1,
+0xD6, 0x07, 0x02, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0xC1, 0x79,
+0xBB, 0x00, 0x78, 0xCD, 0x45, 0x4B, 0xC2, 0x55, 0x39, 0xBB, 0x55, 0x79, 0xB4, 0x00, 0x0B, 0x00,
+0x0B, 0x00, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x09, 0x6D, 0xCB, 0xA1, 0x87, 0xC1, 0x56, 0xD5,
+0xC1, 0xA0, 0xD5, 0x4E, 0x6F, 0xCD, 0x4E, 0x00, 0xC7, 0x6F, 0x61, 0x4E, 0x6F, 0x4E, 0x24, 0x3A,
+0x00, 0x0D, 0x41, 0x40, 0x0E, 0x52, 0xC2, 0x4F, 0x62, 0x09, 0x05, 0xCB, 0xA5, 0x20, 0x66, 0xA5,
+0x72, 0x66, 0x20, 0x66, 0xA5, 0x78, 0x15, 0x09, 0x03, 0x50, 0x5B, 0x69, 0x45, 0x02, 0x4E, 0x00,
+0x42, 0x45, 0x4E, 0xC3, 0x86, 0x05, 0x01, 0x00, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x68, 0x61, 0x45,
+0x01, 0x43, 0x63, 0x48, 0x01, 0x66, 0xC1, 0x8C, 0x09, 0x00, 0xC1, 0x97, 0x09, 0x02, 0x60, 0xC1,
+0x66, 0x20, 0x00, 0xC6, 0x66, 0x1A, 0xA5, 0x10, 0x1A, 0x33, 0x09, 0x04, 0x50, 0xC1, 0x47, 0x00,
+0x0F, 0x41, 0x40, 0x0D, 0xC4, 0xB6, 0x5E, 0xD5, 0x4E, 0x61, 0x00, 0xCE, 0x5E, 0x4E, 0x61, 0xC1,
+0xCD, 0x6F, 0x61, 0x4E, 0x87, 0x4E, 0x24, 0xD0, 0x24, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xD6, 0x07, 0x01, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x01,
+0x4D, 0x47, 0x00, 0x4D, 0x00, 0xCE, 0xBA, 0x0D, 0x45, 0xC2, 0x46, 0xC6, 0x4B, 0xB9, 0x9C, 0x38,
+0x39, 0x61, 0x4D, 0x81, 0x00, 0x0F, 0x41, 0x40, 0x42, 0x4E, 0x45, 0x40, 0x44, 0x45, 0x4A, 0x41,
+0x42, 0x4A, 0x40, 0x02, 0xCE, 0x47, 0x01, 0x0A, 0x04, 0x05, 0x1C, 0x64, 0x01, 0x0A, 0x08, 0x60,
+0x01, 0x03, 0x05, 0x00, 0x00, 0x42, 0x00, 0x43, 0x44, 0x41, 0x4A, 0x45, 0x40, 0x05, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x5C,
+0x45, 0x48, 0x00, 0x44, 0x4A, 0x00, 0x42, 0x40, 0x04, 0x44, 0x42, 0x43, 0x44, 0x4E, 0x45, 0x40,
+0x04, 0x41, 0x40, 0x44, 0x48, 0x43, 0x40, 0x00, 0x45, 0x43, 0x42, 0x48, 0x43, 0x48, 0x40, 0x01,
+0x41, 0x40, 0x0D, 0xC2, 0xB4, 0x2E, 0x0D, 0x00, 0x47, 0x09, 0x4D, 0x47, 0x78, 0xC1, 0xB9, 0x07,
+0x00, 0x4D, 0xC1, 0x4D, 0x46, 0x00, 0xC6, 0x45, 0xBB, 0x45, 0xB4, 0x00, 0x0B, 0x00, 0x00, 0x6D,
+0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0A, 0x4B, 0xD4, 0x5B, 0xA0, 0xC1, 0x6F, 0xC1, 0x33,
+0x61, 0x56, 0xA9, 0xCD, 0xD5, 0x52, 0xAC, 0xCD, 0x5E, 0x4E, 0xA9, 0x24, 0x5E, 0x3A, 0x00, 0x0D,
+0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x00, 0x50, 0x49, 0xD1, 0x41, 0x10, 0x41, 0x20, 0x51,
+0x1A, 0x88, 0x9E, 0x66, 0x9E, 0x78, 0xA5, 0x66, 0x41, 0x10, 0x09, 0x15, 0x09, 0x01, 0x50, 0x69,
+0x45, 0x02, 0x44, 0x00, 0x4A, 0x66, 0x4E, 0x4A, 0x5F, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41,
+0x42, 0x45, 0x01, 0x44, 0x4A, 0x4E, 0x44, 0x4A, 0x4E, 0x70, 0x5B, 0x55, 0xC1, 0x97, 0x09, 0x02,
+0x50, 0x5B, 0xD1, 0x72, 0xA5, 0x9E, 0x66, 0xC4, 0xAD, 0x1A, 0x70, 0x41, 0x10, 0x1B, 0x09, 0x10,
+0x09, 0x10, 0x1B, 0x01, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xD1, 0xB6, 0xAC, 0x61,
+0x6F, 0x61, 0x6F, 0x4E, 0xD0, 0x76, 0xC1, 0x78, 0x4E, 0x24, 0x4E, 0x6F, 0xAC, 0x14, 0x24, 0x00,
+0x5C, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x00, 0x4D, 0x47, 0x00,
+0x4D, 0x47, 0x01, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0xCC, 0x7F, 0x46, 0x07,
+0x0D, 0x38, 0xB9, 0xBA, 0x38, 0x39, 0x4D, 0x81, 0x0B, 0x00, 0x0E, 0x41, 0x45, 0x43, 0x4A, 0x45,
+0x40, 0x00, 0x44, 0x00, 0x40, 0x48, 0x45, 0x40, 0x02, 0x41, 0x4B, 0xC9, 0x92, 0x26, 0x02, 0x1C,
+0x0A, 0x04, 0x08, 0x49, 0x03, 0x00, 0x04, 0x45, 0x43, 0x41, 0x42, 0x43, 0x40, 0x06, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4A, 0x45,
+0x00, 0x43, 0x00, 0x4A, 0x43, 0x44, 0x48, 0x42, 0x48, 0x40, 0x01, 0x43, 0x4A, 0x45, 0x42, 0x4A,
+0x48, 0x41, 0x40, 0x04, 0x4B, 0x41, 0x44, 0x4E, 0x00, 0x41, 0x45, 0x4E, 0x42, 0x45, 0x43, 0x4E,
+0x42, 0x40, 0x01, 0x41, 0x40, 0x0D, 0xC1, 0xB4, 0x07, 0x0C, 0x6E, 0x4D, 0x78, 0xC1, 0xB9, 0x38,
+0x00, 0x4D, 0xC9, 0x4D, 0x46, 0x7F, 0x4D, 0xB9, 0xB1, 0xB4, 0x31, 0x0B, 0x00, 0x05, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x09, 0x52, 0xD1, 0x67, 0x87, 0xCD, 0xD5, 0x6F, 0xC1, 0xA9, 0xCD, 0x4E, 0x72,
+0xCD, 0x61, 0x52, 0xC1, 0x61, 0xD5, 0x6F, 0x24, 0x00, 0x7A, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC2,
+0x4F, 0x62, 0x09, 0x05, 0xCB, 0x82, 0x72, 0xAB, 0x66, 0x20, 0x10, 0x78, 0x1A, 0x66, 0x33, 0x15,
+0x09, 0x04, 0x5B, 0x69, 0x45, 0x01, 0x42, 0x48, 0x43, 0x4A, 0x48, 0x4E, 0x00, 0x45, 0x6D, 0x40,
+0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0xC8, 0x44, 0x0A, 0x0C, 0x04, 0x0A, 0x0E, 0x04,
+0x1B, 0x09, 0x05, 0xCA, 0x41, 0x1A, 0x99, 0x72, 0x1B, 0x33, 0x66, 0xDE, 0x1A, 0x82, 0x09, 0x04,
+0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0xD0, 0xB6, 0x4E, 0x61, 0x4E, 0xC1, 0x61, 0x6F,
+0xA0, 0x61, 0xC1, 0x4E, 0xC1, 0x6F, 0x87, 0x4E, 0x5E, 0x24, 0x01, 0xC1, 0xB6, 0x00, 0x01, 0x4B,
+0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x0E, 0xC1,
+0x4B, 0x07, 0x00, 0x79, 0xC2, 0x46, 0x38, 0xCB, 0x00, 0xC6, 0xB9, 0x38, 0x39, 0x7F, 0x39, 0x81,
+0x0B, 0x00, 0x40, 0x0D, 0x41, 0x45, 0x48, 0x63, 0x42, 0x40, 0x43, 0x4A, 0x45, 0x00, 0x48, 0x40,
+0x02, 0x52, 0x4B, 0x41, 0x4A, 0x5C, 0x62, 0xC9, 0x44, 0x50, 0x0A, 0x03, 0x04, 0x08, 0x02, 0x08,
+0x05, 0x00, 0x00, 0x42, 0x4E, 0x42, 0x41, 0x48, 0x45, 0x40, 0x06, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x00, 0x44, 0x00, 0x42, 0x45,
+0x02, 0x40, 0x42, 0x44, 0x45, 0x65, 0x45, 0x00, 0x42, 0x44, 0x42, 0x45, 0x42, 0x45, 0x40, 0x05,
+0x41, 0x67, 0x40, 0x41, 0x01, 0x45, 0x44, 0x00, 0x42, 0x01, 0x40, 0x01, 0x41, 0x00, 0x40, 0x0D,
+0xC2, 0xD6, 0x2E, 0x07, 0x0D, 0xD1, 0x4B, 0x45, 0x79, 0x45, 0x07, 0xB1, 0x38, 0xB1, 0x4D, 0x45,
+0x79, 0xB4, 0x00, 0x0B, 0x00, 0x0B, 0x12, 0x00, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x06,
+0x4B, 0x40, 0x00, 0x4B, 0xC2, 0x67, 0x5E, 0x4E, 0x00, 0xC4, 0x5E, 0x6E, 0x5E, 0x4E, 0xA0, 0x00,
+0xC7, 0xAC, 0x4E, 0x61, 0x24, 0x4E, 0xA0, 0x4E, 0x24, 0x00, 0xC1, 0xE7, 0x00, 0x0D, 0x41, 0x40,
+0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x03, 0x55, 0xC2, 0x7B, 0x10, 0x15, 0x00, 0x49, 0x55,
+0x50, 0xC1, 0x62, 0x09, 0x02, 0xC1, 0x62, 0x09, 0x01, 0x50, 0xC9, 0x4F, 0x28, 0x21, 0x28, 0x05,
+0x02, 0x08, 0x02, 0x05, 0x02, 0x00, 0x45, 0x71, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x45, 0x00,
+0x68, 0x61, 0x68, 0x45, 0x42, 0x00, 0x43, 0x44, 0x45, 0x5B, 0x55, 0x49, 0x50, 0x55, 0x49, 0x04,
+0x55, 0x00, 0x50, 0x00, 0xC0, 0x7B, 0x00, 0x49, 0x05, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40,
+0x09, 0x4B, 0x40, 0x01, 0xCC, 0xB6, 0x24, 0xA0, 0x61, 0x4E, 0xAC, 0xA0, 0x61, 0xAC, 0x5E, 0xAC,
+0x6E, 0x61, 0x00, 0xC6, 0xA0, 0xD0, 0x24, 0x5E, 0x24, 0xB6, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x04, 0x4B, 0x40, 0x00, 0xC2, 0xB2, 0x2E, 0x07, 0x0A, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47,
+0xCC, 0xC3, 0x4B, 0x45, 0x4B, 0xCB, 0x45, 0x79, 0x46, 0x7F, 0x2E, 0x81, 0x0B, 0x00, 0x0E, 0x41,
+0x40, 0x00, 0x45, 0x41, 0x45, 0x42, 0x44, 0x42, 0x41, 0x45, 0x40, 0x03, 0x41, 0x4B, 0x42, 0x44,
+0x00, 0x45, 0x02, 0x41, 0x5F, 0x76, 0x42, 0x41, 0x45, 0x01, 0x44, 0x00, 0x45, 0x41, 0x00, 0x40,
+0x06, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40, 0x18, 0x41, 0x40, 0x0A,
+0x44, 0x01, 0x41, 0x40, 0x0A, 0x4B, 0x40, 0x1D, 0xC1, 0xB4, 0x0D, 0x01, 0x47, 0x4D, 0x47, 0x4D,
+0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47,
+0x4D, 0x00, 0x47, 0x4D, 0xC1, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x1C, 0xC9, 0x67, 0x24, 0xEE, 0x24,
+0xEE, 0x14, 0xEE, 0x24, 0x14, 0x24, 0x01, 0x54, 0x64, 0xC6, 0xD0, 0xAC, 0x5B, 0xD0, 0x24, 0x3A,
+0x00, 0x1F, 0xC1, 0x4F, 0x1B, 0x02, 0x55, 0x5B, 0x00, 0x55, 0x5B, 0x01, 0x55, 0x5B, 0x55, 0x5B,
+0x07, 0xC8, 0x41, 0x1B, 0x16, 0x4F, 0x01, 0x05, 0x01, 0x25, 0x01, 0x01, 0x45, 0x5F, 0x41, 0x45,
+0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x45, 0x01, 0x65, 0x45, 0x02, 0x41, 0x4F, 0x00, 0x5B, 0x49,
+0x5B, 0x02, 0xC7, 0x41, 0x1B, 0x15, 0x1B, 0x41, 0x15, 0x1B, 0x15, 0x00, 0x5B, 0x00, 0x55, 0x5B,
+0x55, 0x5B, 0x55, 0x5B, 0x49, 0x5B, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0xC7, 0xB6, 0x24,
+0xEE, 0x5B, 0xAC, 0x24, 0xEE, 0x24, 0x01, 0xC3, 0xD0, 0xAC, 0x5B, 0xAC, 0x00, 0x64, 0xC0, 0xAC,
+0x00, 0x64, 0xC1, 0xE7, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xD6, 0x0D, 0x00,
+0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x05, 0x4D, 0x47, 0x4D, 0x02,
+0x47, 0xC0, 0x81, 0x00, 0x4D, 0xC1, 0x81, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x71, 0x4B, 0x40, 0x09,
+0x45, 0x43, 0x44, 0x45, 0x40, 0x0B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x43, 0x09,
+0x48, 0x43, 0x1B, 0x44, 0x43, 0x0D, 0x48, 0x43, 0x0C, 0x48, 0x43, 0x0D, 0xC1, 0x76, 0x4E, 0x0D,
+0xC1, 0x61, 0x4E, 0x01, 0xC1, 0x6F, 0x4E, 0x04, 0xC3, 0x6F, 0x76, 0x60, 0x03, 0x06, 0x48, 0x43,
+0x0F, 0x48, 0x43, 0x06, 0xC1, 0x50, 0x03, 0x01, 0xC1, 0x71, 0x34, 0x00, 0x7E, 0x74, 0x01, 0x7E,
+0x74, 0x7E, 0x74, 0x7E, 0xC5, 0xA9, 0x34, 0x3E, 0x34, 0x3E, 0x34, 0x00, 0x70, 0x43, 0x0D, 0x4A,
+0x48, 0x4A, 0x00, 0x48, 0x4A, 0x48, 0x4A, 0x48, 0x4A, 0x48, 0x4A, 0x48, 0x4A, 0x48, 0x4A, 0xD8,
+0x58, 0x86, 0x0A, 0x66, 0x72, 0x66, 0x92, 0x66, 0x92, 0x78, 0x92, 0x66, 0x92, 0x66, 0x92, 0x66,
+0x88, 0xCF, 0x78, 0x88, 0x66, 0x78, 0x88, 0xCF, 0x78, 0x00, 0xD0, 0x66, 0x72, 0x66, 0x0E, 0x0A,
+0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x08, 0x03, 0xE0, 0x0A, 0x4A, 0x48,
+0x01, 0x4A, 0x48, 0x00, 0x4A, 0x00, 0xC3, 0x86, 0x53, 0x70, 0x1A, 0x14, 0xC3, 0x72, 0x1A, 0x6D,
+0x03, 0x1F, 0xC1, 0x53, 0x34, 0x04, 0x7E, 0x74, 0x7E, 0x74, 0x02, 0x7E, 0x74, 0x02, 0xC1, 0x53,
+0x03, 0x0A, 0x48, 0x43, 0x48, 0x43, 0x48, 0x66, 0x48, 0x66, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x66, 0x48, 0x00, 0x43, 0x07, 0xC3, 0x60, 0x76, 0x6E, 0x4E, 0x12, 0xC1, 0x76, 0x4E, 0x03,
+0xC1, 0x6F, 0x4E, 0x00, 0x43, 0x2D, 0x44, 0x43, 0x0D, 0x48, 0x43, 0x13, 0x48, 0x42, 0x41, 0x42,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x42, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x42, 0x45, 0x01, 0x5F, 0x4F, 0x45,
+0x5F, 0x65, 0x45, 0x4F, 0x5F, 0x4F, 0x5F, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x01, 0x4F, 0x5F, 0x4F, 0x5F, 0x45, 0x4F, 0x5F, 0x4F, 0x5F,
+0x65, 0x45, 0x5F, 0x4F, 0x45, 0x61, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F,
+0x5F, 0x65, 0x45, 0x4F, 0x5F, 0x45, 0x5F, 0x00, 0xD0, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2,
+0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2, 0x01, 0xA2, 0x1F, 0x01, 0x00, 0x4F, 0x5F, 0x01, 0xC3, 0xA2,
+0x1F, 0x0F, 0x05, 0x01, 0x65, 0x45, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x69, 0x4F, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x03, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x4F, 0x5F, 0x4F, 0x45, 0x00, 0x41, 0x00, 0x5F, 0x41, 0x00, 0x5F, 0x41, 0x03,
+0x4F, 0x41, 0x03, 0x45, 0x00, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F,
+0x4F, 0x5F, 0x65, 0x41, 0x4C, 0x46, 0x36, 0x44, 0x41, 0x00, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x03, 0x41, 0x45, 0x41, 0x45, 0x4F, 0x61, 0x45, 0xC1, 0x4F, 0x05,
+0x00, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41,
+0x45, 0x42, 0x44, 0x42, 0x44, 0x42, 0x04, 0x7F, 0x5C, 0x50, 0xC0, 0x82, 0x00, 0xC8, 0x7B, 0x82,
+0x20, 0x82, 0x20, 0x82, 0x20, 0x82, 0x20, 0x05, 0xC4, 0x82, 0x20, 0x82, 0x20, 0x82, 0x00, 0x50,
+0xDF, 0xAA, 0x1F, 0x0F, 0x4F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F,
+0x1F, 0x0F, 0x05, 0x29, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x1F, 0x25, 0x05, 0x1F, 0x0F,
+0x1F, 0x4F, 0x45, 0x00, 0x5F, 0x41, 0x5F, 0x41, 0x67, 0x41, 0x08, 0x67, 0x41, 0x00, 0x45, 0x00,
+0x4F, 0x5F, 0x65, 0x45, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x77, 0xC2, 0x85, 0x30, 0x85,
+0x01, 0x70, 0xC0, 0x85, 0x03, 0x70, 0xC0, 0x85, 0x00, 0x70, 0xC0, 0x85, 0x00, 0x7F, 0x65, 0x7A,
+0x5F, 0x45, 0x7A, 0x5F, 0x4F, 0x5F, 0x45, 0xC1, 0xAA, 0xA2, 0x00, 0x5F, 0xDF, 0xA2, 0x1F, 0xA2,
+0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0xA2, 0x1F, 0x0F,
+0x1F, 0xA2, 0x1F, 0xA2, 0x01, 0x1F, 0x1E, 0xAA, 0x05, 0x1F, 0x0F, 0x1F, 0x0F, 0x5F, 0x4F, 0x5F,
+0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x65, 0x42, 0x45, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F,
+0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x5F, 0x4F, 0x45, 0x00, 0x61, 0x5F, 0x4F, 0x5F, 0x45, 0x4F,
+0x5F, 0x4F, 0x5F, 0x45, 0x4F, 0x5F, 0x65, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x42, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45,
+0x41, 0x42, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x01, 0x40, 0x45,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x71, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41,
+0x52, 0x40, 0x18, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x0D, 0x4C, 0x46, 0x29, 0xC1, 0x73, 0x06, 0x0A, 0x42, 0x40, 0x1C, 0x41, 0x40, 0x07, 0x4B,
+0x40, 0x20, 0x41, 0x45, 0x02, 0x68, 0x61, 0x45, 0xC2, 0xAA, 0x05, 0x21, 0x00, 0x5B, 0x49, 0x01,
+0x55, 0x49, 0xC1, 0x41, 0x09, 0x01, 0xC4, 0x41, 0x09, 0x41, 0x09, 0x41, 0x00, 0x49, 0x01, 0xC1,
+0x41, 0x09, 0x02, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x68, 0x77, 0xC1, 0x69, 0x37, 0x01, 0xC1, 0x69, 0x37, 0x03, 0xC1, 0x69, 0x37, 0x01, 0xC3,
+0x69, 0x60, 0x17, 0x00, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x67,
+0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x1A, 0x6D, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x2A, 0xC3,
+0x68, 0x0E, 0x68, 0x06, 0x00, 0x63, 0x00, 0x75, 0x00, 0x46, 0x63, 0xC2, 0x73, 0x02, 0x00, 0x1C,
+0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x06, 0x5F, 0x61, 0x5B, 0x49, 0x00, 0xC1, 0x82, 0x10, 0x00,
+0x60, 0xD3, 0x82, 0x41, 0x10, 0x82, 0x41, 0x10, 0x09, 0x10, 0x82, 0x10, 0x41, 0x7B, 0x82, 0x41,
+0x82, 0x7B, 0x41, 0x10, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x57, 0xC3, 0x69, 0x37, 0x30, 0x60, 0x00, 0x77, 0xCE, 0x85, 0x37, 0x30, 0x69, 0x85, 0x37, 0x30,
+0x37, 0x85, 0x37, 0x26, 0x22, 0x00, 0x0B, 0x00, 0x00, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0D, 0x4B, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x71, 0x40, 0x0C, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F,
+0x41, 0x00, 0x40, 0x0D, 0x4C, 0x46, 0x2A, 0x4E, 0x44, 0x4A, 0x46, 0xC9, 0x68, 0x30, 0x1C, 0x0E,
+0x50, 0x35, 0x03, 0x06, 0x02, 0x00, 0x1C, 0x41, 0x40, 0x45, 0x00, 0x40, 0x41, 0x00, 0x45, 0x40,
+0x65, 0x40, 0x01, 0x44, 0x42, 0x45, 0x42, 0x40, 0x1A, 0x41, 0x42, 0x45, 0x01, 0x42, 0x48, 0x4A,
+0x42, 0x44, 0x48, 0x45, 0x5B, 0x49, 0x73, 0xC1, 0x78, 0x1A, 0x00, 0xC0, 0x78, 0x00, 0x73, 0xC0,
+0x78, 0x00, 0xCF, 0x99, 0x1B, 0x20, 0x78, 0x1A, 0xAB, 0x20, 0x66, 0x78, 0x1A, 0x72, 0x66, 0x82,
+0x10, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0xC2, 0x90, 0x74,
+0x98, 0x00, 0xC7, 0x74, 0x30, 0x49, 0x98, 0x74, 0x98, 0x37, 0x74, 0x00, 0xC6, 0x98, 0x74, 0x37,
+0x69, 0x30, 0x17, 0x00, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x00, 0x43, 0x41,
+0x40, 0x42, 0x4A, 0x42, 0x00, 0x4A, 0x44, 0x40, 0x02, 0x41, 0x40, 0x43, 0x48, 0x43, 0x42, 0x43,
+0x40, 0x43, 0x42, 0x00, 0x48, 0x43, 0x41, 0x40, 0x00, 0x41, 0x48, 0x43, 0x45, 0x48, 0x00, 0x41,
+0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x1A, 0x6D, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x29, 0xC0,
+0x73, 0x00, 0xCC, 0x8D, 0x0A, 0x06, 0x73, 0x68, 0x53, 0x68, 0x08, 0x03, 0x64, 0x06, 0x02, 0x00,
+0x1C, 0x41, 0x00, 0x48, 0x42, 0x4E, 0x48, 0x44, 0xC1, 0x51, 0x0A, 0x00, 0x42, 0x40, 0x5F, 0x4E,
+0x43, 0x40, 0x48, 0x41, 0x40, 0x19, 0x41, 0x45, 0x42, 0x45, 0x00, 0x44, 0x4E, 0x43, 0x42, 0x4A,
+0x4E, 0xC7, 0x4F, 0x1B, 0x09, 0x10, 0x33, 0x78, 0x1A, 0x66, 0x00, 0x5A, 0x50, 0xC6, 0x66, 0x33,
+0x1B, 0x1A, 0x20, 0x1B, 0x1A, 0x00, 0x5B, 0x5A, 0x00, 0x50, 0xC4, 0x66, 0x20, 0x1B, 0x47, 0x00,
+0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x57, 0x70, 0xC2, 0x98, 0x99, 0x98,
+0x00, 0xCF, 0x74, 0x30, 0x49, 0x99, 0x30, 0x37, 0x74, 0xCF, 0x74, 0x85, 0x37, 0x26, 0x22, 0x00,
+0x0B, 0x00, 0x00, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x45, 0x40, 0x42, 0x4E,
+0x41, 0x40, 0x44, 0x5F, 0x4A, 0x76, 0x5F, 0x4A, 0x45, 0x40, 0x01, 0x41, 0x40, 0x4E, 0x44, 0x45,
+0x44, 0x4E, 0x41, 0x4A, 0x48, 0x00, 0x40, 0x44, 0x45, 0x40, 0x00, 0x42, 0x00, 0x43, 0x48, 0x45,
+0x43, 0x44, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x71, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x4C,
+0x46, 0x2A, 0x48, 0xCC, 0x60, 0x59, 0x35, 0x0C, 0x60, 0x44, 0x0C, 0x0E, 0x25, 0x73, 0x06, 0x02,
+0x00, 0x1C, 0x41, 0x45, 0x43, 0x42, 0x44, 0x42, 0x4A, 0x48, 0x00, 0x42, 0x70, 0x40, 0x00, 0x42,
+0x44, 0x40, 0x43, 0x42, 0x40, 0x19, 0x41, 0x42, 0x45, 0x01, 0x42, 0x44, 0x48, 0x43, 0x42, 0xD4,
+0x86, 0x4F, 0x1B, 0x10, 0x20, 0xA5, 0x92, 0x66, 0x33, 0x20, 0x66, 0x10, 0x20, 0x78, 0x1B, 0x1A,
+0x33, 0x10, 0x72, 0x99, 0x1A, 0x00, 0x50, 0x00, 0x5A, 0x00, 0xC2, 0x41, 0x1F, 0x00, 0x0F, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0xCA, 0x90, 0x9A, 0x98, 0xAB, 0x98, 0xAB, 0xAD,
+0x37, 0x60, 0xAB, 0x37, 0x00, 0x70, 0xC8, 0x98, 0x74, 0x37, 0x69, 0x60, 0x17, 0x00, 0x0B, 0x00,
+0x00, 0x52, 0x40, 0x02, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x45, 0x43, 0x4E, 0x45, 0x40,
+0x00, 0x44, 0x00, 0x40, 0x44, 0x00, 0x40, 0x02, 0x41, 0x40, 0x4A, 0x43, 0x42, 0x00, 0x4A, 0x44,
+0x48, 0x00, 0x43, 0x40, 0x41, 0x40, 0x02, 0x42, 0x43, 0x40, 0x45, 0x43, 0x41, 0x40, 0x05, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A,
+0x6D, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x2A, 0xCA, 0x68, 0x0E, 0xB5,
+0x0C, 0xB5, 0x0C, 0x0E, 0x06, 0x73, 0x23, 0x06, 0x00, 0x42, 0x40, 0x1C, 0x41, 0x42, 0x43, 0x45,
+0x4E, 0x43, 0x48, 0x00, 0x66, 0x5C, 0x43, 0x40, 0x00, 0x42, 0x44, 0x40, 0x48, 0x45, 0x40, 0x19,
+0x41, 0x42, 0x45, 0x01, 0x44, 0x48, 0x4A, 0x44, 0x42, 0x4A, 0x45, 0x5B, 0xC3, 0x97, 0x33, 0x78,
+0x1A, 0x00, 0xD4, 0x66, 0x92, 0x20, 0x92, 0x72, 0x70, 0x20, 0xA5, 0x92, 0x66, 0xE0, 0x1A, 0x66,
+0x1A, 0x33, 0x1A, 0x72, 0x82, 0x1B, 0xAF, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x09, 0x71, 0x68, 0xC3, 0x85, 0x98, 0x99, 0x98, 0x06, 0xC7, 0x60, 0x49, 0x30, 0x37, 0x60,
+0x30, 0x22, 0x00, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x45, 0x43,
+0x4E, 0x42, 0x41, 0x48, 0x4E, 0x45, 0x43, 0x4E, 0x42, 0x41, 0x40, 0x01, 0x41, 0x40, 0x4A, 0x44,
+0x45, 0x44, 0xC8, 0x44, 0x0E, 0x03, 0x04, 0x08, 0x02, 0x0A, 0x05, 0x00, 0x00, 0x42, 0x4E, 0x42,
+0x00, 0x4E, 0x44, 0x41, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x71, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40,
+0x0D, 0x4C, 0x46, 0x36, 0x42, 0x40, 0x1C, 0x41, 0x40, 0x43, 0x44, 0x4A, 0x42, 0xC5, 0x47, 0x05,
+0x25, 0x01, 0x1F, 0x00, 0x00, 0x41, 0x00, 0x45, 0x43, 0x40, 0x1A, 0x41, 0x42, 0x45, 0x00, 0x61,
+0x45, 0x43, 0x44, 0x45, 0x42, 0x00, 0x45, 0xC1, 0x7A, 0x97, 0x00, 0x49, 0x55, 0x00, 0x50, 0x49,
+0x55, 0x49, 0xC3, 0x7B, 0x15, 0x82, 0x15, 0x00, 0x50, 0xC1, 0x7B, 0x10, 0x00, 0xC7, 0x7B, 0x15,
+0x10, 0x7B, 0x15, 0x10, 0x25, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A,
+0x57, 0x66, 0x70, 0xC4, 0x98, 0x60, 0x74, 0x98, 0x74, 0x01, 0xC9, 0x98, 0x74, 0x60, 0x74, 0x60,
+0x85, 0x37, 0x85, 0x22, 0x00, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x00, 0x45, 0x41, 0x00, 0x42, 0x04, 0x40, 0x02, 0x41, 0x40, 0x45, 0x44, 0x42, 0x45, 0x41,
+0x5F, 0x41, 0x01, 0x44, 0x45, 0x00, 0x42, 0x45, 0x42, 0x04, 0x45, 0x40, 0x05, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40,
+0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x36, 0x42, 0x40, 0x1C, 0x41, 0x40, 0x41, 0x45,
+0x00, 0x40, 0x08, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x45, 0x04, 0x41, 0x45, 0x00, 0x4F, 0x45, 0x56,
+0x50, 0x49, 0x55, 0x00, 0x49, 0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x00, 0x55, 0x49,
+0x55, 0x49, 0x55, 0x49, 0x55, 0x49, 0x5B, 0x56, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x10, 0x41, 0x40, 0x0A, 0x68, 0xC1, 0x69, 0x37, 0x01, 0xC1, 0x69, 0x37, 0x04, 0x70, 0x77,
+0xC5, 0x60, 0x37, 0x69, 0x37, 0x22, 0x00, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x09, 0x61, 0x44, 0x00, 0x45, 0x40, 0x0B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x4C,
+0xC0, 0x68, 0x10, 0x75, 0xC0, 0x68, 0x14, 0x75, 0xC2, 0x68, 0x35, 0x68, 0x02, 0x75, 0xC0, 0x68,
+0x00, 0x75, 0xC0, 0x68, 0x00, 0x75, 0xC4, 0x68, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x02, 0x48, 0x43, 0x03, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48,
+0x00, 0x4A, 0x48, 0x4A, 0x48, 0x00, 0x4A, 0x48, 0x4A, 0x48, 0x4A, 0xC9, 0x70, 0x1A, 0x70, 0x1A,
+0x70, 0x92, 0x1A, 0x70, 0x1A, 0x70, 0x00, 0x5A, 0xC4, 0x70, 0x92, 0x70, 0x1A, 0x70, 0x00, 0x5A,
+0xC0, 0x70, 0x00, 0x5A, 0xC9, 0x70, 0x92, 0x70, 0x6D, 0x03, 0x08, 0x03, 0x26, 0x08, 0x03, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x4A, 0xC2, 0x54, 0x49, 0x54, 0x0C, 0xC0, 0x49,
+0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x03, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x44, 0x41, 0x42, 0x41, 0x07, 0x45,
+0x00, 0x41, 0x0D, 0x45, 0x00, 0x41, 0x1A, 0x45, 0x41, 0x0B, 0x45, 0x00, 0x41, 0x0D, 0x45, 0x00,
+0x41, 0x18, 0x45, 0x41, 0x07, 0x45, 0x41, 0x0E, 0x45, 0x00, 0x41, 0x0A, 0x45, 0x41, 0x10, 0x45,
+0x41, 0x0E, 0x40, 0x0F, 0x41, 0xC1, 0x47, 0x00, 0x16, 0x41, 0x4B, 0x40, 0x08, 0x41, 0x45, 0x41,
+0x1C, 0x45, 0x41, 0x2A, 0x45, 0x41, 0x09, 0x5F, 0x41, 0x65, 0x41, 0x65, 0x6D, 0x41, 0x01, 0x65,
+0x41, 0x65, 0x41, 0x65, 0x41, 0x00, 0x65, 0x41, 0x00, 0x65, 0x00, 0x41, 0x65, 0x41, 0x5F, 0x45,
+0x41, 0x0F, 0x45, 0x41, 0x0D, 0x45, 0x41, 0x10, 0x45, 0x41, 0x0A, 0xC3, 0x4F, 0x47, 0x01, 0x27,
+0x00, 0x71, 0x67, 0x09, 0x4F, 0x45, 0x41, 0x65, 0x41, 0x05, 0x45, 0x41, 0x1B, 0x45, 0x41, 0x0F,
+0x45, 0x41, 0x0E, 0x45, 0x41, 0x1A, 0x45, 0x00, 0x41, 0x06, 0x45, 0x41, 0x0A, 0x45, 0x40, 0x42,
+0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x6D, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x00,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x52, 0x40, 0x16, 0xC2, 0x47, 0x01, 0x00, 0x08, 0x41, 0x40,
+0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41,
+0x00, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x71, 0x41, 0x40, 0x0C, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x4B, 0x40, 0x16, 0x52, 0x41, 0x40, 0x09, 0x41,
+0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x6D, 0x40, 0x0C, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40,
+0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x71, 0x40, 0x16, 0xC2, 0x47, 0x01, 0x00,
+0x08, 0x41, 0x00, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x71, 0x41,
+0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x6D, 0x40, 0x16, 0x52, 0x41,
+0x40, 0x09, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x00,
+0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x6D,
+0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40,
+0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0xC2, 0x47,
+0x01, 0x00, 0x08, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41,
+0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x71,
+0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x16, 0x52,
+0x41, 0x40, 0x08, 0x41, 0x00, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15,
+0x41, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A,
+0x41, 0x6D, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E,
+0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17,
+0xC2, 0x47, 0x01, 0x00, 0x08, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40,
+0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x6D, 0x71, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x4B, 0x40, 0x18, 0x65, 0x40, 0x07, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0xC1, 0x47,
+0x00, 0x18, 0x67, 0x40, 0x08, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0xE0, 0x17, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x2B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0xDF, 0x74, 0x53, 0x4E,
+0x71, 0x76, 0x71, 0x76, 0x71, 0x6A, 0x52, 0x6A, 0x71, 0x76, 0x71, 0x76, 0x71, 0x6A, 0x52, 0x6A,
+0x52, 0x6A, 0x71, 0x4E, 0x71, 0x76, 0x71, 0x76, 0xA9, 0x52, 0x53, 0x03, 0x08, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x70, 0x48, 0x70, 0x48, 0x70, 0x48, 0x01, 0x70, 0xD7, 0x59,
+0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x26, 0x6D, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03,
+0x08, 0x03, 0x08, 0x03, 0x08, 0x26, 0x08, 0x00, 0xC0, 0x70, 0x18, 0x48, 0x0C, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x4E, 0x00, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E,
+0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E,
+0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0x4E, 0x63, 0xDF, 0x64, 0x8D, 0x4A, 0x8D,
+0x64, 0x8D, 0x4A, 0x8D, 0x64, 0x8D, 0x4A, 0x8D, 0x64, 0x8D, 0x4A, 0x8D, 0x64, 0x23, 0x0E, 0x23,
+0x0E, 0x23, 0x0E, 0x23, 0x0E, 0x23, 0x0E, 0x23, 0x0E, 0x23, 0x0E, 0x23, 0x4E, 0x63, 0x4E, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x01, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x02, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00, 0x44, 0x41, 0x42, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x40, 0x41, 0x45, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x06, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x01, 0x40, 0x41,
+0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x01, 0x4B, 0x67, 0x41,
+0x4B, 0x67, 0x41, 0x4B, 0x67, 0x41, 0x4B, 0x67, 0x4B, 0x00, 0x41, 0xC6, 0xD6, 0xC6, 0x2E, 0x4B,
+0x2E, 0x4B, 0x2E, 0x00, 0xC1, 0x4B, 0x2E, 0x00, 0xC4, 0x4B, 0x2E, 0x4B, 0x2E, 0x4B, 0x00, 0x6E,
+0xC7, 0x4B, 0x2E, 0x4B, 0x2E, 0x4B, 0x2E, 0x4B, 0x2E, 0x00, 0xC8, 0x4B, 0xF5, 0x27, 0x00, 0x01,
+0x31, 0x01, 0x00, 0x01, 0x00, 0x40, 0x45, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x52, 0x41, 0xDF, 0x47, 0x12, 0x01, 0x47,
+0x12, 0x01, 0x47, 0x12, 0x01, 0x47, 0x0F, 0x31, 0x01, 0x2D, 0x31, 0x01, 0x2D, 0x31, 0x01, 0x2D,
+0x31, 0x01, 0x2D, 0x31, 0x01, 0x2D, 0x31, 0x01, 0x2D, 0x1F, 0x93, 0x90, 0x62, 0xC1, 0x93, 0x22,
+0x01, 0xC4, 0x93, 0x90, 0x22, 0x90, 0x22, 0x01, 0x45, 0x41, 0x00, 0x71, 0x6D, 0x41, 0x71, 0x6D,
+0x41, 0x71, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x52, 0xD3, 0x4F, 0x20, 0x10, 0x7B,
+0x10, 0x7B, 0x10, 0x7B, 0x10, 0x7B, 0x09, 0x62, 0x7B, 0x09, 0x62, 0x10, 0x62, 0x10, 0x7B, 0x10,
+0x01, 0xC6, 0x7B, 0x10, 0xA5, 0x7B, 0x10, 0x29, 0x02, 0x09, 0x41, 0x40, 0x41, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x40, 0x41, 0x01, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41,
+0x00, 0x40, 0x41, 0x00, 0x40, 0x4E, 0x46, 0xE0, 0x04, 0xC1, 0x68, 0x00, 0x00, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x01, 0x40, 0x41,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x04, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x45, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41,
+0x02, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x02, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x01, 0x40, 0x41,
+0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x01, 0x40, 0x41, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41,
+0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x01, 0x40, 0x41, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x03, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x02, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x03, 0x41, 0x40, 0x14, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0xC1,
+0xB4, 0x07, 0x17, 0xC3, 0xBA, 0x0D, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x0A,
+0x41, 0x40, 0x10, 0x41, 0x4F, 0x5E, 0x4F, 0x00, 0x5E, 0x4F, 0xC0, 0x40, 0x00, 0x5E, 0xC3, 0x40,
+0x1E, 0x40, 0x0F, 0x01, 0x41, 0x40, 0x0D, 0x52, 0x40, 0xC3, 0x4F, 0x7B, 0x15, 0x09, 0x01, 0xC1,
+0x97, 0x09, 0x04, 0x55, 0x49, 0x03, 0xC1, 0x97, 0x09, 0x02, 0xC0, 0x97, 0x00, 0x50, 0x61, 0x45,
+0x09, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x4E, 0x46, 0xE0, 0x04, 0x75, 0x40, 0x10, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D,
+0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x41, 0x01, 0x40, 0x01, 0x41, 0x40, 0x41, 0x00, 0x40, 0x03, 0x41, 0x40,
+0x00, 0x41, 0x40, 0x07, 0x41, 0x40, 0x01, 0x41, 0x40, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x41,
+0x40, 0x00, 0x41, 0x40, 0x0A, 0x4B, 0x40, 0x00, 0xD4, 0xD6, 0x07, 0x0D, 0xBA, 0x07, 0x0D, 0x07,
+0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x07, 0x0D, 0x2E, 0xCB, 0x0D, 0xBA, 0x07, 0x00, 0xC3,
+0x81, 0xBA, 0x0D, 0x38, 0x01, 0xC2, 0xB4, 0x0B, 0x00, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x6D, 0x5F, 0x04, 0x41, 0x5F, 0x41, 0x67, 0x00, 0x4F, 0x00, 0x5E, 0x4F, 0x00,
+0x41, 0x40, 0x0D, 0x52, 0x40, 0xC5, 0x4F, 0x09, 0x62, 0x09, 0x97, 0x09, 0x01, 0xC5, 0x97, 0x09,
+0x10, 0x7B, 0x10, 0x33, 0x00, 0xC4, 0x7B, 0x41, 0xA5, 0x97, 0x09, 0x05, 0x5B, 0x69, 0x45, 0x01,
+0x42, 0x45, 0x42, 0x00, 0x45, 0x42, 0x45, 0x00, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x4E, 0x46,
+0x75, 0x48, 0x4E, 0xC8, 0x73, 0x0E, 0x68, 0x0C, 0x35, 0x0E, 0x03, 0x23, 0x06, 0x38, 0x75, 0x40,
+0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4A, 0x43, 0x42, 0x48, 0x44, 0x40, 0x4A, 0x45, 0x43, 0x4A,
+0x44, 0x40, 0x01, 0x44, 0x4A, 0x44, 0x42, 0x43, 0x00, 0x40, 0x05, 0x41, 0x00, 0x40, 0x44, 0x00,
+0x40, 0x41, 0x48, 0x00, 0x42, 0x44, 0x48, 0x45, 0x40, 0x01, 0x41, 0x40, 0x0D, 0xC4, 0xB4, 0x79,
+0x07, 0x0D, 0x07, 0x0A, 0x4D, 0xC6, 0x7F, 0xB9, 0x81, 0x4B, 0x38, 0x39, 0x55, 0x00, 0xC5, 0xBB,
+0xEC, 0x4B, 0xB4, 0x12, 0x00, 0x01, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41,
+0x40, 0x10, 0x41, 0xCB, 0x51, 0x6D, 0xAD, 0x8A, 0xAD, 0x29, 0x8C, 0x4F, 0x74, 0x4F, 0x1F, 0x0F,
+0x01, 0x41, 0x67, 0x40, 0x0F, 0xC2, 0x4F, 0x7B, 0x97, 0x00, 0x49, 0x03, 0x50, 0xC4, 0x66, 0x78,
+0x20, 0x66, 0x1A, 0x00, 0x73, 0xC2, 0xE0, 0x20, 0x09, 0x01, 0x55, 0x50, 0x49, 0x00, 0x50, 0xCC,
+0xAA, 0x05, 0x21, 0x28, 0x25, 0x03, 0x0A, 0x04, 0x08, 0x0E, 0x08, 0x05, 0x00, 0x1D, 0x41, 0x40,
+0x2A, 0x4E, 0xC7, 0x73, 0x04, 0x23, 0x08, 0x0C, 0x02, 0x08, 0x0E, 0x00, 0x44, 0x4C, 0x44, 0x75,
+0x46, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x42, 0x45, 0x4A, 0x48,
+0x45, 0x4E, 0x48, 0x42, 0x40, 0x42, 0x40, 0x01, 0x42, 0x41, 0x48, 0x4A, 0x43, 0x42, 0x40, 0x05,
+0x41, 0x40, 0x41, 0x4E, 0x43, 0x40, 0x45, 0x00, 0x44, 0x4A, 0x48, 0x44, 0x41, 0x40, 0x01, 0x41,
+0x40, 0x0B, 0x52, 0x4B, 0xC2, 0xD6, 0x2E, 0x07, 0x0C, 0x6E, 0x79, 0xCB, 0xBB, 0x81, 0xC6, 0x45,
+0xBB, 0x4D, 0x45, 0xB1, 0xBB, 0x45, 0xB4, 0x00, 0x02, 0x4B, 0x40, 0x02, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0xC2, 0xA5, 0xE5, 0x16, 0x00, 0x69, 0x73, 0xC6, 0x4F,
+0x8C, 0x6D, 0xE5, 0x0F, 0x93, 0x1E, 0x00, 0x4F, 0x41, 0x40, 0x0F, 0xC1, 0x4F, 0x09, 0x07, 0x73,
+0x5A, 0x73, 0xC0, 0x66, 0x00, 0xC4, 0x92, 0x10, 0x78, 0x20, 0x09, 0x01, 0x55, 0x49, 0xC4, 0x62,
+0x09, 0x1B, 0x29, 0x05, 0x02, 0x4E, 0x00, 0x42, 0x44, 0x42, 0x4E, 0x45, 0x41, 0x40, 0x1C, 0x41,
+0x40, 0x2A, 0x4E, 0xCD, 0x68, 0x03, 0x73, 0x6D, 0x23, 0x03, 0x63, 0x02, 0x8D, 0x08, 0x06, 0x86,
+0x23, 0x06, 0x37, 0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x17, 0x4B, 0x00, 0x40, 0x00, 0x41, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0E, 0x45, 0x4A,
+0x42, 0x41, 0x43, 0x48, 0x43, 0x48, 0x4A, 0x42, 0x40, 0x45, 0x40, 0x02, 0x43, 0x45, 0x4A, 0x42,
+0x48, 0x41, 0x40, 0x05, 0x41, 0x43, 0x4A, 0x48, 0x40, 0x00, 0x42, 0x44, 0x00, 0x4A, 0x42, 0x43,
+0x40, 0x01, 0x41, 0x40, 0x0D, 0xC3, 0xB4, 0x2E, 0x0D, 0x07, 0x0B, 0x6E, 0xC5, 0x4B, 0x39, 0x38,
+0x0D, 0x07, 0x4D, 0x00, 0xC8, 0x81, 0x39, 0x55, 0x79, 0xB4, 0x12, 0x00, 0x0B, 0x00, 0x04, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x67, 0x50, 0xC9, 0x99, 0xAB, 0x4F, 0x1B,
+0x99, 0x4F, 0x27, 0x96, 0x8E, 0x0F, 0x00, 0x5E, 0x4F, 0x5E, 0x67, 0x40, 0x0F, 0xC2, 0x4F, 0x62,
+0x09, 0x06, 0xCD, 0xA5, 0x72, 0x20, 0x66, 0xAD, 0x66, 0x1B, 0xAB, 0x82, 0x41, 0x09, 0x10, 0x15,
+0x09, 0x01, 0x50, 0xC3, 0x4F, 0x28, 0x21, 0x05, 0x00, 0x44, 0x45, 0x4E, 0x42, 0x48, 0x42, 0x45,
+0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x4E, 0x46, 0x43, 0x00, 0x42, 0x4E, 0x48, 0x75, 0x5F, 0x4E,
+0x5C, 0xC3, 0x70, 0x04, 0xCA, 0x06, 0x37, 0x75, 0x40, 0x0F, 0x52, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x03, 0x4B, 0x00, 0x40, 0x00, 0x41, 0x40, 0x18, 0x4B, 0x40, 0x00, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x44, 0x42, 0x44, 0x43, 0x48, 0x44, 0x42,
+0x48, 0x00, 0x43, 0x40, 0x01, 0x48, 0x4A, 0x42, 0x44, 0x43, 0x48, 0x41, 0x40, 0x04, 0x41, 0x00,
+0x42, 0x48, 0x4A, 0x41, 0x42, 0x4E, 0x43, 0x42, 0x43, 0x48, 0x42, 0x40, 0x01, 0x41, 0x40, 0x0D,
+0xC4, 0xB4, 0x07, 0xBA, 0x0D, 0x07, 0x02, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x01, 0x4D, 0x78, 0x79,
+0xCB, 0xCB, 0x45, 0x0D, 0x46, 0x55, 0xB9, 0x87, 0x7F, 0x4B, 0xB4, 0x0B, 0x00, 0x06, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0xCA, 0xAD, 0x4F, 0x16, 0xAD, 0x10, 0x29,
+0x96, 0x01, 0x96, 0x1F, 0x0F, 0x00, 0x5E, 0x00, 0x4F, 0x00, 0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x09,
+0x10, 0x09, 0x04, 0xC9, 0x82, 0x33, 0x20, 0x66, 0x92, 0x99, 0x09, 0x33, 0x7B, 0x09, 0x05, 0x5B,
+0x69, 0x45, 0x02, 0x4A, 0x00, 0x43, 0x4E, 0x00, 0x44, 0x45, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A,
+0x4E, 0x46, 0xCB, 0xCA, 0x23, 0x0C, 0x06, 0x35, 0x73, 0x35, 0x73, 0x0C, 0x8D, 0x68, 0x06, 0x38,
+0x75, 0x40, 0x00, 0x4B, 0x40, 0x4B, 0x00, 0x40, 0x4B, 0x00, 0x40, 0x4B, 0x00, 0x40, 0x4B, 0x00,
+0x40, 0x4B, 0x00, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x03, 0x4B, 0x40, 0x01, 0x65,
+0x4B, 0x17, 0x40, 0x00, 0x4B, 0x00, 0x65, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x07, 0x41, 0x00, 0x40, 0x0D, 0x41,
+0x00, 0x45, 0x01, 0x41, 0x40, 0x41, 0x00, 0x40, 0x41, 0x45, 0x41, 0x42, 0x44, 0x42, 0x45, 0x01,
+0x40, 0x45, 0x41, 0x40, 0x05, 0x41, 0x4B, 0x40, 0x01, 0x41, 0x00, 0x45, 0x00, 0x41, 0x00, 0x45,
+0x40, 0x01, 0x41, 0x00, 0x40, 0x0C, 0x71, 0xC2, 0xD6, 0x2E, 0x07, 0x0D, 0xC0, 0x4B, 0x00, 0x4D,
+0xCC, 0x4B, 0x07, 0x4B, 0x0D, 0x38, 0x55, 0x45, 0x2E, 0xB4, 0x12, 0x00, 0x0B, 0x00, 0x04, 0x41,
+0x40, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x45, 0xC7, 0x93, 0x1F, 0x29,
+0x22, 0xD9, 0x05, 0x0F, 0x1F, 0x00, 0x4F, 0x00, 0x5E, 0x4F, 0x5E, 0x67, 0x40, 0x52, 0x40, 0x0C,
+0x52, 0xCE, 0x4F, 0x10, 0x09, 0x10, 0x09, 0x10, 0x09, 0x10, 0x09, 0x10, 0x09, 0x1B, 0x09, 0x1B,
+0x15, 0x00, 0x49, 0x04, 0x55, 0x50, 0x49, 0x00, 0x50, 0x69, 0x45, 0x02, 0x42, 0x02, 0x44, 0x00,
+0x45, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x4E, 0x46, 0x0B, 0xC3, 0x73, 0x06, 0x73, 0x06, 0x00,
+0xC1, 0x73, 0x06, 0x00, 0xC1, 0x73, 0x06, 0x00, 0xC1, 0x73, 0x06, 0x00, 0xC1, 0x73, 0x06, 0x00,
+0xC1, 0x73, 0x06, 0x01, 0xC1, 0x73, 0x06, 0x21, 0x75, 0x4B, 0x40, 0x4B, 0x40, 0x0B, 0x4B, 0x40,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x4B, 0x41, 0x40, 0x00, 0x52, 0x40, 0x00,
+0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52, 0x40, 0x00, 0x52,
+0x40, 0x00, 0x52, 0x40, 0x4B, 0x00, 0x40, 0x52, 0x41, 0x52, 0x40, 0x0E, 0x41, 0x40, 0x0D, 0x41,
+0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x42, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x09, 0x41, 0x42, 0x01, 0x41, 0x40, 0x0A, 0x67, 0x41, 0x40, 0x0C, 0x41,
+0x40, 0x0B, 0x71, 0x40, 0xC1, 0xB4, 0x79, 0x0D, 0x6E, 0x4D, 0x00, 0x6E, 0x4D, 0xC3, 0x79, 0x0D,
+0x2E, 0x0D, 0x01, 0xC2, 0x4B, 0xE9, 0x00, 0x00, 0x4B, 0x40, 0x04, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x52, 0x5E, 0x4F, 0x01, 0x41, 0x4F, 0x03, 0x5F, 0x4F, 0xC5, 0x93, 0xA2,
+0x0F, 0x22, 0x0F, 0x00, 0x0E, 0x6D, 0xC9, 0x4F, 0x15, 0x09, 0x41, 0x10, 0x41, 0x09, 0x10, 0x41,
+0x09, 0x00, 0x55, 0x49, 0x55, 0x50, 0x55, 0x49, 0x01, 0x50, 0x49, 0x01, 0xC7, 0x41, 0x09, 0x10,
+0x1B, 0x21, 0x05, 0x02, 0x05, 0x06, 0x42, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x4E, 0x46, 0xE0, 0x04,
+0x75, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x03, 0x4B, 0x01, 0x40, 0x41,
+0x40, 0x18, 0x71, 0x40, 0x00, 0x41, 0x71, 0x4B, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x0D, 0x41, 0x40,
+0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x43, 0x48, 0x06, 0x43, 0x48, 0x0E,
+0x43, 0x48, 0x00, 0x43, 0x48, 0x07, 0x43, 0x48, 0x43, 0x48, 0x02, 0x43, 0x48, 0x05, 0x43, 0x48,
+0x01, 0x43, 0x48, 0x09, 0x43, 0x48, 0x0E, 0xDF, 0x59, 0x53, 0x71, 0x52, 0x71, 0x6A, 0x53, 0x52,
+0x6A, 0x53, 0x52, 0x6A, 0x53, 0x52, 0x6A, 0x53, 0x76, 0x71, 0x53, 0x76, 0x71, 0x6A, 0x52, 0x6A,
+0x52, 0x6A, 0x53, 0x52, 0x6A, 0x52, 0x30, 0x74, 0xC1, 0x53, 0x08, 0x03, 0x43, 0x48, 0x0E, 0x43,
+0x48, 0x01, 0x43, 0x48, 0x07, 0x43, 0x48, 0x0F, 0x66, 0x48, 0x70, 0xC2, 0x58, 0x30, 0x58, 0x01,
+0x70, 0xC1, 0x49, 0x58, 0x00, 0xC8, 0x49, 0x58, 0x08, 0x30, 0x58, 0x30, 0x08, 0x26, 0x08, 0x0C,
+0x70, 0xC7, 0x59, 0x70, 0x78, 0x1A, 0x78, 0x1A, 0xAB, 0x72, 0x00, 0xC6, 0xAB, 0x72, 0x1A, 0x78,
+0x1A, 0xAB, 0x72, 0x01, 0x5A, 0xC0, 0x72, 0x00, 0x5A, 0xC6, 0x72, 0xAB, 0x72, 0xAB, 0x72, 0x92,
+0x0A, 0x0A, 0x48, 0x43, 0x48, 0x19, 0x43, 0x48, 0x2B, 0x43, 0x4E, 0x4C, 0x09, 0xC0, 0xC4, 0x16,
+0x4C, 0xC1, 0x9E, 0x23, 0x00, 0x4C, 0x63, 0x4C, 0x63, 0x4C, 0x63, 0x4C, 0x63, 0x4C, 0x63, 0x4C,
+0x63, 0x4C, 0x63, 0x4C, 0x0F, 0x63, 0x74, 0xC1, 0x71, 0x3E, 0x0E, 0xC3, 0x53, 0x08, 0x03, 0x08,
+0x07, 0x43, 0x48, 0x12, 0x43, 0x48, 0x01, 0xDF, 0x59, 0x08, 0x30, 0x6D, 0x71, 0xA0, 0xA9, 0x4E,
+0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E,
+0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E, 0xA9, 0x4E, 0xC4, 0xA9, 0x4E, 0x71, 0x6D, 0x08, 0x0D, 0x43,
+0x48, 0x00, 0x43, 0x48, 0x09, 0x43, 0x48, 0x25, 0x43, 0x48, 0x0C, 0x44, 0x41, 0x42, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x0E, 0x41, 0x40, 0x08, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40,
+0x0C, 0x4B, 0x41, 0x4B, 0x40, 0x0D, 0x4B, 0x40, 0x04, 0x4B, 0x71, 0x40, 0x67, 0x65, 0x40, 0x07,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0xC9, 0x40, 0xA2, 0x22, 0x0F,
+0x40, 0x22, 0x1E, 0x0F, 0x01, 0x1E, 0x00, 0x4F, 0x62, 0x5E, 0x4F, 0x41, 0x40, 0x0F, 0xD0, 0x4F,
+0x10, 0x15, 0x41, 0x09, 0x10, 0x15, 0x09, 0x10, 0x15, 0x10, 0x1B, 0x09, 0x10, 0x09, 0x15, 0x10,
+0x00, 0x55, 0x50, 0x55, 0x50, 0x55, 0x49, 0x50, 0x49, 0x50, 0x69, 0x45, 0x05, 0x42, 0x45, 0x01,
+0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x45, 0x00, 0x65, 0x45, 0x7A, 0xC6, 0x4F, 0x0F, 0x05,
+0x25, 0x05, 0x25, 0x1B, 0x01, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x00, 0x55, 0x5B, 0x00, 0x55,
+0x5B, 0x55, 0x5B, 0x01, 0x55, 0x5B, 0x55, 0x5B, 0x01, 0xC1, 0x47, 0x00, 0x10, 0x6D, 0x67, 0x6D,
+0x52, 0x41, 0x6D, 0x52, 0x6D, 0x67, 0x6D, 0x40, 0x6D, 0x41, 0x52, 0x00, 0xC1, 0xB6, 0x24, 0x00,
+0xC1, 0x5E, 0x24, 0x02, 0xC6, 0x5E, 0x24, 0xAC, 0x5E, 0x24, 0x5E, 0x24, 0x00, 0xC4, 0xAC, 0x24,
+0x5E, 0xE4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x4B, 0xC1, 0xD6, 0x2E, 0x00, 0x47,
+0x6E, 0x47, 0x6E, 0x47, 0x6E, 0x47, 0x6E, 0x47, 0x6E, 0x47, 0x6E, 0x47, 0x6E, 0x47, 0x6E, 0x47,
+0x6E, 0x01, 0x47, 0x6E, 0x03, 0xC3, 0x4B, 0x81, 0xC0, 0x00, 0x0E, 0x41, 0x40, 0x0D, 0x41, 0x00,
+0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x00, 0x52, 0x71, 0x40, 0x6D, 0x71, 0x40, 0x52, 0x40, 0x11, 0x41, 0x40, 0x06, 0x41,
+0x40, 0x04, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40,
+0x0B, 0x41, 0x40, 0x0F, 0x52, 0xC3, 0xA2, 0x0F, 0xD9, 0x0F, 0x00, 0xC5, 0x40, 0x0F, 0x40, 0xA2,
+0x0F, 0x1E, 0x00, 0x4F, 0x5E, 0x4F, 0x5E, 0x67, 0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09,
+0x05, 0xC3, 0x41, 0x7B, 0x41, 0x09, 0x01, 0x5B, 0xC2, 0x41, 0x62, 0x09, 0x00, 0x55, 0x49, 0x01,
+0x50, 0x61, 0x45, 0x03, 0x42, 0x45, 0x02, 0x68, 0x4B, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x61,
+0x45, 0x00, 0x61, 0x45, 0x00, 0x68, 0x45, 0x02, 0xC3, 0x7A, 0x09, 0x62, 0x15, 0x01, 0x49, 0x00,
+0x55, 0x5B, 0x49, 0x00, 0x5B, 0xC4, 0x41, 0x10, 0x09, 0x1B, 0x09, 0x01, 0x55, 0x49, 0x01, 0x55,
+0x41, 0x40, 0x0F, 0x4F, 0x00, 0x5E, 0x00, 0x62, 0x5E, 0x00, 0x4F, 0x00, 0x5E, 0x4F, 0xC1, 0xA2,
+0x0F, 0x00, 0x5E, 0x4F, 0xC4, 0xB6, 0xD0, 0x24, 0xD0, 0x24, 0x00, 0xC3, 0x5E, 0x24, 0xAC, 0xD0,
+0x00, 0x64, 0x00, 0xC4, 0xD0, 0x24, 0xD0, 0x5E, 0x24, 0x00, 0xC1, 0xB6, 0x00, 0x01, 0x4B, 0x40,
+0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x11, 0x4D, 0x47, 0x6E, 0x47, 0x4D,
+0x47, 0x01, 0xC4, 0x79, 0x0D, 0x81, 0x31, 0x00, 0x0E, 0x41, 0x40, 0x03, 0x41, 0x40, 0x07, 0x41,
+0xC4, 0x47, 0x0B, 0x00, 0x12, 0x00, 0x00, 0x67, 0x40, 0x4B, 0x40, 0x06, 0x4B, 0x02, 0x40, 0x06,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x52,
+0x41, 0x45, 0x41, 0xC5, 0x47, 0x12, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x03, 0x45, 0x41, 0x40,
+0x45, 0x41, 0x40, 0x05, 0x41, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x41, 0x00, 0x40, 0x41, 0x01,
+0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0x45, 0xC6, 0x4F, 0xAA, 0x05, 0x3A, 0x1F, 0x0F, 0xDA, 0x00,
+0xC2, 0xA2, 0x1E, 0x0F, 0x00, 0x5E, 0x4F, 0x00, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x06, 0x50,
+0xC8, 0x82, 0x41, 0x20, 0x33, 0x41, 0x09, 0x20, 0x10, 0x09, 0x00, 0x50, 0x49, 0x02, 0x5B, 0x69,
+0x45, 0x00, 0x42, 0x45, 0x42, 0x01, 0x45, 0x42, 0x45, 0x00, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A,
+0x41, 0x42, 0x45, 0x01, 0x61, 0x42, 0x00, 0x45, 0x42, 0xC4, 0xBD, 0x22, 0x1B, 0x09, 0x15, 0x00,
+0x49, 0x01, 0x50, 0x49, 0x60, 0x50, 0x60, 0x5A, 0x73, 0x50, 0x73, 0x00, 0x49, 0x05, 0x50, 0xC2,
+0x47, 0x12, 0x00, 0x0E, 0xC2, 0xA2, 0x01, 0x22, 0x00, 0x52, 0xC1, 0x90, 0x22, 0x00, 0x4F, 0x62,
+0x00, 0x4F, 0x00, 0xCA, 0x90, 0x1E, 0x0F, 0x67, 0xD0, 0x4E, 0x24, 0x5E, 0xAC, 0x24, 0x4E, 0x00,
+0xC5, 0xAC, 0x24, 0x5E, 0xAC, 0x5E, 0xAC, 0x00, 0xC1, 0x4E, 0x24, 0x00, 0xC1, 0xB6, 0x00, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x11, 0x4D, 0x6E, 0x47, 0x00, 0x4D, 0xC6,
+0x4B, 0x0D, 0x2E, 0x81, 0xBA, 0x81, 0x00, 0x0F, 0x41, 0x40, 0x01, 0x41, 0x40, 0x00, 0x45, 0x41,
+0x40, 0x41, 0x00, 0x40, 0x02, 0x6D, 0x41, 0xCB, 0x47, 0x01, 0x0F, 0x01, 0x0B, 0x00, 0x0B, 0x27,
+0x00, 0x05, 0x01, 0x00, 0x02, 0x41, 0x00, 0x40, 0x41, 0x65, 0x40, 0x06, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4A, 0x43, 0x42, 0x4A,
+0x76, 0xC3, 0x47, 0x0A, 0x05, 0x08, 0x00, 0x43, 0x40, 0x01, 0x44, 0x4A, 0x43, 0x42, 0x4A, 0x42,
+0x40, 0x05, 0x41, 0x00, 0x40, 0x43, 0x00, 0x40, 0x45, 0x48, 0x00, 0x42, 0x43, 0x48, 0x45, 0x40,
+0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B,
+0x41, 0x40, 0x0F, 0x52, 0x4F, 0x56, 0xC8, 0x99, 0x6D, 0x29, 0x1B, 0x16, 0x29, 0x8C, 0x10, 0x1E,
+0x00, 0x4F, 0x5E, 0x00, 0x4F, 0x67, 0x40, 0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x03, 0xCB,
+0x97, 0x66, 0x78, 0x1B, 0x72, 0xE0, 0x1B, 0x33, 0xE0, 0xA5, 0x15, 0x09, 0x00, 0x55, 0x49, 0x01,
+0x50, 0x69, 0x45, 0x02, 0x48, 0x4E, 0x42, 0x48, 0x4E, 0x43, 0x45, 0x41, 0x40, 0x1C, 0x41, 0x40,
+0x2A, 0x41, 0x42, 0x45, 0x00, 0x42, 0x00, 0x4E, 0x48, 0x42, 0x4E, 0x4A, 0x68, 0x56, 0x49, 0x00,
+0x55, 0x49, 0x01, 0x55, 0x73, 0xCA, 0xE0, 0xA5, 0x78, 0x1A, 0x66, 0x33, 0x1A, 0x78, 0x99, 0x41,
+0x09, 0x03, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x4F, 0x42, 0xDF, 0x5A, 0x49, 0x26, 0x36, 0x4A, 0x49,
+0x3F, 0x30, 0x58, 0x04, 0x08, 0x0A, 0x37, 0x2D, 0xF1, 0x5E, 0xC1, 0xAC, 0x61, 0xCD, 0x4E, 0x87,
+0x61, 0x4E, 0x61, 0x6F, 0xCD, 0xA0, 0xCD, 0x87, 0x61, 0x4E, 0xC2, 0x5E, 0xE4, 0x00, 0x01, 0x4B,
+0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x0D, 0x4D, 0x47, 0xCE,
+0x4B, 0xBB, 0x46, 0x4B, 0x38, 0x4D, 0xBB, 0x0D, 0x38, 0xBB, 0x45, 0x81, 0x0B, 0x12, 0x00, 0x0D,
+0x41, 0x40, 0x41, 0x4A, 0x41, 0x40, 0x44, 0x4A, 0x43, 0x44, 0x4A, 0x44, 0x40, 0x02, 0x41, 0x4B,
+0xC7, 0x53, 0x08, 0x04, 0x1C, 0x0E, 0x00, 0x08, 0x04, 0x00, 0x48, 0x00, 0x41, 0x40, 0x00, 0x45,
+0x4A, 0x48, 0x42, 0x4A, 0x48, 0x45, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x44, 0x45, 0xC8, 0x6D, 0x58, 0xAA, 0x0E,
+0x58, 0x02, 0x00, 0x02, 0x00, 0x01, 0x45, 0x41, 0x48, 0x43, 0x4A, 0x42, 0x40, 0x05, 0x41, 0x40,
+0x41, 0x4A, 0x43, 0x40, 0x41, 0x00, 0x43, 0x00, 0x4A, 0x43, 0x45, 0x40, 0x01, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x52,
+0x4F, 0x41, 0x60, 0xCE, 0xE5, 0x01, 0x20, 0xAD, 0x4F, 0x51, 0xAD, 0x27, 0x40, 0x1E, 0x0F, 0x1E,
+0x0F, 0x27, 0x00, 0x0F, 0xC2, 0x4F, 0x10, 0x09, 0x04, 0x50, 0xCA, 0x97, 0x33, 0x72, 0x10, 0x66,
+0xCF, 0x1A, 0x10, 0x78, 0x20, 0x09, 0x00, 0x50, 0x49, 0x00, 0xC4, 0x62, 0x09, 0x1B, 0x29, 0x05,
+0x02, 0x4A, 0x00, 0x44, 0x42, 0x48, 0x4A, 0x45, 0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42,
+0x45, 0x01, 0x44, 0x4E, 0xC6, 0x74, 0x08, 0x63, 0x08, 0x60, 0x1B, 0x09, 0x05, 0xCA, 0xA5, 0xAB,
+0x82, 0x66, 0x92, 0x66, 0x20, 0x1B, 0x66, 0x20, 0x09, 0x00, 0x55, 0x49, 0x01, 0x50, 0xC2, 0x47,
+0x12, 0x00, 0x0E, 0x52, 0xD3, 0x49, 0x02, 0x1E, 0x3F, 0x12, 0x49, 0x90, 0x28, 0x5A, 0x60, 0xBD,
+0x49, 0x5A, 0x36, 0x0F, 0xB6, 0x4E, 0xD5, 0x4E, 0xC1, 0x00, 0xC7, 0x6F, 0x24, 0x4E, 0xC1, 0xCD,
+0x87, 0xCD, 0x61, 0x00, 0xC5, 0x76, 0x61, 0xA0, 0x24, 0xD4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x0E, 0x4D, 0x47, 0xCC, 0x45, 0xBB, 0x55, 0x38, 0x4B, 0x7F,
+0xBB, 0x0D, 0x45, 0x64, 0x46, 0x81, 0x00, 0x0F, 0x41, 0x40, 0x42, 0x4E, 0x45, 0x40, 0x45, 0x41,
+0x48, 0x43, 0x48, 0x00, 0x40, 0x02, 0x41, 0xCD, 0x47, 0x0A, 0x03, 0x02, 0x1C, 0x0E, 0x05, 0x0A,
+0x49, 0x03, 0x00, 0x05, 0x01, 0x00, 0x00, 0x45, 0x41, 0x43, 0x00, 0x48, 0x00, 0x45, 0x40, 0x05,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45,
+0x4A, 0x4F, 0x41, 0x48, 0x66, 0x48, 0xC5, 0x6D, 0x86, 0x02, 0x00, 0x05, 0x00, 0x01, 0x41, 0x43,
+0x45, 0x42, 0x41, 0x48, 0x42, 0x40, 0x04, 0x41, 0x40, 0x48, 0x4A, 0x00, 0x40, 0x00, 0x42, 0x43,
+0x41, 0x45, 0x00, 0x48, 0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x52, 0x4F, 0xD1, 0xE8, 0xAD, 0x29, 0x0F, 0x7B,
+0xAD, 0x3A, 0x4F, 0xA5, 0xA2, 0xFB, 0x0F, 0xA2, 0x1E, 0x0F, 0x27, 0x12, 0x00, 0x0E, 0xC4, 0x4F,
+0x62, 0x09, 0x10, 0x09, 0x04, 0x60, 0xCC, 0x72, 0x33, 0x66, 0x92, 0x66, 0x1B, 0x72, 0xA5, 0x15,
+0x09, 0x10, 0x15, 0x09, 0x01, 0x50, 0x61, 0x45, 0x01, 0x42, 0x44, 0x45, 0x4E, 0x42, 0x00, 0x4E,
+0x45, 0x71, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0x5C, 0x68, 0x76, 0xC9, 0x8D,
+0x04, 0x26, 0x60, 0x1B, 0x09, 0x15, 0x09, 0x97, 0x09, 0x01, 0x5B, 0xC8, 0xAB, 0x20, 0x66, 0x20,
+0x92, 0x72, 0xCF, 0x6D, 0x09, 0x05, 0x50, 0xC1, 0x47, 0x00, 0x0E, 0x52, 0x41, 0xD9, 0x49, 0x3F,
+0x1E, 0x3F, 0x27, 0x5A, 0x28, 0x90, 0x3F, 0x30, 0x49, 0x58, 0x04, 0x30, 0x0F, 0xF1, 0xA0, 0x72,
+0xCD, 0xC1, 0xA9, 0xC1, 0xAC, 0x5E, 0x6F, 0x4E, 0x00, 0xC3, 0xC1, 0x6F, 0xCD, 0x4E, 0x00, 0x64,
+0xC2, 0x5E, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2,
+0x07, 0x0E, 0x4D, 0xC4, 0xBA, 0x0D, 0x7F, 0x4D, 0x0D, 0x00, 0x78, 0xC6, 0xB9, 0x45, 0xB9, 0x88,
+0x4D, 0x81, 0x0B, 0x00, 0x40, 0x0D, 0x41, 0x42, 0x48, 0x4E, 0x42, 0x40, 0x41, 0x43, 0x45, 0x43,
+0x42, 0x48, 0x41, 0x40, 0x01, 0x41, 0x4B, 0x4A, 0x42, 0x41, 0x5C, 0xC1, 0x53, 0x08, 0x00, 0x70,
+0x43, 0x40, 0x45, 0x41, 0x40, 0x01, 0x44, 0x00, 0x42, 0x43, 0x00, 0x42, 0x40, 0x05, 0x41, 0x40,
+0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x43,
+0x44, 0xC5, 0x51, 0x04, 0x08, 0x04, 0x02, 0x08, 0x00, 0x43, 0x40, 0x01, 0x48, 0x4E, 0x42, 0x00,
+0x48, 0x43, 0x40, 0x06, 0x41, 0x42, 0x43, 0x48, 0x45, 0x42, 0x4E, 0x43, 0x42, 0x43, 0x48, 0x42,
+0x40, 0x01, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x18, 0x41, 0x40, 0x4B, 0x40, 0x05, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0x00, 0x4B, 0x52, 0x4F, 0xC4, 0x93, 0xAD,
+0xAA, 0x02, 0x8C, 0x00, 0x42, 0x69, 0x56, 0x4F, 0xC6, 0x40, 0x1E, 0x0F, 0x1E, 0x0F, 0x1E, 0x00,
+0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x06, 0xC1, 0x97, 0x33, 0x00, 0x50, 0x5B, 0x5A, 0x50, 0x73, 0x60,
+0x49, 0x05, 0x5B, 0x69, 0x45, 0x02, 0xC8, 0x53, 0x0A, 0x03, 0x08, 0x0A, 0x08, 0x05, 0x01, 0x00,
+0x1C, 0x41, 0x40, 0x2A, 0x41, 0x45, 0x02, 0x44, 0x4A, 0x00, 0x44, 0x4A, 0x00, 0x68, 0x5B, 0x49,
+0x05, 0xCB, 0x41, 0x33, 0x10, 0x1A, 0x78, 0x1A, 0x99, 0x78, 0x1A, 0x7B, 0x15, 0x09, 0x03, 0x50,
+0xC1, 0x47, 0x00, 0x0F, 0x4F, 0xD1, 0xBD, 0x49, 0x58, 0x26, 0x1E, 0x30, 0x90, 0x28, 0x5A, 0x30,
+0x03, 0x58, 0x49, 0x26, 0x0F, 0xC5, 0xA0, 0x87, 0x00, 0xC2, 0x61, 0x5E, 0x61, 0x00, 0xC5, 0x87,
+0x4E, 0xA0, 0xA9, 0xC1, 0x61, 0x00, 0xC5, 0xD5, 0xCD, 0x4E, 0xAC, 0xB6, 0x00, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x0E, 0x6E, 0x47, 0x00, 0xCB, 0x4D, 0x46, 0xC6, 0x4B,
+0x38, 0x39, 0x38, 0x46, 0xBB, 0x4D, 0x81, 0x00, 0x0F, 0x41, 0x00, 0x42, 0x4A, 0x42, 0x41, 0x48,
+0x4A, 0x44, 0x00, 0x48, 0x00, 0x40, 0x02, 0x52, 0xC7, 0x47, 0x0A, 0x08, 0x36, 0x44, 0x04, 0x08,
+0x04, 0x00, 0x43, 0x00, 0x4A, 0x41, 0x40, 0x00, 0x42, 0x4E, 0x43, 0x5C, 0x48, 0xC2, 0x53, 0x02,
+0x00, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00,
+0x40, 0x0D, 0x41, 0x40, 0x41, 0x45, 0x41, 0x52, 0xC4, 0x47, 0x12, 0x47, 0x00, 0x01, 0x01, 0x42,
+0x44, 0x00, 0x45, 0x41, 0x01, 0x45, 0x41, 0x40, 0x05, 0x41, 0x00, 0x40, 0x02, 0x41, 0x00, 0x45,
+0x40, 0x41, 0x45, 0x40, 0x01, 0x41, 0x00, 0x40, 0x0B, 0x52, 0x4B, 0x41, 0x6D, 0x4B, 0x17, 0x6D,
+0x41, 0x40, 0x4B, 0x00, 0x40, 0x04, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x0A, 0x41, 0x40, 0x4B,
+0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x00, 0x40, 0x02, 0x6D, 0x5E, 0x00,
+0x4F, 0x00, 0xC4, 0xA2, 0x0F, 0x01, 0x22, 0x0F, 0x00, 0x62, 0x4F, 0x00, 0x5E, 0xC3, 0xA2, 0x0F,
+0x27, 0x12, 0x00, 0x40, 0x0D, 0xC2, 0x4F, 0x62, 0x09, 0x06, 0x50, 0x55, 0xC6, 0x41, 0x15, 0x09,
+0x15, 0x09, 0x1B, 0x09, 0x02, 0x55, 0x49, 0x01, 0x50, 0x69, 0x45, 0x00, 0x42, 0x45, 0x00, 0x42,
+0x00, 0x45, 0x42, 0x45, 0x00, 0x6D, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x42, 0x45,
+0x00, 0x42, 0x00, 0x45, 0x42, 0x00, 0x45, 0x5B, 0x49, 0x08, 0x55, 0x5B, 0x49, 0x00, 0x5B, 0x49,
+0x06, 0x50, 0xC3, 0x47, 0x00, 0x12, 0x00, 0x0C, 0x52, 0x4F, 0x5E, 0x45, 0xC3, 0x90, 0x27, 0x0F,
+0x22, 0x00, 0x41, 0x62, 0x45, 0x4F, 0x00, 0xC4, 0x90, 0x1E, 0x0F, 0x67, 0x24, 0x00, 0xC4, 0x5B,
+0x24, 0x5E, 0xAC, 0x4E, 0x00, 0x64, 0x00, 0xC4, 0x4E, 0xAC, 0xD0, 0x5E, 0x4E, 0x00, 0xC3, 0xAC,
+0xD0, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00,
+0xC2, 0xB2, 0x2E, 0x07, 0x10, 0x6E, 0x4D, 0xC6, 0x4B, 0x2E, 0x0D, 0x2E, 0x07, 0x0D, 0x07, 0x00,
+0xC2, 0x81, 0x0B, 0x00, 0x0E, 0x41, 0x40, 0x01, 0x41, 0x01, 0x45, 0x41, 0x40, 0x45, 0x41, 0x40,
+0x02, 0x41, 0xC7, 0x47, 0x12, 0x1F, 0x05, 0x01, 0x00, 0x01, 0x00, 0x00, 0x71, 0x45, 0x52, 0x69,
+0x44, 0x00, 0x42, 0x41, 0x45, 0x41, 0x01, 0x40, 0x06, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41,
+0x00, 0x40, 0x42, 0x40, 0x00, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x02, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x02, 0x40, 0x41, 0x05, 0x40,
+0x41, 0x42, 0x01, 0x41, 0x01, 0x40, 0x00, 0x41, 0x01, 0x40, 0x41, 0x00, 0x40, 0x41, 0x07, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x03, 0x6D, 0x71, 0x41, 0x6D, 0x71, 0x41, 0x6D, 0x71, 0x41, 0x6D, 0x71,
+0x41, 0x6D, 0x41, 0x00, 0x65, 0x41, 0x71, 0x67, 0x52, 0x67, 0x00, 0x52, 0x67, 0x00, 0x52, 0x67,
+0x00, 0x52, 0x67, 0x00, 0x52, 0x67, 0x00, 0x52, 0x67, 0x00, 0x52, 0x67, 0x00, 0x52, 0x67, 0x00,
+0x65, 0xDA, 0x47, 0x01, 0x2D, 0x47, 0x27, 0x2D, 0x31, 0x01, 0x2D, 0x1F, 0x12, 0x01, 0x47, 0x12,
+0x01, 0x47, 0x12, 0x01, 0x47, 0x12, 0x01, 0x47, 0x12, 0x01, 0x47, 0x12, 0x01, 0x00, 0xDD, 0x47,
+0x01, 0x12, 0x47, 0x01, 0x12, 0x47, 0x01, 0x2D, 0x27, 0x47, 0x01, 0x25, 0x2D, 0x31, 0x00, 0x31,
+0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x01, 0x12, 0x31, 0x12, 0x00, 0x62, 0x00,
+0x5F, 0x62, 0x45, 0x62, 0x45, 0x62, 0x00, 0x45, 0xC2, 0xA2, 0x05, 0x22, 0x02, 0x4F, 0x67, 0x6D,
+0x67, 0x6D, 0xD0, 0x47, 0x27, 0x2D, 0x47, 0x27, 0x2D, 0x47, 0x27, 0x2D, 0x47, 0x27, 0x2D, 0x0F,
+0x4F, 0x10, 0x09, 0x10, 0x05, 0x49, 0x50, 0x02, 0x49, 0x50, 0x00, 0x49, 0x50, 0x01, 0x49, 0x50,
+0x02, 0x69, 0x42, 0x00, 0x45, 0x42, 0x45, 0x42, 0x68, 0x61, 0x68, 0x42, 0x00, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x04, 0x40, 0x41, 0x00, 0x40, 0x41,
+0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40,
+0x41, 0x00, 0x40, 0x41, 0x01, 0x42, 0x00, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x01, 0xC5, 0xBD,
+0x1B, 0x97, 0x10, 0x97, 0x10, 0x05, 0x49, 0x50, 0x01, 0x49, 0x50, 0x05, 0xC5, 0x97, 0x10, 0x1F,
+0x47, 0x12, 0x01, 0x00, 0x4B, 0x41, 0x67, 0x4B, 0x41, 0x67, 0x4B, 0x41, 0x67, 0x4B, 0x41, 0x67,
+0x6D, 0x62, 0x00, 0x5F, 0x62, 0x00, 0x45, 0x4F, 0x62, 0x45, 0x4F, 0x62, 0x4F, 0x7A, 0x62, 0x00,
+0x4F, 0xC3, 0x89, 0x5E, 0x24, 0x5E, 0x00, 0x64, 0xC8, 0x5E, 0x14, 0xD0, 0x5E, 0xD0, 0x24, 0x5E,
+0x14, 0x24, 0x00, 0xCC, 0x5E, 0xD0, 0x5E, 0xB6, 0x2D, 0x27, 0x0B, 0x01, 0x47, 0x27, 0x01, 0x00,
+0x01, 0x00, 0x40, 0x41, 0x02, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41,
+0x00, 0x40, 0x41, 0x00, 0x5F, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x71, 0x6D, 0x41, 0x67, 0xC3, 0x7D,
+0x79, 0xCB, 0x38, 0x0C, 0xC1, 0xCB, 0x38, 0x00, 0xC3, 0xCB, 0x38, 0x81, 0x38, 0x04, 0xC6, 0xCB,
+0xB1, 0x47, 0x27, 0x01, 0x00, 0x01, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00,
+0x40, 0x41, 0x03, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x01, 0x40, 0x41, 0x01, 0xC3,
+0x47, 0x2D, 0x00, 0x01, 0x00, 0x4B, 0x41, 0x00, 0x6D, 0x41, 0x40, 0x45, 0x44, 0x42, 0x45, 0x41,
+0x40, 0x41, 0x4B, 0x67, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x02, 0x40, 0x41, 0x40, 0x41,
+0x00, 0x40, 0x41, 0x03, 0x40, 0x41, 0x00, 0x40, 0x41, 0x00, 0x40, 0x41, 0x02, 0x40, 0x43, 0x48,
+0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x02, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x01, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x01, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x00,
+0x43, 0xC2, 0x71, 0xA0, 0x61, 0x00, 0xDA, 0x4E, 0x87, 0x4E, 0x87, 0x4E, 0x61, 0xA0, 0x61, 0x4E,
+0x87, 0x4E, 0x61, 0xA0, 0x61, 0x4E, 0x87, 0x4E, 0x61, 0xA0, 0x61, 0x4E, 0x87, 0x4E, 0x87, 0x53,
+0x59, 0x08, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x66, 0x48, 0x43, 0x66, 0x48,
+0x43, 0x66, 0x48, 0x43, 0x66, 0x48, 0x43, 0x66, 0x48, 0x01, 0x43, 0x66, 0x48, 0x43, 0x66, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x7E, 0x74, 0x7E, 0x74, 0x00, 0x7E, 0x74, 0x00, 0x7E, 0x74,
+0x00, 0x7E, 0x74, 0x00, 0x7E, 0x00, 0x74, 0x7E, 0x74, 0xC3, 0x58, 0x08, 0x26, 0x08, 0x01, 0x66,
+0x48, 0x01, 0xC1, 0x59, 0x08, 0x04, 0x66, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x66, 0xC3, 0x70, 0xAB, 0x1A, 0x72, 0x00, 0x5A, 0x00, 0xC1,
+0x72, 0x1A, 0x00, 0xC4, 0x72, 0x1A, 0x72, 0x1A, 0x72, 0x00, 0x5A, 0xC0, 0x72, 0x00, 0x5A, 0x00,
+0xC2, 0x72, 0x1A, 0x72, 0x00, 0x5A, 0xC1, 0x92, 0x0A, 0x08, 0xC9, 0x53, 0x0A, 0x08, 0x03, 0x08,
+0x03, 0x08, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x4A, 0x07, 0xC4, 0x58, 0x0A, 0x92,
+0xAB, 0x72, 0x00, 0x5A, 0xC1, 0x72, 0x1A, 0x00, 0xC2, 0x72, 0x1A, 0x72, 0x01, 0x5A, 0x00, 0xC5,
+0x72, 0x1A, 0x72, 0x1A, 0x72, 0x1A, 0x00, 0xC6, 0x72, 0xAB, 0x1A, 0x6D, 0x26, 0x08, 0x03, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x66, 0x48, 0x00, 0xC3,
+0x59, 0x08, 0x26, 0x08, 0x04, 0x66, 0x48, 0x70, 0x48, 0x66, 0x7E, 0xCC, 0x9C, 0x9B, 0x9C, 0x34,
+0x9B, 0x9C, 0x34, 0x9C, 0x34, 0x64, 0x9C, 0x34, 0x9C, 0x00, 0x74, 0xC5, 0x9B, 0x34, 0x9C, 0x71,
+0x26, 0x08, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43,
+0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0xC2, 0x74, 0x4E, 0x39, 0x00, 0xD1, 0xA0, 0x39, 0x61,
+0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x39, 0xA0, 0x39, 0x61, 0x39, 0x00,
+0xD0, 0xB9, 0x39, 0xB9, 0x39, 0x61, 0x39, 0x61, 0x39, 0xA0, 0x74, 0x26, 0x08, 0x03, 0x08, 0x03,
+0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x00, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48, 0x00, 0x43, 0x48, 0x00, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x04, 0x48, 0x00, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48,
+0x43, 0x48, 0x43, 0x48, 0x01, 0x43, 0x48, 0x43, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x44, 0x41, 0x42, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0xC5, 0xB4, 0x07, 0x0D, 0x07,
+0x0D, 0x07, 0x02, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D, 0x47, 0x01, 0x4D, 0x47, 0x4D,
+0x47, 0x01, 0x4D, 0xC1, 0xB4, 0x00, 0x01, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x05,
+0x4B, 0x40, 0x01, 0x4B, 0xC1, 0x67, 0x24, 0x0B, 0xC1, 0xAC, 0x24, 0x00, 0xC3, 0xAC, 0x5E, 0xB7,
+0x00, 0x0D, 0x41, 0x40, 0x0F, 0xCE, 0x4F, 0x10, 0x09, 0x1B, 0x15, 0x09, 0x10, 0x15, 0x10, 0x09,
+0x10, 0x15, 0x09, 0x10, 0x15, 0x00, 0x50, 0x55, 0x00, 0x50, 0x55, 0x49, 0x55, 0x00, 0x49, 0x50,
+0x5B, 0xC1, 0x4F, 0x05, 0x09, 0x67, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x45, 0x08, 0x7A, 0x5B,
+0x49, 0x00, 0xD7, 0x41, 0x15, 0x09, 0x10, 0x15, 0x09, 0x10, 0x15, 0x1B, 0x15, 0x10, 0x09, 0x10,
+0x15, 0x09, 0x10, 0x15, 0x09, 0x10, 0x15, 0x41, 0x10, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x0D, 0xC3,
+0xB6, 0x24, 0x14, 0x24, 0x01, 0x54, 0x64, 0x54, 0xC0, 0xAC, 0x00, 0x54, 0x64, 0x54, 0x64, 0x54,
+0xC1, 0xAC, 0x24, 0x00, 0xC1, 0xE4, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xD6,
+0x0D, 0x07, 0x02, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x00, 0x4D, 0x47, 0x02, 0x4D,
+0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0x4D, 0x47, 0xC2, 0x81, 0x0B, 0x00, 0x0E, 0x41, 0x40,
+0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0xC5,
+0xB4, 0x07, 0xCB, 0x0D, 0x07, 0x0D, 0x02, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0x47,
+0x4D, 0x01, 0x47, 0x4D, 0x47, 0x4D, 0x00, 0x47, 0x4D, 0xC2, 0xB4, 0x0B, 0x00, 0x00, 0x4B, 0x40,
+0x03, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x07, 0x4B, 0x40, 0x71, 0x4B, 0xC1, 0x5B, 0x24, 0x10, 0xC1,
+0xE7, 0x00, 0x0D, 0x41, 0x4B, 0x00, 0x40, 0x0C, 0x52, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x04,
+0x5B, 0x49, 0x01, 0xC1, 0x41, 0x09, 0x00, 0x5B, 0x49, 0x02, 0x55, 0x49, 0x01, 0x50, 0x69, 0x45,
+0x08, 0x61, 0x67, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x08, 0x5B, 0x50, 0x49, 0x05,
+0x55, 0x49, 0x03, 0x5B, 0x49, 0x06, 0x50, 0xC1, 0x47, 0x00, 0x0E, 0x4B, 0x41, 0x40, 0x09, 0x4B,
+0x40, 0x01, 0xC1, 0xB6, 0x24, 0x06, 0xC1, 0xD0, 0x24, 0x02, 0xC1, 0xD0, 0x24, 0x00, 0xC3, 0xD0,
+0x24, 0xC5, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E,
+0x07, 0x1A, 0xC2, 0x79, 0x0B, 0x00, 0x0E, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x01, 0x45, 0x41, 0xC7,
+0x47, 0x12, 0x00, 0x01, 0x00, 0x01, 0x05, 0x00, 0x03, 0x45, 0x41, 0x40, 0x45, 0x40, 0x06, 0x4B,
+0x41, 0x40, 0x71, 0x40, 0x01, 0x41, 0x45, 0x40, 0x41, 0x45, 0x40, 0x02, 0x41, 0x40, 0x0B, 0x4B,
+0xC4, 0x47, 0xB4, 0x07, 0x0D, 0x07, 0x0C, 0x4D, 0x78, 0x47, 0x4D, 0x01, 0xC6, 0x4B, 0x0D, 0xC3,
+0xC6, 0x2E, 0xB4, 0x00, 0x01, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x4B, 0x40,
+0x00, 0x4B, 0x54, 0x64, 0xC1, 0x5E, 0x24, 0x00, 0xC4, 0x4E, 0x24, 0xAC, 0x4E, 0x24, 0x00, 0xC0,
+0x4E, 0x00, 0x64, 0x00, 0xC5, 0x4E, 0x5E, 0x24, 0x14, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x4B, 0x40,
+0x0D, 0xC2, 0x4F, 0x62, 0x09, 0x06, 0x73, 0x00, 0x55, 0xC6, 0x7B, 0x33, 0x1B, 0x82, 0x1A, 0x10,
+0x09, 0x05, 0x5B, 0x69, 0x45, 0x02, 0x42, 0x44, 0x42, 0x45, 0x00, 0x42, 0x45, 0x41, 0x40, 0x1C,
+0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0x68, 0x45, 0x42, 0x45, 0x42, 0x00, 0x45, 0x5B, 0x49,
+0x05, 0xC7, 0x41, 0x99, 0x10, 0x1B, 0x33, 0x10, 0x09, 0x33, 0x00, 0x50, 0x49, 0x04, 0x50, 0xC1,
+0x47, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xC4, 0xD4, 0xD0, 0x4E, 0x5E, 0x24, 0x00,
+0xC0, 0x4E, 0x00, 0x64, 0x01, 0xC2, 0x5E, 0xAC, 0x4E, 0x00, 0x64, 0x01, 0xC2, 0x5E, 0xB6, 0x00,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x04, 0x4B, 0x40, 0x00, 0xC1, 0xB2, 0x07, 0x00, 0x6E, 0x47,
+0x01, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x01, 0x6E, 0x47, 0x02, 0x78, 0x47, 0x6E, 0x47, 0x4D, 0xC7,
+0x79, 0x07, 0x38, 0xC3, 0x07, 0x81, 0x0B, 0x00, 0x0E, 0x41, 0x40, 0x00, 0x41, 0x40, 0x01, 0x45,
+0x41, 0x00, 0x45, 0x41, 0x40, 0x02, 0x4B, 0x41, 0x00, 0x45, 0x5F, 0x41, 0x00, 0x40, 0x41, 0x40,
+0x00, 0x45, 0x41, 0x40, 0x02, 0x45, 0x41, 0x40, 0x45, 0x41, 0x00, 0x40, 0x05, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x44, 0x42,
+0x4A, 0x76, 0x41, 0x4E, 0x61, 0x48, 0x43, 0x00, 0x40, 0x01, 0x43, 0x48, 0x43, 0x44, 0x4A, 0x43,
+0x41, 0x40, 0x04, 0x41, 0x00, 0x40, 0x43, 0x00, 0x40, 0x45, 0x4A, 0x48, 0x44, 0x48, 0x00, 0x42,
+0x40, 0x01, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0xC3, 0xB4, 0x07, 0x0D, 0x07, 0x0C, 0xC3, 0x6E, 0xBB,
+0x4B, 0x38, 0x00, 0xC9, 0x87, 0x46, 0x55, 0xBB, 0x7F, 0x79, 0xB4, 0x12, 0x0B, 0x00, 0x05, 0x41,
+0x40, 0x0E, 0x41, 0x40, 0x0A, 0x4B, 0xC8, 0x5B, 0xA0, 0xC1, 0xAC, 0x88, 0xC1, 0x4E, 0x6F, 0x61,
+0x00, 0xCA, 0x4E, 0x61, 0x6F, 0x61, 0xA0, 0xC1, 0x6F, 0x5E, 0x24, 0xB7, 0x00, 0x0D, 0x41, 0x40,
+0x0F, 0xC4, 0x4F, 0x62, 0x09, 0x10, 0x09, 0x03, 0x60, 0xCA, 0xAB, 0x66, 0x10, 0x72, 0xE0, 0x10,
+0x66, 0x1A, 0x72, 0x1B, 0x09, 0x00, 0x55, 0x49, 0x01, 0x50, 0x69, 0x45, 0x00, 0x42, 0x45, 0x48,
+0x4A, 0x44, 0x45, 0x4A, 0x48, 0x45, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x02, 0x42,
+0x4E, 0x5C, 0x4E, 0x4A, 0x7F, 0x5B, 0x49, 0x55, 0x49, 0x02, 0x5B, 0x73, 0xCA, 0xE0, 0x20, 0x10,
+0xE0, 0x1A, 0x20, 0xAB, 0x92, 0x33, 0x15, 0x09, 0x03, 0x50, 0xC3, 0x47, 0x00, 0x12, 0x00, 0x0D,
+0x41, 0x40, 0x0D, 0xD4, 0xB6, 0x5E, 0x87, 0x61, 0xCD, 0x5E, 0x87, 0x61, 0xCD, 0xA9, 0x4E, 0x61,
+0x6F, 0x61, 0x87, 0x4E, 0xAC, 0x24, 0x5E, 0xE7, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x0E, 0x4D, 0x47, 0xC3, 0x45, 0xBB, 0x46, 0x38, 0x00, 0xC7,
+0x7F, 0xBB, 0x38, 0xB9, 0x87, 0x46, 0x79, 0x00, 0x0F, 0x41, 0x40, 0x41, 0x4A, 0x45, 0x40, 0x43,
+0x48, 0x43, 0x42, 0x48, 0x4E, 0x41, 0x40, 0x01, 0x41, 0x4B, 0x4A, 0x43, 0x44, 0x00, 0x4E, 0x40,
+0x4A, 0x44, 0x43, 0x00, 0x4A, 0x41, 0x40, 0x00, 0x42, 0x48, 0x00, 0x42, 0x44, 0x4E, 0x42, 0x40,
+0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0xC5,
+0x47, 0x05, 0x0E, 0x36, 0x29, 0x08, 0x00, 0x69, 0x4A, 0xC4, 0x58, 0x02, 0x00, 0x05, 0x00, 0x01,
+0x45, 0x41, 0x48, 0x4A, 0x45, 0x4A, 0x45, 0x40, 0x04, 0xC6, 0x47, 0x2D, 0x25, 0x0A, 0x03, 0x00,
+0x01, 0x00, 0x44, 0x4A, 0x43, 0x42, 0x48, 0x40, 0x01, 0x41, 0x40, 0x0C, 0x4B, 0xC3, 0xB4, 0x07,
+0x0D, 0x07, 0x0B, 0xCE, 0x4B, 0x4D, 0xB9, 0xCB, 0xC6, 0x45, 0xBB, 0x46, 0x6E, 0x87, 0x4D, 0xC6,
+0xB4, 0x31, 0x00, 0x00, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x09, 0x52, 0xC4, 0x5B,
+0x87, 0xC1, 0x4E, 0xC1, 0x00, 0xC1, 0x6F, 0x61, 0x00, 0xCB, 0x6F, 0xC1, 0x5E, 0xAC, 0xC1, 0x5E,
+0x4E, 0x61, 0xAC, 0xD0, 0x21, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC1, 0x4F, 0x09, 0x06, 0x50, 0x00,
+0xCA, 0x66, 0x20, 0xCF, 0x66, 0x1A, 0x72, 0x41, 0x66, 0x09, 0x10, 0x09, 0x01, 0xC4, 0x62, 0x09,
+0x1B, 0x29, 0x05, 0x02, 0x4A, 0x4E, 0x44, 0x42, 0x4E, 0x43, 0x45, 0x41, 0x40, 0x1C, 0x41, 0x40,
+0x2A, 0x41, 0x45, 0x00, 0x42, 0x45, 0x00, 0x48, 0x4E, 0x48, 0x00, 0x43, 0xC2, 0x49, 0x8A, 0x09,
+0x00, 0x55, 0x49, 0x01, 0x50, 0x00, 0xC9, 0x72, 0xA5, 0x72, 0xCF, 0x66, 0x1B, 0x10, 0x78, 0x7B,
+0x09, 0x04, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xC2, 0xB6, 0x5E,
+0x61, 0x00, 0xD0, 0x6F, 0xC1, 0x4E, 0x24, 0x4E, 0xD5, 0xC1, 0x4E, 0x5E, 0x4E, 0x83, 0x4E, 0x14,
+0x24, 0xD0, 0xB6, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x06, 0x71, 0xC1, 0xB2, 0x07, 0x0E,
+0xCF, 0x4B, 0x07, 0x45, 0x87, 0x46, 0x79, 0x4B, 0x7F, 0xBB, 0x4B, 0xB1, 0x61, 0x4D, 0x81, 0x47,
+0x00, 0x0E, 0x45, 0x40, 0x42, 0x4E, 0x41, 0x40, 0x45, 0x41, 0x4A, 0x40, 0x44, 0x00, 0x40, 0x02,
+0x41, 0x4B, 0xC2, 0x92, 0x08, 0x02, 0x00, 0x4E, 0x61, 0x4A, 0x48, 0x43, 0x40, 0x45, 0x41, 0x40,
+0x00, 0x41, 0x00, 0x48, 0x42, 0x45, 0x48, 0x40, 0x06, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4A, 0x41, 0x00, 0x43, 0x48, 0x02, 0x42,
+0x40, 0x42, 0x40, 0x01, 0x45, 0x43, 0x45, 0x42, 0x48, 0x4E, 0x41, 0x40, 0x04, 0x41, 0x4B, 0x48,
+0x4A, 0xC1, 0x49, 0x00, 0x00, 0x44, 0x00, 0x41, 0x48, 0x4A, 0x43, 0x40, 0x01, 0x41, 0x40, 0x0B,
+0x4B, 0x40, 0xC3, 0xB4, 0x07, 0x0D, 0x07, 0x0B, 0xC4, 0x79, 0x38, 0x39, 0x79, 0x0D, 0x00, 0xC9,
+0x7F, 0x4D, 0x55, 0x81, 0xB9, 0x45, 0xB4, 0x00, 0x0B, 0x00, 0x00, 0x52, 0x40, 0x02, 0x41, 0x40,
+0x0E, 0x41, 0x40, 0x0A, 0x4B, 0xC7, 0x67, 0xA0, 0xC1, 0x6F, 0x61, 0xC1, 0x61, 0x4E, 0x00, 0xC0,
+0xC1, 0x00, 0xC9, 0x5E, 0xAC, 0xC1, 0x4E, 0x61, 0x76, 0x4E, 0x24, 0x3A, 0x00, 0x0D, 0x41, 0x40,
+0x0F, 0xC4, 0x4F, 0x7B, 0x09, 0x10, 0x09, 0x03, 0x60, 0x00, 0x5A, 0xC0, 0x66, 0x00, 0x5A, 0xC0,
+0x66, 0x00, 0x73, 0xC2, 0x78, 0x1B, 0x09, 0x00, 0x55, 0x49, 0x01, 0x50, 0x61, 0x45, 0x01, 0x42,
+0x44, 0x45, 0x4E, 0x02, 0x45, 0x40, 0x1D, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0x43, 0x4E,
+0x63, 0x44, 0x4A, 0x4E, 0x66, 0x5B, 0x49, 0xC2, 0x62, 0x15, 0x09, 0x02, 0x5B, 0xC9, 0xAB, 0x33,
+0x66, 0x1A, 0x66, 0x72, 0x66, 0x20, 0x10, 0x09, 0x04, 0x50, 0xC2, 0x47, 0x12, 0x00, 0x0E, 0x41,
+0x40, 0x0D, 0xC1, 0xB6, 0x4E, 0x00, 0xCD, 0xCD, 0xC1, 0x61, 0x76, 0x5E, 0x4E, 0xD5, 0x6F, 0xCD,
+0x24, 0x87, 0x4E, 0xAC, 0x24, 0x01, 0xC1, 0xB6, 0x00, 0x01, 0x4B, 0x40, 0x06, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0xC2, 0xB2, 0x2E, 0x07, 0x0D, 0x4D, 0x47, 0x4D, 0x79, 0xCA, 0x46, 0x0D, 0x07,
+0xCB, 0x39, 0x38, 0x55, 0x7F, 0x39, 0x81, 0x00, 0x0F, 0x41, 0x42, 0x4A, 0x4E, 0x42, 0x40, 0x41,
+0x48, 0x45, 0x40, 0x4A, 0x41, 0x40, 0x02, 0x41, 0x4B, 0x4A, 0x61, 0x52, 0x42, 0x48, 0x03, 0x40,
+0x45, 0x00, 0x40, 0x01, 0x43, 0x42, 0x40, 0x43, 0x42, 0x40, 0x06, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x45, 0x4E, 0x43, 0x44, 0xC8, 0x96,
+0x89, 0x08, 0x04, 0x05, 0x0A, 0x08, 0x03, 0x00, 0x01, 0x4A, 0x00, 0x44, 0x42, 0x48, 0x44, 0x40,
+0x05, 0x6D, 0x41, 0x45, 0x43, 0x00, 0x45, 0x42, 0x4E, 0x43, 0x42, 0x43, 0x48, 0x45, 0x40, 0x01,
+0x41, 0x40, 0x0B, 0x52, 0x4B, 0xC3, 0xB4, 0x07, 0x0D, 0x07, 0x0C, 0xCC, 0x4B, 0x4D, 0x4B, 0x45,
+0x2E, 0x46, 0x45, 0x55, 0xB9, 0x39, 0x4B, 0xB4, 0x00, 0x01, 0x4B, 0x40, 0x03, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x09, 0x52, 0xD4, 0x5B, 0xA0, 0xCD, 0x61, 0x6F, 0xCD, 0x6F, 0x87, 0x6F, 0x61, 0x5E,
+0x87, 0x88, 0x4E, 0x61, 0xD5, 0x87, 0x24, 0x4E, 0x3A, 0x00, 0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F,
+0x62, 0x09, 0x05, 0x50, 0x5A, 0x00, 0x73, 0x50, 0x5B, 0x73, 0x00, 0xC2, 0x72, 0x20, 0x09, 0x00,
+0x50, 0x49, 0x02, 0x5B, 0x69, 0x45, 0x61, 0x45, 0x00, 0x48, 0x4A, 0x43, 0x42, 0x48, 0x00, 0x45,
+0x41, 0x40, 0x1C, 0x41, 0x40, 0x2A, 0x41, 0x42, 0x45, 0x01, 0x42, 0x44, 0x4E, 0x44, 0x4A, 0xC5,
+0x5A, 0x28, 0x1B, 0x09, 0x15, 0x09, 0x03, 0xC1, 0x41, 0x20, 0x01, 0x5B, 0x60, 0x5A, 0xC3, 0x72,
+0x1A, 0x7B, 0x09, 0x04, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0x40, 0x09, 0x4B, 0x40, 0x01, 0xD0,
+0xB6, 0xD0, 0x87, 0xCD, 0xA0, 0x5E, 0xC1, 0x87, 0x4E, 0x6F, 0x4E, 0x87, 0x6F, 0xC1, 0x61, 0x5E,
+0x24, 0x01, 0xC1, 0xB6, 0x00, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x11,
+0xC7, 0x7F, 0x55, 0x45, 0x4B, 0x81, 0x39, 0x4B, 0x39, 0x00, 0xC2, 0x46, 0x81, 0x00, 0x0F, 0x41,
+0x00, 0x45, 0x4A, 0x42, 0x45, 0x48, 0x4A, 0x44, 0x45, 0x44, 0x40, 0x03, 0x41, 0xC1, 0x47, 0x08,
+0x00, 0x43, 0x44, 0x00, 0x70, 0x5C, 0x42, 0xC1, 0x44, 0x08, 0x00, 0x41, 0x40, 0x00, 0x42, 0x4E,
+0x43, 0x45, 0x44, 0x45, 0x40, 0x06, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40,
+0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0xC1, 0x47, 0x01, 0x00, 0x40, 0x41, 0x40, 0x01, 0x41, 0x01,
+0x42, 0x43, 0x00, 0x45, 0x41, 0x00, 0x40, 0x41, 0x4B, 0x40, 0x05, 0x41, 0xC1, 0x47, 0x00, 0x01,
+0x41, 0x40, 0x41, 0x00, 0x40, 0x41, 0x40, 0x03, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0xC3, 0xB4, 0x07,
+0x0D, 0x07, 0x0C, 0x4D, 0x78, 0x4D, 0xC2, 0x4B, 0x07, 0x0D, 0x00, 0xC1, 0xBA, 0x38, 0x00, 0xC2,
+0x79, 0xB4, 0x00, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0A, 0x4B, 0xC6, 0x5B, 0x24, 0xAC, 0x5E,
+0xD0, 0xAC, 0x24, 0x00, 0xC1, 0x5E, 0xAC, 0x03, 0xC3, 0x5E, 0xAC, 0x14, 0x24, 0x00, 0x7A, 0x40,
+0x0D, 0x41, 0x40, 0x0F, 0xC2, 0x4F, 0x62, 0x09, 0x07, 0x5B, 0x49, 0x02, 0x5B, 0x55, 0x49, 0x02,
+0x55, 0x49, 0x00, 0xC3, 0x62, 0x10, 0x21, 0x05, 0x03, 0x42, 0x45, 0x03, 0x41, 0x40, 0x1C, 0x41,
+0x40, 0x2A, 0x41, 0x45, 0x01, 0x42, 0x45, 0x02, 0x42, 0x45, 0x00, 0x5B, 0x50, 0x55, 0x49, 0x04,
+0x55, 0x49, 0x5B, 0xC2, 0x62, 0x09, 0x1B, 0x00, 0x49, 0x01, 0x55, 0x49, 0x02, 0x50, 0xC3, 0x47,
+0x00, 0x12, 0x00, 0x0D, 0x41, 0x40, 0x0D, 0xC4, 0xB6, 0x24, 0xAC, 0x4E, 0xAC, 0x01, 0xC3, 0x4E,
+0xAC, 0xD0, 0xAC, 0x00, 0xC1, 0x5E, 0x4E, 0x00, 0xC1, 0xAC, 0x24, 0x00, 0xC2, 0x5E, 0xE7, 0x00,
+0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0xC1, 0xB2, 0x07, 0x12, 0x6E, 0x00, 0x47, 0xC8, 0xBA,
+0x79, 0x07, 0x0D, 0x38, 0x07, 0x81, 0x0B, 0x00, 0x0E, 0x41, 0x40, 0x03, 0x41, 0x01, 0x40, 0x05,
+0x41, 0x4B, 0x00, 0x41, 0x4F, 0x40, 0x4B, 0xC4, 0x47, 0x0B, 0x12, 0x47, 0x01, 0x00, 0x42, 0x43,
+0x00, 0x42, 0x40, 0x41, 0x00, 0x40, 0x08, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42,
+0x41, 0x08, 0x45, 0x41, 0x0D, 0x45, 0x41, 0x00, 0x4F, 0x5F, 0x41, 0x4F, 0x41, 0x5F, 0x4F, 0x41,
+0x00, 0x45, 0x42, 0x01, 0x45, 0x41, 0x4F, 0x5F, 0x41, 0x08, 0x45, 0x65, 0x45, 0x41, 0x00, 0x45,
+0x41, 0x03, 0x45, 0x41, 0x01, 0x45, 0x41, 0x0B, 0x65, 0x41, 0xC1, 0xF5, 0x38, 0x01, 0xCC, 0x4B,
+0xC6, 0x38, 0x4B, 0x38, 0xC6, 0x38, 0x4B, 0xC6, 0x38, 0x4B, 0x38, 0xC6, 0x00, 0xC1, 0xB1, 0x38,
+0x00, 0xC4, 0x4B, 0x45, 0x38, 0x45, 0x38, 0x00, 0xC4, 0x45, 0xF5, 0x01, 0x25, 0x01, 0x00, 0x4F,
+0x41, 0x02, 0x45, 0x41, 0x0F, 0x45, 0x41, 0x09, 0x65, 0xC1, 0x59, 0x5E, 0x03, 0xC1, 0xC7, 0x5E,
+0x00, 0xC2, 0x83, 0x5E, 0x83, 0x00, 0xC0, 0x5E, 0x00, 0xC1, 0x83, 0x5E, 0x01, 0x61, 0x41, 0x0E,
+0x40, 0x0F, 0xDC, 0x4F, 0x10, 0x15, 0x1B, 0x10, 0x15, 0x41, 0x10, 0x15, 0x41, 0x15, 0x10, 0x1B,
+0x15, 0x10, 0x15, 0x1B, 0x15, 0x1B, 0x10, 0x1B, 0x10, 0x1B, 0x10, 0x41, 0x10, 0x1B, 0x29, 0x05,
+0x01, 0x42, 0x45, 0x06, 0x41, 0x1C, 0x45, 0x41, 0x2A, 0x45, 0x42, 0x07, 0x7F, 0x42, 0x56, 0xCB,
+0x82, 0x7B, 0x10, 0x7B, 0x10, 0xA5, 0x10, 0x7B, 0xA5, 0x7B, 0xA5, 0x7B, 0x00, 0x60, 0x50, 0xC4,
+0x7B, 0x10, 0x7B, 0xA5, 0x10, 0x00, 0xC4, 0xA5, 0x7B, 0xA5, 0x4F, 0x01, 0x0F, 0x45, 0x41, 0x0C,
+0x4F, 0xC5, 0x9D, 0x83, 0x5E, 0x83, 0x52, 0x5E, 0x07, 0xC1, 0x52, 0x5E, 0x02, 0xC1, 0x9D, 0x01,
+0x01, 0x65, 0x41, 0x06, 0x45, 0x41, 0x0F, 0x45, 0x41, 0x04, 0x65, 0x41, 0x4F, 0xD7, 0x7D, 0x38,
+0x4B, 0xC6, 0x38, 0x4B, 0x38, 0xC6, 0x38, 0x4B, 0xC6, 0x38, 0x4B, 0x38, 0xC6, 0x38, 0x4B, 0x38,
+0xC6, 0x38, 0x4B, 0xC6, 0xB1, 0x38, 0x01, 0xC1, 0xC6, 0xB1, 0x00, 0xC3, 0x45, 0xB1, 0x25, 0x01,
+0x0E, 0x45, 0x41, 0x00, 0x45, 0x41, 0x02, 0x45, 0x41, 0x45, 0x41, 0x03, 0x5F, 0x45, 0x41, 0x00,
+0x4F, 0x5F, 0x65, 0x4F, 0x65, 0x5F, 0x4F, 0x41, 0x00, 0x42, 0x01, 0x45, 0x41, 0x01, 0x45, 0x41,
+0x07, 0x45, 0x41, 0x07, 0x45, 0x41, 0x09, 0x45, 0x41, 0x40, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x66, 0xC3, 0x6D, 0x03, 0x08, 0x03,
+0x09, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x00, 0x43, 0x01, 0x48, 0x43, 0x01,
+0x48, 0x43, 0x48, 0x43, 0x01, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x48, 0xC5, 0x50, 0x53, 0x59, 0x53, 0x52, 0x50, 0x00, 0xC3, 0x59, 0x50,
+0x59, 0x50, 0x00, 0xC1, 0x59, 0x50, 0x00, 0xC1, 0x59, 0x50, 0x02, 0xCA, 0x59, 0x50, 0x59, 0x50,
+0x59, 0x50, 0x59, 0x50, 0x59, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x00,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x00, 0xC2,
+0x86, 0x58, 0x86, 0x00, 0xC0, 0x53, 0x00, 0xCC, 0x58, 0x53, 0x59, 0x58, 0x59, 0x53, 0x08, 0x53,
+0x08, 0x53, 0x86, 0x53, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x01, 0x4C, 0xC0, 0x68, 0x0D, 0x75, 0xC2, 0xB5, 0x68, 0xB5, 0x01, 0xCD, 0x68, 0xB5, 0x68,
+0xEB, 0xB5, 0x68, 0xEB, 0xB5, 0x68, 0xB5, 0x68, 0xB5, 0xEB, 0xB5, 0x00, 0xC5, 0x68, 0xEB, 0xB5,
+0x68, 0xB5, 0x68, 0x00, 0xC1, 0xB5, 0x68, 0x0A, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x00, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x4A, 0x00, 0x48, 0x4A, 0xC1, 0x53, 0x0A, 0x00, 0x48, 0x4A, 0xC0, 0x58,
+0x00, 0x5A, 0xC1, 0x72, 0x1A, 0x00, 0xC2, 0x92, 0x72, 0x1A, 0x0C, 0xC3, 0x72, 0x1A, 0x72, 0x1A,
+0x00, 0xC5, 0x6D, 0x74, 0x26, 0x03, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0xC1, 0x59, 0x08, 0x00, 0x70, 0xC6, 0x74, 0x30, 0x58, 0x59, 0x08, 0x30, 0x08,
+0x00, 0x70, 0xC8, 0x59, 0x30, 0x08, 0x26, 0x58, 0x53, 0x58, 0x53, 0x86, 0x00, 0x48, 0xC4, 0x86,
+0x58, 0x53, 0x58, 0x86, 0x03, 0x48, 0xC0, 0x86, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x66, 0x48,
+0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x00, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x00, 0xC3, 0x50, 0x53, 0x59, 0x50, 0x00, 0xC3, 0x59, 0x50, 0x59, 0x50, 0x00, 0xC1, 0x59, 0x50,
+0x00, 0xC1, 0x59, 0x50, 0x00, 0xC3, 0x59, 0x50, 0x59, 0x50, 0x00, 0xC1, 0x59, 0x50, 0x00, 0xCB,
+0x59, 0x53, 0x50, 0x53, 0x52, 0x53, 0x50, 0x59, 0x50, 0x26, 0x08, 0x03, 0x00, 0x48, 0x43, 0x00,
+0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43,
+0x04, 0x48, 0x43, 0x00, 0x66, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x66, 0x48, 0x43, 0x48, 0x43,
+0x00, 0x48, 0x43, 0x03, 0x48, 0x43, 0x02, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48, 0x00, 0x43,
+0x00, 0x48, 0x43, 0x00, 0x48, 0x43, 0x01, 0x48, 0x43, 0x48, 0x43, 0x00, 0x48, 0x43, 0x00, 0x48,
+0x43, 0x00, 0x48, 0x43, 0x44, 0x41, 0x42, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x52,
+0x40, 0x0D, 0x41, 0x40, 0x0D, 0x41, 0x4B, 0x40, 0x18, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41,
+0x40, 0x0B, 0x41, 0x40, 0x10, 0x52, 0x40, 0x0D, 0x63, 0x46, 0x36, 0x42, 0x40, 0x1C, 0x41, 0x40,
+0x2A, 0x41, 0x45, 0x01, 0x5F, 0x45, 0x5F, 0x45, 0x03, 0x5B, 0x55, 0x50, 0xCA, 0x41, 0x1B, 0x09,
+0x1B, 0x09, 0x10, 0x41, 0x09, 0x15, 0x10, 0x15, 0x02, 0x49, 0x50, 0x49, 0x55, 0x01, 0x49, 0x5B,
+0xC1, 0x47, 0x00, 0x0E, 0x52, 0x41, 0xC4, 0xFB, 0xD9, 0x27, 0xD9, 0x1E, 0x00, 0x67, 0x4F, 0xC2,
+0xD9, 0x27, 0x0F, 0x00, 0x5E, 0x4F, 0x00, 0x67, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F,
+0x41, 0x40, 0x07, 0x65, 0xC1, 0xC0, 0x00, 0x1A, 0x41, 0x71, 0x40, 0x0E, 0x41, 0x40, 0x0D, 0x4B,
+0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x42, 0x40, 0x07, 0x41, 0x00,
+0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0B, 0x41, 0x00, 0x40, 0x0A, 0x4B, 0x00, 0x40,
+0x41, 0x71, 0x40, 0x01, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00,
+0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x01, 0x4B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E,
+0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x67, 0x41, 0x40, 0x0D, 0x4C, 0x46, 0x36, 0x42, 0x40, 0x1C,
+0x41, 0x40, 0x05, 0x41, 0x40, 0x22, 0x41, 0x42, 0x45, 0x08, 0x5B, 0x55, 0x49, 0x00, 0x50, 0x49,
+0xC1, 0x62, 0x09, 0x00, 0x55, 0x49, 0x0C, 0x50, 0xC3, 0xDA, 0x00, 0x12, 0x00, 0x0B, 0x52, 0x00,
+0x4F, 0x5E, 0x4F, 0xC4, 0xA2, 0x0F, 0x1E, 0x0F, 0x1E, 0x01, 0x4F, 0x00, 0x5E, 0x4F, 0x5E, 0x4F,
+0x5E, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x07, 0x41, 0x40, 0x01,
+0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B,
+0x40, 0x00, 0x4B, 0x40, 0x00, 0x4B, 0x40, 0x02, 0x41, 0x4B, 0x40, 0x0E, 0x41, 0x40, 0x0D, 0x41,
+0x67, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00, 0x40, 0x45, 0x40, 0x08, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0B, 0x4B, 0x40, 0x41, 0x6D, 0x4B,
+0x40, 0x17, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0xC2, 0x47,
+0x01, 0x00, 0x0D, 0x63, 0x46, 0x10, 0xC1, 0x73, 0x06, 0x14, 0xC1, 0x73, 0x06, 0x00, 0xCD, 0x4A,
+0x02, 0x23, 0x06, 0x73, 0x30, 0x03, 0x23, 0x0E, 0x73, 0x08, 0x73, 0x02, 0x00, 0x1C, 0x41, 0x40,
+0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x01, 0x41, 0x40, 0x00, 0x41, 0x01, 0x40, 0x1A, 0x41,
+0x68, 0x45, 0x61, 0x45, 0x42, 0x45, 0x42, 0x69, 0x42, 0x00, 0x62, 0x5B, 0x49, 0x04, 0x50, 0x00,
+0x60, 0x50, 0x73, 0x5A, 0x00, 0x50, 0x5A, 0x73, 0x50, 0x49, 0x00, 0x50, 0x49, 0x01, 0x50, 0xC1,
+0x47, 0x00, 0x0F, 0xCD, 0xA2, 0x4F, 0x8E, 0xAA, 0x1F, 0x05, 0xAE, 0x05, 0x1F, 0x29, 0xA2, 0x1E,
+0x0F, 0x1E, 0x01, 0x4F, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x1B, 0x41, 0x4B, 0x40, 0x0E, 0x41, 0x00, 0x40, 0x41, 0x01, 0x40, 0x42, 0x41, 0x40, 0x00,
+0x41, 0x40, 0x02, 0x41, 0x4B, 0x45, 0x42, 0x45, 0x41, 0x45, 0x40, 0x41, 0x40, 0x41, 0x42, 0x41,
+0x40, 0x00, 0x41, 0x40, 0x45, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40,
+0x0C, 0x41, 0x40, 0x0D, 0x41, 0x4B, 0x01, 0x40, 0x4B, 0x52, 0x4B, 0x40, 0x4B, 0x52, 0x4B, 0x40,
+0x4B, 0x52, 0x4B, 0x40, 0x4B, 0x52, 0x4B, 0x40, 0x4B, 0x52, 0x4B, 0x40, 0x4B, 0x40, 0x6D, 0x41,
+0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x00, 0x4B, 0x40, 0x4B, 0x40, 0x4B,
+0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x00, 0x6D, 0x41, 0x40, 0x0D, 0x4C, 0x46,
+0x29, 0xCE, 0x73, 0x68, 0x98, 0x0A, 0x06, 0x73, 0x0C, 0x44, 0x0C, 0x44, 0x23, 0x08, 0x06, 0x02,
+0x00, 0x1C, 0x41, 0x40, 0x44, 0x42, 0x01, 0x45, 0x42, 0x00, 0x44, 0x41, 0x40, 0x41, 0x4A, 0x43,
+0x45, 0x44, 0x40, 0x1A, 0x41, 0x42, 0x45, 0x02, 0x42, 0xC7, 0x4A, 0x04, 0x0E, 0x0A, 0x3F, 0x1B,
+0x15, 0x09, 0x03, 0x5B, 0x73, 0xC5, 0xE0, 0x20, 0x66, 0x1A, 0x78, 0x1A, 0x00, 0xC4, 0x72, 0x99,
+0x41, 0x10, 0x09, 0x00, 0x50, 0x49, 0x50, 0xC1, 0x47, 0x00, 0x0F, 0x41, 0xC0, 0xAD, 0x00, 0x56,
+0x5B, 0xC6, 0x96, 0x29, 0x16, 0xAD, 0x20, 0x96, 0x1E, 0x03, 0x67, 0x40, 0x4B, 0x40, 0x4B, 0x40,
+0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x40, 0x4B, 0x41, 0x40, 0x0A,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x05, 0x4B, 0x40, 0x41, 0x40, 0x4B, 0x40, 0x4B, 0x52, 0x4B, 0x40,
+0x4B, 0x52, 0x4B, 0x40, 0x4B, 0x52, 0x4B, 0x40, 0x4B, 0x52, 0x4B, 0x40, 0x4B, 0x52, 0x4B, 0x40,
+0x4B, 0x52, 0x40, 0x02, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x41, 0x4E, 0x45, 0x40, 0x43, 0x48, 0x00,
+0x40, 0x44, 0x4A, 0x40, 0x02, 0x41, 0x40, 0x4A, 0x43, 0x42, 0x44, 0x4E, 0x40, 0x4A, 0x43, 0x01,
+0x4A, 0x45, 0x40, 0x00, 0x42, 0x48, 0x00, 0x42, 0x41, 0x4E, 0x41, 0x40, 0x05, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40,
+0x0C, 0x41, 0x40, 0x0D, 0x41, 0x71, 0x40, 0x00, 0x52, 0x40, 0x01, 0x52, 0x40, 0x01, 0x52, 0x40,
+0x01, 0x52, 0x40, 0x01, 0x52, 0x40, 0x01, 0x52, 0x40, 0x00, 0x52, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x71, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x25, 0xD2, 0x73,
+0x06, 0x73, 0x06, 0x73, 0x23, 0x8D, 0x08, 0x06, 0x68, 0x8D, 0x86, 0x0C, 0x0A, 0x05, 0x35, 0x06,
+0x02, 0x00, 0x1C, 0x41, 0x45, 0x43, 0x42, 0x4A, 0x43, 0x48, 0x43, 0x4A, 0x48, 0x43, 0x40, 0x41,
+0x43, 0x44, 0x40, 0x48, 0x45, 0x40, 0x19, 0x41, 0x42, 0x45, 0x00, 0x61, 0xC8, 0xAA, 0x08, 0x0E,
+0x04, 0x0E, 0x0A, 0x3F, 0x16, 0x09, 0x01, 0x55, 0xC1, 0x62, 0x09, 0x00, 0x50, 0x5A, 0xC3, 0xA5,
+0x78, 0x92, 0x66, 0x00, 0xC1, 0x6D, 0x33, 0x00, 0x55, 0x49, 0x03, 0x50, 0xC1, 0x47, 0x00, 0x0E,
+0x52, 0xC2, 0xD3, 0x51, 0x1B, 0x00, 0x50, 0xC6, 0x4F, 0x1A, 0x4F, 0xAD, 0x20, 0x8C, 0x1E, 0x01,
+0xC1, 0xA2, 0x1E, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x05, 0x4B,
+0x00, 0x41, 0x40, 0x00, 0x52, 0x40, 0x01, 0x52, 0x40, 0x01, 0x52, 0x40, 0x01, 0x52, 0x40, 0x01,
+0x52, 0x40, 0x01, 0x52, 0x40, 0x00, 0x4B, 0x00, 0x40, 0x00, 0x41, 0x4B, 0x40, 0x0E, 0x41, 0x00,
+0x42, 0x4E, 0x41, 0x40, 0x41, 0x00, 0x4A, 0x45, 0x43, 0x48, 0x40, 0x02, 0x41, 0x40, 0x4A, 0x48,
+0x42, 0x00, 0x4E, 0x42, 0x4A, 0x48, 0x43, 0x40, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x43, 0x42,
+0x00, 0x4A, 0x41, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08,
+0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19,
+0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x6D, 0x41, 0x40, 0x0D,
+0x4C, 0x46, 0x2A, 0x4E, 0x42, 0x4E, 0x63, 0x4C, 0x76, 0x44, 0xC6, 0x68, 0x0C, 0x04, 0x73, 0x06,
+0x02, 0x00, 0x1C, 0x41, 0x45, 0x43, 0x42, 0x43, 0x42, 0x4A, 0x48, 0x00, 0x42, 0x43, 0x40, 0x00,
+0x42, 0x44, 0x40, 0x43, 0x42, 0x40, 0x19, 0x41, 0x42, 0x45, 0x01, 0x43, 0x4E, 0x63, 0xDF, 0x53,
+0x08, 0x30, 0x26, 0x8C, 0x09, 0x97, 0x09, 0x10, 0x09, 0x10, 0x09, 0x15, 0xAB, 0x20, 0x66, 0x20,
+0x1A, 0x66, 0x1A, 0x78, 0x20, 0x15, 0x10, 0x09, 0x15, 0x10, 0x09, 0x10, 0x47, 0x12, 0x00, 0x0E,
+0xCF, 0xDA, 0x16, 0x20, 0x72, 0x8A, 0x16, 0x20, 0x8C, 0xA5, 0xE5, 0x20, 0x1E, 0x0F, 0x40, 0x0F,
+0x1E, 0x00, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B,
+0x41, 0x40, 0x0F, 0x41, 0x45, 0x4A, 0x4E, 0x42, 0x40, 0x45, 0x43, 0x41, 0x43, 0x4E, 0x00, 0x4B,
+0x40, 0x01, 0x41, 0x40, 0x4A, 0x45, 0x41, 0x42, 0x48, 0x00, 0x43, 0x48, 0x00, 0x40, 0x42, 0x45,
+0x40, 0x00, 0x41, 0x43, 0x42, 0x00, 0x4A, 0x4E, 0x42, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41, 0x40,
+0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x10, 0x41, 0x40, 0x0D, 0x63, 0x46, 0x29, 0xC2, 0x73, 0x06, 0x73, 0x00, 0xC2, 0xCA, 0x06, 0x73,
+0x00, 0x46, 0x00, 0xC1, 0x73, 0x06, 0x00, 0x42, 0x40, 0x1C, 0x41, 0x45, 0x43, 0x42, 0x4E, 0x48,
+0x42, 0xC4, 0x44, 0x04, 0x02, 0x04, 0x00, 0x00, 0x42, 0x00, 0x40, 0x48, 0x41, 0x40, 0x19, 0x41,
+0x61, 0x68, 0x45, 0x00, 0x42, 0x00, 0x4A, 0x44, 0x4A, 0x00, 0x68, 0x5B, 0x49, 0xC1, 0x97, 0x09,
+0x04, 0xC8, 0x82, 0x10, 0x33, 0x1A, 0x33, 0x15, 0x1A, 0x33, 0x09, 0x05, 0x50, 0xC1, 0x47, 0x00,
+0x0E, 0x52, 0xD1, 0xDA, 0x16, 0x4F, 0x1B, 0xAD, 0x51, 0xE5, 0x10, 0x96, 0x20, 0x8C, 0x40, 0xA2,
+0x0F, 0x1E, 0x0F, 0x1E, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x45, 0x48, 0x42, 0x45, 0x48, 0x4A, 0x44, 0x41, 0x42,
+0x48, 0x40, 0x02, 0x41, 0x40, 0x48, 0x00, 0x43, 0x44, 0x42, 0x48, 0x42, 0x00, 0x44, 0x4A, 0x43,
+0x41, 0x40, 0x00, 0x42, 0x4E, 0x43, 0x45, 0x00, 0x48, 0x45, 0x40, 0x05, 0x41, 0x40, 0x07, 0x41,
+0x40, 0x0A, 0x41, 0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40,
+0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B,
+0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x0D, 0x4C, 0x46, 0x2E, 0xC1, 0x73, 0x06, 0x05, 0x42, 0x40,
+0x1C, 0x41, 0x40, 0x42, 0x43, 0x44, 0x40, 0x01, 0x67, 0x4B, 0x40, 0x03, 0x45, 0x44, 0x40, 0x1A,
+0x41, 0x45, 0x05, 0x5F, 0x45, 0x00, 0x5F, 0x5B, 0x49, 0x08, 0x55, 0x5B, 0x00, 0x49, 0x5B, 0x55,
+0x49, 0x05, 0x5B, 0xC1, 0x47, 0x00, 0x0F, 0x4F, 0x41, 0x67, 0x5E, 0x41, 0x4F, 0x00, 0xCA, 0xD9,
+0x01, 0x1F, 0x0F, 0x01, 0x0F, 0x1E, 0x0F, 0x1E, 0x01, 0x00, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x05, 0x41, 0x40, 0x05,
+0x41, 0x40, 0x0A, 0x42, 0x43, 0x00, 0x42, 0x40, 0x0B, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x42, 0x41, 0x45, 0xE0, 0x7B, 0x41, 0x4C, 0x46, 0x36, 0x44, 0x41, 0x45, 0xE0, 0x08, 0x42,
+0x00, 0x44, 0x02, 0x5C, 0x44, 0x03, 0xC1, 0xAD, 0x20, 0x16, 0xC2, 0xAA, 0x1F, 0x05, 0x0E, 0xC2,
+0xBD, 0x28, 0x90, 0x00, 0x68, 0x7F, 0xC0, 0x90, 0x00, 0x68, 0x00, 0xC6, 0x90, 0x28, 0x02, 0x28,
+0x02, 0x28, 0x05, 0xE0, 0x47, 0x42, 0x01, 0x45, 0x24, 0x40, 0x43, 0x03, 0x44, 0x43, 0x06, 0x44,
+0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x05, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00,
+0x44, 0x43, 0x44, 0x43, 0x03, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x03, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x05, 0x44, 0x43, 0x00,
+0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44,
+0x43, 0x00, 0x44, 0x43, 0x04, 0x44, 0x43, 0x00, 0x44, 0x43, 0x03, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x02, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00,
+0x44, 0x43, 0x05, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44,
+0x43, 0x44, 0x43, 0x02, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01,
+0x48, 0xC2, 0x53, 0x0A, 0x08, 0x0D, 0x4A, 0x48, 0x4A, 0x48, 0x15, 0x4A, 0x48, 0x09, 0x4A, 0x43,
+0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00,
+0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x07, 0xC1, 0x44, 0x03, 0x00,
+0xC3, 0x51, 0x63, 0x51, 0x03, 0x03, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44,
+0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x02, 0x48, 0x43, 0x08, 0xC5, 0x6D, 0x51, 0x03, 0x51, 0x6D, 0x51, 0x00, 0x43, 0xC0, 0x51, 0x00,
+0x43, 0xC3, 0x6D, 0x51, 0x6D, 0x51, 0x00, 0xC1, 0x6D, 0x51, 0x00, 0x43, 0xC0, 0x51, 0x00, 0x43,
+0xC4, 0x6D, 0x74, 0x03, 0x26, 0x03, 0x00, 0xC1, 0x44, 0x03, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x00, 0x44, 0x43, 0x02, 0x66, 0x43, 0x00, 0x66, 0x43, 0x00, 0xC1, 0x60, 0x03, 0x07, 0x66, 0x43,
+0xCF, 0x51, 0x36, 0x51, 0x03, 0x36, 0x51, 0x03, 0x36, 0x51, 0x03, 0x36, 0x51, 0x03, 0x36, 0x51,
+0x03, 0x04, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x03, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x03, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00,
+0x44, 0x48, 0x43, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44,
+0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x04, 0x44, 0x43,
+0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x03, 0x44, 0x43, 0x02,
+0x44, 0x43, 0x01, 0x44, 0x43, 0x44, 0x43, 0x05, 0x44, 0x43, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43,
+0x02, 0x44, 0x43, 0x01, 0x44, 0x43, 0x00, 0x44, 0x43, 0x05, 0x44, 0x43, 0x00, 0x44, 0x43, 0x04,
+0x44, 0x43, 0x00, 0x44, 0x43, 0x00, 0x44, 0x43, 0x01, 0x42, 0x41, 0x42, 0x40, 0x08, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07,
+0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41,
+0x40, 0x23, 0x41, 0x40, 0x1D, 0x41, 0x40, 0x05, 0x4B, 0x40, 0x4B, 0x40, 0x20, 0x41, 0x40, 0x09,
+0xC1, 0x47, 0x00, 0x15, 0x41, 0x52, 0x40, 0x0F, 0x41, 0x40, 0x03, 0x52, 0x40, 0x52, 0x40, 0x05,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x09, 0x41, 0x00,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40,
+0x0D, 0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F,
+0x41, 0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x41, 0x00, 0x40, 0x08, 0x41, 0x40,
+0x1D, 0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41,
+0x40, 0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1B, 0x41, 0x40, 0x0C, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x10, 0x41,
+0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x00, 0x40, 0x17, 0x41, 0x40, 0x08, 0x41, 0x00, 0x40, 0x1C,
+0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x00, 0x40, 0x0F, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41,
+0x40, 0x0F, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0A, 0x41, 0x40,
+0x45, 0x40, 0x08, 0x41, 0x40, 0x0D, 0x41, 0x40, 0x1A, 0x41, 0x00, 0x40, 0x0C, 0x41, 0x40, 0x0D,
+0x41, 0x40, 0x19, 0x41, 0x40, 0x07, 0x41, 0x40, 0x0E, 0x41, 0x40, 0x0B, 0x41, 0x40, 0x0F, 0x41,
+0x00, 0x40, 0x0D, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x17, 0x41, 0x00, 0x40, 0x08, 0x41, 0x40, 0x1D,
+0x41, 0x40, 0x2A, 0x41, 0x40, 0x09, 0x41, 0x40, 0x15, 0x41, 0x40, 0x10, 0x41, 0x40, 0x0D, 0x41,
+0x40, 0x10, 0x41, 0x40, 0x0A, 0x41, 0x40, 0x0F, 0x41, 0x40, 0x07, 0x41, 0x40, 0x1B, 0x41, 0x40,
+0x0F, 0x41, 0x40, 0x0D, 0x41, 0x00, 0x40, 0x1A, 0x41, 0x40, 0x07, 0x41, 0x40, 0x04, 0x46, 0x06,
+};
@@ -0,0 +1,5091 @@
+// Packed by packimage from teensy40_front.h
+// 240x320 RGB565, 153600 bytes raw, 81353 bytes packed
+// tft.drawPackedImage(x, y, teensy40_front_packed, sizeof(teensy40_front_packed));
+
+const uint8_t teensy40_front_packed[81353] PROGMEM = {
+0x52, 0x50, 0x00, 0x00, 0xF0, 0x00, 0x40, 0x01, 0xC0, 0x00, 0xF8, 0x21, 0x9A, 0xAE, 0x01, 0x5A,
+0x5D, 0x03, 0x5A, 0x00, 0x5F, 0x5D, 0x1F, 0xAB, 0x00, 0x5D, 0x04, 0xC4, 0x40, 0xF8, 0x20, 0xD8,
+0x82, 0xE0, 0x01, 0xE0, 0x22, 0xF0, 0xAD, 0x81, 0xC0, 0x62, 0xF0, 0x54, 0xAE, 0xC0, 0x62, 0xE8,
+0xA9, 0xA6, 0x96, 0x68, 0x60, 0x00, 0x68, 0x03, 0x9A, 0x00, 0x9B, 0xAE, 0xBA, 0x03, 0x69, 0x00,
+0x6E, 0x00, 0x71, 0x01, 0x76, 0x71, 0x01, 0xA9, 0x96, 0xA6, 0x62, 0x6A, 0x00, 0x62, 0x00, 0x71,
+0x00, 0x62, 0x65, 0x76, 0xA9, 0x96, 0xC0, 0xA1, 0xD0, 0xBF, 0x71, 0x9A, 0xAE, 0x96, 0xC1, 0xA4,
+0xE0, 0x42, 0xD0, 0x6E, 0x9D, 0xC3, 0xC1, 0xC8, 0x00, 0xB8, 0x80, 0xF8, 0x00, 0xF8, 0x23, 0x5F,
+0x02, 0x5D, 0xE0, 0x0A, 0x5F, 0x01, 0x5A, 0x5D, 0x03, 0x5A, 0x5D, 0x27, 0xAE, 0x5F, 0xC2, 0x65,
+0xF9, 0xC6, 0xE9, 0x48, 0xEA, 0xB2, 0xC1, 0xA7, 0xE9, 0xE7, 0xF1, 0x9A, 0x00, 0xC1, 0x28, 0xF2,
+0xA6, 0xE1, 0x91, 0xC0, 0xC6, 0xE1, 0x7F, 0x00, 0x53, 0x7F, 0x03, 0x44, 0x53, 0xAE, 0xC0, 0x0B,
+0xFB, 0x00, 0xA6, 0x00, 0xA6, 0x5D, 0x01, 0xA5, 0x01, 0x58, 0x5D, 0x02, 0x62, 0x00, 0xAF, 0x62,
+0x00, 0x5D, 0x00, 0x62, 0x5D, 0x51, 0x58, 0x62, 0x00, 0x5D, 0x00, 0x62, 0x5D, 0xA9, 0x9E, 0xBF,
+0x5D, 0x91, 0xC1, 0xEB, 0xF2, 0x6E, 0xFB, 0xA1, 0xA5, 0xC0, 0x4D, 0xFB, 0x6E, 0xC0, 0x6B, 0xFB,
+0xAE, 0xC1, 0x23, 0xF9, 0x20, 0xF8, 0xA6, 0x22, 0x9A, 0xAE, 0x00, 0x5A, 0x5D, 0xE0, 0x0A, 0x5A,
+0x5F, 0x00, 0x5D, 0x29, 0x62, 0x5F, 0x62, 0x5F, 0x00, 0x9E, 0xC4, 0xE3, 0xE8, 0x8D, 0xFB, 0xB1,
+0xFC, 0x58, 0xFE, 0x5C, 0xFF, 0x00, 0xAE, 0xAE, 0xA1, 0xA0, 0xC3, 0x4E, 0xCC, 0x4A, 0xAB, 0x8F,
+0xD4, 0xF1, 0xDC, 0x00, 0xBE, 0x92, 0x00, 0xA9, 0x00, 0x4B, 0x53, 0xAF, 0xBF, 0x5F, 0x9A, 0xA2,
+0x99, 0xA6, 0x00, 0x46, 0x52, 0x46, 0x43, 0x46, 0x4B, 0x52, 0x01, 0xAE, 0x43, 0x4B, 0x57, 0xA9,
+0x4B, 0x48, 0x43, 0x00, 0x57, 0x50, 0x57, 0x5F, 0xAF, 0x5C, 0x57, 0x5F, 0xA1, 0x00, 0x99, 0x4B,
+0x00, 0xC3, 0x90, 0xD4, 0x74, 0xE5, 0x1B, 0xFF, 0x7D, 0xFF, 0xA5, 0xA5, 0xC0, 0x98, 0xFE, 0xA9,
+0x64, 0xC1, 0xA6, 0xE9, 0x82, 0xF0, 0x5A, 0x5D, 0xE0, 0x32, 0x5A, 0x00, 0x5D, 0x29, 0x62, 0x9A,
+0x02, 0x61, 0xC4, 0x61, 0xD0, 0x6D, 0xFB, 0x70, 0xCC, 0xF6, 0xCD, 0xFE, 0xFF, 0x00, 0xA9, 0x95,
+0x63, 0xA1, 0xC2, 0x4F, 0x94, 0x2A, 0x73, 0x0E, 0x8C, 0xA5, 0x75, 0xBE, 0x00, 0x9A, 0x75, 0xA9,
+0x75, 0x7D, 0xAE, 0x49, 0xBE, 0x49, 0x7D, 0x7A, 0x75, 0x00, 0x7A, 0x00, 0xC0, 0x6F, 0x94, 0x04,
+0x49, 0x00, 0x6E, 0x7A, 0x00, 0x42, 0x00, 0x7A, 0x75, 0x6E, 0x7A, 0x00, 0x42, 0x49, 0x00, 0x42,
+0x00, 0x7D, 0xBE, 0xBE, 0xC0, 0x0D, 0x94, 0xAE, 0x45, 0x7D, 0xC0, 0x93, 0xBD, 0x6A, 0xA1, 0x91,
+0x85, 0xC3, 0x56, 0xD6, 0xB8, 0xFE, 0x37, 0xFE, 0xC3, 0xC8, 0x60, 0x5A, 0x5D, 0xE0, 0x64, 0x9F,
+0xC5, 0x83, 0xE0, 0x8F, 0xFB, 0xB2, 0xCC, 0x54, 0xB5, 0xBE, 0xF7, 0xFF, 0xFF, 0x00, 0x6A, 0x00,
+0xC1, 0x5B, 0xF7, 0xB1, 0xA4, 0x49, 0xC2, 0xF2, 0xA4, 0x70, 0x9C, 0xB1, 0x9C, 0xA6, 0xA9, 0x00,
+0x58, 0x9A, 0x00, 0xA6, 0x00, 0x49, 0x64, 0x06, 0x55, 0x00, 0x50, 0x00, 0x49, 0x96, 0x02, 0xBA,
+0x49, 0xBB, 0x58, 0x50, 0x44, 0x01, 0x49, 0x50, 0x00, 0x53, 0x58, 0x53, 0x49, 0xBA, 0xC0, 0x90,
+0xA4, 0x4C, 0x00, 0xC0, 0x8F, 0x94, 0x92, 0xC2, 0x74, 0xB5, 0xDE, 0xFF, 0x5D, 0xF7, 0x81, 0xC5,
+0x7C, 0xE7, 0xB9, 0xE6, 0xFA, 0xFE, 0xEF, 0xFB, 0x63, 0xD8, 0x22, 0xF8, 0xA4, 0x1F, 0xAE, 0x5D,
+0xE0, 0x1D, 0x5F, 0x5D, 0x1F, 0x62, 0x5D, 0x01, 0x9B, 0xCC, 0x22, 0xD8, 0x4E, 0xFB, 0x17, 0xFE,
+0xF6, 0xC5, 0x3C, 0xE7, 0x9D, 0xEF, 0x1A, 0xE7, 0xB9, 0xDE, 0x1B, 0xEF, 0x79, 0xD6, 0x34, 0xAD,
+0xB5, 0xBD, 0x78, 0xD6, 0x92, 0xAE, 0xA1, 0x68, 0xA9, 0x01, 0x5C, 0x96, 0xA5, 0x00, 0x91, 0x79,
+0xAB, 0x48, 0x03, 0x4D, 0x48, 0x01, 0x40, 0x79, 0x74, 0x00, 0xBF, 0xA9, 0xAE, 0x48, 0x4D, 0x00,
+0x48, 0x7C, 0x48, 0xBE, 0x00, 0x48, 0x4D, 0x50, 0xAE, 0x4D, 0x00, 0xC0, 0x37, 0xD6, 0xA9, 0x55,
+0x99, 0xC0, 0xB4, 0xB5, 0x55, 0x47, 0xC0, 0xFC, 0xEE, 0x85, 0xC0, 0xBD, 0xF7, 0xB5, 0xC3, 0xBA,
+0xFE, 0xE7, 0xD1, 0x21, 0xE0, 0x00, 0xF8, 0x1F, 0xAE, 0x00, 0x5D, 0xE0, 0x3E, 0x5F, 0x00, 0x5D,
+0x01, 0x5A, 0xC2, 0x22, 0xE0, 0x0D, 0xFB, 0x3C, 0xFF, 0x64, 0x79, 0xC7, 0xF2, 0xAC, 0x2B, 0x7B,
+0x68, 0x62, 0x91, 0x9C, 0x94, 0xB5, 0x17, 0xC6, 0x99, 0xD6, 0xDA, 0xDE, 0x90, 0x75, 0x49, 0xAE,
+0x00, 0x49, 0x04, 0xA6, 0x03, 0x4C, 0xAB, 0xAD, 0xAB, 0x00, 0x53, 0x51, 0x53, 0x4C, 0x01, 0x44,
+0xA9, 0x01, 0x49, 0x01, 0x44, 0x91, 0x75, 0x00, 0x61, 0x00, 0x75, 0x7D, 0x75, 0x49, 0xC0, 0xFA,
+0xEE, 0x00, 0x51, 0x85, 0xA5, 0xB3, 0xBF, 0xC0, 0xB7, 0xCD, 0x95, 0xC4, 0x78, 0xDE, 0x3B, 0xFF,
+0xF3, 0xFC, 0xA2, 0xC8, 0x00, 0xE0, 0x5D, 0x21, 0x62, 0x5D, 0xE0, 0x3D, 0x5F, 0x00, 0x5D, 0x01,
+0x5A, 0x67, 0xC7, 0x8B, 0xFA, 0x5C, 0xFF, 0x98, 0xE6, 0x95, 0xC5, 0x13, 0xB5, 0x4B, 0x83, 0xA9,
+0x6A, 0xF2, 0xA4, 0x59, 0xC0, 0x79, 0xD6, 0x75, 0x55, 0xBF, 0x58, 0xC0, 0x5C, 0xEF, 0x55, 0x00,
+0xA6, 0x00, 0x55, 0xBE, 0xAF, 0xBE, 0x45, 0xA6, 0x00, 0xA6, 0x00, 0x40, 0xBF, 0xAE, 0x40, 0x45,
+0x01, 0x4F, 0x54, 0x4F, 0x54, 0x90, 0x9A, 0x71, 0x76, 0x79, 0x45, 0x00, 0x79, 0x71, 0x76, 0x71,
+0x5D, 0x00, 0x71, 0x79, 0x71, 0x69, 0x7D, 0xB5, 0x95, 0x89, 0xBF, 0xC0, 0xFA, 0xF6, 0x42, 0x96,
+0xC4, 0xF7, 0xCD, 0x37, 0xDE, 0x3B, 0xFF, 0x6D, 0xFB, 0x82, 0xD8, 0x5F, 0x62, 0xA6, 0x20, 0x5F,
+0x00, 0x5D, 0xE0, 0x15, 0xAF, 0xAE, 0x5A, 0x9E, 0x5F, 0x5A, 0x62, 0x01, 0x5F, 0x5A, 0x01, 0x5D,
+0x05, 0x5A, 0x62, 0x06, 0x5D, 0x08, 0x5A, 0x00, 0x5D, 0x01, 0x5A, 0x5B, 0xC0, 0xE8, 0xE1, 0x43,
+0xC3, 0xF9, 0xEE, 0xD5, 0xBD, 0x12, 0xA5, 0x0E, 0x8C, 0x00, 0xC0, 0x13, 0xAD, 0x68, 0x50, 0xC0,
+0x3C, 0xEF, 0x6C, 0x54, 0xC0, 0xFF, 0xFF, 0x54, 0xAB, 0xAE, 0xAE, 0xC0, 0xDA, 0xE6, 0x7C, 0x6C,
+0x54, 0x6C, 0x60, 0x56, 0xA6, 0xA6, 0x45, 0x51, 0x60, 0xC0, 0xFE, 0xFF, 0x51, 0xBE, 0x60, 0x65,
+0x59, 0x56, 0x54, 0x59, 0x54, 0x45, 0x54, 0x59, 0x51, 0x54, 0x59, 0x45, 0x6C, 0xAE, 0x59, 0x00,
+0x71, 0x00, 0x59, 0x65, 0x9A, 0xBF, 0x91, 0x56, 0xC3, 0x7A, 0xDF, 0x19, 0xD7, 0x1A, 0xEF, 0x99,
+0xE6, 0x49, 0xAE, 0xC0, 0x36, 0xD6, 0x77, 0xC3, 0x04, 0xC1, 0x62, 0xE8, 0x00, 0xE8, 0x00, 0xF8,
+0xAE, 0x00, 0x5D, 0x1D, 0x5A, 0x00, 0x62, 0x00, 0x5D, 0x62, 0x00, 0x5F, 0x00, 0x5D, 0xE0, 0x0C,
+0x62, 0x5D, 0x00, 0x62, 0x5A, 0x8E, 0x9E, 0xC0, 0xA0, 0xE0, 0xA2, 0x00, 0x9A, 0x9A, 0x00, 0xAE,
+0xBA, 0x60, 0xBF, 0xA6, 0x00, 0xA6, 0x00, 0x6A, 0x01, 0x5B, 0x04, 0xA6, 0x00, 0xC0, 0x61, 0xE8,
+0x06, 0xA5, 0x01, 0x63, 0x61, 0x01, 0x6A, 0x87, 0xC1, 0x29, 0xD2, 0x7C, 0xFF, 0x80, 0xC4, 0xB5,
+0xBD, 0xD2, 0x9C, 0x0E, 0x8C, 0x8C, 0x7B, 0xF2, 0xA4, 0x7C, 0x00, 0xC0, 0xDB, 0xE6, 0x7C, 0x50,
+0x71, 0x02, 0xA1, 0x64, 0xC0, 0x9A, 0xDE, 0x91, 0x64, 0xC0, 0x9E, 0xFF, 0x60, 0x9A, 0xA9, 0x51,
+0xA6, 0x51, 0x5D, 0xBE, 0x51, 0x5D, 0x65, 0x60, 0x5D, 0x51, 0x00, 0x60, 0x51, 0x45, 0x54, 0x60,
+0x51, 0xBE, 0x60, 0x51, 0x65, 0x00, 0x54, 0xC1, 0x3B, 0xEF, 0xDA, 0xDE, 0x00, 0x45, 0xC0, 0xFF,
+0xFF, 0x02, 0xA9, 0xC1, 0xD8, 0xCE, 0x77, 0xC6, 0x43, 0x54, 0x55, 0x94, 0xC4, 0x57, 0xDE, 0x1B,
+0xFF, 0xA3, 0xC0, 0x01, 0xE8, 0x20, 0xF8, 0x00, 0xA6, 0x5A, 0x5D, 0x0C, 0x62, 0x5D, 0x0D, 0x62,
+0x00, 0x5A, 0x00, 0x62, 0x5D, 0x5A, 0x00, 0xAE, 0x00, 0x5D, 0xE0, 0x0F, 0x5A, 0xC4, 0x00, 0xD8,
+0xC1, 0xE0, 0x62, 0xD1, 0xC3, 0xD1, 0x46, 0xDA, 0x86, 0x95, 0x9A, 0xAE, 0xAF, 0x01, 0xB6, 0x7B,
+0x92, 0xC0, 0x64, 0xB1, 0xA1, 0x99, 0xAB, 0x7A, 0xBF, 0x44, 0x00, 0xA9, 0x00, 0xA6, 0x01, 0xA6,
+0x05, 0xBA, 0xA5, 0xA6, 0x03, 0xBE, 0x9B, 0xCE, 0x24, 0xB9, 0xA9, 0xBA, 0x3A, 0xFF, 0x1A, 0xE7,
+0xF6, 0xC5, 0xF3, 0xAC, 0x0F, 0x94, 0xCA, 0x6A, 0xCE, 0x83, 0x17, 0xC6, 0x58, 0xD6, 0x9D, 0xF7,
+0x1B, 0xEF, 0x99, 0xD6, 0xDE, 0xFF, 0x60, 0xC1, 0x5D, 0xF7, 0xFF, 0xFF, 0x00, 0x60, 0x4C, 0xC0,
+0x38, 0xCE, 0x7C, 0x71, 0x60, 0x01, 0x96, 0x51, 0x00, 0x58, 0x60, 0x03, 0x51, 0x01, 0x60, 0x56,
+0x91, 0x56, 0x65, 0x56, 0x65, 0xAE, 0x56, 0x00, 0x6A, 0x42, 0x91, 0xBF, 0xC0, 0xFA, 0xDE, 0xBF,
+0xC0, 0xDF, 0xFF, 0x00, 0xA2, 0xAE, 0xC7, 0xFB, 0xEE, 0x90, 0x9C, 0xEE, 0x8B, 0xD6, 0xCD, 0xDA,
+0xEE, 0x1A, 0xE7, 0x77, 0xD6, 0x78, 0xEE, 0x72, 0xC2, 0xA4, 0xC8, 0x01, 0xE0, 0x21, 0xF8, 0xA5,
+0x00, 0xAB, 0x0D, 0x5D, 0x0E, 0x9B, 0xC0, 0x41, 0xF0, 0x85, 0xBE, 0xC0, 0x20, 0xF8, 0xAF, 0x5D,
+0xC0, 0x40, 0xF8, 0x5F, 0x00, 0x5D, 0xE0, 0x0D, 0x69, 0x62, 0xC6, 0x61, 0xF8, 0xE2, 0xE8, 0x6A,
+0xFB, 0x4C, 0xFC, 0xAD, 0xF4, 0xAA, 0xBB, 0x69, 0xA3, 0x85, 0xAE, 0xC0, 0xA9, 0x93, 0x96, 0x00,
+0xBA, 0xC0, 0xCA, 0x9B, 0xB6, 0xA6, 0xA6, 0x00, 0xBE, 0xC0, 0xCB, 0xAB, 0xAF, 0xBA, 0x00, 0xBA,
+0x00, 0xA5, 0x9A, 0x68, 0x00, 0xC0, 0x0C, 0xC4, 0x00, 0xA6, 0x02, 0xBA, 0x00, 0xBA, 0xA2, 0x9A,
+0x00, 0xAE, 0x00, 0xA9, 0x00, 0x9B, 0xC1, 0xEC, 0xAB, 0xB3, 0xBD, 0x8A, 0xC7, 0x74, 0xBD, 0xF2,
+0xB4, 0x70, 0xA4, 0x8D, 0x83, 0xD2, 0xA4, 0x37, 0xCE, 0x79, 0xD6, 0xDE, 0xFF, 0x60, 0xC0, 0xFB,
+0xE6, 0x54, 0xC0, 0xFF, 0xFF, 0x01, 0x65, 0x54, 0x65, 0xC0, 0x99, 0xDE, 0xAE, 0xC0, 0xFE, 0xFF,
+0x60, 0x00, 0x65, 0x60, 0x95, 0x02, 0x65, 0x01, 0x60, 0x51, 0x01, 0xAF, 0x56, 0x91, 0x56, 0x65,
+0x56, 0x65, 0x6A, 0x65, 0x00, 0x6A, 0xC0, 0x3B, 0xE7, 0x00, 0x6A, 0x56, 0xC0, 0x5C, 0xEF, 0x71,
+0x6C, 0x01, 0xCA, 0xFB, 0xF6, 0x50, 0x9C, 0x8C, 0x83, 0xD5, 0xD5, 0x9C, 0xFF, 0x5B, 0xE7, 0x77,
+0xD6, 0x98, 0xEE, 0xB9, 0xFE, 0x66, 0xC9, 0x82, 0xD8, 0xBE, 0x6F, 0xAB, 0x9E, 0x73, 0x01, 0x78,
+0xBB, 0x7B, 0x92, 0xA9, 0x6E, 0x67, 0x6E, 0x73, 0x01, 0x42, 0x7B, 0x73, 0x67, 0x9A, 0x00, 0x73,
+0x00, 0x96, 0xAD, 0xAB, 0x69, 0x70, 0x69, 0x70, 0x69, 0x9A, 0xAE, 0x00, 0xC2, 0xE2, 0xD8, 0x00,
+0xD8, 0x00, 0xF8, 0x01, 0xAE, 0x5F, 0x5D, 0xE0, 0x0D, 0xC0, 0x41, 0xF8, 0x5D, 0x8A, 0xC5, 0xC0,
+0xD8, 0x4C, 0xFC, 0xED, 0xF4, 0xEC, 0xC4, 0x6B, 0x84, 0x4A, 0x64, 0x96, 0xC0, 0x6A, 0x5C, 0x9B,
+0x95, 0xA5, 0x00, 0xC0, 0x4A, 0x5C, 0xAB, 0xBA, 0xA6, 0x01, 0xC0, 0x6C, 0x64, 0xAE, 0x5B, 0x02,
+0x56, 0xA9, 0xA6, 0x00, 0xBB, 0x05, 0xA9, 0xBA, 0xA6, 0x96, 0xAE, 0x4D, 0x4A, 0xA9, 0x95, 0xB1,
+0xC3, 0x46, 0x4B, 0x88, 0x43, 0xEA, 0x5B, 0x31, 0xA5, 0xB2, 0xA1, 0xAF, 0xC0, 0x33, 0xB5, 0x00,
+0xC1, 0x17, 0xCE, 0x9D, 0xFF, 0x65, 0xC0, 0x1A, 0xEF, 0x61, 0xC2, 0xDA, 0xE6, 0xBD, 0xFF, 0x3B,
+0xEF, 0x49, 0xC3, 0x5C, 0xF7, 0xDD, 0xFF, 0x78, 0xD6, 0xB9, 0xE6, 0x54, 0x59, 0xAF, 0x01, 0x95,
+0xA6, 0x01, 0x65, 0x01, 0x56, 0x51, 0x00, 0x56, 0x5E, 0x56, 0x45, 0x56, 0x5E, 0x51, 0x5E, 0xAF,
+0x5E, 0x6A, 0x00, 0x71, 0x00, 0x6A, 0xC1, 0x7C, 0xEF, 0x17, 0xC6, 0x00, 0xC0, 0x5D, 0xF7, 0xBA,
+0x90, 0xCA, 0x78, 0xDE, 0xB0, 0xA4, 0xED, 0x8B, 0xF5, 0xCD, 0xFD, 0xFF, 0x7B, 0xEF, 0xD7, 0xD6,
+0x76, 0xD6, 0xD4, 0xE5, 0xA8, 0xAA, 0x06, 0xBA, 0xA4, 0xAF, 0xC0, 0x46, 0xBA, 0x9A, 0x01, 0xC0,
+0x87, 0xBA, 0xBF, 0xC2, 0xE9, 0xCA, 0x29, 0xCB, 0x6B, 0xD3, 0xA9, 0x62, 0xBA, 0xAE, 0xAE, 0xBB,
+0x9E, 0x92, 0x00, 0xAF, 0xAE, 0xC2, 0x0E, 0xDC, 0x4F, 0xE4, 0xB0, 0xEC, 0xBF, 0xAF, 0xA9, 0xAF,
+0xA9, 0x60, 0xAE, 0x00, 0xA9, 0xB6, 0xA0, 0xA6, 0xC2, 0x4E, 0xFC, 0xA2, 0xE0, 0x41, 0xF8, 0xA5,
+0x96, 0x5D, 0xE0, 0x0F, 0x62, 0x5A, 0x8A, 0xC5, 0xA0, 0xC8, 0xCE, 0xFC, 0x2C, 0xE5, 0xEA, 0x9C,
+0xEB, 0x64, 0xCB, 0x44, 0x95, 0xAF, 0xAE, 0x91, 0x95, 0xBB, 0xBB, 0xBE, 0xA6, 0xA6, 0x95, 0x95,
+0xAF, 0xAE, 0xC0, 0xAB, 0x3C, 0x03, 0x5E, 0x59, 0x03, 0x54, 0xBA, 0x02, 0xAE, 0x95, 0xA7, 0x54,
+0x56, 0x4C, 0x94, 0x91, 0xC0, 0xA5, 0x23, 0xB6, 0xAB, 0xC8, 0x0A, 0x54, 0x92, 0xAD, 0xF1, 0xAC,
+0x2E, 0x94, 0xD0, 0xA4, 0x94, 0xBD, 0x33, 0xAD, 0x58, 0xD6, 0xBD, 0xFF, 0xAE, 0xC2, 0xD9, 0xE6,
+0xF2, 0xA4, 0x33, 0xAD, 0x00, 0xC0, 0x4F, 0x94, 0x51, 0xC0, 0x1A, 0xEF, 0x70, 0xC2, 0xD1, 0xA4,
+0xB9, 0xDE, 0xFE, 0xFF, 0x59, 0xAF, 0x01, 0x95, 0xA6, 0x00, 0x56, 0x06, 0x65, 0x51, 0xA5, 0x51,
+0x59, 0x95, 0x59, 0x65, 0x59, 0x01, 0xC0, 0x3B, 0xEF, 0x45, 0x6A, 0xC3, 0x5C, 0xEF, 0xB5, 0xBD,
+0xD2, 0x9C, 0x30, 0x94, 0xBA, 0x99, 0xC1, 0x6F, 0x9C, 0x0D, 0x84, 0xBE, 0xC6, 0x56, 0xCE, 0xFD,
+0xFF, 0x9B, 0xEF, 0xF8, 0xDE, 0x14, 0xBE, 0xAF, 0x9C, 0x69, 0x83, 0xB6, 0xB9, 0xC1, 0xA9, 0x9B,
+0xEA, 0x93, 0x02, 0xAE, 0xC0, 0x4B, 0x9C, 0xBF, 0xAF, 0x5C, 0x02, 0xAB, 0xBE, 0xAF, 0xAE, 0xAB,
+0x9A, 0x01, 0xA6, 0x40, 0x00, 0xAE, 0xAF, 0x01, 0xAE, 0xAE, 0xAB, 0x00, 0xBD, 0xC5, 0x90, 0xB5,
+0x0D, 0xB5, 0x4F, 0xD5, 0x71, 0xFD, 0xC1, 0xC8, 0x61, 0xF0, 0x6E, 0x5D, 0xE0, 0x10, 0xAE, 0x5D,
+0xC6, 0x60, 0xF0, 0xE0, 0xC8, 0x4F, 0xFD, 0x8D, 0xD5, 0x6B, 0x9D, 0xA9, 0x54, 0x69, 0x34, 0x95,
+0xC0, 0x89, 0x34, 0x96, 0x91, 0xBA, 0xC1, 0x69, 0x3C, 0xC7, 0x2B, 0xBB, 0xAE, 0x60, 0x9A, 0xAE,
+0xC1, 0x49, 0x2C, 0x8A, 0x34, 0x40, 0x00, 0x45, 0x00, 0xBA, 0xAB, 0x01, 0xBA, 0x02, 0xB6, 0x01,
+0x52, 0x4F, 0x00, 0xA2, 0xAF, 0x9E, 0x98, 0xC2, 0x67, 0x14, 0x05, 0x0C, 0x63, 0x13, 0xBB, 0xA2,
+0xC5, 0x67, 0x3B, 0xEF, 0x94, 0x11, 0xAD, 0x4E, 0x8C, 0xD0, 0x94, 0x53, 0xAD, 0xBF, 0xC1, 0x58,
+0xD6, 0x7C, 0xF7, 0x59, 0xAF, 0x45, 0x59, 0xC2, 0x1B, 0xEF, 0x54, 0xB5, 0x78, 0xD6, 0x59, 0xC2,
+0xD2, 0xA4, 0x4B, 0x6B, 0x99, 0xD6, 0x5E, 0xA7, 0x65, 0x00, 0x60, 0x96, 0xA9, 0x58, 0x60, 0x91,
+0x51, 0x60, 0x03, 0x65, 0x51, 0x96, 0x51, 0x00, 0x4C, 0x51, 0x60, 0x51, 0x60, 0x51, 0x91, 0x49,
+0xC0, 0xFF, 0xFF, 0x00, 0x60, 0xC5, 0xFB, 0xE6, 0xB2, 0xAC, 0x30, 0x9C, 0xCE, 0x8B, 0x2E, 0x94,
+0xEC, 0x7B, 0x7F, 0xC5, 0x36, 0xCE, 0x3A, 0xEF, 0x7B, 0xF7, 0xF9, 0xDE, 0x15, 0xB6, 0x2C, 0x64,
+0x84, 0xC0, 0x4A, 0x54, 0x00, 0xC0, 0x8B, 0x5C, 0xA5, 0x00, 0xA6, 0x04, 0xAF, 0x56, 0x00, 0x51,
+0x56, 0x5D, 0xBE, 0xAE, 0x62, 0x9A, 0xA6, 0x00, 0xA9, 0x00, 0x50, 0x00, 0x95, 0xAB, 0xAE, 0x52,
+0xBB, 0xAE, 0x00, 0xAE, 0xA9, 0xC5, 0x68, 0x54, 0xAA, 0x84, 0x6F, 0xE5, 0xA0, 0xB0, 0x40, 0xE0,
+0x00, 0xF0, 0xBA, 0xE0, 0x12, 0xC6, 0x81, 0xF0, 0xC0, 0xC8, 0xEE, 0xFC, 0x2C, 0xC5, 0x6B, 0x8D,
+0xA9, 0x4C, 0x68, 0x34, 0x92, 0xBE, 0xA9, 0xC1, 0xE6, 0x33, 0x06, 0x44, 0x45, 0xC0, 0x2C, 0x75,
+0xA6, 0xC2, 0xAB, 0x6C, 0x49, 0x5C, 0xE7, 0x43, 0x85, 0x9F, 0x6C, 0xBF, 0x00, 0x40, 0x00, 0xBB,
+0xAD, 0x4F, 0x4D, 0x07, 0x95, 0x7B, 0xB7, 0x00, 0x9E, 0x85, 0xC0, 0xE6, 0x0B, 0x90, 0xC0, 0x23,
+0x0B, 0xB6, 0xB2, 0xC8, 0xE5, 0x32, 0x8E, 0x8C, 0x52, 0xAD, 0x4E, 0x84, 0xEC, 0x7B, 0xF2, 0x9C,
+0x17, 0xCE, 0xDA, 0xDE, 0xFE, 0xFF, 0xA5, 0xAB, 0x6A, 0x65, 0xC2, 0x5C, 0xEF, 0xF2, 0xA4, 0x37,
+0xCE, 0x59, 0x78, 0xC0, 0x0F, 0x84, 0x5E, 0x59, 0x65, 0x01, 0x60, 0x58, 0xA9, 0x60, 0x00, 0x91,
+0x51, 0x60, 0x03, 0x65, 0x51, 0x95, 0x4C, 0x51, 0x91, 0xAF, 0x60, 0x51, 0x65, 0x01, 0x51, 0x00,
+0x71, 0x6A, 0xC1, 0xFB, 0xE6, 0xD2, 0xAC, 0x6B, 0x95, 0xC0, 0x2F, 0x94, 0x84, 0xC3, 0x11, 0xA5,
+0x3A, 0xEF, 0xBC, 0xFF, 0x5B, 0xF7, 0x80, 0xC1, 0x76, 0xBE, 0x2C, 0x5C, 0x40, 0x47, 0x00, 0xAE,
+0xBA, 0x00, 0xAF, 0xBA, 0xAE, 0x5E, 0xA5, 0x00, 0x5E, 0xA9, 0x52, 0x4F, 0x4A, 0x52, 0xAB, 0x5E,
+0x96, 0x00, 0x5B, 0x01, 0x9D, 0xA6, 0xA9, 0xA1, 0xAB, 0xAE, 0x4A, 0xC0, 0xEA, 0x34, 0xAE, 0xAF,
+0x00, 0x95, 0xB0, 0xC4, 0xCA, 0x64, 0xD1, 0xD5, 0x22, 0xB9, 0x82, 0xF0, 0x00, 0xF0, 0xBA, 0xE0,
+0x12, 0xCD, 0x40, 0xE8, 0xA1, 0xC8, 0xF0, 0xFC, 0xED, 0xC4, 0xEA, 0x84, 0xA9, 0x4C, 0xE6, 0x23,
+0x28, 0x34, 0xA5, 0x2B, 0xA4, 0x43, 0xC7, 0x74, 0x4D, 0xB6, 0x72, 0xE7, 0xD6, 0xF7, 0xBF, 0xA5,
+0xC7, 0xD1, 0xD6, 0x0A, 0x8D, 0xE6, 0x5B, 0x25, 0x2B, 0x29, 0x44, 0x87, 0x2B, 0x29, 0x34, 0x8B,
+0x44, 0x91, 0x76, 0xC0, 0x6A, 0x3C, 0xB6, 0x01, 0xC0, 0x8B, 0x54, 0x91, 0x91, 0x4B, 0xAE, 0x00,
+0x7C, 0x97, 0x00, 0xC0, 0xA9, 0x3B, 0x91, 0xA5, 0x9E, 0x95, 0xC0, 0xE4, 0x12, 0xA1, 0xA2, 0xBA,
+0xC3, 0x85, 0x32, 0x8E, 0x8C, 0x51, 0xAD, 0xAF, 0x94, 0xAB, 0xC4, 0x33, 0xB5, 0xF7, 0xCD, 0xFA,
+0xE6, 0x9D, 0xF7, 0xFE, 0xFF, 0xA6, 0x51, 0xBF, 0xA1, 0xC4, 0x30, 0x8C, 0x34, 0xB5, 0xBA, 0xDE,
+0xF2, 0xA4, 0x58, 0xD6, 0x65, 0x6A, 0x00, 0x65, 0x60, 0x91, 0x95, 0x00, 0x4C, 0xBE, 0x00, 0x51,
+0x05, 0x65, 0x51, 0xC0, 0x3C, 0xEF, 0x99, 0x78, 0xC1, 0x7C, 0xF7, 0xBD, 0xFF, 0x65, 0x03, 0x51,
+0xAE, 0x60, 0xC3, 0x5C, 0xF7, 0x74, 0xBD, 0xED, 0x8B, 0x8C, 0x83, 0x9A, 0xC3, 0x2E, 0x8C, 0xB8,
+0xDE, 0xFD, 0xFF, 0x9C, 0xF7, 0x95, 0x95, 0xC3, 0x35, 0xAE, 0xEB, 0x53, 0x88, 0x33, 0x6B, 0x3C,
+0x95, 0x85, 0xC0, 0x49, 0x34, 0xAF, 0xBF, 0x99, 0x56, 0x00, 0xA1, 0xBA, 0xBE, 0x9F, 0xC0, 0x29,
+0x3C, 0x5E, 0x59, 0xC0, 0x2A, 0x3C, 0xBF, 0xC3, 0xEA, 0x33, 0x2B, 0x3C, 0x8D, 0x44, 0x0A, 0x34,
+0xAE, 0x4C, 0x94, 0xC0, 0xA9, 0x2C, 0xB5, 0xC0, 0x27, 0x34, 0xBA, 0x91, 0x9E, 0xC1, 0x87, 0x2C,
+0xE9, 0x2C, 0xAB, 0x80, 0xC5, 0x2B, 0x35, 0xA9, 0x34, 0x8A, 0x4C, 0xD1, 0xCD, 0x02, 0xC1, 0x20,
+0xF0, 0xB6, 0xAE, 0x5D, 0xE0, 0x0F, 0x5A, 0x5D, 0x61, 0xC4, 0xA1, 0xC8, 0xF0, 0xFC, 0xCD, 0xC4,
+0xAB, 0x7C, 0x27, 0x44, 0x57, 0x43, 0xC3, 0xA5, 0x43, 0x4A, 0x8D, 0xCF, 0xD6, 0x30, 0xEF, 0xA2,
+0xC3, 0x91, 0xE6, 0x0F, 0xDE, 0x71, 0xE6, 0x53, 0xFF, 0x89, 0xC3, 0x2E, 0xBE, 0x08, 0x64, 0x26,
+0x33, 0xA8, 0x33, 0xAB, 0x01, 0xC0, 0xEA, 0x3B, 0xA5, 0x92, 0xBE, 0xBE, 0xA1, 0x96, 0xC1, 0xCA,
+0x4B, 0x2B, 0x54, 0x80, 0x65, 0x6A, 0xC0, 0x69, 0x3B, 0xA6, 0xC2, 0xCB, 0x53, 0x0C, 0x5C, 0xAA,
+0x53, 0x85, 0xC2, 0x27, 0x33, 0xA4, 0x22, 0x43, 0x1A, 0xA6, 0xB6, 0xC9, 0x65, 0x3A, 0x6E, 0x8C,
+0x11, 0xA5, 0x8F, 0x94, 0xD1, 0xA4, 0x54, 0xB5, 0x17, 0xCE, 0xDA, 0xE6, 0x3B, 0xEF, 0x9D, 0xF7,
+0x00, 0xA1, 0xAE, 0x58, 0xC5, 0xCE, 0x83, 0x71, 0x9C, 0xF6, 0xCD, 0x13, 0xAD, 0xFA, 0xE6, 0xFF,
+0xFF, 0xA9, 0xA6, 0x01, 0xA5, 0x51, 0x45, 0x51, 0x06, 0x59, 0x00, 0x51, 0xA9, 0x45, 0x00, 0x4A,
+0x51, 0x01, 0x65, 0x00, 0x59, 0x00, 0x45, 0x51, 0x59, 0xC2, 0x1A, 0xE7, 0xD1, 0xA4, 0xAC, 0x83,
+0x91, 0x4D, 0xC2, 0x0E, 0x8C, 0x77, 0xDE, 0xFD, 0xFF, 0xA1, 0xC0, 0x3A, 0xEF, 0x9E, 0xC4, 0x55,
+0xB6, 0x0C, 0x5C, 0x28, 0x33, 0xA9, 0x33, 0xE9, 0x2B, 0x42, 0x69, 0xC1, 0x29, 0x34, 0x6B, 0x3C,
+0x00, 0xA6, 0x91, 0xC3, 0x4B, 0x44, 0xEE, 0x64, 0x6B, 0x4C, 0x09, 0x44, 0x48, 0x57, 0x91, 0xC5,
+0x8C, 0x54, 0x70, 0x75, 0x92, 0x75, 0x6E, 0x4C, 0x0C, 0x3C, 0xAA, 0x2B, 0x51, 0xAD, 0xC0, 0xC6,
+0x23, 0xB9, 0xC2, 0x05, 0x34, 0x47, 0x4C, 0xA8, 0x64, 0x95, 0x85, 0xC0, 0x45, 0x34, 0x81, 0xC2,
+0x67, 0x24, 0x4B, 0x3D, 0xEA, 0x2C, 0xB1, 0xC3, 0x6A, 0x4C, 0x91, 0xCD, 0xC2, 0xC0, 0x00, 0xF8,
+0xE0, 0x14, 0xC0, 0x40, 0xE8, 0x6B, 0xC9, 0xF0, 0xFC, 0xCD, 0xBC, 0x8A, 0x7C, 0x08, 0x4C, 0xA5,
+0x3B, 0x03, 0x33, 0x88, 0x74, 0xB0, 0xCE, 0x11, 0xE7, 0x90, 0xE6, 0xA2, 0x92, 0xC0, 0x8E, 0xCD,
+0xBE, 0xC6, 0xEE, 0xDD, 0xD1, 0xF6, 0x93, 0xFF, 0xED, 0xB5, 0xE3, 0x3A, 0xA5, 0x2A, 0x28, 0x2B,
+0x00, 0xA6, 0x44, 0xC2, 0x69, 0x33, 0xCB, 0x4B, 0x2D, 0x5C, 0x00, 0xA5, 0xC1, 0xAB, 0x53, 0x08,
+0x3B, 0x96, 0xC0, 0x49, 0x43, 0xAF, 0x95, 0x7D, 0xD3, 0x4A, 0x43, 0xD4, 0x9D, 0x5A, 0xD7, 0xF8,
+0xC6, 0x75, 0xB6, 0x30, 0x85, 0x2C, 0x64, 0x48, 0x4B, 0xE7, 0x42, 0x86, 0x42, 0xA7, 0x52, 0x90,
+0x9C, 0xD1, 0xA4, 0x4F, 0x94, 0xF2, 0xAC, 0x33, 0xB5, 0x17, 0xD6, 0xB9, 0xE6, 0xFA, 0xE6, 0x5C,
+0xEF, 0x00, 0xA1, 0x5D, 0xA2, 0xC3, 0x2F, 0x94, 0x70, 0x9C, 0x74, 0xBD, 0x13, 0xAD, 0x6C, 0xC0,
+0xDE, 0xFF, 0xA9, 0xA6, 0x5E, 0x65, 0x00, 0x59, 0x00, 0x96, 0x00, 0xA5, 0x00, 0x51, 0x00, 0x59,
+0x02, 0x51, 0x00, 0xA9, 0x51, 0x59, 0x01, 0x51, 0x5E, 0x65, 0x59, 0x4A, 0x7D, 0x01, 0xC2, 0x58,
+0xD6, 0xB0, 0x9C, 0xAC, 0x83, 0x41, 0x96, 0x41, 0xC1, 0x94, 0xBD, 0x9C, 0xFF, 0x91, 0x6A, 0x9A,
+0xC3, 0x56, 0xBE, 0x0C, 0x6C, 0xE7, 0x3A, 0xC6, 0x22, 0x9A, 0xC1, 0x47, 0x23, 0x88, 0x33, 0x00,
+0xC1, 0xC9, 0x3B, 0x2B, 0x44, 0x91, 0xA6, 0xC3, 0x50, 0x75, 0x58, 0xB7, 0xD2, 0x8D, 0xEA, 0x4B,
+0x9A, 0x00, 0xC6, 0xCE, 0x64, 0x17, 0xAF, 0xFC, 0xD7, 0xFE, 0xDF, 0xF9, 0x9E, 0x11, 0x5D, 0xCA,
+0x33, 0x76, 0xC0, 0x87, 0x33, 0xB8, 0xC9, 0x2B, 0x7D, 0x4E, 0xAE, 0x30, 0xCF, 0x91, 0xDF, 0xEE,
+0xCE, 0x8C, 0xB6, 0x0A, 0x96, 0xA6, 0x54, 0x05, 0x2C, 0x68, 0x34, 0x9E, 0xB7, 0xC3, 0x49, 0x4C,
+0x50, 0xC5, 0xA1, 0xC0, 0x00, 0xF8, 0xE0, 0x14, 0xC1, 0x40, 0xE8, 0xA1, 0xC8, 0x50, 0xCA, 0xAC,
+0xBC, 0x4A, 0x7C, 0x87, 0x4B, 0xE3, 0x2A, 0x43, 0x4B, 0x0D, 0xBE, 0x11, 0xEF, 0x2F, 0xDE, 0x51,
+0xDE, 0xF5, 0xF6, 0x56, 0xFF, 0x00, 0xC1, 0xB3, 0xF6, 0xEB, 0xBC, 0xBE, 0xC5, 0xF1, 0xF6, 0x92,
+0xF7, 0xA9, 0x8C, 0xA5, 0x32, 0xE9, 0x32, 0x87, 0x22, 0x00, 0xC3, 0xCC, 0x4B, 0x94, 0x8D, 0x3A,
+0xC7, 0x7B, 0xCF, 0xBA, 0xA6, 0xC3, 0x98, 0xBE, 0x90, 0x7C, 0xC9, 0x3A, 0x27, 0x2A, 0x9A, 0xC0,
+0x88, 0x32, 0x55, 0xC3, 0x88, 0x3A, 0x16, 0xB6, 0xDD, 0xEF, 0x5B, 0xE7, 0x99, 0xC6, 0x56, 0xBE,
+0x72, 0x9D, 0x4E, 0x7C, 0x6A, 0x63, 0xA8, 0x52, 0xC9, 0x62, 0xD1, 0xA4, 0xBB, 0xC1, 0x2F, 0x9C,
+0xF2, 0xB4, 0xAB, 0x5C, 0xC0, 0xB9, 0xE6, 0xAF, 0xC0, 0x1B, 0xEF, 0xAE, 0xC0, 0xB9, 0xDE, 0x91,
+0xBF, 0xC3, 0x50, 0x9C, 0xB2, 0xA4, 0x95, 0xC5, 0xF2, 0xAC, 0x58, 0xC0, 0x9D, 0xFF, 0xAE, 0x96,
+0x59, 0x00, 0xAE, 0x59, 0x00, 0x51, 0x00, 0xA5, 0xAE, 0x51, 0x59, 0x03, 0x65, 0x59, 0x4A, 0x45,
+0x51, 0x59, 0x00, 0x5E, 0x59, 0xC0, 0xFE, 0xFF, 0x59, 0x4A, 0x71, 0x91, 0x49, 0xC2, 0x74, 0xB5,
+0xCD, 0x83, 0x2A, 0x73, 0x96, 0x00, 0x6D, 0xC1, 0x53, 0xB5, 0xBD, 0xFF, 0xA9, 0xC0, 0x5B, 0xF7,
+0x91, 0xC1, 0x97, 0xD6, 0xB3, 0xAD, 0x85, 0xC2, 0xD3, 0x95, 0x71, 0x85, 0xD2, 0x8D, 0x95, 0xC2,
+0x2B, 0x54, 0x48, 0x33, 0xAA, 0x43, 0x92, 0x00, 0xC6, 0xD3, 0x8D, 0xFE, 0xE7, 0xD7, 0xB6, 0xCB,
+0x53, 0x48, 0x3B, 0xEB, 0x4B, 0x35, 0x9E, 0x4D, 0xC0, 0xD8, 0xBE, 0x86, 0xC8, 0xFF, 0xDF, 0x15,
+0x86, 0xAA, 0x3B, 0x26, 0x33, 0x86, 0x4B, 0x0B, 0x8D, 0x53, 0xE7, 0xF5, 0xFF, 0x72, 0xF7, 0xBD,
+0xC0, 0x0E, 0xEF, 0x9E, 0xC4, 0x90, 0xE7, 0xCE, 0xBE, 0x08, 0x75, 0x83, 0x2B, 0x06, 0x2C, 0xBB,
+0xC3, 0x08, 0x4C, 0x2F, 0xC5, 0xA1, 0xC0, 0x20, 0xF8, 0xA6, 0xE0, 0x13, 0xC8, 0x40, 0xE8, 0xC1,
+0xC8, 0xD0, 0xFC, 0x8C, 0xB4, 0x09, 0x74, 0x27, 0x43, 0xA4, 0x32, 0xE5, 0x73, 0xCF, 0xE6, 0xB7,
+0xC2, 0xB2, 0xF6, 0xB9, 0xFF, 0xDC, 0xFF, 0xAE, 0xA9, 0x7D, 0xC1, 0x12, 0xE6, 0x0C, 0xC5, 0x98,
+0xC7, 0x10, 0xF7, 0x6F, 0xD6, 0xC6, 0x42, 0x06, 0x22, 0x48, 0x2A, 0xB2, 0x7C, 0xFB, 0xC6, 0xFF,
+0xE7, 0xBA, 0xC0, 0x1C, 0xD7, 0xA9, 0xBF, 0xC5, 0xFE, 0xF7, 0x9D, 0xE7, 0xD6, 0xAD, 0x2C, 0x53,
+0x66, 0x19, 0x08, 0x2A, 0xA0, 0xC3, 0x07, 0x32, 0x74, 0xAD, 0xDA, 0xDE, 0x37, 0xCE, 0xBF, 0xC6,
+0xF6, 0xBD, 0x53, 0xAD, 0x0E, 0x84, 0x0A, 0x63, 0xE6, 0x41, 0x48, 0x52, 0xB2, 0xAC, 0xBE, 0xC4,
+0x10, 0x9C, 0xF3, 0xB4, 0x54, 0xBD, 0x58, 0xD6, 0xD9, 0xE6, 0x96, 0x95, 0x00, 0x61, 0x91, 0xA5,
+0xC3, 0xCE, 0x83, 0x91, 0xA4, 0x74, 0xBD, 0xB1, 0xA4, 0x49, 0xC0, 0xBD, 0xFF, 0xAE, 0x92, 0x08,
+0x59, 0x02, 0x51, 0x00, 0xC0, 0xDE, 0xFF, 0x59, 0x51, 0x00, 0x59, 0x00, 0x5E, 0x00, 0x51, 0xC0,
+0xFE, 0xFF, 0x65, 0x59, 0xC1, 0x1A, 0xE7, 0x78, 0xD6, 0x4D, 0xC1, 0xB1, 0x9C, 0x2B, 0x73, 0x95,
+0x74, 0xC0, 0x8C, 0x7B, 0x00, 0xC1, 0x73, 0xBD, 0xFD, 0xFF, 0x5E, 0xC2, 0x7C, 0xFF, 0xD9, 0xEE,
+0x77, 0xD6, 0x00, 0xC1, 0x7B, 0xEF, 0xFD, 0xF7, 0x80, 0x9A, 0xC3, 0xFD, 0xEF, 0xCF, 0x7C, 0x86,
+0x2A, 0xE8, 0x32, 0xA2, 0xC9, 0xE9, 0x3A, 0xD5, 0xA5, 0xFE, 0xEF, 0x3A, 0xCF, 0x8B, 0x53, 0x46,
+0x2A, 0xED, 0x5B, 0x5B, 0xCF, 0xD9, 0xBE, 0x0B, 0x4B, 0x9A, 0xC8, 0x95, 0x85, 0xD1, 0x6C, 0x07,
+0x33, 0x25, 0x43, 0x0B, 0x9D, 0xD1, 0xDE, 0x13, 0xF7, 0x50, 0xE6, 0xED, 0xD5, 0xBE, 0xCB, 0xAA,
+0xD5, 0x0A, 0xDE, 0xEE, 0xF6, 0xD0, 0xFF, 0xEE, 0xCE, 0x85, 0x64, 0xC4, 0x33, 0xC6, 0x2B, 0xC7,
+0x4B, 0x4F, 0xCD, 0xC1, 0xC8, 0x40, 0xF8, 0xA2, 0xE0, 0x13, 0xC0, 0x40, 0xE8, 0x70, 0xC6, 0xD0,
+0xFC, 0x6B, 0xB4, 0xE9, 0x6B, 0xAA, 0x53, 0xA4, 0x32, 0xE4, 0x7B, 0xCE, 0xEE, 0xB3, 0xC2, 0x76,
+0xFF, 0xFC, 0xFF, 0xDE, 0xFF, 0x00, 0xA0, 0x5C, 0xC3, 0x79, 0xFF, 0x32, 0xE6, 0x07, 0x9C, 0x2C,
+0xDE, 0x66, 0xCB, 0xE7, 0x52, 0x64, 0x19, 0xEB, 0x4A, 0x3C, 0xD7, 0x9E, 0xE7, 0xF4, 0x94, 0xCF,
+0x6B, 0xAB, 0x4A, 0xEB, 0x52, 0x2C, 0x63, 0x92, 0x8C, 0x18, 0xBE, 0x52, 0xD1, 0x19, 0xBE, 0xAB,
+0x42, 0xA7, 0x21, 0x45, 0x21, 0x28, 0x42, 0x96, 0xB5, 0x3C, 0xF7, 0x79, 0xDE, 0x18, 0xD6, 0xB6,
+0xC5, 0xF2, 0xA4, 0x0F, 0x84, 0x0A, 0x6B, 0xC6, 0x49, 0x07, 0x52, 0x92, 0xAC, 0xF3, 0xB4, 0x10,
+0x9C, 0x4A, 0xC4, 0x17, 0xD6, 0x98, 0xDE, 0xDA, 0xE6, 0x57, 0xD6, 0xB5, 0xBD, 0xA5, 0x79, 0x6D,
+0xC0, 0x13, 0xB5, 0x74, 0xC4, 0xCE, 0x8B, 0xB1, 0xAC, 0x2F, 0x94, 0x78, 0xDE, 0x9D, 0xFF, 0x59,
+0x00, 0x96, 0xA5, 0x01, 0xAE, 0x51, 0x01, 0x59, 0x03, 0x51, 0x02, 0x59, 0x00, 0xAF, 0x00, 0x59,
+0x51, 0x4A, 0xC0, 0xFE, 0xFF, 0x00, 0x65, 0x55, 0xC3, 0xD5, 0xBD, 0x54, 0xAD, 0x4F, 0x94, 0x4B,
+0x73, 0xAE, 0xC1, 0xAC, 0x7B, 0x2E, 0x8C, 0xA6, 0x6D, 0x63, 0xC0, 0x7B, 0xFF, 0x4D, 0xC1, 0xB8,
+0xEE, 0xF6, 0xD5, 0x85, 0xC2, 0xB8, 0xDE, 0x7B, 0xEF, 0xF9, 0xDE, 0x9A, 0xC7, 0xDC, 0xEF, 0x2E,
+0x74, 0xE5, 0x29, 0x47, 0x32, 0xC5, 0x21, 0xEA, 0x4A, 0xBA, 0xC6, 0xFF, 0xF7, 0x90, 0xC5, 0x0E,
+0x74, 0x84, 0x19, 0xAD, 0x5B, 0xFE, 0xE7, 0x38, 0xB6, 0x65, 0x21, 0xAF, 0xC6, 0xC7, 0x19, 0xE9,
+0x3A, 0x84, 0x32, 0x86, 0x63, 0x4F, 0xD6, 0x12, 0xF7, 0x51, 0xEE, 0x96, 0xC0, 0xD4, 0xF6, 0xBE,
+0xCB, 0x6F, 0xEE, 0xEC, 0xDD, 0xA9, 0xDD, 0xAD, 0xF6, 0x8E, 0xFF, 0x2A, 0xB6, 0x05, 0x4C, 0x85,
+0x33, 0xA7, 0x4B, 0x50, 0xD5, 0xC1, 0xC8, 0x20, 0xF8, 0x00, 0xA6, 0xE0, 0x12, 0xC0, 0x41, 0xF0,
+0x70, 0xC8, 0xD0, 0xFC, 0x4B, 0xB4, 0xC8, 0x6B, 0xA9, 0x4B, 0x83, 0x2A, 0xA3, 0x73, 0x8E, 0xEE,
+0xD0, 0xFE, 0xD8, 0xFF, 0x6A, 0x97, 0x6E, 0xBA, 0x6A, 0xA4, 0xCC, 0x58, 0xFF, 0xAA, 0xAC, 0x6D,
+0xE6, 0x32, 0xF7, 0x8A, 0x6B, 0xA6, 0x29, 0x8E, 0x63, 0x7E, 0xE7, 0x97, 0xAD, 0xA7, 0x31, 0x29,
+0x42, 0x0C, 0x5B, 0xE8, 0x39, 0x44, 0xA9, 0xC4, 0xCB, 0x52, 0x9A, 0xCE, 0x5D, 0xDF, 0x2E, 0x5B,
+0xE4, 0x10, 0xAD, 0xC4, 0x07, 0x3A, 0x34, 0xAD, 0xFB, 0xEE, 0x38, 0xD6, 0x75, 0xC5, 0x86, 0xC3,
+0xF3, 0xA4, 0x71, 0x94, 0xCE, 0x83, 0x89, 0x5A, 0xA6, 0x76, 0xC1, 0xF3, 0xB4, 0x30, 0x94, 0x4F,
+0xC2, 0x17, 0xD6, 0x57, 0xDE, 0xB9, 0xE6, 0x80, 0xC1, 0x53, 0xB5, 0xF1, 0xA4, 0xBF, 0x00, 0xC3,
+0xB1, 0xA4, 0x2B, 0x73, 0x6C, 0x7B, 0xCD, 0x8B, 0xAB, 0xC2, 0x98, 0xDE, 0x7C, 0xFF, 0xBC, 0xFF,
+0xAF, 0xA6, 0x95, 0xA6, 0x4A, 0xAB, 0x03, 0x59, 0x5E, 0x00, 0x59, 0x00, 0x51, 0x59, 0x51, 0x00,
+0x59, 0x5E, 0x65, 0x59, 0x00, 0x45, 0x6A, 0x01, 0xC1, 0xB9, 0xDE, 0x33, 0xAD, 0x91, 0xC1, 0x50,
+0x94, 0x4C, 0x73, 0xAE, 0xBE, 0xC0, 0x0E, 0x8C, 0x00, 0xC0, 0xB4, 0xBD, 0x63, 0xC3, 0x9C, 0xFF,
+0x3B, 0xFF, 0xB9, 0xEE, 0x37, 0xDE, 0x91, 0xC1, 0x99, 0xE6, 0x5B, 0xF7, 0x91, 0xAF, 0x81, 0xC5,
+0xAC, 0x6B, 0xA5, 0x29, 0xE6, 0x29, 0x85, 0x21, 0xAF, 0x6B, 0x7E, 0xE7, 0x90, 0xBF, 0xC5, 0x55,
+0x9D, 0xC6, 0x29, 0xEB, 0x4A, 0x5C, 0xDF, 0x9A, 0xC6, 0x2D, 0x5B, 0xA6, 0x9E, 0xC3, 0x68, 0x32,
+0x42, 0x3A, 0xA9, 0x94, 0xB0, 0xE6, 0xBB, 0xC1, 0xD5, 0xF6, 0xBA, 0xFF, 0xAF, 0x00, 0xCA, 0x37,
+0xFF, 0xB2, 0xF6, 0xAC, 0xDD, 0x89, 0xD5, 0xCC, 0xF6, 0x2E, 0xE7, 0xA7, 0x6C, 0x85, 0x3B, 0x86,
+0x4B, 0x50, 0xD5, 0xA0, 0xC0, 0x5D, 0x62, 0x5D, 0xE0, 0x0F, 0x62, 0x5D, 0x00, 0xC0, 0x41, 0xF0,
+0x70, 0xC3, 0xD0, 0xFC, 0x4B, 0xB4, 0xA8, 0x63, 0x47, 0x3B, 0x90, 0xC3, 0x26, 0x84, 0x8E, 0xEE,
+0xD1, 0xFE, 0xF9, 0xFF, 0x59, 0xC0, 0xFF, 0xF7, 0x01, 0xB1, 0xC0, 0x7B, 0xFF, 0xAC, 0xC1, 0xCA,
+0xAC, 0x2D, 0xDE, 0x4D, 0xC0, 0xE8, 0x5A, 0x66, 0xC6, 0xEF, 0x73, 0xFF, 0xFF, 0x19, 0xC6, 0x6E,
+0x6B, 0x77, 0xAD, 0xFC, 0xDE, 0x49, 0x42, 0xA5, 0x91, 0xC4, 0x2C, 0x5B, 0x1C, 0xDF, 0x7E, 0xE7,
+0xEC, 0x52, 0x04, 0x11, 0x66, 0xC4, 0x89, 0x4A, 0x54, 0xAD, 0x3C, 0xF7, 0x59, 0xDE, 0x55, 0xBD,
+0x00, 0x58, 0xC4, 0x71, 0x9C, 0x0F, 0x8C, 0xEB, 0x6A, 0x89, 0x62, 0xB2, 0xA4, 0xBE, 0xC4, 0x30,
+0x94, 0x54, 0xB5, 0x94, 0xC5, 0xD5, 0xCD, 0x98, 0xE6, 0x9E, 0xC1, 0x73, 0xB5, 0xD1, 0x9C, 0xBE,
+0xA6, 0xC1, 0x6F, 0x9C, 0x4B, 0x7B, 0x96, 0x7C, 0x64, 0xC0, 0xD9, 0xE6, 0x52, 0xC0, 0xFE, 0xFF,
+0xA5, 0x59, 0x96, 0x00, 0x59, 0x00, 0x51, 0xA9, 0xA6, 0x4A, 0x59, 0x00, 0xAF, 0x5E, 0x59, 0x00,
+0x65, 0x59, 0x4A, 0x45, 0x51, 0x59, 0x65, 0x00, 0x45, 0x65, 0x6A, 0x00, 0xC1, 0x98, 0xD6, 0xF2,
+0xA4, 0x96, 0x91, 0xC0, 0x0E, 0x8C, 0x92, 0xC1, 0x6C, 0x73, 0xAD, 0x7B, 0xA5, 0xC0, 0x12, 0xAD,
+0x52, 0xC1, 0x3A, 0xF7, 0xD9, 0xEE, 0xA5, 0x92, 0xC0, 0x16, 0xDE, 0x40, 0xC0, 0x1B, 0xF7, 0x80,
+0xBF, 0xC8, 0x7C, 0xF7, 0xAD, 0x73, 0x44, 0x21, 0x86, 0x21, 0xE7, 0x31, 0x14, 0x95, 0xBF, 0xEF,
+0xD4, 0x94, 0x9A, 0xCE, 0x00, 0xCC, 0x8A, 0x42, 0xC7, 0x29, 0xD7, 0xAD, 0x9F, 0xE7, 0x3E, 0xE7,
+0x9F, 0xEF, 0x3D, 0xD7, 0xC9, 0x4A, 0x22, 0x42, 0xEE, 0xC5, 0x52, 0xFF, 0xD2, 0xF6, 0x98, 0xFF,
+0x63, 0x6A, 0x00, 0xCB, 0x7A, 0xFF, 0xD9, 0xFF, 0xD2, 0xFE, 0x69, 0xD5, 0x2A, 0xEE, 0x6F, 0xFF,
+0x2A, 0x85, 0xA6, 0x43, 0x66, 0x53, 0x50, 0xDD, 0x80, 0xC0, 0x00, 0xF0, 0xBE, 0xA6, 0xE0, 0x10,
+0x62, 0x5D, 0x8E, 0xC9, 0xA1, 0xC8, 0x31, 0xFD, 0x0A, 0xAC, 0xC8, 0x63, 0x26, 0x33, 0x21, 0x12,
+0xE5, 0x7B, 0x8F, 0xE6, 0xF1, 0xFE, 0x76, 0xFF, 0x63, 0xC0, 0xDF, 0xF7, 0x00, 0xBE, 0xCA, 0x5D,
+0xEF, 0xFC, 0xFF, 0xD4, 0xEE, 0x6C, 0xC5, 0xF0, 0xEE, 0x4F, 0xD6, 0x66, 0x4A, 0xA6, 0x29, 0x49,
+0x42, 0x96, 0xAD, 0x9F, 0xEF, 0xA6, 0xC0, 0xBF, 0xF7, 0x91, 0xC3, 0xEC, 0x5A, 0x08, 0x3A, 0x54,
+0x9D, 0xFF, 0xF7, 0x96, 0xC4, 0x96, 0xA5, 0x08, 0x2A, 0xC3, 0x08, 0x03, 0x11, 0xE6, 0x39, 0x58,
+0xC2, 0x1B, 0xEF, 0x79, 0xE6, 0x55, 0xBD, 0x90, 0xC1, 0xB2, 0xA4, 0xCE, 0x83, 0x00, 0xC2, 0x07,
+0x4A, 0x89, 0x5A, 0xD2, 0xAC, 0x00, 0xC9, 0x2F, 0x8C, 0x90, 0x9C, 0x33, 0xB5, 0x94, 0xBD, 0x77,
+0xDE, 0xF9, 0xE6, 0xB4, 0xBD, 0xB0, 0x9C, 0xF1, 0xA4, 0x6F, 0x94, 0xBA, 0xC0, 0x0A, 0x73, 0x96,
+0xA5, 0xC1, 0xAD, 0x83, 0x98, 0xDE, 0x63, 0xA6, 0xA6, 0x96, 0x59, 0xAF, 0x5E, 0xC0, 0x7C, 0xF7,
+0x96, 0x45, 0x51, 0x02, 0x59, 0x00, 0x65, 0xAE, 0x51, 0x45, 0xAE, 0x5E, 0x65, 0x51, 0x00, 0x59,
+0x4A, 0x59, 0x6A, 0x59, 0xC3, 0x78, 0xD6, 0xF2, 0xA4, 0x70, 0x94, 0xB1, 0x9C, 0xA6, 0x55, 0x00,
+0xC0, 0xCD, 0x83, 0x95, 0x6D, 0xC0, 0x7B, 0xF7, 0xA1, 0xA6, 0xC1, 0xB8, 0xE6, 0x37, 0xDE, 0x91,
+0xC0, 0x99, 0xE6, 0xAE, 0xAF, 0xAE, 0xC5, 0x3B, 0xEF, 0x8D, 0x73, 0xC6, 0x31, 0x65, 0x21, 0xC7,
+0x29, 0xDC, 0xCE, 0xA6, 0xD0, 0xAC, 0x4A, 0x35, 0x9D, 0xBF, 0xEF, 0x31, 0x74, 0x66, 0x19, 0xEC,
+0x4A, 0x14, 0x95, 0x3E, 0xE7, 0xDF, 0xF7, 0x9E, 0xDF, 0x4B, 0x5B, 0x84, 0x52, 0x50, 0xDE, 0xF2,
+0xF6, 0x54, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0x86, 0xC0, 0xFF, 0xFF, 0x94, 0xC2, 0xDA, 0xFF, 0x75,
+0xFF, 0xCC, 0xDD, 0xB4, 0xC7, 0x0F, 0xFF, 0x8C, 0x95, 0x86, 0x43, 0x25, 0x4B, 0x0F, 0xD5, 0xA1,
+0xC8, 0x00, 0xF8, 0x60, 0xF8, 0x5D, 0xE0, 0x10, 0xAE, 0x5D, 0x8E, 0x6B, 0xC7, 0x31, 0xFD, 0x0A,
+0xAC, 0xC8, 0x63, 0x87, 0x3B, 0x21, 0x1A, 0xE3, 0x5A, 0xAC, 0xCD, 0x32, 0xFF, 0x57, 0xC0, 0xFA,
+0xFF, 0x63, 0x71, 0x00, 0xA4, 0x49, 0xC5, 0x10, 0xD6, 0xED, 0xCD, 0x52, 0xFF, 0x8D, 0xBD, 0x25,
+0x42, 0x08, 0x3A, 0x7A, 0xC5, 0x49, 0x42, 0x31, 0x84, 0x9B, 0xD6, 0xBF, 0xF7, 0x9A, 0xCE, 0xAA,
+0x4A, 0x00, 0xC4, 0x55, 0x9D, 0x18, 0xB6, 0x71, 0x7C, 0xAA, 0x42, 0x04, 0x09, 0xBE, 0xC5, 0x64,
+0x21, 0x27, 0x3A, 0x53, 0xAD, 0xFB, 0xEE, 0x99, 0xE6, 0x96, 0xC5, 0x80, 0xC5, 0xF2, 0xAC, 0x70,
+0x94, 0xCE, 0x83, 0xC6, 0x41, 0x68, 0x5A, 0xB1, 0xA4, 0x95, 0xC0, 0xEE, 0x83, 0x5D, 0xC3, 0xB4,
+0xC5, 0x16, 0xCE, 0xB9, 0xDE, 0x3A, 0xEF, 0x55, 0x76, 0x96, 0xC2, 0x2E, 0x8C, 0xCD, 0x83, 0xA9,
+0x62, 0xBF, 0xC5, 0x0A, 0x73, 0x4F, 0x94, 0xB9, 0xE6, 0xDD, 0xFF, 0x7C, 0xF7, 0xBD, 0xFF, 0x96,
+0x00, 0xC0, 0xDE, 0xFF, 0x59, 0x95, 0x45, 0x00, 0x59, 0x09, 0x5E, 0x65, 0x59, 0x00, 0x5E, 0x45,
+0x51, 0xC0, 0xFE, 0xFF, 0x65, 0xC2, 0xFA, 0xE6, 0x94, 0xB5, 0xB1, 0x9C, 0xA6, 0x91, 0x91, 0x99,
+0x6D, 0xC3, 0x4F, 0x8C, 0x16, 0xC6, 0x5A, 0xEF, 0xD9, 0xE6, 0xBE, 0x91, 0xC2, 0x37, 0xDE, 0xD6,
+0xCD, 0x78, 0xE6, 0x4C, 0xAF, 0xAF, 0xC2, 0x9D, 0xF7, 0x8D, 0x6B, 0x85, 0x29, 0x9F, 0xC4, 0x4D,
+0x53, 0xFF, 0xF7, 0xDC, 0xCE, 0x09, 0x32, 0xB3, 0x8C, 0x6E, 0xC0, 0x55, 0x95, 0x77, 0xCA, 0x08,
+0x2A, 0x2C, 0x5B, 0xF4, 0x9C, 0x9A, 0xC6, 0x5D, 0xD7, 0xA8, 0x42, 0x63, 0x52, 0x51, 0xDE, 0xF2,
+0xF6, 0x75, 0xFF, 0xFC, 0xFF, 0x83, 0x6E, 0x00, 0x53, 0x5C, 0xC6, 0xB7, 0xFF, 0x2E, 0xE6, 0xEB,
+0xED, 0xEF, 0xF6, 0x4B, 0x8D, 0x86, 0x43, 0x46, 0x53, 0x7F, 0xC2, 0xA1, 0xC8, 0x00, 0xF8, 0x40,
+0xF8, 0x5D, 0xE0, 0x10, 0x62, 0x5D, 0x8E, 0x6B, 0xC7, 0x31, 0xFD, 0x0A, 0xAC, 0xA8, 0x63, 0x47,
+0x43, 0x43, 0x22, 0x41, 0x42, 0x68, 0x9C, 0x8F, 0xEE, 0x7D, 0xC2, 0x95, 0xFF, 0xF8, 0xFF, 0xFC,
+0xFF, 0xA1, 0xA9, 0x6F, 0xC1, 0xB1, 0xEE, 0x32, 0xFF, 0x96, 0xC2, 0xA7, 0x83, 0x63, 0x31, 0xC7,
+0x31, 0x91, 0xA1, 0xC6, 0xC7, 0x39, 0x0C, 0x63, 0xAF, 0x73, 0x8A, 0x4A, 0x08, 0x3A, 0xA7, 0x29,
+0xAB, 0x42, 0x95, 0xC0, 0xE8, 0x29, 0xA9, 0xC0, 0x04, 0x09, 0x91, 0xC3, 0x43, 0x19, 0xE5, 0x39,
+0x13, 0xAD, 0xDA, 0xEE, 0x91, 0xC7, 0xB6, 0xCD, 0x54, 0xBD, 0xF2, 0xAC, 0x70, 0x9C, 0x4C, 0x73,
+0x64, 0x39, 0x68, 0x5A, 0xF1, 0xAC, 0x96, 0xC1, 0x4F, 0x94, 0x12, 0xAD, 0xBF, 0xC2, 0xD5, 0xC5,
+0x78, 0xD6, 0x5B, 0xEF, 0x00, 0xC0, 0xB9, 0xDE, 0x00, 0x75, 0xA1, 0xC0, 0x94, 0xBD, 0xBF, 0xC0,
+0xF6, 0xCD, 0x49, 0xC0, 0xDD, 0xFF, 0xAF, 0x5E, 0x91, 0x51, 0x00, 0xBE, 0x00, 0x51, 0x4A, 0x51,
+0x59, 0x05, 0x51, 0x59, 0xAF, 0x00, 0x59, 0x00, 0x65, 0x6A, 0x65, 0x59, 0x00, 0x5E, 0x6A, 0x51,
+0xC0, 0xFA, 0xE6, 0x75, 0x96, 0xBF, 0xC0, 0x17, 0xC6, 0xA5, 0xAE, 0xC3, 0x98, 0xD6, 0x9B, 0xF7,
+0xDC, 0xFF, 0x3A, 0xEF, 0xA1, 0x96, 0xC2, 0x57, 0xDE, 0xD6, 0xCD, 0x99, 0xDE, 0x5D, 0xC0, 0x3B,
+0xEF, 0x96, 0xCE, 0x9D, 0xF7, 0xAD, 0x6B, 0x85, 0x21, 0xC7, 0x21, 0xAF, 0x63, 0xBF, 0xDF, 0xD8,
+0xA5, 0x66, 0x19, 0x8F, 0x63, 0xFF, 0xEF, 0x18, 0xAE, 0xA9, 0x3A, 0x50, 0x74, 0xDA, 0xCE, 0xDF,
+0xF7, 0xBE, 0xC7, 0x1B, 0xCF, 0xC8, 0x4A, 0x02, 0x42, 0xCE, 0xC5, 0x33, 0xF7, 0x96, 0xFF, 0xFB,
+0xFF, 0xFE, 0xF7, 0x6E, 0x96, 0xB4, 0x5C, 0xC9, 0x75, 0xF7, 0xEC, 0xD5, 0xEA, 0xE5, 0x8D, 0xEE,
+0xE9, 0x7C, 0x65, 0x43, 0x46, 0x53, 0x0F, 0xD5, 0xA1, 0xC8, 0x00, 0xF8, 0x62, 0x96, 0x5D, 0xE0,
+0x0F, 0x62, 0x5D, 0x8E, 0x6B, 0x61, 0xC2, 0x0A, 0xAC, 0xA8, 0x6B, 0x06, 0x3B, 0x92, 0xC6, 0x43,
+0x3A, 0xE4, 0x62, 0xEA, 0xAC, 0xB0, 0xEE, 0x93, 0xFF, 0xD6, 0xFF, 0xF9, 0xFF, 0xA1, 0xA9, 0x63,
+0xC4, 0x53, 0xFF, 0xB1, 0xEE, 0x8A, 0xA4, 0x60, 0x39, 0xE5, 0x39, 0xAB, 0xBF, 0xAF, 0xC0, 0xC6,
+0x39, 0x91, 0xBF, 0x9A, 0xC3, 0x49, 0x42, 0xE8, 0x31, 0x29, 0x32, 0xA7, 0x21, 0x00, 0xC6, 0x28,
+0x2A, 0x45, 0x11, 0xC2, 0x00, 0x23, 0x19, 0xC5, 0x31, 0x33, 0xAD, 0xDA, 0xEE, 0x91, 0xC1, 0xD6,
+0xCD, 0x54, 0xBD, 0x96, 0xC6, 0x91, 0x9C, 0x4C, 0x73, 0xA5, 0x41, 0x88, 0x62, 0xB1, 0xAC, 0xF2,
+0xAC, 0x6F, 0x9C, 0x79, 0xC4, 0x94, 0xBD, 0x57, 0xD6, 0x98, 0xDE, 0x5B, 0xEF, 0xFE, 0xFF, 0xA5,
+0x6A, 0x01, 0xA6, 0x6A, 0x03, 0x5E, 0x92, 0x01, 0xBE, 0x03, 0x51, 0x00, 0x59, 0x5E, 0x65, 0x00,
+0x5E, 0x59, 0x00, 0x6A, 0x65, 0x59, 0x00, 0x6A, 0x00, 0x65, 0x6A, 0x5E, 0x59, 0x65, 0x6A, 0x65,
+0x00, 0xAF, 0x00, 0x65, 0xA6, 0x5E, 0xAE, 0x00, 0xA1, 0xC0, 0x3A, 0xEF, 0xA1, 0x00, 0x7D, 0xC0,
+0xF6, 0xCD, 0x49, 0xC1, 0x3C, 0xEF, 0x7D, 0xF7, 0x95, 0xAE, 0xC1, 0xCD, 0x6B, 0xA5, 0x21, 0x92,
+0xC9, 0x6A, 0x3A, 0xD4, 0x84, 0xAF, 0x63, 0x87, 0x21, 0x49, 0x3A, 0x34, 0x95, 0x50, 0x74, 0x47,
+0x32, 0xB1, 0x84, 0x7C, 0xE7, 0xA1, 0xC8, 0x99, 0xCE, 0x13, 0x95, 0xA8, 0x4A, 0xA1, 0x39, 0x8A,
+0x9C, 0x74, 0xFF, 0xB6, 0xFF, 0x78, 0xEF, 0xFD, 0xFF, 0x71, 0x00, 0xA9, 0xC3, 0xFB, 0xFF, 0x13,
+0xEF, 0x4D, 0xDE, 0xAC, 0xF6, 0x9F, 0xC5, 0x67, 0x64, 0x45, 0x33, 0x66, 0x53, 0x0F, 0xD5, 0xA1,
+0xD0, 0x00, 0xF8, 0x62, 0x5D, 0xE0, 0x10, 0x62, 0x5D, 0x8E, 0x6B, 0x61, 0xC2, 0x0A, 0xAC, 0xA8,
+0x6B, 0x48, 0x43, 0x91, 0xC6, 0x65, 0x32, 0x02, 0x32, 0x04, 0x63, 0x0A, 0xAD, 0xB0, 0xE6, 0x73,
+0xFF, 0x95, 0xFF, 0xAB, 0x68, 0xC5, 0x14, 0xF7, 0x10, 0xD6, 0x6A, 0x9C, 0x64, 0x5A, 0xA2, 0x39,
+0x26, 0x4A, 0xAF, 0xC0, 0xA8, 0x52, 0xA5, 0xA6, 0xC0, 0xC9, 0x5A, 0xA6, 0xC0, 0x48, 0x4A, 0x96,
+0xAF, 0xC1, 0x8A, 0x42, 0x29, 0x32, 0xA5, 0x96, 0xC2, 0x24, 0x11, 0xA2, 0x00, 0xE1, 0x10, 0x7B,
+0xC4, 0x94, 0xB5, 0x1B, 0xEF, 0x79, 0xE6, 0xB6, 0xC5, 0x13, 0xB5, 0x5B, 0xC2, 0x91, 0x9C, 0x8D,
+0x7B, 0x28, 0x52, 0xBE, 0xC5, 0x2F, 0x94, 0x12, 0xB5, 0xB0, 0xA4, 0xF1, 0xAC, 0xF6, 0xCD, 0xD9,
+0xE6, 0x96, 0xC1, 0x3B, 0xEF, 0xDD, 0xFF, 0x56, 0x5E, 0x00, 0xA2, 0x01, 0xC0, 0xDE, 0xFF, 0x00,
+0xA5, 0x5E, 0x00, 0x92, 0x03, 0x59, 0x01, 0x51, 0x59, 0x00, 0x5E, 0x65, 0x00, 0x5E, 0x59, 0x00,
+0x65, 0x5E, 0x51, 0x00, 0x65, 0xAE, 0x59, 0x65, 0x02, 0x59, 0x51, 0x59, 0x6A, 0x65, 0xAF, 0x6A,
+0x00, 0xA9, 0xA5, 0xC0, 0x7B, 0xF7, 0x91, 0xA1, 0xA6, 0xC0, 0x78, 0xDE, 0x4B, 0xC1, 0xB9, 0xE6,
+0x5C, 0xF7, 0x56, 0x92, 0x51, 0x53, 0xC1, 0xA5, 0x21, 0x44, 0x11, 0xAF, 0xC0, 0x49, 0x32, 0x66,
+0x5A, 0xC0, 0x49, 0x3A, 0xAE, 0x94, 0xC3, 0xE5, 0x29, 0x87, 0x42, 0xC9, 0x52, 0x68, 0x4A, 0xBE,
+0xC7, 0x48, 0x3A, 0xE5, 0x31, 0xA1, 0x39, 0x25, 0x6B, 0x50, 0xD6, 0x95, 0xFF, 0x97, 0xF7, 0xB9,
+0xF7, 0x57, 0x63, 0xA4, 0xC2, 0xB8, 0xFF, 0x32, 0xF7, 0x0F, 0xF7, 0xA8, 0xC6, 0x0A, 0xC6, 0xC4,
+0x4B, 0x25, 0x2B, 0x67, 0x4B, 0x0F, 0xD5, 0xA1, 0xD0, 0x00, 0xF8, 0x62, 0x5D, 0xE0, 0x10, 0x62,
+0x5D, 0x8E, 0xC0, 0xA1, 0xC8, 0x61, 0xC3, 0x0A, 0xAC, 0xA8, 0x6B, 0x68, 0x4B, 0xC7, 0x2A, 0x91,
+0xB5, 0xC5, 0x02, 0x32, 0x83, 0x4A, 0xC7, 0x7B, 0xA9, 0x9C, 0x0F, 0xCE, 0x8E, 0xBD, 0x00, 0xC5,
+0xAC, 0xA4, 0x47, 0x73, 0x02, 0x4A, 0xA2, 0x31, 0x45, 0x4A, 0xC7, 0x5A, 0xA6, 0xC0, 0x28, 0x6B,
+0x91, 0xC1, 0x86, 0x5A, 0xE7, 0x6A, 0x9B, 0xA7, 0xC0, 0x27, 0x42, 0x96, 0x97, 0x66, 0x73, 0x91,
+0xC1, 0x65, 0x19, 0xA1, 0x00, 0xA5, 0xC5, 0xA4, 0x29, 0x16, 0xC6, 0xFE, 0xFF, 0x5C, 0xFF, 0x59,
+0xD6, 0x34, 0xB5, 0x95, 0x81, 0xC4, 0x30, 0x8C, 0x0B, 0x6B, 0x48, 0x5A, 0x6C, 0x83, 0xD1, 0xAC,
+0x9A, 0x00, 0xC3, 0xD5, 0xC5, 0xB9, 0xDE, 0xFA, 0xDE, 0x7C, 0xEF, 0x6A, 0x95, 0xBA, 0x00, 0xA6,
+0x00, 0xA6, 0x5E, 0x6A, 0x5E, 0x6A, 0x00, 0xC0, 0x9D, 0xF7, 0x59, 0x00, 0x95, 0x51, 0x59, 0x5E,
+0x59, 0xAF, 0x02, 0x59, 0x01, 0x51, 0x00, 0x59, 0x00, 0x51, 0x00, 0x59, 0x5E, 0x59, 0x51, 0x5E,
+0x6A, 0x65, 0x51, 0xA5, 0x4A, 0x59, 0x65, 0x6A, 0x02, 0xA9, 0xA1, 0x91, 0xC0, 0xF9, 0xEE, 0x91,
+0xC0, 0x16, 0xD6, 0x41, 0xC2, 0xDA, 0xE6, 0x7C, 0xF7, 0x9E, 0xF7, 0xA5, 0x6A, 0xC1, 0x8C, 0x6B,
+0xA5, 0x21, 0x96, 0xAB, 0xC0, 0xE7, 0x29, 0xA6, 0xC2, 0x69, 0x42, 0xAA, 0x4A, 0xE6, 0x29, 0xBE,
+0x6D, 0x91, 0xC0, 0xE5, 0x39, 0xBE, 0xC1, 0x47, 0x52, 0xC5, 0x31, 0x43, 0xBD, 0xC3, 0xC1, 0x39,
+0xA6, 0x7B, 0x71, 0xD6, 0xF8, 0xFF, 0xA5, 0xAB, 0xAF, 0xA0, 0xAD, 0xC4, 0xB3, 0xFF, 0x50, 0xF7,
+0x2A, 0xCE, 0x02, 0x74, 0x64, 0x3B, 0x83, 0xC1, 0x87, 0x4B, 0x10, 0xD5, 0x6B, 0xC0, 0x00, 0xF8,
+0xAE, 0x5D, 0xE0, 0x10, 0x62, 0x5D, 0x8E, 0x6B, 0xC4, 0x31, 0xFD, 0x0A, 0xAC, 0xA8, 0x63, 0x68,
+0x43, 0x27, 0x2B, 0x96, 0xA6, 0xC3, 0x25, 0x1A, 0xA3, 0x19, 0xA2, 0x31, 0xC2, 0x41, 0x79, 0xA9,
+0xC0, 0x23, 0x4A, 0x96, 0xA7, 0xC1, 0x87, 0x4A, 0x09, 0x53, 0xBE, 0xC0, 0xC6, 0x5A, 0xA0, 0xC3,
+0x88, 0x7B, 0x2A, 0x94, 0xC9, 0x83, 0x27, 0x73, 0x92, 0xC0, 0x4A, 0x73, 0x4E, 0x9B, 0xC0, 0x49,
+0x42, 0xAF, 0xAE, 0xC0, 0x28, 0x3A, 0x90, 0xC3, 0x23, 0x19, 0xA0, 0x00, 0x83, 0x21, 0xF6, 0xBD,
+0x6A, 0xA6, 0xC1, 0x5C, 0xEF, 0x38, 0xCE, 0x9A, 0xC0, 0xF3, 0x9C, 0x91, 0xC3, 0x0F, 0x8C, 0x2B,
+0x6B, 0xAD, 0x83, 0xF2, 0xAC, 0xAE, 0xBF, 0xC2, 0x37, 0xCE, 0x1B, 0xE7, 0x7C, 0xEF, 0x5B, 0xBB,
+0x95, 0x6A, 0x56, 0x65, 0x6A, 0xA2, 0x6A, 0x00, 0x5E, 0xC0, 0xFF, 0xFF, 0x56, 0xBA, 0x01, 0x91,
+0x00, 0x59, 0x65, 0x59, 0x6A, 0x00, 0x65, 0x5E, 0x59, 0x03, 0x51, 0x59, 0x00, 0x5E, 0x59, 0x03,
+0x5E, 0x00, 0x59, 0x00, 0x65, 0x6A, 0x65, 0x01, 0x56, 0x5E, 0x63, 0xA1, 0xC0, 0x5A, 0xF7, 0xB6,
+0xC1, 0xB8, 0xE6, 0xF6, 0xD5, 0x9A, 0xC1, 0x1B, 0xEF, 0x9D, 0xFF, 0x65, 0x96, 0x6A, 0xC1, 0x6B,
+0x6B, 0xA5, 0x29, 0x9F, 0xC1, 0x08, 0x2A, 0x49, 0x32, 0x62, 0x76, 0xA5, 0x99, 0x00, 0xC1, 0xA7,
+0x4A, 0xE8, 0x5A, 0xBF, 0xBA, 0xC1, 0xA8, 0x62, 0xCA, 0x5A, 0x80, 0xA9, 0xC6, 0x61, 0x29, 0xE1,
+0x49, 0x07, 0x8C, 0x50, 0xE6, 0x12, 0xF7, 0x73, 0xFF, 0xD4, 0xFF, 0xA5, 0xA9, 0xC4, 0x10, 0xEF,
+0xEB, 0xC5, 0xA6, 0x8C, 0x01, 0x43, 0x44, 0x2B, 0xAB, 0xC3, 0xC8, 0x53, 0x10, 0xCD, 0x81, 0xC8,
+0x00, 0xF8, 0x04, 0xAE, 0x5D, 0xE0, 0x0D, 0x8E, 0xC4, 0xA1, 0xC8, 0x31, 0xFD, 0x0A, 0xA4, 0xC8,
+0x63, 0xA8, 0x4B, 0x8F, 0xC5, 0x68, 0x23, 0xC7, 0x12, 0x67, 0x1A, 0x68, 0x2A, 0x06, 0x32, 0x83,
+0x29, 0xA9, 0xC1, 0x65, 0x4A, 0x87, 0x52, 0x91, 0xC1, 0xEA, 0x5A, 0xEE, 0x7B, 0x95, 0xC0, 0xC7,
+0x52, 0xB4, 0xC2, 0x45, 0x73, 0xEF, 0xC5, 0xD6, 0xFF, 0x00, 0xC3, 0x51, 0xDE, 0xE9, 0x8B, 0xA6,
+0x62, 0xC8, 0x62, 0x4E, 0xC0, 0x48, 0x42, 0x9B, 0x00, 0xA9, 0x6A, 0xC1, 0x85, 0x21, 0xE2, 0x08,
+0x95, 0xC2, 0xCE, 0x73, 0xD2, 0x94, 0x71, 0x8C, 0x91, 0xC0, 0x6D, 0x6B, 0xAE, 0xC0, 0x07, 0x3A,
+0xBF, 0xC0, 0x89, 0x52, 0xA1, 0xC5, 0x0B, 0x6B, 0x90, 0x9C, 0xF1, 0xAC, 0x73, 0xB5, 0x99, 0xDE,
+0x5C, 0xEF, 0x51, 0xAE, 0x95, 0xA6, 0xC0, 0xDD, 0xFF, 0x56, 0xC1, 0x3B, 0xEF, 0xBD, 0xFF, 0x00,
+0xAF, 0x59, 0x56, 0xC0, 0xFF, 0xFF, 0x56, 0x59, 0x5E, 0x59, 0x91, 0x00, 0x59, 0x65, 0x59, 0x65,
+0x5E, 0x00, 0x59, 0x01, 0x65, 0x00, 0x59, 0x51, 0x56, 0xC0, 0xFE, 0xFF, 0x00, 0x59, 0x56, 0x65,
+0x00, 0xA6, 0x51, 0x00, 0x59, 0x65, 0x00, 0x60, 0x00, 0x6A, 0x65, 0x56, 0x59, 0x6A, 0x5E, 0xC3,
+0x5A, 0xF7, 0x9C, 0xFF, 0xD9, 0xEE, 0x16, 0xD6, 0xAF, 0xC0, 0x7D, 0xFF, 0x71, 0x02, 0xC1, 0x6C,
+0x63, 0xC6, 0x29, 0x00, 0xC1, 0x08, 0x32, 0x6A, 0x3A, 0xA9, 0x6E, 0xB5, 0xC0, 0xA8, 0x52, 0xA9,
+0xC2, 0x29, 0x6B, 0x69, 0x73, 0xC6, 0x62, 0x77, 0xAF, 0xC3, 0x08, 0x63, 0xA8, 0x5A, 0xE9, 0x5A,
+0x05, 0x42, 0xB8, 0x90, 0xC3, 0x04, 0x73, 0x0A, 0xB5, 0xED, 0xD5, 0xAF, 0xE6, 0xA5, 0xC3, 0x2C,
+0xCE, 0xC8, 0x9C, 0x43, 0x5B, 0x03, 0x43, 0x8F, 0xC0, 0x65, 0x23, 0xBB, 0xC3, 0xC9, 0x53, 0x10,
+0xD5, 0x81, 0xC8, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x41, 0xE8, 0xC1, 0xC0, 0x72, 0xFD, 0x6B, 0xAC,
+0xA7, 0x63, 0xA7, 0x4B, 0x8A, 0x83, 0xC1, 0xC7, 0x1A, 0x27, 0x1A, 0xB6, 0xA6, 0xB1, 0x00, 0xC0,
+0x07, 0x3A, 0xB6, 0xC0, 0x69, 0x4A, 0x56, 0xC1, 0xB1, 0x94, 0xCD, 0x83, 0x43, 0xC2, 0x42, 0x5A,
+0x8C, 0xBD, 0xD3, 0xFF, 0xAE, 0xA9, 0xC5, 0xF4, 0xFF, 0x70, 0xDE, 0x05, 0x73, 0x66, 0x5A, 0x88,
+0x5A, 0x48, 0x42, 0x5A, 0x6E, 0xAE, 0xA1, 0xBA, 0xC5, 0xA5, 0x29, 0xE2, 0x10, 0x44, 0x19, 0xE7,
+0x31, 0x86, 0x29, 0x24, 0x21, 0x96, 0xC1, 0xA2, 0x10, 0x00, 0x00, 0x01, 0xC2, 0x80, 0x10, 0xC9,
+0x62, 0xB0, 0xA4, 0xAF, 0xC2, 0x32, 0xB5, 0x16, 0xCE, 0xFB, 0xEE, 0x59, 0xA6, 0x59, 0x5E, 0xC0,
+0x7B, 0xF7, 0x96, 0x7E, 0x76, 0x00, 0xC0, 0x9C, 0xF7, 0x59, 0xAF, 0x01, 0x4A, 0x5E, 0xAF, 0x65,
+0x60, 0x65, 0x00, 0x95, 0x5E, 0x56, 0x4A, 0x00, 0x56, 0x5E, 0x65, 0x00, 0x6A, 0x56, 0x96, 0x56,
+0xAF, 0xA6, 0x65, 0xAF, 0x65, 0x60, 0x95, 0x00, 0x65, 0x00, 0x60, 0x00, 0x54, 0xC0, 0x3B, 0xEF,
+0xBE, 0x59, 0x00, 0x65, 0x6A, 0xC0, 0x9C, 0xFF, 0x7E, 0xC5, 0xF9, 0xEE, 0x98, 0xE6, 0x73, 0xBD,
+0xD2, 0xA4, 0x75, 0xB5, 0xD6, 0xB5, 0x00, 0x9A, 0xC3, 0x2C, 0x5B, 0x86, 0x21, 0xE8, 0x31, 0x6A,
+0x3A, 0xA6, 0x00, 0xBE, 0xA0, 0xC2, 0x68, 0x52, 0x4A, 0x7B, 0x27, 0x73, 0x49, 0xC1, 0x66, 0x7B,
+0x4C, 0xB5, 0x91, 0xC1, 0x87, 0x83, 0x06, 0x6B, 0x43, 0x82, 0x82, 0xC0, 0xE5, 0x39, 0xA0, 0xC1,
+0xE2, 0x41, 0xA3, 0x5A, 0xBE, 0xAE, 0x86, 0x86, 0x8F, 0xC2, 0x26, 0x2B, 0x87, 0x2B, 0xC6, 0x23,
+0xBF, 0xC3, 0xE8, 0x5B, 0xEF, 0xD4, 0xA2, 0xC8, 0x00, 0xF8, 0xE0, 0x14, 0xC4, 0x41, 0xE8, 0xC1,
+0xC0, 0x92, 0xFD, 0x8C, 0xAC, 0xC7, 0x63, 0x74, 0xC3, 0xA8, 0x43, 0x68, 0x2B, 0xE8, 0x22, 0x68,
+0x22, 0xA2, 0x00, 0xBB, 0xA1, 0xC2, 0x4A, 0x42, 0x8C, 0x52, 0x0D, 0x63, 0x9E, 0xC5, 0x54, 0xA5,
+0x6C, 0x7B, 0x86, 0x62, 0xA3, 0x6A, 0x6F, 0xDE, 0xB2, 0xFF, 0xAD, 0xC5, 0x6F, 0xF7, 0x91, 0xFF,
+0x32, 0xFF, 0xC8, 0x93, 0x45, 0x5A, 0x88, 0x5A, 0x87, 0xC1, 0x48, 0x32, 0x89, 0x3A, 0xBF, 0xA1,
+0x00, 0xC4, 0xA6, 0x31, 0x03, 0x19, 0x65, 0x21, 0xE7, 0x31, 0x86, 0x29, 0x96, 0xBA, 0xC1, 0x04,
+0x19, 0x20, 0x00, 0xA6, 0x00, 0xC2, 0x60, 0x10, 0xA8, 0x5A, 0x8F, 0x9C, 0xBF, 0xC4, 0xF1, 0xAC,
+0x58, 0xD6, 0xBA, 0xE6, 0x7C, 0xFF, 0xDE, 0xFF, 0xA9, 0x00, 0xC2, 0x5B, 0xF7, 0xB8, 0xDE, 0x57,
+0xD6, 0xAE, 0xC3, 0xB9, 0xDE, 0x1A, 0xEF, 0x7C, 0xF7, 0xDE, 0xFF, 0x00, 0x5E, 0x45, 0xC0, 0xBD,
+0xFF, 0x00, 0x51, 0x00, 0x65, 0xAF, 0x65, 0x5E, 0x00, 0x9A, 0x00, 0x5E, 0xAF, 0x01, 0x62, 0x95,
+0xA6, 0x5B, 0x6A, 0x65, 0x00, 0x6A, 0x65, 0x00, 0x60, 0x00, 0x65, 0x00, 0xA1, 0x91, 0xC0, 0xDA,
+0xE6, 0x90, 0xC0, 0xD9, 0xE6, 0x45, 0x59, 0x65, 0x6A, 0xC0, 0x9C, 0xF7, 0xA9, 0xC4, 0x39, 0xEF,
+0x56, 0xD6, 0xED, 0x8B, 0xC6, 0x41, 0x65, 0x31, 0x66, 0xAE, 0xC1, 0x69, 0x3A, 0xC7, 0x29, 0x95,
+0xC0, 0x08, 0x2A, 0xBF, 0xC0, 0x6A, 0x3A, 0xAF, 0xC7, 0x29, 0x3A, 0x69, 0x4A, 0xC9, 0x62, 0xA6,
+0x6A, 0x22, 0x5A, 0x86, 0x8B, 0x70, 0xDE, 0xD4, 0xFF, 0xA1, 0xC3, 0xD1, 0xEE, 0xAA, 0xAC, 0x07,
+0x73, 0xE9, 0x62, 0x41, 0xC0, 0xE7, 0x31, 0xA9, 0xB9, 0xA4, 0xAE, 0xAE, 0x9A, 0x8E, 0xC7, 0x84,
+0x1A, 0x26, 0x1B, 0xA8, 0x23, 0xE7, 0x1B, 0x07, 0x34, 0x08, 0x5C, 0xEF, 0xD4, 0xA2, 0xD0, 0x5D,
+0xE0, 0x14, 0x68, 0xC4, 0xC1, 0xC0, 0x92, 0xFD, 0x8C, 0xAC, 0xE8, 0x6B, 0x87, 0x4B, 0x9B, 0x87,
+0xC1, 0xE9, 0x22, 0x28, 0x1A, 0x91, 0xB6, 0xBF, 0xBF, 0xBA, 0xBB, 0xCE, 0x4A, 0x42, 0x2D, 0x5B,
+0x75, 0xA5, 0x2B, 0x73, 0x87, 0x62, 0x42, 0x62, 0x90, 0xEE, 0xF4, 0xFF, 0x91, 0xFF, 0x30, 0xF7,
+0xD3, 0xFF, 0x54, 0xFF, 0x67, 0x83, 0x25, 0x5A, 0xA9, 0x5A, 0x8B, 0xC0, 0x49, 0x3A, 0x73, 0xAF,
+0x6E, 0xA5, 0xA5, 0xC0, 0xA5, 0x29, 0xAF, 0x4E, 0x91, 0xAB, 0xBA, 0xC1, 0x45, 0x21, 0x41, 0x00,
+0xA5, 0xA6, 0xC2, 0x60, 0x10, 0xA8, 0x5A, 0xB0, 0x9C, 0xBA, 0xC1, 0xF1, 0xAC, 0x57, 0xD6, 0x7D,
+0xC0, 0x7C, 0xFF, 0x6A, 0x48, 0xC0, 0xD9, 0xE6, 0x69, 0xC0, 0x94, 0xBD, 0xAE, 0xBF, 0xC3, 0x37,
+0xCE, 0xB9, 0xDE, 0x3B, 0xEF, 0x9C, 0xFF, 0x48, 0x96, 0x4D, 0xAF, 0xAE, 0x92, 0x00, 0xC0, 0xDE,
+0xFF, 0xAF, 0x00, 0x5E, 0x03, 0x65, 0x00, 0x6A, 0x91, 0x51, 0x56, 0xAF, 0x6A, 0x00, 0x65, 0x01,
+0x6A, 0x01, 0x59, 0x91, 0xC0, 0xFA, 0xE6, 0x61, 0xC0, 0xD6, 0xC5, 0x95, 0x00, 0xC1, 0x78, 0xD6,
+0x1B, 0xEF, 0x45, 0x51, 0xC0, 0x3B, 0xEF, 0xAD, 0xA5, 0xC2, 0x77, 0xDE, 0xAD, 0x7B, 0x24, 0x29,
+0x86, 0xC4, 0x86, 0x29, 0x28, 0x32, 0xA6, 0x21, 0xE7, 0x29, 0x69, 0x3A, 0xAF, 0x95, 0x7F, 0xBF,
+0x6E, 0xB9, 0xC4, 0x2A, 0x6B, 0xC7, 0x6A, 0x63, 0x62, 0x4C, 0xBD, 0xF5, 0xFF, 0xA4, 0xAE, 0x6B,
+0xC2, 0x4F, 0xDE, 0x88, 0x83, 0xE8, 0x62, 0x93, 0xC0, 0xE8, 0x39, 0x9E, 0xBE, 0x95, 0xAE, 0x9D,
+0x95, 0x99, 0xC8, 0x85, 0x1A, 0x26, 0x23, 0xC8, 0x2B, 0x07, 0x24, 0x07, 0x34, 0x09, 0x5C, 0x0F,
+0xD5, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x20, 0xE0, 0xC1, 0xC0, 0x92, 0xFD, 0xAC, 0xB4,
+0x09, 0x6C, 0x88, 0x4B, 0x9B, 0xC1, 0x29, 0x2B, 0x88, 0x1A, 0xA2, 0xC0, 0x69, 0x2A, 0xBE, 0xA1,
+0xC0, 0xE7, 0x29, 0x5A, 0xBA, 0x96, 0xC7, 0x69, 0x3A, 0x91, 0x8C, 0x6D, 0x7B, 0xC8, 0x72, 0x02,
+0x5A, 0xCB, 0xB4, 0x74, 0xFF, 0xF4, 0xFF, 0x00, 0x6B, 0xC3, 0xAE, 0xCD, 0xA5, 0x6A, 0x26, 0x5A,
+0xCA, 0x62, 0x8B, 0x6E, 0x9A, 0xBF, 0xB5, 0xA6, 0xC0, 0x68, 0x42, 0x91, 0x62, 0x95, 0xC0, 0xA7,
+0x29, 0xBE, 0xA6, 0xC1, 0x24, 0x19, 0x61, 0x08, 0x91, 0xA6, 0xC3, 0x80, 0x10, 0xC9, 0x62, 0xF1,
+0xA4, 0x32, 0xB5, 0xA6, 0xC2, 0xD5, 0xCD, 0x98, 0xE6, 0x5B, 0xFF, 0xAF, 0xC1, 0x57, 0xDE, 0x12,
+0xB5, 0x9A, 0x02, 0xC3, 0x94, 0xBD, 0x78, 0xDE, 0x3B, 0xF7, 0x7C, 0xF7, 0xBA, 0x45, 0x00, 0xC1,
+0xBD, 0xFF, 0xFE, 0xFF, 0xA6, 0xA6, 0x65, 0x6A, 0x65, 0x56, 0x01, 0xA9, 0xA6, 0xAB, 0xAF, 0x6A,
+0x56, 0x02, 0x6A, 0x06, 0x4A, 0xC3, 0x1A, 0xEF, 0x57, 0xCE, 0x33, 0xAD, 0xB1, 0x9C, 0x91, 0xC0,
+0xEE, 0x83, 0x69, 0x61, 0xC1, 0x3C, 0xF7, 0xDE, 0xFF, 0x45, 0xA9, 0x95, 0xC2, 0x77, 0xDE, 0xAD,
+0x7B, 0x45, 0x31, 0x9F, 0xC1, 0x09, 0x32, 0xCB, 0x42, 0x91, 0xC0, 0x28, 0x2A, 0x57, 0x5C, 0x91,
+0x57, 0xC0, 0x4A, 0x3A, 0x6E, 0xC2, 0xAA, 0x52, 0x2A, 0x6B, 0xC6, 0x6A, 0xA4, 0xC0, 0xEE, 0xD5,
+0x64, 0xC7, 0x0F, 0xEF, 0x91, 0xFF, 0x30, 0xFF, 0x53, 0xFF, 0x4A, 0x9C, 0xA7, 0x62, 0xCA, 0x5A,
+0x08, 0x3A, 0x61, 0xAE, 0x57, 0x9E, 0xA9, 0x99, 0x95, 0xC8, 0x65, 0x12, 0x26, 0x23, 0xC7, 0x2B,
+0x27, 0x2C, 0x28, 0x3C, 0x09, 0x64, 0x0F, 0xD5, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC1, 0x20,
+0xE0, 0xC1, 0xC0, 0x77, 0xC0, 0xAC, 0xB4, 0x46, 0xC3, 0xCA, 0x53, 0x8A, 0x3B, 0x09, 0x23, 0xA8,
+0x1A, 0xB6, 0xB5, 0xB0, 0x95, 0xBB, 0xBF, 0xBF, 0x96, 0x90, 0xCC, 0x8C, 0x6B, 0xEE, 0x83, 0x88,
+0x62, 0x24, 0x62, 0x84, 0x72, 0xEB, 0xB4, 0x13, 0xF7, 0x73, 0xFF, 0xCE, 0xCD, 0x67, 0x8B, 0x24,
+0x5A, 0x67, 0x62, 0xEB, 0x62, 0x82, 0xC0, 0x29, 0x3A, 0xAF, 0xC0, 0x8A, 0x42, 0x00, 0xBA, 0x90,
+0x00, 0x9A, 0xA1, 0x96, 0xAB, 0x41, 0xC2, 0x04, 0x19, 0x82, 0x08, 0x20, 0x00, 0xA6, 0x5A, 0xC2,
+0xC9, 0x5A, 0x11, 0xAD, 0x52, 0xB5, 0x7E, 0xC2, 0x53, 0xBD, 0x98, 0xE6, 0xFA, 0xF6, 0x9A, 0xC1,
+0xB5, 0xCD, 0x50, 0x9C, 0x00, 0xC0, 0x90, 0x9C, 0xA6, 0x95, 0xC1, 0xD2, 0xAC, 0x17, 0xCE, 0x60,
+0xAE, 0xBF, 0xC0, 0x9D, 0xFF, 0x95, 0x54, 0xAE, 0x00, 0xAF, 0xAF, 0x00, 0x65, 0x59, 0xAE, 0x96,
+0xA5, 0x96, 0xBF, 0x65, 0x71, 0x65, 0x56, 0x01, 0x5E, 0xAF, 0x01, 0x5E, 0x59, 0xC0, 0xFD, 0xFF,
+0x5E, 0xC3, 0x3A, 0xEF, 0xD8, 0xDE, 0x15, 0xC6, 0x11, 0xA5, 0xAF, 0xC5, 0xB0, 0x94, 0x0A, 0x6B,
+0x4B, 0x73, 0x13, 0xAD, 0x9A, 0xDE, 0x5C, 0xF7, 0x95, 0xC0, 0x9B, 0xFF, 0x91, 0xC2, 0x77, 0xD6,
+0xCE, 0x83, 0xC7, 0x39, 0x97, 0xC0, 0xE9, 0x29, 0xAE, 0xC3, 0x4A, 0x2A, 0xE8, 0x21, 0x28, 0x2A,
+0x8A, 0x3A, 0x01, 0xBB, 0x75, 0xC0, 0xEB, 0x5A, 0xBD, 0xC0, 0xC7, 0x62, 0x6C, 0xC2, 0xAD, 0xCD,
+0xF5, 0xFF, 0x91, 0xFF, 0xAF, 0xA1, 0xC1, 0x73, 0xFF, 0x4A, 0xA4, 0x43, 0x64, 0xC0, 0x29, 0x42,
+0x59, 0x9A, 0x90, 0xC1, 0xE7, 0x19, 0x27, 0x1A, 0xA9, 0x99, 0xC0, 0x65, 0x12, 0x73, 0xC6, 0xC8,
+0x2B, 0x28, 0x2C, 0x28, 0x3C, 0x29, 0x64, 0xEF, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC7,
+0x41, 0xE8, 0xC1, 0xC0, 0x92, 0xFD, 0x8C, 0xAC, 0xE9, 0x63, 0xA9, 0x4B, 0x69, 0x33, 0x09, 0x2B,
+0xA0, 0xC4, 0x25, 0x2A, 0x02, 0x2A, 0xA3, 0x4A, 0x86, 0x6B, 0xA8, 0x73, 0x00, 0xA7, 0xC4, 0x08,
+0x5B, 0xC3, 0x31, 0x66, 0x42, 0x8C, 0x73, 0xA8, 0x62, 0xB0, 0xC0, 0x03, 0x62, 0x84, 0xC0, 0x05,
+0x73, 0xAE, 0xC1, 0x83, 0x62, 0xA5, 0x6A, 0x93, 0xC1, 0x88, 0x62, 0xAA, 0x5A, 0x82, 0xC0, 0x09,
+0x32, 0xA9, 0xAE, 0xB6, 0xC0, 0x49, 0x42, 0x5B, 0x00, 0x67, 0xA6, 0x5D, 0x00, 0x41, 0xC2, 0x24,
+0x19, 0xA2, 0x08, 0x20, 0x00, 0xA6, 0xC1, 0x60, 0x10, 0x88, 0x52, 0x76, 0xBE, 0xC4, 0x8F, 0x9C,
+0x32, 0xB5, 0xB8, 0xE6, 0x3B, 0xFF, 0xBC, 0xFF, 0x74, 0xC0, 0x37, 0xDE, 0x81, 0xC0, 0x13, 0xAD,
+0xA1, 0xC3, 0x71, 0x9C, 0xF3, 0xAC, 0x38, 0xD6, 0xDA, 0xEE, 0x9A, 0x74, 0xC0, 0xFE, 0xFF, 0x02,
+0xA2, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x6A, 0x01, 0xA5, 0x96, 0x00, 0x5E, 0x6A, 0x71, 0x6A, 0xA6,
+0x56, 0xA5, 0x56, 0x6A, 0x02, 0xA1, 0x5E, 0x00, 0xC0, 0x5B, 0xEF, 0xA5, 0x91, 0xC0, 0x56, 0xCE,
+0x52, 0xC5, 0xF9, 0xDE, 0x70, 0x94, 0xCD, 0x83, 0x34, 0xB5, 0x59, 0xD6, 0xFB, 0xEE, 0xAE, 0xC0,
+0x7A, 0xF7, 0x6A, 0xC1, 0x57, 0xD6, 0xEE, 0x7B, 0x5D, 0xAB, 0x9A, 0x85, 0x5C, 0xA5, 0xBE, 0x00,
+0x50, 0xC0, 0x48, 0x32, 0xBF, 0xC2, 0x07, 0x3A, 0x69, 0x4A, 0x0A, 0x6B, 0xBC, 0xC3, 0x63, 0x62,
+0xE7, 0x93, 0xF1, 0xF6, 0xB3, 0xFF, 0xA9, 0xA2, 0xC4, 0xAD, 0xD5, 0x05, 0x73, 0x87, 0x62, 0xCA,
+0x5A, 0x29, 0x3A, 0x57, 0x91, 0x94, 0xC1, 0xE6, 0x21, 0x26, 0x2A, 0x9E, 0x99, 0xC3, 0x85, 0x12,
+0x47, 0x23, 0xE8, 0x2B, 0x28, 0x34, 0x72, 0xC3, 0x09, 0x64, 0xEF, 0xD4, 0x81, 0xD0, 0x00, 0xF8,
+0xE0, 0x14, 0x68, 0xC4, 0xC1, 0xC0, 0x92, 0xFD, 0x8C, 0xAC, 0xC8, 0x63, 0x89, 0x43, 0x9A, 0xC6,
+0x07, 0x33, 0x64, 0x32, 0xA4, 0x4A, 0x07, 0x84, 0xED, 0xC5, 0x11, 0xF7, 0x73, 0xFF, 0xAB, 0xAB,
+0xC6, 0x92, 0xD6, 0x8B, 0x94, 0xE6, 0x5A, 0x29, 0x63, 0x6B, 0x7B, 0x26, 0x62, 0x87, 0x6A, 0x98,
+0x00, 0x99, 0xC3, 0xC6, 0x62, 0x08, 0x73, 0x26, 0x52, 0x68, 0x5A, 0x87, 0x81, 0x96, 0x66, 0xA5,
+0xA9, 0xC0, 0x48, 0x42, 0x9A, 0x00, 0xA6, 0x00, 0xAB, 0x5D, 0xC0, 0xA7, 0x29, 0x90, 0xC1, 0xA2,
+0x10, 0x20, 0x00, 0x40, 0xC8, 0x60, 0x08, 0x67, 0x52, 0xF1, 0xA4, 0x31, 0xAD, 0x8F, 0x9C, 0x12,
+0xB5, 0x16, 0xD6, 0x57, 0xDE, 0xB9, 0xE6, 0xA6, 0xC0, 0x1B, 0xF7, 0x54, 0xC2, 0xD6, 0xC5, 0xD3,
+0xAC, 0x71, 0x9C, 0xBF, 0xC1, 0x75, 0xB5, 0xB6, 0xBD, 0x6C, 0x48, 0xC0, 0x99, 0xDE, 0x00, 0xC1,
+0x3C, 0xF7, 0xDE, 0xFF, 0xAE, 0xA2, 0x01, 0x59, 0x6A, 0x00, 0x5E, 0x00, 0x65, 0x6A, 0x00, 0x71,
+0x65, 0x6A, 0x65, 0x95, 0x59, 0xC0, 0xFD, 0xFF, 0x00, 0x59, 0x91, 0xC1, 0x78, 0xD6, 0x17, 0xC6,
+0xBE, 0xC2, 0xD5, 0xBD, 0x16, 0xC6, 0x98, 0xD6, 0xA5, 0x6A, 0xC5, 0x5B, 0xEF, 0xB1, 0x9C, 0xEE,
+0x83, 0xD3, 0xA4, 0x55, 0xB5, 0x17, 0xCE, 0x4C, 0xC0, 0xBB, 0xFF, 0x00, 0xC2, 0xF9, 0xE6, 0x30,
+0x84, 0xE8, 0x39, 0x86, 0xAE, 0x95, 0xC0, 0x26, 0x32, 0xA1, 0xAE, 0x00, 0xA5, 0xBF, 0xAF, 0xC4,
+0xC4, 0x31, 0x06, 0x42, 0xC8, 0x5A, 0x09, 0x73, 0x24, 0x5A, 0xA8, 0xC6, 0x08, 0x9C, 0xAD, 0xCD,
+0x0E, 0xDE, 0x0B, 0xC5, 0x66, 0x8B, 0x44, 0x62, 0xA7, 0x62, 0x87, 0x53, 0xA9, 0x45, 0x94, 0xC0,
+0x23, 0x3A, 0xBF, 0x8A, 0x85, 0xC8, 0x64, 0x1A, 0x07, 0x1B, 0xC8, 0x23, 0x28, 0x2C, 0x08, 0x44,
+0x09, 0x64, 0xEF, 0xD4, 0x81, 0xC8, 0x00, 0xF8, 0xE0, 0x14, 0x68, 0xCB, 0xC1, 0xC0, 0x72, 0xFD,
+0x6B, 0xAC, 0xA8, 0x5B, 0x68, 0x3B, 0xA9, 0x3B, 0x06, 0x3B, 0x83, 0x42, 0x07, 0x84, 0xB0, 0xE6,
+0x92, 0xFF, 0xEF, 0xF6, 0xBB, 0xC2, 0x8F, 0xEE, 0x12, 0xF7, 0xB5, 0xFF, 0xAB, 0xC1, 0x4D, 0xAD,
+0x07, 0x63, 0xA7, 0xB3, 0xC1, 0x47, 0x5A, 0x2A, 0x73, 0x99, 0x95, 0xC1, 0x49, 0x6B, 0xA8, 0x5A,
+0xAB, 0xC0, 0x08, 0x4A, 0x9A, 0x55, 0xC1, 0x4A, 0x3A, 0xEB, 0x4A, 0x00, 0xB9, 0xC1, 0x4C, 0x63,
+0x89, 0x42, 0xA5, 0x96, 0x00, 0xAB, 0x91, 0xC0, 0x86, 0x29, 0x95, 0xC1, 0xA2, 0x10, 0x20, 0x00,
+0xA6, 0xC4, 0x60, 0x10, 0xA8, 0x52, 0x32, 0xAD, 0x73, 0xB5, 0xB0, 0xA4, 0x00, 0x91, 0xC7, 0x8C,
+0x7B, 0xEA, 0x6A, 0x69, 0x5A, 0x30, 0x94, 0x18, 0xCE, 0x51, 0x94, 0x6E, 0x7B, 0xEC, 0x62, 0x90,
+0xBF, 0x91, 0xC0, 0x07, 0x4A, 0xAF, 0xC4, 0xCA, 0x62, 0x48, 0x52, 0x50, 0x94, 0xB9, 0xDE, 0xDE,
+0xFF, 0xAE, 0x65, 0x6A, 0x00, 0xA5, 0xA6, 0x00, 0x65, 0x6A, 0x00, 0x65, 0x59, 0x65, 0x6A, 0x65,
+0x59, 0x5E, 0x6A, 0xA9, 0xC0, 0x9C, 0xF7, 0x69, 0xC1, 0x2C, 0x6B, 0x89, 0x5A, 0x00, 0x81, 0xC7,
+0xA9, 0x5A, 0xAD, 0x7B, 0x0E, 0x84, 0xF6, 0xC5, 0x54, 0xAD, 0xCA, 0x5A, 0xE7, 0x41, 0x6A, 0x5A,
+0x91, 0x5F, 0xC2, 0xEE, 0x8B, 0x56, 0xD6, 0xD8, 0xE6, 0x96, 0xC1, 0x2F, 0x84, 0xC7, 0x31, 0x85,
+0xCE, 0x08, 0x2A, 0x47, 0x32, 0xE2, 0x31, 0x63, 0x42, 0x0A, 0x7C, 0xD1, 0xB5, 0x32, 0xC6, 0x2F,
+0xA5, 0xA8, 0x73, 0x64, 0x4A, 0xE3, 0x41, 0x45, 0x4A, 0xE8, 0x6A, 0x29, 0x73, 0x85, 0x62, 0x90,
+0xC0, 0xA4, 0x6A, 0xAE, 0xC2, 0x42, 0x62, 0x84, 0x6A, 0x08, 0x73, 0x9B, 0xC0, 0x67, 0x4A, 0x79,
+0xA9, 0xC1, 0x63, 0x42, 0x66, 0x6B, 0xB9, 0x00, 0xC1, 0xE4, 0x5A, 0x83, 0x3A, 0x8A, 0xC7, 0x06,
+0x23, 0xA7, 0x23, 0x08, 0x34, 0x07, 0x44, 0xE8, 0x63, 0xCE, 0xD4, 0x81, 0xD0, 0x00, 0xF8, 0xE0,
+0x12, 0xAE, 0x5D, 0xCB, 0x41, 0xE8, 0xC1, 0xC0, 0xB2, 0xFD, 0x4B, 0xA4, 0xA7, 0x5B, 0x88, 0x3B,
+0xE5, 0x2A, 0x83, 0x32, 0x69, 0x8C, 0x8F, 0xDE, 0xF0, 0xFE, 0x2D, 0xE6, 0xAF, 0x92, 0xC0, 0x8C,
+0xCD, 0xAE, 0x00, 0xC6, 0x12, 0xF7, 0xB5, 0xFF, 0x10, 0xC6, 0x81, 0x31, 0x27, 0x4A, 0x49, 0x52,
+0xA9, 0x5A, 0x99, 0xC0, 0xE9, 0x5A, 0x00, 0xC1, 0x47, 0x4A, 0xC6, 0x39, 0x00, 0xAF, 0x82, 0xC1,
+0x6A, 0x42, 0xAE, 0x63, 0xA9, 0xC6, 0x2F, 0x7C, 0x16, 0xB6, 0x8C, 0x63, 0x89, 0x42, 0xE7, 0x31,
+0x48, 0x3A, 0x8A, 0x42, 0x91, 0xC0, 0xA6, 0x29, 0x91, 0xC0, 0x82, 0x08, 0x90, 0xA2, 0xC0, 0x60,
+0x08, 0x7F, 0xC9, 0xF1, 0xA4, 0x72, 0xB5, 0x8F, 0x9C, 0xCD, 0x83, 0x90, 0x9C, 0x06, 0x4A, 0xE2,
+0x28, 0x48, 0x52, 0xEB, 0x62, 0x4D, 0x73, 0x00, 0xAB, 0xC0, 0xE8, 0x49, 0x96, 0x99, 0xC0, 0x45,
+0x31, 0x81, 0xC0, 0xA2, 0x18, 0x91, 0x91, 0xC0, 0x24, 0x29, 0x4D, 0xC1, 0xBD, 0xFF, 0xFE, 0xFF,
+0x00, 0xC0, 0x9D, 0xFF, 0x6A, 0xA5, 0x6A, 0x00, 0x5E, 0x59, 0x6A, 0x00, 0x5E, 0xAB, 0x6A, 0x00,
+0xA9, 0x00, 0x5E, 0xA1, 0x96, 0xC0, 0x4C, 0x6B, 0x70, 0x92, 0xC0, 0xE3, 0x20, 0x96, 0xC1, 0x44,
+0x29, 0xAA, 0x5A, 0x64, 0xC4, 0x8D, 0x73, 0x0B, 0x63, 0x89, 0x52, 0x86, 0x39, 0xE4, 0x28, 0x95,
+0xBE, 0xC6, 0x27, 0x52, 0x93, 0xBD, 0x39, 0xEF, 0xB8, 0xD6, 0x6F, 0x8C, 0x27, 0x3A, 0xC6, 0x29,
+0xAD, 0xBC, 0xC2, 0xE7, 0x7B, 0x90, 0xD6, 0xF6, 0xFF, 0xA5, 0xAB, 0xAF, 0xA0, 0xC4, 0x91, 0xD6,
+0xC7, 0x7B, 0x01, 0x4A, 0xE3, 0x49, 0x6A, 0x73, 0xA1, 0x95, 0xA5, 0x00, 0x91, 0xC0, 0xE8, 0x6A,
+0x96, 0xC5, 0x67, 0x52, 0x82, 0x31, 0x23, 0x42, 0x0D, 0xA5, 0x70, 0xD6, 0x93, 0xFF, 0xA6, 0xA5,
+0xC4, 0xF2, 0xEE, 0x6C, 0xAD, 0x85, 0x5B, 0xA2, 0x22, 0x85, 0x2B, 0x9A, 0xC4, 0xA6, 0x3B, 0xE9,
+0x6B, 0xAE, 0xD4, 0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x12, 0x62, 0x5D, 0xC2, 0x41, 0xE8, 0xC1, 0xC0,
+0xB2, 0xFD, 0x73, 0xC5, 0xA7, 0x5B, 0x66, 0x3B, 0xC3, 0x22, 0x85, 0x5B, 0xEE, 0xC5, 0xB0, 0xEE,
+0xBE, 0xA7, 0xC4, 0x13, 0xFF, 0x76, 0xFF, 0xF4, 0xF6, 0x91, 0xEE, 0x4B, 0xC5, 0xA5, 0xC5, 0xB0,
+0xE6, 0x74, 0xF7, 0xC9, 0x7B, 0xA5, 0x39, 0x08, 0x42, 0x49, 0x4A, 0x9E, 0xC2, 0xA9, 0x4A, 0x27,
+0x3A, 0x85, 0x29, 0xAF, 0xBF, 0xAE, 0x7A, 0xAB, 0xC1, 0x28, 0x32, 0xEA, 0x4A, 0xA5, 0xC1, 0x84,
+0x21, 0x6C, 0x63, 0x43, 0xC0, 0x07, 0x32, 0x00, 0xAB, 0x91, 0x91, 0xA9, 0xC1, 0xA2, 0x08, 0x40,
+0x00, 0xA2, 0xC4, 0xA1, 0x10, 0xC8, 0x5A, 0xF1, 0xA4, 0x72, 0xB5, 0xB0, 0x9C, 0x91, 0xC4, 0x12,
+0xA5, 0xEA, 0x62, 0x27, 0x4A, 0x2C, 0x6B, 0x6D, 0x73, 0x92, 0xC1, 0xAB, 0x5A, 0x6E, 0x73, 0x7F,
+0x95, 0xC0, 0x4A, 0x4A, 0x91, 0xC0, 0xCB, 0x5A, 0x91, 0xC1, 0xC7, 0x39, 0xE3, 0x28, 0xAE, 0xC2,
+0x34, 0xB5, 0x1B, 0xEF, 0x9D, 0xFF, 0x59, 0x54, 0xC0, 0xFE, 0xFF, 0x02, 0x65, 0x00, 0x6A, 0x04,
+0xA5, 0xAE, 0x00, 0x5E, 0x45, 0xC3, 0xCF, 0x83, 0x86, 0x39, 0xE8, 0x41, 0x6A, 0x52, 0xA6, 0xC1,
+0xEC, 0x62, 0x8E, 0x73, 0x00, 0x91, 0xC0, 0xAE, 0x7B, 0x91, 0xC0, 0xCB, 0x62, 0xAB, 0xC4, 0x49,
+0x52, 0xA6, 0x41, 0xC9, 0x62, 0xB3, 0xBD, 0x19, 0xE7, 0x96, 0xC5, 0xB1, 0x94, 0x26, 0x3A, 0x63,
+0x21, 0x24, 0x3A, 0x09, 0x7C, 0x73, 0xF7, 0xBD, 0xC1, 0x32, 0xF7, 0xD1, 0xE6, 0x00, 0xAD, 0xC6,
+0x51, 0xF7, 0xF4, 0xFF, 0xF1, 0xE6, 0x69, 0x94, 0x43, 0x52, 0x86, 0x5A, 0xE9, 0x62, 0xAF, 0xA9,
+0xBF, 0xAB, 0xA5, 0xC6, 0x67, 0x52, 0x62, 0x31, 0xA5, 0x5A, 0xAF, 0xBD, 0x95, 0xFF, 0x72, 0xF7,
+0xAF, 0xEE, 0xBE, 0xA6, 0xC0, 0x31, 0xFF, 0x9F, 0xC3, 0xB0, 0xCE, 0xE8, 0x7C, 0x02, 0x2B, 0x64,
+0x2B, 0xBB, 0xC3, 0xC8, 0x6B, 0xAE, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x5D, 0xC8,
+0x41, 0xE8, 0xC1, 0xC0, 0xB2, 0xFD, 0x4B, 0xA4, 0xA7, 0x5B, 0x46, 0x3B, 0x61, 0x22, 0x07, 0x74,
+0xF2, 0xEE, 0xB5, 0xAB, 0xC1, 0x78, 0xFF, 0xBB, 0xFF, 0xAE, 0xC3, 0x7A, 0xFF, 0xB9, 0xFF, 0x14,
+0xF7, 0x2B, 0xC5, 0x90, 0xC3, 0x73, 0xFF, 0x10, 0xC6, 0xC5, 0x39, 0x49, 0x42, 0x91, 0xC1, 0xA7,
+0x29, 0xE7, 0x29, 0x00, 0xC9, 0x89, 0x3A, 0x8D, 0x63, 0x10, 0x74, 0x2C, 0x5B, 0x69, 0x3A, 0xE7,
+0x31, 0x44, 0x19, 0x27, 0x32, 0x0A, 0x53, 0x63, 0x21, 0x4B, 0x91, 0xC3, 0xEA, 0x4A, 0x89, 0x42,
+0x28, 0x32, 0xC7, 0x29, 0xA5, 0x91, 0xC0, 0x82, 0x08, 0x4A, 0x40, 0xC0, 0xE2, 0x18, 0x56, 0x76,
+0xC4, 0x52, 0xB5, 0xD0, 0xA4, 0x0E, 0x8C, 0xF2, 0xA4, 0x0F, 0x8C, 0x81, 0x00, 0xC0, 0x6D, 0x73,
+0xAF, 0xC3, 0x2D, 0x63, 0xAB, 0x5A, 0x2D, 0x6B, 0xAF, 0x7B, 0x96, 0x00, 0xC0, 0xF0, 0x7B, 0xA6,
+0xC1, 0x4D, 0x6B, 0xAA, 0x5A, 0x43, 0xC2, 0x33, 0xAD, 0x3B, 0xEF, 0xBD, 0xFF, 0xAE, 0x00, 0xAB,
+0xAE, 0x59, 0x92, 0x00, 0xAE, 0x59, 0x01, 0x45, 0x59, 0x6A, 0xA9, 0x5E, 0x63, 0xCB, 0x9C, 0xFF,
+0x1B, 0xE7, 0x31, 0x8C, 0xCC, 0x62, 0xB0, 0x7B, 0xED, 0x62, 0xA8, 0x39, 0xE8, 0x41, 0x6A, 0x52,
+0x2C, 0x6B, 0x6D, 0x73, 0x10, 0x84, 0x58, 0xC1, 0x8A, 0x5A, 0xEC, 0x6A, 0x95, 0xC3, 0x68, 0x5A,
+0xCD, 0x83, 0xD4, 0xC5, 0xF8, 0xE6, 0xAF, 0xC7, 0x11, 0x9D, 0x26, 0x42, 0x61, 0x21, 0x26, 0x5B,
+0x92, 0xD6, 0x93, 0xFF, 0xF1, 0xF6, 0x70, 0xDE, 0xBF, 0xAE, 0xC0, 0x2E, 0xD6, 0xA8, 0xC6, 0xEF,
+0xEE, 0xF4, 0xFF, 0xD1, 0xE6, 0x87, 0x7B, 0xE3, 0x41, 0x47, 0x4A, 0xA9, 0x52, 0xAF, 0xC1, 0x0B,
+0x5B, 0x28, 0x42, 0xA9, 0xC5, 0xC4, 0x39, 0xA1, 0x39, 0xED, 0xAC, 0xB5, 0xFF, 0x53, 0xFF, 0x4E,
+0xDE, 0x91, 0xBF, 0xC6, 0x8B, 0xD5, 0xCC, 0xD5, 0xAF, 0xEE, 0xB2, 0xFF, 0x0E, 0xDF, 0x23, 0x6C,
+0x64, 0x33, 0xA7, 0xC3, 0xA8, 0x63, 0xAE, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x5D,
+0xC8, 0x41, 0xE8, 0xC1, 0xC0, 0xB2, 0xFD, 0x4B, 0xA4, 0xA7, 0x5B, 0x66, 0x43, 0x41, 0x22, 0x06,
+0x7C, 0xF2, 0xEE, 0xA6, 0xC2, 0x35, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xA7, 0x94, 0xBC, 0xAC, 0xD3,
+0x10, 0xE6, 0x26, 0xA4, 0xAF, 0xE6, 0x13, 0xEF, 0x67, 0x52, 0xE8, 0x39, 0x86, 0x29, 0xCB, 0x4A,
+0xB2, 0x84, 0x18, 0xAE, 0x5C, 0xD7, 0xDE, 0xE7, 0xFF, 0xF7, 0x3C, 0xD7, 0x39, 0xBE, 0xB6, 0xAD,
+0x6D, 0x5B, 0xC6, 0x29, 0x0A, 0x53, 0xAC, 0x6B, 0x5C, 0xBF, 0x9B, 0x90, 0xC0, 0x8A, 0x42, 0x91,
+0xC3, 0xC7, 0x29, 0x65, 0x21, 0x82, 0x08, 0x20, 0x00, 0x00, 0xC7, 0x23, 0x21, 0x2A, 0x63, 0xF1,
+0x9C, 0x52, 0xAD, 0xF0, 0xA4, 0x0E, 0x84, 0x12, 0xA5, 0x94, 0xB5, 0xBF, 0x7D, 0xC0, 0x30, 0x8C,
+0xAE, 0x96, 0x70, 0xC0, 0xAA, 0x52, 0xA6, 0xC0, 0x6E, 0x6B, 0xBF, 0xC0, 0xCC, 0x5A, 0xAE, 0xC5,
+0x8E, 0x73, 0x0C, 0x6B, 0x65, 0x39, 0x91, 0x9C, 0xFA, 0xE6, 0x9C, 0xFF, 0x00, 0xA6, 0xC3, 0xFB,
+0xEE, 0xF7, 0xC5, 0x74, 0xB5, 0x13, 0xA5, 0xBA, 0xAF, 0xA9, 0x00, 0xAE, 0xBB, 0xC2, 0xD5, 0xC5,
+0xD9, 0xE6, 0xDC, 0xFF, 0x00, 0xC7, 0x7B, 0xF7, 0x1A, 0xEF, 0xBA, 0xE6, 0x92, 0x9C, 0xCC, 0x62,
+0x2E, 0x6B, 0x26, 0x29, 0x01, 0x00, 0xBE, 0x95, 0xC3, 0x82, 0x10, 0xC3, 0x20, 0x08, 0x4A, 0xAA,
+0x5A, 0x95, 0xC1, 0x2C, 0x6B, 0x8E, 0x7B, 0xBD, 0xC2, 0xF1, 0xAC, 0x15, 0xCE, 0x19, 0xE7, 0x00,
+0xC8, 0x52, 0xAD, 0x25, 0x42, 0xE2, 0x39, 0xEC, 0x9C, 0xD6, 0xFF, 0x50, 0xDE, 0xD2, 0xF6, 0x56,
+0xFF, 0x97, 0xFF, 0xAE, 0xC8, 0x13, 0xF7, 0x2D, 0xDE, 0xAA, 0xCD, 0x8E, 0xE6, 0xB4, 0xFF, 0x6E,
+0xB5, 0x24, 0x4A, 0xC5, 0x39, 0x07, 0x3A, 0xAF, 0xC1, 0x69, 0x3A, 0x08, 0x32, 0xA9, 0xC6, 0x82,
+0x31, 0x26, 0x73, 0xD3, 0xF6, 0x13, 0xFF, 0x70, 0xE6, 0xD2, 0xEE, 0xB6, 0xFF, 0x00, 0xCB, 0xB1,
+0xEE, 0xED, 0xD5, 0x69, 0xC5, 0x0A, 0xD6, 0x6E, 0xF7, 0x09, 0xB6, 0xC5, 0x43, 0x25, 0x33, 0x87,
+0x63, 0x8E, 0xD4, 0x82, 0xD0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x5D, 0xC1, 0x41, 0xE8, 0xC1, 0xC0,
+0x7C, 0xC8, 0x4B, 0xA4, 0xA7, 0x63, 0x46, 0x3B, 0x82, 0x2A, 0x06, 0x84, 0xB1, 0xE6, 0xF3, 0xF6,
+0x98, 0xFF, 0xFE, 0xFF, 0x97, 0x96, 0xCB, 0xFF, 0xF7, 0x9C, 0xEF, 0x9A, 0xFF, 0xF4, 0xFE, 0xEA,
+0xBC, 0x4D, 0xDE, 0xF1, 0xE6, 0x6A, 0x6B, 0x65, 0x29, 0xC7, 0x31, 0x96, 0xA5, 0xDF, 0xE7, 0x00,
+0x91, 0xC0, 0xDA, 0xC6, 0xA1, 0xC1, 0xFB, 0xD6, 0x5D, 0xDF, 0x6E, 0x5E, 0xC4, 0x6D, 0x63, 0xC5,
+0x29, 0x47, 0x3A, 0xE6, 0x29, 0x27, 0x32, 0xBF, 0xAE, 0xBB, 0x9A, 0xC3, 0xC7, 0x29, 0x24, 0x19,
+0x82, 0x00, 0x20, 0x00, 0xAE, 0xC8, 0x43, 0x21, 0x4A, 0x6B, 0xF1, 0xA4, 0x52, 0xAD, 0xD0, 0xA4,
+0xED, 0x83, 0x12, 0xAD, 0x98, 0xDE, 0xBD, 0xFF, 0xAE, 0x91, 0x59, 0xC4, 0x3C, 0xEF, 0x18, 0xC6,
+0x10, 0x84, 0x24, 0x29, 0x42, 0x08, 0xA9, 0x96, 0xC6, 0xE9, 0x41, 0x31, 0x8C, 0x8E, 0x7B, 0xA6,
+0x41, 0x30, 0x94, 0x58, 0xD6, 0xFA, 0xEE, 0x96, 0xC4, 0x78, 0xD6, 0x34, 0xB5, 0xAA, 0x5A, 0x08,
+0x4A, 0xA6, 0x39, 0xBE, 0xC0, 0x07, 0x42, 0x00, 0xA9, 0xBA, 0xC0, 0x85, 0x39, 0xBA, 0xC2, 0x6C,
+0x7B, 0x15, 0xCE, 0xF9, 0xE6, 0x91, 0x7D, 0xAB, 0xC4, 0x14, 0xAD, 0xD0, 0x83, 0x11, 0x8C, 0x87,
+0x39, 0x00, 0x00, 0x01, 0x74, 0xC2, 0x8D, 0x7B, 0x91, 0x9C, 0xD6, 0xBD, 0x00, 0xBA, 0x75, 0xBA,
+0xC0, 0xB8, 0xE6, 0x80, 0xC9, 0x9B, 0xF7, 0x19, 0xE7, 0x73, 0xB5, 0x04, 0x42, 0x84, 0x52, 0xB1,
+0xDE, 0x94, 0xFF, 0xD4, 0xEE, 0xB9, 0xFF, 0xFC, 0xFF, 0xA1, 0x00, 0xC7, 0x78, 0xFF, 0xD2, 0xEE,
+0x2E, 0xDE, 0xC7, 0xAC, 0x73, 0xFF, 0xB2, 0xDE, 0xE6, 0x62, 0xE5, 0x39, 0x87, 0x46, 0xC0, 0x08,
+0x2A, 0xBE, 0xA4, 0xC5, 0x82, 0x31, 0xED, 0xAC, 0x75, 0xFF, 0x30, 0xE6, 0x14, 0xF7, 0xF9, 0xFF,
+0xAB, 0x00, 0xA4, 0xCA, 0x54, 0xFF, 0xEC, 0xD5, 0xE5, 0xB4, 0xCA, 0xEE, 0x4E, 0xEF, 0x47, 0x5C,
+0x45, 0x33, 0x67, 0x63, 0x6D, 0xD4, 0x61, 0xD0, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x62,
+0x5D, 0xC0, 0x41, 0xE8, 0x6D, 0xC3, 0xB2, 0xFD, 0x4B, 0xA4, 0xA7, 0x63, 0xE5, 0x32, 0xA0, 0xC1,
+0x47, 0x8C, 0xD1, 0xEE, 0x4B, 0xC1, 0xB8, 0xFF, 0xFE, 0xFF, 0x9B, 0xC0, 0x9F, 0xE7, 0x6E, 0xA0,
+0xC8, 0xFB, 0xFF, 0x57, 0xFF, 0x0B, 0xC5, 0x2D, 0xD6, 0x12, 0xEF, 0xE7, 0x62, 0x44, 0x21, 0xEB,
+0x5A, 0x5D, 0xDF, 0x81, 0xC2, 0xCF, 0x63, 0xEB, 0x42, 0x89, 0x3A, 0x46, 0xC6, 0xAB, 0x4A, 0xEC,
+0x52, 0xD3, 0x8C, 0xFF, 0xEF, 0xBA, 0xC6, 0xEA, 0x4A, 0xA5, 0x21, 0x4C, 0x00, 0x97, 0x00, 0xBF,
+0x00, 0xC2, 0x86, 0x21, 0xE3, 0x10, 0x61, 0x00, 0xA5, 0x00, 0xC8, 0x43, 0x29, 0x4B, 0x6B, 0x11,
+0xA5, 0x52, 0xAD, 0x8F, 0x9C, 0x2E, 0x8C, 0x73, 0xB5, 0x3A, 0xEF, 0xFD, 0xFF, 0x00, 0xA1, 0xAF,
+0x91, 0xA6, 0xC2, 0xDA, 0xDE, 0x2C, 0x6B, 0xA2, 0x18, 0x40, 0x00, 0xC6, 0x4A, 0x52, 0x31, 0x8C,
+0x4D, 0x73, 0xE7, 0x49, 0xEF, 0x8B, 0x95, 0xBD, 0x37, 0xD6, 0x95, 0xC3, 0xB5, 0xBD, 0x2F, 0x8C,
+0xC6, 0x41, 0x65, 0x31, 0x91, 0xBF, 0xC0, 0xA6, 0x39, 0xAD, 0xA6, 0xA5, 0xC4, 0x03, 0x29, 0x40,
+0x10, 0xE6, 0x49, 0x11, 0xAD, 0x76, 0xD6, 0x91, 0xC0, 0xD5, 0xC5, 0xAB, 0xC0, 0x71, 0x94, 0x91,
+0xC2, 0x15, 0xAD, 0xAB, 0x5A, 0x00, 0x00, 0x00, 0xC2, 0x23, 0x29, 0xD1, 0x9C, 0xFA, 0xE6, 0x91,
+0xC5, 0x5B, 0xEF, 0x98, 0xD6, 0xB5, 0xBD, 0xD9, 0xE6, 0x7B, 0xF7, 0xF9, 0xE6, 0xA9, 0xC6, 0xFC,
+0xFF, 0x19, 0xE7, 0xB3, 0xBD, 0x04, 0x4A, 0xE5, 0x62, 0x73, 0xFF, 0xB1, 0xE6, 0x60, 0xC1, 0x9B,
+0xFF, 0xBD, 0xFF, 0xA2, 0xA9, 0xC1, 0x39, 0xFF, 0xF4, 0xF6, 0xBC, 0xC5, 0x29, 0xBD, 0xF0, 0xF6,
+0x13, 0xEF, 0x88, 0x73, 0x46, 0x42, 0xE7, 0x31, 0x97, 0xC1, 0x29, 0x32, 0xC6, 0x21, 0xBD, 0xC5,
+0x03, 0x42, 0x52, 0xDE, 0x13, 0xFF, 0x71, 0xE6, 0xF9, 0xFF, 0xFB, 0xFF, 0xA7, 0x91, 0xBD, 0xCA,
+0xD7, 0xFF, 0xD0, 0xEE, 0xA5, 0xAC, 0xC7, 0xD5, 0x2D, 0xEF, 0xC9, 0x74, 0x45, 0x3B, 0x67, 0x63,
+0x6D, 0xD4, 0x61, 0xC8, 0x00, 0xF8, 0x00, 0x62, 0x5D, 0xE0, 0x0F, 0x62, 0x5D, 0xCA, 0x41, 0xE8,
+0xC1, 0xC0, 0xB2, 0xFD, 0x4B, 0xA4, 0xA7, 0x63, 0xE5, 0x32, 0x83, 0x2A, 0x06, 0x7C, 0xB0, 0xE6,
+0x53, 0xFF, 0x96, 0xFF, 0x57, 0xC0, 0xFF, 0xFF, 0x00, 0x81, 0xC0, 0xFD, 0xF7, 0xB0, 0xCA, 0x74,
+0xEE, 0x0C, 0xC5, 0x8F, 0xE6, 0x12, 0xEF, 0x07, 0x63, 0x68, 0x4A, 0x30, 0x84, 0x9E, 0xEF, 0x38,
+0xBE, 0x8A, 0x3A, 0x07, 0x2A, 0xAB, 0xC0, 0x8A, 0x42, 0x91, 0xC6, 0x86, 0x21, 0x8B, 0x4A, 0x9B,
+0xC6, 0x1C, 0xD7, 0x6C, 0x5B, 0x27, 0x32, 0x68, 0x3A, 0xA5, 0x92, 0x00, 0xAB, 0x95, 0xC2, 0x65,
+0x21, 0x04, 0x11, 0x61, 0x00, 0x00, 0xB9, 0xC2, 0x43, 0x21, 0x4B, 0x6B, 0x32, 0xAD, 0xAE, 0xC4,
+0x4E, 0x8C, 0xD0, 0xA4, 0x16, 0xCE, 0xBC, 0xFF, 0xFD, 0xFF, 0xA5, 0x00, 0x63, 0x00, 0xC3, 0x1A,
+0xEF, 0x7C, 0xF7, 0xCE, 0x83, 0xC2, 0x18, 0x40, 0x00, 0xC2, 0xA7, 0x39, 0xAB, 0x5A, 0x65, 0x39,
+0xA6, 0xC2, 0xAD, 0x83, 0xD2, 0xA4, 0x74, 0xB5, 0xBE, 0x65, 0xC1, 0x2F, 0x8C, 0x44, 0x31, 0x96,
+0xA6, 0x00, 0x58, 0xC0, 0x64, 0x31, 0x95, 0xC6, 0xE2, 0x20, 0x23, 0x31, 0x60, 0x18, 0xE6, 0x49,
+0xF1, 0xA4, 0xF4, 0xC5, 0x92, 0xB5, 0xA2, 0xAB, 0xC3, 0xA9, 0x5A, 0x86, 0x39, 0x6A, 0x52, 0x08,
+0x42, 0x70, 0x80, 0xC9, 0xC1, 0x18, 0x2E, 0x84, 0xD5, 0xC5, 0x74, 0xB5, 0x37, 0xCE, 0xB4, 0xBD,
+0x12, 0xAD, 0xD8, 0xDE, 0xDC, 0xFF, 0x19, 0xEF, 0xA9, 0xC1, 0xBB, 0xFF, 0xF9, 0xE6, 0x7F, 0xC6,
+0x44, 0x52, 0xE4, 0x6A, 0x32, 0xFF, 0xB0, 0xEE, 0x78, 0xFF, 0x9C, 0xFF, 0xBE, 0xFF, 0x71, 0x00,
+0xC1, 0xBC, 0xFF, 0x56, 0xFF, 0xAC, 0xC5, 0x0D, 0xDE, 0x6E, 0xE6, 0x53, 0xF7, 0xC8, 0x7B, 0x04,
+0x3A, 0x07, 0x32, 0x9B, 0xAF, 0xAC, 0xC6, 0x45, 0x3A, 0x63, 0x4A, 0xB3, 0xE6, 0xD3, 0xF6, 0x36,
+0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0x71, 0x95, 0xB8, 0xC5, 0x98, 0xFF, 0x94, 0xFF, 0x89, 0xC5, 0xC8,
+0xD5, 0x4E, 0xEF, 0x0A, 0x7D, 0x7A, 0xC2, 0x67, 0x63, 0x8E, 0xD4, 0x61, 0xD0, 0x5D, 0x00, 0xAE,
+0x5D, 0xE0, 0x0F, 0x62, 0x5D, 0xC2, 0x41, 0xE8, 0xC2, 0xC0, 0xB3, 0xFD, 0x73, 0xC5, 0xA8, 0x5B,
+0x47, 0x3B, 0x22, 0x22, 0x64, 0x63, 0x6E, 0xD6, 0x31, 0xF7, 0x50, 0xC1, 0xD9, 0xFF, 0xFD, 0xFF,
+0xAB, 0xC0, 0x7C, 0xEF, 0x63, 0xC5, 0x58, 0xF7, 0xF1, 0xDD, 0x30, 0xE6, 0x73, 0xFF, 0x4C, 0xBD,
+0x25, 0x4A, 0x83, 0xC3, 0x0B, 0x5B, 0x79, 0xCE, 0xDF, 0xEF, 0xFC, 0xD6, 0x95, 0xC0, 0xD6, 0xAD,
+0xA6, 0xAF, 0xC4, 0x5A, 0xC6, 0xDC, 0xCE, 0xFF, 0xF7, 0x38, 0xB6, 0x08, 0x32, 0x80, 0xC0, 0x06,
+0x2A, 0x00, 0xAB, 0xBE, 0x00, 0x92, 0x91, 0xA1, 0xC0, 0x61, 0x00, 0xBA, 0xA9, 0xC2, 0x23, 0x21,
+0x4B, 0x6B, 0x53, 0xAD, 0xA5, 0xC0, 0x0D, 0x8C, 0x92, 0xC3, 0xF1, 0xAC, 0x56, 0xD6, 0xF9, 0xEE,
+0x7A, 0xFF, 0x57, 0xA6, 0xA1, 0x4D, 0x6A, 0xC1, 0x13, 0xAD, 0xCE, 0x83, 0x92, 0xC6, 0x69, 0x52,
+0xC7, 0x39, 0xA3, 0x18, 0xE4, 0x28, 0x08, 0x52, 0xB2, 0xA4, 0x54, 0xB5, 0xA9, 0x4A, 0x45, 0xC1,
+0x0F, 0x8C, 0x48, 0x52, 0x00, 0xA6, 0x95, 0x00, 0xAE, 0x91, 0xC1, 0x64, 0x31, 0xA1, 0x20, 0x96,
+0xC1, 0x88, 0x5A, 0x32, 0xB5, 0x72, 0xC0, 0x52, 0xB5, 0xAF, 0xBF, 0xC8, 0x6C, 0x73, 0x65, 0x31,
+0x49, 0x52, 0x50, 0x8C, 0xF3, 0xA4, 0x4F, 0x8C, 0xE9, 0x62, 0x90, 0x9C, 0xF2, 0xAC, 0xAE, 0xCE,
+0x36, 0xCE, 0xB4, 0xB5, 0x11, 0xA5, 0x97, 0xD6, 0x5A, 0xF7, 0x76, 0xD6, 0xD8, 0xE6, 0x5A, 0xEF,
+0xF9, 0xDE, 0x15, 0xC6, 0x85, 0x52, 0xE4, 0x6A, 0xF0, 0xF6, 0x52, 0xFF, 0xD8, 0xFF, 0x63, 0xA7,
+0x97, 0xC0, 0xFF, 0xFF, 0xA4, 0xC2, 0x77, 0xFF, 0x33, 0xFF, 0x0C, 0xDE, 0x9A, 0xC4, 0xB4, 0xFF,
+0xC8, 0x7B, 0x82, 0x29, 0xE6, 0x29, 0x09, 0x2A, 0x95, 0x50, 0xC7, 0xE4, 0x29, 0x22, 0x42, 0xB3,
+0xE6, 0x14, 0xF7, 0xB8, 0xFF, 0x9A, 0xFF, 0xDD, 0xFF, 0xDF, 0xF7, 0x71, 0x6A, 0xCA, 0x78, 0xF7,
+0xD5, 0xFF, 0xEB, 0xD5, 0xA7, 0xCD, 0xED, 0xE6, 0x0A, 0x75, 0x25, 0x33, 0x67, 0x63, 0xAE, 0xDC,
+0x82, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xCC, 0x41, 0xE8, 0xE2, 0xC0, 0xF4, 0xFD, 0x6B, 0xA4, 0x09,
+0x64, 0x27, 0x3B, 0x84, 0x2A, 0x81, 0x42, 0x87, 0x8C, 0x0F, 0xE7, 0x72, 0xFF, 0x54, 0xF7, 0xF9,
+0xFF, 0x7F, 0xC0, 0xFC, 0xFF, 0xA8, 0xCB, 0x55, 0xFF, 0xD1, 0xF6, 0x74, 0xFF, 0x0F, 0xE6, 0xC4,
+0x6A, 0xE5, 0x41, 0xC7, 0x31, 0x08, 0x42, 0xEC, 0x5A, 0xF4, 0x9C, 0x3C, 0xE7, 0xFF, 0xFF, 0x9A,
+0x02, 0xC6, 0x1D, 0xD7, 0x56, 0xA5, 0x2C, 0x53, 0xC6, 0x21, 0x27, 0x2A, 0xE9, 0x3A, 0xCD, 0x53,
+0xBE, 0xC1, 0x0A, 0x43, 0x47, 0x32, 0x92, 0xA1, 0xC0, 0x44, 0x19, 0xA1, 0xC4, 0x61, 0x08, 0x00,
+0x00, 0xE3, 0x20, 0x69, 0x52, 0x8D, 0x7B, 0xAF, 0xC0, 0xEB, 0x6A, 0xA9, 0xAE, 0xC5, 0x8B, 0x7B,
+0x8F, 0x9C, 0x73, 0xBD, 0xF4, 0xCD, 0x56, 0xD6, 0x98, 0xDE, 0x00, 0xBB, 0xC4, 0x5C, 0xF7, 0xFF,
+0xFF, 0x9D, 0xFF, 0x75, 0xB5, 0x0C, 0x63, 0x6B, 0xC4, 0x69, 0x5A, 0xAA, 0x6A, 0x6C, 0x7B, 0xEE,
+0x8B, 0x4F, 0x94, 0x90, 0xA6, 0xC3, 0x53, 0xB5, 0x95, 0xBD, 0x34, 0xB5, 0xD3, 0xA4, 0xA9, 0x00,
+0xC2, 0x50, 0x94, 0x90, 0x9C, 0x2F, 0x8C, 0x48, 0xC0, 0x89, 0x5A, 0x00, 0xC1, 0xCD, 0x83, 0x70,
+0x94, 0x99, 0x41, 0xAE, 0xC0, 0x94, 0xB5, 0xBF, 0xC1, 0x58, 0xCE, 0xFE, 0xFF, 0xA6, 0xA5, 0xC2,
+0x33, 0xB5, 0x70, 0x9C, 0x13, 0xBD, 0x95, 0x80, 0x85, 0xC0, 0x2E, 0x8C, 0x53, 0x7A, 0x58, 0x5D,
+0xC0, 0x32, 0xA5, 0x99, 0xC1, 0xEC, 0x7B, 0x85, 0x52, 0xA8, 0xC3, 0xD1, 0xEE, 0x32, 0xFF, 0xD7,
+0xFF, 0xFB, 0xFF, 0x6A, 0xA7, 0x00, 0x5E, 0xC0, 0x97, 0xFF, 0x78, 0xC5, 0x49, 0xBD, 0xB2, 0xFF,
+0xB1, 0xDE, 0x26, 0x63, 0xC4, 0x31, 0x08, 0x32, 0xA7, 0x00, 0xC5, 0x49, 0x32, 0x85, 0x21, 0xC2,
+0x39, 0x6F, 0xB5, 0xB6, 0xFF, 0x55, 0xFF, 0x4E, 0xC0, 0xFC, 0xFF, 0x71, 0x99, 0x63, 0x55, 0xC1,
+0x13, 0xEF, 0x4D, 0xE6, 0xBC, 0xC6, 0xEE, 0xE6, 0xE9, 0x6C, 0x86, 0x33, 0x47, 0x53, 0xCF, 0xDC,
+0xC3, 0xD8, 0x00, 0xF0, 0xBA, 0xE0, 0x13, 0x8F, 0xCC, 0xE2, 0xC0, 0x14, 0xFE, 0x6C, 0xA4, 0x09,
+0x64, 0x69, 0x43, 0xE6, 0x32, 0x41, 0x2A, 0x02, 0x53, 0x28, 0xA5, 0xCE, 0xE6, 0x92, 0xFF, 0xF6,
+0xFF, 0xD8, 0xFF, 0xA2, 0xAD, 0xA8, 0xC4, 0x53, 0xFF, 0x2F, 0xDE, 0x09, 0x9C, 0x24, 0x5A, 0x28,
+0x42, 0x82, 0xA6, 0xBE, 0xC3, 0x8A, 0x52, 0x6E, 0x6B, 0xF0, 0x7B, 0x72, 0x84, 0xBF, 0xC8, 0x31,
+0x7C, 0xD0, 0x73, 0x0D, 0x5B, 0x29, 0x3A, 0x45, 0x19, 0xA6, 0x21, 0x2B, 0x4B, 0x4F, 0x64, 0xD0,
+0x74, 0xAB, 0xC2, 0xED, 0x63, 0xC9, 0x3A, 0xC5, 0x21, 0x6B, 0xBA, 0x91, 0xC0, 0xA2, 0x10, 0xA1,
+0xC2, 0xA2, 0x18, 0x25, 0x29, 0x86, 0x31, 0xA1, 0xA9, 0xC0, 0xA5, 0x41, 0x91, 0xAE, 0xC4, 0xE5,
+0x49, 0xA8, 0x62, 0x2A, 0x73, 0x8C, 0x83, 0xCD, 0x8B, 0x96, 0xC0, 0xEE, 0x8B, 0x92, 0xC2, 0xEF,
+0x8B, 0x30, 0x8C, 0x8E, 0x7B, 0x91, 0x5B, 0xC0, 0x08, 0x52, 0x90, 0x90, 0xC0, 0x06, 0x4A, 0x45,
+0xC0, 0x26, 0x4A, 0x00, 0xC4, 0x6B, 0x73, 0x70, 0x94, 0x0F, 0x8C, 0x71, 0x94, 0x6D, 0x73, 0xBA,
+0x00, 0x7C, 0xC2, 0x4F, 0x94, 0xCE, 0x83, 0x48, 0x52, 0x91, 0xC1, 0x47, 0x52, 0xC9, 0x5A, 0xBF,
+0xC6, 0x68, 0x52, 0x0A, 0x63, 0xD2, 0x9C, 0x12, 0xA5, 0x54, 0xB5, 0x17, 0xCE, 0xB5, 0xC5, 0x00,
+0xC1, 0x2F, 0x94, 0xCE, 0x8B, 0xA6, 0xA9, 0xC2, 0x4B, 0x73, 0xE9, 0x62, 0x84, 0x31, 0xA6, 0xCD,
+0xE2, 0x20, 0xA5, 0x39, 0xE6, 0x39, 0x88, 0x4A, 0x09, 0x53, 0xA7, 0x42, 0x03, 0x32, 0x42, 0x42,
+0x50, 0xD6, 0xB4, 0xFF, 0x33, 0xEF, 0x97, 0xF7, 0xFB, 0xFF, 0xFD, 0xFF, 0xA6, 0xA4, 0xC1, 0x55,
+0xFF, 0x11, 0xF7, 0x98, 0xC4, 0xB3, 0xFF, 0x8D, 0xB5, 0x64, 0x42, 0xA4, 0x29, 0x69, 0x42, 0xA7,
+0xC0, 0xE9, 0x31, 0xAE, 0xAC, 0xC6, 0xA3, 0x31, 0x0A, 0x8C, 0x14, 0xEF, 0x96, 0xFF, 0xD8, 0xFF,
+0xFA, 0xFF, 0xDC, 0xFF, 0xAE, 0x00, 0xCA, 0xF9, 0xFF, 0x33, 0xF7, 0xCF, 0xF6, 0xAC, 0xF6, 0x8C,
+0xD6, 0x06, 0x44, 0x05, 0x23, 0x06, 0x4B, 0x8E, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC2,
+0x20, 0xE0, 0xE2, 0xC0, 0x14, 0xFE, 0x7F, 0xC1, 0xE9, 0x63, 0x07, 0x33, 0xA6, 0xC6, 0x43, 0x2A,
+0x00, 0x2A, 0x01, 0x53, 0xC6, 0x9C, 0x6C, 0xD6, 0x50, 0xF7, 0x52, 0xF7, 0xBB, 0x92, 0x95, 0xC4,
+0x10, 0xCE, 0xE9, 0x8B, 0xC7, 0x6A, 0x8C, 0x7B, 0x69, 0x42, 0x92, 0xA5, 0xA6, 0xA9, 0x5D, 0xC2,
+0x48, 0x3A, 0xAA, 0x4A, 0x86, 0x29, 0xAF, 0xBF, 0x00, 0xAE, 0xAE, 0xC3, 0x89, 0x3A, 0xCE, 0x63,
+0xD1, 0x7C, 0x4E, 0x64, 0xA6, 0xBF, 0xC5, 0x8C, 0x5B, 0x06, 0x2A, 0x64, 0x19, 0xA5, 0x29, 0x03,
+0x19, 0x81, 0x10, 0xAB, 0x91, 0xBF, 0x54, 0xA5, 0xC1, 0x65, 0x31, 0x69, 0x5A, 0x90, 0xC0, 0xA5,
+0x41, 0xA5, 0xC2, 0xE5, 0x49, 0x88, 0x62, 0xE9, 0x6A, 0xAB, 0x92, 0xAF, 0xC2, 0xE3, 0x28, 0x41,
+0x10, 0x82, 0x18, 0xBE, 0xC2, 0x48, 0x52, 0x4C, 0x73, 0xA1, 0x20, 0x00, 0x91, 0xC2, 0x05, 0x4A,
+0x09, 0x6B, 0x42, 0x31, 0x48, 0xC2, 0xA0, 0x18, 0xE2, 0x20, 0xA5, 0x39, 0x40, 0xC1, 0xC2, 0x20,
+0x40, 0x10, 0xBF, 0xC0, 0x85, 0x39, 0x40, 0x7F, 0x48, 0xC0, 0x60, 0x10, 0x78, 0xC2, 0x89, 0x52,
+0x4C, 0x6B, 0xE3, 0x20, 0x94, 0x44, 0xC1, 0xC6, 0x39, 0xAA, 0x5A, 0xA9, 0x53, 0xC0, 0x0B, 0x6B,
+0xA1, 0x00, 0xC1, 0x69, 0x62, 0xEB, 0x72, 0x9D, 0x9E, 0xC1, 0xE2, 0x18, 0x80, 0x10, 0x48, 0xC3,
+0x23, 0x29, 0xA1, 0x10, 0x63, 0x21, 0x47, 0x32, 0x99, 0xC3, 0x03, 0x2A, 0x43, 0x3A, 0x8E, 0xAD,
+0x94, 0xF7, 0xAD, 0xC2, 0xF5, 0xFF, 0xF8, 0xFF, 0xDA, 0xFF, 0x00, 0xA9, 0xC7, 0xD6, 0xFF, 0xB3,
+0xFF, 0xF4, 0xFF, 0x6F, 0xD6, 0xA7, 0x73, 0xE3, 0x31, 0x06, 0x32, 0x8A, 0x42, 0xA6, 0xC0, 0xE8,
+0x31, 0x9E, 0xB9, 0xC4, 0x82, 0x31, 0xA5, 0x5A, 0xAF, 0xC5, 0x96, 0xFF, 0xD7, 0xFF, 0xA6, 0xC0,
+0xFA, 0xFF, 0x00, 0xA9, 0xC1, 0x95, 0xFF, 0x32, 0xFF, 0xA8, 0xC7, 0x6B, 0xE6, 0x68, 0xA5, 0x63,
+0x2B, 0xE4, 0x1A, 0x26, 0x53, 0x8E, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D, 0x00,
+0xC6, 0x20, 0xE0, 0xE2, 0xC0, 0x35, 0xFE, 0x6C, 0xA4, 0xE9, 0x5B, 0x48, 0x3B, 0xE8, 0x2A, 0xA0,
+0xB0, 0xCC, 0x21, 0x32, 0x80, 0x4A, 0x84, 0x73, 0x87, 0x9C, 0x4B, 0xB5, 0xAD, 0xC5, 0x0C, 0xAD,
+0x09, 0x8C, 0x06, 0x63, 0xA2, 0x31, 0x64, 0x29, 0xCA, 0x52, 0x28, 0x3A, 0x96, 0x00, 0x62, 0xBA,
+0xAF, 0x99, 0x62, 0xC1, 0x8A, 0x4A, 0xF0, 0x7B, 0x91, 0xC1, 0x29, 0x42, 0xA7, 0x29, 0xBE, 0xC3,
+0xAA, 0x42, 0x70, 0x7C, 0xCD, 0x5B, 0x67, 0x2A, 0xBA, 0xC6, 0xCD, 0x63, 0x2F, 0x74, 0xA9, 0x42,
+0x85, 0x29, 0xC6, 0x31, 0x44, 0x21, 0xC2, 0x18, 0xAF, 0x91, 0xBB, 0x68, 0x00, 0xC1, 0xCB, 0x62,
+0xEF, 0x8B, 0x91, 0x90, 0x95, 0xC1, 0x8C, 0x7B, 0xEE, 0x8B, 0x00, 0x91, 0x77, 0x63, 0xC2, 0xC3,
+0x20, 0x21, 0x08, 0x61, 0x18, 0x00, 0xC2, 0xCA, 0x62, 0x30, 0x94, 0xE2, 0x20, 0xA5, 0xC4, 0x20,
+0x08, 0x46, 0x52, 0xCC, 0x7B, 0xC4, 0x39, 0x60, 0x10, 0xBE, 0x9A, 0xC3, 0x48, 0x4A, 0xD2, 0xA4,
+0x03, 0x21, 0x81, 0x10, 0x00, 0xC3, 0x64, 0x31, 0x70, 0x94, 0x4C, 0x73, 0x20, 0x10, 0x00, 0xC2,
+0x61, 0x10, 0x0B, 0x63, 0x71, 0x94, 0x49, 0x61, 0x48, 0xC0, 0x85, 0x39, 0x40, 0xC0, 0xEB, 0x62,
+0x00, 0xBE, 0xAB, 0xA5, 0x91, 0xC4, 0x2C, 0x73, 0xEE, 0x83, 0xB1, 0x94, 0x84, 0x29, 0x03, 0x19,
+0x75, 0xC4, 0x85, 0x31, 0x27, 0x3A, 0xA9, 0x42, 0x0A, 0x43, 0x46, 0x22, 0xA4, 0xC5, 0xA5, 0x32,
+0xAB, 0x84, 0x70, 0xC6, 0x93, 0xF7, 0xD4, 0xFF, 0xD6, 0xFF, 0xAB, 0xAF, 0x00, 0xC0, 0xD5, 0xFF,
+0xA1, 0xC4, 0x2F, 0xCE, 0xE7, 0x83, 0x03, 0x3A, 0xE5, 0x31, 0x68, 0x42, 0x9B, 0x91, 0xA6, 0xAF,
+0xC5, 0xA5, 0x21, 0xE4, 0x31, 0x03, 0x42, 0x67, 0x73, 0x10, 0xCE, 0x76, 0xFF, 0x6D, 0xC1, 0x55,
+0xFF, 0xB6, 0xFF, 0x6D, 0x55, 0xA4, 0xC8, 0xEF, 0xE6, 0x27, 0xA5, 0x41, 0x53, 0x64, 0x2B, 0x66,
+0x2B, 0xA8, 0x5B, 0x8E, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D, 0x00, 0x59, 0xC3,
+0xE2, 0xC0, 0x35, 0xFE, 0x6C, 0xA4, 0xE9, 0x5B, 0x8B, 0xC5, 0x08, 0x23, 0xA7, 0x22, 0xC8, 0x32,
+0x46, 0x32, 0xC3, 0x29, 0xC3, 0x39, 0x7D, 0xA1, 0xC0, 0xE4, 0x49, 0x95, 0x96, 0xC1, 0x05, 0x3A,
+0x47, 0x3A, 0xA7, 0x5A, 0x00, 0x5F, 0x00, 0xA5, 0x5B, 0xAF, 0x62, 0x91, 0xC1, 0xF4, 0x94, 0xFF,
+0xFF, 0x92, 0xC3, 0xB3, 0x94, 0xCB, 0x52, 0xE7, 0x39, 0x89, 0x42, 0x4C, 0xC1, 0xC9, 0x42, 0x43,
+0x11, 0xAF, 0xC3, 0x4B, 0x53, 0xEE, 0x6B, 0xC9, 0x4A, 0xE6, 0x31, 0x5B, 0x51, 0xC0, 0x65, 0x29,
+0xBE, 0x91, 0xC0, 0x86, 0x31, 0x91, 0x91, 0xC1, 0x2C, 0x6B, 0x14, 0xAD, 0xBE, 0xC0, 0x75, 0xBD,
+0xAE, 0xC0, 0xD6, 0xC5, 0xBF, 0x74, 0xC4, 0x13, 0xAD, 0x55, 0xB5, 0xB3, 0xA4, 0xA7, 0x41, 0x25,
+0x29, 0xA5, 0xC0, 0xA2, 0x18, 0x78, 0xC1, 0xF2, 0xA4, 0xA5, 0x39, 0x91, 0xC3, 0x80, 0x10, 0xA8,
+0x5A, 0x2E, 0x8C, 0x67, 0x52, 0x65, 0x00, 0xC2, 0xC2, 0x18, 0x0B, 0x63, 0x75, 0xB5, 0x64, 0xA5,
+0x49, 0x71, 0xC2, 0x34, 0xAD, 0x8E, 0x7B, 0xE3, 0x20, 0x53, 0x44, 0xC2, 0xAE, 0x7B, 0x54, 0xAD,
+0x86, 0x31, 0x95, 0x41, 0xC1, 0xAA, 0x5A, 0x13, 0xA5, 0xA1, 0xAF, 0x78, 0xAB, 0x91, 0x78, 0x7D,
+0xC3, 0x95, 0xB5, 0x17, 0xBE, 0xE6, 0x39, 0x23, 0x19, 0x46, 0xAF, 0xC0, 0xCA, 0x4A, 0x8E, 0x80,
+0xC9, 0xE5, 0x09, 0x87, 0x22, 0xCA, 0x4B, 0x6B, 0x6C, 0xCB, 0x84, 0x70, 0xCE, 0xB0, 0xDE, 0x54,
+0xEF, 0xB6, 0xF7, 0xF8, 0xFF, 0x68, 0xC6, 0xD2, 0xDE, 0xEF, 0xC5, 0x66, 0x73, 0x23, 0x42, 0xA3,
+0x29, 0x27, 0x3A, 0x69, 0x3A, 0x91, 0x01, 0xAF, 0xC8, 0xE7, 0x21, 0x68, 0x3A, 0xC4, 0x31, 0x81,
+0x29, 0x47, 0x6B, 0x6D, 0xB5, 0xD3, 0xE6, 0x13, 0xF7, 0x74, 0xFF, 0xA9, 0xCA, 0x12, 0xF7, 0x6F,
+0xD6, 0x4A, 0xA5, 0xC4, 0x63, 0xC0, 0x2A, 0x85, 0x23, 0xA7, 0x33, 0xC9, 0x63, 0x8E, 0xD4, 0x82,
+0xD0, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x12, 0xC6, 0x20, 0xE0, 0xE2, 0xC0, 0x14, 0xFE, 0x6C, 0xA4,
+0x09, 0x5C, 0xC9, 0x43, 0x48, 0x2B, 0xA3, 0xC1, 0xA9, 0x2A, 0x27, 0x22, 0xB1, 0x47, 0xA2, 0xBE,
+0xA6, 0x9E, 0x00, 0xAF, 0x73, 0xAB, 0xC0, 0xE8, 0x29, 0x5F, 0x73, 0x6C, 0xA6, 0x95, 0xA5, 0x5B,
+0xAB, 0xC1, 0x96, 0xAD, 0xFF, 0xFF, 0x00, 0xC6, 0x19, 0xC6, 0x34, 0xA5, 0x10, 0x84, 0x6C, 0x63,
+0xCE, 0x6B, 0x90, 0x7C, 0xCD, 0x63, 0xBA, 0xC0, 0x91, 0x84, 0xA9, 0x7F, 0xC3, 0x0B, 0x5B, 0x8D,
+0x6B, 0x07, 0x3A, 0x86, 0x31, 0x7D, 0x78, 0xC0, 0xE7, 0x39, 0x7D, 0xC2, 0x44, 0x21, 0x49, 0x4A,
+0xCF, 0x83, 0xBF, 0xAE, 0xC1, 0x51, 0x94, 0x91, 0x9C, 0xAF, 0x91, 0x91, 0xAF, 0xC1, 0x8F, 0x7B,
+0x66, 0x31, 0xA6, 0x80, 0xC3, 0xA2, 0x18, 0x2C, 0x6B, 0x33, 0xAD, 0x85, 0x31, 0xA9, 0xC3, 0x23,
+0x21, 0xEA, 0x5A, 0xEE, 0x7B, 0x68, 0x52, 0x71, 0xC0, 0x24, 0x29, 0x70, 0xC4, 0x6D, 0x73, 0x96,
+0xB5, 0xC7, 0x41, 0x45, 0x31, 0xE3, 0x20, 0x45, 0xC0, 0x17, 0xC6, 0x60, 0xC0, 0x24, 0x31, 0x44,
+0x00, 0xC2, 0xEF, 0x83, 0x75, 0xB5, 0xE7, 0x39, 0x69, 0xA5, 0xC3, 0xCA, 0x52, 0x13, 0xA5, 0x54,
+0xAD, 0xD7, 0xBD, 0xBE, 0xBF, 0x00, 0xA6, 0x80, 0x9E, 0xAE, 0xC1, 0x48, 0x3A, 0x85, 0x21, 0xBF,
+0x81, 0xC0, 0xE7, 0x21, 0x9E, 0x9E, 0xC9, 0xA8, 0x1A, 0xED, 0x43, 0xEF, 0x64, 0x0B, 0x54, 0xE6,
+0x3A, 0xA3, 0x4A, 0xC4, 0x5A, 0x45, 0x63, 0x87, 0x73, 0xE8, 0x7B, 0x96, 0xC3, 0xE5, 0x5A, 0x03,
+0x42, 0xA2, 0x31, 0xC5, 0x31, 0x56, 0x9F, 0x96, 0x5F, 0xAE, 0x00, 0x9B, 0xA5, 0xC1, 0x69, 0x32,
+0x06, 0x2A, 0xA4, 0xC4, 0x24, 0x3A, 0x83, 0x4A, 0xC7, 0x7B, 0x6C, 0xB5, 0xAD, 0xC5, 0x91, 0xCA,
+0xA9, 0x9C, 0xA5, 0x6B, 0xE2, 0x42, 0xE2, 0x2A, 0x64, 0x2B, 0x86, 0x23, 0xC7, 0x33, 0xA9, 0x63,
+0x4D, 0xCC, 0x81, 0xD0, 0x00, 0xF8, 0xAE, 0x00, 0x5D, 0xE0, 0x11, 0x8F, 0x79, 0xC3, 0x14, 0xFE,
+0x6C, 0xA4, 0x09, 0x5C, 0xC9, 0x3B, 0x9B, 0xA2, 0xC1, 0xC8, 0x22, 0x06, 0x1A, 0xB6, 0xC0, 0x08,
+0x32, 0xA6, 0x91, 0x00, 0x55, 0x9D, 0x48, 0xC1, 0x48, 0x2A, 0xAA, 0x42, 0xAF, 0xC0, 0x48, 0x32,
+0x5C, 0xC1, 0x68, 0x32, 0x4B, 0x53, 0xAE, 0xC0, 0xA9, 0x42, 0xA6, 0xC5, 0xCA, 0x4A, 0x30, 0x7C,
+0x6E, 0x6B, 0x28, 0x42, 0xC7, 0x39, 0x49, 0x4A, 0x00, 0x56, 0x90, 0xC0, 0x88, 0x42, 0x00, 0xBF,
+0xAE, 0xC0, 0x68, 0x42, 0x56, 0x00, 0xC2, 0x69, 0x4A, 0x07, 0x42, 0xA6, 0x31, 0x95, 0xA6, 0xAF,
+0x00, 0x95, 0x6E, 0xA2, 0xA2, 0xA9, 0x58, 0x00, 0xAE, 0x64, 0xAF, 0xC0, 0xC8, 0x39, 0x90, 0xC1,
+0xE4, 0x20, 0x87, 0x31, 0x70, 0xBD, 0xC1, 0x8D, 0x73, 0x13, 0xA5, 0x56, 0x7D, 0xC1, 0x44, 0x21,
+0xE6, 0x39, 0x65, 0x78, 0x01, 0xC2, 0xA3, 0x18, 0x6B, 0x52, 0x11, 0x84, 0x53, 0xC1, 0x46, 0x29,
+0xC4, 0x18, 0x73, 0xC1, 0xB3, 0x94, 0x69, 0x52, 0x58, 0x00, 0x71, 0xC3, 0x71, 0x8C, 0x54, 0xAD,
+0xC6, 0x31, 0xE3, 0x18, 0x5A, 0x7D, 0xC2, 0xEB, 0x5A, 0x2C, 0x63, 0x6D, 0x6B, 0xA5, 0x92, 0x75,
+0xC0, 0xCF, 0x7B, 0x95, 0x81, 0xAE, 0xC0, 0xC6, 0x29, 0x9A, 0xBF, 0x9A, 0x99, 0xC7, 0x27, 0x1A,
+0xCA, 0x22, 0x4F, 0x4C, 0xB0, 0x54, 0x2E, 0x4C, 0xE9, 0x2A, 0xA3, 0x11, 0xC4, 0x31, 0xBA, 0x99,
+0xA9, 0x6D, 0xC0, 0x04, 0x32, 0xB6, 0x93, 0x7A, 0xC0, 0x08, 0x3A, 0x9F, 0x96, 0xAE, 0xBE, 0xA9,
+0xAE, 0x9B, 0x68, 0x00, 0x64, 0xC0, 0x88, 0x3A, 0x90, 0xC0, 0xA2, 0x21, 0xB8, 0xC2, 0x40, 0x21,
+0xE0, 0x39, 0x41, 0x42, 0x96, 0x8E, 0x9F, 0xC1, 0x04, 0x23, 0x08, 0x34, 0x81, 0xC4, 0xC8, 0x3B,
+0xA8, 0x63, 0x4D, 0xCC, 0x81, 0xD0, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x11, 0xC5, 0x41, 0xE8,
+0xE2, 0xC0, 0xF4, 0xFD, 0x6C, 0xA4, 0x29, 0x64, 0xA8, 0x3B, 0x97, 0x91, 0xC1, 0xC8, 0x22, 0x47,
+0x22, 0xA7, 0xB2, 0x92, 0x00, 0xBE, 0x52, 0xC2, 0x28, 0x2A, 0x69, 0x32, 0xA9, 0x3A, 0xA2, 0x5C,
+0xC1, 0x89, 0x32, 0x07, 0x22, 0x7D, 0xC3, 0xB0, 0x7C, 0x73, 0x95, 0x6F, 0x7C, 0xEE, 0x6B, 0xBA,
+0xC0, 0x95, 0xAD, 0x61, 0xC2, 0x25, 0x29, 0x86, 0x39, 0xE7, 0x41, 0x95, 0x65, 0xA9, 0xC1, 0x64,
+0x21, 0xA5, 0x29, 0x42, 0x73, 0x76, 0xC0, 0xE6, 0x39, 0x42, 0xC1, 0x65, 0x29, 0xE7, 0x39, 0x91,
+0x5A, 0x91, 0xBF, 0xC0, 0x86, 0x29, 0x42, 0x75, 0xC0, 0xE8, 0x39, 0xA1, 0x00, 0x4C, 0x47, 0x69,
+0xAB, 0x7D, 0xAB, 0x70, 0x44, 0xC2, 0x08, 0x3A, 0x45, 0x29, 0xE3, 0x18, 0x42, 0xC0, 0x07, 0x3A,
+0x65, 0x42, 0x69, 0x70, 0xA1, 0x00, 0x47, 0xAB, 0x5F, 0x96, 0xC2, 0x47, 0x31, 0xC4, 0x20, 0x67,
+0x31, 0x70, 0xC0, 0xE4, 0x20, 0x47, 0x70, 0x64, 0x00, 0x91, 0x61, 0xC2, 0x4C, 0x63, 0x44, 0x19,
+0x86, 0x29, 0xAE, 0x95, 0xC0, 0xE7, 0x31, 0x5D, 0x51, 0x7A, 0xC1, 0x04, 0x19, 0x45, 0x21, 0x00,
+0x75, 0xC1, 0x24, 0x19, 0x65, 0x19, 0x96, 0xC0, 0x85, 0x19, 0xAF, 0xAE, 0xC0, 0x68, 0x2A, 0x9F,
+0xC3, 0x6C, 0x33, 0xF1, 0x64, 0x0E, 0x44, 0xA9, 0x1A, 0x4F, 0xB6, 0xC0, 0xA7, 0x29, 0x51, 0xC0,
+0x27, 0x3A, 0x95, 0x96, 0x4C, 0xC0, 0x28, 0x3A, 0xA7, 0xAE, 0x96, 0x81, 0xC1, 0x09, 0x2A, 0x6A,
+0x32, 0x95, 0xA1, 0xC1, 0x69, 0x3A, 0xAA, 0x3A, 0x5C, 0x77, 0xA9, 0x79, 0xC2, 0x06, 0x22, 0x87,
+0x32, 0xE3, 0x21, 0xA5, 0xC0, 0x23, 0x32, 0x92, 0x60, 0xC9, 0x64, 0x22, 0xE5, 0x22, 0x46, 0x1B,
+0xA7, 0x23, 0x08, 0x2C, 0x08, 0x44, 0xC9, 0x63, 0x6E, 0xCC, 0xA2, 0xD0, 0x00, 0xF8, 0x00, 0xAE,
+0x5D, 0xE0, 0x11, 0xC5, 0x61, 0xE8, 0xA1, 0xB8, 0x35, 0xFE, 0x8C, 0xA4, 0xE9, 0x5B, 0xA9, 0x3B,
+0x81, 0xA7, 0xA1, 0xC1, 0x47, 0x1A, 0xE7, 0x19, 0x57, 0xA6, 0x00, 0x57, 0x90, 0xC1, 0x27, 0x2A,
+0x89, 0x3A, 0xAF, 0xBF, 0x78, 0x81, 0xA9, 0xC1, 0x4B, 0x4B, 0xC9, 0x3A, 0x46, 0xCB, 0x6F, 0x74,
+0x33, 0x95, 0xEE, 0x73, 0x1B, 0xE7, 0x6D, 0x73, 0x86, 0x39, 0x08, 0x4A, 0xEB, 0x62, 0x4C, 0x6B,
+0xA9, 0x52, 0x47, 0x42, 0xC6, 0x39, 0x76, 0x56, 0x01, 0xBA, 0xC0, 0xA6, 0x39, 0x51, 0x45, 0xC5,
+0x24, 0x21, 0x85, 0x29, 0x6D, 0x63, 0x49, 0x42, 0x65, 0x21, 0x28, 0x3A, 0x7A, 0xC0, 0xC7, 0x39,
+0x92, 0x00, 0xAD, 0xA6, 0x95, 0x96, 0x55, 0xC0, 0x86, 0x29, 0xA6, 0x75, 0x58, 0x95, 0x7D, 0xC2,
+0x23, 0x19, 0x64, 0x21, 0xE7, 0x31, 0x71, 0x49, 0xA6, 0x58, 0x44, 0x7F, 0xBA, 0xC0, 0x25, 0x29,
+0xBF, 0xAE, 0x01, 0x78, 0x01, 0x69, 0x4C, 0x51, 0xC0, 0x04, 0x19, 0x49, 0xC0, 0xCA, 0x4A, 0x62,
+0xAE, 0x00, 0x96, 0x62, 0xC0, 0x69, 0x3A, 0xA6, 0x90, 0x49, 0x4E, 0x49, 0x62, 0x96, 0xC0, 0xA6,
+0x21, 0x7C, 0xAF, 0xC2, 0x48, 0x32, 0x0B, 0x43, 0xAD, 0x4B, 0xAE, 0xC0, 0x6F, 0x5C, 0x81, 0xC4,
+0xC9, 0x22, 0x27, 0x12, 0x48, 0x22, 0xE8, 0x21, 0xE9, 0x31, 0xA6, 0x99, 0x95, 0x48, 0xC0, 0x49,
+0x32, 0x92, 0xBB, 0xC0, 0x4B, 0x3A, 0x81, 0x4F, 0xC0, 0xAA, 0x32, 0xA1, 0x91, 0xC0, 0xEB, 0x4A,
+0x6B, 0x64, 0xC0, 0x8A, 0x3A, 0xA9, 0x6B, 0x5C, 0x99, 0xC2, 0x68, 0x2A, 0xC8, 0x32, 0x47, 0x2A,
+0xA9, 0x92, 0xA9, 0xC0, 0x46, 0x1A, 0x98, 0xC1, 0xE5, 0x1A, 0x08, 0x34, 0xAF, 0xC4, 0x29, 0x44,
+0xE9, 0x6B, 0x6E, 0xCC, 0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC4, 0x41, 0xE8, 0xC1, 0xC0, 0x55,
+0xFE, 0xAC, 0xA4, 0xE9, 0x5B, 0x8B, 0xC3, 0x89, 0x33, 0x29, 0x2B, 0x88, 0x22, 0x06, 0x1A, 0xBB,
+0xC0, 0x28, 0x32, 0x4E, 0x95, 0x00, 0xC1, 0x06, 0x2A, 0x68, 0x3A, 0x81, 0xC2, 0x89, 0x3A, 0x4D,
+0x5B, 0xAA, 0x42, 0x80, 0xC0, 0xC5, 0x19, 0x5A, 0xAE, 0xC8, 0x05, 0x1A, 0x6B, 0x53, 0xCD, 0x63,
+0x0B, 0x53, 0xCE, 0x73, 0x04, 0x29, 0xA3, 0x20, 0xE8, 0x41, 0x8A, 0x5A, 0x99, 0x00, 0xC0, 0x0B,
+0x63, 0x91, 0xC0, 0x48, 0x4A, 0x41, 0xAF, 0xC0, 0xEB, 0x5A, 0x69, 0xC0, 0x69, 0x52, 0x41, 0xC1,
+0xE7, 0x41, 0x65, 0x29, 0x51, 0xC2, 0xEF, 0x7B, 0x8E, 0x6B, 0xCA, 0x52, 0x81, 0xC0, 0xA6, 0x29,
+0x44, 0xAE, 0x01, 0x90, 0xC0, 0x23, 0x19, 0xA1, 0x96, 0xC0, 0x04, 0x19, 0x75, 0x44, 0x75, 0x00,
+0x4E, 0xA9, 0x91, 0x4B, 0x49, 0x51, 0x75, 0xA1, 0xC0, 0x86, 0x31, 0xBA, 0x40, 0xC0, 0x24, 0x29,
+0x53, 0x00, 0x58, 0xBE, 0xAF, 0x00, 0x64, 0x56, 0xC0, 0x8A, 0x4A, 0x49, 0xC1, 0x65, 0x21, 0xEB,
+0x52, 0x00, 0x67, 0xC1, 0xAA, 0x42, 0xEB, 0x4A, 0x47, 0x99, 0x47, 0x00, 0x95, 0xBB, 0xC1, 0xCA,
+0x4A, 0x49, 0x3A, 0xBE, 0x6E, 0x95, 0x78, 0xC0, 0xCA, 0x42, 0xBE, 0xC1, 0x6C, 0x53, 0x0E, 0x64,
+0x9A, 0xC2, 0xAC, 0x4B, 0x09, 0x33, 0x47, 0x22, 0xA2, 0x6B, 0xA2, 0xC2, 0x4B, 0x3A, 0xE9, 0x29,
+0x29, 0x2A, 0x01, 0xC0, 0x6A, 0x32, 0xAB, 0xA6, 0xC0, 0x87, 0x19, 0x63, 0xAE, 0xC0, 0xA9, 0x32,
+0xA6, 0x4D, 0x5F, 0x6B, 0xBE, 0x95, 0x5F, 0x42, 0x9E, 0x81, 0x95, 0xAE, 0xC0, 0x07, 0x1A, 0x01,
+0xBF, 0xC0, 0x67, 0x22, 0x9D, 0xC1, 0x26, 0x1B, 0x29, 0x34, 0x00, 0xC4, 0x29, 0x44, 0xEA, 0x6B,
+0x6E, 0xCC, 0x82, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC8, 0x41, 0xE8, 0xC2, 0xC0, 0x56, 0xFE, 0xAD,
+0xAC, 0xE8, 0x5B, 0xCA, 0x43, 0x69, 0x33, 0x0A, 0x2B, 0xA9, 0x2A, 0x59, 0xB1, 0xA0, 0xC1, 0x43,
+0x21, 0xE5, 0x39, 0x95, 0x00, 0x9A, 0x92, 0xC6, 0x4C, 0x5B, 0xD3, 0x8C, 0x6E, 0x5B, 0x28, 0x2A,
+0x84, 0x11, 0x88, 0x32, 0x4E, 0x64, 0x00, 0xC6, 0xCC, 0x5B, 0x68, 0x3A, 0xC5, 0x29, 0xC6, 0x39,
+0x62, 0x10, 0x25, 0x29, 0x49, 0x52, 0x91, 0x45, 0xC3, 0x27, 0x42, 0x0B, 0x63, 0x6C, 0x6B, 0xCA,
+0x5A, 0x00, 0xC1, 0x2B, 0x63, 0x8D, 0x73, 0x00, 0xC0, 0xEB, 0x62, 0x96, 0xC3, 0x69, 0x52, 0x85,
+0x31, 0x24, 0x21, 0x08, 0x42, 0x95, 0xC1, 0x28, 0x3A, 0x69, 0x42, 0xBF, 0xC1, 0x86, 0x29, 0xC7,
+0x31, 0xA9, 0x51, 0x90, 0xC0, 0x02, 0x19, 0xA1, 0x92, 0x96, 0xC0, 0x86, 0x31, 0x49, 0x00, 0x95,
+0x42, 0x67, 0x91, 0xC0, 0x64, 0x21, 0x73, 0x42, 0xC0, 0xE3, 0x18, 0xBA, 0xC0, 0x07, 0x4A, 0x00,
+0xC0, 0x64, 0x39, 0x91, 0xA9, 0x96, 0x4D, 0xAF, 0x45, 0x96, 0x96, 0xC1, 0x45, 0x29, 0x85, 0x29,
+0xA6, 0x7A, 0xC1, 0x69, 0x42, 0xC6, 0x29, 0x9A, 0xC0, 0x07, 0x2A, 0x00, 0x95, 0x01, 0xBA, 0x41,
+0xBB, 0x50, 0xC0, 0xA6, 0x21, 0x7A, 0x96, 0x00, 0x4E, 0x53, 0x44, 0xC3, 0x26, 0x32, 0x67, 0x3A,
+0xA8, 0x3A, 0x46, 0x2A, 0x95, 0xBB, 0xBB, 0x62, 0xA7, 0xC2, 0xC7, 0x21, 0xAB, 0x3A, 0x6D, 0x4B,
+0x00, 0xBE, 0xC2, 0xAF, 0x5B, 0x2D, 0x4B, 0xCB, 0x42, 0xAE, 0xC0, 0x69, 0x32, 0x5A, 0x80, 0x46,
+0xC0, 0xA9, 0x32, 0x6B, 0xC1, 0xE8, 0x29, 0x69, 0x3A, 0x91, 0xBF, 0x73, 0x6B, 0x99, 0x9E, 0xBF,
+0x96, 0x00, 0xA6, 0x6A, 0xC0, 0xC9, 0x2A, 0x98, 0xC1, 0x47, 0x23, 0x29, 0x34, 0x00, 0xC3, 0x29,
+0x44, 0x0A, 0x6C, 0x6E, 0xCC, 0xA2, 0xD0, 0x5D, 0xE0, 0x11, 0xAE, 0x5D, 0x00, 0xC5, 0x41, 0xE8,
+0xE2, 0xC0, 0x76, 0xFE, 0xAD, 0xAC, 0xC9, 0x5B, 0x48, 0x3B, 0x9B, 0xA3, 0xC0, 0xA8, 0x32, 0x4E,
+0xC3, 0x45, 0x3A, 0xE6, 0x5A, 0x88, 0x73, 0x4A, 0x8C, 0xA1, 0xC0, 0xA8, 0x7B, 0x7E, 0xCA, 0x04,
+0x3A, 0xE9, 0x52, 0x51, 0x7C, 0xAF, 0x63, 0x69, 0x3A, 0xC5, 0x19, 0x67, 0x2A, 0x6F, 0x6C, 0xD0,
+0x74, 0x6B, 0x53, 0xE5, 0x29, 0xA7, 0xC4, 0x03, 0x21, 0x82, 0x18, 0xA7, 0x41, 0x29, 0x52, 0xA6,
+0x39, 0x71, 0xC1, 0xE7, 0x41, 0xA9, 0x52, 0xBF, 0xC0, 0x27, 0x42, 0xBF, 0x46, 0xC0, 0xEB, 0x62,
+0x55, 0xC0, 0x28, 0x4A, 0xBF, 0x68, 0x40, 0x69, 0xC1, 0xA6, 0x31, 0x04, 0x19, 0x69, 0xC2, 0xE7,
+0x31, 0xCB, 0x52, 0x49, 0x42, 0x91, 0xC1, 0x24, 0x21, 0x85, 0x29, 0xB9, 0xC0, 0xE1, 0x18, 0xBF,
+0x01, 0xC0, 0x85, 0x31, 0x69, 0xC2, 0xC7, 0x39, 0x28, 0x3A, 0x86, 0x21, 0x7F, 0xA5, 0xC1, 0x03,
+0x19, 0xA1, 0x08, 0xBA, 0xA6, 0xC3, 0x68, 0x52, 0xD5, 0xC5, 0x16, 0xCE, 0xB0, 0xA4, 0xA9, 0x02,
+0x95, 0x92, 0x00, 0xC3, 0xD1, 0x9C, 0x28, 0x42, 0x24, 0x21, 0x6D, 0x6B, 0x81, 0xC1, 0xA6, 0x29,
+0x24, 0x11, 0x7F, 0x81, 0x01, 0xAE, 0x02, 0x68, 0xBA, 0xAF, 0xBB, 0x91, 0xA9, 0x69, 0x95, 0xBE,
+0xC1, 0x05, 0x3A, 0x83, 0x29, 0x48, 0x98, 0xC0, 0x45, 0x3A, 0xBF, 0xC0, 0xE5, 0x31, 0x4C, 0x5D,
+0xC1, 0x0B, 0x53, 0x6C, 0x53, 0x82, 0x90, 0xBF, 0x00, 0xBF, 0xC8, 0x50, 0x74, 0xB1, 0x7C, 0xC9,
+0x3A, 0x4A, 0x4B, 0xED, 0x5B, 0x4F, 0x6C, 0x33, 0x8D, 0x30, 0x74, 0x69, 0x3A, 0x00, 0xC1, 0x08,
+0x32, 0x8A, 0x42, 0x73, 0xC1, 0x07, 0x2A, 0x68, 0x2A, 0xAE, 0x95, 0x00, 0xA6, 0xC0, 0xE6, 0x19,
+0xAE, 0xC4, 0x66, 0x22, 0xA6, 0x22, 0x06, 0x23, 0xE8, 0x33, 0x28, 0x34, 0x7C, 0xC3, 0x0A, 0x6C,
+0x6E, 0xCC, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D, 0x00, 0xC5, 0x41, 0xE8, 0xE2, 0xC0,
+0x76, 0xFE, 0xAD, 0xAC, 0xC9, 0x5B, 0x48, 0x33, 0xAB, 0xC5, 0xA7, 0x2A, 0x24, 0x22, 0x83, 0x42,
+0x48, 0x84, 0x2D, 0xCE, 0x71, 0xFF, 0x01, 0x9B, 0xC4, 0x12, 0xEF, 0x0C, 0xA5, 0xE6, 0x5A, 0xA8,
+0x52, 0xEB, 0x52, 0x73, 0xCA, 0xE7, 0x21, 0x27, 0x22, 0xED, 0x5B, 0x4E, 0x64, 0x0A, 0x43, 0xE6,
+0x29, 0x48, 0x42, 0x24, 0x29, 0x41, 0x10, 0x05, 0x29, 0xA7, 0x39, 0x78, 0xC2, 0xC7, 0x39, 0x48,
+0x4A, 0xEB, 0x5A, 0xA5, 0xC2, 0x27, 0x42, 0x69, 0x52, 0xAA, 0x5A, 0x00, 0x7C, 0xC0, 0x08, 0x4A,
+0x50, 0xC0, 0x49, 0x4A, 0x54, 0x81, 0xC1, 0x08, 0x42, 0x24, 0x21, 0xAF, 0xAE, 0xC6, 0x08, 0x3A,
+0xAA, 0x52, 0xE7, 0x39, 0x81, 0x08, 0x84, 0x31, 0x67, 0x52, 0xE5, 0x41, 0x6E, 0xBF, 0xC0, 0xE6,
+0x49, 0xAF, 0xC2, 0x45, 0x31, 0xE3, 0x20, 0xC7, 0x31, 0x95, 0xC0, 0xE7, 0x31, 0x7A, 0xA5, 0xC1,
+0xE2, 0x18, 0x81, 0x10, 0x00, 0xC3, 0x6C, 0x73, 0x9C, 0xFF, 0xDC, 0xFF, 0xB3, 0xC5, 0xA5, 0xC0,
+0xD2, 0xCD, 0x91, 0x96, 0xA5, 0x96, 0xC6, 0xF4, 0xCD, 0x7B, 0xF7, 0xF2, 0xA4, 0xAA, 0x52, 0x58,
+0xC6, 0x50, 0x84, 0x64, 0x21, 0xAF, 0x4E, 0x6B, 0xC0, 0xE6, 0x29, 0x01, 0x9A, 0xA6, 0x44, 0x00,
+0xA6, 0xAB, 0xAE, 0xA1, 0xA1, 0xBA, 0xC5, 0xE6, 0x41, 0xEA, 0x6A, 0x6E, 0x94, 0x51, 0xB5, 0x91,
+0xB5, 0x30, 0xAD, 0xAE, 0xC7, 0xAE, 0x94, 0x6A, 0x6B, 0xAD, 0x7B, 0x92, 0x94, 0x13, 0x9D, 0xC9,
+0x42, 0x84, 0x11, 0xE6, 0x19, 0xA2, 0xC6, 0x89, 0x3A, 0x74, 0x9D, 0xFF, 0xEF, 0xF5, 0xAD, 0xE9,
+0x42, 0x29, 0x4B, 0x6F, 0x6C, 0x00, 0xC0, 0x0E, 0x6C, 0x93, 0xC5, 0x92, 0x7C, 0x6E, 0x5B, 0x08,
+0x2A, 0x49, 0x32, 0xAA, 0x42, 0x48, 0x32, 0xAD, 0x94, 0xA9, 0xA5, 0xC0, 0x64, 0x32, 0xBA, 0x96,
+0x9E, 0x89, 0xC0, 0x05, 0x23, 0x65, 0x9E, 0xC2, 0x09, 0x44, 0xE9, 0x6B, 0x6E, 0xCC, 0x75, 0xC0,
+0x00, 0xF8, 0xE0, 0x14, 0xCB, 0x41, 0xE8, 0xC2, 0xC0, 0x56, 0xFE, 0xAD, 0xAC, 0xE9, 0x5B, 0xAA,
+0x3B, 0x29, 0x33, 0x65, 0x22, 0xA3, 0x3A, 0xA9, 0x8C, 0xAF, 0xDE, 0x50, 0xFF, 0x90, 0xC0, 0x8D,
+0xEE, 0xAF, 0xAE, 0xC0, 0xD3, 0xFF, 0xA2, 0xC2, 0x8E, 0xB5, 0x28, 0x6B, 0x84, 0x29, 0x44, 0xAF,
+0xC9, 0x68, 0x2A, 0x2E, 0x64, 0x90, 0x6C, 0x4B, 0x4B, 0x47, 0x32, 0x48, 0x42, 0xCF, 0x7B, 0x86,
+0x39, 0x25, 0x31, 0xC8, 0x41, 0x99, 0xAE, 0xC1, 0x69, 0x4A, 0x6C, 0x6B, 0x91, 0xC2, 0x89, 0x52,
+0xEB, 0x62, 0x2C, 0x6B, 0x64, 0xC0, 0x89, 0x5A, 0x96, 0xC0, 0x4C, 0x73, 0x64, 0xC3, 0xC7, 0x41,
+0x45, 0x29, 0x28, 0x4A, 0x24, 0x21, 0x00, 0xAF, 0xA9, 0xC6, 0xA6, 0x31, 0x24, 0x29, 0x80, 0x10,
+0x4B, 0x6B, 0x52, 0xB5, 0x6E, 0x9C, 0xAF, 0xA4, 0xBF, 0xC2, 0x2F, 0x9C, 0x54, 0xBD, 0x30, 0x94,
+0x58, 0x55, 0xC0, 0x65, 0x29, 0x49, 0xA6, 0x69, 0x00, 0xC0, 0xC2, 0x18, 0xA5, 0x40, 0xC2, 0x3A,
+0xF7, 0x7A, 0xFF, 0x30, 0xBD, 0x90, 0xC0, 0x2F, 0xBD, 0xA6, 0x85, 0x91, 0x92, 0xC9, 0x92, 0xC5,
+0x9B, 0xFF, 0x78, 0xD6, 0xCE, 0x7B, 0xDB, 0xDE, 0x4D, 0x6B, 0x44, 0x21, 0xE6, 0x31, 0x85, 0x29,
+0xC6, 0x29, 0x95, 0xAF, 0xBE, 0x7C, 0x00, 0x7F, 0x70, 0xA6, 0xAF, 0xBA, 0xA1, 0xC4, 0x04, 0x21,
+0x44, 0x31, 0x27, 0x5A, 0x2E, 0xA4, 0x76, 0xE6, 0x00, 0xA9, 0xAD, 0xC5, 0x36, 0xF7, 0x94, 0xDE,
+0xB2, 0xBD, 0x99, 0xE6, 0x7D, 0xF7, 0xD2, 0x94, 0x44, 0xAF, 0xC3, 0xA9, 0x3A, 0xA6, 0x19, 0x30,
+0x74, 0xDE, 0xEF, 0xA5, 0xC3, 0x70, 0x84, 0xE5, 0x29, 0x43, 0x11, 0xA9, 0x3A, 0xA9, 0xC0, 0xC1,
+0x00, 0x50, 0xC3, 0xDB, 0xC6, 0x75, 0x9D, 0x6A, 0x3A, 0x08, 0x32, 0x73, 0xC4, 0xE5, 0x29, 0x24,
+0x32, 0x26, 0x53, 0x6A, 0x84, 0x2F, 0xBE, 0xA5, 0xC5, 0x2B, 0xA5, 0xE7, 0x73, 0x03, 0x4B, 0x82,
+0x2A, 0x04, 0x2B, 0x08, 0x3C, 0x85, 0xC4, 0xE8, 0x3B, 0xC9, 0x63, 0x6E, 0xCC, 0xA2, 0xD0, 0x00,
+0xF8, 0xE0, 0x14, 0xCD, 0x41, 0xE8, 0xC1, 0xC0, 0x55, 0xFE, 0xAC, 0xA4, 0xE9, 0x5B, 0xA9, 0x3B,
+0xE7, 0x22, 0xC4, 0x32, 0x89, 0x7C, 0xD0, 0xDE, 0x51, 0xFF, 0x6E, 0xEE, 0xAC, 0xDD, 0xCE, 0xDD,
+0x99, 0x90, 0xC5, 0x0C, 0xD6, 0x50, 0xF7, 0xF4, 0xFF, 0x10, 0xCE, 0x65, 0x52, 0x06, 0x32, 0x97,
+0x7E, 0xC3, 0x8C, 0x4B, 0x0D, 0x5C, 0x2A, 0x43, 0x68, 0x3A, 0xB6, 0xC3, 0x35, 0xAD, 0x6A, 0x5A,
+0x87, 0x39, 0x09, 0x4A, 0x99, 0x95, 0xC1, 0x49, 0x4A, 0x4C, 0x6B, 0x95, 0xC2, 0x48, 0x4A, 0x89,
+0x52, 0xEB, 0x62, 0x91, 0xC0, 0x28, 0x4A, 0xA6, 0xC0, 0x2C, 0x6B, 0x64, 0xC0, 0xE7, 0x41, 0xAE,
+0xC2, 0xCE, 0x7B, 0x28, 0x42, 0xA6, 0x31, 0x00, 0xC0, 0xC3, 0x10, 0xA5, 0xA5, 0xA5, 0xC2, 0x2E,
+0x8C, 0x56, 0xD6, 0x8E, 0xA4, 0xA2, 0xAE, 0xC3, 0x0D, 0x9C, 0xD5, 0xD5, 0x33, 0xBD, 0x65, 0x39,
+0x96, 0xC0, 0xA7, 0x39, 0x9A, 0xAE, 0x44, 0xC0, 0x49, 0x4A, 0x58, 0x91, 0xC3, 0xAD, 0x83, 0x3A,
+0xFF, 0xBB, 0xFF, 0x51, 0xC5, 0x94, 0xC0, 0x70, 0xC5, 0xA5, 0x9A, 0x92, 0x52, 0xC4, 0x92, 0xC5,
+0xBC, 0xFF, 0xB9, 0xE6, 0xEF, 0x83, 0x38, 0xCE, 0x41, 0x69, 0xC0, 0x07, 0x3A, 0x81, 0x56, 0xC0,
+0xA5, 0x21, 0x7F, 0xAE, 0x01, 0xBE, 0x44, 0x70, 0xC0, 0xE7, 0x29, 0xBA, 0x7D, 0xA1, 0xC3, 0x85,
+0x41, 0x47, 0x62, 0x4F, 0xAC, 0x96, 0xFE, 0x9A, 0xC0, 0x33, 0xE6, 0xAD, 0xC1, 0xF5, 0xF6, 0x53,
+0xDE, 0x92, 0xC2, 0x1A, 0xF7, 0xBA, 0xE6, 0x8E, 0x73, 0x5A, 0xC0, 0x0C, 0x53, 0xAF, 0xC4, 0xE8,
+0x29, 0x14, 0x95, 0x9E, 0xEF, 0x71, 0x8C, 0xE7, 0x39, 0x80, 0x44, 0xCC, 0x70, 0x74, 0x54, 0x95,
+0xEB, 0x42, 0xAE, 0x63, 0xDE, 0xEF, 0x13, 0x8D, 0x07, 0x32, 0xA6, 0x29, 0xE6, 0x31, 0x45, 0x3A,
+0x2A, 0x84, 0x2F, 0xC6, 0x92, 0xF7, 0xB8, 0xAE, 0xA1, 0xCA, 0xEE, 0xEE, 0x4D, 0xC6, 0x09, 0x8D,
+0xA5, 0x43, 0x23, 0x23, 0xA6, 0x23, 0xC8, 0x3B, 0xC9, 0x63, 0x4D, 0xCC, 0x82, 0xD0, 0x00, 0xF8,
+0xE0, 0x14, 0xCA, 0x61, 0xE8, 0xC1, 0xB8, 0x35, 0xFE, 0x8C, 0xA4, 0xE9, 0x5B, 0x68, 0x3B, 0xC5,
+0x22, 0x65, 0x53, 0xED, 0xBD, 0x51, 0xF7, 0x4E, 0xE6, 0x97, 0xC0, 0x77, 0xFF, 0x01, 0xC1, 0xB1,
+0xEE, 0x6A, 0xC5, 0x80, 0xC3, 0xF0, 0xEE, 0x73, 0xFF, 0x6A, 0x94, 0x05, 0x3A, 0x7C, 0x9E, 0xC6,
+0xCD, 0x4B, 0x2E, 0x5C, 0x2B, 0x43, 0x69, 0x3A, 0x08, 0x3A, 0x4D, 0x6B, 0x25, 0x31, 0x95, 0xC1,
+0xA7, 0x39, 0xE7, 0x41, 0x60, 0xC2, 0x48, 0x4A, 0xEB, 0x5A, 0x6D, 0x73, 0x41, 0xBF, 0xC0, 0x0B,
+0x63, 0x64, 0xC0, 0x69, 0x52, 0xA5, 0xC0, 0x4D, 0x73, 0x64, 0xC0, 0x08, 0x4A, 0x7C, 0xC0, 0x92,
+0x94, 0x60, 0xC0, 0x45, 0x21, 0x5D, 0xC1, 0x44, 0x21, 0xA2, 0x18, 0x90, 0x92, 0xC6, 0x2E, 0x8C,
+0x56, 0xD6, 0x4E, 0x9C, 0x6F, 0xAC, 0xF1, 0xBC, 0x6F, 0xA4, 0x94, 0xC5, 0x81, 0xC0, 0x48, 0x52,
+0x47, 0x44, 0xC1, 0xC8, 0x39, 0x66, 0x29, 0x60, 0xC1, 0xAB, 0x5A, 0xE3, 0x20, 0xA1, 0xC3, 0xCE,
+0x8B, 0x5B, 0xFF, 0xDC, 0xFF, 0x51, 0xC5, 0xA9, 0x4F, 0x91, 0xAE, 0xAB, 0xC7, 0xEF, 0xB4, 0xD3,
+0xCD, 0xFC, 0xFF, 0x99, 0xDE, 0xAE, 0x7B, 0xD6, 0xBD, 0xAA, 0x52, 0x85, 0x29, 0x7D, 0xC0, 0xE6,
+0x31, 0x01, 0xAF, 0x47, 0x96, 0x00, 0x53, 0xBF, 0x00, 0xC0, 0x65, 0x21, 0x7D, 0xBB, 0xBE, 0xC5,
+0xE7, 0x51, 0x89, 0x72, 0x2E, 0xAC, 0x15, 0xEE, 0xD7, 0xFE, 0x13, 0xE6, 0x80, 0xD2, 0x53, 0xE6,
+0xD1, 0xCD, 0x55, 0xDE, 0x7B, 0xFF, 0x38, 0xD6, 0xEB, 0x5A, 0xA7, 0x29, 0x49, 0x3A, 0x8B, 0x42,
+0x29, 0x3A, 0x76, 0xA5, 0xFF, 0xFF, 0xF7, 0xBD, 0x4D, 0x63, 0xCE, 0x73, 0x30, 0x7C, 0xBA, 0xC6,
+0xFF, 0xF7, 0x1C, 0xCF, 0xA5, 0xC2, 0xFF, 0xEF, 0x72, 0x7C, 0x08, 0x32, 0xA4, 0xC5, 0x25, 0x42,
+0x88, 0x73, 0xD3, 0xDE, 0xD5, 0xFF, 0x10, 0xEF, 0x6C, 0xE6, 0xB5, 0xAE, 0xC4, 0x0D, 0xFF, 0xF1,
+0xFF, 0x30, 0xDF, 0x09, 0x85, 0x64, 0x3B, 0x8F, 0xC2, 0xA7, 0x3B, 0x88, 0x63, 0x4D, 0xCC, 0x75,
+0xC0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x5D, 0xC8, 0x20, 0xD8, 0x22, 0xC1, 0x14, 0xFE, 0x4B, 0x9C,
+0xE9, 0x63, 0x26, 0x3B, 0x83, 0x32, 0x05, 0x7C, 0xAE, 0xE6, 0xBB, 0xC3, 0xB2, 0xEE, 0x79, 0xFF,
+0xFD, 0xFF, 0x9B, 0xF7, 0xBD, 0xCB, 0x76, 0xFF, 0xD2, 0xF6, 0x6C, 0xC5, 0x87, 0xAC, 0x93, 0xFF,
+0x2F, 0xD6, 0xE4, 0x41, 0xA4, 0x21, 0xE5, 0x09, 0xEC, 0x3B, 0x2E, 0x4C, 0xEA, 0x32, 0x5A, 0xB6,
+0xC3, 0x25, 0x29, 0x00, 0x08, 0x03, 0x21, 0xE7, 0x39, 0x90, 0xC2, 0xE7, 0x41, 0xAA, 0x5A, 0x2C,
+0x6B, 0xAF, 0xC0, 0xEB, 0x62, 0x50, 0x64, 0xC6, 0x8D, 0x73, 0x0B, 0x63, 0x07, 0x42, 0x69, 0x52,
+0x6D, 0x73, 0x28, 0x4A, 0x69, 0x4A, 0x95, 0xC1, 0x66, 0x29, 0xA7, 0x29, 0x00, 0xA5, 0xC6, 0xA1,
+0x10, 0xC5, 0x39, 0x22, 0x21, 0xA8, 0x52, 0x4E, 0x94, 0xCD, 0x8B, 0x2F, 0xA4, 0x00, 0xC3, 0xAD,
+0x8B, 0x70, 0x9C, 0x6C, 0x73, 0xEA, 0x5A, 0x96, 0xC0, 0x28, 0x42, 0x91, 0xC1, 0x86, 0x31, 0xC7,
+0x39, 0x69, 0xC7, 0xA6, 0x39, 0xC2, 0x20, 0x4B, 0x7B, 0x98, 0xE6, 0x39, 0xFF, 0xB2, 0xCD, 0x50,
+0xBD, 0x90, 0xC5, 0xBB, 0x54, 0x91, 0xC8, 0xEE, 0xAC, 0x91, 0xC5, 0x18, 0xEF, 0x37, 0xCE, 0x91,
+0x94, 0x38, 0xC6, 0xEB, 0x5A, 0x85, 0x29, 0x07, 0x3A, 0x51, 0x56, 0x81, 0xC0, 0x28, 0x3A, 0x7F,
+0xC1, 0x65, 0x21, 0xE3, 0x10, 0xA6, 0xC1, 0xC7, 0x31, 0x69, 0x4A, 0x7D, 0x00, 0xA5, 0xC0, 0x48,
+0x52, 0xA5, 0xC5, 0xA4, 0x49, 0xAC, 0x93, 0x36, 0xE6, 0xB7, 0xF6, 0x56, 0xE6, 0xB7, 0xEE, 0xAF,
+0xC0, 0x56, 0xDE, 0xAF, 0x96, 0xC1, 0x33, 0xAD, 0x68, 0x42, 0x7F, 0xAF, 0xC6, 0x28, 0x32, 0xC7,
+0x29, 0xCE, 0x6B, 0x1C, 0xDF, 0xFF, 0xF7, 0x7D, 0xE7, 0xFF, 0xFF, 0x6E, 0xC0, 0x9E, 0xEF, 0x6D,
+0x96, 0xC0, 0xBF, 0xF7, 0x9A, 0xC4, 0x52, 0x7C, 0x08, 0x32, 0xA3, 0x31, 0xC5, 0x62, 0xF2, 0xEE,
+0xAD, 0xCE, 0xB0, 0xDE, 0x4F, 0xD6, 0xD3, 0xEE, 0x70, 0xEE, 0x0D, 0xE6, 0x48, 0xCD, 0xE9, 0xD5,
+0xED, 0xEE, 0x30, 0xE7, 0x87, 0x7C, 0x64, 0x33, 0x46, 0x33, 0xA9, 0x6B, 0x2D, 0xCC, 0x81, 0xC8,
+0x5D, 0xE0, 0x12, 0xAE, 0x96, 0xCB, 0x40, 0xD8, 0x23, 0xC1, 0x34, 0xFE, 0x4B, 0x9C, 0xC9, 0x63,
+0x06, 0x3B, 0xC3, 0x3A, 0x45, 0x94, 0xAE, 0xEE, 0xD0, 0xF6, 0x35, 0xFF, 0xDD, 0xFF, 0x6E, 0xA5,
+0x5E, 0xC0, 0x79, 0xFF, 0xA8, 0xC1, 0x51, 0xE6, 0x88, 0xAC, 0x58, 0x92, 0xC3, 0x65, 0x52, 0x83,
+0x19, 0xC4, 0x01, 0x0D, 0x3C, 0xBF, 0xC3, 0x0A, 0x33, 0x08, 0x32, 0x86, 0x31, 0x41, 0x10, 0x91,
+0xC1, 0x23, 0x21, 0xE6, 0x39, 0xA6, 0xA6, 0xC1, 0x07, 0x4A, 0x2C, 0x6B, 0x00, 0xC0, 0xAB, 0x5A,
+0x90, 0xA6, 0xC0, 0xCA, 0x5A, 0x91, 0xC1, 0xE7, 0x41, 0xCA, 0x62, 0xAF, 0xC2, 0x28, 0x4A, 0x69,
+0x4A, 0xAB, 0x52, 0x49, 0xAF, 0x00, 0xCA, 0x66, 0x29, 0xE7, 0x39, 0x6C, 0x6B, 0x06, 0x3A, 0x22,
+0x19, 0xA5, 0x39, 0x68, 0x5A, 0x0B, 0x7B, 0x28, 0x62, 0xE2, 0x30, 0x23, 0x29, 0x4F, 0x6F, 0xA6,
+0x56, 0x4C, 0xBE, 0xC1, 0x65, 0x31, 0x4D, 0x6B, 0x41, 0xC6, 0x03, 0x29, 0x47, 0x52, 0xB0, 0xA4,
+0x52, 0xBD, 0x0C, 0x94, 0x6D, 0x9C, 0xCF, 0xAC, 0xA5, 0x95, 0xA6, 0x6A, 0xC6, 0x4D, 0x9C, 0x92,
+0xBD, 0xD1, 0x9C, 0x33, 0xA5, 0x78, 0xCE, 0xEB, 0x5A, 0xC6, 0x31, 0x00, 0x96, 0xC0, 0x27, 0x3A,
+0x92, 0xC0, 0x28, 0x3A, 0x4E, 0x92, 0x91, 0xA5, 0xC1, 0x29, 0x3A, 0x6A, 0x4A, 0x7D, 0xBF, 0x7D,
+0xC4, 0x27, 0x4A, 0xC6, 0x41, 0xA1, 0x20, 0x43, 0x39, 0x88, 0x62, 0x91, 0xAE, 0xC2, 0xE9, 0x6A,
+0x2A, 0x73, 0xA9, 0x5A, 0xA6, 0xC0, 0xCA, 0x5A, 0x91, 0xC1, 0xCA, 0x4A, 0x07, 0x2A, 0xA5, 0xAE,
+0x44, 0x4F, 0xC6, 0xAE, 0x6B, 0xEB, 0x52, 0x75, 0xA5, 0x5C, 0xDF, 0x9E, 0xEF, 0xB6, 0xB5, 0x4D,
+0x63, 0x91, 0xCA, 0xD3, 0x9C, 0xD8, 0xB5, 0x0D, 0x4B, 0x8A, 0x42, 0xC6, 0x5A, 0x8A, 0xA4, 0x52,
+0xFF, 0xD0, 0xEE, 0x54, 0xF7, 0x97, 0xFF, 0xB9, 0xFF, 0xA5, 0xCB, 0x55, 0xFF, 0x2D, 0xEE, 0xC9,
+0xDD, 0x09, 0xDE, 0x2E, 0xF7, 0x0C, 0xBE, 0xA5, 0x43, 0x25, 0x3B, 0x88, 0x6B, 0x0D, 0xCC, 0xA1,
+0xD0, 0x20, 0xF8, 0x00, 0x5D, 0xE0, 0x11, 0x9A, 0xC5, 0x40, 0xD8, 0x43, 0xC1, 0x55, 0xFE, 0x4B,
+0x9C, 0xC8, 0x63, 0x26, 0x3B, 0xA4, 0xC6, 0x87, 0x8C, 0x8E, 0xE6, 0xD1, 0xF6, 0xB8, 0xFF, 0xFE,
+0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0xB9, 0xC9, 0x7B, 0xFF, 0xFA, 0xFF, 0x14, 0xF7, 0x68, 0xAC, 0x4D,
+0xE6, 0x12, 0xF7, 0x07, 0x63, 0x84, 0x19, 0xC4, 0x01, 0x0D, 0x3C, 0xBF, 0xC4, 0xEA, 0x32, 0xE7,
+0x31, 0x05, 0x29, 0xC7, 0x41, 0x45, 0x31, 0x99, 0xC0, 0xA5, 0x31, 0x4A, 0xC0, 0x85, 0x31, 0x45,
+0xC3, 0x8E, 0x73, 0x2D, 0x73, 0xCB, 0x62, 0x49, 0x52, 0x4F, 0xC0, 0x07, 0x4A, 0x54, 0x4F, 0x64,
+0xC5, 0x4C, 0x73, 0x69, 0x52, 0xE7, 0x39, 0xAA, 0x52, 0x86, 0x29, 0x08, 0x3A, 0xBF, 0x5D, 0x71,
+0xC2, 0xA9, 0x52, 0x47, 0x3A, 0xC5, 0x29, 0x4A, 0xC1, 0x48, 0x4A, 0xA9, 0x62, 0xA2, 0xC3, 0x44,
+0x31, 0xC2, 0x10, 0x27, 0x32, 0x68, 0x3A, 0x4E, 0xC1, 0x28, 0x3A, 0xC7, 0x31, 0xA6, 0xC3, 0x2D,
+0x63, 0x8E, 0x73, 0x08, 0x42, 0xA2, 0x18, 0xA5, 0xC7, 0xE2, 0x28, 0x84, 0x39, 0xC5, 0x41, 0xC9,
+0x6A, 0x4A, 0x7B, 0xC8, 0x6A, 0xE5, 0x49, 0x63, 0x39, 0x90, 0xC3, 0xA4, 0x41, 0xE9, 0x62, 0xCD,
+0x7B, 0xF7, 0xBD, 0xAE, 0xC1, 0xA9, 0x4A, 0x07, 0x32, 0xA5, 0x00, 0x4E, 0x00, 0x62, 0x4E, 0xAB,
+0xA5, 0x95, 0x5D, 0x02, 0x90, 0xBF, 0xB5, 0xC0, 0x03, 0x29, 0xA9, 0x61, 0x45, 0x01, 0xC1, 0x43,
+0x29, 0x84, 0x31, 0x76, 0x42, 0x53, 0xC0, 0x48, 0x3A, 0x99, 0xC0, 0x88, 0x3A, 0xAF, 0xBA, 0xC0,
+0xEA, 0x4A, 0x6C, 0xC2, 0x85, 0x21, 0x69, 0x42, 0x8D, 0x63, 0xBF, 0x76, 0xC0, 0xE4, 0x18, 0x00,
+0xC0, 0x08, 0x3A, 0xAF, 0xC0, 0xC8, 0x29, 0x6F, 0xC6, 0x26, 0x6B, 0xEE, 0xCD, 0x11, 0xF7, 0x6F,
+0xDE, 0x97, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0xA9, 0xA8, 0xCA, 0xF3, 0xFE, 0x0C, 0xE6, 0x47, 0xCD,
+0xAB, 0xEE, 0xCD, 0xDE, 0x27, 0x5C, 0x25, 0x33, 0x48, 0x63, 0x0D, 0xCC, 0xC2, 0xD0, 0x20, 0xF8,
+0x01, 0xA6, 0xE0, 0x10, 0x9A, 0xCB, 0x41, 0xD8, 0x64, 0xC1, 0x55, 0xFE, 0x2B, 0x9C, 0xA8, 0x5B,
+0x27, 0x3B, 0xE4, 0x32, 0x47, 0x84, 0x8F, 0xE6, 0xD2, 0xF6, 0xB8, 0xFF, 0xFE, 0xFF, 0x83, 0x00,
+0xA5, 0xD0, 0x7B, 0xF7, 0xDA, 0xFF, 0xD3, 0xEE, 0xC9, 0xAC, 0x8E, 0xEE, 0xD1, 0xEE, 0xA6, 0x5A,
+0xA4, 0x21, 0xE4, 0x01, 0xEC, 0x3B, 0x4E, 0x4C, 0x2B, 0x3B, 0x08, 0x32, 0x66, 0x31, 0x14, 0xAD,
+0x4C, 0x73, 0x07, 0x42, 0x91, 0x59, 0x45, 0x00, 0xC0, 0x0C, 0x63, 0xA6, 0x90, 0xC1, 0x49, 0x52,
+0xA6, 0x39, 0xBE, 0xC0, 0x08, 0x4A, 0x00, 0xC0, 0xEB, 0x62, 0x00, 0xC7, 0x49, 0x4A, 0xE7, 0x41,
+0x8E, 0x73, 0xC7, 0x39, 0x66, 0x29, 0xE8, 0x31, 0x6A, 0x42, 0xCB, 0x52, 0x99, 0x99, 0x96, 0xC1,
+0x27, 0x32, 0x64, 0x21, 0xB6, 0x48, 0x40, 0xC3, 0x27, 0x3A, 0x2B, 0x53, 0xCA, 0x42, 0xE7, 0x29,
+0xBA, 0x55, 0xBA, 0x59, 0xC1, 0x29, 0x3A, 0xE4, 0x18, 0xBE, 0x5D, 0xC0, 0xA1, 0x10, 0xBA, 0xC0,
+0x03, 0x29, 0x00, 0xC0, 0x64, 0x31, 0xBE, 0x91, 0xC0, 0xC2, 0x20, 0x69, 0xC0, 0x23, 0x29, 0x54,
+0xC1, 0x27, 0x42, 0xCE, 0x73, 0x91, 0xC0, 0x48, 0x42, 0x6F, 0xC1, 0x07, 0x32, 0x48, 0x3A, 0x9A,
+0x53, 0x67, 0x96, 0xBA, 0x5A, 0xC0, 0xA6, 0x29, 0x5A, 0x55, 0xBE, 0xAF, 0x90, 0xBA, 0xBE, 0x4A,
+0xA5, 0x00, 0xA6, 0x7E, 0xC0, 0x44, 0x29, 0x95, 0xC0, 0xA5, 0x29, 0x53, 0x5F, 0xC3, 0x69, 0x3A,
+0x07, 0x2A, 0x68, 0x32, 0x0A, 0x43, 0xA6, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x53, 0xC0, 0x24, 0x19,
+0xBF, 0xC2, 0x49, 0x42, 0xAF, 0x73, 0x92, 0x8C, 0x81, 0xC2, 0xAB, 0x42, 0x47, 0x3A, 0x46, 0x6B,
+0x5C, 0xBD, 0xC2, 0x12, 0xF7, 0xFA, 0xFF, 0xFD, 0xFF, 0x97, 0xA1, 0xBC, 0xCA, 0x56, 0xFF, 0xB0,
+0xF6, 0x68, 0xD5, 0x29, 0xEE, 0xAC, 0xE6, 0xA8, 0x6C, 0x26, 0x3B, 0x27, 0x5B, 0x2D, 0xCC, 0xC2,
+0xD8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x11, 0x9A, 0xCC, 0x61, 0xE0, 0x64, 0xC9, 0x55, 0xFE, 0x2B,
+0x9C, 0xA8, 0x5B, 0x27, 0x33, 0xA4, 0x2A, 0x07, 0x74, 0xB0, 0xDE, 0x33, 0xFF, 0x96, 0xFF, 0xFB,
+0xFF, 0xFE, 0xFF, 0x92, 0x51, 0xBD, 0xCD, 0x78, 0xFF, 0x31, 0xDE, 0x8C, 0xC5, 0x31, 0xFF, 0x0F,
+0xD6, 0x45, 0x4A, 0x26, 0x2A, 0x25, 0x12, 0xCC, 0x3B, 0x4E, 0x54, 0x4B, 0x3B, 0x08, 0x32, 0xC7,
+0x41, 0xCF, 0x83, 0x4F, 0xC2, 0x44, 0x29, 0xA5, 0x31, 0xE6, 0x39, 0xAB, 0xBA, 0xC1, 0x89, 0x52,
+0x29, 0x4A, 0xA5, 0x00, 0xC2, 0x86, 0x39, 0xE7, 0x49, 0x69, 0x5A, 0x77, 0xC0, 0x8A, 0x5A, 0x63,
+0x74, 0xC3, 0x4D, 0x6B, 0xF7, 0xBD, 0x8E, 0x73, 0xE8, 0x39, 0x91, 0xC0, 0x8A, 0x4A, 0x00, 0xC4,
+0x0B, 0x4B, 0x8D, 0x53, 0x2B, 0x43, 0x88, 0x32, 0x27, 0x32, 0x7A, 0xA5, 0xC2, 0x24, 0x19, 0xA9,
+0x42, 0x2C, 0x4B, 0xAE, 0xC4, 0xAA, 0x42, 0xE7, 0x29, 0x4A, 0x42, 0x0D, 0x5B, 0x49, 0x3A, 0xA1,
+0xC0, 0x25, 0x19, 0x61, 0xC0, 0xC7, 0x31, 0xA5, 0x00, 0x91, 0xBA, 0xC1, 0x03, 0x21, 0x44, 0x29,
+0x7D, 0x69, 0x00, 0x44, 0x7D, 0xC0, 0x28, 0x3A, 0x90, 0x58, 0xC0, 0x6C, 0x5B, 0xA6, 0xC1, 0x48,
+0x3A, 0xEA, 0x4A, 0x92, 0xC0, 0x07, 0x32, 0x73, 0x67, 0x6E, 0x5A, 0x91, 0x62, 0x00, 0x46, 0x62,
+0xAB, 0xA4, 0xA6, 0xC1, 0x85, 0x29, 0x03, 0x19, 0x00, 0xA9, 0xC0, 0xE6, 0x31, 0x42, 0x81, 0x53,
+0xC2, 0x8A, 0x3A, 0xCB, 0x42, 0x4C, 0x53, 0x95, 0x95, 0xC2, 0xA8, 0x3A, 0x27, 0x2A, 0xC6, 0x21,
+0x91, 0x7C, 0x58, 0xC0, 0x68, 0x3A, 0xBB, 0xC4, 0x2C, 0x5B, 0x92, 0x8C, 0x59, 0xC6, 0x9E, 0xEF,
+0xFF, 0xF7, 0x00, 0xC3, 0x4D, 0x5B, 0xC5, 0x31, 0x46, 0x73, 0xF2, 0xEE, 0xB0, 0xC3, 0xB6, 0xFF,
+0xFC, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0x92, 0xB8, 0xCA, 0x79, 0xFF, 0x14, 0xFF, 0x8A, 0xDD, 0x29,
+0xF6, 0xCC, 0xEE, 0xE9, 0x74, 0x46, 0x33, 0x27, 0x5B, 0x2D, 0xCC, 0xA2, 0xD0, 0x00, 0xF8, 0xE0,
+0x13, 0x9A, 0xCC, 0x61, 0xE0, 0x63, 0xC1, 0x55, 0xFE, 0x2B, 0x9C, 0xA8, 0x5B, 0x07, 0x33, 0x84,
+0x22, 0x86, 0x63, 0x2E, 0xCE, 0x32, 0xFF, 0x94, 0xFF, 0xB8, 0xFF, 0xFB, 0xFF, 0xA7, 0x00, 0xA9,
+0xC1, 0x36, 0xFF, 0x30, 0xDE, 0xBE, 0xC9, 0x53, 0xFF, 0xCB, 0xAC, 0x25, 0x42, 0x88, 0x32, 0x87,
+0x1A, 0xEC, 0x3B, 0x6F, 0x54, 0x2B, 0x3B, 0xC7, 0x31, 0xE7, 0x41, 0x00, 0xC2, 0xC3, 0x20, 0x65,
+0x29, 0x07, 0x3A, 0x00, 0xA5, 0x42, 0xC0, 0x07, 0x42, 0x00, 0xA7, 0x63, 0xC0, 0xA7, 0x41, 0x54,
+0xC1, 0x48, 0x52, 0xE7, 0x49, 0x00, 0x63, 0x81, 0xC9, 0xCB, 0x5A, 0xF4, 0x9C, 0x6E, 0x6B, 0x29,
+0x42, 0xA7, 0x31, 0x28, 0x3A, 0x86, 0x21, 0x89, 0x3A, 0xAD, 0x4B, 0x2E, 0x5C, 0x92, 0xC8, 0x4B,
+0x4B, 0x28, 0x32, 0x85, 0x21, 0xC6, 0x29, 0x48, 0x32, 0xA6, 0x19, 0xCA, 0x3A, 0x4D, 0x53, 0x29,
+0x32, 0xBE, 0xC1, 0xEC, 0x52, 0x08, 0x3A, 0x62, 0x7A, 0x7F, 0x42, 0x91, 0x42, 0x7D, 0xA6, 0xC0,
+0x24, 0x21, 0xBF, 0x7D, 0x92, 0x9A, 0xC0, 0xA7, 0x29, 0x00, 0x67, 0x91, 0xC7, 0x88, 0x3A, 0x6C,
+0x5B, 0x0A, 0x4B, 0xCE, 0x63, 0xF3, 0x8C, 0x0F, 0x6C, 0xC6, 0x21, 0x27, 0x32, 0x9A, 0xC0, 0x69,
+0x3A, 0x67, 0xC0, 0xE7, 0x31, 0xAF, 0x95, 0x00, 0x5F, 0xC0, 0x69, 0x42, 0x67, 0x53, 0xC4, 0x65,
+0x21, 0xE3, 0x18, 0x64, 0x29, 0x03, 0x11, 0xA5, 0x29, 0x7F, 0x7C, 0xC1, 0x49, 0x32, 0xCB, 0x3A,
+0xA1, 0x9A, 0x90, 0xA4, 0x91, 0x55, 0xA6, 0xC0, 0x68, 0x32, 0x5C, 0xC3, 0x71, 0x7C, 0x58, 0xBE,
+0x7D, 0xDF, 0xFF, 0xF7, 0xA6, 0x00, 0xC6, 0x3D, 0xDF, 0x96, 0xAD, 0xF3, 0x94, 0x2D, 0x53, 0x63,
+0x21, 0x46, 0x6B, 0x91, 0xE6, 0xBE, 0xC2, 0x96, 0xFF, 0xDB, 0xFF, 0x9E, 0xF7, 0x6E, 0xBA, 0x00,
+0xCA, 0x7A, 0xFF, 0xF4, 0xFE, 0x8B, 0xDD, 0x29, 0xF6, 0xCC, 0xEE, 0xC8, 0x6C, 0x25, 0x33, 0x27,
+0x5B, 0x4E, 0xD4, 0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xCD, 0x61, 0xE0, 0x43, 0xC1, 0x35, 0xFE,
+0x2B, 0x9C, 0xC9, 0x5B, 0x07, 0x33, 0xA5, 0x22, 0xA3, 0x42, 0x88, 0x94, 0x4E, 0xDE, 0x51, 0xFF,
+0x93, 0xFF, 0xF7, 0xFF, 0xF9, 0xFF, 0xAB, 0xA4, 0xC1, 0x35, 0xFF, 0xD2, 0xF6, 0x00, 0xC3, 0x71,
+0xE6, 0x47, 0x73, 0xC4, 0x31, 0x06, 0x22, 0x8E, 0xC3, 0xEC, 0x43, 0x6F, 0x54, 0x4B, 0x43, 0x28,
+0x3A, 0xB6, 0xC0, 0xA3, 0x20, 0x85, 0xC0, 0x23, 0x21, 0x42, 0xC0, 0x68, 0x4A, 0x00, 0xC1, 0xE6,
+0x31, 0x28, 0x42, 0x00, 0x54, 0xC0, 0x28, 0x4A, 0x54, 0xA6, 0x54, 0x4F, 0x68, 0xC0, 0x69, 0x52,
+0x78, 0xC1, 0xE8, 0x39, 0xAB, 0x52, 0x6C, 0xC0, 0x8A, 0x4A, 0x00, 0x81, 0xC0, 0x86, 0x21, 0x9E,
+0xC3, 0xA9, 0x22, 0x0E, 0x4C, 0x4F, 0x5C, 0x0B, 0x3B, 0x55, 0xA6, 0x00, 0x95, 0x92, 0xC0, 0x28,
+0x2A, 0x7F, 0x91, 0xA1, 0x00, 0xC0, 0x85, 0x21, 0x73, 0x6B, 0x47, 0x42, 0xC0, 0x64, 0x21, 0xA6,
+0x91, 0xA6, 0xC0, 0x65, 0x29, 0x42, 0x62, 0x45, 0x95, 0x62, 0xC0, 0x69, 0x3A, 0x50, 0xA5, 0x50,
+0x44, 0xC3, 0x64, 0x19, 0x2B, 0x4B, 0xAD, 0x5B, 0x89, 0x3A, 0x01, 0x50, 0xC0, 0x48, 0x32, 0x73,
+0xA5, 0x00, 0xC0, 0xC7, 0x29, 0x6E, 0x95, 0x73, 0xA9, 0x67, 0x47, 0x96, 0xC0, 0xEA, 0x52, 0x96,
+0x6C, 0xC0, 0x07, 0x32, 0x5F, 0xC0, 0x8A, 0x3A, 0x96, 0xC0, 0xE8, 0x21, 0x74, 0x65, 0x00, 0xA9,
+0xC0, 0xEE, 0x63, 0x4D, 0xC2, 0x91, 0x7C, 0xBE, 0xE7, 0xFF, 0xF7, 0x01, 0xC0, 0xDB, 0xCE, 0x7E,
+0xC2, 0x92, 0x8C, 0xCF, 0x73, 0x08, 0x3A, 0x00, 0xC7, 0x4D, 0x5B, 0xE5, 0x31, 0xC4, 0x5A, 0xCE,
+0xCD, 0x12, 0xFF, 0x55, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0x93, 0x71, 0x63, 0xCA, 0x38, 0xFF, 0xF3,
+0xFE, 0xEC, 0xE5, 0x6A, 0xF6, 0x4A, 0xCE, 0x47, 0x5C, 0x04, 0x2B, 0x48, 0x5B, 0x4E, 0xD4, 0x81,
+0xD0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x00, 0x6A, 0xCE, 0x43, 0xC1, 0x34, 0xFE, 0x2B, 0x9C, 0xC9,
+0x63, 0x28, 0x33, 0xC6, 0x22, 0xC0, 0x19, 0xE3, 0x52, 0x29, 0xAD, 0x10, 0xEF, 0x71, 0xF7, 0xB3,
+0xFF, 0xF6, 0xFF, 0xF8, 0xFF, 0x95, 0xFF, 0xA1, 0x5C, 0xCB, 0xD3, 0xF6, 0x4F, 0xBD, 0x24, 0x4A,
+0xC4, 0x29, 0x84, 0x11, 0xE4, 0x09, 0xEC, 0x43, 0x6E, 0x5C, 0x6B, 0x43, 0x68, 0x3A, 0x07, 0x42,
+0x45, 0x29, 0xA5, 0x95, 0xC1, 0x65, 0x29, 0x0B, 0x5B, 0xAE, 0xC1, 0xE6, 0x31, 0x27, 0x3A, 0xA6,
+0x7D, 0xC0, 0x28, 0x42, 0x00, 0x51, 0x59, 0xC1, 0x49, 0x4A, 0x4C, 0x6B, 0x69, 0x00, 0xC0, 0x49,
+0x42, 0x91, 0xC3, 0x86, 0x21, 0xAA, 0x4A, 0xEB, 0x52, 0x49, 0x3A, 0x9A, 0x85, 0xC4, 0x88, 0x22,
+0x2E, 0x4C, 0x90, 0x5C, 0x2B, 0x3B, 0x68, 0x32, 0xA6, 0xC5, 0x44, 0x11, 0xA9, 0x3A, 0x71, 0x74,
+0x8D, 0x53, 0x07, 0x2A, 0x69, 0x3A, 0x76, 0x92, 0xC2, 0xCE, 0x6B, 0x0E, 0x74, 0xEA, 0x52, 0x42,
+0x56, 0xC2, 0x2C, 0x63, 0xCE, 0x73, 0xAA, 0x52, 0xAE, 0xC1, 0x2C, 0x5B, 0x48, 0x42, 0x81, 0x72,
+0x9A, 0x53, 0x50, 0xC1, 0xCA, 0x42, 0xC6, 0x21, 0xAE, 0xC0, 0xEA, 0x42, 0x00, 0xC1, 0x2B, 0x4B,
+0x48, 0x2A, 0xBE, 0xC1, 0x50, 0x6C, 0x8D, 0x5B, 0x69, 0x64, 0xC0, 0xA9, 0x42, 0xBF, 0xAF, 0xC0,
+0x89, 0x42, 0x67, 0x44, 0xC1, 0x28, 0x32, 0x68, 0x3A, 0x67, 0x44, 0xA1, 0xC0, 0x0A, 0x53, 0x57,
+0x53, 0x91, 0xC0, 0x69, 0x3A, 0xAF, 0xC0, 0x29, 0x32, 0xAF, 0xC3, 0xEB, 0x42, 0x6C, 0x5B, 0x0B,
+0x4B, 0x47, 0x32, 0x4C, 0xC0, 0x27, 0x32, 0x7C, 0xC2, 0x3C, 0xDF, 0xBE, 0xEF, 0xFF, 0xF7, 0x00,
+0xC1, 0xFB, 0xD6, 0x75, 0xAD, 0x81, 0xC2, 0x8E, 0x6B, 0x24, 0x21, 0x86, 0x29, 0x7E, 0xC3, 0x26,
+0x32, 0x80, 0x31, 0x6A, 0x9C, 0xF2, 0xF6, 0x96, 0xC1, 0xB8, 0xFF, 0xDA, 0xFF, 0xAF, 0xAB, 0xC3,
+0xD9, 0xFF, 0x15, 0xF7, 0x53, 0xFF, 0xEF, 0xF6, 0xAC, 0xC6, 0x0A, 0xBE, 0x06, 0x4C, 0xE4, 0x22,
+0x48, 0x63, 0x4E, 0xD4, 0x61, 0xC8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x10, 0x62, 0x96, 0xC3, 0x40,
+0xD8, 0x43, 0xC1, 0x55, 0xFE, 0x4B, 0x9C, 0x79, 0xC7, 0x68, 0x3B, 0x07, 0x2B, 0x43, 0x22, 0x21,
+0x32, 0xE2, 0x5A, 0x66, 0x94, 0x4D, 0xCE, 0x72, 0xF7, 0x93, 0x4B, 0xC2, 0x95, 0xFF, 0x71, 0xE6,
+0xEB, 0xB4, 0x97, 0xC2, 0x0C, 0x8C, 0x27, 0x42, 0xC5, 0x29, 0x9F, 0x8D, 0xC0, 0x4E, 0x54, 0xA1,
+0xC1, 0x4B, 0x43, 0x06, 0x32, 0xA2, 0xBA, 0x00, 0x91, 0x9A, 0xC0, 0x89, 0x4A, 0xAF, 0x42, 0xC0,
+0x48, 0x3A, 0xA5, 0xC0, 0x64, 0x21, 0x42, 0xC0, 0x28, 0x42, 0x81, 0xBE, 0xC2, 0xAA, 0x52, 0x0C,
+0x5B, 0xE7, 0x39, 0x85, 0xC1, 0x08, 0x3A, 0x89, 0x42, 0x67, 0xC1, 0x85, 0x19, 0x6D, 0x5B, 0x64,
+0xC3, 0xAE, 0x63, 0x0F, 0x64, 0x0A, 0x2B, 0x0D, 0x44, 0x6A, 0xC1, 0x6B, 0x43, 0x68, 0x32, 0x58,
+0x95, 0xC0, 0x2B, 0x53, 0xAF, 0x40, 0x58, 0xBB, 0x7B, 0x62, 0xC1, 0x74, 0xA5, 0x58, 0xC6, 0x91,
+0xC1, 0x70, 0x84, 0xAE, 0x73, 0x5F, 0xC0, 0xBA, 0xD6, 0x6A, 0x56, 0xC4, 0x7C, 0xE7, 0xB5, 0xAD,
+0x0B, 0x53, 0xE6, 0x29, 0x68, 0x3A, 0x44, 0xC0, 0x89, 0x3A, 0x64, 0x44, 0x41, 0xC1, 0x2B, 0x4B,
+0xEE, 0x63, 0x69, 0xC2, 0x06, 0x22, 0xCE, 0x5B, 0x2F, 0x6C, 0x65, 0x48, 0xAE, 0xC2, 0x50, 0x74,
+0x13, 0x8D, 0x0F, 0x74, 0x00, 0x78, 0xC7, 0xC5, 0x21, 0x88, 0x3A, 0xF6, 0xAD, 0xA9, 0x42, 0x07,
+0x32, 0x88, 0x42, 0x54, 0x9D, 0xEA, 0x52, 0x53, 0x91, 0xC0, 0x91, 0x84, 0xAB, 0xC3, 0x29, 0x3A,
+0xA7, 0x21, 0xEF, 0x6B, 0xB2, 0x84, 0x7F, 0xAE, 0xC0, 0x48, 0x3A, 0x00, 0xBE, 0xA7, 0xC4, 0x10,
+0x7C, 0xB2, 0x8C, 0xF7, 0xBD, 0x7D, 0xE7, 0xFF, 0xFF, 0x91, 0xC2, 0xBB, 0xD6, 0xB7, 0xB5, 0x14,
+0x9D, 0x40, 0xC4, 0xE5, 0x29, 0xA2, 0x31, 0x26, 0x6B, 0x6D, 0xC5, 0x12, 0xF7, 0x5C, 0xA6, 0xC0,
+0xF8, 0xFF, 0xA9, 0x5C, 0xC1, 0x52, 0xFF, 0x92, 0xFF, 0x94, 0xC7, 0x0A, 0xBE, 0x85, 0x7C, 0x63,
+0x2B, 0x86, 0x3B, 0x88, 0x63, 0x6E, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x5A, 0xC5,
+0x40, 0xD8, 0x43, 0xC1, 0x55, 0xFE, 0x4B, 0xA4, 0xE9, 0x63, 0x89, 0x3B, 0x81, 0xCE, 0xA6, 0x2A,
+0x43, 0x2A, 0x41, 0x3A, 0xC2, 0x52, 0x84, 0x6B, 0x06, 0x84, 0x6D, 0xB5, 0x0D, 0xAD, 0x8B, 0xA4,
+0x46, 0x7B, 0x22, 0x52, 0x85, 0x5A, 0xA9, 0x52, 0xA6, 0x29, 0xE7, 0x29, 0x99, 0xC1, 0x26, 0x1A,
+0x6F, 0x5C, 0xBA, 0xC0, 0x6B, 0x4B, 0x58, 0x53, 0x42, 0xA6, 0x00, 0x6E, 0x42, 0xC0, 0x65, 0x29,
+0x80, 0xC5, 0x89, 0x42, 0xA5, 0x29, 0x40, 0x00, 0x81, 0x00, 0x68, 0x42, 0xCA, 0x4A, 0x42, 0x7A,
+0x01, 0xC1, 0xE7, 0x31, 0x28, 0x32, 0x64, 0x50, 0x64, 0xC1, 0x6D, 0x53, 0x69, 0x32, 0xBA, 0x9E,
+0xC3, 0x67, 0x1A, 0x2D, 0x4C, 0x6E, 0x54, 0x4A, 0x3B, 0x41, 0x6C, 0xC0, 0xEA, 0x52, 0x00, 0xC1,
+0x88, 0x42, 0x2B, 0x5B, 0xA6, 0xC0, 0x07, 0x3A, 0xBA, 0xC0, 0x45, 0x29, 0x99, 0xC1, 0x28, 0x42,
+0x4C, 0x6B, 0x00, 0xC4, 0x8A, 0x52, 0xCA, 0x5A, 0xAE, 0x73, 0x50, 0x84, 0xCE, 0x73, 0xBF, 0xC2,
+0xD2, 0x94, 0x1B, 0xD7, 0xB1, 0x84, 0x6C, 0xC1, 0xA9, 0x42, 0x47, 0x32, 0xAF, 0xA6, 0xC0, 0xE7,
+0x29, 0x9E, 0xBF, 0xC0, 0xC6, 0x19, 0x50, 0xC6, 0x4C, 0x4B, 0x44, 0x09, 0x85, 0x19, 0x2F, 0x74,
+0x3B, 0xD7, 0xFF, 0xF7, 0xB5, 0xA5, 0x67, 0xC5, 0xA9, 0x4A, 0x0B, 0x53, 0x06, 0x2A, 0x4B, 0x5B,
+0x7C, 0xDF, 0xEE, 0x73, 0x4C, 0x43, 0xC0, 0xFA, 0xD6, 0x62, 0x7F, 0xC1, 0x27, 0x3A, 0x38, 0xBE,
+0xBA, 0xC0, 0x08, 0x3A, 0x91, 0xC3, 0x96, 0xAD, 0xDA, 0xD6, 0xCA, 0x52, 0xE6, 0x31, 0xBB, 0x91,
+0x56, 0x49, 0xC0, 0x48, 0x42, 0x42, 0xC5, 0x49, 0x42, 0x2C, 0x63, 0x30, 0x84, 0xB7, 0xB5, 0x5D,
+0xE7, 0xFF, 0xFF, 0x86, 0xC0, 0x8D, 0x5B, 0x6C, 0xC8, 0x63, 0x29, 0xC2, 0x41, 0x87, 0x7B, 0x6D,
+0xBD, 0xF2, 0xEE, 0xD5, 0xFF, 0x33, 0xF7, 0x73, 0xFF, 0xB3, 0xFF, 0xA5, 0x90, 0xC8, 0x6C, 0xCE,
+0xE7, 0x8C, 0xA3, 0x4B, 0x64, 0x2B, 0x87, 0x3B, 0x89, 0x63, 0x6E, 0xD4, 0xA2, 0xD0, 0x00, 0xF8,
+0xE0, 0x13, 0x9A, 0xC5, 0x61, 0xE0, 0x63, 0xC1, 0x55, 0xFE, 0x6B, 0xA4, 0x09, 0x64, 0xA8, 0x3B,
+0x87, 0xC2, 0x28, 0x2B, 0x86, 0x2A, 0x24, 0x2A, 0xA0, 0xB6, 0xBE, 0x61, 0xBE, 0xBF, 0xA5, 0x92,
+0xC0, 0x26, 0x42, 0x7B, 0xC1, 0xE8, 0x29, 0x28, 0x32, 0x80, 0xC4, 0x26, 0x22, 0xB0, 0x6C, 0xF1,
+0x74, 0xED, 0x53, 0x88, 0x3A, 0x58, 0xC1, 0x68, 0x42, 0x07, 0x32, 0x4E, 0x42, 0x00, 0xC0, 0x65,
+0x29, 0x91, 0xC2, 0x48, 0x42, 0xC9, 0x4A, 0xA5, 0x21, 0x91, 0xC0, 0xA9, 0x4A, 0x4F, 0x7A, 0x96,
+0x7F, 0x4E, 0x5F, 0x00, 0xC0, 0x69, 0x32, 0xA5, 0xC1, 0x6C, 0x53, 0x2F, 0x64, 0xA5, 0xC5, 0x89,
+0x3A, 0xE6, 0x19, 0x47, 0x12, 0x6E, 0x54, 0xD0, 0x5C, 0xAC, 0x4B, 0x71, 0xCD, 0x2E, 0x7C, 0xB9,
+0xD6, 0x3B, 0xE7, 0x74, 0xAD, 0xB1, 0x94, 0xCE, 0x7B, 0xCA, 0x5A, 0x2C, 0x63, 0x28, 0x42, 0x00,
+0x00, 0xC3, 0x18, 0xE8, 0x41, 0x69, 0x52, 0x08, 0x42, 0x5B, 0x60, 0x92, 0xC7, 0xAA, 0x52, 0x49,
+0x42, 0x8D, 0x6B, 0x17, 0xB6, 0xCE, 0x6B, 0xEA, 0x4A, 0x4F, 0x7C, 0xAD, 0x63, 0x73, 0x01, 0x78,
+0x95, 0x96, 0xA5, 0x58, 0xC3, 0x0B, 0x4B, 0x4C, 0x53, 0x95, 0xA5, 0xFF, 0xF7, 0x00, 0xC0, 0x74,
+0xA5, 0x6A, 0xC1, 0xCA, 0x52, 0x70, 0x84, 0x7F, 0xC3, 0xA9, 0x42, 0xDD, 0xEF, 0x33, 0x9D, 0xA5,
+0x29, 0x00, 0xC1, 0x99, 0xCE, 0x95, 0xAD, 0x56, 0xA1, 0xC2, 0x58, 0xC6, 0x1C, 0xE7, 0x69, 0x4A,
+0x7D, 0xC1, 0x14, 0xA5, 0xDB, 0xDE, 0x4D, 0x59, 0xC5, 0x0B, 0x63, 0x6D, 0x6B, 0x0F, 0x84, 0xCB,
+0x5A, 0x04, 0x19, 0xC7, 0x31, 0x7D, 0x96, 0x00, 0xC5, 0xE8, 0x39, 0x6E, 0x6B, 0xB3, 0x94, 0x14,
+0x95, 0x6D, 0x53, 0x8A, 0x3A, 0x7A, 0xC5, 0x43, 0x29, 0xE3, 0x41, 0x46, 0x73, 0x0B, 0xAD, 0x4F,
+0xDE, 0xF2, 0xF6, 0xAE, 0xA5, 0xCA, 0x6E, 0xDE, 0x8A, 0xAD, 0x66, 0x7C, 0x84, 0x43, 0x03, 0x2B,
+0x85, 0x2B, 0xC7, 0x3B, 0xA9, 0x6B, 0x6E, 0xD4, 0xA2, 0xD0, 0x00, 0xF8, 0xE0, 0x13, 0x9A, 0xC5,
+0x61, 0xE0, 0x64, 0xC9, 0x55, 0xFE, 0x6C, 0xA4, 0x29, 0x64, 0xA8, 0x3B, 0x8B, 0xC2, 0x49, 0x2B,
+0xC8, 0x22, 0x47, 0x22, 0xB1, 0xB9, 0x4C, 0xC0, 0xA4, 0x29, 0xBB, 0xAE, 0x00, 0x76, 0xC1, 0x07,
+0x3A, 0x29, 0x32, 0x96, 0xA9, 0x99, 0xAE, 0xC4, 0x2E, 0x5C, 0xF1, 0x74, 0x8F, 0x6C, 0x6B, 0x4B,
+0x67, 0x32, 0x49, 0xA6, 0xBB, 0x7A, 0x00, 0x7D, 0xC2, 0x44, 0x21, 0x85, 0x21, 0xEA, 0x4A, 0xBE,
+0x00, 0xC2, 0xA9, 0x42, 0x27, 0x3A, 0xC6, 0x29, 0x00, 0x7A, 0xC0, 0x49, 0x3A, 0x9A, 0xA5, 0xC0,
+0xAA, 0x3A, 0x91, 0xC0, 0x6C, 0x53, 0x95, 0xC1, 0x0E, 0x64, 0x4C, 0x53, 0x41, 0xC9, 0x67, 0x1A,
+0x2E, 0x4C, 0x6E, 0x54, 0x8B, 0x43, 0x47, 0x32, 0x0E, 0x7C, 0x5B, 0xEF, 0xBD, 0xFF, 0xB1, 0x9C,
+0xC9, 0x5A, 0xA7, 0xC1, 0x4C, 0x73, 0xD2, 0x9C, 0xA6, 0xC2, 0x66, 0x31, 0xE8, 0x41, 0x49, 0x4A,
+0xA6, 0xC0, 0xC8, 0x41, 0x99, 0xA6, 0x73, 0x5B, 0x4C, 0xC0, 0x8A, 0x4A, 0xAE, 0xC1, 0x07, 0x32,
+0x8C, 0x63, 0xAF, 0xC2, 0xEE, 0x6B, 0x8D, 0x5B, 0x89, 0x3A, 0x5F, 0xC0, 0x8A, 0x3A, 0xAD, 0x91,
+0x5F, 0x41, 0xC9, 0x48, 0x32, 0xA9, 0x42, 0x74, 0x9D, 0xDE, 0xEF, 0xFF, 0xFF, 0x1B, 0xDF, 0xB5,
+0xB5, 0x54, 0xA5, 0xB5, 0xAD, 0x2B, 0x5B, 0xA6, 0xC3, 0xFA, 0xD6, 0xD6, 0xB5, 0x4C, 0x63, 0xAA,
+0x52, 0x42, 0xCA, 0x17, 0xBE, 0x4C, 0x6B, 0xCA, 0x5A, 0x95, 0xB5, 0xFB, 0xE6, 0xEF, 0x7B, 0x2C,
+0x6B, 0x71, 0x94, 0xDA, 0xDE, 0x91, 0x94, 0x34, 0xAD, 0x55, 0xC0, 0x5D, 0xEF, 0xA9, 0xC2, 0x55,
+0xAD, 0xCB, 0x52, 0x08, 0x3A, 0xA5, 0xC0, 0x28, 0x3A, 0x00, 0xC0, 0xA7, 0x29, 0xA9, 0x6E, 0xC0,
+0xAA, 0x42, 0x9B, 0xA1, 0xA1, 0xA1, 0xC4, 0xA5, 0x39, 0xE3, 0x41, 0xA4, 0x5A, 0x45, 0x73, 0x49,
+0x94, 0xA1, 0x90, 0xC4, 0x65, 0x73, 0xE2, 0x52, 0x82, 0x32, 0xE4, 0x2A, 0xA7, 0x2B, 0xAD, 0xC4,
+0xE8, 0x43, 0xC9, 0x6B, 0x6E, 0xD4, 0xA1, 0xD0, 0x00, 0xF8, 0xE0, 0x13, 0x9A, 0xC5, 0x81, 0xE0,
+0x84, 0xC9, 0x55, 0xFE, 0x6B, 0xA4, 0x09, 0x6C, 0xC9, 0x43, 0x86, 0xC2, 0x29, 0x23, 0xA8, 0x1A,
+0x27, 0x1A, 0xA2, 0xC0, 0x07, 0x2A, 0xBF, 0x96, 0xA6, 0xA5, 0xA5, 0x41, 0xC1, 0xE8, 0x31, 0x4A,
+0x32, 0xAF, 0x57, 0x00, 0x84, 0xC4, 0xE9, 0x3A, 0x2D, 0x5C, 0xF0, 0x74, 0x8F, 0x6C, 0x4A, 0x4B,
+0x49, 0xA6, 0xC1, 0x27, 0x32, 0xC6, 0x31, 0x7A, 0xBF, 0x90, 0xBF, 0xC2, 0x06, 0x32, 0x68, 0x3A,
+0x2B, 0x5B, 0x43, 0xC0, 0xE6, 0x31, 0x7A, 0xAE, 0xBF, 0xAF, 0xC0, 0x49, 0x3A, 0x5F, 0xC0, 0x89,
+0x3A, 0x50, 0xC6, 0x89, 0x32, 0xC5, 0x19, 0x47, 0x2A, 0x4C, 0x53, 0x07, 0x22, 0xA8, 0x22, 0x6E,
+0x4C, 0xBA, 0xCB, 0x6B, 0x43, 0x84, 0x19, 0x47, 0x42, 0xB1, 0x9C, 0xD2, 0xAC, 0x89, 0x5A, 0x03,
+0x29, 0xC6, 0x41, 0xCA, 0x62, 0x91, 0x9C, 0x38, 0xCE, 0x69, 0x52, 0xA6, 0x7C, 0xAB, 0xC2, 0xC8,
+0x41, 0x25, 0x29, 0x66, 0x31, 0x43, 0xC2, 0xCC, 0x5A, 0xE8, 0x39, 0x49, 0x42, 0x4A, 0x53, 0xC0,
+0x47, 0x3A, 0x61, 0xC4, 0x27, 0x32, 0xAE, 0x63, 0x8A, 0x42, 0x28, 0x32, 0x69, 0x3A, 0x00, 0x78,
+0x73, 0x5F, 0xC8, 0xA6, 0x21, 0xE6, 0x29, 0xCE, 0x6B, 0x95, 0xAD, 0xF6, 0xBD, 0x54, 0xAD, 0xEF,
+0x7B, 0xCA, 0x5A, 0x0B, 0x63, 0x96, 0xC1, 0x8A, 0x52, 0x2C, 0x63, 0x55, 0x96, 0xC0, 0x49, 0x4A,
+0x55, 0x61, 0x4D, 0x55, 0xC2, 0x6D, 0x73, 0x10, 0x84, 0xEA, 0x5A, 0x55, 0x00, 0x69, 0x7C, 0x55,
+0xC0, 0x2C, 0x6B, 0x91, 0x75, 0x00, 0x4D, 0xC0, 0x07, 0x3A, 0x4E, 0x02, 0x9A, 0xBF, 0xC0, 0x49,
+0x32, 0x81, 0xBB, 0xBF, 0xBA, 0xA4, 0x90, 0xBC, 0xC1, 0x24, 0x42, 0xC2, 0x39, 0x00, 0xAE, 0xC0,
+0x23, 0x3A, 0x9E, 0x8F, 0xC7, 0x07, 0x23, 0xEA, 0x33, 0xE7, 0x2B, 0x08, 0x44, 0xEA, 0x73, 0x6E,
+0xD4, 0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x13, 0x9A, 0xC5, 0x81, 0xE0, 0x84, 0xC9, 0x55, 0xFE, 0x4B,
+0x9C, 0x09, 0x64, 0xC9, 0x4B, 0x62, 0xC2, 0x49, 0x2B, 0xA9, 0x1A, 0x28, 0x1A, 0x45, 0xBA, 0xBF,
+0x96, 0x00, 0xAB, 0xBA, 0xBA, 0x00, 0x9F, 0xAD, 0x57, 0xBE, 0xC0, 0xA5, 0x19, 0x72, 0xC5, 0xE8,
+0x32, 0x4D, 0x64, 0x11, 0x7D, 0x6F, 0x6C, 0x6B, 0x53, 0x88, 0x3A, 0x58, 0x53, 0xBB, 0xBE, 0x91,
+0xC7, 0x48, 0x42, 0x64, 0x21, 0x06, 0x32, 0x8D, 0x63, 0xEE, 0x73, 0x69, 0x42, 0x65, 0x21, 0xC7,
+0x31, 0x76, 0x4E, 0xC0, 0x6A, 0x42, 0x6B, 0x57, 0x48, 0xC1, 0x89, 0x32, 0xC9, 0x3A, 0xAB, 0xA6,
+0xC2, 0x27, 0x22, 0xA8, 0x22, 0x8F, 0x54, 0xBE, 0xCC, 0xCC, 0x4B, 0xE5, 0x29, 0xE6, 0x39, 0x0B,
+0x6B, 0xAD, 0x83, 0x48, 0x5A, 0x24, 0x31, 0xE7, 0x49, 0x2C, 0x73, 0x33, 0xAD, 0x1B, 0xEF, 0x8A,
+0x5A, 0xCB, 0x62, 0xA9, 0x4B, 0x01, 0xAB, 0xC4, 0xCB, 0x5A, 0x4D, 0x6B, 0xE8, 0x39, 0x28, 0x3A,
+0xAE, 0x6B, 0x60, 0xAF, 0xC0, 0xAC, 0x5B, 0xA6, 0xC0, 0x69, 0x3A, 0xBF, 0x76, 0x96, 0x01, 0x95,
+0x91, 0x62, 0xC0, 0xAA, 0x4A, 0xA5, 0x6A, 0xC3, 0x6C, 0x6B, 0x30, 0x8C, 0x6D, 0x73, 0x28, 0x4A,
+0x74, 0xC0, 0xAA, 0x5A, 0x74, 0xC0, 0xC7, 0x39, 0xBA, 0xC0, 0x69, 0x52, 0x74, 0x91, 0x65, 0xC0,
+0x89, 0x52, 0x96, 0x00, 0x41, 0x68, 0xAE, 0xC0, 0xE7, 0x41, 0x91, 0x54, 0x00, 0x40, 0x91, 0xAE,
+0xC0, 0xE7, 0x39, 0x79, 0x4E, 0xC0, 0xEB, 0x52, 0xAE, 0xC0, 0x48, 0x3A, 0x73, 0xAE, 0x91, 0x9A,
+0xAB, 0xA6, 0xB6, 0xBF, 0x00, 0x5D, 0x62, 0xC1, 0x68, 0x42, 0x06, 0x32, 0xA9, 0xAF, 0xC0, 0x67,
+0x3A, 0x9E, 0x8E, 0xC7, 0x28, 0x23, 0xA9, 0x2B, 0x08, 0x2C, 0x49, 0x4C, 0x0A, 0x74, 0x6E, 0xD4,
+0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x13, 0x9A, 0xC5, 0x81, 0xE0, 0x84, 0xC9, 0x35, 0xFE, 0x2B, 0x9C,
+0xE9, 0x63, 0xA9, 0x4B, 0x8A, 0x82, 0xC1, 0xE9, 0x22, 0x68, 0x22, 0xA1, 0x00, 0xBF, 0x81, 0xAB,
+0xBB, 0x59, 0xBA, 0xBF, 0xC0, 0x4B, 0x3A, 0x99, 0xA5, 0xAE, 0xC0, 0x06, 0x22, 0x91, 0xC3, 0x26,
+0x22, 0xE8, 0x32, 0x4E, 0x64, 0xAF, 0x74, 0x7F, 0xD0, 0x2B, 0x4B, 0x48, 0x3A, 0xC6, 0x29, 0xE7,
+0x39, 0x28, 0x42, 0xC6, 0x39, 0x07, 0x3A, 0xA5, 0x29, 0xCD, 0x6B, 0xB5, 0xAD, 0x17, 0xBE, 0x0F,
+0x7C, 0x0C, 0x5B, 0xCF, 0x73, 0x8A, 0x4A, 0xE8, 0x31, 0x8A, 0x42, 0x95, 0xC0, 0x08, 0x32, 0x64,
+0x75, 0xC0, 0x0E, 0x64, 0x92, 0xC0, 0x07, 0x2A, 0x85, 0xC1, 0x27, 0x12, 0x4E, 0x4C, 0xBA, 0xC1,
+0x6B, 0x43, 0x48, 0x3A, 0xB5, 0x7B, 0xBA, 0xC0, 0x28, 0x5A, 0x96, 0xC5, 0x89, 0x62, 0x4D, 0x73,
+0xD3, 0xA4, 0x54, 0xB5, 0x07, 0x4A, 0x0B, 0x6B, 0xAE, 0xC2, 0x89, 0x5A, 0xEB, 0x62, 0xAE, 0x7B,
+0x00, 0xC2, 0x2C, 0x6B, 0x6E, 0x6B, 0x49, 0x42, 0xA9, 0xC3, 0x2B, 0x53, 0xA5, 0x21, 0x47, 0x32,
+0x2A, 0x4B, 0x5D, 0xA7, 0xBF, 0xA1, 0x5F, 0x42, 0xA5, 0x00, 0xC0, 0x0B, 0x53, 0xA6, 0xC0, 0x2C,
+0x63, 0x79, 0xC1, 0xA6, 0x31, 0xCA, 0x5A, 0x48, 0xC1, 0xCE, 0x83, 0x28, 0x4A, 0xA6, 0xC0, 0xA7,
+0x41, 0x96, 0xA5, 0xC0, 0x09, 0x4A, 0x95, 0xAF, 0xBE, 0x79, 0x6F, 0x7D, 0xC0, 0x27, 0x42, 0x68,
+0x00, 0x5E, 0xC0, 0xC6, 0x39, 0x54, 0x68, 0x40, 0x95, 0xC0, 0xC7, 0x39, 0x51, 0x65, 0xC0, 0x69,
+0x42, 0x95, 0xC2, 0x91, 0x84, 0x13, 0x8D, 0x71, 0x74, 0xBE, 0xC3, 0xEF, 0x63, 0x89, 0x32, 0x27,
+0x2A, 0xA9, 0x3A, 0x75, 0xA5, 0x73, 0x6B, 0x92, 0x00, 0xAE, 0xA9, 0x95, 0xA6, 0x4D, 0x9E, 0xC0,
+0x88, 0x1A, 0x41, 0xC6, 0xC8, 0x2B, 0x28, 0x2C, 0x69, 0x4C, 0x0B, 0x74, 0x6E, 0xD4, 0x81, 0xD0,
+0x00, 0xF8, 0xE0, 0x13, 0x9A, 0xC5, 0x81, 0xE0, 0x84, 0xC9, 0x34, 0xFE, 0x0A, 0x9C, 0xE9, 0x63,
+0xA8, 0x4B, 0x8B, 0xC2, 0x49, 0x2B, 0xC8, 0x22, 0x67, 0x22, 0x4B, 0xBA, 0xBE, 0x4B, 0x55, 0xBF,
+0xA7, 0xB2, 0xC0, 0x2A, 0x3A, 0x7C, 0x91, 0xC1, 0x4A, 0x3A, 0x8A, 0x3A, 0x99, 0x61, 0x80, 0xC7,
+0xA4, 0x11, 0x2A, 0x43, 0x6F, 0x6C, 0xB0, 0x74, 0x4F, 0x6C, 0xAD, 0x5B, 0x68, 0x3A, 0xE7, 0x31,
+0x62, 0x51, 0xC9, 0x28, 0x42, 0xEE, 0x73, 0x3A, 0xDF, 0xDE, 0xF7, 0x5C, 0xE7, 0xB6, 0xB5, 0x79,
+0xC6, 0xDF, 0xF7, 0xF0, 0x73, 0x08, 0x32, 0x73, 0x01, 0x6C, 0xC4, 0x64, 0x19, 0x0B, 0x4B, 0x89,
+0x3A, 0x07, 0x2A, 0x48, 0x22, 0x9E, 0xC0, 0xB0, 0x54, 0xA1, 0xC1, 0x2A, 0x3B, 0x48, 0x3A, 0xB1,
+0xC1, 0x34, 0xB5, 0xD3, 0xAC, 0x00, 0xC2, 0x39, 0xDE, 0x71, 0x9C, 0x45, 0x31, 0x91, 0xC0, 0x61,
+0x10, 0xBE, 0xC1, 0xE6, 0x41, 0xAA, 0x5A, 0x91, 0x91, 0x74, 0xC5, 0x2C, 0x6B, 0x51, 0x8C, 0x0C,
+0x63, 0xC6, 0x31, 0x48, 0x42, 0xCA, 0x4A, 0x95, 0xC1, 0x4B, 0x53, 0x06, 0x2A, 0x6C, 0xC1, 0x8A,
+0x42, 0x29, 0x3A, 0x91, 0xC1, 0x2C, 0x5B, 0x91, 0x8C, 0x91, 0xBE, 0xC1, 0x37, 0xC6, 0x6C, 0x6B,
+0x51, 0xC0, 0x65, 0x29, 0x51, 0x74, 0x70, 0xC2, 0x4D, 0x73, 0x49, 0x52, 0xE8, 0x49, 0xAF, 0xC1,
+0x4A, 0x52, 0xA7, 0x39, 0x6A, 0x91, 0x6A, 0xA9, 0x96, 0xAE, 0xC1, 0xA6, 0x39, 0x89, 0x52, 0x65,
+0x59, 0x00, 0x68, 0x91, 0x68, 0xC0, 0xC7, 0x41, 0x54, 0x60, 0x59, 0x79, 0x9A, 0x80, 0xC0, 0xAD,
+0x63, 0x96, 0x95, 0xC0, 0xD2, 0x7C, 0x91, 0xC1, 0xEA, 0x3A, 0x89, 0x32, 0x61, 0xA5, 0xBE, 0x73,
+0x9B, 0x91, 0x9A, 0x00, 0x99, 0x00, 0xA6, 0x96, 0xAE, 0xC8, 0x88, 0x12, 0x48, 0x1B, 0xE8, 0x2B,
+0x28, 0x34, 0x6A, 0x54, 0x0B, 0x7C, 0x4E, 0xDC, 0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D,
+0xAB, 0xC5, 0x41, 0xE0, 0xE5, 0xD1, 0x14, 0xFE, 0x0A, 0x94, 0xE8, 0x63, 0x08, 0x4C, 0x8B, 0xC2,
+0x69, 0x2B, 0xE9, 0x2A, 0x67, 0x2A, 0xB6, 0xA0, 0xC1, 0x45, 0x42, 0xE3, 0x31, 0xBF, 0xA6, 0xC4,
+0x25, 0x42, 0x27, 0x4A, 0xCB, 0x5A, 0x2A, 0x3A, 0x8C, 0x3A, 0x90, 0xA4, 0x6B, 0x01, 0xC0, 0xE7,
+0x21, 0xA5, 0xC5, 0xEA, 0x3A, 0xD1, 0x74, 0x12, 0x7D, 0xB0, 0x6C, 0xCD, 0x5B, 0x68, 0x32, 0x58,
+0xC0, 0x48, 0x4A, 0x54, 0xCA, 0xCE, 0x7B, 0xD1, 0x9C, 0xD5, 0xBD, 0x33, 0xAD, 0x2F, 0x8C, 0x91,
+0x94, 0xF3, 0x9C, 0x0B, 0x5B, 0xE7, 0x29, 0x89, 0x3A, 0xCA, 0x42, 0x75, 0xA1, 0x00, 0xC2, 0xA9,
+0x42, 0x2B, 0x53, 0x27, 0x2A, 0x9A, 0xC6, 0x87, 0x1A, 0x8F, 0x54, 0xD0, 0x64, 0x8C, 0x43, 0x07,
+0x2A, 0xAA, 0x52, 0xCF, 0x7B, 0xBA, 0xC4, 0x72, 0x9C, 0x14, 0xA5, 0x8F, 0x7B, 0x46, 0x31, 0x42,
+0x10, 0x90, 0xC6, 0x82, 0x18, 0x86, 0x39, 0x49, 0x52, 0xCB, 0x62, 0x6A, 0x52, 0x08, 0x42, 0xEC,
+0x62, 0x6C, 0x5C, 0xC7, 0xC7, 0x31, 0x48, 0x42, 0xAA, 0x4A, 0xAD, 0x6B, 0xF2, 0x94, 0x2B, 0x5B,
+0x07, 0x3A, 0x8A, 0x42, 0xBF, 0xC0, 0xE7, 0x31, 0xA5, 0xC1, 0xF2, 0xA4, 0x97, 0xD6, 0xA2, 0xC1,
+0xAC, 0x7B, 0xC5, 0x39, 0xAB, 0xC3, 0x69, 0x4A, 0xA6, 0x31, 0xA3, 0x18, 0x8A, 0x52, 0x6F, 0xC0,
+0x29, 0x4A, 0x01, 0x60, 0xBA, 0xC1, 0x49, 0x52, 0x8A, 0x5A, 0x43, 0x90, 0x6F, 0x00, 0x60, 0x68,
+0xC0, 0x69, 0x52, 0x5C, 0xBE, 0x54, 0x68, 0xC0, 0xC7, 0x39, 0x63, 0x54, 0x47, 0x68, 0x6D, 0x9E,
+0xC0, 0xE6, 0x31, 0x9A, 0xC0, 0xA8, 0x3A, 0x46, 0xC2, 0x43, 0x09, 0x0A, 0x43, 0xCE, 0x5B, 0x75,
+0x91, 0xC0, 0x8A, 0x32, 0xB5, 0x91, 0xAB, 0xAE, 0x9F, 0x94, 0xAD, 0xC0, 0x06, 0x12, 0xBB, 0xAF,
+0x9A, 0xC2, 0x67, 0x0A, 0x47, 0x13, 0x29, 0x2C, 0xB9, 0xC4, 0xC8, 0x43, 0xEB, 0x83, 0x2E, 0xDC,
+0x61, 0xD0, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D, 0x00, 0xC5, 0x40, 0xE0, 0xE5, 0xC9, 0x34, 0xFE,
+0x2A, 0x94, 0xE8, 0x63, 0xAA, 0x5C, 0x82, 0xC6, 0x49, 0x2B, 0x87, 0x22, 0xE4, 0x21, 0x24, 0x3A,
+0xE6, 0x62, 0x2A, 0x8C, 0xD0, 0xBD, 0x91, 0xC4, 0xED, 0xAC, 0xC9, 0x83, 0x24, 0x4A, 0x47, 0x4A,
+0x09, 0x3A, 0x97, 0xAD, 0x6B, 0xA6, 0x91, 0x66, 0x72, 0xC0, 0xA7, 0x21, 0x84, 0xC2, 0xEA, 0x3A,
+0x2E, 0x5C, 0x11, 0x75, 0xBE, 0xC2, 0x8C, 0x53, 0x88, 0x3A, 0x07, 0x3A, 0x7D, 0xC5, 0x27, 0x42,
+0xED, 0x83, 0x57, 0xD6, 0xD9, 0xE6, 0x78, 0xDE, 0xB9, 0xDE, 0x00, 0xC1, 0xB1, 0x94, 0x28, 0x3A,
+0x9E, 0x96, 0x55, 0x64, 0xA5, 0xBE, 0xC0, 0xE9, 0x4A, 0x71, 0x81, 0xC1, 0xA8, 0x22, 0x6F, 0x5C,
+0x9A, 0xC3, 0x4B, 0x3B, 0x07, 0x22, 0x89, 0x42, 0xE8, 0x41, 0x95, 0xA6, 0xC8, 0xE8, 0x39, 0x67,
+0x29, 0xA3, 0x10, 0x43, 0x10, 0x00, 0x00, 0x62, 0x10, 0x66, 0x31, 0x29, 0x4A, 0xCB, 0x5A, 0x00,
+0xC1, 0x6A, 0x4A, 0x0C, 0x63, 0x6C, 0xC0, 0x2C, 0x63, 0x42, 0xBF, 0xC2, 0x28, 0x42, 0x69, 0x4A,
+0xEB, 0x5A, 0x51, 0xAF, 0xAF, 0xC0, 0xA7, 0x29, 0x42, 0xC2, 0xE9, 0x5A, 0x97, 0xDE, 0xDC, 0xFF,
+0xA5, 0xC3, 0xF5, 0xC5, 0xA8, 0x5A, 0x4C, 0x6B, 0xF3, 0x9C, 0xAF, 0xC3, 0x4E, 0x6B, 0xAB, 0x5A,
+0xEC, 0x62, 0x49, 0x52, 0x48, 0x91, 0x00, 0xC0, 0xAA, 0x5A, 0x5C, 0x43, 0x90, 0x00, 0x96, 0x74,
+0x68, 0x74, 0x00, 0x48, 0xC0, 0xEB, 0x62, 0x65, 0x74, 0xC0, 0xC6, 0x39, 0x92, 0xBE, 0xC0, 0x08,
+0x4A, 0x4C, 0xC3, 0x69, 0x52, 0x33, 0xA5, 0x70, 0x84, 0x6B, 0x5B, 0xAE, 0x7E, 0xC0, 0x0A, 0x43,
+0xAF, 0xA6, 0xC1, 0x89, 0x32, 0xCA, 0x32, 0xBB, 0xC0, 0x08, 0x2A, 0x5F, 0xC0, 0x8A, 0x42, 0x5F,
+0xC0, 0xE5, 0x19, 0xAE, 0xA9, 0x00, 0xBB, 0xC1, 0x46, 0x22, 0x87, 0x22, 0x9E, 0xC7, 0x26, 0x13,
+0xC7, 0x1B, 0x28, 0x2C, 0xA8, 0x43, 0xCB, 0x83, 0x0E, 0xE4, 0x61, 0xD0, 0x00, 0xF8, 0xE0, 0x11,
+0xAE, 0x5D, 0x00, 0xC5, 0x20, 0xD8, 0xE5, 0xC9, 0x34, 0xFE, 0x2B, 0x9C, 0xE9, 0x63, 0x2A, 0x54,
+0x9F, 0xC6, 0x07, 0x33, 0x03, 0x22, 0xA4, 0x4A, 0x0C, 0xA5, 0x91, 0xDE, 0x53, 0xFF, 0xB5, 0xFF,
+0xA9, 0xA6, 0xA2, 0xC2, 0x4F, 0xBD, 0xAB, 0x83, 0x89, 0x4A, 0x97, 0x90, 0x96, 0x57, 0xBF, 0xAE,
+0x57, 0x91, 0xCC, 0x48, 0x2A, 0xA5, 0x11, 0x87, 0x22, 0xCC, 0x4B, 0xD0, 0x6C, 0x0D, 0x5C, 0xC9,
+0x3A, 0xC6, 0x31, 0x44, 0x29, 0xE1, 0x20, 0x4A, 0x73, 0x97, 0xDE, 0xFD, 0xFF, 0x01, 0xA6, 0xC3,
+0x37, 0xC6, 0xCA, 0x4A, 0x48, 0x32, 0xE7, 0x29, 0x64, 0x4F, 0xC6, 0x0B, 0x53, 0x4B, 0x63, 0xAD,
+0x6B, 0x89, 0x42, 0x06, 0x22, 0xA8, 0x2A, 0xD0, 0x64, 0x96, 0xC2, 0xAC, 0x43, 0x48, 0x2A, 0x49,
+0x3A, 0xA1, 0xA6, 0x91, 0xBE, 0xAB, 0x58, 0xC3, 0x87, 0x39, 0x00, 0x00, 0x42, 0x10, 0x66, 0x29,
+0x4C, 0xC1, 0x6A, 0x4A, 0xAB, 0x52, 0x74, 0x48, 0xC0, 0xEB, 0x5A, 0x91, 0xC0, 0xA6, 0x31, 0x51,
+0xC2, 0x4C, 0x6B, 0x8D, 0x73, 0x2C, 0x63, 0xBA, 0xC6, 0x92, 0x94, 0xCE, 0x6B, 0x86, 0x29, 0x02,
+0x19, 0x26, 0x4A, 0xB3, 0xC5, 0x96, 0xE6, 0x9A, 0xC3, 0x14, 0xCE, 0xC9, 0x62, 0xAD, 0x73, 0x54,
+0xAD, 0xAB, 0xC3, 0x4D, 0x6B, 0x08, 0x42, 0x6A, 0x52, 0xEC, 0x62, 0x90, 0x74, 0xBE, 0x78, 0x96,
+0xC0, 0x28, 0x4A, 0x4C, 0x68, 0x74, 0x50, 0x48, 0x50, 0x48, 0x00, 0x70, 0x50, 0x81, 0xC0, 0xE7,
+0x39, 0x4C, 0x5B, 0xBE, 0xC2, 0x86, 0x39, 0xCB, 0x5A, 0x99, 0xCE, 0xAE, 0xC1, 0x90, 0x7C, 0xE9,
+0x42, 0x9A, 0xC0, 0x4B, 0x4B, 0x92, 0xC0, 0x48, 0x2A, 0x96, 0xC0, 0x68, 0x2A, 0xBB, 0xA1, 0xC0,
+0x69, 0x42, 0x00, 0xC0, 0xE5, 0x29, 0xBD, 0xC4, 0x84, 0x3A, 0xC4, 0x42, 0x25, 0x53, 0xC4, 0x4A,
+0x42, 0x32, 0x9A, 0xC2, 0x83, 0x22, 0x26, 0x1B, 0x08, 0x2C, 0x00, 0xC4, 0xA7, 0x3B, 0xCB, 0x83,
+0x2E, 0xE4, 0x61, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x20, 0xD8, 0xE5, 0xC9, 0x34, 0xFE, 0x2B,
+0x9C, 0x09, 0x6C, 0x27, 0x33, 0x96, 0xC3, 0x84, 0x32, 0x45, 0x5B, 0xEB, 0xA4, 0x12, 0xF7, 0xBE,
+0xC0, 0x8F, 0xEE, 0x81, 0xC0, 0x8F, 0xE6, 0xBE, 0xC4, 0x94, 0xFF, 0xD7, 0xFF, 0x12, 0xD6, 0xAB,
+0x7B, 0x27, 0x42, 0x9A, 0xAB, 0xAF, 0xC0, 0x8A, 0x42, 0x96, 0xC0, 0x08, 0x32, 0x9A, 0xCC, 0x49,
+0x32, 0xC6, 0x19, 0x06, 0x1A, 0x4A, 0x3B, 0xD0, 0x6C, 0x6F, 0x64, 0xC9, 0x3A, 0x85, 0x21, 0xE2,
+0x18, 0x40, 0x08, 0x86, 0x5A, 0x72, 0xC5, 0x76, 0xE6, 0x01, 0x9B, 0xC0, 0x94, 0xB5, 0x73, 0xC5,
+0x68, 0x3A, 0x07, 0x2A, 0x48, 0x32, 0x89, 0x42, 0xCE, 0x6B, 0xD2, 0x9C, 0x99, 0xC1, 0xAD, 0x6B,
+0xC5, 0x19, 0x9E, 0xC0, 0xB0, 0x64, 0x00, 0xC0, 0xAC, 0x4B, 0x66, 0xB2, 0xC0, 0x49, 0x42, 0x60,
+0x92, 0x58, 0x00, 0xC2, 0x6E, 0x6B, 0xD0, 0x83, 0xC4, 0x18, 0x90, 0xC0, 0x85, 0x29, 0xBB, 0xC1,
+0x28, 0x42, 0xAA, 0x52, 0x91, 0x00, 0x48, 0xA9, 0xC0, 0x07, 0x42, 0xA6, 0xC6, 0x13, 0xA5, 0x95,
+0xB5, 0x50, 0x8C, 0x96, 0xBD, 0xFB, 0xE6, 0x95, 0xAD, 0x68, 0x42, 0x7F, 0xC2, 0x63, 0x31, 0x6D,
+0x94, 0xAE, 0xA4, 0x91, 0x9B, 0xC4, 0xE5, 0x41, 0x67, 0x4A, 0x4C, 0x63, 0xAA, 0x52, 0xC3, 0x18,
+0xAE, 0xC1, 0x29, 0x4A, 0x6A, 0x5A, 0x95, 0x95, 0xC1, 0x69, 0x52, 0x0C, 0x63, 0xA5, 0x68, 0xC0,
+0xC7, 0x39, 0x68, 0x00, 0x48, 0x7C, 0x48, 0x7C, 0x96, 0x48, 0x79, 0x65, 0xC0, 0xC6, 0x39, 0x68,
+0x6F, 0x63, 0x68, 0x5C, 0xC5, 0x50, 0x8C, 0x2B, 0x5B, 0xC9, 0x42, 0xA4, 0x21, 0x63, 0x09, 0x06,
+0x22, 0xBF, 0xAB, 0xC1, 0xCA, 0x3A, 0x48, 0x22, 0x61, 0xBA, 0xA1, 0xC4, 0x63, 0x29, 0x45, 0x42,
+0xAC, 0x94, 0xCF, 0xB5, 0xB1, 0xD6, 0xBE, 0xC5, 0x2F, 0xCE, 0x2B, 0xA5, 0x27, 0x74, 0x03, 0x3B,
+0xC3, 0x1A, 0xA6, 0x2B, 0x67, 0xC4, 0x87, 0x3B, 0xCA, 0x7B, 0x2E, 0xDC, 0x81, 0xD0, 0x00, 0xF8,
+0xE0, 0x14, 0xC8, 0x20, 0xD8, 0xE5, 0xC9, 0x34, 0xFE, 0x2B, 0x9C, 0x09, 0x6C, 0x89, 0x43, 0x43,
+0x1A, 0x82, 0x3A, 0x2B, 0xAD, 0x44, 0xBB, 0xC0, 0x0E, 0xDE, 0x00, 0xC0, 0x4F, 0xE6, 0x00, 0xC0,
+0x8B, 0xCD, 0xA6, 0xC5, 0x70, 0xE6, 0x55, 0xFF, 0x11, 0xCE, 0x44, 0x4A, 0xE6, 0x39, 0x69, 0x42,
+0x00, 0xC0, 0xE8, 0x29, 0xA6, 0xC0, 0x49, 0x3A, 0x00, 0xC0, 0xC6, 0x21, 0x66, 0xCA, 0x64, 0x09,
+0x26, 0x1A, 0xED, 0x53, 0x4F, 0x64, 0xEA, 0x42, 0x86, 0x21, 0xE2, 0x18, 0x40, 0x08, 0x45, 0x5A,
+0xAE, 0xAC, 0x30, 0xC5, 0x95, 0x92, 0xC3, 0x31, 0xBD, 0xF1, 0xA4, 0xE9, 0x5A, 0x07, 0x32, 0x5F,
+0x91, 0x53, 0xC1, 0xD2, 0x94, 0x5B, 0xEF, 0x91, 0x86, 0xC5, 0x6C, 0x53, 0x26, 0x22, 0x90, 0x64,
+0xD1, 0x64, 0xCD, 0x4B, 0x88, 0x2A, 0x5F, 0xBE, 0xA2, 0xAE, 0xBF, 0x5D, 0xC2, 0x72, 0x8C, 0xD8,
+0xBD, 0xC8, 0x39, 0x41, 0xC0, 0xA6, 0x29, 0xA6, 0xC1, 0x07, 0x3A, 0xCA, 0x5A, 0x00, 0xAB, 0xAE,
+0xC0, 0x07, 0x42, 0x00, 0x68, 0xC0, 0x3C, 0xEF, 0xA5, 0xC3, 0x91, 0x94, 0xD6, 0xC5, 0x71, 0x94,
+0x8D, 0x6B, 0x5B, 0xA5, 0xC2, 0x04, 0x42, 0xCF, 0xA4, 0x30, 0xB5, 0x00, 0xC2, 0x92, 0xBD, 0x0D,
+0x8C, 0xA8, 0x52, 0x92, 0xC3, 0xC6, 0x31, 0x41, 0x08, 0xC3, 0x18, 0x49, 0x52, 0x00, 0x91, 0x68,
+0xC1, 0x69, 0x52, 0xAB, 0x5A, 0xAE, 0x91, 0x7C, 0x00, 0xAB, 0x57, 0x48, 0x5C, 0x57, 0xC0, 0x49,
+0x4A, 0x00, 0x65, 0xA6, 0xA5, 0x60, 0xA6, 0x63, 0x74, 0x60, 0xC2, 0x89, 0x4A, 0xC5, 0x29, 0x47,
+0x3A, 0xAE, 0xC1, 0xA8, 0x3A, 0x0A, 0x43, 0x91, 0xC0, 0x48, 0x2A, 0xAB, 0x00, 0xBE, 0xC0, 0x06,
+0x32, 0xB4, 0xC3, 0xA4, 0x52, 0xEB, 0xA4, 0x74, 0xF7, 0xD4, 0xFF, 0xA6, 0xA1, 0xA5, 0xC0, 0x92,
+0xFF, 0x80, 0xC5, 0x69, 0x9D, 0xA3, 0x4B, 0x23, 0x2B, 0xE7, 0x2B, 0x66, 0x33, 0xAA, 0x73, 0x58,
+0xC1, 0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC9, 0x41, 0xE0, 0xE5, 0xD1, 0x34, 0xFE, 0x2A, 0x94,
+0xE9, 0x63, 0x89, 0x43, 0x84, 0x2A, 0x84, 0x63, 0x2D, 0xD6, 0xAF, 0xF6, 0xA7, 0xC1, 0xF4, 0xFE,
+0xD8, 0xFF, 0xA6, 0xA0, 0xCB, 0xF3, 0xF6, 0xAD, 0xCD, 0xC9, 0xB4, 0x70, 0xE6, 0xD6, 0xFF, 0x4A,
+0x94, 0xE5, 0x39, 0xE7, 0x39, 0xAA, 0x4A, 0x6E, 0x63, 0xCB, 0x4A, 0xA7, 0x29, 0x00, 0xC0, 0x49,
+0x3A, 0x64, 0xC2, 0x84, 0x11, 0xA8, 0x2A, 0x2E, 0x5C, 0xBB, 0xC1, 0x69, 0x32, 0x45, 0x19, 0xB9,
+0xC3, 0x40, 0x10, 0xA5, 0x6A, 0x0E, 0xBD, 0x2F, 0xCD, 0x00, 0x96, 0x9F, 0x9F, 0xC6, 0xC9, 0x52,
+0x06, 0x32, 0x28, 0x32, 0xC6, 0x21, 0x65, 0x21, 0x70, 0x8C, 0x9C, 0xFF, 0x9A, 0x82, 0xC6, 0xEE,
+0x6B, 0x68, 0x2A, 0x8F, 0x64, 0xF1, 0x6C, 0x90, 0x64, 0x2B, 0x43, 0xA9, 0x3A, 0x67, 0xA6, 0xC0,
+0x6A, 0x42, 0xBE, 0xC3, 0x08, 0x3A, 0x92, 0x8C, 0x39, 0xC6, 0x86, 0x31, 0x5A, 0xC0, 0xC6, 0x31,
+0x91, 0xC1, 0xE7, 0x31, 0x69, 0x4A, 0x00, 0xBE, 0xA6, 0x95, 0x59, 0xCA, 0x48, 0x52, 0xBD, 0xFF,
+0xFB, 0xE6, 0x50, 0x94, 0xD6, 0xC5, 0xEA, 0x62, 0x68, 0x4A, 0x43, 0x21, 0x83, 0x31, 0x66, 0x52,
+0xAE, 0xA4, 0xAE, 0xC8, 0x10, 0xAD, 0x92, 0xBD, 0x7A, 0xEF, 0x8F, 0x8C, 0x0E, 0x7C, 0x91, 0x8C,
+0xEB, 0x5A, 0x29, 0x4A, 0xCB, 0x5A, 0x91, 0xC0, 0x28, 0x4A, 0xAF, 0x7C, 0x48, 0x5C, 0xC0, 0x0C,
+0x63, 0x00, 0x5C, 0x00, 0xC0, 0x2C, 0x6B, 0x70, 0xC0, 0x6D, 0x73, 0x96, 0x48, 0x74, 0x00, 0x91,
+0x41, 0x74, 0xC1, 0xA7, 0x39, 0x08, 0x4A, 0x91, 0x68, 0xC2, 0xB2, 0x94, 0xAD, 0x6B, 0x88, 0x3A,
+0x90, 0xC1, 0x8C, 0x53, 0x6F, 0x74, 0x82, 0xC1, 0x2C, 0x4B, 0x08, 0x22, 0xBF, 0xC4, 0x69, 0x32,
+0xA4, 0x29, 0xC6, 0x5A, 0x8D, 0xB5, 0x32, 0xEF, 0xBE, 0xC1, 0x8F, 0xE6, 0x0E, 0xDE, 0xA6, 0xA0,
+0xC8, 0x0B, 0xDE, 0x0E, 0xF7, 0x90, 0xEF, 0xEB, 0xAD, 0xE4, 0x4B, 0xC6, 0x2B, 0x66, 0x2B, 0xAA,
+0x73, 0x4E, 0xDC, 0x69, 0xC0, 0x00, 0xF0, 0xBA, 0xAE, 0x5D, 0xE0, 0x10, 0xAF, 0xC5, 0x61, 0xE0,
+0x06, 0xD2, 0x34, 0xFE, 0x0A, 0x94, 0xC8, 0x63, 0xA5, 0x2A, 0xBD, 0xC4, 0x87, 0x8C, 0x8D, 0xE6,
+0x6E, 0xF6, 0xF3, 0xFE, 0x9A, 0xFF, 0x4D, 0x59, 0xA4, 0xC6, 0xDA, 0xFF, 0x35, 0xFF, 0x0B, 0xB5,
+0xC8, 0xAC, 0x51, 0xFF, 0x2F, 0xD6, 0x04, 0x42, 0x51, 0xD0, 0xEF, 0x7B, 0xFB, 0xD6, 0x39, 0xC6,
+0x0C, 0x5B, 0xA7, 0x29, 0x28, 0x3A, 0xC6, 0x21, 0xA9, 0x3A, 0x94, 0x95, 0x3B, 0xC7, 0xF6, 0x9D,
+0xAA, 0x42, 0x04, 0x11, 0x03, 0x21, 0x20, 0x10, 0xC5, 0x6A, 0x0E, 0xC5, 0xBE, 0xBA, 0x9B, 0x9A,
+0xC2, 0x51, 0xBD, 0xE9, 0x5A, 0x27, 0x3A, 0x9B, 0xCD, 0x86, 0x21, 0xC2, 0x08, 0x27, 0x42, 0xEE,
+0x8B, 0x2F, 0x8C, 0xCE, 0x7B, 0x48, 0x3A, 0xA5, 0x19, 0x6C, 0x43, 0x4F, 0x5C, 0xF1, 0x6C, 0xEE,
+0x5B, 0x2B, 0x4B, 0x69, 0x3A, 0xBE, 0x92, 0xBE, 0x91, 0xC0, 0xB2, 0x8C, 0x6C, 0xC3, 0xC7, 0x39,
+0x65, 0x21, 0xE6, 0x31, 0x85, 0x29, 0xAE, 0xBF, 0xA6, 0xBE, 0x91, 0xBF, 0x45, 0xC1, 0x27, 0x4A,
+0x99, 0xD6, 0x00, 0xC7, 0xD1, 0x9C, 0xB5, 0xBD, 0xEE, 0x83, 0x4C, 0x6B, 0x64, 0x29, 0xC1, 0x20,
+0x66, 0x52, 0x72, 0xB5, 0xA9, 0xC0, 0xB3, 0xBD, 0xA5, 0xC5, 0x15, 0xC6, 0x0D, 0x7C, 0x4F, 0x84,
+0x74, 0xAD, 0x30, 0x84, 0xEB, 0x5A, 0xA1, 0xC0, 0x28, 0x4A, 0xAF, 0x00, 0xA6, 0xC2, 0x69, 0x52,
+0xCB, 0x5A, 0x4D, 0x6B, 0xA5, 0x5C, 0x74, 0xC0, 0xEB, 0x62, 0xAF, 0xC0, 0x8E, 0x73, 0x44, 0x6F,
+0x90, 0xC0, 0x28, 0x42, 0x4C, 0xC0, 0x69, 0x4A, 0x74, 0xC1, 0xC7, 0x41, 0x08, 0x4A, 0x40, 0x5C,
+0xC5, 0x79, 0xCE, 0x1A, 0xD7, 0x90, 0x84, 0xCD, 0x63, 0x6F, 0x74, 0xAD, 0x5B, 0x91, 0xAF, 0xC0,
+0x69, 0x32, 0xAB, 0xB9, 0xC4, 0xA3, 0x31, 0xE8, 0x83, 0xF1, 0xEE, 0x31, 0xF7, 0xAF, 0xE6, 0xA7,
+0xC0, 0xF4, 0xF6, 0xB5, 0xC3, 0x2F, 0xEE, 0x29, 0xCD, 0x88, 0xCD, 0x2E, 0xF7, 0x85, 0xC5, 0x27,
+0x8D, 0xA4, 0x33, 0x46, 0x2B, 0x89, 0x73, 0x2E, 0xDC, 0xA2, 0xD0, 0x5A, 0x5D, 0xAE, 0x5D, 0xE0,
+0x10, 0x69, 0xCB, 0x61, 0xE0, 0x06, 0xD2, 0x34, 0xFE, 0x0A, 0x94, 0xA8, 0x5B, 0x27, 0x3B, 0xA3,
+0x32, 0x45, 0x8C, 0xAE, 0xEE, 0xD0, 0xFE, 0x55, 0xFF, 0xBD, 0xFF, 0x93, 0xAB, 0xAD, 0xC0, 0x7A,
+0xFF, 0xAC, 0xC2, 0x71, 0xE6, 0x67, 0xA4, 0x4D, 0xE6, 0x61, 0xC3, 0xE7, 0x62, 0xEB, 0x5A, 0xB2,
+0x94, 0xFF, 0xF7, 0xBA, 0xC2, 0x9A, 0xCE, 0xF0, 0x73, 0xC7, 0x31, 0x72, 0xC2, 0x68, 0x3A, 0xD6,
+0x9D, 0xFF, 0xEF, 0x91, 0xC0, 0x72, 0x84, 0x49, 0xC0, 0xA2, 0x18, 0xB4, 0xC1, 0x26, 0x7B, 0x4F,
+0xCD, 0xA0, 0xAB, 0xAE, 0x97, 0x4E, 0xC1, 0x87, 0x52, 0x07, 0x3A, 0x9E, 0xA2, 0xC0, 0x03, 0x19,
+0xA5, 0xC1, 0x64, 0x39, 0xC5, 0x41, 0x65, 0x9A, 0xC4, 0xE6, 0x21, 0xC9, 0x32, 0x8C, 0x43, 0xF1,
+0x74, 0x90, 0x6C, 0x4D, 0xC1, 0x69, 0x3A, 0xEA, 0x4A, 0x76, 0xAE, 0xBB, 0xC2, 0xB2, 0x8C, 0x96,
+0xAD, 0x44, 0x21, 0x66, 0xC0, 0xC6, 0x31, 0xA5, 0xAB, 0x00, 0xA5, 0xC1, 0xC6, 0x39, 0x65, 0x31,
+0x71, 0xC0, 0x07, 0x42, 0x71, 0xC5, 0x2F, 0x8C, 0x74, 0xAD, 0x70, 0x8C, 0x12, 0xA5, 0xD5, 0xB5,
+0xB1, 0x94, 0x45, 0xC2, 0xA1, 0x18, 0x8C, 0x73, 0xFD, 0xFF, 0xA9, 0xC6, 0x5A, 0xF7, 0x56, 0xCE,
+0x67, 0x52, 0xC5, 0x31, 0x06, 0x3A, 0x48, 0x4A, 0xC6, 0x31, 0x45, 0x6D, 0xA2, 0x7C, 0x91, 0x91,
+0x74, 0xC1, 0xEB, 0x62, 0x2C, 0x6B, 0x64, 0xC5, 0x8A, 0x52, 0x08, 0x42, 0xEC, 0x62, 0x6D, 0x73,
+0xEF, 0x83, 0x6E, 0x73, 0x68, 0x54, 0xC0, 0x49, 0x4A, 0x6D, 0x51, 0x54, 0x00, 0xAB, 0x54, 0x7C,
+0xC2, 0x71, 0x8C, 0xD2, 0x94, 0x0A, 0x4B, 0x95, 0x00, 0xC3, 0x23, 0x09, 0x84, 0x11, 0x2B, 0x43,
+0x69, 0x32, 0x92, 0xB4, 0xC5, 0x44, 0x4A, 0x4D, 0xB5, 0x72, 0xFF, 0xAF, 0xE6, 0xF2, 0xEE, 0xF9,
+0xFF, 0xA6, 0xA2, 0xCB, 0x96, 0xFF, 0xB0, 0xF6, 0x68, 0xCD, 0xE9, 0xD5, 0xCC, 0xEE, 0xAC, 0xCE,
+0xA4, 0x33, 0x25, 0x2B, 0x89, 0x73, 0x2E, 0xDC, 0xA2, 0xD8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0,
+0x0F, 0x62, 0x5D, 0xCB, 0x41, 0xE0, 0x05, 0xD2, 0x34, 0xFE, 0x4B, 0x9C, 0xA8, 0x5B, 0x07, 0x3B,
+0xC4, 0x32, 0x67, 0x94, 0x8E, 0xEE, 0x11, 0xFF, 0x56, 0xFF, 0xDE, 0xFF, 0x97, 0xCC, 0x5F, 0xE7,
+0x9F, 0xF7, 0x9C, 0xFF, 0x78, 0xFF, 0x55, 0xFF, 0x87, 0xAC, 0x0C, 0xDE, 0xF1, 0xF6, 0xAB, 0x7B,
+0x28, 0x42, 0x71, 0x8C, 0xDF, 0xF7, 0x7E, 0xEF, 0x69, 0xCC, 0x5D, 0xEF, 0x35, 0xA5, 0x28, 0x3A,
+0x44, 0x19, 0x27, 0x32, 0x70, 0x7C, 0x7D, 0xE7, 0xFB, 0xD6, 0x8B, 0x52, 0xE3, 0x20, 0xC0, 0x20,
+0x47, 0x83, 0x4E, 0xCD, 0xBF, 0xA1, 0xC0, 0x70, 0xDD, 0x8B, 0xC3, 0xF0, 0xB4, 0x05, 0x42, 0x88,
+0x4A, 0xC6, 0x29, 0x62, 0xC2, 0x2C, 0x5B, 0x44, 0x29, 0x43, 0x39, 0xAB, 0xC7, 0x28, 0x4A, 0x34,
+0x9D, 0xCA, 0x42, 0xC6, 0x19, 0x26, 0x1A, 0xEE, 0x53, 0xF2, 0x7C, 0xEE, 0x63, 0xA6, 0xC0, 0xCA,
+0x4A, 0x91, 0x62, 0xC0, 0xCA, 0x52, 0x91, 0xC4, 0x08, 0x3A, 0x81, 0x08, 0x00, 0x00, 0xE3, 0x18,
+0xC6, 0x39, 0x65, 0x6D, 0x00, 0xA1, 0x45, 0xAE, 0x71, 0xC4, 0xC5, 0x39, 0xCD, 0x73, 0x57, 0xC6,
+0x1A, 0xDF, 0x94, 0xA5, 0xA6, 0xC0, 0x71, 0x8C, 0x54, 0xC6, 0x20, 0x08, 0xC6, 0x41, 0xF2, 0xA4,
+0x98, 0xD6, 0x36, 0xCE, 0xD5, 0xBD, 0x26, 0x42, 0xAF, 0xA2, 0xAE, 0x40, 0xC1, 0x03, 0x21, 0xEB,
+0x62, 0x7C, 0x00, 0x60, 0x00, 0xC1, 0x8A, 0x52, 0x2C, 0x6B, 0xAB, 0x95, 0x00, 0x48, 0xC0, 0xCB,
+0x5A, 0x00, 0xA5, 0x48, 0x7C, 0x74, 0x7C, 0x74, 0x54, 0x60, 0x68, 0xC0, 0xA7, 0x39, 0xBE, 0x74,
+0x5E, 0x85, 0xC0, 0x47, 0x3A, 0x9A, 0xAE, 0xC3, 0xAC, 0x5B, 0x0E, 0x64, 0x89, 0x32, 0xE7, 0x21,
+0xBE, 0xC2, 0xC4, 0x29, 0xE5, 0x62, 0xD2, 0xE6, 0xB9, 0xC2, 0x34, 0xFF, 0x98, 0xFF, 0xFC, 0xFF,
+0xAB, 0xA0, 0xA8, 0x46, 0xC9, 0x8E, 0xEE, 0x06, 0xBD, 0xAB, 0xF6, 0x8C, 0xD6, 0x47, 0x54, 0x26,
+0x33, 0x49, 0x73, 0xED, 0xDB, 0x41, 0xD0, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x10, 0x62, 0x5D, 0xC5,
+0x41, 0xE0, 0x05, 0xD2, 0x14, 0xFE, 0x4B, 0x9C, 0x88, 0x5B, 0xE7, 0x32, 0xA4, 0xC5, 0x87, 0x94,
+0xAF, 0xEE, 0x32, 0xFF, 0x97, 0xFF, 0xFD, 0xFF, 0x9F, 0xF7, 0x9A, 0xA0, 0x4B, 0x42, 0xC8, 0x13,
+0xF7, 0xC8, 0xAC, 0x6D, 0xEE, 0xB1, 0xEE, 0x49, 0x6B, 0xE7, 0x39, 0xB2, 0x94, 0x5D, 0xE7, 0x93,
+0x8C, 0xA5, 0xCC, 0xDC, 0xDE, 0xFF, 0xFF, 0x18, 0xC6, 0x71, 0x8C, 0xAE, 0x6B, 0x13, 0x95, 0xBE,
+0xEF, 0xDB, 0xD6, 0x6B, 0x52, 0xA2, 0x18, 0xC0, 0x28, 0x67, 0x83, 0x4F, 0xC5, 0xBA, 0xC0, 0xED,
+0xC4, 0x46, 0xC3, 0x91, 0xCD, 0x10, 0xB5, 0xA8, 0x5A, 0x07, 0x3A, 0x81, 0xC2, 0xCA, 0x4A, 0x4C,
+0x63, 0x65, 0x31, 0xB4, 0x9B, 0x54, 0xC2, 0xF3, 0x94, 0x2C, 0x53, 0x89, 0x32, 0x80, 0xBF, 0xC1,
+0x6C, 0x4B, 0x13, 0x8D, 0xA5, 0xA6, 0xC1, 0x0F, 0x7C, 0x69, 0x42, 0xA5, 0xC2, 0xC6, 0x31, 0x24,
+0x21, 0x00, 0x00, 0x00, 0x70, 0xC1, 0x85, 0x31, 0x28, 0x4A, 0xAE, 0x68, 0x95, 0x54, 0x91, 0x99,
+0xC4, 0x89, 0x4A, 0xB1, 0x8C, 0xD5, 0xAD, 0x32, 0x95, 0x4B, 0x53, 0x7B, 0xA2, 0xC0, 0xC7, 0x39,
+0x55, 0xA6, 0xC3, 0x85, 0x31, 0xE6, 0x41, 0xA9, 0x52, 0xCD, 0x73, 0x46, 0x00, 0x56, 0xC0, 0xCA,
+0x5A, 0x96, 0xC0, 0x6D, 0x73, 0x95, 0x7C, 0xAF, 0xC0, 0x29, 0x4A, 0x68, 0x48, 0x64, 0xAB, 0x95,
+0x01, 0xC0, 0x0C, 0x63, 0x64, 0x92, 0x5C, 0x00, 0x64, 0xC0, 0x6D, 0x6B, 0x5C, 0xC0, 0x48, 0x4A,
+0x48, 0x7C, 0xC0, 0x08, 0x4A, 0x54, 0xAF, 0xC3, 0x6C, 0x6B, 0x47, 0x42, 0xE5, 0x29, 0x26, 0x2A,
+0x01, 0xC0, 0x48, 0x2A, 0x91, 0x61, 0xB6, 0xC6, 0xE4, 0x31, 0xA7, 0x7B, 0x54, 0xFF, 0xD2, 0xF6,
+0x56, 0xFF, 0xDC, 0xFF, 0xDE, 0xFF, 0x9F, 0xA5, 0xC8, 0xDB, 0xFF, 0x77, 0xFF, 0x12, 0xFF, 0xE7,
+0xC4, 0x09, 0xE6, 0x4B, 0xD6, 0x47, 0x5C, 0x46, 0x3B, 0x49, 0x73, 0x47, 0xC0, 0x61, 0xD0, 0x5D,
+0xAE, 0x5D, 0xE0, 0x10, 0x62, 0x5D, 0xCA, 0x41, 0xE0, 0x05, 0xD2, 0x14, 0xFE, 0x2B, 0x9C, 0x88,
+0x5B, 0x07, 0x33, 0x84, 0x2A, 0x06, 0x7C, 0x6E, 0xDE, 0x52, 0xFF, 0x75, 0xFF, 0x50, 0xC1, 0xFE,
+0xFF, 0x7D, 0xF7, 0xA9, 0xC4, 0xFB, 0xFF, 0x96, 0xFF, 0x2F, 0xDE, 0x6A, 0xC5, 0x10, 0xFF, 0x6F,
+0x67, 0xC6, 0xC7, 0x31, 0xB6, 0xAD, 0xFF, 0xFF, 0xD0, 0x73, 0xC8, 0x31, 0xF0, 0x7B, 0xB7, 0xB5,
+0x71, 0x00, 0x85, 0x5A, 0x5F, 0xC5, 0x55, 0xA5, 0xC8, 0x39, 0x81, 0x18, 0x20, 0x08, 0x06, 0x73,
+0x70, 0xC5, 0xBE, 0xC1, 0x2F, 0xCD, 0x91, 0xD5, 0x9B, 0xC2, 0x10, 0xAD, 0xA8, 0x52, 0x07, 0x32,
+0xAF, 0x91, 0xC2, 0x65, 0x21, 0xA5, 0x39, 0xEA, 0x6A, 0x96, 0xC2, 0x0B, 0x63, 0xCF, 0x73, 0x48,
+0x3A, 0x9E, 0x95, 0xC0, 0xA5, 0x11, 0x69, 0xC1, 0xB5, 0xA5, 0x9D, 0xE7, 0x71, 0xC2, 0xBA, 0xD6,
+0xCE, 0x7B, 0x4C, 0x63, 0x6D, 0xC1, 0x85, 0x29, 0xC2, 0x18, 0x91, 0xBF, 0xC1, 0x86, 0x31, 0x49,
+0x52, 0xA6, 0xC0, 0xC6, 0x41, 0x40, 0x54, 0x6D, 0xC7, 0xC5, 0x31, 0x48, 0x42, 0x4F, 0x7C, 0xB0,
+0x7C, 0xCC, 0x5B, 0x87, 0x32, 0xA5, 0x19, 0x29, 0x3A, 0xBA, 0xC1, 0x87, 0x31, 0x04, 0x21, 0xAE,
+0x78, 0x6A, 0xC2, 0x0B, 0x5B, 0xE6, 0x39, 0xEB, 0x5A, 0x7A, 0xC1, 0xB2, 0x94, 0x38, 0xC6, 0xBF,
+0xC2, 0x8E, 0x7B, 0x86, 0x39, 0x29, 0x4A, 0x95, 0x00, 0xC0, 0x49, 0x4A, 0x5C, 0xBE, 0xAB, 0xAE,
+0x6F, 0xC0, 0x8A, 0x52, 0x74, 0x6F, 0xC0, 0x69, 0x52, 0x00, 0xAB, 0xC1, 0x0B, 0x63, 0x6D, 0x6B,
+0x61, 0x70, 0x7C, 0x54, 0xA6, 0x5C, 0xC2, 0x58, 0xC6, 0xF2, 0x94, 0x2A, 0x53, 0x95, 0x96, 0xC0,
+0x27, 0x2A, 0x96, 0xC0, 0x48, 0x2A, 0xBF, 0x53, 0xC5, 0xC4, 0x31, 0xA7, 0x7B, 0x54, 0xFF, 0xF2,
+0xF6, 0x77, 0xFF, 0xFD, 0xFF, 0x71, 0x9A, 0x00, 0xB9, 0xC0, 0xB9, 0xFF, 0x4B, 0xC5, 0x28, 0xC5,
+0xE8, 0xE5, 0x8B, 0xDE, 0x67, 0x5C, 0x67, 0x3B, 0x69, 0x73, 0x47, 0xC0, 0x61, 0xD8, 0x5D, 0xAE,
+0x5D, 0xE0, 0x12, 0xCC, 0x61, 0xE0, 0x05, 0xD2, 0xF3, 0xFD, 0x2A, 0x94, 0x88, 0x5B, 0x48, 0x3B,
+0x63, 0x22, 0x44, 0x5B, 0xED, 0xC5, 0x32, 0xFF, 0x34, 0xFF, 0x78, 0xFF, 0xDB, 0xFF, 0x63, 0xA9,
+0xA8, 0xCF, 0x13, 0xEF, 0x2E, 0xDE, 0xCF, 0xEE, 0x51, 0xFF, 0x69, 0x9C, 0x25, 0x42, 0xC7, 0x31,
+0x72, 0x84, 0x9A, 0xC6, 0x6E, 0x63, 0x46, 0x21, 0xA7, 0x31, 0x29, 0x42, 0xAE, 0x73, 0xF7, 0xBD,
+0xDA, 0xCE, 0x00, 0xC3, 0xB6, 0xAD, 0xEB, 0x52, 0xE4, 0x18, 0x81, 0x10, 0x91, 0xC2, 0x89, 0x7B,
+0x95, 0xE6, 0x58, 0xFF, 0xA6, 0xAF, 0xC2, 0xF8, 0xEE, 0x36, 0xCE, 0xAC, 0x73, 0x53, 0x00, 0xC3,
+0xA6, 0x21, 0xE7, 0x31, 0x34, 0xA5, 0xFE, 0xFF, 0x00, 0xC4, 0x5D, 0xEF, 0x51, 0x84, 0xC7, 0x29,
+0x27, 0x2A, 0x89, 0x32, 0xA5, 0xC6, 0x07, 0x2A, 0x2B, 0x53, 0x34, 0x9D, 0xD6, 0xB5, 0xD2, 0x9C,
+0x0B, 0x63, 0xEF, 0x83, 0x00, 0xC3, 0x50, 0x8C, 0x13, 0xA5, 0x45, 0x29, 0xE3, 0x20, 0x7B, 0xC0,
+0x8A, 0x5A, 0x91, 0xC0, 0xA6, 0x39, 0xAF, 0xC8, 0x69, 0x4A, 0xAA, 0x52, 0xA5, 0x31, 0x48, 0x3A,
+0x90, 0x7C, 0xD1, 0x7C, 0x4E, 0x6C, 0x8B, 0x4B, 0x47, 0x2A, 0x5F, 0xC7, 0x4A, 0x42, 0xE8, 0x31,
+0x66, 0x21, 0xC7, 0x31, 0x69, 0x42, 0x0B, 0x53, 0x6D, 0x63, 0x68, 0x42, 0x66, 0x91, 0xC4, 0x28,
+0x42, 0x4D, 0x6B, 0xD3, 0x9C, 0xCF, 0x83, 0x08, 0x4A, 0x96, 0x54, 0x60, 0xC2, 0x69, 0x52, 0xCB,
+0x5A, 0x0C, 0x63, 0x01, 0xC0, 0x49, 0x4A, 0x5C, 0x01, 0x70, 0xC0, 0xAA, 0x5A, 0x7C, 0xC2, 0xEB,
+0x5A, 0x8D, 0x73, 0x2C, 0x6B, 0x70, 0x77, 0x5B, 0xA5, 0x70, 0xC2, 0x58, 0xC6, 0xF2, 0x94, 0x2A,
+0x53, 0x4A, 0xAF, 0xC0, 0xA9, 0x3A, 0x91, 0x92, 0x00, 0x5F, 0xC5, 0xA4, 0x29, 0xE4, 0x62, 0x70,
+0xDE, 0x33, 0xFF, 0x97, 0xFF, 0xFC, 0xFF, 0x71, 0x9A, 0x00, 0xB9, 0xCA, 0x78, 0xF7, 0xF3, 0xF6,
+0x8A, 0xCD, 0x4A, 0xEE, 0xAC, 0xDE, 0x26, 0x54, 0x67, 0x3B, 0x49, 0x73, 0xCD, 0xDB, 0x61, 0xD8,
+0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x12, 0xCC, 0x61, 0xE0, 0x06, 0xD2, 0xF3, 0xFD, 0x2A, 0x94, 0xA8,
+0x5B, 0x68, 0x43, 0xA4, 0x22, 0xE3, 0x42, 0xA9, 0x94, 0x4F, 0xD6, 0x12, 0xF7, 0x76, 0xFF, 0xB9,
+0xFF, 0xAE, 0x00, 0xC9, 0x96, 0xFF, 0xF2, 0xEE, 0x32, 0xF7, 0x93, 0xFF, 0xEE, 0xD5, 0x42, 0x52,
+0xC5, 0x39, 0xC7, 0x29, 0x49, 0x3A, 0xCC, 0x4A, 0x6E, 0x91, 0xA2, 0x49, 0xC3, 0x44, 0x21, 0x48,
+0x3A, 0xCA, 0x4A, 0x0E, 0x6C, 0xBF, 0xC2, 0x48, 0x32, 0x24, 0x19, 0xA1, 0x10, 0x91, 0xC1, 0x8A,
+0x73, 0xB7, 0xE6, 0x5C, 0x01, 0xC2, 0x9B, 0xFF, 0xD9, 0xDE, 0x2F, 0x7C, 0x67, 0x4F, 0xC3, 0x0B,
+0x53, 0x8A, 0x4A, 0x91, 0x94, 0x17, 0xCE, 0x95, 0xC2, 0x38, 0xC6, 0x4D, 0x63, 0x08, 0x32, 0x64,
+0x00, 0xC1, 0xA9, 0x3A, 0x07, 0x2A, 0xA1, 0xC5, 0xEF, 0x7B, 0x6D, 0x73, 0x49, 0x52, 0x85, 0x39,
+0xEB, 0x62, 0x4C, 0x6B, 0x61, 0xC4, 0x37, 0xC6, 0x85, 0x31, 0xE4, 0x20, 0x86, 0x39, 0xAA, 0x5A,
+0x43, 0xC6, 0xE8, 0x41, 0x69, 0x52, 0x2C, 0x63, 0xCA, 0x5A, 0x07, 0x3A, 0xEA, 0x4A, 0xD1, 0x84,
+0x85, 0xAE, 0xC5, 0x6F, 0x64, 0x4B, 0x43, 0x08, 0x2A, 0x6A, 0x42, 0x08, 0x3A, 0x86, 0x21, 0x00,
+0xC2, 0x07, 0x32, 0x48, 0x3A, 0xA9, 0x4A, 0x4F, 0x76, 0xA6, 0xC3, 0x44, 0x21, 0xE3, 0x18, 0x69,
+0x52, 0x6E, 0x73, 0x77, 0x96, 0xAE, 0x00, 0xC1, 0x8A, 0x52, 0xCB, 0x5A, 0xBF, 0x64, 0x5C, 0xC0,
+0x08, 0x42, 0x50, 0xAB, 0x64, 0xC0, 0x2C, 0x6B, 0x50, 0xC0, 0x28, 0x4A, 0x50, 0x75, 0xA5, 0x48,
+0x7C, 0x00, 0x60, 0x00, 0xC4, 0x0B, 0x5B, 0x47, 0x3A, 0xE5, 0x29, 0x46, 0x32, 0x88, 0x32, 0xBE,
+0xCB, 0x48, 0x2A, 0xE6, 0x19, 0x28, 0x2A, 0x6A, 0x3A, 0xE6, 0x31, 0x23, 0x4A, 0x6D, 0xBD, 0x94,
+0xFF, 0xD6, 0xFF, 0x98, 0xFF, 0xDB, 0xF7, 0xFE, 0xF7, 0xA5, 0xB9, 0xCA, 0x37, 0xF7, 0xD2, 0xEE,
+0x6D, 0xE6, 0xCC, 0xF6, 0x0A, 0xBE, 0xC5, 0x43, 0x46, 0x33, 0x49, 0x73, 0xCC, 0xD3, 0x61, 0xD0,
+0x00, 0xF8, 0xE0, 0x14, 0xC1, 0x61, 0xE0, 0x26, 0xD2, 0x59, 0xC9, 0x2B, 0x9C, 0xC9, 0x63, 0x48,
+0x3B, 0xE6, 0x2A, 0x62, 0x22, 0xA2, 0x42, 0x47, 0x8C, 0x4F, 0xD6, 0x95, 0xFF, 0xF7, 0xFF, 0xA2,
+0xAE, 0x6D, 0xA9, 0xC5, 0x73, 0xFF, 0x2F, 0xD6, 0x67, 0x7B, 0x61, 0x31, 0xC5, 0x31, 0xCB, 0x4A,
+0x91, 0xC0, 0xE8, 0x29, 0xAF, 0x7A, 0xA1, 0x00, 0xAD, 0x7F, 0xCA, 0x47, 0x32, 0x90, 0x74, 0xD1,
+0x7C, 0xC9, 0x3A, 0x85, 0x19, 0xA1, 0x00, 0x40, 0x00, 0xA7, 0x52, 0x11, 0xA5, 0x56, 0xCE, 0x77,
+0xDE, 0x9A, 0xC4, 0x16, 0xC6, 0xB5, 0xB5, 0x8D, 0x63, 0xCA, 0x4A, 0x8D, 0x5B, 0xA2, 0xC1, 0xA6,
+0x29, 0xE7, 0x39, 0xBA, 0xC0, 0x85, 0x31, 0x00, 0x9B, 0xC1, 0x08, 0x32, 0x48, 0x32, 0x00, 0xA6,
+0xA5, 0xBA, 0xC0, 0xEB, 0x62, 0x54, 0xC0, 0x86, 0x39, 0xBE, 0xC7, 0x0B, 0x6B, 0xEE, 0x83, 0x17,
+0xC6, 0xBD, 0xF7, 0x86, 0x31, 0x04, 0x21, 0xA7, 0x39, 0x8A, 0x52, 0x91, 0x91, 0x48, 0xC1, 0x0C,
+0x63, 0x49, 0x42, 0x53, 0xC1, 0x0B, 0x4B, 0x8C, 0x5B, 0x85, 0xC0, 0x6F, 0x64, 0xAE, 0xC1, 0x2E,
+0x5C, 0xAA, 0x3A, 0xB6, 0x5F, 0x95, 0xC0, 0x69, 0x3A, 0xAE, 0x91, 0x67, 0xC0, 0x0B, 0x53, 0x53,
+0xC2, 0x8A, 0x4A, 0xCB, 0x5A, 0x08, 0x42, 0x7B, 0xC1, 0xCB, 0x62, 0x4A, 0x52, 0x74, 0x01, 0x48,
+0x5C, 0xC0, 0x2C, 0x6B, 0x70, 0x5C, 0x54, 0xC0, 0x69, 0x52, 0x74, 0x00, 0x5C, 0xC1, 0x28, 0x4A,
+0xC7, 0x39, 0x48, 0xC0, 0xEB, 0x62, 0xAE, 0xC0, 0x6A, 0x52, 0x74, 0xBA, 0xC0, 0xC7, 0x41, 0x4C,
+0xC1, 0x89, 0x52, 0x27, 0x3A, 0x7D, 0xC2, 0x26, 0x2A, 0x67, 0x32, 0xEA, 0x42, 0x00, 0x61, 0xBF,
+0xA3, 0xC3, 0xE7, 0x31, 0xC3, 0x39, 0x6A, 0x9C, 0x12, 0xF7, 0x66, 0xA7, 0xC1, 0xF9, 0xFF, 0xFB,
+0xFF, 0xA5, 0xAE, 0xC1, 0x96, 0xFF, 0x52, 0xFF, 0xA8, 0xC7, 0xCD, 0xEE, 0x07, 0x95, 0x64, 0x33,
+0x46, 0x33, 0x69, 0x73, 0xCD, 0xD3, 0x81, 0xD0, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x81, 0xE8, 0x46,
+0xDA, 0x14, 0xFE, 0x4B, 0x9C, 0xE9, 0x63, 0x48, 0x3B, 0x86, 0xC7, 0x44, 0x1A, 0xE0, 0x19, 0xC1,
+0x4A, 0x46, 0x8C, 0xAB, 0xC5, 0xD0, 0xE6, 0x74, 0xF7, 0xB5, 0xFF, 0x95, 0xC3, 0x12, 0xEF, 0x6D,
+0xBD, 0xA8, 0x83, 0xA4, 0x39, 0x97, 0xC1, 0x49, 0x42, 0x4D, 0x5B, 0x96, 0xC0, 0x6A, 0x3A, 0x96,
+0xA9, 0x5A, 0xC0, 0x49, 0x3A, 0x80, 0xCA, 0xA5, 0x19, 0xE9, 0x3A, 0xD0, 0x74, 0x6F, 0x64, 0x0A,
+0x3B, 0x68, 0x2A, 0x84, 0x11, 0x01, 0x11, 0xC4, 0x31, 0xA8, 0x52, 0x2A, 0x63, 0xBA, 0xAF, 0xC1,
+0x8C, 0x73, 0xEE, 0x73, 0x96, 0xC4, 0x4C, 0x5B, 0xCA, 0x42, 0x28, 0x32, 0x44, 0x19, 0xE6, 0x31,
+0xA1, 0xC1, 0x44, 0x29, 0xAA, 0x52, 0x9A, 0x6E, 0x73, 0x4C, 0x5F, 0xC0, 0xC6, 0x29, 0xA1, 0xC2,
+0x48, 0x4A, 0xC6, 0x41, 0xAA, 0x62, 0x91, 0xC2, 0x07, 0x4A, 0xCA, 0x62, 0xD1, 0x9C, 0xAB, 0xC0,
+0x44, 0x21, 0x92, 0xC2, 0xA7, 0x39, 0x49, 0x4A, 0xE8, 0x39, 0xA5, 0xC0, 0x29, 0x4A, 0x74, 0xC2,
+0x86, 0x29, 0xC6, 0x29, 0x0A, 0x4B, 0xAF, 0xC4, 0xCD, 0x53, 0x94, 0x8D, 0xD0, 0x6C, 0x2E, 0x5C,
+0x68, 0x32, 0xA6, 0x00, 0xC1, 0xA9, 0x3A, 0xEB, 0x42, 0x7D, 0xA6, 0xC4, 0xEA, 0x4A, 0x68, 0x3A,
+0xEA, 0x52, 0x71, 0x84, 0x59, 0xCE, 0x00, 0xC2, 0x6E, 0x73, 0xEC, 0x6A, 0x4A, 0x52, 0xA9, 0x9A,
+0xA5, 0x74, 0xC1, 0xAB, 0x5A, 0x2C, 0x6B, 0x00, 0x91, 0x57, 0x78, 0x64, 0x96, 0xC1, 0x2D, 0x6B,
+0x8A, 0x52, 0x68, 0xC2, 0x0C, 0x63, 0xAA, 0x5A, 0x0B, 0x63, 0x50, 0xC0, 0x08, 0x4A, 0x00, 0xC2,
+0xA6, 0x39, 0x69, 0x52, 0x34, 0xA5, 0x80, 0xCD, 0xC9, 0x42, 0xE5, 0x29, 0x47, 0x2A, 0x0A, 0x43,
+0xCD, 0x5B, 0x2C, 0x4B, 0x6A, 0x32, 0xC8, 0x21, 0xE7, 0x31, 0xA4, 0x39, 0xE6, 0x6A, 0xEB, 0xAC,
+0xB0, 0xE6, 0xD5, 0xFF, 0xAB, 0xAB, 0x6D, 0xAE, 0xCA, 0x93, 0xFF, 0x50, 0xFF, 0xEE, 0xEE, 0x89,
+0xB5, 0xA3, 0x63, 0x43, 0x23, 0x66, 0x33, 0xAA, 0x7B, 0x0D, 0xDC, 0xA2, 0xD0, 0x00, 0xF8, 0xE0,
+0x14, 0xC5, 0x82, 0xE8, 0x47, 0xD2, 0x34, 0xFE, 0x4B, 0x9C, 0x0A, 0x6C, 0x49, 0x3B, 0x9F, 0xC2,
+0x08, 0x2B, 0xA5, 0x2A, 0x62, 0x3A, 0xA0, 0xC2, 0xA1, 0x52, 0xE6, 0x83, 0xCA, 0x9C, 0xAF, 0xC2,
+0x49, 0x8C, 0x66, 0x6B, 0x23, 0x4A, 0xAB, 0xC1, 0x65, 0x29, 0x09, 0x3A, 0x95, 0xAE, 0xAF, 0xC0,
+0x69, 0x32, 0xBF, 0x70, 0x6B, 0xAD, 0xA5, 0xC2, 0xE5, 0x21, 0xE9, 0x3A, 0xAC, 0x53, 0x91, 0xC6,
+0x0E, 0x64, 0x90, 0x74, 0x6C, 0x53, 0x0A, 0x53, 0x88, 0x4A, 0x06, 0x3A, 0x85, 0x31, 0x95, 0xC1,
+0xC6, 0x39, 0xCA, 0x5A, 0x67, 0xC0, 0xEB, 0x4A, 0x73, 0xC2, 0x07, 0x2A, 0xAA, 0x42, 0x48, 0x3A,
+0xA1, 0x91, 0xC2, 0xAA, 0x52, 0x71, 0x8C, 0xAE, 0x6B, 0x67, 0x92, 0xC1, 0x89, 0x3A, 0xC6, 0x29,
+0x67, 0xC4, 0x69, 0x4A, 0xEF, 0x83, 0x30, 0x8C, 0xB6, 0xC5, 0x30, 0x94, 0x40, 0xC0, 0x44, 0x29,
+0x68, 0xC0, 0x81, 0x10, 0xAB, 0xAE, 0xC0, 0x86, 0x29, 0x60, 0xC0, 0xA6, 0x31, 0xBB, 0x60, 0x95,
+0x60, 0x56, 0xC6, 0x2C, 0x5B, 0x6C, 0x53, 0x32, 0x85, 0x9C, 0xCF, 0xB4, 0x85, 0x2E, 0x5C, 0x68,
+0x2A, 0xA2, 0xBE, 0xC0, 0xEA, 0x42, 0x65, 0xC0, 0x88, 0x32, 0x64, 0xC2, 0x0A, 0x4B, 0x07, 0x32,
+0xEB, 0x52, 0xBE, 0xC2, 0x10, 0x7C, 0xF4, 0xA4, 0x4A, 0x4A, 0xBE, 0xC0, 0xEC, 0x62, 0x57, 0x95,
+0xC0, 0x29, 0x4A, 0x60, 0x48, 0xC0, 0x0C, 0x63, 0x00, 0xC0, 0xAA, 0x5A, 0x57, 0xC1, 0x2C, 0x6B,
+0xCB, 0x5A, 0x57, 0x70, 0xC1, 0x28, 0x4A, 0x86, 0x31, 0x7C, 0x96, 0x48, 0x00, 0x68, 0x48, 0xC5,
+0xE7, 0x39, 0x69, 0x4A, 0xB9, 0xCE, 0xBD, 0xEF, 0xED, 0x6B, 0x46, 0x32, 0xAF, 0xC1, 0x0A, 0x43,
+0x0E, 0x64, 0x96, 0xC1, 0xCA, 0x3A, 0x08, 0x2A, 0xBE, 0xC4, 0xC5, 0x31, 0xC2, 0x39, 0x62, 0x5A,
+0xEB, 0xAC, 0x53, 0xF7, 0xA1, 0x00, 0xC0, 0x53, 0xFF, 0xA9, 0xCA, 0xEF, 0xF6, 0x8D, 0xDE, 0xAA,
+0xB5, 0xE4, 0x6B, 0xA0, 0x2A, 0x44, 0x23, 0x87, 0x33, 0xEB, 0x83, 0x2E, 0xDC, 0xA2, 0xD8, 0x00,
+0xF8, 0xE0, 0x11, 0x9A, 0xBE, 0x5D, 0xC5, 0x40, 0xD8, 0x67, 0xD2, 0x55, 0xFE, 0x6B, 0x9C, 0x0A,
+0x64, 0x89, 0x3B, 0x92, 0xC1, 0xE8, 0x2A, 0x66, 0x22, 0xA5, 0xB5, 0xA5, 0xA5, 0xC0, 0x43, 0x3A,
+0xA2, 0x96, 0xAB, 0xC0, 0xE6, 0x31, 0xAB, 0xAF, 0x00, 0xBF, 0x5F, 0x00, 0x73, 0xC4, 0x2C, 0x53,
+0x6C, 0x53, 0xA9, 0x3A, 0x47, 0x32, 0x88, 0x3A, 0x81, 0xBF, 0xC0, 0x85, 0x19, 0x91, 0xC1, 0x4C,
+0x53, 0xCF, 0x63, 0x67, 0xC3, 0xAA, 0x4A, 0x30, 0x84, 0x6D, 0x73, 0x0C, 0x63, 0x48, 0x5C, 0xC1,
+0x55, 0xA5, 0xEF, 0x73, 0x4E, 0x64, 0xC0, 0x89, 0x3A, 0x73, 0xC0, 0x08, 0x32, 0x4E, 0xAE, 0xBF,
+0xA6, 0xC1, 0x49, 0x3A, 0x8A, 0x42, 0xA5, 0x5F, 0x5A, 0xC2, 0x8A, 0x4A, 0x2C, 0x63, 0x34, 0xA5,
+0x00, 0xC3, 0x75, 0xAD, 0x10, 0x84, 0xC7, 0x39, 0x65, 0x29, 0x4C, 0xC6, 0xC3, 0x18, 0x00, 0x00,
+0x82, 0x08, 0x04, 0x19, 0x45, 0x29, 0x86, 0x31, 0xC7, 0x41, 0x00, 0xA6, 0xC0, 0x28, 0x4A, 0x91,
+0xC0, 0xAE, 0x73, 0x84, 0xC5, 0x26, 0x2A, 0x0D, 0x5C, 0xF1, 0x6C, 0x90, 0x64, 0xEB, 0x3A, 0x6A,
+0x32, 0x94, 0xC1, 0x4C, 0x4B, 0x89, 0x32, 0xA6, 0x7D, 0xBF, 0xA6, 0xC1, 0x0B, 0x53, 0x86, 0x29,
+0xA6, 0xC3, 0x62, 0x10, 0x46, 0x29, 0x0E, 0x6B, 0xAC, 0x5A, 0x99, 0xA5, 0xC0, 0x29, 0x42, 0xA5,
+0xC0, 0x49, 0x4A, 0xAE, 0xA2, 0x48, 0x74, 0xAF, 0x00, 0x48, 0xC0, 0x09, 0x42, 0x60, 0xA6, 0x60,
+0x48, 0x74, 0x60, 0x74, 0xC1, 0xAA, 0x52, 0x48, 0x42, 0x62, 0xC0, 0xEA, 0x52, 0x9A, 0xC2, 0x4B,
+0x53, 0xA8, 0x32, 0x26, 0x22, 0x73, 0xC3, 0xA3, 0x09, 0x46, 0x22, 0x6B, 0x4B, 0x48, 0x32, 0x91,
+0xA4, 0xBD, 0xA4, 0xC3, 0x43, 0x4A, 0xA7, 0x7B, 0x2C, 0xB5, 0x70, 0xE6, 0x95, 0x90, 0xC3, 0x6A,
+0xAD, 0x66, 0x7C, 0x83, 0x43, 0x23, 0x2B, 0x9F, 0xC5, 0xC7, 0x2B, 0x87, 0x3B, 0xEA, 0x83, 0x0C,
+0xDC, 0xA2, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0x9A, 0xC0, 0x40, 0xF8, 0x5D, 0xC5, 0x40, 0xD8, 0x68,
+0xD2, 0x55, 0xFE, 0x6C, 0x9C, 0x0A, 0x64, 0xC9, 0x43, 0x97, 0xC2, 0x49, 0x33, 0xA8, 0x2A, 0x47,
+0x22, 0x92, 0xB9, 0xB9, 0xBA, 0x00, 0xC0, 0x27, 0x32, 0x5F, 0x9A, 0xA6, 0x01, 0xC0, 0x49, 0x32,
+0x6E, 0xAE, 0xA9, 0x64, 0x90, 0x00, 0xC2, 0xC9, 0x3A, 0x47, 0x2A, 0x64, 0x11, 0x64, 0xC0, 0x4C,
+0x53, 0x91, 0xC4, 0x89, 0x42, 0xC7, 0x29, 0x04, 0x11, 0x28, 0x42, 0x31, 0x84, 0xA5, 0xC5, 0x2D,
+0x6B, 0xCB, 0x5A, 0xF0, 0x7B, 0xD7, 0xB5, 0xEF, 0x73, 0x08, 0x32, 0x6B, 0xC0, 0x89, 0x3A, 0x00,
+0x73, 0xA6, 0xBA, 0xC0, 0x8A, 0x42, 0x6E, 0x73, 0x6E, 0x01, 0x76, 0xBF, 0xAF, 0x45, 0x76, 0xC0,
+0xAB, 0x52, 0x71, 0xC0, 0x25, 0x21, 0xA9, 0xA6, 0xC2, 0x21, 0x00, 0x61, 0x08, 0xC3, 0x10, 0x5C,
+0x55, 0x50, 0xBA, 0xC0, 0x45, 0x31, 0xBE, 0x00, 0xC7, 0xCA, 0x62, 0xF3, 0x9C, 0xCD, 0x6B, 0xE5,
+0x21, 0xCC, 0x53, 0xD0, 0x64, 0x2E, 0x54, 0x48, 0x2A, 0x77, 0xA9, 0xC1, 0x6D, 0x53, 0xCA, 0x3A,
+0xA5, 0xC0, 0xEA, 0x42, 0x60, 0x47, 0xC0, 0xEB, 0x4A, 0x46, 0xC1, 0xE8, 0x39, 0x87, 0x31, 0xA6,
+0xC2, 0x6B, 0x52, 0xE9, 0x41, 0x6A, 0x4A, 0x54, 0x40, 0xC0, 0xC7, 0x39, 0x40, 0xC0, 0xCB, 0x5A,
+0x92, 0xC0, 0x29, 0x4A, 0x58, 0xC0, 0x29, 0x42, 0xBE, 0xC0, 0x8A, 0x52, 0x74, 0xBB, 0x6F, 0x74,
+0x48, 0xA6, 0x6F, 0x71, 0x45, 0x90, 0x81, 0xAE, 0xC1, 0xA5, 0x21, 0xE9, 0x42, 0x96, 0xC1, 0xC4,
+0x19, 0x87, 0x2A, 0xAE, 0xC0, 0x29, 0x3B, 0xBB, 0xC0, 0x68, 0x32, 0x91, 0x00, 0xBD, 0xA5, 0x72,
+0xB9, 0xC1, 0x43, 0x52, 0xA3, 0x62, 0x00, 0x9D, 0x9E, 0xC3, 0xA1, 0x32, 0xC2, 0x1A, 0x45, 0x1B,
+0xC7, 0x23, 0xBF, 0xC4, 0xA7, 0x43, 0xEA, 0x83, 0x0C, 0xDC, 0xA2, 0xD8, 0x00, 0xF8, 0xE0, 0x11,
+0x9A, 0xBE, 0x5D, 0xC2, 0x40, 0xD8, 0x68, 0xD2, 0x55, 0xFE, 0x7C, 0xC1, 0x29, 0x64, 0xA7, 0x3B,
+0x9B, 0xC3, 0x49, 0x33, 0xE8, 0x2A, 0x47, 0x1A, 0xE6, 0x19, 0xBA, 0xBE, 0xBE, 0xBF, 0x76, 0x73,
+0x91, 0x9A, 0x5F, 0xAE, 0x00, 0x73, 0xAE, 0xA5, 0x78, 0xA9, 0x95, 0xC0, 0xC9, 0x3A, 0xA5, 0xC0,
+0xC5, 0x19, 0xBB, 0x6C, 0x73, 0xC1, 0x07, 0x2A, 0xA6, 0x21, 0xBA, 0xC1, 0x24, 0x19, 0x28, 0x42,
+0x40, 0xC0, 0x08, 0x3A, 0x4C, 0xC2, 0xCB, 0x52, 0xEF, 0x73, 0x0C, 0x53, 0x5F, 0xAF, 0x73, 0x78,
+0x73, 0x00, 0xBA, 0xAF, 0x00, 0x47, 0x73, 0xA6, 0x00, 0x76, 0x73, 0xA1, 0xBF, 0x5D, 0x62, 0xAB,
+0xA1, 0x99, 0xA2, 0x52, 0x71, 0xC1, 0x0C, 0x5B, 0x8E, 0x6B, 0xA6, 0xA5, 0x00, 0xBF, 0xCA, 0xAE,
+0x7B, 0x10, 0x8C, 0x18, 0xC6, 0x5C, 0xE7, 0x90, 0x7C, 0x06, 0x22, 0x0D, 0x54, 0xF0, 0x64, 0x2E,
+0x54, 0x48, 0x22, 0x8A, 0x32, 0xA5, 0xC3, 0x4C, 0x4B, 0xCA, 0x3A, 0x68, 0x32, 0xAA, 0x3A, 0x7D,
+0x78, 0x47, 0x4E, 0xC5, 0x49, 0x42, 0xEC, 0x5A, 0x4A, 0x4A, 0xAC, 0x5A, 0x2A, 0x4A, 0x6A, 0x52,
+0x00, 0x74, 0x91, 0xC0, 0xAB, 0x52, 0x40, 0x43, 0x74, 0xBB, 0xC0, 0xC8, 0x39, 0xBA, 0xC1, 0xAB,
+0x5A, 0x0C, 0x63, 0x7E, 0x91, 0x43, 0xC0, 0xE8, 0x41, 0x43, 0x57, 0x95, 0x74, 0x99, 0xAE, 0xC1,
+0xA9, 0x42, 0xE6, 0x29, 0x69, 0xC1, 0x2B, 0x4B, 0x26, 0x2A, 0xAE, 0xC2, 0xE9, 0x3A, 0x4A, 0x43,
+0x46, 0x22, 0x78, 0xC0, 0x08, 0x2A, 0xA5, 0xC0, 0x27, 0x32, 0xAE, 0xC0, 0xE5, 0x31, 0x91, 0xB9,
+0xBE, 0x00, 0x9E, 0xC0, 0x23, 0x2A, 0x8E, 0xC2, 0x84, 0x12, 0x47, 0x1B, 0x09, 0x2C, 0x00, 0xC4,
+0xC8, 0x43, 0xEA, 0x8B, 0xEC, 0xDB, 0x81, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0x5A, 0xBE, 0x5D, 0xC5,
+0x40, 0xE0, 0x68, 0xD2, 0x34, 0xFE, 0x6B, 0x9C, 0x29, 0x6C, 0xC7, 0x3B, 0x96, 0xC3, 0x48, 0x2B,
+0xE8, 0x22, 0x48, 0x22, 0xE7, 0x19, 0x41, 0x58, 0xA1, 0xAF, 0xAB, 0x01, 0x64, 0x73, 0x00, 0x5F,
+0x73, 0x64, 0xC2, 0x89, 0x3A, 0xAD, 0x5B, 0x70, 0x74, 0x4D, 0x7D, 0x95, 0x69, 0x91, 0xC1, 0xC6,
+0x21, 0x07, 0x2A, 0x69, 0x64, 0x5A, 0x00, 0xC1, 0xA6, 0x29, 0xE8, 0x39, 0x00, 0x95, 0xAF, 0xC0,
+0x49, 0x3A, 0x73, 0x01, 0x78, 0x00, 0x73, 0x00, 0x71, 0xAE, 0x73, 0xC0, 0xAA, 0x42, 0x00, 0x78,
+0x73, 0x6E, 0x01, 0x42, 0x00, 0x76, 0x6E, 0x00, 0xA1, 0x95, 0x49, 0x55, 0xC1, 0x8A, 0x4A, 0x2C,
+0x5B, 0xBB, 0x01, 0xBE, 0x00, 0xBF, 0xC7, 0xD3, 0x9C, 0x34, 0x9D, 0xEA, 0x4A, 0x84, 0x09, 0xCD,
+0x4B, 0xD0, 0x5C, 0x4E, 0x54, 0xA9, 0x32, 0xA2, 0xAF, 0xC3, 0xAE, 0x5B, 0x4C, 0x4B, 0x88, 0x32,
+0xCA, 0x42, 0x90, 0xA6, 0x73, 0x4E, 0xAE, 0xC0, 0x2D, 0x63, 0x91, 0xC1, 0x2E, 0x6B, 0xCC, 0x5A,
+0xA9, 0x48, 0xC0, 0x09, 0x4A, 0x99, 0xC0, 0xCC, 0x62, 0x48, 0x43, 0xC1, 0xE8, 0x41, 0x29, 0x4A,
+0x56, 0x5B, 0xC0, 0x6A, 0x5A, 0x66, 0x6F, 0x56, 0xC0, 0x29, 0x52, 0x6F, 0xC1, 0x0C, 0x63, 0xAF,
+0x73, 0x70, 0xC0, 0x48, 0x42, 0xA6, 0xC2, 0xAA, 0x4A, 0x0B, 0x53, 0x06, 0x2A, 0x00, 0xC4, 0x0E,
+0x6C, 0xAC, 0x5B, 0x47, 0x2A, 0xA4, 0x11, 0x46, 0x2A, 0xA7, 0x78, 0x5F, 0x57, 0x5F, 0x00, 0x50,
+0xBA, 0xC0, 0x47, 0x3A, 0x91, 0xAE, 0xAE, 0x9F, 0x89, 0xC5, 0xA6, 0x12, 0x48, 0x1B, 0xEA, 0x2B,
+0x2A, 0x34, 0x09, 0x4C, 0x0A, 0x8C, 0x40, 0xC1, 0x81, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0x9A, 0x62,
+0x5D, 0xC7, 0x61, 0xE0, 0x88, 0xDA, 0x34, 0xFE, 0x6B, 0x94, 0x49, 0x6C, 0x08, 0x44, 0xA7, 0x2B,
+0x28, 0x23, 0xA3, 0xC0, 0x89, 0x2A, 0x61, 0xB9, 0xBF, 0xA6, 0xBA, 0x9B, 0x95, 0x6E, 0xBF, 0x9A,
+0xA1, 0x6E, 0x73, 0x95, 0xC2, 0xCA, 0x3A, 0xCE, 0x5B, 0x4F, 0x6C, 0x91, 0xC1, 0xAC, 0x53, 0xC9,
+0x3A, 0x00, 0xC0, 0x68, 0x32, 0x00, 0x78, 0x64, 0xC0, 0xE7, 0x29, 0x01, 0xA1, 0xC0, 0x28, 0x3A,
+0x4E, 0x96, 0x6E, 0x5F, 0x00, 0x78, 0x00, 0x9A, 0x78, 0x00, 0xBA, 0x76, 0x00, 0x73, 0x00, 0x78,
+0x00, 0x7B, 0x78, 0x7B, 0x47, 0x7B, 0x47, 0x76, 0x01, 0x67, 0xC0, 0xC7, 0x31, 0x46, 0xC1, 0x25,
+0x19, 0x66, 0x21, 0xBF, 0x7A, 0x00, 0xBB, 0xA5, 0x96, 0x00, 0x4E, 0x67, 0xC0, 0xE6, 0x21, 0x8A,
+0xC1, 0xAC, 0x43, 0x6F, 0x54, 0x91, 0xC1, 0xA9, 0x32, 0xE7, 0x21, 0x75, 0x4D, 0xC0, 0x0A, 0x43,
+0x55, 0xC1, 0xEA, 0x42, 0x2B, 0x4B, 0x71, 0xBF, 0x67, 0xC2, 0xC6, 0x29, 0xCB, 0x52, 0x0C, 0x5B,
+0xBF, 0xC0, 0x8B, 0x52, 0xA9, 0xBF, 0xC2, 0x08, 0x42, 0x6A, 0x52, 0x4D, 0x73, 0x96, 0x57, 0xC0,
+0xA7, 0x41, 0xAF, 0x6F, 0xBE, 0xC2, 0xE8, 0x49, 0x6A, 0x5A, 0x08, 0x4A, 0x5E, 0x00, 0x85, 0x5B,
+0x74, 0x00, 0xC0, 0xE7, 0x39, 0x6A, 0xBF, 0x53, 0x00, 0x71, 0xC0, 0x0E, 0x6C, 0x91, 0x95, 0xC3,
+0x88, 0x32, 0x26, 0x2A, 0xE9, 0x42, 0x27, 0x2A, 0xBA, 0x64, 0x6B, 0xA6, 0x91, 0x99, 0xC0, 0x28,
+0x2A, 0x48, 0x9A, 0xAE, 0xAE, 0x9E, 0xC8, 0xA8, 0x12, 0x49, 0x1B, 0x0B, 0x2C, 0x4A, 0x34, 0x09,
+0x4C, 0x2B, 0x8C, 0xEC, 0xDB, 0x61, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0x5A, 0xBE, 0x5D, 0xC5, 0x61,
+0xE0, 0x88, 0xDA, 0x34, 0xFE, 0x4B, 0x94, 0x4A, 0x6C, 0xC8, 0x3B, 0x82, 0xC0, 0x28, 0x23, 0xB3,
+0xC1, 0x88, 0x2A, 0x06, 0x2A, 0xB9, 0xBE, 0x92, 0xC0, 0x26, 0x3A, 0xAB, 0xA6, 0xAF, 0xC0, 0x69,
+0x42, 0xA7, 0xC0, 0xE8, 0x31, 0x73, 0x00, 0xAE, 0xC0, 0xEA, 0x42, 0x96, 0xC5, 0x68, 0x2A, 0x0A,
+0x43, 0x70, 0x6C, 0xB0, 0x74, 0x4F, 0x6C, 0xCE, 0x63, 0xAE, 0x00, 0xC0, 0x8D, 0x5B, 0x00, 0x5C,
+0xC0, 0x6C, 0x53, 0xA6, 0xBF, 0x91, 0x00, 0xC0, 0xCE, 0x6B, 0x96, 0x9A, 0x61, 0x01, 0xAB, 0xBE,
+0xBA, 0xAB, 0xBE, 0x74, 0xC1, 0xCA, 0x42, 0x69, 0x3A, 0x78, 0xBF, 0x00, 0x78, 0x73, 0x47, 0xA5,
+0x73, 0x47, 0xBF, 0x47, 0x62, 0x91, 0x96, 0x4E, 0x55, 0xA5, 0x55, 0xBE, 0x49, 0x91, 0x5D, 0x99,
+0x64, 0xC0, 0x89, 0x32, 0x6B, 0x7D, 0xC0, 0x6F, 0x4C, 0xB6, 0xC0, 0x48, 0x22, 0xB1, 0xC0, 0x6D,
+0x53, 0x70, 0xC1, 0x8C, 0x53, 0x47, 0x2A, 0xBE, 0xC1, 0x2B, 0x4B, 0x47, 0x32, 0x64, 0xC0, 0xAA,
+0x4A, 0x99, 0xC4, 0xCA, 0x52, 0x2C, 0x63, 0x6D, 0x6B, 0xEC, 0x5A, 0x8A, 0x52, 0xA6, 0xC1, 0x08,
+0x4A, 0x10, 0x84, 0x91, 0x63, 0xC2, 0xA7, 0x39, 0x8A, 0x5A, 0xCF, 0x83, 0x77, 0xC7, 0xE8, 0x41,
+0x8B, 0x5A, 0xAF, 0x83, 0x09, 0x52, 0x66, 0x39, 0xE8, 0x49, 0xAF, 0x7B, 0x29, 0x4A, 0x80, 0xC5,
+0xCB, 0x5A, 0xAE, 0x73, 0x51, 0x84, 0xEF, 0x7B, 0x89, 0x4A, 0xC6, 0x29, 0x4A, 0x80, 0xC4, 0xC5,
+0x21, 0xED, 0x63, 0x4B, 0x53, 0x06, 0x22, 0x68, 0x32, 0x91, 0x58, 0x64, 0xAB, 0xA6, 0x96, 0xAD,
+0xAE, 0xAF, 0x95, 0x91, 0x00, 0x9E, 0xC2, 0x88, 0x12, 0x69, 0x23, 0x2B, 0x34, 0xA9, 0xC4, 0x29,
+0x4C, 0x2B, 0x8C, 0xEC, 0xD3, 0x61, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x96, 0x5D, 0xC5, 0x61,
+0xE0, 0x88, 0xDA, 0x34, 0xFE, 0x4B, 0x94, 0x4A, 0x6C, 0xE9, 0x3B, 0x82, 0xC7, 0x49, 0x2B, 0xE8,
+0x2A, 0x45, 0x2A, 0xE3, 0x29, 0x43, 0x42, 0xE6, 0x5A, 0x85, 0x4A, 0xC7, 0x52, 0x00, 0xC3, 0x46,
+0x42, 0xE5, 0x39, 0x07, 0x42, 0x2A, 0x42, 0x9A, 0xAD, 0x78, 0x64, 0xC0, 0x89, 0x32, 0xA9, 0xC3,
+0x27, 0x22, 0xA9, 0x32, 0xAC, 0x53, 0xA8, 0x32, 0x7A, 0xBA, 0xC0, 0xEA, 0x42, 0x95, 0x78, 0x7D,
+0x69, 0xC0, 0xAA, 0x3A, 0x78, 0x64, 0xC0, 0xA9, 0x42, 0xAB, 0xC0, 0xEA, 0x4A, 0xAF, 0x74, 0x95,
+0x00, 0xAE, 0x00, 0x74, 0x00, 0xC0, 0x6D, 0x63, 0xAE, 0xC0, 0xCE, 0x63, 0x74, 0x47, 0x78, 0x7B,
+0x00, 0x96, 0xA5, 0x00, 0x96, 0x40, 0xC0, 0x2C, 0x53, 0xA5, 0x78, 0x53, 0x92, 0x91, 0xBE, 0x00,
+0x72, 0x00, 0xC0, 0xC6, 0x29, 0x46, 0x7A, 0x53, 0x00, 0x64, 0x99, 0x85, 0xC1, 0xAC, 0x43, 0xD0,
+0x64, 0x91, 0xC2, 0x27, 0x22, 0xCA, 0x42, 0x70, 0x74, 0xA6, 0xC3, 0xB1, 0x7C, 0x4B, 0x53, 0xE6,
+0x21, 0xC9, 0x42, 0x00, 0xC3, 0x47, 0x32, 0x4B, 0x5B, 0xCE, 0x6B, 0xA9, 0x4A, 0x92, 0x00, 0xA6,
+0xC4, 0xE7, 0x39, 0x86, 0x31, 0x24, 0x29, 0x72, 0x94, 0x6D, 0x73, 0x58, 0x00, 0xC4, 0xCF, 0x7B,
+0xF3, 0xA4, 0xC7, 0x39, 0x04, 0x29, 0x2C, 0x6B, 0x44, 0xC8, 0xE8, 0x49, 0xE4, 0x28, 0x29, 0x4A,
+0x75, 0xB5, 0xCB, 0x5A, 0xA7, 0x39, 0x8A, 0x52, 0x2C, 0x63, 0x8E, 0x6B, 0x90, 0xC1, 0x08, 0x3A,
+0xA5, 0x29, 0x76, 0x99, 0xC0, 0x07, 0x32, 0x6D, 0xC0, 0x88, 0x3A, 0x91, 0xC0, 0xA9, 0x3A, 0x92,
+0x6B, 0x66, 0x02, 0x6B, 0x69, 0x00, 0x91, 0x95, 0x96, 0x9E, 0xC2, 0x67, 0x12, 0x49, 0x1B, 0x0A,
+0x2C, 0xBE, 0xC4, 0x09, 0x4C, 0x2B, 0x8C, 0xEC, 0xD3, 0x61, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0xAE,
+0x96, 0x5D, 0xC3, 0x61, 0xE0, 0x88, 0xDA, 0x34, 0xFE, 0x4B, 0x94, 0x57, 0xC0, 0xCA, 0x3B, 0x85,
+0xC6, 0x28, 0x2B, 0xC6, 0x2A, 0x43, 0x32, 0x83, 0x42, 0xE7, 0x7B, 0x6E, 0xB5, 0x93, 0xD6, 0x00,
+0xC4, 0xB0, 0xB5, 0x0A, 0x84, 0xA6, 0x52, 0x26, 0x42, 0x08, 0x42, 0xAF, 0x99, 0xC1, 0x89, 0x3A,
+0x07, 0x22, 0x00, 0xC1, 0x2B, 0x43, 0xCD, 0x53, 0x62, 0xC1, 0x06, 0x1A, 0x68, 0x2A, 0x55, 0x00,
+0x69, 0x55, 0x4D, 0x69, 0x55, 0x00, 0x69, 0x4D, 0x69, 0x64, 0x55, 0x01, 0x61, 0x66, 0x00, 0x64,
+0x00, 0xA6, 0xBE, 0x76, 0xC0, 0x4C, 0x5B, 0x74, 0xC1, 0xEB, 0x4A, 0x89, 0x42, 0x95, 0x7B, 0xC0,
+0xCA, 0x4A, 0x54, 0xC4, 0x2C, 0x53, 0x6C, 0x5B, 0x71, 0x7C, 0x33, 0x95, 0x30, 0x74, 0x54, 0x67,
+0x5F, 0xC0, 0xA6, 0x29, 0xAF, 0x7A, 0xC0, 0x44, 0x19, 0x91, 0xC2, 0x64, 0x19, 0xC6, 0x29, 0x07,
+0x32, 0x95, 0x64, 0xC0, 0x88, 0x3A, 0x81, 0xC8, 0x05, 0x12, 0x2D, 0x54, 0x72, 0x75, 0x4E, 0x54,
+0xA8, 0x32, 0xEA, 0x42, 0x2B, 0x4B, 0xC5, 0x21, 0x6C, 0x53, 0xA5, 0x75, 0xC0, 0x4B, 0x4B, 0x51,
+0xC2, 0xE6, 0x21, 0x0B, 0x4B, 0x2F, 0x74, 0x53, 0x57, 0xA5, 0xC1, 0xA5, 0x29, 0xC7, 0x31, 0xA5,
+0xC3, 0x81, 0x08, 0x2C, 0x63, 0x48, 0x42, 0x45, 0x29, 0x00, 0x75, 0x00, 0xC0, 0x04, 0x21, 0x00,
+0xC2, 0xAB, 0x5A, 0x51, 0x8C, 0xA6, 0x39, 0x50, 0xC4, 0x69, 0x52, 0x14, 0xA5, 0x49, 0x4A, 0x24,
+0x21, 0x65, 0x29, 0x55, 0xAF, 0xC0, 0xE7, 0x31, 0xA5, 0x00, 0xC0, 0x44, 0x21, 0x7B, 0xC0, 0xCE,
+0x6B, 0x6F, 0xC1, 0xC5, 0x21, 0xAA, 0x42, 0x00, 0xC0, 0xE7, 0x21, 0xBF, 0xBB, 0xAE, 0x00, 0xB9,
+0x9C, 0xA5, 0xB9, 0x96, 0x00, 0x9E, 0xAF, 0xC2, 0xA6, 0x22, 0x48, 0x23, 0xE9, 0x33, 0xAE, 0xC3,
+0x09, 0x4C, 0x2B, 0x8C, 0xCC, 0xD3, 0x61, 0xD8, 0x5D, 0x00, 0x9A, 0x5D, 0xE0, 0x0E, 0xAE, 0x01,
+0xC5, 0x61, 0xE0, 0xA8, 0xDA, 0x14, 0xFE, 0x4B, 0x94, 0x4A, 0x6C, 0xA9, 0x3B, 0x81, 0xA0, 0xC4,
+0xA3, 0x32, 0x03, 0x53, 0x4A, 0xA5, 0x52, 0xF7, 0xB4, 0xFF, 0x96, 0x00, 0xC0, 0xD5, 0xFF, 0xA7,
+0xC6, 0xF0, 0xC5, 0x67, 0x73, 0x83, 0x39, 0x47, 0x42, 0xC6, 0x29, 0x48, 0x32, 0xCA, 0x42, 0x6E,
+0xC0, 0x06, 0x1A, 0x00, 0xBF, 0xAE, 0xC4, 0x89, 0x32, 0xAD, 0x5B, 0x50, 0x74, 0xEE, 0x63, 0x8D,
+0x5B, 0x61, 0xC1, 0x4F, 0x6C, 0xEE, 0x5B, 0x61, 0x4D, 0x00, 0xC0, 0x0F, 0x64, 0xBE, 0xC0, 0xAD,
+0x63, 0x51, 0xC1, 0x68, 0x2A, 0xA9, 0x32, 0x66, 0xC1, 0xEA, 0x3A, 0xB1, 0x74, 0xA6, 0x47, 0x64,
+0xC1, 0xA9, 0x42, 0xE7, 0x29, 0x4F, 0xC1, 0xEE, 0x6B, 0x0B, 0x53, 0x53, 0x47, 0xC0, 0xEB, 0x52,
+0x47, 0xC2, 0x28, 0x3A, 0xCE, 0x6B, 0x2B, 0x53, 0x77, 0x64, 0xC1, 0xEA, 0x4A, 0x48, 0x3A, 0x4B,
+0xA1, 0xC0, 0x07, 0x3A, 0x7A, 0xC0, 0x44, 0x19, 0x7F, 0x67, 0x95, 0x91, 0xCA, 0x4B, 0x5B, 0x4F,
+0x74, 0x4B, 0x53, 0xE5, 0x19, 0x66, 0x22, 0x0D, 0x54, 0xF0, 0x64, 0x6E, 0x5C, 0xC9, 0x3A, 0x47,
+0x32, 0x0A, 0x4B, 0x51, 0x6D, 0x45, 0x91, 0xAF, 0x59, 0x41, 0x71, 0x00, 0xC0, 0x80, 0x00, 0x5C,
+0x67, 0x53, 0xC0, 0x64, 0x21, 0x7A, 0x00, 0x7F, 0x7A, 0xC0, 0x44, 0x21, 0xAF, 0xC0, 0xE7, 0x31,
+0x66, 0xBF, 0x91, 0xC0, 0xE7, 0x39, 0x74, 0x49, 0xC0, 0x45, 0x29, 0x80, 0xC1, 0x28, 0x42, 0xA6,
+0x31, 0x95, 0x75, 0xC3, 0x04, 0x19, 0xAE, 0x6B, 0x75, 0xA5, 0x8D, 0x63, 0x53, 0x6E, 0x4E, 0xC0,
+0x65, 0x21, 0x4F, 0xC1, 0x95, 0xA5, 0xD2, 0x8C, 0x47, 0xC0, 0x49, 0x2A, 0xA1, 0xC0, 0x49, 0x32,
+0x62, 0xC4, 0x68, 0x42, 0xA3, 0x29, 0xA5, 0x4A, 0x67, 0x6B, 0x09, 0x84, 0xA9, 0xC5, 0xA6, 0x7B,
+0x04, 0x5B, 0x41, 0x32, 0xE3, 0x32, 0x86, 0x33, 0x29, 0x3C, 0x81, 0xC4, 0xE8, 0x4B, 0x2B, 0x8C,
+0xAB, 0xD3, 0x81, 0xD8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0E, 0x62, 0x01, 0x6A, 0xCA, 0xA8,
+0xDA, 0x14, 0xFE, 0x4B, 0x94, 0x4A, 0x6C, 0xEA, 0x43, 0x46, 0x2B, 0xA2, 0x22, 0xC5, 0x5B, 0x0D,
+0xBE, 0x10, 0xE7, 0xAF, 0xE6, 0xA6, 0xC1, 0x2F, 0xD6, 0xB0, 0xDE, 0xAE, 0xC6, 0x31, 0xEF, 0xB4,
+0xFF, 0xD2, 0xE6, 0xE9, 0x83, 0xC3, 0x39, 0x67, 0x42, 0x89, 0x3A, 0x91, 0x9E, 0x00, 0xC0, 0xE5,
+0x11, 0xBB, 0xC2, 0x88, 0x2A, 0x4C, 0x4B, 0xA9, 0x3A, 0x64, 0x78, 0x00, 0x99, 0x42, 0xC1, 0x0A,
+0x43, 0xA9, 0x32, 0x4C, 0xAE, 0x96, 0x51, 0xC0, 0x2B, 0x4B, 0xAE, 0x92, 0xC0, 0x06, 0x22, 0x7E,
+0xC0, 0x2B, 0x43, 0x56, 0x00, 0xC0, 0x6C, 0x53, 0x40, 0x63, 0xC0, 0x28, 0x3A, 0x63, 0xC0, 0xEF,
+0x6B, 0x4B, 0xC0, 0x2B, 0x53, 0x5E, 0xC0, 0x69, 0x42, 0x40, 0xC2, 0x28, 0x32, 0x69, 0x3A, 0x85,
+0x21, 0x64, 0xC0, 0x4C, 0x53, 0x4C, 0x64, 0x58, 0xC1, 0xA5, 0x29, 0x89, 0x42, 0xBE, 0x58, 0xC0,
+0xC6, 0x21, 0xA9, 0x44, 0xC1, 0x47, 0x32, 0x6B, 0x53, 0x45, 0xC5, 0x0E, 0x6C, 0xE8, 0x42, 0x87,
+0x32, 0x09, 0x3B, 0x05, 0x12, 0xAB, 0x4B, 0x6A, 0xA1, 0xC0, 0x4B, 0x53, 0xBF, 0xC4, 0xCD, 0x63,
+0x88, 0x3A, 0x06, 0x2A, 0x47, 0x2A, 0x6C, 0x53, 0x71, 0x5D, 0xC0, 0xA8, 0x3A, 0x92, 0xC0, 0xEA,
+0x4A, 0x44, 0xC0, 0x64, 0x19, 0x54, 0xC0, 0x48, 0x3A, 0x7F, 0x6B, 0x53, 0x62, 0x7F, 0x4E, 0x91,
+0x4E, 0xC0, 0x65, 0x21, 0x00, 0xBF, 0x90, 0x66, 0xBA, 0xC0, 0xA6, 0x31, 0x95, 0x7D, 0x00, 0x61,
+0xC1, 0xB2, 0x8C, 0xFF, 0xFF, 0x85, 0xC0, 0x0F, 0x74, 0x62, 0x66, 0x62, 0xC0, 0xD3, 0x8C, 0x5F,
+0xAB, 0xC9, 0x38, 0xB6, 0x8A, 0x3A, 0xE8, 0x21, 0x08, 0x32, 0x64, 0x21, 0x05, 0x3A, 0xCA, 0x7B,
+0x11, 0xC6, 0x13, 0xEF, 0x74, 0xFF, 0xAD, 0xA1, 0xCA, 0xF0, 0xE6, 0x6B, 0xA5, 0xA4, 0x53, 0xE1,
+0x22, 0xA5, 0x33, 0xC7, 0x2B, 0xC8, 0x43, 0x2B, 0x8C, 0xCB, 0xD3, 0x81, 0xD8, 0x00, 0xF8, 0x00,
+0xAE, 0x5D, 0xE0, 0x0E, 0x9A, 0x00, 0x5D, 0xC9, 0x61, 0xE0, 0xA8, 0xDA, 0x14, 0xFE, 0x4B, 0x94,
+0x2A, 0x6C, 0x88, 0x3B, 0xE4, 0x22, 0xE2, 0x3A, 0x09, 0x95, 0x31, 0xEF, 0xB1, 0xC2, 0x0E, 0xD6,
+0x50, 0xDE, 0x91, 0xDE, 0x00, 0xC6, 0x0E, 0xCE, 0xAB, 0xC5, 0xAF, 0xE6, 0xD4, 0xFF, 0x30, 0xD6,
+0x63, 0x52, 0xC4, 0x31, 0x40, 0xC4, 0x06, 0x2A, 0x47, 0x2A, 0x4B, 0x43, 0xAD, 0x53, 0xEE, 0x5B,
+0x92, 0xA5, 0xC0, 0x69, 0x32, 0x90, 0xBB, 0x58, 0xC0, 0xC9, 0x42, 0x79, 0xAE, 0xC1, 0x88, 0x32,
+0xE6, 0x21, 0x95, 0x49, 0xAB, 0x49, 0x42, 0x5E, 0xC3, 0x2A, 0x43, 0xC5, 0x11, 0x68, 0x2A, 0xA8,
+0x32, 0x42, 0xBF, 0x58, 0xC2, 0x4C, 0x5B, 0x89, 0x42, 0xCA, 0x4A, 0x00, 0xC1, 0x0B, 0x4B, 0x0F,
+0x74, 0xAE, 0x54, 0xC1, 0x89, 0x3A, 0xC6, 0x21, 0x40, 0xC1, 0x4C, 0x53, 0x8D, 0x5B, 0x68, 0x58,
+0x50, 0x78, 0x58, 0xC0, 0xC9, 0x4A, 0x68, 0xA9, 0xAF, 0x9A, 0xBE, 0xC1, 0xCC, 0x5B, 0x47, 0x32,
+0xA9, 0xC5, 0x4E, 0x74, 0xC8, 0x3A, 0x46, 0x2A, 0x49, 0x43, 0x04, 0x1A, 0x6A, 0x4B, 0x61, 0xC1,
+0x0E, 0x74, 0x0A, 0x4B, 0x49, 0xC0, 0x68, 0x3A, 0x55, 0xC0, 0xA9, 0x3A, 0x91, 0xC0, 0xCA, 0x3A,
+0x51, 0x69, 0x00, 0x6D, 0xC1, 0x8C, 0x5B, 0x67, 0x32, 0x45, 0xC0, 0x8D, 0x5B, 0x74, 0x60, 0x50,
+0xA9, 0x64, 0x50, 0x40, 0x77, 0x4F, 0xC0, 0xA5, 0x21, 0x44, 0xC0, 0x48, 0x3A, 0x58, 0x4F, 0xC0,
+0x6C, 0x5B, 0x7A, 0xC1, 0x07, 0x32, 0x69, 0x42, 0xA9, 0xC2, 0xE7, 0x31, 0x54, 0x9D, 0xFF, 0xFF,
+0x9A, 0x91, 0xC1, 0x75, 0xA5, 0xCB, 0x4A, 0x4E, 0xC4, 0xAA, 0x4A, 0xD3, 0x8C, 0x1C, 0xDF, 0x9E,
+0xE7, 0xAE, 0x5B, 0x50, 0xA4, 0xC3, 0x04, 0x3A, 0x0A, 0x7C, 0x72, 0xD6, 0x74, 0xF7, 0xB9, 0xC0,
+0x8F, 0xEE, 0xBD, 0x95, 0xCA, 0x2F, 0xFF, 0x70, 0xF7, 0x0B, 0xB6, 0x64, 0x64, 0xA3, 0x3B, 0xA6,
+0x2B, 0xA7, 0x3B, 0x0A, 0x8C, 0xCB, 0xD3, 0x81, 0xD8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0E,
+0x9A, 0x00, 0x5D, 0xD5, 0x61, 0xE0, 0xA8, 0xDA, 0x14, 0xFE, 0x4B, 0x94, 0x09, 0x64, 0x88, 0x43,
+0x05, 0x2B, 0x47, 0x74, 0x6E, 0xCE, 0xF0, 0xEE, 0x90, 0xE6, 0xF3, 0xF6, 0xB8, 0xFF, 0xFA, 0xFF,
+0x97, 0xF7, 0x33, 0xEF, 0xED, 0xCD, 0x09, 0xB5, 0x2E, 0xDE, 0x73, 0xFF, 0xAB, 0x9C, 0xA3, 0x31,
+0x58, 0x81, 0xC1, 0x0A, 0x43, 0x2F, 0x64, 0xAE, 0xBF, 0xC0, 0x6D, 0x53, 0x90, 0xC0, 0x08, 0x2A,
+0xB9, 0x00, 0x58, 0xC5, 0x2B, 0x53, 0x4F, 0x6C, 0xB0, 0x7C, 0xAD, 0x5B, 0xCA, 0x42, 0x68, 0x3A,
+0x4C, 0x95, 0x50, 0xC5, 0x47, 0x2A, 0x0A, 0x43, 0xCD, 0x5B, 0xA9, 0x32, 0x47, 0x22, 0xAD, 0x53,
+0x52, 0x69, 0xC0, 0xE6, 0x29, 0x50, 0x6C, 0x95, 0x50, 0x44, 0xC1, 0xEA, 0x4A, 0xCE, 0x63, 0x60,
+0x6C, 0xC0, 0xC6, 0x21, 0x55, 0x7D, 0x78, 0x69, 0x00, 0xAE, 0xBE, 0xBF, 0xA6, 0x76, 0xC2, 0xE9,
+0x3A, 0x4A, 0x4B, 0x8B, 0x4B, 0x5B, 0xC4, 0xC8, 0x3A, 0x4B, 0x53, 0xED, 0x63, 0x8B, 0x5B, 0xE4,
+0x21, 0x92, 0xC1, 0x09, 0x43, 0xAB, 0x53, 0x74, 0xC3, 0x0A, 0x4B, 0x6F, 0x7C, 0x0A, 0x53, 0x06,
+0x2A, 0x58, 0x55, 0x4C, 0xC0, 0x07, 0x22, 0x55, 0x42, 0x7D, 0xC0, 0x47, 0x2A, 0x7D, 0x42, 0xC2,
+0x67, 0x32, 0x6C, 0x53, 0x84, 0x19, 0x5D, 0xC1, 0x4C, 0x53, 0x88, 0x3A, 0x50, 0x6C, 0x69, 0xC1,
+0x8D, 0x5B, 0x0F, 0x6C, 0x91, 0x78, 0x58, 0xBF, 0xC2, 0x89, 0x42, 0x6C, 0x5B, 0xCE, 0x6B, 0x53,
+0x67, 0x00, 0x58, 0xCA, 0x69, 0x3A, 0xD6, 0xAD, 0x5D, 0xDF, 0xF3, 0x94, 0xFB, 0xD6, 0xFF, 0xF7,
+0xDB, 0xCE, 0x71, 0x84, 0xC7, 0x29, 0x08, 0x32, 0xF8, 0xB5, 0x6E, 0xC0, 0x31, 0x74, 0x50, 0xC4,
+0x83, 0x21, 0xA9, 0x73, 0xB3, 0xDE, 0x74, 0xF7, 0x50, 0xD6, 0xA0, 0xBE, 0xB9, 0xC0, 0xAA, 0xD5,
+0x94, 0xC9, 0xAC, 0xE6, 0x8F, 0xF7, 0x8C, 0xC6, 0x03, 0x54, 0xA5, 0x33, 0x67, 0x3B, 0xEA, 0x8B,
+0xCC, 0xD3, 0x81, 0xD8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0E, 0x9A, 0x00, 0x5D, 0xC3, 0x61,
+0xE0, 0xA9, 0xDA, 0x14, 0xFE, 0x4B, 0x94, 0x43, 0xC3, 0x67, 0x43, 0xE4, 0x32, 0xC9, 0x8C, 0xD0,
+0xE6, 0xB6, 0xC2, 0xF3, 0xF6, 0xDA, 0xFF, 0xDC, 0xFF, 0x00, 0xCA, 0x79, 0xF7, 0xF9, 0xFF, 0x55,
+0xFF, 0x2B, 0xBD, 0x67, 0xAC, 0x31, 0xFF, 0x70, 0xDE, 0xA7, 0x52, 0xC6, 0x29, 0x89, 0x3A, 0x94,
+0x95, 0x96, 0xC0, 0x8C, 0x4B, 0xA7, 0xC1, 0xEB, 0x42, 0x28, 0x32, 0x95, 0x7F, 0x67, 0xC4, 0xEE,
+0x6B, 0x2B, 0x53, 0x84, 0x11, 0x47, 0x2A, 0x4F, 0x74, 0x00, 0x64, 0x7C, 0x00, 0x9A, 0xC2, 0xA9,
+0x3A, 0xC5, 0x19, 0x0A, 0x43, 0x5B, 0xC1, 0x67, 0x2A, 0xE5, 0x19, 0x72, 0xC1, 0x26, 0x2A, 0xC9,
+0x42, 0x7D, 0x45, 0x91, 0x65, 0x76, 0x72, 0xC1, 0x88, 0x32, 0x4B, 0x53, 0x79, 0xC1, 0x2E, 0x64,
+0x8C, 0x53, 0x91, 0x5B, 0x00, 0x7B, 0xA5, 0x5B, 0x6A, 0x00, 0x5B, 0x95, 0xAB, 0xC0, 0x4A, 0x43,
+0x53, 0xC0, 0x87, 0x32, 0x91, 0xC0, 0xC8, 0x3A, 0x53, 0x76, 0x99, 0xC0, 0x25, 0x22, 0x6C, 0xC1,
+0xC4, 0x19, 0x0A, 0x4B, 0xBA, 0xC1, 0x07, 0x32, 0x88, 0x42, 0x78, 0x91, 0xC0, 0xEA, 0x42, 0x7D,
+0x96, 0x00, 0x65, 0x6A, 0x6F, 0xC0, 0xAC, 0x5B, 0x00, 0xAF, 0xC0, 0xE9, 0x42, 0x56, 0x79, 0x69,
+0x91, 0x76, 0x91, 0x6D, 0xC0, 0x64, 0x11, 0x6D, 0x00, 0xC1, 0x47, 0x32, 0xE6, 0x29, 0x71, 0xC0,
+0xEA, 0x4A, 0x5D, 0x53, 0xAE, 0xC0, 0xA5, 0x21, 0xA6, 0x54, 0xC4, 0xFB, 0xCE, 0x9E, 0xE7, 0xCE,
+0x6B, 0x0C, 0x53, 0x38, 0xB6, 0x52, 0xC3, 0xDF, 0xF7, 0xBB, 0xCE, 0x39, 0xBE, 0xDF, 0xF7, 0x96,
+0xC0, 0x4D, 0x5B, 0x70, 0xC3, 0xA2, 0x31, 0x2E, 0xAD, 0x55, 0xF7, 0xB2, 0xE6, 0x92, 0xC1, 0x16,
+0xF7, 0xB9, 0xFF, 0xA9, 0xCB, 0x54, 0xFF, 0xCC, 0xD5, 0x28, 0xBD, 0x4B, 0xDE, 0x6F, 0xF7, 0x48,
+0x95, 0xA6, 0x3B, 0x46, 0x33, 0xEA, 0x83, 0xCC, 0xD3, 0x81, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0x9A,
+0x00, 0x5D, 0xC5, 0x61, 0xE0, 0xC9, 0xE2, 0x34, 0xFE, 0x4B, 0x94, 0xE9, 0x63, 0xE6, 0x3A, 0xA4,
+0xC5, 0x88, 0x8C, 0x8F, 0xDE, 0xD1, 0xF6, 0x56, 0xFF, 0xFC, 0xFF, 0x7C, 0xF7, 0x96, 0x94, 0xC0,
+0x9A, 0xFF, 0x76, 0xCE, 0x51, 0xE6, 0xC5, 0x9B, 0x6E, 0xE6, 0xF2, 0xEE, 0xE8, 0x62, 0xE6, 0x31,
+0xEE, 0x6B, 0x5B, 0xD7, 0x17, 0xA6, 0x4C, 0x43, 0xEB, 0x3A, 0x89, 0x32, 0x86, 0x19, 0xEB, 0x4A,
+0x08, 0x32, 0xBE, 0xC0, 0x38, 0xB6, 0x94, 0xC0, 0x26, 0x2A, 0xAF, 0xC0, 0xCD, 0x63, 0x7C, 0x54,
+0x91, 0xC0, 0x0A, 0x4B, 0x7C, 0x65, 0xC4, 0xA8, 0x3A, 0x26, 0x22, 0x88, 0x2A, 0xCD, 0x53, 0xC9,
+0x32, 0x4B, 0xC2, 0xA8, 0x32, 0x27, 0x2A, 0xC9, 0x42, 0x46, 0x42, 0xC0, 0xAC, 0x53, 0xA6, 0xC0,
+0x06, 0x22, 0xAF, 0xC1, 0x2A, 0x43, 0x8C, 0x4B, 0x43, 0x9A, 0xC1, 0xED, 0x53, 0xB0, 0x6C, 0xA5,
+0x4F, 0x00, 0xC0, 0x0E, 0x5C, 0xBE, 0x63, 0x00, 0x54, 0x00, 0xC0, 0x4E, 0x5C, 0x00, 0x54, 0x63,
+0x90, 0xBB, 0xC0, 0x4E, 0x6C, 0x6B, 0xA5, 0x73, 0xBF, 0x7C, 0xC0, 0xCA, 0x4A, 0x53, 0xC7, 0x48,
+0x3A, 0x89, 0x3A, 0x6D, 0x53, 0xEF, 0x63, 0x30, 0x6C, 0xCA, 0x3A, 0xC6, 0x19, 0x68, 0x32, 0x9A,
+0x55, 0xC0, 0x88, 0x32, 0x76, 0xC3, 0xE5, 0x21, 0xAD, 0x5B, 0x4B, 0x4B, 0xEA, 0x42, 0x55, 0xC1,
+0x67, 0x32, 0xE9, 0x42, 0x71, 0x59, 0xC1, 0x84, 0x19, 0x4B, 0x53, 0x00, 0x69, 0xA1, 0xC1, 0xA9,
+0x42, 0xEA, 0x4A, 0x58, 0x55, 0xC0, 0xA9, 0x3A, 0x78, 0xC2, 0xCA, 0x42, 0xCE, 0x63, 0xFB, 0xCE,
+0x00, 0xD0, 0x0B, 0x53, 0x28, 0x32, 0x6D, 0x5B, 0xF0, 0x73, 0x18, 0xB6, 0xBF, 0xEF, 0xFF, 0xF7,
+0x1C, 0xDF, 0xB3, 0x8C, 0x69, 0x42, 0x64, 0x21, 0xC5, 0x5A, 0x92, 0xE6, 0xF2, 0xF6, 0x71, 0xE6,
+0x98, 0xFF, 0xFC, 0xFF, 0xAB, 0xCC, 0x7B, 0xFF, 0xB9, 0xFF, 0xD2, 0xF6, 0x4A, 0xC5, 0x07, 0xBD,
+0x0E, 0xF7, 0x4C, 0xC6, 0xE6, 0x43, 0x46, 0x33, 0xC9, 0x83, 0xCB, 0xD3, 0x61, 0xD8, 0x00, 0xF8,
+0xE0, 0x11, 0xAE, 0x96, 0x5D, 0xC1, 0x61, 0xE0, 0xC9, 0xE2, 0x5E, 0xC2, 0x4B, 0x94, 0xE9, 0x6B,
+0x26, 0x43, 0xA5, 0xC3, 0xA8, 0x94, 0xAF, 0xEE, 0x13, 0xFF, 0xB8, 0xFF, 0x63, 0x93, 0x6E, 0xA5,
+0xC0, 0x7B, 0xF7, 0xB8, 0xC4, 0xF5, 0xFE, 0x27, 0xA4, 0x8E, 0xF6, 0x11, 0xF7, 0xC7, 0x5A, 0x47,
+0xCF, 0x91, 0x84, 0x9C, 0xDF, 0xD6, 0x9D, 0x0B, 0x43, 0x48, 0x2A, 0xA6, 0x19, 0x91, 0x7C, 0x59,
+0xBE, 0x14, 0x95, 0x8D, 0x6B, 0xFA, 0xCE, 0xFE, 0xEF, 0x4F, 0x74, 0x4B, 0x53, 0xA9, 0x42, 0xE6,
+0x29, 0x70, 0x53, 0xC0, 0x47, 0x3A, 0x9A, 0xC4, 0xC9, 0x42, 0x8C, 0x5B, 0xA9, 0x32, 0x06, 0x1A,
+0x2A, 0x43, 0x7B, 0xBA, 0xAE, 0xA1, 0xC2, 0xF2, 0x84, 0x90, 0x74, 0x6B, 0x4B, 0x43, 0xBF, 0xC0,
+0x4B, 0x43, 0x00, 0xA9, 0x5B, 0xC0, 0x6B, 0x43, 0x00, 0xC3, 0x09, 0x33, 0x0D, 0x54, 0x4E, 0x5C,
+0x6B, 0x3B, 0x00, 0x6C, 0xC1, 0x0A, 0x33, 0xA9, 0x2A, 0x00, 0xAD, 0x96, 0xC0, 0xE9, 0x2A, 0x00,
+0xC1, 0x87, 0x22, 0xE9, 0x32, 0xA5, 0x60, 0x5B, 0xC1, 0xC9, 0x3A, 0x0A, 0x43, 0x95, 0xA5, 0xC0,
+0x0A, 0x53, 0xAF, 0xA6, 0xC0, 0x27, 0x32, 0x96, 0xC1, 0x6D, 0x53, 0xAA, 0x3A, 0xBF, 0xC3, 0x8D,
+0x53, 0x69, 0x2A, 0xCA, 0x3A, 0x68, 0x32, 0x7A, 0xC1, 0x4B, 0x4B, 0xED, 0x5B, 0x7E, 0xC0, 0xE5,
+0x21, 0xAB, 0x46, 0xC0, 0x47, 0x2A, 0x42, 0x00, 0x69, 0xBE, 0xC3, 0x0E, 0x6C, 0xAD, 0x63, 0x68,
+0x3A, 0x06, 0x2A, 0x58, 0x5D, 0xC4, 0xC9, 0x42, 0x0A, 0x4B, 0x68, 0x32, 0xEA, 0x4A, 0x6C, 0x53,
+0x4D, 0xC1, 0x4C, 0x53, 0x91, 0x7C, 0x00, 0xC1, 0xE7, 0x29, 0xAA, 0x42, 0x00, 0xC3, 0x28, 0x32,
+0x8A, 0x42, 0x8E, 0x63, 0x10, 0x74, 0x91, 0x42, 0xD5, 0xE7, 0x31, 0x83, 0x29, 0xC8, 0x83, 0x33,
+0xFF, 0xD1, 0xF6, 0x13, 0xF7, 0xFB, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x7B, 0xFF, 0x57,
+0xFF, 0x90, 0xEE, 0xE6, 0xBC, 0x2A, 0xEE, 0x2B, 0xCE, 0x27, 0x54, 0x46, 0x33, 0xA9, 0x7B, 0xCB,
+0xD3, 0x61, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D, 0x00, 0xC8, 0x81, 0xE0, 0xE9, 0xE2, 0x55,
+0xFE, 0x6B, 0x94, 0xE9, 0x6B, 0x47, 0x43, 0xA3, 0x3A, 0x47, 0x8C, 0x8F, 0xE6, 0x6B, 0x60, 0xC1,
+0xFD, 0xFF, 0x9D, 0xE7, 0xAF, 0xBE, 0xCC, 0x7B, 0xF7, 0x37, 0xF7, 0xB3, 0xEE, 0x27, 0xA4, 0xAE,
+0xF6, 0x6F, 0xDE, 0x08, 0x63, 0x65, 0x21, 0x50, 0x7C, 0xDE, 0xE7, 0x79, 0xB6, 0x4C, 0x4B, 0x48,
+0x2A, 0xBF, 0x6E, 0xC2, 0xBE, 0xEF, 0xFF, 0xFF, 0x5D, 0xE7, 0x5F, 0x4B, 0xC3, 0xCE, 0x63, 0x84,
+0x19, 0xC5, 0x21, 0x07, 0x2A, 0x6C, 0x00, 0x91, 0x91, 0xC4, 0x47, 0x32, 0xE9, 0x42, 0x8C, 0x53,
+0xA8, 0x32, 0xE5, 0x11, 0x73, 0xC0, 0x4B, 0x4B, 0x5B, 0xC0, 0x6B, 0x4B, 0x7E, 0x43, 0xC1, 0x4B,
+0x43, 0x8C, 0x4B, 0x6F, 0xAE, 0x48, 0x81, 0x7B, 0xAE, 0xC0, 0x4E, 0x5C, 0x71, 0xC0, 0x0D, 0x54,
+0xAF, 0xC1, 0x8B, 0x3B, 0xCC, 0x4B, 0x00, 0xC0, 0x0E, 0x5C, 0x91, 0x65, 0xC1, 0x6F, 0x5C, 0x0E,
+0x54, 0x99, 0xC0, 0x4F, 0x5C, 0x00, 0xA5, 0x63, 0x4F, 0xC0, 0x2E, 0x64, 0x91, 0xA6, 0x6B, 0xC4,
+0x6B, 0x53, 0x88, 0x3A, 0xC9, 0x42, 0x6C, 0x5B, 0xA9, 0x42, 0x58, 0xC4, 0xAA, 0x3A, 0x03, 0x09,
+0x48, 0x2A, 0x8D, 0x53, 0x89, 0x32, 0xAE, 0xC1, 0x47, 0x2A, 0x2B, 0x43, 0x52, 0xC0, 0x2F, 0x6C,
+0x00, 0x51, 0x91, 0x58, 0xAF, 0x7D, 0x64, 0x50, 0x58, 0x64, 0x50, 0xC0, 0x85, 0x19, 0x50, 0x71,
+0x50, 0x64, 0xC0, 0xC9, 0x42, 0x92, 0x69, 0xBB, 0x78, 0xC5, 0x44, 0x19, 0xE7, 0x29, 0xEB, 0x4A,
+0x28, 0x32, 0xC7, 0x29, 0xAA, 0x4A, 0x00, 0xC0, 0x08, 0x32, 0xA6, 0xC1, 0x6A, 0x42, 0xEC, 0x52,
+0x95, 0xC0, 0x84, 0x21, 0xB8, 0xC1, 0xE8, 0x8B, 0xD1, 0xEE, 0xA5, 0xC2, 0x95, 0xFF, 0xFC, 0xFF,
+0xFF, 0xFF, 0x96, 0x71, 0x5E, 0xCA, 0x37, 0xF7, 0x12, 0xFF, 0x07, 0xC5, 0xE8, 0xE5, 0x4B, 0xD6,
+0x68, 0x5C, 0x46, 0x3B, 0x88, 0x7B, 0xAB, 0xD3, 0x61, 0xD8, 0x01, 0xF8, 0xA9, 0xE0, 0x10, 0xAE,
+0x5D, 0x00, 0xCB, 0x82, 0xE0, 0x4A, 0xE3, 0x14, 0xFE, 0xAD, 0x9C, 0x2A, 0x6C, 0x47, 0x4B, 0x01,
+0x22, 0xC5, 0x73, 0x90, 0xDE, 0x13, 0xF7, 0x77, 0xFF, 0xFD, 0xFF, 0x97, 0xAF, 0x94, 0xC2, 0xFB,
+0xFF, 0xB7, 0xFF, 0xEE, 0xD5, 0xA8, 0xC3, 0x10, 0xFF, 0xAD, 0xC5, 0x25, 0x42, 0xA6, 0x29, 0x42,
+0xC0, 0x38, 0xB6, 0x6E, 0xC2, 0x3C, 0xD7, 0x79, 0xBE, 0x1C, 0xD7, 0x6E, 0x6A, 0xC1, 0x9A, 0xC6,
+0x5D, 0xDF, 0x6E, 0x00, 0xC0, 0x0F, 0x74, 0x78, 0x51, 0x80, 0xBF, 0x00, 0xA6, 0xC0, 0x2A, 0x43,
+0x42, 0xC0, 0x84, 0x11, 0x42, 0xC0, 0x6B, 0x4B, 0x7B, 0xC0, 0x0A, 0x43, 0x42, 0xAE, 0x42, 0x91,
+0x5B, 0xC0, 0xB4, 0x95, 0x6B, 0xC0, 0x46, 0x22, 0x73, 0xAF, 0xC0, 0x67, 0x22, 0xA6, 0x7F, 0x99,
+0x00, 0xA6, 0x00, 0x9A, 0x70, 0x00, 0x5C, 0xAF, 0x70, 0x95, 0x92, 0xA9, 0x70, 0xC0, 0xE9, 0x32,
+0x00, 0xAE, 0xC0, 0xCC, 0x53, 0x91, 0x47, 0x5B, 0x00, 0x56, 0xC1, 0xCD, 0x5B, 0x47, 0x2A, 0x73,
+0x52, 0xC0, 0x68, 0x2A, 0x5A, 0xC1, 0xEE, 0x5B, 0x8C, 0x53, 0x5A, 0x6E, 0x42, 0xC0, 0xE6, 0x21,
+0x42, 0x00, 0xC0, 0x22, 0x09, 0x51, 0xBF, 0xC0, 0x28, 0x32, 0x95, 0xC0, 0x48, 0x32, 0x5F, 0xC0,
+0xAA, 0x42, 0x00, 0x4B, 0x5F, 0x00, 0xAF, 0xBE, 0x64, 0x5F, 0x64, 0x73, 0xC0, 0xEB, 0x4A, 0x6B,
+0xC0, 0x86, 0x19, 0x47, 0x73, 0xC4, 0xEF, 0x6B, 0x99, 0xC6, 0x74, 0x9D, 0xC7, 0x29, 0x48, 0x3A,
+0xAB, 0xC8, 0x86, 0x21, 0x71, 0x84, 0x3D, 0xDF, 0xB7, 0xAD, 0x0C, 0x53, 0xA5, 0x21, 0x82, 0x21,
+0xE7, 0x83, 0xF1, 0xEE, 0xA1, 0xC2, 0x75, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x69, 0xCA, 0x9B,
+0xF7, 0xD8, 0xFF, 0x11, 0xF7, 0x46, 0xC5, 0x29, 0xE6, 0x8B, 0xD6, 0x27, 0x54, 0x46, 0x3B, 0x89,
+0x83, 0x6B, 0xD3, 0x61, 0xD0, 0x5D, 0xC0, 0x40, 0xF8, 0x5D, 0xE0, 0x12, 0xC9, 0x82, 0xD8, 0x4A,
+0xDB, 0x34, 0xF6, 0xAD, 0x9C, 0x2B, 0x6C, 0x06, 0x3B, 0x62, 0x2A, 0x85, 0x63, 0xAC, 0xBD, 0xD1,
+0xEE, 0x57, 0x55, 0xAB, 0x97, 0xA9, 0xCC, 0xB8, 0xF7, 0x33, 0xF7, 0x0D, 0xD6, 0x8E, 0xE6, 0x72,
+0xFF, 0x0F, 0xCE, 0x26, 0x42, 0xA6, 0x29, 0x28, 0x3A, 0x71, 0x84, 0xF7, 0xB5, 0x3C, 0xDF, 0xFF,
+0xF7, 0x00, 0xC1, 0xBA, 0xCE, 0xB2, 0x8C, 0x6B, 0xC0, 0x71, 0x7C, 0x6A, 0xC1, 0x75, 0x9D, 0x8E,
+0x63, 0x95, 0xC1, 0xCD, 0x5B, 0x0E, 0x64, 0x95, 0x52, 0x66, 0x00, 0xC1, 0x6B, 0x4B, 0xC9, 0x3A,
+0x5A, 0xC1, 0x0A, 0x43, 0xAC, 0x53, 0x52, 0x66, 0xC0, 0x4F, 0x6C, 0x00, 0x95, 0xC2, 0x37, 0xA6,
+0xDD, 0xD7, 0x16, 0xA6, 0x6B, 0x01, 0x57, 0xAE, 0xAB, 0xAE, 0x63, 0x00, 0x68, 0x00, 0xBE, 0xAB,
+0xAE, 0x00, 0x95, 0x63, 0x5C, 0x00, 0x63, 0x00, 0x57, 0x95, 0x6B, 0x57, 0xC0, 0x8C, 0x4B, 0x6F,
+0xC4, 0x68, 0x2A, 0xC5, 0x19, 0x09, 0x3B, 0x8B, 0x4B, 0xE9, 0x3A, 0x7F, 0xC3, 0x2A, 0x43, 0x88,
+0x32, 0x06, 0x22, 0x67, 0x2A, 0x00, 0xBA, 0x7D, 0xC0, 0xE6, 0x21, 0x62, 0x51, 0xA5, 0xC2, 0x70,
+0x74, 0x4D, 0x5B, 0x69, 0x3A, 0x91, 0xAF, 0x5F, 0xC1, 0x8A, 0x3A, 0xCB, 0x4A, 0x5F, 0x00, 0xBF,
+0x00, 0x6B, 0x5F, 0x01, 0x96, 0xC0, 0x2C, 0x53, 0x56, 0xC0, 0xC7, 0x29, 0x5F, 0xC2, 0x0C, 0x53,
+0xD6, 0xAD, 0xFF, 0xF7, 0x91, 0xCF, 0x34, 0x9D, 0xEF, 0x73, 0x28, 0x3A, 0x45, 0x19, 0xF0, 0x73,
+0x7E, 0xE7, 0xFF, 0xF7, 0x9A, 0xC6, 0xA9, 0x42, 0x62, 0x21, 0xE4, 0x5A, 0x70, 0xDE, 0x53, 0xFF,
+0xB6, 0xFF, 0xDA, 0xFF, 0xDD, 0xFF, 0x71, 0x95, 0x49, 0xCA, 0xB7, 0xFF, 0xEF, 0xEE, 0xC9, 0xD5,
+0xCC, 0xF6, 0x4B, 0xCE, 0xE5, 0x4B, 0x25, 0x33, 0x8A, 0x8B, 0x6B, 0xDB, 0x62, 0xD8, 0x01, 0xF8,
+0xAD, 0x5D, 0xE0, 0x12, 0xCA, 0x82, 0xD8, 0x4A, 0xDB, 0x34, 0xF6, 0xAD, 0x9C, 0x2B, 0x6C, 0x48,
+0x3B, 0xC5, 0x2A, 0xA2, 0x42, 0x06, 0x7C, 0x0E, 0xCE, 0x54, 0xFF, 0x6F, 0xC0, 0xD9, 0xFF, 0x49,
+0xAE, 0xC1, 0xD7, 0xFF, 0x74, 0xFF, 0xA0, 0xC0, 0x73, 0xFF, 0x44, 0xC1, 0x4E, 0xB5, 0x46, 0x42,
+0x83, 0xC5, 0xEB, 0x4A, 0x4C, 0x5B, 0x89, 0x42, 0xAE, 0x63, 0x34, 0x95, 0x10, 0x74, 0x57, 0x7B,
+0xC0, 0x08, 0x32, 0x95, 0xC0, 0x45, 0x19, 0x4B, 0x00, 0x5B, 0xC2, 0x07, 0x2A, 0x88, 0x3A, 0x27,
+0x2A, 0x00, 0xC0, 0xEA, 0x42, 0xBA, 0x95, 0xC1, 0x2B, 0x4B, 0x68, 0x32, 0xBF, 0x7D, 0x78, 0x69,
+0xA6, 0x69, 0x00, 0xC1, 0x0A, 0x43, 0xEE, 0x63, 0x65, 0x69, 0x7D, 0x95, 0x91, 0x00, 0x6E, 0x66,
+0x01, 0xAE, 0xBE, 0xAF, 0xBA, 0x00, 0x73, 0x66, 0x6B, 0x42, 0xAF, 0x42, 0x96, 0xC0, 0x4B, 0x4B,
+0x42, 0x51, 0x7D, 0x42, 0x6A, 0x56, 0x42, 0x69, 0xC0, 0x2B, 0x43, 0x56, 0x7D, 0x65, 0xBF, 0x69,
+0x50, 0x69, 0x55, 0xC1, 0x68, 0x3A, 0x06, 0x2A, 0xA6, 0x7B, 0xC0, 0xCA, 0x4A, 0x74, 0xB6, 0xC0,
+0x8A, 0x42, 0x5F, 0x00, 0x4B, 0xC1, 0x49, 0x3A, 0xAB, 0x4A, 0x80, 0xC0, 0x08, 0x32, 0x6E, 0xA5,
+0x5A, 0x62, 0x73, 0x5F, 0x46, 0xC0, 0xCB, 0x4A, 0x7E, 0x73, 0xC0, 0xA6, 0x21, 0x42, 0xC5, 0x17,
+0xB6, 0xFF, 0xF7, 0x9D, 0xE7, 0xDE, 0xEF, 0xDA, 0xCE, 0xB2, 0x8C, 0x5A, 0x5E, 0x7E, 0xC9, 0x9A,
+0xC6, 0x9E, 0xE7, 0xCF, 0x63, 0xA5, 0x29, 0x02, 0x42, 0x8E, 0xBD, 0x53, 0xFF, 0x75, 0xFF, 0x77,
+0xFF, 0xFC, 0xFF, 0xAB, 0xA4, 0xC2, 0xD8, 0xFF, 0x95, 0xFF, 0xEF, 0xEE, 0x90, 0xC7, 0x0E, 0xF7,
+0x48, 0xA5, 0x84, 0x3B, 0x05, 0x33, 0xAA, 0x8B, 0x6B, 0xDB, 0x82, 0xD8, 0x01, 0xF8, 0xAD, 0xA6,
+0xE0, 0x12, 0x73, 0xC1, 0x4A, 0xDB, 0x34, 0xF6, 0x4D, 0xC8, 0x2B, 0x6C, 0x8A, 0x3B, 0x07, 0x2B,
+0x42, 0x2A, 0xA2, 0x4A, 0x88, 0x94, 0x4F, 0xD6, 0x34, 0xF7, 0x96, 0xFF, 0xAB, 0xC0, 0xF7, 0xFF,
+0x57, 0xA9, 0x5C, 0xCB, 0x13, 0xF7, 0xCF, 0xC5, 0xC9, 0x73, 0x46, 0x3A, 0xA5, 0x21, 0x07, 0x2A,
+0x48, 0x32, 0x44, 0x11, 0xC5, 0x21, 0x0B, 0x53, 0x69, 0x3A, 0xA6, 0x21, 0x50, 0xBF, 0x96, 0x00,
+0xC3, 0xAA, 0x42, 0xCE, 0x63, 0xB5, 0x9D, 0xB2, 0x84, 0xA5, 0x91, 0xAE, 0xC0, 0xB2, 0x8C, 0x4C,
+0xC0, 0x0F, 0x74, 0x47, 0xC0, 0x75, 0xA5, 0x95, 0x96, 0xA9, 0x92, 0xA5, 0xAE, 0x48, 0xC0, 0x91,
+0x7C, 0x74, 0x6F, 0xC1, 0x13, 0x8D, 0x74, 0x9D, 0x48, 0x74, 0x00, 0x96, 0xA5, 0x9A, 0x58, 0x5D,
+0x00, 0x6C, 0xAE, 0xC0, 0x50, 0x74, 0x91, 0x61, 0x00, 0xAF, 0xB9, 0x61, 0x91, 0xC0, 0x2B, 0x4B,
+0xA1, 0xAF, 0xC0, 0x68, 0x3A, 0x64, 0xC0, 0xCA, 0x42, 0x60, 0xC1, 0x6C, 0x5B, 0xEA, 0x42, 0x4C,
+0xC0, 0x8D, 0x5B, 0x60, 0xC1, 0xAA, 0x42, 0xAD, 0x63, 0x92, 0xC1, 0x89, 0x3A, 0xCA, 0x4A, 0x91,
+0xA6, 0xA9, 0x7B, 0xC0, 0xEA, 0x52, 0xA6, 0xC1, 0x28, 0x3A, 0x6D, 0x63, 0x56, 0xC0, 0x6A, 0x42,
+0x91, 0x90, 0x5F, 0x7D, 0x95, 0xC0, 0xC7, 0x31, 0x5A, 0x01, 0x6E, 0x56, 0x7D, 0xC0, 0xE7, 0x29,
+0xBB, 0x6E, 0xAE, 0x5A, 0xC1, 0x8E, 0x63, 0x7D, 0xDF, 0xA5, 0xC2, 0x71, 0x84, 0xF7, 0xB5, 0xBE,
+0xEF, 0x00, 0xC0, 0xB6, 0xAD, 0x52, 0x46, 0x42, 0xC1, 0xFF, 0xEF, 0x11, 0x6C, 0x5F, 0xC6, 0xA2,
+0x31, 0x4A, 0x94, 0xF2, 0xEE, 0x74, 0xFF, 0x14, 0xEF, 0x97, 0xFF, 0xD9, 0xFF, 0xA9, 0xC0, 0xB5,
+0xFF, 0xA8, 0xA0, 0x80, 0xC3, 0x6C, 0xCE, 0x24, 0x74, 0x64, 0x33, 0x05, 0x33, 0x4A, 0xC2, 0x6B,
+0xD3, 0x62, 0xD8, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x82, 0xD8, 0x4A, 0xDB, 0x34, 0xF6, 0xAD, 0x9C,
+0x2C, 0x64, 0x4A, 0x2B, 0xA9, 0xC6, 0xE6, 0x2A, 0x82, 0x32, 0xC2, 0x4A, 0xE6, 0x7B, 0x6D, 0xB5,
+0x50, 0xD6, 0x34, 0xEF, 0x00, 0xC0, 0x71, 0xDE, 0xAB, 0xAF, 0xC7, 0xB1, 0xBD, 0xAE, 0x94, 0xAB,
+0x6B, 0xC8, 0x42, 0x06, 0x2A, 0x84, 0x19, 0x88, 0x3A, 0x6C, 0x53, 0x65, 0xC2, 0x89, 0x3A, 0xC5,
+0x21, 0x07, 0x2A, 0x64, 0x41, 0x50, 0x78, 0x5F, 0xC1, 0xEF, 0x63, 0xDA, 0xC6, 0xB6, 0x7A, 0xC1,
+0x55, 0xA5, 0x95, 0xAD, 0x7A, 0xC1, 0x17, 0xBE, 0x99, 0xC6, 0xBA, 0xC0, 0xF7, 0xB5, 0xA6, 0xC1,
+0x17, 0xB6, 0x58, 0xC6, 0x9A, 0x53, 0x4E, 0xC0, 0x38, 0xBE, 0x7B, 0x62, 0xA6, 0xC0, 0x79, 0xC6,
+0x4A, 0x00, 0x96, 0xC0, 0xDA, 0xCE, 0xBF, 0x9A, 0xA6, 0x4F, 0x00, 0xAE, 0x5B, 0xAE, 0xC0, 0x5C,
+0xD7, 0xA6, 0x00, 0xA9, 0xA6, 0x01, 0x5E, 0x4A, 0xC1, 0x3C, 0xDF, 0xFF, 0xF7, 0x91, 0xC0, 0x5D,
+0xE7, 0x72, 0x4A, 0xBE, 0x5E, 0x72, 0xC0, 0x7D, 0xE7, 0x4F, 0x56, 0x72, 0xC0, 0xDB, 0xD6, 0x63,
+0x41, 0x77, 0x59, 0x00, 0x41, 0xC0, 0xDE, 0xF7, 0xAB, 0x46, 0xC0, 0xFC, 0xD6, 0x4A, 0x92, 0x95,
+0x91, 0xBE, 0x76, 0xA6, 0x49, 0x5A, 0x01, 0x76, 0x59, 0x4A, 0x5A, 0xC0, 0x76, 0xA5, 0x95, 0xC2,
+0xB7, 0xAD, 0x71, 0x84, 0x10, 0x74, 0x77, 0x63, 0xC2, 0xAE, 0x6B, 0xEA, 0x4A, 0xB6, 0xA5, 0x63,
+0xC1, 0xBE, 0xEF, 0xFF, 0xF7, 0x96, 0x6E, 0xC1, 0xBB, 0xC6, 0xED, 0x4A, 0x50, 0xC3, 0x41, 0x21,
+0xE5, 0x5A, 0x2F, 0xCE, 0x93, 0xFF, 0x92, 0x00, 0xC1, 0x94, 0xFF, 0xF5, 0xFF, 0xA0, 0xAD, 0xC9,
+0x71, 0xF7, 0x8D, 0xCE, 0x07, 0x8D, 0x82, 0x4B, 0x64, 0x2B, 0x46, 0x3B, 0xCA, 0x93, 0x4B, 0xD3,
+0x41, 0xD0, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x11, 0x73, 0xC1, 0x4A, 0xDB, 0x34, 0xF6, 0x4D,
+0xC1, 0x2C, 0x64, 0x6A, 0x2B, 0x96, 0xB4, 0xC4, 0xA5, 0x32, 0x21, 0x2A, 0x62, 0x42, 0x66, 0x6B,
+0xE8, 0x7B, 0xBE, 0xA6, 0xC0, 0x26, 0x6B, 0xA6, 0x9B, 0xC0, 0x66, 0x4A, 0x96, 0x9F, 0xC2, 0x4B,
+0x53, 0xE9, 0x42, 0x63, 0x11, 0x00, 0xC0, 0x68, 0x32, 0x00, 0x91, 0xA5, 0xC0, 0x48, 0x32, 0x00,
+0x50, 0xC0, 0x89, 0x3A, 0xBF, 0xC4, 0x85, 0x19, 0x51, 0x74, 0xFF, 0xEF, 0x4D, 0x63, 0x29, 0x42,
+0xA5, 0xC0, 0x69, 0x4A, 0x6C, 0xBE, 0xAF, 0xC0, 0xE8, 0x39, 0x6C, 0x58, 0x60, 0xC0, 0x49, 0x42,
+0x74, 0x6C, 0x74, 0xC1, 0x8A, 0x4A, 0xCB, 0x52, 0x71, 0x79, 0x40, 0xC1, 0xAB, 0x52, 0xEB, 0x5A,
+0x9A, 0xC0, 0x2C, 0x63, 0x59, 0x01, 0x5E, 0x00, 0xAF, 0xBE, 0x00, 0x6A, 0x72, 0xAB, 0x72, 0x01,
+0x41, 0xC0, 0x8E, 0x6B, 0x41, 0xBE, 0x55, 0x41, 0x55, 0xC0, 0x10, 0x7C, 0x00, 0xC1, 0x51, 0x84,
+0xAF, 0x73, 0x7D, 0x00, 0xA5, 0x7D, 0x71, 0x64, 0xC0, 0x51, 0x8C, 0x91, 0xC0, 0x71, 0x8C, 0x40,
+0x96, 0xC0, 0x31, 0x8C, 0x54, 0xAB, 0xC1, 0x92, 0x94, 0xD3, 0x94, 0x03, 0xAF, 0xC0, 0x35, 0x9D,
+0x01, 0xBE, 0x01, 0xAF, 0xC0, 0xB7, 0xAD, 0xA5, 0xC1, 0x34, 0x9D, 0xD7, 0xB5, 0x59, 0x41, 0xCD,
+0x14, 0x95, 0x30, 0x7C, 0x38, 0xB6, 0xF2, 0x8C, 0x44, 0x19, 0xA6, 0x21, 0x2B, 0x53, 0x4D, 0x5B,
+0x71, 0x7C, 0x59, 0xC6, 0x9A, 0xC6, 0xF8, 0xB5, 0xD0, 0x6B, 0x2A, 0x2A, 0xB9, 0xC0, 0xA3, 0x29,
+0xBC, 0xC3, 0x69, 0x94, 0x0F, 0xCE, 0xF1, 0xE6, 0x73, 0xF7, 0xA1, 0xC5, 0x93, 0xFF, 0x31, 0xEF,
+0xCF, 0xDE, 0xCB, 0xB5, 0x86, 0x7C, 0x42, 0x43, 0x8A, 0xC5, 0xA6, 0x33, 0x87, 0x43, 0xCB, 0x93,
+0x2A, 0xD3, 0x41, 0xD0, 0x00, 0xF8, 0x00, 0xC0, 0x40, 0xF8, 0x5D, 0xE0, 0x11, 0x73, 0xC5, 0x4A,
+0xDB, 0x34, 0xF6, 0xAD, 0x9C, 0x2C, 0x64, 0xEB, 0x3B, 0x49, 0x23, 0xA1, 0xB5, 0xC0, 0x86, 0x2A,
+0xA0, 0xC0, 0x44, 0x3A, 0xBE, 0xC0, 0x03, 0x3A, 0xAB, 0xA1, 0x96, 0x97, 0x96, 0xAF, 0xC4, 0xC6,
+0x21, 0xC9, 0x42, 0x6B, 0x53, 0xA8, 0x3A, 0xE5, 0x21, 0x91, 0x00, 0xC1, 0x06, 0x2A, 0x47, 0x32,
+0x50, 0xAE, 0xC7, 0x69, 0x3A, 0xA9, 0x3A, 0x07, 0x32, 0x85, 0x19, 0x13, 0x8D, 0xFB, 0xCE, 0x49,
+0x42, 0xC7, 0x39, 0x91, 0x00, 0xAB, 0x4C, 0x58, 0xA6, 0x60, 0x58, 0xA1, 0x00, 0x4C, 0x58, 0xBF,
+0xC0, 0x49, 0x4A, 0x67, 0x58, 0x67, 0x58, 0x60, 0x6C, 0xC0, 0xA7, 0x31, 0x00, 0x53, 0x58, 0x00,
+0xAE, 0x03, 0xAF, 0x5D, 0x00, 0x58, 0x95, 0x00, 0x58, 0x5D, 0x58, 0x01, 0x4C, 0xC1, 0x29, 0x4A,
+0x8A, 0x52, 0x58, 0x01, 0x4C, 0x00, 0x67, 0x60, 0x44, 0x53, 0x58, 0x44, 0x53, 0xBE, 0x53, 0x4C,
+0x78, 0x91, 0x44, 0x49, 0x03, 0x58, 0x01, 0x49, 0x58, 0x00, 0x9A, 0x49, 0x01, 0x44, 0x81, 0x00,
+0xC0, 0x08, 0x32, 0xA5, 0x91, 0xC0, 0xEB, 0x4A, 0x00, 0xC1, 0x89, 0x42, 0x4C, 0x5B, 0x81, 0xC0,
+0xE7, 0x29, 0x91, 0xC0, 0x49, 0x3A, 0x69, 0xC2, 0x6A, 0x42, 0xA7, 0x21, 0x6B, 0x32, 0xBD, 0xC5,
+0x27, 0x32, 0xE3, 0x31, 0xA8, 0x73, 0x8B, 0x94, 0x2C, 0xAD, 0xAE, 0xB5, 0x60, 0x00, 0xC0, 0xCA,
+0x9C, 0x81, 0xC6, 0x84, 0x5B, 0x03, 0x3B, 0xC2, 0x22, 0x85, 0x2B, 0xE7, 0x33, 0xC8, 0x4B, 0xEB,
+0x93, 0x51, 0xC1, 0x62, 0xD8, 0x21, 0xF8, 0xA5, 0xAE, 0x5D, 0xE0, 0x11, 0xC0, 0x82, 0xD8, 0x59,
+0xC6, 0x34, 0xF6, 0xAD, 0x9C, 0x2B, 0x6C, 0x0B, 0x44, 0x89, 0x2B, 0x29, 0x23, 0x4A, 0x33, 0xA1,
+0xC0, 0x46, 0x22, 0xB1, 0xC2, 0x67, 0x3A, 0xE5, 0x31, 0x26, 0x3A, 0xAB, 0xA6, 0x00, 0x9B, 0x00,
+0x81, 0xC4, 0xA4, 0x19, 0x09, 0x4B, 0x2E, 0x6C, 0x6F, 0x7C, 0x0E, 0x6C, 0xA5, 0x69, 0xC0, 0x4B,
+0x53, 0xBF, 0x96, 0xA6, 0xC0, 0x28, 0x32, 0x57, 0x5F, 0xC1, 0x75, 0xA5, 0x51, 0x7C, 0x53, 0xC0,
+0x49, 0x4A, 0x67, 0xA5, 0xC0, 0x4A, 0x4A, 0x6C, 0x53, 0x6C, 0x4C, 0x53, 0x5B, 0x00, 0x67, 0x00,
+0xA9, 0x5B, 0x60, 0x67, 0x7B, 0x5B, 0xC2, 0x29, 0x4A, 0x8A, 0x52, 0xE8, 0x39, 0x5B, 0x6C, 0x00,
+0x71, 0x01, 0x6C, 0x95, 0x00, 0x6C, 0x5D, 0x58, 0x00, 0x5D, 0x71, 0xBF, 0x00, 0xC0, 0xAB, 0x52,
+0x01, 0x7B, 0x54, 0xBF, 0x67, 0x00, 0x5B, 0x6C, 0xC0, 0x66, 0x31, 0x53, 0x6F, 0x53, 0x00, 0x5B,
+0x67, 0x47, 0x5B, 0x60, 0xBB, 0x6C, 0x5B, 0x6F, 0x58, 0x02, 0x60, 0x67, 0x60, 0x5D, 0x58, 0x5D,
+0x60, 0x5D, 0x58, 0x95, 0x53, 0x58, 0xAF, 0x55, 0xC0, 0x66, 0x21, 0xAE, 0x5A, 0xC0, 0x49, 0x3A,
+0xAD, 0xC2, 0xCE, 0x6B, 0x4C, 0x5B, 0x28, 0x32, 0x6B, 0x4B, 0x6E, 0xA6, 0xC0, 0xCB, 0x4A, 0x91,
+0x86, 0xC0, 0xE8, 0x21, 0xB4, 0xC1, 0x87, 0x42, 0xEF, 0x94, 0xA5, 0xC2, 0xEA, 0x73, 0x27, 0x63,
+0x63, 0x4A, 0x81, 0x00, 0xC4, 0xA4, 0x42, 0x42, 0x2A, 0x05, 0x33, 0x66, 0x2B, 0xE8, 0x33, 0xAE,
+0xC4, 0xE8, 0x4B, 0x0C, 0x9C, 0x4B, 0xD3, 0x82, 0xD8, 0x21, 0xF8, 0xA5, 0xE0, 0x12, 0xAB, 0xC5,
+0x61, 0xD8, 0xAC, 0xEB, 0x34, 0xFE, 0xCE, 0x9C, 0x6B, 0x74, 0x88, 0x3B, 0x9A, 0xC3, 0xAA, 0x3B,
+0xED, 0x4B, 0x4C, 0x43, 0x68, 0x2A, 0xA2, 0xC1, 0xA9, 0x3A, 0x07, 0x32, 0xA6, 0x49, 0x55, 0x5A,
+0xAF, 0x00, 0xAD, 0xC3, 0xC5, 0x21, 0x26, 0x32, 0xA8, 0x42, 0x2A, 0x53, 0xAF, 0xA6, 0x95, 0xA1,
+0xAB, 0x91, 0xC0, 0x27, 0x32, 0x4E, 0x7A, 0x6B, 0xC5, 0xD2, 0x8C, 0x10, 0x7C, 0x29, 0x42, 0x0D,
+0x63, 0x4A, 0x4A, 0xE9, 0x41, 0x5B, 0x01, 0xAF, 0x91, 0x5B, 0x67, 0xBE, 0x67, 0x62, 0x67, 0x6F,
+0x62, 0x67, 0xBF, 0x67, 0x44, 0x53, 0x6C, 0x00, 0x91, 0x67, 0x00, 0x6C, 0x01, 0x96, 0x00, 0xC0,
+0x6A, 0x4A, 0x96, 0x00, 0xC1, 0x8A, 0x4A, 0xCC, 0x52, 0xBE, 0x00, 0x63, 0x40, 0x7B, 0x6F, 0x40,
+0xBA, 0x7B, 0x76, 0x6F, 0x5B, 0x53, 0x58, 0x67, 0x6C, 0x5B, 0x00, 0x6C, 0x7B, 0x6C, 0x67, 0x00,
+0x6C, 0x00, 0x67, 0x00, 0x58, 0x00, 0x67, 0x6C, 0x67, 0x53, 0x4C, 0x58, 0xBE, 0x58, 0x00, 0xAE,
+0x67, 0x60, 0x58, 0x4C, 0x53, 0x58, 0x5D, 0xC0, 0xA7, 0x29, 0x4E, 0xC0, 0x69, 0x3A, 0x5F, 0x95,
+0xBE, 0x00, 0x73, 0x50, 0x5F, 0xC1, 0xCB, 0x4A, 0x29, 0x3A, 0x80, 0xC0, 0x69, 0x32, 0x90, 0xBF,
+0xC0, 0xA9, 0x42, 0xBA, 0xC0, 0x26, 0x3A, 0x95, 0x51, 0x45, 0x00, 0x51, 0xC0, 0x66, 0x2A, 0x99,
+0xC8, 0xA5, 0x12, 0x47, 0x1B, 0xE8, 0x2B, 0x28, 0x34, 0xE8, 0x4B, 0x2C, 0x9C, 0x4B, 0xD3, 0x82,
+0xD8, 0x01, 0xF8, 0xA9, 0xAE, 0x5D, 0xE0, 0x10, 0x64, 0xC1, 0x61, 0xD8, 0xAC, 0xEB, 0x5E, 0xC3,
+0xCE, 0x9C, 0x6B, 0x74, 0xE9, 0x4B, 0x88, 0x3B, 0xA7, 0xC2, 0x6B, 0x43, 0xEB, 0x32, 0x08, 0x22,
+0xA1, 0xC0, 0x29, 0x32, 0x5A, 0x02, 0xAB, 0x01, 0x99, 0xBD, 0x51, 0x96, 0x02, 0xBA, 0x00, 0x6B,
+0xC0, 0x07, 0x32, 0xBE, 0xC5, 0xC6, 0x31, 0x07, 0x3A, 0x69, 0x42, 0xF3, 0x9C, 0x71, 0x8C, 0xC7,
+0x39, 0x63, 0xC0, 0x29, 0x42, 0xA6, 0xA6, 0x67, 0xA5, 0x67, 0xBE, 0x7B, 0xA6, 0x6C, 0x67, 0x6C,
+0x67, 0x62, 0x67, 0x95, 0x6F, 0x7B, 0x67, 0x00, 0x6C, 0x67, 0x6C, 0x00, 0x71, 0x00, 0x6C, 0x03,
+0x71, 0x03, 0x7B, 0x01, 0x67, 0x00, 0x7B, 0x00, 0x5B, 0x00, 0x76, 0xC0, 0xC8, 0x39, 0x58, 0x67,
+0x6F, 0x67, 0x62, 0x00, 0x6C, 0x6F, 0x6C, 0x67, 0x00, 0x6C, 0x01, 0x67, 0x58, 0x00, 0x60, 0x6C,
+0x67, 0x58, 0x00, 0x67, 0x5B, 0x01, 0x60, 0x01, 0x58, 0x53, 0x00, 0x91, 0x44, 0xAE, 0xC1, 0x08,
+0x3A, 0x48, 0x3A, 0x50, 0x00, 0x40, 0x96, 0xBA, 0x78, 0xC2, 0xCB, 0x4A, 0x0C, 0x53, 0x6A, 0x42,
+0x5A, 0x84, 0xC4, 0x88, 0x32, 0xCA, 0x42, 0x69, 0x3A, 0x07, 0x32, 0xA6, 0x21, 0x00, 0x43, 0x50,
+0x00, 0x9A, 0x9E, 0xC3, 0x66, 0x1A, 0xC7, 0x12, 0x88, 0x1B, 0x09, 0x2C, 0xBE, 0xC0, 0xE9, 0x53,
+0x72, 0xC1, 0x4B, 0xD3, 0x62, 0xD8, 0x64, 0xA9, 0xAE, 0x5D, 0xE0, 0x10, 0x64, 0xC0, 0x41, 0xD8,
+0x7C, 0x5E, 0xC4, 0xCE, 0x9C, 0x6C, 0x74, 0xEA, 0x4B, 0x68, 0x33, 0x09, 0x2B, 0xBB, 0xC1, 0xAA,
+0x32, 0x29, 0x2A, 0x5C, 0x73, 0x5F, 0xBA, 0x00, 0x5A, 0x00, 0x61, 0xC1, 0x4A, 0x3A, 0x8B, 0x3A,
+0xA8, 0xA5, 0x96, 0xA5, 0x53, 0x58, 0x00, 0x67, 0x53, 0xBA, 0x00, 0xC1, 0xA6, 0x31, 0xEB, 0x52,
+0xBE, 0xC4, 0x30, 0x84, 0xCE, 0x73, 0x66, 0x29, 0x6A, 0x4A, 0x09, 0x42, 0x95, 0x67, 0x00, 0x5B,
+0x67, 0x00, 0xAE, 0x01, 0xC1, 0x8B, 0x52, 0x0D, 0x63, 0xAE, 0x68, 0x91, 0x67, 0x00, 0x40, 0x6F,
+0x67, 0x6C, 0x67, 0x40, 0x00, 0xA6, 0x9A, 0x03, 0x91, 0x6C, 0x71, 0x69, 0x58, 0x9A, 0x64, 0x6C,
+0x58, 0x6C, 0x67, 0x7F, 0xC0, 0xC8, 0x39, 0x7B, 0x6F, 0x44, 0xC0, 0xE9, 0x41, 0x67, 0x00, 0x53,
+0x01, 0x67, 0x6C, 0x00, 0x67, 0x01, 0x6C, 0x02, 0x60, 0x58, 0x5B, 0x67, 0x00, 0x5B, 0x60, 0x74,
+0x5B, 0x60, 0x67, 0x60, 0x5B, 0x58, 0x01, 0x53, 0x47, 0xC0, 0x08, 0x3A, 0x00, 0xAE, 0xAE, 0x9A,
+0x00, 0xC0, 0x89, 0x3A, 0xAE, 0x78, 0x4C, 0xA6, 0xC0, 0x49, 0x3A, 0x69, 0x5A, 0xC1, 0x05, 0x22,
+0x09, 0x43, 0xAB, 0x64, 0x4B, 0x01, 0x5C, 0x92, 0xAE, 0xAE, 0x99, 0xC1, 0x67, 0x12, 0xE7, 0x12,
+0x4D, 0xC2, 0xE8, 0x23, 0x49, 0x34, 0x09, 0x54, 0x72, 0xC2, 0x4B, 0xD3, 0x62, 0xD8, 0x01, 0xF8,
+0xA9, 0xAE, 0x5D, 0xE0, 0x10, 0x64, 0xC3, 0x41, 0xD8, 0xAC, 0xEB, 0x34, 0xFE, 0xCE, 0x9C, 0x6D,
+0xC0, 0xA9, 0x3B, 0x82, 0xC0, 0x09, 0x2B, 0xB6, 0xA2, 0x5C, 0xA5, 0xC0, 0x47, 0x3A, 0x90, 0xA6,
+0xA6, 0xAF, 0x5A, 0xC0, 0x49, 0x32, 0xAB, 0xAE, 0xA0, 0xAE, 0x01, 0x67, 0x01, 0xA6, 0x99, 0xA6,
+0xBA, 0xC2, 0x85, 0x29, 0x69, 0x42, 0xA5, 0x29, 0x62, 0xC3, 0xCB, 0x52, 0x45, 0x21, 0x6A, 0x4A,
+0xE8, 0x39, 0x00, 0xBF, 0x6C, 0x67, 0x6C, 0x67, 0x6C, 0x67, 0x6C, 0x68, 0xC1, 0x10, 0x7C, 0x52,
+0x8C, 0x95, 0xC1, 0x8F, 0x73, 0x6A, 0x52, 0x67, 0x6C, 0x67, 0x58, 0x67, 0x6C, 0xBF, 0x00, 0x9A,
+0x71, 0x78, 0x71, 0x40, 0x00, 0x6C, 0x71, 0x00, 0x6C, 0x69, 0x6C, 0x7B, 0xC0, 0x8A, 0x4A, 0x7B,
+0x00, 0x67, 0x00, 0xC0, 0x0D, 0x63, 0x4C, 0xA6, 0xC1, 0x2D, 0x6B, 0xC8, 0x39, 0xBE, 0x01, 0x67,
+0x6C, 0x00, 0xA5, 0x67, 0x60, 0x9B, 0x67, 0x6C, 0x03, 0x60, 0x5B, 0x67, 0x00, 0x5B, 0x67, 0x7B,
+0x58, 0x60, 0x67, 0x00, 0x58, 0x01, 0x60, 0x58, 0xBB, 0x60, 0x49, 0xAF, 0xC0, 0x8A, 0x42, 0x95,
+0xC1, 0xC6, 0x21, 0x89, 0x3A, 0xAE, 0x91, 0xC0, 0xEB, 0x4A, 0xA6, 0xC0, 0x28, 0x32, 0x73, 0x00,
+0x98, 0xC1, 0xE8, 0x3A, 0x47, 0x2A, 0x7C, 0x57, 0xBF, 0x57, 0x5F, 0x00, 0x9E, 0x96, 0x95, 0xC9,
+0x46, 0x12, 0xE7, 0x1A, 0xA9, 0x23, 0x29, 0x2C, 0x49, 0x3C, 0x09, 0x54, 0x2C, 0x9C, 0x4B, 0xD3,
+0x62, 0xD8, 0x01, 0xF8, 0xA9, 0xAE, 0x5D, 0xE0, 0x10, 0x64, 0xC1, 0x41, 0xD8, 0xAC, 0xEB, 0x5E,
+0xC2, 0xCE, 0x9C, 0x6C, 0x74, 0x8A, 0x3B, 0x9E, 0xA2, 0xC1, 0xE8, 0x32, 0x67, 0x2A, 0xB5, 0xC5,
+0x86, 0x42, 0xE7, 0x52, 0x69, 0x63, 0x07, 0x5B, 0x65, 0x42, 0x04, 0x3A, 0x97, 0xC1, 0x27, 0x32,
+0x69, 0x3A, 0xAF, 0x73, 0x6B, 0x00, 0xA9, 0xA6, 0x00, 0xA5, 0x02, 0xBA, 0xC2, 0x44, 0x21, 0xE6,
+0x31, 0x23, 0x19, 0x56, 0xC0, 0x0B, 0x5B, 0x70, 0x45, 0xC0, 0x08, 0x3A, 0xA6, 0x60, 0x6C, 0x00,
+0x74, 0x60, 0x6C, 0x60, 0x6C, 0x68, 0x4C, 0xC0, 0xB3, 0x94, 0xA5, 0xC2, 0xAF, 0x73, 0x8A, 0x52,
+0xE8, 0x41, 0x60, 0x5B, 0x00, 0x6C, 0xBE, 0x6C, 0x03, 0x71, 0xBF, 0x00, 0x45, 0x76, 0x6C, 0x71,
+0x40, 0x45, 0xBF, 0x00, 0x43, 0xC0, 0xC8, 0x39, 0x40, 0x4C, 0xC2, 0x35, 0xAD, 0xD3, 0x9C, 0x11,
+0x84, 0x00, 0xC1, 0x6E, 0x73, 0xEC, 0x62, 0x7B, 0x5B, 0x00, 0x6C, 0x6F, 0x6C, 0x60, 0x00, 0x6C,
+0x02, 0x71, 0x00, 0x40, 0x6C, 0x60, 0x01, 0x5D, 0x60, 0x71, 0x60, 0xAB, 0x6C, 0x67, 0x58, 0x00,
+0x5D, 0x67, 0xA1, 0x95, 0x9A, 0x49, 0x76, 0xC0, 0x8D, 0x63, 0x9A, 0x73, 0x78, 0x95, 0xC0, 0xE7,
+0x29, 0x73, 0x7F, 0xC0, 0x08, 0x32, 0xAF, 0x4B, 0xC0, 0x0B, 0x43, 0x7A, 0xC0, 0x07, 0x22, 0x50,
+0xC0, 0x49, 0x32, 0xA0, 0xC1, 0xA5, 0x29, 0xE6, 0x31, 0xA9, 0xAF, 0xAE, 0x9F, 0xC3, 0x87, 0x22,
+0xE8, 0x22, 0x89, 0x2B, 0x09, 0x34, 0x7E, 0xC0, 0x09, 0x54, 0x72, 0xC0, 0x4B, 0xD3, 0x6E, 0xC0,
+0x01, 0xF8, 0xA9, 0xAE, 0x5D, 0xE0, 0x10, 0x64, 0xC1, 0x41, 0xD0, 0xAC, 0xEB, 0x5E, 0x59, 0xC1,
+0x8C, 0x74, 0xCA, 0x3B, 0x96, 0xC6, 0x48, 0x33, 0xC6, 0x32, 0xC6, 0x42, 0xCA, 0x6B, 0x2E, 0x9D,
+0x31, 0xC6, 0xF4, 0xDE, 0xA9, 0xC3, 0x52, 0xCE, 0x0E, 0x9D, 0x68, 0x63, 0x46, 0x3A, 0x92, 0xC1,
+0x48, 0x32, 0xAA, 0x3A, 0xAB, 0x95, 0xA5, 0x6B, 0x01, 0xBA, 0x95, 0xC0, 0x69, 0x3A, 0xA5, 0xC0,
+0x64, 0x21, 0x4C, 0x47, 0xC0, 0x8D, 0x6B, 0xAE, 0xC1, 0xA6, 0x31, 0x8A, 0x52, 0x60, 0x58, 0x5B,
+0x6C, 0x00, 0xBE, 0x92, 0x6C, 0x60, 0x00, 0x48, 0xC1, 0x6E, 0x6B, 0xCF, 0x7B, 0x00, 0xC0, 0xEC,
+0x5A, 0x6F, 0x60, 0x6F, 0x9A, 0x00, 0x74, 0x6F, 0x60, 0x00, 0x6C, 0x01, 0xAE, 0x01, 0x54, 0x91,
+0x71, 0x00, 0x40, 0x45, 0x40, 0x74, 0x6F, 0x58, 0x48, 0xC2, 0xF0, 0x83, 0x72, 0x94, 0x10, 0x84,
+0x7B, 0xC1, 0x92, 0x94, 0x35, 0xAD, 0x63, 0xC1, 0x6E, 0x73, 0xAB, 0x5A, 0x74, 0x60, 0x00, 0x6F,
+0x67, 0x6C, 0x04, 0x71, 0xBF, 0x6C, 0x95, 0x60, 0x67, 0x5D, 0x60, 0x6C, 0x67, 0x6C, 0x67, 0x60,
+0x5D, 0x58, 0x60, 0x00, 0x92, 0xA5, 0x53, 0x5D, 0xAE, 0xC1, 0xEB, 0x4A, 0x8D, 0x63, 0x81, 0xC1,
+0x27, 0x2A, 0x68, 0x32, 0x64, 0x00, 0xA6, 0xA6, 0x00, 0x95, 0xC2, 0x0B, 0x43, 0x69, 0x2A, 0x08,
+0x22, 0xBE, 0xA5, 0xC0, 0xC4, 0x29, 0xBA, 0xC0, 0x44, 0x42, 0xBE, 0x4E, 0x96, 0x9A, 0x8A, 0xC2,
+0x85, 0x1A, 0x47, 0x23, 0x09, 0x34, 0xA9, 0xC4, 0xE8, 0x4B, 0x0C, 0x9C, 0x4B, 0xD3, 0x82, 0xD8,
+0x01, 0xF8, 0xA9, 0xAE, 0x5D, 0xE0, 0x10, 0x64, 0xC1, 0x41, 0xD0, 0xAC, 0xEB, 0x5E, 0xC0, 0xCE,
+0xA4, 0x72, 0x65, 0x81, 0xC8, 0x06, 0x33, 0x67, 0x4B, 0xAB, 0x84, 0x51, 0xC6, 0x74, 0xF7, 0xD5,
+0xFF, 0x52, 0xF7, 0xD4, 0xFF, 0xF6, 0xFF, 0xA6, 0xC4, 0x72, 0xD6, 0x8C, 0x94, 0xC7, 0x52, 0xC4,
+0x29, 0x48, 0x2A, 0xAB, 0x00, 0xBF, 0x6B, 0x00, 0xA9, 0x00, 0xC1, 0xE7, 0x29, 0x68, 0x3A, 0x00,
+0xC0, 0xA5, 0x29, 0x91, 0xAE, 0xC2, 0x2F, 0x7C, 0xAD, 0x73, 0xA6, 0x31, 0x48, 0x60, 0x95, 0xBB,
+0x60, 0x00, 0xC0, 0x49, 0x4A, 0x01, 0x6F, 0x99, 0x00, 0x74, 0xAE, 0x40, 0x6F, 0x5B, 0x60, 0x74,
+0x6F, 0x00, 0x74, 0x60, 0x65, 0x00, 0xAB, 0x02, 0x65, 0x00, 0x40, 0x79, 0x74, 0x9A, 0x00, 0x6C,
+0x65, 0x00, 0x74, 0x00, 0x6C, 0x60, 0xC1, 0x49, 0x52, 0x2D, 0x6B, 0x63, 0xC0, 0x35, 0xAD, 0x63,
+0x95, 0x63, 0x00, 0xC0, 0xAF, 0x7B, 0x48, 0x51, 0x58, 0x6C, 0x71, 0x74, 0x71, 0x6C, 0x65, 0x71,
+0x01, 0x91, 0x58, 0x5D, 0x6C, 0x5D, 0x00, 0x6C, 0x01, 0x5D, 0x03, 0x60, 0xA7, 0x5B, 0x60, 0x51,
+0xC0, 0x45, 0x21, 0x4B, 0xC0, 0x0B, 0x4B, 0x91, 0xC0, 0x07, 0x2A, 0x69, 0x78, 0xC0, 0x28, 0x2A,
+0xBA, 0xC0, 0x8A, 0x42, 0x5A, 0xC2, 0x66, 0x19, 0x8A, 0x32, 0x07, 0x1A, 0xA1, 0xB9, 0xA5, 0xCA,
+0x85, 0x42, 0xE8, 0x7B, 0x69, 0x94, 0x33, 0xEF, 0x70, 0xD6, 0x8E, 0xB5, 0xAB, 0x8C, 0x87, 0x53,
+0xA4, 0x2A, 0xE5, 0x22, 0xC8, 0x33, 0x99, 0xC4, 0xC8, 0x4B, 0x0C, 0x9C, 0x4B, 0xD3, 0x82, 0xD8,
+0x21, 0xF8, 0xA5, 0xE0, 0x12, 0xAB, 0xC5, 0x41, 0xD0, 0x8C, 0xEB, 0x34, 0xF6, 0xCE, 0xA4, 0x8D,
+0x74, 0x48, 0x33, 0x91, 0xC5, 0x46, 0x43, 0x8A, 0x84, 0x71, 0xD6, 0xB5, 0xFF, 0x13, 0xF7, 0x0E,
+0xD6, 0x00, 0xC0, 0xAC, 0xC5, 0xBE, 0xC6, 0xF1, 0xEE, 0xB5, 0xFF, 0xF3, 0xEE, 0x6B, 0x94, 0x24,
+0x42, 0x48, 0x32, 0x6A, 0x32, 0x01, 0x70, 0x6B, 0xA5, 0x00, 0xC0, 0x69, 0x3A, 0x5F, 0x4B, 0xBA,
+0x95, 0xA1, 0xC4, 0x70, 0x84, 0x6D, 0x6B, 0x66, 0x29, 0x6A, 0x52, 0xE8, 0x41, 0x51, 0x5B, 0xAE,
+0x00, 0xBF, 0x5B, 0x60, 0x6F, 0x00, 0x96, 0x58, 0x00, 0x60, 0x67, 0x60, 0x6F, 0x74, 0x60, 0x00,
+0x6F, 0x5B, 0x6F, 0x74, 0x01, 0x6C, 0x65, 0x60, 0x9A, 0x65, 0x74, 0xAE, 0x74, 0x65, 0x60, 0x00,
+0x6C, 0x00, 0x5B, 0x58, 0x60, 0x00, 0xBE, 0x48, 0xC5, 0xEC, 0x62, 0x8E, 0x7B, 0xF0, 0x83, 0xD3,
+0x9C, 0x35, 0xAD, 0x31, 0x8C, 0x48, 0x58, 0x6C, 0x6F, 0x74, 0xAF, 0x74, 0x6C, 0x65, 0x6C, 0x71,
+0x6C, 0x58, 0x00, 0x5D, 0x6C, 0x00, 0x67, 0x6C, 0x71, 0x6C, 0x5D, 0x58, 0x60, 0x67, 0x00, 0x60,
+0xA6, 0x96, 0x95, 0x00, 0x5D, 0xC3, 0x8E, 0x63, 0xB1, 0x84, 0xAE, 0x63, 0x27, 0x32, 0x4B, 0x50,
+0xAB, 0xC5, 0x8E, 0x5B, 0xF4, 0x94, 0xCF, 0x6B, 0x49, 0x32, 0x0C, 0x43, 0x69, 0x2A, 0x55, 0xB0,
+0xC4, 0x64, 0x42, 0xCC, 0x9C, 0x54, 0xEF, 0xD5, 0xFF, 0x52, 0xFF, 0x00, 0xC0, 0xB4, 0xFF, 0x61,
+0xC2, 0x70, 0xC6, 0x89, 0x74, 0x86, 0x43, 0x9E, 0x8B, 0xC4, 0xA8, 0x4B, 0xEB, 0x9B, 0x6B, 0xD3,
+0x82, 0xD8, 0x01, 0xF8, 0xA9, 0xE0, 0x13, 0xCB, 0x82, 0xE0, 0xED, 0xF3, 0x14, 0xF6, 0xCF, 0xA4,
+0x6D, 0x74, 0x8A, 0x3B, 0x44, 0x1A, 0xE7, 0x6B, 0x71, 0xD6, 0x91, 0xEE, 0x30, 0xE6, 0xB3, 0xEE,
+0xAF, 0x9E, 0xC9, 0x92, 0xDE, 0x0F, 0xD6, 0xAD, 0xCD, 0x4C, 0xC5, 0x54, 0xFF, 0xB3, 0xE6, 0x64,
+0x52, 0x06, 0x32, 0xA7, 0x21, 0x69, 0x3A, 0x6B, 0x00, 0xA1, 0xAE, 0x5A, 0x91, 0x5A, 0xBA, 0x95,
+0x91, 0xA6, 0xC0, 0x10, 0x7C, 0x48, 0xC0, 0x86, 0x31, 0x48, 0xC0, 0x08, 0x42, 0x96, 0x60, 0x6C,
+0x00, 0xBE, 0x6F, 0x6C, 0xA6, 0x60, 0x58, 0x00, 0x5B, 0x60, 0x5B, 0x60, 0x67, 0x6C, 0x6F, 0x00,
+0x6C, 0x00, 0x6F, 0xC0, 0x6A, 0x4A, 0xA6, 0x60, 0x5B, 0x6C, 0x74, 0x6C, 0x6F, 0x43, 0x48, 0x74,
+0x6C, 0x00, 0xA9, 0x60, 0x91, 0xA9, 0xAF, 0x00, 0x45, 0xC0, 0x89, 0x52, 0x49, 0xBF, 0x00, 0xC0,
+0xCF, 0x7B, 0xA6, 0xC0, 0xCB, 0x5A, 0x6F, 0x74, 0x96, 0x60, 0x00, 0x6C, 0x74, 0x6F, 0x6C, 0x60,
+0x6C, 0x02, 0xA6, 0x02, 0x6C, 0x00, 0x60, 0x01, 0x5D, 0x5B, 0x60, 0x01, 0x92, 0x4C, 0x96, 0x00,
+0x4E, 0xC1, 0xD6, 0xAD, 0xFF, 0xFF, 0x81, 0xC5, 0xAE, 0x6B, 0x08, 0x32, 0x86, 0x21, 0xE8, 0x31,
+0x35, 0x9D, 0xFF, 0xF7, 0x00, 0xC6, 0xD4, 0x84, 0xEC, 0x3A, 0x89, 0x32, 0x05, 0x32, 0x24, 0x4A,
+0xEC, 0xAC, 0x12, 0xFF, 0x99, 0xC0, 0x2D, 0xDE, 0xBB, 0x00, 0xBA, 0x9D, 0xC0, 0x51, 0xF7, 0x9B,
+0xC8, 0x2A, 0x95, 0x23, 0x3B, 0xA7, 0x33, 0x06, 0x33, 0x0C, 0x9C, 0x4B, 0xDB, 0x82, 0xD8, 0x00,
+0xF8, 0x40, 0xF8, 0x5D, 0xE0, 0x12, 0x76, 0xC8, 0xCD, 0xEB, 0x14, 0xF6, 0xD0, 0xA4, 0x6E, 0x74,
+0x29, 0x33, 0xA5, 0x2A, 0x8A, 0x8C, 0xD2, 0xEE, 0xB1, 0xFE, 0x93, 0xC1, 0x37, 0xFF, 0x79, 0xFF,
+0xAE, 0xA9, 0xC2, 0x35, 0xFF, 0x51, 0xE6, 0x4C, 0xC5, 0x79, 0xC3, 0x34, 0xFF, 0xED, 0xA4, 0xE5,
+0x39, 0x08, 0x32, 0x01, 0x5F, 0xC6, 0x4C, 0x5B, 0x96, 0xA5, 0xD7, 0xAD, 0xEB, 0x52, 0xC7, 0x29,
+0x65, 0x21, 0xC7, 0x31, 0xBA, 0x44, 0xC3, 0x11, 0x84, 0x8B, 0x52, 0xA7, 0x39, 0xAB, 0x52, 0x6C,
+0xA1, 0xAE, 0xAB, 0x60, 0x6C, 0x03, 0x67, 0x00, 0x60, 0x00, 0x67, 0x00, 0x6C, 0x05, 0xBF, 0x00,
+0x6C, 0x67, 0x6C, 0x01, 0x60, 0xC0, 0x49, 0x4A, 0xAE, 0x6C, 0x60, 0x65, 0x00, 0x60, 0x79, 0x65,
+0x4C, 0x95, 0x41, 0xC3, 0x50, 0x8C, 0x34, 0xA5, 0xD2, 0x9C, 0x6E, 0x6B, 0xBF, 0x50, 0x7B, 0x53,
+0x6C, 0x00, 0x60, 0x00, 0x6C, 0x6F, 0x00, 0x6C, 0x67, 0x6C, 0x02, 0x67, 0x02, 0x6C, 0x00, 0x60,
+0x06, 0x9A, 0x51, 0xAB, 0x49, 0x00, 0xC1, 0xB6, 0xB5, 0xFF, 0xFF, 0x9A, 0xA6, 0xC0, 0x34, 0x9D,
+0x42, 0xC3, 0x46, 0x19, 0xCC, 0x4A, 0x15, 0x95, 0x7F, 0xDF, 0xA9, 0xC6, 0xAF, 0x53, 0xC5, 0x21,
+0x04, 0x42, 0x6B, 0x9C, 0x91, 0xEE, 0xD1, 0xFE, 0x6F, 0xEE, 0xAF, 0xC0, 0xF2, 0xF6, 0xA1, 0xCC,
+0x2E, 0xEE, 0xAB, 0xDD, 0x2C, 0xE6, 0x50, 0xF7, 0x8E, 0xCE, 0x06, 0x64, 0x87, 0x3B, 0xE6, 0x32,
+0xEB, 0x9B, 0x2A, 0xDB, 0x62, 0xD8, 0x00, 0xF8, 0x40, 0xF8, 0x5D, 0xE0, 0x12, 0x76, 0x48, 0xC0,
+0xF4, 0xED, 0x6A, 0xC1, 0x8E, 0x7C, 0x08, 0x3B, 0xA5, 0xC4, 0xAB, 0x94, 0xB2, 0xEE, 0xB2, 0xFE,
+0xF5, 0xFE, 0xBB, 0xFF, 0xAB, 0x00, 0xC0, 0xFC, 0xFF, 0xA0, 0xC3, 0xF5, 0xF6, 0x8E, 0xCD, 0xEB,
+0xBC, 0x12, 0xF7, 0x83, 0xC1, 0x26, 0x42, 0x28, 0x3A, 0x91, 0x00, 0x91, 0x77, 0xC6, 0x9E, 0xE7,
+0xFF, 0xF7, 0xBA, 0xCE, 0x71, 0x84, 0x8A, 0x4A, 0xC7, 0x31, 0x45, 0x29, 0xBF, 0xC4, 0x72, 0x94,
+0x4E, 0x6B, 0xA7, 0x31, 0xAB, 0x52, 0x09, 0x42, 0x5B, 0x60, 0x67, 0x60, 0x67, 0x00, 0xAE, 0xBA,
+0x74, 0x00, 0x6C, 0x67, 0x00, 0x6C, 0x00, 0x67, 0x00, 0x6C, 0x01, 0x6F, 0x60, 0x74, 0x7B, 0x74,
+0x6C, 0x01, 0x67, 0x95, 0x67, 0x6C, 0x67, 0x60, 0x02, 0x4C, 0x60, 0xC4, 0x8A, 0x52, 0x0B, 0x63,
+0xAD, 0x73, 0x70, 0x8C, 0xB2, 0x94, 0x91, 0x92, 0xC0, 0xB3, 0x9C, 0x00, 0x50, 0x74, 0x6C, 0x01,
+0x67, 0x6C, 0x6F, 0x00, 0x6C, 0x04, 0x67, 0x02, 0x6C, 0x00, 0x67, 0x06, 0x6C, 0x58, 0x01, 0xC8,
+0x28, 0x42, 0x18, 0xBE, 0x3C, 0xDF, 0x71, 0x84, 0x1C, 0xDF, 0x9E, 0xEF, 0x39, 0xBE, 0xD0, 0x6B,
+0xE8, 0x29, 0xBF, 0xC9, 0xB7, 0xA5, 0xDF, 0xE7, 0x51, 0x6C, 0x63, 0x11, 0x64, 0x4A, 0x31, 0xD6,
+0x54, 0xFF, 0x91, 0xEE, 0xD3, 0xEE, 0x98, 0xFF, 0xAF, 0xA0, 0xCB, 0x14, 0xFF, 0x2F, 0xE6, 0x49,
+0xC5, 0x2C, 0xDE, 0x50, 0xF7, 0x2A, 0x9D, 0xA6, 0x3B, 0xE6, 0x32, 0xEB, 0x9B, 0x2A, 0xDB, 0x62,
+0xD8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x12, 0x76, 0xC4, 0xAC, 0xEB, 0xF4, 0xED, 0xD0, 0xA4, 0x8E,
+0x7C, 0x29, 0x43, 0xA4, 0xC3, 0x8A, 0x8C, 0x30, 0xDE, 0xB3, 0xF6, 0x57, 0xFF, 0x5C, 0xC0, 0x7C,
+0xF7, 0x9B, 0xBE, 0xB8, 0xCC, 0x78, 0xFF, 0x72, 0xEE, 0x68, 0xAC, 0xAF, 0xEE, 0xF3, 0xEE, 0xCC,
+0x73, 0xE7, 0x31, 0x65, 0x21, 0x28, 0x3A, 0xC7, 0x31, 0x4C, 0x5B, 0x5D, 0xE7, 0xFF, 0xFF, 0x00,
+0xC5, 0x5C, 0xE7, 0x76, 0xAD, 0x8E, 0x73, 0x6A, 0x52, 0xC7, 0x39, 0x31, 0x8C, 0x58, 0x73, 0x43,
+0xC0, 0x08, 0x42, 0x96, 0x67, 0xAE, 0x00, 0x74, 0x67, 0x00, 0x6C, 0x03, 0x67, 0x6C, 0x00, 0x67,
+0x01, 0x6C, 0x00, 0xBA, 0x67, 0x6C, 0x7B, 0x74, 0x6F, 0x6C, 0x01, 0x60, 0x67, 0x6C, 0x67, 0x60,
+0x01, 0xAE, 0x74, 0xC1, 0x6D, 0x6B, 0x71, 0x8C, 0x00, 0xC4, 0x8D, 0x73, 0x0B, 0x63, 0x4C, 0x6B,
+0xAE, 0x73, 0xF4, 0x9C, 0x00, 0x4F, 0xC0, 0xCC, 0x5A, 0x4C, 0x44, 0x60, 0x6F, 0x67, 0x6C, 0x07,
+0x67, 0x02, 0x6C, 0x00, 0x67, 0x01, 0x6C, 0x00, 0x67, 0x02, 0x99, 0x00, 0x91, 0xC1, 0x49, 0x42,
+0xBA, 0xD6, 0x9E, 0xC3, 0x48, 0x3A, 0x2C, 0x5B, 0xDB, 0xCE, 0xFF, 0xF7, 0x96, 0xC2, 0xBB, 0xC6,
+0x39, 0xB6, 0xBF, 0xE7, 0xA6, 0xC3, 0xAE, 0x5B, 0x63, 0x21, 0x27, 0x6B, 0xB3, 0xE6, 0x68, 0xAF,
+0xC0, 0xDA, 0xFF, 0x5C, 0xAB, 0xA8, 0xCB, 0x98, 0xFF, 0x34, 0xFF, 0xCD, 0xD5, 0x08, 0xBD, 0xEE,
+0xF6, 0x0C, 0xBE, 0xC7, 0x43, 0x06, 0x33, 0x0C, 0xA4, 0x2A, 0xDB, 0x62, 0xD8, 0x00, 0xF8, 0xAE,
+0x5D, 0xE0, 0x12, 0xC0, 0x82, 0xE0, 0x7C, 0xC0, 0xF4, 0xED, 0x6A, 0xC8, 0x8E, 0x7C, 0x08, 0x43,
+0x48, 0x53, 0xEC, 0x9C, 0x92, 0xE6, 0xF4, 0xFE, 0x78, 0xFF, 0xDD, 0xFF, 0x7D, 0xEF, 0xAF, 0x00,
+0xCC, 0x9C, 0xFF, 0xDA, 0xFF, 0xD4, 0xF6, 0xA8, 0xAC, 0x8E, 0xEE, 0x33, 0xF7, 0x72, 0xAD, 0xE7,
+0x39, 0xAA, 0x52, 0x34, 0x9D, 0xD6, 0xB5, 0x79, 0xC6, 0xDF, 0xF7, 0x90, 0xC1, 0x3C, 0xDF, 0xFF,
+0xFF, 0x00, 0xC2, 0x7D, 0xEF, 0x59, 0xCE, 0x0C, 0x6B, 0xAF, 0x95, 0xC1, 0x66, 0x29, 0x6A, 0x4A,
+0x5B, 0x9A, 0xBF, 0xAE, 0x00, 0xBE, 0x67, 0x00, 0x60, 0x01, 0x67, 0x00, 0x6C, 0x6F, 0x6C, 0x00,
+0x67, 0x01, 0x6C, 0x02, 0x6F, 0x74, 0x6C, 0x01, 0x74, 0x6C, 0x6F, 0x00, 0x6C, 0x67, 0x60, 0x00,
+0x6C, 0xC4, 0xEF, 0x7B, 0xF3, 0x9C, 0x34, 0xA5, 0x30, 0x84, 0x6D, 0x6B, 0xBE, 0xC0, 0xCF, 0x7B,
+0x71, 0xAB, 0xC0, 0x4D, 0x6B, 0x40, 0x58, 0x53, 0x58, 0x67, 0x60, 0xAF, 0x05, 0x67, 0x6C, 0x00,
+0x67, 0x02, 0x6C, 0x00, 0x60, 0x67, 0x6C, 0x02, 0x67, 0x60, 0x58, 0x67, 0x99, 0xC4, 0x86, 0x29,
+0xE7, 0x39, 0x59, 0xC6, 0x1C, 0xDF, 0xEF, 0x73, 0x5D, 0xC3, 0x6D, 0x63, 0xAF, 0x6B, 0x18, 0xB6,
+0xFF, 0xF7, 0x00, 0xC7, 0x1D, 0xD7, 0x51, 0x74, 0x69, 0x3A, 0xA3, 0x29, 0x2A, 0x8C, 0x34, 0xFF,
+0x92, 0xEE, 0x37, 0xFF, 0x63, 0xC1, 0x9E, 0xF7, 0xFF, 0xFF, 0xA9, 0xC0, 0x79, 0xF7, 0xB8, 0xC9,
+0xD2, 0xF6, 0x08, 0xC5, 0x6C, 0xF6, 0x4C, 0xD6, 0x08, 0x54, 0x27, 0x3B, 0x2C, 0xA4, 0x2A, 0xDB,
+0x62, 0xD8, 0x00, 0xF8, 0x62, 0x5D, 0xE0, 0x12, 0xCC, 0x82, 0xE0, 0xCD, 0xEB, 0xF4, 0xED, 0xD0,
+0xA4, 0x6E, 0x7C, 0xE7, 0x42, 0x68, 0x5B, 0x6E, 0xAD, 0x14, 0xF7, 0x55, 0xFF, 0x57, 0xFF, 0xDC,
+0xFF, 0xDE, 0xFF, 0x82, 0xBE, 0xB8, 0xC7, 0x99, 0xFF, 0x51, 0xE6, 0xC8, 0xB4, 0xCF, 0xEE, 0xB4,
+0xFF, 0xD3, 0xBD, 0xAA, 0x4A, 0x50, 0x84, 0x72, 0xC0, 0xDE, 0xF7, 0xAF, 0x71, 0xC1, 0x9D, 0xEF,
+0x1B, 0xDF, 0x7A, 0x4E, 0x71, 0xC6, 0xFB, 0xE6, 0x28, 0x4A, 0x45, 0x31, 0xE7, 0x41, 0x66, 0x31,
+0x8A, 0x52, 0x08, 0x42, 0xA6, 0xAF, 0x00, 0x5B, 0x67, 0x6C, 0x67, 0x60, 0x96, 0x00, 0x5B, 0x67,
+0x00, 0x6F, 0x6C, 0x01, 0x67, 0x00, 0x6C, 0x03, 0x74, 0x6C, 0x67, 0x6C, 0x7B, 0x74, 0x02, 0x6C,
+0x60, 0x00, 0x74, 0xC1, 0x2D, 0x63, 0x8E, 0x73, 0xAE, 0xC1, 0xEF, 0x7B, 0xB2, 0x94, 0x41, 0xC0,
+0x30, 0x84, 0x44, 0x6C, 0x5B, 0x9A, 0x74, 0x40, 0x6F, 0x6C, 0x04, 0x6F, 0x00, 0x6C, 0x67, 0x6C,
+0x00, 0x67, 0x02, 0x6C, 0x00, 0x60, 0x00, 0x67, 0x6C, 0x00, 0x67, 0x60, 0x00, 0x4C, 0x58, 0x00,
+0x51, 0x96, 0xC7, 0x30, 0x7C, 0xB2, 0x8C, 0x0B, 0x53, 0x8E, 0x63, 0x48, 0x3A, 0x24, 0x11, 0xEB,
+0x4A, 0xF0, 0x6B, 0x91, 0xC8, 0xAB, 0x42, 0x66, 0x19, 0x28, 0x32, 0xC4, 0x31, 0x2A, 0x94, 0x75,
+0xFF, 0xD3, 0xF6, 0x58, 0xFF, 0xFE, 0xFF, 0x93, 0x69, 0xBE, 0xC7, 0xDC, 0xFF, 0x57, 0xF7, 0xD2,
+0xFE, 0xE8, 0xC4, 0x2B, 0xEE, 0x0B, 0xCE, 0x08, 0x54, 0x27, 0x3B, 0x75, 0xC2, 0x2A, 0xDB, 0x62,
+0xD8, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x82, 0xE0, 0xCD, 0xEB, 0x14, 0xF6, 0xD0, 0xA4, 0x4D, 0x7C,
+0x28, 0x4B, 0xA4, 0xC1, 0x8A, 0x8C, 0x91, 0xDE, 0x46, 0xC2, 0x56, 0xFF, 0xDA, 0xFF, 0xFD, 0xFF,
+0x91, 0xA5, 0xB9, 0xC8, 0x36, 0xFF, 0xEE, 0xD5, 0x8B, 0xCD, 0x30, 0xFF, 0x74, 0xFF, 0x30, 0xA5,
+0x2B, 0x5B, 0xAD, 0x6B, 0xD2, 0x8C, 0xA5, 0xC4, 0x95, 0xA5, 0x5C, 0xDF, 0x78, 0xC6, 0x0F, 0x74,
+0x8D, 0x6B, 0xA5, 0xC0, 0xCE, 0x7B, 0x91, 0xC4, 0xE3, 0x20, 0x07, 0x42, 0xAA, 0x5A, 0x66, 0x29,
+0x6A, 0x52, 0x60, 0xA6, 0xAF, 0x00, 0x5B, 0x67, 0x6C, 0x01, 0x67, 0x00, 0x60, 0x01, 0x6C, 0x04,
+0x67, 0x02, 0x6C, 0x40, 0x7B, 0x6C, 0x00, 0xBE, 0x00, 0x6C, 0x00, 0xBA, 0x6C, 0x60, 0x67, 0xC0,
+0x69, 0x4A, 0x00, 0xC3, 0xCB, 0x5A, 0x2C, 0x63, 0xEF, 0x7B, 0xB2, 0x94, 0x45, 0xC2, 0xEB, 0x5A,
+0x28, 0x42, 0xA7, 0x31, 0x58, 0x5B, 0x74, 0x67, 0x90, 0x67, 0x7B, 0x6C, 0x00, 0x67, 0x6C, 0x6F,
+0x00, 0x6C, 0x60, 0x6C, 0x00, 0x67, 0x02, 0x6C, 0x00, 0x58, 0x60, 0x67, 0x6C, 0x00, 0x67, 0x60,
+0x58, 0x01, 0x44, 0xC0, 0x08, 0x3A, 0x95, 0xC3, 0xAA, 0x4A, 0x07, 0x32, 0x44, 0x19, 0x2C, 0x53,
+0x5F, 0xC4, 0xC6, 0x29, 0x08, 0x2A, 0x65, 0x19, 0xC7, 0x21, 0x66, 0x19, 0xA1, 0xC3, 0x8A, 0x42,
+0xC4, 0x31, 0x47, 0x73, 0xF3, 0xF6, 0xBA, 0xC2, 0x57, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x9A, 0x71,
+0xCB, 0xFC, 0xFF, 0x36, 0xF7, 0xB1, 0xEE, 0x08, 0xC5, 0x4B, 0xF6, 0xCA, 0xC5, 0xE7, 0x53, 0xE6,
+0x32, 0x0C, 0xA4, 0x09, 0xD3, 0x41, 0xD8, 0x00, 0xF8, 0xE0, 0x14, 0x76, 0xCD, 0xED, 0xF3, 0x15,
+0xF6, 0xD0, 0xA4, 0x4D, 0x74, 0xA9, 0x53, 0x63, 0x32, 0x04, 0x53, 0x4C, 0xAD, 0xD2, 0xEE, 0x76,
+0xFF, 0xB8, 0xFF, 0xBA, 0xFF, 0xFB, 0xFF, 0x99, 0xFF, 0xA4, 0xA4, 0xC5, 0x50, 0xE6, 0xD1, 0xEE,
+0x73, 0xFF, 0xD2, 0xE6, 0xCB, 0x73, 0x4C, 0x5B, 0xA5, 0x77, 0x90, 0xC3, 0x4F, 0x7C, 0x57, 0xBE,
+0x0E, 0x74, 0xA5, 0x29, 0xA6, 0xBF, 0xC0, 0x44, 0x21, 0x91, 0xA6, 0xC2, 0x2C, 0x6B, 0xCA, 0x5A,
+0x25, 0x29, 0x7B, 0x58, 0x00, 0x67, 0xAE, 0x00, 0xBA, 0x6C, 0x6F, 0xAE, 0x00, 0x6C, 0x00, 0xA5,
+0x5B, 0x6C, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x67, 0x60, 0x5B, 0x60, 0x6F, 0xC0, 0x6A, 0x52, 0x9A,
+0x6C, 0x67, 0x6F, 0x6C, 0x60, 0x00, 0x6C, 0x00, 0x60, 0x6C, 0x40, 0xC1, 0xF0, 0x7B, 0xD3, 0x9C,
+0x6D, 0xC2, 0x6D, 0x6B, 0xAA, 0x52, 0x28, 0x42, 0x4C, 0x00, 0x60, 0x6C, 0x00, 0xC0, 0x8A, 0x52,
+0xAF, 0x7B, 0x6F, 0x5B, 0x6C, 0x67, 0x00, 0x6C, 0x6F, 0x74, 0x6C, 0x60, 0x6C, 0x00, 0x67, 0x02,
+0x6C, 0x00, 0x58, 0x5B, 0x67, 0x6C, 0x00, 0x67, 0x5B, 0x58, 0x60, 0x6C, 0xC1, 0x86, 0x29, 0xC7,
+0x31, 0x4E, 0x4A, 0x81, 0xBE, 0xC1, 0xAE, 0x63, 0x2B, 0x53, 0x96, 0x00, 0xCB, 0xEF, 0x6B, 0x38,
+0xB6, 0x71, 0x7C, 0x86, 0x21, 0x49, 0x3A, 0x63, 0x21, 0xA4, 0x5A, 0x92, 0xE6, 0x13, 0xFF, 0x97,
+0xFF, 0xDB, 0xFF, 0xFD, 0xFF, 0xAB, 0xC0, 0x7B, 0xEF, 0xBC, 0xCA, 0x35, 0xF7, 0xD1, 0xF6, 0xAA,
+0xD5, 0xEE, 0xFE, 0xCB, 0xBD, 0xC7, 0x4B, 0xC5, 0x2A, 0xCB, 0x9B, 0xE9, 0xCA, 0x41, 0xD8, 0x00,
+0xF8, 0xE0, 0x14, 0xC5, 0x61, 0xD8, 0xEE, 0xF3, 0xD3, 0xE5, 0xAF, 0x9C, 0xAE, 0x7C, 0x48, 0x43,
+0xA4, 0xB0, 0xC2, 0xC7, 0x7B, 0x0F, 0xCE, 0x55, 0xF7, 0x00, 0xC0, 0xB7, 0xFF, 0xAF, 0x00, 0x5E,
+0xA4, 0x00, 0xC4, 0xF3, 0xF6, 0x6D, 0xBD, 0xC9, 0x83, 0x83, 0x29, 0x85, 0x21, 0xAE, 0xBF, 0xC1,
+0x27, 0x32, 0xA9, 0x42, 0x68, 0xC0, 0x8C, 0x5B, 0xBA, 0xC3, 0xEA, 0x4A, 0x68, 0x42, 0x07, 0x3A,
+0x85, 0x29, 0x00, 0xC0, 0xAE, 0x73, 0x91, 0xC0, 0xA7, 0x31, 0x6C, 0x91, 0x00, 0xBF, 0x58, 0x67,
+0xA5, 0xAE, 0xC0, 0x4A, 0x4A, 0x6C, 0x60, 0x6C, 0x67, 0x60, 0xC0, 0x6A, 0x4A, 0x6C, 0x5B, 0x60,
+0x58, 0x00, 0x67, 0x00, 0x40, 0x00, 0x6C, 0x5B, 0x60, 0x6C, 0x01, 0x60, 0x67, 0x01, 0xBE, 0x67,
+0x91, 0xC2, 0xCB, 0x5A, 0x92, 0x94, 0xF4, 0xA4, 0x68, 0xC1, 0x8E, 0x73, 0x8A, 0x52, 0x60, 0x65,
+0x00, 0x60, 0x00, 0x5B, 0x6F, 0xC2, 0xAB, 0x5A, 0xEC, 0x5A, 0x8B, 0x52, 0x6C, 0x91, 0x6F, 0x6C,
+0x67, 0x00, 0x60, 0x58, 0x5B, 0x60, 0x67, 0x00, 0x6C, 0x67, 0x60, 0x00, 0x67, 0x6C, 0x60, 0x01,
+0x58, 0x53, 0x58, 0x6C, 0x7B, 0x58, 0x60, 0x67, 0xC0, 0xA6, 0x29, 0x4E, 0xC2, 0x71, 0x84, 0xDA,
+0xCE, 0x1B, 0xCF, 0xA5, 0xC0, 0x9D, 0xDF, 0x00, 0xA6, 0xC1, 0xDE, 0xE7, 0xFF, 0xF7, 0x9A, 0xC4,
+0xB6, 0xA5, 0x0C, 0x4B, 0x64, 0x19, 0x03, 0x42, 0x0D, 0xAD, 0x72, 0xC2, 0x34, 0xFF, 0x77, 0xFF,
+0xFA, 0xFF, 0xAB, 0xC0, 0x99, 0xFF, 0xA8, 0xC1, 0x53, 0xF7, 0xD0, 0xEE, 0xAD, 0xC7, 0x6D, 0xDE,
+0x4A, 0x9D, 0x25, 0x33, 0x07, 0x3B, 0x0C, 0xA4, 0x09, 0xD3, 0x62, 0xE0, 0x00, 0xF8, 0x9A, 0xBE,
+0x5D, 0xE0, 0x11, 0xCA, 0x61, 0xD8, 0x0E, 0xF4, 0xF4, 0xED, 0xAF, 0x9C, 0x8E, 0x7C, 0x89, 0x4B,
+0x0A, 0x5C, 0xA4, 0x3A, 0x42, 0x42, 0xE8, 0x83, 0xF0, 0xC5, 0x5E, 0xC0, 0xB7, 0xFF, 0xA5, 0x00,
+0xAE, 0xA5, 0xC4, 0x92, 0xE6, 0xCC, 0xAC, 0xA5, 0x62, 0x62, 0x31, 0xE5, 0x31, 0x9B, 0x95, 0x01,
+0xAF, 0x44, 0xAE, 0xC0, 0x88, 0x3A, 0xBF, 0xC0, 0x4C, 0x5B, 0x00, 0xC4, 0x89, 0x4A, 0xE7, 0x39,
+0xAD, 0x73, 0x2C, 0x63, 0xA7, 0x31, 0x7B, 0x6C, 0x00, 0xBE, 0x92, 0xBE, 0x6C, 0x44, 0xC0, 0x08,
+0x42, 0x01, 0x74, 0x6C, 0x60, 0x6F, 0x7B, 0x67, 0x6C, 0x01, 0x74, 0x6C, 0xC0, 0x6A, 0x4A, 0xBA,
+0x40, 0x7B, 0x74, 0x6C, 0x00, 0x67, 0x00, 0x7B, 0x00, 0x6C, 0x01, 0xA1, 0x7B, 0xC0, 0x4D, 0x6B,
+0xAB, 0xC0, 0xCC, 0x5A, 0x74, 0x58, 0x4C, 0x00, 0x51, 0x60, 0x6C, 0x5B, 0x00, 0x6C, 0x00, 0x67,
+0x6C, 0x74, 0x6F, 0x6C, 0x00, 0x7B, 0x74, 0x6C, 0x60, 0x67, 0x6C, 0x6F, 0x6C, 0x00, 0x67, 0x60,
+0x01, 0x6C, 0x74, 0x7B, 0x74, 0x67, 0x60, 0x5B, 0x60, 0xC0, 0x87, 0x31, 0xAE, 0xBF, 0x99, 0x42,
+0xC0, 0x54, 0x9D, 0x48, 0xC0, 0xFE, 0xE7, 0xBA, 0xAB, 0xC0, 0x5C, 0xD7, 0x95, 0xC0, 0xBE, 0xE7,
+0x6B, 0x6E, 0xC6, 0xFB, 0xCE, 0x4D, 0x53, 0xA5, 0x21, 0x42, 0x21, 0x67, 0x73, 0x30, 0xD6, 0x74,
+0xFF, 0xA6, 0x9B, 0xC0, 0xF9, 0xFF, 0x76, 0xAC, 0xA9, 0xC6, 0x51, 0xF7, 0xCF, 0xDE, 0x8B, 0xAD,
+0xC6, 0x5B, 0x46, 0x2B, 0x27, 0x3B, 0x2C, 0xA4, 0x45, 0xC0, 0x62, 0xE0, 0x5D, 0x9A, 0xBE, 0x5D,
+0xE0, 0x11, 0xCD, 0x61, 0xD8, 0x2E, 0xFC, 0x14, 0xEE, 0xCF, 0xA4, 0x8E, 0x7C, 0x0C, 0x5C, 0x8E,
+0x6C, 0xC6, 0x3A, 0x44, 0x3A, 0xC5, 0x5A, 0x47, 0x73, 0x6E, 0xB5, 0x11, 0xCE, 0xD3, 0xE6, 0xA6,
+0xC5, 0x51, 0xDE, 0xAF, 0xC5, 0x6B, 0x9C, 0x07, 0x6B, 0x05, 0x42, 0xA5, 0x31, 0x9F, 0xAE, 0x02,
+0x41, 0x00, 0xA6, 0x70, 0x7C, 0xC0, 0x27, 0x32, 0xA6, 0xC0, 0x65, 0x21, 0x91, 0xC0, 0x4C, 0x63,
+0xAB, 0xC1, 0x86, 0x29, 0x49, 0x4A, 0x6C, 0x00, 0x74, 0x92, 0x6F, 0x6C, 0xA1, 0x67, 0x01, 0x74,
+0x6C, 0x91, 0x5B, 0x74, 0x60, 0x00, 0x67, 0x6C, 0x74, 0x67, 0x6C, 0x00, 0x74, 0x40, 0x74, 0x67,
+0x60, 0x5B, 0x00, 0xC0, 0x4A, 0x4A, 0x00, 0x67, 0x00, 0x7B, 0x67, 0x91, 0x67, 0x74, 0x53, 0xA5,
+0x60, 0xAE, 0x51, 0x58, 0x74, 0x6C, 0x00, 0x74, 0x7B, 0x6F, 0x67, 0x00, 0x74, 0x60, 0x5B, 0x60,
+0x6C, 0x00, 0x60, 0x5B, 0x00, 0x58, 0x5B, 0x60, 0x02, 0x67, 0x6C, 0x60, 0x67, 0x6C, 0x00, 0x60,
+0x58, 0x01, 0x5B, 0x58, 0x00, 0x80, 0xC6, 0xE7, 0x31, 0x8D, 0x5B, 0x71, 0x7C, 0x0E, 0x6C, 0x4F,
+0x74, 0xCD, 0x63, 0x88, 0x3A, 0xAB, 0xC1, 0xAE, 0x63, 0x0F, 0x6C, 0xBF, 0xC0, 0x6D, 0x5B, 0x81,
+0xC5, 0x48, 0x2A, 0x42, 0x19, 0xE3, 0x39, 0xCB, 0xA4, 0x54, 0xF7, 0x94, 0xFF, 0x00, 0x4A, 0xA9,
+0xC0, 0xB5, 0xFF, 0xAE, 0xC6, 0xD0, 0xD6, 0x8B, 0xA5, 0x06, 0x64, 0xA2, 0x2A, 0x67, 0x2B, 0x47,
+0x3B, 0x2D, 0xAC, 0x45, 0xC1, 0x62, 0xE0, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x11, 0xCD, 0x61,
+0xD8, 0x4F, 0xFC, 0x35, 0xF6, 0xD0, 0xA4, 0x8F, 0x7C, 0x2D, 0x64, 0xD0, 0x74, 0x2D, 0x6C, 0xAB,
+0x63, 0xC7, 0x52, 0xA2, 0x39, 0x43, 0x4A, 0x26, 0x6B, 0xC9, 0x83, 0xA6, 0xC1, 0x06, 0x6B, 0x23,
+0x52, 0x64, 0xC1, 0xC4, 0x39, 0x07, 0x42, 0x9F, 0x85, 0x00, 0xBE, 0xAE, 0xAB, 0x95, 0x00, 0x50,
+0x55, 0xA5, 0xB7, 0x95, 0x91, 0xA6, 0xC0, 0x6D, 0x6B, 0x41, 0xC0, 0x25, 0x21, 0x60, 0x00, 0xAB,
+0x00, 0x91, 0x60, 0x00, 0x7B, 0x74, 0x67, 0x00, 0xAE, 0x00, 0x67, 0x60, 0x6F, 0x67, 0x5B, 0x00,
+0x6C, 0x74, 0x6C, 0x60, 0x96, 0x67, 0x6C, 0x67, 0x60, 0x6C, 0x01, 0xBB, 0x6C, 0x67, 0x6F, 0xC0,
+0x8B, 0x52, 0x7B, 0x58, 0x00, 0x60, 0x91, 0x53, 0x6C, 0x00, 0x58, 0x51, 0xC0, 0x28, 0x42, 0x58,
+0x60, 0x6C, 0x6F, 0x6C, 0x5B, 0x53, 0x00, 0x58, 0x5B, 0x00, 0x60, 0x67, 0x00, 0x60, 0x58, 0x00,
+0x60, 0x6C, 0x00, 0x67, 0x60, 0x67, 0x6C, 0x5B, 0x01, 0x58, 0x01, 0x5B, 0x60, 0x53, 0x58, 0xAF,
+0x95, 0xAE, 0xC0, 0xAA, 0x42, 0x78, 0xC3, 0xA4, 0x19, 0xE5, 0x21, 0x27, 0x2A, 0x84, 0x19, 0xBF,
+0xC0, 0x48, 0x32, 0xA5, 0x44, 0xC1, 0x85, 0x19, 0xAA, 0x3A, 0x95, 0xC5, 0xE5, 0x29, 0x62, 0x21,
+0x06, 0x63, 0xCF, 0xBD, 0x13, 0xE7, 0x74, 0xF7, 0xA7, 0xC5, 0xB3, 0xE6, 0x50, 0xD6, 0xAD, 0xBD,
+0x88, 0x84, 0xA5, 0x5B, 0x45, 0x3B, 0x86, 0xC5, 0x88, 0x2B, 0x68, 0x43, 0x4D, 0xAC, 0x09, 0xD3,
+0x62, 0xD8, 0x00, 0xF8, 0xE0, 0x14, 0xCB, 0x61, 0xD8, 0x4F, 0xFC, 0x35, 0xF6, 0xF0, 0xA4, 0x8F,
+0x84, 0xCC, 0x5B, 0x12, 0x85, 0xB4, 0x9D, 0xED, 0x6B, 0x87, 0x42, 0x25, 0x3A, 0xA3, 0x31, 0xBE,
+0x77, 0xBF, 0xA9, 0x77, 0xAF, 0xC1, 0x07, 0x3A, 0x09, 0x3A, 0x5A, 0xA9, 0x50, 0x53, 0x9E, 0x00,
+0x50, 0x02, 0x53, 0x4E, 0x00, 0xA6, 0x91, 0xC0, 0x4D, 0x63, 0xA1, 0xC1, 0x04, 0x21, 0xE8, 0x39,
+0x00, 0x5B, 0x60, 0x4C, 0x58, 0x00, 0x6C, 0xA6, 0x01, 0x6C, 0x01, 0x5B, 0xC0, 0x29, 0x4A, 0x6C,
+0x60, 0x00, 0x6C, 0x7B, 0x00, 0x60, 0x6C, 0x00, 0x67, 0x58, 0x67, 0x7B, 0xAE, 0x6F, 0x6C, 0x00,
+0x67, 0x40, 0xC0, 0xAB, 0x52, 0x7B, 0x67, 0x74, 0x6F, 0x6C, 0x60, 0x6C, 0x01, 0x65, 0x60, 0x6C,
+0x67, 0x5B, 0x00, 0x67, 0x6C, 0x67, 0x60, 0x67, 0x6C, 0x60, 0x5B, 0x67, 0x6F, 0x6C, 0x60, 0x6C,
+0x02, 0x67, 0x60, 0x58, 0xA6, 0x60, 0x01, 0x67, 0x00, 0x60, 0x5B, 0x58, 0x91, 0xBA, 0x58, 0xAE,
+0xC1, 0x8A, 0x42, 0x2B, 0x53, 0x81, 0xC0, 0x06, 0x22, 0xA5, 0xC1, 0x6B, 0x53, 0xCD, 0x5B, 0xA1,
+0x51, 0xC1, 0x06, 0x2A, 0xA5, 0x21, 0x7C, 0xC0, 0xA9, 0x32, 0x91, 0xB5, 0xC4, 0x83, 0x19, 0xE3,
+0x31, 0xE9, 0x73, 0xCC, 0x94, 0x0D, 0x9D, 0xA6, 0xC3, 0xE9, 0x83, 0x46, 0x6B, 0xE5, 0x5A, 0xA3,
+0x42, 0x8F, 0xC1, 0x46, 0x2B, 0x87, 0x2B, 0xAF, 0xC1, 0x89, 0x4B, 0x6D, 0xAC, 0x45, 0x6E, 0xC0,
+0x00, 0xF8, 0xE0, 0x14, 0xC4, 0x61, 0xD8, 0x2E, 0xFC, 0x15, 0xF6, 0xF0, 0xA4, 0xAF, 0x84, 0x4B,
+0xC1, 0xF1, 0x84, 0x94, 0x9D, 0x68, 0xC1, 0x06, 0x2A, 0x0A, 0x53, 0x91, 0x5C, 0xC0, 0xE6, 0x31,
+0xA6, 0x4E, 0xC0, 0x48, 0x42, 0xAF, 0xC0, 0x08, 0x32, 0x96, 0xBF, 0x94, 0x00, 0xBE, 0xAF, 0x00,
+0xAE, 0x01, 0x5A, 0x5F, 0x53, 0x92, 0xBA, 0x75, 0xC0, 0x6D, 0x6B, 0xAB, 0xC1, 0x46, 0x29, 0x09,
+0x42, 0x60, 0x67, 0x6C, 0x91, 0x67, 0x00, 0x6C, 0x67, 0x6C, 0x74, 0x67, 0x5B, 0x58, 0x91, 0x58,
+0x00, 0xA5, 0x58, 0x67, 0x01, 0x58, 0x00, 0x67, 0x6C, 0x58, 0x5B, 0x6C, 0x67, 0x91, 0x00, 0x67,
+0x01, 0x6C, 0x58, 0x53, 0x67, 0x00, 0x5B, 0x58, 0x53, 0x58, 0x60, 0x00, 0x58, 0x00, 0x5B, 0x60,
+0x5B, 0x60, 0x6C, 0x00, 0x60, 0x74, 0x60, 0x4C, 0xA6, 0x53, 0x60, 0x67, 0x00, 0x47, 0x01, 0x53,
+0x58, 0x00, 0x4C, 0x44, 0xA6, 0x44, 0x4C, 0x5B, 0x67, 0x60, 0x58, 0x4C, 0x58, 0x53, 0x99, 0x00,
+0x5F, 0xC0, 0x89, 0x3A, 0x95, 0xC4, 0xC5, 0x19, 0xA8, 0x32, 0xE9, 0x3A, 0x67, 0x32, 0x06, 0x2A,
+0x91, 0x70, 0x00, 0x75, 0x47, 0xC0, 0x06, 0x22, 0x00, 0x75, 0xC1, 0x26, 0x2A, 0x49, 0x53, 0x90,
+0xC1, 0x64, 0x3A, 0xC2, 0x29, 0xA5, 0xBF, 0xC4, 0x24, 0x32, 0x65, 0x2A, 0xA5, 0x22, 0x47, 0x23,
+0xC8, 0x2B, 0xAF, 0xC1, 0xA9, 0x4B, 0x8E, 0xB4, 0x45, 0x6E, 0xC0, 0x00, 0xF8, 0xE0, 0x14, 0xC2,
+0x61, 0xD8, 0x0E, 0xF4, 0xF4, 0xED, 0x6F, 0xC6, 0xD0, 0x8C, 0x0D, 0x6C, 0x4F, 0x74, 0x90, 0x7C,
+0x2B, 0x4B, 0x67, 0x32, 0xC9, 0x42, 0xBF, 0xC2, 0x8E, 0x5B, 0x6B, 0x3A, 0xE9, 0x29, 0x00, 0xBE,
+0x9D, 0x91, 0x5C, 0xC1, 0xAA, 0x3A, 0x28, 0x32, 0xBF, 0x00, 0xAE, 0x02, 0x6E, 0x5F, 0xBA, 0xA6,
+0x6C, 0x40, 0x6C, 0xC0, 0x6E, 0x73, 0x91, 0xC0, 0xA7, 0x31, 0x74, 0x92, 0x00, 0xBE, 0x67, 0x6C,
+0x00, 0x40, 0x6C, 0x6F, 0x00, 0x81, 0x60, 0x74, 0x6C, 0x4C, 0x44, 0xBA, 0xC0, 0x4A, 0x4A, 0xBE,
+0x60, 0x5B, 0x67, 0x91, 0x74, 0x40, 0x60, 0x53, 0x60, 0x74, 0x6F, 0xC0, 0xA8, 0x31, 0x7B, 0x00,
+0x53, 0xAF, 0xC0, 0x2A, 0x4A, 0x67, 0x53, 0x74, 0x6F, 0x74, 0x00, 0x58, 0xC0, 0x86, 0x31, 0x4C,
+0x74, 0x67, 0x40, 0x43, 0x6C, 0x53, 0x00, 0x5B, 0x60, 0x7B, 0x58, 0x00, 0x7B, 0x43, 0x67, 0x58,
+0x5B, 0x44, 0x5B, 0x74, 0x6C, 0x58, 0x4C, 0x53, 0x67, 0x6C, 0x60, 0x58, 0x03, 0x4C, 0x53, 0x00,
+0x44, 0x9A, 0xC0, 0x28, 0x32, 0x73, 0x9D, 0x91, 0xC1, 0xC9, 0x3A, 0x26, 0x2A, 0x46, 0x65, 0xC0,
+0xCD, 0x63, 0x91, 0xC3, 0x88, 0x42, 0x84, 0x19, 0xE8, 0x3A, 0x05, 0x1A, 0xBA, 0x46, 0xC4, 0xA9,
+0x3A, 0x6C, 0x4B, 0x68, 0x2A, 0xA4, 0x19, 0x25, 0x2A, 0xBA, 0xBF, 0x9B, 0x8A, 0xC2, 0xA7, 0x1A,
+0x68, 0x23, 0x2A, 0x2C, 0xB1, 0xC4, 0xCA, 0x53, 0xAE, 0xB4, 0x09, 0xD3, 0x61, 0xD8, 0x00, 0xF8,
+0xE0, 0x14, 0xC5, 0x41, 0xD8, 0xEE, 0xEB, 0xF4, 0xED, 0xF0, 0xA4, 0xF0, 0x8C, 0x2D, 0x6C, 0x96,
+0xA6, 0x96, 0xC1, 0xEB, 0x42, 0x07, 0x22, 0x5C, 0xC1, 0x8B, 0x3A, 0xE9, 0x29, 0xAF, 0x01, 0xBD,
+0xAE, 0xAE, 0x00, 0xB5, 0xAB, 0x73, 0xBA, 0x00, 0x6E, 0xA5, 0x9A, 0x6E, 0x62, 0x91, 0xC1, 0x49,
+0x42, 0x2C, 0x63, 0xA6, 0xC2, 0x10, 0x84, 0x4E, 0x6B, 0xA7, 0x39, 0x7B, 0x60, 0x00, 0xAF, 0xA6,
+0x6C, 0x67, 0x7B, 0x60, 0x01, 0x96, 0x43, 0xC1, 0x4D, 0x6B, 0x8E, 0x73, 0x6C, 0x5B, 0x6C, 0xC0,
+0x2D, 0x63, 0x44, 0xC0, 0x6A, 0x4A, 0xA5, 0xC0, 0xAB, 0x52, 0x40, 0xC0, 0xEC, 0x5A, 0x00, 0x6C,
+0x47, 0xC0, 0x29, 0x4A, 0x7C, 0xC0, 0xAF, 0x73, 0x67, 0x7C, 0xA6, 0x67, 0x40, 0x7C, 0x68, 0x67,
+0x64, 0xBA, 0xC0, 0x10, 0x84, 0xA6, 0x68, 0x5B, 0xC0, 0x6A, 0x4A, 0x64, 0xBF, 0xC0, 0x10, 0x84,
+0x91, 0xC1, 0xCC, 0x5A, 0x09, 0x42, 0xAE, 0xC0, 0xCB, 0x5A, 0x4B, 0xC0, 0x4A, 0x4A, 0x60, 0x54,
+0xC0, 0xCF, 0x7B, 0xAF, 0x5C, 0xC0, 0xE8, 0x39, 0x00, 0x54, 0x44, 0x6C, 0x44, 0x74, 0x4C, 0x60,
+0xC0, 0x8B, 0x52, 0x6C, 0xC2, 0x6E, 0x6B, 0xAB, 0x5A, 0x29, 0x42, 0x58, 0x02, 0x53, 0x00, 0x95,
+0x9A, 0xC1, 0x08, 0x32, 0x69, 0x3A, 0x7D, 0xA9, 0x00, 0xC2, 0xE5, 0x21, 0x67, 0x32, 0x2F, 0x6C,
+0x51, 0xC1, 0xEE, 0x63, 0xC9, 0x42, 0x49, 0xC0, 0x87, 0x32, 0x91, 0x00, 0xC3, 0xE6, 0x19, 0x8A,
+0x32, 0xEC, 0x3A, 0xE7, 0x19, 0x00, 0xBD, 0x7A, 0xA7, 0x9A, 0xC3, 0x48, 0x1A, 0xE9, 0x22, 0x89,
+0x23, 0x09, 0x2C, 0xBB, 0xC3, 0xCA, 0x53, 0xAE, 0xBC, 0x0A, 0xD3, 0x61, 0xD8, 0x5D, 0xE0, 0x14,
+0xC6, 0x41, 0xD8, 0x4F, 0xF4, 0x15, 0xEE, 0x10, 0xAD, 0xEF, 0x8C, 0x0C, 0x64, 0x6A, 0x4B, 0x00,
+0xC0, 0x6C, 0x53, 0x97, 0xC2, 0x8A, 0x32, 0xC8, 0x21, 0x4A, 0x32, 0x90, 0xA5, 0xAB, 0x66, 0x72,
+0x66, 0x6B, 0xC0, 0x8A, 0x3A, 0xA1, 0x71, 0x6E, 0xA6, 0xAF, 0xAE, 0x6E, 0x95, 0xBE, 0x00, 0x91,
+0xC0, 0x68, 0x42, 0x53, 0xC0, 0xA2, 0x10, 0x54, 0xC1, 0x4D, 0x6B, 0x45, 0x29, 0x4F, 0xC1, 0xC7,
+0x39, 0x09, 0x42, 0xA5, 0xAE, 0x67, 0x6C, 0x60, 0x6C, 0x00, 0x5B, 0x4C, 0x67, 0xC2, 0xF0, 0x7B,
+0xB3, 0x9C, 0x6A, 0x4A, 0x60, 0x00, 0xC4, 0x31, 0x84, 0xD3, 0x9C, 0xE8, 0x39, 0x8E, 0x73, 0xEF,
+0x7B, 0x60, 0xC0, 0x30, 0x84, 0xBF, 0x60, 0xC1, 0xA7, 0x31, 0x8A, 0x52, 0x54, 0x4C, 0xC0, 0xC7,
+0x39, 0x63, 0xC3, 0x72, 0x8C, 0xCB, 0x5A, 0x4D, 0x6B, 0x93, 0x94, 0x40, 0x67, 0xC1, 0x72, 0x94,
+0x6E, 0x73, 0x48, 0xC1, 0xAF, 0x73, 0x52, 0x8C, 0x4F, 0xC0, 0xA7, 0x31, 0x7B, 0xC1, 0x4D, 0x6B,
+0x92, 0x94, 0x48, 0x74, 0x6C, 0x5C, 0x54, 0xC0, 0xF3, 0x9C, 0x48, 0xAE, 0x45, 0xC0, 0xCF, 0x7B,
+0x45, 0x54, 0xC0, 0xE7, 0x39, 0xAB, 0x45, 0x64, 0x50, 0x6C, 0xC1, 0xEC, 0x5A, 0xA7, 0x31, 0x5C,
+0xC1, 0x71, 0x8C, 0x2D, 0x63, 0x78, 0xBE, 0xC0, 0x08, 0x42, 0x74, 0x58, 0x01, 0xBA, 0x67, 0x58,
+0x9A, 0x00, 0x73, 0xC0, 0xCA, 0x42, 0x90, 0xC1, 0xC5, 0x19, 0x47, 0x2A, 0x00, 0xA6, 0xC2, 0x22,
+0x09, 0xE9, 0x42, 0x2A, 0x4B, 0x46, 0x4A, 0x46, 0xC1, 0xA5, 0x19, 0x89, 0x3A, 0x7A, 0xC1, 0x87,
+0x19, 0xC7, 0x21, 0x99, 0xC0, 0x68, 0x32, 0x90, 0x93, 0xAE, 0xC3, 0x48, 0x1A, 0xA9, 0x22, 0x89,
+0x2B, 0x2A, 0x34, 0xBF, 0xC3, 0xC9, 0x53, 0xCF, 0xC4, 0xC9, 0xD2, 0x61, 0xD8, 0x5D, 0x00, 0xAE,
+0x5D, 0xE0, 0x11, 0x67, 0xC7, 0x70, 0xF4, 0x16, 0xEE, 0x10, 0xA5, 0xCF, 0x84, 0xEB, 0x5B, 0x8E,
+0x6C, 0xAB, 0x53, 0xE9, 0x3A, 0xB7, 0x00, 0xC1, 0x69, 0x3A, 0xC5, 0x29, 0xA5, 0xC1, 0xE5, 0x31,
+0x26, 0x3A, 0xAB, 0x6E, 0x7A, 0x6B, 0x4B, 0xC0, 0x8A, 0x42, 0x01, 0xAF, 0x42, 0x6B, 0x00, 0x73,
+0x5F, 0xBE, 0xC0, 0xE6, 0x29, 0xBA, 0xA6, 0xC1, 0x03, 0x19, 0xCB, 0x52, 0xA6, 0xC3, 0x04, 0x21,
+0x6A, 0x4A, 0xA7, 0x31, 0x09, 0x42, 0x60, 0x67, 0x60, 0xA6, 0x60, 0x00, 0x67, 0x00, 0x60, 0xC2,
+0x49, 0x4A, 0x11, 0x84, 0xF4, 0xA4, 0x70, 0xC0, 0xC7, 0x39, 0x5C, 0xC0, 0xB2, 0x94, 0x00, 0x60,
+0xC3, 0x8E, 0x73, 0xCF, 0x7B, 0x28, 0x42, 0xEF, 0x7B, 0x6D, 0xC1, 0xEB, 0x5A, 0x86, 0x31, 0x5C,
+0x6D, 0x71, 0x60, 0x74, 0x53, 0xC0, 0x31, 0x84, 0xBA, 0xC0, 0x6E, 0x6B, 0x60, 0xAF, 0xC2, 0x72,
+0x8C, 0xEC, 0x62, 0x08, 0x42, 0x50, 0x4C, 0x54, 0xC0, 0xC7, 0x39, 0x51, 0xC1, 0xAA, 0x52, 0x10,
+0x84, 0x60, 0x4C, 0x00, 0x60, 0xC1, 0x4D, 0x6B, 0x71, 0x8C, 0x65, 0xC0, 0x2C, 0x63, 0x71, 0x4D,
+0xC0, 0x6D, 0x6B, 0x59, 0xC0, 0x8A, 0x52, 0x65, 0x40, 0x71, 0x70, 0x74, 0x4C, 0x51, 0x5C, 0x61,
+0xC0, 0x24, 0x21, 0x61, 0x71, 0x74, 0x00, 0x51, 0x60, 0x00, 0xC1, 0xA7, 0x39, 0xE8, 0x39, 0xA6,
+0x00, 0xC1, 0x28, 0x3A, 0xAA, 0x4A, 0x95, 0xC0, 0x27, 0x32, 0x95, 0x91, 0xAF, 0xC1, 0x0A, 0x43,
+0xAC, 0x53, 0xBF, 0xC1, 0xC9, 0x3A, 0x26, 0x22, 0x42, 0xC0, 0x07, 0x22, 0xBA, 0xC0, 0xAA, 0x42,
+0x66, 0xC2, 0x66, 0x19, 0xE7, 0x29, 0x48, 0x2A, 0x72, 0xC0, 0x06, 0x22, 0xBF, 0x9A, 0xAF, 0xC7,
+0xC9, 0x22, 0x89, 0x23, 0xE9, 0x2B, 0x2A, 0x3C, 0xA9, 0x53, 0xAF, 0xC4, 0xC9, 0xD2, 0x61, 0xD8,
+0x5D, 0x00, 0xAE, 0x5D, 0xE0, 0x0E, 0x62, 0x5D, 0x00, 0x67, 0xC3, 0x70, 0xFC, 0x36, 0xEE, 0xF0,
+0xA4, 0x8E, 0x7C, 0x86, 0xC6, 0x52, 0x85, 0xED, 0x5B, 0xC8, 0x3A, 0x05, 0x2A, 0x62, 0x21, 0x65,
+0x4A, 0x48, 0x63, 0xBE, 0xBE, 0x81, 0x5D, 0xC2, 0xE4, 0x31, 0x26, 0x3A, 0x89, 0x42, 0x01, 0x5F,
+0xA6, 0x73, 0x7F, 0xA1, 0x9A, 0x00, 0xAD, 0xBE, 0x75, 0xA2, 0xC0, 0x07, 0x32, 0xBA, 0xC3, 0xF0,
+0x73, 0x4D, 0x63, 0x66, 0x29, 0xAB, 0x52, 0x4C, 0xC0, 0x09, 0x42, 0x60, 0x01, 0x5B, 0x74, 0x67,
+0x00, 0x6C, 0x60, 0x6C, 0xC6, 0xD0, 0x7B, 0xB3, 0x94, 0x31, 0x84, 0x49, 0x4A, 0xCF, 0x7B, 0xF3,
+0x9C, 0x92, 0x94, 0x60, 0xC1, 0x8E, 0x73, 0x10, 0x84, 0x74, 0x6C, 0x41, 0x40, 0x65, 0xC1, 0x6D,
+0x6B, 0x34, 0xA5, 0x45, 0x67, 0xC0, 0xA7, 0x31, 0x48, 0xC1, 0xF4, 0x9C, 0x93, 0x94, 0x60, 0xC1,
+0x87, 0x31, 0x29, 0x42, 0x4C, 0xC0, 0x72, 0x8C, 0x00, 0x4F, 0xC0, 0x2D, 0x63, 0x6C, 0x00, 0xC2,
+0xC7, 0x39, 0xAA, 0x52, 0x51, 0x8C, 0x65, 0xC1, 0xA6, 0x31, 0x08, 0x42, 0x95, 0x5C, 0x6D, 0x74,
+0xC1, 0x4D, 0x6B, 0xD3, 0x9C, 0x40, 0x00, 0x59, 0x5C, 0x74, 0x6D, 0x00, 0x40, 0x49, 0x4D, 0x4C,
+0x7D, 0x91, 0xC2, 0x8A, 0x52, 0xAE, 0x73, 0xEF, 0x7B, 0x74, 0x60, 0x7D, 0x51, 0x65, 0x4C, 0xAB,
+0x95, 0x99, 0xC0, 0xE7, 0x31, 0x4A, 0xC2, 0x07, 0x32, 0x23, 0x09, 0x47, 0x32, 0x9A, 0x00, 0xA5,
+0xC2, 0x2A, 0x4B, 0x88, 0x32, 0x84, 0x11, 0x72, 0xC4, 0x6C, 0x3B, 0x07, 0x12, 0x49, 0x22, 0xEB,
+0x3A, 0x6A, 0x32, 0x4B, 0x94, 0xAD, 0xA5, 0x00, 0x9A, 0x00, 0xC2, 0x45, 0x1A, 0x08, 0x23, 0x8A,
+0x23, 0xAD, 0xC1, 0x0A, 0x34, 0xA9, 0x4B, 0x6A, 0xC2, 0xA9, 0xD2, 0x61, 0xD8, 0x00, 0xF8, 0x00,
+0x62, 0x5D, 0xE0, 0x0E, 0x62, 0x5D, 0x00, 0xC3, 0x81, 0xD8, 0x91, 0xFC, 0x56, 0xEE, 0x10, 0xA5,
+0x43, 0x86, 0xC2, 0x31, 0x7D, 0xAC, 0x53, 0xC7, 0x42, 0xB4, 0xC3, 0x05, 0x5B, 0x0D, 0xA5, 0x14,
+0xE7, 0xB6, 0xFF, 0xA6, 0xC4, 0x14, 0xEF, 0xD0, 0xBD, 0xE9, 0x83, 0xC6, 0x52, 0x66, 0x42, 0x97,
+0x96, 0xAF, 0xBF, 0x00, 0x91, 0x96, 0x64, 0xC0, 0x89, 0x3A, 0x64, 0xC0, 0xCA, 0x42, 0x64, 0xC0,
+0xC6, 0x29, 0x96, 0xA5, 0xC4, 0x8E, 0x63, 0x0C, 0x5B, 0x29, 0x42, 0x2D, 0x63, 0x08, 0x42, 0xAB,
+0x95, 0x60, 0x67, 0x6C, 0x00, 0x67, 0x60, 0x00, 0x58, 0x67, 0xC1, 0x8F, 0x73, 0x11, 0x84, 0x54,
+0x49, 0x40, 0x54, 0x00, 0xC0, 0xC7, 0x39, 0x49, 0xC0, 0xEF, 0x7B, 0x51, 0xC1, 0xAE, 0x73, 0x30,
+0x84, 0x00, 0xC0, 0x2C, 0x63, 0x71, 0xC0, 0x92, 0x94, 0x96, 0x67, 0x58, 0xC8, 0x0C, 0x63, 0xB3,
+0x94, 0x52, 0x8C, 0x6A, 0x4A, 0x87, 0x31, 0x49, 0x4A, 0x8E, 0x73, 0x31, 0x84, 0xF4, 0x9C, 0x68,
+0x74, 0xC1, 0x25, 0x21, 0xE8, 0x39, 0xA5, 0xC0, 0xCB, 0x5A, 0x59, 0xC1, 0x08, 0x42, 0x86, 0x31,
+0x60, 0x4C, 0xC0, 0x69, 0x4A, 0x41, 0x79, 0xBF, 0xC2, 0xB2, 0x94, 0xCF, 0x7B, 0xEB, 0x5A, 0x5D,
+0x61, 0x5C, 0x68, 0xC0, 0x4D, 0x6B, 0x5C, 0x71, 0xC0, 0x8E, 0x73, 0x7D, 0x00, 0x4D, 0x54, 0x5D,
+0x5C, 0x4C, 0x51, 0x78, 0x7D, 0x60, 0x96, 0x91, 0x00, 0xAE, 0xC1, 0x49, 0x42, 0x92, 0x84, 0x95,
+0xC2, 0x2B, 0x4B, 0xA5, 0x21, 0x27, 0x2A, 0xBE, 0xC2, 0xA4, 0x19, 0xAC, 0x5B, 0x4F, 0x6C, 0x46,
+0xC3, 0x68, 0x2A, 0x0B, 0x33, 0x27, 0x0A, 0x8A, 0x2A, 0xB5, 0xC0, 0x84, 0x19, 0xB9, 0xC9, 0x24,
+0x32, 0xC6, 0x4A, 0x2B, 0x7C, 0xC9, 0x6B, 0x46, 0x5B, 0xC4, 0x42, 0xA4, 0x2A, 0xE5, 0x22, 0x69,
+0x23, 0x0B, 0x2C, 0xB5, 0xC4, 0x89, 0x4B, 0x8F, 0xC4, 0xA9, 0xD2, 0x61, 0xD8, 0x00, 0xF8, 0xE0,
+0x14, 0xCB, 0x81, 0xD8, 0x91, 0xFC, 0x56, 0xF6, 0x30, 0xAD, 0xAF, 0x84, 0xAB, 0x4B, 0x2D, 0x5C,
+0xE8, 0x42, 0x65, 0x3A, 0x4A, 0x8C, 0x91, 0xD6, 0x74, 0xFF, 0xA5, 0xC0, 0xB1, 0xE6, 0xBF, 0x50,
+0xAF, 0xC4, 0xD2, 0xE6, 0x6E, 0xAD, 0x89, 0x73, 0xE3, 0x31, 0x26, 0x32, 0x64, 0x91, 0x92, 0xC5,
+0x49, 0x32, 0x0C, 0x4B, 0x6D, 0x53, 0xAE, 0x5B, 0x4C, 0x53, 0x0F, 0x6C, 0xA5, 0xC3, 0x6D, 0x5B,
+0xAA, 0x42, 0xA6, 0x29, 0x6E, 0x63, 0xA5, 0xC2, 0x49, 0x4A, 0x4D, 0x6B, 0x08, 0x42, 0x00, 0x58,
+0x60, 0xAB, 0xAE, 0xC0, 0xC8, 0x39, 0x58, 0x60, 0x58, 0x60, 0xC1, 0x6A, 0x4A, 0xAF, 0x7B, 0xAF,
+0x95, 0xC1, 0xB3, 0x94, 0x10, 0x84, 0x64, 0x68, 0xC1, 0x49, 0x4A, 0xCF, 0x7B, 0x40, 0xC0, 0x29,
+0x42, 0x40, 0xC1, 0x8E, 0x73, 0xEF, 0x7B, 0x6D, 0xC2, 0x51, 0x8C, 0xAE, 0x73, 0xB3, 0x94, 0x60,
+0xC0, 0xCB, 0x5A, 0x68, 0xC0, 0xCF, 0x7B, 0x73, 0x40, 0xC3, 0x29, 0x42, 0x6A, 0x4A, 0x72, 0x8C,
+0x8B, 0x52, 0xAE, 0xC3, 0x31, 0x8C, 0x2D, 0x63, 0x46, 0x29, 0x86, 0x31, 0x4C, 0x7C, 0x60, 0xC2,
+0x49, 0x4A, 0xA7, 0x31, 0x28, 0x42, 0x91, 0xC1, 0x8A, 0x52, 0xF3, 0x9C, 0x48, 0xAE, 0x68, 0xC1,
+0xEB, 0x5A, 0x08, 0x42, 0x71, 0xC1, 0x0C, 0x63, 0x69, 0x4A, 0x59, 0x48, 0x60, 0xC0, 0xCF, 0x7B,
+0x71, 0x60, 0x40, 0x45, 0xC0, 0x4D, 0x6B, 0x48, 0x4C, 0x78, 0x60, 0x96, 0x4C, 0x00, 0x60, 0xC0,
+0xA7, 0x31, 0x4C, 0x58, 0xC6, 0x69, 0x42, 0x79, 0xC6, 0xBE, 0xE7, 0x99, 0xBE, 0x2B, 0x4B, 0xE6,
+0x21, 0x84, 0x19, 0x55, 0xC1, 0xD5, 0x9D, 0xFE, 0xEF, 0x81, 0xC9, 0xD1, 0x7C, 0x07, 0x12, 0x47,
+0x1A, 0x0A, 0x3B, 0x06, 0x2A, 0x41, 0x19, 0x27, 0x5B, 0x6F, 0xAD, 0xD4, 0xDE, 0x55, 0xF7, 0x95,
+0xCB, 0xD1, 0xDE, 0x0E, 0xBE, 0x68, 0x74, 0x03, 0x33, 0xC5, 0x22, 0x89, 0x2B, 0xC9, 0x33, 0x68,
+0x4B, 0x8E, 0xBC, 0xA8, 0xD2, 0x61, 0xD8, 0x00, 0xF8, 0xE0, 0x14, 0xC1, 0x81, 0xD8, 0x90, 0xFC,
+0x6E, 0xC2, 0x31, 0xAD, 0xCF, 0x84, 0xAB, 0x53, 0x81, 0xC5, 0x08, 0x4B, 0x0B, 0x7C, 0x31, 0xCE,
+0x74, 0xFF, 0xF1, 0xEE, 0xEE, 0xD5, 0xA6, 0x92, 0x56, 0xC3, 0x2F, 0xDE, 0xF1, 0xF6, 0xB5, 0xFF,
+0x92, 0xD6, 0x5A, 0xC1, 0x46, 0x3A, 0xEA, 0x42, 0xBF, 0xC1, 0x4C, 0x53, 0xCE, 0x63, 0x92, 0xC1,
+0xCA, 0x42, 0x69, 0x32, 0x91, 0x55, 0xC0, 0xA5, 0x21, 0xBF, 0xC6, 0x08, 0x32, 0x86, 0x21, 0x2D,
+0x5B, 0xCC, 0x52, 0xC8, 0x39, 0xCC, 0x5A, 0xC7, 0x39, 0xBF, 0x58, 0xBE, 0x00, 0x58, 0x60, 0xAF,
+0xBA, 0x60, 0xAB, 0xC1, 0x6A, 0x4A, 0x6E, 0x6B, 0x91, 0xC0, 0xCB, 0x5A, 0x6D, 0xC0, 0x2C, 0x63,
+0x5C, 0xC2, 0xF0, 0x7B, 0x69, 0x4A, 0xAF, 0x73, 0xBE, 0x40, 0x78, 0xC0, 0xEB, 0x5A, 0x7C, 0xC0,
+0xB3, 0x94, 0x6C, 0xC1, 0xAA, 0x52, 0x10, 0x84, 0x58, 0xC0, 0x0C, 0x63, 0x68, 0xC0, 0x6A, 0x4A,
+0x5C, 0xC1, 0x72, 0x8C, 0x49, 0x4A, 0x00, 0xC1, 0xF4, 0x9C, 0x6A, 0x52, 0x53, 0x64, 0x00, 0x74,
+0x58, 0xC0, 0x86, 0x31, 0x7C, 0xC0, 0xF0, 0x7B, 0x74, 0x91, 0xAE, 0x00, 0xC1, 0x8A, 0x52, 0x31,
+0x84, 0x4D, 0x00, 0xC0, 0x51, 0x8C, 0x64, 0x6C, 0xC0, 0x72, 0x8C, 0x79, 0xC0, 0xC7, 0x39, 0x64,
+0x6C, 0x71, 0xBF, 0x70, 0xC0, 0x08, 0x42, 0x70, 0x54, 0x7C, 0x75, 0x48, 0x60, 0x58, 0x60, 0x00,
+0x4C, 0x67, 0x44, 0x4C, 0x9A, 0xC2, 0x08, 0x3A, 0xFB, 0xD6, 0xFF, 0xF7, 0x9A, 0xC2, 0x5C, 0xD7,
+0x91, 0x7C, 0x07, 0x2A, 0x90, 0xC6, 0x2B, 0x4B, 0x94, 0x9D, 0xFE, 0xE7, 0x1B, 0xC7, 0x0A, 0x3B,
+0xA8, 0x2A, 0x46, 0x32, 0xA4, 0xC2, 0xC8, 0x73, 0x92, 0xD6, 0xD7, 0xFF, 0xA0, 0xC0, 0xF3, 0xF6,
+0xA9, 0xCB, 0x31, 0xF7, 0x71, 0xFF, 0xEF, 0xDE, 0x6B, 0x9D, 0xE8, 0x53, 0x06, 0x2B, 0xA8, 0x33,
+0x48, 0x43, 0x6E, 0xBC, 0xA8, 0xD2, 0x41, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D, 0x00, 0xC5,
+0x81, 0xD8, 0x70, 0xFC, 0x36, 0xEE, 0x30, 0xAD, 0xCF, 0x8C, 0x4B, 0x4B, 0x90, 0xC4, 0x8A, 0x63,
+0xD1, 0xBD, 0xB3, 0xE6, 0x30, 0xDE, 0x71, 0xE6, 0xAB, 0xC5, 0x77, 0xFF, 0xD5, 0xF6, 0x10, 0xDE,
+0x4C, 0xC5, 0x8B, 0xCD, 0x12, 0xFF, 0x5C, 0xC3, 0x72, 0xCE, 0x0C, 0x74, 0x0E, 0x6C, 0x6C, 0x5B,
+0x91, 0xAB, 0xC3, 0x28, 0x32, 0x45, 0x11, 0xA6, 0x19, 0x69, 0x3A, 0x00, 0xC2, 0xC6, 0x21, 0x07,
+0x32, 0x8A, 0x42, 0x91, 0xC1, 0xF0, 0x73, 0x4E, 0x63, 0x44, 0xC0, 0xAB, 0x5A, 0x44, 0xC0, 0xE8,
+0x39, 0x00, 0x67, 0x60, 0x58, 0xC0, 0x49, 0x4A, 0xAB, 0x74, 0x67, 0x60, 0x58, 0xC4, 0x8B, 0x52,
+0x29, 0x42, 0xC8, 0x39, 0x0C, 0x63, 0xE7, 0x39, 0x4C, 0x74, 0x4C, 0xC0, 0xAA, 0x52, 0xA6, 0x51,
+0x48, 0x60, 0xAE, 0x70, 0x74, 0x58, 0x74, 0x58, 0x7B, 0xC0, 0xCB, 0x5A, 0x44, 0xC0, 0xE8, 0x41,
+0x70, 0x60, 0x58, 0x70, 0x74, 0x58, 0x48, 0x00, 0x6C, 0x00, 0xC0, 0x87, 0x31, 0x74, 0xC0, 0xAB,
+0x52, 0x4C, 0x58, 0x4C, 0x51, 0x58, 0x4D, 0x74, 0x51, 0x4D, 0xC0, 0x4D, 0x6B, 0x64, 0xC0, 0x2D,
+0x63, 0x51, 0x60, 0x6C, 0xC0, 0x6D, 0x6B, 0xBF, 0x5C, 0xC0, 0xA7, 0x31, 0x7D, 0x70, 0xC0, 0xEF,
+0x7B, 0x91, 0x64, 0xC0, 0xEC, 0x5A, 0x74, 0x44, 0x4C, 0x60, 0x51, 0x53, 0x4C, 0x00, 0x9A, 0xD4,
+0x49, 0x42, 0x79, 0xC6, 0xDB, 0xCE, 0x38, 0xB6, 0xFF, 0xEF, 0x7D, 0xDF, 0x13, 0x8D, 0x6C, 0x53,
+0x65, 0x19, 0xCA, 0x42, 0xBA, 0xC6, 0x9D, 0xDF, 0x0E, 0x64, 0x66, 0x32, 0x60, 0x21, 0x26, 0x63,
+0x30, 0xCE, 0x54, 0xFF, 0xB2, 0xEE, 0xAE, 0xCD, 0x51, 0xE6, 0xA4, 0xCB, 0x0C, 0xE6, 0x6C, 0xE6,
+0x4F, 0xF7, 0x51, 0xEF, 0x8D, 0xA5, 0x66, 0x4B, 0x67, 0x33, 0x47, 0x43, 0x6E, 0xBC, 0x88, 0xD2,
+0x41, 0xD8, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x01, 0xC9, 0x81, 0xD8, 0x70, 0xF4, 0x15, 0xEE, 0x10,
+0xA5, 0xCF, 0x8C, 0x0D, 0x6C, 0x8F, 0x7C, 0xCE, 0x9C, 0x73, 0xD6, 0x92, 0xE6, 0xA6, 0xC0, 0xF9,
+0xFF, 0xA3, 0xA6, 0x00, 0xA8, 0xCE, 0x72, 0xEE, 0x2B, 0xC5, 0xAC, 0xD5, 0xF0, 0xF6, 0xF3, 0xEE,
+0x8E, 0x8C, 0x2B, 0x53, 0x47, 0x32, 0x50, 0x7C, 0xFB, 0xCE, 0x18, 0xB6, 0x0C, 0x4B, 0x86, 0x19,
+0x8D, 0x5B, 0xB2, 0x84, 0xBE, 0xC7, 0x51, 0x7C, 0x2D, 0x5B, 0xE8, 0x31, 0x4E, 0x63, 0xCC, 0x5A,
+0x09, 0x42, 0xEC, 0x62, 0xC7, 0x39, 0x53, 0x00, 0x60, 0x67, 0x00, 0xA5, 0x9A, 0x01, 0x53, 0x91,
+0xC1, 0x29, 0x42, 0xA7, 0x31, 0x60, 0x6C, 0x58, 0x6C, 0x4C, 0x00, 0xC0, 0x28, 0x42, 0x44, 0xC0,
+0xE7, 0x39, 0x4C, 0x6C, 0x65, 0x00, 0x4C, 0xC0, 0x8A, 0x52, 0x44, 0x60, 0x44, 0x91, 0x58, 0x67,
+0x4C, 0x58, 0x4C, 0xA6, 0x4C, 0x7F, 0x60, 0x00, 0x44, 0x60, 0x00, 0x51, 0x6C, 0x51, 0xC0, 0x69,
+0x4A, 0x58, 0x65, 0x58, 0x4C, 0x58, 0x51, 0x00, 0x65, 0x51, 0x44, 0x65, 0x60, 0x00, 0x6C, 0x51,
+0x60, 0x01, 0x6C, 0x58, 0x60, 0x00, 0x44, 0x60, 0x51, 0x58, 0x00, 0x4C, 0x58, 0x00, 0x44, 0x00,
+0xC5, 0x28, 0x3A, 0xD3, 0x8C, 0x4C, 0x5B, 0x28, 0x32, 0x30, 0x74, 0xFF, 0xEF, 0x00, 0xC2, 0x9D,
+0xDF, 0x54, 0x95, 0x17, 0xAE, 0x6B, 0xC6, 0x1B, 0xCF, 0xA9, 0x3A, 0x82, 0x21, 0xA0, 0x31, 0x2C,
+0xAD, 0x74, 0xFF, 0x91, 0xE6, 0xA7, 0xC0, 0xD8, 0xFF, 0x71, 0xAD, 0xC8, 0xB0, 0xF6, 0x69, 0xCD,
+0xEA, 0xDD, 0x50, 0xFF, 0x90, 0xE6, 0xCB, 0x8C, 0x67, 0x33, 0x27, 0x43, 0x6E, 0xBC, 0x6A, 0xC1,
+0x41, 0xD8, 0x00, 0xF8, 0xE0, 0x14, 0xC0, 0x40, 0xD0, 0x41, 0xC0, 0xF5, 0xE5, 0x74, 0xC0, 0x0C,
+0x74, 0x93, 0xC5, 0xD4, 0xB5, 0x12, 0xC6, 0x31, 0xD6, 0x92, 0xE6, 0x97, 0xFF, 0x7A, 0xFF, 0x9B,
+0xAF, 0x00, 0x7A, 0xCD, 0xF6, 0xFE, 0xEF, 0xDD, 0xE5, 0x9B, 0xAF, 0xF6, 0x53, 0xFF, 0xEF, 0x9C,
+0x84, 0x21, 0xA9, 0x4A, 0xFB, 0xD6, 0xFF, 0xF7, 0xD7, 0xAD, 0xAA, 0x42, 0xC7, 0x29, 0xF7, 0xB5,
+0x6E, 0xBA, 0xC2, 0xBA, 0xCE, 0x31, 0x7C, 0xCC, 0x52, 0xBF, 0x63, 0xC0, 0x87, 0x31, 0x5C, 0xC0,
+0xC7, 0x39, 0x5B, 0x9A, 0x5B, 0xAE, 0x01, 0x6C, 0x67, 0x4C, 0x96, 0x6C, 0xC0, 0xC8, 0x39, 0x6C,
+0x60, 0xC0, 0xA7, 0x39, 0x60, 0x00, 0xC0, 0x49, 0x4A, 0x44, 0x67, 0x5B, 0x58, 0x60, 0x00, 0x5B,
+0x67, 0x5B, 0x4C, 0x6C, 0x60, 0xC0, 0x6A, 0x4A, 0x47, 0x4C, 0x6C, 0x53, 0x60, 0x00, 0x53, 0x58,
+0x6C, 0x67, 0x6C, 0x60, 0x6C, 0x00, 0x5B, 0x60, 0x02, 0x58, 0x00, 0x4C, 0x58, 0x00, 0x5B, 0x60,
+0x03, 0x6C, 0x00, 0x67, 0x60, 0x02, 0x67, 0x60, 0x58, 0x01, 0x60, 0x00, 0x5B, 0x58, 0xC1, 0x28,
+0x42, 0x86, 0x29, 0x58, 0x90, 0xC4, 0x49, 0x42, 0xD3, 0x8C, 0xEF, 0x6B, 0x07, 0x32, 0x2C, 0x53,
+0xAF, 0xC1, 0x34, 0x95, 0xDA, 0xC6, 0x6E, 0x00, 0xC5, 0xBA, 0xC6, 0x6D, 0x5B, 0x44, 0x19, 0x83,
+0x29, 0xE5, 0x5A, 0xB2, 0xDE, 0xB9, 0xC3, 0xB3, 0xEE, 0xFB, 0xFF, 0x9B, 0xFF, 0xFC, 0xFF, 0xA0,
+0xC2, 0x56, 0xFF, 0x33, 0xFF, 0x4A, 0xCD, 0xBE, 0xC7, 0xF1, 0xFE, 0x50, 0xCE, 0x09, 0x4C, 0xC6,
+0x32, 0x2D, 0xB4, 0xA9, 0xD2, 0x61, 0xD8, 0x00, 0xF0, 0xBE, 0x5D, 0xE0, 0x12, 0x67, 0xCA, 0xB1,
+0xFC, 0x15, 0xEE, 0x31, 0xAD, 0x2D, 0x7C, 0x2A, 0x5B, 0x8E, 0x8C, 0x4E, 0xB5, 0x51, 0xDE, 0xD3,
+0xEE, 0xB9, 0xFF, 0xDC, 0xFF, 0x83, 0xC0, 0xDF, 0xF7, 0xA5, 0x46, 0xCE, 0x98, 0xFF, 0xF3, 0xFE,
+0xA8, 0xBC, 0xAE, 0xFE, 0x12, 0xFF, 0x8E, 0x94, 0x44, 0x19, 0x0F, 0x74, 0x9D, 0xE7, 0x55, 0x9D,
+0x49, 0x3A, 0xA7, 0x29, 0xE7, 0x31, 0xEF, 0x73, 0x9E, 0xEF, 0x4A, 0xC1, 0x10, 0x7C, 0x51, 0x84,
+0xA2, 0xC2, 0x4E, 0x6B, 0xCC, 0x5A, 0xC8, 0x39, 0x63, 0xC1, 0xA7, 0x39, 0xE8, 0x39, 0x53, 0xC0,
+0x08, 0x42, 0xAB, 0x00, 0x60, 0x6C, 0x67, 0x60, 0x6C, 0x40, 0x58, 0x67, 0x74, 0x60, 0x67, 0x58,
+0x00, 0x60, 0xBF, 0xC0, 0xA7, 0x31, 0x6C, 0x53, 0x58, 0x5B, 0x44, 0x00, 0xBE, 0x58, 0x60, 0x74,
+0x47, 0x58, 0x74, 0x5B, 0x58, 0x44, 0x47, 0x67, 0x5B, 0x4C, 0x67, 0x6F, 0x60, 0x58, 0x60, 0x02,
+0x5B, 0x58, 0x03, 0x60, 0x04, 0x6C, 0x00, 0x60, 0x05, 0x58, 0x01, 0x60, 0x00, 0x5B, 0x58, 0x60,
+0xC0, 0xA6, 0x31, 0x00, 0x81, 0xC2, 0x28, 0x3A, 0x10, 0x74, 0xAE, 0x6B, 0x9A, 0xC0, 0x86, 0x21,
+0xAE, 0xC2, 0x49, 0x32, 0x8A, 0x42, 0x92, 0x84, 0xBF, 0xC5, 0x0C, 0x53, 0x25, 0x19, 0xC7, 0x29,
+0x63, 0x21, 0xC8, 0x7B, 0x33, 0xF7, 0x91, 0xC2, 0x56, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xA6, 0xA8,
+0xC0, 0x78, 0xFF, 0xA8, 0xC9, 0xEE, 0xE5, 0x2A, 0xCD, 0x6F, 0xFE, 0x50, 0xD6, 0xE8, 0x4B, 0xC6,
+0x32, 0x2D, 0xB4, 0xA9, 0xD2, 0x62, 0xD8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x12, 0xC7, 0x81, 0xD8,
+0xD1, 0xFC, 0x36, 0xEE, 0x51, 0xAD, 0x6D, 0x84, 0xC8, 0x4A, 0x48, 0x63, 0xAA, 0xA4, 0x54, 0xC2,
+0xF4, 0xF6, 0x98, 0xFF, 0xDD, 0xFF, 0x55, 0x9A, 0xA9, 0x7E, 0xCA, 0x58, 0xFF, 0xB3, 0xF6, 0xA8,
+0xBC, 0x4C, 0xEE, 0x6F, 0xE6, 0x8A, 0x73, 0x03, 0x19, 0x92, 0x8C, 0xFF, 0xFF, 0xF3, 0x94, 0x66,
+0x21, 0xA5, 0xC0, 0x86, 0x29, 0x5A, 0xC1, 0xBE, 0xEF, 0x14, 0x9D, 0x7D, 0xC5, 0xB3, 0x94, 0x76,
+0xB5, 0xF0, 0x7B, 0xED, 0x5A, 0x09, 0x42, 0xEC, 0x5A, 0x44, 0x53, 0x00, 0x60, 0x67, 0x02, 0x60,
+0x67, 0xBE, 0x67, 0x44, 0x01, 0x4C, 0x60, 0xAF, 0x47, 0xC0, 0xE8, 0x39, 0x00, 0x53, 0x40, 0x67,
+0x00, 0x6F, 0x58, 0x00, 0x6C, 0x67, 0x5B, 0x6F, 0x58, 0x53, 0x4C, 0x92, 0x60, 0x6C, 0x4C, 0xC0,
+0x49, 0x4A, 0x4C, 0x44, 0x4C, 0x74, 0x58, 0x00, 0x60, 0x01, 0x5B, 0x58, 0x00, 0x5B, 0x00, 0x58,
+0x00, 0x60, 0x00, 0x67, 0x60, 0x01, 0x67, 0x00, 0x60, 0x5B, 0x01, 0x60, 0x01, 0x58, 0x01, 0x60,
+0x00, 0x5B, 0x58, 0xA9, 0x00, 0x58, 0xAE, 0xC0, 0x49, 0x42, 0x81, 0xC1, 0xE3, 0x10, 0xE7, 0x29,
+0x5A, 0xC2, 0x4D, 0x5B, 0x92, 0x84, 0x0C, 0x53, 0x91, 0x5A, 0xC0, 0x45, 0x19, 0xBB, 0xC6, 0xE8,
+0x31, 0x23, 0x21, 0x8B, 0x9C, 0x54, 0xF7, 0xF3, 0xEE, 0xD9, 0xFF, 0xFE, 0xFF, 0xAB, 0x9A, 0x71,
+0xC0, 0x7A, 0xF7, 0xB8, 0xC9, 0x92, 0xF6, 0xCA, 0xC4, 0x0D, 0xF6, 0x2E, 0xD6, 0xC8, 0x4B, 0xE6,
+0x3A, 0x4D, 0xB4, 0xA8, 0xD2, 0x62, 0xD8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x12, 0xC1, 0x81, 0xD8,
+0xD1, 0xFC, 0x66, 0x43, 0xC8, 0x6D, 0x7C, 0x08, 0x4B, 0xC5, 0x4A, 0x89, 0x94, 0xD1, 0xEE, 0xF3,
+0xF6, 0x37, 0xFF, 0xDC, 0xFF, 0x9E, 0xEF, 0x9A, 0xC0, 0xDE, 0xEF, 0x57, 0x5B, 0xD3, 0xF0, 0xDD,
+0xE9, 0xC4, 0x8E, 0xF6, 0x2E, 0xDE, 0x45, 0x4A, 0x24, 0x19, 0x8E, 0x6B, 0x7D, 0xE7, 0xDF, 0xEF,
+0x96, 0xA5, 0xEF, 0x73, 0x8E, 0x63, 0xDB, 0xD6, 0xFF, 0xF7, 0x10, 0x7C, 0x65, 0x29, 0x75, 0xAD,
+0x39, 0xC6, 0xB3, 0x9C, 0x0D, 0x63, 0x67, 0xC1, 0xEC, 0x62, 0xA7, 0x39, 0x53, 0xAE, 0x67, 0x00,
+0xA5, 0x74, 0x96, 0x5B, 0x58, 0x60, 0x53, 0xC1, 0x29, 0x4A, 0x6A, 0x4A, 0xBE, 0x40, 0x60, 0x6C,
+0x5B, 0xC0, 0x4A, 0x4A, 0x53, 0x6F, 0xC0, 0xC7, 0x39, 0x6F, 0x53, 0x5B, 0x40, 0x6C, 0x58, 0x01,
+0x53, 0x58, 0x67, 0x6C, 0x01, 0x4C, 0x67, 0x6C, 0x5B, 0x74, 0x44, 0x60, 0x00, 0x6C, 0x67, 0x60,
+0x5B, 0x58, 0x00, 0x5B, 0x60, 0x00, 0x58, 0x5B, 0x60, 0x03, 0x5B, 0x60, 0x01, 0x5B, 0x58, 0x02,
+0x60, 0x58, 0x01, 0x60, 0x00, 0x5B, 0x58, 0x60, 0x81, 0x95, 0x00, 0xC0, 0x08, 0x3A, 0x7E, 0xC3,
+0x71, 0x84, 0xDB, 0xCE, 0x1C, 0xD7, 0x9E, 0xE7, 0x6E, 0xC0, 0x7E, 0xE7, 0x6A, 0xC2, 0xF8, 0xB5,
+0x11, 0x7C, 0x87, 0x29, 0x00, 0xC2, 0x02, 0x19, 0x6B, 0x94, 0x13, 0xF7, 0x91, 0xC1, 0xF9, 0xFF,
+0xFD, 0xFF, 0x66, 0x6E, 0x00, 0xCB, 0x7B, 0xF7, 0x57, 0xFF, 0x92, 0xF6, 0xC9, 0xC4, 0x2E, 0xF6,
+0xCD, 0xCD, 0xA7, 0x43, 0xE6, 0x3A, 0x4D, 0xB4, 0x88, 0xD2, 0x82, 0xD8, 0x00, 0xF8, 0x62, 0x5D,
+0xE0, 0x0F, 0x62, 0x5D, 0x00, 0xCB, 0x81, 0xD8, 0xB1, 0xFC, 0xF5, 0xE5, 0x10, 0xA5, 0x4D, 0x74,
+0x27, 0x43, 0x84, 0x32, 0x49, 0x84, 0x91, 0xE6, 0xF3, 0xFE, 0x36, 0xFF, 0xDB, 0xFF, 0x93, 0xC0,
+0xDD, 0xEF, 0xB9, 0xBC, 0xC1, 0xF5, 0xF6, 0xCE, 0xDD, 0xA9, 0xC7, 0x11, 0xFF, 0x4C, 0xBD, 0x05,
+0x42, 0x65, 0x21, 0xA7, 0x29, 0x51, 0x84, 0x3D, 0xDF, 0xDF, 0xEF, 0x91, 0xBE, 0x00, 0xC3, 0x75,
+0xA5, 0x48, 0x42, 0xC6, 0x31, 0x30, 0x84, 0xA6, 0x78, 0xC3, 0x6A, 0x4A, 0x08, 0x42, 0xEC, 0x5A,
+0xC7, 0x39, 0x5B, 0x60, 0xAF, 0x67, 0x95, 0xC0, 0x29, 0x4A, 0x00, 0x67, 0x58, 0x67, 0x6C, 0xC1,
+0xAF, 0x7B, 0x10, 0x84, 0xBF, 0x40, 0xC0, 0xAB, 0x52, 0x4C, 0x7B, 0xC1, 0xCF, 0x7B, 0x8B, 0x52,
+0x60, 0x4C, 0xC1, 0x2D, 0x63, 0x29, 0x42, 0xA6, 0xC2, 0x8F, 0x73, 0xCC, 0x5A, 0xA7, 0x39, 0x60,
+0x6C, 0xC3, 0xA7, 0x31, 0x49, 0x4A, 0x6E, 0x6B, 0x31, 0x84, 0xBA, 0xC1, 0x0D, 0x63, 0x87, 0x31,
+0x6C, 0x44, 0x54, 0xC2, 0xCF, 0x7B, 0x29, 0x42, 0xC7, 0x39, 0x60, 0x6C, 0x67, 0x60, 0x5B, 0x58,
+0x00, 0x60, 0x67, 0x00, 0x5B, 0x60, 0x03, 0x5B, 0x58, 0x5B, 0x03, 0x58, 0x01, 0x60, 0x58, 0x01,
+0x60, 0x00, 0x5B, 0x58, 0x44, 0x49, 0xBE, 0x7A, 0xC0, 0x08, 0x3A, 0x66, 0xC0, 0xBF, 0xEF, 0x6E,
+0x96, 0xC1, 0x1C, 0xD7, 0xD7, 0xAD, 0xA6, 0xCB, 0x5D, 0xDF, 0xDF, 0xF7, 0x5E, 0xE7, 0xF0, 0x73,
+0xA7, 0x29, 0x22, 0x21, 0x67, 0x7B, 0xD2, 0xEE, 0x54, 0xFF, 0x96, 0xFF, 0xFC, 0xFF, 0xFE, 0xF7,
+0xBB, 0xA9, 0xC9, 0xBA, 0xFF, 0x35, 0xF7, 0x70, 0xEE, 0x6B, 0xD5, 0xD0, 0xFE, 0xAD, 0xC5, 0x66,
+0x3B, 0xE6, 0x3A, 0x4D, 0xB4, 0x88, 0xCA, 0x73, 0xC0, 0x00, 0xF8, 0x62, 0x5D, 0xE0, 0x0F, 0x62,
+0x5D, 0x00, 0xC0, 0x81, 0xD8, 0x4D, 0xC9, 0xD5, 0xE5, 0xF0, 0xA4, 0x4D, 0x74, 0xE7, 0x2A, 0x64,
+0x22, 0xA7, 0x6B, 0x4C, 0xB5, 0x91, 0xEE, 0x55, 0xFF, 0xD9, 0xFF, 0x92, 0xC0, 0xFB, 0xFF, 0x75,
+0xB4, 0xC2, 0xF3, 0xF6, 0x70, 0xEE, 0xB1, 0xFE, 0x86, 0xCF, 0xC8, 0x8B, 0x47, 0x4A, 0xE7, 0x31,
+0x86, 0x21, 0x08, 0x32, 0xEC, 0x52, 0x31, 0x7C, 0xB6, 0xA5, 0xF7, 0xB5, 0xD2, 0x8C, 0x68, 0x42,
+0x85, 0x21, 0x89, 0x42, 0x28, 0x3A, 0x04, 0x19, 0xCB, 0x52, 0x54, 0x53, 0xC0, 0xEC, 0x5A, 0x4C,
+0x60, 0x00, 0xAB, 0x60, 0x58, 0x00, 0x67, 0xAE, 0x01, 0x74, 0xC0, 0x51, 0x8C, 0x40, 0xC1, 0x2D,
+0x6B, 0x72, 0x8C, 0x40, 0x58, 0x74, 0xC4, 0xB3, 0x94, 0x8E, 0x73, 0x87, 0x31, 0xAB, 0x52, 0x52,
+0x8C, 0x54, 0x00, 0xC0, 0xD3, 0x9C, 0x58, 0x4C, 0xC0, 0x29, 0x4A, 0x6C, 0xA1, 0xC1, 0x2D, 0x6B,
+0x11, 0x84, 0x00, 0x40, 0x7F, 0xC0, 0x08, 0x42, 0x96, 0xC4, 0x86, 0x31, 0x6E, 0x73, 0xF4, 0xA4,
+0x4D, 0x6B, 0xC8, 0x39, 0x5B, 0x58, 0x60, 0x04, 0x67, 0x00, 0x60, 0x01, 0x67, 0x60, 0x00, 0x58,
+0x00, 0x5B, 0x00, 0x60, 0x01, 0x58, 0x01, 0x60, 0x58, 0x01, 0x60, 0x00, 0x5B, 0x58, 0x00, 0xAE,
+0x00, 0xC2, 0x65, 0x21, 0x49, 0x42, 0xBA, 0xCE, 0x6E, 0xC7, 0x14, 0x95, 0x29, 0x3A, 0x4D, 0x5B,
+0x49, 0x3A, 0xC7, 0x29, 0xCC, 0x52, 0x11, 0x7C, 0xFC, 0xD6, 0xA6, 0x6E, 0xC3, 0x63, 0x21, 0x63,
+0x52, 0xEF, 0xD5, 0x94, 0xFF, 0xA2, 0xC0, 0xFA, 0xFF, 0x5C, 0x6A, 0x5C, 0x42, 0xCA, 0x34, 0xF7,
+0xB0, 0xEE, 0x4E, 0xE6, 0xF1, 0xF6, 0x4B, 0xAD, 0x46, 0x33, 0xE6, 0x3A, 0x4D, 0xB4, 0x68, 0xCA,
+0x62, 0xD8, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x81, 0xD8, 0xB1, 0xFC, 0xF5, 0xE5, 0xF0, 0xA4, 0x6E,
+0x74, 0x28, 0x2B, 0x90, 0xC4, 0x06, 0x4B, 0x66, 0x73, 0x4C, 0xC5, 0x91, 0xF6, 0x55, 0xFF, 0xAF,
+0xC0, 0xF9, 0xFF, 0xA0, 0x4B, 0x00, 0xC4, 0xF2, 0xFE, 0x30, 0xEE, 0xCD, 0xB4, 0x86, 0x62, 0x64,
+0x29, 0x46, 0x5A, 0xAB, 0xC0, 0x66, 0x19, 0xA6, 0xC0, 0x28, 0x32, 0x91, 0xBE, 0xC0, 0x64, 0x19,
+0xA6, 0xC2, 0x48, 0x3A, 0x23, 0x19, 0x40, 0x00, 0x71, 0x54, 0x4C, 0xC0, 0xCC, 0x5A, 0x4C, 0xAF,
+0x00, 0xBE, 0xAB, 0x60, 0x92, 0x58, 0xC0, 0x29, 0x42, 0x00, 0x67, 0x6C, 0x4F, 0xC4, 0x0C, 0x63,
+0x66, 0x29, 0x2D, 0x63, 0xD4, 0x9C, 0x6A, 0x52, 0x58, 0x4F, 0x96, 0x53, 0x7C, 0x4F, 0x6C, 0xC1,
+0x8B, 0x52, 0xB3, 0x9C, 0x7C, 0xC0, 0x87, 0x31, 0x60, 0x58, 0x60, 0xC2, 0xCF, 0x7B, 0x51, 0x8C,
+0x2D, 0x6B, 0x68, 0xC0, 0x6A, 0x4A, 0x4C, 0x96, 0x58, 0xC4, 0xF0, 0x7B, 0x14, 0xA5, 0x31, 0x84,
+0x29, 0x42, 0xC7, 0x39, 0x53, 0x58, 0xBA, 0x67, 0x0A, 0x58, 0x00, 0x5B, 0x67, 0x02, 0x5B, 0x58,
+0x00, 0x67, 0x58, 0x01, 0x67, 0x00, 0x5B, 0x58, 0x00, 0x51, 0x91, 0x66, 0x71, 0xC9, 0x79, 0xC6,
+0x7E, 0xE7, 0x92, 0x84, 0x86, 0x21, 0x29, 0x3A, 0xA7, 0x29, 0x25, 0x19, 0xE8, 0x31, 0x2E, 0x5B,
+0xBC, 0xD6, 0x48, 0xC5, 0x6A, 0x3A, 0xA5, 0x29, 0x81, 0x39, 0x08, 0x94, 0xB1, 0xEE, 0x53, 0xFF,
+0x6F, 0xC0, 0xFA, 0xFF, 0xAB, 0x4E, 0xC2, 0xD7, 0xFF, 0x53, 0xF7, 0x10, 0xF7, 0x91, 0xC2, 0xCC,
+0xC5, 0x07, 0x74, 0x25, 0x2B, 0xB3, 0xC2, 0x2D, 0xB4, 0x47, 0xCA, 0x62, 0xD8, 0x5D, 0xE0, 0x14,
+0xC5, 0x82, 0xD8, 0xF2, 0xFC, 0x15, 0xE6, 0x10, 0xA5, 0xAE, 0x74, 0xAB, 0x3B, 0x95, 0xC5, 0xC6,
+0x3A, 0x02, 0x3A, 0x08, 0x94, 0xAE, 0xCD, 0xD2, 0xEE, 0x54, 0xFF, 0xAF, 0x00, 0xC0, 0x13, 0xF7,
+0xBA, 0xC4, 0x71, 0xE6, 0x6B, 0xA4, 0x86, 0x62, 0x84, 0x39, 0xC6, 0x31, 0x5F, 0xC0, 0xA7, 0x21,
+0x5A, 0xC1, 0x49, 0x3A, 0xE8, 0x31, 0x5A, 0xA9, 0xAE, 0xBF, 0xC1, 0x44, 0x19, 0xE6, 0x31, 0xBF,
+0x67, 0xC1, 0x0C, 0x5B, 0x8A, 0x4A, 0x4C, 0xC1, 0xCC, 0x5A, 0xA7, 0x39, 0xAF, 0x4C, 0xAF, 0xBF,
+0x6C, 0x00, 0xA1, 0x60, 0x58, 0x60, 0xC1, 0x6A, 0x4A, 0xB3, 0x94, 0x68, 0xC0, 0xA7, 0x31, 0x40,
+0x74, 0x63, 0xC2, 0x87, 0x31, 0x8F, 0x73, 0x72, 0x8C, 0x4F, 0xC1, 0xAF, 0x73, 0xF0, 0x83, 0x58,
+0xC0, 0xAB, 0x52, 0x74, 0x7C, 0x53, 0x6C, 0x5B, 0xAE, 0xC4, 0x31, 0x8C, 0x75, 0xAD, 0xF4, 0x9C,
+0x92, 0x94, 0x4D, 0x6B, 0x4C, 0x47, 0x40, 0xC1, 0x10, 0x84, 0x72, 0x8C, 0x68, 0xC0, 0x69, 0x4A,
+0x4C, 0xC0, 0x08, 0x42, 0x58, 0xBB, 0x67, 0x00, 0x6C, 0x67, 0x05, 0x60, 0x5B, 0x58, 0x00, 0x5B,
+0x67, 0x03, 0x58, 0x00, 0x67, 0x58, 0x01, 0x67, 0x00, 0x5B, 0x58, 0x7D, 0x4C, 0x58, 0x95, 0xC2,
+0x08, 0x3A, 0x75, 0xA5, 0xFF, 0xF7, 0x9A, 0xC1, 0xBA, 0xC6, 0xF3, 0x8C, 0xA6, 0xC5, 0xB7, 0xA5,
+0x7A, 0xC6, 0x5E, 0xE7, 0xFF, 0xFF, 0x97, 0xAD, 0xE8, 0x29, 0xA4, 0xC3, 0x21, 0x21, 0x22, 0x52,
+0x4D, 0xBD, 0x74, 0xFF, 0x96, 0xAB, 0xC0, 0xD8, 0xFF, 0xAE, 0xA0, 0xC0, 0x73, 0xF7, 0x94, 0xC8,
+0xCF, 0xDE, 0x68, 0x84, 0xC3, 0x3A, 0x05, 0x23, 0xC6, 0x32, 0x2D, 0xB4, 0x47, 0xCA, 0x61, 0xD8,
+0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x41, 0xD0, 0x12, 0xFD, 0xF4, 0xDD, 0x10, 0xA5, 0xAE, 0x7C, 0x69,
+0x33, 0xBF, 0xCC, 0xCA, 0x4B, 0x07, 0x43, 0x84, 0x42, 0x05, 0x63, 0x8B, 0x9C, 0x8E, 0xC5, 0xF0,
+0xD5, 0x51, 0xDE, 0xEF, 0xCD, 0xAB, 0xA4, 0xA8, 0x7B, 0x86, 0x5A, 0xC5, 0x41, 0x9B, 0x9F, 0x5A,
+0x05, 0xA9, 0xC0, 0x48, 0x3A, 0x4E, 0x95, 0xC0, 0x44, 0x21, 0x91, 0xC0, 0x2C, 0x63, 0x91, 0xC0,
+0x86, 0x31, 0x54, 0xC0, 0xA7, 0x31, 0x00, 0xC0, 0xE8, 0x39, 0xBF, 0xC0, 0x4A, 0x4A, 0x6C, 0x7B,
+0x60, 0x58, 0xC0, 0x29, 0x4A, 0x60, 0xCB, 0x8B, 0x52, 0x31, 0x8C, 0xCB, 0x5A, 0x46, 0x29, 0x0D,
+0x63, 0xF4, 0x9C, 0xEC, 0x5A, 0x87, 0x31, 0x8A, 0x52, 0xB3, 0x9C, 0x10, 0x84, 0xF4, 0x9C, 0x54,
+0x5B, 0x7B, 0xC1, 0x35, 0xA5, 0x0D, 0x63, 0x44, 0x6C, 0x00, 0x60, 0x40, 0xC0, 0x51, 0x8C, 0x60,
+0xC5, 0x0C, 0x63, 0x92, 0x94, 0xAA, 0x52, 0xA7, 0x39, 0x4D, 0x6B, 0xF0, 0x83, 0x54, 0xC1, 0xD3,
+0x9C, 0x2D, 0x6B, 0x47, 0x6F, 0x67, 0x0C, 0xAD, 0x67, 0x60, 0x06, 0x58, 0x06, 0x78, 0x4C, 0x49,
+0xC5, 0x65, 0x29, 0x28, 0x3A, 0x4C, 0x5B, 0xD2, 0x84, 0x3B, 0xD7, 0xFE, 0xEF, 0xAB, 0x01, 0xA6,
+0xC4, 0x7D, 0xDF, 0x55, 0xA5, 0x49, 0x3A, 0x86, 0x19, 0xE7, 0x29, 0xA0, 0xC4, 0x62, 0x29, 0x64,
+0x52, 0xCB, 0xA4, 0xB2, 0xE6, 0x34, 0xFF, 0x01, 0xAD, 0x81, 0xC2, 0xCC, 0xB5, 0x06, 0x6C, 0x25,
+0x43, 0x8B, 0xC4, 0x67, 0x23, 0x47, 0x43, 0x4D, 0xBC, 0x06, 0xCA, 0x41, 0xD8, 0x5D, 0xE0, 0x14,
+0xC0, 0x61, 0xD0, 0x63, 0xC3, 0x14, 0xDE, 0x30, 0xA5, 0xCE, 0x7C, 0xCA, 0x4B, 0x9F, 0xB6, 0xC1,
+0xC7, 0x32, 0x45, 0x2A, 0xB5, 0xC0, 0x85, 0x52, 0xB9, 0xC1, 0xC5, 0x6A, 0x26, 0x73, 0x96, 0x59,
+0xC0, 0x04, 0x42, 0x83, 0xA6, 0xC1, 0xC7, 0x31, 0x08, 0x3A, 0xAE, 0x03, 0xA5, 0x53, 0xC0, 0x48,
+0x42, 0x62, 0x90, 0xC5, 0x69, 0x4A, 0xCA, 0x52, 0x68, 0x42, 0xEE, 0x73, 0xEB, 0x5A, 0x29, 0x42,
+0x70, 0x58, 0x00, 0x60, 0x58, 0xBF, 0x58, 0xBA, 0x58, 0x00, 0xC0, 0x29, 0x4A, 0x58, 0xC1, 0x4A,
+0x4A, 0x10, 0x84, 0x7F, 0xC2, 0x87, 0x31, 0xCF, 0x7B, 0x93, 0x94, 0x7B, 0xC0, 0xC7, 0x39, 0x58,
+0x6C, 0x5C, 0xC1, 0x52, 0x8C, 0x6A, 0x4A, 0x67, 0x7B, 0x48, 0xC1, 0x2D, 0x63, 0xA7, 0x31, 0x00,
+0xC0, 0xE8, 0x41, 0xA9, 0xC0, 0x8E, 0x73, 0xBE, 0x54, 0xC5, 0xAA, 0x5A, 0xEF, 0x83, 0x8A, 0x52,
+0x08, 0x42, 0x10, 0x84, 0x51, 0x8C, 0x74, 0xC0, 0xB2, 0x9C, 0x54, 0x48, 0x4C, 0x67, 0x08, 0x60,
+0x02, 0xAE, 0x00, 0x60, 0x06, 0x96, 0x06, 0x5B, 0x58, 0x44, 0x80, 0x4E, 0xC2, 0x48, 0x3A, 0xA9,
+0x42, 0xCD, 0x63, 0x96, 0xC3, 0xD1, 0x7C, 0xD5, 0xA5, 0xF2, 0x8C, 0x50, 0x7C, 0xAF, 0xC3, 0xEB,
+0x52, 0x65, 0x19, 0x08, 0x2A, 0xA6, 0x21, 0xA6, 0xC5, 0xC5, 0x29, 0x24, 0x42, 0xA5, 0x5A, 0x67,
+0x7B, 0x29, 0x9C, 0x4D, 0xC5, 0x95, 0x85, 0xC5, 0xA9, 0x94, 0xC6, 0x63, 0xE3, 0x3A, 0xA4, 0x22,
+0x06, 0x23, 0x87, 0x23, 0x4B, 0xC0, 0x4E, 0xC4, 0x45, 0xC1, 0x61, 0xE0, 0x00, 0xF8, 0xE0, 0x14,
+0xC6, 0x61, 0xD0, 0x32, 0xFD, 0x15, 0xDE, 0x30, 0xA5, 0xCE, 0x84, 0xAA, 0x4B, 0xEC, 0x4B, 0x7E,
+0xC0, 0xC8, 0x32, 0xA2, 0xB5, 0xBE, 0xA1, 0xC1, 0xA3, 0x31, 0x04, 0x42, 0x9A, 0x92, 0xC1, 0x05,
+0x32, 0x27, 0x3A, 0xAB, 0x67, 0xAB, 0x02, 0x67, 0x62, 0x01, 0x95, 0x00, 0x67, 0xC0, 0x2B, 0x5B,
+0xAF, 0xC4, 0x68, 0x42, 0xCE, 0x73, 0x2C, 0x5B, 0xAB, 0x52, 0x4D, 0x6B, 0x60, 0xAB, 0xAE, 0x58,
+0x01, 0xBA, 0x60, 0x00, 0xC0, 0x49, 0x4A, 0x5B, 0x7B, 0xC0, 0x31, 0x84, 0xBE, 0xC3, 0xCF, 0x7B,
+0xB3, 0x94, 0xAF, 0x73, 0xA7, 0x31, 0x5B, 0x44, 0xC2, 0xCB, 0x5A, 0xF4, 0x9C, 0x4D, 0x6B, 0x58,
+0x5B, 0xC1, 0x49, 0x4A, 0xB3, 0x94, 0x4C, 0xC0, 0x6E, 0x73, 0x44, 0x60, 0x5B, 0xC0, 0x2D, 0x6B,
+0x4F, 0x95, 0x54, 0x6C, 0x5B, 0x5C, 0x4F, 0xC0, 0x4D, 0x73, 0x5B, 0x5C, 0xC1, 0xCF, 0x83, 0x0C,
+0x63, 0x5B, 0x67, 0x06, 0xAE, 0x67, 0x60, 0x03, 0xAE, 0x60, 0x06, 0x58, 0x06, 0xA6, 0x95, 0xBE,
+0x85, 0xC1, 0x07, 0x32, 0x68, 0x3A, 0x91, 0xAE, 0xC3, 0xC5, 0x21, 0x67, 0x32, 0x0B, 0x4B, 0x84,
+0x19, 0x63, 0xC0, 0xEB, 0x4A, 0x6E, 0x00, 0x95, 0xC0, 0xA6, 0x21, 0xAE, 0x5D, 0xA5, 0xC0, 0xA3,
+0x29, 0xB9, 0xC0, 0x44, 0x42, 0xB9, 0xAE, 0xAE, 0x86, 0x8E, 0xC2, 0xC4, 0x2A, 0x67, 0x2B, 0xE9,
+0x33, 0x95, 0xC2, 0x88, 0x4B, 0x6E, 0xC4, 0x07, 0xD2, 0x6A, 0xC0, 0x00, 0xF8, 0xE0, 0x14, 0xC3,
+0x61, 0xD0, 0x33, 0xFD, 0x35, 0xDE, 0x50, 0xA5, 0x50, 0xC1, 0x8A, 0x53, 0x2D, 0x5C, 0xAB, 0xC2,
+0x0A, 0x3B, 0xA9, 0x32, 0x48, 0x2A, 0xBA, 0x58, 0xC1, 0xC6, 0x29, 0x07, 0x32, 0xBE, 0x58, 0xBF,
+0xAF, 0xA1, 0x96, 0x62, 0x67, 0x6E, 0x00, 0x67, 0x00, 0x62, 0x00, 0x67, 0x00, 0x53, 0x67, 0xC2,
+0xE6, 0x31, 0x03, 0x19, 0x4C, 0x63, 0xAF, 0xC5, 0xAB, 0x52, 0x0D, 0x63, 0xC8, 0x39, 0x09, 0x42,
+0x49, 0x4A, 0xE8, 0x41, 0x67, 0xAE, 0x00, 0x74, 0x67, 0x74, 0x67, 0x00, 0xC0, 0x6E, 0x6B, 0x40,
+0xAB, 0xC2, 0xAF, 0x73, 0x6A, 0x52, 0x66, 0x31, 0x67, 0x95, 0x7B, 0x50, 0xC0, 0x8A, 0x52, 0x53,
+0xC0, 0x08, 0x42, 0x53, 0xC1, 0x8E, 0x73, 0xF0, 0x7B, 0xBA, 0x78, 0xC0, 0x4A, 0x52, 0x60, 0xBF,
+0xC1, 0x0C, 0x63, 0xAF, 0x7B, 0x00, 0xC0, 0xAB, 0x5A, 0x73, 0xC1, 0x4A, 0x4A, 0xEC, 0x62, 0x6F,
+0xC0, 0x45, 0x29, 0x5B, 0x48, 0x6F, 0x53, 0xBF, 0x03, 0xAE, 0x00, 0x60, 0x67, 0x00, 0x60, 0x96,
+0x00, 0x60, 0x00, 0xAE, 0x60, 0x06, 0x58, 0x06, 0x4C, 0x44, 0x58, 0x95, 0xC1, 0x07, 0x32, 0xCA,
+0x4A, 0x95, 0x9A, 0xC0, 0x4B, 0x53, 0x81, 0xB6, 0xC0, 0x48, 0x32, 0x4F, 0xC0, 0x2C, 0x53, 0x5A,
+0x6E, 0xC0, 0xE7, 0x29, 0x00, 0xAE, 0xC0, 0x47, 0x32, 0x96, 0xA5, 0x00, 0xC2, 0x46, 0x32, 0xC3,
+0x21, 0x24, 0x2A, 0x00, 0x99, 0x9F, 0xC2, 0xE6, 0x22, 0x87, 0x2B, 0xE8, 0x2B, 0xAF, 0xC2, 0xA9,
+0x4B, 0x8E, 0xCC, 0x27, 0xD2, 0x6A, 0xC0, 0x00, 0xF8, 0xE0, 0x13, 0xAB, 0xC1, 0x61, 0xD0, 0x33,
+0xFD, 0x59, 0x79, 0xC2, 0xCE, 0x84, 0xCB, 0x5B, 0x4E, 0x6C, 0x9B, 0xC2, 0x2B, 0x43, 0xAA, 0x32,
+0x08, 0x22, 0xA6, 0x91, 0xAE, 0x4F, 0xC0, 0x29, 0x2A, 0xBE, 0x00, 0xBF, 0xA5, 0xC1, 0xE7, 0x31,
+0x28, 0x32, 0x01, 0xBE, 0x02, 0xA6, 0x67, 0x62, 0xC0, 0xA5, 0x29, 0xAF, 0x73, 0xC2, 0x44, 0x19,
+0x4C, 0x5B, 0xEA, 0x52, 0x74, 0xC1, 0xCC, 0x5A, 0xA7, 0x31, 0x60, 0x74, 0x60, 0x6C, 0xBF, 0x6C,
+0xBA, 0x60, 0x6F, 0x96, 0xC0, 0xA7, 0x39, 0x60, 0x7B, 0x67, 0x58, 0x60, 0x58, 0x60, 0x58, 0x60,
+0x67, 0x58, 0xA5, 0x6C, 0xC0, 0x87, 0x31, 0x58, 0x74, 0x7B, 0x67, 0x5B, 0x67, 0xA1, 0x47, 0x4C,
+0xC0, 0x66, 0x31, 0x00, 0x5B, 0x96, 0x5B, 0x53, 0x5B, 0x6F, 0x5B, 0xC0, 0x87, 0x39, 0x53, 0xBF,
+0x01, 0x67, 0x02, 0x60, 0x01, 0x5B, 0x58, 0x00, 0x60, 0x09, 0x58, 0x06, 0x5B, 0x44, 0xAE, 0x91,
+0x4E, 0xC0, 0xA9, 0x42, 0xAE, 0x00, 0xC0, 0x67, 0x32, 0x55, 0xA1, 0xC1, 0x89, 0x3A, 0x0B, 0x53,
+0x6E, 0xC0, 0xA6, 0x29, 0x4E, 0x95, 0xC0, 0x07, 0x32, 0x00, 0x44, 0x9B, 0x54, 0xAE, 0xA5, 0xC1,
+0x47, 0x2A, 0x87, 0x2A, 0x95, 0x91, 0x9E, 0xC2, 0x07, 0x1B, 0xC8, 0x2B, 0x08, 0x2C, 0xBF, 0xC2,
+0xA9, 0x53, 0x8F, 0xCC, 0x27, 0xD2, 0x6A, 0xC0, 0x00, 0xF8, 0xE0, 0x13, 0xAB, 0xC2, 0x82, 0xD8,
+0x33, 0xFD, 0x15, 0xDE, 0x79, 0xC1, 0xAE, 0x7C, 0xCB, 0x5B, 0x9B, 0xA2, 0xC0, 0xCA, 0x3A, 0x92,
+0xC0, 0x29, 0x2A, 0xAF, 0x63, 0x96, 0x63, 0xC0, 0x6A, 0x32, 0x00, 0xA1, 0xC1, 0x6A, 0x3A, 0xAB,
+0x42, 0xA1, 0x5F, 0x00, 0xAE, 0x01, 0xBA, 0x64, 0x00, 0x5F, 0xBA, 0x7F, 0xBE, 0xC0, 0x27, 0x32,
+0x53, 0xC1, 0xCE, 0x6B, 0x0B, 0x53, 0x60, 0x5C, 0x4C, 0x60, 0x6C, 0x91, 0xBF, 0x6C, 0x67, 0x00,
+0x91, 0x67, 0x6C, 0xA1, 0x91, 0x58, 0x91, 0x60, 0x67, 0x60, 0x5B, 0x58, 0x00, 0x5B, 0x44, 0x53,
+0xC0, 0x6A, 0x4A, 0x58, 0xC0, 0x87, 0x31, 0x53, 0x4C, 0x7F, 0xC1, 0x09, 0x4A, 0x4A, 0x52, 0x67,
+0x56, 0x5B, 0x7F, 0xA9, 0xC0, 0x29, 0x4A, 0x5B, 0x53, 0x47, 0x53, 0x5B, 0x56, 0x53, 0x67, 0x5B,
+0x06, 0x58, 0x00, 0x5B, 0x00, 0x60, 0x00, 0x58, 0x00, 0x60, 0x06, 0x58, 0x06, 0x67, 0x44, 0x78,
+0x95, 0xC1, 0x07, 0x3A, 0xAA, 0x4A, 0x80, 0xAE, 0xAF, 0xC0, 0x0B, 0x4B, 0x64, 0xC5, 0xC6, 0x21,
+0x07, 0x32, 0x89, 0x42, 0xCB, 0x4A, 0x69, 0x42, 0xC7, 0x31, 0xAE, 0x53, 0xAE, 0x97, 0x4F, 0x9A,
+0xA9, 0xC0, 0x47, 0x22, 0xAE, 0x95, 0xC4, 0xE5, 0x11, 0x26, 0x0A, 0xE7, 0x1A, 0xC8, 0x23, 0x29,
+0x2C, 0xBA, 0xC0, 0xC9, 0x53, 0x68, 0xC1, 0x27, 0xD2, 0x61, 0xE0, 0x5D, 0xE0, 0x13, 0xAB, 0xC5,
+0x82, 0xD8, 0x33, 0xFD, 0x14, 0xDE, 0x0F, 0x9D, 0x8D, 0x7C, 0x6A, 0x4B, 0xAB, 0xC2, 0xAD, 0x53,
+0x2C, 0x4B, 0xAA, 0x42, 0x4B, 0xAE, 0x00, 0xAE, 0xAF, 0xC0, 0xAA, 0x3A, 0xA5, 0xC0, 0x08, 0x2A,
+0x66, 0x7A, 0xA5, 0xAE, 0x02, 0x99, 0xA6, 0xA6, 0x00, 0xC0, 0x68, 0x3A, 0x7B, 0x50, 0xC0, 0xA5,
+0x21, 0x01, 0xC0, 0xEE, 0x6B, 0x46, 0x49, 0xC0, 0xCC, 0x5A, 0x5B, 0xAE, 0x67, 0x95, 0x67, 0x00,
+0x60, 0x00, 0x91, 0x5B, 0xC0, 0x29, 0x42, 0xBF, 0x67, 0x7B, 0x6C, 0x40, 0x60, 0x58, 0x60, 0xBF,
+0x6C, 0x40, 0x60, 0x00, 0x40, 0xA5, 0x58, 0x74, 0x67, 0x60, 0xC0, 0x8B, 0x5A, 0x95, 0xC0, 0xC8,
+0x39, 0xA1, 0x67, 0xA6, 0x91, 0x53, 0x00, 0x4E, 0x00, 0x53, 0xBA, 0x01, 0x53, 0x5B, 0x06, 0x53,
+0x58, 0x5B, 0x60, 0x01, 0x58, 0xA9, 0x60, 0x06, 0x58, 0x06, 0x6F, 0x5B, 0x4C, 0x95, 0xC1, 0x48,
+0x3A, 0x89, 0x42, 0x50, 0x78, 0xC0, 0x70, 0x74, 0xBE, 0xC0, 0x0F, 0x6C, 0x73, 0xC0, 0xC7, 0x29,
+0x47, 0xA6, 0xC1, 0xA7, 0x29, 0xE7, 0x31, 0xAF, 0xBE, 0x6E, 0x66, 0x57, 0x9A, 0x59, 0x90, 0xC0,
+0x26, 0x1A, 0x01, 0x9E, 0xC2, 0xC7, 0x1A, 0x88, 0x23, 0x09, 0x2C, 0x76, 0xC3, 0xC9, 0x53, 0x8F,
+0xCC, 0x27, 0xD2, 0x61, 0xE0, 0x5D, 0xE0, 0x13, 0xAB, 0xC7, 0x82, 0xD8, 0x32, 0xFD, 0xF4, 0xD5,
+0xEF, 0x9C, 0x6D, 0x74, 0x29, 0x43, 0xCD, 0x53, 0x32, 0x8D, 0xBB, 0xC1, 0x0F, 0x74, 0x68, 0x42,
+0x80, 0xA5, 0x95, 0xC1, 0x45, 0x32, 0xC8, 0x4A, 0x00, 0xC0, 0x07, 0x32, 0x4E, 0x66, 0x57, 0x47,
+0x44, 0xA6, 0x78, 0xA6, 0x95, 0x5F, 0xA9, 0x91, 0x67, 0x53, 0x9A, 0xA0, 0xC1, 0x64, 0x19, 0x0B,
+0x53, 0x62, 0x75, 0xC1, 0xCC, 0x5A, 0x09, 0x42, 0x01, 0x60, 0xBF, 0x6C, 0x60, 0x6C, 0x91, 0x01,
+0x6C, 0xC0, 0xC8, 0x39, 0x60, 0x53, 0x67, 0x60, 0x6C, 0x5B, 0x60, 0x58, 0xC0, 0x49, 0x4A, 0x67,
+0x4C, 0x60, 0x6C, 0x58, 0x74, 0x53, 0x4C, 0x56, 0x5B, 0x53, 0xA6, 0x5B, 0x56, 0x4E, 0x56, 0xAF,
+0x56, 0x5B, 0x00, 0x4E, 0x53, 0x62, 0x00, 0x5B, 0x06, 0x4C, 0x53, 0x5B, 0x60, 0x01, 0x95, 0x4C,
+0x60, 0x06, 0x58, 0x06, 0x4C, 0x60, 0x00, 0x81, 0xC0, 0x28, 0x3A, 0x95, 0x91, 0xC0, 0x0B, 0x4B,
+0x95, 0xC2, 0x47, 0x32, 0x4C, 0x53, 0xEB, 0x4A, 0x5A, 0x00, 0xC1, 0xA6, 0x29, 0x6A, 0x3A, 0x57,
+0x66, 0x00, 0x91, 0xA6, 0x57, 0xBD, 0x55, 0x94, 0xAE, 0xBF, 0x9F, 0x9E, 0x6D, 0xC1, 0xA8, 0x23,
+0x2A, 0x2C, 0xBA, 0xC4, 0xA9, 0x53, 0x8E, 0xCC, 0x07, 0xD2, 0x41, 0xD8, 0x00, 0xF8, 0xE0, 0x14,
+0xC7, 0x82, 0xD8, 0x94, 0xFD, 0xF4, 0xD5, 0x10, 0x9D, 0x4D, 0x6C, 0x6B, 0x43, 0xCD, 0x53, 0xF2,
+0x84, 0xB4, 0xC1, 0x4A, 0x63, 0x65, 0x4A, 0xA9, 0xC1, 0x67, 0x6B, 0x0D, 0x9D, 0xA5, 0xC4, 0xC9,
+0x7B, 0xA5, 0x52, 0xA2, 0x31, 0x47, 0x42, 0xCA, 0x4A, 0x5A, 0x4B, 0xC0, 0x69, 0x32, 0x64, 0x91,
+0xBF, 0x99, 0xA1, 0xBF, 0x91, 0xC0, 0x68, 0x3A, 0x7B, 0xC0, 0x85, 0x21, 0x95, 0xA5, 0x7F, 0xC2,
+0xC2, 0x08, 0xE8, 0x39, 0xCC, 0x5A, 0x58, 0x00, 0xC0, 0x29, 0x42, 0x67, 0x6C, 0x58, 0x67, 0x00,
+0xA9, 0x02, 0x67, 0x00, 0xA5, 0x00, 0x60, 0x00, 0x67, 0x00, 0x6C, 0x00, 0x60, 0x00, 0xC0, 0x49,
+0x4A, 0x6C, 0x01, 0x4C, 0x60, 0x67, 0xC0, 0x8B, 0x5A, 0x81, 0xC3, 0x87, 0x31, 0xC8, 0x41, 0x2A,
+0x4A, 0xC8, 0x39, 0x00, 0x56, 0x53, 0x56, 0x00, 0xC0, 0x6B, 0x52, 0xA5, 0x67, 0x4C, 0x5B, 0x80,
+0x60, 0xC0, 0x69, 0x4A, 0x74, 0x60, 0x4C, 0x00, 0xAE, 0x7D, 0x67, 0x43, 0x58, 0x4C, 0x6C, 0x00,
+0x58, 0x00, 0x5B, 0x60, 0x00, 0x5B, 0x58, 0x00, 0x5B, 0x60, 0x67, 0x60, 0x58, 0x53, 0x00, 0x58,
+0x4E, 0x53, 0x00, 0x9D, 0x00, 0xAE, 0xC1, 0xCA, 0x42, 0xCE, 0x63, 0x64, 0x69, 0x4C, 0x00, 0x5F,
+0x4B, 0x46, 0xAF, 0x9A, 0xC0, 0x2A, 0x2A, 0xA5, 0xC0, 0x49, 0x32, 0xB9, 0xA5, 0xAD, 0xC2, 0xC3,
+0x29, 0x24, 0x32, 0x65, 0x3A, 0x9A, 0xC3, 0xC3, 0x19, 0x24, 0x1A, 0x68, 0x33, 0xA9, 0x2B, 0x9E,
+0x00, 0xC4, 0x47, 0x43, 0x8F, 0xCC, 0xE6, 0xC9, 0x61, 0xE0, 0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x5D,
+0x00, 0x73, 0xCB, 0x94, 0xFD, 0xD4, 0xD5, 0x0F, 0x9D, 0x2C, 0x6C, 0x2A, 0x3B, 0x8C, 0x43, 0x6B,
+0x53, 0x86, 0x4A, 0xE6, 0x62, 0xED, 0xAC, 0x72, 0xDE, 0x95, 0xFF, 0xA9, 0xAF, 0xC5, 0x33, 0xEF,
+0x92, 0xDE, 0xAD, 0x9C, 0xA6, 0x52, 0xE5, 0x31, 0x89, 0x42, 0x81, 0xC0, 0x8A, 0x3A, 0xA5, 0xC0,
+0x08, 0x2A, 0xA9, 0xBF, 0x00, 0x50, 0x44, 0xC1, 0x2B, 0x53, 0xCE, 0x6B, 0x7B, 0xC0, 0x44, 0x19,
+0x6F, 0xC4, 0x06, 0x32, 0x64, 0x21, 0xA7, 0x31, 0xCB, 0x5A, 0xE8, 0x39, 0xBE, 0x6C, 0xA6, 0x6C,
+0x58, 0x6C, 0x67, 0x60, 0x01, 0x67, 0x01, 0x6C, 0x01, 0x67, 0x00, 0x60, 0x01, 0x74, 0x6C, 0x67,
+0x91, 0x60, 0x00, 0x58, 0x5C, 0xC1, 0x93, 0x94, 0x11, 0x84, 0x00, 0xC2, 0xED, 0x62, 0x09, 0x4A,
+0x6F, 0x73, 0xAE, 0x53, 0x76, 0xC0, 0x2E, 0x6B, 0x76, 0x00, 0x5A, 0xC1, 0xB0, 0x7B, 0x31, 0x8C,
+0x63, 0xC3, 0xC7, 0x39, 0x8A, 0x52, 0x6E, 0x6B, 0xEF, 0x7B, 0xA6, 0xC1, 0xEC, 0x5A, 0x29, 0x42,
+0x68, 0xC2, 0x8E, 0x73, 0xE8, 0x39, 0x6A, 0x4A, 0x50, 0x48, 0x53, 0x60, 0x58, 0x53, 0x01, 0x58,
+0x00, 0x53, 0x01, 0xA5, 0x44, 0x47, 0x58, 0x6C, 0x00, 0x60, 0x53, 0x47, 0x67, 0xC0, 0x87, 0x31,
+0x85, 0xC1, 0x6A, 0x42, 0x4C, 0x5B, 0x81, 0x00, 0xBE, 0xC0, 0xCA, 0x42, 0xA6, 0xC2, 0xA6, 0x21,
+0x45, 0x19, 0x08, 0x32, 0xA6, 0x52, 0xC1, 0x29, 0x22, 0xC8, 0x19, 0xBE, 0xB9, 0xC4, 0x84, 0x29,
+0xE3, 0x39, 0x47, 0x63, 0x8B, 0x8C, 0xD1, 0xB5, 0x95, 0xC2, 0x4E, 0x9D, 0xE9, 0x6B, 0xC4, 0x32,
+0x81, 0xC1, 0xE6, 0x1A, 0xC9, 0x2B, 0x99, 0xC4, 0x27, 0x43, 0x8E, 0xCC, 0xE6, 0xC9, 0x61, 0xE0,
+0x00, 0xF8, 0xE0, 0x11, 0x62, 0x5D, 0x00, 0xC5, 0x82, 0xD8, 0x94, 0xFD, 0xD4, 0xD5, 0x0F, 0x9D,
+0x2C, 0x6C, 0x2A, 0x3B, 0xAF, 0xC3, 0x6A, 0x5B, 0x89, 0x73, 0x4E, 0xB5, 0x14, 0xFF, 0x99, 0x90,
+0x90, 0xC0, 0xD0, 0xEE, 0xBF, 0xC0, 0x74, 0xFF, 0x92, 0xC2, 0x0E, 0xA5, 0xC7, 0x52, 0x67, 0x42,
+0x82, 0x6B, 0xC0, 0x89, 0x3A, 0xA6, 0xC0, 0x07, 0x2A, 0xA1, 0x91, 0x91, 0x7B, 0xC6, 0xCA, 0x4A,
+0x8D, 0x63, 0x0B, 0x53, 0xA5, 0x21, 0xC2, 0x08, 0x68, 0x42, 0xC6, 0x31, 0x92, 0xC1, 0xAB, 0x52,
+0xE8, 0x39, 0x6C, 0xBA, 0x95, 0x6C, 0x60, 0x6C, 0xA6, 0x58, 0xBA, 0x67, 0x6C, 0x67, 0x60, 0x6C,
+0x02, 0x67, 0x00, 0x60, 0x00, 0x6F, 0x6C, 0x60, 0x91, 0x60, 0x58, 0x00, 0xC3, 0x8F, 0x73, 0x10,
+0x84, 0x6E, 0x73, 0x52, 0x8C, 0x53, 0x56, 0xC2, 0x11, 0x8C, 0xB3, 0x9C, 0x6A, 0x52, 0x56, 0xC0,
+0xCF, 0x7B, 0x43, 0xC3, 0xCC, 0x62, 0xF0, 0x83, 0x2D, 0x6B, 0x72, 0x94, 0x6C, 0xC3, 0xA7, 0x39,
+0xAE, 0x73, 0x51, 0x8C, 0x6D, 0x6B, 0x40, 0x00, 0xC0, 0xAA, 0x52, 0xBF, 0xC2, 0x71, 0x8C, 0x2D,
+0x63, 0xD0, 0x7B, 0x54, 0x48, 0xC0, 0x87, 0x31, 0x60, 0x58, 0x02, 0xA6, 0x00, 0x58, 0x01, 0xC0,
+0x29, 0x42, 0x60, 0x00, 0xC1, 0x6A, 0x4A, 0xEC, 0x5A, 0xBE, 0xC0, 0xAB, 0x52, 0x6C, 0x53, 0x00,
+0xC2, 0x66, 0x29, 0xA7, 0x29, 0x69, 0x42, 0x9A, 0xC0, 0xC6, 0x29, 0x9A, 0xAE, 0xC1, 0x85, 0x19,
+0xE7, 0x29, 0x91, 0xC4, 0x0C, 0x53, 0x35, 0x95, 0xCF, 0x6B, 0xA7, 0x21, 0x08, 0x22, 0xAE, 0x50,
+0xC4, 0x22, 0x21, 0x44, 0x4A, 0xEC, 0xA4, 0xB2, 0xDE, 0xF7, 0xFF, 0xA2, 0xA9, 0x00, 0xCA, 0xF2,
+0xDE, 0x6C, 0x9D, 0x07, 0x64, 0x45, 0x3B, 0x25, 0x23, 0x87, 0x23, 0x06, 0x3B, 0x6E, 0xC4, 0xC6,
+0xC1, 0x61, 0xE0, 0x00, 0xF8, 0xE0, 0x14, 0xC0, 0x61, 0xD0, 0x45, 0xC7, 0xF4, 0xD5, 0x30, 0xA5,
+0x6D, 0x74, 0x6B, 0x43, 0xE9, 0x32, 0x0B, 0x74, 0xF1, 0xBD, 0x14, 0xF7, 0xB5, 0xC2, 0xEE, 0xD5,
+0x8D, 0xCD, 0x0E, 0xD6, 0xBE, 0xA5, 0x00, 0xC4, 0x13, 0xF7, 0x35, 0xF7, 0x2E, 0xAD, 0x04, 0x3A,
+0x68, 0x3A, 0x92, 0xC0, 0xC7, 0x21, 0xA1, 0x4B, 0xC1, 0x8A, 0x42, 0x2B, 0x53, 0xBF, 0x00, 0xC0,
+0x44, 0x19, 0x00, 0xC0, 0x48, 0x3A, 0x7F, 0xC6, 0x64, 0x21, 0xCE, 0x6B, 0x2C, 0x5B, 0x86, 0x31,
+0xAB, 0x52, 0xE8, 0x39, 0x29, 0x42, 0x00, 0x58, 0xBF, 0x00, 0x6C, 0xA5, 0x58, 0x00, 0x67, 0x6C,
+0x67, 0x60, 0x67, 0x01, 0x6C, 0x01, 0xBA, 0x00, 0x58, 0x67, 0x00, 0x60, 0x40, 0x58, 0x00, 0xC1,
+0xF0, 0x7B, 0x8F, 0x7B, 0x99, 0x63, 0x62, 0xC0, 0xE8, 0x41, 0x7B, 0xC1, 0xD3, 0x9C, 0x10, 0x84,
+0x6F, 0xC2, 0x11, 0x8C, 0xAB, 0x5A, 0x4E, 0x6B, 0x63, 0xC1, 0x2D, 0x6B, 0x52, 0x8C, 0xA9, 0x4C,
+0xC2, 0xCE, 0x7B, 0x50, 0x8C, 0x2C, 0x63, 0x71, 0xC1, 0x30, 0x84, 0x49, 0x4A, 0x4C, 0x75, 0x54,
+0xC0, 0x93, 0x94, 0x4B, 0xC0, 0xE8, 0x39, 0x4C, 0x67, 0x60, 0x6C, 0x67, 0x60, 0x02, 0x67, 0x6C,
+0x00, 0x58, 0x00, 0x6C, 0xC0, 0x8B, 0x52, 0x00, 0x6C, 0x4C, 0xBB, 0x81, 0x00, 0xC1, 0xC7, 0x31,
+0x08, 0x32, 0x72, 0xC0, 0x50, 0x74, 0x00, 0x95, 0xAB, 0xBF, 0xA5, 0xC9, 0xF8, 0xAD, 0xFF, 0xF7,
+0xDB, 0xCE, 0x2D, 0x53, 0x86, 0x19, 0x47, 0x2A, 0xC4, 0x29, 0x03, 0x42, 0xEC, 0xAC, 0x54, 0xF7,
+0xA1, 0x91, 0xC0, 0x51, 0xDE, 0x00, 0xC1, 0xB1, 0xE6, 0x32, 0xF7, 0x89, 0xC7, 0x8F, 0xC6, 0xEA,
+0x7C, 0xC2, 0x22, 0x66, 0x23, 0x06, 0x3B, 0x4E, 0xC4, 0xC5, 0xC1, 0x41, 0xD8, 0x5D, 0x00, 0xAE,
+0x5D, 0xE0, 0x11, 0xC2, 0x82, 0xD8, 0x94, 0xFD, 0xF4, 0xD5, 0x79, 0xC8, 0x4D, 0x74, 0x09, 0x3B,
+0xA7, 0x32, 0xEE, 0x8C, 0xD4, 0xE6, 0x71, 0xE6, 0x10, 0xDE, 0xB3, 0xEE, 0x76, 0xFF, 0xAF, 0xA0,
+0xC1, 0xF2, 0xF6, 0x8D, 0xCD, 0x90, 0xC3, 0xD1, 0xEE, 0x13, 0xEF, 0x26, 0x63, 0x06, 0x32, 0x97,
+0xA6, 0xCF, 0xAA, 0x4A, 0xD3, 0x8C, 0x9A, 0xC6, 0x7D, 0xDF, 0xBE, 0xEF, 0xFB, 0xD6, 0x71, 0x84,
+0x6D, 0x63, 0x0F, 0x7C, 0xCA, 0x4A, 0x85, 0x21, 0xCE, 0x73, 0x2C, 0x63, 0xC7, 0x39, 0xCB, 0x5A,
+0xE8, 0x39, 0x60, 0x00, 0x4C, 0xBF, 0xC0, 0x29, 0x42, 0x00, 0xA6, 0x5B, 0x00, 0x60, 0x67, 0x00,
+0x60, 0x67, 0x01, 0x6C, 0x01, 0xBA, 0x00, 0xC0, 0xC8, 0x39, 0x60, 0x67, 0x6C, 0xC0, 0x6A, 0x52,
+0x58, 0x00, 0x7B, 0xC0, 0xB3, 0x9C, 0x7B, 0xC1, 0x52, 0x8C, 0xAF, 0x7B, 0x6F, 0xC0, 0x8E, 0x73,
+0x7B, 0xC2, 0x92, 0x94, 0x6E, 0x73, 0x51, 0x8C, 0x43, 0x5C, 0x77, 0x40, 0x01, 0x60, 0x75, 0xC1,
+0x70, 0x8C, 0x0F, 0x84, 0x4D, 0xC0, 0xCE, 0x7B, 0x4C, 0x00, 0x60, 0x68, 0x78, 0x4C, 0xAB, 0x43,
+0xC0, 0x09, 0x42, 0x95, 0x6C, 0x67, 0x60, 0x02, 0x67, 0x6C, 0x53, 0x4C, 0xA6, 0x53, 0x58, 0x00,
+0x4C, 0x92, 0x53, 0xBF, 0x58, 0xC3, 0x45, 0x21, 0x08, 0x32, 0x75, 0xA5, 0xFF, 0xF7, 0x9A, 0x99,
+0x6B, 0x00, 0xC0, 0x9D, 0xDF, 0xBB, 0x6E, 0x00, 0xC0, 0xF8, 0xB5, 0x4B, 0xC2, 0x64, 0x21, 0x61,
+0x29, 0x29, 0x8C, 0x74, 0xB5, 0xC0, 0x30, 0xDE, 0xAF, 0xC0, 0x93, 0xEE, 0x95, 0xC0, 0xCE, 0xD5,
+0xAC, 0xC8, 0x6D, 0xDE, 0x50, 0xEF, 0xAF, 0xCE, 0xC5, 0x53, 0x65, 0x2B, 0xE6, 0x3A, 0x4E, 0xC4,
+0xC5, 0xC1, 0x41, 0xD8, 0x5D, 0x00, 0xAE, 0x5D, 0xE0, 0x11, 0x73, 0xC7, 0x94, 0xFD, 0xD3, 0xD5,
+0xEF, 0x9C, 0x0B, 0x6C, 0xC7, 0x32, 0x08, 0x43, 0xD0, 0xB5, 0x34, 0xEF, 0x76, 0x60, 0xC1, 0xB9,
+0xFF, 0xFB, 0xFF, 0xA2, 0xA0, 0xA8, 0xC1, 0x92, 0xEE, 0x0A, 0xBD, 0xAE, 0xC3, 0x93, 0xFF, 0x2C,
+0xA5, 0x26, 0x3A, 0x45, 0x19, 0x4A, 0xC0, 0x18, 0xB6, 0x6E, 0xC3, 0x7D, 0xE7, 0xDA, 0xCE, 0x5C,
+0xDF, 0xFF, 0xFF, 0x81, 0xC0, 0xFB, 0xD6, 0x00, 0xC4, 0x33, 0x9D, 0x48, 0x42, 0x6C, 0x63, 0x69,
+0x4A, 0xE8, 0x39, 0x5C, 0x4C, 0xBF, 0xAE, 0xC0, 0xA7, 0x31, 0x58, 0x6C, 0x67, 0x00, 0x60, 0x02,
+0x67, 0x00, 0x6C, 0x02, 0x67, 0x00, 0x60, 0x04, 0xC1, 0x49, 0x4A, 0xC8, 0x39, 0x5B, 0xC1, 0xD0,
+0x7B, 0x72, 0x94, 0x5C, 0xC3, 0x2D, 0x6B, 0x8E, 0x73, 0x49, 0x52, 0xAF, 0x7B, 0x7F, 0xAE, 0xC1,
+0xB3, 0x9C, 0x10, 0x8C, 0x6F, 0xC7, 0x8A, 0x52, 0x51, 0x8C, 0x0C, 0x63, 0xAB, 0x5A, 0x10, 0x84,
+0x48, 0x4A, 0x4C, 0x63, 0x50, 0x8C, 0x7A, 0xBE, 0xC0, 0x0F, 0x84, 0x48, 0xC2, 0xE7, 0x39, 0xEB,
+0x5A, 0xB3, 0x94, 0x78, 0xC1, 0x09, 0x42, 0x6A, 0x4A, 0xBA, 0x53, 0x60, 0x5B, 0x9A, 0x04, 0x5B,
+0x60, 0x04, 0x67, 0x00, 0xC0, 0x87, 0x31, 0xAE, 0x00, 0x91, 0x49, 0xC2, 0xCF, 0x6B, 0xF7, 0xAD,
+0xFA, 0xC6, 0xBB, 0x81, 0xC0, 0x18, 0xAE, 0xBE, 0xCB, 0x55, 0x9D, 0xF4, 0x8C, 0x96, 0xA5, 0x72,
+0x84, 0x08, 0x3A, 0x22, 0x21, 0x64, 0x52, 0x0F, 0xCE, 0x12, 0xF7, 0x70, 0xDE, 0x55, 0xF7, 0xFA,
+0xFF, 0x00, 0xA9, 0xCB, 0xF3, 0xFE, 0x0E, 0xDE, 0x6A, 0xC5, 0x8D, 0xE6, 0x71, 0xF7, 0x4A, 0x95,
+0x65, 0x2B, 0xE6, 0x3A, 0x4E, 0xC4, 0xC5, 0xC1, 0x41, 0xD8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0,
+0x11, 0xC0, 0xA2, 0xD8, 0x45, 0xC6, 0xD3, 0xD5, 0xCE, 0x94, 0xCA, 0x63, 0x08, 0x43, 0x48, 0x53,
+0x8F, 0xAD, 0xD3, 0xE6, 0xA1, 0xC2, 0x77, 0xFF, 0xFC, 0xFF, 0x7C, 0xF7, 0xAF, 0xBE, 0xC8, 0x99,
+0xFF, 0xD8, 0xFF, 0x4F, 0xE6, 0x87, 0xAC, 0x30, 0xF7, 0x2F, 0xCE, 0xE9, 0x5A, 0x65, 0x21, 0xCF,
+0x6B, 0x52, 0xC9, 0xBA, 0xCE, 0x4D, 0x63, 0x69, 0x42, 0x6D, 0x63, 0x99, 0xCE, 0x1B, 0xDF, 0x34,
+0x9D, 0x95, 0xAD, 0x79, 0xCE, 0xAE, 0x73, 0x7A, 0xC4, 0x69, 0x4A, 0xE8, 0x39, 0xAB, 0x52, 0xA7,
+0x31, 0xE8, 0x41, 0x6C, 0x4C, 0x58, 0xBF, 0x60, 0x67, 0x6C, 0x67, 0x58, 0x00, 0x60, 0x6C, 0x02,
+0x67, 0x00, 0x60, 0x01, 0x6C, 0x58, 0x60, 0x00, 0x67, 0x58, 0x60, 0xC9, 0x6E, 0x6B, 0xF0, 0x83,
+0x8A, 0x52, 0x2C, 0x6B, 0x8E, 0x73, 0x49, 0x4A, 0x10, 0x84, 0x0C, 0x63, 0x28, 0x4A, 0x92, 0x94,
+0x00, 0xC3, 0xAA, 0x5A, 0xEB, 0x62, 0x30, 0x8C, 0x8A, 0x52, 0x50, 0xC5, 0x51, 0x8C, 0x28, 0x4A,
+0x4C, 0x6B, 0x30, 0x84, 0x89, 0x52, 0xCA, 0x52, 0x45, 0xC1, 0xCB, 0x5A, 0x07, 0x42, 0x40, 0x91,
+0x00, 0x58, 0xC1, 0xAB, 0x52, 0xE8, 0x39, 0x00, 0xC0, 0x29, 0x42, 0x58, 0x06, 0x5B, 0x58, 0xA6,
+0x58, 0x00, 0x60, 0x5B, 0x58, 0xC0, 0x2A, 0x4A, 0x7F, 0x53, 0xC1, 0x09, 0x3A, 0x86, 0x21, 0xAE,
+0xC3, 0xCA, 0x42, 0x8D, 0x5B, 0xCE, 0x63, 0x6C, 0x53, 0x48, 0xC4, 0x71, 0x7C, 0xF0, 0x6B, 0x2D,
+0x5B, 0xCC, 0x52, 0x26, 0x19, 0xBA, 0xC2, 0x23, 0x21, 0x2A, 0x8C, 0xF3, 0xE6, 0xA0, 0xC0, 0xD3,
+0xE6, 0x55, 0xA3, 0x00, 0xAE, 0xC8, 0x57, 0xFF, 0xD3, 0xF6, 0x4B, 0xC5, 0x8A, 0xC5, 0x0F, 0xEF,
+0xCC, 0xAD, 0x65, 0x2B, 0x06, 0x3B, 0x6E, 0xC4, 0x71, 0xC1, 0x41, 0xD8, 0x00, 0xF8, 0xE0, 0x14,
+0xC5, 0xA2, 0xD8, 0xB4, 0xFD, 0xD4, 0xCD, 0xCF, 0x94, 0xEA, 0x6B, 0xE6, 0x42, 0xA5, 0xC3, 0xEC,
+0x9C, 0xB2, 0xE6, 0x14, 0xF7, 0x98, 0xFF, 0x52, 0xC0, 0x7E, 0xEF, 0xAB, 0xC9, 0xFF, 0xFF, 0x5A,
+0xF7, 0xB8, 0xFF, 0xD1, 0xF6, 0x45, 0xA4, 0xAE, 0xEE, 0x70, 0xD6, 0x46, 0x42, 0x66, 0x21, 0xF4,
+0x94, 0x71, 0xC1, 0x34, 0x9D, 0x65, 0x21, 0xBF, 0xC7, 0xCB, 0x52, 0x5D, 0xE7, 0x59, 0xC6, 0xA6,
+0x29, 0x48, 0x42, 0x78, 0xC6, 0xB1, 0x8C, 0x8D, 0x6B, 0x61, 0xC0, 0xC7, 0x39, 0x43, 0x7F, 0xC0,
+0x08, 0x42, 0x74, 0xC0, 0xE8, 0x39, 0xBA, 0xAF, 0x58, 0x67, 0xAE, 0x67, 0x58, 0x00, 0x60, 0xBF,
+0x5B, 0x00, 0x60, 0x00, 0x67, 0x00, 0x6C, 0x01, 0xC0, 0xC8, 0x39, 0x67, 0x6C, 0x00, 0x5B, 0x60,
+0xC8, 0xEC, 0x5A, 0x51, 0x8C, 0x4D, 0x6B, 0xAF, 0x7B, 0x2C, 0x63, 0x66, 0x31, 0xCF, 0x7B, 0xEC,
+0x62, 0x28, 0x42, 0x70, 0xC1, 0xB3, 0x9C, 0xAB, 0x5A, 0x60, 0xC0, 0xCF, 0x83, 0x6C, 0x7B, 0xC0,
+0x6D, 0x6B, 0x4C, 0xC0, 0x89, 0x52, 0x4D, 0x40, 0x95, 0x44, 0xC2, 0xA6, 0x31, 0x8A, 0x52, 0x30,
+0x84, 0x60, 0xC4, 0xAB, 0x52, 0xF0, 0x7B, 0x8B, 0x52, 0xA7, 0x31, 0x29, 0x4A, 0x58, 0x5B, 0x60,
+0x00, 0xAB, 0x00, 0x60, 0x00, 0x5B, 0x67, 0x58, 0x4C, 0x53, 0x5B, 0x60, 0x53, 0x7F, 0x67, 0xC1,
+0x67, 0x29, 0xA8, 0x31, 0x44, 0xAE, 0xC6, 0x30, 0x7C, 0xB6, 0xA5, 0x91, 0x7C, 0x24, 0x11, 0xCA,
+0x42, 0xF7, 0xAD, 0xFF, 0xF7, 0x00, 0xC6, 0x5D, 0xDF, 0x15, 0x95, 0x09, 0x32, 0x46, 0x21, 0x43,
+0x29, 0x8C, 0x9C, 0xF2, 0xE6, 0xBF, 0xC1, 0xD8, 0xFF, 0xFD, 0xFF, 0x93, 0xC0, 0xFF, 0xFF, 0xA0,
+0xC0, 0x78, 0xFF, 0xAD, 0xC9, 0xCD, 0xD5, 0x09, 0xBD, 0xAE, 0xEE, 0xEC, 0xB5, 0x65, 0x33, 0x06,
+0x3B, 0x6E, 0xC4, 0xC6, 0xC1, 0x61, 0xE0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x5D, 0xC9, 0xA2, 0xD8,
+0xF5, 0xFD, 0x14, 0xD6, 0xEF, 0x94, 0x0B, 0x6C, 0x85, 0x32, 0xE5, 0x42, 0xEC, 0x94, 0xD3, 0xE6,
+0x14, 0xF7, 0x6C, 0x63, 0xC1, 0x9E, 0xEF, 0xDF, 0xF7, 0x00, 0xC4, 0x5A, 0xEF, 0xB9, 0xFF, 0x71,
+0xE6, 0x67, 0xAC, 0x6E, 0xE6, 0x83, 0xC3, 0x26, 0x42, 0x66, 0x29, 0x4D, 0x63, 0xFC, 0xDE, 0x71,
+0xC2, 0x38, 0xC6, 0xB6, 0xAD, 0xFB, 0xDE, 0x71, 0xC6, 0x34, 0xA5, 0xCA, 0x52, 0x75, 0xAD, 0x1B,
+0xDF, 0xB1, 0x8C, 0xAD, 0x6B, 0x2C, 0x63, 0x49, 0xC2, 0x49, 0x4A, 0xE8, 0x39, 0x29, 0x42, 0xA6,
+0x58, 0x00, 0x67, 0xA5, 0x60, 0x01, 0x67, 0x01, 0x6C, 0x60, 0xC0, 0x4A, 0x4A, 0x6C, 0x03, 0x60,
+0x67, 0x6C, 0x00, 0x60, 0x58, 0x60, 0x00, 0x44, 0x7B, 0xC1, 0xCB, 0x5A, 0x6A, 0x4A, 0x58, 0x67,
+0x74, 0x60, 0x00, 0x5B, 0xC0, 0x69, 0x4A, 0x58, 0x00, 0x40, 0xC0, 0xEB, 0x5A, 0x6B, 0x58, 0x5B,
+0x96, 0x43, 0xC0, 0xEC, 0x5A, 0x40, 0x58, 0x00, 0x6C, 0x67, 0xC0, 0xA8, 0x39, 0x00, 0xC0, 0x2A,
+0x42, 0x7B, 0x67, 0x53, 0x5B, 0x6C, 0x58, 0x01, 0xA9, 0x60, 0x67, 0x5B, 0x58, 0x60, 0x5B, 0x53,
+0x58, 0x67, 0x00, 0x53, 0x00, 0x44, 0x53, 0x81, 0x44, 0xD1, 0xF7, 0xB5, 0xFF, 0xF7, 0xF3, 0x94,
+0xEB, 0x4A, 0x95, 0xA5, 0x1C, 0xD7, 0xBA, 0xC6, 0x38, 0xAE, 0x79, 0xB6, 0x9F, 0xDF, 0x56, 0x9D,
+0x45, 0x21, 0x63, 0x31, 0x8B, 0xA4, 0xF2, 0xEE, 0x55, 0xFF, 0xD9, 0xFF, 0xFE, 0xFF, 0x71, 0x6E,
+0xA4, 0xC6, 0xB9, 0xF7, 0x96, 0xFF, 0x4F, 0xE6, 0x29, 0xC5, 0x8E, 0xF6, 0xAC, 0xBD, 0xA6, 0x43,
+0x59, 0xC2, 0x8F, 0xCC, 0x85, 0xC1, 0x61, 0xE0, 0x5D, 0xE0, 0x14, 0xC5, 0x82, 0xD0, 0xF5, 0xFD,
+0x34, 0xD6, 0x0F, 0x95, 0x4C, 0x6C, 0x07, 0x3B, 0xA9, 0xC4, 0xCB, 0x8C, 0xB2, 0xDE, 0xF4, 0xF6,
+0x37, 0xFF, 0xDC, 0xFF, 0x97, 0x96, 0xAE, 0xC7, 0xBB, 0xFF, 0x97, 0xFF, 0x2F, 0xDE, 0x4A, 0xC5,
+0x11, 0xFF, 0xAE, 0xCD, 0xE5, 0x41, 0x66, 0x29, 0x49, 0xC2, 0xF0, 0x7B, 0x79, 0xC6, 0xBE, 0xF7,
+0x00, 0xC0, 0x5D, 0xE7, 0x55, 0x00, 0xC1, 0x50, 0x84, 0xD2, 0x94, 0x9A, 0xC0, 0x2B, 0x5B, 0x91,
+0x91, 0xC0, 0xC7, 0x39, 0x7B, 0xC0, 0xC8, 0x39, 0xBE, 0x9A, 0x00, 0xBF, 0x74, 0x91, 0x02, 0x67,
+0x02, 0x4C, 0x60, 0xAF, 0x60, 0x58, 0x00, 0x60, 0x6C, 0xC0, 0x6A, 0x4A, 0x74, 0x7B, 0x74, 0x6C,
+0x74, 0x00, 0x58, 0x00, 0x6C, 0x5B, 0x58, 0x60, 0x5B, 0x4C, 0x5B, 0x44, 0x6C, 0x58, 0x4C, 0x58,
+0x60, 0x74, 0x44, 0x58, 0x53, 0xBF, 0x53, 0x92, 0x53, 0x67, 0x53, 0x96, 0x44, 0x4B, 0x53, 0xAB,
+0x53, 0x01, 0x60, 0x00, 0x51, 0x03, 0x58, 0x60, 0x67, 0x60, 0x58, 0x53, 0x5B, 0x58, 0xA1, 0x4B,
+0x44, 0x7C, 0x70, 0xCA, 0x8A, 0x4A, 0xDB, 0xD6, 0x9E, 0xEF, 0x4D, 0x5B, 0x30, 0x7C, 0xDB, 0xCE,
+0x59, 0xBE, 0xAA, 0x42, 0xC3, 0x00, 0xCB, 0x42, 0x1C, 0xCF, 0x00, 0xC0, 0x69, 0x42, 0x5E, 0xC1,
+0x4A, 0x94, 0x33, 0xF7, 0x52, 0xC3, 0xD9, 0xFF, 0xFD, 0xFF, 0x7D, 0xEF, 0xFF, 0xF7, 0xB9, 0xC4,
+0xFA, 0xFF, 0x54, 0xF7, 0x0D, 0xDE, 0x69, 0xCD, 0xAF, 0xFE, 0x7A, 0xC5, 0x66, 0x43, 0x85, 0x32,
+0x8F, 0xD4, 0xA5, 0xC1, 0x42, 0xE0, 0x00, 0xF8, 0xE0, 0x13, 0x9A, 0xC5, 0x81, 0xD0, 0xD5, 0xFD,
+0x34, 0xD6, 0x2F, 0x9D, 0x6C, 0x74, 0x27, 0x3B, 0x91, 0xC4, 0x49, 0x7C, 0x51, 0xCE, 0x14, 0xF7,
+0x77, 0xFF, 0xFB, 0xFF, 0xAB, 0x00, 0xA0, 0xAC, 0x7E, 0xC6, 0xEE, 0xD5, 0x6F, 0xEE, 0x33, 0xFF,
+0x6A, 0x9C, 0xE5, 0x39, 0xE7, 0x31, 0x65, 0x21, 0x92, 0xC1, 0x49, 0x42, 0xCF, 0x73, 0xAE, 0xC2,
+0xEB, 0x5A, 0x28, 0x3A, 0x4C, 0x63, 0x91, 0xC1, 0x68, 0x42, 0xE6, 0x31, 0x91, 0xC1, 0x07, 0x32,
+0x65, 0x21, 0x4C, 0xC1, 0x6A, 0x52, 0xE8, 0x41, 0x00, 0x96, 0x58, 0x5B, 0x60, 0x03, 0xAB, 0x02,
+0xAE, 0x58, 0x67, 0x5B, 0x60, 0x74, 0x60, 0x6C, 0x00, 0x60, 0x00, 0x6C, 0x00, 0x74, 0xA6, 0x4C,
+0x58, 0x53, 0x4C, 0x58, 0x60, 0x4C, 0x96, 0x5B, 0x44, 0x60, 0x58, 0x4C, 0x44, 0x00, 0x53, 0x90,
+0xAB, 0x53, 0x58, 0x53, 0x7F, 0x53, 0x58, 0x7F, 0x53, 0x58, 0xAB, 0x58, 0x53, 0x58, 0xBB, 0x58,
+0x4C, 0x51, 0x00, 0x4C, 0x01, 0x60, 0x6C, 0x58, 0x60, 0x00, 0x58, 0x53, 0x58, 0x53, 0xA5, 0x4B,
+0x53, 0x44, 0x70, 0xC3, 0x6A, 0x42, 0x7A, 0xCE, 0xFF, 0xFF, 0xF7, 0xB5, 0xAF, 0xCB, 0xFF, 0xF7,
+0xBA, 0xC6, 0x4C, 0x53, 0x6A, 0x3A, 0xB2, 0x7C, 0xDF, 0xE7, 0x3C, 0xD7, 0x28, 0x3A, 0x01, 0x19,
+0x68, 0x73, 0xF3, 0xEE, 0x75, 0xFF, 0xAB, 0x55, 0xC0, 0xDD, 0xFF, 0x95, 0x5C, 0xC2, 0x97, 0xF7,
+0xD1, 0xE6, 0x0D, 0xDE, 0xA9, 0xC6, 0xCF, 0xF6, 0x2A, 0xAD, 0x45, 0x33, 0x85, 0x32, 0xB0, 0xD4,
+0xA5, 0xC1, 0x42, 0xE0, 0x5D, 0xE0, 0x14, 0xCB, 0x81, 0xD0, 0xD5, 0xFD, 0x34, 0xD6, 0x0F, 0x9D,
+0x6C, 0x6C, 0xE7, 0x2A, 0x84, 0x22, 0x66, 0x53, 0x2C, 0xA5, 0x51, 0xDE, 0x35, 0xFF, 0x97, 0xFF,
+0x65, 0xC0, 0xFA, 0xFF, 0xA0, 0xA4, 0xC6, 0xF3, 0xF6, 0x91, 0xEE, 0x13, 0xFF, 0xEF, 0xD5, 0x84,
+0x5A, 0xC5, 0x31, 0x08, 0x32, 0x00, 0xA5, 0xC0, 0x86, 0x21, 0xBA, 0xAE, 0xAE, 0x91, 0xC0, 0xC6,
+0x31, 0x91, 0xC0, 0x03, 0x19, 0xAE, 0xC1, 0xA5, 0x29, 0x07, 0x3A, 0x66, 0x44, 0xC1, 0x6A, 0x4A,
+0x09, 0x42, 0x00, 0x60, 0x00, 0x5B, 0x53, 0x60, 0x02, 0x67, 0x02, 0x60, 0x58, 0xC0, 0x4A, 0x4A,
+0x58, 0xA5, 0x60, 0x53, 0xC0, 0x29, 0x42, 0xBA, 0x67, 0x60, 0x6C, 0x01, 0x5B, 0x44, 0x6C, 0x60,
+0x01, 0x67, 0x58, 0x4C, 0x5B, 0x58, 0x5B, 0x53, 0x4C, 0x58, 0x00, 0x5B, 0x53, 0x58, 0x00, 0x53,
+0x67, 0x00, 0xC0, 0xA7, 0x39, 0x53, 0x91, 0x5B, 0x4C, 0x58, 0x6C, 0x67, 0x5B, 0x67, 0x60, 0x6C,
+0x60, 0xAE, 0x60, 0x4C, 0x44, 0xC0, 0xE7, 0x39, 0x4C, 0x00, 0x53, 0x58, 0x01, 0x53, 0x01, 0x7F,
+0xAF, 0x44, 0x75, 0x44, 0xC2, 0x72, 0x84, 0x1C, 0xD7, 0xDF, 0xEF, 0x95, 0xC0, 0xFF, 0xF7, 0x00,
+0xC0, 0xBE, 0xDF, 0x6E, 0x9A, 0xC6, 0x3D, 0xCF, 0x92, 0x7C, 0x85, 0x19, 0x02, 0x11, 0x24, 0x4A,
+0xAF, 0xC5, 0x55, 0xFF, 0xA1, 0xC1, 0x77, 0xFF, 0xFB, 0xFF, 0x01, 0xC2, 0x76, 0xFF, 0x33, 0xF7,
+0x10, 0xF7, 0xA9, 0xC7, 0x6E, 0xDE, 0x67, 0x84, 0x05, 0x2B, 0xA5, 0x32, 0xD0, 0xD4, 0xA5, 0xC1,
+0x42, 0xE0, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x5D, 0xC5, 0xA2, 0xD8, 0xF5, 0xFD, 0x14, 0xD6, 0xEF,
+0x94, 0x2B, 0x64, 0x07, 0x23, 0x90, 0xC3, 0x05, 0x43, 0x09, 0x7C, 0x4D, 0xB5, 0x72, 0xE6, 0x4D,
+0xAF, 0xC0, 0xB7, 0xFF, 0xA4, 0xA9, 0xA2, 0xA1, 0xC3, 0x31, 0xDE, 0x87, 0x83, 0x61, 0x29, 0xE5,
+0x31, 0x83, 0xBF, 0xC0, 0x49, 0x3A, 0xA9, 0x4E, 0x95, 0x4E, 0xAE, 0x7F, 0x00, 0x91, 0xA5, 0x6B,
+0xC0, 0x68, 0x42, 0xA2, 0x58, 0xC0, 0x6A, 0x4A, 0x58, 0x60, 0xAB, 0xAE, 0x01, 0x67, 0x02, 0x60,
+0x03, 0x91, 0x00, 0x92, 0xC1, 0xE8, 0x41, 0x49, 0x4A, 0x4C, 0x00, 0xAB, 0x58, 0x4C, 0x53, 0x67,
+0x60, 0x58, 0x60, 0x00, 0x5B, 0x60, 0x67, 0x60, 0x5B, 0x58, 0x53, 0x58, 0x01, 0x4C, 0x00, 0x60,
+0x03, 0xC0, 0x66, 0x31, 0x58, 0x6C, 0x58, 0x6C, 0x60, 0x67, 0xC0, 0x86, 0x31, 0x4C, 0xC0, 0x29,
+0x4A, 0x58, 0x78, 0x7F, 0x44, 0x60, 0x4C, 0xAE, 0x60, 0x4C, 0x51, 0x65, 0x4C, 0x01, 0x53, 0x58,
+0x00, 0x53, 0x01, 0x67, 0x96, 0x44, 0x01, 0xC4, 0xAA, 0x4A, 0x4C, 0x5B, 0xCE, 0x6B, 0x75, 0x9D,
+0x99, 0xC6, 0xAF, 0xC0, 0xFB, 0xCE, 0x47, 0xC2, 0x14, 0x8D, 0xAE, 0x5B, 0xA6, 0x19, 0xBF, 0xA8,
+0xC2, 0x62, 0x29, 0x89, 0x7B, 0x51, 0xDE, 0x7A, 0xC0, 0x75, 0xFF, 0xAB, 0xC0, 0xF9, 0xFF, 0x00,
+0xC0, 0xB6, 0xFF, 0xA9, 0xC8, 0x72, 0xFF, 0xAE, 0xDE, 0x09, 0x9D, 0x43, 0x53, 0x05, 0x23, 0xC6,
+0x3A, 0xD0, 0xDC, 0x85, 0xC1, 0x62, 0xE0, 0x5D, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x5D, 0xC3,
+0xA2, 0xD8, 0xF5, 0xFD, 0x14, 0xD6, 0xEF, 0x94, 0x56, 0xC0, 0x07, 0x23, 0xA5, 0xC4, 0xC5, 0x32,
+0x06, 0x53, 0xE9, 0x83, 0xEC, 0xAC, 0x11, 0xD6, 0x7E, 0xAE, 0xC5, 0x74, 0xFF, 0x13, 0xF7, 0x71,
+0xE6, 0x4E, 0xBD, 0xC9, 0x8B, 0xA2, 0x39, 0x54, 0xC0, 0xC6, 0x29, 0xAF, 0x01, 0xC0, 0x28, 0x32,
+0xBE, 0x5F, 0x90, 0xBF, 0x7F, 0x4E, 0x91, 0xC0, 0x44, 0x19, 0xBA, 0xC0, 0xEB, 0x5A, 0x95, 0xC0,
+0x0D, 0x63, 0xA9, 0x58, 0xA6, 0x58, 0xBA, 0x60, 0x6C, 0xA6, 0x02, 0x60, 0x02, 0x4C, 0xC0, 0x6A,
+0x4A, 0xBE, 0x40, 0x6F, 0x53, 0x58, 0xC1, 0xAB, 0x52, 0xEC, 0x5A, 0x70, 0x48, 0x6C, 0x00, 0x58,
+0x4C, 0x48, 0x60, 0xC0, 0xA7, 0x31, 0x4C, 0x60, 0x58, 0x00, 0x6C, 0xBE, 0x53, 0x4C, 0x5B, 0x44,
+0x53, 0x6C, 0x58, 0x4C, 0xC1, 0x66, 0x29, 0x69, 0x4A, 0x74, 0x79, 0x60, 0xC0, 0x65, 0x29, 0x4C,
+0x51, 0x58, 0x4C, 0x74, 0x48, 0x53, 0x4C, 0x6C, 0x74, 0x48, 0x65, 0xC0, 0xA6, 0x31, 0xA6, 0x4C,
+0x60, 0x65, 0x60, 0xC0, 0x4A, 0x4A, 0x67, 0x58, 0x01, 0x53, 0x00, 0x58, 0x53, 0x67, 0x80, 0x91,
+0xC2, 0xE8, 0x31, 0xAA, 0x4A, 0x08, 0x32, 0x46, 0x6B, 0xC1, 0xAA, 0x42, 0xEB, 0x4A, 0x95, 0xC1,
+0x49, 0x32, 0xE7, 0x21, 0x6B, 0xC1, 0xA6, 0x19, 0xE7, 0x19, 0x4B, 0xC4, 0x43, 0x21, 0xE3, 0x41,
+0xE9, 0x8B, 0x51, 0xDE, 0xB6, 0xFF, 0x5C, 0xA2, 0xC0, 0x96, 0xFF, 0x5C, 0x50, 0xC7, 0x8F, 0xD6,
+0x6A, 0xA5, 0xA5, 0x5B, 0x03, 0x3B, 0x26, 0x23, 0xE7, 0x42, 0xF1, 0xDC, 0x85, 0xC1, 0x71, 0x5D,
+0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x5D, 0xCD, 0x82, 0xD0, 0xF5, 0xFD, 0x14, 0xD6, 0x0F, 0x95,
+0x4C, 0x64, 0x27, 0x23, 0xC6, 0x1A, 0x64, 0x22, 0x85, 0x3A, 0x85, 0x4A, 0x84, 0x5A, 0x88, 0x7B,
+0x4E, 0xB5, 0x8F, 0xBD, 0xBE, 0x56, 0xC4, 0x09, 0x94, 0x85, 0x5A, 0x04, 0x42, 0x83, 0x29, 0xE5,
+0x31, 0x82, 0x5F, 0xC0, 0x69, 0x3A, 0x5A, 0x00, 0xC0, 0x89, 0x42, 0xAE, 0xC0, 0x48, 0x3A, 0x5F,
+0xA5, 0xA1, 0x00, 0x91, 0xBA, 0xC3, 0xAE, 0x7B, 0x2C, 0x63, 0x10, 0x84, 0x6E, 0x6B, 0x58, 0x01,
+0xA6, 0x58, 0xBF, 0x03, 0xA9, 0x02, 0x54, 0xC1, 0x51, 0x8C, 0xB3, 0x94, 0xA5, 0xC3, 0x4D, 0x6B,
+0x87, 0x31, 0x6A, 0x4A, 0x72, 0x8C, 0x74, 0xC2, 0xF4, 0x9C, 0xCF, 0x7B, 0xAB, 0x52, 0x40, 0xC0,
+0xC7, 0x39, 0x00, 0xC4, 0x0C, 0x63, 0x8E, 0x73, 0x29, 0x42, 0xA7, 0x31, 0xE8, 0x41, 0x53, 0x4C,
+0xC2, 0xAB, 0x5A, 0xCF, 0x7B, 0x49, 0x4A, 0x53, 0x00, 0x4C, 0x54, 0x58, 0xC0, 0x8A, 0x52, 0x7F,
+0xC1, 0xCB, 0x5A, 0x10, 0x84, 0x00, 0xC1, 0x51, 0x8C, 0x6D, 0x6B, 0x4C, 0x00, 0x51, 0x7D, 0xC2,
+0xAA, 0x52, 0xAE, 0x73, 0xEB, 0x5A, 0x4C, 0x48, 0xC0, 0xAF, 0x73, 0x5D, 0x6C, 0x5D, 0x74, 0xC1,
+0x86, 0x31, 0x6A, 0x4A, 0x91, 0xC0, 0x66, 0x29, 0x4C, 0x50, 0x5C, 0x6C, 0x91, 0x53, 0x4C, 0x53,
+0x58, 0x44, 0x6C, 0x58, 0x44, 0xC1, 0x08, 0x3A, 0x8A, 0x4A, 0x80, 0xC1, 0xCA, 0x42, 0xE6, 0x29,
+0xAF, 0x95, 0xA6, 0x92, 0xC2, 0xE7, 0x21, 0xCB, 0x42, 0x08, 0x2A, 0x80, 0x00, 0xC0, 0xA5, 0x29,
+0xA5, 0xC1, 0x03, 0x42, 0xE9, 0x83, 0x52, 0xCA, 0x30, 0xCE, 0x92, 0xDE, 0xF3, 0xE6, 0x91, 0xDE,
+0xCE, 0xBD, 0x89, 0x84, 0xC6, 0x5B, 0xA2, 0x2A, 0x04, 0x2B, 0x67, 0x2B, 0x27, 0x43, 0x4B, 0xC2,
+0x64, 0xB9, 0x62, 0xE0, 0x01, 0xF8, 0xA9, 0xAE, 0x5D, 0xE0, 0x11, 0xC8, 0x81, 0xD0, 0xD5, 0xFD,
+0x34, 0xD6, 0x0F, 0x9D, 0x6C, 0x6C, 0x89, 0x33, 0x07, 0x23, 0xA6, 0x2A, 0x08, 0x43, 0xB1, 0xC3,
+0xE3, 0x39, 0x86, 0x52, 0x8D, 0x94, 0x07, 0x63, 0x00, 0xC4, 0x85, 0x5A, 0x24, 0x4A, 0x21, 0x29,
+0xE5, 0x39, 0x47, 0x3A, 0x96, 0xAF, 0x5F, 0x5A, 0x00, 0x5F, 0xBA, 0x00, 0x4E, 0xAE, 0x96, 0xA5,
+0xC1, 0x07, 0x3A, 0xA6, 0x31, 0x91, 0xC4, 0xAE, 0x7B, 0xCB, 0x62, 0xF0, 0x7B, 0x2D, 0x63, 0xA7,
+0x31, 0x5B, 0x74, 0x96, 0xA6, 0xC0, 0x4A, 0x4A, 0x6C, 0x67, 0x01, 0xA9, 0x01, 0x5B, 0x54, 0x96,
+0xC2, 0xEC, 0x5A, 0xAF, 0x73, 0x10, 0x84, 0x74, 0xC0, 0xC8, 0x39, 0x7B, 0xC0, 0x8E, 0x73, 0x40,
+0x68, 0xC0, 0xC7, 0x39, 0xAF, 0x44, 0xC4, 0x29, 0x4A, 0x31, 0x84, 0x56, 0xAD, 0x0C, 0x63, 0xC7,
+0x39, 0x60, 0x53, 0x4C, 0xC1, 0x6E, 0x6B, 0x55, 0xAD, 0x68, 0x5B, 0x44, 0x60, 0xC1, 0xD0, 0x7B,
+0x35, 0xA5, 0x50, 0x7D, 0xC0, 0xEF, 0x7B, 0x00, 0xC1, 0x2C, 0x63, 0x30, 0x84, 0x40, 0x65, 0x4C,
+0x7D, 0x60, 0x40, 0xC0, 0x14, 0xA5, 0x75, 0x69, 0xC0, 0xAA, 0x52, 0x40, 0xC0, 0xAE, 0x73, 0xA6,
+0x40, 0xC0, 0x8A, 0x52, 0x60, 0xC0, 0xCF, 0x7B, 0x7C, 0xC0, 0x86, 0x31, 0x65, 0x54, 0xC2, 0x6E,
+0x6B, 0x6A, 0x4A, 0xE8, 0x39, 0x4C, 0xA6, 0x53, 0x58, 0x44, 0xAE, 0x44, 0xC1, 0x08, 0x3A, 0x49,
+0x42, 0x80, 0xC3, 0x65, 0x19, 0x69, 0x3A, 0xEA, 0x42, 0x48, 0x32, 0x81, 0xC1, 0x68, 0x32, 0xE7,
+0x21, 0x4D, 0xC1, 0xAA, 0x3A, 0x28, 0x2A, 0xAF, 0x79, 0x53, 0x56, 0xC0, 0x84, 0x31, 0xA8, 0xC9,
+0x22, 0x42, 0x04, 0x5B, 0xA7, 0x73, 0x08, 0x7C, 0x86, 0x6B, 0xE4, 0x52, 0x62, 0x32, 0xE4, 0x32,
+0xA4, 0x1A, 0xA8, 0x33, 0x96, 0xC4, 0x48, 0x4B, 0xF1, 0xDC, 0x64, 0xB9, 0x62, 0xE0, 0x21, 0xF8,
+0xA5, 0xE0, 0x11, 0xAE, 0x5D, 0xC5, 0x82, 0xD0, 0x36, 0xFE, 0x14, 0xCE, 0xEF, 0x94, 0x8D, 0x74,
+0x89, 0x33, 0x96, 0xC5, 0xE7, 0x2A, 0x09, 0x3B, 0x6B, 0x53, 0x88, 0x42, 0xE5, 0x31, 0x88, 0x4A,
+0x91, 0xC0, 0xE6, 0x39, 0x95, 0xC0, 0x06, 0x3A, 0xAF, 0x96, 0x9A, 0x57, 0x00, 0xBE, 0xBA, 0xAF,
+0xA9, 0x62, 0x00, 0x53, 0x62, 0x91, 0x42, 0xAE, 0x4A, 0xA2, 0xC0, 0x6D, 0x7B, 0x96, 0x92, 0xC2,
+0x6E, 0x6B, 0xC8, 0x39, 0x09, 0x42, 0xAE, 0x60, 0x96, 0x60, 0x67, 0x60, 0x67, 0x6C, 0x60, 0x58,
+0x67, 0xC2, 0x6A, 0x4A, 0x52, 0x8C, 0xCB, 0x5A, 0x60, 0x6C, 0xBE, 0x00, 0x58, 0x78, 0xC1, 0x0C,
+0x63, 0xF0, 0x83, 0x6C, 0x58, 0xBA, 0xC1, 0x87, 0x31, 0xAB, 0x52, 0x7B, 0xC2, 0xB3, 0x94, 0xF0,
+0x7B, 0xC7, 0x39, 0x6F, 0x6C, 0x53, 0x7B, 0xC0, 0x72, 0x8C, 0x78, 0xC0, 0xA7, 0x39, 0x53, 0x67,
+0x6C, 0x60, 0x50, 0x4C, 0x70, 0xC2, 0xEF, 0x7B, 0x2C, 0x63, 0xAE, 0x73, 0x71, 0xC1, 0x89, 0x52,
+0x07, 0x42, 0x7D, 0xC2, 0xCE, 0x7B, 0x91, 0x94, 0xD2, 0x9C, 0x5C, 0xC3, 0x86, 0x31, 0xAA, 0x52,
+0x30, 0x84, 0x6D, 0x6B, 0x70, 0x5D, 0xC0, 0x49, 0x4A, 0x4C, 0xC0, 0x10, 0x84, 0x50, 0x4C, 0xC1,
+0x69, 0x4A, 0x72, 0x94, 0x70, 0x58, 0x53, 0xC0, 0x08, 0x42, 0x53, 0x00, 0x58, 0x00, 0x67, 0xC0,
+0xA7, 0x31, 0x99, 0x62, 0xAE, 0x81, 0x00, 0xC0, 0xC9, 0x42, 0x96, 0x64, 0x95, 0xC2, 0xA6, 0x19,
+0x48, 0x2A, 0xEB, 0x4A, 0x50, 0x01, 0xA6, 0x00, 0xA5, 0xB9, 0xAD, 0xA9, 0xAD, 0x00, 0x9A, 0xAF,
+0xC3, 0x65, 0x22, 0xC6, 0x22, 0x48, 0x23, 0xA8, 0x23, 0xBF, 0xC4, 0x69, 0x53, 0x52, 0xE5, 0x64,
+0xB9, 0x62, 0xE0, 0x01, 0xF8, 0xA9, 0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x5D, 0xC5, 0x82, 0xD0, 0x36,
+0xFE, 0xF4, 0xCD, 0xCE, 0x94, 0x6C, 0x6C, 0xEA, 0x43, 0x96, 0xC4, 0x29, 0x33, 0x2A, 0x43, 0x4C,
+0x4B, 0x49, 0x32, 0xA6, 0x21, 0x5A, 0x77, 0xBF, 0xA6, 0x95, 0xAF, 0x57, 0xAF, 0x95, 0x5F, 0x00,
+0xBA, 0x6E, 0x67, 0x62, 0x01, 0x99, 0x5F, 0xA5, 0xA1, 0xBA, 0x00, 0xC1, 0x6D, 0x73, 0xEB, 0x62,
+0xA7, 0xC1, 0x4D, 0x6B, 0xA7, 0x31, 0x60, 0xAB, 0x60, 0xA6, 0x60, 0xAF, 0x67, 0x60, 0x00, 0x96,
+0xA6, 0x6C, 0xC3, 0x8A, 0x52, 0xB3, 0x94, 0xEC, 0x5A, 0xC7, 0x39, 0x60, 0x6C, 0x53, 0x60, 0x6C,
+0xC1, 0x0C, 0x63, 0xF0, 0x7B, 0x6F, 0x00, 0x6C, 0x4C, 0xC2, 0x4E, 0x6B, 0x92, 0x94, 0x6E, 0x6B,
+0xBE, 0x67, 0x4C, 0xAF, 0xC0, 0x49, 0x4A, 0x50, 0x7C, 0xC1, 0xB3, 0x94, 0x6A, 0x52, 0x58, 0x60,
+0x58, 0xC0, 0x8E, 0x73, 0x5C, 0xC2, 0xA6, 0x31, 0xEB, 0x5A, 0x51, 0x8C, 0x40, 0xC2, 0x71, 0x8C,
+0xEF, 0x7B, 0x86, 0x31, 0x7D, 0xC0, 0x4D, 0x6B, 0x54, 0xC0, 0x2C, 0x63, 0x58, 0x70, 0x78, 0x4C,
+0xC1, 0xCF, 0x7B, 0x30, 0x84, 0x71, 0x54, 0x4D, 0x4C, 0x40, 0xC0, 0xB2, 0x94, 0x40, 0x59, 0x54,
+0xC0, 0xEC, 0x5A, 0x4C, 0x00, 0x60, 0x96, 0x47, 0x53, 0x91, 0xC0, 0x08, 0x3A, 0x01, 0xC1, 0x48,
+0x3A, 0xAA, 0x42, 0xAD, 0x00, 0x51, 0x91, 0x91, 0xAE, 0xC3, 0xE7, 0x21, 0x48, 0x32, 0xEB, 0x42,
+0x07, 0x2A, 0x48, 0xBA, 0x00, 0x46, 0x7E, 0x00, 0xAD, 0xC0, 0x05, 0x2A, 0xA9, 0x99, 0xAB, 0x9B,
+0xC3, 0x46, 0x12, 0xC8, 0x12, 0x69, 0x1B, 0xC9, 0x23, 0xBA, 0xC4, 0x69, 0x53, 0x52, 0xE5, 0x64,
+0xB9, 0x62, 0xE0, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x5D, 0xC5, 0x81, 0xD0, 0x16,
+0xFE, 0xF3, 0xCD, 0xCE, 0x8C, 0x4C, 0x6C, 0xCA, 0x43, 0x96, 0xC0, 0x4A, 0x3B, 0xBB, 0xC5, 0x4D,
+0x4B, 0x8A, 0x3A, 0xC8, 0x29, 0x09, 0x32, 0xA8, 0x21, 0xE8, 0x29, 0xAF, 0x95, 0x00, 0x63, 0x00,
+0x4F, 0x6B, 0xBA, 0x01, 0xA9, 0xA6, 0x67, 0x00, 0x5F, 0xAE, 0xA5, 0xC0, 0xC6, 0x29, 0xBA, 0xC2,
+0x07, 0x42, 0x8D, 0x7B, 0xAA, 0x62, 0x87, 0xC2, 0x0D, 0x63, 0x87, 0x31, 0xE8, 0x39, 0x60, 0x02,
+0xAF, 0xA6, 0x00, 0x60, 0x58, 0x00, 0x67, 0xC1, 0x6A, 0x4A, 0x72, 0x94, 0x5C, 0xC0, 0x45, 0x29,
+0x60, 0x40, 0x58, 0x60, 0x4C, 0x77, 0xC0, 0xF0, 0x83, 0x6C, 0x58, 0xA6, 0xC2, 0x49, 0x4A, 0x11,
+0x84, 0x52, 0x8C, 0xA9, 0xC1, 0xD3, 0x9C, 0x2D, 0x63, 0x64, 0xC2, 0xA7, 0x39, 0x8E, 0x73, 0x72,
+0x8C, 0x91, 0xC0, 0x92, 0x94, 0x44, 0xC0, 0x08, 0x42, 0x91, 0x60, 0xC0, 0xF0, 0x7B, 0x44, 0xC1,
+0xE8, 0x39, 0xEF, 0x7B, 0xA6, 0xC0, 0x69, 0x4A, 0x44, 0xC0, 0x30, 0x84, 0x74, 0x00, 0xC2, 0x71,
+0x8C, 0xD3, 0x9C, 0x8E, 0x73, 0x71, 0x49, 0x60, 0x5C, 0x45, 0x5C, 0x74, 0xC0, 0x10, 0x84, 0x44,
+0xC1, 0xE7, 0x39, 0x6E, 0x6B, 0x58, 0x5C, 0xC1, 0x2D, 0x63, 0x72, 0x8C, 0x70, 0x53, 0x4C, 0xC0,
+0x08, 0x42, 0x96, 0x53, 0x00, 0x60, 0x58, 0x91, 0xAE, 0xC1, 0x48, 0x3A, 0x2C, 0x53, 0xA9, 0xC0,
+0x88, 0x32, 0x00, 0xC0, 0x06, 0x22, 0xAB, 0xC3, 0x89, 0x32, 0x28, 0x2A, 0x69, 0x32, 0xEB, 0x4A,
+0x57, 0xC0, 0xA6, 0x21, 0x4B, 0x5F, 0xAE, 0x97, 0x5E, 0x5C, 0xAE, 0xA8, 0x00, 0x9B, 0x96, 0x8E,
+0xC2, 0xA8, 0x0A, 0x88, 0x13, 0x09, 0x24, 0xB6, 0xC4, 0x89, 0x53, 0x52, 0xED, 0x64, 0xB9, 0x62,
+0xE0, 0x00, 0xF8, 0xE0, 0x14, 0xC2, 0x81, 0xD0, 0x36, 0xFE, 0xF4, 0xCD, 0x56, 0x65, 0xC0, 0x68,
+0x3B, 0x9B, 0xA7, 0xC0, 0x4B, 0x43, 0xB7, 0xC1, 0x8A, 0x3A, 0x08, 0x2A, 0xB6, 0xC0, 0x49, 0x3A,
+0x57, 0x00, 0x63, 0xAE, 0x01, 0xBF, 0xB9, 0x00, 0x6E, 0x00, 0x62, 0xAE, 0x01, 0x9A, 0x91, 0x95,
+0xBA, 0x67, 0xBE, 0xC5, 0xAE, 0x7B, 0xCB, 0x5A, 0x6A, 0x4A, 0x0C, 0x63, 0xA7, 0x31, 0xE8, 0x39,
+0xBE, 0x02, 0x58, 0x60, 0xAF, 0xBA, 0x6C, 0x60, 0x01, 0x78, 0xC0, 0x4E, 0x6B, 0x40, 0xC0, 0x4D,
+0x6B, 0x00, 0x6C, 0xA1, 0xC2, 0x45, 0x29, 0x6E, 0x6B, 0x51, 0x8C, 0x6F, 0xC0, 0x87, 0x31, 0x4C,
+0x7C, 0xC0, 0xB3, 0x94, 0x44, 0x70, 0xC5, 0x31, 0x8C, 0xAF, 0x7B, 0xA7, 0x31, 0x49, 0x4A, 0x31,
+0x84, 0xAF, 0x73, 0x70, 0x78, 0xBE, 0xC1, 0x6A, 0x4A, 0x66, 0x29, 0x60, 0xC0, 0x72, 0x8C, 0x64,
+0xC0, 0x86, 0x31, 0x54, 0xC1, 0x2C, 0x63, 0x65, 0x29, 0x5C, 0x59, 0xC1, 0x0C, 0x63, 0x28, 0x42,
+0x70, 0xC1, 0x4D, 0x6B, 0x8E, 0x73, 0x54, 0x70, 0xC0, 0xC7, 0x39, 0x44, 0x54, 0x4C, 0x95, 0x45,
+0x58, 0x65, 0xC0, 0xF0, 0x7B, 0x7C, 0xC2, 0x66, 0x29, 0x08, 0x42, 0x92, 0x94, 0x7C, 0x5B, 0x47,
+0xC0, 0xE8, 0x39, 0x01, 0xBF, 0x60, 0x58, 0x00, 0x49, 0xC3, 0x07, 0x32, 0xEA, 0x4A, 0x4B, 0x53,
+0x88, 0x32, 0x95, 0xC0, 0xC5, 0x19, 0xAF, 0xC0, 0xA9, 0x3A, 0x92, 0x00, 0xC1, 0xCA, 0x42, 0xE7,
+0x29, 0x57, 0x01, 0xA9, 0x97, 0x01, 0x48, 0x7E, 0x46, 0x9F, 0x96, 0x9E, 0xC2, 0xA8, 0x0A, 0x69,
+0x13, 0x0A, 0x24, 0xB5, 0xC2, 0x89, 0x53, 0x52, 0xED, 0x64, 0xB9, 0x71, 0x5D, 0xE0, 0x14, 0xC5,
+0x82, 0xD0, 0x57, 0xFE, 0x35, 0xD6, 0x0F, 0x9D, 0x8D, 0x74, 0xA9, 0x43, 0x96, 0xA7, 0xA2, 0xC0,
+0x88, 0x3A, 0x53, 0x91, 0xA1, 0xC0, 0xE5, 0x31, 0x92, 0xC2, 0xE5, 0x21, 0x47, 0x32, 0x89, 0x3A,
+0x91, 0x57, 0x52, 0xC0, 0x69, 0x3A, 0x00, 0xA6, 0x00, 0xA9, 0x00, 0x64, 0xAE, 0x81, 0xC0, 0xC5,
+0x11, 0x7E, 0x7D, 0xC6, 0x2B, 0x53, 0xCA, 0x4A, 0x8D, 0x73, 0xAA, 0x52, 0x4A, 0x4A, 0x0D, 0x63,
+0xC7, 0x39, 0x5B, 0xAE, 0xAB, 0x60, 0x96, 0xA6, 0x60, 0x6C, 0x01, 0x67, 0x5B, 0x58, 0xC1, 0x2D,
+0x6B, 0x31, 0x84, 0xA5, 0xC1, 0x51, 0x8C, 0x6E, 0x6B, 0x6C, 0xBA, 0x53, 0x7F, 0xC0, 0xD0, 0x7B,
+0x74, 0x5B, 0x74, 0xC0, 0x8F, 0x73, 0x54, 0xC3, 0x6A, 0x4A, 0xA7, 0x31, 0x0C, 0x63, 0xAF, 0x73,
+0x74, 0xC4, 0xEC, 0x5A, 0x10, 0x84, 0x8A, 0x52, 0xC7, 0x39, 0x8B, 0x52, 0x5F, 0xC0, 0x6A, 0x4A,
+0x44, 0x40, 0xC0, 0xB3, 0x9C, 0x95, 0x7C, 0xC0, 0xCF, 0x7B, 0x01, 0x59, 0xC0, 0x10, 0x84, 0x74,
+0xC0, 0x86, 0x31, 0x4C, 0x44, 0xC2, 0x6A, 0x4A, 0x8E, 0x73, 0xAB, 0x52, 0x78, 0x74, 0xC0, 0xF0,
+0x7B, 0xA9, 0x00, 0xC1, 0xB2, 0x94, 0xEB, 0x5A, 0x4C, 0x78, 0x58, 0x4C, 0x60, 0x64, 0xC1, 0xAB,
+0x5A, 0xE8, 0x39, 0x4C, 0x58, 0x00, 0x53, 0x58, 0x01, 0xAE, 0x95, 0xC3, 0x27, 0x32, 0xEA, 0x4A,
+0x2B, 0x4B, 0x47, 0x2A, 0x00, 0xC0, 0xC5, 0x19, 0x7E, 0xC0, 0xCA, 0x3A, 0x7D, 0xA6, 0xC1, 0xEB,
+0x42, 0x48, 0x32, 0xA6, 0x95, 0x96, 0xA6, 0x48, 0x50, 0xAE, 0x50, 0xAD, 0x00, 0x52, 0x9A, 0xC3,
+0x67, 0x12, 0xC8, 0x12, 0x69, 0x1B, 0xC9, 0x23, 0xBE, 0xC4, 0x89, 0x53, 0x52, 0xED, 0x64, 0xB9,
+0x62, 0xE0, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x82, 0xD0, 0x77, 0xFE, 0x55, 0xD6, 0x30, 0x9D, 0xAD,
+0x74, 0xA9, 0x43, 0x82, 0xB6, 0xC3, 0xE8, 0x3A, 0x25, 0x2A, 0x26, 0x3A, 0x87, 0x52, 0xA9, 0xC0,
+0x03, 0x42, 0x9F, 0x9A, 0x96, 0xAB, 0xC0, 0x68, 0x3A, 0xBB, 0x9A, 0x96, 0xAE, 0x6B, 0x6E, 0xA9,
+0x5F, 0x9E, 0x00, 0xC0, 0xE6, 0x19, 0x99, 0xC5, 0x88, 0x2A, 0xAD, 0x53, 0xEE, 0x63, 0xC9, 0x4A,
+0x4C, 0x63, 0x49, 0x4A, 0x96, 0xC0, 0x0D, 0x63, 0x4C, 0xBF, 0x60, 0xAB, 0x60, 0x96, 0x67, 0x6C,
+0x67, 0x58, 0x00, 0x60, 0x67, 0x60, 0x4C, 0xC0, 0xEC, 0x5A, 0x00, 0x57, 0x6C, 0x44, 0x60, 0x00,
+0x74, 0xC0, 0x8A, 0x52, 0x58, 0x74, 0x48, 0x68, 0x5C, 0x4C, 0xA6, 0x74, 0xC0, 0x8B, 0x52, 0x44,
+0x60, 0x5C, 0x5B, 0x58, 0x47, 0xC0, 0x6A, 0x4A, 0x60, 0x00, 0x74, 0xC3, 0xAF, 0x73, 0x10, 0x84,
+0x72, 0x94, 0x6D, 0x6B, 0xBF, 0xC0, 0xEF, 0x7B, 0x58, 0x48, 0x4C, 0x00, 0xAF, 0x4C, 0x58, 0x48,
+0x74, 0x58, 0x4C, 0x68, 0xC0, 0xCF, 0x7B, 0x71, 0xC2, 0x4D, 0x6B, 0x28, 0x42, 0x86, 0x31, 0x4D,
+0x91, 0x4C, 0x95, 0xC0, 0x4A, 0x4A, 0x58, 0x91, 0x58, 0x67, 0x58, 0x53, 0x44, 0x58, 0x4C, 0x9A,
+0xAE, 0xC4, 0x48, 0x3A, 0xCA, 0x42, 0x68, 0x32, 0x84, 0x11, 0x26, 0x22, 0x72, 0x00, 0xC0, 0x88,
+0x32, 0xAB, 0x00, 0x4C, 0xC0, 0x48, 0x32, 0x50, 0xAB, 0xAE, 0x5F, 0x50, 0xA5, 0xA5, 0x99, 0xBE,
+0x00, 0x9B, 0x9E, 0xC3, 0x46, 0x12, 0xC7, 0x1A, 0x49, 0x1B, 0xA9, 0x23, 0xBE, 0xC3, 0x89, 0x53,
+0x52, 0xED, 0x64, 0xB9, 0x62, 0xE0, 0x5D, 0xE0, 0x14, 0xC2, 0x81, 0xD0, 0x57, 0xFE, 0x55, 0xD6,
+0x6A, 0xC1, 0x8C, 0x74, 0x68, 0x3B, 0x82, 0xBA, 0xC5, 0xC7, 0x3A, 0x65, 0x3A, 0x68, 0x6B, 0xEE,
+0xA4, 0x6F, 0xBD, 0xD0, 0xC5, 0x99, 0xC1, 0x0D, 0x9D, 0xA8, 0x63, 0x57, 0xC0, 0xE5, 0x29, 0xBB,
+0xC0, 0x08, 0x32, 0x5F, 0xAE, 0x02, 0x5F, 0x55, 0x52, 0x85, 0xC6, 0xA8, 0x22, 0xAC, 0x43, 0x4F,
+0x64, 0xCD, 0x5B, 0x67, 0x32, 0xEA, 0x4A, 0x28, 0x3A, 0xA2, 0xC1, 0xEC, 0x5A, 0xA7, 0x31, 0x58,
+0x00, 0xBF, 0x00, 0x58, 0xC0, 0x29, 0x42, 0x00, 0x67, 0x53, 0x00, 0x60, 0x67, 0x60, 0x58, 0x6C,
+0x58, 0x53, 0x6C, 0x00, 0xBE, 0x7B, 0xC0, 0xA7, 0x39, 0xAE, 0x00, 0x6C, 0x00, 0x67, 0x44, 0x58,
+0x44, 0x53, 0x6C, 0x53, 0x58, 0x6C, 0x53, 0x58, 0x60, 0xA6, 0x4C, 0x58, 0xC0, 0x66, 0x29, 0x58,
+0x47, 0x4F, 0xA5, 0x58, 0x44, 0xA1, 0x70, 0x47, 0x60, 0x01, 0x58, 0x53, 0x44, 0x58, 0x53, 0x00,
+0x94, 0x4C, 0x7D, 0xC0, 0xE7, 0x39, 0x4C, 0x58, 0x4C, 0x58, 0x51, 0x4C, 0x44, 0x00, 0x58, 0x67,
+0x58, 0x47, 0x00, 0x96, 0x58, 0x51, 0x95, 0xC0, 0x07, 0x32, 0x64, 0xAE, 0x00, 0xC4, 0x0A, 0x43,
+0x67, 0x2A, 0xC5, 0x19, 0x47, 0x2A, 0xA9, 0x3A, 0xAF, 0xA6, 0xC0, 0xC7, 0x21, 0x50, 0xBF, 0xAB,
+0x91, 0xC0, 0xA5, 0x21, 0xBD, 0xC2, 0x44, 0x3A, 0xC6, 0x4A, 0x28, 0x5B, 0x00, 0x9A, 0xC1, 0xC6,
+0x3A, 0x85, 0x22, 0x9F, 0xC1, 0x29, 0x23, 0xAB, 0x2B, 0xAC, 0xC3, 0x69, 0x53, 0x52, 0xE5, 0x64,
+0xB9, 0x62, 0xE0, 0x5D, 0x00, 0xAE, 0x5D, 0xE0, 0x11, 0xC0, 0x81, 0xD0, 0x78, 0xC3, 0x35, 0xD6,
+0xEF, 0x94, 0x6C, 0x6C, 0x49, 0x33, 0x95, 0xC0, 0x28, 0x3B, 0xB0, 0xCA, 0xC5, 0x52, 0x8B, 0x9C,
+0xF4, 0xEE, 0xD6, 0xFF, 0x54, 0xFF, 0xB6, 0xFF, 0xF6, 0xFF, 0x34, 0xE7, 0x0D, 0x9D, 0xE7, 0x5A,
+0xE5, 0x39, 0x9B, 0x5F, 0x9E, 0xBA, 0x01, 0x55, 0x9A, 0x99, 0xC2, 0x88, 0x1A, 0x8B, 0x3B, 0x8F,
+0x5C, 0xA6, 0xC5, 0x2B, 0x43, 0xC6, 0x21, 0xCA, 0x4A, 0x28, 0x3A, 0xA7, 0x31, 0xAB, 0x52, 0x7F,
+0x4C, 0xAF, 0x67, 0x00, 0x58, 0x00, 0x6C, 0x00, 0x5B, 0x00, 0x67, 0x60, 0x4C, 0x6C, 0x60, 0x58,
+0x00, 0x6C, 0x95, 0x7F, 0x58, 0x6C, 0x00, 0xAE, 0x60, 0x58, 0x60, 0xC1, 0x86, 0x31, 0x6A, 0x4A,
+0x58, 0x00, 0x6C, 0x00, 0x60, 0x00, 0x6C, 0x00, 0x5B, 0x58, 0x00, 0x60, 0x4C, 0xC1, 0x8A, 0x52,
+0xA7, 0x39, 0x58, 0x4C, 0x00, 0x67, 0x40, 0x00, 0x74, 0x58, 0x60, 0x00, 0x58, 0x6C, 0x58, 0x60,
+0x92, 0x60, 0x58, 0x51, 0x01, 0x78, 0x4C, 0x00, 0x5B, 0x4C, 0x60, 0x58, 0x00, 0x5B, 0x58, 0x53,
+0x00, 0x58, 0x01, 0xC0, 0x86, 0x29, 0xAE, 0xC3, 0x89, 0x42, 0x4C, 0x53, 0xAD, 0x5B, 0x2F, 0x6C,
+0x9A, 0xC0, 0x2B, 0x43, 0x41, 0x61, 0xC2, 0x6C, 0x53, 0xAE, 0x5B, 0x2C, 0x53, 0x50, 0x97, 0xBE,
+0xA5, 0xC5, 0x85, 0x29, 0xC4, 0x31, 0x27, 0x63, 0x8F, 0xB5, 0x55, 0xEF, 0xB7, 0xF7, 0xA6, 0xC5,
+0xF4, 0xDE, 0x6E, 0xA5, 0xA7, 0x5B, 0xC4, 0x2A, 0xE7, 0x22, 0x8A, 0x2B, 0xAD, 0xC4, 0x69, 0x53,
+0x32, 0xED, 0x44, 0xB9, 0x62, 0xE0, 0x01, 0xF8, 0xA9, 0xAE, 0x5D, 0xE0, 0x11, 0xD7, 0xA2, 0xD0,
+0xB8, 0xFE, 0x35, 0xCE, 0x10, 0x95, 0x6D, 0x74, 0x8A, 0x3B, 0x08, 0x2B, 0xA6, 0x3A, 0x46, 0x63,
+0x6D, 0xBD, 0x53, 0xFF, 0xF2, 0xF6, 0x70, 0xE6, 0xEF, 0xD5, 0x30, 0xDE, 0xB1, 0xEE, 0xF1, 0xF6,
+0x94, 0xFF, 0x30, 0xCE, 0xA5, 0x52, 0x83, 0x29, 0x06, 0x32, 0x08, 0x2A, 0x68, 0x32, 0x92, 0x94,
+0x5A, 0xAE, 0xC2, 0x05, 0x12, 0xAB, 0x3B, 0xAF, 0x54, 0xA6, 0xB1, 0xC5, 0x2B, 0x43, 0x24, 0x11,
+0x0C, 0x5B, 0x8A, 0x4A, 0xC7, 0x31, 0x4A, 0x4A, 0x58, 0xBF, 0x58, 0x5B, 0x67, 0xAE, 0x58, 0x02,
+0x5B, 0x00, 0x67, 0x00, 0x6C, 0x9A, 0xA6, 0xA9, 0x03, 0x6C, 0x69, 0x64, 0x5D, 0x01, 0x64, 0x69,
+0x5D, 0x00, 0x67, 0x6C, 0x67, 0x5D, 0x58, 0x00, 0xA6, 0x58, 0x67, 0x6C, 0x00, 0x67, 0x58, 0x00,
+0x53, 0x5B, 0x67, 0x6C, 0x67, 0x5B, 0x00, 0xAE, 0x53, 0x58, 0x67, 0x5B, 0x53, 0xA9, 0x53, 0x00,
+0x60, 0x67, 0x00, 0x60, 0x5B, 0x58, 0x02, 0x5B, 0x67, 0x00, 0x58, 0x53, 0x01, 0x58, 0x4C, 0x58,
+0x5D, 0x80, 0xC0, 0xAD, 0x63, 0x92, 0x80, 0xC2, 0x89, 0x3A, 0xEA, 0x4A, 0x89, 0x42, 0x78, 0xC9,
+0x17, 0xAE, 0x7C, 0xD7, 0x54, 0x95, 0x8A, 0x32, 0xA7, 0x11, 0x6A, 0x32, 0xE7, 0x31, 0x62, 0x31,
+0xA8, 0x83, 0xD2, 0xE6, 0x44, 0xC0, 0xF1, 0xEE, 0xA6, 0xBA, 0xA5, 0xC3, 0x52, 0xFF, 0xD0, 0xDE,
+0xE9, 0x8C, 0xE4, 0x32, 0x8B, 0xC5, 0x88, 0x2B, 0x28, 0x4B, 0x73, 0xF5, 0x24, 0xC1, 0x61, 0xE8,
+0x00, 0xF8, 0xE0, 0x14, 0xCE, 0xA1, 0xD0, 0x98, 0xFE, 0x35, 0xCE, 0x10, 0x95, 0x6D, 0x6C, 0x49,
+0x33, 0x65, 0x22, 0x88, 0x63, 0xAF, 0xBD, 0xD2, 0xF6, 0x70, 0xEE, 0xEE, 0xD5, 0x72, 0xE6, 0xD4,
+0xEE, 0x31, 0xDE, 0xA0, 0xC1, 0x8C, 0xCD, 0x6F, 0xE6, 0x55, 0xC3, 0xAF, 0xB5, 0x64, 0x42, 0x47,
+0x3A, 0x49, 0x3A, 0x80, 0x99, 0xC0, 0x48, 0x32, 0x46, 0x99, 0xC1, 0xE9, 0x32, 0x2D, 0x4C, 0x40,
+0x5B, 0xC0, 0x6B, 0x43, 0xB3, 0xC5, 0xE7, 0x31, 0x0C, 0x5B, 0x6A, 0x4A, 0xA7, 0x39, 0x4A, 0x4A,
+0xC8, 0x39, 0x58, 0x00, 0x67, 0x01, 0x58, 0x01, 0xBA, 0x00, 0x67, 0x01, 0x99, 0x03, 0xAB, 0x04,
+0x5D, 0x64, 0x01, 0x69, 0xBA, 0x67, 0x00, 0x64, 0x06, 0x67, 0x64, 0x00, 0x5D, 0x58, 0x00, 0x5B,
+0x67, 0x01, 0x5B, 0x67, 0x00, 0x58, 0x00, 0x5B, 0x00, 0x58, 0x53, 0x01, 0x67, 0x01, 0x5B, 0x58,
+0x00, 0x5B, 0x67, 0x58, 0x5B, 0x67, 0x00, 0x58, 0x53, 0x01, 0x5B, 0xAE, 0xC0, 0xA6, 0x31, 0x81,
+0xC9, 0x89, 0x42, 0x38, 0xB6, 0x1B, 0xCF, 0xF7, 0xAD, 0x13, 0x95, 0xD7, 0xAD, 0x5C, 0xDF, 0xFB,
+0xCE, 0xBE, 0xE7, 0xFF, 0xF7, 0x9A, 0xC1, 0x14, 0x8D, 0xC7, 0x19, 0xBA, 0xC4, 0x63, 0x29, 0x07,
+0x6B, 0x10, 0xD6, 0x13, 0xFF, 0xB0, 0xEE, 0x96, 0xA6, 0xA5, 0xCB, 0xCB, 0xDD, 0x6D, 0xEE, 0x30,
+0xF7, 0xF0, 0xDE, 0x0A, 0x85, 0x45, 0x3B, 0x47, 0x23, 0xE7, 0x42, 0x52, 0xF5, 0x03, 0xC1, 0x41,
+0xE8, 0x00, 0xF8, 0xE0, 0x14, 0xC0, 0x81, 0xD0, 0x49, 0xD3, 0x15, 0xCE, 0xEF, 0x94, 0x4D, 0x6C,
+0x09, 0x3B, 0xA6, 0x32, 0x8B, 0x84, 0x72, 0xDE, 0x92, 0xEE, 0x31, 0xE6, 0x95, 0xE6, 0x9A, 0xFF,
+0xDC, 0xFF, 0x59, 0xF7, 0x16, 0xFF, 0xCF, 0xD5, 0xEA, 0xB4, 0xB0, 0xE6, 0x53, 0xF7, 0x87, 0x73,
+0xC5, 0x31, 0x83, 0xC6, 0x07, 0x2A, 0xC9, 0x3A, 0x68, 0x32, 0x84, 0x11, 0x26, 0x22, 0xCC, 0x4B,
+0x4E, 0x54, 0xBF, 0xC4, 0xED, 0x4B, 0x4B, 0x43, 0xB2, 0x84, 0x10, 0x7C, 0x4D, 0x6B, 0x58, 0x00,
+0xC1, 0x6A, 0x4A, 0xC7, 0x39, 0x53, 0x58, 0xBE, 0x00, 0xA6, 0x58, 0x01, 0x5B, 0x00, 0x60, 0x01,
+0x58, 0x01, 0xAE, 0x03, 0x58, 0x5D, 0x01, 0xBB, 0x9E, 0x67, 0x00, 0xAE, 0x00, 0x67, 0x60, 0x5D,
+0x60, 0x67, 0x6C, 0x01, 0x60, 0x00, 0x5D, 0x01, 0x60, 0x67, 0x60, 0x5B, 0x58, 0x60, 0x02, 0x5B,
+0x00, 0x58, 0x5B, 0x60, 0x5B, 0x58, 0x53, 0x60, 0x5B, 0x58, 0x01, 0x5B, 0x60, 0x00, 0x58, 0x00,
+0x60, 0x5B, 0x58, 0x53, 0x4C, 0x01, 0x58, 0xC0, 0x66, 0x29, 0x95, 0xC6, 0xAA, 0x4A, 0xF7, 0xAD,
+0x9E, 0xE7, 0x58, 0xB6, 0x71, 0x7C, 0xF7, 0xB5, 0xFF, 0xF7, 0x52, 0xC0, 0x79, 0xBE, 0xAE, 0xCA,
+0x1B, 0xCF, 0x34, 0x95, 0xE6, 0x29, 0x83, 0x21, 0x03, 0x4A, 0x2E, 0xB5, 0x14, 0xFF, 0xB2, 0xEE,
+0xB4, 0xEE, 0x36, 0xF7, 0x78, 0xFF, 0xA4, 0xCB, 0x2F, 0xE6, 0x6A, 0xCD, 0xCB, 0xD5, 0xEF, 0xE6,
+0xAF, 0xCE, 0xA9, 0x74, 0x25, 0x23, 0xC6, 0x3A, 0x11, 0xED, 0xE2, 0xB8, 0x41, 0xE8, 0x00, 0xF8,
+0xE0, 0x14, 0xC0, 0x81, 0xD0, 0x49, 0xC6, 0x15, 0xC6, 0xCF, 0x8C, 0x2C, 0x6C, 0x87, 0x32, 0x07,
+0x4B, 0x6E, 0xAD, 0x91, 0xE6, 0xA2, 0xC2, 0xF5, 0xF6, 0x9B, 0xFF, 0xBE, 0xFF, 0x9A, 0xB8, 0xC2,
+0xFA, 0xFF, 0x15, 0xFF, 0x2B, 0xBD, 0xA9, 0xC2, 0x72, 0xFF, 0x8D, 0xBD, 0x63, 0x29, 0x83, 0xC3,
+0x50, 0x74, 0x3B, 0xCF, 0x37, 0xA6, 0xB0, 0x74, 0x91, 0xC0, 0x0D, 0x5C, 0x81, 0xBF, 0xC5, 0x4B,
+0x43, 0xA9, 0x3A, 0x34, 0x9D, 0x55, 0xAD, 0xD0, 0x7B, 0x8A, 0x52, 0x96, 0xC0, 0xAB, 0x52, 0x4C,
+0x00, 0xAB, 0xC0, 0x08, 0x42, 0x00, 0x96, 0x00, 0xBA, 0x01, 0x60, 0x02, 0x58, 0x01, 0xAE, 0x03,
+0x58, 0x00, 0x5D, 0xBF, 0x06, 0xA6, 0x60, 0x00, 0x67, 0x6C, 0x02, 0x60, 0x5D, 0x02, 0x6C, 0x60,
+0x58, 0x00, 0x5B, 0x60, 0x00, 0x5B, 0x67, 0x60, 0x58, 0x60, 0x67, 0x00, 0x58, 0x53, 0x60, 0x58,
+0x53, 0x00, 0x58, 0x60, 0x00, 0x67, 0x58, 0x03, 0x53, 0x4C, 0xA6, 0x5B, 0x4C, 0x00, 0x96, 0x95,
+0xC4, 0x49, 0x3A, 0xEF, 0x6B, 0x6D, 0x5B, 0x69, 0x42, 0x4D, 0x5B, 0x91, 0xC1, 0x28, 0x3A, 0xEB,
+0x4A, 0xA6, 0x95, 0xC0, 0xC6, 0x29, 0xA5, 0xA4, 0xC1, 0xE9, 0x8B, 0x92, 0xE6, 0x5E, 0xAB, 0xC0,
+0x9A, 0xFF, 0x57, 0xA5, 0xC1, 0xFB, 0xFF, 0x76, 0xFF, 0x72, 0xC0, 0x2A, 0xC5, 0x41, 0xC2, 0xEF,
+0xEE, 0x8B, 0xA5, 0x25, 0x2B, 0x6D, 0xC3, 0x11, 0xED, 0xE2, 0xB8, 0x41, 0xE0, 0x00, 0xF8, 0xE0,
+0x14, 0x69, 0x49, 0xC6, 0x15, 0xC6, 0xCF, 0x94, 0x2D, 0x74, 0x67, 0x3A, 0xC7, 0x4A, 0x2C, 0xAD,
+0xB1, 0xEE, 0xAB, 0xC2, 0x79, 0xFF, 0xFF, 0xFF, 0x9F, 0xEF, 0x00, 0xA8, 0xC0, 0x7A, 0xF7, 0xBC,
+0xC2, 0x92, 0xEE, 0xC8, 0xB4, 0xCF, 0xEE, 0x83, 0xC0, 0x05, 0x42, 0x61, 0xC2, 0x0F, 0x6C, 0x9C,
+0xD7, 0xFE, 0xDF, 0x00, 0xA5, 0xC8, 0xB8, 0xB6, 0x12, 0x7D, 0x0E, 0x64, 0x88, 0x3A, 0x44, 0x19,
+0x51, 0x8C, 0x14, 0xA5, 0x8F, 0x7B, 0x8B, 0x52, 0xBE, 0xC1, 0xEC, 0x5A, 0xC8, 0x39, 0xA5, 0x4C,
+0xC0, 0x08, 0x42, 0x67, 0xA5, 0x02, 0x60, 0x02, 0x67, 0x99, 0x60, 0x02, 0x5D, 0x58, 0x02, 0x60,
+0x6C, 0x03, 0x67, 0x00, 0x6C, 0x01, 0x67, 0x60, 0x00, 0x6C, 0x02, 0x67, 0x60, 0x58, 0x00, 0x6C,
+0x67, 0x58, 0x00, 0x5B, 0x60, 0x00, 0x58, 0x67, 0x60, 0x5B, 0x60, 0x67, 0x00, 0x5B, 0x53, 0x60,
+0x58, 0x53, 0x00, 0x5B, 0x67, 0x00, 0x60, 0x58, 0x03, 0x53, 0x4C, 0x47, 0xBF, 0x81, 0x44, 0xAE,
+0x96, 0xC2, 0x2C, 0x53, 0x39, 0xBE, 0xFB, 0xD6, 0xAB, 0xC4, 0x79, 0xC6, 0x8E, 0x6B, 0x69, 0x42,
+0x14, 0x95, 0x55, 0x9D, 0x6B, 0xC4, 0x07, 0x32, 0x64, 0x21, 0x82, 0x31, 0x0D, 0xB5, 0x13, 0xF7,
+0x92, 0xC1, 0x98, 0xFF, 0xFD, 0xFF, 0x93, 0x00, 0xBC, 0xCB, 0xD9, 0xFF, 0x34, 0xFF, 0xCD, 0xDD,
+0x2A, 0xCD, 0x8F, 0xF6, 0x6B, 0xAD, 0x46, 0x33, 0xE7, 0x42, 0x32, 0xED, 0xE3, 0xB8, 0x41, 0xE8,
+0x00, 0xF8, 0xE0, 0x14, 0xC5, 0xA1, 0xD0, 0x98, 0xFE, 0x35, 0xCE, 0xF0, 0x94, 0x2D, 0x74, 0xC8,
+0x4A, 0xA4, 0xC4, 0xAA, 0xA4, 0x4F, 0xDE, 0xB2, 0xF6, 0xB9, 0xFF, 0xFF, 0xFF, 0x96, 0x9A, 0xBE,
+0xC0, 0x5A, 0xF7, 0xBC, 0xC5, 0xD3, 0xFE, 0x87, 0xB4, 0x2C, 0xE6, 0x2F, 0xDE, 0x66, 0x52, 0x86,
+0x21, 0x89, 0xC0, 0x2A, 0x3B, 0x73, 0xCD, 0x57, 0xA6, 0x3A, 0xC7, 0xFD, 0xDF, 0x9C, 0xD7, 0xD9,
+0xC6, 0x74, 0x9D, 0x0F, 0x7C, 0xB7, 0xBD, 0xF4, 0xAC, 0x4E, 0x73, 0x49, 0x4A, 0xAB, 0x5A, 0xEC,
+0x5A, 0xE8, 0x39, 0x4C, 0xAB, 0x60, 0xAB, 0x60, 0xA6, 0x60, 0x02, 0x67, 0x01, 0x60, 0x00, 0x67,
+0xAE, 0x67, 0x60, 0x58, 0x00, 0x5B, 0x60, 0x00, 0x6C, 0x03, 0x60, 0x67, 0x6C, 0x01, 0x67, 0x60,
+0x58, 0x67, 0x6C, 0x01, 0x67, 0x00, 0x60, 0x5B, 0x6C, 0x67, 0x60, 0x5B, 0x01, 0x58, 0x00, 0x60,
+0x04, 0x58, 0x00, 0x67, 0x5B, 0x58, 0x00, 0x67, 0x6C, 0x67, 0x58, 0x01, 0x53, 0x58, 0x00, 0x53,
+0x4C, 0x44, 0xBB, 0xA9, 0x44, 0xC0, 0x46, 0x29, 0x58, 0xC0, 0x55, 0xA5, 0x6E, 0x66, 0xC1, 0x5D,
+0xDF, 0xBF, 0xEF, 0x7E, 0xC0, 0xFC, 0xD6, 0x69, 0x66, 0xC5, 0x3D, 0xDF, 0x92, 0x84, 0x65, 0x29,
+0xA3, 0x39, 0x2D, 0xB5, 0xF2, 0xEE, 0x77, 0xC1, 0xFA, 0xFF, 0xDE, 0xFF, 0x71, 0x00, 0x65, 0xCB,
+0x99, 0xFF, 0x56, 0xFF, 0xEE, 0xE5, 0xA8, 0xC4, 0x6E, 0xF6, 0x8C, 0xBD, 0x66, 0x3B, 0x07, 0x4B,
+0x32, 0xF5, 0xE3, 0xB8, 0x41, 0xE8, 0x20, 0xF8, 0xA6, 0xE0, 0x13, 0xCC, 0xA2, 0xD8, 0xB8, 0xFE,
+0x35, 0xCE, 0x10, 0x95, 0x4E, 0x7C, 0xA8, 0x42, 0xC7, 0x52, 0xCB, 0xA4, 0x4F, 0xDE, 0xF2, 0xFE,
+0xB8, 0xFF, 0xDD, 0xFF, 0x7E, 0xEF, 0x99, 0xC1, 0xBD, 0xEF, 0xBB, 0xFF, 0x59, 0xC8, 0x30, 0xEE,
+0x67, 0xB4, 0xAF, 0xF6, 0x0E, 0xDE, 0xE4, 0x39, 0xA6, 0x21, 0x85, 0x09, 0x67, 0x22, 0xCD, 0x43,
+0xBE, 0xBE, 0xC4, 0xF1, 0x7C, 0x37, 0xAE, 0xFA, 0xCE, 0x9D, 0xEF, 0x1C, 0xE7, 0xBA, 0xC4, 0x93,
+0x9C, 0x6E, 0x73, 0xEC, 0x5A, 0x4A, 0x4A, 0xAB, 0x52, 0x58, 0x01, 0x60, 0x00, 0x58, 0x60, 0x05,
+0xAB, 0x5B, 0x60, 0x67, 0x6C, 0x00, 0x67, 0x60, 0x58, 0x67, 0x00, 0x60, 0x01, 0x67, 0x6C, 0x00,
+0x60, 0x05, 0x5B, 0x6C, 0x00, 0x67, 0x60, 0x01, 0x67, 0x00, 0x60, 0x67, 0x00, 0x60, 0x00, 0x58,
+0x02, 0x60, 0x02, 0x58, 0x01, 0x6C, 0x60, 0x5B, 0x60, 0xBF, 0x00, 0x60, 0x92, 0x58, 0x00, 0xA5,
+0x53, 0x58, 0x00, 0x4C, 0x7F, 0xA1, 0xC0, 0xA8, 0x39, 0x53, 0x81, 0x40, 0xC0, 0x7A, 0xC6, 0xAE,
+0xC3, 0x6E, 0x63, 0xE8, 0x31, 0xAF, 0x6B, 0x5D, 0xE7, 0x71, 0xC1, 0xB7, 0xAD, 0xD3, 0x8C, 0x7E,
+0xC6, 0x59, 0xBE, 0xC7, 0x31, 0xA4, 0x39, 0xCC, 0xA4, 0xD1, 0xE6, 0x13, 0xF7, 0xD9, 0xFF, 0x5E,
+0x71, 0x96, 0xA9, 0xCB, 0xBA, 0xFF, 0x76, 0xFF, 0x4F, 0xEE, 0xC8, 0xBC, 0x6F, 0xF6, 0x6C, 0xBD,
+0x67, 0x3B, 0x07, 0x43, 0x32, 0xED, 0xE2, 0xB8, 0x41, 0xE8, 0x20, 0xF8, 0x5D, 0xE0, 0x10, 0x62,
+0x5D, 0x00, 0xC5, 0xC2, 0xD8, 0xB9, 0xFE, 0x56, 0xD6, 0x30, 0x9D, 0x6E, 0x7C, 0x87, 0x3A, 0xBD,
+0xC0, 0xAA, 0x94, 0x74, 0xC3, 0x12, 0xFF, 0xB6, 0xFF, 0xDB, 0xFF, 0xFD, 0xFF, 0x97, 0xCB, 0x7B,
+0xEF, 0xDA, 0xFF, 0x35, 0xFF, 0xCE, 0xDD, 0xA8, 0xBC, 0x11, 0xFF, 0x2C, 0xBD, 0xC4, 0x39, 0x65,
+0x11, 0x27, 0x1A, 0xCC, 0x43, 0x4E, 0x54, 0x91, 0xC0, 0xAC, 0x4B, 0xA1, 0xC7, 0xA5, 0x21, 0x68,
+0x42, 0xAE, 0x73, 0xB2, 0x9C, 0x96, 0xBD, 0x6E, 0x73, 0x0C, 0x63, 0x4A, 0x4A, 0x58, 0xC0, 0x6A,
+0x4A, 0x4C, 0x58, 0x5B, 0xAE, 0x5B, 0x58, 0x60, 0x04, 0x67, 0x00, 0x58, 0x5B, 0x67, 0xBE, 0x00,
+0x9A, 0x67, 0x60, 0x6F, 0x6C, 0x60, 0x02, 0x67, 0x6C, 0x00, 0x60, 0x00, 0x5B, 0x01, 0x60, 0x00,
+0x6F, 0x6C, 0x60, 0x5B, 0x00, 0x60, 0x6C, 0xBE, 0x5B, 0x67, 0x6C, 0x00, 0x60, 0x58, 0x02, 0x60,
+0x67, 0x60, 0x58, 0x02, 0x6C, 0x60, 0x00, 0x6C, 0x74, 0x00, 0x60, 0x4C, 0x58, 0xA6, 0x4C, 0x00,
+0x58, 0x00, 0x4C, 0x96, 0xBA, 0xAB, 0x91, 0x85, 0xCA, 0x8A, 0x4A, 0x1C, 0xDF, 0x18, 0xB6, 0x08,
+0x32, 0xA7, 0x29, 0xCC, 0x52, 0x1D, 0xDF, 0xFF, 0xF7, 0x2D, 0x5B, 0x86, 0x21, 0x59, 0xBE, 0x46,
+0xC6, 0x28, 0x3A, 0x63, 0x29, 0x4A, 0x8C, 0xF2, 0xEE, 0x54, 0xF7, 0xD8, 0xFF, 0xFD, 0xFF, 0x93,
+0x69, 0xBD, 0xCB, 0x99, 0xFF, 0x14, 0xF7, 0x4F, 0xE6, 0x09, 0xC5, 0xB0, 0xFE, 0x2B, 0xAD, 0x67,
+0x3B, 0xE7, 0x42, 0x11, 0xED, 0xC2, 0xB8, 0x41, 0xE8, 0x20, 0xF8, 0xA6, 0xE0, 0x10, 0x62, 0x5D,
+0x00, 0xC9, 0xA1, 0xD0, 0xD9, 0xFE, 0x35, 0xCE, 0xEF, 0x94, 0x0C, 0x6C, 0xC7, 0x32, 0x44, 0x2A,
+0x25, 0x5B, 0xAD, 0xBD, 0x32, 0xFF, 0xAF, 0xC1, 0x97, 0xFF, 0xFB, 0xFF, 0x4B, 0x50, 0xAC, 0xC2,
+0x91, 0xEE, 0x6B, 0xCD, 0xD1, 0xFE, 0x97, 0xC4, 0xA8, 0x83, 0x22, 0x19, 0x85, 0x11, 0x8C, 0x3B,
+0x4E, 0x4C, 0x81, 0xCA, 0x2E, 0x4C, 0x8B, 0x43, 0xA8, 0x32, 0xA5, 0x19, 0x44, 0x19, 0x85, 0x29,
+0x28, 0x42, 0x66, 0x31, 0xC3, 0x20, 0xCB, 0x5A, 0x4D, 0x63, 0x4C, 0xC1, 0x69, 0x4A, 0x08, 0x42,
+0x00, 0x95, 0xC0, 0x49, 0x4A, 0x58, 0x74, 0x51, 0x65, 0x58, 0x4C, 0x58, 0x4C, 0x96, 0x58, 0x4C,
+0x58, 0x60, 0xA6, 0x58, 0x60, 0x65, 0x60, 0x00, 0x74, 0x51, 0x5B, 0xC0, 0x29, 0x4A, 0x60, 0x6C,
+0x6F, 0x51, 0x60, 0x65, 0x6C, 0x65, 0x60, 0x58, 0x01, 0x60, 0x00, 0x58, 0x60, 0x65, 0x60, 0x44,
+0x58, 0x60, 0x00, 0x6C, 0x79, 0x60, 0x4C, 0x60, 0x6C, 0x51, 0x4C, 0x00, 0x65, 0x4C, 0x58, 0x74,
+0x6C, 0x60, 0x40, 0x74, 0x58, 0x44, 0x60, 0x4C, 0x00, 0x51, 0x6C, 0x65, 0x4C, 0x60, 0x00, 0xC0,
+0x86, 0x31, 0xBF, 0x73, 0x96, 0x99, 0xC5, 0x8A, 0x4A, 0x7A, 0xC6, 0xFF, 0xF7, 0x34, 0x9D, 0x51,
+0x84, 0xBB, 0xCE, 0x6E, 0x91, 0xC0, 0xDB, 0xCE, 0x7D, 0xC6, 0x7D, 0xDF, 0x79, 0xBE, 0x28, 0x32,
+0x63, 0x19, 0x47, 0x6B, 0xB2, 0xDE, 0x74, 0xFF, 0x92, 0xC0, 0xFB, 0xFF, 0x63, 0xA6, 0xCA, 0x7B,
+0xF7, 0xD9, 0xFF, 0x13, 0xF7, 0xAB, 0xCD, 0x6D, 0xE6, 0xD0, 0xEE, 0x2B, 0xA5, 0xA4, 0x22, 0x48,
+0x4B, 0x53, 0xF5, 0xE3, 0xB8, 0x68, 0x5D, 0xE0, 0x14, 0xC1, 0xA1, 0xD0, 0xD9, 0xFE, 0x53, 0xC8,
+0xF0, 0x94, 0x2C, 0x6C, 0xA6, 0x22, 0x03, 0x12, 0x63, 0x32, 0x69, 0x8C, 0x8F, 0xDE, 0x73, 0xFF,
+0x95, 0xFF, 0xA7, 0xC3, 0xFA, 0xFF, 0x78, 0xFF, 0x55, 0xFF, 0x12, 0xFF, 0xA9, 0xA7, 0xC6, 0xEC,
+0xB4, 0xA2, 0x41, 0x84, 0x21, 0xE6, 0x19, 0xCD, 0x43, 0x6E, 0x44, 0x0D, 0x3C, 0xA5, 0xC3, 0xE9,
+0x2A, 0x06, 0x22, 0xA5, 0x21, 0x06, 0x32, 0xB7, 0x95, 0xC0, 0x04, 0x21, 0xAF, 0xC3, 0x4D, 0x63,
+0xAF, 0x73, 0xE8, 0x39, 0x29, 0x42, 0x51, 0x65, 0xA6, 0xC0, 0x69, 0x4A, 0x60, 0x00, 0xC0, 0x8A,
+0x52, 0x00, 0x74, 0x6C, 0x74, 0x6C, 0x40, 0xC0, 0x0C, 0x63, 0x95, 0x48, 0x40, 0x48, 0x79, 0x65,
+0x5B, 0x60, 0x00, 0x6C, 0x60, 0x74, 0x48, 0x65, 0x60, 0x74, 0x6C, 0x65, 0x6C, 0x74, 0x00, 0x65,
+0x6C, 0x40, 0x6C, 0x74, 0x00, 0x9A, 0x74, 0x79, 0x74, 0x60, 0x00, 0x79, 0x74, 0x00, 0x79, 0x6C,
+0x58, 0x60, 0x00, 0x6C, 0x74, 0x00, 0xC0, 0xCB, 0x5A, 0x48, 0x74, 0x6C, 0x60, 0x00, 0x74, 0x65,
+0x60, 0x58, 0x65, 0x60, 0x00, 0x74, 0x48, 0x74, 0x58, 0x60, 0x6C, 0x60, 0x6F, 0xC0, 0x87, 0x31,
+0x00, 0x58, 0xC3, 0x49, 0x3A, 0xD3, 0x8C, 0xBE, 0xE7, 0xFF, 0xF7, 0x00, 0xC1, 0x9E, 0xE7, 0xD7,
+0xAD, 0xA5, 0xC0, 0x5D, 0xDF, 0xAE, 0xC7, 0x59, 0xBE, 0x8E, 0x5B, 0x85, 0x19, 0x02, 0x11, 0x03,
+0x42, 0xEC, 0xAC, 0xF2, 0xEE, 0x54, 0xFF, 0x6A, 0xC5, 0xDA, 0xFF, 0xFC, 0xFF, 0x99, 0xFF, 0x96,
+0xFF, 0x53, 0xFF, 0xEF, 0xEE, 0xAE, 0xC2, 0xED, 0xC5, 0x07, 0x6C, 0xC4, 0x1A, 0x55, 0xC2, 0x53,
+0xF5, 0xE3, 0xB8, 0x41, 0xE8, 0x5D, 0xE0, 0x14, 0xCB, 0x81, 0xD0, 0xB9, 0xFE, 0x15, 0xCE, 0x10,
+0x95, 0x6D, 0x6C, 0x28, 0x2B, 0x85, 0x12, 0x02, 0x1A, 0xE4, 0x4A, 0xC9, 0x94, 0x8F, 0xDE, 0x73,
+0xFF, 0xAB, 0xC0, 0x97, 0xFF, 0x00, 0xA8, 0x50, 0xC8, 0xD1, 0xEE, 0x2C, 0xB5, 0xC7, 0x6A, 0x63,
+0x31, 0x64, 0x19, 0x06, 0x12, 0xED, 0x3B, 0x6E, 0x44, 0x0D, 0x3C, 0xA5, 0xC1, 0xA8, 0x22, 0xC5,
+0x19, 0xA6, 0x4C, 0xAB, 0xC0, 0xA6, 0x31, 0x91, 0xAF, 0xC2, 0x8E, 0x6B, 0x92, 0x8C, 0x8E, 0x73,
+0x91, 0x70, 0x44, 0x95, 0xC0, 0x6D, 0x6B, 0x44, 0x49, 0x58, 0x96, 0x44, 0x58, 0xC0, 0xCF, 0x7B,
+0x00, 0xC1, 0x51, 0x8C, 0x35, 0xA5, 0x00, 0xC1, 0x72, 0x8C, 0xF0, 0x7B, 0xAE, 0x6C, 0xC1, 0x0C,
+0x5B, 0x29, 0x42, 0x91, 0xC0, 0x8E, 0x73, 0x78, 0x00, 0x7D, 0xBA, 0xC0, 0xAE, 0x73, 0x00, 0x78,
+0xA5, 0x64, 0x00, 0xAE, 0x64, 0x55, 0x5D, 0xC0, 0xEF, 0x7B, 0x58, 0x69, 0x6C, 0x5D, 0x58, 0x5D,
+0x00, 0x58, 0x00, 0x71, 0x00, 0x64, 0x6C, 0x00, 0x64, 0x6C, 0x78, 0x5D, 0x70, 0xC0, 0xAB, 0x52,
+0x44, 0x58, 0x00, 0x49, 0x70, 0x50, 0x5D, 0x58, 0x5D, 0x6C, 0x00, 0x71, 0x50, 0x78, 0xC0, 0x30,
+0x84, 0x6C, 0x58, 0x00, 0x64, 0x71, 0x58, 0xBF, 0xCA, 0x92, 0x94, 0x34, 0x9D, 0x4D, 0x5B, 0x49,
+0x3A, 0x8D, 0x5B, 0x54, 0x9D, 0x96, 0xA5, 0x30, 0x74, 0xA6, 0x29, 0xE7, 0x29, 0xEF, 0x6B, 0x00,
+0xC2, 0xEB, 0x4A, 0xC2, 0x00, 0xA7, 0x21, 0xA4, 0xB8, 0xC3, 0x26, 0x6B, 0x8D, 0xC5, 0x12, 0xF7,
+0x94, 0xFF, 0xAB, 0xAB, 0xA6, 0x77, 0x98, 0x99, 0xC8, 0x2D, 0xC6, 0x48, 0x7C, 0xC3, 0x3A, 0xE5,
+0x1A, 0x49, 0x53, 0x53, 0xF5, 0xE3, 0xB8, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0x81, 0xD0,
+0xB8, 0xFE, 0x15, 0xCE, 0x30, 0x9D, 0xAE, 0x74, 0x48, 0x2B, 0x81, 0xC0, 0x64, 0x1A, 0xB0, 0xC5,
+0xC2, 0x4A, 0x47, 0x8C, 0xCD, 0xC5, 0xB1, 0xE6, 0xD3, 0xEE, 0x15, 0xF7, 0x94, 0xC3, 0xCF, 0xCD,
+0x28, 0x94, 0x22, 0x4A, 0x43, 0x29, 0x42, 0xC3, 0x85, 0x11, 0x06, 0x0A, 0xED, 0x3B, 0x4E, 0x3C,
+0xA5, 0xB1, 0xC1, 0x88, 0x2A, 0xC5, 0x19, 0xBA, 0xC2, 0x47, 0x32, 0x89, 0x42, 0x07, 0x3A, 0x81,
+0xC2, 0x45, 0x21, 0xE8, 0x31, 0x8A, 0x4A, 0xBE, 0x79, 0xAB, 0xC0, 0xCB, 0x5A, 0x40, 0x74, 0x02,
+0xC0, 0xE8, 0x39, 0x51, 0xC0, 0x29, 0x42, 0x74, 0x91, 0x6C, 0x5C, 0x91, 0x81, 0x58, 0x6C, 0x45,
+0xC2, 0x08, 0x3A, 0x24, 0x21, 0xC3, 0x18, 0x58, 0x48, 0xAF, 0x45, 0x79, 0x74, 0x79, 0x4D, 0x6C,
+0x45, 0x4D, 0x45, 0x79, 0x45, 0x4D, 0x00, 0x79, 0xC0, 0xAA, 0x4A, 0x4D, 0x45, 0x79, 0x00, 0x40,
+0x79, 0x74, 0x4D, 0x5C, 0x48, 0x00, 0x5C, 0xAE, 0x00, 0xC0, 0x2D, 0x63, 0x40, 0xC2, 0x65, 0x29,
+0x04, 0x21, 0xC7, 0x39, 0x6C, 0xA9, 0x00, 0x4C, 0x74, 0x79, 0x00, 0x40, 0x4D, 0x48, 0x4D, 0x6C,
+0x54, 0x00, 0x79, 0x74, 0x79, 0x40, 0x48, 0xA6, 0x61, 0x64, 0xC1, 0x71, 0x84, 0x2C, 0x53, 0x7F,
+0xC2, 0x64, 0x11, 0xCA, 0x42, 0x28, 0x32, 0x95, 0xC2, 0x65, 0x19, 0xE6, 0x29, 0x69, 0x3A, 0x44,
+0x73, 0xC0, 0x08, 0x2A, 0x92, 0xBD, 0xC6, 0x84, 0x31, 0xC3, 0x41, 0x66, 0x7B, 0xAD, 0xC5, 0xF1,
+0xF6, 0x32, 0xF7, 0x34, 0xFF, 0xAE, 0x75, 0xC8, 0x90, 0xDE, 0xCC, 0xB5, 0x47, 0x7C, 0x04, 0x43,
+0xC4, 0x2A, 0x26, 0x23, 0x69, 0x53, 0x73, 0xF5, 0xE3, 0xB8, 0x68, 0xC0, 0x00, 0xF8, 0xE0, 0x14,
+0xC5, 0x81, 0xD0, 0xB9, 0xFE, 0x15, 0xCE, 0x30, 0x9D, 0xAE, 0x74, 0x69, 0x2B, 0x9A, 0xC6, 0x07,
+0x2B, 0x64, 0x22, 0xE1, 0x21, 0x21, 0x3A, 0xC4, 0x5A, 0x87, 0x7B, 0x4A, 0x94, 0xA6, 0xC5, 0xC8,
+0x83, 0xE5, 0x62, 0xE2, 0x41, 0x62, 0x29, 0x65, 0x29, 0xC7, 0x29, 0x89, 0xC2, 0x47, 0x12, 0x0D,
+0x3C, 0x4D, 0x3C, 0xA6, 0xB2, 0xC3, 0x87, 0x2A, 0xC5, 0x21, 0xEA, 0x4A, 0x6C, 0x5B, 0x96, 0xC1,
+0x07, 0x32, 0x86, 0x29, 0x01, 0xA6, 0xC0, 0x04, 0x21, 0x00, 0xC1, 0x86, 0x31, 0xE7, 0x39, 0x00,
+0xC1, 0x45, 0x29, 0xE3, 0x18, 0x91, 0x50, 0x91, 0x00, 0xC0, 0x24, 0x21, 0x69, 0x55, 0x41, 0x7C,
+0x6D, 0x55, 0xAF, 0x91, 0xC0, 0x44, 0x21, 0x55, 0x41, 0x01, 0x4D, 0x55, 0x61, 0x69, 0x55, 0xC0,
+0xC3, 0x10, 0x4D, 0xA9, 0x75, 0x00, 0xC0, 0xE3, 0x10, 0x6D, 0xC0, 0x24, 0x19, 0x61, 0x4D, 0x55,
+0xC0, 0x65, 0x21, 0x69, 0x5A, 0x55, 0x5A, 0x61, 0x5A, 0x50, 0x55, 0x64, 0x55, 0x00, 0x64, 0x69,
+0x01, 0x55, 0x7C, 0x41, 0x55, 0x50, 0x7C, 0x6D, 0x64, 0x00, 0x50, 0x55, 0x50, 0x69, 0x55, 0x69,
+0x00, 0x78, 0x64, 0x41, 0x00, 0x55, 0x64, 0x55, 0x64, 0x55, 0x46, 0xC1, 0xA6, 0x29, 0x48, 0x32,
+0x54, 0xC2, 0x07, 0x2A, 0xA9, 0x3A, 0xE7, 0x29, 0x90, 0xAF, 0xC0, 0xA9, 0x42, 0x96, 0xC4, 0xE6,
+0x21, 0xC9, 0x3A, 0x28, 0x2A, 0x87, 0x21, 0xC8, 0x29, 0x7A, 0xC4, 0x42, 0x29, 0xA1, 0x39, 0x04,
+0x63, 0x89, 0x9C, 0xEE, 0xC5, 0xBF, 0x44, 0xC3, 0x4C, 0xB5, 0xCA, 0x9C, 0xA6, 0x63, 0xC3, 0x3A,
+0x59, 0xC0, 0x47, 0x2B, 0x9A, 0xC4, 0x89, 0x53, 0x73, 0xF5, 0xE2, 0xB8, 0x41, 0xE8, 0x00, 0xF8,
+0xE0, 0x14, 0xC5, 0xA1, 0xD0, 0xD9, 0xFE, 0x35, 0xCE, 0x30, 0x9D, 0x8E, 0x74, 0x89, 0x33, 0x81,
+0xC0, 0xE7, 0x1A, 0xB1, 0xC1, 0x44, 0x22, 0xE3, 0x29, 0xB6, 0xBE, 0xA5, 0xA5, 0x9A, 0xA7, 0x9B,
+0xC2, 0xE6, 0x39, 0x29, 0x3A, 0xC7, 0x21, 0x89, 0xC2, 0x27, 0x12, 0xED, 0x3B, 0x2D, 0x3C, 0xBB,
+0xC3, 0x2E, 0x54, 0x88, 0x32, 0x06, 0x2A, 0xCE, 0x63, 0x90, 0x00, 0xC1, 0x48, 0x32, 0xC6, 0x29,
+0x7A, 0xA6, 0xA5, 0xC0, 0xE3, 0x18, 0x00, 0xBF, 0x00, 0xC0, 0xC7, 0x39, 0x69, 0x50, 0x41, 0xC0,
+0x24, 0x21, 0x02, 0x69, 0x51, 0x4C, 0x55, 0x41, 0xC0, 0x48, 0x42, 0xBF, 0x75, 0xC0, 0x04, 0x19,
+0xA9, 0x55, 0xC0, 0xC7, 0x31, 0x69, 0x4D, 0x00, 0x75, 0xC0, 0x08, 0x3A, 0x7A, 0x46, 0x61, 0xC0,
+0x07, 0x32, 0x7B, 0xC0, 0x28, 0x3A, 0x52, 0xC0, 0xC2, 0x10, 0x66, 0x7A, 0x66, 0x00, 0xBE, 0x00,
+0x66, 0xA5, 0x66, 0xAE, 0x66, 0xC0, 0x86, 0x31, 0x02, 0x69, 0x78, 0xAE, 0x69, 0x7D, 0x78, 0x01,
+0x55, 0x01, 0x50, 0x78, 0x50, 0x91, 0x69, 0x50, 0x69, 0xA6, 0x78, 0x7D, 0x64, 0x55, 0x01, 0x69,
+0x78, 0x55, 0xBE, 0x6E, 0x7F, 0xC0, 0x27, 0x32, 0x00, 0xC2, 0x2B, 0x4B, 0xE6, 0x21, 0x88, 0x3A,
+0x00, 0xC0, 0xC5, 0x21, 0x00, 0xC0, 0xA9, 0x42, 0x9A, 0xC2, 0x47, 0x2A, 0x0A, 0x43, 0xA6, 0x19,
+0xBB, 0xC0, 0xE8, 0x29, 0x49, 0x6E, 0x60, 0xC2, 0x40, 0x21, 0x02, 0x3A, 0x4A, 0x8C, 0xA5, 0xC1,
+0x04, 0x63, 0x62, 0x4A, 0x9B, 0xC0, 0x23, 0x2A, 0x47, 0xC1, 0x27, 0x23, 0xA8, 0x2B, 0x96, 0xC2,
+0xAA, 0x5B, 0x73, 0xF5, 0xE2, 0xB8, 0x68, 0xC0, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0xA1, 0xD0, 0xF9,
+0xFE, 0x56, 0xCE, 0x30, 0x9D, 0x6D, 0x6C, 0xCA, 0x3B, 0x81, 0xC1, 0x07, 0x1B, 0x86, 0x1A, 0xA2,
+0xB7, 0xB2, 0xB5, 0xA4, 0xA9, 0xC0, 0xC5, 0x31, 0x42, 0x96, 0xAF, 0x4B, 0x74, 0x85, 0xC6, 0x06,
+0x0A, 0xEC, 0x3B, 0x2D, 0x3C, 0x4E, 0x4C, 0x2E, 0x5C, 0x88, 0x32, 0x06, 0x2A, 0xA6, 0xC1, 0x64,
+0x19, 0xA9, 0x3A, 0x00, 0xC0, 0x28, 0x3A, 0x91, 0xC0, 0x86, 0x29, 0xBE, 0xC1, 0x82, 0x10, 0xE3,
+0x18, 0x91, 0x91, 0xC0, 0xC7, 0x39, 0x00, 0x7D, 0x51, 0xC0, 0x86, 0x31, 0x4C, 0x69, 0x68, 0x59,
+0x69, 0x51, 0xC0, 0x24, 0x21, 0x61, 0xC0, 0x89, 0x4A, 0xBF, 0x62, 0x51, 0x7A, 0x00, 0x6A, 0xAB,
+0x90, 0x7A, 0x66, 0x7A, 0x7F, 0x61, 0xC0, 0x85, 0x29, 0x66, 0x7F, 0x7A, 0xC1, 0x24, 0x19, 0xC2,
+0x10, 0x52, 0x6B, 0x00, 0x7A, 0x01, 0x66, 0x6B, 0x7A, 0x00, 0x66, 0x61, 0x55, 0x64, 0x00, 0x55,
+0x7D, 0x00, 0x55, 0x78, 0xC0, 0x04, 0x21, 0x59, 0x91, 0x59, 0x4C, 0xC0, 0x49, 0x4A, 0x7D, 0x4C,
+0x69, 0x7D, 0xC0, 0xCB, 0x5A, 0x69, 0x55, 0x41, 0x50, 0x59, 0xC0, 0x00, 0x00, 0x7C, 0x4C, 0x78,
+0x64, 0x69, 0x50, 0x51, 0xC4, 0xCA, 0x52, 0x8D, 0x63, 0x2B, 0x53, 0xC5, 0x21, 0xC9, 0x42, 0x49,
+0xC0, 0x4B, 0x4B, 0x49, 0x96, 0x00, 0xC0, 0x68, 0x32, 0xA9, 0x91, 0xC1, 0x0A, 0x43, 0x06, 0x22,
+0xA2, 0x00, 0xBF, 0x00, 0xAB, 0xC0, 0x65, 0x19, 0x6B, 0xCE, 0xE9, 0x4A, 0x29, 0x5B, 0x04, 0x3A,
+0x82, 0x29, 0xE4, 0x29, 0x45, 0x22, 0xC6, 0x1A, 0x87, 0x1B, 0x09, 0x24, 0xA8, 0x23, 0xAA, 0x5B,
+0x73, 0xF5, 0xE2, 0xB8, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x14, 0xC1, 0xA2, 0xD0, 0xFA, 0xFE, 0x5F,
+0xC2, 0x30, 0x95, 0x4C, 0x6C, 0x89, 0x3B, 0x9E, 0xC0, 0x28, 0x2B, 0x57, 0xC1, 0x06, 0x12, 0x08,
+0x1A, 0xB7, 0xA0, 0x53, 0x90, 0x70, 0xAB, 0x43, 0x7E, 0x43, 0xC3, 0x27, 0x2A, 0xC5, 0x11, 0x47,
+0x12, 0x0D, 0x44, 0xAF, 0x67, 0xB2, 0xC5, 0x06, 0x2A, 0x84, 0x21, 0xCA, 0x4A, 0x48, 0x32, 0x6C,
+0x53, 0x89, 0x3A, 0x7A, 0x00, 0xA6, 0xA6, 0xA5, 0x74, 0xC0, 0x8A, 0x52, 0x95, 0xC0, 0x10, 0x84,
+0x95, 0x91, 0x71, 0x5D, 0x40, 0xC4, 0x6E, 0x73, 0xE7, 0x39, 0x86, 0x31, 0x4D, 0x6B, 0x51, 0x8C,
+0x71, 0x5D, 0xC0, 0x30, 0x84, 0x96, 0x71, 0xAE, 0xC1, 0x2C, 0x5B, 0x28, 0x3A, 0xBA, 0xC5, 0x51,
+0x84, 0x91, 0x8C, 0x6D, 0x6B, 0x65, 0x29, 0x03, 0x11, 0xA5, 0x29, 0x96, 0x91, 0xBA, 0xAF, 0x7A,
+0x7F, 0x7A, 0x66, 0x7A, 0xC0, 0x07, 0x32, 0x7A, 0x00, 0x6E, 0x66, 0x6B, 0x7A, 0x00, 0x66, 0x69,
+0x78, 0xAF, 0x78, 0xAE, 0x79, 0x00, 0x7D, 0x00, 0xC1, 0xE4, 0x18, 0x20, 0x00, 0xBE, 0x78, 0xC2,
+0x71, 0x94, 0xD3, 0x9C, 0x4C, 0x6B, 0x00, 0x96, 0xC4, 0x30, 0x8C, 0x75, 0xAD, 0xEB, 0x62, 0xA6,
+0x31, 0xE3, 0x20, 0xAE, 0xC0, 0xA2, 0x18, 0x91, 0xC3, 0x69, 0x52, 0x71, 0x94, 0x0F, 0x84, 0x6D,
+0x6B, 0xA5, 0xCA, 0xCA, 0x5A, 0xB2, 0x94, 0x33, 0xA5, 0x74, 0xA5, 0x0E, 0x74, 0xA5, 0x21, 0xC9,
+0x42, 0x26, 0x2A, 0x2B, 0x4B, 0x68, 0x32, 0xA9, 0x3A, 0xA1, 0x7D, 0x45, 0x81, 0xC1, 0x2A, 0x43,
+0x27, 0x2A, 0xA6, 0x91, 0x50, 0x92, 0x96, 0xC0, 0x09, 0x2A, 0x95, 0xC1, 0x85, 0x11, 0x06, 0x2A,
+0xA1, 0x70, 0xC4, 0x06, 0x22, 0x66, 0x1A, 0xA6, 0x12, 0x47, 0x13, 0x09, 0x24, 0xA2, 0xC2, 0xAA,
+0x5B, 0x73, 0xFD, 0xC2, 0xB8, 0x68, 0xC0, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0xA2, 0xD0, 0x5B, 0xFF,
+0x14, 0xC6, 0x10, 0x95, 0x6C, 0x6C, 0xC8, 0x43, 0x81, 0xC1, 0x07, 0x2B, 0xA8, 0x22, 0xB3, 0xA6,
+0x92, 0xA1, 0xAD, 0x03, 0xBB, 0x50, 0x00, 0x89, 0x85, 0xC1, 0xED, 0x3B, 0x6E, 0x4C, 0xA2, 0xB2,
+0xC4, 0x47, 0x2A, 0x64, 0x19, 0x27, 0x32, 0xEA, 0x4A, 0x69, 0x3A, 0x7A, 0x00, 0x42, 0xBF, 0x4C,
+0x95, 0xC1, 0x6E, 0x73, 0xAF, 0x7B, 0x90, 0xC0, 0xAE, 0x7B, 0x96, 0x91, 0x91, 0x44, 0xC0, 0x51,
+0x8C, 0x58, 0xC0, 0xEB, 0x5A, 0xA6, 0xC0, 0x6D, 0x6B, 0x58, 0x44, 0x64, 0xC0, 0x4C, 0x6B, 0x00,
+0xC0, 0x8D, 0x73, 0x49, 0xC3, 0x07, 0x3A, 0x44, 0x29, 0xE7, 0x39, 0x50, 0x8C, 0x96, 0xC3, 0x2C,
+0x63, 0xA6, 0x31, 0x03, 0x19, 0x07, 0x32, 0xA5, 0x7F, 0xC0, 0x24, 0x19, 0xBF, 0xC0, 0xE7, 0x31,
+0x53, 0x77, 0xC1, 0x27, 0x32, 0x89, 0x42, 0x7F, 0xC0, 0x65, 0x21, 0x7D, 0x95, 0xA6, 0x00, 0xAF,
+0x99, 0xC1, 0x04, 0x19, 0x66, 0x29, 0x01, 0x4D, 0xC5, 0xE6, 0x39, 0x24, 0x21, 0xC7, 0x39, 0x69,
+0x4A, 0xE8, 0x41, 0x46, 0x29, 0xBE, 0xC5, 0x00, 0x00, 0xC5, 0x41, 0xD5, 0xC5, 0x33, 0xB5, 0xAD,
+0x83, 0xEE, 0x83, 0x91, 0xBB, 0xC2, 0x78, 0xD6, 0xEA, 0x62, 0x03, 0x29, 0x95, 0xD0, 0xA5, 0x39,
+0xE6, 0x41, 0x85, 0x39, 0x8D, 0x7B, 0xF6, 0xC5, 0x2F, 0x8C, 0x8D, 0x73, 0x50, 0x94, 0x4C, 0x73,
+0xB1, 0xA4, 0xD6, 0xC5, 0x0F, 0x84, 0x89, 0x4A, 0xC5, 0x29, 0x09, 0x4B, 0x46, 0x32, 0x2A, 0x4B,
+0x58, 0xC0, 0xA9, 0x42, 0x7B, 0xC1, 0xEA, 0x4A, 0x67, 0x32, 0x5A, 0xC1, 0x4B, 0x4B, 0xE6, 0x21,
+0xBB, 0x00, 0x9A, 0xAF, 0xBF, 0xA5, 0x85, 0xAE, 0xC0, 0xA6, 0x19, 0x48, 0x57, 0x9D, 0xC9, 0x67,
+0x1A, 0xE7, 0x12, 0x68, 0x23, 0xC9, 0x23, 0x0A, 0x34, 0xAA, 0x5B, 0x32, 0xF5, 0xC2, 0xB8, 0x61,
+0xE8, 0x00, 0xF8, 0xE0, 0x14, 0xC0, 0xA2, 0xD0, 0x7C, 0xC3, 0x14, 0xBE, 0x30, 0x95, 0x6C, 0x6C,
+0xA8, 0x43, 0xAF, 0xC1, 0x69, 0x3B, 0x67, 0x22, 0x45, 0x48, 0x57, 0x00, 0xC0, 0x48, 0x2A, 0x48,
+0xA5, 0xC0, 0x07, 0x2A, 0xA7, 0x77, 0xAF, 0x61, 0xC4, 0xE6, 0x11, 0x26, 0x12, 0x2E, 0x44, 0x8F,
+0x54, 0x2E, 0x4C, 0xA1, 0x61, 0xC0, 0xE6, 0x21, 0x91, 0x50, 0x7F, 0x7A, 0xBF, 0xBA, 0x95, 0x69,
+0xA6, 0xBF, 0xC3, 0xA6, 0x39, 0x08, 0x42, 0xA7, 0x39, 0x24, 0x29, 0x64, 0xC2, 0xE3, 0x20, 0x28,
+0x4A, 0xCB, 0x5A, 0x60, 0x64, 0x91, 0xC0, 0x65, 0x31, 0x00, 0x64, 0xBA, 0x00, 0x80, 0xC2, 0x44,
+0x29, 0x85, 0x31, 0xE3, 0x18, 0xA5, 0x5D, 0xC0, 0xE7, 0x41, 0x95, 0x68, 0x81, 0x46, 0x7F, 0xC0,
+0xA9, 0x42, 0xBF, 0xC0, 0x08, 0x3A, 0x91, 0x7A, 0x00, 0xC1, 0xE6, 0x29, 0x89, 0x3A, 0xBA, 0x53,
+0x6E, 0x42, 0x7D, 0x6E, 0x64, 0x9A, 0x7A, 0x00, 0xC0, 0x25, 0x21, 0x6B, 0xC8, 0x86, 0x29, 0xC3,
+0x10, 0x44, 0x21, 0xC2, 0x10, 0x03, 0x21, 0xA7, 0x31, 0xE4, 0x20, 0x26, 0x29, 0x6A, 0x52, 0x67,
+0xC3, 0x47, 0x52, 0x12, 0xAD, 0x91, 0xA4, 0xCE, 0x8B, 0x9A, 0x91, 0x68, 0xC7, 0xB5, 0xC5, 0xEA,
+0x62, 0x23, 0x31, 0xA1, 0x18, 0x44, 0x31, 0x28, 0x52, 0x23, 0x29, 0x6C, 0x73, 0x4D, 0xC0, 0x91,
+0x9C, 0x68, 0xC0, 0x0F, 0x8C, 0xA5, 0xC0, 0x54, 0xBD, 0x86, 0xC3, 0x50, 0x8C, 0x4C, 0x63, 0xA5,
+0x21, 0xE9, 0x42, 0x56, 0xC1, 0x87, 0x3A, 0xE6, 0x29, 0x7F, 0x70, 0x4F, 0x99, 0xC2, 0x26, 0x2A,
+0xC9, 0x3A, 0x27, 0x2A, 0xA2, 0x57, 0xAF, 0x9A, 0x48, 0x74, 0xAD, 0xC0, 0x27, 0x22, 0xBB, 0x48,
+0x77, 0x9E, 0xC3, 0x25, 0x12, 0xA6, 0x12, 0x68, 0x23, 0x2B, 0x3C, 0x95, 0xC4, 0xCA, 0x5B, 0x52,
+0xF5, 0xE2, 0xB8, 0x61, 0xE8, 0x00, 0xF8, 0xE0, 0x14, 0xC5, 0xA1, 0xC8, 0x3A, 0xFF, 0x14, 0xBE,
+0x30, 0x95, 0x8D, 0x6C, 0xCA, 0x3B, 0x92, 0xC1, 0x09, 0x2B, 0x89, 0x2A, 0xA1, 0xB6, 0xA4, 0x91,
+0x4C, 0xC0, 0xA4, 0x29, 0x96, 0x7F, 0xC0, 0x08, 0x32, 0xAB, 0x91, 0x85, 0x84, 0xC2, 0x05, 0x0A,
+0xED, 0x43, 0x6E, 0x4C, 0xA2, 0xA1, 0xC0, 0x88, 0x32, 0x55, 0x00, 0xBA, 0x44, 0xBB, 0xBF, 0x90,
+0x91, 0xA6, 0xA6, 0xC0, 0xE4, 0x20, 0xA9, 0xC0, 0xC7, 0x39, 0xBF, 0x90, 0xC0, 0xE7, 0x41, 0x4C,
+0xC1, 0x08, 0x42, 0x49, 0x4A, 0x40, 0x91, 0x64, 0x6C, 0xAF, 0xC1, 0xC6, 0x39, 0x49, 0x52, 0x80,
+0x6C, 0xC1, 0xA6, 0x31, 0xE7, 0x39, 0xA9, 0x59, 0x00, 0xC0, 0x69, 0x52, 0x91, 0x7C, 0x99, 0xC2,
+0x64, 0x21, 0x03, 0x11, 0x43, 0x19, 0x7F, 0xC0, 0x8A, 0x42, 0x00, 0x4E, 0xC0, 0x64, 0x19, 0xAF,
+0xC0, 0xC6, 0x21, 0xA5, 0xA5, 0xAB, 0xBE, 0x6E, 0x00, 0xC0, 0xC7, 0x31, 0x95, 0xAF, 0xC1, 0x66,
+0x21, 0xA7, 0x29, 0xA6, 0xC1, 0xE8, 0x31, 0x24, 0x19, 0x73, 0xA5, 0xC4, 0x24, 0x21, 0xA7, 0x31,
+0x05, 0x21, 0xA7, 0x39, 0x4D, 0x6B, 0x54, 0xC4, 0x44, 0x31, 0xA9, 0x5A, 0xEB, 0x6A, 0x8D, 0x7B,
+0xAA, 0x5A, 0x40, 0xC2, 0x45, 0x31, 0x69, 0x52, 0xE7, 0x41, 0x40, 0xC0, 0x03, 0x21, 0x6C, 0x54,
+0xC0, 0x81, 0x10, 0x54, 0xC2, 0x2C, 0x6B, 0xCB, 0x62, 0x8D, 0x7B, 0x81, 0x50, 0xC2, 0x6D, 0x73,
+0xEB, 0x62, 0x10, 0x84, 0x85, 0xC5, 0xC5, 0x21, 0x0A, 0x43, 0x87, 0x32, 0xC8, 0x3A, 0x68, 0x32,
+0xAA, 0x42, 0x58, 0xC0, 0x89, 0x42, 0xAE, 0x69, 0xC0, 0xAA, 0x3A, 0x79, 0xC0, 0x28, 0x2A, 0x9A,
+0x96, 0x00, 0xC1, 0x08, 0x2A, 0x48, 0x32, 0xA9, 0x91, 0xA6, 0x73, 0x00, 0xCA, 0x05, 0x22, 0xA6,
+0x1A, 0x28, 0x1B, 0x89, 0x23, 0xCA, 0x23, 0xEA, 0x33, 0xCA, 0x5B, 0x72, 0xF5, 0xE2, 0xB8, 0x41,
+0xE8, 0x00, 0xF8, 0xE0, 0x14, 0xC8, 0x81, 0xC8, 0x3A, 0xFF, 0x14, 0xBE, 0x30, 0x95, 0x8D, 0x6C,
+0xCB, 0x3B, 0x6A, 0x2B, 0x09, 0x2B, 0xA8, 0x2A, 0x49, 0xC6, 0xA4, 0x21, 0xC4, 0x31, 0x65, 0x4A,
+0xC6, 0x52, 0x07, 0x5B, 0x85, 0x4A, 0xA3, 0x31, 0x83, 0xC6, 0xC7, 0x31, 0xE9, 0x31, 0x87, 0x21,
+0xC6, 0x11, 0x47, 0x12, 0xED, 0x43, 0x4E, 0x4C, 0x00, 0xB2, 0xC1, 0x88, 0x2A, 0x07, 0x22, 0xBA,
+0xA6, 0x44, 0xBB, 0x49, 0xA5, 0x00, 0xAE, 0xC0, 0x0C, 0x63, 0xBE, 0xC0, 0xE7, 0x41, 0x6C, 0x54,
+0x91, 0x96, 0x40, 0xC0, 0x08, 0x42, 0x54, 0x78, 0x40, 0xAB, 0xAE, 0x60, 0x7C, 0x77, 0x80, 0xC0,
+0x85, 0x31, 0x40, 0x45, 0x7D, 0x54, 0x40, 0x00, 0x59, 0x54, 0xC3, 0x89, 0x4A, 0x2C, 0x63, 0x68,
+0x42, 0x84, 0x21, 0x58, 0xC1, 0x86, 0x21, 0x28, 0x32, 0xBE, 0x44, 0x91, 0xAE, 0xC2, 0x06, 0x2A,
+0x68, 0x3A, 0xA9, 0x42, 0x67, 0x7A, 0x90, 0x53, 0x00, 0xAF, 0xC0, 0x45, 0x19, 0x5A, 0xC0, 0xA6,
+0x21, 0x5F, 0xC1, 0x65, 0x21, 0x47, 0x3A, 0x6F, 0x66, 0xBA, 0xAF, 0xBB, 0xC0, 0x8A, 0x52, 0x69,
+0xC3, 0x60, 0x10, 0x03, 0x21, 0x44, 0x31, 0x49, 0x52, 0x9A, 0xC2, 0xE3, 0x20, 0x20, 0x08, 0x61,
+0x08, 0x49, 0x78, 0xC0, 0x24, 0x29, 0x78, 0x7D, 0xC1, 0xA2, 0x10, 0xE3, 0x18, 0x49, 0x00, 0xC0,
+0x69, 0x4A, 0x91, 0xC1, 0x44, 0x29, 0xC3, 0x18, 0x91, 0xC8, 0x08, 0x3A, 0x6A, 0x42, 0x44, 0x09,
+0xE9, 0x3A, 0x05, 0x1A, 0xC8, 0x3A, 0x47, 0x32, 0x4C, 0x53, 0xEA, 0x4A, 0x92, 0xA5, 0x6C, 0xC2,
+0xEB, 0x42, 0x49, 0x2A, 0xE7, 0x19, 0x00, 0xAF, 0xBE, 0x53, 0xA0, 0x99, 0xBA, 0xC0, 0x45, 0x42,
+0x00, 0x95, 0x81, 0xC1, 0x64, 0x1A, 0x27, 0x23, 0x57, 0x9A, 0xC5, 0xE9, 0x2B, 0xCA, 0x5B, 0x73,
+0xFD, 0x02, 0xB9, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x14, 0xC2, 0x81, 0xC8, 0x3A, 0xFF, 0x14, 0xBE,
+0x73, 0xC4, 0x8D, 0x6C, 0x69, 0x2B, 0xAA, 0x2B, 0x49, 0x33, 0x65, 0x2A, 0x6F, 0xC4, 0xC5, 0x52,
+0x8B, 0x94, 0xF0, 0xC5, 0x50, 0xCE, 0x91, 0xD6, 0x63, 0xC7, 0x4B, 0x8C, 0x65, 0x52, 0x64, 0x31,
+0x66, 0x29, 0xE8, 0x31, 0x85, 0x11, 0x47, 0x1A, 0x0D, 0x44, 0xAF, 0x53, 0xB2, 0xC0, 0x68, 0x2A,
+0x4D, 0xC0, 0x48, 0x32, 0x50, 0x4B, 0x4E, 0xA6, 0xBA, 0x95, 0x95, 0xC3, 0xAE, 0x73, 0xEF, 0x83,
+0x69, 0x52, 0x65, 0x31, 0x78, 0xBE, 0x4C, 0x00, 0x40, 0x6C, 0x01, 0x78, 0x00, 0xC0, 0xC6, 0x39,
+0xBF, 0xA5, 0x45, 0x6C, 0x40, 0x7D, 0x6E, 0xC0, 0xE7, 0x39, 0x45, 0x91, 0xC0, 0x28, 0x4A, 0x96,
+0xC3, 0x89, 0x52, 0x6D, 0x6B, 0x89, 0x42, 0x84, 0x21, 0xAF, 0xAB, 0xC1, 0x08, 0x2A, 0x69, 0x3A,
+0x95, 0xC0, 0xC6, 0x21, 0xAE, 0xC0, 0x67, 0x32, 0xBF, 0xC0, 0x6C, 0x5B, 0x91, 0xC1, 0x68, 0x3A,
+0x64, 0x19, 0x4B, 0x50, 0x47, 0xC2, 0xE7, 0x21, 0x49, 0x32, 0xC6, 0x21, 0x6C, 0xC3, 0xA5, 0x19,
+0x47, 0x32, 0xE6, 0x29, 0x64, 0x21, 0x52, 0xC2, 0xA7, 0x31, 0xE4, 0x18, 0x44, 0x29, 0x96, 0xA4,
+0xBF, 0x92, 0xBF, 0xC0, 0x85, 0x31, 0x5D, 0x71, 0x81, 0xC0, 0xE3, 0x18, 0xA5, 0xC1, 0x03, 0x21,
+0xE7, 0x39, 0x5A, 0x5D, 0x49, 0x5D, 0x75, 0xAE, 0x55, 0x41, 0xBF, 0x48, 0xC0, 0x46, 0x19, 0xAE,
+0x85, 0xC2, 0x0B, 0x3B, 0xA4, 0x11, 0xA8, 0x32, 0x7C, 0x64, 0xA1, 0x7B, 0x47, 0xC1, 0x28, 0x32,
+0x6A, 0x3A, 0x81, 0xC1, 0xE6, 0x19, 0x27, 0x1A, 0xB9, 0xA5, 0xC4, 0xA3, 0x29, 0xE3, 0x39, 0x88,
+0x73, 0x4F, 0xAD, 0xF1, 0xC5, 0x90, 0xC2, 0xCB, 0x9C, 0x86, 0x63, 0xA2, 0x2A, 0x8B, 0xC1, 0x26,
+0x1B, 0xA9, 0x2B, 0x00, 0xC4, 0xA9, 0x5B, 0x72, 0xF5, 0xE2, 0xB8, 0x41, 0xE8, 0x00, 0xF8, 0xE0,
+0x14, 0xC5, 0xA1, 0xC8, 0x3A, 0xFF, 0x14, 0xBE, 0x30, 0x95, 0x8D, 0x6C, 0x69, 0x2B, 0xAE, 0xC4,
+0xE6, 0x2A, 0x63, 0x2A, 0x87, 0x6B, 0xCF, 0xBD, 0x34, 0xF7, 0xAD, 0xA5, 0x00, 0xC0, 0x74, 0xFF,
+0xA7, 0xC6, 0xD1, 0xC5, 0x49, 0x73, 0xA4, 0x39, 0x64, 0x21, 0x43, 0x09, 0x26, 0x1A, 0xED, 0x43,
+0xAE, 0xC0, 0xAC, 0x43, 0xA6, 0xC1, 0x88, 0x32, 0x07, 0x2A, 0x00, 0x7C, 0xB6, 0x95, 0xBB, 0x51,
+0x91, 0xC0, 0x44, 0x21, 0xA6, 0xA1, 0x00, 0xC0, 0x86, 0x31, 0xA5, 0x40, 0xC1, 0x8A, 0x52, 0x28,
+0x4A, 0x91, 0x45, 0x60, 0x54, 0x60, 0x68, 0x00, 0x54, 0x68, 0xBF, 0x54, 0x68, 0x9A, 0x45, 0xC1,
+0x48, 0x4A, 0x89, 0x52, 0x54, 0x40, 0x54, 0xC0, 0x27, 0x42, 0x51, 0x80, 0xC0, 0x27, 0x32, 0x50,
+0xC0, 0x69, 0x3A, 0x95, 0x00, 0x6E, 0xBF, 0x56, 0xC0, 0x6C, 0x53, 0xA9, 0xC6, 0x06, 0x22, 0xC9,
+0x42, 0x0A, 0x4B, 0x27, 0x2A, 0x68, 0x32, 0xE6, 0x21, 0xCA, 0x3A, 0x4D, 0xC0, 0x69, 0x32, 0x4D,
+0xC0, 0xEA, 0x42, 0x41, 0x62, 0xC4, 0xE5, 0x21, 0xAD, 0x6B, 0x0F, 0x7C, 0x8E, 0x73, 0xCA, 0x5A,
+0x00, 0x95, 0x90, 0xA6, 0x68, 0xC0, 0x69, 0x52, 0x46, 0xC3, 0x44, 0x29, 0xA1, 0x10, 0xA5, 0x31,
+0x68, 0x4A, 0x00, 0xC1, 0xE6, 0x39, 0xE2, 0x18, 0xBF, 0xC1, 0xCA, 0x52, 0x07, 0x3A, 0x91, 0x5A,
+0x00, 0xC2, 0x06, 0x3A, 0x64, 0x29, 0x07, 0x42, 0x52, 0xC6, 0x8E, 0x63, 0x2D, 0x53, 0x86, 0x11,
+0x69, 0x2A, 0xA5, 0x11, 0xC9, 0x32, 0xA6, 0x19, 0xBA, 0xC5, 0x24, 0x11, 0x08, 0x32, 0x8E, 0x6B,
+0x51, 0x7C, 0xAF, 0x63, 0x66, 0x19, 0x4D, 0xC7, 0x47, 0x22, 0xC4, 0x19, 0x81, 0x21, 0xE6, 0x5A,
+0x2E, 0xAD, 0xF4, 0xE6, 0xF8, 0xFF, 0x95, 0xFF, 0xA5, 0x95, 0xCA, 0xB0, 0xD6, 0x2A, 0x8D, 0x85,
+0x43, 0x04, 0x23, 0x46, 0x23, 0x88, 0x2B, 0x89, 0x53, 0x32, 0xF5, 0xE2, 0xB8, 0x41, 0xE8, 0x00,
+0xF8, 0xE0, 0x14, 0xCA, 0xA2, 0xD0, 0x5B, 0xFF, 0x14, 0xBE, 0x30, 0x95, 0x8C, 0x6C, 0xC9, 0x33,
+0x05, 0x1B, 0x83, 0x22, 0x86, 0x5B, 0x8D, 0xAD, 0xF2, 0xE6, 0xA1, 0xC0, 0xCD, 0xCD, 0x95, 0x00,
+0xC9, 0x0D, 0xD6, 0xD1, 0xEE, 0x34, 0xFF, 0x11, 0xD6, 0x68, 0x7B, 0x42, 0x29, 0x84, 0x21, 0xE6,
+0x19, 0x4B, 0x3B, 0xAC, 0x43, 0xA6, 0xBE, 0xC1, 0x68, 0x32, 0x44, 0x19, 0xAF, 0xBE, 0xC0, 0x07,
+0x32, 0xA2, 0xC0, 0x65, 0x29, 0x42, 0x49, 0xA5, 0xC1, 0x04, 0x21, 0x61, 0x10, 0x44, 0xC0, 0x28,
+0x4A, 0xAF, 0xC3, 0xAA, 0x5A, 0xAE, 0x7B, 0x4D, 0x6B, 0xE7, 0x41, 0xAF, 0x50, 0x74, 0xBE, 0xC0,
+0xEB, 0x62, 0x96, 0x60, 0x7C, 0x50, 0x68, 0xC3, 0x89, 0x52, 0xCA, 0x5A, 0x07, 0x42, 0x48, 0x4A,
+0x50, 0xBF, 0x54, 0x00, 0xC0, 0x28, 0x42, 0x80, 0x91, 0xC0, 0x88, 0x42, 0x82, 0xBE, 0x9A, 0x91,
+0x9A, 0xC0, 0x88, 0x32, 0xBF, 0xAE, 0xC2, 0x0A, 0x43, 0x84, 0x11, 0x67, 0x32, 0x56, 0xC1, 0x68,
+0x2A, 0xEA, 0x3A, 0x52, 0x4E, 0xC0, 0xE6, 0x21, 0x69, 0x41, 0x42, 0x4B, 0xC3, 0x09, 0x43, 0x88,
+0x3A, 0xB9, 0xCE, 0xBD, 0xF7, 0xBF, 0x91, 0xC0, 0xDD, 0xFF, 0x90, 0xC0, 0x19, 0xE7, 0x92, 0xC1,
+0x1B, 0xEF, 0x7C, 0xF7, 0x9E, 0xCA, 0x0D, 0x7C, 0x63, 0x29, 0x0E, 0x84, 0x77, 0xCE, 0xF9, 0xDE,
+0x32, 0xA5, 0xA4, 0x31, 0x4F, 0x84, 0x7B, 0xEF, 0xB8, 0xD6, 0x16, 0xBE, 0xA5, 0xC2, 0x97, 0xCE,
+0x3A, 0xE7, 0x16, 0xC6, 0x70, 0xD4, 0xD9, 0xD6, 0xFF, 0xF7, 0x3C, 0xD7, 0x69, 0x32, 0xCA, 0x3A,
+0x0E, 0x5C, 0x70, 0x6C, 0xEF, 0x63, 0x10, 0x74, 0x8E, 0x63, 0xF0, 0x73, 0xB7, 0xAD, 0x9E, 0xEF,
+0xBC, 0xCE, 0x2D, 0x53, 0xA6, 0x19, 0xE5, 0x21, 0x82, 0x21, 0xA5, 0x52, 0x8E, 0xBD, 0x34, 0xF7,
+0xA0, 0xC1, 0x90, 0xE6, 0x2E, 0xD6, 0xB9, 0xCA, 0x8F, 0xE6, 0x31, 0xF7, 0xF0, 0xDE, 0xAC, 0x9D,
+0x07, 0x5C, 0x04, 0x2B, 0x67, 0x2B, 0x48, 0x53, 0x11, 0xED, 0xC1, 0xB8, 0x61, 0xE8, 0x5D, 0xE0,
+0x14, 0xCA, 0xA2, 0xD0, 0x5B, 0xFF, 0x14, 0xBE, 0x0F, 0x95, 0x6C, 0x6C, 0x47, 0x33, 0xC3, 0x1A,
+0x66, 0x4B, 0xAE, 0xAD, 0xF2, 0xE6, 0x71, 0xE6, 0x91, 0xC1, 0xB2, 0xEE, 0x34, 0xFF, 0x99, 0xC6,
+0x0E, 0xD6, 0x0A, 0xBD, 0x0F, 0xDE, 0x54, 0xFF, 0x6E, 0xC5, 0x23, 0x4A, 0x63, 0x21, 0x8B, 0xCB,
+0xEA, 0x32, 0x4F, 0x5C, 0xD5, 0x8D, 0xFA, 0xBE, 0xF6, 0xAD, 0x71, 0x84, 0xCA, 0x4A, 0x8D, 0x63,
+0x91, 0x8C, 0xEF, 0x73, 0x49, 0x42, 0xC7, 0x31, 0xA9, 0x49, 0xC4, 0xEB, 0x62, 0x28, 0x4A, 0x24,
+0x29, 0x65, 0x31, 0xC7, 0x39, 0x68, 0xC3, 0x0C, 0x63, 0x4D, 0x6B, 0xE7, 0x41, 0x49, 0x4A, 0x70,
+0xC0, 0x69, 0x52, 0xAE, 0x70, 0x5C, 0xC0, 0xA6, 0x39, 0x68, 0x41, 0xC3, 0x07, 0x42, 0xCA, 0x5A,
+0x6D, 0x6B, 0x69, 0x4A, 0xA5, 0x55, 0x5F, 0xC0, 0x08, 0x42, 0x54, 0x55, 0xC5, 0xCE, 0x73, 0x0B,
+0x53, 0xA9, 0x42, 0x48, 0x32, 0xC6, 0x21, 0x88, 0x32, 0x92, 0xC1, 0xE6, 0x21, 0x26, 0x22, 0x91,
+0x00, 0xC1, 0xA8, 0x32, 0xCD, 0x5B, 0x80, 0xC5, 0xC9, 0x3A, 0xC5, 0x19, 0xA9, 0x32, 0x47, 0x22,
+0x4C, 0x43, 0x47, 0x2A, 0x42, 0x7E, 0xC0, 0xC8, 0x32, 0x4B, 0xC7, 0x2A, 0x43, 0x46, 0x32, 0x3B,
+0xDF, 0xFE, 0xFF, 0xD5, 0xC5, 0x16, 0xCE, 0xF8, 0xE6, 0xBA, 0xFF, 0xAF, 0xA7, 0x96, 0xC0, 0x3B,
+0xEF, 0x7F, 0xC3, 0x4E, 0x8C, 0xA7, 0x52, 0xB3, 0xB5, 0x97, 0xCE, 0x91, 0xC4, 0x93, 0xB5, 0xC8,
+0x5A, 0xCC, 0x7B, 0x7A, 0xEF, 0xBB, 0xF7, 0xAF, 0x48, 0x74, 0xC1, 0xFC, 0xFF, 0x9A, 0xF7, 0xA9,
+0xC5, 0xF3, 0xBD, 0xF9, 0xDE, 0xFB, 0xD6, 0xE7, 0x29, 0x30, 0x6C, 0xFF, 0xEF, 0x9A, 0x6B, 0xBA,
+0x00, 0x92, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0xC8, 0x97, 0xAD, 0x86, 0x21, 0x43, 0x19, 0xE3, 0x39,
+0xAB, 0x9C, 0x14, 0xF7, 0xB1, 0xEE, 0x0F, 0xD6, 0x13, 0xF7, 0xBE, 0xCC, 0x4F, 0xE6, 0x6B, 0xCD,
+0xAB, 0xCD, 0xCF, 0xE6, 0x11, 0xE7, 0x6B, 0x9D, 0x65, 0x4B, 0x46, 0x2B, 0x48, 0x4B, 0xF1, 0xEC,
+0xC1, 0xB0, 0x61, 0xE8, 0x00, 0xF8, 0xE0, 0x13, 0xAE, 0xC9, 0xE2, 0xD0, 0x5B, 0xFF, 0x55, 0xC6,
+0xCE, 0x8C, 0x2B, 0x64, 0x46, 0x33, 0x62, 0x22, 0xE7, 0x6B, 0xD3, 0xDE, 0x31, 0xDE, 0xBF, 0xC0,
+0xDA, 0xFF, 0xAB, 0x00, 0xA8, 0xA5, 0xC8, 0xB2, 0xF6, 0x27, 0xA4, 0xCD, 0xD5, 0x94, 0xFF, 0xC8,
+0x8B, 0x83, 0x29, 0xE3, 0x08, 0x0A, 0x43, 0xB9, 0xB6, 0x68, 0xA0, 0xBF, 0x71, 0x00, 0x6E, 0x01,
+0xC8, 0x38, 0xC6, 0xAA, 0x52, 0x03, 0x19, 0xE7, 0x39, 0xEF, 0x7B, 0x8D, 0x73, 0xE7, 0x41, 0x44,
+0x29, 0xA6, 0x39, 0xAE, 0xC0, 0x28, 0x4A, 0xAF, 0xC0, 0x2C, 0x6B, 0x68, 0x54, 0xC1, 0x69, 0x52,
+0xEB, 0x62, 0x7C, 0xC0, 0x86, 0x31, 0x40, 0xC1, 0xAA, 0x5A, 0x48, 0x4A, 0x54, 0xC1, 0x89, 0x52,
+0x2C, 0x63, 0x4D, 0xC1, 0x6D, 0x6B, 0x50, 0x8C, 0x64, 0x59, 0x68, 0xC7, 0x30, 0x84, 0x95, 0xAD,
+0x70, 0x84, 0x8D, 0x63, 0xEA, 0x4A, 0x48, 0x2A, 0xCA, 0x3A, 0x27, 0x22, 0x69, 0xC0, 0x8C, 0x53,
+0x91, 0xC2, 0x67, 0x2A, 0xE5, 0x19, 0x46, 0x22, 0x00, 0x5F, 0x5B, 0xC3, 0xC9, 0x32, 0x06, 0x1A,
+0x0A, 0x3B, 0xA9, 0x32, 0xBA, 0xC1, 0x06, 0x22, 0xC8, 0x32, 0x50, 0xC2, 0xE8, 0x3A, 0x26, 0x32,
+0xF2, 0x9C, 0xB5, 0xC3, 0x6F, 0x9C, 0xF0, 0xAC, 0x54, 0xD6, 0x79, 0xF7, 0x91, 0x92, 0xC1, 0x3A,
+0xEF, 0xD9, 0xE6, 0x4F, 0x04, 0xAE, 0x00, 0x4F, 0x54, 0x00, 0x4F, 0x54, 0xBF, 0x96, 0xA0, 0xC0,
+0x52, 0xD6, 0x92, 0xCA, 0x56, 0xCE, 0x53, 0xA5, 0xA5, 0x21, 0x8E, 0x5B, 0x95, 0x9D, 0x17, 0xAE,
+0x79, 0xBE, 0x19, 0xB6, 0x39, 0xC6, 0x76, 0xAD, 0xB7, 0xB5, 0xAE, 0xCA, 0x56, 0xA5, 0x6E, 0x63,
+0x66, 0x29, 0xE2, 0x20, 0xE7, 0x6A, 0x32, 0xDE, 0x92, 0xEE, 0x30, 0xDE, 0x97, 0xFF, 0xFA, 0xFF,
+0x98, 0xFF, 0xA5, 0xCB, 0x34, 0xFF, 0x4F, 0xE6, 0x2A, 0xBD, 0x4E, 0xDE, 0xF1, 0xE6, 0x48, 0x74,
+0x05, 0x2B, 0xE6, 0x42, 0xF1, 0xEC, 0xE2, 0xB8, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x13, 0x62, 0xC8,
+0xC2, 0xD0, 0x3A, 0xFF, 0x35, 0xC6, 0xAE, 0x84, 0x0A, 0x64, 0x06, 0x33, 0xA3, 0x32, 0x49, 0x7C,
+0xB3, 0xE6, 0xB6, 0xC1, 0xF6, 0xFE, 0xBC, 0xFF, 0xA6, 0x00, 0xC3, 0xDD, 0xFF, 0xDA, 0xFF, 0x56,
+0xFF, 0x2B, 0xC5, 0x90, 0xD0, 0x11, 0xFF, 0x4C, 0xBD, 0x21, 0x29, 0x44, 0x21, 0xF2, 0x84, 0xFE,
+0xDF, 0xB9, 0xBE, 0xD2, 0x84, 0x14, 0x9D, 0x59, 0xC6, 0x7D, 0xEF, 0xDA, 0xD6, 0xD7, 0xB5, 0xFB,
+0xD6, 0xDF, 0xF7, 0xF3, 0x9C, 0xA6, 0x31, 0x95, 0xC3, 0x28, 0x4A, 0x44, 0x29, 0xE3, 0x20, 0xC6,
+0x39, 0xA6, 0x91, 0xC0, 0xE7, 0x41, 0x45, 0xC0, 0x89, 0x52, 0x54, 0x00, 0x68, 0x00, 0x45, 0x6C,
+0x40, 0x68, 0x95, 0x40, 0x59, 0xC4, 0xAA, 0x52, 0x48, 0x4A, 0xEB, 0x5A, 0x6D, 0x73, 0xAA, 0x5A,
+0x59, 0x54, 0x4D, 0xC1, 0x2B, 0x5B, 0x48, 0x3A, 0xAE, 0x00, 0x81, 0xAE, 0x55, 0xC1, 0x4B, 0x4B,
+0x2E, 0x6C, 0xAE, 0xC1, 0xCD, 0x5B, 0x26, 0x22, 0xA5, 0xC1, 0x8B, 0x4B, 0x4F, 0x64, 0x90, 0xC2,
+0xA8, 0x2A, 0xE5, 0x11, 0xEA, 0x3A, 0x66, 0xC2, 0xA9, 0x3A, 0x06, 0x22, 0xA8, 0x32, 0x4B, 0xC8,
+0xE9, 0x42, 0x26, 0x32, 0x2E, 0x84, 0xE9, 0x6A, 0xAB, 0x8B, 0xF3, 0xD5, 0x57, 0xFF, 0xF9, 0xFF,
+0xFB, 0xFF, 0x00, 0xA7, 0xA6, 0xC0, 0xFC, 0xFF, 0x09, 0x57, 0x5C, 0x01, 0xC0, 0xB9, 0xFF, 0xAC,
+0xA1, 0xC2, 0xB6, 0xE6, 0x94, 0xB5, 0xC6, 0x29, 0xAF, 0xC0, 0x48, 0x32, 0xA6, 0x92, 0xA5, 0xBB,
+0xC0, 0x29, 0x42, 0x00, 0x80, 0xC2, 0x6E, 0x63, 0xAB, 0x52, 0x66, 0x31, 0xA4, 0xC3, 0xCA, 0x93,
+0x93, 0xEE, 0xF3, 0xF6, 0x35, 0xF7, 0x55, 0x5C, 0xA7, 0xA4, 0xC1, 0x57, 0xFF, 0xF3, 0xFE, 0x6F,
+0xBE, 0xC4, 0xCF, 0xEE, 0xE9, 0x94, 0x25, 0x2B, 0xE6, 0x42, 0xD0, 0xE4, 0x76, 0xC1, 0x41, 0xE8,
+0x00, 0xF8, 0xE0, 0x13, 0xAE, 0x7A, 0xCA, 0x3A, 0xFF, 0x35, 0xC6, 0x8D, 0x84, 0xEA, 0x63, 0xC5,
+0x32, 0xE4, 0x42, 0xAA, 0x94, 0x92, 0xE6, 0xB4, 0xFE, 0x99, 0xFF, 0xBD, 0xFF, 0xA3, 0x9F, 0xCA,
+0xDF, 0xFF, 0x9B, 0xFF, 0x98, 0xFF, 0x91, 0xEE, 0x46, 0xAC, 0x8E, 0xEE, 0x0F, 0xDE, 0xA3, 0x39,
+0x04, 0x19, 0x13, 0x8D, 0xBD, 0xDF, 0x40, 0xC0, 0xE7, 0x29, 0xA1, 0x61, 0xC3, 0xF3, 0x9C, 0xAE,
+0x6B, 0xE7, 0x31, 0x10, 0x7C, 0x69, 0xC6, 0x18, 0xC6, 0x08, 0x3A, 0x65, 0x29, 0xC2, 0x18, 0x61,
+0x10, 0xA2, 0x18, 0xE7, 0x41, 0xAE, 0xC0, 0xA5, 0x31, 0xBF, 0x91, 0xBF, 0x71, 0x45, 0xAE, 0x45,
+0x40, 0x45, 0x54, 0x40, 0x45, 0xC0, 0x65, 0x31, 0x71, 0xC0, 0xE7, 0x39, 0x76, 0x51, 0xC1, 0x28,
+0x42, 0x89, 0x52, 0x00, 0xC0, 0x28, 0x4A, 0x51, 0x99, 0xC1, 0x85, 0x29, 0x68, 0x3A, 0xAF, 0x80,
+0xC0, 0x88, 0x32, 0x00, 0xBF, 0xC0, 0x06, 0x22, 0xBE, 0xC3, 0x8B, 0x53, 0x87, 0x32, 0xE9, 0x3A,
+0x8B, 0x4B, 0xAE, 0x92, 0xC3, 0xA8, 0x2A, 0x47, 0x22, 0x2A, 0x3B, 0x06, 0x1A, 0x7D, 0xC9, 0x26,
+0x22, 0x87, 0x2A, 0xA3, 0x11, 0x6B, 0x53, 0x0E, 0x74, 0xF6, 0xC5, 0x6B, 0x7B, 0xE4, 0x59, 0xB2,
+0xD5, 0xB4, 0xEE, 0x9A, 0xC0, 0xB9, 0xFF, 0xAF, 0xA2, 0xAB, 0x05, 0xAB, 0x00, 0xAE, 0x01, 0x46,
+0x00, 0x52, 0x46, 0xC1, 0x78, 0xFF, 0x54, 0xFF, 0xA9, 0xC1, 0x12, 0xD6, 0x72, 0xB5, 0x76, 0xC3,
+0x28, 0x3A, 0x4D, 0x5B, 0xCB, 0x42, 0x66, 0x21, 0x96, 0xC1, 0xC4, 0x10, 0x29, 0x3A, 0x5D, 0xC3,
+0xA7, 0x29, 0xB6, 0xAD, 0x18, 0xBE, 0xA6, 0x31, 0xB4, 0xC4, 0xAD, 0xAC, 0xB3, 0xF6, 0xF3, 0xF6,
+0xF9, 0xFF, 0xFD, 0xFF, 0x93, 0xC0, 0xFF, 0xFF, 0x00, 0x7F, 0xC6, 0xB7, 0xFF, 0xAD, 0xDD, 0xE8,
+0xC4, 0x8D, 0xEE, 0x6A, 0xA5, 0x25, 0x33, 0xE6, 0x42, 0x42, 0xC2, 0xE2, 0xB8, 0x61, 0xE8, 0x00,
+0xF8, 0xE0, 0x13, 0xAE, 0xC5, 0xC2, 0xD0, 0x3A, 0xFF, 0x15, 0xC6, 0x6D, 0x7C, 0xCA, 0x5B, 0xC5,
+0x32, 0xB9, 0xC1, 0xAA, 0x94, 0x71, 0xE6, 0x68, 0xC2, 0x99, 0xFF, 0xBD, 0xFF, 0x9F, 0xFF, 0x9A,
+0x00, 0x46, 0xCA, 0xB8, 0xFF, 0xD2, 0xF6, 0xE5, 0x9B, 0x8E, 0xF6, 0xEE, 0xD5, 0x25, 0x4A, 0x24,
+0x19, 0x13, 0x8D, 0xDE, 0xDF, 0x17, 0xAE, 0x0F, 0x6C, 0xB1, 0xC4, 0xF3, 0x9C, 0x17, 0xBE, 0x55,
+0xA5, 0x30, 0x7C, 0xB6, 0xB5, 0x71, 0x7D, 0x51, 0xC4, 0x45, 0x29, 0x89, 0x52, 0xEB, 0x62, 0x07,
+0x42, 0xA6, 0x39, 0x59, 0x01, 0x54, 0x00, 0x99, 0x59, 0x00, 0x54, 0xC0, 0x27, 0x42, 0xBB, 0x4A,
+0xC1, 0x08, 0x4A, 0x48, 0x4A, 0x54, 0x6D, 0x41, 0x51, 0x59, 0xC0, 0x69, 0x4A, 0xBA, 0x54, 0x59,
+0xC0, 0x0B, 0x63, 0x9E, 0xC0, 0xA5, 0x29, 0xAF, 0xC0, 0x47, 0x32, 0x96, 0xC0, 0x88, 0x3A, 0x55,
+0xC0, 0xC9, 0x42, 0xBF, 0xC1, 0x2A, 0x4B, 0xAC, 0x5B, 0x4E, 0xAE, 0xC0, 0x09, 0x3B, 0x58, 0x91,
+0xC0, 0x67, 0x22, 0xA6, 0xC2, 0x6B, 0x4B, 0x68, 0x2A, 0xEA, 0x42, 0x5A, 0xC7, 0xC8, 0x32, 0xA4,
+0x09, 0x0A, 0x43, 0x8C, 0x63, 0xD6, 0xC5, 0x6C, 0x83, 0x62, 0x49, 0x0F, 0xC5, 0xAD, 0xC3, 0xCD,
+0xB4, 0x74, 0xDE, 0xB6, 0xE6, 0x56, 0xDE, 0xAB, 0x07, 0xAE, 0x04, 0x6C, 0xC1, 0x54, 0xDE, 0x90,
+0xEE, 0xAE, 0xCA, 0xD0, 0xCD, 0x92, 0xBD, 0x64, 0x29, 0xEF, 0x73, 0x9E, 0xE7, 0x1C, 0xD7, 0x92,
+0x84, 0xAE, 0x63, 0xA7, 0x31, 0xE8, 0x39, 0x86, 0x29, 0xAE, 0xC5, 0x79, 0xC6, 0xFB, 0xD6, 0xA6,
+0x31, 0x63, 0x39, 0x0E, 0xBD, 0x92, 0xF6, 0x9E, 0x47, 0xC0, 0xFE, 0xFF, 0x97, 0xAE, 0xBA, 0xCB,
+0x9A, 0xFF, 0xF8, 0xFF, 0xED, 0xE5, 0xC7, 0xBC, 0x4C, 0xE6, 0x29, 0xA5, 0x45, 0x33, 0xE6, 0x42,
+0xD0, 0xE4, 0xC2, 0xB8, 0x61, 0xE8, 0x00, 0xF8, 0xE0, 0x13, 0xAE, 0xC5, 0xC2, 0xD0, 0x3A, 0xFF,
+0x14, 0xBE, 0x6D, 0x7C, 0xC9, 0x5B, 0xC5, 0x32, 0x90, 0xC0, 0xA9, 0x94, 0x5E, 0xC3, 0xB2, 0xFE,
+0x77, 0xFF, 0xBC, 0xFF, 0xDE, 0xFF, 0x82, 0xB9, 0xCB, 0xFB, 0xFF, 0x76, 0xFF, 0xED, 0xDD, 0x25,
+0xA4, 0x51, 0xFF, 0xAE, 0xCD, 0x82, 0x29, 0x24, 0x11, 0x70, 0x6C, 0x1A, 0xBF, 0xBD, 0xD7, 0xFF,
+0xEF, 0xBA, 0xBA, 0xC2, 0x58, 0xC6, 0xFB, 0xDE, 0x9E, 0xEF, 0x71, 0xC2, 0x1C, 0xE7, 0xEF, 0x7B,
+0x65, 0x29, 0x00, 0xC3, 0x30, 0x84, 0x71, 0x94, 0xEA, 0x5A, 0x85, 0x31, 0x00, 0xC0, 0x07, 0x42,
+0x7C, 0x68, 0xC0, 0x68, 0x4A, 0x7C, 0xAE, 0x00, 0x7C, 0xC0, 0xAA, 0x5A, 0x00, 0x59, 0x50, 0x00,
+0x7C, 0xC0, 0x0B, 0x63, 0xAF, 0xC0, 0x48, 0x4A, 0x00, 0xC4, 0xEB, 0x5A, 0x2C, 0x6B, 0xC7, 0x39,
+0x49, 0x4A, 0xD2, 0x94, 0xBF, 0xC7, 0x27, 0x3A, 0xA5, 0x21, 0xA9, 0x42, 0x48, 0x32, 0xEA, 0x42,
+0x06, 0x2A, 0x47, 0x32, 0x6C, 0x5B, 0x99, 0x91, 0xC5, 0x26, 0x2A, 0xC4, 0x19, 0x6A, 0x4B, 0xED,
+0x5B, 0x2A, 0x3B, 0x26, 0x1A, 0x00, 0xC2, 0x4B, 0x4B, 0x27, 0x22, 0xEA, 0x3A, 0x52, 0xC1, 0xAC,
+0x4B, 0x09, 0x3B, 0xA6, 0xC5, 0x44, 0x19, 0xCE, 0x83, 0xEA, 0x7A, 0xE4, 0x61, 0xCE, 0xBC, 0x4B,
+0xAC, 0x9E, 0xC1, 0x33, 0xD6, 0x55, 0xDE, 0x97, 0xA6, 0x91, 0x06, 0x96, 0xA9, 0xBB, 0x44, 0x02,
+0xA8, 0xC6, 0x90, 0xEE, 0xF1, 0xFE, 0xF1, 0xD5, 0x93, 0xBD, 0x03, 0x21, 0x4D, 0x63, 0xDB, 0xC6,
+0xA9, 0x6E, 0x00, 0xC2, 0x39, 0xBE, 0x72, 0x84, 0xAA, 0x4A, 0xA6, 0xC9, 0x79, 0xC6, 0xDB, 0xCE,
+0xA6, 0x29, 0x83, 0x31, 0x0D, 0xB5, 0xD1, 0xF6, 0x12, 0xF7, 0xF8, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF,
+0x96, 0x71, 0xC7, 0x78, 0xF7, 0x95, 0xFF, 0xED, 0xE5, 0x49, 0xCD, 0x8D, 0xEE, 0x09, 0x9D, 0x45,
+0x33, 0xE6, 0x42, 0x42, 0xC2, 0xC2, 0xB8, 0x61, 0xE8, 0x00, 0xF8, 0xE0, 0x13, 0x62, 0xCC, 0xE2,
+0xD0, 0x3A, 0xFF, 0x15, 0xC6, 0x6D, 0x7C, 0xC9, 0x5B, 0xC6, 0x2A, 0x42, 0x22, 0x07, 0x7C, 0x90,
+0xE6, 0xF2, 0xFE, 0x56, 0xFF, 0xBA, 0xFF, 0xDD, 0xFF, 0xAF, 0x80, 0xC2, 0xFA, 0xFF, 0x13, 0xEF,
+0x8C, 0xCD, 0xA4, 0xCC, 0x73, 0xFF, 0x8A, 0xA4, 0xE0, 0x10, 0x44, 0x09, 0x6C, 0x43, 0xB0, 0x6C,
+0xB5, 0x8D, 0x3B, 0xC7, 0xBA, 0xC6, 0x54, 0xA5, 0xEB, 0x52, 0x8D, 0x6B, 0xB2, 0x8C, 0xBF, 0xC2,
+0x8E, 0x73, 0xE7, 0x39, 0x65, 0x29, 0x7D, 0xC0, 0x48, 0x4A, 0x91, 0xC0, 0x85, 0x31, 0x01, 0x59,
+0xC4, 0xCA, 0x5A, 0x28, 0x4A, 0x69, 0x52, 0xAA, 0x5A, 0xEB, 0x62, 0x00, 0xC0, 0x89, 0x52, 0x55,
+0xC0, 0x0B, 0x63, 0x6D, 0xC0, 0x2C, 0x6B, 0x69, 0xC1, 0x8A, 0x5A, 0x4C, 0x6B, 0x69, 0xC0, 0x07,
+0x3A, 0x51, 0x41, 0x50, 0xC0, 0xE7, 0x41, 0x59, 0x69, 0xC7, 0x4C, 0x63, 0xE6, 0x31, 0x47, 0x3A,
+0xEA, 0x4A, 0x07, 0x2A, 0x2B, 0x53, 0xA9, 0x42, 0x27, 0x32, 0x60, 0x91, 0xC3, 0x47, 0x32, 0x4A,
+0x53, 0xE5, 0x19, 0x87, 0x2A, 0xAF, 0x64, 0xC0, 0x26, 0x22, 0xAF, 0xC5, 0x4B, 0x4B, 0x47, 0x2A,
+0xEA, 0x3A, 0x06, 0x1A, 0xAC, 0x4B, 0x4A, 0x3B, 0xB6, 0xC4, 0x23, 0x11, 0xCE, 0x83, 0x0B, 0x7B,
+0xE5, 0x61, 0x2C, 0xAC, 0x80, 0xC1, 0xAD, 0xAC, 0x55, 0xDE, 0xAB, 0x6C, 0x92, 0x91, 0xAD, 0xA6,
+0x04, 0x96, 0x00, 0x44, 0xAF, 0x00, 0x44, 0x00, 0xCB, 0x13, 0xD6, 0x6F, 0xE6, 0x52, 0xFF, 0xB0,
+0xCD, 0x73, 0xB5, 0x85, 0x29, 0xE7, 0x31, 0x8A, 0x3A, 0x4C, 0x53, 0x14, 0x8D, 0xDA, 0xC6, 0xBF,
+0xEF, 0xA5, 0xCB, 0x3C, 0xDF, 0xDB, 0xCE, 0xFF, 0xEF, 0x9A, 0xC6, 0xC7, 0x29, 0xA4, 0x31, 0x4A,
+0xA4, 0x90, 0xF6, 0x93, 0xFF, 0xF7, 0xFF, 0xDB, 0xFF, 0xFE, 0xFF, 0x9A, 0xB8, 0xC2, 0x76, 0xF7,
+0x12, 0xF7, 0xEC, 0xE5, 0xAE, 0xC2, 0xAF, 0xEE, 0xC9, 0x94, 0x25, 0x33, 0x75, 0xC3, 0xD0, 0xE4,
+0xE2, 0xB8, 0x61, 0xE8, 0x00, 0xF8, 0xE0, 0x13, 0xAE, 0xDA, 0xE3, 0xD8, 0x5B, 0xFF, 0x35, 0xC6,
+0x6D, 0x7C, 0xCA, 0x53, 0xC6, 0x22, 0x64, 0x1A, 0x03, 0x53, 0x6B, 0xBD, 0xB0, 0xF6, 0x34, 0xFF,
+0x98, 0xFF, 0xDB, 0xFF, 0xFD, 0xFF, 0xDA, 0xF7, 0xB7, 0xF7, 0xF2, 0xEE, 0x4E, 0xE6, 0xD0, 0xF6,
+0x2F, 0xDE, 0x83, 0x5A, 0x21, 0x11, 0xA5, 0x11, 0x6B, 0x3B, 0xCD, 0x4B, 0x4B, 0x3B, 0xAD, 0x53,
+0xB6, 0xC1, 0x28, 0x3A, 0xA6, 0x21, 0xA5, 0xBF, 0x00, 0xB6, 0x00, 0xAE, 0xBE, 0xC0, 0xE3, 0x18,
+0xA0, 0xAF, 0xC3, 0x85, 0x31, 0xE6, 0x39, 0x27, 0x4A, 0xA9, 0x5A, 0x61, 0xC0, 0x89, 0x52, 0xBF,
+0xC0, 0x0B, 0x63, 0x00, 0xC0, 0x28, 0x4A, 0x61, 0x49, 0x68, 0xC0, 0x0C, 0x6B, 0xAE, 0x50, 0xC2,
+0x4C, 0x6B, 0xEB, 0x62, 0x48, 0x42, 0x68, 0xC0, 0xCA, 0x5A, 0x59, 0xA6, 0x91, 0x45, 0xC0, 0x27,
+0x3A, 0x91, 0xC0, 0x89, 0x42, 0xAE, 0xC4, 0x07, 0x2A, 0x68, 0x3A, 0xEA, 0x4A, 0x2B, 0x5B, 0x6C,
+0x63, 0x00, 0x80, 0xC0, 0x8B, 0x5B, 0xAE, 0xD4, 0x4A, 0x4B, 0xE9, 0x3A, 0x29, 0x3B, 0xA8, 0x32,
+0x06, 0x22, 0x0A, 0x43, 0x88, 0x32, 0x2B, 0x43, 0x06, 0x1A, 0x29, 0x33, 0x46, 0x1A, 0xC9, 0x32,
+0xC6, 0x29, 0x72, 0x9C, 0xEB, 0x7A, 0xA4, 0x59, 0x0C, 0xAC, 0xA9, 0x93, 0xAD, 0xAC, 0x76, 0xDE,
+0x16, 0xD6, 0xA7, 0x91, 0x4B, 0xA9, 0x00, 0x9A, 0x44, 0x41, 0xA6, 0x41, 0x44, 0x41, 0xBE, 0xAF,
+0xA6, 0x44, 0x00, 0xC5, 0x34, 0xD6, 0x6F, 0xE6, 0x52, 0xFF, 0xD1, 0xCD, 0x93, 0xBD, 0x07, 0x3A,
+0x9B, 0xC7, 0x44, 0x09, 0x48, 0x2A, 0xA6, 0x19, 0x89, 0x3A, 0x6D, 0x5B, 0xF3, 0x94, 0x3C, 0xDF,
+0xDF, 0xEF, 0xBE, 0xC1, 0x9A, 0xC6, 0xC8, 0x29, 0x71, 0xC4, 0xC5, 0x72, 0x6C, 0xD5, 0x32, 0xFF,
+0x94, 0xFF, 0x99, 0xFF, 0x5C, 0x00, 0xCB, 0xD9, 0xFF, 0xD5, 0xFF, 0x10, 0xF7, 0x2D, 0xE6, 0x6F,
+0xF6, 0xAD, 0xCD, 0xA7, 0x6B, 0x26, 0x2B, 0xE6, 0x42, 0xD0, 0xE4, 0xE2, 0xB8, 0x41, 0xE8, 0x5D,
+0xE0, 0x13, 0xAE, 0xC5, 0xE3, 0xD0, 0x5B, 0xFF, 0x35, 0xC6, 0x8D, 0x84, 0xEA, 0x53, 0xE7, 0x1A,
+0xA0, 0xC1, 0xE0, 0x21, 0x07, 0x84, 0x6F, 0xC2, 0x12, 0xFF, 0x56, 0xFF, 0xD8, 0xFF, 0x97, 0xBE,
+0xA8, 0xC1, 0x53, 0xFF, 0xF1, 0xF6, 0xAB, 0xC6, 0x6A, 0xA4, 0x00, 0x21, 0xA4, 0x21, 0x23, 0x01,
+0xA8, 0x22, 0x2E, 0x54, 0xCC, 0x43, 0xA1, 0xC3, 0xCD, 0x53, 0xEA, 0x42, 0xA5, 0x21, 0xE6, 0x29,
+0xA2, 0x91, 0xC1, 0xA6, 0x31, 0xE7, 0x39, 0x7D, 0xA6, 0xC0, 0xEA, 0x5A, 0x91, 0xC0, 0x85, 0x31,
+0x95, 0xC0, 0x07, 0x42, 0x00, 0xBF, 0xAE, 0x68, 0xC1, 0x68, 0x4A, 0xAA, 0x5A, 0x46, 0x45, 0x00,
+0xC0, 0x89, 0x52, 0x68, 0xC1, 0xC6, 0x41, 0x48, 0x52, 0x59, 0x41, 0xAF, 0x41, 0xC1, 0xCA, 0x5A,
+0x4C, 0x6B, 0x50, 0x45, 0xBF, 0xC1, 0x8D, 0x73, 0x0F, 0x7C, 0x6C, 0xC0, 0x07, 0x32, 0x6C, 0xC2,
+0x2C, 0x53, 0xC6, 0x29, 0x48, 0x3A, 0x6C, 0x60, 0xC0, 0xC9, 0x4A, 0x9E, 0xA6, 0xC0, 0x67, 0x32,
+0xAE, 0xAF, 0xD1, 0xE9, 0x3A, 0x88, 0x32, 0x26, 0x22, 0x4B, 0x4B, 0xA9, 0x32, 0x2B, 0x43, 0x06,
+0x1A, 0x2A, 0x3B, 0x67, 0x1A, 0xEA, 0x3A, 0x28, 0x32, 0x14, 0xA5, 0x8D, 0x8B, 0xC4, 0x59, 0x4D,
+0xAC, 0xAA, 0x93, 0xAE, 0xAC, 0x97, 0xE6, 0x92, 0x97, 0x91, 0xAD, 0x03, 0x49, 0x04, 0xC0, 0x36,
+0xD6, 0x55, 0x91, 0x00, 0xC1, 0x33, 0xD6, 0x90, 0xE6, 0x64, 0xC4, 0xB0, 0xC5, 0x11, 0xA5, 0x23,
+0x19, 0x08, 0x2A, 0xA5, 0x11, 0x7A, 0xC4, 0xE6, 0x19, 0x07, 0x2A, 0x86, 0x19, 0xE7, 0x29, 0x6D,
+0x5B, 0xAF, 0xC9, 0x92, 0x7C, 0x31, 0x74, 0xC8, 0x21, 0x45, 0x29, 0x40, 0x41, 0x08, 0x9C, 0x90,
+0xEE, 0xF2, 0xF6, 0x76, 0xFF, 0xB8, 0xFF, 0xAE, 0xC3, 0x95, 0xFF, 0xF5, 0xFF, 0x51, 0xFF, 0x6E,
+0xE6, 0xAB, 0xC7, 0xAA, 0x9C, 0x83, 0x32, 0x26, 0x23, 0xE6, 0x42, 0xF1, 0xEC, 0xE2, 0xB8, 0x41,
+0xE8, 0x00, 0xF8, 0xE0, 0x13, 0xAF, 0xCB, 0x44, 0xD9, 0x7B, 0xFF, 0x55, 0xC6, 0x8C, 0x84, 0x0A,
+0x5C, 0x27, 0x23, 0xC6, 0x1A, 0x22, 0x1A, 0x63, 0x3A, 0x08, 0x84, 0x0F, 0xCE, 0x13, 0xF7, 0xBE,
+0xA7, 0x00, 0xA5, 0xA5, 0xC8, 0x10, 0xE6, 0x09, 0x9C, 0x23, 0x52, 0x82, 0x31, 0xC6, 0x31, 0x65,
+0x11, 0x06, 0x12, 0xAB, 0x3B, 0x6E, 0x4C, 0x80, 0xC2, 0xCB, 0x3B, 0x0D, 0x54, 0x67, 0x2A, 0xA2,
+0xA2, 0xBA, 0xBA, 0xA6, 0x51, 0xBE, 0xC3, 0x54, 0xAD, 0x17, 0xBE, 0xCA, 0x5A, 0x64, 0x29, 0x54,
+0x99, 0x71, 0xAF, 0xBE, 0x51, 0x45, 0x81, 0x71, 0x45, 0x00, 0xC0, 0x65, 0x31, 0x00, 0xC0, 0xA6,
+0x39, 0x45, 0x00, 0x59, 0x00, 0x54, 0x6D, 0xA6, 0x00, 0xC6, 0x44, 0x29, 0x95, 0xAD, 0xFE, 0xF7,
+0xD1, 0x8C, 0xEA, 0x4A, 0x06, 0x2A, 0x89, 0x3A, 0x92, 0xBE, 0xC0, 0x2B, 0x4B, 0x00, 0xC0, 0x8D,
+0x5B, 0x99, 0x65, 0x01, 0x7E, 0xC1, 0xC9, 0x3A, 0x26, 0x22, 0xAF, 0xCF, 0x4A, 0x43, 0x67, 0x22,
+0x2C, 0x43, 0xE6, 0x19, 0xC9, 0x32, 0x27, 0x22, 0xAA, 0x3A, 0x49, 0x3A, 0xAB, 0x5A, 0xE3, 0x30,
+0x62, 0x49, 0x8E, 0xB4, 0x48, 0x8B, 0x10, 0xBD, 0x98, 0xE6, 0x38, 0xD6, 0xA5, 0x9A, 0xBE, 0xA9,
+0xA6, 0x9A, 0x02, 0x58, 0x99, 0x55, 0x00, 0xA5, 0xA6, 0x9A, 0x49, 0xBC, 0xCB, 0x2E, 0xE6, 0xD0,
+0xF6, 0x6E, 0xBD, 0xE8, 0x62, 0x26, 0x3A, 0x48, 0x2A, 0x84, 0x11, 0xA9, 0x32, 0x28, 0x22, 0x86,
+0x11, 0xE8, 0x21, 0xAB, 0x42, 0x4F, 0xA5, 0xC2, 0x08, 0x22, 0xA6, 0x11, 0xA7, 0x21, 0xA4, 0xC6,
+0x42, 0x29, 0x02, 0x52, 0x49, 0x9C, 0xB1, 0xE6, 0x74, 0xFF, 0xF2, 0xF6, 0x73, 0xFF, 0xA9, 0xA4,
+0x92, 0xC9, 0x2D, 0xCE, 0xA8, 0x8C, 0x65, 0x4B, 0xC4, 0x22, 0x67, 0x1B, 0x27, 0x43, 0xD1, 0xEC,
+0x03, 0xC9, 0x41, 0xE8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x10, 0xAF, 0xC3, 0x44, 0xD9, 0x7B,
+0xFF, 0x55, 0xC6, 0x8C, 0x84, 0x47, 0xC0, 0x48, 0x2B, 0x85, 0xC6, 0x65, 0x1A, 0xE2, 0x19, 0x01,
+0x32, 0x25, 0x63, 0xCA, 0xA4, 0xEE, 0xCD, 0xB2, 0xF6, 0x91, 0xC3, 0x6E, 0xD5, 0x6A, 0xAC, 0x47,
+0x83, 0x03, 0x52, 0x4F, 0xC1, 0x64, 0x29, 0x86, 0x29, 0x85, 0x6A, 0xC3, 0xE8, 0x22, 0x6C, 0x44,
+0xAE, 0x4C, 0x4D, 0x4C, 0xA6, 0xC2, 0x2A, 0x3B, 0x88, 0x32, 0x07, 0x2A, 0xB6, 0x00, 0xB6, 0x91,
+0x00, 0xC2, 0x6D, 0x6B, 0xCE, 0x7B, 0xA6, 0x31, 0x91, 0xC0, 0x07, 0x42, 0x7D, 0xA5, 0x7D, 0x71,
+0xC0, 0xE6, 0x39, 0xAF, 0x91, 0x91, 0x71, 0x51, 0x59, 0xC1, 0x86, 0x39, 0xC7, 0x41, 0xA9, 0x96,
+0xAE, 0x42, 0xA5, 0x45, 0xC0, 0x24, 0x21, 0x45, 0x76, 0xC2, 0x2F, 0x84, 0xD2, 0x94, 0xA9, 0x42,
+0xAE, 0xAF, 0x00, 0xC0, 0x48, 0x32, 0x9A, 0xC0, 0x2C, 0x4B, 0x91, 0x95, 0xC0, 0x0B, 0x43, 0xA1,
+0x51, 0xA2, 0x95, 0x95, 0x99, 0x95, 0xC2, 0x6B, 0x43, 0x67, 0x22, 0x2B, 0x43, 0x52, 0xCA, 0x2A,
+0x3B, 0x88, 0x2A, 0x0C, 0x43, 0xC7, 0x29, 0xA7, 0x39, 0x00, 0x08, 0x82, 0x49, 0xAD, 0xB4, 0x48,
+0x83, 0x30, 0xBD, 0x98, 0xE6, 0x82, 0x95, 0xA6, 0xBD, 0x00, 0xA6, 0x9A, 0x02, 0x58, 0x55, 0x01,
+0xA5, 0x00, 0xA6, 0x49, 0xBC, 0xCE, 0xB0, 0xF6, 0x52, 0xFF, 0xAB, 0xAC, 0x81, 0x31, 0x63, 0x21,
+0xA9, 0x3A, 0x47, 0x22, 0x2A, 0x3B, 0x48, 0x22, 0xE7, 0x19, 0x6A, 0x32, 0xCB, 0x42, 0xC7, 0x21,
+0x07, 0x22, 0x89, 0x2A, 0x45, 0xA2, 0xB9, 0xB4, 0xA8, 0xC4, 0x23, 0x4A, 0xC7, 0x83, 0x8D, 0xBD,
+0x90, 0xE6, 0xD0, 0xEE, 0xA5, 0xC9, 0x4E, 0xDE, 0x8B, 0xBD, 0x47, 0x7C, 0x44, 0x43, 0x04, 0x23,
+0x46, 0x1B, 0x87, 0x1B, 0x27, 0x43, 0xD1, 0xF4, 0x03, 0xC9, 0x68, 0xC0, 0x00, 0xF8, 0x00, 0xAE,
+0x5D, 0xE0, 0x10, 0xAF, 0xC0, 0x24, 0xD9, 0x41, 0xC3, 0x54, 0xC6, 0x8C, 0x84, 0x0A, 0x5C, 0x07,
+0x1B, 0x96, 0xB2, 0xC1, 0x45, 0x22, 0xE3, 0x21, 0xB4, 0xC1, 0x22, 0x3A, 0xC4, 0x5A, 0xBF, 0xBF,
+0xC2, 0x85, 0x62, 0xC3, 0x49, 0x62, 0x39, 0x86, 0xC2, 0x85, 0x29, 0x08, 0x32, 0x86, 0x21, 0xAE,
+0x84, 0xC2, 0x05, 0x12, 0xAA, 0x3B, 0xCE, 0x5C, 0x9A, 0xC0, 0x2C, 0x4C, 0xB3, 0xC2, 0x2A, 0x43,
+0x48, 0x32, 0xE7, 0x31, 0xA6, 0xBA, 0x91, 0x90, 0xAF, 0xC2, 0xA6, 0x31, 0x82, 0x10, 0x44, 0x21,
+0x7D, 0xC0, 0x24, 0x21, 0x00, 0x69, 0xA6, 0x71, 0xC0, 0xC6, 0x31, 0x7D, 0x69, 0x64, 0x69, 0x78,
+0xBA, 0xC0, 0xE7, 0x41, 0x00, 0x95, 0xAF, 0x7D, 0x90, 0x69, 0x5D, 0x00, 0xC1, 0xA5, 0x31, 0xEA,
+0x52, 0x91, 0xC1, 0x06, 0x2A, 0xA9, 0x3A, 0x91, 0xAF, 0x01, 0xBF, 0xC0, 0xA5, 0x19, 0x96, 0xC0,
+0xE7, 0x29, 0x95, 0xBA, 0x77, 0x95, 0xC1, 0xE6, 0x21, 0x47, 0x2A, 0x95, 0xC4, 0x8B, 0x4B, 0x88,
+0x2A, 0xC9, 0x3A, 0x06, 0x22, 0xE9, 0x32, 0x4B, 0x7D, 0xC0, 0xE3, 0x10, 0x64, 0xC5, 0x00, 0x08,
+0xA3, 0x51, 0xCE, 0xB4, 0x68, 0x83, 0x30, 0xBD, 0xB7, 0xE6, 0x82, 0xA6, 0x61, 0xBA, 0xA6, 0x00,
+0xA5, 0x01, 0x5F, 0x00, 0x53, 0x01, 0x9A, 0x00, 0xA6, 0x50, 0xBC, 0xC8, 0x2F, 0xE6, 0x11, 0xFF,
+0x29, 0x94, 0x61, 0x29, 0x43, 0x19, 0x68, 0x32, 0xC5, 0x11, 0xC9, 0x32, 0x47, 0x22, 0xA2, 0xC0,
+0xCB, 0x42, 0x73, 0x65, 0xC2, 0x27, 0x2A, 0xEA, 0x3A, 0xE6, 0x19, 0xA3, 0xBA, 0xBD, 0xA9, 0xB4,
+0xC3, 0xE3, 0x39, 0xA4, 0x52, 0x46, 0x6B, 0xC8, 0x7B, 0xBE, 0x95, 0xCA, 0x45, 0x63, 0xA3, 0x3A,
+0x83, 0x22, 0x46, 0x23, 0x09, 0x34, 0xA8, 0x23, 0x48, 0x4B, 0xD1, 0xF4, 0xE3, 0xC8, 0x21, 0xE8,
+0x00, 0xF8, 0xE0, 0x13, 0xAF, 0xC8, 0x24, 0xD9, 0x7B, 0xFF, 0x54, 0xC6, 0x8C, 0x84, 0x2B, 0x64,
+0x69, 0x2B, 0x08, 0x13, 0x87, 0x12, 0x87, 0x22, 0xA1, 0xC1, 0xE3, 0x21, 0x81, 0x19, 0xBA, 0xA2,
+0xC0, 0x83, 0x29, 0x67, 0x00, 0xC0, 0xC5, 0x31, 0x7F, 0xA7, 0xC0, 0xE8, 0x29, 0xA5, 0x00, 0x88,
+0x95, 0xC3, 0x86, 0x22, 0x0C, 0x4C, 0xCE, 0x5C, 0x4D, 0x4C, 0xBB, 0xC0, 0xAC, 0x4B, 0x7D, 0x7F,
+0xB6, 0xBF, 0x9A, 0xA1, 0xC2, 0x24, 0x21, 0xC6, 0x39, 0x65, 0x29, 0x45, 0x4C, 0x69, 0x00, 0x7D,
+0x00, 0xC1, 0x44, 0x29, 0xE3, 0x18, 0x00, 0xC0, 0x44, 0x21, 0x7D, 0x00, 0x69, 0xB6, 0xC0, 0xC7,
+0x41, 0x54, 0x51, 0x00, 0x95, 0x69, 0x00, 0xC0, 0xA5, 0x31, 0xA6, 0xC2, 0x0B, 0x5B, 0xEE, 0x73,
+0xEA, 0x4A, 0x91, 0xC1, 0x4B, 0x4B, 0x88, 0x32, 0x00, 0xC0, 0x2B, 0x4B, 0x9A, 0xC0, 0x47, 0x2A,
+0x72, 0x40, 0x00, 0xC1, 0x28, 0x3A, 0x69, 0x42, 0x95, 0xC0, 0xCA, 0x4A, 0x67, 0xC0, 0xE5, 0x21,
+0xAF, 0xC1, 0x6B, 0x43, 0x67, 0x22, 0x6A, 0x5A, 0xC0, 0x29, 0x3B, 0x50, 0xC0, 0xA9, 0x3A, 0x77,
+0xC6, 0xEF, 0x7B, 0x0A, 0x73, 0xE3, 0x51, 0xEE, 0xB4, 0x68, 0x83, 0x50, 0xBD, 0xB7, 0xE6, 0x86,
+0xA6, 0x96, 0x64, 0x5F, 0xA9, 0x00, 0xA6, 0x00, 0x58, 0x03, 0x53, 0x9A, 0x01, 0x4A, 0xC8, 0x2E,
+0xE6, 0x11, 0xFF, 0x8F, 0xC5, 0xAF, 0x94, 0x8C, 0x63, 0xCA, 0x3A, 0x84, 0x09, 0xE9, 0x32, 0x06,
+0x1A, 0x00, 0xC4, 0xEA, 0x42, 0x06, 0x2A, 0x63, 0x11, 0x67, 0x32, 0x2A, 0x4B, 0x6D, 0xC1, 0x09,
+0x2A, 0x87, 0x19, 0xA5, 0x77, 0x7F, 0xA4, 0x99, 0xB9, 0xBF, 0xAE, 0x9A, 0xAE, 0xC3, 0x44, 0x22,
+0xC5, 0x22, 0x67, 0x23, 0xE9, 0x2B, 0x9A, 0xC4, 0x68, 0x4B, 0xF1, 0xF4, 0xE2, 0xC8, 0x20, 0xE8,
+0x00, 0xF8, 0xE0, 0x13, 0xAF, 0xC1, 0x24, 0xD9, 0x5B, 0xFF, 0x4E, 0xC0, 0x8D, 0x84, 0x56, 0xC4,
+0xA9, 0x3B, 0x69, 0x23, 0xE8, 0x22, 0x87, 0x1A, 0x26, 0x1A, 0xA1, 0x7A, 0xC0, 0x26, 0x32, 0x92,
+0xA6, 0x92, 0xAE, 0xC0, 0x08, 0x2A, 0xA6, 0x76, 0xA9, 0xC0, 0xC8, 0x29, 0xA9, 0xC0, 0x07, 0x32,
+0x80, 0xC2, 0x83, 0x09, 0xC8, 0x2A, 0x6D, 0x54, 0xAF, 0xA6, 0xA1, 0xC2, 0x4B, 0x4B, 0x27, 0x32,
+0x86, 0x29, 0xBF, 0xC0, 0xE7, 0x39, 0x00, 0xC1, 0x8A, 0x52, 0x30, 0x84, 0x00, 0xA6, 0x99, 0x71,
+0xA6, 0x45, 0x71, 0xC1, 0x2C, 0x63, 0x49, 0x42, 0xA1, 0xC0, 0xEB, 0x5A, 0x40, 0xC0, 0x71, 0x8C,
+0x45, 0xC1, 0xCE, 0x7B, 0x30, 0x8C, 0x00, 0x81, 0xC0, 0x2F, 0x84, 0x45, 0x99, 0x45, 0xC2, 0xB1,
+0x94, 0x13, 0x9D, 0x1B, 0xDF, 0x80, 0xC2, 0x8C, 0x5B, 0xE6, 0x21, 0x26, 0x22, 0xA6, 0x95, 0xC0,
+0x88, 0x32, 0x00, 0x46, 0xC5, 0x6C, 0x53, 0x37, 0xB6, 0xD5, 0xAD, 0x74, 0xA5, 0x17, 0xBE, 0x34,
+0xA5, 0x56, 0xC0, 0x0F, 0x74, 0x49, 0xC7, 0x67, 0x2A, 0x4A, 0x43, 0x26, 0x1A, 0x2A, 0x43, 0xC4,
+0x11, 0xE8, 0x32, 0x66, 0x2A, 0xE9, 0x42, 0x4F, 0xC2, 0xFA, 0xDE, 0x16, 0xD6, 0x04, 0x5A, 0x67,
+0xC2, 0x68, 0x83, 0x30, 0xBD, 0xB7, 0xE6, 0x96, 0x96, 0x95, 0xB6, 0x01, 0x58, 0x99, 0x00, 0x58,
+0x5D, 0x01, 0x58, 0x00, 0x4E, 0x00, 0xA6, 0xC9, 0xF2, 0xD5, 0x4F, 0xEE, 0x11, 0xFF, 0xB4, 0xE6,
+0x9B, 0xF7, 0x53, 0x95, 0x4C, 0x43, 0xA5, 0x09, 0x0A, 0x33, 0xE5, 0x11, 0xB6, 0xC1, 0x0A, 0x43,
+0xE5, 0x21, 0xBE, 0xC3, 0x29, 0x4B, 0xAB, 0x5B, 0x47, 0x32, 0xE7, 0x29, 0x92, 0x95, 0xAF, 0xB9,
+0x00, 0x41, 0xC0, 0x27, 0x32, 0x53, 0x95, 0x96, 0x9D, 0xC2, 0x66, 0x1A, 0x07, 0x23, 0x87, 0x23,
+0xAE, 0xC3, 0x09, 0x2C, 0x88, 0x53, 0xF1, 0xF4, 0xE2, 0xC8, 0x5C, 0xC0, 0x00, 0xF8, 0xE0, 0x13,
+0xAF, 0xC5, 0x24, 0xD9, 0x5A, 0xFF, 0x54, 0xC6, 0x8D, 0x84, 0x4B, 0x6C, 0x67, 0x33, 0x9B, 0xC2,
+0x08, 0x23, 0xA8, 0x1A, 0x27, 0x1A, 0x46, 0xBA, 0xAB, 0xA7, 0x00, 0xC0, 0x87, 0x21, 0x7B, 0xC0,
+0x08, 0x22, 0xA6, 0x7B, 0xBF, 0xBA, 0x7E, 0xC0, 0x08, 0x32, 0x4B, 0xC3, 0x43, 0x11, 0xE4, 0x19,
+0xAA, 0x43, 0xAE, 0x5C, 0x00, 0xAB, 0xC1, 0xED, 0x5B, 0xC9, 0x42, 0x44, 0xA2, 0xBF, 0xBF, 0x00,
+0xC0, 0xAE, 0x73, 0x71, 0xC0, 0x8E, 0x73, 0x95, 0x58, 0xC0, 0x2C, 0x63, 0xBF, 0xC0, 0xCA, 0x52,
+0x91, 0xC0, 0x08, 0x3A, 0x4C, 0xC2, 0x69, 0x4A, 0x4C, 0x63, 0x8D, 0x6B, 0x75, 0xBA, 0xC0, 0x8D,
+0x73, 0x91, 0xC1, 0xCA, 0x5A, 0x0B, 0x5B, 0x7D, 0x4E, 0xBF, 0xC0, 0x2F, 0x7C, 0x73, 0xC0, 0x94,
+0xA5, 0x9A, 0xC1, 0x8C, 0x5B, 0x68, 0x32, 0x85, 0xBE, 0x77, 0xC0, 0x25, 0x22, 0xAB, 0xCC, 0xC4,
+0x19, 0xA8, 0x42, 0xD1, 0x84, 0x12, 0x9D, 0xD5, 0xBD, 0x74, 0xB5, 0x91, 0x94, 0xB5, 0xB5, 0xEE,
+0x73, 0x27, 0x32, 0x88, 0x32, 0x6B, 0x4B, 0xA8, 0x32, 0x6F, 0x70, 0xC2, 0x08, 0x3B, 0x46, 0x22,
+0x67, 0x32, 0x58, 0xC6, 0x57, 0xCE, 0x90, 0x9C, 0x24, 0x5A, 0xEE, 0xBC, 0x68, 0x83, 0x30, 0xB5,
+0xB7, 0xE6, 0x92, 0x9A, 0xA6, 0xA9, 0xA6, 0x05, 0x62, 0x5D, 0x02, 0x95, 0xA6, 0xC9, 0xD2, 0xCD,
+0x2F, 0xE6, 0xB0, 0xF6, 0x32, 0xD6, 0x9B, 0xF7, 0xF2, 0x8C, 0x0B, 0x43, 0xC5, 0x09, 0xC9, 0x2A,
+0x06, 0x1A, 0x77, 0xC6, 0x2A, 0x4B, 0x26, 0x2A, 0xE8, 0x42, 0x8A, 0x5B, 0xEC, 0x63, 0x4B, 0x53,
+0xE6, 0x29, 0xAB, 0xAF, 0x00, 0x4A, 0x95, 0xAE, 0xBE, 0xA6, 0x4F, 0x54, 0x99, 0xC7, 0x67, 0x1A,
+0x08, 0x23, 0xA8, 0x2B, 0x08, 0x2C, 0x2A, 0x2C, 0x89, 0x53, 0xD1, 0xF4, 0xE2, 0xC0, 0x5C, 0xC0,
+0x00, 0xF8, 0xE0, 0x13, 0xAF, 0xC5, 0x24, 0xD9, 0x5A, 0xFF, 0x34, 0xC6, 0xAD, 0x84, 0x4B, 0x6C,
+0xC7, 0x3B, 0x82, 0xC2, 0xE7, 0x22, 0x66, 0x1A, 0x06, 0x1A, 0xBB, 0xBA, 0xB6, 0xC1, 0x29, 0x3A,
+0x6A, 0x42, 0x82, 0x57, 0xAF, 0xA9, 0x92, 0x00, 0xBF, 0xA1, 0xA9, 0xC1, 0x07, 0x32, 0xA5, 0x21,
+0x80, 0xC2, 0x86, 0x22, 0x0C, 0x4C, 0xCE, 0x5C, 0xA6, 0xC2, 0x4E, 0x5C, 0x8C, 0x4B, 0xA9, 0x3A,
+0x4B, 0x46, 0xBF, 0xC1, 0x45, 0x21, 0xC7, 0x31, 0xBA, 0x96, 0xC0, 0x45, 0x29, 0x00, 0xC0, 0xE4,
+0x18, 0xA5, 0xAE, 0x48, 0x00, 0x41, 0xBF, 0x64, 0x96, 0x41, 0xBA, 0xC0, 0x65, 0x29, 0xA5, 0x41,
+0xC1, 0x24, 0x21, 0x85, 0x29, 0xAE, 0xBF, 0xC4, 0x07, 0x3A, 0x84, 0x21, 0xE6, 0x29, 0x88, 0x3A,
+0xE9, 0x42, 0x81, 0xC0, 0x26, 0x1A, 0x43, 0xC0, 0x8B, 0x4B, 0xBE, 0xBF, 0xA6, 0xD0, 0x87, 0x3A,
+0x4A, 0x5B, 0x74, 0xAD, 0x7C, 0xF7, 0x1B, 0xEF, 0xB9, 0xDE, 0xFA, 0xE6, 0x38, 0xC6, 0x91, 0x84,
+0xA9, 0x42, 0xEA, 0x42, 0x47, 0x22, 0x09, 0x43, 0x05, 0x1A, 0x08, 0x3B, 0x46, 0x22, 0xA8, 0x3A,
+0x53, 0xC6, 0x17, 0xC6, 0xCD, 0x83, 0x25, 0x5A, 0xEF, 0xBC, 0x48, 0x83, 0x10, 0xB5, 0x97, 0xE6,
+0x96, 0xA6, 0x96, 0xAE, 0x00, 0x64, 0x04, 0xC0, 0x78, 0xDE, 0x96, 0x64, 0x01, 0x96, 0xA1, 0xC0,
+0xB3, 0xCD, 0x72, 0xC7, 0xD1, 0xFE, 0xF1, 0xD5, 0x39, 0xE7, 0x90, 0x7C, 0x0B, 0x43, 0xC5, 0x09,
+0xE9, 0x2A, 0x47, 0x1A, 0x77, 0xC2, 0x2A, 0x4B, 0x05, 0x2A, 0x09, 0x4B, 0x91, 0xC0, 0x0A, 0x4B,
+0x46, 0xC0, 0x47, 0x3A, 0x53, 0x96, 0x97, 0xAE, 0x00, 0xA5, 0x00, 0xC1, 0x66, 0x19, 0xC7, 0x19,
+0xAF, 0x9D, 0xC9, 0x47, 0x12, 0xE7, 0x1A, 0x87, 0x2B, 0xE8, 0x2B, 0x2A, 0x34, 0x89, 0x53, 0xD1,
+0xF4, 0xC2, 0xC0, 0x20, 0xE8, 0x00, 0xF8, 0xE0, 0x13, 0xAF, 0xC0, 0x24, 0xD9, 0x75, 0xC3, 0x34,
+0xC6, 0xAD, 0x84, 0x6B, 0x6C, 0xA7, 0x3B, 0x9B, 0xC2, 0x49, 0x2B, 0xA8, 0x22, 0x26, 0x22, 0xA6,
+0xB6, 0xBA, 0xA7, 0xC0, 0x28, 0x3A, 0x81, 0xC2, 0x86, 0x19, 0xC6, 0x21, 0x28, 0x2A, 0xA6, 0x00,
+0xC0, 0x4A, 0x32, 0xA1, 0xC0, 0xA7, 0x21, 0x4B, 0xC1, 0x47, 0x32, 0x63, 0x11, 0x9E, 0xC1, 0x49,
+0x33, 0xAE, 0x54, 0x91, 0xBB, 0xA1, 0xC1, 0x4B, 0x43, 0x48, 0x2A, 0x43, 0xC2, 0xE8, 0x31, 0x29,
+0x42, 0x65, 0x29, 0xA6, 0xC2, 0xA6, 0x31, 0x25, 0x21, 0x66, 0x29, 0x69, 0x64, 0x5C, 0xA5, 0x95,
+0x00, 0x50, 0x5C, 0x00, 0xA9, 0x50, 0xC1, 0xC6, 0x39, 0x07, 0x42, 0x96, 0xC0, 0x48, 0x42, 0xBF,
+0x6A, 0x00, 0x95, 0xC1, 0x68, 0x3A, 0xC9, 0x42, 0xAE, 0xAF, 0x5F, 0xC3, 0x05, 0x1A, 0x67, 0x22,
+0xAB, 0x4B, 0xEC, 0x5B, 0x00, 0xC4, 0x2D, 0x6C, 0xE5, 0x29, 0x05, 0x3A, 0xD5, 0xBD, 0xFE, 0xFF,
+0xA6, 0x00, 0xA6, 0xC2, 0xFF, 0xFF, 0x1A, 0xD7, 0x0A, 0x4B, 0x82, 0xCD, 0x27, 0x22, 0xE9, 0x3A,
+0x46, 0x2A, 0x49, 0x43, 0x25, 0x22, 0xC9, 0x3A, 0x07, 0x32, 0x17, 0xC6, 0xCD, 0x8B, 0x25, 0x62,
+0xEF, 0xBC, 0x48, 0x83, 0xF0, 0xBC, 0x77, 0xEE, 0x96, 0x9A, 0xA5, 0x6C, 0x00, 0xA6, 0x00, 0x9A,
+0x00, 0x67, 0x00, 0xC0, 0x78, 0xDE, 0x6C, 0x67, 0x64, 0x00, 0xA5, 0x91, 0xCA, 0xB2, 0xCD, 0xED,
+0xDD, 0x11, 0xFF, 0x11, 0xD6, 0x59, 0xEF, 0x90, 0x7C, 0xEA, 0x3A, 0x64, 0x01, 0xC9, 0x2A, 0x47,
+0x22, 0xE5, 0x19, 0x56, 0xC5, 0xC4, 0x21, 0xA7, 0x3A, 0xA4, 0x19, 0x06, 0x2A, 0x4B, 0x53, 0x27,
+0x32, 0x96, 0x96, 0xBF, 0xAF, 0x57, 0x48, 0xA5, 0x4B, 0x50, 0x8B, 0x95, 0xC5, 0x46, 0x0A, 0xE7,
+0x1A, 0x67, 0x23, 0xC7, 0x23, 0x2A, 0x2C, 0x89, 0x53, 0x4F, 0x74, 0xC1, 0x20, 0xE8, 0x00, 0xF8,
+0xE0, 0x13, 0x9B, 0xC5, 0x86, 0xE1, 0x3A, 0xFF, 0x75, 0xCE, 0x8D, 0x84, 0x2A, 0x64, 0xA8, 0x33,
+0x96, 0xC1, 0xE7, 0x22, 0x87, 0x22, 0xB5, 0xB6, 0xA1, 0xC0, 0xA3, 0x31, 0x92, 0xC1, 0xE5, 0x31,
+0x83, 0x21, 0x7D, 0xC1, 0x47, 0x32, 0xE6, 0x21, 0x57, 0x92, 0xBE, 0xC0, 0x29, 0x32, 0x57, 0x4B,
+0x91, 0x99, 0xC0, 0xE5, 0x19, 0x85, 0xC1, 0x2D, 0x4C, 0x6E, 0x54, 0x9E, 0x6F, 0xC1, 0xED, 0x4B,
+0xC9, 0x2A, 0x48, 0xC1, 0x08, 0x32, 0xA6, 0x31, 0xBF, 0x7D, 0x4C, 0x7D, 0x91, 0xBF, 0x91, 0x69,
+0xC2, 0x28, 0x42, 0x8A, 0x52, 0x08, 0x42, 0x78, 0x00, 0x4C, 0x00, 0x7D, 0x95, 0xA1, 0x00, 0x69,
+0x6E, 0x00, 0x95, 0xAF, 0xC0, 0xC6, 0x21, 0x49, 0x41, 0x77, 0xC1, 0x67, 0x22, 0x2A, 0x3B, 0xBF,
+0xC0, 0xC4, 0x11, 0xA1, 0xC8, 0xE8, 0x3A, 0x09, 0x4B, 0x63, 0x19, 0x05, 0x3A, 0x94, 0xB5, 0xB9,
+0xE6, 0xDD, 0xFF, 0x7C, 0xFF, 0xBD, 0xFF, 0xA6, 0xCE, 0x1B, 0xDF, 0xAD, 0x63, 0x0B, 0x4B, 0x47,
+0x2A, 0xE9, 0x3A, 0x05, 0x1A, 0x2A, 0x43, 0x67, 0x2A, 0x0A, 0x4B, 0x07, 0x3A, 0xB5, 0xBD, 0xEE,
+0x93, 0x45, 0x62, 0x71, 0xCD, 0xCA, 0x9B, 0xAF, 0xC2, 0x14, 0xDE, 0x56, 0xEE, 0xD8, 0xFE, 0x81,
+0xAE, 0x91, 0x00, 0xAF, 0xA1, 0x01, 0x91, 0x6D, 0x00, 0x96, 0x68, 0x95, 0xC0, 0xD4, 0xCD, 0x91,
+0xC9, 0x50, 0xC5, 0x6F, 0xF6, 0xD0, 0xFE, 0xB3, 0xE6, 0xBA, 0xF7, 0x0D, 0x74, 0xC9, 0x3A, 0x63,
+0x01, 0x88, 0x22, 0x06, 0x1A, 0xA6, 0x42, 0xC9, 0x27, 0x2A, 0xA4, 0x19, 0x6C, 0x53, 0xEF, 0x63,
+0x89, 0x32, 0x08, 0x22, 0x69, 0x2A, 0xC7, 0x19, 0x07, 0x22, 0x48, 0x32, 0x94, 0xBA, 0xC1, 0x83,
+0x21, 0xE5, 0x31, 0x80, 0x46, 0x85, 0xC3, 0x25, 0x0A, 0x28, 0x1B, 0x88, 0x23, 0xE9, 0x23, 0x00,
+0xC4, 0xA9, 0x53, 0x12, 0xFD, 0xA2, 0xC0, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x13, 0x9F, 0x7A, 0xC1,
+0x3A, 0xFF, 0x75, 0xCE, 0x7F, 0x4F, 0xC0, 0xA9, 0x33, 0x96, 0xC6, 0x08, 0x2B, 0xA7, 0x2A, 0x45,
+0x32, 0xE3, 0x31, 0x64, 0x4A, 0x68, 0x6B, 0xEB, 0x83, 0x81, 0xC5, 0x07, 0x5B, 0x44, 0x3A, 0x82,
+0x21, 0xC5, 0x29, 0x69, 0x3A, 0xE8, 0x29, 0x91, 0xC0, 0x29, 0x32, 0x95, 0x95, 0xC0, 0x28, 0x2A,
+0x55, 0xC5, 0xA5, 0x19, 0x42, 0x01, 0x66, 0x1A, 0xEC, 0x43, 0xAE, 0x54, 0x4D, 0x44, 0xA2, 0xC7,
+0xAC, 0x43, 0xAA, 0x32, 0xE7, 0x29, 0x0C, 0x5B, 0x69, 0x4A, 0x08, 0x42, 0xEB, 0x5A, 0x4D, 0x6B,
+0x91, 0x01, 0xC3, 0x75, 0xAD, 0x79, 0xCE, 0xFB, 0xDE, 0x58, 0xCE, 0x69, 0xA1, 0xC4, 0x96, 0xB5,
+0xF7, 0xBD, 0x13, 0xA5, 0x50, 0x84, 0x6D, 0x6B, 0x00, 0xC0, 0xEF, 0x7B, 0x4A, 0xC3, 0xEE, 0x7B,
+0x6C, 0x63, 0xEA, 0x4A, 0x27, 0x32, 0x80, 0xC3, 0x47, 0x2A, 0xE9, 0x3A, 0xCD, 0x53, 0xB0, 0x6C,
+0xBF, 0xC1, 0x2E, 0x64, 0x09, 0x43, 0x91, 0xC5, 0x05, 0x2A, 0xC0, 0x08, 0xA4, 0x31, 0xF1, 0xA4,
+0xD5, 0xCD, 0x17, 0xD6, 0x44, 0xAF, 0x9B, 0x85, 0xC0, 0x0A, 0x4B, 0x9A, 0xC1, 0x68, 0x2A, 0x0A,
+0x3B, 0x77, 0xCD, 0x2A, 0x43, 0x05, 0x1A, 0xA9, 0x3A, 0xE6, 0x31, 0x13, 0xAD, 0x2E, 0x9C, 0xE4,
+0x59, 0x71, 0xCD, 0xCD, 0xBC, 0x0B, 0xA4, 0x0F, 0xBD, 0x50, 0xCD, 0xF3, 0xDD, 0x91, 0xD5, 0x00,
+0x9E, 0xC0, 0xF2, 0xD5, 0xA6, 0x91, 0x72, 0x77, 0x63, 0x72, 0x63, 0x5E, 0x63, 0x5E, 0x91, 0xAE,
+0xBD, 0xC4, 0x70, 0xEE, 0x33, 0xFF, 0x73, 0xDE, 0x59, 0xEF, 0x6E, 0x7C, 0x56, 0xC2, 0x63, 0x01,
+0x88, 0x22, 0xE6, 0x19, 0xA6, 0xC3, 0xC9, 0x3A, 0x07, 0x2A, 0x44, 0x11, 0xA6, 0x19, 0x00, 0xC0,
+0x08, 0x22, 0x81, 0xBF, 0xC0, 0x49, 0x2A, 0xA4, 0xC0, 0xC4, 0x21, 0xB9, 0xC2, 0x64, 0x42, 0x47,
+0x63, 0xA9, 0x73, 0x9E, 0x86, 0xC4, 0x44, 0x2A, 0x03, 0x12, 0x27, 0x23, 0x88, 0x23, 0xEA, 0x23,
+0xA9, 0xC4, 0xA9, 0x53, 0x12, 0xFD, 0xA2, 0xC0, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0x9B,
+0xC5, 0x86, 0xE1, 0x3A, 0xFF, 0x75, 0xCE, 0x8C, 0x84, 0x2A, 0x64, 0x48, 0x2B, 0xAB, 0xC0, 0xC6,
+0x2A, 0x45, 0xC4, 0x84, 0x42, 0x66, 0x73, 0x2D, 0xB5, 0xF4, 0xEE, 0x76, 0xFF, 0x9A, 0x91, 0xC5,
+0xAF, 0xB5, 0x47, 0x6B, 0xE3, 0x39, 0x84, 0x29, 0xC7, 0x31, 0x08, 0x32, 0x81, 0x00, 0xAE, 0x43,
+0xA9, 0xC0, 0x65, 0x11, 0x94, 0xC2, 0x83, 0x09, 0x6A, 0x3B, 0xCF, 0x54, 0x95, 0xC9, 0x2D, 0x44,
+0xCC, 0x3B, 0x2A, 0x3B, 0x89, 0x32, 0x50, 0x84, 0x0B, 0x63, 0x48, 0x4A, 0xCF, 0x7B, 0x14, 0xA5,
+0xB2, 0x9C, 0x00, 0xC0, 0x13, 0xA5, 0x92, 0xC0, 0x54, 0xAD, 0xBF, 0x50, 0x7C, 0xBE, 0x50, 0x49,
+0xC1, 0x95, 0xB5, 0x34, 0xAD, 0x7C, 0x44, 0x58, 0x6C, 0x9A, 0x95, 0xC1, 0x90, 0x84, 0x0E, 0x6C,
+0x96, 0xC2, 0x2E, 0x64, 0x90, 0x6C, 0x32, 0x7D, 0xA6, 0xC8, 0x6F, 0x64, 0x8C, 0x53, 0xA8, 0x3A,
+0xC5, 0x21, 0xC1, 0x08, 0x20, 0x00, 0x02, 0x19, 0xAC, 0x7B, 0x2F, 0x94, 0xA5, 0x96, 0xAF, 0x95,
+0xCA, 0x2F, 0x7C, 0x07, 0x32, 0xA9, 0x3A, 0x27, 0x22, 0xA9, 0x32, 0xC5, 0x11, 0x4B, 0x4B, 0x26,
+0x22, 0xEA, 0x4A, 0x47, 0x42, 0x90, 0x94, 0xB0, 0xC2, 0x25, 0x62, 0xEE, 0xBC, 0x90, 0xCD, 0x91,
+0x00, 0xBA, 0xAE, 0xC1, 0xCC, 0xBC, 0x0D, 0xBD, 0xBE, 0xC0, 0x8F, 0xCD, 0x91, 0xC0, 0xEC, 0xBC,
+0x00, 0x70, 0x5C, 0xBF, 0x68, 0x91, 0x68, 0x00, 0x5C, 0xC9, 0x6E, 0xCD, 0xCF, 0xD5, 0x70, 0xEE,
+0x92, 0xEE, 0x4F, 0xB5, 0x96, 0xCE, 0x4E, 0x74, 0xA8, 0x32, 0x84, 0x09, 0x89, 0x2A, 0x79, 0x74,
+0x64, 0xC0, 0xA6, 0x21, 0xAE, 0xC2, 0x49, 0x32, 0x87, 0x19, 0x09, 0x22, 0x86, 0xA0, 0xC5, 0x07,
+0x2A, 0x83, 0x21, 0x23, 0x3A, 0x2A, 0x8C, 0xCF, 0xBD, 0x54, 0xF7, 0xAF, 0xC4, 0xB6, 0xFF, 0x14,
+0xDF, 0x0C, 0x95, 0xA7, 0x53, 0x26, 0x33, 0x87, 0xC0, 0xEA, 0x33, 0x85, 0xC4, 0x89, 0x53, 0x12,
+0xFD, 0xA2, 0xC0, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0xAB, 0xC5, 0xA6, 0xE9, 0x3A, 0xFF,
+0x75, 0xCE, 0x8C, 0x84, 0x0A, 0x64, 0x48, 0x3B, 0x9A, 0xC7, 0x84, 0x32, 0x63, 0x42, 0x08, 0x84,
+0x0F, 0xCE, 0x13, 0xF7, 0x54, 0xFF, 0x71, 0xDE, 0xD2, 0xEE, 0x4B, 0x00, 0xC3, 0x92, 0xDE, 0x4A,
+0x8C, 0xC3, 0x39, 0x06, 0x3A, 0x83, 0x95, 0xC0, 0x29, 0x2A, 0xA9, 0xC1, 0x86, 0x19, 0xC7, 0x21,
+0x50, 0xC4, 0xA5, 0x19, 0x02, 0x01, 0xE5, 0x11, 0x6A, 0x33, 0xAF, 0x54, 0xBE, 0xC1, 0x2D, 0x4C,
+0xAC, 0x43, 0x7E, 0xC5, 0x2F, 0x84, 0xCB, 0x62, 0x86, 0x39, 0x0B, 0x6B, 0x91, 0x9C, 0x0F, 0x8C,
+0xAB, 0xC0, 0x71, 0x94, 0x91, 0x00, 0x91, 0x00, 0x48, 0x64, 0x5C, 0x48, 0x96, 0xC1, 0x50, 0x8C,
+0x91, 0x94, 0x5C, 0x4D, 0x48, 0xC1, 0x71, 0x8C, 0xB2, 0x94, 0x80, 0xC1, 0x2F, 0x6C, 0xCD, 0x5B,
+0x7A, 0x90, 0xC3, 0xCD, 0x53, 0x2E, 0x5C, 0x6B, 0x4B, 0xC5, 0x19, 0xBA, 0x91, 0xC4, 0xC1, 0x08,
+0x40, 0x00, 0x22, 0x21, 0x6B, 0x73, 0xCD, 0x8B, 0x01, 0x9B, 0x81, 0xC1, 0xEE, 0x73, 0x47, 0x32,
+0x56, 0xCC, 0x68, 0x2A, 0xE9, 0x3A, 0x06, 0x1A, 0x2A, 0x43, 0x26, 0x22, 0xC9, 0x42, 0x06, 0x32,
+0xCD, 0x83, 0x0D, 0x94, 0x08, 0x73, 0x89, 0x8B, 0x4B, 0xA4, 0x0E, 0xB5, 0xBE, 0xA6, 0xA5, 0x57,
+0x63, 0x91, 0xAE, 0xBE, 0x91, 0x96, 0x48, 0x92, 0x40, 0xAE, 0xA1, 0x40, 0x00, 0x91, 0xC8, 0xEC,
+0xB4, 0x2D, 0xBD, 0xAF, 0xCD, 0x4E, 0xBD, 0xCE, 0xA4, 0xF8, 0xDE, 0x8F, 0x7C, 0x88, 0x32, 0xE6,
+0x19, 0x66, 0xC2, 0xC7, 0x19, 0xE8, 0x29, 0x28, 0x32, 0xA6, 0xC4, 0xAE, 0x63, 0x76, 0x9D, 0x11,
+0x6C, 0x2A, 0x2A, 0xA8, 0x11, 0xA9, 0xC4, 0x84, 0x21, 0xC2, 0x31, 0x29, 0x8C, 0xD2, 0xE6, 0x54,
+0xFF, 0x95, 0xC2, 0xB1, 0xEE, 0x12, 0xF7, 0x53, 0xF7, 0x95, 0xC3, 0x91, 0xC6, 0xAA, 0x7C, 0x26,
+0x3B, 0x67, 0x2B, 0x9F, 0xC4, 0x68, 0x4B, 0x11, 0xF5, 0xA1, 0xC0, 0x41, 0xE8, 0x00, 0xF8, 0xE0,
+0x12, 0x62, 0x69, 0x42, 0xCB, 0x3A, 0xFF, 0x75, 0xCE, 0x8C, 0x84, 0xE9, 0x63, 0x68, 0x43, 0x84,
+0x2A, 0x62, 0x3A, 0x08, 0x84, 0x0F, 0xD6, 0xF2, 0xF6, 0x71, 0xE6, 0x8E, 0xC5, 0xAB, 0xA5, 0xA4,
+0xC1, 0xEE, 0xDD, 0x53, 0xFF, 0x92, 0xC3, 0xE9, 0x8B, 0x41, 0x29, 0x06, 0x32, 0x48, 0x32, 0x92,
+0xC0, 0x87, 0x19, 0x00, 0xBE, 0xA5, 0xC5, 0x25, 0x19, 0x65, 0x11, 0xC5, 0x19, 0xA8, 0x2A, 0xEC,
+0x4B, 0x8F, 0x5C, 0x95, 0xC6, 0x0C, 0x4C, 0x6B, 0x4B, 0x0F, 0x7C, 0x8D, 0x7B, 0xE7, 0x41, 0xCA,
+0x62, 0x30, 0x94, 0x81, 0xBE, 0xAF, 0x00, 0x4B, 0x96, 0x74, 0x00, 0x7C, 0x43, 0x7C, 0xC0, 0x50,
+0x8C, 0x48, 0x00, 0x43, 0x00, 0x48, 0x9A, 0xA9, 0x86, 0xC0, 0x2B, 0x53, 0x56, 0xC2, 0x26, 0x22,
+0xC5, 0x11, 0xC9, 0x32, 0xAE, 0xC2, 0x47, 0x22, 0xA5, 0x19, 0xE7, 0x29, 0x95, 0xC4, 0xC1, 0x08,
+0x40, 0x00, 0x22, 0x21, 0x6C, 0x73, 0x2F, 0x94, 0xA5, 0x9A, 0xAB, 0x80, 0xC3, 0x2F, 0x7C, 0x88,
+0x3A, 0x2B, 0x4B, 0x68, 0x2A, 0x56, 0xC6, 0x47, 0x2A, 0xC9, 0x3A, 0x06, 0x22, 0xEA, 0x42, 0x89,
+0x4A, 0xD1, 0x9C, 0x32, 0xB5, 0x90, 0xC2, 0x28, 0x7B, 0xC6, 0x6A, 0x27, 0x73, 0x7F, 0xA5, 0xA2,
+0xAE, 0xC1, 0xC6, 0x72, 0xC3, 0x49, 0x91, 0xC1, 0x04, 0x5A, 0x45, 0x62, 0x9A, 0x91, 0xC2, 0xA2,
+0x49, 0xE3, 0x51, 0x65, 0x62, 0x01, 0x61, 0x95, 0xC0, 0xA6, 0x6A, 0x66, 0xC4, 0x48, 0x7B, 0x8A,
+0x7B, 0x8F, 0x94, 0x98, 0xC6, 0x0E, 0x64, 0x92, 0xC0, 0x94, 0x8D, 0xBF, 0xC8, 0xD7, 0xA5, 0x18,
+0xAE, 0xB6, 0xAD, 0xF7, 0xB5, 0x3C, 0xDF, 0xFF, 0xF7, 0x5E, 0xD7, 0x2E, 0x53, 0xA7, 0x19, 0xB9,
+0xC5, 0x82, 0x29, 0xA8, 0x7B, 0x51, 0xDE, 0x13, 0xF7, 0x91, 0xE6, 0xCE, 0xCD, 0xA6, 0xA4, 0x95,
+0xCA, 0x4E, 0xDE, 0x31, 0xF7, 0x90, 0xCE, 0x89, 0x7C, 0xE3, 0x32, 0x67, 0x23, 0x68, 0x4B, 0xF1,
+0xF4, 0xA1, 0xC0, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0xAB, 0xCD, 0xA6, 0xE9, 0x3A, 0xFF,
+0x75, 0xCE, 0x6C, 0x84, 0xE9, 0x63, 0x06, 0x3B, 0xE1, 0x19, 0x04, 0x53, 0xAD, 0xC5, 0xB1, 0xEE,
+0x4F, 0xE6, 0x72, 0xE6, 0xF5, 0xEE, 0x99, 0xFF, 0xA0, 0xC1, 0x92, 0xEE, 0x8C, 0xD5, 0x90, 0xCC,
+0x32, 0xFF, 0x71, 0xDE, 0xE2, 0x41, 0xA4, 0x29, 0xA6, 0x21, 0x45, 0x19, 0x0D, 0x53, 0xF1, 0x73,
+0xC8, 0x31, 0x25, 0x19, 0xCB, 0x4A, 0xB6, 0xA5, 0x58, 0xB6, 0xAD, 0xC1, 0x73, 0x85, 0x4E, 0x5C,
+0x81, 0x99, 0xC5, 0x4A, 0x3B, 0x8C, 0x6B, 0xCE, 0x83, 0x28, 0x52, 0x89, 0x5A, 0xEF, 0x8B, 0xA9,
+0xC0, 0x30, 0x94, 0xA9, 0x77, 0xAE, 0x77, 0x99, 0xB7, 0x77, 0x7C, 0x00, 0x96, 0x95, 0xA6, 0xBF,
+0x48, 0xBE, 0x48, 0x95, 0x9A, 0xC2, 0x06, 0x2A, 0x47, 0x2A, 0x2A, 0x43, 0xAE, 0x00, 0xC2, 0x67,
+0x22, 0xE6, 0x19, 0x08, 0x2A, 0xA5, 0xC4, 0x65, 0x21, 0x61, 0x00, 0x00, 0x00, 0x02, 0x21, 0x6B,
+0x73, 0x75, 0xA1, 0x9A, 0x6D, 0x95, 0xC4, 0x4F, 0x7C, 0x68, 0x3A, 0xEA, 0x3A, 0x26, 0x22, 0xC9,
+0x3A, 0x46, 0xC0, 0xA8, 0x32, 0x5A, 0xC2, 0x2B, 0x4B, 0x2B, 0x5B, 0xF2, 0x9C, 0xBA, 0xC1, 0x2A,
+0x73, 0xE5, 0x49, 0xAE, 0xC0, 0x66, 0x52, 0xA6, 0xBF, 0xBE, 0x00, 0xC4, 0x0A, 0x73, 0xA4, 0x41,
+0x02, 0x31, 0x84, 0x41, 0x06, 0x52, 0xAE, 0x70, 0xC0, 0x02, 0x29, 0x70, 0xC0, 0x47, 0x5A, 0x00,
+0xC0, 0xA8, 0x62, 0xAB, 0xAE, 0xC0, 0x2B, 0x73, 0x51, 0x90, 0xC5, 0xAC, 0x7B, 0x13, 0x9D, 0x75,
+0x9D, 0x0B, 0x43, 0xD2, 0x74, 0xFF, 0xDF, 0xBA, 0xC0, 0xFF, 0xF7, 0x00, 0xC1, 0x7E, 0xEF, 0xDF,
+0xF7, 0x00, 0x6E, 0xC9, 0x9F, 0xE7, 0x93, 0x84, 0x87, 0x19, 0x64, 0x21, 0x44, 0x4A, 0x8F, 0xC5,
+0x34, 0xFF, 0x70, 0xE6, 0xF4, 0xEE, 0x97, 0xFF, 0xAF, 0xC8, 0x55, 0xFF, 0x2E, 0xE6, 0x4A, 0xCD,
+0xCB, 0xD5, 0xEF, 0xEE, 0x0D, 0xC6, 0x43, 0x4B, 0x46, 0x23, 0x48, 0x4B, 0x54, 0xC2, 0xA1, 0xC0,
+0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0xAB, 0xC8, 0xA6, 0xE9, 0x5A, 0xFF, 0x75, 0xCE, 0x6C,
+0x7C, 0xE9, 0x63, 0x05, 0x3B, 0x62, 0x32, 0x28, 0x84, 0x90, 0xDE, 0x43, 0x93, 0xC1, 0x78, 0xFF,
+0xFD, 0xFF, 0xA2, 0x63, 0xC9, 0xB9, 0xFF, 0xB2, 0xF6, 0x87, 0xAC, 0xAB, 0xCD, 0xB4, 0xFF, 0xAA,
+0x94, 0xA3, 0x29, 0xC7, 0x21, 0x2D, 0x5B, 0x5E, 0xE7, 0xBF, 0xC2, 0x90, 0x6B, 0xF1, 0x73, 0xDC,
+0xD6, 0x6E, 0x96, 0xA8, 0xC7, 0x5B, 0xD7, 0xF5, 0x9D, 0x8F, 0x64, 0x0C, 0x44, 0x6A, 0x3B, 0x4B,
+0x63, 0x0F, 0x8C, 0x48, 0x52, 0xBE, 0xC0, 0xCE, 0x8B, 0x9A, 0x7C, 0x6B, 0x68, 0xA5, 0xA6, 0x5C,
+0xC0, 0xEE, 0x8B, 0x7C, 0x00, 0xA6, 0x81, 0xAE, 0x6F, 0x77, 0xAF, 0x00, 0xAE, 0xAE, 0x9A, 0xC0,
+0x64, 0x19, 0x81, 0xC0, 0xE6, 0x19, 0xBE, 0xC0, 0x46, 0x22, 0x91, 0xC0, 0x68, 0x2A, 0xB2, 0xC6,
+0xC7, 0x29, 0x66, 0x21, 0xC2, 0x10, 0x20, 0x00, 0x23, 0x21, 0x8C, 0x7B, 0x0E, 0x8C, 0xBE, 0x81,
+0x75, 0x8A, 0xC1, 0x90, 0x84, 0xA8, 0x3A, 0x5B, 0xC2, 0x88, 0x2A, 0xE9, 0x3A, 0xC4, 0x19, 0x47,
+0xC5, 0x27, 0x2A, 0x89, 0x3A, 0xA9, 0x4A, 0x0B, 0x5B, 0x69, 0x52, 0xC2, 0x20, 0x95, 0xC0, 0x23,
+0x29, 0xAF, 0x91, 0xBA, 0x00, 0x92, 0xC2, 0xE7, 0x41, 0x24, 0x21, 0xA2, 0x18, 0xAE, 0xC1, 0x04,
+0x21, 0x65, 0x29, 0xA1, 0xC0, 0x81, 0x10, 0xA6, 0x49, 0x92, 0x49, 0x50, 0x95, 0xC0, 0x45, 0x29,
+0x7C, 0x78, 0xC1, 0x07, 0x42, 0xCB, 0x4A, 0x81, 0xC3, 0x45, 0x09, 0x89, 0x2A, 0x50, 0x64, 0x91,
+0x74, 0xBB, 0xC2, 0xD4, 0x94, 0x52, 0x8C, 0xB3, 0x94, 0x90, 0xC3, 0x6D, 0x63, 0x0C, 0x53, 0xE8,
+0x31, 0x45, 0x19, 0xBD, 0xC1, 0x0B, 0x8C, 0xD4, 0xEE, 0xAD, 0xC2, 0x92, 0xDE, 0x79, 0xF7, 0xFC,
+0xFF, 0x00, 0xA9, 0xCB, 0x75, 0xFF, 0x4E, 0xEE, 0x48, 0xCD, 0x2B, 0xE6, 0x8D, 0xDE, 0x26, 0x74,
+0x25, 0x23, 0x47, 0x4B, 0xD1, 0xF4, 0xA1, 0xC0, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0xAE, 0xAF,
+0xC5, 0xC7, 0xE9, 0x5A, 0xFF, 0x75, 0xCE, 0x6C, 0x7C, 0xE8, 0x63, 0x04, 0x3B, 0xBA, 0xC3, 0xEA,
+0x9C, 0x70, 0xDE, 0x91, 0xEE, 0x97, 0xFF, 0x5C, 0xC1, 0x3B, 0xE7, 0xBF, 0xF7, 0xA4, 0xDA, 0x79,
+0xFF, 0xF8, 0xFF, 0xCD, 0xD5, 0xC7, 0xB4, 0xF0, 0xF6, 0x8D, 0xBD, 0x04, 0x32, 0x8A, 0x42, 0xF3,
+0x94, 0xFF, 0xFF, 0x97, 0xB5, 0x6B, 0x4A, 0x56, 0xA5, 0xDF, 0xF7, 0xF4, 0x94, 0xCB, 0x4A, 0x4C,
+0x63, 0x98, 0xC6, 0x7B, 0xD7, 0x52, 0x85, 0x4A, 0x33, 0x87, 0x2A, 0x4B, 0x63, 0x50, 0x94, 0x68,
+0x5A, 0xA9, 0x62, 0x30, 0x94, 0x95, 0x50, 0x7C, 0xA1, 0xAE, 0xAB, 0x00, 0x95, 0xA6, 0x68, 0xAE,
+0x7C, 0x96, 0x63, 0x00, 0xAF, 0x77, 0x48, 0x59, 0xC5, 0xCE, 0x6B, 0xA5, 0x21, 0x06, 0x2A, 0x67,
+0x2A, 0x05, 0x1A, 0x47, 0x2A, 0x99, 0xC2, 0x88, 0x32, 0x07, 0x2A, 0x86, 0x21, 0xA5, 0xC3, 0xC2,
+0x10, 0x00, 0x00, 0xA1, 0x18, 0x6C, 0x73, 0x44, 0x00, 0xC0, 0xCD, 0x83, 0x9A, 0x9A, 0xC6, 0x4F,
+0x7C, 0x68, 0x32, 0x0A, 0x43, 0x68, 0x2A, 0x4A, 0x4B, 0xC5, 0x19, 0x2A, 0x4B, 0x5A, 0xC1, 0x88,
+0x3A, 0x0B, 0x4B, 0xB6, 0xC0, 0x08, 0x3A, 0xBE, 0xA6, 0x95, 0xC1, 0x86, 0x29, 0x04, 0x19, 0xA6,
+0xBE, 0xA7, 0xC0, 0x46, 0x21, 0xBE, 0x75, 0xC0, 0x25, 0x21, 0x00, 0xC1, 0xE8, 0x39, 0x6A, 0x4A,
+0x58, 0xC1, 0xEC, 0x5A, 0x2D, 0x63, 0x40, 0xA6, 0x58, 0x70, 0xAF, 0xC0, 0x05, 0x21, 0x50, 0xC0,
+0x45, 0x21, 0x82, 0xC2, 0x66, 0x19, 0xA7, 0x19, 0x08, 0x22, 0xA9, 0xC2, 0x0B, 0x43, 0x38, 0xB6,
+0xFC, 0xD6, 0xB5, 0x96, 0xD0, 0x38, 0xC6, 0x10, 0x7C, 0x28, 0x3A, 0x25, 0x19, 0x65, 0x21, 0xE5,
+0x39, 0x90, 0xBD, 0x14, 0xF7, 0x71, 0xDE, 0xD9, 0xFF, 0xFD, 0xFF, 0x9D, 0xEF, 0xFF, 0xFF, 0xBB,
+0xFF, 0xB8, 0xFF, 0x53, 0xFF, 0x49, 0xD5, 0x94, 0xC7, 0x2A, 0xDE, 0xC7, 0x94, 0x24, 0x2B, 0x27,
+0x4B, 0xD0, 0xF4, 0x81, 0xC0, 0x41, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0x9A, 0x9F, 0xCD, 0xE7, 0xE9,
+0x3A, 0xFF, 0x34, 0xC6, 0xAC, 0x84, 0xE8, 0x63, 0xE4, 0x3A, 0x82, 0x32, 0xC9, 0x9C, 0x2F, 0xDE,
+0xB2, 0xF6, 0xB8, 0xFF, 0xDC, 0xFF, 0xFF, 0xF7, 0x7D, 0xE7, 0x71, 0x4B, 0xC0, 0x36, 0xFF, 0x61,
+0xC5, 0xA8, 0xBC, 0x2E, 0xEE, 0xCF, 0xD5, 0x46, 0x42, 0xE7, 0x31, 0x14, 0x9D, 0x71, 0x4D, 0xC4,
+0x4D, 0x63, 0x5A, 0xCE, 0x5D, 0xE7, 0xEC, 0x5A, 0xC3, 0x10, 0xBF, 0xC9, 0x35, 0x9D, 0xFF, 0xEF,
+0x13, 0x8D, 0x63, 0x11, 0xC1, 0x00, 0x89, 0x52, 0x50, 0x94, 0xE7, 0x49, 0x48, 0x52, 0xEF, 0x8B,
+0x95, 0xC0, 0x0F, 0x8C, 0x00, 0xC0, 0xAE, 0x83, 0x00, 0x68, 0x77, 0x01, 0x68, 0x01, 0x74, 0x77,
+0x00, 0xA6, 0x77, 0xAF, 0xC0, 0x51, 0x8C, 0x80, 0xC1, 0x88, 0x42, 0x06, 0x2A, 0x95, 0xC4, 0xAC,
+0x5B, 0xD0, 0x7C, 0x6E, 0x6C, 0x09, 0x43, 0x88, 0x2A, 0xA1, 0xC6, 0xC5, 0x19, 0x81, 0x00, 0x20,
+0x00, 0xA1, 0x18, 0x2B, 0x73, 0xAD, 0x83, 0xEE, 0x93, 0x68, 0x6D, 0x80, 0x9F, 0xC6, 0x68, 0x3A,
+0x4B, 0x53, 0xE6, 0x21, 0xCA, 0x42, 0x48, 0x2A, 0x88, 0x32, 0xC9, 0x3A, 0x6E, 0x42, 0xC2, 0x8C,
+0x5B, 0xCE, 0x63, 0xEB, 0x4A, 0xA6, 0xC0, 0x0C, 0x53, 0x56, 0xC2, 0xE6, 0x29, 0x85, 0x21, 0xC7,
+0x29, 0x92, 0xAE, 0xC0, 0x45, 0x19, 0xBF, 0x66, 0xC6, 0xE6, 0x39, 0xF2, 0x9C, 0xFB, 0xDE, 0x14,
+0xA5, 0x7A, 0xCE, 0x1D, 0xE7, 0x5A, 0xC6, 0x90, 0xC3, 0x9A, 0xCE, 0x92, 0x8C, 0xE8, 0x39, 0x67,
+0x29, 0x6D, 0x7E, 0xC2, 0x46, 0x19, 0x86, 0x21, 0x24, 0x11, 0x5B, 0xC0, 0xBA, 0xC6, 0xBF, 0xC2,
+0xBE, 0xEF, 0xFF, 0xF7, 0xFB, 0xD6, 0xBB, 0xC0, 0xBF, 0xF7, 0x71, 0xC5, 0xBB, 0xCE, 0xAB, 0x4A,
+0xE3, 0x18, 0x09, 0x63, 0x52, 0xDE, 0xD3, 0xF6, 0xAE, 0xC1, 0xFA, 0xFF, 0xFE, 0xFF, 0x71, 0x6E,
+0x6A, 0xC0, 0x57, 0xF7, 0xBC, 0xC9, 0x0D, 0xEE, 0x07, 0xCD, 0x2A, 0xE6, 0xC6, 0x94, 0x24, 0x33,
+0x48, 0x53, 0xB0, 0xFC, 0x81, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x9A,
+0x9F, 0xC2, 0x08, 0xEA, 0x3A, 0xFF, 0x34, 0xBE, 0x7D, 0xD1, 0xE8, 0x63, 0xE4, 0x32, 0x62, 0x32,
+0xA9, 0x9C, 0x0F, 0xDE, 0x71, 0xEE, 0xB9, 0xFF, 0xFD, 0xFF, 0x7C, 0xE7, 0xDF, 0xF7, 0x7C, 0xEF,
+0x59, 0xF7, 0xB8, 0xFF, 0xB2, 0xF6, 0x68, 0xB4, 0x90, 0xFE, 0x8E, 0xD5, 0x26, 0x42, 0x83, 0xC1,
+0x30, 0x7C, 0xDF, 0xF7, 0xA9, 0xC1, 0xDA, 0xD6, 0xFF, 0xFF, 0x00, 0xCA, 0x39, 0xC6, 0xB7, 0xB5,
+0x19, 0xBE, 0xBF, 0xEF, 0x5D, 0xE7, 0xCF, 0x6B, 0xE2, 0x08, 0x81, 0x00, 0x69, 0x52, 0x71, 0x94,
+0x28, 0x52, 0x7C, 0xC0, 0xEF, 0x8B, 0x96, 0xAE, 0xA5, 0xA6, 0x68, 0x6F, 0x74, 0x00, 0x6F, 0x01,
+0x74, 0x00, 0x77, 0xA6, 0x00, 0x77, 0x43, 0xC2, 0x51, 0x94, 0xCF, 0x7B, 0xE6, 0x31, 0x95, 0xC1,
+0x47, 0x32, 0x6A, 0x53, 0x00, 0xCA, 0x0D, 0x64, 0xF0, 0x7C, 0x4E, 0x5C, 0xCC, 0x53, 0x0A, 0x43,
+0x63, 0x19, 0x60, 0x08, 0x64, 0x31, 0xB1, 0xA4, 0xD6, 0xCD, 0x74, 0xBD, 0xAE, 0x9A, 0x81, 0x81,
+0xC1, 0x68, 0x3A, 0xEA, 0x4A, 0xAF, 0xC1, 0x07, 0x2A, 0xEB, 0x42, 0xA9, 0xC2, 0x47, 0x2A, 0x87,
+0x32, 0xC8, 0x3A, 0x5A, 0xC1, 0xA5, 0x19, 0xE7, 0x21, 0xA6, 0xA5, 0xC0, 0x48, 0x32, 0x51, 0x64,
+0x77, 0x43, 0xA1, 0x00, 0xA5, 0xC6, 0x48, 0x42, 0xCA, 0x5A, 0x53, 0xAD, 0x9D, 0xF7, 0xB2, 0x9C,
+0x09, 0x42, 0x6A, 0x4A, 0x95, 0xC3, 0xEB, 0x5A, 0x17, 0xBE, 0xBA, 0xD6, 0xAF, 0x73, 0x67, 0xC2,
+0xC8, 0x29, 0x09, 0x2A, 0x86, 0x19, 0x91, 0xBE, 0xC3, 0x71, 0x84, 0xBE, 0xEF, 0x38, 0xBE, 0x6D,
+0x63, 0x00, 0xC0, 0x10, 0x7C, 0x56, 0xC7, 0xAF, 0x6B, 0x76, 0xA5, 0x9F, 0xEF, 0x55, 0xA5, 0x64,
+0x29, 0xE4, 0x41, 0x4E, 0xC5, 0x13, 0xFF, 0xAB, 0xC1, 0xB9, 0xFF, 0xDD, 0xFF, 0x69, 0x00, 0xA8,
+0xC0, 0x78, 0xF7, 0xBC, 0xC9, 0xAC, 0xDD, 0xA6, 0xC4, 0x0A, 0xE6, 0x07, 0xA5, 0x04, 0x2B, 0x27,
+0x53, 0x90, 0xFC, 0x81, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x9E, 0x9B,
+0xC9, 0x08, 0xEA, 0x3A, 0xFF, 0x34, 0xBE, 0x8C, 0x84, 0xE8, 0x63, 0xE4, 0x32, 0x41, 0x2A, 0xAA,
+0x9C, 0x50, 0xE6, 0x72, 0xF6, 0x7D, 0xC0, 0xFD, 0xFF, 0x92, 0x00, 0xA1, 0xC0, 0x59, 0xFF, 0xAC,
+0xC4, 0x8D, 0xD5, 0x26, 0xAC, 0xB1, 0xFE, 0xCC, 0xB4, 0xC4, 0x31, 0x72, 0xAE, 0xC4, 0x10, 0x74,
+0xF7, 0xB5, 0x58, 0xBE, 0x3C, 0xE7, 0xDF, 0xF7, 0xBE, 0x00, 0xC4, 0x9F, 0xEF, 0x5A, 0xC6, 0x31,
+0x7C, 0x08, 0x32, 0x23, 0x11, 0xBA, 0xC3, 0xE7, 0x41, 0x0F, 0x8C, 0x48, 0x52, 0x89, 0x5A, 0x7C,
+0xA6, 0x00, 0xC1, 0x8D, 0x7B, 0xCE, 0x83, 0x00, 0x77, 0x00, 0x68, 0x01, 0x77, 0x7C, 0x77, 0xA6,
+0x96, 0xBA, 0x72, 0xC1, 0x31, 0x94, 0x71, 0x94, 0x85, 0xC0, 0xC6, 0x31, 0x85, 0xCB, 0x26, 0x2A,
+0x67, 0x32, 0xE5, 0x21, 0x09, 0x43, 0xD0, 0x74, 0x32, 0x7D, 0x8F, 0x6C, 0xAC, 0x5B, 0x06, 0x32,
+0xE1, 0x18, 0x68, 0x5A, 0x57, 0xDE, 0x5E, 0x00, 0x63, 0x00, 0x56, 0xC1, 0xD9, 0xCE, 0xA9, 0x42,
+0x4C, 0xC0, 0x0A, 0x4B, 0xA7, 0xC2, 0x89, 0x3A, 0x0B, 0x43, 0x6B, 0x53, 0x7B, 0x00, 0xBF, 0x4E,
+0xC1, 0xC6, 0x21, 0x28, 0x32, 0x90, 0x00, 0xC4, 0xEA, 0x4A, 0x2B, 0x53, 0x69, 0x3A, 0xA7, 0x21,
+0xE7, 0x31, 0xA6, 0xC4, 0xE3, 0x18, 0x89, 0x52, 0x0A, 0x63, 0xF2, 0xA4, 0x9D, 0xFF, 0x77, 0xC1,
+0x04, 0x21, 0x66, 0x31, 0x99, 0xC6, 0xC6, 0x39, 0xB5, 0xB5, 0xDE, 0xFF, 0x91, 0x94, 0x28, 0x42,
+0x66, 0x21, 0xC8, 0x21, 0x7E, 0x91, 0xBE, 0xC8, 0xF3, 0x8C, 0xDF, 0xEF, 0xB6, 0xAD, 0x69, 0x42,
+0xCA, 0x4A, 0xF3, 0x94, 0x34, 0x9D, 0xCB, 0x52, 0x14, 0x95, 0x71, 0xC8, 0xB7, 0xAD, 0x64, 0x21,
+0x61, 0x31, 0xAB, 0xAC, 0xF3, 0xFE, 0x34, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0x00, 0xC1,
+0xBB, 0xF7, 0xB8, 0xFF, 0x46, 0xC0, 0x4A, 0xD5, 0xA4, 0xC7, 0x2B, 0xE6, 0xC7, 0x94, 0xE3, 0x2A,
+0x07, 0x53, 0x90, 0xFC, 0x81, 0xC8, 0x20, 0xE8, 0x20, 0xF8, 0xA6, 0x62, 0x5D, 0xE0, 0x0E, 0x62,
+0x00, 0x8B, 0xCC, 0x08, 0xEA, 0x3A, 0xFF, 0x34, 0xBE, 0x8C, 0x84, 0xE8, 0x5B, 0xE5, 0x32, 0x41,
+0x22, 0x08, 0x84, 0x30, 0xDE, 0xD3, 0xFE, 0x57, 0xFF, 0xBA, 0xFF, 0xFC, 0xFF, 0xA2, 0x5C, 0xCA,
+0xB8, 0xFF, 0xB3, 0xF6, 0x4C, 0xCD, 0xAC, 0xD5, 0xF2, 0xFE, 0xA8, 0x8B, 0x63, 0x21, 0xE7, 0x29,
+0x24, 0x11, 0x85, 0x21, 0x68, 0x3A, 0xBB, 0xC2, 0x6D, 0x63, 0xB2, 0x8C, 0x51, 0x84, 0x91, 0xC2,
+0x8E, 0x6B, 0x6A, 0x42, 0x66, 0x21, 0xA9, 0x00, 0xC5, 0xE2, 0x10, 0x03, 0x21, 0x2C, 0x73, 0x07,
+0x4A, 0x48, 0x52, 0x0F, 0x8C, 0x01, 0xC1, 0x8D, 0x7B, 0xCE, 0x83, 0xBF, 0x7C, 0x00, 0x77, 0x9A,
+0x77, 0x7C, 0xBF, 0x7C, 0xA2, 0x95, 0xAB, 0x72, 0xC1, 0x31, 0x94, 0x71, 0x94, 0x9A, 0xC0, 0x27,
+0x3A, 0x81, 0xC4, 0x26, 0x2A, 0x0A, 0x4B, 0x8C, 0x53, 0x8F, 0x74, 0x32, 0x85, 0x96, 0xC8, 0x90,
+0x74, 0x2E, 0x6C, 0x88, 0x42, 0xC1, 0x18, 0x27, 0x52, 0x94, 0xC5, 0xF9, 0xEE, 0x3B, 0xFF, 0x7B,
+0xFF, 0x9A, 0xC3, 0xBC, 0xF7, 0xB8, 0xCE, 0xC9, 0x4A, 0x84, 0x19, 0x44, 0xC1, 0x4C, 0x53, 0x89,
+0x3A, 0xAE, 0xC1, 0x2B, 0x4B, 0xA8, 0x3A, 0x91, 0xC2, 0xC9, 0x42, 0x0A, 0x4B, 0x07, 0x2A, 0xBA,
+0x00, 0x44, 0xA9, 0xC2, 0xCA, 0x4A, 0x2C, 0x53, 0x49, 0x3A, 0xA1, 0xCF, 0xA6, 0x31, 0xC3, 0x18,
+0x89, 0x52, 0x0B, 0x6B, 0xD2, 0xA4, 0x5C, 0xFF, 0xEF, 0x8B, 0xA3, 0x20, 0x45, 0x29, 0xE3, 0x20,
+0x64, 0x31, 0xB5, 0xBD, 0xFE, 0xFF, 0xB1, 0x9C, 0x85, 0x31, 0xA7, 0x21, 0x00, 0xAE, 0x7E, 0x95,
+0xC1, 0x10, 0x74, 0x7D, 0xDF, 0x00, 0xC3, 0xDA, 0xCE, 0x3C, 0xD7, 0xBE, 0xEF, 0xF7, 0xB5, 0x46,
+0xC9, 0x18, 0xB6, 0xFF, 0xFF, 0x13, 0x95, 0x64, 0x21, 0x41, 0x29, 0xE9, 0x93, 0x51, 0xEE, 0x13,
+0xFF, 0xB6, 0xFF, 0xFB, 0xFF, 0xAB, 0x00, 0xA4, 0xCB, 0xB7, 0xFF, 0x90, 0xEE, 0x6A, 0xDD, 0x4D,
+0xF6, 0x2C, 0xD6, 0xE4, 0x6B, 0xE3, 0x22, 0x07, 0x53, 0x90, 0xFC, 0x82, 0xC8, 0x20, 0xE8, 0x20,
+0xF8, 0xA6, 0xE0, 0x10, 0x62, 0x00, 0x8F, 0xCD, 0x08, 0xEA, 0x5A, 0xFF, 0x34, 0xBE, 0x8C, 0x84,
+0xE8, 0x5B, 0xE5, 0x2A, 0x22, 0x1A, 0x04, 0x53, 0xEB, 0xAC, 0x91, 0xEE, 0x34, 0xFF, 0x36, 0xFF,
+0x98, 0xFF, 0xD9, 0xFF, 0xA9, 0x46, 0xC0, 0x4F, 0xE6, 0x00, 0xC2, 0xF2, 0xF6, 0x8D, 0xC5, 0xE2,
+0x41, 0x58, 0xC0, 0x28, 0x2A, 0xA5, 0x91, 0xA5, 0xC3, 0x44, 0x19, 0xA5, 0x29, 0x48, 0x3A, 0xC7,
+0x31, 0x81, 0xA6, 0x91, 0x00, 0xC0, 0xC6, 0x29, 0x96, 0xC5, 0x60, 0x00, 0x61, 0x10, 0x69, 0x5A,
+0xA6, 0x41, 0x27, 0x4A, 0xEF, 0x8B, 0xAE, 0x77, 0xC0, 0x6D, 0x7B, 0x63, 0xC1, 0xEE, 0x8B, 0x2F,
+0x8C, 0xBF, 0xA6, 0x7C, 0x01, 0x4B, 0x77, 0xA6, 0x63, 0xBB, 0xC2, 0xF0, 0x8B, 0x31, 0x94, 0x72,
+0x94, 0x9E, 0xC1, 0x49, 0x3A, 0xA6, 0x21, 0x80, 0xC1, 0x27, 0x2A, 0xA8, 0x32, 0xBF, 0xC0, 0x26,
+0x22, 0x73, 0x76, 0xC5, 0x0A, 0x4B, 0x26, 0x3A, 0xE1, 0x18, 0x67, 0x52, 0x11, 0xAD, 0x56, 0xDE,
+0xAF, 0xAE, 0x9B, 0x99, 0xC2, 0x32, 0x9D, 0xEA, 0x52, 0xE6, 0x29, 0xA6, 0x00, 0xC0, 0x8D, 0x5B,
+0x59, 0xC0, 0x26, 0x2A, 0x45, 0x95, 0xC0, 0x06, 0x2A, 0x45, 0xBF, 0x44, 0xA5, 0x5B, 0x90, 0x44,
+0xC3, 0xCA, 0x4A, 0x4D, 0x5B, 0x28, 0x3A, 0x66, 0x29, 0x64, 0xCD, 0x49, 0x52, 0xCA, 0x62, 0x71,
+0x9C, 0xF7, 0xCD, 0xAE, 0x7B, 0x04, 0x29, 0xC7, 0x39, 0x65, 0x31, 0x06, 0x42, 0x53, 0xA5, 0xD9,
+0xDE, 0x6F, 0x8C, 0xA5, 0x31, 0x08, 0x32, 0x9A, 0xA6, 0x95, 0x91, 0xCA, 0xAA, 0x42, 0xD3, 0x84,
+0xB6, 0xA5, 0xFB, 0xCE, 0xDE, 0xE7, 0x99, 0xC6, 0x8D, 0x63, 0x49, 0x3A, 0x71, 0x7C, 0x55, 0x9D,
+0xEB, 0x4A, 0x44, 0xC3, 0x22, 0x19, 0x44, 0x5A, 0xEC, 0xBC, 0xD2, 0xF6, 0x46, 0x9B, 0xC1, 0xF9,
+0xFF, 0x99, 0xFF, 0xA8, 0xA8, 0xCA, 0x90, 0xF6, 0x2D, 0xEE, 0x8E, 0xEE, 0x29, 0xA5, 0x23, 0x4B,
+0xE4, 0x22, 0x07, 0x53, 0x90, 0xFC, 0xA2, 0xC8, 0x20, 0xE8, 0x20, 0xF8, 0x5D, 0xE0, 0x10, 0x62,
+0x00, 0x68, 0xC0, 0x08, 0xEA, 0x75, 0xCA, 0x34, 0xC6, 0xAC, 0x84, 0x09, 0x5C, 0x26, 0x2B, 0x64,
+0x1A, 0x01, 0x2A, 0x25, 0x6B, 0x6D, 0xC5, 0xD2, 0xFE, 0x54, 0xFF, 0x96, 0xFF, 0x00, 0xAD, 0xA1,
+0xC5, 0x12, 0xFF, 0x90, 0xEE, 0x8D, 0xC5, 0xE4, 0x62, 0x41, 0x29, 0xE6, 0x29, 0x43, 0x99, 0xBA,
+0x44, 0xAE, 0xBA, 0x44, 0xC0, 0x28, 0x32, 0xA1, 0xAB, 0x00, 0x90, 0xAF, 0x7A, 0xC5, 0x03, 0x19,
+0xA1, 0x18, 0x27, 0x52, 0x85, 0x39, 0x07, 0x4A, 0xEE, 0x8B, 0xAB, 0x95, 0xC1, 0x4C, 0x73, 0xAD,
+0x7B, 0x68, 0xC0, 0x0F, 0x8C, 0xBF, 0xAE, 0x00, 0x7C, 0x77, 0x7C, 0x77, 0xA6, 0xA6, 0x72, 0xC0,
+0x10, 0x94, 0xAF, 0xAE, 0xC1, 0x10, 0x7C, 0xC7, 0x29, 0x95, 0xAE, 0xC0, 0x27, 0x2A, 0x9A, 0xBE,
+0x91, 0x00, 0xC0, 0xA5, 0x19, 0xBA, 0xA0, 0xC5, 0x02, 0x19, 0x88, 0x52, 0xAC, 0x83, 0x2E, 0x94,
+0x6F, 0x94, 0xB0, 0x9C, 0x9E, 0xC1, 0x2F, 0x84, 0x88, 0x4A, 0x4C, 0xC0, 0x47, 0x3A, 0xAB, 0x70,
+0xC1, 0xA9, 0x42, 0x4C, 0x53, 0x54, 0x81, 0xC0, 0xE9, 0x42, 0x00, 0xC1, 0x67, 0x32, 0x2B, 0x53,
+0x54, 0x60, 0x4C, 0x60, 0x44, 0xAB, 0xC0, 0xCB, 0x4A, 0xBA, 0xC0, 0x08, 0x3A, 0xA1, 0xC0, 0x45,
+0x29, 0x90, 0xC5, 0x28, 0x4A, 0x89, 0x5A, 0xA6, 0x39, 0x49, 0x52, 0xAB, 0x5A, 0xE7, 0x39, 0x95,
+0xC1, 0x4B, 0x63, 0x2E, 0x84, 0x73, 0xC0, 0x07, 0x3A, 0x82, 0xC0, 0x08, 0x2A, 0x00, 0xC0, 0xA7,
+0x21, 0x43, 0xC0, 0x49, 0x32, 0xA9, 0x4B, 0xC3, 0x68, 0x3A, 0x0F, 0x6C, 0x6D, 0x5B, 0xA5, 0x21,
+0x91, 0xC0, 0x07, 0x32, 0x91, 0xC2, 0x24, 0x11, 0x07, 0x22, 0x43, 0x19, 0x48, 0xC4, 0x06, 0x7B,
+0xAF, 0xCD, 0x13, 0xFF, 0x55, 0xFF, 0xB7, 0xFF, 0xAF, 0x6A, 0xA8, 0xCA, 0x32, 0xFF, 0x8F, 0xEE,
+0x4A, 0xB5, 0xA5, 0x63, 0x04, 0x33, 0x26, 0x23, 0x28, 0x53, 0xB0, 0xFC, 0xA2, 0xC8, 0x20, 0xE8,
+0x20, 0xF8, 0xA6, 0xE0, 0x10, 0x62, 0x9A, 0x9B, 0xC0, 0x08, 0xEA, 0x75, 0xCA, 0x54, 0xC6, 0xAC,
+0x84, 0x09, 0x5C, 0x47, 0x23, 0xC5, 0x1A, 0x02, 0x1A, 0x22, 0x3A, 0x86, 0x7B, 0xEB, 0xB4, 0x2F,
+0xDE, 0xD1, 0xEE, 0xAF, 0xC0, 0x74, 0xF7, 0xA0, 0xC5, 0x90, 0xE6, 0xEB, 0xAC, 0x46, 0x73, 0xA2,
+0x31, 0xE5, 0x31, 0x07, 0x22, 0x95, 0x79, 0xBE, 0xBE, 0x01, 0x64, 0xA1, 0x91, 0xAB, 0xBE, 0x00,
+0x91, 0x91, 0xA1, 0xB9, 0xC1, 0x27, 0x4A, 0x85, 0x39, 0x61, 0xC0, 0x0F, 0x8C, 0x00, 0x91, 0x91,
+0x00, 0xAE, 0x68, 0x7C, 0xC0, 0x4F, 0x94, 0xAB, 0x95, 0xA1, 0xA6, 0x00, 0xAB, 0x00, 0xC0, 0x10,
+0x94, 0xAF, 0xAE, 0x9A, 0x96, 0x4E, 0x4B, 0xAE, 0xAF, 0x91, 0xC0, 0x68, 0x32, 0x64, 0x9A, 0xC1,
+0xE6, 0x21, 0x85, 0x21, 0xA9, 0xC1, 0xE6, 0x39, 0x8C, 0x73, 0xBA, 0xC2, 0xCC, 0x7B, 0x2E, 0x8C,
+0x6E, 0x8C, 0xAB, 0xC1, 0xCD, 0x73, 0xC5, 0x29, 0xA6, 0x53, 0xC0, 0x48, 0x3A, 0xAF, 0xC0, 0x85,
+0x19, 0x73, 0xC1, 0x6C, 0x5B, 0x88, 0x3A, 0x69, 0xC1, 0xEA, 0x42, 0x67, 0x32, 0x60, 0xC1, 0xEA,
+0x52, 0x88, 0x42, 0x78, 0xAE, 0xAB, 0x6B, 0xAF, 0xC0, 0xAA, 0x4A, 0x00, 0xA6, 0xC1, 0x85, 0x29,
+0xE3, 0x18, 0x00, 0x91, 0xAB, 0xC2, 0xC7, 0x31, 0x66, 0x29, 0xE3, 0x10, 0x90, 0x6E, 0xC0, 0xA9,
+0x4A, 0x91, 0x53, 0x92, 0xAF, 0x00, 0xC2, 0x66, 0x19, 0xC7, 0x21, 0xCB, 0x42, 0x90, 0x77, 0xC1,
+0x44, 0x11, 0x27, 0x2A, 0x71, 0xC1, 0x06, 0x2A, 0xA5, 0x21, 0x68, 0x00, 0x48, 0x96, 0xA5, 0xC4,
+0x63, 0x29, 0xC3, 0x41, 0x47, 0x7B, 0x6E, 0xC5, 0xD3, 0xEE, 0x00, 0xC0, 0x15, 0xF7, 0xA1, 0xC2,
+0x91, 0xEE, 0x0E, 0xD6, 0x0A, 0xA5, 0x58, 0xC1, 0xE4, 0x32, 0x47, 0x2B, 0x9E, 0xC3, 0x48, 0x5B,
+0xB1, 0xFC, 0xA2, 0xC8, 0x20, 0xE8, 0x5D, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x9E, 0x9B, 0xD2, 0x08,
+0xEA, 0x5A, 0xFF, 0x54, 0xC6, 0xCC, 0x8C, 0x2A, 0x5C, 0x27, 0x23, 0xC6, 0x12, 0x65, 0x22, 0x43,
+0x32, 0xE1, 0x39, 0x42, 0x52, 0xC7, 0x83, 0x0B, 0xAD, 0xAE, 0xB5, 0xEF, 0xC5, 0xCA, 0x9C, 0xA7,
+0x7B, 0x22, 0x4A, 0xC3, 0x39, 0x64, 0xC0, 0xC6, 0x21, 0x81, 0xC1, 0x07, 0x22, 0x48, 0x2A, 0x95,
+0xB9, 0x00, 0x51, 0xC3, 0xB1, 0x7C, 0xAD, 0x63, 0xAA, 0x42, 0xC7, 0x29, 0x95, 0xC0, 0xE7, 0x31,
+0x7F, 0xC6, 0x44, 0x19, 0xC2, 0x10, 0x65, 0x31, 0x27, 0x4A, 0x85, 0x39, 0x47, 0x52, 0x50, 0x94,
+0xA5, 0x96, 0x95, 0xC0, 0x8D, 0x7B, 0xA5, 0x54, 0xC1, 0xCE, 0x83, 0x2F, 0x8C, 0xBE, 0x7C, 0x6D,
+0xA2, 0x00, 0xBF, 0xAE, 0xC0, 0x31, 0x94, 0xAE, 0xAB, 0x99, 0xC1, 0xB3, 0x8C, 0x69, 0x3A, 0x91,
+0x91, 0xAE, 0xAF, 0x78, 0x5C, 0x91, 0xC0, 0x48, 0x32, 0xA1, 0x6B, 0xC6, 0x23, 0x21, 0x26, 0x42,
+0xC5, 0x39, 0x67, 0x4A, 0x0A, 0x63, 0x6B, 0x63, 0xCD, 0x6B, 0x00, 0x53, 0x95, 0x7F, 0x53, 0x73,
+0x47, 0x4B, 0x5F, 0xC1, 0x8C, 0x5B, 0xC9, 0x42, 0x44, 0xC1, 0x4B, 0x53, 0x88, 0x3A, 0xBA, 0xC0,
+0x0A, 0x53, 0x95, 0xC0, 0xE6, 0x31, 0x91, 0x53, 0x4B, 0xC2, 0x44, 0x19, 0xCA, 0x4A, 0x8D, 0x63,
+0x91, 0xC3, 0xEB, 0x52, 0x48, 0x42, 0xA6, 0x29, 0xE7, 0x31, 0x92, 0x46, 0xC1, 0x8A, 0x42, 0x08,
+0x32, 0x53, 0xC0, 0xA9, 0x42, 0x50, 0x00, 0xA6, 0x92, 0x5F, 0x43, 0x91, 0xC0, 0x49, 0x32, 0x64,
+0xC0, 0xC6, 0x21, 0xAE, 0x95, 0xC2, 0xA9, 0x3A, 0x0A, 0x4B, 0x47, 0x32, 0x44, 0x00, 0x48, 0x96,
+0x00, 0xC6, 0xC6, 0x31, 0x63, 0x31, 0xE0, 0x28, 0x84, 0x62, 0xED, 0xAC, 0xB0, 0xC5, 0x4F, 0xBD,
+0x00, 0xC5, 0xAB, 0xA4, 0xA6, 0x7B, 0xC2, 0x4A, 0xA2, 0x2A, 0x27, 0x23, 0x89, 0x23, 0xA9, 0xC4,
+0x68, 0x5B, 0xD1, 0xFC, 0xA2, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0E, 0x62,
+0x96, 0x9F, 0xC0, 0x08, 0xEA, 0x75, 0xC3, 0x34, 0xBE, 0xAC, 0x84, 0x6A, 0x64, 0x47, 0x23, 0x82,
+0xC0, 0xA7, 0x22, 0xB1, 0xC1, 0xE4, 0x31, 0x82, 0x29, 0xB9, 0xC1, 0xC2, 0x39, 0x43, 0x42, 0x96,
+0xA1, 0x92, 0xA7, 0x9B, 0xC0, 0xA6, 0x21, 0x43, 0xAF, 0x48, 0xC0, 0x48, 0x2A, 0xA9, 0xC0, 0xA4,
+0x11, 0x5A, 0xC0, 0xED, 0x63, 0x00, 0xC1, 0x4F, 0x74, 0x2B, 0x53, 0x53, 0x91, 0x4E, 0x00, 0xC8,
+0x85, 0x21, 0x24, 0x19, 0xAA, 0x5A, 0x27, 0x4A, 0xA5, 0x39, 0x89, 0x5A, 0x0F, 0x8C, 0x50, 0x94,
+0xCE, 0x83, 0xBF, 0x68, 0x06, 0xAE, 0x77, 0xBF, 0xC0, 0x51, 0x94, 0xBA, 0x57, 0xAB, 0x9E, 0xAE,
+0xC2, 0x69, 0x42, 0xC7, 0x29, 0x69, 0x3A, 0x81, 0x43, 0x4B, 0xAF, 0x5C, 0xA5, 0xC0, 0x86, 0x21,
+0x7F, 0xC0, 0x44, 0x21, 0x90, 0xBE, 0xC1, 0x63, 0x21, 0x88, 0x4A, 0x74, 0xC0, 0x06, 0x32, 0x91,
+0xC2, 0x89, 0x3A, 0xC6, 0x29, 0x28, 0x32, 0x00, 0x4B, 0x5F, 0x00, 0x50, 0x78, 0xC8, 0x4C, 0x53,
+0x8D, 0x5B, 0xC6, 0x21, 0xCA, 0x42, 0x68, 0x3A, 0xE6, 0x29, 0x89, 0x42, 0xCA, 0x4A, 0x64, 0x21,
+0x53, 0xC0, 0xA5, 0x29, 0x00, 0x99, 0xA6, 0x5F, 0x91, 0xA6, 0x52, 0x5A, 0x4B, 0xC0, 0xA6, 0x29,
+0x00, 0x6B, 0xC0, 0x24, 0x11, 0x50, 0xC1, 0xA6, 0x19, 0xE7, 0x29, 0x01, 0x7C, 0x4B, 0x50, 0x4C,
+0xC0, 0xE7, 0x21, 0x41, 0x95, 0xA6, 0xC0, 0xE5, 0x21, 0x45, 0x71, 0xC1, 0xC5, 0x21, 0x06, 0x2A,
+0x7C, 0xC0, 0xE8, 0x21, 0x95, 0x7E, 0xC0, 0xC6, 0x31, 0xB8, 0xA5, 0xC1, 0xE3, 0x41, 0x65, 0x52,
+0xAB, 0xAE, 0x94, 0x84, 0x8E, 0xC2, 0x05, 0x23, 0x89, 0x23, 0xCA, 0x23, 0xB9, 0xC3, 0x89, 0x63,
+0x90, 0xFC, 0xA2, 0xC8, 0x40, 0xF0, 0x5D, 0x00, 0x9A, 0x5D, 0xE0, 0x0E, 0x62, 0x5A, 0x9F, 0xC5,
+0x28, 0xEA, 0x5A, 0xFF, 0x34, 0xC6, 0xCD, 0x8C, 0x6A, 0x64, 0xA8, 0x33, 0x82, 0xC2, 0xE7, 0x1A,
+0x67, 0x22, 0xE6, 0x21, 0xA1, 0xBE, 0xC1, 0x05, 0x32, 0xA4, 0x19, 0x69, 0x00, 0xBA, 0x73, 0xAB,
+0xC0, 0xC8, 0x21, 0x4F, 0x48, 0xC0, 0x48, 0x2A, 0x00, 0xA9, 0x95, 0xC0, 0xA8, 0x3A, 0x00, 0xC3,
+0x01, 0x01, 0x2F, 0x6C, 0x2B, 0x53, 0x27, 0x32, 0x7F, 0xAF, 0xA6, 0x7A, 0xA1, 0xC5, 0x8D, 0x73,
+0x48, 0x52, 0x23, 0x29, 0xE6, 0x41, 0xCE, 0x83, 0x91, 0x9C, 0x81, 0xA1, 0xAE, 0x00, 0xAB, 0x41,
+0x04, 0xBF, 0x00, 0xAB, 0xBE, 0x9B, 0x00, 0x9A, 0xC2, 0x55, 0xA5, 0xAA, 0x42, 0x65, 0x19, 0x4B,
+0x95, 0xC1, 0x28, 0x32, 0xCA, 0x4A, 0x4B, 0x5F, 0x96, 0x7F, 0x91, 0xA5, 0x73, 0xC2, 0x23, 0x19,
+0xC1, 0x08, 0xE9, 0x52, 0x9A, 0xAB, 0xC0, 0x85, 0x19, 0x6B, 0xC0, 0xE7, 0x29, 0xBF, 0xC0, 0xA6,
+0x21, 0x00, 0x46, 0x53, 0xAF, 0x57, 0xA9, 0xC0, 0xEB, 0x4A, 0x99, 0xC1, 0xE6, 0x21, 0x0A, 0x43,
+0xA2, 0x7C, 0xC2, 0xA9, 0x42, 0xAD, 0x6B, 0x4F, 0x84, 0x00, 0xC0, 0xB0, 0x8C, 0x99, 0xA6, 0xA6,
+0x95, 0x92, 0x91, 0xA1, 0xC1, 0x2B, 0x5B, 0xC9, 0x4A, 0xA6, 0x92, 0x63, 0x7C, 0x74, 0x41, 0xC0,
+0x85, 0x21, 0x44, 0x77, 0x7C, 0x4B, 0xC1, 0x4C, 0x53, 0xC9, 0x3A, 0xAB, 0xC0, 0x68, 0x32, 0xAE,
+0x41, 0x69, 0xC2, 0x2B, 0x53, 0x68, 0x3A, 0x06, 0x2A, 0xBF, 0xC0, 0xC7, 0x21, 0x00, 0x7E, 0x77,
+0x6B, 0xB9, 0x00, 0xAE, 0xBF, 0xAE, 0x99, 0x88, 0xC2, 0x42, 0x12, 0xC5, 0x12, 0x68, 0x13, 0xBF,
+0xC4, 0xE9, 0x2B, 0xAA, 0x63, 0x90, 0xFC, 0x82, 0xC8, 0x20, 0xE8, 0x5D, 0x00, 0x9A, 0x5D, 0xE0,
+0x0E, 0xAE, 0x5A, 0x9F, 0xC9, 0x28, 0xF2, 0x7B, 0xFF, 0x54, 0xC6, 0xCD, 0x8C, 0x6A, 0x6C, 0xC7,
+0x3B, 0x87, 0x23, 0xE7, 0x1A, 0x26, 0x12, 0xC6, 0x11, 0xBA, 0xAF, 0xBA, 0xAE, 0x00, 0x4B, 0x00,
+0xB6, 0x46, 0x00, 0x9F, 0xAE, 0xC0, 0x69, 0x32, 0x90, 0x00, 0xA9, 0xC1, 0x87, 0x32, 0x6B, 0x53,
+0xAE, 0x72, 0xC0, 0xA9, 0x42, 0x50, 0x44, 0x4B, 0x46, 0x7A, 0x00, 0xC5, 0xCE, 0x7B, 0x48, 0x4A,
+0x03, 0x21, 0x85, 0x31, 0x0B, 0x63, 0xEE, 0x83, 0x65, 0xA1, 0xC0, 0xCE, 0x83, 0xAF, 0xC0, 0x30,
+0x8C, 0xA5, 0x9A, 0x6D, 0x74, 0x79, 0x74, 0x6D, 0xA7, 0x02, 0x9E, 0x00, 0xC1, 0x71, 0x84, 0x2C,
+0x53, 0x46, 0xC0, 0x48, 0x3A, 0x00, 0x6B, 0x7F, 0x00, 0xC0, 0x28, 0x3A, 0x95, 0x00, 0xC0, 0x44,
+0x19, 0xA5, 0x6B, 0x57, 0xC4, 0x84, 0x21, 0x02, 0x09, 0x43, 0x11, 0x2B, 0x4B, 0xC9, 0x42, 0x44,
+0x01, 0x7A, 0x53, 0xA6, 0x00, 0x7F, 0x92, 0x57, 0xC1, 0xA9, 0x3A, 0x4C, 0x53, 0x7D, 0xC0, 0x48,
+0x2A, 0x51, 0xC3, 0x68, 0x32, 0x89, 0x42, 0x16, 0xBE, 0xFD, 0xFF, 0xA5, 0x63, 0x00, 0xA9, 0x00,
+0x63, 0x00, 0x95, 0x95, 0xC4, 0xD8, 0xD6, 0x56, 0xC6, 0x1A, 0xDF, 0xB9, 0xCE, 0xEB, 0x52, 0x6B,
+0x9A, 0x53, 0x7B, 0xC1, 0x6C, 0x63, 0xEA, 0x4A, 0x58, 0x68, 0xC1, 0xCA, 0x42, 0x47, 0x2A, 0x61,
+0x7D, 0x69, 0xC0, 0xE6, 0x21, 0x55, 0xC0, 0x88, 0x3A, 0x00, 0xA6, 0xC0, 0xA5, 0x21, 0xAB, 0xC0,
+0xE7, 0x29, 0xAF, 0xA6, 0xA1, 0x7E, 0xAE, 0xA9, 0x9A, 0xBE, 0x99, 0x99, 0xC8, 0x44, 0x0A, 0x06,
+0x13, 0x89, 0x1B, 0xCA, 0x23, 0x0A, 0x34, 0xCA, 0x6B, 0xB0, 0xFC, 0x82, 0xC8, 0x20, 0xE8, 0x5D,
+0xE0, 0x12, 0x9A, 0xC6, 0x41, 0xE8, 0x28, 0xF2, 0x7B, 0xFF, 0x54, 0xC6, 0xCD, 0x8C, 0x8A, 0x6C,
+0xE8, 0x3B, 0x86, 0xC2, 0x27, 0x23, 0x66, 0x12, 0xE6, 0x11, 0xAB, 0xBA, 0x76, 0xC0, 0x07, 0x1A,
+0x00, 0xB2, 0xA5, 0xBB, 0xAE, 0x52, 0x57, 0x95, 0xC0, 0x49, 0x32, 0xA5, 0xAE, 0x90, 0xC3, 0x83,
+0x11, 0x66, 0x2A, 0x8B, 0x53, 0x47, 0x32, 0x49, 0x7C, 0x4B, 0x53, 0x4B, 0xA1, 0x00, 0xC2, 0xE7,
+0x39, 0x24, 0x21, 0xC2, 0x18, 0xAF, 0xC2, 0x24, 0x29, 0x65, 0x31, 0xA6, 0x31, 0xA9, 0xC1, 0x07,
+0x42, 0x48, 0x4A, 0xBF, 0x00, 0x6D, 0x96, 0x00, 0x6D, 0x76, 0xA6, 0x6C, 0xA6, 0x00, 0x9E, 0xBF,
+0x7A, 0xC0, 0xAA, 0x4A, 0x00, 0x7A, 0xAE, 0xBF, 0xC2, 0x27, 0x3A, 0x2B, 0x5B, 0xA9, 0x52, 0x9F,
+0xC0, 0x68, 0x42, 0x6A, 0x6F, 0x5B, 0xC0, 0x23, 0x19, 0x95, 0x70, 0x95, 0x00, 0xC0, 0x88, 0x3A,
+0x5D, 0xC3, 0x84, 0x21, 0x89, 0x42, 0x6C, 0x63, 0xA9, 0x4A, 0x6A, 0xC0, 0xEA, 0x52, 0xA6, 0x6A,
+0x91, 0xC1, 0x85, 0x21, 0xE7, 0x29, 0x81, 0xC3, 0x4C, 0x4B, 0x07, 0x22, 0x68, 0x2A, 0xEB, 0x42,
+0x64, 0xC4, 0xE9, 0x5A, 0xCF, 0xA4, 0x51, 0xB5, 0x34, 0xCE, 0x75, 0xCE, 0xA6, 0x96, 0xC1, 0x76,
+0xCE, 0xB7, 0xD6, 0x00, 0xBE, 0xC2, 0xB2, 0xB5, 0x10, 0xA5, 0x97, 0xD6, 0xAF, 0xCA, 0x89, 0x4A,
+0x24, 0x19, 0x07, 0x32, 0x4C, 0x5B, 0xD1, 0x94, 0x36, 0xBE, 0x94, 0xA5, 0xCD, 0x6B, 0xE6, 0x29,
+0xA9, 0x3A, 0xC5, 0x21, 0xAF, 0xC1, 0xEA, 0x42, 0x89, 0x32, 0x90, 0xC0, 0xC5, 0x21, 0x70, 0x7B,
+0xC2, 0x2B, 0x53, 0x47, 0x3A, 0xC5, 0x29, 0x44, 0xC0, 0x28, 0x2A, 0x00, 0xA2, 0xC0, 0x87, 0x19,
+0xAE, 0x45, 0x91, 0xAE, 0xA9, 0x9D, 0xC3, 0x45, 0x0A, 0x27, 0x1B, 0xEA, 0x2B, 0x4B, 0x34, 0xA5,
+0xC4, 0xCA, 0x6B, 0xB0, 0xFC, 0x82, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x10, 0x9A,
+0xC6, 0x41, 0xF0, 0x49, 0xF2, 0x7B, 0xFF, 0x54, 0xC6, 0xCD, 0x8C, 0x6A, 0x6C, 0xC7, 0x3B, 0x86,
+0xC1, 0x27, 0x23, 0xA7, 0x1A, 0xA2, 0xA2, 0xBA, 0xA9, 0x01, 0x44, 0xAB, 0xA6, 0x4B, 0xAE, 0xAB,
+0xC1, 0xA6, 0x21, 0x08, 0x32, 0x4B, 0xC2, 0x48, 0x32, 0x88, 0x3A, 0xE5, 0x21, 0xA9, 0xAF, 0xBF,
+0x7A, 0x75, 0x4B, 0x00, 0x46, 0xA9, 0xBA, 0x69, 0x55, 0xBF, 0x69, 0xC0, 0x03, 0x21, 0x96, 0x49,
+0x9A, 0x41, 0xC0, 0x23, 0x21, 0xBF, 0x00, 0x55, 0x49, 0x00, 0x55, 0x00, 0x4E, 0xA2, 0x41, 0x00,
+0xBF, 0xC0, 0x44, 0x21, 0xAF, 0x7F, 0x02, 0xA5, 0xC4, 0x50, 0x84, 0xFA, 0xDE, 0x91, 0x94, 0x12,
+0xA5, 0x4F, 0x84, 0xA1, 0xC0, 0xB5, 0xB5, 0x96, 0xC1, 0xE7, 0x39, 0xE2, 0x10, 0xAF, 0xC7, 0x68,
+0x3A, 0xEA, 0x4A, 0x06, 0x2A, 0x84, 0x21, 0x26, 0x32, 0x74, 0xA5, 0xBD, 0xF7, 0x33, 0xA5, 0x47,
+0x4E, 0xC3, 0x74, 0xAD, 0x4F, 0x8C, 0x4C, 0x6B, 0x07, 0x3A, 0x85, 0x91, 0x4D, 0xC1, 0x2B, 0x43,
+0xE6, 0x19, 0x6C, 0x73, 0xB4, 0xC3, 0x4C, 0x9C, 0x17, 0xF7, 0x58, 0xF7, 0xFC, 0xFF, 0x00, 0xA5,
+0xAB, 0x00, 0x5C, 0xA9, 0xA0, 0xC0, 0x71, 0xB5, 0xA6, 0x9B, 0xC5, 0x68, 0x4A, 0xE6, 0x31, 0x89,
+0x42, 0x4B, 0x5B, 0x90, 0x8C, 0x77, 0xCE, 0x96, 0xC0, 0xB0, 0x8C, 0x44, 0x6C, 0xC0, 0xA5, 0x21,
+0x49, 0xC2, 0x8D, 0x5B, 0xEE, 0x63, 0x2B, 0x4B, 0x44, 0x00, 0xC0, 0x27, 0x32, 0xBF, 0xC1, 0x0B,
+0x53, 0x07, 0x32, 0x70, 0x9E, 0xC1, 0x27, 0x2A, 0x29, 0x32, 0x91, 0x99, 0xC0, 0x28, 0x22, 0x7E,
+0xAE, 0x00, 0x99, 0xC6, 0x65, 0x0A, 0x07, 0x1B, 0x88, 0x23, 0xC9, 0x2B, 0x0A, 0x34, 0xCA, 0x6B,
+0xB0, 0xFC, 0x6D, 0xC1, 0x20, 0xE8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x9A, 0xAF, 0xC5,
+0x49, 0xF2, 0x7B, 0xFF, 0x34, 0xC6, 0xAC, 0x84, 0x4A, 0x64, 0x86, 0x33, 0x87, 0xC0, 0xE7, 0x22,
+0x92, 0xC1, 0x46, 0x1A, 0xE5, 0x19, 0x00, 0xC1, 0x45, 0x2A, 0xE3, 0x21, 0xBB, 0xAB, 0x47, 0xC0,
+0xE8, 0x31, 0x00, 0x9D, 0x00, 0xC0, 0x29, 0x3A, 0x00, 0x80, 0x58, 0xAE, 0xAE, 0xC2, 0xAB, 0x5B,
+0x4E, 0x6C, 0x09, 0x4B, 0x71, 0xC0, 0x06, 0x2A, 0xA6, 0xA7, 0x01, 0xBE, 0xA1, 0x81, 0xBA, 0xAE,
+0xA2, 0x66, 0x64, 0x80, 0xBF, 0xAE, 0x69, 0x00, 0x96, 0x55, 0x00, 0x5A, 0x00, 0x55, 0xA5, 0x00,
+0xAB, 0x5A, 0x69, 0xC0, 0xA5, 0x29, 0x01, 0x53, 0x56, 0xC5, 0x23, 0x21, 0xC9, 0x52, 0xB5, 0xBD,
+0xF6, 0xC5, 0xB8, 0xDE, 0x16, 0xC6, 0xA5, 0xC3, 0xDD, 0xFF, 0x7C, 0xF7, 0xA9, 0x52, 0x64, 0x21,
+0x00, 0xC2, 0xC5, 0x29, 0xA9, 0x42, 0x84, 0x21, 0xA9, 0xA6, 0xC2, 0xED, 0x73, 0x57, 0xCE, 0x6F,
+0x8C, 0x00, 0xC4, 0xD9, 0xDE, 0x9C, 0xFF, 0x77, 0xD6, 0x70, 0x94, 0xC6, 0x39, 0x5F, 0xC0, 0x06,
+0x2A, 0x7E, 0xC1, 0xCE, 0x5B, 0xC6, 0x19, 0xA1, 0xC6, 0xA0, 0x10, 0xE0, 0x28, 0xEE, 0xBC, 0xD1,
+0xDD, 0x4D, 0xA4, 0x93, 0xC5, 0x15, 0xD6, 0x9A, 0xBF, 0x9D, 0xBA, 0xC7, 0xB6, 0xDE, 0xD9, 0xFF,
+0x13, 0xCE, 0x30, 0xAD, 0xD0, 0xA4, 0xCA, 0x5A, 0x48, 0x4A, 0xC6, 0x31, 0x47, 0xC1, 0x36, 0xC6,
+0xFC, 0xFF, 0x9A, 0xC1, 0x77, 0xC6, 0xE9, 0x4A, 0xA6, 0x75, 0xC1, 0x27, 0x2A, 0xA9, 0x3A, 0x00,
+0xC1, 0x0B, 0x4B, 0xAA, 0x42, 0x53, 0xC0, 0x65, 0x21, 0xA9, 0x67, 0xC2, 0xEA, 0x4A, 0x27, 0x32,
+0xC5, 0x19, 0xBF, 0x53, 0x92, 0x84, 0xA9, 0x99, 0xC0, 0xE4, 0x19, 0x00, 0x9E, 0xC2, 0x66, 0x12,
+0xE7, 0x1A, 0x48, 0x23, 0xAE, 0xC0, 0x09, 0x34, 0x43, 0xC3, 0xB0, 0xFC, 0x82, 0xC8, 0x20, 0xE8,
+0x00, 0xF8, 0xE0, 0x11, 0xAE, 0x9A, 0xC8, 0x42, 0xF0, 0x49, 0xF2, 0x7B, 0xFF, 0x34, 0xBE, 0xAC,
+0x84, 0x29, 0x64, 0xC9, 0x3B, 0x48, 0x23, 0xC7, 0x1A, 0xA2, 0xC3, 0x05, 0x1A, 0x83, 0x11, 0xE4,
+0x21, 0x86, 0x42, 0xA4, 0x92, 0xA3, 0x93, 0x9B, 0xAE, 0xAE, 0xAF, 0xB2, 0x00, 0xAD, 0x58, 0x75,
+0xC4, 0x66, 0x32, 0x0C, 0x64, 0x6E, 0x74, 0xAC, 0x5B, 0xE9, 0x42, 0x49, 0x92, 0xBA, 0xAB, 0x00,
+0xBA, 0x7D, 0x61, 0xA6, 0x5A, 0x61, 0xBE, 0x00, 0x81, 0x5C, 0x5A, 0x61, 0x01, 0x5A, 0x61, 0x00,
+0xC0, 0x85, 0x29, 0xA5, 0x5A, 0x00, 0xBA, 0x6E, 0xAF, 0x42, 0x7F, 0x00, 0xA5, 0xC5, 0xE6, 0x31,
+0x63, 0x29, 0xC1, 0x18, 0xEA, 0x62, 0x77, 0xD6, 0xFD, 0xFF, 0x00, 0xC0, 0x7B, 0xF7, 0xBF, 0xC1,
+0xD9, 0xDE, 0x88, 0x52, 0x62, 0x9A, 0x73, 0xC0, 0x26, 0x32, 0x64, 0x51, 0xC3, 0x83, 0x29, 0x67,
+0x4A, 0xB0, 0x9C, 0x32, 0xAD, 0x95, 0xC5, 0xF9, 0xE6, 0x7B, 0xFF, 0xD8, 0xE6, 0x94, 0xBD, 0xA9,
+0x5A, 0x84, 0x29, 0x7F, 0xC2, 0xA5, 0x11, 0xA9, 0x32, 0xA5, 0x19, 0x7C, 0xC6, 0x80, 0x10, 0x00,
+0x31, 0xAC, 0xBC, 0x84, 0x7A, 0x29, 0x83, 0x90, 0xA4, 0xF1, 0xAC, 0x96, 0x79, 0x9A, 0x90, 0xC1,
+0xEF, 0xA4, 0x94, 0xDE, 0xA6, 0xC2, 0xD3, 0xC5, 0x8F, 0x9C, 0xA9, 0x52, 0x7D, 0xC6, 0x81, 0x08,
+0xE2, 0x10, 0x8F, 0x94, 0xF4, 0xBD, 0x56, 0xC6, 0xD4, 0xB5, 0x88, 0x42, 0xAE, 0xC5, 0xA5, 0x21,
+0x07, 0x2A, 0x84, 0x11, 0x23, 0x09, 0x48, 0x32, 0x89, 0x3A, 0x7F, 0x96, 0xBA, 0x00, 0xC0, 0xEA,
+0x42, 0xAE, 0x90, 0xC0, 0x25, 0x2A, 0x67, 0xBE, 0xC1, 0x05, 0x32, 0x65, 0x3A, 0xAD, 0x9A, 0xA2,
+0x82, 0xC3, 0x45, 0x12, 0xE7, 0x1A, 0x69, 0x23, 0xC9, 0x2B, 0x00, 0xC4, 0xAA, 0x63, 0x90, 0xFC,
+0x82, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0x00, 0x9A, 0x5D, 0xE0, 0x0E, 0xAE, 0x9A, 0x72, 0xC8, 0x49,
+0xF2, 0x7B, 0xFF, 0x14, 0xBE, 0x8C, 0x84, 0x09, 0x64, 0xA9, 0x3B, 0x27, 0x23, 0xA7, 0x1A, 0xA7,
+0x2A, 0xA0, 0xB0, 0xC6, 0xE5, 0x52, 0x09, 0x84, 0x4E, 0xAD, 0xAC, 0x94, 0xAA, 0x7B, 0xA7, 0x52,
+0xE6, 0x39, 0x81, 0x9F, 0xAB, 0xBB, 0xBE, 0xA9, 0x7F, 0x75, 0xC0, 0xC8, 0x42, 0xAE, 0xC3, 0xA0,
+0x00, 0xAC, 0x5B, 0xC9, 0x42, 0x06, 0x2A, 0x7C, 0x4B, 0x00, 0xA6, 0xA5, 0x00, 0xA6, 0x7A, 0x75,
+0x91, 0x00, 0xBE, 0x02, 0x61, 0xAE, 0x03, 0xBE, 0x00, 0x95, 0xA6, 0x00, 0xC0, 0x85, 0x21, 0x7A,
+0x7F, 0x4B, 0x70, 0xC2, 0x06, 0x32, 0x2B, 0x63, 0xCD, 0x7B, 0x90, 0xC1, 0x6E, 0x94, 0x97, 0xDE,
+0x91, 0x76, 0x00, 0xC3, 0xD8, 0xE6, 0xDC, 0xFF, 0x36, 0xC6, 0xD5, 0xBD, 0x96, 0xC0, 0xF6, 0xB5,
+0xBE, 0xCC, 0xB4, 0xB5, 0x56, 0xC6, 0xD4, 0xBD, 0x97, 0xD6, 0x3A, 0xEF, 0x7B, 0xF7, 0xF9, 0xEE,
+0x39, 0xF7, 0x35, 0xD6, 0xD4, 0xCD, 0x77, 0xDE, 0x53, 0xB5, 0x90, 0x94, 0x86, 0xC2, 0xC9, 0x3A,
+0x2B, 0x4B, 0xA5, 0x19, 0xA1, 0xC5, 0xC1, 0x18, 0xC0, 0x28, 0x09, 0xA4, 0xA4, 0x7A, 0xED, 0x9B,
+0x13, 0xB5, 0xAE, 0xC1, 0xD1, 0xAC, 0x32, 0xAD, 0x00, 0xC0, 0xB0, 0xA4, 0xAD, 0xC4, 0x12, 0xCE,
+0x95, 0xE6, 0x31, 0xB5, 0x4B, 0x6B, 0xC6, 0x39, 0x69, 0xC3, 0x81, 0x08, 0x64, 0x29, 0x53, 0xAD,
+0x35, 0xC6, 0xAF, 0x96, 0xC0, 0xA8, 0x4A, 0x96, 0xC0, 0x43, 0x11, 0xBF, 0xC0, 0xEB, 0x4A, 0xAE,
+0x91, 0xC0, 0xA6, 0x21, 0x70, 0x4E, 0xC0, 0x44, 0x19, 0xAF, 0x9E, 0xCB, 0x2A, 0x43, 0xEC, 0x5B,
+0x08, 0x53, 0x65, 0x4A, 0x69, 0x73, 0x0E, 0xA5, 0x31, 0xC6, 0x71, 0xC6, 0xCE, 0xB5, 0x8A, 0x8C,
+0x46, 0x5B, 0xC5, 0x32, 0x8F, 0xC1, 0x68, 0x2B, 0xA9, 0x2B, 0x64, 0xC3, 0x89, 0x63, 0x90, 0xFC,
+0xA2, 0xC8, 0x40, 0xF0, 0xB2, 0x00, 0x9A, 0x5D, 0xE0, 0x0F, 0x5A, 0x9F, 0xC5, 0x69, 0xF2, 0x3A,
+0xFF, 0x13, 0xC6, 0x6B, 0x84, 0xC9, 0x5B, 0x27, 0x2B, 0x9B, 0xC6, 0xA6, 0x22, 0x84, 0x32, 0x62,
+0x42, 0xE6, 0x83, 0xAF, 0xE6, 0x72, 0xFF, 0x94, 0xFF, 0x91, 0xC5, 0xD6, 0xFF, 0xF3, 0xE6, 0x49,
+0x8C, 0x84, 0x4A, 0x83, 0x21, 0x07, 0x2A, 0x77, 0xC0, 0x08, 0x2A, 0x91, 0x90, 0xA9, 0xC1, 0xE6,
+0x29, 0xC9, 0x42, 0xBF, 0xBE, 0xC2, 0x85, 0x21, 0xEE, 0x6B, 0x91, 0x84, 0x4B, 0xC2, 0x86, 0x21,
+0x49, 0x3A, 0xC7, 0x29, 0xA2, 0x00, 0xA9, 0xC1, 0x04, 0x21, 0xA6, 0x31, 0xA6, 0xC1, 0x24, 0x21,
+0x65, 0x29, 0x55, 0xAB, 0xAE, 0x00, 0x75, 0x69, 0x95, 0xAF, 0x5A, 0xC0, 0xC6, 0x31, 0x7A, 0x6B,
+0x44, 0x68, 0xC0, 0xE6, 0x21, 0x4B, 0x43, 0xC5, 0x65, 0x19, 0xEE, 0x7B, 0xFA, 0xDE, 0x92, 0xB5,
+0x30, 0xAD, 0xD9, 0xFF, 0xA1, 0xC1, 0x9A, 0xFF, 0xFC, 0xFF, 0x00, 0xA5, 0xAB, 0xAF, 0xA6, 0xC0,
+0x5B, 0xEF, 0x00, 0xA6, 0xA9, 0xBF, 0xA5, 0x91, 0x92, 0xBE, 0xC0, 0x19, 0xF7, 0x80, 0xC1, 0x17,
+0xEF, 0xBA, 0xFF, 0xAB, 0x57, 0x63, 0x9A, 0xC4, 0x19, 0xD7, 0x2A, 0x4B, 0x65, 0x11, 0xC6, 0x29,
+0xA2, 0x18, 0xB8, 0xC5, 0xC9, 0x9B, 0x47, 0x8B, 0x0E, 0x9C, 0xB6, 0xC5, 0x33, 0xB5, 0xB1, 0xA4,
+0x99, 0x91, 0xC0, 0xD1, 0xAC, 0x94, 0xC0, 0x13, 0xD6, 0xA5, 0xC2, 0x8F, 0xA4, 0xCE, 0x83, 0x03,
+0x19, 0xBB, 0xC3, 0xE7, 0x39, 0xAA, 0x5A, 0xD6, 0xC5, 0xFA, 0xEE, 0x9A, 0x76, 0xC4, 0x12, 0x9D,
+0xA9, 0x4A, 0x64, 0x21, 0xE2, 0x08, 0x23, 0x11, 0xBF, 0x00, 0xA6, 0xCA, 0x8E, 0x63, 0x95, 0xA5,
+0x6D, 0x5B, 0xA5, 0x19, 0x44, 0x09, 0x06, 0x22, 0xC8, 0x4A, 0xA9, 0x73, 0x2D, 0xB5, 0xF3, 0xF6,
+0x74, 0xFF, 0xA9, 0x90, 0xA5, 0xCB, 0x72, 0xFF, 0xF0, 0xE6, 0xE8, 0x8C, 0x43, 0x43, 0x25, 0x2B,
+0xE9, 0x33, 0x88, 0x2B, 0x69, 0x5B, 0x6F, 0xF4, 0x81, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xAE, 0x5D,
+0xE0, 0x10, 0x9A, 0xC6, 0x41, 0xE8, 0x89, 0xF2, 0x5A, 0xFF, 0x34, 0xC6, 0x8C, 0x8C, 0x09, 0x64,
+0x27, 0x2B, 0x96, 0xC6, 0x23, 0x1A, 0x05, 0x4B, 0x2B, 0xAD, 0x6E, 0xE6, 0xAF, 0xF6, 0x4D, 0xE6,
+0xED, 0xD5, 0x96, 0xC6, 0x0E, 0xD6, 0xF1, 0xEE, 0x32, 0xF7, 0x4D, 0xAD, 0x44, 0x42, 0x63, 0x19,
+0xA6, 0x19, 0x91, 0xC2, 0x49, 0x32, 0x4D, 0x53, 0xCA, 0x4A, 0x95, 0xC1, 0xAE, 0x63, 0x2F, 0x74,
+0x4F, 0xC5, 0x6D, 0x63, 0x99, 0xC6, 0x9D, 0xE7, 0x92, 0x84, 0xC7, 0x29, 0x24, 0x11, 0x46, 0xB7,
+0x90, 0xC3, 0xA7, 0x31, 0x25, 0x21, 0x86, 0x31, 0xC6, 0x39, 0x91, 0x91, 0xC0, 0xA6, 0x39, 0x91,
+0x9A, 0x02, 0x9A, 0xC0, 0xA6, 0x29, 0x69, 0xC1, 0xC6, 0x31, 0x44, 0x21, 0x48, 0xC0, 0xA5, 0x21,
+0x6D, 0xC0, 0xE6, 0x21, 0xA6, 0xAB, 0xC7, 0x65, 0x19, 0xEE, 0x73, 0x57, 0xCE, 0x8E, 0x9C, 0x2B,
+0x94, 0xB4, 0xEE, 0x36, 0xF7, 0xBA, 0xFF, 0x9B, 0xC0, 0xFB, 0xFF, 0xAB, 0xA5, 0xC1, 0x19, 0xE7,
+0x77, 0xDE, 0xAB, 0xAE, 0xBA, 0xC1, 0xD9, 0xEE, 0x1A, 0xF7, 0xA5, 0x40, 0xC0, 0x37, 0xDE, 0xA5,
+0xAD, 0xC2, 0xB2, 0xC5, 0xB5, 0xE6, 0xFA, 0xFF, 0x55, 0x50, 0xC0, 0xFD, 0xFF, 0x00, 0xCB, 0xF9,
+0xD6, 0x2A, 0x53, 0x65, 0x19, 0xA7, 0x29, 0x82, 0x10, 0x80, 0x20, 0xE9, 0x9B, 0x87, 0x93, 0x6F,
+0xA4, 0x55, 0xBD, 0x50, 0x94, 0xAD, 0x83, 0xAE, 0x00, 0xC2, 0x91, 0xA4, 0xD0, 0xAC, 0x90, 0xCD,
+0x77, 0x5E, 0x50, 0xCC, 0x45, 0x29, 0xE3, 0x18, 0xA6, 0x31, 0x89, 0x52, 0xB5, 0xBD, 0xB9, 0xDE,
+0x5C, 0xF7, 0x9D, 0xF7, 0xB1, 0x8C, 0x8C, 0x63, 0xD1, 0x8C, 0x33, 0x9D, 0xB2, 0x8C, 0x63, 0xCC,
+0x13, 0x95, 0xB6, 0xAD, 0xDA, 0xCE, 0xFF, 0xF7, 0xBA, 0xC6, 0xEB, 0x42, 0x43, 0x09, 0x63, 0x19,
+0x28, 0x63, 0x4E, 0xB5, 0x91, 0xEE, 0xF1, 0xF6, 0x6F, 0xE6, 0x91, 0xA5, 0xCC, 0xAB, 0xCD, 0xEB,
+0xDD, 0x0E, 0xF7, 0xEE, 0xDE, 0x69, 0x9D, 0xC5, 0x4B, 0x04, 0x23, 0x87, 0x2B, 0x69, 0x5B, 0x70,
+0xF4, 0x81, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x10, 0x9A, 0xCE, 0x61, 0xE8, 0xAA,
+0xF2, 0x5B, 0xFF, 0x54, 0xCE, 0xAD, 0x8C, 0x29, 0x64, 0x66, 0x33, 0xE4, 0x22, 0xA2, 0x32, 0xCA,
+0x94, 0xD2, 0xEE, 0x50, 0xE6, 0xCF, 0xDD, 0x31, 0xE6, 0x93, 0xE6, 0x95, 0xC0, 0x8D, 0xC5, 0xA5,
+0xC7, 0xD1, 0xEE, 0x12, 0xEF, 0xAB, 0x9C, 0xC2, 0x31, 0xE5, 0x29, 0x86, 0x19, 0x50, 0x74, 0xDF,
+0xE7, 0x6E, 0x85, 0x6E, 0x91, 0xBE, 0x91, 0xC0, 0xFF, 0xFF, 0x6E, 0xC4, 0x7D, 0xE7, 0x10, 0x74,
+0x86, 0x21, 0xE7, 0x29, 0x46, 0x21, 0xA1, 0xC4, 0xE8, 0x41, 0x45, 0x29, 0xE3, 0x18, 0x85, 0x31,
+0x89, 0x52, 0xBA, 0xC0, 0x07, 0x42, 0xBF, 0xC3, 0x2C, 0x6B, 0x6D, 0x6B, 0xCB, 0x5A, 0x28, 0x42,
+0x42, 0xBF, 0xC2, 0x69, 0x4A, 0xEB, 0x5A, 0x89, 0x4A, 0x80, 0xC0, 0xE6, 0x29, 0x00, 0xC0, 0x27,
+0x2A, 0x4B, 0x96, 0xC7, 0x65, 0x21, 0xAE, 0x73, 0x74, 0xB5, 0xAB, 0x83, 0x48, 0x7B, 0xD0, 0xCD,
+0x16, 0xF7, 0xDB, 0xFF, 0xA6, 0xC0, 0xFB, 0xFF, 0x00, 0xC2, 0x9A, 0xFF, 0xD7, 0xE6, 0x76, 0xDE,
+0xBF, 0xC0, 0xD8, 0xEE, 0x79, 0x91, 0xA9, 0xA6, 0x00, 0xC1, 0x37, 0xE6, 0x77, 0xEE, 0x9D, 0xC2,
+0x71, 0xC5, 0xB1, 0xC5, 0x58, 0xF7, 0x55, 0x50, 0xAB, 0xAF, 0xC2, 0x19, 0xD7, 0x4B, 0x5B, 0x85,
+0x19, 0xBF, 0xC1, 0x61, 0x08, 0x60, 0x18, 0x53, 0x91, 0xC2, 0x4F, 0xA4, 0x34, 0xBD, 0x91, 0xA4,
+0x00, 0xC1, 0xD1, 0xA4, 0x4F, 0x94, 0xBF, 0xB9, 0xC5, 0x90, 0xC5, 0x33, 0xDE, 0x6F, 0x9C, 0xB1,
+0x9C, 0x07, 0x3A, 0xA3, 0x10, 0xA9, 0xBF, 0xC6, 0xB6, 0xBD, 0x3B, 0xEF, 0x9D, 0xFF, 0x78, 0xCE,
+0x4C, 0x63, 0x91, 0x8C, 0xDE, 0xEF, 0x6E, 0x00, 0xBA, 0x6E, 0x71, 0x6E, 0x00, 0x96, 0xC6, 0x30,
+0x74, 0x63, 0x19, 0x00, 0x19, 0xC9, 0x83, 0x93, 0xE6, 0xD3, 0xF6, 0x31, 0xE6, 0x9B, 0xC0, 0xB4,
+0xE6, 0xB9, 0xCC, 0x10, 0xDE, 0x6B, 0xCD, 0xEB, 0xDD, 0xEE, 0xEE, 0xAD, 0xD6, 0x28, 0x8D, 0x02,
+0x33, 0x65, 0x2B, 0x69, 0x5B, 0x90, 0xF4, 0x82, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0,
+0x10, 0x9A, 0xCE, 0x62, 0xE8, 0xAA, 0xF2, 0x7B, 0xFF, 0x54, 0xC6, 0xAC, 0x8C, 0x09, 0x64, 0x25,
+0x33, 0x82, 0x22, 0xC5, 0x63, 0x2E, 0xC6, 0x70, 0xE6, 0xAF, 0xDD, 0x54, 0xEE, 0x79, 0xFF, 0xDA,
+0xFF, 0xA5, 0xCB, 0x55, 0xFF, 0xAD, 0xCD, 0x0A, 0xBD, 0x90, 0xEE, 0xD1, 0xEE, 0xC4, 0x5A, 0x63,
+0x21, 0x65, 0x19, 0xCE, 0x63, 0xBA, 0xC6, 0x5C, 0xDF, 0xFB, 0xCE, 0xA6, 0xC0, 0x59, 0xBE, 0x7B,
+0xA6, 0xC0, 0x17, 0xB6, 0xBB, 0x9A, 0xC1, 0xCF, 0x6B, 0x86, 0x21, 0xBF, 0xA6, 0xC9, 0xE8, 0x39,
+0xCF, 0x7B, 0x0B, 0x63, 0xE6, 0x39, 0x4C, 0x6B, 0x57, 0xCE, 0x3B, 0xEF, 0x99, 0xDE, 0xF7, 0xCD,
+0x9A, 0xDE, 0xAE, 0xC1, 0x18, 0xCE, 0xB6, 0xBD, 0x90, 0xAF, 0xC1, 0x17, 0xC6, 0x5C, 0xEF, 0x95,
+0xC2, 0xF6, 0xB5, 0x6C, 0x63, 0x68, 0x3A, 0x91, 0x92, 0x91, 0xC7, 0x45, 0x19, 0x6D, 0x63, 0xF2,
+0x9C, 0x6B, 0x7B, 0x28, 0x73, 0x70, 0xC5, 0x57, 0xFF, 0xDB, 0xFF, 0xAF, 0x50, 0x64, 0xC0, 0xF6,
+0xEE, 0x96, 0xA2, 0xC1, 0x35, 0xDE, 0x51, 0xBD, 0xA1, 0xC0, 0xAE, 0xAC, 0x91, 0x00, 0xBF, 0xC2,
+0xD0, 0xBC, 0x31, 0xC5, 0xF3, 0xD5, 0x00, 0xC2, 0x90, 0xC5, 0x12, 0xCE, 0x99, 0xFF, 0x5C, 0xA1,
+0x5C, 0xC1, 0x9B, 0xE7, 0x8C, 0x63, 0x68, 0xB7, 0xCC, 0x41, 0x08, 0x80, 0x20, 0x2A, 0xA4, 0xA8,
+0x9B, 0x2E, 0x9C, 0xF3, 0xB4, 0x50, 0x9C, 0x90, 0xA4, 0xD1, 0xA4, 0x0D, 0x8C, 0x2F, 0x94, 0x4F,
+0xA4, 0xF2, 0xD5, 0x00, 0xC3, 0x2A, 0x73, 0x0F, 0x84, 0x08, 0x3A, 0xE3, 0x10, 0xA6, 0xC9, 0x61,
+0x10, 0x91, 0x9C, 0xDA, 0xE6, 0x3B, 0xEF, 0x17, 0xBE, 0x4C, 0x63, 0x8D, 0x63, 0xD2, 0x8C, 0x50,
+0x7C, 0xB2, 0x8C, 0x96, 0xC0, 0x10, 0x7C, 0x91, 0x81, 0xA6, 0x99, 0xC5, 0x89, 0x42, 0x43, 0x21,
+0xE0, 0x20, 0x29, 0x9C, 0xD3, 0xF6, 0x72, 0xEE, 0x97, 0xC1, 0x18, 0xF7, 0xFD, 0xFF, 0xA8, 0xA8,
+0xC3, 0xB2, 0xF6, 0x8B, 0xD5, 0x48, 0xC5, 0x4B, 0xD6, 0x9F, 0xC6, 0x04, 0x64, 0x24, 0x2B, 0x68,
+0x5B, 0x90, 0xFC, 0xA2, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0x9A, 0x74, 0xC5, 0xAA, 0xF2,
+0x5A, 0xFF, 0x34, 0xC6, 0x6C, 0x84, 0xC8, 0x63, 0xC5, 0x2A, 0xB8, 0xC4, 0x88, 0x8C, 0x0E, 0xD6,
+0x0F, 0xE6, 0xF6, 0xFE, 0xDD, 0xFF, 0xA6, 0x63, 0xC0, 0xBA, 0xFF, 0x47, 0xC1, 0x34, 0xFF, 0x0B,
+0xC5, 0xA9, 0xC3, 0x52, 0xFF, 0x69, 0x9C, 0xC4, 0x29, 0xA6, 0x21, 0x01, 0xC2, 0xE7, 0x29, 0xAA,
+0x4A, 0x6D, 0x63, 0x69, 0xC0, 0x2C, 0x5B, 0x00, 0xC1, 0x69, 0x42, 0xC7, 0x29, 0xA5, 0x91, 0x00,
+0xAE, 0xCA, 0x25, 0x21, 0xA7, 0x31, 0x0F, 0x84, 0x0B, 0x63, 0xC5, 0x39, 0xCD, 0x7B, 0x9C, 0xFF,
+0xFE, 0xFF, 0x78, 0xDE, 0x2F, 0x94, 0x8D, 0x7B, 0xAF, 0x00, 0xC0, 0x0F, 0x8C, 0x91, 0x95, 0xC5,
+0x54, 0xAD, 0x9D, 0xF7, 0xFF, 0xFF, 0x99, 0xCE, 0xA9, 0x4A, 0x84, 0x21, 0x77, 0x46, 0x91, 0xC3,
+0x04, 0x19, 0x2C, 0x63, 0xB1, 0x9C, 0x4A, 0x73, 0xA0, 0xC1, 0x50, 0xBD, 0x78, 0xFF, 0x50, 0x00,
+0xC9, 0x58, 0xFF, 0xB5, 0xE6, 0x33, 0xD6, 0xD2, 0xCD, 0x50, 0xC5, 0xAD, 0xAC, 0x4C, 0xA4, 0x8D,
+0xAC, 0xEE, 0xBC, 0x2E, 0xC5, 0xAB, 0x6A, 0xC0, 0x8E, 0xB4, 0x81, 0x95, 0x4A, 0xC0, 0xB0, 0xC5,
+0xA2, 0xC2, 0x75, 0xDE, 0xBB, 0xFF, 0xFD, 0xFF, 0xA5, 0x9F, 0xC1, 0xCD, 0x6B, 0x65, 0x19, 0xA6,
+0xC2, 0x41, 0x08, 0xC0, 0x28, 0x4A, 0xAC, 0x42, 0xC2, 0x2E, 0xA4, 0xD2, 0xAC, 0xEE, 0x93, 0xAE,
+0xAE, 0xC0, 0x6B, 0x7B, 0x78, 0xC1, 0xB0, 0xAC, 0x13, 0xDE, 0x99, 0xC2, 0x8B, 0x7B, 0xF3, 0xA4,
+0xAB, 0x52, 0x5E, 0xC3, 0xE4, 0x10, 0x62, 0x08, 0x89, 0x52, 0x71, 0x94, 0x99, 0xC0, 0xB1, 0x94,
+0x7F, 0xC3, 0x68, 0x42, 0xCA, 0x4A, 0xAE, 0x6B, 0x0B, 0x53, 0x4D, 0xC1, 0x45, 0x21, 0x08, 0x3A,
+0x00, 0x91, 0xC2, 0x25, 0x11, 0xC3, 0x10, 0x22, 0x21, 0xB4, 0xC1, 0xAB, 0xAC, 0xD2, 0xFE, 0x93,
+0x6C, 0xC0, 0xFE, 0xFF, 0x71, 0x94, 0xBD, 0xCB, 0xD8, 0xFF, 0xB1, 0xFE, 0xE7, 0xC4, 0x68, 0xCD,
+0xCD, 0xEE, 0x86, 0x84, 0x24, 0x2B, 0x48, 0x5B, 0x90, 0xFC, 0xA2, 0xC8, 0x20, 0xE8, 0x00, 0xF8,
+0xE0, 0x12, 0x9A, 0x74, 0xC5, 0xAA, 0xF2, 0x5A, 0xFF, 0x13, 0xC6, 0x4B, 0x84, 0xA8, 0x5B, 0xA5,
+0x2A, 0xB9, 0xC2, 0xA8, 0x9C, 0x2E, 0xDE, 0x71, 0xF6, 0x6C, 0xCB, 0xDE, 0xFF, 0x5E, 0xEF, 0xBE,
+0xF7, 0x9B, 0xF7, 0xDA, 0xFF, 0x97, 0xFF, 0xEF, 0xDD, 0x27, 0xAC, 0xB0, 0xFE, 0xAE, 0xCD, 0xA3,
+0x31, 0x44, 0x11, 0xA6, 0xC3, 0x08, 0x32, 0x51, 0x7C, 0x79, 0xC6, 0x3C, 0xDF, 0xBF, 0xC0, 0xDF,
+0xF7, 0x91, 0xC3, 0x39, 0xC6, 0x71, 0x84, 0xAA, 0x4A, 0xA6, 0x29, 0xAE, 0x7A, 0xA1, 0xCA, 0xC6,
+0x39, 0xAE, 0x7B, 0x89, 0x52, 0xE6, 0x41, 0xED, 0x83, 0x3A, 0xEF, 0x7C, 0xFF, 0x99, 0xDE, 0xCE,
+0x83, 0x2B, 0x73, 0x6D, 0x7B, 0x00, 0x68, 0xA1, 0x74, 0xC5, 0x91, 0x9C, 0x3B, 0xEF, 0xFE, 0xFF,
+0x78, 0xCE, 0xE6, 0x31, 0x43, 0x19, 0x7F, 0xAF, 0x5E, 0xC7, 0xE4, 0x10, 0xEB, 0x5A, 0xB1, 0x94,
+0x0A, 0x6B, 0x87, 0x62, 0x10, 0xB5, 0x18, 0xFF, 0xBB, 0xFF, 0x5D, 0xC0, 0x95, 0xE6, 0x90, 0xC2,
+0xB0, 0xCD, 0xED, 0xB4, 0x6B, 0xA4, 0xBB, 0xC3, 0xD1, 0xD5, 0x52, 0xE6, 0xD4, 0xFE, 0x35, 0xFF,
+0xAB, 0xA1, 0xC9, 0x74, 0xEE, 0xF2, 0xDD, 0xEF, 0xBC, 0x2B, 0x9C, 0x8C, 0xA4, 0x70, 0xC5, 0x92,
+0xC5, 0x76, 0xDE, 0x9B, 0xFF, 0xFD, 0xFF, 0x95, 0x58, 0xC0, 0x65, 0x19, 0x5E, 0xC7, 0x61, 0x10,
+0xC1, 0x30, 0x4A, 0xAC, 0xA8, 0x9B, 0x4E, 0xA4, 0xD2, 0xB4, 0x0E, 0x9C, 0x4F, 0x9C, 0xAE, 0xC0,
+0xCC, 0x83, 0x4C, 0xC6, 0xF1, 0xB4, 0xD1, 0xCD, 0x54, 0xDE, 0x32, 0xB5, 0x1B, 0xE7, 0xEF, 0x73,
+0xA7, 0x29, 0x45, 0xC2, 0x82, 0x08, 0x89, 0x52, 0xAE, 0x73, 0x61, 0x95, 0xC7, 0x48, 0x42, 0x0F,
+0x74, 0xDA, 0xCE, 0xFF, 0xF7, 0xD3, 0x8C, 0x86, 0x21, 0x2D, 0x5B, 0x59, 0xC6, 0xAB, 0x90, 0xC0,
+0xF4, 0x94, 0x4A, 0xC3, 0xE2, 0x20, 0xA3, 0x41, 0x6E, 0xCD, 0xD3, 0xFE, 0x96, 0xC1, 0xDB, 0xFF,
+0xFF, 0xFF, 0x86, 0xAE, 0x54, 0xCB, 0xB8, 0xFF, 0xB5, 0xFF, 0x6A, 0xDD, 0xC6, 0xC4, 0x4B, 0xE6,
+0x85, 0x8C, 0x04, 0x2B, 0x48, 0x5B, 0x6F, 0xF4, 0x82, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xE0, 0x12,
+0x9A, 0xC1, 0x62, 0xE8, 0xAA, 0xF2, 0x75, 0xC3, 0x14, 0xC6, 0x6B, 0x84, 0xA8, 0x5B, 0x85, 0x2A,
+0xA4, 0xC4, 0x89, 0x9C, 0x90, 0xEE, 0xB3, 0xFE, 0x38, 0xFF, 0x7E, 0xF7, 0x9B, 0x9E, 0xCB, 0xFE,
+0xF7, 0xBA, 0xFF, 0x77, 0xFF, 0x71, 0xF6, 0x07, 0xAC, 0x2F, 0xF6, 0x2D, 0xC5, 0xE4, 0x39, 0x64,
+0x19, 0x0B, 0x53, 0x17, 0xB6, 0xBE, 0xEF, 0xAB, 0xCD, 0xFC, 0xD6, 0x5A, 0xC6, 0xB7, 0xB5, 0xDC,
+0xD6, 0x7E, 0xEF, 0xDF, 0xF7, 0x18, 0xBE, 0xCA, 0x4A, 0x65, 0x21, 0xA6, 0x29, 0x44, 0x21, 0xA6,
+0x31, 0x4C, 0x6B, 0xE6, 0x41, 0x95, 0xC4, 0xED, 0x83, 0xD9, 0xE6, 0x1A, 0xEF, 0x78, 0xDE, 0xCE,
+0x8B, 0x91, 0x6B, 0xC1, 0x2B, 0x7B, 0x6C, 0x83, 0xAE, 0x00, 0x64, 0xC3, 0x3B, 0xF7, 0xDD, 0xFF,
+0x78, 0xCE, 0xA5, 0x31, 0x81, 0x47, 0x97, 0xCA, 0x45, 0x21, 0xE3, 0x10, 0x8A, 0x4A, 0x91, 0x94,
+0xEA, 0x6A, 0x46, 0x5A, 0x11, 0xB5, 0xB6, 0xEE, 0xF8, 0xFE, 0x75, 0xE6, 0xD2, 0xD5, 0x90, 0xC5,
+0x2E, 0xBD, 0xCC, 0xB4, 0x2E, 0xC5, 0xD0, 0xD5, 0x93, 0xEE, 0xD3, 0xF6, 0xBE, 0xA6, 0x75, 0xC0,
+0x15, 0xFF, 0xA6, 0xA6, 0x9A, 0xC9, 0x0E, 0xBD, 0x4B, 0xA4, 0xED, 0xB4, 0x50, 0xC5, 0x93, 0xC5,
+0x97, 0xE6, 0x9B, 0xFF, 0x3A, 0xDF, 0x6C, 0x63, 0x85, 0x21, 0xA6, 0xCB, 0x41, 0x10, 0xC0, 0x28,
+0x4A, 0xAC, 0xC8, 0xA3, 0x6E, 0xAC, 0xB1, 0xAC, 0xAD, 0x8B, 0xED, 0x93, 0x6E, 0x9C, 0xED, 0x8B,
+0x70, 0xA4, 0xF1, 0xB4, 0x72, 0xC4, 0x13, 0xD6, 0x94, 0xBD, 0x9D, 0xF7, 0xCF, 0x73, 0xC8, 0x29,
+0x90, 0xBA, 0xC1, 0x50, 0x8C, 0xF2, 0x9C, 0x91, 0x7F, 0xC7, 0x44, 0x19, 0xB1, 0x84, 0xDE, 0xEF,
+0x37, 0xB6, 0xCB, 0x4A, 0x24, 0x19, 0x2D, 0x63, 0xDF, 0xF7, 0xAE, 0xC0, 0x7E, 0xE7, 0x6E, 0xC7,
+0x14, 0x9D, 0x03, 0x21, 0xE4, 0x49, 0x8F, 0xCD, 0xB2, 0xFE, 0xB4, 0xF6, 0xDA, 0xFF, 0xDE, 0xF7,
+0x6E, 0x00, 0xA8, 0xCA, 0x37, 0xF7, 0x95, 0xFF, 0xAB, 0xE5, 0xA6, 0xC4, 0x0A, 0xDE, 0x86, 0x94,
+0x04, 0x2B, 0x28, 0x53, 0x6F, 0xF4, 0x81, 0xC8, 0x40, 0xF0, 0xB2, 0xAE, 0x5D, 0xE0, 0x10, 0x9A,
+0xC6, 0x62, 0xE8, 0xCA, 0xF2, 0x7B, 0xFF, 0x34, 0xC6, 0x8C, 0x84, 0xC9, 0x63, 0xE7, 0x32, 0xA0,
+0xC3, 0xCA, 0xA4, 0x4F, 0xEE, 0x92, 0xFE, 0xDA, 0xFF, 0x71, 0xC0, 0x7F, 0xE7, 0x6E, 0xB9, 0xC6,
+0xBA, 0xFF, 0x56, 0xFF, 0x51, 0xEE, 0x07, 0xAC, 0x70, 0xFE, 0xEC, 0xBC, 0x62, 0x29, 0x57, 0xC5,
+0xD2, 0x8C, 0xDE, 0xEF, 0xF8, 0xB5, 0xCB, 0x52, 0xA7, 0x31, 0x29, 0x42, 0x91, 0xAF, 0x59, 0xC0,
+0x39, 0xC6, 0x69, 0xC1, 0x91, 0x84, 0x85, 0x29, 0x96, 0xA1, 0xC2, 0x07, 0x3A, 0xAD, 0x73, 0xE6,
+0x41, 0x90, 0xC4, 0xCD, 0x83, 0x19, 0xEF, 0xBC, 0xFF, 0x57, 0xDE, 0x8C, 0x83, 0xAB, 0xC1, 0xEF,
+0x93, 0x6C, 0x7B, 0x50, 0x00, 0x91, 0xC4, 0x70, 0x9C, 0x1B, 0xEF, 0xBD, 0xFF, 0x78, 0xCE, 0xC5,
+0x31, 0x96, 0xC1, 0xE7, 0x31, 0x86, 0x21, 0x00, 0xCD, 0xC3, 0x10, 0x48, 0x42, 0x91, 0x94, 0x0B,
+0x6B, 0x67, 0x5A, 0x52, 0xBD, 0x76, 0xE6, 0xD4, 0xD5, 0x14, 0xDE, 0x91, 0xCD, 0xAC, 0xB4, 0x4A,
+0xA4, 0x0C, 0xBD, 0x11, 0xDE, 0x68, 0x91, 0xAE, 0xB9, 0x96, 0x59, 0xC0, 0xD3, 0xF6, 0xBB, 0x96,
+0x96, 0xC6, 0x77, 0xFF, 0xF0, 0xD5, 0x0A, 0x9C, 0xEF, 0xB4, 0x14, 0xDE, 0x36, 0xD6, 0x97, 0xDE,
+0x8A, 0xC0, 0x2A, 0x5B, 0x72, 0x75, 0xC8, 0x61, 0x10, 0xA0, 0x28, 0x4A, 0xAC, 0xC8, 0xA3, 0x6E,
+0xAC, 0x90, 0xAC, 0x8C, 0x8B, 0xED, 0x93, 0xB0, 0xA4, 0x91, 0xBF, 0xA9, 0xC6, 0x53, 0xE6, 0xF2,
+0xCD, 0x73, 0xBD, 0x5D, 0xEF, 0x8E, 0x6B, 0xC8, 0x29, 0x25, 0x19, 0xA5, 0xC0, 0x65, 0x29, 0xA5,
+0xC4, 0x0B, 0x5B, 0x8D, 0x63, 0xE3, 0x10, 0x13, 0x8D, 0xFF, 0xF7, 0x4B, 0xC3, 0xA2, 0x08, 0xC7,
+0x29, 0xEC, 0x52, 0xDB, 0xD6, 0x91, 0xC9, 0x35, 0x9D, 0x7E, 0xE7, 0xD7, 0xB5, 0x43, 0x21, 0xA3,
+0x39, 0xED, 0xB4, 0x92, 0xF6, 0x56, 0xFF, 0xFA, 0xFF, 0xBD, 0xF7, 0x6E, 0x86, 0xC0, 0xFE, 0xFF,
+0x59, 0xC9, 0x33, 0xFF, 0xCB, 0xE5, 0x07, 0xCD, 0x2C, 0xE6, 0x86, 0x8C, 0x04, 0x2B, 0x28, 0x53,
+0x4F, 0xF4, 0x81, 0xC8, 0x40, 0xF0, 0x62, 0x00, 0x5A, 0xBA, 0xE0, 0x0F, 0x62, 0x8F, 0xC5, 0xCA,
+0xFA, 0x19, 0xFF, 0x14, 0xC6, 0xAC, 0x8C, 0x67, 0x53, 0xA4, 0x22, 0xBA, 0xC5, 0x48, 0x94, 0x2F,
+0xE6, 0x92, 0xFE, 0x57, 0xFF, 0xFD, 0xFF, 0x9D, 0xF7, 0xAF, 0xC9, 0x7B, 0xF7, 0xB9, 0xFF, 0x55,
+0xFF, 0xEA, 0xBC, 0x2B, 0xCD, 0xB1, 0xFE, 0xCC, 0xB4, 0x21, 0x21, 0xA5, 0x21, 0xD6, 0xAD, 0x6E,
+0xC2, 0x31, 0x7C, 0x04, 0x11, 0x25, 0x21, 0xAF, 0x00, 0xC2, 0x62, 0x08, 0x05, 0x21, 0x14, 0x9D,
+0x6E, 0xC2, 0x95, 0xA5, 0x07, 0x32, 0x64, 0x21, 0xA2, 0xC8, 0x85, 0x29, 0xAD, 0x73, 0xA8, 0x52,
+0xA4, 0x39, 0x2E, 0x8C, 0xF9, 0xE6, 0xBC, 0xFF, 0x16, 0xD6, 0xAD, 0x83, 0x48, 0xC0, 0xCE, 0x8B,
+0x48, 0x5C, 0xBE, 0x7C, 0xC1, 0x70, 0x9C, 0xB9, 0xE6, 0x6A, 0xC4, 0x16, 0xC6, 0x27, 0x42, 0xA1,
+0x08, 0x85, 0x21, 0xC6, 0x29, 0xA6, 0xC3, 0xA2, 0x08, 0x48, 0x42, 0x70, 0x8C, 0x0B, 0x6B, 0x71,
+0xC1, 0x16, 0xDE, 0x56, 0xE6, 0x00, 0xC1, 0xD3, 0xDD, 0x2B, 0xA4, 0x99, 0xC2, 0x4E, 0xC5, 0xD0,
+0xD5, 0x51, 0xE6, 0xBF, 0x90, 0xAE, 0xAE, 0xBA, 0xAF, 0xA6, 0x54, 0xAB, 0xC1, 0xB4, 0xF6, 0x16,
+0xFF, 0x90, 0x64, 0xC2, 0x6D, 0xAC, 0x10, 0xBD, 0xB7, 0xE6, 0x82, 0xC8, 0xB7, 0xD6, 0x2A, 0x53,
+0xC6, 0x21, 0x66, 0x21, 0x81, 0x10, 0xC0, 0x28, 0x6A, 0xB4, 0xE8, 0xA3, 0x8F, 0xB4, 0x97, 0xC1,
+0x8C, 0x8B, 0x2E, 0x94, 0xBE, 0xC9, 0xAC, 0x83, 0x2F, 0x9C, 0x6F, 0xA4, 0xD1, 0xD5, 0x53, 0xDE,
+0x73, 0xBD, 0x5D, 0xEF, 0xF0, 0x73, 0xE8, 0x31, 0x45, 0x19, 0xA1, 0xA0, 0xC2, 0x64, 0x29, 0xA1,
+0x10, 0x23, 0x19, 0x70, 0xD1, 0xD2, 0x84, 0xFE, 0xEF, 0x58, 0xBE, 0xCE, 0x6B, 0x69, 0x42, 0x8E,
+0x6B, 0xFF, 0xF7, 0x96, 0xAD, 0xAB, 0x4A, 0x9E, 0xEF, 0xD6, 0xAD, 0x84, 0x21, 0xC3, 0x31, 0x2A,
+0x94, 0x93, 0xF6, 0x14, 0xFF, 0x97, 0xFF, 0xFC, 0xFF, 0x9B, 0x96, 0xCB, 0x9A, 0xF7, 0x96, 0xFF,
+0x6F, 0xEE, 0x68, 0xD5, 0x2B, 0xE6, 0xEB, 0xCD, 0xC4, 0x6B, 0xE4, 0x22, 0x07, 0x53, 0x2E, 0xEC,
+0xA2, 0xD0, 0x40, 0xF0, 0xB6, 0xA6, 0xE0, 0x11, 0x62, 0x8F, 0xCC, 0xCA, 0xFA, 0x19, 0xFF, 0x14,
+0xC6, 0xAC, 0x8C, 0x87, 0x53, 0xC5, 0x22, 0x42, 0x22, 0xA5, 0x73, 0xCD, 0xD5, 0x91, 0xFE, 0xF4,
+0xFE, 0xB9, 0xFF, 0xDC, 0xFF, 0xAF, 0x5C, 0xC0, 0x56, 0xFF, 0x79, 0xC0, 0x8C, 0xD5, 0x7F, 0xC9,
+0x0F, 0xE6, 0xE5, 0x72, 0x62, 0x29, 0x85, 0x21, 0xD2, 0x8C, 0xFF, 0xEF, 0x5D, 0xDF, 0xF7, 0xB5,
+0x96, 0xAD, 0x14, 0x9D, 0xA2, 0xC1, 0x55, 0xA5, 0x39, 0xC6, 0x55, 0x95, 0xC0, 0x30, 0x7C, 0x7A,
+0xAE, 0xC9, 0xE3, 0x18, 0xE6, 0x31, 0xEE, 0x7B, 0x68, 0x4A, 0x22, 0x29, 0x4A, 0x6B, 0xF5, 0xC5,
+0x3A, 0xF7, 0xF6, 0xCD, 0xCE, 0x8B, 0x91, 0xC0, 0xCD, 0x83, 0x92, 0xC0, 0x0E, 0x8C, 0x00, 0xC2,
+0xAC, 0x83, 0x91, 0xA4, 0x78, 0xDE, 0x9A, 0xC2, 0x33, 0xA5, 0x2F, 0x84, 0xCA, 0x52, 0x7A, 0x91,
+0xC6, 0xC7, 0x29, 0xE3, 0x10, 0x69, 0x4A, 0x50, 0x8C, 0xEA, 0x6A, 0x68, 0x5A, 0x36, 0xDE, 0xBE,
+0x91, 0xC4, 0x51, 0xCD, 0xEA, 0x9B, 0x6B, 0xA4, 0xD0, 0xD5, 0x31, 0xDE, 0xBE, 0x00, 0x95, 0xBA,
+0xAE, 0xAE, 0xBA, 0xAB, 0x45, 0xAB, 0xBF, 0xC0, 0xD4, 0xF6, 0xA9, 0xC4, 0x52, 0xEE, 0x0F, 0xBD,
+0xAF, 0xB4, 0x15, 0xD6, 0xB8, 0xDE, 0x8A, 0xC1, 0x2A, 0x53, 0xC7, 0x21, 0xA1, 0xC4, 0x61, 0x10,
+0xA0, 0x28, 0x09, 0xAC, 0xA7, 0x9B, 0x6E, 0xAC, 0x83, 0xC6, 0x0A, 0x7B, 0x8C, 0x83, 0xED, 0x8B,
+0x8B, 0x7B, 0x4F, 0x9C, 0xD0, 0xAC, 0x53, 0xDE, 0x91, 0xC4, 0x52, 0xB5, 0x7D, 0xEF, 0x11, 0x7C,
+0xE8, 0x31, 0x66, 0x21, 0x7A, 0xC0, 0xE6, 0x39, 0xAF, 0x95, 0xC4, 0x84, 0x21, 0xC1, 0x08, 0x4B,
+0x53, 0x98, 0xBE, 0xFE, 0xEF, 0xAB, 0x6E, 0xBA, 0xC5, 0x9E, 0xEF, 0x8E, 0x6B, 0xE7, 0x31, 0xF8,
+0xB5, 0x74, 0x9D, 0x83, 0x19, 0xB4, 0xC2, 0x68, 0x7B, 0x52, 0xE6, 0x34, 0xFF, 0xAF, 0xC0, 0xFA,
+0xFF, 0xAB, 0x00, 0xA4, 0x46, 0xC9, 0x6E, 0xEE, 0x2B, 0xE6, 0x8C, 0xE6, 0x8A, 0xB5, 0xC5, 0x63,
+0x04, 0x23, 0x07, 0x53, 0x2E, 0xEC, 0xA2, 0xD0, 0x40, 0xF0, 0x62, 0xA6, 0xE0, 0x11, 0x62, 0x8F,
+0xCB, 0xEB, 0xFA, 0x1A, 0xFF, 0x14, 0xC6, 0xAC, 0x8C, 0x87, 0x53, 0x26, 0x2B, 0x21, 0x12, 0x82,
+0x4A, 0x89, 0xA4, 0x4F, 0xEE, 0x12, 0xFF, 0x75, 0xFF, 0xAF, 0xAB, 0xAE, 0xC6, 0x13, 0xFF, 0x2E,
+0xE6, 0x90, 0xEE, 0xD1, 0xF6, 0x6A, 0xA4, 0x61, 0x31, 0x84, 0x21, 0x82, 0xC3, 0x89, 0x42, 0xF3,
+0x8C, 0xDB, 0xCE, 0x9E, 0xEF, 0x6E, 0xBA, 0x01, 0x55, 0xC2, 0x59, 0xC6, 0x91, 0x84, 0x48, 0x42,
+0x66, 0x7F, 0xA1, 0x6A, 0xC7, 0x6D, 0x6B, 0xC5, 0x31, 0xC1, 0x10, 0x06, 0x42, 0x6B, 0x73, 0x0E,
+0x8C, 0x4B, 0x73, 0x07, 0x4A, 0xA6, 0x00, 0x95, 0xC0, 0x47, 0x52, 0x96, 0x91, 0xC2, 0xCA, 0x62,
+0xCE, 0x83, 0x2B, 0x6B, 0x86, 0xC2, 0x0F, 0x7C, 0x6C, 0x63, 0xE7, 0x31, 0x72, 0xC3, 0x24, 0x11,
+0xA2, 0x08, 0x89, 0x4A, 0x71, 0x94, 0x79, 0xC1, 0xC9, 0x6A, 0x36, 0xDE, 0x00, 0xC5, 0xD4, 0xDD,
+0x8E, 0xB4, 0xA9, 0x93, 0xCD, 0xB4, 0x11, 0xDE, 0x72, 0xE6, 0x4C, 0x90, 0x00, 0xAE, 0xA9, 0xBE,
+0xAB, 0x00, 0xA7, 0x01, 0xC9, 0x72, 0xEE, 0xB3, 0xF6, 0xF4, 0xFE, 0xB1, 0xD5, 0x6D, 0xAC, 0x52,
+0xBD, 0xF9, 0xE6, 0x77, 0xC6, 0xE9, 0x4A, 0xC7, 0x21, 0xA0, 0xCC, 0x61, 0x08, 0xA0, 0x20, 0x08,
+0xA4, 0x87, 0x9B, 0x8F, 0xB4, 0x91, 0xAC, 0x8D, 0x8B, 0x2F, 0x9C, 0xB0, 0xA4, 0x2E, 0x94, 0xB1,
+0xA4, 0x12, 0xBD, 0x33, 0xDE, 0x9A, 0xC6, 0x94, 0xBD, 0x5D, 0xEF, 0xAE, 0x6B, 0x45, 0x19, 0xC7,
+0x31, 0x8E, 0x6B, 0x91, 0x94, 0x99, 0xC7, 0xD1, 0x94, 0xAD, 0x6B, 0xE5, 0x29, 0x27, 0x32, 0x68,
+0x3A, 0xAD, 0x63, 0x75, 0xA5, 0x79, 0xC6, 0xA5, 0xC1, 0xEF, 0x73, 0x65, 0x21, 0x5E, 0xC5, 0xCB,
+0x4A, 0x07, 0x2A, 0xA4, 0x19, 0x01, 0x11, 0xE3, 0x41, 0x6B, 0xA4, 0x7E, 0xC1, 0x33, 0xFF, 0x95,
+0xFF, 0x63, 0xC0, 0xD7, 0xFF, 0xAE, 0xC1, 0x52, 0xFF, 0xAE, 0xEE, 0x99, 0xC7, 0xCB, 0xBD, 0xE6,
+0x73, 0xC3, 0x32, 0x25, 0x23, 0x28, 0x53, 0x2E, 0xEC, 0xA2, 0xC8, 0x40, 0xF0, 0xB2, 0xE0, 0x12,
+0xAE, 0x8F, 0xCC, 0xEB, 0xFA, 0x3A, 0xFF, 0x13, 0xC6, 0xAC, 0x8C, 0xA8, 0x5B, 0x06, 0x2B, 0x63,
+0x12, 0xC0, 0x29, 0xC2, 0x5A, 0xA9, 0xAC, 0x6E, 0xE6, 0x52, 0xFF, 0x94, 0xFF, 0xA6, 0x01, 0xC5,
+0xF1, 0xFE, 0x70, 0xE6, 0xCB, 0xAC, 0x44, 0x52, 0x62, 0x29, 0x85, 0x21, 0x96, 0x95, 0xC1, 0x86,
+0x21, 0xAA, 0x42, 0x5A, 0xC1, 0x92, 0x8C, 0x34, 0x9D, 0x00, 0xC2, 0x71, 0x84, 0x4D, 0x63, 0x49,
+0x3A, 0x6B, 0xA6, 0xC0, 0xA6, 0x29, 0xAF, 0xA1, 0x00, 0xA9, 0x59, 0xC1, 0xA1, 0x10, 0x63, 0x29,
+0x92, 0xC1, 0xA1, 0x18, 0xE2, 0x20, 0x69, 0xC0, 0x23, 0x29, 0x96, 0x7D, 0x49, 0x90, 0x00, 0x7D,
+0xAB, 0x49, 0xC2, 0x64, 0x29, 0xC6, 0x31, 0x28, 0x32, 0xBE, 0x00, 0xC5, 0x44, 0x19, 0xE3, 0x10,
+0xEB, 0x5A, 0x91, 0x94, 0x6C, 0x73, 0x0A, 0x73, 0x60, 0xBA, 0xC4, 0x92, 0xD5, 0x0B, 0xA4, 0xA9,
+0x93, 0x2E, 0xC5, 0x31, 0xE6, 0x4C, 0x40, 0x91, 0x00, 0xAE, 0xA9, 0x00, 0xAE, 0x00, 0xAB, 0x71,
+0x00, 0xC1, 0x51, 0xE6, 0x92, 0xEE, 0x7C, 0xCA, 0x33, 0xE6, 0x6D, 0xAC, 0xD0, 0xAC, 0xF9, 0xE6,
+0x15, 0xB6, 0x87, 0x3A, 0xC6, 0x19, 0x65, 0x19, 0x61, 0x08, 0xC0, 0x28, 0x08, 0xA4, 0xA1, 0xCD,
+0x8F, 0xAC, 0xB1, 0xAC, 0xAD, 0x8B, 0x4F, 0x9C, 0xD1, 0xA4, 0x0E, 0x8C, 0x50, 0x9C, 0xB0, 0xAC,
+0x70, 0xC5, 0x53, 0xDE, 0x16, 0xD6, 0x3C, 0xEF, 0xAF, 0x73, 0x04, 0x11, 0xBA, 0xC5, 0xCB, 0x5A,
+0x0F, 0x84, 0x33, 0xA5, 0x74, 0xAD, 0x90, 0x84, 0xE9, 0x4A, 0x96, 0xC0, 0x63, 0x11, 0xBF, 0xA1,
+0xC3, 0x2B, 0x53, 0x0F, 0x74, 0x2C, 0x5B, 0x07, 0x32, 0x63, 0xC0, 0xA6, 0x21, 0x00, 0x9D, 0xB5,
+0xB0, 0xC2, 0x44, 0x5A, 0x6A, 0xA4, 0xB1, 0xEE, 0x55, 0x00, 0x91, 0xC6, 0xB4, 0xFF, 0x52, 0xFF,
+0xAF, 0xE6, 0x0C, 0xC6, 0xA8, 0x8C, 0x45, 0x4B, 0x46, 0x33, 0x8A, 0xC4, 0x48, 0x5B, 0x2F, 0xEC,
+0xA2, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0x9A, 0xC1, 0x41, 0xE8, 0x0B, 0xFB, 0x70, 0xC3,
+0x13, 0xBE, 0xAC, 0x8C, 0xC9, 0x5B, 0xA5, 0x1A, 0xAE, 0xC7, 0x02, 0x22, 0xA0, 0x29, 0x61, 0x52,
+0x06, 0x94, 0xCC, 0xC5, 0xF1, 0xE6, 0x32, 0xEF, 0xD1, 0xE6, 0xA2, 0xC4, 0x6D, 0xC5, 0xE8, 0x93,
+0x64, 0x52, 0x22, 0x21, 0xC6, 0x29, 0x63, 0xC0, 0xC7, 0x21, 0xBE, 0xC0, 0x86, 0x19, 0xA0, 0x6B,
+0x7F, 0x00, 0xA6, 0x91, 0x00, 0xBF, 0x7A, 0xAF, 0xBE, 0x46, 0xBF, 0xA1, 0x94, 0xC6, 0x03, 0x19,
+0xE6, 0x39, 0x27, 0x42, 0xA5, 0x31, 0x44, 0x29, 0xA1, 0x10, 0xE2, 0x18, 0x5D, 0x96, 0x00, 0xAE,
+0x7A, 0x46, 0xBA, 0x91, 0x5A, 0x6E, 0xC0, 0x24, 0x19, 0x63, 0xC1, 0x28, 0x32, 0x89, 0x3A, 0xBE,
+0xC3, 0xE6, 0x31, 0x6C, 0x6B, 0x70, 0x8C, 0x0B, 0x6B, 0xA0, 0xC3, 0x16, 0xDE, 0x77, 0xEE, 0x71,
+0xCD, 0xC9, 0x9B, 0xAE, 0xC1, 0x6F, 0xCD, 0xF0, 0xDD, 0x00, 0xAF, 0x00, 0x6C, 0xA9, 0x00, 0xAD,
+0x00, 0xAB, 0x00, 0xAB, 0x00, 0xC0, 0x51, 0xE6, 0xAE, 0xCB, 0x92, 0xF6, 0x74, 0xEE, 0xCF, 0xBC,
+0x8F, 0xA4, 0xB8, 0xDE, 0xD4, 0xB5, 0x46, 0x32, 0xC6, 0x19, 0x65, 0x19, 0x61, 0x08, 0xE0, 0x28,
+0x08, 0xA4, 0xA6, 0xC0, 0xB0, 0xB4, 0x87, 0xC6, 0x4C, 0x7B, 0xAD, 0x83, 0x4F, 0x94, 0xAC, 0x83,
+0x0E, 0x94, 0x90, 0xAC, 0xF2, 0xD5, 0xAE, 0xC3, 0x4E, 0x9C, 0x70, 0x94, 0x8A, 0x4A, 0x65, 0x21,
+0xA1, 0xC2, 0x28, 0x42, 0x53, 0xAD, 0xFD, 0xFF, 0x91, 0xC2, 0x77, 0xC6, 0x8C, 0x63, 0x88, 0x3A,
+0x61, 0x00, 0xC1, 0x06, 0x2A, 0xEA, 0x4A, 0x00, 0xC2, 0xEE, 0x6B, 0x4C, 0x5B, 0xA5, 0x21, 0xAF,
+0x79, 0x00, 0xC7, 0x07, 0x2A, 0xA4, 0x29, 0x41, 0x29, 0x43, 0x52, 0x08, 0x8C, 0x8D, 0xBD, 0x4F,
+0xD6, 0xB0, 0xDE, 0x96, 0xCB, 0xEE, 0xC5, 0xEA, 0x9C, 0xC6, 0x6B, 0xC3, 0x3A, 0xA3, 0x22, 0x26,
+0x2B, 0x87, 0x2B, 0x48, 0x5B, 0x4F, 0xEC, 0xA2, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0x9A,
+0xC6, 0x41, 0xE8, 0x0B, 0xFB, 0x3A, 0xFF, 0xF3, 0xBD, 0xAC, 0x8C, 0xE9, 0x5B, 0x07, 0x23, 0x00,
+0xC1, 0xA6, 0x22, 0x03, 0x22, 0xB0, 0xC3, 0x01, 0x42, 0xE3, 0x5A, 0xC6, 0x73, 0x49, 0x8C, 0x95,
+0xC3, 0xA7, 0x83, 0x63, 0x5A, 0x81, 0x39, 0xA4, 0x31, 0x8B, 0xC0, 0xA7, 0x19, 0xA9, 0xBF, 0xC0,
+0x08, 0x2A, 0xA5, 0x95, 0xC0, 0x27, 0x32, 0xAB, 0xC1, 0xA6, 0x29, 0xE7, 0x31, 0xA5, 0xC1, 0x08,
+0x32, 0x49, 0x3A, 0x00, 0x5A, 0x91, 0x95, 0xA6, 0xBB, 0xA9, 0xC0, 0x03, 0x19, 0xAE, 0xA1, 0xC2,
+0x23, 0x21, 0xA5, 0x31, 0xC2, 0x18, 0x9A, 0xBF, 0x72, 0x46, 0xC1, 0x44, 0x21, 0xE2, 0x10, 0x4B,
+0xC0, 0x64, 0x29, 0xAF, 0xBF, 0x7F, 0xC0, 0x07, 0x32, 0x81, 0x91, 0xC5, 0xE6, 0x21, 0x48, 0x32,
+0x85, 0x21, 0x2B, 0x63, 0x2F, 0x8C, 0xCA, 0x6A, 0x90, 0xC6, 0x94, 0xCD, 0x56, 0xEE, 0x50, 0xCD,
+0xA8, 0x93, 0x2A, 0xA4, 0x6E, 0xCD, 0xAF, 0xD5, 0x00, 0xBF, 0xC0, 0x11, 0xE6, 0x95, 0xA9, 0x00,
+0xA9, 0x01, 0x65, 0xAE, 0x00, 0xC0, 0x71, 0xE6, 0xA5, 0xAB, 0xC6, 0x74, 0xEE, 0x30, 0xC5, 0x8E,
+0xA4, 0x97, 0xD6, 0xF4, 0xB5, 0x67, 0x32, 0xE7, 0x21, 0x68, 0xC2, 0x60, 0x00, 0xE0, 0x20, 0xC7,
+0x9B, 0x00, 0xCC, 0x8F, 0xAC, 0xB2, 0xA4, 0x6C, 0x7B, 0xEE, 0x8B, 0xB0, 0xA4, 0x0E, 0x8C, 0x2F,
+0x9C, 0xD0, 0xAC, 0x12, 0xDE, 0x90, 0xCD, 0x2A, 0x73, 0x68, 0x52, 0x04, 0x21, 0x9A, 0xBE, 0xC2,
+0x65, 0x31, 0xEE, 0x83, 0xF9, 0xDE, 0xA6, 0x85, 0xC1, 0x8C, 0x63, 0x06, 0x32, 0x80, 0xAB, 0xBA,
+0xC2, 0x27, 0x32, 0x84, 0x21, 0x6C, 0x5B, 0x91, 0xC2, 0xC6, 0x21, 0x07, 0x2A, 0xA5, 0x19, 0xAF,
+0x96, 0x61, 0xB5, 0xB8, 0xC3, 0xA1, 0x31, 0x62, 0x4A, 0x25, 0x63, 0x66, 0x6B, 0x95, 0x91, 0xC1,
+0xA3, 0x42, 0x62, 0x2A, 0x9F, 0xC1, 0x26, 0x23, 0xC8, 0x2B, 0xA6, 0xC4, 0x69, 0x5B, 0x4F, 0xF4,
+0xA2, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0x9A, 0xC6, 0x41, 0xE8, 0x2C, 0xFB, 0x3A, 0xFF,
+0xF3, 0xBD, 0xAC, 0x8C, 0xE9, 0x63, 0x68, 0x33, 0x86, 0xC3, 0xE8, 0x22, 0x87, 0x22, 0xE4, 0x21,
+0x83, 0x21, 0xA5, 0x94, 0xC1, 0x81, 0x21, 0xC2, 0x29, 0xB2, 0xC0, 0x01, 0x21, 0xAB, 0x7D, 0xC0,
+0xE8, 0x21, 0x81, 0xC0, 0x29, 0x2A, 0x43, 0x74, 0xA5, 0xA6, 0xC0, 0xE6, 0x29, 0xBF, 0x91, 0xC0,
+0x27, 0x32, 0x53, 0xC0, 0xA6, 0x29, 0x9A, 0xBF, 0x00, 0x96, 0x46, 0xBF, 0x00, 0xA5, 0xC0, 0x04,
+0x19, 0x90, 0x59, 0xC2, 0xE3, 0x18, 0x65, 0x29, 0x03, 0x19, 0x72, 0xAB, 0x95, 0xC0, 0x03, 0x11,
+0xBF, 0x90, 0x4B, 0xBF, 0x7A, 0x01, 0xC2, 0x48, 0x32, 0xE7, 0x29, 0x24, 0x09, 0x68, 0xCB, 0x24,
+0x11, 0x81, 0x00, 0xC9, 0x52, 0x2F, 0x84, 0x0A, 0x6B, 0x88, 0x62, 0x53, 0xC5, 0x56, 0xE6, 0x2F,
+0xCD, 0x87, 0x93, 0x29, 0xAC, 0x6D, 0xCD, 0xBF, 0xC0, 0xCF, 0xDD, 0xAB, 0xBF, 0x99, 0xA9, 0x5E,
+0x02, 0x65, 0xAE, 0x96, 0xC0, 0x50, 0xE6, 0x00, 0xA6, 0xC8, 0x74, 0xEE, 0x30, 0xC5, 0x6E, 0xA4,
+0x97, 0xDE, 0x35, 0xBE, 0x87, 0x32, 0x28, 0x22, 0x85, 0x19, 0x60, 0x00, 0x6F, 0xC0, 0xA6, 0x93,
+0xBB, 0xC5, 0x2E, 0x9C, 0x71, 0x9C, 0x4C, 0x7B, 0xEE, 0x8B, 0xF1, 0xA4, 0x2E, 0x8C, 0xB7, 0xC6,
+0x8F, 0xA4, 0xD2, 0xD5, 0x33, 0xDE, 0xD4, 0xCD, 0x13, 0xAD, 0x08, 0x42, 0x24, 0x21, 0xBE, 0xA6,
+0xC1, 0xCD, 0x7B, 0xB4, 0xB5, 0x95, 0xC3, 0x36, 0xBE, 0x4A, 0x5B, 0xE5, 0x29, 0x83, 0x19, 0xA6,
+0xC7, 0xA4, 0x21, 0xEA, 0x4A, 0x6C, 0x5B, 0xEE, 0x6B, 0x68, 0x3A, 0x64, 0x11, 0xC5, 0x19, 0x27,
+0x22, 0x96, 0xC0, 0xA5, 0x11, 0x72, 0xC0, 0x06, 0x2A, 0xBA, 0xA1, 0xA9, 0xA9, 0xAE, 0xAF, 0xAE,
+0x8A, 0xC3, 0x85, 0x22, 0x27, 0x23, 0xC7, 0x23, 0x07, 0x2C, 0xA3, 0xC4, 0x89, 0x63, 0x4F, 0xF4,
+0xA2, 0xC8, 0x20, 0xE8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x9A, 0xC0, 0x41, 0xE0, 0x6E,
+0xC4, 0x5A, 0xFF, 0xF3, 0xBD, 0xAC, 0x8C, 0xE9, 0x63, 0x47, 0x33, 0x87, 0x97, 0xC3, 0x47, 0x12,
+0x64, 0x09, 0x86, 0x19, 0xE7, 0x29, 0x94, 0xA9, 0xAF, 0xC0, 0x84, 0x29, 0xAF, 0xBB, 0xC0, 0x65,
+0x19, 0x9F, 0xC0, 0xC7, 0x19, 0xBE, 0x00, 0xBF, 0xAE, 0x4B, 0x00, 0xBE, 0xA6, 0x95, 0xC0, 0x28,
+0x32, 0x53, 0x4B, 0xBF, 0x57, 0xA1, 0xAF, 0xBF, 0xC1, 0x87, 0x29, 0x04, 0x19, 0x91, 0xC0, 0x44,
+0x21, 0xA6, 0xC0, 0x65, 0x29, 0x55, 0x9A, 0x91, 0x4D, 0x00, 0xC0, 0x45, 0x21, 0x99, 0x7E, 0xC0,
+0x64, 0x21, 0x69, 0x7D, 0xC0, 0x07, 0x3A, 0x4E, 0x7F, 0x9A, 0x6F, 0x4B, 0x63, 0xCC, 0xA1, 0x00,
+0xAA, 0x52, 0x2F, 0x8C, 0x2B, 0x73, 0xA9, 0x6A, 0x94, 0xC5, 0xB7, 0xF6, 0x2F, 0xCD, 0x67, 0x93,
+0x08, 0xAC, 0x4D, 0xCD, 0xAE, 0xD5, 0xF0, 0xDD, 0xA6, 0x6C, 0xAB, 0x6C, 0xA9, 0xA9, 0x01, 0x65,
+0xAE, 0x96, 0xC0, 0x50, 0xDE, 0xBA, 0xAB, 0xC5, 0x94, 0xF6, 0x0F, 0xC5, 0x2D, 0x9C, 0xB8, 0xDE,
+0x36, 0xBE, 0x88, 0x3A, 0x82, 0x68, 0xC2, 0x40, 0x00, 0xC0, 0x28, 0xA6, 0x93, 0xBF, 0xC5, 0x8F,
+0xA4, 0xB2, 0xA4, 0x4C, 0x73, 0xAD, 0x83, 0xB0, 0x9C, 0xEE, 0x8B, 0xBE, 0xC1, 0xD0, 0xAC, 0xB1,
+0xC5, 0xBE, 0xC1, 0x56, 0xDE, 0x74, 0xB5, 0x5A, 0xC4, 0x61, 0x08, 0x08, 0x42, 0xEA, 0x62, 0x53,
+0xB5, 0x98, 0xDE, 0x9E, 0xC3, 0x3A, 0xE7, 0xED, 0x6B, 0xA8, 0x42, 0xC4, 0x21, 0x96, 0x91, 0xC1,
+0x26, 0x2A, 0xA8, 0x3A, 0xAB, 0x75, 0xC0, 0x27, 0x2A, 0x7A, 0xC0, 0x26, 0x22, 0xA6, 0x9A, 0xBB,
+0x95, 0xB1, 0xC2, 0x27, 0x32, 0x68, 0x3A, 0xC6, 0x29, 0x94, 0xC0, 0x46, 0x32, 0x4E, 0xC4, 0xC5,
+0x11, 0x66, 0x12, 0x27, 0x1B, 0xC7, 0x1B, 0x07, 0x24, 0xB7, 0xC4, 0x89, 0x63, 0x4F, 0xF4, 0xA2,
+0xD0, 0x20, 0xE8, 0x00, 0xF8, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0xC7, 0x40, 0xF0, 0x41, 0xD8, 0x2C,
+0xFB, 0x7A, 0xFF, 0x34, 0xC6, 0x8C, 0x84, 0xC9, 0x63, 0x48, 0x43, 0x86, 0xC3, 0xC8, 0x1A, 0x06,
+0x0A, 0x86, 0x09, 0xA7, 0x19, 0xBE, 0x7C, 0x00, 0x91, 0xBF, 0xC0, 0xE7, 0x29, 0x68, 0xAE, 0x4D,
+0x61, 0x4D, 0xBF, 0x00, 0x4B, 0x00, 0xC0, 0x28, 0x32, 0x00, 0x53, 0x4B, 0x77, 0x53, 0x9A, 0x00,
+0xC0, 0x48, 0x32, 0x4B, 0x7C, 0xC2, 0x08, 0x32, 0xA6, 0x31, 0x24, 0x21, 0x7D, 0xC0, 0x45, 0x29,
+0xBE, 0xC1, 0x04, 0x21, 0x65, 0x29, 0x00, 0x95, 0xAF, 0xC0, 0x03, 0x11, 0x5A, 0x7F, 0x55, 0xC0,
+0x86, 0x29, 0x00, 0xC0, 0xE7, 0x39, 0x96, 0x00, 0x77, 0x5F, 0x95, 0xC0, 0x86, 0x21, 0x00, 0xC5,
+0x82, 0x08, 0x28, 0x42, 0x0F, 0x84, 0xA9, 0x62, 0xEA, 0x6A, 0x16, 0xDE, 0xB9, 0xC3, 0x0E, 0xCD,
+0x04, 0x8B, 0xE7, 0xA3, 0x8D, 0xD5, 0xAF, 0xAF, 0xC0, 0x11, 0xDE, 0x95, 0x78, 0xBA, 0xAE, 0xA9,
+0x95, 0x00, 0xAB, 0xAE, 0xAF, 0x00, 0xBE, 0xA6, 0xA7, 0xC4, 0x50, 0xC5, 0x2D, 0x9C, 0x77, 0xDE,
+0xD5, 0xB5, 0x68, 0x3A, 0x5C, 0xD0, 0xE3, 0x08, 0x81, 0x08, 0xA0, 0x20, 0x08, 0xA4, 0x66, 0x93,
+0x6F, 0x9C, 0x35, 0xAD, 0x51, 0x94, 0x8D, 0x7B, 0xCE, 0x83, 0x2E, 0x94, 0x8F, 0x9C, 0xEF, 0xAC,
+0x70, 0xBD, 0x13, 0xCE, 0x11, 0xA5, 0xEE, 0x83, 0x55, 0x49, 0xC3, 0xA9, 0x4A, 0xEA, 0x5A, 0x12,
+0xAD, 0xB8, 0xE6, 0x9A, 0xC3, 0x9C, 0xEF, 0xB0, 0x84, 0xA8, 0x3A, 0xE5, 0x21, 0x96, 0x46, 0x00,
+0x7C, 0x95, 0xBE, 0x50, 0xAE, 0xA1, 0xA5, 0x75, 0x9B, 0xA6, 0x6D, 0xC0, 0x06, 0x2A, 0x00, 0x72,
+0x00, 0xA5, 0xAE, 0xAE, 0xC2, 0x45, 0x0A, 0x27, 0x1B, 0x08, 0x2C, 0xA9, 0xC4, 0x09, 0x34, 0xAA,
+0x6B, 0x0E, 0xF4, 0xA2, 0xD0, 0x41, 0xF0, 0xB1, 0xAE, 0x96, 0x5D, 0xE0, 0x0F, 0xC1, 0x40, 0xF0,
+0x41, 0xD8, 0x6E, 0xC4, 0x7A, 0xFF, 0x34, 0xC6, 0x6C, 0x84, 0xC9, 0x63, 0x28, 0x43, 0x9F, 0xC2,
+0x29, 0x23, 0x68, 0x12, 0xA6, 0x11, 0xA2, 0xBA, 0xAE, 0xC0, 0xE7, 0x21, 0x6F, 0xBE, 0x4B, 0x99,
+0x9A, 0xA6, 0xC1, 0x64, 0x11, 0x07, 0x22, 0xBF, 0x00, 0x4B, 0x02, 0x77, 0xC0, 0x08, 0x32, 0x91,
+0xC0, 0x08, 0x2A, 0x4B, 0x96, 0x4B, 0x48, 0xC0, 0x69, 0x3A, 0xA1, 0xC0, 0xA6, 0x31, 0xA6, 0xC1,
+0x49, 0x4A, 0xE7, 0x41, 0xAF, 0x91, 0xAE, 0xAF, 0xC0, 0xA6, 0x29, 0xBE, 0x7F, 0x42, 0x91, 0xC1,
+0x24, 0x21, 0x28, 0x42, 0xAF, 0xC4, 0xE3, 0x18, 0x86, 0x29, 0xEB, 0x52, 0xE7, 0x31, 0x85, 0x21,
+0x7A, 0x77, 0xA6, 0xC0, 0x82, 0x08, 0x60, 0xC1, 0x0F, 0x84, 0xEA, 0x6A, 0xBE, 0x5B, 0xBD, 0xC3,
+0xEE, 0xCC, 0x04, 0x8B, 0xE7, 0xA3, 0x8D, 0xD5, 0x9F, 0xBF, 0xC0, 0xF1, 0xD5, 0xA6, 0xBE, 0xAE,
+0xBE, 0xA9, 0x96, 0x01, 0xAF, 0x01, 0xC0, 0x71, 0xE6, 0xA6, 0xAB, 0xC4, 0x2F, 0xC5, 0x2D, 0x9C,
+0x77, 0xDE, 0x57, 0xC6, 0x48, 0x3A, 0x9B, 0xC9, 0x65, 0x19, 0xC1, 0x18, 0x00, 0x31, 0x49, 0xB4,
+0x66, 0x93, 0x6F, 0x9C, 0x75, 0xB5, 0x14, 0xAD, 0x91, 0x9C, 0xD2, 0xA4, 0xBD, 0xBD, 0xAD, 0xC0,
+0x53, 0xD6, 0x92, 0xC2, 0xD0, 0x9C, 0x50, 0x8C, 0xE7, 0x39, 0x75, 0x80, 0xB5, 0xC1, 0x12, 0xAD,
+0x3A, 0xF7, 0x9F, 0xC2, 0xB8, 0xD6, 0x2A, 0x5B, 0x26, 0x2A, 0x96, 0x00, 0x91, 0x96, 0xBF, 0xBE,
+0x7C, 0xC0, 0x06, 0x2A, 0x50, 0xA1, 0xBD, 0x96, 0xC0, 0x08, 0x22, 0x00, 0xC0, 0xC5, 0x21, 0xA5,
+0xC0, 0xE5, 0x21, 0x9A, 0xC0, 0x07, 0x22, 0x72, 0x69, 0xC3, 0xE4, 0x19, 0x45, 0x0A, 0x27, 0x1B,
+0xC8, 0x2B, 0x99, 0xC4, 0x09, 0x34, 0xAA, 0x6B, 0x0E, 0xF4, 0x82, 0xD0, 0x40, 0xF0, 0xB2, 0xAE,
+0x5D, 0xE0, 0x10, 0x64, 0xC5, 0x42, 0xD8, 0x4C, 0xFB, 0x7A, 0xFF, 0x34, 0xBE, 0x6C, 0x84, 0xEA,
+0x63, 0x52, 0xC0, 0x29, 0x2B, 0x86, 0xC1, 0x88, 0x12, 0xE7, 0x19, 0x7C, 0x7F, 0xC0, 0x07, 0x32,
+0x7C, 0x00, 0x7F, 0x00, 0x7C, 0x4D, 0x61, 0x00, 0xC0, 0xE7, 0x21, 0x50, 0xAF, 0xA6, 0x5A, 0xAE,
+0x00, 0x53, 0x92, 0x00, 0x57, 0xA5, 0x57, 0x5C, 0x50, 0xC5, 0x0B, 0x4B, 0xE7, 0x31, 0x65, 0x29,
+0x08, 0x42, 0x4D, 0x6B, 0xAA, 0x5A, 0x96, 0x74, 0x95, 0x5E, 0x42, 0x91, 0x00, 0xAF, 0x6E, 0x51,
+0xC1, 0xEF, 0x7B, 0xD3, 0x9C, 0x74, 0xC2, 0x4D, 0x63, 0x14, 0x9D, 0x2C, 0x5B, 0x4B, 0x5F, 0x4B,
+0xC4, 0x86, 0x29, 0x62, 0x00, 0x08, 0x3A, 0xEF, 0x83, 0xCA, 0x62, 0xBE, 0xC2, 0x16, 0xD6, 0x55,
+0xE6, 0xEE, 0xC4, 0x47, 0xC1, 0xE8, 0xA3, 0x8E, 0xD5, 0x9E, 0xBF, 0xAB, 0x96, 0xBF, 0xBE, 0xBE,
+0xAE, 0x00, 0x95, 0xAB, 0x00, 0x9A, 0x78, 0xC0, 0x50, 0xE6, 0xAB, 0xA7, 0xC2, 0x0F, 0xC5, 0x2D,
+0x9C, 0x57, 0xD6, 0x8A, 0x49, 0xC7, 0x28, 0x2A, 0x65, 0x19, 0x80, 0x08, 0xE0, 0x28, 0x08, 0xA4,
+0x04, 0x83, 0xEC, 0x93, 0x33, 0xB5, 0xBF, 0x94, 0xBF, 0xA9, 0xC0, 0x2F, 0xB5, 0xA9, 0xC0, 0x32,
+0xD6, 0x96, 0xC0, 0x72, 0xBD, 0x83, 0xC1, 0xEB, 0x62, 0x69, 0x4A, 0x42, 0xC9, 0x23, 0x21, 0x90,
+0x9C, 0x1A, 0xEF, 0xBD, 0xFF, 0x57, 0xC6, 0xE9, 0x4A, 0x88, 0x3A, 0x06, 0x22, 0x84, 0x11, 0xE6,
+0x21, 0x91, 0xC1, 0x07, 0x2A, 0x48, 0x32, 0x50, 0xA5, 0x01, 0x64, 0x96, 0xAB, 0x96, 0x6F, 0xBD,
+0x50, 0xAE, 0x50, 0x44, 0xA9, 0x9E, 0xC3, 0x45, 0x12, 0x07, 0x1B, 0xC9, 0x2B, 0x09, 0x2C, 0xBA,
+0xC3, 0xAA, 0x6B, 0x0E, 0xF4, 0x82, 0xD0, 0x20, 0xF0, 0xB6, 0xAE, 0x5D, 0xE0, 0x10, 0xC8, 0x40,
+0xF0, 0x42, 0xD8, 0x4D, 0xFB, 0x7A, 0xFF, 0x13, 0xBE, 0x6C, 0x7C, 0xEA, 0x63, 0x69, 0x3B, 0x08,
+0x23, 0x81, 0xA2, 0xC0, 0x26, 0x22, 0x44, 0xA0, 0x00, 0xAF, 0x00, 0xB5, 0x92, 0x9E, 0x44, 0xC0,
+0x48, 0x32, 0xAF, 0x64, 0x01, 0xA6, 0x50, 0x00, 0xA6, 0xA6, 0x00, 0x4B, 0xBF, 0x46, 0x5F, 0x00,
+0xC0, 0xA6, 0x19, 0x5F, 0xBA, 0xC5, 0x45, 0x21, 0xA6, 0x31, 0xCB, 0x5A, 0x08, 0x42, 0x49, 0x4A,
+0xAA, 0x52, 0x48, 0x99, 0xC0, 0xC7, 0x31, 0x42, 0xAF, 0x00, 0xC0, 0x85, 0x29, 0x61, 0x48, 0x00,
+0xC0, 0x45, 0x29, 0x74, 0xC0, 0x8D, 0x6B, 0x53, 0xC0, 0xA6, 0x29, 0x53, 0xC0, 0x65, 0x21, 0xAB,
+0xC3, 0x82, 0x08, 0x29, 0x42, 0xEF, 0x7B, 0xAA, 0x5A, 0xB5, 0xC3, 0xD5, 0xCD, 0x56, 0xE6, 0xEE,
+0xC4, 0x05, 0x8B, 0x4F, 0xC0, 0x6E, 0xCD, 0xAE, 0xAF, 0xBF, 0x96, 0xBB, 0x6B, 0x73, 0x7B, 0x40,
+0x9A, 0xA6, 0x00, 0x96, 0x00, 0xC0, 0x30, 0xDE, 0xBF, 0xA7, 0xCD, 0xEF, 0xBC, 0x6E, 0xA4, 0x77,
+0xDE, 0xF6, 0xBD, 0x06, 0x32, 0x48, 0x32, 0x85, 0x19, 0xC1, 0x10, 0x41, 0x31, 0x28, 0xA4, 0xA6,
+0x9B, 0x89, 0x8B, 0xB0, 0xA4, 0x11, 0xB5, 0xA6, 0xBD, 0x95, 0x94, 0xA9, 0xC5, 0xF0, 0xCD, 0x73,
+0xDE, 0xF4, 0xCD, 0xB0, 0x9C, 0xA6, 0x39, 0x44, 0x29, 0x95, 0x95, 0xC8, 0xC9, 0x5A, 0x2F, 0x94,
+0x13, 0xA5, 0x50, 0x84, 0x27, 0x3A, 0xCA, 0x42, 0x07, 0x2A, 0x64, 0x11, 0x27, 0x2A, 0x91, 0xA2,
+0xC0, 0xE7, 0x29, 0x64, 0xA5, 0x50, 0x64, 0x9A, 0xC0, 0xC7, 0x19, 0xAF, 0xC0, 0x49, 0x32, 0x58,
+0xA0, 0x96, 0xA5, 0x01, 0xAD, 0x9E, 0xC3, 0x44, 0x1A, 0xE6, 0x1A, 0x88, 0x23, 0xC9, 0x2B, 0xBE,
+0xC4, 0xAA, 0x6B, 0x0E, 0xF4, 0x82, 0xD0, 0x20, 0xE8, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x10, 0xC0,
+0x40, 0xF0, 0x69, 0xC5, 0x6D, 0xFB, 0x7B, 0xFF, 0xF3, 0xBD, 0x4B, 0x7C, 0xEA, 0x63, 0x49, 0x2B,
+0x96, 0x90, 0xC3, 0x65, 0x1A, 0xE3, 0x21, 0x82, 0x29, 0xC3, 0x39, 0xBE, 0xC0, 0x65, 0x52, 0x95,
+0xC0, 0xC3, 0x41, 0x96, 0xC1, 0xC5, 0x31, 0x06, 0x32, 0x58, 0x5F, 0xC0, 0x89, 0x3A, 0xA6, 0x95,
+0x5F, 0x00, 0x53, 0xA6, 0x5A, 0xBE, 0x5F, 0x00, 0x77, 0xC0, 0xE7, 0x29, 0x5F, 0xC0, 0x86, 0x19,
+0xA5, 0x5A, 0xC3, 0x24, 0x21, 0x65, 0x29, 0x08, 0x42, 0xA6, 0x39, 0x60, 0xC0, 0x8A, 0x52, 0x99,
+0x79, 0x62, 0x4E, 0xC0, 0x85, 0x21, 0x7A, 0xA5, 0xC0, 0xC3, 0x10, 0xBE, 0xC2, 0x86, 0x31, 0x07,
+0x42, 0x49, 0x4A, 0x99, 0x6E, 0x4E, 0x46, 0x63, 0xA6, 0xC3, 0xE3, 0x10, 0x8A, 0x4A, 0x30, 0x84,
+0xCA, 0x62, 0x95, 0xC5, 0xB5, 0xC5, 0x35, 0xDE, 0xEE, 0xC4, 0xE5, 0x82, 0xC8, 0x9B, 0x6E, 0xCD,
+0xAF, 0xC0, 0xD0, 0xD5, 0xAB, 0x96, 0xA6, 0xBD, 0xBE, 0xC0, 0x11, 0xDE, 0xBE, 0x9A, 0x78, 0xA6,
+0x64, 0x00, 0xC0, 0x10, 0xDE, 0x40, 0xAB, 0xC4, 0xEE, 0xBC, 0x8E, 0xAC, 0x97, 0xDE, 0xB4, 0xB5,
+0x47, 0x32, 0xAF, 0x68, 0xC6, 0xC1, 0x10, 0x20, 0x29, 0x87, 0x8B, 0xE7, 0x9B, 0x48, 0x83, 0xEC,
+0x93, 0x2D, 0x9C, 0xA5, 0x00, 0xAD, 0xA9, 0xAD, 0xC0, 0x8E, 0xC5, 0x93, 0xC6, 0x51, 0xBD, 0x90,
+0x9C, 0xA5, 0x39, 0x40, 0x08, 0x81, 0x10, 0xA5, 0x31, 0x68, 0x52, 0x96, 0xC0, 0x89, 0x4A, 0x95,
+0xC2, 0x64, 0x19, 0x89, 0x3A, 0x27, 0x2A, 0x4B, 0x95, 0xC2, 0x28, 0x32, 0xC6, 0x29, 0x65, 0x19,
+0x7A, 0x95, 0x99, 0xC1, 0x48, 0x32, 0xE7, 0x21, 0x96, 0x48, 0xB9, 0xC0, 0xA3, 0x29, 0xBD, 0xCF,
+0xC6, 0x5A, 0xEA, 0x7B, 0x4B, 0x8C, 0xE9, 0x7B, 0x05, 0x63, 0x83, 0x42, 0x83, 0x2A, 0xE5, 0x22,
+0x88, 0x2B, 0x2A, 0x3C, 0xC9, 0x2B, 0xAA, 0x6B, 0x0E, 0xF4, 0x82, 0xD0, 0x20, 0xE8, 0x00, 0xF8,
+0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x9E, 0xC6, 0x42, 0xD8, 0x6D, 0xFB, 0x7B, 0xFF, 0xF3, 0xB5, 0x4B,
+0x7C, 0x0A, 0x64, 0x29, 0x2B, 0x9E, 0xCD, 0xC6, 0x1A, 0x02, 0x12, 0xA1, 0x21, 0xA4, 0x5A, 0x2A,
+0x94, 0x4F, 0xBD, 0xB4, 0xE6, 0x52, 0xDE, 0x2F, 0xBD, 0x89, 0x83, 0x25, 0x4A, 0x22, 0x21, 0x64,
+0x21, 0x48, 0x3A, 0x55, 0xA2, 0x96, 0xBA, 0x77, 0xA6, 0x02, 0x91, 0x4B, 0x46, 0x68, 0x4B, 0xAE,
+0x7C, 0xB2, 0xC0, 0x24, 0x21, 0xBF, 0xC0, 0xC7, 0x39, 0x00, 0xC0, 0x28, 0x42, 0x74, 0x65, 0xC0,
+0xAA, 0x52, 0x9E, 0xC2, 0x69, 0x42, 0xC6, 0x29, 0x28, 0x3A, 0x00, 0xC3, 0x24, 0x19, 0x41, 0x08,
+0x85, 0x31, 0xAA, 0x5A, 0x91, 0xC0, 0xC6, 0x39, 0x85, 0xC0, 0x07, 0x32, 0x7A, 0x77, 0x52, 0x00,
+0xC2, 0xCB, 0x52, 0x10, 0x84, 0xCA, 0x5A, 0x58, 0xC7, 0xD5, 0xCD, 0x35, 0xDE, 0x0F, 0xC5, 0xE5,
+0x82, 0xA7, 0x93, 0x4E, 0xCD, 0x8F, 0xCD, 0xF0, 0xD5, 0xAB, 0x91, 0xB7, 0xAD, 0xAE, 0xBE, 0xAE,
+0xAB, 0x00, 0x92, 0x00, 0xBE, 0x78, 0xBE, 0xA7, 0xC4, 0xAD, 0xB4, 0xCF, 0xB4, 0x97, 0xDE, 0xD4,
+0xB5, 0x47, 0x3A, 0x9F, 0xC6, 0xA6, 0x19, 0xC1, 0x10, 0xE0, 0x20, 0xA4, 0x6A, 0x46, 0x83, 0xEA,
+0x93, 0x2C, 0x9C, 0xAB, 0x90, 0xA6, 0xC0, 0x0B, 0x9C, 0x99, 0xC0, 0x4A, 0x9C, 0x00, 0xC8, 0x88,
+0x83, 0xF0, 0xAC, 0x77, 0xDE, 0x70, 0x94, 0xA6, 0x39, 0x23, 0x21, 0x89, 0x52, 0xB2, 0x94, 0xEE,
+0x7B, 0x9A, 0x96, 0xC2, 0x28, 0x32, 0x69, 0x3A, 0x86, 0x21, 0x80, 0xBB, 0xC1, 0xC7, 0x29, 0x65,
+0x21, 0x00, 0xC2, 0x89, 0x42, 0xEB, 0x52, 0x27, 0x32, 0x68, 0xC8, 0xC6, 0x19, 0x48, 0x2A, 0xE6,
+0x21, 0x21, 0x19, 0xE2, 0x39, 0x29, 0x8C, 0x10, 0xCE, 0xF3, 0xE6, 0x55, 0xFF, 0x99, 0xC5, 0x6F,
+0xDE, 0x0A, 0xA5, 0xA6, 0x63, 0xC3, 0x2A, 0x05, 0x23, 0xC8, 0x33, 0x96, 0xC3, 0x89, 0x63, 0x0E,
+0xF4, 0x82, 0xD0, 0x20, 0xF0, 0x5D, 0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x9E, 0xC6, 0x42, 0xD8, 0x6D,
+0xFB, 0x7B, 0xFF, 0xD2, 0xB5, 0x2B, 0x7C, 0x0B, 0x64, 0x08, 0x2B, 0x9A, 0xC5, 0x84, 0x22, 0x42,
+0x32, 0x25, 0x63, 0x0C, 0xB5, 0x92, 0xEE, 0x34, 0xFF, 0x59, 0xC5, 0xF3, 0xFE, 0x35, 0xFF, 0xD5,
+0xF6, 0x71, 0xC5, 0x29, 0x73, 0xA4, 0x39, 0x86, 0xC0, 0xC6, 0x29, 0x9A, 0x43, 0xC0, 0x07, 0x2A,
+0x4B, 0x77, 0xA6, 0xBE, 0x00, 0x72, 0xC1, 0x8E, 0x63, 0x10, 0x74, 0x73, 0x77, 0x43, 0x7C, 0xB6,
+0xA6, 0xC0, 0xE3, 0x18, 0x91, 0xC2, 0x45, 0x29, 0x08, 0x42, 0x69, 0x4A, 0xAE, 0x96, 0xC0, 0xEB,
+0x52, 0xAE, 0x00, 0xC5, 0x4C, 0x5B, 0xAA, 0x4A, 0x03, 0x19, 0x00, 0x00, 0x45, 0x31, 0x28, 0x52,
+0x9A, 0x45, 0x95, 0x53, 0xA6, 0xC1, 0x28, 0x3A, 0x65, 0x21, 0x91, 0xCA, 0x08, 0x3A, 0xEB, 0x5A,
+0x27, 0x4A, 0xEA, 0x62, 0x16, 0xCE, 0x35, 0xDE, 0x2F, 0xC5, 0xE5, 0x7A, 0x87, 0x93, 0x2D, 0xC5,
+0xAF, 0xCD, 0x78, 0xAB, 0xC0, 0xB0, 0xD5, 0xAB, 0x5F, 0x00, 0xC0, 0xF0, 0xD5, 0xBE, 0x00, 0xA7,
+0x96, 0x42, 0x00, 0xA9, 0xAF, 0x92, 0xC5, 0x6D, 0xAC, 0xCF, 0xAC, 0x77, 0xDE, 0x36, 0xC6, 0x27,
+0x32, 0x69, 0x32, 0x00, 0xC0, 0x85, 0x21, 0xB0, 0xC2, 0xA6, 0x62, 0x68, 0x83, 0x2C, 0x94, 0xA6,
+0xAB, 0xC0, 0xAB, 0x8B, 0x95, 0xC0, 0xCA, 0x8B, 0x95, 0x00, 0xC4, 0x06, 0x6B, 0x48, 0x6B, 0x31,
+0xAD, 0x37, 0xCE, 0x70, 0x8C, 0x62, 0xC2, 0x23, 0x19, 0x64, 0x21, 0xA6, 0x29, 0x75, 0x62, 0xC3,
+0x89, 0x42, 0xA6, 0x21, 0xCB, 0x42, 0x0C, 0x4B, 0xA1, 0xC0, 0x8E, 0x63, 0x91, 0xC5, 0xEC, 0x52,
+0x8E, 0x6B, 0xB6, 0xAD, 0x1B, 0xD7, 0x53, 0x9D, 0x48, 0x32, 0x7C, 0xBE, 0xC3, 0xA3, 0x29, 0x43,
+0x4A, 0xEB, 0xA4, 0x33, 0xF7, 0xBE, 0xC3, 0x8F, 0xE6, 0x2D, 0xDE, 0xAF, 0xEE, 0xEF, 0xF6, 0x86,
+0xC5, 0x0C, 0xBE, 0x67, 0x74, 0x44, 0x3B, 0x04, 0x23, 0x87, 0x2B, 0x89, 0x63, 0x5C, 0xC1, 0xA2,
+0xD8, 0x20, 0xF0, 0xB6, 0xAE, 0x5D, 0xE0, 0x0F, 0x62, 0x9E, 0xC6, 0x62, 0xD8, 0x8D, 0xFB, 0x7B,
+0xFF, 0xD2, 0xB5, 0x2B, 0x7C, 0x0A, 0x64, 0xA6, 0x22, 0xA9, 0xC5, 0x83, 0x32, 0x65, 0x63, 0x4C,
+0xBD, 0xF3, 0xFE, 0x92, 0xF6, 0x2C, 0xC5, 0xBE, 0xC0, 0xEB, 0xC4, 0x71, 0xCA, 0x93, 0xF6, 0x57,
+0xFF, 0x91, 0xCD, 0xE7, 0x6A, 0x63, 0x31, 0xE6, 0x29, 0x08, 0x2A, 0xAA, 0x42, 0x6D, 0x5B, 0xEF,
+0x6B, 0x30, 0x74, 0xBF, 0xC0, 0x92, 0x84, 0x4E, 0x62, 0xC4, 0x9E, 0xE7, 0xFF, 0xF7, 0xF3, 0x8C,
+0x69, 0x3A, 0xC7, 0x21, 0x77, 0xA1, 0xC4, 0xA6, 0x31, 0xC3, 0x10, 0x41, 0x00, 0x45, 0x29, 0x28,
+0x42, 0xAF, 0xBE, 0xC0, 0xAA, 0x4A, 0x91, 0xC0, 0xE7, 0x29, 0x77, 0xC1, 0x07, 0x32, 0x48, 0x3A,
+0x7D, 0xA5, 0xC0, 0xC6, 0x41, 0x68, 0xAE, 0x95, 0xC1, 0x64, 0x29, 0xA5, 0x29, 0xBF, 0xAF, 0x96,
+0xC1, 0xE4, 0x10, 0x24, 0x21, 0x7D, 0xC9, 0x23, 0x29, 0xA8, 0x5A, 0x36, 0xCE, 0x56, 0xDE, 0x50,
+0xC5, 0xE5, 0x7A, 0x67, 0x8B, 0x2D, 0xBD, 0xAF, 0xCD, 0x11, 0xDE, 0xAF, 0xC0, 0xD1, 0xD5, 0x00,
+0xA5, 0xA9, 0xAE, 0xBF, 0xAE, 0xA7, 0xA6, 0xC0, 0x53, 0xEE, 0xA6, 0x99, 0x00, 0xC3, 0xD2, 0xDD,
+0x4D, 0xA4, 0xCF, 0xAC, 0x57, 0xD6, 0x9E, 0xC0, 0x85, 0x21, 0x57, 0xC0, 0xCB, 0x42, 0x46, 0x62,
+0xC2, 0x66, 0x5A, 0xE7, 0x6A, 0x86, 0x5A, 0x96, 0xBF, 0xC0, 0x26, 0x52, 0x91, 0xAE, 0x80, 0xA5,
+0xC3, 0x03, 0x42, 0xAB, 0x73, 0x12, 0x9D, 0x8D, 0x6B, 0x6B, 0x00, 0xC1, 0xC5, 0x29, 0x23, 0x11,
+0xA2, 0xAF, 0xC5, 0x65, 0x19, 0xE7, 0x29, 0x28, 0x32, 0x34, 0x95, 0x7E, 0xDF, 0xBF, 0xEF, 0xA5,
+0xAB, 0xC0, 0xDF, 0xF7, 0x55, 0xC0, 0xDF, 0xEF, 0xBE, 0xC2, 0x7C, 0xDF, 0x0F, 0x74, 0x84, 0x21,
+0xA1, 0x7D, 0xC1, 0x8A, 0x9C, 0xB1, 0xEE, 0x95, 0xCE, 0xAD, 0xCD, 0xED, 0xCD, 0x2E, 0xDE, 0xAC,
+0xD5, 0x69, 0xCD, 0x2B, 0xDE, 0x0F, 0xEF, 0x2D, 0xC6, 0x26, 0x6C, 0xE2, 0x32, 0x66, 0x2B, 0x89,
+0x63, 0x0F, 0xF4, 0xA2, 0xD8, 0x41, 0xF0, 0xB1, 0xAE, 0x5D, 0xE0, 0x10, 0xCB, 0x40, 0xF0, 0x62,
+0xE0, 0xAE, 0xFB, 0x3A, 0xFF, 0xF3, 0xB5, 0x2B, 0x7C, 0xA9, 0x5B, 0xE6, 0x32, 0x22, 0x1A, 0xE3,
+0x4A, 0x8C, 0xBD, 0xEE, 0xD5, 0xB6, 0xC1, 0x72, 0xEE, 0xB3, 0xF6, 0x4D, 0xC3, 0xB6, 0xFF, 0x51,
+0xEE, 0xCB, 0xBC, 0x8E, 0xD5, 0x60, 0xC2, 0x8F, 0xC5, 0x81, 0x31, 0xC5, 0x29, 0x77, 0x4F, 0x6E,
+0x00, 0x9A, 0x6E, 0x02, 0x66, 0x6E, 0x6B, 0xC1, 0x50, 0x74, 0x45, 0x11, 0x4B, 0xC0, 0x86, 0x29,
+0x00, 0xA5, 0x91, 0x69, 0xC1, 0x28, 0x42, 0xAA, 0x52, 0x95, 0xC1, 0xCA, 0x4A, 0xC6, 0x29, 0x77,
+0x7F, 0xC1, 0x65, 0x21, 0xA6, 0x29, 0x79, 0xC2, 0xCA, 0x52, 0x44, 0x31, 0x07, 0x4A, 0xAF, 0xC0,
+0x65, 0x31, 0x99, 0xC4, 0x27, 0x3A, 0x69, 0x42, 0x08, 0x32, 0x49, 0x3A, 0x66, 0x21, 0x75, 0xC0,
+0x48, 0x4A, 0x5E, 0xC1, 0xC9, 0x62, 0x77, 0xD6, 0xA4, 0xB0, 0xC4, 0xC9, 0x93, 0x05, 0x7B, 0x4A,
+0xA4, 0xAF, 0xCD, 0x11, 0xDE, 0xBF, 0x96, 0xC0, 0xB0, 0xD5, 0xAE, 0xA9, 0xAE, 0x00, 0xAB, 0xBA,
+0xAB, 0xBF, 0x00, 0xC0, 0x94, 0xEE, 0xA6, 0xC2, 0x2F, 0xBD, 0x8E, 0xAC, 0x72, 0xBD, 0x6E, 0xC4,
+0x16, 0xBE, 0xC6, 0x29, 0x66, 0x11, 0xE8, 0x21, 0x09, 0x32, 0xA0, 0xC1, 0x02, 0x29, 0x42, 0x31,
+0x81, 0xAF, 0xC3, 0x64, 0x29, 0xE2, 0x18, 0x23, 0x21, 0x84, 0x31, 0x47, 0xC0, 0x83, 0x29, 0x96,
+0xC0, 0xA4, 0x29, 0x96, 0x7F, 0xC0, 0x69, 0x3A, 0xAE, 0xC0, 0x27, 0x2A, 0xA6, 0x77, 0x00, 0xC6,
+0x08, 0x32, 0x49, 0x3A, 0xCB, 0x42, 0x71, 0x7C, 0x39, 0xBE, 0xFC, 0xD6, 0x9A, 0xCE, 0x92, 0x90,
+0xC0, 0x59, 0xC6, 0x99, 0x00, 0xC1, 0x95, 0xA5, 0x0A, 0x53, 0x62, 0xC3, 0x01, 0x29, 0x27, 0x73,
+0xB2, 0xE6, 0x50, 0xDE, 0x00, 0xC1, 0x55, 0xF7, 0xF9, 0xFF, 0xA1, 0xA4, 0xCA, 0xD1, 0xF6, 0x4A,
+0xCD, 0x89, 0xC5, 0xEF, 0xE6, 0x29, 0xA5, 0x63, 0x4B, 0xE4, 0x22, 0x69, 0x63, 0x0E, 0xF4, 0x62,
+0xD0, 0x40, 0xF0, 0xB2, 0xE0, 0x12, 0x64, 0xCD, 0x62, 0xD8, 0xAE, 0xFB, 0x5A, 0xFF, 0x13, 0xBE,
+0x4B, 0x7C, 0xA8, 0x5B, 0xA4, 0x32, 0x42, 0x2A, 0xC5, 0x73, 0xED, 0xCD, 0x0E, 0xDE, 0x51, 0xEE,
+0x16, 0xF7, 0x99, 0xFF, 0xAE, 0x76, 0xC5, 0x55, 0xFF, 0x10, 0xDE, 0xCB, 0xBC, 0xCF, 0xD5, 0x92,
+0xEE, 0x67, 0x73, 0x6C, 0xC3, 0xA6, 0x21, 0xEF, 0x6B, 0xB6, 0xA5, 0xF7, 0xB5, 0xAF, 0x91, 0x00,
+0xA5, 0xC0, 0x34, 0x9D, 0x00, 0xAF, 0xC2, 0x92, 0x84, 0x0B, 0x4B, 0x08, 0x32, 0xAE, 0xC0, 0xA6,
+0x29, 0xA5, 0xAB, 0x49, 0xC3, 0x08, 0x42, 0x48, 0x42, 0x89, 0x4A, 0xCA, 0x52, 0x9A, 0xC0, 0x07,
+0x32, 0xA6, 0x53, 0x66, 0x95, 0x7A, 0xB6, 0x00, 0x68, 0xBF, 0xC0, 0xE7, 0x39, 0xA9, 0xC0, 0x68,
+0x42, 0xAF, 0xC0, 0x28, 0x3A, 0x66, 0xC5, 0xE3, 0x10, 0x07, 0x3A, 0x2C, 0x63, 0x88, 0x52, 0x09,
+0x63, 0x56, 0xD6, 0xA5, 0xA0, 0xC6, 0xAC, 0xAC, 0x05, 0x7B, 0x87, 0x8B, 0x6E, 0xCD, 0x11, 0xDE,
+0x90, 0xCD, 0xD1, 0xD5, 0xA5, 0xAE, 0x71, 0x00, 0xAE, 0x71, 0xA6, 0xA7, 0x96, 0xC1, 0xF2, 0xDD,
+0x53, 0xE6, 0x6B, 0xC0, 0xCE, 0xB4, 0x9B, 0xC1, 0xB3, 0xC5, 0x56, 0xD6, 0x86, 0x4E, 0xC0, 0x25,
+0x11, 0x9B, 0xC1, 0x67, 0x19, 0xE9, 0x39, 0xB8, 0xC0, 0x27, 0x4A, 0x9A, 0x9A, 0x6A, 0x49, 0xA9,
+0xC0, 0x07, 0x3A, 0x80, 0xC0, 0x06, 0x32, 0x6F, 0xC2, 0xC9, 0x4A, 0x4C, 0x53, 0xAE, 0x63, 0xAE,
+0x95, 0x95, 0xC0, 0x2B, 0x4B, 0xA2, 0xA6, 0x99, 0x73, 0xC0, 0xE7, 0x29, 0xAF, 0xC0, 0x49, 0x3A,
+0x91, 0xC3, 0x8A, 0x4A, 0x0C, 0x5B, 0x08, 0x3A, 0x86, 0x29, 0x49, 0x5A, 0xAE, 0xC4, 0x44, 0x19,
+0x43, 0x29, 0x82, 0x41, 0x6A, 0xA4, 0xB2, 0xEE, 0x96, 0xC1, 0x56, 0xF7, 0xDA, 0xFF, 0xA7, 0xC0,
+0xFC, 0xFF, 0xA0, 0xC0, 0x55, 0xFF, 0x63, 0xC8, 0xC7, 0xBC, 0x0B, 0xDE, 0xCA, 0xC5, 0x83, 0x5B,
+0xE4, 0x22, 0x69, 0x63, 0x0E, 0xF4, 0x62, 0xD0, 0x40, 0xF0, 0xB2, 0xE0, 0x12, 0x9E, 0xC6, 0x41,
+0xD8, 0xAE, 0xFB, 0x5A, 0xFF, 0x13, 0xBE, 0x4B, 0x7C, 0x88, 0x5B, 0x83, 0x2A, 0xB4, 0xC5, 0x88,
+0x9C, 0x2E, 0xDE, 0x50, 0xE6, 0x56, 0xFF, 0x9B, 0xFF, 0xFE, 0xFF, 0xA9, 0x44, 0x47, 0x52, 0xC6,
+0x0C, 0xC5, 0x48, 0xAC, 0x32, 0xFF, 0x0C, 0xAD, 0xA3, 0x29, 0x45, 0x19, 0xA6, 0x21, 0x7F, 0xAB,
+0x00, 0xC0, 0x45, 0x21, 0x00, 0xC0, 0xA7, 0x29, 0x5E, 0x6E, 0xC0, 0xCB, 0x4A, 0x46, 0x99, 0x73,
+0x46, 0x00, 0x90, 0xBB, 0xC0, 0x28, 0x42, 0xBF, 0x51, 0x00, 0xC2, 0x89, 0x4A, 0x28, 0x3A, 0xA6,
+0x29, 0x7F, 0xAF, 0x6B, 0x00, 0xC1, 0xC6, 0x31, 0x65, 0x29, 0x54, 0xC0, 0x28, 0x4A, 0x00, 0x51,
+0x42, 0x00, 0x85, 0x57, 0x91, 0x91, 0x7E, 0xC1, 0x0F, 0x7C, 0xA8, 0x5A, 0xBE, 0xC0, 0x15, 0xCE,
+0xBD, 0x91, 0xA0, 0xC3, 0xA8, 0x8B, 0x63, 0x62, 0x2A, 0x9C, 0xD0, 0xD5, 0xA7, 0xA9, 0x96, 0x5F,
+0xC0, 0xF0, 0xD5, 0xBE, 0x00, 0x69, 0x64, 0xA2, 0xC1, 0xD2, 0xDD, 0x13, 0xE6, 0x81, 0xC3, 0xCE,
+0xB4, 0x6D, 0xA4, 0x71, 0xBD, 0x35, 0xD6, 0x82, 0x9F, 0xC2, 0x48, 0x3A, 0xA7, 0x21, 0x46, 0x11,
+0xBB, 0xC1, 0xC9, 0x31, 0x66, 0x29, 0xA0, 0x9E, 0x9A, 0xBF, 0x92, 0xA9, 0x00, 0x90, 0xC5, 0x23,
+0x19, 0x64, 0x19, 0xA5, 0x21, 0x28, 0x32, 0x68, 0x32, 0xE6, 0x29, 0x9A, 0xAE, 0xC0, 0x84, 0x19,
+0xAB, 0x70, 0x92, 0xC1, 0xA6, 0x21, 0x44, 0x11, 0xA6, 0xC0, 0x86, 0x21, 0x00, 0xC2, 0x97, 0xAD,
+0x39, 0xBE, 0x51, 0x84, 0x45, 0x7A, 0xC0, 0xE3, 0x10, 0x5C, 0xC6, 0x27, 0x3A, 0x43, 0x31, 0xE3,
+0x51, 0x6F, 0xCD, 0x92, 0xEE, 0xF4, 0xEE, 0xFB, 0xFF, 0x6A, 0x86, 0xC0, 0xFF, 0xFF, 0xA4, 0xCA,
+0x98, 0xFF, 0x13, 0xFF, 0xC7, 0xBC, 0x47, 0xCD, 0x4C, 0xDE, 0x25, 0x7C, 0xE3, 0x22, 0x69, 0x63,
+0x0E, 0xF4, 0x62, 0xD0, 0x40, 0xF0, 0x5D, 0xE0, 0x11, 0xAE, 0x9A, 0xC0, 0x41, 0xD8, 0x50, 0xC4,
+0x7B, 0xFF, 0x34, 0xC6, 0x4B, 0x7C, 0x87, 0x5B, 0x62, 0x2A, 0xB9, 0xC5, 0xC8, 0xA4, 0x2E, 0xE6,
+0x91, 0xEE, 0xFA, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0x80, 0xBD, 0xB8, 0xC7, 0x97, 0xFF, 0x51, 0xE6,
+0xC5, 0x9B, 0xAF, 0xEE, 0x8D, 0xBD, 0x05, 0x3A, 0x45, 0x19, 0x86, 0x21, 0x01, 0xBE, 0x66, 0x72,
+0x00, 0xC3, 0xAB, 0x4A, 0x55, 0x9D, 0xB6, 0xAD, 0xEB, 0x52, 0x63, 0xC1, 0xC7, 0x29, 0x07, 0x32,
+0x46, 0xA1, 0x00, 0xC0, 0xE7, 0x39, 0x00, 0xC0, 0x45, 0x29, 0x95, 0xC0, 0xE7, 0x31, 0x00, 0x7F,
+0x44, 0xAB, 0xA1, 0x7F, 0x4E, 0x75, 0xC0, 0x04, 0x21, 0x00, 0xBF, 0xC0, 0x85, 0x29, 0xBF, 0x7F,
+0x7A, 0x95, 0x57, 0x6F, 0xC2, 0xAA, 0x52, 0x2F, 0x84, 0x87, 0x52, 0x4A, 0x56, 0xC1, 0xB6, 0xE6,
+0x14, 0xD6, 0xAD, 0xC1, 0xCE, 0xAC, 0xE6, 0x72, 0xA5, 0xC2, 0x4B, 0xA4, 0x90, 0xD5, 0x12, 0xDE,
+0xA5, 0x96, 0xA9, 0xA9, 0x00, 0xAF, 0xB7, 0xAF, 0xC3, 0x54, 0xEE, 0xB2, 0xD5, 0xEF, 0xB4, 0x8D,
+0xA4, 0x6E, 0xC1, 0xF4, 0xCD, 0x96, 0xDE, 0x96, 0xC0, 0x15, 0xBE, 0x5B, 0xC0, 0xA7, 0x21, 0x92,
+0x6C, 0xC1, 0x87, 0x29, 0x25, 0x21, 0x50, 0xC0, 0x45, 0x21, 0x95, 0xA6, 0x00, 0x52, 0x00, 0xC1,
+0x64, 0x21, 0xC5, 0x29, 0xA6, 0x44, 0x00, 0xC0, 0x64, 0x19, 0x91, 0xC0, 0x84, 0x21, 0x44, 0x70,
+0xC0, 0x23, 0x19, 0x73, 0x5C, 0xC1, 0x07, 0x2A, 0xA6, 0x21, 0x4F, 0x63, 0xC2, 0xA7, 0x29, 0x9B,
+0xCE, 0xFF, 0xFF, 0x9A, 0xC2, 0xBB, 0xCE, 0x71, 0x84, 0xA6, 0x29, 0x57, 0x5F, 0xC5, 0x64, 0x31,
+0xC3, 0x49, 0xF0, 0xDD, 0x91, 0xEE, 0x15, 0xF7, 0xFB, 0xFF, 0x6E, 0x01, 0xB9, 0xCA, 0x79, 0xF7,
+0xB6, 0xFF, 0x49, 0xCD, 0xC6, 0xBC, 0x2B, 0xDE, 0x66, 0x84, 0xE3, 0x2A, 0x69, 0x63, 0x0E, 0xF4,
+0x62, 0xD0, 0x40, 0xF0, 0xB2, 0xE0, 0x11, 0xAE, 0x9A, 0xC6, 0x21, 0xD8, 0xAE, 0xFB, 0x9B, 0xFF,
+0x54, 0xC6, 0x4B, 0x7C, 0x67, 0x53, 0x63, 0x2A, 0xB8, 0xC5, 0xE9, 0xAC, 0x4E, 0xEE, 0xB2, 0xF6,
+0xFA, 0xFF, 0xBD, 0xFF, 0xBF, 0xEF, 0xA9, 0xC1, 0xFD, 0xF7, 0x99, 0xF7, 0xB4, 0xC4, 0x92, 0xEE,
+0xC5, 0x9B, 0x6E, 0xE6, 0x8D, 0xBD, 0xA3, 0x29, 0x4F, 0xC2, 0x2C, 0x53, 0xF3, 0x94, 0x34, 0x9D,
+0x00, 0xBF, 0xAE, 0xC1, 0xF4, 0x94, 0xF7, 0xB5, 0x5A, 0x6E, 0xC2, 0x38, 0xBE, 0x0B, 0x53, 0x85,
+0x19, 0x77, 0x7A, 0x00, 0xA1, 0x96, 0x69, 0xC0, 0x04, 0x21, 0x95, 0xC1, 0x85, 0x29, 0x07, 0x32,
+0xA6, 0x53, 0x00, 0x91, 0x00, 0x7A, 0x61, 0xA6, 0x50, 0xAE, 0x6E, 0x7F, 0x00, 0x77, 0x00, 0xA1,
+0xCF, 0x81, 0x08, 0x68, 0x4A, 0x0E, 0x84, 0x87, 0x5A, 0x29, 0x73, 0x55, 0xDE, 0x99, 0xFF, 0xD7,
+0xE6, 0x34, 0xD6, 0x91, 0xC5, 0xAD, 0xAC, 0x27, 0x83, 0xC5, 0x7A, 0xEB, 0xA3, 0x50, 0xCD, 0xD1,
+0xD5, 0x01, 0xAD, 0x00, 0xAB, 0xB6, 0xAB, 0x91, 0xCA, 0x8D, 0xAC, 0x2C, 0x9C, 0x10, 0xB5, 0x13,
+0xCE, 0x55, 0xD6, 0xB7, 0xE6, 0x9A, 0xF7, 0x35, 0xC6, 0x06, 0x32, 0x85, 0x21, 0xA7, 0x21, 0x00,
+0xBA, 0xA1, 0xC1, 0xE8, 0x41, 0x2C, 0x63, 0xA5, 0xC0, 0x6A, 0x4A, 0xA5, 0xC8, 0xCA, 0x52, 0x4B,
+0x63, 0xED, 0x7B, 0xAF, 0x8C, 0xB4, 0xAD, 0xF5, 0xBD, 0x12, 0x9D, 0x6C, 0x6B, 0xE9, 0x5A, 0x73,
+0x00, 0x92, 0xC3, 0xAD, 0x6B, 0xEE, 0x73, 0xC6, 0x29, 0x44, 0x19, 0x00, 0xC1, 0xC6, 0x21, 0xCA,
+0x42, 0xBF, 0xC1, 0xFC, 0xD6, 0x5D, 0xDF, 0xA6, 0xC0, 0xFF, 0xF7, 0x92, 0xC1, 0x9A, 0xC6, 0xD2,
+0x8C, 0x6B, 0xB0, 0xC5, 0xC3, 0x49, 0xEF, 0xDD, 0xD1, 0xF6, 0x55, 0xFF, 0xFB, 0xFF, 0xFE, 0xF7,
+0x6E, 0x00, 0xB9, 0xC2, 0x78, 0xF7, 0x74, 0xFF, 0x28, 0xCD, 0x94, 0xC6, 0x2C, 0xD6, 0x05, 0x74,
+0xE4, 0x22, 0x69, 0x63, 0x0E, 0xF4, 0x62, 0xD0, 0x40, 0xF0, 0xB2, 0xE0, 0x11, 0xAE, 0x9A, 0xC1,
+0x41, 0xD8, 0xAE, 0xFB, 0x46, 0xCA, 0x54, 0xC6, 0x4B, 0x7C, 0x88, 0x53, 0x63, 0x22, 0x83, 0x32,
+0xA8, 0xAC, 0x6F, 0xF6, 0xB1, 0xF6, 0xB9, 0xFF, 0xBD, 0xFF, 0xDF, 0xF7, 0x71, 0x54, 0xB8, 0xC8,
+0x56, 0xFF, 0x6E, 0xCD, 0x07, 0xAC, 0xB0, 0xF6, 0x2B, 0xB5, 0xC4, 0x31, 0xE7, 0x29, 0x14, 0x95,
+0xFF, 0xEF, 0x6E, 0x71, 0x02, 0x6E, 0x61, 0x6E, 0xC2, 0x9E, 0xE7, 0x92, 0x84, 0x08, 0x32, 0x91,
+0x91, 0xC3, 0xC6, 0x31, 0x65, 0x21, 0x04, 0x19, 0x45, 0x29, 0x9A, 0xA9, 0xC1, 0xA6, 0x29, 0x48,
+0x3A, 0x91, 0x7F, 0x7C, 0x7A, 0x00, 0x95, 0x66, 0xBB, 0x91, 0x61, 0xC0, 0x86, 0x29, 0x7A, 0x77,
+0x6B, 0xAE, 0xBA, 0xC6, 0xA1, 0x08, 0x48, 0x4A, 0x2E, 0x84, 0xA8, 0x5A, 0x49, 0x73, 0xD2, 0xCD,
+0x79, 0xFF, 0xAF, 0xC1, 0x97, 0xE6, 0xD3, 0xCD, 0x90, 0xC7, 0xEF, 0xBC, 0xAA, 0x9B, 0xE7, 0x82,
+0x28, 0x83, 0xCF, 0xBC, 0x2F, 0xC5, 0xB0, 0xCD, 0x11, 0xD6, 0xB7, 0x95, 0xC0, 0x50, 0xCD, 0x92,
+0xCB, 0xCB, 0x9B, 0x0C, 0x9C, 0xAE, 0xAC, 0x92, 0xC5, 0x95, 0xDE, 0xF7, 0xE6, 0x79, 0xF7, 0xFC,
+0xFF, 0xB7, 0xD6, 0x46, 0x3A, 0x64, 0x19, 0xA6, 0x21, 0x46, 0x72, 0xB5, 0xC1, 0xCA, 0x5A, 0xDE,
+0xFF, 0xAF, 0xC2, 0x59, 0xD6, 0x95, 0xB5, 0xF6, 0xC5, 0xAD, 0xC1, 0x55, 0xCE, 0xD6, 0xDE, 0xAB,
+0xC2, 0x9B, 0xF7, 0x39, 0xEF, 0x15, 0xCE, 0x00, 0xC1, 0x97, 0xDE, 0x99, 0xDE, 0x00, 0xC7, 0xFE,
+0xFF, 0x9C, 0xEF, 0x0A, 0x53, 0xE2, 0x08, 0xC6, 0x29, 0xB2, 0x84, 0x7D, 0xDF, 0xFF, 0xEF, 0x6E,
+0x00, 0x91, 0xBF, 0x6E, 0x00, 0x96, 0xC8, 0x50, 0x7C, 0x03, 0x21, 0xC3, 0x41, 0x4D, 0xCD, 0xB0,
+0xF6, 0x75, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x95, 0xCB, 0xBB, 0xF7, 0x56, 0xF7, 0xD0,
+0xEE, 0xE6, 0xBC, 0xC9, 0xD5, 0x6E, 0xDE, 0xA4, 0x63, 0xE4, 0x22, 0x69, 0x63, 0x0E, 0xF4, 0x62,
+0xD0, 0x40, 0xF0, 0x5D, 0xE0, 0x11, 0xAE, 0x64, 0xCC, 0x42, 0xD8, 0xCE, 0xFB, 0x9B, 0xFF, 0x54,
+0xC6, 0x4B, 0x7C, 0x88, 0x53, 0x64, 0x1A, 0x43, 0x2A, 0xC5, 0x8B, 0x0D, 0xEE, 0x91, 0xF6, 0x56,
+0xFF, 0xDC, 0xFF, 0x65, 0xAE, 0xCB, 0x9A, 0xF7, 0xD9, 0xFF, 0x14, 0xF7, 0xEB, 0xC4, 0x2C, 0xCD,
+0x6F, 0xEE, 0xC7, 0x83, 0x01, 0x19, 0x45, 0x19, 0x0C, 0x53, 0x71, 0x84, 0xB2, 0x8C, 0x96, 0xC0,
+0x30, 0x7C, 0xAB, 0xA5, 0x01, 0x42, 0xC6, 0xAE, 0x6B, 0x49, 0x3A, 0x65, 0x19, 0xE7, 0x29, 0x86,
+0x21, 0xC6, 0x31, 0x65, 0x21, 0xA1, 0xC0, 0xA6, 0x31, 0x96, 0x61, 0xC2, 0xC6, 0x29, 0xCA, 0x4A,
+0x48, 0x3A, 0x7F, 0x9A, 0x7F, 0x91, 0x66, 0x75, 0xC0, 0x25, 0x21, 0xA6, 0x61, 0x75, 0xAE, 0x00,
+0x9A, 0x00, 0x7A, 0xC7, 0xE2, 0x10, 0x88, 0x4A, 0x2E, 0x8C, 0xC8, 0x62, 0x08, 0x6B, 0xEF, 0xAC,
+0x17, 0xF7, 0xBC, 0xFF, 0xA1, 0xC5, 0x56, 0xDE, 0xB3, 0xCD, 0xF4, 0xDD, 0x71, 0xCD, 0x0C, 0xA4,
+0x29, 0x8B, 0x80, 0xC2, 0x48, 0x83, 0xA9, 0x8B, 0xEA, 0x93, 0xBA, 0x96, 0xC0, 0x69, 0x93, 0x96,
+0xC6, 0xEC, 0x9B, 0xEF, 0xB4, 0x71, 0xC5, 0xD3, 0xC5, 0xD6, 0xE6, 0xBA, 0xFF, 0xFA, 0xFF, 0x00,
+0x82, 0xC1, 0x28, 0x5B, 0xC4, 0x21, 0xA7, 0x4B, 0x7F, 0xC6, 0x07, 0x3A, 0xEE, 0x7B, 0xDA, 0xE6,
+0x7C, 0xFF, 0xB5, 0xC5, 0xD1, 0xAC, 0xF4, 0xCD, 0xAD, 0xA5, 0xC0, 0x53, 0xD6, 0x40, 0xC0, 0x75,
+0xDE, 0xBE, 0xC0, 0x35, 0xD6, 0xBE, 0xC0, 0x97, 0xE6, 0xA3, 0x81, 0xC3, 0x5B, 0xEF, 0x9C, 0xEF,
+0x4B, 0x5B, 0x64, 0x21, 0x67, 0xC1, 0xF2, 0x8C, 0x5C, 0xD7, 0xBF, 0xC0, 0xDF, 0xEF, 0x91, 0xC2,
+0xB7, 0xAD, 0x55, 0xA5, 0x96, 0xA5, 0xAE, 0xC9, 0x34, 0x95, 0xAA, 0x4A, 0x44, 0x21, 0x82, 0x39,
+0xC6, 0x93, 0x2E, 0xE6, 0x33, 0xFF, 0xD8, 0xFF, 0xBB, 0xFF, 0xDD, 0xFF, 0xA5, 0xC6, 0x79, 0xF7,
+0x55, 0xFF, 0x8F, 0xEE, 0x68, 0xCD, 0x2B, 0xE6, 0x8B, 0xBD, 0x44, 0x53, 0x5B, 0xC3, 0x69, 0x63,
+0x0E, 0xF4, 0x62, 0xD0, 0x40, 0xF0, 0x5D, 0xE0, 0x12, 0x64, 0xC1, 0x62, 0xD8, 0xCE, 0xFB, 0x46,
+0xC9, 0x34, 0xC6, 0x4B, 0x7C, 0x89, 0x53, 0xA5, 0x1A, 0x02, 0x1A, 0xE2, 0x62, 0x8C, 0xD5, 0x90,
+0xF6, 0x34, 0xFF, 0xFA, 0xFF, 0x4B, 0x95, 0xC0, 0x57, 0xF7, 0xB9, 0xC6, 0x92, 0xEE, 0x2D, 0xCD,
+0x51, 0xF6, 0xCE, 0xD5, 0x22, 0x4A, 0xA4, 0x29, 0xC6, 0x21, 0xA1, 0xC0, 0x03, 0x11, 0xBF, 0xC0,
+0x65, 0x21, 0x52, 0x75, 0x66, 0x00, 0xAF, 0xAE, 0x00, 0xC0, 0xE7, 0x29, 0x00, 0x77, 0x00, 0xBE,
+0xC0, 0x64, 0x21, 0x6B, 0xC1, 0xE7, 0x31, 0x85, 0x29, 0x52, 0x75, 0xC2, 0x0B, 0x53, 0x89, 0x3A,
+0x07, 0x32, 0xAF, 0xA9, 0xC0, 0xA6, 0x29, 0x66, 0x7A, 0x66, 0x75, 0x7A, 0xBF, 0x4B, 0x7F, 0x77,
+0xA9, 0xA1, 0xC3, 0xC2, 0x10, 0x68, 0x4A, 0x0D, 0x84, 0xA7, 0x62, 0xBE, 0xC3, 0x8C, 0xA4, 0x17,
+0xF7, 0x5A, 0xFF, 0xDC, 0xFF, 0x75, 0xC1, 0x55, 0xDE, 0xD3, 0xD5, 0x00, 0x71, 0x00, 0xC0, 0x6E,
+0xA4, 0xA4, 0x91, 0x96, 0x00, 0xC3, 0x4D, 0xA4, 0x8F, 0xB4, 0xD0, 0xB4, 0xB4, 0xD5, 0x9D, 0x96,
+0xC2, 0x34, 0xD6, 0x58, 0xF7, 0xDA, 0xFF, 0xA5, 0x9F, 0xAF, 0xC1, 0xEC, 0x73, 0xE9, 0x4A, 0x00,
+0xC9, 0x4B, 0x5B, 0xEA, 0x52, 0x89, 0x4A, 0x0F, 0x84, 0x53, 0xBD, 0x78, 0xE6, 0x90, 0xA4, 0xCD,
+0x8B, 0x72, 0xBD, 0xF2, 0xCD, 0xA1, 0xC0, 0x12, 0xD6, 0xBF, 0x96, 0xC1, 0x54, 0xDE, 0x95, 0xE6,
+0xA6, 0xBF, 0xC1, 0x36, 0xDE, 0x54, 0xBD, 0x84, 0xC2, 0x98, 0xCE, 0xCD, 0x6B, 0x0A, 0x53, 0x9F,
+0xC8, 0x6C, 0x53, 0x0E, 0x6C, 0x8D, 0x63, 0x17, 0xB6, 0x54, 0x9D, 0x28, 0x32, 0x65, 0x19, 0xE7,
+0x29, 0x45, 0x19, 0x63, 0x95, 0x7F, 0xC6, 0x42, 0x21, 0x42, 0x5A, 0x8D, 0xD5, 0xD2, 0xF6, 0x35,
+0xFF, 0x78, 0xFF, 0xDA, 0xFF, 0xAE, 0xC3, 0xB7, 0xFF, 0x94, 0xFF, 0xCF, 0xF6, 0x4C, 0xE6, 0x86,
+0xC1, 0x06, 0x74, 0xC3, 0x32, 0x5B, 0x6A, 0xC2, 0x0E, 0xF4, 0x62, 0xD0, 0x20, 0xF0, 0xB6, 0xE0,
+0x12, 0x8A, 0xC6, 0x82, 0xD8, 0x0F, 0xFC, 0x5A, 0xFF, 0xF3, 0xBD, 0x4B, 0x7C, 0xC9, 0x53, 0xA6,
+0x12, 0xB9, 0xC8, 0x82, 0x42, 0x85, 0x7B, 0x8B, 0xCD, 0xF1, 0xF6, 0x73, 0xFF, 0xB5, 0xFF, 0xF7,
+0xFF, 0x96, 0xFF, 0xD3, 0xFE, 0x00, 0xAF, 0xC4, 0x8F, 0xD5, 0x06, 0x6B, 0x60, 0x21, 0xA4, 0x29,
+0xE6, 0x29, 0xBA, 0xC0, 0x47, 0x42, 0xA7, 0xC0, 0xC7, 0x39, 0xAF, 0x91, 0x99, 0x7F, 0x4B, 0xAF,
+0xAB, 0x00, 0xA5, 0xA5, 0xC4, 0x07, 0x32, 0x64, 0x19, 0x06, 0x2A, 0xE9, 0x4A, 0x84, 0x21, 0x9A,
+0xC0, 0xA6, 0x21, 0xA5, 0xC4, 0x08, 0x32, 0x0B, 0x53, 0x48, 0x3A, 0xE6, 0x29, 0x28, 0x3A, 0x4B,
+0xBA, 0x77, 0xC0, 0xE5, 0x29, 0x00, 0x44, 0x00, 0x53, 0x00, 0x4B, 0x7F, 0x6B, 0xC3, 0x23, 0x19,
+0xCA, 0x52, 0x2E, 0x8C, 0x29, 0x73, 0xA0, 0xC4, 0xCC, 0xAC, 0x32, 0xDE, 0x78, 0xFF, 0xB9, 0xFF,
+0x38, 0xF7, 0xAB, 0xC1, 0xD7, 0xEE, 0x93, 0xC5, 0x42, 0xC0, 0x72, 0xBD, 0x42, 0x76, 0x95, 0x42,
+0xA6, 0xAB, 0xBF, 0xC5, 0x54, 0xC5, 0xF6, 0xCD, 0x12, 0xB5, 0xF5, 0xCD, 0x59, 0xFF, 0xDB, 0xFF,
+0xAD, 0x01, 0xC3, 0x18, 0xDF, 0x49, 0x53, 0xA8, 0x3A, 0xE9, 0x42, 0xA6, 0xA6, 0x7E, 0xC6, 0x0B,
+0x63, 0x0E, 0x8C, 0x4F, 0x9C, 0x8B, 0x83, 0x0D, 0x94, 0x30, 0xB5, 0xB1, 0xC5, 0xA6, 0xBE, 0xC0,
+0xF3, 0xD5, 0xBF, 0xC1, 0x74, 0xE6, 0xB5, 0xEE, 0xAE, 0x92, 0x96, 0xA7, 0xC8, 0x16, 0xC6, 0x98,
+0xCE, 0xF1, 0x8C, 0xED, 0x63, 0xC9, 0x3A, 0x84, 0x11, 0x47, 0x32, 0x2A, 0x53, 0x47, 0x3A, 0x96,
+0x91, 0x86, 0xA5, 0x96, 0xBA, 0x00, 0xC7, 0xC6, 0x21, 0x63, 0x21, 0xA2, 0x39, 0x46, 0x7B, 0xAE,
+0xD5, 0x54, 0xFF, 0x95, 0xFF, 0x33, 0xF7, 0xBE, 0x00, 0xA4, 0xC4, 0xD0, 0xFE, 0xEC, 0xCD, 0x26,
+0x7C, 0xE3, 0x3A, 0xE4, 0x22, 0xAB, 0xC3, 0xAA, 0x73, 0xAD, 0xF3, 0x61, 0xD8, 0x20, 0xF0, 0xB6,
+0xE0, 0x12, 0x8A, 0xCD, 0x62, 0xD8, 0xEF, 0xFB, 0x5A, 0xFF, 0xF3, 0xBD, 0x4B, 0x7C, 0xC9, 0x53,
+0xE7, 0x1A, 0x85, 0x0A, 0xE1, 0x19, 0x61, 0x42, 0x27, 0x94, 0xCC, 0xCD, 0xD0, 0xE6, 0x53, 0xF7,
+0x00, 0xBF, 0xC7, 0x13, 0xFF, 0x51, 0xEE, 0x4E, 0xCD, 0xA9, 0x8B, 0x24, 0x4A, 0x83, 0x29, 0xE5,
+0x31, 0x87, 0x4A, 0xBE, 0xA6, 0xBF, 0xC0, 0xCA, 0x62, 0x92, 0xC0, 0xC7, 0x39, 0x99, 0x9A, 0xAF,
+0x00, 0xAF, 0xA7, 0xA5, 0xA9, 0xC4, 0x07, 0x2A, 0xA4, 0x19, 0x87, 0x3A, 0xE9, 0x42, 0xC5, 0x21,
+0x00, 0x4B, 0x46, 0xC1, 0x07, 0x32, 0xAA, 0x42, 0xBE, 0xC0, 0x27, 0x32, 0x91, 0x53, 0x46, 0x50,
+0xA9, 0xA9, 0x44, 0x53, 0x00, 0xAB, 0x4B, 0x7F, 0xC4, 0x44, 0x19, 0xC2, 0x08, 0x0B, 0x5B, 0xB0,
+0x94, 0x4A, 0x73, 0xB8, 0xC0, 0xAC, 0xAC, 0x95, 0xC0, 0x12, 0xD6, 0x6C, 0xC0, 0xFB, 0xFF, 0xA6,
+0xC1, 0xF8, 0xEE, 0x15, 0xCE, 0xBF, 0x81, 0x4E, 0x00, 0xC3, 0xB4, 0xC5, 0x16, 0xCE, 0x57, 0xDE,
+0xD6, 0xCD, 0xAB, 0x00, 0xA8, 0xC2, 0xF1, 0xAC, 0x56, 0xDE, 0xFC, 0xFF, 0x50, 0xA9, 0x00, 0xC2,
+0x79, 0xEF, 0x35, 0xBE, 0xE5, 0x29, 0x81, 0x00, 0xBA, 0x92, 0xC8, 0xA2, 0x08, 0xA6, 0x31, 0x4B,
+0x73, 0xCC, 0x83, 0xE9, 0x6A, 0xD0, 0xAC, 0xF3, 0xCD, 0x91, 0xC5, 0xD2, 0xCD, 0x00, 0xC0, 0x14,
+0xD6, 0xBE, 0xAE, 0xAE, 0xC0, 0xB4, 0xE6, 0xAF, 0xAB, 0xC7, 0xB8, 0xE6, 0xF2, 0xA4, 0x94, 0xAD,
+0x2B, 0x53, 0xE6, 0x21, 0x88, 0x32, 0xC9, 0x3A, 0x2A, 0x4B, 0xA1, 0xC0, 0xC5, 0x29, 0x9A, 0xA6,
+0x9A, 0x01, 0xBB, 0x9E, 0x95, 0xA1, 0xC5, 0x62, 0x29, 0x03, 0x4A, 0x46, 0x7B, 0xCB, 0xAC, 0x2F,
+0xD6, 0x11, 0xEF, 0xBA, 0xC6, 0xAF, 0xEE, 0xCC, 0xD5, 0x0A, 0xB5, 0x47, 0x8C, 0x44, 0x4B, 0xE3,
+0x22, 0x25, 0x1B, 0xBB, 0xC3, 0xCB, 0x7B, 0xAD, 0xF3, 0x41, 0xD8, 0x20, 0xF0, 0xB6, 0xE0, 0x11,
+0xAE, 0x86, 0xC0, 0x62, 0xD8, 0x61, 0xC4, 0x3A, 0xFF, 0xD3, 0xBD, 0x4C, 0x7C, 0xCA, 0x5B, 0x08,
+0x23, 0x99, 0xC6, 0x64, 0x22, 0x02, 0x2A, 0x62, 0x4A, 0x45, 0x73, 0x8A, 0x9C, 0x8E, 0xBD, 0x51,
+0xD6, 0xBE, 0xC6, 0x8E, 0xC5, 0xE8, 0x93, 0x43, 0x5A, 0x61, 0x39, 0x63, 0x31, 0x06, 0x42, 0x67,
+0x5A, 0xBE, 0xAD, 0x95, 0xBB, 0xC0, 0xC8, 0x6A, 0x9B, 0x96, 0xC0, 0x27, 0x3A, 0x96, 0x96, 0x00,
+0xAB, 0x00, 0xA5, 0x00, 0xAD, 0x75, 0xC0, 0xC8, 0x42, 0x91, 0xC0, 0xE5, 0x29, 0x44, 0x53, 0xA6,
+0x53, 0x58, 0xC1, 0x2B, 0x53, 0x68, 0x3A, 0x78, 0x53, 0x46, 0xC0, 0x28, 0x32, 0x95, 0x00, 0xBB,
+0x01, 0xA6, 0x4E, 0x95, 0xA2, 0xC5, 0xE3, 0x10, 0xAA, 0x52, 0x2F, 0x84, 0xE9, 0x62, 0x29, 0x6B,
+0xCD, 0xA4, 0xBF, 0xC3, 0x50, 0xBD, 0x34, 0xD6, 0xF7, 0xF6, 0x97, 0xE6, 0xA6, 0x92, 0x9A, 0xA6,
+0x96, 0x64, 0xC0, 0xB6, 0xC5, 0x5F, 0xC1, 0x78, 0xDE, 0xB6, 0xCD, 0x99, 0x5F, 0xA4, 0xC3, 0xF0,
+0xB4, 0x32, 0xC5, 0x76, 0xE6, 0xD7, 0xF6, 0x99, 0x81, 0x8B, 0xC1, 0x93, 0xA5, 0x26, 0x32, 0x44,
+0xC0, 0x84, 0x19, 0xBF, 0x44, 0xC2, 0xC3, 0x10, 0x86, 0x31, 0x90, 0x94, 0xA1, 0xC1, 0x2B, 0x73,
+0xD4, 0xC5, 0x68, 0xC1, 0x90, 0xBD, 0x53, 0xD6, 0xA6, 0xC1, 0x55, 0xDE, 0x95, 0xE6, 0x68, 0x5C,
+0xC9, 0xB4, 0xE6, 0x16, 0xEF, 0xF8, 0xEE, 0x98, 0xDE, 0x54, 0xB5, 0x96, 0xB5, 0xAA, 0x4A, 0x03,
+0x09, 0x06, 0x22, 0xA9, 0x3A, 0x6C, 0xC0, 0x85, 0x21, 0x01, 0x70, 0xAF, 0x00, 0xAF, 0xB6, 0x48,
+0x82, 0xC0, 0xE7, 0x19, 0xB4, 0xB4, 0xB4, 0xCF, 0x42, 0x4A, 0x65, 0x6B, 0x68, 0x8C, 0xC9, 0x9C,
+0x68, 0x94, 0x85, 0x7B, 0xC3, 0x5A, 0x82, 0x3A, 0x83, 0x22, 0x05, 0x13, 0x87, 0x1B, 0x67, 0x2B,
+0xEB, 0x7B, 0xCE, 0xF3, 0x41, 0xD8, 0x20, 0xF0, 0xB6, 0x00, 0xAE, 0x5D, 0xE0, 0x0E, 0x62, 0x86,
+0x6E, 0xC5, 0xCE, 0xFB, 0x3A, 0xFF, 0xD3, 0xBD, 0x6C, 0x84, 0xEA, 0x5B, 0x28, 0x23, 0x91, 0xC6,
+0x65, 0x12, 0xC2, 0x11, 0xA1, 0x21, 0xA1, 0x31, 0xE2, 0x41, 0x43, 0x4A, 0x84, 0x5A, 0xA9, 0xC5,
+0x22, 0x4A, 0x80, 0x31, 0x20, 0x29, 0x63, 0x31, 0x27, 0x4A, 0xA9, 0x62, 0xA0, 0xC2, 0xA6, 0x6A,
+0x88, 0x8B, 0x6A, 0xA4, 0x92, 0xC3, 0x06, 0x73, 0x65, 0x5A, 0x29, 0x6B, 0x88, 0x4A, 0x91, 0x82,
+0x4B, 0xAB, 0x00, 0x4B, 0xA5, 0x9A, 0xAE, 0xC1, 0xE9, 0x4A, 0xE5, 0x29, 0xA6, 0x7F, 0xBF, 0xA6,
+0x53, 0xC1, 0xA5, 0x29, 0xC9, 0x4A, 0xBF, 0x58, 0x4B, 0x00, 0xC0, 0x28, 0x32, 0x96, 0x5F, 0xA6,
+0xAB, 0x5A, 0xA6, 0x49, 0x7F, 0xA6, 0xC3, 0x04, 0x19, 0x86, 0x29, 0x28, 0x3A, 0x44, 0x29, 0x94,
+0xC1, 0xC7, 0x5A, 0x8E, 0x9C, 0xA1, 0x91, 0x7E, 0xC2, 0xD0, 0xAC, 0x12, 0xB5, 0xCE, 0x8B, 0x81,
+0xC1, 0xCF, 0x83, 0x4D, 0x73, 0xBE, 0x91, 0x4F, 0xBE, 0xAE, 0xC1, 0x70, 0x9C, 0xB1, 0xA4, 0x6D,
+0xBE, 0xC0, 0x4E, 0x9C, 0x00, 0xC6, 0xAF, 0xAC, 0x6A, 0x7B, 0x86, 0x52, 0x8A, 0x6B, 0xA8, 0x4A,
+0x64, 0x19, 0xA5, 0x21, 0x00, 0x96, 0xB6, 0xC9, 0xA6, 0x31, 0x0C, 0x63, 0x75, 0xB5, 0x91, 0x94,
+0x2B, 0x6B, 0x52, 0xB5, 0xD3, 0xC5, 0x50, 0xB5, 0x74, 0xD6, 0xD5, 0xE6, 0xA3, 0xC0, 0xF8, 0xEE,
+0xA9, 0x95, 0xAF, 0xC3, 0x38, 0xEF, 0xD8, 0xDE, 0x17, 0xCE, 0x72, 0x94, 0x9A, 0xC2, 0x8A, 0x42,
+0x65, 0x19, 0xA5, 0x19, 0x00, 0xB6, 0x91, 0xC0, 0xC7, 0x29, 0xAE, 0x00, 0x50, 0x01, 0xA7, 0x00,
+0x85, 0xC0, 0x08, 0x1A, 0xB9, 0xA0, 0xA0, 0xA8, 0xC1, 0xC1, 0x29, 0x01, 0x32, 0xBE, 0x00, 0x69,
+0x5C, 0xC8, 0x02, 0x1A, 0xA4, 0x1A, 0x67, 0x1B, 0xA8, 0x1B, 0xA8, 0x2B, 0x0C, 0x84, 0xCE, 0xFB,
+0x41, 0xD8, 0x20, 0xF0, 0xB6, 0x00, 0xAE, 0x5D, 0xE0, 0x0E, 0x62, 0x86, 0x6E, 0xC5, 0xEF, 0xFB,
+0x3A, 0xFF, 0xF3, 0xBD, 0x6C, 0x84, 0xEA, 0x5B, 0x47, 0x2B, 0x81, 0xC2, 0xA6, 0x1A, 0x45, 0x1A,
+0xE4, 0x19, 0xB2, 0xA5, 0xA1, 0xC0, 0xC3, 0x31, 0x95, 0x4F, 0xA6, 0x65, 0xC1, 0x46, 0x42, 0x89,
+0x5A, 0xB9, 0xC3, 0x24, 0x62, 0xC8, 0x93, 0xAE, 0xD5, 0x12, 0xFF, 0x95, 0xC4, 0x0B, 0xB5, 0x06,
+0x73, 0x85, 0x5A, 0xE7, 0x62, 0x87, 0x4A, 0x5B, 0x50, 0x01, 0x4B, 0xA9, 0x00, 0xC2, 0x68, 0x32,
+0xE9, 0x4A, 0xC5, 0x21, 0x7F, 0x01, 0x49, 0x53, 0xC3, 0x84, 0x21, 0xE6, 0x31, 0x2B, 0x53, 0xC9,
+0x42, 0x4B, 0xC0, 0x28, 0x32, 0x50, 0xAF, 0x5F, 0x01, 0x5A, 0xA5, 0x47, 0xA6, 0x96, 0xC0, 0x24,
+0x19, 0xA6, 0x96, 0xC0, 0x81, 0x08, 0xBA, 0xC2, 0xA4, 0x31, 0x87, 0x52, 0x0A, 0x73, 0x90, 0xC1,
+0x6B, 0x7B, 0x93, 0xC5, 0x92, 0xC2, 0xA4, 0x41, 0x60, 0x10, 0x03, 0x21, 0xBF, 0xC0, 0xC3, 0x20,
+0x95, 0xA5, 0xC2, 0x20, 0x10, 0x85, 0x39, 0x6C, 0x7B, 0x81, 0xC0, 0x06, 0x4A, 0x68, 0xAF, 0x00,
+0x95, 0xC0, 0xC4, 0x41, 0x85, 0xC0, 0xAB, 0x6B, 0x82, 0xC2, 0x88, 0x3A, 0x64, 0x19, 0xE7, 0x29,
+0xA5, 0xA2, 0xC5, 0x6E, 0x6B, 0xF4, 0x9C, 0xCB, 0x5A, 0x85, 0x31, 0xA2, 0x10, 0x84, 0x31, 0x68,
+0xBE, 0xC1, 0x65, 0x52, 0xE8, 0x62, 0x56, 0xC0, 0x2A, 0x6B, 0x00, 0x95, 0xAE, 0xBF, 0xC1, 0xE9,
+0x5A, 0x28, 0x42, 0x92, 0x96, 0x84, 0xAE, 0x95, 0xA6, 0xC0, 0x07, 0x2A, 0x5A, 0x4B, 0xBE, 0x00,
+0xAE, 0x53, 0x00, 0xA7, 0x9A, 0x9A, 0x95, 0xA5, 0xA6, 0x6D, 0xBD, 0xA9, 0xA9, 0xA5, 0xC0, 0xE2,
+0x21, 0xAB, 0x9A, 0xC0, 0x44, 0x12, 0x6B, 0xC0, 0xA8, 0x1B, 0x00, 0xC4, 0xC9, 0x33, 0x2C, 0x84,
+0xEE, 0xFB, 0x62, 0xD8, 0x20, 0xF0, 0xB6, 0x00, 0x62, 0x5D, 0xE0, 0x0E, 0x62, 0x86, 0x6E, 0xC5,
+0xEF, 0xFB, 0x5A, 0xFF, 0x13, 0xC6, 0x8C, 0x84, 0x0A, 0x64, 0x46, 0x2B, 0x6B, 0xC2, 0xA6, 0x1A,
+0x46, 0x12, 0xA5, 0x09, 0xB6, 0xC0, 0xA5, 0x21, 0x00, 0xA5, 0x9A, 0x00, 0xA9, 0xBF, 0xC1, 0x47,
+0x42, 0xA9, 0x62, 0xA4, 0xCA, 0xE6, 0x7A, 0xCE, 0xD5, 0x11, 0xFF, 0x50, 0xFF, 0x92, 0xFF, 0xF0,
+0xF6, 0xEB, 0xB4, 0x43, 0x5A, 0x08, 0x6B, 0xA7, 0x52, 0x27, 0x3A, 0x86, 0x01, 0x9A, 0xA5, 0xC2,
+0x27, 0x2A, 0x0A, 0x4B, 0xA9, 0x42, 0x7F, 0x4E, 0xA6, 0x01, 0xAD, 0xC0, 0x85, 0x29, 0x95, 0xC2,
+0xC9, 0x4A, 0x0B, 0x4B, 0x28, 0x32, 0xAF, 0xC0, 0xE7, 0x21, 0xBF, 0xAE, 0x5F, 0x00, 0x53, 0x4E,
+0x49, 0x4E, 0x53, 0xC0, 0x66, 0x21, 0x00, 0xC0, 0x05, 0x19, 0x94, 0xC3, 0x08, 0x3A, 0xA9, 0x52,
+0x64, 0x29, 0x07, 0x4A, 0x90, 0xC2, 0x88, 0x5A, 0x94, 0xBD, 0x16, 0xCE, 0x5C, 0xC0, 0x60, 0x08,
+0x5E, 0xC0, 0xC2, 0x10, 0x92, 0xC0, 0xC3, 0x18, 0x00, 0xA1, 0xC3, 0x89, 0x52, 0xD2, 0x9C, 0x4F,
+0x8C, 0xC6, 0x41, 0x00, 0xC0, 0x08, 0x4A, 0x41, 0xC5, 0x28, 0x4A, 0x84, 0x29, 0x26, 0x3A, 0x29,
+0x53, 0x6B, 0x5B, 0xEE, 0x63, 0x50, 0x77, 0xA2, 0xC8, 0x8A, 0x4A, 0x14, 0xA5, 0x52, 0x8C, 0xE8,
+0x41, 0x25, 0x21, 0xA3, 0x10, 0xE2, 0x18, 0x80, 0x10, 0xC1, 0x18, 0x95, 0x00, 0xA7, 0xBF, 0x99,
+0x95, 0x5F, 0xC0, 0xE2, 0x10, 0xA2, 0xC1, 0x41, 0x00, 0x46, 0x21, 0x81, 0xC1, 0x86, 0x19, 0x07,
+0x2A, 0x95, 0xAE, 0xC1, 0x48, 0x2A, 0xE7, 0x21, 0xA6, 0x4B, 0x00, 0x50, 0xA9, 0x50, 0xB2, 0x9A,
+0xC0, 0x08, 0x2A, 0x48, 0x92, 0x95, 0xBE, 0xAE, 0xAE, 0xB9, 0xBE, 0x7A, 0x9A, 0x99, 0x9E, 0xC1,
+0xE6, 0x12, 0xC8, 0x23, 0x00, 0xC4, 0xC9, 0x33, 0x2C, 0x84, 0xEE, 0xFB, 0x62, 0xD8, 0x20, 0xF0,
+0xB6, 0x00, 0xAE, 0x5D, 0xE0, 0x0E, 0x62, 0x86, 0xC9, 0x82, 0xD8, 0x0F, 0xFC, 0x7B, 0xFF, 0x14,
+0xC6, 0x8C, 0x84, 0x0A, 0x64, 0xE8, 0x43, 0x47, 0x23, 0x86, 0x1A, 0x26, 0x12, 0xA3, 0xBF, 0xBA,
+0x7B, 0x91, 0x6C, 0xC0, 0xC7, 0x19, 0x43, 0x4E, 0xCD, 0x88, 0x52, 0xC8, 0x62, 0x65, 0x5A, 0xA7,
+0x8B, 0xF2, 0xF6, 0xEF, 0xF6, 0x4B, 0xE6, 0xCD, 0xF6, 0x10, 0xFF, 0xCE, 0xD5, 0xA4, 0x6A, 0xE7,
+0x6A, 0x87, 0x52, 0x27, 0x3A, 0x81, 0x48, 0x4D, 0xA5, 0x79, 0xC4, 0x27, 0x2A, 0x6C, 0x53, 0x47,
+0x32, 0xC6, 0x29, 0x08, 0x32, 0x46, 0xA6, 0x49, 0x7F, 0xA9, 0x95, 0xC1, 0x06, 0x32, 0xCA, 0x42,
+0x00, 0xC0, 0x48, 0x32, 0x48, 0x4D, 0xBB, 0xBE, 0x00, 0x53, 0x4E, 0x49, 0x4E, 0xAB, 0xC0, 0x86,
+0x21, 0xA6, 0x91, 0xA5, 0xC2, 0xE8, 0x39, 0x28, 0x42, 0x03, 0x21, 0xBA, 0x91, 0xAB, 0xC1, 0x89,
+0x5A, 0xCF, 0x83, 0x65, 0xC0, 0x44, 0x21, 0x96, 0x00, 0xAF, 0xBA, 0xA5, 0x91, 0xC4, 0xC6, 0x31,
+0xCA, 0x52, 0x27, 0x42, 0x85, 0x29, 0xC2, 0x10, 0xAF, 0xC0, 0xC7, 0x31, 0x99, 0xC1, 0x44, 0x19,
+0xA4, 0x19, 0xAE, 0xC3, 0x63, 0x09, 0x6B, 0x4B, 0x88, 0x32, 0xA6, 0x21, 0x6D, 0xC3, 0xAF, 0x73,
+0x77, 0xB5, 0xED, 0x62, 0x67, 0x29, 0xA9, 0xC0, 0xE4, 0x18, 0x61, 0x48, 0x41, 0xAE, 0xC0, 0xA2,
+0x10, 0x48, 0x00, 0xA6, 0x99, 0x41, 0xC0, 0x24, 0x19, 0x61, 0x68, 0xC0, 0xA8, 0x21, 0x95, 0xC1,
+0xE7, 0x21, 0x47, 0x2A, 0x91, 0xAB, 0x54, 0x40, 0xBF, 0x00, 0x4D, 0xB9, 0x01, 0xA7, 0x00, 0x7F,
+0x00, 0x4F, 0x00, 0x96, 0x00, 0x40, 0xAE, 0x4D, 0x74, 0x99, 0x9E, 0xC2, 0x04, 0x02, 0xC6, 0x12,
+0xC8, 0x23, 0xBE, 0xB2, 0xC3, 0x2C, 0x84, 0xEE, 0xFB, 0x62, 0xD8, 0x20, 0xF0, 0xB6, 0x00, 0xAE,
+0x5D, 0xE0, 0x0E, 0x62, 0x8A, 0xC6, 0x82, 0xD8, 0x30, 0xFC, 0x9B, 0xFF, 0x34, 0xC6, 0x8D, 0x84,
+0x0A, 0x64, 0x46, 0x33, 0x82, 0xA3, 0xC1, 0x67, 0x1A, 0xA6, 0x09, 0xA6, 0x7B, 0x96, 0x47, 0x73,
+0xA6, 0xB9, 0xC6, 0xA6, 0x31, 0x88, 0x52, 0xA7, 0x62, 0x23, 0x52, 0x45, 0x7B, 0xB1, 0xEE, 0xCE,
+0xF6, 0x94, 0xC5, 0x0E, 0xFF, 0xAF, 0xF6, 0x8E, 0xD5, 0x85, 0x6A, 0xC8, 0x6A, 0x68, 0x52, 0x53,
+0x81, 0xAF, 0x00, 0x99, 0x91, 0xC2, 0x06, 0x22, 0x6C, 0x53, 0xC5, 0x21, 0x7C, 0x4B, 0xA2, 0xA6,
+0xC0, 0xC7, 0x29, 0x94, 0xC0, 0xE6, 0x29, 0xAE, 0xC3, 0x64, 0x19, 0x69, 0x3A, 0x4C, 0x4B, 0x48,
+0x2A, 0x50, 0x48, 0x50, 0xBB, 0x53, 0x00, 0x4E, 0xA7, 0xAE, 0xC0, 0x67, 0x21, 0x7C, 0x74, 0xA9,
+0x00, 0xC0, 0xC3, 0x10, 0xA5, 0xC0, 0x25, 0x29, 0x6D, 0xC0, 0x03, 0x21, 0x92, 0xC0, 0x01, 0x08,
+0x43, 0xC2, 0x05, 0x21, 0x45, 0x19, 0xA6, 0x21, 0xA5, 0x4B, 0x6B, 0xC0, 0x24, 0x21, 0x00, 0x95,
+0x00, 0xC0, 0xA2, 0x08, 0x46, 0x96, 0x96, 0xC0, 0x24, 0x11, 0x00, 0x80, 0xC0, 0x06, 0x22, 0x6F,
+0xC0, 0xCD, 0x5B, 0x6F, 0xC0, 0xC5, 0x19, 0xA2, 0xC6, 0x48, 0x3A, 0xD3, 0x94, 0xB7, 0xB5, 0xAB,
+0x5A, 0x09, 0x42, 0x6A, 0x4A, 0x46, 0x21, 0x58, 0xC3, 0x66, 0x29, 0xE4, 0x10, 0x87, 0x29, 0x25,
+0x19, 0x03, 0xAF, 0x68, 0x74, 0xAE, 0x9A, 0x95, 0xC0, 0xC6, 0x19, 0x46, 0x95, 0x92, 0xBB, 0xC0,
+0x4A, 0x2A, 0xA6, 0xA9, 0xA9, 0xA9, 0x00, 0xA9, 0xA7, 0x4B, 0x53, 0x50, 0xA7, 0x9B, 0x00, 0xA5,
+0xA9, 0x79, 0x4B, 0x80, 0x9F, 0xC3, 0x27, 0x12, 0x66, 0x12, 0x07, 0x13, 0xC8, 0x23, 0xA9, 0xB7,
+0xC3, 0x2C, 0x84, 0xEE, 0xFB, 0x62, 0xD8, 0x20, 0xF0, 0x5D, 0xE0, 0x12, 0x5F, 0x6E, 0xC5, 0xEF,
+0xFB, 0x39, 0xFF, 0x14, 0xC6, 0x6C, 0x84, 0xE9, 0x5B, 0x68, 0x33, 0x82, 0xC0, 0xC8, 0x22, 0xA2,
+0xC0, 0x28, 0x22, 0x74, 0xA6, 0xC1, 0x08, 0x2A, 0x65, 0x19, 0x43, 0xA6, 0xC0, 0x45, 0x21, 0x7D,
+0xC1, 0x47, 0x4A, 0x87, 0x5A, 0xB9, 0xC2, 0x63, 0x62, 0x2C, 0xC5, 0x52, 0xFF, 0xA0, 0xA6, 0xC5,
+0x2F, 0xEE, 0xA9, 0x9B, 0x86, 0x6A, 0xA8, 0x62, 0x48, 0x4A, 0xA6, 0x29, 0x9E, 0x00, 0x95, 0xC0,
+0xE5, 0x21, 0x91, 0xC4, 0x0A, 0x4B, 0x8B, 0x5B, 0xE5, 0x29, 0x64, 0x19, 0x28, 0x32, 0xA7, 0x00,
+0x7E, 0xBD, 0x7C, 0xBE, 0x50, 0x74, 0xC1, 0x69, 0x32, 0x4B, 0x53, 0x55, 0x6B, 0xBF, 0x7F, 0x42,
+0x00, 0xAB, 0xA7, 0x95, 0xC1, 0xC9, 0x31, 0x47, 0x21, 0x99, 0xC0, 0x86, 0x21, 0xA1, 0xA9, 0xBB,
+0x95, 0xBE, 0xC2, 0xE3, 0x18, 0x05, 0x29, 0xA5, 0x18, 0xBF, 0xC2, 0x64, 0x10, 0x05, 0x19, 0x86,
+0x29, 0x95, 0xC1, 0xA5, 0x29, 0x44, 0x21, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0xA9, 0xC1, 0x23, 0x19,
+0x64, 0x21, 0x81, 0xC0, 0x85, 0x11, 0x79, 0xC2, 0x64, 0x09, 0x89, 0x32, 0x4B, 0x4B, 0x4E, 0x91,
+0xA5, 0xC1, 0x06, 0x32, 0x2B, 0x5B, 0xBB, 0xC1, 0x07, 0x42, 0x0C, 0x63, 0x96, 0xC0, 0x46, 0x29,
+0x40, 0xC2, 0x4E, 0x63, 0x66, 0x21, 0x05, 0x11, 0x6D, 0x00, 0x9A, 0xA6, 0x00, 0xBF, 0xAE, 0x7C,
+0x79, 0xC0, 0xC8, 0x29, 0x63, 0x99, 0x7A, 0xC0, 0x46, 0x32, 0x97, 0x43, 0x7E, 0xC0, 0x29, 0x32,
+0x52, 0x43, 0xC0, 0x48, 0x2A, 0x55, 0x91, 0x50, 0x00, 0xAB, 0x43, 0xC0, 0x09, 0x2A, 0x00, 0x7E,
+0x43, 0xC0, 0xE7, 0x31, 0x78, 0xBE, 0x7D, 0x96, 0xC4, 0xC4, 0x09, 0x24, 0x0A, 0x07, 0x13, 0xA8,
+0x1B, 0xE8, 0x23, 0xB2, 0xC3, 0x2C, 0x84, 0xCE, 0xFB, 0x82, 0xD8, 0x20, 0xF0, 0xB6, 0x00, 0x62,
+0x5D, 0xE0, 0x0F, 0x5F, 0x73, 0xC7, 0x0F, 0xFC, 0x19, 0xFF, 0x14, 0xC6, 0x6C, 0x84, 0xEA, 0x5B,
+0xA9, 0x3B, 0x08, 0x23, 0x86, 0x1A, 0xA2, 0x41, 0x7F, 0xB9, 0xC2, 0x63, 0x29, 0xA4, 0x31, 0x22,
+0x21, 0x00, 0xC0, 0x64, 0x29, 0x7B, 0xC6, 0x88, 0x52, 0xA9, 0x62, 0x25, 0x52, 0x81, 0x49, 0x25,
+0x83, 0xEB, 0xC4, 0xCD, 0xDD, 0xA3, 0xC1, 0x2A, 0xAC, 0x66, 0x72, 0x82, 0x8F, 0xC2, 0xCA, 0x5A,
+0xE6, 0x31, 0x43, 0x19, 0xAE, 0xA9, 0xC4, 0x04, 0x32, 0xA6, 0x42, 0x6A, 0x63, 0x09, 0x53, 0x05,
+0x32, 0x00, 0xC0, 0xE7, 0x29, 0xA2, 0xC2, 0x29, 0x32, 0xC8, 0x29, 0x08, 0x2A, 0x94, 0xA6, 0xAF,
+0xA1, 0xC1, 0x27, 0x32, 0x6B, 0x53, 0xB9, 0x45, 0xA1, 0xA1, 0x5B, 0xA6, 0x00, 0xC0, 0x85, 0x31,
+0x49, 0x96, 0x00, 0xA6, 0x80, 0xBE, 0xBF, 0x91, 0xA5, 0x00, 0xAB, 0xA6, 0xC5, 0x84, 0x18, 0x67,
+0x39, 0x05, 0x29, 0xA3, 0x10, 0x40, 0x08, 0xA1, 0x10, 0xA9, 0x00, 0xA6, 0xBF, 0xC1, 0x44, 0x21,
+0xA6, 0x29, 0x99, 0xC2, 0xC6, 0x31, 0x64, 0x21, 0xA5, 0x29, 0x81, 0x9F, 0xBF, 0x96, 0xC3, 0x48,
+0x2A, 0xE6, 0x21, 0x83, 0x19, 0xC3, 0x21, 0xA0, 0xA1, 0xC0, 0xC2, 0x31, 0xBF, 0x92, 0xA2, 0x97,
+0x95, 0xC0, 0xE6, 0x39, 0x49, 0xC3, 0x45, 0x19, 0xC8, 0x29, 0x66, 0x19, 0xE8, 0x29, 0x6A, 0x00,
+0xBF, 0x6D, 0xC2, 0xA7, 0x29, 0xE8, 0x31, 0x86, 0x29, 0x5F, 0xBD, 0xAE, 0xAE, 0x65, 0x00, 0x73,
+0x42, 0x9B, 0xC0, 0x08, 0x32, 0x4B, 0x48, 0xC0, 0x28, 0x2A, 0x99, 0x48, 0xAF, 0xBF, 0x43, 0x00,
+0x77, 0xA5, 0x40, 0xB9, 0xBE, 0x91, 0xAD, 0xC0, 0x24, 0x3A, 0x89, 0xC2, 0x43, 0x12, 0x26, 0x23,
+0xE8, 0x23, 0x91, 0xC4, 0x88, 0x2B, 0x2C, 0x84, 0xCE, 0xFB, 0x82, 0xD8, 0x20, 0xF0, 0xB6, 0x00,
+0xAE, 0x5D, 0xE0, 0x0F, 0xC0, 0x40, 0xF0, 0x73, 0xC6, 0x0F, 0xFC, 0x19, 0xFF, 0x13, 0xC6, 0x6C,
+0x84, 0x0A, 0x64, 0x68, 0x33, 0xE7, 0x1A, 0xA1, 0xB1, 0xC8, 0x82, 0x19, 0x61, 0x29, 0x03, 0x4A,
+0xA5, 0x6A, 0x0A, 0x94, 0x67, 0x7B, 0x05, 0x63, 0x01, 0x3A, 0x20, 0x21, 0x7C, 0xC1, 0xC9, 0x62,
+0x68, 0x62, 0xB8, 0xC0, 0x03, 0x62, 0xA4, 0xC7, 0xC4, 0x7A, 0x27, 0x8B, 0x85, 0x72, 0x67, 0x62,
+0xC9, 0x6A, 0x47, 0x52, 0x05, 0x3A, 0xE0, 0x10, 0x4F, 0xC6, 0x26, 0x5B, 0x09, 0x7C, 0xEC, 0x9C,
+0xAF, 0xB5, 0x0F, 0xA5, 0x0B, 0x7C, 0x65, 0x42, 0x6A, 0x78, 0xC0, 0xC7, 0x29, 0xAF, 0x00, 0xC0,
+0x28, 0x2A, 0x95, 0xA1, 0xC0, 0x07, 0x2A, 0x6B, 0x90, 0xC1, 0xA7, 0x42, 0xEA, 0x73, 0xB9, 0xC0,
+0x2A, 0x8C, 0xAE, 0xA2, 0x81, 0xC0, 0x28, 0x6B, 0x44, 0xC4, 0x01, 0x19, 0x43, 0x21, 0x85, 0x29,
+0xC7, 0x31, 0x45, 0x19, 0xBE, 0x41, 0xC0, 0x25, 0x21, 0x00, 0x91, 0x57, 0xBE, 0xA1, 0xA5, 0xC3,
+0x40, 0x18, 0xE1, 0x28, 0xA3, 0x41, 0x07, 0x6B, 0x95, 0xA1, 0xC4, 0x40, 0x31, 0x40, 0x10, 0x80,
+0x18, 0xE2, 0x18, 0x24, 0x19, 0xA5, 0xBE, 0xC0, 0xA5, 0x29, 0xAF, 0x43, 0xBF, 0x43, 0x91, 0xC1,
+0xC4, 0x29, 0x61, 0x21, 0xBD, 0xC2, 0x62, 0x4A, 0xC7, 0x7B, 0x0B, 0xA5, 0x00, 0xC3, 0xAB, 0x9C,
+0xC9, 0x83, 0x04, 0x4A, 0x21, 0x29, 0x5B, 0x9B, 0x6B, 0xC0, 0xC7, 0x21, 0x95, 0x43, 0x6F, 0xBF,
+0xC0, 0xE7, 0x29, 0xA1, 0xA0, 0x60, 0xA9, 0xC3, 0x44, 0x4A, 0xA8, 0x73, 0xEC, 0x9C, 0x2D, 0xA5,
+0x50, 0xC2, 0x0A, 0x84, 0x85, 0x52, 0x21, 0x29, 0x5B, 0xC1, 0xC6, 0x31, 0x08, 0x32, 0x81, 0xC0,
+0x28, 0x2A, 0xAF, 0xC1, 0xC7, 0x19, 0x29, 0x22, 0x40, 0xCE, 0x08, 0x22, 0x07, 0x32, 0x63, 0x21,
+0xA2, 0x31, 0x06, 0x6B, 0x4A, 0x94, 0x4D, 0xBD, 0xCF, 0xCD, 0x2C, 0xB5, 0xAA, 0x9C, 0xC6, 0x73,
+0x82, 0x32, 0x82, 0x1A, 0x46, 0x1B, 0xA7, 0x23, 0xB3, 0xC3, 0x0C, 0x84, 0xAE, 0xF3, 0x62, 0xD8,
+0x00, 0xF0, 0xBA, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0xC3, 0x40, 0xF0, 0x82, 0xD8, 0x0F, 0xFC, 0x19,
+0xFF, 0x7D, 0xC2, 0x8C, 0x84, 0x0A, 0x64, 0x27, 0x2B, 0x9A, 0xC6, 0xA4, 0x22, 0x01, 0x1A, 0x02,
+0x32, 0x67, 0x73, 0x4E, 0xBD, 0x93, 0xF6, 0xF3, 0xFE, 0x99, 0xCA, 0x90, 0xDE, 0x2B, 0xAD, 0x04,
+0x63, 0xC1, 0x39, 0x05, 0x4A, 0xA8, 0x62, 0xC9, 0x72, 0x67, 0x6A, 0x04, 0x5A, 0xC6, 0x72, 0x08,
+0x7B, 0x97, 0xAF, 0x45, 0xC0, 0xC3, 0x39, 0x90, 0xC4, 0x42, 0x4A, 0xCB, 0x9C, 0xB3, 0xDE, 0x13,
+0xEF, 0x54, 0xF7, 0xA6, 0x82, 0xC6, 0x32, 0xCE, 0x88, 0x73, 0x40, 0x21, 0xA3, 0x29, 0x06, 0x32,
+0xA6, 0x19, 0xE8, 0x21, 0xAD, 0xBE, 0xA6, 0xC6, 0x48, 0x32, 0x85, 0x21, 0xC0, 0x08, 0x85, 0x4A,
+0xEC, 0x9C, 0x91, 0xD6, 0x12, 0xEF, 0xAF, 0xC0, 0xD2, 0xE6, 0xAB, 0x5F, 0xC4, 0x4E, 0xAD, 0x68,
+0x73, 0xC3, 0x31, 0x21, 0x19, 0xA5, 0x29, 0xAB, 0xC0, 0x45, 0x21, 0xAB, 0x90, 0x68, 0xA6, 0x00,
+0xC1, 0xE3, 0x28, 0x80, 0x20, 0xBE, 0xC3, 0x45, 0x5A, 0x0E, 0xB5, 0x32, 0xD6, 0xD4, 0xEE, 0x90,
+0xBA, 0xC5, 0x4E, 0xC5, 0x88, 0x83, 0x82, 0x41, 0x60, 0x10, 0x64, 0x29, 0xC2, 0x10, 0x46, 0xC3,
+0x64, 0x19, 0xC6, 0x21, 0x09, 0x2A, 0x8A, 0x3A, 0x00, 0x53, 0x6D, 0xC4, 0x06, 0x63, 0x89, 0x94,
+0xAD, 0xBD, 0x12, 0xEF, 0xD4, 0xFF, 0xA6, 0x00, 0xC7, 0x35, 0xF7, 0x6F, 0xBD, 0x26, 0x6B, 0x60,
+0x29, 0x83, 0x29, 0xE5, 0x29, 0x85, 0x19, 0xE7, 0x21, 0x91, 0xBF, 0x00, 0x4B, 0xB5, 0xC5, 0x42,
+0x21, 0xC2, 0x31, 0x46, 0x6B, 0x31, 0xCE, 0x14, 0xEF, 0x95, 0xFF, 0x91, 0xBE, 0xA6, 0xC5, 0xF0,
+0xCD, 0x0A, 0x8C, 0xE3, 0x41, 0x83, 0x31, 0x06, 0x32, 0x08, 0x2A, 0xAE, 0xAB, 0x40, 0xC0, 0x49,
+0x2A, 0x4F, 0xBD, 0x58, 0xC3, 0xC2, 0x39, 0xC8, 0x83, 0xF0, 0xD5, 0x13, 0xF7, 0xA5, 0xC1, 0x33,
+0xFF, 0xD1, 0xF6, 0x95, 0x81, 0xC3, 0x0A, 0x9D, 0x64, 0x4B, 0x03, 0x23, 0x87, 0x2B, 0x91, 0xC3,
+0xEB, 0x7B, 0xAD, 0xF3, 0x62, 0xD8, 0x00, 0xF0, 0xBA, 0xE0, 0x12, 0xC7, 0x40, 0xF0, 0x82, 0xD8,
+0x0F, 0xFC, 0x3A, 0xFF, 0x14, 0xC6, 0x8C, 0x84, 0xEA, 0x63, 0xE6, 0x22, 0xAE, 0xCD, 0x42, 0x1A,
+0x20, 0x2A, 0x08, 0x7C, 0x51, 0xD6, 0xF3, 0xF6, 0x92, 0xF6, 0x2F, 0xE6, 0x6F, 0xEE, 0xCF, 0xEE,
+0x51, 0xF7, 0xB1, 0xE6, 0xE8, 0x8B, 0xC1, 0x41, 0xE4, 0x41, 0xA7, 0xC2, 0x88, 0x5A, 0xE9, 0x62,
+0x2A, 0x73, 0x56, 0x7D, 0x00, 0xC4, 0xE5, 0x41, 0x20, 0x29, 0x66, 0x73, 0x8D, 0xBD, 0xF2, 0xEE,
+0x00, 0xC0, 0x50, 0xDE, 0xBE, 0x91, 0xC5, 0xB2, 0xEE, 0x34, 0xFF, 0x6D, 0xBD, 0x83, 0x52, 0x82,
+0x29, 0xC5, 0x29, 0x9B, 0xAF, 0xAE, 0xBF, 0xA5, 0xBE, 0xC0, 0x43, 0x21, 0xBC, 0xC2, 0x29, 0x84,
+0xF2, 0xE6, 0x52, 0xF7, 0xA5, 0xC1, 0xD1, 0xEE, 0x70, 0xDE, 0xBE, 0xC1, 0x12, 0xEF, 0x53, 0xF7,
+0x96, 0xC4, 0x09, 0x84, 0x81, 0x29, 0x22, 0x21, 0xA6, 0x31, 0x46, 0x21, 0x96, 0xA9, 0xBA, 0x93,
+0xC6, 0x67, 0x31, 0x60, 0x18, 0xA0, 0x28, 0x06, 0x7B, 0x31, 0xDE, 0x96, 0xFF, 0xD3, 0xEE, 0x90,
+0x7B, 0xC1, 0x91, 0xEE, 0x13, 0xFF, 0x92, 0xC2, 0x0A, 0x94, 0x00, 0x29, 0x02, 0x21, 0x61, 0x9A,
+0x96, 0xAE, 0xC9, 0xC7, 0x19, 0x6A, 0x32, 0x4C, 0x53, 0xAC, 0x6B, 0x6C, 0x8C, 0x92, 0xD6, 0xB4,
+0xFF, 0x52, 0xFF, 0xB0, 0xEE, 0x4E, 0xDE, 0x91, 0x6D, 0xC6, 0xB1, 0xEE, 0x74, 0xFF, 0x51, 0xD6,
+0xE4, 0x62, 0x20, 0x19, 0xA4, 0x21, 0xC6, 0x29, 0x9F, 0xBF, 0xA6, 0x91, 0xB9, 0xA4, 0xC3, 0xC2,
+0x39, 0xC7, 0x7B, 0x90, 0xD6, 0xF3, 0xEE, 0xA9, 0xC4, 0x70, 0xDE, 0x0E, 0xCE, 0x2E, 0xDE, 0xD1,
+0xEE, 0xF2, 0xFE, 0x86, 0xC0, 0x09, 0x94, 0x69, 0x83, 0xC0, 0x27, 0x32, 0x57, 0x9E, 0xA6, 0x57,
+0x48, 0x78, 0xC2, 0x82, 0x31, 0xE9, 0x8B, 0x51, 0xE6, 0x75, 0xAE, 0xC0, 0xEF, 0xD5, 0xB9, 0xBE,
+0xBD, 0xC9, 0xAE, 0xF6, 0xEF, 0xEE, 0x4A, 0x9D, 0x84, 0x43, 0x24, 0x2B, 0x26, 0x23, 0xCB, 0x7B,
+0x8D, 0xF3, 0x62, 0xD8, 0x00, 0xF0, 0xBA, 0xE0, 0x12, 0x9E, 0xD2, 0x82, 0xD8, 0x30, 0xFC, 0x5A,
+0xFF, 0x34, 0xC6, 0x8C, 0x84, 0xC9, 0x5B, 0xE6, 0x22, 0x23, 0x0A, 0x41, 0x2A, 0x28, 0x7C, 0x0F,
+0xCE, 0x71, 0xDE, 0xAF, 0xCD, 0x4D, 0xC5, 0x8E, 0xCD, 0xCE, 0xD5, 0x6B, 0xC5, 0xAB, 0xD5, 0x12,
+0xFF, 0x4F, 0xC3, 0xA8, 0x83, 0x40, 0x31, 0xE5, 0x39, 0x68, 0x42, 0xBA, 0xAE, 0xA2, 0xC0, 0xE7,
+0x39, 0xA4, 0xB8, 0xC3, 0x63, 0x52, 0xCF, 0xC5, 0xF2, 0xEE, 0x2F, 0xD6, 0xA1, 0xC9, 0x30, 0xDE,
+0x72, 0xE6, 0x10, 0xDE, 0x6C, 0xCD, 0x4F, 0xE6, 0xB1, 0xEE, 0x0C, 0xAD, 0x43, 0x42, 0x62, 0x21,
+0x06, 0x2A, 0x92, 0x48, 0x00, 0xA6, 0xB4, 0xC4, 0x02, 0x21, 0x44, 0x52, 0xAE, 0xC5, 0xB4, 0xFF,
+0x8F, 0xDE, 0xA6, 0x4F, 0xC9, 0xD3, 0xF6, 0x50, 0xE6, 0xAD, 0xCD, 0x2D, 0xD6, 0x31, 0xF7, 0xB1,
+0xDE, 0x46, 0x6B, 0x21, 0x21, 0x45, 0x29, 0x67, 0x29, 0x96, 0xBD, 0xC0, 0x05, 0x19, 0xA6, 0x64,
+0xC1, 0x80, 0x20, 0x26, 0x73, 0x7B, 0x6B, 0xC0, 0x51, 0xDE, 0x9A, 0xC0, 0x93, 0xE6, 0xBE, 0xC6,
+0xEF, 0xDD, 0x8D, 0xCD, 0x91, 0xEE, 0xB3, 0xEE, 0x0A, 0x94, 0x21, 0x29, 0x24, 0x21, 0x9F, 0x9A,
+0x95, 0x5B, 0xC4, 0xC5, 0x19, 0xC8, 0x42, 0x6C, 0x84, 0x92, 0xCE, 0x33, 0xEF, 0xA0, 0xC1, 0x6F,
+0xDE, 0x91, 0xE6, 0xBF, 0x00, 0x91, 0xCA, 0x8C, 0xCD, 0x4F, 0xE6, 0x94, 0xFF, 0xEF, 0xC5, 0x43,
+0x4A, 0x41, 0x19, 0x07, 0x2A, 0xA6, 0x19, 0x08, 0x2A, 0x86, 0x19, 0xC7, 0x29, 0xBA, 0xC4, 0x63,
+0x29, 0xA5, 0x5A, 0x8C, 0xBD, 0x93, 0xFF, 0x71, 0xDE, 0xAB, 0xC0, 0xF3, 0xE6, 0xBE, 0x4F, 0xC3,
+0xED, 0xD5, 0x0D, 0xE6, 0xB0, 0xF6, 0x92, 0xEE, 0x51, 0xC1, 0x62, 0x21, 0xC5, 0x21, 0x48, 0xAF,
+0xBE, 0x7C, 0xA1, 0xBD, 0xC2, 0xE6, 0x6A, 0x31, 0xDE, 0x14, 0xFF, 0x71, 0xC1, 0xB4, 0xE6, 0x36,
+0xF7, 0xBE, 0x7A, 0xCA, 0xCC, 0xE5, 0x69, 0xD5, 0x4C, 0xE6, 0x4C, 0xCE, 0xA7, 0x7C, 0x02, 0x33,
+0x05, 0x23, 0xCB, 0x7B, 0x8D, 0xF3, 0x62, 0xD8, 0x00, 0xF0, 0xBA, 0xE0, 0x12, 0x9E, 0xC9, 0x82,
+0xD8, 0x30, 0xFC, 0x7B, 0xFF, 0x55, 0xCE, 0x6C, 0x84, 0xA9, 0x5B, 0x08, 0x33, 0xC2, 0x09, 0x05,
+0x53, 0xCF, 0xBD, 0x4F, 0xC3, 0xF0, 0xD5, 0x74, 0xDE, 0x58, 0xF7, 0xBA, 0xFF, 0xA5, 0xC1, 0xB3,
+0xF6, 0x0B, 0xCD, 0xAE, 0xC1, 0xF2, 0xFE, 0xCF, 0xCD, 0x4A, 0xC1, 0x63, 0x21, 0x85, 0x19, 0xAE,
+0x7C, 0xC4, 0x08, 0x32, 0xA6, 0x31, 0x02, 0x21, 0x42, 0x31, 0xAC, 0xA4, 0x5E, 0xC3, 0xF3, 0xF6,
+0x92, 0xEE, 0x56, 0xFF, 0xFB, 0xFF, 0xAB, 0xC7, 0x37, 0xFF, 0xEE, 0xDD, 0x4A, 0xD5, 0x2D, 0xE6,
+0xD1, 0xEE, 0x09, 0x84, 0x82, 0x29, 0xE6, 0x29, 0x7C, 0xAE, 0xA1, 0xAB, 0xC0, 0x44, 0x21, 0xB4,
+0xC1, 0x88, 0x83, 0x90, 0xEE, 0xAE, 0xC2, 0x92, 0xE6, 0x15, 0xEF, 0xBA, 0xFF, 0xAF, 0xA4, 0xC1,
+0x92, 0xEE, 0xAC, 0xCD, 0x94, 0xC4, 0x32, 0xF7, 0x6E, 0xB5, 0x04, 0x42, 0xE3, 0x20, 0x46, 0x29,
+0xAB, 0xC6, 0x86, 0x29, 0x04, 0x21, 0x87, 0x31, 0x03, 0x29, 0x81, 0x39, 0xAF, 0xC5, 0x54, 0xFF,
+0x47, 0xC1, 0xF5, 0xE6, 0xFC, 0xFF, 0x00, 0x55, 0xC3, 0x36, 0xFF, 0x4D, 0xCD, 0xCA, 0xBC, 0xD2,
+0xF6, 0x56, 0xC2, 0x84, 0x5A, 0xE2, 0x18, 0x04, 0x11, 0x68, 0x95, 0xAE, 0xC3, 0x41, 0x09, 0xE2,
+0x21, 0xCB, 0x84, 0x32, 0xDF, 0xA1, 0xC3, 0x90, 0xDE, 0xF3, 0xF6, 0xB8, 0xFF, 0xDB, 0xFF, 0xA6,
+0xC7, 0x58, 0xFF, 0x71, 0xEE, 0x4B, 0xCD, 0x4F, 0xDE, 0xB5, 0xFF, 0xCC, 0x94, 0xA2, 0x29, 0xE5,
+0x29, 0x87, 0xC2, 0xE8, 0x21, 0x87, 0x19, 0xC8, 0x29, 0xB5, 0xBC, 0xC1, 0x2B, 0x8C, 0xB0, 0xE6,
+0xAE, 0xC1, 0x98, 0xFF, 0xBA, 0xFF, 0x55, 0xA9, 0xC2, 0xB7, 0xFF, 0xB2, 0xEE, 0xED, 0xDD, 0x00,
+0xC4, 0x74, 0xFF, 0xED, 0xAC, 0x04, 0x3A, 0x64, 0x19, 0xE7, 0x21, 0x00, 0xC0, 0x28, 0x2A, 0xA0,
+0xA5, 0xC3, 0xC4, 0x39, 0x2B, 0x94, 0x93, 0xEE, 0xD5, 0xF6, 0x8A, 0xC1, 0xBB, 0xF7, 0xFE, 0xFF,
+0xA9, 0xCA, 0xDA, 0xFF, 0x13, 0xFF, 0xAB, 0xE5, 0x68, 0xCD, 0x6C, 0xDE, 0xEB, 0xAD, 0x84, 0x4B,
+0x04, 0x2B, 0xCB, 0x7B, 0x8D, 0xF3, 0x62, 0xD8, 0x5F, 0xB6, 0x00, 0xAE, 0x5D, 0xE0, 0x0F, 0x8E,
+0xC9, 0x82, 0xD8, 0x50, 0xFC, 0x9B, 0xFF, 0x75, 0xCE, 0x6C, 0x84, 0x88, 0x53, 0xA6, 0x2A, 0x44,
+0x22, 0x29, 0x84, 0x30, 0xD6, 0xB1, 0xC2, 0x93, 0xE6, 0xDB, 0xFF, 0xDD, 0xFF, 0xAE, 0x46, 0x4E,
+0xC6, 0x93, 0xF6, 0x48, 0xB4, 0x6C, 0xD5, 0x50, 0xE6, 0x09, 0x8C, 0x83, 0x21, 0xC6, 0x19, 0x00,
+0xC1, 0x45, 0x11, 0xA7, 0x21, 0xBA, 0xC2, 0x43, 0x29, 0x65, 0x52, 0x52, 0xE6, 0xA9, 0xAE, 0xC0,
+0x77, 0xFF, 0x50, 0x46, 0x5E, 0x50, 0xC7, 0x96, 0xFF, 0x2A, 0xCD, 0xC8, 0xB4, 0x12, 0xF7, 0xCF,
+0xC5, 0x23, 0x3A, 0xA3, 0x21, 0xE5, 0x21, 0xAB, 0x92, 0xBE, 0xB0, 0xC3, 0xA3, 0x39, 0xCC, 0xAC,
+0x73, 0xFF, 0x0E, 0xDE, 0x71, 0xC0, 0xFD, 0xFF, 0xA6, 0xC0, 0x5B, 0xFF, 0xAD, 0xC7, 0xB8, 0xFF,
+0x6F, 0xE6, 0x86, 0xAC, 0x4E, 0xDE, 0xB2, 0xE6, 0x07, 0x6B, 0xC1, 0x18, 0x46, 0x29, 0x9A, 0x6B,
+0x95, 0xC2, 0x66, 0x31, 0xE2, 0x20, 0xA4, 0x62, 0x5B, 0xA5, 0xC1, 0xF4, 0xEE, 0xFC, 0xFF, 0x92,
+0xAB, 0x46, 0x4E, 0xC7, 0x55, 0xFF, 0xA9, 0xB4, 0x2B, 0xCD, 0xF2, 0xFE, 0x6A, 0x9C, 0x83, 0x29,
+0x65, 0x19, 0xC6, 0x21, 0x95, 0xAE, 0xC4, 0x41, 0x11, 0xE1, 0x21, 0x8D, 0xA5, 0x52, 0xE7, 0xD0,
+0xDE, 0x5B, 0x71, 0xC0, 0xDC, 0xFF, 0xA3, 0xAE, 0x57, 0xC2, 0x76, 0xFF, 0x8D, 0xD5, 0xC9, 0xB4,
+0x70, 0xC3, 0x11, 0xC6, 0x64, 0x4A, 0xC5, 0x29, 0xE7, 0x29, 0x9B, 0x00, 0x7E, 0xC6, 0x44, 0x21,
+0x66, 0x52, 0xB0, 0xC5, 0x94, 0xFF, 0xB1, 0xEE, 0xBA, 0xFF, 0xDD, 0xFF, 0xA9, 0x46, 0xC0, 0xD9,
+0xFF, 0xA4, 0xC6, 0x2F, 0xE6, 0x88, 0xB4, 0xB1, 0xF6, 0x31, 0xD6, 0xE7, 0x62, 0x84, 0x21, 0x07,
+0x2A, 0x7E, 0x4B, 0xC5, 0x27, 0x3A, 0xC4, 0x31, 0x45, 0x4A, 0x4F, 0xBD, 0x73, 0xEE, 0xB4, 0xEE,
+0x5C, 0xC0, 0xFF, 0xFF, 0x86, 0xB5, 0x46, 0xC9, 0xF9, 0xFF, 0xB0, 0xFE, 0x86, 0xBC, 0x89, 0xCD,
+0x4C, 0xCE, 0xE5, 0x63, 0xE4, 0x2A, 0xCB, 0x7B, 0x8D, 0xEB, 0x62, 0xD8, 0x5F, 0xB6, 0x00, 0xAE,
+0x5D, 0xE0, 0x0F, 0xCE, 0x20, 0xE0, 0xA2, 0xC8, 0xB1, 0xFC, 0x7A, 0xFF, 0x54, 0xCE, 0x6B, 0x7C,
+0x67, 0x53, 0xA5, 0x32, 0x22, 0x2A, 0x89, 0xA4, 0xEE, 0xE5, 0xF0, 0xE5, 0x38, 0xFF, 0xBC, 0xFF,
+0xDE, 0xF7, 0x00, 0xA9, 0xB4, 0xC9, 0x37, 0xF7, 0xCF, 0xDD, 0xA5, 0x9B, 0xB0, 0xFE, 0x2C, 0xBD,
+0xC3, 0x31, 0x85, 0x19, 0xC7, 0x21, 0x66, 0x11, 0xA7, 0x11, 0xB9, 0xC6, 0x62, 0x21, 0x67, 0x73,
+0xB2, 0xF6, 0x30, 0xE6, 0x36, 0xFF, 0xFB, 0xFF, 0xBD, 0xF7, 0x96, 0xBA, 0x52, 0xC8, 0x99, 0xFF,
+0x15, 0xFF, 0x48, 0xA4, 0x4F, 0xE6, 0x33, 0xF7, 0x24, 0x5B, 0xC1, 0x21, 0xC4, 0x11, 0xE6, 0x11,
+0xB6, 0xB9, 0xB4, 0xC4, 0x43, 0x4A, 0xAF, 0xC5, 0x6F, 0xEE, 0x13, 0xFF, 0xDB, 0xFF, 0x56, 0xA7,
+0xBE, 0xC1, 0x7B, 0xF7, 0x78, 0xFF, 0x7A, 0xC5, 0x6B, 0xCD, 0xAB, 0xCD, 0x53, 0xFF, 0x09, 0x8C,
+0x21, 0x21, 0x44, 0x21, 0x93, 0xAF, 0xBE, 0xC3, 0x86, 0x31, 0x60, 0x10, 0x29, 0x94, 0xB1, 0xEE,
+0xAE, 0x47, 0xC1, 0xDC, 0xFF, 0xFE, 0xF7, 0x00, 0x5B, 0xC0, 0x99, 0xFF, 0xA8, 0xC6, 0x30, 0xE6,
+0x27, 0xAC, 0xF1, 0xFE, 0x6D, 0xC5, 0x83, 0x31, 0x24, 0x19, 0x86, 0x19, 0x00, 0x74, 0xC7, 0x63,
+0x19, 0x80, 0x29, 0x69, 0x8C, 0x31, 0xEF, 0xB0, 0xE6, 0x77, 0xFF, 0xFC, 0xFF, 0x9E, 0xFF, 0xAB,
+0xC0, 0xDF, 0xFF, 0x46, 0xC9, 0x16, 0xFF, 0xF3, 0xFE, 0x27, 0xA4, 0x0E, 0xDE, 0xF3, 0xF6, 0xA4,
+0x5A, 0x62, 0x21, 0xE7, 0x29, 0x66, 0x11, 0xE8, 0x21, 0xA4, 0xC2, 0x83, 0x21, 0x07, 0x63, 0xB3,
+0xEE, 0xB4, 0xC0, 0x76, 0xFF, 0x5C, 0xA7, 0xAB, 0xAD, 0xC0, 0x79, 0xF7, 0xB8, 0xC6, 0xD1, 0xFE,
+0x87, 0xBC, 0x0E, 0xE6, 0xB2, 0xF6, 0x07, 0x6B, 0x63, 0x29, 0xE6, 0x29, 0xA3, 0xAE, 0xB9, 0x94,
+0xC5, 0xC6, 0x5A, 0x53, 0xDE, 0xB4, 0xF6, 0x37, 0xFF, 0xDB, 0xFF, 0xDE, 0xFF, 0x71, 0xA6, 0xAD,
+0xC0, 0x57, 0xFF, 0xA8, 0xC7, 0x2A, 0xCD, 0xE7, 0xC4, 0x0C, 0xD6, 0x05, 0x7C, 0xA4, 0x2A, 0xEC,
+0x7B, 0x8D, 0xEB, 0xA2, 0xD8, 0x5F, 0xB6, 0xAE, 0x00, 0x5D, 0xE0, 0x0F, 0xC7, 0x20, 0xE0, 0xA2,
+0xC8, 0xB1, 0xFC, 0x7A, 0xFF, 0x54, 0xCE, 0x4B, 0x84, 0x67, 0x5B, 0x63, 0x2A, 0xB0, 0xC3, 0x88,
+0xA4, 0x0E, 0xEE, 0x93, 0xF6, 0xFB, 0xFF, 0x6A, 0xC0, 0x9E, 0xEF, 0x00, 0x71, 0xC0, 0xBC, 0xF7,
+0xB8, 0xC8, 0xB3, 0xF6, 0xC5, 0xA3, 0x6E, 0xFE, 0x4C, 0xCD, 0x04, 0x42, 0xA5, 0x21, 0xC7, 0x21,
+0x67, 0x11, 0xA8, 0x11, 0x74, 0xC2, 0xA2, 0x21, 0x87, 0x73, 0xD1, 0xF6, 0xBA, 0xC2, 0xB8, 0xFF,
+0xFC, 0xFF, 0xBE, 0xF7, 0x9B, 0xBD, 0xB9, 0xC0, 0x38, 0xF7, 0xBC, 0xC6, 0x48, 0xA4, 0xAC, 0xCD,
+0xF1, 0xEE, 0x64, 0x63, 0xE1, 0x21, 0xE3, 0x11, 0xC6, 0x11, 0xA6, 0xBD, 0xB8, 0xC1, 0x42, 0x42,
+0xCE, 0xC5, 0x53, 0xC2, 0x55, 0xFF, 0xFD, 0xFF, 0xDF, 0xF7, 0x92, 0xC0, 0xFF, 0xFF, 0xA4, 0xC0,
+0x9A, 0xFF, 0x52, 0xC5, 0x0E, 0xE6, 0x2A, 0xC5, 0x94, 0xFF, 0xAB, 0x9C, 0x81, 0x29, 0xA5, 0x29,
+0x97, 0xA3, 0xBE, 0xC7, 0xA6, 0x31, 0x21, 0x29, 0x28, 0x94, 0xB1, 0xEE, 0x13, 0xF7, 0xF9, 0xFF,
+0x9C, 0xF7, 0xFF, 0xEF, 0x91, 0xBD, 0xC0, 0x78, 0xF7, 0xB8, 0xC6, 0x51, 0xEE, 0xE5, 0xA3, 0x4E,
+0xF6, 0x0F, 0xDE, 0x83, 0x31, 0x25, 0x19, 0xA7, 0x21, 0x9E, 0xBA, 0xC3, 0x63, 0x19, 0x80, 0x29,
+0xE7, 0x83, 0xD0, 0xE6, 0xBB, 0xC2, 0x78, 0xFF, 0xDC, 0xFF, 0x7E, 0xFF, 0xAF, 0x65, 0xC7, 0x9B,
+0xFF, 0x36, 0xFF, 0xF3, 0xFE, 0x27, 0xA4, 0xEE, 0xDD, 0xD2, 0xEE, 0x05, 0x6B, 0x83, 0x29, 0x70,
+0xC0, 0xA7, 0x11, 0x00, 0xB8, 0xC6, 0xC3, 0x29, 0x06, 0x63, 0x71, 0xE6, 0xB2, 0xFE, 0xD7, 0xFF,
+0xFC, 0xFF, 0xFE, 0xFF, 0x00, 0xA9, 0xC0, 0xDA, 0xFF, 0xA8, 0xC6, 0xF2, 0xFE, 0xE9, 0xC4, 0xCD,
+0xE5, 0xD2, 0xF6, 0x47, 0x73, 0x62, 0x29, 0xE7, 0x31, 0x9B, 0x41, 0xAD, 0xC6, 0xA3, 0x29, 0xA5,
+0x52, 0xF1, 0xD5, 0x93, 0xEE, 0x56, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xA3, 0x95, 0xBD, 0x6C, 0xC9,
+0xF3, 0xF6, 0x67, 0xB4, 0xA6, 0xBC, 0x2B, 0xDE, 0x05, 0x7C, 0xC4, 0x2A, 0xEC, 0x7B, 0x8D, 0xEB,
+0xA2, 0xD8, 0x20, 0xF0, 0xB6, 0xAE, 0x00, 0x5D, 0xE0, 0x0F, 0x8A, 0xC6, 0x83, 0xD0, 0x92, 0xFC,
+0x5B, 0xFF, 0x35, 0xD6, 0x4C, 0x8C, 0x88, 0x5B, 0x43, 0x2A, 0xBC, 0xC3, 0xA8, 0xA4, 0x2E, 0xEE,
+0xD3, 0xFE, 0xFA, 0xFF, 0x63, 0xC0, 0x9D, 0xEF, 0xAE, 0x6A, 0xC0, 0xBB, 0xF7, 0xB8, 0xC5, 0x30,
+0xE6, 0x64, 0x9B, 0x2D, 0xF6, 0x0B, 0xBD, 0x25, 0x42, 0xA6, 0x21, 0xAB, 0x96, 0x40, 0xA4, 0xC2,
+0xE2, 0x29, 0xA6, 0x73, 0xD0, 0xEE, 0xBF, 0xC0, 0x96, 0xFF, 0x49, 0xC0, 0xDD, 0xF7, 0xAB, 0x00,
+0xB8, 0xCA, 0x77, 0xFF, 0x34, 0xFF, 0x88, 0xAC, 0xCC, 0xD5, 0xF1, 0xE6, 0xA5, 0x6B, 0xE1, 0x21,
+0x04, 0x1A, 0xE6, 0x11, 0x85, 0x09, 0xC5, 0x19, 0xB8, 0xC5, 0x62, 0x42, 0xCE, 0xC5, 0x11, 0xFF,
+0x54, 0xFF, 0xFC, 0xFF, 0xBE, 0xF7, 0x91, 0x5D, 0xB0, 0xC8, 0x59, 0xFF, 0xF4, 0xFE, 0x8C, 0xD5,
+0x0A, 0xBD, 0x53, 0xFF, 0x8B, 0x94, 0x61, 0x21, 0x84, 0x21, 0x86, 0x21, 0x92, 0xBA, 0xBC, 0xC1,
+0x21, 0x29, 0xE8, 0x93, 0x66, 0x46, 0xC2, 0x99, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0x9A, 0xA4, 0x78,
+0xC7, 0x56, 0xFF, 0xEF, 0xE5, 0x26, 0xAC, 0x6E, 0xF6, 0xCE, 0xD5, 0xA4, 0x31, 0x45, 0x19, 0xC7,
+0x21, 0xAF, 0x00, 0xC5, 0x84, 0x19, 0x81, 0x29, 0x45, 0x6B, 0xD1, 0xDE, 0x13, 0xEF, 0x98, 0xFF,
+0x57, 0xC0, 0xDF, 0xFF, 0x00, 0xCB, 0x9C, 0xF7, 0x59, 0xF7, 0x76, 0xFF, 0x70, 0xEE, 0x67, 0xAC,
+0x2F, 0xDE, 0x91, 0xDE, 0xE5, 0x5A, 0x83, 0x19, 0xC6, 0x19, 0x08, 0x12, 0xA6, 0x09, 0xBD, 0xC0,
+0xE4, 0x21, 0x77, 0xC3, 0x31, 0xD6, 0xF2, 0xFE, 0x95, 0xFF, 0xFB, 0xFF, 0x9B, 0xAB, 0x99, 0xC0,
+0x99, 0xF7, 0x5E, 0xC5, 0x90, 0xEE, 0xC8, 0xBC, 0x0E, 0xDE, 0xB2, 0xE6, 0x47, 0x63, 0x42, 0x11,
+0x79, 0xAF, 0xC0, 0x86, 0x11, 0xB9, 0xC6, 0xC3, 0x29, 0xA5, 0x52, 0xAF, 0xCD, 0xD3, 0xF6, 0x96,
+0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0x9B, 0xAB, 0xCB, 0xDC, 0xF7, 0xB8, 0xFF, 0xD1, 0xEE, 0x66, 0xAC,
+0x48, 0xCD, 0x2B, 0xD6, 0xC4, 0x73, 0xC4, 0x2A, 0xEC, 0x7B, 0x8D, 0xEB, 0xA2, 0xD8, 0x40, 0xF0,
+0xB2, 0xAE, 0x00, 0x5D, 0xE0, 0x0F, 0x8A, 0xCC, 0x83, 0xD0, 0x92, 0xFC, 0x3B, 0xFF, 0x15, 0xD6,
+0x4C, 0x8C, 0x88, 0x63, 0x63, 0x2A, 0xA2, 0x3A, 0xC8, 0x9C, 0x4D, 0xE6, 0xB2, 0xF6, 0x78, 0xFF,
+0xBC, 0xFF, 0x9F, 0xBF, 0x54, 0xB4, 0xC5, 0x56, 0xFF, 0x0B, 0xCD, 0xE6, 0xAB, 0xB0, 0xFE, 0x8A,
+0xAC, 0xE4, 0x39, 0x72, 0xAB, 0x95, 0xC0, 0xA7, 0x19, 0xAC, 0xC5, 0x03, 0x2A, 0x65, 0x63, 0xD0,
+0xE6, 0x11, 0xF7, 0x55, 0xFF, 0xD9, 0xFF, 0x63, 0xAB, 0x4A, 0xB8, 0x52, 0xC2, 0x2E, 0xE6, 0xA8,
+0xBC, 0x6F, 0xE6, 0x8B, 0xC2, 0x04, 0x5B, 0xC2, 0x19, 0x05, 0x1A, 0x97, 0xC7, 0x85, 0x09, 0xC5,
+0x11, 0xC3, 0x21, 0x42, 0x3A, 0x4C, 0xAD, 0xD1, 0xF6, 0x13, 0xFF, 0xBA, 0xFF, 0x63, 0xA6, 0xA5,
+0xA0, 0xC8, 0x57, 0xFF, 0x92, 0xEE, 0xC9, 0xB4, 0xEE, 0xD5, 0x91, 0xE6, 0xC8, 0x73, 0x41, 0x19,
+0x64, 0x19, 0x86, 0x19, 0xA2, 0xA5, 0xC3, 0x64, 0x21, 0xE0, 0x20, 0x87, 0x7B, 0xD3, 0xEE, 0xBB,
+0xC0, 0x37, 0xFF, 0x63, 0xA7, 0xAF, 0xC0, 0x5A, 0xEF, 0x6C, 0xC1, 0xB3, 0xEE, 0x2B, 0xC5, 0xA9,
+0xC5, 0x11, 0xFF, 0x69, 0x9C, 0xA4, 0x31, 0x45, 0x19, 0xA7, 0x19, 0xE7, 0x21, 0xA5, 0x90, 0xC6,
+0x81, 0x21, 0xA3, 0x52, 0x90, 0xD6, 0x13, 0xEF, 0x56, 0xF7, 0x9A, 0xFF, 0xDD, 0xFF, 0xA1, 0xC0,
+0x39, 0xEF, 0xB8, 0xC7, 0xF3, 0xFE, 0xCC, 0xDD, 0x2A, 0xBD, 0xD1, 0xEE, 0xCF, 0xBD, 0x43, 0x3A,
+0xC3, 0x19, 0x27, 0x1A, 0x97, 0x95, 0xC0, 0x06, 0x1A, 0x73, 0xC2, 0x84, 0x4A, 0xAF, 0xC5, 0xF2,
+0xFE, 0x9A, 0xC0, 0xFA, 0xFF, 0xAB, 0x00, 0x95, 0xC3, 0x77, 0xEF, 0xF3, 0xE6, 0x2F, 0xDE, 0x2A,
+0xC5, 0x66, 0xC4, 0xF0, 0xC5, 0xE7, 0x52, 0xA3, 0x19, 0x85, 0x09, 0xC6, 0x09, 0xB6, 0xA4, 0xC2,
+0xA3, 0x21, 0x44, 0x42, 0x0C, 0xB5, 0x66, 0xC1, 0x74, 0xFF, 0xF8, 0xFF, 0x55, 0xC0, 0xFD, 0xFF,
+0x00, 0xCB, 0x99, 0xF7, 0x55, 0xF7, 0x8F, 0xEE, 0x49, 0xCD, 0x4B, 0xE6, 0xCA, 0xBD, 0x83, 0x5B,
+0xE4, 0x2A, 0xEC, 0x83, 0x8D, 0xF3, 0x82, 0xD8, 0x20, 0xF0, 0xB6, 0xC0, 0x40, 0xF8, 0xA6, 0x5D,
+0xE0, 0x0F, 0x57, 0xC6, 0x83, 0xD0, 0xB2, 0xFC, 0x5B, 0xFF, 0x35, 0xCE, 0x6C, 0x84, 0xC9, 0x63,
+0x84, 0x22, 0xB8, 0xC3, 0x25, 0x84, 0xEC, 0xD5, 0xB1, 0xF6, 0x36, 0xFF, 0x7A, 0x63, 0xA9, 0xC0,
+0x58, 0xF7, 0x60, 0xC6, 0x31, 0xE6, 0xCA, 0xC4, 0x4C, 0xDD, 0x0F, 0xEE, 0x05, 0x73, 0x84, 0x29,
+0x86, 0x21, 0xAB, 0x95, 0xAE, 0xAD, 0xC6, 0xE3, 0x21, 0x83, 0x4A, 0xAD, 0xBD, 0xD1, 0xEE, 0x55,
+0xFF, 0x77, 0xFF, 0x9A, 0xFF, 0xAB, 0xC9, 0x39, 0xFF, 0xD6, 0xF6, 0x70, 0xF6, 0x2A, 0xD5, 0x6C,
+0xD5, 0x91, 0xEE, 0xCB, 0xA4, 0x02, 0x32, 0xC3, 0x19, 0xC5, 0x19, 0x97, 0xA6, 0xC0, 0xE6, 0x19,
+0xA0, 0xC5, 0xC1, 0x29, 0x08, 0x84, 0x2F, 0xDE, 0x33, 0xFF, 0x35, 0xFF, 0xB9, 0xFF, 0x00, 0xA6,
+0x60, 0xC8, 0xF4, 0xF6, 0x70, 0xE6, 0x2B, 0xBD, 0x33, 0xF7, 0x8E, 0xB5, 0xE5, 0x52, 0x82, 0x19,
+0x84, 0x19, 0x86, 0x19, 0xBA, 0x95, 0xC4, 0xC6, 0x29, 0x62, 0x21, 0xA4, 0x5A, 0xAF, 0xC5, 0xD3,
+0xF6, 0x4D, 0xC0, 0x79, 0xFF, 0xAF, 0xAF, 0xC7, 0x17, 0xEF, 0x14, 0xF7, 0x2F, 0xDE, 0x8B, 0xCD,
+0x6E, 0xE6, 0xB0, 0xE6, 0xE4, 0x62, 0xA4, 0x29, 0x63, 0xC0, 0xA6, 0x19, 0xAE, 0xA5, 0xA4, 0xB9,
+0xC3, 0x22, 0x3A, 0x0B, 0xA5, 0x91, 0xDE, 0x55, 0xFF, 0xAB, 0xC0, 0x59, 0xFF, 0xA9, 0x95, 0x52,
+0xC8, 0x90, 0xF6, 0xEC, 0xE5, 0x4E, 0xE6, 0xD1, 0xE6, 0x29, 0x84, 0xE2, 0x29, 0x25, 0x22, 0x47,
+0x1A, 0xC6, 0x09, 0xAE, 0xC0, 0x06, 0x1A, 0x64, 0xC5, 0xE2, 0x31, 0x49, 0x94, 0x70, 0xE6, 0x33,
+0xFF, 0x96, 0xFF, 0xB8, 0xFF, 0xAE, 0xA5, 0x4F, 0xC1, 0xB2, 0xE6, 0x4F, 0xE6, 0x95, 0xC4, 0xF2,
+0xEE, 0x6A, 0x8C, 0x85, 0x3A, 0x87, 0x2A, 0xE6, 0x11, 0x00, 0xBF, 0xA0, 0xA5, 0xC6, 0xC3, 0x29,
+0xA7, 0x83, 0xEE, 0xDD, 0xF1, 0xFE, 0x53, 0xFF, 0x76, 0xFF, 0xD9, 0xFF, 0x00, 0xC3, 0x35, 0xFF,
+0xD1, 0xF6, 0x8E, 0xF6, 0x2C, 0xE6, 0x8E, 0xC6, 0xC7, 0x8C, 0x23, 0x3B, 0x05, 0x2B, 0xEB, 0x83,
+0x8C, 0xF3, 0x81, 0xE0, 0x40, 0xF0, 0xB2, 0x64, 0xA6, 0x5D, 0xE0, 0x0F, 0x8E, 0xCD, 0xA3, 0xD0,
+0xB2, 0xFC, 0x5A, 0xFF, 0x34, 0xCE, 0x8C, 0x84, 0xE9, 0x63, 0xA4, 0x22, 0x41, 0x1A, 0x22, 0x53,
+0x09, 0xA5, 0x70, 0xE6, 0x14, 0xFF, 0x78, 0xFF, 0xDA, 0xFF, 0x7D, 0x76, 0x41, 0xC0, 0xCF, 0xDD,
+0xA5, 0xC4, 0x10, 0xEE, 0x69, 0xA4, 0xA0, 0x31, 0xA4, 0x21, 0xC7, 0x21, 0xAE, 0x74, 0x71, 0xAD,
+0xB8, 0xBC, 0xC2, 0xA6, 0x73, 0xEE, 0xCD, 0x13, 0xF7, 0xB7, 0xC1, 0x16, 0xFF, 0x99, 0xFF, 0x00,
+0xC1, 0x15, 0xFF, 0x2F, 0xF6, 0x80, 0xCD, 0xB1, 0xF6, 0xEF, 0xCD, 0x06, 0x63, 0xC2, 0x21, 0xE4,
+0x19, 0x84, 0x09, 0x86, 0x09, 0xC7, 0x11, 0x28, 0x22, 0xC4, 0x11, 0x61, 0x11, 0x83, 0x4A, 0xEC,
+0xAC, 0xF2, 0xF6, 0x77, 0xC0, 0x54, 0xFF, 0x52, 0x63, 0xC1, 0x34, 0xFF, 0xB1, 0xEE, 0xBE, 0x85,
+0x82, 0xC2, 0xE8, 0x7B, 0x02, 0x2A, 0xA3, 0x19, 0x9B, 0xA7, 0x74, 0xA5, 0xC0, 0xC6, 0x21, 0xBC,
+0xC2, 0x81, 0x31, 0x87, 0x7B, 0x51, 0xDE, 0x46, 0x92, 0xC0, 0x77, 0xFF, 0x00, 0xA9, 0x4B, 0xC0,
+0xD0, 0xEE, 0xAE, 0xC3, 0x6F, 0xDE, 0x89, 0x94, 0xE1, 0x31, 0xC4, 0x21, 0x97, 0xAE, 0x00, 0x99,
+0x66, 0xBD, 0xC3, 0x22, 0x32, 0x04, 0x5B, 0xAD, 0xB5, 0x54, 0xF7, 0xA7, 0xBB, 0xC0, 0x97, 0xFF,
+0xA9, 0xA9, 0xC0, 0xF1, 0xFE, 0x95, 0x9B, 0xC1, 0x0C, 0xA5, 0x42, 0x3A, 0x60, 0xC1, 0x66, 0x22,
+0xC4, 0x09, 0x97, 0xAE, 0xC0, 0x06, 0x12, 0x70, 0xC2, 0xA1, 0x21, 0xA3, 0x52, 0x4C, 0xB5, 0x7F,
+0x6B, 0x46, 0xC0, 0xB6, 0xFF, 0xAE, 0xC2, 0x74, 0xFF, 0x12, 0xF7, 0xB0, 0xEE, 0xAF, 0xC4, 0x2C,
+0xAD, 0x63, 0x42, 0xE3, 0x19, 0xE8, 0x32, 0x26, 0x12, 0x40, 0xBE, 0xC0, 0xC4, 0x11, 0x40, 0x5F,
+0xC2, 0x42, 0x4A, 0x89, 0xA4, 0x0D, 0xDE, 0x67, 0x46, 0x63, 0xAF, 0xA0, 0xCA, 0xF0, 0xFE, 0x8E,
+0xF6, 0xEB, 0xD5, 0x28, 0xA5, 0xA4, 0x4B, 0x23, 0x23, 0x46, 0x2B, 0x0B, 0x84, 0x6C, 0xF3, 0x82,
+0xE0, 0x40, 0xF0, 0xB2, 0xC0, 0x40, 0xF8, 0x96, 0x5D, 0xE0, 0x0F, 0xCD, 0x20, 0xE0, 0xC2, 0xD0,
+0xD1, 0xFC, 0x7A, 0xFF, 0x54, 0xCE, 0x8B, 0x84, 0x09, 0x64, 0xE5, 0x1A, 0x83, 0x12, 0x60, 0x2A,
+0x83, 0x63, 0x0A, 0xAD, 0x30, 0xDE, 0xF4, 0xF6, 0xAF, 0xC3, 0xB6, 0xFF, 0xF7, 0xFF, 0x33, 0xFF,
+0x4F, 0xE6, 0x92, 0xC4, 0x2D, 0xB5, 0x25, 0x63, 0xC1, 0x19, 0x24, 0x12, 0x46, 0x12, 0xB6, 0x00,
+0x9A, 0x96, 0xBD, 0xA4, 0xC4, 0x62, 0x32, 0x88, 0x8C, 0xEE, 0xC5, 0x91, 0xE6, 0x34, 0xFF, 0x68,
+0x79, 0xC1, 0x95, 0xFF, 0x8F, 0xEE, 0x96, 0xC2, 0xEF, 0xCD, 0xE9, 0x7B, 0x44, 0x32, 0x86, 0x87,
+0x96, 0xAB, 0xBF, 0xC0, 0x47, 0x12, 0xA1, 0xC5, 0xE3, 0x11, 0xE2, 0x21, 0x66, 0x6B, 0x2B, 0xAD,
+0x90, 0xE6, 0x32, 0xF7, 0xBF, 0xC0, 0x94, 0xFF, 0x44, 0xC0, 0xD1, 0xEE, 0x00, 0xC4, 0x70, 0xD6,
+0x07, 0x84, 0x82, 0x3A, 0xC2, 0x19, 0x04, 0x12, 0xA7, 0xA6, 0x01, 0x74, 0xC4, 0x25, 0x22, 0x61,
+0x19, 0x01, 0x42, 0x28, 0x94, 0x0E, 0xDE, 0xBF, 0xC0, 0xF3, 0xFE, 0x46, 0x00, 0xAD, 0xC6, 0xD0,
+0xE6, 0x6E, 0xD6, 0xC9, 0x94, 0x83, 0x42, 0xC2, 0x21, 0xE5, 0x19, 0x26, 0x1A, 0xA9, 0x01, 0xBA,
+0xB9, 0xBD, 0xC4, 0xE0, 0x29, 0xE6, 0x73, 0xAD, 0xBD, 0x71, 0xDE, 0x13, 0xF7, 0x57, 0xA9, 0x70,
+0xA5, 0xC4, 0x2E, 0xD6, 0x0B, 0xAD, 0xE4, 0x52, 0xA0, 0x19, 0x24, 0x22, 0x9F, 0xC1, 0xE4, 0x09,
+0x26, 0x0A, 0x45, 0x79, 0xBE, 0xC2, 0x23, 0x2A, 0xC0, 0x29, 0x65, 0x6B, 0x59, 0xC2, 0x2F, 0xDE,
+0x70, 0xEE, 0x53, 0xFF, 0x4B, 0x95, 0x90, 0xC2, 0x2E, 0xCE, 0x6C, 0xB5, 0x03, 0x53, 0x4A, 0xC1,
+0xE2, 0x11, 0xC7, 0x22, 0x45, 0xAE, 0x41, 0x96, 0x9B, 0x7E, 0xC5, 0xA1, 0x21, 0x03, 0x63, 0x46,
+0x9C, 0xCC, 0xD5, 0xB0, 0xEE, 0x12, 0xFF, 0xA6, 0xA9, 0xC5, 0x2D, 0xE6, 0xCB, 0xCD, 0xA6, 0x94,
+0xC4, 0x53, 0x43, 0x23, 0x65, 0x1B, 0xBB, 0xC3, 0x2C, 0x84, 0x8C, 0xF3, 0x61, 0xD8, 0x20, 0xF0,
+0xB6, 0xC0, 0x40, 0xF8, 0x5F, 0x5D, 0xE0, 0x0F, 0xC7, 0x20, 0xE0, 0xC2, 0xC8, 0xD1, 0xFC, 0x79,
+0xFF, 0x53, 0xC6, 0x8B, 0x84, 0x09, 0x5C, 0x26, 0x23, 0x95, 0xC5, 0x40, 0x12, 0x40, 0x2A, 0x64,
+0x6B, 0x0B, 0xAD, 0x30, 0xD6, 0x71, 0xE6, 0x9E, 0xBD, 0xC0, 0x4F, 0xDE, 0x81, 0xC2, 0x8A, 0x9C,
+0x05, 0x5B, 0x43, 0x2A, 0x8A, 0x8B, 0x9F, 0xB6, 0xC0, 0x86, 0x12, 0xA6, 0x9A, 0xC0, 0xA7, 0x12,
+0xA8, 0xC4, 0xC0, 0x09, 0xC2, 0x3A, 0xE6, 0x73, 0x8C, 0xB5, 0x90, 0xDE, 0x01, 0xA9, 0x96, 0xC6,
+0x8D, 0xB5, 0xC7, 0x73, 0xE1, 0x21, 0x44, 0x22, 0xE7, 0x22, 0x25, 0x0A, 0xA7, 0x1A, 0xA6, 0x92,
+0x95, 0xC0, 0x67, 0x12, 0x70, 0xC3, 0x02, 0x12, 0x22, 0x2A, 0x04, 0x5B, 0xE9, 0xA4, 0x62, 0xC0,
+0xB0, 0xDE, 0xBF, 0xAE, 0xC0, 0x70, 0xD6, 0x6D, 0xC4, 0xC6, 0x73, 0x20, 0x32, 0xE1, 0x19, 0x44,
+0x1A, 0xA6, 0x1A, 0xA7, 0x91, 0xB6, 0xC0, 0x66, 0x1A, 0x4A, 0xB9, 0xB1, 0xC5, 0x80, 0x21, 0xC0,
+0x39, 0x27, 0x94, 0x8C, 0xC5, 0xEE, 0xD5, 0x71, 0xE6, 0x80, 0x45, 0xC4, 0xCC, 0xBD, 0x46, 0x7C,
+0xA2, 0x42, 0xA1, 0x19, 0x45, 0x22, 0x86, 0xC0, 0x87, 0x22, 0xA9, 0x03, 0xBD, 0xC5, 0xE0, 0x19,
+0x00, 0x2A, 0x24, 0x5B, 0x0B, 0xA5, 0x50, 0xD6, 0xB1, 0xDE, 0x95, 0x7D, 0xC7, 0xCD, 0xBD, 0x28,
+0x84, 0x83, 0x4A, 0x80, 0x19, 0x44, 0x22, 0xE7, 0x32, 0x45, 0x1A, 0xA7, 0x22, 0x9E, 0xBF, 0xC0,
+0x46, 0x12, 0x52, 0xC1, 0xC6, 0x2A, 0xE2, 0x19, 0xBD, 0xC3, 0xA2, 0x4A, 0xAA, 0xA4, 0x2B, 0xB5,
+0xEE, 0xCD, 0x9A, 0x95, 0x81, 0xC4, 0x06, 0x74, 0xA1, 0x42, 0x41, 0x2A, 0x22, 0x12, 0xA5, 0x12,
+0x68, 0x91, 0xC1, 0xC6, 0x1A, 0x65, 0x1A, 0x6B, 0xC2, 0x47, 0x0A, 0x09, 0x23, 0x02, 0x1A, 0x5F,
+0xC3, 0x40, 0x42, 0xE5, 0x83, 0x0A, 0xAD, 0x8C, 0xBD, 0xA6, 0x00, 0xCA, 0xC8, 0xA4, 0x66, 0x84,
+0x22, 0x4B, 0xE1, 0x22, 0x65, 0x13, 0xA6, 0x13, 0x67, 0x23, 0x2C, 0x84, 0x8C, 0xEB, 0x62, 0xD8,
+0x20, 0xF0, 0xB6, 0xAE, 0x5F, 0x5D, 0x04, 0x62, 0x5D, 0xE0, 0x08, 0xC7, 0x41, 0xE8, 0xA2, 0xC8,
+0x12, 0xFD, 0x7A, 0xFF, 0xD2, 0xBD, 0xAC, 0x84, 0x6B, 0x64, 0x88, 0x2B, 0x81, 0xC6, 0xE3, 0x1A,
+0x60, 0x1A, 0x20, 0x32, 0xA2, 0x52, 0xA6, 0x7B, 0x69, 0x94, 0x0A, 0xA5, 0x95, 0xC4, 0x67, 0x8C,
+0x84, 0x6B, 0xA3, 0x42, 0x43, 0x2A, 0x84, 0x1A, 0x61, 0x9E, 0x00, 0xBA, 0xBB, 0x9A, 0x9A, 0x96,
+0xA5, 0xC6, 0xC4, 0x22, 0x61, 0x22, 0x60, 0x32, 0xE1, 0x52, 0xC5, 0x73, 0x88, 0x94, 0xC8, 0x94,
+0xA6, 0xC4, 0x84, 0x63, 0x04, 0x4B, 0x63, 0x32, 0x43, 0x1A, 0x86, 0x1A, 0x6D, 0x6A, 0xA5, 0xC0,
+0x28, 0x23, 0xA6, 0x96, 0x6A, 0x5E, 0xA1, 0xC0, 0x22, 0x1A, 0xB0, 0xC3, 0x41, 0x3A, 0x03, 0x5B,
+0x07, 0x7C, 0x8A, 0x8C, 0xA5, 0xC5, 0x86, 0x6B, 0x62, 0x42, 0xA0, 0x21, 0x22, 0x22, 0x64, 0x22,
+0xC6, 0x1A, 0xAF, 0xA6, 0x00, 0xA5, 0x00, 0x9A, 0x91, 0xC2, 0x24, 0x1A, 0x44, 0x2A, 0x01, 0x32,
+0xA1, 0xC3, 0x00, 0x42, 0x82, 0x5A, 0xE8, 0x83, 0x86, 0x73, 0x6E, 0xC0, 0x81, 0x42, 0x81, 0x8B,
+0xC1, 0x45, 0x22, 0x67, 0x1A, 0x99, 0x54, 0x5C, 0x61, 0xAB, 0x01, 0x5C, 0xB8, 0xC0, 0x42, 0x22,
+0xA0, 0xC3, 0x20, 0x32, 0xA3, 0x4A, 0x25, 0x5B, 0x65, 0x63, 0x9F, 0xC0, 0x62, 0x3A, 0x87, 0x97,
+0x9F, 0xC1, 0x87, 0x22, 0xC8, 0x22, 0x6B, 0x68, 0xC0, 0x49, 0x2B, 0x00, 0x96, 0x91, 0xA1, 0xA4,
+0xA4, 0xB5, 0xB5, 0x42, 0xC1, 0xE4, 0x4A, 0x25, 0x53, 0x80, 0xC0, 0x61, 0x32, 0x6D, 0xC1, 0x82,
+0x22, 0xE5, 0x22, 0x9F, 0x9F, 0xAB, 0xB9, 0x00, 0xB9, 0xAB, 0x97, 0xA6, 0xA0, 0xC0, 0x83, 0x1A,
+0x6D, 0xBE, 0xBF, 0xC1, 0xC3, 0x42, 0x04, 0x4B, 0x6A, 0x5B, 0x8D, 0x8F, 0xC1, 0x64, 0x1B, 0xC6,
+0x13, 0xBF, 0xC6, 0xC8, 0x2B, 0x6C, 0x8C, 0x6C, 0xE3, 0xA3, 0xE0, 0x00, 0xE8, 0x61, 0xF8, 0x00,
+0xF8, 0x06, 0xAE, 0x00, 0x5D, 0xE0, 0x07, 0xC7, 0x61, 0xF0, 0xC3, 0xC8, 0x13, 0xFD, 0x7B, 0xFF,
+0xD3, 0xB5, 0x8C, 0x84, 0x4B, 0x64, 0x47, 0x23, 0x9A, 0xA4, 0xC1, 0xC3, 0x22, 0x41, 0x2A, 0x67,
+0xBF, 0xBF, 0x43, 0xAE, 0x43, 0x86, 0x83, 0xC1, 0x44, 0x1A, 0xC6, 0x1A, 0x7A, 0x96, 0x77, 0xC0,
+0x27, 0x2B, 0x00, 0xAB, 0x9A, 0x79, 0x72, 0xC0, 0xA4, 0x1A, 0xA0, 0xB0, 0xBA, 0xC0, 0x40, 0x3A,
+0xAF, 0xB9, 0x7B, 0x9B, 0x86, 0xC3, 0x44, 0x22, 0xC6, 0x22, 0x49, 0x2B, 0x8A, 0x2B, 0xA5, 0xC1,
+0x07, 0x23, 0x48, 0x2B, 0x44, 0x41, 0x79, 0xA5, 0xA5, 0xC0, 0x65, 0x22, 0xA4, 0xB1, 0xA9, 0x01,
+0xA6, 0x66, 0x6D, 0x9A, 0x47, 0xC1, 0xA6, 0x22, 0xE7, 0x1A, 0x79, 0xA6, 0x6D, 0xB6, 0xAE, 0x41,
+0x68, 0x5F, 0xB6, 0xC0, 0x23, 0x2A, 0x4D, 0xBE, 0xC1, 0x22, 0x3A, 0xA1, 0x29, 0x00, 0x4D, 0xC0,
+0xE0, 0x21, 0xAF, 0x47, 0xC1, 0x87, 0x22, 0xC9, 0x2A, 0x94, 0x6B, 0xAD, 0xBF, 0xAB, 0x00, 0x96,
+0x00, 0xB9, 0xC0, 0x85, 0x22, 0x6A, 0xA5, 0xBA, 0xAF, 0x00, 0x6A, 0xC0, 0x64, 0x2A, 0x97, 0x96,
+0xC2, 0x47, 0x1A, 0x88, 0x1A, 0xC8, 0x22, 0x00, 0x6B, 0x44, 0x96, 0x00, 0x74, 0xA6, 0x95, 0xA5,
+0xB9, 0x7B, 0x79, 0xAE, 0xAE, 0x7E, 0x95, 0xC1, 0x84, 0x22, 0x06, 0x2B, 0x69, 0x9F, 0xAB, 0x00,
+0x72, 0x75, 0x71, 0x00, 0x70, 0x97, 0x68, 0x50, 0xA5, 0xB9, 0x00, 0x43, 0x01, 0x40, 0x4C, 0xC2,
+0xE5, 0x1A, 0x66, 0x1B, 0xC7, 0x23, 0xBF, 0xC5, 0x87, 0x33, 0x6D, 0x9C, 0x2B, 0xE3, 0x82, 0xD8,
+0x00, 0xE0, 0x20, 0xF8, 0xA6, 0x62, 0x5D, 0x03, 0x62, 0x00, 0x5D, 0xE0, 0x07, 0xAB, 0x8E, 0xC6,
+0x83, 0xC0, 0xB2, 0xFC, 0x1A, 0xFF, 0xB3, 0xAD, 0x8D, 0x7C, 0x2B, 0x64, 0x28, 0x2B, 0x9A, 0xA9,
+0xA5, 0xC1, 0xA5, 0x2A, 0x44, 0x2A, 0xA5, 0xA6, 0x84, 0xC0, 0x21, 0x22, 0xAF, 0x7B, 0x4E, 0x5C,
+0x70, 0xAF, 0x7F, 0xBA, 0xBA, 0xAE, 0xAB, 0x9A, 0x9A, 0x41, 0xC0, 0xC6, 0x22, 0xB9, 0xA5, 0xA1,
+0x7E, 0x79, 0x7E, 0xBF, 0x9E, 0xAB, 0xC0, 0xC7, 0x32, 0x51, 0xC0, 0xAB, 0x43, 0xAE, 0xC1, 0x69,
+0x33, 0xE7, 0x2A, 0xBE, 0xAF, 0x00, 0x97, 0xA5, 0xA6, 0xA5, 0xB9, 0xC0, 0x25, 0x22, 0xBA, 0x00,
+0xAD, 0xBB, 0xAE, 0xAF, 0x00, 0xC0, 0xE8, 0x32, 0xAF, 0x4B, 0xAE, 0x00, 0x4E, 0x51, 0xAE, 0x00,
+0x95, 0x49, 0xBA, 0xA0, 0x54, 0xBE, 0xC1, 0xC7, 0x42, 0x66, 0x3A, 0xAE, 0xAE, 0xAE, 0xAF, 0xAB,
+0xAB, 0xAB, 0x4C, 0xBD, 0x00, 0xAF, 0xAB, 0x00, 0x9B, 0xA6, 0xC0, 0x6B, 0x43, 0xA1, 0xA0, 0xA6,
+0x00, 0xBA, 0x43, 0x00, 0xC0, 0x4A, 0x4B, 0x5B, 0x5F, 0x00, 0xC1, 0x6C, 0x4B, 0xAC, 0x4B, 0xBA,
+0x99, 0xA9, 0x79, 0x00, 0x9B, 0x02, 0xA9, 0xB5, 0xA1, 0x00, 0xBE, 0xA6, 0xAF, 0xC1, 0xCB, 0x5B,
+0x0D, 0x64, 0x9E, 0xAB, 0x00, 0xAE, 0xA9, 0xBA, 0xB9, 0x00, 0xC0, 0x4E, 0x6C, 0xA6, 0x9E, 0xA6,
+0x00, 0x5F, 0xA9, 0xA5, 0xAB, 0x00, 0x9A, 0xAE, 0xC8, 0x4C, 0x5C, 0x8D, 0x5C, 0xCD, 0x64, 0xCD,
+0x74, 0x0E, 0x85, 0xB2, 0xD5, 0x6C, 0xF3, 0xC3, 0xE0, 0x41, 0xF0, 0xB6, 0x5D, 0xE0, 0x11, 0xC5,
+0x00, 0xE0, 0xA3, 0xC8, 0xD3, 0xFC, 0x5B, 0xFF, 0xD8, 0xE6, 0x34, 0xC6, 0x9A, 0xC0, 0x31, 0x8D,
+0x9A, 0xA5, 0xAB, 0xC0, 0x10, 0x95, 0x00, 0xAB, 0x6E, 0xAF, 0xAD, 0x01, 0xC0, 0x72, 0x95, 0xAB,
+0x99, 0x4B, 0xC0, 0xB4, 0x9D, 0xBA, 0xB9, 0xBB, 0xAE, 0x9A, 0x9A, 0x9E, 0xA5, 0xBA, 0xA9, 0xA6,
+0xA6, 0xA6, 0xAF, 0x65, 0xC0, 0xF4, 0xB5, 0x71, 0xBB, 0xC1, 0x16, 0xBE, 0x77, 0xC6, 0xAE, 0x95,
+0x46, 0xAF, 0xBA, 0x68, 0x00, 0x96, 0xA9, 0xA6, 0xBE, 0x54, 0xBB, 0xAE, 0xBD, 0xAB, 0x64, 0x5C,
+0x63, 0xC0, 0x98, 0xC6, 0x01, 0x9A, 0x6D, 0xAE, 0xBA, 0x00, 0xA5, 0x96, 0xC0, 0x98, 0xCE, 0xBE,
+0x00, 0x6B, 0xAE, 0xC0, 0xD8, 0xD6, 0xA2, 0x7F, 0x44, 0xBF, 0xAE, 0xBA, 0xAB, 0x00, 0xA5, 0xA9,
+0xBE, 0xAB, 0xAB, 0x00, 0x9B, 0x00, 0x95, 0xA6, 0xBA, 0x01, 0xBE, 0x65, 0x62, 0xAF, 0x69, 0x96,
+0x69, 0xAF, 0xBE, 0xAD, 0xA9, 0xA5, 0x74, 0xA6, 0x9F, 0xAB, 0x02, 0xA5, 0xBA, 0x6F, 0xBA, 0xAB,
+0x7C, 0x79, 0xAB, 0x01, 0xAE, 0x00, 0xB9, 0x00, 0xA9, 0x41, 0x7C, 0xAB, 0x40, 0xBF, 0xAE, 0x00,
+0x41, 0x9A, 0x41, 0x00, 0x79, 0xA6, 0x76, 0x7B, 0xBD, 0xBA, 0xC5, 0xDB, 0xFF, 0x39, 0xFF, 0x2B,
+0xFB, 0x20, 0xD8, 0x00, 0xE8, 0x00, 0xF8, 0xE0, 0x12, 0x8F, 0xC2, 0xE4, 0xE0, 0x92, 0xFC, 0x3B,
+0xFF, 0x41, 0x7A, 0xC0, 0xBB, 0xFF, 0x00, 0xA6, 0xAB, 0x00, 0xAE, 0x00, 0x54, 0x00, 0xAE, 0x52,
+0x46, 0x00, 0x52, 0x59, 0x52, 0x4D, 0x59, 0x52, 0x03, 0xAE, 0x01, 0xAE, 0x57, 0x52, 0x59, 0x01,
+0x4D, 0x59, 0x54, 0x77, 0xA5, 0xAE, 0xAE, 0x02, 0x41, 0xAB, 0x02, 0x41, 0x4D, 0x48, 0x01, 0x41,
+0x01, 0x48, 0x00, 0xAB, 0x48, 0x43, 0x00, 0xA9, 0x41, 0x48, 0x00, 0x41, 0x00, 0x48, 0x4F, 0x54,
+0x48, 0x00, 0x4D, 0x43, 0x00, 0x7C, 0x77, 0x01, 0xAB, 0x00, 0x77, 0x00, 0x70, 0x77, 0x7C, 0x7E,
+0x43, 0x01, 0xAB, 0x03, 0x43, 0x4A, 0x43, 0x7E, 0x03, 0x77, 0x70, 0x75, 0x00, 0x7C, 0x43, 0x01,
+0x4A, 0x00, 0x48, 0x00, 0x77, 0xA6, 0x01, 0xAB, 0xA6, 0x79, 0x74, 0x79, 0x00, 0x72, 0x02, 0x7E,
+0xAB, 0x01, 0xA6, 0x79, 0x77, 0x02, 0x72, 0x79, 0x7E, 0x43, 0x77, 0x00, 0x70, 0xC2, 0x98, 0xFE,
+0xEA, 0xFA, 0x41, 0xF0, 0xB5, 0x5D, 0xE0, 0x11, 0x62, 0x9A, 0xC3, 0x61, 0xE0, 0xAA, 0xFA, 0x2F,
+0xFC, 0x70, 0xFC, 0xA9, 0xAF, 0xAE, 0x41, 0xAB, 0xAE, 0x01, 0xA7, 0x96, 0xC0, 0xD2, 0xFC, 0xA6,
+0x46, 0x41, 0x9B, 0x54, 0x4D, 0x00, 0x91, 0xAE, 0x7C, 0x00, 0x41, 0x7C, 0x41, 0x7E, 0x4D, 0x7E,
+0x9A, 0xAB, 0xC0, 0xD2, 0xF4, 0x59, 0x54, 0x45, 0xA6, 0xA1, 0xC0, 0xAE, 0xF3, 0x91, 0x95, 0xA9,
+0x9A, 0x00, 0xB6, 0xAB, 0x6A, 0x00, 0xAE, 0x02, 0x92, 0xBF, 0x6A, 0x6F, 0xBA, 0x00, 0x79, 0xA6,
+0x71, 0x00, 0x65, 0x00, 0x6A, 0x00, 0x74, 0xA5, 0x00, 0xA9, 0x68, 0x6A, 0x71, 0xA6, 0x65, 0x6A,
+0xC0, 0x8D, 0xEB, 0x6A, 0x91, 0x91, 0xC0, 0x69, 0xCA, 0xA6, 0xB5, 0x00, 0xA5, 0x00, 0xA6, 0x4F,
+0x01, 0x9A, 0x01, 0xAB, 0xAE, 0x53, 0x01, 0x4C, 0x53, 0xC0, 0x48, 0xCA, 0x00, 0x58, 0x00, 0x5B,
+0x00, 0x99, 0x00, 0xAE, 0x00, 0x5D, 0xBA, 0x5B, 0xAB, 0x00, 0x9A, 0x53, 0x95, 0xA0, 0xC0, 0x44,
+0xB9, 0xA1, 0xA6, 0x9B, 0xA6, 0xBF, 0x00, 0xA9, 0x01, 0x42, 0xAB, 0x00, 0xAB, 0x44, 0x7C, 0x00,
+0xB6, 0xAD, 0x00, 0x99, 0x01, 0xAB, 0x00, 0xAE, 0x01, 0x7D, 0x99, 0xC1, 0x44, 0xD1, 0x41, 0xE0,
+0xB1, 0xC0, 0x00, 0xF8, 0xAE, 0x5D, 0xE0, 0x0B, 0x9E, 0x00, 0x5D, 0x62, 0x00, 0x5D, 0x62, 0x57,
+0xC1, 0x82, 0xF0, 0xC2, 0xD8, 0x9A, 0xB5, 0xA5, 0xAB, 0x00, 0xA6, 0x6C, 0x65, 0x6C, 0xAB, 0xAB,
+0x95, 0xA9, 0x65, 0x00, 0x9B, 0xAB, 0x73, 0x71, 0x9A, 0x00, 0x71, 0x00, 0x6C, 0x73, 0x67, 0x00,
+0x73, 0x70, 0x01, 0xAE, 0x00, 0x6C, 0x69, 0x9B, 0x70, 0x67, 0xB9, 0x00, 0x65, 0x6C, 0x00, 0x67,
+0x00, 0xA7, 0xBE, 0x6C, 0x00, 0x65, 0xA6, 0xC0, 0x62, 0xD8, 0x69, 0x99, 0xA9, 0x00, 0x60, 0x67,
+0xBF, 0xAB, 0x76, 0x67, 0x00, 0x76, 0x00, 0xA7, 0x6E, 0xB5, 0x00, 0x67, 0x6E, 0x00, 0x78, 0x76,
+0x00, 0xA5, 0x00, 0x67, 0xA6, 0x01, 0xB9, 0x00, 0x6A, 0x00, 0x65, 0x01, 0x6A, 0x00, 0x63, 0xAF,
+0x00, 0x6A, 0x02, 0x95, 0x00, 0x6C, 0x00, 0x6A, 0x63, 0x00, 0x6A, 0x67, 0x00, 0x6C, 0x00, 0x67,
+0x6A, 0x00, 0x71, 0xA6, 0x71, 0x6E, 0x76, 0xB9, 0x63, 0x5E, 0x6A, 0x65, 0xA6, 0x6C, 0xB9, 0x00,
+0xA9, 0x00, 0x5E, 0x6A, 0x00, 0x71, 0xBA, 0x71, 0x65, 0x60, 0x01, 0x65, 0x6A, 0x00, 0x65, 0x68,
+0x65, 0x00, 0x60, 0x65, 0x62, 0x6A, 0xC0, 0x61, 0xF8, 0xA1, 0x5D, 0x62, 0x5D, 0x02, 0x9A, 0x00,
+0x5D, 0x00, 0xAB, 0x00, 0x5D, 0xE0, 0x01, 0x9E, 0x02, 0x62, 0x5D, 0xC0, 0x40, 0xF8, 0x5D, 0x67,
+0xC0, 0x20, 0xE0, 0x61, 0x62, 0x5D, 0x06, 0x5A, 0x00, 0x5D, 0x62, 0x00, 0x5D, 0x5A, 0x5D, 0x00,
+0xC0, 0x40, 0xF0, 0x01, 0x62, 0x5D, 0x03, 0x5A, 0xAB, 0x01, 0x5A, 0x5D, 0x62, 0x5F, 0x64, 0x62,
+0x00, 0x5D, 0x00, 0x5A, 0x00, 0xBF, 0xA6, 0x5D, 0x00, 0x62, 0x00, 0x5A, 0x00, 0x64, 0x00, 0x62,
+0x01, 0x5D, 0x03, 0x5A, 0x00, 0x5D, 0x00, 0x61, 0x5A, 0x64, 0x5D, 0x00, 0x5A, 0x00, 0x64, 0x5D,
+0x02, 0x62, 0x69, 0x00, 0x64, 0x5D, 0x08, 0x67, 0x62, 0x5D, 0x00, 0x62, 0x02, 0x5A, 0x00, 0x5D,
+0x02, 0x5A, 0x5F, 0x5A, 0x5F, 0x5A, 0x5D, 0x01, 0x64, 0x00, 0x5A, 0x62, 0x00, 0x5D, 0x0A, 0x5A,
+0x00, 0x5D, 0x03, 0x64, 0x69, 0x5A, 0x00, 0x5D, 0x04, 0x9F, 0x85, 0x62, 0x5D, 0x00, 0x67, 0x5D,
+0x02, 0x5F, 0x5A, 0x5D, 0x00, 0x64, 0x00, 0x5D, 0x1E, 
+};
@@ -0,0 +1,3761 @@
+// Packed by packimage from teensy40_pinout1.h
+// 240x320 RGB565, 153600 bytes raw, 60079 bytes packed
+// tft.drawPackedImage(x, y, teensy40_pinout1_packed, sizeof(teensy40_pinout1_packed));
+
+const uint8_t teensy40_pinout1_packed[60079] PROGMEM = {
+0x52, 0x50, 0x00, 0x00, 0xF0, 0x00, 0x40, 0x01, 0xC1, 0xB2, 0x9C, 0xFF, 0xFF, 0x24, 0xC2, 0x7D,
+0xEF, 0x96, 0xB5, 0x71, 0x8C, 0x49, 0x71, 0xE0, 0x82, 0x70, 0x00, 0x71, 0x06, 0xC2, 0x3C, 0xE7,
+0x9A, 0xD6, 0xDB, 0xDE, 0x00, 0x48, 0x5C, 0x71, 0x01, 0x49, 0xC0, 0xBA, 0xD6, 0x75, 0x71, 0x01,
+0xC0, 0xFB, 0xDE, 0x48, 0x5C, 0x48, 0xC0, 0x1C, 0xE7, 0x71, 0x07, 0xC3, 0xCF, 0x7B, 0x65, 0x31,
+0x82, 0x18, 0xC3, 0x20, 0x5C, 0x71, 0xE0, 0x10, 0x49, 0x4D, 0x00, 0x48, 0x00, 0xBE, 0x5C, 0x4D,
+0x48, 0x00, 0x4D, 0xBB, 0xC0, 0xBE, 0xF7, 0x71, 0x33, 0x49, 0x5C, 0x70, 0x71, 0x0B, 0x75, 0xC0,
+0xD7, 0xBD, 0x48, 0x71, 0x0A, 0xC0, 0x5D, 0xEF, 0x78, 0xC2, 0xF3, 0xA4, 0x18, 0xC6, 0xDF, 0xFF,
+0x71, 0x0A, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x70, 0xC0, 0xE3, 0x20, 0x01, 0xC1, 0x25, 0x29,
+0x8E, 0x73, 0x71, 0x01, 0xC3, 0xCF, 0x7B, 0x41, 0x08, 0x69, 0x52, 0xDF, 0xFF, 0x71, 0x00, 0xC1,
+0x6D, 0x73, 0x04, 0x21, 0x91, 0x44, 0xC0, 0xF0, 0x83, 0x71, 0x07, 0xC3, 0x38, 0xC6, 0xAF, 0x7B,
+0x82, 0x10, 0x45, 0x29, 0x61, 0x71, 0xE0, 0x10, 0xC1, 0x92, 0x94, 0x82, 0x10, 0x64, 0xC0, 0xA6,
+0x39, 0x96, 0x50, 0x44, 0x50, 0x40, 0x00, 0x50, 0x7C, 0xC0, 0xF7, 0xBD, 0x71, 0x32, 0xC2, 0x38,
+0xCE, 0x34, 0xA5, 0xD7, 0xBD, 0x51, 0xC0, 0x96, 0xB5, 0x6C, 0x71, 0x08, 0x49, 0xC0, 0x28, 0x4A,
+0x54, 0xC0, 0x0C, 0x63, 0x71, 0x09, 0xC1, 0xF3, 0x9C, 0x24, 0x29, 0x64, 0xC0, 0x49, 0x4A, 0x44,
+0xC1, 0x08, 0x42, 0x59, 0xCE, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x6C, 0x51, 0x44,
+0xC1, 0x82, 0x10, 0x71, 0x94, 0x71, 0x01, 0x5D, 0x60, 0xC0, 0xA2, 0x18, 0x50, 0xC0, 0xDB, 0xDE,
+0x71, 0x00, 0x6C, 0x55, 0x68, 0xC0, 0x55, 0xAD, 0x6C, 0x71, 0x08, 0x55, 0xC1, 0x61, 0x10, 0x45,
+0x29, 0x61, 0x71, 0x39, 0x5D, 0xC1, 0x6D, 0x73, 0xB6, 0xB5, 0x71, 0x12, 0xC1, 0x71, 0x94, 0x62,
+0x10, 0x7D, 0xC0, 0x5D, 0xEF, 0x4D, 0xC0, 0x86, 0x31, 0x68, 0xC0, 0x8A, 0x52, 0x44, 0x00, 0xC1,
+0x30, 0x8C, 0x61, 0x10, 0x51, 0x71, 0x31, 0x75, 0x7D, 0xC0, 0xB2, 0x9C, 0xAB, 0x95, 0x51, 0x74,
+0x71, 0x08, 0xC0, 0x2C, 0x6B, 0x5C, 0xC1, 0xA2, 0x18, 0x0C, 0x63, 0x71, 0x08, 0xC0, 0x14, 0xA5,
+0x5C, 0xC0, 0x86, 0x31, 0x61, 0x71, 0xC1, 0x96, 0xB5, 0x82, 0x10, 0x64, 0xC0, 0xDB, 0xDE, 0x71,
+0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0x6C, 0x60, 0xC1, 0x61, 0x10, 0x4D, 0x6B, 0x71, 0x01,
+0xC0, 0x79, 0xCE, 0x7C, 0x00, 0xA5, 0xC0, 0xD3, 0x9C, 0x71, 0x01, 0xC0, 0x92, 0x94, 0x58, 0xC0,
+0x5D, 0xEF, 0x71, 0x09, 0x50, 0x5C, 0x64, 0x61, 0x71, 0x39, 0xC1, 0x55, 0xAD, 0x00, 0x00, 0x68,
+0x71, 0x12, 0xC0, 0x51, 0x8C, 0x70, 0x49, 0x71, 0xC3, 0x9E, 0xF7, 0xA6, 0x39, 0x82, 0x10, 0xCB,
+0x5A, 0x71, 0x00, 0xC1, 0xD7, 0xBD, 0x61, 0x10, 0x4C, 0x71, 0x31, 0x65, 0x44, 0x7C, 0xC1, 0x8E,
+0x73, 0x10, 0x84, 0x49, 0x7D, 0x71, 0x07, 0xC0, 0x71, 0x94, 0x70, 0xC0, 0x86, 0x31, 0x68, 0xC0,
+0x2C, 0x63, 0x71, 0x07, 0x44, 0xC2, 0x66, 0x31, 0x61, 0x10, 0x92, 0x94, 0x71, 0x01, 0xC2, 0xAA,
+0x52, 0x41, 0x08, 0x2D, 0x6B, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x08, 0x58, 0x63, 0xC1,
+0xA6, 0x39, 0x9E, 0xF7, 0x71, 0x00, 0xC2, 0x51, 0x8C, 0x65, 0x29, 0x28, 0x4A, 0x63, 0xC0, 0xEB,
+0x62, 0x71, 0x01, 0xC1, 0xCB, 0x5A, 0x49, 0x4A, 0x71, 0x01, 0xC0, 0x59, 0xCE, 0x7B, 0xC1, 0x0C,
+0x63, 0xCF, 0x7B, 0x51, 0x71, 0x02, 0x50, 0xC1, 0x61, 0x10, 0x45, 0x29, 0x61, 0x71, 0x02, 0xC2,
+0xBA, 0xD6, 0x92, 0x94, 0x8E, 0x73, 0x54, 0xC0, 0x18, 0xC6, 0x71, 0x03, 0x65, 0xC4, 0x10, 0x84,
+0x4D, 0x6B, 0xAE, 0x73, 0x75, 0xAD, 0x9E, 0xF7, 0x71, 0x02, 0xC0, 0xDB, 0xDE, 0x7C, 0x95, 0x71,
+0x79, 0x40, 0xC0, 0x8E, 0x73, 0x7D, 0x71, 0x00, 0xC0, 0x9A, 0xD6, 0x59, 0xC2, 0xEF, 0x7B, 0x96,
+0xB5, 0xFF, 0xFF, 0x03, 0x49, 0xC1, 0xF3, 0xA4, 0x4D, 0x6B, 0xA5, 0x7C, 0xC0, 0x3C, 0xE7, 0x71,
+0x07, 0x74, 0xC2, 0xC7, 0x39, 0x61, 0x10, 0xEF, 0x7B, 0x4D, 0x48, 0xC1, 0x5D, 0xEF, 0xFF, 0xFF,
+0x00, 0xC1, 0x9E, 0xF7, 0x55, 0xAD, 0x5D, 0xC2, 0x4D, 0x6B, 0x30, 0x84, 0x39, 0xCE, 0x71, 0x07,
+0x74, 0xC1, 0xF3, 0xA4, 0xDF, 0xFF, 0x71, 0x49, 0xC2, 0xA6, 0x39, 0x82, 0x10, 0xCB, 0x5A, 0x71,
+0x00, 0xC0, 0x5D, 0xEF, 0x77, 0x75, 0x6C, 0xC1, 0x96, 0xB5, 0x8E, 0x73, 0x70, 0x54, 0x4D, 0x71,
+0x03, 0x79, 0xC1, 0x10, 0x84, 0x2C, 0x63, 0x5D, 0xC0, 0xD7, 0xBD, 0x71, 0x02, 0xC0, 0x3C, 0xE7,
+0x69, 0x40, 0x44, 0x00, 0x50, 0xC1, 0xCF, 0x7B, 0x92, 0x94, 0x75, 0x71, 0x02, 0xC2, 0xDB, 0xDE,
+0x71, 0x94, 0x2C, 0x63, 0xBF, 0x54, 0x60, 0x71, 0x4C, 0xC0, 0xF3, 0xA4, 0x64, 0x00, 0x41, 0x48,
+0x71, 0x60, 0x41, 0x64, 0x50, 0x64, 0xC0, 0x3C, 0xE7, 0x68, 0x58, 0x67, 0xC0, 0x1C, 0xE7, 0x7D,
+0x71, 0x06, 0xC0, 0xB6, 0xBD, 0x63, 0xC0, 0x30, 0x8C, 0x58, 0xC1, 0x41, 0x08, 0x2C, 0x63, 0x71,
+0x07, 0xC2, 0x34, 0xAD, 0x82, 0x10, 0xE3, 0x20, 0x74, 0x71, 0x01, 0x48, 0x68, 0x5F, 0x70, 0x71,
+0x07, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x08, 0x69, 0x68, 0xC0, 0xC3, 0x18, 0x65, 0x71, 0x00, 0xC0,
+0x49, 0x4A, 0x7F, 0x50, 0x68, 0xC1, 0x65, 0x31, 0x5D, 0xEF, 0x71, 0xC0, 0x9E, 0xF7, 0x5F, 0x48,
+0x71, 0xA6, 0xC5, 0xCF, 0x7B, 0xA2, 0x18, 0x69, 0x52, 0xEF, 0x83, 0xA7, 0x39, 0x61, 0x10, 0x6C,
+0x71, 0x01, 0x50, 0x5C, 0xC0, 0x45, 0x29, 0x61, 0x71, 0x01, 0x48, 0xC0, 0xC3, 0x18, 0x73, 0xC1,
+0x51, 0x8C, 0x49, 0x4A, 0x5C, 0xC0, 0xEF, 0x83, 0x71, 0x00, 0x49, 0xC0, 0x2C, 0x6B, 0x68, 0xC3,
+0x08, 0x42, 0x31, 0x8C, 0xCB, 0x5A, 0x61, 0x10, 0x60, 0xC0, 0x9A, 0xD6, 0x71, 0xA1, 0xC1, 0x4D,
+0x6B, 0x24, 0x21, 0x63, 0x64, 0xC2, 0xEC, 0x62, 0x04, 0x21, 0x41, 0x08, 0x63, 0x7C, 0xC1, 0x51,
+0x8C, 0x6D, 0x73, 0x50, 0xC0, 0x41, 0x08, 0x5C, 0x00, 0xC0, 0x71, 0x94, 0x71, 0x01, 0x65, 0xC0,
+0x86, 0x31, 0x50, 0x6C, 0x7F, 0x68, 0xC0, 0xA6, 0x39, 0x48, 0x71, 0x05, 0xC0, 0x18, 0xC6, 0x50,
+0x7C, 0xBF, 0xC1, 0x24, 0x29, 0x65, 0x31, 0x50, 0xC0, 0xD3, 0x9C, 0x71, 0xC1, 0x59, 0xCE, 0xC7,
+0x39, 0x68, 0x44, 0xC0, 0x30, 0x8C, 0x40, 0x68, 0xC1, 0x8E, 0x73, 0xBE, 0xF7, 0x71, 0x09, 0x49,
+0x40, 0x68, 0xC0, 0xCB, 0x5A, 0x71, 0x02, 0xC1, 0x5D, 0xEF, 0x6A, 0x52, 0x70, 0xC2, 0x4D, 0x6B,
+0xCF, 0x7B, 0xE3, 0x20, 0x00, 0x69, 0x71, 0x01, 0x45, 0x70, 0xC3, 0x49, 0x4A, 0xEF, 0x83, 0xE7,
+0x41, 0x61, 0x10, 0x58, 0xC0, 0xDF, 0xFF, 0x71, 0xC0, 0x51, 0x8C, 0x64, 0xC0, 0x82, 0x18, 0xAF,
+0xC0, 0xEC, 0x62, 0x4C, 0x68, 0x5C, 0x00, 0xC1, 0x28, 0x42, 0x9E, 0xF7, 0x71, 0x00, 0xC0, 0x96,
+0xB5, 0x50, 0x00, 0xC0, 0xCF, 0x7B, 0x00, 0x64, 0x5F, 0x5D, 0xC0, 0xF3, 0xA4, 0x40, 0xC0, 0x41,
+0x08, 0x63, 0xC0, 0x69, 0x52, 0x60, 0x71, 0xC1, 0x55, 0xAD, 0xE7, 0x41, 0x5C, 0xC1, 0xCB, 0x5A,
+0x59, 0xCE, 0x78, 0xC0, 0x92, 0x94, 0x74, 0x7D, 0xC0, 0xAE, 0x73, 0x61, 0x71, 0x05, 0xC0, 0xDB,
+0xDE, 0x50, 0xC0, 0xAA, 0x5A, 0x71, 0xC1, 0x8E, 0x73, 0x41, 0x08, 0x75, 0x71, 0x07, 0x58, 0xC0,
+0x82, 0x10, 0x5F, 0xC0, 0x3C, 0xE7, 0x71, 0x01, 0x64, 0x77, 0x70, 0x7D, 0x71, 0x07, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x08, 0x61, 0xC0, 0x24, 0x29, 0x68, 0xC0, 0x51, 0x8C, 0x71, 0xC1, 0x1C, 0xE7,
+0xC3, 0x18, 0x64, 0x70, 0xC1, 0x04, 0x21, 0xA2, 0x18, 0x78, 0x71, 0xC0, 0x38, 0xC6, 0x70, 0x51,
+0x71, 0x59, 0xC1, 0x20, 0x08, 0xAA, 0x5A, 0x71, 0x00, 0x5C, 0xC0, 0x04, 0x21, 0x63, 0x78, 0x71,
+0x00, 0xC2, 0x14, 0xA5, 0x61, 0x10, 0x45, 0x29, 0x61, 0x71, 0x00, 0x59, 0xC0, 0x41, 0x08, 0x64,
+0xC0, 0x1C, 0xE7, 0x71, 0xC3, 0x10, 0x84, 0x21, 0x08, 0x04, 0x21, 0x5D, 0xEF, 0x71, 0xC0, 0x4D,
+0x6B, 0x48, 0xC1, 0xE7, 0x41, 0x9E, 0xF7, 0x71, 0x00, 0xC0, 0x0C, 0x63, 0x48, 0x54, 0x49, 0x71,
+0xC1, 0x9A, 0xD6, 0xCB, 0x5A, 0x68, 0xC1, 0x65, 0x31, 0x34, 0xA5, 0x4D, 0xC1, 0x55, 0xAD, 0x65,
+0x29, 0x77, 0x50, 0xC0, 0xB3, 0x9C, 0x48, 0x78, 0xC0, 0x86, 0x31, 0x68, 0x4C, 0xC0, 0xDF, 0xFF,
+0x71, 0xC0, 0x1C, 0xE7, 0x69, 0x68, 0x60, 0x71, 0x00, 0xC2, 0x6D, 0x73, 0x20, 0x08, 0x8A, 0x52,
+0x6C, 0x71, 0x04, 0x91, 0x65, 0xC1, 0x65, 0x31, 0x61, 0x10, 0x45, 0x75, 0x61, 0x58, 0xC0, 0xFC,
+0xE6, 0x6C, 0xC1, 0x41, 0x08, 0xEF, 0x83, 0x71, 0x00, 0xC1, 0xFB, 0xE6, 0x45, 0x29, 0x54, 0x74,
+0x71, 0x09, 0x49, 0xC0, 0xA6, 0x39, 0x68, 0xC0, 0xCB, 0x5A, 0x71, 0x01, 0x5D, 0x48, 0xC1, 0x20,
+0x08, 0x92, 0x94, 0x71, 0x00, 0xC1, 0x14, 0xA5, 0x61, 0x10, 0x64, 0x70, 0x71, 0xC0, 0xD3, 0x9C,
+0x4F, 0xC1, 0x69, 0x4A, 0xDF, 0xFF, 0x71, 0x75, 0x64, 0x5C, 0x55, 0x71, 0xC4, 0xDB, 0xDE, 0x51,
+0x8C, 0xA2, 0x18, 0xE3, 0x20, 0xEF, 0x7B, 0x65, 0xBF, 0xC1, 0x0C, 0x63, 0xA2, 0x18, 0x00, 0xC1,
+0xD7, 0xBD, 0xFF, 0xFF, 0x58, 0xC1, 0xC7, 0x39, 0x41, 0x08, 0x68, 0x71, 0x00, 0x50, 0xC0, 0xC3,
+0x18, 0x49, 0x71, 0x4D, 0x44, 0xC1, 0x82, 0x10, 0x55, 0xAD, 0x71, 0x01, 0xC2, 0xEF, 0x7B, 0xE7,
+0x41, 0xFF, 0xFF, 0x00, 0xC1, 0x1C, 0xE7, 0xB7, 0xBD, 0x60, 0x91, 0xC0, 0x9A, 0xD6, 0x71, 0x05,
+0x58, 0xC2, 0xE8, 0x41, 0x65, 0x31, 0x5D, 0xEF, 0x71, 0xC2, 0x6D, 0x6B, 0x41, 0x08, 0x2C, 0x63,
+0x71, 0x07, 0xC0, 0xAB, 0x5A, 0x68, 0x78, 0x44, 0x71, 0x01, 0x7D, 0x7C, 0xA5, 0xC0, 0xB2, 0x9C,
+0x71, 0x07, 0x70, 0x00, 0x71, 0x08, 0xA6, 0xC2, 0x49, 0x4A, 0x61, 0x10, 0xAA, 0x5A, 0x71, 0x55,
+0xC0, 0xE3, 0x20, 0x61, 0x71, 0x74, 0x54, 0xC0, 0x8E, 0x73, 0x71, 0xC2, 0x71, 0x94, 0x04, 0x21,
+0x7D, 0xEF, 0xA6, 0xC0, 0x45, 0x29, 0x68, 0xC0, 0x34, 0xAD, 0x71, 0x01, 0x74, 0xC0, 0x41, 0x10,
+0x75, 0x71, 0x00, 0xC1, 0x14, 0xA5, 0x61, 0x10, 0x64, 0x61, 0x71, 0x61, 0xC0, 0x24, 0x29, 0x5C,
+0x45, 0x71, 0x00, 0xC0, 0xF3, 0xA4, 0x58, 0xC0, 0x6D, 0x73, 0x6C, 0xC0, 0x59, 0xCE, 0x7C, 0x63,
+0xC0, 0x92, 0x94, 0x71, 0x01, 0x51, 0x7C, 0x5C, 0x41, 0x71, 0x00, 0xC0, 0xAE, 0x73, 0x5C, 0xC0,
+0x29, 0x4A, 0x71, 0x01, 0xC2, 0x6E, 0x73, 0x61, 0x08, 0x08, 0x42, 0x71, 0x01, 0x45, 0x5C, 0xC1,
+0x65, 0x31, 0x3C, 0xE7, 0x71, 0xC0, 0x10, 0x84, 0x54, 0xC0, 0x49, 0x4A, 0x71, 0x01, 0xC2, 0x55,
+0xAD, 0xA2, 0x18, 0xE3, 0x20, 0x4D, 0x71, 0x05, 0xC0, 0x5D, 0xEF, 0x6C, 0x54, 0xC0, 0xD3, 0x9C,
+0x71, 0x01, 0xC0, 0xEF, 0x83, 0x5C, 0xC1, 0x04, 0x21, 0xDB, 0xDE, 0x71, 0x01, 0xC3, 0x8E, 0x73,
+0x82, 0x10, 0x24, 0x29, 0x1C, 0xE7, 0x71, 0x08, 0x49, 0xC0, 0xA6, 0x39, 0x68, 0xC0, 0xCB, 0x5A,
+0x71, 0x01, 0xC0, 0x96, 0xB5, 0x68, 0x58, 0xC0, 0x1B, 0xE7, 0x71, 0x00, 0x4D, 0x50, 0xC0, 0x61,
+0x10, 0x64, 0xC1, 0xBE, 0xF7, 0x86, 0x31, 0x5C, 0x7C, 0x71, 0x01, 0xC0, 0xAA, 0x52, 0x57, 0xC0,
+0xCB, 0x5A, 0x71, 0x00, 0xC0, 0xB6, 0xBD, 0x68, 0x50, 0xC0, 0xBA, 0xD6, 0x71, 0x00, 0xC1, 0xBA,
+0xDE, 0x04, 0x21, 0x68, 0xC0, 0xF3, 0xA4, 0x71, 0x75, 0x58, 0xC0, 0xA2, 0x18, 0x5C, 0xC0, 0x5D,
+0xEF, 0x71, 0x61, 0xC0, 0x71, 0x8C, 0x5D, 0x71, 0x00, 0xC2, 0xAA, 0x5A, 0x61, 0x10, 0x8A, 0x52,
+0x71, 0x00, 0x49, 0xC0, 0x45, 0x29, 0x7C, 0x71, 0x02, 0x44, 0x5D, 0x71, 0x06, 0xC0, 0x4D, 0x6B,
+0x70, 0xC0, 0x59, 0xCE, 0x71, 0x00, 0xC0, 0x6D, 0x6B, 0x54, 0xC0, 0x2C, 0x6B, 0x71, 0x07, 0x48,
+0x68, 0xC1, 0xC7, 0x39, 0x9E, 0xF7, 0x71, 0x01, 0xC1, 0x18, 0xC6, 0xC3, 0x18, 0x70, 0xC0, 0x51,
+0x8C, 0x71, 0x07, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x09, 0xC0, 0x10, 0x84, 0x68, 0x64, 0xC0, 0x7D,
+0xEF, 0x78, 0xC0, 0x28, 0x42, 0x71, 0x00, 0x45, 0x5C, 0xC0, 0xE7, 0x41, 0x5D, 0xC1, 0xCB, 0x5A,
+0x49, 0x4A, 0x71, 0xC4, 0xD7, 0xBD, 0xA2, 0x18, 0xE3, 0x20, 0x08, 0x42, 0xAA, 0x52, 0x48, 0x00,
+0xC0, 0x04, 0x21, 0x4F, 0x65, 0x71, 0x00, 0xC1, 0x14, 0xA5, 0x61, 0x10, 0x64, 0x61, 0x71, 0xC0,
+0x35, 0xAD, 0x68, 0x7C, 0xC0, 0x96, 0xB5, 0x71, 0x01, 0x5D, 0x71, 0x00, 0xC0, 0x92, 0x94, 0x63,
+0x70, 0x7D, 0x71, 0x01, 0xC0, 0xDB, 0xDE, 0x64, 0x63, 0xC0, 0x2C, 0x6B, 0x71, 0x00, 0xC1, 0x8E,
+0x73, 0x61, 0x10, 0x65, 0x5D, 0x71, 0x00, 0x40, 0xC2, 0x41, 0x08, 0xE7, 0x41, 0x9E, 0xF7, 0x71,
+0x00, 0x41, 0x5C, 0x6C, 0xC0, 0x1C, 0xE7, 0x71, 0x74, 0xC0, 0xA2, 0x18, 0x6C, 0x48, 0x00, 0x4D,
+0xC1, 0xE7, 0x39, 0x82, 0x10, 0x91, 0xC0, 0xB6, 0xBD, 0x71, 0x05, 0xC0, 0x1C, 0xE7, 0x6C, 0x54,
+0x6D, 0x71, 0x00, 0xA6, 0x74, 0x68, 0xC0, 0xA6, 0x39, 0x58, 0x71, 0x01, 0xC1, 0xD3, 0x9C, 0xA2,
+0x18, 0x00, 0xC0, 0x96, 0xB5, 0x71, 0x08, 0x49, 0x40, 0x68, 0xC0, 0xCB, 0x5A, 0x71, 0x01, 0xC0,
+0xCF, 0x7B, 0x68, 0xC0, 0x24, 0x29, 0x79, 0x48, 0x00, 0x74, 0x70, 0xC3, 0x00, 0x00, 0x71, 0x94,
+0x9A, 0xD6, 0xC3, 0x18, 0x44, 0x5B, 0x4D, 0xA6, 0x00, 0x58, 0x54, 0xC1, 0xC7, 0x39, 0xDF, 0xFF,
+0x71, 0x78, 0x68, 0xC1, 0x04, 0x21, 0x59, 0xCE, 0x71, 0x00, 0x75, 0xC0, 0x86, 0x31, 0x63, 0xC0,
+0xD3, 0x9C, 0x71, 0x6C, 0xC4, 0x0C, 0x63, 0x61, 0x10, 0xA2, 0x18, 0xA7, 0x39, 0xF4, 0xA4, 0x6C,
+0x71, 0x02, 0xC0, 0x55, 0xAD, 0x68, 0x44, 0xC0, 0x79, 0xCE, 0x71, 0x64, 0x58, 0xC0, 0x5D, 0xEF,
+0x71, 0x0B, 0xC0, 0x92, 0x94, 0x63, 0xC0, 0x14, 0xA5, 0x71, 0x01, 0xC0, 0x6D, 0x6B, 0x54, 0xC0,
+0x2C, 0x6B, 0x71, 0x07, 0x48, 0xC2, 0x82, 0x10, 0xA6, 0x39, 0x7D, 0xEF, 0x71, 0x01, 0xC1, 0xD7,
+0xBD, 0xC3, 0x18, 0x70, 0xC0, 0x92, 0x94, 0x71, 0x07, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x09, 0x4C,
+0xC0, 0xA2, 0x18, 0x7C, 0x50, 0xC1, 0x86, 0x31, 0x51, 0x8C, 0x71, 0x00, 0xC0, 0x38, 0xC6, 0x7C,
+0xBF, 0x4C, 0xC1, 0x65, 0x31, 0x31, 0x8C, 0x71, 0x55, 0x70, 0xC0, 0xE3, 0x20, 0x59, 0x64, 0x01,
+0xC0, 0x96, 0xB5, 0x00, 0xC0, 0x18, 0xC6, 0x71, 0x00, 0x50, 0x5C, 0xC0, 0x45, 0x29, 0x61, 0x71,
+0xC1, 0x71, 0x94, 0x82, 0x10, 0x44, 0xC0, 0xF7, 0xC5, 0x71, 0x04, 0x7B, 0x68, 0x44, 0x60, 0x71,
+0x01, 0x75, 0xC0, 0x86, 0x31, 0x68, 0x4D, 0x71, 0x00, 0xC2, 0x8E, 0x73, 0x61, 0x10, 0x28, 0x42,
+0x5D, 0x71, 0x00, 0xC0, 0x10, 0x84, 0x57, 0xC1, 0xE7, 0x41, 0x9E, 0xF7, 0x71, 0x00, 0x41, 0x5C,
+0x6C, 0xC1, 0x1C, 0xE7, 0xDF, 0xFF, 0x54, 0x68, 0x48, 0xC0, 0x55, 0xAD, 0x01, 0xAE, 0x7D, 0xA6,
+0x75, 0x71, 0x05, 0x70, 0xC1, 0x65, 0x31, 0x41, 0x08, 0x6D, 0x71, 0x00, 0x58, 0xC0, 0xE7, 0x41,
+0x68, 0xC0, 0x08, 0x42, 0x5D, 0x71, 0x01, 0x5F, 0xC0, 0xA2, 0x18, 0x00, 0xC0, 0xD3, 0x9C, 0x71,
+0x08, 0x49, 0xC0, 0xA6, 0x39, 0x68, 0xC0, 0xCB, 0x5A, 0x71, 0x01, 0xC0, 0x2C, 0x6B, 0x63, 0x40,
+0xC0, 0x34, 0xAD, 0x64, 0x00, 0x69, 0x7D, 0xA6, 0xC0, 0xDB, 0xDE, 0x78, 0xC0, 0xA3, 0x18, 0xAE,
+0xC0, 0x30, 0x8C, 0x64, 0x01, 0x78, 0x00, 0xC1, 0xF7, 0xC5, 0xDF, 0xFF, 0x71, 0x78, 0x68, 0xC0,
+0x04, 0x21, 0x74, 0x71, 0x00, 0x75, 0xC0, 0x86, 0x31, 0x63, 0xC0, 0xD3, 0x9C, 0x71, 0x00, 0x49,
+0xC0, 0x8E, 0x73, 0x44, 0xC0, 0x61, 0x10, 0x68, 0x60, 0xC0, 0x18, 0xC6, 0x71, 0x01, 0x49, 0x40,
+0x5C, 0xC0, 0x10, 0x84, 0x71, 0xC1, 0x8A, 0x52, 0x6D, 0x73, 0x71, 0x0B, 0x49, 0x50, 0x77, 0x48,
+0x02, 0x78, 0xC3, 0xC3, 0x18, 0x65, 0x31, 0x69, 0x52, 0x0C, 0x63, 0x49, 0x71, 0x04, 0x70, 0x68,
+0xC1, 0x45, 0x29, 0x5D, 0xEF, 0x71, 0x01, 0xC0, 0x75, 0xB5, 0x77, 0xA9, 0xC0, 0x34, 0xAD, 0x71,
+0x07, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x09, 0x75, 0x73, 0x77, 0xC1, 0xC7, 0x39, 0x24, 0x29, 0x74,
+0x71, 0x00, 0xC0, 0x9E, 0xF7, 0x4C, 0xC3, 0xA2, 0x18, 0x49, 0x4A, 0x24, 0x29, 0xF7, 0xBD, 0x71,
+0xC0, 0x96, 0xB5, 0x68, 0xC0, 0xC3, 0x18, 0x60, 0x71, 0x06, 0xC0, 0x14, 0xA5, 0x5C, 0x64, 0x61,
+0x71, 0xC0, 0xD3, 0x9C, 0x68, 0x70, 0x55, 0x71, 0x04, 0x59, 0x63, 0x70, 0x7D, 0x71, 0x01, 0x61,
+0x64, 0x68, 0xC0, 0x0C, 0x63, 0x71, 0x00, 0xC0, 0x8E, 0x73, 0x5C, 0x65, 0x5D, 0x71, 0x00, 0x40,
+0x57, 0xC1, 0xE7, 0x41, 0x9E, 0xF7, 0x71, 0x00, 0x41, 0x5C, 0xC1, 0x65, 0x31, 0x1C, 0xE7, 0x71,
+0x65, 0x5C, 0xC0, 0xCB, 0x5A, 0x71, 0x0C, 0x70, 0x6C, 0xC0, 0x41, 0x08, 0x6D, 0x71, 0x00, 0xA6,
+0xC2, 0x28, 0x4A, 0x82, 0x10, 0xA6, 0x39, 0x58, 0x71, 0x01, 0x7C, 0xC0, 0xA2, 0x18, 0x00, 0xC0,
+0x55, 0xAD, 0x71, 0x08, 0x49, 0x40, 0x68, 0x5C, 0x71, 0x01, 0xC1, 0x8E, 0x73, 0x61, 0x10, 0x40,
+0x5D, 0x71, 0x04, 0x51, 0x70, 0x00, 0x7D, 0x71, 0x06, 0x78, 0x68, 0xC1, 0x04, 0x21, 0x59, 0xCE,
+0x71, 0x00, 0x75, 0xC0, 0x86, 0x31, 0x63, 0x7C, 0x71, 0x02, 0x74, 0xC1, 0x2C, 0x6B, 0xE3, 0x20,
+0x68, 0xC1, 0x65, 0x31, 0x1C, 0xE7, 0x71, 0x01, 0xC0, 0xEF, 0x83, 0x5C, 0x5B, 0xC2, 0x38, 0xCE,
+0x24, 0x29, 0x59, 0xCE, 0x71, 0x0B, 0x49, 0xC0, 0xAA, 0x5A, 0x6F, 0x95, 0x02, 0xC0, 0x45, 0x29,
+0x44, 0x64, 0xC0, 0xE7, 0x41, 0x48, 0xC0, 0x5D, 0xEF, 0x71, 0x04, 0xC3, 0x71, 0x94, 0x82, 0x10,
+0x04, 0x21, 0xBA, 0xD6, 0x71, 0x01, 0xC3, 0xB2, 0x9C, 0xA2, 0x18, 0xE3, 0x20, 0x9A, 0xD6, 0x71,
+0x07, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0A, 0xC1, 0xAA, 0x5A, 0xA2, 0x18, 0x00, 0x54, 0xC0, 0xDF,
+0xF7, 0x71, 0x01, 0xC0, 0x8E, 0x73, 0x68, 0x77, 0x6C, 0xC0, 0x5D, 0xEF, 0x71, 0x61, 0xC0, 0x04,
+0x21, 0x68, 0xC0, 0x4D, 0x6B, 0x71, 0x06, 0xC1, 0x14, 0xA5, 0x61, 0x10, 0x64, 0x61, 0x71, 0x74,
+0xC0, 0xC3, 0x18, 0x70, 0xC0, 0xCB, 0x5A, 0x71, 0x04, 0xC0, 0x18, 0xC6, 0x77, 0x68, 0xC0, 0x92,
+0x94, 0x71, 0x01, 0x60, 0x7C, 0xC1, 0x61, 0x10, 0xB2, 0x9C, 0x71, 0x00, 0x58, 0x5C, 0x65, 0x5D,
+0x71, 0x00, 0xC0, 0x10, 0x84, 0x57, 0x54, 0xC0, 0x9E, 0xF7, 0x71, 0x00, 0x41, 0x5C, 0x6C, 0xC0,
+0xFB, 0xE6, 0x71, 0xC0, 0x8E, 0x73, 0x63, 0xC0, 0x24, 0x29, 0x4D, 0x71, 0x0B, 0xC0, 0x1C, 0xE7,
+0x6C, 0xC0, 0x41, 0x08, 0x68, 0x71, 0x01, 0xC0, 0xAE, 0x73, 0x63, 0xC1, 0x04, 0x21, 0xDB, 0xDE,
+0x71, 0x01, 0xC1, 0xAE, 0x7B, 0x82, 0x10, 0x50, 0x61, 0x71, 0x08, 0x49, 0xC0, 0xA6, 0x39, 0x68,
+0xC0, 0xCB, 0x5A, 0x71, 0x01, 0xC0, 0x14, 0xA5, 0x68, 0xBE, 0xC0, 0x55, 0xAD, 0x71, 0x04, 0x75,
+0xC0, 0x45, 0x29, 0x68, 0xC0, 0xEC, 0x62, 0x71, 0x06, 0xC0, 0x96, 0xB5, 0x68, 0xC0, 0x04, 0x21,
+0x74, 0x71, 0x00, 0x75, 0xC0, 0x86, 0x31, 0x63, 0xC0, 0xD3, 0x9C, 0x71, 0x48, 0xC1, 0xEB, 0x5A,
+0x5D, 0xEF, 0x71, 0x00, 0xC1, 0x14, 0xA5, 0xC3, 0x18, 0x70, 0xC0, 0xD7, 0xBD, 0x71, 0x01, 0xC1,
+0x7A, 0xD6, 0xE3, 0x20, 0xAF, 0xC1, 0xC7, 0x39, 0x8A, 0x52, 0x71, 0x13, 0xC0, 0x6D, 0x6B, 0x54,
+0xC0, 0x2C, 0x63, 0x71, 0x02, 0xC0, 0x96, 0xB5, 0x6D, 0xC0, 0x7D, 0xEF, 0x71, 0x00, 0xC0, 0x9A,
+0xD6, 0x44, 0x70, 0x5F, 0x71, 0x01, 0xC0, 0x2C, 0x6B, 0x54, 0xC1, 0x28, 0x4A, 0xBE, 0xF7, 0x71,
+0x07, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0A, 0xC1, 0x72, 0x94, 0x82, 0x10, 0x00, 0x67, 0x71, 0x02,
+0xC1, 0x96, 0xB5, 0xA2, 0x18, 0x00, 0x5C, 0x71, 0x01, 0xC1, 0xAE, 0x73, 0x61, 0x10, 0x7C, 0xC1,
+0x51, 0x8C, 0x5D, 0xEF, 0x71, 0x44, 0x55, 0x53, 0xC0, 0xDF, 0xFF, 0x71, 0x55, 0x5C, 0x64, 0xC0,
+0x3C, 0xE7, 0x71, 0x00, 0xC0, 0xEB, 0x62, 0x5C, 0x77, 0xC2, 0xCF, 0x7B, 0x1C, 0xE7, 0xBE, 0xF7,
+0x4D, 0x45, 0x48, 0x71, 0xC2, 0xCB, 0x5A, 0x21, 0x08, 0x08, 0x42, 0x5D, 0x71, 0x00, 0xC0, 0x6D,
+0x6B, 0x4F, 0x4C, 0x44, 0x71, 0x00, 0xC2, 0xAE, 0x7B, 0x61, 0x10, 0x28, 0x4A, 0x71, 0x01, 0x54,
+0xC0, 0x41, 0x08, 0x5B, 0x71, 0x01, 0xC0, 0x14, 0xA5, 0x5C, 0xC0, 0x65, 0x31, 0x44, 0x71, 0x48,
+0xC2, 0x04, 0x21, 0x82, 0x10, 0x28, 0x4A, 0x74, 0xC0, 0xDF, 0xFF, 0x00, 0x48, 0xC1, 0x4D, 0x6B,
+0xD7, 0xBD, 0x71, 0x05, 0xC5, 0x5D, 0xEF, 0x65, 0x31, 0x82, 0x10, 0xCB, 0x5A, 0x7D, 0xEF, 0xDF,
+0xFF, 0x5D, 0x4D, 0xC0, 0x24, 0x21, 0x57, 0x45, 0x71, 0x00, 0x75, 0xC0, 0x86, 0x31, 0x54, 0xC0,
+0xCF, 0x7B, 0x71, 0x09, 0x5D, 0x40, 0x68, 0x5C, 0x71, 0x01, 0x49, 0xC3, 0xE7, 0x41, 0x61, 0x10,
+0x65, 0x31, 0x96, 0xB5, 0x5D, 0x71, 0xC1, 0xFB, 0xDE, 0x10, 0x84, 0x6D, 0x71, 0x40, 0x5C, 0x7C,
+0x40, 0x75, 0x71, 0x49, 0xC1, 0x55, 0xAD, 0x4D, 0x6B, 0x5D, 0x71, 0x4C, 0x68, 0x50, 0x4D, 0x71,
+0x00, 0xC1, 0x7D, 0xF7, 0x86, 0x31, 0x5C, 0xC0, 0xF3, 0xA4, 0x71, 0xC0, 0x38, 0xC6, 0x68, 0x79,
+0x71, 0x00, 0x48, 0x7C, 0x50, 0xC0, 0xDB, 0xDE, 0x71, 0x02, 0xC1, 0xAA, 0x52, 0x82, 0x18, 0x96,
+0x64, 0x71, 0x13, 0xC2, 0x6D, 0x6B, 0x41, 0x08, 0x2C, 0x63, 0x71, 0x01, 0xC0, 0xF7, 0xC5, 0x68,
+0x4F, 0xC0, 0x8E, 0x73, 0x71, 0x01, 0xC2, 0x4D, 0x6B, 0x20, 0x08, 0xCB, 0x5A, 0x71, 0x00, 0x70,
+0xC0, 0x45, 0x29, 0x68, 0xC0, 0x75, 0xAD, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0A, 0x65,
+0xC0, 0x61, 0x10, 0x96, 0x7D, 0x71, 0x02, 0xC3, 0x5D, 0xEF, 0x24, 0x29, 0x00, 0x00, 0x51, 0x8C,
+0x71, 0x01, 0xC1, 0x9E, 0xF7, 0x0C, 0x63, 0x68, 0x91, 0xC0, 0x24, 0x29, 0x78, 0x58, 0x77, 0xC0,
+0xCF, 0x7B, 0x71, 0xC1, 0x34, 0xA5, 0x49, 0x4A, 0x4F, 0x68, 0xC1, 0x4D, 0x6B, 0x18, 0xC6, 0x71,
+0xC1, 0x3C, 0xE7, 0x8A, 0x52, 0x68, 0x4F, 0x50, 0x64, 0x4B, 0x78, 0xC0, 0xDB, 0xDE, 0x71, 0x75,
+0x48, 0xC0, 0x61, 0x10, 0x74, 0xC1, 0xD3, 0x9C, 0x2C, 0x63, 0x68, 0x5B, 0xC0, 0x9A, 0xD6, 0x71,
+0xA6, 0xC0, 0x14, 0xA5, 0x78, 0x4F, 0xC1, 0xC3, 0x18, 0x51, 0x8C, 0x6C, 0x51, 0x47, 0x4F, 0x7C,
+0x45, 0xC0, 0x9E, 0xF7, 0x65, 0xC4, 0x28, 0x4A, 0x20, 0x08, 0x82, 0x10, 0x6D, 0x73, 0x9A, 0xD6,
+0x71, 0xC0, 0x75, 0xB5, 0x64, 0xC1, 0x41, 0x08, 0xA2, 0x18, 0x78, 0xA5, 0xC0, 0xE3, 0x20, 0x78,
+0xC0, 0xBA, 0xD6, 0x71, 0x05, 0xA6, 0xC0, 0x6A, 0x52, 0x54, 0x5C, 0xC0, 0x25, 0x29, 0x78, 0x50,
+0x71, 0xC1, 0xD7, 0xBD, 0x65, 0x31, 0x68, 0xC2, 0x8E, 0x73, 0xB2, 0x9C, 0xE7, 0x39, 0x68, 0xC0,
+0x6D, 0x73, 0x5D, 0x71, 0x08, 0xC1, 0x96, 0xB5, 0xEB, 0x62, 0x68, 0x57, 0xC0, 0x04, 0x21, 0x4C,
+0xC0, 0x59, 0xCE, 0x71, 0x00, 0x48, 0xC0, 0xE7, 0x41, 0x5C, 0x00, 0x6C, 0xAF, 0x50, 0x4B, 0x69,
+0x71, 0x5D, 0xC1, 0x4D, 0x6B, 0xA2, 0x18, 0x4F, 0xC0, 0x24, 0x21, 0x78, 0x91, 0x77, 0x4C, 0xC3,
+0xDF, 0xFF, 0xD7, 0xBD, 0x8A, 0x52, 0x41, 0x08, 0x5C, 0xC0, 0x0C, 0x63, 0x61, 0xC1, 0x7D, 0xEF,
+0xAE, 0x7B, 0x68, 0x4F, 0xC1, 0x28, 0x4A, 0x96, 0xB5, 0x74, 0x63, 0x5B, 0xC4, 0x92, 0x94, 0xD3,
+0x9C, 0xE7, 0x41, 0x82, 0x10, 0x71, 0x94, 0x71, 0x03, 0xC0, 0x55, 0xAD, 0x63, 0xC1, 0xA6, 0x39,
+0x9E, 0xF7, 0x71, 0x13, 0x44, 0xC0, 0x20, 0x08, 0x70, 0x71, 0x01, 0x7D, 0xC0, 0x41, 0x08, 0x48,
+0x75, 0x71, 0x01, 0xC1, 0x5D, 0xEF, 0x8A, 0x52, 0x57, 0x70, 0x7C, 0xC0, 0xC7, 0x39, 0x68, 0xC0,
+0x51, 0x8C, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0A, 0x58, 0xC0, 0x72, 0x94, 0x54, 0xC0,
+0x7D, 0xF7, 0x71, 0x03, 0xC0, 0x14, 0xA5, 0x7B, 0xC0, 0xBA, 0xDE, 0x71, 0x03, 0xC4, 0xB6, 0xBD,
+0xCF, 0x7B, 0x0C, 0x63, 0x4D, 0x6B, 0x92, 0x94, 0x4D, 0x71, 0x00, 0x59, 0xC0, 0xEF, 0x7B, 0x54,
+0x00, 0x60, 0x78, 0xC0, 0xFF, 0xFF, 0x00, 0xA6, 0x69, 0x60, 0xC0, 0x2C, 0x6B, 0x60, 0xC0, 0x75,
+0xB5, 0x5D, 0x71, 0x02, 0xC3, 0x96, 0xB5, 0x8E, 0x73, 0xCB, 0x5A, 0x6D, 0x6B, 0x64, 0x5D, 0x71,
+0x00, 0x5D, 0x54, 0x91, 0x54, 0x45, 0x40, 0x5D, 0x64, 0xC0, 0xCF, 0x7B, 0x54, 0xA5, 0x81, 0xC0,
+0x7D, 0xEF, 0x7D, 0x6C, 0x54, 0x00, 0x60, 0xC1, 0x38, 0xCE, 0xFF, 0xFF, 0x00, 0x61, 0xC0, 0x92,
+0x94, 0x44, 0x70, 0x6C, 0x78, 0x5D, 0x71, 0x07, 0xC0, 0x3C, 0xE7, 0x59, 0x60, 0x48, 0xC1, 0xB6,
+0xBD, 0x9E, 0xF7, 0x71, 0x00, 0x75, 0x7C, 0xC0, 0x2C, 0x63, 0x91, 0xC0, 0xEF, 0x7B, 0x65, 0xC0,
+0xFF, 0xFF, 0x0A, 0x64, 0x60, 0x54, 0x00, 0x48, 0x60, 0x65, 0x71, 0x01, 0x58, 0xC0, 0x14, 0xA5,
+0x53, 0x70, 0xC0, 0x8E, 0x73, 0x50, 0xC0, 0x5D, 0xEF, 0x71, 0x02, 0xC0, 0xD7, 0xBD, 0x6C, 0x70,
+0x7F, 0xC1, 0x71, 0x94, 0x9A, 0xD6, 0x71, 0x00, 0x64, 0x6C, 0x54, 0x00, 0xC0, 0xAE, 0x73, 0x48,
+0x44, 0x6C, 0xC0, 0x30, 0x8C, 0x54, 0x6C, 0x41, 0xC0, 0x9E, 0xF7, 0x50, 0xC1, 0x8E, 0x73, 0xAA,
+0x5A, 0x96, 0x58, 0xC0, 0xF7, 0xC5, 0x71, 0x04, 0x49, 0xC1, 0x04, 0x21, 0x10, 0x84, 0x71, 0x14,
+0xC1, 0x6D, 0x73, 0x61, 0x10, 0x7F, 0x71, 0x01, 0xA6, 0x68, 0x58, 0xC0, 0xFB, 0xDE, 0x71, 0x02,
+0x6C, 0xC2, 0x14, 0xA5, 0xEB, 0x62, 0x69, 0x52, 0x53, 0xC0, 0x18, 0xC6, 0x71, 0x0A, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0xE0, 0x73, 0x65, 0xC1, 0x24, 0x29, 0xDB, 0xDE, 0x71, 0x14, 0xC0, 0x1C, 0xE7,
+0x79, 0x70, 0x71, 0x1B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x6F, 0x49, 0xC0, 0x2C, 0x6B, 0x70,
+0x44, 0xC0, 0x08, 0x42, 0x5D, 0x71, 0x35, 0x70, 0x00, 0x71, 0xE0, 0x6F, 0x65, 0xC0, 0x41, 0x08,
+0x6B, 0xC1, 0x45, 0x29, 0x28, 0x4A, 0x49, 0x71, 0x35, 0x70, 0x00, 0x71, 0xE0, 0x6F, 0x91, 0xC1,
+0x6D, 0x6B, 0xA6, 0x39, 0x78, 0xC0, 0x3D, 0xEF, 0x71, 0x36, 0x70, 0x00, 0x71, 0xE0, 0x71, 0xC0,
+0x9E, 0xF7, 0x71, 0x38, 0x70, 0x00, 0x71, 0x28, 0x6C, 0x5C, 0x6C, 0x71, 0x00, 0x58, 0x61, 0x71,
+0x01, 0x6C, 0xC0, 0x7D, 0xEF, 0x44, 0x49, 0x71, 0x00, 0x61, 0x74, 0x71, 0x05, 0x58, 0x71, 0x05,
+0x5D, 0x69, 0xC0, 0x9A, 0xD6, 0x71, 0x03, 0x5C, 0x48, 0x71, 0x0C, 0xC0, 0x1C, 0xE7, 0x61, 0x71,
+0x16, 0x58, 0xC0, 0x18, 0xC6, 0x6C, 0xC0, 0xD7, 0xBD, 0x60, 0x71, 0x00, 0x4D, 0xC0, 0x55, 0xAD,
+0x6C, 0x71, 0x04, 0x58, 0x49, 0x71, 0x01, 0x49, 0x58, 0x48, 0x4D, 0x71, 0x21, 0x70, 0xC1, 0x35,
+0xAD, 0x3C, 0xE7, 0x7D, 0x79, 0x71, 0x2E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x27, 0x44, 0xC2, 0x4D,
+0x6B, 0x71, 0x94, 0xEB, 0x62, 0x58, 0x65, 0xC1, 0x6D, 0x73, 0xEF, 0x83, 0x67, 0x6C, 0x71, 0x58,
+0x44, 0x4C, 0x45, 0x91, 0xC0, 0xFF, 0xFF, 0x60, 0xC0, 0xF3, 0xA4, 0x71, 0x48, 0x71, 0x02, 0x48,
+0xC1, 0xC7, 0x39, 0x1C, 0xE7, 0x71, 0x05, 0xC0, 0xCB, 0x5A, 0x41, 0x71, 0x03, 0xC1, 0xD7, 0xBD,
+0x34, 0xA5, 0x71, 0x0A, 0x58, 0xC1, 0xAE, 0x7B, 0x30, 0x8C, 0x96, 0xC0, 0x51, 0x8C, 0x71, 0x13,
+0xC0, 0x9A, 0xD6, 0x71, 0x49, 0x54, 0x6C, 0x67, 0xAE, 0x71, 0x00, 0xC1, 0xF8, 0xC5, 0x08, 0x42,
+0x58, 0x71, 0x04, 0x4C, 0xC0, 0x86, 0x31, 0x44, 0x71, 0x65, 0xC0, 0x65, 0x31, 0x50, 0x7D, 0xA1,
+0x71, 0x17, 0xA6, 0x4D, 0x71, 0x06, 0x61, 0xC3, 0xE7, 0x41, 0xDB, 0xDE, 0x4D, 0x6B, 0x71, 0x94,
+0x71, 0x2E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x27, 0xC0, 0x3C, 0xEF, 0x5F, 0x6C, 0x60, 0x4D, 0xC1,
+0x18, 0xC6, 0x96, 0xB5, 0x49, 0x73, 0x75, 0x71, 0x00, 0xC0, 0xCF, 0x7B, 0x5C, 0x4D, 0xC1, 0x08,
+0x42, 0xDF, 0xFF, 0x7D, 0xC0, 0x18, 0xC6, 0x4C, 0x54, 0x69, 0x6C, 0x71, 0x00, 0x50, 0xC1, 0xE8,
+0x41, 0xD3, 0x9C, 0x71, 0x60, 0x41, 0xC0, 0x92, 0x94, 0x4D, 0xC0, 0x59, 0xCE, 0x41, 0xC1, 0xAA,
+0x52, 0x55, 0xAD, 0x65, 0xC0, 0x34, 0xAD, 0x75, 0x6D, 0xC0, 0x1C, 0xE7, 0x78, 0x60, 0x48, 0x6D,
+0xC0, 0xF3, 0xA4, 0x68, 0x6C, 0x49, 0x50, 0x7C, 0xC0, 0xBA, 0xD6, 0x71, 0x01, 0x45, 0xC0, 0x0C,
+0x63, 0x71, 0xC1, 0x9E, 0xF7, 0xF7, 0xBD, 0x6C, 0x69, 0x7C, 0x60, 0x71, 0x69, 0x41, 0x59, 0xC0,
+0x76, 0xB5, 0x50, 0xC0, 0xB3, 0x9C, 0x5D, 0x69, 0x41, 0xC0, 0x51, 0x8C, 0x4C, 0x75, 0x50, 0xC0,
+0xB2, 0x9C, 0x4D, 0x79, 0xC0, 0xE7, 0x41, 0x50, 0x65, 0x50, 0x71, 0x7C, 0xC1, 0xCB, 0x5A, 0x51,
+0x8C, 0x4C, 0x61, 0xC0, 0x8A, 0x52, 0x6C, 0x4D, 0x44, 0x64, 0x6C, 0x71, 0x00, 0xC0, 0xFB, 0xE6,
+0x5C, 0xAE, 0x71, 0x41, 0x47, 0xC0, 0xB7, 0xBD, 0x78, 0x65, 0x71, 0x4D, 0x7C, 0x55, 0xC0, 0x9A,
+0xD6, 0x7C, 0x41, 0x47, 0x64, 0x41, 0x00, 0x49, 0x58, 0x50, 0x70, 0x75, 0x91, 0x41, 0x00, 0x49,
+0xC0, 0x1C, 0xE7, 0x68, 0x55, 0xC1, 0x31, 0x8C, 0x5D, 0xEF, 0x7C, 0x6F, 0x4C, 0x78, 0x55, 0x68,
+0x44, 0x78, 0x7C, 0x51, 0x5D, 0xC0, 0x8A, 0x52, 0x70, 0xC0, 0x30, 0x8C, 0x68, 0x71, 0xC1, 0x9A,
+0xD6, 0xF3, 0xA4, 0x69, 0x4D, 0x7C, 0x41, 0x78, 0x71, 0x26, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x28,
+0x6C, 0x53, 0x95, 0x6C, 0x71, 0x00, 0x7C, 0x44, 0x71, 0x01, 0x40, 0x5C, 0x44, 0xC0, 0xEF, 0x83,
+0x71, 0x45, 0xC0, 0xCF, 0x7B, 0x65, 0xC1, 0x49, 0x4A, 0xDB, 0xDE, 0x71, 0x00, 0x58, 0xC0, 0xEF,
+0x83, 0x7C, 0xC0, 0x49, 0x4A, 0x71, 0x78, 0xC0, 0xC7, 0x39, 0x6D, 0xC1, 0x34, 0xAD, 0x8A, 0x52,
+0x64, 0x53, 0xC0, 0x55, 0xAD, 0x73, 0xC0, 0xCB, 0x5A, 0x49, 0xC0, 0x08, 0x42, 0x4D, 0xC0, 0xEF,
+0x83, 0x45, 0xC1, 0x59, 0xCE, 0xE7, 0x41, 0x65, 0x60, 0xC1, 0x38, 0xCE, 0x8E, 0x73, 0x7C, 0x65,
+0xC0, 0x49, 0x4A, 0x49, 0x75, 0x49, 0x74, 0x50, 0x71, 0x01, 0xC0, 0x92, 0x94, 0x44, 0x61, 0x6F,
+0x4D, 0x6C, 0x58, 0x50, 0x60, 0xC1, 0x18, 0xC6, 0xE7, 0x39, 0x4D, 0xC3, 0xEF, 0x83, 0x6D, 0x73,
+0xD7, 0xBD, 0xC7, 0x39, 0x73, 0x55, 0x45, 0xC0, 0x2C, 0x6B, 0x4D, 0xC0, 0x28, 0x4A, 0x4D, 0xC0,
+0xF7, 0xBD, 0x68, 0x71, 0x70, 0xC0, 0xAE, 0x73, 0x60, 0x4C, 0x7D, 0x5C, 0x61, 0x43, 0xC1, 0x96,
+0xB5, 0x08, 0x42, 0x47, 0x71, 0x00, 0x4D, 0x6D, 0x5C, 0xC0, 0xB6, 0xBD, 0x55, 0xC2, 0xEB, 0x5A,
+0xD7, 0xBD, 0xAE, 0x7B, 0x59, 0xC3, 0x9E, 0xF7, 0x69, 0x52, 0x18, 0xC6, 0x30, 0x8C, 0x60, 0x54,
+0x48, 0x64, 0xC1, 0x8A, 0x52, 0x59, 0xCE, 0x77, 0xC0, 0x6D, 0x73, 0xAF, 0xC0, 0xF3, 0xA4, 0x96,
+0x78, 0x48, 0x74, 0x70, 0xC2, 0x6D, 0x6B, 0x1C, 0xE7, 0xC7, 0x39, 0x51, 0xC1, 0xAA, 0x5A, 0x14,
+0xA5, 0x00, 0xC2, 0xEC, 0x62, 0x3C, 0xEF, 0x10, 0x84, 0x48, 0x44, 0x59, 0xC0, 0x2C, 0x6B, 0x70,
+0xC1, 0x69, 0x52, 0xB6, 0xBD, 0x5C, 0x70, 0xC4, 0x10, 0x84, 0xD3, 0x9C, 0xBE, 0xF7, 0x69, 0x4A,
+0x96, 0xB5, 0x68, 0xC1, 0x92, 0x94, 0x08, 0x42, 0x40, 0xC0, 0xB6, 0xBD, 0x71, 0x26, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x27, 0x5D, 0x91, 0x5D, 0xC0, 0xAB, 0x5A, 0x50, 0x71, 0xC0, 0x18, 0xC6, 0x45,
+0x49, 0xBF, 0x71, 0x00, 0xC0, 0x10, 0x84, 0x45, 0x5D, 0x54, 0xC0, 0x79, 0xCE, 0x64, 0x40, 0x4D,
+0x5C, 0x71, 0x01, 0x60, 0x40, 0x78, 0x54, 0xC0, 0xDB, 0xDE, 0x91, 0xC0, 0xEB, 0x62, 0x71, 0x69,
+0xC0, 0x8A, 0x52, 0x71, 0x6C, 0x69, 0x60, 0xC0, 0x0C, 0x63, 0x71, 0xC1, 0xAA, 0x5A, 0x1C, 0xE7,
+0x7C, 0x59, 0x70, 0x50, 0x71, 0xC0, 0x4D, 0x6B, 0x7D, 0xC0, 0x28, 0x4A, 0x79, 0x71, 0x4C, 0x51,
+0x44, 0xC1, 0x92, 0x94, 0x0C, 0x63, 0x40, 0x71, 0x00, 0xC1, 0x3C, 0xEF, 0x2C, 0x6B, 0x59, 0x71,
+0xC1, 0x49, 0x4A, 0xB6, 0xBD, 0x7C, 0x68, 0xC0, 0x1C, 0xE7, 0x61, 0x71, 0x64, 0xC1, 0x9A, 0xD6,
+0xB2, 0x9C, 0x91, 0x71, 0x5B, 0x68, 0x7C, 0xC1, 0x51, 0x8C, 0x0C, 0x63, 0x75, 0xC0, 0x8A, 0x52,
+0x71, 0xC0, 0xFB, 0xDE, 0x50, 0x71, 0x68, 0x45, 0x71, 0xC2, 0x28, 0x4A, 0x14, 0xA5, 0x2C, 0x63,
+0x65, 0xC0, 0xA7, 0x39, 0x65, 0x60, 0xC0, 0x3C, 0xE7, 0x71, 0x00, 0xC0, 0xBA, 0xDE, 0x69, 0xC0,
+0x92, 0x94, 0x5B, 0xC0, 0x9A, 0xD6, 0x70, 0x65, 0x68, 0x7C, 0xC1, 0xDB, 0xDE, 0xA6, 0x39, 0x71,
+0x00, 0x58, 0xC0, 0x8A, 0x52, 0x5D, 0x75, 0xC0, 0x66, 0x31, 0x71, 0x79, 0x40, 0xC0, 0xE7, 0x39,
+0x79, 0x71, 0xC0, 0x1C, 0xE7, 0x73, 0x71, 0xC0, 0x59, 0xCE, 0x5B, 0x58, 0x48, 0x5D, 0x59, 0x41,
+0xC1, 0x96, 0xB5, 0x8E, 0x73, 0x71, 0x7C, 0xC0, 0x10, 0x84, 0x71, 0x58, 0xC2, 0xEF, 0x7B, 0xFF,
+0xFF, 0xCB, 0x5A, 0x68, 0xC2, 0x0C, 0x63, 0x3C, 0xEF, 0x30, 0x8C, 0x41, 0x61, 0xC0, 0xA6, 0x39,
+0x65, 0x60, 0x4D, 0xC1, 0xAA, 0x5A, 0x9E, 0xF7, 0x71, 0x27, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x27,
+0x74, 0x64, 0x74, 0xC0, 0xAA, 0x52, 0x74, 0x7D, 0xC1, 0x65, 0x31, 0xEF, 0x83, 0x5C, 0xC0, 0xF7,
+0xC5, 0x71, 0x5D, 0xC0, 0x0C, 0x63, 0x44, 0xC1, 0xD7, 0xBD, 0x69, 0x4A, 0x75, 0x48, 0xC3, 0x2C,
+0x6B, 0xBA, 0xD6, 0xC7, 0x39, 0xD7, 0xBD, 0x71, 0x5D, 0x44, 0xC0, 0x7A, 0xD6, 0x71, 0x70, 0x44,
+0xC0, 0x96, 0xB5, 0x5B, 0x49, 0xC1, 0xDB, 0xDE, 0xC7, 0x39, 0x7C, 0xC0, 0xAA, 0x52, 0x68, 0xC0,
+0xBA, 0xD6, 0x47, 0xC1, 0x14, 0xA5, 0xE7, 0x41, 0x60, 0xC1, 0xEF, 0x7B, 0x8E, 0x73, 0x60, 0x54,
+0x75, 0xC3, 0x69, 0x52, 0x34, 0xAD, 0x71, 0x94, 0x10, 0x84, 0x58, 0xC1, 0x2C, 0x6B, 0xDF, 0xFF,
+0xAE, 0x00, 0xC1, 0x9A, 0xD6, 0x49, 0x4A, 0x69, 0x55, 0xC1, 0x51, 0x8C, 0xD7, 0xBD, 0x70, 0xC3,
+0xF7, 0xBD, 0xCB, 0x5A, 0x5D, 0xEF, 0xAE, 0x7B, 0x00, 0xC3, 0x18, 0xC6, 0x08, 0x42, 0xFB, 0xE6,
+0x28, 0x4A, 0x4C, 0xC2, 0xD3, 0x9C, 0x8E, 0x73, 0x55, 0xAD, 0x58, 0x00, 0x5C, 0x7C, 0x74, 0xC2,
+0xFB, 0xE6, 0xE7, 0x41, 0x96, 0xB5, 0x4C, 0xC2, 0xC7, 0x39, 0x9E, 0xF7, 0x92, 0x94, 0x70, 0x69,
+0xC1, 0xCF, 0x7B, 0xD7, 0xBD, 0x54, 0x4D, 0xC0, 0xEB, 0x62, 0x59, 0x7D, 0xC0, 0xDB, 0xDE, 0x71,
+0x00, 0x4C, 0x40, 0xC1, 0x59, 0xCE, 0xC7, 0x39, 0x49, 0x60, 0xC1, 0xF3, 0xA4, 0x8E, 0x73, 0x6C,
+0xC2, 0xDF, 0xFF, 0x8A, 0x52, 0xCF, 0x7B, 0x78, 0xC0, 0x18, 0xC6, 0x4C, 0x74, 0xC0, 0xDF, 0xFF,
+0x70, 0xC0, 0x34, 0xAD, 0x40, 0x68, 0xC4, 0x30, 0x8C, 0xAA, 0x5A, 0x55, 0xAD, 0x79, 0xD6, 0x2D,
+0x6B, 0x58, 0x40, 0xC1, 0x71, 0x94, 0x1C, 0xE7, 0x47, 0x4D, 0xC0, 0x8E, 0x73, 0x40, 0xC2, 0xD7,
+0xBD, 0x08, 0x42, 0x9A, 0xD6, 0x40, 0x6B, 0x5D, 0x4C, 0xC0, 0xEB, 0x62, 0x51, 0xC0, 0xEB, 0x5A,
+0x4C, 0x60, 0xC2, 0x18, 0xC6, 0x4D, 0x6B, 0xEF, 0x7B, 0x6C, 0xC0, 0xCB, 0x5A, 0x59, 0x4C, 0x7D,
+0xC0, 0xC7, 0x39, 0x74, 0xC0, 0xFF, 0xFF, 0x27, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x28, 0x65, 0xC1,
+0x76, 0xB5, 0xDB, 0xDE, 0x71, 0x4D, 0x7D, 0x01, 0x49, 0x71, 0x5D, 0x60, 0x91, 0x00, 0x75, 0x71,
+0x74, 0x60, 0x5D, 0xC0, 0x38, 0xCE, 0x74, 0x71, 0xC0, 0x9E, 0xF7, 0x4C, 0xC0, 0x1C, 0xE7, 0x71,
+0x74, 0x51, 0xC0, 0x79, 0xCE, 0x4C, 0x75, 0x71, 0x48, 0xC0, 0xB6, 0xBD, 0x74, 0x79, 0x71, 0x60,
+0x00, 0x65, 0x4D, 0x74, 0x65, 0x48, 0x51, 0x70, 0x60, 0x48, 0x71, 0x60, 0x4C, 0x5D, 0x71, 0x02,
+0x75, 0x69, 0x73, 0x70, 0x71, 0x48, 0x7D, 0x75, 0x71, 0x65, 0x74, 0x5C, 0x51, 0xC1, 0xFB, 0xE6,
+0xF7, 0xC5, 0x5C, 0xC1, 0x92, 0x94, 0x2C, 0x6B, 0x60, 0x6C, 0x49, 0x7D, 0x48, 0x60, 0x58, 0x79,
+0x65, 0x4D, 0x4C, 0xC0, 0x5D, 0xEF, 0x75, 0x4C, 0x60, 0x6C, 0xC0, 0xFB, 0xDE, 0x4C, 0x44, 0x58,
+0xC0, 0x75, 0xB5, 0x51, 0x58, 0x71, 0x00, 0x48, 0x51, 0x58, 0x61, 0x49, 0x4C, 0x65, 0x01, 0x71,
+0x49, 0x69, 0xC0, 0x38, 0xCE, 0x61, 0x4C, 0x5C, 0x71, 0x58, 0x4C, 0x65, 0x71, 0x00, 0x4C, 0x7D,
+0x58, 0x5D, 0x4C, 0x65, 0x71, 0x75, 0x4C, 0x61, 0x74, 0x00, 0x5D, 0xC0, 0xF8, 0xC5, 0x48, 0x74,
+0x51, 0x5D, 0x71, 0x4D, 0x7D, 0x75, 0x44, 0x4C, 0x48, 0x65, 0x00, 0x71, 0x49, 0x6C, 0x60, 0xC0,
+0xBB, 0xDE, 0x4C, 0x5C, 0x71, 0x27, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x30, 0xC0, 0xCF, 0x7B,
+0x67, 0x71, 0xE0, 0x38, 0x70, 0x00, 0x71, 0xE0, 0x30, 0x75, 0xA6, 0xC0, 0xDF, 0xFF, 0x71, 0xE0,
+0x37, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71,
+0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0x09, 0x58, 0x48, 0x4D, 0x48, 0x5C,
+0x71, 0x03, 0xC0, 0x96, 0xB5, 0x74, 0x71, 0x07, 0x6C, 0x60, 0x71, 0x0B, 0x61, 0x48, 0x71, 0x07,
+0x5D, 0x48, 0x4D, 0x01, 0x71, 0x15, 0x40, 0x60, 0x71, 0x11, 0x58, 0x65, 0x71, 0x01, 0x5C, 0x4D,
+0x71, 0x04, 0xC0, 0xBA, 0xDE, 0x55, 0x71, 0x0E, 0x58, 0x41, 0x58, 0x71, 0x02, 0x5D, 0x60, 0x71,
+0x07, 0x75, 0x79, 0x6C, 0x71, 0x04, 0x51, 0x00, 0x71, 0x60, 0x6C, 0x71, 0x00, 0x51, 0x4C, 0x71,
+0x03, 0xC0, 0x1C, 0xE7, 0x74, 0x48, 0x71, 0x07, 0x61, 0x48, 0x71, 0x08, 0x6C, 0x79, 0x43, 0x6C,
+0x71, 0x0E, 0x4C, 0x60, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x09, 0x48, 0x78, 0xC1, 0xEF,
+0x83, 0x34, 0xAD, 0xAF, 0x5D, 0xA6, 0x71, 0x01, 0x78, 0x5F, 0x5D, 0x71, 0x00, 0x58, 0x71, 0x01,
+0x58, 0x71, 0x6C, 0x79, 0x6C, 0x00, 0x58, 0x71, 0x01, 0x6C, 0x71, 0x6C, 0x00, 0x71, 0x58, 0x6C,
+0x75, 0x5C, 0x71, 0x5D, 0x00, 0x71, 0x00, 0x5D, 0x6C, 0x71, 0x00, 0x5C, 0x78, 0x45, 0xC0, 0x14,
+0xA5, 0x69, 0x44, 0x6C, 0x71, 0x00, 0x58, 0x71, 0x00, 0x6C, 0x58, 0x71, 0x00, 0x58, 0x6C, 0x5D,
+0x71, 0x5D, 0x6C, 0x71, 0x01, 0x6C, 0x58, 0x71, 0x4C, 0x50, 0x71, 0x00, 0x58, 0x71, 0x00, 0x49,
+0x71, 0x00, 0x6C, 0x58, 0x71, 0x6C, 0x5D, 0x71, 0x00, 0x6C, 0x5D, 0x71, 0x5D, 0x58, 0x48, 0x71,
+0x58, 0x6C, 0xC0, 0x1C, 0xE7, 0x00, 0x61, 0x44, 0x71, 0x00, 0x75, 0x70, 0x44, 0x45, 0x58, 0x71,
+0x01, 0x58, 0x71, 0x01, 0x5D, 0x71, 0x01, 0x5D, 0x71, 0x00, 0x58, 0x71, 0xC1, 0x51, 0x8C, 0xBA,
+0xDE, 0x71, 0x00, 0x6C, 0x58, 0x6C, 0x7C, 0x58, 0x4D, 0x71, 0x00, 0x58, 0x71, 0x01, 0x44, 0xC1,
+0x92, 0x94, 0x34, 0xAD, 0x64, 0x71, 0x02, 0x6C, 0x5D, 0x65, 0xC0, 0xD3, 0x9C, 0x71, 0x79, 0x71,
+0x00, 0x5D, 0x65, 0x7C, 0x6C, 0x5D, 0x71, 0x00, 0x51, 0x68, 0xC0, 0x59, 0xCE, 0x68, 0x75, 0x71,
+0x5D, 0x71, 0x5D, 0x4D, 0x71, 0x4D, 0x5D, 0x75, 0x5C, 0x71, 0x5D, 0x00, 0x71, 0x00, 0x5D, 0x6C,
+0x71, 0x01, 0x6D, 0x65, 0x55, 0x5C, 0x4D, 0x6C, 0x71, 0x49, 0x71, 0x01, 0x5D, 0x00, 0x48, 0x6C,
+0x71, 0xC0, 0x9E, 0xF7, 0x71, 0x00, 0x6C, 0x64, 0x91, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x0B, 0x70, 0x4D, 0x6C, 0x50, 0x78, 0x00, 0x71, 0x00, 0x4C, 0x59, 0x70, 0xC0, 0x39, 0xCE, 0x74,
+0x64, 0x70, 0x58, 0x64, 0x78, 0x54, 0x79, 0xC0, 0xF3, 0xA4, 0x48, 0xC0, 0xEF, 0x83, 0x68, 0x50,
+0x71, 0x00, 0x7C, 0x48, 0x64, 0x65, 0xBF, 0x50, 0xC0, 0x38, 0xCE, 0x78, 0x60, 0x50, 0x6D, 0x7B,
+0xC0, 0x1C, 0xE7, 0x4D, 0x69, 0xC0, 0x71, 0x94, 0x40, 0x71, 0x01, 0x44, 0x79, 0x61, 0x64, 0x6D,
+0x49, 0x60, 0x64, 0xC0, 0xF4, 0xA4, 0x78, 0x4F, 0x54, 0x51, 0x69, 0x00, 0x65, 0xC1, 0x10, 0x84,
+0x5D, 0xEF, 0x55, 0x70, 0x71, 0x00, 0x74, 0xC0, 0xEF, 0x83, 0x7C, 0x64, 0x65, 0x69, 0x5D, 0x64,
+0xC0, 0xF3, 0xA4, 0x60, 0x7D, 0x55, 0x69, 0xC0, 0x5D, 0xEF, 0x7C, 0x4C, 0xC1, 0xFB, 0xE6, 0x55,
+0xAD, 0x7C, 0x79, 0x71, 0xC0, 0x59, 0xCE, 0x59, 0x44, 0x5F, 0x65, 0x69, 0x60, 0x50, 0x74, 0x64,
+0x68, 0xC0, 0xEF, 0x83, 0x41, 0x5D, 0x71, 0xC0, 0xB2, 0x9C, 0x40, 0xC1, 0xDB, 0xDE, 0xCF, 0x7B,
+0x6D, 0x70, 0x71, 0x78, 0xC0, 0x34, 0xAD, 0x55, 0x71, 0x5D, 0x74, 0xC1, 0x1C, 0xE7, 0x92, 0x94,
+0x61, 0x58, 0x61, 0x78, 0x50, 0x51, 0x68, 0x58, 0xC0, 0x71, 0x94, 0x48, 0x41, 0x4C, 0x79, 0x50,
+0x4C, 0xC1, 0x6D, 0x73, 0xDB, 0xDE, 0x7D, 0x55, 0x64, 0x71, 0x00, 0x5D, 0x6C, 0x7C, 0xC0, 0x59,
+0xCE, 0x75, 0x71, 0x00, 0x44, 0x58, 0x55, 0xA1, 0x64, 0x49, 0x6D, 0xC0, 0x5D, 0xEF, 0x64, 0x58,
+0x7C, 0x69, 0x78, 0x79, 0x71, 0xA6, 0xC0, 0x8E, 0x73, 0x44, 0x71, 0x6C, 0x00, 0x79, 0x64, 0x41,
+0x69, 0x4C, 0x74, 0xC1, 0x4D, 0x6B, 0xD7, 0xBD, 0x64, 0x60, 0x50, 0x6D, 0x7B, 0x70, 0x4D, 0x69,
+0xC1, 0x71, 0x94, 0xB6, 0xBD, 0x71, 0x00, 0x45, 0x7C, 0xC0, 0x7D, 0xF7, 0x75, 0xC2, 0x0C, 0x63,
+0x38, 0xCE, 0xD7, 0xBD, 0x64, 0x41, 0x5D, 0x45, 0x7C, 0x78, 0x44, 0x79, 0x60, 0x64, 0xC1, 0xF3,
+0xA4, 0xDB, 0xDE, 0x64, 0x6D, 0x55, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0B, 0xC0, 0x92,
+0x94, 0x4D, 0x65, 0x7C, 0x71, 0xC0, 0xCF, 0x7B, 0x75, 0x71, 0x4C, 0x00, 0xC0, 0x5D, 0xEF, 0x6C,
+0x00, 0x51, 0x70, 0xC1, 0x1C, 0xE7, 0x30, 0x8C, 0x65, 0x68, 0xC0, 0xBE, 0xFF, 0x59, 0x61, 0x68,
+0x5D, 0xC0, 0x10, 0x84, 0x71, 0x00, 0x55, 0x74, 0xC0, 0xF7, 0xC5, 0x4C, 0x74, 0xC0, 0xEF, 0x83,
+0x61, 0x4C, 0x00, 0x69, 0xC1, 0x9A, 0xD6, 0xB6, 0xBD, 0x51, 0x7D, 0x78, 0x68, 0x5C, 0x71, 0x01,
+0x41, 0xC0, 0x59, 0xCE, 0x59, 0x73, 0x41, 0x79, 0x67, 0xC0, 0x18, 0xC6, 0x41, 0x7D, 0x64, 0xC0,
+0xFC, 0xE6, 0x77, 0x50, 0xC1, 0xB2, 0x9C, 0x9E, 0xF7, 0x4B, 0x40, 0x54, 0x71, 0x01, 0x57, 0x6D,
+0x71, 0xC0, 0x10, 0x84, 0x69, 0x7D, 0x60, 0x4F, 0x7D, 0x78, 0x79, 0x4C, 0x45, 0x44, 0x6C, 0x74,
+0x55, 0x6D, 0x69, 0x4C, 0x71, 0x5D, 0xC0, 0x51, 0x8C, 0x74, 0x4D, 0xC0, 0x1C, 0xE7, 0x7C, 0x60,
+0x40, 0x70, 0x78, 0x60, 0xC0, 0xF3, 0xA4, 0x61, 0x71, 0x00, 0x73, 0xC0, 0xF7, 0xC5, 0x5D, 0xC2,
+0x71, 0x94, 0xDF, 0xFF, 0x30, 0x8C, 0x61, 0xC0, 0xAE, 0x73, 0x60, 0x7C, 0x71, 0x00, 0x50, 0x7D,
+0xC1, 0x51, 0x8C, 0x34, 0xAD, 0x65, 0x00, 0x40, 0x4C, 0x69, 0xC1, 0xB2, 0x9C, 0xBE, 0xF7, 0x64,
+0x41, 0x45, 0x51, 0xC0, 0x5D, 0xEF, 0x68, 0x79, 0x64, 0xC1, 0x1C, 0xE7, 0xAE, 0x7B, 0x51, 0x4B,
+0x71, 0x00, 0xC0, 0x9A, 0xD6, 0x68, 0x40, 0x7D, 0x58, 0x71, 0x00, 0xC0, 0xF3, 0xA4, 0x51, 0x5D,
+0x51, 0x55, 0x71, 0x68, 0x50, 0x7D, 0x5D, 0xC1, 0x18, 0xC6, 0x4D, 0x6B, 0x69, 0x71, 0x00, 0x5D,
+0xC0, 0x6D, 0x6B, 0x5D, 0xA6, 0x40, 0x79, 0x40, 0x7D, 0xC0, 0xF3, 0xA4, 0x78, 0x50, 0x71, 0x54,
+0x71, 0x4C, 0x00, 0x69, 0x48, 0xC0, 0xB6, 0xBD, 0x51, 0x7D, 0x78, 0x68, 0xC0, 0xDB, 0xDE, 0x71,
+0x00, 0x6C, 0x50, 0xC0, 0x6D, 0x73, 0x48, 0x68, 0x71, 0x48, 0x65, 0xC0, 0xAE, 0x7B, 0x6C, 0x54,
+0x75, 0xC0, 0x7D, 0xEF, 0x68, 0x5D, 0xC1, 0x8E, 0x73, 0x18, 0xC6, 0x41, 0x7B, 0x75, 0x79, 0x55,
+0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0B, 0xC0, 0x10, 0x84, 0x74, 0x4D, 0xC1, 0x71, 0x94,
+0x5D, 0xEF, 0x7B, 0x49, 0x71, 0x78, 0x64, 0x79, 0x7C, 0xC0, 0x30, 0x8C, 0x4D, 0xC0, 0x9E, 0xF7,
+0x71, 0xC1, 0xD7, 0xBD, 0xEF, 0x83, 0x49, 0x58, 0x40, 0xC1, 0x9A, 0xD6, 0x30, 0x8C, 0x58, 0xC0,
+0xCF, 0x7B, 0x71, 0x00, 0x55, 0x69, 0x64, 0x00, 0x75, 0x78, 0x59, 0x78, 0x69, 0x50, 0xC0, 0x38,
+0xCE, 0x78, 0x64, 0x71, 0xC0, 0xAE, 0x7B, 0x4C, 0x71, 0x02, 0x59, 0x51, 0x7C, 0x51, 0x58, 0x00,
+0x74, 0x61, 0x5D, 0xC3, 0xB6, 0xBD, 0xF3, 0xA4, 0xDB, 0xDE, 0x10, 0x84, 0x61, 0xC0, 0x71, 0x94,
+0x78, 0xC2, 0x3C, 0xEF, 0x0C, 0x63, 0x1C, 0xE7, 0x61, 0x71, 0x00, 0xC1, 0xDB, 0xDE, 0x92, 0x94,
+0x75, 0x68, 0x73, 0x55, 0x79, 0xC0, 0x71, 0x94, 0x58, 0xC0, 0x1B, 0xE7, 0x74, 0x6F, 0x74, 0x78,
+0x79, 0xC0, 0xEF, 0x7B, 0x41, 0x44, 0x58, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x64, 0x60, 0x71, 0x4D,
+0x48, 0x70, 0x64, 0x68, 0x64, 0xC0, 0xB7, 0xBD, 0x6D, 0xC0, 0x38, 0xCE, 0x71, 0x00, 0xC0, 0x75,
+0xAD, 0xA1, 0xC0, 0x5D, 0xEF, 0x7B, 0xC0, 0x9E, 0xF7, 0x6C, 0xC0, 0xFB, 0xE6, 0x74, 0x44, 0x58,
+0x71, 0x00, 0xC1, 0x9A, 0xD6, 0x2C, 0x6B, 0x61, 0x78, 0xC0, 0xDB, 0xDE, 0x48, 0x4F, 0x58, 0x5D,
+0xC0, 0x30, 0x8C, 0x5C, 0x50, 0x4C, 0x4D, 0x6C, 0xC0, 0x59, 0xCE, 0x54, 0x74, 0xC0, 0x92, 0x94,
+0x70, 0x7B, 0x44, 0x58, 0x71, 0x00, 0xC0, 0x75, 0xB5, 0x77, 0x4D, 0xC0, 0x49, 0x4A, 0x4D, 0x71,
+0x00, 0xC0, 0x96, 0xB5, 0x6D, 0x58, 0x4C, 0xC1, 0xB2, 0x9C, 0xDF, 0xFF, 0x40, 0x78, 0xC0, 0x71,
+0x94, 0x49, 0x51, 0x40, 0x54, 0x4D, 0x71, 0x00, 0x7C, 0xC0, 0x55, 0xAD, 0x5D, 0xC0, 0xEF, 0x83,
+0x44, 0x68, 0xC0, 0x59, 0xCE, 0x6C, 0xC0, 0x9A, 0xD6, 0x59, 0x71, 0x40, 0x49, 0x7D, 0x78, 0xC0,
+0x34, 0xAD, 0x79, 0x7D, 0x73, 0x71, 0xC0, 0xCF, 0x7B, 0x51, 0x71, 0x01, 0x64, 0x71, 0x70, 0x7D,
+0x54, 0xC0, 0x9E, 0xF7, 0x45, 0x79, 0xC0, 0xEF, 0x7B, 0x5D, 0xC0, 0x30, 0x8C, 0x44, 0x5D, 0x40,
+0x58, 0x40, 0xC1, 0x1C, 0xE7, 0xDF, 0xFF, 0x68, 0xC0, 0x18, 0xC6, 0x4C, 0x50, 0x61, 0x44, 0xC0,
+0xFF, 0xFF, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0A, 0x5D, 0x50, 0x65, 0x71, 0x65, 0x78, 0x4D,
+0x71, 0x00, 0xC0, 0xDB, 0xDE, 0x64, 0x60, 0x71, 0xC1, 0x1C, 0xE7, 0xF3, 0xA4, 0x5B, 0x58, 0x55,
+0x69, 0x54, 0x5C, 0x55, 0x74, 0x69, 0x70, 0x50, 0x58, 0x71, 0x75, 0x7C, 0x69, 0x60, 0x79, 0x78,
+0x5C, 0x65, 0xC0, 0xB6, 0xBD, 0x7D, 0x79, 0xC0, 0xF7, 0xC5, 0x51, 0x74, 0xC1, 0x34, 0xAD, 0xB2,
+0x9C, 0x78, 0x71, 0x00, 0x6C, 0x58, 0x60, 0x49, 0x50, 0x7D, 0x5D, 0x5C, 0x44, 0x65, 0x60, 0x4C,
+0x4D, 0x55, 0x7D, 0x4C, 0xC0, 0x5D, 0xEF, 0x71, 0xC0, 0xF3, 0xA4, 0x5D, 0xC0, 0x10, 0x84, 0x49,
+0x71, 0x61, 0xC0, 0xAE, 0x7B, 0x7D, 0x75, 0x65, 0x78, 0x71, 0x7D, 0x5F, 0x5C, 0x69, 0x4C, 0x78,
+0x4D, 0x78, 0xC0, 0x38, 0xCE, 0x6C, 0x69, 0x64, 0x75, 0x71, 0x00, 0xC1, 0x5D, 0xEF, 0x18, 0xC6,
+0x71, 0x4D, 0x64, 0x60, 0x7D, 0x61, 0x51, 0x60, 0xC0, 0x9A, 0xD6, 0x78, 0x6C, 0x71, 0xC0, 0x1C,
+0xE7, 0x64, 0x79, 0x64, 0x70, 0x50, 0x5D, 0x74, 0x4B, 0x79, 0x71, 0x00, 0x5D, 0x4C, 0x71, 0x51,
+0xC0, 0x9E, 0xF7, 0x71, 0x4C, 0x55, 0x61, 0x54, 0x78, 0x4D, 0x44, 0xC0, 0x75, 0xB5, 0x68, 0x61,
+0x55, 0x75, 0x64, 0x75, 0x65, 0x50, 0x48, 0x71, 0x00, 0x5D, 0x50, 0x7D, 0x51, 0x7D, 0xC0, 0xDF,
+0xFF, 0x71, 0x00, 0x64, 0xBE, 0x47, 0x78, 0x44, 0x50, 0x44, 0x78, 0x64, 0x7D, 0x51, 0x5C, 0x7D,
+0x71, 0x00, 0x70, 0xC0, 0x92, 0x94, 0x59, 0x68, 0x61, 0x79, 0x40, 0x41, 0x79, 0x59, 0x60, 0x50,
+0x01, 0x7C, 0x00, 0x73, 0x50, 0x55, 0x51, 0xC1, 0x51, 0x8C, 0xCF, 0x7B, 0x55, 0x75, 0x70, 0x59,
+0x54, 0x50, 0x70, 0xC0, 0xB2, 0x9C, 0x69, 0x41, 0x7C, 0xC0, 0x71, 0x94, 0x60, 0x4F, 0x51, 0xC0,
+0x1C, 0xE7, 0x68, 0x7D, 0x51, 0x40, 0x64, 0x74, 0xC0, 0xEF, 0x83, 0x54, 0x50, 0x51, 0xC0, 0xDB,
+0xDE, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A, 0x44, 0x45, 0xC0, 0x59, 0xCE, 0x78, 0x5D,
+0x71, 0x12, 0x50, 0x69, 0x60, 0x79, 0x71, 0x10, 0x58, 0x70, 0xC0, 0x1C, 0xE7, 0x5D, 0x79, 0xC0,
+0xDF, 0xFF, 0x71, 0x74, 0x45, 0x71, 0xE0, 0x1B, 0x58, 0xC1, 0xCF, 0x7B, 0x6D, 0x73, 0x9A, 0xBF,
+0x00, 0x4C, 0x58, 0x4C, 0x58, 0x03, 0xBE, 0x00, 0x6C, 0x49, 0x4C, 0x60, 0xC0, 0x8A, 0x52, 0x91,
+0xC1, 0xAA, 0x5A, 0x2C, 0x6B, 0xAF, 0x49, 0x58, 0x49, 0x4C, 0xC0, 0xAE, 0x73, 0x00, 0x58, 0x6C,
+0x4C, 0x58, 0x02, 0x5D, 0x58, 0x6C, 0x4C, 0x58, 0x4C, 0x49, 0x58, 0x4C, 0x67, 0xC0, 0x7D, 0xEF,
+0x71, 0x0A, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC0, 0x9E, 0xF7, 0x75, 0x71, 0x15, 0xC0, 0x1C,
+0xE7, 0x58, 0x71, 0x11, 0xA6, 0x75, 0x71, 0x03, 0x49, 0x70, 0x6C, 0x71, 0xE0, 0x2E, 0x6C, 0xC1,
+0x5D, 0xEF, 0xBE, 0xF7, 0x71, 0x24, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71,
+0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0x1A, 0xC2, 0x9D, 0xCE, 0x36, 0x43, 0xD9, 0x84, 0x71, 0x2E,
+0xC2, 0xFB, 0xB5, 0x1E, 0xDF, 0xBF, 0xF7, 0x7B, 0xC0, 0x7E, 0xEF, 0x71, 0xE0, 0x18, 0x70, 0x00,
+0x71, 0xE0, 0x1A, 0xC2, 0x7C, 0xC6, 0xD5, 0x32, 0x99, 0x7C, 0x71, 0x2D, 0xC5, 0x3E, 0xE7, 0x54,
+0x22, 0xDD, 0xD6, 0x3C, 0xBE, 0x34, 0x1A, 0xB9, 0x7C, 0x71, 0xE0, 0x18, 0x70, 0x00, 0x71, 0x2D,
+0x7B, 0x7E, 0xC0, 0x5E, 0xE7, 0x71, 0x48, 0xC1, 0x5C, 0xBE, 0x7E, 0xEF, 0x71, 0x7B, 0x7E, 0x48,
+0xC0, 0xFD, 0xD6, 0x43, 0xC0, 0x9F, 0xEF, 0x71, 0xC0, 0x1D, 0xDF, 0x43, 0x64, 0x71, 0x67, 0x7E,
+0x5C, 0x5A, 0x4B, 0xC0, 0xDF, 0xFF, 0x71, 0xC0, 0xBD, 0xCE, 0x96, 0x71, 0x00, 0x5A, 0x91, 0x6C,
+0x71, 0x02, 0xC0, 0xDD, 0xCE, 0x43, 0x5C, 0x57, 0xC1, 0xBB, 0xA5, 0xFD, 0xD6, 0x71, 0x00, 0x50,
+0xC1, 0xFB, 0xAD, 0x9D, 0xCE, 0x71, 0x7B, 0x7E, 0x48, 0x7B, 0xC0, 0xBB, 0xA5, 0x50, 0x71, 0x00,
+0x4B, 0x5A, 0xBE, 0x7B, 0x71, 0x05, 0x6C, 0x62, 0x5A, 0xC0, 0x9D, 0xCE, 0x71, 0x01, 0xC1, 0xDD,
+0xD6, 0xBB, 0xAD, 0x00, 0x6C, 0x71, 0x00, 0x96, 0x4B, 0x5F, 0x5C, 0xC0, 0xFB, 0xB5, 0xAF, 0x71,
+0xA6, 0x6A, 0x9A, 0xC0, 0x9F, 0xF7, 0x71, 0x01, 0xC1, 0x9B, 0xA5, 0x16, 0x43, 0x48, 0xC2, 0x99,
+0x7C, 0xF3, 0x11, 0xB7, 0x5B, 0x43, 0xC0, 0xDD, 0xD6, 0x71, 0x00, 0x7B, 0x62, 0x96, 0x67, 0x71,
+0x02, 0x7B, 0x62, 0x5A, 0x67, 0x71, 0x01, 0x57, 0x4B, 0xC0, 0xBF, 0xF7, 0x43, 0x5D, 0xC0, 0x3E,
+0xE7, 0x71, 0x01, 0xC0, 0xBD, 0xCE, 0x5A, 0x00, 0xC0, 0x5C, 0xBE, 0x5C, 0x64, 0x43, 0x5F, 0x71,
+0x00, 0x6C, 0x4B, 0x00, 0x6C, 0x71, 0x2E, 0x70, 0x00, 0x71, 0x2D, 0x5A, 0xC1, 0xB3, 0x09, 0xB9,
+0x7C, 0x71, 0x50, 0x49, 0xC0, 0x5A, 0x9D, 0x71, 0xC5, 0xF7, 0x63, 0xD3, 0x11, 0x9D, 0xCE, 0xF9,
+0x8C, 0xD3, 0x09, 0xBB, 0xA5, 0x71, 0x53, 0x51, 0x43, 0x71, 0x6F, 0x72, 0xC0, 0x3E, 0xE7, 0x60,
+0xC1, 0xF4, 0x19, 0x9D, 0xCE, 0x6C, 0xC0, 0xF5, 0x3A, 0x72, 0x43, 0xC1, 0x7E, 0xEF, 0x74, 0x2A,
+0x5B, 0x64, 0x71, 0x02, 0xC3, 0x97, 0x53, 0x34, 0x1A, 0x77, 0x53, 0x95, 0x2A, 0x51, 0x7A, 0x7E,
+0x71, 0x7E, 0x56, 0xC0, 0xF7, 0x63, 0x71, 0x65, 0x51, 0x4B, 0x46, 0x49, 0x57, 0x5C, 0x53, 0xC0,
+0x14, 0x1A, 0x01, 0x53, 0x71, 0x04, 0xC0, 0xD9, 0x84, 0x72, 0xC0, 0xF4, 0x19, 0x6A, 0xC0, 0x75,
+0x2A, 0x48, 0x71, 0xC1, 0xF9, 0x8C, 0x34, 0x22, 0x96, 0x00, 0x72, 0xC1, 0x1A, 0x8D, 0xFF, 0xFF,
+0x48, 0x72, 0xC1, 0xB5, 0x32, 0x56, 0x4B, 0x65, 0x96, 0xC1, 0x58, 0x74, 0xD7, 0x5B, 0x65, 0x51,
+0x58, 0x64, 0x71, 0x00, 0x53, 0xC1, 0xF9, 0x84, 0xDB, 0xAD, 0x65, 0x72, 0x00, 0x65, 0x58, 0x71,
+0xC1, 0x9B, 0xA5, 0x74, 0x22, 0x6D, 0x72, 0x00, 0xC0, 0x3A, 0x95, 0x71, 0x00, 0xC0, 0x7A, 0x9D,
+0x77, 0x6D, 0x72, 0x00, 0x79, 0x71, 0x64, 0xC0, 0xD5, 0x32, 0x7A, 0xC0, 0x77, 0x53, 0x72, 0x51,
+0x5B, 0x43, 0x71, 0x79, 0x6A, 0x77, 0xBF, 0x65, 0xC0, 0xF9, 0x8C, 0x64, 0xC0, 0xD5, 0x3A, 0x7A,
+0x43, 0x71, 0xC2, 0x7C, 0xC6, 0xF3, 0x11, 0xB7, 0x5B, 0x71, 0x2F, 0x70, 0x00, 0x71, 0x2D, 0x7B,
+0x6A, 0xC0, 0x76, 0x4B, 0x6C, 0x7C, 0x51, 0xC0, 0x18, 0x6C, 0x64, 0xC0, 0xD5, 0x32, 0x4E, 0x64,
+0xC0, 0x5C, 0xBE, 0x51, 0xC0, 0x78, 0x74, 0x64, 0x4E, 0x56, 0xC1, 0x1A, 0x95, 0x3E, 0xE7, 0x6A,
+0xC0, 0x77, 0x53, 0x71, 0xC2, 0x5A, 0x9D, 0x93, 0x09, 0x7A, 0x9D, 0x7B, 0x72, 0x92, 0x7E, 0x4B,
+0x49, 0xC0, 0x58, 0x74, 0x71, 0x03, 0xC0, 0x97, 0x53, 0x51, 0x58, 0xC0, 0xFD, 0xDE, 0x79, 0x56,
+0xC0, 0x56, 0x4B, 0x71, 0x7E, 0x51, 0xC0, 0xD7, 0x63, 0x71, 0xC0, 0xF9, 0x8C, 0x56, 0xC0, 0x75,
+0x2A, 0x46, 0x7E, 0x5C, 0xC0, 0xB9, 0x84, 0x49, 0xC0, 0xB7, 0x5B, 0x67, 0x7B, 0x7E, 0x71, 0x03,
+0x7E, 0x56, 0x4E, 0xC0, 0x5C, 0xBE, 0x48, 0x76, 0x64, 0xC0, 0x7C, 0xC6, 0x60, 0xC0, 0xD5, 0x32,
+0x5F, 0x00, 0xC1, 0x95, 0x32, 0x14, 0x1A, 0x5F, 0x5C, 0x41, 0x65, 0xC0, 0x1A, 0x8D, 0x7E, 0xC0,
+0x95, 0x2A, 0x51, 0xC0, 0x78, 0x74, 0x57, 0xC0, 0xF5, 0x3A, 0x65, 0x67, 0xC0, 0xFF, 0xFF, 0x50,
+0x4E, 0x4B, 0x5C, 0x58, 0x60, 0xC0, 0xD7, 0x5B, 0x5A, 0x6F, 0x9A, 0x72, 0x4E, 0x7B, 0x50, 0xC0,
+0x16, 0x43, 0x65, 0x6F, 0xC0, 0x3E, 0xDF, 0x72, 0x4E, 0x7B, 0x50, 0x6A, 0x65, 0x67, 0x71, 0x5B,
+0x5D, 0xC0, 0x38, 0x6C, 0x5A, 0xC0, 0x97, 0x53, 0x51, 0xC0, 0x7B, 0x9D, 0x71, 0xC0, 0x36, 0x43,
+0x72, 0x5A, 0x64, 0xC0, 0xFD, 0xDE, 0x67, 0x71, 0xC5, 0x1A, 0x8D, 0xB3, 0x09, 0x5A, 0x95, 0xFF,
+0xFF, 0x99, 0x7C, 0xD3, 0x09, 0x62, 0x71, 0x2F, 0x70, 0x00, 0x71, 0x2D, 0xA6, 0x77, 0xC0, 0x95,
+0x32, 0x43, 0xC1, 0xD5, 0x3A, 0x18, 0x6C, 0x6A, 0xC2, 0x3C, 0xBE, 0x34, 0x1A, 0xD7, 0x63, 0x71,
+0xC0, 0x7E, 0xE7, 0x46, 0xC0, 0x76, 0x4B, 0x76, 0x56, 0x58, 0xA6, 0x62, 0x51, 0xC0, 0xD9, 0x84,
+0x71, 0x5A, 0x65, 0xC3, 0x58, 0x74, 0x5A, 0x9D, 0x16, 0x43, 0x76, 0x4B, 0x50, 0xC0, 0x1A, 0x8D,
+0x51, 0x62, 0xC0, 0xFF, 0xFF, 0x03, 0x4B, 0xC0, 0xF4, 0x11, 0x7E, 0x71, 0x5C, 0x46, 0xA6, 0xC1,
+0x7E, 0xEF, 0x5C, 0xC6, 0x51, 0xC0, 0xF7, 0x63, 0x71, 0xC0, 0xF9, 0x8C, 0x4E, 0xC0, 0x78, 0x74,
+0x71, 0x01, 0xC1, 0x36, 0x43, 0x14, 0x1A, 0x46, 0x71, 0x06, 0xC0, 0xB9, 0x7C, 0x4E, 0xC0, 0xB9,
+0x84, 0x71, 0x02, 0xC1, 0xF9, 0x8C, 0xB3, 0x09, 0x41, 0x71, 0x00, 0xC0, 0x58, 0x74, 0x49, 0xC0,
+0x7A, 0x9D, 0x64, 0x7A, 0xC0, 0xB5, 0x32, 0x5C, 0x71, 0xC0, 0xF5, 0x3A, 0x6D, 0xC0, 0xFD, 0xD6,
+0x71, 0x53, 0x51, 0xC0, 0x7C, 0xC6, 0x71, 0xC1, 0xFB, 0xAD, 0xD5, 0x32, 0x64, 0x71, 0x62, 0x51,
+0x41, 0x71, 0x00, 0xC0, 0xBB, 0xA5, 0x5D, 0x53, 0xC0, 0xD7, 0x63, 0x00, 0x4E, 0x49, 0x5A, 0xC0,
+0xFC, 0xB5, 0x5D, 0x53, 0x5B, 0x00, 0x4E, 0x49, 0x46, 0xC0, 0xFF, 0xFF, 0x56, 0x72, 0x6C, 0x71,
+0x65, 0xC3, 0xD3, 0x09, 0x1A, 0x8D, 0xFF, 0xFF, 0x78, 0x7C, 0x51, 0xC1, 0xB5, 0x32, 0xB7, 0x53,
+0x65, 0x48, 0x71, 0xC2, 0x3E, 0xE7, 0x74, 0x22, 0x56, 0x4B, 0x5C, 0xC0, 0xF6, 0x3A, 0x4E, 0x5C,
+0x71, 0x2F, 0x70, 0x00, 0x71, 0x2E, 0x55, 0xC0, 0x14, 0x1A, 0x60, 0x6A, 0x4B, 0xC3, 0xF5, 0x3A,
+0xD7, 0x5B, 0xF3, 0x11, 0x5A, 0x9D, 0x71, 0x00, 0xC0, 0xB7, 0x5B, 0x7A, 0x58, 0x53, 0xC0, 0xFC,
+0xB5, 0x5B, 0xC3, 0x97, 0x53, 0xF4, 0x19, 0x5C, 0xBE, 0xFF, 0xFF, 0x64, 0xC0, 0xD5, 0x3A, 0x5B,
+0xC2, 0x76, 0x53, 0x78, 0x74, 0x5A, 0x95, 0x6A, 0xBE, 0xC0, 0x54, 0x22, 0x40, 0xC0, 0xDF, 0xFF,
+0x48, 0xBE, 0x71, 0x00, 0x4B, 0x5D, 0x76, 0x71, 0x50, 0xC0, 0x95, 0x2A, 0x00, 0x50, 0xC0, 0x5C,
+0xC6, 0x51, 0xC0, 0xF7, 0x63, 0x71, 0xC2, 0xF9, 0x8C, 0xD3, 0x09, 0x1A, 0x95, 0x71, 0x01, 0xC0,
+0x36, 0x4B, 0x5D, 0xC0, 0x3C, 0xBE, 0x71, 0x02, 0x5C, 0xC0, 0x3E, 0xE7, 0x64, 0x71, 0xC0, 0xB9,
+0x84, 0x4E, 0x55, 0x71, 0x02, 0xC0, 0x1A, 0x8D, 0x4E, 0x7C, 0xC0, 0xFF, 0xFF, 0x00, 0xC0, 0x38,
+0x6C, 0x49, 0xC0, 0x7A, 0x9D, 0x64, 0xC0, 0x74, 0x22, 0x5B, 0x5C, 0x6C, 0x5B, 0xC0, 0x54, 0x22,
+0x7B, 0x71, 0x53, 0xC1, 0xF3, 0x11, 0x7C, 0xC6, 0x71, 0xC0, 0x18, 0x6C, 0x74, 0x71, 0x00, 0xC0,
+0x9B, 0xA5, 0x51, 0x41, 0x71, 0x00, 0x5A, 0x56, 0x6A, 0xC0, 0x1A, 0x8D, 0x65, 0x79, 0x00, 0xC1,
+0xFD, 0xD6, 0xDB, 0xAD, 0x56, 0x6A, 0x71, 0x65, 0x79, 0x00, 0x5F, 0xC1, 0xDF, 0xFF, 0xD5, 0x3A,
+0x82, 0x7B, 0xC0, 0xFF, 0xFF, 0x65, 0x51, 0xC1, 0x1A, 0x8D, 0xFF, 0xFF, 0x6C, 0xC4, 0xFB, 0xB5,
+0x79, 0x7C, 0x76, 0x4B, 0xF3, 0x11, 0x97, 0x53, 0x6C, 0x71, 0xC2, 0x58, 0x74, 0x34, 0x1A, 0x99,
+0x7C, 0x6A, 0x50, 0x71, 0x30, 0x70, 0x00, 0x71, 0x2E, 0x76, 0x6A, 0xA6, 0xC0, 0xD7, 0x63, 0x6C,
+0xC0, 0x36, 0x43, 0x65, 0x72, 0x5F, 0x71, 0x00, 0x79, 0x65, 0x00, 0xC1, 0xF9, 0x84, 0x9F, 0xF7,
+0x46, 0x6A, 0xC1, 0xD5, 0x32, 0x5E, 0xEF, 0x71, 0x00, 0x74, 0x65, 0x00, 0xC1, 0xFB, 0xB5, 0xDD,
+0xD6, 0x6D, 0x65, 0xC0, 0x76, 0x4B, 0x71, 0x57, 0x7A, 0xC0, 0xD7, 0x5B, 0x71, 0x00, 0xC0, 0xB7,
+0x5B, 0x56, 0xC2, 0xB7, 0x53, 0xBD, 0xCE, 0xF9, 0x8C, 0x56, 0x7C, 0x71, 0xC0, 0x5C, 0xBE, 0x51,
+0x60, 0x71, 0x65, 0x4E, 0xC0, 0x1A, 0x95, 0x71, 0x01, 0xC0, 0xD9, 0x84, 0x49, 0xC0, 0x97, 0x53,
+0x5F, 0x00, 0x76, 0x71, 0x5D, 0xC0, 0x14, 0x1A, 0x55, 0x71, 0x43, 0x65, 0xC0, 0x95, 0x32, 0x76,
+0xC3, 0xFD, 0xD6, 0xFB, 0xAD, 0x9F, 0xF7, 0x9D, 0xCE, 0x65, 0xC1, 0xB5, 0x32, 0x7C, 0xC6, 0xA6,
+0xC3, 0x95, 0x2A, 0x34, 0x1A, 0xDD, 0xD6, 0x7E, 0xEF, 0x77, 0xC0, 0xF5, 0x3A, 0x5C, 0xC0, 0xDF,
+0xFF, 0x5B, 0x72, 0x7B, 0x71, 0x53, 0x56, 0x57, 0x6C, 0xC2, 0xD5, 0x32, 0xFC, 0xB5, 0xFF, 0xFF,
+0x00, 0xC0, 0xDB, 0xAD, 0x51, 0xC0, 0x56, 0x4B, 0x76, 0x7B, 0x00, 0x72, 0x49, 0x5A, 0x5C, 0x40,
+0xC0, 0x5A, 0x95, 0x48, 0x40, 0x72, 0x49, 0x5A, 0x5C, 0x40, 0x7E, 0x48, 0x6C, 0xC1, 0xD5, 0x3A,
+0x75, 0x2A, 0x7B, 0x71, 0xC3, 0xF9, 0x8C, 0xD3, 0x09, 0x1A, 0x8D, 0xFF, 0xFF, 0x76, 0xC0, 0xFD,
+0xD6, 0x5C, 0xC0, 0x7D, 0xC6, 0x72, 0x53, 0x64, 0x71, 0x5A, 0x6D, 0x72, 0x00, 0xC0, 0xBD, 0xCE,
+0x71, 0x30, 0x70, 0x00, 0x71, 0x2E, 0x48, 0x46, 0x51, 0xC2, 0x1A, 0x8D, 0xFF, 0xFF, 0x78, 0x74,
+0x4E, 0xC0, 0xF6, 0x3A, 0x64, 0x71, 0x00, 0x57, 0xC0, 0x14, 0x1A, 0x00, 0x76, 0x71, 0xC0, 0x97,
+0x53, 0x4E, 0x58, 0x71, 0x01, 0x55, 0x51, 0x72, 0x6C, 0x64, 0x56, 0x4E, 0xC0, 0xB9, 0x84, 0x71,
+0x43, 0x51, 0x77, 0x71, 0x00, 0x4B, 0x6D, 0xC0, 0xB7, 0x5B, 0x7A, 0xC0, 0xF3, 0x11, 0x49, 0xC0,
+0x7C, 0xC6, 0x71, 0xC0, 0x3C, 0xBE, 0x51, 0xC0, 0xD7, 0x63, 0x71, 0x5D, 0xC2, 0xB3, 0x09, 0x1A,
+0x8D, 0xFF, 0xFF, 0x01, 0x5C, 0xC0, 0x18, 0x64, 0x65, 0x00, 0x56, 0x53, 0x71, 0x41, 0xC1, 0x73,
+0x01, 0x5A, 0x9D, 0x71, 0x00, 0x79, 0xC1, 0x74, 0x22, 0xF4, 0x11, 0x65, 0x7A, 0x50, 0x71, 0x79,
+0x77, 0x65, 0x00, 0x7A, 0xC0, 0x7A, 0x9D, 0x71, 0x48, 0x72, 0xC0, 0xD5, 0x32, 0x5C, 0xC1, 0xDF,
+0xFF, 0xD5, 0x3A, 0x6D, 0x7B, 0x71, 0xC0, 0x97, 0x53, 0x4E, 0x5F, 0x91, 0xC1, 0xB5, 0x32, 0x9E,
+0xEF, 0x71, 0x00, 0x48, 0xC0, 0x76, 0x4B, 0x6A, 0xC1, 0x93, 0x09, 0x78, 0x7C, 0x71, 0xC1, 0xDB,
+0xAD, 0x95, 0x2A, 0x65, 0x46, 0x6D, 0xC1, 0x95, 0x32, 0x3E, 0xE7, 0x71, 0x62, 0x46, 0x65, 0x46,
+0x6D, 0x49, 0x48, 0x6C, 0x4E, 0x72, 0x7B, 0x71, 0xC3, 0xD9, 0x84, 0xB3, 0x09, 0x1A, 0x8D, 0xFF,
+0xFF, 0x60, 0x65, 0x4E, 0x72, 0x00, 0x79, 0x71, 0x01, 0xC2, 0xD7, 0x5B, 0xF3, 0x11, 0x77, 0x53,
+0x71, 0x31, 0x70, 0x00, 0x71, 0x2F, 0x7B, 0x67, 0xC0, 0x9F, 0xF7, 0x71, 0x50, 0x67, 0x43, 0x71,
+0x01, 0x6C, 0xC0, 0xFD, 0xDE, 0x9A, 0x69, 0x71, 0x48, 0x67, 0x48, 0x71, 0x01, 0x64, 0x6C, 0x7B,
+0x71, 0x00, 0x40, 0x67, 0x5C, 0x71, 0x64, 0x67, 0x40, 0x71, 0x00, 0xC0, 0x97, 0x53, 0x65, 0xC0,
+0x7C, 0xC6, 0x6F, 0x76, 0x43, 0x71, 0x00, 0x76, 0x49, 0xC0, 0x18, 0x64, 0x71, 0x50, 0x67, 0x50,
+0x71, 0x03, 0x67, 0x76, 0xC0, 0x5C, 0xBE, 0x48, 0x71, 0x48, 0x67, 0x55, 0x71, 0x01, 0xC0, 0x3E,
+0xE7, 0x7E, 0x76, 0x6F, 0x71, 0x01, 0x40, 0x7E, 0x00, 0x43, 0x71, 0x00, 0xA6, 0xC0, 0xFD, 0xD6,
+0x7B, 0x71, 0x00, 0x7B, 0x6C, 0xC0, 0xDF, 0xFF, 0x71, 0x43, 0x67, 0x69, 0xC0, 0x58, 0x74, 0x5B,
+0x71, 0x02, 0x64, 0xC0, 0xFD, 0xD6, 0x67, 0x48, 0x71, 0x00, 0x50, 0xC1, 0x5C, 0xBE, 0xFB, 0xB5,
+0x57, 0x50, 0x71, 0x01, 0x50, 0x43, 0x6A, 0x57, 0x50, 0x71, 0x00, 0x7B, 0x6C, 0xC0, 0xDF, 0xFF,
+0x71, 0x50, 0x67, 0x50, 0x71, 0x55, 0xC0, 0xBD, 0xCE, 0x76, 0x00, 0x7B, 0x71, 0x02, 0x74, 0x49,
+0xC0, 0x7A, 0x9D, 0x71, 0x31, 0x70, 0x00, 0x71, 0xE0, 0x12, 0xC0, 0x56, 0x4B, 0x49, 0x7E, 0x71,
+0x02, 0x46, 0xC0, 0x95, 0x32, 0x51, 0xC0, 0x9B, 0xA5, 0x71, 0x2B, 0x5A, 0x40, 0x71, 0x26, 0x7B,
+0xC0, 0x18, 0x64, 0x72, 0xC0, 0xD5, 0x3A, 0x50, 0x71, 0x31, 0x70, 0x00, 0x71, 0xE0, 0x12, 0x41,
+0x7C, 0xC0, 0xFD, 0xD6, 0x71, 0x02, 0x74, 0x58, 0xC0, 0x7B, 0x9D, 0x71, 0xE0, 0x16, 0x67, 0x58,
+0x7C, 0x67, 0x71, 0x32, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00,
+0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71,
+0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0x06, 0xA6, 0x95, 0x28, 0x69, 0x71,
+0xE0, 0x78, 0x70, 0x00, 0x71, 0x05, 0x75, 0xC0, 0xBA, 0xD6, 0xA6, 0x29, 0xC1, 0xDB, 0xD6, 0x9E,
+0xF7, 0x71, 0x26, 0xA1, 0xA2, 0x0C, 0xA9, 0x60, 0x71, 0x16, 0x60, 0x4F, 0x56, 0x0C, 0x60, 0x71,
+0x16, 0xC0, 0x9E, 0xFF, 0x56, 0x17, 0x60, 0x71, 0x21, 0x70, 0x00, 0x71, 0x04, 0xC1, 0x7D, 0xEF,
+0x79, 0xCE, 0xAF, 0x2A, 0x79, 0x4D, 0x6C, 0x71, 0x24, 0xC1, 0xBA, 0xFE, 0x76, 0xFD, 0xA9, 0x0D,
+0x4E, 0xC0, 0x59, 0xFE, 0x6C, 0x71, 0x12, 0x6C, 0x46, 0x4E, 0x47, 0x0D, 0x4E, 0x5C, 0x71, 0x13,
+0x60, 0xC0, 0x18, 0xFE, 0x47, 0x18, 0x4E, 0x5C, 0x71, 0x20, 0x70, 0x00, 0x71, 0x04, 0xC0, 0x1C,
+0xDF, 0x79, 0x45, 0x00, 0x48, 0x00, 0x45, 0x00, 0x4D, 0x00, 0x45, 0x02, 0x4D, 0x00, 0x45, 0x04,
+0x4D, 0x00, 0x45, 0x00, 0x48, 0x00, 0x45, 0x48, 0x4D, 0x45, 0x0F, 0x58, 0x71, 0x23, 0xC1, 0x3C,
+0xFF, 0x35, 0xFD, 0x47, 0xAF, 0x03, 0x47, 0xA6, 0x01, 0x47, 0x53, 0x03, 0x4E, 0xA0, 0x5C, 0x71,
+0x12, 0x5C, 0x76, 0x4E, 0x53, 0x03, 0x47, 0x42, 0x01, 0x47, 0x53, 0x03, 0x47, 0x7D, 0x7E, 0x71,
+0x12, 0xC0, 0x38, 0xFE, 0x76, 0x4E, 0x53, 0x03, 0x47, 0x42, 0x01, 0x53, 0x04, 0x42, 0x02, 0x4E,
+0x53, 0x03, 0x47, 0x7D, 0x7E, 0x71, 0x1F, 0x70, 0x00, 0x71, 0x04, 0x6D, 0x45, 0x01, 0x79, 0x00,
+0x59, 0x4D, 0xC0, 0x38, 0xC6, 0xAF, 0x48, 0x45, 0x00, 0x48, 0x71, 0x65, 0x4D, 0x45, 0x02, 0x48,
+0x91, 0x71, 0x48, 0x45, 0x00, 0x74, 0x4D, 0x79, 0x65, 0x48, 0x45, 0x0E, 0xC1, 0x9E, 0xEF, 0xFF,
+0xFF, 0x23, 0xC0, 0x9A, 0xFE, 0x42, 0xC2, 0xB3, 0xDC, 0x30, 0xBC, 0x71, 0xCC, 0x96, 0xA6, 0x5A,
+0xC0, 0x34, 0xED, 0x47, 0x01, 0x70, 0x64, 0x69, 0x71, 0x69, 0x5A, 0xC0, 0xD3, 0xDC, 0x42, 0xC1,
+0xF8, 0xFD, 0xFF, 0xFF, 0x12, 0x70, 0x42, 0xC0, 0xB2, 0xD4, 0x64, 0xC0, 0x71, 0xCC, 0x69, 0x64,
+0x00, 0xC0, 0x35, 0xF5, 0x47, 0x00, 0x4E, 0xC0, 0x14, 0xED, 0x5A, 0x71, 0xA6, 0x69, 0x5A, 0x54,
+0x42, 0xC1, 0x7A, 0xFE, 0xFF, 0xFF, 0x11, 0xA6, 0x53, 0x47, 0xC0, 0x92, 0xD4, 0x64, 0xC0, 0x71,
+0xCC, 0x69, 0x64, 0x69, 0xC0, 0x55, 0xF5, 0x47, 0x01, 0xC0, 0x72, 0xCC, 0x69, 0x71, 0x69, 0x96,
+0x69, 0x7F, 0x47, 0x00, 0x4E, 0xC0, 0xF3, 0xE4, 0x5A, 0x71, 0x69, 0x64, 0x5A, 0x6B, 0x42, 0xC1,
+0x79, 0xFE, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6D, 0xC0, 0x9A, 0xCE, 0x4D,
+0xC3, 0x18, 0xBE, 0xEB, 0x5A, 0x4D, 0x6B, 0x8E, 0x73, 0x74, 0xC0, 0x55, 0xA5, 0xBE, 0x59, 0x02,
+0x69, 0xC0, 0x14, 0xA5, 0x00, 0x4D, 0x00, 0x59, 0x01, 0xC1, 0x14, 0x9D, 0xB2, 0x94, 0x59, 0x00,
+0x68, 0xC0, 0xCB, 0x5A, 0x44, 0xC1, 0xF3, 0x9C, 0x34, 0xA5, 0x59, 0x01, 0xA5, 0x48, 0x59, 0x00,
+0x4D, 0x45, 0x07, 0xC0, 0x9E, 0xEF, 0x71, 0x23, 0x52, 0x4E, 0xC4, 0xAF, 0xA3, 0xE7, 0x49, 0x6A,
+0x6A, 0x2D, 0x93, 0xCF, 0xAB, 0x00, 0x6B, 0xC0, 0x76, 0xFD, 0x47, 0x53, 0x54, 0xC3, 0x08, 0x52,
+0x49, 0x62, 0xEC, 0x82, 0xAF, 0xAB, 0x7E, 0x40, 0x47, 0xC0, 0xF7, 0xFD, 0x71, 0x12, 0xC0, 0xF8,
+0xFD, 0x4E, 0xC0, 0x8E, 0x9B, 0x57, 0xC1, 0x8A, 0x6A, 0x4D, 0x93, 0x7E, 0x00, 0xC0, 0x34, 0xED,
+0x4E, 0x47, 0xAF, 0x40, 0x66, 0x7D, 0x77, 0x79, 0x7E, 0xC0, 0xB2, 0xD4, 0x42, 0x4B, 0x71, 0x11,
+0x6C, 0x53, 0x4E, 0xC2, 0x4D, 0x93, 0xE7, 0x51, 0x8A, 0x72, 0x53, 0x7E, 0xBE, 0x7A, 0x47, 0x00,
+0x4E, 0x77, 0xC2, 0xE8, 0x51, 0xAA, 0x72, 0x6D, 0x9B, 0x7E, 0xC0, 0x10, 0xB4, 0x7F, 0x47, 0x00,
+0xAF, 0xC0, 0x10, 0xBC, 0x57, 0xC1, 0x69, 0x6A, 0x2C, 0x8B, 0x7E, 0x00, 0xC0, 0xF3, 0xE4, 0x42,
+0x4B, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0x4D, 0xC0,
+0xB6, 0xB5, 0x58, 0x4D, 0xC2, 0x71, 0x8C, 0xCF, 0x7B, 0xF7, 0xBD, 0x00, 0xC2, 0x59, 0xC6, 0x10,
+0x84, 0xB2, 0x94, 0x51, 0xBF, 0x41, 0xC0, 0x6A, 0x52, 0x68, 0x7D, 0xC0, 0xEF, 0x7B, 0x41, 0xC0,
+0xFB, 0xDE, 0x41, 0x68, 0xC0, 0xDB, 0xD6, 0x00, 0x40, 0xC0, 0x35, 0xA5, 0x41, 0xC0, 0x4D, 0x6B,
+0x5D, 0x00, 0x6D, 0x40, 0x65, 0x45, 0xC0, 0x71, 0x8C, 0x40, 0xC0, 0x59, 0xC6, 0x4D, 0x45, 0x06,
+0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x23, 0xC2, 0x7A, 0xFE, 0x35, 0xFD, 0xB6, 0xFD, 0x47, 0xC1, 0x71,
+0xCC, 0x0C, 0x83, 0x91, 0x47, 0x53, 0x47, 0x00, 0x42, 0x53, 0x58, 0xC4, 0xD3, 0xDC, 0x8E, 0xA3,
+0x69, 0x6A, 0x92, 0xD4, 0xB7, 0xFD, 0x42, 0x69, 0xC0, 0xFF, 0xFF, 0x12, 0xC0, 0xF8, 0xFD, 0x42,
+0x58, 0x7F, 0xC0, 0x51, 0xC4, 0x77, 0xA9, 0x4E, 0x00, 0x47, 0x00, 0x42, 0x53, 0x00, 0xC2, 0xB2,
+0xD4, 0x6E, 0x9B, 0x69, 0x6A, 0x4F, 0x58, 0x7D, 0x4B, 0x71, 0x11, 0xA6, 0x53, 0x42, 0x5F, 0x7F,
+0x69, 0xC0, 0xEB, 0x7A, 0x7C, 0x53, 0x4E, 0x47, 0x01, 0x5F, 0xC3, 0x34, 0xED, 0x30, 0xBC, 0xAA,
+0x72, 0x4D, 0x93, 0x58, 0x47, 0x01, 0x42, 0xC0, 0x96, 0xFD, 0x4E, 0xC2, 0x92, 0xCC, 0x2D, 0x8B,
+0x8A, 0x72, 0x70, 0x53, 0x42, 0xC0, 0x79, 0xFE, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0x4D, 0xC8, 0xB6, 0xB5, 0xAF, 0x7B, 0xDB, 0xD6, 0x79, 0xCE, 0x8E,
+0x73, 0x51, 0x84, 0x34, 0xA5, 0x30, 0x84, 0x71, 0x8C, 0x44, 0xC0, 0x92, 0x94, 0x55, 0xC0, 0xEF,
+0x7B, 0x44, 0xC1, 0x75, 0xAD, 0xD7, 0xB5, 0x55, 0x44, 0xC0, 0xF7, 0xBD, 0x50, 0x68, 0xC0, 0xDB,
+0xD6, 0x00, 0xC0, 0x10, 0x84, 0x68, 0x91, 0xC1, 0xAB, 0x5A, 0xD3, 0x9C, 0x95, 0xC0, 0x2C, 0x63,
+0x54, 0xAE, 0x5C, 0x58, 0x7D, 0xC0, 0x59, 0xC6, 0x4D, 0x96, 0x06, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF,
+0x23, 0x52, 0x47, 0xC1, 0x51, 0xC4, 0xCB, 0x7A, 0x00, 0xC0, 0x4D, 0x93, 0x46, 0x78, 0x7F, 0x47,
+0x00, 0x4E, 0xC1, 0x14, 0xE5, 0x0C, 0x8B, 0x81, 0xC0, 0x2C, 0x8B, 0x76, 0x69, 0xC0, 0xF4, 0xE4,
+0x42, 0xC0, 0xF7, 0xFD, 0x71, 0x12, 0xC0, 0xF8, 0xFD, 0x47, 0x5A, 0x68, 0xAE, 0xC3, 0x6D, 0x93,
+0xF0, 0xB3, 0x92, 0xD4, 0x55, 0xF5, 0x47, 0x00, 0x4E, 0xC1, 0xF3, 0xE4, 0x0C, 0x83, 0x68, 0x44,
+0x7E, 0xC1, 0x51, 0xC4, 0x14, 0xE5, 0x42, 0x4B, 0x71, 0x11, 0x6C, 0xC0, 0x96, 0xFD, 0x4E, 0xC1,
+0x10, 0xB4, 0xCB, 0x7A, 0xBE, 0x5B, 0x52, 0x40, 0x7F, 0x47, 0x00, 0x4E, 0x7E, 0x68, 0x77, 0x62,
+0xC1, 0x10, 0xBC, 0xB2, 0xD4, 0x47, 0x01, 0x53, 0x40, 0x68, 0x00, 0xC0, 0x4D, 0x93, 0x7E, 0xC1,
+0x71, 0xCC, 0x34, 0xED, 0x42, 0x4B, 0xC0, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0xBE, 0x7D, 0x67, 0xC0, 0xDB, 0xD6, 0x79, 0xC0, 0x6E, 0x73, 0x54,
+0x50, 0x67, 0x4D, 0xC2, 0x34, 0xA5, 0x92, 0x94, 0x35, 0xA5, 0x54, 0x91, 0x59, 0xC2, 0x75, 0xAD,
+0xCF, 0x7B, 0xCB, 0x5A, 0x69, 0x55, 0x68, 0x59, 0xBA, 0x40, 0xC0, 0xCB, 0x5A, 0x54, 0x41, 0x91,
+0xBF, 0x41, 0x65, 0x40, 0x51, 0x75, 0x54, 0x79, 0x48, 0x45, 0x06, 0xC0, 0x9E, 0xEF, 0x71, 0x23,
+0xC0, 0x7A, 0xFE, 0x47, 0x7E, 0xC0, 0xAA, 0x72, 0x6A, 0x46, 0x7E, 0x95, 0x6B, 0x4E, 0x47, 0xAF,
+0x4F, 0xC1, 0x8A, 0x72, 0x4D, 0x93, 0x7E, 0x46, 0x6F, 0x78, 0x47, 0xC0, 0xF7, 0xFD, 0x71, 0x12,
+0xC0, 0xF8, 0xFD, 0x47, 0x6A, 0xC0, 0xAB, 0x72, 0x6F, 0x46, 0x7E, 0x76, 0xC0, 0x34, 0xED, 0x4E,
+0x47, 0xAF, 0xC1, 0x92, 0xD4, 0x8A, 0x6A, 0x5B, 0x7E, 0x46, 0x6F, 0x40, 0x42, 0x4B, 0x71, 0x11,
+0xA6, 0x53, 0x4E, 0x5B, 0xC0, 0xCB, 0x7A, 0x6F, 0x46, 0x7E, 0x00, 0x7A, 0x47, 0x01, 0x44, 0x91,
+0x76, 0x46, 0x7E, 0x00, 0x7F, 0x47, 0x00, 0x53, 0xC0, 0x10, 0xBC, 0x54, 0xC0, 0x8E, 0x9B, 0x46,
+0x9A, 0x6F, 0xC0, 0xF3, 0xE4, 0x42, 0x4B, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0,
+0x1C, 0xDF, 0x45, 0x4D, 0x7D, 0xC0, 0x8E, 0x73, 0x4D, 0xC2, 0x92, 0x94, 0xCF, 0x7B, 0xB2, 0x94,
+0x50, 0x6C, 0x49, 0xC0, 0x51, 0x8C, 0x68, 0xC1, 0x34, 0xA5, 0x30, 0x84, 0x6C, 0xC4, 0x9A, 0xCE,
+0x6D, 0x6B, 0xF7, 0xBD, 0xAE, 0x73, 0x55, 0xA5, 0x55, 0xC1, 0x72, 0x8C, 0xDB, 0xD6, 0x00, 0xC0,
+0x10, 0x84, 0x55, 0xC0, 0x5D, 0xE7, 0x55, 0x68, 0x7C, 0xAE, 0xC0, 0x18, 0xBE, 0x6C, 0x4D, 0x79,
+0x58, 0x7C, 0x59, 0x45, 0x06, 0xC0, 0x9E, 0xEF, 0x71, 0x23, 0x52, 0x42, 0x78, 0x67, 0x6A, 0x76,
+0xC0, 0x10, 0xBC, 0x78, 0x7F, 0x47, 0x00, 0x4E, 0x6B, 0x6F, 0x6A, 0x00, 0xC1, 0xF0, 0xB3, 0x51,
+0xC4, 0x6B, 0x42, 0xC0, 0xF7, 0xFD, 0x71, 0x12, 0xC0, 0xF8, 0xFD, 0x47, 0xC0, 0x71, 0xCC, 0x67,
+0x6A, 0xBF, 0x5A, 0xC0, 0x92, 0xCC, 0x7F, 0x47, 0x00, 0x4E, 0x63, 0x6A, 0x01, 0xC1, 0x10, 0xB4,
+0x51, 0xC4, 0x6B, 0x42, 0x4B, 0xC0, 0xFF, 0xFF, 0x11, 0xA6, 0x53, 0x47, 0x69, 0x67, 0x6A, 0x79,
+0x5A, 0xC0, 0x92, 0xD4, 0x7F, 0x47, 0x01, 0x55, 0x67, 0x6A, 0x7E, 0xC1, 0x31, 0xBC, 0xB2, 0xD4,
+0x47, 0x01, 0x4E, 0x45, 0x67, 0x6A, 0x6F, 0x55, 0xC0, 0x71, 0xCC, 0x7A, 0x42, 0x4B, 0xC0, 0xFF,
+0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0xBE, 0x51, 0xC1,
+0xCB, 0x5A, 0x4D, 0x6B, 0x49, 0xC0, 0x59, 0xC6, 0x41, 0xC1, 0x55, 0xAD, 0xB6, 0xB5, 0x49, 0xC2,
+0x0C, 0x63, 0xB2, 0x94, 0x75, 0xAD, 0x41, 0xC0, 0x31, 0x84, 0x90, 0xC0, 0x71, 0x8C, 0x49, 0xC1,
+0xEB, 0x62, 0x96, 0xB5, 0x91, 0x7C, 0xC0, 0xDB, 0xD6, 0x00, 0xC0, 0x71, 0x8C, 0x64, 0xC0, 0xFB,
+0xDE, 0x64, 0x41, 0xC0, 0x34, 0xA5, 0x00, 0xC0, 0x18, 0xC6, 0x59, 0x78, 0x58, 0x00, 0xC0, 0xD7,
+0xB5, 0x4D, 0x45, 0x06, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x08, 0xC0, 0x9E, 0xF7, 0xAE, 0x71, 0x02,
+0x6C, 0x71, 0x01, 0x6C, 0xC0, 0x5D, 0xEF, 0x5D, 0xA1, 0x6C, 0x71, 0x0A, 0xC0, 0x7A, 0xFE, 0x42,
+0x7F, 0xC1, 0xD3, 0xDC, 0x51, 0xC4, 0x62, 0xC0, 0x8A, 0x6A, 0x91, 0xC0, 0xF3, 0xE4, 0x4E, 0x47,
+0x01, 0xC1, 0x14, 0xE5, 0x72, 0xCC, 0x7E, 0xC1, 0xCB, 0x7A, 0x08, 0x5A, 0x46, 0x53, 0xC0, 0xF7,
+0xFD, 0x71, 0x12, 0xC0, 0xF8, 0xFD, 0x42, 0x7F, 0x54, 0xC0, 0x31, 0xC4, 0x5B, 0xC0, 0x6A, 0x6A,
+0x7D, 0xC0, 0x14, 0xE5, 0x4E, 0x47, 0x01, 0x63, 0xC0, 0x71, 0xCC, 0x79, 0xC2, 0xCB, 0x7A, 0x08,
+0x5A, 0x10, 0xBC, 0x4E, 0x4B, 0xC0, 0xFF, 0xFF, 0x11, 0x6C, 0x53, 0x42, 0x7F, 0x4F, 0xC2, 0x31,
+0xBC, 0x4D, 0x93, 0x69, 0x6A, 0x4C, 0xC0, 0x34, 0xED, 0x4E, 0x47, 0x00, 0x7A, 0xC0, 0xB2, 0xD4,
+0x55, 0xC0, 0x2D, 0x93, 0x7D, 0xC0, 0xAB, 0x72, 0x7F, 0x47, 0x01, 0x7F, 0x5C, 0xC0, 0x51, 0xC4,
+0x6A, 0xC1, 0x8A, 0x72, 0x28, 0x5A, 0x40, 0x47, 0x4B, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0x01, 0xA5, 0x96, 0x4D, 0x00, 0x45, 0x4D, 0xC4, 0x18, 0xC6,
+0x55, 0xAD, 0x6D, 0x6B, 0x55, 0xA5, 0xDB, 0xD6, 0x48, 0x00, 0x74, 0x48, 0xC0, 0x18, 0xBE, 0x45,
+0x0E, 0x5D, 0x71, 0x4D, 0x45, 0x07, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x08, 0xC0, 0xF4, 0xA4, 0x41,
+0xC0, 0x7D, 0xF7, 0x58, 0x71, 0xC1, 0x7E, 0xEF, 0xD7, 0xBD, 0x71, 0x48, 0xC2, 0x1C, 0xE7, 0x39,
+0xCE, 0xF3, 0xA4, 0x79, 0xC0, 0x92, 0x94, 0x41, 0xC0, 0x7D, 0xEF, 0x71, 0x09, 0x52, 0x47, 0x7E,
+0x6E, 0x77, 0x46, 0xC0, 0xD3, 0xDC, 0x47, 0xAB, 0x47, 0x00, 0x4E, 0x54, 0x7D, 0xC0, 0xAA, 0x72,
+0x6A, 0x78, 0x7F, 0x4E, 0x42, 0xC0, 0xF7, 0xFD, 0x71, 0x12, 0xC0, 0xF8, 0xFD, 0x4E, 0xC0, 0xAE,
+0xA3, 0x6E, 0xC0, 0x0C, 0x83, 0x46, 0x54, 0x47, 0x02, 0xAF, 0xC1, 0xB2, 0xD4, 0x29, 0x62, 0x59,
+0x6A, 0x40, 0x7F, 0x4E, 0x42, 0xC0, 0x79, 0xFE, 0x71, 0x11, 0x6C, 0x53, 0x4E, 0x62, 0x6E, 0xC1,
+0x0C, 0x8B, 0xF0, 0xB3, 0x5C, 0x4E, 0x47, 0x01, 0x4E, 0xC0, 0x2C, 0x8B, 0x7D, 0x44, 0xC0, 0x10,
+0xBC, 0x63, 0x4E, 0x47, 0x01, 0x53, 0xC2, 0x31, 0xC4, 0x08, 0x5A, 0xCB, 0x7A, 0x7E, 0xC0, 0xB3,
+0xD4, 0x47, 0x4E, 0x42, 0x4B, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6D, 0xC0, 0x9A,
+0xCE, 0x01, 0x48, 0x01, 0x45, 0x00, 0xBE, 0xC2, 0xF7, 0xBD, 0xEF, 0x7B, 0xB2, 0x94, 0x48, 0x00,
+0x45, 0x00, 0x48, 0x45, 0x4D, 0x48, 0x45, 0x0D, 0x4D, 0x00, 0x45, 0x08, 0xC1, 0x9E, 0xEF, 0xFF,
+0xFF, 0x07, 0x6C, 0xC0, 0x34, 0xA5, 0xBA, 0xC0, 0xB6, 0xB5, 0x41, 0x74, 0xC0, 0xF3, 0xA4, 0x96,
+0x71, 0x74, 0xC0, 0xDB, 0xDE, 0x51, 0xC1, 0x55, 0xAD, 0x7A, 0xD6, 0x65, 0x48, 0x51, 0x71, 0x09,
+0x52, 0x42, 0x47, 0x6B, 0xC2, 0x31, 0xC4, 0x4D, 0x93, 0x6A, 0x6A, 0x6E, 0xC0, 0xF3, 0xE4, 0x4E,
+0x47, 0x01, 0x96, 0x40, 0x6F, 0x68, 0xC0, 0xE7, 0x51, 0x7E, 0xC1, 0x96, 0xFD, 0xF7, 0xFD, 0x71,
+0x12, 0xC0, 0xF8, 0xFD, 0x42, 0x47, 0x6B, 0xC2, 0x30, 0xBC, 0x4D, 0x93, 0x69, 0x6A, 0x82, 0xC0,
+0x14, 0xE5, 0x4E, 0x47, 0x01, 0x7A, 0x40, 0x6A, 0xC2, 0xAB, 0x7A, 0xE7, 0x51, 0x10, 0xB4, 0x4E,
+0x4B, 0x71, 0x11, 0x6C, 0xC0, 0x96, 0xFD, 0x42, 0x47, 0x68, 0xC2, 0x30, 0xBC, 0x2D, 0x93, 0x49,
+0x62, 0x00, 0xC1, 0x34, 0xED, 0x76, 0xFD, 0x47, 0x01, 0x5C, 0x52, 0xC0, 0x2C, 0x8B, 0x75, 0xC0,
+0x8A, 0x72, 0x7F, 0x47, 0x02, 0x70, 0xC0, 0x51, 0xC4, 0x5B, 0x54, 0x66, 0x40, 0x47, 0x4B, 0x71,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0x05, 0x4D, 0x01, 0xAF,
+0x00, 0x48, 0x4D, 0x48, 0x45, 0x01, 0x4D, 0x02, 0x45, 0x05, 0x4D, 0x00, 0x45, 0x0E, 0xC0, 0x9E,
+0xEF, 0x71, 0x08, 0xC0, 0x92, 0x94, 0x95, 0x7C, 0xC0, 0x14, 0xA5, 0x7C, 0xC1, 0xBA, 0xDE, 0xD7,
+0xBD, 0x71, 0x74, 0xC0, 0x1C, 0xE7, 0x65, 0xC0, 0xB6, 0xB5, 0x4D, 0x79, 0xC0, 0xFB, 0xE6, 0x4C,
+0x71, 0x09, 0xC0, 0x7A, 0xFE, 0x42, 0xC1, 0x71, 0xCC, 0x2D, 0x93, 0x62, 0x46, 0xBF, 0xC0, 0x72,
+0xCC, 0x7F, 0x47, 0x00, 0xAB, 0xC0, 0x14, 0xE5, 0x5B, 0x96, 0x7E, 0xBF, 0x69, 0xC0, 0xF4, 0xE4,
+0x42, 0xC1, 0xF7, 0xFD, 0xFF, 0xFF, 0x12, 0xC0, 0xF8, 0xFD, 0x47, 0xC1, 0x51, 0xC4, 0x2D, 0x93,
+0x67, 0x46, 0x55, 0xC0, 0x92, 0xCC, 0x7F, 0x47, 0x00, 0xAB, 0x5C, 0x53, 0x00, 0x7E, 0x4D, 0x69,
+0x6B, 0x42, 0x4B, 0x71, 0x11, 0x6C, 0xC0, 0x96, 0xFD, 0x47, 0x5A, 0xC0, 0x2D, 0x93, 0x67, 0x46,
+0x55, 0x40, 0x7F, 0x47, 0x01, 0x4D, 0x4E, 0x6A, 0x46, 0x5A, 0xC0, 0xB2, 0xD4, 0x47, 0x01, 0xAB,
+0x40, 0xC0, 0x4D, 0x93, 0x5B, 0x7E, 0xC2, 0x10, 0xB4, 0x71, 0xCC, 0x34, 0xED, 0x42, 0x4B, 0xC0,
+0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6D, 0xC0, 0x9A, 0xCE, 0x04, 0xC0, 0xDB,
+0xD6, 0x65, 0x5D, 0x60, 0xC0, 0xBA, 0xD6, 0x00, 0x45, 0x51, 0x45, 0x4D, 0x01, 0x65, 0x51, 0xC1,
+0x75, 0xAD, 0x59, 0xC6, 0x4D, 0x00, 0x48, 0x4D, 0x00, 0x45, 0x4D, 0x65, 0x00, 0x48, 0x45, 0x0D,
+0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x07, 0x6C, 0x60, 0xC1, 0xDB, 0xDE, 0x92, 0x94, 0x51, 0x4D, 0xC0,
+0x14, 0xA5, 0xAE, 0x71, 0x79, 0xC0, 0xF3, 0xA4, 0x50, 0xC0, 0x75, 0xB5, 0x43, 0x7C, 0x50, 0xC0,
+0x3C, 0xEF, 0x71, 0x09, 0xC0, 0x7A, 0xFE, 0x42, 0xC1, 0xB2, 0xD4, 0x0C, 0x83, 0xBE, 0xC0, 0x72,
+0xCC, 0x5F, 0xA5, 0x47, 0x02, 0x7A, 0xC0, 0x4D, 0x93, 0x91, 0x7E, 0xC0, 0x96, 0xFD, 0x00, 0x4E,
+0x42, 0xC0, 0xF7, 0xFD, 0x71, 0x12, 0xC0, 0xF8, 0xFD, 0x47, 0x40, 0x7C, 0xBF, 0x40, 0x5F, 0x53,
+0x47, 0x01, 0x4E, 0x80, 0xC0, 0x4D, 0x93, 0x7F, 0x46, 0xC0, 0x96, 0xFD, 0x00, 0x4E, 0x42, 0xC0,
+0x79, 0xFE, 0x71, 0x11, 0xA6, 0x53, 0x4E, 0xC0, 0x71, 0xCC, 0x77, 0xC0, 0x2D, 0x93, 0x4F, 0x5F,
+0x53, 0x47, 0x01, 0x53, 0x5A, 0x77, 0xC0, 0x4D, 0x93, 0x63, 0x5F, 0xA5, 0x47, 0x01, 0xAB, 0xC0,
+0xF3, 0xE4, 0x7F, 0x44, 0xC1, 0x31, 0xC4, 0xB6, 0xFD, 0x53, 0x47, 0x42, 0x4B, 0xC0, 0xFF, 0xFF,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6D, 0xC0, 0x9A, 0xCE, 0x03, 0x4D, 0x5D, 0xC1, 0x30,
+0x84, 0x55, 0xAD, 0x51, 0x65, 0xC2, 0x96, 0xB5, 0x59, 0xC6, 0xD3, 0x9C, 0x45, 0x71, 0x78, 0x74,
+0xC3, 0x95, 0xAD, 0xCF, 0x7B, 0x10, 0x84, 0x51, 0x8C, 0x79, 0x78, 0xC0, 0x9A, 0xCE, 0x51, 0x91,
+0x4D, 0x65, 0x54, 0xC0, 0x96, 0xAD, 0x4D, 0x45, 0x0D, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x07, 0x48,
+0xC7, 0x6D, 0x73, 0xEF, 0x7B, 0x8E, 0x73, 0xAA, 0x5A, 0xAE, 0x7B, 0xEB, 0x62, 0x4D, 0x6B, 0x30,
+0x84, 0x71, 0xC1, 0x8A, 0x52, 0x2C, 0x63, 0x48, 0x58, 0xC0, 0xEB, 0x5A, 0xBF, 0xC1, 0x34, 0xA5,
+0xFF, 0xFF, 0x09, 0x52, 0x4E, 0xC0, 0x4D, 0x93, 0x7E, 0xC2, 0xD3, 0xDC, 0x8A, 0x72, 0x55, 0xF5,
+0x4E, 0x47, 0x01, 0xAF, 0xC2, 0x71, 0xCC, 0xCB, 0x7A, 0x35, 0xE5, 0x68, 0xC1, 0x51, 0xC4, 0xB6,
+0xFD, 0x47, 0x42, 0xC1, 0xF7, 0xFD, 0xFF, 0xFF, 0x12, 0xC0, 0xF8, 0xFD, 0x4E, 0xC3, 0x0C, 0x8B,
+0xF0, 0xB3, 0x92, 0xD4, 0xAA, 0x72, 0x4E, 0x00, 0x47, 0x01, 0x53, 0xC0, 0x31, 0xC4, 0x77, 0x74,
+0xC0, 0xAB, 0x7A, 0x40, 0x53, 0x47, 0x42, 0x4B, 0x71, 0x11, 0xA6, 0x53, 0x00, 0xC0, 0xEB, 0x82,
+0x5A, 0xC0, 0x72, 0xCC, 0x63, 0x53, 0x4E, 0x47, 0x01, 0x4E, 0x63, 0x40, 0xC0, 0x10, 0xBC, 0x77,
+0x58, 0x4E, 0x47, 0x01, 0x53, 0x6F, 0x5B, 0xC1, 0x14, 0xE5, 0x8A, 0x6A, 0x6B, 0x53, 0x47, 0x42,
+0x4B, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6D, 0xC0, 0x9A, 0xCE, 0x02, 0xBE, 0xC2,
+0x18, 0xC6, 0x51, 0x8C, 0xAE, 0x73, 0x41, 0xC2, 0x34, 0xA5, 0x92, 0x94, 0xEF, 0x7B, 0x7C, 0xC0,
+0x10, 0x84, 0x91, 0x65, 0x68, 0xC1, 0x30, 0x84, 0x75, 0xAD, 0x6C, 0x40, 0x54, 0x7C, 0x5D, 0x7C,
+0x7D, 0x6C, 0xC1, 0x55, 0xAD, 0x92, 0x8C, 0x5D, 0x69, 0xC0, 0xDB, 0xD6, 0x91, 0x0D, 0xC1, 0x9E,
+0xEF, 0xFF, 0xFF, 0x07, 0xC0, 0x5D, 0xEF, 0x60, 0xAE, 0xBF, 0x00, 0x65, 0x03, 0x74, 0xC0, 0x9A,
+0xD6, 0x79, 0x74, 0x00, 0x60, 0x48, 0x71, 0x09, 0x52, 0x47, 0xC1, 0x4D, 0x93, 0xEB, 0x7A, 0x5B,
+0xC1, 0x49, 0x62, 0x2C, 0x8B, 0xBB, 0xC1, 0xF4, 0xE4, 0x76, 0xFD, 0x47, 0xAF, 0xC0, 0x71, 0xCC,
+0x51, 0x67, 0xC0, 0x8A, 0x72, 0xAF, 0xC1, 0x2D, 0x8B, 0x51, 0xC4, 0x47, 0xC1, 0xF7, 0xFD, 0xFF,
+0xFF, 0x12, 0xC0, 0xF8, 0xFD, 0x4E, 0x44, 0x77, 0xC0, 0x4D, 0x93, 0x7D, 0x44, 0x53, 0x6B, 0x4E,
+0x47, 0xAF, 0xC0, 0x31, 0xC4, 0x51, 0x67, 0x51, 0xC0, 0xCB, 0x7A, 0x44, 0xC0, 0x71, 0xCC, 0x47,
+0xC1, 0x79, 0xFE, 0xFF, 0xFF, 0x11, 0xA6, 0x53, 0x4E, 0xC0, 0x0C, 0x83, 0x7F, 0xC0, 0x4D, 0x93,
+0x7D, 0xC0, 0x2D, 0x93, 0x53, 0xC1, 0x34, 0xED, 0x76, 0xFD, 0x47, 0x00, 0x68, 0xC0, 0x2D, 0x8B,
+0x44, 0x7D, 0x53, 0x62, 0xC0, 0x55, 0xF5, 0x47, 0x00, 0xAF, 0x76, 0xC0, 0xAB, 0x7A, 0x67, 0x7D,
+0x7C, 0x44, 0xC0, 0xD3, 0xDC, 0x42, 0xC0, 0x79, 0xFE, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x02, 0x4D, 0xC0, 0x96, 0xAD, 0x91, 0x41, 0x92, 0xA5, 0x41, 0xC1,
+0x75, 0xAD, 0xB2, 0x94, 0x40, 0xC0, 0xF4, 0x9C, 0x65, 0xC0, 0x71, 0x8C, 0x5D, 0xC1, 0x34, 0xA5,
+0xCF, 0x7B, 0x40, 0xC1, 0x51, 0x8C, 0xF0, 0x7B, 0x59, 0x55, 0xC2, 0xD3, 0x9C, 0xEF, 0x7B, 0x51,
+0x84, 0x61, 0x55, 0xBF, 0x4D, 0x45, 0x0D, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x01, 0xA6, 0xC0, 0x3C,
+0xE7, 0x71, 0x05, 0xC1, 0x1C, 0xE7, 0x9E, 0xF7, 0x71, 0x04, 0xC0, 0xBB, 0xDE, 0x95, 0x71, 0x02,
+0xA2, 0x71, 0x08, 0xC1, 0xFB, 0xFE, 0x35, 0xFD, 0x7F, 0xC0, 0xF4, 0xE4, 0x00, 0x6B, 0x63, 0x5C,
+0x7F, 0x47, 0x01, 0x42, 0x6B, 0x5C, 0x6B, 0x9A, 0x5C, 0xC0, 0x34, 0xED, 0x7D, 0x4B, 0x71, 0x12,
+0x4B, 0x7D, 0x7F, 0x63, 0x00, 0x6B, 0x63, 0x00, 0x7F, 0x47, 0x01, 0x7F, 0x6B, 0x5C, 0x6B, 0x68,
+0x5C, 0x70, 0x7D, 0x6D, 0x71, 0x12, 0xC0, 0xF7, 0xFD, 0x7D, 0x7A, 0x63, 0x00, 0x6B, 0x63, 0x00,
+0x7F, 0x47, 0x01, 0x7A, 0x63, 0x00, 0x6B, 0x5C, 0x63, 0x47, 0x02, 0x7F, 0x63, 0x5C, 0x6B, 0x63,
+0x5C, 0x7A, 0x7D, 0x6D, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45,
+0x02, 0x4D, 0xC1, 0x59, 0xCE, 0x30, 0x84, 0x5D, 0xC0, 0x34, 0xA5, 0x64, 0x81, 0xC0, 0x6D, 0x6B,
+0x7C, 0x41, 0x54, 0xC0, 0x14, 0xA5, 0x40, 0x00, 0xC0, 0x75, 0xAD, 0x45, 0xC0, 0xF7, 0xBD, 0x55,
+0x59, 0x54, 0xC3, 0xB6, 0xB5, 0x92, 0x94, 0xCF, 0x7B, 0x35, 0xA5, 0x68, 0xC0, 0x8E, 0x73, 0x7D,
+0xC0, 0xBA, 0xD6, 0x96, 0x0D, 0xC0, 0x9E, 0xEF, 0x71, 0x01, 0xC1, 0x9E, 0xF7, 0x96, 0xB5, 0x71,
+0x74, 0x75, 0xA6, 0x4D, 0xC0, 0xDF, 0xFF, 0x7D, 0x64, 0xC1, 0xDB, 0xDE, 0x38, 0xCE, 0x5C, 0x71,
+0xC0, 0x18, 0xC6, 0x70, 0xC0, 0x7D, 0xEF, 0x41, 0xC0, 0xFB, 0xDE, 0x48, 0xC0, 0xF3, 0xA4, 0x5C,
+0x00, 0xC0, 0xD7, 0xBD, 0x69, 0x58, 0x49, 0x5C, 0x79, 0x71, 0x03, 0x6C, 0xC0, 0x38, 0xFE, 0x42,
+0x04, 0xA6, 0x03, 0x42, 0x04, 0xC1, 0xD7, 0xFD, 0x9E, 0xFF, 0x71, 0x12, 0xA1, 0x64, 0x42, 0x04,
+0x7D, 0x03, 0x42, 0x04, 0x7A, 0x6C, 0x71, 0x12, 0xC0, 0x5D, 0xFF, 0x53, 0x42, 0x04, 0x7D, 0x02,
+0x42, 0x04, 0x7D, 0x02, 0x42, 0x05, 0x7A, 0x6C, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0x6D, 0x45, 0x03, 0x4D, 0x79, 0x00, 0x48, 0x4D, 0x69, 0xC0, 0xEF, 0x7B, 0x4C, 0x4D, 0x79, 0x45,
+0x91, 0x79, 0x45, 0x01, 0x48, 0x45, 0x65, 0x79, 0x00, 0x71, 0x4D, 0x79, 0x71, 0x48, 0x45, 0x0E,
+0x55, 0xC0, 0xFF, 0xFF, 0x01, 0x58, 0xC0, 0xB6, 0xB5, 0x75, 0xC0, 0x34, 0xA5, 0x7D, 0x79, 0xC0,
+0x92, 0x94, 0x4C, 0xC0, 0x55, 0xAD, 0x50, 0x64, 0x7C, 0x7D, 0x79, 0xC0, 0x34, 0xAD, 0x64, 0x6C,
+0x7C, 0x4C, 0x5C, 0x69, 0x79, 0x68, 0x78, 0x69, 0x74, 0x65, 0x59, 0x65, 0x71, 0x05, 0xC0, 0x3D,
+0xFF, 0xA1, 0xAE, 0x0B, 0x74, 0x79, 0x6C, 0x71, 0x14, 0x6C, 0xC0, 0x3C, 0xFF, 0x74, 0x79, 0x0B,
+0x74, 0x45, 0x71, 0x15, 0x60, 0x79, 0x74, 0x79, 0x15, 0x74, 0x7E, 0x71, 0x21, 0x70, 0x00, 0x71,
+0x04, 0x6D, 0xC0, 0x9A, 0xCE, 0x04, 0x48, 0x4D, 0x01, 0x65, 0xA6, 0x4D, 0x01, 0x45, 0x4D, 0x48,
+0x4D, 0x00, 0x48, 0x4D, 0x01, 0x45, 0x48, 0x4D, 0x00, 0x48, 0x00, 0x45, 0x0F, 0xC0, 0x9E, 0xEF,
+0x71, 0x01, 0xC0, 0x9E, 0xF7, 0x78, 0x4D, 0xC0, 0x39, 0xCE, 0x7D, 0xC1, 0x34, 0xA5, 0xB2, 0x94,
+0x50, 0x48, 0xC0, 0x34, 0xAD, 0x50, 0xC0, 0x59, 0xCE, 0x65, 0x4C, 0x74, 0x7D, 0x71, 0x91, 0x50,
+0xC0, 0x38, 0xCE, 0x65, 0xC1, 0xB6, 0xBD, 0x92, 0x94, 0x78, 0x74, 0x60, 0xC0, 0xB7, 0xBD, 0x74,
+0x44, 0xC0, 0x9E, 0xF7, 0x71, 0xE0, 0x54, 0x70, 0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x03,
+0x48, 0x5C, 0x69, 0xAF, 0x4C, 0x5C, 0x9A, 0xC0, 0x79, 0xCE, 0x64, 0x51, 0x4D, 0x00, 0x59, 0x7D,
+0x68, 0xC1, 0x59, 0xC6, 0x14, 0x9D, 0x65, 0x75, 0x61, 0xC0, 0x18, 0xBE, 0x91, 0x51, 0xC0, 0xBA,
+0xD6, 0x01, 0x45, 0x0E, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x01, 0x6C, 0x70, 0x50, 0x7C, 0x60, 0x4C,
+0xC0, 0xF4, 0xA4, 0x48, 0x70, 0x4C, 0x60, 0xC0, 0xBA, 0xDE, 0x4D, 0xC0, 0x3C, 0xE7, 0x68, 0xC0,
+0x34, 0xA5, 0x6C, 0x55, 0x64, 0x58, 0x64, 0x69, 0xC0, 0x14, 0xA5, 0x79, 0x78, 0x69, 0x55, 0x4C,
+0x64, 0x6C, 0x71, 0xE0, 0x16, 0xA9, 0xA9, 0x0D, 0x71, 0x2C, 0x70, 0x00, 0x71, 0x04, 0x6D, 0x45,
+0x04, 0x41, 0xC0, 0x8E, 0x73, 0x64, 0x49, 0x64, 0x54, 0xC0, 0xB7, 0xB5, 0x68, 0xC0, 0x6D, 0x6B,
+0x5D, 0x7C, 0xC0, 0x96, 0xAD, 0x69, 0xC0, 0x6E, 0x73, 0x55, 0xC0, 0xAE, 0x73, 0x41, 0x68, 0xAE,
+0x55, 0x69, 0x49, 0xC0, 0x55, 0xA5, 0x6D, 0x7D, 0x4D, 0x45, 0x0D, 0xC0, 0x9E, 0xEF, 0x71, 0x0E,
+0x6C, 0xC0, 0x34, 0xAD, 0x48, 0x71, 0x12, 0xC0, 0xFB, 0xFF, 0xA5, 0x03, 0x55, 0x71, 0x0B, 0x63,
+0x49, 0x0D, 0xAE, 0x63, 0x71, 0x28, 0x6A, 0xC1, 0xD5, 0xF7, 0xB1, 0xF7, 0x08, 0x91, 0x42, 0x03,
+0xAB, 0xC0, 0xDB, 0xFF, 0x71, 0x2A, 0x70, 0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x02, 0x4D,
+0x7D, 0xC1, 0xD3, 0x94, 0x71, 0x8C, 0x7C, 0x95, 0x79, 0x7C, 0x6D, 0xC0, 0x10, 0x84, 0x68, 0xC0,
+0x79, 0xCE, 0x68, 0x5D, 0x64, 0xC0, 0x31, 0x84, 0xA9, 0x68, 0x40, 0xC0, 0xD3, 0x94, 0x59, 0x69,
+0x7C, 0x6D, 0x54, 0x5D, 0x40, 0x4D, 0x96, 0x0D, 0xC0, 0x9E, 0xEF, 0x71, 0x05, 0x6C, 0x71, 0x07,
+0x91, 0x71, 0x12, 0x63, 0xC0, 0x8F, 0xEF, 0x05, 0x63, 0x71, 0x09, 0xC1, 0xDA, 0xFF, 0xB0, 0xF7,
+0x6C, 0x08, 0xBE, 0x03, 0xAE, 0x7B, 0xC0, 0xD9, 0xFF, 0x71, 0x27, 0x63, 0xC0, 0x8E, 0xEF, 0x74,
+0x06, 0x7B, 0x6C, 0xC2, 0x29, 0x84, 0x6F, 0xEF, 0xF0, 0xFF, 0x9A, 0x00, 0xA6, 0x95, 0x7B, 0xC1,
+0xFD, 0xFF, 0xFF, 0xFF, 0x29, 0x70, 0x00, 0x71, 0x04, 0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0x02, 0x4D,
+0xC3, 0xD7, 0xB5, 0xB2, 0x94, 0x31, 0x8C, 0xB3, 0x94, 0x6D, 0xAF, 0x6D, 0x00, 0xC0, 0x30, 0x84,
+0x68, 0x69, 0x45, 0xC1, 0xAE, 0x73, 0x14, 0xA5, 0x6D, 0xC2, 0x4D, 0x6B, 0x34, 0xA5, 0x2C, 0x63,
+0x64, 0x50, 0x78, 0x41, 0x68, 0x91, 0x59, 0x7D, 0xC0, 0x9A, 0xD6, 0x9A, 0x0D, 0xC0, 0x9E, 0xEF,
+0x71, 0x04, 0xC1, 0x38, 0xC6, 0x79, 0xCE, 0x71, 0x09, 0x50, 0x64, 0xC0, 0xDF, 0xFF, 0x71, 0x00,
+0x6C, 0x71, 0x00, 0x79, 0xC0, 0x5D, 0xEF, 0x71, 0x06, 0x42, 0xC0, 0x8E, 0xEF, 0x7B, 0x05, 0x65,
+0x42, 0x71, 0x07, 0x6A, 0xC0, 0xB1, 0xF7, 0xA8, 0x7B, 0x08, 0x96, 0x67, 0x01, 0xC1, 0x0F, 0xDF,
+0x2B, 0xA5, 0x74, 0x42, 0x6A, 0x71, 0x26, 0x42, 0x74, 0x7B, 0x07, 0x9A, 0xC2, 0x07, 0x63, 0x09,
+0x84, 0x8A, 0x94, 0x9A, 0xA6, 0xC0, 0xCB, 0x9C, 0x73, 0x74, 0xC0, 0xDA, 0xFF, 0x71, 0x29, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x03, 0x48, 0x7C, 0x91, 0xC1, 0xD7, 0xBD,
+0x18, 0xBE, 0x69, 0xC0, 0x4D, 0x6B, 0x50, 0xC0, 0xD7, 0xB5, 0x50, 0xC1, 0x96, 0xB5, 0xB2, 0x94,
+0x41, 0x51, 0x00, 0x50, 0xC0, 0x59, 0xC6, 0x50, 0xC0, 0x38, 0xC6, 0x4C, 0x65, 0x92, 0x64, 0x95,
+0x68, 0x69, 0xC0, 0xBA, 0xD6, 0x45, 0x0D, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x02, 0x6C, 0x64, 0x68,
+0xC0, 0x59, 0xCE, 0x5C, 0x70, 0x50, 0x7D, 0xC1, 0xFC, 0xE6, 0x5D, 0xEF, 0x71, 0x02, 0x91, 0xC0,
+0x34, 0xA5, 0x64, 0x51, 0x64, 0x6B, 0x78, 0x4D, 0x51, 0x54, 0x4C, 0xC0, 0x1C, 0xE7, 0x5C, 0x71,
+0x04, 0xC1, 0xD6, 0xF7, 0x8F, 0xEF, 0x7B, 0x05, 0x6C, 0x6A, 0x71, 0x07, 0xC1, 0xFC, 0xFF, 0xAF,
+0xF7, 0x7B, 0x08, 0xC2, 0x4F, 0xE7, 0x88, 0x73, 0x4A, 0x8C, 0xAE, 0x00, 0xC2, 0xE9, 0x7B, 0xC7,
+0x5A, 0xD0, 0xF7, 0x74, 0x5C, 0x71, 0x25, 0xA9, 0x42, 0x74, 0x7B, 0x07, 0x6C, 0xC2, 0x68, 0x6B,
+0x6D, 0xCE, 0xEE, 0xDE, 0xA6, 0x9A, 0x41, 0x73, 0x6C, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x04, 0xC0, 0xDB, 0xD6, 0x00, 0x4D, 0x59, 0x69,
+0xC1, 0xB2, 0x94, 0x59, 0xCE, 0x59, 0x03, 0x4D, 0x00, 0x59, 0x4D, 0x59, 0x4D, 0x02, 0xAE, 0x59,
+0x00, 0x4D, 0x45, 0x0E, 0xC0, 0x9E, 0xEF, 0x71, 0x02, 0xC2, 0xDB, 0xDE, 0x38, 0xC6, 0xB6, 0xBD,
+0x78, 0x65, 0x7D, 0x00, 0x40, 0xC0, 0x1C, 0xE7, 0x5D, 0x71, 0x02, 0xA6, 0x54, 0x00, 0x7C, 0x91,
+0x4C, 0x50, 0x68, 0x65, 0x00, 0x69, 0x50, 0xC0, 0xFB, 0xDE, 0x71, 0x04, 0xC1, 0xD6, 0xF7, 0xAF,
+0xEF, 0xA6, 0xC0, 0x2F, 0xE7, 0x96, 0xBA, 0x5F, 0xC2, 0xEB, 0x9C, 0x8E, 0xCE, 0xCF, 0xF7, 0x6A,
+0xC0, 0xFF, 0xFF, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0x01, 0xAE, 0x02, 0x7B, 0x02, 0x73, 0xC0, 0x8A,
+0x8C, 0x46, 0x67, 0x00, 0x52, 0x56, 0x7B, 0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0xA8,
+0x7B, 0x07, 0x73, 0xC0, 0x8C, 0xB5, 0x46, 0x5A, 0x00, 0x67, 0xC0, 0xF0, 0xFF, 0x7B, 0x6C, 0xC0,
+0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x04, 0x4D,
+0x00, 0x91, 0x96, 0x4D, 0x59, 0xA1, 0x91, 0x48, 0x79, 0x00, 0x4D, 0x48, 0x45, 0x4D, 0x65, 0x4D,
+0x00, 0x45, 0x15, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x02, 0xC0, 0x3C, 0xE7, 0x64, 0xC0, 0xF3, 0x9C,
+0x78, 0x74, 0x60, 0x65, 0xA1, 0x48, 0xC0, 0x7D, 0xEF, 0x71, 0x02, 0x5D, 0x7D, 0x65, 0xC0, 0x30,
+0x8C, 0x60, 0xA6, 0xC0, 0xB2, 0x94, 0x7C, 0x78, 0xC0, 0xF3, 0xA4, 0x74, 0xC1, 0x51, 0x8C, 0xDF,
+0xFF, 0x71, 0x04, 0xC2, 0xD6, 0xF7, 0xEF, 0xFF, 0xAA, 0x94, 0x66, 0xC0, 0x8A, 0x94, 0x96, 0x75,
+0xC1, 0x46, 0x4A, 0x0D, 0xBE, 0x41, 0x6A, 0x71, 0x07, 0x5C, 0x7B, 0x00, 0xC0, 0x4F, 0xE7, 0x46,
+0x01, 0x7E, 0x63, 0x67, 0x7B, 0x00, 0x67, 0xC1, 0x8E, 0xCE, 0xF0, 0xFF, 0x7B, 0x48, 0x67, 0xC0,
+0xCC, 0xBD, 0x7B, 0x00, 0x5C, 0xC0, 0xFF, 0xFF, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0xA8, 0x7B, 0x08,
+0xC0, 0x6C, 0xAD, 0x63, 0x68, 0xBA, 0x4F, 0xC0, 0xEB, 0x9C, 0x7B, 0x74, 0xC0, 0xD9, 0xFF, 0x71,
+0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x04, 0x65, 0xAF, 0x60, 0x7D,
+0x79, 0x60, 0x79, 0xC0, 0x4D, 0x6B, 0x65, 0xC0, 0x8E, 0x73, 0x51, 0x65, 0x79, 0x4D, 0x51, 0xC1,
+0x71, 0x8C, 0x59, 0xCE, 0x65, 0x4D, 0x45, 0x14, 0x55, 0xC0, 0xFF, 0xFF, 0x03, 0x79, 0xBF, 0xC1,
+0x5D, 0xEF, 0x9E, 0xF7, 0x95, 0x01, 0x91, 0x58, 0x71, 0x03, 0x44, 0x5D, 0x61, 0x60, 0x75, 0x60,
+0x75, 0xC0, 0xDB, 0xDE, 0x74, 0x61, 0x69, 0x71, 0x05, 0xC2, 0xD6, 0xF7, 0xCF, 0xF7, 0xED, 0xBD,
+0x50, 0x40, 0x7B, 0x40, 0x50, 0x7E, 0x79, 0x6A, 0x71, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0x00, 0xC0,
+0x48, 0x6B, 0x4F, 0xC0, 0x8A, 0x94, 0x00, 0x63, 0xC0, 0x86, 0x52, 0x67, 0x7B, 0x00, 0x73, 0x68,
+0xC4, 0xEB, 0x9C, 0xD0, 0xFF, 0xAE, 0xD6, 0xC9, 0x7B, 0x8C, 0xAD, 0x40, 0x7B, 0x5C, 0x71, 0x25,
+0xA9, 0xC0, 0xB1, 0xF7, 0xA8, 0x40, 0x04, 0x7B, 0x02, 0xC0, 0xF0, 0xFF, 0x02, 0x40, 0x66, 0x79,
+0x74, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6D, 0x45, 0x02, 0x4D,
+0x65, 0xC1, 0xAE, 0x73, 0x30, 0x84, 0x64, 0x00, 0x54, 0xC7, 0xEF, 0x7B, 0x76, 0xAD, 0x4D, 0x6B,
+0xF3, 0x9C, 0x2D, 0x6B, 0x34, 0xA5, 0x10, 0x84, 0x92, 0x94, 0x69, 0x71, 0xC0, 0x8E, 0x73, 0x54,
+0x40, 0x65, 0x4D, 0x96, 0x13, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x1A, 0xC1, 0xDB, 0xDE, 0x3C, 0xEF,
+0x71, 0x05, 0xC0, 0xD6, 0xF7, 0x74, 0xC0, 0x4D, 0xCE, 0x5A, 0x48, 0x96, 0x00, 0x72, 0xC0, 0xCE,
+0xDE, 0x74, 0x6A, 0x71, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0x40, 0xC1, 0x6C, 0xAD, 0x0F, 0xE7, 0x40,
+0x01, 0x4B, 0x67, 0x7B, 0x01, 0x52, 0x63, 0xC0, 0xE7, 0x5A, 0xBE, 0xC0, 0xCC, 0xB5, 0x67, 0x7B,
+0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0x74, 0x7E, 0xC0, 0x2D, 0xC6, 0xAE, 0xBE, 0xAF,
+0x65, 0x67, 0x7B, 0x01, 0xC0, 0xAC, 0xB5, 0x49, 0x56, 0xAE, 0xC0, 0xAA, 0x94, 0x4F, 0x67, 0x74,
+0xC1, 0xD9, 0xFF, 0xFF, 0xFF, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6D, 0xC0, 0x9A, 0xCE,
+0x02, 0xBE, 0x51, 0xC1, 0xB2, 0x94, 0x96, 0xAD, 0x54, 0xC0, 0xF3, 0x9C, 0x6D, 0x69, 0xC0, 0xD3,
+0x9C, 0x59, 0xC1, 0x8E, 0x73, 0x30, 0x84, 0xAB, 0xC0, 0xD7, 0xB5, 0x6D, 0x54, 0xC2, 0x18, 0xC6,
+0x6D, 0x6B, 0xAE, 0x73, 0x54, 0x51, 0x4D, 0x96, 0x13, 0xC0, 0x9E, 0xEF, 0x71, 0x02, 0xA6, 0xC0,
+0x7D, 0xEF, 0x71, 0x01, 0xC0, 0x5D, 0xEF, 0x71, 0x00, 0x49, 0x71, 0x03, 0x91, 0x00, 0xA6, 0x6C,
+0x58, 0x71, 0x44, 0x71, 0x58, 0x5D, 0x71, 0x07, 0xC4, 0xD6, 0xF7, 0xCF, 0xF7, 0x2D, 0xC6, 0xC9,
+0x7B, 0x8E, 0xCE, 0x67, 0x63, 0xC0, 0xAA, 0x94, 0x67, 0x74, 0x6A, 0xC0, 0xFF, 0xFF, 0x07, 0x5C,
+0x7B, 0x95, 0x4B, 0x73, 0x40, 0x48, 0x5A, 0x56, 0x73, 0x7B, 0x00, 0x67, 0xC0, 0xEB, 0x9C, 0x75,
+0x42, 0x63, 0xC0, 0x8A, 0x8C, 0x75, 0x40, 0x7B, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0x7B,
+0x50, 0x56, 0x00, 0xC2, 0x4A, 0x84, 0x86, 0x52, 0xC7, 0x5A, 0x5F, 0x7B, 0x01, 0xC0, 0xAE, 0xD6,
+0x6F, 0x75, 0xA6, 0x77, 0x7B, 0xAE, 0x91, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x02, 0x4D, 0xC3, 0x18, 0xC6, 0x8E, 0x73, 0x30, 0x84, 0x14,
+0xA5, 0x9A, 0x41, 0x69, 0x7C, 0x95, 0xC1, 0x18, 0xBE, 0xD3, 0x94, 0x41, 0xC0, 0x10, 0x84, 0x59,
+0xC0, 0x34, 0xA5, 0x40, 0x53, 0x4C, 0x41, 0xC0, 0x79, 0xCE, 0xBF, 0x9A, 0x13, 0xC0, 0x9E, 0xEF,
+0x71, 0x02, 0x44, 0xC0, 0x34, 0xA5, 0x44, 0xAE, 0xC0, 0xFB, 0xDE, 0x00, 0xC0, 0x3C, 0xE7, 0xA1,
+0xC4, 0xD7, 0xBD, 0x38, 0xC6, 0xDB, 0xDE, 0x75, 0xB5, 0xDF, 0xFF, 0x00, 0x75, 0x65, 0x41, 0xC0,
+0x38, 0xCE, 0x91, 0xC0, 0x1C, 0xE7, 0x65, 0x55, 0x48, 0x49, 0x70, 0x75, 0xC0, 0xBE, 0xF7, 0x57,
+0x5D, 0x71, 0x02, 0xC0, 0xD6, 0xF7, 0x74, 0x5A, 0x72, 0xC3, 0xC7, 0x5A, 0x46, 0x4A, 0x8A, 0x94,
+0xAE, 0xD6, 0x73, 0x74, 0x6A, 0x71, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0xAE, 0xC1, 0x6C, 0xAD, 0x29,
+0x84, 0x5A, 0xC2, 0x6D, 0xCE, 0xC9, 0x7B, 0xCC, 0xBD, 0x40, 0x7B, 0x01, 0xC0, 0xF0, 0xFF, 0x00,
+0xAB, 0x00, 0x73, 0xC0, 0x09, 0x84, 0x7B, 0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0x74,
+0x73, 0xC1, 0x0D, 0xC6, 0xCB, 0x9C, 0x00, 0xC0, 0x2D, 0xC6, 0x73, 0x7B, 0x01, 0x40, 0x4B, 0x47,
+0xC0, 0xEB, 0x9C, 0x00, 0x4F, 0x56, 0x7B, 0x74, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC0, 0x1C, 0xDF, 0x45, 0x02, 0xBE, 0x60, 0xC0, 0x51, 0x8C, 0x60, 0x45, 0xA5,
+0x03, 0xC0, 0xDB, 0xD6, 0x79, 0x45, 0x4C, 0xC1, 0x38, 0xC6, 0x9A, 0xD6, 0x7D, 0xC0, 0x59, 0xC6,
+0x65, 0x7D, 0x45, 0x15, 0xC1, 0x9E, 0xEF, 0xFF, 0xFF, 0x02, 0xC2, 0x5D, 0xEF, 0x71, 0x94, 0x75,
+0xB5, 0x70, 0xC0, 0x59, 0xCE, 0x4C, 0xC0, 0x34, 0xAD, 0x41, 0x00, 0x7C, 0xC0, 0x34, 0xA5, 0x00,
+0x44, 0xC0, 0xDB, 0xDE, 0x71, 0x6C, 0x7C, 0xC1, 0x55, 0xAD, 0x96, 0xB5, 0x7C, 0x78, 0xC0, 0x92,
+0x94, 0x4C, 0x48, 0xC0, 0xB3, 0x9C, 0x64, 0x78, 0xC0, 0xB2, 0x94, 0x79, 0x71, 0x02, 0xC3, 0xD6,
+0xF7, 0xCF, 0xF7, 0x2D, 0xC6, 0xCB, 0x9C, 0x00, 0x91, 0x56, 0x47, 0xC1, 0xAE, 0xD6, 0xCF, 0xF7,
+0x6A, 0x71, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0x00, 0xC4, 0xAE, 0xD6, 0xAA, 0x94, 0x26, 0x4A, 0x86,
+0x52, 0x6C, 0xAD, 0x7E, 0x7B, 0x01, 0x95, 0xC0, 0x4D, 0xC6, 0x92, 0x53, 0x58, 0x72, 0xC0, 0x28,
+0x63, 0x7B, 0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC2, 0xB1, 0xF7, 0xF0, 0xF7, 0x6A, 0x8C, 0x5F, 0x47,
+0x49, 0xAE, 0x49, 0xC0, 0x4F, 0xE7, 0x7B, 0x00, 0x5F, 0xC0, 0x48, 0x6B, 0x67, 0xC0, 0xF1, 0xFF,
+0x00, 0xA9, 0x6E, 0x7E, 0xC1, 0xAF, 0xF7, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0xC1, 0x1C, 0xDF, 0x9A, 0xCE, 0x02, 0xBA, 0x95, 0x65, 0x4D, 0x48, 0x03, 0x4D, 0x45, 0x48,
+0x00, 0x4D, 0x00, 0x45, 0x4D, 0x02, 0x45, 0x15, 0xC0, 0x9E, 0xEF, 0x71, 0x02, 0xC0, 0x3C, 0xE7,
+0x60, 0x65, 0x41, 0xC1, 0xDF, 0xFF, 0x14, 0xA5, 0x51, 0xC1, 0x39, 0xCE, 0x34, 0xA5, 0x4D, 0x55,
+0x48, 0x71, 0x01, 0xC1, 0x92, 0x94, 0xB7, 0xBD, 0x54, 0x51, 0xC0, 0x59, 0xCE, 0x4C, 0x00, 0x79,
+0x65, 0x00, 0xA1, 0x55, 0x48, 0x79, 0x71, 0x02, 0xC2, 0xD6, 0xF7, 0x8F, 0xEF, 0xF0, 0xFF, 0x4F,
+0x02, 0x44, 0x53, 0xC0, 0xEF, 0xF7, 0x6A, 0x71, 0x07, 0x5C, 0x7B, 0x00, 0x72, 0x56, 0x49, 0xBE,
+0x00, 0xC0, 0x4A, 0x84, 0x73, 0x7B, 0x00, 0x73, 0x5B, 0x44, 0x51, 0x00, 0xC0, 0xAA, 0x94, 0x72,
+0x40, 0x7B, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0xA8, 0x58, 0x5B, 0x00, 0x56, 0x51, 0x56,
+0x67, 0x7B, 0x01, 0xC0, 0x29, 0x84, 0x49, 0xC0, 0x8E, 0xD6, 0xAE, 0xC1, 0x4C, 0xAD, 0xC9, 0x7B,
+0x67, 0xC1, 0xAF, 0xF7, 0xD9, 0xFF, 0x71, 0x29, 0x70, 0x00, 0x71, 0x04, 0x6D, 0x45, 0x03, 0xBA,
+0x4D, 0x45, 0x26, 0xC0, 0x9E, 0xEF, 0x71, 0x02, 0xC1, 0x7D, 0xEF, 0x71, 0x8C, 0x64, 0xC4, 0x18,
+0xC6, 0x9E, 0xF7, 0x38, 0xC6, 0x75, 0xB5, 0x51, 0x8C, 0x7D, 0xC1, 0xDB, 0xDE, 0xF7, 0xC5, 0x64,
+0xC0, 0x1C, 0xE7, 0x4D, 0x71, 0x64, 0xC0, 0x79, 0xCE, 0x50, 0x4D, 0x48, 0x79, 0x64, 0xBF, 0x4D,
+0x79, 0x48, 0x7D, 0xC0, 0x30, 0x8C, 0x79, 0x71, 0x02, 0xC0, 0xD6, 0xF7, 0x74, 0xC1, 0x8E, 0xCE,
+0x8C, 0xAD, 0x72, 0x00, 0xC1, 0xCC, 0xB5, 0x28, 0x63, 0x53, 0x7E, 0x6A, 0xC0, 0xFF, 0xFF, 0x07,
+0xC0, 0xFC, 0xFF, 0x7B, 0x00, 0x4F, 0x02, 0xA9, 0xC0, 0xE9, 0x7B, 0x5F, 0x7B, 0x00, 0x67, 0xC1,
+0xCA, 0x9C, 0x8F, 0xEF, 0x48, 0x4F, 0x46, 0x51, 0x7B, 0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1,
+0xF7, 0x7B, 0xC0, 0x2D, 0xC6, 0x5B, 0xBF, 0x00, 0xA6, 0x6A, 0x67, 0x7B, 0x01, 0x67, 0x56, 0x63,
+0x00, 0xC1, 0xEB, 0x9C, 0x2F, 0xE7, 0x40, 0x6C, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC0, 0x3C, 0xE7, 0x79, 0x45, 0x2C, 0xC0, 0xBE, 0xF7, 0x71, 0x03, 0xA6, 0x00,
+0x71, 0x01, 0xC0, 0x38, 0xC6, 0x41, 0x6C, 0x71, 0x00, 0x6C, 0x71, 0x08, 0x6C, 0x71, 0x01, 0xC2,
+0xFB, 0xDE, 0xB2, 0x94, 0x5D, 0xEF, 0x71, 0x02, 0xC2, 0xD6, 0xF7, 0xCF, 0xF7, 0x6E, 0xCE, 0x49,
+0x6F, 0x00, 0xA6, 0x56, 0x5F, 0x74, 0xC0, 0xD6, 0xF7, 0x71, 0x07, 0x5C, 0x7B, 0x00, 0x7C, 0x5B,
+0xBB, 0xAE, 0x56, 0xC0, 0xE7, 0x5A, 0x67, 0x7B, 0x40, 0xC1, 0x8E, 0xCE, 0xA8, 0x73, 0x4F, 0x48,
+0x00, 0xC0, 0x90, 0xEF, 0x66, 0xC0, 0x4F, 0xEF, 0x7B, 0x5C, 0xC0, 0xFF, 0xFF, 0x25, 0xA9, 0xC0,
+0xB1, 0xF7, 0x94, 0x48, 0x04, 0x7B, 0x02, 0xC0, 0xF0, 0xF7, 0x48, 0x02, 0x7B, 0x00, 0x6C, 0xC0,
+0xD9, 0xFF, 0x71, 0x29, 0x70, 0x00, 0x71, 0x04, 0x96, 0x4D, 0x91, 0xAF, 0x29, 0x79, 0xC0, 0x1C,
+0xE7, 0x71, 0x09, 0xC0, 0x7D, 0xEF, 0xBF, 0x71, 0x10, 0x5D, 0x58, 0x71, 0x03, 0xC1, 0xD6, 0xF7,
+0xCF, 0xF7, 0x56, 0x53, 0x4F, 0x48, 0x00, 0xC1, 0xEB, 0x9C, 0x8E, 0xCE, 0x79, 0x6A, 0xC0, 0xFF,
+0xFF, 0x07, 0x5C, 0x7B, 0x00, 0xC1, 0x4D, 0xC6, 0xAC, 0xB5, 0x7C, 0x00, 0x77, 0xC0, 0x4D, 0xCE,
+0x7B, 0x01, 0x73, 0xC1, 0x29, 0x84, 0x8A, 0x94, 0x4B, 0xA9, 0x54, 0x49, 0x40, 0x7B, 0x5C, 0x71,
+0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0x74, 0xC0, 0xAE, 0xD6, 0x67, 0x5F, 0x00, 0x7B, 0x03, 0x73, 0x79,
+0x73, 0x5A, 0x67, 0x7B, 0x01, 0x6C, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x05, 0xA6, 0xC0, 0x5D, 0xE7, 0x75, 0x29, 0xC0, 0x7D, 0xEF, 0x71, 0x04, 0xC0, 0x7D, 0xF7, 0x4D,
+0x71, 0xC2, 0x9A, 0xD6, 0x1C, 0xE7, 0x5D, 0xEF, 0x71, 0xA1, 0x48, 0x71, 0x03, 0x6C, 0xC0, 0xF7,
+0xBD, 0x44, 0x70, 0x71, 0x01, 0x70, 0x44, 0x70, 0x91, 0x64, 0x5C, 0x64, 0xC0, 0x38, 0xCE, 0x71,
+0x02, 0xC3, 0xD6, 0xF7, 0xCF, 0xF7, 0xA9, 0x7B, 0x6D, 0xCE, 0x4F, 0xA9, 0x4F, 0xC0, 0x6A, 0x8C,
+0x6F, 0xC0, 0xEF, 0xFF, 0x6A, 0x71, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0x00, 0x7F, 0x5A, 0x48, 0x00,
+0x5F, 0x7F, 0x7B, 0x02, 0x40, 0x4B, 0x56, 0xBE, 0x4B, 0xC0, 0xCE, 0xD6, 0x7B, 0x00, 0x5C, 0x71,
+0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0x40, 0xC0, 0xA9, 0x73, 0x5A, 0x72, 0x92, 0x4F, 0x40, 0x7B, 0x01,
+0x95, 0x6E, 0x7B, 0xC0, 0xEB, 0x9C, 0x4B, 0x4F, 0x40, 0x7B, 0x6C, 0xC0, 0xD9, 0xFF, 0x71, 0x29,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x39, 0x44, 0xC1, 0x51, 0x8C, 0x38, 0xC6, 0x51, 0x61, 0xC1, 0x59,
+0xCE, 0x34, 0xAD, 0x74, 0xC0, 0xD7, 0xBD, 0x4D, 0xC1, 0x1C, 0xE7, 0xBE, 0xF7, 0x71, 0x01, 0xC0,
+0xCF, 0x7B, 0x78, 0xC2, 0x38, 0xCE, 0xB6, 0xB5, 0x79, 0xCE, 0x71, 0x65, 0x4D, 0xC1, 0x18, 0xC6,
+0xD3, 0x9C, 0x79, 0x61, 0x50, 0x00, 0x5D, 0x71, 0x01, 0xC3, 0xD6, 0xF7, 0xCF, 0xF7, 0x2D, 0xC6,
+0xA9, 0x7B, 0x56, 0x72, 0xC1, 0xAA, 0x94, 0x09, 0x84, 0x5F, 0xC0, 0xAF, 0xF7, 0x6A, 0x71, 0x07,
+0x5C, 0x7B, 0xC0, 0x0F, 0xE7, 0x6E, 0x7B, 0x40, 0x01, 0x6E, 0x46, 0x7B, 0x00, 0x40, 0x77, 0x63,
+0x56, 0xC1, 0xCC, 0xB5, 0x29, 0x84, 0x5B, 0x40, 0x7B, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7,
+0x40, 0xC0, 0xC9, 0x7B, 0x63, 0x6E, 0x66, 0x49, 0xA6, 0x5F, 0x7B, 0x00, 0x73, 0x66, 0xC0, 0x8A,
+0x94, 0x59, 0x7A, 0x44, 0x4E, 0x73, 0x74, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x39, 0xC2, 0x5D, 0xEF, 0x75, 0xAD, 0xB6, 0xBD, 0x64, 0xC1, 0x9A, 0xD6, 0xD3, 0x9C, 0x78,
+0x00, 0xC0, 0xF0, 0x83, 0x48, 0x44, 0x5D, 0x71, 0x00, 0xA6, 0x50, 0x70, 0xC0, 0x34, 0xA5, 0x51,
+0x78, 0x71, 0xC1, 0x59, 0xCE, 0xDB, 0xDE, 0x60, 0xC0, 0x79, 0xCE, 0x6D, 0x4C, 0xC1, 0x30, 0x8C,
+0xF3, 0x9C, 0x5D, 0x71, 0x01, 0xC1, 0xD6, 0xF7, 0x8F, 0xEF, 0xBF, 0xC0, 0xAE, 0xD6, 0x5B, 0x49,
+0x6F, 0x52, 0x7B, 0x6C, 0x6A, 0x71, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0x6C, 0xC0, 0xC9, 0x7B, 0x77,
+0x5A, 0x5F, 0xC0, 0xEC, 0xBD, 0x7D, 0x67, 0x7B, 0x00, 0x5A, 0xC0, 0x48, 0x6B, 0x52, 0x63, 0x42,
+0x73, 0xC0, 0xF0, 0xFF, 0x7B, 0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0xA8, 0x5A, 0xC0,
+0x8E, 0xD6, 0x79, 0x7E, 0x92, 0x79, 0x73, 0x7B, 0x01, 0x52, 0x71, 0x7E, 0x79, 0x71, 0x79, 0x73,
+0xAD, 0xC1, 0xD9, 0xFF, 0xFF, 0xFF, 0x29, 0x70, 0x00, 0x71, 0x39, 0xC0, 0x3C, 0xE7, 0x55, 0xC0,
+0xB6, 0xB5, 0x64, 0xC0, 0x79, 0xCE, 0x41, 0xC2, 0x9A, 0xD6, 0x75, 0xB5, 0x30, 0x84, 0x65, 0xC0,
+0x7D, 0xEF, 0x5D, 0x71, 0x00, 0x5D, 0x4C, 0xC0, 0x92, 0x94, 0xA5, 0x51, 0x78, 0x71, 0x48, 0x7D,
+0x69, 0xC0, 0x5D, 0xEF, 0x79, 0xC0, 0x71, 0x8C, 0x4C, 0x50, 0x49, 0x71, 0x01, 0xC5, 0xD6, 0xF7,
+0xEF, 0xFF, 0xCA, 0x9C, 0x26, 0x4A, 0xA8, 0x73, 0x8A, 0x94, 0x4E, 0xC0, 0x6A, 0x8C, 0x52, 0xC0,
+0xAF, 0xF7, 0x6A, 0x71, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0xAE, 0xC0, 0x2F, 0xE7, 0x54, 0x00, 0x6E,
+0x66, 0xC0, 0xEF, 0xDE, 0x40, 0x7B, 0x00, 0x5A, 0x61, 0xC0, 0xAA, 0x94, 0x73, 0x6E, 0x70, 0x5B,
+0x40, 0x7B, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0x40, 0x77, 0x70, 0xC0, 0xCB, 0x9C, 0xAE,
+0x96, 0x75, 0x5F, 0x7B, 0x01, 0xC0, 0x4C, 0xAD, 0x75, 0x44, 0x49, 0x75, 0x49, 0xC0, 0x90, 0xEF,
+0x74, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x39, 0xA6, 0x78, 0xC1, 0x38,
+0xC6, 0x3C, 0xE7, 0xBF, 0x48, 0x44, 0xC1, 0xDB, 0xDE, 0x1C, 0xE7, 0x5C, 0x00, 0xC0, 0x9E, 0xF7,
+0x71, 0x00, 0x6C, 0x70, 0x95, 0x91, 0x4C, 0x48, 0x71, 0x6C, 0x69, 0x79, 0x5C, 0x55, 0x61, 0xC0,
+0x35, 0xAD, 0x65, 0x71, 0x02, 0xC0, 0xD6, 0xF7, 0x74, 0x67, 0xC1, 0x8E, 0xCE, 0x6C, 0xAD, 0x68,
+0xAE, 0x67, 0x7B, 0x95, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF, 0x07, 0xC0, 0xFC, 0xFF, 0x7B, 0x40, 0xC0,
+0x0B, 0xA5, 0x63, 0x54, 0xAE, 0x68, 0xBE, 0x7B, 0x02, 0xC0, 0x4F, 0xE7, 0x52, 0x5A, 0x00, 0xC0,
+0x8E, 0xD6, 0x63, 0x7B, 0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0xA8, 0x67, 0xC0, 0x6E,
+0xCE, 0x5E, 0x51, 0x4B, 0x5A, 0x73, 0x7B, 0x01, 0x5F, 0xC0, 0x4D, 0xC6, 0x56, 0x00, 0x53, 0x5A,
+0x7B, 0x95, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x1A, 0xC0, 0xD6,
+0xF7, 0x74, 0xC0, 0xEF, 0xDE, 0x6F, 0xC0, 0xCB, 0x9C, 0x6D, 0x49, 0x5A, 0x7B, 0x6C, 0x6A, 0x71,
+0x07, 0x5C, 0x7B, 0x67, 0xC0, 0x48, 0x6B, 0x5F, 0x47, 0x77, 0x7B, 0x61, 0x5F, 0x7B, 0x01, 0x6C,
+0x67, 0x00, 0x73, 0x46, 0x66, 0x7B, 0x00, 0x5C, 0x71, 0x25, 0xA9, 0xC0, 0xB1, 0xF7, 0x40, 0xC1,
+0x4D, 0xCE, 0xA8, 0x73, 0x49, 0x56, 0x4F, 0x49, 0x40, 0x7B, 0x00, 0x40, 0x4B, 0x7A, 0x51, 0x56,
+0xC1, 0xC9, 0x7B, 0x4C, 0xAD, 0x40, 0x74, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0x70, 0x00, 0x71, 0x05,
+0xC1, 0x9C, 0xFF, 0x18, 0xFF, 0xA5, 0x29, 0xC0, 0x39, 0xFF, 0x71, 0x25, 0xC1, 0xD6, 0xF7, 0xEF,
+0xFF, 0x49, 0xC0, 0x87, 0x52, 0x47, 0x68, 0xC0, 0xAA, 0x94, 0x63, 0x52, 0x74, 0x6A, 0x71, 0x07,
+0x5C, 0x74, 0x6C, 0x4F, 0xC0, 0x4A, 0x84, 0x6E, 0x47, 0xC2, 0x2A, 0x84, 0xC9, 0x7B, 0x90, 0xEF,
+0x7B, 0x00, 0x67, 0x75, 0x5B, 0x63, 0x00, 0x4F, 0x54, 0x40, 0x74, 0x5C, 0x71, 0x25, 0xA9, 0xC4,
+0xB1, 0xF7, 0xF0, 0xFF, 0xE9, 0x83, 0x6E, 0xCE, 0xF1, 0xFF, 0x01, 0xC0, 0xC9, 0x7B, 0x7E, 0x40,
+0x7B, 0x00, 0x7A, 0x52, 0x4F, 0x00, 0x7B, 0x6E, 0x5F, 0x74, 0xC0, 0xD9, 0xFF, 0x71, 0x29, 0x70,
+0x00, 0x71, 0x04, 0xA0, 0xC0, 0xB4, 0xFE, 0xA5, 0x2B, 0x51, 0x71, 0x24, 0x42, 0xC0, 0x8F, 0xEF,
+0x7B, 0x00, 0x73, 0x6C, 0x01, 0x73, 0x6C, 0x42, 0x71, 0x07, 0x6A, 0xC0, 0xB1, 0xF7, 0x74, 0x7B,
+0x6C, 0x7B, 0x73, 0x6C, 0x7B, 0x03, 0x6C, 0x02, 0x73, 0x7B, 0x74, 0x42, 0x6A, 0x71, 0x25, 0x6A,
+0x42, 0x40, 0x7A, 0x75, 0xC0, 0x6C, 0xAD, 0x56, 0xAE, 0xC1, 0x07, 0x63, 0xAE, 0xD6, 0x40, 0x7B,
+0x73, 0xC0, 0x68, 0x6B, 0x4E, 0x65, 0x56, 0xA6, 0x4D, 0x5A, 0x74, 0xC0, 0xD9, 0xFF, 0x71, 0x29,
+0x70, 0x00, 0x71, 0x04, 0xC1, 0x38, 0xFF, 0x93, 0xFE, 0x72, 0x2B, 0xA6, 0x59, 0x71, 0x24, 0xC0,
+0xD5, 0xF7, 0x74, 0x04, 0x9A, 0x63, 0xC0, 0xFF, 0xFF, 0x09, 0xC0, 0xDA, 0xFF, 0x7B, 0x99, 0x74,
+0x03, 0x71, 0x02, 0x74, 0x04, 0x7B, 0x42, 0xC0, 0xFF, 0xFF, 0x00, 0x92, 0xA6, 0x21, 0x64, 0x71,
+0xA9, 0xC0, 0xB1, 0xF7, 0x74, 0x7E, 0xC0, 0xEB, 0x9C, 0x44, 0xC0, 0x0D, 0xBE, 0x00, 0xBE, 0x6C,
+0x7B, 0x01, 0xC0, 0x8E, 0xD6, 0x75, 0x49, 0x53, 0x4B, 0xC0, 0x4D, 0xCE, 0x73, 0xAD, 0xC1, 0xD9,
+0xFF, 0xFF, 0xFF, 0x29, 0x70, 0x00, 0x71, 0x04, 0x5D, 0x66, 0x72, 0x0C, 0xAE, 0x72, 0x09, 0x77,
+0x72, 0x00, 0x77, 0x72, 0x0D, 0x6D, 0xC0, 0x9C, 0xFF, 0x71, 0x25, 0xC0, 0x5A, 0xFF, 0x94, 0x03,
+0x69, 0xC0, 0x3D, 0xFF, 0xAF, 0xA9, 0x05, 0x51, 0xC0, 0xDF, 0xFF, 0x71, 0x00, 0xA8, 0xC0, 0xDA,
+0xFF, 0x0E, 0x63, 0x71, 0x00, 0xC1, 0x9D, 0xDE, 0xDB, 0xC5, 0x23, 0xC2, 0x5C, 0xD6, 0xBE, 0xF7,
+0xB1, 0xF7, 0x48, 0x5B, 0xC2, 0x4A, 0x8C, 0x8A, 0x94, 0x0B, 0xA5, 0x4F, 0x48, 0x7B, 0x01, 0x40,
+0x44, 0x70, 0x63, 0x6F, 0x4F, 0x48, 0x7B, 0x95, 0xC0, 0xD9, 0xFF, 0x71, 0xC0, 0x7E, 0xFF, 0xA6,
+0x02, 0x4A, 0x56, 0x71, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x18, 0xFF, 0x66, 0x72,
+0x01, 0xC0, 0x53, 0xF6, 0x72, 0x07, 0x6D, 0xC0, 0xD2, 0xDD, 0x6D, 0x72, 0x07, 0x91, 0x75, 0x5E,
+0x72, 0xC1, 0xB1, 0xD5, 0x94, 0xF6, 0x72, 0x0C, 0x6D, 0x4D, 0x71, 0x24, 0xC1, 0xDC, 0xFE, 0x7C,
+0xFE, 0x05, 0xA9, 0x08, 0xC1, 0xBC, 0xFE, 0xBF, 0xFF, 0x71, 0x12, 0xC1, 0xDD, 0xE6, 0x9B, 0xBD,
+0xBE, 0x23, 0x5E, 0xC1, 0x7B, 0xD6, 0xB1, 0xF7, 0x40, 0x6E, 0xC0, 0xAC, 0xB5, 0x58, 0xC1, 0xE7,
+0x5A, 0x4D, 0xC6, 0xBE, 0x6C, 0x7B, 0x00, 0x73, 0x61, 0x5D, 0x77, 0xC1, 0x07, 0x63, 0x6E, 0xCE,
+0x00, 0x73, 0xBD, 0xC1, 0xB9, 0xFF, 0xDD, 0xFE, 0x59, 0x05, 0x6F, 0x71, 0x20, 0x70, 0x00, 0x71,
+0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0x72, 0xAE, 0xC2, 0xF2, 0xE5, 0x48, 0x52, 0x12, 0xE6, 0x77,
+0xAB, 0x77, 0x00, 0x72, 0x77, 0x72, 0xC3, 0xF5, 0xFE, 0x53, 0xF6, 0xAB, 0x8B, 0x74, 0xF6, 0x43,
+0x77, 0x00, 0x72, 0x77, 0x00, 0x7E, 0x72, 0x43, 0xC1, 0x0C, 0x9C, 0xE9, 0x6A, 0xBE, 0xC1, 0xB1,
+0xD5, 0x0F, 0xC5, 0x65, 0x43, 0x77, 0x00, 0x72, 0x77, 0x00, 0x72, 0x06, 0xA6, 0xC0, 0x9C, 0xFF,
+0x71, 0x09, 0x67, 0x99, 0x71, 0x16, 0xC1, 0x5E, 0xFF, 0x7B, 0xFE, 0xAE, 0x03, 0x6A, 0xA6, 0x5E,
+0x07, 0x65, 0x59, 0xC0, 0x1D, 0xFF, 0x71, 0x12, 0x4C, 0xC0, 0xBB, 0xBD, 0xBA, 0x0A, 0x6B, 0x02,
+0x66, 0x14, 0xC3, 0xFA, 0xC5, 0x91, 0xEF, 0xD0, 0xF7, 0x2B, 0xA5, 0x68, 0xC0, 0x0B, 0xA5, 0x96,
+0x00, 0x4E, 0xC0, 0x6F, 0xEF, 0x7B, 0x01, 0x49, 0xC0, 0x8A, 0x94, 0x51, 0x49, 0x00, 0x56, 0x73,
+0x74, 0xC0, 0x37, 0xF7, 0x60, 0x5E, 0x03, 0x65, 0x00, 0x59, 0xC0, 0x5E, 0xFF, 0x71, 0x1F, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0x72, 0x43, 0xC1, 0xEF, 0xBC, 0xC9,
+0x62, 0x71, 0x77, 0xC1, 0x8E, 0xAC, 0x8B, 0x83, 0x55, 0x43, 0xC4, 0x30, 0xC5, 0x6B, 0x83, 0xAE,
+0xB4, 0x73, 0xF6, 0xAC, 0x8B, 0x72, 0xC2, 0xCF, 0xB4, 0x2A, 0x73, 0x70, 0xCD, 0x72, 0xC0, 0xEC,
+0x93, 0x96, 0x69, 0x72, 0x43, 0x65, 0x7D, 0xC0, 0x0F, 0xBD, 0x65, 0x52, 0xC1, 0x53, 0xEE, 0x6E,
+0xAC, 0x49, 0x69, 0xC1, 0x53, 0xF6, 0xCC, 0x93, 0x5D, 0x56, 0x72, 0x05, 0xA6, 0x4D, 0xC0, 0xFF,
+0xFF, 0x06, 0xC1, 0x9E, 0xF7, 0xD7, 0xBD, 0x7C, 0x70, 0xAB, 0x7C, 0xC1, 0x75, 0xAD, 0x3C, 0xE7,
+0x71, 0x13, 0xC1, 0x1D, 0xFF, 0x7B, 0xFE, 0x6A, 0xAF, 0x6A, 0x00, 0x76, 0xC2, 0xF9, 0xE5, 0x3A,
+0xEE, 0x9C, 0xFE, 0xA9, 0x00, 0x65, 0x05, 0x59, 0x6F, 0x71, 0x12, 0xC1, 0x3C, 0xD6, 0xBB, 0xC5,
+0x00, 0x6B, 0x02, 0x66, 0x03, 0x6B, 0xAF, 0xC0, 0x7A, 0xBD, 0x95, 0xAE, 0x6B, 0xAB, 0x66, 0x01,
+0x6B, 0x05, 0x66, 0x07, 0x6B, 0x66, 0xC4, 0xFA, 0xC5, 0x71, 0xEF, 0xD0, 0xF7, 0x2D, 0xC6, 0x0B,
+0xA5, 0x5B, 0x58, 0x46, 0xC0, 0x8F, 0xEF, 0x7B, 0x02, 0x4B, 0x51, 0xC0, 0x4B, 0xAD, 0x58, 0xC0,
+0x0F, 0xDF, 0x73, 0x7B, 0x99, 0xC1, 0x17, 0xF7, 0x7C, 0xFE, 0x65, 0x6A, 0x02, 0xC0, 0x5A, 0xEE,
+0x42, 0x59, 0xC1, 0x1D, 0xFF, 0xFF, 0xFF, 0x1F, 0x70, 0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93,
+0xFE, 0xAF, 0xAE, 0xC2, 0xEC, 0x93, 0x71, 0xCD, 0x0C, 0x94, 0x6D, 0xC1, 0xA9, 0x62, 0x91, 0xD5,
+0x44, 0xC0, 0x32, 0xE6, 0xA6, 0xC2, 0x50, 0xCD, 0x2A, 0x73, 0xB1, 0xD5, 0x6A, 0xC0, 0xD1, 0xDD,
+0x44, 0x61, 0x49, 0xC3, 0xCF, 0xB4, 0x2D, 0x9C, 0x0F, 0xBD, 0x0A, 0x73, 0x77, 0xAF, 0x65, 0xBF,
+0xC1, 0x6B, 0x7B, 0xAE, 0xB4, 0x65, 0x7D, 0x4C, 0x66, 0xC1, 0xAB, 0x8B, 0x4D, 0xA4, 0x65, 0x56,
+0xC0, 0x94, 0xF6, 0x72, 0x05, 0xA6, 0xC0, 0x9C, 0xFF, 0x71, 0x06, 0xC2, 0x1C, 0xE7, 0x59, 0xCE,
+0x9E, 0xF7, 0xAE, 0xBF, 0x70, 0xC0, 0xBA, 0xDE, 0x96, 0x71, 0x13, 0xC3, 0x3D, 0xFF, 0x9C, 0xFE,
+0x77, 0xCD, 0x73, 0xAC, 0xAE, 0x00, 0xBF, 0xC2, 0xAB, 0x62, 0x56, 0xCD, 0xBC, 0xFE, 0xA5, 0x00,
+0xA6, 0x81, 0xA6, 0x00, 0x42, 0xC0, 0x36, 0xC5, 0x78, 0x6A, 0xAE, 0x71, 0x12, 0xC2, 0x3C, 0xD6,
+0xBB, 0xC5, 0xFC, 0xC5, 0x66, 0xC0, 0x38, 0xB5, 0x9A, 0xC1, 0x79, 0xB5, 0xFC, 0xC5, 0x6B, 0x66,
+0x00, 0x6B, 0xC1, 0x79, 0xBD, 0x90, 0x7B, 0x95, 0xAB, 0x00, 0x5A, 0xC0, 0x18, 0xAD, 0x6B, 0x66,
+0x01, 0x91, 0x95, 0x00, 0x52, 0xC2, 0x33, 0x8C, 0x75, 0x94, 0xFC, 0xCD, 0x66, 0x01, 0x6B, 0x03,
+0x66, 0x00, 0xC0, 0xFA, 0xC5, 0x75, 0xC0, 0xAF, 0xF7, 0xAF, 0x67, 0xC5, 0x0F, 0xDF, 0xED, 0xBD,
+0x6A, 0x8C, 0xCA, 0x9C, 0x8C, 0xB5, 0x90, 0xEF, 0x7B, 0x00, 0x40, 0xC0, 0x4F, 0xE7, 0x46, 0xC2,
+0xCC, 0xB5, 0x4A, 0x8C, 0xCB, 0x9C, 0x7F, 0xC0, 0xCF, 0xF7, 0x53, 0x65, 0xC1, 0xF9, 0xE5, 0x56,
+0xCD, 0x01, 0xBF, 0xC0, 0x52, 0xA4, 0x46, 0x65, 0xC0, 0x1D, 0xFF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xCF, 0x18, 0xFF, 0x93, 0xFE, 0xD4, 0xFE, 0x33, 0xEE, 0x88, 0x5A, 0x0D, 0x9C,
+0x88, 0x62, 0xF2, 0xE5, 0xCC, 0x93, 0xF5, 0xFE, 0x2D, 0x9C, 0xD2, 0xDD, 0xAE, 0xB4, 0xEC, 0x93,
+0xE9, 0x6A, 0x70, 0xCD, 0x74, 0xC0, 0xEF, 0xBC, 0x41, 0xC0, 0x56, 0xFF, 0x65, 0x49, 0xC0, 0x91,
+0xD5, 0x6D, 0xC1, 0xAB, 0x8B, 0xB4, 0xFE, 0x43, 0x60, 0xC0, 0x6B, 0x7B, 0x76, 0xC0, 0x74, 0xF6,
+0x60, 0xC0, 0xF2, 0xDD, 0x60, 0x43, 0x74, 0xC3, 0x50, 0xCD, 0x6B, 0x83, 0xCC, 0x8B, 0x73, 0xF6,
+0x72, 0x05, 0x6D, 0xC1, 0x9C, 0xFF, 0xFF, 0xFF, 0x08, 0xC0, 0x55, 0xAD, 0x71, 0xC2, 0x14, 0xA5,
+0x10, 0x84, 0xF7, 0xC5, 0x71, 0x14, 0xC4, 0x1D, 0xFF, 0xBD, 0xFE, 0xF0, 0x93, 0x6E, 0x83, 0x36,
+0xC5, 0xA5, 0x6F, 0xC1, 0x2D, 0x73, 0x56, 0xCD, 0x6A, 0xA5, 0x6A, 0xC1, 0x97, 0xD5, 0xAB, 0x62,
+0x41, 0x00, 0xBF, 0xC0, 0xCC, 0x6A, 0x59, 0xC0, 0xDD, 0xFE, 0xA9, 0xC0, 0xFF, 0xFF, 0x12, 0x47,
+0x6B, 0xC2, 0xB6, 0x9C, 0x4F, 0x73, 0x90, 0x7B, 0x00, 0x95, 0xC1, 0xB1, 0x7B, 0x9A, 0xBD, 0x6B,
+0xA6, 0xC2, 0xFC, 0xCD, 0x13, 0x8C, 0x2E, 0x6B, 0x6B, 0xAB, 0x00, 0xC0, 0xF2, 0x83, 0x55, 0x7A,
+0x66, 0x7A, 0xC1, 0x54, 0x94, 0x8B, 0x52, 0x69, 0x96, 0xBF, 0xC2, 0x2A, 0x4A, 0xD2, 0x83, 0x1C,
+0xCE, 0x66, 0x01, 0x48, 0xA1, 0x00, 0xAF, 0xC0, 0xD6, 0xA4, 0x69, 0x72, 0xAC, 0xC3, 0x91, 0xEF,
+0xD0, 0xF7, 0xEB, 0x9C, 0xCE, 0xDE, 0x73, 0xC0, 0xE9, 0x7B, 0x68, 0xC1, 0x09, 0x84, 0x0F, 0xE7,
+0x7B, 0x00, 0x73, 0xC0, 0xCA, 0x9C, 0x5F, 0xA6, 0xC0, 0xA9, 0x7B, 0x68, 0xA6, 0x5F, 0xC0, 0xAF,
+0xF7, 0x53, 0xC3, 0xBD, 0xFE, 0x56, 0xCD, 0x73, 0xAC, 0xD8, 0xDD, 0xA6, 0x00, 0xC0, 0x93, 0xB4,
+0x4B, 0xC2, 0x9C, 0xFE, 0x1D, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xCF,
+0x18, 0xFF, 0x93, 0xFE, 0xF5, 0xFE, 0xCF, 0xB4, 0x6B, 0x83, 0x50, 0xBD, 0x8B, 0x83, 0x8E, 0xAC,
+0xCC, 0x8B, 0xD4, 0xFE, 0xEC, 0x93, 0x91, 0xD5, 0x4A, 0x7B, 0x33, 0xEE, 0x0A, 0x73, 0x50, 0xC5,
+0x65, 0x61, 0x49, 0xC0, 0x33, 0xE6, 0x49, 0xC0, 0xAE, 0xB4, 0x79, 0xC0, 0x0F, 0xC5, 0x75, 0x77,
+0x43, 0x60, 0x61, 0xC3, 0x15, 0xFF, 0x74, 0xF6, 0xAB, 0x8B, 0xD2, 0xDD, 0x51, 0x77, 0x60, 0x61,
+0xC0, 0x94, 0xF6, 0x49, 0xC0, 0x0F, 0xBD, 0x7E, 0xA5, 0x04, 0x6D, 0x4D, 0x71, 0x07, 0xA6, 0xC0,
+0x10, 0x84, 0x64, 0xC1, 0xF0, 0x83, 0x1C, 0xE7, 0x40, 0x71, 0x14, 0xC0, 0x1D, 0xFF, 0x5E, 0x6E,
+0xC1, 0x5B, 0xF6, 0xFD, 0xFE, 0xA6, 0xC1, 0x1E, 0xFF, 0x19, 0xEE, 0xAF, 0xC0, 0x9C, 0xFE, 0x5E,
+0x65, 0xC1, 0x19, 0xE6, 0x73, 0xAC, 0x65, 0x5E, 0x65, 0x6E, 0xC0, 0x35, 0xC5, 0x65, 0x6F, 0x71,
+0x12, 0xC0, 0x5C, 0xD6, 0x6B, 0xC1, 0xED, 0x62, 0x74, 0x94, 0x6B, 0x00, 0x96, 0x72, 0xC1, 0x95,
+0x9C, 0xFC, 0xC5, 0xA1, 0x6B, 0xC2, 0x7A, 0xBD, 0xB1, 0x7B, 0x4F, 0x73, 0xAF, 0x00, 0xBE, 0xC0,
+0x38, 0xAD, 0x6B, 0x66, 0xAF, 0xC0, 0xD7, 0xA4, 0x58, 0x77, 0x6B, 0xC1, 0x1D, 0xCE, 0xF7, 0xA4,
+0x54, 0x72, 0x66, 0x6B, 0xC1, 0x59, 0xB5, 0x6A, 0x52, 0x61, 0x69, 0x00, 0xC1, 0x0E, 0x6B, 0x8B,
+0x52, 0x77, 0xA8, 0x7A, 0xBC, 0xC7, 0x68, 0x6B, 0x0F, 0xDF, 0xEB, 0x9C, 0xE9, 0x7B, 0xF1, 0xFF,
+0x09, 0x84, 0x0D, 0xC6, 0xD0, 0xF7, 0xA6, 0xCA, 0x4F, 0xE7, 0x48, 0x6B, 0x90, 0xEF, 0x29, 0x84,
+0xAA, 0x94, 0xF1, 0xFF, 0xA8, 0x73, 0xAE, 0xD6, 0xCF, 0xF7, 0x17, 0xF7, 0x7C, 0xFE, 0x90, 0xAE,
+0xC0, 0xDD, 0xFE, 0xA5, 0x76, 0x51, 0x42, 0xC2, 0x7B, 0xFE, 0x1D, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC5, 0x18, 0xFF, 0x93, 0xFE, 0xD4, 0xFE, 0xAE, 0xB4, 0xD2, 0xDD,
+0x36, 0xFF, 0x75, 0xC2, 0x8E, 0xAC, 0xCF, 0xB4, 0xB4, 0xFE, 0x69, 0xC0, 0x32, 0xEE, 0x5D, 0xC1,
+0x6A, 0x7B, 0xAB, 0x8B, 0x75, 0x5D, 0x72, 0xC2, 0x4D, 0xA4, 0x09, 0x73, 0x0F, 0xBD, 0x72, 0xC0,
+0x2D, 0x9C, 0x51, 0x96, 0x77, 0x00, 0x5D, 0xC0, 0xD1, 0xDD, 0x77, 0x92, 0xC1, 0xAE, 0xAC, 0x12,
+0xE6, 0x5A, 0x77, 0xC0, 0xEF, 0xBC, 0x00, 0xC1, 0x6B, 0x7B, 0xCC, 0x8B, 0x56, 0x72, 0x05, 0x6D,
+0x4D, 0xC0, 0xFF, 0xFF, 0x08, 0xC2, 0xDB, 0xDE, 0x75, 0xB5, 0x7D, 0xEF, 0x00, 0xC0, 0x39, 0xCE,
+0x71, 0x0C, 0x91, 0xC0, 0x59, 0xCE, 0x64, 0xC0, 0xF4, 0xA4, 0xAE, 0xC1, 0x96, 0xB5, 0xBA, 0xD6,
+0x71, 0xC0, 0x3D, 0xFF, 0x65, 0xC2, 0xF5, 0xBC, 0x11, 0x9C, 0xF9, 0xE5, 0x59, 0xC2, 0xD4, 0xB4,
+0xAF, 0x8B, 0x19, 0xE6, 0x65, 0x5E, 0x65, 0x73, 0xC0, 0x36, 0xC5, 0x59, 0xC0, 0xDD, 0xFE, 0x65,
+0x6F, 0xBE, 0x65, 0xC0, 0xDC, 0xFE, 0x71, 0x12, 0xC3, 0x3C, 0xD6, 0xBB, 0xC5, 0xF7, 0xAC, 0x6F,
+0x73, 0xA6, 0x01, 0xC0, 0xB1, 0x7B, 0x57, 0x6B, 0x66, 0x00, 0xAF, 0x46, 0xC0, 0xBA, 0xBD, 0x63,
+0xC0, 0x54, 0x94, 0x75, 0xC0, 0xB6, 0xA4, 0x72, 0x66, 0x00, 0xC0, 0xFC, 0xC5, 0x46, 0x66, 0xC2,
+0x38, 0xB5, 0x75, 0x9C, 0x91, 0x7B, 0x63, 0x72, 0x66, 0x6B, 0x57, 0xC0, 0xF2, 0x83, 0x5C, 0x6B,
+0x72, 0xC0, 0x7A, 0xBD, 0x58, 0x6B, 0xAE, 0xC3, 0x91, 0xEF, 0xD0, 0xF7, 0xEC, 0xBD, 0xE9, 0x7B,
+0xA6, 0xC3, 0x0F, 0xDF, 0xB0, 0xF7, 0x8A, 0x94, 0xEF, 0xDE, 0x40, 0x7B, 0x40, 0xC0, 0x6C, 0xAD,
+0x42, 0xC1, 0x09, 0x84, 0x4F, 0xEF, 0x67, 0x70, 0x5F, 0xC1, 0xCF, 0xF7, 0x18, 0xF7, 0x65, 0xC0,
+0xD8, 0xDD, 0x5B, 0xC0, 0x19, 0xEE, 0x65, 0xC0, 0xB8, 0xD5, 0x4C, 0x76, 0x65, 0xC0, 0x1D, 0xFF,
+0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0xAF, 0xAE, 0x72,
+0xA6, 0x72, 0x77, 0x00, 0x72, 0x77, 0x72, 0x77, 0x6D, 0xC0, 0xF5, 0xFE, 0x72, 0x77, 0x72, 0x77,
+0x6D, 0x7E, 0xC3, 0x53, 0xF6, 0x0F, 0xBD, 0xCC, 0x8B, 0x6E, 0xAC, 0x43, 0x72, 0x77, 0x72, 0x01,
+0x77, 0x72, 0x77, 0x72, 0x77, 0x00, 0x6D, 0x72, 0x07, 0x6D, 0xC0, 0x9C, 0xFF, 0x71, 0x07, 0xC1,
+0x5D, 0xEF, 0x71, 0x94, 0x44, 0xAE, 0xC1, 0x38, 0xC6, 0xF3, 0xA4, 0x71, 0x0C, 0x65, 0xC2, 0xD7,
+0xBD, 0xDB, 0xDE, 0x1C, 0xE7, 0x95, 0x91, 0x78, 0x70, 0xC4, 0x5E, 0xFF, 0x7B, 0xFE, 0xBC, 0xFE,
+0xF4, 0xBC, 0x49, 0x52, 0xA6, 0xC1, 0xAF, 0x8B, 0x7B, 0xF6, 0x6A, 0x59, 0x5E, 0xAB, 0x91, 0xC2,
+0x93, 0xAC, 0x8F, 0x8B, 0x31, 0xA4, 0x6D, 0xC0, 0x52, 0xA4, 0x6E, 0x65, 0x6F, 0x71, 0x12, 0xC2,
+0x3C, 0xD6, 0x9B, 0xBD, 0xFC, 0xCD, 0x7F, 0xC0, 0xBB, 0xC5, 0x99, 0x7F, 0x75, 0xC1, 0xF7, 0xA4,
+0xDC, 0xC5, 0x66, 0x6B, 0xC1, 0x59, 0xB5, 0xD1, 0x7B, 0xA1, 0xC1, 0xD2, 0x83, 0x4A, 0x52, 0x6C,
+0xC0, 0x9A, 0xBD, 0x6B, 0x66, 0x6B, 0xC0, 0x38, 0xB5, 0x75, 0x69, 0x75, 0xC1, 0x4A, 0x4A, 0xB6,
+0x9C, 0x5C, 0x6B, 0x66, 0x00, 0x6B, 0x7F, 0x72, 0x00, 0xBE, 0x43, 0x55, 0x6B, 0xAF, 0xC1, 0x97,
+0xF7, 0xAF, 0xF7, 0x79, 0x92, 0x74, 0x00, 0x6C, 0x00, 0x74, 0x6C, 0xAE, 0x6C, 0x79, 0x6C, 0x79,
+0x74, 0x6C, 0x00, 0xBD, 0xC2, 0xD2, 0xF7, 0x1C, 0xFF, 0x7C, 0xFE, 0x65, 0x5F, 0xC0, 0x11, 0x9C,
+0x95, 0xC0, 0x93, 0xB4, 0x51, 0x65, 0x59, 0x40, 0xC0, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0xAF, 0x11, 0x96, 0xC0, 0xEF, 0xBC, 0x00, 0xC0, 0x94,
+0xFE, 0x72, 0x14, 0x6D, 0xC1, 0x9C, 0xFF, 0xFF, 0xFF, 0x07, 0xC2, 0x96, 0xB5, 0x6D, 0x73, 0xF3,
+0x9C, 0xBF, 0xA5, 0xC0, 0xDB, 0xDE, 0x71, 0x0E, 0xC0, 0xF8, 0xC5, 0x71, 0x00, 0xC1, 0xF7, 0xBD,
+0x3C, 0xE7, 0x71, 0x40, 0x65, 0xC4, 0x15, 0xC5, 0xAF, 0x8B, 0x36, 0xC5, 0x77, 0xD5, 0x11, 0x9C,
+0x00, 0xC0, 0x3A, 0xEE, 0x65, 0xA9, 0x65, 0x59, 0x63, 0xC0, 0x4D, 0x7B, 0x96, 0xBA, 0x63, 0x59,
+0x00, 0xC0, 0xDC, 0xFE, 0x71, 0x12, 0x47, 0xC2, 0xBB, 0xC5, 0x38, 0xB5, 0xD6, 0xA4, 0x00, 0xAB,
+0xBE, 0xC0, 0x8C, 0x5A, 0x54, 0xC0, 0xFC, 0xC5, 0x66, 0x6B, 0xC1, 0x18, 0xAD, 0xAC, 0x5A, 0x55,
+0xC0, 0x54, 0x94, 0x5E, 0x6F, 0xC0, 0xDC, 0xC5, 0x66, 0x00, 0x72, 0x54, 0x5E, 0xC0, 0x70, 0x73,
+0x6C, 0x5E, 0xC0, 0x79, 0xB5, 0x6B, 0x66, 0x00, 0x6B, 0x96, 0xC0, 0xF7, 0xA4, 0x54, 0x00, 0x60,
+0x6C, 0x5E, 0x72, 0x77, 0xC2, 0xDF, 0xFF, 0xD8, 0xFF, 0xB3, 0xF7, 0xAE, 0x50, 0x01, 0x55, 0x50,
+0x03, 0x55, 0x50, 0x01, 0x55, 0xC2, 0xD5, 0xF7, 0xFD, 0xFF, 0x1E, 0xFF, 0x65, 0xC2, 0xD9, 0xE5,
+0xD4, 0xB4, 0x97, 0xD5, 0x6E, 0xC0, 0x15, 0xC5, 0x96, 0xC1, 0x3A, 0xEE, 0x9B, 0xFE, 0x40, 0x71,
+0x1F, 0x70, 0x00, 0x71, 0x04, 0x5D, 0xC0, 0x93, 0xFE, 0xAF, 0x0B, 0xA6, 0x00, 0x72, 0x04, 0xAF,
+0xA9, 0x72, 0x04, 0x6D, 0x00, 0x72, 0x0C, 0x6D, 0x4D, 0x71, 0x06, 0x5C, 0xC0, 0x14, 0xA5, 0x41,
+0xC0, 0x75, 0xAD, 0x00, 0xA2, 0xC0, 0x59, 0xCE, 0x71, 0x0E, 0xC1, 0xB6, 0xBD, 0x2C, 0x6B, 0x00,
+0xC0, 0x34, 0xA5, 0x6C, 0x71, 0xC2, 0x3D, 0xFF, 0x7B, 0xFE, 0x19, 0xEE, 0x65, 0xC0, 0xFD, 0xFE,
+0xA6, 0x7B, 0x46, 0x73, 0x65, 0x5E, 0x65, 0x6E, 0xC0, 0x93, 0xB4, 0x42, 0xC0, 0xFD, 0xFE, 0x42,
+0xC0, 0x32, 0xA4, 0x5B, 0xC0, 0xBC, 0xFE, 0xAE, 0x71, 0x12, 0xC3, 0x3C, 0xD6, 0xBB, 0xC5, 0x95,
+0x9C, 0x90, 0x7B, 0xAF, 0x01, 0x69, 0xC0, 0x7A, 0xBD, 0x6B, 0x66, 0x00, 0xAF, 0x7F, 0xC0, 0xB6,
+0x9C, 0x61, 0xC3, 0xCC, 0x62, 0x0E, 0x6B, 0xB6, 0xA4, 0xFC, 0xC5, 0xA1, 0x00, 0x7A, 0x00, 0xC4,
+0x75, 0x9C, 0x4F, 0x73, 0xCC, 0x5A, 0x2E, 0x6B, 0xF7, 0xAC, 0x72, 0x66, 0x6B, 0x57, 0xC0, 0xD2,
+0x83, 0x91, 0x75, 0x00, 0x95, 0xC0, 0x34, 0x94, 0x6B, 0xAE, 0x6C, 0x71, 0x11, 0xC0, 0x1D, 0xFF,
+0x59, 0x95, 0x59, 0x76, 0x6A, 0x76, 0x6E, 0xBF, 0x5E, 0x40, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0x5D, 0xC0, 0x93, 0xFE, 0xAF, 0x03, 0x91, 0x6D, 0x72, 0x96, 0x6D, 0x72, 0x5E, 0x7E,
+0xC1, 0xEF, 0xBC, 0x32, 0xE6, 0x6D, 0xC0, 0xD4, 0xFE, 0x72, 0x6A, 0x6D, 0xC0, 0x0C, 0x94, 0xBF,
+0xC0, 0x53, 0xEE, 0x72, 0x6D, 0x72, 0xC0, 0x53, 0xF6, 0x77, 0x00, 0xC1, 0x0F, 0xBD, 0xD2, 0xDD,
+0x77, 0x72, 0x0B, 0x6D, 0x4D, 0xC0, 0xFF, 0xFF, 0x06, 0x91, 0xC0, 0x3C, 0xE7, 0xA6, 0xC1, 0x96,
+0xB5, 0x13, 0xA5, 0x78, 0xC0, 0x7D, 0xEF, 0x71, 0x0D, 0x5D, 0x50, 0x78, 0xAE, 0xC0, 0xD3, 0x9C,
+0x75, 0x71, 0x40, 0xC0, 0x7B, 0xFE, 0x00, 0xC0, 0xD4, 0xBC, 0x91, 0x6E, 0xC1, 0xB4, 0xB4, 0xCF,
+0x8B, 0x73, 0x65, 0xA9, 0xAF, 0xC2, 0xB8, 0xDD, 0x56, 0xCD, 0xFD, 0xFE, 0x6A, 0xAF, 0x7B, 0x65,
+0x59, 0x6F, 0x71, 0x12, 0xC0, 0x3C, 0xD6, 0x6B, 0x67, 0x54, 0xC0, 0x1D, 0xCE, 0x7A, 0x96, 0xC0,
+0xF2, 0x83, 0x43, 0x6B, 0xA6, 0x6B, 0x66, 0x55, 0x00, 0x49, 0x91, 0xC1, 0xED, 0x62, 0x38, 0xAD,
+0x6B, 0x66, 0x6B, 0x57, 0xC1, 0x2E, 0x6B, 0x6F, 0x73, 0x49, 0x69, 0x41, 0x48, 0x6B, 0x66, 0x6B,
+0x52, 0x44, 0x66, 0x7F, 0xAB, 0xC1, 0x18, 0xAD, 0x33, 0x8C, 0x6B, 0xAE, 0x6C, 0x71, 0x11, 0x40,
+0x59, 0x65, 0xC0, 0x98, 0xD5, 0x77, 0x42, 0x4B, 0x4F, 0x73, 0x65, 0x40, 0x71, 0x1F, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0xAF, 0x03, 0xC0, 0xCF, 0xB4, 0xA5, 0xC6,
+0xD2, 0xDD, 0xEC, 0x93, 0x8E, 0xAC, 0x33, 0xEE, 0x4D, 0xA4, 0x91, 0xD5, 0x0F, 0xBD, 0x55, 0xC4,
+0x0C, 0x9C, 0xD1, 0xDD, 0xEF, 0xBC, 0xCC, 0x93, 0x30, 0xC5, 0x41, 0xBF, 0x45, 0x55, 0x5D, 0x51,
+0xC0, 0x6E, 0xA4, 0x45, 0x5D, 0xC2, 0x4A, 0x7B, 0xB1, 0xDD, 0xD4, 0xFE, 0x72, 0x0B, 0xA6, 0xC1,
+0x9C, 0xFF, 0xFF, 0xFF, 0x08, 0xC3, 0x92, 0x94, 0x55, 0xAD, 0x58, 0xCE, 0xF3, 0xA4, 0x00, 0x71,
+0x0E, 0xC0, 0x1C, 0xE7, 0x5C, 0x95, 0xC0, 0xB7, 0xBD, 0x70, 0x71, 0xC0, 0x3D, 0xFF, 0x6A, 0xC3,
+0x52, 0xA4, 0xF0, 0x93, 0xB3, 0xB4, 0x8A, 0x62, 0x4F, 0x42, 0xC0, 0x9C, 0xFE, 0x5E, 0x00, 0x6A,
+0xC2, 0x15, 0xC5, 0xEC, 0x72, 0x36, 0xC5, 0x63, 0x00, 0x5B, 0xC0, 0xB8, 0xDD, 0x65, 0xC1, 0xDC,
+0xFE, 0xFF, 0xFF, 0x12, 0xC3, 0x5C, 0xD6, 0xBB, 0xC5, 0xCC, 0x62, 0x38, 0xB5, 0x7F, 0x96, 0xC2,
+0x3D, 0xD6, 0x4F, 0x73, 0x74, 0x94, 0x7A, 0x91, 0x7A, 0xC0, 0x95, 0x9C, 0x55, 0x4E, 0x00, 0xAF,
+0xC0, 0x13, 0x8C, 0x90, 0x7A, 0x66, 0x7A, 0xC1, 0x33, 0x8C, 0xB1, 0x7B, 0x5A, 0x4E, 0x5A, 0x75,
+0x5D, 0x7A, 0x66, 0x77, 0xC2, 0xB6, 0xA4, 0x0E, 0x6B, 0x1D, 0xD6, 0x7A, 0x00, 0x57, 0xC2, 0xAC,
+0x5A, 0x9B, 0xBD, 0xFB, 0xCD, 0x6C, 0xAE, 0x11, 0xC0, 0x1D, 0xFF, 0x65, 0xC1, 0x77, 0xD5, 0xB4,
+0xB4, 0x4B, 0xC1, 0x11, 0x9C, 0x56, 0xCD, 0x4A, 0x65, 0x59, 0x40, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0x72, 0x02, 0x91, 0xC2, 0xAE, 0xB4, 0x8B, 0x83,
+0xEF, 0xBC, 0x00, 0x92, 0x61, 0x79, 0x00, 0x71, 0xC1, 0xEC, 0x93, 0xD2, 0xDD, 0x79, 0x71, 0xC2,
+0x50, 0xCD, 0xCF, 0xB4, 0xAC, 0x8B, 0x49, 0x5D, 0x58, 0x79, 0x61, 0xC2, 0x6D, 0xA4, 0xE9, 0x6A,
+0x30, 0xC5, 0x71, 0x61, 0xC0, 0xD4, 0xFE, 0x72, 0x0B, 0xA6, 0xC1, 0x9C, 0xFF, 0xFF, 0xFF, 0x08,
+0xC4, 0x10, 0x84, 0xF7, 0xBD, 0xFB, 0xDE, 0x75, 0xAD, 0x51, 0x8C, 0x71, 0x0D, 0xC0, 0x5D, 0xEF,
+0x54, 0xC0, 0x8E, 0x73, 0x68, 0xC1, 0xAE, 0x73, 0x59, 0xCE, 0x71, 0xC0, 0x3D, 0xFF, 0x6A, 0xC4,
+0x8F, 0x8B, 0xF1, 0x9B, 0xB3, 0xB4, 0x6A, 0x5A, 0xD4, 0xB4, 0x47, 0x42, 0xC0, 0x9C, 0xFE, 0xA9,
+0x6A, 0x63, 0xC0, 0xCB, 0x6A, 0x40, 0x92, 0x01, 0xC0, 0x77, 0xD5, 0x65, 0x6F, 0x71, 0x12, 0xC2,
+0x3C, 0xD6, 0xDC, 0xC5, 0x13, 0x8C, 0x41, 0xC1, 0x95, 0x9C, 0xD6, 0xA4, 0x58, 0xC0, 0xED, 0x62,
+0x43, 0x6B, 0xA6, 0x7A, 0xC1, 0x54, 0x94, 0xCC, 0x5A, 0x6C, 0x58, 0xAF, 0xC1, 0x2E, 0x6B, 0x70,
+0x73, 0x7F, 0x66, 0x7A, 0xC0, 0xD2, 0x83, 0x72, 0x6C, 0x58, 0x6C, 0x72, 0xC0, 0xF2, 0x83, 0x7F,
+0x66, 0x6B, 0x57, 0x41, 0x44, 0x54, 0x96, 0x55, 0xC1, 0xB1, 0x7B, 0xDC, 0xC5, 0xAD, 0xC0, 0xDF,
+0xFF, 0x71, 0x11, 0xC0, 0x1D, 0xFF, 0x65, 0xC0, 0x15, 0xC5, 0x81, 0xC0, 0x97, 0xD5, 0x50, 0xC0,
+0x56, 0xCD, 0xBF, 0x42, 0xC0, 0x7B, 0xFE, 0x40, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0xC1, 0x18, 0xFF, 0x93, 0xFE, 0xAF, 0x01, 0xAE, 0xC2, 0xF2, 0xDD, 0x0D, 0x9C, 0xAC, 0x8B, 0x76,
+0xC2, 0x50, 0xC5, 0xEF, 0xBC, 0x6E, 0xAC, 0x74, 0x00, 0x76, 0xC2, 0xEC, 0x93, 0x6D, 0xA4, 0xCF,
+0xB4, 0x00, 0x74, 0xC0, 0xAE, 0xB4, 0x00, 0xC0, 0xB1, 0xDD, 0x65, 0xC1, 0x4D, 0xA4, 0x91, 0xD5,
+0x71, 0x79, 0xC3, 0x4A, 0x7B, 0x8E, 0xAC, 0xCC, 0x8B, 0xB1, 0xD5, 0x77, 0x72, 0x0B, 0x6D, 0x4D,
+0xC0, 0xFF, 0xFF, 0x08, 0xC1, 0xFB, 0xDE, 0x75, 0xAD, 0x00, 0x51, 0xC0, 0xBE, 0xF7, 0x71, 0x0D,
+0x5C, 0x70, 0xC0, 0x59, 0xCE, 0x69, 0xC1, 0x14, 0xA5, 0xB6, 0xB5, 0x71, 0x40, 0xC1, 0x9C, 0xFE,
+0xB8, 0xDD, 0x73, 0x5B, 0x63, 0x91, 0x73, 0xC0, 0x5A, 0xF6, 0x65, 0x5E, 0x6A, 0xC0, 0x77, 0xCD,
+0x5F, 0x7B, 0xA6, 0x00, 0xC0, 0x7B, 0xF6, 0x65, 0x59, 0x6F, 0x71, 0x12, 0x47, 0xC1, 0xBB, 0xC5,
+0xFC, 0xCD, 0x54, 0xC0, 0xD1, 0x83, 0x00, 0xC0, 0x33, 0x8C, 0x57, 0xC0, 0xDC, 0xC5, 0x66, 0x00,
+0x6B, 0xC1, 0x7A, 0xBD, 0x95, 0x9C, 0x91, 0x40, 0x00, 0xA6, 0xC0, 0x59, 0xB5, 0x6B, 0x66, 0x6B,
+0x48, 0x7B, 0x6C, 0x40, 0x01, 0x48, 0x6B, 0x66, 0x00, 0x6B, 0x66, 0x5D, 0xC0, 0xB1, 0x7B, 0x49,
+0xC0, 0xB6, 0x9C, 0x7A, 0x66, 0xC1, 0xFB, 0xC5, 0xDF, 0xFF, 0x71, 0x11, 0xC0, 0x1D, 0xFF, 0x59,
+0x42, 0xC0, 0x56, 0xCD, 0x4B, 0x5A, 0x4B, 0x77, 0xC0, 0x3A, 0xF6, 0x59, 0x40, 0x71, 0x1F, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0xAF, 0x02, 0x6D, 0xC0, 0x70, 0xCD,
+0xBF, 0xC0, 0x53, 0xEE, 0x01, 0xA6, 0xC1, 0x30, 0xC5, 0xF2, 0xE5, 0x56, 0x91, 0x45, 0x72, 0xC1,
+0x91, 0xCD, 0x6B, 0x83, 0x52, 0x56, 0x6D, 0x42, 0x61, 0x52, 0x56, 0x45, 0x7D, 0x81, 0xC1, 0x50,
+0xCD, 0x94, 0xF6, 0x72, 0x0C, 0x6D, 0xC0, 0x9C, 0xFF, 0x71, 0x08, 0xC0, 0xD7, 0xBD, 0x7C, 0xC2,
+0xB6, 0xB5, 0xBA, 0xD6, 0x9E, 0xF7, 0x71, 0x0E, 0xC0, 0x3C, 0xE7, 0x91, 0xC0, 0xF3, 0x9C, 0x7C,
+0xC0, 0x7D, 0xEF, 0x71, 0xC2, 0x3D, 0xFF, 0xBC, 0xFE, 0x52, 0xA4, 0x77, 0xC0, 0xFD, 0xFE, 0x76,
+0x00, 0xC0, 0x31, 0x9C, 0x4B, 0x6A, 0xA5, 0x6A, 0xC1, 0x77, 0xD5, 0xF1, 0x9B, 0x65, 0x00, 0x6A,
+0x5B, 0x64, 0x6A, 0x6F, 0x71, 0x12, 0x47, 0xC0, 0xBB, 0xC5, 0x54, 0x43, 0xC3, 0x1D, 0xCE, 0x54,
+0x94, 0x6F, 0x73, 0x13, 0x8C, 0x66, 0x6B, 0x66, 0x6B, 0x43, 0xC0, 0xD7, 0xA4, 0x4E, 0xC0, 0x18,
+0xAD, 0x5A, 0xC0, 0xB1, 0x7B, 0x43, 0x6B, 0x66, 0x6B, 0xC0, 0x38, 0xAD, 0xA5, 0x4E, 0x54, 0xC1,
+0x4F, 0x73, 0xD2, 0x83, 0x57, 0x6B, 0x66, 0x6B, 0x57, 0xC0, 0x95, 0x9C, 0x7A, 0x57, 0xC0, 0x90,
+0x7B, 0x96, 0x5B, 0x6B, 0xAE, 0xC0, 0xDF, 0xFF, 0x71, 0x11, 0xC0, 0x1D, 0xFF, 0x65, 0xC0, 0x77,
+0xCD, 0xBA, 0x76, 0x6A, 0xAE, 0x77, 0xC0, 0xB8, 0xDD, 0x65, 0x40, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0x5D, 0xC0, 0x93, 0xFE, 0x72, 0x03, 0xAE, 0x00, 0x72, 0x02, 0x7E, 0x77, 0x72,
+0x00, 0x7E, 0x77, 0xC1, 0xB1, 0xDD, 0x50, 0xCD, 0x6D, 0x77, 0x72, 0x00, 0x77, 0x00, 0x72, 0x7E,
+0x77, 0x00, 0x7E, 0x72, 0x0D, 0x6D, 0xC0, 0x9C, 0xFF, 0x71, 0x09, 0xC2, 0xFB, 0xDE, 0xB3, 0x9C,
+0x6A, 0x52, 0x50, 0x71, 0x0D, 0x49, 0xC1, 0x51, 0x8C, 0x34, 0xA5, 0x78, 0xA5, 0xC0, 0x5D, 0xEF,
+0x71, 0x45, 0x65, 0xC1, 0x4E, 0x7B, 0x77, 0xCD, 0x7B, 0x76, 0x7B, 0xC1, 0xD0, 0x93, 0xD4, 0xB4,
+0x6F, 0x5E, 0x6F, 0xC2, 0xB3, 0xB4, 0xF0, 0x93, 0xFE, 0xFE, 0x76, 0x7B, 0xC1, 0x56, 0xCD, 0x6E,
+0x83, 0x6A, 0x6F, 0x71, 0x12, 0xC9, 0x5C, 0xD6, 0xBB, 0xC5, 0xCD, 0x62, 0x59, 0xB5, 0xF7, 0xA4,
+0x6A, 0x52, 0x59, 0xB5, 0x0E, 0x6B, 0xB5, 0x9C, 0xFC, 0xC5, 0x66, 0x7A, 0xC0, 0xF2, 0x83, 0xA6,
+0x4E, 0xC3, 0x6A, 0x52, 0x95, 0x9C, 0x33, 0x8C, 0x6F, 0x73, 0x7A, 0x66, 0x7A, 0xC1, 0x70, 0x73,
+0x54, 0x94, 0x6B, 0xC0, 0x4A, 0x4A, 0x60, 0x75, 0xBE, 0x7A, 0x66, 0xAF, 0xC0, 0xD6, 0xA4, 0x41,
+0xC0, 0x5E, 0xD6, 0x41, 0x75, 0x60, 0xC0, 0xED, 0x62, 0x66, 0xC1, 0xFB, 0xC5, 0xDF, 0xFF, 0x71,
+0x11, 0xC0, 0x1D, 0xFF, 0x65, 0x4F, 0xC0, 0x97, 0xD5, 0x76, 0x6A, 0x76, 0xC0, 0x36, 0xC5, 0x00,
+0x65, 0x40, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0xAF,
+0x10, 0xAE, 0x72, 0x18, 0xA6, 0x4D, 0x71, 0x08, 0xC3, 0xB6, 0xB5, 0xB2, 0x94, 0xD7, 0xBD, 0x1C,
+0xE7, 0x6C, 0x71, 0x0D, 0xC2, 0x5D, 0xEF, 0x51, 0x8C, 0x79, 0xD6, 0x70, 0x95, 0xC0, 0xBE, 0xF7,
+0x71, 0x40, 0x65, 0xC4, 0x77, 0xCD, 0x2D, 0x7B, 0x31, 0xA4, 0x93, 0xAC, 0xD0, 0x93, 0x91, 0xC0,
+0x5B, 0xF6, 0x65, 0x5E, 0x65, 0x51, 0xC0, 0x8F, 0x83, 0x7C, 0x78, 0xC1, 0x31, 0x9C, 0x4D, 0x7B,
+0x46, 0xC1, 0x9C, 0xFE, 0xDC, 0xFE, 0x71, 0x12, 0x47, 0xC4, 0xDC, 0xC5, 0xD1, 0x83, 0x6F, 0x73,
+0xAC, 0x5A, 0x74, 0x94, 0x4E, 0xC2, 0x4F, 0x73, 0xD6, 0xA4, 0xFC, 0xC5, 0xA1, 0x72, 0x54, 0x41,
+0x55, 0x95, 0x4E, 0xC1, 0x75, 0x94, 0x90, 0x7B, 0x7A, 0x66, 0x77, 0xC0, 0x75, 0x9C, 0x41, 0x00,
+0x69, 0x4E, 0xC0, 0x12, 0x8C, 0x49, 0x7A, 0x66, 0x6B, 0x48, 0xC0, 0x0E, 0x63, 0x69, 0x5E, 0x66,
+0xC0, 0x59, 0xB5, 0x41, 0x66, 0xC0, 0xFB, 0xC5, 0x6C, 0xAE, 0x11, 0x40, 0x65, 0xC1, 0x1A, 0xEE,
+0x93, 0xAC, 0x63, 0xC4, 0x56, 0xCD, 0xF5, 0xBC, 0x93, 0xB4, 0x3A, 0xF6, 0x7B, 0xFE, 0x40, 0x71,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x18, 0xFF, 0x93, 0xFE, 0xAF, 0x2B, 0xA6, 0x4D,
+0x71, 0x08, 0x91, 0x71, 0x11, 0xC1, 0x7D, 0xEF, 0xCF, 0x7B, 0x50, 0xC0, 0x75, 0xAD, 0xA6, 0xC0,
+0x3C, 0xEF, 0x71, 0xC0, 0x5D, 0xFF, 0x59, 0x6A, 0xC0, 0x3A, 0xEE, 0x63, 0x4F, 0xC1, 0x77, 0xD5,
+0x9B, 0xFE, 0x65, 0x5E, 0x01, 0x65, 0x5E, 0xC0, 0x77, 0xCD, 0x4F, 0x63, 0x42, 0x6A, 0x59, 0xC0,
+0xFD, 0xFE, 0x71, 0x12, 0xC1, 0x7C, 0xD6, 0x9B, 0xBD, 0x6B, 0x54, 0xBF, 0x6B, 0xA6, 0xC0, 0x18,
+0xAD, 0x66, 0x02, 0x6B, 0x74, 0xC0, 0xB6, 0x9C, 0x66, 0x6B, 0xC1, 0x39, 0xB5, 0x79, 0xBD, 0x6B,
+0x66, 0x00, 0x6B, 0xC1, 0x17, 0xAD, 0xB6, 0xA4, 0x66, 0x6B, 0x74, 0x57, 0x6B, 0x66, 0x00, 0x6B,
+0x4B, 0xC2, 0x95, 0x9C, 0x7A, 0xBD, 0xDC, 0xC5, 0x48, 0xA6, 0x66, 0x7F, 0x71, 0x12, 0xC0, 0x5E,
+0xFF, 0x59, 0x65, 0x95, 0xC0, 0xB8, 0xDD, 0x95, 0xC0, 0xD8, 0xDD, 0x59, 0x65, 0x59, 0x4A, 0x71,
+0x1F, 0x70, 0x00, 0x71, 0x04, 0xC1, 0x5A, 0xFF, 0x93, 0xFE, 0xAF, 0x2A, 0x6D, 0x72, 0xC0, 0xDE,
+0xFF, 0x71, 0x0A, 0xA6, 0x71, 0x0F, 0xC2, 0x3C, 0xE7, 0x8E, 0x73, 0x79, 0xCE, 0x61, 0x5C, 0x5D,
+0x71, 0x6C, 0x6A, 0x59, 0xAF, 0x00, 0x6A, 0x65, 0x59, 0x05, 0x65, 0x6A, 0x65, 0x00, 0x59, 0x65,
+0xC0, 0xBF, 0xFF, 0x71, 0x12, 0xC0, 0x7E, 0xF7, 0x6B, 0x5E, 0x6B, 0xA6, 0x5E, 0x00, 0x66, 0x9A,
+0x5E, 0x02, 0x66, 0x6B, 0x66, 0x5E, 0x66, 0x00, 0x5E, 0x02, 0x66, 0x6B, 0x66, 0x5E, 0x66, 0x00,
+0x5E, 0x02, 0x66, 0x6B, 0x66, 0x5E, 0x66, 0x01, 0xC0, 0x1E, 0xEF, 0x71, 0x12, 0x6C, 0x6A, 0x59,
+0x00, 0x65, 0x01, 0x59, 0x00, 0x6A, 0x6C, 0x71, 0x1F, 0x70, 0x00, 0x71, 0x04, 0xA5, 0xC1, 0xF7,
+0xFE, 0x93, 0xFE, 0x2A, 0x6D, 0xC0, 0x5A, 0xFF, 0x71, 0x07, 0xC1, 0x3C, 0xE7, 0x59, 0xCE, 0x71,
+0x50, 0xC0, 0x51, 0x8C, 0xA6, 0xC0, 0xBA, 0xD6, 0x71, 0x0D, 0x6C, 0xC1, 0x96, 0xB5, 0x34, 0xAD,
+0x69, 0x64, 0x75, 0x71, 0x00, 0x6C, 0xC0, 0x5E, 0xFF, 0xA1, 0x0D, 0xAE, 0x67, 0x71, 0x14, 0xC1,
+0x9F, 0xF7, 0xDD, 0xDE, 0xA6, 0x21, 0x6A, 0x53, 0x71, 0x14, 0x6C, 0x51, 0x45, 0x03, 0x51, 0x6C,
+0x71, 0x20, 0x70, 0x00, 0x71, 0x06, 0xC0, 0x9C, 0xFF, 0xA5, 0x29, 0xC0, 0xBD, 0xFF, 0x71, 0x08,
+0x74, 0xC0, 0x30, 0x84, 0x74, 0xC0, 0x8E, 0x73, 0x5D, 0xC1, 0x38, 0xC6, 0xCF, 0x7B, 0x71, 0x2B,
+0xA6, 0x9A, 0x0D, 0x71, 0x25, 0x6C, 0x71, 0x00, 0x69, 0x11, 0x71, 0x02, 0x99, 0xA9, 0x03, 0x67,
+0x71, 0x21, 0x70, 0x00, 0x71, 0x3D, 0x75, 0x54, 0xAE, 0xC0, 0x75, 0xB5, 0x71, 0x61, 0x50, 0x71,
+0x11, 0xC1, 0xFB, 0xE6, 0x7D, 0xF7, 0x71, 0x14, 0x92, 0xC0, 0x3E, 0xE7, 0x96, 0x0E, 0x43, 0x64,
+0x71, 0x13, 0x64, 0xC0, 0x3E, 0xDF, 0x7B, 0x22, 0x40, 0x5F, 0x71, 0xC1, 0x9A, 0xDF, 0x56, 0xC7,
+0x95, 0x03, 0x44, 0x73, 0x71, 0x20, 0x70, 0x00, 0x71, 0xE0, 0x02, 0x49, 0xA6, 0x71, 0x0D, 0x5D,
+0x79, 0xC3, 0x34, 0xA5, 0xAE, 0x7B, 0x92, 0x94, 0x3C, 0xE7, 0x71, 0x14, 0x43, 0x7B, 0xC0, 0x5F,
+0xE7, 0x7B, 0xC0, 0x5E, 0xE7, 0x4F, 0x01, 0x7B, 0x04, 0x40, 0x43, 0x00, 0x7B, 0x00, 0x43, 0x71,
+0x12, 0xA6, 0x7B, 0x00, 0x40, 0x00, 0x7B, 0x4F, 0x40, 0x7B, 0x02, 0x40, 0x4F, 0x03, 0x43, 0x7B,
+0x02, 0x43, 0xC0, 0x7F, 0xE7, 0x4F, 0x02, 0x7B, 0x02, 0x40, 0x43, 0x40, 0x00, 0x4F, 0x40, 0x7B,
+0x43, 0xC1, 0x9C, 0xE7, 0x35, 0xBF, 0xBF, 0x00, 0xA6, 0x01, 0xC0, 0x76, 0xC7, 0x44, 0x75, 0xC0,
+0xBC, 0xEF, 0x71, 0x1F, 0x70, 0x00, 0x71, 0xE0, 0x02, 0x5C, 0xC0, 0x18, 0xC6, 0x71, 0x0C, 0xC1,
+0xF7, 0xC5, 0x69, 0x52, 0x59, 0x60, 0xC0, 0xAE, 0x73, 0x71, 0x15, 0x6C, 0x7B, 0x00, 0xC0, 0x3A,
+0xBE, 0x40, 0xC1, 0x5A, 0xC6, 0x52, 0x8C, 0x00, 0xC0, 0x19, 0xBE, 0x43, 0x7B, 0x01, 0x40, 0x01,
+0xC0, 0x3A, 0xC6, 0x78, 0x43, 0x7B, 0x00, 0x6C, 0x71, 0x11, 0x92, 0x7B, 0x40, 0x43, 0x7B, 0x00,
+0x73, 0xC0, 0xDD, 0xD6, 0x40, 0x7B, 0x00, 0x40, 0xA1, 0xC0, 0xD8, 0xB5, 0x01, 0xC0, 0xB3, 0x94,
+0x92, 0x73, 0x40, 0x7B, 0x00, 0x43, 0xC0, 0x5B, 0xC6, 0x5B, 0xC0, 0x77, 0xAD, 0x91, 0xC1, 0x11,
+0x84, 0x76, 0xAD, 0x43, 0x7B, 0x00, 0x40, 0x00, 0x78, 0x7B, 0xC2, 0x9C, 0xCE, 0xF9, 0xBD, 0x1D,
+0xDF, 0x40, 0x7B, 0xC0, 0x39, 0xCF, 0x44, 0xC2, 0xF2, 0xA5, 0x33, 0xA6, 0x97, 0xCF, 0x44, 0x49,
+0xC1, 0x30, 0x8D, 0x12, 0xA6, 0x44, 0xC0, 0x9A, 0xDF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x3D, 0xC0, 0x7D, 0xEF, 0x61, 0x71, 0xC0, 0xF7, 0xBD, 0x68, 0xC0, 0xF3, 0xA4, 0x49, 0x71, 0x0C,
+0xC5, 0x9E, 0xF7, 0x59, 0xCE, 0x75, 0xAD, 0xF3, 0x9C, 0x2C, 0x63, 0xD7, 0xBD, 0x58, 0x71, 0x13,
+0x6C, 0x40, 0xC1, 0xDD, 0xD6, 0x4E, 0x6B, 0x67, 0xC0, 0x2D, 0x63, 0x77, 0x50, 0xC1, 0x0D, 0x63,
+0xDC, 0xD6, 0x40, 0x00, 0x53, 0xC0, 0x93, 0x8C, 0x48, 0xC0, 0x11, 0x7C, 0x47, 0x91, 0xC0, 0x72,
+0x8C, 0x43, 0x7B, 0xC0, 0xDF, 0xFF, 0x71, 0x11, 0x64, 0x4F, 0xC0, 0xB7, 0xB5, 0x77, 0xC0, 0x32,
+0x84, 0x60, 0xC2, 0x6A, 0x4A, 0x8E, 0x73, 0x3A, 0xC6, 0x4F, 0x7B, 0xAE, 0x67, 0x77, 0x95, 0xC0,
+0xB4, 0x94, 0x58, 0xC1, 0x0C, 0x63, 0xB8, 0xB5, 0x43, 0x96, 0x40, 0x43, 0xC2, 0x6E, 0x6B, 0x56,
+0xAD, 0xD0, 0x7B, 0x99, 0xC2, 0x9B, 0xCE, 0x4D, 0x6B, 0x19, 0xBE, 0x4F, 0x40, 0x43, 0x53, 0x73,
+0x95, 0x73, 0xC0, 0x52, 0x84, 0x73, 0xC0, 0x1D, 0xDF, 0x43, 0x57, 0xC5, 0x56, 0xC7, 0x73, 0xAE,
+0xCC, 0x6B, 0xB1, 0x9D, 0x15, 0xBF, 0x2D, 0x74, 0xBE, 0x70, 0xC1, 0x55, 0xBF, 0x9A, 0xDF, 0x71,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0x6C, 0x29, 0x71, 0x09, 0xC0, 0x59, 0xCE, 0x59, 0x5C,
+0xC3, 0x6D, 0x6B, 0x1C, 0xE7, 0x96, 0xB5, 0x10, 0x84, 0x71, 0x0E, 0x91, 0xC3, 0x38, 0xC6, 0x75,
+0xB5, 0xCF, 0x7B, 0x9A, 0xD6, 0x71, 0x13, 0xA6, 0xC0, 0x3E, 0xDF, 0xA5, 0x64, 0x47, 0x50, 0x40,
+0xBE, 0xC1, 0xCF, 0x7B, 0xBC, 0xCE, 0x40, 0xBA, 0xC5, 0x7B, 0xCE, 0xEC, 0x62, 0x15, 0xA5, 0x0C,
+0x63, 0x7F, 0xE7, 0xFD, 0xD6, 0x70, 0x6C, 0x40, 0xC0, 0xDF, 0xFF, 0x71, 0x11, 0x92, 0x40, 0xC3,
+0xBC, 0xD6, 0x93, 0x8C, 0x11, 0x84, 0x56, 0xAD, 0x7C, 0xC0, 0xD8, 0xB5, 0x7B, 0x40, 0x7B, 0x00,
+0x43, 0x40, 0x4B, 0xC2, 0xF4, 0x9C, 0x8F, 0x73, 0x15, 0x9D, 0x64, 0x7B, 0x00, 0x40, 0x00, 0xC0,
+0x31, 0x84, 0x5B, 0x91, 0x9A, 0xC0, 0x9F, 0xEF, 0x4C, 0xC0, 0x19, 0xBE, 0x4F, 0x40, 0x67, 0x7C,
+0xC1, 0x5E, 0xE7, 0xD4, 0x94, 0x4B, 0xCC, 0xBF, 0xEF, 0x4D, 0x6B, 0x3A, 0xC6, 0x3F, 0xE7, 0x39,
+0xCF, 0x55, 0xC7, 0xD4, 0xB6, 0x91, 0x95, 0xC9, 0x52, 0xE7, 0x39, 0xEC, 0x6B, 0xF2, 0xA5, 0xF5,
+0xB6, 0x7A, 0xC0, 0x9A, 0xDF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x05, 0xC1, 0x9A, 0xFE,
+0xB6, 0xFD, 0xA6, 0x28, 0x58, 0xC1, 0x59, 0xFE, 0xDF, 0xFF, 0x71, 0x07, 0xC3, 0xFB, 0xDE, 0xCF,
+0x7B, 0x30, 0x8C, 0xF3, 0xA4, 0x71, 0xC0, 0xDB, 0xDE, 0x59, 0x71, 0x0D, 0xC0, 0x3C, 0xE7, 0x6C,
+0xC1, 0xD7, 0xBD, 0x38, 0xC6, 0x00, 0xC0, 0x7D, 0xF7, 0x71, 0x13, 0xA6, 0x7B, 0x00, 0xC1, 0xF9,
+0xBD, 0x9C, 0xCE, 0x7B, 0x4F, 0xC1, 0xFD, 0xD6, 0x77, 0xAD, 0x7B, 0x00, 0xAE, 0x6F, 0xC0, 0x56,
+0xA5, 0x54, 0x77, 0xC0, 0x5E, 0xE7, 0x6F, 0x63, 0x7B, 0x00, 0xC0, 0xDF, 0xFF, 0x71, 0x11, 0x92,
+0x7B, 0x43, 0xC0, 0xBF, 0xEF, 0x67, 0x63, 0xC0, 0x11, 0x84, 0x6F, 0x40, 0x7B, 0x00, 0x40, 0x91,
+0xC1, 0x5A, 0xC6, 0x9F, 0xEF, 0x43, 0xC0, 0x19, 0xBE, 0xBF, 0x64, 0x40, 0x7B, 0x00, 0x40, 0xC1,
+0x1A, 0xBE, 0xDC, 0xD6, 0x5C, 0xA6, 0x40, 0x77, 0x67, 0x40, 0x7B, 0x00, 0xC0, 0xB8, 0xB5, 0x7B,
+0x40, 0x00, 0x43, 0x63, 0x67, 0x43, 0xC4, 0x39, 0xCF, 0x56, 0xC7, 0x53, 0xAE, 0x8E, 0x7C, 0xEF,
+0x84, 0x91, 0xC0, 0xEF, 0x8C, 0x43, 0xC0, 0x94, 0xB6, 0x7A, 0xC0, 0x9A, 0xDF, 0x71, 0x1F, 0x70,
+0x00, 0x71, 0x04, 0xC1, 0x9A, 0xFE, 0x34, 0xFD, 0xAF, 0x2A, 0x76, 0x46, 0x71, 0x08, 0xA6, 0x5D,
+0x71, 0x00, 0x6C, 0x00, 0x71, 0x0D, 0xC3, 0x9E, 0xF7, 0x51, 0x8C, 0xB6, 0xB5, 0x59, 0xCE, 0xA5,
+0xC0, 0x7E, 0xF7, 0x71, 0x13, 0x6C, 0x7B, 0x00, 0xC1, 0xF5, 0x9C, 0x52, 0x84, 0x4B, 0x77, 0x47,
+0x4F, 0x40, 0x7B, 0x40, 0x91, 0xC0, 0xB4, 0x94, 0x64, 0x61, 0x6F, 0xC0, 0xF4, 0x9C, 0xA6, 0xC0,
+0x3E, 0xE7, 0x96, 0xC0, 0xDF, 0xFF, 0x71, 0x11, 0x92, 0x43, 0xC1, 0xF9, 0xBD, 0x93, 0x8C, 0x60,
+0x61, 0x7F, 0xC0, 0x31, 0x84, 0x5F, 0xC0, 0x5F, 0xE7, 0x7B, 0x40, 0x91, 0xC0, 0x73, 0x8C, 0xA5,
+0x5F, 0xC0, 0x76, 0xAD, 0x47, 0xC1, 0x56, 0xAD, 0x5E, 0xE7, 0x7B, 0x00, 0x43, 0x77, 0x47, 0x70,
+0x4B, 0x4C, 0xC1, 0x93, 0x94, 0xFD, 0xDE, 0x40, 0x7B, 0x40, 0xC0, 0xF5, 0x9C, 0x70, 0xC0, 0x5F,
+0xE7, 0x43, 0xC0, 0x56, 0xA5, 0x67, 0xC0, 0x1D, 0xDF, 0x40, 0xC2, 0x39, 0xCF, 0x76, 0xC7, 0xB1,
+0x9D, 0x91, 0xC0, 0xB7, 0xCF, 0xA6, 0x5D, 0xC1, 0x0F, 0x8D, 0x12, 0xA6, 0x44, 0x73, 0x71, 0x1F,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB7, 0xFD, 0x42, 0xAE, 0x2A, 0x42, 0xC1, 0x96, 0xFD,
+0xDF, 0xFF, 0x71, 0x1C, 0x75, 0xC1, 0xCF, 0x7B, 0xF7, 0xBD, 0x65, 0xA6, 0xC0, 0x7D, 0xEF, 0x71,
+0x13, 0xA6, 0x7B, 0x40, 0x91, 0x4C, 0xC0, 0x6A, 0x4A, 0xBA, 0xC0, 0x15, 0x9D, 0x4F, 0x95, 0x7B,
+0x00, 0x40, 0xC2, 0x9B, 0xCE, 0xD0, 0x7B, 0xCB, 0x5A, 0xBF, 0xC0, 0x35, 0xA5, 0x6F, 0x40, 0x7B,
+0xC0, 0xDF, 0xFF, 0x71, 0x11, 0x92, 0x7B, 0x40, 0xC1, 0x97, 0xAD, 0x0C, 0x63, 0x92, 0xC1, 0xAF,
+0x73, 0x3A, 0xC6, 0x40, 0x7B, 0x01, 0xBE, 0xC3, 0xBC, 0xCE, 0x8F, 0x73, 0x4A, 0x4A, 0xAB, 0x52,
+0x4B, 0xC1, 0x7F, 0xE7, 0x1E, 0xDF, 0x01, 0x40, 0x7B, 0xC1, 0xD4, 0x94, 0x6A, 0x52, 0x9A, 0xC1,
+0x72, 0x8C, 0x3E, 0xDF, 0xBA, 0x7B, 0x00, 0x40, 0xC0, 0xDC, 0xD6, 0x5B, 0xC0, 0xCB, 0x5A, 0xAF,
+0xC1, 0xB3, 0x94, 0xDD, 0xD6, 0x40, 0x7B, 0x57, 0xC0, 0x96, 0xC7, 0x56, 0xC2, 0xB1, 0x9D, 0xD7,
+0xCF, 0x76, 0xC7, 0x62, 0xC1, 0xEF, 0x84, 0x8E, 0x7C, 0x4E, 0xC0, 0x9A, 0xDF, 0x71, 0x1F, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0x47, 0x2A, 0x42, 0xAF, 0xC0, 0xBE, 0xFF,
+0x71, 0x08, 0xC1, 0x7D, 0xEF, 0x76, 0xB5, 0x55, 0xC1, 0xB6, 0xB5, 0xBE, 0xF7, 0x71, 0x0D, 0x49,
+0xC1, 0x6D, 0x73, 0x96, 0xB5, 0x65, 0xA2, 0x49, 0x71, 0x13, 0x6C, 0x7B, 0x00, 0xC1, 0x93, 0x8C,
+0x36, 0xA5, 0x7B, 0xC0, 0xBC, 0xD6, 0x6C, 0xA5, 0x7B, 0x40, 0x00, 0x7B, 0xC3, 0xF4, 0x9C, 0x31,
+0x84, 0x15, 0xA5, 0x73, 0x8C, 0x4C, 0x50, 0xC0, 0x3E, 0xE7, 0x7B, 0xC0, 0xDF, 0xFF, 0x71, 0x11,
+0x92, 0x40, 0x7F, 0x4C, 0xC0, 0x93, 0x8C, 0x57, 0x4C, 0x74, 0xC0, 0xBC, 0xCE, 0x40, 0x7B, 0x40,
+0xC2, 0xDC, 0xD6, 0x52, 0x84, 0x97, 0xB5, 0x43, 0xC3, 0x5B, 0xC6, 0x32, 0x84, 0xF5, 0x9C, 0x5F,
+0xE7, 0x7B, 0x00, 0x43, 0xC0, 0xF5, 0x9C, 0x95, 0xC0, 0xFD, 0xD6, 0x6F, 0x4F, 0xC2, 0x11, 0x84,
+0xDD, 0xD6, 0x3E, 0xDF, 0x7B, 0x43, 0xC0, 0x56, 0xA5, 0x47, 0x4F, 0x74, 0x47, 0x77, 0x40, 0x00,
+0xC6, 0x39, 0xCF, 0x76, 0xC7, 0xF2, 0x9D, 0x6B, 0x63, 0x50, 0x8D, 0xD1, 0x9D, 0x0F, 0x8D, 0x78,
+0x7E, 0x44, 0xC0, 0x9A, 0xDF, 0x71, 0x1F, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0xAE,
+0x00, 0xAF, 0x00, 0x4E, 0x53, 0x47, 0x4E, 0x53, 0x47, 0x53, 0x4E, 0x53, 0x47, 0x00, 0x53, 0x47,
+0x01, 0x53, 0x01, 0x47, 0x4E, 0x47, 0x12, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x08, 0xC4, 0xEF,
+0x83, 0xF7, 0xBD, 0xFB, 0xDE, 0x75, 0xAD, 0x51, 0x8C, 0x71, 0x0E, 0x79, 0xC0, 0x18, 0xC6, 0x65,
+0x60, 0xC0, 0x7D, 0xEF, 0x71, 0x13, 0xA6, 0x7B, 0x00, 0xC0, 0x5F, 0xE7, 0xBE, 0x4F, 0x57, 0x4F,
+0xC1, 0xF9, 0xB5, 0x1D, 0xDF, 0x40, 0x00, 0x91, 0x50, 0x7B, 0xC0, 0x7F, 0xE7, 0x00, 0xC0, 0x5A,
+0xC6, 0x68, 0x40, 0x7B, 0xC0, 0xDF, 0xFF, 0x71, 0x11, 0x92, 0x40, 0x78, 0xA6, 0x54, 0x00, 0x40,
+0x77, 0xC0, 0x3A, 0xBE, 0x43, 0x7B, 0x01, 0x54, 0x00, 0x4F, 0xC0, 0x9F, 0xEF, 0x7B, 0xC0, 0xF9,
+0xBD, 0x40, 0x7B, 0x01, 0x43, 0x5C, 0x4F, 0x54, 0x57, 0x5F, 0xC0, 0xDC, 0xD6, 0x40, 0x7B, 0x00,
+0x50, 0x67, 0x54, 0x00, 0xC0, 0x9C, 0xCE, 0x63, 0x6F, 0x40, 0xC2, 0x39, 0xCF, 0x35, 0xBF, 0x97,
+0xCF, 0x52, 0xC0, 0xEF, 0x84, 0xA6, 0xC2, 0x30, 0x8D, 0xD5, 0xB6, 0x76, 0xC7, 0x75, 0xC0, 0x9A,
+0xDF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0x4E, 0x81, 0xC0,
+0xAE, 0xA3, 0x96, 0xC2, 0xF3, 0xE4, 0x72, 0xCC, 0x35, 0xF5, 0x81, 0xC2, 0x51, 0xC4, 0x96, 0xFD,
+0x92, 0xCC, 0xBA, 0xC0, 0xF0, 0xB3, 0x42, 0x9A, 0xC1, 0xCF, 0xAB, 0x34, 0xED, 0x47, 0x4E, 0xC1,
+0x31, 0xC4, 0x4D, 0x93, 0x64, 0x7A, 0xC0, 0xEF, 0xB3, 0x47, 0x4E, 0x00, 0x47, 0x00, 0x4E, 0x00,
+0x47, 0x0B, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x08, 0xC0, 0xB2, 0x94, 0x55, 0xC0, 0x18, 0xC6,
+0x41, 0xBF, 0x71, 0x28, 0x6C, 0x7B, 0xC0, 0x5E, 0xE7, 0x4B, 0xC5, 0xF0, 0x7B, 0x72, 0x8C, 0x36,
+0xA5, 0xD0, 0x7B, 0xB3, 0x94, 0x3E, 0xDF, 0x01, 0xC0, 0x9B, 0xCE, 0x60, 0x54, 0x00, 0x4F, 0xC0,
+0x9F, 0xEF, 0x00, 0x7B, 0x00, 0x6C, 0x71, 0x11, 0x92, 0x4F, 0xC0, 0x35, 0xA5, 0x7C, 0xC0, 0x9F,
+0xEF, 0x4F, 0x54, 0x5C, 0x4F, 0x7B, 0x01, 0x43, 0x63, 0x73, 0x74, 0xC2, 0x15, 0x9D, 0xAF, 0x73,
+0x35, 0xA5, 0x4F, 0x7B, 0x00, 0x48, 0xC0, 0x3A, 0xBE, 0x78, 0xC0, 0x31, 0x84, 0x68, 0xC0, 0x11,
+0x84, 0x4C, 0xC0, 0xFD, 0xD6, 0x40, 0x00, 0xA5, 0xC0, 0x52, 0x84, 0x7B, 0xC0, 0x7F, 0xE7, 0x4F,
+0xBE, 0xAE, 0x40, 0x7B, 0xC0, 0x39, 0xCF, 0x49, 0x6A, 0xAE, 0xC6, 0xD7, 0xCF, 0x91, 0x95, 0x0C,
+0x6C, 0x6E, 0x7C, 0xF5, 0xB6, 0x55, 0xBF, 0x9A, 0xDF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0xC0, 0xB6, 0xFD, 0x42, 0xC4, 0x96, 0xFD, 0xB3, 0xD4, 0x8A, 0x6A, 0xCF, 0xAB, 0xEB, 0x82,
+0xBF, 0xC0, 0x92, 0xD4, 0x4D, 0xC0, 0x29, 0x5A, 0x53, 0xC0, 0x0C, 0x83, 0x46, 0xC1, 0x86, 0x39,
+0xF4, 0xE4, 0x80, 0xC1, 0x65, 0x39, 0xD3, 0xDC, 0x4E, 0x53, 0xC5, 0xCB, 0x7A, 0x8E, 0xA3, 0xAA,
+0x72, 0x31, 0xC4, 0xB3, 0xDC, 0x55, 0xF5, 0xA6, 0x45, 0x7F, 0x4E, 0x4F, 0x54, 0xC0, 0x75, 0xFD,
+0x0B, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x08, 0xC1, 0x18, 0xC6, 0x59, 0xCE, 0x60, 0xA5, 0x9A,
+0x71, 0x0D, 0xC0, 0x3C, 0xE7, 0x60, 0x51, 0x65, 0xC0, 0x7D, 0xEF, 0x71, 0x14, 0xA6, 0xC0, 0x1E,
+0xDF, 0x00, 0xC2, 0x2D, 0x63, 0x3A, 0xC6, 0x93, 0x94, 0x7C, 0xC1, 0xFD, 0xD6, 0x7F, 0xE7, 0x7B,
+0x00, 0x43, 0xC2, 0x9B, 0xCE, 0xAB, 0x52, 0x52, 0x8C, 0xAE, 0x00, 0x96, 0xC0, 0x15, 0x9D, 0x43,
+0x7B, 0xC0, 0xDF, 0xFF, 0x71, 0x11, 0x92, 0x82, 0xC2, 0xB3, 0x94, 0x0C, 0x63, 0x93, 0x8C, 0x60,
+0x00, 0x91, 0x73, 0x48, 0x7B, 0x43, 0xC0, 0x7B, 0xCE, 0x7C, 0xC1, 0xBC, 0xD6, 0xAF, 0x73, 0xBF,
+0xC0, 0x3E, 0xDF, 0xBF, 0x7B, 0x01, 0x4F, 0xC1, 0x8F, 0x73, 0x77, 0xAD, 0x00, 0xC2, 0xAB, 0x52,
+0x9B, 0xCE, 0x7F, 0xE7, 0x40, 0x7B, 0x40, 0x7B, 0xC1, 0xEC, 0x5A, 0x11, 0x7C, 0x60, 0x00, 0xA6,
+0x74, 0xC0, 0x1D, 0xDF, 0x43, 0x57, 0xC9, 0x96, 0xC7, 0xEC, 0x6B, 0xB1, 0x9D, 0xF5, 0xBE, 0x88,
+0x4A, 0xB4, 0xB6, 0x6E, 0x7C, 0xCF, 0x84, 0x76, 0xC7, 0x9A, 0xDF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0x53, 0x45, 0xC2, 0x4D, 0x93, 0x96, 0xFD, 0xCB, 0x7A,
+0x67, 0x4D, 0x95, 0xC2, 0xEB, 0x82, 0x92, 0xD4, 0x2C, 0x8B, 0x40, 0xC1, 0x49, 0x62, 0x30, 0xBC,
+0x46, 0xC2, 0x69, 0x62, 0xB3, 0xDC, 0x76, 0xFD, 0x00, 0xC0, 0x0C, 0x8B, 0x7A, 0xC0, 0xAE, 0xA3,
+0x91, 0xC3, 0xAF, 0xAB, 0xD3, 0xE4, 0x6A, 0x6A, 0xEB, 0x7A, 0x5B, 0x69, 0x70, 0xC0, 0x6E, 0x9B,
+0x7A, 0xC0, 0x75, 0xFD, 0x0A, 0xA6, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x06, 0xA6, 0xC4, 0x55, 0xAD,
+0x8A, 0x52, 0xF3, 0xA4, 0x35, 0xAD, 0x71, 0x94, 0x64, 0x71, 0x0C, 0xC2, 0xF7, 0xBD, 0x51, 0x8C,
+0x96, 0xB5, 0x51, 0x78, 0xC1, 0x30, 0x84, 0x79, 0xCE, 0x71, 0x13, 0x6C, 0xC0, 0x3E, 0xDF, 0xA1,
+0xC2, 0x4E, 0x6B, 0x31, 0x84, 0xAF, 0x73, 0x7C, 0xC1, 0x52, 0x8C, 0x93, 0x94, 0x7B, 0x00, 0x43,
+0xC2, 0x7B, 0xCE, 0x0C, 0x63, 0x19, 0xBE, 0xAB, 0x64, 0x00, 0xC0, 0x5A, 0xC6, 0x40, 0x7B, 0x6C,
+0x71, 0x11, 0x92, 0xC2, 0x5F, 0xE7, 0x93, 0x8C, 0x11, 0x84, 0x78, 0x91, 0x01, 0xC0, 0xBC, 0xD6,
+0x40, 0x7B, 0x43, 0xC2, 0x7B, 0xCE, 0x0D, 0x63, 0x72, 0x8C, 0x4B, 0xAE, 0xC2, 0x32, 0x84, 0x15,
+0x9D, 0x5E, 0xE7, 0x7B, 0x40, 0x48, 0xC0, 0xD0, 0x7B, 0xAE, 0x00, 0xC1, 0xEC, 0x5A, 0x52, 0x8C,
+0x9A, 0xC0, 0xDD, 0xD6, 0x40, 0x00, 0x74, 0x77, 0xC1, 0xB8, 0xB5, 0x3A, 0xC6, 0x64, 0x00, 0x73,
+0x7B, 0x00, 0xC0, 0x39, 0xCF, 0x49, 0xC6, 0x71, 0x95, 0xCC, 0x6B, 0x6B, 0x63, 0xCF, 0x84, 0xF8,
+0xD7, 0xAE, 0x84, 0x30, 0x8D, 0x49, 0xC1, 0x9A, 0xDF, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0xC2, 0x96, 0xFD, 0xD3, 0xDC, 0x28, 0x5A, 0x59, 0x6A, 0xC2,
+0x92, 0xD4, 0x2C, 0x8B, 0xAF, 0xAB, 0x7E, 0x6A, 0x9A, 0x40, 0x44, 0xBF, 0xBE, 0x7F, 0xC0, 0xB2,
+0xD4, 0x4E, 0xAE, 0xC0, 0xCB, 0x7A, 0x81, 0xC0, 0xAB, 0x7A, 0x40, 0xC4, 0x4D, 0x93, 0xB3, 0xD4,
+0xEB, 0x82, 0x96, 0xFD, 0x2D, 0x93, 0x5B, 0x82, 0xC1, 0x35, 0xED, 0x76, 0xFD, 0xA9, 0x0A, 0x42,
+0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x07, 0xC2, 0x5D, 0xEF, 0x59, 0xCE, 0x1C, 0xE7, 0x75, 0x44, 0x71,
+0x0D, 0xC2, 0x14, 0xA5, 0xB2, 0x9C, 0x1C, 0xE7, 0x75, 0x61, 0xC1, 0x50, 0x8C, 0xB6, 0xBD, 0x71,
+0x14, 0x48, 0x7B, 0x91, 0xC0, 0x7B, 0xCE, 0xAF, 0xAE, 0x47, 0x53, 0x7B, 0x00, 0xAE, 0xC1, 0xDC,
+0xD6, 0x77, 0xAD, 0x4A, 0x4F, 0x43, 0x48, 0x43, 0x7B, 0x48, 0x71, 0x12, 0xA6, 0x4F, 0xC2, 0xF9,
+0xB5, 0x3A, 0xC6, 0x7F, 0xE7, 0x43, 0x00, 0x48, 0x40, 0x7B, 0x02, 0xC0, 0xBC, 0xD6, 0x47, 0x53,
+0x00, 0x47, 0x58, 0x7B, 0x02, 0x95, 0x47, 0xAE, 0x58, 0x47, 0x00, 0x7B, 0x02, 0x77, 0x7B, 0x4F,
+0x43, 0x48, 0x43, 0x7B, 0x43, 0xC1, 0xBD, 0xEF, 0x35, 0xBF, 0xBF, 0xC0, 0x73, 0xAE, 0x92, 0x44,
+0x9A, 0xC1, 0x94, 0xAE, 0x15, 0xBF, 0x75, 0xC0, 0xDD, 0xEF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0xC3, 0x96, 0xFD, 0xB3, 0xDC, 0xEB, 0x82, 0x14, 0xED, 0x53,
+0xC1, 0x34, 0xED, 0x6A, 0x6A, 0x62, 0x45, 0x7D, 0x5A, 0xC1, 0x92, 0xD4, 0xAE, 0xA3, 0x7F, 0xC0,
+0x6D, 0x9B, 0x62, 0x45, 0x4E, 0x00, 0xC2, 0x0C, 0x83, 0x31, 0xC4, 0x75, 0xFD, 0x6B, 0xC1, 0x4D,
+0x93, 0xB3, 0xD4, 0x53, 0xC1, 0x96, 0xFD, 0x2C, 0x8B, 0x6B, 0xC2, 0xF0, 0xB3, 0x8A, 0x72, 0xF3,
+0xE4, 0x4E, 0x47, 0x09, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x1C, 0xC1, 0x18, 0xC6, 0xF3, 0x9C,
+0xBA, 0xC1, 0x55, 0xAD, 0x79, 0xCE, 0x71, 0x16, 0xC0, 0x7F, 0xE7, 0xA6, 0x04, 0xA5, 0x01, 0x4F,
+0x54, 0x43, 0x03, 0x54, 0x71, 0x14, 0x96, 0xC0, 0x7F, 0xEF, 0x4F, 0x95, 0x43, 0x06, 0x4F, 0x04,
+0x43, 0x02, 0x4F, 0x04, 0x43, 0x02, 0x54, 0x4F, 0x43, 0x01, 0x40, 0x48, 0xC0, 0xBF, 0xF7, 0x71,
+0xC1, 0xBB, 0xE7, 0x57, 0xCF, 0xAE, 0xAE, 0x92, 0x00, 0xAE, 0x4E, 0x42, 0x71, 0x20, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC2, 0xB6, 0xFD, 0x55, 0xFD, 0x96, 0xFD, 0x45, 0x7F, 0x53, 0x47, 0xAB,
+0xC0, 0x29, 0x5A, 0x5B, 0xC1, 0x55, 0xF5, 0x86, 0x41, 0x45, 0x91, 0x5B, 0xC0, 0x34, 0xED, 0xAB,
+0xC1, 0x0C, 0x8B, 0x92, 0xD4, 0x4E, 0x00, 0xC1, 0xEC, 0x82, 0xD3, 0xDC, 0x53, 0xC1, 0x14, 0xE5,
+0x2C, 0x8B, 0x45, 0xC0, 0x2D, 0x93, 0x53, 0x7F, 0xC0, 0x10, 0xBC, 0xAF, 0xC0, 0xCB, 0x7A, 0x4C,
+0xC0, 0x76, 0xFD, 0x47, 0x09, 0x42, 0x4E, 0xC1, 0xBE, 0xFF, 0xFF, 0xFF, 0x0A, 0xC1, 0xFB, 0xDE,
+0x5D, 0xEF, 0x71, 0x0D, 0xC0, 0x9E, 0xF7, 0x71, 0x00, 0xC2, 0x9A, 0xD6, 0xB6, 0xB5, 0xDB, 0xDE,
+0x71, 0x02, 0xA5, 0xA5, 0x10, 0xAE, 0x59, 0x10, 0x5E, 0x59, 0x13, 0x5E, 0x59, 0x23, 0x65, 0x71,
+0x02, 0x5D, 0x95, 0x00, 0xAE, 0xBF, 0x71, 0x22, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB6,
+0xFD, 0x42, 0x47, 0x81, 0xC0, 0xB3, 0xDC, 0x47, 0x00, 0xAB, 0x45, 0xC0, 0xF3, 0xE4, 0x47, 0xC1,
+0x72, 0xCC, 0x55, 0xF5, 0x6B, 0x54, 0xC0, 0x96, 0xFD, 0x00, 0x4F, 0x70, 0x47, 0x00, 0x4F, 0x7A,
+0x47, 0x7F, 0x54, 0xC0, 0x35, 0xED, 0x54, 0x4E, 0x54, 0x45, 0x6A, 0xC0, 0x51, 0xCC, 0x4E, 0x47,
+0x0A, 0x42, 0x4E, 0x60, 0x71, 0x06, 0x48, 0xC0, 0x96, 0xB5, 0x5D, 0xC2, 0x31, 0x8C, 0xD3, 0x9C,
+0x51, 0x8C, 0x7D, 0x71, 0x0C, 0xC0, 0x14, 0xA5, 0x79, 0xC3, 0x18, 0xC6, 0xEF, 0x83, 0xF7, 0xBD,
+0xCF, 0x7B, 0x60, 0x71, 0x00, 0xC1, 0x5A, 0xFF, 0xB4, 0xFE, 0xA6, 0x12, 0x72, 0x0E, 0x6D, 0x17,
+0x72, 0x22, 0xAF, 0xC0, 0x7B, 0xFF, 0x71, 0x00, 0xC1, 0x7D, 0xEF, 0x9A, 0xCE, 0x51, 0xA6, 0xC0,
+0x59, 0xCE, 0x61, 0xC0, 0xDF, 0xFF, 0x71, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x58, 0x42,
+0x47, 0x00, 0x53, 0x47, 0x01, 0x53, 0x4E, 0x47, 0x53, 0x47, 0x4E, 0x00, 0x47, 0x00, 0x53, 0x47,
+0x01, 0x53, 0x47, 0x01, 0x4E, 0x47, 0x4E, 0x47, 0x4E, 0x00, 0x53, 0x00, 0x47, 0x0B, 0x42, 0x4E,
+0xC0, 0xBE, 0xFF, 0x71, 0x06, 0x79, 0xC2, 0xEF, 0x83, 0x18, 0xC6, 0xCF, 0x7B, 0x49, 0xC0, 0xF7,
+0xC5, 0x74, 0x71, 0x0C, 0x50, 0xC1, 0x30, 0x8C, 0xAE, 0x73, 0x60, 0x71, 0xC0, 0x55, 0xAD, 0xA5,
+0x71, 0xC0, 0x9C, 0xFF, 0x66, 0x6D, 0x72, 0xAE, 0x7E, 0x77, 0x72, 0x05, 0x77, 0x72, 0x77, 0x00,
+0x72, 0x10, 0x77, 0x00, 0x72, 0x07, 0x77, 0x72, 0x07, 0x77, 0x72, 0x07, 0x77, 0x72, 0x19, 0x77,
+0x02, 0x72, 0x66, 0x72, 0x65, 0x71, 0x60, 0x7C, 0xC0, 0x34, 0xA5, 0x00, 0xC2, 0xD3, 0x94, 0x75,
+0xAD, 0x3C, 0xE7, 0x71, 0x21, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0x47, 0x0B, 0x4E,
+0x47, 0x05, 0x4E, 0x47, 0x4E, 0x47, 0x00, 0x4E, 0x47, 0x0F, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71,
+0x07, 0xC4, 0x38, 0xC6, 0x92, 0x94, 0x6D, 0x73, 0xF0, 0x83, 0xF3, 0x9C, 0x44, 0x71, 0x0C, 0xA6,
+0xC0, 0x79, 0xCE, 0x65, 0x6C, 0x71, 0xC0, 0xDB, 0xDE, 0x44, 0x71, 0xC0, 0x39, 0xFF, 0x66, 0x77,
+0xC1, 0x12, 0xE6, 0x50, 0xC5, 0xBA, 0xC0, 0xB1, 0xDD, 0x72, 0x03, 0x77, 0xC1, 0x32, 0xEE, 0xD1,
+0xDD, 0x6D, 0xC0, 0x71, 0xCD, 0xBE, 0x72, 0x02, 0x6D, 0x42, 0xC0, 0x53, 0xF6, 0x77, 0xAF, 0x72,
+0x04, 0x91, 0x72, 0x5E, 0xC0, 0x30, 0xC5, 0x4D, 0x6D, 0x72, 0x04, 0x77, 0x42, 0xC1, 0xB1, 0xD5,
+0x94, 0xF6, 0x72, 0x06, 0xC1, 0xD2, 0xDD, 0x53, 0xEE, 0x72, 0x02, 0x77, 0xC0, 0x33, 0xEE, 0x00,
+0x72, 0x61, 0x42, 0x77, 0x72, 0x03, 0x42, 0x6A, 0x7E, 0x6D, 0x59, 0x72, 0x02, 0x77, 0x7E, 0x77,
+0x00, 0x7E, 0x56, 0x6A, 0x72, 0x02, 0x6E, 0x45, 0x00, 0x61, 0x72, 0x00, 0xA5, 0xC3, 0x9B, 0xFF,
+0x9E, 0xEF, 0x9A, 0xCE, 0x18, 0xBE, 0x50, 0xC0, 0x55, 0xA5, 0x79, 0xAE, 0xC0, 0xDB, 0xD6, 0x71,
+0x21, 0x70, 0x00, 0x71, 0x04, 0x58, 0xC0, 0x55, 0xFD, 0x47, 0x03, 0x53, 0x4E, 0x47, 0x53, 0x4E,
+0x47, 0x53, 0x4E, 0xC0, 0xD3, 0xDC, 0x7F, 0x53, 0x47, 0x4E, 0x53, 0x7A, 0x99, 0x96, 0xBF, 0x68,
+0x47, 0x4E, 0x54, 0x7F, 0x4E, 0x01, 0x47, 0x0B, 0x42, 0x4E, 0x60, 0x71, 0x0B, 0x5C, 0xC0, 0xD7,
+0xBD, 0x71, 0x0C, 0xC2, 0x9A, 0xD6, 0x10, 0x84, 0x92, 0x94, 0xBE, 0x44, 0xC1, 0xB6, 0xBD, 0xF7,
+0xC5, 0x71, 0xC7, 0x39, 0xFF, 0xD4, 0xFE, 0xEF, 0xBC, 0xAC, 0x8B, 0x0D, 0x94, 0x88, 0x62, 0x8B,
+0x83, 0xCC, 0x8B, 0x56, 0x72, 0x00, 0x77, 0xC3, 0xB1, 0xD5, 0x6B, 0x83, 0x4D, 0xA4, 0x4A, 0x7B,
+0x41, 0x5D, 0xC1, 0x6E, 0xAC, 0xD5, 0xFE, 0x72, 0x00, 0x6A, 0xC0, 0xE9, 0x6A, 0x49, 0xC3, 0x0C,
+0x94, 0xCF, 0xB4, 0xD2, 0xDD, 0x94, 0xF6, 0x72, 0x01, 0xC0, 0xF2, 0xE5, 0x5D, 0x72, 0x49, 0xC0,
+0x8E, 0xAC, 0x41, 0x5D, 0x72, 0x01, 0x77, 0x41, 0x51, 0xC3, 0x0F, 0xBD, 0x4A, 0x7B, 0x0C, 0x94,
+0x6B, 0x7B, 0x51, 0x72, 0x00, 0x77, 0x66, 0x59, 0xC4, 0xEC, 0x93, 0x4D, 0x9C, 0x68, 0x5A, 0x0A,
+0x73, 0x71, 0xCD, 0x77, 0x72, 0x77, 0x4D, 0x75, 0x5D, 0x75, 0xC0, 0x2D, 0x9C, 0x75, 0x59, 0x77,
+0x72, 0x00, 0x5E, 0xC0, 0xAB, 0x8B, 0x00, 0x49, 0xC2, 0x30, 0xC5, 0x33, 0xEE, 0xAB, 0x8B, 0x77,
+0x72, 0x01, 0xC0, 0xD2, 0xDD, 0x45, 0xAE, 0x00, 0x4D, 0x68, 0xC0, 0xF2, 0xDD, 0x77, 0x72, 0x00,
+0xC0, 0x0D, 0x9C, 0xA9, 0xC0, 0xAE, 0xB4, 0x00, 0xC1, 0x4D, 0xA4, 0xCC, 0x8B, 0x5E, 0xBE, 0x46,
+0xC3, 0x9E, 0xF7, 0x18, 0xBE, 0x10, 0x84, 0x96, 0xB5, 0x61, 0xC1, 0x30, 0x84, 0x79, 0xCE, 0x5C,
+0xC0, 0xFF, 0xFF, 0x21, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xB6, 0xFD, 0x42, 0x47, 0x03, 0xC1, 0x92,
+0xD4, 0xF3, 0xE4, 0x7F, 0xC3, 0x72, 0xCC, 0xD3, 0xDC, 0x35, 0xF5, 0x71, 0xCC, 0x7F, 0xC0, 0xF0,
+0xB3, 0x40, 0x9A, 0x47, 0xC0, 0xF4, 0xE4, 0x7D, 0x40, 0xC0, 0x10, 0xBC, 0x6F, 0x4D, 0x95, 0xC0,
+0xB2, 0xD4, 0x00, 0x5A, 0xC0, 0x2D, 0x93, 0x6B, 0x54, 0xA6, 0xC0, 0x76, 0xFD, 0x47, 0x0A, 0x42,
+0x4E, 0x60, 0xC0, 0xFF, 0xFF, 0x0B, 0x91, 0x00, 0x71, 0x0C, 0xC0, 0x71, 0x8C, 0x4C, 0x71, 0xC3,
+0x59, 0xCE, 0x71, 0x94, 0xEB, 0x62, 0x96, 0xB5, 0x71, 0xC0, 0x39, 0xFF, 0x77, 0x49, 0xC1, 0xCF,
+0xB4, 0x94, 0xEE, 0x44, 0xC2, 0xB1, 0xDD, 0x0D, 0x9C, 0xEF, 0xBC, 0x43, 0x72, 0xAF, 0x76, 0x49,
+0xC2, 0x91, 0xD5, 0x88, 0x5A, 0xB1, 0xD5, 0x71, 0x51, 0x43, 0x72, 0x00, 0xC0, 0x53, 0xF6, 0x68,
+0x56, 0x75, 0xC2, 0xAE, 0xB4, 0xCC, 0x93, 0x2D, 0x9C, 0x72, 0x01, 0xC1, 0x33, 0xEE, 0x4A, 0x7B,
+0x5D, 0xC1, 0xC9, 0x6A, 0x70, 0xCD, 0x92, 0x75, 0xC0, 0x94, 0xF6, 0x72, 0x00, 0x7E, 0x75, 0xC0,
+0x8E, 0xAC, 0x54, 0x61, 0xC0, 0x56, 0xFF, 0x49, 0x76, 0x7E, 0x72, 0x00, 0x5E, 0xC3, 0x6E, 0xA4,
+0xCC, 0x8B, 0xEF, 0xB4, 0x2A, 0x7B, 0x76, 0x72, 0x01, 0x43, 0x65, 0x71, 0x51, 0x65, 0xC1, 0x36,
+0xFF, 0xAE, 0xB4, 0x6D, 0x43, 0x72, 0x77, 0x61, 0xC1, 0x2A, 0x73, 0x15, 0xFF, 0x56, 0x74, 0xC1,
+0x6A, 0x7B, 0x09, 0x73, 0x7E, 0x72, 0x00, 0x43, 0x75, 0x44, 0xC0, 0xAE, 0xAC, 0x55, 0x5A, 0xC1,
+0x88, 0x62, 0xD2, 0xDD, 0x77, 0x72, 0x6A, 0x6D, 0x4A, 0x51, 0x56, 0x66, 0x68, 0xC0, 0x12, 0xE6,
+0x72, 0x46, 0xC2, 0xBF, 0xF7, 0x75, 0xAD, 0xEF, 0x7B, 0x69, 0xA6, 0xC3, 0xAE, 0x73, 0x59, 0xC6,
+0xDB, 0xDE, 0xFF, 0xFF, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x58, 0xC0, 0x55, 0xFD, 0x47,
+0x03, 0xC2, 0xF0, 0xB3, 0x4D, 0x93, 0x51, 0xC4, 0x53, 0xC1, 0x8E, 0xA3, 0xF3, 0xE4, 0x5B, 0xC1,
+0xCF, 0xAB, 0x30, 0xBC, 0x53, 0x6A, 0xC0, 0x10, 0xBC, 0x7E, 0x53, 0xC0, 0x10, 0xB4, 0x6F, 0x00,
+0x6A, 0xC0, 0xEF, 0xB3, 0x53, 0x69, 0xC2, 0x8E, 0x9B, 0x2C, 0x8B, 0xB2, 0xD4, 0x53, 0x91, 0x5C,
+0x4E, 0x47, 0x09, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x06, 0x6C, 0xC1, 0x14, 0xA5, 0x72, 0x94,
+0x78, 0x63, 0x95, 0xC0, 0xDB, 0xDE, 0x71, 0x0C, 0xC1, 0xFB, 0xDE, 0x9A, 0xD6, 0x71, 0x00, 0x6C,
+0xC1, 0xF3, 0xA4, 0x1C, 0xE7, 0x71, 0xC0, 0x39, 0xFF, 0x72, 0xC0, 0x32, 0xE6, 0x79, 0x65, 0x76,
+0x43, 0x4A, 0xC0, 0x12, 0xE6, 0x72, 0x01, 0xA6, 0xC3, 0xCF, 0xB4, 0x6E, 0xAC, 0xD1, 0xDD, 0x6E,
+0xA4, 0x65, 0x6E, 0x77, 0x72, 0x00, 0x96, 0x76, 0x72, 0x43, 0xC0, 0x35, 0xFF, 0x43, 0xC0, 0xF2,
+0xE5, 0x6D, 0x72, 0x00, 0x77, 0x42, 0xC0, 0x8E, 0xAC, 0x65, 0xAE, 0x55, 0xC0, 0xB1, 0xDD, 0x72,
+0x02, 0xC0, 0x70, 0xCD, 0x55, 0xC2, 0xCF, 0xB4, 0x74, 0xF6, 0x15, 0xFF, 0x55, 0x42, 0x72, 0x02,
+0x43, 0xC2, 0x94, 0xF6, 0x50, 0xCD, 0xEC, 0x93, 0x75, 0x5E, 0x72, 0x01, 0x75, 0x66, 0x43, 0xA6,
+0x48, 0xC0, 0x0F, 0xC5, 0x4D, 0x77, 0x72, 0x00, 0x5E, 0x69, 0x6D, 0x43, 0xC0, 0x35, 0xFF, 0x76,
+0xC0, 0x0C, 0x9C, 0x77, 0x72, 0x00, 0x77, 0x66, 0x51, 0x4D, 0x01, 0x52, 0x56, 0x72, 0x01, 0x42,
+0xC0, 0x6D, 0xA4, 0x74, 0xAE, 0x41, 0x4A, 0x72, 0xA5, 0xC2, 0x9B, 0xFF, 0xBE, 0xF7, 0xF7, 0xBD,
+0x64, 0x95, 0x78, 0xC1, 0xF4, 0x9C, 0x79, 0xCE, 0x5C, 0x71, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0x58, 0xC0, 0x55, 0xFD, 0xAE, 0x01, 0x4E, 0xC1, 0xF4, 0xE4, 0xAF, 0xA3, 0x7F, 0xC1, 0x10,
+0xBC, 0x51, 0xCC, 0x55, 0x96, 0xC0, 0x8E, 0xA3, 0x5B, 0x4D, 0xC2, 0x2D, 0x93, 0xF3, 0xE4, 0x6E,
+0x9B, 0x55, 0xC0, 0x71, 0xCC, 0x82, 0x62, 0x6A, 0x53, 0xC0, 0xCF, 0xAB, 0xBE, 0xC0, 0x35, 0xF5,
+0x62, 0x46, 0xC1, 0xD3, 0xDC, 0x2C, 0x8B, 0x55, 0x6B, 0xC0, 0x76, 0xFD, 0x47, 0x09, 0x42, 0x4E,
+0x60, 0xC0, 0xFF, 0xFF, 0x06, 0xC7, 0x18, 0xC6, 0x10, 0x84, 0x3C, 0xE7, 0x0C, 0x63, 0x1C, 0xE7,
+0x59, 0xCE, 0xEF, 0x7B, 0xFF, 0xFF, 0x0C, 0xC0, 0xDB, 0xDE, 0xAE, 0xC0, 0x9E, 0xF7, 0x71, 0x00,
+0x5D, 0xC2, 0x9A, 0xD6, 0x5D, 0xEF, 0x59, 0xFF, 0x66, 0x43, 0x00, 0x7D, 0xC1, 0x0F, 0xBD, 0xAC,
+0x8B, 0x65, 0xC0, 0x33, 0xEE, 0x72, 0x00, 0xA6, 0x72, 0xC0, 0x35, 0xFF, 0x5E, 0xC2, 0x50, 0xCD,
+0x2D, 0x9C, 0xCC, 0x8B, 0x4A, 0x77, 0x72, 0x01, 0xC3, 0x15, 0xFF, 0x74, 0xF6, 0x91, 0xD5, 0x6E,
+0xA4, 0x49, 0x41, 0x72, 0x02, 0x48, 0x72, 0xC3, 0xB1, 0xD5, 0x8E, 0xAC, 0xCC, 0x93, 0xAE, 0xAC,
+0x77, 0x72, 0x00, 0x6D, 0x48, 0x43, 0xC0, 0x12, 0xE6, 0x69, 0xC1, 0xAB, 0x8B, 0x0C, 0x94, 0x56,
+0x72, 0x02, 0xAF, 0xC2, 0x33, 0xEE, 0x50, 0xCD, 0x0C, 0x9C, 0x49, 0x4D, 0x7E, 0x72, 0xA6, 0x43,
+0x00, 0x7D, 0x76, 0x60, 0x95, 0xC0, 0xD2, 0xDD, 0x77, 0x72, 0x01, 0x48, 0x56, 0x4D, 0x79, 0x5D,
+0xC0, 0xEF, 0xBC, 0x77, 0x72, 0x00, 0x6D, 0x48, 0x72, 0x66, 0x5A, 0x51, 0xC0, 0x0D, 0x9C, 0x5E,
+0x72, 0x01, 0x48, 0x77, 0xC0, 0xD1, 0xDD, 0x5A, 0xC0, 0xEC, 0x93, 0x41, 0x6D, 0xA9, 0xC3, 0x9B,
+0xFF, 0xBF, 0xF7, 0x55, 0xA5, 0x92, 0x94, 0x40, 0xC2, 0x96, 0xAD, 0xEF, 0x7B, 0x38, 0xC6, 0x5C,
+0xC0, 0xFF, 0xFF, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB6, 0xFD, 0x55, 0xFD, 0x47,
+0x01, 0x4E, 0xC0, 0x14, 0xE5, 0x62, 0x99, 0xC0, 0x71, 0xCC, 0xBF, 0x81, 0x91, 0x53, 0xC1, 0xCF,
+0xAB, 0x72, 0xCC, 0x7E, 0xC0, 0x2D, 0x93, 0x40, 0xC1, 0x30, 0xBC, 0xCB, 0x7A, 0x71, 0xC0, 0x10,
+0xB4, 0x69, 0x7E, 0x71, 0x92, 0xC0, 0x34, 0xED, 0x55, 0xC2, 0x8E, 0xA3, 0x92, 0xCC, 0xAF, 0xAB,
+0x7E, 0xC0, 0x55, 0xF5, 0x47, 0x0A, 0x42, 0xAF, 0xC1, 0xBE, 0xFF, 0xFF, 0xFF, 0x06, 0xC1, 0xFB,
+0xDE, 0x96, 0xB5, 0x71, 0xC0, 0x3C, 0xE7, 0x71, 0x61, 0xC0, 0x14, 0xA5, 0x71, 0x0C, 0x61, 0xC0,
+0x55, 0xAD, 0x7C, 0x91, 0x00, 0xC3, 0xF3, 0x9C, 0xB6, 0xB5, 0x9E, 0xF7, 0x59, 0xFF, 0x77, 0xC4,
+0xCF, 0xB4, 0xA8, 0x62, 0x0C, 0x94, 0x8E, 0xAC, 0x0A, 0x73, 0x77, 0x72, 0x01, 0x77, 0xC5, 0x12,
+0xE6, 0xE9, 0x6A, 0x6B, 0x83, 0xEF, 0xBC, 0xE9, 0x72, 0xB1, 0xDD, 0x43, 0x72, 0x02, 0x5D, 0x59,
+0x55, 0x5D, 0x74, 0x48, 0x72, 0x01, 0x96, 0x44, 0x68, 0xC0, 0xAE, 0xB4, 0x44, 0xC0, 0xAE, 0xAC,
+0x48, 0x72, 0x01, 0x77, 0x55, 0xC0, 0xA9, 0x62, 0x74, 0xC1, 0x6E, 0xAC, 0x2A, 0x7B, 0x43, 0x72,
+0x01, 0x77, 0xC1, 0xD2, 0xDD, 0xC9, 0x6A, 0x49, 0x71, 0x59, 0xC1, 0xF2, 0xE5, 0xD5, 0xFE, 0x72,
+0x00, 0x77, 0xC0, 0x71, 0xCD, 0x4C, 0x51, 0xC2, 0xCF, 0xB4, 0xE9, 0x6A, 0x53, 0xF6, 0x77, 0x72,
+0x01, 0x5E, 0xC0, 0x4A, 0x7B, 0x96, 0x69, 0x75, 0x71, 0x48, 0x72, 0x01, 0x77, 0xC0, 0x6D, 0xA4,
+0x4C, 0xC0, 0x2D, 0x9C, 0xBE, 0x44, 0x48, 0x72, 0x01, 0x77, 0xC0, 0xEC, 0x93, 0x54, 0xC1, 0x6E,
+0xA4, 0x0C, 0x94, 0xA2, 0x48, 0x72, 0x66, 0xC0, 0x9B, 0xFF, 0x58, 0xC0, 0x18, 0xBE, 0x7C, 0x95,
+0xC4, 0xF3, 0x9C, 0xEF, 0x7B, 0x59, 0xC6, 0xDB, 0xDE, 0xFF, 0xFF, 0x21, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC1, 0xB6, 0xFD, 0x55, 0xFD, 0x47, 0x03, 0x7F, 0x42, 0x47, 0x02, 0x7A, 0x47, 0x00,
+0x4E, 0x7F, 0xC4, 0x96, 0xFD, 0x72, 0xCC, 0x4D, 0x93, 0xF3, 0xE4, 0x96, 0xFD, 0x4E, 0x00, 0x47,
+0x01, 0x4E, 0x47, 0x42, 0x00, 0x85, 0x47, 0x0B, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x06, 0xC1,
+0x1C, 0xE7, 0x18, 0xC6, 0x70, 0xC0, 0xBE, 0xFF, 0x9A, 0x70, 0xC1, 0x38, 0xC6, 0x9A, 0xD6, 0x71,
+0x0E, 0xA6, 0x00, 0x71, 0x01, 0xC0, 0x39, 0xFF, 0x72, 0xC1, 0xD1, 0xDD, 0x4D, 0xA4, 0x79, 0x91,
+0x45, 0xC1, 0xB1, 0xD5, 0x94, 0xF6, 0x72, 0x01, 0x59, 0x5A, 0x79, 0x41, 0xC0, 0x88, 0x62, 0x55,
+0x56, 0x72, 0x02, 0xC0, 0x30, 0xC5, 0x79, 0x41, 0x75, 0x00, 0xC0, 0x12, 0xE6, 0x72, 0x01, 0xA6,
+0xC0, 0xEF, 0xBC, 0x79, 0x41, 0xC2, 0xE9, 0x72, 0xCC, 0x8B, 0x33, 0xE6, 0x72, 0x02, 0x66, 0x41,
+0x79, 0x5D, 0x4C, 0xC0, 0xD1, 0xD5, 0x6D, 0x72, 0x01, 0x56, 0x55, 0x79, 0x41, 0xC1, 0x88, 0x5A,
+0xCF, 0xB4, 0x5E, 0x72, 0x01, 0x42, 0x50, 0x79, 0x00, 0xC0, 0x68, 0x5A, 0x45, 0x5E, 0x72, 0x01,
+0x6D, 0x71, 0x79, 0x41, 0x54, 0x65, 0x56, 0x72, 0x02, 0xC0, 0x91, 0xD5, 0x41, 0x79, 0x51, 0x54,
+0xC0, 0xD2, 0xDD, 0x6D, 0x72, 0x01, 0xC0, 0x50, 0xCD, 0x79, 0x00, 0xC0, 0x6B, 0x7B, 0x91, 0xC0,
+0x12, 0xDE, 0x72, 0xA5, 0x46, 0xC2, 0x9E, 0xEF, 0x79, 0xCE, 0xD7, 0xB5, 0x00, 0xBE, 0xC3, 0xAE,
+0x73, 0x38, 0xC6, 0xDB, 0xDE, 0xFF, 0xFF, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x58, 0xC0,
+0x55, 0xFD, 0x47, 0x0F, 0x81, 0xA6, 0xC0, 0x76, 0xFD, 0x47, 0x16, 0x42, 0x4E, 0x60, 0x71, 0x06,
+0xC3, 0x9E, 0xF7, 0x18, 0xC6, 0x14, 0xA5, 0x92, 0x94, 0x00, 0xC2, 0xF3, 0x9C, 0xD7, 0xBD, 0x3C,
+0xE7, 0x71, 0x03, 0xC0, 0x5D, 0xEF, 0x75, 0x71, 0x0C, 0xC0, 0x7B, 0xFF, 0x66, 0x77, 0x43, 0x72,
+0xC0, 0x12, 0xE6, 0x45, 0x74, 0x42, 0x72, 0x02, 0x43, 0x77, 0x56, 0x61, 0xC0, 0x4D, 0xA4, 0x45,
+0x77, 0x72, 0x01, 0x77, 0x00, 0x6A, 0xC1, 0xD2, 0xDD, 0xCE, 0xB4, 0x41, 0xC0, 0x94, 0xFE, 0x72,
+0x01, 0x7E, 0x77, 0x5E, 0xC1, 0xB1, 0xDD, 0x8E, 0xAC, 0x00, 0x72, 0x01, 0x6D, 0x77, 0x7E, 0x72,
+0xC1, 0xF2, 0xE5, 0x2F, 0xC5, 0x74, 0xC0, 0x33, 0xEE, 0x72, 0x02, 0x43, 0x77, 0x56, 0xC1, 0x71,
+0xCD, 0x2D, 0x9C, 0x4D, 0x77, 0x72, 0x6D, 0x72, 0x43, 0x72, 0x51, 0xC0, 0x70, 0xCD, 0x79, 0xC0,
+0xB1, 0xD5, 0x77, 0x72, 0x01, 0xAF, 0x77, 0x5E, 0x66, 0x55, 0xBE, 0x77, 0x72, 0x00, 0x6D, 0x77,
+0x7E, 0x6D, 0x7D, 0x76, 0x79, 0x56, 0x72, 0x01, 0x77, 0x7E, 0x6D, 0x75, 0xC0, 0xEF, 0xB4, 0x41,
+0xC0, 0x93, 0xF6, 0x72, 0xC0, 0xDD, 0xFF, 0x58, 0x65, 0x64, 0x96, 0xA9, 0x64, 0xC1, 0x9A, 0xCE,
+0xDB, 0xDE, 0x71, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB6, 0xFD, 0x55, 0xFD, 0x47,
+0x10, 0x4E, 0x47, 0x17, 0x42, 0x4E, 0xC0, 0xBE, 0xFF, 0x71, 0x11, 0xC2, 0xFB, 0xDE, 0xEF, 0x83,
+0x51, 0x8C, 0x00, 0xC2, 0xEF, 0x7B, 0x79, 0xCE, 0xFF, 0xFF, 0x02, 0xC0, 0x79, 0xD6, 0x68, 0x4C,
+0xC0, 0x1C, 0xE7, 0x71, 0x03, 0xC0, 0x38, 0xFF, 0x6D, 0x01, 0x72, 0x77, 0x00, 0x72, 0x6D, 0x04,
+0x72, 0x77, 0x00, 0x72, 0x6D, 0x05, 0x77, 0x01, 0x6D, 0x04, 0x72, 0x77, 0x00, 0x72, 0x6D, 0x05,
+0x72, 0x77, 0x00, 0x6D, 0x05, 0x72, 0x77, 0x00, 0x72, 0x6D, 0x04, 0x72, 0x77, 0x00, 0x72, 0x6D,
+0x04, 0x72, 0x77, 0x00, 0x72, 0x6D, 0x05, 0x72, 0x77, 0x00, 0x6D, 0x05, 0x72, 0x77, 0x00, 0x72,
+0xC0, 0x5A, 0xFF, 0x71, 0x6C, 0x65, 0x55, 0xC0, 0x75, 0xAD, 0xBF, 0x81, 0x78, 0xC0, 0x3C, 0xE7,
+0x71, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x53, 0x42, 0x47, 0x2A, 0x42, 0x4E, 0x60, 0x71,
+0x11, 0x7B, 0x48, 0x71, 0x00, 0x44, 0xC1, 0xAE, 0x7B, 0xBE, 0xF7, 0x71, 0x01, 0x6C, 0xC0, 0xFB,
+0xDE, 0x4C, 0xC0, 0xF3, 0xA4, 0x54, 0xBE, 0x75, 0x71, 0x01, 0xA0, 0xA5, 0xE0, 0x1F, 0xC0, 0xDE,
+0xFF, 0x71, 0x01, 0xC1, 0x7D, 0xEF, 0x18, 0xBE, 0x69, 0x64, 0xC1, 0xB6, 0xB5, 0xDB, 0xDE, 0x71,
+0x22, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xB7, 0xFD, 0x42, 0x47, 0x2A, 0x42, 0x53, 0x6C, 0x71, 0x11,
+0xC2, 0x6D, 0x6B, 0x18, 0xC6, 0x59, 0xCE, 0x00, 0x79, 0xC1, 0x2D, 0x6B, 0x7D, 0xEF, 0x71, 0x02,
+0xC0, 0x9E, 0xF7, 0x7C, 0x64, 0xC1, 0x10, 0x84, 0xAE, 0x73, 0x61, 0x71, 0xE0, 0x51, 0x70, 0x00,
+0x71, 0x04, 0xC1, 0x9A, 0xFE, 0x34, 0xFD, 0x42, 0x2A, 0x76, 0xC0, 0x59, 0xFE, 0x71, 0x0B, 0x91,
+0x00, 0x6C, 0x71, 0x02, 0x60, 0x69, 0x78, 0x00, 0xA6, 0x4C, 0x71, 0x02, 0x48, 0xC0, 0x71, 0x94,
+0x69, 0xC1, 0xDB, 0xDE, 0x5D, 0xEF, 0x71, 0x02, 0x6C, 0x75, 0x96, 0xE0, 0x24, 0xBA, 0x02, 0x6D,
+0x75, 0x6C, 0x71, 0x20, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x6C, 0x57, 0xC0, 0xB6, 0xFD, 0x2A,
+0xC0, 0x79, 0xFE, 0x6C, 0x71, 0x09, 0x7D, 0x68, 0xC0, 0xF3, 0x9C, 0x70, 0xC0, 0x38, 0xC6, 0x71,
+0x02, 0x74, 0x7D, 0x4C, 0x60, 0x7D, 0x69, 0x71, 0x02, 0x5C, 0xC0, 0x31, 0x8C, 0x50, 0x64, 0x54,
+0xBE, 0x49, 0x71, 0x6C, 0xC0, 0xBA, 0xD6, 0x79, 0x45, 0x1E, 0x4D, 0x00, 0x45, 0x06, 0x48, 0x4D,
+0x45, 0x08, 0x48, 0x45, 0x11, 0x4D, 0x48, 0x45, 0x1D, 0x79, 0x4D, 0x6C, 0x71, 0x1F, 0x70, 0x00,
+0x71, 0x07, 0x6C, 0x28, 0x71, 0x0C, 0xC0, 0xEF, 0x7B, 0x4D, 0x6C, 0x5D, 0x6C, 0xAE, 0x02, 0xC0,
+0x1C, 0xE7, 0x4D, 0x7D, 0x40, 0xC1, 0xEB, 0x5A, 0x72, 0x94, 0x71, 0x02, 0xC1, 0x71, 0x8C, 0xB7,
+0xBD, 0x74, 0xC0, 0xAE, 0x7B, 0x6C, 0xC1, 0xD3, 0x9C, 0x34, 0xAD, 0x71, 0x44, 0x79, 0x4D, 0x79,
+0x48, 0x4D, 0xC0, 0x18, 0xBE, 0x48, 0x4D, 0x45, 0x01, 0x4D, 0x00, 0x79, 0xC0, 0xDB, 0xD6, 0x4D,
+0x45, 0x04, 0x4D, 0x03, 0x45, 0x02, 0x48, 0x4D, 0xC0, 0x18, 0xC6, 0x7D, 0xAF, 0xC0, 0x59, 0xC6,
+0x59, 0x45, 0x02, 0x59, 0x79, 0xC0, 0xF7, 0xBD, 0x00, 0x65, 0x59, 0x48, 0x45, 0x01, 0x4D, 0x79,
+0x71, 0x59, 0x51, 0x65, 0x4D, 0x45, 0x01, 0x79, 0x45, 0x59, 0x00, 0x4D, 0x45, 0x03, 0x4D, 0x48,
+0x01, 0x49, 0x51, 0x4D, 0x45, 0x02, 0x4D, 0x48, 0x59, 0x79, 0x65, 0x4D, 0x48, 0x45, 0x01, 0x59,
+0x01, 0x48, 0x71, 0x59, 0x45, 0x02, 0x4D, 0x45, 0x00, 0x4D, 0x5D, 0x45, 0x4D, 0x79, 0xC1, 0x5D,
+0xE7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3F, 0x58, 0xC0, 0x30, 0x84, 0x50, 0x7C,
+0x65, 0x71, 0x02, 0xC0, 0x79, 0xD6, 0x54, 0xA5, 0x78, 0xC1, 0x1C, 0xE7, 0xBE, 0xF7, 0x71, 0x02,
+0x51, 0x79, 0x71, 0xC0, 0x7D, 0xEF, 0x71, 0x7D, 0x65, 0x71, 0x75, 0x4D, 0x55, 0xC1, 0x4D, 0x6B,
+0xEF, 0x7B, 0xA6, 0xA5, 0x96, 0x65, 0x4D, 0x96, 0x4D, 0xC0, 0x59, 0xC6, 0x6C, 0x58, 0x40, 0x65,
+0xC2, 0xD7, 0xB5, 0x71, 0x8C, 0xDB, 0xD6, 0x45, 0x01, 0xC0, 0x18, 0xC6, 0x49, 0x00, 0x4C, 0x7D,
+0xC0, 0xAE, 0x73, 0x79, 0xBF, 0x00, 0x45, 0xC0, 0x31, 0x84, 0x6C, 0xC0, 0x30, 0x84, 0x40, 0x5D,
+0xC0, 0xB2, 0x94, 0x4D, 0x96, 0x00, 0x4D, 0xC0, 0x35, 0xA5, 0x5D, 0x91, 0xC0, 0x8A, 0x52, 0x58,
+0x54, 0x45, 0xBA, 0x45, 0x4D, 0xC0, 0xD7, 0xBD, 0x58, 0xC0, 0xEF, 0x7B, 0x01, 0xC0, 0x6E, 0x73,
+0x50, 0x59, 0x45, 0x59, 0xC0, 0xD3, 0x9C, 0x61, 0xC1, 0x30, 0x84, 0xF3, 0x9C, 0x51, 0x4D, 0x00,
+0x96, 0x00, 0x4D, 0x4C, 0x54, 0x48, 0xC0, 0xAF, 0x7B, 0x40, 0x6C, 0xC0, 0x71, 0x8C, 0x4D, 0x45,
+0x48, 0x4D, 0x6D, 0x74, 0xC0, 0x55, 0xA5, 0x49, 0x5D, 0x71, 0x79, 0x48, 0x00, 0x4D, 0x54, 0x71,
+0x59, 0x5D, 0xC1, 0x8A, 0x52, 0x92, 0x8C, 0x45, 0xBA, 0x45, 0x4D, 0x78, 0x44, 0x6C, 0x00, 0xA5,
+0x91, 0x51, 0x45, 0x75, 0xC0, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3D, 0xC0, 0xFB,
+0xDE, 0x00, 0x48, 0x69, 0x00, 0x64, 0x79, 0x71, 0x02, 0x68, 0x58, 0x7C, 0x64, 0xC1, 0xF3, 0xA4,
+0x34, 0xAD, 0x71, 0x07, 0xC1, 0x1C, 0xE7, 0xBE, 0xF7, 0x71, 0x75, 0x4D, 0x7F, 0x78, 0x41, 0x6C,
+0x70, 0xC0, 0xAE, 0x73, 0x7C, 0xC0, 0xDB, 0xD6, 0x45, 0x59, 0xC0, 0xD3, 0x94, 0x5D, 0x59, 0xC0,
+0x55, 0xA5, 0x5D, 0xA6, 0x00, 0xC0, 0xFB, 0xDE, 0x45, 0x48, 0x45, 0xC0, 0xEB, 0x5A, 0x5D, 0xC0,
+0x30, 0x84, 0x40, 0x95, 0xC1, 0x49, 0x4A, 0x79, 0xCE, 0x48, 0x4D, 0xC0, 0xD7, 0xBD, 0x61, 0xC0,
+0x18, 0xC6, 0x4D, 0x00, 0x78, 0x61, 0x79, 0x48, 0x00, 0x4D, 0xC1, 0x2C, 0x63, 0x55, 0xA5, 0x59,
+0xC0, 0x4D, 0x6B, 0x78, 0x58, 0x55, 0x59, 0x91, 0x59, 0x68, 0x71, 0x7D, 0x74, 0xC0, 0x38, 0xC6,
+0x41, 0x58, 0x59, 0x45, 0xC1, 0xDB, 0xDE, 0x30, 0x84, 0xAF, 0xC0, 0xD7, 0xB5, 0x68, 0x6C, 0x58,
+0x7D, 0x4D, 0x96, 0x4D, 0x49, 0x75, 0x61, 0xC0, 0x0C, 0x63, 0x65, 0x69, 0x70, 0x45, 0x48, 0x00,
+0x4D, 0x70, 0xC4, 0x35, 0xA5, 0xEB, 0x5A, 0x96, 0xAD, 0xFB, 0xDE, 0x2C, 0x63, 0x64, 0x59, 0x45,
+0x4D, 0xC0, 0xB3, 0x94, 0x75, 0xC1, 0x30, 0x84, 0x72, 0x8C, 0x70, 0xC1, 0xF7, 0xBD, 0x9A, 0xCE,
+0x01, 0x59, 0x5D, 0xC4, 0x14, 0x9D, 0x96, 0xAD, 0x6E, 0x6B, 0x1C, 0xDF, 0x30, 0x84, 0x54, 0x59,
+0xC1, 0x3C, 0xE7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3D, 0x61, 0x78, 0x48, 0xA6,
+0xC0, 0xDB, 0xDE, 0x48, 0xC0, 0x1C, 0xE7, 0x71, 0x02, 0x75, 0xC0, 0x9E, 0xF7, 0x71, 0x78, 0x55,
+0x79, 0x71, 0x07, 0x51, 0x61, 0x71, 0x75, 0xC2, 0xBA, 0xD6, 0x14, 0xA5, 0x18, 0xBE, 0x59, 0x91,
+0x4D, 0xC0, 0xB2, 0x94, 0x7D, 0x4D, 0x45, 0x4D, 0x4C, 0x6D, 0x61, 0xAF, 0x79, 0x6C, 0x68, 0x59,
+0x45, 0x00, 0x4D, 0x41, 0x79, 0x6D, 0x59, 0x4D, 0xC0, 0x55, 0xA5, 0x79, 0x48, 0x45, 0x4D, 0x61,
+0xC0, 0xEF, 0x83, 0x9A, 0x67, 0x6C, 0x7D, 0x4D, 0x45, 0x00, 0x4D, 0xC1, 0x96, 0xAD, 0xAE, 0x73,
+0x00, 0x54, 0x48, 0x61, 0x51, 0x4D, 0x45, 0x4D, 0xC0, 0x59, 0xC6, 0x40, 0x00, 0x41, 0x5D, 0x00,
+0x4C, 0x4D, 0x45, 0x4D, 0x50, 0x64, 0xC0, 0xFB, 0xDE, 0x5C, 0x59, 0x65, 0x71, 0x48, 0x45, 0x00,
+0x4D, 0x69, 0xC1, 0xEF, 0x7B, 0x0C, 0x63, 0x44, 0x40, 0x51, 0x4D, 0x45, 0x00, 0x4D, 0xC0, 0xB3,
+0x94, 0x40, 0x00, 0x65, 0x59, 0x68, 0xC0, 0xF8, 0xBD, 0x4D, 0x45, 0x00, 0x59, 0x45, 0xC0, 0x55,
+0xA5, 0x6C, 0xC0, 0x30, 0x84, 0x6D, 0x48, 0x9A, 0x00, 0x4D, 0xC0, 0x35, 0xA5, 0x69, 0x4D, 0x79,
+0x59, 0x41, 0x69, 0x4D, 0xC1, 0x3C, 0xE7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x05,
+0xA9, 0xC0, 0xD8, 0xFF, 0x99, 0x28, 0xBA, 0xC1, 0xFA, 0xFF, 0xFF, 0xFF, 0x08, 0x91, 0xC0, 0x34,
+0xAD, 0x68, 0xC2, 0xF3, 0xA4, 0xF7, 0xC5, 0x5D, 0xEF, 0x71, 0x02, 0xA6, 0xC3, 0xCF, 0x7B, 0x7D,
+0xEF, 0xFB, 0xDE, 0xAE, 0x7B, 0x79, 0x67, 0x44, 0x71, 0x01, 0x49, 0x41, 0x64, 0x54, 0xC0, 0x71,
+0x94, 0x64, 0xC0, 0xDF, 0xFF, 0x71, 0x75, 0x45, 0xA1, 0xC0, 0x51, 0x8C, 0x95, 0xC0, 0xD7, 0xB5,
+0x61, 0xC0, 0x55, 0xA5, 0x51, 0x4D, 0x96, 0x00, 0x4D, 0x41, 0xC0, 0xEF, 0x7B, 0x50, 0x59, 0x65,
+0x55, 0x4D, 0x45, 0x00, 0x4D, 0x49, 0x40, 0xC3, 0x92, 0x8C, 0x59, 0xC6, 0xBB, 0xD6, 0x14, 0x9D,
+0x79, 0x45, 0x00, 0xBE, 0xC0, 0x96, 0xAD, 0x40, 0x68, 0x79, 0x4D, 0xC0, 0x14, 0x9D, 0x45, 0x02,
+0x59, 0xA5, 0x79, 0x4D, 0x00, 0x50, 0xC0, 0x18, 0xBE, 0x4D, 0x45, 0x00, 0x4D, 0x59, 0x4D, 0x01,
+0x7D, 0x61, 0x4D, 0x45, 0x00, 0x4D, 0x00, 0x79, 0x45, 0x4D, 0x69, 0x00, 0x4D, 0x45, 0x01, 0x59,
+0x4D, 0x48, 0x4D, 0x74, 0x41, 0x4D, 0x45, 0x01, 0x59, 0x00, 0x4D, 0x45, 0x00, 0x41, 0xC0, 0x38,
+0xC6, 0x4D, 0x45, 0x00, 0x4D, 0x45, 0x4D, 0x79, 0x74, 0xC0, 0xB2, 0x94, 0x74, 0x48, 0x45, 0x00,
+0x59, 0x4D, 0x45, 0x00, 0x4D, 0x61, 0x7D, 0x4D, 0xC1, 0x3C, 0xE7, 0xFF, 0xFF, 0x1F, 0x70, 0x00,
+0x71, 0x04, 0xA8, 0xC1, 0xB2, 0xF7, 0x8E, 0xEF, 0xAB, 0x29, 0xAE, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF,
+0x0A, 0x48, 0xC2, 0x51, 0x8C, 0x08, 0x42, 0xF3, 0xA4, 0x71, 0x01, 0x91, 0xC1, 0x8E, 0x73, 0x7D,
+0xEF, 0x71, 0x01, 0xC0, 0xAE, 0x7B, 0x75, 0x71, 0x01, 0x6D, 0x55, 0x78, 0xC1, 0x4D, 0x6B, 0x1C,
+0xE7, 0x5C, 0x78, 0x71, 0x75, 0x4D, 0x58, 0xC0, 0x71, 0x8C, 0x69, 0xC0, 0xAE, 0x73, 0x6D, 0xC0,
+0x6D, 0x73, 0x55, 0xC0, 0xDB, 0xD6, 0x45, 0x59, 0x50, 0x44, 0x7D, 0xC0, 0x30, 0x84, 0x91, 0x68,
+0x5D, 0xC1, 0xFB, 0xDE, 0x9A, 0xCE, 0x4D, 0xC2, 0x59, 0xC6, 0xEB, 0x62, 0x55, 0xAD, 0x7C, 0x58,
+0xC1, 0x14, 0x9D, 0x0C, 0x63, 0x71, 0x48, 0xAE, 0x51, 0xC0, 0xEB, 0x62, 0x78, 0x6D, 0x5D, 0x41,
+0x70, 0x48, 0x45, 0x00, 0x59, 0x54, 0xC1, 0x6D, 0x6B, 0xEF, 0x7B, 0x00, 0x40, 0xC1, 0x08, 0x42,
+0x96, 0xAD, 0x59, 0x45, 0xC0, 0xDA, 0xD6, 0x75, 0xC0, 0x2C, 0x63, 0x71, 0x00, 0x40, 0xC0, 0xAA,
+0x5A, 0x5D, 0x61, 0x45, 0x59, 0x55, 0x75, 0x71, 0x00, 0x40, 0xC0, 0x69, 0x4A, 0x54, 0x61, 0x45,
+0x4D, 0xC0, 0x38, 0xC6, 0x44, 0xC0, 0xCF, 0x7B, 0x71, 0x00, 0x44, 0xC0, 0xAA, 0x52, 0x59, 0x45,
+0x00, 0xBE, 0x40, 0x4C, 0x71, 0x01, 0x60, 0xC0, 0xD7, 0xB5, 0x4D, 0x48, 0x4D, 0x6C, 0x58, 0x71,
+0x00, 0x6C, 0x60, 0x65, 0x4D, 0x45, 0x59, 0x41, 0xC0, 0x2C, 0x6B, 0x71, 0x00, 0x40, 0xC0, 0x49,
+0x4A, 0x6D, 0x59, 0xC1, 0x3C, 0xE7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC2,
+0xD7, 0xF7, 0x8E, 0xEF, 0xB0, 0xF7, 0x2A, 0xA9, 0x00, 0xC1, 0xFC, 0xFF, 0xFF, 0xFF, 0x06, 0x91,
+0xC0, 0x55, 0xAD, 0x68, 0x6D, 0x73, 0x4D, 0x5D, 0x71, 0x02, 0xC1, 0x38, 0xC6, 0xEF, 0x7B, 0x7C,
+0x00, 0x40, 0xC1, 0x96, 0xB5, 0xFF, 0xFF, 0x02, 0x64, 0xC1, 0x59, 0xCE, 0xDF, 0xFF, 0x61, 0x71,
+0x69, 0x7D, 0x71, 0x75, 0x4D, 0x40, 0xC1, 0x55, 0xA5, 0x1C, 0xDF, 0x4D, 0xC2, 0xB2, 0x94, 0x29,
+0x4A, 0x76, 0xAD, 0x59, 0x45, 0x59, 0x64, 0xC1, 0xF0, 0x7B, 0xFB, 0xDE, 0xA6, 0xC2, 0x96, 0xAD,
+0xCB, 0x5A, 0xCF, 0x7B, 0x61, 0x45, 0x48, 0x95, 0x58, 0xC0, 0x59, 0xC6, 0x61, 0xC0, 0x58, 0xC6,
+0x6C, 0xC0, 0x8A, 0x52, 0x79, 0xBF, 0x4D, 0xC0, 0x18, 0xC6, 0x58, 0x45, 0x61, 0xC2, 0x18, 0xBE,
+0x6D, 0x6B, 0xEB, 0x5A, 0x4D, 0x45, 0x00, 0x59, 0x54, 0xC0, 0xB3, 0x94, 0x79, 0x65, 0x71, 0x54,
+0xC0, 0xD7, 0xBD, 0x4D, 0x45, 0x4D, 0x7D, 0xC1, 0xAF, 0x73, 0x59, 0xCE, 0x65, 0x74, 0x55, 0xC0,
+0xD3, 0x94, 0x59, 0x45, 0x59, 0x55, 0x40, 0xC0, 0x79, 0xCE, 0x65, 0x74, 0x7C, 0xC0, 0x14, 0xA5,
+0x59, 0x45, 0x4D, 0x71, 0x58, 0x51, 0x71, 0x00, 0xC1, 0xD7, 0xB5, 0x51, 0x84, 0x4D, 0x45, 0x00,
+0x59, 0xC0, 0x30, 0x84, 0x41, 0x74, 0x65, 0x71, 0x45, 0xC0, 0xF7, 0xBD, 0x4D, 0x96, 0x4D, 0x6C,
+0xC0, 0x55, 0xAD, 0x71, 0x65, 0x00, 0xC0, 0x30, 0x84, 0x71, 0x48, 0x9A, 0x59, 0xC1, 0x14, 0x9D,
+0x30, 0x84, 0x79, 0x65, 0x79, 0x6D, 0x64, 0xC2, 0xBA, 0xD6, 0x3C, 0xE7, 0xFF, 0xFF, 0x1F, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5, 0xF7, 0x8F, 0xEF, 0x7B, 0x2B, 0xA9, 0x4E, 0x71, 0x06,
+0xC0, 0x9E, 0xF7, 0x60, 0xC0, 0x5D, 0xEF, 0x71, 0x07, 0x58, 0x4D, 0x48, 0xC0, 0x7D, 0xEF, 0x71,
+0x04, 0xA6, 0x71, 0x01, 0x91, 0x71, 0x00, 0x49, 0x79, 0x00, 0x96, 0x48, 0x00, 0x59, 0x71, 0x79,
+0x48, 0x9A, 0x00, 0x48, 0x71, 0x45, 0x00, 0x59, 0x79, 0x71, 0x48, 0x45, 0x00, 0x4D, 0xC0, 0x59,
+0xCE, 0x79, 0x48, 0x4D, 0x00, 0x65, 0x45, 0x01, 0x48, 0x71, 0x79, 0x45, 0x4D, 0x48, 0x65, 0x45,
+0x02, 0x48, 0x00, 0x4D, 0x02, 0x45, 0x02, 0x48, 0x45, 0x4D, 0x02, 0x48, 0x45, 0x01, 0x48, 0x45,
+0x4D, 0x02, 0x48, 0x45, 0x01, 0x48, 0x45, 0x4D, 0x03, 0x45, 0x02, 0x48, 0x00, 0x4D, 0x02, 0x45,
+0x02, 0x48, 0x00, 0x4D, 0x02, 0x45, 0x02, 0x48, 0x45, 0x4D, 0x02, 0x45, 0x79, 0x49, 0xC0, 0xFF,
+0xFF, 0x1F, 0x70, 0x00, 0x71, 0x04, 0x5E, 0xC0, 0x8F, 0xEF, 0x7B, 0x01, 0xAE, 0xBE, 0x00, 0x7B,
+0x00, 0x40, 0x7B, 0x02, 0x40, 0x7B, 0x04, 0xA6, 0x40, 0x00, 0x7B, 0x01, 0x40, 0x00, 0x7B, 0x06,
+0x40, 0x00, 0x7B, 0x05, 0xA9, 0x4E, 0x71, 0x24, 0xC0, 0x1C, 0xE7, 0x45, 0x00, 0xA6, 0x45, 0xE0,
+0x28, 0xC0, 0x1C, 0xDF, 0x71, 0x20, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x5E, 0x6C, 0x7B, 0x01,
+0xC2, 0x4D, 0xCE, 0x2B, 0xA5, 0xCC, 0xBD, 0x7B, 0xC1, 0x4F, 0xE7, 0xAC, 0xB5, 0x7B, 0x01, 0xAE,
+0x60, 0xAE, 0xC0, 0x6F, 0xEF, 0x00, 0x7B, 0x01, 0x40, 0xC0, 0x6E, 0xCE, 0x00, 0x40, 0x7B, 0x40,
+0xC0, 0xAE, 0xD6, 0x00, 0x40, 0x7B, 0x05, 0x7F, 0xC0, 0x4D, 0xC6, 0x65, 0x40, 0x7B, 0x03, 0x74,
+0x4E, 0x71, 0x25, 0xA2, 0x58, 0xE0, 0x29, 0xAE, 0x71, 0x21, 0x70, 0x00, 0x71, 0x04, 0x5E, 0xC0,
+0x8F, 0xEF, 0x7B, 0x00, 0x40, 0xC1, 0xC9, 0x7B, 0x6A, 0x8C, 0x91, 0xA6, 0xC0, 0x6F, 0xEF, 0x60,
+0x40, 0x67, 0x92, 0x40, 0x79, 0xC1, 0x0F, 0xDF, 0xEB, 0x9C, 0x77, 0x7B, 0x5A, 0x52, 0x48, 0xC0,
+0x4B, 0xAD, 0xAF, 0x48, 0x7B, 0x48, 0x42, 0xC0, 0x68, 0x6B, 0x48, 0xC0, 0x90, 0xEF, 0x00, 0x7B,
+0x73, 0x7B, 0x67, 0x52, 0x54, 0xC1, 0x8E, 0xCE, 0xCE, 0xD6, 0x48, 0x5A, 0x5F, 0x40, 0x7B, 0x00,
+0x74, 0x4E, 0xC0, 0xFF, 0xFF, 0x06, 0x95, 0x85, 0x95, 0x00, 0xA6, 0x02, 0x95, 0x09, 0xA6, 0x6D,
+0x02, 0x95, 0x6D, 0x00, 0x5E, 0xAB, 0xAE, 0xA9, 0x01, 0x96, 0x00, 0x5E, 0x00, 0xC0, 0x7B, 0xDF,
+0x6D, 0x05, 0x7C, 0x02, 0x41, 0xBA, 0xAB, 0x44, 0x41, 0x44, 0x4B, 0x00, 0x44, 0x4B, 0x50, 0xBA,
+0x00, 0x50, 0x53, 0x50, 0x53, 0x02, 0xAB, 0xAD, 0x53, 0x5A, 0x00, 0x53, 0x00, 0xAF, 0x53, 0x5F,
+0x00, 0x53, 0x5F, 0x00, 0x5A, 0x01, 0x53, 0x01, 0x5A, 0x53, 0x5A, 0x5F, 0x53, 0x50, 0x01, 0x53,
+0x50, 0x4B, 0x00, 0x44, 0x4B, 0x7C, 0x00, 0x99, 0x6D, 0x05, 0x7C, 0x00, 0x6D, 0x00, 0x7C, 0xA5,
+0x72, 0x7C, 0x41, 0x7C, 0x41, 0x00, 0x7C, 0x44, 0x00, 0x4B, 0x50, 0x53, 0x4B, 0x50, 0x53, 0x50,
+0x01, 0x53, 0x50, 0x53, 0x5A, 0x71, 0x20, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB5, 0xF7,
+0x6C, 0x7B, 0x00, 0x40, 0x54, 0xC2, 0xEE, 0xDE, 0xF1, 0xFF, 0xE9, 0x83, 0x77, 0xC0, 0x4C, 0xAD,
+0x67, 0x42, 0x00, 0xC1, 0x49, 0x84, 0xED, 0xBD, 0xBE, 0x42, 0xC2, 0x48, 0x6B, 0x4D, 0xC6, 0xAA,
+0x94, 0x42, 0x5D, 0x77, 0x92, 0x48, 0x7B, 0xC0, 0x2F, 0xE7, 0x54, 0xA6, 0xC0, 0x4F, 0xE7, 0x77,
+0xC0, 0x2D, 0xC6, 0x52, 0xC0, 0x0B, 0xA5, 0x73, 0xC0, 0xE9, 0x7B, 0x42, 0x95, 0x7F, 0x58, 0xC0,
+0x8E, 0xCE, 0x66, 0xBE, 0x46, 0x40, 0x7B, 0x74, 0x4E, 0xC0, 0xFF, 0xFF, 0x04, 0x81, 0xC1, 0x32,
+0x7E, 0xAE, 0x55, 0x95, 0xA1, 0xA6, 0x92, 0x96, 0xA9, 0xBA, 0x60, 0x01, 0xA6, 0x95, 0x5B, 0xA5,
+0xAB, 0xBE, 0x63, 0x4F, 0x56, 0x00, 0x98, 0xAF, 0xBA, 0x51, 0x60, 0x00, 0x51, 0x54, 0x9E, 0x00,
+0xBF, 0x99, 0x56, 0x54, 0x4C, 0xA6, 0x4F, 0x45, 0x00, 0x51, 0x00, 0x95, 0x51, 0x54, 0x03, 0x60,
+0x00, 0x63, 0x54, 0xAB, 0x63, 0x00, 0x5E, 0x54, 0x63, 0x00, 0xAE, 0x00, 0x63, 0x5E, 0xBE, 0x5E,
+0x63, 0x00, 0xBF, 0x01, 0xA9, 0x6F, 0xA6, 0xBA, 0x00, 0x63, 0x6A, 0x72, 0x6B, 0x6A, 0x72, 0x6A,
+0x63, 0x68, 0x66, 0x63, 0x5E, 0x63, 0x68, 0x6F, 0x68, 0x63, 0x01, 0x68, 0x63, 0x5E, 0x63, 0x02,
+0x54, 0x4C, 0x51, 0xC0, 0xAA, 0x44, 0x4F, 0x4C, 0x5B, 0x60, 0x00, 0xA9, 0x51, 0x54, 0x59, 0xA5,
+0xAE, 0x59, 0x54, 0x59, 0x60, 0x63, 0x60, 0x00, 0x54, 0x57, 0x5E, 0x63, 0x68, 0x6F, 0xBE, 0x68,
+0xAE, 0x68, 0x6D, 0xBE, 0x00, 0x41, 0x9E, 0xBE, 0xC1, 0xCE, 0x55, 0x7C, 0xD7, 0x71, 0x1F, 0x70,
+0x00, 0x71, 0x04, 0xC0, 0xB5, 0xF7, 0x6C, 0x7B, 0x00, 0x40, 0xC2, 0x29, 0x84, 0xAE, 0xD6, 0xF1,
+0xFF, 0x49, 0xA5, 0xAB, 0xC0, 0xCC, 0xB5, 0x49, 0x5F, 0xC1, 0xC9, 0x7B, 0x2B, 0xA5, 0x7C, 0xC0,
+0x4B, 0xA5, 0x58, 0x48, 0xC3, 0x6D, 0xCE, 0xAA, 0x94, 0x4A, 0x8C, 0xAC, 0xB5, 0x92, 0x48, 0x00,
+0xC0, 0xED, 0xBD, 0x56, 0xBE, 0xC0, 0x0D, 0xBE, 0x6A, 0x7F, 0x46, 0x75, 0x50, 0x44, 0x5F, 0x42,
+0x5B, 0x77, 0xC1, 0x6A, 0x8C, 0x8E, 0xD6, 0x77, 0x44, 0x48, 0x7B, 0xA9, 0x4E, 0x71, 0x04, 0xC1,
+0x5A, 0xD7, 0x4B, 0x3D, 0x94, 0xC5, 0x4A, 0x5D, 0x0A, 0x95, 0xEA, 0xA4, 0xC9, 0x8C, 0x48, 0x54,
+0x48, 0x34, 0xAB, 0x01, 0x99, 0xC2, 0x69, 0x44, 0xAA, 0x84, 0xCA, 0xA4, 0x82, 0xC0, 0x49, 0x5C,
+0x7B, 0x00, 0x95, 0xBA, 0x99, 0xC1, 0x68, 0x34, 0xEA, 0x74, 0x75, 0xAE, 0xC0, 0x89, 0x6C, 0x74,
+0x6C, 0x00, 0xA5, 0x00, 0x74, 0xC0, 0xCA, 0x6C, 0x75, 0xBA, 0xC1, 0x89, 0x7C, 0x08, 0x34, 0x99,
+0x00, 0x65, 0x60, 0x65, 0xC1, 0xC9, 0x5C, 0xCA, 0x8C, 0x70, 0xC2, 0x89, 0x74, 0x48, 0x3C, 0x07,
+0x24, 0xB6, 0x60, 0x00, 0x99, 0xC1, 0x88, 0x4C, 0xA9, 0x84, 0xB5, 0x9A, 0xC0, 0x47, 0x4C, 0x56,
+0xA6, 0x5B, 0xA9, 0x51, 0xC2, 0x47, 0x3C, 0x69, 0x74, 0x69, 0x94, 0x9A, 0xC0, 0x27, 0x5C, 0x60,
+0x96, 0x51, 0x54, 0x51, 0x65, 0xC1, 0x69, 0x6C, 0x49, 0x8C, 0x96, 0x77, 0xC0, 0xE6, 0x2B, 0x96,
+0x51, 0x4C, 0x00, 0x56, 0xC1, 0x68, 0x5C, 0x29, 0x7C, 0xA5, 0xC1, 0x08, 0x64, 0xE6, 0x33, 0x4C,
+0x00, 0xAE, 0x01, 0xC1, 0x48, 0x4C, 0x28, 0x7C, 0xBA, 0x8A, 0xC0, 0x07, 0x44, 0x51, 0x60, 0x01,
+0x56, 0xC2, 0x47, 0x44, 0x69, 0x84, 0x49, 0x94, 0x89, 0xC0, 0x27, 0x54, 0x5B, 0xAF, 0x65, 0x67,
+0x65, 0xC2, 0x68, 0x3C, 0x89, 0x7C, 0x68, 0x94, 0x9A, 0xC1, 0x48, 0x64, 0x27, 0x34, 0x6C, 0x00,
+0xA5, 0x65, 0xBF, 0xC0, 0x68, 0x6C, 0x5C, 0xA9, 0xC1, 0x48, 0x6C, 0x27, 0x3C, 0x6C, 0x00, 0x65,
+0x60, 0xC1, 0x47, 0x2C, 0x88, 0x5C, 0x5A, 0x00, 0x8E, 0xC4, 0xE8, 0x4C, 0x08, 0x2D, 0x4A, 0x35,
+0x5A, 0xC7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5, 0xF7, 0x8F, 0xEF,
+0xBF, 0x00, 0xAE, 0xC2, 0x29, 0x84, 0xEE, 0xDE, 0xF1, 0xFF, 0x54, 0xC1, 0x6C, 0xAD, 0xEB, 0x9C,
+0x6A, 0xBE, 0xC0, 0xF0, 0xFF, 0x5C, 0xC0, 0x4B, 0xA5, 0x7F, 0xC3, 0x2B, 0xA5, 0x6D, 0xCE, 0xAE,
+0xD6, 0x09, 0x84, 0x56, 0x63, 0xC0, 0xAC, 0xB5, 0x6A, 0x48, 0x00, 0x63, 0xC0, 0x07, 0x63, 0xAF,
+0xC1, 0x6A, 0x8C, 0x8C, 0xAD, 0x50, 0xC1, 0x0F, 0xDF, 0xCB, 0x9C, 0x72, 0x00, 0x48, 0x63, 0xC0,
+0x4B, 0xAD, 0x77, 0x63, 0xC2, 0x6F, 0xEF, 0x6E, 0xCE, 0x8A, 0x94, 0x48, 0x7B, 0xA9, 0xC0, 0xFA,
+0xFF, 0x71, 0x04, 0xC3, 0x5A, 0xCF, 0x2B, 0x35, 0x6B, 0x65, 0x6C, 0xC5, 0xB2, 0xC0, 0xEF, 0xDD,
+0xBF, 0xC2, 0x0C, 0xBD, 0x08, 0x54, 0x48, 0x2B, 0xA1, 0x95, 0xC1, 0x08, 0x44, 0x4C, 0xB5, 0x6C,
+0xC5, 0x8E, 0xD5, 0xF0, 0xE5, 0x2D, 0xCD, 0x49, 0x6C, 0x68, 0x2B, 0xC6, 0x22, 0x00, 0xC7, 0x87,
+0x2B, 0x2C, 0x95, 0x0B, 0xC5, 0x8E, 0xCD, 0x10, 0xDE, 0x6E, 0xD5, 0x89, 0x84, 0x67, 0x2B, 0x64,
+0xA1, 0xC1, 0x26, 0x23, 0x0B, 0x85, 0x5D, 0x6C, 0xC4, 0xEE, 0xDD, 0x4D, 0xCD, 0x6A, 0x94, 0x86,
+0x33, 0xA5, 0x1A, 0xA2, 0xC1, 0xE5, 0x1A, 0xCB, 0x6C, 0x61, 0xB6, 0xC0, 0xEF, 0xD5, 0x49, 0xC2,
+0x8B, 0x9C, 0xC7, 0x3B, 0xC5, 0x1A, 0xA2, 0x5A, 0xC1, 0x49, 0x4C, 0x2C, 0xBD, 0xB1, 0x49, 0xBE,
+0xC3, 0xAA, 0xB4, 0xE7, 0x53, 0x05, 0x23, 0xA5, 0x22, 0x55, 0x5C, 0xC2, 0xEB, 0xA4, 0xEB, 0xBC,
+0x4E, 0xCD, 0xBE, 0xC2, 0xAB, 0xB4, 0x08, 0x6C, 0x06, 0x23, 0x53, 0x50, 0xC4, 0x87, 0x2B, 0xEB,
+0x8C, 0xEB, 0xC4, 0x2D, 0xC5, 0x8F, 0xCD, 0x48, 0xC2, 0x08, 0x74, 0x25, 0x2B, 0x85, 0x1A, 0x00,
+0x67, 0xC4, 0xAA, 0x74, 0xCC, 0xB4, 0x0D, 0xC5, 0xAF, 0xD5, 0xCC, 0xBC, 0x4F, 0xC0, 0x66, 0x33,
+0x50, 0x00, 0xC8, 0xE5, 0x1A, 0x69, 0x5C, 0xCB, 0xBC, 0xED, 0xC4, 0x8F, 0xD5, 0xEC, 0xC4, 0x29,
+0x94, 0xA6, 0x43, 0xC5, 0x1A, 0xB7, 0x64, 0xC3, 0x08, 0x44, 0xEB, 0xAC, 0xEC, 0xC4, 0x6E, 0xCD,
+0xB9, 0xC2, 0x6A, 0xAC, 0xC7, 0x5B, 0xE6, 0x22, 0xA2, 0x99, 0xC2, 0xC7, 0x33, 0xEB, 0x9C, 0x2D,
+0xD5, 0x47, 0x99, 0xC2, 0x8A, 0xB4, 0x28, 0x74, 0x86, 0x2B, 0x64, 0x5F, 0x45, 0xC0, 0xCA, 0x84,
+0x78, 0xC0, 0x8E, 0xD5, 0xA9, 0xC1, 0xCB, 0xC4, 0x48, 0x8C, 0x43, 0x5F, 0x00, 0x73, 0xC2, 0x89,
+0x6C, 0x2C, 0xC5, 0x6E, 0xD5, 0x4C, 0xC5, 0xEB, 0xC4, 0x69, 0x9C, 0xE8, 0x4C, 0x29, 0x35, 0x39,
+0xC7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5, 0xF7, 0x8F, 0xEF, 0x7B,
+0x00, 0xAE, 0xC1, 0xA9, 0x7B, 0xCA, 0x9C, 0x75, 0xC0, 0xC9, 0x7B, 0x7E, 0xC0, 0x4A, 0x8C, 0x79,
+0xC0, 0xA9, 0x73, 0x49, 0xC1, 0x88, 0x73, 0x2B, 0xA5, 0x77, 0x92, 0xC0, 0x8A, 0x94, 0x6A, 0xC0,
+0x6A, 0x8C, 0x56, 0x42, 0x77, 0xC2, 0x4C, 0xAD, 0xF0, 0xFF, 0x4F, 0xE7, 0x6E, 0x7E, 0xBF, 0x42,
+0x5B, 0x68, 0x70, 0xC0, 0x29, 0x84, 0x7E, 0x42, 0x65, 0xC0, 0x48, 0x6B, 0x56, 0x77, 0x56, 0xC0,
+0xCA, 0x94, 0x54, 0x77, 0x48, 0x7B, 0xA9, 0xC0, 0xFA, 0xFF, 0x71, 0x04, 0xCA, 0x39, 0xC7, 0x2B,
+0x3D, 0x0E, 0xB6, 0xEE, 0xE5, 0x92, 0xE6, 0x9B, 0xFF, 0xBD, 0xFF, 0xD5, 0xF6, 0x8A, 0x9C, 0xC7,
+0x2A, 0x47, 0x22, 0x9D, 0xC8, 0x2C, 0x8D, 0x2F, 0xEE, 0x71, 0xE6, 0x58, 0xF7, 0x9B, 0xF7, 0xF6,
+0xF6, 0x0C, 0xB5, 0xE6, 0x32, 0xE5, 0x19, 0x9E, 0xC2, 0x4A, 0x5C, 0xEE, 0xD5, 0x30, 0xDE, 0x64,
+0x43, 0xD0, 0x37, 0xF7, 0x8E, 0xCD, 0x67, 0x43, 0x25, 0x1A, 0xC4, 0x11, 0xA8, 0x43, 0x0E, 0xCE,
+0x2F, 0xE6, 0x17, 0xF7, 0x9A, 0xF7, 0x17, 0xEF, 0xAF, 0xD5, 0xA7, 0x5B, 0x04, 0x12, 0xA4, 0x11,
+0x27, 0x33, 0xCE, 0xB5, 0x76, 0xC0, 0xD5, 0xEE, 0x43, 0xC2, 0x39, 0xF7, 0xF1, 0xDD, 0x09, 0x74,
+0x4B, 0x63, 0xC4, 0x85, 0x1A, 0x2C, 0x9D, 0x0F, 0xD6, 0xF5, 0xEE, 0x7A, 0xF7, 0xA5, 0xC5, 0x11,
+0xDE, 0x89, 0x94, 0xA5, 0x22, 0xE4, 0x11, 0x25, 0x12, 0xAA, 0x7C, 0x5B, 0xC0, 0xB4, 0xE6, 0x77,
+0xA6, 0xC1, 0x12, 0xDE, 0xAB, 0xAC, 0x6F, 0x68, 0x6D, 0xC2, 0x29, 0x5C, 0xCE, 0xCD, 0xD4, 0xEE,
+0x6B, 0x77, 0xC2, 0x94, 0xE6, 0xEC, 0xBC, 0x46, 0x4B, 0x6D, 0x68, 0xC1, 0x67, 0x3B, 0x4D, 0xB5,
+0x64, 0x77, 0x43, 0xC3, 0xB6, 0xEE, 0xED, 0xBC, 0xA7, 0x63, 0x04, 0x12, 0x68, 0xC1, 0xE6, 0x2A,
+0x2C, 0xA5, 0x56, 0x6B, 0xC9, 0xBB, 0xFF, 0xD5, 0xEE, 0x4D, 0xCD, 0xE8, 0x7B, 0x44, 0x1A, 0xC5,
+0x19, 0x65, 0x1A, 0xAA, 0x8C, 0x71, 0xDE, 0x58, 0xF7, 0x43, 0xC4, 0x37, 0xF7, 0xAE, 0xD5, 0x49,
+0x94, 0xA5, 0x22, 0xE4, 0x19, 0x7E, 0xC0, 0x49, 0x64, 0x67, 0x64, 0x43, 0x64, 0xC3, 0xCE, 0xD5,
+0x8A, 0xAC, 0x26, 0x3B, 0x05, 0x12, 0x6D, 0xC0, 0xA8, 0x4B, 0x53, 0xC1, 0x78, 0xF7, 0xBB, 0xFF,
+0x90, 0xC3, 0x51, 0xE6, 0xEC, 0xC4, 0x67, 0x5B, 0x05, 0x1A, 0xA2, 0xC3, 0x26, 0x33, 0x6B, 0xBD,
+0x36, 0xF7, 0xDD, 0xFF, 0x4B, 0xC5, 0x93, 0xE6, 0xEB, 0xC4, 0xE9, 0x84, 0xE8, 0x2C, 0x19, 0xBF,
+0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5, 0xF7, 0x8F, 0xEF, 0xBF, 0x00,
+0xAE, 0xC3, 0xED, 0xBD, 0xAA, 0x94, 0x4B, 0xAD, 0x6F, 0xEF, 0x00, 0xC0, 0x4D, 0xC6, 0x40, 0xC3,
+0x2D, 0xC6, 0x0B, 0xA5, 0xE9, 0x7B, 0xCE, 0xD6, 0xBA, 0x67, 0x51, 0xC1, 0xAE, 0xD6, 0x2B, 0xA5,
+0x51, 0xC0, 0x6D, 0xCE, 0x41, 0x7E, 0x40, 0xC0, 0x2F, 0xE7, 0x58, 0x40, 0x00, 0x58, 0xC0, 0x0F,
+0xDF, 0x51, 0x56, 0xC3, 0x6E, 0xCE, 0xD0, 0xFF, 0x8C, 0xAD, 0xCB, 0x9C, 0x58, 0x79, 0x41, 0xC0,
+0x8F, 0xEF, 0x75, 0x56, 0x7B, 0x01, 0x74, 0x4E, 0x71, 0x04, 0xC4, 0x19, 0xC7, 0x2B, 0x45, 0x4E,
+0xC6, 0x4F, 0xE6, 0x9A, 0xF7, 0x71, 0x00, 0xC5, 0xDB, 0xFF, 0x4D, 0xBD, 0xC7, 0x32, 0x46, 0x22,
+0x86, 0x22, 0xCE, 0xAD, 0x77, 0xC1, 0x58, 0xF7, 0xBD, 0xF7, 0x00, 0xBD, 0xC2, 0xF0, 0xD5, 0xE6,
+0x42, 0xE5, 0x11, 0x00, 0xC2, 0xCB, 0x7C, 0x0F, 0xDE, 0x36, 0xF7, 0x56, 0xA9, 0xBF, 0xC2, 0xB3,
+0xE6, 0xC8, 0x5B, 0x25, 0x12, 0x68, 0xC2, 0x29, 0x5C, 0x0F, 0xD6, 0x15, 0xEF, 0x4F, 0x56, 0x5E,
+0x7D, 0xC4, 0x09, 0x7C, 0x04, 0x12, 0xA4, 0x11, 0x88, 0x43, 0xEE, 0xC5, 0x7D, 0xC0, 0xBC, 0xFF,
+0x56, 0xBF, 0x64, 0xC1, 0x8B, 0x94, 0x64, 0x1A, 0x68, 0xC1, 0xC5, 0x22, 0x8C, 0xAD, 0x62, 0x52,
+0xC0, 0xBE, 0xF7, 0x65, 0xC2, 0x79, 0xF7, 0x2C, 0xAD, 0xA5, 0x2A, 0x68, 0xC3, 0x45, 0x1A, 0x0C,
+0x95, 0x51, 0xDE, 0xBC, 0xFF, 0x65, 0x00, 0x7C, 0xC1, 0xAE, 0xCD, 0x06, 0x4B, 0x68, 0x6D, 0xC2,
+0x6A, 0x74, 0x30, 0xD6, 0xBB, 0xF7, 0x56, 0xA6, 0xBC, 0xC1, 0x10, 0xDE, 0x67, 0x63, 0x6D, 0x63,
+0xC1, 0xA8, 0x4B, 0xAE, 0xBD, 0x7C, 0x65, 0x5E, 0x52, 0xC1, 0x92, 0xE6, 0x09, 0x84, 0x72, 0x63,
+0xC2, 0x06, 0x33, 0x6C, 0xAD, 0x37, 0xEF, 0x65, 0x00, 0x94, 0xC2, 0xB2, 0xE6, 0x8A, 0x9C, 0x65,
+0x22, 0x63, 0x4E, 0xC2, 0x0B, 0x9D, 0xD5, 0xE6, 0xFE, 0xFF, 0x96, 0xB5, 0xC7, 0xF4, 0xEE, 0x2C,
+0xBD, 0xC5, 0x32, 0xA4, 0x11, 0x24, 0x12, 0x69, 0x7C, 0x91, 0xDE, 0xFD, 0xFF, 0x65, 0x5E, 0xC2,
+0x16, 0xEF, 0x6E, 0xCD, 0x46, 0x53, 0x68, 0x00, 0xC1, 0xE8, 0x5B, 0xEF, 0xCD, 0x57, 0x6A, 0x65,
+0xC2, 0x57, 0xF7, 0x0F, 0xDE, 0xE9, 0x7B, 0x72, 0xC4, 0xA4, 0x11, 0x26, 0x3B, 0xAD, 0xC5, 0xDB,
+0xFF, 0xFF, 0xFF, 0x00, 0xC4, 0x9B, 0xF7, 0x30, 0xDE, 0x4A, 0x9D, 0xA8, 0x34, 0x19, 0xBF, 0x71,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB5, 0xF7, 0x6C, 0x7B, 0x00, 0x96, 0xC0, 0xF0,
+0xFF, 0x01, 0x7B, 0x00, 0x48, 0xC3, 0x6F, 0xEF, 0x0B, 0xA5, 0xC9, 0x7B, 0x6C, 0xAD, 0x48, 0x40,
+0x7B, 0x48, 0x40, 0x48, 0x00, 0x40, 0x01, 0x73, 0x7B, 0xC0, 0xF0, 0xF7, 0x7B, 0x00, 0x40, 0x7B,
+0x48, 0x00, 0x40, 0x7B, 0x48, 0x01, 0x40, 0x00, 0x7B, 0x48, 0x00, 0x7B, 0x01, 0xA9, 0xC0, 0xFA,
+0xFF, 0x71, 0x04, 0xC4, 0x3A, 0xCF, 0xEA, 0x3C, 0xCE, 0xB5, 0xCF, 0xDD, 0x7A, 0xF7, 0x71, 0xA9,
+0xC3, 0x58, 0xFF, 0xEC, 0xA4, 0xA7, 0x22, 0x46, 0x22, 0x46, 0xC1, 0xEC, 0x8C, 0xEF, 0xDD, 0x6B,
+0xC0, 0xDD, 0xF7, 0xA6, 0xC3, 0x79, 0xF7, 0x8E, 0xC5, 0xC6, 0x32, 0xC5, 0x11, 0x6D, 0xC2, 0xE9,
+0x5B, 0x8D, 0xD5, 0xD5, 0xEE, 0x5B, 0x56, 0xC0, 0x9A, 0xF7, 0x76, 0xC1, 0x87, 0x4B, 0xE5, 0x11,
+0x68, 0xC2, 0x47, 0x43, 0x6D, 0xC5, 0xB5, 0xE6, 0x4F, 0x56, 0x4F, 0xC1, 0x71, 0xDE, 0xA7, 0x63,
+0x6D, 0x68, 0xC2, 0xC6, 0x2A, 0x0C, 0xAD, 0x32, 0xDE, 0x4F, 0x56, 0xBE, 0xC2, 0xD4, 0xE6, 0x49,
+0x84, 0x24, 0x1A, 0x68, 0xC3, 0x45, 0x1A, 0xCA, 0x94, 0x11, 0xDE, 0x9B, 0xF7, 0x56, 0xAE, 0xC2,
+0x36, 0xF7, 0xEB, 0x9C, 0x27, 0x33, 0x68, 0x6D, 0xC1, 0x2A, 0x74, 0x6F, 0xCD, 0x77, 0x62, 0xBA,
+0xC2, 0x38, 0xF7, 0x4E, 0xC5, 0xC5, 0x3A, 0x68, 0xA9, 0xC2, 0xA8, 0x53, 0x4E, 0xBD, 0x18, 0xEF,
+0x65, 0x62, 0xC2, 0x9A, 0xF7, 0xEF, 0xD5, 0x47, 0x53, 0x68, 0x63, 0xC2, 0xE7, 0x32, 0xEC, 0xAC,
+0xB6, 0xE6, 0x65, 0x9A, 0x52, 0xC1, 0x52, 0xE6, 0xE8, 0x73, 0x68, 0x63, 0xC2, 0x85, 0x22, 0xAB,
+0x94, 0x32, 0xD6, 0x5E, 0x65, 0x52, 0x4C, 0xC1, 0x8A, 0x94, 0x05, 0x1A, 0xA2, 0xC2, 0x04, 0x1A,
+0x29, 0x7C, 0xF1, 0xD5, 0x4F, 0x5E, 0x00, 0xC2, 0xD4, 0xEE, 0x4C, 0xB5, 0x85, 0x2A, 0x63, 0xC4,
+0x04, 0x12, 0xA8, 0x5B, 0x6E, 0xC5, 0x7A, 0xF7, 0xFD, 0xFF, 0x5E, 0xC3, 0x16, 0xF7, 0xCE, 0xCD,
+0x26, 0x43, 0xC4, 0x11, 0x00, 0xC3, 0x27, 0x43, 0xEC, 0xB4, 0xF7, 0xEE, 0xFE, 0xFF, 0x00, 0x5F,
+0xC1, 0xEF, 0xDD, 0xC8, 0x63, 0x61, 0xA7, 0x56, 0xC2, 0xCB, 0xA4, 0xF6, 0xEE, 0xFF, 0xFF, 0x00,
+0xC4, 0x9B, 0xFF, 0x50, 0xE6, 0x6A, 0x95, 0x88, 0x2C, 0x3A, 0xC7, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC0, 0xB5, 0xF7, 0x6C, 0xBF, 0x08, 0xC0, 0xEE, 0xDE, 0x96, 0xC0, 0xD0, 0xF7,
+0x7B, 0x1E, 0xA9, 0x4E, 0x71, 0x04, 0xC5, 0x5B, 0xD7, 0xAA, 0x34, 0xCA, 0x5C, 0x6E, 0xCD, 0x33,
+0xE6, 0x18, 0xF7, 0xA0, 0x41, 0xC2, 0x27, 0x4B, 0x26, 0x2A, 0xC6, 0x31, 0x99, 0xC2, 0x28, 0x43,
+0x2D, 0xB5, 0x12, 0xE6, 0x5A, 0x94, 0xC3, 0x8F, 0xD5, 0x88, 0x63, 0x25, 0x1A, 0xC5, 0x19, 0xAE,
+0xC3, 0x86, 0x22, 0x8A, 0x94, 0xAF, 0xD5, 0xB5, 0xEE, 0x44, 0xC1, 0x11, 0xDE, 0x29, 0x84, 0x5A,
+0x77, 0xA5, 0x41, 0xC3, 0x29, 0x74, 0x6E, 0xCD, 0x95, 0xE6, 0x16, 0xEF, 0x78, 0xC2, 0x49, 0x8C,
+0x85, 0x22, 0xC4, 0x11, 0x72, 0xC1, 0x05, 0x12, 0x68, 0x53, 0x59, 0xC6, 0x73, 0xE6, 0x17, 0xEF,
+0x74, 0xE6, 0xEC, 0xAC, 0x6A, 0x4C, 0xC6, 0x22, 0xC4, 0x19, 0x68, 0xC2, 0x06, 0x3B, 0xCB, 0xAC,
+0x32, 0xDE, 0x4B, 0x73, 0xC7, 0x0D, 0xBD, 0xC8, 0x5B, 0xA8, 0x2B, 0xE7, 0x22, 0x45, 0x1A, 0xA6,
+0x2A, 0x4A, 0x8C, 0x91, 0xCD, 0x4B, 0xA1, 0xC1, 0x2E, 0xC5, 0x68, 0x6B, 0x75, 0x6B, 0x00, 0xC3,
+0x45, 0x22, 0xE9, 0x7B, 0x4F, 0xC5, 0xD6, 0xE6, 0xBB, 0xC1, 0x90, 0xCD, 0xE9, 0x83, 0x49, 0xC0,
+0xC4, 0x11, 0x6B, 0x9E, 0xC1, 0xA8, 0x63, 0x0D, 0xBD, 0x5F, 0x4B, 0xC3, 0xF2, 0xDD, 0x4B, 0x9C,
+0x85, 0x2A, 0xA4, 0x11, 0xBA, 0xC3, 0xE4, 0x11, 0x27, 0x4B, 0xCC, 0xAC, 0x53, 0xDE, 0x4B, 0xC3,
+0x33, 0xDE, 0xAC, 0xAC, 0x06, 0x43, 0xC4, 0x11, 0x72, 0x6D, 0xC4, 0xA6, 0x32, 0x6B, 0x9C, 0xF1,
+0xD5, 0xF7, 0xEE, 0x95, 0xE6, 0x77, 0xC1, 0xA8, 0x63, 0xE4, 0x11, 0xB6, 0x63, 0xC1, 0x47, 0x2B,
+0xAB, 0x84, 0x57, 0xC0, 0xD6, 0xEE, 0xA6, 0xC2, 0x6F, 0xD5, 0x4A, 0x84, 0x24, 0x1A, 0x6B, 0x72,
+0x7A, 0xC0, 0xA8, 0x6B, 0x77, 0xC0, 0xB6, 0xE6, 0x7F, 0xC2, 0xB0, 0xD5, 0x8B, 0x9C, 0x65, 0x2A,
+0x63, 0x66, 0x6D, 0xC0, 0x27, 0x53, 0x59, 0xC1, 0xB5, 0xE6, 0x18, 0xF7, 0x44, 0xC3, 0x4B, 0xBD,
+0x87, 0x4C, 0xA9, 0x34, 0x7B, 0xD7, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB5,
+0xF7, 0x6C, 0x7B, 0x09, 0xAE, 0x7B, 0x1F, 0x74, 0xC0, 0xFA, 0xFF, 0x71, 0x04, 0xCA, 0x19, 0xC7,
+0x89, 0x34, 0x07, 0x2C, 0x29, 0x5C, 0x8A, 0x94, 0xAB, 0xA4, 0x4A, 0x94, 0xE7, 0x42, 0xC4, 0x31,
+0x44, 0x41, 0x85, 0x49, 0x66, 0xC0, 0x85, 0x31, 0x7C, 0xC4, 0x6B, 0x94, 0xCC, 0xAC, 0x4A, 0x8C,
+0x07, 0x4B, 0x06, 0x1A, 0xA5, 0x00, 0xBF, 0x43, 0xC1, 0xC7, 0x32, 0x2A, 0x7C, 0x42, 0x96, 0xC1,
+0x88, 0x63, 0x45, 0x22, 0x77, 0xA6, 0x6B, 0x77, 0xC2, 0x66, 0x22, 0xA9, 0x63, 0x8A, 0x9C, 0x95,
+0xC0, 0x67, 0x63, 0x49, 0x92, 0x72, 0x00, 0x77, 0x6D, 0xC1, 0xE7, 0x42, 0x2A, 0x8C, 0x75, 0xC0,
+0x67, 0x6B, 0x65, 0x8E, 0xC1, 0x27, 0x23, 0xA6, 0x22, 0x77, 0x95, 0xC5, 0xA6, 0x3A, 0xC9, 0x7B,
+0x4A, 0x94, 0xC8, 0x7B, 0xA5, 0x3A, 0x04, 0x1A, 0x6B, 0xC0, 0x45, 0x1A, 0x64, 0xC1, 0x07, 0x23,
+0xE6, 0x32, 0x5C, 0xC0, 0xE9, 0x8B, 0x82, 0xC1, 0xA6, 0x4A, 0xE4, 0x19, 0x6B, 0x01, 0x96, 0xC5,
+0x25, 0x22, 0x68, 0x63, 0x09, 0x8C, 0xA9, 0x83, 0xE6, 0x52, 0x04, 0x1A, 0x92, 0x6B, 0x00, 0x96,
+0x70, 0xC0, 0x07, 0x53, 0x40, 0x99, 0xC1, 0xE6, 0x5A, 0x25, 0x2A, 0x63, 0xBA, 0x6B, 0x66, 0x68,
+0xC1, 0xE6, 0x42, 0xC9, 0x83, 0x00, 0xC1, 0x47, 0x6B, 0x65, 0x32, 0x6D, 0x77, 0xBF, 0xAE, 0x77,
+0xC0, 0x86, 0x3A, 0x7D, 0xC3, 0x0A, 0x8C, 0x88, 0x7B, 0xC6, 0x42, 0x04, 0x1A, 0x6B, 0x66, 0x77,
+0xC0, 0xE9, 0x33, 0xBD, 0xC0, 0x88, 0x6B, 0x52, 0xC2, 0xA8, 0x83, 0x06, 0x53, 0x24, 0x22, 0x68,
+0x72, 0xA9, 0x00, 0x75, 0xC0, 0x47, 0x5B, 0x52, 0x4D, 0xC0, 0x48, 0x63, 0x49, 0xC0, 0xA4, 0x11,
+0x66, 0x01, 0xC7, 0xE4, 0x11, 0x06, 0x4B, 0x29, 0x8C, 0x69, 0x9C, 0xE8, 0x7B, 0xC6, 0x43, 0xE6,
+0x23, 0x88, 0x34, 0x4F, 0xC0, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5,
+0xF7, 0x8F, 0xEF, 0xBF, 0x04, 0xAE, 0x7B, 0x04, 0x96, 0x00, 0x7B, 0x04, 0x73, 0x00, 0x7B, 0x14,
+0xA9, 0x4E, 0x71, 0x04, 0xC3, 0x34, 0x9E, 0x48, 0x2C, 0xEF, 0x5C, 0x8C, 0x43, 0xA5, 0xC9, 0x2F,
+0x64, 0xC9, 0x32, 0xE5, 0x21, 0x64, 0x41, 0x6A, 0x8B, 0x8C, 0xBC, 0x29, 0x8B, 0x64, 0x49, 0xC5,
+0x31, 0x46, 0x22, 0x55, 0x41, 0xA6, 0xA7, 0xA5, 0x46, 0xC2, 0x67, 0x2A, 0xEA, 0x32, 0x4C, 0x43,
+0x4B, 0xA8, 0xC0, 0x29, 0x33, 0x95, 0xC0, 0x47, 0x22, 0x72, 0x77, 0x43, 0x46, 0x57, 0x99, 0x49,
+0x00, 0x41, 0x50, 0xA6, 0x77, 0x00, 0x72, 0x46, 0xC0, 0x88, 0x2A, 0x7C, 0xA5, 0xC0, 0x68, 0x22,
+0x57, 0xC1, 0x84, 0x11, 0xC4, 0x19, 0x55, 0xC0, 0xE7, 0x22, 0xA6, 0x7F, 0xC1, 0x4A, 0x33, 0xE7,
+0x2A, 0x6B, 0x70, 0xA2, 0xA9, 0x6B, 0x5F, 0xC1, 0x07, 0x23, 0xCB, 0x3B, 0x55, 0xC0, 0xA3, 0x11,
+0x77, 0x57, 0xC0, 0xA4, 0x11, 0x72, 0x00, 0xA9, 0x63, 0x00, 0xC0, 0xE5, 0x11, 0x6B, 0x57, 0xC0,
+0xC5, 0x11, 0x63, 0x04, 0x6F, 0x68, 0x57, 0x7E, 0x63, 0xBA, 0x00, 0x6B, 0x66, 0x63, 0x7E, 0x57,
+0xC0, 0xEA, 0x3A, 0x96, 0x7E, 0x6B, 0x4B, 0xC0, 0xA7, 0x22, 0xBA, 0x7C, 0x7E, 0x77, 0x4B, 0xC0,
+0xC9, 0x32, 0x7C, 0xA5, 0x6B, 0x4B, 0xC0, 0x28, 0x2B, 0x64, 0xC0, 0x26, 0x1A, 0x95, 0xC0, 0x67,
+0x2A, 0x4E, 0x43, 0x68, 0x72, 0x00, 0x6B, 0xA6, 0x6F, 0x74, 0x68, 0x77, 0x68, 0x63, 0x66, 0x03,
+0x68, 0xC0, 0x24, 0x1A, 0xAE, 0x96, 0xC4, 0xC5, 0x1A, 0x27, 0x2C, 0x67, 0x2C, 0x53, 0x96, 0xFF,
+0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5, 0xF7, 0x8F, 0xEF, 0xBF, 0x02, 0xAE,
+0xC2, 0x4D, 0xCE, 0x8C, 0xAD, 0xF0, 0xFF, 0x7B, 0x01, 0x48, 0xC0, 0x4D, 0xC6, 0xA6, 0xC0, 0xAE,
+0xD6, 0x40, 0x7B, 0x00, 0x91, 0xC0, 0xEC, 0xBD, 0x40, 0xC0, 0x8E, 0xCE, 0xA5, 0xC0, 0x0D, 0xC6,
+0x48, 0x40, 0x7B, 0x6C, 0x7B, 0x01, 0x96, 0x7B, 0x0B, 0xA9, 0xC1, 0xFA, 0xFF, 0xFF, 0xFF, 0x04,
+0xCA, 0x13, 0x8E, 0xAB, 0x3C, 0x59, 0xA6, 0xEB, 0x3A, 0xD4, 0x7C, 0xBD, 0xC6, 0x93, 0x74, 0x64,
+0x29, 0x06, 0x5A, 0x30, 0xD6, 0xAE, 0xDD, 0x95, 0xC1, 0x05, 0x62, 0x64, 0x31, 0x43, 0x00, 0x7E,
+0xBE, 0x00, 0xA6, 0xC4, 0x47, 0x2A, 0xE9, 0x32, 0xD2, 0x64, 0x9B, 0xB6, 0x72, 0x74, 0x85, 0xC5,
+0xB0, 0x5C, 0x2D, 0x4C, 0x14, 0x85, 0xE5, 0x19, 0x87, 0x2A, 0x09, 0x33, 0x69, 0xBF, 0x49, 0xC0,
+0x87, 0x22, 0x7C, 0xC1, 0x47, 0x22, 0x69, 0x33, 0x92, 0x50, 0x7C, 0xC3, 0x27, 0x22, 0x56, 0x8D,
+0x5A, 0xAE, 0x4D, 0x4B, 0x55, 0xC3, 0x3A, 0xAE, 0x97, 0x95, 0x48, 0x2A, 0xA4, 0x11, 0xA6, 0x6B,
+0xCC, 0x67, 0x22, 0xB7, 0x95, 0x1A, 0xA6, 0x2C, 0x43, 0x6C, 0x43, 0xF8, 0x9D, 0xC8, 0x2A, 0x45,
+0x1A, 0xE6, 0x22, 0x85, 0x1A, 0x2F, 0x5C, 0x9B, 0xAE, 0x55, 0x85, 0x57, 0xC0, 0x72, 0x74, 0x62,
+0xC0, 0x8D, 0x4B, 0x7C, 0x77, 0x00, 0x92, 0xC0, 0x31, 0x6C, 0x9D, 0xC3, 0xAE, 0x4B, 0xF9, 0xA5,
+0x72, 0x6C, 0x87, 0x22, 0xA9, 0x02, 0xC1, 0x0F, 0x5C, 0xF4, 0x84, 0x42, 0xC0, 0xB8, 0x9D, 0x91,
+0xC0, 0x2B, 0x3B, 0x5A, 0xC0, 0xC6, 0x22, 0xAF, 0x64, 0xC7, 0x4A, 0x3B, 0x35, 0x8D, 0xEE, 0x4B,
+0xB6, 0x8D, 0x9B, 0xBE, 0x30, 0x64, 0xA6, 0x22, 0xE8, 0x33, 0x00, 0x5A, 0x5C, 0x53, 0xC3, 0xAF,
+0x5B, 0xB3, 0x74, 0x3A, 0xAE, 0x0B, 0x43, 0x72, 0xC1, 0x26, 0x22, 0x28, 0x2B, 0x5F, 0xC5, 0x88,
+0x2A, 0xB8, 0xA5, 0x6D, 0x4B, 0x56, 0x8D, 0xD9, 0xA5, 0xAA, 0x32, 0x72, 0x4B, 0x77, 0x72, 0x00,
+0x7F, 0xC0, 0xF0, 0x63, 0x5E, 0xC2, 0xB3, 0x7C, 0xEC, 0x4A, 0x83, 0x11, 0x66, 0xA6, 0x00, 0x66,
+0xAB, 0x66, 0x63, 0x01, 0xC3, 0xA5, 0x22, 0x27, 0x2C, 0x67, 0x2C, 0x11, 0x86, 0x71, 0x1F, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB5, 0xF7, 0x6C, 0x7B, 0x02, 0x48, 0xC1, 0x4B, 0xA5, 0x49,
+0x8C, 0x6C, 0xC1, 0x4D, 0xC6, 0xAE, 0xD6, 0x96, 0xC2, 0xCC, 0xB5, 0xE9, 0x7B, 0xED, 0xBD, 0xBE,
+0xC1, 0x0B, 0xA5, 0x8C, 0xAD, 0x7B, 0x67, 0xC1, 0xCA, 0x94, 0xD0, 0xF7, 0x5D, 0xA6, 0x47, 0xC0,
+0x8C, 0xB5, 0x71, 0xC1, 0xCA, 0x9C, 0x6C, 0xAD, 0x72, 0xC1, 0x0F, 0xDF, 0xCB, 0x9C, 0x6A, 0x52,
+0x53, 0x67, 0x7B, 0x08, 0x74, 0xC1, 0xFA, 0xFF, 0xFF, 0xFF, 0x04, 0xC5, 0x53, 0x86, 0x8B, 0x34,
+0xD6, 0x95, 0x77, 0x95, 0x16, 0x8D, 0xF1, 0x63, 0xAD, 0xC8, 0xA5, 0x29, 0x85, 0x49, 0x4B, 0x9C,
+0x4D, 0xC5, 0x2A, 0xA4, 0xA5, 0x51, 0x84, 0x29, 0xC5, 0x11, 0x05, 0x1A, 0x77, 0xAB, 0xC0, 0x27,
+0x22, 0xA5, 0x52, 0xC5, 0x29, 0x33, 0x4D, 0x44, 0x7A, 0xAE, 0x6D, 0x4B, 0xEF, 0x5B, 0xB5, 0x85,
+0x84, 0xC2, 0xB2, 0x74, 0xC4, 0x11, 0x49, 0x33, 0xA5, 0xC0, 0xC7, 0x22, 0xBF, 0xC2, 0xCA, 0x33,
+0x48, 0x2B, 0x25, 0x1A, 0x7A, 0xC0, 0xE8, 0x33, 0x92, 0xC0, 0x07, 0x2B, 0xAB, 0xBB, 0xC0, 0x71,
+0x6C, 0x97, 0xC5, 0xF5, 0x84, 0x8E, 0x4B, 0xCF, 0x53, 0x76, 0x8D, 0x8E, 0x53, 0x84, 0x11, 0x66,
+0x5E, 0xC2, 0x48, 0x2A, 0xD0, 0x5B, 0x93, 0x74, 0x00, 0x49, 0xC3, 0x5A, 0xB6, 0x09, 0x33, 0x65,
+0x1A, 0x47, 0x2B, 0x92, 0xC0, 0xCE, 0x53, 0x9A, 0xC4, 0xD8, 0x95, 0x91, 0x64, 0x77, 0x95, 0x8F,
+0x53, 0xB7, 0x8D, 0x78, 0xC0, 0x66, 0x22, 0x77, 0xAF, 0xC1, 0x76, 0x95, 0x14, 0x85, 0x64, 0xC4,
+0xAF, 0x53, 0x36, 0x85, 0xA8, 0x32, 0xE4, 0x11, 0x45, 0x22, 0x78, 0x99, 0xC3, 0x33, 0x7D, 0xF8,
+0xA5, 0xD1, 0x6C, 0xB7, 0x95, 0xAF, 0xC0, 0x0F, 0x5C, 0x69, 0xC0, 0x27, 0x2B, 0x42, 0x96, 0xC2,
+0x0C, 0x44, 0x75, 0x85, 0x49, 0x2B, 0xA9, 0xC4, 0xF7, 0x95, 0x0D, 0x54, 0xC6, 0x22, 0x07, 0x23,
+0xA8, 0x2B, 0x64, 0xC5, 0x67, 0x22, 0xF8, 0x9D, 0x35, 0x7D, 0xB6, 0x85, 0x70, 0x54, 0x87, 0x22,
+0x5C, 0xC9, 0x28, 0x2B, 0xC7, 0x22, 0x46, 0x22, 0xC9, 0x2A, 0x59, 0xB6, 0x32, 0x6C, 0x1A, 0xAE,
+0xB9, 0xA5, 0xAA, 0x32, 0xE7, 0x2A, 0xA2, 0xC1, 0x26, 0x22, 0xC5, 0x19, 0x7E, 0xC5, 0xB7, 0x9D,
+0x93, 0x84, 0xCB, 0x32, 0xDD, 0xCE, 0x4E, 0x53, 0x63, 0x11, 0x72, 0xA6, 0xA5, 0x66, 0x00, 0x9A,
+0xC0, 0x04, 0x1A, 0xAE, 0xA7, 0xC3, 0xC5, 0x22, 0x27, 0x2C, 0x67, 0x2C, 0xF1, 0x75, 0x71, 0x1F,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xB5, 0xF7, 0x6C, 0xBF, 0x02, 0x91, 0xC0, 0x8A, 0x94,
+0x92, 0xC2, 0x8E, 0xCE, 0x8C, 0xAD, 0x6D, 0xCE, 0x51, 0xC0, 0xCC, 0xB5, 0xA6, 0xA6, 0xC1, 0x09,
+0x84, 0x2D, 0xC6, 0x51, 0xC0, 0x0F, 0xDF, 0x67, 0xC1, 0xEB, 0x9C, 0xF1, 0xFF, 0x6F, 0x77, 0x6F,
+0xC1, 0xCC, 0xBD, 0xCB, 0x9C, 0x77, 0x7F, 0xC0, 0xE9, 0x7B, 0x77, 0xC1, 0x2B, 0xA5, 0xCE, 0xD6,
+0x49, 0xC0, 0x4B, 0xAD, 0x7B, 0x09, 0xA9, 0xC1, 0xFA, 0xFF, 0xFF, 0xFF, 0x04, 0xC4, 0x54, 0x86,
+0x69, 0x2C, 0xA9, 0x33, 0x6D, 0x4B, 0xEC, 0x3A, 0xBA, 0x94, 0xC3, 0xE6, 0x21, 0x85, 0x39, 0x64,
+0x49, 0x05, 0x5A, 0x6E, 0x86, 0xC4, 0x45, 0x2A, 0x89, 0x63, 0xEA, 0x7B, 0x89, 0x6B, 0x87, 0x3A,
+0x43, 0xBA, 0x00, 0xC5, 0xE8, 0x2A, 0x88, 0x2B, 0x76, 0x8D, 0x72, 0x74, 0xEA, 0x32, 0x18, 0x96,
+0xBF, 0xC1, 0xEA, 0x3A, 0xA4, 0x11, 0x55, 0xC0, 0x27, 0x2B, 0x00, 0xC0, 0x25, 0x1A, 0x53, 0xC0,
+0xA6, 0x22, 0xBF, 0xC0, 0x65, 0x1A, 0x00, 0xC1, 0xE7, 0x22, 0xA8, 0x2B, 0xA9, 0xC7, 0xC6, 0x22,
+0xE5, 0x11, 0x36, 0x8D, 0x10, 0x5C, 0x46, 0x1A, 0x8D, 0x4B, 0xF8, 0x9D, 0xA9, 0x2A, 0x63, 0x6D,
+0x00, 0x95, 0xC4, 0xC5, 0x19, 0x35, 0x8D, 0xAE, 0x53, 0x08, 0x2B, 0x76, 0x8D, 0x7F, 0x94, 0x00,
+0xC9, 0x86, 0x22, 0x83, 0x09, 0x4D, 0x4B, 0x35, 0x85, 0x70, 0x5C, 0x34, 0x85, 0x0A, 0x33, 0xB7,
+0x95, 0xEA, 0x33, 0xC6, 0x22, 0x70, 0xC2, 0x45, 0x1A, 0x2F, 0x5C, 0xD3, 0x74, 0x9A, 0xC2, 0xB4,
+0x7C, 0xB9, 0xA5, 0x49, 0x32, 0x63, 0xC0, 0x87, 0x22, 0x4D, 0x46, 0xC3, 0x8B, 0x3B, 0x35, 0x7D,
+0xCE, 0x53, 0x3B, 0xB6, 0x91, 0xC0, 0x89, 0x32, 0x68, 0xC0, 0x04, 0x1A, 0xAB, 0x00, 0xC2, 0x46,
+0x1A, 0xB6, 0x8D, 0x2B, 0x43, 0x89, 0xC1, 0xB8, 0x95, 0x26, 0x22, 0x64, 0x70, 0x69, 0xAF, 0x64,
+0xC6, 0x13, 0x75, 0x55, 0x7D, 0x4D, 0x44, 0x8F, 0x54, 0xAC, 0x43, 0x28, 0x2B, 0x66, 0x22, 0x00,
+0xC7, 0x27, 0x2B, 0xC7, 0x22, 0x14, 0x7D, 0xF1, 0x63, 0x0D, 0x43, 0xB3, 0x74, 0x15, 0x85, 0x88,
+0x2B, 0xA2, 0xC1, 0x25, 0x22, 0xC5, 0x19, 0x5E, 0xC1, 0xEF, 0x5B, 0xB4, 0x7C, 0x4B, 0xC0, 0xBE,
+0xC6, 0x4A, 0xC0, 0xE6, 0x19, 0xBE, 0x95, 0xA2, 0xA5, 0xC2, 0xC4, 0x11, 0xE6, 0x3A, 0xA8, 0x6B,
+0xB5, 0xC5, 0x87, 0x5B, 0x86, 0x33, 0x06, 0x2C, 0x67, 0x2C, 0xD0, 0x6D, 0xFF, 0xFF, 0x01, 0xC1,
+0xDB, 0xDE, 0x38, 0xC6, 0x71, 0x03, 0xA6, 0x95, 0x00, 0xC1, 0xF7, 0xBD, 0x7D, 0xEF, 0x71, 0x5C,
+0xC1, 0x59, 0xCE, 0x9A, 0xD6, 0x95, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5,
+0xF7, 0x8F, 0xEF, 0xBF, 0x01, 0xAE, 0xC3, 0x6E, 0xCE, 0x4A, 0x8C, 0xEB, 0x9C, 0x6C, 0xAD, 0x00,
+0x49, 0xAE, 0x6A, 0xC1, 0xAA, 0x94, 0x8C, 0xAD, 0x63, 0x6A, 0xC6, 0xCB, 0x9C, 0x4F, 0xE7, 0x90,
+0xEF, 0x29, 0x84, 0x8E, 0xCE, 0x2B, 0xA5, 0xAC, 0xB5, 0x75, 0xC0, 0x4B, 0xAD, 0xAB, 0x77, 0x49,
+0x54, 0xC0, 0x8C, 0xB5, 0x77, 0xC1, 0xF0, 0xFF, 0x09, 0x84, 0x77, 0x48, 0x7B, 0x08, 0xA9, 0xC1,
+0xFA, 0xFF, 0xFF, 0xFF, 0x04, 0xC4, 0x53, 0x8E, 0x8A, 0x34, 0xAE, 0x5C, 0xB2, 0x74, 0xF5, 0x84,
+0xBF, 0xC1, 0x0C, 0x43, 0xE6, 0x21, 0xBF, 0xB1, 0xC0, 0x64, 0x31, 0xAE, 0xC3, 0x66, 0x32, 0xCD,
+0xA4, 0x2D, 0xCD, 0x6E, 0xCD, 0xAE, 0xC2, 0xCC, 0xB4, 0xC8, 0x4A, 0xE5, 0x19, 0xBF, 0xC5, 0xAB,
+0x3B, 0xC8, 0x2A, 0x6D, 0x43, 0xB7, 0x8D, 0x2A, 0x33, 0x59, 0xAE, 0xBB, 0x7E, 0x90, 0x00, 0xCE,
+0x26, 0x22, 0x4F, 0x6C, 0xA8, 0x32, 0x12, 0x8D, 0xA9, 0x32, 0xF2, 0x8C, 0x88, 0x32, 0xD2, 0x84,
+0xE8, 0x32, 0xE3, 0x11, 0x44, 0x1A, 0xE4, 0x11, 0x31, 0x64, 0x56, 0x85, 0x08, 0x2B, 0x00, 0xC2,
+0xF7, 0x95, 0xAF, 0x54, 0xE7, 0x22, 0x4B, 0x63, 0x77, 0x7E, 0x61, 0xC4, 0x51, 0x64, 0x86, 0x1A,
+0x6A, 0x43, 0xB7, 0x9D, 0xA7, 0x22, 0xA8, 0x92, 0xC8, 0x83, 0x11, 0x88, 0x2A, 0x97, 0x8D, 0xEA,
+0x32, 0xCD, 0x4B, 0x34, 0x7D, 0xED, 0x4B, 0x56, 0x8D, 0xA6, 0x22, 0xAE, 0x53, 0xC6, 0x07, 0x23,
+0x70, 0x64, 0x74, 0x7D, 0xCB, 0x33, 0x35, 0x7D, 0x3A, 0xB6, 0x68, 0x2A, 0x5A, 0x91, 0xC0, 0xC5,
+0x19, 0x46, 0xC5, 0xEC, 0x3B, 0x52, 0x5C, 0x35, 0x85, 0x6E, 0x53, 0xB3, 0x6C, 0x51, 0x6C, 0x46,
+0x5A, 0x01, 0xC5, 0xC7, 0x22, 0xF8, 0x9D, 0x8D, 0x4B, 0xD2, 0x6C, 0xF4, 0x7C, 0x66, 0x1A, 0x5F,
+0x64, 0x5F, 0x6B, 0x5F, 0xC0, 0x54, 0x7D, 0xA2, 0xC3, 0xAB, 0x33, 0xB0, 0x5C, 0x34, 0x7D, 0x26,
+0x1A, 0x77, 0x52, 0xC1, 0x47, 0x2B, 0xA6, 0x1A, 0x7C, 0xC6, 0x93, 0x74, 0x0C, 0x43, 0xCF, 0x5B,
+0x36, 0x95, 0x25, 0x1A, 0x65, 0x1A, 0xC4, 0x19, 0x72, 0x91, 0xC8, 0x30, 0x64, 0x16, 0x8D, 0x11,
+0x64, 0x5B, 0xAE, 0x77, 0x95, 0xC8, 0x2A, 0x67, 0x2A, 0x06, 0x22, 0xA5, 0x19, 0x99, 0xC2, 0x27,
+0x4B, 0xEC, 0xB4, 0x2E, 0xC5, 0xBE, 0xC4, 0xCB, 0xBC, 0x08, 0x84, 0x27, 0x3C, 0x26, 0x24, 0xD0,
+0x6D, 0x71, 0x00, 0xC3, 0x9A, 0xD6, 0xCF, 0x7B, 0x30, 0x84, 0x34, 0xA5, 0x71, 0x02, 0xC0, 0x59,
+0xCE, 0x90, 0xC0, 0x71, 0x8C, 0xA6, 0xC3, 0xEF, 0x7B, 0x7D, 0xEF, 0x92, 0x94, 0x18, 0xC6, 0x54,
+0xC1, 0xBA, 0xDE, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5, 0xF7, 0x8F,
+0xEF, 0xBF, 0x02, 0xC3, 0xEE, 0xDE, 0x4F, 0xE7, 0xD0, 0xF7, 0xCE, 0xD6, 0xA6, 0xC2, 0x6C, 0xAD,
+0x2F, 0xE7, 0x4D, 0xCE, 0x6F, 0xC0, 0x0F, 0xDF, 0x46, 0xC1, 0xCC, 0xBD, 0x4D, 0xC6, 0x40, 0x7B,
+0x7F, 0xC1, 0x4B, 0xAD, 0x6E, 0xCE, 0x5A, 0xC1, 0xAC, 0xB5, 0x2D, 0xC6, 0x5A, 0x00, 0xC0, 0x0D,
+0xBE, 0x91, 0x52, 0x46, 0x7B, 0xC0, 0x8A, 0x94, 0x52, 0x7B, 0x09, 0xA9, 0x4E, 0x71, 0x04, 0xC7,
+0x33, 0x8E, 0x6A, 0x34, 0x95, 0x85, 0x9C, 0xBE, 0x98, 0x95, 0x11, 0x64, 0x89, 0x32, 0x06, 0x22,
+0xAB, 0x46, 0x72, 0x63, 0xC1, 0xCD, 0x84, 0x0F, 0xDE, 0xAE, 0xC4, 0x36, 0xEF, 0x58, 0xEF, 0xB4,
+0xEE, 0x8B, 0x9C, 0x05, 0x1A, 0xA6, 0xC1, 0x0E, 0x4C, 0xF8, 0xA5, 0xAF, 0xCC, 0x94, 0x75, 0x89,
+0x2B, 0x34, 0x85, 0xB3, 0x7C, 0xE6, 0x19, 0x31, 0x6C, 0x6E, 0x53, 0x08, 0x2A, 0x8E, 0x6B, 0x49,
+0x32, 0xCF, 0x73, 0x69, 0x3A, 0x10, 0x7C, 0x73, 0xCC, 0x30, 0x74, 0x8A, 0x3A, 0xF0, 0x63, 0x0B,
+0x43, 0x48, 0x2A, 0xBC, 0xC6, 0x19, 0x9E, 0xCD, 0x43, 0xD2, 0x74, 0xFD, 0xC6, 0x74, 0x7D, 0x8A,
+0x33, 0xC4, 0x11, 0xB6, 0xC9, 0xC7, 0x2A, 0xE9, 0x32, 0x7B, 0xB6, 0x56, 0x85, 0xCB, 0x3B, 0x29,
+0x33, 0x35, 0x85, 0x46, 0x22, 0xE4, 0x19, 0x24, 0x1A, 0x41, 0xC0, 0xF4, 0x7C, 0x7E, 0xC2, 0xEE,
+0x5B, 0xC8, 0x2A, 0x35, 0x85, 0x58, 0xC2, 0x2F, 0x5C, 0x85, 0x1A, 0xC5, 0x22, 0xA6, 0x9E, 0xC0,
+0x30, 0x5C, 0xBF, 0x9D, 0x4C, 0xC3, 0x93, 0x74, 0x66, 0x22, 0x05, 0x1A, 0x46, 0x1A, 0xA9, 0x00,
+0xC7, 0x2C, 0x44, 0xF4, 0x7C, 0x92, 0x6C, 0x96, 0x8D, 0xD8, 0x9D, 0x2C, 0x43, 0xA6, 0x22, 0x27,
+0x2B, 0x01, 0xC5, 0x68, 0x2B, 0x12, 0x6D, 0xAB, 0x3B, 0xF1, 0x64, 0x8B, 0x3B, 0xE6, 0x22, 0x7D,
+0x9A, 0x01, 0xA6, 0x4A, 0xA6, 0x5E, 0xC1, 0x79, 0xAE, 0x4F, 0x5C, 0x5F, 0xAE, 0x00, 0x69, 0x92,
+0xC2, 0x2F, 0x54, 0x71, 0x5C, 0x95, 0x85, 0x5B, 0x6C, 0xC0, 0xC6, 0x1A, 0xB6, 0x00, 0xAB, 0x5F,
+0xC4, 0x4F, 0x54, 0x72, 0x6C, 0x84, 0x11, 0x4D, 0x43, 0x4E, 0x4C, 0x69, 0x55, 0xC0, 0xE5, 0x21,
+0x91, 0xC3, 0x25, 0x22, 0xCB, 0x9C, 0xF5, 0xE6, 0x9B, 0xFF, 0xA9, 0xC5, 0x93, 0xE6, 0xAB, 0xBC,
+0x89, 0x7C, 0x26, 0x24, 0xB0, 0x6D, 0xFF, 0xFF, 0x00, 0xC1, 0x71, 0x94, 0xBA, 0xD6, 0x71, 0xC1,
+0x30, 0x8C, 0x38, 0xC6, 0x48, 0x00, 0xC3, 0xDF, 0xFF, 0xB6, 0xB5, 0x55, 0xAD, 0xB3, 0x9C, 0x71,
+0xC5, 0x96, 0xB5, 0x92, 0x94, 0x2C, 0x63, 0x72, 0x94, 0xCB, 0x5A, 0x9A, 0xD6, 0x71, 0x0B, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xB5, 0xF7, 0x8F, 0xEF, 0xBF, 0x01, 0xA6, 0x7B, 0x01, 0xAE,
+0x00, 0xBE, 0x7B, 0x40, 0x48, 0x7B, 0x40, 0xAE, 0x40, 0x7B, 0x00, 0x48, 0x00, 0x40, 0x7B, 0x48,
+0x40, 0x7B, 0x00, 0x40, 0x48, 0x7B, 0x40, 0xC1, 0x0E, 0xDF, 0x0D, 0xC6, 0x7B, 0x0A, 0xA9, 0xC0,
+0xFA, 0xFF, 0x71, 0x04, 0xC8, 0x13, 0x8E, 0x49, 0x34, 0xA9, 0x33, 0x0A, 0x3B, 0x8F, 0x5B, 0xB4,
+0x7C, 0x6E, 0x53, 0x07, 0x22, 0x48, 0x2A, 0x95, 0xC5, 0xC6, 0x21, 0x06, 0x22, 0xD0, 0xAD, 0x4F,
+0xDE, 0x36, 0xEF, 0x9B, 0xF7, 0x00, 0xAD, 0xCC, 0xAF, 0xBD, 0x66, 0x32, 0x06, 0x1A, 0x29, 0x2B,
+0x4B, 0x43, 0x6D, 0x4B, 0xC7, 0x22, 0x26, 0x23, 0xC9, 0x2A, 0x47, 0x22, 0xAA, 0x3A, 0xB5, 0x84,
+0xE9, 0x39, 0xA5, 0x00, 0xA6, 0x99, 0x01, 0xAF, 0xA6, 0x5F, 0xC5, 0x6C, 0x4A, 0x29, 0x3A, 0xC6,
+0x21, 0xCF, 0x5B, 0x91, 0x6C, 0xEC, 0x43, 0xAE, 0xCD, 0xEF, 0x5B, 0x31, 0x64, 0xAB, 0x3A, 0xA6,
+0x21, 0xE7, 0x29, 0xC9, 0x32, 0x0B, 0x3B, 0xD0, 0x5B, 0x32, 0x6C, 0x2D, 0x4B, 0x89, 0x32, 0xCC,
+0x3A, 0x27, 0x2A, 0xA9, 0x32, 0x55, 0xC2, 0xC9, 0x3A, 0x6F, 0x53, 0xF2, 0x6B, 0x99, 0x75, 0xC1,
+0xAB, 0x3A, 0x4E, 0x53, 0x75, 0x94, 0xA6, 0xAF, 0x5A, 0x75, 0xAF, 0x4B, 0x67, 0xC0, 0xCB, 0x3A,
+0x46, 0xA7, 0x7F, 0xA5, 0x66, 0x75, 0x4B, 0x41, 0xC1, 0xD1, 0x63, 0x2F, 0x53, 0x66, 0xC0, 0xE7,
+0x2A, 0xA2, 0x96, 0xA5, 0xC1, 0x08, 0x33, 0x2E, 0x64, 0x92, 0xC0, 0x2F, 0x6C, 0x00, 0xC4, 0xE9,
+0x42, 0xE4, 0x11, 0x8B, 0x4B, 0x0D, 0x5C, 0x8F, 0x6C, 0xA2, 0xC0, 0xCD, 0x53, 0x69, 0x55, 0x69,
+0x81, 0xA9, 0x00, 0xC0, 0x6A, 0x3B, 0xB6, 0xC3, 0x8C, 0x53, 0x0B, 0x43, 0x8A, 0x43, 0x4E, 0x64,
+0x7F, 0xC4, 0x86, 0x22, 0xEB, 0x43, 0xCC, 0x53, 0x6C, 0x53, 0xE8, 0x3A, 0x60, 0xC7, 0xC8, 0x32,
+0x28, 0x2B, 0x46, 0x22, 0xE5, 0x19, 0x07, 0x23, 0x88, 0x2B, 0x46, 0x1A, 0xC5, 0x19, 0x91, 0xC3,
+0xA6, 0x32, 0x6D, 0xB5, 0x9A, 0xF7, 0xFF, 0xFF, 0x00, 0x7C, 0xC3, 0x0F, 0xD6, 0x4B, 0x9D, 0x26,
+0x2C, 0xD0, 0x75, 0x71, 0x00, 0xC1, 0x31, 0x8C, 0x9E, 0xF7, 0x71, 0xC0, 0xF3, 0x9C, 0x91, 0xC2,
+0x34, 0xA5, 0x96, 0xB5, 0x38, 0xC6, 0x78, 0x55, 0xC0, 0xB6, 0xB5, 0x71, 0xC1, 0x59, 0xCE, 0xD3,
+0x9C, 0xBF, 0xC0, 0xFB, 0xDE, 0x7C, 0xC0, 0xDF, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0xC1, 0xD5, 0xF7, 0x8F, 0xEF, 0xBF, 0x1E, 0xAE, 0x7B, 0x0A, 0xA9, 0xC0, 0xFA, 0xFF, 0x71,
+0x04, 0xC1, 0xF4, 0x95, 0x09, 0x2C, 0xB2, 0xC0, 0x87, 0x2A, 0x46, 0xAB, 0xC0, 0x48, 0x2A, 0x00,
+0xA9, 0x00, 0xC0, 0xE6, 0x21, 0x9D, 0xC3, 0x2E, 0x9D, 0xCF, 0xD5, 0x37, 0xEF, 0x9B, 0xF7, 0x00,
+0xA4, 0xC0, 0x4E, 0xB5, 0x5B, 0xC5, 0xE6, 0x19, 0x48, 0x2B, 0x04, 0x12, 0x63, 0x09, 0xA4, 0x11,
+0xC7, 0x2A, 0x9A, 0xC3, 0x66, 0x22, 0xC6, 0x19, 0xCC, 0x4A, 0xA8, 0x39, 0x00, 0xAE, 0x4E, 0x02,
+0x53, 0x00, 0x4E, 0x00, 0x80, 0xC1, 0x03, 0x09, 0xC5, 0x19, 0x52, 0xC6, 0x04, 0x1A, 0x65, 0x1A,
+0x83, 0x09, 0xCF, 0x5B, 0xCE, 0x5A, 0x47, 0x29, 0x88, 0x31, 0x99, 0x46, 0x95, 0x72, 0x77, 0x46,
+0xA5, 0x77, 0x46, 0x01, 0x77, 0x72, 0x77, 0x46, 0x77, 0x72, 0x46, 0x00, 0x96, 0x46, 0x00, 0x7A,
+0x01, 0x72, 0x77, 0x7A, 0xAB, 0x46, 0x00, 0x41, 0x7A, 0x77, 0x00, 0x72, 0x77, 0xC8, 0x8A, 0x42,
+0x84, 0x19, 0xEA, 0x4A, 0x50, 0x7C, 0x89, 0x3A, 0xE9, 0x3A, 0x55, 0xAD, 0x52, 0xBD, 0xF4, 0xCD,
+0xBA, 0xC2, 0x8E, 0xA4, 0x28, 0x63, 0x10, 0xAD, 0x42, 0xC3, 0x93, 0xC5, 0x95, 0xC5, 0x51, 0x8C,
+0x06, 0x22, 0x63, 0x02, 0xA9, 0xC4, 0x2B, 0x4B, 0x54, 0xA5, 0x96, 0xBD, 0xAF, 0x83, 0x75, 0xB5,
+0x81, 0xC8, 0x27, 0x32, 0xC9, 0x3A, 0x14, 0x9D, 0x35, 0xB5, 0xF0, 0x93, 0xD3, 0xA4, 0x55, 0xA5,
+0x68, 0x3A, 0x45, 0x1A, 0x4B, 0xC1, 0xEC, 0x5B, 0x12, 0x95, 0x92, 0xC1, 0xEA, 0x52, 0xC5, 0x19,
+0x91, 0xC3, 0x25, 0x22, 0x8B, 0x9C, 0xD6, 0xE6, 0xFE, 0xFF, 0xAB, 0x43, 0xC3, 0x30, 0xDE, 0x8C,
+0x9D, 0x06, 0x24, 0xD1, 0x85, 0x71, 0x00, 0xC1, 0x31, 0x8C, 0x5D, 0xEF, 0x71, 0xC2, 0xB2, 0x94,
+0x14, 0xA5, 0x7A, 0xD6, 0x99, 0xC0, 0x75, 0xAD, 0x7D, 0xC0, 0xF7, 0xBD, 0x64, 0x71, 0xC3, 0x18,
+0xC6, 0xF3, 0xA4, 0x34, 0xAD, 0x3D, 0xEF, 0x44, 0x71, 0x0C, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0xC2, 0xD7, 0xF7, 0x8E, 0xEF, 0xB0, 0xF7, 0x2A, 0x74, 0x7B, 0xC1, 0xFD, 0xFF, 0xFF, 0xFF, 0x04,
+0xC3, 0x35, 0xA6, 0x08, 0x2C, 0x0A, 0x3C, 0x50, 0x7C, 0x54, 0xC1, 0x92, 0x8C, 0x31, 0x84, 0x95,
+0xBE, 0x78, 0x72, 0x00, 0xC3, 0x08, 0x4B, 0x2E, 0xBD, 0x33, 0xE6, 0x18, 0xF7, 0x94, 0xC2, 0xF1,
+0xDD, 0x8B, 0x84, 0x26, 0x22, 0x72, 0xC3, 0xA7, 0x22, 0xAB, 0x43, 0x0A, 0x4B, 0x47, 0x2A, 0x66,
+0xC0, 0x07, 0x2B, 0xA7, 0xC2, 0x30, 0x74, 0x49, 0x42, 0x87, 0x31, 0xBE, 0x9A, 0xBB, 0x47, 0x53,
+0xC0, 0x29, 0x4A, 0x96, 0x53, 0x4E, 0x00, 0xC2, 0x29, 0x42, 0xCF, 0x6B, 0xE9, 0x3A, 0x75, 0x72,
+0x4B, 0x95, 0xC2, 0x51, 0x6C, 0xCD, 0x5A, 0x47, 0x29, 0xBE, 0x00, 0xAF, 0x7E, 0xA9, 0x01, 0x7A,
+0x00, 0x77, 0x7A, 0x02, 0x46, 0x7A, 0x01, 0x77, 0x00, 0x7A, 0x00, 0xAB, 0x7A, 0x77, 0x7A, 0x77,
+0x7A, 0x77, 0x72, 0x77, 0x00, 0x7A, 0x72, 0x00, 0x77, 0x01, 0xC8, 0x6B, 0x4A, 0xE3, 0x10, 0x89,
+0x42, 0xB6, 0xBD, 0xAD, 0x6B, 0x64, 0x11, 0x6D, 0x84, 0xAD, 0xEE, 0xEE, 0xDD, 0xAB, 0xC0, 0x2F,
+0xE6, 0x00, 0xA9, 0x96, 0xBD, 0x96, 0xC2, 0xF2, 0xA4, 0x88, 0x32, 0x46, 0x1A, 0x5F, 0xC0, 0x06,
+0x1A, 0xA0, 0x96, 0xC4, 0xA9, 0x32, 0x2F, 0x74, 0x71, 0x8C, 0xEC, 0x62, 0xCE, 0x73, 0xAF, 0xC8,
+0x67, 0x32, 0xA5, 0x19, 0xAA, 0x42, 0xEF, 0x7B, 0x4D, 0x73, 0x8D, 0x73, 0x50, 0x7C, 0xEA, 0x42,
+0x25, 0x1A, 0xAE, 0xC4, 0x2E, 0x6C, 0x38, 0xD6, 0xD8, 0xCD, 0xF0, 0x83, 0xA4, 0x19, 0x00, 0x63,
+0xC9, 0xE7, 0x52, 0xCD, 0xB4, 0xB6, 0xE6, 0x5A, 0xF7, 0x54, 0xE6, 0x8D, 0xCD, 0xA9, 0x64, 0x07,
+0x24, 0x95, 0x9E, 0xFF, 0xFF, 0x00, 0xC0, 0x55, 0xAD, 0x91, 0x79, 0xC2, 0x71, 0x8C, 0xD7, 0xBD,
+0x38, 0xC6, 0xBF, 0xC4, 0xB2, 0x94, 0xF7, 0xBD, 0x7D, 0xEF, 0xCF, 0x7B, 0xDB, 0xDE, 0x45, 0x79,
+0xC2, 0xF3, 0x9C, 0x3C, 0xE7, 0xD3, 0x9C, 0x71, 0x0C, 0x70, 0x00, 0x71, 0x04, 0xA9, 0xC1, 0xB3,
+0xF7, 0xAF, 0xEF, 0xA6, 0x28, 0x71, 0xB6, 0xC1, 0xD7, 0xF7, 0xFF, 0xFF, 0x05, 0xC2, 0xB7, 0xB6,
+0xE8, 0x2B, 0x0A, 0x3C, 0x64, 0xC0, 0x78, 0xBD, 0x95, 0xC0, 0xB4, 0x9C, 0xAE, 0xC1, 0x56, 0xAD,
+0xCA, 0x4A, 0x63, 0xBB, 0xAE, 0xC6, 0x28, 0x4B, 0x6C, 0x9C, 0x0D, 0xB5, 0xAC, 0xA4, 0x4B, 0x7C,
+0xCA, 0x44, 0x47, 0x23, 0x66, 0x9F, 0xC1, 0xCE, 0x63, 0x18, 0xCE, 0x59, 0xC5, 0x67, 0x22, 0xE7,
+0x22, 0x05, 0x1A, 0x2B, 0x4B, 0x08, 0x3A, 0xA8, 0x31, 0x4E, 0x4B, 0x4E, 0x00, 0xC1, 0xE8, 0x41,
+0x4A, 0x4A, 0xA9, 0xC0, 0xC8, 0x39, 0x4E, 0x00, 0xC1, 0xE8, 0x39, 0x89, 0x3A, 0x72, 0xC6, 0x25,
+0x1A, 0xA7, 0x2A, 0xE5, 0x19, 0x43, 0x09, 0x51, 0x74, 0x0E, 0x5B, 0x47, 0x29, 0xBF, 0x00, 0xAE,
+0xA9, 0xA6, 0x00, 0x9A, 0x41, 0x7A, 0x04, 0x46, 0x00, 0x9A, 0x7F, 0x00, 0x7A, 0x02, 0x77, 0x00,
+0x41, 0x77, 0x02, 0x7A, 0x72, 0x7A, 0x72, 0x77, 0x7A, 0x77, 0x72, 0xC1, 0xAC, 0x4A, 0x65, 0x21,
+0x5D, 0xC5, 0xF1, 0x83, 0x0B, 0x5B, 0x85, 0x19, 0xCC, 0x94, 0x91, 0xEE, 0x96, 0xC5, 0xAE, 0x02,
+0x95, 0xC3, 0xB4, 0xCD, 0x6E, 0xE6, 0x36, 0xC6, 0x8C, 0x4B, 0x76, 0xC3, 0x75, 0xAD, 0x70, 0x84,
+0xE7, 0x2A, 0xE5, 0x19, 0x7C, 0x70, 0xC1, 0x26, 0x22, 0x65, 0x19, 0x80, 0xC0, 0x64, 0x11, 0xAE,
+0x00, 0x95, 0x59, 0x6D, 0x7C, 0x6F, 0xA6, 0xC0, 0x25, 0x1A, 0x91, 0xC5, 0x2B, 0x5B, 0x34, 0xB5,
+0x75, 0xC5, 0x13, 0xAD, 0xE5, 0x29, 0x83, 0x11, 0xAF, 0xBE, 0xC2, 0x27, 0x5B, 0x4A, 0x9C, 0x8B,
+0xA4, 0x80, 0xC3, 0x27, 0x5C, 0xC6, 0x23, 0x68, 0x34, 0x39, 0xC7, 0x71, 0x00, 0xA6, 0xC2, 0xB2,
+0x9C, 0x10, 0x84, 0x3C, 0xE7, 0x91, 0xBB, 0xAE, 0xC1, 0x92, 0x94, 0x9A, 0xD6, 0x71, 0x60, 0xC1,
+0xCF, 0x7B, 0x96, 0xB5, 0x71, 0xC1, 0x38, 0xC6, 0x9E, 0xF7, 0x65, 0x71, 0x0C, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x06, 0xC0, 0xDA, 0xFF, 0xA8, 0x28, 0xAB, 0xC0, 0xFC, 0xFF, 0x71, 0x01, 0x58, 0xAE,
+0x71, 0x01, 0xC4, 0x97, 0xB6, 0x86, 0x1B, 0x0A, 0x3C, 0x75, 0xAD, 0xF6, 0xA4, 0x94, 0x92, 0xBE,
+0xC1, 0xF5, 0xA4, 0x69, 0x3A, 0x4A, 0xBA, 0xAF, 0x9A, 0x7C, 0xC0, 0x66, 0x2A, 0x00, 0xC3, 0xA7,
+0x2A, 0x68, 0x2B, 0x89, 0x34, 0x06, 0x23, 0x5E, 0x47, 0xC7, 0x57, 0xDE, 0x73, 0xAD, 0x06, 0x22,
+0xA6, 0x22, 0xE8, 0x32, 0x0F, 0x6C, 0x4A, 0x4A, 0xA7, 0x31, 0xBB, 0x53, 0x01, 0xC0, 0x09, 0x42,
+0xAE, 0xA2, 0x53, 0x4E, 0x00, 0x53, 0xC4, 0x4D, 0x63, 0x88, 0x32, 0xE7, 0x2A, 0x25, 0x1A, 0x63,
+0x11, 0x4D, 0xC1, 0x51, 0x6C, 0x93, 0x8C, 0x7A, 0x9A, 0x7A, 0xAF, 0xA6, 0x77, 0x01, 0x41, 0x7A,
+0x41, 0x7A, 0x00, 0x77, 0x7A, 0x77, 0xAB, 0xAE, 0x46, 0x7A, 0x00, 0x96, 0x7A, 0x00, 0x77, 0x00,
+0x41, 0x77, 0x72, 0x7A, 0x77, 0x72, 0x03, 0x7A, 0x77, 0x00, 0xC8, 0xCC, 0x52, 0x04, 0x19, 0x08,
+0x42, 0x55, 0xAD, 0x6E, 0x73, 0x65, 0x21, 0x2E, 0xA5, 0x92, 0xEE, 0x55, 0xB5, 0xAE, 0xBF, 0x67,
+0xA6, 0xC7, 0x76, 0xBD, 0xD6, 0xC5, 0xB0, 0xE6, 0x77, 0xBE, 0x27, 0x22, 0xC8, 0x3A, 0xF0, 0x83,
+0x8E, 0x73, 0x73, 0xC2, 0x87, 0x2A, 0x4C, 0x53, 0x8A, 0x6B, 0xA1, 0xC0, 0xA7, 0x52, 0xBF, 0xC0,
+0x6B, 0x6B, 0xAF, 0xBF, 0xC0, 0xC8, 0x52, 0x00, 0xA6, 0xC0, 0x49, 0x63, 0x97, 0xC1, 0xCA, 0x4A,
+0x04, 0x1A, 0x57, 0xC1, 0x6A, 0x6B, 0xF1, 0xE5, 0x96, 0x95, 0xC0, 0x26, 0x3A, 0x4A, 0xC0, 0x84,
+0x19, 0xAE, 0x9E, 0xC0, 0x64, 0x22, 0xBF, 0x85, 0xC3, 0xC4, 0x1A, 0xE6, 0x2B, 0x88, 0x34, 0x3A,
+0xCF, 0x71, 0x07, 0xC0, 0x3C, 0xE7, 0x5D, 0x71, 0x14, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x36, 0xC1,
+0x5D, 0xEF, 0xBA, 0xDE, 0x75, 0xC0, 0x9D, 0xEF, 0xBA, 0xC3, 0x36, 0xB6, 0x2B, 0x4C, 0xAD, 0x64,
+0xB6, 0xB5, 0x67, 0xC0, 0xB7, 0xBD, 0xA9, 0x6C, 0xC2, 0x14, 0xA5, 0x6C, 0x63, 0xA9, 0x4A, 0xAE,
+0xC0, 0x0A, 0x53, 0x64, 0xCB, 0x8C, 0x63, 0xCC, 0x6B, 0x2D, 0x74, 0x6A, 0x43, 0x87, 0x22, 0xE6,
+0x22, 0x48, 0x34, 0x24, 0x12, 0xEE, 0x73, 0x75, 0xDE, 0x92, 0xB5, 0x67, 0x2A, 0x89, 0xB6, 0xC1,
+0xA9, 0x32, 0xE8, 0x39, 0xA1, 0xAB, 0xAE, 0xC1, 0x09, 0x42, 0x4A, 0x4A, 0xA5, 0x9A, 0x00, 0x67,
+0x4E, 0x00, 0x99, 0xC0, 0x27, 0x32, 0x50, 0xC6, 0x08, 0x2B, 0x86, 0x22, 0x84, 0x11, 0x23, 0x09,
+0x30, 0x74, 0xB3, 0x94, 0x87, 0x31, 0x96, 0xBA, 0x41, 0x9A, 0x00, 0x41, 0x00, 0x7A, 0x02, 0x77,
+0x00, 0x7E, 0x77, 0x02, 0xB6, 0x7A, 0x41, 0x77, 0x00, 0x7A, 0x41, 0x00, 0x77, 0x00, 0x7A, 0x72,
+0x03, 0x77, 0x7A, 0x72, 0x7E, 0xC2, 0xED, 0x52, 0x04, 0x19, 0xC7, 0x31, 0x7D, 0xC4, 0x8E, 0x6B,
+0x45, 0x19, 0xEE, 0xA4, 0xB3, 0xE6, 0x35, 0xB5, 0x95, 0x00, 0xC0, 0x55, 0xB5, 0x62, 0xC5, 0x76,
+0xBD, 0xD6, 0xCD, 0xB0, 0xE6, 0xB4, 0xAD, 0x27, 0x2A, 0x89, 0x3A, 0x77, 0xC0, 0x05, 0x21, 0x66,
+0xC1, 0x68, 0x2A, 0x31, 0xAD, 0x6E, 0xC0, 0x32, 0xBD, 0xAE, 0x50, 0xBF, 0xAE, 0x5F, 0xA5, 0x50,
+0xA6, 0xA9, 0xC5, 0x6F, 0xD5, 0x4D, 0x8C, 0x63, 0x11, 0xC5, 0x19, 0xF1, 0x94, 0xF0, 0xE5, 0x92,
+0x9B, 0xC0, 0x46, 0x42, 0x45, 0xC0, 0x64, 0x11, 0xBE, 0xAE, 0x9A, 0x01, 0xC3, 0x65, 0x1A, 0xE7,
+0x2B, 0x88, 0x2C, 0xF8, 0xB6, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x37, 0xC2, 0x3C, 0xE7,
+0x38, 0xCE, 0x79, 0xD6, 0x00, 0xA9, 0x7C, 0x01, 0xBA, 0x7C, 0xBE, 0xAF, 0x00, 0xA6, 0x50, 0xA9,
+0xAE, 0xBA, 0xAB, 0xAE, 0x51, 0xCE, 0x2E, 0x74, 0xA7, 0x22, 0xA4, 0x19, 0x88, 0x2B, 0x44, 0x12,
+0x2F, 0x7C, 0x78, 0xFF, 0x13, 0xCE, 0x08, 0x33, 0x68, 0x2B, 0x8A, 0x33, 0xCD, 0x63, 0x6A, 0x42,
+0x87, 0x31, 0xC8, 0x39, 0x00, 0xC0, 0x09, 0x42, 0xBE, 0xAF, 0x67, 0x00, 0xAE, 0x53, 0xA6, 0x67,
+0xC3, 0xAE, 0x6B, 0x09, 0x33, 0x67, 0x2B, 0x66, 0x22, 0x66, 0xC2, 0x43, 0x11, 0x30, 0x6C, 0x2E,
+0x63, 0x7A, 0xC0, 0xC9, 0x39, 0x7E, 0x7A, 0x77, 0x00, 0x41, 0x00, 0x7A, 0x00, 0x77, 0x46, 0xC1,
+0x6B, 0x4A, 0xE9, 0x39, 0x46, 0x00, 0x77, 0x01, 0x7A, 0x00, 0x41, 0x00, 0x77, 0x00, 0x41, 0x00,
+0x77, 0x01, 0x7A, 0x00, 0x96, 0x00, 0x77, 0x00, 0x72, 0x00, 0x77, 0xC1, 0x0E, 0x5B, 0x85, 0x19,
+0xBE, 0xC0, 0x28, 0x3A, 0x95, 0xC5, 0xA5, 0x19, 0xAC, 0x8C, 0xB3, 0xE6, 0x55, 0xB5, 0xB3, 0xA4,
+0x34, 0xAD, 0xAB, 0xBA, 0xC3, 0x96, 0xBD, 0xF6, 0xCD, 0x6F, 0xE6, 0x09, 0x5B, 0x6D, 0xC2, 0x8A,
+0x3A, 0x2A, 0x4A, 0xC8, 0x39, 0x61, 0xC1, 0xE9, 0x3A, 0x75, 0xD6, 0x50, 0xC0, 0xF4, 0xA4, 0xA0,
+0x95, 0xAB, 0x73, 0xBF, 0x73, 0x00, 0xC0, 0xF4, 0xAC, 0x4B, 0xC1, 0xD1, 0xD5, 0xCD, 0xA4, 0x4D,
+0xC1, 0x84, 0x11, 0x70, 0x84, 0x6B, 0xC0, 0x70, 0xCD, 0x9E, 0x5C, 0xC0, 0x03, 0x11, 0x59, 0x5E,
+0x63, 0xAE, 0xAE, 0x00, 0xC0, 0x85, 0x1A, 0x5B, 0xC2, 0x68, 0x2C, 0xF7, 0xB6, 0xFF, 0xFF, 0x1F,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x36, 0x91, 0xC2, 0x1B, 0xE7, 0x9A, 0xDE, 0xFB, 0xE6, 0x01, 0xBF,
+0xAE, 0xAF, 0x78, 0x44, 0x01, 0xBF, 0x00, 0xAE, 0x00, 0xC3, 0x1C, 0xE7, 0xB6, 0xBD, 0x18, 0xCE,
+0x7D, 0xF7, 0xA6, 0xC1, 0x4C, 0x63, 0x63, 0x11, 0xAE, 0xCA, 0x27, 0x2B, 0x45, 0x1A, 0xCE, 0x6B,
+0x16, 0xD6, 0x70, 0x94, 0x45, 0x22, 0xE6, 0x22, 0x65, 0x22, 0x89, 0x3A, 0x09, 0x3A, 0xA8, 0x39,
+0xAE, 0x4E, 0x53, 0xBF, 0x6F, 0x96, 0x00, 0x62, 0x53, 0x00, 0x9E, 0xC4, 0x69, 0x3A, 0x66, 0x22,
+0xC6, 0x22, 0x65, 0x22, 0x05, 0x1A, 0xAE, 0xC3, 0x50, 0x64, 0xCD, 0x52, 0x27, 0x29, 0x88, 0x31,
+0xA5, 0x04, 0x46, 0x77, 0x72, 0xC1, 0x4A, 0x4A, 0xCC, 0x5A, 0x96, 0xA6, 0xC0, 0x0A, 0x42, 0x72,
+0x7A, 0x01, 0xAB, 0x77, 0x41, 0x00, 0x77, 0x46, 0x41, 0x9A, 0x77, 0x72, 0x6E, 0xC0, 0xAC, 0x5A,
+0x95, 0x5A, 0x72, 0x7A, 0x72, 0x00, 0xBA, 0xC1, 0x0E, 0x5B, 0x85, 0x21, 0xAE, 0xC0, 0xE7, 0x29,
+0x61, 0xC5, 0x48, 0x2A, 0x4F, 0xA5, 0x93, 0xE6, 0x15, 0xAD, 0xB3, 0xA4, 0x34, 0xAD, 0xBF, 0xA6,
+0xCD, 0x76, 0xBD, 0xF6, 0xD5, 0x8F, 0xE6, 0xF2, 0x94, 0x47, 0x22, 0x4B, 0x4B, 0x38, 0xC6, 0x34,
+0x9D, 0xE5, 0x19, 0x6B, 0x43, 0xD6, 0xDE, 0xF5, 0xCD, 0xD3, 0xA4, 0x70, 0xA4, 0x96, 0xAE, 0xC1,
+0xB1, 0xAC, 0x34, 0xBD, 0x6F, 0x5B, 0xC4, 0xB2, 0xA4, 0xF4, 0xA4, 0xD0, 0xD5, 0x8C, 0xA4, 0x84,
+0x19, 0x80, 0xC1, 0x29, 0x53, 0xF1, 0xD5, 0x93, 0x85, 0xC2, 0x26, 0x3A, 0x23, 0x11, 0x63, 0x11,
+0xAF, 0xC1, 0x65, 0x2A, 0x47, 0x53, 0xBA, 0x85, 0xC4, 0x66, 0x2B, 0xE6, 0x2B, 0x48, 0x2C, 0xD7,
+0xAE, 0xFF, 0xFF, 0x00, 0xC2, 0x1C, 0xE7, 0xB6, 0xBD, 0x3C, 0xE7, 0x71, 0x1A, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x35, 0x91, 0xC2, 0x79, 0xD6, 0xBA, 0xDE, 0x5D, 0xEF, 0x91, 0x7C, 0x91, 0x7C, 0x00,
+0xC0, 0x18, 0xC6, 0xA5, 0x60, 0xC0, 0xDB, 0xDE, 0x44, 0xBF, 0xAE, 0x01, 0xD2, 0xD8, 0xC5, 0x6B,
+0x52, 0x6F, 0x73, 0x3D, 0xEF, 0x9D, 0xF7, 0xEF, 0x83, 0xAA, 0x4A, 0x06, 0x32, 0x06, 0x23, 0x65,
+0x1A, 0x69, 0x3A, 0xF3, 0x94, 0xCA, 0x4A, 0x83, 0x11, 0x05, 0x1A, 0xA8, 0x2A, 0xCE, 0x63, 0x08,
+0x3A, 0xA7, 0x31, 0xBF, 0xAE, 0xBF, 0xC0, 0x6A, 0x52, 0x96, 0xA6, 0x7B, 0xC0, 0xE9, 0x39, 0x53,
+0xA6, 0xC4, 0x09, 0x3A, 0xAE, 0x63, 0xE9, 0x32, 0xC6, 0x22, 0x24, 0x1A, 0xA2, 0x52, 0xC1, 0x10,
+0x6C, 0xCE, 0x5A, 0x72, 0xAE, 0xB6, 0x77, 0x00, 0xBA, 0x01, 0xAB, 0x77, 0x00, 0x53, 0x67, 0x4E,
+0xC2, 0x0D, 0x6B, 0xE9, 0x41, 0x67, 0x31, 0x77, 0x7A, 0x00, 0x77, 0xAB, 0x7A, 0x41, 0x7A, 0x46,
+0x7E, 0x77, 0x72, 0x00, 0x46, 0xC0, 0xAB, 0x52, 0x67, 0x77, 0x02, 0x72, 0x00, 0xC3, 0x29, 0x3A,
+0x03, 0x11, 0x08, 0x32, 0xB3, 0x9C, 0x4A, 0xCF, 0xC6, 0x19, 0xCD, 0x94, 0x93, 0xDE, 0x35, 0xB5,
+0xB2, 0x9C, 0x34, 0xAD, 0xD3, 0xA4, 0x14, 0xAD, 0x97, 0xBD, 0x17, 0xD6, 0x8F, 0xE6, 0x2F, 0x7C,
+0x06, 0x22, 0x67, 0x2A, 0x70, 0x74, 0xEA, 0x42, 0x7C, 0xC3, 0xAB, 0x4B, 0x58, 0xE7, 0x33, 0xB5,
+0xD4, 0xA4, 0x7F, 0x00, 0xAE, 0xBB, 0x53, 0x4E, 0x90, 0x44, 0xC3, 0xF5, 0xA4, 0x13, 0xD6, 0x6D,
+0xA4, 0xE5, 0x19, 0x90, 0xC1, 0x48, 0x5B, 0x50, 0xBD, 0x44, 0xC1, 0x95, 0xB5, 0xE6, 0x29, 0x4D,
+0x59, 0xC9, 0x86, 0x32, 0x4A, 0x94, 0xCC, 0xBC, 0x0C, 0xC5, 0x6A, 0xAC, 0xE8, 0x7B, 0x06, 0x34,
+0x47, 0x2C, 0xD7, 0xB6, 0xFF, 0xFF, 0x00, 0xC1, 0xD3, 0x9C, 0xEF, 0x83, 0x96, 0xC1, 0x7D, 0xEF,
+0xBE, 0xF7, 0x71, 0x5D, 0x71, 0x00, 0xA6, 0x00, 0x71, 0x01, 0x5D, 0xA6, 0x71, 0x01, 0x5D, 0x71,
+0xA1, 0x71, 0x07, 0x70, 0x00, 0x71, 0x35, 0x58, 0xC1, 0xDB, 0xE6, 0x7D, 0xF7, 0x6C, 0x4C, 0x95,
+0x68, 0xC0, 0x75, 0xB5, 0x7C, 0xC4, 0x4D, 0x73, 0x89, 0x52, 0xAE, 0x7B, 0x35, 0xAD, 0x7E, 0xF7,
+0x9A, 0x53, 0x50, 0xC4, 0xBF, 0xFF, 0x19, 0xC6, 0x8C, 0x52, 0xEE, 0x62, 0x5D, 0xEF, 0x71, 0xC0,
+0x54, 0xB5, 0x4E, 0xC0, 0x4C, 0x63, 0x6E, 0xCC, 0x85, 0x1A, 0xE6, 0x21, 0xC8, 0x32, 0xE5, 0x21,
+0x46, 0x22, 0xE7, 0x2A, 0x87, 0x2A, 0x4C, 0x4B, 0x28, 0x3A, 0xA8, 0x31, 0xE9, 0x41, 0x6A, 0x52,
+0x09, 0x42, 0xBE, 0x67, 0x62, 0x67, 0x95, 0xA6, 0xA6, 0xC8, 0xE8, 0x31, 0x89, 0x3A, 0xE8, 0x2A,
+0x48, 0x2B, 0x45, 0x1A, 0xC4, 0x19, 0x05, 0x1A, 0x50, 0x64, 0xAD, 0x52, 0x72, 0xAE, 0x72, 0xBE,
+0x72, 0x00, 0x7A, 0x00, 0x72, 0x00, 0xBF, 0x7A, 0xAF, 0xC0, 0xC9, 0x39, 0x67, 0x7A, 0x72, 0xA9,
+0x7A, 0x77, 0x01, 0x7A, 0x77, 0x7A, 0x77, 0x00, 0x72, 0x01, 0xC0, 0xE9, 0x39, 0x63, 0xA5, 0x5F,
+0x77, 0x00, 0xA7, 0x41, 0x7A, 0xC9, 0xA7, 0x29, 0xE3, 0x10, 0x69, 0x42, 0x76, 0xB5, 0x2D, 0x63,
+0x44, 0x19, 0xCD, 0x9C, 0xB4, 0xE6, 0x56, 0xB5, 0xF3, 0xA4, 0x6C, 0xA6, 0x95, 0x73, 0xC3, 0xF7,
+0xCD, 0x8F, 0xE6, 0xAC, 0x7B, 0xC6, 0x21, 0x84, 0x00, 0x50, 0xC4, 0xC6, 0x22, 0xC9, 0x3A, 0xF2,
+0xBD, 0x0E, 0xAD, 0x4F, 0x9C, 0xAE, 0xBA, 0x91, 0xA6, 0x99, 0xC0, 0x4E, 0x9C, 0x00, 0x96, 0x00,
+0xC2, 0x11, 0xDE, 0x2D, 0x94, 0xC5, 0x19, 0x99, 0xC1, 0x6B, 0x53, 0x70, 0x94, 0x47, 0x9A, 0xC0,
+0xC5, 0x21, 0x80, 0xC3, 0xC4, 0x19, 0x4A, 0x84, 0x72, 0xDE, 0x79, 0xF7, 0xAF, 0xC5, 0x72, 0xE6,
+0x6A, 0xAC, 0x48, 0x74, 0x47, 0x24, 0xD7, 0xB6, 0xFF, 0xFF, 0x00, 0xC1, 0x14, 0xA5, 0x7D, 0xEF,
+0x58, 0xC5, 0x0C, 0x63, 0x71, 0x94, 0x9A, 0xD6, 0xCF, 0x7B, 0x71, 0x8C, 0x9E, 0xF7, 0x59, 0xC6,
+0xAE, 0x73, 0xF7, 0xC5, 0xBA, 0xD6, 0xAE, 0x7B, 0xB2, 0x9C, 0x31, 0x8C, 0xF4, 0xA4, 0x71, 0x4B,
+0x6C, 0xC0, 0x51, 0x8C, 0x91, 0xC0, 0x55, 0xAD, 0x71, 0x06, 0x70, 0x00, 0x71, 0x06, 0x96, 0xA6,
+0x29, 0xBE, 0x71, 0x00, 0x58, 0xC1, 0xDB, 0xE6, 0x7D, 0xF7, 0x6C, 0x00, 0x71, 0xC0, 0x18, 0xD6,
+0x73, 0x80, 0x40, 0xC0, 0x6D, 0x73, 0x40, 0xC0, 0x14, 0xAD, 0x58, 0x91, 0xAF, 0xBA, 0x71, 0xC1,
+0xBB, 0xDE, 0xCE, 0x62, 0x56, 0xC0, 0xDB, 0xDE, 0x71, 0xC3, 0x34, 0xAD, 0xB4, 0x9C, 0x50, 0x84,
+0x06, 0x23, 0xA2, 0xB3, 0x9E, 0xBE, 0x9A, 0xC3, 0x04, 0x1A, 0x67, 0x2A, 0x6A, 0x33, 0xCC, 0x42,
+0x7A, 0xC0, 0xC8, 0x39, 0x00, 0x96, 0xA9, 0x53, 0x4B, 0xBA, 0x44, 0x4B, 0x4E, 0xC5, 0x29, 0x3A,
+0xC5, 0x19, 0x86, 0x22, 0x47, 0x2B, 0xC6, 0x22, 0x65, 0x22, 0x9A, 0xC0, 0x0F, 0x5C, 0x62, 0xC0,
+0x47, 0x29, 0x77, 0xB6, 0x72, 0x77, 0x00, 0xBB, 0x72, 0x77, 0x72, 0x00, 0xC1, 0x2A, 0x4A, 0xCC,
+0x5A, 0x00, 0xAF, 0xC0, 0xC9, 0x39, 0x72, 0x77, 0x02, 0x7A, 0x00, 0x77, 0x02, 0x72, 0x77, 0x72,
+0xC2, 0xA8, 0x39, 0xE9, 0x41, 0x4A, 0x4A, 0x4E, 0x7A, 0x77, 0x72, 0x7A, 0x00, 0x8E, 0xC2, 0xE3,
+0x10, 0xC6, 0x31, 0x11, 0x8C, 0x63, 0xC2, 0x24, 0x11, 0xAC, 0x94, 0x93, 0xE6, 0x73, 0xA5, 0xAE,
+0xA1, 0x9B, 0x73, 0xCE, 0x17, 0xCE, 0xD0, 0xEE, 0x74, 0xB5, 0x27, 0x2A, 0xA4, 0x11, 0x46, 0x22,
+0x68, 0x2B, 0x24, 0x1A, 0x67, 0x32, 0x91, 0x8C, 0x2F, 0xB5, 0xAD, 0xAC, 0x2B, 0x9C, 0x89, 0x83,
+0x4D, 0x9C, 0xBF, 0x00, 0x7B, 0xC1, 0x06, 0x73, 0x88, 0x8B, 0xAE, 0xAB, 0xC1, 0xEA, 0x5A, 0x25,
+0x22, 0x7A, 0xB3, 0xC0, 0xA8, 0x32, 0x00, 0xC1, 0x06, 0x2A, 0xA4, 0x19, 0x96, 0xC3, 0x46, 0x2A,
+0xEC, 0xAC, 0x9A, 0xF7, 0xFE, 0xFF, 0x71, 0x7C, 0xC3, 0xAE, 0xD5, 0xEA, 0x9C, 0x47, 0x2C, 0xB7,
+0xAE, 0x71, 0x00, 0xC1, 0xF3, 0x9C, 0xAE, 0x73, 0x40, 0xC2, 0x8E, 0x73, 0x7D, 0xEF, 0x55, 0xAD,
+0x48, 0xC5, 0x75, 0xAD, 0xD3, 0x9C, 0x96, 0xB5, 0x79, 0xCE, 0x14, 0xA5, 0x18, 0xC6, 0x50, 0xC1,
+0xDF, 0xFF, 0x38, 0xC6, 0x58, 0xC0, 0xBE, 0xF7, 0x54, 0xC2, 0xFB, 0xDE, 0xEF, 0x83, 0xDB, 0xDE,
+0x70, 0x6C, 0x71, 0x05, 0x70, 0x00, 0x71, 0x05, 0xC0, 0x5E, 0xE7, 0x92, 0x2A, 0xAE, 0xC0, 0x9F,
+0xF7, 0x71, 0xC2, 0x9D, 0xF7, 0xDB, 0xE6, 0x7E, 0xF7, 0x6C, 0xA6, 0x71, 0xC1, 0x59, 0xD6, 0xB7,
+0xBD, 0x81, 0x50, 0xC1, 0x92, 0x94, 0x30, 0x8C, 0x5B, 0xC0, 0x9E, 0xF7, 0x96, 0x53, 0x95, 0xB6,
+0xC1, 0x59, 0xCE, 0xCD, 0x5A, 0x76, 0xC5, 0x6D, 0x73, 0xB6, 0xBD, 0x54, 0xAD, 0xB7, 0xAD, 0xD2,
+0x8C, 0x26, 0x23, 0xA2, 0xA2, 0xC2, 0x08, 0x2B, 0x86, 0x22, 0x24, 0x1A, 0xA3, 0xC5, 0x29, 0x33,
+0x53, 0x75, 0x32, 0x74, 0x4A, 0x42, 0xC8, 0x39, 0x09, 0x42, 0x53, 0xC0, 0x29, 0x42, 0x53, 0x67,
+0x95, 0x53, 0xA6, 0xC2, 0x2A, 0x42, 0xEE, 0x52, 0xE8, 0x2A, 0x91, 0x69, 0xA5, 0xA2, 0xC2, 0x04,
+0x1A, 0xCE, 0x5B, 0xCD, 0x52, 0x72, 0xBE, 0x00, 0x9A, 0x02, 0x72, 0x7A, 0x77, 0x72, 0xC1, 0xC9,
+0x41, 0x0D, 0x6B, 0x9A, 0xC0, 0xAC, 0x5A, 0x4E, 0x81, 0x01, 0xBA, 0x72, 0x7A, 0x00, 0x77, 0x00,
+0xBB, 0x77, 0x72, 0x00, 0x7A, 0xC2, 0xCC, 0x5A, 0x4E, 0x6B, 0x8B, 0x52, 0xA6, 0x7A, 0x72, 0x02,
+0x78, 0xC7, 0xE3, 0x18, 0x28, 0x42, 0x97, 0xBD, 0x6E, 0x73, 0xC3, 0x08, 0x4B, 0x8C, 0x53, 0xDE,
+0xD8, 0xC5, 0xAD, 0xBF, 0x96, 0xA1, 0x42, 0xCA, 0x37, 0xD6, 0xF0, 0xEE, 0x78, 0xC6, 0x48, 0x2A,
+0x25, 0x1A, 0x48, 0x2B, 0x45, 0x1A, 0xA4, 0x11, 0x29, 0x33, 0x2E, 0x64, 0x4B, 0x4B, 0x95, 0xC3,
+0xC8, 0x3A, 0x68, 0x2A, 0x8E, 0x53, 0xF0, 0x63, 0xAE, 0x61, 0xC1, 0x84, 0x19, 0x06, 0x2A, 0xA1,
+0x92, 0xC1, 0x47, 0x2A, 0x27, 0x2B, 0x75, 0xC3, 0x64, 0x11, 0xE4, 0x19, 0x65, 0x1A, 0x83, 0x11,
+0xBF, 0x96, 0xC3, 0x46, 0x2A, 0x6B, 0x94, 0xF7, 0xEE, 0xFE, 0xFF, 0x71, 0xC5, 0x9B, 0xF7, 0x10,
+0xDE, 0x6C, 0xA5, 0x47, 0x2C, 0xB6, 0xAE, 0xFF, 0xFF, 0x00, 0xC0, 0xF3, 0x9C, 0xBF, 0xC0, 0x7D,
+0xEF, 0x7C, 0x71, 0xC0, 0xF4, 0xA4, 0x49, 0xC1, 0x59, 0xCE, 0x10, 0x84, 0x74, 0x44, 0xC1, 0x75,
+0xB5, 0x38, 0xC6, 0x74, 0xC2, 0xF7, 0xBD, 0xF3, 0xA4, 0xEF, 0x7B, 0x49, 0x41, 0xC0, 0x9E, 0xF7,
+0x41, 0x58, 0x41, 0xC1, 0xBE, 0xF7, 0xFF, 0xFF, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1,
+0x9F, 0xEF, 0x1E, 0xDF, 0x2D, 0xC0, 0xDF, 0xFF, 0x90, 0xC1, 0xFB, 0xE6, 0x5D, 0xF7, 0x6C, 0xC0,
+0x5D, 0xEF, 0x91, 0x74, 0xC0, 0xF8, 0xC5, 0x95, 0x91, 0xC0, 0x14, 0xAD, 0x91, 0xC0, 0xF7, 0xCD,
+0x58, 0xA6, 0x58, 0x44, 0xA6, 0x78, 0xC0, 0x6B, 0x4A, 0xA1, 0xC2, 0xA3, 0x18, 0x6E, 0x73, 0x75,
+0xB5, 0x50, 0xC1, 0xCE, 0x73, 0x07, 0x23, 0xA1, 0xC0, 0x65, 0x22, 0xAF, 0xA9, 0xC3, 0xE4, 0x19,
+0x87, 0x22, 0x29, 0x2B, 0x38, 0xA6, 0x92, 0xCC, 0x2B, 0x3B, 0xE7, 0x29, 0xCF, 0x73, 0xC7, 0x31,
+0xCC, 0x5A, 0x66, 0x29, 0xAF, 0x6B, 0x08, 0x32, 0x8E, 0x6B, 0xA6, 0x29, 0x4A, 0x32, 0xEA, 0x3A,
+0x87, 0x2B, 0xA2, 0x64, 0xC0, 0x04, 0x1A, 0xA2, 0x91, 0xC3, 0xAE, 0x5B, 0xAC, 0x52, 0x26, 0x29,
+0x67, 0x31, 0x96, 0xAE, 0x00, 0x72, 0x77, 0x72, 0x77, 0x01, 0x72, 0xC2, 0x09, 0x42, 0x4A, 0x4A,
+0xE9, 0x39, 0x72, 0x77, 0x00, 0x7A, 0x77, 0x72, 0x77, 0x01, 0x72, 0x00, 0x77, 0xAB, 0x77, 0x00,
+0xC1, 0x6B, 0x52, 0xED, 0x62, 0x91, 0x4A, 0x77, 0x00, 0xA6, 0x01, 0xC9, 0x0D, 0x53, 0xA6, 0x21,
+0xE7, 0x31, 0x71, 0x84, 0x69, 0x42, 0x65, 0x19, 0x0D, 0xA5, 0x6F, 0xE6, 0xB5, 0xC5, 0xF5, 0xCD,
+0xAB, 0xBE, 0x00, 0x82, 0xC4, 0x54, 0xDE, 0xEE, 0xEE, 0x34, 0xAD, 0x48, 0x32, 0x07, 0x23, 0x46,
+0xC2, 0xA4, 0x11, 0xA7, 0x22, 0x08, 0x2B, 0x75, 0xA6, 0xA5, 0x95, 0xB7, 0x96, 0x00, 0xAE, 0x46,
+0xA6, 0x02, 0x64, 0xC1, 0x65, 0x1A, 0x84, 0x11, 0x63, 0x41, 0xC0, 0x65, 0x22, 0x63, 0xC0, 0x26,
+0x22, 0xAE, 0x91, 0xC2, 0x27, 0x63, 0xED, 0xBC, 0xF7, 0xEE, 0x43, 0xC5, 0x75, 0xE6, 0x6D, 0xCD,
+0xE9, 0x7C, 0x07, 0x24, 0xB6, 0xAE, 0xFF, 0xFF, 0x00, 0xC1, 0xD3, 0x9C, 0xBA, 0xD6, 0x71, 0xC0,
+0x71, 0x8C, 0x71, 0x78, 0xC0, 0x34, 0xA5, 0x68, 0xC2, 0xD7, 0xBD, 0x71, 0x94, 0xB2, 0x94, 0x55,
+0x60, 0x65, 0x55, 0xC2, 0xF7, 0xBD, 0x6D, 0x73, 0x7D, 0xEF, 0x6D, 0xC0, 0x7E, 0xF7, 0x68, 0x49,
+0xC1, 0xB2, 0x9C, 0xBE, 0xF7, 0x71, 0x05, 0x70, 0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF, 0x1E, 0xDF,
+0x02, 0xAE, 0x7B, 0x06, 0x40, 0x7B, 0x02, 0x40, 0x00, 0x7B, 0x01, 0x40, 0x7B, 0x15, 0xC0, 0xBF,
+0xF7, 0xA4, 0xC3, 0xDB, 0xE6, 0x3D, 0xEF, 0xBF, 0xFF, 0x1C, 0xE7, 0x91, 0xA6, 0xC0, 0xFC, 0xDE,
+0x7F, 0x70, 0x01, 0xC0, 0x5E, 0xEF, 0x00, 0x50, 0x01, 0x5D, 0xC1, 0x97, 0xB5, 0x2B, 0x42, 0xBE,
+0xC1, 0xC8, 0x39, 0x31, 0x8C, 0x6D, 0xC4, 0x2C, 0x63, 0x8A, 0x42, 0x07, 0x2B, 0x85, 0x1A, 0x04,
+0x1A, 0x4E, 0x00, 0x5A, 0xC0, 0xE7, 0x2A, 0xAF, 0xC0, 0x6A, 0x3B, 0x96, 0xC0, 0xC6, 0x1A, 0xB2,
+0xB7, 0xC6, 0x85, 0x19, 0x06, 0x22, 0x84, 0x19, 0x47, 0x2A, 0x86, 0x22, 0xE8, 0x32, 0x87, 0x22,
+0x5A, 0x78, 0x91, 0xC0, 0x07, 0x23, 0x64, 0xC4, 0x45, 0x22, 0xE4, 0x19, 0x23, 0x09, 0xAF, 0x5B,
+0xCD, 0x52, 0x72, 0x01, 0xAE, 0x72, 0x77, 0x00, 0x72, 0x77, 0x00, 0x72, 0xC2, 0x09, 0x42, 0x6E,
+0x73, 0x0D, 0x63, 0x95, 0xC0, 0xC9, 0x39, 0x72, 0x00, 0xAE, 0x03, 0xBA, 0xC0, 0xA8, 0x39, 0x72,
+0xBF, 0xAE, 0x72, 0x00, 0x7A, 0x46, 0xC0, 0xE9, 0x39, 0x46, 0x72, 0x03, 0xC4, 0x2D, 0x5B, 0xC6,
+0x21, 0x64, 0x11, 0x46, 0x22, 0x43, 0x11, 0x7C, 0xC2, 0x4D, 0x84, 0x6D, 0xE6, 0x0D, 0xDE, 0x9B,
+0xAE, 0xB6, 0xA6, 0x95, 0xC4, 0x2D, 0xE6, 0x4F, 0xDE, 0x51, 0x94, 0x47, 0x32, 0xC6, 0x22, 0x6B,
+0xC0, 0x66, 0x22, 0x73, 0x9A, 0xC0, 0x27, 0x2B, 0x64, 0xA6, 0x00, 0xC0, 0x45, 0x1A, 0xAB, 0xC0,
+0x86, 0x22, 0xA5, 0xC0, 0x65, 0x32, 0xBF, 0x00, 0x9E, 0xBA, 0x95, 0xC0, 0xC4, 0x21, 0x9B, 0xA5,
+0xC0, 0x25, 0x1A, 0x5A, 0xC0, 0xE4, 0x11, 0x73, 0x7F, 0x41, 0x5A, 0xC7, 0x2A, 0x74, 0x4B, 0xA4,
+0xAD, 0xBC, 0x4A, 0xA4, 0x48, 0x74, 0xE6, 0x33, 0x27, 0x24, 0xB6, 0xAE, 0x71, 0x00, 0xC0, 0x9A,
+0xD6, 0x44, 0x71, 0xC0, 0x79, 0xCE, 0x71, 0x91, 0xC1, 0xB2, 0x9C, 0x96, 0xB5, 0x71, 0xC3, 0x38,
+0xC6, 0x71, 0x8C, 0x75, 0xB5, 0x1C, 0xE7, 0xAE, 0x00, 0xC0, 0xB2, 0x94, 0x78, 0xC0, 0xDF, 0xFF,
+0x48, 0x6C, 0x48, 0x5D, 0x48, 0x6C, 0x71, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x7E,
+0xEF, 0x7B, 0x00, 0x40, 0xBF, 0xC1, 0xFD, 0xDE, 0x3E, 0xE7, 0x7B, 0x05, 0x90, 0x7B, 0x02, 0xA9,
+0x96, 0x7B, 0x00, 0x40, 0x00, 0x4F, 0xA9, 0x7B, 0x04, 0x43, 0x00, 0x7B, 0x0B, 0xC0, 0xBF, 0xF7,
+0xA0, 0xC3, 0xBA, 0xDE, 0x1C, 0xEF, 0x9E, 0xF7, 0xFC, 0xE6, 0xAF, 0xAE, 0xBA, 0x44, 0x02, 0x4B,
+0xAE, 0x4B, 0xBE, 0x58, 0xCC, 0xDF, 0xFF, 0xD8, 0xC5, 0x2B, 0x4A, 0xAD, 0x5A, 0x2F, 0x6B, 0xF0,
+0x8B, 0x6D, 0x6B, 0x03, 0x11, 0x64, 0x11, 0x27, 0x2B, 0x64, 0x1A, 0x63, 0x11, 0xC4, 0x19, 0x00,
+0xAE, 0xC7, 0x46, 0x22, 0xE7, 0x2A, 0x27, 0x23, 0x65, 0x1A, 0x05, 0x1A, 0xCB, 0x4B, 0xD0, 0x84,
+0xEC, 0x7B, 0xAE, 0xC1, 0x0E, 0x6C, 0x07, 0x22, 0x5F, 0xC0, 0xE6, 0x22, 0xBF, 0x7D, 0x78, 0xA7,
+0x94, 0x41, 0xC0, 0x08, 0x2B, 0x73, 0x6B, 0xC2, 0x0F, 0x64, 0xCD, 0x5A, 0x47, 0x29, 0xBE, 0xA6,
+0x00, 0x9E, 0x00, 0x7A, 0x77, 0x01, 0x72, 0xC2, 0xC9, 0x39, 0xCC, 0x5A, 0x2D, 0x6B, 0x63, 0xC0,
+0xC8, 0x39, 0x72, 0x00, 0x77, 0x03, 0x7A, 0xC0, 0x4A, 0x4A, 0x63, 0x91, 0xC0, 0xA8, 0x31, 0x72,
+0x00, 0x4F, 0xC0, 0x0D, 0x63, 0x63, 0xC0, 0xE9, 0x41, 0x72, 0x03, 0xC1, 0x2E, 0x63, 0xA6, 0x21,
+0x8C, 0x64, 0x7C, 0xC2, 0x89, 0x32, 0x71, 0x7C, 0x10, 0x84, 0x90, 0xC6, 0x6D, 0x73, 0xED, 0x7B,
+0x46, 0x3A, 0xB0, 0x8C, 0xB5, 0xB5, 0x54, 0xAD, 0x70, 0x84, 0xBB, 0xC0, 0x09, 0x43, 0x69, 0x4E,
+0x5F, 0x00, 0x64, 0xC3, 0x65, 0x1A, 0x42, 0x09, 0x0A, 0x4B, 0x52, 0xAD, 0xAE, 0x96, 0xC3, 0x6D,
+0x63, 0xCA, 0x52, 0x6C, 0x7B, 0xAD, 0x8B, 0xBF, 0xAE, 0x9A, 0x91, 0xC0, 0x0C, 0x63, 0x86, 0xC1,
+0x90, 0x8C, 0x13, 0xBE, 0x96, 0xC6, 0x4E, 0x84, 0xA6, 0x22, 0xE7, 0x22, 0xE4, 0x19, 0xC7, 0x2A,
+0x0A, 0x34, 0xE6, 0x3A, 0xB9, 0x86, 0x8E, 0xC2, 0xC6, 0x2B, 0x47, 0x2C, 0xB6, 0xAE, 0x71, 0x08,
+0x6C, 0xC2, 0x75, 0xAD, 0xF0, 0x83, 0x9A, 0xD6, 0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0xC1, 0x7E, 0xEF, 0x1E, 0xDF, 0xAE, 0x6F, 0xC0, 0x31, 0x84, 0x7F, 0xC1, 0xB3, 0x94, 0x3E, 0xE7,
+0x00, 0xC0, 0x7F, 0xE7, 0xA5, 0x40, 0xBF, 0x00, 0xC0, 0xF5, 0x9C, 0x60, 0xC0, 0x5F, 0xE7, 0x54,
+0x00, 0xC0, 0x3A, 0xBE, 0x74, 0x4F, 0x00, 0xC3, 0xD8, 0xB5, 0x2D, 0x63, 0x8F, 0x73, 0x1A, 0xBE,
+0x4F, 0x54, 0x4F, 0x7B, 0x4F, 0xC2, 0x9F, 0xEF, 0xF9, 0xBD, 0x9C, 0xCE, 0x4F, 0x43, 0x54, 0x4F,
+0x7B, 0x07, 0xC0, 0xBF, 0xF7, 0x51, 0xC1, 0xBA, 0xDE, 0x3C, 0xEF, 0x58, 0xC0, 0xDC, 0xDE, 0xBE,
+0xAF, 0x00, 0xAE, 0xBE, 0xA6, 0x00, 0x44, 0x00, 0xAF, 0x58, 0x50, 0xBA, 0x7F, 0xC2, 0x19, 0xCE,
+0xB7, 0xBD, 0x39, 0xCE, 0xA9, 0xC1, 0x91, 0x8C, 0x14, 0x95, 0x84, 0xC2, 0x68, 0x33, 0x05, 0x23,
+0xC4, 0x11, 0xA2, 0x00, 0xC1, 0x06, 0x1A, 0x29, 0x33, 0x94, 0xC0, 0x65, 0x22, 0x68, 0xBF, 0xC2,
+0x8C, 0x53, 0xF6, 0xC5, 0xCF, 0xB4, 0xB6, 0xC1, 0x17, 0xB6, 0x4C, 0x4B, 0x9C, 0xC0, 0x28, 0x2B,
+0x4B, 0xB7, 0xC0, 0x09, 0x2B, 0x44, 0xC2, 0x66, 0x22, 0xE4, 0x19, 0x85, 0x1A, 0xBF, 0x00, 0xC3,
+0x70, 0x64, 0xAD, 0x52, 0x26, 0x29, 0x67, 0x31, 0x96, 0x7A, 0x00, 0x9A, 0x7A, 0x00, 0x77, 0x72,
+0x77, 0xC1, 0xA8, 0x31, 0x6B, 0x4A, 0xBA, 0x91, 0xC0, 0x87, 0x31, 0x77, 0x72, 0x77, 0x03, 0x7A,
+0x76, 0x47, 0xBE, 0xC0, 0xA8, 0x39, 0x72, 0x00, 0x4E, 0xC0, 0xCC, 0x5A, 0xBE, 0x77, 0x01, 0x72,
+0x77, 0x72, 0xC1, 0x4F, 0x63, 0xA6, 0x21, 0x68, 0xC1, 0xC6, 0x22, 0x07, 0x23, 0x44, 0xC0, 0xEB,
+0x43, 0x96, 0xBA, 0xC0, 0x09, 0x33, 0xAD, 0xC1, 0xA6, 0x1A, 0x8A, 0x3B, 0x7B, 0x67, 0xC1, 0x08,
+0x2B, 0x69, 0x3B, 0x9D, 0x75, 0x5F, 0xA1, 0x00, 0x70, 0xC6, 0x84, 0x19, 0x47, 0x3A, 0x8C, 0x94,
+0x77, 0xFF, 0xFD, 0xFF, 0x39, 0xEF, 0x2D, 0x73, 0x9D, 0xC1, 0xED, 0x8B, 0x6F, 0x9C, 0xAE, 0xBA,
+0x00, 0x95, 0xC7, 0xEE, 0x8B, 0x0D, 0x6B, 0x4F, 0x94, 0x98, 0xFF, 0xFB, 0xFF, 0x15, 0xDE, 0x67,
+0x4A, 0xE4, 0x19, 0x92, 0xC1, 0xE7, 0x2A, 0x26, 0x22, 0x68, 0x00, 0x63, 0xC4, 0x65, 0x1A, 0x07,
+0x2C, 0x67, 0x2C, 0xB6, 0xAE, 0xFF, 0xFF, 0x09, 0xC0, 0xFB, 0xE6, 0xAF, 0x71, 0x12, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC4, 0x7E, 0xEF, 0x1E, 0xDF, 0x5F, 0xE7, 0x97, 0xAD, 0xD0, 0x7B, 0x4F,
+0xC7, 0x7B, 0xCE, 0x3E, 0xE7, 0x9B, 0xCE, 0x93, 0x8C, 0x3A, 0xC6, 0xFD, 0xDE, 0xD8, 0xB5, 0x15,
+0xA5, 0x50, 0x7B, 0xC0, 0xB8, 0xB5, 0x6C, 0xC2, 0xBC, 0xD6, 0x1A, 0xBE, 0x52, 0x84, 0x4F, 0xAE,
+0xC3, 0x15, 0x9D, 0x73, 0x8C, 0x97, 0xB5, 0xAF, 0x73, 0x7B, 0xC0, 0xD4, 0x94, 0x4B, 0x43, 0x6B,
+0xC2, 0x56, 0xA5, 0x2D, 0x63, 0xF0, 0x7B, 0x5B, 0x47, 0x6C, 0xC0, 0xF9, 0xBD, 0x43, 0x7B, 0x06,
+0xC0, 0xBF, 0xF7, 0xA4, 0xC3, 0xBA, 0xDE, 0x3D, 0xEF, 0xBE, 0xF7, 0xDC, 0xDE, 0xBE, 0xAF, 0xAE,
+0x7F, 0x00, 0xAE, 0x01, 0xAF, 0x03, 0xBE, 0x00, 0x6B, 0xC0, 0xBF, 0xFF, 0x58, 0xD1, 0x6D, 0x6B,
+0x2C, 0x53, 0xEF, 0x6B, 0x45, 0x22, 0x47, 0x2B, 0x2D, 0x64, 0xC9, 0x42, 0x0B, 0x53, 0xC9, 0x3A,
+0x68, 0x2B, 0xA8, 0x33, 0x65, 0x22, 0xA4, 0x11, 0xE5, 0x19, 0x47, 0x22, 0xC8, 0x42, 0x2B, 0x5B,
+0xC9, 0x52, 0x9F, 0xC3, 0x89, 0x3A, 0x05, 0x22, 0x45, 0x1A, 0xE7, 0x22, 0xBA, 0xC0, 0xC9, 0x2B,
+0xA0, 0x73, 0xC0, 0xE4, 0x19, 0x91, 0xC5, 0x85, 0x22, 0xE6, 0x22, 0xB1, 0x6C, 0x8D, 0x52, 0x27,
+0x29, 0x67, 0x29, 0x72, 0x01, 0x77, 0xB6, 0x77, 0x00, 0x72, 0x00, 0x5A, 0xC1, 0xCC, 0x5A, 0x4A,
+0x4A, 0x96, 0xC0, 0x67, 0x31, 0x77, 0x72, 0x77, 0x04, 0x5A, 0x00, 0xAE, 0xC0, 0x88, 0x31, 0x72,
+0x77, 0x72, 0x00, 0xC0, 0xE8, 0x39, 0x77, 0x72, 0x7A, 0x77, 0x72, 0x66, 0xC3, 0x2E, 0x5B, 0x27,
+0x2A, 0xA4, 0x19, 0x44, 0x1A, 0x53, 0xC0, 0x06, 0x23, 0xAE, 0xAF, 0x01, 0xA6, 0xBE, 0x7F, 0x7A,
+0x73, 0x00, 0x6E, 0x00, 0xA2, 0xA2, 0x95, 0x70, 0xCA, 0x22, 0x11, 0xC5, 0x19, 0x2E, 0x84, 0xED,
+0xBC, 0xDA, 0xFF, 0x19, 0xEF, 0xAE, 0x83, 0x4B, 0x7B, 0xEC, 0xAC, 0x10, 0xD6, 0x52, 0xDE, 0x00,
+0xA6, 0x00, 0x99, 0x91, 0xC1, 0xEF, 0xB4, 0x2C, 0x6B, 0x4A, 0xC7, 0x99, 0xF7, 0xD7, 0xEE, 0x2F,
+0x9C, 0x07, 0x32, 0x05, 0x1A, 0x45, 0x22, 0x64, 0x11, 0xA4, 0x11, 0xAE, 0x00, 0x4B, 0xC1, 0xE6,
+0x2B, 0x47, 0x2C, 0x62, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x50, 0xC0, 0x1E, 0xDF,
+0x4F, 0xC3, 0x3A, 0xC6, 0xCB, 0x5A, 0xF5, 0x9C, 0xFD, 0xDE, 0x7B, 0xC0, 0xF0, 0x7B, 0x4F, 0x78,
+0xCA, 0xB8, 0xB5, 0x8A, 0x52, 0x56, 0xAD, 0xD0, 0x7B, 0xBC, 0xCE, 0xB7, 0xB5, 0xB4, 0x94, 0x11,
+0x84, 0x19, 0xBE, 0x72, 0x8C, 0x5F, 0xE7, 0xAE, 0xC0, 0x35, 0xA5, 0x6C, 0xC0, 0x97, 0xAD, 0x78,
+0x6C, 0x91, 0xC0, 0x8E, 0x73, 0x64, 0xC0, 0xEC, 0x5A, 0x74, 0xC2, 0xAF, 0x73, 0x31, 0x84, 0xBC,
+0xD6, 0x64, 0xC1, 0x36, 0xA5, 0xD8, 0xB5, 0x43, 0x96, 0x06, 0xC0, 0xBF, 0xF7, 0x51, 0xC3, 0xDB,
+0xE6, 0x3D, 0xEF, 0xBE, 0xF7, 0xDC, 0xDE, 0xAE, 0xC0, 0x3D, 0xE7, 0x00, 0x7F, 0x00, 0xAE, 0x02,
+0xAB, 0x44, 0x00, 0xC0, 0x9E, 0xF7, 0x00, 0xA6, 0xC0, 0xBB, 0xDE, 0x00, 0xA9, 0xC1, 0x48, 0x4A,
+0x85, 0x21, 0xAE, 0xC3, 0x23, 0x11, 0xA5, 0x19, 0x2B, 0x63, 0x6D, 0x6B, 0x78, 0xC6, 0x2B, 0x53,
+0xE4, 0x11, 0x65, 0x1A, 0x05, 0x1A, 0x87, 0x22, 0x25, 0x1A, 0xC4, 0x11, 0xBF, 0xC1, 0x48, 0x2A,
+0xE6, 0x21, 0xAE, 0xC0, 0xA4, 0x11, 0x72, 0xC0, 0x26, 0x22, 0x9A, 0xC2, 0x66, 0x22, 0xA6, 0x22,
+0x47, 0x23, 0xA6, 0xC0, 0x25, 0x1A, 0x55, 0xC5, 0xE7, 0x2A, 0x85, 0x1A, 0x92, 0x74, 0xAD, 0x52,
+0x26, 0x29, 0x67, 0x29, 0xA6, 0xC0, 0x09, 0x42, 0x00, 0x77, 0xBA, 0x77, 0x72, 0x00, 0x7A, 0xAB,
+0x7A, 0x72, 0x00, 0xAB, 0xAE, 0x72, 0x7A, 0x00, 0x77, 0x00, 0x72, 0xC3, 0xA8, 0x31, 0x0D, 0x63,
+0x4E, 0x6B, 0xCC, 0x5A, 0x76, 0x72, 0x00, 0x76, 0xC0, 0xAC, 0x52, 0xA5, 0xC0, 0x2A, 0x42, 0x72,
+0xAE, 0x01, 0x72, 0xC1, 0xAB, 0x4A, 0x66, 0x2A, 0x81, 0x4E, 0x5F, 0xAE, 0xC0, 0x07, 0x23, 0x00,
+0xBA, 0xAE, 0x03, 0x69, 0x00, 0xA7, 0x64, 0x69, 0x00, 0xC1, 0xE4, 0x19, 0x23, 0x11, 0xAE, 0xC8,
+0xA4, 0x19, 0x6C, 0x63, 0xAF, 0xB4, 0x35, 0xD6, 0xAE, 0x8B, 0x4A, 0x7B, 0x4D, 0xC5, 0xB3, 0xE6,
+0x16, 0xEF, 0xA6, 0xA5, 0x01, 0xAE, 0x00, 0x91, 0xC7, 0x0F, 0xBD, 0xEB, 0x6A, 0x0E, 0x94, 0x32,
+0xBD, 0xCE, 0x93, 0x48, 0x3A, 0x45, 0x1A, 0xA4, 0x11, 0x70, 0xC1, 0xA5, 0x3A, 0xE6, 0x42, 0x89,
+0xC1, 0x25, 0x23, 0xE6, 0x2B, 0x6A, 0xC0, 0x95, 0xA6, 0x71, 0x01, 0xA6, 0xC0, 0x3C, 0xE7, 0x71,
+0x03, 0x6C, 0x91, 0x71, 0x13, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x7E, 0xEF, 0x7B, 0x00,
+0xC2, 0x5E, 0xE7, 0x19, 0xBE, 0x8E, 0x73, 0xAB, 0xC9, 0x3A, 0xC6, 0xEC, 0x5A, 0xD4, 0x9C, 0x6E,
+0x6B, 0xF4, 0x9C, 0x52, 0x8C, 0x9F, 0xEF, 0x11, 0x7C, 0xBC, 0xD6, 0x56, 0xA5, 0x47, 0xC1, 0x2D,
+0x63, 0xD8, 0xB5, 0x60, 0xC0, 0x5F, 0xE7, 0xAE, 0xC4, 0x36, 0xA5, 0x8A, 0x52, 0xAF, 0x73, 0x1A,
+0xBE, 0xD0, 0x7B, 0x4F, 0xC1, 0x76, 0xAD, 0x93, 0x94, 0x44, 0x4F, 0x43, 0xC0, 0xF9, 0xBD, 0x5C,
+0x44, 0x47, 0xC1, 0x7B, 0xCE, 0x3E, 0xE7, 0x7B, 0x06, 0xC0, 0xBF, 0xF7, 0xA4, 0xC3, 0xDB, 0xE6,
+0x3C, 0xEF, 0x9E, 0xF7, 0xDC, 0xDE, 0xBE, 0xC0, 0x3D, 0xE7, 0xBE, 0x01, 0x7C, 0x44, 0x01, 0xA6,
+0x44, 0xAF, 0xBA, 0x58, 0x64, 0xC2, 0x9A, 0xD6, 0x4F, 0x73, 0x32, 0x94, 0x80, 0xC5, 0xD3, 0x94,
+0x12, 0x8D, 0xC4, 0x19, 0x63, 0x19, 0x71, 0x8C, 0x96, 0xB5, 0xBE, 0xC5, 0xAD, 0x63, 0x63, 0x09,
+0xA4, 0x11, 0x46, 0x22, 0xEA, 0x3B, 0x28, 0x2B, 0x63, 0xC6, 0x27, 0x2A, 0x10, 0x84, 0x71, 0x94,
+0xEA, 0x4A, 0x46, 0x1A, 0xA9, 0x2B, 0x49, 0x34, 0x00, 0xAE, 0x00, 0xAF, 0xC1, 0x88, 0x2B, 0xE7,
+0x22, 0xA5, 0x00, 0x46, 0xC2, 0xB2, 0x6C, 0xAD, 0x52, 0x26, 0x29, 0x77, 0x00, 0xC3, 0xAB, 0x5A,
+0x2D, 0x6B, 0xCC, 0x52, 0x4A, 0x4A, 0x72, 0x02, 0xC1, 0x0A, 0x42, 0x6B, 0x52, 0x81, 0x00, 0xC0,
+0x88, 0x31, 0x77, 0x05, 0x7A, 0xC1, 0x6B, 0x4A, 0xEC, 0x62, 0xA6, 0xC0, 0xE9, 0x41, 0x72, 0x77,
+0x57, 0x7F, 0x7B, 0xC0, 0x8B, 0x52, 0x77, 0x72, 0xA9, 0x72, 0x00, 0xC1, 0x0D, 0x53, 0x87, 0x2A,
+0x4E, 0xC2, 0xA6, 0x22, 0xE6, 0x22, 0x27, 0x2B, 0x42, 0x00, 0xAE, 0x00, 0x42, 0x47, 0x00, 0x91,
+0xC0, 0xC6, 0x1A, 0xBA, 0x00, 0x69, 0x00, 0xC1, 0x24, 0x1A, 0x23, 0x09, 0xBE, 0x00, 0xC3, 0xC5,
+0x21, 0x71, 0x84, 0xB2, 0xA4, 0x4D, 0x83, 0x95, 0xC2, 0xEC, 0xB4, 0xB4, 0xE6, 0x37, 0xEF, 0xB5,
+0x95, 0xA5, 0x00, 0x7D, 0xAE, 0x49, 0x00, 0xC9, 0x94, 0xE6, 0x4E, 0xA4, 0xCC, 0x6A, 0x30, 0x94,
+0x4D, 0x73, 0xA5, 0x21, 0x66, 0x22, 0xE5, 0x21, 0x68, 0x6B, 0x4A, 0xA4, 0xBF, 0x80, 0xC1, 0xE8,
+0x6B, 0x26, 0x34, 0x8F, 0xC1, 0x95, 0xA6, 0xFF, 0xFF, 0x00, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x00,
+0xC1, 0x55, 0xAD, 0x79, 0xCE, 0x6C, 0x71, 0x78, 0xC1, 0xF3, 0xA4, 0x6D, 0x6B, 0x6C, 0xC0, 0xBA,
+0xDE, 0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF, 0x1E, 0xDF, 0x00, 0xA5,
+0xC8, 0x5F, 0xE7, 0x9F, 0xEF, 0x4E, 0x6B, 0x97, 0xB5, 0x6E, 0x6B, 0x7B, 0xC6, 0xBC, 0xCE, 0xD8,
+0xB5, 0x52, 0x8C, 0x4F, 0xC2, 0x11, 0x84, 0xF9, 0xBD, 0xAF, 0x73, 0x58, 0xC1, 0x6E, 0x6B, 0xD8,
+0xB5, 0x5B, 0x4F, 0xAE, 0xC2, 0x15, 0xA5, 0xB4, 0x94, 0xBF, 0xEF, 0x4F, 0x64, 0x6F, 0xC0, 0x15,
+0x9D, 0x7B, 0xC7, 0x31, 0x84, 0x3E, 0xDF, 0x93, 0x94, 0xB7, 0xB5, 0x7F, 0xE7, 0x1E, 0xDF, 0x56,
+0xAD, 0x6E, 0x6B, 0x40, 0x00, 0x7B, 0x05, 0xC0, 0xBF, 0xF7, 0x90, 0xC3, 0xDA, 0xE6, 0x3D, 0xEF,
+0xBE, 0xF7, 0xFC, 0xE6, 0xAF, 0x7C, 0xBE, 0x7F, 0x44, 0x03, 0x7F, 0x44, 0xAF, 0x00, 0xBE, 0x64,
+0xC4, 0x59, 0xD6, 0xCD, 0x62, 0x32, 0x8C, 0x6D, 0x6B, 0xA5, 0x21, 0x00, 0x95, 0xAE, 0xC1, 0xF2,
+0x9C, 0x38, 0xCE, 0x00, 0xC4, 0x4F, 0x7C, 0x42, 0x09, 0x84, 0x11, 0xC4, 0x11, 0xE6, 0x22, 0xA2,
+0xC8, 0x43, 0x09, 0x07, 0x2A, 0xB6, 0xB5, 0x38, 0xCE, 0x8D, 0x5B, 0xC9, 0x2B, 0x88, 0x2C, 0x86,
+0x23, 0x05, 0x1B, 0xBA, 0xC0, 0x86, 0x2B, 0xAF, 0xA2, 0xC0, 0xC5, 0x22, 0xA6, 0xAF, 0xA1, 0xC2,
+0x50, 0x6C, 0xAD, 0x52, 0x26, 0x29, 0x72, 0xC4, 0xE9, 0x39, 0x8F, 0x73, 0x2D, 0x6B, 0x6E, 0x6B,
+0x0D, 0x63, 0x72, 0x00, 0xAE, 0x72, 0xC1, 0x2A, 0x4A, 0xAB, 0x52, 0x76, 0x00, 0x46, 0x77, 0x01,
+0x72, 0x00, 0x77, 0xBA, 0x00, 0xC1, 0xE9, 0x41, 0x4B, 0x4A, 0x76, 0x46, 0x77, 0x72, 0xC2, 0xC9,
+0x39, 0x09, 0x42, 0x6B, 0x4A, 0x67, 0x72, 0x03, 0xC1, 0xED, 0x52, 0x46, 0x22, 0x94, 0x4E, 0x53,
+0x69, 0xC1, 0x27, 0x2B, 0x67, 0x2B, 0x7D, 0xC0, 0x86, 0x22, 0xAE, 0xC0, 0x05, 0x1A, 0xA5, 0xC3,
+0xA7, 0x32, 0xAD, 0x63, 0xA9, 0x42, 0x47, 0x3A, 0x00, 0xAE, 0xC2, 0x4B, 0x53, 0x88, 0x3A, 0x64,
+0x11, 0x61, 0xC0, 0xE5, 0x21, 0x40, 0xC4, 0xAD, 0x73, 0x6E, 0x8B, 0xCC, 0x9B, 0xD0, 0xD5, 0x16,
+0xEF, 0xBF, 0x49, 0xA0, 0x00, 0xAE, 0xAF, 0xA6, 0x00, 0x49, 0x00, 0xC0, 0x70, 0xC5, 0x7E, 0xCD,
+0xEF, 0x8B, 0xE6, 0x39, 0xE5, 0x19, 0x65, 0x1A, 0x07, 0x5B, 0x90, 0xCD, 0x18, 0xEF, 0x79, 0xF7,
+0x52, 0xE6, 0x4A, 0xAC, 0x68, 0x6C, 0x27, 0x24, 0x95, 0xA6, 0xFF, 0xFF, 0x00, 0xC1, 0xD3, 0x9C,
+0xF7, 0xC5, 0x71, 0xC6, 0x9E, 0xF7, 0x38, 0xC6, 0x69, 0x4A, 0x1C, 0xE7, 0x34, 0xA5, 0x92, 0x94,
+0xBA, 0xD6, 0xBF, 0xC0, 0x10, 0x84, 0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC4, 0x7E,
+0xEF, 0x1E, 0xDF, 0x5E, 0xE7, 0x3A, 0xC6, 0x8E, 0x73, 0xAF, 0xC1, 0x11, 0x7C, 0x3E, 0xE7, 0x5B,
+0xC2, 0xD0, 0x7B, 0x93, 0x94, 0xD8, 0xB5, 0x6F, 0xC2, 0x5F, 0xE7, 0x52, 0x84, 0x7B, 0xCE, 0x64,
+0xC3, 0xF0, 0x7B, 0x2D, 0x63, 0xF9, 0xBD, 0x93, 0x8C, 0x4F, 0x00, 0xC2, 0x56, 0xA5, 0xF4, 0x9C,
+0x7F, 0xE7, 0x4F, 0xC1, 0x35, 0xA5, 0x4E, 0x6B, 0xAE, 0x47, 0xC0, 0x32, 0x84, 0x7B, 0xC2, 0x97,
+0xB5, 0x4D, 0x6B, 0x19, 0xBE, 0x6F, 0xC0, 0xF1, 0x7B, 0x5B, 0x43, 0x9A, 0x7B, 0x05, 0xC0, 0x9F,
+0xF7, 0xA4, 0xC4, 0xDB, 0xE6, 0x3D, 0xEF, 0x9E, 0xF7, 0xDC, 0xDE, 0x1D, 0xE7, 0xAE, 0x00, 0xBE,
+0x03, 0xAF, 0xA6, 0x00, 0x50, 0x58, 0x00, 0xAF, 0xC4, 0x7A, 0xDE, 0x2F, 0x73, 0x12, 0x84, 0xAE,
+0x73, 0x69, 0x42, 0xBE, 0xC2, 0x63, 0x19, 0x47, 0x2A, 0x2F, 0x84, 0xA0, 0xC4, 0x70, 0x94, 0x6C,
+0x6B, 0xA4, 0x11, 0x09, 0x3B, 0x71, 0x74, 0x91, 0xA7, 0xC3, 0xEB, 0x4A, 0xA6, 0x21, 0xD7, 0xB5,
+0xDB, 0xDE, 0x5B, 0xC2, 0x6B, 0x43, 0xD1, 0x6C, 0x10, 0x64, 0x7E, 0xC4, 0x0B, 0x43, 0x04, 0x1A,
+0x46, 0x22, 0x27, 0x2B, 0xA6, 0x22, 0xA5, 0xC4, 0xC6, 0x22, 0x65, 0x1A, 0x31, 0x6C, 0xAD, 0x52,
+0x26, 0x29, 0x72, 0xC0, 0x0D, 0x63, 0xAE, 0xC2, 0x4A, 0x4A, 0x6E, 0x6B, 0xCC, 0x5A, 0x91, 0x72,
+0xAE, 0x72, 0xC0, 0x88, 0x31, 0x00, 0x72, 0x77, 0xAB, 0x77, 0x01, 0x46, 0x6E, 0xC0, 0xA8, 0x31,
+0x72, 0x4B, 0xC0, 0x0D, 0x63, 0xBF, 0x80, 0x7B, 0x72, 0x00, 0xC1, 0x2A, 0x4A, 0x6B, 0x52, 0x7B,
+0xC0, 0xA8, 0x39, 0x72, 0x02, 0xA9, 0xC2, 0xED, 0x5A, 0xC5, 0x21, 0x63, 0x11, 0x5E, 0xC0, 0xE4,
+0x19, 0x69, 0xAB, 0xC2, 0xE8, 0x2B, 0x89, 0x33, 0xE7, 0x2A, 0x69, 0xC5, 0xE4, 0x19, 0x27, 0x2A,
+0xF3, 0x94, 0x9A, 0xDE, 0x30, 0x8C, 0x2C, 0x6B, 0xAF, 0x00, 0xC0, 0xD3, 0xA4, 0x99, 0xC2, 0xA5,
+0x29, 0x24, 0x1A, 0x65, 0x22, 0x92, 0xC4, 0x6C, 0x5B, 0x6E, 0x83, 0x0D, 0xA4, 0x32, 0xDE, 0x37,
+0xF7, 0xA9, 0x95, 0xA5, 0x00, 0xBB, 0xAE, 0x99, 0x42, 0xAB, 0xAF, 0xC2, 0xD2, 0xD5, 0x2C, 0x83,
+0xCF, 0x8B, 0x73, 0xC0, 0xE4, 0x11, 0x4E, 0xC2, 0xE9, 0x83, 0x58, 0xEF, 0xFE, 0xFF, 0x71, 0xC4,
+0x7A, 0xF7, 0x6D, 0xCD, 0xEA, 0x9C, 0x47, 0x2C, 0x96, 0xA6, 0x71, 0x00, 0xC2, 0x51, 0x8C, 0xBE,
+0xF7, 0xDB, 0xDE, 0xAE, 0xC2, 0x59, 0xCE, 0xF0, 0x83, 0x75, 0xAD, 0xA6, 0xC0, 0xB2, 0x94, 0x4D,
+0x71, 0x54, 0xC0, 0x7D, 0xEF, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF,
+0x1E, 0xDF, 0x01, 0xC0, 0x5A, 0xC6, 0x91, 0x7B, 0xBE, 0x7B, 0xC0, 0xF9, 0xBD, 0x47, 0x7B, 0xA5,
+0x7B, 0x95, 0xC2, 0x3E, 0xDF, 0xBC, 0xD6, 0x3A, 0xC6, 0x6F, 0xAE, 0x6F, 0x7B, 0x40, 0x6F, 0x00,
+0x40, 0x7B, 0x43, 0xC1, 0x1A, 0xBE, 0xBC, 0xCE, 0x43, 0x6C, 0x7B, 0x40, 0xC1, 0x9B, 0xCE, 0xDD,
+0xD6, 0x4C, 0x5F, 0x7B, 0x40, 0x7B, 0x06, 0xC0, 0x9F, 0xF7, 0xA8, 0xC4, 0xDB, 0xE6, 0x3D, 0xEF,
+0x9E, 0xF7, 0xBB, 0xDE, 0x1C, 0xE7, 0xAF, 0x00, 0x7F, 0xAE, 0x02, 0x50, 0x44, 0x00, 0x50, 0xBA,
+0x58, 0x00, 0x4B, 0xC3, 0x2E, 0x73, 0x11, 0x8C, 0xAE, 0x73, 0x2C, 0x5B, 0xBA, 0xCA, 0x63, 0x19,
+0xA9, 0x3A, 0x71, 0x94, 0xAC, 0x7B, 0x70, 0x9C, 0x4B, 0x63, 0x42, 0x09, 0xEE, 0x5B, 0xD0, 0x73,
+0x2A, 0x42, 0x8C, 0x52, 0x73, 0xC2, 0xA7, 0x31, 0x49, 0x4A, 0x8A, 0x52, 0x44, 0xC1, 0xE9, 0x39,
+0x4A, 0x4A, 0xA6, 0xC4, 0xED, 0x5A, 0x72, 0x74, 0xE5, 0x19, 0x45, 0x1A, 0x47, 0x2B, 0xA2, 0x95,
+0xA6, 0xA5, 0xC1, 0x91, 0x6C, 0xAD, 0x52, 0x66, 0xAF, 0xC0, 0xCB, 0x5A, 0x4F, 0x66, 0x7B, 0xC0,
+0x4E, 0x6B, 0xA5, 0xC0, 0x87, 0x31, 0x72, 0x00, 0x5F, 0x6F, 0x91, 0x91, 0xC0, 0x88, 0x31, 0x72,
+0xBE, 0x5B, 0xC0, 0x2D, 0x63, 0x5B, 0xC0, 0x67, 0x29, 0x72, 0x7A, 0x76, 0x5B, 0x4F, 0xC0, 0xC8,
+0x39, 0x77, 0x72, 0x5F, 0x53, 0x7F, 0x7A, 0x72, 0x00, 0x77, 0x72, 0x66, 0xC1, 0xCC, 0x4A, 0x26,
+0x22, 0x94, 0xA6, 0x75, 0xC1, 0x87, 0x2B, 0x27, 0x2B, 0x92, 0x7D, 0xC0, 0xA6, 0x22, 0x00, 0xC5,
+0xC4, 0x11, 0x47, 0x2A, 0x14, 0x9D, 0x3C, 0xEF, 0x51, 0x94, 0x0C, 0x63, 0xBF, 0xBE, 0xC3, 0x76,
+0xB5, 0xB6, 0xB5, 0x47, 0x32, 0x44, 0x1A, 0xAF, 0xA6, 0xC4, 0x8B, 0x5B, 0x8E, 0x83, 0x0C, 0x9C,
+0x10, 0xD6, 0x16, 0xEF, 0xBE, 0x95, 0xA9, 0xBA, 0x45, 0x7B, 0xA6, 0xAB, 0x49, 0xBF, 0xC4, 0xB1,
+0xD5, 0x0C, 0x7B, 0xCF, 0x8B, 0xA5, 0x29, 0xE4, 0x11, 0x4E, 0xC2, 0xC8, 0x83, 0x17, 0xEF, 0xFE,
+0xFF, 0x00, 0xA0, 0xC3, 0x2F, 0xDE, 0xAD, 0xA5, 0x47, 0x34, 0x96, 0xA6, 0x71, 0x00, 0x54, 0xC2,
+0xBE, 0xF7, 0xF7, 0xBD, 0xCF, 0x7B, 0x51, 0xC2, 0x76, 0xB5, 0x92, 0x94, 0xD3, 0x9C, 0xA5, 0xC0,
+0xBB, 0xDE, 0x71, 0x54, 0xC0, 0x7D, 0xF7, 0x71, 0x10, 0x70, 0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF,
+0x1E, 0xDF, 0x01, 0xBE, 0xAE, 0x40, 0x7B, 0x40, 0xBF, 0x43, 0x40, 0x00, 0x7B, 0x40, 0x7B, 0x43,
+0x00, 0x40, 0x01, 0x7B, 0x00, 0x40, 0x00, 0x7B, 0x01, 0x48, 0x43, 0x7B, 0x40, 0x7B, 0x00, 0x43,
+0x40, 0x43, 0x4F, 0x40, 0x7B, 0x07, 0xC0, 0x9F, 0xF7, 0x4C, 0xC3, 0xDB, 0xE6, 0x3D, 0xEF, 0x9E,
+0xF7, 0xFC, 0xE6, 0xAE, 0xAF, 0x00, 0x7F, 0x00, 0xAE, 0x7F, 0x44, 0xAB, 0x44, 0x50, 0xBA, 0x50,
+0x58, 0x00, 0xC4, 0x7A, 0xD6, 0xCD, 0x6A, 0x32, 0x94, 0x2C, 0x63, 0x02, 0x11, 0xA7, 0xA9, 0xC9,
+0x44, 0x19, 0xB2, 0x94, 0xD2, 0xA4, 0x54, 0xAD, 0x2B, 0x63, 0xC1, 0x08, 0x0C, 0x4B, 0xAB, 0x4A,
+0x87, 0x31, 0xE8, 0x41, 0x9A, 0xBB, 0x91, 0x7F, 0xBE, 0x5B, 0x96, 0x47, 0x62, 0xC2, 0x11, 0x74,
+0x46, 0x22, 0x86, 0x22, 0x69, 0xC0, 0x67, 0x23, 0x64, 0x00, 0x91, 0xC3, 0x90, 0x64, 0xAC, 0x4A,
+0x26, 0x29, 0x67, 0x29, 0xBA, 0x00, 0x96, 0x7F, 0xC0, 0x6E, 0x73, 0x63, 0x00, 0x77, 0x72, 0xC0,
+0x4A, 0x4A, 0x63, 0xC1, 0x6E, 0x6B, 0x2A, 0x4A, 0x7A, 0x77, 0x00, 0x62, 0xC0, 0x8B, 0x52, 0x63,
+0xC0, 0xA8, 0x31, 0x77, 0x00, 0xC3, 0x09, 0x42, 0x6A, 0x52, 0xAB, 0x52, 0xC9, 0x39, 0x72, 0x77,
+0x72, 0x00, 0x5A, 0x4B, 0x72, 0xA9, 0x72, 0x77, 0x6B, 0xC1, 0x07, 0x2A, 0x24, 0x1A, 0xA1, 0xC0,
+0xA5, 0x22, 0x46, 0xC1, 0x87, 0x2B, 0x27, 0x23, 0xA6, 0xC0, 0xA6, 0x22, 0xA6, 0x64, 0xC6, 0x04,
+0x1A, 0x06, 0x22, 0xEF, 0x6B, 0xBA, 0xDE, 0x30, 0x8C, 0x2C, 0x6B, 0x6D, 0x73, 0xA6, 0xC2, 0x17,
+0xC6, 0x13, 0xA5, 0x44, 0x21, 0x89, 0xC0, 0x83, 0x11, 0xBB, 0xC3, 0x4B, 0x5B, 0xAF, 0x8B, 0xAC,
+0x8B, 0x6D, 0xC5, 0x7D, 0xC0, 0x36, 0xEF, 0xBA, 0x00, 0x45, 0x00, 0x95, 0x7D, 0x00, 0xAF, 0xA6,
+0xCE, 0xCE, 0xB4, 0xEB, 0x72, 0xCF, 0x8B, 0x69, 0x42, 0xA7, 0x2A, 0xE4, 0x11, 0xE6, 0x52, 0x2E,
+0xC5, 0x39, 0xF7, 0xDD, 0xFF, 0xD6, 0xEE, 0x6D, 0xCD, 0x4B, 0x8D, 0x06, 0x24, 0x95, 0xA6, 0x71,
+0x00, 0xC1, 0xF3, 0x9C, 0xB7, 0xBD, 0x71, 0xC6, 0x71, 0x94, 0xB6, 0xB5, 0xF7, 0xBD, 0x55, 0xAD,
+0x4D, 0x6B, 0xB3, 0x9C, 0x9A, 0xD6, 0xA5, 0xC0, 0x10, 0x84, 0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC1, 0x7E, 0xEF, 0x1E, 0xDF, 0x03, 0xAE, 0xBF, 0xA9, 0x40, 0x7B, 0x02, 0x40, 0x00,
+0x7B, 0x00, 0xBE, 0x40, 0x4F, 0x40, 0x7B, 0x02, 0x40, 0x4F, 0x43, 0x7B, 0x02, 0x40, 0x00, 0x7B,
+0x00, 0x40, 0x43, 0x00, 0x4F, 0x40, 0x7B, 0x04, 0xC0, 0x9F, 0xF7, 0xA4, 0xC3, 0xFB, 0xE6, 0x3D,
+0xEF, 0x9E, 0xF7, 0xFC, 0xE6, 0xAF, 0x00, 0xA9, 0x7F, 0x9A, 0x00, 0x7F, 0xAE, 0x50, 0x02, 0x58,
+0x01, 0xC1, 0xDB, 0xDE, 0x39, 0xCE, 0xA9, 0x78, 0xC5, 0xEF, 0x7B, 0x91, 0x7C, 0x03, 0x11, 0xA5,
+0x21, 0xF6, 0xBD, 0x9A, 0xDE, 0xAF, 0xC5, 0xAD, 0x6B, 0x63, 0x11, 0x4C, 0x4B, 0x8B, 0x4A, 0xC8,
+0x39, 0x08, 0x42, 0x96, 0x5B, 0x00, 0x53, 0x02, 0xA6, 0x67, 0xC4, 0x51, 0x74, 0xE6, 0x22, 0x67,
+0x2B, 0xC7, 0x22, 0x06, 0x23, 0x69, 0xA6, 0x91, 0xC3, 0x90, 0x64, 0xAC, 0x52, 0x26, 0x29, 0x67,
+0x31, 0x96, 0x01, 0xA9, 0xC0, 0xC9, 0x39, 0xBA, 0xC1, 0x2D, 0x63, 0xA7, 0x31, 0x6B, 0xC1, 0xA8,
+0x31, 0x6B, 0x52, 0xAE, 0x91, 0xC0, 0x88, 0x31, 0x7A, 0x00, 0x72, 0xAE, 0x53, 0x91, 0x77, 0xAB,
+0xC1, 0xE9, 0x41, 0xEC, 0x62, 0x91, 0xC0, 0x88, 0x39, 0x72, 0x00, 0xC1, 0x2A, 0x4A, 0x0D, 0x63,
+0x95, 0xC0, 0x67, 0x29, 0x01, 0x72, 0x01, 0xC4, 0x48, 0x32, 0x65, 0x22, 0xC3, 0x19, 0x85, 0x22,
+0xC6, 0x22, 0x69, 0xC1, 0x66, 0x1A, 0x87, 0x2B, 0x69, 0xA2, 0x69, 0x5F, 0xC3, 0x26, 0x22, 0x09,
+0x33, 0x8C, 0x5C, 0xA7, 0x32, 0xB3, 0xC3, 0xCA, 0x42, 0xE5, 0x29, 0xAA, 0x4B, 0xA7, 0x32, 0x43,
+0xA9, 0xC7, 0x44, 0x19, 0xCA, 0x52, 0x0E, 0x84, 0xEF, 0x93, 0x4D, 0x83, 0x8C, 0xAC, 0x10, 0xD6,
+0x16, 0xEF, 0xBE, 0xA6, 0x45, 0x42, 0xA6, 0x42, 0x49, 0x00, 0xC8, 0xD1, 0xD5, 0x6B, 0x83, 0x0C,
+0x73, 0x51, 0x9C, 0x4C, 0x6B, 0x06, 0x32, 0x63, 0x11, 0xC4, 0x21, 0x47, 0x6B, 0x47, 0xC3, 0x0F,
+0xC5, 0x8C, 0xB4, 0x69, 0x94, 0x27, 0x3C, 0x56, 0xC1, 0x75, 0x9E, 0xFF, 0xFF, 0x00, 0xC1, 0x7D,
+0xEF, 0xEF, 0x83, 0x91, 0xC1, 0x55, 0xAD, 0x9A, 0xD6, 0x91, 0xC1, 0x3C, 0xE7, 0x30, 0x84, 0x64,
+0xC2, 0x6D, 0x6B, 0xF0, 0x83, 0x1C, 0xE7, 0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1,
+0x7E, 0xEF, 0x1E, 0xDF, 0x04, 0xC3, 0x56, 0xA5, 0xF4, 0x9C, 0x1D, 0xDF, 0x5F, 0xE7, 0xA5, 0x00,
+0xC2, 0x7F, 0xE7, 0x3A, 0xC6, 0xBC, 0xD6, 0x4F, 0x43, 0xC2, 0xB8, 0xB5, 0x9B, 0xCE, 0xD4, 0x9C,
+0x5B, 0x40, 0x7B, 0x00, 0x40, 0xC0, 0xDD, 0xD6, 0x48, 0xC0, 0x56, 0xAD, 0x4F, 0x00, 0xA5, 0x4F,
+0x5B, 0x73, 0x4F, 0x00, 0xC1, 0xFD, 0xD6, 0x77, 0xAD, 0x91, 0xC1, 0xB3, 0x94, 0xDC, 0xD6, 0x40,
+0x7B, 0x03, 0xC0, 0xBF, 0xF7, 0xA0, 0xC3, 0xDB, 0xE6, 0x5D, 0xEF, 0x9E, 0xF7, 0x1D, 0xE7, 0xAE,
+0x01, 0xBA, 0x7C, 0x44, 0x01, 0xAB, 0x00, 0x50, 0x02, 0xBA, 0x77, 0x71, 0x4C, 0xC0, 0x8A, 0x52,
+0x81, 0xCB, 0xAD, 0x63, 0x66, 0x22, 0x07, 0x2B, 0x6C, 0x5B, 0xD2, 0x94, 0xEF, 0x73, 0x27, 0x32,
+0xA3, 0x11, 0x6C, 0x4B, 0xAB, 0x52, 0xA8, 0x39, 0x08, 0x42, 0x92, 0x00, 0xA5, 0x96, 0xAF, 0xC0,
+0xE8, 0x39, 0x00, 0x4B, 0xC4, 0x29, 0x42, 0x31, 0x6C, 0x45, 0x1A, 0xC6, 0x22, 0x06, 0x23, 0xA6,
+0x00, 0x64, 0xC2, 0x65, 0x1A, 0x70, 0x64, 0xAC, 0x52, 0x66, 0xC0, 0x67, 0x31, 0x00, 0x96, 0xA9,
+0x72, 0x6B, 0x00, 0x7F, 0x7A, 0x72, 0xC1, 0xA8, 0x31, 0x2A, 0x42, 0x4E, 0xC1, 0x0A, 0x42, 0x88,
+0x31, 0x72, 0x4B, 0xC0, 0x6B, 0x52, 0xAE, 0xBF, 0x62, 0x72, 0xBF, 0xC2, 0x8C, 0x52, 0xCC, 0x5A,
+0x4A, 0x4A, 0x4E, 0x72, 0x00, 0x4E, 0xC0, 0x6A, 0x52, 0x63, 0x62, 0xC0, 0x67, 0x29, 0x00, 0x72,
+0x00, 0x6B, 0xC4, 0xAC, 0x4A, 0x46, 0x22, 0xE4, 0x19, 0x24, 0x1A, 0xA5, 0x22, 0xA6, 0x96, 0xC0,
+0xA6, 0x22, 0x64, 0x00, 0x5F, 0xC0, 0x07, 0x23, 0x00, 0x64, 0xC2, 0xE8, 0x2B, 0xA6, 0x1A, 0xA4,
+0x11, 0x00, 0x70, 0xC2, 0x86, 0x23, 0x64, 0x1A, 0x02, 0x11, 0x00, 0xC8, 0x85, 0x21, 0x30, 0x8C,
+0x2E, 0x9C, 0x76, 0xDE, 0xF5, 0xCD, 0xAE, 0x8B, 0xED, 0xB4, 0xF0, 0xD5, 0x94, 0xE6, 0xAE, 0x00,
+0xA9, 0xA6, 0x00, 0x95, 0xC6, 0x8F, 0xCD, 0xAB, 0x8B, 0xCB, 0x62, 0xF3, 0xC5, 0xB6, 0xE6, 0x2B,
+0x83, 0xA5, 0x21, 0x99, 0x92, 0xC1, 0x04, 0x1A, 0x06, 0x4B, 0xBA, 0x89, 0xC4, 0x45, 0x2B, 0xC6,
+0x23, 0x27, 0x2C, 0x95, 0x9E, 0xFF, 0xFF, 0x02, 0xC0, 0x7D, 0xEF, 0x71, 0x1A, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF, 0x1E, 0xDF, 0x02, 0xBE, 0xC3, 0x5A, 0xC6, 0x11, 0x84, 0x9B,
+0xCE, 0xFD, 0xDE, 0x68, 0xC3, 0xF9, 0xBD, 0x7B, 0xC6, 0x15, 0x9D, 0xB8, 0xB5, 0xAE, 0xC2, 0x35,
+0xA5, 0xBC, 0xD6, 0xD4, 0x9C, 0x5B, 0xC2, 0x52, 0x84, 0x19, 0xBE, 0x5E, 0xE7, 0x96, 0xBF, 0x00,
+0xC2, 0x76, 0xAD, 0x93, 0x94, 0xDC, 0xD6, 0x00, 0x54, 0xC0, 0x5B, 0xC6, 0x5F, 0xC1, 0x93, 0x8C,
+0x3A, 0xBE, 0x64, 0x68, 0xC1, 0x9C, 0xCE, 0xB4, 0x94, 0x4C, 0x47, 0x5B, 0x40, 0xA6, 0x03, 0xC0,
+0x9F, 0xF7, 0x49, 0xC3, 0xDB, 0xE6, 0x5D, 0xF7, 0xBE, 0xF7, 0x1C, 0xE7, 0xAB, 0xBE, 0x9A, 0xBE,
+0x00, 0x7F, 0x44, 0x02, 0xAF, 0x00, 0x44, 0x70, 0xC0, 0x7A, 0xD6, 0x90, 0xC0, 0x9A, 0xDE, 0x95,
+0xC6, 0xEB, 0x5A, 0x48, 0x3A, 0xCA, 0x42, 0x27, 0x2B, 0x85, 0x1A, 0xEA, 0x42, 0x4C, 0x53, 0x4C,
+0xC5, 0x06, 0x2A, 0x02, 0x09, 0xAF, 0x5B, 0xED, 0x5A, 0x87, 0x31, 0xC8, 0x39, 0x7F, 0x00, 0xAE,
+0x00, 0x7F, 0x00, 0xC0, 0xE8, 0x39, 0x53, 0xC2, 0x09, 0x3A, 0x11, 0x64, 0x45, 0x1A, 0x01, 0xC1,
+0xE5, 0x19, 0x07, 0x2B, 0x91, 0x50, 0xC3, 0x90, 0x64, 0xAD, 0x52, 0x26, 0x29, 0x67, 0x29, 0x72,
+0x05, 0xBE, 0x72, 0x7A, 0xC1, 0xCC, 0x5A, 0x8E, 0x73, 0x5E, 0x77, 0x72, 0xC4, 0xA8, 0x31, 0xEC,
+0x62, 0x2D, 0x6B, 0x8B, 0x52, 0x2A, 0x4A, 0x72, 0x7A, 0x6E, 0xC0, 0x4A, 0x4A, 0x00, 0xC0, 0xA8,
+0x39, 0x72, 0x00, 0xA9, 0x96, 0x7A, 0x4E, 0x72, 0x01, 0x77, 0x66, 0xC1, 0x0D, 0x53, 0x47, 0x2A,
+0x75, 0x46, 0xAE, 0xBE, 0xA6, 0xC0, 0xA6, 0x22, 0x64, 0x01, 0xAE, 0xA1, 0x46, 0xC1, 0x08, 0x2C,
+0x69, 0x34, 0x58, 0xC2, 0xC4, 0x19, 0x86, 0x22, 0xC7, 0x2B, 0x46, 0xC0, 0x23, 0x11, 0xA6, 0xC9,
+0x64, 0x19, 0x4F, 0x8C, 0x6D, 0xB4, 0x58, 0xF7, 0xFC, 0xFF, 0xD5, 0xC5, 0x8E, 0x83, 0x8E, 0xA4,
+0x0F, 0xBD, 0x4F, 0xC5, 0xA5, 0x99, 0x00, 0x92, 0xC8, 0x6C, 0xA4, 0x4B, 0x7B, 0xAA, 0x5A, 0xB3,
+0xBD, 0xFA, 0xFF, 0x38, 0xF7, 0xED, 0x9B, 0xC6, 0x31, 0x63, 0x11, 0x59, 0x52, 0xC0, 0xA3, 0x11,
+0xAE, 0x00, 0xC4, 0x64, 0x1A, 0xE6, 0x2B, 0x47, 0x2C, 0x75, 0x9E, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF, 0x1E, 0xDF, 0x02, 0xAE, 0xA5, 0xC0, 0xB3, 0x94, 0x92,
+0xC4, 0x76, 0xAD, 0xF0, 0x7B, 0x31, 0x84, 0xF4, 0x9C, 0x56, 0xA5, 0xBF, 0x68, 0xC1, 0x11, 0x84,
+0x15, 0x9D, 0xBA, 0x7B, 0x68, 0xC3, 0x1A, 0xBE, 0x5F, 0xE7, 0xBC, 0xD6, 0xB8, 0xB5, 0x7B, 0x5B,
+0x4C, 0x54, 0x48, 0xC0, 0xD0, 0x7B, 0x67, 0x74, 0xAF, 0xC2, 0x97, 0xAD, 0xF9, 0xBD, 0xAF, 0x73,
+0x77, 0x91, 0xC1, 0xDC, 0xD6, 0xB4, 0x94, 0x4F, 0x91, 0x04, 0xC0, 0xBF, 0xF7, 0x90, 0xC1, 0xDB,
+0xE6, 0x7D, 0xF7, 0x5D, 0xC0, 0x1C, 0xE7, 0xAF, 0xBE, 0x01, 0x7C, 0x00, 0xBA, 0x44, 0x00, 0x50,
+0x01, 0xBE, 0xC9, 0xD7, 0xC5, 0x8C, 0x5A, 0xED, 0x62, 0x2E, 0x6B, 0x92, 0x9C, 0x13, 0xA5, 0x92,
+0x84, 0xF2, 0x8C, 0x45, 0x22, 0x84, 0x11, 0x00, 0xA9, 0x00, 0xAF, 0x5E, 0xC0, 0xEB, 0x3A, 0xB2,
+0xC6, 0x8E, 0x6B, 0x72, 0x94, 0x8A, 0x52, 0x65, 0x21, 0xD0, 0x6B, 0xB3, 0x84, 0xC7, 0x29, 0xB5,
+0xC4, 0xD7, 0xBD, 0x34, 0xA5, 0x6A, 0x42, 0x0C, 0x43, 0x85, 0x11, 0x5E, 0xC0, 0xC4, 0x19, 0x00,
+0xC0, 0xE7, 0x2A, 0x95, 0x91, 0xC3, 0xB0, 0x64, 0xAC, 0x52, 0x27, 0x29, 0x67, 0x29, 0xA6, 0x01,
+0x77, 0x00, 0x72, 0x7A, 0xA6, 0x72, 0xC4, 0xA8, 0x31, 0x2A, 0x42, 0xA8, 0x39, 0x2A, 0x4A, 0x87,
+0x31, 0xAB, 0x77, 0x4E, 0xC0, 0x29, 0x42, 0xA2, 0x7A, 0x72, 0x4B, 0xC0, 0x2D, 0x6B, 0xAE, 0xC1,
+0xEC, 0x5A, 0x4B, 0x4A, 0x72, 0x00, 0x4E, 0x76, 0xC0, 0x8B, 0x52, 0x4E, 0xC0, 0x46, 0x29, 0x00,
+0x72, 0x00, 0xA5, 0xC1, 0xED, 0x52, 0x26, 0x22, 0x94, 0xAF, 0xA2, 0xA1, 0xC2, 0x46, 0x22, 0xA6,
+0x2A, 0x45, 0x1A, 0x00, 0xBE, 0xC1, 0xE7, 0x2A, 0x85, 0x1A, 0x41, 0xC2, 0x27, 0x23, 0x69, 0x34,
+0x26, 0x23, 0x41, 0x64, 0x00, 0x49, 0xC0, 0x43, 0x11, 0x00, 0xAB, 0xC3, 0xC5, 0x31, 0x89, 0x7B,
+0xD5, 0xE6, 0x99, 0xF7, 0xBF, 0xC2, 0x50, 0x9C, 0x0D, 0x6B, 0x6E, 0x73, 0xBE, 0x00, 0xA9, 0xA6,
+0x00, 0x53, 0xC2, 0xAB, 0x5A, 0x0E, 0x84, 0xB9, 0xFF, 0x75, 0xC2, 0x75, 0xDE, 0x88, 0x52, 0x84,
+0x21, 0x52, 0xAB, 0x01, 0xAD, 0x00, 0x46, 0xC0, 0xC6, 0x2B, 0x6A, 0xC0, 0x95, 0x9E, 0x71, 0x1F,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF, 0x1E, 0xDF, 0x02, 0xAE, 0xA1, 0x96, 0xC0,
+0x93, 0x94, 0x81, 0xC9, 0x93, 0x8C, 0x19, 0xBE, 0x56, 0xA5, 0x3A, 0xC6, 0x77, 0xAD, 0xF0, 0x7B,
+0x72, 0x8C, 0xB3, 0x94, 0x15, 0x9D, 0xFD, 0xDE, 0x74, 0xC2, 0xB8, 0xB5, 0x5F, 0xE7, 0xBC, 0xD6,
+0x4B, 0x7B, 0x67, 0x95, 0xC0, 0x31, 0x84, 0xBF, 0xC0, 0xD4, 0x9C, 0x73, 0x54, 0xC1, 0x97, 0xAD,
+0x15, 0xA5, 0x43, 0x47, 0x57, 0xAF, 0x77, 0x7C, 0x4F, 0x7B, 0x04, 0xC0, 0xBF, 0xF7, 0x90, 0x5F,
+0xC2, 0x5D, 0xF7, 0xDF, 0xFF, 0x3D, 0xEF, 0x9A, 0xC2, 0x7A, 0xD6, 0xDC, 0xDE, 0x5D, 0xEF, 0x7C,
+0x44, 0x00, 0x50, 0x01, 0xBE, 0x44, 0x50, 0xC7, 0x76, 0xBD, 0x4C, 0x52, 0xAE, 0x52, 0x0A, 0x42,
+0x51, 0x8C, 0xEE, 0x73, 0x03, 0x11, 0x64, 0x19, 0x5E, 0x00, 0xAE, 0xC0, 0x26, 0x2A, 0xBF, 0x85,
+0xC0, 0x08, 0x2B, 0x9A, 0xB6, 0xC5, 0xD2, 0x8C, 0x97, 0xB5, 0x2C, 0x5B, 0xC5, 0x19, 0x27, 0x2A,
+0x68, 0x32, 0x59, 0xC2, 0x28, 0x32, 0xDB, 0xD6, 0x18, 0xB6, 0x5F, 0x5E, 0xAF, 0xC3, 0xA8, 0x2A,
+0x48, 0x33, 0x86, 0x22, 0xC6, 0x22, 0x00, 0x91, 0xC3, 0x90, 0x64, 0x8C, 0x52, 0x26, 0x21, 0x67,
+0x29, 0x00, 0xA6, 0x06, 0xC1, 0xA8, 0x39, 0x8B, 0x52, 0x00, 0x6E, 0xC0, 0x67, 0x31, 0x77, 0x00,
+0x72, 0xA5, 0xC1, 0x87, 0x31, 0x09, 0x42, 0x72, 0x7A, 0xC1, 0x2A, 0x4A, 0xAB, 0x5A, 0x00, 0xC0,
+0xC8, 0x39, 0x72, 0x66, 0x76, 0xC0, 0x2D, 0x6B, 0x96, 0xC0, 0x87, 0x31, 0x6B, 0x72, 0x00, 0x6B,
+0x00, 0xC1, 0x08, 0x3A, 0xA4, 0x19, 0x46, 0xA2, 0xC0, 0x06, 0x2A, 0xBB, 0xC0, 0x69, 0x42, 0xA9,
+0xC0, 0x07, 0x2A, 0x53, 0xC7, 0x88, 0x3A, 0xC9, 0x4A, 0x29, 0x33, 0x68, 0x2B, 0xE6, 0x22, 0x27,
+0x23, 0x67, 0x2B, 0xA5, 0x22, 0x92, 0xC1, 0xA6, 0x22, 0xE4, 0x19, 0x5E, 0x00, 0x66, 0x92, 0xC4,
+0x0B, 0x4B, 0xF7, 0xB5, 0x95, 0xAD, 0xD6, 0xB5, 0x14, 0x9D, 0xAF, 0xBA, 0xAE, 0xC0, 0x96, 0xAD,
+0xA6, 0xC3, 0x10, 0x7C, 0xD3, 0x8C, 0x51, 0x84, 0xD3, 0x94, 0xAF, 0xC0, 0x54, 0xA5, 0x00, 0xC0,
+0x2B, 0x5B, 0x52, 0x01, 0xAB, 0xC2, 0xA4, 0x11, 0x45, 0x22, 0xA5, 0x2A, 0x58, 0xC4, 0xE5, 0x1A,
+0xE6, 0x2B, 0x67, 0x2C, 0x95, 0x9E, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0,
+0x7E, 0xEF, 0x7B, 0x02, 0x40, 0xC1, 0xDD, 0xD6, 0xB4, 0x94, 0xBE, 0xC4, 0xDC, 0xD6, 0x15, 0x9D,
+0x77, 0xAD, 0x5A, 0xC6, 0x9C, 0xCE, 0x91, 0x68, 0x74, 0xC0, 0xF9, 0xBD, 0x73, 0x53, 0xC2, 0x52,
+0x84, 0x15, 0xA5, 0x3E, 0xE7, 0x40, 0xBF, 0x43, 0xC1, 0x7B, 0xC6, 0x72, 0x8C, 0x77, 0xC0, 0xBC,
+0xCE, 0x7B, 0xC0, 0xF9, 0xB5, 0x73, 0x78, 0x00, 0x77, 0x7B, 0x73, 0x00, 0x5F, 0xC0, 0xBC, 0xD6,
+0x40, 0xA6, 0x04, 0xC0, 0xBF, 0xF7, 0x90, 0xC1, 0xFB, 0xE6, 0x7E, 0xF7, 0x71, 0xC2, 0x9E, 0xF7,
+0xDB, 0xDE, 0xD8, 0xC5, 0xAE, 0xAE, 0xC1, 0x96, 0xB5, 0x14, 0xAD, 0x91, 0xC0, 0x18, 0xCE, 0x50,
+0xA5, 0x50, 0x44, 0xBF, 0xC1, 0x97, 0xBD, 0x8D, 0x52, 0xAE, 0xC4, 0xE4, 0x18, 0xD0, 0x7B, 0x71,
+0x8C, 0x68, 0x42, 0xE6, 0x29, 0x9D, 0x96, 0x5E, 0xC9, 0x91, 0x7C, 0x13, 0x95, 0xE7, 0x2A, 0xC9,
+0x33, 0x2A, 0x3C, 0xA6, 0x1A, 0x30, 0x74, 0x59, 0xC6, 0x89, 0x42, 0xC4, 0x19, 0x5E, 0xA9, 0xC2,
+0x46, 0x1A, 0xAB, 0x43, 0x35, 0xA5, 0x00, 0xC1, 0x69, 0x3A, 0xA3, 0x11, 0x6B, 0xC2, 0xC7, 0x22,
+0x0A, 0x34, 0xE7, 0x2A, 0x91, 0xAE, 0x91, 0xC3, 0x6F, 0x64, 0x8C, 0x52, 0x26, 0x29, 0x67, 0x29,
+0x01, 0x72, 0xA9, 0x72, 0x6B, 0x72, 0x77, 0x66, 0xC2, 0x67, 0x31, 0x4A, 0x4A, 0x2E, 0x6B, 0x95,
+0xC0, 0x87, 0x31, 0x72, 0xAE, 0xC0, 0x09, 0x42, 0xAB, 0xC0, 0x6B, 0x4A, 0x00, 0x72, 0x77, 0x72,
+0x00, 0x66, 0x77, 0x72, 0x00, 0x6B, 0x7F, 0xC0, 0x2A, 0x4A, 0x91, 0x72, 0x03, 0xC2, 0xC7, 0x29,
+0xC4, 0x19, 0x06, 0x22, 0x00, 0xC1, 0xE7, 0x31, 0xE8, 0x41, 0xBF, 0x67, 0x95, 0x67, 0x5B, 0x96,
+0xC1, 0x93, 0x7C, 0x0D, 0x5C, 0x4B, 0xC3, 0x49, 0x3B, 0xC9, 0x33, 0x45, 0x1A, 0xA4, 0x19, 0x6B,
+0xAB, 0xBE, 0xAF, 0x00, 0x80, 0xC1, 0x68, 0x2A, 0x2D, 0x43, 0xBA, 0x99, 0xA6, 0xA1, 0xC1, 0x0B,
+0x43, 0x8C, 0x4B, 0x53, 0x00, 0xC3, 0x68, 0x32, 0x29, 0x3B, 0xAA, 0x43, 0x2C, 0x4B, 0x92, 0x91,
+0x53, 0xC0, 0x85, 0x19, 0x52, 0x00, 0x5E, 0x6B, 0xC1, 0x27, 0x53, 0xE9, 0x93, 0x00, 0x89, 0xC4,
+0xE7, 0x5B, 0x06, 0x2C, 0x47, 0x24, 0x75, 0x9E, 0xFF, 0xFF, 0x00, 0xC2, 0x79, 0xCE, 0xCF, 0x7B,
+0xD7, 0xBD, 0x71, 0x00, 0xC3, 0x1C, 0xE7, 0x10, 0x84, 0x75, 0xAD, 0x9A, 0xD6, 0x70, 0x71, 0x79,
+0xC0, 0x3C, 0xE7, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x7E, 0xEF, 0x1E, 0xDF,
+0x03, 0xAE, 0x4F, 0x00, 0xA5, 0x4F, 0x43, 0x00, 0x40, 0x43, 0x4F, 0x01, 0x43, 0x40, 0xC0, 0x7F,
+0xE7, 0x4F, 0x7B, 0x02, 0x43, 0x4F, 0x00, 0x43, 0x4F, 0x43, 0x02, 0xAE, 0x4F, 0x43, 0x00, 0x48,
+0x40, 0x7B, 0x05, 0xC0, 0xBF, 0xF7, 0x49, 0xC1, 0xFB, 0xE6, 0x9E, 0xF7, 0x71, 0xA2, 0xC5, 0x3C,
+0xEF, 0x9A, 0xDE, 0xF8, 0xC5, 0x76, 0xAD, 0xD3, 0x9C, 0x30, 0x8C, 0x6C, 0xC2, 0x34, 0xAD, 0xBF,
+0xF7, 0x5D, 0xEF, 0x01, 0x71, 0xC1, 0x39, 0xCE, 0xCE, 0x62, 0x91, 0xC1, 0x6A, 0x52, 0xD3, 0xA4,
+0x96, 0xC2, 0x14, 0xAD, 0x8D, 0x63, 0xC7, 0x22, 0xBE, 0x46, 0xC2, 0x8F, 0x94, 0x11, 0xB5, 0x05,
+0x2A, 0x89, 0xC4, 0x45, 0x1A, 0xE5, 0x19, 0x2B, 0x4B, 0x50, 0x7C, 0xE9, 0x42, 0x72, 0x5E, 0xC3,
+0x46, 0x22, 0x6A, 0x3C, 0x4E, 0x65, 0x0F, 0x74, 0x92, 0xC1, 0x2B, 0x53, 0xC4, 0x11, 0xBE, 0x00,
+0xC0, 0x25, 0x1A, 0x77, 0xC1, 0x07, 0x2B, 0xA6, 0x22, 0x95, 0xC2, 0x6F, 0x5C, 0x8C, 0x4A, 0x26,
+0x29, 0xAF, 0x01, 0xBE, 0x00, 0x72, 0xA9, 0xAF, 0x00, 0x6B, 0x72, 0xC1, 0xE9, 0x39, 0xCC, 0x5A,
+0xBF, 0xC0, 0x88, 0x31, 0x91, 0x77, 0x6E, 0xA9, 0x62, 0x91, 0x72, 0x01, 0x77, 0x00, 0x72, 0x01,
+0xC0, 0xA8, 0x31, 0x72, 0xA6, 0x6B, 0x72, 0x00, 0x77, 0x00, 0x72, 0xC0, 0x08, 0x32, 0x70, 0xC0,
+0x26, 0x22, 0xB3, 0xB2, 0x67, 0xC0, 0x8A, 0x52, 0x43, 0x67, 0x48, 0x96, 0xC6, 0xA8, 0x31, 0xB0,
+0x6B, 0x0B, 0x4B, 0xC3, 0x11, 0x88, 0x3A, 0x2B, 0x53, 0xCA, 0x4A, 0xB6, 0xAE, 0x00, 0xAE, 0xC2,
+0xEB, 0x62, 0x48, 0x42, 0x83, 0x11, 0x00, 0xA6, 0x9A, 0x52, 0x00, 0x96, 0xC0, 0x45, 0x1A, 0x75,
+0xC0, 0x23, 0x09, 0x52, 0xA6, 0xA9, 0xC1, 0x44, 0x1A, 0x83, 0x09, 0x45, 0x52, 0x4D, 0x5E, 0xBE,
+0xA6, 0x57, 0xC9, 0x27, 0x53, 0x0C, 0xBD, 0x54, 0xDE, 0xD6, 0xEE, 0x10, 0xD6, 0x2A, 0xA4, 0x48,
+0x64, 0x26, 0x24, 0x75, 0x9E, 0xFF, 0xFF, 0x00, 0xC0, 0x1C, 0xE7, 0x91, 0xC0, 0xEF, 0x83, 0x49,
+0x71, 0xC0, 0x5D, 0xEF, 0x5C, 0xC0, 0x72, 0x94, 0xAE, 0xC0, 0x96, 0xB5, 0x71, 0xC1, 0x51, 0x8C,
+0x3C, 0xEF, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x7E, 0xEF, 0x7B, 0x2D, 0xC0,
+0xBF, 0xF7, 0x49, 0xC1, 0xFB, 0xEE, 0x9E, 0xF7, 0x71, 0x91, 0xC0, 0xFB, 0xE6, 0x00, 0xC3, 0x18,
+0xC6, 0x96, 0xB5, 0xF4, 0xA4, 0x91, 0x94, 0x96, 0xC0, 0xB6, 0xBD, 0x5D, 0x44, 0x00, 0x58, 0x71,
+0xC1, 0x7A, 0xD6, 0xAD, 0x5A, 0xBE, 0xC3, 0xB7, 0xBD, 0xBA, 0xE6, 0x30, 0x8C, 0x2C, 0x63, 0x9D,
+0xC8, 0x24, 0x1A, 0x65, 0x1A, 0x67, 0x2A, 0x8A, 0x83, 0xA9, 0x9B, 0x84, 0x29, 0xE5, 0x19, 0xC7,
+0x22, 0x07, 0x2B, 0xAF, 0xA9, 0x01, 0xA7, 0xC3, 0x4A, 0x34, 0xC9, 0x34, 0x06, 0x23, 0xC4, 0x11,
+0xAF, 0x77, 0xA5, 0x77, 0xA9, 0x92, 0xC0, 0xC8, 0x2A, 0x9C, 0xA2, 0x4B, 0x79, 0xC1, 0x8C, 0x4A,
+0x26, 0x29, 0x72, 0x00, 0xA9, 0xC0, 0x88, 0x31, 0x00, 0x72, 0xBE, 0x6B, 0x72, 0x00, 0xC1, 0x87,
+0x31, 0xED, 0x62, 0xA9, 0xC0, 0x4A, 0x4A, 0x46, 0x91, 0xAE, 0xC2, 0x0A, 0x4A, 0x4B, 0x4A, 0xC8,
+0x39, 0x77, 0x00, 0x72, 0x77, 0x01, 0x72, 0x00, 0x7A, 0xC0, 0xCC, 0x5A, 0x91, 0x96, 0xC0, 0x09,
+0x42, 0x72, 0x77, 0x72, 0x00, 0xA9, 0xC3, 0x8B, 0x42, 0xC5, 0x19, 0x06, 0x22, 0x29, 0x32, 0x7F,
+0xC1, 0xE8, 0x41, 0x69, 0x52, 0x96, 0xA6, 0xC0, 0x6A, 0x52, 0x74, 0x53, 0xC1, 0xED, 0x52, 0xE7,
+0x31, 0x52, 0xC1, 0xCA, 0x52, 0xAF, 0x83, 0x95, 0x03, 0xAB, 0xC0, 0xEB, 0x62, 0x4D, 0x00, 0x5E,
+0xC0, 0xE5, 0x21, 0x72, 0xA9, 0xC0, 0xE8, 0x32, 0x5F, 0xC0, 0x83, 0x11, 0xA6, 0xC0, 0xC5, 0x21,
+0x00, 0xC0, 0x23, 0x11, 0x46, 0xC1, 0x46, 0x2A, 0x64, 0x11, 0x5E, 0xBA, 0xAE, 0x6B, 0x5E, 0x70,
+0xC2, 0x6A, 0x8C, 0xF6, 0xE6, 0xFE, 0xFF, 0x00, 0xC5, 0x7A, 0xF7, 0x2D, 0xC5, 0xCA, 0x9C, 0x47,
+0x34, 0x54, 0x96, 0xFF, 0xFF, 0x01, 0xC0, 0x38, 0xCE, 0x54, 0x5D, 0x71, 0x00, 0xC5, 0xBA, 0xD6,
+0x71, 0x8C, 0x79, 0xCE, 0xD3, 0x9C, 0x7D, 0xEF, 0x92, 0x94, 0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0x50, 0xC0, 0x1E, 0xDF, 0x2D, 0xC0, 0xBF, 0xF7, 0x49, 0xC1, 0x1C, 0xEF, 0xBE, 0xFF,
+0x71, 0x49, 0xC0, 0x99, 0xD6, 0xAB, 0xC5, 0xF8, 0xC5, 0x35, 0xAD, 0x51, 0x94, 0x4D, 0x6B, 0x50,
+0x8C, 0x18, 0xCE, 0x58, 0x91, 0x01, 0xA5, 0xC3, 0x96, 0xBD, 0x8D, 0x52, 0x2E, 0x6B, 0x99, 0xDE,
+0xBF, 0xC2, 0xCE, 0x7B, 0xAA, 0x52, 0x6C, 0x5B, 0x52, 0xC6, 0x02, 0x11, 0x64, 0x19, 0x90, 0x94,
+0xF2, 0xAC, 0x09, 0x43, 0x88, 0x2B, 0x89, 0x34, 0xA9, 0xA6, 0x45, 0x7E, 0xC0, 0xC9, 0x34, 0xA6,
+0xC2, 0x48, 0x2C, 0xA5, 0x1A, 0xA4, 0x11, 0x5E, 0x63, 0x6B, 0x01, 0x72, 0xC0, 0xE8, 0x2A, 0xA9,
+0x6B, 0xC0, 0xA6, 0x22, 0x94, 0xC2, 0x6F, 0x5C, 0x8C, 0x4A, 0x26, 0x29, 0xAF, 0xAE, 0x72, 0x01,
+0x77, 0xBA, 0x72, 0xA9, 0x72, 0x7A, 0x76, 0xC0, 0x6B, 0x52, 0x43, 0x7F, 0x72, 0x00, 0xC3, 0xA8,
+0x39, 0x8B, 0x52, 0x4E, 0x6B, 0xE9, 0x39, 0x72, 0x01, 0x7A, 0x77, 0x00, 0xA7, 0x77, 0x67, 0x4E,
+0x7F, 0x77, 0x72, 0x02, 0x66, 0xC6, 0x4E, 0x5B, 0x07, 0x22, 0x48, 0x32, 0xEC, 0x52, 0x86, 0x29,
+0xE9, 0x41, 0x8A, 0x52, 0x74, 0x91, 0xC0, 0xAA, 0x5A, 0x74, 0xC6, 0xC7, 0x39, 0xCC, 0x52, 0xC7,
+0x31, 0x42, 0x11, 0xAA, 0x52, 0xF0, 0x8B, 0x8E, 0x7B, 0xA6, 0x00, 0x9A, 0x56, 0x5B, 0xC1, 0xCB,
+0x5A, 0x23, 0x11, 0x7C, 0x48, 0xC4, 0x27, 0x32, 0xA9, 0x42, 0xE9, 0x4A, 0x4B, 0x53, 0xE4, 0x19,
+0x52, 0x48, 0xC2, 0x85, 0x29, 0xE7, 0x39, 0x65, 0x21, 0x51, 0xC1, 0x68, 0x4A, 0xA5, 0x21, 0x5E,
+0x00, 0xC0, 0xC5, 0x19, 0xA5, 0x5E, 0xC2, 0xE5, 0x19, 0x4A, 0x8C, 0x38, 0xEF, 0x6A, 0x00, 0xA1,
+0xC4, 0x31, 0xE6, 0x8D, 0xAD, 0x67, 0x34, 0x54, 0x8E, 0xFF, 0xFF, 0x01, 0xC2, 0xF3, 0xA4, 0x10,
+0x84, 0xDF, 0xFF, 0x71, 0x00, 0xC3, 0xB6, 0xB5, 0xAE, 0x7B, 0x7D, 0xF7, 0xD3, 0x9C, 0x7D, 0x91,
+0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x92, 0xC0, 0x1E, 0xDF, 0x2C, 0xBE, 0x71, 0xC2,
+0x7D, 0xEF, 0xDA, 0xE6, 0x9D, 0xF7, 0x6C, 0xC1, 0x1C, 0xE7, 0xB6, 0xBD, 0x91, 0xC0, 0x18, 0xC6,
+0x00, 0xC1, 0x76, 0xB5, 0x14, 0xA5, 0x40, 0xC1, 0xDB, 0xE6, 0x5D, 0xEF, 0x00, 0xAF, 0x44, 0xBF,
+0xC3, 0x35, 0xAD, 0xEA, 0x41, 0xB0, 0x83, 0x1C, 0xEF, 0x58, 0xCC, 0x8D, 0x73, 0x31, 0x84, 0xB1,
+0x84, 0x23, 0x09, 0xA5, 0x19, 0x27, 0x2A, 0x30, 0x7C, 0x6E, 0x63, 0x68, 0x3B, 0x45, 0x23, 0xA5,
+0x1A, 0x45, 0x1A, 0xA6, 0x22, 0x00, 0x46, 0xC3, 0x86, 0x22, 0x28, 0x2B, 0x87, 0x2A, 0x89, 0x3A,
+0x80, 0xAE, 0x95, 0x77, 0xA5, 0xAB, 0xC2, 0x08, 0x2B, 0x48, 0x2B, 0xA4, 0x11, 0x66, 0xC0, 0xA6,
+0x22, 0x91, 0xC2, 0x4E, 0x5C, 0x8C, 0x4A, 0x26, 0x29, 0xAF, 0xAE, 0x00, 0x72, 0x00, 0x77, 0x00,
+0x72, 0x01, 0xC0, 0x88, 0x31, 0x4A, 0xA9, 0x92, 0x7A, 0x72, 0x7A, 0xC0, 0x4A, 0x4A, 0x76, 0xC0,
+0x87, 0x31, 0x77, 0x00, 0x72, 0x01, 0x77, 0x00, 0x72, 0x00, 0x7F, 0x00, 0x7A, 0x00, 0x72, 0x00,
+0x77, 0x00, 0x66, 0xC2, 0x2E, 0x5B, 0x07, 0x2A, 0x48, 0x32, 0x65, 0x75, 0x62, 0x43, 0x6F, 0x81,
+0xC0, 0xAA, 0x5A, 0x74, 0xC5, 0xC8, 0x39, 0xAC, 0x52, 0x28, 0x32, 0x42, 0x11, 0xAA, 0x52, 0xCF,
+0x83, 0x91, 0x00, 0x56, 0x9A, 0x00, 0xC2, 0xAE, 0x7B, 0xCB, 0x5A, 0xE3, 0x10, 0xA5, 0x9A, 0xC2,
+0x68, 0x3A, 0xB5, 0xB5, 0xB5, 0xC5, 0x9F, 0xC0, 0x6F, 0x74, 0x63, 0x48, 0xC1, 0x44, 0x21, 0xC7,
+0x39, 0xAB, 0xC2, 0x46, 0x31, 0xA7, 0x39, 0x85, 0x21, 0x52, 0xC0, 0xA4, 0x19, 0x01, 0x5E, 0xC8,
+0x46, 0x22, 0x09, 0x6C, 0x90, 0xCD, 0xBC, 0xFF, 0xFF, 0xFF, 0x58, 0xF7, 0xAE, 0xD5, 0x4B, 0xA5,
+0x26, 0x2C, 0x79, 0x71, 0x02, 0xC1, 0xB2, 0x9C, 0xDB, 0xDE, 0x71, 0x01, 0xC3, 0x75, 0xB5, 0x59,
+0xCE, 0xD7, 0xBD, 0x4D, 0x6B, 0x5C, 0x71, 0x11, 0x70, 0x00, 0x71, 0x05, 0x92, 0xC0, 0x5E, 0xE7,
+0xA6, 0x29, 0x48, 0xC0, 0xDF, 0xFF, 0x71, 0x6C, 0xC0, 0x7D, 0xEF, 0xA5, 0xA6, 0x00, 0x9A, 0xA6,
+0xC0, 0x9D, 0xF7, 0xBF, 0x00, 0xAE, 0xC0, 0x7D, 0xF7, 0x49, 0x01, 0xBB, 0x00, 0xC1, 0xBE, 0xF7,
+0x9A, 0xD6, 0x68, 0xC3, 0xD7, 0xC5, 0x5D, 0xF7, 0xDA, 0xE6, 0xAE, 0x7B, 0xAF, 0xC2, 0xC9, 0x4A,
+0xC5, 0x19, 0xE7, 0x2A, 0x94, 0xC0, 0x43, 0x11, 0xA6, 0xC0, 0x83, 0x11, 0x00, 0x66, 0xC2, 0xA7,
+0x2A, 0x89, 0x33, 0x08, 0x2B, 0x95, 0xA6, 0xC2, 0x34, 0x8D, 0x76, 0xA5, 0xA7, 0x31, 0x90, 0xC2,
+0x55, 0xA5, 0xCE, 0x5B, 0xE5, 0x19, 0x63, 0xC2, 0x87, 0x22, 0x88, 0x33, 0x05, 0x1A, 0x66, 0x00,
+0xC0, 0xA6, 0x22, 0x4B, 0xC3, 0x4E, 0x54, 0x8C, 0x4A, 0x26, 0x29, 0x67, 0x29, 0xA6, 0x00, 0x7A,
+0x77, 0x00, 0x72, 0x7A, 0x77, 0x72, 0xC2, 0x88, 0x31, 0xCC, 0x5A, 0x6E, 0x73, 0x63, 0xC0, 0x87,
+0x31, 0x77, 0x00, 0xC1, 0xC8, 0x39, 0x2A, 0x4A, 0x67, 0x7A, 0x77, 0x72, 0x03, 0xA9, 0x77, 0xC1,
+0x8B, 0x52, 0xA8, 0x31, 0x00, 0x4A, 0x72, 0x00, 0x77, 0x72, 0x66, 0x40, 0xC2, 0xE7, 0x29, 0x28,
+0x32, 0xEC, 0x52, 0x7F, 0x67, 0xC0, 0x49, 0x4A, 0x91, 0xA6, 0xC1, 0xAA, 0x52, 0x29, 0x4A, 0x53,
+0xC1, 0xCC, 0x52, 0x07, 0x32, 0x48, 0xC1, 0x4D, 0x63, 0xAF, 0x7B, 0xA5, 0xAB, 0x5B, 0xA6, 0x9A,
+0x67, 0xC0, 0xEB, 0x62, 0x7E, 0xA5, 0x96, 0xC1, 0x06, 0x32, 0x71, 0x94, 0xBB, 0xC2, 0xD3, 0xA4,
+0x70, 0x84, 0xE4, 0x19, 0x92, 0xC1, 0xE6, 0x29, 0x66, 0x31, 0x9E, 0x69, 0xBF, 0x5A, 0x8D, 0xC1,
+0x06, 0x22, 0xA4, 0x19, 0x96, 0xCA, 0xC4, 0x19, 0x0B, 0x3C, 0x6A, 0x44, 0xE9, 0x83, 0x4F, 0xCD,
+0xF2, 0xDD, 0x2E, 0xC5, 0xAA, 0xAC, 0x47, 0x54, 0x06, 0x24, 0x33, 0x8E, 0x71, 0x00, 0xC0, 0xD7,
+0xBD, 0x5C, 0x91, 0xC0, 0x9A, 0xD6, 0x4C, 0x48, 0x68, 0x6C, 0xC2, 0x5D, 0xEF, 0xBA, 0xD6, 0x8A,
+0x52, 0x71, 0x12, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x37, 0x51, 0xC2, 0x3B, 0xEF, 0xBD, 0xF7, 0xFE,
+0xFF, 0xAB, 0x0E, 0xC6, 0x7C, 0xF7, 0x2C, 0x63, 0x84, 0x19, 0x23, 0x11, 0x67, 0x2A, 0x06, 0x2B,
+0xC3, 0x19, 0x48, 0x00, 0xAE, 0xC1, 0xC5, 0x21, 0xA7, 0x2A, 0x9D, 0xC0, 0x67, 0x2B, 0xA2, 0x91,
+0xC5, 0x66, 0x22, 0x0F, 0x64, 0x74, 0xA5, 0x65, 0x29, 0xE3, 0x20, 0x31, 0x7C, 0x59, 0x63, 0x00,
+0xC1, 0xA7, 0x22, 0x07, 0x2B, 0x64, 0xAE, 0xC1, 0xC5, 0x19, 0x86, 0x22, 0x95, 0xC2, 0x4F, 0x5C,
+0x8C, 0x4A, 0x27, 0x29, 0xAE, 0xC0, 0xC9, 0x39, 0x95, 0x72, 0x00, 0xAE, 0xBA, 0x77, 0x00, 0x7A,
+0x72, 0xC3, 0x87, 0x31, 0x8B, 0x52, 0x2D, 0x6B, 0x88, 0x31, 0x72, 0x4B, 0xC2, 0xAC, 0x52, 0xC8,
+0x39, 0x6A, 0x4A, 0x76, 0x72, 0x77, 0x7A, 0x72, 0x00, 0x77, 0x72, 0x00, 0x7B, 0xAF, 0xA6, 0x76,
+0x72, 0x01, 0xA9, 0xA6, 0xC6, 0xEE, 0x5A, 0x27, 0x2A, 0x88, 0x32, 0x0C, 0x53, 0x87, 0x31, 0x09,
+0x42, 0xAA, 0x5A, 0x6F, 0x95, 0xC1, 0x8A, 0x52, 0x09, 0x4A, 0x4E, 0xC4, 0x8B, 0x4A, 0xC7, 0x31,
+0x03, 0x11, 0x4D, 0x5B, 0xAF, 0x7B, 0x91, 0x01, 0xAE, 0x53, 0x67, 0xC1, 0xEC, 0x62, 0xE3, 0x10,
+0xA5, 0x7E, 0xC5, 0x27, 0x3A, 0x8C, 0x73, 0xAD, 0x83, 0xEE, 0x8B, 0x8C, 0x6B, 0xC4, 0x19, 0x5E,
+0xA2, 0x43, 0xC0, 0xE5, 0x19, 0x61, 0xC0, 0x23, 0x11, 0x4D, 0xAF, 0x61, 0x63, 0xC5, 0x66, 0x22,
+0x08, 0x2B, 0xA6, 0x22, 0x25, 0x1A, 0xA5, 0x2A, 0x67, 0x6B, 0xBE, 0x86, 0xC4, 0x86, 0x3B, 0xC6,
+0x23, 0x07, 0x24, 0x34, 0x96, 0xFF, 0xFF, 0x00, 0xC3, 0x1C, 0xE7, 0xB6, 0xB5, 0x7D, 0xEF, 0xDF,
+0xFF, 0x49, 0x00, 0xC1, 0xB6, 0xBD, 0xFB, 0xDE, 0x71, 0x6C, 0xC0, 0x3C, 0xE7, 0x71, 0x12, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x35, 0x6C, 0x95, 0xC0, 0xDA, 0xDE, 0xBE, 0xC0, 0x7C, 0xEF, 0x45, 0xC4,
+0xF9, 0xD6, 0x35, 0xAE, 0x56, 0xBE, 0xFA, 0xDE, 0x3B, 0xEF, 0xAF, 0x71, 0x95, 0xC1, 0x57, 0xD6,
+0x73, 0xAD, 0x91, 0xA6, 0xA6, 0x42, 0x47, 0xC0, 0x93, 0xB5, 0xA6, 0xC1, 0xCA, 0x4A, 0xC5, 0x19,
+0xBB, 0xC1, 0x48, 0x42, 0x0B, 0x53, 0x43, 0xC1, 0xEB, 0x52, 0x07, 0x3A, 0x81, 0xC3, 0x0F, 0x74,
+0x0A, 0x43, 0xA4, 0x19, 0xE4, 0x19, 0x41, 0x6B, 0x00, 0xAF, 0xC3, 0x06, 0x2A, 0xA6, 0x21, 0x44,
+0x19, 0x46, 0x22, 0xA9, 0xC0, 0xA4, 0x11, 0x00, 0xC1, 0x86, 0x22, 0x27, 0x2B, 0xAE, 0xAE, 0xC0,
+0xA5, 0x22, 0xA6, 0x96, 0xC6, 0xB1, 0x6C, 0x8C, 0x4A, 0x26, 0x21, 0x87, 0x31, 0xAF, 0x7B, 0xEC,
+0x62, 0x47, 0x29, 0x02, 0xAE, 0x00, 0x72, 0x4E, 0xC0, 0x4D, 0x6B, 0xBF, 0xC0, 0xAB, 0x5A, 0x7A,
+0x72, 0xC1, 0xA8, 0x31, 0xCC, 0x5A, 0x7B, 0xC0, 0x8B, 0x52, 0x7B, 0x72, 0x77, 0x7A, 0x72, 0x00,
+0x77, 0x00, 0x72, 0x00, 0x4E, 0x00, 0x7A, 0x72, 0x00, 0x77, 0x72, 0x95, 0xC2, 0x0D, 0x5B, 0x67,
+0x2A, 0xA8, 0x3A, 0x74, 0x7F, 0xC1, 0xE8, 0x41, 0x8A, 0x52, 0x95, 0x60, 0xC0, 0xCB, 0x5A, 0x48,
+0xC2, 0xC8, 0x39, 0x09, 0x3A, 0x64, 0x19, 0x4D, 0xC1, 0x0C, 0x5B, 0xAF, 0x83, 0x91, 0x9A, 0x01,
+0xA9, 0xBF, 0xC1, 0x0C, 0x6B, 0xE3, 0x18, 0x81, 0xC2, 0x86, 0x21, 0x30, 0x7C, 0xAC, 0x7B, 0xBB,
+0xBF, 0xC2, 0x0C, 0x74, 0x85, 0x22, 0xC4, 0x19, 0xA2, 0x96, 0xC1, 0x65, 0x22, 0x84, 0x11, 0x54,
+0xAD, 0x5E, 0xC1, 0x25, 0x1A, 0xE7, 0x2A, 0x00, 0xC1, 0x05, 0x1A, 0xA4, 0x11, 0x00, 0xAE, 0xAE,
+0xC0, 0x24, 0x1A, 0x96, 0xC4, 0x85, 0x1A, 0xC6, 0x2B, 0x27, 0x24, 0x74, 0x96, 0xFF, 0xFF, 0x1F,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x36, 0xC0, 0x1C, 0xE7, 0x95, 0xC0, 0xBE, 0xF7, 0x6C, 0x71, 0xC4,
+0x14, 0x9E, 0xC6, 0x23, 0x08, 0x3C, 0x91, 0x94, 0xF0, 0x8B, 0x95, 0xC0, 0x0F, 0x8C, 0x96, 0x6F,
+0xC1, 0xE6, 0x31, 0x22, 0x09, 0xBB, 0xA5, 0x00, 0xAE, 0x4D, 0xC5, 0xC5, 0x21, 0x05, 0x22, 0x48,
+0x32, 0x0C, 0x53, 0x25, 0x29, 0x66, 0x31, 0x95, 0xC0, 0xA7, 0x31, 0x00, 0xA5, 0xBF, 0xC1, 0x2D,
+0x5B, 0x68, 0x32, 0x52, 0x63, 0x68, 0x00, 0x91, 0xA2, 0x01, 0x54, 0xC1, 0x06, 0x23, 0x45, 0x1A,
+0x68, 0x5A, 0xC0, 0x07, 0x23, 0x46, 0x6E, 0x58, 0x4E, 0x9A, 0xC6, 0xD2, 0x74, 0x8C, 0x4A, 0x26,
+0x29, 0x67, 0x31, 0x8A, 0x52, 0x09, 0x42, 0x47, 0x29, 0x77, 0x72, 0x00, 0x77, 0x72, 0x77, 0x00,
+0xBE, 0x01, 0x7A, 0x77, 0x72, 0x7F, 0xBF, 0x9A, 0x7A, 0x77, 0x72, 0x77, 0x00, 0x72, 0x77, 0x72,
+0x07, 0x77, 0x66, 0xC4, 0xCC, 0x4A, 0xC5, 0x21, 0x48, 0x32, 0x4E, 0x5B, 0xE9, 0x39, 0xB9, 0xC1,
+0x29, 0x4A, 0xC8, 0x39, 0x5B, 0xC0, 0xCB, 0x5A, 0x48, 0x4E, 0xC4, 0xAB, 0x4A, 0x07, 0x32, 0x02,
+0x09, 0xCB, 0x52, 0xCF, 0x83, 0x91, 0x01, 0x96, 0xAE, 0x5B, 0xC1, 0xEB, 0x62, 0xE3, 0x10, 0xA5,
+0xC2, 0x04, 0x11, 0x69, 0x42, 0xAD, 0x7B, 0xBA, 0xAF, 0xC1, 0xAC, 0x6B, 0x24, 0x1A, 0x52, 0xC2,
+0x85, 0x21, 0xC6, 0x29, 0x07, 0x2A, 0x6B, 0xBE, 0xC2, 0x26, 0x22, 0xA7, 0x2A, 0xE7, 0x2A, 0x49,
+0xC0, 0xE5, 0x19, 0x00, 0xA5, 0x77, 0xA1, 0x63, 0x01, 0x46, 0xC2, 0xE6, 0x2B, 0x47, 0x2C, 0x53,
+0x8E, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x36, 0x96, 0x6C, 0x71, 0x6C, 0x71, 0xC3, 0x34,
+0x9E, 0xE6, 0x1B, 0x4A, 0x44, 0x96, 0xB5, 0xA2, 0xC0, 0xB7, 0xBD, 0x96, 0xC2, 0x31, 0x84, 0x4E,
+0x6B, 0x48, 0x32, 0x4D, 0xAF, 0x4D, 0x01, 0xC1, 0xE6, 0x19, 0xA6, 0x22, 0x4D, 0xC3, 0x08, 0x32,
+0x0D, 0x5B, 0x25, 0x29, 0xC8, 0x39, 0x60, 0xBF, 0xC0, 0x8A, 0x52, 0x91, 0xC3, 0xC7, 0x39, 0x0D,
+0x5B, 0x48, 0x3A, 0x23, 0x11, 0xAF, 0xC4, 0xA9, 0x32, 0x2B, 0x4B, 0xF2, 0x94, 0x8C, 0x63, 0x0A,
+0x53, 0xA1, 0xC5, 0x0E, 0x74, 0x4E, 0x64, 0x87, 0x22, 0xE5, 0x19, 0x86, 0x22, 0xE6, 0x22, 0x5A,
+0x69, 0xC0, 0x66, 0x22, 0xA9, 0x46, 0xC2, 0xF2, 0x74, 0x6B, 0x4A, 0x26, 0x29, 0xAF, 0xA9, 0x72,
+0x05, 0x6B, 0x72, 0x01, 0x6B, 0x00, 0x72, 0x00, 0x6B, 0x72, 0x00, 0xAE, 0x00, 0x72, 0x03, 0x77,
+0x72, 0x01, 0x77, 0x72, 0x6B, 0x72, 0x02, 0xC4, 0x6C, 0x4A, 0x64, 0x19, 0x8A, 0x3A, 0x2D, 0x53,
+0x86, 0x29, 0x60, 0xC0, 0xEB, 0x62, 0x60, 0xA6, 0xC0, 0x89, 0x52, 0x6F, 0xC5, 0x87, 0x31, 0xCC,
+0x52, 0xE7, 0x31, 0xC2, 0x08, 0x69, 0x4A, 0xCF, 0x83, 0x95, 0x56, 0xAF, 0x56, 0xAE, 0x62, 0xC0,
+0x0C, 0x63, 0x43, 0xA5, 0x92, 0xC6, 0x27, 0x3A, 0xF7, 0xC5, 0x38, 0xCE, 0x99, 0xDE, 0x73, 0xA5,
+0x04, 0x1A, 0x22, 0x11, 0x4E, 0x7F, 0xAE, 0xC0, 0xE8, 0x39, 0x90, 0xC2, 0xE5, 0x21, 0x25, 0x1A,
+0xC4, 0x19, 0xA6, 0x6B, 0x01, 0x66, 0x9E, 0xC1, 0x24, 0x1A, 0x65, 0x22, 0x99, 0xC0, 0xA5, 0x1A,
+0x4F, 0xC1, 0x47, 0x24, 0x54, 0x96, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x05, 0xC1, 0xDD,
+0xDE, 0xFB, 0xC5, 0x2A, 0xC0, 0x9D, 0xDE, 0x71, 0x02, 0xA6, 0x00, 0x9A, 0x71, 0xCA, 0x55, 0xA6,
+0xE6, 0x23, 0x6B, 0x4C, 0xB7, 0xBD, 0x15, 0xAD, 0x56, 0xAD, 0x53, 0x84, 0xF2, 0x73, 0x6F, 0x6B,
+0x68, 0x3A, 0x83, 0x11, 0xBB, 0x59, 0x00, 0xC2, 0xE6, 0x21, 0x08, 0x2B, 0x25, 0x22, 0xA7, 0xC3,
+0x6B, 0x43, 0x6E, 0x63, 0x26, 0x29, 0xE8, 0x41, 0xAE, 0xC0, 0x48, 0x4A, 0xA6, 0x60, 0xC2, 0xA7,
+0x39, 0xCC, 0x52, 0xE9, 0x3A, 0x75, 0xA7, 0xC4, 0xAA, 0x3A, 0xF4, 0x94, 0x5D, 0xF7, 0x53, 0xAD,
+0xED, 0x8B, 0xBF, 0xC2, 0x17, 0xD6, 0xF7, 0xBD, 0xEB, 0x42, 0x46, 0xC1, 0x65, 0x1A, 0x07, 0x23,
+0xBE, 0xC1, 0x25, 0x1A, 0xA6, 0x22, 0x57, 0xC3, 0x45, 0x1A, 0x91, 0x6C, 0x8B, 0x4A, 0x26, 0x21,
+0x72, 0x01, 0xA9, 0x72, 0x00, 0xBE, 0x9A, 0x72, 0x02, 0x6B, 0x01, 0x72, 0x02, 0x77, 0x00, 0x72,
+0x01, 0x6B, 0x01, 0x72, 0x00, 0x7A, 0x72, 0x7A, 0x77, 0x01, 0x72, 0x00, 0x66, 0xC2, 0xAC, 0x4A,
+0x26, 0x22, 0x2B, 0x43, 0x5D, 0xC0, 0x66, 0x29, 0x53, 0x5B, 0x81, 0xBA, 0x5B, 0x53, 0x91, 0xC4,
+0x4E, 0x63, 0x28, 0x3A, 0xC2, 0x08, 0x89, 0x4A, 0xAF, 0x83, 0x96, 0xA5, 0x9A, 0xBE, 0x01, 0xC1,
+0x0C, 0x63, 0x43, 0x19, 0x91, 0xA2, 0xC2, 0x89, 0x42, 0x58, 0xCE, 0xFB, 0xE6, 0xBF, 0xC3, 0x53,
+0x9D, 0x85, 0x1A, 0x63, 0x11, 0x48, 0x42, 0xA3, 0x7F, 0x67, 0xA9, 0xC0, 0xE6, 0x29, 0x41, 0x00,
+0xC0, 0xC5, 0x19, 0xA9, 0xA6, 0x9A, 0xAE, 0xC1, 0xC6, 0x3A, 0xA8, 0x73, 0xBD, 0x86, 0xC3, 0xC6,
+0x43, 0xE6, 0x2B, 0x26, 0x24, 0x95, 0x9E, 0x71, 0x91, 0xC0, 0xB6, 0xB5, 0x71, 0xC0, 0x9E, 0xF7,
+0x51, 0xC2, 0x14, 0xA5, 0xAF, 0x7B, 0x96, 0xB5, 0x71, 0x02, 0xC0, 0x9A, 0xD6, 0x71, 0x11, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xBD, 0xDE, 0x3A, 0xB5, 0xAE, 0x2A, 0x45, 0xC0, 0x7C, 0xD6,
+0x71, 0x01, 0xA6, 0x01, 0x71, 0xC4, 0x14, 0x96, 0xE6, 0x23, 0x4B, 0x44, 0x93, 0x94, 0xD1, 0x73,
+0x01, 0xA1, 0xA9, 0xC0, 0x47, 0x32, 0x57, 0x63, 0xBA, 0xC1, 0xE6, 0x19, 0x29, 0x33, 0x46, 0xB3,
+0xC0, 0x47, 0x2B, 0xB7, 0xC2, 0xCC, 0x4A, 0x25, 0x29, 0x8A, 0x52, 0xA5, 0x92, 0x48, 0xC0, 0x66,
+0x31, 0x5F, 0xC0, 0x28, 0x32, 0x47, 0x98, 0x42, 0xC7, 0xC8, 0x2A, 0x50, 0x7C, 0x7A, 0xD6, 0xF2,
+0xA4, 0xAB, 0x83, 0xED, 0x8B, 0xB6, 0xC5, 0x38, 0xCE, 0x47, 0xC0, 0xA8, 0x3A, 0x41, 0xC0, 0x07,
+0x2B, 0x96, 0xC1, 0x05, 0x1A, 0x86, 0x22, 0x52, 0xC3, 0x45, 0x1A, 0x90, 0x6C, 0x6B, 0x4A, 0x06,
+0x21, 0xBE, 0xAE, 0x66, 0x00, 0x9A, 0x00, 0x7A, 0x6B, 0x66, 0x01, 0x6B, 0x00, 0x66, 0x6B, 0xAB,
+0x00, 0x66, 0x6B, 0x66, 0x01, 0x6B, 0x66, 0x01, 0x6B, 0x66, 0x01, 0x72, 0x04, 0x6B, 0x5E, 0x4C,
+0xC4, 0x69, 0x33, 0x90, 0x64, 0x0D, 0x53, 0x08, 0x3A, 0x49, 0x4A, 0x5D, 0xBF, 0x01, 0x5D, 0x6C,
+0xC5, 0x93, 0x7C, 0x0C, 0x4B, 0xE2, 0x08, 0x0B, 0x53, 0x30, 0x84, 0x8E, 0x73, 0xA1, 0x00, 0x9A,
+0x47, 0xC2, 0x51, 0x8C, 0xAE, 0x6B, 0x43, 0x11, 0x01, 0xC1, 0x0B, 0x4B, 0x4C, 0x5B, 0x63, 0xC1,
+0xAA, 0x4A, 0xC5, 0x21, 0x9D, 0x57, 0xC3, 0x47, 0x32, 0x68, 0x42, 0x44, 0x19, 0x07, 0x32, 0xBF,
+0xC2, 0xE5, 0x21, 0x45, 0x22, 0xA6, 0x2A, 0xAF, 0x96, 0xA1, 0x9A, 0xC9, 0x27, 0x43, 0x4A, 0x9C,
+0xB0, 0xCD, 0x74, 0xDE, 0xAF, 0xCD, 0x29, 0x94, 0x47, 0x54, 0x47, 0x24, 0x54, 0x96, 0xFF, 0xFF,
+0x00, 0x54, 0xC1, 0xBE, 0xF7, 0x59, 0xCE, 0x50, 0xC4, 0x92, 0x94, 0xDB, 0xDE, 0x10, 0x84, 0x5D,
+0xEF, 0x38, 0xC6, 0xA1, 0xC0, 0xDF, 0xFF, 0x58, 0xC0, 0x18, 0xC6, 0x71, 0x10, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC1, 0xDB, 0xC5, 0x5A, 0xB5, 0xBE, 0x2B, 0xAF, 0x6C, 0x71, 0x00, 0x6C, 0x01,
+0x71, 0xC3, 0xD3, 0x8D, 0x27, 0x24, 0xC7, 0x2B, 0x47, 0x32, 0x92, 0x00, 0xAE, 0x00, 0xA5, 0xC0,
+0xA4, 0x19, 0x96, 0x66, 0xC3, 0x06, 0x22, 0xE8, 0x2A, 0x68, 0x2B, 0x04, 0x1A, 0xA7, 0xC4, 0x46,
+0x23, 0x28, 0x2B, 0xCB, 0x4A, 0x46, 0x29, 0x08, 0x42, 0xBE, 0xAB, 0xC1, 0x6A, 0x52, 0xC7, 0x39,
+0x91, 0x53, 0xC0, 0x08, 0x33, 0x9C, 0xCC, 0xA5, 0x22, 0x6B, 0x4B, 0x8D, 0x5B, 0xD2, 0x94, 0x8D,
+0x6B, 0xEE, 0x7B, 0x6B, 0x6B, 0x90, 0x94, 0x70, 0x7C, 0xC9, 0x32, 0xC5, 0x21, 0x45, 0x1A, 0x06,
+0x23, 0x00, 0xA7, 0xC5, 0x67, 0x2B, 0xE3, 0x11, 0x64, 0x1A, 0x90, 0x64, 0x0E, 0x63, 0xC8, 0x39,
+0xAF, 0xA6, 0x00, 0x5F, 0xAE, 0x53, 0x96, 0x5F, 0x00, 0xBA, 0x5A, 0x00, 0x5F, 0x00, 0x53, 0x5A,
+0x00, 0x5F, 0x00, 0x5A, 0x00, 0x5F, 0xC0, 0x88, 0x31, 0x00, 0x5F, 0x00, 0x5A, 0x02, 0x5F, 0x5A,
+0xAF, 0x5F, 0xBB, 0x62, 0x5F, 0x00, 0xC1, 0xED, 0x5A, 0xE6, 0x21, 0x7F, 0xC2, 0x49, 0x32, 0x8C,
+0x5B, 0x0B, 0x5B, 0x89, 0xB2, 0xC0, 0x4B, 0x53, 0x66, 0xC2, 0xEA, 0x42, 0x4C, 0x5B, 0xAB, 0x3A,
+0x55, 0xC4, 0x63, 0x09, 0xEE, 0x63, 0xBA, 0xC6, 0x53, 0x95, 0x8D, 0x63, 0xBB, 0x00, 0xC1, 0x0C,
+0x63, 0xAF, 0x73, 0x8A, 0xC0, 0x43, 0x11, 0xAE, 0xAF, 0xC0, 0x06, 0x22, 0x95, 0x91, 0xBF, 0x63,
+0x5E, 0x00, 0xA9, 0x52, 0xAB, 0x52, 0x59, 0x5E, 0x00, 0x63, 0xCC, 0xE4, 0x19, 0x45, 0x1A, 0xE6,
+0x22, 0x29, 0x34, 0x6A, 0x74, 0x11, 0xD6, 0xFC, 0xFF, 0xFE, 0xFF, 0x9A, 0xFF, 0x4D, 0xC5, 0xA9,
+0x8C, 0x67, 0x34, 0x8F, 0x6D, 0x6A, 0x71, 0xC1, 0x55, 0xAD, 0x99, 0xD6, 0x64, 0xC2, 0x9A, 0xD6,
+0x51, 0x8C, 0x14, 0xA5, 0x54, 0xC5, 0x7D, 0xEF, 0xF7, 0xBD, 0x71, 0x8C, 0x18, 0xC6, 0xCF, 0x7B,
+0xD7, 0xBD, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xBB, 0xBD, 0x4A, 0xBE, 0x02,
+0xAB, 0x52, 0x27, 0xC0, 0xBF, 0xF7, 0x71, 0x01, 0xA6, 0x00, 0x71, 0xC0, 0x12, 0x86, 0x67, 0xC2,
+0xC7, 0x2B, 0xE4, 0x11, 0x06, 0x1A, 0xA1, 0x57, 0xAB, 0x00, 0xBE, 0x01, 0xC2, 0x26, 0x1A, 0x27,
+0x2B, 0xC6, 0x22, 0xA3, 0x72, 0xC4, 0x04, 0x1A, 0x8A, 0x3B, 0x8E, 0x5B, 0x25, 0x29, 0x49, 0x4A,
+0x00, 0xC1, 0xAA, 0x5A, 0x08, 0x42, 0xBF, 0xC1, 0xC7, 0x39, 0xCB, 0x52, 0x42, 0xC1, 0x44, 0x1A,
+0xA4, 0x11, 0x72, 0x77, 0xAE, 0x91, 0xC1, 0x48, 0x2A, 0xE6, 0x21, 0x72, 0xC2, 0xC7, 0x2A, 0x87,
+0x2B, 0xE4, 0x19, 0x46, 0xC0, 0x06, 0x23, 0x69, 0x4C, 0xC1, 0x69, 0x33, 0x09, 0x33, 0x88, 0xC3,
+0xEB, 0x43, 0xF4, 0x84, 0x93, 0x84, 0xD3, 0x84, 0x81, 0xBB, 0xA5, 0xAB, 0xC0, 0xCF, 0x5B, 0x91,
+0xC0, 0x92, 0x7C, 0x61, 0xA6, 0x5A, 0x95, 0x5A, 0x66, 0x95, 0x00, 0x7F, 0xC1, 0x52, 0x74, 0xB3,
+0x7C, 0x00, 0xBA, 0x00, 0xC0, 0x6D, 0x4B, 0xA6, 0x6B, 0x6E, 0x66, 0xC2, 0xD3, 0x7C, 0x31, 0x6C,
+0x53, 0x84, 0x5A, 0xC0, 0xF3, 0x7C, 0x00, 0xA1, 0x66, 0xC1, 0xF6, 0x8C, 0x94, 0x84, 0x00, 0xC1,
+0xB0, 0x63, 0x44, 0x11, 0x4D, 0xAE, 0xC0, 0xC5, 0x21, 0x00, 0x72, 0xC2, 0x06, 0x22, 0x67, 0x22,
+0xE5, 0x21, 0x77, 0x00, 0x63, 0xA5, 0xC2, 0xC4, 0x19, 0x28, 0x2B, 0xEC, 0x4C, 0x00, 0xC1, 0xE8,
+0x2A, 0xC5, 0x19, 0x46, 0x75, 0x96, 0x00, 0xA9, 0x63, 0x5E, 0x00, 0x63, 0x77, 0x63, 0x66, 0x00,
+0x5E, 0x05, 0x66, 0x00, 0x63, 0x01, 0xC2, 0x85, 0x22, 0x29, 0x84, 0xF7, 0xE6, 0x6A, 0x00, 0xA5,
+0xC4, 0x52, 0xDE, 0x4C, 0xAD, 0x67, 0x3C, 0x0B, 0x4D, 0xBD, 0xEF, 0x71, 0xCA, 0x9A, 0xD6, 0x14,
+0xA5, 0xB3, 0x9C, 0xBE, 0xF7, 0x10, 0x84, 0xD3, 0x9C, 0x30, 0x8C, 0x7D, 0xEF, 0xD7, 0xBD, 0xAF,
+0x7B, 0x75, 0xAD, 0x91, 0x71, 0x11, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xBB, 0xC5, 0x4A,
+0xBE, 0x02, 0x91, 0x4A, 0xBF, 0x52, 0x25, 0xC0, 0xBF, 0xF7, 0x71, 0x04, 0xC7, 0x13, 0x8E, 0x67,
+0x2C, 0xA6, 0x23, 0xAC, 0x4B, 0xD8, 0x9D, 0x35, 0x8D, 0xE6, 0x19, 0x84, 0x11, 0xBE, 0x63, 0x6B,
+0x9A, 0x6B, 0xC8, 0x45, 0x1A, 0xCC, 0x4B, 0x59, 0xAE, 0xB3, 0x74, 0x23, 0x11, 0x07, 0x2A, 0x2D,
+0x53, 0xA7, 0x39, 0x08, 0x42, 0x47, 0x00, 0x81, 0x47, 0x91, 0xC3, 0x2D, 0x63, 0x69, 0x3A, 0x22,
+0x11, 0x64, 0x11, 0x66, 0xC5, 0x48, 0x2B, 0x48, 0x2C, 0xCD, 0x4C, 0x79, 0xAE, 0xD6, 0x8D, 0x2A,
+0x34, 0x98, 0xC1, 0x67, 0x2B, 0x86, 0x22, 0x95, 0xC0, 0x06, 0x23, 0xA6, 0xA7, 0xC8, 0x34, 0x7D,
+0xBB, 0xBE, 0x6E, 0x5C, 0x64, 0x1A, 0xE7, 0x22, 0xE5, 0x19, 0x66, 0x22, 0x08, 0x2B, 0x26, 0x22,
+0x59, 0xC3, 0xA5, 0x11, 0x91, 0x64, 0x2A, 0x3B, 0x04, 0x12, 0xB3, 0x59, 0xC0, 0x65, 0x1A, 0x5A,
+0x92, 0x4B, 0xC2, 0x0D, 0x4C, 0x35, 0x85, 0x71, 0x64, 0x6B, 0xA5, 0x00, 0x5A, 0x91, 0x00, 0x4B,
+0xC2, 0xEE, 0x4B, 0xB8, 0x95, 0x51, 0x64, 0x4D, 0x66, 0x93, 0x59, 0x6B, 0xC0, 0x08, 0x2C, 0x91,
+0xC4, 0x6E, 0x4C, 0x56, 0x8D, 0x98, 0x95, 0x6A, 0x32, 0x43, 0x09, 0x5E, 0xC0, 0xE4, 0x19, 0x66,
+0x59, 0x57, 0xC1, 0x88, 0x2A, 0xD7, 0x95, 0xBA, 0xC0, 0x89, 0x32, 0x57, 0x63, 0x00, 0xC2, 0x45,
+0x22, 0xC8, 0x2B, 0xC9, 0x34, 0x9A, 0xC2, 0xD2, 0x6D, 0xF7, 0x9D, 0xCA, 0x3A, 0x57, 0x63, 0x00,
+0xAE, 0x66, 0xC5, 0xE5, 0x19, 0xD3, 0x7C, 0xEA, 0x42, 0xCE, 0x53, 0x19, 0xAE, 0x8D, 0x53, 0x57,
+0x66, 0xA6, 0x00, 0x59, 0xC5, 0x8D, 0x4B, 0x30, 0x64, 0xA9, 0x32, 0xF4, 0x84, 0x07, 0x22, 0x84,
+0x11, 0x63, 0x01, 0x68, 0xC2, 0x68, 0x6B, 0xD1, 0xD5, 0xDD, 0xFF, 0xAF, 0xC6, 0x9B, 0xF7, 0xD0,
+0xDD, 0x6C, 0xAD, 0x47, 0x34, 0xEA, 0x3C, 0x9D, 0xE7, 0xFF, 0xFF, 0x91, 0xC1, 0x8E, 0x73, 0x92,
+0x94, 0x71, 0x68, 0x71, 0xC0, 0xF4, 0xA4, 0xAE, 0xBE, 0xC1, 0xF7, 0xBD, 0x35, 0xAD, 0x80, 0xC0,
+0xDF, 0xFF, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xBB, 0xC5, 0x5A, 0xB5, 0x52,
+0x00, 0xAF, 0xC1, 0x96, 0x9C, 0xCD, 0x62, 0xAF, 0xC1, 0x19, 0xAD, 0x7B, 0xBD, 0x00, 0x5E, 0x00,
+0x52, 0x01, 0x5E, 0x00, 0x52, 0x1C, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC7, 0x33, 0x8E, 0x67, 0x24,
+0x08, 0x34, 0xB7, 0x95, 0x2D, 0x4B, 0xD0, 0x5B, 0x69, 0x2A, 0x84, 0x11, 0x77, 0xBA, 0xBA, 0x00,
+0x72, 0x5E, 0x7F, 0xC1, 0xD0, 0x63, 0x36, 0x8D, 0x75, 0xC4, 0x10, 0x64, 0xF0, 0x73, 0x86, 0x31,
+0xC7, 0x39, 0x46, 0x29, 0xAE, 0xBA, 0x00, 0x78, 0xC2, 0x4E, 0x63, 0x69, 0x3A, 0x22, 0x09, 0x61,
+0xC7, 0x48, 0x2B, 0xCA, 0x3C, 0x07, 0x2C, 0x8F, 0x5C, 0x91, 0x64, 0x17, 0x96, 0x8D, 0x4C, 0xA7,
+0x23, 0xBA, 0xC0, 0x85, 0x1A, 0xA6, 0xC0, 0x07, 0x23, 0x00, 0xC4, 0xE4, 0x11, 0xA9, 0x32, 0x7B,
+0xB6, 0xCC, 0x43, 0xE3, 0x11, 0x46, 0x69, 0xC0, 0xC3, 0x11, 0x66, 0x63, 0x91, 0xC3, 0xEA, 0x3A,
+0x1D, 0xD7, 0x89, 0x3A, 0x04, 0x1A, 0xA6, 0x57, 0xC0, 0xC4, 0x19, 0x70, 0xC0, 0x24, 0x1A, 0x4B,
+0xC3, 0xD3, 0x74, 0x19, 0xA6, 0x4C, 0x43, 0x24, 0x12, 0x75, 0x00, 0x46, 0x70, 0x46, 0xC0, 0xC6,
+0x22, 0x6D, 0xC2, 0x73, 0x74, 0x0C, 0x43, 0x63, 0x11, 0x00, 0xAB, 0x52, 0x57, 0x69, 0xC0, 0x68,
+0x2C, 0xBF, 0xC2, 0x4B, 0x44, 0xB7, 0x9D, 0x08, 0x2A, 0x52, 0xC3, 0xA6, 0x22, 0x47, 0x2B, 0x25,
+0x1A, 0x84, 0x11, 0x52, 0xC3, 0x8D, 0x4B, 0x39, 0xA6, 0x15, 0x7D, 0x6D, 0x4B, 0x52, 0x70, 0xC0,
+0x06, 0x23, 0x45, 0xC0, 0x0A, 0x35, 0xA1, 0xC2, 0x6B, 0x44, 0xF8, 0xA5, 0xF1, 0x63, 0x7F, 0x5E,
+0x6B, 0x41, 0x00, 0x70, 0xC6, 0xE9, 0x32, 0xDB, 0xC6, 0x30, 0x6C, 0x96, 0x95, 0xF1, 0x6B, 0x97,
+0x9D, 0xE6, 0x21, 0x5E, 0xBA, 0x00, 0x59, 0xC4, 0x35, 0x8D, 0x18, 0xB6, 0xF0, 0x5B, 0xFC, 0xCE,
+0x48, 0x32, 0x52, 0xC0, 0xA4, 0x19, 0xBF, 0xC0, 0xC5, 0x31, 0x89, 0xCA, 0xA6, 0x3A, 0x0A, 0x94,
+0x91, 0xD5, 0x76, 0xE6, 0x90, 0xD5, 0xAB, 0xB4, 0xA8, 0x6C, 0x26, 0x24, 0x2B, 0x45, 0xBD, 0xE7,
+0xFF, 0xFF, 0x00, 0xC1, 0xCF, 0x7B, 0x55, 0xAD, 0x71, 0x6C, 0xA5, 0xC2, 0x10, 0x84, 0xDB, 0xDE,
+0x30, 0x8C, 0x60, 0xC2, 0x96, 0xB5, 0x34, 0xAD, 0xD3, 0x9C, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC0, 0xBB, 0xC5, 0x4A, 0xBE, 0x4A, 0xA5, 0x4A, 0xC3, 0x9B, 0xBD, 0x91, 0x7B, 0x34,
+0x8C, 0xBC, 0xC5, 0x7E, 0xC2, 0x34, 0x94, 0xF8, 0xAC, 0x7B, 0xBD, 0x52, 0x4A, 0xC1, 0xB6, 0x9C,
+0xF8, 0xA4, 0x5E, 0x52, 0x1B, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC1, 0x33, 0x8E, 0x67, 0x24, 0x54,
+0xC3, 0xB7, 0x9D, 0x28, 0x22, 0xAA, 0x32, 0x06, 0x22, 0x91, 0xC1, 0xC6, 0x39, 0x85, 0x49, 0x01,
+0xC5, 0xE6, 0x39, 0xE6, 0x19, 0x76, 0x95, 0x28, 0x2A, 0xB3, 0x7C, 0x4D, 0x4B, 0xBF, 0xA5, 0xC4,
+0xEB, 0x52, 0x6C, 0x63, 0x24, 0x19, 0x6D, 0x6B, 0x07, 0x3A, 0x92, 0xC2, 0x8E, 0x73, 0x08, 0x32,
+0x85, 0x19, 0x90, 0xC9, 0x08, 0x2B, 0xCA, 0x34, 0xC7, 0x2B, 0xE4, 0x19, 0x84, 0x11, 0x69, 0x2A,
+0xB8, 0x9D, 0x48, 0x2A, 0xC3, 0x11, 0x04, 0x1A, 0x70, 0xC1, 0x07, 0x2B, 0x47, 0x2B, 0x69, 0x00,
+0xC3, 0x87, 0x22, 0xB7, 0x9D, 0x12, 0x6D, 0x64, 0x1A, 0x63, 0x69, 0x70, 0xC0, 0x83, 0x11, 0x5E,
+0x63, 0xC3, 0x55, 0x85, 0xBC, 0xBE, 0xCB, 0x3A, 0xC6, 0x22, 0x70, 0x5E, 0x01, 0xC0, 0x25, 0x1A,
+0x4B, 0xC4, 0x2C, 0x4B, 0xD4, 0x84, 0x97, 0x95, 0x68, 0x2A, 0x63, 0x11, 0x5E, 0x63, 0xBA, 0x70,
+0xC1, 0xC7, 0x22, 0x18, 0x9E, 0xB3, 0xC0, 0x72, 0x74, 0x5E, 0xA6, 0x00, 0x5E, 0x00, 0xA9, 0x64,
+0xC3, 0x48, 0x2C, 0x6F, 0x5D, 0xF6, 0x8D, 0x66, 0x1A, 0x5E, 0x4B, 0xC0, 0x07, 0x2B, 0x41, 0x5E,
+0xA5, 0xC6, 0xCA, 0x32, 0x7B, 0xB6, 0xF9, 0x9D, 0x0B, 0x43, 0x24, 0x1A, 0xE8, 0x2B, 0xC9, 0x34,
+0xAE, 0xC0, 0x69, 0x34, 0x69, 0xC5, 0x47, 0x2A, 0x36, 0x8D, 0x92, 0x74, 0x56, 0x95, 0xA5, 0x11,
+0x45, 0x1A, 0x78, 0x96, 0x5F, 0xC4, 0x47, 0x23, 0x74, 0x8D, 0xB3, 0x7C, 0x76, 0x9D, 0x07, 0x22,
+0x76, 0xC0, 0x68, 0x32, 0x5E, 0x66, 0xA6, 0x52, 0xC4, 0x0C, 0x43, 0x57, 0x95, 0x08, 0x22, 0x98,
+0x9D, 0x49, 0x32, 0x57, 0xC1, 0xC5, 0x31, 0x85, 0x49, 0x00, 0xA5, 0xC3, 0xE4, 0x31, 0xE6, 0x42,
+0x88, 0x7B, 0xA9, 0x8B, 0x89, 0xC5, 0xC6, 0x53, 0xE6, 0x2B, 0x46, 0x2C, 0x2B, 0x45, 0xBC, 0xE7,
+0xFF, 0xFF, 0x00, 0x91, 0xBF, 0x71, 0xC1, 0x7D, 0xEF, 0xDB, 0xDE, 0x5D, 0x71, 0xC0, 0xFB, 0xDE,
+0xBF, 0x6C, 0x00, 0x70, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC4, 0xBB, 0xC5, 0x5A,
+0xB5, 0x9B, 0xBD, 0xB7, 0xA4, 0x2F, 0x6B, 0x5E, 0xA6, 0xC1, 0x0E, 0x6B, 0xF8, 0xAC, 0xAE, 0xC0,
+0x8C, 0x5A, 0x4D, 0x41, 0x6F, 0xC2, 0xBC, 0xC5, 0x14, 0x8C, 0x4B, 0x52, 0x59, 0xC0, 0xF3, 0x83,
+0x6D, 0x91, 0x5E, 0xA5, 0x5E, 0x6D, 0x50, 0x4C, 0x5E, 0x52, 0x12, 0xC0, 0xBF, 0xFF, 0x71, 0x04,
+0xC2, 0x33, 0x8E, 0x87, 0x24, 0x09, 0x34, 0x5A, 0xC7, 0xEC, 0x3A, 0x39, 0xAE, 0x8D, 0x4B, 0xA4,
+0x29, 0xC6, 0x51, 0xAA, 0x8B, 0xEA, 0x93, 0x67, 0x6A, 0x7A, 0xC0, 0xC5, 0x29, 0x5A, 0xC5, 0xCA,
+0x3A, 0x15, 0x8D, 0x2D, 0x4B, 0x64, 0x09, 0xE6, 0x19, 0x8A, 0x3B, 0x90, 0xC2, 0xC4, 0x19, 0x67,
+0x2A, 0x05, 0x22, 0xA6, 0xC1, 0x46, 0x2A, 0xE4, 0x19, 0xAF, 0xC2, 0x08, 0x2B, 0xA9, 0x3C, 0xC7,
+0x2B, 0x70, 0x92, 0x00, 0xC2, 0x14, 0x85, 0xCF, 0x5B, 0x84, 0x11, 0x6B, 0xA6, 0xC1, 0x25, 0x1A,
+0xC9, 0x33, 0xA9, 0xC5, 0x85, 0x1A, 0x2A, 0x3C, 0xA9, 0x2B, 0xEE, 0x53, 0x17, 0x96, 0x67, 0x23,
+0x41, 0xC1, 0xE6, 0x22, 0x04, 0x1A, 0x63, 0xA5, 0xC5, 0x27, 0x22, 0xD8, 0x9D, 0x1D, 0xD7, 0x76,
+0x8D, 0x07, 0x23, 0xA3, 0x11, 0x63, 0x66, 0x63, 0x70, 0xC5, 0xC6, 0x22, 0x47, 0x22, 0x43, 0x09,
+0x56, 0x8D, 0x2C, 0x4B, 0x63, 0x11, 0x5E, 0x66, 0x00, 0x95, 0x7E, 0xC4, 0x97, 0x9D, 0xEC, 0x42,
+0x97, 0x95, 0x07, 0x2A, 0x64, 0x11, 0x5E, 0x02, 0x57, 0x46, 0xC3, 0xD5, 0x85, 0x92, 0x6D, 0x68,
+0x2C, 0x67, 0x2B, 0x91, 0xAF, 0xA9, 0xA7, 0x95, 0xC5, 0x11, 0x6D, 0x74, 0x85, 0x11, 0x65, 0xB5,
+0x8D, 0x48, 0x2C, 0xE9, 0x34, 0xA2, 0xC2, 0xA7, 0x2B, 0x25, 0x1A, 0xA4, 0x11, 0x5E, 0xC1, 0x8E,
+0x53, 0x3A, 0xAE, 0x62, 0x5E, 0x46, 0xC1, 0x47, 0x2B, 0xE7, 0x22, 0xA1, 0x7A, 0xC5, 0x94, 0x8D,
+0xB3, 0x84, 0x56, 0x8D, 0x68, 0x2A, 0xB7, 0x9D, 0x48, 0x32, 0x5E, 0xBE, 0xA6, 0x52, 0xCD, 0xEB,
+0x42, 0x97, 0x9D, 0x28, 0x22, 0xD8, 0x9D, 0x89, 0x3A, 0xA4, 0x21, 0xA5, 0x49, 0x08, 0x83, 0xA9,
+0x93, 0xE7, 0x7A, 0x84, 0x49, 0xC4, 0x29, 0x44, 0x1A, 0x84, 0x22, 0x96, 0xC2, 0xA4, 0x1A, 0xC6,
+0x2B, 0x47, 0x2C, 0x72, 0xC1, 0xBC, 0xE7, 0xFF, 0xFF, 0x1E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0xCB, 0xBB, 0xC5, 0x5A, 0xB5, 0x9B, 0xBD, 0xB7, 0xA4, 0x0E, 0x6B, 0xBC, 0xC5, 0xB1, 0x7B, 0x34,
+0x8C, 0xFD, 0xCD, 0x4F, 0x73, 0xF3, 0x83, 0xDC, 0xC5, 0x4A, 0x00, 0x66, 0x50, 0xBA, 0xC5, 0x39,
+0xB5, 0xCD, 0x62, 0xD7, 0xA4, 0xCD, 0x5A, 0x50, 0x73, 0x5A, 0xBD, 0x75, 0xC2, 0x2F, 0x6B, 0x2A,
+0x4A, 0x8B, 0x52, 0x5B, 0x5E, 0xA5, 0x11, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC4, 0x33, 0x8E, 0x67,
+0x2C, 0xA7, 0x23, 0x31, 0x64, 0x78, 0x95, 0x95, 0xC9, 0x69, 0x2A, 0x64, 0x31, 0xC8, 0x6A, 0x6E,
+0xBD, 0xCD, 0xB4, 0x6B, 0xAC, 0xC5, 0x51, 0x84, 0x29, 0xCF, 0x5B, 0xF9, 0xA5, 0x91, 0xC0, 0x28,
+0x2A, 0x63, 0xC1, 0x66, 0x22, 0x48, 0x2B, 0xA5, 0xC0, 0x08, 0x2C, 0xA5, 0x67, 0x01, 0xC0, 0x48,
+0x34, 0xAE, 0xC2, 0xA8, 0x34, 0xC6, 0x2B, 0xE4, 0x19, 0xA2, 0x57, 0xC3, 0xCE, 0x5B, 0x1D, 0xCF,
+0x92, 0x6C, 0x67, 0x2A, 0x63, 0xBE, 0xC2, 0x04, 0x1A, 0x67, 0x2B, 0xA8, 0x33, 0x44, 0xC1, 0xAB,
+0x43, 0x38, 0xA6, 0x96, 0xC2, 0xF2, 0x6C, 0xC8, 0x2B, 0xC6, 0x22, 0x00, 0x75, 0x66, 0x6B, 0x63,
+0xBB, 0xC2, 0xF5, 0x84, 0x2F, 0x5C, 0x85, 0x1A, 0x63, 0x01, 0x66, 0x57, 0x64, 0xC0, 0x75, 0x85,
+0xB7, 0xC2, 0x97, 0x95, 0xE6, 0x21, 0x84, 0x11, 0x00, 0x66, 0x00, 0x5E, 0x00, 0xC1, 0x93, 0x74,
+0xD8, 0x9D, 0x46, 0x6D, 0x5E, 0x01, 0x66, 0x9A, 0x57, 0xC2, 0x06, 0x22, 0x76, 0x8D, 0x0A, 0x3C,
+0x54, 0x00, 0xA6, 0x01, 0x54, 0x4F, 0xC1, 0x90, 0x5D, 0x78, 0x9E, 0x99, 0xC0, 0xF4, 0x85, 0x4F,
+0xC1, 0x28, 0x2C, 0xC6, 0x22, 0x6B, 0x63, 0x00, 0xC3, 0xE5, 0x19, 0xD3, 0x74, 0xD9, 0x9D, 0xF1,
+0x63, 0x57, 0x6B, 0xC0, 0x24, 0x1A, 0xAB, 0x75, 0x9A, 0xC3, 0x13, 0x85, 0x10, 0x6C, 0xF4, 0x7C,
+0xB8, 0x95, 0x62, 0xC0, 0xA5, 0x19, 0x5E, 0x66, 0x61, 0x95, 0xC2, 0x0B, 0x3B, 0x97, 0x9D, 0x07,
+0x22, 0x42, 0x78, 0xC2, 0x84, 0x29, 0x27, 0x5A, 0x4B, 0xAC, 0x99, 0xC1, 0x2D, 0xB5, 0x06, 0x5A,
+0x65, 0x63, 0xA9, 0x00, 0x7A, 0xC3, 0xC6, 0x2B, 0x47, 0x2C, 0x2C, 0x55, 0xBD, 0xEF, 0x71, 0x1E,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xBB, 0xC5, 0x4A, 0xC8, 0x9B, 0xBD, 0xB7, 0xA4, 0x50,
+0x73, 0x75, 0x94, 0x09, 0x42, 0xF3, 0x83, 0x19, 0xAD, 0x0E, 0x6B, 0xD7, 0xA4, 0x5E, 0xA5, 0x00,
+0xBF, 0xC3, 0x13, 0x8C, 0xCD, 0x62, 0x2F, 0x6B, 0x91, 0x7B, 0x4D, 0xC0, 0x76, 0x9C, 0x5C, 0xC2,
+0x34, 0x8C, 0x8C, 0x52, 0xB6, 0xA4, 0x70, 0x58, 0x52, 0x13, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC4,
+0x54, 0x96, 0x67, 0x2C, 0xC7, 0x2B, 0x66, 0x1A, 0xEF, 0x5B, 0x5A, 0xC6, 0xC4, 0x11, 0xA4, 0x29,
+0xE6, 0x59, 0x2B, 0xA4, 0x8C, 0xAC, 0x69, 0x8B, 0x85, 0x51, 0x6C, 0xC2, 0xC5, 0x11, 0x8E, 0x53,
+0xCA, 0x32, 0x63, 0x6B, 0xAE, 0xC0, 0xC5, 0x22, 0xAF, 0xA6, 0x95, 0xAE, 0x01, 0xBE, 0x00, 0x5D,
+0x70, 0x63, 0x01, 0xC1, 0xA9, 0x32, 0x51, 0x6C, 0x00, 0xC0, 0x68, 0x2A, 0x63, 0x6B, 0x00, 0x75,
+0xC0, 0x44, 0x1A, 0x70, 0x72, 0xC2, 0x8C, 0x4B, 0xAE, 0x53, 0x46, 0x1A, 0x55, 0xB6, 0xC0, 0x06,
+0x23, 0x6B, 0x63, 0x01, 0x57, 0xC1, 0xC9, 0x32, 0x2A, 0x34, 0x55, 0x6B, 0x63, 0x01, 0xA6, 0xC3,
+0x85, 0x1A, 0x4C, 0x44, 0x30, 0x64, 0x69, 0x2A, 0x57, 0x5E, 0xBE, 0x63, 0x66, 0x63, 0x5E, 0xC0,
+0xE6, 0x19, 0x51, 0xC0, 0x28, 0x2A, 0x5E, 0x63, 0x66, 0x63, 0x00, 0x5E, 0x63, 0xBF, 0xC3, 0x89,
+0x2A, 0xE4, 0x11, 0x46, 0x23, 0xE7, 0x2B, 0xA6, 0x03, 0x96, 0xC2, 0x6E, 0x54, 0xD2, 0x74, 0xE9,
+0x33, 0x78, 0x75, 0x63, 0x6B, 0xA6, 0x63, 0x5E, 0xC3, 0xCA, 0x3A, 0x31, 0x6C, 0x07, 0x22, 0xA3,
+0x11, 0x66, 0x70, 0x6B, 0x00, 0x63, 0xC2, 0x88, 0x2A, 0x27, 0x22, 0x68, 0x2A, 0x48, 0xC0, 0x69,
+0x2A, 0x5E, 0xBE, 0x01, 0x63, 0xC1, 0x06, 0x22, 0xAA, 0x3A, 0x68, 0xC5, 0xCA, 0x32, 0xE5, 0x19,
+0xC4, 0x29, 0xA5, 0x51, 0x69, 0x8B, 0x0A, 0x9C, 0xAF, 0xC2, 0xA5, 0x59, 0xA4, 0x31, 0xE4, 0x11,
+0xAE, 0x00, 0xC4, 0x44, 0x1A, 0xC6, 0x2B, 0x67, 0x2C, 0x6D, 0x5D, 0xDE, 0xF7, 0xBF, 0x1E, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xBB, 0xC5, 0x4A, 0xC4, 0x9B, 0xBD, 0xB7, 0xA4, 0x2F, 0x6B,
+0x18, 0xAD, 0xF3, 0x8B, 0x00, 0xC0, 0x39, 0xB5, 0x41, 0xC0, 0xB6, 0x9C, 0x5E, 0x00, 0xA5, 0x61,
+0x58, 0xC1, 0x8C, 0x5A, 0x34, 0x8C, 0x7E, 0xC0, 0xEE, 0x62, 0x5E, 0xC1, 0x54, 0x94, 0x90, 0x7B,
+0x92, 0x5E, 0xC1, 0xB1, 0x7B, 0x75, 0x9C, 0x5E, 0x52, 0x12, 0x67, 0x71, 0x04, 0x7C, 0xC0, 0x47,
+0x24, 0xB2, 0xC1, 0xA7, 0x3B, 0x46, 0x5B, 0xA2, 0xC5, 0x85, 0x3A, 0x04, 0x22, 0x84, 0x41, 0xE5,
+0x59, 0x47, 0x6A, 0x85, 0x49, 0x8E, 0xC1, 0x86, 0x2A, 0x07, 0x4B, 0xB5, 0x81, 0xC0, 0x45, 0x22,
+0x6D, 0xBA, 0x00, 0xA6, 0x95, 0xC1, 0x04, 0x1A, 0xC7, 0x42, 0xBE, 0x95, 0xC0, 0x25, 0x2A, 0x68,
+0x63, 0x6B, 0xA6, 0x63, 0xC2, 0xE5, 0x19, 0xC6, 0x3A, 0x26, 0x5B, 0x7B, 0xC1, 0x65, 0x32, 0xE4,
+0x19, 0x6B, 0x01, 0x68, 0xAE, 0xC1, 0xC6, 0x32, 0x26, 0x53, 0x91, 0x97, 0xC1, 0x07, 0x2B, 0xA8,
+0x2B, 0x4B, 0x66, 0x63, 0x00, 0xC5, 0x65, 0x22, 0x06, 0x53, 0x68, 0x63, 0x09, 0x5C, 0x06, 0x3B,
+0xE4, 0x19, 0x6B, 0x68, 0xA6, 0xA5, 0xC3, 0xE6, 0x22, 0x29, 0x4C, 0x06, 0x53, 0x85, 0x42, 0x47,
+0x68, 0x63, 0x66, 0x00, 0x63, 0x6D, 0xC0, 0x85, 0x32, 0x5F, 0x00, 0xC0, 0x25, 0x32, 0x70, 0x63,
+0x66, 0x63, 0xA6, 0x63, 0xC1, 0x65, 0x2A, 0xA6, 0x42, 0xB6, 0x81, 0x75, 0x6D, 0xB6, 0x00, 0x66,
+0x9D, 0x49, 0xC0, 0x85, 0x3A, 0xB6, 0x9A, 0xC0, 0x04, 0x22, 0x68, 0x6B, 0x63, 0x66, 0x63, 0xC0,
+0xE5, 0x19, 0x5C, 0xC0, 0xA5, 0x4A, 0x00, 0xC0, 0x64, 0x2A, 0x6D, 0x68, 0x6B, 0x66, 0x63, 0x61,
+0x54, 0x67, 0xA1, 0xC0, 0x44, 0x32, 0x70, 0x68, 0x66, 0x01, 0x63, 0xC1, 0x24, 0x22, 0xC6, 0x4A,
+0xA6, 0x5C, 0xC4, 0x25, 0x22, 0x85, 0x39, 0xC5, 0x51, 0x06, 0x62, 0x85, 0x51, 0x89, 0xC1, 0x85,
+0x2A, 0x06, 0x43, 0x45, 0x9E, 0xC4, 0x66, 0x33, 0xE6, 0x2B, 0x26, 0x24, 0xD0, 0x75, 0xFF, 0xFF,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC4, 0xBB, 0xC5, 0x5A, 0xB5, 0x9B, 0xBD, 0xB6, 0xA4,
+0xEE, 0x62, 0x66, 0xAB, 0x66, 0x6D, 0xC0, 0xF2, 0x83, 0x41, 0x7E, 0xC0, 0x75, 0x94, 0x76, 0x6D,
+0x49, 0xA2, 0xC0, 0xDD, 0xCD, 0x5E, 0x41, 0xC5, 0x96, 0x9C, 0x50, 0x73, 0x13, 0x8C, 0x2F, 0x6B,
+0x7A, 0xBD, 0xB1, 0x7B, 0xBF, 0x52, 0x13, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC9, 0x95, 0xA6, 0x46,
+0x24, 0xE9, 0x5C, 0xAA, 0xA4, 0x0D, 0xBD, 0x52, 0xD6, 0x4E, 0xBD, 0x27, 0x63, 0x25, 0x2A, 0xA4,
+0x31, 0xB2, 0x6F, 0xC3, 0x07, 0x3B, 0x6B, 0x8C, 0xAC, 0xB4, 0x11, 0xD6, 0x91, 0xC2, 0xC9, 0x7B,
+0x45, 0x2A, 0xE4, 0x19, 0x6B, 0x96, 0xC7, 0x45, 0x22, 0x4B, 0x7C, 0x8B, 0xA4, 0xD0, 0xC5, 0x31,
+0xCE, 0x2A, 0x94, 0xA5, 0x3A, 0xE4, 0x11, 0x6B, 0x63, 0xC1, 0x05, 0x1A, 0x09, 0x6C, 0x7D, 0xC4,
+0x8F, 0xC5, 0x52, 0xD6, 0xEC, 0xAC, 0xE6, 0x4A, 0x04, 0x1A, 0x92, 0x6B, 0x6D, 0xC6, 0x68, 0x4B,
+0x6A, 0x94, 0xED, 0xAC, 0x12, 0xCE, 0x2E, 0xB5, 0xE9, 0x73, 0x67, 0x33, 0x68, 0xBA, 0x63, 0x6A,
+0xC4, 0x2A, 0x84, 0x8C, 0xA4, 0xD1, 0xC5, 0x4F, 0xBD, 0x88, 0x7B, 0x51, 0x68, 0x6B, 0x63, 0x49,
+0xC2, 0xE9, 0x73, 0x0B, 0x94, 0x90, 0xBD, 0x65, 0xC0, 0xEA, 0x8B, 0x61, 0x6D, 0xA2, 0xA6, 0x68,
+0xC4, 0x67, 0x53, 0x2A, 0x94, 0x2F, 0xB5, 0xF1, 0xC5, 0x6B, 0x9C, 0x73, 0x70, 0x63, 0x01, 0xC6,
+0xE7, 0x42, 0xEA, 0x83, 0xEE, 0xAC, 0xB1, 0xC5, 0xCC, 0xAC, 0x06, 0x63, 0x24, 0x22, 0x6D, 0x63,
+0x00, 0xC0, 0x85, 0x2A, 0x42, 0xC1, 0x8C, 0xA4, 0x90, 0xBD, 0xA5, 0x71, 0x4C, 0x68, 0x63, 0x68,
+0xC3, 0x25, 0x1A, 0xA8, 0x63, 0x4B, 0x9C, 0x90, 0xC5, 0xAD, 0xC2, 0x09, 0x8C, 0xC5, 0x42, 0xE4,
+0x11, 0x6B, 0x00, 0x6D, 0xC1, 0x27, 0x53, 0x0A, 0x94, 0x78, 0xC3, 0xD0, 0xC5, 0x8A, 0xA4, 0xE6,
+0x52, 0x24, 0x1A, 0x6B, 0x63, 0x68, 0xC7, 0xC7, 0x3A, 0x0A, 0x8C, 0x0E, 0xB5, 0xD1, 0xCD, 0x2D,
+0xB5, 0x47, 0x73, 0x45, 0x2A, 0xA4, 0x31, 0xB6, 0x6F, 0xC9, 0x85, 0x32, 0xE8, 0x73, 0x8C, 0xAC,
+0x70, 0xBD, 0x0D, 0xB5, 0x08, 0x8C, 0x27, 0x4C, 0x26, 0x24, 0x53, 0x8E, 0xFF, 0xFF, 0x1F, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0x66, 0xC3, 0x5A, 0xB5, 0x9B, 0xBD, 0xF8, 0xAC, 0xF3, 0x83, 0x5E,
+0xA5, 0x01, 0xAB, 0xC2, 0x91, 0x7B, 0xAC, 0x5A, 0x50, 0x73, 0x4A, 0xC1, 0x9B, 0xBD, 0x76, 0x9C,
+0x95, 0x5E, 0x00, 0xC1, 0xB7, 0xA4, 0xCD, 0x5A, 0x5C, 0x4A, 0x50, 0x52, 0xC2, 0xF8, 0xA4, 0xEE,
+0x62, 0xB6, 0x9C, 0x5E, 0x52, 0x11, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC6, 0x75, 0xA6, 0xA8, 0x34,
+0x8D, 0xA5, 0x4D, 0xC5, 0x58, 0xF7, 0xFD, 0xFF, 0x9B, 0xF7, 0x40, 0xC1, 0xC6, 0x42, 0x05, 0x12,
+0x6B, 0xC4, 0x04, 0x1A, 0xCC, 0x84, 0x2C, 0xBD, 0xD4, 0xE6, 0xDB, 0xFF, 0x97, 0xC1, 0xF3, 0xCD,
+0x68, 0x6B, 0x75, 0xC0, 0xA4, 0x11, 0xAE, 0xC3, 0x0A, 0x5C, 0x2D, 0xB5, 0x73, 0xDE, 0xBB, 0xF7,
+0xBF, 0xC3, 0x75, 0xDE, 0xC9, 0x83, 0x65, 0x22, 0xA4, 0x11, 0xA9, 0xC7, 0x68, 0x43, 0x6D, 0xB5,
+0x31, 0xD6, 0x9A, 0xF7, 0xDC, 0xFF, 0x38, 0xEF, 0xCC, 0xA4, 0xC5, 0x32, 0x68, 0x00, 0xC3, 0xA6,
+0x2A, 0xEB, 0x9C, 0xAF, 0xC5, 0x79, 0xF7, 0x57, 0xC3, 0x7A, 0xF7, 0x0F, 0xB5, 0x67, 0x63, 0xE4,
+0x11, 0xA1, 0x75, 0xC2, 0x6A, 0x7C, 0x2E, 0xB5, 0x38, 0xEF, 0x57, 0xA5, 0xC1, 0x71, 0xBD, 0x48,
+0x6B, 0x75, 0xC0, 0xA4, 0x11, 0x68, 0xC0, 0xC9, 0x5B, 0x65, 0xC0, 0xD6, 0xE6, 0x57, 0xAF, 0xC3,
+0x74, 0xDE, 0xE9, 0x83, 0x64, 0x2A, 0xA4, 0x11, 0xA5, 0xC2, 0x06, 0x3B, 0x8B, 0x9C, 0x54, 0xD6,
+0x4F, 0xC4, 0xFD, 0xFF, 0xF7, 0xE6, 0x0A, 0x94, 0xA5, 0x3A, 0xC3, 0x11, 0xA3, 0xC4, 0x65, 0x22,
+0x6A, 0x8C, 0xD2, 0xCD, 0xBB, 0xF7, 0xFC, 0xFF, 0x70, 0xC1, 0x8C, 0xAC, 0x06, 0x53, 0x6D, 0xA2,
+0x75, 0xC1, 0x29, 0x74, 0x6F, 0xC5, 0x70, 0xC0, 0xDD, 0xFF, 0x50, 0x4D, 0xC0, 0x67, 0x73, 0x75,
+0x63, 0xAE, 0xC3, 0x67, 0x4B, 0xEC, 0xAC, 0xF7, 0xE6, 0xDC, 0xFF, 0x00, 0xC2, 0x11, 0xD6, 0xC8,
+0x8B, 0x84, 0x2A, 0x68, 0x63, 0xC0, 0xE6, 0x32, 0x7A, 0xC0, 0xB5, 0xDE, 0x57, 0x5C, 0xC2, 0xF4,
+0xEE, 0x4A, 0x9C, 0xC5, 0x42, 0x68, 0x63, 0xC8, 0x45, 0x22, 0x6A, 0x84, 0x53, 0xD6, 0xBC, 0xF7,
+0xFD, 0xFF, 0x57, 0xF7, 0xEC, 0xBC, 0x67, 0x63, 0x04, 0x12, 0x6B, 0x72, 0xC1, 0xC8, 0x5B, 0x8E,
+0xC5, 0x70, 0xC6, 0xFE, 0xFF, 0xBA, 0xFF, 0x2D, 0xBD, 0x69, 0x8C, 0x46, 0x2C, 0x53, 0x8E, 0xFF,
+0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xBB, 0xC5, 0x5A, 0xB5, 0xBE, 0x59, 0xAE,
+0x52, 0x03, 0x5E, 0x52, 0x5E, 0x52, 0x00, 0x5E, 0x00, 0x52, 0x00, 0x5E, 0x59, 0x5E, 0x59, 0x5E,
+0x52, 0x59, 0xBE, 0x59, 0x52, 0x12, 0x67, 0x71, 0x04, 0xC4, 0x75, 0x9E, 0x09, 0x4D, 0x4C, 0xB5,
+0x92, 0xE6, 0xDD, 0xFF, 0x96, 0xBF, 0x7C, 0xC6, 0xC8, 0x7B, 0x04, 0x1A, 0xA4, 0x11, 0xA5, 0x22,
+0xEC, 0x9C, 0x0F, 0xD6, 0xBA, 0xF7, 0x4F, 0x56, 0xC2, 0x59, 0xEF, 0xCB, 0x94, 0x84, 0x22, 0x63,
+0xC1, 0x04, 0x12, 0x8B, 0x7C, 0x46, 0xC0, 0x99, 0xFF, 0x4F, 0xA6, 0x43, 0xC1, 0x2E, 0xBD, 0xE6,
+0x42, 0x63, 0x99, 0xC1, 0x09, 0x64, 0x8D, 0xBD, 0x5D, 0x4F, 0x4A, 0xC3, 0xDC, 0xF7, 0x32, 0xCE,
+0x67, 0x5B, 0xE4, 0x11, 0x63, 0xC2, 0x47, 0x43, 0x0C, 0xAD, 0xF5, 0xEE, 0x56, 0x4A, 0xC3, 0xDD,
+0xF7, 0xB6, 0xE6, 0x09, 0x7C, 0x24, 0x1A, 0x63, 0xC2, 0x85, 0x22, 0x8A, 0x94, 0x74, 0xDE, 0x57,
+0x4F, 0x5B, 0xC2, 0x18, 0xE7, 0x6B, 0x94, 0x85, 0x2A, 0x63, 0xC3, 0x04, 0x1A, 0x09, 0x74, 0xB0,
+0xBD, 0xFC, 0xFF, 0x93, 0x00, 0xA8, 0xC2, 0x4D, 0xB5, 0x06, 0x43, 0xA3, 0x11, 0x00, 0xC1, 0x87,
+0x53, 0x2E, 0xAD, 0x4F, 0x56, 0x4F, 0x00, 0xC2, 0x90, 0xC5, 0x67, 0x63, 0xC4, 0x11, 0xA5, 0xC3,
+0x06, 0x33, 0xAB, 0x9C, 0x59, 0xEF, 0xDD, 0xF7, 0x4F, 0x5E, 0xC0, 0x12, 0xD6, 0x7B, 0xC0, 0x24,
+0x1A, 0x63, 0x53, 0xC1, 0x8A, 0x8C, 0xB5, 0xD6, 0x5E, 0x4F, 0x5E, 0xC2, 0xD5, 0xE6, 0xAA, 0x9C,
+0x85, 0x2A, 0x63, 0xC3, 0x24, 0x12, 0xE8, 0x6B, 0xF2, 0xCD, 0xFD, 0xFF, 0x92, 0x5B, 0x64, 0xC1,
+0x0C, 0xB5, 0x26, 0x4B, 0x5C, 0x00, 0xC1, 0x66, 0x4B, 0x2D, 0xAD, 0x57, 0x56, 0xBA, 0xC3, 0x9A,
+0xF7, 0x6D, 0xC5, 0xC8, 0x6B, 0xC4, 0x11, 0xA6, 0xC2, 0xE6, 0x32, 0xCB, 0x9C, 0x79, 0xEF, 0x65,
+0xA9, 0xA4, 0xC6, 0x10, 0xD6, 0x8A, 0x8C, 0x44, 0x22, 0x84, 0x11, 0x44, 0x1A, 0x49, 0x7C, 0xD5,
+0xDE, 0x71, 0x01, 0xC3, 0x72, 0xE6, 0xEB, 0xAC, 0xA7, 0x44, 0x53, 0x86, 0x71, 0x1F, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0x66, 0xC0, 0x5A, 0xB5, 0x52, 0x07, 0xAB, 0x52, 0x06, 0x59, 0x52, 0x19,
+0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC5, 0x96, 0xA6, 0xE8, 0x4C, 0x0A, 0xB5, 0xCF, 0xD5, 0x9B, 0xFF,
+0xFE, 0xFF, 0x00, 0xC2, 0x95, 0xE6, 0xC7, 0x73, 0x24, 0x1A, 0x63, 0x53, 0x6D, 0xC0, 0x2D, 0xC5,
+0x64, 0xC0, 0xDE, 0xF7, 0xB9, 0xC1, 0x37, 0xEF, 0xAB, 0x94, 0x53, 0x63, 0xC2, 0x04, 0x12, 0x2A,
+0x6C, 0x0C, 0xBD, 0x7D, 0x5B, 0xA6, 0xC2, 0xBA, 0xF7, 0x4E, 0xBD, 0xE5, 0x3A, 0x68, 0xAD, 0xC2,
+0xC8, 0x53, 0xAB, 0xAC, 0x94, 0xE6, 0x57, 0x56, 0x57, 0xC2, 0xF0, 0xCD, 0x67, 0x53, 0xE4, 0x11,
+0x63, 0xC3, 0x27, 0x3B, 0x6B, 0xA4, 0x12, 0xDE, 0xBC, 0xFF, 0x5B, 0x5E, 0xC1, 0x74, 0xDE, 0x09,
+0x7C, 0x77, 0x63, 0x53, 0xC1, 0x49, 0x84, 0xAF, 0xCD, 0x4B, 0x5B, 0x5E, 0xC2, 0x16, 0xEF, 0x8A,
+0x94, 0xA5, 0x2A, 0x63, 0x7A, 0xC2, 0xC8, 0x63, 0xAC, 0xAC, 0x7A, 0xF7, 0x62, 0xA9, 0xC3, 0x79,
+0xF7, 0x2C, 0xAD, 0x25, 0x3B, 0xA3, 0x11, 0xAE, 0xC2, 0x47, 0x43, 0x4B, 0x94, 0x18, 0xEF, 0x6A,
+0x65, 0xC3, 0xBB, 0xFF, 0x8E, 0xC5, 0x87, 0x63, 0xC3, 0x11, 0x5C, 0xC2, 0xE5, 0x2A, 0x29, 0x84,
+0x96, 0xDE, 0x6A, 0x5E, 0xA9, 0xC1, 0x12, 0xD6, 0x09, 0x7C, 0x7A, 0x63, 0xC2, 0x65, 0x1A, 0x08,
+0x74, 0x90, 0xC5, 0x5E, 0x62, 0x5E, 0x64, 0xC1, 0xAA, 0x94, 0xA5, 0x2A, 0x63, 0xC3, 0x04, 0x12,
+0xA7, 0x5B, 0x4E, 0xB5, 0xBB, 0xFF, 0x5E, 0x00, 0xC2, 0x15, 0xEF, 0x2C, 0xB5, 0x46, 0x4B, 0x5C,
+0x68, 0xC2, 0x46, 0x3B, 0x8B, 0xA4, 0x59, 0xF7, 0x6A, 0x5E, 0xC3, 0x58, 0xF7, 0x6E, 0xC5, 0xE8,
+0x6B, 0xE4, 0x11, 0xA2, 0xC2, 0xC5, 0x2A, 0x29, 0x84, 0x95, 0xDE, 0x6A, 0x00, 0xC8, 0x9A, 0xFF,
+0xEF, 0xD5, 0x8A, 0x8C, 0x24, 0x1A, 0x84, 0x11, 0x44, 0x1A, 0xE8, 0x6B, 0x32, 0xD6, 0xFF, 0xFF,
+0x00, 0xA5, 0xC3, 0x51, 0xE6, 0x4C, 0xB5, 0xA7, 0x3C, 0x52, 0x86, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC0, 0xBB, 0xC5, 0x4A, 0xBE, 0x07, 0x91, 0x52, 0xAB, 0x52, 0x59, 0x52, 0x02,
+0x4A, 0x01, 0x59, 0x52, 0x59, 0x52, 0x59, 0x52, 0x00, 0x59, 0x52, 0x0F, 0x67, 0x71, 0x04, 0xC6,
+0xB6, 0xAE, 0xC8, 0x2C, 0xEA, 0x8C, 0xAB, 0xBC, 0x11, 0xDE, 0x18, 0xF7, 0x75, 0xEE, 0x7D, 0xC7,
+0x45, 0x43, 0x45, 0x1A, 0xE4, 0x19, 0x44, 0x1A, 0x28, 0x64, 0xAA, 0xBC, 0x8F, 0xD5, 0xF7, 0xEE,
+0xA5, 0xC2, 0x6D, 0xCD, 0xA7, 0x5B, 0x64, 0x1A, 0x70, 0x72, 0xC2, 0xA7, 0x3B, 0x8A, 0x9C, 0x2D,
+0xCD, 0x7F, 0xC1, 0x18, 0xEF, 0xD0, 0xD5, 0x4C, 0x58, 0x70, 0xAE, 0xC3, 0x26, 0x2B, 0x29, 0x7C,
+0x8C, 0xB4, 0x95, 0xE6, 0x57, 0xC2, 0xF2, 0xD5, 0x29, 0x8C, 0x05, 0x2B, 0x75, 0x70, 0xC8, 0xC5,
+0x22, 0x49, 0x6C, 0x6B, 0xAC, 0x33, 0xDE, 0x18, 0xEF, 0x53, 0xE6, 0x8A, 0xA4, 0xA6, 0x43, 0x44,
+0x1A, 0x70, 0x7F, 0xC5, 0x08, 0x54, 0x49, 0xA4, 0xB1, 0xD5, 0xF9, 0xEE, 0x76, 0xE6, 0xAC, 0xB4,
+0x63, 0xC0, 0x85, 0x1A, 0x70, 0xC4, 0x24, 0x1A, 0xA7, 0x3B, 0xC8, 0x8B, 0x0F, 0xBD, 0xD7, 0xE6,
+0xA5, 0xC1, 0xED, 0xBC, 0x08, 0x7C, 0x5D, 0x75, 0x96, 0xC1, 0x05, 0x23, 0xC8, 0x73, 0x4A, 0xC5,
+0xB6, 0xDE, 0xD7, 0xEE, 0x90, 0xCD, 0x08, 0x8C, 0x05, 0x33, 0xE4, 0x11, 0xB6, 0x50, 0xC7, 0xC8,
+0x5B, 0x2B, 0xA4, 0x76, 0xDE, 0x18, 0xEF, 0xD2, 0xDD, 0x0B, 0xA4, 0x66, 0x53, 0x24, 0x12, 0x70,
+0x7F, 0xC2, 0xA7, 0x43, 0xC9, 0x8B, 0xD2, 0xCD, 0x57, 0xC0, 0x53, 0xDE, 0x7B, 0xC0, 0xC7, 0x6B,
+0x44, 0x6B, 0xC8, 0x04, 0x1A, 0x46, 0x33, 0xE9, 0x83, 0x70, 0xC5, 0xF7, 0xE6, 0x74, 0xE6, 0xCC,
+0xBC, 0x28, 0x84, 0xE5, 0x2A, 0x6D, 0x70, 0xC2, 0xE5, 0x22, 0x09, 0x84, 0xEE, 0xC4, 0x43, 0xB9,
+0xC2, 0x4E, 0xCD, 0x4A, 0x9C, 0x66, 0x43, 0x72, 0x6B, 0xC7, 0x85, 0x1A, 0xC8, 0x5B, 0x8B, 0xB4,
+0x55, 0xE6, 0xF7, 0xEE, 0xB0, 0xD5, 0x6A, 0xAC, 0xE7, 0x5B, 0x77, 0x6B, 0x7A, 0x49, 0xC7, 0x49,
+0xA4, 0x35, 0xDE, 0x5A, 0xF7, 0x73, 0xE6, 0xCB, 0xC4, 0xE9, 0x8C, 0xC7, 0x2C, 0x72, 0x86, 0x71,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xBB, 0xC5, 0x5A, 0xB5, 0x52, 0x01, 0xAF, 0xC0,
+0xB7, 0xA4, 0x95, 0xC0, 0xF3, 0x83, 0x47, 0xC1, 0x14, 0x8C, 0x55, 0x94, 0x52, 0x91, 0x52, 0x7E,
+0x52, 0xAB, 0xC0, 0xF3, 0x8B, 0x4A, 0xC0, 0xD7, 0xA4, 0x47, 0x53, 0x4A, 0x59, 0x4A, 0xA9, 0x96,
+0x52, 0x00, 0x7E, 0x52, 0x0F, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0xC4, 0xF7, 0xB6, 0xE8, 0x2C, 0xE9,
+0x3C, 0xA9, 0x8C, 0x8A, 0xAC, 0xBE, 0xC2, 0x29, 0x94, 0xC6, 0x4B, 0xC6, 0x23, 0xA2, 0xBA, 0x42,
+0xC2, 0xE7, 0x2B, 0x89, 0x74, 0xAA, 0xAC, 0xBF, 0x85, 0xC1, 0x27, 0x6C, 0xC6, 0x2B, 0x42, 0xA6,
+0x42, 0xAE, 0xC1, 0x68, 0x54, 0xAA, 0x94, 0x79, 0x9A, 0xC1, 0x08, 0x74, 0xA6, 0x33, 0x86, 0x7D,
+0x00, 0x42, 0xC2, 0x07, 0x3C, 0x69, 0x84, 0x6A, 0xA4, 0x69, 0xC1, 0xC7, 0x73, 0xC6, 0x3B, 0x47,
+0x7D, 0xBE, 0x47, 0xC2, 0x27, 0x34, 0x89, 0x7C, 0x69, 0x9C, 0xA2, 0xC1, 0x08, 0x84, 0x07, 0x4C,
+0x4C, 0x42, 0x7D, 0x42, 0xC1, 0xE6, 0x2B, 0x89, 0x64, 0x5A, 0xB7, 0xC1, 0xC8, 0x83, 0xE7, 0x5B,
+0x4F, 0x42, 0x7D, 0x45, 0x4F, 0xC0, 0x48, 0x4C, 0x48, 0xC0, 0x09, 0x94, 0x96, 0x6E, 0xC0, 0x06,
+0x34, 0x42, 0x45, 0x96, 0x42, 0x66, 0xC1, 0x48, 0x7C, 0x08, 0x94, 0x93, 0xC2, 0xA7, 0x73, 0xC6,
+0x43, 0x65, 0x23, 0x7D, 0xA6, 0x76, 0xC1, 0xE6, 0x33, 0x08, 0x6C, 0x48, 0xBE, 0x81, 0xC1, 0xC7,
+0x53, 0xA5, 0x23, 0x76, 0x7D, 0x42, 0xC2, 0xC6, 0x2B, 0x28, 0x5C, 0xE9, 0x83, 0x50, 0xC2, 0x88,
+0x83, 0xC7, 0x63, 0xC6, 0x33, 0x7D, 0x01, 0x47, 0xC1, 0x28, 0x4C, 0x49, 0x8C, 0x55, 0x91, 0xC1,
+0xE7, 0x6B, 0xE6, 0x3B, 0x76, 0xA6, 0x7D, 0x47, 0xC2, 0x27, 0x3C, 0x29, 0x84, 0x09, 0x9C, 0x55,
+0xC2, 0xC7, 0x7B, 0xE7, 0x4B, 0x85, 0x23, 0x71, 0xAB, 0x42, 0xC2, 0xC7, 0x2B, 0x68, 0x74, 0x49,
+0x9C, 0x5D, 0x91, 0xC1, 0x07, 0x64, 0xA5, 0x2B, 0x7D, 0x01, 0x4F, 0xC2, 0x47, 0x5C, 0x49, 0x94,
+0x4A, 0xA4, 0x5D, 0xC1, 0x68, 0x7C, 0xC8, 0x3C, 0x8D, 0xC1, 0x93, 0x8E, 0xFF, 0xFF, 0x1F, 0x70,
+0x00, 0x71, 0x04, 0xC1, 0xBB, 0xC5, 0x5A, 0xB5, 0xBE, 0x01, 0x59, 0xC1, 0xF8, 0xAC, 0x91, 0x7B,
+0x00, 0xAF, 0xBE, 0xC0, 0x55, 0x94, 0x00, 0xC1, 0x70, 0x73, 0x75, 0x94, 0x61, 0xC0, 0x54, 0x94,
+0x66, 0x70, 0x4A, 0xC0, 0x96, 0x9C, 0xA5, 0xC0, 0x0E, 0x6B, 0x70, 0x47, 0xC1, 0x4F, 0x73, 0xB6,
+0x9C, 0x44, 0xC0, 0x34, 0x94, 0x78, 0xC0, 0xEE, 0x62, 0x7B, 0x73, 0x6A, 0x59, 0x52, 0x0B, 0xC0,
+0xBF, 0xFF, 0x71, 0x04, 0xC1, 0x18, 0xBF, 0x29, 0x2D, 0xA9, 0xC3, 0xC8, 0x2C, 0xA8, 0x44, 0x47,
+0x4C, 0x26, 0x2C, 0x96, 0xAE, 0xAB, 0xAE, 0xBA, 0x56, 0x00, 0xC0, 0x47, 0x3C, 0x76, 0xC0, 0x06,
+0x34, 0x56, 0x01, 0x5B, 0x00, 0xA7, 0x00, 0xC1, 0x47, 0x34, 0x47, 0x44, 0x92, 0xC0, 0xE5, 0x23,
+0xAB, 0x5E, 0xAB, 0x6A, 0x00, 0x67, 0x6D, 0xC0, 0x48, 0x44, 0x6B, 0x5E, 0x56, 0x00, 0x5B, 0x01,
+0x56, 0x67, 0xC0, 0x67, 0x3C, 0x6B, 0x85, 0x5B, 0x56, 0x62, 0x5B, 0x00, 0x56, 0x5B, 0x6D, 0x6B,
+0x5C, 0x56, 0x51, 0x56, 0x00, 0x5B, 0x01, 0x6D, 0x70, 0x5C, 0x56, 0x01, 0x5B, 0x62, 0x56, 0x51,
+0x65, 0x6B, 0x57, 0x9A, 0x86, 0x51, 0x00, 0x56, 0x00, 0x51, 0x56, 0x66, 0x5A, 0x59, 0x56, 0x02,
+0x5B, 0x56, 0x00, 0x68, 0x5A, 0x4F, 0x51, 0x00, 0x56, 0x5B, 0x00, 0x56, 0x00, 0xC0, 0x67, 0x34,
+0x70, 0x5C, 0x59, 0x56, 0x00, 0x65, 0x00, 0xAD, 0x5B, 0x5E, 0xBA, 0x5C, 0x54, 0x8A, 0x51, 0x56,
+0x01, 0x51, 0x00, 0xC0, 0x07, 0x34, 0xB6, 0x57, 0x51, 0x56, 0x5D, 0x65, 0x62, 0x00, 0x5B, 0x6D,
+0xB5, 0x70, 0xC3, 0xA7, 0x2C, 0xE8, 0x2C, 0x28, 0x2D, 0xF6, 0xA6, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC1, 0xBB, 0xC5, 0x5A, 0xB5, 0x52, 0x02, 0x4A, 0xC1, 0x50, 0x73, 0xB1, 0x7B,
+0x91, 0x53, 0xAE, 0x00, 0x47, 0xC0, 0x91, 0x7B, 0x5C, 0x44, 0xC0, 0x9B, 0xBD, 0x75, 0x5E, 0xC0,
+0x55, 0x94, 0x95, 0x53, 0x47, 0x70, 0xC1, 0x14, 0x8C, 0x39, 0xAD, 0x70, 0x55, 0x58, 0x78, 0x75,
+0x00, 0x4A, 0x52, 0x0C, 0xC0, 0xBF, 0xFF, 0x71, 0x04, 0x80, 0xC0, 0xF7, 0xB6, 0x80, 0x81, 0x90,
+0x96, 0x00, 0xA6, 0xBE, 0x66, 0x00, 0xAB, 0x61, 0xBF, 0x96, 0x59, 0x00, 0xA9, 0xA6, 0x52, 0x9A,
+0x01, 0xA6, 0x95, 0xAE, 0x7B, 0x4A, 0x40, 0xC0, 0x6E, 0x65, 0x80, 0x00, 0xC0, 0x6D, 0x55, 0xBE,
+0x92, 0x00, 0xBA, 0xBB, 0x4A, 0x66, 0x5E, 0x52, 0x5E, 0x61, 0x00, 0x59, 0x01, 0x61, 0x00, 0x6D,
+0x5E, 0x01, 0x59, 0x00, 0x68, 0x5E, 0x59, 0x61, 0x68, 0x5E, 0x59, 0x61, 0x5E, 0x52, 0x59, 0x04,
+0x61, 0x5E, 0x61, 0x68, 0x59, 0x4A, 0x59, 0x52, 0x4D, 0x00, 0x59, 0x4F, 0x52, 0x00, 0xA7, 0x59,
+0x52, 0x59, 0x01, 0x61, 0x59, 0x4A, 0x4D, 0x4A, 0x05, 0x4F, 0x5E, 0x4A, 0x5D, 0x00, 0x58, 0x5D,
+0x00, 0xAE, 0x01, 0x7B, 0x5E, 0x6D, 0x4A, 0x4F, 0x52, 0x59, 0xBA, 0x68, 0x61, 0x59, 0x01, 0x4A,
+0xA6, 0x4A, 0x00, 0x52, 0x59, 0x68, 0x61, 0x02, 0x59, 0xC0, 0x32, 0x86, 0xBE, 0xBF, 0xC1, 0xD6,
+0xA6, 0xDE, 0xF7, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xBB, 0xC5, 0x5A, 0xB5,
+0xBE, 0x02, 0xAF, 0xC1, 0x2F, 0x6B, 0x13, 0x8C, 0x4D, 0xC0, 0x34, 0x94, 0x58, 0x5F, 0xC1, 0xB7,
+0xA4, 0x34, 0x8C, 0x75, 0xC0, 0xD7, 0xA4, 0x66, 0x55, 0xC0, 0xF3, 0x83, 0x44, 0x6C, 0x4D, 0x75,
+0x58, 0x73, 0xBE, 0xC0, 0x70, 0x73, 0x55, 0x64, 0xC1, 0xF8, 0xA4, 0xB2, 0x83, 0x75, 0x66, 0x52,
+0x0C, 0xC0, 0xBF, 0xFF, 0x71, 0x10, 0xA5, 0x91, 0x00, 0x96, 0x04, 0xA9, 0x49, 0xA6, 0x49, 0x03,
+0x90, 0x95, 0x9A, 0x5F, 0x01, 0xAB, 0x5F, 0x66, 0x44, 0x49, 0x05, 0x42, 0x49, 0x44, 0x49, 0x33,
+0xA5, 0x00, 0x49, 0x42, 0x6E, 0x66, 0x00, 0x6E, 0x01, 0x9A, 0x00, 0x7D, 0xBF, 0x00, 0x49, 0x04,
+0x4C, 0x49, 0x4C, 0x00, 0x49, 0x04, 0x4C, 0x00, 0x49, 0x4C, 0x00, 0x49, 0x4C, 0x00, 0xAF, 0x71,
+0x21, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xBB, 0xC5, 0x4A, 0x52, 0x02, 0xAB, 0xC1, 0x18, 0xAD, 0x59,
+0xB5, 0x6F, 0x4A, 0xA5, 0x00, 0x4A, 0x00, 0x78, 0xC0, 0xF8, 0xA4, 0x5E, 0x5B, 0x73, 0x5B, 0x4A,
+0x56, 0x47, 0x4A, 0x7E, 0x4A, 0x7B, 0xC0, 0xF8, 0xAC, 0x7E, 0x4A, 0x75, 0x5B, 0x5E, 0x52, 0x0C,
+0xC0, 0xBF, 0xFF, 0x71, 0x0F, 0x91, 0xC0, 0xBA, 0xD6, 0x91, 0x0E, 0xAE, 0xAB, 0x7E, 0x45, 0x79,
+0x45, 0x7E, 0x01, 0x79, 0x13, 0x7E, 0x79, 0x12, 0x7E, 0x79, 0x0F, 0x7E, 0x79, 0x05, 0x7E, 0x45,
+0x7E, 0x45, 0x00, 0x7E, 0x45, 0x01, 0x79, 0x02, 0x7E, 0x79, 0x01, 0x7E, 0x79, 0x04, 0x7E, 0x01,
+0x79, 0x7E, 0x79, 0x00, 0x45, 0x7E, 0x79, 0xAB, 0x45, 0xC0, 0x1B, 0xDF, 0x71, 0x0B, 0x4D, 0xC0,
+0xF7, 0xBD, 0x44, 0x49, 0x71, 0x03, 0x67, 0x71, 0x09, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xBB, 0xC5,
+0x4A, 0x52, 0x03, 0x59, 0x00, 0x5E, 0x59, 0x01, 0x52, 0x00, 0x5E, 0x00, 0x52, 0x5E, 0x01, 0x52,
+0x5E, 0x00, 0x52, 0x59, 0x52, 0x5E, 0x00, 0x59, 0x4A, 0x47, 0x52, 0x0E, 0x67, 0x71, 0x0F, 0xC0,
+0xFB, 0xDE, 0x40, 0x45, 0x4D, 0x01, 0xA6, 0x45, 0x08, 0x48, 0x00, 0x45, 0x02, 0x48, 0x45, 0x01,
+0x48, 0x45, 0x03, 0x48, 0x00, 0x45, 0x48, 0x00, 0x45, 0x06, 0x48, 0x00, 0x45, 0x06, 0x48, 0x00,
+0x45, 0x06, 0x4D, 0x00, 0x48, 0x45, 0x02, 0x48, 0x45, 0x08, 0x48, 0x00, 0x45, 0x4D, 0x48, 0x45,
+0x04, 0x4D, 0x01, 0x45, 0x05, 0x48, 0x4D, 0x00, 0x48, 0x45, 0x08, 0x48, 0x45, 0x03, 0x48, 0x45,
+0x03, 0x79, 0x49, 0x71, 0x09, 0x58, 0xC0, 0xD3, 0x9C, 0x00, 0xC1, 0x75, 0xB5, 0x59, 0xCE, 0x71,
+0x00, 0x44, 0xC2, 0x18, 0xC6, 0x1C, 0xE7, 0x38, 0xC6, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0xC0, 0xBB, 0xBD, 0x4A, 0x52, 0x1B, 0x5E, 0x52, 0x0E, 0x67, 0x71, 0x07, 0xA6, 0x4D, 0x74,
+0xC0, 0xBA, 0xDE, 0x6C, 0x71, 0x01, 0x4D, 0x48, 0xC0, 0xDB, 0xD6, 0x79, 0x65, 0xAF, 0x45, 0x59,
+0x45, 0x02, 0x4D, 0x04, 0x48, 0x45, 0x01, 0x59, 0x01, 0x4D, 0x45, 0x4D, 0x00, 0x45, 0x01, 0x4D,
+0x01, 0x59, 0x79, 0x4D, 0x00, 0x45, 0x01, 0x4D, 0x59, 0x01, 0x4D, 0x00, 0x59, 0x45, 0x01, 0x4D,
+0x00, 0x48, 0x59, 0x45, 0x4D, 0x59, 0x45, 0x01, 0x4D, 0x00, 0x45, 0x59, 0x74, 0x71, 0x59, 0x4D,
+0x45, 0x01, 0x4D, 0x59, 0x00, 0x4D, 0x00, 0x45, 0x03, 0x59, 0x45, 0x4D, 0x00, 0x71, 0x48, 0x4D,
+0x45, 0x01, 0x4D, 0x59, 0x79, 0x01, 0x59, 0x4D, 0x45, 0x01, 0x48, 0x59, 0x79, 0x65, 0x00, 0x45,
+0x59, 0x48, 0x45, 0x01, 0x4D, 0x04, 0x45, 0x02, 0x59, 0x01, 0x4D, 0x45, 0x4D, 0x00, 0x45, 0xC1,
+0x3C, 0xE7, 0xFF, 0xFF, 0x0A, 0x74, 0xC1, 0xB2, 0x94, 0x75, 0xAD, 0x58, 0x71, 0x00, 0x5D, 0x60,
+0xC1, 0xEF, 0x83, 0x71, 0x94, 0x65, 0x71, 0x08, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xFB, 0xC5, 0x4A,
+0x52, 0x2A, 0x4A, 0x66, 0x6C, 0x71, 0x06, 0xC3, 0x1C, 0xE7, 0xCF, 0x7B, 0x92, 0x94, 0xF3, 0xA4,
+0x68, 0x6C, 0x70, 0x71, 0x00, 0x59, 0xC1, 0x59, 0xC6, 0x51, 0x8C, 0x6C, 0xAE, 0x00, 0x6C, 0xC0,
+0xF3, 0x9C, 0x48, 0x00, 0x45, 0x00, 0x79, 0x96, 0x01, 0x79, 0x68, 0xC0, 0x55, 0xAD, 0x59, 0x48,
+0x4D, 0x7C, 0xC4, 0xAE, 0x73, 0x10, 0x84, 0xB6, 0xB5, 0x1C, 0xDF, 0xB2, 0x94, 0x7D, 0x4D, 0x45,
+0x4D, 0xC3, 0x76, 0xAD, 0x8E, 0x73, 0x30, 0x84, 0x92, 0x8C, 0x5D, 0x00, 0xC0, 0xD7, 0xB5, 0x4D,
+0x96, 0x4D, 0x51, 0xC0, 0x71, 0x8C, 0x7C, 0x41, 0x5D, 0xC1, 0x4D, 0x6B, 0x14, 0xA5, 0x45, 0x48,
+0x4D, 0xC0, 0x96, 0xAD, 0x7D, 0x4D, 0x54, 0x5D, 0x00, 0x64, 0x4D, 0x45, 0x4D, 0x51, 0x6D, 0xC0,
+0xDA, 0xD6, 0x68, 0x5D, 0x6C, 0x40, 0xC0, 0x59, 0xCE, 0x4D, 0x48, 0x4D, 0xC0, 0xEF, 0x7B, 0xA2,
+0x7C, 0x7D, 0x79, 0xC0, 0xDB, 0xD6, 0x4D, 0x45, 0x00, 0x4D, 0xC0, 0xD3, 0x94, 0x5D, 0x54, 0x00,
+0x6C, 0x58, 0xC0, 0xD7, 0xBD, 0x4D, 0x45, 0x4D, 0xC0, 0x18, 0xBE, 0x40, 0x58, 0xC1, 0xAB, 0x5A,
+0x6D, 0x6B, 0x40, 0x51, 0x4D, 0x45, 0x48, 0x95, 0x68, 0x6C, 0x71, 0x6C, 0x00, 0x6D, 0x45, 0x48,
+0x45, 0x00, 0x79, 0x96, 0x01, 0xA5, 0x40, 0x71, 0x48, 0x45, 0x4D, 0x50, 0xC1, 0xAE, 0x73, 0xEF,
+0x7B, 0x75, 0xC0, 0x1C, 0xDF, 0x41, 0x69, 0x4D, 0xC1, 0x3C, 0xE7, 0xFF, 0xFF, 0x0A, 0x65, 0x00,
+0xC0, 0x7D, 0xEF, 0x71, 0x01, 0x49, 0x7D, 0x48, 0xC0, 0x5D, 0xEF, 0x60, 0xC0, 0xBE, 0xF7, 0x71,
+0x07, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0x3E, 0xEF, 0x7A, 0xBD, 0x92, 0x4A, 0x29, 0x52,
+0xC0, 0x1D, 0xE7, 0x71, 0x07, 0x5C, 0xC0, 0xB6, 0xBD, 0x71, 0x01, 0x4C, 0x5C, 0x71, 0x00, 0x61,
+0xC2, 0xB2, 0x94, 0x2C, 0x6B, 0x9A, 0xCE, 0x4D, 0x00, 0x51, 0xC0, 0x8A, 0x52, 0x51, 0x4D, 0xA6,
+0x45, 0xC0, 0x0C, 0x63, 0x58, 0xC0, 0xEF, 0x7B, 0x00, 0xBF, 0xC0, 0x08, 0x42, 0x6D, 0x61, 0x4D,
+0x7D, 0xC0, 0xAA, 0x5A, 0x51, 0x69, 0x58, 0x68, 0x70, 0xC0, 0x34, 0xA5, 0x59, 0x48, 0x4D, 0xC1,
+0xEB, 0x62, 0x55, 0xA5, 0x7C, 0xC0, 0xCB, 0x5A, 0x45, 0x6D, 0xC0, 0x4D, 0x6B, 0x59, 0x45, 0x4D,
+0xC0, 0xD7, 0xB5, 0x5C, 0xC0, 0x2C, 0x63, 0x6D, 0x58, 0x70, 0x69, 0x45, 0x00, 0xC0, 0xFB, 0xDE,
+0x71, 0x54, 0x7C, 0x75, 0x7E, 0x69, 0x50, 0x79, 0x48, 0x4D, 0x69, 0xC0, 0xEB, 0x5A, 0x51, 0x61,
+0x51, 0x79, 0x61, 0x55, 0x59, 0x48, 0x4D, 0x61, 0x7C, 0x00, 0x71, 0x91, 0x6C, 0x7D, 0x4D, 0x00,
+0xC0, 0x59, 0xC6, 0x50, 0xC0, 0x18, 0xBE, 0x6C, 0x70, 0xC0, 0x1C, 0xDF, 0x40, 0x95, 0xC0, 0xDB,
+0xDE, 0x45, 0x59, 0x58, 0x54, 0xC3, 0xFB, 0xDE, 0xB2, 0x94, 0x6E, 0x73, 0x55, 0xA5, 0x70, 0x4D,
+0x48, 0x59, 0x55, 0xC0, 0xEB, 0x5A, 0x74, 0x4D, 0x00, 0x65, 0xC0, 0xCB, 0x5A, 0x69, 0x59, 0x00,
+0x69, 0xC0, 0xAA, 0x52, 0x71, 0x01, 0x67, 0xC0, 0xE7, 0x41, 0x65, 0xC0, 0xBA, 0xD6, 0x00, 0xC1,
+0x18, 0xC6, 0xAA, 0x52, 0x7D, 0xA6, 0xC1, 0xAE, 0x73, 0x51, 0x8C, 0x44, 0x68, 0x59, 0xC1, 0x3C,
+0xE7, 0xFF, 0xFF, 0x0A, 0xC2, 0x1C, 0xE7, 0x14, 0xA5, 0x6D, 0x6B, 0x75, 0x71, 0xA6, 0x4C, 0x60,
+0x75, 0x78, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x05, 0xC1, 0x7E, 0xF7, 0xBD, 0xDE, 0xA6,
+0x28, 0x65, 0xC0, 0x7E, 0xEF, 0x71, 0x08, 0xC1, 0xF0, 0x83, 0x71, 0x94, 0x7D, 0x78, 0x7D, 0x5C,
+0xC0, 0xEF, 0x83, 0x71, 0x00, 0x59, 0xC0, 0x38, 0xC6, 0x40, 0xC1, 0xAF, 0x73, 0xEF, 0x7B, 0xA6,
+0x5D, 0x68, 0x45, 0x48, 0x45, 0xBE, 0x71, 0x4C, 0x45, 0x79, 0x4D, 0x41, 0x69, 0x4D, 0x00, 0x65,
+0x58, 0x79, 0xC0, 0xDB, 0xDE, 0x4D, 0x7C, 0xC0, 0x69, 0x4A, 0x78, 0x59, 0x45, 0x4D, 0xC0, 0x30,
+0x84, 0x4C, 0xC0, 0x9A, 0xCE, 0x51, 0xC0, 0xFB, 0xDE, 0x55, 0xC0, 0x30, 0x84, 0x59, 0x91, 0x00,
+0x4D, 0x00, 0x78, 0x6D, 0xC2, 0x2C, 0x63, 0x71, 0x8C, 0x1C, 0xDF, 0x45, 0x00, 0xC0, 0xDB, 0xD6,
+0x41, 0xC0, 0x6E, 0x73, 0xA9, 0xC0, 0xB2, 0x94, 0x61, 0xC0, 0x18, 0xC6, 0x58, 0x45, 0x00, 0x48,
+0x4D, 0x7C, 0x5D, 0xC1, 0xAA, 0x52, 0xEB, 0x62, 0x5D, 0x54, 0xC0, 0x79, 0xCE, 0x48, 0x00, 0xAE,
+0x6C, 0xC0, 0x18, 0xBE, 0x61, 0x59, 0x79, 0x69, 0xC0, 0xD7, 0xB5, 0x4D, 0x45, 0x4D, 0xC0, 0x71,
+0x8C, 0x58, 0x40, 0x00, 0xC0, 0xAE, 0x7B, 0x44, 0x7D, 0x4D, 0x45, 0x4D, 0xC0, 0x55, 0xAD, 0x53,
+0x71, 0xC0, 0x6D, 0x6B, 0x64, 0xC1, 0x59, 0xC6, 0x30, 0x84, 0x48, 0x9A, 0x4D, 0x79, 0xC1, 0x30,
+0x84, 0xAE, 0x73, 0x6C, 0x00, 0x5D, 0x59, 0x79, 0x48, 0x4D, 0x51, 0xC1, 0xEF, 0x7B, 0x9A, 0xCE,
+0x79, 0x45, 0x79, 0x68, 0xC0, 0x59, 0xCE, 0x48, 0x00, 0x79, 0x58, 0x65, 0x5C, 0x4D, 0xC1, 0x14,
+0xA5, 0x8A, 0x52, 0x55, 0x4D, 0xC1, 0x3C, 0xE7, 0xFF, 0xFF, 0x0A, 0x65, 0xBA, 0xC0, 0x7D, 0xEF,
+0x71, 0x00, 0xA6, 0xC0, 0x34, 0xAD, 0x64, 0xC1, 0xD7, 0xBD, 0x9A, 0xD6, 0x71, 0x09, 0x70, 0x00,
+0x71, 0x3D, 0xC1, 0x1C, 0xE7, 0x18, 0xC6, 0x65, 0x02, 0x70, 0x71, 0x00, 0x4D, 0x01, 0xC1, 0x59,
+0xC6, 0xF8, 0xBD, 0xAE, 0x79, 0xC0, 0xDB, 0xD6, 0x48, 0x45, 0x01, 0x4D, 0x48, 0x01, 0x45, 0x4D,
+0x00, 0x45, 0x00, 0x48, 0x45, 0x01, 0x48, 0x59, 0x45, 0x03, 0x4D, 0x45, 0x4D, 0x00, 0x45, 0x79,
+0x45, 0x03, 0x48, 0x59, 0x4D, 0x51, 0x71, 0x48, 0x45, 0x01, 0x4D, 0x45, 0x00, 0x4D, 0x45, 0x01,
+0x48, 0x45, 0x01, 0x59, 0x45, 0x71, 0x65, 0x79, 0x59, 0x4D, 0x45, 0x01, 0x48, 0x45, 0x01, 0x48,
+0x4D, 0x00, 0x45, 0x01, 0x4D, 0x79, 0x4D, 0x00, 0x60, 0x45, 0x4D, 0x45, 0x01, 0x4D, 0x79, 0x51,
+0x79, 0x4D, 0x45, 0x4D, 0x45, 0x01, 0x4D, 0x61, 0x45, 0x65, 0x00, 0x45, 0x69, 0x71, 0x4D, 0x45,
+0x4D, 0x61, 0x4D, 0x59, 0x00, 0x4D, 0x64, 0x79, 0x48, 0x45, 0x48, 0x4D, 0x02, 0xC0, 0x1C, 0xDF,
+0x78, 0xC0, 0xD7, 0xB5, 0x48, 0x75, 0xC0, 0xFF, 0xFF, 0x0A, 0x60, 0x7C, 0x95, 0x75, 0x71, 0x70,
+0x4D, 0x7D, 0xA1, 0x65, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3D, 0x74, 0x50, 0x64, 0x78,
+0xC0, 0x34, 0xAD, 0x40, 0x7D, 0x71, 0x00, 0x4D, 0x45, 0x00, 0x48, 0x4D, 0x00, 0x48, 0x45, 0x0D,
+0x48, 0x45, 0x02, 0x48, 0x45, 0x07, 0x48, 0x00, 0x45, 0x05, 0x4D, 0x00, 0x45, 0x08, 0x48, 0x45,
+0x04, 0x4D, 0x00, 0x48, 0x45, 0x11, 0x4D, 0x48, 0x45, 0x03, 0x48, 0x4D, 0x48, 0x45, 0x03, 0x4D,
+0x60, 0xC1, 0xCF, 0x7B, 0x30, 0x84, 0x02, 0xC0, 0x08, 0x42, 0x49, 0x4D, 0x00, 0x49, 0x6C, 0x45,
+0x01, 0x40, 0x60, 0xC0, 0x59, 0xC6, 0x4D, 0x48, 0x9A, 0xC0, 0x30, 0x84, 0x40, 0x45, 0x00, 0x54,
+0xC0, 0x49, 0x4A, 0x6D, 0x59, 0x75, 0xC0, 0xFF, 0xFF, 0x09, 0xC0, 0x7D, 0xEF, 0x55, 0x50, 0x7C,
+0x79, 0x71, 0x5C, 0x55, 0x64, 0x55, 0x51, 0x71, 0x09, 0x70, 0x00, 0x71, 0x3D, 0x91, 0xC1, 0x3C,
+0xEF, 0x59, 0xCE, 0x7C, 0x6C, 0x40, 0xC0, 0xBA, 0xDE, 0x71, 0x00, 0x4D, 0x96, 0xE0, 0x23, 0x4D,
+0x51, 0x57, 0xC0, 0x96, 0xB5, 0x7D, 0x00, 0xAF, 0xC0, 0x6D, 0x6B, 0x51, 0x4D, 0x00, 0xC2, 0x96,
+0xAD, 0xCB, 0x5A, 0xD7, 0xB5, 0x7D, 0x00, 0x78, 0x44, 0xC0, 0x59, 0xC6, 0x4D, 0x45, 0x48, 0xC1,
+0xEB, 0x5A, 0xF4, 0x9C, 0x49, 0x7D, 0x51, 0x6C, 0xC0, 0x14, 0xA5, 0x4D, 0xC1, 0x3C, 0xE7, 0xFF,
+0xFF, 0x0A, 0xC0, 0x7D, 0xEF, 0x79, 0x64, 0xC0, 0x9E, 0xF7, 0x71, 0xC1, 0x5D, 0xEF, 0xDB, 0xDE,
+0x65, 0xA6, 0xC0, 0x9A, 0xD6, 0x71, 0x09, 0x70, 0x00, 0x71, 0x3D, 0x74, 0xC0, 0x6D, 0x73, 0x53,
+0x7C, 0x68, 0xC0, 0x1C, 0xE7, 0x49, 0x71, 0x00, 0x4D, 0x45, 0xE0, 0x25, 0x91, 0x4D, 0x02, 0x79,
+0x45, 0x02, 0x71, 0x4D, 0x02, 0x79, 0x45, 0x01, 0x48, 0x71, 0x45, 0x4D, 0x01, 0x45, 0x79, 0x45,
+0x75, 0xC0, 0xFF, 0xFF, 0x0A, 0x64, 0xC0, 0xD7, 0xBD, 0xBE, 0x5D, 0x71, 0x49, 0xA2, 0x4C, 0xC0,
+0x35, 0xAD, 0x4D, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3D, 0x60, 0xC0, 0x71, 0x94, 0x64,
+0x78, 0x69, 0x55, 0x79, 0x71, 0x00, 0xC0, 0x5D, 0xE7, 0x79, 0x45, 0xE0, 0x24, 0x48, 0x45, 0x07,
+0x48, 0x45, 0x07, 0x48, 0x45, 0x04, 0x4D, 0x5D, 0x71, 0x08, 0xA6, 0x4C, 0x40, 0x51, 0x60, 0x5D,
+0x71, 0x00, 0xC0, 0xFB, 0xDE, 0x64, 0x74, 0x55, 0x6C, 0x71, 0x08, 0x70, 0x00, 0x71, 0x05, 0xC1,
+0xBB, 0xE7, 0x78, 0xCF, 0x2A, 0xC0, 0x9B, 0xE7, 0x71, 0x08, 0x61, 0x4D, 0x71, 0xC0, 0xB6, 0xB5,
+0x6D, 0xBB, 0xC0, 0xFB, 0xE6, 0x71, 0x01, 0x44, 0x61, 0xA6, 0x61, 0xE0, 0x3C, 0xBF, 0x5D, 0x71,
+0x0A, 0x70, 0x00, 0x61, 0x70, 0x6C, 0x71, 0x70, 0x6D, 0x00, 0x4C, 0xC0, 0x92, 0x94, 0x71, 0x09,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x42, 0xC0, 0x35, 0xBF, 0x2C, 0xC0, 0x9A, 0xDF, 0x71, 0x07,
+0xC0, 0xEF, 0x7B, 0x79, 0xC1, 0xFF, 0xFF, 0x51, 0x8C, 0x74, 0xA5, 0xC0, 0xEF, 0x83, 0x71, 0xE0,
+0x28, 0x84, 0xA5, 0x17, 0xBF, 0x71, 0x0C, 0x5D, 0xA6, 0x79, 0x71, 0x00, 0x58, 0xC2, 0x3C, 0xE7,
+0x59, 0xCE, 0xD7, 0xBD, 0x4D, 0x71, 0x09, 0x70, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xCF, 0x84, 0xBB,
+0x2A, 0x75, 0xBF, 0x71, 0x07, 0xC1, 0x30, 0x8C, 0x76, 0xB5, 0x71, 0x01, 0x78, 0xC0, 0x30, 0x84,
+0x71, 0xE0, 0x26, 0x5B, 0x4E, 0x75, 0x19, 0xC0, 0x79, 0xD7, 0x71, 0x0A, 0x49, 0x55, 0x50, 0xC0,
+0x92, 0x94, 0x79, 0x71, 0x00, 0x61, 0xC0, 0x71, 0x8C, 0x68, 0x7C, 0x71, 0x09, 0x70, 0x00, 0x71,
+0x04, 0xC0, 0x57, 0xC7, 0x75, 0x7F, 0x00, 0xC0, 0x76, 0xC7, 0xBF, 0x49, 0x7F, 0x49, 0x58, 0x49,
+0x44, 0x49, 0x7F, 0x00, 0x44, 0x58, 0x9A, 0x44, 0x7F, 0x04, 0x44, 0x00, 0x7F, 0x11, 0x9A, 0x44,
+0xC0, 0xFE, 0xFF, 0x71, 0x06, 0xC1, 0x7D, 0xEF, 0x72, 0x94, 0x48, 0x59, 0x48, 0xC0, 0x71, 0x94,
+0x49, 0x71, 0xE0, 0x26, 0x5A, 0x75, 0x7F, 0x08, 0x44, 0x04, 0x7F, 0x03, 0xC0, 0x76, 0xC7, 0x01,
+0xAE, 0x49, 0x7C, 0x75, 0xC0, 0xBC, 0xE7, 0x71, 0x0A, 0x65, 0xA1, 0xC1, 0xDB, 0xDE, 0x1C, 0xE7,
+0x71, 0x00, 0x5C, 0x4C, 0xC1, 0xD3, 0x9C, 0x55, 0xAD, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0x4B, 0x75, 0x7F, 0x44, 0xC2, 0xB1, 0x9D, 0x2D, 0x74, 0xD1, 0x9D, 0x44, 0xC4, 0x70, 0x95,
+0xAE, 0x7C, 0x33, 0xA6, 0xF5, 0xBE, 0x12, 0xA6, 0x44, 0x00, 0xC3, 0x94, 0xAE, 0xAE, 0x84, 0x30,
+0x8D, 0x15, 0xBF, 0x44, 0x00, 0x7F, 0x00, 0x44, 0xAE, 0xC0, 0xD4, 0xB6, 0x6B, 0x44, 0x7F, 0x10,
+0x9A, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x08, 0xC0, 0x9E, 0xF7, 0x91, 0x58, 0x71, 0xE0, 0x28, 0xC0,
+0x56, 0xC7, 0x75, 0x7F, 0x08, 0xC0, 0xB4, 0xB6, 0x91, 0x02, 0x4F, 0x7F, 0x02, 0x49, 0xC1, 0xF2,
+0x9D, 0x6D, 0x7C, 0x96, 0xBF, 0x76, 0x49, 0x75, 0xC0, 0x9A, 0xDF, 0x71, 0x09, 0x6C, 0x78, 0xAE,
+0x00, 0x5D, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x64, 0x01, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0xC0, 0x57, 0xC7, 0x75, 0x49, 0x76, 0xC1, 0x6B, 0x63, 0x91, 0x95, 0xA5, 0x75, 0xC2, 0x2A,
+0x5B, 0xAE, 0x84, 0x4A, 0x5B, 0x49, 0xC1, 0xEC, 0x6B, 0x76, 0xC7, 0xBF, 0xC2, 0x30, 0x8D, 0x8B,
+0x63, 0x0C, 0x74, 0x7E, 0x44, 0x43, 0x44, 0x7F, 0x7C, 0xC1, 0xD5, 0xB6, 0x2D, 0x74, 0x70, 0x7C,
+0x44, 0x7F, 0x0F, 0x7C, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x10, 0xC0, 0x9F, 0xF7, 0x81, 0x0E, 0xBE,
+0x6C, 0x71, 0x32, 0x96, 0xC0, 0x7E, 0xE7, 0x48, 0x0E, 0xC0, 0xBF, 0xF7, 0x71, 0x09, 0x44, 0x75,
+0x7F, 0x07, 0x44, 0x70, 0xC0, 0x2D, 0x74, 0xBE, 0x7E, 0x6A, 0xC0, 0xCF, 0x84, 0x75, 0x44, 0x7F,
+0x49, 0xC2, 0x70, 0x95, 0xAB, 0x63, 0xD2, 0x9D, 0x76, 0x51, 0xC0, 0x8B, 0x63, 0x62, 0x49, 0x73,
+0x71, 0x09, 0x91, 0xC0, 0x72, 0x94, 0x65, 0x74, 0x5D, 0x71, 0x00, 0xC1, 0x38, 0xCE, 0xB3, 0x9C,
+0x68, 0xC0, 0xEF, 0x83, 0x79, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7,
+0x75, 0x49, 0x51, 0x78, 0x75, 0xC2, 0xB7, 0xCF, 0x15, 0xBF, 0xCC, 0x6B, 0x5D, 0x6A, 0xC0, 0xAE,
+0x84, 0x6A, 0x49, 0x4E, 0xC0, 0x30, 0x8D, 0xAE, 0x6B, 0xC0, 0x4A, 0x5B, 0x56, 0x69, 0xC0, 0xEF,
+0x84, 0x49, 0x7D, 0x51, 0xC2, 0xE9, 0x52, 0x2A, 0x5B, 0x53, 0xAE, 0x49, 0x7F, 0x0F, 0x7C, 0x44,
+0xC0, 0xFE, 0xFF, 0x71, 0x0F, 0xC1, 0x9F, 0xEF, 0x1E, 0xDF, 0x04, 0xBE, 0x7B, 0x09, 0x43, 0x71,
+0x31, 0x6C, 0xC0, 0x3E, 0xDF, 0x7B, 0x40, 0x43, 0x40, 0x7B, 0x40, 0x00, 0x7B, 0x09, 0xC0, 0xBF,
+0xF7, 0x71, 0x08, 0x44, 0x95, 0x7F, 0x07, 0x44, 0xC1, 0x70, 0x95, 0x15, 0xBF, 0x44, 0x6F, 0x56,
+0xC0, 0x30, 0x8D, 0x44, 0x7F, 0x00, 0x55, 0x5E, 0x7D, 0xC0, 0xF8, 0xD7, 0x95, 0x71, 0x4B, 0x00,
+0x4E, 0x73, 0xC0, 0xFF, 0xFF, 0x09, 0x6C, 0x79, 0xC0, 0xF7, 0xBD, 0x60, 0xC0, 0x9E, 0xF7, 0x71,
+0x00, 0x6C, 0x65, 0x4C, 0x65, 0xC0, 0xDB, 0xDE, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0xC0, 0x57, 0xC7, 0x75, 0x44, 0x7C, 0xC2, 0x6D, 0x7C, 0x88, 0x4A, 0xAE, 0x7C, 0x44, 0xC0, 0x0A,
+0x5B, 0x78, 0xC2, 0xAC, 0x6B, 0xF2, 0xA5, 0x0D, 0x74, 0x49, 0x4E, 0xC2, 0x50, 0x95, 0xC9, 0x52,
+0x6B, 0x63, 0x42, 0xC0, 0x8E, 0x7C, 0x44, 0x42, 0xC5, 0xD5, 0xB6, 0x6B, 0x5B, 0x15, 0xBF, 0xEF,
+0x84, 0xF2, 0x9D, 0x77, 0xC7, 0x7F, 0x10, 0x7C, 0x44, 0x6A, 0x71, 0x0F, 0xC0, 0x3E, 0xE7, 0x7B,
+0xC0, 0x5F, 0xE7, 0x03, 0xC1, 0x7B, 0xCE, 0x1D, 0xDF, 0x40, 0x7B, 0x00, 0x40, 0x03, 0x43, 0x40,
+0x7B, 0x64, 0x71, 0x30, 0xC0, 0x9F, 0xEF, 0x7B, 0x43, 0xC4, 0x9C, 0xCE, 0xF9, 0xBD, 0xFD, 0xDE,
+0x7F, 0xE7, 0xDD, 0xD6, 0x95, 0x40, 0x7B, 0x00, 0x40, 0x4F, 0x01, 0x7B, 0x40, 0x43, 0x7B, 0xC0,
+0x5E, 0xE7, 0x71, 0x08, 0x44, 0x95, 0x7F, 0x06, 0x44, 0x6B, 0xC0, 0x2A, 0x5B, 0x55, 0xC0, 0xAE,
+0x84, 0x42, 0x75, 0x78, 0xC0, 0x73, 0xAE, 0x44, 0x7F, 0x44, 0x43, 0xC1, 0x8B, 0x63, 0x2D, 0x74,
+0x4B, 0x6A, 0xC2, 0xCC, 0x6B, 0xD4, 0xB6, 0x55, 0xBF, 0x73, 0x71, 0x08, 0x91, 0xC0, 0x9A, 0xD6,
+0x79, 0xC1, 0x75, 0xAD, 0xB6, 0xBD, 0x5D, 0x71, 0x00, 0xC0, 0x3C, 0xE7, 0x6D, 0x59, 0xC0, 0x14,
+0xA5, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x94, 0x7C, 0x44, 0xC1,
+0xD7, 0xCF, 0x15, 0xBF, 0x64, 0x43, 0x42, 0xC0, 0xF2, 0x9D, 0x44, 0x7E, 0x5E, 0x49, 0x4E, 0xC0,
+0x30, 0x8D, 0x65, 0xC1, 0x15, 0xBF, 0x71, 0x95, 0x57, 0xC0, 0xF8, 0xD7, 0x51, 0xC0, 0x94, 0xAE,
+0x65, 0xC1, 0x56, 0xC7, 0xAE, 0x84, 0x62, 0x55, 0x7F, 0x10, 0x7C, 0x44, 0xC0, 0xFE, 0xFF, 0xAB,
+0x0F, 0xC0, 0x3E, 0xE7, 0x7B, 0xC1, 0xB8, 0xB5, 0x15, 0xA5, 0xAE, 0xAB, 0x57, 0xC2, 0xEC, 0x5A,
+0xBC, 0xD6, 0x3E, 0xDF, 0x7B, 0x01, 0x67, 0xA9, 0x00, 0x6F, 0x5C, 0xC2, 0xD8, 0xB5, 0x5F, 0xE7,
+0x9F, 0xF7, 0x71, 0x30, 0xC0, 0x7E, 0xEF, 0x43, 0xC7, 0x19, 0xBE, 0x6E, 0x6B, 0x52, 0x8C, 0xD0,
+0x7B, 0xF8, 0xB5, 0x97, 0xB5, 0x72, 0x8C, 0x7F, 0xEF, 0x7B, 0x40, 0xC1, 0xBC, 0xD6, 0x52, 0x8C,
+0x81, 0xC0, 0x56, 0xA5, 0x54, 0xC0, 0xD8, 0xB5, 0x4B, 0x4F, 0xA9, 0x71, 0x08, 0xC0, 0x56, 0xC7,
+0x75, 0xBB, 0x06, 0x44, 0x00, 0xC0, 0x6E, 0x7C, 0x91, 0x78, 0xC1, 0xD5, 0xB6, 0x97, 0xC7, 0x51,
+0xC0, 0xB4, 0xB6, 0x44, 0x7F, 0x7C, 0x49, 0x70, 0xC1, 0x12, 0xA6, 0xB1, 0x9D, 0x96, 0x70, 0xC0,
+0x76, 0xC7, 0x75, 0xC0, 0x9A, 0xDF, 0x71, 0x0A, 0xC1, 0x18, 0xC6, 0x96, 0xB5, 0x00, 0xC0, 0x9E,
+0xF7, 0x71, 0x00, 0xC2, 0x7A, 0xD6, 0xB6, 0xB5, 0x35, 0xAD, 0x95, 0x6C, 0x71, 0x08, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x75, 0x44, 0xC4, 0x53, 0xAE, 0xCF, 0x84, 0x50, 0x8D,
+0x6B, 0x63, 0xB4, 0xB6, 0x42, 0xC1, 0x15, 0xBF, 0x97, 0xCF, 0x76, 0xC0, 0xCC, 0x6B, 0x49, 0x4E,
+0xC3, 0x0F, 0x8D, 0xAF, 0x84, 0xD7, 0xCF, 0x94, 0xAE, 0x78, 0xC0, 0xCF, 0x84, 0x56, 0xC0, 0x35,
+0xBF, 0x51, 0x7F, 0x64, 0x56, 0xC0, 0xB4, 0xB6, 0x44, 0x7F, 0x0F, 0x7C, 0x44, 0xC0, 0xFE, 0xFF,
+0x71, 0x0F, 0xC0, 0x3E, 0xE7, 0x48, 0xC2, 0x2D, 0x63, 0x72, 0x8C, 0x76, 0xAD, 0x68, 0xA6, 0xC1,
+0x0C, 0x63, 0xBC, 0xD6, 0x40, 0x7B, 0xC1, 0x5F, 0xE7, 0x15, 0x9D, 0x7C, 0xC0, 0x52, 0x84, 0xA5,
+0xBF, 0xC3, 0x6A, 0x4A, 0xF5, 0x9C, 0x7F, 0xE7, 0x9F, 0xF7, 0x71, 0x30, 0xC0, 0x7E, 0xEF, 0x97,
+0xC0, 0xD4, 0x9C, 0x5B, 0xC0, 0xDF, 0xF7, 0x53, 0x5B, 0xC0, 0xCB, 0x5A, 0x4C, 0xC0, 0x9F, 0xEF,
+0x7B, 0x54, 0x60, 0x5B, 0x53, 0xC0, 0x93, 0x8C, 0x58, 0xC1, 0xF0, 0x7B, 0xB4, 0x94, 0x54, 0x48,
+0x71, 0x08, 0x44, 0x75, 0x7F, 0x07, 0x44, 0x49, 0x64, 0xC0, 0x8E, 0x7C, 0x64, 0xC1, 0x91, 0x95,
+0xD4, 0xB6, 0x44, 0x7F, 0x00, 0xC2, 0x76, 0xC7, 0x71, 0x95, 0xB1, 0x9D, 0x62, 0x43, 0xC0, 0xCC,
+0x6B, 0x00, 0xC1, 0x73, 0xAE, 0x56, 0xC7, 0x73, 0x71, 0x09, 0x5D, 0xC3, 0x71, 0x94, 0x9A, 0xD6,
+0xB3, 0x9C, 0x96, 0xB5, 0x5D, 0x71, 0xC0, 0x3C, 0xE7, 0xBF, 0x75, 0xC0, 0x38, 0xC6, 0x71, 0x09,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x4B, 0x94, 0xBF, 0xC3, 0xF5, 0xB6, 0xCF, 0x84, 0x6E, 0x7C,
+0x53, 0xAE, 0x44, 0xC0, 0x12, 0xA6, 0x75, 0x44, 0x68, 0x6A, 0x44, 0x00, 0xC0, 0x94, 0xAE, 0x43,
+0x44, 0x49, 0xC2, 0xD2, 0x9D, 0x6D, 0x7C, 0xB4, 0xB6, 0x44, 0x6A, 0xC0, 0x36, 0xBF, 0x6B, 0x64,
+0x43, 0x44, 0x7F, 0x0F, 0x7C, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x0F, 0xC0, 0x3E, 0xE7, 0x9A, 0xC0,
+0x3A, 0xC6, 0x43, 0xC0, 0x7F, 0xEF, 0x54, 0xBE, 0xC0, 0x5A, 0xC6, 0x6F, 0x40, 0xA6, 0xC2, 0x5F,
+0xE7, 0xD8, 0xB5, 0x15, 0x9D, 0x43, 0x6F, 0x40, 0xC1, 0xB8, 0xB5, 0xF9, 0xBD, 0x43, 0xC0, 0x9F,
+0xF7, 0x71, 0x30, 0xC0, 0x7E, 0xEF, 0x40, 0x53, 0xC0, 0xD8, 0xB5, 0x4F, 0x43, 0x5C, 0xC0, 0x76,
+0xAD, 0xAF, 0x4F, 0x7B, 0x4F, 0x70, 0x91, 0x57, 0x9A, 0xC2, 0xF9, 0xBD, 0x0C, 0x63, 0x56, 0xA5,
+0x4F, 0xA9, 0x71, 0x08, 0x44, 0x75, 0x49, 0x44, 0x7F, 0x49, 0x01, 0x7F, 0x01, 0x44, 0xC0, 0xAE,
+0x7C, 0x5E, 0xC0, 0x70, 0x95, 0x00, 0xC0, 0x4D, 0x74, 0xA6, 0xC0, 0x36, 0xBF, 0x44, 0x7F, 0xC0,
+0x97, 0xCF, 0x56, 0xC0, 0x91, 0x95, 0x7E, 0xC2, 0xC9, 0x52, 0x76, 0xC7, 0xCF, 0x84, 0x48, 0x4E,
+0xC0, 0x9A, 0xDF, 0x71, 0x0A, 0xC1, 0xF7, 0xBD, 0x96, 0xB5, 0x95, 0xC1, 0xB6, 0xB5, 0x5D, 0xEF,
+0x71, 0x65, 0x78, 0xC2, 0x3C, 0xE7, 0xD3, 0x9C, 0xDF, 0xFF, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC0, 0x57, 0xC7, 0x94, 0x7F, 0xAE, 0x58, 0x00, 0x49, 0x7F, 0x49, 0x44, 0x7F, 0x44,
+0x49, 0x7F, 0x00, 0x44, 0x49, 0x7F, 0x00, 0x49, 0x58, 0x44, 0x7F, 0x49, 0x7F, 0x44, 0x58, 0x44,
+0x7F, 0x10, 0x9A, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x0F, 0x43, 0x40, 0xC0, 0xD4, 0x94, 0xBF, 0xC0,
+0xFD, 0xDE, 0x9A, 0xC0, 0xD4, 0x9C, 0x5B, 0x74, 0xAF, 0x7B, 0xBE, 0xC0, 0x3A, 0xC6, 0x95, 0xC0,
+0x5F, 0xE7, 0xBE, 0x7B, 0xC1, 0x97, 0xAD, 0x5B, 0xC6, 0x40, 0xC0, 0x9F, 0xF7, 0x71, 0x30, 0xC0,
+0x7E, 0xEF, 0x40, 0xC1, 0x5A, 0xC6, 0x52, 0x84, 0x64, 0x4F, 0x64, 0x4C, 0xC0, 0xB8, 0xB5, 0x4F,
+0x7B, 0x43, 0x78, 0xC0, 0xD8, 0xB5, 0x4F, 0x54, 0x4F, 0x7C, 0x64, 0x43, 0xAE, 0x71, 0x08, 0x44,
+0x00, 0xC1, 0x12, 0xA6, 0xB4, 0xB6, 0x49, 0xC0, 0x30, 0x8D, 0x56, 0xC0, 0x50, 0x8D, 0x44, 0x01,
+0x6B, 0xC0, 0x2A, 0x5B, 0x44, 0xC0, 0xD8, 0xD7, 0x62, 0x00, 0xC0, 0x6B, 0x63, 0x7E, 0x44, 0xA6,
+0x44, 0x7E, 0xC0, 0x0C, 0x6C, 0x42, 0xC3, 0xF2, 0x9D, 0xF8, 0xD7, 0x0F, 0x8D, 0xD1, 0x9D, 0x49,
+0xC1, 0x9A, 0xDF, 0xFF, 0xFF, 0x10, 0xA6, 0x51, 0x69, 0xC0, 0xDB, 0xDE, 0x71, 0x09, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x94, 0x7F, 0x2A, 0x9A, 0x44, 0xC0, 0xFE, 0xFF, 0x71,
+0x0F, 0x43, 0x40, 0x7B, 0x60, 0xC0, 0x6A, 0x4A, 0xBE, 0xC1, 0xD4, 0x94, 0x3E, 0xDF, 0x00, 0x7B,
+0x00, 0x43, 0xC1, 0x7B, 0xC6, 0x52, 0x8C, 0x4C, 0xC3, 0xF4, 0x9C, 0x11, 0x84, 0xB4, 0x94, 0xBC,
+0xD6, 0x40, 0x5F, 0x71, 0x30, 0xC7, 0x7E, 0xEF, 0x1E, 0xDF, 0x5E, 0xE7, 0x3A, 0xC6, 0x0C, 0x63,
+0x6A, 0x4A, 0x2D, 0x63, 0x5A, 0xC6, 0x4F, 0x7B, 0x00, 0x43, 0xC0, 0x9B, 0xCE, 0x60, 0x91, 0xC0,
+0xF4, 0x9C, 0x4C, 0xC2, 0xB3, 0x94, 0xBC, 0xCE, 0x3E, 0xDF, 0xBE, 0x71, 0x08, 0x4B, 0x75, 0xC0,
+0x6B, 0x63, 0x6B, 0xC4, 0xF2, 0xA5, 0xE9, 0x52, 0x94, 0xAE, 0x8B, 0x63, 0x12, 0xA6, 0x49, 0x7F,
+0x49, 0xC2, 0xAE, 0x84, 0xCC, 0x6B, 0x50, 0x8D, 0xBE, 0xC0, 0x2D, 0x74, 0x00, 0xC0, 0x36, 0xBF,
+0xBE, 0x7F, 0x44, 0x7E, 0xC0, 0x6E, 0x7C, 0xAE, 0xC0, 0xCF, 0x84, 0x4B, 0x7E, 0x4F, 0xC1, 0x56,
+0xBF, 0x9A, 0xDF, 0x71, 0x08, 0x6C, 0xC0, 0x96, 0xB5, 0x69, 0xC0, 0xB6, 0xB5, 0x78, 0xC0, 0x9E,
+0xF7, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x94, 0x7F, 0x03, 0x49,
+0x00, 0x44, 0x49, 0x44, 0x01, 0x7F, 0x44, 0x01, 0x49, 0x44, 0x7F, 0x18, 0x7C, 0x44, 0xC0, 0xFE,
+0xFF, 0x71, 0x0F, 0xC0, 0x3E, 0xE7, 0x40, 0xC0, 0xF5, 0x9C, 0x4C, 0xC0, 0xB8, 0xB5, 0x68, 0x47,
+0xC0, 0x35, 0xA5, 0x40, 0x00, 0x7B, 0x40, 0xA5, 0x63, 0xC0, 0x2D, 0x63, 0xA1, 0xC1, 0xAF, 0x73,
+0x5A, 0xC6, 0x40, 0x7B, 0x5F, 0x71, 0x30, 0xC0, 0x7E, 0xEF, 0x40, 0xC5, 0x7B, 0xCE, 0x11, 0x84,
+0xF4, 0x9C, 0xD8, 0xB5, 0x93, 0x94, 0x32, 0x84, 0x78, 0x43, 0x7B, 0x40, 0x7B, 0xC0, 0x56, 0xAD,
+0x7C, 0xA5, 0xC1, 0x8F, 0x73, 0x3A, 0xC6, 0x40, 0x7B, 0xC0, 0x5E, 0xE7, 0x71, 0x08, 0x44, 0x49,
+0x77, 0xAF, 0xC5, 0x2A, 0x5B, 0x91, 0x95, 0xD7, 0xCF, 0x0C, 0x6C, 0x12, 0xA6, 0x76, 0xC7, 0x7F,
+0x44, 0x00, 0xC1, 0xF2, 0x9D, 0xAE, 0x84, 0x43, 0xC2, 0x71, 0x95, 0xF5, 0xBE, 0x56, 0xC7, 0x7F,
+0x00, 0x44, 0xC0, 0xB4, 0xB6, 0x5D, 0x56, 0xA6, 0x00, 0x96, 0xC0, 0xD4, 0xB6, 0x7A, 0xC0, 0x9A,
+0xDF, 0x71, 0x09, 0x6C, 0x61, 0x7D, 0xA6, 0x58, 0x71, 0x00, 0xC0, 0xDB, 0xDE, 0x61, 0xC1, 0xBE,
+0xF7, 0x38, 0xC6, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x75, 0x7F,
+0x02, 0x44, 0x76, 0xC0, 0xD2, 0x9D, 0x6B, 0x56, 0xC0, 0x94, 0xB6, 0x6B, 0x00, 0x44, 0x57, 0xC0,
+0x15, 0xBF, 0x6B, 0xC2, 0x32, 0xA6, 0xF5, 0xB6, 0x76, 0xC7, 0x44, 0x49, 0x44, 0x49, 0x44, 0x00,
+0x49, 0x44, 0x01, 0x7F, 0x0D, 0x9A, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x0F, 0xC0, 0x3E, 0xE7, 0x7B,
+0xC0, 0x7B, 0xCE, 0x74, 0x54, 0xC2, 0xBF, 0xEF, 0xBC, 0xCE, 0x52, 0x84, 0x67, 0x40, 0x7B, 0xC7,
+0x5F, 0xE7, 0x97, 0xAD, 0xB4, 0x94, 0x1E, 0xDF, 0x9F, 0xEF, 0x3A, 0xBE, 0x11, 0x84, 0x1A, 0xBE,
+0x43, 0xC0, 0x9F, 0xF7, 0x71, 0x30, 0xC0, 0x7E, 0xEF, 0x7B, 0x90, 0x96, 0x43, 0x5C, 0x00, 0x63,
+0x00, 0x4F, 0x7B, 0x4F, 0xC2, 0xB8, 0xB5, 0xB3, 0x94, 0xFD, 0xDE, 0x5C, 0xC0, 0x5A, 0xC6, 0x4C,
+0xC0, 0xF9, 0xBD, 0x4F, 0x48, 0x71, 0x08, 0x44, 0x00, 0x52, 0xC0, 0xEF, 0x84, 0x76, 0x49, 0xC1,
+0xF5, 0xBE, 0x50, 0x95, 0x7F, 0x44, 0x01, 0xC3, 0x6B, 0x63, 0x88, 0x4A, 0xCC, 0x6B, 0x8E, 0x7C,
+0x00, 0x7E, 0x75, 0x44, 0x7F, 0x49, 0xC1, 0x30, 0x8D, 0x47, 0x42, 0x78, 0xC3, 0x2D, 0x74, 0xAE,
+0x84, 0x4D, 0x74, 0x73, 0xAE, 0x44, 0x73, 0x71, 0x09, 0xC4, 0x9E, 0xF7, 0xF3, 0xA4, 0x51, 0x8C,
+0x92, 0x94, 0x9A, 0xD6, 0x71, 0x91, 0x68, 0xBE, 0xC1, 0x55, 0xAD, 0xF7, 0xBD, 0x71, 0x09, 0x70,
+0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x75, 0x7F, 0x01, 0xAE, 0xC0, 0x94, 0xAE, 0x6F, 0xC0, 0x12,
+0xA6, 0x00, 0x6F, 0xC6, 0x8E, 0x7C, 0x30, 0x8D, 0xD2, 0x9D, 0xB7, 0xCF, 0x10, 0x8D, 0x73, 0xAE,
+0xF5, 0xBE, 0x5C, 0xA1, 0x57, 0x6B, 0x6A, 0xC0, 0x74, 0xAE, 0x62, 0xC0, 0x36, 0xBF, 0x4F, 0xC1,
+0xD2, 0x9D, 0xF5, 0xB6, 0x6B, 0x96, 0x44, 0x7F, 0x0C, 0x7C, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x0F,
+0xC0, 0x3E, 0xE7, 0xAF, 0xC1, 0x97, 0xAD, 0xCF, 0x73, 0x47, 0xC3, 0xB4, 0x94, 0xF0, 0x7B, 0xF5,
+0x9C, 0x1E, 0xDF, 0x40, 0x7B, 0xC3, 0x5F, 0xE7, 0xB4, 0x94, 0xB8, 0xB5, 0x9F, 0xEF, 0x4F, 0xBE,
+0x9A, 0xC0, 0x1E, 0xDF, 0x00, 0xC0, 0x9F, 0xF7, 0x71, 0x30, 0x50, 0x7B, 0x95, 0xC2, 0x52, 0x84,
+0xD0, 0x7B, 0x93, 0x8C, 0xA1, 0x47, 0xC1, 0x3A, 0xC6, 0x5E, 0xE7, 0x7B, 0x4F, 0xC1, 0xF4, 0x9C,
+0x77, 0xAD, 0x5C, 0x4F, 0x57, 0x00, 0x7B, 0x00, 0xC0, 0x5E, 0xE7, 0x71, 0x08, 0xC0, 0x57, 0xC7,
+0x44, 0xC2, 0xEC, 0x6B, 0x73, 0xAE, 0x97, 0xCF, 0x44, 0x00, 0xC1, 0x0D, 0x74, 0x53, 0xA6, 0x49,
+0x7F, 0x44, 0xC2, 0xB4, 0xB6, 0xB1, 0x9D, 0xCF, 0x84, 0x65, 0xC0, 0x0F, 0x8D, 0x44, 0x00, 0x7F,
+0x00, 0x44, 0x91, 0xC0, 0xF2, 0xA5, 0x64, 0x6F, 0x00, 0xC0, 0xD4, 0xB6, 0x44, 0x75, 0xC0, 0x9A,
+0xDF, 0x71, 0x09, 0xA6, 0xC3, 0xDB, 0xDE, 0x59, 0xCE, 0x34, 0xAD, 0x3C, 0xE7, 0x71, 0x00, 0xC1,
+0x5D, 0xEF, 0x96, 0xB5, 0xA5, 0xC0, 0x9A, 0xD6, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04,
+0x4B, 0x94, 0x7F, 0x01, 0xAE, 0x63, 0x5E, 0xC0, 0x91, 0x95, 0x76, 0x6F, 0xC1, 0xAE, 0x7C, 0x30,
+0x8D, 0x5D, 0xC0, 0xB7, 0xCF, 0x64, 0x4A, 0xAE, 0xC2, 0x0D, 0x74, 0x6D, 0x7C, 0xEF, 0x84, 0x00,
+0x57, 0xC1, 0x53, 0xAE, 0x2D, 0x74, 0x49, 0xC1, 0x6E, 0x7C, 0x50, 0x95, 0x70, 0xC2, 0x71, 0x95,
+0x12, 0xA6, 0x76, 0xC7, 0x7F, 0x0C, 0x9A, 0xBE, 0xC0, 0xFE, 0xFF, 0x71, 0x0F, 0xC0, 0x3E, 0xE7,
+0x96, 0xC5, 0x2D, 0x63, 0x3A, 0xC6, 0x15, 0x9D, 0xEC, 0x62, 0xFD, 0xDE, 0x5F, 0xE7, 0x7B, 0x01,
+0xC2, 0x7F, 0xE7, 0x72, 0x8C, 0xEC, 0x5A, 0x53, 0x47, 0x00, 0x95, 0xC0, 0x5A, 0xC6, 0x43, 0x5F,
+0x71, 0x30, 0x50, 0x4F, 0xC0, 0x56, 0xA5, 0x69, 0xC2, 0x1D, 0xDF, 0xCC, 0x5A, 0x35, 0xA5, 0x4F,
+0x43, 0x7B, 0x00, 0x54, 0xC1, 0xB4, 0x94, 0xCB, 0x5A, 0x53, 0x47, 0x00, 0x95, 0xC0, 0x19, 0xBE,
+0x43, 0xAE, 0x71, 0x08, 0x44, 0x00, 0xC2, 0x6B, 0x63, 0x12, 0xA6, 0x97, 0xCF, 0x00, 0x44, 0xC0,
+0x8B, 0x63, 0x6A, 0x49, 0x7F, 0x44, 0xC2, 0x94, 0xAE, 0x70, 0x95, 0xAE, 0x84, 0x65, 0xC1, 0x0F,
+0x8D, 0x36, 0xBF, 0x44, 0x7F, 0x00, 0x44, 0xC0, 0xF5, 0xBE, 0x51, 0xC1, 0xEF, 0x84, 0x4D, 0x74,
+0x00, 0xC0, 0xB4, 0xB6, 0x44, 0x75, 0xC0, 0x9A, 0xDF, 0x71, 0x09, 0xC4, 0x5D, 0xEF, 0xF7, 0xBD,
+0x7D, 0xEF, 0x18, 0xC6, 0x1C, 0xE7, 0x71, 0x00, 0xC2, 0x38, 0xC6, 0x14, 0xA5, 0xBA, 0xD6, 0x45,
+0xC0, 0x3C, 0xE7, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x94, 0x7F,
+0x02, 0xAE, 0x75, 0x7E, 0xC1, 0xCF, 0x84, 0x2D, 0x74, 0x6B, 0xC0, 0x91, 0x95, 0xBE, 0x5D, 0x5C,
+0xC0, 0xB4, 0xB6, 0x4F, 0xC1, 0xCC, 0x6B, 0xF2, 0xA5, 0x49, 0xC0, 0xAE, 0x84, 0x4A, 0x49, 0x77,
+0x4B, 0xC0, 0x30, 0x8D, 0x44, 0x64, 0xC0, 0x0D, 0x74, 0x75, 0x44, 0x7F, 0x0C, 0x7C, 0x44, 0xC0,
+0xFE, 0xFF, 0x71, 0x0F, 0x43, 0x96, 0x69, 0xBF, 0x91, 0xC0, 0x4D, 0x6B, 0x4C, 0x5B, 0x74, 0x40,
+0x7B, 0x54, 0xC2, 0x52, 0x84, 0xB3, 0x94, 0xDC, 0xD6, 0x91, 0x00, 0xA6, 0xC0, 0xFD, 0xDE, 0x7B,
+0x5F, 0x71, 0x30, 0xC0, 0x7E, 0xEF, 0x97, 0xC0, 0xB8, 0xB5, 0x44, 0x58, 0xC1, 0x2D, 0x63, 0xD0,
+0x7B, 0x78, 0x4B, 0x4F, 0x7B, 0x54, 0xC0, 0x93, 0x8C, 0xA5, 0xC0, 0xDC, 0xD6, 0x4C, 0x00, 0x47,
+0xC0, 0xFD, 0xD6, 0x7B, 0x48, 0x71, 0x08, 0xC0, 0x56, 0xC7, 0x00, 0x76, 0x42, 0xC0, 0x2D, 0x74,
+0xAE, 0x42, 0xC0, 0xCF, 0x84, 0x44, 0x02, 0xC2, 0x8B, 0x63, 0xA8, 0x4A, 0xAC, 0x63, 0x6F, 0x7E,
+0x00, 0x75, 0x44, 0x7F, 0xC0, 0x76, 0xC7, 0x70, 0xC1, 0x47, 0x42, 0x6B, 0x63, 0x6A, 0xC0, 0x8E,
+0x7C, 0x65, 0xC0, 0x53, 0xAE, 0x44, 0xC0, 0x9A, 0xDF, 0x71, 0x08, 0xA6, 0xC2, 0xB6, 0xB5, 0xAE,
+0x7B, 0x92, 0x94, 0x6D, 0xC0, 0x5D, 0xEF, 0x71, 0x00, 0x44, 0xC1, 0x34, 0xAD, 0x76, 0xB5, 0x95,
+0xC0, 0x18, 0xC6, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x75, 0x7F,
+0x01, 0xAE, 0xC1, 0xD5, 0xB6, 0xAE, 0x84, 0x92, 0xC0, 0xD2, 0x9D, 0x00, 0xC0, 0xD7, 0xCF, 0x5D,
+0xC2, 0x12, 0xA6, 0xB7, 0xCF, 0x30, 0x8D, 0x51, 0xC0, 0x0F, 0x8D, 0x57, 0x65, 0x64, 0xC5, 0xD2,
+0x9D, 0x94, 0xAE, 0x70, 0x95, 0x2D, 0x74, 0x50, 0x95, 0xB1, 0x95, 0x44, 0xC0, 0xB1, 0x9D, 0x7E,
+0xC0, 0x97, 0xCF, 0x7F, 0x0D, 0x9A, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x0F, 0x48, 0x7B, 0x00, 0x67,
+0xAE, 0xBE, 0x67, 0x6C, 0x7B, 0x01, 0xBE, 0xC0, 0x3A, 0xBE, 0x47, 0xC0, 0x5F, 0xE7, 0x40, 0x01,
+0x7B, 0x00, 0xC0, 0xDF, 0xF7, 0x71, 0x30, 0x5F, 0x7B, 0x40, 0xA1, 0x67, 0x74, 0x6C, 0x67, 0x6F,
+0x40, 0x7B, 0x43, 0xC1, 0x3A, 0xC6, 0x7B, 0xC6, 0x4F, 0x40, 0x02, 0x7B, 0x50, 0x71, 0x08, 0x5A,
+0x75, 0x49, 0x7C, 0xC0, 0x53, 0xAE, 0x76, 0xC0, 0xD4, 0xB6, 0x49, 0xA6, 0x7F, 0x02, 0x75, 0xA6,
+0x6B, 0x01, 0x7F, 0x03, 0x7C, 0x70, 0x00, 0x6B, 0x00, 0x75, 0x00, 0xC0, 0xBB, 0xE7, 0x71, 0x08,
+0x91, 0xC2, 0xFB, 0xDE, 0x9A, 0xD6, 0xD7, 0xBD, 0x60, 0xC0, 0xDF, 0xFF, 0x71, 0x00, 0xC0, 0x7D,
+0xEF, 0x4C, 0xC0, 0x75, 0xAD, 0xBA, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0x57,
+0xC7, 0x75, 0x7F, 0x03, 0x6B, 0xAE, 0x44, 0x00, 0x7F, 0x44, 0x00, 0x7F, 0x44, 0x70, 0x75, 0x44,
+0x70, 0x7C, 0x44, 0x00, 0x7C, 0x70, 0x44, 0x01, 0xC0, 0xEF, 0x8C, 0x7E, 0xC0, 0x76, 0xC7, 0x7F,
+0x0D, 0x7C, 0x44, 0x6A, 0x71, 0x0F, 0x92, 0x40, 0x7B, 0x08, 0x43, 0x40, 0x7B, 0x03, 0x50, 0x71,
+0x32, 0xC0, 0x5E, 0xE7, 0x7B, 0x08, 0x43, 0x40, 0x7B, 0x03, 0x43, 0xC0, 0xDF, 0xFF, 0x71, 0x08,
+0x84, 0x44, 0x75, 0x00, 0x44, 0x00, 0x7A, 0x75, 0x14, 0xC0, 0x78, 0xD7, 0x71, 0x0B, 0xC0, 0x34,
+0xA5, 0xBF, 0x6D, 0xBF, 0xC0, 0x7D, 0xEF, 0x71, 0x91, 0x4D, 0xC1, 0x59, 0xCE, 0x72, 0x94, 0x6C,
+0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x4B, 0x75, 0x7F, 0x03, 0x44, 0x00, 0x7F, 0x05,
+0x44, 0x7F, 0x00, 0x44, 0x00, 0x7F, 0x01, 0x44, 0x7F, 0x00, 0x9A, 0xC0, 0xD5, 0xB6, 0x44, 0x7F,
+0x0E, 0x7C, 0x44, 0x6A, 0x71, 0x10, 0x6C, 0x96, 0xA6, 0x0D, 0xC0, 0xDF, 0xF7, 0x71, 0x34, 0x64,
+0x5F, 0x0D, 0x64, 0x71, 0x0B, 0x9A, 0xC0, 0xBC, 0xE7, 0x05, 0x42, 0x0B, 0x49, 0x04, 0x58, 0x71,
+0x0B, 0x5D, 0xC2, 0xD3, 0x9C, 0xDB, 0xDE, 0x34, 0xAD, 0x92, 0x74, 0x71, 0x61, 0xC0, 0xF7, 0xBD,
+0x74, 0xC0, 0x3C, 0xE7, 0x71, 0x09, 0x70, 0x00, 0x71, 0x04, 0xC0, 0x57, 0xC7, 0x94, 0x7F, 0x18,
+0x44, 0x7F, 0x0F, 0x9A, 0x44, 0x6A, 0x71, 0x24, 0xA8, 0xC0, 0xD6, 0xF7, 0xA4, 0x08, 0xAE, 0xBA,
+0x5C, 0x57, 0x5C, 0x00, 0x57, 0x20, 0x5C, 0x10, 0x57, 0x0A, 0x5C, 0xAB, 0x03, 0xBA, 0xC0, 0xD9,
+0xFF, 0x71, 0x0B, 0xA8, 0xA8, 0x03, 0x63, 0x71, 0x0B, 0x6C, 0xC3, 0xBA, 0xDE, 0x75, 0xAD, 0x38,
+0xC6, 0x9E, 0xF7, 0x5D, 0x71, 0x74, 0xC0, 0xF3, 0xA4, 0x79, 0xC0, 0xDB, 0xDE, 0x71, 0x09, 0x70,
+0x00, 0x71, 0x04, 0x4B, 0x75, 0x7F, 0x2A, 0x7C, 0xBE, 0xC0, 0xFE, 0xFF, 0x71, 0x23, 0x63, 0xC0,
+0xB1, 0xF7, 0x94, 0xAE, 0x06, 0x6C, 0xC2, 0xCF, 0xF7, 0x4E, 0xE7, 0xAD, 0xD6, 0x6C, 0xC1, 0xEF,
+0xF7, 0x6F, 0xEF, 0x91, 0xC0, 0xAF, 0xF7, 0x71, 0x15, 0x6C, 0x74, 0x79, 0x01, 0x74, 0x6C, 0x71,
+0x05, 0x6C, 0x74, 0x00, 0x6C, 0x71, 0x0B, 0x74, 0x00, 0x6C, 0x00, 0x74, 0x00, 0x6C, 0x71, 0x07,
+0xA5, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF, 0x09, 0x6A, 0xC0, 0xB0, 0xF7, 0x74, 0x03, 0x7B, 0x6A, 0x71,
+0x09, 0x5D, 0x5C, 0xC1, 0x79, 0xCE, 0xB7, 0xBD, 0x4C, 0x5D, 0x71, 0x00, 0xC0, 0x38, 0xC6, 0x6D,
+0x60, 0xC0, 0x9A, 0xD6, 0x71, 0x09, 0x70, 0x00, 0x71, 0x04, 0x5A, 0x75, 0x7F, 0x2A, 0x75, 0x4B,
+0x71, 0x24, 0xC0, 0xD8, 0xFF, 0x6C, 0xBF, 0x07, 0xAE, 0xC4, 0xCE, 0xDE, 0xA9, 0x7B, 0x6A, 0x8C,
+0x09, 0x84, 0x4D, 0xCE, 0x00, 0xC1, 0x8A, 0x94, 0xF0, 0xFF, 0x7B, 0x14, 0x96, 0x40, 0x67, 0xC0,
+0x4D, 0xC6, 0x92, 0xC0, 0xCE, 0xD6, 0x40, 0x7B, 0x05, 0x40, 0x48, 0x73, 0x67, 0x7B, 0x0D, 0x73,
+0x7B, 0x00, 0x6C, 0x7B, 0x09, 0x74, 0x7B, 0x63, 0x71, 0x07, 0xC0, 0xD9, 0xFF, 0x6C, 0x74, 0x7B,
+0x03, 0x74, 0x6C, 0xC0, 0xDA, 0xFF, 0x71, 0x08, 0xA6, 0x4C, 0xC0, 0x14, 0xA5, 0x69, 0x50, 0xC0,
+0x7D, 0xEF, 0x71, 0x00, 0xC3, 0x3C, 0xE7, 0x34, 0xA5, 0x96, 0xB5, 0x59, 0xCE, 0x71, 0x09, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xBC, 0xEF, 0x7C, 0xA9, 0x2B, 0xC0, 0xBB, 0xE7, 0x71, 0x11,
+0xC1, 0x9E, 0xFF, 0x1D, 0xFF, 0x0E, 0xC0, 0x5E, 0xFF, 0x71, 0x6A, 0xC0, 0x8F, 0xEF, 0x7B, 0x07,
+0x48, 0xC0, 0x8C, 0xAD, 0x68, 0xC4, 0xF1, 0xFF, 0x0F, 0xDF, 0x8A, 0x94, 0x48, 0x6B, 0x29, 0x84,
+0x48, 0x7B, 0x02, 0x48, 0x96, 0x7B, 0x00, 0x40, 0x7B, 0x0B, 0x40, 0xC1, 0xAE, 0xD6, 0xA8, 0x73,
+0x70, 0xC1, 0xCB, 0x9C, 0xE9, 0x7B, 0x44, 0x40, 0x7B, 0x00, 0x96, 0x40, 0x48, 0xC1, 0x2F, 0xE7,
+0x0D, 0xC6, 0x44, 0xC0, 0x09, 0x84, 0x53, 0x40, 0x7B, 0x0A, 0xC1, 0x4F, 0xE7, 0xAA, 0x94, 0x5F,
+0x7B, 0x40, 0xC1, 0x6D, 0xCE, 0x0B, 0xA5, 0x40, 0x7B, 0x09, 0xC2, 0xFC, 0xFF, 0xBF, 0xFF, 0x3D,
+0xFF, 0xA6, 0x03, 0xC0, 0x5E, 0xFF, 0x71, 0x6A, 0x6C, 0x7B, 0x05, 0x6C, 0x6A, 0x71, 0x09, 0xC4,
+0x1C, 0xE7, 0x51, 0x8C, 0xDB, 0xDE, 0xD3, 0x9C, 0x79, 0xCE, 0x71, 0x00, 0xC2, 0x9E, 0xF7, 0x55,
+0xAD, 0x9A, 0xD6, 0x4D, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x05, 0x94, 0xC0, 0x9A, 0xDF,
+0x2A, 0xC0, 0xDD, 0xEF, 0x71, 0x11, 0xC1, 0x7E, 0xFF, 0x7B, 0xFE, 0x10, 0xC0, 0xFD, 0xFE, 0x6A,
+0xC0, 0xAF, 0xEF, 0xBB, 0x07, 0xAE, 0xC2, 0xAE, 0xD6, 0x2B, 0xA5, 0xF0, 0xFF, 0x40, 0xBF, 0xC1,
+0xEB, 0x9C, 0x8A, 0x94, 0x48, 0x7B, 0x01, 0x5F, 0xC1, 0xEC, 0xBD, 0x6E, 0xCE, 0x40, 0x7B, 0xC1,
+0x8E, 0xD6, 0x90, 0xEF, 0x7B, 0x0A, 0x48, 0xC1, 0x4A, 0x8C, 0xED, 0xBD, 0x4F, 0x01, 0xC0, 0xC9,
+0x7B, 0x79, 0x40, 0x7B, 0x40, 0x7E, 0xC3, 0x68, 0x6B, 0x09, 0x84, 0x6C, 0xAD, 0x28, 0x63, 0x79,
+0x40, 0x7B, 0x0A, 0x40, 0xC0, 0x2D, 0xC6, 0x42, 0xC0, 0xF1, 0xFF, 0x48, 0x00, 0xC0, 0x4F, 0xEF,
+0x66, 0x73, 0x7B, 0x02, 0x40, 0x00, 0x7B, 0x40, 0x48, 0x7B, 0x00, 0xC1, 0x9B, 0xFF, 0x9C, 0xFE,
+0xA5, 0x05, 0xC1, 0xFD, 0xFE, 0xD6, 0xF7, 0x71, 0xBB, 0x05, 0x95, 0x6A, 0xC0, 0xFF, 0xFF, 0x0A,
+0xC0, 0x59, 0xCE, 0x69, 0xC1, 0xB6, 0xB5, 0x9E, 0xF7, 0x71, 0x00, 0xC0, 0x79, 0xCE, 0x54, 0x64,
+0xC1, 0xF3, 0xA4, 0xDF, 0xFF, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x06, 0xC0, 0xBC,
+0xFE, 0x59, 0xAE, 0x0F, 0xA7, 0xC1, 0x56, 0xF7, 0xAF, 0xEF, 0x7B, 0x07, 0x40, 0x52, 0xC3, 0x09,
+0x84, 0x0D, 0xBE, 0xF1, 0xFF, 0x2D, 0xC6, 0x47, 0xC0, 0x6D, 0xCE, 0x40, 0x7B, 0x00, 0x95, 0x47,
+0xC0, 0xCB, 0x9C, 0x68, 0xBE, 0xC0, 0xEF, 0xDE, 0x42, 0x5F, 0x7B, 0x0A, 0xC0, 0xF0, 0xF7, 0x42,
+0x70, 0xC0, 0x6C, 0xAD, 0xA6, 0x6F, 0xC1, 0x28, 0x63, 0x6D, 0xCE, 0x40, 0x7B, 0x00, 0xC0, 0x0F,
+0xE7, 0x44, 0x70, 0x49, 0xC1, 0xC7, 0x5A, 0xAC, 0xB5, 0x6C, 0x7B, 0x0B, 0x91, 0x47, 0x49, 0x5D,
+0x58, 0xC0, 0x29, 0x84, 0x49, 0xC0, 0xD0, 0xF7, 0x7B, 0x01, 0x40, 0xC0, 0xEE, 0xDE, 0x52, 0x48,
+0xC1, 0xAE, 0xD6, 0x2B, 0xA5, 0x5F, 0x40, 0xC0, 0xF9, 0xFE, 0x60, 0x5E, 0x05, 0x60, 0xC1, 0x55,
+0xF7, 0xAF, 0xF7, 0x7B, 0x03, 0x67, 0x6C, 0x74, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF, 0x10, 0xA6, 0xC2,
+0xB6, 0xBD, 0x34, 0xA5, 0xBA, 0xD6, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x06, 0xC0,
+0xBC, 0xFE, 0xA1, 0xAF, 0xC0, 0xDD, 0xFE, 0x6A, 0x65, 0x5E, 0x6A, 0x65, 0x5E, 0x02, 0x65, 0x00,
+0x5E, 0x00, 0x65, 0x00, 0x60, 0xC1, 0x35, 0xF7, 0xAF, 0xEF, 0xBF, 0x73, 0x67, 0x48, 0x7B, 0x95,
+0x73, 0x7B, 0x02, 0x79, 0xC0, 0xA9, 0x73, 0x61, 0xC1, 0x88, 0x73, 0x6D, 0xCE, 0x73, 0x7B, 0x01,
+0xC1, 0x4F, 0xE7, 0x68, 0x73, 0x7B, 0x48, 0x58, 0x42, 0xC0, 0xA7, 0x5A, 0x67, 0xC0, 0xB0, 0xF7,
+0x0B, 0x79, 0xC0, 0xCC, 0xBD, 0x4B, 0x01, 0x95, 0x5F, 0x7B, 0x00, 0x73, 0x40, 0xBF, 0x40, 0x5A,
+0x58, 0xC1, 0x8A, 0x94, 0xEC, 0xBD, 0x45, 0x7B, 0x0A, 0x40, 0x73, 0x77, 0x49, 0x00, 0x53, 0x6C,
+0x7B, 0x01, 0x48, 0xC0, 0x6C, 0xAD, 0x47, 0x54, 0x47, 0x68, 0x7F, 0x6C, 0x7B, 0xC0, 0xD9, 0xFE,
+0x60, 0x5E, 0x03, 0xAB, 0x5E, 0x60, 0x4A, 0x74, 0x7B, 0x40, 0x7B, 0x00, 0x48, 0xC0, 0x4B, 0xAD,
+0x7C, 0xC2, 0xEF, 0xFF, 0xD6, 0xF7, 0xFF, 0xFF, 0x08, 0xA6, 0xC0, 0xD7, 0xBD, 0x78, 0x7D, 0x78,
+0xC0, 0x9E, 0xF7, 0x71, 0x6C, 0x78, 0x4C, 0xC1, 0xBA, 0xDE, 0x75, 0xAD, 0x71, 0x09, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0xE0, 0x06, 0xC0, 0xBC, 0xFE, 0x65, 0xC3, 0xF9, 0xE5, 0x72, 0xA4, 0xD4, 0xBC,
+0x7B, 0xF6, 0x6A, 0xC1, 0x36, 0xC5, 0x5B, 0xF6, 0x65, 0xA9, 0x00, 0x6A, 0x51, 0x95, 0x6A, 0x65,
+0x51, 0x56, 0x60, 0x4A, 0xC0, 0xEF, 0xF7, 0x53, 0xC2, 0xC9, 0x7B, 0x09, 0x84, 0x2B, 0xA5, 0x7B,
+0xC0, 0x0B, 0xA5, 0x5D, 0x40, 0x7B, 0x40, 0x46, 0xC0, 0x8A, 0x8C, 0x68, 0x61, 0x68, 0x00, 0xC0,
+0x0D, 0xBE, 0x40, 0x7B, 0x01, 0xC0, 0x4D, 0xCE, 0x67, 0x7B, 0x48, 0x67, 0xC0, 0x4B, 0xAD, 0x73,
+0x7B, 0x0B, 0x5F, 0xC0, 0xCE, 0xD6, 0x01, 0x46, 0x63, 0x79, 0x40, 0x7B, 0x00, 0x67, 0x79, 0x92,
+0xAE, 0x46, 0x5E, 0x51, 0x48, 0x7B, 0x0A, 0x73, 0x7E, 0x01, 0x46, 0x53, 0x54, 0x40, 0x7B, 0x00,
+0x40, 0xC0, 0x88, 0x73, 0x50, 0x00, 0xC0, 0xE7, 0x5A, 0x52, 0xBE, 0xC0, 0x8F, 0xEF, 0x7B, 0xC1,
+0xD9, 0xFE, 0x7C, 0xFE, 0x65, 0x03, 0x91, 0x59, 0x60, 0x4A, 0x74, 0x5F, 0x7E, 0x01, 0xC0, 0x0F,
+0xE7, 0x4F, 0x5E, 0x41, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF, 0x08, 0xA6, 0xC0, 0x38, 0xC6, 0xA6, 0x65,
+0xBF, 0xC0, 0xBE, 0xF7, 0x71, 0x6C, 0x7D, 0x91, 0x7D, 0xC0, 0x9A, 0xD6, 0x71, 0x09, 0x70, 0x00,
+0x71, 0xE0, 0x06, 0xC0, 0xBC, 0xFE, 0x91, 0xC1, 0x2D, 0x7B, 0xB4, 0xB4, 0x91, 0xC1, 0x8F, 0x83,
+0x77, 0xCD, 0x45, 0xC1, 0x19, 0xEE, 0x9C, 0xFE, 0xA9, 0x6A, 0xC4, 0x77, 0xD5, 0x4E, 0x7B, 0x8F,
+0x8B, 0x11, 0x9C, 0x7B, 0xEE, 0x47, 0xC1, 0xF5, 0xBC, 0xBD, 0xFE, 0x4A, 0xC0, 0xEF, 0xF7, 0x42,
+0xC0, 0x0D, 0xC6, 0x7B, 0xC0, 0x4C, 0xAD, 0x63, 0xC2, 0x07, 0x63, 0x0D, 0xBE, 0xF0, 0xFF, 0x7B,
+0x01, 0x40, 0x00, 0x48, 0x00, 0xC0, 0xEE, 0xDE, 0x4B, 0x40, 0x7B, 0x00, 0x96, 0x75, 0x50, 0x48,
+0x40, 0xC1, 0x4B, 0xAD, 0x6A, 0x8C, 0x7B, 0x0B, 0x48, 0x54, 0x6E, 0x49, 0xA6, 0x49, 0xC1, 0x86,
+0x52, 0x6D, 0xCE, 0x40, 0x7B, 0x48, 0x53, 0xC0, 0xC7, 0x5A, 0x49, 0x44, 0x49, 0x61, 0x63, 0x48,
+0x7B, 0x0A, 0xC0, 0x2F, 0xE7, 0x40, 0x75, 0x44, 0x49, 0x54, 0xC0, 0x28, 0x63, 0x48, 0x7B, 0x00,
+0xAE, 0xC0, 0x4B, 0xA5, 0x63, 0x68, 0x63, 0x44, 0x99, 0x5F, 0x7B, 0xC2, 0xD9, 0xFE, 0x7C, 0xFE,
+0x1A, 0xEE, 0x80, 0x00, 0xBB, 0x5F, 0xC1, 0x93, 0xAC, 0x5B, 0xF6, 0x60, 0x4A, 0xC0, 0xCF, 0xF7,
+0x65, 0x68, 0x6D, 0xBA, 0x44, 0xC1, 0x2A, 0x84, 0x6E, 0xCE, 0x79, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF,
+0x08, 0xA6, 0x5C, 0x74, 0xC2, 0x96, 0xB5, 0x51, 0x8C, 0x3C, 0xE7, 0x71, 0x00, 0xC0, 0x1C, 0xE7,
+0x64, 0x4C, 0xC0, 0x79, 0xCE, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xA2, 0xA5, 0x28,
+0x67, 0x71, 0x12, 0xC0, 0xBC, 0xFE, 0x56, 0xC7, 0x6E, 0x83, 0x3A, 0xEE, 0xFD, 0xFE, 0xF9, 0xE5,
+0xAF, 0x8B, 0x6A, 0x5A, 0x5A, 0xF6, 0x9C, 0xFE, 0xA9, 0xC0, 0xDD, 0xFE, 0x6D, 0x47, 0x76, 0xC0,
+0x15, 0xC5, 0x6D, 0xC1, 0xAB, 0x62, 0xB3, 0xB4, 0x76, 0xC0, 0x35, 0xF7, 0x7E, 0xC0, 0x6C, 0xAD,
+0x53, 0x48, 0x00, 0xC3, 0xCE, 0xD6, 0xE9, 0x7B, 0xAE, 0xD6, 0xD0, 0xF7, 0xA6, 0x04, 0x48, 0x4B,
+0x4F, 0x48, 0x7B, 0x01, 0xC1, 0x2F, 0xE7, 0x2A, 0x8C, 0x49, 0xC1, 0x4A, 0x8C, 0xAA, 0x94, 0x73,
+0x7B, 0x0B, 0x40, 0x4B, 0xC0, 0x8E, 0xCE, 0x48, 0x01, 0xC0, 0x6D, 0xCE, 0x55, 0x7B, 0x00, 0x40,
+0xC1, 0xEE, 0xDE, 0x8C, 0xB5, 0x48, 0x01, 0x52, 0xC0, 0x6E, 0xCE, 0x40, 0x7B, 0x0A, 0x91, 0xC0,
+0x4C, 0xAD, 0x7B, 0x48, 0x00, 0x73, 0xC0, 0x2D, 0xC6, 0x7B, 0x02, 0x67, 0x73, 0xC0, 0xF1, 0xFF,
+0x52, 0x72, 0x46, 0x40, 0x7B, 0xC4, 0xD9, 0xFE, 0x9C, 0xFE, 0x52, 0xA4, 0xD4, 0xBC, 0x36, 0xCD,
+0x6F, 0xA5, 0xC0, 0x11, 0x9C, 0x51, 0x60, 0x4A, 0xC0, 0xAF, 0xF7, 0x67, 0x00, 0x48, 0x67, 0x77,
+0x71, 0x40, 0x91, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF, 0x09, 0xC2, 0xF7, 0xBD, 0x34, 0xA5, 0x71, 0x94,
+0x4C, 0xC0, 0xDF, 0xFF, 0x71, 0x00, 0xC3, 0x9A, 0xD6, 0xF3, 0x9C, 0x79, 0xCE, 0xDB, 0xDE, 0x71,
+0x09, 0x70, 0x00, 0x71, 0x05, 0xC1, 0xFD, 0xFE, 0x9B, 0xFE, 0x2A, 0x7B, 0x71, 0x11, 0xC0, 0xBC,
+0xFE, 0x5E, 0x43, 0xC1, 0x5A, 0xF6, 0xDC, 0xFE, 0x76, 0x65, 0x4F, 0xC0, 0x5B, 0xF6, 0x65, 0x5E,
+0x6A, 0xC0, 0x77, 0xD5, 0x95, 0x76, 0x00, 0x51, 0xC0, 0xF0, 0x93, 0x46, 0xC2, 0xBD, 0xFE, 0x35,
+0xF7, 0xEF, 0xF7, 0x75, 0xC1, 0x8E, 0xCE, 0xF0, 0xFF, 0x40, 0x48, 0xAB, 0x91, 0x73, 0x7B, 0x00,
+0x52, 0xC0, 0x8A, 0x94, 0x68, 0x00, 0x70, 0xC0, 0xA9, 0x73, 0x75, 0x48, 0x7B, 0x01, 0xC0, 0x2B,
+0xA5, 0x68, 0xC1, 0x26, 0x4A, 0xC7, 0x5A, 0x75, 0xC0, 0x0B, 0xA5, 0x7B, 0x0B, 0xAE, 0x70, 0xC0,
+0xCE, 0xD6, 0x48, 0x40, 0x00, 0x48, 0x7B, 0x73, 0x7B, 0x48, 0x7C, 0xC0, 0x4C, 0xAD, 0x48, 0x40,
+0x00, 0x48, 0x00, 0x73, 0x7B, 0x09, 0x40, 0xC0, 0xAE, 0xD6, 0x70, 0x48, 0x40, 0x01, 0x48, 0x73,
+0x7B, 0x01, 0xC0, 0x09, 0x84, 0x52, 0xA5, 0x4D, 0x56, 0xC0, 0x88, 0x73, 0x46, 0x40, 0xC1, 0xD9,
+0xFE, 0x9C, 0xFE, 0x5F, 0xC0, 0x7B, 0xF6, 0x6A, 0x00, 0x76, 0xC0, 0xF9, 0xE5, 0x56, 0x60, 0x4A,
+0x48, 0x44, 0x7F, 0xC0, 0xD0, 0xFF, 0x61, 0x49, 0xC0, 0xC9, 0x7B, 0x4B, 0xC2, 0xCF, 0xF7, 0xD6,
+0xF7, 0xFF, 0xFF, 0x09, 0xC0, 0xB6, 0xB5, 0x55, 0x54, 0xC0, 0x55, 0xAD, 0x6C, 0x71, 0xC0, 0x5D,
+0xEF, 0x64, 0xC0, 0x30, 0x84, 0xA6, 0x55, 0x71, 0x09, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1,
+0x5D, 0xFF, 0x7B, 0xFE, 0x00, 0x5E, 0x59, 0x26, 0x5E, 0x59, 0x00, 0xC0, 0x3D, 0xFF, 0x71, 0x10,
+0xC0, 0xBC, 0xFE, 0x65, 0xC0, 0xB3, 0xB4, 0x41, 0xC0, 0x77, 0xCD, 0xA6, 0xC1, 0xD0, 0x93, 0x52,
+0xA4, 0x59, 0x65, 0x5E, 0x6A, 0x43, 0xC1, 0x93, 0xAC, 0x5B, 0xF6, 0x76, 0x6E, 0xC3, 0x32, 0xA4,
+0xB8, 0xDD, 0x9D, 0xFE, 0x35, 0xF7, 0x48, 0x4F, 0x66, 0x68, 0xA6, 0x01, 0x52, 0xC0, 0xD0, 0xF7,
+0x7B, 0x00, 0xC2, 0x4F, 0xE7, 0x8C, 0xAD, 0xCE, 0xDE, 0x52, 0x00, 0xC1, 0xCD, 0xBD, 0xCE, 0xD6,
+0x40, 0x7B, 0x01, 0xC0, 0x2F, 0xE7, 0x52, 0x5F, 0x00, 0xC1, 0xEE, 0xDE, 0x2A, 0x84, 0x67, 0x7B,
+0x0A, 0x48, 0x42, 0x91, 0x68, 0x63, 0x01, 0x5A, 0x7B, 0x00, 0x48, 0xC2, 0xAC, 0xB5, 0xC7, 0x5A,
+0x8A, 0x94, 0x63, 0x00, 0x95, 0x53, 0xC0, 0xD0, 0xF7, 0x7B, 0x09, 0x40, 0x7E, 0xC0, 0xA7, 0x52,
+0x63, 0x68, 0x63, 0x54, 0xC0, 0x4B, 0xAD, 0x40, 0x7B, 0x01, 0x42, 0x4B, 0xC3, 0xE9, 0x83, 0x0B,
+0x9D, 0xF1, 0xFF, 0x09, 0x84, 0x58, 0x40, 0xC0, 0xD9, 0xFE, 0x60, 0x43, 0xC0, 0xB8, 0xDD, 0x6A,
+0x65, 0x5A, 0xC0, 0x35, 0xC5, 0x59, 0x60, 0xC0, 0x35, 0xF7, 0x48, 0x75, 0x49, 0xC0, 0x2B, 0xA5,
+0x42, 0xC0, 0xF1, 0xFF, 0x56, 0x49, 0xC1, 0xEF, 0xFF, 0xD6, 0xF7, 0x71, 0x0B, 0x44, 0xC1, 0x38,
+0xC6, 0x7D, 0xEF, 0x71, 0x5D, 0xC0, 0x1C, 0xE7, 0xAE, 0x70, 0x44, 0x71, 0x09, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC0, 0xFD, 0xFE, 0x59, 0xAE, 0x00, 0xAB, 0x76, 0xA9, 0x65, 0x5E, 0xAF, 0x65,
+0x5E, 0x65, 0x6A, 0x5E, 0x65, 0x00, 0x5E, 0x00, 0x6A, 0x76, 0x6A, 0x65, 0x5E, 0x15, 0x59, 0xC0,
+0xFC, 0xFE, 0x71, 0x10, 0x6A, 0x65, 0x59, 0x50, 0xC0, 0x29, 0x52, 0x00, 0xC0, 0x93, 0xAC, 0x6F,
+0x65, 0x5E, 0x00, 0x65, 0x95, 0xC1, 0xD4, 0xBC, 0xEC, 0x6A, 0x00, 0xC1, 0x6E, 0x83, 0x97, 0xD5,
+0x5E, 0x60, 0x4A, 0x48, 0xC0, 0x09, 0x84, 0x77, 0x5F, 0xA6, 0xA6, 0x96, 0xC0, 0x8F, 0xEF, 0xBF,
+0x00, 0x48, 0x77, 0xC0, 0xAA, 0x94, 0x48, 0x7B, 0x48, 0x58, 0x63, 0x48, 0x7B, 0x01, 0x6C, 0x67,
+0x00, 0x73, 0x5F, 0x61, 0x5F, 0x7B, 0x01, 0x48, 0x7B, 0x40, 0x00, 0x7B, 0x03, 0xC0, 0xF0, 0xF7,
+0x47, 0xC0, 0xED, 0xBD, 0x5F, 0x5A, 0x55, 0x52, 0x73, 0x7B, 0x00, 0x48, 0xC0, 0x8C, 0xAD, 0x63,
+0x67, 0x5A, 0x55, 0x4D, 0x5F, 0x7B, 0x02, 0x40, 0x02, 0x7B, 0xA6, 0x7B, 0x00, 0x40, 0xC1, 0xAE,
+0xD6, 0x88, 0x73, 0x5A, 0x01, 0x52, 0x5A, 0x7B, 0x01, 0x40, 0x52, 0xC0, 0xCB, 0x9C, 0x91, 0x4D,
+0x73, 0xC0, 0xCC, 0xB5, 0x6C, 0x7B, 0xC0, 0xD9, 0xFE, 0x65, 0xC1, 0x3A, 0xF6, 0xF5, 0xBC, 0x64,
+0x00, 0xC0, 0x15, 0xC5, 0x45, 0x65, 0x60, 0x4A, 0xC0, 0xCF, 0xF7, 0x67, 0xC2, 0x4B, 0xA5, 0x4A,
+0x8C, 0x6E, 0xCE, 0x76, 0x53, 0x52, 0x79, 0xC0, 0xD6, 0xF7, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x04, 0xC1, 0xFD, 0xFE, 0x7B, 0xFE, 0x5E, 0x65, 0x51, 0x78, 0xBF, 0xC0, 0x5A, 0xF6, 0x65,
+0xC1, 0x98, 0xD5, 0x3A, 0xEE, 0x65, 0x42, 0xC0, 0x77, 0xD5, 0x65, 0xC0, 0x1A, 0xEE, 0x95, 0x65,
+0x00, 0xC0, 0xD8, 0xDD, 0x47, 0xC0, 0x36, 0xCD, 0x5E, 0x65, 0x5E, 0x02, 0x65, 0x00, 0x5E, 0x0E,
+0x59, 0x74, 0x71, 0x10, 0xC0, 0xBC, 0xFE, 0x65, 0x64, 0x78, 0x56, 0xC0, 0x19, 0xE6, 0x64, 0x95,
+0x59, 0x65, 0x5E, 0x65, 0x6E, 0x50, 0x96, 0x64, 0x6D, 0x78, 0xC0, 0x5A, 0xEE, 0x65, 0xC0, 0x35,
+0xF7, 0x79, 0x4B, 0xC0, 0x4D, 0xC6, 0x4D, 0xA9, 0xAF, 0x40, 0x00, 0xA6, 0x00, 0xC3, 0xF0, 0xF7,
+0xEC, 0xBD, 0xE9, 0x7B, 0x90, 0xEF, 0x40, 0x00, 0xC0, 0x4B, 0xAD, 0x63, 0xC0, 0xF0, 0xFF, 0x7B,
+0x01, 0xC1, 0x2B, 0xA5, 0x2A, 0x84, 0x63, 0x00, 0x54, 0x47, 0x73, 0x7B, 0x01, 0x56, 0x47, 0xC0,
+0x6A, 0x8C, 0x7E, 0x73, 0xC0, 0xCA, 0x9C, 0x7B, 0x01, 0x40, 0xC0, 0xCD, 0xBD, 0x6C, 0xC0, 0xEE,
+0xDE, 0x00, 0x52, 0x40, 0x7B, 0x01, 0x40, 0xC0, 0xAE, 0xD6, 0x7F, 0x52, 0x46, 0x00, 0x73, 0x40,
+0x73, 0x7B, 0x00, 0x67, 0x52, 0x46, 0x00, 0xC0, 0x2F, 0xE7, 0x56, 0x77, 0x48, 0x7B, 0x00, 0x5A,
+0xC0, 0x8C, 0xB5, 0x46, 0x01, 0x62, 0x48, 0x7B, 0x01, 0x40, 0x52, 0x68, 0x63, 0x9A, 0x47, 0x4B,
+0x5D, 0x5A, 0xC0, 0xD9, 0xFE, 0x65, 0xC2, 0xB8, 0xDD, 0xD4, 0xBC, 0x36, 0xC5, 0xA5, 0x96, 0x5A,
+0x65, 0xA6, 0x4A, 0xC0, 0xCF, 0xF7, 0x92, 0xC1, 0xEB, 0x9C, 0x4A, 0x8C, 0x00, 0x47, 0x5E, 0xC0,
+0x8E, 0xCE, 0xBD, 0xC1, 0xD6, 0xFF, 0xFF, 0xFF, 0x1F, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xFD, 0xFE,
+0x59, 0x65, 0x95, 0xC0, 0x4E, 0x7B, 0x50, 0x00, 0xC0, 0x15, 0xC5, 0x65, 0xC0, 0x29, 0x52, 0x78,
+0x7B, 0xC1, 0x97, 0xD5, 0x86, 0x39, 0x6E, 0x5B, 0x64, 0xC0, 0xDD, 0xFE, 0x00, 0xC0, 0xB0, 0x8B,
+0x90, 0x51, 0xC0, 0x73, 0xAC, 0x76, 0xA0, 0x00, 0x65, 0x00, 0xC0, 0x1A, 0xEE, 0x56, 0x65, 0x5E,
+0x0D, 0xA6, 0xC0, 0xFC, 0xFE, 0x71, 0x10, 0x6A, 0x59, 0x00, 0x69, 0xC0, 0x19, 0xE6, 0x6A, 0x4B,
+0xC1, 0xF0, 0x93, 0x5B, 0xF6, 0x65, 0x5E, 0x6A, 0x5B, 0x63, 0x76, 0xAE, 0x59, 0xC0, 0xD4, 0xB4,
+0x5A, 0x65, 0x4A, 0x79, 0x58, 0x68, 0xBE, 0x00, 0x92, 0x54, 0xC1, 0x2F, 0xE7, 0xB0, 0xF7, 0x02,
+0xC1, 0x4B, 0xAD, 0x09, 0x84, 0x63, 0x4F, 0x75, 0xC0, 0x4F, 0xE7, 0x7B, 0x01, 0x40, 0x77, 0x7E,
+0x7B, 0x9A, 0x46, 0x7F, 0x7B, 0x00, 0x40, 0xC0, 0xAE, 0xD6, 0x61, 0x67, 0xC0, 0x6D, 0xCE, 0x54,
+0x75, 0x61, 0x7B, 0x01, 0x40, 0xC0, 0x0D, 0xBE, 0x68, 0x70, 0x00, 0x63, 0x00, 0x62, 0x7B, 0x00,
+0x40, 0x46, 0x75, 0x70, 0x01, 0x47, 0x65, 0x40, 0x7B, 0x48, 0xC1, 0x8C, 0xAD, 0x07, 0x63, 0x75,
+0x70, 0x75, 0xC0, 0xC7, 0x5A, 0x4E, 0x48, 0x7B, 0x00, 0x67, 0x4E, 0x70, 0x01, 0x47, 0x6F, 0xC0,
+0xD0, 0xF7, 0x7B, 0x01, 0xC0, 0xC9, 0x7B, 0x53, 0x7B, 0x00, 0x62, 0x66, 0x47, 0xC1, 0x90, 0xEF,
+0xDA, 0xFE, 0x60, 0xC1, 0x36, 0xC5, 0x5A, 0xF6, 0x6A, 0x00, 0xC0, 0x3A, 0xEE, 0x43, 0x56, 0x60,
+0xC0, 0x35, 0xF7, 0x48, 0x75, 0x49, 0x7B, 0x01, 0x70, 0x4D, 0xC0, 0x0E, 0xDF, 0x6D, 0x71, 0x1F,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xFD, 0xFE, 0x59, 0x6A, 0x6F, 0xC0, 0x8F, 0x8B, 0x7B,
+0xA5, 0x6A, 0xC1, 0x56, 0xCD, 0x4E, 0x7B, 0x41, 0x76, 0xC1, 0x98, 0xD5, 0x8A, 0x5A, 0x64, 0xC0,
+0x35, 0xC5, 0x64, 0x76, 0x6A, 0x41, 0x77, 0x91, 0x55, 0xC0, 0x36, 0xC5, 0x77, 0xC1, 0x19, 0xE6,
+0x93, 0xB4, 0x00, 0x51, 0xC0, 0x73, 0xAC, 0x6A, 0xA5, 0x0D, 0x59, 0x74, 0x71, 0x10, 0x6A, 0x00,
+0x55, 0xC0, 0xAF, 0x8B, 0x96, 0x51, 0xC2, 0x11, 0x9C, 0x97, 0xD5, 0x9C, 0xFE, 0x5E, 0x00, 0x76,
+0x50, 0xC1, 0x93, 0xAC, 0x5A, 0xEE, 0x7D, 0x00, 0xC0, 0x5A, 0xF6, 0x56, 0x60, 0xC1, 0x35, 0xF7,
+0xAF, 0xEF, 0x40, 0xBF, 0x48, 0x00, 0x4F, 0xC1, 0x4A, 0x8C, 0x6C, 0xAD, 0x48, 0x92, 0x00, 0x40,
+0x67, 0xC0, 0xED, 0xBD, 0x79, 0x00, 0xC0, 0x4B, 0xAD, 0x4B, 0x40, 0x7B, 0x00, 0x5A, 0xC0, 0x88,
+0x73, 0x7B, 0x00, 0x40, 0x7B, 0xC1, 0xA8, 0x73, 0x0F, 0xDF, 0x7B, 0x00, 0x5F, 0xC0, 0xCB, 0x9C,
+0x7B, 0x4F, 0x48, 0xC1, 0x0B, 0xA5, 0x09, 0x84, 0x40, 0x7B, 0x00, 0x96, 0x48, 0xAB, 0x48, 0x00,
+0x4F, 0xC0, 0x09, 0x84, 0x7C, 0x48, 0x7B, 0x73, 0x40, 0x48, 0x01, 0xAB, 0xC1, 0xCD, 0xBD, 0xE9,
+0x7B, 0x48, 0x7B, 0x40, 0x79, 0x7F, 0x4F, 0x48, 0x4F, 0x79, 0x92, 0x40, 0x7B, 0x01, 0x48, 0x01,
+0x4F, 0xC1, 0x0F, 0xE7, 0x48, 0x6B, 0x73, 0x7B, 0x00, 0x40, 0x47, 0xC1, 0x8C, 0xB5, 0x8F, 0xEF,
+0x73, 0xC0, 0xEE, 0xDE, 0x6E, 0x7E, 0x40, 0xC0, 0xD9, 0xFE, 0x60, 0x78, 0xC1, 0x19, 0xEE, 0x5A,
+0xF6, 0xA6, 0xAF, 0x56, 0xBE, 0x60, 0xC0, 0x35, 0xF7, 0x48, 0x49, 0x75, 0x67, 0x7B, 0x5F, 0x54,
+0xC0, 0xAC, 0xB5, 0x48, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF, 0x1F, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xFD,
+0xFE, 0x59, 0xC0, 0xDC, 0xFE, 0x78, 0x64, 0xC0, 0xDD, 0xFE, 0x5E, 0x76, 0x50, 0xC1, 0x56, 0xCD,
+0xD0, 0x93, 0x42, 0xC0, 0x77, 0xD5, 0x41, 0x7C, 0xC0, 0x72, 0xAC, 0xAB, 0x76, 0x00, 0x7C, 0xC0,
+0xCB, 0x6A, 0x92, 0xC1, 0x36, 0xCD, 0xB3, 0xB4, 0x5B, 0xC0, 0xF9, 0xE5, 0x41, 0xC0, 0x4E, 0x83,
+0x72, 0x59, 0x65, 0x5E, 0x0D, 0x59, 0x74, 0x71, 0x10, 0xC0, 0xBC, 0xFE, 0x59, 0xC1, 0xEC, 0x6A,
+0x97, 0xD5, 0x78, 0xC1, 0xCC, 0x6A, 0x19, 0xE6, 0xA6, 0x59, 0x5E, 0x00, 0x76, 0x50, 0xC0, 0xAB,
+0x62, 0x7C, 0x6D, 0xAB, 0xA5, 0xC1, 0xB8, 0xDD, 0x9D, 0xFE, 0x4A, 0xC0, 0xCF, 0xF7, 0x53, 0x75,
+0x4E, 0xBA, 0x44, 0x47, 0xC1, 0xEE, 0xDE, 0xD0, 0xF7, 0xA6, 0x40, 0xC1, 0xEF, 0xDE, 0xA8, 0x73,
+0x44, 0xC3, 0x88, 0x73, 0x29, 0x84, 0x8C, 0xB5, 0x2F, 0xE7, 0x7B, 0x01, 0x95, 0x73, 0x7F, 0x67,
+0x00, 0xC0, 0x0D, 0xBE, 0x6E, 0x67, 0x7B, 0x00, 0x96, 0xC0, 0x4D, 0xCE, 0x50, 0x53, 0x5D, 0xBF,
+0x00, 0x7B, 0x01, 0x40, 0xC0, 0xED, 0xBD, 0x75, 0x4E, 0x51, 0x44, 0x47, 0x52, 0x40, 0x7B, 0x40,
+0x46, 0xC0, 0xCB, 0x94, 0x49, 0x51, 0x4E, 0x47, 0x7F, 0x40, 0x7B, 0x00, 0x5A, 0x58, 0x50, 0x58,
+0x60, 0x58, 0x5A, 0x7B, 0x01, 0x67, 0x51, 0x49, 0x51, 0x00, 0x54, 0x49, 0x40, 0x7B, 0x01, 0x67,
+0x44, 0x63, 0x01, 0x60, 0x40, 0x7B, 0xC1, 0xD9, 0xFE, 0x7C, 0xFE, 0x64, 0xC0, 0xB3, 0xB4, 0xBF,
+0x01, 0xC0, 0x15, 0xC5, 0x59, 0x60, 0x4A, 0xC0, 0xAF, 0xF7, 0x7B, 0xC1, 0x4B, 0xAD, 0x4A, 0x8C,
+0x01, 0xC1, 0xAC, 0xB5, 0xD0, 0xF7, 0x95, 0xC1, 0xD6, 0xF7, 0xFF, 0xFF, 0x1F, 0x70, 0x00, 0x71,
+0x04, 0xC0, 0xFD, 0xFE, 0x59, 0xC0, 0xBC, 0xFE, 0x5B, 0xC0, 0xF0, 0x93, 0x7B, 0x6A, 0x65, 0xC8,
+0xAB, 0x62, 0x4E, 0x7B, 0x49, 0x52, 0x36, 0xC5, 0xB8, 0xDD, 0x32, 0xA4, 0x15, 0xC5, 0xAB, 0x62,
+0xB3, 0xB4, 0x76, 0x6A, 0x41, 0xC1, 0x97, 0xD5, 0xF9, 0xE5, 0x68, 0x78, 0x6F, 0x6E, 0xC1, 0x11,
+0x9C, 0xD8, 0xDD, 0x51, 0x50, 0x65, 0x00, 0xA9, 0x0C, 0x59, 0xC0, 0xFC, 0xFE, 0x71, 0x10, 0x6A,
+0x65, 0xC0, 0x73, 0xAC, 0x7C, 0x41, 0x7C, 0x41, 0x64, 0x59, 0x65, 0x5E, 0x6A, 0x64, 0x5B, 0x7B,
+0x6A, 0x02, 0x60, 0x4A, 0xC5, 0xAF, 0xF7, 0x2F, 0xE7, 0xED, 0xBD, 0xCA, 0x94, 0x6A, 0x8C, 0x2B,
+0xA5, 0x67, 0x48, 0xC0, 0x90, 0xEF, 0xBE, 0x48, 0xC1, 0xCC, 0xB5, 0x88, 0x73, 0x4D, 0xC1, 0x28,
+0x6B, 0x0B, 0xA5, 0x7E, 0x5A, 0x7B, 0x01, 0xAE, 0x52, 0xC1, 0xCA, 0x9C, 0x4A, 0x8C, 0x00, 0x75,
+0x52, 0x40, 0x7B, 0x00, 0x95, 0xC0, 0xAC, 0xB5, 0x96, 0x51, 0xC1, 0xA9, 0x7B, 0x26, 0x4A, 0x54,
+0x40, 0x7B, 0x01, 0x52, 0x7F, 0x75, 0xA6, 0xC0, 0x4B, 0xAD, 0x73, 0x40, 0x73, 0x7B, 0x00, 0x67,
+0x5D, 0x51, 0xC0, 0x8A, 0x8C, 0x44, 0x7E, 0x48, 0x73, 0x7B, 0x40, 0x7E, 0xC0, 0x6C, 0xAD, 0x6F,
+0x75, 0xC0, 0x07, 0x63, 0x5A, 0x58, 0xC0, 0xD0, 0xFF, 0x7B, 0x00, 0x73, 0xC0, 0x8E, 0xD6, 0x5E,
+0x70, 0x75, 0x58, 0x48, 0x7B, 0x01, 0x40, 0x7F, 0x51, 0xC0, 0x4B, 0xA5, 0x51, 0xC0, 0x4C, 0xAD,
+0x6A, 0x67, 0x7B, 0xC0, 0xD9, 0xFE, 0x60, 0xC2, 0xB4, 0xB4, 0x5B, 0xF6, 0xBC, 0xFE, 0xA6, 0x00,
+0x6A, 0x65, 0x60, 0x4A, 0x79, 0xC0, 0x6D, 0xCE, 0x49, 0x5E, 0x92, 0x5E, 0x00, 0x46, 0xC1, 0xAF,
+0xF7, 0xD6, 0xF7, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC0, 0xFD, 0xFE, 0x59, 0xAF,
+0x42, 0xC1, 0xEC, 0x72, 0xF5, 0xBC, 0xBE, 0x50, 0xC1, 0x8F, 0x83, 0x3A, 0xE6, 0x5B, 0xC1, 0xD0,
+0x93, 0x97, 0xD5, 0x7C, 0xC2, 0x9C, 0xFE, 0xC7, 0x41, 0x31, 0x9C, 0x76, 0x00, 0xC0, 0xAF, 0x8B,
+0x50, 0x64, 0xC0, 0xB0, 0x8B, 0x63, 0x41, 0x55, 0xC1, 0x6E, 0x83, 0xB8, 0xDD, 0x91, 0xC1, 0x0D,
+0x73, 0x7B, 0xF6, 0x65, 0xA9, 0x0C, 0xA6, 0xC1, 0xFC, 0xFE, 0xFF, 0xFF, 0x10, 0xC0, 0xBC, 0xFE,
+0x65, 0xC1, 0xB3, 0xB4, 0xF9, 0xE5, 0x7B, 0x00, 0xC1, 0x5B, 0xF6, 0x73, 0xAC, 0x56, 0x65, 0x5E,
+0x6A, 0x5B, 0x78, 0x6A, 0x65, 0x00, 0x73, 0x5A, 0xC0, 0x9D, 0xFE, 0x4A, 0x79, 0xC1, 0x6E, 0xCE,
+0xE9, 0x7B, 0x44, 0xC0, 0x2B, 0xA5, 0x68, 0xA6, 0xC1, 0x4F, 0xEF, 0xB0, 0xF7, 0x00, 0xAE, 0xC0,
+0xEE, 0xDE, 0x75, 0x44, 0x75, 0x44, 0x63, 0xC0, 0x4C, 0xAD, 0x48, 0x7B, 0x01, 0x46, 0xC0, 0x4B,
+0xAD, 0x58, 0x56, 0xC1, 0x8A, 0x94, 0x8E, 0xCE, 0x40, 0x7B, 0x01, 0x52, 0xC0, 0x4B, 0xA5, 0x70,
+0x56, 0x7E, 0x40, 0x7B, 0x01, 0x40, 0x5D, 0x47, 0x49, 0x56, 0x63, 0x68, 0x67, 0x7B, 0x01, 0xC0,
+0x4F, 0xE7, 0x54, 0x70, 0x56, 0x44, 0xC0, 0xC9, 0x7B, 0x71, 0x40, 0x7B, 0x00, 0x96, 0x5D, 0x44,
+0x75, 0xC0, 0xCC, 0xBD, 0x5F, 0x40, 0x7B, 0x02, 0x44, 0x54, 0x56, 0x4E, 0x47, 0xC0, 0xCC, 0xB5,
+0x40, 0x7B, 0x00, 0x40, 0x56, 0xC1, 0x27, 0x63, 0xA8, 0x73, 0x75, 0x72, 0x53, 0x67, 0x7B, 0xC2,
+0xD9, 0xFE, 0x9C, 0xFE, 0x15, 0xC5, 0x6E, 0x65, 0x00, 0x90, 0xC1, 0x36, 0xC5, 0x7B, 0xF6, 0x60,
+0xC0, 0x35, 0xF7, 0x79, 0x53, 0xC1, 0x28, 0x63, 0x88, 0x73, 0x68, 0xC5, 0x6C, 0xAD, 0xEC, 0xBD,
+0x2F, 0xE7, 0xAF, 0xF7, 0xD6, 0xF7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1,
+0xFD, 0xFE, 0x7B, 0xFE, 0xAE, 0xAF, 0xC0, 0xB8, 0xDD, 0x6D, 0xC2, 0xF1, 0x9B, 0xF5, 0xBC, 0x98,
+0xD5, 0x76, 0x56, 0x63, 0xC1, 0xF9, 0xE5, 0x56, 0xCD, 0x6A, 0x5B, 0x77, 0x6A, 0x00, 0x6F, 0xC0,
+0xD0, 0x93, 0x55, 0xC0, 0x1A, 0xEE, 0x59, 0x50, 0xBF, 0xC1, 0x77, 0xCD, 0xB4, 0xB4, 0x6D, 0x77,
+0x6A, 0x5E, 0x0D, 0x59, 0xC0, 0xFC, 0xFE, 0x71, 0x10, 0x6A, 0xC1, 0x3A, 0xEE, 0xEC, 0x72, 0x65,
+0x6A, 0x00, 0x76, 0xC0, 0x2D, 0x7B, 0x5A, 0x65, 0x5E, 0x76, 0x6D, 0x6F, 0x7B, 0x6A, 0xC1, 0x1E,
+0xFF, 0x73, 0xAC, 0x55, 0x76, 0x4A, 0xC3, 0xEF, 0xF7, 0xA9, 0x7B, 0x6D, 0xCE, 0xF1, 0xFF, 0x01,
+0x68, 0x72, 0x48, 0x92, 0x96, 0x40, 0x4F, 0x02, 0xC0, 0x8E, 0xCE, 0x68, 0x48, 0x7B, 0x01, 0xC3,
+0xC9, 0x7B, 0xAC, 0xB5, 0xA8, 0x73, 0x0B, 0xA5, 0x6C, 0xC1, 0x88, 0x73, 0x8F, 0xEF, 0x7B, 0x00,
+0x67, 0xC0, 0x28, 0x63, 0x91, 0x68, 0x4E, 0x75, 0xC0, 0x6C, 0xAD, 0x7B, 0x01, 0x40, 0x6E, 0xC0,
+0xAE, 0xD6, 0x4F, 0x01, 0xC0, 0x09, 0x84, 0x7F, 0x48, 0x7B, 0x48, 0x51, 0x91, 0xC0, 0xF1, 0xFF,
+0x01, 0xC1, 0xED, 0xBD, 0x09, 0x84, 0x48, 0x7B, 0xC0, 0xF0, 0xF7, 0x4B, 0xC0, 0x46, 0x4A, 0x73,
+0xC0, 0xCB, 0x9C, 0x49, 0xC1, 0x8A, 0x94, 0x8E, 0xD6, 0x40, 0x7B, 0x40, 0xC2, 0x4D, 0xCE, 0xA9,
+0x73, 0xF1, 0xFF, 0x01, 0xC0, 0x2F, 0xE7, 0x66, 0xC0, 0x90, 0xEF, 0x7B, 0x00, 0x73, 0x4F, 0x73,
+0x4B, 0x42, 0xAE, 0x48, 0x40, 0x7B, 0xC3, 0xD9, 0xFE, 0x5B, 0xF6, 0x72, 0xAC, 0x9C, 0xFE, 0xAE,
+0x65, 0x6A, 0x78, 0xC0, 0x19, 0xE6, 0x65, 0x4A, 0xC0, 0xAF, 0xEF, 0x48, 0x40, 0x60, 0xC0, 0x4A,
+0x8C, 0x61, 0xC0, 0x4F, 0xE7, 0x48, 0xC2, 0x8F, 0xEF, 0xD6, 0xF7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x04, 0xC1, 0xFD, 0xFE, 0x7B, 0xFE, 0x5E, 0x00, 0xAF, 0x76, 0x6A, 0x01, 0x59,
+0x65, 0x6A, 0x65, 0x6A, 0x59, 0xC0, 0xDC, 0xFE, 0x6A, 0x59, 0x00, 0x6A, 0x76, 0x00, 0x65, 0x00,
+0x76, 0x00, 0x6A, 0x00, 0x6F, 0x6A, 0x5E, 0x0E, 0x59, 0xC0, 0xFC, 0xFE, 0x71, 0x10, 0x6A, 0x65,
+0x7C, 0x41, 0xC0, 0x97, 0xD5, 0x00, 0xC1, 0x72, 0xA4, 0x6E, 0x83, 0x56, 0x65, 0x5E, 0x6A, 0xC3,
+0x15, 0xC5, 0x4D, 0x7B, 0x36, 0xC5, 0xB8, 0xD5, 0x63, 0xC3, 0x2D, 0x7B, 0x77, 0xD5, 0x9D, 0xFE,
+0x35, 0xF7, 0x7E, 0xC1, 0x2B, 0xA5, 0x09, 0x84, 0x58, 0xC0, 0x8E, 0xCE, 0x77, 0x6E, 0xC0, 0xCE,
+0xD6, 0x40, 0xA6, 0x00, 0xC0, 0x2F, 0xE7, 0x72, 0x01, 0x77, 0xC0, 0x2A, 0x84, 0x4F, 0x48, 0x7B,
+0x00, 0x67, 0xC1, 0x28, 0x63, 0xCC, 0xB5, 0x66, 0xC0, 0x8A, 0x94, 0x7C, 0x4D, 0x67, 0x7B, 0x00,
+0x67, 0x72, 0x81, 0x56, 0xA6, 0x49, 0x77, 0x7B, 0x01, 0xC0, 0xF0, 0xF7, 0x49, 0x54, 0x58, 0x71,
+0xC2, 0x8C, 0xAD, 0xA8, 0x73, 0xEE, 0xDE, 0x40, 0x7B, 0x40, 0xC0, 0x6E, 0xCE, 0x6E, 0x7C, 0x71,
+0x53, 0x42, 0x72, 0x48, 0x7B, 0x40, 0x7E, 0x5B, 0x00, 0x56, 0x51, 0x49, 0x7E, 0x40, 0x7B, 0x00,
+0x5F, 0xC0, 0xA9, 0x7B, 0x56, 0x6C, 0x60, 0x68, 0x70, 0x40, 0x7B, 0x00, 0x40, 0x44, 0xC0, 0xA7,
+0x5A, 0x66, 0x70, 0xC0, 0x6C, 0xAD, 0x77, 0x67, 0xC1, 0xB0, 0xF7, 0xD9, 0xFE, 0x65, 0xC0, 0xF4,
+0xBC, 0xAB, 0xC0, 0xF9, 0xE5, 0x00, 0xC2, 0x36, 0xCD, 0xB3, 0xB4, 0x7B, 0xF6, 0xBB, 0x4A, 0x45,
+0xC1, 0xEC, 0xBD, 0xA7, 0x5A, 0x61, 0xC1, 0x4A, 0x8C, 0x4B, 0xAD, 0x6F, 0xC3, 0x0F, 0xDF, 0xAF,
+0xF7, 0xD6, 0xF7, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0xC1, 0xFD, 0xFE, 0x7B,
+0xFE, 0xAE, 0x03, 0xAF, 0x65, 0x01, 0x5E, 0x03, 0x65, 0x6A, 0x65, 0x5E, 0x65, 0x5E, 0x65, 0x5E,
+0x65, 0x5E, 0x01, 0x65, 0x5E, 0x65, 0x00, 0x5E, 0x0C, 0x59, 0xC0, 0xFC, 0xFE, 0x71, 0x10, 0xC0,
+0xDC, 0xFE, 0x59, 0x00, 0xC0, 0xD4, 0xBC, 0x41, 0x00, 0x78, 0xC0, 0x5A, 0xF6, 0x65, 0x5E, 0x01,
+0x6A, 0xC0, 0x77, 0xD5, 0x50, 0x41, 0xC1, 0x31, 0xA4, 0xB8, 0xDD, 0x6A, 0x60, 0xC1, 0x78, 0xFF,
+0xAF, 0xF7, 0xAF, 0xC0, 0x0D, 0xBE, 0x75, 0x68, 0x49, 0xC0, 0xEE, 0xDE, 0x40, 0xA6, 0x01, 0xC1,
+0x2F, 0xE7, 0x6C, 0xAD, 0xAE, 0x01, 0x6A, 0xC0, 0x8E, 0xCE, 0x40, 0x7B, 0x01, 0x50, 0x6A, 0xBE,
+0x6F, 0x6A, 0xC0, 0xED, 0xBD, 0x7B, 0x01, 0x95, 0x7C, 0x6F, 0x72, 0x00, 0x6A, 0x53, 0x7B, 0x03,
+0x4B, 0xC0, 0x8A, 0x94, 0x68, 0x4E, 0x46, 0x40, 0x7B, 0x01, 0x40, 0x79, 0xC0, 0xCB, 0x9C, 0x68,
+0x75, 0xC0, 0x2D, 0xC6, 0x40, 0x7B, 0x01, 0x46, 0x6A, 0x72, 0x01, 0x6A, 0x46, 0x40, 0x7B, 0x00,
+0x40, 0x5A, 0xC0, 0x2B, 0xA5, 0x68, 0x70, 0x77, 0x7B, 0x03, 0x53, 0xC0, 0x4C, 0xAD, 0x7F, 0x77,
+0x72, 0x00, 0x67, 0xC1, 0xD1, 0xF7, 0xFB, 0xFE, 0x60, 0x59, 0xC0, 0x77, 0xD5, 0x5B, 0x00, 0xC2,
+0x56, 0xCD, 0x5B, 0xF6, 0x9C, 0xFE, 0x60, 0xC3, 0x77, 0xF7, 0xCF, 0xF7, 0x8E, 0xD6, 0x4B, 0xA5,
+0x7C, 0x00, 0x72, 0x6A, 0x52, 0xC2, 0xAF, 0xF7, 0xD8, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0xC0, 0xFD, 0xFE, 0x59, 0x5E, 0x03, 0xC0, 0xD9, 0xE5, 0x99, 0x4A, 0x96, 0xC0,
+0xBC, 0xFE, 0x65, 0x01, 0x6A, 0x51, 0xC1, 0x98, 0xD5, 0x7B, 0xF6, 0x5E, 0x4A, 0x5E, 0x42, 0x59,
+0x4A, 0x65, 0x5E, 0x65, 0x01, 0x56, 0x4A, 0x65, 0x5E, 0x0B, 0x59, 0xC0, 0xFC, 0xFE, 0x71, 0x10,
+0xC0, 0x9E, 0xFF, 0x65, 0x59, 0x6A, 0x02, 0x65, 0x59, 0x03, 0x65, 0x6A, 0x01, 0x65, 0x59, 0xC3,
+0x1D, 0xFF, 0xFE, 0xFF, 0xB3, 0xF7, 0xAF, 0xEF, 0x79, 0x48, 0x79, 0x48, 0x79, 0x6C, 0x02, 0xBE,
+0x48, 0x03, 0x79, 0x6C, 0x01, 0x71, 0xC0, 0xEF, 0xF7, 0x48, 0x02, 0xA9, 0x71, 0x6C, 0x00, 0x74,
+0x41, 0x48, 0x02, 0x79, 0x6C, 0x02, 0x74, 0x7E, 0x48, 0x79, 0x48, 0x74, 0x6C, 0x03, 0x79, 0x48,
+0x79, 0x48, 0x79, 0x71, 0x6C, 0x01, 0x74, 0x48, 0x03, 0x74, 0x6C, 0x02, 0x74, 0x48, 0x7E, 0x41,
+0x00, 0x74, 0x6C, 0x02, 0x79, 0x48, 0x02, 0x41, 0x74, 0xC2, 0xD8, 0xFF, 0xBF, 0xFF, 0xBC, 0xFE,
+0x59, 0x65, 0x02, 0x59, 0x00, 0x40, 0xC0, 0xFE, 0xFF, 0x50, 0x79, 0x48, 0x03, 0x74, 0x50, 0x6A,
+0xAB, 0x1F, 0x70, 0x00, 0x71, 0x04, 0xC0, 0xFD, 0xFE, 0x59, 0x5E, 0x01, 0x65, 0x42, 0xC1, 0xAF,
+0x8B, 0x36, 0xC5, 0x46, 0xC0, 0x15, 0xC5, 0x42, 0x4A, 0x00, 0x65, 0xC1, 0x1A, 0xEE, 0x11, 0x9C,
+0x64, 0xC0, 0xB8, 0xDD, 0x6E, 0xC0, 0x6E, 0x83, 0x51, 0xC0, 0x2D, 0x7B, 0x5A, 0xC1, 0xB4, 0xB4,
+0xBC, 0xFE, 0x00, 0x6F, 0x91, 0x76, 0x55, 0x4C, 0x6A, 0x5E, 0x0B, 0xA6, 0xC0, 0xFC, 0xFE, 0x71,
+0x11, 0x67, 0xC0, 0x5E, 0xFF, 0xA9, 0x51, 0x00, 0x4A, 0x06, 0x51, 0x00, 0x4A, 0x00, 0xC0, 0x9E,
+0xFF, 0x71, 0x01, 0xC0, 0xDA, 0xFF, 0xA8, 0xE0, 0x15, 0xC0, 0xFC, 0xFF, 0x71, 0x00, 0xA6, 0xC0,
+0x7E, 0xFF, 0x4A, 0x00, 0x51, 0x4A, 0x00, 0x5B, 0x71, 0x01, 0x49, 0x7B, 0x03, 0x49, 0x71, 0x21,
+0x70, 0x00, 0x71, 0x04, 0xC0, 0xFD, 0xFE, 0x59, 0x5E, 0x01, 0x65, 0x42, 0xC0, 0x6E, 0x83, 0x43,
+0x5A, 0x50, 0x00, 0x64, 0x43, 0xC0, 0x32, 0xA4, 0x50, 0x4C, 0x7B, 0x6A, 0x6F, 0xC1, 0xF0, 0x93,
+0x97, 0xD5, 0x59, 0xC0, 0x72, 0xAC, 0x78, 0x6A, 0xAE, 0xC0, 0xB3, 0xB4, 0x55, 0x6E, 0x50, 0xC0,
+0x36, 0xC5, 0x6A, 0x5E, 0x0B, 0xA6, 0x74, 0x71, 0xE0, 0x76, 0x70, 0x00, 0x71, 0x04, 0x7B, 0x59,
+0x5E, 0x01, 0x65, 0x7D, 0xC1, 0xD0, 0x8B, 0xF9, 0xDD, 0x5A, 0xC0, 0x2D, 0x73, 0x50, 0x40, 0x7D,
+0xC0, 0xCC, 0x6A, 0x4F, 0x47, 0x7B, 0x6A, 0xC1, 0xD0, 0x93, 0x6E, 0x83, 0x55, 0x78, 0x41, 0x50,
+0x6A, 0x00, 0x6F, 0x5A, 0x47, 0x45, 0x50, 0x6A, 0x65, 0x5E, 0x0A, 0xA6, 0x74, 0x71, 0x11, 0x5B,
+0xC0, 0xFB, 0xFE, 0xA6, 0xE0, 0x3D, 0xC0, 0x1C, 0xFF, 0x71, 0x21, 0x70, 0x00, 0x71, 0x04, 0x7B,
+0x59, 0x5E, 0x01, 0x65, 0x7D, 0x78, 0x7B, 0x5A, 0xC0, 0x31, 0xA4, 0x64, 0x77, 0x6F, 0xC0, 0x72,
+0xA4, 0x4F, 0x58, 0x5F, 0xC0, 0xF5, 0xBC, 0x78, 0xC1, 0xD9, 0xDD, 0xF1, 0x9B, 0x47, 0x5B, 0xC0,
+0xAF, 0x8B, 0x7B, 0x76, 0xC0, 0x97, 0xD5, 0x58, 0xC0, 0x3A, 0xEE, 0x4C, 0x78, 0x6A, 0x5E, 0x0B,
+0x59, 0x74, 0x71, 0x10, 0x4A, 0xC1, 0x96, 0xFD, 0x35, 0xFD, 0xE0, 0x3F, 0xC1, 0x18, 0xFE, 0xDF,
+0xFF, 0x71, 0x1F, 0x70, 0x00, 0x71, 0x04, 0x7B, 0x59, 0x5E, 0x02, 0x59, 0x9A, 0x65, 0x59, 0x00,
+0x6E, 0x00, 0xC0, 0x5B, 0xF6, 0x65, 0x56, 0x51, 0x5A, 0xC0, 0x5A, 0xF6, 0x59, 0x6A, 0x51, 0x00,
+0x5E, 0x4A, 0x5A, 0x00, 0x4A, 0x92, 0x5E, 0x65, 0x59, 0x5E, 0x0C, 0x59, 0x74, 0x71, 0x10, 0xC1,
+0xF7, 0xFD, 0x35, 0xFD, 0x53, 0xAE, 0x53, 0x02, 0xA5, 0x01, 0xA6, 0x53, 0x58, 0x53, 0x02, 0xA6,
+0x47, 0x00, 0x42, 0x53, 0x58, 0x53, 0x02, 0x47, 0x02, 0x4E, 0x58, 0x53, 0x02, 0x4E, 0x47, 0x02,
+0x58, 0x00, 0x53, 0x02, 0x47, 0x02, 0x58, 0x00, 0x53, 0x02, 0x47, 0x01, 0x42, 0x53, 0x58, 0x53,
+0x02, 0x47, 0x02, 0x4E, 0x58, 0x53, 0x02, 0x4E, 0x47, 0x00, 0x42, 0x4E, 0x58, 0x53, 0x02, 0x4E,
+0x47, 0x02, 0x58, 0x00, 0x53, 0x02, 0x47, 0x02, 0x53, 0x58, 0x53, 0x02, 0x47, 0x02, 0x53, 0x58,
+0x53, 0x02, 0x47, 0x01, 0x42, 0x53, 0x58, 0x53, 0x02, 0x47, 0x7D, 0x68, 0x71, 0x1F, 0x70, 0x00,
+0x71, 0x04, 0x7B, 0x59, 0x5E, 0x02, 0x65, 0x6A, 0x59, 0x65, 0x6A, 0x00, 0x65, 0x03, 0x6A, 0x65,
+0x00, 0x5E, 0x65, 0x01, 0x56, 0x5B, 0x4F, 0xC0, 0x1A, 0xEE, 0x6A, 0x5E, 0x65, 0x00, 0x5E, 0x0C,
+0x59, 0x74, 0x71, 0x0F, 0x6C, 0x53, 0x47, 0xC2, 0x4D, 0x93, 0xCB, 0x7A, 0x6D, 0x9B, 0xAF, 0x5B,
+0xBF, 0xC0, 0x55, 0xF5, 0x47, 0x00, 0xAF, 0xC2, 0x31, 0xC4, 0x8A, 0x72, 0x4D, 0x93, 0x67, 0x00,
+0x53, 0xC0, 0xD3, 0xDC, 0x4E, 0x47, 0xAF, 0xC2, 0xEF, 0xB3, 0xAA, 0x72, 0x4D, 0x93, 0x67, 0xA6,
+0x53, 0xC0, 0x14, 0xE5, 0x4E, 0x47, 0x4E, 0x54, 0x59, 0xC0, 0x2C, 0x8B, 0x67, 0x00, 0x53, 0xC1,
+0x51, 0xC4, 0x96, 0xFD, 0x47, 0x01, 0x44, 0x81, 0x62, 0x67, 0x5B, 0xC0, 0xAE, 0xA3, 0x47, 0x01,
+0x7F, 0xC0, 0xEC, 0x82, 0x00, 0x62, 0x67, 0x91, 0xC0, 0xCF, 0xAB, 0x4E, 0x47, 0x00, 0xAF, 0x7E,
+0x59, 0x5B, 0x67, 0x62, 0x95, 0xC0, 0x14, 0xED, 0x4E, 0x47, 0xAF, 0xC0, 0xB2, 0xD4, 0x59, 0xC0,
+0x2D, 0x93, 0x67, 0x00, 0x91, 0xC1, 0x71, 0xCC, 0x96, 0xFD, 0x47, 0x53, 0x71, 0xC1, 0x8A, 0x72,
+0x4D, 0x93, 0x67, 0x00, 0x4E, 0x45, 0xC0, 0x96, 0xFD, 0x47, 0xAB, 0x80, 0x6D, 0xBF, 0x62, 0x67,
+0x91, 0x46, 0x4E, 0x47, 0x00, 0xAF, 0x6A, 0xC0, 0xAB, 0x7A, 0x5B, 0x67, 0x62, 0x5B, 0x70, 0x4E,
+0x47, 0x4E, 0xC1, 0x4D, 0x93, 0xCB, 0x7A, 0x5B, 0x67, 0x5B, 0x6A, 0x7F, 0x47, 0x00, 0xAF, 0x64,
+0x54, 0xC0, 0x4D, 0x93, 0x67, 0x00, 0x53, 0xC0, 0xD3, 0xDC, 0x42, 0xC1, 0x79, 0xFE, 0xFF, 0xFF,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x7B, 0xC0, 0x7B, 0xFE, 0x5E, 0x01, 0x65, 0x51, 0x52,
+0xC2, 0xBC, 0xFE, 0x3A, 0xEE, 0x15, 0xC5, 0x6E, 0x76, 0x65, 0x6A, 0x65, 0x6A, 0x65, 0x6A, 0x00,
+0x65, 0x00, 0x5E, 0x00, 0x65, 0x6A, 0x00, 0x65, 0x5E, 0x10, 0x59, 0x74, 0x71, 0x0F, 0x6C, 0xC0,
+0x96, 0xFD, 0x47, 0xC1, 0x10, 0xB4, 0x0C, 0x8B, 0x00, 0x62, 0xC1, 0x30, 0xBC, 0xF3, 0xE4, 0x47,
+0x01, 0x4E, 0x45, 0x44, 0x7F, 0xC0, 0x4D, 0x93, 0x7E, 0x45, 0xC0, 0x55, 0xF5, 0x47, 0x00, 0x4E,
+0xC1, 0x72, 0xCC, 0x0C, 0x8B, 0x00, 0xC3, 0x6D, 0x93, 0xF0, 0xB3, 0xB3, 0xDC, 0x55, 0xF5, 0x47,
+0x00, 0x4E, 0x6B, 0x58, 0xC0, 0x0C, 0x8B, 0xBF, 0x6F, 0x78, 0xC0, 0x34, 0xED, 0x47, 0x02, 0x46,
+0x7F, 0x44, 0x67, 0x5A, 0x5C, 0x47, 0x01, 0x96, 0x6F, 0xC0, 0x0C, 0x8B, 0x44, 0xC0, 0x8E, 0xA3,
+0x69, 0xC0, 0x14, 0xE5, 0x47, 0x01, 0xAB, 0x69, 0x7F, 0x00, 0x5B, 0x4D, 0x54, 0xC0, 0x55, 0xF5,
+0x47, 0x00, 0x4E, 0xC0, 0xF4, 0xE4, 0x53, 0x91, 0x53, 0xC1, 0xAF, 0xAB, 0x92, 0xCC, 0x70, 0x47,
+0x00, 0x4E, 0x54, 0xC0, 0x2D, 0x8B, 0x7F, 0x53, 0x7E, 0xC1, 0x92, 0xD4, 0x35, 0xF5, 0x47, 0x01,
+0x96, 0x6A, 0x7C, 0x44, 0x6A, 0x69, 0x68, 0x47, 0x01, 0x4E, 0x64, 0xC0, 0x0C, 0x8B, 0x00, 0x5B,
+0x52, 0x54, 0xC0, 0x55, 0xF5, 0x47, 0x00, 0x4E, 0x52, 0xC0, 0x0C, 0x8B, 0x00, 0x62, 0x5A, 0x5C,
+0x47, 0x01, 0x4E, 0x45, 0x44, 0x7F, 0x53, 0x7E, 0x45, 0xC0, 0x55, 0xF5, 0xBA, 0xC0, 0x79, 0xFE,
+0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x7B, 0x59, 0x5E, 0x01, 0x65, 0xC1, 0x19, 0xE6,
+0x52, 0xA4, 0x76, 0xC3, 0x1A, 0xEE, 0x72, 0xA4, 0xD0, 0x93, 0x97, 0xD5, 0x6E, 0x4C, 0xC1, 0x98,
+0xD5, 0xD4, 0xBC, 0x4A, 0xC1, 0x56, 0xCD, 0x73, 0xAC, 0x51, 0x4B, 0x59, 0x5E, 0x15, 0x59, 0x74,
+0x71, 0x0F, 0x6C, 0xC0, 0x96, 0xFD, 0x42, 0x53, 0x63, 0xC3, 0x10, 0xB4, 0xCB, 0x7A, 0x4D, 0x93,
+0x96, 0xFD, 0x47, 0x02, 0x53, 0x7F, 0xC2, 0x71, 0xCC, 0x2D, 0x8B, 0xAA, 0x72, 0x6B, 0x53, 0x47,
+0x01, 0x53, 0xC2, 0x35, 0xED, 0x51, 0xC4, 0x0C, 0x8B, 0x68, 0xC0, 0x55, 0xF5, 0x53, 0x47, 0x01,
+0x4E, 0x00, 0x40, 0x67, 0xC0, 0x8A, 0x6A, 0x40, 0xC0, 0xB6, 0xFD, 0x42, 0x47, 0x01, 0x53, 0x5C,
+0x4D, 0x59, 0x67, 0x58, 0x47, 0x01, 0x4E, 0x53, 0x54, 0x7E, 0xC0, 0x8A, 0x72, 0x7E, 0xC0, 0xB7,
+0xFD, 0x47, 0x02, 0x53, 0xC2, 0x34, 0xED, 0x31, 0xC4, 0xEC, 0x82, 0xA9, 0x47, 0x4E, 0x47, 0x00,
+0x42, 0x53, 0x47, 0x40, 0x62, 0x51, 0x45, 0x58, 0x42, 0x47, 0x42, 0x53, 0x7F, 0x71, 0xC0, 0x4D,
+0x93, 0x54, 0x63, 0xC0, 0x96, 0xFD, 0x47, 0x01, 0x4E, 0x53, 0xC0, 0xD3, 0xDC, 0x7E, 0x51, 0x52,
+0x5F, 0x47, 0x02, 0x53, 0x6B, 0x5A, 0x70, 0xBF, 0x53, 0x4E, 0x47, 0x01, 0x53, 0x63, 0x52, 0x68,
+0xC1, 0x4D, 0x93, 0x96, 0xFD, 0x47, 0x02, 0x53, 0x91, 0x71, 0x4B, 0x59, 0x6B, 0x53, 0x42, 0xC1,
+0x79, 0xFE, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x7B, 0xC0, 0x7B, 0xFE, 0x5E,
+0x01, 0x65, 0xC5, 0x19, 0xEE, 0x52, 0xA4, 0xDD, 0xFE, 0xB8, 0xDD, 0x8F, 0x8B, 0x93, 0xAC, 0xBE,
+0xC4, 0x32, 0xA4, 0xF4, 0xBC, 0xD8, 0xDD, 0xAF, 0x8B, 0xB4, 0xB4, 0x64, 0xAE, 0x4C, 0x78, 0x65,
+0x5E, 0x15, 0x59, 0x74, 0x71, 0x0F, 0x6C, 0x58, 0xA1, 0xC2, 0xEB, 0x7A, 0xE7, 0x51, 0x8A, 0x72,
+0x5B, 0x79, 0x7E, 0x7F, 0x47, 0x00, 0x53, 0x52, 0xC1, 0xC7, 0x49, 0x69, 0x6A, 0x44, 0x7E, 0x6A,
+0x5C, 0x4E, 0x47, 0x53, 0x6F, 0x52, 0xC1, 0x6A, 0x6A, 0x2D, 0x93, 0x7E, 0x6F, 0x6B, 0xC0, 0x76,
+0xFD, 0x47, 0x53, 0xC2, 0xB3, 0xDC, 0xE8, 0x51, 0x49, 0x62, 0x77, 0x6F, 0x6A, 0xC0, 0x72, 0xCC,
+0x53, 0x47, 0x01, 0xC0, 0xAA, 0x72, 0x61, 0x59, 0x62, 0x79, 0x46, 0x47, 0x00, 0x4E, 0x7A, 0xC2,
+0x69, 0x62, 0x08, 0x52, 0xCB, 0x7A, 0x67, 0xBF, 0xC0, 0x10, 0xBC, 0x4E, 0x47, 0x00, 0x53, 0x5B,
+0x52, 0x51, 0xC0, 0x4D, 0x93, 0x7E, 0x6F, 0xC0, 0x34, 0xED, 0x4E, 0x47, 0xAF, 0xC0, 0x92, 0xD4,
+0x5A, 0x7D, 0x77, 0x76, 0x6A, 0x40, 0x53, 0x47, 0x53, 0xC0, 0x31, 0xC4, 0x52, 0x42, 0xC0, 0x0C,
+0x8B, 0x79, 0x6A, 0xC0, 0xD3, 0xDC, 0x4E, 0x47, 0x4E, 0x70, 0x7D, 0x91, 0x68, 0x6A, 0x6F, 0xC0,
+0x30, 0xBC, 0x4E, 0x47, 0x00, 0x53, 0xC0, 0x2D, 0x93, 0x52, 0x51, 0xC0, 0x4D, 0x93, 0x7E, 0x76,
+0x7A, 0x47, 0x00, 0xAB, 0x6D, 0xC1, 0xE7, 0x51, 0x8A, 0x72, 0x5B, 0x79, 0x7E, 0xC0, 0x55, 0xF5,
+0x47, 0x00, 0xAF, 0xC1, 0x10, 0xB4, 0xC7, 0x49, 0x45, 0x44, 0x7E, 0x6A, 0x5C, 0xC0, 0x55, 0xFD,
+0x4B, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x7B, 0xC0, 0x7B, 0xFE, 0x5E, 0x01, 0x65,
+0xC0, 0x19, 0xEE, 0x50, 0x56, 0xC2, 0x98, 0xD5, 0x6E, 0x83, 0xF5, 0xBC, 0x95, 0xC0, 0x52, 0xA4,
+0x5F, 0xC0, 0xB4, 0xB4, 0x50, 0x64, 0x4C, 0xC3, 0x1A, 0xEE, 0x4E, 0x7B, 0x56, 0xCD, 0xBC, 0xFE,
+0x5E, 0x15, 0xA6, 0x74, 0x71, 0x0F, 0x6C, 0x53, 0x42, 0xC0, 0x92, 0xCC, 0x78, 0xC0, 0xD3, 0xDC,
+0x00, 0x95, 0x00, 0x42, 0xAE, 0x00, 0x4E, 0xC1, 0xD3, 0xE4, 0x51, 0xC4, 0x4F, 0x54, 0x45, 0x40,
+0xC0, 0x34, 0xED, 0x47, 0x00, 0x4E, 0x54, 0xC0, 0x71, 0xCC, 0x4F, 0x54, 0x45, 0x40, 0x7A, 0x47,
+0x01, 0x6B, 0x69, 0x45, 0x54, 0x4F, 0x40, 0x63, 0x4E, 0x47, 0x00, 0x42, 0x78, 0x7D, 0x54, 0x00,
+0x40, 0x45, 0x47, 0x01, 0x7F, 0x71, 0x40, 0x54, 0x4F, 0x40, 0x54, 0x47, 0x01, 0x4E, 0x45, 0x71,
+0x4F, 0x54, 0x45, 0x40, 0x7F, 0x47, 0x01, 0x6B, 0x69, 0x45, 0x54, 0x96, 0x40, 0x63, 0x4E, 0x47,
+0x4E, 0x5C, 0x69, 0x4C, 0x54, 0x45, 0x40, 0x6B, 0x4E, 0x47, 0x00, 0x7F, 0x69, 0x40, 0x54, 0x4F,
+0x40, 0x54, 0x47, 0x02, 0x45, 0x71, 0x4F, 0x54, 0x45, 0x40, 0x7F, 0x47, 0x01, 0x7D, 0x78, 0x54,
+0x00, 0x45, 0x00, 0x42, 0x47, 0x00, 0x4E, 0x57, 0x69, 0x4F, 0x54, 0x45, 0x40, 0x70, 0x42, 0x4B,
+0xC0, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x7B, 0x59, 0x5E, 0x01, 0x65, 0x56,
+0x50, 0xBF, 0xC0, 0xD8, 0xDD, 0x5B, 0x50, 0x5B, 0xC1, 0xB8, 0xDD, 0x1A, 0xEE, 0x77, 0x50, 0x77,
+0xBF, 0x59, 0xC0, 0xD0, 0x8B, 0x7D, 0x65, 0x5E, 0x15, 0x59, 0x74, 0x71, 0x0F, 0x6C, 0x53, 0x47,
+0x7E, 0xC1, 0x4D, 0x93, 0x8E, 0xA3, 0x55, 0xC0, 0x92, 0xCC, 0x63, 0x47, 0x01, 0x4E, 0x7D, 0x53,
+0x67, 0x7E, 0xC0, 0x71, 0xCC, 0x54, 0x7F, 0x47, 0x00, 0xAF, 0x69, 0xC0, 0x4D, 0x93, 0x6A, 0xC0,
+0xEF, 0xB3, 0x71, 0x54, 0x7F, 0x47, 0x00, 0x4E, 0x63, 0x53, 0x62, 0xC0, 0xAF, 0xAB, 0x69, 0x45,
+0x7A, 0x47, 0x02, 0x7E, 0x53, 0x6A, 0x55, 0x40, 0xC0, 0x14, 0xE5, 0x47, 0x01, 0x7F, 0x6A, 0x95,
+0x6F, 0xC0, 0x30, 0xBC, 0x40, 0x6B, 0x47, 0x01, 0xAF, 0x5A, 0xC0, 0x4D, 0x93, 0x6A, 0x46, 0x78,
+0x5C, 0x42, 0x47, 0x00, 0x4E, 0x54, 0x53, 0x67, 0x7E, 0x69, 0x4F, 0x7A, 0x47, 0x00, 0x4E, 0x45,
+0x53, 0x67, 0x7E, 0x69, 0x54, 0x7F, 0x47, 0x01, 0x7A, 0x67, 0x5B, 0x6F, 0x5A, 0x40, 0x6B, 0x47,
+0x01, 0x4E, 0x55, 0x53, 0x6A, 0x4D, 0x78, 0x5C, 0x47, 0x02, 0x7E, 0x53, 0x6A, 0x55, 0x7D, 0x63,
+0x47, 0x01, 0x4E, 0x7D, 0x53, 0x67, 0x7E, 0x71, 0x54, 0x7F, 0x42, 0x4B, 0xC0, 0xFF, 0xFF, 0x1F,
+0x70, 0x00, 0x71, 0x04, 0x7B, 0x59, 0x5E, 0x02, 0x65, 0xC0, 0xDD, 0xFE, 0xA5, 0x65, 0x6A, 0x02,
+0x65, 0x6A, 0x02, 0x5F, 0xC0, 0xD4, 0xBC, 0x6A, 0x5E, 0x16, 0x59, 0x74, 0x71, 0x0F, 0x6C, 0xC0,
+0x96, 0xFD, 0x42, 0x7F, 0x54, 0x55, 0xC3, 0x0C, 0x8B, 0x08, 0x5A, 0x8A, 0x6A, 0x55, 0xF5, 0x47,
+0x02, 0x6B, 0xC0, 0x51, 0xC4, 0x5B, 0xC1, 0x69, 0x6A, 0xE7, 0x51, 0x40, 0x53, 0x47, 0x01, 0x63,
+0x69, 0xC1, 0x4D, 0x93, 0x49, 0x62, 0x91, 0x57, 0xC0, 0x96, 0xFD, 0x47, 0x01, 0x81, 0x40, 0x6F,
+0xC1, 0xAA, 0x72, 0xC7, 0x49, 0x7E, 0x53, 0x47, 0x01, 0x7F, 0x54, 0xC1, 0x10, 0xB4, 0xEC, 0x82,
+0x66, 0xC0, 0xAB, 0x72, 0x47, 0x02, 0x7F, 0xC0, 0xB3, 0xDC, 0x46, 0x6D, 0x61, 0xC0, 0x0C, 0x83,
+0x53, 0x47, 0x02, 0x5C, 0xC1, 0x31, 0xC4, 0x2D, 0x93, 0x7D, 0x95, 0x68, 0xC0, 0x76, 0xFD, 0x47,
+0x01, 0x70, 0xC3, 0x92, 0xCC, 0x8E, 0xA3, 0x8A, 0x72, 0xC7, 0x49, 0x4D, 0x53, 0x47, 0x01, 0x6B,
+0xC0, 0x71, 0xCC, 0x62, 0xC0, 0x6A, 0x6A, 0x5A, 0xC0, 0x51, 0xCC, 0x53, 0x47, 0x01, 0x7F, 0xC0,
+0xB2, 0xD4, 0x7E, 0xC0, 0xCB, 0x7A, 0x5A, 0xC0, 0x2D, 0x93, 0x53, 0x47, 0x01, 0x42, 0x5C, 0xC0,
+0x30, 0xBC, 0x44, 0xC0, 0x29, 0x5A, 0xBE, 0x70, 0xC0, 0x76, 0xFD, 0x47, 0x00, 0x7F, 0xC0, 0xD3,
+0xDC, 0x55, 0xC0, 0x0C, 0x8B, 0x69, 0x51, 0xC0, 0x55, 0xF5, 0x47, 0x02, 0x6B, 0xC0, 0x51, 0xC4,
+0x5B, 0xC1, 0x69, 0x6A, 0xE7, 0x51, 0x40, 0x47, 0x4B, 0xC0, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0x7B, 0xC0, 0x7B, 0xFE, 0x5E, 0x0F, 0x59, 0x65, 0x5E, 0x17, 0x59, 0x74, 0x71,
+0x0F, 0xA6, 0x53, 0x47, 0x44, 0x7D, 0xC0, 0x2D, 0x8B, 0x55, 0x5C, 0x47, 0x02, 0x53, 0x64, 0xC0,
+0x08, 0x5A, 0x68, 0x7E, 0xC0, 0xB2, 0xD4, 0x7F, 0x4E, 0x47, 0x00, 0x53, 0x7E, 0x6E, 0x77, 0x46,
+0x4F, 0x7F, 0x47, 0x01, 0x4E, 0x54, 0x7D, 0xC0, 0xAA, 0x72, 0x6A, 0x78, 0xC0, 0x35, 0xED, 0x4E,
+0x47, 0x02, 0x7C, 0x7D, 0xC1, 0x4D, 0x93, 0x30, 0xBC, 0x63, 0x4E, 0x47, 0x01, 0x7F, 0xC0, 0xAB,
+0x7A, 0x80, 0x5B, 0xC0, 0x51, 0xC4, 0x6B, 0x4E, 0x47, 0x01, 0xAF, 0x6F, 0x6E, 0x7C, 0x4D, 0x54,
+0x47, 0x02, 0x53, 0xC1, 0xB2, 0xD4, 0x29, 0x62, 0x60, 0x6F, 0xC0, 0x92, 0xCC, 0x7A, 0x4E, 0x47,
+0x00, 0x53, 0xC0, 0x51, 0xCC, 0x6E, 0x68, 0x7E, 0x40, 0x7F, 0x4E, 0x47, 0x00, 0x4E, 0x80, 0xC0,
+0x8A, 0x72, 0x4C, 0x5B, 0x69, 0x6B, 0x4E, 0x47, 0x01, 0x53, 0x62, 0x6E, 0xC2, 0x0C, 0x8B, 0x10,
+0xB4, 0xD3, 0xDC, 0x47, 0x02, 0x4E, 0x44, 0xC0, 0x49, 0x62, 0x4B, 0x55, 0x5C, 0x47, 0x02, 0x53,
+0x64, 0xC0, 0x08, 0x5A, 0x68, 0x7E, 0x45, 0xC0, 0x55, 0xF5, 0x4E, 0x42, 0xC0, 0x79, 0xFE, 0x71,
+0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x04, 0x7B, 0xC0, 0x7B, 0xFE, 0x5E, 0x0F, 0x65, 0x00, 0x5E,
+0x17, 0x59, 0x74, 0x71, 0x0F, 0xA6, 0x53, 0x42, 0x7A, 0x54, 0x52, 0xC0, 0x4D, 0x93, 0x4C, 0x68,
+0x7F, 0x47, 0x01, 0x7F, 0xC1, 0xF4, 0xE4, 0x51, 0xC4, 0x62, 0x68, 0x7D, 0x45, 0xC0, 0x96, 0xFD,
+0x47, 0x00, 0x7F, 0x63, 0x64, 0x5B, 0x60, 0x90, 0x5C, 0x4E, 0x47, 0x01, 0x6B, 0xC0, 0x92, 0xCC,
+0x6F, 0xC1, 0xEC, 0x82, 0x49, 0x62, 0x4D, 0x53, 0x47, 0x01, 0x7A, 0x54, 0x46, 0xC0, 0x2D, 0x8B,
+0x45, 0x77, 0x47, 0x02, 0x81, 0xC0, 0xB3, 0xD4, 0x7E, 0x44, 0x7D, 0xC1, 0x4D, 0x93, 0x96, 0xFD,
+0x47, 0x01, 0x7F, 0x5C, 0x5A, 0xC1, 0x6D, 0x93, 0xAA, 0x72, 0x51, 0x6B, 0x4E, 0x47, 0x00, 0x42,
+0x6B, 0xC0, 0x72, 0xCC, 0x6A, 0xC0, 0xEB, 0x82, 0x7D, 0x5A, 0x53, 0x47, 0x00, 0x7F, 0x81, 0x69,
+0x67, 0xC0, 0xCB, 0x7A, 0x7D, 0x78, 0x53, 0x47, 0x01, 0x81, 0xC0, 0xB2, 0xD4, 0x7E, 0xC0, 0x0C,
+0x8B, 0x7D, 0x62, 0x53, 0x47, 0x01, 0x96, 0x57, 0x55, 0xC1, 0x4D, 0x93, 0x8A, 0x72, 0x59, 0x70,
+0x4E, 0x47, 0x00, 0x7A, 0xC0, 0xD3, 0xDC, 0x52, 0x53, 0xC0, 0x6A, 0x6A, 0x68, 0x7F, 0x47, 0x01,
+0x7F, 0x63, 0x69, 0x62, 0x68, 0x7D, 0x45, 0x47, 0xC0, 0x79, 0xFE, 0x71, 0x1F, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x04, 0x7B, 0xC0, 0x7B, 0xFE, 0x5E, 0x2A, 0x59, 0x74, 0x71, 0x0F, 0x6C, 0xC0, 0x96,
+0xFD, 0x42, 0x55, 0x5B, 0x6A, 0x6F, 0xAB, 0x64, 0x47, 0x01, 0x4E, 0x45, 0x62, 0x00, 0x6F, 0x00,
+0x46, 0x6B, 0x4E, 0x47, 0x4E, 0x78, 0x5B, 0x67, 0x6F, 0x00, 0x52, 0xC0, 0x35, 0xED, 0x47, 0x00,
+0x4E, 0x6B, 0x6A, 0x5B, 0x6F, 0x6A, 0x7E, 0x54, 0x4E, 0x47, 0x01, 0x52, 0x5B, 0x6A, 0x6F, 0x00,
+0x69, 0x47, 0x01, 0x7F, 0x7E, 0x5B, 0x6A, 0x6F, 0x79, 0x78, 0x4E, 0x47, 0x00, 0x4E, 0xC0, 0x71,
+0xCC, 0x5B, 0x67, 0x6F, 0x00, 0x55, 0x7A, 0x47, 0x00, 0x4E, 0x63, 0x6A, 0x62, 0x6F, 0x6A, 0x7E,
+0x54, 0x4E, 0x47, 0x4E, 0x54, 0x67, 0x62, 0x6F, 0x00, 0x46, 0x63, 0x4E, 0x47, 0x00, 0x7A, 0x7E,
+0x5B, 0x6F, 0x00, 0x7E, 0xC0, 0x92, 0xCC, 0x4E, 0x47, 0x00, 0x4E, 0x69, 0x5B, 0x67, 0x6F, 0x00,
+0x5A, 0x7F, 0x47, 0x01, 0x55, 0x5B, 0x6A, 0x6F, 0x76, 0x64, 0x47, 0x01, 0x4E, 0x45, 0x62, 0x00,
+0x6F, 0x00, 0x46, 0x6B, 0x42, 0x4B, 0xC0, 0xFF, 0xFF, 0x1F, 0x70, 0x00, 0x71, 0x04, 0xC0, 0x3D,
+0xFF, 0x59, 0x5E, 0x2A, 0x59, 0xC0, 0x1D, 0xFF, 0x71, 0x0F, 0x6C, 0x53, 0x47, 0x5A, 0xC0, 0xEC,
+0x82, 0x5B, 0x6B, 0xC0, 0xB7, 0xFD, 0x53, 0x47, 0x01, 0x4E, 0x5C, 0xC0, 0x0C, 0x8B, 0x44, 0x78,
+0xC0, 0xB6, 0xFD, 0x53, 0x47, 0x01, 0x4E, 0xC0, 0xB2, 0xD4, 0x7C, 0xC1, 0x2D, 0x93, 0xB3, 0xD4,
+0x5F, 0x53, 0x47, 0x02, 0x7A, 0x5B, 0x7F, 0x52, 0x53, 0x58, 0xA2, 0x47, 0x01, 0x4E, 0x55, 0x77,
+0x62, 0x7A, 0x5F, 0x53, 0x47, 0x02, 0x7E, 0x77, 0x6F, 0x42, 0x58, 0x53, 0x47, 0x01, 0x4E, 0xC0,
+0x92, 0xD4, 0x7C, 0xC0, 0x4D, 0x93, 0x54, 0x5F, 0xA5, 0x47, 0x01, 0x4E, 0x80, 0xC0, 0x4D, 0x93,
+0x7F, 0x5A, 0xC0, 0x96, 0xFD, 0x58, 0x4E, 0x47, 0x00, 0x4E, 0x63, 0x44, 0x7F, 0x69, 0x58, 0x53,
+0x4E, 0x47, 0x02, 0x79, 0x77, 0x79, 0x47, 0x58, 0x53, 0x47, 0x01, 0x4E, 0x78, 0x77, 0xC0, 0x4D,
+0x93, 0x5C, 0x5F, 0xA5, 0x47, 0x01, 0x4E, 0x5A, 0x77, 0x5B, 0x6B, 0x5F, 0x53, 0x47, 0x01, 0x4E,
+0x5C, 0x7F, 0x44, 0x78, 0x58, 0x53, 0x47, 0x42, 0x4B, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x04, 0x6C, 0xC0, 0xBC, 0xFE, 0x59, 0x2A, 0x6A, 0x6C, 0x71, 0x0F, 0x6C, 0x53, 0x47, 0x68, 0x69,
+0xC0, 0xEF, 0xAB, 0x44, 0x5F, 0x53, 0x47, 0x01, 0x53, 0x7E, 0xC0, 0x4D, 0x93, 0x4F, 0xC0, 0x8A,
+0x72, 0x7A, 0xC0, 0x96, 0xFD, 0x47, 0x01, 0x53, 0x5B, 0x6F, 0x7D, 0x60, 0x4E, 0x53, 0x47, 0x01,
+0x53, 0x40, 0x68, 0xC0, 0xF3, 0xDC, 0x68, 0x40, 0x5F, 0x4E, 0x47, 0x02, 0x68, 0x78, 0x76, 0xC1,
+0x4D, 0x93, 0xD7, 0xFD, 0xA1, 0x47, 0x01, 0x81, 0xC0, 0xAA, 0x72, 0x45, 0xC0, 0x4D, 0x93, 0x79,
+0x64, 0xA1, 0x47, 0x01, 0x53, 0xC0, 0x4D, 0x93, 0x7E, 0xC0, 0x71, 0xC4, 0x68, 0xC0, 0x96, 0xFD,
+0x00, 0x47, 0x01, 0x53, 0xC2, 0x71, 0xCC, 0xEB, 0x82, 0xF3, 0xDC, 0x60, 0x4F, 0x58, 0x4E, 0x47,
+0x00, 0x53, 0x52, 0x44, 0xC1, 0xD3, 0xDC, 0x8A, 0x72, 0x6B, 0x58, 0x4E, 0x47, 0x00, 0x4E, 0x6B,
+0xC2, 0xAA, 0x72, 0xD3, 0xDC, 0x2D, 0x8B, 0x46, 0x64, 0x4E, 0x47, 0x01, 0x53, 0x7F, 0x4D, 0xC0,
+0x31, 0xC4, 0x6D, 0x58, 0x53, 0x47, 0x01, 0x4E, 0x68, 0x69, 0x43, 0x44, 0x5F, 0x53, 0x47, 0x01,
+0x53, 0x7E, 0xC0, 0x4D, 0x93, 0x4F, 0xC0, 0x8A, 0x72, 0x7A, 0xC0, 0x96, 0xFD, 0x47, 0x42, 0xC1,
+0x79, 0xFE, 0xFF, 0xFF, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC0, 0x7E, 0xFF, 0xA6, 0x28,
+0x56, 0x6C, 0x71, 0x10, 0x6C, 0x58, 0x42, 0x54, 0x5B, 0x96, 0x75, 0x62, 0x6F, 0xC0, 0x55, 0xF5,
+0x47, 0x00, 0xAF, 0xC0, 0x8E, 0xA3, 0x68, 0xC1, 0xCF, 0xA3, 0x49, 0x62, 0x44, 0x5B, 0xC0, 0xD3,
+0xDC, 0x4E, 0x47, 0x53, 0x44, 0x7C, 0x6F, 0xC1, 0x28, 0x5A, 0x4D, 0x93, 0x5B, 0xC0, 0x14, 0xE5,
+0x4E, 0x47, 0xAF, 0x69, 0xC0, 0x6A, 0x6A, 0x7E, 0xC1, 0x8A, 0x6A, 0xCB, 0x7A, 0x5B, 0xC0, 0x71,
+0xC4, 0x53, 0x47, 0x00, 0x7F, 0x51, 0x67, 0x44, 0x7D, 0x62, 0x79, 0x47, 0x00, 0x4E, 0xC1, 0x14,
+0xE5, 0x69, 0x6A, 0x6F, 0x77, 0xC0, 0x69, 0x62, 0x62, 0x46, 0x4E, 0x47, 0x00, 0x53, 0x7C, 0x44,
+0x6A, 0xC1, 0x28, 0x5A, 0x4D, 0x93, 0x62, 0x6B, 0x4E, 0x47, 0xAF, 0x5A, 0x51, 0x7E, 0x4C, 0x6D,
+0x5B, 0x78, 0x53, 0x47, 0x53, 0x7E, 0x60, 0x7E, 0x7D, 0x7C, 0xC0, 0x6D, 0x93, 0x4F, 0x4E, 0x47,
+0x4E, 0x54, 0x45, 0x76, 0xC0, 0xCB, 0x7A, 0x4C, 0x62, 0x52, 0x4E, 0x47, 0x00, 0x53, 0x6D, 0xC0,
+0x2D, 0x93, 0x62, 0x6E, 0x5B, 0x67, 0x7A, 0xC0, 0x76, 0xFD, 0x47, 0xA6, 0xC0, 0x8A, 0x72, 0x5B,
+0x96, 0x75, 0x62, 0x6F, 0x7F, 0x47, 0x00, 0xAF, 0x6A, 0x68, 0x7B, 0x7D, 0x44, 0x5B, 0xC0, 0xD3,
+0xDC, 0x42, 0x4B, 0x71, 0x1F, 0x70, 0x00, 0x71, 0xE0, 0x06, 0xC1, 0x59, 0xFE, 0x35, 0xFD, 0x63,
+0x80, 0x00, 0x54, 0x40, 0x4F, 0x42, 0x47, 0x01, 0x81, 0x45, 0x00, 0x54, 0x45, 0x40, 0x70, 0x47,
+0x01, 0x6B, 0x45, 0x00, 0x54, 0x45, 0x00, 0x7A, 0x47, 0x01, 0x7F, 0x54, 0x40, 0x54, 0x4F, 0x40,
+0x63, 0x4E, 0x47, 0x01, 0x5C, 0x40, 0x45, 0x54, 0x40, 0x54, 0x47, 0x02, 0x54, 0x40, 0x4F, 0x54,
+0x40, 0x54, 0x47, 0x02, 0x6B, 0x45, 0x00, 0x54, 0x45, 0x00, 0x7F, 0x47, 0x01, 0x7F, 0x4F, 0x45,
+0x54, 0x4F, 0x40, 0x6B, 0x4E, 0x47, 0x00, 0x7A, 0xC0, 0xB3, 0xD4, 0x45, 0x54, 0x45, 0x40, 0x70,
+0x47, 0x01, 0x42, 0x54, 0x40, 0x4F, 0x54, 0x40, 0x54, 0x47, 0x02, 0x6B, 0x45, 0x00, 0x54, 0x45,
+0x00, 0x7F, 0x47, 0x01, 0x63, 0x45, 0x00, 0x54, 0x40, 0x4F, 0x42, 0x47, 0x01, 0x70, 0x45, 0x00,
+0x54, 0x45, 0x40, 0x70, 0x42, 0xC0, 0x3C, 0xFF, 0x71, 0x1F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0,
+0x06, 0xA1, 0xC0, 0x18, 0xFE, 0x4E, 0x53, 0x02, 0x4E, 0x47, 0x02, 0x4E, 0x53, 0x03, 0x47, 0x02,
+0x4E, 0x53, 0x03, 0x47, 0x03, 0x53, 0x03, 0x4E, 0x47, 0x02, 0x4E, 0x53, 0x02, 0x4E, 0x47, 0x02,
+0x4E, 0x53, 0x02, 0x4E, 0x47, 0x02, 0x4E, 0x53, 0x03, 0x47, 0x03, 0x53, 0x03, 0x4E, 0x47, 0x02,
+0x53, 0x03, 0x47, 0x03, 0x53, 0x03, 0x4E, 0x47, 0x02, 0x4E, 0x53, 0x03, 0x47, 0x02, 0x4E, 0x53,
+0x02, 0x4E, 0x47, 0x02, 0x4E, 0x53, 0x02, 0x4E, 0x00, 0xC0, 0xBB, 0xFE, 0x71, 0x20, 0x70, 
+};
@@ -0,0 +1,3542 @@
+// Packed by packimage from teensy40_pinout2.h
+// 240x320 RGB565, 153600 bytes raw, 56565 bytes packed
+// tft.drawPackedImage(x, y, teensy40_pinout2_packed, sizeof(teensy40_pinout2_packed));
+
+const uint8_t teensy40_pinout2_packed[56565] PROGMEM = {
+0x52, 0x50, 0x00, 0x00, 0xF0, 0x00, 0x40, 0x01, 0xC1, 0xB2, 0x9C, 0xFF, 0xFF, 0x17, 0xC5, 0x96,
+0xB5, 0x82, 0x10, 0x6A, 0x52, 0x8E, 0x73, 0xCB, 0x5A, 0x04, 0x21, 0x91, 0xC0, 0x8A, 0x52, 0x58,
+0x5C, 0xC1, 0x82, 0x18, 0x51, 0x8C, 0x71, 0x2E, 0x91, 0xC1, 0x34, 0xAD, 0x75, 0xAD, 0x78, 0x91,
+0xC0, 0x1C, 0xE7, 0x71, 0x07, 0xC2, 0xBA, 0xD6, 0x45, 0x29, 0x61, 0x10, 0x54, 0x71, 0x07, 0xC3,
+0x5D, 0xEF, 0x49, 0x4A, 0xE3, 0x20, 0x10, 0x84, 0xAE, 0x44, 0x74, 0xC0, 0x5D, 0xEF, 0x71, 0x05,
+0xC2, 0x18, 0xC6, 0x0C, 0x63, 0xE3, 0x20, 0x7C, 0xC5, 0xAA, 0x5A, 0x8E, 0x73, 0x28, 0x42, 0xA3,
+0x18, 0x04, 0x21, 0x14, 0xA5, 0x71, 0x14, 0xC3, 0xD7, 0xBD, 0xA2, 0x18, 0x86, 0x31, 0x3C, 0xE7,
+0x71, 0x0A, 0xC1, 0x3C, 0xEF, 0x69, 0x52, 0x70, 0x43, 0xC4, 0xEF, 0x7B, 0x0C, 0x63, 0xC3, 0x18,
+0x08, 0x42, 0xDF, 0xFF, 0xAE, 0x6C, 0x48, 0xC1, 0x00, 0x00, 0x6E, 0x73, 0x71, 0x06, 0xC2, 0x6D,
+0x6B, 0x41, 0x08, 0xAF, 0x7B, 0x71, 0x23, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x17, 0x69, 0x68, 0xC0,
+0x9A, 0xD6, 0x71, 0x48, 0xC0, 0x04, 0x21, 0x68, 0xC0, 0x96, 0xB5, 0x71, 0xC0, 0x5D, 0xEF, 0x50,
+0xC0, 0x10, 0x84, 0x71, 0x2E, 0xC0, 0xF7, 0xBD, 0x69, 0xC2, 0x92, 0x94, 0xF4, 0xA4, 0xB7, 0xBD,
+0x78, 0x6C, 0x71, 0x05, 0xC1, 0x7D, 0xEF, 0xE8, 0x41, 0x6B, 0x9A, 0xC0, 0x51, 0x8C, 0x71, 0x07,
+0xC1, 0x2C, 0x63, 0x20, 0x08, 0x54, 0x71, 0x00, 0xC0, 0x71, 0x8C, 0x48, 0xC0, 0x2C, 0x6B, 0x71,
+0x06, 0xC3, 0x3C, 0xE7, 0x24, 0x29, 0xA2, 0x18, 0xB6, 0xB5, 0x71, 0x5D, 0x78, 0x68, 0x50, 0xC0,
+0xDB, 0xDE, 0x71, 0x13, 0x4C, 0x70, 0xC0, 0x86, 0x31, 0x75, 0x71, 0x0A, 0xC0, 0x4D, 0x6B, 0x48,
+0xC0, 0x6D, 0x73, 0x6C, 0x71, 0x00, 0xC1, 0x8A, 0x52, 0xA6, 0x31, 0x6C, 0x71, 0x00, 0xC1, 0x1C,
+0xE7, 0x96, 0xB5, 0x49, 0x71, 0x06, 0x4C, 0xC0, 0x41, 0x08, 0x67, 0x71, 0x23, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x17, 0xC2, 0xB6, 0xBD, 0x28, 0x4A, 0x5D, 0xEF, 0x71, 0xC0, 0x79, 0xCE, 0x50, 0xC1,
+0x82, 0x10, 0x75, 0xB5, 0x71, 0x00, 0xC1, 0xAB, 0x5A, 0xB2, 0x94, 0x71, 0x5D, 0x4D, 0xA6, 0xC0,
+0x9E, 0xF7, 0x71, 0x04, 0x58, 0x48, 0x4D, 0x5D, 0x71, 0x03, 0xC0, 0x3C, 0xEF, 0x44, 0x71, 0x00,
+0xC0, 0xFB, 0xDE, 0x75, 0x71, 0x04, 0xC0, 0xFB, 0xE6, 0x48, 0x5C, 0x5D, 0x71, 0x58, 0x00, 0x5D,
+0x58, 0x49, 0x71, 0xA6, 0x49, 0x5D, 0x58, 0x49, 0xC0, 0xB6, 0xB5, 0x44, 0xC1, 0x0C, 0x63, 0xEF,
+0x7B, 0x51, 0x79, 0x61, 0xC0, 0xFF, 0xFF, 0x05, 0x70, 0xC1, 0x86, 0x31, 0x8A, 0x52, 0x54, 0xC0,
+0x51, 0x8C, 0x71, 0x06, 0xC0, 0x59, 0xCE, 0x7C, 0xBE, 0x4D, 0x71, 0x00, 0x4D, 0xC0, 0xE4, 0x20,
+0x7C, 0x74, 0x71, 0x05, 0x61, 0xC2, 0x24, 0x29, 0xA2, 0x18, 0x96, 0xB5, 0x71, 0x00, 0x78, 0x7C,
+0x68, 0xC0, 0xD7, 0xBD, 0x71, 0x02, 0xC0, 0x5D, 0xEF, 0x4D, 0x5C, 0x49, 0x71, 0x05, 0x44, 0x4D,
+0xC0, 0x3C, 0xEF, 0x71, 0x01, 0x4C, 0x70, 0xC0, 0x86, 0x31, 0x75, 0x71, 0xC0, 0x9E, 0xF7, 0x01,
+0xA6, 0x71, 0x04, 0x44, 0xC1, 0x45, 0x29, 0x62, 0x10, 0x69, 0x71, 0x01, 0x45, 0x60, 0x6C, 0x71,
+0x01, 0x58, 0x00, 0x71, 0x03, 0xC1, 0x1C, 0xE7, 0x9A, 0xD6, 0x61, 0xC1, 0x2C, 0x63, 0x41, 0x08,
+0x67, 0x71, 0x03, 0xC1, 0x3C, 0xE7, 0x79, 0xD6, 0x61, 0x71, 0x1B, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x17, 0x6C, 0x5D, 0x71, 0x00, 0x79, 0x50, 0x68, 0xC0, 0x75, 0xB5, 0x71, 0x00, 0x5D, 0xBF, 0xC1,
+0x34, 0xA5, 0xE7, 0x39, 0xBA, 0x78, 0x00, 0xC0, 0xD3, 0x9C, 0x71, 0x01, 0x6C, 0x6D, 0xC0, 0xC7,
+0x39, 0x54, 0xC0, 0x65, 0x31, 0x4C, 0xC0, 0x55, 0xAD, 0x71, 0x00, 0x64, 0xC1, 0x0C, 0x63, 0x45,
+0x29, 0x70, 0xC0, 0x14, 0xA5, 0x60, 0xC0, 0xE3, 0x20, 0x64, 0xC0, 0x10, 0x84, 0x71, 0x01, 0x74,
+0xC0, 0x69, 0x52, 0x78, 0x60, 0xC0, 0x66, 0x31, 0x5B, 0x4D, 0xC0, 0x71, 0x94, 0x54, 0x60, 0x00,
+0xC0, 0x2D, 0x6B, 0x71, 0x61, 0x57, 0x54, 0xC1, 0x49, 0x4A, 0xD7, 0xBD, 0x00, 0xC3, 0x5D, 0xEF,
+0xEB, 0x62, 0x6D, 0x73, 0x59, 0xCE, 0x00, 0x61, 0x71, 0x04, 0xC1, 0x51, 0x8C, 0xA2, 0x18, 0x74,
+0xC1, 0xAE, 0x7B, 0x20, 0x08, 0x54, 0x71, 0x06, 0x54, 0xC0, 0x61, 0x10, 0x51, 0x58, 0x71, 0x00,
+0x5D, 0xC0, 0xC7, 0x39, 0x5C, 0xC0, 0x71, 0x94, 0x71, 0x05, 0x61, 0xC0, 0x24, 0x29, 0x70, 0xC0,
+0x96, 0xB5, 0x71, 0x00, 0xC0, 0x34, 0xAD, 0x63, 0xC1, 0x04, 0x21, 0xDB, 0xDE, 0x71, 0x00, 0x61,
+0xC1, 0x4D, 0x6B, 0x49, 0x4A, 0x43, 0xC0, 0x65, 0x29, 0xBF, 0x59, 0x71, 0x02, 0x5C, 0xC2, 0x2C,
+0x6B, 0xA6, 0x31, 0x8A, 0x52, 0x4C, 0x44, 0x49, 0x71, 0xC0, 0xD7, 0xBD, 0x70, 0xC0, 0x86, 0x31,
+0x75, 0x71, 0x40, 0xC0, 0xE7, 0x41, 0x96, 0x44, 0xC0, 0x9E, 0xF7, 0x71, 0x03, 0xC1, 0x5D, 0xEF,
+0x24, 0x29, 0x70, 0x57, 0x5D, 0x71, 0x00, 0xC1, 0x9E, 0xF7, 0x1C, 0xE7, 0x71, 0xA1, 0xC2, 0x14,
+0xA5, 0xCB, 0x5A, 0x04, 0x21, 0x59, 0x71, 0x01, 0xC0, 0x79, 0xD6, 0x5C, 0xC0, 0x24, 0x29, 0x51,
+0xBF, 0xC0, 0x45, 0x29, 0x68, 0x67, 0x71, 0x01, 0x75, 0xC0, 0x4D, 0x6B, 0x78, 0x54, 0x58, 0x57,
+0xC0, 0xDB, 0xDE, 0x71, 0x19, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0x79, 0x50, 0x68, 0xC0, 0x75,
+0xB5, 0x71, 0x01, 0xC1, 0xD3, 0x9C, 0x41, 0x08, 0x7F, 0x49, 0xC3, 0x1C, 0xE7, 0xE7, 0x41, 0x41,
+0x10, 0x55, 0xAD, 0x71, 0x00, 0xC1, 0xEF, 0x83, 0x21, 0x08, 0x74, 0xC0, 0x9E, 0xF7, 0x4D, 0xC2,
+0x45, 0x29, 0xA2, 0x18, 0x18, 0xC6, 0x71, 0x59, 0xC0, 0xA6, 0x39, 0x68, 0x78, 0xC0, 0x6D, 0x73,
+0x74, 0xC0, 0x49, 0x4A, 0x70, 0xAF, 0xC0, 0x59, 0xCE, 0x71, 0xC0, 0x5D, 0xEF, 0x40, 0x68, 0xC0,
+0xF7, 0xBD, 0x5D, 0xC0, 0x38, 0xC6, 0x68, 0xC0, 0xD7, 0xBD, 0x58, 0xC1, 0x10, 0x84, 0x41, 0x08,
+0x64, 0x5C, 0x71, 0x00, 0x4C, 0x77, 0xC1, 0xB6, 0xBD, 0xDF, 0xFF, 0x60, 0xC0, 0x34, 0xAD, 0x59,
+0x4D, 0xC1, 0xCF, 0x7B, 0x14, 0xA5, 0x71, 0x04, 0xC0, 0xB6, 0xB5, 0x68, 0xC0, 0xF3, 0x9C, 0x71,
+0xC2, 0x4D, 0x6B, 0x20, 0x08, 0x51, 0x8C, 0x71, 0x06, 0x44, 0xC2, 0x41, 0x08, 0x49, 0x4A, 0xDF,
+0xFF, 0x71, 0x00, 0x6C, 0x74, 0xC1, 0x61, 0x10, 0x2C, 0x6B, 0x71, 0x05, 0x61, 0xC0, 0x24, 0x29,
+0x70, 0x7D, 0x71, 0xC0, 0xDB, 0xDE, 0x74, 0xC0, 0x04, 0x21, 0x41, 0x71, 0x00, 0x49, 0xC2, 0xA7,
+0x39, 0x00, 0x00, 0x10, 0x84, 0x6C, 0xC0, 0xF7, 0xC5, 0x4B, 0x68, 0x65, 0x71, 0x00, 0x4D, 0xC0,
+0x65, 0x31, 0x68, 0xC1, 0x55, 0xAD, 0xDF, 0xFF, 0x74, 0xC1, 0x00, 0x00, 0x10, 0x84, 0x71, 0x51,
+0x70, 0xC0, 0x86, 0x31, 0x75, 0x71, 0x51, 0x70, 0xC0, 0x92, 0x94, 0x75, 0x71, 0x05, 0xC1, 0x2C,
+0x6B, 0x61, 0x10, 0x77, 0x74, 0xC0, 0xB7, 0xBD, 0x71, 0x02, 0xC4, 0x9E, 0xF7, 0x30, 0x8C, 0x45,
+0x29, 0x41, 0x08, 0x51, 0x8C, 0x71, 0x00, 0x79, 0xC3, 0x24, 0x29, 0x82, 0x10, 0x14, 0xA5, 0x9E,
+0xF7, 0x91, 0xC1, 0xEB, 0x5A, 0x41, 0x08, 0x67, 0x71, 0x00, 0x44, 0xC0, 0xE7, 0x41, 0x7C, 0x51,
+0x5D, 0x41, 0xC1, 0x41, 0x08, 0x08, 0x42, 0x58, 0x71, 0x18, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B,
+0x79, 0xC0, 0x04, 0x21, 0x68, 0xC0, 0x75, 0xB5, 0x71, 0x00, 0xC1, 0xFB, 0xDE, 0x24, 0x29, 0x91,
+0x75, 0x71, 0x00, 0xC0, 0x71, 0x94, 0x54, 0xC0, 0x69, 0x52, 0x71, 0x79, 0xC2, 0xA2, 0x18, 0x65,
+0x31, 0xDF, 0xFF, 0x71, 0x00, 0xC1, 0xAE, 0x73, 0x20, 0x08, 0x78, 0x71, 0x00, 0xC0, 0x8E, 0x73,
+0x4F, 0xC0, 0x4D, 0x6B, 0x71, 0x00, 0xC2, 0x5D, 0xEF, 0x65, 0x31, 0x61, 0x10, 0x55, 0x71, 0x65,
+0x68, 0xC1, 0xE3, 0x20, 0x59, 0xCE, 0x71, 0x00, 0xC0, 0x4D, 0x6B, 0x74, 0x71, 0xC2, 0x1C, 0xE7,
+0x25, 0x29, 0xA2, 0x18, 0x4C, 0x71, 0x00, 0x40, 0xC0, 0x49, 0x4A, 0x71, 0x00, 0xA6, 0x7D, 0xC0,
+0xF7, 0xC5, 0x65, 0xC1, 0x96, 0xB5, 0x5D, 0xEF, 0x71, 0x03, 0xC0, 0xDB, 0xDE, 0x4B, 0x58, 0x71,
+0x00, 0xC0, 0x4D, 0x6B, 0x48, 0xC0, 0x51, 0x8C, 0x71, 0x06, 0xC1, 0xCB, 0x5A, 0x61, 0x10, 0x43,
+0x71, 0x02, 0xC0, 0xAA, 0x5A, 0x5C, 0x50, 0x71, 0x05, 0x61, 0xC2, 0x24, 0x29, 0xC3, 0x18, 0xE7,
+0x41, 0x74, 0x4B, 0x77, 0x40, 0x75, 0x71, 0x00, 0x49, 0xC1, 0x8E, 0x73, 0xAA, 0x52, 0x4C, 0x71,
+0x00, 0xC0, 0x69, 0x52, 0x5C, 0xC0, 0xD3, 0x9C, 0x71, 0x00, 0xC0, 0xCB, 0x5A, 0x48, 0x58, 0x71,
+0x00, 0x5C, 0xC0, 0x61, 0x10, 0x6D, 0x71, 0x51, 0x70, 0xC0, 0x86, 0x31, 0x49, 0xA6, 0x54, 0xC0,
+0x51, 0x8C, 0x71, 0x07, 0x75, 0xC0, 0x8A, 0x52, 0x68, 0x00, 0x77, 0x48, 0xC0, 0x18, 0xC6, 0x71,
+0x02, 0x48, 0xC1, 0x41, 0x08, 0x51, 0x8C, 0x71, 0x00, 0x48, 0xC0, 0x41, 0x08, 0x58, 0x71, 0x01,
+0xC0, 0x6D, 0x73, 0x54, 0x67, 0x71, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x58, 0x71, 0x00, 0x6C, 0x78,
+0x5C, 0xC0, 0x96, 0xB5, 0x71, 0x18, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0x79, 0xC0, 0x04, 0x21,
+0x68, 0xC0, 0x75, 0xB5, 0x71, 0x00, 0x55, 0x68, 0xC0, 0x24, 0x29, 0x5D, 0xBF, 0xAE, 0xC0, 0x69,
+0x52, 0x54, 0x64, 0xC1, 0xBE, 0xF7, 0x92, 0x94, 0x5C, 0xC1, 0x65, 0x31, 0xCF, 0x7B, 0x00, 0x71,
+0xC0, 0x08, 0x42, 0x4F, 0xC1, 0xE7, 0x41, 0xDF, 0xFF, 0xAE, 0x4C, 0xC1, 0x41, 0x08, 0x4D, 0x6B,
+0x71, 0x01, 0xC0, 0x28, 0x4A, 0x54, 0xC0, 0xD3, 0x9C, 0x71, 0xC2, 0x1C, 0xE7, 0x65, 0x31, 0x82,
+0x10, 0x64, 0x59, 0xC0, 0x5D, 0xEF, 0x71, 0x02, 0xC0, 0x4D, 0x6B, 0x54, 0xC0, 0x2C, 0x6B, 0x71,
+0x5D, 0xC0, 0x86, 0x31, 0x55, 0x71, 0x02, 0x75, 0x70, 0x71, 0x04, 0x49, 0x60, 0xC0, 0x69, 0x4A,
+0x71, 0x01, 0x4C, 0xC0, 0x20, 0x08, 0x59, 0x71, 0x06, 0xC0, 0xEB, 0x5A, 0x5C, 0xC0, 0x69, 0x52,
+0x71, 0x02, 0xC0, 0x8A, 0x52, 0x5C, 0xC0, 0xAB, 0x5A, 0x71, 0x05, 0xC0, 0xFB, 0xDE, 0x58, 0xC1,
+0xC3, 0x18, 0xEF, 0x7B, 0x47, 0xC1, 0x14, 0xA5, 0xAA, 0x5A, 0x68, 0x6C, 0xC1, 0xD7, 0xBD, 0xFF,
+0xFF, 0x02, 0x5D, 0x51, 0xC0, 0x51, 0x8C, 0x78, 0x68, 0x54, 0x71, 0xC1, 0xDB, 0xDE, 0x04, 0x21,
+0x63, 0xC0, 0x75, 0xAD, 0x71, 0x00, 0xC1, 0x5D, 0xEF, 0xBA, 0xD6, 0x71, 0x00, 0x4C, 0xC1, 0xA2,
+0x18, 0xA6, 0x39, 0x5C, 0x48, 0xC0, 0xE7, 0x41, 0x71, 0x09, 0xA6, 0x6D, 0x40, 0x68, 0x00, 0x7C,
+0x55, 0x71, 0x01, 0x48, 0xC1, 0x41, 0x08, 0x51, 0x8C, 0x71, 0x5C, 0x50, 0x68, 0x7D, 0x71, 0x01,
+0xC1, 0x6D, 0x6B, 0x41, 0x08, 0x67, 0x71, 0x6C, 0x60, 0x68, 0x74, 0xC0, 0xEF, 0x83, 0x96, 0x95,
+0x58, 0xC0, 0x20, 0x08, 0x45, 0x71, 0x18, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC0, 0x79, 0xCE,
+0x50, 0x68, 0xC0, 0x75, 0xB5, 0x71, 0x00, 0xC0, 0x51, 0x8C, 0x68, 0x78, 0x54, 0xBE, 0x00, 0x6D,
+0xBF, 0xC1, 0x14, 0xA5, 0xDF, 0xFF, 0x5D, 0x63, 0xC1, 0xE7, 0x41, 0x92, 0x94, 0x5C, 0x00, 0x70,
+0x7C, 0xC0, 0x55, 0xAD, 0x6C, 0x71, 0xC2, 0x6D, 0x73, 0x41, 0x08, 0x4D, 0x6B, 0x71, 0x01, 0xC0,
+0x49, 0x4A, 0x54, 0x41, 0x71, 0x00, 0x65, 0xC1, 0xE7, 0x41, 0x61, 0x10, 0x96, 0xC0, 0xA6, 0x31,
+0x64, 0x71, 0x01, 0x51, 0xC0, 0xA2, 0x18, 0x5F, 0xC1, 0x7D, 0xEF, 0xD7, 0xBD, 0x78, 0xC0, 0x9E,
+0xF7, 0x71, 0x0A, 0x59, 0xC2, 0x00, 0x00, 0x69, 0x52, 0x6D, 0x6B, 0xA1, 0x44, 0xC0, 0xA7, 0x39,
+0x77, 0x60, 0xC0, 0x0C, 0x63, 0x41, 0x71, 0x04, 0x44, 0x54, 0xC0, 0x29, 0x4A, 0x6C, 0x71, 0x00,
+0x6C, 0x74, 0x5C, 0x44, 0x71, 0x05, 0x61, 0xC2, 0x24, 0x29, 0xA2, 0x18, 0xB6, 0xBD, 0x71, 0x00,
+0x91, 0xC0, 0x28, 0x4A, 0x54, 0x68, 0x5D, 0x71, 0x61, 0xC1, 0xEF, 0x83, 0xA6, 0x39, 0x43, 0xC3,
+0x10, 0x84, 0xC7, 0x39, 0x82, 0x10, 0x51, 0x8C, 0x71, 0x51, 0xC0, 0xE3, 0x20, 0x68, 0xC0, 0xD7,
+0xBD, 0x71, 0x04, 0x4C, 0xC2, 0xC3, 0x18, 0x45, 0x29, 0xAA, 0x5A, 0x68, 0x44, 0x51, 0x71, 0x0A,
+0xC0, 0x5D, 0xEF, 0x40, 0xC0, 0xE3, 0x20, 0x70, 0xC0, 0x65, 0x31, 0x75, 0x71, 0x00, 0xC2, 0x8A,
+0x52, 0x41, 0x08, 0x51, 0x8C, 0x71, 0x4C, 0x7C, 0x70, 0x65, 0x71, 0x01, 0x49, 0xC0, 0x41, 0x08,
+0x67, 0x71, 0xC1, 0x5D, 0xEF, 0xA6, 0x39, 0x70, 0xC1, 0x0C, 0x63, 0x92, 0x94, 0xA5, 0x68, 0xC0,
+0xD3, 0x9C, 0x00, 0xC0, 0x38, 0xCE, 0x71, 0x18, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0x79, 0xC2,
+0x04, 0x21, 0x82, 0x10, 0x75, 0xB5, 0x71, 0x00, 0x70, 0xC1, 0x61, 0x10, 0x86, 0x31, 0x71, 0x05,
+0xC0, 0xEF, 0x7B, 0x54, 0xC1, 0x28, 0x42, 0xFF, 0xFF, 0x06, 0xC0, 0x6D, 0x73, 0x54, 0xC0, 0x4D,
+0x6B, 0x71, 0x01, 0xC0, 0x49, 0x4A, 0x54, 0x41, 0x71, 0x01, 0xC0, 0x9E, 0xF7, 0x41, 0xC0, 0xE7,
+0x39, 0x68, 0xBE, 0xC0, 0xD7, 0xBD, 0x71, 0x00, 0xA6, 0x60, 0x5C, 0x41, 0xC1, 0x2C, 0x6B, 0xCF,
+0x7B, 0x71, 0x0B, 0x41, 0x60, 0xBE, 0x60, 0x01, 0x64, 0xC0, 0xC3, 0x18, 0x73, 0xC0, 0xC7, 0x39,
+0x45, 0x71, 0x04, 0xC0, 0x92, 0x94, 0x5C, 0x47, 0xC0, 0x7D, 0xEF, 0x71, 0x00, 0x58, 0x40, 0x5C,
+0x6D, 0x71, 0x05, 0x61, 0xC0, 0x24, 0x29, 0x70, 0xC0, 0x96, 0xB5, 0x71, 0x01, 0xC0, 0xAE, 0x7B,
+0x5C, 0x73, 0x49, 0xC1, 0xFC, 0xE6, 0x86, 0x31, 0x54, 0xC0, 0xB2, 0x9C, 0x71, 0x00, 0x48, 0xC1,
+0x61, 0x08, 0x51, 0x8C, 0x71, 0xC1, 0x38, 0xC6, 0xE3, 0x20, 0x63, 0xC0, 0xF3, 0xA4, 0x71, 0x04,
+0xC1, 0xD7, 0xBD, 0xA2, 0x18, 0x73, 0x4D, 0xC3, 0x2C, 0x6B, 0x41, 0x08, 0x08, 0x42, 0x9E, 0xF7,
+0x71, 0x05, 0x79, 0xC1, 0xEF, 0x83, 0x5D, 0xEF, 0x71, 0x01, 0xC1, 0xEF, 0x7B, 0x82, 0x10, 0x7C,
+0xC1, 0x18, 0xC6, 0xFF, 0xFF, 0x00, 0x48, 0x54, 0xC0, 0x51, 0x8C, 0x71, 0xC0, 0xF8, 0xC5, 0x7C,
+0x68, 0xC0, 0xB6, 0xB5, 0x71, 0x01, 0xC1, 0x6D, 0x6B, 0x41, 0x08, 0x67, 0x71, 0x58, 0xC2, 0xC7,
+0x39, 0x41, 0x10, 0x72, 0x94, 0x71, 0x1E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC0, 0x79, 0xD6,
+0x50, 0x68, 0xC0, 0x96, 0xB5, 0x71, 0x00, 0xC0, 0x59, 0xCE, 0x77, 0x00, 0x69, 0x71, 0x04, 0x78,
+0x68, 0xC0, 0xE3, 0x20, 0x65, 0x71, 0x02, 0xA6, 0x71, 0x00, 0xC0, 0x6D, 0x73, 0x54, 0xC0, 0x4D,
+0x6B, 0x71, 0x01, 0xC0, 0x49, 0x4A, 0x54, 0x41, 0x71, 0x78, 0xC0, 0xAE, 0x73, 0x71, 0x00, 0xC1,
+0x7D, 0xEF, 0x28, 0x4A, 0x4F, 0xC0, 0x51, 0x8C, 0x71, 0x01, 0xC0, 0x92, 0x94, 0x5C, 0xC0, 0x86,
+0x31, 0xA5, 0xC0, 0xBA, 0xDE, 0x71, 0x11, 0x44, 0xC0, 0x20, 0x08, 0x54, 0x71, 0x01, 0xC2, 0x9A,
+0xD6, 0xCF, 0x7B, 0x59, 0xCE, 0x71, 0x00, 0x4D, 0xC0, 0xE3, 0x20, 0x96, 0x79, 0x71, 0x00, 0x79,
+0x7C, 0x44, 0x4D, 0x71, 0x05, 0x61, 0xC2, 0x24, 0x29, 0xA2, 0x18, 0x96, 0xB5, 0x71, 0x01, 0xC0,
+0x0C, 0x63, 0x5C, 0xC1, 0xE7, 0x41, 0xDF, 0xFF, 0x6D, 0xC1, 0x41, 0x08, 0x86, 0x31, 0x71, 0x01,
+0xC0, 0x8A, 0x52, 0x5C, 0xC0, 0x51, 0x8C, 0x71, 0x49, 0x78, 0xC0, 0x82, 0x10, 0x48, 0x71, 0x04,
+0xC1, 0xF7, 0xBD, 0xA2, 0x18, 0x78, 0xC2, 0x9E, 0xF7, 0xFB, 0xE6, 0x24, 0x29, 0x5C, 0x54, 0x71,
+0x05, 0xC1, 0x14, 0xA5, 0x41, 0x08, 0x74, 0x71, 0x01, 0x7D, 0xC2, 0x62, 0x10, 0x04, 0x21, 0xDB,
+0xDE, 0x71, 0x00, 0x48, 0x54, 0xC0, 0x51, 0x8C, 0x71, 0xC0, 0x1C, 0xE7, 0x58, 0x68, 0xC0, 0x2C,
+0x6B, 0x71, 0x01, 0xC0, 0x8E, 0x73, 0x4F, 0xC0, 0xCF, 0x7B, 0x71, 0x00, 0xC3, 0x2C, 0x63, 0x41,
+0x08, 0x28, 0x4A, 0xBE, 0xF7, 0x71, 0x02, 0x5D, 0x71, 0x18, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B,
+0x79, 0x4B, 0xC0, 0x82, 0x10, 0x69, 0x71, 0x00, 0xA6, 0x78, 0x54, 0xC0, 0x45, 0x29, 0x55, 0x61,
+0x5C, 0xC2, 0xF3, 0xA4, 0xAA, 0x52, 0x5D, 0xEF, 0x6C, 0x43, 0x54, 0x40, 0xC0, 0x96, 0xB5, 0x61,
+0x5C, 0xC1, 0x92, 0x94, 0xEB, 0x5A, 0x5D, 0x71, 0xC0, 0x6E, 0x73, 0x4F, 0xC0, 0x4D, 0x6B, 0x71,
+0x01, 0xC0, 0x49, 0x4A, 0x4F, 0xC0, 0x14, 0xA5, 0x71, 0xC0, 0xD3, 0x9C, 0x64, 0xC0, 0x9E, 0xF7,
+0x71, 0x00, 0x43, 0x54, 0xC0, 0xD7, 0xBD, 0x71, 0x01, 0xC0, 0x1C, 0xE7, 0x64, 0xC1, 0x61, 0x10,
+0xEC, 0x62, 0x71, 0x12, 0xC2, 0x6D, 0x6B, 0x20, 0x08, 0x51, 0x8C, 0x71, 0x00, 0x6C, 0x74, 0xC0,
+0x00, 0x08, 0x47, 0x5D, 0x71, 0x00, 0x67, 0x43, 0xC0, 0x8E, 0x73, 0x71, 0x00, 0xC2, 0xAE, 0x73,
+0x00, 0x00, 0xCF, 0x7B, 0x71, 0x06, 0xC3, 0xFC, 0xE6, 0x04, 0x21, 0xA2, 0x18, 0x75, 0xB5, 0x71,
+0xC0, 0x7D, 0xEF, 0x55, 0xC0, 0xE3, 0x20, 0x5C, 0x68, 0x71, 0x7C, 0xC0, 0x41, 0x08, 0x50, 0xC1,
+0x35, 0xAD, 0xDB, 0xDE, 0x55, 0xC2, 0x65, 0x31, 0x82, 0x10, 0x71, 0x94, 0x71, 0x00, 0x6D, 0x63,
+0x68, 0xC2, 0x4D, 0x6B, 0x79, 0xD6, 0xDB, 0xDE, 0x41, 0xC0, 0xCF, 0x7B, 0x71, 0x60, 0x70, 0x73,
+0x49, 0x71, 0xC1, 0x92, 0x94, 0x82, 0x10, 0x50, 0xC0, 0xBB, 0xDE, 0x71, 0x04, 0xC0, 0x55, 0xAD,
+0x54, 0x41, 0xC0, 0xDF, 0xFF, 0x71, 0xC1, 0x3C, 0xE7, 0xAA, 0x5A, 0x48, 0x53, 0x71, 0x01, 0xC0,
+0x8A, 0x52, 0x54, 0xC0, 0x71, 0x94, 0x71, 0x00, 0xC3, 0x6D, 0x6B, 0x61, 0x10, 0xE3, 0x20, 0xEF,
+0x83, 0x65, 0x69, 0xC0, 0x08, 0x42, 0x5C, 0xC0, 0xCF, 0x7B, 0x71, 0x00, 0xC1, 0x59, 0xCE, 0x04,
+0x21, 0x5C, 0xC0, 0xEC, 0x62, 0x74, 0xC0, 0xFB, 0xE6, 0x74, 0xC1, 0x4D, 0x6B, 0x71, 0x8C, 0x71,
+0x18, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A, 0xC2, 0x31, 0x8C, 0xA6, 0x39, 0xA2, 0x18, 0x68, 0xC0,
+0x65, 0x31, 0x58, 0xC0, 0xDF, 0xFF, 0x71, 0xC0, 0x9D, 0xF7, 0x49, 0xC1, 0xC3, 0x18, 0x41, 0x10,
+0x7C, 0x00, 0xC0, 0x45, 0x29, 0x45, 0x6C, 0x71, 0x75, 0x61, 0x70, 0x5C, 0x7C, 0x00, 0xC0, 0x86,
+0x31, 0x6D, 0x71, 0xC1, 0xEF, 0x83, 0x24, 0x29, 0x68, 0x50, 0x59, 0x71, 0x5D, 0x7C, 0x68, 0x78,
+0xC1, 0xF3, 0xA4, 0x96, 0xB5, 0x70, 0xC2, 0xE7, 0x41, 0x2C, 0x6B, 0x49, 0x4A, 0x7C, 0xC0, 0x10,
+0x84, 0x6C, 0x71, 0x02, 0x49, 0x57, 0xC0, 0xB6, 0xBD, 0x71, 0x12, 0x78, 0xC0, 0x00, 0x00, 0x45,
+0x71, 0x01, 0x61, 0xC0, 0x20, 0x08, 0x74, 0xC0, 0xBE, 0xF7, 0x71, 0x00, 0x5D, 0x49, 0x7C, 0xC0,
+0x8A, 0x52, 0x00, 0x7C, 0x53, 0x5D, 0x71, 0x05, 0xC1, 0x55, 0xAD, 0xC7, 0x39, 0x70, 0x00, 0xC0,
+0xA6, 0x39, 0x74, 0xC0, 0x86, 0x31, 0x7C, 0x4C, 0x6D, 0x71, 0x00, 0x75, 0x60, 0x63, 0x68, 0xC0,
+0xA6, 0x31, 0x4F, 0x74, 0xC2, 0x41, 0x08, 0x65, 0x31, 0x92, 0x94, 0x71, 0x00, 0xC1, 0x51, 0x8C,
+0x25, 0x29, 0x5C, 0xAF, 0x77, 0x78, 0x41, 0xC0, 0xB6, 0xB5, 0x4C, 0x68, 0x7C, 0xC2, 0xAA, 0x5A,
+0x1C, 0xE7, 0xBE, 0xFF, 0x78, 0xC0, 0x41, 0x08, 0x78, 0xC0, 0x92, 0x94, 0x71, 0x03, 0xC3, 0xD7,
+0xBD, 0x45, 0x29, 0xE3, 0x20, 0x08, 0x42, 0x74, 0x58, 0x44, 0xC1, 0xCF, 0x7B, 0x9E, 0xF7, 0x71,
+0xC1, 0x5D, 0xEF, 0x4D, 0x6B, 0x4B, 0xC2, 0x82, 0x10, 0x65, 0x31, 0x10, 0x84, 0x71, 0xC0, 0x5D,
+0xEF, 0x50, 0x68, 0x54, 0x7C, 0x49, 0xC0, 0x69, 0x52, 0x5C, 0x5F, 0x45, 0x71, 0x00, 0xC1, 0xB6,
+0xBD, 0xC7, 0x39, 0x5C, 0x68, 0xC0, 0xE3, 0x20, 0x00, 0x6F, 0xC0, 0x38, 0xCE, 0x71, 0x18, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x1A, 0xC2, 0x9A, 0xD6, 0x18, 0xC6, 0x59, 0xCE, 0x00, 0x60, 0x74, 0x71,
+0x02, 0xC0, 0xBA, 0xD6, 0x69, 0x55, 0x60, 0xC0, 0x7D, 0xEF, 0x71, 0x03, 0xC1, 0x79, 0xD6, 0x55,
+0xAD, 0x00, 0x68, 0x58, 0x71, 0x00, 0x74, 0x65, 0x74, 0x60, 0xC0, 0x7A, 0xD6, 0x71, 0x68, 0x65,
+0x74, 0x60, 0x4D, 0xC0, 0xDF, 0xFF, 0x48, 0x64, 0x6D, 0xC0, 0xF3, 0xA4, 0x4D, 0x71, 0x04, 0xC1,
+0xD3, 0x9C, 0xA6, 0x39, 0x5D, 0x71, 0x12, 0x59, 0xC0, 0xE7, 0x41, 0x55, 0x71, 0x01, 0xC1, 0x5D,
+0xEF, 0x96, 0xB5, 0x75, 0x71, 0x03, 0x79, 0x70, 0x00, 0x79, 0x71, 0x07, 0xC1, 0xFB, 0xDE, 0xF7,
+0xBD, 0x74, 0x00, 0x65, 0x60, 0x65, 0x4D, 0x58, 0x71, 0x02, 0x49, 0x78, 0xA5, 0xC0, 0x1C, 0xE7,
+0x71, 0x70, 0x68, 0x60, 0x48, 0x71, 0x01, 0x70, 0xC0, 0xB6, 0xBD, 0x64, 0x65, 0x58, 0x71, 0x61,
+0x51, 0x74, 0x00, 0xC0, 0xF7, 0xC5, 0x58, 0x71, 0x4D, 0x74, 0x60, 0x43, 0x71, 0x04, 0x70, 0x51,
+0xC0, 0x14, 0xA5, 0x6D, 0x6C, 0x61, 0x71, 0x01, 0x5D, 0x60, 0x68, 0x74, 0x60, 0x74, 0x71, 0x00,
+0xA6, 0x51, 0x64, 0x48, 0x71, 0x70, 0x68, 0x60, 0x74, 0x71, 0x01, 0x58, 0x54, 0x55, 0x78, 0x4D,
+0x71, 0x1A, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x09, 0x48, 0x71, 0x00, 0xC0, 0x08, 0x42, 0x70,
+0x71, 0xE0, 0x5C, 0x70, 0x00, 0x71, 0xE0, 0x08, 0x65, 0xC3, 0xC3, 0x18, 0x2C, 0x63, 0x6D, 0x6B,
+0x28, 0x4A, 0x5D, 0x71, 0xE0, 0x5C, 0x70, 0x00, 0x71, 0xE0, 0x08, 0x74, 0xC2, 0x04, 0x21, 0x41,
+0x08, 0xE7, 0x41, 0x61, 0x71, 0xE0, 0x5D, 0x70, 0x00, 0x71, 0xE0, 0x09, 0x48, 0x40, 0x5D, 0x71,
+0xE0, 0x5E, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0,
+0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0x22, 0x6C,
+0x00, 0x71, 0x01, 0x65, 0xC0, 0x1C, 0xE7, 0x71, 0x00, 0x4D, 0xA1, 0x58, 0xC0, 0x3C, 0xE7, 0x71,
+0x00, 0x5D, 0x61, 0x71, 0x0A, 0xC0, 0x18, 0xC6, 0x75, 0x71, 0x04, 0xC0, 0xDB, 0xDE, 0x71, 0x10,
+0x6C, 0x51, 0x58, 0x71, 0x01, 0x60, 0x79, 0x71, 0x20, 0xC0, 0x7D, 0xEF, 0x70, 0x74, 0x70, 0x71,
+0x01, 0x44, 0x5B, 0x71, 0x00, 0x70, 0x60, 0x71, 0x10, 0x74, 0xC0, 0xBA, 0xDE, 0x71, 0x05, 0x75,
+0x60, 0x71, 0x07, 0x60, 0x44, 0x71, 0x04, 0x6C, 0x5C, 0x71, 0x00, 0x4D, 0x79, 0x71, 0x25, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x22, 0xC0, 0xF4, 0xA4, 0x91, 0x71, 0x01, 0xC0, 0xD3, 0x9C, 0x78, 0x71,
+0x00, 0x60, 0xC0, 0x92, 0x94, 0x75, 0x48, 0x58, 0xBF, 0x58, 0x60, 0x71, 0x0A, 0x6D, 0x51, 0x71,
+0x04, 0x51, 0x6C, 0x71, 0x10, 0xC0, 0xEF, 0x83, 0x5C, 0x71, 0x00, 0x65, 0x69, 0x44, 0x71, 0x05,
+0x49, 0x71, 0x18, 0xC0, 0x1C, 0xE7, 0x48, 0xC0, 0x14, 0xA5, 0x7D, 0x71, 0x01, 0x58, 0x74, 0x67,
+0x71, 0x61, 0x74, 0x71, 0x0E, 0x58, 0x71, 0x78, 0x50, 0x71, 0x05, 0x75, 0xC0, 0x10, 0x84, 0x71,
+0x07, 0x68, 0xC0, 0x38, 0xCE, 0x71, 0x04, 0x6C, 0x51, 0x71, 0x00, 0x60, 0x59, 0x71, 0x25, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x21, 0x5D, 0x50, 0xC0, 0xF0, 0x83, 0x6C, 0x75, 0xC0, 0xB6, 0xBD, 0x45,
+0xC0, 0xD7, 0xBD, 0x6C, 0xC0, 0xB7, 0xBD, 0x41, 0x70, 0xC0, 0x59, 0xCE, 0x48, 0xC1, 0x72, 0x94,
+0xF3, 0xA4, 0x74, 0xC2, 0xF7, 0xC5, 0x7D, 0xF7, 0x76, 0xB5, 0x00, 0xC0, 0x5D, 0xEF, 0x91, 0xC0,
+0xB2, 0x9C, 0x7C, 0xC1, 0xD7, 0xBD, 0x1C, 0xE7, 0x69, 0x64, 0x6C, 0x64, 0x60, 0x71, 0x58, 0x7C,
+0x50, 0x55, 0x70, 0x78, 0x71, 0x55, 0x50, 0xC0, 0xB2, 0x9C, 0x75, 0x7D, 0x00, 0x5D, 0x71, 0x75,
+0xC0, 0x75, 0xB5, 0x64, 0x58, 0x4C, 0x41, 0xC1, 0x92, 0x94, 0x1C, 0xE7, 0x5C, 0x4C, 0xC0, 0xAE,
+0x7B, 0x70, 0x71, 0x00, 0xC1, 0x51, 0x8C, 0xB2, 0x9C, 0x44, 0x5B, 0x6C, 0xC0, 0x1C, 0xE7, 0x4C,
+0x64, 0x5C, 0x74, 0xC0, 0xAE, 0x73, 0x79, 0x55, 0x49, 0x55, 0x48, 0x41, 0xC0, 0x34, 0xAD, 0x70,
+0xC0, 0x18, 0xC6, 0x6C, 0x5C, 0x7D, 0x00, 0xC0, 0xBE, 0xF7, 0x71, 0x00, 0x51, 0x64, 0x60, 0x50,
+0x5C, 0xC1, 0x39, 0xCE, 0x79, 0xD6, 0x65, 0x64, 0x60, 0xBE, 0x48, 0x7D, 0x51, 0x49, 0x6C, 0x64,
+0x70, 0x45, 0x64, 0x78, 0x49, 0x59, 0x71, 0x48, 0x78, 0x60, 0x71, 0x00, 0xC0, 0xBA, 0xDE, 0x73,
+0x7D, 0x49, 0xC0, 0xF3, 0xA4, 0xAF, 0x91, 0xC0, 0xDF, 0xFF, 0x71, 0x6C, 0xC0, 0xCF, 0x7B, 0x78,
+0x60, 0xC0, 0x10, 0x84, 0x6D, 0x5C, 0x70, 0xC0, 0xB6, 0xBD, 0x7D, 0x71, 0x00, 0xC0, 0x9E, 0xF7,
+0x7B, 0x64, 0x7D, 0x49, 0x73, 0x91, 0x49, 0xA6, 0x78, 0x00, 0x7C, 0x74, 0x69, 0x44, 0x71, 0x58,
+0x78, 0x4C, 0x4D, 0x7D, 0xC0, 0xDF, 0xFF, 0x47, 0x41, 0x6D, 0x71, 0x65, 0xC0, 0x75, 0xB5, 0x4D,
+0x71, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0x79, 0xC1, 0xF3, 0xA4, 0xCF, 0x7B, 0x65, 0x7C,
+0xC0, 0x1C, 0xE7, 0x78, 0x60, 0x7D, 0x51, 0x5C, 0x50, 0x4C, 0x78, 0x41, 0x79, 0xC0, 0xBA, 0xDE,
+0x6D, 0x7C, 0x74, 0x48, 0xC2, 0x92, 0x94, 0x5D, 0xEF, 0x10, 0x84, 0x75, 0x40, 0xC0, 0xFC, 0xE6,
+0x6F, 0x6C, 0x70, 0x64, 0x60, 0x71, 0xA6, 0xC0, 0xEF, 0x83, 0x75, 0x6D, 0x69, 0x54, 0x71, 0x54,
+0x48, 0x7C, 0x69, 0xC1, 0xAF, 0x7B, 0x38, 0xCE, 0x6C, 0x71, 0x44, 0x65, 0x40, 0x79, 0x78, 0x69,
+0x4C, 0xC0, 0xB2, 0x9C, 0x96, 0x58, 0x68, 0x61, 0x71, 0x00, 0x41, 0x65, 0x69, 0x68, 0x00, 0x78,
+0x65, 0xC0, 0x14, 0xA5, 0x41, 0x5C, 0x68, 0x5D, 0x45, 0x49, 0x59, 0xC1, 0x59, 0xCE, 0xCF, 0x7B,
+0x49, 0x50, 0x6D, 0x00, 0x7C, 0x6C, 0xC1, 0x38, 0xCE, 0xDF, 0xFF, 0x71, 0x00, 0x65, 0x7D, 0x4F,
+0x69, 0x7D, 0x51, 0x49, 0x74, 0x4C, 0x40, 0x4C, 0x69, 0x4C, 0x51, 0x58, 0x65, 0x54, 0x78, 0xC0,
+0x92, 0x94, 0x58, 0x45, 0xC0, 0xF7, 0xC5, 0x6D, 0xC1, 0x7D, 0xF7, 0xAE, 0x7B, 0x78, 0xC0, 0xEF,
+0x83, 0x6C, 0x00, 0xC0, 0xEF, 0x7B, 0x49, 0x64, 0x69, 0xC0, 0x51, 0x8C, 0x61, 0x45, 0x61, 0xC0,
+0xFF, 0xFF, 0x00, 0x4F, 0x61, 0xC0, 0x18, 0xC6, 0x55, 0x60, 0x70, 0x54, 0x78, 0xC0, 0xCF, 0x7B,
+0x44, 0x71, 0x58, 0x54, 0x58, 0x74, 0x79, 0x65, 0x54, 0x60, 0x70, 0x48, 0x4D, 0x7C, 0x40, 0xC0,
+0x59, 0xCE, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x53, 0x79, 0x70, 0x59, 0x69, 0x51, 0x5C, 0x41, 0xC1,
+0xBB, 0xDE, 0xEF, 0x83, 0x55, 0x6D, 0x71, 0x21, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0x64, 0x61,
+0xC0, 0x38, 0xCE, 0x45, 0x40, 0x49, 0xC1, 0x75, 0xB5, 0xF7, 0xC5, 0x50, 0x60, 0x5C, 0x7C, 0x60,
+0x91, 0xC0, 0xF3, 0xA4, 0x4D, 0xC0, 0x1C, 0xE7, 0x7C, 0x91, 0x4D, 0x61, 0xC0, 0x51, 0x8C, 0x49,
+0x54, 0x71, 0x54, 0x64, 0x60, 0x54, 0xC1, 0xFB, 0xE6, 0x55, 0xAD, 0x60, 0x71, 0x00, 0x59, 0xC0,
+0xDF, 0xFF, 0x50, 0x7D, 0xC0, 0x71, 0x94, 0x71, 0x6D, 0x70, 0x64, 0x4C, 0x48, 0xC1, 0xAE, 0x7B,
+0x5D, 0xEF, 0x71, 0x4C, 0x7D, 0xC1, 0xB2, 0x9C, 0x59, 0xCE, 0x4C, 0x00, 0x48, 0x54, 0x40, 0x71,
+0x59, 0xC0, 0xDB, 0xDE, 0x71, 0x00, 0x50, 0x48, 0x50, 0x78, 0x6C, 0x4D, 0x7C, 0x4C, 0x41, 0x5C,
+0x68, 0x71, 0x45, 0x49, 0x68, 0x79, 0x59, 0x71, 0x7C, 0x78, 0x6C, 0x44, 0x79, 0x60, 0x44, 0x71,
+0xC0, 0x7D, 0xF7, 0x68, 0x74, 0x4F, 0x49, 0xC1, 0x8E, 0x73, 0x18, 0xC6, 0x6C, 0x68, 0x74, 0x54,
+0xC0, 0xF7, 0xC5, 0x78, 0xBE, 0x51, 0x74, 0x78, 0x50, 0x69, 0x68, 0x71, 0x68, 0x60, 0x63, 0x44,
+0xC1, 0xCF, 0x7B, 0x9E, 0xF7, 0x5D, 0x71, 0xA6, 0xC1, 0xCF, 0x7B, 0xDF, 0xFF, 0x78, 0x5F, 0x6D,
+0x58, 0x6D, 0x4D, 0x71, 0x00, 0xC0, 0x51, 0x8C, 0x44, 0x65, 0x69, 0x61, 0x68, 0xC0, 0x10, 0x84,
+0x75, 0x5D, 0x6C, 0x71, 0x49, 0x54, 0x71, 0x63, 0x50, 0x7D, 0xC0, 0xF3, 0xA4, 0x51, 0x54, 0x48,
+0x71, 0x50, 0xC0, 0xCF, 0x7B, 0x50, 0x71, 0x00, 0x58, 0x74, 0x6C, 0x4D, 0x70, 0x7C, 0x60, 0x5C,
+0x7C, 0x79, 0x59, 0xC0, 0xDF, 0xFF, 0x58, 0x71, 0x21, 0x70, 0x00, 0x71, 0x20, 0x75, 0xC0, 0x71,
+0x94, 0x71, 0x49, 0xC0, 0xEF, 0x7B, 0x55, 0x5C, 0x68, 0x78, 0xC0, 0x5D, 0xEF, 0x45, 0x7C, 0x00,
+0x69, 0x64, 0x60, 0x50, 0x65, 0x68, 0x61, 0x55, 0x00, 0xC0, 0x1C, 0xE7, 0x61, 0x54, 0xC0, 0xFB,
+0xE6, 0x54, 0x50, 0x00, 0x6D, 0x74, 0x50, 0x78, 0xC0, 0xFF, 0xFF, 0x00, 0x40, 0x50, 0x7D, 0x70,
+0x45, 0x44, 0x68, 0x79, 0x50, 0xC0, 0xB2, 0x9C, 0x69, 0xA6, 0x58, 0x71, 0x60, 0x77, 0x41, 0x51,
+0x69, 0x78, 0x51, 0x4B, 0x69, 0x6D, 0xC0, 0x30, 0x8C, 0x79, 0x71, 0x00, 0x7C, 0xC0, 0xD7, 0xBD,
+0x49, 0x68, 0x64, 0x74, 0x5C, 0x69, 0x41, 0x44, 0x59, 0x61, 0x78, 0x68, 0x63, 0x78, 0x48, 0x49,
+0x00, 0x68, 0x69, 0x51, 0x64, 0x00, 0x58, 0x71, 0x5D, 0x59, 0x78, 0x5C, 0x6C, 0x50, 0x61, 0x6C,
+0x5C, 0x78, 0x68, 0xC0, 0x34, 0xAD, 0x50, 0x55, 0x78, 0x43, 0x6D, 0x50, 0x69, 0x7C, 0x69, 0xC1,
+0x38, 0xCE, 0xDB, 0xDE, 0x40, 0x5D, 0x78, 0x70, 0x60, 0x71, 0x00, 0x74, 0x58, 0x64, 0x75, 0x54,
+0x5C, 0xC0, 0x92, 0x94, 0x74, 0x71, 0x00, 0x69, 0x00, 0xBA, 0x58, 0x65, 0x7C, 0x65, 0x68, 0x4C,
+0x5D, 0x71, 0x5D, 0x68, 0x69, 0x79, 0x00, 0x68, 0x50, 0x4C, 0x61, 0x54, 0x78, 0x68, 0x65, 0x50,
+0x74, 0x71, 0x61, 0x58, 0x6C, 0xC0, 0x9A, 0xD6, 0x54, 0xC0, 0xBA, 0xDE, 0x54, 0x7C, 0x6D, 0xC0,
+0xDF, 0xFF, 0x41, 0x4B, 0x48, 0x71, 0x21, 0x70, 0x00, 0x71, 0xE0, 0x02, 0x6C, 0xC0, 0xCF, 0x7B,
+0x61, 0x71, 0x1C, 0xA6, 0x71, 0x06, 0x6C, 0x71, 0x04, 0x6C, 0x71, 0x1D, 0x6C, 0x71, 0x31, 0x6C,
+0x71, 0x22, 0x70, 0x00, 0x71, 0xE0, 0x02, 0x5D, 0x60, 0xC0, 0x3C, 0xEF, 0x71, 0xE0, 0x65, 0x70,
+0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00,
+0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71,
+0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0x0A, 0x6C, 0xA5, 0x09, 0x71, 0x06,
+0xA2, 0x0A, 0x6C, 0x71, 0x13, 0xA5, 0x07, 0x6C, 0x71, 0x05, 0x6C, 0x04, 0x71, 0x0C, 0x6C, 0x04,
+0x71, 0x06, 0x65, 0x07, 0x71, 0x18, 0x67, 0x0A, 0x6C, 0x71, 0x03, 0x60, 0x0A, 0x71, 0x36, 0x70,
+0x00, 0x71, 0x08, 0x60, 0xC1, 0x39, 0xFE, 0xB6, 0xFD, 0x00, 0xA6, 0x01, 0x58, 0x53, 0x00, 0x58,
+0x53, 0x00, 0x58, 0x00, 0xC0, 0xFB, 0xFE, 0x71, 0x02, 0xC1, 0x1E, 0xE7, 0xFB, 0xCD, 0x00, 0xBF,
+0x96, 0xA5, 0x7A, 0x42, 0x7A, 0x00, 0x73, 0x6E, 0x73, 0xAF, 0x7A, 0xC1, 0x5C, 0xD6, 0xBF, 0xF7,
+0x71, 0x00, 0x64, 0x82, 0xA6, 0x00, 0xA9, 0xA6, 0x9A, 0x48, 0x43, 0x00, 0x4F, 0x48, 0x64, 0x71,
+0x00, 0xA0, 0xC0, 0xF7, 0xFE, 0xA0, 0xAE, 0x00, 0x79, 0x7E, 0x00, 0x79, 0x7E, 0xAE, 0x7E, 0xC0,
+0x18, 0xFF, 0x65, 0x71, 0x01, 0x44, 0x4D, 0x5C, 0x9A, 0x4D, 0x01, 0x59, 0x5C, 0xC0, 0xBE, 0xF7,
+0x71, 0x08, 0x5D, 0x5C, 0x59, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x4D, 0x44, 0x71, 0x02, 0xC0, 0x39,
+0xFF, 0x79, 0x7E, 0x79, 0x00, 0x7E, 0x00, 0x79, 0x00, 0x7E, 0x00, 0xAB, 0xC0, 0x9C, 0xFF, 0x71,
+0x01, 0xC0, 0x9F, 0xEF, 0x4F, 0x48, 0x40, 0xBA, 0x02, 0x40, 0x4F, 0x48, 0xBE, 0x71, 0x05, 0xC0,
+0x1E, 0xE7, 0x73, 0x7F, 0x7A, 0x73, 0x7F, 0x7A, 0x73, 0x6E, 0x73, 0x7A, 0x6E, 0x73, 0x7F, 0x7A,
+0x4C, 0x64, 0x71, 0xC1, 0x5D, 0xFF, 0xF7, 0xFD, 0x58, 0x53, 0x05, 0x58, 0x53, 0x00, 0x58, 0xC1,
+0x18, 0xFE, 0x9E, 0xFF, 0x71, 0x34, 0x70, 0x00, 0x71, 0x08, 0xC4, 0x59, 0xFE, 0x14, 0xF5, 0x72,
+0xCC, 0xF3, 0xE4, 0x35, 0xF5, 0xA9, 0xAF, 0xC1, 0xF4, 0xEC, 0x55, 0xFD, 0x66, 0x95, 0x7F, 0x42,
+0x57, 0x7F, 0x42, 0x4A, 0x71, 0x00, 0xC1, 0x5E, 0xEF, 0xBB, 0xC5, 0x01, 0xC5, 0x75, 0x9C, 0xF7,
+0xAC, 0xDB, 0xCD, 0x79, 0xBD, 0x54, 0x94, 0x59, 0xBD, 0xAF, 0xBE, 0x66, 0x5A, 0xC1, 0x95, 0x9C,
+0x18, 0xAD, 0x66, 0x4C, 0x71, 0x00, 0x43, 0xC0, 0x3A, 0xBE, 0x91, 0x00, 0x70, 0xC0, 0xBC, 0xD6,
+0x48, 0xC1, 0xBC, 0xCE, 0x1D, 0xDF, 0x91, 0xC3, 0x98, 0xAD, 0xDD, 0xD6, 0x3E, 0xE7, 0xDF, 0xFF,
+0x71, 0x45, 0xC0, 0x93, 0xFE, 0xAF, 0xC1, 0x32, 0xEE, 0x93, 0xF6, 0x72, 0x4A, 0x92, 0x72, 0xA6,
+0xC1, 0x50, 0xCD, 0x53, 0xF6, 0x66, 0xC0, 0x18, 0xFF, 0x71, 0x00, 0xC1, 0x9E, 0xEF, 0x9A, 0xCE,
+0xA5, 0xC2, 0x34, 0xA5, 0xD7, 0xB5, 0xBA, 0xD6, 0x45, 0x79, 0xC0, 0x18, 0xBE, 0x79, 0xC0, 0xDB,
+0xD6, 0x6C, 0x71, 0x06, 0x6C, 0x59, 0x79, 0xC0, 0x75, 0xAD, 0x00, 0x4D, 0x79, 0xC0, 0x96, 0xAD,
+0x69, 0x79, 0x45, 0xC0, 0x9E, 0xEF, 0x71, 0x00, 0xC0, 0x5A, 0xFF, 0x66, 0x6D, 0x4A, 0x6D, 0x72,
+0xC0, 0x12, 0xE6, 0x00, 0x72, 0x6D, 0x7D, 0xC0, 0x53, 0xEE, 0x66, 0x72, 0x65, 0x71, 0x64, 0x67,
+0x5C, 0xC0, 0x7B, 0xCE, 0x43, 0xC1, 0x9C, 0xCE, 0x1E, 0xDF, 0xA5, 0x58, 0x43, 0xC1, 0xB8, 0xB5,
+0x3A, 0xC6, 0x7B, 0x50, 0x71, 0x03, 0xC1, 0x5E, 0xEF, 0xBB, 0xC5, 0x00, 0xC1, 0x96, 0xA4, 0xF8,
+0xAC, 0x5A, 0xC2, 0xD7, 0xAC, 0x18, 0xAD, 0xDB, 0xC5, 0x66, 0x00, 0x46, 0x66, 0xA6, 0x4A, 0xC0,
+0x18, 0xB5, 0x66, 0x4C, 0xC1, 0x9E, 0xFF, 0x96, 0xFD, 0x57, 0xC0, 0x71, 0xCC, 0x7A, 0x95, 0xC0,
+0x55, 0xFD, 0x6B, 0xBE, 0x7A, 0x6B, 0x95, 0x7A, 0xC0, 0x75, 0xFD, 0x57, 0xC2, 0x14, 0xF5, 0xF7,
+0xFD, 0xFF, 0xFF, 0x34, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0xA2, 0xC6, 0xD7, 0xFD, 0x31, 0xC4,
+0x49, 0x62, 0xAA, 0x72, 0x8E, 0xA3, 0x10, 0xBC, 0xB2, 0xD4, 0x59, 0x7A, 0xC4, 0x4D, 0x93, 0x29,
+0x5A, 0x71, 0xCC, 0xF4, 0xE4, 0xE7, 0x49, 0x7A, 0x42, 0xC1, 0xBA, 0xFE, 0xFF, 0xFF, 0x00, 0xC0,
+0xBD, 0xDE, 0x61, 0xC3, 0xFC, 0xCD, 0xD2, 0x83, 0xED, 0x62, 0x70, 0x7B, 0x46, 0x72, 0xBF, 0xC0,
+0xB1, 0x83, 0x00, 0xC2, 0xD7, 0xA4, 0x1C, 0xCE, 0xD6, 0xA4, 0x72, 0x91, 0xC1, 0x39, 0xB5, 0xDB,
+0xCD, 0x67, 0x9E, 0x43, 0xC1, 0xD5, 0x94, 0xCD, 0x52, 0xBE, 0x47, 0xC4, 0x52, 0x84, 0xDD, 0xD6,
+0x32, 0x84, 0xBC, 0xD6, 0x12, 0x7C, 0x91, 0xC0, 0x3A, 0xC6, 0x43, 0xC0, 0xBF, 0xF7, 0xB8, 0x6D,
+0xAE, 0x00, 0xC3, 0x88, 0x62, 0x70, 0xCD, 0xD5, 0xFE, 0x6A, 0x7B, 0x92, 0xC4, 0xF5, 0xFE, 0xEF,
+0xB4, 0xE9, 0x6A, 0x0C, 0x94, 0xD4, 0xFE, 0x7E, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x4D, 0xC1, 0x75,
+0xAD, 0x2D, 0x6B, 0x95, 0x5D, 0xC2, 0xFB, 0xDE, 0xB2, 0x94, 0xEB, 0x62, 0x4D, 0x96, 0xC0, 0xBE,
+0xF7, 0x71, 0x06, 0xC4, 0x9E, 0xF7, 0x9A, 0xD6, 0x38, 0xC6, 0x6D, 0x6B, 0xEB, 0x5A, 0x69, 0xC3,
+0xD7, 0xB5, 0xAB, 0x5A, 0xCF, 0x7B, 0x59, 0xC6, 0x45, 0xC1, 0x3C, 0xE7, 0xFF, 0xFF, 0x00, 0x51,
+0xC0, 0xB3, 0xFE, 0x92, 0xC2, 0x68, 0x5A, 0xF2, 0xE5, 0x94, 0xFE, 0x59, 0xC0, 0x8B, 0x83, 0x43,
+0xC2, 0xF2, 0xDD, 0x47, 0x52, 0xAE, 0xAC, 0x43, 0xC1, 0x93, 0xFE, 0x7B, 0xFF, 0x71, 0xC1, 0x9F,
+0xEF, 0x98, 0xAD, 0x6F, 0xC4, 0x4F, 0x63, 0x7B, 0xC6, 0xF5, 0x9C, 0xD9, 0xB5, 0x36, 0xA5, 0x43,
+0x00, 0xC2, 0x4F, 0x63, 0x16, 0x9D, 0x3E, 0xE7, 0x00, 0x71, 0x03, 0xCE, 0xBD, 0xDE, 0xDB, 0xCD,
+0x14, 0x94, 0xF0, 0x6A, 0x93, 0x83, 0x96, 0xA4, 0x8E, 0x62, 0xF0, 0x6A, 0xB3, 0x83, 0xFC, 0xCD,
+0x38, 0xB5, 0x4D, 0x5A, 0xDB, 0xC5, 0xD7, 0xAC, 0x10, 0x73, 0x91, 0xC5, 0x59, 0xB5, 0x1C, 0xCE,
+0xBB, 0xF6, 0x96, 0xFD, 0x0C, 0x8B, 0x69, 0x6A, 0x7F, 0xC4, 0x6D, 0x9B, 0x14, 0xE5, 0x4D, 0x93,
+0xEF, 0xB3, 0x51, 0xC4, 0x55, 0xC0, 0xAA, 0x72, 0x46, 0xC4, 0x55, 0xF5, 0xE7, 0x49, 0xD3, 0xE4,
+0x76, 0xFD, 0x7D, 0xFF, 0x71, 0x33, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0xA1, 0xC0, 0xD7, 0xFD,
+0x55, 0x69, 0x00, 0xC1, 0x0C, 0x83, 0xAF, 0xAB, 0x69, 0x59, 0xC1, 0xB2, 0xD4, 0x6E, 0x9B, 0x59,
+0xC0, 0xCF, 0xAB, 0x69, 0xC1, 0x28, 0x5A, 0x34, 0xED, 0x42, 0xC0, 0x9A, 0xFE, 0x71, 0x00, 0x65,
+0xC0, 0xBB, 0xC5, 0xBE, 0xC0, 0x0E, 0x6B, 0x66, 0xC2, 0x3D, 0xD6, 0x33, 0x94, 0xD2, 0x83, 0x4E,
+0x6E, 0xC0, 0xB1, 0x7B, 0x54, 0xC0, 0xDC, 0xCD, 0x66, 0xC2, 0x1D, 0xD6, 0xF2, 0x8B, 0x54, 0x9C,
+0x7A, 0xC0, 0x9F, 0xF7, 0xAE, 0x7B, 0x5C, 0xC0, 0x57, 0xA5, 0xAE, 0x64, 0xC2, 0x15, 0x9D, 0xB0,
+0x73, 0x36, 0x9D, 0x73, 0xC1, 0x73, 0x84, 0x1D, 0xDF, 0xBF, 0x7B, 0xC0, 0xBF, 0xF7, 0xB8, 0x72,
+0xAE, 0xC5, 0x12, 0xE6, 0xE9, 0x6A, 0xAE, 0xB4, 0xF5, 0xFE, 0x33, 0xEE, 0xEC, 0x93, 0x72, 0xC1,
+0xCC, 0x8B, 0x53, 0xEE, 0x65, 0xC1, 0x32, 0xEE, 0xD5, 0xFE, 0x71, 0x00, 0xC1, 0x1C, 0xE7, 0x79,
+0xCE, 0xAF, 0xC4, 0x1C, 0xDF, 0x71, 0x8C, 0x14, 0x9D, 0xDB, 0xD6, 0xAE, 0x73, 0xA6, 0x45, 0x00,
+0xC0, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x45, 0x00, 0x59, 0xC4, 0x75, 0xAD, 0x51, 0x8C, 0xB6, 0xB5,
+0x10, 0x84, 0xBA, 0xD6, 0x00, 0x45, 0x70, 0x71, 0x00, 0xC0, 0xF7, 0xFE, 0x77, 0xC2, 0xB1, 0xD5,
+0xC9, 0x6A, 0x0F, 0xBD, 0x43, 0xC1, 0xD2, 0xDD, 0x0D, 0x9C, 0x72, 0x77, 0xC0, 0x0F, 0xC5, 0x5A,
+0x7E, 0xA0, 0xC0, 0x7B, 0xFF, 0x71, 0x5C, 0xC1, 0x77, 0xA5, 0xB8, 0xAD, 0x00, 0xC2, 0xF5, 0x9C,
+0xBC, 0xD6, 0xF1, 0x73, 0x4B, 0xC1, 0xFD, 0xD6, 0x32, 0x84, 0x73, 0xC0, 0x5E, 0xE7, 0x7B, 0xBE,
+0x71, 0x03, 0xC3, 0xBD, 0xDE, 0xDB, 0xC5, 0x51, 0x7B, 0x9A, 0xBD, 0x4E, 0xC4, 0x96, 0xA4, 0x15,
+0x94, 0x1C, 0xCE, 0x31, 0x73, 0x59, 0xB5, 0x4A, 0xC1, 0xAF, 0x62, 0xF8, 0xAC, 0x6E, 0xC2, 0x1C,
+0xD6, 0x14, 0x94, 0x76, 0x9C, 0x7F, 0xC8, 0x9A, 0xF6, 0x96, 0xFD, 0x4D, 0x93, 0x35, 0xED, 0x6D,
+0x9B, 0x0C, 0x8B, 0x71, 0xCC, 0x2D, 0x8B, 0xAE, 0xA3, 0x46, 0xC1, 0x72, 0xCC, 0x0C, 0x83, 0x53,
+0xC5, 0xB2, 0xD4, 0x08, 0x5A, 0xD3, 0xE4, 0x96, 0xFD, 0x7D, 0xFF, 0xFF, 0xFF, 0x33, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x07, 0xA1, 0xC2, 0xD7, 0xFD, 0x30, 0xBC, 0x6D, 0x93, 0xA2, 0xC0, 0xCF, 0xAB,
+0x91, 0x7E, 0x81, 0x7E, 0x00, 0xC0, 0x4D, 0x93, 0xBF, 0xC4, 0xAF, 0xA3, 0xCB, 0x7A, 0x14, 0xED,
+0x55, 0xFD, 0x9A, 0xFE, 0x71, 0x00, 0x65, 0xC0, 0x9B, 0xC5, 0x7A, 0xC4, 0xB1, 0x83, 0x6B, 0x52,
+0xF7, 0xAC, 0xD1, 0x83, 0xB6, 0xA4, 0x7A, 0x00, 0x78, 0xC1, 0xD6, 0xA4, 0xDC, 0xCD, 0x95, 0x7A,
+0xC0, 0x6F, 0x73, 0x63, 0x7A, 0x5F, 0xAE, 0x7B, 0xC1, 0x7F, 0xE7, 0x36, 0xA5, 0xAF, 0xC2, 0x7F,
+0xEF, 0xBC, 0xCE, 0x6B, 0x4A, 0x6C, 0xC4, 0x98, 0xAD, 0xCD, 0x52, 0x6F, 0x6B, 0x3A, 0xBE, 0x3E,
+0xE7, 0x64, 0xB8, 0x72, 0xAF, 0xC0, 0x0F, 0xBD, 0x92, 0xC1, 0x4D, 0xA4, 0xD4, 0xFE, 0x56, 0xC2,
+0xEC, 0x93, 0x73, 0xF6, 0xCC, 0x8B, 0x72, 0xC2, 0x2D, 0x9C, 0xD1, 0xDD, 0xF5, 0xFE, 0x71, 0x00,
+0xC1, 0x1C, 0xE7, 0x79, 0xCE, 0xAF, 0xC2, 0xDB, 0xD6, 0xCF, 0x7B, 0xF7, 0xBD, 0x91, 0xC0, 0x71,
+0x8C, 0x91, 0xC0, 0x9A, 0xCE, 0x00, 0xC0, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x45, 0x00, 0xC0, 0xFB,
+0xDE, 0x59, 0xC0, 0xF3, 0x9C, 0x51, 0xC2, 0xCB, 0x5A, 0x2C, 0x63, 0x59, 0xC6, 0x45, 0x70, 0xC0,
+0xFF, 0xFF, 0x00, 0xC0, 0xF7, 0xFE, 0x77, 0xC0, 0xAE, 0xB4, 0x69, 0xC0, 0x4D, 0xA4, 0x43, 0xC1,
+0xF2, 0xE5, 0x0D, 0x9C, 0x72, 0x7E, 0xC1, 0x30, 0xC5, 0xAE, 0xAC, 0x7E, 0xA0, 0xC0, 0x7B, 0xFF,
+0x71, 0xC2, 0x9F, 0xEF, 0x77, 0xAD, 0x12, 0x7C, 0x00, 0xC0, 0xB8, 0xB5, 0x64, 0xC3, 0x90, 0x6B,
+0x94, 0x8C, 0x5F, 0xE7, 0x0E, 0x5B, 0xBE, 0xC0, 0xB4, 0x8C, 0x4F, 0xA5, 0x71, 0x03, 0xC4, 0xBD,
+0xDE, 0xDB, 0xCD, 0xF4, 0x8B, 0x6E, 0x62, 0xD7, 0xAC, 0x9A, 0xC1, 0x14, 0x94, 0x3D, 0xD6, 0x5A,
+0xC0, 0xB7, 0xA4, 0x62, 0xC0, 0x55, 0x9C, 0x96, 0x7A, 0x00, 0xC5, 0x72, 0x7B, 0x18, 0xAD, 0x1C,
+0xCE, 0x9B, 0xF6, 0x96, 0xFD, 0x2D, 0x93, 0x46, 0xC0, 0xEC, 0x82, 0x46, 0x81, 0x92, 0x46, 0xC2,
+0x4D, 0x93, 0xD3, 0xE4, 0x6D, 0x93, 0x53, 0xC4, 0xCF, 0xAB, 0xAB, 0x7A, 0xD3, 0xDC, 0x96, 0xFD,
+0x7D, 0xFF, 0x71, 0x33, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0x60, 0xC2, 0xD7, 0xFD, 0x30, 0xC4,
+0x28, 0x5A, 0x6F, 0xC1, 0x55, 0xF5, 0x4D, 0x93, 0xBE, 0xC0, 0x30, 0xBC, 0x68, 0xC1, 0x51, 0xC4,
+0x8E, 0x9B, 0x4E, 0x7C, 0x53, 0x6B, 0x42, 0xC0, 0x9A, 0xFE, 0x71, 0x00, 0xC2, 0xBD, 0xDE, 0x9B,
+0xC5, 0xDB, 0xC5, 0x00, 0xC3, 0x54, 0x94, 0xAC, 0x5A, 0x2F, 0x6B, 0xD6, 0xA4, 0x7A, 0xBA, 0xC0,
+0xB1, 0x83, 0x54, 0xC0, 0xDC, 0xCD, 0x7A, 0xC1, 0x95, 0xA4, 0x70, 0x7B, 0x75, 0x6B, 0x5F, 0xAE,
+0xC2, 0x1E, 0xDF, 0x7F, 0xE7, 0x36, 0xA5, 0xAF, 0x5C, 0xC0, 0x1A, 0xBE, 0x47, 0xC3, 0x9B, 0xCE,
+0x77, 0xAD, 0x53, 0x84, 0xF9, 0xBD, 0x73, 0xC0, 0x5F, 0xE7, 0x64, 0xB8, 0xC0, 0xB4, 0xFE, 0xAF,
+0xC3, 0xEC, 0x93, 0x2D, 0x9C, 0x4A, 0x7B, 0x53, 0xEE, 0xBA, 0x65, 0xC1, 0x93, 0xF6, 0xCC, 0x8B,
+0x72, 0x79, 0xC1, 0xD1, 0xDD, 0xF5, 0xFE, 0x71, 0x00, 0xC5, 0x1C, 0xE7, 0x79, 0xCE, 0xDB, 0xD6,
+0x55, 0xA5, 0xEF, 0x7B, 0xFB, 0xDE, 0x71, 0xC5, 0x71, 0x8C, 0x4D, 0x6B, 0x38, 0xC6, 0x9A, 0xCE,
+0x9E, 0xF7, 0xFF, 0xFF, 0x06, 0x58, 0x45, 0xBE, 0xC1, 0x18, 0xBE, 0x8E, 0x73, 0x79, 0x45, 0x61,
+0x59, 0xC0, 0xF3, 0x9C, 0x4D, 0x70, 0x71, 0x00, 0x51, 0x72, 0xC1, 0xAB, 0x8B, 0x4D, 0xA4, 0x75,
+0x72, 0xC0, 0xF2, 0xE5, 0x74, 0x72, 0x7E, 0xC1, 0x30, 0xC5, 0xAE, 0xAC, 0x7E, 0x66, 0xC0, 0x7B,
+0xFF, 0x71, 0x5C, 0xC1, 0x98, 0xAD, 0x0E, 0x5B, 0xBE, 0x4C, 0x4F, 0xC2, 0x4F, 0x63, 0x73, 0x84,
+0x3E, 0xDF, 0x4F, 0xC2, 0x9C, 0xCE, 0x12, 0x7C, 0xBC, 0xD6, 0x48, 0x71, 0x03, 0xC1, 0xBD, 0xDE,
+0xBB, 0xC5, 0xBE, 0xC2, 0x76, 0x9C, 0xCF, 0x6A, 0x14, 0x94, 0xAB, 0xC1, 0x3D, 0xD6, 0xF4, 0x8B,
+0x42, 0xC5, 0x31, 0x7B, 0xD3, 0x8B, 0x51, 0x7B, 0x1C, 0xD6, 0xB7, 0xA4, 0x92, 0x83, 0x6E, 0xAF,
+0xC1, 0x9B, 0xF6, 0x96, 0xFD, 0x7C, 0xC3, 0x8A, 0x6A, 0x71, 0xCC, 0xD3, 0xDC, 0xEB, 0x82, 0x46,
+0x96, 0xC0, 0xEC, 0x82, 0x7F, 0xC0, 0x6E, 0x9B, 0xA9, 0x68, 0xC1, 0x6D, 0x93, 0xB3, 0xDC, 0x53,
+0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x33, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0x60, 0xC0, 0xD7, 0xFD,
+0x55, 0x96, 0x64, 0xA5, 0x7C, 0xBA, 0xC1, 0x92, 0xD4, 0x08, 0x5A, 0x54, 0x67, 0x7E, 0x95, 0x62,
+0xC1, 0x14, 0xE5, 0x55, 0xFD, 0x57, 0x71, 0x00, 0x65, 0xC0, 0x9B, 0xC5, 0xAE, 0x00, 0xC4, 0x5E,
+0xDE, 0xD1, 0x83, 0x2F, 0x73, 0xF2, 0x8B, 0x3D, 0xD6, 0x66, 0xC1, 0xB1, 0x7B, 0xF7, 0xAC, 0x7A,
+0xC2, 0x9A, 0xC5, 0x2E, 0x6B, 0x79, 0xBD, 0x6E, 0x9A, 0xC0, 0x9F, 0xF7, 0xAE, 0xC2, 0x1E, 0xDF,
+0x7F, 0xE7, 0x36, 0xA5, 0xAF, 0x5C, 0xC1, 0x53, 0x84, 0xF5, 0x9C, 0x91, 0xC4, 0xF9, 0xBD, 0xD5,
+0x94, 0x3A, 0xC6, 0x94, 0x8C, 0x5F, 0xE7, 0x64, 0xB8, 0x72, 0x00, 0xC6, 0x2A, 0x7B, 0xCC, 0x8B,
+0xE9, 0x6A, 0x91, 0xD5, 0x94, 0xF6, 0xEC, 0x93, 0xD4, 0xFE, 0x5D, 0xC3, 0x33, 0xEE, 0xCC, 0x93,
+0x32, 0xEE, 0xD5, 0xFE, 0x71, 0x00, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0xA1, 0xC8, 0x8E, 0x73, 0x38,
+0xC6, 0xDB, 0xD6, 0x71, 0x8C, 0x0C, 0x63, 0x28, 0x4A, 0xB6, 0xB5, 0xBA, 0xD6, 0x9E, 0xF7, 0x71,
+0x06, 0x58, 0x45, 0x4D, 0xC2, 0xEF, 0x7B, 0x75, 0xAD, 0xDB, 0xD6, 0x45, 0xC1, 0xFC, 0xDE, 0xB2,
+0x94, 0xAF, 0x4D, 0xC1, 0x1C, 0xE7, 0xFF, 0xFF, 0x00, 0xC5, 0xF7, 0xFE, 0x53, 0xF6, 0x09, 0x73,
+0xEC, 0x8B, 0xE9, 0x6A, 0x12, 0xE6, 0xAE, 0xC0, 0x0D, 0x9C, 0x77, 0xAF, 0xC1, 0x30, 0xC5, 0xAE,
+0xB4, 0x43, 0xC0, 0x93, 0xFE, 0x41, 0x71, 0x5C, 0xC0, 0x77, 0xA5, 0xBA, 0xC2, 0xD9, 0xB5, 0xF5,
+0x9C, 0xF9, 0xB5, 0x7B, 0xC5, 0x52, 0x84, 0x7B, 0xCE, 0x12, 0x7C, 0xDD, 0xD6, 0x32, 0x84, 0xBC,
+0xCE, 0x48, 0x71, 0x03, 0xC1, 0xBD, 0xDE, 0x9B, 0xC5, 0xAE, 0xC2, 0x5D, 0xD6, 0x14, 0x94, 0x72,
+0x7B, 0x76, 0x7A, 0xC7, 0x31, 0x73, 0x96, 0x9C, 0xCF, 0x6A, 0x92, 0x83, 0xF0, 0x6A, 0x59, 0xBD,
+0x51, 0x7B, 0x7A, 0xBD, 0x6E, 0xAF, 0xCA, 0x9B, 0xF6, 0x96, 0xFD, 0x4D, 0x93, 0xF4, 0xE4, 0xB6,
+0xFD, 0x35, 0xF5, 0x28, 0x5A, 0x71, 0xCC, 0x6D, 0x9B, 0xCB, 0x7A, 0x96, 0xFD, 0x5B, 0xC1, 0x10,
+0xB4, 0x6E, 0x9B, 0xBE, 0xC0, 0xB2, 0xDC, 0x53, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x33, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x07, 0xA1, 0xC1, 0xD7, 0xFD, 0x30, 0xBC, 0x91, 0x53, 0x58, 0x5B, 0x96, 0xC2,
+0x14, 0xED, 0x49, 0x62, 0x34, 0xED, 0x53, 0xC0, 0x55, 0xF5, 0xBF, 0x53, 0xC2, 0x14, 0xE5, 0x55,
+0xFD, 0xBA, 0xFE, 0x71, 0x00, 0x65, 0x61, 0xC0, 0xDB, 0xCD, 0x75, 0xC0, 0xED, 0x62, 0xBA, 0xC0,
+0x59, 0xBD, 0x75, 0x72, 0xC0, 0xD1, 0x83, 0x96, 0xC3, 0x4A, 0x52, 0x4F, 0x73, 0x13, 0x8C, 0xE8,
+0x41, 0x72, 0xC2, 0xF7, 0xAC, 0xFC, 0xCD, 0xBF, 0xFF, 0x9A, 0xC0, 0x1E, 0xDF, 0x54, 0xC0, 0x36,
+0xA5, 0x77, 0xC8, 0x7B, 0xCE, 0x53, 0x84, 0x5F, 0xE7, 0x52, 0x84, 0x5B, 0xC6, 0xF1, 0x7B, 0x2E,
+0x63, 0xF9, 0xB5, 0x3E, 0xE7, 0x64, 0xB8, 0xC5, 0xD4, 0xFE, 0xD2, 0xDD, 0x0D, 0x9C, 0x56, 0xFF,
+0x71, 0xCD, 0x8E, 0xAC, 0x91, 0xC1, 0xC6, 0x41, 0xEF, 0xBC, 0xAE, 0xC1, 0xC9, 0x6A, 0x0C, 0x9C,
+0x77, 0xAB, 0xC0, 0xFF, 0xFF, 0x00, 0xC0, 0x1C, 0xE7, 0x4D, 0xC1, 0x14, 0x9D, 0x08, 0x42, 0x44,
+0xC4, 0xB6, 0xB5, 0x1C, 0xDF, 0x79, 0xCE, 0x10, 0x84, 0x9A, 0xD6, 0x9A, 0xC0, 0x9E, 0xF7, 0x71,
+0x06, 0x58, 0xC1, 0xBA, 0xD6, 0xF7, 0xBD, 0x60, 0xC1, 0x0C, 0x63, 0x34, 0xA5, 0x7D, 0xC0, 0x2C,
+0x63, 0x91, 0xC0, 0x18, 0xC6, 0x48, 0xC0, 0x1C, 0xE7, 0x71, 0x00, 0xC3, 0x17, 0xFF, 0x70, 0xCD,
+0x6D, 0xA4, 0x76, 0xFF, 0x76, 0x92, 0xC3, 0xCC, 0x93, 0xE6, 0x49, 0x30, 0xC5, 0x53, 0xF6, 0x54,
+0xC3, 0x68, 0x5A, 0xD2, 0xDD, 0xB4, 0xFE, 0x7B, 0xFF, 0x71, 0xC1, 0x9F, 0xEF, 0x77, 0xAD, 0x63,
+0xC1, 0xFD, 0xDE, 0x32, 0x84, 0x00, 0xC1, 0x9C, 0xCE, 0x98, 0xAD, 0x63, 0xAF, 0xC2, 0x2E, 0x63,
+0x73, 0x8C, 0x5E, 0xE7, 0xA6, 0x71, 0x03, 0x65, 0xC2, 0xBB, 0xC5, 0xF4, 0x8B, 0x10, 0x73, 0xAF,
+0xC3, 0x76, 0x9C, 0x6E, 0x62, 0xCF, 0x6A, 0x14, 0x94, 0x42, 0x00, 0xC3, 0x5D, 0xDE, 0x35, 0x94,
+0x92, 0x83, 0x2D, 0x52, 0x52, 0xC5, 0x18, 0xAD, 0x1C, 0xCE, 0xBB, 0xF6, 0x76, 0xFD, 0x6D, 0x93,
+0xD3, 0xDC, 0x4E, 0x00, 0xC5, 0x69, 0x62, 0xB3, 0xDC, 0xAE, 0xA3, 0x0C, 0x8B, 0xB6, 0xFD, 0x4D,
+0x93, 0x68, 0xC1, 0x96, 0xFD, 0x8E, 0x9B, 0x4F, 0x4E, 0xC0, 0x7D, 0xFF, 0x71, 0x33, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x08, 0xC1, 0x18, 0xFE, 0x14, 0xF5, 0xAF, 0xBE, 0x00, 0x7A, 0x00, 0x42, 0x6B,
+0x42, 0x85, 0x42, 0xAE, 0x70, 0xBF, 0x42, 0xC0, 0x5D, 0xFF, 0x71, 0x00, 0xC1, 0x5E, 0xEF, 0x9B,
+0xC5, 0x66, 0x90, 0xC0, 0x96, 0xA4, 0x4B, 0xC2, 0xFC, 0xCD, 0x7A, 0xBD, 0x95, 0x9C, 0x52, 0xBE,
+0xC0, 0xF7, 0xAC, 0xBF, 0x52, 0x72, 0x63, 0x52, 0xC0, 0x3C, 0xD6, 0x71, 0x00, 0xC0, 0x3E, 0xDF,
+0x7B, 0x95, 0xBA, 0x6C, 0x00, 0x43, 0xC0, 0xDD, 0xD6, 0x7B, 0xC1, 0x9C, 0xCE, 0x1A, 0xBE, 0x40,
+0x7B, 0xC0, 0xDF, 0xFF, 0xA4, 0xC0, 0xB4, 0xFE, 0x91, 0x00, 0x72, 0xA6, 0x91, 0x81, 0x92, 0xC0,
+0x33, 0xEE, 0x72, 0xC0, 0x91, 0xD5, 0x5E, 0x72, 0xAF, 0x71, 0x00, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE,
+0x79, 0xC0, 0xD7, 0xBD, 0x7D, 0xC1, 0x59, 0xCE, 0x9A, 0xD6, 0x45, 0x91, 0x45, 0x00, 0xC1, 0x9E,
+0xF7, 0xFF, 0xFF, 0x06, 0x58, 0x45, 0x79, 0xC0, 0xF7, 0xBD, 0x7D, 0xC0, 0x38, 0xC6, 0x79, 0xC1,
+0x55, 0xAD, 0x18, 0xBE, 0x4D, 0x45, 0x70, 0x71, 0x00, 0xC0, 0xF7, 0xFE, 0x5E, 0x00, 0x72, 0x96,
+0x59, 0x42, 0x75, 0xC0, 0x53, 0xEE, 0x6A, 0xC0, 0xF2, 0xDD, 0x00, 0x5E, 0xBE, 0x41, 0x71, 0x5C,
+0xC0, 0xFD, 0xD6, 0x00, 0x40, 0xC0, 0xBC, 0xD6, 0x9A, 0x40, 0x7B, 0x67, 0x7B, 0xC0, 0xF9, 0xB5,
+0x6C, 0x7B, 0xC0, 0x7E, 0xE7, 0x71, 0x03, 0xC1, 0x3E, 0xEF, 0xBB, 0xC5, 0x52, 0xC1, 0xB7, 0xA4,
+0x5A, 0xBD, 0x66, 0xC0, 0x18, 0xB5, 0xAF, 0xC0, 0xDB, 0xCD, 0x5A, 0xAB, 0x66, 0x5A, 0x52, 0x7E,
+0x72, 0x52, 0x47, 0xC0, 0x9E, 0xFF, 0x4E, 0xC0, 0x14, 0xED, 0x7F, 0xBA, 0x00, 0x6B, 0x7F, 0xA6,
+0xA9, 0xC0, 0x75, 0xFD, 0x81, 0x42, 0x47, 0x70, 0x73, 0xC1, 0xD7, 0xFD, 0xDF, 0xFF, 0x71, 0x33,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x08, 0x5B, 0xC0, 0x18, 0xFE, 0x4E, 0x47, 0x00, 0x4E, 0x01, 0xAE,
+0x4E, 0x01, 0x47, 0x4E, 0x53, 0xC0, 0xDB, 0xFE, 0x71, 0x02, 0xC0, 0xDD, 0xE6, 0x6E, 0x00, 0xAF,
+0x6E, 0x9A, 0x6E, 0x7A, 0x6E, 0x00, 0x7A, 0xA9, 0x6E, 0x73, 0x7A, 0xC1, 0x3C, 0xD6, 0x9F, 0xF7,
+0x71, 0x00, 0x92, 0x43, 0x40, 0x01, 0x43, 0x7B, 0x43, 0x40, 0x43, 0xAE, 0x43, 0x64, 0x71, 0xA0,
+0xC0, 0xB4, 0xFE, 0x05, 0xAE, 0x72, 0x00, 0x77, 0x72, 0xA6, 0xC0, 0xD5, 0xFE, 0x71, 0x00, 0xC0,
+0x1C, 0xE7, 0x79, 0xBF, 0xAE, 0x00, 0x48, 0x45, 0x00, 0x4D, 0x45, 0x00, 0xC0, 0x9E, 0xF7, 0x71,
+0x06, 0x58, 0x45, 0x48, 0x4D, 0x01, 0x48, 0xC0, 0xDB, 0xD6, 0x4D, 0x45, 0x00, 0x70, 0x71, 0x00,
+0x51, 0x6D, 0x72, 0x03, 0x77, 0x72, 0x00, 0x77, 0x00, 0x72, 0xA5, 0x41, 0x71, 0x00, 0xC0, 0x7F,
+0xEF, 0x43, 0x7B, 0x43, 0x00, 0x40, 0x00, 0x43, 0x40, 0xBF, 0x43, 0xAE, 0x71, 0x05, 0xC0, 0xDE,
+0xE6, 0x73, 0x7A, 0x6E, 0x6B, 0x73, 0x6E, 0x6B, 0x6E, 0x00, 0x6B, 0x6E, 0x00, 0x73, 0x00, 0x47,
+0x5F, 0x71, 0xC1, 0x1C, 0xFF, 0xB7, 0xFD, 0x4E, 0xA9, 0x4E, 0x53, 0x4E, 0x01, 0x47, 0x4E, 0x00,
+0x47, 0x4E, 0xC1, 0xD7, 0xFD, 0x7D, 0xFF, 0x71, 0x34, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0A, 0x5B,
+0x4F, 0x09, 0xC0, 0xBE, 0xFF, 0x71, 0x00, 0x94, 0xC0, 0x79, 0xD7, 0x99, 0x00, 0xA1, 0x96, 0xA6,
+0x41, 0x00, 0x7C, 0x00, 0x41, 0x00, 0x7C, 0x41, 0x00, 0x7C, 0x41, 0xC0, 0x9A, 0xDF, 0x71, 0x03,
+0x6C, 0x07, 0x71, 0x01, 0xA0, 0x72, 0x0A, 0x6D, 0x7E, 0x71, 0x00, 0xC1, 0x1C, 0xE7, 0x79, 0xCE,
+0x45, 0xBA, 0x00, 0x45, 0x00, 0x48, 0x00, 0x45, 0x00, 0x58, 0x71, 0x06, 0x58, 0x45, 0x00, 0x48,
+0x00, 0x45, 0x00, 0x48, 0x00, 0x45, 0x00, 0x70, 0x71, 0x00, 0x51, 0x66, 0x72, 0x09, 0x66, 0xC0,
+0x7B, 0xFF, 0x71, 0x01, 0x6C, 0x08, 0x71, 0x06, 0xC0, 0xBA, 0xDF, 0x49, 0x7C, 0xAE, 0x7C, 0x08,
+0x41, 0x73, 0x71, 0x01, 0x6C, 0x4F, 0x09, 0xAF, 0x71, 0x36, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x18,
+0x95, 0xC0, 0x56, 0xC7, 0x95, 0x44, 0x75, 0xC0, 0x76, 0xC7, 0x44, 0x49, 0x95, 0x75, 0x49, 0x00,
+0x75, 0x00, 0x44, 0x01, 0xC0, 0x96, 0xC7, 0x44, 0x75, 0x64, 0x71, 0x0E, 0x59, 0x72, 0x01, 0x77,
+0x72, 0x00, 0x77, 0x72, 0x01, 0x5E, 0x77, 0x6D, 0x7E, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x79, 0x4D,
+0x79, 0x48, 0x4D, 0x00, 0x48, 0x79, 0x48, 0x45, 0x58, 0x71, 0x06, 0x58, 0x45, 0x4D, 0x45, 0x00,
+0x4D, 0x45, 0x00, 0x48, 0x00, 0x45, 0x70, 0x71, 0x00, 0x51, 0x66, 0x72, 0x77, 0x72, 0x00, 0x7E,
+0x72, 0x01, 0x5E, 0x72, 0x00, 0x66, 0xC0, 0x7B, 0xFF, 0x71, 0x12, 0x64, 0x75, 0x44, 0x00, 0x91,
+0x44, 0x49, 0x75, 0x00, 0x49, 0x44, 0x00, 0x49, 0x44, 0x4E, 0x44, 0x75, 0x64, 0x71, 0xE0, 0x05,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x18, 0xC0, 0x9B, 0xE7, 0x49, 0xC6, 0x91, 0x95, 0x2D, 0x74, 0xD7,
+0xCF, 0x8E, 0x7C, 0x50, 0x8D, 0xF5, 0xBE, 0x6B, 0x63, 0x95, 0xC0, 0x94, 0xAE, 0x00, 0x69, 0xC0,
+0x8B, 0x63, 0x6B, 0xC1, 0x30, 0x8D, 0x33, 0xA6, 0x69, 0x75, 0xC0, 0x76, 0xC7, 0x44, 0xC0, 0xFE,
+0xF7, 0x71, 0x0D, 0x59, 0x72, 0x00, 0x77, 0xC1, 0xAC, 0x8B, 0xD2, 0xDD, 0x77, 0xC0, 0xCC, 0x8B,
+0x00, 0x7E, 0xC2, 0x4D, 0xA4, 0xA8, 0x62, 0xCF, 0xB4, 0x77, 0x7E, 0x71, 0x00, 0xC0, 0x1C, 0xE7,
+0x4D, 0xC3, 0xB6, 0xB5, 0xCB, 0x5A, 0x8E, 0x73, 0x9A, 0xCE, 0x79, 0xC0, 0x6D, 0x6B, 0x00, 0x79,
+0x45, 0xC0, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x48, 0x81, 0xC2, 0x4D, 0x6B, 0xEC, 0x62, 0x18, 0xC6,
+0x81, 0xC0, 0x0C, 0x63, 0x5C, 0xC0, 0x55, 0xA5, 0x4D, 0xC1, 0x1C, 0xE7, 0xFF, 0xFF, 0x00, 0x51,
+0x6D, 0x00, 0xC1, 0x8B, 0x83, 0x33, 0xEE, 0x6D, 0xC4, 0x6B, 0x83, 0x2D, 0x9C, 0xF5, 0xFE, 0xD1,
+0xDD, 0xE9, 0x6A, 0x49, 0x5E, 0x66, 0xC0, 0x7B, 0xFF, 0x71, 0x11, 0x95, 0xC0, 0x36, 0xC7, 0xAE,
+0x96, 0xC2, 0x0D, 0x74, 0x0A, 0x5B, 0xD2, 0x9D, 0x4F, 0xC0, 0x4A, 0x5B, 0x00, 0xC2, 0x73, 0xAE,
+0x70, 0x95, 0x94, 0xB6, 0x7D, 0xC0, 0x0F, 0x8D, 0x78, 0xC1, 0x50, 0x8D, 0x76, 0xC7, 0x44, 0x67,
+0x71, 0xE0, 0x04, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x18, 0x73, 0x4E, 0xC4, 0x10, 0x8D, 0xA8, 0x4A,
+0x15, 0xBF, 0x09, 0x53, 0xCF, 0x84, 0x91, 0xC1, 0x71, 0x95, 0xF2, 0x9D, 0x6A, 0x43, 0x5D, 0xC4,
+0xD4, 0xB6, 0x36, 0xBF, 0x4D, 0x74, 0x53, 0xAE, 0xAE, 0x84, 0xAE, 0x49, 0xA6, 0xC0, 0xDE, 0xF7,
+0x71, 0x0D, 0xA0, 0x72, 0x00, 0xC5, 0x53, 0xF6, 0x68, 0x5A, 0xCF, 0xBC, 0xF5, 0xFE, 0x30, 0xC5,
+0x8B, 0x83, 0x6D, 0xC0, 0xF2, 0xDD, 0x00, 0xC0, 0x6B, 0x83, 0x6D, 0xC0, 0xD5, 0xFE, 0x71, 0x00,
+0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0x60, 0x00, 0xC4, 0xEF, 0x7B, 0x75, 0xAD, 0xF3, 0x9C, 0x92, 0x94,
+0x79, 0xCE, 0x45, 0x00, 0x58, 0xC0, 0xFF, 0xFF, 0x06, 0x58, 0x45, 0x91, 0xC2, 0xF7, 0xBD, 0xD3,
+0x94, 0x51, 0x8C, 0x4D, 0xC1, 0x38, 0xC6, 0xAE, 0x73, 0x69, 0x4D, 0x70, 0xC0, 0xFF, 0xFF, 0x00,
+0xC0, 0xF7, 0xFE, 0x72, 0xC2, 0x12, 0xE6, 0x27, 0x52, 0x70, 0xCD, 0x77, 0xC1, 0xCF, 0xB4, 0xCC,
+0x93, 0x77, 0x59, 0xC2, 0x94, 0xF6, 0x0C, 0x94, 0x30, 0xC5, 0x72, 0xC0, 0x7B, 0xFF, 0x71, 0x11,
+0x94, 0x7F, 0xC3, 0x76, 0xC7, 0xF2, 0x9D, 0x4D, 0x7C, 0x35, 0xBF, 0x5C, 0xC1, 0xEC, 0x6B, 0xD2,
+0x9D, 0x4F, 0xBE, 0xC0, 0xCF, 0x84, 0xBE, 0xC2, 0xCC, 0x6B, 0xD5, 0xB6, 0xAE, 0x7C, 0x50, 0x49,
+0xA6, 0xC0, 0xDE, 0xF7, 0x71, 0xE0, 0x04, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x18, 0x73, 0x49, 0xC6,
+0x91, 0x95, 0x4A, 0x5B, 0xD1, 0x9D, 0x6B, 0x63, 0x0F, 0x8D, 0x2D, 0x74, 0x15, 0xBF, 0x44, 0x6A,
+0x00, 0xA6, 0xC1, 0xF5, 0xBE, 0xB7, 0xCF, 0x6F, 0xC3, 0xB4, 0xB6, 0x12, 0xA6, 0xCF, 0x84, 0x76,
+0xC7, 0x44, 0x62, 0x71, 0x0D, 0xA0, 0xC0, 0xB4, 0xFE, 0x77, 0xC2, 0x50, 0xCD, 0x0C, 0x9C, 0x4D,
+0xA4, 0x43, 0x5E, 0xC1, 0xEC, 0x93, 0x94, 0xFE, 0x7E, 0x5E, 0xC0, 0xAB, 0x8B, 0x6D, 0x7E, 0x71,
+0x00, 0xC5, 0x1C, 0xE7, 0x79, 0xCE, 0xBA, 0xD6, 0x1B, 0xDF, 0x30, 0x84, 0x96, 0xB5, 0x45, 0xC1,
+0x2C, 0x63, 0x71, 0x8C, 0x4D, 0x96, 0x58, 0x71, 0x06, 0x58, 0x45, 0xBA, 0xC1, 0xFB, 0xDE, 0x14,
+0xA5, 0x59, 0xC0, 0xDB, 0xDE, 0x4D, 0xC1, 0xCF, 0x7B, 0x59, 0xC6, 0x45, 0x70, 0xC0, 0xFF, 0xFF,
+0x00, 0xC0, 0xF7, 0xFE, 0x77, 0xC3, 0xEF, 0xBC, 0x0C, 0x9C, 0x8E, 0xAC, 0x15, 0xFF, 0x42, 0xC0,
+0x0D, 0x9C, 0x72, 0x00, 0xC5, 0xB1, 0xD5, 0x8B, 0x83, 0xF2, 0xE5, 0xB3, 0xFE, 0x7B, 0xFF, 0xFF,
+0xFF, 0x11, 0x5B, 0x7F, 0xC0, 0x76, 0xC7, 0x76, 0xC3, 0x2A, 0x5B, 0x53, 0xAE, 0x15, 0xBF, 0xEC,
+0x6B, 0x49, 0x44, 0x5D, 0xC2, 0x8E, 0x7C, 0x88, 0x4A, 0x73, 0xAE, 0x5D, 0xC0, 0xF2, 0xA5, 0x57,
+0x49, 0x44, 0x62, 0x71, 0xE0, 0x04, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x18, 0x73, 0x49, 0xC1, 0x71,
+0x95, 0x2D, 0x74, 0x56, 0xC0, 0x4D, 0x7C, 0x57, 0x6A, 0x7C, 0xBE, 0x6A, 0x43, 0x56, 0xC5, 0xC9,
+0x52, 0xD4, 0xB6, 0x6E, 0x7C, 0xB4, 0xB6, 0xF2, 0x9D, 0xCF, 0x84, 0x49, 0x44, 0xC0, 0xDE, 0xF7,
+0x71, 0x0D, 0xA0, 0xC0, 0xB4, 0xFE, 0xAE, 0xC2, 0x6E, 0xA4, 0x10, 0xC5, 0xEC, 0x93, 0x5E, 0x96,
+0x65, 0xC1, 0x94, 0xFE, 0xF5, 0xFE, 0x55, 0xAE, 0x77, 0xAB, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x79,
+0xC2, 0xBA, 0xD6, 0x18, 0xBE, 0x8E, 0x73, 0x4D, 0x58, 0xC0, 0x30, 0x84, 0x6C, 0x78, 0x4D, 0xC0,
+0x9E, 0xF7, 0x71, 0x06, 0x58, 0xC0, 0x9A, 0xCE, 0xBA, 0x45, 0xC2, 0x8E, 0x73, 0xF7, 0xBD, 0xDB,
+0xD6, 0x4C, 0x6C, 0x59, 0x45, 0x70, 0x71, 0x00, 0xC0, 0xF7, 0xFE, 0x77, 0xC1, 0x2D, 0x9C, 0x30,
+0xC5, 0x65, 0x72, 0x7D, 0x74, 0x72, 0x00, 0xC1, 0xCF, 0xB4, 0xE9, 0x6A, 0x42, 0x6B, 0x41, 0x71,
+0x11, 0x5B, 0x7F, 0x00, 0x44, 0xC2, 0x0F, 0x8D, 0xA8, 0x4A, 0x8E, 0x7C, 0x6F, 0x49, 0x7F, 0xC0,
+0x97, 0xCF, 0x6F, 0xC1, 0x47, 0x42, 0x15, 0xBF, 0x58, 0xC0, 0xD2, 0x9D, 0x57, 0x49, 0x44, 0x62,
+0x71, 0xE0, 0x04, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x18, 0x73, 0x49, 0xC0, 0x50, 0x95, 0x92, 0xC1,
+0x0A, 0x5B, 0x30, 0x8D, 0x64, 0x6A, 0xC0, 0xF5, 0xBE, 0x44, 0xC0, 0xCC, 0x6B, 0x44, 0xC0, 0xF8,
+0xD7, 0x57, 0x78, 0x43, 0xC1, 0xB4, 0xB6, 0x32, 0xA6, 0x64, 0xC0, 0x97, 0xC7, 0x44, 0x62, 0xBF,
+0x0D, 0xA0, 0x72, 0x77, 0xC2, 0x4A, 0x7B, 0xC9, 0x6A, 0x68, 0x5A, 0x7A, 0x6D, 0x74, 0x7E, 0x42,
+0xC0, 0xCC, 0x8B, 0x77, 0x72, 0x7E, 0x71, 0x00, 0xC1, 0x1C, 0xE7, 0x79, 0xCE, 0x4D, 0xC5, 0x10,
+0x84, 0x96, 0xB5, 0x3C, 0xE7, 0xEF, 0x7B, 0xF7, 0xBD, 0xD3, 0x9C, 0x50, 0x4D, 0xC1, 0x9E, 0xF7,
+0xFF, 0xFF, 0x06, 0x58, 0xC2, 0x9A, 0xCE, 0xDB, 0xD6, 0xB2, 0x94, 0x00, 0x61, 0x59, 0xC0, 0xF3,
+0x9C, 0x68, 0x59, 0x45, 0x70, 0x71, 0x00, 0xC2, 0xF7, 0xFE, 0x93, 0xFE, 0xE9, 0x6A, 0x00, 0xC1,
+0x88, 0x5A, 0x53, 0xF6, 0x96, 0xC0, 0x4D, 0xA4, 0x7E, 0x72, 0xC1, 0x76, 0xFF, 0xEF, 0xBC, 0x69,
+0x77, 0xC1, 0x7B, 0xFF, 0xFF, 0xFF, 0x11, 0x5B, 0x7F, 0x9A, 0x44, 0xC3, 0xF8, 0xD7, 0x94, 0xB6,
+0xAB, 0x63, 0xEC, 0x6B, 0x44, 0xC0, 0x97, 0xCF, 0x55, 0xC4, 0xCF, 0x84, 0x0C, 0x6C, 0x4D, 0x74,
+0xD7, 0xCF, 0x12, 0xA6, 0x64, 0x55, 0x44, 0xC0, 0xDE, 0xF7, 0xBF, 0xE0, 0x04, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x18, 0x73, 0x4E, 0xC0, 0x30, 0x8D, 0x00, 0x5C, 0xC0, 0x91, 0x95, 0x64, 0x70, 0xC3,
+0x0D, 0x74, 0x6D, 0x7C, 0xAE, 0x7C, 0xD2, 0x9D, 0x70, 0x42, 0x6A, 0xC2, 0x4D, 0x7C, 0x53, 0xAE,
+0x2D, 0x74, 0x5F, 0xC0, 0xB4, 0xB6, 0x44, 0x62, 0x71, 0x0D, 0xA0, 0xC3, 0xB4, 0xFE, 0x12, 0xE6,
+0xAB, 0x8B, 0xB4, 0xF6, 0x69, 0x91, 0xC3, 0x0F, 0xC5, 0x68, 0x5A, 0x91, 0xD5, 0x6B, 0x7B, 0xA1,
+0xC2, 0x30, 0xBD, 0x94, 0xFE, 0xD5, 0xFE, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x4D, 0xC1, 0x34, 0xA5,
+0x49, 0x4A, 0x68, 0xC0, 0x59, 0xC6, 0x50, 0x6C, 0xC0, 0x6E, 0x73, 0x4C, 0x4D, 0xC1, 0x9E, 0xF7,
+0xFF, 0xFF, 0x06, 0x58, 0xC1, 0x9A, 0xD6, 0x38, 0xC6, 0x74, 0xC5, 0x30, 0x84, 0xB6, 0xB5, 0xFB,
+0xDE, 0xEF, 0x7B, 0x75, 0xAD, 0xDB, 0xD6, 0x91, 0x70, 0xC0, 0xFF, 0xFF, 0x00, 0xC1, 0x17, 0xFF,
+0x90, 0xD5, 0x60, 0xC5, 0xF5, 0xF6, 0x4D, 0xA4, 0x0F, 0xBD, 0xAE, 0xAC, 0x88, 0x5A, 0xD2, 0xDD,
+0x00, 0x5A, 0xC1, 0x4A, 0x7B, 0x91, 0xD5, 0x72, 0xC0, 0x7B, 0xFF, 0x71, 0x11, 0x94, 0x7F, 0x44,
+0xC1, 0x74, 0xAE, 0xEF, 0x84, 0x43, 0xAE, 0xBA, 0xC0, 0x4D, 0x74, 0x5C, 0xC0, 0x33, 0xA6, 0x43,
+0xC2, 0x13, 0xA6, 0xEC, 0x6B, 0x50, 0x95, 0x6A, 0x5F, 0x57, 0x44, 0x62, 0xBF, 0xE0, 0x04, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x18, 0xC2, 0xBC, 0xEF, 0x55, 0xBF, 0x73, 0xAE, 0x4A, 0xC0, 0x97, 0xCF,
+0x57, 0xC0, 0x53, 0xAE, 0x44, 0x4B, 0x96, 0x7C, 0x76, 0xC3, 0x0D, 0x74, 0x30, 0x8D, 0x76, 0xC7,
+0x12, 0xA6, 0x52, 0xC3, 0xCF, 0x84, 0x6E, 0x7C, 0x73, 0xAE, 0x77, 0xCF, 0x71, 0x0E, 0xA5, 0x72,
+0xC3, 0x32, 0xEE, 0xB1, 0xD5, 0xD5, 0xFE, 0x53, 0xEE, 0x66, 0xC2, 0x0F, 0xBD, 0x0C, 0x94, 0x50,
+0xCD, 0x76, 0xC3, 0x0D, 0x9C, 0xAE, 0xB4, 0x93, 0xFE, 0xD6, 0xFE, 0x71, 0x00, 0xC3, 0x1C, 0xE7,
+0x9A, 0xD6, 0xD7, 0xBD, 0x30, 0x84, 0x00, 0xC3, 0xF7, 0xBD, 0xBA, 0xD6, 0x31, 0x84, 0xD3, 0x9C,
+0x4D, 0x96, 0xC0, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x45, 0x91, 0xC0, 0x51, 0x8C, 0x91, 0x69, 0x4D,
+0x69, 0xC0, 0x59, 0xCE, 0x48, 0x45, 0x70, 0xC0, 0xFF, 0xFF, 0x00, 0xC1, 0x17, 0xFF, 0xF1, 0xE5,
+0x6E, 0xC4, 0xF5, 0xFE, 0x12, 0xE6, 0xB1, 0xD5, 0xCF, 0xB4, 0x0C, 0x9C, 0x66, 0x42, 0xC0, 0xAB,
+0x8B, 0x69, 0x72, 0xA5, 0xC0, 0x9C, 0xFF, 0x71, 0x12, 0x44, 0x7A, 0x6B, 0xC0, 0x8E, 0x7C, 0xA1,
+0xC1, 0xF5, 0xB6, 0x35, 0xBF, 0x43, 0xA6, 0x6B, 0xC1, 0x33, 0xA6, 0xD5, 0xB6, 0xA9, 0xC1, 0x71,
+0x95, 0xEF, 0x84, 0x7E, 0xC0, 0x73, 0xAE, 0x53, 0x71, 0xE0, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x19, 0xC1, 0x79, 0xD7, 0x56, 0xC7, 0x7A, 0x75, 0x7A, 0x44, 0x75, 0x49, 0x00, 0x75, 0x44, 0x4E,
+0x49, 0x75, 0x44, 0x7A, 0x4E, 0x00, 0xA7, 0xC0, 0xBC, 0xEF, 0x71, 0x0F, 0xC0, 0x18, 0xFF, 0x66,
+0xAF, 0x66, 0x72, 0x00, 0xAE, 0xAF, 0x77, 0x00, 0xAE, 0x77, 0x66, 0xC0, 0x5A, 0xFF, 0x71, 0x00,
+0xC3, 0x1C, 0xE7, 0x79, 0xCE, 0xBA, 0xD6, 0xFB, 0xDE, 0x00, 0x4D, 0x45, 0x59, 0x00, 0x45, 0x00,
+0x58, 0x71, 0x06, 0x58, 0x45, 0x48, 0x61, 0x00, 0x4D, 0x45, 0xC0, 0xDA, 0xD6, 0x48, 0x45, 0x00,
+0x70, 0x71, 0x00, 0xC0, 0x9C, 0xFF, 0x72, 0x00, 0x66, 0x72, 0x00, 0x77, 0x7C, 0x72, 0x00, 0x77,
+0x00, 0x66, 0xC0, 0xF6, 0xFE, 0x71, 0x13, 0x4C, 0x7F, 0x99, 0x49, 0x4E, 0x7A, 0x75, 0x49, 0x00,
+0x75, 0x44, 0x7A, 0x00, 0x49, 0x4E, 0x00, 0x50, 0x4C, 0x71, 0xE0, 0x05, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x09, 0xC1, 0x3C, 0xFF, 0x79, 0xFE, 0xA6, 0x09, 0xC1, 0x9A, 0xFE, 0xBE, 0xFF, 0x71, 0x00,
+0x5B, 0x4C, 0x0D, 0xAE, 0x67, 0x71, 0x01, 0x92, 0x92, 0x00, 0xA9, 0x04, 0x57, 0xAE, 0xC0, 0xDF,
+0xFF, 0x71, 0x02, 0xC0, 0x5A, 0xFF, 0x56, 0x06, 0xA6, 0x56, 0x41, 0x71, 0x01, 0xC0, 0x1C, 0xE7,
+0x79, 0x45, 0xBE, 0x48, 0x45, 0x00, 0x4D, 0x48, 0x45, 0x00, 0x58, 0x71, 0x06, 0x58, 0x45, 0x00,
+0x4D, 0x00, 0x45, 0x00, 0x4D, 0x00, 0x45, 0x00, 0x70, 0x71, 0x01, 0xC0, 0x9C, 0xFF, 0x5D, 0x51,
+0x56, 0x06, 0xC0, 0x39, 0xFF, 0x65, 0x71, 0x01, 0x6C, 0x5C, 0x57, 0x00, 0x50, 0x03, 0x57, 0x00,
+0x64, 0x71, 0x05, 0x62, 0x4C, 0x0B, 0xAE, 0x67, 0x71, 0x00, 0x6C, 0xC0, 0xDB, 0xFE, 0x46, 0x0A,
+0xC0, 0xFB, 0xFE, 0x71, 0x35, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x08, 0x68, 0xC0, 0x55, 0xFD, 0x81,
+0x42, 0x00, 0xA6, 0x42, 0x7D, 0x42, 0x96, 0x00, 0x42, 0x00, 0x7A, 0x7D, 0xC0, 0xD7, 0xFD, 0x60,
+0x71, 0x13, 0x5C, 0x7B, 0x95, 0xA6, 0xC0, 0x3E, 0xE7, 0x7B, 0x00, 0xAE, 0x7B, 0x6C, 0xA1, 0x67,
+0x40, 0xC0, 0xDF, 0xFF, 0x71, 0x10, 0xC0, 0x1C, 0xE7, 0x79, 0xC1, 0xBA, 0xD6, 0x38, 0xC6, 0x79,
+0x4D, 0x00, 0x65, 0x79, 0x4D, 0x45, 0x58, 0x71, 0x06, 0x58, 0x45, 0x4D, 0xC0, 0x59, 0xC6, 0x65,
+0x4D, 0x00, 0x71, 0x74, 0x4D, 0x45, 0x70, 0xC0, 0xFF, 0xFF, 0x10, 0x96, 0xC0, 0x1D, 0xDF, 0x5B,
+0x67, 0x5B, 0xC0, 0xFD, 0xD6, 0x40, 0x7B, 0xA5, 0x67, 0x5B, 0x6C, 0x7B, 0xC0, 0xBF, 0xF7, 0x71,
+0x16, 0xC1, 0x18, 0xFE, 0x34, 0xF5, 0x6B, 0x42, 0x7A, 0x42, 0x02, 0x7A, 0x00, 0x42, 0x00, 0x7A,
+0x7D, 0xC0, 0x7A, 0xFE, 0x71, 0x34, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0xA6, 0xCB, 0xF7, 0xFD,
+0x51, 0xCC, 0x49, 0x5A, 0xEB, 0x7A, 0x10, 0xB4, 0x51, 0xC4, 0xD3, 0xDC, 0x2C, 0x8B, 0x55, 0xF5,
+0x8E, 0xA3, 0xAA, 0x72, 0xB2, 0xD4, 0x6B, 0xC1, 0x69, 0x62, 0x35, 0xF5, 0x7D, 0x68, 0x71, 0x13,
+0x40, 0xBF, 0xC4, 0x32, 0x7C, 0xED, 0x5A, 0xB4, 0x94, 0xFD, 0xD6, 0x94, 0x8C, 0x40, 0x7B, 0xC1,
+0xF9, 0xBD, 0x6F, 0x6B, 0x6F, 0xC0, 0x57, 0xA5, 0x64, 0x71, 0x10, 0xC0, 0x1C, 0xE7, 0x4D, 0xC3,
+0x96, 0xAD, 0xCB, 0x5A, 0x2D, 0x6B, 0x9A, 0xCE, 0x75, 0x5C, 0xC0, 0x8E, 0x73, 0x79, 0x45, 0xC0,
+0x9E, 0xF7, 0x71, 0x06, 0x58, 0x48, 0x65, 0xC0, 0x2C, 0x63, 0x5C, 0xC4, 0xD7, 0xB5, 0x59, 0xC6,
+0x0C, 0x63, 0x4D, 0x6B, 0x59, 0xCE, 0x45, 0xC1, 0x1C, 0xE7, 0xFF, 0xFF, 0x10, 0xC7, 0x9F, 0xEF,
+0xF9, 0xB5, 0x2E, 0x63, 0xAC, 0x52, 0xD1, 0x73, 0x73, 0x8C, 0x5B, 0xC6, 0xB8, 0xB5, 0x91, 0x67,
+0xC3, 0x0E, 0x5B, 0xB0, 0x73, 0x1E, 0xDF, 0x5E, 0xE7, 0x71, 0x15, 0x7E, 0xC5, 0x76, 0xFD, 0x4D,
+0x93, 0x49, 0x62, 0x8E, 0x9B, 0xCF, 0xAB, 0x14, 0xED, 0x6A, 0xC4, 0x30, 0xBC, 0x92, 0xD4, 0x31,
+0xC4, 0x0C, 0x83, 0x31, 0xBC, 0x4E, 0xC3, 0x69, 0x6A, 0xF3, 0xE4, 0x96, 0xFD, 0x9E, 0xFF, 0x71,
+0x0A, 0xC2, 0x18, 0xC6, 0xD3, 0x9C, 0xDB, 0xDE, 0x71, 0x00, 0xC0, 0x3D, 0xEF, 0xAE, 0x71, 0x58,
+0xC0, 0xFB, 0xDE, 0x71, 0x11, 0xC0, 0x3C, 0xE7, 0x44, 0x71, 0x08, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x07, 0xA1, 0xC1, 0xD7, 0xFD, 0x10, 0xBC, 0x95, 0xAB, 0xC0, 0xEC, 0x82, 0x7E, 0xC1, 0x71, 0xCC,
+0x8A, 0x6A, 0x54, 0xC0, 0x4D, 0x93, 0x45, 0x7E, 0xC5, 0x72, 0xCC, 0xE7, 0x51, 0x34, 0xED, 0x55,
+0xFD, 0x9A, 0xFE, 0xFF, 0xFF, 0x12, 0xA6, 0x7B, 0xBE, 0xC4, 0x32, 0x84, 0x5B, 0xC6, 0xD1, 0x73,
+0xDD, 0xD6, 0xB4, 0x94, 0x73, 0x00, 0x43, 0x96, 0xC0, 0x73, 0x8C, 0x4B, 0xC0, 0xBF, 0xEF, 0x71,
+0x10, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0x91, 0x79, 0xC3, 0x30, 0x84, 0x75, 0xAD, 0x51, 0x8C, 0xB6,
+0xB5, 0x45, 0xC1, 0x96, 0xB5, 0xBA, 0xD6, 0x58, 0xC0, 0xFF, 0xFF, 0x06, 0x58, 0xC0, 0x9A, 0xCE,
+0x79, 0x96, 0xC2, 0x14, 0xA5, 0x71, 0x8C, 0xF3, 0x9C, 0x00, 0x91, 0x41, 0x4D, 0x70, 0xC0, 0xFF,
+0xFF, 0x10, 0x48, 0x7B, 0xC1, 0x7B, 0xCE, 0xD1, 0x7B, 0x7B, 0x5F, 0xC0, 0x53, 0x84, 0x53, 0xC0,
+0x9B, 0xCE, 0x7B, 0xC0, 0xF9, 0xB5, 0x53, 0x4F, 0x43, 0x71, 0x15, 0xC0, 0xFB, 0xFE, 0x4E, 0xC2,
+0x4D, 0x93, 0xB3, 0xDC, 0x2D, 0x8B, 0x95, 0x40, 0xC1, 0x0C, 0x8B, 0xAE, 0xA3, 0x52, 0xC4, 0x51,
+0xC4, 0xCB, 0x7A, 0x6D, 0x9B, 0xD3, 0xDC, 0xC7, 0x49, 0x54, 0xC1, 0x96, 0xFD, 0x5D, 0xFF, 0x71,
+0x09, 0x44, 0xC0, 0xD3, 0x9C, 0x44, 0xAE, 0x4D, 0x44, 0xC0, 0x30, 0x84, 0x50, 0x71, 0x4D, 0xC3,
+0xEF, 0x83, 0x3C, 0xEF, 0x55, 0xAD, 0x18, 0xC6, 0x71, 0x4D, 0xC0, 0x75, 0xAD, 0x49, 0xC0, 0xF7,
+0xBD, 0xBA, 0x70, 0xC0, 0xF3, 0xA4, 0x60, 0x49, 0x64, 0x75, 0xC0, 0x59, 0xCE, 0x64, 0xC0, 0x96,
+0xB5, 0x4D, 0x64, 0xC0, 0xF4, 0xA4, 0x75, 0x64, 0xC0, 0xDB, 0xDE, 0x71, 0x05, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x07, 0xA1, 0xC0, 0xD7, 0xFD, 0x55, 0x46, 0x7E, 0xC0, 0x6E, 0x9B, 0x6A, 0x46, 0xC1,
+0x4D, 0x93, 0x10, 0xB4, 0x6F, 0xC1, 0x2C, 0x8B, 0x8E, 0x9B, 0x7E, 0xC0, 0xAA, 0x72, 0x6B, 0x42,
+0x57, 0x71, 0x12, 0x6C, 0x7B, 0x48, 0xC3, 0x32, 0x84, 0xD9, 0xB5, 0xF1, 0x7B, 0xFD, 0xD6, 0x4C,
+0xC2, 0x6B, 0x4A, 0x5B, 0xC6, 0x5F, 0xE7, 0x43, 0x53, 0xC1, 0xBC, 0xCE, 0x9F, 0xEF, 0x71, 0x10,
+0xC0, 0x1C, 0xE7, 0x79, 0xBF, 0xC1, 0xFB, 0xDE, 0x10, 0x84, 0x7D, 0xC1, 0x55, 0xAD, 0x8E, 0x73,
+0xAE, 0xC3, 0x59, 0xC6, 0x9A, 0xCE, 0x9E, 0xF7, 0xFF, 0xFF, 0x06, 0x58, 0x45, 0x48, 0x61, 0x41,
+0x7C, 0x00, 0x64, 0x50, 0xC1, 0x30, 0x84, 0xDB, 0xD6, 0x70, 0x71, 0x10, 0xC0, 0x5E, 0xE7, 0x96,
+0xC0, 0xDD, 0xD6, 0x53, 0x4F, 0xAE, 0xC0, 0x6F, 0x6B, 0x5F, 0x54, 0x00, 0xC0, 0x56, 0xA5, 0xA6,
+0x4F, 0x43, 0x71, 0x15, 0x6D, 0x4E, 0xC1, 0x4D, 0x93, 0x92, 0xD4, 0x44, 0x6A, 0x7E, 0x5B, 0x46,
+0xC1, 0x8E, 0x9B, 0xD3, 0xDC, 0x53, 0x00, 0x52, 0xC3, 0x8A, 0x72, 0xD3, 0xDC, 0x96, 0xFD, 0x7D,
+0xFF, 0x71, 0x09, 0x4D, 0xC0, 0xB6, 0xBD, 0x71, 0x00, 0x78, 0xC1, 0xDB, 0xDE, 0x10, 0x84, 0x4D,
+0x71, 0x70, 0x7D, 0x79, 0x65, 0xC0, 0x34, 0xA5, 0x60, 0x7D, 0x55, 0x79, 0xC1, 0x31, 0x8C, 0x92,
+0x94, 0x78, 0xC0, 0xD7, 0xBD, 0x7D, 0xC1, 0x79, 0xD6, 0xD3, 0x9C, 0x55, 0x69, 0x79, 0x64, 0xC0,
+0x72, 0x94, 0x51, 0x4D, 0x64, 0xC0, 0x51, 0x8C, 0x50, 0x71, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x07, 0x60, 0xC3, 0xD7, 0xFD, 0x31, 0xC4, 0xE8, 0x51, 0xEC, 0x82, 0x6B, 0xC0, 0x6D, 0x93, 0x62,
+0x52, 0xC1, 0x0C, 0x83, 0x31, 0xBC, 0x67, 0x91, 0x44, 0xAB, 0x6B, 0x42, 0xC0, 0x9A, 0xFE, 0x71,
+0x12, 0xA6, 0x7B, 0xC5, 0x5F, 0xE7, 0xB0, 0x73, 0x8C, 0x4A, 0x12, 0x7C, 0x9F, 0xEF, 0x7B, 0xC6,
+0x47, 0xC0, 0x9C, 0xCE, 0x4F, 0xC1, 0x7B, 0xCE, 0x32, 0x84, 0x43, 0xC0, 0x7E, 0xEF, 0x71, 0x10,
+0xC0, 0x1C, 0xE7, 0x79, 0x4D, 0xC1, 0xD7, 0xB5, 0x8E, 0x73, 0x59, 0xC1, 0x14, 0xA5, 0x4D, 0x6B,
+0xBF, 0x65, 0xC1, 0x9A, 0xCE, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x45, 0x4D, 0x79, 0xC0, 0x6D, 0x6B,
+0x65, 0x4C, 0xC1, 0x0C, 0x63, 0xAA, 0x52, 0x54, 0x59, 0xC0, 0x1C, 0xE7, 0x71, 0x10, 0x48, 0x7B,
+0xC0, 0xBC, 0xD6, 0x4B, 0x43, 0xC1, 0x7F, 0xE7, 0x4F, 0x6B, 0x73, 0x54, 0x4F, 0xC1, 0x73, 0x84,
+0x3A, 0xBE, 0x48, 0x43, 0x71, 0x15, 0x6D, 0xC0, 0x96, 0xFD, 0x7C, 0xC0, 0x28, 0x5A, 0x7E, 0xC1,
+0xB2, 0xD4, 0x2C, 0x8B, 0x7E, 0x00, 0x7C, 0xC0, 0x35, 0xF5, 0x62, 0x95, 0x91, 0xBF, 0xC2, 0xB3,
+0xDC, 0x96, 0xFD, 0x7D, 0xFF, 0x71, 0x09, 0xC2, 0x7D, 0xEF, 0xB2, 0x9C, 0xBA, 0xD6, 0x75, 0xC0,
+0x75, 0xB5, 0x69, 0xC0, 0xEF, 0x83, 0x65, 0x71, 0xC1, 0x5D, 0xEF, 0x55, 0xAD, 0x79, 0x7D, 0x50,
+0xC0, 0xBE, 0xF7, 0x44, 0xC0, 0xD3, 0x9C, 0x55, 0x41, 0xC0, 0x9A, 0xD6, 0x65, 0x64, 0x78, 0x55,
+0x41, 0x7C, 0x51, 0x4C, 0x50, 0xC1, 0x71, 0x94, 0x18, 0xC6, 0x00, 0x78, 0x69, 0xC0, 0xFB, 0xDE,
+0x71, 0x05, 0x70, 0x00, 0x71, 0x07, 0xA1, 0xC3, 0xD7, 0xFD, 0x10, 0xBC, 0xAF, 0xAB, 0xB6, 0xFD,
+0x00, 0x7F, 0x4E, 0xC2, 0x72, 0xCC, 0x49, 0x62, 0xB3, 0xD4, 0x6A, 0x67, 0x91, 0x62, 0xC0, 0x14,
+0xE5, 0x42, 0x57, 0x71, 0x12, 0xA6, 0x7B, 0x43, 0x5F, 0xC0, 0x9B, 0xCE, 0x4B, 0xC2, 0xFD, 0xDE,
+0xD5, 0x94, 0x32, 0x84, 0x47, 0xC1, 0x9F, 0xEF, 0x98, 0xAD, 0x47, 0xC0, 0x5F, 0xE7, 0xBD, 0x71,
+0x10, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0x4D, 0xC0, 0xEF, 0x7B, 0x51, 0xC4, 0x1C, 0xDF, 0xCF, 0x7B,
+0x79, 0xCE, 0xB2, 0x94, 0x34, 0xA5, 0x4D, 0xC1, 0x9E, 0xF7, 0xFF, 0xFF, 0x06, 0x58, 0x45, 0x59,
+0xC1, 0x71, 0x8C, 0x14, 0x9D, 0x61, 0x91, 0xC0, 0x18, 0xC6, 0x40, 0x7C, 0x4D, 0x70, 0x71, 0x10,
+0xC0, 0x5E, 0xE7, 0x7B, 0x5B, 0x4B, 0x54, 0xC1, 0x1A, 0xBE, 0x32, 0x7C, 0x4B, 0xC1, 0xDD, 0xD6,
+0x1D, 0xDF, 0x4B, 0xC1, 0xFD, 0xD6, 0x3E, 0xDF, 0xBA, 0x71, 0x15, 0xC5, 0xFB, 0xFE, 0x76, 0xFD,
+0x4D, 0x93, 0xB3, 0xDC, 0xB6, 0xFD, 0x14, 0xED, 0x7D, 0xC0, 0x51, 0xC4, 0x62, 0xC0, 0xCB, 0x7A,
+0x4E, 0x62, 0x7E, 0xC4, 0x0C, 0x83, 0xAE, 0xA3, 0xB2, 0xDC, 0x96, 0xFD, 0x7D, 0xFF, 0x71, 0x0A,
+0x4D, 0x55, 0x75, 0xC1, 0xDB, 0xDE, 0x75, 0xAD, 0x4D, 0x65, 0xC0, 0xDF, 0xFF, 0x71, 0x60, 0x75,
+0xC1, 0xD7, 0xBD, 0x9A, 0xD6, 0x71, 0x4D, 0xC2, 0x96, 0xB5, 0x9E, 0xF7, 0x38, 0xCE, 0x60, 0x79,
+0xC0, 0x51, 0x8C, 0x48, 0x75, 0xC0, 0x76, 0xB5, 0x4D, 0x75, 0x44, 0xC1, 0xB6, 0xB5, 0x59, 0xCE,
+0x49, 0x65, 0x44, 0x78, 0x5C, 0x71, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0xA1, 0x64, 0xC0,
+0x10, 0xBC, 0x7E, 0x53, 0xAE, 0xC0, 0x2C, 0x8B, 0x7C, 0xC1, 0xF4, 0xE4, 0xE8, 0x51, 0x6B, 0x44,
+0x6B, 0x7A, 0xC0, 0x2D, 0x8B, 0x63, 0x42, 0x57, 0x71, 0x12, 0x6C, 0x7B, 0x43, 0xC0, 0x12, 0x7C,
+0x67, 0xC1, 0x16, 0x9D, 0x94, 0x8C, 0x90, 0xC2, 0x1D, 0xDF, 0xF1, 0x7B, 0xFD, 0xD6, 0x73, 0xC1,
+0xD9, 0xB5, 0x5F, 0xE7, 0xBD, 0x71, 0x10, 0xC0, 0x1C, 0xE7, 0x4D, 0xC2, 0x14, 0xA5, 0x08, 0x42,
+0x10, 0x84, 0x65, 0xC1, 0x92, 0x94, 0x8E, 0x73, 0x91, 0x51, 0x4D, 0xC0, 0x9E, 0xF7, 0x71, 0x06,
+0x58, 0x4D, 0xC0, 0x18, 0xBE, 0x60, 0xC0, 0xAE, 0x73, 0x69, 0x65, 0x59, 0x44, 0xC0, 0x18, 0xBE,
+0x48, 0x70, 0x71, 0x10, 0xC0, 0x5E, 0xE7, 0x7B, 0xC0, 0xBC, 0xD6, 0x7F, 0xC0, 0x7F, 0xE7, 0x5F,
+0xC4, 0x3A, 0xC6, 0x16, 0x9D, 0x57, 0xA5, 0x5A, 0xC6, 0x52, 0x84, 0x4F, 0x7B, 0x43, 0x71, 0x15,
+0x6D, 0x4E, 0xC1, 0x2D, 0x8B, 0xD3, 0xDC, 0x4E, 0xA9, 0xC1, 0x08, 0x52, 0x92, 0xD4, 0x62, 0xC1,
+0xCB, 0x7A, 0xB6, 0xFD, 0x4B, 0x54, 0xC2, 0x55, 0xF5, 0x6D, 0x93, 0xB2, 0xD4, 0x53, 0xC0, 0x7D,
+0xFF, 0x71, 0x1D, 0x75, 0xBF, 0x71, 0x12, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0xA6, 0x64, 0xC0,
+0xF3, 0xE4, 0x63, 0x4E, 0x00, 0x5C, 0x54, 0x7F, 0x40, 0x42, 0xC0, 0xB3, 0xDC, 0x47, 0x4E, 0x54,
+0x7F, 0xB6, 0x6D, 0x71, 0x13, 0xC0, 0x3E, 0xDF, 0x7B, 0x78, 0x74, 0x67, 0xC4, 0xF9, 0xB5, 0x7B,
+0xCE, 0x5F, 0xE7, 0x5B, 0xC6, 0xDC, 0xD6, 0x7F, 0xC0, 0xFD, 0xD6, 0x7B, 0xC0, 0x9F, 0xEF, 0x71,
+0x10, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0x5D, 0xC0, 0xD3, 0x94, 0xA5, 0x65, 0xC0, 0x79, 0xCE, 0x59,
+0xC0, 0x34, 0xA5, 0x4D, 0x45, 0xC0, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x45, 0xA1, 0x41, 0xC1, 0x92,
+0x94, 0xD7, 0xB5, 0x79, 0x59, 0x69, 0x4D, 0x45, 0x70, 0x71, 0x10, 0xC0, 0x7E, 0xEF, 0x7B, 0xA9,
+0x78, 0x7B, 0xC0, 0x3A, 0xBE, 0x40, 0x67, 0x7F, 0xC0, 0xBC, 0xD6, 0x47, 0x43, 0x7B, 0x43, 0x71,
+0x15, 0x4A, 0x42, 0x54, 0x7A, 0xC0, 0x75, 0xFD, 0x00, 0xC0, 0x92, 0xD4, 0x7A, 0x80, 0x54, 0x4E,
+0x54, 0xC0, 0x55, 0xF5, 0x53, 0x54, 0x6B, 0x53, 0xC0, 0xBE, 0xFF, 0x71, 0x09, 0x91, 0xBF, 0x71,
+0x58, 0x6C, 0x5D, 0x71, 0x5D, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x58, 0x71, 0x07, 0x5D, 0x71, 0x6C,
+0x58, 0x71, 0x5D, 0x71, 0x75, 0x00, 0x6C, 0xC0, 0xFB, 0xDE, 0x5D, 0x71, 0x07, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x08, 0xC0, 0x1C, 0xFF, 0x47, 0x42, 0x7D, 0x00, 0x42, 0x01, 0x47, 0x42, 0x03, 0x7D,
+0xC0, 0xF8, 0xFD, 0x6C, 0x71, 0x13, 0x82, 0xC0, 0x3E, 0xDF, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x7B,
+0x43, 0x7B, 0x43, 0x7B, 0x43, 0x71, 0x11, 0xC1, 0x1C, 0xE7, 0x79, 0xCE, 0x4D, 0xBF, 0x00, 0x4D,
+0xA6, 0xC0, 0xDB, 0xD6, 0x00, 0x45, 0x00, 0x58, 0x71, 0x06, 0x58, 0x45, 0x48, 0x59, 0xBE, 0x4D,
+0x48, 0x59, 0x4D, 0x45, 0x00, 0x70, 0x71, 0x10, 0x6C, 0x43, 0x7B, 0x43, 0x7B, 0x43, 0x7B, 0x40,
+0xAE, 0x40, 0x45, 0x7B, 0x40, 0xC0, 0xBF, 0xF7, 0x71, 0x16, 0xC0, 0x59, 0xFE, 0x42, 0x02, 0x47,
+0x42, 0x01, 0x7D, 0x42, 0x00, 0x7D, 0x42, 0x00, 0xC0, 0xBA, 0xFE, 0x71, 0x0A, 0x48, 0x91, 0x58,
+0x68, 0x79, 0xC2, 0x51, 0x8C, 0x7A, 0xD6, 0x96, 0xB5, 0x71, 0x44, 0x54, 0x70, 0x44, 0x5D, 0x75,
+0x71, 0xC0, 0x7D, 0xEF, 0x44, 0x00, 0x5D, 0x71, 0xC0, 0xB6, 0xBD, 0x44, 0x79, 0xC0, 0x71, 0x8C,
+0x58, 0x51, 0xBF, 0xC1, 0xF3, 0xA4, 0x38, 0xCE, 0x74, 0x6D, 0x55, 0x6C, 0x71, 0x06, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x09, 0xC0, 0x7D, 0xFF, 0x5C, 0xA6, 0x09, 0xC0, 0xFB, 0xFE, 0x6C, 0x71, 0x0A,
+0x6C, 0xC0, 0x7E, 0xFF, 0xA6, 0x07, 0x91, 0x96, 0x00, 0xA6, 0x75, 0x50, 0xAF, 0x02, 0xBA, 0x71,
+0x12, 0xC0, 0x1C, 0xE7, 0x79, 0xAF, 0x07, 0x58, 0x71, 0x06, 0x58, 0x45, 0x08, 0x70, 0x71, 0x11,
+0x6C, 0x5C, 0x02, 0xA1, 0x75, 0x03, 0xC0, 0x3D, 0xF7, 0x56, 0x51, 0x05, 0x56, 0x71, 0x0F, 0xC0,
+0x1C, 0xFF, 0x57, 0x0A, 0xC0, 0x3C, 0xFF, 0x71, 0x0B, 0x49, 0x69, 0x65, 0x55, 0x60, 0xC1, 0xB2,
+0x94, 0x14, 0xA5, 0xBF, 0x71, 0x61, 0x54, 0x41, 0x4C, 0x69, 0xC0, 0xD3, 0x9C, 0x48, 0xC0, 0xB2,
+0x9C, 0x96, 0x6D, 0x40, 0x71, 0xC0, 0x79, 0xCE, 0x60, 0xC2, 0xB6, 0xB5, 0xF4, 0xA4, 0x5D, 0xEF,
+0x7D, 0x4C, 0x68, 0xC0, 0xFB, 0xE6, 0x65, 0x59, 0x7C, 0x6C, 0x71, 0x06, 0x70, 0x00, 0x71, 0x23,
+0x6C, 0xC0, 0xBC, 0xFE, 0xA6, 0x6A, 0x00, 0x65, 0x6A, 0x00, 0xA1, 0x65, 0x02, 0x6A, 0x01, 0x59,
+0xC0, 0xDC, 0xFE, 0x71, 0x17, 0xC0, 0x1C, 0xE7, 0x79, 0x4D, 0xAF, 0x00, 0x48, 0x4D, 0x59, 0x00,
+0x45, 0x00, 0x58, 0x71, 0x06, 0x58, 0x45, 0x48, 0x59, 0x00, 0x4D, 0x48, 0x61, 0x4D, 0x45, 0x00,
+0x70, 0x71, 0x15, 0x6C, 0x6A, 0xA5, 0x6A, 0x02, 0xAB, 0x6A, 0x65, 0xA5, 0x65, 0x01, 0x6A, 0x65,
+0x59, 0xC1, 0xFC, 0xFE, 0xFF, 0xFF, 0x2A, 0xC0, 0x55, 0xAD, 0x68, 0x79, 0x4C, 0x7D, 0x55, 0xC0,
+0x30, 0x84, 0x71, 0x49, 0x78, 0x7D, 0x70, 0x40, 0xC0, 0xDB, 0xDE, 0x64, 0xC0, 0xF7, 0xBD, 0xBA,
+0x48, 0x78, 0x71, 0x58, 0x68, 0xC0, 0x75, 0xB5, 0x7D, 0x49, 0x78, 0xC0, 0x3C, 0xE7, 0x70, 0x68,
+0x6C, 0x78, 0x55, 0x44, 0x71, 0x06, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x23, 0xC0, 0x1D, 0xFF, 0x65,
+0xC5, 0xB8, 0xDD, 0x4E, 0x7B, 0x31, 0x9C, 0xD8, 0xDD, 0xAF, 0x8B, 0x32, 0xA4, 0x5E, 0xC1, 0x56,
+0xCD, 0x19, 0xE6, 0xA6, 0xC2, 0x77, 0xCD, 0xF4, 0xBC, 0x2D, 0x7B, 0x43, 0x6A, 0x59, 0xC0, 0x3D,
+0xFF, 0x71, 0x16, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0x60, 0xC1, 0x6D, 0x73, 0x30, 0x84, 0x48, 0x79,
+0xC0, 0xAE, 0x73, 0x7C, 0x4D, 0x96, 0x58, 0x71, 0x06, 0x58, 0x45, 0x00, 0xC2, 0xEF, 0x7B, 0x8E,
+0x73, 0x38, 0xC6, 0xBF, 0xC0, 0xF0, 0x83, 0x64, 0x4D, 0x45, 0x70, 0xC0, 0xFF, 0xFF, 0x15, 0x40,
+0x59, 0x9A, 0xC2, 0xF0, 0x93, 0x8F, 0x8B, 0xB4, 0xB4, 0x68, 0x00, 0xC2, 0xF1, 0x9B, 0xD4, 0xBC,
+0x5B, 0xF6, 0x5A, 0x95, 0xC1, 0x93, 0xAC, 0x4E, 0x7B, 0x5A, 0x6A, 0x59, 0xC0, 0x5E, 0xFF, 0x71,
+0x29, 0xC1, 0xD7, 0xBD, 0xB2, 0x94, 0x75, 0xC0, 0xF7, 0xBD, 0x4C, 0x4D, 0xC0, 0xAF, 0x7B, 0x71,
+0x49, 0x7D, 0x51, 0xC0, 0x9E, 0xF7, 0x64, 0x6D, 0x79, 0x60, 0x65, 0x4D, 0x4C, 0x71, 0x00, 0xC0,
+0x51, 0x8C, 0x74, 0xC0, 0xBB, 0xDE, 0x6D, 0x50, 0x61, 0x6C, 0xC0, 0xF4, 0xA4, 0x4C, 0xC1, 0x71,
+0x8C, 0x34, 0xA5, 0x51, 0x44, 0x71, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x23, 0xC3, 0xFD, 0xFE,
+0x5B, 0xF6, 0x4D, 0x7B, 0xF5, 0xBC, 0x00, 0x78, 0x68, 0xAE, 0xC2, 0xF4, 0xBC, 0x36, 0xCD, 0x52,
+0xA4, 0x00, 0xC1, 0x36, 0xC5, 0x98, 0xD5, 0x5B, 0xC1, 0x4E, 0x7B, 0x9C, 0xFE, 0xA5, 0x40, 0x71,
+0x16, 0xC0, 0x1C, 0xE7, 0x45, 0x60, 0x69, 0x5D, 0x69, 0xC2, 0xF3, 0x9C, 0x30, 0x84, 0x8E, 0x73,
+0x60, 0xC1, 0x9A, 0xCE, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x45, 0x79, 0x69, 0xC0, 0x51, 0x84, 0xBA,
+0x79, 0xC0, 0x4D, 0x6B, 0x54, 0xC0, 0xDB, 0xD6, 0x45, 0x70, 0x71, 0x15, 0xC0, 0xDC, 0xFE, 0x6A,
+0x64, 0xC0, 0xF1, 0x93, 0x72, 0xC0, 0xB3, 0xB4, 0x78, 0xC0, 0xCB, 0x6A, 0x43, 0xC0, 0x72, 0xAC,
+0x47, 0xC1, 0xF0, 0x93, 0x97, 0xD5, 0x00, 0x47, 0x68, 0x6A, 0xA1, 0xC0, 0x1D, 0xFF, 0x71, 0x2A,
+0xA6, 0x71, 0x6C, 0x00, 0x71, 0x6C, 0x71, 0x00, 0x6C, 0x00, 0x71, 0x91, 0xC0, 0x5D, 0xEF, 0x71,
+0x6C, 0x00, 0x71, 0x6C, 0x71, 0x00, 0x6C, 0x71, 0x00, 0x70, 0x5D, 0x71, 0x61, 0x58, 0x71, 0x70,
+0x5D, 0x4D, 0xC0, 0x7D, 0xF7, 0x71, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x23, 0x40, 0xC0, 0x77,
+0xD5, 0x41, 0x7B, 0x00, 0xC0, 0x36, 0xC5, 0x5B, 0x43, 0x5F, 0xC0, 0xDD, 0xFE, 0x4A, 0xBF, 0x65,
+0x00, 0x5A, 0xC0, 0xD0, 0x93, 0x65, 0xA5, 0x40, 0x71, 0x16, 0xC0, 0x1C, 0xE7, 0x79, 0x4D, 0x45,
+0xC1, 0x30, 0x84, 0x96, 0xB5, 0x45, 0x60, 0xC1, 0x92, 0x94, 0x55, 0xAD, 0x4D, 0x58, 0x71, 0x06,
+0x58, 0xC0, 0x9A, 0xCE, 0x4D, 0x00, 0xC0, 0xD3, 0x9C, 0x68, 0xC3, 0x1C, 0xDF, 0x96, 0xAD, 0x71,
+0x8C, 0xDB, 0xD6, 0x45, 0x70, 0x71, 0x15, 0xC3, 0xDC, 0xFE, 0x7B, 0xFE, 0x6E, 0x83, 0x5B, 0xF6,
+0x6F, 0x6A, 0xC1, 0x3A, 0xEE, 0xD0, 0x93, 0x7B, 0x56, 0xC0, 0xEC, 0x6A, 0x7C, 0x6A, 0x65, 0x77,
+0xC0, 0x11, 0x9C, 0x6A, 0xA1, 0x40, 0x71, 0xE0, 0x12, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x23, 0x40,
+0xC1, 0x15, 0xC5, 0x52, 0xA4, 0x76, 0x6A, 0x77, 0xC0, 0x6A, 0x5A, 0xBE, 0x5A, 0xC1, 0x1E, 0xFF,
+0x6E, 0x83, 0x41, 0x7B, 0xC0, 0x1A, 0xEE, 0x62, 0x50, 0x76, 0xC0, 0x7B, 0xFE, 0x40, 0x71, 0x16,
+0xC0, 0x1C, 0xE7, 0x45, 0x4D, 0xC5, 0x71, 0x8C, 0x8A, 0x52, 0x59, 0xC6, 0xF0, 0x7B, 0x38, 0xC6,
+0xB2, 0x94, 0x55, 0x4D, 0x58, 0xC0, 0xFF, 0xFF, 0x06, 0x58, 0x45, 0xC2, 0xDB, 0xD6, 0x55, 0xAD,
+0x49, 0x4A, 0x64, 0x61, 0x64, 0xC1, 0x71, 0x8C, 0xDB, 0xD6, 0x45, 0x70, 0x71, 0x15, 0x7B, 0xC2,
+0x3A, 0xF6, 0x8F, 0x8B, 0x7B, 0xFE, 0x5E, 0xAB, 0xC0, 0xF9, 0xE5, 0x7C, 0x6A, 0x7B, 0xC3, 0xEC,
+0x6A, 0x93, 0xB4, 0xFD, 0xFE, 0xD8, 0xDD, 0x46, 0xC0, 0x93, 0xAC, 0x76, 0x59, 0x40, 0x71, 0x28,
+0x5D, 0x70, 0x61, 0x60, 0x71, 0x04, 0x5C, 0x6C, 0x71, 0x04, 0xC0, 0x9A, 0xD6, 0x6C, 0x71, 0x02,
+0x49, 0xBB, 0x6C, 0x71, 0x0D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x23, 0x40, 0x77, 0x50, 0x7B, 0x00,
+0x77, 0x41, 0x50, 0xC0, 0x36, 0xC5, 0x56, 0x4A, 0xC0, 0x8F, 0x83, 0x59, 0x6A, 0xA6, 0xC0, 0xAF,
+0x8B, 0x42, 0x65, 0x40, 0x71, 0x16, 0xC0, 0x1C, 0xE7, 0x79, 0x4D, 0xC1, 0x1C, 0xDF, 0xD3, 0x9C,
+0xAE, 0xC3, 0x30, 0x84, 0x38, 0xC6, 0x92, 0x94, 0x35, 0xA5, 0x4D, 0x58, 0x71, 0x06, 0x58, 0xC0,
+0x9A, 0xCE, 0x48, 0x61, 0xC1, 0xB6, 0xB5, 0x10, 0x84, 0x61, 0x69, 0x68, 0xC0, 0xDB, 0xDE, 0x45,
+0x70, 0x71, 0x15, 0xC0, 0xDC, 0xFE, 0x56, 0xC0, 0x8F, 0x83, 0x56, 0x6A, 0x00, 0xC1, 0xF9, 0xE5,
+0xD0, 0x93, 0x76, 0x6E, 0xC0, 0x0D, 0x73, 0x7C, 0x6A, 0x00, 0xC1, 0x5A, 0xF6, 0xAF, 0x8B, 0x59,
+0x00, 0xC0, 0x1D, 0xFF, 0x71, 0x28, 0x58, 0xC2, 0xBA, 0xDE, 0x71, 0x94, 0xF7, 0xC5, 0x71, 0x70,
+0x44, 0x95, 0x60, 0x4D, 0x57, 0xC1, 0x38, 0xC6, 0x96, 0xB5, 0x58, 0x48, 0x78, 0x49, 0x71, 0xC0,
+0x14, 0xA5, 0x00, 0x49, 0x4D, 0x65, 0x70, 0xC0, 0x30, 0x8C, 0x9A, 0x60, 0x44, 0xC0, 0xD7, 0xBD,
+0x58, 0xC0, 0x59, 0xCE, 0x4C, 0x49, 0x75, 0x49, 0x71, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x23,
+0x7B, 0xC2, 0x3A, 0xF6, 0x2D, 0x7B, 0x77, 0xD5, 0x43, 0xC0, 0x93, 0xAC, 0x00, 0xC0, 0x19, 0xEE,
+0x7C, 0xC0, 0xB3, 0xB4, 0x4F, 0xC0, 0x72, 0xAC, 0x5B, 0x5F, 0x46, 0xC0, 0x6E, 0x83, 0x51, 0xBE,
+0xC0, 0x1D, 0xFF, 0x71, 0x16, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0x60, 0x4C, 0xC0, 0x10, 0x84, 0x55,
+0xC0, 0xB2, 0x94, 0x68, 0xC2, 0xCF, 0x7B, 0xF7, 0xBD, 0x9A, 0xD6, 0x58, 0x71, 0x06, 0x58, 0x45,
+0x74, 0xC0, 0xB6, 0xB5, 0x6D, 0x40, 0xC2, 0xDB, 0xD6, 0x71, 0x8C, 0x8E, 0x73, 0x79, 0x45, 0x70,
+0x71, 0x15, 0x6F, 0x6A, 0xC1, 0x11, 0x9C, 0x72, 0xAC, 0x5A, 0x46, 0xC1, 0x1A, 0xEE, 0x8F, 0x8B,
+0x7B, 0xC0, 0x31, 0x9C, 0x77, 0x50, 0x77, 0x5F, 0xC0, 0x36, 0xC5, 0x68, 0xC0, 0x9C, 0xFE, 0xA5,
+0xC0, 0x1D, 0xFF, 0x71, 0x26, 0xC0, 0x9E, 0xF7, 0x57, 0x49, 0xC0, 0xB6, 0xBD, 0x64, 0xC0, 0xDB,
+0xDE, 0x71, 0xC0, 0x96, 0xB5, 0x48, 0x78, 0xC0, 0x71, 0x94, 0x61, 0x4C, 0xC0, 0x51, 0x8C, 0x78,
+0x69, 0xC2, 0xB6, 0xB5, 0x34, 0xA5, 0x38, 0xCE, 0x71, 0xC0, 0x14, 0xA5, 0x7D, 0x40, 0x74, 0xC0,
+0x30, 0x84, 0x60, 0x64, 0x55, 0xC0, 0xBA, 0xDE, 0x41, 0xC0, 0x30, 0x8C, 0x69, 0xC0, 0xD3, 0x9C,
+0x50, 0xC0, 0x75, 0xB5, 0x78, 0x44, 0x71, 0x05, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x23, 0x7B, 0x65,
+0x77, 0xC1, 0x0C, 0x73, 0xF0, 0x93, 0x43, 0x6F, 0x6A, 0xC0, 0xB3, 0xB4, 0x91, 0x4A, 0x6E, 0x5B,
+0xC1, 0x52, 0xA4, 0xCC, 0x6A, 0x63, 0x6A, 0x59, 0xC0, 0x3D, 0xFF, 0x71, 0x16, 0xC0, 0x1C, 0xE7,
+0x4D, 0x7D, 0xC2, 0xEC, 0x62, 0xAE, 0x73, 0x9A, 0xCE, 0x91, 0xC1, 0x4D, 0x6B, 0x71, 0x8C, 0x4D,
+0x45, 0x58, 0xC0, 0xFF, 0xFF, 0x06, 0x58, 0xC0, 0x9A, 0xD6, 0x81, 0xC0, 0x6D, 0x6B, 0x91, 0xC0,
+0x18, 0xBE, 0x74, 0xC1, 0x8E, 0x73, 0x0C, 0x63, 0x78, 0x4D, 0xC1, 0x1C, 0xE7, 0xFF, 0xFF, 0x15,
+0x7B, 0x65, 0x42, 0xC1, 0x8E, 0x83, 0x2D, 0x73, 0x4B, 0xC1, 0x5B, 0xF6, 0xD4, 0xB4, 0x65, 0xC1,
+0x93, 0xAC, 0x9B, 0xFE, 0x52, 0x63, 0x41, 0xC0, 0xEC, 0x6A, 0x43, 0x6A, 0xA1, 0xC0, 0x3D, 0xFF,
+0x71, 0x26, 0x7D, 0xC1, 0xCF, 0x7B, 0xBE, 0xF7, 0x7D, 0xBA, 0xC0, 0x3D, 0xEF, 0x71, 0xC0, 0x75,
+0xAD, 0x7D, 0xC0, 0xF7, 0xBD, 0x74, 0xC0, 0xF3, 0xA4, 0x69, 0xC1, 0xF3, 0x9C, 0xDB, 0xDE, 0x55,
+0xC0, 0xD7, 0xBD, 0x40, 0xC0, 0x39, 0xCE, 0x71, 0xC0, 0x14, 0xA5, 0x74, 0xC0, 0x55, 0xAD, 0x00,
+0xC0, 0x92, 0x94, 0x4C, 0xA6, 0x7D, 0x61, 0x7C, 0x4C, 0x5C, 0x64, 0x71, 0x55, 0xC0, 0xB2, 0x9C,
+0x71, 0x06, 0x70, 0x00, 0x71, 0x23, 0xC0, 0x9F, 0xFF, 0x65, 0xAB, 0x65, 0x02, 0xA6, 0xC0, 0xBD,
+0xFE, 0x00, 0x65, 0x00, 0x6C, 0x65, 0x00, 0x71, 0x60, 0x65, 0xC1, 0xBF, 0xFF, 0xFF, 0xFF, 0x16,
+0xC0, 0x1C, 0xE7, 0x79, 0x4D, 0x00, 0xAE, 0x48, 0x4D, 0x01, 0x96, 0x00, 0xC0, 0x9E, 0xF7, 0x71,
+0x06, 0x58, 0x45, 0x4D, 0x02, 0x45, 0xC0, 0xDB, 0xD6, 0x61, 0x4D, 0x45, 0x70, 0x71, 0x15, 0x62,
+0x60, 0x65, 0xAF, 0x65, 0x00, 0x60, 0x71, 0x60, 0x71, 0x60, 0x65, 0x02, 0x6C, 0x60, 0x65, 0xC0,
+0xDF, 0xFF, 0xAE, 0x26, 0xC0, 0xCF, 0x7B, 0x47, 0xC0, 0xDF, 0xFF, 0x4D, 0x00, 0x58, 0x71, 0xC0,
+0x18, 0xC6, 0x7C, 0x48, 0xC0, 0x96, 0xB5, 0x60, 0x4D, 0xC1, 0x38, 0xCE, 0x3C, 0xE7, 0x5C, 0x60,
+0xC0, 0xAF, 0x7B, 0x48, 0x71, 0x60, 0xC0, 0xB2, 0x9C, 0x5C, 0x51, 0x50, 0xC0, 0x1C, 0xE7, 0x51,
+0x78, 0x60, 0x4D, 0x50, 0x61, 0x48, 0x71, 0x78, 0x51, 0x71, 0x06, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x23, 0xC2, 0xFC, 0xFF, 0x7A, 0xFF, 0xF9, 0xFE, 0xA6, 0x0B, 0x5F, 0xC0, 0x9A, 0xFF, 0x5C, 0x71,
+0x16, 0xC0, 0x1C, 0xE7, 0x79, 0x45, 0x48, 0x45, 0x01, 0x48, 0x45, 0x01, 0x58, 0x71, 0x06, 0x58,
+0x45, 0x00, 0x48, 0x00, 0x45, 0x04, 0x70, 0x71, 0x15, 0x5C, 0x7A, 0x5F, 0x5A, 0x0B, 0x5F, 0x7F,
+0x5C, 0x71, 0x0D, 0xA1, 0xC0, 0x5D, 0xFF, 0x0A, 0x6C, 0x71, 0x08, 0x5D, 0xC1, 0x0C, 0x63, 0x5D,
+0xEF, 0x71, 0x0C, 0x74, 0x64, 0x58, 0x71, 0x0C, 0x6C, 0x78, 0x58, 0x71, 0x06, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x21, 0xA9, 0xC2, 0xB4, 0xF7, 0xB0, 0xF7, 0xF0, 0xFF, 0x9A, 0x7B, 0xAE, 0x7B, 0x00,
+0x40, 0x00, 0x48, 0x00, 0x40, 0x01, 0x7B, 0x40, 0x48, 0x40, 0x91, 0xC0, 0xD4, 0xF7, 0x6A, 0x71,
+0x14, 0xC0, 0x1C, 0xE7, 0x79, 0xBF, 0x59, 0x4D, 0x96, 0x4D, 0x59, 0x4D, 0x45, 0x00, 0x58, 0x71,
+0x06, 0x58, 0x45, 0x00, 0x59, 0x00, 0x45, 0x48, 0x59, 0x4D, 0x45, 0x00, 0x70, 0x71, 0x13, 0xA8,
+0xC0, 0xB3, 0xF7, 0x40, 0x00, 0x96, 0x40, 0x7B, 0x00, 0xC0, 0xF0, 0xFF, 0x9A, 0x7B, 0x40, 0x7B,
+0x02, 0x40, 0x7B, 0x48, 0x40, 0x7B, 0xC0, 0xD5, 0xF7, 0x71, 0x0B, 0xC1, 0xDB, 0xFE, 0x96, 0xFD,
+0x00, 0xA5, 0x01, 0xAB, 0x47, 0x01, 0x4E, 0x47, 0xA6, 0x4E, 0xC0, 0xB6, 0xFD, 0x7E, 0x71, 0x07,
+0x74, 0xC0, 0x4D, 0x6B, 0x71, 0x16, 0xA6, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0xC4,
+0xD6, 0xF7, 0xAE, 0xF7, 0x90, 0xEF, 0xAC, 0xB5, 0x6D, 0xCE, 0x45, 0xC1, 0xEE, 0xDE, 0x8F, 0xEF,
+0xA6, 0xC1, 0x0F, 0xDF, 0x4D, 0xC6, 0x92, 0xA5, 0xC0, 0xCE, 0xD6, 0x00, 0x46, 0x7B, 0xC2, 0x8E,
+0xCE, 0xED, 0xBD, 0x4F, 0xE7, 0x7B, 0x94, 0xC1, 0xD7, 0xF7, 0xFF, 0xFF, 0x14, 0xC1, 0x1C, 0xE7,
+0x9A, 0xCE, 0x79, 0x41, 0xC0, 0x96, 0xAD, 0x59, 0xC0, 0x38, 0xC6, 0x7C, 0xC0, 0x18, 0xBE, 0x4D,
+0x45, 0xC0, 0x9E, 0xF7, 0x71, 0x06, 0x58, 0x45, 0x00, 0x55, 0xA6, 0x4D, 0x79, 0x41, 0x75, 0x4D,
+0x45, 0x70, 0x71, 0x13, 0x63, 0xC0, 0xAF, 0xF7, 0x46, 0x52, 0x40, 0x7E, 0x5F, 0x40, 0x44, 0x00,
+0x67, 0x52, 0x7B, 0x5F, 0xA6, 0x7B, 0x7E, 0x5A, 0xC0, 0x8C, 0xAD, 0x46, 0x40, 0x90, 0xC0, 0xD8,
+0xFF, 0x71, 0x09, 0xC0, 0x9E, 0xFF, 0x4E, 0xC2, 0xD3, 0xDC, 0x51, 0xC4, 0x34, 0xED, 0xA6, 0x42,
+0xC0, 0x14, 0xE5, 0x70, 0xBB, 0x6B, 0x54, 0x70, 0x47, 0xC3, 0xB3, 0xDC, 0x34, 0xF5, 0xB6, 0xFD,
+0xDF, 0xFF, 0x71, 0x06, 0xC0, 0x71, 0x94, 0x50, 0x71, 0x00, 0x6C, 0x00, 0x71, 0x92, 0x6C, 0x71,
+0x00, 0x91, 0x71, 0x00, 0x6C, 0xC0, 0xF8, 0xC5, 0x5D, 0x00, 0x71, 0x00, 0x5D, 0x71, 0x5D, 0x71,
+0x5D, 0x00, 0xC1, 0x38, 0xCE, 0xDB, 0xDE, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0xC6,
+0xB3, 0xF7, 0xCF, 0xF7, 0xCB, 0x9C, 0xC9, 0x7B, 0x68, 0x73, 0xAE, 0xD6, 0x8A, 0x8C, 0x5F, 0xC1,
+0x4D, 0xC6, 0xEB, 0x9C, 0x00, 0xC1, 0x87, 0x52, 0x68, 0x6B, 0x77, 0xC1, 0x48, 0x6B, 0x4A, 0x8C,
+0x48, 0x66, 0xBE, 0xC1, 0x09, 0x84, 0x90, 0xEF, 0x74, 0x57, 0x71, 0x14, 0xC0, 0x1C, 0xE7, 0x4D,
+0x4C, 0xC1, 0xCF, 0x7B, 0x0C, 0x63, 0x51, 0x41, 0xC0, 0x4D, 0x6B, 0x00, 0x45, 0x00, 0xC0, 0x9E,
+0xF7, 0x71, 0x06, 0x58, 0x45, 0xA5, 0xC0, 0x10, 0x84, 0x70, 0x41, 0xC0, 0x18, 0xC6, 0x6C, 0x70,
+0x7D, 0x4D, 0xC0, 0x1C, 0xE7, 0x71, 0x13, 0xC0, 0xB2, 0xF7, 0x48, 0x4F, 0x00, 0xC5, 0xF1, 0xFF,
+0xA7, 0x52, 0x0D, 0xC6, 0x6C, 0xAD, 0xA8, 0x73, 0x29, 0x8C, 0x6A, 0xC0, 0xAB, 0x94, 0x48, 0xC0,
+0x0D, 0xBE, 0x6A, 0x6F, 0xC0, 0x0B, 0xA5, 0x77, 0x42, 0x00, 0xC0, 0x90, 0xEF, 0x74, 0xC0, 0xD5,
+0xF7, 0x71, 0x09, 0xC0, 0xFB, 0xFE, 0x4E, 0xC7, 0x0C, 0x8B, 0x8A, 0x6A, 0x0C, 0x83, 0x4D, 0x93,
+0xF4, 0xE4, 0x2C, 0x8B, 0xCF, 0xAB, 0x51, 0xC4, 0x91, 0xC0, 0x8A, 0x72, 0x7E, 0xC2, 0x55, 0xF5,
+0xC7, 0x49, 0xD3, 0xDC, 0x4E, 0xC0, 0x7D, 0xFF, 0x71, 0x06, 0xC0, 0x4D, 0x6B, 0x4D, 0x71, 0x91,
+0xC0, 0x14, 0xA5, 0xBF, 0x5C, 0xC1, 0x71, 0x94, 0x3C, 0xE7, 0x71, 0xC0, 0x96, 0xB5, 0x50, 0x7D,
+0xBB, 0x79, 0xC0, 0x51, 0x8C, 0x78, 0x50, 0xC0, 0xF7, 0xBD, 0x5B, 0xC3, 0x34, 0xA5, 0x75, 0xAD,
+0x92, 0x94, 0x9A, 0xD6, 0xA5, 0x55, 0xBF, 0xC0, 0xDB, 0xDE, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x21, 0xC1, 0xD3, 0xF7, 0x2E, 0xE7, 0x42, 0xC2, 0xF0, 0xFF, 0x4D, 0xC6, 0xAA, 0x94, 0xA6,
+0xC0, 0x4F, 0xE7, 0x5D, 0xC3, 0xEB, 0x9C, 0xF1, 0xFF, 0xCB, 0x9C, 0x8E, 0xD6, 0x4F, 0x74, 0xC7,
+0xCA, 0x9C, 0xB0, 0xF7, 0x6A, 0x8C, 0xD0, 0xF7, 0x4A, 0x8C, 0x0F, 0xDF, 0xAF, 0xF7, 0xB4, 0xF7,
+0x71, 0x14, 0xC0, 0x1C, 0xE7, 0x79, 0xBF, 0xC1, 0x3C, 0xE7, 0xB2, 0x94, 0x41, 0x59, 0xC0, 0x1C,
+0xDF, 0x6C, 0x51, 0x48, 0x58, 0x71, 0x06, 0x58, 0x45, 0x00, 0x6D, 0xC1, 0xB6, 0xB5, 0x10, 0x84,
+0x59, 0x75, 0xC0, 0xB2, 0x94, 0x41, 0x4D, 0x70, 0x71, 0x13, 0xC3, 0xB2, 0xF7, 0xF0, 0xFF, 0xCA,
+0x94, 0xA8, 0x73, 0x46, 0xC3, 0xC7, 0x5A, 0xCC, 0xBD, 0x29, 0x84, 0x90, 0xEF, 0x48, 0xC1, 0x8E,
+0xCE, 0x8A, 0x94, 0x48, 0xC0, 0x2D, 0xC6, 0x54, 0xA6, 0x73, 0x7B, 0xC0, 0xF1, 0xFF, 0x63, 0xC0,
+0xCE, 0xDE, 0x74, 0xC1, 0xB5, 0xF7, 0xFF, 0xFF, 0x09, 0xC0, 0xFB, 0xFE, 0x4E, 0xC9, 0x4D, 0x93,
+0x55, 0xF5, 0x6E, 0x9B, 0x0C, 0x8B, 0x51, 0xC4, 0x2D, 0x93, 0xAF, 0xA3, 0xEF, 0xB3, 0x72, 0xCC,
+0x0C, 0x83, 0x53, 0xC4, 0x92, 0xD4, 0x08, 0x5A, 0xD3, 0xE4, 0x96, 0xFD, 0x7D, 0xFF, 0x71, 0x05,
+0xC1, 0xFB, 0xDE, 0x0C, 0x63, 0x71, 0x00, 0x4D, 0xC0, 0x38, 0xC6, 0x60, 0xC0, 0x75, 0xAD, 0x51,
+0x71, 0xC1, 0x5D, 0xEF, 0x30, 0x84, 0x50, 0x51, 0xC1, 0x4D, 0x6B, 0xBE, 0xF7, 0x4C, 0x69, 0xC0,
+0x92, 0x94, 0x64, 0x69, 0xC1, 0x1C, 0xE7, 0x96, 0xB5, 0x79, 0x7D, 0x60, 0xC0, 0x71, 0x8C, 0xA6,
+0x70, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0x55, 0xC2, 0x8D, 0xCE, 0x6A, 0x8C, 0xF1,
+0xFF, 0x52, 0xC0, 0x8A, 0x8C, 0x63, 0x5F, 0xC1, 0x4D, 0xC6, 0xEB, 0x9C, 0x4F, 0xC1, 0xAA, 0x94,
+0x6D, 0xCE, 0x48, 0xC2, 0x8E, 0xD6, 0xCA, 0x9C, 0xF0, 0xF7, 0x66, 0xC2, 0x07, 0x63, 0x09, 0x84,
+0xD0, 0xF7, 0xA5, 0xC0, 0xB4, 0xF7, 0x71, 0x14, 0xC1, 0x1C, 0xE7, 0x9A, 0xCE, 0xBE, 0xC5, 0x92,
+0x94, 0x8A, 0x52, 0x38, 0xC6, 0xDB, 0xD6, 0x59, 0xC6, 0x8E, 0x73, 0x79, 0x45, 0xC1, 0x9E, 0xF7,
+0xFF, 0xFF, 0x06, 0x58, 0x45, 0x59, 0x69, 0xC0, 0x69, 0x4A, 0x69, 0x61, 0x68, 0x48, 0x65, 0x45,
+0x70, 0x71, 0x13, 0xC2, 0xB2, 0xF7, 0xF0, 0xFF, 0x2B, 0xA5, 0x4F, 0xC0, 0x4C, 0xAD, 0x42, 0xC1,
+0x4B, 0xA5, 0x8A, 0x94, 0x48, 0x40, 0xC0, 0xCE, 0xD6, 0x70, 0x48, 0x5D, 0xC1, 0x85, 0x31, 0x8E,
+0xCE, 0x48, 0x40, 0x5F, 0x4F, 0x67, 0x74, 0x5E, 0xC0, 0xFF, 0xFF, 0x09, 0xC5, 0xFB, 0xFE, 0x76,
+0xFD, 0x2D, 0x8B, 0xAE, 0xA3, 0xEB, 0x82, 0xF0, 0xB3, 0x6F, 0x62, 0x46, 0xC2, 0x4D, 0x93, 0xF3,
+0xE4, 0x6D, 0x9B, 0x53, 0xC4, 0xCF, 0xAB, 0xCB, 0x7A, 0xD3, 0xDC, 0x96, 0xFD, 0x7D, 0xFF, 0x71,
+0x05, 0xC1, 0x34, 0xA5, 0x51, 0x8C, 0x71, 0x00, 0xC1, 0x5D, 0xEF, 0xF3, 0xA4, 0x50, 0x60, 0x00,
+0x71, 0x58, 0xC0, 0xF3, 0x9C, 0x60, 0xC3, 0xB6, 0xB5, 0xB2, 0x94, 0xBA, 0xD6, 0x76, 0xB5, 0x50,
+0x00, 0xC0, 0xDB, 0xDE, 0x4C, 0xC0, 0x3C, 0xE7, 0x4C, 0x4D, 0x69, 0x55, 0x6D, 0x54, 0xC0, 0x1C,
+0xE7, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0xC0, 0xD3, 0xF7, 0x6A, 0xC3, 0x6A, 0x8C,
+0xF1, 0xFF, 0xEE, 0xDE, 0x8A, 0x8C, 0x63, 0x5F, 0x5D, 0xC0, 0xEB, 0x9C, 0x4F, 0xC1, 0xAA, 0x94,
+0x6D, 0xCE, 0x48, 0xC1, 0x8E, 0xD6, 0xCA, 0x9C, 0x40, 0xC0, 0x09, 0x84, 0x5D, 0xC3, 0x29, 0x8C,
+0x0E, 0xDF, 0xAF, 0xF7, 0xB4, 0xF7, 0x71, 0x14, 0xC1, 0x1C, 0xE7, 0x79, 0xCE, 0x4D, 0xC5, 0x38,
+0xC6, 0xEF, 0x7B, 0x34, 0xA5, 0x1C, 0xDF, 0x31, 0x84, 0xD3, 0x9C, 0x59, 0x45, 0x58, 0xC0, 0xFF,
+0xFF, 0x06, 0x58, 0x45, 0x4D, 0x79, 0xC0, 0x92, 0x94, 0x95, 0xC0, 0xDB, 0xD6, 0x65, 0xC0, 0xEF,
+0x7B, 0x55, 0x4D, 0x70, 0xC0, 0xFF, 0xFF, 0x13, 0xC0, 0xB2, 0xF7, 0x48, 0xC0, 0x0B, 0xA5, 0x92,
+0x66, 0xC0, 0xEB, 0x9C, 0x56, 0xC0, 0x8A, 0x94, 0x48, 0x40, 0xC0, 0xCE, 0xD6, 0x70, 0xC0, 0xF1,
+0xFF, 0x5D, 0xC0, 0xA7, 0x52, 0x56, 0x48, 0x00, 0x49, 0xC0, 0x8C, 0xB5, 0x48, 0xC0, 0x8F, 0xEF,
+0x5E, 0x71, 0x09, 0xC0, 0xFB, 0xFE, 0x4E, 0xC5, 0x0C, 0x83, 0xAA, 0x72, 0x92, 0xCC, 0xD3, 0xDC,
+0xEB, 0x82, 0xF0, 0xB3, 0x95, 0x70, 0xC0, 0x55, 0xF5, 0x62, 0x5B, 0xC0, 0xCB, 0x7A, 0x5B, 0xC0,
+0xB3, 0xDC, 0x53, 0xC0, 0x7D, 0xFF, 0x71, 0x05, 0xC0, 0x8E, 0x73, 0x60, 0x71, 0x01, 0x5C, 0x61,
+0xC0, 0xDF, 0xFF, 0x91, 0x71, 0x00, 0xC2, 0x5D, 0xEF, 0x59, 0xCE, 0x3C, 0xE7, 0x71, 0xC0, 0x7D,
+0xEF, 0x00, 0xC1, 0x1C, 0xE7, 0x9A, 0xD6, 0x61, 0xC0, 0xBE, 0xF7, 0x6C, 0x58, 0x5D, 0x00, 0x70,
+0xC0, 0xBA, 0xD6, 0x44, 0x6C, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0xC0, 0xD3, 0xF7,
+0x5F, 0x42, 0x7B, 0xC1, 0xCC, 0xBD, 0xEB, 0x9C, 0x91, 0x46, 0x7F, 0x51, 0xC0, 0xF1, 0xFF, 0x75,
+0xC2, 0x4D, 0xCE, 0xF0, 0xFF, 0x8E, 0xD6, 0x75, 0x7B, 0x63, 0x40, 0xC3, 0x29, 0x8C, 0x6D, 0xCE,
+0xCF, 0xF7, 0xB4, 0xF7, 0x71, 0x14, 0xC1, 0x1C, 0xE7, 0x79, 0xCE, 0x45, 0x61, 0x41, 0x91, 0xC1,
+0xD7, 0xB5, 0xAE, 0x73, 0x4D, 0xA6, 0x45, 0x58, 0x71, 0x06, 0x58, 0x45, 0x00, 0xC2, 0xDB, 0xD6,
+0xD7, 0xBD, 0xEF, 0x7B, 0x4D, 0x61, 0x41, 0xC0, 0x92, 0x94, 0x4D, 0x70, 0xC0, 0xFF, 0xFF, 0x13,
+0xC2, 0xB2, 0xF7, 0xF0, 0xFF, 0xEB, 0x9C, 0x77, 0x75, 0xC2, 0x4C, 0xAD, 0xCC, 0xB5, 0x09, 0x84,
+0x5A, 0x7B, 0xC1, 0x4D, 0xC6, 0x8A, 0x94, 0x48, 0xC0, 0x0D, 0xBE, 0x56, 0xC1, 0xE9, 0x7B, 0x8E,
+0xCE, 0x74, 0xC0, 0x29, 0x84, 0x40, 0x7B, 0x95, 0x57, 0xC0, 0xFF, 0xFF, 0x09, 0xC0, 0xFB, 0xFE,
+0x4E, 0xC5, 0x4D, 0x93, 0x14, 0xE5, 0xB6, 0xFD, 0x35, 0xF5, 0x08, 0x5A, 0x71, 0xCC, 0x5B, 0xC1,
+0xCB, 0x7A, 0x96, 0xFD, 0x5B, 0xC1, 0x10, 0xBC, 0x8E, 0xA3, 0x00, 0xC0, 0xB2, 0xD4, 0x53, 0xC1,
+0x7D, 0xFF, 0xFF, 0xFF, 0x04, 0xC2, 0x7D, 0xEF, 0xEB, 0x62, 0x9E, 0xF7, 0x71, 0x2A, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x21, 0xC1, 0xB3, 0xF7, 0xCF, 0xF7, 0x65, 0xC0, 0x48, 0x6B, 0x66, 0x5A, 0xC0,
+0x0D, 0xC6, 0x61, 0x66, 0xC3, 0xCE, 0xD6, 0xF1, 0xFF, 0xEB, 0x9C, 0x8E, 0xCE, 0x7B, 0x42, 0xC0,
+0x46, 0x4A, 0x53, 0xC3, 0xA9, 0x73, 0x28, 0x63, 0x09, 0x84, 0x90, 0xEF, 0xBD, 0x57, 0xC0, 0xFF,
+0xFF, 0x14, 0xC0, 0x1C, 0xE7, 0x4D, 0xC1, 0x75, 0xAD, 0x0C, 0x63, 0x64, 0xC3, 0x59, 0xC6, 0x10,
+0x84, 0x49, 0x4A, 0x8E, 0x73, 0x71, 0xC2, 0x9A, 0xCE, 0x9E, 0xF7, 0xFF, 0xFF, 0x06, 0x58, 0xC5,
+0x9A, 0xD6, 0x38, 0xC6, 0x4D, 0x6B, 0xCB, 0x5A, 0x55, 0xAD, 0xB6, 0xB5, 0x70, 0xA5, 0xC0, 0xF7,
+0xBD, 0x48, 0xC0, 0x1C, 0xE7, 0x71, 0x13, 0xC6, 0xB2, 0xF7, 0xF0, 0xFF, 0x0B, 0x9D, 0x8E, 0xCE,
+0xF1, 0xFF, 0x6C, 0xAD, 0x2D, 0xC6, 0x92, 0x61, 0x42, 0xC3, 0xEC, 0xBD, 0x07, 0x63, 0x68, 0x73,
+0x09, 0x84, 0x77, 0x7E, 0xC0, 0x6A, 0x8C, 0x00, 0xC0, 0x86, 0x52, 0x47, 0xC3, 0x4F, 0xE7, 0xAF,
+0xF7, 0xD5, 0xF7, 0xFF, 0xFF, 0x09, 0xC1, 0x1C, 0xFF, 0x75, 0xFD, 0x5B, 0xC1, 0xD3, 0xE4, 0x76,
+0xFD, 0x00, 0xC4, 0x8A, 0x6A, 0xD3, 0xDC, 0xCF, 0xAB, 0x2D, 0x8B, 0xB6, 0xFD, 0x5B, 0x6B, 0x58,
+0xC1, 0x8E, 0xA3, 0xB3, 0xDC, 0x4E, 0xC0, 0x7D, 0xFF, 0x71, 0x04, 0x4C, 0xC0, 0xCF, 0x7B, 0x71,
+0x2B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0xC1, 0xD8, 0xFF, 0x8F, 0xEF, 0x74, 0xC2, 0x8D, 0xCE,
+0x0E, 0xDF, 0xD0, 0xF7, 0x74, 0xC0, 0xAD, 0xD6, 0x46, 0x40, 0x74, 0x67, 0x6C, 0x00, 0x4B, 0x46,
+0x5F, 0x00, 0x46, 0x6C, 0x74, 0x6C, 0xC0, 0xDA, 0xFF, 0x71, 0x14, 0xC1, 0x1C, 0xE7, 0x79, 0xCE,
+0x00, 0xC3, 0x96, 0xB5, 0x18, 0xC6, 0xBA, 0xD6, 0x59, 0xCE, 0x81, 0x00, 0x45, 0x00, 0xC0, 0xBE,
+0xF7, 0x71, 0x06, 0xC0, 0x9E, 0xF7, 0x45, 0x00, 0xC0, 0xD7, 0xB5, 0x00, 0x4D, 0x79, 0x78, 0x60,
+0x4D, 0x79, 0xC0, 0x3C, 0xE7, 0x71, 0x13, 0xC1, 0xD8, 0xF7, 0x8E, 0xEF, 0x67, 0x6C, 0xBE, 0x67,
+0x6C, 0x40, 0xC0, 0xAE, 0xD6, 0x00, 0x74, 0xC0, 0x0E, 0xE7, 0x92, 0xC0, 0x2E, 0xE7, 0x67, 0x40,
+0x5F, 0x00, 0x46, 0x00, 0x6C, 0x74, 0xC0, 0xFB, 0xFF, 0x71, 0x09, 0xA1, 0xC2, 0xB6, 0xFD, 0x14,
+0xF5, 0x55, 0xF5, 0xBA, 0x00, 0x95, 0x42, 0x96, 0x00, 0x42, 0x7A, 0x42, 0x00, 0x7A, 0x73, 0xC0,
+0x18, 0xFE, 0x71, 0x05, 0xC1, 0x10, 0x84, 0x55, 0xAD, 0x71, 0x02, 0xC0, 0x9A, 0xD6, 0x00, 0x71,
+0xC2, 0x79, 0xCE, 0x3C, 0xE7, 0x9E, 0xF7, 0x95, 0xA6, 0x49, 0xC0, 0xDB, 0xDE, 0xAE, 0xC1, 0xDF,
+0xFF, 0x59, 0xCE, 0x49, 0x71, 0x19, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x22, 0x7B, 0xC0, 0xB2, 0xF7,
+0xAE, 0x00, 0xA5, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x49, 0x00, 0x42, 0x4E, 0x00, 0x49, 0x4E, 0x00,
+0x42, 0x49, 0xC0, 0xD9, 0xFF, 0x71, 0x15, 0x58, 0x45, 0x00, 0x4D, 0x00, 0x45, 0x00, 0x4D, 0x00,
+0x79, 0x5C, 0x71, 0x08, 0xC0, 0xDB, 0xD6, 0x79, 0x4D, 0x00, 0x45, 0x00, 0x4D, 0x00, 0x45, 0x00,
+0x58, 0x71, 0x14, 0xC0, 0xD7, 0xF7, 0x49, 0xA9, 0x00, 0x49, 0x00, 0x42, 0x4E, 0x00, 0x49, 0x4E,
+0x01, 0x49, 0x42, 0x49, 0x00, 0x4E, 0x00, 0x49, 0xC1, 0xD9, 0xFF, 0xFF, 0xFF, 0x0B, 0x4F, 0xC1,
+0x18, 0xFE, 0xB6, 0xFD, 0x01, 0xAB, 0x58, 0x5F, 0x00, 0x58, 0x5F, 0x58, 0x00, 0x5F, 0xC0, 0x59,
+0xFE, 0x60, 0x71, 0x04, 0x6C, 0xC1, 0x0C, 0x63, 0x3C, 0xE7, 0x71, 0x01, 0x44, 0xC0, 0x71, 0x94,
+0x64, 0x7D, 0x64, 0xA5, 0xC1, 0xF7, 0xC5, 0xF3, 0xA4, 0x81, 0xC1, 0xF3, 0x9C, 0x92, 0x94, 0x00,
+0x4C, 0xC0, 0xB3, 0x9C, 0x5D, 0x71, 0x19, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x0F, 0xC1, 0x9E,
+0xEF, 0xDB, 0xDE, 0x59, 0x04, 0xC0, 0x1C, 0xE7, 0x6C, 0x71, 0x08, 0x5D, 0x61, 0x4D, 0x59, 0x02,
+0x4D, 0x5C, 0xC0, 0x7D, 0xEF, 0x71, 0x3A, 0x6C, 0x08, 0x71, 0x07, 0x48, 0xC0, 0x4D, 0x6B, 0x71,
+0x02, 0x75, 0xC0, 0x96, 0xB5, 0x48, 0x68, 0x5C, 0x7D, 0x54, 0x40, 0xC0, 0x51, 0x8C, 0xBE, 0xC0,
+0xD3, 0x9C, 0x74, 0x91, 0x74, 0x6C, 0x71, 0x19, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x7C, 0x77,
+0x6D, 0x71, 0x02, 0x49, 0xC2, 0xEF, 0x7B, 0x14, 0xA5, 0x1C, 0xE7, 0x7C, 0x7D, 0xC0, 0x5D, 0xEF,
+0x64, 0x7D, 0x48, 0xC0, 0x75, 0xAD, 0x7D, 0xC0, 0xDB, 0xDE, 0x4D, 0x74, 0xC0, 0xFF, 0xFF, 0x19,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x7C, 0xC1, 0x4D, 0x6B, 0x7A, 0xD6, 0x71, 0x02, 0x49, 0xC0,
+0xF7, 0xBD, 0x71, 0x07, 0x6C, 0x71, 0x1C, 0x70, 0x00, 0x71, 0xE0, 0x7B, 0x75, 0xC0, 0x0C, 0x63,
+0x6C, 0x71, 0x2C, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x7B, 0x69, 0x40, 0x71, 0x2D, 0x70, 0x00,
+0x71, 0xE0, 0x7B, 0xC0, 0xCF, 0x7B, 0x4C, 0x71, 0x2D, 0x70, 0x00, 0x71, 0x2D, 0x5D, 0xC0, 0xF9,
+0xC6, 0x95, 0x95, 0x00, 0xA6, 0x9A, 0x67, 0xBF, 0x01, 0xBF, 0x01, 0xBB, 0x9A, 0x90, 0x80, 0x9A,
+0x00, 0xBE, 0x53, 0x50, 0x58, 0x53, 0x50, 0xBF, 0x76, 0x67, 0xC0, 0xF4, 0x95, 0x84, 0xC0, 0x12,
+0x86, 0xAE, 0xBF, 0xC0, 0x75, 0x96, 0x91, 0xA9, 0xB7, 0x67, 0x4A, 0x76, 0x96, 0x67, 0xA6, 0x00,
+0x53, 0xAB, 0x67, 0x03, 0x6E, 0x67, 0x03, 0x62, 0x67, 0x00, 0x58, 0x00, 0x67, 0x00, 0x76, 0x01,
+0x45, 0x01, 0x4A, 0xBA, 0x45, 0x76, 0x67, 0x5A, 0x53, 0x5F, 0x00, 0x67, 0x00, 0x5F, 0x67, 0x6E,
+0x67, 0x01, 0x53, 0x58, 0x67, 0x64, 0x00, 0x67, 0x64, 0x5F, 0x00, 0x50, 0x53, 0x5F, 0x00, 0x58,
+0xC1, 0xD8, 0xB6, 0x17, 0xA7, 0xBA, 0xB2, 0xC1, 0x95, 0x96, 0xD7, 0xAE, 0x7B, 0xBE, 0xC0, 0x39,
+0xCF, 0x43, 0x67, 0x53, 0x67, 0x4A, 0x76, 0x5A, 0x58, 0x01, 0x53, 0x58, 0x62, 0x00, 0x5F, 0x67,
+0x62, 0x5F, 0x62, 0xA9, 0x53, 0x67, 0xBB, 0x76, 0x45, 0x9A, 0x76, 0x00, 0x7B, 0xC0, 0x19, 0xBF,
+0x45, 0xC0, 0xCB, 0x5A, 0x49, 0xC0, 0xFF, 0xFF, 0x2D, 0x70, 0x00, 0x71, 0x2D, 0xC1, 0x5B, 0xDF,
+0x2C, 0x4D, 0x89, 0x91, 0xB5, 0xC0, 0xA9, 0x4C, 0x86, 0x9A, 0xAB, 0xBA, 0x02, 0x96, 0xBA, 0xC0,
+0x8A, 0x54, 0x85, 0xC1, 0x28, 0x2C, 0x68, 0x34, 0xA7, 0xAE, 0x45, 0x00, 0x40, 0x7B, 0xBD, 0x00,
+0x7B, 0x6C, 0xA9, 0xC0, 0x67, 0x2C, 0xAB, 0x00, 0xC0, 0x08, 0x2C, 0x99, 0x65, 0xBD, 0x96, 0x5D,
+0x65, 0x00, 0x6C, 0xA5, 0x6C, 0x60, 0x00, 0xC0, 0x28, 0x3C, 0x9E, 0x60, 0x65, 0xAE, 0x6C, 0xAE,
+0x65, 0x5D, 0xC1, 0x47, 0x34, 0x47, 0x44, 0x9A, 0x65, 0x5D, 0x60, 0x65, 0x00, 0x60, 0x5D, 0x65,
+0xC0, 0x48, 0x3C, 0x00, 0x65, 0x01, 0x74, 0x6C, 0xBA, 0x60, 0x00, 0xC0, 0x27, 0x3C, 0x00, 0x65,
+0x5D, 0x6A, 0x65, 0x01, 0x60, 0x5D, 0x74, 0xC0, 0x48, 0x44, 0x85, 0x8A, 0x60, 0x6C, 0x71, 0x02,
+0x74, 0xBD, 0x74, 0x6C, 0x00, 0x76, 0x45, 0xC0, 0x0B, 0x3D, 0xBF, 0x45, 0x00, 0xC0, 0x88, 0x44,
+0xAB, 0x9F, 0x00, 0x4C, 0x74, 0xAE, 0x45, 0x47, 0x40, 0x7C, 0x00, 0x79, 0x76, 0x79, 0x40, 0x01,
+0x7B, 0x00, 0x77, 0x7A, 0x6D, 0x6C, 0x7B, 0x74, 0x7B, 0x00, 0x40, 0x79, 0x4B, 0x53, 0x52, 0xC3,
+0x4A, 0x3D, 0xE8, 0x33, 0xE9, 0x4A, 0xFF, 0xF7, 0xBA, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D,
+0xC1, 0x3B, 0xD7, 0x2B, 0x45, 0x99, 0xC2, 0x2A, 0x65, 0x0A, 0x9D, 0xEA, 0xAC, 0x00, 0xC1, 0xA9,
+0x7C, 0x49, 0x3C, 0x9B, 0x4A, 0xA6, 0x7B, 0xC2, 0x68, 0x4C, 0xCA, 0x84, 0xAA, 0xA4, 0x00, 0xC1,
+0xAA, 0x8C, 0x28, 0x44, 0x8F, 0x00, 0x7E, 0x96, 0xBD, 0xC1, 0xC9, 0x74, 0xAA, 0x9C, 0xBA, 0x8E,
+0xC0, 0x67, 0x4C, 0x60, 0x6F, 0xA6, 0x92, 0xB9, 0xC2, 0x48, 0x64, 0x69, 0x8C, 0x69, 0x9C, 0x9E,
+0xC1, 0x27, 0x54, 0xC6, 0x23, 0xBB, 0x01, 0xAE, 0xC1, 0x68, 0x54, 0x69, 0x84, 0xB2, 0x9A, 0xC1,
+0x28, 0x5C, 0xE6, 0x2B, 0x02, 0x9A, 0xC5, 0x28, 0x4C, 0x48, 0x7C, 0x08, 0x8C, 0x4A, 0x9C, 0x69,
+0x74, 0xE6, 0x33, 0x4C, 0xBA, 0x00, 0x96, 0xC2, 0x07, 0x3C, 0x69, 0x7C, 0x29, 0x8C, 0xBE, 0xC1,
+0x89, 0x84, 0x06, 0x3C, 0x4C, 0x4F, 0x00, 0x47, 0xC2, 0x07, 0x34, 0x69, 0x6C, 0x49, 0x94, 0xA6,
+0x61, 0x74, 0x51, 0x54, 0x4F, 0x56, 0xAE, 0xC1, 0x88, 0x64, 0x69, 0x94, 0xA5, 0xC1, 0xA9, 0x94,
+0x68, 0x5C, 0x54, 0x56, 0x5B, 0x00, 0xC3, 0x27, 0x2C, 0x88, 0x5C, 0x89, 0x8C, 0x6A, 0x9C, 0xAE,
+0xC1, 0x89, 0x6C, 0x27, 0x34, 0x60, 0x5B, 0x5D, 0xAE, 0xC0, 0x48, 0x4C, 0x61, 0x69, 0x67, 0xC1,
+0x69, 0x7C, 0x07, 0x3C, 0x56, 0x62, 0x6A, 0x76, 0xC2, 0x48, 0x44, 0x89, 0x84, 0x69, 0xA4, 0xAF,
+0x72, 0x42, 0xC0, 0x48, 0x34, 0x6F, 0xAB, 0x00, 0xB9, 0xC1, 0x88, 0x7C, 0xA9, 0xA4, 0xBB, 0x8A,
+0x45, 0x6F, 0x00, 0x76, 0xA5, 0x6F, 0xC1, 0x88, 0x6C, 0xAA, 0xA4, 0xBE, 0x8E, 0xC3, 0x29, 0x65,
+0xE6, 0x2A, 0xAA, 0x43, 0xFE, 0xEF, 0x71, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC5, 0x3A,
+0xD7, 0x0A, 0x3D, 0x2A, 0x5D, 0x2B, 0xBD, 0xED, 0xC4, 0xD1, 0xD5, 0x00, 0xC0, 0x8D, 0xDD, 0x5B,
+0xC1, 0x88, 0x33, 0x09, 0x33, 0xA6, 0xC8, 0x88, 0x3B, 0xCB, 0x9C, 0xCC, 0xBC, 0x6F, 0xCD, 0xB1,
+0xCD, 0x4E, 0xD5, 0xAA, 0x94, 0x87, 0x33, 0xE8, 0x2A, 0xA6, 0xC2, 0x47, 0x2B, 0xA9, 0x84, 0xCB,
+0xBC, 0x4B, 0x6B, 0xC4, 0x2E, 0xCD, 0xEA, 0xA4, 0xA6, 0x3B, 0x07, 0x23, 0xA7, 0x22, 0xA9, 0xC8,
+0x28, 0x64, 0xCB, 0xB4, 0x4F, 0xC5, 0xB0, 0xCD, 0x0E, 0xC5, 0xCB, 0xAC, 0xC6, 0x4B, 0xA5, 0x1A,
+0x45, 0x1A, 0xAE, 0xC2, 0xC7, 0x4B, 0x8A, 0xA4, 0xEE, 0xC4, 0x63, 0xC3, 0xEE, 0xBC, 0x2B, 0x9C,
+0x08, 0x64, 0xE5, 0x1A, 0x46, 0xA9, 0xC0, 0x46, 0x33, 0x78, 0xC5, 0xED, 0xBC, 0xB2, 0xCD, 0x0F,
+0xC5, 0x6B, 0xBC, 0x28, 0x7C, 0x05, 0x23, 0x46, 0x00, 0xC3, 0x05, 0x2B, 0x8A, 0x8C, 0xCD, 0xBC,
+0x91, 0xCD, 0x43, 0xC3, 0x6B, 0xB4, 0x49, 0x94, 0x45, 0x2B, 0x64, 0x1A, 0xA2, 0xC1, 0xC5, 0x1A,
+0x49, 0x74, 0x57, 0xC0, 0x50, 0xC5, 0xA6, 0xC0, 0x6C, 0xB4, 0x88, 0xC0, 0xA6, 0x43, 0x44, 0x46,
+0xC3, 0x85, 0x1A, 0x28, 0x5C, 0x2C, 0xBD, 0x70, 0xCD, 0x4A, 0x41, 0xC1, 0xAA, 0xB4, 0x07, 0x54,
+0x55, 0x4B, 0x50, 0x62, 0xC1, 0xEC, 0xB4, 0xB0, 0xD5, 0x9F, 0x57, 0xA1, 0xC2, 0x48, 0x74, 0xE5,
+0x1A, 0x86, 0x22, 0x00, 0xC2, 0x67, 0x3B, 0xCB, 0xA4, 0x6F, 0xD5, 0x5C, 0xC3, 0x2D, 0xC5, 0xAB,
+0xBC, 0x69, 0x84, 0xE5, 0x22, 0x5A, 0xBF, 0xC2, 0x67, 0x33, 0xCA, 0x94, 0xD1, 0xE5, 0x9F, 0xC4,
+0x2E, 0xCD, 0xAB, 0xC4, 0x69, 0x9C, 0x66, 0x33, 0xC7, 0x2A, 0x69, 0xC0, 0x27, 0x2B, 0x5E, 0xC6,
+0xD0, 0xDD, 0x32, 0xDE, 0x8F, 0xD5, 0xCB, 0xCC, 0xCA, 0xA4, 0xA7, 0x43, 0xE6, 0x22, 0xB2, 0xC3,
+0x07, 0x2B, 0x27, 0x6C, 0xD0, 0xD5, 0x54, 0xE6, 0x67, 0xC0, 0xEC, 0xCC, 0x8A, 0xC3, 0x25, 0x3A,
+0xAB, 0x44, 0xDD, 0xEF, 0xFF, 0xFF, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC5, 0x1A, 0xCF,
+0xCA, 0x3C, 0x6B, 0x95, 0xAE, 0xD5, 0xD6, 0xEE, 0xDF, 0xFF, 0x71, 0xC3, 0x38, 0xF7, 0x4B, 0xC5,
+0x47, 0x3B, 0x68, 0x32, 0x9A, 0xC3, 0x09, 0x6C, 0x6D, 0xCD, 0x94, 0xE6, 0xDE, 0xFF, 0x71, 0xC8,
+0x3A, 0xF7, 0xAE, 0xDD, 0x87, 0x4B, 0x87, 0x2A, 0x27, 0x22, 0x47, 0x43, 0x4C, 0xBD, 0x11, 0xE6,
+0x9C, 0xFF, 0x71, 0xC5, 0x7B, 0xF7, 0xD0, 0xD5, 0x07, 0x6C, 0xA7, 0x22, 0x06, 0x22, 0x86, 0x2A,
+0x47, 0xC1, 0x31, 0xDE, 0x9B, 0xF7, 0x71, 0xC8, 0x9C, 0xF7, 0xF2, 0xDD, 0x49, 0x8C, 0x45, 0x1A,
+0xA4, 0x19, 0x25, 0x1A, 0x4A, 0x84, 0xAF, 0xD5, 0x5A, 0xF7, 0x71, 0x65, 0xC3, 0x34, 0xE6, 0xAB,
+0xA4, 0xA5, 0x2A, 0xA4, 0x11, 0xAE, 0xC1, 0xA7, 0x63, 0xCF, 0xD5, 0x72, 0x71, 0x65, 0xC2, 0x55,
+0xE6, 0xAC, 0xB4, 0x06, 0x3B, 0x68, 0xA5, 0xC2, 0x26, 0x4B, 0x4E, 0xC5, 0x39, 0xF7, 0x71, 0x00,
+0xC7, 0xB7, 0xE6, 0xEC, 0xC4, 0x67, 0x5B, 0xE4, 0x11, 0x84, 0x11, 0xC6, 0x32, 0xEC, 0xAC, 0xF7,
+0xEE, 0x71, 0x00, 0xC3, 0xD8, 0xE6, 0xED, 0xBC, 0x08, 0x74, 0x04, 0x12, 0x5E, 0xC3, 0x65, 0x22,
+0xCA, 0x9C, 0xF5, 0xEE, 0xFE, 0xFF, 0x71, 0xC4, 0xF8, 0xEE, 0x6D, 0xD5, 0x8A, 0x94, 0x84, 0x1A,
+0xC4, 0x19, 0x41, 0xC1, 0x29, 0x84, 0x95, 0xEE, 0x6A, 0x71, 0xC4, 0x39, 0xEF, 0x4E, 0xCD, 0xCB,
+0xAC, 0xC5, 0x32, 0xE5, 0x19, 0xAE, 0xC2, 0xA8, 0x63, 0x33, 0xDE, 0xDD, 0xFF, 0x71, 0xC0, 0x7B,
+0xF7, 0x53, 0xC5, 0x0D, 0xBD, 0x27, 0x43, 0xC5, 0x19, 0x06, 0x22, 0x67, 0x4B, 0x11, 0xD6, 0x6A,
+0x71, 0xC2, 0x7C, 0xF7, 0xD0, 0xDD, 0x0C, 0xD5, 0x6D, 0xC0, 0x26, 0x22, 0xA2, 0xC1, 0xE6, 0x3A,
+0x8E, 0xCD, 0x5E, 0x71, 0x5E, 0xC3, 0x31, 0xDE, 0x2C, 0xD5, 0x49, 0x7C, 0x45, 0x1A, 0x77, 0xC2,
+0x85, 0x2A, 0x0C, 0xAD, 0xDC, 0xFF, 0x71, 0x65, 0xC4, 0x93, 0xEE, 0x8B, 0xBC, 0x25, 0x3A, 0x0B,
+0x4D, 0x9D, 0xE7, 0x71, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC4, 0xFA, 0xCE, 0xAA, 0x3C,
+0x6C, 0xA5, 0xF0, 0xE5, 0xBD, 0xFF, 0x71, 0x00, 0x5E, 0xC2, 0x8D, 0xD5, 0x68, 0x4B, 0x88, 0x2A,
+0xA1, 0xC0, 0x2A, 0x7C, 0x5D, 0xC0, 0x9C, 0xFF, 0x71, 0x01, 0xC6, 0x71, 0xEE, 0xA7, 0x63, 0x87,
+0x22, 0x27, 0x22, 0x68, 0x53, 0x4D, 0xCD, 0x39, 0xF7, 0x71, 0x01, 0xC6, 0x53, 0xE6, 0x49, 0x84,
+0xA7, 0x22, 0xE6, 0x19, 0xA6, 0x32, 0xEB, 0xB4, 0xF6, 0xEE, 0x71, 0x01, 0xC1, 0xD7, 0xEE, 0xAA,
+0xA4, 0x4E, 0xC3, 0xA4, 0x11, 0x25, 0x1A, 0xAA, 0x9C, 0x74, 0xE6, 0x71, 0x01, 0x43, 0xC1, 0x2C,
+0xBD, 0xE5, 0x3A, 0x63, 0xAE, 0xC1, 0xE8, 0x7B, 0x13, 0xE6, 0x71, 0x01, 0xC2, 0x9C, 0xFF, 0x2E,
+0xCD, 0x27, 0x4B, 0x63, 0xA5, 0xC2, 0x67, 0x5B, 0xB0, 0xD5, 0xFE, 0xFF, 0x71, 0x00, 0x6A, 0xC2,
+0x90, 0xCD, 0xE8, 0x73, 0xC3, 0x11, 0xA2, 0xC2, 0xC6, 0x3A, 0x0D, 0xBD, 0xBD, 0xFF, 0x71, 0x00,
+0x6A, 0xC3, 0x11, 0xDE, 0x6A, 0x8C, 0x04, 0x1A, 0x84, 0x11, 0x4E, 0xC1, 0x0B, 0xB5, 0x79, 0xF7,
+0x71, 0x01, 0xC2, 0x73, 0xE6, 0xEC, 0xAC, 0x85, 0x22, 0x5C, 0x41, 0xC1, 0x8A, 0x94, 0x18, 0xF7,
+0x71, 0x01, 0xC2, 0xB5, 0xEE, 0x2D, 0xC5, 0x26, 0x3B, 0x63, 0x77, 0xC0, 0xC9, 0x73, 0x73, 0x71,
+0x6C, 0x71, 0xC2, 0xF7, 0xEE, 0x8F, 0xD5, 0xA9, 0x53, 0x63, 0xAE, 0xC1, 0x67, 0x53, 0x31, 0xDE,
+0x71, 0x01, 0xC3, 0x37, 0xF7, 0x8E, 0xDD, 0x4B, 0x7C, 0x05, 0x1A, 0xA2, 0xC0, 0xE6, 0x42, 0x51,
+0x6A, 0x71, 0x00, 0xC5, 0x7A, 0xF7, 0xEF, 0xE5, 0xCA, 0x94, 0x04, 0x1A, 0xA4, 0x19, 0x86, 0x2A,
+0x70, 0xC0, 0xDD, 0xFF, 0x71, 0x00, 0xC4, 0xBC, 0xFF, 0xEB, 0x9B, 0x28, 0x53, 0x2B, 0x55, 0x9D,
+0xE7, 0x71, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC4, 0x5B, 0xDF, 0xAB, 0x3C, 0x2B, 0x8D,
+0xCF, 0xE5, 0x5B, 0xF7, 0x71, 0x00, 0xC3, 0x57, 0xFF, 0xCA, 0xB4, 0xE7, 0x32, 0x68, 0x2A, 0x91,
+0xC2, 0x89, 0x5B, 0x8E, 0xD5, 0x19, 0xF7, 0x71, 0x00, 0xC0, 0x79, 0xFF, 0x4C, 0xC1, 0x07, 0x43,
+0x67, 0x2A, 0x52, 0xC2, 0xE7, 0x3A, 0xEC, 0xBC, 0x96, 0xEE, 0x71, 0x00, 0xC3, 0x9B, 0xFF, 0xCF,
+0xDD, 0x88, 0x63, 0x87, 0x22, 0x7E, 0xC1, 0x45, 0x22, 0x8B, 0x9C, 0x55, 0xC0, 0xDE, 0xFF, 0x71,
+0x59, 0xC3, 0x12, 0xDE, 0xA9, 0x7B, 0x04, 0x1A, 0xA4, 0x19, 0x9E, 0xC1, 0xC9, 0x73, 0xD1, 0xDD,
+0x59, 0x71, 0x65, 0xC3, 0xB5, 0xEE, 0x6A, 0x9C, 0x64, 0x22, 0xA4, 0x11, 0x00, 0xC2, 0x47, 0x53,
+0x4F, 0xCD, 0x5B, 0xF7, 0x71, 0x00, 0xC1, 0xB6, 0xEE, 0x0C, 0xB5, 0x6D, 0x63, 0xA6, 0xC2, 0xA6,
+0x3A, 0xCC, 0xB4, 0xF8, 0xF6, 0x71, 0x00, 0xC1, 0x19, 0xF7, 0x0D, 0xC5, 0x51, 0xC0, 0xA3, 0x11,
+0xA6, 0xC3, 0x44, 0x22, 0x6A, 0xA4, 0xB7, 0xEE, 0xFF, 0xFF, 0x00, 0xC3, 0x7C, 0xFF, 0x6F, 0xCD,
+0xE9, 0x73, 0xC4, 0x11, 0x5E, 0xC2, 0xE4, 0x19, 0x09, 0x84, 0xD2, 0xD5, 0x65, 0x71, 0xA4, 0xC2,
+0xF0, 0xDD, 0xAB, 0x94, 0x24, 0x1A, 0x63, 0x68, 0xC1, 0x88, 0x6B, 0xF2, 0xE5, 0x65, 0x71, 0x6A,
+0xC2, 0x13, 0xE6, 0xED, 0xAC, 0x85, 0x2A, 0x63, 0xC1, 0xE5, 0x19, 0x07, 0x4B, 0x4B, 0xC0, 0x9C,
+0xFF, 0x71, 0x65, 0xC2, 0x54, 0xE6, 0x6E, 0xCD, 0x07, 0x43, 0x63, 0x00, 0xC0, 0xA5, 0x32, 0x54,
+0x61, 0x71, 0x00, 0xC0, 0x95, 0xEE, 0x4C, 0xC0, 0xCA, 0x63, 0x68, 0xBB, 0xC2, 0x65, 0x2A, 0x8A,
+0xA4, 0x17, 0xF7, 0x71, 0x00, 0xC3, 0xF7, 0xF6, 0xAE, 0xE5, 0x4A, 0x7C, 0xE4, 0x11, 0x66, 0xC3,
+0x25, 0x22, 0x09, 0x94, 0x95, 0xF6, 0xFF, 0xFF, 0x00, 0xC4, 0x39, 0xF7, 0xA7, 0x6A, 0x4B, 0x74,
+0xEB, 0x4C, 0xBD, 0xEF, 0x71, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC5, 0x9D, 0xEF, 0xCB,
+0x44, 0x69, 0x44, 0x4C, 0xB5, 0xF0, 0xED, 0xD5, 0xFE, 0xA5, 0xC3, 0x6C, 0xCD, 0xC6, 0x4A, 0x05,
+0x32, 0xA5, 0x39, 0x96, 0xC3, 0x26, 0x32, 0x6B, 0x8C, 0xF0, 0xE5, 0x94, 0xFE, 0x9A, 0xC2, 0xCF,
+0xE5, 0x68, 0x6B, 0x46, 0x22, 0xB7, 0x95, 0x99, 0xC2, 0x89, 0x6B, 0x4E, 0xCD, 0x53, 0xEE, 0x6E,
+0x6C, 0xC1, 0xC9, 0x7B, 0x45, 0x22, 0xA7, 0x77, 0x95, 0xC7, 0x07, 0x4B, 0xCD, 0xB4, 0xF2, 0xDD,
+0x96, 0xEE, 0xF1, 0xDD, 0x4B, 0x9C, 0x25, 0x2A, 0xC5, 0x19, 0xA6, 0x99, 0xC0, 0x65, 0x32, 0x70,
+0xC4, 0xB1, 0xD5, 0x75, 0xE6, 0xF3, 0xDD, 0x8C, 0xAC, 0x85, 0x3A, 0x68, 0xB6, 0x63, 0xC3, 0x24,
+0x22, 0xE9, 0x83, 0x2F, 0xCD, 0x34, 0xE6, 0x95, 0x47, 0xC1, 0x07, 0x53, 0xE4, 0x19, 0x66, 0x63,
+0x68, 0xC2, 0x47, 0x63, 0xCD, 0xBC, 0x13, 0xE6, 0x55, 0x5E, 0xC0, 0x48, 0x63, 0x70, 0xA6, 0x66,
+0x63, 0xC6, 0xE6, 0x4A, 0xAC, 0xB4, 0xF3, 0xDD, 0x34, 0xDE, 0x0F, 0xC5, 0x89, 0x7B, 0x45, 0x22,
+0x63, 0xB6, 0xC8, 0xC3, 0x11, 0x65, 0x2A, 0x8B, 0x83, 0x92, 0xD5, 0x75, 0xE6, 0x90, 0xD5, 0x2A,
+0x9C, 0xC5, 0x3A, 0xC4, 0x11, 0xB6, 0x63, 0xC2, 0x25, 0x22, 0x0A, 0x94, 0xB1, 0xDD, 0x6E, 0x7A,
+0xC1, 0x6C, 0xAC, 0xE7, 0x4A, 0x68, 0xB2, 0x66, 0xC6, 0x25, 0x1A, 0xA9, 0x7B, 0x6F, 0xD5, 0x75,
+0xEE, 0xF3, 0xE5, 0xCD, 0xC4, 0x68, 0x6B, 0x7C, 0xC0, 0xA4, 0x19, 0x96, 0xC3, 0xE4, 0x11, 0x07,
+0x5B, 0xCD, 0xBC, 0x13, 0xE6, 0x44, 0xC2, 0xCD, 0xCC, 0xEA, 0x8B, 0x45, 0x22, 0x66, 0xAB, 0x68,
+0xC2, 0xE6, 0x4A, 0xCC, 0xBC, 0x33, 0xEE, 0xAF, 0xC2, 0x6E, 0xDD, 0x4A, 0x9C, 0x86, 0x32, 0x6D,
+0xA5, 0x77, 0xC2, 0xA6, 0x3A, 0x8A, 0xB4, 0xD1, 0xE5, 0x5D, 0xC4, 0x0E, 0xCD, 0xE5, 0x41, 0xE8,
+0x43, 0xCC, 0x4C, 0xDE, 0xF7, 0xBF, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC1, 0x1A, 0xD7,
+0x89, 0x3C, 0x92, 0xC7, 0xC8, 0x3B, 0x29, 0x7C, 0xAA, 0xA4, 0x29, 0x8C, 0xE6, 0x3A, 0xE4, 0x31,
+0x64, 0x41, 0xA6, 0x51, 0x95, 0x86, 0xC1, 0x46, 0x32, 0x89, 0x63, 0x69, 0x81, 0x78, 0x4B, 0xAB,
+0xA5, 0x00, 0x77, 0x00, 0x7F, 0xC0, 0xE9, 0x7B, 0xBF, 0xC1, 0x27, 0x5B, 0x04, 0x1A, 0xAB, 0xB6,
+0x95, 0x66, 0x9E, 0xC6, 0x85, 0x3A, 0x88, 0x73, 0xCA, 0x83, 0x69, 0x6B, 0x25, 0x2A, 0x87, 0x22,
+0xE8, 0x2A, 0xA1, 0x61, 0x7C, 0xC5, 0x05, 0x2A, 0x27, 0x63, 0xA8, 0x7B, 0x48, 0x6B, 0x24, 0x32,
+0x83, 0x11, 0xAF, 0xBB, 0x66, 0x63, 0xC2, 0xE4, 0x19, 0xC6, 0x52, 0x68, 0x7B, 0x82, 0xC0, 0x45,
+0x32, 0x63, 0x66, 0xA6, 0x66, 0x96, 0x6B, 0xC1, 0x66, 0x42, 0x48, 0x73, 0xA9, 0xC0, 0x86, 0x42,
+0x6B, 0x63, 0xBA, 0x01, 0x99, 0x43, 0xC0, 0x28, 0x6B, 0x64, 0xC0, 0x85, 0x4A, 0x70, 0x68, 0x66,
+0xA6, 0x5E, 0x68, 0xC4, 0x05, 0x22, 0xE8, 0x5A, 0x69, 0x73, 0xE7, 0x5A, 0x25, 0x22, 0x81, 0x6B,
+0x66, 0x00, 0x68, 0x47, 0xC3, 0x07, 0x63, 0xA9, 0x83, 0x47, 0x6B, 0x65, 0x32, 0x68, 0x6B, 0x66,
+0x77, 0x46, 0x44, 0xC0, 0x07, 0x53, 0x40, 0x81, 0xC0, 0xA6, 0x4A, 0x50, 0x46, 0xC0, 0xA5, 0x19,
+0x66, 0x57, 0x63, 0xC0, 0xA7, 0x4A, 0x6C, 0xAB, 0xC0, 0xC7, 0x52, 0x46, 0x4B, 0xC0, 0xC5, 0x19,
+0x61, 0x66, 0x6B, 0xC0, 0x66, 0x3A, 0x5D, 0xC0, 0x88, 0x83, 0x4D, 0xC0, 0x45, 0x2A, 0x72, 0x6D,
+0x66, 0x6D, 0xC4, 0x06, 0x1A, 0x66, 0x32, 0xA8, 0x73, 0x8A, 0xA4, 0x07, 0x6B, 0x7F, 0xC2, 0x07,
+0x2C, 0x49, 0x3C, 0x3A, 0xD7, 0x71, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC1, 0xD1, 0x95,
+0x89, 0x34, 0xBB, 0xC1, 0x68, 0x2B, 0x67, 0x22, 0xAE, 0x00, 0xB1, 0xC5, 0x64, 0x41, 0x09, 0x83,
+0x2D, 0xC5, 0x6B, 0xAC, 0xC6, 0x59, 0x85, 0x39, 0x43, 0xC0, 0x46, 0x22, 0x43, 0xBF, 0xC0, 0x88,
+0x2A, 0x5F, 0x6B, 0x01, 0xA9, 0x5C, 0x99, 0xBA, 0x50, 0xAB, 0x00, 0xBA, 0x4B, 0x01, 0x41, 0xAE,
+0x55, 0x50, 0xC2, 0xC8, 0x2A, 0x28, 0x2B, 0xC6, 0x22, 0xAF, 0xA1, 0xC0, 0x07, 0x2B, 0x5F, 0xA6,
+0x00, 0xC1, 0xC7, 0x22, 0x2A, 0x33, 0xBA, 0x75, 0x61, 0x00, 0x5A, 0x00, 0xAF, 0x6B, 0xC0, 0x4A,
+0x3B, 0x75, 0xA9, 0xA6, 0x6E, 0x69, 0x66, 0x5F, 0xC0, 0xC8, 0x22, 0x5F, 0xC0, 0x09, 0x33, 0x7A,
+0x66, 0x00, 0x5F, 0x6B, 0x66, 0xC2, 0xE9, 0x32, 0x89, 0x32, 0x84, 0x11, 0x00, 0xC1, 0x27, 0x22,
+0xC6, 0x19, 0xA4, 0x00, 0x6D, 0x66, 0x5E, 0x57, 0x00, 0x63, 0x00, 0xC0, 0xE6, 0x19, 0x77, 0xA6,
+0x00, 0xA9, 0xC1, 0x68, 0x2A, 0xA9, 0x32, 0x72, 0x7E, 0x7A, 0xC1, 0x06, 0x22, 0xA4, 0x19, 0x6D,
+0x00, 0x77, 0xC0, 0x68, 0x2A, 0x7A, 0x43, 0x66, 0xC0, 0x2C, 0x43, 0x95, 0xC0, 0x68, 0x32, 0x90,
+0x92, 0x6D, 0xC2, 0xAA, 0x3A, 0x6D, 0x4B, 0xEA, 0x32, 0xAE, 0x57, 0xA9, 0x7A, 0x66, 0x46, 0x6D,
+0xA9, 0x6D, 0x00, 0x63, 0x6B, 0x72, 0x01, 0x6D, 0x72, 0xC1, 0xC8, 0x5A, 0x49, 0x7B, 0x9A, 0xC6,
+0x09, 0x84, 0x48, 0x6B, 0x64, 0x29, 0x86, 0x52, 0x69, 0x84, 0x88, 0x5C, 0x34, 0xA6, 0x71, 0x2D,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0xA6, 0xC1, 0x8F, 0x75, 0xCA, 0x3C, 0xA2, 0xC1, 0x68, 0x33,
+0x48, 0x2A, 0xA6, 0x00, 0xB0, 0xC2, 0x65, 0x41, 0x0D, 0xBD, 0x0F, 0xE6, 0x00, 0xC2, 0x08, 0x83,
+0x65, 0x39, 0x47, 0x2A, 0xA6, 0xC1, 0x68, 0x2A, 0x29, 0x33, 0x90, 0xA2, 0xAE, 0xAF, 0x73, 0x00,
+0x69, 0x5F, 0x00, 0x69, 0x96, 0xAE, 0x5F, 0x00, 0x61, 0x5F, 0x6E, 0xC0, 0x08, 0x2B, 0x73, 0xC0,
+0x86, 0x22, 0xA5, 0xA6, 0x69, 0xC9, 0x67, 0x2B, 0x24, 0x1A, 0xC4, 0x19, 0x25, 0x1A, 0x88, 0x2A,
+0x34, 0x85, 0x8D, 0x4B, 0x35, 0x8D, 0x9B, 0xBE, 0x2F, 0x64, 0x7C, 0xC0, 0x45, 0x1A, 0xBF, 0xC1,
+0x54, 0x85, 0x50, 0x64, 0xA7, 0xC0, 0x3A, 0xAE, 0x4E, 0x55, 0xA9, 0x01, 0x46, 0x7E, 0xC3, 0xB6,
+0x95, 0xAD, 0x4B, 0x79, 0xA6, 0x95, 0x8D, 0x73, 0x9A, 0x64, 0x5F, 0xC1, 0x49, 0x33, 0x39, 0xA6,
+0xA6, 0x44, 0xC3, 0x2D, 0x4B, 0x1A, 0xAE, 0xB4, 0x84, 0xA5, 0x19, 0x50, 0x69, 0x7C, 0xC5, 0xA9,
+0x32, 0xF9, 0xA5, 0x98, 0x9D, 0x27, 0x2A, 0xAD, 0x5B, 0x55, 0x8D, 0x70, 0x6E, 0x9A, 0xC1, 0x6B,
+0x43, 0xF9, 0xAD, 0x91, 0xC4, 0x4C, 0x43, 0x71, 0x6C, 0x7B, 0xBE, 0x72, 0x7C, 0x84, 0x11, 0x77,
+0xBF, 0xC7, 0x67, 0x2A, 0x35, 0x7D, 0xF8, 0x9D, 0x4D, 0x4B, 0x69, 0x2A, 0xB8, 0x9D, 0x3A, 0xB6,
+0xCA, 0x3A, 0x80, 0xC0, 0xC8, 0x2A, 0x46, 0xC0, 0xAF, 0x5B, 0x41, 0xC4, 0xEE, 0x53, 0x12, 0x75,
+0x6E, 0x53, 0xEB, 0x3A, 0x14, 0x85, 0x53, 0x69, 0xC0, 0xC5, 0x19, 0xA6, 0x02, 0xA9, 0x00, 0xA6,
+0x66, 0x6D, 0xAD, 0xC1, 0x6B, 0xA4, 0x8E, 0xE5, 0x92, 0xC7, 0xAE, 0xE5, 0x09, 0x7B, 0x83, 0x10,
+0xE6, 0x49, 0x2D, 0xDD, 0x0A, 0x8D, 0xB1, 0x7D, 0xFF, 0xFF, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x2C, 0xA6, 0xC1, 0xAF, 0x6D, 0xEA, 0x3C, 0x4F, 0xC0, 0x89, 0x33, 0x5F, 0xA9, 0x5F, 0xA1, 0xC0,
+0x65, 0x39, 0x67, 0xC0, 0x2D, 0xCD, 0x7B, 0xC2, 0xE5, 0x59, 0xC5, 0x39, 0x47, 0x2A, 0xBB, 0xC1,
+0x29, 0x33, 0x66, 0x22, 0x72, 0x46, 0x5A, 0xC0, 0x88, 0x32, 0x69, 0xC0, 0xE8, 0x2A, 0x6B, 0x63,
+0x72, 0xBF, 0x77, 0xC0, 0x26, 0x22, 0x00, 0x66, 0x63, 0x66, 0xC1, 0x67, 0x22, 0x28, 0x33, 0x9E,
+0xC1, 0xC7, 0x22, 0x45, 0x22, 0x72, 0xC2, 0xC6, 0x22, 0x06, 0x23, 0xE4, 0x19, 0x66, 0x92, 0xC7,
+0x49, 0x32, 0x5B, 0xBE, 0xAA, 0x42, 0x65, 0x11, 0xF5, 0x8C, 0x2C, 0x4B, 0x84, 0x11, 0xA7, 0x22,
+0xBE, 0xC3, 0xB7, 0xA5, 0xB2, 0x7C, 0xD4, 0x84, 0xD8, 0x9D, 0xA9, 0x75, 0x9D, 0x00, 0xA6, 0xA1,
+0xCC, 0x70, 0x6C, 0x19, 0xAE, 0x76, 0x8D, 0x72, 0x6C, 0x15, 0x85, 0x6B, 0x43, 0xA6, 0x1A, 0xE6,
+0x22, 0x88, 0x2B, 0x0C, 0x44, 0x0E, 0x5C, 0x33, 0x7D, 0x11, 0x6C, 0x49, 0xCB, 0x8F, 0x5B, 0x16,
+0x8D, 0xAA, 0x3A, 0x07, 0x2B, 0xA8, 0x33, 0xA6, 0x22, 0x0D, 0x4C, 0x50, 0x64, 0xF5, 0x84, 0xAF,
+0x5B, 0x91, 0x7C, 0xF8, 0xAD, 0x77, 0xA5, 0x9A, 0xC0, 0xCC, 0x4B, 0x7E, 0xC2, 0x15, 0x8D, 0xD2,
+0x74, 0x4F, 0x64, 0x9A, 0xC0, 0xD8, 0xA5, 0x41, 0x5A, 0xC3, 0x28, 0x2B, 0x2A, 0x3B, 0xD0, 0x64,
+0x72, 0x75, 0x4E, 0xC0, 0x84, 0x11, 0x66, 0xC7, 0x19, 0xA6, 0x66, 0x22, 0x49, 0x33, 0xEA, 0x3B,
+0xA7, 0x2A, 0xA6, 0x19, 0xF9, 0xAD, 0xCE, 0x53, 0xAD, 0xC3, 0x93, 0x7C, 0x11, 0x6C, 0x33, 0x85,
+0xC8, 0x2B, 0x5F, 0x6D, 0x00, 0x72, 0x6D, 0x00, 0x72, 0x95, 0x5E, 0xBE, 0x61, 0x6B, 0xC1, 0x4B,
+0x9C, 0x6E, 0xDD, 0x92, 0xC7, 0x8E, 0xDD, 0x49, 0x83, 0xC3, 0x18, 0x4B, 0xAC, 0x6E, 0xE5, 0xCA,
+0x8C, 0xD1, 0x75, 0xFF, 0xFF, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x15, 0x91, 0xC0, 0x14, 0xA5,
+0x00, 0x5D, 0x71, 0x03, 0x5D, 0xC0, 0xFB, 0xDE, 0x71, 0xC2, 0xD7, 0xBD, 0xB2, 0x94, 0x1C, 0xE7,
+0x71, 0xC0, 0x18, 0xC6, 0x50, 0xC2, 0x5D, 0xEF, 0x92, 0x94, 0x3C, 0xE7, 0x71, 0x01, 0xC5, 0xCF,
+0x6D, 0xEA, 0x3C, 0x8A, 0x3C, 0x28, 0x4C, 0x08, 0x74, 0x09, 0x8C, 0x9A, 0xC3, 0x07, 0x4B, 0x05,
+0x2A, 0x85, 0x41, 0xC5, 0x51, 0x92, 0x8A, 0xC2, 0x27, 0x32, 0x68, 0x2A, 0x29, 0x33, 0x55, 0xC1,
+0xC6, 0x19, 0x07, 0x22, 0x00, 0xAE, 0xC2, 0xA8, 0x2A, 0x2A, 0x34, 0xC9, 0x2B, 0x63, 0x00, 0xC0,
+0xE6, 0x19, 0x00, 0xC1, 0x26, 0x22, 0x08, 0x2B, 0xAE, 0xC4, 0x05, 0x1A, 0x63, 0x11, 0xA4, 0x19,
+0x26, 0x1A, 0x68, 0x2B, 0xAE, 0xC0, 0xA5, 0x1A, 0xBF, 0x00, 0xC0, 0xA3, 0x11, 0xA7, 0x03, 0xC5,
+0x36, 0x95, 0xAA, 0x3A, 0x28, 0x2A, 0x97, 0x9D, 0x27, 0x2A, 0xE7, 0x2A, 0x5A, 0xC2, 0x43, 0x09,
+0xF0, 0x63, 0x52, 0x74, 0x00, 0xC2, 0x7A, 0xC6, 0x56, 0x95, 0x87, 0x22, 0x5A, 0x00, 0xA6, 0x91,
+0xC0, 0x68, 0x32, 0x5D, 0xC3, 0x72, 0x6C, 0x57, 0x95, 0x5A, 0xBE, 0x4D, 0x4B, 0x5F, 0x4E, 0x64,
+0xCB, 0x26, 0x23, 0xA7, 0x22, 0xD8, 0xA5, 0x0C, 0x4B, 0x77, 0x9D, 0x8A, 0x3A, 0xB4, 0x7C, 0xAE,
+0x5B, 0xC5, 0x22, 0xC8, 0x33, 0x85, 0x22, 0xA8, 0x2B, 0xB7, 0xC1, 0x97, 0x95, 0xCB, 0x3A, 0x6C,
+0xC1, 0x76, 0x95, 0xA5, 0x19, 0x5E, 0x5A, 0xC7, 0xE6, 0x22, 0x09, 0x33, 0xB7, 0x9D, 0x2B, 0x43,
+0xA5, 0x1A, 0x70, 0x64, 0x96, 0x95, 0x66, 0x22, 0x64, 0xC0, 0xA8, 0x33, 0x55, 0xC8, 0xE5, 0x19,
+0x56, 0x8D, 0x2D, 0x53, 0x24, 0x12, 0xCB, 0x43, 0x97, 0x9D, 0xEB, 0x3A, 0x44, 0x1A, 0x07, 0x2B,
+0x7C, 0x5E, 0xC1, 0xF0, 0x6B, 0xF5, 0x8C, 0x5C, 0xC3, 0x37, 0x95, 0xD9, 0xAD, 0x6C, 0x53, 0xC3,
+0x11, 0x6B, 0xAB, 0x6D, 0x6B, 0xC4, 0xC7, 0x4A, 0x88, 0x83, 0xC9, 0x8B, 0x68, 0x73, 0x26, 0x32,
+0x5E, 0x00, 0x6B, 0xC1, 0x6C, 0xA4, 0x6E, 0xE5, 0x86, 0xC1, 0x8F, 0xE5, 0x8A, 0x93, 0x81, 0xC0,
+0x8E, 0xE5, 0x95, 0xC2, 0xA8, 0x8C, 0xF2, 0x7D, 0xFF, 0xFF, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x15, 0xC1, 0x30, 0x84, 0x14, 0xA5, 0x00, 0xC0, 0x30, 0x8C, 0x71, 0x00, 0xC1, 0x5D, 0xEF, 0x9E,
+0xF7, 0x71, 0xC1, 0x59, 0xCE, 0x96, 0xB5, 0x4C, 0xC0, 0x10, 0x84, 0x4C, 0xC4, 0x8E, 0x73, 0xFB,
+0xDE, 0xCF, 0x7B, 0x9A, 0xD6, 0xF3, 0x9C, 0xA6, 0xC0, 0xBE, 0xF7, 0x71, 0x00, 0xA6, 0xC3, 0xCF,
+0x6D, 0xCA, 0x34, 0xA9, 0x54, 0xEB, 0xAC, 0xB7, 0xC0, 0x90, 0xCD, 0xBF, 0xC2, 0x2D, 0xC5, 0x28,
+0x53, 0x06, 0x2A, 0xA1, 0xAB, 0xC6, 0xEB, 0x42, 0x2A, 0x3B, 0x8A, 0x33, 0xE9, 0x32, 0x07, 0x22,
+0x88, 0x42, 0xA9, 0x52, 0x99, 0xA9, 0x7C, 0xC2, 0x6B, 0x74, 0xC9, 0x5B, 0x87, 0x42, 0xBB, 0xA9,
+0x00, 0xC7, 0x67, 0x32, 0x6F, 0x5C, 0x2C, 0x44, 0xC9, 0x32, 0x2D, 0x4B, 0x06, 0x22, 0x47, 0x3A,
+0xA6, 0x42, 0x96, 0xA2, 0xAE, 0xC0, 0xCA, 0x6B, 0x7A, 0x5E, 0x6D, 0xA6, 0xA9, 0x49, 0xC4, 0x77,
+0x9D, 0xCB, 0x3A, 0xAF, 0x5B, 0xD4, 0x84, 0xE7, 0x2A, 0x5A, 0xC0, 0x84, 0x11, 0x91, 0xC1, 0x11,
+0x6C, 0x16, 0x8D, 0xBE, 0xC4, 0x29, 0x2A, 0xB3, 0x74, 0x4D, 0x44, 0xA8, 0x2B, 0xE6, 0x22, 0xA7,
+0xA5, 0xD0, 0xAB, 0x43, 0xB7, 0xA5, 0x6B, 0x3B, 0x53, 0x75, 0x7A, 0xBE, 0xCA, 0x3A, 0x27, 0x23,
+0xC8, 0x33, 0x24, 0x1A, 0xA4, 0x11, 0x92, 0x74, 0x32, 0x74, 0x64, 0x11, 0x35, 0x8D, 0x6D, 0x4B,
+0x96, 0x95, 0xEB, 0x4A, 0x7A, 0xC8, 0xE6, 0x22, 0xA3, 0x11, 0x45, 0x1A, 0x34, 0x7D, 0x91, 0x74,
+0x07, 0x23, 0xEC, 0x4B, 0x97, 0x9D, 0x27, 0x22, 0xA8, 0x69, 0xC3, 0x45, 0x1A, 0x34, 0x7D, 0x4F,
+0x54, 0xC4, 0x11, 0x7F, 0xC1, 0x18, 0xA6, 0x6B, 0x43, 0x75, 0xA1, 0xC4, 0x65, 0x22, 0xE5, 0x19,
+0x31, 0x6C, 0xD4, 0x84, 0x46, 0x1A, 0x4A, 0xC0, 0x06, 0x1A, 0x7A, 0xC1, 0xCF, 0x63, 0x63, 0x09,
+0x5E, 0xC7, 0x07, 0x22, 0x0C, 0x4B, 0x8A, 0x3A, 0xB8, 0xA5, 0xE6, 0x21, 0x76, 0x95, 0x9B, 0xBE,
+0x68, 0x2A, 0x5E, 0xBF, 0x00, 0x9E, 0xC6, 0x08, 0x53, 0x6E, 0xCD, 0xD1, 0xDD, 0x4E, 0xCD, 0xEB,
+0xC4, 0x2B, 0xAC, 0x06, 0x2A, 0x59, 0xC2, 0xA4, 0x11, 0x89, 0x6B, 0x2A, 0x94, 0x95, 0x61, 0x9A,
+0xA1, 0xBE, 0xC3, 0x89, 0x9C, 0x88, 0x6C, 0xF2, 0x85, 0xFF, 0xFF, 0x2D, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x14, 0xC1, 0x1C, 0xE7, 0xCF, 0x7B, 0x71, 0x00, 0x6C, 0x70, 0xC1, 0x51, 0x8C, 0xEF, 0x7B,
+0x00, 0xC1, 0xDF, 0xFF, 0x75, 0xAD, 0x48, 0xC3, 0xEF, 0x83, 0x5D, 0xEF, 0xFF, 0xFF, 0x34, 0xAD,
+0x40, 0xC2, 0xEB, 0x5A, 0x75, 0xB5, 0x6D, 0x73, 0x40, 0xC0, 0x9E, 0xF7, 0x71, 0x01, 0xC5, 0xB0,
+0x6D, 0x89, 0x34, 0x4B, 0x95, 0x6D, 0xD5, 0x94, 0xE6, 0xDE, 0xFF, 0xAB, 0xC6, 0xD6, 0xEE, 0x8A,
+0xA4, 0x05, 0x22, 0xA5, 0x11, 0xAA, 0x32, 0x15, 0x85, 0xD1, 0x64, 0x9D, 0xC3, 0xB3, 0x7C, 0x48,
+0x2A, 0xCD, 0xAC, 0x6F, 0xD5, 0x91, 0x00, 0xAE, 0x02, 0xA2, 0x9E, 0x7F, 0xC6, 0xEA, 0x7B, 0x94,
+0x7C, 0xF4, 0x84, 0x35, 0x95, 0x1A, 0xB6, 0xA9, 0x3A, 0xEE, 0xBC, 0xBE, 0x9A, 0x6A, 0xA9, 0x75,
+0x96, 0x63, 0xAE, 0xA2, 0xC3, 0x2D, 0xCD, 0x68, 0x63, 0x72, 0x74, 0x69, 0x32, 0x57, 0xC2, 0x8F,
+0x5C, 0x65, 0x1A, 0x84, 0x11, 0xBA, 0x91, 0xC3, 0xCF, 0x63, 0x52, 0x74, 0xB4, 0x7C, 0x97, 0x9D,
+0xAE, 0xC0, 0x08, 0x2B, 0x4B, 0xC0, 0x07, 0x2B, 0xA2, 0xC1, 0x83, 0x11, 0x09, 0x33, 0x67, 0xC3,
+0x8D, 0x53, 0x38, 0xA6, 0x35, 0x8D, 0xC5, 0x19, 0x99, 0xBE, 0x57, 0xC2, 0xCA, 0x3A, 0xFD, 0xCE,
+0x77, 0x95, 0x50, 0xC7, 0x8E, 0x53, 0x39, 0xAE, 0xB7, 0xA5, 0xC5, 0x21, 0x05, 0x1A, 0xC7, 0x22,
+0x63, 0x11, 0x0B, 0x43, 0x69, 0x7B, 0xC4, 0xCB, 0x43, 0x6A, 0x3B, 0xB6, 0x95, 0xE8, 0x2A, 0x27,
+0x2B, 0x91, 0xC7, 0x8C, 0x4B, 0xDC, 0xC6, 0xD6, 0x95, 0xEA, 0x32, 0xF4, 0x84, 0xDC, 0xCE, 0x34,
+0x7D, 0x09, 0x33, 0x84, 0x5F, 0xC8, 0x4A, 0x3B, 0xBC, 0xC6, 0xF9, 0xAD, 0xEE, 0x4B, 0x10, 0x64,
+0xB9, 0xA5, 0x57, 0x9D, 0x8A, 0x3A, 0x15, 0x8D, 0x59, 0xCD, 0x4E, 0x53, 0x16, 0x8D, 0xD9, 0xA5,
+0x8F, 0x5B, 0x43, 0x09, 0xEE, 0x5B, 0xF2, 0x7C, 0x46, 0x22, 0x14, 0x85, 0xD8, 0xAD, 0x52, 0x74,
+0x05, 0x22, 0xED, 0xB4, 0x99, 0xFF, 0x65, 0x90, 0xC3, 0x31, 0xD6, 0x2D, 0xD5, 0xA9, 0x73, 0x26,
+0x1A, 0xA1, 0xC1, 0xA6, 0x4A, 0xE7, 0x62, 0x96, 0xC2, 0x28, 0x63, 0x2A, 0x8C, 0x07, 0x63, 0x00,
+0xC3, 0x08, 0x74, 0x68, 0x4C, 0x13, 0x86, 0xFF, 0xFF, 0x2D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14,
+0xC1, 0x79, 0xCE, 0x71, 0x8C, 0x71, 0x00, 0xC0, 0x51, 0x8C, 0x79, 0xC7, 0xF0, 0x83, 0x9E, 0xF7,
+0x14, 0xA5, 0x9A, 0xD6, 0xF3, 0x9C, 0x5D, 0xEF, 0xCF, 0x7B, 0xBE, 0xF7, 0x71, 0xC1, 0xD7, 0xBD,
+0xB2, 0x94, 0x41, 0x71, 0xC0, 0x55, 0xAD, 0x48, 0x71, 0x02, 0xC5, 0xD1, 0x8D, 0x89, 0x34, 0x6C,
+0xAD, 0x10, 0xDE, 0xBD, 0xFF, 0xFF, 0xFF, 0x00, 0xC3, 0x9B, 0xFF, 0x6C, 0xC5, 0x65, 0x32, 0xA5,
+0x19, 0xAF, 0xC0, 0x31, 0x6C, 0x8D, 0xC4, 0x18, 0x9E, 0xF9, 0xB5, 0x68, 0x32, 0x0E, 0xB5, 0xAF,
+0xE5, 0x86, 0xAE, 0xBA, 0x85, 0xB7, 0x53, 0x4E, 0x00, 0xC7, 0xCF, 0xDD, 0xE9, 0x7B, 0x8E, 0x53,
+0x92, 0x74, 0x2D, 0x4B, 0x53, 0x74, 0x0B, 0x4B, 0x4E, 0xC5, 0xBF, 0x00, 0xA9, 0x00, 0x93, 0xBD,
+0x02, 0xC5, 0x8E, 0xD5, 0xA8, 0x6B, 0x85, 0x11, 0xE6, 0x19, 0x6A, 0x33, 0xA6, 0x22, 0x72, 0x77,
+0x7E, 0x00, 0xC0, 0x08, 0x22, 0xA9, 0xA6, 0xC6, 0x2C, 0x4B, 0x28, 0x2A, 0x64, 0x11, 0x46, 0x22,
+0xE9, 0x33, 0xE7, 0x22, 0x84, 0x11, 0x61, 0xC3, 0xA8, 0x2A, 0x28, 0x33, 0xCA, 0x42, 0x08, 0x2A,
+0x5E, 0xBE, 0x00, 0x5E, 0xC9, 0x47, 0x22, 0x2D, 0x54, 0xAF, 0x64, 0xEC, 0x43, 0x06, 0x1A, 0xCB,
+0x42, 0x27, 0x2A, 0x84, 0x11, 0x05, 0x1A, 0x07, 0x23, 0x72, 0xCA, 0x09, 0x33, 0xCD, 0x53, 0x6E,
+0x5B, 0xC9, 0x32, 0x07, 0x2B, 0x6A, 0x33, 0x49, 0x34, 0x26, 0x23, 0x44, 0x1A, 0x8A, 0x3B, 0x6D,
+0x53, 0xA6, 0xC8, 0xE9, 0x32, 0x6D, 0x4C, 0x6F, 0x5C, 0x4C, 0x4B, 0x28, 0x2B, 0xA7, 0x22, 0xA4,
+0x19, 0xE5, 0x21, 0x0C, 0x4B, 0x4A, 0xC1, 0x89, 0x32, 0xC6, 0x19, 0x53, 0xC4, 0x29, 0x2A, 0xA6,
+0x19, 0x8E, 0x5B, 0xD0, 0x6B, 0x49, 0x32, 0x4D, 0xC0, 0xAA, 0x3A, 0x72, 0xC0, 0x27, 0x22, 0x69,
+0xC0, 0xA5, 0x11, 0x79, 0xC3, 0xAF, 0x5B, 0x31, 0x74, 0x4D, 0x4B, 0x66, 0x32, 0x4B, 0xC1, 0xFD,
+0xFF, 0xFF, 0xFF, 0x00, 0xC6, 0x59, 0xF7, 0xCF, 0xE5, 0xAB, 0x9C, 0x08, 0x2C, 0x86, 0x22, 0xCA,
+0x8B, 0x8E, 0xE5, 0x82, 0xA9, 0x00, 0x92, 0x76, 0xBD, 0xC1, 0x4B, 0x95, 0x35, 0x9E, 0x71, 0x0B,
+0xC1, 0x18, 0xC6, 0xDF, 0xFF, 0x71, 0xC0, 0x59, 0xCE, 0x60, 0x5D, 0xC1, 0x5D, 0xEF, 0x9A, 0xD6,
+0x74, 0xC3, 0xCF, 0x7B, 0xF7, 0xBD, 0xDF, 0xFF, 0xB2, 0x94, 0xA1, 0xC0, 0x1C, 0xE7, 0x71, 0x11,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0xC1, 0x1C, 0xE7, 0xAF, 0x7B, 0x71, 0x00, 0xC2, 0xCF, 0x7B,
+0xFB, 0xDE, 0x92, 0x94, 0x71, 0xC2, 0x75, 0xAD, 0xB6, 0xB5, 0x14, 0xA5, 0x71, 0x67, 0xC0, 0x3C,
+0xE7, 0x71, 0x50, 0x00, 0xC0, 0xB3, 0x9C, 0x71, 0xC1, 0x34, 0xA5, 0x79, 0xCE, 0x71, 0x02, 0xC4,
+0xD2, 0x95, 0x69, 0x34, 0x2C, 0x9D, 0xB0, 0xDD, 0x9D, 0xFF, 0x71, 0x00, 0xCD, 0x57, 0xFF, 0xEB,
+0xB4, 0x25, 0x2A, 0x85, 0x11, 0x69, 0x32, 0xFA, 0xAD, 0x2D, 0x4B, 0xAF, 0x5B, 0x57, 0x9D, 0x68,
+0x2A, 0x2E, 0xB5, 0xF0, 0xE5, 0x8F, 0xD5, 0xCF, 0xDD, 0x9A, 0xA1, 0x00, 0x58, 0x00, 0x53, 0x60,
+0xC7, 0x0A, 0x84, 0xB8, 0x9D, 0x50, 0x64, 0xF0, 0x63, 0x16, 0x85, 0x0A, 0x43, 0x4E, 0xC5, 0x8F,
+0xCD, 0x00, 0xA9, 0x4B, 0x00, 0xA5, 0xAE, 0x01, 0x4C, 0xC0, 0x67, 0x63, 0x6A, 0xC1, 0x29, 0x33,
+0xC6, 0x22, 0xBF, 0xAF, 0x73, 0x01, 0xC1, 0x48, 0x2B, 0xE8, 0x2A, 0xA1, 0x72, 0xA9, 0x96, 0x00,
+0xC0, 0xE4, 0x19, 0xA2, 0x01, 0x63, 0x64, 0xAB, 0x5E, 0x63, 0x01, 0x66, 0xC2, 0x05, 0x1A, 0x27,
+0x2B, 0x67, 0x23, 0xB6, 0xC1, 0xC4, 0x19, 0x43, 0x09, 0x5E, 0x63, 0x7C, 0x7F, 0xC2, 0x45, 0x22,
+0xA8, 0x33, 0x27, 0x23, 0x7C, 0xC0, 0xE7, 0x22, 0x49, 0xC2, 0xC7, 0x2A, 0x6A, 0x34, 0x86, 0x22,
+0x63, 0xC0, 0xA5, 0x22, 0x93, 0x4A, 0x6B, 0xC2, 0x46, 0x23, 0x44, 0x1A, 0x63, 0x11, 0x6B, 0xC2,
+0x07, 0x2B, 0xA8, 0x2A, 0xA5, 0x19, 0x59, 0x4A, 0xC1, 0xE5, 0x29, 0x49, 0x7B, 0xA6, 0xAF, 0xAE,
+0x6E, 0x96, 0x75, 0xC0, 0x8A, 0x7B, 0x7A, 0x7F, 0xC1, 0xCC, 0x8B, 0x6F, 0x9C, 0x6E, 0x7A, 0x6E,
+0x69, 0xC4, 0xC8, 0x52, 0x05, 0x22, 0x6A, 0xA4, 0x16, 0xF7, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0xF7,
+0xCC, 0xBC, 0xA7, 0x5A, 0x84, 0x21, 0x04, 0x21, 0x87, 0x62, 0xEA, 0x9B, 0xA6, 0xC1, 0x2B, 0xAC,
+0x8B, 0xB4, 0xAB, 0xBE, 0xC3, 0xEC, 0xC4, 0x2B, 0x8D, 0x56, 0xA6, 0xFF, 0xFF, 0x0B, 0x68, 0x61,
+0xC0, 0x7D, 0xEF, 0x68, 0xA5, 0xC1, 0x5D, 0xEF, 0xDB, 0xDE, 0x68, 0x91, 0x74, 0xAE, 0xC4, 0x3C,
+0xE7, 0xEF, 0x7B, 0x75, 0xAD, 0x71, 0x8C, 0xFF, 0xFF, 0x11, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x15,
+0xC1, 0x30, 0x84, 0x14, 0xA5, 0xA5, 0xC0, 0x30, 0x8C, 0x71, 0x45, 0xC1, 0xDF, 0xFF, 0x55, 0xAD,
+0x68, 0xC0, 0x96, 0xB5, 0x71, 0x78, 0xC3, 0x10, 0x84, 0xB6, 0xB5, 0x8E, 0x73, 0x1C, 0xE7, 0x54,
+0x71, 0x44, 0x74, 0x71, 0x02, 0xC8, 0xB8, 0xBE, 0x48, 0x2C, 0x69, 0x54, 0x4D, 0xC5, 0x32, 0xEE,
+0x38, 0xFF, 0x15, 0xFF, 0xCD, 0xD5, 0xC6, 0x4A, 0x6A, 0x65, 0xC0, 0x28, 0x2A, 0x46, 0xC0, 0x0C,
+0x4B, 0x65, 0x5C, 0x72, 0xC1, 0xE7, 0x4A, 0x27, 0x53, 0x02, 0xA6, 0x4C, 0xAB, 0x4C, 0x00, 0xBB,
+0xC5, 0xA7, 0x3A, 0x70, 0x64, 0x6C, 0x43, 0xAA, 0x3A, 0x4D, 0x4B, 0x06, 0x22, 0x47, 0x4C, 0x53,
+0x4C, 0x47, 0x02, 0x4C, 0x00, 0x47, 0xC4, 0x86, 0x32, 0x69, 0x33, 0x86, 0x22, 0x25, 0x1A, 0x68,
+0x2B, 0x63, 0x00, 0x6B, 0xAE, 0xC3, 0xA6, 0x22, 0x88, 0x33, 0x49, 0x34, 0x27, 0x23, 0xB7, 0xC0,
+0x87, 0x22, 0x63, 0x00, 0xBA, 0x02, 0x63, 0x5F, 0xC0, 0xE7, 0x2A, 0x72, 0xC0, 0x05, 0x2A, 0x72,
+0x63, 0x66, 0xC1, 0x85, 0x22, 0x48, 0x2B, 0x7C, 0xC8, 0x88, 0x3A, 0xAE, 0x73, 0xD0, 0x5B, 0xF2,
+0x53, 0x31, 0x74, 0xAD, 0x6B, 0xC5, 0x21, 0x85, 0x1A, 0xC6, 0x22, 0x5A, 0xC1, 0xA3, 0x11, 0x27,
+0x3A, 0x5D, 0xC4, 0x90, 0x7C, 0xCF, 0x73, 0x68, 0x3A, 0x66, 0x1A, 0x28, 0x2B, 0x66, 0xC0, 0x43,
+0x09, 0x50, 0x70, 0x66, 0x00, 0x6B, 0x73, 0xAB, 0x91, 0x61, 0xC1, 0x28, 0x53, 0x2E, 0xDD, 0xAE,
+0x9E, 0xAB, 0x00, 0xA5, 0xBB, 0x45, 0x96, 0xC0, 0x6E, 0xDD, 0x42, 0x7D, 0x45, 0x42, 0x00, 0xCA,
+0x8F, 0xE5, 0xED, 0xAC, 0xC4, 0x11, 0xC6, 0x4A, 0xEC, 0xC4, 0x74, 0xEE, 0x96, 0xEE, 0xB0, 0xDD,
+0x09, 0x9C, 0x84, 0x21, 0x03, 0x19, 0xB6, 0xC2, 0x47, 0x5A, 0x29, 0x7B, 0xC8, 0x72, 0x95, 0x92,
+0x6C, 0xA5, 0xAE, 0x8F, 0xC1, 0xEB, 0x52, 0xAE, 0x7B, 0xAF, 0xC0, 0x10, 0x84, 0xAE, 0x54, 0xC6,
+0xD3, 0x9C, 0x55, 0xAD, 0xD7, 0xBD, 0x59, 0xCE, 0xBA, 0xD6, 0x9E, 0xF7, 0xFF, 0xFF, 0x00, 0xC1,
+0xB6, 0xBD, 0xF7, 0xBD, 0x79, 0xC6, 0x96, 0xB5, 0xF3, 0xA4, 0x5D, 0xEF, 0xFB, 0xDE, 0x92, 0x94,
+0xF0, 0x83, 0x7D, 0xEF, 0x71, 0xC0, 0x1C, 0xE7, 0x68, 0x4D, 0x7C, 0x71, 0x11, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x15, 0x91, 0xC0, 0x34, 0xA5, 0x00, 0x5D, 0x71, 0x4D, 0x71, 0xC2, 0x3C, 0xE7, 0xF3,
+0x9C, 0x9A, 0xD6, 0x71, 0x00, 0x4C, 0x7C, 0xC0, 0x1C, 0xE7, 0x71, 0xC0, 0xBA, 0xDE, 0x71, 0xC0,
+0xFC, 0xE6, 0x49, 0x71, 0x02, 0xC7, 0x5B, 0xDF, 0x48, 0x34, 0xC7, 0x23, 0xE9, 0x4B, 0xAB, 0x9C,
+0x4C, 0xBD, 0xCA, 0xA4, 0xE6, 0x4A, 0x72, 0x00, 0x6D, 0xA9, 0x92, 0xBF, 0x6D, 0x01, 0x59, 0x00,
+0xAE, 0x59, 0x01, 0x5E, 0x02, 0xAB, 0x7A, 0x94, 0xC2, 0x66, 0x3A, 0xC7, 0x52, 0xE5, 0x29, 0x63,
+0xA6, 0x05, 0x59, 0x5E, 0xA9, 0x63, 0xC1, 0x28, 0x2B, 0x85, 0x22, 0x59, 0xC1, 0x6D, 0x5B, 0x32,
+0xA5, 0x6E, 0x9A, 0xC5, 0x91, 0x94, 0xEB, 0x52, 0x06, 0x22, 0xC8, 0x2B, 0xE6, 0x22, 0x26, 0x2A,
+0xA9, 0xC2, 0x68, 0x3B, 0x09, 0x3B, 0x27, 0x2A, 0x80, 0x63, 0x66, 0x01, 0x63, 0xC4, 0x07, 0x33,
+0x0B, 0x84, 0x4C, 0xA4, 0xEB, 0x93, 0x46, 0x32, 0x63, 0x00, 0xC8, 0x65, 0x22, 0xA6, 0x22, 0x30,
+0x74, 0x7B, 0xD6, 0x9A, 0x95, 0x9B, 0x7D, 0xBD, 0xCE, 0x92, 0x94, 0x84, 0x19, 0x77, 0xC0, 0xE7,
+0x2A, 0x57, 0xC2, 0xE2, 0x08, 0xEB, 0x52, 0x93, 0xA4, 0xBE, 0xAE, 0xC0, 0xEF, 0x73, 0x5A, 0x64,
+0xC4, 0x4C, 0x43, 0x93, 0x7C, 0x13, 0x7D, 0x68, 0x2A, 0x84, 0x11, 0xBE, 0x00, 0xAE, 0xC0, 0x45,
+0x1A, 0x00, 0x96, 0xC1, 0xA6, 0x4A, 0x2D, 0xCD, 0xAE, 0x73, 0xAF, 0xB6, 0x73, 0x78, 0xBB, 0x73,
+0xBE, 0xAE, 0x78, 0x7B, 0x00, 0x73, 0xC1, 0x6E, 0xD5, 0x0D, 0xAD, 0x6B, 0xBF, 0x6E, 0xC3, 0xA8,
+0x83, 0xC9, 0x93, 0x68, 0x73, 0x86, 0x32, 0x72, 0x66, 0xA2, 0xC1, 0x08, 0x6B, 0x8B, 0xAC, 0x86,
+0x95, 0x00, 0xA2, 0x00, 0xC4, 0x6A, 0x94, 0xCC, 0x7C, 0x37, 0xB6, 0x79, 0xCE, 0xF8, 0xC5, 0x80,
+0x91, 0xC6, 0x14, 0xA5, 0xB3, 0x9C, 0x51, 0x8C, 0xEF, 0x83, 0x8E, 0x73, 0x0C, 0x63, 0x59, 0xCE,
+0x71, 0x00, 0xC1, 0xDB, 0xDE, 0x34, 0xA5, 0x69, 0x4D, 0x7C, 0xC0, 0x5D, 0xEF, 0x5C, 0xC2, 0x34,
+0xAD, 0x96, 0xB5, 0x8A, 0x52, 0x7D, 0xC1, 0x9E, 0xF7, 0xEB, 0x62, 0x70, 0x55, 0x71, 0x11, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x1D, 0x58, 0xC0, 0xDF, 0xFF, 0x71, 0x0C, 0xC4, 0x3A, 0xD7, 0x48, 0x34,
+0xE8, 0x2B, 0x06, 0x23, 0x65, 0x1A, 0x53, 0xC1, 0x25, 0x1A, 0xC4, 0x11, 0x72, 0x6D, 0x03, 0x72,
+0x6D, 0x02, 0xA9, 0xA7, 0x00, 0x66, 0x6D, 0x72, 0x6D, 0x00, 0xC6, 0xA8, 0x2A, 0x28, 0x2B, 0x08,
+0x63, 0x0E, 0xCD, 0x4E, 0xCD, 0x6C, 0xAC, 0x26, 0x2A, 0x63, 0x66, 0x00, 0x6D, 0x00, 0x66, 0xA6,
+0x63, 0x5E, 0xC0, 0xE5, 0x19, 0x44, 0xC1, 0x65, 0x22, 0x43, 0x11, 0x68, 0xC8, 0x10, 0x74, 0x38,
+0xD6, 0xAD, 0xBC, 0x4B, 0xB4, 0x58, 0xDE, 0x71, 0x84, 0xC4, 0x19, 0x24, 0x1A, 0xAE, 0x63, 0x5B,
+0xC4, 0xCC, 0x9B, 0xA9, 0x9B, 0x94, 0xC5, 0x31, 0x84, 0xE6, 0x21, 0x5E, 0x66, 0x01, 0x9A, 0xC1,
+0x48, 0x5B, 0x2E, 0xCD, 0x91, 0x7A, 0xC1, 0x4B, 0x8C, 0xC4, 0x11, 0xB6, 0x63, 0xA5, 0xC2, 0xA5,
+0x21, 0x2C, 0x5B, 0x11, 0x64, 0x97, 0xD2, 0x8E, 0x63, 0x68, 0x42, 0x05, 0x1A, 0x27, 0x2B, 0x04,
+0x1A, 0x23, 0x11, 0xC2, 0x08, 0x8D, 0x6B, 0x5D, 0xEF, 0x36, 0xB5, 0x1C, 0xEF, 0xB2, 0x8C, 0xE4,
+0x19, 0x85, 0x1A, 0xF4, 0x84, 0xB8, 0x9D, 0x50, 0x64, 0x68, 0x2A, 0xE6, 0x19, 0x6D, 0xA9, 0x63,
+0x5E, 0x00, 0x96, 0x66, 0xC0, 0x65, 0x42, 0xAF, 0xA9, 0x66, 0x5F, 0x96, 0x5F, 0x66, 0xAE, 0x5F,
+0xBF, 0xC0, 0xE7, 0x4A, 0x6E, 0xBE, 0xAE, 0x6E, 0x86, 0xC1, 0xC5, 0x19, 0x26, 0x22, 0xAF, 0x7C,
+0x75, 0x77, 0xC1, 0x35, 0x8D, 0x4D, 0x53, 0x5E, 0xBE, 0xAE, 0xC1, 0xE3, 0x29, 0x44, 0x42, 0x00,
+0xAE, 0x9E, 0xC3, 0xE5, 0x2A, 0x65, 0x23, 0x08, 0x34, 0x3A, 0xCF, 0x71, 0x0B, 0x6C, 0xC0, 0x71,
+0x94, 0x96, 0x6C, 0xC3, 0xB2, 0x9C, 0x7D, 0xEF, 0xFB, 0xDE, 0x14, 0xA5, 0x71, 0x44, 0xC2, 0xEF,
+0x83, 0xBA, 0xD6, 0xF4, 0xA4, 0x71, 0xC0, 0x31, 0x8C, 0x6C, 0x71, 0x10, 0x70, 0x00, 0x71, 0x2D,
+0xC1, 0x19, 0xCF, 0x89, 0x34, 0xA1, 0x7D, 0xC0, 0x06, 0x22, 0x41, 0x00, 0x72, 0x01, 0xA2, 0x6D,
+0xAB, 0xAE, 0xBA, 0x00, 0x72, 0x6D, 0x72, 0x6D, 0x00, 0x72, 0x02, 0x79, 0xC3, 0x07, 0x22, 0x69,
+0x33, 0x25, 0x1A, 0xCC, 0xAC, 0x47, 0xC1, 0x0E, 0xC5, 0xCF, 0xDD, 0x5B, 0x56, 0x66, 0x01, 0x6D,
+0xAE, 0xC0, 0x66, 0x22, 0x00, 0xAB, 0xC2, 0x49, 0x33, 0xA6, 0x22, 0x84, 0x11, 0xBA, 0x5E, 0xC2,
+0xE6, 0x29, 0x2B, 0x63, 0x29, 0x7B, 0xA5, 0xC2, 0x4C, 0x73, 0x4C, 0x5B, 0x05, 0x22, 0x41, 0xC5,
+0x4D, 0x63, 0x77, 0xB5, 0x4E, 0xB4, 0xA9, 0xAB, 0x74, 0xC5, 0xB3, 0x8C, 0x7C, 0xC0, 0x63, 0x11,
+0x66, 0x00, 0x9A, 0xA5, 0xC5, 0xA9, 0x63, 0x6E, 0xCD, 0xCD, 0xC4, 0x2E, 0xCD, 0xCC, 0xA4, 0xC4,
+0x19, 0x63, 0x66, 0x00, 0x5E, 0x52, 0x00, 0xBB, 0x90, 0xC0, 0xC4, 0x11, 0x7D, 0xC0, 0x24, 0x1A,
+0x52, 0xA6, 0xC6, 0xE2, 0x08, 0xAE, 0x6B, 0xBF, 0xFF, 0xF0, 0x8B, 0x7E, 0xF7, 0xB3, 0x94, 0x22,
+0x09, 0x52, 0xC4, 0xB3, 0x84, 0x95, 0x95, 0x67, 0x2A, 0xE7, 0x2A, 0x28, 0x2B, 0x72, 0x5E, 0xC1,
+0xE5, 0x29, 0xA7, 0x52, 0xBB, 0xA9, 0xA9, 0x93, 0x99, 0xAE, 0x92, 0xCB, 0xA9, 0x3A, 0x8E, 0x5B,
+0xE7, 0x21, 0x27, 0x22, 0xEA, 0x3A, 0xEF, 0x63, 0x6C, 0x43, 0x88, 0x2A, 0x46, 0x3A, 0xEA, 0x9B,
+0x4B, 0xAC, 0xE8, 0x62, 0x63, 0xC1, 0xE5, 0x19, 0xE8, 0x32, 0x9E, 0xC5, 0x86, 0x22, 0xC4, 0x19,
+0xE6, 0x19, 0x5A, 0xBE, 0xF0, 0x6B, 0x63, 0x11, 0x63, 0xC4, 0x24, 0x3A, 0xA7, 0xA3, 0x85, 0x7A,
+0x49, 0x8B, 0x8B, 0x8B, 0x00, 0xC4, 0xA8, 0x73, 0x86, 0x2B, 0xE7, 0x2B, 0x1A, 0xCF, 0xFF, 0xFF,
+0x91, 0x6C, 0x71, 0x09, 0xC1, 0x30, 0x84, 0x6D, 0x73, 0x71, 0x50, 0xC1, 0xB6, 0xBD, 0x55, 0xAD,
+0xA5, 0xC3, 0xBA, 0xD6, 0xFB, 0xDE, 0x30, 0x8C, 0xDB, 0xDE, 0x45, 0xC2, 0x59, 0xCE, 0xCF, 0x7B,
+0xDF, 0xFF, 0x71, 0x10, 0x70, 0x00, 0x71, 0x2D, 0xC1, 0xF9, 0xCE, 0xAA, 0x3C, 0xA6, 0xC1, 0x69,
+0x33, 0x26, 0x22, 0xA6, 0xA6, 0x95, 0x00, 0x6D, 0xAB, 0x6D, 0x79, 0x74, 0xBD, 0x7C, 0x00, 0xAF,
+0x00, 0x7C, 0x00, 0x72, 0x00, 0x79, 0x41, 0x9A, 0xC1, 0x09, 0x33, 0xA6, 0x22, 0x6D, 0xC1, 0x4B,
+0x8C, 0x8E, 0xD5, 0x47, 0xC1, 0x0D, 0xB5, 0x46, 0x32, 0x5E, 0x66, 0x01, 0x6D, 0x49, 0x98, 0x5A,
+0x5F, 0xC0, 0x45, 0x1A, 0x5E, 0x6D, 0x00, 0x66, 0xC2, 0x05, 0x1A, 0x65, 0x22, 0x84, 0x19, 0xA2,
+0xC0, 0xA3, 0x11, 0x4E, 0x77, 0xC0, 0xC6, 0x22, 0x77, 0xC1, 0x88, 0x3A, 0x89, 0x52, 0xA9, 0xC3,
+0xE5, 0x39, 0x69, 0x3A, 0x07, 0x2A, 0x64, 0x11, 0x66, 0x00, 0x4B, 0x77, 0xC0, 0x25, 0x2A, 0x6A,
+0xC3, 0xED, 0xBC, 0x6C, 0x9C, 0x86, 0x3A, 0xA5, 0x11, 0x77, 0xBB, 0x66, 0x61, 0x5E, 0x00, 0x66,
+0xC5, 0x68, 0x3A, 0x13, 0x8D, 0xCF, 0x53, 0x4E, 0x4B, 0xAE, 0x6B, 0xC6, 0x29, 0x5E, 0xC5, 0xB1,
+0x84, 0x9E, 0xF7, 0x6F, 0x7B, 0x5D, 0xEF, 0x33, 0x95, 0xE4, 0x19, 0xAF, 0xC4, 0x14, 0x8D, 0xF9,
+0xB5, 0x8A, 0x32, 0x28, 0x2B, 0x68, 0x2B, 0x6B, 0x59, 0xC1, 0x86, 0x42, 0x2E, 0xCD, 0xBA, 0x7A,
+0xA5, 0x7D, 0x9E, 0x7D, 0xC6, 0xCC, 0xB4, 0x33, 0x85, 0x5B, 0xB6, 0xF4, 0x84, 0x97, 0x9D, 0x50,
+0x64, 0x5A, 0xAE, 0x85, 0xC2, 0xCD, 0x53, 0x0A, 0x94, 0x6E, 0xDD, 0x96, 0x99, 0xC2, 0x48, 0x53,
+0xE7, 0x22, 0xA8, 0x33, 0xAF, 0x55, 0x5E, 0x72, 0xC1, 0x19, 0xB6, 0xCF, 0x6B, 0x52, 0xCB, 0xA4,
+0x11, 0x68, 0x7B, 0x73, 0xCD, 0x0C, 0x6B, 0xD4, 0xA4, 0x16, 0xA5, 0x94, 0x9C, 0x8E, 0xB4, 0x07,
+0x54, 0xA6, 0x23, 0xD8, 0xC6, 0x9E, 0xF7, 0x91, 0xC0, 0xDF, 0xFF, 0xAE, 0x09, 0xC1, 0x38, 0xC6,
+0xB6, 0xB5, 0x71, 0x44, 0xC0, 0xCF, 0x7B, 0x45, 0xC5, 0x7E, 0xEF, 0xB2, 0x9C, 0x8E, 0x73, 0x18,
+0xC6, 0xDF, 0xFF, 0x10, 0x84, 0x91, 0xC0, 0x79, 0xCE, 0x71, 0x11, 0x70, 0x00, 0x71, 0x0F, 0x44,
+0x91, 0x71, 0x1A, 0xC1, 0xD9, 0xC6, 0x8A, 0x3C, 0x96, 0xC2, 0xE8, 0x3B, 0x88, 0x63, 0x88, 0x73,
+0x68, 0xC0, 0x86, 0x32, 0x72, 0x75, 0x72, 0xAB, 0x6D, 0x72, 0x00, 0xBB, 0xC0, 0x07, 0x2A, 0xAF,
+0x00, 0x95, 0x00, 0xA9, 0x96, 0x4D, 0x00, 0x46, 0xC1, 0x49, 0x33, 0xE4, 0x19, 0x63, 0xC4, 0x05,
+0x2A, 0xEA, 0x73, 0x6A, 0x8C, 0x65, 0x3A, 0x84, 0x11, 0x00, 0x63, 0x01, 0x6D, 0xC1, 0x49, 0x2B,
+0xE4, 0x11, 0x5E, 0x02, 0x63, 0xBB, 0x00, 0xC2, 0x46, 0x22, 0xE7, 0x22, 0x63, 0x09, 0xA7, 0xC0,
+0x46, 0x1A, 0x70, 0xC3, 0x05, 0x1A, 0x07, 0x2B, 0x25, 0x1A, 0xE7, 0x2A, 0x96, 0xC0, 0x49, 0x2B,
+0x63, 0x52, 0x5E, 0xBE, 0x63, 0xC1, 0x26, 0x22, 0x69, 0x33, 0xA9, 0xC0, 0xC4, 0x19, 0x00, 0x56,
+0xC0, 0xE5, 0x21, 0x63, 0xC2, 0x67, 0x22, 0xAA, 0x3B, 0x48, 0x33, 0x66, 0x01, 0x63, 0x00, 0xC2,
+0x8E, 0x63, 0x5E, 0xE7, 0x9B, 0x8D, 0x00, 0xCD, 0x58, 0xB5, 0x69, 0x4A, 0xC4, 0x11, 0x0E, 0x6C,
+0xBF, 0xFF, 0xD7, 0xCD, 0xBE, 0xFF, 0xB3, 0x94, 0xE2, 0x08, 0x23, 0x11, 0xD5, 0x8C, 0x4E, 0x5B,
+0x43, 0x09, 0xE4, 0x19, 0x00, 0x5E, 0x00, 0xC1, 0x66, 0x42, 0xED, 0xBC, 0xAE, 0x00, 0xC0, 0xAC,
+0xB4, 0x63, 0x68, 0xA5, 0x8A, 0xC1, 0xF2, 0x84, 0x1A, 0xAE, 0x95, 0xC2, 0x3A, 0xB6, 0x4F, 0x5C,
+0x14, 0x7D, 0x00, 0xC8, 0x4B, 0x4B, 0x6B, 0x9C, 0x6E, 0xDD, 0x0E, 0xCD, 0xEF, 0xE5, 0xA9, 0x63,
+0xA4, 0x11, 0xE4, 0x11, 0x25, 0x1A, 0x72, 0x59, 0xC3, 0xA5, 0x19, 0x19, 0xB6, 0xF0, 0x6B, 0x63,
+0x11, 0x63, 0xC3, 0xA8, 0x5A, 0x13, 0xC5, 0x15, 0xB5, 0x76, 0xBD, 0xAB, 0xC7, 0x34, 0xBD, 0xCF,
+0xCC, 0xE7, 0x53, 0xA6, 0x23, 0xB4, 0xA5, 0x7A, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0x2B, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x0E, 0xC3, 0x5D, 0xEF, 0x2C, 0x6B, 0xAE, 0x73, 0x92, 0x94, 0x71, 0x19, 0xC5,
+0xF9, 0xC6, 0x8A, 0x3C, 0x89, 0x4C, 0xCA, 0x94, 0xAA, 0xB4, 0x2E, 0xC5, 0xBE, 0xC2, 0x8A, 0xAC,
+0x66, 0x3A, 0xE5, 0x19, 0x6D, 0x00, 0xC1, 0x48, 0x2A, 0xE6, 0x21, 0xAF, 0xC0, 0xAA, 0x3A, 0x61,
+0xBE, 0xBE, 0xA6, 0xA9, 0x00, 0x96, 0x65, 0x01, 0xC3, 0xAA, 0x5B, 0x66, 0x32, 0x06, 0x22, 0x68,
+0x2A, 0x00, 0xC0, 0xCB, 0x43, 0x44, 0xC1, 0xC5, 0x19, 0x25, 0x2A, 0xBB, 0x00, 0x96, 0x00, 0xC2,
+0xA9, 0x53, 0x86, 0x32, 0x26, 0x2A, 0x47, 0x51, 0x4E, 0x91, 0x91, 0x00, 0xC2, 0x47, 0x2A, 0xAC,
+0x53, 0xC9, 0x4A, 0x95, 0xC1, 0x2A, 0x4B, 0x6B, 0x4B, 0x46, 0xC2, 0x28, 0x2B, 0x86, 0x22, 0x48,
+0x2B, 0xAE, 0xA5, 0x63, 0xB6, 0x66, 0x00, 0x96, 0x77, 0x49, 0xA5, 0x6B, 0x63, 0x5E, 0x63, 0x6D,
+0xC2, 0x25, 0x1A, 0xA8, 0x2B, 0x07, 0x23, 0x5E, 0x6D, 0x00, 0x63, 0x77, 0xD2, 0xAA, 0x42, 0x51,
+0x7C, 0xB6, 0x74, 0x13, 0x64, 0x4E, 0x63, 0xC6, 0x31, 0xE1, 0x08, 0x4C, 0x5B, 0xF6, 0xDD, 0x30,
+0xC5, 0xD6, 0xCD, 0xF0, 0x7B, 0xE2, 0x08, 0x23, 0x11, 0x4E, 0x53, 0x8A, 0x3A, 0x83, 0x11, 0xE5,
+0x19, 0x66, 0x22, 0x46, 0x5E, 0x6B, 0xC0, 0x05, 0x2A, 0x02, 0xA9, 0xAF, 0x01, 0xC3, 0x89, 0x32,
+0x6E, 0x53, 0xAA, 0x32, 0x6C, 0x3B, 0x98, 0x00, 0xC3, 0x8B, 0x43, 0xE6, 0x21, 0xC7, 0x4A, 0xCD,
+0xBC, 0xBE, 0xC4, 0x4B, 0x94, 0x05, 0x22, 0x84, 0x11, 0x46, 0x3A, 0x08, 0x73, 0x95, 0xC5, 0x05,
+0x32, 0x85, 0x11, 0xF9, 0xB5, 0xF0, 0x6B, 0x43, 0x11, 0xA4, 0x19, 0x6B, 0xC1, 0x4A, 0x73, 0x4F,
+0x9C, 0xA9, 0xA9, 0xA0, 0xC4, 0x88, 0x63, 0x46, 0x23, 0x87, 0x23, 0x52, 0x95, 0x38, 0xD6, 0x67,
+0xC0, 0xFF, 0xFF, 0x2B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0E, 0xC1, 0x1C, 0xE7, 0x51, 0x8C, 0x71,
+0xC6, 0xCF, 0x7B, 0x18, 0xC6, 0xB3, 0x9C, 0x55, 0xAD, 0xD7, 0xBD, 0xAF, 0x7B, 0x38, 0xCE, 0x71,
+0xC0, 0x7A, 0xD6, 0x40, 0xC1, 0xF3, 0x9C, 0xDB, 0xDE, 0x64, 0xC1, 0x92, 0x94, 0xFB, 0xDE, 0x41,
+0xC1, 0x30, 0x8C, 0x5D, 0xEF, 0x5C, 0xC0, 0xB2, 0x94, 0x54, 0xC0, 0xF7, 0xBD, 0x40, 0xC0, 0x9A,
+0xD6, 0x71, 0x02, 0xC5, 0xD9, 0xC6, 0x49, 0x34, 0x2B, 0x85, 0x4C, 0xCD, 0x53, 0xDE, 0xDD, 0xFF,
+0x91, 0xC2, 0x53, 0xE6, 0xE8, 0x8B, 0xC5, 0x19, 0x96, 0xC7, 0x49, 0x32, 0x98, 0x9D, 0x31, 0x6C,
+0x73, 0x7C, 0x36, 0x8D, 0xA9, 0x32, 0x8D, 0x9C, 0xED, 0xBC, 0x96, 0xAE, 0x63, 0x5B, 0x00, 0x60,
+0x5B, 0xC0, 0x0E, 0xBD, 0xA9, 0xC6, 0xCA, 0x73, 0xD5, 0x84, 0x34, 0x8D, 0xB1, 0x6C, 0xB8, 0xA5,
+0xEA, 0x42, 0xAC, 0xA4, 0x5B, 0x96, 0xA6, 0x00, 0x63, 0x86, 0x53, 0xA9, 0xA6, 0x5B, 0xC1, 0x48,
+0x5B, 0x84, 0x11, 0x00, 0xC2, 0x4D, 0x5B, 0x39, 0xCE, 0xCF, 0xB4, 0xA1, 0xC4, 0xB6, 0xBD, 0x2C,
+0x5B, 0xC5, 0x21, 0x05, 0x1A, 0x27, 0x2B, 0x96, 0xAE, 0xC3, 0xC4, 0x19, 0x06, 0x22, 0xA8, 0x2A,
+0x46, 0x22, 0x55, 0xC0, 0xC7, 0x2A, 0x7F, 0xC0, 0x45, 0x1A, 0xA6, 0x50, 0x6E, 0xC0, 0x26, 0x22,
+0x55, 0xC1, 0xA7, 0x22, 0xE5, 0x19, 0x55, 0x00, 0x50, 0xC0, 0xC8, 0x2A, 0x4B, 0xC0, 0x67, 0x22,
+0x6E, 0x77, 0x41, 0xC2, 0xA9, 0x32, 0x85, 0x19, 0x23, 0x11, 0x4D, 0x48, 0xC1, 0xC6, 0x29, 0x4D,
+0x73, 0x67, 0xA6, 0xC0, 0xC7, 0x29, 0x48, 0xC0, 0x84, 0x19, 0xAF, 0xA9, 0xC0, 0x06, 0x1A, 0x6E,
+0xC0, 0xC9, 0x33, 0x73, 0xC0, 0xA4, 0x11, 0x42, 0xC0, 0x88, 0x52, 0xBE, 0xA5, 0x9E, 0x02, 0x86,
+0xC7, 0xA9, 0x32, 0x4D, 0x53, 0xE8, 0x2A, 0x49, 0x2B, 0xEC, 0x4B, 0xD0, 0x64, 0x0D, 0x4C, 0xEA,
+0x3A, 0x63, 0xC1, 0x26, 0x32, 0x66, 0x3A, 0x6B, 0x92, 0xC8, 0xE5, 0x21, 0xAD, 0xA4, 0xC6, 0x82,
+0x23, 0x72, 0xE9, 0x93, 0xE6, 0x29, 0xD8, 0xAD, 0xF0, 0x6B, 0x63, 0x11, 0x66, 0x00, 0x63, 0xC0,
+0xE4, 0x21, 0xAE, 0xAF, 0xAD, 0xC1, 0x85, 0x1A, 0x46, 0x23, 0xAE, 0xC3, 0x11, 0x8D, 0xD7, 0xCD,
+0x3D, 0xEF, 0xFF, 0xFF, 0x2B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0E, 0xC1, 0x3C, 0xE7, 0x8E, 0x73,
+0x64, 0xC1, 0xEF, 0x83, 0x75, 0xAD, 0x6C, 0xC2, 0xFB, 0xDE, 0xEF, 0x7B, 0xBA, 0xD6, 0x6C, 0xC7,
+0x9E, 0xF7, 0x10, 0x84, 0xBA, 0xDE, 0xAE, 0x7B, 0x96, 0xB5, 0x2C, 0x6B, 0xDB, 0xDE, 0xBE, 0xF7,
+0x5C, 0xC0, 0x14, 0xA5, 0x95, 0xC4, 0x96, 0xB5, 0x51, 0x8C, 0xB6, 0xB5, 0x8E, 0x73, 0x59, 0xCE,
+0x54, 0xC0, 0xFF, 0xFF, 0x02, 0xC5, 0xB9, 0xC6, 0x49, 0x3C, 0x4C, 0xAD, 0x10, 0xDE, 0x9C, 0xFF,
+0xFF, 0xFF, 0x00, 0xCB, 0x7A, 0xFF, 0x0C, 0xC5, 0x45, 0x2A, 0xA5, 0x19, 0xE6, 0x21, 0xB0, 0x5B,
+0xB5, 0x84, 0xF9, 0xAD, 0x16, 0x8D, 0xA9, 0x3A, 0x2D, 0xB5, 0xAE, 0xDD, 0x82, 0xBE, 0xAF, 0x95,
+0x44, 0xAF, 0xA6, 0x00, 0xC7, 0xB0, 0xD5, 0x2A, 0x84, 0x0D, 0x43, 0x35, 0x85, 0x6A, 0x33, 0xD4,
+0x7C, 0xE9, 0x42, 0x4E, 0xC5, 0x44, 0x00, 0xA6, 0x7C, 0x00, 0x7F, 0x7C, 0xAE, 0x7C, 0xC2, 0x8F,
+0xD5, 0xA9, 0x6B, 0x64, 0x09, 0x5E, 0xC2, 0x06, 0x2A, 0xEB, 0x5A, 0x6B, 0x7B, 0xAE, 0xC0, 0x8D,
+0x6B, 0x8A, 0xC3, 0x26, 0x2A, 0x64, 0x11, 0x86, 0x22, 0xE6, 0x22, 0xA6, 0xC3, 0x66, 0x22, 0xE7,
+0x2A, 0x09, 0x34, 0x28, 0x2B, 0xA6, 0x71, 0xC1, 0x07, 0x23, 0x68, 0x2B, 0x00, 0xA1, 0xC2, 0xC8,
+0x33, 0x07, 0x2B, 0x68, 0x33, 0x60, 0x64, 0xC0, 0xC9, 0x2B, 0x4E, 0x7F, 0xC0, 0xE9, 0x33, 0x75,
+0xC0, 0xA9, 0x33, 0x9D, 0xC2, 0xC7, 0x22, 0x2A, 0x34, 0x47, 0x2B, 0x59, 0x5E, 0x66, 0x63, 0xC0,
+0xE5, 0x21, 0xA2, 0xC4, 0x6C, 0x5B, 0x0B, 0x4B, 0x23, 0x11, 0x26, 0x2A, 0x49, 0x33, 0x6E, 0xAF,
+0x62, 0xC5, 0xE7, 0x22, 0x87, 0x2B, 0xC6, 0x22, 0xE6, 0x19, 0xC7, 0x4A, 0x2E, 0xCD, 0xBA, 0x00,
+0x92, 0x7A, 0xA9, 0xA6, 0xC9, 0xCC, 0xB4, 0x32, 0x85, 0x9B, 0xBE, 0x14, 0x7D, 0xB7, 0x9D, 0x55,
+0x7D, 0x9A, 0xB6, 0x39, 0xA6, 0xD8, 0xA5, 0x88, 0x2A, 0x55, 0x63, 0x66, 0x5E, 0xC4, 0x87, 0x3A,
+0x8F, 0xC5, 0xE4, 0x61, 0x62, 0x49, 0x0C, 0xBD, 0x79, 0x4A, 0xC0, 0xF0, 0x6B, 0x59, 0xBE, 0x00,
+0x66, 0x63, 0x02, 0xC4, 0xE4, 0x19, 0x05, 0x23, 0x46, 0x23, 0x33, 0x95, 0xB6, 0xC5, 0x9E, 0xC1,
+0x7D, 0xEF, 0xFF, 0xFF, 0x2A, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x0E, 0xC4, 0x3C, 0xEF, 0x2C, 0x6B,
+0x14, 0xA5, 0x3C, 0xE7, 0xF7, 0xC5, 0x92, 0x5C, 0xC0, 0xD3, 0x9C, 0x71, 0xC2, 0x92, 0x94, 0x79,
+0xCE, 0x71, 0x8C, 0x71, 0xC0, 0x75, 0xAD, 0x00, 0xC0, 0xB2, 0x94, 0x71, 0xC1, 0x5D, 0xEF, 0x51,
+0x8C, 0x00, 0x59, 0xC0, 0xF7, 0xBD, 0xBF, 0xC1, 0xFC, 0xE6, 0xF4, 0xA4, 0x71, 0x59, 0x71, 0x02,
+0xC4, 0xB8, 0xBE, 0x29, 0x34, 0x0C, 0x9D, 0xAF, 0xDD, 0xBD, 0xFF, 0x71, 0x00, 0xCB, 0x17, 0xF7,
+0xEC, 0xBC, 0x45, 0x2A, 0xA5, 0x11, 0xE6, 0x21, 0x57, 0x95, 0x8F, 0x5B, 0x36, 0x95, 0x98, 0xA5,
+0xEA, 0x42, 0x0D, 0xB5, 0x8E, 0xDD, 0x95, 0xAB, 0xAF, 0x95, 0xAE, 0x53, 0xA6, 0x53, 0x5B, 0xC6,
+0x4A, 0x8C, 0x36, 0x8D, 0xF0, 0x63, 0x2E, 0x54, 0xB3, 0x74, 0x26, 0x32, 0x2E, 0xC5, 0xBF, 0xAE,
+0x44, 0x00, 0x46, 0xA9, 0x9A, 0x46, 0x7C, 0xC2, 0x8F, 0xCD, 0xA9, 0x6B, 0x63, 0x09, 0x66, 0x9A,
+0xC1, 0x43, 0x11, 0xA6, 0x21, 0xAE, 0x4D, 0xC2, 0xA7, 0x22, 0x68, 0x2B, 0x25, 0x1A, 0xBF, 0xC5,
+0x49, 0x33, 0xA7, 0x32, 0xE7, 0x32, 0x86, 0x2A, 0x27, 0x2B, 0x45, 0x1A, 0xBA, 0xC2, 0x07, 0x2B,
+0x66, 0x2A, 0x28, 0x33, 0x78, 0x58, 0xC2, 0x06, 0x2B, 0x04, 0x1A, 0x65, 0x1A, 0x64, 0x75, 0xC0,
+0x07, 0x33, 0x58, 0x75, 0xC1, 0xC7, 0x2A, 0x46, 0x2A, 0x76, 0x7B, 0xC2, 0x87, 0x32, 0x0A, 0x3C,
+0x66, 0x22, 0x61, 0x00, 0xAE, 0x63, 0xBF, 0xA9, 0xC2, 0x67, 0x2B, 0x49, 0x34, 0x05, 0x1A, 0x50,
+0xC2, 0xE8, 0x33, 0x85, 0x22, 0xE6, 0x2A, 0x65, 0x41, 0x7C, 0xC3, 0xA6, 0x22, 0x28, 0x23, 0xA7,
+0x42, 0xCC, 0xB4, 0x5C, 0xA6, 0x92, 0xBE, 0x54, 0x00, 0x86, 0xC1, 0xF2, 0x7C, 0x3A, 0xAE, 0xA1,
+0xC3, 0x7A, 0xBE, 0xD2, 0x6C, 0x95, 0x85, 0xF7, 0x95, 0x6A, 0xC2, 0x29, 0x33, 0xA8, 0x2B, 0xE5,
+0x19, 0x66, 0x5E, 0xC2, 0x66, 0x32, 0xEC, 0xC4, 0xA3, 0x49, 0xBF, 0xC4, 0x8F, 0xD5, 0xA8, 0x42,
+0xB8, 0xA5, 0xF1, 0x6B, 0x63, 0x11, 0x61, 0x05, 0x6B, 0x64, 0xC5, 0x47, 0x2B, 0x33, 0x9D, 0x14,
+0xAD, 0x0B, 0x63, 0xF2, 0x9C, 0xDF, 0xFF, 0xAE, 0x29, 0x70, 0x00, 0x71, 0x0E, 0xC1, 0x1C, 0xE7,
+0x30, 0x8C, 0x71, 0x00, 0xC0, 0xB6, 0xBD, 0x96, 0xC3, 0x7D, 0xEF, 0x10, 0x84, 0x5D, 0xEF, 0xEF,
+0x7B, 0x49, 0x40, 0xC1, 0xBA, 0xD6, 0xEF, 0x83, 0x78, 0xC4, 0x92, 0x94, 0xFF, 0xFF, 0xD7, 0xBD,
+0x14, 0xA5, 0x79, 0xCE, 0x40, 0x4C, 0x00, 0xC2, 0xDB, 0xDE, 0xD3, 0x9C, 0xBE, 0xFF, 0x48, 0x71,
+0x02, 0xC5, 0xB8, 0xBE, 0x29, 0x2C, 0x6A, 0x64, 0x2D, 0xCD, 0x54, 0xE6, 0x59, 0xF7, 0xA0, 0xC2,
+0xAF, 0xDD, 0x27, 0x63, 0x67, 0x22, 0xBF, 0xC1, 0xCA, 0x3A, 0x36, 0x95, 0x56, 0x91, 0xC3, 0xD1,
+0x63, 0x06, 0x22, 0x89, 0x6B, 0xE9, 0x7B, 0x96, 0xBB, 0x00, 0x96, 0xAE, 0xBE, 0x46, 0x00, 0x49,
+0xC6, 0xE8, 0x4A, 0x31, 0x6C, 0xCF, 0x5B, 0x89, 0x2A, 0x4A, 0x33, 0x07, 0x2B, 0xA9, 0x6B, 0xBF,
+0x4E, 0x00, 0x46, 0x49, 0x41, 0x46, 0x00, 0x41, 0x46, 0xC2, 0xA6, 0x3A, 0x83, 0x11, 0xA5, 0x19,
+0x00, 0xC1, 0x05, 0x1A, 0xE7, 0x2A, 0x91, 0xAF, 0xC1, 0x88, 0x2B, 0x8B, 0x3C, 0x7D, 0xC2, 0x4C,
+0x5B, 0xF8, 0xC5, 0x8E, 0xA4, 0xA9, 0xC2, 0x95, 0xB5, 0xAE, 0x6B, 0x06, 0x22, 0x61, 0xC3, 0xD4,
+0x9C, 0x94, 0xB5, 0xCA, 0x83, 0x54, 0xB5, 0x43, 0xC2, 0xAD, 0x63, 0x25, 0x1A, 0xC4, 0x19, 0x66,
+0xC1, 0x69, 0x73, 0x6C, 0xB4, 0x81, 0xC0, 0x05, 0x32, 0x93, 0xC5, 0x55, 0xAD, 0xB0, 0xB4, 0xCB,
+0xA3, 0xB0, 0xAC, 0x92, 0x8C, 0x47, 0x2A, 0x99, 0x7C, 0x66, 0x00, 0xAF, 0xA9, 0xC1, 0xA7, 0x2A,
+0x69, 0x33, 0x5A, 0xA2, 0x7C, 0xC0, 0xA4, 0x11, 0x6B, 0xAE, 0x66, 0xC1, 0xE5, 0x19, 0x47, 0x2B,
+0x00, 0x70, 0xC0, 0x25, 0x2A, 0xA6, 0x00, 0xA9, 0x42, 0x02, 0xC0, 0xAA, 0x3A, 0x6F, 0xC1, 0x8C,
+0x43, 0x2B, 0x3B, 0xAE, 0xC4, 0xEC, 0x3B, 0xED, 0x4B, 0x8D, 0x53, 0xA6, 0x22, 0x09, 0x34, 0x77,
+0x61, 0x66, 0x6B, 0xC7, 0xCA, 0x8B, 0xEA, 0xAB, 0x6B, 0xB4, 0x8C, 0x9C, 0xC6, 0x21, 0xD8, 0xAD,
+0x11, 0x74, 0x64, 0x11, 0xBF, 0x61, 0x02, 0x6D, 0x61, 0x77, 0xC0, 0xC6, 0x22, 0x7D, 0xC0, 0x34,
+0x9D, 0xB1, 0xC2, 0x68, 0x4A, 0x70, 0x94, 0xDE, 0xFF, 0xAF, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x0E, 0xC1, 0x5D, 0xEF, 0x55, 0xAD, 0x71, 0x00, 0xC0, 0x79, 0xD6, 0x92, 0x71, 0x64, 0xC1, 0x6D,
+0x73, 0xB6, 0xBD, 0x71, 0xC3, 0x9A, 0xD6, 0x71, 0x94, 0x8E, 0x73, 0xF7, 0xC5, 0x81, 0x71, 0xC1,
+0x7D, 0xEF, 0x10, 0x84, 0xAE, 0xC0, 0x75, 0xAD, 0x48, 0x00, 0xC1, 0x3C, 0xE7, 0xD7, 0xBD, 0x6C,
+0xC0, 0x75, 0xB5, 0x71, 0x02, 0xC1, 0xB8, 0xC6, 0x49, 0x34, 0xA1, 0xC6, 0x09, 0x6C, 0xAB, 0xAC,
+0x2C, 0xC5, 0xCB, 0xB4, 0x47, 0x63, 0x25, 0x22, 0x09, 0x3B, 0x9D, 0x73, 0x5E, 0x68, 0x9A, 0x00,
+0x6D, 0x5E, 0x02, 0xA9, 0xA6, 0x59, 0x00, 0x5E, 0x52, 0x5E, 0x01, 0x42, 0xC0, 0x25, 0x3A, 0x6B,
+0xC0, 0x07, 0x23, 0xA6, 0xA5, 0x00, 0xAB, 0xA6, 0x01, 0x5F, 0x00, 0x64, 0x6B, 0xBA, 0xAF, 0x00,
+0xAE, 0xC1, 0x48, 0x2B, 0x45, 0x22, 0x77, 0xA1, 0xC0, 0xE4, 0x19, 0x5F, 0xC3, 0x04, 0x1A, 0xA9,
+0x42, 0xAF, 0x7B, 0xED, 0x93, 0xA4, 0xDA, 0x10, 0x8C, 0x51, 0x84, 0x46, 0x2A, 0xC5, 0x19, 0x71,
+0x84, 0xF2, 0xA4, 0xAB, 0x8B, 0xB2, 0xA4, 0x97, 0xB5, 0xB1, 0x84, 0xA5, 0x1A, 0x07, 0x23, 0x48,
+0x43, 0x0D, 0xC5, 0xAD, 0xBC, 0x2E, 0xCD, 0xA9, 0x7B, 0xC5, 0x21, 0x75, 0xAD, 0x32, 0xC5, 0x0B,
+0xB4, 0xAF, 0xAC, 0xF8, 0xBD, 0x6C, 0x53, 0x66, 0x22, 0x07, 0x2B, 0x87, 0x22, 0x66, 0x57, 0xA6,
+0xC1, 0x47, 0x3A, 0x50, 0x7C, 0xA6, 0xC0, 0x2B, 0x53, 0x63, 0x5E, 0x66, 0x55, 0x61, 0xC0, 0xC4,
+0x19, 0x70, 0x63, 0xC1, 0x05, 0x22, 0xA6, 0x52, 0xAB, 0xA6, 0x78, 0x02, 0x96, 0x72, 0xC0, 0x6C,
+0x4B, 0x84, 0xC4, 0xC8, 0x2A, 0xF1, 0x64, 0x2E, 0x54, 0x04, 0x1A, 0x65, 0x1A, 0x57, 0x5F, 0x92,
+0xC0, 0x84, 0x11, 0x66, 0x00, 0xBE, 0xC0, 0x08, 0x5B, 0xAD, 0xC0, 0xE4, 0x21, 0x6D, 0xC1, 0x8E,
+0x5B, 0xAA, 0x42, 0x6D, 0x04, 0x72, 0xBA, 0x7F, 0xC6, 0xC6, 0x2A, 0x27, 0x2B, 0x33, 0x9D, 0xF4,
+0xAC, 0x69, 0x4A, 0x70, 0x8C, 0xDF, 0xFF, 0xAE, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x19, 0xC3,
+0xBA, 0xDE, 0x96, 0xB5, 0xCF, 0x7B, 0x5D, 0xEF, 0x71, 0x0D, 0xA6, 0xC1, 0xD9, 0xC6, 0x69, 0x34,
+0x7B, 0xC9, 0x67, 0x2B, 0xA5, 0x2A, 0xC5, 0x3A, 0x65, 0x2A, 0xE4, 0x19, 0x06, 0x22, 0x88, 0x2A,
+0xC9, 0x3B, 0x47, 0x2B, 0xA4, 0x19, 0x00, 0x6D, 0x00, 0x72, 0x00, 0x6D, 0x66, 0x6D, 0x66, 0x04,
+0x6D, 0x9A, 0xC1, 0x29, 0x5B, 0xEC, 0xB4, 0xBB, 0xC0, 0xCA, 0x8B, 0x73, 0x77, 0xAD, 0xAB, 0x00,
+0x70, 0x7C, 0x70, 0x75, 0x7C, 0x75, 0x01, 0x77, 0x75, 0x00, 0xA2, 0xC0, 0x27, 0x22, 0xAD, 0x5F,
+0x55, 0x50, 0xC3, 0x08, 0x2B, 0x86, 0x22, 0x43, 0x11, 0xEA, 0x42, 0xA1, 0xC2, 0x63, 0x19, 0x08,
+0x33, 0x86, 0x2A, 0x77, 0xC2, 0xE7, 0x22, 0x26, 0x2A, 0xEB, 0x4A, 0x5A, 0xC0, 0x87, 0x32, 0xA7,
+0x77, 0xC3, 0x45, 0x1A, 0xC6, 0x2A, 0x8C, 0x9C, 0x0E, 0xC5, 0x00, 0xC7, 0x68, 0x63, 0x07, 0x2B,
+0xC8, 0x3A, 0x46, 0x4A, 0xA7, 0x5A, 0x26, 0x4A, 0x8A, 0x4A, 0xC5, 0x21, 0x66, 0xC1, 0x25, 0x1A,
+0x68, 0x2B, 0x61, 0x6D, 0xC2, 0x02, 0x09, 0x89, 0x4A, 0xF4, 0xAC, 0xAF, 0xC1, 0x8E, 0x6B, 0x64,
+0x11, 0x4D, 0x7C, 0xC0, 0xC9, 0x33, 0xA1, 0xC0, 0xE4, 0x19, 0x92, 0xAF, 0xC1, 0x48, 0x53, 0x0D,
+0xCD, 0x01, 0xA6, 0x6E, 0x01, 0x82, 0xC3, 0xEE, 0x63, 0xD9, 0xA5, 0x3A, 0xAE, 0x9B, 0xC6, 0x6A,
+0xC6, 0x36, 0x8D, 0x29, 0x33, 0xA6, 0x22, 0x84, 0x19, 0xA7, 0x42, 0xC9, 0x63, 0xE5, 0x21, 0x63,
+0x6D, 0x00, 0x95, 0x63, 0x5E, 0xC0, 0x66, 0x32, 0x4F, 0xC0, 0xEB, 0x9B, 0xAE, 0x95, 0x61, 0x66,
+0x61, 0x57, 0xAB, 0x57, 0x00, 0xC1, 0xAB, 0xA4, 0xC9, 0x4B, 0x4B, 0xC3, 0x14, 0xAD, 0x68, 0x4A,
+0x70, 0x94, 0xDE, 0xFF, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x19, 0xC2, 0x1C, 0xE7, 0x55,
+0xAD, 0xFB, 0xDE, 0x71, 0x0F, 0xC1, 0xD8, 0xC6, 0x68, 0x34, 0xA6, 0x78, 0x77, 0xA6, 0x77, 0x72,
+0xAF, 0xBA, 0xC2, 0x28, 0x33, 0x65, 0x22, 0x84, 0x19, 0x6D, 0x00, 0x72, 0xAB, 0x41, 0x00, 0x6D,
+0x01, 0xA9, 0x02, 0x6D, 0x00, 0xC6, 0x05, 0x22, 0x2E, 0xB5, 0x6E, 0xCD, 0x0E, 0xC5, 0x6F, 0xD5,
+0x28, 0x5B, 0x64, 0x09, 0x61, 0x00, 0x9A, 0x00, 0x66, 0x01, 0x61, 0x00, 0xA6, 0x5E, 0x00, 0x59,
+0x5E, 0x61, 0x50, 0xC0, 0xC6, 0x22, 0xAE, 0xC0, 0x86, 0x1A, 0xBA, 0xA5, 0x63, 0x50, 0x78, 0xC3,
+0xA3, 0x11, 0x66, 0x22, 0xE9, 0x33, 0x47, 0x2B, 0x63, 0x64, 0xC5, 0x25, 0x1A, 0xC7, 0x22, 0x26,
+0x23, 0x85, 0x22, 0x68, 0x2B, 0x08, 0x2B, 0xA5, 0x42, 0xC2, 0xC6, 0x3A, 0x68, 0x73, 0x07, 0x5B,
+0x73, 0xC1, 0x2A, 0x34, 0xA5, 0x22, 0x55, 0xC0, 0x06, 0x23, 0x41, 0xC0, 0x07, 0x23, 0xA6, 0xC0,
+0x28, 0x2B, 0x62, 0x6E, 0x62, 0xC3, 0xC7, 0x2A, 0x23, 0x11, 0xA6, 0x29, 0xCC, 0x62, 0xAF, 0xC1,
+0x49, 0x4A, 0x65, 0x19, 0xA9, 0x99, 0xC0, 0xE6, 0x22, 0x5F, 0xC0, 0xA4, 0x11, 0x50, 0x44, 0xC1,
+0x2A, 0x54, 0xAC, 0xBC, 0xAF, 0xA9, 0x96, 0x57, 0x01, 0x9B, 0xD0, 0x50, 0x74, 0x1A, 0xB6, 0x9C,
+0xBE, 0x3E, 0xDF, 0xBC, 0xCE, 0xD8, 0x95, 0x8E, 0x4C, 0x04, 0x12, 0xC7, 0x52, 0xED, 0xC4, 0x2E,
+0xD5, 0x2B, 0x9C, 0xE5, 0x21, 0xA9, 0x3A, 0x97, 0x9D, 0xCB, 0x42, 0x84, 0x11, 0x6F, 0xC1, 0xE7,
+0x42, 0x2E, 0xCD, 0xBE, 0x02, 0xBB, 0x42, 0xC0, 0x8E, 0xDD, 0xAB, 0x95, 0xA1, 0xC6, 0xD0, 0xDD,
+0x4B, 0x64, 0x54, 0x9D, 0x35, 0xB5, 0x68, 0x4A, 0x71, 0x94, 0xDF, 0xFF, 0xAE, 0x29, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x2D, 0xC1, 0xD8, 0xBE, 0x48, 0x34, 0xA6, 0x69, 0xC0, 0xC5, 0x19, 0x77, 0x72,
+0x01, 0xA6, 0x6E, 0xC0, 0x25, 0x22, 0x61, 0x6D, 0x00, 0x72, 0xC1, 0x07, 0x22, 0xA9, 0x32, 0x95,
+0x7E, 0x61, 0xAE, 0x6D, 0x00, 0x66, 0x61, 0x6D, 0x00, 0x77, 0xC1, 0xED, 0xA4, 0x4F, 0xCD, 0x91,
+0xAD, 0xC0, 0xA6, 0x42, 0x5E, 0x66, 0x97, 0x5E, 0x61, 0x66, 0x01, 0x61, 0x02, 0x59, 0x61, 0x01,
+0xC3, 0xC4, 0x19, 0xE7, 0x4A, 0x48, 0x6B, 0xA7, 0x4A, 0x66, 0x5E, 0x50, 0xC1, 0x48, 0x2B, 0x05,
+0x1A, 0x6B, 0xC1, 0x45, 0x1A, 0xA8, 0x2B, 0x64, 0xC1, 0xC4, 0x11, 0x08, 0x2B, 0x46, 0xC0, 0x67,
+0x2B, 0x69, 0xC1, 0x65, 0x22, 0x68, 0x2B, 0x64, 0xC0, 0xC9, 0x2B, 0x90, 0x68, 0x63, 0x5E, 0xC1,
+0x86, 0x1A, 0xA7, 0x23, 0x46, 0x69, 0x58, 0x73, 0xC1, 0x47, 0x2B, 0x85, 0x1A, 0x5F, 0xC0, 0x27,
+0x2B, 0x7C, 0xC4, 0xC9, 0x33, 0x28, 0x33, 0x84, 0x19, 0x8F, 0x63, 0xCC, 0x5A, 0x00, 0xC0, 0x4A,
+0x4A, 0x48, 0x00, 0xC0, 0x64, 0x11, 0x01, 0xAD, 0x73, 0xC0, 0x09, 0x34, 0x5F, 0xC0, 0xE4, 0x29,
+0xAF, 0xAE, 0x42, 0x47, 0x42, 0x01, 0x9B, 0xC5, 0xD0, 0x63, 0x6E, 0x53, 0xCD, 0x4B, 0xF3, 0x7C,
+0xB1, 0x64, 0x69, 0x33, 0x6B, 0xCB, 0x6B, 0xA4, 0x4E, 0xD5, 0xED, 0xCC, 0xCF, 0xDD, 0x69, 0x63,
+0x2C, 0x4B, 0x1B, 0xAE, 0xD6, 0x84, 0xB2, 0x74, 0x0E, 0x54, 0x48, 0x43, 0xED, 0xC4, 0xBF, 0x42,
+0x95, 0xAE, 0xB7, 0xC1, 0xAD, 0xBC, 0x49, 0x7B, 0xBA, 0xC4, 0x8A, 0x8B, 0xCA, 0x9B, 0xAF, 0xDD,
+0x4B, 0x6C, 0x75, 0xA5, 0x62, 0xC2, 0x48, 0x4A, 0x51, 0x8C, 0xDF, 0xFF, 0xAE, 0x29, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x1C, 0xC2, 0xBA, 0xD6, 0xD7, 0xBD, 0x5D, 0xEF, 0x6C, 0xC0, 0x3C, 0xE7, 0x71,
+0x91, 0xA6, 0x5D, 0xC0, 0x79, 0xCE, 0x4D, 0x71, 0x04, 0xC1, 0x98, 0xBE, 0x68, 0x34, 0x6F, 0xC4,
+0x67, 0x33, 0x26, 0x4B, 0x67, 0x53, 0x06, 0x4B, 0x25, 0x22, 0x77, 0xA6, 0xC2, 0xE7, 0x2A, 0x45,
+0x22, 0x84, 0x19, 0xAF, 0x72, 0xAB, 0xC4, 0x07, 0x22, 0x6A, 0x3B, 0x0A, 0x34, 0x86, 0x22, 0x84,
+0x11, 0x6D, 0x01, 0xA9, 0x01, 0x6D, 0x99, 0xC1, 0x87, 0x3A, 0xCD, 0xA4, 0xA9, 0xC0, 0x07, 0x5B,
+0x5E, 0x63, 0x00, 0x5E, 0x07, 0x61, 0xAB, 0x61, 0x5E, 0x63, 0xC1, 0x08, 0x53, 0xED, 0xBC, 0xBF,
+0x96, 0xC7, 0xE8, 0x52, 0xEA, 0x4A, 0x74, 0x9D, 0x4E, 0x8C, 0x8B, 0x7B, 0x4F, 0x84, 0x6D, 0x63,
+0xA8, 0x3A, 0x00, 0xC5, 0x50, 0x84, 0x4D, 0x84, 0xEC, 0x7B, 0x0F, 0x74, 0x8E, 0x63, 0x47, 0x2A,
+0xBB, 0xC2, 0xEE, 0x6B, 0x6E, 0x7C, 0x8B, 0x6B, 0x46, 0x96, 0xC4, 0x06, 0x22, 0xA9, 0x42, 0xD2,
+0x8C, 0x0E, 0x84, 0xCB, 0x7B, 0x43, 0xC4, 0x4C, 0x53, 0x06, 0x2A, 0x0B, 0x4B, 0x34, 0xAD, 0xCC,
+0x8B, 0x90, 0xC4, 0xF2, 0xA4, 0xEC, 0x52, 0x24, 0x19, 0x4E, 0x63, 0xAB, 0x5A, 0x96, 0xC1, 0x28,
+0x42, 0x23, 0x11, 0x00, 0xC2, 0x63, 0x11, 0xC5, 0x19, 0x46, 0x22, 0xAE, 0xC0, 0xC6, 0x22, 0x91,
+0xC1, 0x05, 0x22, 0x67, 0x4A, 0xAE, 0x00, 0xA9, 0x70, 0x69, 0xA6, 0x99, 0xC1, 0xC4, 0x19, 0xCA,
+0x3A, 0x7A, 0xC3, 0xE7, 0x2A, 0x49, 0x2B, 0xC8, 0x2A, 0xA4, 0x11, 0x00, 0xC1, 0x0A, 0x84, 0x6E,
+0xDD, 0x92, 0xC9, 0xCF, 0xDD, 0x48, 0x5B, 0xCB, 0x3A, 0x5B, 0xB6, 0x13, 0x75, 0x6D, 0x4B, 0x49,
+0x32, 0x66, 0x32, 0x0D, 0xC5, 0x4E, 0xD5, 0x00, 0x95, 0xAE, 0x42, 0x00, 0xCB, 0x89, 0x8B, 0xE3,
+0x20, 0x83, 0x10, 0x26, 0x5A, 0xAF, 0xD5, 0x8B, 0x6C, 0x95, 0xAD, 0x35, 0xB5, 0x48, 0x52, 0x4F,
+0x8C, 0xBE, 0xF7, 0xFF, 0xFF, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC2, 0x96, 0xB5, 0xAE,
+0x73, 0xD3, 0x9C, 0x91, 0xC4, 0x1C, 0xE7, 0x08, 0x42, 0x3C, 0xE7, 0x79, 0xCE, 0x75, 0xAD, 0x4C,
+0xC3, 0x4D, 0x6B, 0x30, 0x84, 0xCF, 0x7B, 0x9E, 0xF7, 0x71, 0x02, 0xC5, 0x97, 0xB6, 0x28, 0x2C,
+0x48, 0x3C, 0xA9, 0x8C, 0x6A, 0xAC, 0xEC, 0xB4, 0xA5, 0xC3, 0xC8, 0x83, 0x65, 0x2A, 0xE6, 0x19,
+0xE8, 0x2A, 0x41, 0x72, 0x6D, 0xC0, 0xE5, 0x19, 0x7E, 0x77, 0xC2, 0x86, 0x22, 0x26, 0x2B, 0x04,
+0x1A, 0x72, 0xBA, 0x72, 0x75, 0xAE, 0x01, 0x77, 0x72, 0xC3, 0x26, 0x22, 0x28, 0x2B, 0xE4, 0x19,
+0x85, 0x11, 0x66, 0x72, 0x05, 0x6D, 0x75, 0x00, 0x72, 0x00, 0x6D, 0x72, 0xC3, 0x87, 0x2A, 0x08,
+0x23, 0x4B, 0x7C, 0x0E, 0xC5, 0x95, 0x72, 0xC7, 0xEB, 0x83, 0xCD, 0x6B, 0x15, 0xAD, 0xB0, 0xAC,
+0x2C, 0xA4, 0xF3, 0xAC, 0x92, 0x94, 0x6B, 0x53, 0xA6, 0xC1, 0x56, 0xB5, 0x4D, 0xB4, 0x9E, 0xC0,
+0x75, 0xB5, 0x68, 0xD6, 0x47, 0x32, 0x2C, 0x53, 0x59, 0xCE, 0xF0, 0xC4, 0x8D, 0xB4, 0x18, 0xCE,
+0x8E, 0x6B, 0xC5, 0x21, 0x6D, 0x63, 0xD9, 0xC5, 0x53, 0xC5, 0x4C, 0xAC, 0xB6, 0xC5, 0xAF, 0x73,
+0x48, 0x3A, 0xB2, 0x8C, 0x3A, 0xD6, 0xAF, 0xBC, 0x4B, 0xB4, 0x94, 0xC5, 0x6E, 0x6B, 0xA2, 0x08,
+0xC6, 0x31, 0x68, 0xBB, 0xC1, 0xAE, 0x7B, 0x64, 0x19, 0x48, 0x66, 0xC6, 0xC8, 0x2B, 0xA9, 0x34,
+0x49, 0x34, 0xA8, 0x33, 0x45, 0x1A, 0x86, 0x42, 0xED, 0xC4, 0xBE, 0x00, 0x91, 0xC0, 0xEE, 0xCC,
+0xAE, 0x6E, 0xC7, 0xAA, 0xB4, 0x0E, 0x64, 0xF8, 0x9D, 0x95, 0x85, 0xAE, 0x4C, 0x58, 0xA6, 0xB4,
+0x84, 0x84, 0x11, 0xA9, 0xC4, 0x25, 0x2A, 0xEA, 0x83, 0x6B, 0xA4, 0x67, 0x6B, 0xC4, 0x19, 0x7E,
+0xC2, 0x2D, 0x54, 0x66, 0x22, 0x22, 0x09, 0xAB, 0x6B, 0xC0, 0xA6, 0x42, 0xBA, 0xBF, 0x9A, 0x6E,
+0xAE, 0x6E, 0xBE, 0xCA, 0xC4, 0x29, 0xC3, 0x18, 0x23, 0x19, 0xE5, 0x39, 0x86, 0x3A, 0x33, 0xA5,
+0x76, 0xBD, 0x68, 0x52, 0x4F, 0x8C, 0xBE, 0xFF, 0xFF, 0xFF, 0x04, 0xC1, 0x7D, 0xF7, 0x1B, 0xEF,
+0x0F, 0xC0, 0x5C, 0xF7, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A, 0x91, 0xC1, 0x8E, 0x73,
+0x9E, 0xF7, 0x71, 0x00, 0xC5, 0x1C, 0xE7, 0xCB, 0x5A, 0x14, 0xA5, 0x7A, 0xD6, 0x55, 0xAD, 0xB6,
+0xB5, 0xBA, 0x71, 0xC0, 0xF3, 0x9C, 0x64, 0x71, 0x02, 0xC5, 0x97, 0xB6, 0x28, 0x2C, 0x0A, 0x85,
+0x0C, 0xC5, 0x33, 0xDE, 0x7C, 0xF7, 0x90, 0xC1, 0xB0, 0xD5, 0x67, 0x73, 0x77, 0xC0, 0xE8, 0x2A,
+0xBB, 0xC4, 0x76, 0x95, 0xCF, 0x5B, 0x52, 0x74, 0xD4, 0x84, 0x67, 0x2A, 0x51, 0xC0, 0x2B, 0x9C,
+0x99, 0xAB, 0x6B, 0x61, 0x68, 0xBF, 0x96, 0x00, 0xC7, 0x6C, 0x9C, 0x49, 0x63, 0x35, 0x85, 0xD3,
+0x74, 0xF0, 0x63, 0xF4, 0x84, 0x87, 0x32, 0x0B, 0x8C, 0xBA, 0xAB, 0x63, 0x60, 0x00, 0xAB, 0xA6,
+0x63, 0xA6, 0x63, 0xC8, 0x28, 0x4B, 0xC8, 0x2A, 0x69, 0x33, 0xE7, 0x2A, 0x04, 0x12, 0xE7, 0x42,
+0xED, 0xB4, 0x2D, 0xC5, 0xCC, 0xB4, 0x6E, 0xC3, 0x84, 0x11, 0xA5, 0x21, 0x07, 0x3A, 0xEA, 0x52,
+0x5F, 0xC4, 0x09, 0x3B, 0x67, 0x32, 0xA5, 0x19, 0xE6, 0x29, 0xC9, 0x52, 0x00, 0x62, 0xC5, 0x09,
+0x43, 0x26, 0x2A, 0xC5, 0x19, 0x69, 0x42, 0xEA, 0x62, 0x29, 0x63, 0x8B, 0xC1, 0x88, 0x42, 0xE5,
+0x21, 0x72, 0xC1, 0xC9, 0x3A, 0xCA, 0x5A, 0xAD, 0xC0, 0x48, 0x42, 0x96, 0xC0, 0xC5, 0x21, 0xAB,
+0xC3, 0x69, 0x4A, 0xA8, 0x6A, 0xE9, 0x72, 0x27, 0x52, 0x62, 0xC2, 0x44, 0x19, 0x85, 0x29, 0x0C,
+0x63, 0x91, 0xC1, 0xED, 0x6B, 0x68, 0x33, 0x81, 0xC3, 0x87, 0x2B, 0xC9, 0x34, 0xA7, 0x2B, 0x06,
+0x23, 0xBF, 0xC2, 0xE4, 0x11, 0x66, 0x3A, 0xCC, 0xBC, 0xBE, 0xAE, 0xC0, 0xAC, 0xB4, 0x57, 0xBF,
+0x5F, 0xC7, 0x6A, 0xAC, 0x90, 0x7C, 0x15, 0x85, 0xB7, 0x8D, 0xF2, 0x6C, 0xDC, 0xC6, 0x73, 0x84,
+0x64, 0x11, 0xAE, 0x00, 0xA9, 0xBF, 0x91, 0x66, 0xC5, 0x07, 0x2B, 0x45, 0x1A, 0x27, 0x2A, 0x69,
+0x32, 0x0C, 0x43, 0x6D, 0x53, 0x86, 0xBA, 0x59, 0x00, 0xC0, 0x48, 0x2A, 0xA6, 0xC0, 0xEC, 0x42,
+0x96, 0xC0, 0x2C, 0x4B, 0xA2, 0xC0, 0xAE, 0x5B, 0x99, 0xC5, 0xC5, 0x21, 0x49, 0x4A, 0xCB, 0x62,
+0x27, 0x42, 0x70, 0x8C, 0xDF, 0xFF, 0x71, 0x03, 0xC1, 0xDA, 0xE6, 0xB4, 0xCD, 0x01, 0xAB, 0xC0,
+0xF5, 0xD5, 0xA6, 0x78, 0x0B, 0xC0, 0x78, 0xDE, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A,
+0xC1, 0x1C, 0xE7, 0x10, 0x84, 0x71, 0xC3, 0x18, 0xC6, 0x55, 0xAD, 0xBA, 0xD6, 0xB2, 0x94, 0xA1,
+0xC0, 0x96, 0xB5, 0xA5, 0xC0, 0xB7, 0xBD, 0x78, 0x71, 0xC1, 0x9A, 0xD6, 0x71, 0x8C, 0x71, 0x02,
+0xC5, 0x77, 0xB6, 0x48, 0x3C, 0x4C, 0xAD, 0x10, 0xDE, 0xBD, 0xFF, 0xFF, 0xFF, 0x00, 0xC3, 0x18,
+0xEF, 0x69, 0xAC, 0x46, 0x2A, 0x09, 0x33, 0xB7, 0xC2, 0x32, 0x6C, 0xB2, 0x6C, 0x39, 0xAE, 0xB7,
+0xC2, 0xA8, 0x3A, 0xEC, 0xB4, 0x6E, 0xD5, 0x95, 0xAE, 0x00, 0x92, 0xAB, 0xBE, 0xA6, 0xAB, 0xBE,
+0xC2, 0xCA, 0x83, 0xCF, 0x53, 0xF8, 0x9D, 0xA6, 0xBB, 0xC1, 0xE9, 0x4A, 0xED, 0xBC, 0xBF, 0x77,
+0x00, 0x9A, 0xA5, 0xAB, 0x00, 0x72, 0x00, 0x7F, 0xC1, 0xC9, 0x63, 0xC9, 0x2B, 0xA9, 0x46, 0xC0,
+0xA7, 0x22, 0xA1, 0xC3, 0xC7, 0x42, 0xA8, 0x63, 0xE7, 0x42, 0x05, 0x1A, 0xA6, 0xC5, 0x63, 0x11,
+0xA4, 0x19, 0x08, 0x2B, 0x87, 0x23, 0xE6, 0x22, 0x68, 0x33, 0x73, 0x92, 0xC1, 0x28, 0x2B, 0x46,
+0x1A, 0x69, 0xC2, 0x26, 0x23, 0x86, 0x22, 0xE7, 0x22, 0x69, 0x70, 0x69, 0xC0, 0x65, 0x1A, 0x70,
+0xA1, 0x46, 0xC1, 0x47, 0x23, 0x66, 0x1A, 0xB2, 0xC1, 0xE7, 0x2A, 0xA4, 0x19, 0x95, 0x00, 0x7C,
+0xC0, 0x45, 0x22, 0xA3, 0xC3, 0x03, 0x11, 0x63, 0x11, 0xA4, 0x11, 0x27, 0x32, 0xA6, 0x92, 0xC1,
+0x4B, 0x4B, 0xA7, 0x2B, 0x00, 0xAE, 0x00, 0xC0, 0x25, 0x1A, 0x5F, 0xC0, 0x07, 0x2B, 0x77, 0xA5,
+0xC0, 0x05, 0x2A, 0xAE, 0x02, 0xBA, 0x47, 0xA9, 0xC1, 0xC8, 0x32, 0x34, 0x85, 0xAE, 0x49, 0xC2,
+0x30, 0x5C, 0x90, 0x64, 0xC7, 0x2A, 0x92, 0x00, 0xAE, 0x5A, 0x66, 0x44, 0x5A, 0xCA, 0x43, 0x11,
+0x92, 0x7C, 0x98, 0xA5, 0x5B, 0xBE, 0x78, 0x95, 0xD9, 0xAD, 0x7C, 0xC6, 0x28, 0x2A, 0xA5, 0x19,
+0x97, 0x9D, 0x7C, 0xBE, 0x54, 0xC3, 0x57, 0x95, 0xFA, 0xAD, 0x33, 0x6C, 0xD4, 0x84, 0x98, 0xC5,
+0xE6, 0x22, 0x34, 0x9D, 0x4D, 0x73, 0x45, 0x29, 0x48, 0x4A, 0xD6, 0xBD, 0x71, 0x02, 0xC1, 0x9E,
+0xF7, 0xD5, 0xCD, 0xA5, 0x44, 0x00, 0xC3, 0x53, 0xBD, 0x0F, 0x94, 0x90, 0xA4, 0xB5, 0xCD, 0x44,
+0x0A, 0xA1, 0xC1, 0x3B, 0xEF, 0xFF, 0xFF, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A, 0xC1, 0x5D,
+0xEF, 0xCF, 0x7B, 0x71, 0xC6, 0xDB, 0xDE, 0x8E, 0x73, 0xF7, 0xBD, 0x14, 0xA5, 0x18, 0xC6, 0x6E,
+0x73, 0xB6, 0xB5, 0xBB, 0x7D, 0x71, 0x60, 0xC0, 0xB2, 0x94, 0x71, 0x02, 0xC4, 0x57, 0xAE, 0x68,
+0x3C, 0x0B, 0xA5, 0xD1, 0xDD, 0xDF, 0xFF, 0x71, 0x00, 0xC7, 0xF7, 0xEE, 0x6A, 0xAC, 0x26, 0x2A,
+0xE8, 0x2A, 0x67, 0x2A, 0xF4, 0x84, 0xD1, 0x64, 0x97, 0x95, 0xB6, 0xC2, 0x2B, 0x4B, 0xCB, 0xB4,
+0x4D, 0xD5, 0x9A, 0xAB, 0x78, 0x72, 0xAE, 0xC0, 0x6E, 0xCD, 0x7F, 0xA6, 0xBF, 0xC1, 0xC9, 0x7B,
+0x92, 0x6C, 0x95, 0xC3, 0xF3, 0x74, 0x3A, 0xAE, 0xC9, 0x4A, 0xCD, 0xBC, 0x7A, 0x01, 0xAB, 0x80,
+0x6F, 0xBA, 0x77, 0x7A, 0x7F, 0xC6, 0xA9, 0x63, 0x06, 0x1B, 0x85, 0x1A, 0x27, 0x2B, 0x09, 0x34,
+0x67, 0x2B, 0xA5, 0x1A, 0xAB, 0xBE, 0x69, 0xC4, 0x47, 0x23, 0x65, 0x1A, 0xA4, 0x11, 0x28, 0x23,
+0xE8, 0x2B, 0x64, 0xC1, 0xE9, 0x33, 0x47, 0x2B, 0x64, 0xC1, 0xC9, 0x33, 0x45, 0x1A, 0x42, 0x7D,
+0xC2, 0x86, 0x22, 0xA8, 0x2B, 0x06, 0x23, 0xAF, 0x62, 0xC1, 0x07, 0x23, 0x87, 0x2B, 0x69, 0xA2,
+0x5D, 0x4B, 0x75, 0xC1, 0x66, 0x23, 0xE4, 0x19, 0x63, 0x00, 0xC0, 0xA5, 0x22, 0x42, 0xC1, 0xE5,
+0x19, 0x84, 0x11, 0x63, 0xAE, 0xC1, 0x47, 0x2A, 0x68, 0x3A, 0x96, 0xC1, 0xC9, 0x42, 0xC5, 0x19,
+0x63, 0x00, 0x57, 0x77, 0xC0, 0xC8, 0x33, 0x96, 0xC0, 0x25, 0x1A, 0xB6, 0xC0, 0x87, 0x42, 0xBA,
+0x01, 0xA6, 0x70, 0xA5, 0xC6, 0xE6, 0x52, 0x27, 0x33, 0x4A, 0x3B, 0xE9, 0x2A, 0x88, 0x22, 0x08,
+0x2B, 0x44, 0x1A, 0x46, 0xBB, 0xA9, 0x50, 0xAE, 0x50, 0x95, 0xC0, 0x84, 0x19, 0x92, 0xC4, 0x72,
+0x74, 0x7C, 0xBE, 0xD5, 0x8C, 0x99, 0x9D, 0x3B, 0xBE, 0x00, 0xC1, 0x08, 0x2A, 0xA5, 0x19, 0x76,
+0xC5, 0x7C, 0xC6, 0x98, 0xA5, 0x17, 0x95, 0x95, 0x84, 0x16, 0x8D, 0x11, 0x6C, 0x9C, 0xC4, 0xA5,
+0x1A, 0x70, 0x84, 0xD3, 0xA4, 0x2C, 0x6B, 0x6D, 0x73, 0x96, 0x91, 0xC4, 0x34, 0xAD, 0x9E, 0xF7,
+0xFF, 0xFF, 0x7D, 0xF7, 0xB4, 0xCD, 0xAF, 0x00, 0xC5, 0x16, 0xD6, 0x2F, 0x94, 0xAA, 0x62, 0x0B,
+0x6B, 0x8D, 0x7B, 0xF5, 0xD5, 0x96, 0x09, 0x78, 0xC0, 0xD9, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x1B, 0xC9, 0x10, 0x84, 0x96, 0xB5, 0x5D, 0xEF, 0xEF, 0x83, 0xD7, 0xBD, 0x92, 0x94,
+0xDF, 0xFF, 0x29, 0x4A, 0x14, 0xA5, 0xB6, 0xB5, 0x68, 0xC2, 0x59, 0xCE, 0x6D, 0x73, 0x9A, 0xD6,
+0x71, 0x01, 0x6C, 0xD4, 0x56, 0xAE, 0x28, 0x2C, 0xCB, 0x7C, 0x2E, 0xCD, 0xB7, 0xEE, 0x9C, 0xFF,
+0x59, 0xF7, 0x8F, 0xD5, 0x27, 0x6B, 0xE5, 0x19, 0xE8, 0x2A, 0x0A, 0x3B, 0xF9, 0xAD, 0x30, 0x64,
+0x72, 0x74, 0xF5, 0x8C, 0x68, 0x32, 0x4B, 0x8C, 0x6F, 0xB5, 0xAD, 0xA4, 0x4B, 0x9C, 0xAE, 0x02,
+0x9A, 0x00, 0x75, 0xC6, 0x48, 0x5B, 0x35, 0x8D, 0xB2, 0x74, 0x6F, 0x5C, 0x34, 0x85, 0x67, 0x32,
+0x2A, 0x8C, 0xBF, 0x03, 0xA6, 0x6D, 0x72, 0x6A, 0x6D, 0xC1, 0xC8, 0x53, 0xC6, 0x22, 0x00, 0x46,
+0x64, 0xAE, 0x64, 0x46, 0xCA, 0xE7, 0x22, 0x45, 0x22, 0x09, 0x43, 0x8B, 0x5B, 0x2A, 0x5B, 0xAC,
+0x63, 0x4F, 0x74, 0x27, 0x32, 0x85, 0x22, 0xE5, 0x22, 0x04, 0x1A, 0x69, 0xC1, 0x63, 0x11, 0xA4,
+0x19, 0x00, 0x96, 0xC1, 0x67, 0x32, 0x0A, 0x53, 0x64, 0xC3, 0x4C, 0x6C, 0xCD, 0x63, 0xA9, 0x42,
+0x25, 0x22, 0x5A, 0xC1, 0x6F, 0x6C, 0x8B, 0x73, 0x98, 0xC2, 0xAC, 0x6B, 0x69, 0x42, 0x27, 0x2A,
+0x5E, 0x63, 0xBE, 0x5E, 0x66, 0x01, 0x63, 0xA5, 0x5E, 0x00, 0x66, 0x00, 0x5E, 0x6B, 0xC0, 0xE7,
+0x2A, 0x53, 0xA7, 0xC3, 0x07, 0x23, 0x48, 0x43, 0xCD, 0xBC, 0x0D, 0xCD, 0x00, 0x96, 0xBA, 0x01,
+0x99, 0xC1, 0x86, 0x3A, 0x97, 0x9D, 0x92, 0xC2, 0xD7, 0x95, 0x6D, 0x4B, 0xC5, 0x19, 0xA1, 0xAE,
+0x96, 0xAE, 0x5E, 0x00, 0x61, 0x66, 0x91, 0xC2, 0x8A, 0x3A, 0x52, 0x74, 0x4E, 0x53, 0x52, 0xC0,
+0xD0, 0x63, 0xAF, 0xC0, 0xA6, 0x19, 0x72, 0xC0, 0xAA, 0x32, 0xBB, 0x42, 0xAF, 0x94, 0xCE, 0x8E,
+0x5B, 0x69, 0x32, 0x29, 0x33, 0xC6, 0x22, 0x2F, 0x7C, 0xD3, 0xA4, 0x0B, 0x63, 0x2F, 0x84, 0xBE,
+0xF7, 0xBA, 0xD6, 0xF0, 0x83, 0xCB, 0x5A, 0x92, 0x94, 0x79, 0xD6, 0xF5, 0xD5, 0x00, 0x96, 0x4C,
+0xC5, 0x2F, 0x94, 0x70, 0x9C, 0x36, 0xDE, 0x0B, 0x6B, 0x53, 0xBD, 0xD5, 0xD5, 0x9A, 0x08, 0xA5,
+0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC5, 0x7D, 0xEF, 0x51, 0x8C,
+0xEF, 0x83, 0x96, 0xB5, 0x5D, 0xEF, 0xF7, 0xC5, 0x71, 0x78, 0xC4, 0x38, 0xC6, 0xDB, 0xDE, 0x10,
+0x84, 0x71, 0x8C, 0x59, 0xCE, 0x71, 0x03, 0xC1, 0x76, 0xAE, 0x07, 0x2C, 0xB6, 0xC5, 0x6A, 0x7C,
+0xEC, 0xBC, 0x8F, 0xD5, 0x0D, 0xC5, 0x67, 0x6B, 0x05, 0x22, 0xAB, 0xC2, 0x08, 0x33, 0x46, 0x22,
+0xA6, 0x21, 0x99, 0xA6, 0xC0, 0xC6, 0x19, 0x6D, 0x5A, 0xC1, 0x2D, 0x4C, 0xA7, 0x2A, 0x63, 0x66,
+0xA9, 0x9A, 0x61, 0x9A, 0x63, 0x57, 0x63, 0x6D, 0x46, 0xC1, 0xA6, 0x22, 0xE6, 0x22, 0xAB, 0x72,
+0x63, 0x5E, 0x00, 0x66, 0xC0, 0xE4, 0x19, 0xAF, 0x91, 0xA9, 0x63, 0x00, 0x70, 0xC2, 0x27, 0x2B,
+0xA8, 0x2B, 0xC4, 0x19, 0x72, 0xC1, 0xC8, 0x2B, 0x08, 0x34, 0x64, 0xCB, 0xE9, 0x33, 0x65, 0x1A,
+0xEB, 0x52, 0x15, 0xB5, 0xF0, 0xBC, 0x8E, 0xB4, 0x55, 0xB5, 0x8E, 0x63, 0xE5, 0x21, 0x28, 0x2B,
+0x88, 0x2A, 0x49, 0x33, 0x5A, 0xC0, 0x84, 0x19, 0x9A, 0x00, 0xC2, 0xCE, 0x6B, 0x5A, 0xD6, 0xCE,
+0xC4, 0xAB, 0xC1, 0xF8, 0xCD, 0xAF, 0x7B, 0x7F, 0xC6, 0x2B, 0x5B, 0x97, 0xBD, 0x11, 0xC5, 0x4C,
+0xBC, 0xD6, 0xD5, 0xAE, 0x73, 0x47, 0x32, 0x57, 0xAB, 0x02, 0x63, 0x66, 0x00, 0x61, 0x63, 0x66,
+0x01, 0x5E, 0xC0, 0xA6, 0x22, 0x00, 0xC5, 0x63, 0x11, 0x48, 0x2B, 0x08, 0x2C, 0x47, 0x43, 0x8C,
+0xB4, 0xCC, 0xC4, 0xAF, 0x92, 0xAE, 0x66, 0x5A, 0x84, 0xC4, 0x46, 0x32, 0xD4, 0x7C, 0xF8, 0xA5,
+0x9B, 0xBE, 0x6B, 0x43, 0x44, 0x55, 0x61, 0xAE, 0x02, 0x61, 0x72, 0xC0, 0x89, 0x32, 0x6D, 0xC1,
+0x23, 0x09, 0x64, 0x11, 0x7F, 0xC0, 0x49, 0x6B, 0xBE, 0xC0, 0xAA, 0x7B, 0xA6, 0x70, 0x00, 0xA2,
+0x70, 0xA9, 0xA2, 0xAF, 0xC6, 0x2A, 0x84, 0x88, 0x43, 0x2E, 0x6C, 0xD3, 0xA4, 0xEB, 0x62, 0xEE,
+0x83, 0x7D, 0xF7, 0x71, 0x00, 0xC5, 0x5D, 0xEF, 0xB2, 0x94, 0xCA, 0x62, 0x2B, 0x7B, 0xD1, 0xB4,
+0xD5, 0xCD, 0xBE, 0xC0, 0x2F, 0x94, 0xAE, 0xC3, 0x36, 0xDE, 0x8D, 0x83, 0xD1, 0xAC, 0xD5, 0xCD,
+0xA6, 0x44, 0x07, 0xA5, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0xA6,
+0xC1, 0x97, 0xB6, 0x27, 0x2C, 0xA2, 0xC4, 0x25, 0x23, 0x06, 0x3B, 0x47, 0x53, 0xC6, 0x3A, 0x24,
+0x1A, 0x7C, 0x72, 0xC1, 0xE8, 0x2A, 0x25, 0x22, 0x59, 0xAE, 0xBE, 0xAB, 0x72, 0xC2, 0xA9, 0x2A,
+0xCA, 0x33, 0x28, 0x2B, 0x5E, 0xC1, 0xE5, 0x19, 0x67, 0x22, 0x55, 0x50, 0x00, 0x55, 0x91, 0xC2,
+0xC5, 0x11, 0x67, 0x3A, 0x0B, 0x9C, 0xBE, 0xC1, 0x28, 0x63, 0xC6, 0x22, 0xAF, 0xC0, 0x86, 0x22,
+0xAE, 0x00, 0x73, 0xC1, 0x89, 0x33, 0x0A, 0x3C, 0x5F, 0xC0, 0x64, 0x11, 0x5E, 0x01, 0x7C, 0xA9,
+0x63, 0x00, 0xC3, 0xE4, 0x19, 0x85, 0x22, 0x46, 0x2B, 0xE6, 0x22, 0x00, 0xC2, 0xC5, 0x21, 0xAA,
+0x52, 0x2A, 0x6B, 0xA6, 0xC0, 0xEA, 0x52, 0x9E, 0xC5, 0x68, 0x32, 0xD7, 0x9D, 0xDB, 0xC6, 0x1C,
+0xCF, 0x39, 0xAE, 0x27, 0x2A, 0x5E, 0xAE, 0xC8, 0xE6, 0x21, 0x2C, 0x5B, 0xCB, 0x83, 0x4A, 0x7B,
+0x6C, 0x73, 0xCA, 0x4A, 0x05, 0x22, 0xA4, 0x19, 0x48, 0x3A, 0x65, 0xC1, 0x4B, 0x73, 0x2A, 0x5B,
+0x59, 0xC0, 0x47, 0x32, 0x5E, 0x66, 0xAE, 0x66, 0xAF, 0x00, 0x5E, 0x72, 0x63, 0x5E, 0x6D, 0x6B,
+0x66, 0x5E, 0xC1, 0xC5, 0x22, 0x24, 0x1A, 0x5A, 0xC1, 0xC6, 0x22, 0x65, 0x1A, 0x5F, 0xC0, 0x26,
+0x3B, 0xAB, 0xA5, 0xAB, 0x43, 0x01, 0x77, 0xC3, 0x6A, 0x3B, 0x14, 0x7D, 0xEC, 0x4A, 0x4D, 0x53,
+0x64, 0xC1, 0xA7, 0x2B, 0x45, 0x1A, 0x66, 0x72, 0x6D, 0x72, 0x00, 0x5E, 0xC6, 0xEB, 0x42, 0x9C,
+0xC6, 0xD0, 0x63, 0x2C, 0x4B, 0x89, 0x32, 0x86, 0x32, 0x2E, 0xC5, 0xBE, 0xBE, 0xA6, 0x01, 0x91,
+0x42, 0xBE, 0x00, 0xC8, 0x0D, 0xD5, 0xAF, 0xDD, 0x4A, 0x6C, 0x90, 0x7C, 0xF4, 0xAC, 0xCA, 0x5A,
+0xEE, 0x83, 0x7D, 0xF7, 0xFF, 0xFF, 0x02, 0xC5, 0x1B, 0xEF, 0x0E, 0x94, 0x6B, 0x83, 0xB4, 0xCD,
+0x16, 0xD6, 0x2F, 0x94, 0xBE, 0xC5, 0x56, 0xDE, 0x8D, 0x83, 0xEE, 0x8B, 0xEB, 0x6A, 0x33, 0xBD,
+0xD5, 0xCD, 0x07, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC1,
+0x76, 0xB6, 0x67, 0x2C, 0xB3, 0x64, 0xC0, 0xC4, 0x11, 0xAE, 0xBB, 0x00, 0xBF, 0x72, 0xC1, 0x07,
+0x2B, 0x25, 0x22, 0x61, 0x00, 0xAF, 0x72, 0x6D, 0xC1, 0x26, 0x22, 0x48, 0x2B, 0x5A, 0xA2, 0xC0,
+0x48, 0x33, 0x64, 0x5F, 0xA2, 0x00, 0x5A, 0xC2, 0xC7, 0x22, 0x08, 0x33, 0x8C, 0xA4, 0x7F, 0x92,
+0x99, 0xC2, 0x86, 0x42, 0x25, 0x1A, 0xE6, 0x2A, 0x5A, 0xC0, 0x05, 0x1A, 0x00, 0x64, 0xC0, 0x87,
+0x2B, 0x7A, 0x5E, 0xBE, 0x61, 0x66, 0x63, 0x46, 0xB6, 0x46, 0x90, 0x5E, 0xC1, 0x45, 0x1A, 0x27,
+0x23, 0x78, 0x5F, 0xC1, 0x23, 0x11, 0x64, 0x11, 0x50, 0xC6, 0x05, 0x23, 0x85, 0x22, 0xC7, 0x2A,
+0xE9, 0x32, 0x35, 0x95, 0x38, 0xB6, 0x6A, 0x3B, 0x42, 0xC0, 0xA6, 0x22, 0x50, 0xC1, 0xC7, 0x22,
+0x24, 0x1A, 0x73, 0x55, 0x52, 0x00, 0x63, 0x50, 0x5F, 0x7C, 0x50, 0xC0, 0x06, 0x23, 0x5F, 0xC1,
+0x08, 0x2B, 0xA7, 0x22, 0x5C, 0x78, 0x55, 0x6B, 0x73, 0xC0, 0x87, 0x2A, 0x7F, 0x44, 0xC1, 0x68,
+0x2A, 0x28, 0x2B, 0x00, 0xC4, 0xC5, 0x19, 0x04, 0x1A, 0x69, 0x33, 0x90, 0x6C, 0xCC, 0x4B, 0x46,
+0xC0, 0xC6, 0x22, 0xBA, 0xC0, 0x07, 0x43, 0xBD, 0xAB, 0xAB, 0x49, 0xA6, 0x49, 0x00, 0xC5, 0xE8,
+0x2A, 0x72, 0x74, 0x6F, 0x53, 0x49, 0x2A, 0xF0, 0x63, 0xB2, 0x74, 0x7F, 0xA1, 0x73, 0x02, 0x6E,
+0xC4, 0x0E, 0x5C, 0x3A, 0xAE, 0x36, 0x8D, 0x3A, 0xB6, 0xD3, 0x7C, 0x43, 0xC2, 0xCD, 0xBC, 0x0E,
+0xCD, 0x4E, 0xCD, 0xA6, 0x01, 0xC1, 0x2B, 0xAC, 0x67, 0x5A, 0xBE, 0xC9, 0xC8, 0x6A, 0xCA, 0x9B,
+0xAF, 0xDD, 0x6B, 0x6C, 0xB0, 0x7C, 0x35, 0xAD, 0xAA, 0x5A, 0xEE, 0x83, 0x7E, 0xF7, 0xFF, 0xFF,
+0x02, 0xC1, 0x5C, 0xF7, 0xF5, 0xD5, 0x96, 0x00, 0x4C, 0xC0, 0x2F, 0x94, 0x00, 0xC2, 0x33, 0xBD,
+0xCA, 0x62, 0x74, 0xC5, 0x00, 0xC0, 0xB4, 0xCD, 0xAF, 0x07, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC1, 0x76, 0xAE, 0x47, 0x2C, 0xB7, 0xC1, 0xA6, 0x22, 0x84,
+0x11, 0xBF, 0x01, 0xC0, 0x06, 0x22, 0x72, 0x73, 0x7C, 0x5E, 0xBB, 0x6D, 0x00, 0xC1, 0xE6, 0x19,
+0x88, 0x2A, 0x99, 0x6E, 0xC4, 0x07, 0x2B, 0x66, 0x22, 0x48, 0x33, 0xCA, 0x3B, 0xA7, 0x22, 0x61,
+0x00, 0x77, 0x00, 0xC1, 0xCD, 0xAC, 0x2E, 0xC5, 0x91, 0xC3, 0x2D, 0xBD, 0xA6, 0x42, 0x47, 0x22,
+0x88, 0x33, 0x7D, 0xC0, 0x46, 0x22, 0x5F, 0xC1, 0x25, 0x1A, 0x83, 0x11, 0x5E, 0xBE, 0x5E, 0x66,
+0x00, 0x5E, 0xC2, 0x89, 0x3A, 0xEF, 0x73, 0x0B, 0x4B, 0x41, 0xC0, 0xA7, 0x2A, 0x9A, 0xA5, 0xC0,
+0x47, 0x2B, 0x7D, 0x64, 0xC0, 0xC4, 0x19, 0x6C, 0xC0, 0x67, 0x2B, 0x64, 0xC4, 0x09, 0x34, 0xE5,
+0x1A, 0x92, 0x7C, 0x96, 0x9D, 0xE6, 0x1A, 0x71, 0xC2, 0xA8, 0x2B, 0xA6, 0x1A, 0x29, 0x34, 0x64,
+0xC2, 0x06, 0x23, 0xE8, 0x2B, 0xE4, 0x11, 0x52, 0x9A, 0x64, 0xC1, 0x29, 0x2C, 0x85, 0x22, 0x6E,
+0x58, 0x5C, 0x71, 0xC0, 0x27, 0x23, 0x64, 0x58, 0xC1, 0x85, 0x1A, 0x68, 0x2B, 0x00, 0xC4, 0xC7,
+0x2A, 0x0A, 0x34, 0x77, 0xA6, 0xF3, 0x84, 0x67, 0x23, 0xBF, 0x41, 0x7D, 0xC1, 0x95, 0x8D, 0x7A,
+0xBE, 0x99, 0xC3, 0x8B, 0x3B, 0x45, 0x1A, 0x27, 0x43, 0xAC, 0xBC, 0xBE, 0xA7, 0x92, 0xAD, 0xC0,
+0xCD, 0xC4, 0x5A, 0x63, 0xC3, 0x2F, 0x74, 0xF6, 0x8C, 0x57, 0x95, 0xBC, 0xC6, 0xAB, 0x91, 0xC2,
+0x6D, 0x53, 0xA4, 0x11, 0xE4, 0x19, 0x00, 0x6B, 0x70, 0x96, 0xC2, 0xA8, 0x32, 0xD8, 0xA5, 0x4E,
+0x53, 0x91, 0xC3, 0xAA, 0x3A, 0x65, 0x32, 0xED, 0xBC, 0x4E, 0xD5, 0x00, 0x96, 0xBA, 0x42, 0x00,
+0xC1, 0x69, 0x8B, 0xC3, 0x18, 0x92, 0xC8, 0xC8, 0x72, 0x8F, 0xD5, 0xAB, 0x74, 0xF1, 0x84, 0x35,
+0xB5, 0xA9, 0x5A, 0xEE, 0x83, 0x9E, 0xF7, 0xFF, 0xFF, 0x02, 0xC1, 0x5C, 0xEF, 0xB4, 0xCD, 0xAF,
+0x00, 0xBE, 0xC3, 0x90, 0xA4, 0x48, 0x52, 0xAA, 0x62, 0x91, 0xA4, 0x4C, 0x44, 0x09, 0x78, 0xC0,
+0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1C, 0xC0, 0x9E, 0xF7, 0x71, 0x03, 0x58,
+0x71, 0x08, 0xC1, 0x56, 0xAE, 0x48, 0x2C, 0xA2, 0xC4, 0x06, 0x23, 0xA5, 0x32, 0x06, 0x43, 0x85,
+0x2A, 0xE5, 0x19, 0xBB, 0x72, 0xC2, 0xE8, 0x32, 0x46, 0x22, 0x84, 0x11, 0xBE, 0xAB, 0x00, 0xC1,
+0x47, 0x2A, 0xA9, 0x3B, 0x9E, 0x64, 0xC0, 0xA3, 0x11, 0x77, 0xC0, 0x68, 0x33, 0xAE, 0xC0, 0x65,
+0x22, 0xA6, 0xAF, 0xC3, 0x27, 0x2B, 0x05, 0x1A, 0x07, 0x53, 0xCC, 0xAC, 0xBE, 0xC1, 0x89, 0x73,
+0xA3, 0x19, 0x9B, 0xC1, 0xE6, 0x22, 0x25, 0x1A, 0x55, 0xC0, 0x09, 0x34, 0x6C, 0x5E, 0x00, 0x63,
+0x5E, 0x63, 0x00, 0xC3, 0x43, 0x09, 0xA9, 0x42, 0x74, 0xBD, 0x2E, 0x8C, 0x64, 0xC0, 0xA8, 0x33,
+0x67, 0xC0, 0x65, 0x1A, 0xA6, 0xC0, 0x47, 0x2B, 0x7D, 0x64, 0xC0, 0x04, 0x1A, 0x41, 0x7C, 0xC7,
+0x86, 0x22, 0xE4, 0x11, 0xB2, 0x84, 0x75, 0x9D, 0xC6, 0x1A, 0x68, 0x2B, 0x74, 0x8D, 0xD2, 0x7C,
+0x7D, 0x4B, 0xC2, 0x0E, 0x54, 0xF7, 0x9D, 0x2B, 0x43, 0x50, 0xC2, 0x30, 0x64, 0x96, 0x9D, 0x53,
+0x7D, 0x5A, 0xC1, 0x29, 0x33, 0x33, 0x7D, 0xB7, 0xC0, 0x49, 0x33, 0xA1, 0x60, 0xC1, 0x07, 0x23,
+0xAD, 0x4B, 0x98, 0x64, 0x4B, 0xC2, 0x0C, 0x4C, 0xBF, 0xEF, 0x55, 0x95, 0x4B, 0x64, 0xAE, 0xC1,
+0x6A, 0x3B, 0x7A, 0xC6, 0x53, 0xC0, 0x33, 0x85, 0x80, 0xC3, 0x66, 0x1B, 0x67, 0x43, 0x8B, 0xB4,
+0xCC, 0xBC, 0x52, 0x92, 0x52, 0xC0, 0xEC, 0xC4, 0x86, 0xC2, 0x0D, 0xB5, 0xAD, 0x63, 0x57, 0x95,
+0xBE, 0xC3, 0xBF, 0xF7, 0xFD, 0xCE, 0x98, 0x9D, 0x6C, 0x43, 0x72, 0x95, 0x66, 0x63, 0xBB, 0x00,
+0x66, 0x6D, 0x5E, 0xA6, 0x9A, 0xC1, 0x05, 0x22, 0x27, 0x63, 0xBB, 0xC0, 0x69, 0x73, 0x95, 0x00,
+0xBE, 0x00, 0xAE, 0xCA, 0x26, 0x42, 0x64, 0x29, 0xA4, 0x29, 0x06, 0x42, 0xA7, 0x42, 0xD0, 0x84,
+0x96, 0xBD, 0xCA, 0x5A, 0xCE, 0x7B, 0x7D, 0xF7, 0xFF, 0xFF, 0x02, 0xC0, 0x5C, 0xEF, 0x78, 0xAF,
+0x02, 0x91, 0xBF, 0xC0, 0xF5, 0xD5, 0x44, 0x0A, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x1B, 0xC2, 0x14, 0xA5, 0x6D, 0x73, 0xD3, 0x9C, 0x71, 0x01, 0xC5, 0x76, 0xB5,
+0x8E, 0x73, 0x72, 0x94, 0x9E, 0xF7, 0xF3, 0xA4, 0xDF, 0xFF, 0x71, 0xC1, 0x55, 0xAD, 0xDB, 0xDE,
+0x71, 0x01, 0xC1, 0x55, 0xAE, 0x27, 0x2C, 0xB6, 0xC1, 0x89, 0x6C, 0x29, 0x94, 0xBF, 0x00, 0xC1,
+0x27, 0x5B, 0x06, 0x22, 0x92, 0xC1, 0x08, 0x33, 0x46, 0x22, 0x59, 0xAE, 0x01, 0x77, 0x75, 0x00,
+0xC0, 0xA4, 0x11, 0x02, 0x5E, 0x00, 0x63, 0x5E, 0xC1, 0x05, 0x1A, 0x27, 0x2B, 0x7C, 0xBA, 0xBD,
+0xC0, 0x83, 0x11, 0x63, 0x5E, 0x01, 0x63, 0xC1, 0x24, 0x1A, 0xC4, 0x11, 0x63, 0x00, 0x5E, 0x63,
+0x5E, 0x63, 0x59, 0xC3, 0xC9, 0x52, 0x4C, 0xA4, 0x49, 0x7B, 0x42, 0x11, 0x41, 0xC0, 0xC7, 0x22,
+0x77, 0xA9, 0xC0, 0x86, 0x22, 0x7D, 0x00, 0xDA, 0xC6, 0x22, 0x63, 0x11, 0x25, 0x22, 0x69, 0x2B,
+0xC6, 0x1A, 0x92, 0x7C, 0xB6, 0x9D, 0x86, 0x1A, 0x74, 0x85, 0x18, 0xAE, 0x7A, 0xBE, 0xB1, 0x6C,
+0xCB, 0x3B, 0x9A, 0xB6, 0xB8, 0x9D, 0x59, 0xB6, 0x8B, 0x3B, 0x1C, 0xCF, 0xB6, 0xA5, 0x39, 0xAE,
+0x0D, 0x54, 0x53, 0x85, 0x5A, 0xB6, 0xB7, 0x9D, 0xF2, 0x74, 0xAA, 0x3B, 0x79, 0xB6, 0x6E, 0xCF,
+0x99, 0xB6, 0x4F, 0x64, 0x06, 0x23, 0x48, 0x2B, 0xD7, 0x95, 0x7B, 0xBE, 0x75, 0x8D, 0xE6, 0x1A,
+0x47, 0x2B, 0xE6, 0x22, 0x6E, 0x5C, 0x99, 0xBE, 0xA6, 0x1A, 0x51, 0x6C, 0xD6, 0x95, 0x85, 0x1A,
+0xB7, 0xC0, 0x07, 0x3B, 0x01, 0xAE, 0xBA, 0xAE, 0x43, 0xBB, 0xC1, 0x87, 0x2A, 0xCD, 0x4B, 0xA9,
+0x00, 0xC0, 0xCB, 0x42, 0x4C, 0xC1, 0xC9, 0x33, 0x05, 0x1A, 0x5E, 0xBE, 0xAF, 0xC0, 0x46, 0x22,
+0x55, 0x66, 0xBF, 0xC0, 0xE7, 0x62, 0x00, 0xC0, 0x45, 0x32, 0x52, 0xC1, 0xEB, 0x3A, 0x8A, 0x32,
+0x4A, 0x52, 0x03, 0xBF, 0xA6, 0xC1, 0xC4, 0x19, 0x24, 0x1A, 0xA2, 0xC4, 0x07, 0x42, 0x2C, 0x6B,
+0x89, 0x52, 0x2F, 0x84, 0xBE, 0xFF, 0x71, 0x02, 0xC1, 0x5C, 0xEF, 0xB4, 0xCD, 0xAF, 0x11, 0x78,
+0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC0, 0x9E, 0xF7, 0x71, 0xC1,
+0xAE, 0x7B, 0x3C, 0xE7, 0x71, 0x00, 0x58, 0x71, 0xC3, 0x10, 0x84, 0xDB, 0xDE, 0x71, 0x8C, 0xBA,
+0xD6, 0x71, 0xC0, 0xCF, 0x7B, 0x58, 0x71, 0x01, 0xC0, 0x56, 0xAE, 0x65, 0xCF, 0xEA, 0x74, 0xCB,
+0xB4, 0x90, 0xCD, 0xF9, 0xE6, 0x77, 0xDE, 0xED, 0xBC, 0xC7, 0x52, 0xE5, 0x19, 0x07, 0x2B, 0x67,
+0x22, 0x93, 0x7C, 0x0C, 0x4B, 0x6E, 0x53, 0xCF, 0x5B, 0x06, 0x22, 0x49, 0x63, 0xBE, 0x00, 0xBB,
+0xA9, 0xA6, 0x9A, 0x70, 0x01, 0x6D, 0xC0, 0xE7, 0x3A, 0x45, 0xC4, 0x34, 0x8D, 0xCA, 0x3A, 0x8E,
+0x53, 0x46, 0x2A, 0x68, 0x6B, 0xB2, 0x99, 0xA7, 0x9E, 0xBE, 0x00, 0xA6, 0xBB, 0x5C, 0x5F, 0xC0,
+0x66, 0x32, 0x4A, 0xC3, 0xEA, 0x52, 0x12, 0xBD, 0xED, 0x83, 0x43, 0x11, 0x5A, 0xC0, 0x48, 0x2B,
+0x5A, 0x49, 0x00, 0xC0, 0x45, 0x1A, 0x42, 0xA6, 0xC7, 0xA6, 0x22, 0x25, 0x1A, 0xA8, 0x2B, 0x85,
+0x1A, 0x92, 0x84, 0x75, 0x95, 0xA7, 0x22, 0xFB, 0xCE, 0x96, 0xBA, 0xC0, 0xF1, 0x74, 0x80, 0xC1,
+0x5E, 0xE7, 0x7A, 0xBE, 0xAE, 0xC0, 0xEC, 0x4B, 0x7F, 0x45, 0x76, 0xC0, 0xF2, 0x7C, 0x4A, 0xC3,
+0x9A, 0xB6, 0x96, 0x95, 0x8C, 0x43, 0x06, 0x23, 0x76, 0xC2, 0x76, 0x8D, 0x18, 0xA6, 0x49, 0x33,
+0x6E, 0xC2, 0x8F, 0x5C, 0x3D, 0xD7, 0x39, 0xBE, 0xAE, 0xC1, 0x6A, 0x3B, 0x06, 0x23, 0x00, 0xC1,
+0x4E, 0x5C, 0x7A, 0xC6, 0x5E, 0xC1, 0x51, 0x74, 0x96, 0xA5, 0x50, 0xC0, 0x06, 0x2B, 0x79, 0xBA,
+0xAE, 0x01, 0xAB, 0x41, 0x9A, 0xC8, 0x8A, 0x43, 0xD2, 0x74, 0xE8, 0x2A, 0x47, 0x22, 0x89, 0x32,
+0x71, 0x6C, 0xEE, 0x53, 0x31, 0x74, 0xA5, 0x19, 0x5E, 0xC1, 0x05, 0x1A, 0xC9, 0x33, 0x58, 0xC6,
+0xC4, 0x19, 0x2C, 0x8C, 0x89, 0x9B, 0x03, 0x62, 0xE9, 0x93, 0xE5, 0x21, 0x35, 0x8D, 0xA1, 0xC1,
+0x43, 0x11, 0x84, 0x19, 0x00, 0xA6, 0x5E, 0xA6, 0x01, 0xC8, 0xA4, 0x19, 0xA5, 0x22, 0x46, 0x23,
+0xD0, 0x84, 0x8E, 0x7B, 0x45, 0x29, 0x69, 0x52, 0x79, 0xD6, 0xFF, 0xFF, 0x02, 0xC1, 0x5C, 0xEF,
+0xB4, 0xCD, 0xAF, 0x11, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B,
+0x91, 0xC0, 0x92, 0x94, 0x40, 0xC0, 0xDF, 0xFF, 0x71, 0x00, 0x6C, 0xC6, 0xF3, 0xA4, 0xCF, 0x7B,
+0xDF, 0xFF, 0xD7, 0xBD, 0x55, 0xAD, 0xFB, 0xDE, 0x71, 0x94, 0x71, 0x02, 0xC4, 0x55, 0xA6, 0x88,
+0x3C, 0x2C, 0xA5, 0xD0, 0xD5, 0x9C, 0xFF, 0x71, 0x00, 0xC1, 0x96, 0xE6, 0xC8, 0x8B, 0x6B, 0xC2,
+0xE7, 0x2A, 0x05, 0x1A, 0xD5, 0x8C, 0x00, 0xAE, 0xC3, 0x37, 0x95, 0x0B, 0x43, 0x0E, 0xB5, 0x4E,
+0xCD, 0x96, 0x00, 0xA9, 0xA7, 0x77, 0x00, 0x96, 0x77, 0xAE, 0xC6, 0x88, 0x73, 0x27, 0x22, 0x39,
+0xB6, 0xEF, 0x63, 0xB8, 0xA5, 0xE8, 0x4A, 0xEA, 0xBC, 0xA2, 0x00, 0xAB, 0xAF, 0x00, 0xAE, 0x57,
+0xAB, 0x57, 0xBE, 0xCC, 0x47, 0x63, 0x63, 0x09, 0x06, 0x2A, 0x4E, 0x6B, 0x4B, 0x5B, 0x63, 0x11,
+0xA6, 0x22, 0xE8, 0x2B, 0x85, 0x1A, 0x47, 0x2B, 0xE6, 0x22, 0x84, 0x11, 0x65, 0x1A, 0x42, 0xA6,
+0x69, 0xA6, 0x4B, 0xC5, 0x54, 0x8D, 0x95, 0x9D, 0xA7, 0x22, 0x79, 0xB6, 0x10, 0x6C, 0x6D, 0x53,
+0x84, 0xC6, 0xEE, 0x5B, 0xF8, 0xAD, 0xCB, 0x42, 0xCF, 0x5B, 0xEA, 0x32, 0xBA, 0xC6, 0x4B, 0x4B,
+0x74, 0xC9, 0xF2, 0x84, 0x2A, 0x33, 0x2C, 0x4B, 0x77, 0xA5, 0x34, 0x8D, 0xE4, 0x11, 0x0F, 0x5C,
+0xBF, 0xEF, 0x72, 0x7C, 0x04, 0x12, 0xBE, 0x67, 0xC2, 0xD4, 0x8C, 0x39, 0xBE, 0xBA, 0xD6, 0x5D,
+0xC0, 0x45, 0x1A, 0x00, 0xC8, 0x4A, 0x43, 0x59, 0xBE, 0x47, 0x22, 0xD3, 0x7C, 0x74, 0x8D, 0xA5,
+0x1A, 0x27, 0x43, 0xAC, 0xB4, 0xAD, 0xC4, 0x96, 0xA9, 0xAF, 0xA9, 0x00, 0xCA, 0x0E, 0xB5, 0x91,
+0x7C, 0x3B, 0xBE, 0xB4, 0x84, 0xF8, 0xAD, 0x6E, 0x53, 0xD8, 0xAD, 0x4D, 0x53, 0xD8, 0xA5, 0xE7,
+0x21, 0x64, 0x11, 0xAD, 0x50, 0xC0, 0x25, 0x1A, 0xB6, 0xC5, 0x91, 0xC5, 0xE7, 0x7A, 0x01, 0x29,
+0x8B, 0xAC, 0xE8, 0x4A, 0xF4, 0x8C, 0xBF, 0xC1, 0x43, 0x11, 0x84, 0x11, 0x00, 0xBA, 0x00, 0x59,
+0x01, 0xCA, 0xA4, 0x19, 0xA5, 0x22, 0x26, 0x23, 0x53, 0x95, 0xF8, 0xC5, 0xEA, 0x5A, 0x48, 0x4A,
+0xCB, 0x5A, 0xCF, 0x7B, 0x79, 0xCE, 0xFF, 0xFF, 0x00, 0xC0, 0x5C, 0xEF, 0x78, 0xAF, 0x01, 0x78,
+0x81, 0xBF, 0xC0, 0xF5, 0xD5, 0x44, 0x0A, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x1B, 0xA6, 0xC2, 0xD7, 0xBD, 0xEF, 0x83, 0x5D, 0xEF, 0x71, 0x01, 0xC0, 0x18, 0xC6,
+0x74, 0xC4, 0xFB, 0xE6, 0x7D, 0xEF, 0x71, 0x8C, 0x14, 0xA5, 0xF7, 0xBD, 0x71, 0x02, 0xC3, 0x35,
+0xA6, 0x68, 0x3C, 0x0B, 0xA5, 0x12, 0xDE, 0x6C, 0x00, 0x71, 0xC7, 0xF7, 0xE6, 0x2A, 0x9C, 0xE4,
+0x21, 0xC8, 0x2A, 0x46, 0x22, 0xEC, 0x42, 0xFA, 0xAD, 0x94, 0x7C, 0xA9, 0xC2, 0x4C, 0x53, 0xEE,
+0xB4, 0x4E, 0xCD, 0x96, 0x01, 0x63, 0xAE, 0x77, 0xA6, 0x68, 0x7F, 0xC3, 0xE9, 0x7B, 0x07, 0x22,
+0xD5, 0x84, 0x0F, 0x64, 0x41, 0xC2, 0xC8, 0x4A, 0xA8, 0xB4, 0xAB, 0xC4, 0xAE, 0x9A, 0xAB, 0x91,
+0x57, 0xBB, 0x63, 0x57, 0xBE, 0xC3, 0x27, 0x5B, 0xC4, 0x11, 0x08, 0x33, 0x05, 0x1A, 0x00, 0xB2,
+0x95, 0xC1, 0xE4, 0x19, 0x84, 0x19, 0x6B, 0xC0, 0x05, 0x22, 0x92, 0x66, 0xC2, 0x65, 0x1A, 0x67,
+0x2B, 0x07, 0x23, 0xA6, 0x95, 0xC8, 0x53, 0x85, 0x95, 0x9D, 0x85, 0x1A, 0xB1, 0x74, 0x39, 0xB6,
+0x7A, 0xB6, 0x2F, 0x64, 0xC8, 0x2A, 0x18, 0xAE, 0x66, 0xC5, 0xD7, 0x9D, 0xEA, 0x32, 0x59, 0xB6,
+0x2B, 0x43, 0x55, 0x95, 0x71, 0x74, 0x86, 0xC7, 0x19, 0xAE, 0x7A, 0xBE, 0xF3, 0x84, 0x05, 0x12,
+0x0A, 0x33, 0x1C, 0xD7, 0x8D, 0x53, 0x44, 0x1A, 0xBF, 0xC0, 0xA6, 0x22, 0x81, 0xC6, 0xF2, 0x7C,
+0xB7, 0xA5, 0x45, 0x12, 0x2E, 0x5C, 0x34, 0x8D, 0xC7, 0x2A, 0xF7, 0xA5, 0x9A, 0xC4, 0xBA, 0xBE,
+0xAD, 0x53, 0xC5, 0x1A, 0x47, 0x43, 0xAC, 0xB4, 0x63, 0xA6, 0x4F, 0xBE, 0xAE, 0x57, 0xCE, 0x4E,
+0xBD, 0x70, 0x74, 0xFA, 0xB5, 0x99, 0xA5, 0x5B, 0xC6, 0x6E, 0x5B, 0xD4, 0x7C, 0xD0, 0x5B, 0xD9,
+0xA5, 0x08, 0x2A, 0xE5, 0x29, 0xC7, 0x52, 0x66, 0x42, 0x84, 0x11, 0x05, 0x22, 0x6F, 0xC7, 0xE6,
+0x82, 0xE3, 0x51, 0x2E, 0xC5, 0x09, 0x53, 0xD4, 0x84, 0xF4, 0x94, 0x43, 0x11, 0x84, 0x19, 0x00,
+0x5E, 0x00, 0xA6, 0x01, 0xCD, 0xA4, 0x19, 0xC6, 0x22, 0x66, 0x2B, 0x52, 0x8D, 0xB7, 0xC5, 0x50,
+0x8C, 0x17, 0xBE, 0x9E, 0xF7, 0x75, 0xAD, 0x0C, 0x63, 0x6D, 0x73, 0x18, 0xC6, 0x5C, 0xF7, 0xF5,
+0xD5, 0x96, 0x00, 0x4C, 0xC2, 0x70, 0x9C, 0x48, 0x52, 0xA9, 0x5A, 0x58, 0x4C, 0x44, 0x91, 0xBE,
+0x44, 0x06, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1D, 0xC2, 0x31,
+0x8C, 0x9A, 0xD6, 0xBE, 0xF7, 0x6C, 0x00, 0x71, 0xC1, 0xD3, 0x9C, 0xF7, 0xBD, 0x71, 0xC2, 0x30,
+0x84, 0x0C, 0x63, 0x7D, 0xEF, 0x71, 0x02, 0xC4, 0x15, 0xA6, 0x07, 0x2C, 0xCA, 0x84, 0x2F, 0xCD,
+0x3B, 0xF7, 0x71, 0xA0, 0xC2, 0xB0, 0xCD, 0x67, 0x73, 0xC4, 0x19, 0x6E, 0xC7, 0x2B, 0x43, 0x77,
+0x9D, 0x53, 0x74, 0xF5, 0x8C, 0x36, 0x8D, 0x68, 0x32, 0x8D, 0xA4, 0xED, 0xB4, 0x91, 0xAF, 0x01,
+0x4C, 0xAE, 0x4C, 0x58, 0xC8, 0x0D, 0xBD, 0x47, 0x63, 0xAF, 0x5B, 0xB7, 0x9D, 0x4B, 0x43, 0xF1,
+0x63, 0xA7, 0x3A, 0x89, 0xAC, 0xAB, 0xB4, 0xAE, 0x01, 0x96, 0xA6, 0x99, 0xAB, 0xA1, 0xAE, 0xC0,
+0xE6, 0x52, 0x5F, 0xC2, 0x04, 0x1A, 0x67, 0x32, 0x53, 0xA5, 0xBB, 0xC0, 0x2A, 0x63, 0x90, 0xA6,
+0xC2, 0xAC, 0x73, 0xB6, 0xBD, 0x4C, 0x5B, 0x5E, 0x00, 0xC1, 0x04, 0x12, 0x85, 0x1A, 0x00, 0xA6,
+0xC0, 0xC8, 0x32, 0xAB, 0xC0, 0x45, 0x1A, 0xBF, 0xC0, 0xAE, 0x5B, 0x92, 0xC0, 0x46, 0x22, 0x46,
+0xC2, 0xA9, 0x32, 0xAF, 0x63, 0x88, 0x32, 0x4B, 0xC2, 0xEA, 0x3A, 0x87, 0x22, 0xEA, 0x32, 0x91,
+0x90, 0xC0, 0xEF, 0x63, 0xA6, 0xC5, 0x47, 0x22, 0x24, 0x1A, 0x6B, 0x43, 0x19, 0xAE, 0x29, 0x33,
+0x26, 0x23, 0xBB, 0x91, 0xC2, 0x65, 0x1A, 0xCC, 0x4B, 0x2F, 0x5C, 0x4B, 0x45, 0xC4, 0xB1, 0x74,
+0x66, 0x1A, 0x4B, 0x3B, 0x15, 0x8D, 0xB0, 0x6B, 0x50, 0xC0, 0xA5, 0x22, 0x66, 0xC0, 0x45, 0x32,
+0xAB, 0x4F, 0xAE, 0xB6, 0x00, 0x4F, 0xBF, 0x83, 0xC1, 0x2D, 0x53, 0xCC, 0x42, 0x9A, 0xC0, 0x29,
+0x2A, 0x94, 0xC0, 0xAA, 0x3A, 0x5A, 0xC2, 0x05, 0x2A, 0x2A, 0x9C, 0xEC, 0xCC, 0x9F, 0xC3, 0x69,
+0x6B, 0xA4, 0x11, 0x89, 0x7B, 0x6A, 0xBC, 0x86, 0xC5, 0x6D, 0xAC, 0xE6, 0x31, 0xF4, 0x84, 0xF4,
+0x94, 0x43, 0x11, 0x84, 0x19, 0x9A, 0x61, 0xC0, 0x04, 0x2A, 0xAE, 0xBE, 0x54, 0x8A, 0xC5, 0x05,
+0x23, 0xA7, 0x2B, 0x8F, 0x74, 0xF4, 0xA4, 0xF8, 0xC5, 0xFF, 0xFF, 0x02, 0xC1, 0xD7, 0xBD, 0x4D,
+0x6B, 0xA0, 0xC1, 0x6F, 0xA4, 0xB4, 0xCD, 0xAF, 0xBE, 0xC0, 0x2F, 0x94, 0x00, 0xC2, 0x73, 0xBD,
+0xCA, 0x62, 0x94, 0xC5, 0x4C, 0xC1, 0x0F, 0x94, 0x53, 0xBD, 0x4C, 0x96, 0x05, 0x78, 0xC0, 0xDA,
+0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC2, 0x71, 0x8C, 0xAF, 0x7B, 0x31, 0x8C,
+0x71, 0xC3, 0x55, 0xAD, 0x9A, 0xD6, 0x14, 0xA5, 0xCF, 0x7B, 0xAE, 0xC1, 0x9E, 0xF7, 0xFF, 0xFF,
+0x64, 0xC0, 0xAE, 0x7B, 0x71, 0x03, 0xC8, 0x15, 0xA6, 0xE6, 0x23, 0x08, 0x44, 0x6B, 0x9C, 0x0E,
+0xC5, 0xF3, 0xDD, 0x4F, 0xCD, 0x88, 0x7B, 0xE4, 0x29, 0x87, 0xC4, 0xE8, 0x2A, 0x26, 0x22, 0x49,
+0x32, 0xA5, 0x19, 0xE7, 0x29, 0xAE, 0x66, 0x42, 0x02, 0xAE, 0xAB, 0x42, 0x01, 0xAB, 0xC3, 0x08,
+0x3B, 0x65, 0x22, 0x85, 0x19, 0xA9, 0x32, 0x9C, 0x5E, 0xC0, 0xC4, 0x19, 0x47, 0x00, 0xBA, 0xC0,
+0x28, 0x3B, 0x98, 0x7B, 0x42, 0x99, 0x40, 0xC0, 0x86, 0x2A, 0xBE, 0xC1, 0x07, 0x2B, 0x24, 0x1A,
+0x4D, 0xC4, 0x0E, 0x74, 0x38, 0xD6, 0x97, 0xBD, 0xCE, 0x8B, 0xE9, 0x62, 0x00, 0xC6, 0xCE, 0x83,
+0xDB, 0xEE, 0x71, 0x94, 0xE5, 0x21, 0x88, 0x42, 0xAE, 0x73, 0x8B, 0x6B, 0xA9, 0xC2, 0xCD, 0x73,
+0x28, 0x3A, 0xC4, 0x19, 0xAE, 0x78, 0x96, 0xC0, 0x25, 0x1A, 0xA2, 0x5E, 0xC0, 0x86, 0x22, 0x95,
+0x63, 0xA5, 0x00, 0xC2, 0x46, 0x22, 0x07, 0x23, 0x66, 0x1A, 0x5A, 0x75, 0x57, 0x4D, 0xC4, 0x27,
+0x22, 0x19, 0xB6, 0x92, 0x7C, 0x86, 0x1A, 0xC6, 0x22, 0x01, 0x70, 0x64, 0x00, 0x70, 0x64, 0x96,
+0x64, 0xA6, 0x64, 0xC1, 0xC4, 0x11, 0x05, 0x1A, 0x70, 0xC1, 0x05, 0x22, 0x25, 0x32, 0xBE, 0xA6,
+0x00, 0x52, 0x00, 0xA7, 0x4A, 0xC6, 0x47, 0x2A, 0xCE, 0x5B, 0xE8, 0x32, 0x69, 0x2B, 0x6B, 0x3B,
+0xEE, 0x5B, 0x8C, 0x4B, 0x81, 0xC4, 0xA8, 0x5B, 0x2D, 0xCD, 0xAC, 0xBC, 0x0D, 0xC5, 0x6F, 0xBD,
+0x7A, 0x66, 0xC4, 0xE8, 0x62, 0x28, 0x6B, 0xE5, 0x31, 0x23, 0x09, 0x14, 0x8D, 0xBB, 0xC5, 0x44,
+0x11, 0x84, 0x11, 0xC5, 0x21, 0xA9, 0x83, 0x8A, 0x93, 0x08, 0x83, 0xA8, 0xC2, 0x47, 0x8B, 0xA7,
+0x7B, 0x85, 0x33, 0x8B, 0xC3, 0x4E, 0x64, 0xB2, 0x9C, 0x79, 0xD6, 0xDF, 0xFF, 0xAE, 0x03, 0xC3,
+0xD6, 0xC5, 0xE9, 0x72, 0x4F, 0x9C, 0xF5, 0xD5, 0x00, 0xC0, 0x2F, 0x94, 0xBE, 0xC6, 0x56, 0xDE,
+0x8D, 0x7B, 0xF2, 0xAC, 0xF5, 0xD5, 0xCE, 0x83, 0x12, 0xB5, 0xD5, 0xCD, 0x06, 0xA5, 0xC0, 0xDA,
+0xE6, 0x71, 0x0E, 0x70, 0x00, 0x71, 0x1B, 0xC1, 0x7D, 0xEF, 0xFB, 0xDE, 0x71, 0x00, 0x6C, 0x71,
+0xC0, 0x9E, 0xF7, 0x61, 0x71, 0x08, 0xC1, 0x35, 0xA6, 0x07, 0x2C, 0x91, 0xC5, 0x66, 0x33, 0x68,
+0x5B, 0x88, 0x6B, 0xE6, 0x4A, 0x04, 0x22, 0xA4, 0x19, 0x6D, 0x50, 0xC0, 0xE7, 0x2A, 0x5E, 0xA9,
+0x00, 0x5E, 0xBA, 0x5E, 0x02, 0xC1, 0xE6, 0x19, 0x87, 0x22, 0x90, 0xC0, 0x64, 0x11, 0x5E, 0x59,
+0xC1, 0x05, 0x1A, 0xC6, 0x22, 0x7A, 0xC2, 0xA9, 0x7B, 0x4B, 0x94, 0x66, 0x42, 0x63, 0x5E, 0xA5,
+0xC1, 0x86, 0x22, 0x27, 0x2B, 0x4B, 0xC0, 0xE4, 0x19, 0x5E, 0xC1, 0xE4, 0x11, 0xC7, 0x22, 0xAD,
+0xC0, 0x85, 0x1A, 0x46, 0x5E, 0xBA, 0xC1, 0xCA, 0x42, 0xB4, 0x9C, 0xBA, 0xC1, 0x8E, 0x83, 0xA9,
+0x62, 0x9A, 0xCA, 0xAE, 0x83, 0x5A, 0xDE, 0xF3, 0xA4, 0x09, 0x3B, 0xC9, 0x4A, 0xB8, 0xC5, 0xD0,
+0xB4, 0x2B, 0xA4, 0x34, 0xB5, 0x2C, 0x53, 0xA5, 0x19, 0xAD, 0xC0, 0xA8, 0x2B, 0x00, 0x5F, 0xC0,
+0x06, 0x23, 0x5A, 0xC1, 0x46, 0x23, 0xA7, 0x2B, 0x6B, 0x92, 0x57, 0x4E, 0xC0, 0x87, 0x2B, 0x5F,
+0xC2, 0x47, 0x2B, 0xE8, 0x2B, 0xE4, 0x19, 0x52, 0xC3, 0x48, 0x2A, 0x90, 0x6C, 0xA7, 0x2A, 0x26,
+0x23, 0xB7, 0x7D, 0x00, 0x6E, 0x7D, 0x78, 0x00, 0x9A, 0x00, 0xC2, 0x67, 0x2B, 0x25, 0x1A, 0x65,
+0x1A, 0x58, 0x64, 0x00, 0xC2, 0xC7, 0x3A, 0x8C, 0xAC, 0xCD, 0xBC, 0xA6, 0x95, 0xBE, 0x5E, 0x00,
+0xAE, 0xCC, 0x70, 0x7C, 0x7C, 0xC6, 0x13, 0x7D, 0x16, 0x9E, 0xEF, 0x5B, 0x39, 0xB6, 0x93, 0x7C,
+0x57, 0x95, 0xA7, 0x3A, 0xAB, 0xB4, 0xCD, 0xC4, 0x2D, 0xCD, 0xAD, 0x9C, 0x6B, 0x92, 0xA6, 0x5E,
+0x59, 0xA6, 0xC2, 0xF4, 0x8C, 0x35, 0x9D, 0x43, 0x11, 0xAE, 0xC4, 0x07, 0x5B, 0xD3, 0xD5, 0x30,
+0xA4, 0xCE, 0x93, 0x4B, 0x83, 0x00, 0xC5, 0x0A, 0x9C, 0x88, 0x74, 0xA6, 0x23, 0xCF, 0x7C, 0x75,
+0xB5, 0x7D, 0xEF, 0x71, 0x04, 0xC1, 0x7D, 0xF7, 0xD5, 0xCD, 0xA5, 0x44, 0xBE, 0xC0, 0x2F, 0x94,
+0xAE, 0xC6, 0x36, 0xDE, 0xAD, 0x83, 0x90, 0xA4, 0x2C, 0x73, 0x07, 0x4A, 0x69, 0x5A, 0x70, 0x9C,
+0x4C, 0x96, 0x04, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2D, 0xC1,
+0x34, 0xA6, 0x26, 0x2C, 0xA3, 0xC1, 0xA5, 0x1A, 0xE4, 0x11, 0x00, 0xA5, 0xA7, 0xBA, 0xAB, 0x91,
+0xC1, 0x46, 0x22, 0x07, 0x2B, 0x66, 0x59, 0xBE, 0x04, 0xC2, 0xA8, 0x2A, 0xE9, 0x33, 0x47, 0x2B,
+0x59, 0x66, 0x00, 0x7C, 0x78, 0xC1, 0xEA, 0x83, 0x2E, 0xC5, 0x91, 0x91, 0xC0, 0x45, 0x32, 0x59,
+0xC0, 0xA7, 0x2A, 0x78, 0x5A, 0xC5, 0x0A, 0x3C, 0x68, 0x2B, 0xE4, 0x19, 0x48, 0x2B, 0xC8, 0x2B,
+0x65, 0x1A, 0x46, 0x00, 0xC0, 0x08, 0x2B, 0x64, 0x66, 0xC4, 0xAA, 0x4A, 0x6D, 0x63, 0x68, 0x4A,
+0x0C, 0x63, 0x68, 0x52, 0x91, 0xC2, 0x0C, 0x6B, 0xCB, 0x52, 0xE6, 0x29, 0x6B, 0xC1, 0xEA, 0x42,
+0xC9, 0x5A, 0xA5, 0xC2, 0x68, 0x42, 0xC8, 0x32, 0x66, 0x22, 0x66, 0xC0, 0x45, 0x1A, 0x00, 0xC4,
+0xC4, 0x21, 0x04, 0x2A, 0x48, 0x33, 0xE7, 0x2A, 0x04, 0x22, 0xB3, 0x66, 0x00, 0xC0, 0xE4, 0x21,
+0x55, 0xC0, 0x06, 0x22, 0xAD, 0xA5, 0x66, 0xC0, 0xE5, 0x19, 0xA9, 0xC1, 0x85, 0x1A, 0xC5, 0x22,
+0xAF, 0xC0, 0x47, 0x2B, 0x91, 0x05, 0xA7, 0xAE, 0xC2, 0x45, 0x1A, 0xE4, 0x19, 0x67, 0x2B, 0x00,
+0x6E, 0xC2, 0xC6, 0x3A, 0x8D, 0xAC, 0xCD, 0xC4, 0x63, 0xC0, 0x8C, 0xB4, 0xAE, 0xBF, 0x4F, 0xC2,
+0x2E, 0xBD, 0x70, 0x7C, 0xFA, 0xAD, 0x90, 0xC7, 0xBC, 0xCE, 0x4E, 0x53, 0xB4, 0x84, 0xB0, 0x63,
+0x78, 0xA5, 0xA5, 0x19, 0x86, 0x42, 0xC9, 0x83, 0x81, 0xC1, 0x05, 0x2A, 0x84, 0x11, 0xBE, 0xA6,
+0x00, 0x5E, 0x52, 0xC1, 0x14, 0x8D, 0x35, 0x9D, 0x4D, 0x52, 0xC2, 0xA6, 0x4A, 0x0F, 0xC5, 0x0E,
+0xA4, 0x82, 0x95, 0xBE, 0xC6, 0xCC, 0xBC, 0xEA, 0x7C, 0xA6, 0x1B, 0x51, 0x85, 0x38, 0xCE, 0xFB,
+0xE6, 0xBF, 0xFF, 0x71, 0x03, 0xC1, 0x5C, 0xEF, 0xB5, 0xCD, 0xAE, 0x00, 0xBE, 0xC8, 0x2F, 0x94,
+0x70, 0x9C, 0x16, 0xD6, 0x0B, 0x6B, 0x53, 0xBD, 0x94, 0xC5, 0xAD, 0x83, 0xD1, 0xAC, 0xB4, 0xCD,
+0xAF, 0x05, 0x78, 0xC0, 0xDA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0xA6, 0xC1,
+0x34, 0xA6, 0x26, 0x2C, 0xA7, 0xC1, 0x85, 0x22, 0x84, 0x11, 0x01, 0x61, 0xAB, 0x00, 0x5E, 0x00,
+0x55, 0xC0, 0x07, 0x33, 0x66, 0x92, 0x66, 0x61, 0x01, 0x6D, 0xAE, 0xC1, 0xA6, 0x22, 0xE4, 0x19,
+0x61, 0x00, 0x66, 0xC2, 0x06, 0x1A, 0x28, 0x33, 0xAC, 0xA4, 0x63, 0x96, 0xBA, 0xC0, 0xA6, 0x42,
+0x5A, 0xC1, 0x07, 0x2B, 0xA4, 0x11, 0x66, 0xC3, 0x88, 0x2B, 0x06, 0x23, 0x84, 0x11, 0xC6, 0x22,
+0xA5, 0x64, 0xC0, 0xC8, 0x33, 0x5F, 0x78, 0x5F, 0xC0, 0x83, 0x11, 0x00, 0xC4, 0xA5, 0x1A, 0xE5,
+0x22, 0xE8, 0x32, 0x66, 0x2A, 0xE3, 0x19, 0x4D, 0xA6, 0x66, 0xC0, 0x27, 0x2B, 0xAE, 0x5E, 0x4D,
+0x9A, 0x62, 0xC0, 0xA7, 0x2B, 0x5F, 0xC5, 0x28, 0x2B, 0x68, 0x2B, 0x48, 0x6B, 0xC9, 0x93, 0x69,
+0x5B, 0x8B, 0x3B, 0x61, 0xC8, 0x0C, 0x9C, 0xC7, 0x42, 0x0F, 0x7C, 0x92, 0x9C, 0x85, 0x31, 0xC6,
+0x31, 0xB1, 0x9C, 0x8D, 0x6B, 0x86, 0x2A, 0x78, 0x7D, 0x5F, 0x00, 0xC0, 0x06, 0x23, 0x7D, 0x00,
+0x99, 0x00, 0xA7, 0xA6, 0xA9, 0x00, 0x70, 0xA6, 0x64, 0x69, 0x00, 0x7D, 0xC5, 0xA5, 0x22, 0xE4,
+0x19, 0x46, 0x3A, 0xA7, 0x42, 0x88, 0x4B, 0x86, 0x3A, 0x59, 0xAE, 0x96, 0x5E, 0xC2, 0x68, 0x32,
+0xD0, 0x5B, 0xAB, 0x3A, 0x96, 0xC0, 0x48, 0x22, 0xBF, 0xC2, 0xEC, 0x42, 0xAF, 0x5B, 0xA5, 0x11,
+0x4A, 0xC0, 0x83, 0x09, 0xA7, 0xA9, 0x66, 0x00, 0xA6, 0x01, 0x4D, 0xC6, 0xF4, 0x8C, 0x55, 0x9D,
+0x44, 0x11, 0x84, 0x11, 0xC4, 0x19, 0x48, 0x73, 0x0A, 0xA4, 0x91, 0x01, 0xC7, 0x08, 0x84, 0xE6,
+0x3B, 0xA6, 0x23, 0x35, 0xA6, 0xBF, 0xFF, 0x7A, 0xD6, 0xFC, 0xE6, 0xFF, 0xFF, 0x03, 0xC1, 0x3C,
+0xEF, 0xB4, 0xCD, 0xAF, 0x00, 0xC3, 0x16, 0xD6, 0x2F, 0x94, 0x89, 0x5A, 0xEB, 0x6A, 0x5C, 0x4C,
+0x00, 0xC1, 0xEE, 0x8B, 0x53, 0xBD, 0x4C, 0x96, 0x05, 0x78, 0xC0, 0xD9, 0xE6, 0x71, 0x0E, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0xC1, 0x76, 0xB6, 0x27, 0x2C, 0xB6, 0x55, 0xC0, 0x24, 0x22,
+0xAE, 0x92, 0xC0, 0xA4, 0x11, 0x61, 0x01, 0x66, 0x5E, 0xC0, 0x46, 0x22, 0x7B, 0x66, 0x61, 0x02,
+0xC0, 0xC5, 0x19, 0x50, 0xC0, 0xC7, 0x2A, 0x92, 0xC0, 0x64, 0x11, 0x5E, 0x00, 0xC3, 0x06, 0x1A,
+0x07, 0x23, 0x69, 0x6B, 0xEE, 0xBC, 0xA9, 0xC0, 0xEA, 0x8B, 0x6E, 0xC1, 0x07, 0x2B, 0xA4, 0x11,
+0x5E, 0x00, 0xC1, 0xE4, 0x19, 0xC6, 0x22, 0x5E, 0x59, 0x52, 0xC0, 0xC4, 0x19, 0x46, 0x63, 0x57,
+0x5E, 0x01, 0x6B, 0xC1, 0xE5, 0x22, 0x25, 0x23, 0xA6, 0xC1, 0xA6, 0x2B, 0x46, 0x2B, 0x66, 0x57,
+0xC2, 0x08, 0x2B, 0xEA, 0x43, 0xE4, 0x29, 0x96, 0xAF, 0xC3, 0xCA, 0x4B, 0x2A, 0x3C, 0x04, 0x1A,
+0xE6, 0x22, 0x00, 0xCC, 0x89, 0x73, 0x8B, 0xB4, 0x68, 0x5B, 0xA7, 0x22, 0xCA, 0x83, 0x4C, 0xAC,
+0x27, 0x53, 0xAE, 0x6B, 0x11, 0x8C, 0xE3, 0x28, 0x25, 0x29, 0x93, 0x9C, 0x31, 0x8C, 0x50, 0x73,
+0xC0, 0x85, 0x1A, 0x64, 0xC0, 0x65, 0x22, 0x78, 0x69, 0xAE, 0x00, 0x69, 0xC1, 0x27, 0x2B, 0xA6,
+0x22, 0x5E, 0xBE, 0x63, 0x00, 0xA9, 0x6B, 0x46, 0x41, 0x63, 0x5E, 0x59, 0xC1, 0xE4, 0x11, 0x86,
+0x1A, 0x6B, 0xC0, 0xA7, 0x52, 0xBA, 0x95, 0x7B, 0x00, 0x6C, 0xBE, 0x7B, 0xAE, 0x00, 0x7B, 0x00,
+0xBF, 0x9A, 0x40, 0x47, 0xAE, 0x6B, 0x5E, 0xBA, 0x00, 0x66, 0x4D, 0xC1, 0xF4, 0x8C, 0x35, 0x9D,
+0x4D, 0x5E, 0x01, 0xC1, 0xC4, 0x21, 0x04, 0x22, 0xAE, 0xC0, 0x64, 0x22, 0x9E, 0xC3, 0x45, 0x23,
+0xC6, 0x23, 0x97, 0xB6, 0xFF, 0xFF, 0xA2, 0xA9, 0xAF, 0x71, 0x02, 0xC1, 0x7D, 0xF7, 0xB4, 0xCD,
+0x44, 0x01, 0xC2, 0x73, 0xC5, 0x70, 0x9C, 0xB1, 0xA4, 0x44, 0x01, 0xC1, 0x53, 0xBD, 0xB4, 0xC5,
+0x44, 0x06, 0xA1, 0xC0, 0xFA, 0xE6, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A, 0xC1, 0x59,
+0xCE, 0xBE, 0xF7, 0x71, 0xC3, 0xFB, 0xE6, 0x9A, 0xD6, 0x75, 0xB5, 0xD3, 0x9C, 0x48, 0x71, 0x03,
+0xC1, 0x5C, 0xEF, 0xDF, 0xFF, 0x71, 0x01, 0x6C, 0xC1, 0xB8, 0xC6, 0x48, 0x34, 0xA5, 0xC1, 0x07,
+0x54, 0xC7, 0x7B, 0xBF, 0x86, 0xC0, 0xA5, 0x3A, 0x63, 0xB6, 0x00, 0x5E, 0x4D, 0x52, 0x46, 0xC0,
+0xC6, 0x2A, 0x66, 0x92, 0x5E, 0x01, 0xC2, 0x87, 0x22, 0xE9, 0x33, 0xC6, 0x22, 0x4D, 0x5E, 0x00,
+0xC5, 0xC5, 0x11, 0x07, 0x2B, 0xE4, 0x19, 0x66, 0x3A, 0xC6, 0x4A, 0xC7, 0x32, 0x9E, 0xC0, 0x83,
+0x11, 0xAB, 0x01, 0x63, 0x69, 0xC0, 0xC4, 0x11, 0x5E, 0x00, 0x52, 0x00, 0x5E, 0x02, 0x63, 0x57,
+0x5E, 0xC0, 0x86, 0x22, 0x4E, 0x91, 0xC0, 0x28, 0x34, 0x49, 0x52, 0xC2, 0xF0, 0x73, 0x55, 0xB5,
+0xEB, 0x93, 0xA5, 0xC3, 0x53, 0xB5, 0x92, 0x8C, 0x06, 0x22, 0x63, 0x11, 0x57, 0xC3, 0x45, 0x1A,
+0xE6, 0x32, 0x24, 0x32, 0x88, 0x32, 0xAB, 0xC2, 0x66, 0x2A, 0x06, 0x43, 0x85, 0x2A, 0x41, 0xC0,
+0x05, 0x2A, 0xAF, 0xBB, 0xA9, 0x8E, 0x91, 0x41, 0xC0, 0x85, 0x22, 0x64, 0xC1, 0x04, 0x1A, 0x06,
+0x23, 0x69, 0x02, 0xC0, 0x26, 0x23, 0x5F, 0xC0, 0x84, 0x11, 0x03, 0x66, 0xA6, 0x5E, 0x00, 0x63,
+0x5E, 0x75, 0xC3, 0x85, 0x1A, 0x45, 0x32, 0xCC, 0xB4, 0xCC, 0xC4, 0x96, 0xBF, 0x5A, 0x52, 0x5A,
+0x00, 0xA1, 0x5A, 0xBF, 0x9A, 0x00, 0xBB, 0x61, 0x66, 0x9E, 0xC0, 0x45, 0x2A, 0x7C, 0xC0, 0xA4,
+0x19, 0xA6, 0x00, 0x4D, 0xC6, 0xF4, 0x84, 0x15, 0x95, 0x64, 0x11, 0xA7, 0x52, 0xA9, 0x8B, 0x29,
+0x7B, 0xE4, 0x21, 0x57, 0x5E, 0xAD, 0x6B, 0xC3, 0x05, 0x23, 0xE6, 0x23, 0x97, 0xB6, 0xFF, 0xFF,
+0x01, 0xA6, 0x71, 0x03, 0xC1, 0x57, 0xDE, 0x94, 0xC5, 0xBE, 0x01, 0xC0, 0xF5, 0xD5, 0xA6, 0x78,
+0x01, 0x44, 0x78, 0x06, 0xA6, 0xC0, 0xF6, 0xD5, 0x60, 0x71, 0x0E, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x1A, 0xC1, 0x71, 0x8C, 0x59, 0xCE, 0x71, 0xC6, 0xB2, 0x94, 0x55, 0xAD, 0xAE, 0x73, 0xF7, 0xBD,
+0x6E, 0x73, 0x3C, 0xE7, 0x9E, 0xF7, 0x48, 0x71, 0x00, 0xC0, 0x51, 0x8C, 0x51, 0xC0, 0xDF, 0xFF,
+0x71, 0x00, 0x6C, 0xC9, 0x14, 0x9E, 0x27, 0x24, 0xA9, 0x64, 0x69, 0xA4, 0xEE, 0xBC, 0x55, 0xDE,
+0x92, 0xCD, 0x4B, 0xA4, 0x85, 0x3A, 0x84, 0x11, 0xA6, 0xC6, 0xC6, 0x21, 0xAE, 0x5B, 0x68, 0x32,
+0xA9, 0x3A, 0xAC, 0x4B, 0x08, 0x33, 0x87, 0x4A, 0xAF, 0xAD, 0xB2, 0x70, 0xC0, 0xE7, 0x4A, 0xA1,
+0x70, 0xBE, 0x73, 0x99, 0xC2, 0x86, 0x32, 0x4E, 0x5C, 0xCA, 0x3A, 0x00, 0xC0, 0x91, 0x6C, 0x4E,
+0xC0, 0x66, 0x42, 0x70, 0xB9, 0x69, 0x70, 0xC1, 0xC9, 0x73, 0xC7, 0x52, 0xAB, 0x73, 0x70, 0xAE,
+0xC0, 0x05, 0x2A, 0x5E, 0x66, 0xC5, 0x06, 0x2A, 0xA5, 0x29, 0x06, 0x32, 0x47, 0x32, 0xAD, 0x53,
+0x29, 0x33, 0x4C, 0xC5, 0xB1, 0x84, 0xEE, 0x6B, 0xC5, 0x21, 0x92, 0x8C, 0xD4, 0xAC, 0x2B, 0xAC,
+0xA1, 0xC3, 0x95, 0xCD, 0x14, 0x9D, 0x05, 0x22, 0x63, 0x11, 0x00, 0xC1, 0xC6, 0x22, 0x24, 0x1A,
+0x52, 0x5E, 0xC2, 0x46, 0x22, 0xE6, 0x22, 0x44, 0x1A, 0xAF, 0xC0, 0xA5, 0x22, 0x69, 0x00, 0x64,
+0x00, 0xC0, 0x06, 0x23, 0x00, 0xBA, 0x6E, 0x46, 0x64, 0x5F, 0x6B, 0x46, 0x58, 0x46, 0xC0, 0xE4,
+0x19, 0x00, 0x5F, 0xA6, 0x5E, 0x66, 0x64, 0x01, 0xBF, 0xC0, 0x04, 0x1A, 0x5E, 0x00, 0x75, 0xC3,
+0x85, 0x1A, 0x25, 0x32, 0xCC, 0xB4, 0xEC, 0xC4, 0xA6, 0xAF, 0xB5, 0x5A, 0x95, 0xB0, 0xC2, 0x26,
+0x93, 0x8A, 0xBC, 0x0C, 0xCD, 0xA7, 0x9E, 0x00, 0x66, 0xA6, 0xC3, 0x8B, 0xA4, 0x69, 0x3B, 0xA9,
+0x33, 0xC7, 0x2A, 0x59, 0x5E, 0x59, 0xC0, 0x14, 0x8D, 0xA6, 0xC5, 0x45, 0x3A, 0xCC, 0xBC, 0x0D,
+0xCD, 0x2E, 0xDD, 0x0A, 0x8C, 0x83, 0x11, 0xA7, 0x00, 0xC4, 0xA4, 0x19, 0x25, 0x23, 0xE6, 0x23,
+0xF3, 0x95, 0xFF, 0xFF, 0xA6, 0x01, 0x71, 0x03, 0x6C, 0xC1, 0xD9, 0xE6, 0x57, 0xDE, 0x0F, 0xC1,
+0x99, 0xDE, 0x9E, 0xF7, 0x71, 0x0F, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A, 0xC1, 0x18, 0xC6, 0xD3,
+0x9C, 0x71, 0xC2, 0x10, 0x84, 0xDB, 0xDE, 0xF0, 0x83, 0x5C, 0x40, 0xC3, 0x3C, 0xE7, 0xB6, 0xB5,
+0x51, 0x8C, 0xF3, 0x9C, 0x71, 0xC3, 0x4D, 0x6B, 0xEF, 0x7B, 0x5D, 0xEF, 0xFF, 0xFF, 0x00, 0x58,
+0xC4, 0x0D, 0x6D, 0x67, 0x34, 0x0B, 0x9D, 0x6F, 0xCD, 0x9C, 0xFF, 0x71, 0xA6, 0xC1, 0x13, 0xDE,
+0xA8, 0x83, 0x63, 0x59, 0xC7, 0xA6, 0x19, 0xB8, 0xA5, 0x31, 0x74, 0x73, 0x7C, 0x77, 0x9D, 0x09,
+0x43, 0xAD, 0xB4, 0xED, 0xBC, 0x9A, 0xB6, 0x56, 0xA6, 0x5E, 0x00, 0xA9, 0x01, 0xC6, 0x27, 0x5B,
+0x54, 0x85, 0xF3, 0x84, 0xCB, 0x42, 0x5A, 0xBE, 0xC8, 0x42, 0x8C, 0xAC, 0xBE, 0xB6, 0x4F, 0xA6,
+0x4F, 0x00, 0x4A, 0x01, 0xC2, 0xED, 0xC4, 0x28, 0x5B, 0x43, 0x09, 0xBE, 0xC0, 0xCA, 0x4A, 0x7C,
+0xC4, 0x34, 0xB5, 0xCB, 0x5A, 0xED, 0x62, 0x6A, 0x4A, 0x72, 0x94, 0xB9, 0xC4, 0x15, 0xAD, 0xEA,
+0x4A, 0xE5, 0x21, 0x26, 0x3A, 0x66, 0x52, 0x56, 0x92, 0xC3, 0x68, 0x3A, 0x47, 0x33, 0xE6, 0x22,
+0x05, 0x1A, 0x50, 0xC0, 0x04, 0x1A, 0xA2, 0x69, 0xC0, 0x67, 0x2B, 0x6B, 0x52, 0xAF, 0xC0, 0x06,
+0x23, 0x50, 0xA6, 0xBE, 0x4B, 0xBA, 0xC0, 0xA5, 0x22, 0x00, 0x4E, 0x00, 0xC0, 0xA6, 0x22, 0xA6,
+0xC0, 0x25, 0x1A, 0x73, 0xC0, 0x49, 0x34, 0x64, 0xC3, 0xE4, 0x19, 0x45, 0x1A, 0xC8, 0x33, 0x27,
+0x2B, 0x6B, 0x64, 0x53, 0xC0, 0xE7, 0x22, 0x5F, 0x41, 0x69, 0xC0, 0xA4, 0x11, 0x5E, 0x6B, 0x69,
+0x4E, 0xC0, 0xC7, 0x52, 0xBE, 0x00, 0xA9, 0x45, 0xA5, 0xA6, 0xAD, 0xC1, 0xC6, 0x42, 0x27, 0x63,
+0xA6, 0x9A, 0x7D, 0xAE, 0x45, 0x00, 0xC0, 0x86, 0x42, 0x64, 0xC3, 0x88, 0x2B, 0x66, 0x22, 0x43,
+0x11, 0xA4, 0x19, 0x41, 0xC3, 0x13, 0x85, 0x75, 0x95, 0x68, 0x63, 0xCC, 0xC4, 0x96, 0xC1, 0x0D,
+0xCD, 0x70, 0xBD, 0x66, 0xC0, 0x43, 0x09, 0xBE, 0x66, 0xC3, 0x26, 0x23, 0xE6, 0x23, 0xB2, 0x85,
+0xFF, 0xFF, 0xA6, 0x01, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1A, 0xC3, 0x9E, 0xF7, 0x30,
+0x8C, 0x79, 0xCE, 0xD3, 0x9C, 0x58, 0xC2, 0x0C, 0x63, 0x10, 0x84, 0xAE, 0x73, 0x58, 0xC2, 0x1C,
+0xE7, 0x55, 0xAD, 0x4D, 0x6B, 0x71, 0xC0, 0xF3, 0xA4, 0x70, 0x71, 0x01, 0xC1, 0x3B, 0xDF, 0xCA,
+0x4C, 0x99, 0xC1, 0xAB, 0xA4, 0x33, 0xDE, 0x6C, 0x01, 0xC2, 0xD7, 0xEE, 0x6A, 0x9C, 0xE4, 0x19,
+0x5E, 0x4D, 0xC0, 0x0D, 0x53, 0x61, 0xC3, 0x8B, 0x3A, 0x53, 0x74, 0x67, 0x32, 0xCD, 0xB4, 0xBE,
+0x92, 0x5B, 0x00, 0x91, 0x5B, 0x02, 0xA9, 0xC6, 0x67, 0x5B, 0x8B, 0x3B, 0xF4, 0x84, 0x27, 0x22,
+0x92, 0x74, 0xC9, 0x4A, 0x8B, 0xAC, 0xBF, 0x01, 0xA6, 0x95, 0xBE, 0x4F, 0x4A, 0x40, 0xC2, 0xCD,
+0xBC, 0x48, 0x5B, 0x43, 0x09, 0x4D, 0xCA, 0xEA, 0x52, 0x38, 0xCE, 0xB7, 0xC5, 0xCC, 0x62, 0x29,
+0x4A, 0x6B, 0x52, 0x14, 0xB5, 0x72, 0x94, 0x56, 0xB5, 0xAF, 0x6C, 0xE9, 0x33, 0xA6, 0x90, 0x92,
+0xC6, 0xC4, 0x11, 0x22, 0x11, 0xA6, 0x22, 0x29, 0x34, 0x07, 0x23, 0x28, 0x33, 0x05, 0x1A, 0x4E,
+0xC2, 0x09, 0x34, 0x06, 0x23, 0x66, 0x22, 0x95, 0xAE, 0xC0, 0x27, 0x2B, 0xB3, 0xBB, 0xC1, 0xE7,
+0x22, 0xE4, 0x19, 0x00, 0xC0, 0x27, 0x2B, 0x69, 0xC0, 0x83, 0x11, 0x00, 0xC1, 0xC4, 0x19, 0x67,
+0x2B, 0x4C, 0xC0, 0x85, 0x22, 0x69, 0x5F, 0xC5, 0x88, 0x2B, 0x27, 0x23, 0x25, 0x1A, 0x85, 0x22,
+0x28, 0x2B, 0x09, 0x3B, 0x96, 0xC0, 0x88, 0x33, 0x47, 0xC0, 0x84, 0x11, 0x69, 0x6B, 0xA6, 0x6B,
+0xC5, 0x24, 0x1A, 0x28, 0x2B, 0x26, 0x22, 0x23, 0x09, 0xE6, 0x21, 0x88, 0x32, 0xA6, 0x6E, 0x69,
+0xAF, 0x80, 0xC0, 0x63, 0x09, 0x5E, 0xC1, 0xE6, 0x19, 0xCA, 0x3A, 0x6E, 0x96, 0xA6, 0x69, 0x75,
+0xC0, 0xC5, 0x19, 0x00, 0xC0, 0x27, 0x2A, 0x6B, 0xC5, 0x69, 0x3B, 0xD6, 0x9D, 0xB6, 0xAD, 0xE5,
+0x21, 0xCA, 0x8B, 0xCD, 0xBC, 0xAE, 0xC1, 0x49, 0x6B, 0x84, 0x11, 0x69, 0xC0, 0x85, 0x19, 0x5E,
+0xC3, 0x25, 0x23, 0x06, 0x24, 0xF2, 0x85, 0xFF, 0xFF, 0xA6, 0x01, 0x71, 0x29, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x1B, 0xC0, 0xB2, 0x94, 0x5D, 0xC2, 0x59, 0xCE, 0x5D, 0xEF, 0x72, 0x94, 0x71, 0xC2,
+0xD3, 0x9C, 0x96, 0xB5, 0x51, 0x8C, 0x74, 0x5D, 0x6C, 0x7C, 0xC0, 0x1C, 0xE7, 0x71, 0x01, 0xC1,
+0x3B, 0xDF, 0xC9, 0x3C, 0x91, 0xC2, 0x8A, 0x8C, 0x4F, 0xCD, 0x9C, 0xFF, 0x71, 0xC3, 0x3C, 0xEF,
+0x2D, 0x94, 0x88, 0x7B, 0xA4, 0x19, 0x91, 0xC1, 0xAA, 0x3A, 0xB4, 0x7C, 0xA1, 0xC3, 0x36, 0x95,
+0x72, 0x74, 0x26, 0x2A, 0xCD, 0xB4, 0xBD, 0x9B, 0x5B, 0x01, 0x60, 0x00, 0x5B, 0x00, 0x60, 0xC2,
+0x88, 0x63, 0xD2, 0x74, 0xF5, 0x8C, 0x57, 0xC1, 0x35, 0x85, 0xA8, 0x42, 0x40, 0xBE, 0xAE, 0x48,
+0xAB, 0x00, 0xA6, 0x4F, 0x4A, 0x7B, 0xC7, 0xAC, 0xBC, 0xE7, 0x52, 0x64, 0x09, 0x87, 0x22, 0xC8,
+0x32, 0x8D, 0x63, 0x51, 0x94, 0x6A, 0x52, 0x96, 0x91, 0xC1, 0xEC, 0x6A, 0xAF, 0x7B, 0xAE, 0xC4,
+0x0B, 0x4B, 0xB3, 0x7C, 0x7A, 0xB6, 0x2F, 0x64, 0x83, 0x11, 0xA6, 0xAB, 0xC5, 0xA4, 0x19, 0x85,
+0x1A, 0x0E, 0x54, 0x19, 0xAE, 0x51, 0x6C, 0x46, 0x22, 0x9D, 0xA2, 0xC7, 0x88, 0x2B, 0x27, 0x23,
+0xA5, 0x1A, 0xAF, 0x5C, 0xF8, 0xA5, 0x13, 0x7D, 0xC9, 0x33, 0xE4, 0x19, 0x00, 0xC0, 0xA8, 0x2B,
+0x73, 0x57, 0x52, 0x00, 0xC0, 0xD0, 0x74, 0x72, 0x52, 0x00, 0x70, 0x47, 0xC4, 0xC6, 0x22, 0x45,
+0x1A, 0xA5, 0x22, 0x67, 0x2A, 0x76, 0x9D, 0x77, 0xC1, 0x29, 0x33, 0x04, 0x1A, 0x57, 0xC0, 0x85,
+0x22, 0xAB, 0xC3, 0x25, 0x22, 0x07, 0x2B, 0x68, 0x33, 0xB7, 0x9D, 0x4F, 0xC3, 0xCA, 0x3A, 0xB1,
+0x74, 0xDC, 0xC6, 0x7A, 0xBE, 0xAE, 0xAB, 0xC5, 0xDB, 0xC6, 0x92, 0x74, 0xEF, 0x63, 0xD3, 0x84,
+0x4D, 0x4B, 0x5A, 0xBE, 0x96, 0x00, 0xA6, 0x6D, 0x00, 0xD3, 0x2D, 0x53, 0xF4, 0x8C, 0xD8, 0xA5,
+0x0B, 0x43, 0x55, 0x8D, 0x9B, 0xC6, 0xCF, 0x6B, 0x43, 0x09, 0xC5, 0x21, 0x87, 0x4A, 0x26, 0x3A,
+0x43, 0x11, 0x30, 0x6C, 0xFA, 0xB5, 0x12, 0x74, 0x84, 0x19, 0x25, 0x23, 0x06, 0x24, 0xF2, 0x85,
+0xFF, 0xFF, 0xA6, 0x01, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC1, 0xD7, 0xBD, 0xE7,
+0x41, 0x6C, 0xC3, 0x5D, 0xEF, 0x0C, 0x63, 0x14, 0xA5, 0x6E, 0x73, 0x74, 0xC2, 0x10, 0x84, 0xB6,
+0xB5, 0xCB, 0x5A, 0x6C, 0xC2, 0x34, 0xA5, 0x71, 0x8C, 0x9E, 0xF7, 0x71, 0x00, 0xC8, 0x3B, 0xD7,
+0xE9, 0x3C, 0x87, 0x2C, 0x48, 0x54, 0x4A, 0xA4, 0x90, 0xD5, 0xB6, 0xEE, 0xB1, 0xD5, 0x64, 0x31,
+0x8A, 0xC0, 0xC5, 0x29, 0xB6, 0xC3, 0x07, 0x3A, 0x8E, 0x5B, 0x08, 0x2A, 0x6F, 0x5B, 0xAE, 0xC1,
+0xC5, 0x19, 0x87, 0x42, 0xBA, 0x9E, 0xA9, 0xA6, 0x6D, 0x72, 0x00, 0x6B, 0x00, 0xBB, 0xC2, 0xA7,
+0x32, 0x6E, 0x5C, 0x89, 0x32, 0x5D, 0xC1, 0x2E, 0x5C, 0xE5, 0x21, 0x66, 0xA6, 0x66, 0x01, 0x6B,
+0x66, 0x01, 0x61, 0x00, 0xC7, 0x25, 0x2A, 0xA6, 0x22, 0xE8, 0x33, 0x85, 0x22, 0x44, 0x11, 0x44,
+0x21, 0xC5, 0x21, 0x27, 0x2A, 0x9D, 0xC1, 0xA4, 0x19, 0x05, 0x22, 0xAE, 0x50, 0xAF, 0xC2, 0x56,
+0x8D, 0xCE, 0x5B, 0x45, 0x1A, 0xBF, 0x01, 0xC2, 0xA6, 0x22, 0xD7, 0x9D, 0x73, 0x7C, 0x60, 0xC0,
+0xA9, 0x33, 0x41, 0xC0, 0x83, 0x11, 0x46, 0xC4, 0xA5, 0x22, 0x04, 0x12, 0x53, 0x85, 0x3A, 0xBE,
+0x2E, 0x54, 0x64, 0x52, 0xC0, 0xC4, 0x19, 0x64, 0x53, 0x46, 0x41, 0xC2, 0xA8, 0x2A, 0xDC, 0xCE,
+0x71, 0x7C, 0x72, 0xC0, 0x45, 0x22, 0x46, 0x00, 0x64, 0x00, 0x41, 0x4B, 0xC2, 0x90, 0x64, 0xF9,
+0xB5, 0x84, 0x19, 0x57, 0x00, 0xAE, 0x5F, 0xC1, 0x06, 0x23, 0x46, 0x23, 0x4E, 0x56, 0xC0, 0xB4,
+0x84, 0x9C, 0xC1, 0x86, 0x22, 0xE9, 0x32, 0x02, 0xAE, 0xC0, 0x87, 0x22, 0x69, 0xC2, 0xF8, 0xAD,
+0xA5, 0x19, 0xE7, 0x21, 0xBF, 0xBE, 0x9A, 0x00, 0x48, 0xC4, 0x4D, 0x53, 0xF5, 0x8C, 0xAF, 0x63,
+0x73, 0x7C, 0xA6, 0x21, 0x48, 0x6D, 0x76, 0xA2, 0x99, 0x85, 0xC7, 0x68, 0x32, 0x77, 0xA5, 0x09,
+0x32, 0xB0, 0x63, 0xC6, 0x21, 0x05, 0x23, 0x06, 0x24, 0xF2, 0x8D, 0x71, 0xA6, 0x01, 0x71, 0x29,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1B, 0xC1, 0x9E, 0xF7, 0xBA, 0xD6, 0x71, 0x6C, 0xC2, 0x18, 0xC6,
+0x96, 0xB5, 0xDB, 0xDE, 0x71, 0xC1, 0x9A, 0xD6, 0x75, 0xAD, 0x4D, 0x71, 0x91, 0x4C, 0xC0, 0x7D,
+0xEF, 0x71, 0x00, 0xC7, 0x3B, 0xDF, 0x0A, 0x45, 0xC7, 0x2C, 0xE6, 0x2B, 0xA7, 0x43, 0xC8, 0x73,
+0xE9, 0x8B, 0x68, 0x73, 0x62, 0xC2, 0xC3, 0x18, 0x24, 0x31, 0x85, 0x49, 0x96, 0x89, 0xC0, 0x64,
+0x19, 0x95, 0xAF, 0xBE, 0x59, 0x4D, 0x00, 0xAB, 0x59, 0x00, 0xA9, 0x59, 0x52, 0x00, 0x59, 0xC1,
+0xC7, 0x2A, 0x26, 0x23, 0x4B, 0xC1, 0xA6, 0x22, 0x27, 0x2B, 0x41, 0x52, 0x02, 0x59, 0x00, 0x52,
+0x00, 0x59, 0x52, 0x00, 0xC1, 0xA4, 0x11, 0x48, 0x2B, 0x7D, 0x59, 0x00, 0x4D, 0xC1, 0xA4, 0x19,
+0x85, 0x22, 0x9A, 0xC0, 0xC3, 0x19, 0x00, 0xAF, 0x00, 0xC1, 0x67, 0x2A, 0x76, 0x95, 0x5F, 0xC0,
+0x04, 0x1A, 0xAB, 0x00, 0x75, 0xC1, 0x46, 0x22, 0x19, 0xB6, 0x92, 0xC1, 0x13, 0x7D, 0xC6, 0x22,
+0x66, 0x52, 0x75, 0x7D, 0xC4, 0x85, 0x1A, 0x6C, 0x43, 0x51, 0x74, 0x97, 0x9D, 0x0B, 0x43, 0x63,
+0xC1, 0x07, 0x2B, 0x86, 0x22, 0x46, 0xC0, 0xA6, 0x22, 0x99, 0x7A, 0xC2, 0xDD, 0xCE, 0x71, 0x74,
+0x85, 0x1A, 0x5F, 0x00, 0xA9, 0x53, 0xC0, 0xC6, 0x22, 0xAE, 0xC4, 0x24, 0x1A, 0xEB, 0x3A, 0xB8,
+0xA5, 0xEB, 0x42, 0xC4, 0x11, 0x63, 0x70, 0x75, 0x69, 0x5A, 0x63, 0xBF, 0x45, 0x7B, 0xC0, 0x83,
+0x11, 0x63, 0x02, 0xA9, 0x57, 0xC0, 0x2B, 0x43, 0x76, 0x6D, 0x52, 0xAF, 0x57, 0x52, 0x59, 0x91,
+0xC0, 0xEF, 0x63, 0x42, 0xC1, 0x2C, 0x4B, 0x15, 0x95, 0x4D, 0xC3, 0x84, 0x19, 0xA5, 0x39, 0x65,
+0x49, 0xC5, 0x51, 0x92, 0x81, 0xC0, 0xCA, 0x4A, 0x42, 0xC1, 0x27, 0x2A, 0x8A, 0x3A, 0x61, 0xC2,
+0x05, 0x23, 0x26, 0x24, 0x12, 0x86, 0x71, 0xA6, 0x02, 0x71, 0x28, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x2C, 0xC5, 0x5C, 0xE7, 0x2B, 0x4D, 0xA7, 0x2C, 0x06, 0x2C, 0xC5, 0x1A, 0x24, 0x1A, 0xAE, 0x7A,
+0xC7, 0x64, 0x21, 0xC3, 0x20, 0x87, 0x6A, 0x4B, 0xA4, 0x08, 0x83, 0x65, 0x49, 0xA5, 0x29, 0x84,
+0x11, 0x61, 0x01, 0x5E, 0x00, 0x61, 0x06, 0xC5, 0x66, 0x22, 0x87, 0x2B, 0x65, 0x1A, 0xA6, 0x22,
+0x88, 0x2B, 0x04, 0x1A, 0x57, 0x5E, 0x61, 0x5E, 0x02, 0x52, 0x57, 0x00, 0xA7, 0x00, 0x5E, 0x57,
+0x59, 0x52, 0x01, 0x59, 0x4D, 0x01, 0x52, 0x91, 0x7B, 0xC0, 0x94, 0x7C, 0x4A, 0x4D, 0x00, 0x52,
+0x4D, 0xC4, 0xA5, 0x21, 0x16, 0x8D, 0xAB, 0x42, 0x36, 0x95, 0xA5, 0x19, 0x4D, 0x52, 0xC0, 0xC4,
+0x19, 0x69, 0x5F, 0xC4, 0x6B, 0x3B, 0x86, 0x1A, 0x35, 0x85, 0x0E, 0x64, 0xA5, 0x1A, 0x41, 0x4D,
+0xC0, 0x65, 0x22, 0x64, 0xA2, 0xC3, 0xD3, 0x7C, 0xBC, 0xCE, 0xD8, 0xAD, 0xA7, 0x22, 0xA4, 0x01,
+0x5F, 0x46, 0xC7, 0xE5, 0x19, 0x4A, 0x3B, 0x67, 0x22, 0x72, 0x74, 0x12, 0x75, 0xE6, 0x22, 0xE4,
+0x19, 0xC6, 0x2A, 0x7D, 0x7A, 0x53, 0x5F, 0xC1, 0xD1, 0x74, 0x93, 0x74, 0x4B, 0xC0, 0xA6, 0x22,
+0x04, 0x5A, 0xC1, 0xCC, 0x4B, 0xB7, 0xA5, 0x6D, 0x5E, 0x00, 0xBE, 0xC0, 0x05, 0x1A, 0x5A, 0x52,
+0x7B, 0xC1, 0xD4, 0x8C, 0x2D, 0x53, 0x7D, 0xC4, 0x43, 0x11, 0xA5, 0x21, 0x65, 0x41, 0xE8, 0x7A,
+0x4B, 0xB4, 0x86, 0xC2, 0xE6, 0x59, 0xA5, 0x31, 0x6E, 0x53, 0x7B, 0xC2, 0x19, 0xB6, 0xE6, 0x29,
+0x05, 0x23, 0x5B, 0xC0, 0x13, 0x8E, 0x71, 0x6C, 0x02, 0x71, 0x28, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x2C, 0xC3, 0x7D, 0xEF, 0xEC, 0x5C, 0x67, 0x2C, 0xE6, 0x2B, 0x46, 0x5E, 0xAE, 0x00, 0xC3, 0xA4,
+0x31, 0x44, 0x39, 0x67, 0x5A, 0xCC, 0xB4, 0xA5, 0xC1, 0x26, 0x62, 0x65, 0x31, 0x5E, 0x59, 0x01,
+0xBE, 0xA6, 0x00, 0x59, 0x61, 0x01, 0x5E, 0x61, 0x00, 0x66, 0xC0, 0xE4, 0x19, 0x92, 0x00, 0xB9,
+0x61, 0x5E, 0xA9, 0x59, 0x5E, 0x00, 0x59, 0xC1, 0xC5, 0x19, 0x46, 0x22, 0xA9, 0x50, 0x00, 0x49,
+0xA6, 0x50, 0x00, 0x44, 0x00, 0x41, 0x00, 0x7C, 0x44, 0x01, 0x41, 0xC1, 0x14, 0x85, 0xCE, 0x5B,
+0x41, 0x49, 0x00, 0x50, 0x49, 0x50, 0xC2, 0xB2, 0x74, 0x98, 0xA5, 0xF4, 0x84, 0x50, 0x49, 0x4E,
+0xAB, 0x5A, 0x96, 0xC3, 0xF3, 0x7C, 0x56, 0x95, 0x96, 0x95, 0xE8, 0x2A, 0x4E, 0x49, 0xC0, 0xA6,
+0x22, 0x00, 0x57, 0x00, 0x4D, 0xC1, 0xCF, 0x63, 0x11, 0x74, 0x4A, 0x57, 0xA6, 0x5E, 0x01, 0x7C,
+0xC4, 0xF1, 0x6C, 0xD7, 0x9D, 0x77, 0x95, 0xEC, 0x43, 0xE5, 0x22, 0x6B, 0x69, 0xC0, 0x27, 0x2B,
+0x70, 0xC4, 0x62, 0x11, 0x88, 0x32, 0xBC, 0xC6, 0xD5, 0x8C, 0x89, 0x32, 0x52, 0x57, 0x00, 0x5E,
+0x01, 0x52, 0xC0, 0xA9, 0x3A, 0x42, 0xC0, 0x84, 0x19, 0x5E, 0x00, 0x66, 0xC1, 0xE7, 0x2A, 0xE9,
+0x33, 0x77, 0xC3, 0x07, 0x2A, 0x56, 0x95, 0xB9, 0xA5, 0x4E, 0x5B, 0x4A, 0xCA, 0xC5, 0x29, 0x84,
+0x49, 0x0B, 0xA4, 0xAC, 0xBC, 0x8F, 0xCD, 0x4A, 0x83, 0x03, 0x29, 0x6D, 0x53, 0x57, 0x95, 0xB4,
+0x84, 0x85, 0x19, 0x67, 0xC2, 0x06, 0x24, 0x12, 0x8E, 0xFF, 0xFF, 0xA6, 0x01, 0x71, 0x29, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x2C, 0xC3, 0x9E, 0xF7, 0x0D, 0x6D, 0x47, 0x2C, 0xC7, 0x2B, 0x46, 0xC0,
+0xA4, 0x11, 0x6B, 0x63, 0xC6, 0xE5, 0x29, 0xA5, 0x51, 0x65, 0x39, 0x49, 0x83, 0xA9, 0x93, 0xC5,
+0x51, 0x85, 0x29, 0x5E, 0x00, 0xA5, 0xAB, 0x5C, 0x00, 0x59, 0x5C, 0x00, 0x59, 0x00, 0x5E, 0x05,
+0x59, 0x5C, 0x5E, 0x02, 0x52, 0x72, 0xC0, 0x07, 0x2B, 0x4E, 0x96, 0x00, 0xA6, 0x46, 0x00, 0x41,
+0x03, 0x46, 0x41, 0x03, 0xC1, 0x69, 0x2A, 0x06, 0x22, 0x41, 0x01, 0x49, 0x9A, 0xA5, 0xC0, 0x26,
+0x22, 0x7B, 0xC0, 0x27, 0x2A, 0x7C, 0x41, 0x00, 0x46, 0x01, 0xBB, 0x7B, 0xC1, 0x88, 0x32, 0x04,
+0x12, 0x7C, 0x41, 0xA5, 0x63, 0x5E, 0x00, 0x52, 0xC0, 0xE6, 0x19, 0xBF, 0x57, 0x00, 0x5E, 0x02,
+0x6B, 0xC3, 0x46, 0x1A, 0x8D, 0x53, 0x0B, 0x43, 0xC4, 0x11, 0xA5, 0x5E, 0x5C, 0x63, 0x5E, 0x57,
+0xC0, 0xE6, 0x21, 0x7B, 0xC2, 0xD0, 0x63, 0x89, 0x32, 0x63, 0x09, 0x5E, 0x59, 0x5E, 0x02, 0x63,
+0x7E, 0xC0, 0x84, 0x19, 0x5E, 0x59, 0x57, 0x4E, 0x5A, 0x61, 0x52, 0xC2, 0x49, 0x32, 0x0C, 0x4B,
+0xA5, 0x19, 0x5E, 0x66, 0xC5, 0x84, 0x41, 0x66, 0x6A, 0xCA, 0xA3, 0x2B, 0xAC, 0x27, 0x62, 0x63,
+0x29, 0x77, 0x40, 0x55, 0x5C, 0xC3, 0x25, 0x23, 0xE6, 0x23, 0x13, 0x8E, 0xFF, 0xFF, 0xA6, 0x01,
+0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0xC1, 0xD1, 0x8D, 0x06, 0x24, 0xA2, 0xC1,
+0x87, 0x3B, 0x67, 0x5B, 0xB5, 0xC0, 0xE6, 0x4A, 0x49, 0xC1, 0xC5, 0x39, 0x44, 0x41, 0x86, 0xC0,
+0x85, 0x49, 0x89, 0xC2, 0xE5, 0x21, 0x46, 0x42, 0x86, 0x52, 0xAE, 0xC0, 0x05, 0x32, 0x5E, 0x61,
+0x5E, 0x61, 0x96, 0x5E, 0xC0, 0x46, 0x3A, 0x6C, 0x00, 0x59, 0x5E, 0x03, 0x57, 0xC1, 0x25, 0x2A,
+0x85, 0x4A, 0xBE, 0x97, 0xC1, 0xC6, 0x32, 0x88, 0x2B, 0x49, 0xC0, 0x63, 0x11, 0x5E, 0x57, 0xC2,
+0xC4, 0x21, 0x45, 0x42, 0x65, 0x52, 0x00, 0xC0, 0xE4, 0x29, 0x52, 0x01, 0x57, 0x5E, 0xBE, 0x55,
+0xBE, 0xBB, 0xC0, 0xE5, 0x31, 0x57, 0x52, 0xAB, 0x52, 0x5E, 0xAD, 0xC1, 0x24, 0x3A, 0x45, 0x52,
+0x95, 0x9B, 0xC0, 0xA3, 0x19, 0x57, 0x59, 0x5E, 0x63, 0x00, 0xC2, 0x04, 0x2A, 0x45, 0x4A, 0x65,
+0x5A, 0x60, 0x6E, 0x52, 0x59, 0x5E, 0x01, 0xC0, 0xE4, 0x21, 0x62, 0xC0, 0x85, 0x5A, 0xAF, 0xC0,
+0x45, 0x32, 0x5E, 0x02, 0xAE, 0xC2, 0xE4, 0x19, 0x65, 0x42, 0xC6, 0x62, 0xAE, 0xC1, 0xA6, 0x42,
+0xC3, 0x11, 0x57, 0x5E, 0x00, 0x63, 0x5E, 0xC0, 0x04, 0x32, 0x7C, 0xBF, 0x71, 0xC0, 0xC4, 0x19,
+0x57, 0x5E, 0x02, 0x45, 0x74, 0xC0, 0xC7, 0x6A, 0x96, 0x7D, 0x57, 0x5E, 0x00, 0xBA, 0x5E, 0x6E,
+0x74, 0xC0, 0x07, 0x73, 0x4B, 0xC3, 0x65, 0x3A, 0xC4, 0x29, 0x65, 0x41, 0x85, 0x51, 0x96, 0xC0,
+0x84, 0x31, 0x76, 0xC7, 0x85, 0x52, 0xE6, 0x6A, 0x47, 0x73, 0x87, 0x5B, 0x85, 0x23, 0xC5, 0x23,
+0x34, 0x9E, 0xFF, 0xFF, 0xA6, 0x02, 0x71, 0x28, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0xC0,
+0x76, 0xB6, 0x51, 0xC8, 0x48, 0x4C, 0x49, 0x94, 0x6B, 0xA4, 0x30, 0xBD, 0xAD, 0xAC, 0x68, 0x7B,
+0x45, 0x2A, 0xC5, 0x29, 0x24, 0x29, 0xAE, 0x4C, 0xC4, 0x47, 0x73, 0x4B, 0xA4, 0x72, 0xC5, 0xEF,
+0xBC, 0xA9, 0x8B, 0x57, 0x63, 0x61, 0x9A, 0x66, 0xC1, 0xE7, 0x5A, 0xEA, 0x9B, 0x42, 0xA6, 0x5A,
+0xC0, 0xC6, 0x52, 0x66, 0x5E, 0x01, 0xC7, 0xA5, 0x42, 0xC9, 0x93, 0xEF, 0xB4, 0x51, 0xBD, 0x0B,
+0xA4, 0xC9, 0x83, 0x67, 0x3B, 0x83, 0x11, 0x5E, 0x00, 0x47, 0xC5, 0x69, 0x7B, 0xAE, 0xB4, 0x92,
+0xC5, 0x8E, 0xB4, 0x68, 0x83, 0x25, 0x32, 0x57, 0x00, 0x5E, 0xC6, 0xC4, 0x21, 0x27, 0x6B, 0x4C,
+0xA4, 0x72, 0xBD, 0xD0, 0xB4, 0x89, 0x93, 0x86, 0x4A, 0x5C, 0x57, 0x5E, 0x63, 0x76, 0xC0, 0x2B,
+0x9C, 0x5A, 0x4E, 0xC1, 0xEA, 0x9B, 0x06, 0x6B, 0x66, 0x57, 0x5E, 0x63, 0xC1, 0x85, 0x3A, 0xCA,
+0x93, 0x4E, 0x62, 0x7A, 0xC1, 0x27, 0x7B, 0x04, 0x2A, 0x5E, 0x57, 0x00, 0xC1, 0x24, 0x2A, 0x88,
+0x83, 0x42, 0xC3, 0xB3, 0xC5, 0x8E, 0xAC, 0x89, 0x8B, 0x85, 0x42, 0x57, 0x5E, 0x00, 0xC3, 0xE4,
+0x19, 0x48, 0x6B, 0xEE, 0xBC, 0xF4, 0xD5, 0x7D, 0xC2, 0xE9, 0x9B, 0x07, 0x63, 0xC4, 0x11, 0x5E,
+0x00, 0x63, 0xC2, 0xA6, 0x52, 0x8D, 0xB4, 0x14, 0xD6, 0x62, 0xC1, 0x0B, 0xA4, 0x48, 0x7B, 0x70,
+0x59, 0x5E, 0x00, 0xC2, 0x65, 0x3A, 0x6B, 0xA4, 0xD3, 0xD5, 0x92, 0xC1, 0x2C, 0xAC, 0xA9, 0x93,
+0x4F, 0xC0, 0x83, 0x11, 0xBB, 0x63, 0xC8, 0x25, 0x32, 0x0A, 0x9C, 0xF3, 0xD5, 0x15, 0xD6, 0x8C,
+0xBC, 0xC9, 0xA3, 0xC6, 0x4A, 0xA4, 0x21, 0x85, 0x31, 0x99, 0xC9, 0xE4, 0x21, 0x67, 0x7B, 0xB1,
+0xCD, 0x77, 0xDE, 0xEF, 0xBC, 0xE9, 0xA3, 0x68, 0x74, 0xC5, 0x23, 0x55, 0xA6, 0xFF, 0xFF, 0xA6,
+0x02, 0x71, 0x28, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0xC4, 0x56, 0xAE, 0x26, 0x34, 0xAA,
+0x94, 0xCD, 0xC4, 0x1A, 0xEF, 0x6C, 0xC0, 0x3B, 0xEF, 0x6A, 0xCB, 0x26, 0x63, 0xC3, 0x11, 0x64,
+0x19, 0x03, 0x19, 0x27, 0x63, 0x8C, 0xB4, 0xF8, 0xEE, 0xDE, 0xFF, 0x7C, 0xF7, 0x91, 0xC5, 0xA8,
+0x83, 0x04, 0x22, 0x5E, 0x59, 0xC3, 0x66, 0x3A, 0x6B, 0xAC, 0x55, 0xDE, 0x9D, 0xF7, 0xA6, 0xC1,
+0x35, 0xD6, 0x09, 0x9C, 0x4F, 0xC0, 0x84, 0x11, 0x00, 0x78, 0xC2, 0x09, 0x94, 0xF1, 0xDD, 0x7B,
+0xF7, 0x51, 0xC2, 0xB7, 0xDE, 0x4C, 0xAC, 0x46, 0x63, 0x61, 0x5E, 0xAE, 0xC2, 0x68, 0x6B, 0x6F,
+0xC5, 0x5A, 0xF7, 0x51, 0x71, 0xC3, 0xCF, 0xB4, 0x47, 0x7B, 0xC3, 0x19, 0x63, 0x11, 0x5E, 0xC2,
+0xA5, 0x4A, 0xAC, 0xB4, 0xF9, 0xEE, 0x51, 0x4C, 0xC2, 0xB3, 0xCD, 0x88, 0x8B, 0x44, 0x2A, 0x57,
+0x00, 0xC2, 0x44, 0x32, 0x2A, 0x9C, 0xB7, 0xE6, 0x51, 0x00, 0xC1, 0x57, 0xD6, 0x29, 0xAC, 0x67,
+0x52, 0x00, 0xC2, 0xE4, 0x21, 0xC9, 0x8B, 0x34, 0xDE, 0x51, 0xAE, 0xC2, 0xD8, 0xE6, 0x2B, 0xA4,
+0x27, 0x6B, 0x61, 0x5E, 0x68, 0xC4, 0x47, 0x63, 0xD1, 0xD5, 0x9C, 0xF7, 0xBE, 0xF7, 0x5B, 0xEF,
+0x6A, 0xC0, 0xC8, 0x8B, 0x78, 0x5E, 0x00, 0xC1, 0xE6, 0x4A, 0x4F, 0xCD, 0x72, 0x51, 0xA5, 0xC3,
+0x71, 0xC5, 0x2A, 0xA4, 0xA5, 0x3A, 0x83, 0x11, 0x5E, 0xC2, 0x45, 0x2A, 0xAC, 0xAC, 0x19, 0xF7,
+0x51, 0xBA, 0xC2, 0xF4, 0xD5, 0x2A, 0xAC, 0x27, 0x5B, 0x57, 0x5E, 0xC3, 0xE4, 0x19, 0x2A, 0x8C,
+0x18, 0xF7, 0xBD, 0xF7, 0xBA, 0xC3, 0x55, 0xDE, 0x8B, 0xBC, 0xA9, 0x7B, 0xA4, 0x11, 0xB6, 0x68,
+0xC1, 0x68, 0x73, 0x95, 0xE6, 0x65, 0x6C, 0xC4, 0xF8, 0xEE, 0x8C, 0xB4, 0x2B, 0x9C, 0x04, 0x22,
+0x63, 0x11, 0x9E, 0xC2, 0xC4, 0x4A, 0x32, 0xDE, 0xFF, 0xFF, 0x00, 0xC1, 0x7C, 0xF7, 0xCD, 0xC4,
+0x84, 0xC1, 0x27, 0x3C, 0x34, 0x9E, 0x71, 0x6C, 0x02, 0x71, 0x28, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x2C, 0x6C, 0xC3, 0x14, 0x9E, 0x47, 0x44, 0xAA, 0xA4, 0x33, 0xE6, 0x6C, 0x00, 0x71, 0xC7, 0x14,
+0xD6, 0xC8, 0x83, 0x04, 0x1A, 0x84, 0x11, 0x23, 0x19, 0xA6, 0x62, 0xD1, 0xD5, 0x7C, 0xFF, 0x51,
+0xAB, 0xC2, 0xF9, 0xEE, 0x49, 0xA4, 0xA5, 0x32, 0x57, 0x52, 0xC2, 0x07, 0x5B, 0x0D, 0xC5, 0x7B,
+0xF7, 0x45, 0xA7, 0x76, 0xC2, 0xAC, 0xB4, 0x26, 0x5B, 0xA3, 0x11, 0x52, 0xC3, 0x85, 0x3A, 0x8B,
+0xAC, 0x18, 0xEF, 0x7C, 0xEF, 0xA6, 0x51, 0xC7, 0x71, 0xC5, 0xA7, 0x7B, 0xE3, 0x19, 0x84, 0x11,
+0xE4, 0x19, 0xE8, 0x8B, 0x96, 0xE6, 0x7D, 0xF7, 0x7D, 0x4C, 0xC3, 0x35, 0xD6, 0xC9, 0x93, 0x64,
+0x2A, 0x83, 0x11, 0xAE, 0xC1, 0x26, 0x63, 0x91, 0xCD, 0x51, 0x7D, 0xAB, 0xC2, 0x1A, 0xEF, 0x2B,
+0xAC, 0xC6, 0x42, 0x57, 0x52, 0xC2, 0x85, 0x42, 0xED, 0xB4, 0x9C, 0xF7, 0x7D, 0x00, 0x7E, 0xC1,
+0x2E, 0xC5, 0xA7, 0x73, 0x5C, 0x52, 0xC2, 0x44, 0x2A, 0x6B, 0x9C, 0x5A, 0xF7, 0x42, 0x7D, 0x4A,
+0xC2, 0x50, 0xC5, 0xC7, 0x8B, 0x04, 0x1A, 0x57, 0xC2, 0xE4, 0x19, 0xC8, 0x83, 0x95, 0xE6, 0x51,
+0x7D, 0x58, 0xC2, 0x34, 0xDE, 0x29, 0xAC, 0xE5, 0x3A, 0x57, 0xAF, 0x50, 0xC0, 0x33, 0xDE, 0x58,
+0x7D, 0x51, 0xC2, 0x96, 0xDE, 0x8C, 0xB4, 0x68, 0x5B, 0x54, 0xBB, 0xC2, 0xC6, 0x42, 0x90, 0xCD,
+0x7C, 0xF7, 0x7D, 0x4C, 0xC0, 0x19, 0xEF, 0x4D, 0xC0, 0x0A, 0x84, 0x5C, 0xA2, 0xC2, 0x44, 0x22,
+0xCD, 0xA4, 0x9C, 0xF7, 0x4C, 0x00, 0xA4, 0xC1, 0x2E, 0xCD, 0x8C, 0xA4, 0x78, 0x63, 0xC1, 0xE4,
+0x19, 0x09, 0x84, 0x72, 0x5D, 0x58, 0x4A, 0xC2, 0x8F, 0xCD, 0xAC, 0xB4, 0xC6, 0x3A, 0x52, 0xAE,
+0xC2, 0x46, 0x63, 0xD7, 0xEE, 0xFF, 0xFF, 0xA6, 0xA6, 0xC3, 0xF1, 0xDD, 0xCC, 0xBC, 0x89, 0x5C,
+0x13, 0x96, 0x71, 0x6C, 0x01, 0x71, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0xC4, 0x14,
+0x9E, 0x27, 0x34, 0x8A, 0x9C, 0xD1, 0xDD, 0xDE, 0xFF, 0x71, 0x00, 0xC3, 0xD2, 0xD5, 0xA8, 0x7B,
+0x24, 0x1A, 0x84, 0x11, 0x00, 0xC3, 0x64, 0x31, 0xAD, 0xB4, 0x5A, 0xF7, 0xBE, 0xFF, 0x00, 0xC3,
+0xB7, 0xEE, 0x4A, 0xA4, 0xC5, 0x32, 0x83, 0x11, 0x00, 0xC2, 0xE6, 0x4A, 0x4B, 0xAC, 0xD8, 0xEE,
+0x51, 0x00, 0xC2, 0x19, 0xEF, 0x6B, 0xAC, 0x26, 0x53, 0x5C, 0xA3, 0xC3, 0x65, 0x2A, 0x09, 0x94,
+0x13, 0xDE, 0x9D, 0xF7, 0x4C, 0xA8, 0xC2, 0xEE, 0xBC, 0xA7, 0x73, 0x04, 0x1A, 0x59, 0xC2, 0xC4,
+0x19, 0x67, 0x73, 0x71, 0xD5, 0x4C, 0x9E, 0x51, 0xC2, 0xB3, 0xCD, 0xC9, 0x8B, 0x64, 0x2A, 0x52,
+0xC2, 0xA3, 0x11, 0xE6, 0x52, 0x8D, 0xB4, 0x79, 0xC0, 0x9D, 0xF7, 0x00, 0xC2, 0x76, 0xDE, 0xEA,
+0x9B, 0xE6, 0x42, 0x57, 0x52, 0xC2, 0x64, 0x32, 0xE9, 0x9B, 0xD7, 0xEE, 0x51, 0x58, 0xC2, 0xF9,
+0xEE, 0x6B, 0xB4, 0x86, 0x63, 0x5C, 0xA3, 0xC2, 0x24, 0x22, 0xA8, 0x7B, 0x55, 0xE6, 0x58, 0x00,
+0x72, 0xC2, 0xCD, 0xBC, 0xA7, 0x83, 0x04, 0x1A, 0x52, 0xC0, 0xC3, 0x11, 0x50, 0xC0, 0x4F, 0xC5,
+0x51, 0x58, 0x51, 0xC2, 0x50, 0xCD, 0x69, 0xAC, 0xA5, 0x32, 0x57, 0xAF, 0xC2, 0xE5, 0x42, 0x0E,
+0xBD, 0x5C, 0xF7, 0x58, 0x4C, 0xC2, 0xD2, 0xD5, 0xAC, 0xBC, 0x67, 0x53, 0x57, 0xAB, 0xC2, 0x85,
+0x32, 0xCD, 0xB4, 0xF9, 0xF6, 0x5D, 0x51, 0xC3, 0x54, 0xDE, 0xAB, 0xBC, 0x09, 0x7C, 0xA3, 0x11,
+0xA3, 0x7A, 0xC2, 0xC8, 0x7B, 0x96, 0xE6, 0xBD, 0xFF, 0x58, 0x41, 0x52, 0xC1, 0x8C, 0x94, 0x03,
+0x1A, 0x5E, 0xC1, 0xE4, 0x19, 0x67, 0x63, 0x57, 0xC0, 0xDE, 0xFF, 0xAB, 0xC4, 0xF8, 0xEE, 0xED,
+0xC4, 0xCC, 0xAC, 0xA5, 0x32, 0x63, 0x11, 0xAE, 0xC1, 0xC5, 0x4A, 0x70, 0xCD, 0x60, 0xC0, 0xFF,
+0xFF, 0x79, 0xC0, 0x0C, 0xCD, 0x66, 0xC1, 0x89, 0x54, 0x34, 0x96, 0x71, 0xA6, 0x01, 0x71, 0x29,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0xC8, 0x34, 0x9E, 0x26, 0x24, 0x68, 0x6C, 0x8B, 0xB4,
+0x13, 0xE6, 0x3A, 0xF7, 0x55, 0xE6, 0x2B, 0xA4, 0x06, 0x43, 0x75, 0xC0, 0x84, 0x11, 0x6B, 0xA6,
+0xC4, 0x66, 0x62, 0x4F, 0xD5, 0x97, 0xE6, 0x34, 0xDE, 0x8C, 0xB4, 0x5C, 0xC0, 0x64, 0x1A, 0x66,
+0x63, 0xC2, 0x85, 0x22, 0xC8, 0x83, 0xAD, 0xC4, 0x61, 0x72, 0xC3, 0xED, 0xBC, 0x47, 0x73, 0x84,
+0x2A, 0xC3, 0x11, 0x5E, 0x75, 0xC7, 0x67, 0x5B, 0x0A, 0xA4, 0xD3, 0xD5, 0x56, 0xE6, 0x2F, 0xCD,
+0x88, 0x8B, 0x06, 0x3B, 0xE4, 0x11, 0x5E, 0xC0, 0xC4, 0x11, 0x7A, 0xC3, 0xA9, 0x93, 0x51, 0xCD,
+0x37, 0xDE, 0x72, 0xCD, 0x46, 0xC2, 0x26, 0x4B, 0x44, 0x1A, 0xA3, 0x11, 0x00, 0xC8, 0xA5, 0x2A,
+0x67, 0x7B, 0xAF, 0xBC, 0x36, 0xDE, 0xD4, 0xD5, 0xCB, 0xA3, 0x47, 0x6B, 0x84, 0x22, 0xA4, 0x11,
+0x5E, 0xC3, 0x24, 0x1A, 0x06, 0x63, 0x2B, 0xAC, 0x14, 0xDE, 0xAB, 0xC2, 0x6C, 0xB4, 0x88, 0x7B,
+0xC5, 0x32, 0x61, 0xA7, 0xC7, 0x04, 0x12, 0x05, 0x43, 0xCA, 0x9B, 0x92, 0xCD, 0x15, 0xD6, 0xAE,
+0xB4, 0x87, 0x93, 0x65, 0x4B, 0x72, 0x66, 0x6D, 0xC2, 0x05, 0x33, 0xA8, 0x8B, 0x10, 0xCD, 0x60,
+0xC2, 0x51, 0xC5, 0xE9, 0xA3, 0xC7, 0x73, 0x7F, 0x6B, 0x00, 0xC7, 0xA5, 0x22, 0x87, 0x7B, 0xEE,
+0xC4, 0x14, 0xD6, 0xB1, 0xD5, 0x2A, 0xAC, 0x09, 0x84, 0xC5, 0x2A, 0x68, 0x63, 0x7F, 0xC2, 0x88,
+0x6B, 0xEE, 0xCC, 0xD4, 0xDD, 0x95, 0xC1, 0x2B, 0xB4, 0x09, 0x94, 0x77, 0x68, 0xB6, 0x72, 0xC0,
+0x06, 0x43, 0x6E, 0x79, 0xBF, 0xC3, 0x6C, 0xBC, 0xE9, 0x9B, 0x87, 0x53, 0xE3, 0x11, 0xB3, 0xC1,
+0xE4, 0x19, 0xC5, 0x32, 0x55, 0xC4, 0x71, 0xD5, 0xF4, 0xDD, 0xAD, 0xC4, 0xA9, 0x9B, 0xE8, 0x6B,
+0x7F, 0xC0, 0xA4, 0x11, 0x68, 0xC9, 0x85, 0x22, 0x88, 0x83, 0x0F, 0xCD, 0x14, 0xE6, 0x0E, 0xCD,
+0x09, 0xAC, 0xCA, 0x8C, 0x46, 0x2C, 0x96, 0xAE, 0xFF, 0xFF, 0xA2, 0x6C, 0x67, 0x6C, 0x71, 0x28,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0xC1, 0x34, 0xA6, 0x66, 0x2C, 0xB7, 0xC5, 0x28, 0x6C,
+0x4A, 0xA4, 0x8B, 0xAC, 0xE9, 0x8B, 0x26, 0x43, 0x05, 0x23, 0xA6, 0xA6, 0x00, 0x62, 0xC2, 0x84,
+0x29, 0x48, 0x7B, 0xE9, 0x9B, 0x81, 0xC1, 0x46, 0x53, 0x05, 0x23, 0x62, 0x58, 0x00, 0xC3, 0xE5,
+0x1A, 0x26, 0x3B, 0x88, 0x73, 0xC9, 0x93, 0x53, 0xC1, 0x87, 0x6B, 0x05, 0x2B, 0x62, 0x5D, 0x58,
+0x99, 0x6A, 0x59, 0x74, 0xC1, 0xA8, 0x93, 0x48, 0x7B, 0x7C, 0xC0, 0x05, 0x23, 0x62, 0x5D, 0x00,
+0x67, 0xC2, 0x46, 0x43, 0x27, 0x6B, 0x28, 0x83, 0x85, 0xC0, 0x06, 0x43, 0x67, 0x00, 0x5D, 0x58,
+0x9E, 0xC0, 0x25, 0x3B, 0x46, 0xC0, 0x27, 0x73, 0xAE, 0xC0, 0x06, 0x4B, 0x67, 0x62, 0xA2, 0x00,
+0x9A, 0x6A, 0xC1, 0x26, 0x53, 0x47, 0x7B, 0xA6, 0xC1, 0x06, 0x5B, 0x05, 0x33, 0x62, 0xA6, 0x01,
+0x67, 0xC1, 0x05, 0x43, 0x06, 0x6B, 0x53, 0x46, 0x44, 0xC0, 0x25, 0x23, 0x62, 0x01, 0x67, 0xC2,
+0x46, 0x3B, 0x67, 0x73, 0x48, 0x83, 0x89, 0xC0, 0x86, 0x53, 0x6C, 0x67, 0xA6, 0x00, 0x67, 0xC2,
+0x45, 0x33, 0x47, 0x63, 0x68, 0x83, 0x74, 0xC1, 0x87, 0x63, 0x46, 0x2B, 0x6C, 0x67, 0xA2, 0x00,
+0xC2, 0x25, 0x2B, 0xC8, 0x6B, 0x48, 0x7B, 0xBE, 0xC1, 0x68, 0x6B, 0x46, 0x33, 0x81, 0x62, 0x01,
+0x67, 0x44, 0xC0, 0x47, 0x73, 0xBB, 0x5D, 0xC0, 0x66, 0x43, 0x6C, 0xA6, 0x62, 0x00, 0x67, 0xC0,
+0x25, 0x3B, 0x46, 0x5B, 0x5D, 0xC0, 0x46, 0x4B, 0x6C, 0x67, 0x62, 0x00, 0x6C, 0x77, 0xC1, 0x86,
+0x6B, 0xC8, 0x93, 0x8A, 0xC1, 0x08, 0x64, 0x47, 0x34, 0x9E, 0xC0, 0xD8, 0xB6, 0x71, 0xA6, 0x02,
+0x71, 0x28, 0x70, 0x00, 0x71, 0x2D, 0xC1, 0x76, 0xAE, 0x66, 0x24, 0x00, 0xC1, 0x05, 0x24, 0xA5,
+0x2B, 0xB2, 0x89, 0x9A, 0xAB, 0x03, 0xC0, 0x23, 0x1A, 0xB3, 0x77, 0x81, 0x9A, 0xAF, 0xC0, 0x65,
+0x1B, 0xA6, 0x01, 0x69, 0x5D, 0xC0, 0x05, 0x2B, 0x00, 0x5D, 0xC0, 0x44, 0x1B, 0xBF, 0xAF, 0xA9,
+0x6E, 0x69, 0x73, 0xC0, 0x86, 0x2B, 0x00, 0x76, 0x67, 0x6E, 0x73, 0x00, 0x6E, 0x00, 0xA5, 0x5D,
+0x60, 0x5D, 0x69, 0x67, 0x76, 0x00, 0x6E, 0x69, 0x62, 0x5D, 0xB7, 0xAE, 0x9D, 0x69, 0xAD, 0x00,
+0x6E, 0x69, 0x62, 0x5D, 0x60, 0xA6, 0x5D, 0xAB, 0x62, 0x00, 0x6E, 0x01, 0x62, 0xBA, 0x00, 0x62,
+0x6E, 0x73, 0x00, 0x6E, 0x00, 0x67, 0x6E, 0xBA, 0xA6, 0x71, 0x73, 0x6E, 0x76, 0x7B, 0x73, 0x76,
+0x73, 0x6E, 0x71, 0x76, 0x6E, 0x73, 0x7B, 0x00, 0x76, 0xAB, 0x73, 0x6E, 0x71, 0x00, 0x6E, 0xC0,
+0xA6, 0x1B, 0x42, 0xAE, 0x00, 0x7B, 0x76, 0x69, 0x00, 0x6C, 0x6E, 0x00, 0x76, 0x7B, 0x76, 0x00,
+0x6E, 0x69, 0x00, 0xBF, 0x00, 0x71, 0x7D, 0x42, 0x01, 0x7B, 0x00, 0x95, 0xC0, 0x85, 0x2B, 0x43,
+0xC0, 0x26, 0x2C, 0x9E, 0xC2, 0xEA, 0x4C, 0x3B, 0xDF, 0xDF, 0xFF, 0x02, 0xAE, 0x29, 0x70, 0x00,
+0x71, 0x2D, 0xC1, 0x5C, 0xDF, 0xD2, 0x8D, 0x95, 0x95, 0xA6, 0x95, 0x74, 0xBB, 0x95, 0x00, 0xAB,
+0xA5, 0x99, 0xA6, 0xC2, 0x07, 0x3A, 0x2C, 0x5C, 0x51, 0x85, 0xA6, 0x79, 0x6F, 0x76, 0x74, 0x95,
+0x00, 0x5B, 0xAB, 0x5B, 0xC0, 0x92, 0x8D, 0x00, 0xC0, 0xED, 0x64, 0x80, 0xC0, 0x0D, 0x5D, 0xBE,
+0xAB, 0x00, 0x44, 0xA1, 0xB6, 0x6A, 0xC0, 0xB3, 0x8D, 0x7E, 0xA9, 0x79, 0x6F, 0x6A, 0x74, 0x6A,
+0x6F, 0xBA, 0x79, 0x4D, 0x79, 0x00, 0x74, 0x79, 0xBE, 0xAB, 0x79, 0x02, 0xC0, 0x91, 0x8D, 0x4D,
+0x7E, 0x79, 0x01, 0xBA, 0x48, 0x00, 0x79, 0x74, 0x00, 0x79, 0xC0, 0x92, 0x95, 0x48, 0x01, 0xA6,
+0x48, 0x00, 0x4D, 0x41, 0x00, 0x4D, 0xBF, 0x00, 0x4D, 0xB6, 0x5C, 0x4D, 0x5C, 0x00, 0xA6, 0xAD,
+0x57, 0x4D, 0xAE, 0x55, 0x5C, 0x00, 0x52, 0x5C, 0xC3, 0xF4, 0x9D, 0x35, 0xA6, 0xD4, 0x9D, 0x2F,
+0x7D, 0x85, 0xBA, 0x60, 0xC0, 0x70, 0x75, 0xA6, 0xA9, 0xBF, 0x72, 0x70, 0xBB, 0x70, 0x96, 0x5C,
+0xBE, 0x70, 0x00, 0x6B, 0xAF, 0x7A, 0xA9, 0x7A, 0xC0, 0x36, 0xAE, 0xBF, 0x00, 0xA9, 0x4E, 0x00,
+0xAE, 0x00, 0x4E, 0xA9, 0x96, 0x00, 0x53, 0xC2, 0x97, 0xB6, 0x1A, 0xD7, 0xBF, 0xFF, 0xAE, 0x02,
+0xAE, 0x29, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x2C, 0x6C, 0x00, 0x71, 0x6C, 0x07, 0x67, 0x6C, 0x71,
+0xC1, 0x55, 0xAD, 0x8E, 0x73, 0x71, 0x67, 0x00, 0xA6, 0x67, 0x00, 0xA9, 0x00, 0xA6, 0x60, 0x5B,
+0x67, 0x00, 0x80, 0x90, 0xAF, 0x49, 0x01, 0x7A, 0x00, 0xBA, 0xC0, 0x9E, 0xF7, 0x67, 0x60, 0x00,
+0x58, 0x00, 0xAF, 0x67, 0x5B, 0x67, 0x00, 0x62, 0x60, 0x00, 0x97, 0x64, 0x67, 0x03, 0x62, 0x67,
+0x08, 0x62, 0x67, 0x60, 0x67, 0x0F, 0x6C, 0x67, 0x03, 0x62, 0x67, 0x00, 0x6C, 0x67, 0x04, 0x58,
+0x49, 0xA6, 0x00, 0x95, 0x01, 0x49, 0x60, 0x6C, 0x04, 0x71, 0x96, 0x64, 0x69, 0x01, 0x71, 0x00,
+0x69, 0x00, 0x71, 0x69, 0x00, 0x6C, 0x71, 0x03, 0x99, 0xA1, 0x9E, 0xA5, 0x01, 0x58, 0x00, 0x4C,
+0x58, 0xBE, 0x58, 0x00, 0x60, 0x00, 0x71, 0x05, 0x6C, 0xC0, 0x7D, 0xFF, 0xA2, 0xA9, 0x45, 0x01,
+0x7E, 0xAF, 0x00, 0x7E, 0x4A, 0x00, 0xC0, 0xBE, 0xFF, 0x71, 0x0D, 0x70, 0x00, 0x71, 0x2C, 0x6C,
+0x09, 0xA6, 0x01, 0x6C, 0x64, 0xC1, 0xEB, 0x62, 0x18, 0xC6, 0x6C, 0x91, 0x01, 0x67, 0x58, 0xBE,
+0x58, 0x02, 0xA6, 0x58, 0x00, 0x67, 0x01, 0x58, 0x60, 0x67, 0x58, 0x03, 0x53, 0x58, 0x04, 0x53,
+0x58, 0x02, 0x67, 0x99, 0x58, 0x00, 0x67, 0x58, 0x04, 0x6C, 0x00, 0x96, 0x58, 0x53, 0x00, 0x64,
+0x58, 0x03, 0x67, 0x6C, 0x58, 0x00, 0x67, 0x6C, 0x67, 0x64, 0x5D, 0x58, 0x01, 0x5D, 0x58, 0x0D,
+0x60, 0x53, 0xC1, 0xBB, 0xD6, 0xB7, 0xB5, 0x95, 0xC0, 0x79, 0xCE, 0x00, 0x92, 0xA9, 0xC0, 0x1C,
+0xE7, 0x64, 0x58, 0x00, 0x5D, 0x86, 0xC3, 0xFB, 0xC6, 0x59, 0xB6, 0x1C, 0xC7, 0x7D, 0xCF, 0xA6,
+0x64, 0xA1, 0x6B, 0xAE, 0xC0, 0xBB, 0xBE, 0x64, 0x91, 0x78, 0x00, 0xBE, 0xC0, 0xBF, 0xF7, 0xBE,
+0x00, 0x5D, 0xC2, 0x58, 0xCF, 0xB4, 0xB6, 0x15, 0xBF, 0xA6, 0x95, 0xAF, 0xC1, 0x35, 0xBF, 0x73,
+0xAE, 0x91, 0x75, 0xBB, 0xC0, 0x12, 0xA6, 0x6B, 0xC1, 0x56, 0xC7, 0x33, 0xA6, 0x57, 0xC1, 0x77,
+0xCF, 0xDE, 0xF7, 0x71, 0x02, 0x4F, 0xC3, 0x96, 0xF5, 0xB2, 0xDC, 0x14, 0xED, 0x55, 0xF5, 0xA6,
+0x7F, 0x7A, 0x7F, 0x6B, 0x00, 0xC0, 0x75, 0xFD, 0x6B, 0x7A, 0xC0, 0x96, 0xFD, 0x7E, 0x71, 0x0C,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3C, 0xC1, 0xF7, 0xBD, 0x2D, 0x6B, 0x71, 0x02, 0xC0, 0xFB, 0xDE,
+0x5D, 0xC1, 0xDB, 0xDE, 0x9E, 0xF7, 0x71, 0x03, 0x6C, 0xC1, 0x96, 0xB5, 0x38, 0xCE, 0x5C, 0x64,
+0xC0, 0x5D, 0xEF, 0x91, 0x71, 0x04, 0xC0, 0xBA, 0xD6, 0x71, 0x07, 0x5D, 0xC0, 0xF7, 0xC5, 0x4D,
+0x71, 0x58, 0x78, 0x5D, 0x71, 0x03, 0x65, 0xC0, 0x55, 0xAD, 0x61, 0x71, 0x01, 0x44, 0x71, 0x03,
+0x4D, 0xC0, 0xB6, 0xBD, 0x6C, 0x71, 0xC1, 0x7A, 0xD6, 0x14, 0xA5, 0x78, 0xC0, 0x9A, 0xD6, 0x58,
+0x71, 0x12, 0x61, 0xC5, 0x9A, 0xCE, 0x51, 0x8C, 0x0C, 0x63, 0x34, 0xA5, 0x1C, 0xDF, 0x10, 0x84,
+0xAE, 0x5C, 0x5D, 0x71, 0x00, 0x69, 0xC4, 0xBF, 0xD7, 0x92, 0x84, 0x6E, 0x63, 0xCF, 0x6B, 0xFC,
+0xC6, 0xA9, 0xC3, 0x8E, 0x63, 0xB6, 0xA5, 0x4D, 0x63, 0xEB, 0x52, 0x77, 0xC2, 0x14, 0x95, 0x2D,
+0x5B, 0x9E, 0xD7, 0x7D, 0xA6, 0xC0, 0x9E, 0xE7, 0x71, 0x00, 0xC5, 0x99, 0xDF, 0x55, 0xBF, 0x0A,
+0x53, 0x73, 0xAE, 0x30, 0x8D, 0x2D, 0x74, 0x70, 0xC5, 0xD1, 0x9D, 0xAB, 0x63, 0x0D, 0x74, 0xD5,
+0xB6, 0xEF, 0x84, 0x8B, 0x63, 0x65, 0x43, 0xC0, 0xCC, 0x6B, 0x42, 0xC1, 0xD4, 0xB6, 0x78, 0xD7,
+0x71, 0x02, 0xC4, 0x18, 0xFE, 0x51, 0xCC, 0x69, 0x6A, 0x0C, 0x8B, 0x51, 0xC4, 0x95, 0xA6, 0xC6,
+0xAE, 0xA3, 0xB2, 0xD4, 0x2C, 0x8B, 0xAB, 0x7A, 0xB6, 0xFD, 0x6A, 0x6A, 0x92, 0xD4, 0x47, 0x58,
+0xC0, 0xDF, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3D, 0xC1, 0x4D, 0x6B, 0xF7, 0xBD,
+0x71, 0x01, 0xC5, 0x75, 0xB5, 0x5D, 0xEF, 0x96, 0xB5, 0xBA, 0xD6, 0xD7, 0xBD, 0x3C, 0xEF, 0x61,
+0xC1, 0xF7, 0xC5, 0xDF, 0xFF, 0x71, 0x61, 0xC1, 0xD3, 0x9C, 0x75, 0xAD, 0x4D, 0xC0, 0x18, 0xC6,
+0x48, 0x71, 0x44, 0xC1, 0x96, 0xB5, 0x3C, 0xE7, 0x4C, 0x48, 0x4D, 0xC2, 0x1C, 0xE7, 0x75, 0xB5,
+0xDB, 0xDE, 0x71, 0xA6, 0x4C, 0x4D, 0x61, 0x60, 0x44, 0xC0, 0x92, 0x94, 0x4C, 0x71, 0xC1, 0xF8,
+0xC5, 0x72, 0x94, 0x48, 0x51, 0xC0, 0xBE, 0xF7, 0x4C, 0x5C, 0x71, 0x7C, 0xC1, 0x59, 0xCE, 0xB2,
+0x94, 0x61, 0x4C, 0x49, 0x68, 0x60, 0xAE, 0x4D, 0x71, 0x00, 0x50, 0x4D, 0x71, 0x00, 0x44, 0x68,
+0x74, 0x5C, 0x74, 0xC0, 0xB6, 0xB5, 0x60, 0x54, 0x67, 0x60, 0xC0, 0xBA, 0xDE, 0x71, 0x0C, 0xC0,
+0xDB, 0xD6, 0x91, 0x59, 0x69, 0x68, 0x45, 0xC3, 0x6D, 0x6B, 0x71, 0x8C, 0xDB, 0xD6, 0x7D, 0xEF,
+0x71, 0x00, 0x86, 0xC0, 0xBE, 0xD7, 0x62, 0xC1, 0x1C, 0xC7, 0x96, 0x9D, 0x91, 0xC0, 0x59, 0xB6,
+0x41, 0xC0, 0xBA, 0xBE, 0x6B, 0x5B, 0xC3, 0xDF, 0xDF, 0x7D, 0xCF, 0x51, 0x7C, 0x5D, 0xCF, 0x7D,
+0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x78, 0xCF, 0x94, 0xC2, 0x0A, 0x5B, 0x91, 0x95, 0x8E,
+0x7C, 0x6A, 0xC0, 0x0F, 0x8D, 0x43, 0xC5, 0x30, 0x8D, 0xF8, 0xD7, 0xD5, 0xB6, 0xEC, 0x6B, 0xB7,
+0xCF, 0xCF, 0x84, 0x49, 0xC0, 0xD7, 0xCF, 0x57, 0xC2, 0x12, 0xA6, 0x77, 0xCF, 0xFF, 0xFF, 0x01,
+0xA1, 0xC1, 0x96, 0xFD, 0x51, 0xC4, 0x00, 0xC0, 0xF0, 0xB3, 0xA9, 0x96, 0x00, 0xC0, 0x6E, 0x9B,
+0x55, 0x62, 0xC2, 0x8A, 0x6A, 0xD3, 0xDC, 0x49, 0x62, 0x40, 0x53, 0x47, 0xC0, 0x7D, 0xFF, 0x71,
+0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3D, 0x74, 0xC0, 0x0C, 0x63, 0x71, 0x01, 0xC1, 0x96, 0xB5,
+0x5D, 0xEF, 0x4C, 0xC0, 0x76, 0xB5, 0x6D, 0x75, 0x68, 0xC0, 0x30, 0x84, 0x74, 0x71, 0xC1, 0x79,
+0xCE, 0x71, 0x94, 0x61, 0x78, 0xC1, 0x34, 0xAD, 0xBE, 0xF7, 0x71, 0xC1, 0x75, 0xAD, 0xBA, 0xD6,
+0x65, 0xC2, 0xB6, 0xB5, 0xF3, 0x9C, 0x55, 0xAD, 0x7D, 0x64, 0x00, 0x71, 0x79, 0x78, 0x75, 0x5C,
+0x96, 0x4C, 0x41, 0x4C, 0x71, 0x48, 0xC0, 0xF3, 0xA4, 0x78, 0x00, 0xBE, 0xC1, 0xB2, 0x9C, 0x9E,
+0xF7, 0x71, 0xC0, 0x34, 0xA5, 0x71, 0x4C, 0xBE, 0x7C, 0x64, 0x78, 0x64, 0xC0, 0x51, 0x8C, 0x00,
+0x5D, 0x6C, 0x54, 0xC1, 0xB7, 0xBD, 0xDB, 0xDE, 0x6C, 0x71, 0x78, 0x58, 0x74, 0xC0, 0x30, 0x8C,
+0x78, 0x7C, 0x78, 0x64, 0xC0, 0x71, 0x8C, 0x00, 0x6C, 0x71, 0x0B, 0xC0, 0xDB, 0xD6, 0x4D, 0x4C,
+0xC0, 0xAA, 0x52, 0x7D, 0x69, 0x68, 0xAF, 0x59, 0xC0, 0x7D, 0xEF, 0x71, 0x00, 0x82, 0xC2, 0xBE,
+0xD7, 0xB2, 0x84, 0xDB, 0xBE, 0xA1, 0xC1, 0xF3, 0x8C, 0x75, 0x9D, 0x5B, 0xC2, 0xB7, 0xA5, 0x38,
+0xAE, 0x34, 0x95, 0x51, 0xA6, 0x4E, 0xC0, 0x5D, 0xCF, 0xAE, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00,
+0x5A, 0xC1, 0x35, 0xBF, 0x0C, 0x74, 0x43, 0x91, 0xC0, 0xEF, 0x84, 0x00, 0xC2, 0xF2, 0x9D, 0x2A,
+0x5B, 0x4D, 0x7C, 0x76, 0x43, 0xC6, 0xB7, 0xCF, 0x91, 0x95, 0x30, 0x8D, 0x76, 0xC7, 0x2D, 0x74,
+0xD4, 0xB6, 0x57, 0xCF, 0x71, 0x01, 0x60, 0x53, 0xC1, 0x71, 0xCC, 0xCB, 0x7A, 0xBF, 0xC2, 0xB3,
+0xDC, 0x8E, 0x9B, 0xCF, 0xAB, 0x95, 0x92, 0xC1, 0x10, 0xBC, 0x0C, 0x8B, 0x6F, 0xC1, 0x0C, 0x83,
+0x92, 0xD4, 0x53, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3E,
+0xC1, 0x8E, 0x73, 0x75, 0xB5, 0x71, 0x00, 0xC3, 0xB6, 0xB5, 0x9A, 0xD6, 0x35, 0xAD, 0xFB, 0xDE,
+0x6C, 0xC0, 0x14, 0xA5, 0x6D, 0x65, 0xC1, 0x7D, 0xEF, 0xDF, 0xFF, 0x95, 0x41, 0xC1, 0x5D, 0xEF,
+0x30, 0x8C, 0x50, 0x71, 0x00, 0xC0, 0x55, 0xAD, 0x44, 0xC0, 0x38, 0xCE, 0x00, 0x50, 0x00, 0xC1,
+0xF7, 0xBD, 0x9A, 0xD6, 0x69, 0x71, 0xC0, 0x59, 0xCE, 0x65, 0xC1, 0x9E, 0xF7, 0x71, 0x94, 0x65,
+0xC2, 0xDB, 0xDE, 0x92, 0x94, 0xB7, 0xBD, 0x71, 0x5C, 0x64, 0xC2, 0xD7, 0xBD, 0x18, 0xC6, 0x96,
+0xB5, 0x4C, 0x71, 0x00, 0x41, 0xC2, 0x1C, 0xE7, 0xD3, 0x9C, 0x34, 0xA5, 0x50, 0x41, 0x60, 0x69,
+0x41, 0x48, 0x71, 0xC0, 0x3C, 0xE7, 0x64, 0x7C, 0x54, 0x71, 0x00, 0x64, 0x44, 0x65, 0xC1, 0x71,
+0x94, 0xBA, 0xD6, 0x4C, 0xC1, 0x7A, 0xD6, 0xB2, 0x9C, 0x50, 0x48, 0x71, 0x0C, 0x59, 0x91, 0x4D,
+0x64, 0xC2, 0x71, 0x8C, 0xEF, 0x7B, 0x4D, 0x6B, 0x00, 0x45, 0x49, 0xC0, 0xFF, 0xFF, 0x00, 0x82,
+0xC9, 0xBE, 0xD7, 0xB2, 0x84, 0x1C, 0xC7, 0x7A, 0xB6, 0xD3, 0x8C, 0xCF, 0x6B, 0x4D, 0x63, 0x30,
+0x7C, 0x39, 0xAE, 0x35, 0x95, 0x51, 0xA6, 0xC1, 0x72, 0x84, 0x7D, 0xD7, 0x9A, 0x00, 0xC0, 0x9E,
+0xDF, 0x71, 0x00, 0x5A, 0xC1, 0x35, 0xBF, 0x6E, 0x7C, 0x5E, 0x6A, 0xC0, 0x10, 0x8D, 0x90, 0xC1,
+0xB4, 0xB6, 0x76, 0xC7, 0x6A, 0xC0, 0xCF, 0x84, 0x91, 0xC2, 0xD8, 0xD7, 0x50, 0x95, 0x91, 0x95,
+0x00, 0x91, 0xC0, 0x76, 0xC7, 0xA7, 0x71, 0x01, 0xA1, 0x53, 0xC2, 0x71, 0xCC, 0xCB, 0x7A, 0xB3,
+0xD4, 0x53, 0xC4, 0x4D, 0x93, 0x8E, 0xA3, 0xCF, 0xAB, 0x2C, 0x8B, 0x51, 0xC4, 0x62, 0xC3, 0xEB,
+0x82, 0x6D, 0x9B, 0x92, 0xD4, 0x96, 0xFD, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x3E, 0xC1, 0xBB, 0xDE, 0xCB, 0x5A, 0x58, 0x71, 0xC0, 0x5D, 0xEF, 0x7C, 0xC3,
+0xF7, 0xBD, 0x3C, 0xE7, 0x14, 0xA5, 0xBA, 0xDE, 0x74, 0xC1, 0x34, 0xAD, 0x9E, 0xF7, 0xAE, 0xC1,
+0x14, 0xA5, 0x96, 0xB5, 0x71, 0xC0, 0x18, 0xC6, 0x4D, 0x71, 0x00, 0xC0, 0xDB, 0xDE, 0x50, 0xC1,
+0xFB, 0xDE, 0x34, 0xAD, 0x51, 0x4D, 0x5C, 0x75, 0x48, 0x71, 0x5D, 0x55, 0x79, 0x74, 0xC0, 0x55,
+0xAD, 0x75, 0x65, 0xC0, 0xBA, 0xDE, 0x71, 0x44, 0x61, 0x60, 0x55, 0x44, 0x4D, 0x71, 0x00, 0xC1,
+0xB6, 0xB5, 0x92, 0x94, 0x48, 0x5C, 0xC0, 0xF3, 0xA4, 0x74, 0x50, 0x7D, 0x78, 0x51, 0x71, 0x00,
+0xC0, 0xB6, 0xBD, 0x44, 0x40, 0x71, 0x00, 0x48, 0x5D, 0xC0, 0xFC, 0xE6, 0x60, 0x75, 0x4D, 0xC0,
+0x1C, 0xE7, 0x61, 0xC0, 0x75, 0xAD, 0x60, 0x71, 0x0C, 0xC0, 0xDB, 0xD6, 0x79, 0x7D, 0x6D, 0x91,
+0x51, 0xC1, 0x10, 0x84, 0x6D, 0x6B, 0x4D, 0xC0, 0x7D, 0xEF, 0x71, 0x00, 0x82, 0xC2, 0xBF, 0xD7,
+0x51, 0x7C, 0x55, 0x9D, 0x42, 0xC0, 0x14, 0x8D, 0x4E, 0xC0, 0x59, 0xB6, 0x4E, 0xC0, 0x55, 0x95,
+0xA5, 0xC4, 0xDF, 0xDF, 0xBB, 0xBE, 0x2D, 0x63, 0x9A, 0xB6, 0x9E, 0xD7, 0x95, 0xC0, 0x9E, 0xDF,
+0x71, 0x00, 0x5A, 0xC2, 0x35, 0xBF, 0x4D, 0x74, 0x12, 0xA6, 0x91, 0xC0, 0xCF, 0x84, 0xA5, 0xC1,
+0xB1, 0x9D, 0x53, 0xAE, 0x43, 0xC3, 0x91, 0x9D, 0x2D, 0x74, 0xD2, 0x9D, 0x0D, 0x74, 0x51, 0xC0,
+0x2A, 0x5B, 0x56, 0xC1, 0xF5, 0xBE, 0x57, 0xC7, 0x71, 0x01, 0xA1, 0x53, 0xC0, 0x31, 0xC4, 0x46,
+0xC0, 0xD7, 0xFD, 0xA5, 0xC0, 0x2D, 0x93, 0x00, 0xC5, 0x10, 0xB4, 0xCB, 0x7A, 0x71, 0xCC, 0xCF,
+0xAB, 0xB2, 0xCC, 0xAF, 0xAB, 0x71, 0x53, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x3F, 0xC1, 0x30, 0x84, 0xB6, 0xB5, 0x71, 0xE0, 0x14, 0xC0, 0xDB, 0xD6, 0x91,
+0xC3, 0x31, 0x84, 0xAE, 0x73, 0x38, 0xC6, 0xFB, 0xDE, 0x65, 0xC0, 0x96, 0xAD, 0x4D, 0x49, 0x71,
+0x00, 0x82, 0xC7, 0x9E, 0xD7, 0xB6, 0xA5, 0xF0, 0x73, 0x96, 0x9D, 0xBB, 0xBE, 0x59, 0xB6, 0xFF,
+0xDF, 0x38, 0xAE, 0xA6, 0x6B, 0xC2, 0xBE, 0xDF, 0xD7, 0xA5, 0xCF, 0x73, 0x6F, 0x4C, 0x95, 0xC0,
+0x9E, 0xDF, 0x71, 0x00, 0x5A, 0xC0, 0x35, 0xBF, 0x51, 0xC2, 0x76, 0xC7, 0x15, 0xBF, 0xF2, 0x9D,
+0xBE, 0xAF, 0xC8, 0x0C, 0x6C, 0x8E, 0x7C, 0x56, 0xC7, 0x53, 0xAE, 0xAC, 0x6B, 0x71, 0x95, 0xB4,
+0xB6, 0x0C, 0x74, 0x4D, 0x74, 0x57, 0xC0, 0x77, 0xCF, 0x71, 0x01, 0x60, 0xC1, 0x96, 0xFD, 0xD3,
+0xDC, 0x91, 0x53, 0x00, 0xC0, 0x72, 0xCC, 0x00, 0x54, 0xC1, 0x51, 0xC4, 0xF4, 0xE4, 0x80, 0x64,
+0x40, 0xC1, 0xF3, 0xE4, 0x76, 0xFD, 0x47, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x3F, 0xA6, 0x95, 0x71, 0x06, 0x6C, 0x71, 0x2E, 0x5D, 0xA6, 0x71, 0x19, 0x59, 0x91, 0x59,
+0x00, 0x4D, 0x45, 0x4D, 0x00, 0x91, 0xC0, 0x7D, 0xEF, 0x71, 0x00, 0x61, 0xC1, 0x5D, 0xCF, 0xBE,
+0xD7, 0xBF, 0x51, 0xA6, 0x00, 0x7D, 0x4C, 0x01, 0x7D, 0x4C, 0x60, 0x4C, 0x7D, 0x00, 0xC0, 0x9E,
+0xDF, 0x71, 0x00, 0x5A, 0x75, 0xC0, 0x76, 0xC7, 0xA2, 0xAE, 0x49, 0x03, 0x44, 0x00, 0x49, 0x00,
+0x44, 0xC0, 0x97, 0xCF, 0x00, 0x44, 0xAB, 0x71, 0x01, 0xA1, 0x4E, 0x47, 0x4E, 0xA5, 0x00, 0x53,
+0x00, 0x4E, 0x53, 0x4E, 0x00, 0x42, 0x4E, 0x00, 0x42, 0x47, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0x70,
+0x00, 0x71, 0xE0, 0x02, 0x6C, 0x91, 0x71, 0x00, 0x5D, 0x71, 0x5D, 0xC0, 0x75, 0xAD, 0x71, 0x00,
+0x6C, 0x00, 0x71, 0x5D, 0x71, 0x04, 0x5D, 0x71, 0x5D, 0x6C, 0x71, 0x6C, 0x01, 0x71, 0x5D, 0x00,
+0x71, 0x6C, 0x60, 0x71, 0x58, 0x71, 0x00, 0x5D, 0x71, 0x00, 0x5D, 0x71, 0x6C, 0x01, 0x71, 0x00,
+0x5D, 0x71, 0x6C, 0x00, 0xC0, 0xFB, 0xDE, 0x79, 0x71, 0x6C, 0x6D, 0xC0, 0x1C, 0xE7, 0x5D, 0x71,
+0x5D, 0x00, 0x4D, 0x00, 0x71, 0x02, 0x5D, 0x71, 0x5D, 0x71, 0xC0, 0x7D, 0xEF, 0x71, 0x0A, 0x59,
+0x45, 0x4D, 0x59, 0x45, 0x4D, 0x59, 0x4D, 0x45, 0x49, 0x71, 0x00, 0x82, 0x7D, 0x4C, 0x51, 0x4C,
+0x7D, 0x00, 0x4C, 0x00, 0x51, 0x00, 0x4C, 0xA5, 0x51, 0x40, 0x7D, 0x00, 0xC0, 0x9E, 0xDF, 0x71,
+0x00, 0x5A, 0x75, 0x44, 0x02, 0x7F, 0xC0, 0x76, 0xC7, 0x00, 0x7F, 0x44, 0x49, 0x44, 0x01, 0x49,
+0x44, 0x75, 0x4B, 0x71, 0x01, 0x60, 0x4E, 0x47, 0x53, 0x4E, 0x47, 0x01, 0x4E, 0x47, 0x4E, 0x00,
+0x47, 0x4E, 0x47, 0x42, 0x47, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0,
+0x02, 0xC1, 0x1C, 0xE7, 0xF3, 0xA4, 0x4D, 0xC0, 0x96, 0xB5, 0x6D, 0x78, 0xC1, 0xF3, 0x9C, 0x51,
+0x8C, 0x71, 0xC5, 0x7D, 0xEF, 0x72, 0x94, 0x34, 0xAD, 0xDB, 0xDE, 0xD3, 0x9C, 0xB6, 0xBD, 0x48,
+0xC0, 0xB7, 0xBD, 0x78, 0x79, 0x74, 0x44, 0xC0, 0x55, 0xAD, 0x7C, 0xC0, 0x9E, 0xF7, 0x5D, 0x6D,
+0x7C, 0xA5, 0x74, 0x48, 0xC1, 0x14, 0xA5, 0x1C, 0xE7, 0x7C, 0x41, 0xC0, 0x5D, 0xEF, 0x78, 0x40,
+0xC1, 0xFB, 0xDE, 0xB2, 0x9C, 0x55, 0x4D, 0x41, 0x69, 0x7C, 0x01, 0x48, 0x47, 0x50, 0x5C, 0x6D,
+0x64, 0x78, 0xC0, 0x71, 0x94, 0x71, 0x44, 0xC1, 0xEF, 0x83, 0x18, 0xC6, 0x7C, 0xC0, 0x79, 0xD6,
+0x4D, 0xC0, 0x34, 0xAD, 0x5C, 0x55, 0xC0, 0x59, 0xCE, 0x61, 0x74, 0x64, 0xC0, 0xB6, 0xB5, 0xBF,
+0x50, 0x55, 0x64, 0xC0, 0x9E, 0xF7, 0x71, 0x09, 0x59, 0x48, 0xC1, 0xD7, 0xB5, 0x76, 0xAD, 0x4D,
+0xC0, 0x38, 0xC6, 0x69, 0xC0, 0x18, 0xBE, 0x45, 0xC0, 0x7D, 0xEF, 0x71, 0x00, 0x82, 0xC4, 0x7D,
+0xCF, 0xFB, 0xC6, 0x38, 0xAE, 0x1C, 0xC7, 0x9E, 0xD7, 0x7D, 0x64, 0x58, 0x5C, 0xAB, 0xC1, 0xBA,
+0xBE, 0x5D, 0xCF, 0x5C, 0x78, 0xBE, 0x7D, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x5A, 0x75, 0x57, 0x75,
+0xA2, 0x57, 0xC0, 0x76, 0xC7, 0x76, 0x7E, 0x49, 0xC0, 0xD5, 0xB6, 0x56, 0x6B, 0x00, 0xAE, 0x6A,
+0xC1, 0x94, 0xAE, 0x56, 0xC7, 0x4B, 0x71, 0x01, 0xA1, 0x4E, 0x95, 0xC1, 0x92, 0xD4, 0x14, 0xED,
+0x7F, 0xA6, 0x00, 0x99, 0x7F, 0x81, 0x6B, 0x4E, 0x68, 0x7F, 0xBE, 0x00, 0xC0, 0x7D, 0xFF, 0x71,
+0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x02, 0x48, 0x6D, 0x55, 0xC0, 0xB6, 0xB5, 0x48, 0xC1,
+0xAE, 0x7B, 0x3C, 0xE7, 0x55, 0x71, 0xC0, 0x1C, 0xE7, 0x7D, 0xC4, 0x7A, 0xD6, 0x92, 0x94, 0xFB,
+0xE6, 0x96, 0xB5, 0xD7, 0xBD, 0x54, 0x95, 0xC0, 0xF7, 0xBD, 0x6D, 0x50, 0x45, 0x79, 0x71, 0x75,
+0x78, 0x7D, 0x79, 0x7D, 0xC1, 0xF7, 0xC5, 0x31, 0x8C, 0x4C, 0xA6, 0xC0, 0x18, 0xC6, 0x65, 0x69,
+0xC0, 0x51, 0x8C, 0x73, 0xC2, 0xFB, 0xDE, 0x55, 0xAD, 0xD3, 0x9C, 0x00, 0x54, 0x60, 0x78, 0x48,
+0x50, 0x54, 0xC0, 0xF3, 0xA4, 0x4C, 0x51, 0xBA, 0x7D, 0xC0, 0x79, 0xD6, 0x71, 0x6C, 0x64, 0xC0,
+0xD3, 0x9C, 0xA5, 0x7D, 0x65, 0xC0, 0x71, 0x94, 0x96, 0xC0, 0x5D, 0xEF, 0x60, 0xC0, 0xDB, 0xDE,
+0x7D, 0x69, 0x75, 0x54, 0x50, 0x6D, 0x55, 0xC0, 0x7D, 0xEF, 0x71, 0x09, 0x59, 0x4D, 0xC1, 0x71,
+0x8C, 0x2C, 0x63, 0x69, 0x6D, 0xC1, 0x2C, 0x6B, 0x55, 0xA5, 0x4D, 0x49, 0x71, 0x00, 0x82, 0xC2,
+0xBF, 0xD7, 0x72, 0x84, 0x8E, 0x6B, 0xAF, 0xC0, 0xFB, 0xC6, 0x00, 0xC1, 0x6D, 0x63, 0xB7, 0xA5,
+0x46, 0xC5, 0xEC, 0x5A, 0xD7, 0xA5, 0x35, 0x95, 0x4D, 0x63, 0x96, 0x9D, 0xBE, 0xD7, 0x91, 0xC0,
+0x9E, 0xDF, 0x71, 0x00, 0x5A, 0x98, 0xC3, 0xE9, 0x52, 0x53, 0xAE, 0x0F, 0x8D, 0xEC, 0x6B, 0x76,
+0xC0, 0x8B, 0x63, 0xAE, 0x76, 0xC0, 0x4D, 0x74, 0x56, 0x6A, 0xC1, 0x10, 0x8D, 0x91, 0x95, 0x5E,
+0x42, 0xC1, 0xD4, 0xB6, 0x77, 0xCF, 0x71, 0x01, 0xA1, 0xC4, 0x96, 0xFD, 0x72, 0xCC, 0x69, 0x6A,
+0x0C, 0x8B, 0x31, 0xC4, 0x99, 0x52, 0xC1, 0x8E, 0xA3, 0xB2, 0xD4, 0x7F, 0xC2, 0x8A, 0x72, 0xB6,
+0xFD, 0x49, 0x62, 0x40, 0x53, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0x70, 0x00, 0x71, 0xE0, 0x02,
+0xC0, 0x75, 0xB5, 0x6D, 0xC4, 0x34, 0xA5, 0xF7, 0xBD, 0xDB, 0xDE, 0x51, 0x8C, 0x34, 0xAD, 0x59,
+0x71, 0xC0, 0x3C, 0xE7, 0x54, 0x58, 0x4C, 0xC1, 0x14, 0xA5, 0x55, 0xAD, 0x48, 0x54, 0xBF, 0x48,
+0xC0, 0x96, 0xB5, 0xBE, 0x78, 0x48, 0x71, 0x44, 0x4C, 0x51, 0x4D, 0x69, 0x50, 0xC0, 0x71, 0x94,
+0x4C, 0xC0, 0x18, 0xC6, 0x74, 0x69, 0xC0, 0xF3, 0xA4, 0x5C, 0xC0, 0x39, 0xCE, 0x58, 0x6D, 0x4C,
+0x64, 0x4C, 0x65, 0x4C, 0xC0, 0xDB, 0xDE, 0x73, 0x50, 0x60, 0xC0, 0xBA, 0xDE, 0x60, 0x00, 0x51,
+0x55, 0xC0, 0xBE, 0xF7, 0xBF, 0x64, 0x4C, 0x64, 0xC0, 0xFB, 0xDE, 0x55, 0x6D, 0x59, 0x51, 0x60,
+0xC3, 0xB3, 0x9C, 0x14, 0xA5, 0xB7, 0xBD, 0x9E, 0xF7, 0x50, 0x4C, 0x48, 0x6D, 0x74, 0x71, 0x09,
+0xC0, 0xDB, 0xD6, 0x91, 0x5C, 0x69, 0xC1, 0xF3, 0x9C, 0x92, 0x94, 0x6D, 0x4D, 0x45, 0xC0, 0x7D,
+0xEF, 0x71, 0x00, 0x82, 0xC0, 0xBE, 0xD7, 0x67, 0xC3, 0x1C, 0xC7, 0xB7, 0xA5, 0x34, 0x95, 0x39,
+0xB6, 0x46, 0xC0, 0x9A, 0xBE, 0x91, 0xC5, 0x55, 0x9D, 0xDF, 0xDF, 0x71, 0x7C, 0xDB, 0xC6, 0x92,
+0x84, 0x9E, 0xD7, 0x95, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x78, 0xCF, 0x94, 0xC3, 0x2A, 0x5B,
+0x70, 0x95, 0x8E, 0x7C, 0x2D, 0x74, 0x43, 0xC2, 0xD4, 0xB6, 0x53, 0xA6, 0x0C, 0x74, 0x6A, 0xC2,
+0x97, 0xCF, 0xD7, 0xCF, 0xAE, 0x7C, 0x76, 0x62, 0xC2, 0xCF, 0x84, 0x12, 0xA6, 0x77, 0xCF, 0x71,
+0x01, 0xA1, 0xC1, 0x96, 0xFD, 0x51, 0xC4, 0x00, 0xC0, 0xF0, 0xB3, 0xA9, 0x96, 0x00, 0xC6, 0x6E,
+0x9B, 0x10, 0xBC, 0x8E, 0x9B, 0x8A, 0x72, 0xD3, 0xDC, 0x69, 0x6A, 0x92, 0xD4, 0x53, 0xA5, 0xC0,
+0x7D, 0xFF, 0x71, 0x0B, 0x70, 0x00, 0x71, 0xE0, 0x02, 0x49, 0x79, 0x49, 0xBF, 0x5D, 0xA2, 0xC1,
+0x9A, 0xD6, 0x1C, 0xE7, 0x71, 0x75, 0x7C, 0xC0, 0xFB, 0xDE, 0x71, 0x48, 0xC0, 0x5D, 0xEF, 0x71,
+0x49, 0x00, 0x6C, 0x5D, 0x74, 0x75, 0x6C, 0x71, 0x6C, 0x58, 0x00, 0x5D, 0x00, 0xC0, 0xFB, 0xE6,
+0x48, 0x5D, 0x58, 0x5D, 0x00, 0x48, 0x70, 0x5D, 0x50, 0x7C, 0x6C, 0x79, 0x61, 0x5D, 0x58, 0x5D,
+0x00, 0x44, 0x74, 0x58, 0x5D, 0x58, 0x5D, 0xC0, 0xDB, 0xDE, 0x6C, 0x71, 0x58, 0x6C, 0x74, 0x44,
+0x75, 0x48, 0x49, 0x61, 0x58, 0x79, 0x49, 0x58, 0x71, 0x49, 0x74, 0x5C, 0x48, 0x6C, 0x71, 0x09,
+0x59, 0xA5, 0xC2, 0xD7, 0xBD, 0x8A, 0x52, 0xB6, 0xB5, 0x91, 0xC1, 0x2D, 0x6B, 0x31, 0x8C, 0x4D,
+0x49, 0x71, 0x00, 0x82, 0x51, 0xC1, 0xB2, 0x84, 0xDB, 0xBE, 0xA1, 0xC1, 0xF3, 0x8C, 0x75, 0x9D,
+0x96, 0xC1, 0xB6, 0xA5, 0x38, 0xAE, 0x5B, 0xC4, 0x7D, 0xCF, 0x92, 0x84, 0x3C, 0xCF, 0x51, 0x7C,
+0x9E, 0xD7, 0x7D, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x5A, 0xC2, 0x35, 0xBF, 0x0D, 0x74, 0x6E, 0x7C,
+0x95, 0x43, 0x00, 0xC1, 0x15, 0xBF, 0xB4, 0xB6, 0x43, 0x7E, 0xC7, 0x09, 0x53, 0x94, 0xB6, 0xCF,
+0x84, 0x53, 0xAE, 0x56, 0xC7, 0x2D, 0x74, 0xD4, 0xB6, 0x57, 0xCF, 0x71, 0x01, 0x60, 0xC3, 0x96,
+0xFD, 0x71, 0xCC, 0xAB, 0x72, 0xEB, 0x82, 0x54, 0xC1, 0x8E, 0x9B, 0xCF, 0xAB, 0x96, 0x90, 0xC3,
+0x10, 0xBC, 0x0C, 0x8B, 0x8E, 0xA3, 0x0C, 0x83, 0x40, 0x53, 0x47, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF,
+0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x0B, 0x5D, 0xC0, 0x5D, 0xEF, 0x71, 0x18, 0x92, 0x74,
+0x49, 0x71, 0x2B, 0x59, 0x91, 0x59, 0x69, 0xC1, 0x51, 0x8C, 0x1C, 0xDF, 0x59, 0xC1, 0xEF, 0x7B,
+0x59, 0xC6, 0x49, 0xC0, 0xFF, 0xFF, 0x00, 0x61, 0x51, 0xC8, 0xB2, 0x84, 0x1C, 0xC7, 0x79, 0xB6,
+0xD3, 0x8C, 0xAF, 0x6B, 0x2D, 0x5B, 0x10, 0x74, 0x39, 0xAE, 0x55, 0x95, 0x4C, 0xC0, 0x72, 0x84,
+0x6C, 0xC0, 0x71, 0x84, 0x4C, 0x7D, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x5A, 0x75, 0xC0, 0x6E, 0x7C,
+0x5E, 0x6F, 0x57, 0x7E, 0xC1, 0x15, 0xBF, 0x94, 0xAE, 0x7E, 0xC3, 0xD7, 0xCF, 0xB1, 0x9D, 0x6D,
+0x7C, 0xEF, 0x84, 0x4F, 0xC0, 0x50, 0x95, 0xAF, 0xC0, 0x96, 0xC7, 0x4B, 0x71, 0x01, 0xA1, 0x53,
+0xC2, 0x71, 0xCC, 0xEB, 0x82, 0xF3, 0xDC, 0x53, 0xC0, 0x4D, 0x93, 0x6A, 0xC3, 0xCF, 0xAB, 0x2C,
+0x8B, 0x51, 0xC4, 0x8E, 0x9B, 0x70, 0xC0, 0x6E, 0x9B, 0x40, 0xC0, 0x96, 0xFD, 0x47, 0xC1, 0x7D,
+0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x57, 0xC3, 0xDB, 0xD6, 0x79, 0xCE,
+0x75, 0xAD, 0x71, 0x8C, 0x68, 0xC2, 0xF7, 0xBD, 0xB3, 0x94, 0xEF, 0x7B, 0x45, 0xC1, 0x9E, 0xEF,
+0xFF, 0xFF, 0x00, 0x86, 0xC1, 0xBF, 0xD7, 0x51, 0x7C, 0x4A, 0x7A, 0x4A, 0x56, 0xC1, 0xBA, 0xBE,
+0x71, 0x7C, 0x5B, 0xA5, 0xC1, 0xFF, 0xDF, 0x92, 0x84, 0x76, 0x7B, 0xC0, 0xBE, 0xD7, 0x7D, 0xC0,
+0x9E, 0xDF, 0x71, 0x00, 0x5A, 0x75, 0x6F, 0xC0, 0x33, 0xA6, 0x91, 0xC1, 0xAE, 0x84, 0x0F, 0x8D,
+0x57, 0x43, 0x64, 0xC1, 0xF2, 0xA5, 0x70, 0x95, 0x4B, 0x5C, 0xC4, 0x71, 0x95, 0x0A, 0x53, 0x91,
+0x95, 0xF5, 0xB6, 0x77, 0xCF, 0x71, 0x01, 0x60, 0xC1, 0xB6, 0xFD, 0x31, 0xC4, 0x46, 0xC0, 0xB7,
+0xFD, 0x58, 0xC0, 0x2D, 0x93, 0x00, 0xC2, 0x10, 0xB4, 0xCB, 0x7A, 0x71, 0xCC, 0x7E, 0xC0, 0xD3,
+0xD4, 0x7E, 0x71, 0xC0, 0x96, 0xFD, 0x47, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0x70, 0x00, 0x71,
+0xE0, 0x57, 0xC0, 0x3C, 0xE7, 0x79, 0x54, 0xC0, 0xEF, 0x7B, 0x79, 0xC4, 0x34, 0xA5, 0x6D, 0x73,
+0xB6, 0xB5, 0xDB, 0xDE, 0xDF, 0xFF, 0xAE, 0x01, 0xC2, 0xBE, 0xD7, 0xD7, 0xA5, 0x31, 0x7C, 0x43,
+0x50, 0xC1, 0x79, 0xB6, 0xDF, 0xDF, 0x6B, 0x95, 0x70, 0x51, 0xC1, 0x9A, 0xB6, 0x30, 0x7C, 0x50,
+0xC0, 0x9E, 0xD7, 0x91, 0xC0, 0xBE, 0xEF, 0x71, 0x00, 0xC4, 0xBB, 0xE7, 0x35, 0xBF, 0xD1, 0x9D,
+0x76, 0xC7, 0x15, 0xBF, 0x62, 0x75, 0x77, 0x4B, 0x75, 0xC3, 0xEF, 0x84, 0x0C, 0x6C, 0xB4, 0xB6,
+0x53, 0xA6, 0xA1, 0xC0, 0x6D, 0x74, 0xBF, 0xC1, 0xB3, 0xAE, 0xBA, 0xDF, 0x71, 0x02, 0xC1, 0x59,
+0xFE, 0xB3, 0xE4, 0x40, 0x47, 0x00, 0x40, 0x00, 0xC2, 0xD3, 0xE4, 0x51, 0xCC, 0xF3, 0xE4, 0x91,
+0x58, 0xC0, 0xB2, 0xD4, 0x5C, 0xC1, 0x35, 0xFD, 0xF8, 0xFD, 0x71, 0x0C, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x08, 0xC0, 0xBE, 0xE7, 0x96, 0xE0, 0x08, 0x57, 0xC0, 0xDF, 0xF7, 0x71, 0xE0, 0x01, 0xC0,
+0x3C, 0xE7, 0x91, 0x00, 0x96, 0xBA, 0x61, 0x6D, 0xC0, 0xBE, 0xF7, 0x71, 0x02, 0x69, 0x60, 0xAE,
+0xA1, 0x4C, 0x54, 0x91, 0x54, 0x00, 0x4F, 0x40, 0x4C, 0x60, 0x4C, 0xA6, 0x57, 0x71, 0x02, 0xC1,
+0x9B, 0xDF, 0x97, 0xCF, 0x92, 0x00, 0xBE, 0xA6, 0x58, 0x00, 0x4E, 0x58, 0xAB, 0x53, 0x01, 0xC0,
+0xB8, 0xD7, 0x9A, 0xC0, 0x9A, 0xDF, 0x71, 0x03, 0xA1, 0xC1, 0x79, 0xFE, 0xB7, 0xFD, 0xA9, 0x00,
+0xAF, 0x00, 0x5F, 0x64, 0x5F, 0x00, 0xA5, 0x5F, 0x00, 0xC0, 0x38, 0xFE, 0x60, 0x71, 0x0C, 0x70,
+0x00, 0x71, 0x07, 0x4F, 0x85, 0x00, 0xAF, 0x51, 0x00, 0x7D, 0x4C, 0x51, 0x00, 0x92, 0x7D, 0x02,
+0x51, 0x00, 0x44, 0x7D, 0x07, 0x4C, 0x7D, 0x01, 0x44, 0x00, 0xA5, 0x7D, 0x4C, 0x7D, 0x01, 0x4C,
+0x7D, 0x01, 0x4C, 0x7D, 0x44, 0x7D, 0x01, 0x44, 0x51, 0x00, 0x7D, 0x44, 0x51, 0x00, 0x44, 0x7D,
+0x4C, 0x7D, 0x00, 0x51, 0x00, 0x44, 0x7D, 0x4C, 0x7D, 0x09, 0x40, 0xC0, 0xFF, 0xF7, 0x71, 0xE0,
+0x38, 0xA6, 0x0A, 0x71, 0x0E, 0x70, 0x00, 0x71, 0x06, 0x69, 0x7D, 0x00, 0x4C, 0xC2, 0xDB, 0xC6,
+0xB3, 0x84, 0x55, 0x95, 0x7D, 0xC0, 0x9A, 0xBE, 0x4A, 0xC1, 0x76, 0x9D, 0x1C, 0xC7, 0x4C, 0x7D,
+0x4C, 0x78, 0xC1, 0x34, 0x95, 0xD3, 0x8C, 0x50, 0x4C, 0x00, 0x40, 0x7D, 0x00, 0x47, 0x00, 0x40,
+0x7D, 0xC0, 0x96, 0x9D, 0x78, 0x40, 0x4C, 0x7C, 0x6B, 0x51, 0x64, 0xC0, 0xF7, 0xA5, 0x7D, 0x4C,
+0xC1, 0xFC, 0xC6, 0xB6, 0xA5, 0x4C, 0x47, 0x7D, 0x6F, 0x64, 0x5F, 0x40, 0x7D, 0x47, 0x64, 0xC0,
+0xF3, 0x8C, 0x4A, 0x78, 0x50, 0x4F, 0xC1, 0x75, 0x9D, 0xFB, 0xC6, 0x51, 0x6B, 0xC0, 0x3C, 0xCF,
+0x47, 0x5B, 0x76, 0x6C, 0x58, 0xC0, 0xF8, 0xAD, 0x4C, 0x7D, 0x09, 0x57, 0x71, 0x3C, 0xC2, 0x59,
+0xCE, 0xCF, 0x7B, 0x34, 0xAD, 0x61, 0xC1, 0x55, 0xAD, 0xDF, 0xFF, 0x79, 0x00, 0xC0, 0xEF, 0x7B,
+0x55, 0x6C, 0xAE, 0xE0, 0x0B, 0x70, 0x00, 0x71, 0x06, 0x66, 0x7D, 0x00, 0x40, 0xC1, 0xCF, 0x6B,
+0xF4, 0x8C, 0x7B, 0x78, 0xC0, 0x92, 0x84, 0x66, 0x62, 0xC1, 0x6D, 0x63, 0x1C, 0xC7, 0x4C, 0x00,
+0xC1, 0x10, 0x74, 0x51, 0x7C, 0x4A, 0x5B, 0x7D, 0xC0, 0xBA, 0xBE, 0x7D, 0x47, 0x7D, 0xA1, 0x64,
+0x78, 0x50, 0xC0, 0xEF, 0x73, 0x6C, 0x47, 0x51, 0x62, 0x6B, 0xC0, 0xDF, 0xDF, 0x7B, 0xC0, 0x69,
+0x4A, 0x78, 0x4C, 0x44, 0xC1, 0x30, 0x7C, 0xFB, 0xC6, 0x7D, 0x40, 0xC0, 0x38, 0xAE, 0x50, 0x7A,
+0x58, 0x40, 0x51, 0x7A, 0xC0, 0xB3, 0x84, 0x7B, 0x58, 0x4F, 0xC2, 0x6E, 0x63, 0xB2, 0x84, 0x2C,
+0x5B, 0x58, 0x7A, 0x44, 0x67, 0x7A, 0x76, 0xC2, 0xAF, 0x6B, 0x3D, 0xCF, 0x31, 0x7C, 0x6C, 0x40,
+0x7D, 0x08, 0xC0, 0x9E, 0xDF, 0x71, 0x3B, 0xC5, 0x9E, 0xF7, 0x30, 0x84, 0xFB, 0xDE, 0x9A, 0xD6,
+0x38, 0xC6, 0x8A, 0x52, 0x75, 0xC0, 0x55, 0xAD, 0xAE, 0xC2, 0xD7, 0xBD, 0x14, 0xA5, 0x96, 0xB5,
+0x71, 0xE0, 0x0B, 0x70, 0x00, 0x71, 0x06, 0x86, 0x7D, 0x40, 0x96, 0x72, 0x7F, 0xC0, 0xFF, 0xDF,
+0x60, 0x62, 0xC1, 0xF7, 0xAD, 0xFF, 0xE7, 0x62, 0xC0, 0x34, 0x95, 0x60, 0x7F, 0xC0, 0x8E, 0x6B,
+0x51, 0x60, 0x91, 0x5B, 0xC1, 0xCF, 0x73, 0x71, 0x84, 0x51, 0x4F, 0xC0, 0x4D, 0x63, 0x4F, 0xC0,
+0xEF, 0x73, 0x91, 0x41, 0x78, 0x4C, 0xC0, 0x1C, 0xC7, 0x7A, 0x7D, 0xC0, 0xDB, 0xBE, 0x4E, 0xC0,
+0xCF, 0x6B, 0x6C, 0x4C, 0x50, 0xC0, 0xEC, 0x5A, 0x55, 0x4E, 0x4C, 0xC0, 0x14, 0x8D, 0x52, 0x79,
+0xC0, 0x72, 0x84, 0x7D, 0x4C, 0x46, 0xC0, 0x18, 0xAE, 0x65, 0x00, 0x4A, 0xC1, 0x55, 0x9D, 0xFF,
+0xE7, 0x4A, 0x76, 0x56, 0x5C, 0xC0, 0x8E, 0x63, 0x7D, 0x65, 0x66, 0xC0, 0x39, 0xB6, 0x76, 0x5C,
+0x4C, 0x7D, 0x08, 0xC0, 0x9E, 0xDF, 0x71, 0x3B, 0xC1, 0x9A, 0xD6, 0x55, 0xAD, 0x71, 0x91, 0x48,
+0xC1, 0xAE, 0x73, 0xD7, 0xBD, 0x91, 0x00, 0x61, 0x58, 0xC0, 0xD3, 0x9C, 0x71, 0xE0, 0x0B, 0x70,
+0x00, 0x71, 0x06, 0x86, 0x7D, 0x00, 0xBF, 0x6A, 0xC0, 0xCB, 0x52, 0x5A, 0x40, 0x67, 0xC0, 0xB7,
+0xA5, 0x65, 0x6F, 0x62, 0x65, 0xC0, 0xF8, 0xAD, 0x42, 0x51, 0x7D, 0x4C, 0x50, 0x6F, 0x72, 0xC0,
+0x1C, 0xC7, 0x62, 0x5E, 0x4B, 0xC0, 0xB3, 0x84, 0x64, 0x46, 0xC0, 0x5D, 0xCF, 0x4C, 0x44, 0x7A,
+0x51, 0x7B, 0x5C, 0x7A, 0x73, 0x4C, 0xC0, 0xBB, 0xBE, 0x46, 0x4C, 0x7A, 0xC0, 0x79, 0xB6, 0x49,
+0x7F, 0x4E, 0x7D, 0xBB, 0x4C, 0xC1, 0xF7, 0xA5, 0xEC, 0x5A, 0x41, 0x6C, 0xC0, 0x34, 0x95, 0x00,
+0x65, 0x5C, 0x4E, 0x56, 0x6F, 0xC0, 0xEF, 0x73, 0x4C, 0x60, 0xC0, 0x72, 0x84, 0x7E, 0x4F, 0x6F,
+0x51, 0x7D, 0x08, 0xC0, 0x9E, 0xDF, 0x71, 0x3B, 0xC1, 0x79, 0xCE, 0x96, 0xB5, 0x75, 0xC3, 0xCF,
+0x7B, 0xB6, 0xB5, 0x34, 0xAD, 0xB2, 0x94, 0x78, 0x00, 0xC1, 0xDB, 0xDE, 0xBE, 0xF7, 0x7C, 0x71,
+0xE0, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0xC0, 0x7D, 0xCF, 0x01, 0x65, 0x60, 0x7A,
+0x63, 0x7B, 0x48, 0xC1, 0xFF, 0xE7, 0xB3, 0x84, 0x4A, 0x60, 0xC0, 0x7A, 0xB6, 0x5A, 0xC0, 0xBF,
+0xDF, 0x9A, 0x4C, 0x7A, 0xC0, 0x55, 0x95, 0x46, 0x50, 0x7B, 0xC1, 0x39, 0xAE, 0x75, 0x9D, 0x00,
+0x60, 0xC1, 0xEF, 0x73, 0x5D, 0xCF, 0x4C, 0x44, 0x42, 0x78, 0xC0, 0x2D, 0x5B, 0x69, 0xC1, 0x28,
+0x42, 0xB6, 0xA5, 0x60, 0x44, 0xC1, 0x30, 0x74, 0xFF, 0xDF, 0x62, 0x57, 0xC1, 0x71, 0x7C, 0x9A,
+0xBE, 0x4E, 0x47, 0x00, 0x7D, 0x65, 0x60, 0x67, 0x76, 0x63, 0x5E, 0x68, 0x5E, 0x67, 0x56, 0x57,
+0x55, 0x40, 0x65, 0xC1, 0xF0, 0x73, 0x38, 0xAE, 0x4A, 0xC0, 0xB6, 0x9D, 0x51, 0x7D, 0x08, 0x4F,
+0x71, 0x3B, 0xC1, 0x3C, 0xE7, 0x71, 0x94, 0x71, 0xC0, 0x55, 0xAD, 0x95, 0xC1, 0x18, 0xC6, 0x92,
+0x94, 0x00, 0xC3, 0xB6, 0xB5, 0xDB, 0xDE, 0x59, 0xCE, 0xF3, 0xA4, 0x71, 0xE0, 0x0B, 0x70, 0x00,
+0x71, 0x06, 0x66, 0xC0, 0x7D, 0xCF, 0x00, 0x78, 0xC0, 0x34, 0x95, 0x57, 0x5A, 0x57, 0x62, 0x7A,
+0x4A, 0x41, 0xC0, 0xFB, 0xC6, 0x4C, 0x00, 0xC0, 0xCF, 0x6B, 0x76, 0x6F, 0x5E, 0x5A, 0x48, 0xC1,
+0xAA, 0x4A, 0xDB, 0xC6, 0x67, 0x52, 0x7F, 0x66, 0xC1, 0x35, 0x95, 0xEB, 0x52, 0x7D, 0x4C, 0xC0,
+0x3C, 0xCF, 0x7A, 0x73, 0x4B, 0xC1, 0x38, 0xAE, 0xEB, 0x5A, 0x7F, 0x51, 0x50, 0xC0, 0x8A, 0x4A,
+0x6F, 0xC0, 0x8E, 0x6B, 0x5F, 0x7A, 0x50, 0x66, 0x6F, 0x40, 0x47, 0x5B, 0xC1, 0xF7, 0xAD, 0xF0,
+0x73, 0x6F, 0x56, 0x5A, 0x5B, 0x72, 0xC0, 0xBA, 0xBE, 0x7A, 0x7F, 0x4E, 0x62, 0x5B, 0x46, 0x4C,
+0x62, 0x6B, 0x4C, 0x7D, 0x08, 0xC0, 0x9E, 0xDF, 0x71, 0x3C, 0xC2, 0x14, 0xA5, 0xCF, 0x7B, 0x71,
+0x8C, 0x60, 0x74, 0x95, 0x68, 0xC3, 0xF7, 0xBD, 0x4D, 0x6B, 0x10, 0x84, 0x3C, 0xE7, 0x71, 0xE0,
+0x0B, 0x70, 0x00, 0x71, 0x06, 0x86, 0x7D, 0x00, 0xBA, 0x63, 0x42, 0xC2, 0x55, 0x9D, 0xBE, 0xD7,
+0x39, 0xB6, 0x67, 0x7B, 0xC0, 0xDB, 0xBE, 0x4C, 0x7D, 0x4C, 0xC0, 0x1C, 0xC7, 0x67, 0x4E, 0x7F,
+0x57, 0xC0, 0x71, 0x84, 0x6F, 0x78, 0xC0, 0x79, 0xB6, 0x50, 0x51, 0x5E, 0x67, 0xC0, 0xD7, 0xA5,
+0x7D, 0x40, 0x51, 0x67, 0x5C, 0xC0, 0xBF, 0xDF, 0x4C, 0x52, 0x7D, 0x47, 0x90, 0x6F, 0xC0, 0x71,
+0x7C, 0x4B, 0x4C, 0x57, 0x78, 0x5C, 0xC0, 0x14, 0x95, 0x78, 0x4C, 0x77, 0x49, 0x4A, 0x47, 0x7F,
+0x67, 0x76, 0xC0, 0x9A, 0xB6, 0x51, 0x57, 0x64, 0x78, 0x76, 0x53, 0x50, 0x78, 0x42, 0x78, 0x40,
+0x7D, 0x08, 0x4F, 0x71, 0x3D, 0xC0, 0xFB, 0xE6, 0x5D, 0x71, 0x03, 0xC0, 0x9E, 0xF7, 0x71, 0xE0,
+0x0D, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x86, 0x7D, 0x01, 0x51, 0xAB, 0x51, 0x7D, 0x4C, 0xC0,
+0xDF, 0xDF, 0x00, 0x4C, 0x7D, 0x01, 0x4C, 0x58, 0x00, 0x4C, 0x00, 0x58, 0x51, 0x40, 0x4C, 0x00,
+0x7D, 0x51, 0x01, 0x7D, 0x00, 0x4C, 0xC0, 0xBB, 0xBE, 0x91, 0x4C, 0x7D, 0x51, 0x40, 0x7D, 0x40,
+0x51, 0x58, 0x4C, 0x7D, 0x51, 0x7D, 0x4C, 0x5B, 0x7D, 0x00, 0x51, 0x58, 0x51, 0x7D, 0x4C, 0x60,
+0x00, 0x4C, 0x7D, 0x51, 0x47, 0x00, 0x58, 0x00, 0x4C, 0xC0, 0xFB, 0xC6, 0x6B, 0x4C, 0x7D, 0x09,
+0x4F, 0x71, 0xE0, 0x00, 0xA6, 0x5D, 0x00, 0x91, 0xAF, 0x5D, 0x6C, 0x71, 0x04, 0x96, 0xAE, 0x00,
+0x66, 0x09, 0x71, 0x04, 0xC1, 0xBC, 0xEF, 0xFC, 0xEF, 0xA6, 0x96, 0x56, 0x51, 0x49, 0x56, 0x51,
+0x95, 0x00, 0x49, 0xC0, 0xFE, 0xF7, 0x71, 0x07, 0xA1, 0xC0, 0x3C, 0xFF, 0xA2, 0xA9, 0x74, 0x01,
+0x6D, 0xAF, 0x00, 0x6D, 0x79, 0x74, 0xC0, 0x9E, 0xFF, 0x71, 0x0D, 0x70, 0x00, 0x71, 0x06, 0x66,
+0x7D, 0x07, 0xBF, 0x00, 0x47, 0x4C, 0x47, 0x7D, 0x00, 0x4C, 0x7D, 0x00, 0x4C, 0x00, 0x7D, 0x08,
+0x4C, 0x00, 0x7D, 0x1D, 0x40, 0x4C, 0x7D, 0x0A, 0x4F, 0x71, 0x3F, 0x5D, 0xC3, 0xDB, 0xD6, 0x96,
+0xAD, 0x34, 0xA5, 0x9A, 0xCE, 0xBE, 0xC0, 0x75, 0xAD, 0xBF, 0xC0, 0x5D, 0xE7, 0x71, 0x02, 0xC0,
+0xBE, 0xE7, 0x4C, 0x5C, 0x48, 0xC0, 0x5D, 0xCF, 0x50, 0x7D, 0x58, 0x78, 0x58, 0x00, 0x7D, 0x02,
+0x4C, 0x6E, 0x71, 0x00, 0x95, 0xC0, 0x77, 0xCF, 0x80, 0xC1, 0xB1, 0x95, 0x32, 0xA6, 0x75, 0xC2,
+0x91, 0x95, 0x53, 0xA6, 0x15, 0xBF, 0x4E, 0xC1, 0x93, 0xAE, 0x56, 0xC7, 0x75, 0x00, 0x44, 0xC0,
+0xDD, 0xEF, 0x71, 0x05, 0x7E, 0xC3, 0x55, 0xF5, 0x51, 0xCC, 0xD3, 0xE4, 0x34, 0xF5, 0x96, 0x01,
+0xBF, 0x57, 0x00, 0xC0, 0x55, 0xFD, 0x57, 0xC1, 0x14, 0xF5, 0x75, 0xFD, 0x6D, 0x71, 0x0C, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0x7D, 0x06, 0x40, 0xC3, 0x59, 0xB6, 0xBA, 0xBE, 0x1C, 0xC7,
+0x39, 0xAE, 0x64, 0x4C, 0x7D, 0x64, 0x7D, 0x78, 0x44, 0x5F, 0x4C, 0x40, 0x4C, 0xA6, 0x4C, 0x40,
+0x47, 0x4C, 0x47, 0x40, 0x47, 0x7D, 0x2C, 0x4F, 0x71, 0x3F, 0xC0, 0xFB, 0xDE, 0x45, 0x68, 0xC0,
+0x4D, 0x6B, 0x55, 0xC2, 0xB6, 0xB5, 0x6D, 0x6B, 0xF3, 0x9C, 0x45, 0x5D, 0x71, 0x00, 0x96, 0xC0,
+0xBE, 0xD7, 0x43, 0x5A, 0xC2, 0x51, 0x7C, 0x79, 0xB6, 0x92, 0x84, 0x51, 0x4A, 0x52, 0xC0, 0x31,
+0x7C, 0x50, 0x4C, 0x95, 0x01, 0x78, 0x4F, 0x71, 0x00, 0xC4, 0x79, 0xD7, 0x76, 0xC7, 0xCF, 0x84,
+0xCC, 0x6B, 0x8E, 0x7C, 0xBE, 0xC2, 0xEC, 0x6B, 0x30, 0x8D, 0x33, 0xA6, 0x56, 0x51, 0xC1, 0x15,
+0xBF, 0x56, 0xC7, 0xA6, 0x75, 0xC0, 0x57, 0xCF, 0x71, 0x04, 0xA6, 0xC4, 0xF7, 0xFD, 0x51, 0xCC,
+0x8A, 0x6A, 0x0C, 0x83, 0x30, 0xBC, 0xA6, 0x96, 0xC2, 0x8E, 0xA3, 0x92, 0xD4, 0x0C, 0x8B, 0x51,
+0xC1, 0x96, 0xFD, 0x49, 0x62, 0x40, 0xC0, 0x76, 0xFD, 0x53, 0x60, 0x71, 0x0B, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x06, 0x66, 0xC0, 0x7D, 0xCF, 0x05, 0xC2, 0xBE, 0xD7, 0xF7, 0xA5, 0xB2, 0x84, 0x6B,
+0xC1, 0x75, 0x9D, 0x71, 0x7C, 0xA6, 0xC0, 0xFB, 0xC6, 0x4C, 0xC0, 0xF3, 0x8C, 0x78, 0x00, 0xC2,
+0x96, 0x9D, 0xD3, 0x8C, 0xDB, 0xC6, 0x7D, 0xC0, 0x9A, 0xBE, 0x53, 0xC0, 0x79, 0xB6, 0x78, 0xA5,
+0x70, 0x5F, 0x7D, 0xC1, 0x1C, 0xC7, 0x7D, 0xD7, 0x7D, 0x2B, 0x4F, 0x71, 0x3F, 0x59, 0x45, 0x59,
+0xC0, 0x55, 0xA5, 0x41, 0xC0, 0x71, 0x8C, 0x68, 0xC0, 0x59, 0xC6, 0x45, 0xC1, 0x7D, 0xEF, 0xFF,
+0xFF, 0x00, 0x66, 0xC0, 0x9E, 0xCF, 0x4E, 0x53, 0x51, 0x78, 0x4E, 0xC3, 0xBF, 0xDF, 0x34, 0x95,
+0x8E, 0x6B, 0xD7, 0xA5, 0x51, 0x7D, 0x03, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC3, 0x78, 0xCF, 0xF4,
+0xB6, 0x0C, 0x74, 0x76, 0xC7, 0x00, 0xC3, 0x0D, 0x74, 0x73, 0xAE, 0xB7, 0xCF, 0x36, 0xC7, 0x5D,
+0xC1, 0x8E, 0x7C, 0x73, 0xAE, 0x44, 0x7F, 0x75, 0x44, 0xC0, 0xFE, 0xFF, 0x71, 0x03, 0x60, 0xC1,
+0x96, 0xFD, 0x51, 0xC4, 0xAE, 0x4D, 0xA9, 0x96, 0x00, 0xC6, 0x6E, 0x9B, 0x10, 0xB4, 0x8E, 0xA3,
+0x8A, 0x72, 0xB2, 0xD4, 0x69, 0x6A, 0x92, 0xD4, 0x53, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0x7D, 0x05, 0x51, 0x48, 0xC0, 0x30, 0x7C, 0x58, 0x63, 0xC1,
+0xBB, 0xBE, 0xD7, 0xA5, 0x6F, 0x51, 0x67, 0x78, 0x95, 0xC1, 0xD3, 0x84, 0x10, 0x74, 0x76, 0x6F,
+0xC1, 0x31, 0x7C, 0x9A, 0xBE, 0x76, 0xC0, 0x55, 0x95, 0x00, 0x76, 0x5B, 0xC0, 0x18, 0xAE, 0x6F,
+0x51, 0x7D, 0x2B, 0xC0, 0x9E, 0xDF, 0x71, 0x3F, 0xC0, 0xDB, 0xD6, 0xA5, 0xC8, 0xD7, 0xBD, 0xAA,
+0x52, 0xB6, 0xB5, 0xCF, 0x7B, 0x2D, 0x63, 0xEF, 0x7B, 0x9A, 0xCE, 0x7D, 0xEF, 0xFF, 0xFF, 0x00,
+0x66, 0xC3, 0x3D, 0xCF, 0x71, 0x7C, 0x3C, 0xCF, 0x7E, 0xD7, 0x99, 0x4E, 0xC0, 0xDF, 0xDF, 0x67,
+0xC0, 0x8A, 0x4A, 0x51, 0xA1, 0x7D, 0x03, 0x4F, 0x71, 0x00, 0xC3, 0x98, 0xD7, 0x73, 0xAE, 0x8E,
+0x7C, 0x76, 0xC7, 0x00, 0xC6, 0xD1, 0x9D, 0xA9, 0x4A, 0x0F, 0x8D, 0x97, 0xC7, 0xD4, 0xB6, 0x2D,
+0x74, 0x36, 0xBF, 0x44, 0xA6, 0x75, 0x44, 0xC0, 0xFE, 0xF7, 0x71, 0x03, 0xA1, 0xC1, 0x96, 0xFD,
+0x71, 0xCC, 0x54, 0xC2, 0xEB, 0x82, 0xD3, 0xDC, 0x8E, 0x9B, 0x7E, 0xA6, 0x80, 0xC1, 0x10, 0xBC,
+0x0C, 0x8B, 0x67, 0x7F, 0xC0, 0x92, 0xD4, 0x53, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0x7D, 0x06, 0xBF, 0xC0, 0x79, 0xB6, 0x4E, 0xC0, 0x14, 0x8D,
+0x50, 0x6F, 0xAE, 0x51, 0x76, 0x4C, 0x6C, 0xC0, 0x31, 0x7C, 0x63, 0x6B, 0xC3, 0xB2, 0x84, 0xF7,
+0xAD, 0x9A, 0xBE, 0xB3, 0x8C, 0x80, 0x63, 0xC0, 0xDB, 0xC6, 0x4B, 0xC0, 0xF0, 0x73, 0x7F, 0x4C,
+0x7D, 0x2B, 0xC1, 0x9E, 0xDF, 0xFF, 0xFF, 0x3F, 0x59, 0x91, 0xC4, 0xDB, 0xDE, 0xB6, 0xB5, 0x71,
+0x8C, 0x10, 0x84, 0x59, 0xC6, 0x40, 0xC2, 0x38, 0xC6, 0x7D, 0xEF, 0xFF, 0xFF, 0x00, 0x66, 0xC0,
+0x7D, 0xCF, 0x4E, 0xC1, 0x1C, 0xC7, 0xBF, 0xD7, 0x7D, 0xC5, 0x71, 0x7C, 0xFF, 0xDF, 0x55, 0x9D,
+0x6D, 0x63, 0xB6, 0xA5, 0xBF, 0xDF, 0x7D, 0x03, 0x4F, 0x71, 0x00, 0x5A, 0xC0, 0xB4, 0xB6, 0x6A,
+0xC0, 0x97, 0xCF, 0x95, 0x5D, 0xC1, 0x15, 0xBF, 0xAB, 0x63, 0x70, 0xC1, 0xCF, 0x84, 0x12, 0xA6,
+0x49, 0xA2, 0x00, 0x99, 0x44, 0xC0, 0xFE, 0xF7, 0x71, 0x03, 0x60, 0xC3, 0x96, 0xFD, 0x71, 0xCC,
+0x0C, 0x83, 0x14, 0xE5, 0x53, 0xC1, 0x4D, 0x93, 0x8E, 0xA3, 0x7E, 0xC3, 0x2C, 0x8B, 0x51, 0xC4,
+0x8E, 0x9B, 0xEB, 0x82, 0x67, 0xC1, 0x92, 0xCC, 0x96, 0xFD, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF,
+0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0xC0, 0x7D, 0xCF, 0x05, 0x4C, 0x6B, 0x76, 0x7B,
+0xC0, 0x55, 0x95, 0x7A, 0xC0, 0x92, 0x84, 0x64, 0x51, 0x4E, 0xAE, 0x6B, 0x7B, 0xC3, 0x30, 0x74,
+0xB2, 0x84, 0xD7, 0xA5, 0x18, 0xAE, 0x00, 0x53, 0xC0, 0xB3, 0x84, 0x43, 0xC3, 0xBB, 0xBE, 0xFB,
+0xC6, 0xAF, 0x6B, 0x7D, 0xD7, 0x00, 0x7D, 0x2B, 0xC0, 0x9E, 0xDF, 0x71, 0x3F, 0xC4, 0xDB, 0xD6,
+0x79, 0xCE, 0x34, 0xA5, 0x30, 0x84, 0xD3, 0x9C, 0x41, 0x45, 0xC0, 0xCF, 0x7B, 0x79, 0xC0, 0x7D,
+0xEF, 0x71, 0x00, 0x82, 0x51, 0xC0, 0x34, 0x95, 0x62, 0x63, 0xC1, 0x9A, 0xBE, 0xAE, 0x6B, 0x6F,
+0xC0, 0xEF, 0x73, 0x57, 0x6E, 0xC0, 0xBA, 0xBE, 0x4C, 0x7D, 0x02, 0xC0, 0x9E, 0xDF, 0x71, 0x00,
+0xC0, 0x78, 0xCF, 0x94, 0xC2, 0x2D, 0x74, 0x0F, 0x8D, 0x50, 0x8D, 0xBE, 0xC1, 0xB1, 0x9D, 0x0D,
+0x74, 0x51, 0xC2, 0xE9, 0x52, 0x91, 0x95, 0x15, 0xBF, 0x44, 0xA6, 0x99, 0x44, 0xC0, 0xFE, 0xFF,
+0x71, 0x03, 0x60, 0xC1, 0x96, 0xFD, 0x31, 0xC4, 0x80, 0xC0, 0xB7, 0xFD, 0xA9, 0xC0, 0x2D, 0x93,
+0xAE, 0xC2, 0x10, 0xBC, 0xEB, 0x82, 0x71, 0xCC, 0x7E, 0xC0, 0xF4, 0xDC, 0x7E, 0x71, 0xC0, 0x96,
+0xFD, 0x47, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0xC0,
+0x7D, 0xCF, 0x05, 0x40, 0x78, 0xC0, 0xBA, 0xBE, 0x78, 0x7D, 0xC0, 0xDB, 0xBE, 0x78, 0x4C, 0x40,
+0x91, 0x50, 0x73, 0x7D, 0xC0, 0x1C, 0xC7, 0x00, 0x40, 0x7D, 0x00, 0xC0, 0xDB, 0xC6, 0x78, 0x7D,
+0x4C, 0x43, 0xC1, 0x76, 0x9D, 0xBE, 0xD7, 0x7D, 0x2C, 0xC0, 0x9E, 0xDF, 0x71, 0x01, 0xA6, 0xC0,
+0x5D, 0xEF, 0xAE, 0x6C, 0x71, 0x0D, 0x6C, 0x71, 0x00, 0xC0, 0x9E, 0xF7, 0x6C, 0x71, 0x02, 0x58,
+0x71, 0x06, 0x6C, 0x00, 0x71, 0x02, 0x58, 0x71, 0x10, 0xC0, 0x1C, 0xDF, 0x79, 0xC0, 0x92, 0x94,
+0x45, 0x79, 0x00, 0xC3, 0x10, 0x84, 0x75, 0xAD, 0xBA, 0xD6, 0xBE, 0xF7, 0x71, 0x00, 0x96, 0x7D,
+0x78, 0x76, 0x96, 0x73, 0x6A, 0x67, 0x4A, 0x78, 0xC0, 0x79, 0xB6, 0x00, 0x4C, 0x7D, 0x01, 0x78,
+0xC0, 0xBE, 0xE7, 0x71, 0x00, 0xCC, 0x9A, 0xDF, 0x55, 0xBF, 0xD4, 0xB6, 0x4D, 0x74, 0x50, 0x8D,
+0xD2, 0x9D, 0x2D, 0x74, 0x12, 0xA6, 0x94, 0xAE, 0x8E, 0x7C, 0xEF, 0x84, 0xF5, 0xBE, 0x56, 0xC7,
+0x7F, 0x99, 0x5A, 0x71, 0x05, 0xC1, 0xF8, 0xFD, 0xD3, 0xE4, 0x54, 0xC0, 0x76, 0xFD, 0x00, 0xC0,
+0xB3, 0xDC, 0x99, 0xC2, 0xF4, 0xE4, 0x92, 0xD4, 0x14, 0xED, 0x54, 0x5F, 0x54, 0x63, 0xC1, 0x55,
+0xFD, 0xB6, 0xFD, 0x6C, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0x7D, 0x06, 0x4C,
+0x51, 0x4C, 0x00, 0x51, 0x00, 0x7D, 0x00, 0x4C, 0x00, 0xA5, 0x00, 0xAB, 0x00, 0x7D, 0x00, 0x47,
+0x4C, 0x40, 0x7D, 0x4C, 0xC0, 0xFB, 0xC6, 0x7D, 0x51, 0x4C, 0x00, 0x47, 0x4C, 0x03, 0x51, 0x4C,
+0x03, 0x40, 0x7D, 0x00, 0x4C, 0x00, 0x47, 0x4C, 0x51, 0x4C, 0x02, 0x7D, 0x4C, 0x40, 0x4C, 0x51,
+0x4C, 0x47, 0x51, 0x00, 0x47, 0x4C, 0x7D, 0x07, 0xC0, 0x9E, 0xDF, 0x71, 0x01, 0xC1, 0x3C, 0xE7,
+0x51, 0x8C, 0xAE, 0x4D, 0xC0, 0xBE, 0xF7, 0x71, 0xC0, 0x9E, 0xF7, 0x6C, 0x71, 0xC0, 0x7E, 0xF7,
+0x71, 0x6C, 0xC0, 0x5D, 0xEF, 0x6C, 0x71, 0x6C, 0x71, 0x00, 0xC1, 0x14, 0xA5, 0x38, 0xC6, 0x71,
+0x44, 0x68, 0xC0, 0x75, 0xAD, 0x71, 0x00, 0x58, 0x00, 0x4D, 0x5D, 0x58, 0x71, 0x6C, 0x58, 0x71,
+0x49, 0x6C, 0x4D, 0xC0, 0x38, 0xCE, 0x71, 0x00, 0x58, 0x49, 0xC0, 0xBA, 0xDE, 0x71, 0xC0, 0x7D,
+0xF7, 0x71, 0x5D, 0x49, 0x71, 0x0B, 0x6C, 0xC0, 0xFB, 0xDE, 0x96, 0x00, 0xA1, 0x9A, 0x59, 0x00,
+0x49, 0x71, 0x02, 0x81, 0x40, 0x51, 0x00, 0x7D, 0x51, 0xBF, 0x9A, 0x7D, 0xBF, 0x00, 0x7D, 0x02,
+0x4F, 0x71, 0x02, 0xC0, 0x78, 0xD7, 0x84, 0xC0, 0x96, 0xC7, 0xA6, 0x00, 0x4E, 0x49, 0x44, 0xC0,
+0x97, 0xCF, 0x4E, 0x92, 0xA5, 0x00, 0xC1, 0x57, 0xCF, 0xDD, 0xF7, 0x71, 0x05, 0xC2, 0x7D, 0xFF,
+0xD7, 0xFD, 0x75, 0xFD, 0x42, 0x00, 0xAF, 0x00, 0x47, 0x4E, 0x47, 0x00, 0x42, 0x47, 0x00, 0xC1,
+0xB6, 0xFD, 0x3C, 0xFF, 0x71, 0x0C, 0x70, 0x00, 0x71, 0x06, 0x66, 0x7D, 0x05, 0xBB, 0xC3, 0x1C,
+0xC7, 0x14, 0x8D, 0xF7, 0xA5, 0x79, 0xB6, 0x67, 0xC0, 0xD7, 0xA5, 0x4C, 0x78, 0x48, 0x4C, 0xA6,
+0x4C, 0x00, 0x47, 0x4C, 0xAF, 0xC0, 0xBA, 0xBE, 0x00, 0x51, 0x00, 0xC2, 0xFB, 0xC6, 0x7A, 0xB6,
+0xF7, 0xAD, 0x76, 0x44, 0x00, 0x58, 0x44, 0x43, 0x44, 0xA6, 0xC0, 0x38, 0xAE, 0x62, 0xC2, 0x34,
+0x95, 0x59, 0xB6, 0x96, 0x9D, 0x70, 0xAF, 0xC0, 0xFC, 0xC6, 0x47, 0x4C, 0x48, 0x7B, 0xC0, 0xDB,
+0xC6, 0x4F, 0x4A, 0x64, 0x53, 0x76, 0x43, 0x51, 0xC0, 0xB6, 0xA5, 0x64, 0xC0, 0x18, 0xAE, 0x76,
+0xC0, 0xDB, 0xBE, 0x00, 0xC0, 0xB3, 0x8C, 0x6F, 0x64, 0x57, 0x4C, 0x7D, 0x06, 0xC1, 0x9E, 0xDF,
+0xFF, 0xFF, 0x02, 0x79, 0xC1, 0xD7, 0xBD, 0x55, 0xAD, 0x95, 0xC4, 0xDB, 0xDE, 0xF3, 0x9C, 0x96,
+0xB5, 0x18, 0xC6, 0x71, 0x8C, 0x4C, 0x95, 0xBA, 0x68, 0x5C, 0x4C, 0x71, 0xC2, 0x5D, 0xEF, 0x92,
+0x94, 0x59, 0xCE, 0x71, 0x60, 0x74, 0x64, 0xC0, 0x9E, 0xF7, 0x44, 0xC0, 0xB2, 0x9C, 0x4D, 0x65,
+0x64, 0xC0, 0x71, 0x94, 0x60, 0xC0, 0xF3, 0xA4, 0x96, 0xC0, 0x3C, 0xE7, 0x78, 0xA5, 0x79, 0x65,
+0x71, 0x60, 0x5C, 0x55, 0x79, 0x6C, 0x68, 0xC1, 0x38, 0xCE, 0x14, 0xA5, 0x65, 0x71, 0x0E, 0xA6,
+0x95, 0x01, 0x71, 0x06, 0x96, 0x0B, 0x71, 0x04, 0x5B, 0x9A, 0x08, 0x5B, 0x71, 0x08, 0x6C, 0xC0,
+0x5D, 0xFF, 0x0A, 0x6C, 0x71, 0x0D, 0x70, 0x00, 0x71, 0x06, 0x66, 0xC0, 0x7D, 0xCF, 0x05, 0x51,
+0xC0, 0x75, 0x9D, 0x7B, 0xC1, 0x5D, 0xCF, 0x35, 0x95, 0x6F, 0x62, 0xC4, 0x39, 0xAE, 0x9E, 0xD7,
+0x51, 0x7C, 0x14, 0x8D, 0x1C, 0xC7, 0x57, 0x6F, 0xC0, 0x3D, 0xCF, 0x5E, 0xAE, 0xC0, 0x79, 0xB6,
+0xAB, 0x6F, 0x63, 0x96, 0xC0, 0x9A, 0xB6, 0x7B, 0x47, 0xBE, 0x6F, 0x6B, 0x43, 0xC1, 0xCF, 0x73,
+0xB7, 0xA5, 0x5B, 0x78, 0xC3, 0x71, 0x7C, 0x38, 0xAE, 0xB6, 0xA5, 0x8E, 0x6B, 0x4E, 0x5B, 0x7C,
+0x4C, 0x64, 0xC2, 0x30, 0x74, 0x9A, 0xBE, 0xDB, 0xBE, 0x62, 0x48, 0x67, 0x6E, 0x57, 0x7C, 0x78,
+0x55, 0x57, 0x4F, 0xA6, 0x00, 0x57, 0x4F, 0x00, 0xC0, 0x76, 0x9D, 0x5B, 0x64, 0xC0, 0x7E, 0xD7,
+0x7D, 0x05, 0xC0, 0x9E, 0xDF, 0x71, 0x02, 0xC1, 0x9A, 0xD6, 0xB2, 0x94, 0xA6, 0xC0, 0x55, 0xAD,
+0x91, 0x68, 0xC0, 0x75, 0xAD, 0xBF, 0x48, 0x78, 0xC0, 0xF7, 0xBD, 0x69, 0xC2, 0xDB, 0xDE, 0xD3,
+0x9C, 0xD7, 0xBD, 0x71, 0xC1, 0x35, 0xAD, 0x10, 0x84, 0x64, 0x71, 0xC0, 0xF8, 0xC5, 0x4D, 0x78,
+0xC0, 0x9E, 0xF7, 0x00, 0x44, 0x79, 0x50, 0xAE, 0x5C, 0x69, 0x4C, 0x74, 0x60, 0x78, 0x54, 0x60,
+0xBE, 0x71, 0xC0, 0xB6, 0xB5, 0x5C, 0x7C, 0x69, 0x7D, 0x48, 0x7D, 0xA2, 0x4C, 0x71, 0x08, 0x65,
+0x74, 0x71, 0x00, 0x5D, 0x4C, 0x75, 0x58, 0x5D, 0x71, 0xC0, 0x3C, 0xEF, 0x6C, 0x71, 0xE0, 0x0A,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x66, 0xC0, 0x7D, 0xCF, 0x05, 0xBF, 0xC1, 0xDB, 0xBE, 0x31,
+0x7C, 0x63, 0x00, 0x50, 0xC0, 0x38, 0xAE, 0x63, 0xC0, 0xBF, 0xD7, 0x62, 0x6F, 0x7B, 0xC0, 0x30,
+0x7C, 0x9A, 0xC0, 0x14, 0x8D, 0x6F, 0x67, 0x63, 0x77, 0x76, 0xC2, 0x55, 0x95, 0xF0, 0x73, 0x1C,
+0xC7, 0x67, 0xC0, 0xCF, 0x6B, 0x63, 0x77, 0xC1, 0x7A, 0xB6, 0xF7, 0xA5, 0x75, 0x43, 0x5B, 0xC2,
+0xFF, 0xDF, 0x34, 0x95, 0xFC, 0xC6, 0x48, 0x4E, 0x62, 0x4E, 0xC0, 0xBA, 0xBE, 0x4C, 0x00, 0x5B,
+0x42, 0x5C, 0x4F, 0xC0, 0xDF, 0xDF, 0x4E, 0x62, 0xC0, 0xBE, 0xD7, 0x65, 0x5C, 0x62, 0x4A, 0x96,
+0xC1, 0x8E, 0x63, 0xB6, 0xA5, 0x5C, 0x57, 0x64, 0x4F, 0x63, 0xC0, 0x9A, 0xBE, 0x4C, 0x7D, 0x05,
+0xC0, 0x9E, 0xDF, 0x71, 0x02, 0x79, 0x69, 0xC2, 0x14, 0xA5, 0x39, 0xCE, 0x9A, 0xD6, 0x41, 0x48,
+0xC0, 0x18, 0xC6, 0x48, 0xC0, 0x96, 0xB5, 0x4D, 0x54, 0xC0, 0x3C, 0xE7, 0x54, 0x48, 0x71, 0xC0,
+0x1C, 0xE7, 0x50, 0x78, 0x4D, 0x48, 0xC0, 0x92, 0x94, 0x50, 0x71, 0xC0, 0x9E, 0xF7, 0x78, 0x41,
+0x78, 0x55, 0x6D, 0x69, 0x60, 0x79, 0x69, 0xC1, 0xF4, 0xA4, 0x72, 0x94, 0x60, 0xBE, 0x71, 0x78,
+0xC0, 0x92, 0x94, 0x6D, 0xC0, 0xD7, 0xBD, 0xAE, 0x48, 0xC1, 0xB6, 0xB5, 0x38, 0xCE, 0x59, 0x5D,
+0x71, 0x06, 0x6C, 0xC1, 0x34, 0xAD, 0xEF, 0x83, 0x4D, 0x71, 0x75, 0xC0, 0xB3, 0x9C, 0x90, 0x4C,
+0x51, 0x71, 0xC0, 0xB2, 0x9C, 0x6C, 0x71, 0xE0, 0x0A, 0x70, 0x00, 0x71, 0x06, 0x86, 0xC0, 0x7D,
+0xCF, 0x05, 0xBA, 0x64, 0x91, 0x4E, 0x76, 0xC0, 0xF7, 0xA5, 0x76, 0x48, 0xC0, 0xFB, 0xC6, 0x62,
+0x43, 0x76, 0x53, 0x57, 0x7E, 0x95, 0x76, 0x5E, 0x6F, 0x6A, 0x57, 0xC0, 0xCF, 0x6B, 0x64, 0x76,
+0x57, 0x76, 0x7E, 0x6F, 0x5B, 0xC1, 0x10, 0x74, 0xB6, 0xA5, 0x76, 0xC0, 0x5D, 0xCF, 0x7B, 0xC0,
+0xDB, 0xC6, 0x43, 0xC0, 0xF0, 0x73, 0x48, 0xC0, 0xCB, 0x52, 0x44, 0xC0, 0x9E, 0xD7, 0x78, 0xA5,
+0xC1, 0x34, 0x95, 0xB3, 0x8C, 0x76, 0xC0, 0x38, 0xAE, 0x67, 0x00, 0x6B, 0x58, 0x7B, 0x4E, 0xA5,
+0x4E, 0x43, 0x4A, 0x43, 0x5B, 0x00, 0x77, 0x91, 0x44, 0x4C, 0x7D, 0x05, 0xC1, 0x9E, 0xDF, 0xFF,
+0xFF, 0x02, 0xA6, 0x00, 0xC0, 0x3C, 0xE7, 0x4D, 0x71, 0xC0, 0xDB, 0xDE, 0x61, 0x5D, 0x6C, 0x5D,
+0xC0, 0xFB, 0xE6, 0x5C, 0xC0, 0x9E, 0xF7, 0x41, 0x6C, 0x71, 0x02, 0xC0, 0x7D, 0xEF, 0x71, 0x5C,
+0x49, 0x71, 0x6C, 0xC0, 0x9A, 0xD6, 0x49, 0x6C, 0x48, 0xC0, 0x31, 0x8C, 0x79, 0x5D, 0x6C, 0x00,
+0x5C, 0x75, 0x6C, 0x5D, 0x71, 0x51, 0x91, 0x49, 0x5D, 0x00, 0x6C, 0x58, 0xC0, 0xBA, 0xDE, 0x75,
+0x71, 0x09, 0xC1, 0x96, 0xB5, 0x59, 0xCE, 0x71, 0x00, 0x6C, 0xC0, 0x14, 0xA5, 0x48, 0x55, 0xC0,
+0x3C, 0xEF, 0x50, 0x71, 0xE0, 0x0B, 0x70, 0x00, 0x71, 0x06, 0x86, 0xC0, 0x7D, 0xCF, 0x05, 0x4C,
+0xC0, 0x9A, 0xB6, 0x62, 0x43, 0x6B, 0xC0, 0x71, 0x7C, 0x7E, 0x5F, 0x6B, 0x6F, 0xC0, 0xB3, 0x8C,
+0x5F, 0x43, 0xC4, 0x34, 0x95, 0x1C, 0xC7, 0xF4, 0x8C, 0xCF, 0x6B, 0x79, 0xB6, 0xAB, 0x70, 0xC0,
+0xDB, 0xBE, 0x5B, 0x6B, 0x43, 0x53, 0x6B, 0xC0, 0x5D, 0xCF, 0x76, 0x63, 0x6B, 0x7F, 0x62, 0x4A,
+0x57, 0xC0, 0x3C, 0xCF, 0x7F, 0xC0, 0xB6, 0xA5, 0x64, 0x5E, 0x64, 0xC0, 0xBE, 0xD7, 0x40, 0x5B,
+0x76, 0x50, 0x76, 0x00, 0x5F, 0x91, 0x62, 0x6F, 0x57, 0x51, 0x7F, 0x6A, 0x78, 0x57, 0x70, 0xC0,
+0x71, 0x84, 0x5B, 0x64, 0x5B, 0x78, 0x40, 0x7D, 0x05, 0xC1, 0x9E, 0xDF, 0xFF, 0xFF, 0x0E, 0x49,
+0xC0, 0x1C, 0xE7, 0x71, 0x0C, 0x75, 0xC0, 0xBA, 0xDE, 0x71, 0x07, 0x49, 0xC0, 0xDF, 0xFF, 0x71,
+0x0F, 0x74, 0xC1, 0x0C, 0x63, 0x5D, 0xEF, 0x71, 0x00, 0xC1, 0xD3, 0x9C, 0xEF, 0x83, 0x71, 0xC2,
+0x14, 0xA5, 0xB6, 0xB5, 0xF7, 0xC5, 0x71, 0xE0, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0x86,
+0xC0, 0x7D, 0xCF, 0x06, 0x4C, 0x51, 0x4C, 0x00, 0xC0, 0xDF, 0xDF, 0x51, 0xA2, 0x4C, 0x51, 0x00,
+0x4C, 0x00, 0x51, 0x78, 0x63, 0xC0, 0xB6, 0x9D, 0x4C, 0x02, 0x7D, 0xC0, 0xDB, 0xBE, 0x51, 0x60,
+0x4C, 0x40, 0x51, 0x4C, 0x01, 0x60, 0x51, 0x4C, 0x40, 0x4C, 0x51, 0x47, 0x60, 0xC0, 0x38, 0xAE,
+0x7B, 0x43, 0x51, 0x00, 0x4C, 0xAF, 0x51, 0x4C, 0x00, 0x51, 0x4C, 0x00, 0x7D, 0x4C, 0x51, 0x40,
+0x4C, 0x00, 0x60, 0x51, 0x78, 0xC0, 0xDB, 0xC6, 0x4C, 0x7D, 0x06, 0x4F, 0x71, 0x10, 0x5D, 0x49,
+0x71, 0x00, 0x61, 0xC1, 0xD7, 0xBD, 0x1C, 0xE7, 0x44, 0x71, 0x70, 0x71, 0x5D, 0x71, 0x01, 0x49,
+0x75, 0x71, 0x08, 0x5D, 0x71, 0x0F, 0xC1, 0x38, 0xC6, 0xB6, 0xB5, 0x71, 0x01, 0xC3, 0x14, 0xA5,
+0x3D, 0xEF, 0x96, 0xB5, 0xEF, 0x7B, 0x75, 0xC0, 0xFF, 0xFF, 0xE0, 0x0B, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x06, 0x96, 0xC0, 0x7D, 0xCF, 0x15, 0xBF, 0x7D, 0x02, 0x40, 0x4C, 0x7D, 0x0D, 0x40, 0x91,
+0x91, 0x64, 0x40, 0x7D, 0x0F, 0x40, 0x4C, 0x7D, 0x07, 0xC0, 0xBE, 0xE7, 0x71, 0x02, 0x79, 0xC1,
+0xDB, 0xDE, 0xDF, 0xFF, 0x65, 0x75, 0xC1, 0x79, 0xD6, 0x1C, 0xE7, 0x71, 0x70, 0xC0, 0xB6, 0xB5,
+0x79, 0x71, 0xC1, 0xF7, 0xBD, 0x59, 0xCE, 0x50, 0xC0, 0xCB, 0x5A, 0x44, 0x71, 0x50, 0xBF, 0x44,
+0xC1, 0x55, 0xAD, 0x9E, 0xF7, 0x50, 0x71, 0xC0, 0xD3, 0x9C, 0x65, 0x44, 0x65, 0xA6, 0x79, 0x70,
+0x79, 0x6C, 0x74, 0x61, 0x74, 0x75, 0x4D, 0x68, 0xC1, 0xDB, 0xDE, 0x51, 0x8C, 0x58, 0x71, 0x0C,
+0x58, 0xC1, 0xD7, 0xBD, 0x71, 0x8C, 0x79, 0x65, 0x48, 0x78, 0xC0, 0x30, 0x8C, 0x58, 0x65, 0xC0,
+0xEB, 0x62, 0x71, 0xE0, 0x0C, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0x4F, 0x85, 0xE0, 0x0A, 0x40,
+0xC0, 0xFF, 0xF7, 0x71, 0x02, 0x4C, 0x54, 0xC0, 0x39, 0xCE, 0x7C, 0x65, 0x54, 0xBE, 0x71, 0x6D,
+0xC1, 0xAB, 0x5A, 0x2C, 0x6B, 0x4C, 0xC0, 0x6D, 0x6B, 0xBA, 0x96, 0x64, 0x75, 0x71, 0x65, 0xC2,
+0x92, 0x94, 0xDB, 0xDE, 0xB6, 0xB5, 0xBF, 0x60, 0x71, 0x50, 0x79, 0xC0, 0x75, 0xB5, 0x73, 0xC0,
+0x71, 0x94, 0x74, 0x7C, 0x54, 0x4C, 0x6D, 0x75, 0xC0, 0x55, 0xAD, 0x5C, 0x6D, 0xC0, 0x34, 0xAD,
+0x7D, 0x41, 0x5D, 0x71, 0x0C, 0xA6, 0x64, 0x7D, 0x71, 0xC0, 0xDB, 0xDE, 0x61, 0x41, 0xC0, 0x9A,
+0xD6, 0x71, 0x5D, 0x4D, 0x71, 0xE0, 0x0C, 0x70, 0x00, 0x71, 0x08, 0x5A, 0x96, 0xE0, 0x08, 0xAE,
+0x71, 0x03, 0xC0, 0x5D, 0xEF, 0x58, 0x59, 0x4C, 0x74, 0xA5, 0x41, 0x79, 0x71, 0xC0, 0x92, 0x94,
+0x55, 0xC0, 0x8E, 0x73, 0x6D, 0x54, 0x91, 0xC1, 0xAE, 0x7B, 0xEF, 0x83, 0x71, 0x01, 0x4D, 0x73,
+0x4D, 0xC0, 0x6E, 0x73, 0x44, 0x71, 0x7D, 0xC1, 0xFC, 0xE6, 0x96, 0xB5, 0x5C, 0x40, 0x4C, 0x6D,
+0x65, 0x79, 0xC0, 0xF8, 0xC5, 0x61, 0x55, 0x40, 0xC0, 0x75, 0xB5, 0x48, 0x78, 0xBF, 0x71, 0xC0,
+0x9E, 0xF7, 0x71, 0x13, 0x5D, 0xBF, 0x71, 0x07, 0x6E, 0x0A, 0x71, 0x05, 0x99, 0xA6, 0x09, 0x71,
+0x09, 0xC0, 0x9E, 0xFF, 0x0A, 0x71, 0x0E, 0x70, 0x00, 0x71, 0xE0, 0x19, 0x5D, 0x55, 0xA1, 0x4D,
+0x00, 0x5D, 0x50, 0xC0, 0xF8, 0xC5, 0x71, 0x7D, 0xC0, 0xF7, 0xC5, 0x41, 0x75, 0xC0, 0xEF, 0x7B,
+0x40, 0x5C, 0xC0, 0xAE, 0x73, 0x6B, 0xC3, 0xFF, 0xFF, 0x18, 0xC6, 0x71, 0x94, 0x1C, 0xE7, 0x58,
+0x41, 0x71, 0x00, 0x79, 0x4C, 0x65, 0x7C, 0x51, 0x70, 0x51, 0x64, 0x61, 0x48, 0x75, 0x44, 0x50,
+0xC0, 0x59, 0xCE, 0x61, 0x4D, 0xC0, 0x75, 0xAD, 0x48, 0xA6, 0x71, 0x0F, 0x6C, 0xC0, 0x1C, 0xDF,
+0x48, 0x00, 0x4D, 0x45, 0x48, 0xC1, 0xDB, 0xD6, 0x7D, 0xEF, 0x71, 0x02, 0x66, 0xC0, 0x9E, 0xD7,
+0xA6, 0xA9, 0x4C, 0x00, 0x40, 0x4C, 0x00, 0x47, 0x40, 0xC0, 0xBE, 0xD7, 0x47, 0x99, 0x40, 0x4F,
+0x71, 0x02, 0xC1, 0x99, 0xD7, 0x76, 0xC7, 0x92, 0xBE, 0x01, 0xA6, 0x44, 0x04, 0xC0, 0x78, 0xD7,
+0x62, 0x71, 0x05, 0xC2, 0x9E, 0xFF, 0xF8, 0xFD, 0x76, 0xFD, 0xAE, 0x4E, 0x04, 0x53, 0xA5, 0x53,
+0x4E, 0xC1, 0xD7, 0xFD, 0x7D, 0xFF, 0x71, 0x0C, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x57, 0xC0,
+0x1C, 0xE7, 0x45, 0xC2, 0x30, 0x84, 0x0C, 0x63, 0xF7, 0xBD, 0x50, 0x70, 0xC0, 0xCF, 0x73, 0x4D,
+0x6C, 0x71, 0x00, 0x6E, 0x4C, 0xC1, 0xDB, 0xBE, 0xCF, 0x6B, 0x00, 0xC1, 0xFB, 0xC6, 0x31, 0x7C,
+0x50, 0xC1, 0xD7, 0xA5, 0x14, 0x8D, 0x5E, 0xC2, 0x6D, 0x63, 0xB2, 0x84, 0x5D, 0xCF, 0x40, 0x7D,
+0x78, 0x57, 0x71, 0x00, 0xC6, 0x9A, 0xDF, 0x55, 0xBF, 0xEF, 0x84, 0x4A, 0x5B, 0xD2, 0x9D, 0x15,
+0xBF, 0xCC, 0x6B, 0x00, 0xC1, 0x50, 0x95, 0x12, 0xA6, 0x91, 0xC4, 0x71, 0x95, 0x2D, 0x74, 0xAB,
+0x6B, 0xD4, 0xB6, 0x98, 0xD7, 0x71, 0x05, 0xC4, 0x18, 0xFE, 0x92, 0xDC, 0x8A, 0x72, 0x8E, 0x9B,
+0x92, 0xD4, 0x96, 0xA9, 0xC2, 0x10, 0xBC, 0xD3, 0xE4, 0x8E, 0xA3, 0x91, 0x53, 0xC2, 0x2C, 0x8B,
+0xB3, 0xDC, 0x55, 0xFD, 0x64, 0x6C, 0xAE, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x57, 0x59,
+0x91, 0x79, 0xC1, 0x34, 0xA5, 0x71, 0x8C, 0x4D, 0xC1, 0x75, 0xAD, 0xEF, 0x7B, 0x4D, 0xC1, 0x7D,
+0xEF, 0xFF, 0xFF, 0x00, 0x86, 0xC1, 0xBE, 0xD7, 0x92, 0x84, 0x7E, 0x50, 0xC4, 0x1C, 0xC7, 0xCB,
+0x52, 0xF7, 0xAD, 0xB2, 0x84, 0x10, 0x74, 0x76, 0xC0, 0x59, 0xB6, 0x67, 0x63, 0x51, 0x7D, 0x00,
+0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x78, 0xCF, 0x5C, 0xC1, 0x0C, 0x74, 0x35, 0xBF, 0x7C, 0xC4,
+0xAE, 0x84, 0x50, 0x95, 0xF5, 0xBE, 0x30, 0x8D, 0x6E, 0x7C, 0x91, 0x5C, 0x00, 0xC3, 0xEF, 0x84,
+0x70, 0x95, 0x97, 0xCF, 0xFE, 0xFF, 0x71, 0x03, 0xA1, 0x53, 0xC1, 0x51, 0xC4, 0xCF, 0xAB, 0x95,
+0x7E, 0xBE, 0x92, 0x80, 0x69, 0xC5, 0x4D, 0x93, 0x49, 0x62, 0x35, 0xED, 0x28, 0x5A, 0x92, 0xCC,
+0x96, 0xFD, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x08, 0xC1, 0x9D,
+0xF7, 0x3C, 0xEF, 0xE0, 0x08, 0xC0, 0x7D, 0xF7, 0x71, 0x03, 0x6C, 0xC0, 0xD3, 0x9C, 0x00, 0x4D,
+0x71, 0x08, 0xC0, 0x79, 0xCE, 0x6C, 0x71, 0x6C, 0x71, 0x05, 0x65, 0xC0, 0x1C, 0xE7, 0x71, 0x0E,
+0x48, 0xC2, 0x9E, 0xF7, 0xD7, 0xBD, 0xBE, 0xF7, 0x71, 0x6C, 0x71, 0x0B, 0xC0, 0xDB, 0xD6, 0x4D,
+0xC2, 0x18, 0xC6, 0x4D, 0x6B, 0x55, 0xAD, 0x61, 0x55, 0xC0, 0xD3, 0x94, 0x4D, 0x49, 0x71, 0x00,
+0x66, 0xC3, 0x5D, 0xCF, 0x71, 0x7C, 0x3C, 0xCF, 0x9E, 0xD7, 0xA6, 0xC0, 0xEF, 0x73, 0x76, 0xC0,
+0x72, 0x84, 0x76, 0x7B, 0xC1, 0xFB, 0xC6, 0x9A, 0xBE, 0x67, 0x4C, 0x95, 0x00, 0xC0, 0x9E, 0xDF,
+0x71, 0x00, 0x5A, 0x75, 0xC1, 0xAB, 0x63, 0xAE, 0x7C, 0x75, 0xC6, 0x6D, 0x7C, 0xD5, 0xB6, 0xB7,
+0xCF, 0x12, 0xA6, 0x07, 0x3A, 0x73, 0xAE, 0x76, 0xC7, 0x5D, 0x5C, 0xC2, 0xD1, 0x9D, 0x77, 0xCF,
+0xFE, 0xF7, 0x71, 0x03, 0xA1, 0xC2, 0x96, 0xFD, 0x51, 0xCC, 0x8E, 0xA3, 0x81, 0x6C, 0x6F, 0x7E,
+0x6F, 0x00, 0x46, 0xC2, 0xEC, 0x82, 0xF0, 0xB3, 0xCB, 0x7A, 0x40, 0xC0, 0x96, 0xFD, 0xA5, 0xC0,
+0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x07, 0xC1, 0xDA, 0xE6, 0xD5, 0xCD, 0xA5,
+0xE0, 0x09, 0xC1, 0x78, 0xDE, 0xDF, 0xFF, 0x71, 0x01, 0xC2, 0x9E, 0xF7, 0xF4, 0xA4, 0x5D, 0xEF,
+0x41, 0xC0, 0x18, 0xC6, 0x7C, 0xC0, 0x1C, 0xE7, 0x71, 0xC1, 0x79, 0xCE, 0x92, 0x94, 0x74, 0xC0,
+0x9A, 0xD6, 0x7C, 0xC1, 0xBA, 0xD6, 0xEF, 0x83, 0x4D, 0x71, 0xC0, 0xF7, 0xBD, 0x91, 0xC2, 0x3C,
+0xE7, 0xB3, 0x9C, 0x96, 0xB5, 0x4D, 0x68, 0x60, 0x00, 0x51, 0x70, 0x79, 0xC3, 0xBE, 0xF7, 0xDB,
+0xDE, 0xB2, 0x9C, 0x14, 0xA5, 0x00, 0xC0, 0x1C, 0xE7, 0x5F, 0x78, 0x61, 0x7C, 0xC0, 0x75, 0xAD,
+0x64, 0xC0, 0x7D, 0xEF, 0x71, 0xC1, 0x30, 0x8C, 0xF7, 0xC5, 0x77, 0x99, 0x70, 0x65, 0x78, 0xC0,
+0xD7, 0xBD, 0x6D, 0xC0, 0x79, 0xD6, 0x71, 0x07, 0x59, 0x4D, 0xC4, 0x59, 0xCE, 0x30, 0x84, 0xD3,
+0x94, 0x1C, 0xDF, 0x51, 0x8C, 0x7D, 0x4D, 0x49, 0x71, 0x00, 0x66, 0xC3, 0x5D, 0xCF, 0x71, 0x7C,
+0x3C, 0xCF, 0x9E, 0xD7, 0x95, 0xC0, 0x72, 0x84, 0x80, 0xBB, 0xC0, 0x34, 0x95, 0x7B, 0xC2, 0xFB,
+0xC6, 0x9A, 0xBE, 0xB2, 0x84, 0x4C, 0x7D, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x5A, 0x94, 0xC2,
+0xD4, 0xB6, 0xEC, 0x6B, 0x8E, 0x7C, 0xAE, 0x5C, 0xC7, 0x97, 0xCF, 0x12, 0xA6, 0x68, 0x42, 0xD2,
+0x9D, 0xB7, 0xCF, 0x94, 0xAE, 0x2D, 0x74, 0x35, 0xBF, 0x44, 0xC0, 0xFE, 0xF7, 0x71, 0x03, 0xA1,
+0xC2, 0x96, 0xFD, 0x71, 0xCC, 0x49, 0x62, 0x7E, 0x47, 0xC1, 0x4D, 0x93, 0xAE, 0xA3, 0x7E, 0xC1,
+0x2D, 0x93, 0x51, 0xC4, 0x53, 0xC0, 0xEC, 0x82, 0x53, 0x40, 0xC0, 0x96, 0xFD, 0x47, 0xC1, 0x7D,
+0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC1, 0x9D, 0xF7, 0xB5, 0xCD, 0xA9,
+0xAF, 0x04, 0xBE, 0xC0, 0x94, 0xC5, 0x44, 0x02, 0x4C, 0x7F, 0x44, 0x0C, 0x4C, 0x44, 0x2B, 0x7F,
+0xA5, 0xC0, 0xFA, 0xE6, 0x71, 0x01, 0xC0, 0x9E, 0xF7, 0x64, 0x71, 0xC0, 0xD3, 0x9C, 0x41, 0x4D,
+0xC0, 0x96, 0xB5, 0x71, 0xC1, 0xB6, 0xB5, 0x18, 0xC6, 0x64, 0xBE, 0x4D, 0x64, 0x78, 0x71, 0xA6,
+0x7D, 0x45, 0xC0, 0xF7, 0xBD, 0xA6, 0x65, 0xC0, 0xF3, 0xA4, 0x74, 0x4C, 0xC2, 0x75, 0xAD, 0x79,
+0xCE, 0x34, 0xAD, 0x69, 0x71, 0x65, 0x51, 0x55, 0x74, 0x7C, 0x74, 0x4C, 0x78, 0x64, 0xC0, 0x71,
+0x94, 0x68, 0x79, 0x71, 0x78, 0xC0, 0x7D, 0xEF, 0x69, 0x65, 0x51, 0x00, 0xC0, 0x30, 0x8C, 0x54,
+0x74, 0x78, 0x71, 0x07, 0x59, 0x79, 0xAF, 0x7D, 0xC0, 0x30, 0x84, 0x4D, 0xC2, 0xEF, 0x7B, 0x59,
+0xC6, 0x9A, 0xCE, 0x49, 0xC0, 0xFF, 0xFF, 0x00, 0x82, 0xC3, 0xBE, 0xD7, 0x72, 0x84, 0x18, 0xAE,
+0x1C, 0xC7, 0xA5, 0x62, 0xC0, 0x55, 0x95, 0x00, 0x91, 0x76, 0xC0, 0x9A, 0xBE, 0x7B, 0x5B, 0x51,
+0x91, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x5A, 0xC0, 0x15, 0xBF, 0x00, 0xC5, 0xB4, 0xB6, 0x4D,
+0x7C, 0xCF, 0x84, 0xB1, 0x9D, 0x56, 0xC7, 0x50, 0x95, 0x57, 0x5E, 0xC0, 0xB4, 0xB6, 0x6A, 0xC0,
+0xD2, 0x9D, 0x44, 0x00, 0x67, 0x71, 0x03, 0xA1, 0x53, 0xC0, 0x51, 0xC4, 0x46, 0xC0, 0xD7, 0xFD,
+0x53, 0xC0, 0x2C, 0x8B, 0xBF, 0xC2, 0xF0, 0xB3, 0xEB, 0x82, 0x51, 0xCC, 0x7E, 0x00, 0x6F, 0xC1,
+0x72, 0xCC, 0x96, 0xFD, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06,
+0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0xA6, 0xC1, 0xEE, 0x8B, 0x94, 0xC5, 0x00, 0xC0, 0xEE, 0x8B,
+0x78, 0xC3, 0x8D, 0x83, 0xCA, 0x62, 0xCE, 0x8B, 0xF2, 0xB4, 0x58, 0xBF, 0xC1, 0x70, 0x9C, 0xF5,
+0xD5, 0x44, 0x00, 0xC1, 0x0E, 0x8C, 0x53, 0xBD, 0x44, 0x70, 0xC0, 0x94, 0xC5, 0x4C, 0xAF, 0x44,
+0x00, 0x4C, 0xAE, 0xC1, 0xB4, 0xC5, 0xB1, 0xA4, 0x4C, 0x44, 0x2B, 0x78, 0xC0, 0x98, 0xDE, 0x71,
+0x01, 0x91, 0xC1, 0x71, 0x8C, 0xB6, 0xBD, 0x50, 0xC0, 0x75, 0xB5, 0x96, 0xC0, 0x18, 0xC6, 0x71,
+0xC2, 0xF7, 0xBD, 0x9A, 0xD6, 0x96, 0xB5, 0x6C, 0x64, 0x51, 0xC1, 0x34, 0xAD, 0x3C, 0xE7, 0xBF,
+0x41, 0x59, 0x51, 0x7C, 0x6C, 0x9A, 0x50, 0x6C, 0x78, 0x75, 0x41, 0x64, 0x71, 0xC0, 0x39, 0xC6,
+0x74, 0xC1, 0xB6, 0xB5, 0xBA, 0xD6, 0x55, 0x69, 0x58, 0x51, 0x60, 0x50, 0x60, 0xC0, 0x9E, 0xF7,
+0x71, 0x69, 0x79, 0x78, 0x48, 0x64, 0x55, 0xC0, 0x71, 0x94, 0x00, 0xC0, 0xDB, 0xDE, 0x78, 0x71,
+0x07, 0xC0, 0xDB, 0xD6, 0x79, 0xC1, 0xEF, 0x7B, 0x0C, 0x63, 0x7D, 0x65, 0x68, 0x4D, 0x45, 0x49,
+0xC0, 0xFF, 0xFF, 0x00, 0x61, 0xC4, 0x9E, 0xD7, 0xBA, 0xBE, 0x8E, 0x6B, 0xCF, 0x6B, 0x9A, 0xBE,
+0x4A, 0x4C, 0xC1, 0x1C, 0xC7, 0x75, 0x9D, 0x4A, 0xC3, 0x2D, 0x5B, 0x51, 0x7C, 0x3D, 0xCF, 0x7E,
+0xD7, 0x99, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC1, 0x99, 0xD7, 0x15, 0xB7, 0x6A, 0xC6, 0x4B,
+0x5B, 0xD2, 0x9D, 0xD5, 0xB6, 0x8B, 0x63, 0xCC, 0x6B, 0x10, 0x8D, 0xF2, 0xA5, 0xAE, 0xC1, 0xAE,
+0x7C, 0x4A, 0x5B, 0x7D, 0x6A, 0xC0, 0x98, 0xCF, 0x71, 0x04, 0xA1, 0x53, 0xC1, 0x92, 0xD4, 0x30,
+0xBC, 0x53, 0x00, 0x46, 0x00, 0xC4, 0x92, 0xCC, 0x8E, 0xA3, 0xB3, 0xD4, 0x51, 0xC4, 0xD7, 0xFD,
+0x5A, 0xC1, 0xB2, 0xD4, 0x76, 0xFD, 0xA9, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0xA6, 0x67, 0xC0, 0x74, 0xC5, 0xAE, 0xC3, 0x2B,
+0x73, 0xB1, 0xA4, 0x0B, 0x6B, 0xF5, 0xD5, 0x6B, 0xC0, 0x50, 0x9C, 0x57, 0xC2, 0x53, 0xBD, 0xAA,
+0x62, 0xB4, 0xC5, 0x44, 0xBA, 0x74, 0x5C, 0xC0, 0xF6, 0xD5, 0x6C, 0x70, 0xC2, 0x12, 0xB5, 0xCE,
+0x83, 0x73, 0xBD, 0x44, 0xC0, 0x2F, 0x94, 0x00, 0xC3, 0xF2, 0xAC, 0x49, 0x52, 0x70, 0x9C, 0xD5,
+0xCD, 0x2B, 0x78, 0xC0, 0x98, 0xDE, 0x71, 0x02, 0xC0, 0x38, 0xCE, 0x91, 0xC1, 0xDF, 0xFF, 0x5D,
+0xEF, 0x54, 0x6C, 0x71, 0x49, 0xBF, 0x49, 0x44, 0xC0, 0xF7, 0xBD, 0x6C, 0xC0, 0xFB, 0xDE, 0x00,
+0x71, 0xC0, 0x59, 0xCE, 0xAE, 0xC1, 0xDB, 0xDE, 0x92, 0x94, 0x4D, 0x79, 0x7C, 0xC0, 0x1C, 0xE7,
+0x49, 0xC0, 0xBE, 0xF7, 0x50, 0x61, 0x71, 0x49, 0x58, 0x44, 0x58, 0x00, 0x79, 0x4D, 0x5D, 0x58,
+0x70, 0xC0, 0xD7, 0xBD, 0x58, 0x71, 0xC0, 0x3C, 0xE7, 0x4D, 0x44, 0x58, 0x49, 0xC0, 0x79, 0xD6,
+0x74, 0x70, 0x5D, 0x44, 0x71, 0x07, 0x59, 0x91, 0x74, 0x00, 0x4D, 0x45, 0x4D, 0x45, 0x00, 0x49,
+0x71, 0x00, 0x82, 0xC0, 0x7D, 0xCF, 0xBF, 0x73, 0xA9, 0x4C, 0xA6, 0x7D, 0xBA, 0x47, 0x40, 0x96,
+0x4C, 0x47, 0x7D, 0x01, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x94, 0xC0, 0x57, 0xC7, 0x90, 0x95, 0xC0,
+0x56, 0xC7, 0x00, 0x70, 0x61, 0x44, 0x99, 0x44, 0x95, 0x00, 0x70, 0xAF, 0xC0, 0xBC, 0xEF, 0x71,
+0x04, 0x60, 0x4E, 0xA9, 0x02, 0x4E, 0x00, 0x47, 0x4E, 0x47, 0x03, 0xA6, 0x47, 0xC0, 0x7D, 0xFF,
+0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0x7F, 0xC0,
+0x0B, 0x6B, 0x6B, 0xAE, 0xC0, 0x2C, 0x73, 0x48, 0xC1, 0x69, 0x5A, 0xEE, 0x8B, 0x44, 0xC2, 0x90,
+0xA4, 0xAA, 0x62, 0x8D, 0x7B, 0x91, 0x44, 0x00, 0xBE, 0x6C, 0x40, 0xC2, 0xCE, 0x83, 0xAA, 0x5A,
+0x33, 0xBD, 0x67, 0xC0, 0xAD, 0x83, 0x91, 0xC0, 0x2F, 0x94, 0x48, 0xC0, 0xB1, 0xA4, 0xBE, 0xC0,
+0x89, 0x5A, 0x60, 0xC0, 0xD5, 0xCD, 0x2B, 0x78, 0xC0, 0x98, 0xDE, 0x71, 0x14, 0x58, 0xC0, 0x3C,
+0xE7, 0x71, 0xC0, 0x5D, 0xEF, 0x58, 0x71, 0x00, 0x5D, 0xC0, 0x59, 0xCE, 0x71, 0x20, 0x59, 0x45,
+0x59, 0xBE, 0x45, 0xBA, 0xC0, 0xDB, 0xDE, 0x4D, 0x45, 0x49, 0x71, 0x00, 0x82, 0xC2, 0x5D, 0xCF,
+0x9E, 0xD7, 0xDF, 0xDF, 0x4C, 0x95, 0xBA, 0x4C, 0x00, 0xAF, 0xBA, 0x4C, 0x00, 0x60, 0xC0, 0x7E,
+0xD7, 0x7D, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x01, 0x95, 0xC0, 0x7B, 0xDF, 0x9A, 0xA1, 0xAE, 0x02,
+0x72, 0x66, 0x00, 0xBE, 0xC1, 0xBB, 0xE7, 0xDD, 0xF7, 0x71, 0x05, 0xA1, 0x4E, 0xA9, 0xAF, 0x4E,
+0x47, 0x4E, 0x01, 0x47, 0x53, 0x00, 0x47, 0x53, 0x47, 0xA6, 0x47, 0xC0, 0x7D, 0xFF, 0x71, 0x0B,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0xA6, 0xC0, 0x0B, 0x6B,
+0x6B, 0xAE, 0xC0, 0x2B, 0x6B, 0x44, 0xC0, 0x12, 0xB5, 0x6C, 0x67, 0xC4, 0x50, 0x9C, 0xEB, 0x62,
+0x0E, 0x8C, 0x2B, 0x73, 0xB4, 0xC5, 0x44, 0xBE, 0x6C, 0xC6, 0x8D, 0x83, 0x0F, 0x94, 0xCA, 0x62,
+0x4F, 0x9C, 0xAD, 0x83, 0x57, 0xE6, 0x4C, 0x73, 0x7F, 0xC1, 0xEA, 0x62, 0xB1, 0xA4, 0x6B, 0xC1,
+0x6D, 0x7B, 0xF5, 0xD5, 0x44, 0x2B, 0x78, 0xC1, 0x98, 0xDE, 0xFF, 0xFF, 0x02, 0x4D, 0xC0, 0xFB,
+0xDE, 0x71, 0x00, 0xC1, 0x1C, 0xE7, 0x9A, 0xD6, 0x71, 0x05, 0xC0, 0x9E, 0xF7, 0x49, 0x71, 0x15,
+0x49, 0x58, 0x71, 0x13, 0x59, 0x4D, 0xC1, 0x34, 0xA5, 0xB3, 0x94, 0x45, 0x79, 0xC0, 0xB2, 0x94,
+0x51, 0x48, 0x49, 0x71, 0x00, 0x82, 0xC4, 0x9E, 0xCF, 0x79, 0xB6, 0x35, 0x95, 0x9A, 0xBE, 0x9E,
+0xD7, 0x91, 0xC0, 0x7A, 0xB6, 0xAE, 0xC0, 0x55, 0x95, 0x00, 0xC0, 0x59, 0xB6, 0x95, 0xC2, 0x34,
+0x95, 0x3C, 0xCF, 0x7E, 0xD7, 0x99, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xA6, 0xC1, 0x5E, 0xE7, 0x5B,
+0xC6, 0x91, 0xC1, 0x1E, 0xDF, 0x9C, 0xD6, 0x7B, 0x91, 0xA5, 0xC1, 0xF9, 0xBD, 0x3A, 0xC6, 0x7B,
+0xBE, 0x6C, 0x71, 0x06, 0x60, 0x4E, 0x80, 0xC1, 0xF0, 0xB3, 0xB2, 0xD4, 0x70, 0xA6, 0x00, 0x95,
+0xC0, 0x35, 0xF5, 0x45, 0x00, 0xC1, 0x96, 0xFD, 0x92, 0xD4, 0x70, 0xC0, 0x75, 0xFD, 0x00, 0xC0,
+0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0x44,
+0x00, 0xC1, 0xEB, 0x6A, 0x53, 0xBD, 0xAE, 0xC0, 0x0B, 0x6B, 0x78, 0xC1, 0xF5, 0xD5, 0x56, 0xDE,
+0x6C, 0xC4, 0xAD, 0x83, 0x0E, 0x8C, 0x57, 0xDE, 0xCA, 0x62, 0x32, 0xB5, 0x44, 0xBA, 0xC1, 0x2C,
+0x73, 0x53, 0xBD, 0x4C, 0xC1, 0x4C, 0x73, 0x70, 0x9C, 0x54, 0xC2, 0x16, 0xD6, 0x0B, 0x6B, 0x74,
+0xC5, 0x61, 0xC2, 0xCA, 0x62, 0x50, 0x9C, 0x6C, 0x7B, 0x44, 0x2C, 0x78, 0xC0, 0x98, 0xDE, 0x71,
+0x02, 0xC0, 0x59, 0xCE, 0x6D, 0xC0, 0x3C, 0xE7, 0x71, 0xC0, 0xBA, 0xD6, 0x41, 0x74, 0x71, 0xC0,
+0x7D, 0xF7, 0x71, 0xC0, 0x9E, 0xF7, 0xAE, 0xC0, 0xDB, 0xDE, 0x74, 0xC3, 0xD7, 0xBD, 0x14, 0xA5,
+0x7D, 0xF7, 0xFB, 0xDE, 0x75, 0x71, 0x41, 0x75, 0xC0, 0x7D, 0xEF, 0x5C, 0x71, 0x00, 0x49, 0xC1,
+0xBB, 0xDE, 0xDF, 0xFF, 0x57, 0xC0, 0x5D, 0xEF, 0x58, 0x71, 0x49, 0x71, 0x6C, 0x5C, 0xC0, 0x3D,
+0xEF, 0x95, 0x5C, 0x4D, 0x58, 0x71, 0x11, 0x59, 0xA1, 0x41, 0xC0, 0x8E, 0x73, 0x50, 0x6D, 0xC0,
+0xCF, 0x7B, 0xAE, 0xC0, 0x9A, 0xCE, 0x49, 0xC0, 0xFF, 0xFF, 0x00, 0x82, 0xC1, 0xBF, 0xD7, 0x51,
+0x7C, 0xA6, 0xCB, 0xAE, 0x6B, 0x9A, 0xBE, 0xDB, 0xBE, 0x0C, 0x5B, 0xF7, 0xAD, 0xCF, 0x6B, 0x4D,
+0x63, 0x38, 0xAE, 0xD7, 0xA5, 0x30, 0x7C, 0xF4, 0x8C, 0xBE, 0xD7, 0x91, 0xC0, 0x9E, 0xDF, 0x71,
+0x00, 0xC5, 0x7E, 0xEF, 0x1E, 0xDF, 0xF5, 0x9C, 0x35, 0xA5, 0xD8, 0xB5, 0x19, 0xBE, 0x00, 0xC0,
+0xB8, 0xB5, 0x64, 0xC0, 0x15, 0x9D, 0x73, 0x7B, 0x00, 0xC0, 0x5E, 0xE7, 0x71, 0x06, 0x60, 0xC4,
+0x96, 0xFD, 0x71, 0xCC, 0xAA, 0x72, 0x0C, 0x8B, 0x10, 0xBC, 0x9A, 0x7E, 0xC3, 0x6E, 0x9B, 0x92,
+0xCC, 0x0C, 0x83, 0x69, 0x6A, 0x53, 0xC0, 0x28, 0x5A, 0x7D, 0x53, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF,
+0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC0, 0x1B, 0xEF, 0x78, 0xAF, 0xBE, 0xC1, 0x4F,
+0x94, 0xCA, 0x62, 0x00, 0xC1, 0x50, 0x9C, 0x53, 0xBD, 0x67, 0xC3, 0x2B, 0x73, 0x6C, 0x7B, 0x90,
+0xA4, 0x69, 0x52, 0x67, 0x40, 0x44, 0x00, 0xBA, 0x48, 0xC0, 0x32, 0xB5, 0x44, 0x40, 0xC1, 0x73,
+0xBD, 0x2C, 0x73, 0x58, 0x68, 0xC0, 0xB1, 0xA4, 0x48, 0x81, 0x4D, 0x40, 0xC0, 0x8D, 0x7B, 0x44,
+0x2B, 0x78, 0xC1, 0x98, 0xDE, 0xFF, 0xFF, 0x02, 0xC2, 0xFB, 0xE6, 0x51, 0x8C, 0x7D, 0xEF, 0x71,
+0xC2, 0x9E, 0xF7, 0x71, 0x94, 0xBA, 0xD6, 0x71, 0xC2, 0xB6, 0xB5, 0x9A, 0xD6, 0xD7, 0xBD, 0x7D,
+0xC3, 0x14, 0xA5, 0xB3, 0x9C, 0x18, 0xC6, 0x92, 0x94, 0x79, 0xC1, 0x71, 0x8C, 0xDB, 0xDE, 0x71,
+0x54, 0x48, 0xC1, 0x55, 0xAD, 0xD3, 0x9C, 0x5C, 0x71, 0x5C, 0xC0, 0xB2, 0x94, 0x7C, 0x70, 0x64,
+0x4C, 0x79, 0x7D, 0x71, 0x4D, 0x59, 0x64, 0xC0, 0x39, 0xCE, 0x68, 0x7C, 0xC0, 0x75, 0xAD, 0x71,
+0x11, 0xC0, 0xDB, 0xD6, 0x91, 0x59, 0xC0, 0xF3, 0x9C, 0xAF, 0x6D, 0xC0, 0x34, 0xA5, 0x54, 0x79,
+0x49, 0x71, 0x00, 0x82, 0x51, 0xC2, 0xB2, 0x84, 0x3C, 0xCF, 0x18, 0xAE, 0x4A, 0x57, 0x5A, 0xC0,
+0x9A, 0xB6, 0xA5, 0xC1, 0x75, 0x9D, 0xFF, 0xDF, 0x51, 0x57, 0xC1, 0x14, 0x8D, 0x9E, 0xD7, 0x95,
+0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x5E, 0xE7, 0x92, 0xC0, 0x77, 0xAD, 0x5B, 0x77, 0x7B, 0xC3,
+0xD4, 0x94, 0xD8, 0xB5, 0x9B, 0xCE, 0x15, 0x9D, 0x5B, 0xC0, 0x3E, 0xE7, 0x7B, 0x43, 0x71, 0x06,
+0xA1, 0xC1, 0x96, 0xFD, 0x51, 0xC4, 0x00, 0xC0, 0xF0, 0xB3, 0x00, 0x7E, 0x00, 0x81, 0x4D, 0x80,
+0xC2, 0xAA, 0x72, 0x92, 0xD4, 0x8A, 0x6A, 0x40, 0x53, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC0, 0x1B, 0xEF, 0x78, 0x44, 0x00, 0xBA, 0xC0, 0x12, 0xB5, 0x00,
+0xC0, 0xF5, 0xD5, 0x44, 0xC0, 0x33, 0xBD, 0x81, 0xC0, 0xB5, 0xCD, 0x44, 0xC0, 0x53, 0xBD, 0x57,
+0x44, 0x02, 0x91, 0x7F, 0x44, 0x70, 0x44, 0x70, 0x40, 0x44, 0x95, 0xC0, 0xD1, 0xAC, 0x5C, 0x4C,
+0x75, 0x5C, 0x44, 0x2B, 0x78, 0xC0, 0x98, 0xDE, 0x71, 0x02, 0xA6, 0xC1, 0x14, 0xA5, 0xDB, 0xDE,
+0x71, 0x00, 0xC0, 0xD7, 0xBD, 0xAE, 0x71, 0x79, 0xC0, 0x51, 0x8C, 0x79, 0xC3, 0xB6, 0xB5, 0x3C,
+0xE7, 0xEF, 0x83, 0x59, 0xCE, 0x4C, 0x71, 0xC0, 0x75, 0xAD, 0xBF, 0x71, 0x78, 0x75, 0x4C, 0xC1,
+0x9A, 0xD6, 0x38, 0xC6, 0x71, 0x4C, 0xC2, 0xD3, 0x9C, 0xCF, 0x7B, 0xBA, 0xDE, 0x4C, 0x48, 0xC0,
+0x30, 0x84, 0x48, 0x71, 0x48, 0x65, 0xBA, 0x69, 0xC2, 0x72, 0x94, 0xFB, 0xDE, 0x75, 0xB5, 0x71,
+0x11, 0xC0, 0xDB, 0xD6, 0xA5, 0x4C, 0xC0, 0xAA, 0x5A, 0x78, 0x64, 0xC1, 0x69, 0x52, 0x31, 0x84,
+0x4D, 0x49, 0x71, 0x00, 0x82, 0xC2, 0xBE, 0xD7, 0xB2, 0x84, 0xDB, 0xBE, 0xA1, 0xC1, 0xF3, 0x8C,
+0x34, 0x95, 0xAF, 0xBE, 0xC0, 0x39, 0xAE, 0x4F, 0xC3, 0xDF, 0xDF, 0xFB, 0xC6, 0x2C, 0x5B, 0x96,
+0x9D, 0x51, 0x91, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x5E, 0xE7, 0x96, 0xC4, 0xD4, 0x9C, 0x72,
+0x8C, 0x19, 0xBE, 0x7F, 0xE7, 0xD4, 0x94, 0x73, 0xC0, 0x1D, 0xDF, 0x4B, 0xC2, 0x15, 0x9D, 0xFD,
+0xD6, 0x3E, 0xDF, 0xBA, 0x71, 0x06, 0xA1, 0x53, 0xC3, 0x71, 0xCC, 0x49, 0x62, 0xEB, 0x82, 0xF4,
+0xE4, 0x62, 0x7E, 0xA6, 0xC6, 0x4D, 0x93, 0x30, 0xBC, 0x2C, 0x8B, 0x6D, 0x9B, 0x0C, 0x8B, 0x92,
+0xD4, 0x96, 0xFD, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06,
+0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0x01, 0xBA, 0x00, 0x44, 0x01, 0xBE, 0x44, 0x0C, 0x4C, 0x44,
+0x00, 0x4C, 0x44, 0x2F, 0x78, 0xC0, 0x98, 0xDE, 0x71, 0x01, 0x5D, 0x69, 0xC5, 0xD3, 0x9C, 0xFB,
+0xDE, 0x79, 0xCE, 0x18, 0xC6, 0x92, 0x94, 0xBA, 0xDE, 0x71, 0xC3, 0x9E, 0xF7, 0x10, 0x84, 0xDF,
+0xFF, 0xF7, 0xBD, 0x6D, 0xC0, 0x55, 0xAD, 0x5C, 0x64, 0xC0, 0x59, 0xCE, 0x64, 0x00, 0x71, 0xC0,
+0x75, 0xB5, 0x65, 0x69, 0x6D, 0xC0, 0x5D, 0xEF, 0x71, 0xC0, 0x96, 0xB5, 0x6D, 0x00, 0x5C, 0xC0,
+0xF7, 0xC5, 0x5D, 0x40, 0x58, 0x71, 0x4D, 0xC0, 0xEF, 0x7B, 0x64, 0xC1, 0x79, 0xD6, 0x14, 0xA5,
+0x61, 0x60, 0x51, 0x44, 0xC0, 0xFF, 0xFF, 0x0F, 0x59, 0x91, 0x61, 0x51, 0xC0, 0x51, 0x8C, 0x00,
+0x65, 0x40, 0x65, 0x49, 0x71, 0x00, 0x82, 0xC0, 0xBE, 0xD7, 0x67, 0xC1, 0x3C, 0xCF, 0x38, 0xAE,
+0x76, 0xC0, 0x8E, 0x6B, 0x72, 0xC0, 0xEF, 0x73, 0x5C, 0xC0, 0x55, 0x95, 0x51, 0xBF, 0xC2, 0x1C,
+0xC7, 0x71, 0x84, 0x9E, 0xD7, 0x95, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x48, 0x92, 0xC1, 0x56, 0xA5,
+0x19, 0xBE, 0x91, 0xC1, 0xDC, 0xD6, 0xF5, 0x9C, 0x4B, 0xC1, 0x5F, 0xE7, 0x9F, 0xEF, 0x4B, 0xC1,
+0x7B, 0xCE, 0x3E, 0xDF, 0x43, 0x71, 0x06, 0xA1, 0x53, 0xC5, 0x51, 0xCC, 0x4D, 0x93, 0x55, 0xF5,
+0x96, 0xFD, 0x4D, 0x93, 0x8E, 0x9B, 0x46, 0xC1, 0x0C, 0x8B, 0x51, 0xC4, 0x6A, 0xC0, 0xEC, 0x82,
+0x67, 0xC1, 0x92, 0xCC, 0x96, 0xFD, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0x70, 0x00, 0x71, 0x06,
+0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0xE0, 0x0A, 0x78, 0xC0, 0x98, 0xDE, 0x71, 0x02, 0x49, 0x5D,
+0x71, 0x00, 0x58, 0x00, 0x71, 0x04, 0x58, 0x71, 0x01, 0x5D, 0x49, 0x71, 0x01, 0xA6, 0x71, 0x5D,
+0x71, 0x00, 0x6C, 0x58, 0x71, 0x01, 0xC1, 0xDB, 0xDE, 0x75, 0xB5, 0x71, 0x00, 0x5C, 0xC0, 0xF7,
+0xBD, 0x71, 0x03, 0x5C, 0x5D, 0x71, 0x0F, 0x59, 0x79, 0xC1, 0xD3, 0x9C, 0xCF, 0x7B, 0x41, 0xC1,
+0x92, 0x94, 0xF0, 0x7B, 0x6C, 0x79, 0x49, 0x71, 0x00, 0x61, 0xC0, 0xDF, 0xD7, 0x4E, 0xA6, 0x66,
+0x5B, 0x76, 0xC2, 0x7D, 0xD7, 0xB2, 0x84, 0x34, 0x95, 0xAB, 0xC0, 0xBF, 0xD7, 0x6F, 0xC0, 0x71,
+0x7C, 0x76, 0xC0, 0xBE, 0xD7, 0x91, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x48, 0x7B, 0xC0, 0x56, 0xA5,
+0x7B, 0xC0, 0x76, 0xAD, 0x68, 0xC2, 0x9B, 0xCE, 0x97, 0xAD, 0x1A, 0xBE, 0x4B, 0xC2, 0x15, 0x9D,
+0xFD, 0xD6, 0x3E, 0xDF, 0x43, 0x71, 0x06, 0x60, 0xC0, 0x96, 0xFD, 0x69, 0x46, 0xC0, 0xB6, 0xFD,
+0x00, 0xC0, 0x4D, 0x93, 0x00, 0xC2, 0x10, 0xBC, 0xEB, 0x82, 0x71, 0xCC, 0x46, 0xC0, 0x35, 0xE5,
+0x7E, 0x71, 0xC0, 0x96, 0xFD, 0x47, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0x44, 0x09, 0xBE, 0x44, 0x00, 0x4C, 0x00, 0x44, 0x0E,
+0x4C, 0x44, 0x4C, 0x44, 0x27, 0x78, 0xC0, 0x98, 0xDE, 0x71, 0x21, 0x91, 0xBF, 0x71, 0x00, 0x6C,
+0x71, 0x17, 0x59, 0x45, 0x41, 0x6D, 0x45, 0x91, 0xC4, 0x71, 0x8C, 0xD7, 0xB5, 0x9A, 0xD6, 0x7D,
+0xEF, 0xFF, 0xFF, 0x00, 0x61, 0xC4, 0x9E, 0xD7, 0x79, 0xB6, 0x34, 0x95, 0x9A, 0xB6, 0x1C, 0xC7,
+0x91, 0x51, 0xC0, 0xBB, 0xBE, 0xA9, 0x50, 0x4C, 0xC0, 0xD7, 0xA5, 0x42, 0xC1, 0x3C, 0xCF, 0x7E,
+0xD7, 0x99, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x5E, 0xE7, 0x7B, 0xC0, 0x9C, 0xCE, 0x40, 0x53,
+0xA5, 0x40, 0xC0, 0xDD, 0xD6, 0x47, 0xC0, 0xB8, 0xB5, 0x47, 0xC0, 0x3E, 0xE7, 0x7B, 0x43, 0x71,
+0x06, 0x60, 0xC1, 0x76, 0xFD, 0x14, 0xED, 0x63, 0x4E, 0x00, 0xC0, 0xF3, 0xE4, 0x00, 0x6B, 0x81,
+0xC0, 0x34, 0xED, 0x63, 0x58, 0x63, 0x6B, 0xC0, 0x75, 0xFD, 0x00, 0xC0, 0x7D, 0xFF, 0x71, 0x0B,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC0, 0x1B, 0xEF, 0x78, 0xAF, 0x05, 0xC1, 0x12, 0xB5, 0x53,
+0xBD, 0x95, 0xAB, 0xC0, 0x4F, 0x9C, 0x92, 0x5C, 0xC1, 0xCD, 0x83, 0x70, 0x9C, 0x48, 0x5C, 0x4D,
+0x5C, 0xC0, 0xF5, 0xD5, 0xA6, 0x44, 0x00, 0xA6, 0x48, 0x44, 0x00, 0xC0, 0x74, 0xC5, 0x5C, 0xC2,
+0x94, 0xC5, 0xCE, 0x83, 0xB1, 0xA4, 0x78, 0xC1, 0x0E, 0x8C, 0xB1, 0xAC, 0x4C, 0x5C, 0xC0, 0xF2,
+0xB4, 0x44, 0xC0, 0xF2, 0xAC, 0xA5, 0x5C, 0x4C, 0x44, 0x03, 0x47, 0x44, 0x18, 0x78, 0xC0, 0x98,
+0xDE, 0x71, 0x0F, 0xC0, 0xFC, 0xE6, 0x71, 0x00, 0x79, 0x71, 0xC2, 0xDB, 0xDE, 0x18, 0xC6, 0xFB,
+0xDE, 0x60, 0xC0, 0x5D, 0xEF, 0x91, 0x71, 0x04, 0xC0, 0x3C, 0xE7, 0x61, 0x71, 0x79, 0xBF, 0xC1,
+0xDF, 0xFF, 0xBA, 0xD6, 0x60, 0xC0, 0x34, 0xA5, 0x44, 0xC0, 0x75, 0xAD, 0x00, 0xC0, 0x9E, 0xF7,
+0x71, 0x10, 0xC0, 0xDB, 0xD6, 0x45, 0x59, 0x00, 0x48, 0x4D, 0x5C, 0x4D, 0x45, 0x49, 0x71, 0x00,
+0x82, 0xC2, 0x5D, 0xCF, 0x9E, 0xD7, 0xDF, 0xDF, 0x4C, 0xA6, 0x4C, 0x95, 0x4C, 0x01, 0x7D, 0x51,
+0xAB, 0x47, 0x7D, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x5E, 0xE7, 0x7B, 0xBE, 0x7B, 0x43,
+0x00, 0x7B, 0xAE, 0x43, 0xAF, 0x43, 0x7B, 0x00, 0x43, 0x71, 0x06, 0xA1, 0x4E, 0xA9, 0x4E, 0x47,
+0x00, 0x4E, 0x02, 0x47, 0x4E, 0xA5, 0x4E, 0x00, 0x42, 0x47, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0x04, 0xBE, 0xC0, 0x70, 0x9C,
+0x74, 0x92, 0xC4, 0xEE, 0x8B, 0x8D, 0x7B, 0x74, 0xC5, 0xF2, 0xAC, 0xAD, 0x83, 0xBF, 0x70, 0x67,
+0x80, 0xC0, 0xB1, 0xA4, 0x49, 0x58, 0xC1, 0x53, 0xBD, 0x0F, 0x94, 0x74, 0xC2, 0xEB, 0x6A, 0x33,
+0xB5, 0x16, 0xD6, 0x6C, 0xC6, 0x0B, 0x6B, 0x94, 0xC5, 0xF2, 0xB4, 0xAD, 0x83, 0x70, 0x9C, 0x8D,
+0x7B, 0x53, 0xBD, 0x4C, 0x40, 0xC0, 0x2F, 0x94, 0x4C, 0x74, 0x44, 0xC0, 0x4C, 0x73, 0x43, 0x81,
+0xC0, 0xEE, 0x8B, 0x44, 0xC0, 0xF2, 0xAC, 0xBE, 0x70, 0xC1, 0x90, 0xA4, 0x94, 0xC5, 0x74, 0xC0,
+0xD5, 0xCD, 0x15, 0x78, 0xC0, 0x98, 0xDE, 0x71, 0x02, 0x65, 0x91, 0x75, 0x4D, 0x00, 0xC1, 0x59,
+0xCE, 0x96, 0xB5, 0x75, 0x78, 0xC0, 0xFB, 0xDE, 0x79, 0xC2, 0x14, 0xA5, 0xDB, 0xDE, 0x10, 0x84,
+0x4D, 0x71, 0xC0, 0x55, 0xAD, 0x75, 0x69, 0xC2, 0xD3, 0x9C, 0x18, 0xC6, 0x6D, 0x73, 0x60, 0x65,
+0x71, 0x61, 0xC1, 0x34, 0xAD, 0x9A, 0xD6, 0x64, 0xC1, 0x3C, 0xEF, 0x7D, 0xEF, 0x64, 0xC1, 0x1C,
+0xE7, 0x96, 0xB5, 0x69, 0x5D, 0x7C, 0xC0, 0xEF, 0x83, 0x61, 0xC0, 0x9E, 0xF7, 0x7C, 0x55, 0xC0,
+0x59, 0xCE, 0x71, 0x10, 0x59, 0x45, 0x59, 0x5C, 0x48, 0x4D, 0x61, 0x4D, 0x45, 0x49, 0x71, 0x00,
+0x82, 0xC2, 0x5D, 0xCF, 0x9E, 0xD7, 0xDF, 0xDF, 0x4C, 0x95, 0xBA, 0x4C, 0x00, 0x60, 0x00, 0x4C,
+0x00, 0x60, 0xC0, 0x7E, 0xD7, 0x7D, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x5E, 0xE7, 0x7B,
+0xC0, 0x5F, 0xE7, 0x00, 0x48, 0xA6, 0x7B, 0xAE, 0x43, 0x4F, 0x40, 0x7B, 0x00, 0x43, 0x71, 0x06,
+0xA1, 0x4E, 0xA9, 0xAF, 0x00, 0x4E, 0x02, 0x47, 0x53, 0x00, 0x42, 0x53, 0x4E, 0x42, 0x47, 0xC0,
+0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0x44,
+0x04, 0xBE, 0xC1, 0x70, 0x9C, 0xF2, 0xAC, 0x91, 0xA6, 0xC0, 0x2F, 0x94, 0x54, 0x6C, 0xC1, 0x0B,
+0x6B, 0xAD, 0x83, 0x7F, 0xC0, 0x2B, 0x73, 0x6C, 0xC0, 0xEE, 0x8B, 0x58, 0x7F, 0x00, 0x54, 0xC0,
+0x32, 0xB5, 0x6B, 0x78, 0x4C, 0x40, 0x7F, 0xC1, 0x16, 0xD6, 0x50, 0x9C, 0x68, 0x6B, 0x54, 0xC0,
+0x0E, 0x8C, 0x4C, 0x40, 0x53, 0x4C, 0x7F, 0x44, 0x53, 0x7F, 0x5C, 0xC0, 0xB1, 0xA4, 0x70, 0xC1,
+0x6C, 0x7B, 0x4F, 0x94, 0xBF, 0x00, 0xC0, 0x0F, 0x8C, 0x58, 0x4C, 0x96, 0x14, 0x78, 0xC0, 0x98,
+0xDE, 0x71, 0x01, 0xC1, 0x3C, 0xE7, 0x30, 0x8C, 0xAF, 0xC0, 0xDB, 0xDE, 0x54, 0x55, 0x64, 0xC1,
+0x7D, 0xEF, 0x34, 0xAD, 0x54, 0x50, 0x55, 0xC0, 0x18, 0xC6, 0x64, 0x55, 0x5D, 0x71, 0x79, 0x64,
+0xC0, 0xB6, 0xB5, 0x00, 0xC1, 0x59, 0xCE, 0xB3, 0x9C, 0x95, 0x79, 0x71, 0x69, 0x74, 0xC0, 0xEF,
+0x83, 0x64, 0xC0, 0xDF, 0xFF, 0x71, 0xC0, 0x76, 0xB5, 0x91, 0x5C, 0x73, 0x6C, 0x64, 0x7D, 0xC2,
+0x71, 0x8C, 0xBA, 0xD6, 0x31, 0x8C, 0x59, 0xC0, 0x9A, 0xD6, 0x71, 0x10, 0xC0, 0xDB, 0xD6, 0x4D,
+0x50, 0xC0, 0x72, 0x8C, 0x45, 0x91, 0xC1, 0x71, 0x8C, 0x18, 0xBE, 0x48, 0x49, 0xC0, 0xFF, 0xFF,
+0x00, 0x61, 0xC2, 0x9E, 0xD7, 0x59, 0xB6, 0xF3, 0x8C, 0x6B, 0x4C, 0x91, 0x6B, 0xAE, 0xC0, 0xF4,
+0x8C, 0xAE, 0xC0, 0x18, 0xAE, 0xA6, 0x42, 0xC1, 0x3C, 0xCF, 0x7E, 0xD7, 0x99, 0xC0, 0x9E, 0xDF,
+0x71, 0x00, 0xC1, 0x5E, 0xE7, 0xBC, 0xD6, 0x4B, 0xAE, 0xBF, 0xC1, 0x9C, 0xCE, 0x3E, 0xDF, 0x53,
+0x91, 0x4B, 0xC0, 0xBC, 0xCE, 0x40, 0xA6, 0x43, 0x71, 0x06, 0xA1, 0xC1, 0x96, 0xFD, 0x14, 0xED,
+0x7E, 0xC0, 0x92, 0xCC, 0x6B, 0x63, 0xAE, 0x91, 0xC0, 0x35, 0xED, 0x7D, 0x00, 0x53, 0xC0, 0x71,
+0xCC, 0x6B, 0xC0, 0x75, 0xFD, 0x00, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0x44, 0x04, 0xBE, 0xC1, 0xB1, 0xA4, 0x2F, 0x94, 0xA6,
+0x6C, 0xC1, 0x94, 0xC5, 0xCD, 0x83, 0xBB, 0x7F, 0x44, 0xC1, 0x6C, 0x7B, 0x12, 0xB5, 0x6C, 0x6B,
+0xC1, 0x4F, 0x9C, 0xEE, 0x8B, 0x48, 0x6B, 0x70, 0x00, 0xC1, 0x94, 0xC5, 0xF5, 0xD5, 0x48, 0xC1,
+0xEE, 0x8B, 0x94, 0xC5, 0x91, 0xC0, 0xAD, 0x83, 0x44, 0xAE, 0xC2, 0xCE, 0x83, 0xD5, 0xD5, 0xF2,
+0xAC, 0x5C, 0xC1, 0x53, 0xBD, 0x0E, 0x8C, 0x7F, 0x44, 0x7F, 0x00, 0xC0, 0x50, 0x9C, 0x68, 0xC0,
+0x4C, 0x7B, 0x53, 0x40, 0xC1, 0x74, 0xC5, 0xCA, 0x62, 0x5C, 0xC0, 0xD5, 0xCD, 0x15, 0x78, 0xC0,
+0x98, 0xDE, 0x71, 0x01, 0xC1, 0x3C, 0xE7, 0x92, 0x94, 0x79, 0xC2, 0x5D, 0xEF, 0x51, 0x8C, 0x14,
+0xA5, 0x64, 0xC0, 0x7D, 0xEF, 0x69, 0x64, 0xC1, 0x1C, 0xE7, 0x34, 0xAD, 0x51, 0xC0, 0x96, 0xB5,
+0x58, 0x49, 0x71, 0xA2, 0xC2, 0x2C, 0x6B, 0x9A, 0xD6, 0x96, 0xB5, 0x51, 0xBF, 0xC0, 0xAE, 0x7B,
+0x51, 0x71, 0x69, 0x65, 0xC1, 0x30, 0x84, 0x59, 0xCE, 0x71, 0x00, 0x51, 0xC0, 0x6D, 0x73, 0x71,
+0x69, 0x79, 0xC2, 0xD3, 0x9C, 0x3C, 0xEF, 0xD7, 0xBD, 0x50, 0x55, 0xC1, 0x18, 0xC6, 0xB6, 0xB5,
+0x75, 0xC0, 0xDF, 0xFF, 0x71, 0x0E, 0xC0, 0xDB, 0xD6, 0x48, 0x50, 0xC0, 0xCF, 0x7B, 0x41, 0x6D,
+0xC0, 0xAE, 0x73, 0x54, 0xC0, 0x9A, 0xCE, 0x49, 0x71, 0x00, 0x82, 0xC1, 0xBF, 0xD7, 0x51, 0x7C,
+0xBF, 0xC3, 0xAE, 0x6B, 0x79, 0xB6, 0xDB, 0xBE, 0xEB, 0x52, 0x57, 0xC6, 0x10, 0x74, 0x6D, 0x63,
+0x38, 0xAE, 0x96, 0x9D, 0x30, 0x7C, 0x34, 0x95, 0xBE, 0xD7, 0x91, 0xC0, 0x9E, 0xDF, 0x71, 0x00,
+0xC6, 0x5E, 0xE7, 0xDC, 0xD6, 0x76, 0xAD, 0xB4, 0x94, 0x19, 0xBE, 0x77, 0xAD, 0x1A, 0xBE, 0x90,
+0x77, 0x4B, 0x5B, 0xC0, 0x3E, 0xDF, 0xA6, 0xBE, 0x71, 0x06, 0xA1, 0xC4, 0x96, 0xFD, 0x51, 0xCC,
+0xCB, 0x7A, 0x0C, 0x8B, 0x10, 0xB4, 0x00, 0x7E, 0xC3, 0x6D, 0x9B, 0x72, 0xCC, 0x0C, 0x83, 0x49,
+0x62, 0x53, 0xC0, 0x08, 0x5A, 0x78, 0x53, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0x05, 0x78, 0xC0, 0x0F, 0x94, 0xAE, 0xC1,
+0x94, 0xC5, 0x0E, 0x8C, 0x44, 0xC3, 0x53, 0xBD, 0xCE, 0x83, 0x50, 0x9C, 0x12, 0xB5, 0x5C, 0xA6,
+0x5C, 0xC3, 0x4F, 0x94, 0x90, 0xA4, 0x33, 0xB5, 0xEE, 0x8B, 0x57, 0x60, 0x48, 0xC0, 0xF5, 0xD5,
+0x92, 0x53, 0xC0, 0xF2, 0xAC, 0x68, 0xC1, 0xD1, 0xAC, 0xB4, 0xC5, 0x70, 0xC0, 0xD2, 0xAC, 0x4C,
+0xC3, 0x74, 0xC5, 0xAD, 0x83, 0x0F, 0x94, 0xF2, 0xB4, 0x48, 0x68, 0x40, 0x54, 0x57, 0xC1, 0x0F,
+0x8C, 0x70, 0x9C, 0x54, 0xBE, 0x6B, 0xC1, 0x6C, 0x7B, 0xD5, 0xCD, 0x16, 0x78, 0xC0, 0x98, 0xDE,
+0x71, 0x02, 0xC2, 0x59, 0xCE, 0xB6, 0xB5, 0xFB, 0xDE, 0xBF, 0x91, 0x74, 0xC2, 0x96, 0xB5, 0x3C,
+0xE7, 0x75, 0xB5, 0x4D, 0xC3, 0x34, 0xAD, 0xD3, 0x9C, 0x5D, 0xEF, 0x79, 0xD6, 0xAF, 0x71, 0x00,
+0xC1, 0x18, 0xC6, 0xBE, 0xF7, 0x5C, 0x70, 0x44, 0x48, 0x61, 0x71, 0x70, 0xC0, 0x35, 0xAD, 0x4D,
+0x75, 0x71, 0x00, 0x44, 0x65, 0x71, 0x44, 0xC0, 0x14, 0xA5, 0x7C, 0x60, 0x58, 0xC0, 0x7D, 0xEF,
+0x78, 0x91, 0x5D, 0xC0, 0xBA, 0xDE, 0x5D, 0x71, 0x0E, 0x59, 0x45, 0x4D, 0xC0, 0xD3, 0x9C, 0x41,
+0xC0, 0x51, 0x8C, 0x74, 0xC1, 0xEF, 0x7B, 0x59, 0xC6, 0x49, 0xC0, 0xFF, 0xFF, 0x00, 0x82, 0x51,
+0xC2, 0xB2, 0x84, 0x3C, 0xCF, 0x39, 0xAE, 0x4A, 0xC0, 0x18, 0xAE, 0x66, 0xC0, 0x7A, 0xB6, 0xA9,
+0xC1, 0x75, 0x9D, 0xDF, 0xDF, 0x00, 0xC0, 0x9A, 0xBE, 0x76, 0x51, 0x91, 0xC0, 0x9E, 0xDF, 0x71,
+0x00, 0xC0, 0x5E, 0xE7, 0x96, 0xC0, 0xDC, 0xD6, 0x4B, 0xC6, 0x9F, 0xEF, 0x19, 0xBE, 0x93, 0x94,
+0xFD, 0xDE, 0x56, 0xA5, 0x97, 0xB5, 0x1D, 0xDF, 0x40, 0xA6, 0xBE, 0x71, 0x06, 0xA1, 0xC1, 0x96,
+0xFD, 0x51, 0xC4, 0x00, 0xC0, 0xEF, 0xB3, 0x52, 0x7E, 0x00, 0x6A, 0x46, 0x81, 0xC3, 0xAB, 0x7A,
+0x72, 0xCC, 0x8A, 0x72, 0x92, 0xD4, 0x53, 0x47, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x06, 0xC1, 0x1B, 0xEF, 0xB4, 0xCD, 0xAF, 0x06, 0x4C, 0x00, 0x44, 0x4C, 0x00, 0x44,
+0xC0, 0x16, 0xD6, 0x4C, 0xA6, 0x44, 0x01, 0x4C, 0x00, 0x44, 0x4C, 0x44, 0x58, 0xC2, 0x33, 0xB5,
+0xCE, 0x8B, 0x50, 0x9C, 0x4C, 0x02, 0x44, 0x4C, 0x00, 0x92, 0x44, 0x58, 0x4C, 0x00, 0x47, 0x4C,
+0x47, 0x44, 0x00, 0x4C, 0x00, 0x44, 0x4C, 0xC0, 0xD1, 0xAC, 0x00, 0x4C, 0x44, 0x15, 0x78, 0xC0,
+0x98, 0xDE, 0x71, 0x0C, 0xC0, 0x9A, 0xD6, 0x71, 0x30, 0x59, 0x4D, 0xC4, 0xF7, 0xBD, 0xCB, 0x5A,
+0x96, 0xAD, 0x92, 0x94, 0xAE, 0x73, 0x5C, 0x79, 0x49, 0x71, 0x00, 0x61, 0xC0, 0xBE, 0xD7, 0x67,
+0xC0, 0xDB, 0xBE, 0xA1, 0xC0, 0xF3, 0x8C, 0x4A, 0xC0, 0x55, 0x95, 0x00, 0xC1, 0x39, 0xAE, 0x34,
+0x95, 0x51, 0x00, 0xC0, 0xB3, 0x84, 0x57, 0x51, 0x91, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0xC0, 0x5E,
+0xE7, 0x96, 0xC4, 0xBC, 0xCE, 0x97, 0xAD, 0x5F, 0xE7, 0x5B, 0xC6, 0x93, 0x94, 0x4F, 0xC1, 0x7B,
+0xCE, 0x56, 0xA5, 0x4B, 0x43, 0x96, 0x43, 0x71, 0x06, 0x60, 0xC5, 0x96, 0xFD, 0x71, 0xCC, 0x49,
+0x62, 0x0C, 0x83, 0x14, 0xED, 0x6D, 0x9B, 0x7E, 0xA6, 0xC2, 0x4D, 0x93, 0x30, 0xBC, 0x2C, 0x8B,
+0x53, 0x44, 0xC1, 0x92, 0xD4, 0x96, 0xFD, 0xA5, 0xC1, 0x7D, 0xFF, 0xFF, 0xFF, 0x0B, 0x70, 0x00,
+0x71, 0x06, 0xC0, 0x5C, 0xEF, 0x78, 0xAF, 0x18, 0x78, 0x96, 0x00, 0x44, 0x2D, 0xA1, 0xC0, 0xB9,
+0xE6, 0x71, 0x3F, 0x59, 0x45, 0xC2, 0xFB, 0xDE, 0xF7, 0xBD, 0x30, 0x84, 0x4D, 0x41, 0x5D, 0xC0,
+0x59, 0xCE, 0x49, 0x71, 0x00, 0x82, 0xC0, 0xBE, 0xD7, 0x67, 0xC0, 0x3C, 0xCF, 0x57, 0x76, 0xC0,
+0x8E, 0x6B, 0x72, 0xC4, 0xEF, 0x73, 0x38, 0xAE, 0x55, 0x95, 0xFF, 0xDF, 0x59, 0xB6, 0x76, 0xC1,
+0xDF, 0xDF, 0x7D, 0xCF, 0x00, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x48, 0x96, 0x58, 0xC1, 0x97, 0xAD,
+0x5F, 0xE7, 0x4B, 0xC4, 0x15, 0x9D, 0x7B, 0xCE, 0x9F, 0xEF, 0xFD, 0xDE, 0x77, 0xAD, 0x43, 0x7B,
+0x43, 0x71, 0x06, 0xA1, 0x53, 0xC2, 0x51, 0xCC, 0x6D, 0x9B, 0x75, 0xF5, 0x53, 0xC1, 0x4D, 0x93,
+0x8E, 0x9B, 0x46, 0xC0, 0x0C, 0x8B, 0x69, 0xC0, 0xAE, 0xA3, 0x7F, 0x6A, 0xC1, 0x92, 0xCC, 0x96,
+0xFD, 0xA5, 0xC0, 0x7D, 0xFF, 0x71, 0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x06, 0xA6, 0xC0, 0x37,
+0xD6, 0x73, 0x78, 0xE0, 0x08, 0x73, 0xC1, 0xD5, 0xCD, 0x9D, 0xF7, 0x71, 0x3F, 0xC1, 0xDB, 0xDE,
+0x79, 0xCE, 0x6D, 0xC0, 0x8E, 0x73, 0x41, 0xC2, 0xF7, 0xBD, 0xEF, 0x83, 0x71, 0x8C, 0x4D, 0xC0,
+0x9E, 0xF7, 0x71, 0x00, 0x86, 0xC0, 0xDF, 0xD7, 0x4E, 0x7A, 0x91, 0xC2, 0x75, 0x9D, 0xF3, 0x8C,
+0xBE, 0xD7, 0x76, 0xC0, 0x34, 0x95, 0xAF, 0x65, 0xC1, 0x6D, 0x63, 0xAE, 0x6B, 0x57, 0xC0, 0x9E,
+0xD7, 0x95, 0xC0, 0x9E, 0xDF, 0x71, 0x00, 0x48, 0x40, 0xC0, 0xBC, 0xCE, 0x7C, 0xC0, 0xBC, 0xD6,
+0x7C, 0x58, 0x7C, 0xC2, 0x19, 0xBE, 0x15, 0xA5, 0xD8, 0xB5, 0x43, 0x96, 0x43, 0x71, 0x06, 0x6C,
+0xC1, 0xB7, 0xFD, 0x31, 0xC4, 0x80, 0xC0, 0xB6, 0xFD, 0x00, 0xC0, 0x4D, 0x93, 0x00, 0xC2, 0x30,
+0xBC, 0xEC, 0x82, 0x72, 0xCC, 0x46, 0xC0, 0x55, 0xED, 0x7E, 0xC1, 0x71, 0xCC, 0x76, 0xFD, 0x47,
+0xC1, 0x9E, 0xFF, 0xFF, 0xFF, 0x0B, 0x70, 0x00, 0x71, 0x07, 0xA5, 0xC1, 0xB9, 0xE6, 0x58, 0xDE,
+0xE0, 0x07, 0xA9, 0xC1, 0x98, 0xDE, 0x7D, 0xF7, 0x71, 0xE0, 0x00, 0x49, 0xC1, 0x9A, 0xCE, 0x14,
+0xA5, 0x91, 0x45, 0xC0, 0xD7, 0xBD, 0x6D, 0xC2, 0x59, 0xC6, 0xFB, 0xDE, 0xFF, 0xFF, 0x02, 0xC1,
+0xBE, 0xDF, 0x9A, 0xB6, 0x63, 0xC3, 0xBA, 0xBE, 0x3C, 0xC7, 0xDB, 0xBE, 0x9E, 0xD7, 0x50, 0x00,
+0xBE, 0xC3, 0x7E, 0xCF, 0x38, 0xAE, 0x76, 0x9D, 0x79, 0xB6, 0x44, 0xA9, 0xC0, 0xDF, 0xEF, 0x71,
+0x00, 0x92, 0x7B, 0xA5, 0x91, 0xAF, 0xA9, 0x7B, 0x5B, 0xC1, 0x3A, 0xC6, 0xD9, 0xB5, 0x6F, 0x7B,
+0x00, 0xC0, 0x9F, 0xF7, 0x71, 0x07, 0xC1, 0x9A, 0xFE, 0xF4, 0xEC, 0xA9, 0xC0, 0x55, 0xFD, 0x00,
+0xC0, 0xF3, 0xE4, 0x00, 0xBF, 0x91, 0x6B, 0x66, 0x4E, 0x5F, 0x6B, 0xC1, 0x35, 0xFD, 0x59, 0xFE,
+0x71, 0x0C, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x58, 0x49, 0x91, 0x00, 0x61, 0xAF, 0x75, 0x00,
+0xC0, 0xDF, 0xFF, 0x71, 0x03, 0xC0, 0xDF, 0xE7, 0xAE, 0xA1, 0x54, 0x00, 0x4F, 0x54, 0x01, 0x4F,
+0x63, 0x68, 0xA2, 0x4F, 0xC0, 0xDF, 0xEF, 0x71, 0x02, 0x64, 0x91, 0xAB, 0x50, 0x00, 0x48, 0x57,
+0x00, 0xAE, 0x48, 0x00, 0x64, 0x71, 0x09, 0xC1, 0xFB, 0xFE, 0x38, 0xFE, 0xA6, 0x00, 0x7A, 0x01,
+0xAB, 0x7A, 0x00, 0x75, 0x7A, 0x00, 0xC0, 0xBA, 0xFE, 0x71, 0x0D, 0x70, 0x00, 0x71, 0xE0, 0xAC,
+0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70,
+0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0x35, 0x49, 0xC1, 0x59, 0xCE, 0x9A, 0xD6, 0x79, 0xC0,
+0xBE, 0xF7, 0x71, 0x0B, 0x6C, 0xC1, 0xF3, 0x9C, 0xDB, 0xDE, 0x71, 0x04, 0xC1, 0x9E, 0xF7, 0xF7,
+0xC5, 0x71, 0x15, 0xC1, 0x18, 0xC6, 0x76, 0xB5, 0x71, 0x33, 0x58, 0x54, 0x71, 0xE0, 0x08, 0x70,
+0x00, 0x71, 0x35, 0xC1, 0x5D, 0xEF, 0x2C, 0x6B, 0x5C, 0xC1, 0x75, 0xB5, 0x3C, 0xE7, 0x49, 0x71,
+0x00, 0xA6, 0x49, 0x6C, 0x71, 0x00, 0x49, 0x5D, 0x71, 0x58, 0x00, 0x71, 0xC0, 0xD3, 0x9C, 0x74,
+0x6C, 0x5D, 0x6C, 0x00, 0x5C, 0x61, 0x5D, 0x48, 0x71, 0x5D, 0x58, 0x71, 0x6C, 0x58, 0x49, 0x71,
+0x00, 0x49, 0x5D, 0x71, 0x00, 0xC1, 0xBA, 0xDE, 0x1C, 0xE7, 0x71, 0x5D, 0x49, 0x71, 0x01, 0x50,
+0x75, 0x48, 0xC0, 0x92, 0x94, 0x49, 0x71, 0x01, 0x49, 0x71, 0x01, 0x6C, 0xC0, 0x7D, 0xF7, 0x5D,
+0x58, 0x5D, 0x71, 0x00, 0x44, 0x71, 0x00, 0x5D, 0x49, 0x5D, 0x79, 0x71, 0x02, 0x49, 0x71, 0x00,
+0x49, 0x6C, 0x71, 0x5D, 0x4C, 0x5D, 0x58, 0x5D, 0x71, 0x6C, 0x58, 0x5D, 0x00, 0x58, 0x71, 0x6C,
+0x49, 0x71, 0x00, 0x5D, 0x49, 0x71, 0x01, 0x5D, 0x48, 0x71, 0x49, 0x5D, 0x71, 0x44, 0x6C, 0x5D,
+0x71, 0x5D, 0x6C, 0x71, 0x58, 0x5D, 0x71, 0x58, 0x00, 0x71, 0x38, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x35, 0x6C, 0xC0, 0xEF, 0x7B, 0x74, 0x79, 0xC0, 0x75, 0xB5, 0xAF, 0xC0, 0x14, 0xA5, 0x61, 0xC0,
+0xCF, 0x7B, 0x7C, 0xC1, 0x1C, 0xE7, 0xFF, 0xFF, 0x60, 0x7C, 0xC0, 0x38, 0xC6, 0x74, 0xC0, 0x34,
+0xAD, 0x50, 0x5C, 0xC0, 0x34, 0xA5, 0x48, 0xC1, 0xF7, 0xBD, 0x55, 0xAD, 0x79, 0x41, 0x59, 0x68,
+0x65, 0x50, 0x61, 0x50, 0x64, 0x74, 0x50, 0x68, 0xC1, 0x10, 0x84, 0xBB, 0xDE, 0x60, 0x41, 0x60,
+0x71, 0x00, 0x6C, 0x7C, 0x48, 0x50, 0x64, 0xC0, 0xF8, 0xC5, 0x71, 0x00, 0x6C, 0x41, 0x79, 0xC1,
+0xEF, 0x7B, 0x71, 0x94, 0x64, 0x5D, 0x58, 0x41, 0x78, 0xC0, 0xFF, 0xFF, 0x5D, 0xC0, 0xEF, 0x83,
+0x7C, 0x6C, 0x55, 0xC0, 0xF0, 0x83, 0x5D, 0xC0, 0x75, 0xB5, 0x78, 0x50, 0x4D, 0xC0, 0xB2, 0x9C,
+0x51, 0xA6, 0xC0, 0x2D, 0x6B, 0x48, 0x71, 0xA6, 0x58, 0xAB, 0x4C, 0x51, 0xC0, 0x75, 0xB5, 0x50,
+0xC0, 0xDB, 0xDE, 0x40, 0x7C, 0xC0, 0xCF, 0x7B, 0x55, 0x40, 0x5D, 0xC0, 0x51, 0x8C, 0x7C, 0x6C,
+0x55, 0x74, 0x5C, 0x50, 0x78, 0xAE, 0x60, 0x7B, 0x59, 0xC0, 0x75, 0xAD, 0x71, 0x00, 0x48, 0x50,
+0x60, 0x41, 0xC0, 0x59, 0xCE, 0x64, 0x58, 0x79, 0x68, 0x61, 0x7C, 0x48, 0x00, 0x64, 0xC0, 0xB2,
+0x94, 0x7D, 0x7C, 0x4C, 0x71, 0x38, 0x70, 0x00, 0x71, 0x35, 0xA6, 0xC0, 0xCF, 0x7B, 0x51, 0x50,
+0xC1, 0xEF, 0x7B, 0xFF, 0xFF, 0x50, 0x69, 0x59, 0x5D, 0x71, 0x00, 0xC1, 0x79, 0xD6, 0xEF, 0x83,
+0x48, 0x40, 0x44, 0x5C, 0xC0, 0x71, 0x94, 0x64, 0x4D, 0x48, 0x55, 0xC0, 0x3C, 0xEF, 0x41, 0x64,
+0x4D, 0x49, 0xC0, 0xD3, 0x9C, 0x68, 0x48, 0xC3, 0x9E, 0xF7, 0x30, 0x84, 0x75, 0xB5, 0x59, 0xCE,
+0x65, 0xC2, 0x96, 0xB5, 0x7A, 0xD6, 0xEF, 0x83, 0x48, 0x71, 0x00, 0x7C, 0xC0, 0x1C, 0xE7, 0x7C,
+0x65, 0xC1, 0xDF, 0xFF, 0xAE, 0x7B, 0x71, 0x00, 0x7C, 0x61, 0xA6, 0x50, 0x44, 0x6D, 0xC0, 0x39,
+0xCE, 0x40, 0x51, 0x78, 0x71, 0x00, 0x59, 0x49, 0x54, 0x5D, 0x68, 0xC2, 0x59, 0xCE, 0xEF, 0x7B,
+0xFF, 0xFF, 0x50, 0x00, 0x54, 0x4C, 0x5C, 0x7C, 0x71, 0x00, 0x79, 0xC0, 0x71, 0x94, 0x71, 0x44,
+0x60, 0x71, 0xC0, 0xB6, 0xBD, 0x50, 0x7C, 0x49, 0x54, 0x5D, 0x59, 0x44, 0x7C, 0x70, 0x7C, 0xC0,
+0x5D, 0xE7, 0x5F, 0xC0, 0xEF, 0x83, 0x64, 0x71, 0x74, 0x51, 0x55, 0x49, 0x59, 0x71, 0x00, 0x75,
+0xC0, 0xB2, 0x9C, 0x79, 0x74, 0x4D, 0x78, 0x54, 0x75, 0xC1, 0xF3, 0x9C, 0x1C, 0xE7, 0x69, 0xC0,
+0x59, 0xCE, 0x54, 0x78, 0x64, 0x4C, 0xC0, 0x10, 0x84, 0x65, 0x71, 0x38, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0x35, 0x58, 0xC0, 0x4D, 0x6B, 0x58, 0x5D, 0x40, 0xC0, 0x1C, 0xE7, 0x6D, 0x5B, 0xC0, 0xEF,
+0x83, 0x49, 0x71, 0x00, 0x61, 0x4C, 0xC0, 0x30, 0x8C, 0x7C, 0x65, 0x4C, 0xC1, 0x34, 0xAD, 0xB3,
+0x9C, 0x65, 0x4D, 0x48, 0xC0, 0x59, 0xCE, 0x5C, 0x50, 0x7D, 0xC2, 0xFB, 0xE6, 0x31, 0x8C, 0x55,
+0xAD, 0x7D, 0x74, 0x7C, 0x50, 0x4C, 0x00, 0xC0, 0xF3, 0xA4, 0x70, 0x78, 0x40, 0x71, 0x00, 0x68,
+0xC0, 0x18, 0xC6, 0x78, 0x64, 0x4D, 0x54, 0x71, 0x00, 0x68, 0x60, 0x74, 0x5C, 0x70, 0x45, 0x4D,
+0x48, 0xC0, 0x5D, 0xEF, 0x49, 0x71, 0x00, 0xC0, 0xEF, 0x7B, 0x70, 0x7B, 0xC0, 0x3C, 0xEF, 0x40,
+0xC0, 0x79, 0xD6, 0x48, 0x70, 0x6D, 0x7D, 0xC1, 0x9A, 0xD6, 0xCF, 0x7B, 0x60, 0x40, 0xC1, 0x9E,
+0xF7, 0xFF, 0xFF, 0x70, 0xC0, 0xAF, 0x7B, 0x61, 0x58, 0xC0, 0x30, 0x8C, 0x61, 0x50, 0x4C, 0x48,
+0x70, 0x7B, 0x78, 0x40, 0x61, 0x54, 0x4D, 0x59, 0xC2, 0xDB, 0xDE, 0xD3, 0x9C, 0x71, 0x94, 0x7C,
+0x70, 0x54, 0x51, 0x6D, 0x70, 0xC0, 0xEF, 0x83, 0x71, 0x00, 0xC0, 0xDB, 0xDE, 0x74, 0x61, 0xC0,
+0x96, 0xB5, 0x40, 0x5C, 0xC0, 0xF3, 0xA4, 0x55, 0x44, 0x4C, 0xC0, 0xB2, 0x9C, 0x60, 0x41, 0x4C,
+0x58, 0x4D, 0x65, 0xC0, 0xAE, 0x7B, 0x5D, 0x71, 0x37, 0x70, 0x00, 0x71, 0x35, 0xC0, 0x5D, 0xEF,
+0x50, 0xC0, 0x1C, 0xE7, 0x71, 0xC0, 0xFB, 0xE6, 0x7D, 0x79, 0x58, 0x5F, 0x75, 0x71, 0x00, 0xC0,
+0x9A, 0xD6, 0x7D, 0x5C, 0x5D, 0x4C, 0x51, 0x5D, 0x7D, 0x79, 0x71, 0xC0, 0x34, 0xAD, 0x78, 0x4C,
+0x5C, 0x7D, 0x48, 0xC1, 0x75, 0xB5, 0x9E, 0xF7, 0x51, 0x4C, 0x58, 0xC0, 0x18, 0xC6, 0x79, 0xA6,
+0x60, 0x48, 0x7D, 0x61, 0x71, 0x00, 0x5C, 0x7D, 0x58, 0x60, 0xC0, 0xB6, 0xBD, 0x49, 0x71, 0x00,
+0x5C, 0x40, 0x74, 0x4C, 0x61, 0x69, 0x71, 0x60, 0xC0, 0x55, 0xAD, 0x5C, 0x71, 0x5D, 0x69, 0x5C,
+0x78, 0x61, 0x78, 0x70, 0x00, 0x7D, 0x79, 0x44, 0x7D, 0x74, 0x5D, 0x78, 0x5C, 0x71, 0x00, 0x74,
+0x50, 0x70, 0x44, 0x7D, 0x65, 0x5D, 0x6C, 0x5C, 0x78, 0x61, 0x78, 0x5C, 0x7D, 0x4D, 0x40, 0x4D,
+0x4C, 0x4D, 0x79, 0x7D, 0x75, 0x4D, 0x4C, 0x61, 0x69, 0xC0, 0xDF, 0xFF, 0x71, 0xC1, 0xFB, 0xE6,
+0x75, 0xB5, 0x65, 0xC0, 0xB7, 0xBD, 0x61, 0x65, 0x4C, 0x44, 0x70, 0x50, 0x78, 0x48, 0x5D, 0xC0,
+0x55, 0xAD, 0x51, 0x79, 0x7D, 0x48, 0x71, 0x38, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0xAC, 0x70,
+0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0x08, 0x49, 0x5C, 0x71, 0x09, 0x5C, 0x49, 0x71,
+0x04, 0x5D, 0x58, 0x71, 0x05, 0x5C, 0x49, 0x71, 0x1F, 0x75, 0x61, 0x71, 0x11, 0x58, 0x00, 0x71,
+0x01, 0x49, 0xC0, 0xDF, 0xFF, 0x71, 0xE0, 0x05, 0x70, 0x00, 0x71, 0xE0, 0x08, 0xC2, 0x1C, 0xE7,
+0xEF, 0x7B, 0xFF, 0xFF, 0x09, 0x7C, 0x4C, 0x71, 0x04, 0x5C, 0xC0, 0x38, 0xCE, 0x71, 0x05, 0x7C,
+0x7D, 0x71, 0x1F, 0x68, 0x54, 0x71, 0x11, 0x48, 0x79, 0x71, 0x01, 0x4C, 0x44, 0x6C, 0x71, 0xE0,
+0x04, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3E, 0x5D, 0x60, 0x7D, 0x49, 0x5C, 0x78, 0xC0, 0x34, 0xAD,
+0x5C, 0x71, 0x48, 0x78, 0xC0, 0xEF, 0x83, 0x71, 0x00, 0x69, 0x6D, 0x49, 0x57, 0x51, 0x49, 0x6C,
+0x65, 0x60, 0x58, 0xC0, 0x92, 0x94, 0x64, 0xC1, 0x9E, 0xF7, 0x1C, 0xE7, 0x78, 0x64, 0x5C, 0x48,
+0x61, 0x49, 0x4C, 0x65, 0x44, 0x4C, 0x51, 0x6C, 0x78, 0x4C, 0x71, 0x00, 0x79, 0x51, 0x61, 0x51,
+0x58, 0x7D, 0x5D, 0x4C, 0x78, 0x7D, 0x44, 0x78, 0x69, 0x60, 0x71, 0x65, 0x4C, 0x49, 0x48, 0x78,
+0x60, 0x7C, 0x64, 0x5D, 0x71, 0x01, 0x65, 0x78, 0x64, 0x58, 0x70, 0xC0, 0xB2, 0x9C, 0x6C, 0xC0,
+0x59, 0xCE, 0x65, 0x58, 0x60, 0x7D, 0x49, 0x44, 0x4C, 0x48, 0x58, 0x65, 0x6F, 0x71, 0x00, 0x4C,
+0x48, 0xC0, 0x1C, 0xE7, 0x74, 0x00, 0x70, 0x5C, 0x4C, 0x70, 0x65, 0x61, 0xC0, 0x10, 0x84, 0x48,
+0x5C, 0x4D, 0x71, 0xE0, 0x01, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3E, 0x58, 0x4C, 0x6D, 0x78, 0x74,
+0xC0, 0x30, 0x8C, 0x51, 0x68, 0x4D, 0x7C, 0xC0, 0x1C, 0xE7, 0x45, 0x71, 0x00, 0x50, 0x55, 0x74,
+0x48, 0x7C, 0xBF, 0x78, 0xBE, 0x65, 0xC0, 0xB2, 0x9C, 0x69, 0x41, 0x7D, 0x4D, 0xC0, 0x10, 0x84,
+0x65, 0xC0, 0x71, 0x94, 0x78, 0x69, 0x70, 0x4D, 0x51, 0xC0, 0xDB, 0xDE, 0x60, 0xC0, 0xEF, 0x7B,
+0x61, 0x7D, 0x4C, 0xC0, 0xFF, 0xFF, 0x5D, 0xC0, 0x8E, 0x73, 0x5B, 0xC0, 0x1B, 0xE7, 0x7B, 0xC1,
+0x9E, 0xF7, 0xCF, 0x7B, 0x58, 0x40, 0x74, 0x7C, 0x50, 0xC0, 0xEF, 0x7B, 0x5C, 0x45, 0x6D, 0xC0,
+0x34, 0xAD, 0x5C, 0x68, 0xC0, 0x75, 0xAD, 0x48, 0xC0, 0x1C, 0xE7, 0x54, 0x4C, 0xC0, 0xDF, 0xFF,
+0xAE, 0x01, 0x41, 0x58, 0x7D, 0x7C, 0x70, 0x41, 0x64, 0x7C, 0x7B, 0x47, 0x51, 0x6D, 0x7D, 0x73,
+0x54, 0x61, 0xC0, 0xB2, 0x9C, 0x55, 0xC0, 0xAE, 0x73, 0x5C, 0x71, 0x7D, 0x50, 0x74, 0xC0, 0xBA,
+0xDE, 0x55, 0x7D, 0x40, 0x78, 0x75, 0x48, 0x79, 0xC0, 0xCF, 0x7B, 0x75, 0x50, 0x4D, 0x71, 0xE0,
+0x01, 0x70, 0x00, 0x71, 0x3E, 0x61, 0x78, 0x64, 0x78, 0x61, 0x55, 0xC0, 0x9E, 0xF7, 0x7C, 0x7D,
+0x69, 0x71, 0x54, 0x71, 0x00, 0x69, 0x65, 0xA1, 0x6D, 0xC0, 0xBE, 0xF7, 0x58, 0xC0, 0x51, 0x8C,
+0x79, 0x71, 0x78, 0x65, 0x79, 0x78, 0x75, 0x41, 0xC0, 0xDF, 0xFF, 0x68, 0x60, 0x64, 0xC0, 0xEF,
+0x83, 0x71, 0x00, 0x60, 0x00, 0xC1, 0x71, 0x94, 0xDB, 0xDE, 0x7D, 0x4C, 0x71, 0x6C, 0x79, 0x7B,
+0x4D, 0x54, 0x71, 0x54, 0x5D, 0x7C, 0x58, 0x51, 0xC0, 0xF3, 0xA4, 0x7C, 0x71, 0x44, 0xC0, 0x4D,
+0x6B, 0x60, 0x71, 0x74, 0x4C, 0x78, 0x71, 0x70, 0x5C, 0x71, 0x02, 0xC2, 0x75, 0xB5, 0x59, 0xCE,
+0x5D, 0xEF, 0x68, 0xC0, 0x1C, 0xE7, 0x7C, 0xC0, 0x71, 0x94, 0x65, 0xC1, 0x7D, 0xF7, 0x79, 0xD6,
+0x78, 0x64, 0x00, 0x58, 0xC0, 0xD3, 0x9C, 0xBE, 0xC0, 0xEF, 0x83, 0x4D, 0x49, 0x5D, 0x71, 0x5D,
+0x40, 0x69, 0x71, 0x7D, 0x51, 0x61, 0x40, 0xC0, 0x9A, 0xD6, 0x7C, 0x57, 0x59, 0x71, 0xE0, 0x04,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3E, 0xC0, 0x59, 0xCE, 0x45, 0xC0, 0x14, 0xA5, 0x00, 0x60, 0xC0,
+0x72, 0x94, 0x48, 0x40, 0x75, 0x7B, 0x50, 0xC0, 0xCF, 0x7B, 0x5D, 0x71, 0x65, 0x59, 0x61, 0x59,
+0x69, 0x61, 0xA6, 0x40, 0x7D, 0xC0, 0x71, 0x94, 0x78, 0x00, 0x41, 0x74, 0x54, 0xC1, 0xDB, 0xDE,
+0xEF, 0x83, 0x4B, 0x50, 0xC0, 0xB6, 0xBD, 0x54, 0xC0, 0x59, 0xCE, 0x55, 0x7C, 0xC0, 0x71, 0x94,
+0x60, 0x44, 0x50, 0x71, 0xC0, 0x5D, 0xEF, 0x64, 0x41, 0x61, 0x68, 0x4B, 0x6C, 0x75, 0x68, 0x50,
+0x00, 0x75, 0xC0, 0xEF, 0x83, 0x69, 0x64, 0x61, 0x41, 0x64, 0xC1, 0xF7, 0xC5, 0x75, 0xB5, 0x68,
+0x71, 0x64, 0x4B, 0x4D, 0x50, 0x71, 0x00, 0x6C, 0x59, 0x50, 0x61, 0xC1, 0x59, 0xCE, 0x10, 0x84,
+0x74, 0x59, 0xC0, 0xD7, 0xBD, 0x7D, 0xC0, 0x51, 0x8C, 0x50, 0x41, 0xC0, 0xF7, 0xC5, 0x64, 0x6C,
+0x60, 0x68, 0x4C, 0x58, 0x71, 0x00, 0xC1, 0xF3, 0xA4, 0xB6, 0xBD, 0x71, 0x44, 0x70, 0x78, 0x50,
+0x65, 0xC0, 0x10, 0x84, 0x79, 0xC0, 0x51, 0x8C, 0x74, 0x60, 0x00, 0x71, 0xE0, 0x01, 0x70, 0x00,
+0x71, 0x3F, 0x58, 0x5D, 0xBF, 0x00, 0x5D, 0x6C, 0x5D, 0x71, 0x5D, 0x49, 0x5D, 0x71, 0x01, 0x58,
+0x71, 0x6C, 0xC0, 0x5D, 0xEF, 0x6C, 0x71, 0x5D, 0x49, 0x5D, 0x6C, 0x00, 0x5D, 0x6C, 0x5D, 0x6C,
+0x5D, 0x01, 0x71, 0x49, 0x58, 0x71, 0x49, 0x5D, 0x6C, 0x5D, 0x00, 0x71, 0x00, 0x49, 0x5D, 0x71,
+0x6C, 0x44, 0x5D, 0x6C, 0x45, 0x65, 0x6C, 0x5D, 0xC1, 0xAE, 0x7B, 0x1C, 0xE7, 0x71, 0x00, 0x5D,
+0x49, 0x71, 0xA2, 0x5D, 0x71, 0x00, 0x58, 0xC0, 0xDB, 0xDE, 0x69, 0x71, 0x00, 0x50, 0x00, 0x5D,
+0x71, 0x6C, 0x5D, 0x71, 0x58, 0x49, 0x71, 0x58, 0x5D, 0x6C, 0x00, 0x49, 0x71, 0x00, 0x49, 0x00,
+0x71, 0x04, 0x5D, 0x00, 0x58, 0x00, 0x71, 0x5D, 0x6C, 0x00, 0x5D, 0x6C, 0x00, 0x71, 0xE0, 0x01,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x30, 0x6C, 0xC0, 0x75, 0xB5, 0x5C, 0x71, 0x44, 0x64, 0x49,
+0x71, 0x08, 0x58, 0x71, 0x01, 0xC0, 0xF7, 0xC5, 0xAF, 0x71, 0xE0, 0x23, 0x70, 0x00, 0x71, 0xE0,
+0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC,
+0x70, 0x00, 0x71, 0xE0, 0x23, 0xC2, 0xFD, 0xDE, 0xFA, 0x8C, 0x3C, 0xBE, 0x71, 0x2E, 0xC4, 0x3E,
+0xE7, 0xBF, 0xF7, 0x5C, 0xBE, 0x1A, 0x95, 0xFD, 0xD6, 0x71, 0x0B, 0xC2, 0x7E, 0xEF, 0x3A, 0x95,
+0xDB, 0xAD, 0x71, 0x3F, 0x70, 0x00, 0x71, 0xE0, 0x23, 0x62, 0xC1, 0x73, 0x01, 0x18, 0x64, 0x71,
+0x2D, 0xC5, 0x5E, 0xE7, 0xD5, 0x32, 0xDD, 0xD6, 0x38, 0x6C, 0x72, 0x01, 0x9B, 0xA5, 0x71, 0x0B,
+0xC3, 0xBD, 0xCE, 0xB3, 0x09, 0x16, 0x43, 0xDF, 0xF7, 0x71, 0x3E, 0x70, 0x00, 0x71, 0x36, 0x64,
+0x95, 0x71, 0x00, 0xA6, 0x82, 0x71, 0x00, 0x69, 0x50, 0x6C, 0x92, 0x5C, 0x71, 0x00, 0x64, 0x5F,
+0x71, 0x00, 0x64, 0x5C, 0x6C, 0x5C, 0x5F, 0x71, 0x00, 0x64, 0x00, 0x71, 0x00, 0x5F, 0x5C, 0x71,
+0x03, 0x64, 0x5C, 0x71, 0x64, 0xC0, 0x3E, 0xE7, 0x71, 0x01, 0x48, 0xC0, 0x1C, 0xB6, 0x67, 0x71,
+0x64, 0x5C, 0x71, 0x6C, 0x43, 0x6C, 0x71, 0x00, 0x5F, 0x43, 0x48, 0x6C, 0x71, 0x05, 0x6C, 0x48,
+0x00, 0x64, 0x71, 0x01, 0x6C, 0x43, 0x48, 0x71, 0x02, 0x5C, 0x64, 0x71, 0x48, 0x50, 0x71, 0x00,
+0x48, 0xAE, 0x71, 0x02, 0xC1, 0xBB, 0xA5, 0xD5, 0x3A, 0x6C, 0xC2, 0x58, 0x74, 0xD3, 0x11, 0xFB,
+0xAD, 0x6C, 0x43, 0x64, 0x71, 0x02, 0x69, 0x43, 0x48, 0x71, 0x01, 0xC2, 0xDD, 0xD6, 0x14, 0x1A,
+0x76, 0x4B, 0x6C, 0x00, 0x55, 0x6C, 0x71, 0x43, 0x5C, 0x71, 0x38, 0x70, 0x00, 0x71, 0x36, 0xC1,
+0x7A, 0x9D, 0x75, 0x2A, 0x5A, 0x71, 0xC1, 0xF9, 0x8C, 0x95, 0x2A, 0x7E, 0x71, 0xC0, 0x78, 0x7C,
+0x46, 0x67, 0xC2, 0xD9, 0x84, 0xB5, 0x32, 0x7C, 0xC6, 0x71, 0x74, 0x56, 0x6F, 0x71, 0xC0, 0xB7,
+0x5B, 0x6A, 0x43, 0xC1, 0xF7, 0x63, 0x16, 0x3B, 0x43, 0x6C, 0xC0, 0x97, 0x53, 0x91, 0x64, 0x50,
+0x6A, 0x4B, 0x6C, 0x71, 0x02, 0xC0, 0xD7, 0x63, 0x67, 0xC0, 0xB9, 0x84, 0x56, 0xC0, 0x34, 0x1A,
+0x53, 0x48, 0x71, 0x7E, 0x4E, 0x5D, 0x71, 0x65, 0x4E, 0x5D, 0x7C, 0x6A, 0xC0, 0xDD, 0xD6, 0x71,
+0xC2, 0x1A, 0x8D, 0xD5, 0x32, 0x14, 0x1A, 0x6A, 0xC1, 0x99, 0x7C, 0xFF, 0xFF, 0x04, 0xC2, 0x1B,
+0xB6, 0x36, 0x4B, 0x34, 0x22, 0x65, 0x77, 0x64, 0x71, 0x76, 0xC0, 0x36, 0x43, 0x6A, 0x6D, 0xC1,
+0x76, 0x53, 0x9D, 0xC6, 0x71, 0xC4, 0x3E, 0xDF, 0xF5, 0x3A, 0xB7, 0x5B, 0x58, 0x74, 0x54, 0x22,
+0x4E, 0x62, 0x5D, 0x72, 0x41, 0xC0, 0x5A, 0x95, 0x71, 0x01, 0x60, 0x7C, 0x71, 0x74, 0x65, 0xC0,
+0x78, 0x74, 0x77, 0x6A, 0x6F, 0x67, 0x71, 0x00, 0xC2, 0xFB, 0xB5, 0x16, 0x43, 0x34, 0x1A, 0x72,
+0xC0, 0xD7, 0x63, 0x43, 0x71, 0x67, 0x65, 0xC0, 0x76, 0x4B, 0x71, 0xC0, 0xFB, 0xB5, 0x46, 0xC2,
+0x58, 0x74, 0xD7, 0x5B, 0x34, 0x1A, 0x4E, 0xC0, 0xFB, 0xAD, 0x71, 0x37, 0x70, 0x00, 0x71, 0x36,
+0xC0, 0x5C, 0xC6, 0x51, 0xC0, 0x18, 0x64, 0x71, 0x77, 0xC0, 0x93, 0x09, 0x5D, 0xC1, 0xDF, 0xFF,
+0xD5, 0x32, 0x92, 0x5F, 0xC0, 0x9B, 0xA5, 0x44, 0xC0, 0x1A, 0x8D, 0x6C, 0x4E, 0x49, 0x62, 0x48,
+0x6A, 0x77, 0xC0, 0xFF, 0xFF, 0x50, 0x49, 0xC0, 0x3C, 0xBE, 0x40, 0x6A, 0x65, 0xC1, 0xDD, 0xD6,
+0x5C, 0xC6, 0x49, 0x74, 0x71, 0x03, 0x77, 0xC0, 0xF3, 0x11, 0x6F, 0x55, 0x58, 0xC0, 0xD3, 0x09,
+0x74, 0x71, 0x62, 0x44, 0xC0, 0x18, 0x6C, 0x71, 0xC0, 0x79, 0x7C, 0x56, 0x72, 0xC0, 0xF8, 0x63,
+0x50, 0x48, 0xC0, 0x5A, 0x95, 0x4E, 0xC0, 0xF5, 0x3A, 0x55, 0x91, 0x79, 0x71, 0x03, 0xC0, 0x9D,
+0xCE, 0x6D, 0x00, 0xC0, 0xF9, 0x8C, 0x62, 0xC0, 0xB9, 0x7C, 0x64, 0xC0, 0xDD, 0xD6, 0x72, 0x00,
+0xC2, 0x7A, 0x9D, 0x1A, 0x8D, 0x14, 0x1A, 0x53, 0xC0, 0x7E, 0xEF, 0x40, 0x6D, 0x65, 0xC0, 0x18,
+0x64, 0x55, 0x6D, 0x6A, 0xC1, 0x97, 0x53, 0xF9, 0x8C, 0x72, 0xBE, 0x43, 0xC0, 0xFF, 0xFF, 0x5C,
+0xC1, 0xB5, 0x32, 0x3C, 0xBE, 0x71, 0x74, 0xC5, 0x14, 0x1A, 0x95, 0x32, 0xF9, 0x8C, 0xB7, 0x5B,
+0xD3, 0x09, 0x58, 0x6C, 0x71, 0x5A, 0xC0, 0x14, 0x1A, 0x5B, 0xC1, 0x5C, 0xC6, 0x7A, 0x9D, 0x56,
+0x4B, 0x71, 0x67, 0x65, 0xC0, 0x76, 0x4B, 0x71, 0xC0, 0x9B, 0xA5, 0x51, 0x72, 0xC0, 0xF9, 0x8C,
+0xAF, 0x6D, 0x7A, 0xC1, 0x1E, 0xDF, 0xFF, 0xFF, 0x36, 0x70, 0x00, 0x71, 0x36, 0x5C, 0xC1, 0xB5,
+0x32, 0x16, 0x43, 0x67, 0x5B, 0xC0, 0x36, 0x4B, 0x4B, 0xC1, 0xBD, 0xCE, 0x34, 0x1A, 0x58, 0x71,
+0x67, 0xC0, 0x14, 0x1A, 0x6C, 0xC0, 0x7C, 0xC6, 0x4E, 0xC1, 0x16, 0x43, 0x78, 0x74, 0x76, 0x51,
+0xC0, 0xB9, 0x84, 0x71, 0xC0, 0xFB, 0xB5, 0x51, 0xC0, 0xF9, 0x8C, 0x55, 0xC0, 0xD5, 0x32, 0x00,
+0xC0, 0x5A, 0x9D, 0x96, 0xC1, 0xB3, 0x09, 0xBB, 0xA5, 0x71, 0x03, 0x77, 0xC0, 0xF4, 0x11, 0x76,
+0x71, 0xC0, 0xFD, 0xD6, 0x6D, 0x53, 0x69, 0x76, 0x51, 0x74, 0x71, 0xC0, 0x99, 0x7C, 0x51, 0x74,
+0x71, 0x00, 0xA6, 0xC0, 0x36, 0x43, 0x5D, 0x7E, 0x71, 0x06, 0x50, 0xC0, 0xD3, 0x09, 0x50, 0x71,
+0x02, 0x65, 0x4E, 0xC0, 0x78, 0x74, 0x71, 0x00, 0xC0, 0xB7, 0x53, 0x4E, 0x76, 0x48, 0xC1, 0x54,
+0x22, 0xB5, 0x32, 0x5C, 0x69, 0x4E, 0x6D, 0x67, 0x71, 0x77, 0xC1, 0x14, 0x1A, 0xDD, 0xCE, 0x71,
+0x76, 0x4E, 0xC0, 0x9F, 0xF7, 0x71, 0x74, 0x51, 0xC0, 0xF9, 0x8C, 0x71, 0xC2, 0x5C, 0xBE, 0x14,
+0x1A, 0x97, 0x53, 0x71, 0xC0, 0xB9, 0x7C, 0x56, 0xC0, 0xB7, 0x5B, 0x5A, 0xC0, 0x5A, 0x9D, 0x7A,
+0x65, 0x7B, 0xA5, 0x65, 0x7C, 0x71, 0x5A, 0x51, 0xC0, 0xD7, 0x63, 0x71, 0x00, 0xC0, 0xD7, 0x5B,
+0x51, 0xC0, 0x9B, 0xA5, 0x71, 0x36, 0x70, 0x00, 0x71, 0x37, 0x60, 0x72, 0xC4, 0xB9, 0x84, 0xF6,
+0x3A, 0xBB, 0xAD, 0xF5, 0x3A, 0x99, 0x7C, 0x56, 0x79, 0x71, 0x69, 0xC0, 0x16, 0x43, 0x91, 0xC0,
+0x78, 0x74, 0x4B, 0x79, 0xC0, 0x36, 0x43, 0x74, 0xC0, 0xF3, 0x11, 0x7E, 0x71, 0xC1, 0x3E, 0xE7,
+0x74, 0x22, 0x4B, 0xC1, 0xD7, 0x63, 0x58, 0x74, 0xBF, 0x53, 0x96, 0x72, 0x7B, 0x71, 0x03, 0xC0,
+0x56, 0x4B, 0x65, 0xC0, 0x9D, 0xCE, 0x71, 0x48, 0xC0, 0x75, 0x2A, 0xAE, 0xC0, 0xBF, 0xF7, 0x76,
+0x51, 0x74, 0x71, 0x50, 0x51, 0xC0, 0x7A, 0x9D, 0x71, 0x00, 0x64, 0xC0, 0xD5, 0x3A, 0x6D, 0x67,
+0x71, 0x06, 0x74, 0x51, 0xC0, 0x5A, 0x95, 0x71, 0x02, 0x50, 0xC1, 0xD3, 0x09, 0xF9, 0x8C, 0x71,
+0x00, 0x74, 0x49, 0xC1, 0xBB, 0xA5, 0x7E, 0xEF, 0x6D, 0x6F, 0x69, 0x64, 0xC0, 0xB5, 0x32, 0x96,
+0x48, 0x71, 0x7F, 0xC1, 0x14, 0x1A, 0xBD, 0xCE, 0x71, 0xC0, 0x58, 0x6C, 0x92, 0x71, 0x00, 0x74,
+0x51, 0x5D, 0x71, 0xC0, 0x7C, 0xC6, 0x65, 0xC0, 0x97, 0x53, 0x71, 0x7C, 0x65, 0x62, 0xC0, 0x76,
+0x4B, 0x77, 0x4B, 0xC0, 0xD7, 0x5B, 0x7B, 0xA5, 0x65, 0x7C, 0x71, 0x5A, 0x49, 0xC0, 0x78, 0x74,
+0x71, 0x00, 0x74, 0x51, 0x7E, 0x71, 0x36, 0x70, 0x00, 0x71, 0x37, 0xC0, 0x5A, 0x9D, 0x65, 0xC0,
+0x74, 0x22, 0x5B, 0x5C, 0x56, 0x77, 0x6D, 0xC0, 0x9D, 0xCE, 0x71, 0x00, 0xC0, 0x58, 0x74, 0x65,
+0x72, 0xC1, 0xD9, 0x84, 0x1D, 0xDF, 0x7A, 0x72, 0x4E, 0x48, 0x71, 0x00, 0x4B, 0x72, 0x00, 0xC1,
+0xFB, 0xAD, 0x3C, 0xBE, 0x6D, 0x00, 0xC0, 0x56, 0x4B, 0x71, 0x5F, 0x4B, 0xC0, 0xF9, 0x8C, 0x71,
+0x00, 0x77, 0xC0, 0xF3, 0x11, 0x5D, 0xC3, 0xDF, 0xFF, 0xDB, 0xAD, 0xF4, 0x11, 0x36, 0x43, 0x71,
+0xC0, 0xFB, 0xB5, 0x51, 0xC0, 0x38, 0x6C, 0x71, 0xC0, 0x99, 0x7C, 0x51, 0xC0, 0x7A, 0x9D, 0x71,
+0x01, 0x58, 0x49, 0xC0, 0xD9, 0x84, 0x6C, 0x00, 0x40, 0x71, 0xC2, 0x3A, 0x95, 0x76, 0x4B, 0x5C,
+0xC6, 0x71, 0x41, 0xC0, 0xD3, 0x09, 0x7F, 0xC0, 0x7E, 0xEF, 0x71, 0x40, 0x6C, 0xC0, 0xBB, 0xA5,
+0x51, 0xC0, 0x77, 0x53, 0x64, 0x48, 0xC1, 0xD5, 0x3A, 0xF4, 0x19, 0x5F, 0x48, 0x6D, 0x6F, 0x64,
+0x00, 0xC0, 0xB5, 0x32, 0x96, 0x48, 0x71, 0x7C, 0xC1, 0x14, 0x1A, 0xDD, 0xD6, 0x6C, 0x56, 0x62,
+0x71, 0x00, 0x74, 0x51, 0x5A, 0x71, 0xC0, 0x7C, 0xC6, 0x65, 0xC0, 0x97, 0x53, 0x71, 0x41, 0x49,
+0xC0, 0x18, 0x6C, 0x6C, 0x71, 0xC1, 0x9F, 0xF7, 0x7C, 0xC6, 0x71, 0x67, 0x65, 0x7C, 0x71, 0x5A,
+0xC1, 0xF3, 0x11, 0xF6, 0x3A, 0x50, 0x00, 0xC0, 0x16, 0x43, 0x56, 0x7E, 0x71, 0x36, 0x70, 0x00,
+0x71, 0x37, 0xC3, 0xBD, 0xCE, 0xF4, 0x11, 0x93, 0x01, 0xF9, 0x8C, 0x71, 0xC1, 0x97, 0x53, 0x73,
+0x01, 0x4E, 0x64, 0x71, 0x00, 0xC0, 0xDB, 0xAD, 0x49, 0x00, 0x76, 0x71, 0xC0, 0xD5, 0x32, 0x41,
+0x4B, 0x71, 0x01, 0xC0, 0xD9, 0x84, 0x41, 0x60, 0xC0, 0xFD, 0xDE, 0x43, 0xC0, 0x34, 0x1A, 0x41,
+0xC0, 0x99, 0x7C, 0x71, 0x62, 0xC0, 0x52, 0x01, 0x77, 0x71, 0x00, 0x77, 0x72, 0xC0, 0xF5, 0x3A,
+0xA6, 0xC0, 0x14, 0x1A, 0x00, 0x5A, 0x71, 0xC0, 0xFB, 0xAD, 0x51, 0x74, 0x71, 0xC0, 0x58, 0x74,
+0x70, 0x79, 0x71, 0x01, 0xC0, 0x9D, 0xCE, 0x4E, 0x51, 0x56, 0x46, 0xC0, 0xF7, 0x63, 0x71, 0x58,
+0xC0, 0x12, 0x01, 0x55, 0x71, 0x5C, 0x4B, 0x51, 0x46, 0x5B, 0x4E, 0x5C, 0x64, 0xC0, 0xB7, 0x5B,
+0x51, 0x4E, 0x46, 0xC0, 0xF3, 0x11, 0x7C, 0x71, 0x6F, 0x51, 0xC0, 0xD5, 0x32, 0x64, 0xA6, 0x72,
+0x6A, 0x48, 0x71, 0xC0, 0x16, 0x43, 0x44, 0xC0, 0xFD, 0xD6, 0x92, 0xC1, 0x95, 0x32, 0x7E, 0xEF,
+0x71, 0x00, 0xC0, 0xF8, 0x63, 0x75, 0x55, 0x71, 0xC2, 0x5C, 0xBE, 0xB3, 0x09, 0x36, 0x43, 0x71,
+0x5C, 0x4B, 0x56, 0x6A, 0xC0, 0xB7, 0x5B, 0x4E, 0xC0, 0xF6, 0x3A, 0x71, 0xC0, 0xDD, 0xD6, 0x49,
+0x6A, 0x71, 0xC2, 0xBB, 0xA5, 0xF4, 0x11, 0xD5, 0x3A, 0x5B, 0x46, 0x51, 0x53, 0x64, 0x71, 0x36,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x37, 0x64, 0x55, 0x79, 0x7B, 0x71, 0xC3, 0x7C, 0xC6, 0x1A, 0x8D,
+0xFB, 0xB5, 0xFF, 0xFF, 0x01, 0x50, 0xC0, 0x5A, 0x9D, 0x00, 0x50, 0x71, 0x76, 0xC0, 0x1A, 0x8D,
+0x4B, 0xC0, 0xFF, 0xFF, 0x01, 0xC0, 0x1D, 0xDF, 0x79, 0x55, 0x69, 0x71, 0x5A, 0x79, 0x67, 0x71,
+0x7B, 0x79, 0x76, 0x71, 0x00, 0x77, 0x6D, 0x7E, 0x41, 0xC0, 0x78, 0x74, 0x76, 0x71, 0x00, 0xC0,
+0xFC, 0xB5, 0x49, 0xC1, 0x38, 0x6C, 0xFF, 0xFF, 0x4B, 0xC0, 0x1A, 0x8D, 0x67, 0xC0, 0xFF, 0xFF,
+0x02, 0x40, 0x79, 0x7C, 0xC0, 0x99, 0x7C, 0x4B, 0x71, 0x7E, 0xC0, 0x1A, 0x8D, 0x6C, 0xC0, 0xFF,
+0xFF, 0x00, 0x64, 0x5A, 0xC0, 0x79, 0x7C, 0x41, 0x55, 0xC0, 0xDF, 0xFF, 0x71, 0x64, 0x55, 0x41,
+0x4B, 0xC0, 0xFB, 0xAD, 0x71, 0x00, 0x5C, 0xC0, 0x5A, 0x95, 0x5A, 0x6C, 0x00, 0xC0, 0x9B, 0x9D,
+0xA5, 0x64, 0x71, 0xC0, 0xDB, 0xAD, 0x79, 0x5C, 0x41, 0xC0, 0x97, 0x53, 0x71, 0x01, 0xC2, 0x3C,
+0xBE, 0x1A, 0x95, 0xFD, 0xD6, 0x71, 0xC0, 0x3E, 0xE7, 0x79, 0x67, 0x71, 0x00, 0x64, 0x55, 0x41,
+0x7C, 0xC3, 0x1A, 0x8D, 0x9D, 0xCE, 0xFF, 0xFF, 0x7E, 0xEF, 0x79, 0x62, 0x71, 0x55, 0xC1, 0xD3,
+0x09, 0x99, 0x7C, 0x7E, 0x41, 0x74, 0xC0, 0x7E, 0xEF, 0x71, 0x37, 0x70, 0x00, 0x71, 0xE0, 0x1B,
+0x6F, 0x5D, 0x5A, 0x71, 0x02, 0xC1, 0x7C, 0xC6, 0x97, 0x53, 0x49, 0x79, 0x71, 0x2B, 0xC1, 0x5A,
+0x9D, 0x7C, 0xC6, 0x71, 0x15, 0x46, 0xC1, 0x93, 0x01, 0x78, 0x74, 0x71, 0x3B, 0x70, 0x00, 0x71,
+0xE0, 0x1B, 0x60, 0xC1, 0xF6, 0x3A, 0xBD, 0xD6, 0x71, 0x02, 0xC2, 0x18, 0x6C, 0x75, 0x2A, 0x38,
+0x6C, 0x5C, 0x71, 0xE0, 0x04, 0x67, 0xC1, 0x95, 0x2A, 0xFA, 0x8C, 0x71, 0x3B, 0x70, 0x00, 0x71,
+0xE0, 0x1B, 0xA6, 0x64, 0x71, 0x03, 0x5C, 0x50, 0x71, 0xE0, 0x07, 0x64, 0x6C, 0x71, 0x3B, 0x70,
+0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00,
+0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71,
+0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0, 0xAC, 0x70, 0x00, 0x71, 0xE0,
+0xAC, 0x70, 0x00, 0x71, 0x11, 0x91, 0x01, 0x71, 0x12, 0x5D, 0x71, 0x02, 0xC0, 0x9E, 0xF7, 0x71,
+0x0F, 0x5D, 0x6C, 0x71, 0x07, 0x5D, 0x00, 0x71, 0xE0, 0x0B, 0x6C, 0x71, 0x6C, 0x00, 0x71, 0x6C,
+0x00, 0x71, 0x03, 0x6C, 0x02, 0x71, 0x6C, 0x00, 0x71, 0x6C, 0x00, 0x71, 0x01, 0x6C, 0x00, 0x71,
+0x0B, 0x6C, 0x71, 0x00, 0x6C, 0x71, 0x03, 0x6C, 0x00, 0x71, 0x05, 0x6C, 0x00, 0x71, 0x15, 0x70,
+0x00, 0x71, 0x10, 0x61, 0xC0, 0x75, 0xAD, 0x68, 0x7D, 0xC0, 0x5D, 0xEF, 0x6C, 0x71, 0x6C, 0x71,
+0x00, 0x5D, 0x71, 0x00, 0x5D, 0xBE, 0x6C, 0x01, 0x71, 0x6C, 0x68, 0xC0, 0x7D, 0xEF, 0x71, 0x54,
+0x69, 0xC0, 0x79, 0xCE, 0x71, 0x58, 0xC2, 0x34, 0xA5, 0xB6, 0xBD, 0xDB, 0xDE, 0x5D, 0x71, 0x6C,
+0x5D, 0x00, 0xC0, 0x1C, 0xE7, 0x71, 0x6C, 0x71, 0x00, 0x5D, 0x6C, 0x5D, 0x71, 0x00, 0xC2, 0xBA,
+0xDE, 0xD3, 0x9C, 0x55, 0xAD, 0x5C, 0x71, 0x6C, 0x71, 0x6C, 0x5D, 0x6C, 0x71, 0x6C, 0x61, 0x00,
+0x71, 0x6C, 0x71, 0x5D, 0x71, 0x6C, 0x5D, 0x6C, 0x00, 0x71, 0x6C, 0x00, 0x71, 0x5D, 0x71, 0xC0,
+0x3C, 0xEF, 0x49, 0x71, 0x5D, 0x71, 0x34, 0xC0, 0xF3, 0x9C, 0x91, 0xC4, 0x51, 0x8C, 0xCF, 0x7B,
+0xC3, 0x18, 0x10, 0x84, 0x0C, 0x63, 0x91, 0xC2, 0xDF, 0xFF, 0x6A, 0x52, 0x8E, 0x73, 0x49, 0x54,
+0x4F, 0x79, 0x71, 0xC0, 0x2C, 0x63, 0xA2, 0xC1, 0xAE, 0x73, 0x29, 0x4A, 0x68, 0xC4, 0xE3, 0x18,
+0x2D, 0x6B, 0x72, 0x8C, 0xE4, 0x20, 0x24, 0x21, 0x54, 0xC0, 0xF0, 0x83, 0x40, 0x4B, 0x55, 0xC0,
+0xD3, 0x9C, 0x54, 0x68, 0x6D, 0x54, 0x60, 0xC2, 0xFB, 0xE6, 0xB3, 0x9C, 0xF7, 0xBD, 0x71, 0x40,
+0xC0, 0xBA, 0xD6, 0x71, 0xC0, 0xCF, 0x7B, 0x44, 0x45, 0xC0, 0xC3, 0x18, 0x45, 0x40, 0x49, 0x54,
+0xC1, 0xD3, 0x9C, 0x86, 0x31, 0xA6, 0xC0, 0xBE, 0xF7, 0x7C, 0xC0, 0x9A, 0xD6, 0x7C, 0x7D, 0x71,
+0x45, 0xC1, 0xC3, 0x18, 0xAE, 0x73, 0x49, 0x7B, 0x63, 0x77, 0x4F, 0x71, 0x10, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x10, 0xA6, 0x95, 0x77, 0xC1, 0x9E, 0xF7, 0x34, 0xA5, 0xA2, 0x4D, 0x55, 0x91, 0xBA,
+0x55, 0x48, 0x4C, 0x00, 0xC0, 0x18, 0xC6, 0x51, 0x60, 0xC0, 0x7E, 0xF7, 0x6C, 0xC0, 0x39, 0xCE,
+0x68, 0x49, 0x5D, 0xC0, 0xD3, 0x9C, 0x58, 0x68, 0x71, 0x58, 0x40, 0xC0, 0x59, 0xCE, 0x58, 0xC3,
+0x14, 0xA5, 0xDB, 0xDE, 0x71, 0x94, 0x96, 0xB5, 0x4D, 0x54, 0x61, 0x55, 0xBA, 0xC0, 0x38, 0xC6,
+0x50, 0x44, 0xC0, 0x55, 0xAD, 0x74, 0x71, 0xC0, 0x1C, 0xE7, 0x44, 0x64, 0xC0, 0x38, 0xCE, 0x78,
+0x7C, 0x4D, 0x60, 0x69, 0x78, 0x74, 0x51, 0x64, 0x70, 0x7D, 0x64, 0x69, 0x7C, 0x74, 0x58, 0x55,
+0x64, 0x00, 0xC0, 0xFC, 0xE6, 0x55, 0x41, 0x00, 0x58, 0x79, 0x50, 0x4C, 0x78, 0x4C, 0xC0, 0x3C,
+0xE7, 0x74, 0x71, 0x32, 0x54, 0x40, 0xC4, 0xAF, 0x73, 0x0C, 0x63, 0x00, 0x00, 0x6E, 0x73, 0x28,
+0x42, 0xA2, 0x6C, 0x73, 0xC2, 0xCB, 0x5A, 0x5D, 0xEF, 0xAE, 0x73, 0xA6, 0x60, 0x71, 0xC0, 0x49,
+0x4A, 0x91, 0xC1, 0xEB, 0x5A, 0x25, 0x29, 0x7B, 0x40, 0xC2, 0x6A, 0x4A, 0xCF, 0x7B, 0x00, 0x00,
+0x00, 0xC1, 0xAF, 0x7B, 0x4D, 0x6B, 0xAE, 0x40, 0x00, 0xC0, 0x31, 0x84, 0x67, 0xC0, 0xEF, 0x7B,
+0xBF, 0x64, 0x6C, 0xC0, 0xDB, 0xDE, 0x45, 0x78, 0xC0, 0xFF, 0xFF, 0x49, 0x79, 0x71, 0x70, 0xC0,
+0x3D, 0xEF, 0x53, 0xC0, 0x00, 0x00, 0x53, 0x00, 0xC0, 0x5D, 0xEF, 0x5D, 0x4F, 0xC0, 0x62, 0x10,
+0x95, 0xC1, 0x9E, 0xF7, 0x51, 0x8C, 0x79, 0x54, 0xC0, 0x55, 0xAD, 0x71, 0xC0, 0x8E, 0x73, 0x40,
+0x61, 0x44, 0xC0, 0x2D, 0x6B, 0x6C, 0x45, 0x58, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x11,
+0x91, 0x7C, 0x48, 0x7C, 0x79, 0x50, 0x64, 0xC0, 0x59, 0xCE, 0x7C, 0x4D, 0x78, 0x74, 0x41, 0x44,
+0x6D, 0x74, 0x71, 0xC0, 0x1C, 0xE7, 0x7C, 0xC1, 0xEF, 0x7B, 0x18, 0xC6, 0x5D, 0x7C, 0xC0, 0x9E,
+0xF7, 0x6D, 0xC0, 0xFF, 0xFF, 0x5D, 0x75, 0x59, 0x79, 0xC0, 0xF7, 0xC5, 0x50, 0xC0, 0x38, 0xC6,
+0x7C, 0x4D, 0x69, 0x65, 0x50, 0x79, 0x60, 0x91, 0x69, 0x74, 0x64, 0x71, 0x70, 0xC1, 0x71, 0x94,
+0xF3, 0xA4, 0x54, 0x6D, 0x79, 0x64, 0x60, 0x00, 0x64, 0x54, 0x00, 0x41, 0x4D, 0x7D, 0x74, 0xC0,
+0x72, 0x94, 0x74, 0xC0, 0xFB, 0xDE, 0x50, 0x74, 0x4C, 0x78, 0x50, 0xBE, 0x74, 0xC0, 0xB2, 0x9C,
+0x4D, 0x7D, 0x78, 0x61, 0x60, 0x50, 0x5D, 0xBF, 0x71, 0x32, 0x63, 0x81, 0xC1, 0xCF, 0x7B, 0x2C,
+0x63, 0x40, 0xC1, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC4, 0xDF, 0xFF, 0xA7, 0x39, 0xEC, 0x62, 0x5D,
+0xEF, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00,
+0x00, 0x8A, 0x52, 0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0xC0, 0x51, 0x8C, 0x6C,
+0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0xC1, 0xDB, 0xDE, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A,
+0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0xC0, 0xA2, 0x10,
+0xA6, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70,
+0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x11, 0xC0,
+0x3D, 0xEF, 0x54, 0xC0, 0x5D, 0xEF, 0x55, 0xC0, 0x59, 0xCE, 0x5C, 0x55, 0x79, 0x41, 0x74, 0x64,
+0x74, 0x55, 0x71, 0x50, 0x5C, 0x71, 0x00, 0xA6, 0xC0, 0x96, 0xB5, 0x79, 0x00, 0x65, 0x64, 0xC0,
+0x7A, 0xD6, 0x71, 0xC0, 0x3C, 0xE7, 0x64, 0xBE, 0x75, 0x00, 0x50, 0x4D, 0x55, 0x5C, 0x50, 0x48,
+0x55, 0x48, 0xC0, 0x18, 0xC6, 0x78, 0x64, 0x60, 0xC0, 0x34, 0xAD, 0x71, 0x4D, 0x55, 0xC0, 0xFB,
+0xE6, 0x50, 0x55, 0x60, 0x61, 0xC0, 0x35, 0xAD, 0x7C, 0x74, 0x50, 0x00, 0x7C, 0x74, 0xC0, 0x76,
+0xB5, 0x48, 0xC0, 0xD7, 0xBD, 0xA5, 0x75, 0x50, 0xC0, 0xF7, 0xC5, 0x7D, 0xC0, 0x55, 0xAD, 0x74,
+0x64, 0x74, 0x41, 0x74, 0x6C, 0x65, 0x78, 0x65, 0x64, 0xC0, 0x1C, 0xE7, 0x74, 0x71, 0x32, 0x63,
+0x81, 0xC4, 0xCF, 0x7B, 0x2C, 0x63, 0x00, 0x00, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF,
+0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0xC0, 0x6A, 0x52, 0x74, 0xC5, 0x0C, 0x63,
+0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40,
+0xBF, 0xC0, 0x51, 0x8C, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D,
+0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0xC0, 0x2D, 0x6B, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00,
+0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0x5D,
+0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x15, 0xA6, 0x71, 0x00, 0x6C, 0x71, 0x01, 0x6C, 0x71, 0x5C, 0xC0, 0xF7, 0xC5, 0x71, 0x02, 0x91,
+0x6C, 0x71, 0x00, 0x6C, 0x71, 0x01, 0x6C, 0x01, 0xC1, 0xB6, 0xBD, 0x5D, 0xEF, 0x71, 0x04, 0x6C,
+0x71, 0x09, 0x6C, 0x71, 0x00, 0x50, 0x5C, 0x71, 0x05, 0x6C, 0x71, 0x05, 0x6C, 0x71, 0x03, 0x6C,
+0x71, 0x35, 0x63, 0x4C, 0xC0, 0xCF, 0x7B, 0x75, 0xC1, 0x00, 0x00, 0x8E, 0x73, 0x74, 0x60, 0xC0,
+0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63,
+0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF,
+0xC0, 0x51, 0x8C, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71,
+0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54,
+0x6D, 0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40,
+0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1E,
+0x58, 0xC0, 0xDF, 0xFF, 0x71, 0x0D, 0x58, 0x71, 0x14, 0xC0, 0x5D, 0xEF, 0x58, 0x71, 0xE0, 0x0B,
+0x63, 0x4C, 0xC0, 0xCF, 0x7B, 0x75, 0x40, 0xC0, 0x8E, 0x73, 0x74, 0x60, 0xC0, 0xDF, 0xFF, 0x47,
+0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65, 0x29, 0x10,
+0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0,
+0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71,
+0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0, 0x9E, 0xF7,
+0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0x5D, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54,
+0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0xC2, 0xBB, 0xDE, 0x59, 0xCE, 0x3C, 0xE7,
+0x71, 0x79, 0x74, 0xC0, 0xBE, 0xF7, 0x71, 0x1B, 0x58, 0xC0, 0xFB, 0xE6, 0x71, 0x00, 0xC0, 0xD7,
+0xBD, 0x58, 0x71, 0x00, 0x4D, 0x75, 0xC0, 0x7D, 0xEF, 0x58, 0x5C, 0xC0, 0x1C, 0xE7, 0x00, 0x71,
+0x02, 0xA6, 0x51, 0x71, 0x09, 0xC0, 0x5C, 0xEF, 0x4C, 0x51, 0xC0, 0x7D, 0xF7, 0x71, 0x01, 0x48,
+0x4D, 0x71, 0x02, 0x48, 0x70, 0x71, 0x4D, 0x61, 0x71, 0x06, 0x49, 0xC0, 0xD7, 0xBD, 0x71, 0x1F,
+0x63, 0x81, 0xC1, 0xCF, 0x7B, 0x2C, 0x63, 0x40, 0xC1, 0x8E, 0x73, 0x49, 0x4A, 0x60, 0xC0, 0xDF,
+0xFF, 0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63,
+0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF,
+0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC1, 0x31, 0x8C, 0xB6, 0xB5, 0x71, 0x58,
+0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D,
+0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70,
+0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0x55,
+0xC0, 0x18, 0xC6, 0x7C, 0x91, 0x48, 0x91, 0xC0, 0x3C, 0xE7, 0x71, 0x91, 0x79, 0x49, 0x5C, 0xC1,
+0x1C, 0xE7, 0x5D, 0xEF, 0x48, 0x5C, 0x48, 0x58, 0x5C, 0x74, 0x75, 0x61, 0x44, 0x75, 0x51, 0x48,
+0x58, 0x48, 0x58, 0x5C, 0xA5, 0xC0, 0xDF, 0xFF, 0x48, 0x49, 0x00, 0x70, 0x79, 0x61, 0xC0, 0x38,
+0xCE, 0x48, 0x5F, 0x7D, 0x75, 0x71, 0x7D, 0x51, 0xC1, 0x14, 0xA5, 0x96, 0xB5, 0x60, 0x79, 0x48,
+0x61, 0x79, 0x49, 0x71, 0x74, 0xC0, 0x92, 0x94, 0x49, 0xC0, 0x79, 0xD6, 0x5D, 0x5C, 0xC0, 0x3C,
+0xEF, 0x44, 0x00, 0x61, 0x4D, 0x44, 0x71, 0x5C, 0x74, 0xC0, 0xB2, 0x94, 0x75, 0x71, 0x00, 0x5C,
+0xC0, 0xD3, 0x9C, 0x69, 0x44, 0x71, 0x01, 0xC1, 0xD7, 0xBD, 0x75, 0xB5, 0x4D, 0x7D, 0xC0, 0x55,
+0xAD, 0x70, 0x71, 0x5D, 0xC0, 0x79, 0xD6, 0x49, 0x61, 0x4D, 0xC0, 0xDF, 0xFF, 0x5D, 0x41, 0x44,
+0x48, 0x58, 0xC0, 0x96, 0xB5, 0x70, 0x44, 0x4D, 0x58, 0x48, 0x61, 0x71, 0x15, 0x63, 0x81, 0xC1,
+0xCF, 0x7B, 0x2C, 0x63, 0x40, 0xC1, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B,
+0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84,
+0x00, 0x00, 0x8A, 0x52, 0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0,
+0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71,
+0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0xC0, 0xA2, 0x10, 0xA6, 0xC0,
+0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0,
+0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0x7D, 0x64, 0xC1,
+0xD3, 0x9C, 0x10, 0x84, 0x71, 0x02, 0x64, 0x48, 0x55, 0xC0, 0x18, 0xC6, 0x7D, 0x41, 0x64, 0x7C,
+0xC0, 0x75, 0xB5, 0x60, 0x4B, 0x65, 0xC1, 0x92, 0x94, 0xF3, 0xA4, 0x48, 0x51, 0x50, 0x79, 0x41,
+0x91, 0xC0, 0xF7, 0xC5, 0x68, 0x48, 0x71, 0x55, 0x7D, 0x6D, 0x60, 0x91, 0xC0, 0x59, 0xCE, 0x6C,
+0x74, 0x7D, 0xA6, 0x55, 0x71, 0xC0, 0x5D, 0xEF, 0x7C, 0x78, 0x7C, 0x65, 0x61, 0x73, 0x50, 0x78,
+0x00, 0x51, 0x79, 0x50, 0x41, 0x48, 0x69, 0x51, 0x78, 0x6D, 0x4C, 0x51, 0x68, 0xC0, 0x1C, 0xE7,
+0x71, 0x00, 0x44, 0x51, 0x71, 0x01, 0xC1, 0x3C, 0xE7, 0x51, 0x8C, 0x68, 0xC0, 0xBE, 0xF7, 0x71,
+0x01, 0x5C, 0x7D, 0x00, 0xC1, 0xFB, 0xE6, 0xB6, 0xBD, 0x74, 0x71, 0xC0, 0x34, 0xAD, 0x79, 0x5F,
+0x68, 0x65, 0xC0, 0xDF, 0xFF, 0x00, 0xC0, 0x55, 0xAD, 0x48, 0x50, 0x51, 0x77, 0x5C, 0x6D, 0x00,
+0x65, 0xC0, 0x71, 0x94, 0x61, 0x71, 0x15, 0x63, 0x81, 0xC4, 0xCF, 0x7B, 0x2C, 0x63, 0x00, 0x00,
+0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65,
+0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0xF0, 0x7B,
+0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0xC1,
+0xDB, 0xDE, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00,
+0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0xC0, 0xA2, 0x10, 0xA6, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54,
+0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67,
+0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0x50, 0xC1, 0x96, 0xB5, 0xDF, 0xFF, 0x7C, 0x4D,
+0x48, 0xC0, 0x3C, 0xE7, 0x71, 0xC0, 0xB2, 0x94, 0x61, 0xC1, 0xB6, 0xBD, 0xF8, 0xC5, 0x7D, 0xC3,
+0x92, 0x94, 0xF7, 0xC5, 0x34, 0xAD, 0x18, 0xC6, 0x69, 0x64, 0x4D, 0x50, 0x7C, 0xC0, 0xD7, 0xBD,
+0x7D, 0x69, 0xC0, 0x59, 0xCE, 0x6D, 0x48, 0x49, 0x68, 0x6C, 0x71, 0x48, 0x59, 0x50, 0x7D, 0x74,
+0x4C, 0x00, 0x74, 0x64, 0x74, 0x7C, 0x6C, 0x71, 0xC0, 0x8E, 0x73, 0x4D, 0x41, 0x64, 0xC1, 0x5D,
+0xEF, 0xF3, 0xA4, 0x41, 0x48, 0x50, 0x00, 0x74, 0x6D, 0x68, 0x5C, 0x44, 0x49, 0x45, 0x78, 0x70,
+0xC0, 0x5D, 0xEF, 0x41, 0x40, 0x71, 0x00, 0x78, 0x44, 0x49, 0xC0, 0xBE, 0xF7, 0x71, 0xC0, 0x38,
+0xCE, 0x60, 0x55, 0x68, 0x5D, 0x71, 0x00, 0x65, 0x50, 0x74, 0x4C, 0x64, 0x61, 0x71, 0x41, 0x4D,
+0xC1, 0xF3, 0xA4, 0x71, 0x94, 0x49, 0x71, 0xC1, 0x9E, 0xF7, 0x92, 0x94, 0x64, 0x4B, 0x78, 0x50,
+0x48, 0x68, 0xC0, 0xDB, 0xDE, 0x61, 0x70, 0x71, 0x16, 0x63, 0x81, 0xC4, 0xCF, 0x7B, 0x2C, 0x63,
+0x00, 0x00, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF,
+0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A,
+0x52, 0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0xC0, 0x51, 0x8C, 0x6C, 0xC0, 0x10,
+0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F,
+0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0xC0, 0xA2, 0x10, 0xA6, 0xC0, 0x9E,
+0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D,
+0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0xC0, 0x59, 0xCE, 0x5C,
+0x71, 0x58, 0xC0, 0xF7, 0xC5, 0xAF, 0x49, 0x71, 0xC2, 0x3C, 0xE7, 0xD7, 0xBD, 0x1C, 0xE7, 0x79,
+0x4D, 0x5C, 0x48, 0x79, 0x4D, 0x48, 0x7C, 0x4C, 0x49, 0x4D, 0x4C, 0x5C, 0x70, 0x4D, 0x61, 0x60,
+0xC0, 0x5D, 0xEF, 0x60, 0x58, 0x71, 0x91, 0x5C, 0x44, 0x75, 0x70, 0x4D, 0x44, 0x79, 0x00, 0x5C,
+0x6F, 0xC0, 0xDF, 0xFF, 0x71, 0x5C, 0x5D, 0x75, 0x44, 0x49, 0x65, 0x74, 0x61, 0x79, 0x75, 0x4C,
+0x65, 0x61, 0x65, 0xC0, 0x3D, 0xEF, 0x71, 0x48, 0x58, 0x5C, 0x49, 0x74, 0x75, 0x71, 0x5D, 0xC0,
+0x79, 0xD6, 0x71, 0x4C, 0x48, 0x71, 0x58, 0x60, 0x48, 0x60, 0x65, 0x71, 0x00, 0x48, 0x60, 0x6C,
+0x74, 0x48, 0x71, 0x00, 0x44, 0x65, 0x70, 0xC0, 0x38, 0xCE, 0x44, 0x71, 0x58, 0x65, 0x7C, 0x65,
+0x4D, 0x00, 0x61, 0x48, 0x65, 0x75, 0x60, 0x6C, 0x71, 0x15, 0x63, 0x81, 0xC1, 0xCF, 0x7B, 0x2C,
+0x63, 0x40, 0xC1, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF,
+0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A,
+0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0xC0, 0x51, 0x8C, 0x6C, 0xC0, 0x10, 0x84,
+0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0xC0, 0x2D,
+0x6B, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0xA6, 0xC0, 0x9E, 0xF7,
+0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B,
+0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x26, 0x69, 0x49, 0x71, 0x31, 0xC1,
+0x5D, 0xEF, 0xDF, 0xFF, 0x71, 0x02, 0x49, 0xC0, 0xBE, 0xF7, 0x71, 0x30, 0x63, 0x4C, 0xC0, 0xCF,
+0x7B, 0x75, 0x40, 0xC0, 0x8E, 0x73, 0x74, 0x60, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF,
+0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A,
+0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C,
+0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0,
+0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0,
+0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71,
+0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x21, 0x49, 0xC0, 0xDF, 0xFF, 0x71, 0x0F, 0x6C, 0x71, 0x1F,
+0x49, 0x71, 0x3C, 0x63, 0x4C, 0xC0, 0xCF, 0x7B, 0x75, 0x40, 0xC0, 0x8E, 0x73, 0x74, 0x60, 0xC0,
+0xDF, 0xFF, 0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C,
+0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40,
+0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58,
+0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D,
+0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0x5D, 0x40, 0x70, 0x44, 0xC0,
+0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x1D, 0x5C, 0x55, 0xC1,
+0xDF, 0xFF, 0xD7, 0xBD, 0x50, 0x7C, 0x71, 0x06, 0x58, 0x71, 0x02, 0x6C, 0x41, 0xC0, 0x5D, 0xEF,
+0x71, 0x5C, 0xC0, 0x3C, 0xE7, 0x71, 0x08, 0x48, 0x50, 0x71, 0x00, 0x48, 0x4C, 0x71, 0xC0, 0x7D,
+0xF7, 0x7D, 0x51, 0x6C, 0x71, 0xC0, 0x34, 0xAD, 0x49, 0x71, 0x06, 0x50, 0x44, 0x71, 0x00, 0x91,
+0x6C, 0x71, 0x37, 0x63, 0x81, 0xC1, 0xCF, 0x7B, 0x2C, 0x63, 0x40, 0xC0, 0x8E, 0x73, 0x74, 0x60,
+0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C,
+0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40,
+0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58,
+0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D,
+0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70,
+0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x17, 0xC1,
+0x59, 0xCE, 0xD7, 0xBD, 0x48, 0x64, 0xC0, 0x18, 0xC6, 0x71, 0xC1, 0x1C, 0xE7, 0xF3, 0xA4, 0x71,
+0x74, 0x4C, 0xC0, 0xD3, 0x9C, 0x51, 0x4C, 0x5C, 0x51, 0x4D, 0x64, 0xC0, 0x96, 0xB5, 0x70, 0x59,
+0x79, 0x65, 0x74, 0x5C, 0x71, 0x7C, 0x58, 0x71, 0x60, 0x6F, 0x69, 0x78, 0x4C, 0x48, 0xC0, 0xF7,
+0xC5, 0x5C, 0x64, 0x51, 0x49, 0x71, 0x58, 0xC0, 0x92, 0x94, 0x71, 0x49, 0x50, 0x69, 0x71, 0x7D,
+0x79, 0x78, 0x4D, 0x5C, 0xC0, 0x51, 0x8C, 0x49, 0x71, 0xC0, 0x5D, 0xEF, 0x4C, 0xC0, 0x38, 0xCE,
+0x60, 0xC1, 0x34, 0xAD, 0x3C, 0xE7, 0x71, 0x64, 0xC0, 0x79, 0xD6, 0x7D, 0x74, 0x69, 0x78, 0xC0,
+0xBA, 0xDE, 0x64, 0xBE, 0x58, 0x50, 0x71, 0x32, 0x63, 0x81, 0xC1, 0xCF, 0x7B, 0x2C, 0x63, 0x40,
+0xC1, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67,
+0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0xF0,
+0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78,
+0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00,
+0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0xA6, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75,
+0xAD, 0x71, 0x5D, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2,
+0x9C, 0x00, 0x71, 0x16, 0x49, 0xC2, 0xD3, 0x9C, 0x5D, 0xEF, 0x92, 0x94, 0x7C, 0xC0, 0xBE, 0xF7,
+0x71, 0xC1, 0x1C, 0xE7, 0xF3, 0xA4, 0x71, 0x65, 0xC0, 0xB7, 0xBD, 0x4D, 0x64, 0x59, 0x5C, 0x69,
+0x79, 0x7D, 0xA6, 0x48, 0xC0, 0x14, 0xA5, 0x49, 0x64, 0x65, 0x79, 0x71, 0x41, 0x5D, 0x71, 0x7D,
+0xBA, 0x91, 0xC2, 0x18, 0xC6, 0xB2, 0x9C, 0x59, 0xCE, 0x78, 0x58, 0x41, 0x5F, 0x71, 0x01, 0x7C,
+0x71, 0x5F, 0x7C, 0x54, 0x71, 0x78, 0x5C, 0xC0, 0xD7, 0xBD, 0x69, 0x50, 0x45, 0x65, 0x71, 0x64,
+0x4D, 0x7D, 0x68, 0x65, 0x71, 0x00, 0x69, 0x65, 0xA1, 0x50, 0x7D, 0x48, 0x70, 0x51, 0x50, 0x64,
+0xC0, 0xDF, 0xFF, 0x71, 0x32, 0x63, 0x81, 0xC0, 0xCF, 0x7B, 0x75, 0xC2, 0x00, 0x00, 0x8E, 0x73,
+0x49, 0x4A, 0x91, 0xC1, 0xDF, 0xFF, 0xA7, 0x39, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x67, 0x65,
+0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0xF0, 0x7B,
+0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0xC0, 0x51, 0x8C, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C,
+0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0,
+0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0xA6, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0,
+0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71,
+0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x16, 0xA6, 0x69, 0xC0, 0xB6, 0xBD, 0x96, 0xC1, 0x92, 0x94,
+0xBE, 0xF7, 0x71, 0x5D, 0x77, 0xC0, 0xD7, 0xBD, 0x65, 0xA6, 0x50, 0x60, 0x4C, 0xC0, 0xF3, 0xA4,
+0x00, 0x60, 0xC0, 0x75, 0xB5, 0x64, 0x79, 0x7C, 0xC0, 0x1C, 0xE7, 0x41, 0x7C, 0xC0, 0x38, 0xCE,
+0x71, 0x54, 0x4C, 0xBE, 0x78, 0x50, 0x64, 0x40, 0x50, 0x00, 0x7C, 0x79, 0x69, 0x59, 0xC0, 0x5D,
+0xEF, 0x71, 0x70, 0xC0, 0xEF, 0x83, 0x49, 0x58, 0x79, 0x50, 0x48, 0x79, 0x69, 0x00, 0x44, 0x00,
+0x7C, 0x5C, 0x71, 0x48, 0x78, 0x7D, 0xC0, 0xF3, 0xA4, 0x54, 0x71, 0x00, 0x41, 0x00, 0x50, 0x44,
+0x4C, 0x78, 0x00, 0x51, 0x4C, 0x50, 0x71, 0x33, 0x63, 0x81, 0xC0, 0xCF, 0x7B, 0x75, 0xC2, 0x00,
+0x00, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B,
+0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52,
+0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0xC0, 0x51, 0x8C, 0x6C, 0xC0, 0x10, 0x84,
+0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44,
+0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0xA6, 0xC0, 0x9E, 0xF7, 0x54, 0x79,
+0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54,
+0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x17, 0xA6, 0x49, 0x71, 0x58, 0x71, 0x01, 0x91,
+0xC0, 0x3C, 0xE7, 0x71, 0x00, 0x49, 0x71, 0x00, 0xC0, 0x5D, 0xEF, 0x58, 0x5D, 0x01, 0x6C, 0x5D,
+0x6C, 0x58, 0x49, 0x6C, 0x71, 0x58, 0x49, 0x5D, 0x00, 0x58, 0x5D, 0x00, 0x6C, 0x49, 0x58, 0x5D,
+0x00, 0x58, 0x6C, 0x71, 0x5D, 0x49, 0x6C, 0x71, 0x00, 0xC0, 0x7D, 0xF7, 0x58, 0x71, 0x58, 0x5D,
+0x71, 0x00, 0x49, 0x6C, 0x71, 0x00, 0xC0, 0x7E, 0xF7, 0x5D, 0x6C, 0x5D, 0x71, 0x00, 0x58, 0x5D,
+0x58, 0x00, 0x6C, 0x58, 0x71, 0x44, 0x58, 0x00, 0x71, 0x33, 0x63, 0x81, 0xC1, 0xCF, 0x7B, 0x2C,
+0x63, 0x40, 0xC0, 0x8E, 0x73, 0x74, 0x60, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B,
+0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52,
+0x78, 0x40, 0xBE, 0x6C, 0xC0, 0x6E, 0x73, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C,
+0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58,
+0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54,
+0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67,
+0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x55, 0x63, 0x4C, 0x6C, 0x75, 0x40, 0xC0, 0x8E,
+0x73, 0x74, 0x60, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x67, 0x65, 0x71,
+0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE,
+0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31,
+0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00,
+0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0x5D,
+0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0x1D, 0x58, 0xC0, 0x1C, 0xE7, 0x71, 0xA6, 0x70, 0x71, 0x03, 0x91, 0xC0, 0x3C, 0xE7, 0x71, 0x08,
+0x79, 0x58, 0x71, 0x02, 0x5C, 0x75, 0x71, 0x49, 0x5C, 0xC0, 0xBE, 0xFF, 0x71, 0x75, 0x49, 0x58,
+0x91, 0x71, 0x5D, 0x70, 0x71, 0x00, 0x75, 0x49, 0x71, 0x00, 0x6C, 0x5C, 0x5D, 0x71, 0x05, 0x6C,
+0xC0, 0x59, 0xCE, 0x6C, 0x71, 0x39, 0x63, 0x4C, 0xC1, 0xCF, 0x7B, 0x2C, 0x63, 0x40, 0xC1, 0x8E,
+0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71,
+0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE,
+0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31,
+0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00,
+0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0,
+0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C,
+0x00, 0x71, 0x17, 0x91, 0xC2, 0x1C, 0xE7, 0xDF, 0xFF, 0x5D, 0xEF, 0x95, 0x71, 0x70, 0xC0, 0x4D,
+0x6B, 0x58, 0xC1, 0x59, 0xCE, 0xAE, 0x7B, 0x5D, 0x70, 0x6C, 0x71, 0x70, 0x61, 0x5C, 0x58, 0x70,
+0xC0, 0x5D, 0xEF, 0x48, 0x70, 0x6C, 0xC0, 0xFB, 0xE6, 0x71, 0x49, 0x44, 0x69, 0x51, 0x49, 0x71,
+0x00, 0xC0, 0x55, 0xAD, 0x65, 0x69, 0xC0, 0xD7, 0xBD, 0x7C, 0xC0, 0x38, 0xCE, 0x61, 0x71, 0x74,
+0xC0, 0xB2, 0x9C, 0x4C, 0xC0, 0xBA, 0xDE, 0x71, 0x44, 0x45, 0x71, 0x48, 0xC0, 0x96, 0xB5, 0x64,
+0x49, 0x71, 0xC0, 0x75, 0xB5, 0x69, 0x7D, 0x71, 0x00, 0xC0, 0x1C, 0xE7, 0x5D, 0xBF, 0x75, 0x44,
+0x71, 0x7C, 0x58, 0x44, 0x00, 0x49, 0x74, 0x58, 0x75, 0x6C, 0x44, 0x75, 0x71, 0x30, 0x63, 0x81,
+0xC1, 0xCF, 0x7B, 0x2C, 0x63, 0x40, 0xC1, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47,
+0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10,
+0x84, 0x00, 0x00, 0x8A, 0x52, 0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C,
+0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6,
+0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0xA6, 0xC0, 0x9E,
+0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D,
+0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x16, 0xA6, 0x64, 0xC3, 0x18,
+0xC6, 0x96, 0xB5, 0x71, 0x94, 0x59, 0xCE, 0x71, 0x58, 0xC1, 0xB2, 0x94, 0xD7, 0xBD, 0xA5, 0xC1,
+0xF3, 0xA4, 0xDB, 0xDE, 0x55, 0x78, 0x51, 0x60, 0x69, 0x74, 0x65, 0xC0, 0x14, 0xA5, 0x64, 0x59,
+0x74, 0x78, 0x60, 0x64, 0x70, 0x5C, 0x4C, 0x50, 0x55, 0x71, 0x49, 0x54, 0x71, 0xC0, 0x1C, 0xE7,
+0x54, 0x41, 0xC1, 0x75, 0xB5, 0xBE, 0xF7, 0x58, 0x71, 0xC0, 0x92, 0x94, 0x64, 0x71, 0x01, 0x7C,
+0xC0, 0xDF, 0xFF, 0x5F, 0xC0, 0x3C, 0xE7, 0x69, 0x4D, 0x71, 0x7D, 0xC0, 0x10, 0x84, 0x51, 0x71,
+0x60, 0x51, 0xC0, 0x75, 0xB5, 0x5C, 0x54, 0x5C, 0x71, 0x55, 0x49, 0x60, 0x7C, 0x65, 0x63, 0x55,
+0x68, 0xC0, 0xF7, 0xC5, 0x6D, 0x65, 0x71, 0x30, 0x63, 0x81, 0xC4, 0xCF, 0x7B, 0x2C, 0x63, 0x00,
+0x00, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B,
+0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63, 0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52,
+0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0xC0, 0x51, 0x8C, 0x6C, 0xC0, 0x10, 0x84,
+0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44,
+0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0xC0, 0xA2, 0x10, 0xA6, 0xC0, 0x9E, 0xF7,
+0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B,
+0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x16, 0x49, 0x7C, 0xC1, 0x1C, 0xE7,
+0x92, 0x94, 0x7C, 0x71, 0x00, 0xC0, 0x3C, 0xE7, 0x51, 0xC0, 0x10, 0x84, 0x51, 0x41, 0xC0, 0x18,
+0xC6, 0x69, 0x7C, 0x00, 0xC0, 0xBE, 0xF7, 0x48, 0x7D, 0x65, 0x60, 0xC0, 0x96, 0xB5, 0x59, 0x4D,
+0x7C, 0x75, 0x63, 0x78, 0x01, 0x79, 0x50, 0xC0, 0xDF, 0xFF, 0x5D, 0xC0, 0x71, 0x94, 0x58, 0x6F,
+0x68, 0xC3, 0x5D, 0xEF, 0xB2, 0x9C, 0xD7, 0xBD, 0x59, 0xCE, 0x79, 0x7D, 0x59, 0x49, 0x71, 0x00,
+0x59, 0x5D, 0x7D, 0x79, 0x64, 0x48, 0x5D, 0x73, 0x74, 0x70, 0x71, 0x50, 0xC0, 0xDB, 0xDE, 0x50,
+0x79, 0x50, 0x71, 0x00, 0x7C, 0x61, 0x7D, 0x70, 0x60, 0x7C, 0x70, 0x4D, 0x44, 0x70, 0x6C, 0x71,
+0x30, 0x63, 0x81, 0xC4, 0xCF, 0x7B, 0x2C, 0x63, 0x00, 0x00, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0,
+0xDF, 0xFF, 0x47, 0x6B, 0x44, 0xC0, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63,
+0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40,
+0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58,
+0xC0, 0x9A, 0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D,
+0xA6, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73, 0x40, 0x70,
+0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x17, 0x79,
+0xC0, 0xD7, 0xBD, 0x4D, 0xC0, 0x75, 0xB5, 0x58, 0x71, 0xC1, 0xFB, 0xE6, 0x18, 0xC6, 0x79, 0x5C,
+0x6C, 0x65, 0x7D, 0x5B, 0x48, 0xC0, 0x96, 0xB5, 0x60, 0x65, 0x79, 0xA1, 0x51, 0xA1, 0xC0, 0x59,
+0xCE, 0x4D, 0x4C, 0x79, 0x65, 0x79, 0x60, 0x79, 0x7D, 0x58, 0x71, 0x5C, 0x7D, 0x51, 0x61, 0x78,
+0x4C, 0x49, 0x71, 0x60, 0x64, 0x4C, 0x65, 0x71, 0x49, 0x50, 0xC1, 0x1C, 0xE7, 0xBE, 0xF7, 0x40,
+0x79, 0x48, 0xC0, 0x3C, 0xE7, 0x48, 0x7D, 0x79, 0x71, 0x75, 0x4C, 0x79, 0xC0, 0x3D, 0xEF, 0x6C,
+0x71, 0x00, 0x6C, 0x70, 0x40, 0x78, 0xC0, 0xBA, 0xDE, 0x4C, 0x01, 0x75, 0x69, 0x58, 0x71, 0x30,
+0x63, 0x81, 0xC4, 0xCF, 0x7B, 0x2C, 0x63, 0x00, 0x00, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF,
+0xFF, 0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC5, 0x0C, 0x63,
+0x65, 0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0xF0, 0x7B, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40,
+0xBF, 0x54, 0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58,
+0xC0, 0x9A, 0xD6, 0x71, 0xC0, 0x2D, 0x6B, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C,
+0x54, 0x6D, 0xA6, 0xC0, 0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0xC0, 0xAE, 0x73,
+0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71,
+0xE0, 0x55, 0x63, 0x4C, 0x6C, 0x75, 0x40, 0xC0, 0x8E, 0x73, 0x74, 0x60, 0xC0, 0xDF, 0xFF, 0x47,
+0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65, 0x29,
+0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54, 0x6C,
+0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A, 0xD6,
+0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0, 0x9E,
+0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0x5D, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B, 0x7B,
+0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x3A, 0xA6, 0x71, 0x00, 0x6C, 0x71, 0xE0,
+0x15, 0x63, 0x4C, 0xC0, 0xCF, 0x7B, 0x75, 0x40, 0xC0, 0x8E, 0x73, 0x74, 0x60, 0xC0, 0xDF, 0xFF,
+0x47, 0x6B, 0xC1, 0x5D, 0xEF, 0xCF, 0x7B, 0x67, 0x65, 0x71, 0x43, 0x74, 0xC4, 0x0C, 0x63, 0x65,
+0x29, 0x10, 0x84, 0x00, 0x00, 0x8A, 0x52, 0x78, 0x40, 0xBE, 0x6C, 0x53, 0x58, 0x40, 0xBF, 0x54,
+0x6C, 0xC0, 0x10, 0x84, 0x4C, 0x6C, 0x78, 0x5C, 0xC0, 0x31, 0x8C, 0x7D, 0x71, 0x58, 0xC0, 0x9A,
+0xD6, 0x71, 0x7F, 0x44, 0x58, 0xC0, 0x00, 0x00, 0x58, 0x00, 0x44, 0x6C, 0x54, 0x6D, 0x68, 0xC0,
+0x9E, 0xF7, 0x54, 0x79, 0x54, 0xC0, 0x75, 0xAD, 0x71, 0x5D, 0x40, 0x70, 0x44, 0xC0, 0x4D, 0x6B,
+0x7B, 0x54, 0x67, 0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0xC0, 0xD7, 0xBD, 0x5C, 0xC1,
+0x3C, 0xE7, 0x59, 0xCE, 0x50, 0x4C, 0x74, 0x7D, 0x4C, 0xC0, 0x1C, 0xE7, 0x71, 0x5C, 0x69, 0x71,
+0x5C, 0x69, 0xC0, 0xBE, 0xF7, 0x48, 0x71, 0x07, 0x4C, 0x7D, 0x48, 0x71, 0x00, 0x5D, 0x51, 0xC0,
+0x96, 0xB5, 0x70, 0x71, 0x00, 0x73, 0x70, 0x71, 0x69, 0x75, 0x71, 0xE0, 0x14, 0x63, 0x81, 0x6C,
+0xC0, 0x2C, 0x63, 0x40, 0xC1, 0x8E, 0x73, 0x49, 0x4A, 0x60, 0xC3, 0xDF, 0xFF, 0x45, 0x29, 0xAB,
+0x5A, 0x5D, 0xEF, 0x58, 0x53, 0xC0, 0x18, 0xC6, 0x71, 0xC0, 0x28, 0x42, 0xA1, 0xC2, 0xCB, 0x5A,
+0x04, 0x21, 0xCF, 0x7B, 0x40, 0x74, 0x67, 0x40, 0x00, 0xC0, 0xAF, 0x73, 0x7F, 0xAE, 0x40, 0x00,
+0xC0, 0x10, 0x84, 0x58, 0x7B, 0x4C, 0x6C, 0x67, 0xC0, 0xDB, 0xDE, 0x40, 0x78, 0x71, 0x44, 0x79,
+0x71, 0x6B, 0xC0, 0x3D, 0xEF, 0x44, 0xC0, 0x00, 0x00, 0x44, 0x00, 0xC0, 0x5D, 0xEF, 0x58, 0x45,
+0xC0, 0x21, 0x08, 0x99, 0xC2, 0x9E, 0xF7, 0x30, 0x84, 0x59, 0xCE, 0x4C, 0xC0, 0x55, 0xAD, 0x71,
+0xC0, 0xAE, 0x73, 0x40, 0xC0, 0x0C, 0x63, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0xC0, 0x51, 0x8C, 0x67,
+0x71, 0x10, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0xC0, 0x14, 0xA5, 0x48, 0xC0, 0x3C, 0xE7, 0x74,
+0xC0, 0x31, 0x8C, 0x79, 0xC1, 0xFB, 0xE6, 0xB2, 0x94, 0x78, 0x7D, 0x71, 0x61, 0xC3, 0x6D, 0x73,
+0x5D, 0xEF, 0x34, 0xAD, 0x92, 0x94, 0x49, 0x74, 0xC0, 0x1C, 0xE7, 0x51, 0xC1, 0x38, 0xC6, 0xD7,
+0xBD, 0x79, 0x60, 0x5C, 0x71, 0x00, 0x7C, 0x7D, 0x41, 0x71, 0x00, 0x50, 0x79, 0x44, 0x48, 0x51,
+0x5C, 0xC0, 0xB6, 0xBD, 0x7C, 0x48, 0x69, 0x70, 0x61, 0x40, 0x49, 0x71, 0xE0, 0x11, 0x63, 0x81,
+0x6C, 0xC3, 0x2C, 0x63, 0x00, 0x00, 0x8E, 0x73, 0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x77, 0xC2,
+0x55, 0xAD, 0x9E, 0xF7, 0xD7, 0xBD, 0x00, 0xC0, 0xFB, 0xE6, 0x71, 0x55, 0x50, 0xC0, 0x55, 0xAD,
+0x6D, 0x65, 0xC0, 0xEF, 0x7B, 0x55, 0x51, 0x45, 0xA6, 0x4C, 0x7D, 0x4C, 0x40, 0x7B, 0xC0, 0x18,
+0xC6, 0x51, 0x40, 0x45, 0x67, 0x4C, 0x44, 0x60, 0x5C, 0xC0, 0xFF, 0xFF, 0x7D, 0xC0, 0x3C, 0xE7,
+0x71, 0xC3, 0xB6, 0xBD, 0xBE, 0xFF, 0xB7, 0xBD, 0xEF, 0x7B, 0x5B, 0x4C, 0x58, 0x47, 0xC0, 0x18,
+0xC6, 0x54, 0x45, 0xC1, 0xBE, 0xF7, 0x59, 0xCE, 0x44, 0x60, 0x48, 0xC3, 0xFF, 0xFF, 0xAE, 0x73,
+0x00, 0x00, 0x0C, 0x63, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x03, 0x6C, 0x71, 0x0A,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0x64, 0x61, 0x49, 0xC1, 0x7A, 0xD6, 0x1C, 0xE7, 0x63, 0x60,
+0x7C, 0x64, 0x69, 0x71, 0x75, 0x64, 0xC0, 0xF3, 0xA4, 0x7D, 0x69, 0x58, 0x7C, 0x50, 0x49, 0x47,
+0x90, 0x44, 0x61, 0x44, 0x61, 0x4D, 0x41, 0x69, 0x41, 0xC0, 0xDF, 0xFF, 0x71, 0x54, 0x58, 0x71,
+0x75, 0x4C, 0x50, 0x4C, 0x48, 0x55, 0x4B, 0x5C, 0x68, 0x5F, 0x79, 0x71, 0xE0, 0x0C, 0x70, 0x74,
+0x43, 0xC0, 0xBB, 0xDE, 0x6C, 0x63, 0x81, 0xC1, 0xCF, 0x7B, 0x2C, 0x63, 0x40, 0xC1, 0x8E, 0x73,
+0x49, 0x4A, 0x91, 0xC0, 0xDF, 0xFF, 0x71, 0x01, 0xC0, 0x9D, 0xF7, 0x6C, 0x71, 0x00, 0x6C, 0x91,
+0x71, 0x6C, 0xC0, 0x59, 0xCE, 0x58, 0x71, 0x6C, 0x48, 0x49, 0x71, 0x00, 0x4D, 0x70, 0x71, 0x01,
+0x54, 0x91, 0x5D, 0x71, 0x01, 0x61, 0x79, 0x71, 0xC0, 0x5D, 0xEF, 0x74, 0x48, 0x4D, 0x71, 0xA5,
+0x74, 0xC0, 0xBE, 0xF7, 0x71, 0x01, 0x58, 0x71, 0x6C, 0x48, 0x5C, 0x71, 0x01, 0xC2, 0xAE, 0x73,
+0x00, 0x00, 0x0C, 0x63, 0x44, 0xC0, 0x4D, 0x6B, 0x7B, 0x54, 0x67, 0x71, 0x01, 0x48, 0x4D, 0x71,
+0x0B, 0xC0, 0xB2, 0x9C, 0x00, 0x71, 0x14, 0xC0, 0x18, 0xC6, 0x55, 0x60, 0x74, 0x60, 0x91, 0x7C,
+0xC0, 0x71, 0x94, 0x60, 0x50, 0x71, 0x79, 0x4C, 0x54, 0x60, 0x6D, 0xC0, 0x5D, 0xEF, 0x68, 0x41,
+0x79, 0x7D, 0x00, 0x4C, 0xAE, 0x55, 0x44, 0x91, 0x59, 0x60, 0x7C, 0x58, 0x71, 0x4C, 0x69, 0x74,
+0x68, 0x55, 0x41, 0x78, 0xA5, 0x4C, 0x68, 0x79, 0x4B, 0x79, 0x58, 0x71, 0xE0, 0x0C, 0x78, 0xC3,
+0x2D, 0x63, 0xAB, 0x5A, 0x08, 0x42, 0xBE, 0xF7, 0x68, 0x45, 0xC1, 0xCF, 0x7B, 0x0C, 0x63, 0x40,
+0xC2, 0x8E, 0x73, 0x49, 0x4A, 0xE8, 0x41, 0x71, 0x01, 0x4C, 0xC1, 0x6A, 0x52, 0x3D, 0xE7, 0x71,
+0x00, 0xC0, 0x6D, 0x73, 0x68, 0xC0, 0xDF, 0xFF, 0x53, 0x58, 0xC3, 0x2D, 0x63, 0x3C, 0xE7, 0xEF,
+0x83, 0x6D, 0x6B, 0x70, 0x61, 0xC1, 0xF3, 0xA4, 0x2C, 0x63, 0x70, 0xC0, 0xD7, 0xBD, 0x71, 0x00,
+0x54, 0x91, 0xC0, 0xAE, 0x73, 0x71, 0x00, 0xC0, 0xF7, 0xC5, 0x70, 0xC3, 0x4D, 0x6B, 0xD3, 0x9C,
+0x38, 0xCE, 0x2D, 0x63, 0x6B, 0xC2, 0xC7, 0x39, 0x7A, 0xD6, 0x2C, 0x6B, 0x44, 0x58, 0xC0, 0x7E,
+0xEF, 0x71, 0xC1, 0x34, 0xAD, 0xCC, 0x5A, 0x71, 0xC1, 0xD2, 0x9C, 0x2D, 0x6B, 0x6B, 0xC0, 0xF8,
+0xBD, 0x71, 0x00, 0xC1, 0x8E, 0x73, 0x00, 0x00, 0x70, 0xC2, 0x5D, 0xEF, 0x4D, 0x6B, 0xF0, 0x7B,
+0x4F, 0x67, 0x71, 0x00, 0xC0, 0x95, 0xB5, 0x6B, 0x95, 0xC1, 0xB7, 0xB5, 0xFF, 0xFF, 0x0A, 0xC0,
+0xB2, 0x9C, 0x00, 0x71, 0x15, 0xC0, 0xBB, 0xDE, 0xAE, 0x71, 0x61, 0x5C, 0xC0, 0xBE, 0xF7, 0x61,
+0x00, 0x5D, 0x71, 0xC0, 0x7D, 0xEF, 0xA1, 0x5D, 0xA6, 0xC0, 0x1C, 0xE7, 0x5D, 0xC0, 0x3C, 0xE7,
+0x58, 0x4D, 0x70, 0xC0, 0x5D, 0xEF, 0x71, 0x61, 0x58, 0x71, 0x00, 0x70, 0x5C, 0xC0, 0x7D, 0xF7,
+0x71, 0x01, 0x5C, 0x00, 0x44, 0x70, 0x00, 0x49, 0x61, 0x5D, 0x75, 0x5D, 0x49, 0x4D, 0x5D, 0x71,
+0xE0, 0x0B, 0x6C, 0x71, 0x00, 0xC1, 0x30, 0x8C, 0x15, 0xA5, 0x71, 0xC0, 0x51, 0x8C, 0x91, 0xC0,
+0x8E, 0x73, 0x6B, 0xC1, 0x00, 0x00, 0x4D, 0x6B, 0x60, 0x91, 0x71, 0x00, 0x70, 0x74, 0xC0, 0x8A,
+0x52, 0x75, 0x71, 0xC0, 0x96, 0xB5, 0x60, 0xC2, 0xB3, 0x94, 0x9E, 0xF7, 0xEB, 0x62, 0x79, 0xC1,
+0x0C, 0x6B, 0x59, 0xCE, 0x6F, 0x49, 0x44, 0xC0, 0xD7, 0xBD, 0x79, 0xC0, 0x5D, 0xEF, 0x54, 0xC0,
+0xB3, 0x94, 0x71, 0x00, 0xC0, 0x10, 0x84, 0x7B, 0x53, 0x71, 0x00, 0xC1, 0xF3, 0xA4, 0x31, 0x84,
+0x78, 0xC0, 0x6E, 0x6B, 0x71, 0x00, 0xC4, 0xB2, 0x9C, 0x14, 0xA5, 0x95, 0xB5, 0xCF, 0x7B, 0xFF,
+0xFF, 0x6C, 0xC1, 0xB7, 0xB5, 0x1C, 0xE7, 0x64, 0xAF, 0x71, 0x6C, 0x5F, 0xC1, 0x30, 0x8C, 0xD3,
+0x9C, 0x71, 0x00, 0x53, 0xC3, 0x00, 0x00, 0xCB, 0x5A, 0x3D, 0xEF, 0x2D, 0x63, 0x6C, 0xC1, 0x10,
+0x84, 0x8E, 0x73, 0x71, 0x00, 0xC1, 0x2C, 0x6B, 0xDB, 0xDE, 0xA5, 0xC0, 0x4D, 0x6B, 0x71, 0x0A,
+0xC0, 0xB2, 0x9C, 0x00, 0x71, 0xE0, 0x51, 0x50, 0xC1, 0x0C, 0x63, 0xDF, 0xFF, 0x71, 0xC0, 0x9A,
+0xD6, 0x79, 0xA6, 0x91, 0xC0, 0xD3, 0x9C, 0x6F, 0xC0, 0xB7, 0xB5, 0x7D, 0x71, 0x00, 0x6C, 0x00,
+0x58, 0xC0, 0x3D, 0xE7, 0x48, 0x4F, 0x5F, 0xC0, 0xB3, 0x94, 0x6C, 0x78, 0xC0, 0xAB, 0x5A, 0x00,
+0x7C, 0x71, 0x55, 0xC1, 0x29, 0x4A, 0x39, 0xCE, 0x71, 0x60, 0xC1, 0x29, 0x4A, 0x56, 0xAD, 0x71,
+0x00, 0x48, 0x79, 0xA6, 0x71, 0x00, 0xC3, 0xD7, 0xBD, 0x49, 0x4A, 0x8A, 0x52, 0x92, 0x94, 0x71,
+0xC1, 0x1B, 0xE7, 0xEC, 0x5A, 0x5D, 0xC4, 0x99, 0xD6, 0xCB, 0x5A, 0x55, 0xAD, 0x6A, 0x52, 0x14,
+0x9D, 0x4F, 0xC1, 0xF7, 0xC5, 0x8E, 0x7B, 0x71, 0xC0, 0xB2, 0x9C, 0x43, 0x74, 0xC0, 0xF8, 0xBD,
+0x71, 0x00, 0xC0, 0x59, 0xCE, 0x77, 0x60, 0x5D, 0xC0, 0x38, 0xC6, 0x74, 0xC0, 0x9A, 0xD6, 0x74,
+0x71, 0x6C, 0xC0, 0xEC, 0x62, 0x49, 0x75, 0xC0, 0x0C, 0x63, 0x71, 0x0A, 0xC0, 0xB2, 0x9C, 0x00,
+0x71, 0xE0, 0x51, 0xC1, 0x71, 0x94, 0xF4, 0x9C, 0x71, 0x0C, 0xC1, 0x6D, 0x73, 0x5D, 0xEF, 0x40,
+0xC1, 0x09, 0x42, 0x49, 0x4A, 0x96, 0xC1, 0x14, 0xA5, 0xAF, 0x7B, 0x71, 0x5C, 0x77, 0x61, 0x71,
+0x64, 0xC2, 0xF0, 0x7B, 0xDB, 0xDE, 0xDF, 0xFF, 0x79, 0xC0, 0x2D, 0x63, 0x6C, 0x71, 0x04, 0x5B,
+0x58, 0xC1, 0x9E, 0xF7, 0x0C, 0x63, 0x58, 0xC1, 0x13, 0xA5, 0x72, 0x8C, 0x71, 0x6C, 0xC2, 0x76,
+0xB5, 0xB3, 0x94, 0x8E, 0x73, 0x00, 0xC3, 0xE8, 0x39, 0xEB, 0x62, 0x45, 0x29, 0x55, 0xAD, 0x70,
+0xC2, 0x9E, 0xEF, 0x59, 0xCE, 0x4D, 0x6B, 0x71, 0x0A, 0xC1, 0x2C, 0x6B, 0x1C, 0xE7, 0x61, 0x44,
+0x71, 0x0A, 0xC0, 0xB2, 0x9C, 
+};
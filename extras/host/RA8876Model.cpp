@@ -0,0 +1,738 @@
+//**************************************************************//
+/*
+ * RA8876Model.cpp
+ * A software RA8876 for the host build, see RA8876Model.h
+ */
+//**************************************************************//
+#include "RA8876Model.h"
+#include "RA8876Registers.h"
+
+#define QUADRANT_UL	1
+#define QUADRANT_UR	2
+#define QUADRANT_BL	4
+#define QUADRANT_BR	8
+
+RA8876Model::RA8876Model(uint32_t sdram_size)
+{
+	_sdramSize = sdram_size;
+	_sdram = (uint8_t *)malloc(sdram_size);
+	reset();
+}
+
+RA8876Model::~RA8876Model()
+{
+	free(_sdram);
+}
+
+//**************************************************************//
+// Power on state, SDRAM cleared
+//**************************************************************//
+void RA8876Model::reset(void)
+{
+	memset(_regs, 0, sizeof(_regs));
+	_regs[0xff] = 0x76;		// chip ID
+	if(_sdram) memset(_sdram, 0, _sdramSize);
+	_selected = 0;
+	_curX = _curY = 0;
+	_memHalf = false;
+	_readDummy = true;
+	_readHalf = false;
+	_busy = 0;
+	_intf = 0;
+	_bteMpuActive = false;
+	resetStats();
+}
+
+void RA8876Model::resetStats(void)
+{
+	memset(&_stats, 0, sizeof(_stats));
+}
+
+void RA8876Model::printStats(Print &pr)
+{
+	pr.printf("Model SDRAM pixels read: %lu written: %lu memory port reads: %lu writes: %lu\n",
+			  (unsigned long)_stats.sdramReads, (unsigned long)_stats.sdramWrites,
+			  (unsigned long)_stats.memPortReads, (unsigned long)_stats.memPortWrites);
+	pr.printf("  Geometry ops: %lu BTE ops:", (unsigned long)_stats.geometryOps);
+	for(uint8_t op = 0; op < 16; op++) {
+		if(_stats.bteOps[op]) pr.printf(" %u:%lu", op, (unsigned long)_stats.bteOps[op]);
+	}
+	pr.println();
+	pr.printf("  Status reads: %lu XnINTR reads: %lu started while busy: %lu written while busy: %lu\n",
+			  (unsigned long)_stats.statusReads, (unsigned long)_stats.intPinReads,
+			  (unsigned long)_stats.busyStarts, (unsigned long)_stats.busyWrites);
+	pr.printf("  Text mode writes: %lu unsupported: %lu out of range: %lu\n",
+			  (unsigned long)_stats.textWrites, (unsigned long)_stats.unsupported,
+			  (unsigned long)_stats.outOfRange);
+}
+
+//**************************************************************//
+// Bus cycles
+//**************************************************************//
+void RA8876Model::writeCommand(uint8_t reg)
+{
+	_selected = reg;
+	if(reg == RA8876_MRWDP) {
+		_readDummy = true;
+		_readHalf = false;
+		_memHalf = false;
+	}
+}
+
+void RA8876Model::writeData(uint8_t data)
+{
+	switch(_selected) {
+		case RA8876_MRWDP:
+			if(_bteMpuActive) _bteMpuData(data);
+			else if(_textMode()) _stats.textWrites++;
+			else _memWrite(data);
+			return;
+		case RA8876_INTF:
+			_intf &= ~data;		// write 1 to clear
+			return;
+	}
+	_regs[_selected] = data;
+	switch(_selected) {
+		case RA8876_CURH0:
+		case RA8876_CURH1:
+		case RA8876_CURV0:
+		case RA8876_CURV1:
+			_cursorLoad();
+			_readDummy = true;
+			_readHalf = false;
+			_memHalf = false;
+			break;
+		case RA8876_DCR0:
+			if(data & 0x80) _geometry0(data);
+			break;
+		case RA8876_DCR1:
+			if(data & 0x80) _geometry1(data);
+			break;
+		case RA8876_BTE_CTRL0:
+			if(data & (RA8876_BTE_ENABLE << 4)) _bteStart();
+			break;
+		case RA8876_DMA_CTRL:
+			if(data & RA8876_DMA_START) {
+				_stats.unsupported++;	// no serial flash
+				_regs[_selected] &= ~RA8876_DMA_START;
+			}
+			break;
+	}
+}
+
+uint8_t RA8876Model::readData(void)
+{
+	switch(_selected) {
+		case RA8876_MRWDP:
+			return _memRead();
+		case RA8876_INTF:
+			return _intf | (1 << RA8876_INT_VSYNC);	// there is always a frame just gone
+	}
+	return _regs[_selected];
+}
+
+uint8_t RA8876Model::readStatus(void)
+{
+	// Write FIFO empty, SDRAM ready, and busy while the engine is
+	uint8_t status = 0x44 | (busy() ? 0x08 : 0);
+	_stats.statusReads++;
+	if(_busy && (--_busy == 0)) _engineDone();
+	return status;
+}
+
+bool RA8876Model::intPin(void)
+{
+	bool high = !(_intf & _regs[RA8876_INTEN] & ~_regs[RA8876_MINTFR]);
+	_stats.intPinReads++;
+	if(_busy && (--_busy == 0)) _engineDone();
+	return high;
+}
+
+//**************************************************************//
+// SDRAM, 16bpp pixels are stored low byte first
+//**************************************************************//
+uint16_t RA8876Model::_read16(uint32_t addr)
+{
+	if(addr + 1 >= _sdramSize) {
+		_stats.outOfRange++;
+		return 0;
+	}
+	_stats.sdramReads++;
+	return _sdram[addr] | (_sdram[addr + 1] << 8);
+}
+
+void RA8876Model::_write16(uint32_t addr, uint16_t color)
+{
+	if(addr + 1 >= _sdramSize) {
+		_stats.outOfRange++;
+		return;
+	}
+	_stats.sdramWrites++;
+	_sdram[addr] = color;
+	_sdram[addr + 1] = color >> 8;
+}
+
+uint16_t RA8876Model::getPixel(uint32_t addr, uint16_t image_width, uint16_t x, uint16_t y)
+{
+	addr += ((uint32_t)y * image_width + x) * 2;
+	if(addr + 1 >= _sdramSize) return 0;
+	return _sdram[addr] | (_sdram[addr + 1] << 8);
+}
+
+void RA8876Model::setPixel(uint32_t addr, uint16_t image_width, uint16_t x, uint16_t y, uint16_t color)
+{
+	addr += ((uint32_t)y * image_width + x) * 2;
+	if(addr + 1 >= _sdramSize) return;
+	_sdram[addr] = color;
+	_sdram[addr + 1] = color >> 8;
+}
+
+uint16_t RA8876Model::_color(uint8_t reg)
+{
+	return ((_regs[reg] >> 3) << 11) | ((_regs[reg + 1] >> 2) << 5) | (_regs[reg + 2] >> 3);
+}
+
+//**************************************************************//
+// The canvas, clipped to the active window
+//**************************************************************//
+void RA8876Model::_canvasPlot(int32_t x, int32_t y, uint16_t color)
+{
+	int32_t aw_x = _reg16(RA8876_AWUL_X0), aw_y = _reg16(RA8876_AWUL_Y0);
+	if((x < aw_x) || (y < aw_y) || (x >= aw_x + (int32_t)_reg16(RA8876_AW_WTH0)) ||
+	   (y >= aw_y + (int32_t)_reg16(RA8876_AW_HT0))) return;
+	_write16(_reg32(RA8876_CVSSA0) + ((uint32_t)y * _reg16(RA8876_CVS_IMWTH0) + x) * 2, color);
+}
+
+void RA8876Model::_canvasSpan(int32_t x0, int32_t x1, int32_t y, uint16_t color)
+{
+	if(x0 > x1) {
+		int32_t t = x0;
+		x0 = x1;
+		x1 = t;
+	}
+	for(int32_t x = x0; x <= x1; x++) _canvasPlot(x, y, color);
+}
+
+//**************************************************************//
+// Memory data port. The cursor moves in the MACR direction and
+// wraps inside the active window.
+//**************************************************************//
+void RA8876Model::_cursorLoad(void)
+{
+	_curX = _reg16(RA8876_CURH0);
+	_curY = _reg16(RA8876_CURV0);
+}
+
+void RA8876Model::_cursorStore(void)
+{
+	_regs[RA8876_CURH0] = _curX;
+	_regs[RA8876_CURH1] = _curX >> 8;
+	_regs[RA8876_CURV0] = _curY;
+	_regs[RA8876_CURV1] = _curY >> 8;
+}
+
+void RA8876Model::_cursorAdvance(uint8_t direction)
+{
+	uint16_t x0 = _reg16(RA8876_AWUL_X0), y0 = _reg16(RA8876_AWUL_Y0);
+	uint16_t x1 = x0 + _reg16(RA8876_AW_WTH0) - 1, y1 = y0 + _reg16(RA8876_AW_HT0) - 1;
+	switch(direction) {
+		case RA8876_WRITE_MEMORY_LRTB:
+			if(_curX >= x1) {
+				_curX = x0;
+				_curY = (_curY >= y1) ? y0 : _curY + 1;
+			} else _curX++;
+			break;
+		case RA8876_WRITE_MEMORY_RLTB:
+			if(_curX <= x0) {
+				_curX = x1;
+				_curY = (_curY >= y1) ? y0 : _curY + 1;
+			} else _curX--;
+			break;
+		case RA8876_WRITE_MEMORY_TBLR:
+			if(_curY >= y1) {
+				_curY = y0;
+				_curX = (_curX >= x1) ? x0 : _curX + 1;
+			} else _curY++;
+			break;
+		case RA8876_WRITE_MEMORY_BTLR:
+			if(_curY <= y0) {
+				_curY = y1;
+				_curX = (_curX >= x1) ? x0 : _curX + 1;
+			} else _curY--;
+			break;
+	}
+	_cursorStore();
+}
+
+void RA8876Model::_memWrite(uint8_t data)
+{
+	if(busy()) _stats.busyWrites++;
+	if(_linear()) {
+		uint32_t addr = _reg32(RA8876_CURH0);
+		if(addr < _sdramSize) _sdram[addr] = data;
+		else _stats.outOfRange++;
+		_stats.memPortWrites++;
+		addr++;
+		for(uint8_t i = 0; i < 4; i++) _regs[RA8876_CURH0 + i] = addr >> (i * 8);
+		return;
+	}
+	if(!_memHalf) {
+		_memByte = data;
+		_memHalf = true;
+		return;
+	}
+	_memHalf = false;
+	_stats.memPortWrites++;
+	if((_regs[RA8876_AW_COLOR] & 0x03) != RA8876_CANVAS_COLOR_DEPTH_16BPP) {
+		_stats.unsupported++;
+		return;
+	}
+	_canvasPlot(_curX, _curY, _memByte | (data << 8));
+	_cursorAdvance((_regs[RA8876_MACR] >> 1) & 0x03);
+}
+
+uint8_t RA8876Model::_memRead(void)
+{
+	if(_readDummy) {
+		_readDummy = false;
+		return 0;
+	}
+	if(_linear()) {
+		uint32_t addr = _reg32(RA8876_CURH0);
+		uint8_t data = 0;
+		if(addr < _sdramSize) data = _sdram[addr];
+		else _stats.outOfRange++;
+		_stats.memPortReads++;
+		addr++;
+		for(uint8_t i = 0; i < 4; i++) _regs[RA8876_CURH0 + i] = addr >> (i * 8);
+		return data;
+	}
+	if(_readHalf) {
+		_readHalf = false;
+		_cursorAdvance((_regs[RA8876_MACR] >> 4) & 0x03);
+		return _readPixel >> 8;
+	}
+	_stats.memPortReads++;
+	_readPixel = _read16(_reg32(RA8876_CVSSA0) + ((uint32_t)_curY * _reg16(RA8876_CVS_IMWTH0) + _curX) * 2);
+	_readHalf = true;
+	return _readPixel;
+}
+
+//**************************************************************//
+// Core task busy, for _busyPolls status reads after it starts
+//**************************************************************//
+void RA8876Model::_engineStart(void)
+{
+	_busy = _busyPolls;
+	if(!_busy) _engineDone();
+}
+
+void RA8876Model::_engineDone(void)
+{
+	_busy = 0;
+	_regs[RA8876_DCR0] &= ~0x80;
+	_regs[RA8876_DCR1] &= ~0x80;
+	_regs[RA8876_BTE_CTRL0] &= ~(RA8876_BTE_ENABLE << 4);
+	_intf |= 1 << RA8876_INT_CORE_TASK_DONE;
+}
+
+//**************************************************************//
+// Geometry engine, into the canvas with the foreground color
+//**************************************************************//
+void RA8876Model::_drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color)
+{
+	int32_t dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+	int32_t dy = -abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+	int32_t err = dx + dy;
+	while(true) {
+		_canvasPlot(x0, y0, color);
+		if((x0 == x1) && (y0 == y1)) break;
+		int32_t e2 = 2 * err;
+		if(e2 >= dy) {
+			err += dy;
+			x0 += sx;
+		}
+		if(e2 <= dx) {
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+// Whole ellipse or some of its quarters
+void RA8876Model::_drawEllipse(int32_t cx, int32_t cy, int32_t a, int32_t b, bool fill, uint8_t quadrants, uint16_t color)
+{
+	if(!a || !b) {
+		_drawLine(cx - a, cy - b, cx + a, cy + b, color);
+		return;
+	}
+	for(int32_t dy = 0; dy <= b; dy++) {
+		int32_t dx = lround(a * sqrt(1.0 - ((double)dy * dy) / ((double)b * b)));
+		if(fill) {
+			if(quadrants & QUADRANT_UL) _canvasSpan(cx - dx, cx, cy - dy, color);
+			if(quadrants & QUADRANT_UR) _canvasSpan(cx, cx + dx, cy - dy, color);
+			if(quadrants & QUADRANT_BL) _canvasSpan(cx - dx, cx, cy + dy, color);
+			if(quadrants & QUADRANT_BR) _canvasSpan(cx, cx + dx, cy + dy, color);
+			continue;
+		}
+		if(quadrants & QUADRANT_UL) _canvasPlot(cx - dx, cy - dy, color);
+		if(quadrants & QUADRANT_UR) _canvasPlot(cx + dx, cy - dy, color);
+		if(quadrants & QUADRANT_BL) _canvasPlot(cx - dx, cy + dy, color);
+		if(quadrants & QUADRANT_BR) _canvasPlot(cx + dx, cy + dy, color);
+	}
+	if(fill) return;
+	// and by column, so the steep parts are joined up
+	for(int32_t dx = 0; dx <= a; dx++) {
+		int32_t dy = lround(b * sqrt(1.0 - ((double)dx * dx) / ((double)a * a)));
+		if(quadrants & QUADRANT_UL) _canvasPlot(cx - dx, cy - dy, color);
+		if(quadrants & QUADRANT_UR) _canvasPlot(cx + dx, cy - dy, color);
+		if(quadrants & QUADRANT_BL) _canvasPlot(cx - dx, cy + dy, color);
+		if(quadrants & QUADRANT_BR) _canvasPlot(cx + dx, cy + dy, color);
+	}
+}
+
+// Lines and triangles
+void RA8876Model::_geometry0(uint8_t dcr0)
+{
+	if(busy()) _stats.busyStarts++;
+	_stats.geometryOps++;
+	if((_regs[RA8876_AW_COLOR] & 0x03) != RA8876_CANVAS_COLOR_DEPTH_16BPP) {
+		_stats.unsupported++;
+		_engineStart();
+		return;
+	}
+	uint16_t color = _color(RA8876_FGCR);
+	int32_t x[3] = {(int32_t)_reg16(RA8876_DLHSR0), (int32_t)_reg16(RA8876_DLHER0), (int32_t)_reg16(RA8876_DTPH0)};
+	int32_t y[3] = {(int32_t)_reg16(RA8876_DLVSR0), (int32_t)_reg16(RA8876_DLVER0), (int32_t)_reg16(RA8876_DTPV0)};
+	if(!(dcr0 & 0x02)) {
+		_drawLine(x[0], y[0], x[1], y[1], color);
+		_engineStart();
+		return;
+	}
+	if(dcr0 & 0x20) {
+		int32_t y_min = min(y[0], min(y[1], y[2])), y_max = max(y[0], max(y[1], y[2]));
+		for(int32_t row = y_min; row <= y_max; row++) {
+			int32_t x_min = INT32_MAX, x_max = INT32_MIN;
+			for(uint8_t i = 0; i < 3; i++) {
+				uint8_t j = (i + 1) % 3;
+				if((row < min(y[i], y[j])) || (row > max(y[i], y[j]))) continue;
+				int32_t xa = x[i], xb = x[j];
+				if(y[i] != y[j]) xa = xb = x[i] + lround((double)(row - y[i]) * (x[j] - x[i]) / (y[j] - y[i]));
+				x_min = min(x_min, min(xa, xb));
+				x_max = max(x_max, max(xa, xb));
+			}
+			if(x_min <= x_max) _canvasSpan(x_min, x_max, row, color);
+		}
+	}
+	for(uint8_t i = 0; i < 3; i++) _drawLine(x[i], y[i], x[(i + 1) % 3], y[(i + 1) % 3], color);
+	_engineStart();
+}
+
+// Ellipses, curves, rectangles and round rectangles
+void RA8876Model::_geometry1(uint8_t dcr1)
+{
+	static const uint8_t curve_quadrants[4] = {QUADRANT_BL, QUADRANT_UL, QUADRANT_UR, QUADRANT_BR};
+	if(busy()) _stats.busyStarts++;
+	_stats.geometryOps++;
+	if((_regs[RA8876_AW_COLOR] & 0x03) != RA8876_CANVAS_COLOR_DEPTH_16BPP) {
+		_stats.unsupported++;
+		_engineStart();
+		return;
+	}
+	uint16_t color = _color(RA8876_FGCR);
+	bool fill = (dcr1 & 0x40) != 0;
+	int32_t a = _reg16(RA8876_ELL_A0), b = _reg16(RA8876_ELL_B0);
+	int32_t x0 = _reg16(RA8876_DLHSR0), y0 = _reg16(RA8876_DLVSR0);
+	int32_t x1 = _reg16(RA8876_DLHER0), y1 = _reg16(RA8876_DLVER0);
+	if(x0 > x1) {
+		int32_t t = x0;
+		x0 = x1;
+		x1 = t;
+	}
+	if(y0 > y1) {
+		int32_t t = y0;
+		y0 = y1;
+		y1 = t;
+	}
+	switch((dcr1 >> 4) & 0x03) {
+		case 0:		// ellipse
+			_drawEllipse(_reg16(RA8876_DEHR0), _reg16(RA8876_DEVR0), a, b, fill, 0x0f, color);
+			break;
+		case 1:		// one quarter
+			_drawEllipse(_reg16(RA8876_DEHR0), _reg16(RA8876_DEVR0), a, b, fill, curve_quadrants[dcr1 & 0x03], color);
+			break;
+		case 2:		// rectangle
+			if(fill) {
+				for(int32_t row = y0; row <= y1; row++) _canvasSpan(x0, x1, row, color);
+			} else {
+				_canvasSpan(x0, x1, y0, color);
+				_canvasSpan(x0, x1, y1, color);
+				_drawLine(x0, y0, x0, y1, color);
+				_drawLine(x1, y0, x1, y1, color);
+			}
+			break;
+		case 3:		// round rectangle, a and b are the corner radii
+			a = min(a, (x1 - x0) / 2);
+			b = min(b, (y1 - y0) / 2);
+			if(fill) {
+				for(int32_t row = y0; row <= y1; row++) {
+					int32_t dy = (row < y0 + b) ? (y0 + b - row) : ((row > y1 - b) ? (row - (y1 - b)) : 0);
+					int32_t inset = b ? a - lround(a * sqrt(1.0 - ((double)dy * dy) / ((double)b * b))) : 0;
+					_canvasSpan(x0 + inset, x1 - inset, row, color);
+				}
+			} else {
+				_canvasSpan(x0 + a, x1 - a, y0, color);
+				_canvasSpan(x0 + a, x1 - a, y1, color);
+				_drawLine(x0, y0 + b, x0, y1 - b, color);
+				_drawLine(x1, y0 + b, x1, y1 - b, color);
+				_drawEllipse(x0 + a, y0 + b, a, b, false, QUADRANT_UL, color);
+				_drawEllipse(x1 - a, y0 + b, a, b, false, QUADRANT_UR, color);
+				_drawEllipse(x0 + a, y1 - b, a, b, false, QUADRANT_BL, color);
+				_drawEllipse(x1 - a, y1 - b, a, b, false, QUADRANT_BR, color);
+			}
+			break;
+	}
+	_engineStart();
+}
+
+//**************************************************************//
+// BTE. Copies go one pixel at a time in the order the chip does
+// them, so an overlapping copy the wrong way round comes out
+// smeared here too.
+//**************************************************************//
+uint16_t RA8876Model::_rop(uint8_t rop, uint16_t s0, uint16_t s1)
+{
+	switch(rop & 0x0f) {
+		case 0:  return 0;
+		case 1:  return ~(s0 | s1);
+		case 2:  return ~s0 & s1;
+		case 3:  return ~s0;
+		case 4:  return s0 & ~s1;
+		case 5:  return ~s1;
+		case 6:  return s0 ^ s1;
+		case 7:  return ~(s0 & s1);
+		case 8:  return s0 & s1;
+		case 9:  return ~(s0 ^ s1);
+		case 10: return s1;
+		case 11: return ~s0 | s1;
+		case 12: return s0;
+		case 13: return s0 | ~s1;
+		case 14: return s0 | s1;
+		default: return 0xffff;
+	}
+}
+
+// S1 is only read by the ROPs that use it
+static bool ropUsesS1(uint8_t rop)
+{
+	return (rop != 0) && (rop != 3) && (rop != 12) && (rop != 15);
+}
+
+bool RA8876Model::_bteDepthOk(void)
+{
+	uint8_t colr = _regs[RA8876_BTE_COLR];
+	if(((colr >> 5) & 0x03) != RA8876_S0_COLOR_DEPTH_16BPP) return false;
+	if((colr & 0x03) != RA8876_DESTINATION_COLOR_DEPTH_16BPP) return false;
+	uint8_t op = _regs[RA8876_BTE_CTRL1] & 0x0f;
+	bool uses_s1 = (op == RA8876_BTE_MEMORY_COPY_WITH_OPACITY) ||
+	               (((op <= RA8876_BTE_MEMORY_COPY_BACKWARDS_WITH_ROP) || (op == RA8876_BTE_PATTERN_FILL_WITH_ROP)) &&
+	                ropUsesS1(_regs[RA8876_BTE_CTRL1] >> 4));
+	return !uses_s1 || (((colr >> 2) & 0x07) == RA8876_S1_COLOR_DEPTH_16BPP);
+}
+
+void RA8876Model::_bteStart(void)
+{
+	uint8_t op = _regs[RA8876_BTE_CTRL1] & 0x0f;
+	uint8_t rop = _regs[RA8876_BTE_CTRL1] >> 4;
+	uint32_t w = _reg16(RA8876_BTE_WTH0), h = _reg16(RA8876_BTE_HIG0);
+	uint32_t s0 = _reg32(RA8876_S0_STR0), s0_w = _reg16(RA8876_S0_WTH0), s0_x = _reg16(RA8876_S0_X0), s0_y = _reg16(RA8876_S0_Y0);
+	uint32_t s1 = _reg32(RA8876_S1_STR0), s1_w = _reg16(RA8876_S1_WTH0), s1_x = _reg16(RA8876_S1_X0), s1_y = _reg16(RA8876_S1_Y0);
+	uint32_t dt = _reg32(RA8876_DT_STR0), dt_w = _reg16(RA8876_DT_WTH0), dt_x = _reg16(RA8876_DT_X0), dt_y = _reg16(RA8876_DT_Y0);
+	uint16_t bg = _color(RA8876_BGCR);
+
+	if(busy()) _stats.busyStarts++;
+	_stats.bteOps[op]++;
+	if(!_bteDepthOk()) {
+		_stats.unsupported++;
+		_engineStart();
+		return;
+	}
+	switch(op) {
+		case RA8876_BTE_MPU_WRITE_WITH_ROP:
+		case RA8876_BTE_MPU_WRITE_WITH_CHROMA:
+			_bteTotal = w * h;
+			break;
+		case RA8876_BTE_MPU_WRITE_COLOR_EXPANSION:
+		case RA8876_BTE_MPU_WRITE_COLOR_EXPANSION_WITH_CHROMA:
+			if(rop != RA8876_BTE_ROP_BUS_WIDTH8) {
+				_stats.unsupported++;
+				_engineStart();
+				return;
+			}
+			_bteTotal = ((w + 7) / 8) * h;	// bytes, rows padded
+			break;
+		case RA8876_BTE_MEMORY_COPY_WITH_ROP:
+		case RA8876_BTE_MEMORY_COPY_WITH_CHROMA:
+		case RA8876_BTE_MEMORY_COPY_WITH_OPACITY:
+			for(uint32_t row = 0; row < h; row++) {
+				for(uint32_t col = 0; col < w; col++) {
+					uint16_t p0 = _read16(s0 + ((s0_y + row) * s0_w + s0_x + col) * 2);
+					uint32_t dst = dt + ((dt_y + row) * dt_w + dt_x + col) * 2;
+					if(op == RA8876_BTE_MEMORY_COPY_WITH_CHROMA) {
+						if(p0 != bg) _write16(dst, p0);
+						continue;
+					}
+					uint16_t p1 = 0;
+					if((op == RA8876_BTE_MEMORY_COPY_WITH_OPACITY) || ropUsesS1(rop))
+						p1 = _read16(s1 + ((s1_y + row) * s1_w + s1_x + col) * 2);
+					if(op == RA8876_BTE_MEMORY_COPY_WITH_OPACITY) {
+						uint16_t alpha = min((uint16_t)_regs[RA8876_APB_CTRL], (uint16_t)32);
+						uint16_t r = (((p0 >> 11) & 0x1f) * alpha + ((p1 >> 11) & 0x1f) * (32 - alpha)) / 32;
+						uint16_t g = (((p0 >> 5) & 0x3f) * alpha + ((p1 >> 5) & 0x3f) * (32 - alpha)) / 32;
+						uint16_t b = ((p0 & 0x1f) * alpha + (p1 & 0x1f) * (32 - alpha)) / 32;
+						_write16(dst, (r << 11) | (g << 5) | b);
+					} else {
+						_write16(dst, _rop(rop, p0, p1));
+					}
+				}
+			}
+			_engineStart();
+			return;
+		case RA8876_BTE_MEMORY_COPY_BACKWARDS_WITH_ROP:
+			// The start points are the bottom right corners
+			for(uint32_t row = 0; row < h; row++) {
+				for(uint32_t col = 0; col < w; col++) {
+					uint16_t p0 = _read16(s0 + ((s0_y - row) * s0_w + s0_x - col) * 2);
+					uint16_t p1 = ropUsesS1(rop) ? _read16(s1 + ((s1_y - row) * s1_w + s1_x - col) * 2) : 0;
+					_write16(dt + ((dt_y - row) * dt_w + dt_x - col) * 2, _rop(rop, p0, p1));
+				}
+			}
+			_engineStart();
+			return;
+		case RA8876_BTE_PATTERN_FILL_WITH_ROP:
+		case RA8876_BTE_PATTERN_FILL_WITH_CHROMA:
+			{
+				uint32_t size = (_regs[RA8876_BTE_CTRL0] & RA8876_PATTERN_FORMAT16X16) ? 16 : 8;
+				for(uint32_t row = 0; row < h; row++) {
+					for(uint32_t col = 0; col < w; col++) {
+						uint16_t p0 = _read16(s0 + ((s0_y + row % size) * s0_w + s0_x + col % size) * 2);
+						uint32_t dst = dt + ((dt_y + row) * dt_w + dt_x + col) * 2;
+						if(op == RA8876_BTE_PATTERN_FILL_WITH_CHROMA) {
+							if(p0 != bg) _write16(dst, p0);
+							continue;
+						}
+						uint16_t p1 = ropUsesS1(rop) ? _read16(s1 + ((s1_y + row) * s1_w + s1_x + col) * 2) : 0;
+						_write16(dst, _rop(rop, p0, p1));
+					}
+				}
+			}
+			_engineStart();
+			return;
+		case RA8876_BTE_SOLID_FILL:
+			{
+				uint16_t fg = _color(RA8876_FGCR);
+				for(uint32_t row = 0; row < h; row++) {
+					for(uint32_t col = 0; col < w; col++) _write16(dt + ((dt_y + row) * dt_w + dt_x + col) * 2, fg);
+				}
+			}
+			_engineStart();
+			return;
+		default:
+			_stats.unsupported++;
+			_engineStart();
+			return;
+	}
+	// MPU writes, busy until the last of the data arrives
+	_bteOp = op;
+	_bteCount = 0;
+	_bteHalf = false;
+	_bteMpuActive = true;
+	if(!_bteTotal) _bteMpuDone();
+}
+
+void RA8876Model::_bteMpuPixel(uint16_t p0)
+{
+	uint32_t w = _reg16(RA8876_BTE_WTH0);
+	uint32_t col = _bteCount % w, row = _bteCount / w;
+	uint32_t dst = _reg32(RA8876_DT_STR0) + ((_reg16(RA8876_DT_Y0) + row) * _reg16(RA8876_DT_WTH0) + _reg16(RA8876_DT_X0) + col) * 2;
+	if(_bteOp == RA8876_BTE_MPU_WRITE_WITH_CHROMA) {
+		if(p0 != _color(RA8876_BGCR)) _write16(dst, p0);
+		return;
+	}
+	uint8_t rop = _regs[RA8876_BTE_CTRL1] >> 4;
+	uint16_t p1 = 0;
+	if(ropUsesS1(rop))
+		p1 = _read16(_reg32(RA8876_S1_STR0) + ((_reg16(RA8876_S1_Y0) + row) * _reg16(RA8876_S1_WTH0) + _reg16(RA8876_S1_X0) + col) * 2);
+	_write16(dst, _rop(rop, p0, p1));
+}
+
+void RA8876Model::_bteMpuData(uint8_t data)
+{
+	if((_bteOp == RA8876_BTE_MPU_WRITE_COLOR_EXPANSION) || (_bteOp == RA8876_BTE_MPU_WRITE_COLOR_EXPANSION_WITH_CHROMA)) {
+		// MSB first, 1 is the foreground color, 0 the background or nothing
+		uint32_t w = _reg16(RA8876_BTE_WTH0);
+		uint32_t row_bytes = (w + 7) / 8;
+		uint32_t row = _bteCount / row_bytes, col = (_bteCount % row_bytes) * 8;
+		uint32_t dst = _reg32(RA8876_DT_STR0) + ((_reg16(RA8876_DT_Y0) + row) * _reg16(RA8876_DT_WTH0) + _reg16(RA8876_DT_X0) + col) * 2;
+		uint16_t fg = _color(RA8876_FGCR), bg = _color(RA8876_BGCR);
+		for(uint8_t bit = 0; (bit < 8) && (col + bit < w); bit++, dst += 2) {
+			if(data & (0x80 >> bit)) _write16(dst, fg);
+			else if(_bteOp == RA8876_BTE_MPU_WRITE_COLOR_EXPANSION) _write16(dst, bg);
+		}
+		_stats.memPortWrites++;
+		if(++_bteCount == _bteTotal) _bteMpuDone();
+		return;
+	}
+	if(!_bteHalf) {
+		_bteByte = data;
+		_bteHalf = true;
+		return;
+	}
+	_bteHalf = false;
+	_stats.memPortWrites++;
+	_bteMpuPixel(_bteByte | (data << 8));
+	if(++_bteCount == _bteTotal) _bteMpuDone();
+}
+
+void RA8876Model::_bteMpuDone(void)
+{
+	_bteMpuActive = false;
+	_engineStart();
+}
+
+//**************************************************************//
+// The main window: display start address, image width and the
+// top left corner, the size of the panel
+//**************************************************************//
+uint16_t RA8876Model::panelWidth(void)
+{
+	return (_regs[RA8876_HDWR] + 1) * 8 + (_regs[RA8876_HDWFTR] & 0x07);
+}
+
+uint16_t RA8876Model::panelHeight(void)
+{
+	return _reg16(RA8876_VDHR0) + 1;
+}
+
+uint16_t RA8876Model::displayPixel(uint16_t x, uint16_t y)
+{
+	if(_regs[RA8876_DPCR] & 0x08) y = panelHeight() - 1 - y;	// scanning bottom to top
+	return getPixel(_reg32(RA8876_MISA0), _reg16(RA8876_MIW0), _reg16(RA8876_MWULX0) + x, _reg16(RA8876_MWULY0) + y);
+}
+
+bool RA8876Model::writePPM(const char *filename)
+{
+	FILE *f = fopen(filename, "wb");
+	if(!f) return false;
+	uint16_t w = panelWidth(), h = panelHeight();
+	fprintf(f, "P6\n%u %u\n255\n", w, h);
+	for(uint16_t y = 0; y < h; y++) {
+		for(uint16_t x = 0; x < w; x++) {
+			uint16_t color = displayPixel(x, y);
+			uint8_t rgb[3] = {(uint8_t)(((color >> 11) & 0x1f) * 255 / 31), (uint8_t)(((color >> 5) & 0x3f) * 255 / 63),
+			                  (uint8_t)((color & 0x1f) * 255 / 31)};
+			fwrite(rgb, 1, 3, f);
+		}
+	}
+	return fclose(f) == 0;
+}
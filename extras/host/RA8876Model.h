@@ -0,0 +1,135 @@
+//**************************************************************//
+/*
+ * RA8876Model.h
+ * A software RA8876 for the host build, see README.txt.
+ *
+ * It takes the same four bus cycles the chip decodes and keeps a
+ * register file, the SDRAM and enough of the memory port, geometry
+ * engine and BTE for RA8876_t3 to draw with. Images are what the
+ * driver put in SDRAM, not what a real panel would look like to the
+ * pixel: the geometry engine here draws the right shapes in the
+ * right places but doesn't try to match the chip's rasterizer.
+ *
+ * Only 16bpp canvases and BTE images are modelled. Anything else
+ * (text mode, serial flash DMA, other color depths, the BTE ops
+ * nothing in the driver uses) is counted in stats() and ignored.
+ */
+//**************************************************************//
+#ifndef _RA8876_MODEL
+#define _RA8876_MODEL
+
+#include "Arduino.h"
+
+//**************************************************************//
+// Counters, resetStats() clears them. SDRAM traffic is in pixels
+// (bytes in linear mode), so two ways of drawing the same thing
+// can be compared.
+//**************************************************************//
+typedef struct {
+	uint32_t	sdramReads;
+	uint32_t	sdramWrites;
+	uint32_t	memPortWrites;		// pixels through the memory data port
+	uint32_t	memPortReads;
+	uint32_t	geometryOps;
+	uint32_t	bteOps[16];			// by BTE operation code
+	uint32_t	statusReads;
+	uint32_t	intPinReads;
+	uint32_t	busyStarts;			// an engine task started while the last one was still busy
+	uint32_t	busyWrites;			// memory port writes while the engine was busy
+	uint32_t	textWrites;			// characters written in text mode, not drawn
+	uint32_t	unsupported;		// things the model doesn't do, see printStats()
+	uint32_t	outOfRange;			// SDRAM accesses past the end
+} modelStats_t;
+
+class RA8876Model
+{
+public:
+	RA8876Model(uint32_t sdram_size = 16ul * 1024ul * 1024ul);
+	~RA8876Model();
+	void reset(void);
+
+	// The bus cycles
+	void writeCommand(uint8_t reg);
+	void writeData(uint8_t data);
+	uint8_t readData(void);
+	uint8_t readStatus(void);
+	bool intPin(void);		// XnINTR, low (false) when an enabled interrupt is pending
+
+	// How many status reads (or XnINTR checks) an engine task stays busy for
+	void setBusyPolls(uint16_t polls) { _busyPolls = polls; }
+	bool busy(void) { return _busy || _bteMpuActive; }
+
+	uint8_t getRegister(uint8_t reg) { return _regs[reg]; }
+	uint8_t *sdram(void) { return _sdram; }
+	uint32_t sdramSize(void) { return _sdramSize; }
+	uint16_t getPixel(uint32_t addr, uint16_t image_width, uint16_t x, uint16_t y);
+	void setPixel(uint32_t addr, uint16_t image_width, uint16_t x, uint16_t y, uint16_t color);
+
+	// What the main window shows
+	uint16_t panelWidth(void);
+	uint16_t panelHeight(void);
+	uint16_t displayPixel(uint16_t x, uint16_t y);
+	bool writePPM(const char *filename);
+
+	const modelStats_t &stats(void) { return _stats; }
+	void resetStats(void);
+	void printStats(Print &pr);
+
+private:
+	uint8_t		_regs[256];
+	uint8_t		*_sdram;
+	uint32_t	_sdramSize;
+	modelStats_t	_stats;
+
+	uint8_t		_selected = 0;
+	// Memory port
+	uint16_t	_curX = 0, _curY = 0;
+	uint8_t		_memByte = 0;		// low byte of a pixel, waiting for the high one
+	bool		_memHalf = false;
+	bool		_readDummy = true;	// next read is the dummy one
+	bool		_readHalf = false;
+	uint16_t	_readPixel = 0;
+	// Engine
+	uint16_t	_busyPolls = 1;
+	uint16_t	_busy = 0;			// polls left
+	uint8_t		_intf = 0;
+	// BTE MPU write in progress
+	bool		_bteMpuActive = false;
+	uint8_t		_bteOp = 0;
+	uint32_t	_bteCount = 0;		// pixels (bytes for color expansion) taken so far
+	uint32_t	_bteTotal = 0;
+	uint8_t		_bteByte = 0;
+	bool		_bteHalf = false;
+
+	uint32_t	_reg16(uint8_t reg) { return _regs[reg] | (_regs[reg + 1] << 8); }
+	uint32_t	_reg32(uint8_t reg) { return _reg16(reg) | (_reg16(reg + 2) << 16); }
+	uint16_t	_color(uint8_t reg);	// FG (0xD2) or BG (0xD5) as RGB565
+	bool		_linear(void) { return (_regs[0x5E] & 0x04) != 0; }
+	bool		_textMode(void) { return (_regs[0x03] & 0x04) != 0; }
+
+	uint16_t	_read16(uint32_t addr);
+	void		_write16(uint32_t addr, uint16_t color);
+	void		_canvasPlot(int32_t x, int32_t y, uint16_t color);
+	void		_canvasSpan(int32_t x0, int32_t x1, int32_t y, uint16_t color);
+	void		_cursorLoad(void);
+	void		_cursorStore(void);
+	void		_cursorAdvance(uint8_t direction);
+	void		_memWrite(uint8_t data);
+	uint8_t		_memRead(void);
+
+	void		_engineStart(void);
+	void		_engineDone(void);
+	void		_drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color);
+	void		_drawEllipse(int32_t cx, int32_t cy, int32_t a, int32_t b, bool fill, uint8_t quadrants, uint16_t color);
+	void		_geometry0(uint8_t dcr0);
+	void		_geometry1(uint8_t dcr1);
+
+	void		_bteStart(void);
+	void		_bteMpuData(uint8_t data);
+	void		_bteMpuPixel(uint16_t s0);
+	void		_bteMpuDone(void);
+	bool		_bteDepthOk(void);
+	uint16_t	_rop(uint8_t rop, uint16_t s0, uint16_t s1);
+};
+
+#endif
@@ -0,0 +1,295 @@
+//**************************************************************//
+/*
+ * host.cpp
+ * Pins, the clock, interrupts and the SPI decoder for the host
+ * build, see host.h
+ */
+//**************************************************************//
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include "Arduino.h"
+#include "SPI.h"
+#include "Wire.h"
+#include "host.h"
+
+#define HOST_PINS	64
+
+HostSerial Serial;
+SPIClass SPI;
+SPIClass SPI1;
+SPIClass SPI2;
+TwoWire Wire;
+
+//**************************************************************//
+// Pins. Each one gets a fake GPIO block, select() and deselect()
+// write its clear (34) and set (33) registers.
+//**************************************************************//
+static volatile uint32_t gpio[HOST_PINS][36];
+static uint8_t pinLevel[HOST_PINS];
+static uint8_t intPin = 0xff;
+static RA8876Model *intModel = nullptr;
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+	if((pin < HOST_PINS) && (mode == INPUT_PULLUP)) pinLevel[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+	if(pin < HOST_PINS) pinLevel[pin] = value ? HIGH : LOW;
+}
+
+uint8_t digitalRead(uint8_t pin)
+{
+	if((pin == intPin) && intModel) return intModel->intPin() ? HIGH : LOW;
+	return (pin < HOST_PINS) ? pinLevel[pin] : LOW;
+}
+
+volatile uint32_t *portOutputRegister(uint8_t pin)
+{
+	return gpio[pin % HOST_PINS];
+}
+
+uint32_t digitalPinToBitMask(uint8_t pin)
+{
+	return 1;
+}
+
+void attachInterrupt(uint8_t pin, void (*function)(void), int mode) {}
+void detachInterrupt(uint8_t pin) {}
+void tone(uint8_t pin, uint16_t frequency, uint32_t duration) {}
+void yield(void) {}
+
+void hostSetInterruptPin(uint8_t pin, RA8876Model *model)
+{
+	intPin = pin;
+	intModel = model;
+}
+
+//**************************************************************//
+// The clock. Real time, plus however long everyone has delayed.
+//**************************************************************//
+static uint64_t delayedMicros = 0;
+
+static uint64_t hostMicros(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ull + ts.tv_nsec / 1000 + delayedMicros;
+}
+
+uint32_t micros(void) { return hostMicros(); }
+uint32_t millis(void) { return hostMicros() / 1000; }
+void delay(uint32_t ms) { delayedMicros += (uint64_t)ms * 1000; }
+void delayMicroseconds(uint32_t us) { delayedMicros += us; }
+void delayNanoseconds(uint32_t ns) { delayedMicros += ns / 1000; }
+
+//**************************************************************//
+// Interrupts, the only one is the fake DMA completion
+//**************************************************************//
+void noInterrupts(void)
+{
+	sigset_t set;
+	sigemptyset(&set);
+	sigaddset(&set, SIGALRM);
+	sigprocmask(SIG_BLOCK, &set, nullptr);
+}
+
+void interrupts(void)
+{
+	sigset_t set;
+	sigemptyset(&set);
+	sigaddset(&set, SIGALRM);
+	sigprocmask(SIG_UNBLOCK, &set, nullptr);
+}
+
+//**************************************************************//
+// SPI decoder. The first byte of a frame, and the byte after a
+// command or status read, says what comes next. Data reads and
+// writes carry on to the end of the frame.
+//**************************************************************//
+enum { SPI_PREFIX, SPI_CMD, SPI_DATAWRITE, SPI_DATAREAD, SPI_STATUS };
+
+static RA8876Model *spiModel = nullptr;
+static volatile uint32_t *csPort = nullptr;
+static uint8_t spiState = SPI_PREFIX;
+static uint32_t frameBytes = 0;
+static uint32_t spiBytes = 0;
+static uint32_t spiFrames = 0;
+static uint32_t spiErrors = 0;
+static busTrace_t *spiTrace = nullptr;
+static uint32_t spiTraceSize = 0;
+static uint32_t spiTraceCount = 0;
+
+void hostAttachSPI(RA8876Model *model, uint8_t cs_pin)
+{
+	spiModel = model;
+	csPort = gpio[cs_pin % HOST_PINS];
+	spiState = SPI_PREFIX;
+	frameBytes = 0;
+}
+
+void hostSpiTrace(busTrace_t *trace, uint32_t size)
+{
+	spiTrace = trace;
+	spiTraceSize = trace ? size : 0;
+	spiTraceCount = 0;
+}
+
+uint32_t hostSpiTraceCount(void) { return spiTraceCount; }
+uint32_t hostSpiBytes(void) { return spiBytes; }
+uint32_t hostSpiFrames(void) { return spiFrames; }
+uint32_t hostSpiErrors(void) { return spiErrors; }
+
+void hostResetSpiStats(void)
+{
+	spiBytes = 0;
+	spiFrames = 0;
+	spiErrors = 0;
+}
+
+static void traceRecord(uint8_t cycle, uint8_t value)
+{
+	if(spiTraceCount < spiTraceSize) {
+		spiTrace[spiTraceCount].cycle = cycle;
+		spiTrace[spiTraceCount].value = value;
+	}
+	spiTraceCount++;
+}
+
+void hostSpiFlush(void)
+{
+	if(frameBytes) traceRecord(RA8876_CYCLE_FRAME_END, 0);
+	frameBytes = 0;
+	spiState = SPI_PREFIX;
+}
+
+static uint8_t spiByte(uint8_t b)
+{
+	if(csPort && csPort[34]) {
+		// CS was taken low again since the last byte
+		csPort[33] = 0;
+		csPort[34] = 0;
+		hostSpiFlush();
+	}
+	if(!frameBytes++) spiFrames++;
+	spiBytes++;
+	if(!spiModel) return 0;
+	uint8_t r = 0;
+	switch(spiState) {
+		case SPI_PREFIX:
+			switch(b & 0xc0) {
+				case RA8876_SPI_CMDWRITE:	spiState = SPI_CMD; break;
+				case RA8876_SPI_DATAWRITE:	spiState = SPI_DATAWRITE; break;
+				case RA8876_SPI_DATAREAD:	spiState = SPI_DATAREAD; break;
+				case RA8876_SPI_STATUSREAD:	spiState = SPI_STATUS; break;
+			}
+			break;
+		case SPI_CMD:
+			spiModel->writeCommand(b);
+			traceRecord(RA8876_CYCLE_CMDWRITE, b);
+			spiState = SPI_PREFIX;
+			break;
+		case SPI_DATAWRITE:
+			spiModel->writeData(b);
+			traceRecord(RA8876_CYCLE_DATAWRITE, b);
+			break;
+		case SPI_DATAREAD:
+			r = spiModel->readData();
+			traceRecord(RA8876_CYCLE_DATAREAD, r);
+			break;
+		case SPI_STATUS:
+			r = spiModel->readStatus();
+			traceRecord(RA8876_CYCLE_STATUSREAD, r);
+			spiState = SPI_PREFIX;
+			break;
+	}
+	return r;
+}
+
+//**************************************************************//
+// Fake DMA, the bytes go out when the timer goes off
+//**************************************************************//
+static volatile bool dmaBusy = false;
+static const uint8_t *dmaBuf;
+static uint32_t dmaLen;
+static EventResponder *dmaDone;
+static uint32_t dmaMicros = 50;
+static volatile uint32_t dmaStarted = 0;
+static volatile uint32_t dmaCompleted = 0;
+
+void hostSetDmaMicros(uint32_t us) { dmaMicros = us ? us : 1; }
+uint32_t hostDmaStarted(void) { return dmaStarted; }
+uint32_t hostDmaCompleted(void) { return dmaCompleted; }
+
+void hostDmaWait(void)
+{
+	while(dmaBusy) {}
+}
+
+static void dmaInterrupt(int signal)
+{
+	if(!dmaBusy) return;
+	for(uint32_t i = 0; i < dmaLen; i++) spiByte(dmaBuf[i]);
+	dmaBusy = false;
+	dmaCompleted++;
+	dmaDone->triggerEvent();
+}
+
+//**************************************************************//
+// SPIClass
+//**************************************************************//
+void SPIClass::beginTransaction(SPISettings settings) {}
+void SPIClass::endTransaction(void) {}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+	if(dmaBusy) spiErrors++;
+	return spiByte(data);
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+	if(dmaBusy) spiErrors++;
+	uint8_t hi = spiByte(data >> 8);
+	return (hi << 8) | spiByte(data);
+}
+
+void SPIClass::transfer(const void *buf, void *retbuf, size_t count)
+{
+	const uint8_t *out = (const uint8_t *)buf;
+	uint8_t *in = (uint8_t *)retbuf;
+	if(dmaBusy) spiErrors++;
+	for(size_t i = 0; i < count; i++) {
+		uint8_t r = spiByte(out ? out[i] : 0);
+		if(in) in[i] = r;
+	}
+}
+
+bool SPIClass::transfer(const void *buf, void *retbuf, size_t count, EventResponderRef event_responder)
+{
+	static bool handler = false;
+	if(dmaBusy) {
+		spiErrors++;
+		return false;
+	}
+	if(!handler) {
+		struct sigaction sa;
+		memset(&sa, 0, sizeof(sa));
+		sa.sa_handler = dmaInterrupt;
+		sa.sa_flags = SA_RESTART;
+		sigaction(SIGALRM, &sa, nullptr);
+		handler = true;
+	}
+	dmaBuf = (const uint8_t *)buf;
+	dmaLen = count;
+	dmaDone = &event_responder;
+	dmaStarted++;
+	dmaBusy = true;
+	struct itimerval timer = {};
+	timer.it_value.tv_sec = dmaMicros / 1000000;
+	timer.it_value.tv_usec = dmaMicros % 1000000;
+	setitimer(ITIMER_REAL, &timer, nullptr);
+	return true;
+}
@@ -0,0 +1,76 @@
+//**************************************************************//
+/*
+ * host.h
+ * The PC side of the host build, see README.txt.
+ *
+ * Whatever RA8876SPIBus sends through the SPI stub is decoded the
+ * way the chip decodes an SPI frame and played into the model given
+ * to hostAttachSPI(). A new frame starts each time the CS pin's
+ * fake GPIO clear register is written, which is what select() does
+ * on a Teensy 4.
+ *
+ * The async SPI transfer is a fake DMA: it returns straight away
+ * and a SIGALRM hostSetDmaMicros() later sends the bytes and
+ * triggers the EventResponder from the signal handler, like the
+ * completion interrupt. noInterrupts() blocks the signal.
+ *
+ * delay() and friends don't sleep, they move micros() on.
+ */
+//**************************************************************//
+#ifndef _RA8876_HOST
+#define _RA8876_HOST
+
+#include "Arduino.h"
+#include "RA8876Bus.h"
+#include "RA8876Model.h"
+
+void hostAttachSPI(RA8876Model *model, uint8_t cs_pin = 10);
+// Record the decoded cycles like RA8876MockBus does, FRAME_END when
+// the next frame starts (or hostSpiFlush()) after one with anything in it
+void hostSpiTrace(busTrace_t *trace, uint32_t size);
+uint32_t hostSpiTraceCount(void);
+void hostSpiFlush(void);
+uint32_t hostSpiBytes(void);		// including the cycle type bytes
+uint32_t hostSpiFrames(void);
+uint32_t hostSpiErrors(void);		// transfers started while the fake DMA was busy
+void hostResetSpiStats(void);
+
+// XnINTR from the model on this pin
+void hostSetInterruptPin(uint8_t pin, RA8876Model *model);
+
+void hostSetDmaMicros(uint32_t us);
+uint32_t hostDmaStarted(void);
+uint32_t hostDmaCompleted(void);
+void hostDmaWait(void);		// until the last transfer has gone out
+
+//**************************************************************//
+// Straight into a model, no SPI framing and no DMA
+//**************************************************************//
+class RA8876ModelBus : public RA8876Bus
+{
+public:
+	RA8876ModelBus(RA8876Model &model) : _model(&model) {}
+	bool begin(uint32_t clock) { return true; }
+	const char *name(void) { return "Model"; }
+
+	void select(void) {}
+	void deselect(void) {}
+
+	void writeCommand(uint8_t reg) { _model->writeCommand(reg); }
+	void writeData(uint8_t data) { _model->writeData(data); }
+	void writeDataBuffer(const void *buf, uint32_t len) {
+		const uint8_t *p = (const uint8_t *)buf;
+		while(len--) _model->writeData(*p++);
+	}
+	uint8_t readData(void) { return _model->readData(); }
+	void readDataBuffer(void *buf, uint32_t len) {
+		uint8_t *p = (uint8_t *)buf;
+		while(len--) *p++ = _model->readData();
+	}
+	uint8_t readStatus(void) { return _model->readStatus(); }
+
+private:
+	RA8876Model	*_model;
+};
+
+#endif
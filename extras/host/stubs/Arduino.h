@@ -0,0 +1,175 @@
+//**************************************************************//
+// Just enough of the Teensy core for RA8876_t3 to build and run
+// on a PC, see extras/host/README.txt. Pins, the clock and
+// interrupts are implemented in host.cpp.
+//**************************************************************//
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define FLASHMEM
+#define DMAMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+
+#define HIGH		1
+#define LOW			0
+#define INPUT		0
+#define OUTPUT		1
+#define INPUT_PULLUP	2
+#define CHANGE		4
+#define FALLING		2
+#define RISING		3
+#define MSBFIRST	1
+#define LSBFIRST	0
+#define DEC			10
+#define HEX			16
+#define OCT			8
+#define BIN			2
+#define PI			3.1415926535897932384626433832795
+
+using std::min;
+using std::max;
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+static inline uint8_t pgm_read_byte(const void *p) { return *(const uint8_t *)p; }
+static inline uint16_t pgm_read_word(const void *p) { return *(const uint16_t *)p; }
+static inline uint32_t pgm_read_dword(const void *p) { return *(const uint32_t *)p; }
+static inline const void *pgm_read_pointer(const void *p) { return *(const void * const *)p; }
+
+class String
+{
+public:
+	String(const char *s = "") : _s(s ? s : "") {}
+	const char *c_str(void) const { return _s; }
+	unsigned int length(void) const { return strlen(_s); }
+private:
+	const char *_s;
+};
+
+//**************************************************************//
+// Print, formats into write() like the Teensy one
+//**************************************************************//
+class Print
+{
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t b) = 0;
+	virtual size_t write(const uint8_t *buffer, size_t size) {
+		size_t count = 0;
+		while(size--) count += write(*buffer++);
+		return count;
+	}
+	size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+	size_t print(const char *s) { return write(s); }
+	size_t print(char c) { return write((uint8_t)c); }
+	size_t print(const String &s) { return write(s.c_str()); }
+	size_t print(int n, int base = DEC) { return print((long)n, base); }
+	size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+	size_t print(long n, int base = DEC) {
+		if((base == DEC) && (n < 0)) return print('-') + print((unsigned long)-n, base);
+		return print((unsigned long)n, base);
+	}
+	size_t print(unsigned long n, int base = DEC) {
+		char buf[33];
+		char *p = &buf[32];
+		*p = 0;
+		do {
+			uint8_t digit = n % base;
+			*--p = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+			n /= base;
+		} while(n);
+		return write(p);
+	}
+	size_t print(double n, int digits = 2) { return printf("%.*f", digits, n); }
+	size_t println(void) { return write("\r\n"); }
+	template <typename T> size_t println(T value) { return print(value) + println(); }
+	template <typename T> size_t println(T value, int format) { return print(value, format) + println(); }
+	int printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+		char buf[512];
+		va_list args;
+		va_start(args, format);
+		int len = vsnprintf(buf, sizeof(buf), format, args);
+		va_end(args);
+		if(len > (int)sizeof(buf) - 1) len = sizeof(buf) - 1;
+		return (len > 0) ? write((const uint8_t *)buf, len) : len;
+	}
+	virtual void flush(void) {}
+};
+
+// Serial goes to stdout
+class HostSerial : public Print
+{
+public:
+	void begin(uint32_t baud) {}
+	size_t write(uint8_t b) { return fwrite(&b, 1, 1, stdout); }
+	size_t write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+	using Print::write;
+	int available(void) { return 0; }
+	int read(void) { return -1; }
+	void flush(void) { fflush(stdout); }
+	operator bool() { return true; }
+};
+extern HostSerial Serial;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+uint8_t digitalRead(uint8_t pin);
+static inline void digitalWriteFast(uint8_t pin, uint8_t value) { digitalWrite(pin, value); }
+static inline uint8_t digitalReadFast(uint8_t pin) { return digitalRead(pin); }
+volatile uint32_t *portOutputRegister(uint8_t pin);
+uint32_t digitalPinToBitMask(uint8_t pin);
+static inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterrupt(uint8_t pin, void (*function)(void), int mode);
+void detachInterrupt(uint8_t pin);
+void tone(uint8_t pin, uint16_t frequency, uint32_t duration);
+
+uint32_t micros(void);
+uint32_t millis(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void delayNanoseconds(uint32_t ns);
+void yield(void);
+
+// Interrupts are the fake DMA completions, see host.cpp
+void noInterrupts(void);
+void interrupts(void);
+
+class elapsedMicros
+{
+public:
+	elapsedMicros(void) { _us = micros(); }
+	elapsedMicros(uint32_t val) { _us = micros() - val; }
+	operator uint32_t() const { return micros() - _us; }
+	elapsedMicros &operator=(uint32_t val) { _us = micros() - val; return *this; }
+private:
+	uint32_t _us;
+};
+
+class elapsedMillis
+{
+public:
+	elapsedMillis(void) { _ms = millis(); }
+	elapsedMillis(uint32_t val) { _ms = millis() - val; }
+	operator uint32_t() const { return millis() - _ms; }
+	elapsedMillis &operator=(uint32_t val) { _ms = millis() - val; return *this; }
+private:
+	uint32_t _ms;
+};
+
+#endif
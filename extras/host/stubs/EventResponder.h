@@ -0,0 +1,34 @@
+//**************************************************************//
+// Host EventResponder, only the immediate kind the SPI async
+// transfer uses. triggerEvent() calls the function straight away.
+//**************************************************************//
+#ifndef _HOST_EVENTRESPONDER_H
+#define _HOST_EVENTRESPONDER_H
+
+class EventResponder;
+typedef EventResponder &EventResponderRef;
+typedef void (*EventResponderFunction)(EventResponderRef);
+
+class EventResponder
+{
+public:
+	void setContext(void *context) { _context = context; }
+	void *getContext(void) { return _context; }
+	void attachImmediate(EventResponderFunction function) { _function = function; }
+	void detach(void) { _function = nullptr; }
+	void triggerEvent(int status = 0, void *data = nullptr) {
+		_status = status;
+		_data = data;
+		if(_function) (*_function)(*this);
+	}
+	void clearEvent(void) {}
+	int getStatus(void) { return _status; }
+	void *getData(void) { return _data; }
+private:
+	EventResponderFunction	_function = nullptr;
+	void	*_context = nullptr;
+	void	*_data = nullptr;
+	int		_status = 0;
+};
+
+#endif
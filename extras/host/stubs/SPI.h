@@ -0,0 +1,51 @@
+//**************************************************************//
+// Host SPI. Every SPI port is the same one bus, what goes out on
+// it is decoded into RA8876 bus cycles for the model attached with
+// hostAttachSPI(), see host.h. The async transfer is a fake DMA
+// that finishes from a timer signal.
+//**************************************************************//
+#ifndef _HOST_SPI_H
+#define _HOST_SPI_H
+
+#include "Arduino.h"
+#include "EventResponder.h"
+
+#define SPI_HAS_TRANSFER_ASYNC 1
+#define SPI_MODE0	0x00
+#define SPI_MODE1	0x04
+#define SPI_MODE2	0x08
+#define SPI_MODE3	0x0C
+
+class SPISettings
+{
+public:
+	SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) : clock(clock) {}
+	uint32_t clock;
+};
+
+class SPIClass
+{
+public:
+	bool pinIsMOSI(uint8_t pin) { return true; }
+	bool pinIsMISO(uint8_t pin) { return true; }
+	bool pinIsSCK(uint8_t pin) { return true; }
+	void setMOSI(uint8_t pin) {}
+	void setMISO(uint8_t pin) {}
+	void setSCK(uint8_t pin) {}
+	void begin(void) {}
+	void end(void) {}
+	void usingInterrupt(uint8_t n) {}
+	void beginTransaction(SPISettings settings);
+	void endTransaction(void);
+	uint8_t transfer(uint8_t data);
+	uint16_t transfer16(uint16_t data);
+	void transfer(void *buf, size_t count) { transfer(buf, buf, count); }
+	void transfer(const void *buf, void *retbuf, size_t count);
+	bool transfer(const void *buf, void *retbuf, size_t count, EventResponderRef event_responder);
+};
+
+extern SPIClass SPI;
+extern SPIClass SPI1;
+extern SPIClass SPI2;
+
+#endif
@@ -0,0 +1,25 @@
+//**************************************************************//
+// Host Wire, for the FT5206 touch code. Nothing is on the bus,
+// reads return no data.
+//**************************************************************//
+#ifndef _HOST_WIRE_H
+#define _HOST_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire
+{
+public:
+	void begin(void) {}
+	void setClock(uint32_t frequency) {}
+	void beginTransmission(uint8_t address) {}
+	uint8_t endTransmission(uint8_t sendStop = 1) { return 2; }	// address NACK
+	size_t write(uint8_t data) { return 1; }
+	uint8_t requestFrom(uint8_t address, uint8_t quantity) { return 0; }
+	int available(void) { return 0; }
+	int read(void) { return -1; }
+};
+
+extern TwoWire Wire;
+
+#endif
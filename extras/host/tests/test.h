@@ -0,0 +1,26 @@
+//**************************************************************//
+// The few things the host tests share, see README.txt
+//**************************************************************//
+#ifndef _RA8876_HOST_TEST
+#define _RA8876_HOST_TEST
+
+#include "Arduino.h"
+
+static int testFailures = 0;
+
+#define CHECK(cond) do { \
+	if(!(cond)) { \
+		testFailures++; \
+		Serial.printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+	} \
+} while(0)
+
+// Exit status for main()
+static int testResult(const char *name)
+{
+	Serial.printf("%s: %s (%d failed)\n", name, testFailures ? "FAIL" : "PASS", testFailures);
+	Serial.flush();
+	return testFailures ? 1 : 0;
+}
+
+#endif
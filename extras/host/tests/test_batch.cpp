@@ -0,0 +1,91 @@
+//**************************************************************//
+/*
+ * test_batch.cpp
+ * Register write batching: the same writes one transaction each
+ * and between beginRegBatch()/endRegBatch(), counting transactions,
+ * CS asserts and SPI bytes, and checking they all reach the chip
+ * in order.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+#define REGS	16
+#define FIRST_REG	RA8876_S0_STR0	// BTE setup, nothing starts
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+
+static void resetStats(void)
+{
+	tft.resetSpiStats();
+	hostResetSpiStats();
+}
+
+static bool checkRegs(uint8_t first_value)
+{
+	for(uint8_t i = 0; i < REGS; i++) {
+		if(model.getRegister(FIRST_REG + i) != (uint8_t)(first_value + i)) {
+			Serial.printf("register %02x is %02x, expected %02x\n", FIRST_REG + i, model.getRegister(FIRST_REG + i), first_value + i);
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(void)
+{
+	hostAttachSPI(&model, 10);
+	tft.setFastBoot(true);
+	CHECK(tft.begin());
+
+	resetStats();
+	for(uint8_t i = 0; i < REGS; i++) tft.lcdRegDataWrite(FIRST_REG + i, 0x10 + i);
+	uint32_t transactions = tft.spiTransactionCount(), asserts = tft.spiCSAssertCount(), bytes = hostSpiBytes();
+	Serial.printf("%u writes one at a time: transactions: %lu CS asserts: %lu SPI bytes: %lu\n", REGS,
+				  (unsigned long)transactions, (unsigned long)asserts, (unsigned long)bytes);
+	CHECK(transactions == REGS);
+	CHECK(checkRegs(0x10));
+
+	resetStats();
+	tft.beginRegBatch();
+	for(uint8_t i = 0; i < REGS; i++) tft.lcdRegDataWrite(FIRST_REG + i, 0x40 + i);
+	CHECK(hostSpiBytes() == 0);		// nothing goes until the batch ends
+	tft.endRegBatch();
+	Serial.printf("%u writes batched: transactions: %lu CS asserts: %lu SPI bytes: %lu\n", REGS,
+				  (unsigned long)tft.spiTransactionCount(), (unsigned long)tft.spiCSAssertCount(), (unsigned long)hostSpiBytes());
+	CHECK(tft.spiTransactionCount() == 1);
+	CHECK(tft.spiCSAssertCount() == REGS);	// still a frame per pair
+	CHECK(hostSpiBytes() == bytes);
+	CHECK(checkRegs(0x40));
+
+	// Nested, only the outer most end sends them
+	resetStats();
+	tft.beginRegBatch();
+	tft.beginRegBatch();
+	for(uint8_t i = 0; i < REGS; i++) tft.lcdRegDataWrite(FIRST_REG + i, 0x70 + i);
+	tft.endRegBatch();
+	CHECK(hostSpiBytes() == 0);
+	tft.endRegBatch();
+	CHECK(tft.spiTransactionCount() == 1);
+	CHECK(checkRegs(0x70));
+
+	// Anything else on the bus sends the queue first
+	tft.beginRegBatch();
+	tft.lcdRegDataWrite(FIRST_REG, 0x5a);
+	CHECK(tft.lcdRegDataRead(FIRST_REG) == 0x5a);
+	tft.endRegBatch();
+
+	// More than the queue holds
+	resetStats();
+	tft.beginRegBatch();
+	for(uint16_t i = 0; i < RA8876_REG_BATCH_SIZE + 5; i++) tft.lcdRegDataWrite(FIRST_REG + (i % REGS), i);
+	tft.endRegBatch();
+	CHECK(tft.spiCSAssertCount() == RA8876_REG_BATCH_SIZE + 5);
+	for(uint16_t i = RA8876_REG_BATCH_SIZE + 5 - REGS; i < RA8876_REG_BATCH_SIZE + 5; i++)
+		CHECK(model.getRegister(FIRST_REG + (i % REGS)) == i);
+
+	CHECK(hostSpiErrors() == 0);
+	return testResult("test_batch");
+}
@@ -0,0 +1,113 @@
+//**************************************************************//
+/*
+ * test_busy.cpp
+ * The BTE job queue against a model that stays busy for a set
+ * number of polls after each engine task, watched with status
+ * reads and then on XnINTR with useInterruptPin(). Nothing may be
+ * started or written to the memory port while the engine is busy,
+ * and the jobs have to run in order.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+#define INT_PIN		20
+#define TILE_W		32
+#define TILE_H		16
+#define COPIES		6
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+static uint16_t tile[TILE_W * TILE_H];
+
+static bool checkTile(int16_t x, int16_t y, const char *what)
+{
+	hostDmaWait();
+	for(int16_t j = 0; j < TILE_H; j++) {
+		for(int16_t i = 0; i < TILE_W; i++) {
+			uint16_t got = model.getPixel(tft.currentPage, tft.width(), x + i, y + j);
+			if(got != tile[j * TILE_W + i]) {
+				Serial.printf("%s: pixel %d,%d is %04x, expected %04x\n", what, x + i, y + j, got, tile[j * TILE_W + i]);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+//**************************************************************//
+// A chain of copies, each from the last one's destination, then
+// an 8x8 pattern fill from the first tile
+//**************************************************************//
+static void runJobs(uint16_t polls, int16_t y, const char *how)
+{
+	tft.fillRect(0, y, 400, 2 * TILE_H, BLACK);
+	tft.writeRect(0, y, TILE_W, TILE_H, tile);
+	tft.check2dBusy();
+	model.setBusyPolls(polls);
+	model.resetStats();
+	tft.resetSpiStats();
+
+	for(uint8_t i = 0; i < COPIES; i++) {
+		tft.bteQueueMemoryCopy(tft.currentPage, tft.width(), i * (TILE_W + 8), y,
+							   tft.currentPage, tft.width(), (i + 1) * (TILE_W + 8), y, TILE_W, TILE_H);
+	}
+	tft.bteQueuePatternFill(0, tft.currentPage, tft.width(), 0, y,
+							tft.currentPage, tft.width(), 0, y + TILE_H, 64, TILE_H);
+	uint8_t queued = tft.bteQueueCount();
+	uint32_t services = 0;
+	while(tft.bteService()) services++;
+	tft.check2dBusy();
+
+	Serial.printf("%-18s busy for %2u polls: %u left queued, %lu bteService calls, status reads %lu, XnINTR reads %lu\n", how, polls,
+				  queued, (unsigned long)services, (unsigned long)model.stats().statusReads, (unsigned long)model.stats().intPinReads);
+	if(polls > 1) CHECK(queued > 0);	// didn't wait for the engine to queue them
+	CHECK(tft.bteQueueCount() == 0);
+	CHECK(model.stats().bteOps[RA8876_BTE_MEMORY_COPY_WITH_ROP] == COPIES);
+	CHECK(model.stats().bteOps[RA8876_BTE_PATTERN_FILL_WITH_ROP] == 1);
+	CHECK(model.stats().busyStarts == 0);
+	CHECK(model.stats().busyWrites == 0);
+	CHECK(!model.busy());
+	CHECK(checkTile(COPIES * (TILE_W + 8), y, how));
+	bool pattern = true;
+	for(int16_t j = 0; j < TILE_H; j++) {
+		for(int16_t i = 0; i < 64; i++)
+			pattern &= model.getPixel(tft.currentPage, tft.width(), i, y + TILE_H + j) == tile[(j % 8) * TILE_W + (i % 8)];
+	}
+	CHECK(pattern);
+}
+
+int main(void)
+{
+	static const uint16_t latencies[] = {0, 1, 5, 50};
+	hostAttachSPI(&model, 10);
+	tft.setFastBoot(true);
+	CHECK(tft.begin());
+	for(uint16_t i = 0; i < TILE_W * TILE_H; i++) tile[i] = i * 97 + 5;
+
+	// Nothing started, nothing to ask
+	tft.check2dBusy();
+	hostResetSpiStats();
+	tft.check2dBusy();
+	CHECK(hostSpiBytes() == 0);
+
+	int16_t y = 0;
+	for(uint8_t i = 0; i < sizeof(latencies) / sizeof(latencies[0]); i++, y += 3 * TILE_H)
+		runJobs(latencies[i], y, "status register");
+
+	// XnINTR, engine tasks shouldn't need a status read to finish
+	hostSetInterruptPin(INT_PIN, &model);
+	tft.useInterruptPin(INT_PIN);
+	for(uint8_t i = 0; i < sizeof(latencies) / sizeof(latencies[0]); i++, y += 3 * TILE_H) {
+		runJobs(latencies[i], y, "XnINTR");
+		CHECK(model.stats().intPinReads > 0);
+		CHECK(model.stats().statusReads == 0);
+	}
+	tft.useInterruptPin(0xff);
+	runJobs(5, y, "status register");
+
+	CHECK(hostSpiErrors() == 0);
+	CHECK(model.stats().unsupported == 0);
+	return testResult("test_busy");
+}
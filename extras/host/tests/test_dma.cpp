@@ -0,0 +1,100 @@
+//**************************************************************//
+/*
+ * test_dma.cpp
+ * writeRectAsync() on the fake DMA: tiles are rendered into two
+ * buffers, each reused only after dmaFenceWait() says its last
+ * transfer is done. The fake DMA reads the buffer when it finishes,
+ * so a fence that passed too early shows up as the wrong pixels.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+#define TILE_W		64
+#define TILE_H		32
+#define TILES		(3 * RA8876_DMA_QUEUE_SIZE)
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+static uint16_t buffers[2][TILE_W * TILE_H];
+static volatile uint32_t callbackFences[TILES];
+static volatile uint32_t callbacks = 0;
+
+// From the completion interrupt
+static void tileDone(void *context, uint32_t fence)
+{
+	if(callbacks < TILES) callbackFences[callbacks] = fence;
+	callbacks++;
+	*(uint32_t *)context = fence;
+}
+
+static uint16_t tileColor(uint16_t tile, int32_t i)
+{
+	return (uint16_t)(tile * 0x1111 + i * 3);
+}
+
+static int16_t tileX(uint16_t tile) { return (tile % 8) * (TILE_W + 4); }
+static int16_t tileY(uint16_t tile) { return 200 + (tile / 8) * (TILE_H + 4); }
+
+int main(void)
+{
+	static uint32_t fences[TILES];
+	static uint32_t last_done = 0;
+	hostAttachSPI(&model, 10);
+	tft.setFastBoot(true);
+	CHECK(tft.begin());
+
+	// The fence isn't done until the transfer is
+	hostSetDmaMicros(20000);
+	for(int32_t i = 0; i < TILE_W * TILE_H; i++) buffers[0][i] = RED;
+	uint32_t fence = tft.writeRectAsync(0, 0, TILE_W, TILE_H, buffers[0]);
+	CHECK(!tft.dmaFenceDone(fence));
+	tft.dmaFenceWait(fence);
+	CHECK(tft.dmaFenceDone(fence));
+	CHECK(model.getPixel(tft.currentPage, tft.width(), TILE_W - 1, TILE_H - 1) == RED);
+
+	// Render the next tile while the last one goes out
+	hostSetDmaMicros(500);
+	uint32_t started = hostDmaStarted();
+	uint16_t overlapped = 0;
+	for(uint16_t tile = 0; tile < TILES; tile++) {
+		uint16_t *buffer = buffers[tile & 1];
+		if(tile >= 2) tft.dmaFenceWait(fences[tile - 2]);
+		if(hostDmaStarted() != hostDmaCompleted()) overlapped++;
+		for(int32_t i = 0; i < TILE_W * TILE_H; i++) buffer[i] = tileColor(tile, i);
+		fences[tile] = tft.writeRectAsync(tileX(tile), tileY(tile), TILE_W, TILE_H, buffer, tileDone, &last_done);
+	}
+	tft.dmaFenceWait(fences[TILES - 1]);
+	hostDmaWait();
+	Serial.printf("%u tiles, %lu DMA transfers, %u rendered while one was going out\n", TILES,
+				  (unsigned long)(hostDmaStarted() - started), overlapped);
+
+	CHECK(callbacks == TILES);
+	CHECK(last_done == fences[TILES - 1]);
+	bool in_order = true;
+	for(uint16_t i = 1; i < TILES; i++) in_order &= (int32_t)(callbackFences[i] - callbackFences[i - 1]) > 0;
+	CHECK(in_order);
+	CHECK(hostDmaStarted() - started >= TILES);
+	CHECK(overlapped > 0);
+
+	bool ok = true;
+	for(uint16_t tile = 0; ok && (tile < TILES); tile++) {
+		for(int32_t i = 0; ok && (i < TILE_W * TILE_H); i++) {
+			uint16_t got = model.getPixel(tft.currentPage, tft.width(), tileX(tile) + i % TILE_W, tileY(tile) + i / TILE_W);
+			if(got != tileColor(tile, i)) {
+				Serial.printf("tile %u pixel %ld is %04x, expected %04x\n", tile, (long)i, got, tileColor(tile, i));
+				ok = false;
+			}
+		}
+	}
+	CHECK(ok);
+
+	// Ordinary drawing after the queue still works and waits its turn
+	tft.fillRect(0, 0, 10, 10, GREEN);
+	tft.check2dBusy();
+	CHECK(model.getPixel(tft.currentPage, tft.width(), 5, 5) == GREEN);
+	CHECK(hostSpiErrors() == 0);
+	CHECK(model.stats().busyStarts == 0);
+	return testResult("test_dma");
+}
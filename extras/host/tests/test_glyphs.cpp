@@ -0,0 +1,94 @@
+//**************************************************************//
+/*
+ * test_glyphs.cpp
+ * 1bpp ILI9341_t3 text three ways: one BTE color expansion per
+ * glyph, the fillRect per run of bits drawFontBits() path it
+ * replaced, and the glyph cache. SPI transactions, CS asserts and
+ * bytes per glyph, and glyphs per second from the SPI bytes alone
+ * at the default clock. Transparent text has to come out the same
+ * either way.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "_font_ComicSansMS.h"
+#include "host.h"
+#include "test.h"
+
+#define LINE_X		10
+#define LINE_W		700
+#define LINE_H		40
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+static const char text[] = "The quick brown fox jumps over the lazy dog 0123456789";
+
+static void report(const char *what, uint32_t glyphs)
+{
+	uint32_t bytes = hostSpiBytes();
+	float us = bytes * 8.0f / (SPIspeed / 1000000.0f);
+	Serial.printf("  %-32s per glyph: transactions %5.1f CS asserts %5.1f SPI bytes %6.1f, %6.0f glyphs/s\n", what,
+				  (float)tft.spiTransactionCount() / glyphs, (float)tft.spiCSAssertCount() / glyphs, (float)bytes / glyphs,
+				  glyphs * 1000000.0f / us);
+}
+
+static void drawLine(int16_t y, bool expansion, bool opaque, const char *what)
+{
+	tft.fillRect(0, y, LINE_X + LINE_W, LINE_H, BLACK);
+	tft.setFontColorExpansion(expansion);
+	if(opaque) tft.setTextColor(WHITE, BLUE);
+	else tft.setTextColor(WHITE);
+	tft.setCursor(LINE_X, y);
+	tft.check2dBusy();
+	tft.resetSpiStats();
+	hostResetSpiStats();
+	tft.print(text);
+	tft.check2dBusy();
+	hostDmaWait();
+	report(what, strlen(text));
+}
+
+static bool sameLines(int16_t y1, int16_t y2)
+{
+	for(int16_t j = 0; j < LINE_H; j++) {
+		for(int16_t i = 0; i < LINE_X + LINE_W; i++) {
+			uint16_t p1 = model.getPixel(tft.currentPage, tft.width(), i, y1 + j);
+			uint16_t p2 = model.getPixel(tft.currentPage, tft.width(), i, y2 + j);
+			if(p1 != p2) {
+				Serial.printf("pixel %d,%d is %04x, %d,%d is %04x\n", i, y1 + j, p1, i, y2 + j, p2);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+int main(void)
+{
+	hostAttachSPI(&model, 10);
+	tft.setFastBoot(true);
+	CHECK(tft.begin());
+	tft.setFont(ComicSansMS_12);
+	Serial.printf("\"%s\", %u glyphs, ComicSansMS_12, %s:\n", text, (unsigned)strlen(text), tft.bus()->name());
+
+	drawLine(50, false, false, "fillRect runs, transparent");
+	uint32_t runs = tft.spiTransactionCount();
+	drawLine(100, true, false, "color expansion, transparent");
+	uint32_t expansion = tft.spiTransactionCount();
+	CHECK(sameLines(50, 100));
+	CHECK(expansion < runs);
+
+	drawLine(150, false, true, "fillRect runs, opaque");
+	drawLine(200, true, true, "color expansion, opaque");
+
+	tft.glyphCacheEnable(true);
+	drawLine(250, true, false, "glyph cache, first time");
+	drawLine(300, true, false, "glyph cache, cached");
+	CHECK(tft.glyphCacheHits() > 0);
+	CHECK(sameLines(50, 300));
+	tft.glyphCacheEnable(false);
+
+	CHECK(hostSpiErrors() == 0);
+	CHECK(model.stats().unsupported == 0);
+	CHECK(model.stats().outOfRange == 0);
+	return testResult("test_glyphs");
+}
@@ -0,0 +1,116 @@
+//**************************************************************//
+/*
+ * test_move.cpp
+ * bteMove() in every direction and for overlaps from one pixel to
+ * none, checked against memmove() semantics on a copy of the page.
+ * The model copies pixel by pixel in the order the chip does, so a
+ * copy in the wrong direction smears. Then the SDRAM traffic of
+ * bteMove() against bouncing the whole region through PAGE10, the
+ * way scrollDown() used to.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+#define AREA_W		300
+#define AREA_H		220
+#define MOVE_X		120
+#define MOVE_Y		90
+#define MOVE_W		60
+#define MOVE_H		40
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+static uint16_t pattern[AREA_W * AREA_H];
+static uint16_t expected[AREA_W * AREA_H];
+static uint16_t block[MOVE_W * MOVE_H];
+
+static void drawPattern(void)
+{
+	tft.writeRect(0, 0, AREA_W, AREA_H, pattern);
+	tft.check2dBusy();
+	hostDmaWait();
+}
+
+// memmove(): the source as it was before, wherever the regions overlap
+static void moveReference(int16_t d_x, int16_t d_y)
+{
+	memcpy(expected, pattern, sizeof(expected));
+	for(int16_t j = 0; j < MOVE_H; j++)
+		memcpy(&block[j * MOVE_W], &pattern[(MOVE_Y + j) * AREA_W + MOVE_X], MOVE_W * 2);
+	for(int16_t j = 0; j < MOVE_H; j++)
+		memcpy(&expected[(d_y + j) * AREA_W + d_x], &block[j * MOVE_W], MOVE_W * 2);
+}
+
+static bool checkArea(int16_t dx, int16_t dy)
+{
+	for(int16_t y = 0; y < AREA_H; y++) {
+		for(int16_t x = 0; x < AREA_W; x++) {
+			uint16_t got = model.getPixel(tft.currentPage, tft.width(), x, y);
+			if(got != expected[y * AREA_W + x]) {
+				Serial.printf("move by %d,%d: pixel %d,%d is %04x, expected %04x\n", dx, dy, x, y, got, expected[y * AREA_W + x]);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static uint32_t sdramTraffic(void)
+{
+	tft.check2dBusy();
+	return model.stats().sdramReads + model.stats().sdramWrites;
+}
+
+int main(void)
+{
+	static const int16_t steps[] = {1, 5, 30, 70};	// 70 doesn't overlap at all
+	hostAttachSPI(&model, 10);
+	tft.setFastBoot(true);
+	CHECK(tft.begin());
+	for(int32_t i = 0; i < AREA_W * AREA_H; i++) pattern[i] = (uint16_t)(i * 2654435761u >> 13);
+
+	uint16_t cases = 0;
+	for(uint8_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+		for(int8_t ydir = -1; ydir <= 1; ydir++) {
+			for(int8_t xdir = -1; xdir <= 1; xdir++) {
+				if(!xdir && !ydir) continue;
+				int16_t dx = xdir * steps[s], dy = ydir * steps[s];
+				drawPattern();
+				moveReference(MOVE_X + dx, MOVE_Y + dy);
+				model.resetStats();
+				tft.bteMove(tft.currentPage, tft.width(), MOVE_X, MOVE_Y, MOVE_X + dx, MOVE_Y + dy, MOVE_W, MOVE_H);
+				tft.check2dBusy();
+				CHECK(checkArea(dx, dy));
+				CHECK(model.stats().busyStarts == 0);
+				cases++;
+			}
+		}
+	}
+	Serial.printf("%u overlapping and non overlapping moves checked\n", cases);
+
+	// SDRAM traffic, in pixels read and written
+	static const int16_t shifts[] = {1, 4, 10, 20};
+	const uint16_t w = 400, h = 200;
+	for(uint8_t s = 0; s < sizeof(shifts) / sizeof(shifts[0]); s++) {
+		model.resetStats();
+		tft.bteMove(tft.currentPage, tft.width(), 0, 0, 0, shifts[s], w, h);
+		uint32_t moved = sdramTraffic();
+		uint32_t copies = model.stats().bteOps[RA8876_BTE_MEMORY_COPY_WITH_ROP];
+		model.resetStats();
+		tft.bteMemoryCopy(tft.currentPage, tft.width(), 0, 0, PAGE10_START_ADDR, tft.width(), 0, 0, w, h);
+		tft.bteMemoryCopy(PAGE10_START_ADDR, tft.width(), 0, 0, tft.currentPage, tft.width(), 0, shifts[s], w, h);
+		uint32_t staged = sdramTraffic();
+		Serial.printf("%ux%u down %2d: bteMove %7lu pixels in %2lu copies, through PAGE10 %7lu pixels\n", w, h, shifts[s],
+					  (unsigned long)moved, (unsigned long)copies, (unsigned long)staged);
+		CHECK(moved <= staged);
+		// Only split into bands it can do in place when there aren't too many
+		if(((h + shifts[s] - 1) / shifts[s]) <= RA8876_MOVE_MAX_BANDS) CHECK(moved < staged);
+	}
+
+	CHECK(hostSpiErrors() == 0);
+	CHECK(model.stats().unsupported == 0);
+	CHECK(model.stats().outOfRange == 0);
+	return testResult("test_move");
+}
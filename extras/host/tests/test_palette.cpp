@@ -0,0 +1,117 @@
+//**************************************************************//
+/*
+ * test_palette.cpp
+ * Palette expansion at 8, 4, 2 and 1 bits per pixel. The
+ * paletteExpandRow() kernel against a pixel at a time reference
+ * for every start offset, then how many pixels per second it
+ * expands on this machine, then writeRect8BPP/writeRectNBPP through
+ * the SPI decoder: the pixels that land and the SPI use.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+#define IMAGE_W		320
+#define IMAGE_H		100
+#define ROW_W		1024
+#define ROWS		600
+#define PASSES		20
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+static const uint8_t depths[] = {8, 4, 2, 1};
+static uint16_t palette[256];
+static uint8_t pixels[ROWS * ROW_W];
+static uint16_t expanded[ROW_W], reference[ROW_W];
+
+// Pixel i of a packed row, most significant bits first
+static uint8_t pixelIndex(const uint8_t *row, uint32_t i, uint8_t bits_per_pixel)
+{
+	uint8_t per_byte = 8 / bits_per_pixel;
+	uint8_t shift = 8 - ((i % per_byte) + 1) * bits_per_pixel;
+	return (row[i / per_byte] >> shift) & ((1 << bits_per_pixel) - 1);
+}
+
+static bool checkKernel(uint8_t bits_per_pixel)
+{
+	static const uint16_t widths[] = {1, 3, 7, 8, 9, 31, 64, 333};
+	for(uint16_t skip = 0; skip < 8; skip++) {
+		for(uint8_t k = 0; k < sizeof(widths) / sizeof(widths[0]); k++) {
+			uint16_t w = widths[k];
+			for(uint16_t i = 0; i < w; i++) reference[i] = palette[pixelIndex(pixels, skip + i, bits_per_pixel)];
+			memset(expanded, 0, sizeof(expanded));
+			RA8876_t3::paletteExpandRow(expanded, pixels, skip, w, bits_per_pixel, palette);
+			if(memcmp(expanded, reference, w * 2) != 0) {
+				Serial.printf("%u bpp, skip %u, %u wide: expanded differently\n", bits_per_pixel, skip, w);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void timeKernel(uint8_t bits_per_pixel)
+{
+	uint32_t row_bytes = ROW_W * bits_per_pixel / 8;
+	uint32_t start = micros();
+	for(uint16_t pass = 0; pass < PASSES; pass++) {
+		for(uint16_t row = 0; row < ROWS; row++) {
+			RA8876_t3::paletteExpandRow(expanded, pixels + row * row_bytes, 0, ROW_W, bits_per_pixel, palette);
+		}
+	}
+	uint32_t us = micros() - start;
+	if(!us) us = 1;
+	Serial.printf("  %u bpp: %u frames of %ux%u in %7lu us, %7.1f Mpixels/s\n", bits_per_pixel, PASSES, ROW_W, ROWS,
+				  (unsigned long)us, (float)PASSES * ROWS * ROW_W / us);
+}
+
+static bool checkImage(uint8_t bits_per_pixel, int16_t y)
+{
+	uint16_t row_bytes = (IMAGE_W * bits_per_pixel + 7) / 8;
+	hostDmaWait();
+	for(int16_t j = 0; j < IMAGE_H; j++) {
+		for(int16_t i = 0; i < IMAGE_W; i++) {
+			uint16_t expect = palette[pixelIndex(pixels + j * row_bytes, i, bits_per_pixel)];
+			uint16_t got = model.getPixel(tft.currentPage, tft.width(), i, y + j);
+			if(got != expect) {
+				Serial.printf("%u bpp: pixel %d,%d is %04x, expected %04x\n", bits_per_pixel, i, y + j, got, expect);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+int main(void)
+{
+	for(uint16_t i = 0; i < 256; i++) palette[i] = (uint16_t)(i * 0x9e37 ^ 0x5a5a);
+	for(uint32_t i = 0; i < sizeof(pixels); i++) pixels[i] = (uint8_t)(i * 2654435761u >> 24);
+
+	for(uint8_t d = 0; d < sizeof(depths); d++) CHECK(checkKernel(depths[d]));
+
+	Serial.printf("paletteExpandRow on this machine:\n");
+	for(uint8_t d = 0; d < sizeof(depths); d++) timeKernel(depths[d]);
+
+	hostAttachSPI(&model, 10);
+	tft.setFastBoot(true);
+	CHECK(tft.begin());
+	Serial.printf("%ux%u through %s:\n", IMAGE_W, IMAGE_H, tft.bus()->name());
+	for(uint8_t d = 0; d < sizeof(depths); d++) {
+		int16_t y = d * (IMAGE_H + 10);
+		tft.resetSpiStats();
+		hostResetSpiStats();
+		if(depths[d] == 8) tft.writeRect8BPP(0, y, IMAGE_W, IMAGE_H, pixels, palette);
+		else tft.writeRectNBPP(0, y, IMAGE_W, IMAGE_H, depths[d], pixels, palette);
+		hostDmaWait();
+		Serial.printf("  %u bpp: transactions: %3lu CS asserts: %3lu SPI bytes per pixel: %.3f\n", depths[d],
+					  (unsigned long)tft.spiTransactionCount(), (unsigned long)tft.spiCSAssertCount(),
+					  (float)hostSpiBytes() / (IMAGE_W * IMAGE_H));
+		CHECK(checkImage(depths[d], y));
+	}
+
+	CHECK(tft.scratchFailures() == 0);
+	CHECK(hostSpiErrors() == 0);
+	CHECK(model.stats().unsupported == 0);
+	return testResult("test_palette");
+}
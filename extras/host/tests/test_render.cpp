@@ -0,0 +1,283 @@
+//**************************************************************//
+/*
+ * test_render.cpp
+ * Golden image checks of the main drawing paths against the model,
+ * going through RA8876SPIBus and the SPI decoder, and the number
+ * of SPI transactions each one takes. Leaves render.ppm behind.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+#define SCREEN_PIXELS	(1024 * 600)
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+static uint16_t pageWidth;
+
+// Compare a w x h block of the current page with colors
+static bool checkPage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *colors, const char *what)
+{
+	hostDmaWait();
+	for(int16_t j = 0; j < h; j++) {
+		for(int16_t i = 0; i < w; i++) {
+			uint16_t got = model.getPixel(tft.currentPage, pageWidth, x + i, y + j);
+			if(got != colors[j * w + i]) {
+				Serial.printf("%s: pixel %d,%d is %04x, expected %04x\n", what, x + i, y + j, got, colors[j * w + i]);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void makeImage(uint16_t *colors, int16_t w, int16_t h, uint16_t seed)
+{
+	for(int32_t i = 0; i < w * h; i++) colors[i] = (uint16_t)(i * 2654435761u >> 16) ^ seed;
+}
+
+static void report(const char *what)
+{
+	Serial.printf("  %-32s transactions: %5lu CS asserts: %5lu SPI bytes: %7lu\n", what, (unsigned long)tft.spiTransactionCount(),
+				  (unsigned long)tft.spiCSAssertCount(), (unsigned long)hostSpiBytes());
+	tft.resetSpiStats();
+	hostResetSpiStats();
+}
+
+static void testFillRect(void)
+{
+	static uint16_t expected[40 * 30];
+	for(uint16_t i = 0; i < 40 * 30; i++) expected[i] = RED;
+	tft.fillRect(10, 20, 40, 30, RED);
+	tft.check2dBusy();
+	CHECK(checkPage(10, 20, 40, 30, expected, "fillRect"));
+	CHECK(model.getPixel(tft.currentPage, pageWidth, 9, 20) != RED);
+	CHECK(model.getPixel(tft.currentPage, pageWidth, 50, 20) != RED);
+	CHECK(model.getPixel(tft.currentPage, pageWidth, 10, 50) != RED);
+	report("fillRect 40x30");
+}
+
+static void testWriteReadRect(void)
+{
+	static uint16_t image[100 * 50], back[100 * 50];
+	makeImage(image, 100, 50, 0);
+	tft.writeRect(200, 100, 100, 50, image);
+	report("writeRect 100x50");
+	CHECK(checkPage(200, 100, 100, 50, image, "writeRect"));
+
+	memset(back, 0, sizeof(back));
+	tft.readRect(200, 100, 100, 50, back);
+	report("readRect 100x50");
+	CHECK(memcmp(back, image, sizeof(image)) == 0);
+	CHECK(tft.getPixel(250, 120) == image[20 * 100 + 50]);
+
+	tft.drawPixel(5, 5, GREEN);
+	report("drawPixel");
+	CHECK(model.getPixel(tft.currentPage, pageWidth, 5, 5) == GREEN);
+}
+
+//**************************************************************//
+// Rotated writeRect, bigger than one RA8876_ROTATE_TILE_PIXELS
+// tile. Where image column i, row j ends up in memory, and that
+// readRect gives the same image back.
+//**************************************************************//
+static void testRotatedWriteRect(void)
+{
+	const int16_t x = 30, y = 40, w = 70, h = 40;
+	static uint16_t image[w * h], back[w * h];
+	for(uint8_t rotation = 1; rotation < 4; rotation++) {
+		makeImage(image, w, h, rotation);
+		tft.setRotation(rotation);
+		tft.resetSpiStats();
+		hostResetSpiStats();
+		tft.writeRect(x, y, w, h, image);
+		char what[32];
+		snprintf(what, sizeof(what), "writeRect 70x40 rotation %u", rotation);
+		report(what);
+		bool ok = true;
+		for(int16_t j = 0; ok && (j < h); j++) {
+			for(int16_t i = 0; ok && (i < w); i++) {
+				int16_t mx, my;
+				switch(rotation) {
+					case 1: mx = y + j; my = x + i; break;
+					case 2: mx = tft.width() - 1 - x - i; my = y + j; break;
+					default: mx = tft.height() - y - h + j; my = x + i; break;
+				}
+				hostDmaWait();
+				uint16_t got = model.getPixel(tft.currentPage, pageWidth, mx, my);
+				if(got != image[j * w + i]) {
+					Serial.printf("rotation %u: image %d,%d at %d,%d is %04x, expected %04x\n", rotation, i, j, mx, my, got, image[j * w + i]);
+					ok = false;
+				}
+			}
+		}
+		CHECK(ok);
+
+		memset(back, 0, sizeof(back));
+		tft.readRect(x, y, w, h, back);
+		snprintf(what, sizeof(what), "readRect 70x40 rotation %u", rotation);
+		report(what);
+		CHECK(memcmp(back, image, sizeof(image)) == 0);
+	}
+	tft.setRotation(0);
+}
+
+//**************************************************************//
+// A full screen image at each rotation, one writeRect each. The
+// SPI bytes are the same whichever way round it is, rotated only
+// adds a transaction per tile. readRect has to give it back.
+//**************************************************************//
+static void testFullScreenRotations(void)
+{
+	static uint16_t image[SCREEN_PIXELS], back[SCREEN_PIXELS];
+	for(uint8_t rotation = 0; rotation < 4; rotation++) {
+		tft.setRotation(rotation);
+		int16_t w = tft.width(), h = tft.height();
+		CHECK(w * h <= SCREEN_PIXELS);
+		makeImage(image, w, h, 0x1000 * rotation);
+		tft.resetSpiStats();
+		hostResetSpiStats();
+		tft.writeRect(0, 0, w, h, image);
+		hostDmaWait();
+		char what[40];
+		snprintf(what, sizeof(what), "writeRect %dx%d rotation %u", w, h, rotation);
+		report(what);
+		tft.readRect(0, 0, w, h, back);
+		tft.resetSpiStats();
+		hostResetSpiStats();
+		CHECK(memcmp(back, image, w * h * 2) == 0);
+	}
+	tft.setRotation(0);
+}
+
+// drawPixels has to put each pixel where drawPixel does, runs included
+static void testDrawPixels(void)
+{
+	static const primPixel_t pixels[] = {
+		{100, 50, RED}, {101, 50, GREEN}, {102, 50, BLUE}, {7, 9, YELLOW}, {60, 200, CYAN},
+	};
+	const uint8_t count = sizeof(pixels) / sizeof(pixels[0]);
+	for(uint8_t rotation = 0; rotation < 4; rotation++) {
+		tft.setRotation(rotation);
+		tft.drawPixels(pixels, count);
+		char what[32];
+		snprintf(what, sizeof(what), "drawPixels %u rotation %u", count, rotation);
+		report(what);
+		bool ok = true;
+		for(uint8_t i = 0; i < count; i++) {
+			uint16_t got = tft.getPixel(pixels[i].x, pixels[i].y);
+			tft.drawPixel(pixels[i].x, pixels[i].y, ~pixels[i].color);
+			if((got != pixels[i].color) || (tft.getPixel(pixels[i].x, pixels[i].y) != (uint16_t)~pixels[i].color)) {
+				Serial.printf("rotation %u: drawPixels %d,%d is %04x, expected %04x\n", rotation, pixels[i].x, pixels[i].y, got, pixels[i].color);
+				ok = false;
+			}
+		}
+		CHECK(ok);
+		tft.resetSpiStats();
+		hostResetSpiStats();
+	}
+	tft.setRotation(0);
+}
+
+//**************************************************************//
+// Linear and radial gradients stream into one BTE window. The
+// colors only depend on where a pixel is on the rectangle, so
+// rotations 1 and 2 have to read back the same as rotation 0.
+//**************************************************************//
+static void testGradients(void)
+{
+	const int16_t x = 20, y = 300, w = 300, h = 120;
+	static uint16_t expected[w * h], back[w * h];
+	for(uint8_t radial = 0; radial < 2; radial++) {
+		for(uint8_t rotation = 0; rotation < 3; rotation++) {
+			tft.setRotation(rotation);
+			tft.resetSpiStats();
+			hostResetSpiStats();
+			if(radial) tft.fillRectRadialGradient(x, y, w, h, RED, BLUE);
+			else tft.fillRectLinearGradient(x, y, w, h, RED, BLUE, 30);
+			char what[40];
+			snprintf(what, sizeof(what), "%s gradient 300x120 rotation %u", radial ? "radial" : "linear", rotation);
+			report(what);
+			tft.readRect(x, y, w, h, rotation ? back : expected);
+			tft.resetSpiStats();
+			hostResetSpiStats();
+			if(rotation) CHECK(memcmp(back, expected, sizeof(back)) == 0);
+		}
+		CHECK(expected[0] != expected[(h / 2) * w + w / 2]);
+	}
+	tft.setRotation(0);
+}
+
+// The palette versions have to come out the same as writeRect
+static void testPaletteWriteRect(void)
+{
+	const int16_t w = 64, h = 20;
+	static uint8_t pixels8[w * h], pixels4[w * h / 2];
+	static uint16_t palette[256], expected[w * h];
+	for(uint16_t i = 0; i < 256; i++) palette[i] = i * 0x0101 ^ 0x1234;
+	for(int32_t i = 0; i < w * h; i++) {
+		pixels8[i] = i * 7;
+		expected[i] = palette[pixels8[i]];
+	}
+	tft.writeRect8BPP(400, 300, w, h, pixels8, palette);
+	report("writeRect8BPP 64x20");
+	CHECK(checkPage(400, 300, w, h, expected, "writeRect8BPP"));
+
+	for(int32_t i = 0; i < w * h; i += 2) {
+		pixels4[i / 2] = ((i % 16) << 4) | ((i + 1) % 16);
+		expected[i] = palette[i % 16];
+		expected[i + 1] = palette[(i + 1) % 16];
+	}
+	tft.writeRect4BPP(400, 340, w, h, pixels4, palette);
+	report("writeRect4BPP 64x20");
+	CHECK(checkPage(400, 340, w, h, expected, "writeRect4BPP"));
+}
+
+// Two bands of color, one literal and a long run each
+static void testPackedImage(void)
+{
+	const int16_t w = 40, h = 30;
+	static const uint8_t packed[] = {
+		'R', 'P', RA8876_PACKED_RGB565, 0, w, 0, h, 0,
+		RA8876_PACKED_OP_LITERAL, 0x1f, 0xf8,
+		RA8876_PACKED_OP_LONGRUN | ((w * h / 2 - 1 - 65) >> 8), (w * h / 2 - 1 - 65) & 0xff,
+		RA8876_PACKED_OP_LITERAL, 0xe0, 0x07,
+		RA8876_PACKED_OP_LONGRUN | ((w * h / 2 - 1 - 65) >> 8), (w * h / 2 - 1 - 65) & 0xff,
+	};
+	static uint16_t expected[w * h];
+	for(int32_t i = 0; i < w * h; i++) expected[i] = (i < w * h / 2) ? 0xf81f : 0x07e0;
+	CHECK(tft.drawPackedImage(600, 100, packed, sizeof(packed)));
+	report("drawPackedImage 40x30");
+	CHECK(checkPage(600, 100, w, h, expected, "drawPackedImage"));
+}
+
+int main(void)
+{
+	hostAttachSPI(&model, 10);
+	CHECK(tft.begin());
+	pageWidth = tft.width();
+	CHECK(model.panelWidth() == pageWidth);
+	CHECK(model.panelHeight() == tft.height());
+	Serial.printf("Per call SPI use, %s:\n", tft.bus()->name());
+	tft.resetSpiStats();
+	hostResetSpiStats();
+
+	testFillRect();
+	testWriteReadRect();
+	testRotatedWriteRect();
+	testFullScreenRotations();
+	testDrawPixels();
+	testGradients();
+	testPaletteWriteRect();
+	testPackedImage();
+
+	hostDmaWait();
+	CHECK(tft.scratchFailures() == 0);
+	CHECK(hostSpiErrors() == 0);
+	CHECK(model.stats().unsupported == 0);
+	CHECK(model.stats().outOfRange == 0);
+	model.printStats(Serial);
+	CHECK(model.writePPM("render.ppm"));
+	return testResult("test_render");
+}
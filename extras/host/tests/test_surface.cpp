@@ -0,0 +1,86 @@
+//**************************************************************//
+/*
+ * test_surface.cpp
+ * SDRAM surfaces and the screen pages around them: the lazy page
+ * clears after setFastBoot() leaving surfaces and BTE copies alone,
+ * drawing into a selected surface and going back to the pages with
+ * selectScreen().
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+static RA8876Model model;
+static RA8876_t3 tft = RA8876_t3(10, 255);
+
+//**************************************************************//
+// Surfaces on the unused screen pages, the way the header suggests,
+// and a BTE copy into a page nothing has selected yet. Clearing the
+// rest of the pages mustn't touch either.
+//**************************************************************//
+static void testPageClears(void)
+{
+	CHECK(tft.surfaceCount() == 0);
+	CHECK(tft.setSurfaceHeap(PAGE5_START_ADDR, RA8876_GLYPH_CACHE_ADDR));
+	int16_t surface = tft.surfaceAlloc(64, 32);
+	CHECK(tft.surfaceAddress(surface) >= PAGE5_START_ADDR);
+	tft.bteSolidFill(tft.surfaceAddress(surface), tft.surfaceImageWidth(surface), 0, 0, 64, 32, RED);
+	tft.fillRect(0, 0, 20, 20, GREEN);
+	tft.bteMemoryCopy(PAGE1_START_ADDR, tft.width(), 0, 0, PAGE3_START_ADDR, tft.width(), 100, 100, 20, 20);
+
+	uint16_t services = 0;
+	while(tft.pageClearService()) services++;
+	tft.check2dBusy();
+	Serial.printf("%u pageClearService calls\n", services);
+	CHECK(model.getPixel(PAGE2_START_ADDR, tft.width(), 100, 100) == COLOR65K_DARKBLUE);
+	CHECK(model.getPixel(PAGE4_START_ADDR, tft.width(), 100, 100) == COLOR65K_DARKBLUE);
+	CHECK(model.getPixel(PAGE3_START_ADDR, tft.width(), 110, 110) == GREEN);
+	CHECK(model.getPixel(tft.surfaceAddress(surface), tft.surfaceImageWidth(surface), 63, 31) == RED);
+	tft.selectScreen(PAGE3_START_ADDR);
+	tft.selectScreen(PAGE5_START_ADDR);
+	tft.selectScreen(PAGE1_START_ADDR);
+	tft.check2dBusy();
+	CHECK(model.getPixel(PAGE3_START_ADDR, tft.width(), 110, 110) == GREEN);
+	CHECK(model.getPixel(tft.surfaceAddress(surface), tft.surfaceImageWidth(surface), 63, 31) == RED);
+
+	tft.surfaceFree(surface);
+	CHECK(tft.setSurfaceHeap(RA8876_SURFACE_HEAP_START, MEM_SIZE_MAX));
+}
+
+// selectScreen() while a surface is selected goes back to the page first
+static void testSelectScreen(void)
+{
+	int16_t width = tft.width(), height = tft.height();
+	int16_t surface = tft.surfaceAlloc(100, 50);
+	CHECK(surface >= 0);
+	CHECK(tft.surfaceSelect(surface));
+	tft.fillRect(0, 0, 100, 50, RED);
+	tft.selectScreen(PAGE2_START_ADDR);
+	CHECK(tft.currentPage == PAGE2_START_ADDR);
+	CHECK((tft.width() == width) && (tft.height() == height));
+	tft.selectScreen(PAGE1_START_ADDR);
+	CHECK(tft.currentPage == PAGE1_START_ADDR);
+	CHECK((tft.width() == width) && (tft.height() == height));
+	// Drawing is on the page again, not the surface
+	tft.fillRect(0, 0, 200, 100, BLUE);
+	tft.check2dBusy();
+	CHECK(model.getPixel(PAGE1_START_ADDR, width, 150, 80) == BLUE);
+	CHECK(model.getPixel(tft.surfaceAddress(surface), tft.surfaceImageWidth(surface), 10, 10) == RED);
+	tft.surfaceFree(surface);
+}
+
+int main(void)
+{
+	hostAttachSPI(&model, 10);
+	tft.setFastBoot(true);
+	CHECK(tft.begin());
+
+	testPageClears();
+	testSelectScreen();
+
+	CHECK(hostSpiErrors() == 0);
+	CHECK(model.stats().unsupported == 0);
+	CHECK(model.stats().outOfRange == 0);
+	return testResult("test_surface");
+}
@@ -0,0 +1,118 @@
+//**************************************************************//
+/*
+ * test_trace.cpp
+ * The same drawing sequence through two backends, each behind an
+ * RA8876MockBus recording every cycle:
+ *	A: RA8876SPIBus, decoded by the SPI stub into model A
+ *	B: RA8876ModelBus, straight into model B
+ * The two traces have to match cycle for cycle, the SPI decoder has
+ * to see what mock A recorded, and the two SDRAMs have to end up
+ * the same.
+ */
+//**************************************************************//
+#include "RA8876_t3.h"
+#include "host.h"
+#include "test.h"
+
+#define TRACE_SIZE	65536
+
+static RA8876Model modelA, modelB;
+static RA8876SPIBus spiBus(10);
+static RA8876ModelBus modelBus(modelB);
+static busTrace_t traceA[TRACE_SIZE], traceB[TRACE_SIZE], traceSPI[TRACE_SIZE];
+static RA8876MockBus mockA(traceA, TRACE_SIZE, &spiBus);
+static RA8876MockBus mockB(traceB, TRACE_SIZE, &modelBus);
+static RA8876_t3 tftA(mockA);
+static RA8876_t3 tftB(mockB);
+
+// Exercises register, data, status, read and burst paths
+static void drawSequence(RA8876_t3 &tft)
+{
+	static uint16_t image[48 * 32];
+	static uint16_t back[16 * 8];
+	static uint8_t pixels[32 * 16];
+	static uint16_t palette[256];
+	for(uint16_t i = 0; i < 48 * 32; i++) image[i] = i * 37;
+	for(uint16_t i = 0; i < 32 * 16; i++) pixels[i] = i;
+	for(uint16_t i = 0; i < 256; i++) palette[i] = i * 0x0421;
+
+	tft.fillRect(10, 10, 100, 60, BLUE);
+	tft.drawLine(0, 0, 200, 120, WHITE);
+	tft.drawRect(150, 20, 80, 40, YELLOW);
+	tft.fillCircle(300, 200, 40, RED);
+	tft.fillRoundRect(400, 50, 120, 60, 10, 8, GREEN);
+	tft.fillTriangle(20, 300, 120, 250, 90, 380, CYAN);
+	tft.drawPixel(600, 400, MAGENTA);
+	tft.writeRect(500, 300, 48, 32, image);
+	tft.writeRect8BPP(700, 300, 32, 16, pixels, palette);
+	tft.readRect(500, 300, 16, 8, back);
+	tft.bteMove(tft.currentPage, tft.width(), 500, 300, 520, 310, 48, 32);
+	tft.setRotation(1);
+	tft.writeRect(100, 100, 48, 32, image);
+	tft.setRotation(0);
+	tft.check2dBusy();
+}
+
+// Mock A's trace with the empty frames taken out, like the SPI decoder sees it
+static bool checkDecoded(void)
+{
+	uint32_t n = 0;
+	bool frame = false;	// anything since the last FRAME_END
+	for(uint32_t i = 0; i < mockA.traceCount(); i++) {
+		const busTrace_t *t = &traceA[i];
+		if(t->cycle == RA8876_CYCLE_FRAME_END) {
+			if(!frame) continue;
+			frame = false;
+		} else {
+			frame = true;
+		}
+		if((n >= hostSpiTraceCount()) || (traceSPI[n].cycle != t->cycle) || (traceSPI[n].value != t->value)) {
+			Serial.printf("SPI decoder differs from mock A at cycle %lu (mock %lu)\n", (unsigned long)n, (unsigned long)i);
+			mockA.printTrace(Serial, (i > 8) ? i - 8 : 0, 16);
+			return false;
+		}
+		n++;
+	}
+	return n == hostSpiTraceCount();
+}
+
+int main(void)
+{
+	hostAttachSPI(&modelA, 10);
+	mockA.traceStatusReads(true);
+	mockB.traceStatusReads(true);
+	tftA.setFastBoot(true);
+	tftB.setFastBoot(true);
+	CHECK(tftA.begin());
+	CHECK(tftB.begin());
+	CHECK(mockA.traceCompare(mockB) == mockA.traceCount());
+
+	hostSpiFlush();
+	hostSpiTrace(traceSPI, TRACE_SIZE);
+	mockA.resetTrace();
+	mockB.resetTrace();
+	drawSequence(tftA);
+	drawSequence(tftB);
+	hostDmaWait();
+	hostSpiFlush();
+
+	Serial.printf("Mock A: %lu cycles hash %08lx, mock B: %lu cycles hash %08lx, SPI: %lu cycles\n",
+				  (unsigned long)mockA.traceCount(), (unsigned long)mockA.traceHash(),
+				  (unsigned long)mockB.traceCount(), (unsigned long)mockB.traceHash(), (unsigned long)hostSpiTraceCount());
+	CHECK(!mockA.traceOverflow());
+	CHECK(hostSpiTraceCount() <= TRACE_SIZE);
+	uint32_t diff = mockA.traceCompare(mockB);
+	if(diff != mockA.traceCount()) {
+		Serial.printf("Mock A and B differ at cycle %lu\n", (unsigned long)diff);
+		mockA.printTrace(Serial, (diff > 8) ? diff - 8 : 0, 16);
+		mockB.printTrace(Serial, (diff > 8) ? diff - 8 : 0, 16);
+	}
+	CHECK(diff == mockA.traceCount());
+	CHECK(checkDecoded());
+	CHECK(modelA.getPixel(tftA.currentPage, tftA.width(), 20, 20) == BLUE);
+	CHECK(memcmp(modelA.sdram(), modelB.sdram(), modelA.sdramSize()) == 0);
+	CHECK(hostDmaStarted() > 0);
+	CHECK(hostSpiErrors() == 0);
+	CHECK(modelA.stats().unsupported == 0);
+	return testResult("test_trace");
+}
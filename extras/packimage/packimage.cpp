@@ -0,0 +1,358 @@
+//**************************************************************//
+/*
+packimage: pack an image into a header for RA8876_t3::drawPackedImage()
+
+Build on the host with:
+	g++ -O2 -o packimage packimage.cpp
+
+Usage:
+	packimage [-n name] [-o out.h] [-p | -r] image.ppm
+	packimage [-n name] [-o out.h] [-p | -r] image.bmp
+	packimage -w width -h height [-n name] [-o out.h] [-p | -r] image.h
+
+image.h is an RGB565 array like the ones in examples/RA8876_pictureEmbed
+(every 0x.... number after the first '{' is a pixel). BMP files have to
+be uncompressed 24 or 32 bits per pixel, PPM files binary (P6).
+-p only tries the palette format, -r only RGB565. By default both are
+tried when there are 256 colors or less and the smaller one is kept.
+
+Draw it with:
+	#include "image_packed.h"
+	tft.drawPackedImage(x, y, image_packed, sizeof(image_packed));
+
+The format is described with the RA8876_PACKED_ defines in RA8876Registers.h.
+*/
+//**************************************************************//
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#define PACKED_RGB565		0
+#define PACKED_PALETTE		1
+#define PACKED_OP_RUN		0x00
+#define PACKED_OP_INDEX		0x40
+#define PACKED_OP_DIFF		0x80
+#define PACKED_OP_LITERAL	0xc0
+#define PACKED_OP_LONGRUN	0xe0
+#define PACKED_HASH(c)		((((c) >> 11) * 3 + (((c) >> 5) & 0x3f) * 5 + ((c) & 0x1f) * 7) & 0x3f)
+
+static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+	return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+}
+
+static bool readFile(const char *name, std::vector<uint8_t> &data) {
+	FILE *f = fopen(name, "rb");
+	if (!f) return false;
+	uint8_t buf[4096];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+	fclose(f);
+	return true;
+}
+
+//**************************************************************//
+// Image readers, all return RGB565 pixels top row first
+//**************************************************************//
+static bool ppmNumber(const std::vector<uint8_t> &data, size_t &pos, int &value) {
+	while (pos < data.size()) {
+		if (data[pos] == '#') {
+			while ((pos < data.size()) && (data[pos] != '\n')) pos++;
+		} else if (isspace(data[pos])) {
+			pos++;
+		} else {
+			break;
+		}
+	}
+	if ((pos >= data.size()) || !isdigit(data[pos])) return false;
+	value = 0;
+	while ((pos < data.size()) && isdigit(data[pos])) value = value * 10 + (data[pos++] - '0');
+	return true;
+}
+
+static bool readPPM(const std::vector<uint8_t> &data, int &w, int &h, std::vector<uint16_t> &pixels) {
+	size_t pos = 2;
+	int maxval;
+	if (!ppmNumber(data, pos, w) || !ppmNumber(data, pos, h) || !ppmNumber(data, pos, maxval)) return false;
+	if ((maxval <= 0) || (maxval > 255)) {
+		fprintf(stderr, "packimage: only 8 bit PPM files are supported\n");
+		return false;
+	}
+	pos++;	// the one whitespace after maxval
+	if ((pos + (size_t)w * h * 3) > data.size()) return false;
+	for (int i = 0; i < w * h; i++, pos += 3) {
+		pixels.push_back(color565(data[pos] * 255 / maxval, data[pos + 1] * 255 / maxval, data[pos + 2] * 255 / maxval));
+	}
+	return true;
+}
+
+static uint32_t le32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+static bool readBMP(const std::vector<uint8_t> &data, int &w, int &h, std::vector<uint16_t> &pixels) {
+	if (data.size() < 54) return false;
+	uint32_t offset = le32(&data[10]);
+	w = (int32_t)le32(&data[18]);
+	h = (int32_t)le32(&data[22]);
+	int bpp = data[28] | (data[29] << 8);
+	uint32_t compression = le32(&data[30]);
+	bool top_down = h < 0;
+	if (top_down) h = -h;
+	if (((bpp != 24) && (bpp != 32)) || ((compression != 0) && !((compression == 3) && (bpp == 32)))) {
+		fprintf(stderr, "packimage: only uncompressed 24 and 32 bit BMP files are supported\n");
+		return false;
+	}
+	size_t stride = ((size_t)w * (bpp / 8) + 3) & ~3;
+	if ((w <= 0) || ((offset + stride * h) > data.size())) return false;
+	for (int y = 0; y < h; y++) {
+		const uint8_t *row = &data[offset + stride * (top_down ? y : (h - 1 - y))];
+		for (int x = 0; x < w; x++, row += bpp / 8) pixels.push_back(color565(row[2], row[1], row[0]));
+	}
+	return true;
+}
+
+static bool readArray(const std::vector<uint8_t> &data, std::vector<uint16_t> &pixels) {
+	std::string text(data.begin(), data.end());
+	size_t pos = text.find('{');
+	if (pos == std::string::npos) return false;
+	while (pos < text.size()) {
+		if (text.compare(pos, 2, "//") == 0) {
+			pos = text.find('\n', pos);
+			if (pos == std::string::npos) break;
+		} else if (text.compare(pos, 2, "/*") == 0) {
+			pos = text.find("*/", pos);
+			if (pos == std::string::npos) break;
+			pos += 2;
+		} else if ((text.compare(pos, 2, "0x") == 0) || (text.compare(pos, 2, "0X") == 0)) {
+			char *end;
+			pixels.push_back((uint16_t)strtoul(text.c_str() + pos, &end, 16));
+			pos = end - text.c_str();
+		} else if (text[pos] == '}') {
+			break;
+		} else {
+			pos++;
+		}
+	}
+	return true;
+}
+
+//**************************************************************//
+// Encoders, the mirror image of RA8876_t3::_packedDecode()
+//**************************************************************//
+static void encodeRun(std::vector<uint8_t> &out, uint32_t run) {
+	while (run) {
+		if (run >= 65) {
+			uint32_t n = std::min(run, (uint32_t)(0x1fff + 65));
+			out.push_back(PACKED_OP_LONGRUN | ((n - 65) >> 8));
+			out.push_back((n - 65) & 0xff);
+			run -= n;
+		} else {
+			out.push_back(PACKED_OP_RUN | (run - 1));
+			run = 0;
+		}
+	}
+}
+
+static int diffOp(uint16_t prev, uint16_t c) {
+	int dr = (c >> 11) - (prev >> 11);
+	int dg = ((c >> 5) & 0x3f) - ((prev >> 5) & 0x3f);
+	int db = (c & 0x1f) - (prev & 0x1f);
+	if ((dr < -2) || (dr > 1) || (dg < -2) || (dg > 1) || (db < -2) || (db > 1)) return -1;
+	return PACKED_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2);
+}
+
+static void encodeRGB565(const std::vector<uint16_t> &pixels, std::vector<uint8_t> &out) {
+	uint16_t index[64] = {0};
+	uint16_t prev = 0;
+	size_t i = 0;
+	while (i < pixels.size()) {
+		uint16_t c = pixels[i];
+		if (c == prev) {
+			size_t j = i;
+			while ((j < pixels.size()) && (pixels[j] == prev)) j++;
+			encodeRun(out, j - i);
+			i = j;
+		} else if (index[PACKED_HASH(c)] == c) {
+			out.push_back(PACKED_OP_INDEX | PACKED_HASH(c));
+			prev = c;
+			i++;
+		} else if (diffOp(prev, c) >= 0) {
+			out.push_back(diffOp(prev, c));
+			index[PACKED_HASH(c)] = c;
+			prev = c;
+			i++;
+		} else {
+			// Take literals while nothing cheaper would do
+			size_t tag = out.size();
+			out.push_back(PACKED_OP_LITERAL);
+			uint8_t n = 0;
+			do {
+				out.push_back(c & 0xff);
+				out.push_back(c >> 8);
+				index[PACKED_HASH(c)] = c;
+				prev = c;
+				n++;
+				i++;
+				if (i == pixels.size()) break;
+				c = pixels[i];
+			} while ((n < 32) && (c != prev) && (index[PACKED_HASH(c)] != c) && (diffOp(prev, c) < 0));
+			out[tag] = PACKED_OP_LITERAL | (n - 1);
+		}
+	}
+}
+
+static bool encodePalette(const std::vector<uint16_t> &pixels, std::vector<uint8_t> &out) {
+	// Most used colors first, they get the one byte index op
+	std::map<uint16_t, uint32_t> counts;
+	for (uint16_t c : pixels) counts[c]++;
+	if (counts.size() > 256) return false;
+	std::vector<std::pair<uint32_t, uint16_t> > order;
+	for (auto &e : counts) order.push_back(std::make_pair(e.second, e.first));
+	std::stable_sort(order.begin(), order.end(),
+		[](const std::pair<uint32_t, uint16_t> &a, const std::pair<uint32_t, uint16_t> &b) { return a.first > b.first; });
+	std::map<uint16_t, uint8_t> lookup;
+	out[3] = order.size() - 1;
+	for (size_t i = 0; i < order.size(); i++) {
+		lookup[order[i].second] = i;
+		out.push_back(order[i].second & 0xff);
+		out.push_back(order[i].second >> 8);
+	}
+
+	uint16_t prev = 0;
+	size_t i = 0;
+	while (i < pixels.size()) {
+		uint16_t c = pixels[i];
+		if (c == prev) {
+			size_t j = i;
+			while ((j < pixels.size()) && (pixels[j] == prev)) j++;
+			encodeRun(out, j - i);
+			i = j;
+		} else if (lookup[c] < 64) {
+			out.push_back(PACKED_OP_INDEX | lookup[c]);
+			prev = c;
+			i++;
+		} else {
+			size_t tag = out.size();
+			out.push_back(PACKED_OP_LITERAL);
+			uint8_t n = 0;
+			do {
+				out.push_back(lookup[c]);
+				prev = c;
+				n++;
+				i++;
+				if (i == pixels.size()) break;
+				c = pixels[i];
+			} while ((n < 32) && (c != prev));
+			out[tag] = PACKED_OP_LITERAL | (n - 1);
+		}
+	}
+	return true;
+}
+
+static void header(std::vector<uint8_t> &out, uint8_t format, int w, int h) {
+	uint8_t bytes[8] = {'R', 'P', format, 0, (uint8_t)(w & 0xff), (uint8_t)(w >> 8), (uint8_t)(h & 0xff), (uint8_t)(h >> 8)};
+	out.assign(bytes, bytes + 8);
+}
+
+static void usage(void) {
+	fprintf(stderr, "usage: packimage [-w width -h height] [-n name] [-o out.h] [-p | -r] image.ppm|image.bmp|image.h\n");
+	exit(1);
+}
+
+int main(int argc, char **argv) {
+	int w = 0, h = 0;
+	const char *name = nullptr;
+	const char *out_name = nullptr;
+	const char *in_name = nullptr;
+	bool try_palette = true, try_rgb565 = true;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-w") && (i + 1 < argc)) w = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-h") && (i + 1 < argc)) h = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-n") && (i + 1 < argc)) name = argv[++i];
+		else if (!strcmp(argv[i], "-o") && (i + 1 < argc)) out_name = argv[++i];
+		else if (!strcmp(argv[i], "-p")) try_rgb565 = false;
+		else if (!strcmp(argv[i], "-r")) try_palette = false;
+		else if ((argv[i][0] != '-') && !in_name) in_name = argv[i];
+		else usage();
+	}
+	if (!in_name) usage();
+
+	std::vector<uint8_t> data;
+	if (!readFile(in_name, data)) {
+		fprintf(stderr, "packimage: can't read %s\n", in_name);
+		return 1;
+	}
+	std::vector<uint16_t> pixels;
+	bool ok;
+	if ((data.size() > 2) && (data[0] == 'P') && (data[1] == '6')) {
+		ok = readPPM(data, w, h, pixels);
+	} else if ((data.size() > 2) && (data[0] == 'B') && (data[1] == 'M')) {
+		ok = readBMP(data, w, h, pixels);
+	} else {
+		ok = readArray(data, pixels);
+		if (ok && ((w <= 0) || (h <= 0) || (pixels.size() > (size_t)w * h))) {
+			fprintf(stderr, "packimage: %s has %zu pixels, give its size with -w and -h\n", in_name, pixels.size());
+			return 1;
+		}
+		// The compiler zero fills a short array, do the same
+		if (ok && (pixels.size() < (size_t)w * h)) {
+			fprintf(stderr, "packimage: %s is %zu pixels short, they will be black\n", in_name, (size_t)w * h - pixels.size());
+			pixels.resize((size_t)w * h, 0);
+		}
+	}
+	if (!ok || (w <= 0) || (h <= 0) || (w > 0x7fff) || (h > 0x7fff)) {
+		fprintf(stderr, "packimage: can't decode %s\n", in_name);
+		return 1;
+	}
+
+	std::vector<uint8_t> packed, palette;
+	if (try_rgb565) {
+		header(packed, PACKED_RGB565, w, h);
+		encodeRGB565(pixels, packed);
+	}
+	if (try_palette) {
+		header(palette, PACKED_PALETTE, w, h);
+		if (encodePalette(pixels, palette)) {
+			if (packed.empty() || (palette.size() < packed.size())) packed.swap(palette);
+		} else if (!try_rgb565) {
+			fprintf(stderr, "packimage: %s has more than 256 colors\n", in_name);
+			return 1;
+		}
+	}
+
+	// Default name is the file name, less the path and extension
+	std::string array_name;
+	if (name) {
+		array_name = name;
+	} else {
+		array_name = in_name;
+		size_t slash = array_name.find_last_of("/\\");
+		if (slash != std::string::npos) array_name.erase(0, slash + 1);
+		size_t dot = array_name.find('.');
+		if (dot != std::string::npos) array_name.erase(dot);
+		for (char &ch : array_name) if (!isalnum((unsigned char)ch)) ch = '_';
+		array_name += "_packed";
+	}
+
+	FILE *out = out_name ? fopen(out_name, "w") : stdout;
+	if (!out) {
+		fprintf(stderr, "packimage: can't write %s\n", out_name);
+		return 1;
+	}
+	fprintf(out, "// Packed by packimage from %s\n", in_name);
+	fprintf(out, "// %dx%d %s, %u bytes raw, %u bytes packed\n", w, h,
+			(packed[2] == PACKED_PALETTE) ? "palette" : "RGB565", (unsigned)(w * h * 2), (unsigned)packed.size());
+	fprintf(out, "// tft.drawPackedImage(x, y, %s, sizeof(%s));\n\n", array_name.c_str(), array_name.c_str());
+	fprintf(out, "const uint8_t %s[%u] PROGMEM = {\n", array_name.c_str(), (unsigned)packed.size());
+	for (size_t i = 0; i < packed.size(); i++) {
+		fprintf(out, "0x%02X,%s", packed[i], ((i % 16) == 15) ? "\n" : " ");
+	}
+	fprintf(out, "%s};\n", ((packed.size() % 16) != 0) ? "\n" : "");
+	if (out_name) fclose(out);
+	fprintf(stderr, "%s: %dx%d, %u bytes raw, %u bytes packed\n", in_name, w, h, (unsigned)(w * h * 2), (unsigned)packed.size());
+	return 0;
+}
@@ -0,0 +1,534 @@
+//**************************************************************//
+/*
+ * RA8876Bus.cpp
+ * Host interface (bus) backends for RA8876_t3, see RA8876Bus.h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+//**************************************************************//
+#include "RA8876Bus.h"
+
+#ifndef FLASHMEM
+#define FLASHMEM
+#endif
+
+//**************************************************************//
+// RA8876SPIBus
+//**************************************************************//
+RA8876SPIBus::RA8876SPIBus(uint8_t cs, uint8_t mosi, uint8_t sclk, uint8_t miso)
+{
+	_cs = cs;
+	_mosi = mosi;
+	_sclk = sclk;
+	_miso = miso;
+}
+
+//**************************************************************//
+// Figure out which SPI buss the pins are on and start it up
+//**************************************************************//
+FLASHMEM bool RA8876SPIBus::begin(uint32_t clock)
+{
+	_clock = clock;
+	if (SPI.pinIsMOSI(_mosi) && ((_miso == 0xff) || SPI.pinIsMISO(_miso)) && SPI.pinIsSCK(_sclk)) {
+		_pspi = &SPI;
+	#if defined(__MK64FX512__) || defined(__MK66FX1M0__) || defined(__IMXRT1062__) || defined(__MKL26Z64__)
+	} else if (SPI1.pinIsMOSI(_mosi) && ((_miso == 0xff) || SPI1.pinIsMISO(_miso)) && SPI1.pinIsSCK(_sclk)) {
+		_pspi = &SPI1;
+	#if !defined(__MKL26Z64__)
+	} else if (SPI2.pinIsMOSI(_mosi) && ((_miso == 0xff) || SPI2.pinIsMISO(_miso)) && SPI2.pinIsSCK(_sclk)) {
+		_pspi = &SPI2;
+	#endif
+	#endif
+	} else {
+		Serial.println("RA8876_t3: The IO pins on the constructor are not valid SPI pins");
+		Serial.printf("    mosi:%d miso:%d SCLK:%d CS:%d\n", _mosi, _miso, _sclk, _cs); Serial.flush();
+		return false;  // most likely will go bomb
+	}
+	// Make sure we have all of the proper SPI pins selected.
+	_pspi->setMOSI(_mosi);
+	_pspi->setSCK(_sclk);
+	if (_miso != 0xff) _pspi->setMISO(_miso);
+
+	// And startup SPI...
+	_pspi->begin();
+
+	// for this round will punt on trying to use CS as hardware CS...
+#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x
+	_csport = portOutputRegister(_cs);
+	_cspinmask = digitalPinToBitMask(_cs);
+	pinMode(_cs, OUTPUT);
+	deselect();
+#else
+	pinMode(_cs, OUTPUT);
+	_csport    = portOutputRegister(digitalPinToPort(_cs));
+	_cspinmask = digitalPinToBitMask(_cs);
+	*_csport |= _cspinmask;
+#endif
+	return true;
+}
+
+//**************************************************************//
+// Register and value in one go, the common case
+//**************************************************************//
+void RA8876SPIBus::writeRegData(uint8_t reg, uint8_t data)
+{
+	if(_cycle != RA8876_CYCLE_NONE) {
+		writeCommand(reg);
+		writeData(data);
+		return;
+	}
+	uint8_t buf[4] = {RA8876_SPI_CMDWRITE, reg, RA8876_SPI_DATAWRITE, data };
+	_pspi->transfer(buf, nullptr, 4);
+	_cycle = RA8876_CYCLE_DATAWRITE;
+	_bytes += 4;
+}
+
+void RA8876SPIBus::writeData16(uint16_t data)
+{
+	_cycleStart(RA8876_CYCLE_DATAWRITE, RA8876_SPI_DATAWRITE);
+	_pspi->transfer16(data);
+	_bytes += 2;
+}
+
+void RA8876SPIBus::writeDataBuffer(const void *buf, uint32_t len)
+{
+	_cycleStart(RA8876_CYCLE_DATAWRITE, RA8876_SPI_DATAWRITE);
+	//If you try _pspi->transfer(data, length) then this tries to write received data into the data buffer
+	//but if we were given a PROGMEM (unwriteable) data pointer then _pspi->transfer will lock up totally.
+	//So we explicitly tell it we don't care about any return data.
+	_pspi->transfer(buf, nullptr, len);
+	_bytes += len;
+}
+
+#ifdef SPI_HAS_TRANSFER_ASYNC
+bool RA8876SPIBus::writeDataAsync(const void *buf, uint32_t len, EventResponder &done)
+{
+	_cycleStart(RA8876_CYCLE_DATAWRITE, RA8876_SPI_DATAWRITE);
+	if(!_pspi->transfer(buf, nullptr, len, done)) return false;
+	_bytes += len;
+	return true;
+}
+#endif
+
+void RA8876SPIBus::readDataBuffer(void *buf, uint32_t len)
+{
+	_cycleStart(RA8876_CYCLE_DATAREAD, RA8876_SPI_DATAREAD);
+	_pspi->transfer(nullptr, buf, len);
+	_bytes += len;
+}
+
+#ifdef RA8876_HAS_FLEXIO
+//**************************************************************//
+// RA8876FlexIOBus
+//**************************************************************//
+RA8876FlexIOBus::RA8876FlexIOBus(uint8_t cs, uint8_t rs, uint8_t wr, uint8_t rd, const uint8_t data_pins[8])
+{
+	_cs = cs;
+	_rs = rs;
+	_wr = wr;
+	_rd = rd;
+	memcpy(_data, data_pins, sizeof(_data));
+}
+
+//**************************************************************//
+// Set up the pins and one shifter and timer for single beat 8 bit
+// writes: writing SHIFTBUF[0] puts the byte on the data pins and
+// timer 0 pulses WR low for half of a clock period.
+//**************************************************************//
+FLASHMEM bool RA8876FlexIOBus::begin(uint32_t clock)
+{
+	_pflex = FlexIOHandler::mapIOPinToFlexIOHandler(_wr, _wrFlexPin);
+	if(!_pflex) {
+		Serial.printf("RA8876_t3: WR pin %d is not a FlexIO pin\n", _wr);
+		return false;
+	}
+	_dataFlexPin = _pflex->mapIOPinToFlexPin(_data[0]);
+	for(uint8_t i = 0; i < 8; i++) {
+		if((_dataFlexPin == 0xff) || (_pflex->mapIOPinToFlexPin(_data[i]) != (_dataFlexPin + i))) {
+			Serial.println("RA8876_t3: The data pins must be consecutive FlexIO pins, on the same FlexIO as WR");
+			return false;
+		}
+	}
+
+	pinMode(_cs, OUTPUT);
+	digitalWriteFast(_cs, HIGH);
+	pinMode(_rd, OUTPUT);
+	digitalWriteFast(_rd, HIGH);
+	pinMode(_rs, OUTPUT);
+	digitalWriteFast(_rs, HIGH);
+	_rsLevel = HIGH;
+
+	// 480MHz PLL3 / 2 / 1 = 240MHz FlexIO clock
+	_pflex->setClockSettings(3, 1, 0);
+	_pflex->hardware().clock_gate_register |= _pflex->hardware().clock_gate_mask;
+	_pflexio = &_pflex->port();
+	_pflex->setIOPinToFlexMode(_wr);
+	*(portControlRegister(_wr)) = IOMUXC_PAD_DSE(7) | IOMUXC_PAD_SPEED(3) | IOMUXC_PAD_SRE;
+	_dataPinsToFlexIO();
+
+	// WR period in FlexIO clocks, even and at least 2
+	uint32_t div = (240000000 + clock - 1) / clock;
+	div = (div + 1) & ~1;
+	if(div < 2) div = 2;
+	if(div > 256) div = 256;
+
+	_pflexio->CTRL &= ~FLEXIO_CTRL_FLEXEN;
+	_pflexio->CTRL |= FLEXIO_CTRL_SWRST;
+	_pflexio->CTRL &= ~FLEXIO_CTRL_SWRST;
+
+	_pflexio->SHIFTCFG[0] = FLEXIO_SHIFTCFG_PWIDTH(7);	// 8 bits wide, no start or stop bits
+	_pflexio->SHIFTCTL[0] = FLEXIO_SHIFTCTL_TIMSEL(0) | FLEXIO_SHIFTCTL_PINCFG(3) |
+	                        FLEXIO_SHIFTCTL_PINSEL(_dataFlexPin) | FLEXIO_SHIFTCTL_SMOD(2);	// transmit
+	// One beat of the dual 8 bit counter baud mode
+	_pflexio->TIMCMP[0] = (((1 * 2) - 1) << 8) | ((div / 2) - 1);
+	_pflexio->TIMCFG[0] = FLEXIO_TIMCFG_TIMDIS(2) | FLEXIO_TIMCFG_TIMENA(2);	// enabled by trigger, disabled on compare
+	_pflexio->TIMCTL[0] = FLEXIO_TIMCTL_TRGSEL((0 << 2) | 1) | FLEXIO_TIMCTL_TRGPOL | FLEXIO_TIMCTL_TRGSRC |
+	                      FLEXIO_TIMCTL_PINCFG(3) | FLEXIO_TIMCTL_PINSEL(_wrFlexPin) | FLEXIO_TIMCTL_PINPOL |
+	                      FLEXIO_TIMCTL_TIMOD(1);	// triggered by shifter 0 data, WR active low
+	_pflexio->CTRL |= FLEXIO_CTRL_FLEXEN | FLEXIO_CTRL_FASTACC;
+	return true;
+}
+
+void RA8876FlexIOBus::_dataPinsToFlexIO(void)
+{
+	for(uint8_t i = 0; i < 8; i++) {
+		_pflex->setIOPinToFlexMode(_data[i]);
+		*(portControlRegister(_data[i])) = IOMUXC_PAD_DSE(7) | IOMUXC_PAD_SPEED(3) | IOMUXC_PAD_SRE;
+	}
+}
+
+//**************************************************************//
+// One WR cycle, RS has to be set already. Waits for the strobe to
+// finish so RS can be changed straight after.
+//**************************************************************//
+void RA8876FlexIOBus::_writeByte(uint8_t b)
+{
+	_pflexio->SHIFTBUF[0] = b;
+	while(!(_pflexio->SHIFTSTAT & 1)) {}	// in the shifter
+	while(!(_pflexio->TIMSTAT & 1)) {}	// WR back high
+	_pflexio->TIMSTAT = 1;
+	_bytes++;
+}
+
+void RA8876FlexIOBus::writeDataBuffer(const void *buf, uint32_t len)
+{
+	const uint8_t *p = (const uint8_t *)buf;
+	_setRS(HIGH);
+	while(len--) _writeByte(*p++);
+}
+
+//**************************************************************//
+// One RD cycle, RS has to be set already. The data pins are GPIO
+// inputs while RD is low.
+//**************************************************************//
+uint8_t RA8876FlexIOBus::_readByte(void)
+{
+	uint8_t b = 0;
+	for(uint8_t i = 0; i < 8; i++) pinMode(_data[i], INPUT);
+	digitalWriteFast(_rd, LOW);
+	delayNanoseconds(100);	// read access time
+	for(uint8_t i = 0; i < 8; i++) {
+		if(digitalReadFast(_data[i])) b |= 1 << i;
+	}
+	digitalWriteFast(_rd, HIGH);
+	_dataPinsToFlexIO();
+	_bytes++;
+	return b;
+}
+
+void RA8876FlexIOBus::readDataBuffer(void *buf, uint32_t len)
+{
+	uint8_t *p = (uint8_t *)buf;
+	_setRS(HIGH);
+	while(len--) *p++ = _readByte();
+}
+#endif
+
+//**************************************************************//
+// RA8876MockBus
+//**************************************************************//
+RA8876MockBus::RA8876MockBus(busTrace_t *trace, uint32_t trace_size, RA8876Bus *forward)
+{
+	_trace = trace;
+	_traceSize = trace ? trace_size : 0;
+	_forward = forward;
+	memset(_regs, 0, sizeof(_regs));
+	_regs[0xff] = 0x76;		// chip ID
+	resetTrace();
+}
+
+bool RA8876MockBus::begin(uint32_t clock)
+{
+	return _forward ? _forward->begin(clock) : true;
+}
+
+void RA8876MockBus::resetTrace(void)
+{
+	_traceCount = 0;
+	_traceHash = 2166136261ul;	// FNV-1a
+}
+
+void RA8876MockBus::_record(uint8_t cycle, uint8_t value)
+{
+	if(_traceCount < _traceSize) {
+		_trace[_traceCount].cycle = cycle;
+		_trace[_traceCount].value = value;
+	}
+	_traceCount++;
+	if(cycle != RA8876_CYCLE_FRAME_END) _bytes++;
+	_traceHash = (_traceHash ^ cycle) * 16777619ul;
+	_traceHash = (_traceHash ^ value) * 16777619ul;
+}
+
+void RA8876MockBus::select(void)
+{
+	if(_forward) _forward->select();
+}
+
+void RA8876MockBus::deselect(void)
+{
+	if(_forward) _forward->deselect();
+	_record(RA8876_CYCLE_FRAME_END, 0);
+}
+
+void RA8876MockBus::writeCommand(uint8_t reg)
+{
+	if(_forward) _forward->writeCommand(reg);
+	_regSelected = reg;
+	_record(RA8876_CYCLE_CMDWRITE, reg);
+}
+
+void RA8876MockBus::writeData(uint8_t data)
+{
+	if(_forward) _forward->writeData(data);
+	if(_regSelected != RA8876_MRWDP) _regs[_regSelected] = data;
+	_record(RA8876_CYCLE_DATAWRITE, data);
+}
+
+void RA8876MockBus::writeDataBuffer(const void *buf, uint32_t len)
+{
+	if(_forward) _forward->writeDataBuffer(buf, len);
+	const uint8_t *p = (const uint8_t *)buf;
+	if(len && (_regSelected != RA8876_MRWDP)) _regs[_regSelected] = p[len - 1];
+	while(len--) _record(RA8876_CYCLE_DATAWRITE, *p++);
+}
+
+#ifdef SPI_HAS_TRANSFER_ASYNC
+// Only when the bus behind it can, the driver sends it with
+// writeDataBuffer() otherwise
+bool RA8876MockBus::writeDataAsync(const void *buf, uint32_t len, EventResponder &done)
+{
+	if(!_forward || !_forward->writeDataAsync(buf, len, done)) return false;
+	const uint8_t *p = (const uint8_t *)buf;
+	while(len--) _record(RA8876_CYCLE_DATAWRITE, *p++);
+	return true;
+}
+#endif
+
+uint8_t RA8876MockBus::readData(void)
+{
+	uint8_t data = 0;
+	if(_forward) data = _forward->readData();
+	else if(_regSelected != RA8876_MRWDP) data = _regs[_regSelected];
+	_record(RA8876_CYCLE_DATAREAD, data);
+	return data;
+}
+
+void RA8876MockBus::readDataBuffer(void *buf, uint32_t len)
+{
+	uint8_t *p = (uint8_t *)buf;
+	if(_forward) _forward->readDataBuffer(buf, len);
+	else memset(buf, 0, len);
+	while(len--) _record(RA8876_CYCLE_DATAREAD, *p++);
+}
+
+uint8_t RA8876MockBus::readStatus(void)
+{
+	uint8_t status = _forward ? _forward->readStatus() : _status;
+	if(_traceStatus) _record(RA8876_CYCLE_STATUSREAD, status);
+	return status;
+}
+
+//**************************************************************//
+// Index of the first cycle where the two traces differ, traceCount()
+// when they match. Past the end of what the buffers hold only the
+// counts and hashes can be compared, a difference there returns
+// the end of the shorter recording.
+//**************************************************************//
+uint32_t RA8876MockBus::traceCompare(RA8876MockBus &other)
+{
+	uint32_t n = min(min(_traceCount, other._traceCount), min(_traceSize, other._traceSize));
+	for(uint32_t i = 0; i < n; i++) {
+		if((_trace[i].cycle != other._trace[i].cycle) || (_trace[i].value != other._trace[i].value)) return i;
+	}
+	if((_traceCount == other._traceCount) && (_traceHash == other._traceHash)) return _traceCount;
+	return n;
+}
+
+void RA8876MockBus::printTrace(Print &pr, uint32_t start, uint32_t count)
+{
+	static const char cycle_names[] = "CWRS|";
+	uint32_t end = min(_traceCount, _traceSize);
+	if((start < end) && (count < end - start)) end = start + count;
+	pr.printf("Bus trace: %lu cycles hash: %08lx\n", (unsigned long)_traceCount, (unsigned long)_traceHash);
+	for(uint32_t i = start; i < end; i++) {
+		if(_trace[i].cycle == RA8876_CYCLE_FRAME_END) pr.println();
+		else pr.printf(" %c%02x", cycle_names[_trace[i].cycle], _trace[i].value);
+	}
+	pr.println();
+}
+
+//**************************************************************//
+// RA8876BusArbiter
+//**************************************************************//
+int8_t RA8876BusArbiter::attach(const char *name, void (*service)(void *), void (*yield)(void *), void *context)
+{
+	for(int8_t id = 0; id < RA8876_ARBITER_CLIENTS; id++) {
+		if(_clients[id].name) continue;
+		memset(&_clients[id], 0, sizeof(busClient_t));
+		_clients[id].name = name ? name : "?";
+		_clients[id].service = service;
+		_clients[id].yield = yield;
+		_clients[id].context = context;
+		return id;
+	}
+	Serial.println("RA8876BusArbiter: no free client slots");
+	return -1;
+}
+
+void RA8876BusArbiter::detach(int8_t id)
+{
+	if(!_valid(id)) return;
+	if(_owner == id) release(id);
+	noInterrupts();
+	_pending &= ~(1ul << id);
+	interrupts();
+	_clients[id].name = nullptr;
+}
+
+bool RA8876BusArbiter::tryAcquire(int8_t id)
+{
+	if(!_valid(id)) return false;
+	noInterrupts();
+	if(_owner >= 0) {
+		bool mine = (_owner == id);
+		interrupts();
+		return mine;
+	}
+	_owner = id;
+	interrupts();
+	_grantMicros = micros();
+	_clients[id].transactions++;
+	return true;
+}
+
+//**************************************************************//
+// Wait for the bus. Whoever has it is either mid transfer, and
+// releases it from the completion interrupt, or idle, in which
+// case it is asked to give it up.
+//**************************************************************//
+void RA8876BusArbiter::acquire(int8_t id)
+{
+	if(tryAcquire(id) || !_valid(id)) return;
+	uint32_t start = micros();
+	do {
+		_yieldOwner();
+	} while(!tryAcquire(id));
+	_clients[id].waitMicros += micros() - start;
+}
+
+// May be called from the DMA completion interrupt
+void RA8876BusArbiter::release(int8_t id, uint32_t bytes)
+{
+	if((_owner != id) || (id < 0)) return;
+	_clients[id].bytes += bytes;
+	_clients[id].busyMicros += micros() - _grantMicros;
+	_owner = -1;
+}
+
+void RA8876BusArbiter::request(int8_t id)
+{
+	if(!_valid(id)) return;
+	noInterrupts();
+	_pending |= 1ul << id;
+	interrupts();
+}
+
+void RA8876BusArbiter::_yieldOwner(void)
+{
+	int8_t owner = _owner;
+	if((owner >= 0) && _clients[owner].yield) (*_clients[owner].yield)(_clients[owner].context);
+}
+
+//**************************************************************//
+// Start the next client's queued work if the bus is free, going
+// round robin from the one after the last served. The client's
+// service callback starts (at most) one transfer and calls
+// request() again if it has more. Returns true if one was called.
+//**************************************************************//
+bool RA8876BusArbiter::service(void)
+{
+	if(!_pending) return false;
+	if(_owner >= 0) {
+		_yieldOwner();
+		if(_owner >= 0) return false;
+	}
+	for(uint8_t i = 0; i < RA8876_ARBITER_CLIENTS; i++) {
+		uint8_t id = (_next + i) % RA8876_ARBITER_CLIENTS;
+		if(!(_pending & (1ul << id))) continue;
+		noInterrupts();
+		_pending &= ~(1ul << id);
+		interrupts();
+		_next = id + 1;
+		if(_clients[id].service) (*_clients[id].service)(_clients[id].context);
+		return true;
+	}
+	return false;
+}
+
+void RA8876BusArbiter::resetStats(void)
+{
+	for(uint8_t id = 0; id < RA8876_ARBITER_CLIENTS; id++) {
+		_clients[id].transactions = 0;
+		_clients[id].bytes = 0;
+		_clients[id].busyMicros = 0;
+		_clients[id].waitMicros = 0;
+	}
+	_statsMicros = micros();
+}
+
+//**************************************************************//
+// Per client: transactions, bytes, share of the time since
+// resetStats() spent holding the bus, and time spent waiting
+//**************************************************************//
+void RA8876BusArbiter::printStats(Print &pr)
+{
+	uint32_t elapsed = micros() - _statsMicros;
+	if(!elapsed) elapsed = 1;
+	pr.printf("Bus clients over %lu us:\n", (unsigned long)elapsed);
+	for(uint8_t id = 0; id < RA8876_ARBITER_CLIENTS; id++) {
+		const busClient_t *c = &_clients[id];
+		if(!c->name) continue;
+		pr.printf("  %u %s: transactions: %lu bytes: %lu busy: %lu us (%u%%) waited: %lu us\n", id, c->name,
+				  (unsigned long)c->transactions, (unsigned long)c->bytes, (unsigned long)c->busyMicros,
+				  (unsigned)((uint64_t)c->busyMicros * 100 / elapsed), (unsigned long)c->waitMicros);
+	}
+}
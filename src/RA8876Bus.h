@@ -0,0 +1,368 @@
+//**************************************************************//
+/*
+ * RA8876Bus.h
+ * Host interface (bus) backends for RA8876_t3.
+ *
+ * The driver talks to the RA8876 through an RA8876Bus: SPI (the
+ * default), the 8080 parallel interface driven by FlexIO on a
+ * Teensy 4.x, or a mock that records every bus cycle.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+//**************************************************************//
+#include "Arduino.h"
+#include "SPI.h"
+#include "RA8876Registers.h"
+
+#ifndef _RA8876_BUS
+#define _RA8876_BUS
+
+#if defined(__IMXRT1062__) && __has_include(<FlexIO_t4.h>)
+#include <FlexIO_t4.h>
+#define RA8876_HAS_FLEXIO
+#endif
+
+// Bus cycle types, the same four the RA8876 decodes from the first
+// byte of an SPI frame or from the A0 (RS) and RD/WR pins on 8080
+#define RA8876_CYCLE_CMDWRITE	0
+#define RA8876_CYCLE_DATAWRITE	1
+#define RA8876_CYCLE_DATAREAD	2
+#define RA8876_CYCLE_STATUSREAD	3
+#define RA8876_CYCLE_FRAME_END	4	// CS went high, RA8876MockBus trace only
+#define RA8876_CYCLE_NONE		0xff
+
+#ifndef RA8876_ARBITER_CLIENTS
+#define RA8876_ARBITER_CLIENTS	8
+#endif
+
+//**************************************************************//
+// One user of a shared bus, see RA8876BusArbiter
+//**************************************************************//
+typedef struct {
+	const char	*name;			// nullptr when the slot is free
+	void		(*service)(void *context);	// start queued work
+	void		(*yield)(void *context);	// let go of the bus if idle
+	void		*context;
+	uint32_t	transactions;
+	uint32_t	bytes;
+	uint32_t	busyMicros;		// time holding the bus
+	uint32_t	waitMicros;		// time waiting for it
+} busClient_t;
+
+//**************************************************************//
+// Shares one physical bus between several displays, and anything
+// else on it (an SD card, touch controller...). A client owns the
+// bus from acquire() to release(), which the RA8876 buses do in
+// beginTransaction()/endTransaction(), so a display's DMA transfer
+// holds it until the completion interrupt releases it.
+//
+// Clients with queued work (writeRectAsync()) call request() and
+// the work is started by service(), one transfer per call, taking
+// turns round robin, so one display can't starve the other. Call
+// service() from loop() as well.
+//
+// A client that is holding the bus between calls, with nothing in
+// flight, is asked to give it up with its yield callback when
+// someone else wants it. Only use it from one thread, release()
+// is the only call that is interrupt safe.
+//**************************************************************//
+class RA8876BusArbiter
+{
+public:
+	int8_t attach(const char *name, void (*service)(void *) = nullptr, void (*yield)(void *) = nullptr, void *context = nullptr);
+	void detach(int8_t id);
+	bool tryAcquire(int8_t id);
+	void acquire(int8_t id);
+	void release(int8_t id, uint32_t bytes = 0);
+	void request(int8_t id);
+	bool service(void);
+	int8_t owner(void) { return _owner; }
+	const busClient_t *client(int8_t id) { return _valid(id) ? &_clients[id] : nullptr; }
+	void resetStats(void);
+	void printStats(Print &pr);
+
+private:
+	busClient_t	_clients[RA8876_ARBITER_CLIENTS] = {};
+	volatile int8_t	_owner = -1;
+	volatile uint32_t	_pending = 0;	// bit per client with work for service()
+	uint8_t		_next = 0;		// where the round robin starts
+	uint32_t	_grantMicros = 0;
+	uint32_t	_statsMicros = 0;
+	bool		_valid(int8_t id) { return (id >= 0) && (id < RA8876_ARBITER_CLIENTS) && _clients[id].name; }
+	void		_yieldOwner(void);
+};
+
+//**************************************************************//
+// The interface the driver uses for every register, data and
+// burst transfer. startSend()/endSend() bracket each frame with
+// select()/deselect() and own the bus with beginTransaction()/
+// endTransaction() across several frames.
+//
+// Within a frame the cycle type may go from command to data (that
+// is how lcdRegDataWrite() sends a register and its value), but
+// once data has been written or read the RA8876 treats the rest
+// of an SPI frame as data, so the driver starts a new frame for
+// the next command.
+//**************************************************************//
+class RA8876Bus
+{
+public:
+	virtual ~RA8876Bus() {}
+	virtual bool begin(uint32_t clock) = 0;
+	virtual const char *name(void) = 0;
+	void setArbiter(RA8876BusArbiter *arbiter, int8_t id) { _arbiter = arbiter; _arbiterId = id; }
+
+	virtual void beginTransaction(void) { if(_arbiter) _arbiter->acquire(_arbiterId); }
+	virtual void endTransaction(void) {
+		if(_arbiter) _arbiter->release(_arbiterId, _bytes);
+		_bytes = 0;
+	}
+	virtual void select(void) = 0;
+	virtual void deselect(void) = 0;
+
+	virtual void writeCommand(uint8_t reg) = 0;
+	virtual void writeData(uint8_t data) = 0;
+	virtual void writeRegData(uint8_t reg, uint8_t data) { writeCommand(reg); writeData(data); }
+	virtual void writeData16(uint16_t data) { writeData(data >> 8); writeData(data & 0xff); }
+	virtual void writeDataBuffer(const void *buf, uint32_t len) = 0;
+#ifdef SPI_HAS_TRANSFER_ASYNC
+	// Start sending buf and return, done is triggered (and the frame
+	// left for the event handler to close) when it has all gone out.
+	// false when the bus can't, nothing has been sent in that case.
+	virtual bool writeDataAsync(const void *buf, uint32_t len, EventResponder &done) { return false; }
+#endif
+	virtual uint8_t readData(void) = 0;
+	virtual void readDataBuffer(void *buf, uint32_t len) = 0;
+	virtual uint8_t readStatus(void) = 0;
+
+protected:
+	RA8876BusArbiter	*_arbiter = nullptr;
+	int8_t		_arbiterId = -1;
+	uint32_t	_bytes = 0;		// this transaction, for the arbiter's counters
+};
+
+//**************************************************************//
+// 4 wire SPI, the first byte of each run of cycles in a frame
+// says what the following bytes are (RA8876_SPI_CMDWRITE...)
+//**************************************************************//
+class RA8876SPIBus : public RA8876Bus
+{
+public:
+	RA8876SPIBus(uint8_t cs = 10, uint8_t mosi = 11, uint8_t sclk = 13, uint8_t miso = 12);
+	bool begin(uint32_t clock);
+	const char *name(void) { return "SPI"; }
+	SPIClass *spi(void) { return _pspi; }
+
+	void beginTransaction(void) {
+		RA8876Bus::beginTransaction();
+		_pspi->beginTransaction(SPISettings(_clock, MSBFIRST, SPI_MODE0));
+	}
+	void endTransaction(void) {
+		_pspi->endTransaction();
+		RA8876Bus::endTransaction();
+	}
+	inline __attribute__((always_inline))
+	void select(void) {
+		_cycle = RA8876_CYCLE_NONE;
+		#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x
+		*(_csport + 34) = _cspinmask;
+		#else
+		*_csport &= ~_cspinmask;
+		#endif
+	}
+	inline __attribute__((always_inline))
+	void deselect(void) {
+		#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x
+		*(_csport + 33) = _cspinmask;
+		#else
+		*_csport |= _cspinmask;
+		#endif
+	}
+
+	void writeCommand(uint8_t reg) { _cycleByte(RA8876_CYCLE_CMDWRITE, RA8876_SPI_CMDWRITE, reg); }
+	void writeData(uint8_t data) { _cycleByte(RA8876_CYCLE_DATAWRITE, RA8876_SPI_DATAWRITE, data); }
+	void writeRegData(uint8_t reg, uint8_t data);
+	void writeData16(uint16_t data);
+	void writeDataBuffer(const void *buf, uint32_t len);
+#ifdef SPI_HAS_TRANSFER_ASYNC
+	bool writeDataAsync(const void *buf, uint32_t len, EventResponder &done);
+#endif
+	uint8_t readData(void) { return _cycleByte(RA8876_CYCLE_DATAREAD, RA8876_SPI_DATAREAD, 0); }
+	void readDataBuffer(void *buf, uint32_t len);
+	uint8_t readStatus(void) { return _cycleByte(RA8876_CYCLE_STATUSREAD, RA8876_SPI_STATUSREAD, 0); }
+
+private:
+	uint8_t		_cs, _mosi, _sclk, _miso;
+	uint32_t	_clock = 0;
+	SPIClass	*_pspi = nullptr;
+	uint8_t		_cycle = RA8876_CYCLE_NONE;	// what the bytes sent in this frame are
+#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x
+	uint32_t	_cspinmask;
+	volatile uint32_t *_csport;
+#else
+	uint8_t		_cspinmask;
+	volatile uint8_t *_csport;
+#endif
+	inline __attribute__((always_inline))
+	void _cycleStart(uint8_t cycle, uint8_t prefix) {
+		if(_cycle != cycle) {
+			_cycle = cycle;
+			_pspi->transfer(prefix);
+			_bytes++;
+		}
+	}
+	inline __attribute__((always_inline))
+	uint8_t _cycleByte(uint8_t cycle, uint8_t prefix, uint8_t b) {
+		if(_cycle == cycle) {
+			_bytes++;
+			return _pspi->transfer(b);
+		}
+		_cycle = cycle;
+		_bytes += 2;
+		return _pspi->transfer16(((uint16_t)prefix << 8) | b);
+	}
+};
+
+#ifdef RA8876_HAS_FLEXIO
+//**************************************************************//
+// 8 bit 8080 parallel interface on a Teensy 4.x. The eight data
+// pins have to be consecutive FlexIO pins on the same FlexIO as WR
+// (FlexIO2 pins 0-7 or FlexIO3 pins 0-7, for example), WR is
+// strobed by a FlexIO timer, CS, RS (A0) and RD are plain GPIO.
+// Writes go out through a FlexIO shifter, reads are done by turning
+// the data pins around to GPIO, they are only status and register
+// reads anyway. The RA8876 has to be strapped for the 8080 host
+// interface, and clock is the WR strobe rate.
+//**************************************************************//
+class RA8876FlexIOBus : public RA8876Bus
+{
+public:
+	RA8876FlexIOBus(uint8_t cs, uint8_t rs, uint8_t wr, uint8_t rd, const uint8_t data_pins[8]);
+	bool begin(uint32_t clock);
+	const char *name(void) { return "FlexIO 8080"; }
+
+	void select(void) { digitalWriteFast(_cs, LOW); }
+	void deselect(void) { digitalWriteFast(_cs, HIGH); }
+
+	void writeCommand(uint8_t reg) { _setRS(LOW); _writeByte(reg); }
+	void writeData(uint8_t data) { _setRS(HIGH); _writeByte(data); }
+	void writeDataBuffer(const void *buf, uint32_t len);
+	uint8_t readData(void) { _setRS(HIGH); return _readByte(); }
+	void readDataBuffer(void *buf, uint32_t len);
+	uint8_t readStatus(void) { _setRS(LOW); return _readByte(); }
+
+private:
+	uint8_t		_cs, _rs, _wr, _rd;
+	uint8_t		_data[8];
+	uint8_t		_dataFlexPin = 0xff;	// FlexIO pin of D0
+	uint8_t		_wrFlexPin = 0xff;
+	uint8_t		_rsLevel = 0xff;
+	FlexIOHandler	*_pflex = nullptr;
+	IMXRT_FLEXIO_t	*_pflexio = nullptr;
+	void		_setRS(uint8_t level) {
+		if(_rsLevel != level) {
+			_rsLevel = level;
+			digitalWriteFast(_rs, level);
+		}
+	}
+	void		_writeByte(uint8_t b);
+	uint8_t		_readByte(void);
+	void		_dataPinsToFlexIO(void);
+};
+#endif
+
+//**************************************************************//
+// One recorded bus cycle, see RA8876MockBus
+//**************************************************************//
+typedef struct {
+	uint8_t		cycle;	// RA8876_CYCLE_CMDWRITE...
+	uint8_t		value;
+} busTrace_t;
+
+//**************************************************************//
+// Records every cycle the driver puts on the bus, so the output of
+// two backends (or two versions of a drawing function) can be
+// compared byte for byte. Give it a forward bus and it passes
+// everything through, so it can sit in front of real hardware.
+// On its own it needs no hardware at all: register writes go into
+// a register file that reads return, the status register reads as
+// idle with the SDRAM ready (setStatus() to change that) and memory
+// reads return 0.
+//
+// Status reads are not recorded unless traceStatusReads(true), how
+// many polls a wait takes depends on the bus speed. traceHash()
+// keeps going after the trace buffer is full, so long runs can
+// still be compared.
+//**************************************************************//
+class RA8876MockBus : public RA8876Bus
+{
+public:
+	RA8876MockBus(busTrace_t *trace = nullptr, uint32_t trace_size = 0, RA8876Bus *forward = nullptr);
+	bool begin(uint32_t clock);
+	const char *name(void) { return "Mock"; }
+
+	void beginTransaction(void) {
+		RA8876Bus::beginTransaction();
+		if(_forward) _forward->beginTransaction();
+	}
+	void endTransaction(void) {
+		if(_forward) _forward->endTransaction();
+		RA8876Bus::endTransaction();
+	}
+	void select(void);
+	void deselect(void);
+
+	void writeCommand(uint8_t reg);
+	void writeData(uint8_t data);
+	void writeDataBuffer(const void *buf, uint32_t len);
+#ifdef SPI_HAS_TRANSFER_ASYNC
+	bool writeDataAsync(const void *buf, uint32_t len, EventResponder &done);
+#endif
+	uint8_t readData(void);
+	void readDataBuffer(void *buf, uint32_t len);
+	uint8_t readStatus(void);
+
+	void setStatus(uint8_t status) { _status = status; }
+	void setRegister(uint8_t reg, uint8_t value) { _regs[reg] = value; }
+	uint8_t getRegister(uint8_t reg) { return _regs[reg]; }
+	void traceStatusReads(bool on) { _traceStatus = on; }
+	void resetTrace(void);
+	const busTrace_t *trace(void) { return _trace; }
+	uint32_t traceCount(void) { return _traceCount; }	// cycles recorded, may be more than fit
+	uint32_t traceHash(void) { return _traceHash; }
+	bool traceOverflow(void) { return _traceCount > _traceSize; }
+	uint32_t traceCompare(RA8876MockBus &other);
+	void printTrace(Print &pr, uint32_t start = 0, uint32_t count = 0xffffffff);
+
+private:
+	busTrace_t	*_trace;
+	uint32_t	_traceSize;
+	uint32_t	_traceCount = 0;
+	uint32_t	_traceHash;
+	RA8876Bus	*_forward;
+	bool		_traceStatus = false;
+	uint8_t		_status = 0x44;		// write FIFO empty, SDRAM ready
+	uint8_t		_regSelected = 0;
+	uint8_t		_regs[256];
+	void		_record(uint8_t cycle, uint8_t value);
+};
+
+#endif
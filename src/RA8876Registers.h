@@ -270,6 +270,8 @@ memory size. For example : page_size = 1024*600*2byte(16bpp) = 1228800byte, maxi
 #define RA8876_INTEN  0x0B
 #define RA8876_INTF   0x0C
 #define RA8876_MINTFR 0x0D
+#define RA8876_INT_VSYNC  4		// VSYNC time base
+#define RA8876_INT_CORE_TASK_DONE  2	// BTE, geometry draw or serial flash DMA finished
 #define RA8876_PUENR  0x0E
 #define RA8876_PSFSR  0x0F
 
@@ -920,6 +922,142 @@ struct tftSave {
 
 typedef struct tftSave tftSave_t;
 
+/* Struct for a queued BTE operation, see bteService() */
+struct bteJob {
+	uint8_t  op;
+	uint8_t  rop_or_pattern;
+	uint32_t s0_addr;
+	uint16_t s0_image_width;
+	uint16_t s0_x;
+	uint16_t s0_y;
+	uint32_t s1_addr;
+	uint16_t s1_image_width;
+	uint16_t s1_x;
+	uint16_t s1_y;
+	uint32_t des_addr;
+	uint16_t des_image_width;
+	uint16_t des_x;
+	uint16_t des_y;
+	uint16_t width;
+	uint16_t height;
+	uint16_t chromakey;
+};
+
+typedef struct bteJob bteJob_t;
+
+/* Damaged area of the canvas page, corners are inclusive. See updateScreen() */
+struct damageRect {
+	int16_t x1;
+	int16_t y1;
+	int16_t x2;
+	int16_t y2;
+};
+
+typedef struct damageRect damageRect_t;
+
+/* One slot of the SDRAM glyph cache, see glyphCacheEnable() */
+struct glyphCacheEntry {
+	const void *font;		// nullptr when the slot is free
+	uint32_t lastUse;
+	uint16_t c;
+	uint16_t fgcolor;
+	uint16_t bgcolor;		// chroma key color when transparent
+	uint8_t  flags;			// 1 if transparent
+	uint8_t  width;
+	uint8_t  height;
+};
+
+typedef struct glyphCacheEntry glyphCacheEntry_t;
+
+/* An off-screen image in SDRAM, see surfaceAlloc() */
+struct surface {
+	uint32_t addr;			// start address, 0 size when the entry is free
+	uint32_t size;			// stride * height
+	uint16_t width;
+	uint16_t height;
+	uint16_t stride;		// bytes per row
+	uint16_t align;
+	uint8_t  bpp;			// 8, 16 or 24
+};
+
+typedef struct surface surface_t;
+
+/* A sprite and the background it covers, see spriteCreate() */
+struct sprite {
+	int16_t  image;			// surface with the sprite, -1 when the slot is free
+	int16_t  saveUnder;		// surface holding what the sprite covers
+	int16_t  x;				// where the next spritesUpdate() puts it
+	int16_t  y;
+	uint16_t chromaKey;
+	uint8_t  alpha;			// 0-32 window alpha, 32 is opaque using the chroma key
+	bool     visible;
+	bool     drawn;			// on the page, the rest says where
+	uint32_t drawnPage;
+	int16_t  drawnX;
+	int16_t  drawnY;
+	uint16_t drawnW;		// after clipping to the page
+	uint16_t drawnH;
+	uint16_t srcX;			// part of the image that was clipped off
+	uint16_t srcY;
+};
+
+typedef struct sprite sprite_t;
+
+/* Items for the batched drawing calls, see fillRects() */
+struct primRect {
+	int16_t  x;
+	int16_t  y;
+	int16_t  w;
+	int16_t  h;
+	uint16_t color;
+};
+
+typedef struct primRect primRect_t;
+
+struct primLine {
+	int16_t  x0;
+	int16_t  y0;
+	int16_t  x1;
+	int16_t  y1;
+	uint16_t color;
+};
+
+typedef struct primLine primLine_t;
+
+struct primPixel {
+	int16_t  x;
+	int16_t  y;
+	uint16_t color;
+};
+
+typedef struct primPixel primPixel_t;
+
+/* Packed images, see drawPackedImage() and extras/packimage */
+/* 8 byte header: 'R' 'P' format (palette size - 1) width height (little endian) */
+/* then the palette (little endian RGB565) and the ops, each starting with a tag byte */
+#define RA8876_PACKED_HEADER		8
+#define RA8876_PACKED_RGB565		0		// literals are RGB565
+#define RA8876_PACKED_PALETTE		1		// literals are palette indexes
+#define RA8876_PACKED_OP_RUN		0x00	// 00nnnnnn: last color n+1 more times
+#define RA8876_PACKED_OP_INDEX		0x40	// 01iiiiii: recent color table entry i (palette entry i)
+#define RA8876_PACKED_OP_DIFF		0x80	// 10rrggbb: last color + r-2, g-2, b-2 (RGB565 only)
+#define RA8876_PACKED_OP_LITERAL	0xc0	// 110nnnnn: n+1 literals follow
+#define RA8876_PACKED_OP_LONGRUN	0xe0	// 111nnnnn nnnnnnnn: last color n+65 more times
+#define RA8876_PACKED_HASH(c)		((((c) >> 11) * 3 + (((c) >> 5) & 0x3f) * 5 + ((c) & 0x1f) * 7) & 0x3f)
+
+struct packedDecoder {
+	const uint8_t *data;	// next op
+	const uint8_t *end;
+	const uint8_t *palette;	// nullptr for RGB565 images
+	uint16_t paletteSize;
+	uint32_t run;			// times color still has to be repeated
+	uint16_t color;			// last color
+	uint16_t index[64];		// recently seen colors, by RA8876_PACKED_HASH
+	uint8_t  literals;		// literals left in the current op
+};
+
+typedef struct packedDecoder packedDecoder_t;
+
 
 typedef struct Gbuttons gbuttons_t;
 /* Struct for graphic buttons */
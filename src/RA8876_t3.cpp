@@ -170,6 +170,50 @@ tftSave_t *screenPage9 = &screenSave9;
 	int16_t SCREEN_WIDTH  = HDW;
 	int16_t SCREEN_HEIGHT = VDH;
 
+//**************************************************************//
+// Registers lcdRegDataWrite() may skip when the shadow copy says
+// they already hold the value. Only plain configuration registers
+// belong here, nothing the RA8876 changes on its own (cursors that
+// auto increment, the memory port, status) and nothing where the
+// write itself starts an operation (DCR0 67h, DCR1 76h, BTE_CTRL0 90h).
+//**************************************************************//
+static const uint32_t reg_cacheable[8] = {
+	0x00000008,	// 00-1f: 03h ICR
+	0x000003ff,	// 20-3f: 20h-29h main image/window
+	0x7fff0000,	// 40-5f: 50h-5eh canvas and active window
+	0x7fbfff00,	// 60-7f: 68h-7eh geometry coordinates, less 76h
+	0xfffe0000,	// 80-9f: 91h-9fh BTE
+	0x003fffff,	// a0-bf: a0h-b5h BTE
+	0x00fc0000,	// c0-df: d2h-d7h foreground/background colors
+	0x00000000	// e0-ff
+};
+
+static inline bool regIsCacheable(ru8 reg) {
+	return reg_cacheable[reg >> 5] & (1ul << (reg & 0x1f));
+}
+
+// What check2dBusy() may need to wait for (_coreTaskPending)
+#define CORE_TASK_ENGINE	0x01	// BTE, geometry or DMA, signals the task done interrupt
+#define CORE_TASK_MEMWRITE	0x02	// data written to the memory port, status bit only
+
+// bteJob_t op codes
+#define BTE_JOB_MEMORY_COPY				0
+#define BTE_JOB_MEMORY_COPY_WITH_ROP	1
+#define BTE_JOB_PATTERN_FILL			2
+#define BTE_JOB_MEMORY_COPY_WITH_CHROMA	3
+#define BTE_JOB_MEMORY_COPY_WINDOW_ALPHA	4
+
+#define GRADIENT_HORIZONTAL	0
+#define GRADIENT_VERTICAL	1
+#define GRADIENT_LINEAR		2
+#define GRADIENT_RADIAL		3
+
+static const uint8_t gradient_bayer4[4][4] = {
+	{ 0,  8,  2, 10},
+	{12,  4, 14,  6},
+	{ 3, 11,  1,  9},
+	{15,  7, 13,  5}};
+
 #ifdef SPI_HAS_TRANSFER_ASYNC
 //**************************************************************//
 // If using DMA, must close transaction and de-assert _CS
@@ -179,6 +223,7 @@ void asyncEventResponder(EventResponderRef event_responder) {
   RA8876_t3 *tft = (RA8876_t3*)event_responder.getContext();
   tft->activeDMA = false;
   tft->endSend(true);
+  tft->_dmaSlotDone();
 }
 #endif
 
@@ -187,11 +232,15 @@ void asyncEventResponder(EventResponderRef event_responder) {
 //**************************************************************//
 // Create RA8876 driver instance
 RA8876_t3::RA8876_t3(const uint8_t CSp, const uint8_t RSTp, const uint8_t mosi_pin, const uint8_t sclk_pin, const uint8_t miso_pin)
+	: _spiBus(CSp, mosi_pin, sclk_pin, miso_pin)
+{
+	_rst = RSTp;
+}
+
+// Create RA8876 driver instance on some other bus
+RA8876_t3::RA8876_t3(RA8876Bus &bus, const uint8_t RSTp)
 {
-	_mosi = mosi_pin;
-	_miso = miso_pin;
-	_sclk = sclk_pin;
-	_cs = CSp;
+	_bus = &bus;
 	_rst = RSTp;
 }
 
@@ -203,89 +252,21 @@ RA8876_t3::RA8876_t3(const uint8_t CSp, const uint8_t RSTp, const uint8_t mosi_p
 #endif
 FLASHMEM boolean RA8876_t3::begin(uint32_t spi_clock) 
 { 
-  //initialize the bus for Teensy 3.6/4.0
-  // Figure out which SPI Buss to use.  
-  _SPI_CLOCK = spi_clock;				// #define ILI9341_SPICLOCK 30000000
-	if (SPI.pinIsMOSI(_mosi) && ((_miso == 0xff) || SPI.pinIsMISO(_miso)) && SPI.pinIsSCK(_sclk)) {
-		_pspi = &SPI;
-		_spi_num = 0;          // Which buss is this spi on? 
-		#ifdef KINETISK
-		_pkinetisk_spi = &KINETISK_SPI0;  // Could hack our way to grab this from SPI object, but...
-		//_fifo_full_test = (3 << 12);
-		#elif defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x 
-		_pimxrt_spi = &IMXRT_LPSPI4_S;  // Could hack our way to grab this from SPI object, but...
-		#else
-		_pkinetisl_spi = &KINETISL_SPI0;
-		#endif				
-	
-	#if defined(__MK64FX512__) || defined(__MK66FX1M0__) || defined(__IMXRT1062__) || defined(__MKL26Z64__)
-	} else if (SPI1.pinIsMOSI(_mosi) && ((_miso == 0xff) || SPI1.pinIsMISO(_miso)) && SPI1.pinIsSCK(_sclk)) {
-		_pspi = &SPI1;
-		_spi_num = 1;          // Which buss is this spi on? 
-		#ifdef KINETISK
-		_pkinetisk_spi = &KINETISK_SPI1;  // Could hack our way to grab this from SPI object, but...
-		//_fifo_full_test = (0 << 12);
-		#elif defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x 
-		_pimxrt_spi = &IMXRT_LPSPI3_S;  // Could hack our way to grab this from SPI object, but...
-		#else
-		_pkinetisl_spi = &KINETISL_SPI1;
-		#endif				
-	#if !defined(__MKL26Z64__)
-	} else if (SPI2.pinIsMOSI(_mosi) && ((_miso == 0xff) || SPI2.pinIsMISO(_miso)) && SPI2.pinIsSCK(_sclk)) {
-		_pspi = &SPI2;
-		_spi_num = 2;          // Which buss is this spi on? 
-		#ifdef KINETISK
-		_pkinetisk_spi = &KINETISK_SPI2;  // Could hack our way to grab this from SPI object, but...
-		//_fifo_full_test = (0 << 12);
-		#elif defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x 
-		_pimxrt_spi = &IMXRT_LPSPI1_S;  // Could hack our way to grab this from SPI object, but...
-		#endif				
-	#endif
-	#endif
-	} else {
-		Serial.println("RA8876_t3: The IO pins on the constructor are not valid SPI pins");
-	
-		Serial.printf("    mosi:%d miso:%d SCLK:%d CS:%d\n", _mosi, _miso, _sclk, _cs); Serial.flush();
+  //initialize the bus, SPI unless the constructor was given another one
+	if (!_bus->begin(spi_clock)) {
 		_errorCode |= (1 << 1);//set
-		return false;  // most likely will go bomb
-
+		return false;
 	}
-	// Make sure we have all of the proper SPI pins selected.
-	_pspi->setMOSI(_mosi);
-	_pspi->setSCK(_sclk);
-	if (_miso != 0xff) _pspi->setMISO(_miso);
-
-	// And startup SPI...
-	_pspi->begin();
-
-	// for this round will punt on trying to use CS as hardware CS...
-#ifdef KINETISK
-	pinMode(_cs, OUTPUT);
-	_csport    = portOutputRegister(digitalPinToPort(_cs));
-	_cspinmask = digitalPinToBitMask(_cs);
-	*_csport |= _cspinmask;
-
-#elif defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x 
-	// Serial.println("   T4 setup CS/DC"); Serial.flush();
-	_csport = portOutputRegister(_cs);
-	_cspinmask = digitalPinToBitMask(_cs);
-	pinMode(_cs, OUTPUT);	
-	DIRECT_WRITE_HIGH(_csport, _cspinmask);
-//	maybeUpdateTCR(_tcr_dc_not_assert | LPSPI_TCR_FRAMESZ(7));
-
-#else
-	// TLC
-	pinMode(_cs, OUTPUT);
-	_csport    = portOutputRegister(digitalPinToPort(_cs));
-	_cspinmask = digitalPinToBitMask(_cs);
-	*_csport |= _cspinmask;
-#endif	
 
 	#ifdef SPI_HAS_TRANSFER_ASYNC
 		finishedDMAEvent.setContext(this);	// Set the contxt to us
 		finishedDMAEvent.attachImmediate(asyncEventResponder);
 	#endif
   
+	// Nothing we think we know about the registers survives a reset
+	invalidateRegCache();
+
+	uint32_t boot_start = micros();
 	// toggle RST low to reset
 	if (_rst < 255) {
 		pinMode(_rst, OUTPUT);
@@ -309,6 +290,7 @@ FLASHMEM boolean RA8876_t3::begin(uint32_t spi_clock)
 	delay(1);
 	if ((lcdRegDataRead(0xff) != 0x76)&&(lcdRegDataRead(0xff) != 0x77))
 		return false;
+	_bootMicros[RA8876_BOOT_RESET] = micros() - boot_start;
 
 	// Initialize RA8876 to default settings
 	if(!ra8876Initialize())
@@ -332,12 +314,19 @@ FLASHMEM boolean RA8876_t3::begin(uint32_t spi_clock)
 //**************************************************************//
 boolean RA8876_t3::ra8876Initialize() {
 	
+	invalidateRegCache();
+
+	uint32_t phase_start = micros();
 	// Init PLL
 	if(!ra8876PllInitial())
 		return false;
+	_bootMicros[RA8876_BOOT_PLL] = micros() - phase_start;
+	phase_start = micros();
 	// Init SDRAM
 	if(!ra8876SdramInitial())
 		return false;
+	_bootMicros[RA8876_BOOT_SDRAM] = micros() - phase_start;
+	phase_start = micros();
 
 	lcdRegWrite(RA8876_CCR);//01h
 //  lcdDataWrite(RA8876_PLL_ENABLE<<7|RA8876_WAIT_MASK<<6|RA8876_KEY_SCAN_DISABLE<<5|RA8876_TFT_OUTPUT24<<3
@@ -476,40 +465,51 @@ boolean RA8876_t3::ra8876Initialize() {
 	saveTFTParams(screenPage8);
 	saveTFTParams(screenPage9);
 //	saveTFTParams(screenPage10);
+	_bootMicros[RA8876_BOOT_PANEL] = micros() - phase_start;
+	phase_start = micros();
 
 	// Initialize all screen colors to default values
 	currentPage = 999; // Don't repeat screen page 1 init.
+	_pageClearPending = 0;
 	selectScreen(PAGE1_START_ADDR);	// Init page 1 screen
 	fillScreen(COLOR65K_DARKBLUE);     // Not sure why we need to clear the screen twice
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE2_START_ADDR);	// Init page 2 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE3_START_ADDR);	// Init page 3 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE4_START_ADDR);	// Init page 4 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE5_START_ADDR);	// Init page 5 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE6_START_ADDR);	// Init page 6 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE7_START_ADDR);	// Init page 7 screen
-	//fillScreen(COLOR65K_DARKBLUE);
-	fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE8_START_ADDR);	// Init page 8 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE9_START_ADDR);	// Init page 9 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
-	selectScreen(PAGE10_START_ADDR);	// Init page 10 screen
-	fillScreen(COLOR65K_DARKBLUE);
-	//fillStatusLine(COLOR65K_DARKBLUE);
+	if(_fastBoot) {
+		// Not in the surface heap, setSurfaceHeap() takes those back
+		_pageClearPending = 0x3fe & ~_pageClearMask(_surfaceHeapStart, _surfaceHeapEnd);	// PAGE2..PAGE10
+	}
+	if(!_pageClearPending) {
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE2_START_ADDR);	// Init page 2 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE3_START_ADDR);	// Init page 3 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE4_START_ADDR);	// Init page 4 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE5_START_ADDR);	// Init page 5 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE6_START_ADDR);	// Init page 6 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE7_START_ADDR);	// Init page 7 screen
+		//fillScreen(COLOR65K_DARKBLUE);
+		fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE8_START_ADDR);	// Init page 8 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE9_START_ADDR);	// Init page 9 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+		selectScreen(PAGE10_START_ADDR);	// Init page 10 screen
+		fillScreen(COLOR65K_DARKBLUE);
+		//fillStatusLine(COLOR65K_DARKBLUE);
+	}
 	selectScreen(PAGE1_START_ADDR); // back to page 1 screen
+	check2dBusy();
+	_bootMicros[RA8876_BOOT_CLEAR] = micros() - phase_start;
 
 	// Set graphic mouse cursor to center of screen
 	gcursorxy(width() / 2, height() / 2);
@@ -525,18 +525,18 @@ boolean RA8876_t3::ra8876Initialize() {
 //**************************************************************//
 void RA8876_t3::lcdRegWrite(ru8 reg, bool finalize) 
 {
-  ru16 _data = (RA8876_SPI_CMDWRITE16 | reg);
-  
   startSend();
-  _pspi->transfer16(_data);
+  _bus->writeCommand(reg);
   endSend(finalize);
+  _regSelected = reg;
+  if(_damageTracking && (reg == RA8876_MRWDP)) _damageFromMemWrite();
 }
 
 void RA8876_t3::LCD_CmdWrite(unsigned char cmd)
 {	
   startSend();
-  _pspi->transfer16(0x00);
-  _pspi->transfer(cmd);
+  _bus->writeCommand(0x00);
+  _bus->writeCommand(cmd);
   endSend(true);
 }
 
@@ -545,10 +545,12 @@ void RA8876_t3::LCD_CmdWrite(unsigned char cmd)
 //**************************************************************//
 void RA8876_t3::lcdDataWrite(ru8 data, bool finalize) 
 {
-  ru16 _data = (RA8876_SPI_DATAWRITE16 | data);
   startSend();
-  _pspi->transfer16(_data);
+  _bus->writeData(data);
   endSend(finalize);
+  // We don't know what this did to the selected register
+  _regShadowValid[_regSelected >> 5] &= ~(1ul << (_regSelected & 0x1f));
+  if(_regSelected == RA8876_MRWDP) _coreTaskPending |= CORE_TASK_MEMWRITE;
 }
 
 //**************************************************************//
@@ -556,10 +558,8 @@ void RA8876_t3::lcdDataWrite(ru8 data, bool finalize)
 //**************************************************************//
 ru8 RA8876_t3::lcdDataRead(bool finalize) 
 {
-  ru16 _data = (RA8876_SPI_DATAREAD16 | 0x00);
-  
   startSend();
-  ru8 data = _pspi->transfer16(_data);
+  ru8 data = _bus->readData();
   endSend(finalize);
   return data;
 }
@@ -570,7 +570,7 @@ ru8 RA8876_t3::lcdDataRead(bool finalize)
 ru8 RA8876_t3::lcdStatusRead(bool finalize) 
 {
   startSend();
-  ru8 data = _pspi->transfer16(RA8876_SPI_STATUSREAD16);
+  ru8 data = _bus->readStatus();
   endSend(finalize);
   return data;
 }
@@ -582,23 +582,84 @@ void RA8876_t3::lcdRegDataWrite(ru8 reg, ru8 data, bool finalize)
 {
   //write the register we wish to write to, then send the data
   //don't need to release _CS between the two transfers
-  //ru16 _reg = (RA8876_SPI_CMDWRITE16 | reg);
-  //ru16 _data = (RA8876_SPI_DATAWRITE16 | data);
-  uint8_t buf[4] = {RA8876_SPI_CMDWRITE, reg, RA8876_SPI_DATAWRITE, data };
+  if(regIsCacheable(reg)) {
+    uint32_t valid_mask = 1ul << (reg & 0x1f);
+    if((_regShadowValid[reg >> 5] & valid_mask) && (_regShadow[reg] == data)) {
+      // Already there. Still need to close out the transaction if asked to
+      _regWritesSkipped++;
+      if(finalize && RA8876_BUSY && !_regBatchDepth && !activeDMA) {
+        _bus->endTransaction();
+        RA8876_BUSY = false;
+      }
+      return;
+    }
+    _regShadow[reg] = data;
+    _regShadowValid[reg >> 5] |= valid_mask;
+  }
+  _regSelected = reg;
+  // Remember if this kicks off something check2dBusy() needs to wait on
+  if((((reg == RA8876_DCR0) || (reg == RA8876_DCR1)) && (data & 0x80)) ||
+      ((reg == RA8876_BTE_CTRL0) && (data & (RA8876_BTE_ENABLE<<4))) ||
+      ((reg == RA8876_DMA_CTRL) && (data & RA8876_DMA_START))) {
+    _coreTaskPending |= CORE_TASK_ENGINE;
+    if(_damageTracking) _damageFromEngine(reg, data);
+  }
+  if(_regBatchDepth) {
+    // Batching, just queue it up. finalize is handled by endRegBatch()
+    if(_regBatchCount == RA8876_REG_BATCH_SIZE) flushRegBatch(false);
+    uint8_t *pbuf = &_regBatchBuf[_regBatchCount++ * 2];
+    pbuf[0] = reg;
+    pbuf[1] = data;
+    return;
+  }
+  startSend();
+  _bus->writeRegData(reg, data);
+  endSend(finalize);
+}
+
+//**************************************************************//
+// Send out any register/data pairs queued by lcdRegDataWrite()
+// while batching. They all go out in one bus transaction, but the
+// RA8876 treats everything after a data write cycle as data until
+// CS goes high, so each pair still needs its own CS frame.
+//**************************************************************//
+void RA8876_t3::flushRegBatch(bool finalize)
+{
+  uint16_t count = _regBatchCount;
+  if(!count) return;
+  _regBatchCount = 0;	// clear first so startSend() does not try to flush again
+  const uint8_t *pbuf = _regBatchBuf;
   startSend();
-  //_pspi->transfer16(_reg);
-  //_pspi->transfer16(_data);
-  _pspi->transfer(buf, nullptr, 4);
+  _bus->writeRegData(pbuf[0], pbuf[1]);
+  while(--count) {
+    pbuf += 2;
+    endSend(false);
+    startSend();
+    _bus->writeRegData(pbuf[0], pbuf[1]);
+  }
   endSend(finalize);
 }
 
+//**************************************************************//
+// Close a beginRegBatch(), the outer most one flushes the queue
+//**************************************************************//
+void RA8876_t3::endRegBatch(void)
+{
+  if(_regBatchDepth && (--_regBatchDepth == 0)) flushRegBatch(true);
+}
+
 //**************************************************************//
 // Read a RA8876 register Data
 //**************************************************************//
 ru8 RA8876_t3::lcdRegDataRead(ru8 reg, bool finalize)
 {
   lcdRegWrite(reg, finalize);
-  return lcdDataRead();
+  ru8 data = lcdDataRead();
+  if(regIsCacheable(reg)) {
+    _regShadow[reg] = data;
+    _regShadowValid[reg >> 5] |= 1ul << (reg & 0x1f);
+  }
+  return data;
 }
 
 //**************************************************************//
@@ -607,9 +668,25 @@ ru8 RA8876_t3::lcdRegDataRead(ru8 reg, bool finalize)
 void RA8876_t3::lcdDataWrite16bbp(ru16 data, bool finalize) 
 {
 	startSend();
-	_pspi->transfer(RA8876_SPI_DATAWRITE);
-	_pspi->transfer16(data);
+	_bus->writeData16(data);
 	endSend(finalize);
+	_coreTaskPending |= CORE_TASK_MEMWRITE;
+}
+
+//**************************************************************//
+// Send a block of data after Regwrite 04h. With DMA the frame is
+// closed by asyncEventResponder() when it is done.
+//**************************************************************//
+void RA8876_t3::lcdDataWriteBurst(const void *data, uint32_t len)
+{
+	startSend();
+#ifdef SPI_HAS_TRANSFER_ASYNC
+	activeDMA = true;
+	if(_bus->writeDataAsync(data, len, finishedDMAEvent)) return;
+	activeDMA = false;	// the bus can't, send it the slow way
+#endif
+	_bus->writeDataBuffer(data, len);
+	endSend(true);
 }
 
 //**************************************************************//
@@ -675,18 +752,221 @@ BTE, Geometry engine, Serial flash DMA, Text write or Graphic write
 A typical task like drawing a rectangle might take 30-150 microseconds, 
     depending on size
 A large filled rectangle might take 3300 microseconds
+We only ask the RA8876 if we started something since we last saw
+it idle, and with useInterruptPin() engine tasks are watched on
+the XnINTR pin instead of with status reads.
 *****************************************************************/
 void RA8876_t3::check2dBusy(void)  
 {  ru32 i; 
+   // Anything queued has to go before whatever is about to use the engine
+   if(_bteJobCount && !_bteInService) bteQueueFlush();
    for(i=0;i<50000;i++)   //Please according to your usage to modify i value.
    { 
-   delayMicroseconds(1);
-    if( (lcdStatusRead()&0x08)==0x00 )
+    if(!coreBusy())
     {return;}
+   delayMicroseconds(1);
    }
    Serial.println("2D ready failed");
 }  
 
+//**************************************************************//
+// Non blocking check of the core task busy state
+//**************************************************************//
+bool RA8876_t3::coreBusy(void)
+{
+  if(!_coreTaskPending) return false;
+  if((_coreTaskPending == CORE_TASK_ENGINE) && (_intPin != 0xff)) {
+    // XnINTR is driven low once the task done flag is set
+    if(digitalReadFast(_intPin)) return true;
+  } else {
+    _statusPollCount++;
+    if(lcdStatusRead() & 0x08) return true;
+  }
+  // Done, clear the flag so XnINTR is ready for the next task
+  if((_coreTaskPending & CORE_TASK_ENGINE) && (_intPin != 0xff))
+    lcdRegDataWrite(RA8876_INTF, 1<<RA8876_INT_CORE_TASK_DONE);
+  _coreTaskPending = 0;
+  return false;
+}
+
+//**************************************************************//
+// Dump the SPI counters, for timing one operation on the board:
+// resetSpiStats(), do it, then printSpiStats(Serial).
+//**************************************************************//
+void RA8876_t3::printSpiStats(Print &pr)
+{
+	pr.printf("%s transactions: %lu CS asserts: %lu\n", _bus->name(), (unsigned long)_spiTransactionCount, (unsigned long)_spiCSAssertCount);
+	pr.printf("  Register writes skipped: %lu Status polls: %lu\n", (unsigned long)_regWritesSkipped, (unsigned long)_statusPollCount);
+	pr.printf("  Glyph cache hits: %lu misses: %lu\n", (unsigned long)_glyphCacheHits, (unsigned long)_glyphCacheMisses);
+	pr.printf("  Damage rects: %u BTE jobs: %u DMA queued: %u\n", _damageCount, _bteJobCount, _dmaQueueCount);
+	pr.printf("  Scratch used: %lu of %lu heap allocs: %lu failures: %lu\n", (unsigned long)_scratchHighWater, (unsigned long)_scratchSize,
+			  (unsigned long)_scratchHeapAllocs, (unsigned long)_scratchFailures);
+	pr.printf("  Surfaces: %u bytes used: %lu free: %lu largest free: %lu\n", surfaceCount(), (unsigned long)surfaceBytesUsed(),
+			  (unsigned long)surfaceBytesFree(), (unsigned long)surfaceLargestFree());
+	const busClient_t *client = _arbiter ? _arbiter->client(_arbiterId) : nullptr;
+	if (client) {
+		pr.printf("  Shared bus transactions: %lu bytes: %lu busy: %lu us waited: %lu us\n", (unsigned long)client->transactions,
+				  (unsigned long)client->bytes, (unsigned long)client->busyMicros, (unsigned long)client->waitMicros);
+	}
+}
+
+//**************************************************************//
+// Scratch buffer for the temporary row and tile buffers, so the
+// drawing functions don't need malloc or big stack arrays. It is
+// a stack: _scratchFree() releases that allocation and everything
+// allocated after it. If it runs out, malloc is used and counted
+// in scratchHeapAllocs(), unless RA8876_SCRATCH_NO_HEAP is defined.
+// When there is no buffer at all the caller gives up, that is
+// counted in scratchFailures().
+//**************************************************************//
+void RA8876_t3::setScratchBuffer(void *buffer, uint32_t size)
+{
+	if (buffer) {
+		// Keep it 32 byte aligned for DMA and the cache
+		uint8_t *aligned = (uint8_t *)(((uintptr_t)buffer + 31) & ~((uintptr_t)(31)));
+		uint32_t skip = aligned - (uint8_t *)buffer;
+		_scratch = aligned;
+		_scratchSize = (size > skip) ? ((size - skip) & ~31) : 0;
+	} else {
+		_scratch = _scratchBuf;
+		_scratchSize = RA8876_SCRATCH_SIZE;
+	}
+	_scratchTop = 0;
+	_scratchHighWater = 0;
+}
+
+uint32_t RA8876_t3::_scratchAvailable(void)
+{
+	return _scratchSize - _scratchTop;
+}
+
+// Returns a 32 byte aligned buffer, or nullptr
+void *RA8876_t3::_scratchAlloc(uint32_t bytes)
+{
+	bytes = (bytes + 31) & ~31;
+	if (bytes <= _scratchAvailable()) {
+		void *p = _scratch + _scratchTop;
+		_scratchTop += bytes;
+		if (_scratchTop > _scratchHighWater) _scratchHighWater = _scratchTop;
+		return p;
+	}
+	_scratchHeapAllocs++;
+#ifdef RA8876_SCRATCH_NO_HEAP
+	_scratchFailures++;
+	Serial.printf("RA8876 scratch buffer too small, need %lu more bytes, see setScratchBuffer()\n", (unsigned long)(bytes - _scratchAvailable()));
+	return nullptr;
+#else
+	// Remember where the allocation started just before the aligned buffer
+	uint8_t *alloc = (uint8_t *)malloc(bytes + 32 + sizeof(void *));
+	if (!alloc) {
+		_scratchFailures++;
+		Serial.printf("RA8876 scratch malloc of %lu bytes failed\n", (unsigned long)bytes);
+		return nullptr;
+	}
+	uint8_t *p = (uint8_t *)(((uintptr_t)alloc + sizeof(void *) + 31) & ~((uintptr_t)(31)));
+	((void **)p)[-1] = alloc;
+	return p;
+#endif
+}
+
+void RA8876_t3::_scratchFree(void *p)
+{
+	if (!p) return;
+	if (((uint8_t *)p >= _scratch) && ((uint8_t *)p < (_scratch + _scratchSize))) {
+		_scratchTop = (uint8_t *)p - _scratch;
+	} else {
+		free(((void **)p)[-1]);
+	}
+}
+
+// Two buffers of up to rows * row_pixels pixels, rows is cut down to
+// what fits in the scratch buffer. Pass the result to _scratchFree().
+void *RA8876_t3::_scratchTiles(uint32_t row_pixels, int16_t &rows, uint16_t *buffers[2])
+{
+	int32_t fit = (_scratchAvailable() / 2 / 32 * 32) / (row_pixels * 2);
+	if (rows > fit) rows = fit;
+	if (rows < 1) rows = 1;
+	uint32_t buffer_bytes = ((rows * row_pixels * 2) + 31) & ~31;
+	uint8_t *p = (uint8_t *)_scratchAlloc(buffer_bytes * 2);
+	if (!p) return nullptr;
+	buffers[0] = (uint16_t *)p;
+	buffers[1] = (uint16_t *)(p + buffer_bytes);
+	return p;
+}
+
+//**************************************************************//
+// Boot timing, per phase of begin(). Page clears are only the
+// display page with setFastBoot().
+//**************************************************************//
+void RA8876_t3::printBootTimes(Print &pr)
+{
+	static const char * const names[RA8876_BOOT_PHASES] = {"Reset", "PLL", "SDRAM", "Panel", "Page clears"};
+	uint32_t total = 0;
+	for (uint8_t i = 0; i < RA8876_BOOT_PHASES; i++) {
+		pr.printf("%s: %lu us\n", names[i], (unsigned long)_bootMicros[i]);
+		total += _bootMicros[i];
+	}
+	pr.printf("Total: %lu us, %u pages still to clear\n", (unsigned long)total, __builtin_popcount(_pageClearPending));
+}
+
+//**************************************************************//
+// Lazy page clearing after setFastBoot(). _pageClear() solid fills
+// one page with the clear color if it has not been yet. A page is
+// taken off the list as soon as anything else puts pixels in it: a
+// BTE destination, the canvas or the surface heap.
+//**************************************************************//
+void RA8876_t3::_pageClear(uint8_t page)
+{
+	if (!(_pageClearPending & (1 << page))) return;
+	_pageClearPending &= ~(1 << page);
+	bteSolidFill(page * (PAGE2_START_ADDR), SCREEN_WIDTH, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, COLOR65K_DARKBLUE);
+}
+
+// Pending bits for the screen pages in [start, end)
+uint16_t RA8876_t3::_pageClearMask(uint32_t start, uint32_t end)
+{
+	uint16_t mask = 0;
+	for (uint8_t page = 1; page < 10; page++) {
+		uint32_t page_start = page * (PAGE2_START_ADDR);
+		if ((start < page_start + PAGE2_START_ADDR) && (end > page_start)) mask |= 1 << page;
+	}
+	return mask;
+}
+
+// Start clearing the next page if the engine is free, returns true
+// while there are pages left.
+bool RA8876_t3::pageClearService(void)
+{
+	if (!_pageClearPending) return false;
+	if (_bteJobCount || coreBusy()) return true;
+	for (uint8_t page = 1; page < 10; page++) {
+		if (_pageClearPending & (1 << page)) {
+			_pageClear(page);
+			break;
+		}
+	}
+	return _pageClearPending != 0;
+}
+
+//**************************************************************//
+// Use the RA8876 XnINTR pin to know when the 2D engine is done
+// with a BTE, geometry or DMA task. Pass 0xff to go back to
+// polling the status register.
+//**************************************************************//
+void RA8876_t3::useInterruptPin(uint8_t pin)
+{
+  check2dBusy();
+  if(pin == 0xff) {
+    lcdRegDataWrite(RA8876_INTEN, lcdRegDataRead(RA8876_INTEN) & ~(1<<RA8876_INT_CORE_TASK_DONE));
+  } else {
+    pinMode(pin, INPUT_PULLUP);
+    lcdRegDataWrite(RA8876_INTF, 1<<RA8876_INT_CORE_TASK_DONE);	// write 1 to clear anything stale
+    lcdRegDataWrite(RA8876_MINTFR, lcdRegDataRead(RA8876_MINTFR) & ~(1<<RA8876_INT_CORE_TASK_DONE));
+    lcdRegDataWrite(RA8876_INTEN, lcdRegDataRead(RA8876_INTEN) | (1<<RA8876_INT_CORE_TASK_DONE));
+  }
+  _intPin = pin;
+}
+
 
 //**************************************************************//
 /*[Status Register] bit2   SDRAM ready for access
@@ -1178,6 +1458,7 @@ void RA8876_t3::displayWindowStartXY(ru16 x0,ru16 y0)
 //**************************************************************//
 void RA8876_t3::canvasImageStartAddress(ru32 addr)	
 {
+	if(_pageClearPending) _pageClearPending &= ~_pageClearMask(addr, addr + 1);
 	lcdRegDataWrite(RA8876_CVSSA0,addr);//50h
 	lcdRegDataWrite(RA8876_CVSSA1,addr>>8);//51h
 	lcdRegDataWrite(RA8876_CVSSA2,addr>>16);//52h
@@ -1349,6 +1630,7 @@ void RA8876_t3::bte_Source1_WindowStartXY(ru16 x0,ru16 y0)
 //**************************************************************//
 void  RA8876_t3::bte_DestinationMemoryStartAddr(ru32 addr)	
 {
+	if(_pageClearPending) _pageClearPending &= ~_pageClearMask(addr, addr + 1);
 	lcdRegDataWrite(RA8876_DT_STR0,addr);//a7h
 	lcdRegDataWrite(RA8876_DT_STR1,addr>>8);//a8h
 	lcdRegDataWrite(RA8876_DT_STR2,addr>>16);//a9h
@@ -1504,9 +1786,10 @@ ru16 RA8876_t3::readPixel(int16_t x, int16_t y) {
 ru16 RA8876_t3::getPixel(ru16 x,ru16 y) {
   ru16 rdata = 0;
   ru16 dummy = 0;
-  selectScreen(currentPage);
+  check2dBusy();			          // the canvas is already currentPage
   graphicMode(true);
   setPixelCursor(x, y);		          // set memory address
+  if(_damageTracking) _damageMemWriteCovered = true;	// only reading
   ramAccessPrepare();			          // Setup SDRAM Access
   dummy = lcdDataRead();
   rdata = (lcdDataRead() & 0xff);		// read low byte
@@ -1514,12 +1797,65 @@ ru16 RA8876_t3::getPixel(ru16 x,ru16 y) {
  	return rdata;
 }
 
+//**************************************************************//
+// Read a block of pixels. The active window is set to the block so
+// the read address wraps to the next row by itself, then each row
+// is read in a single SPI frame straight into pcolors (the RA8876
+// sends low byte first, same as the buffer). Rotated, the window is
+// the same memory window _writeRectRotated() fills: rotation 2 rows
+// are reversed in place, rotation 1 and 3 memory rows are image
+// columns and go through a row buffer.
+//**************************************************************//
 void RA8876_t3::readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pcolors) {
-  for(uint16_t j = y; j < (h + y); j++) {
-    for(uint16_t i = x; i < (w + x); i++) {
-      *pcolors++ = getPixel(i, j);
+  if((w <= 0) || (h <= 0)) return;
+  int16_t mem_x = x, mem_y = y, mem_w = w, mem_h = h;
+  switch (_rotation) {
+    case 1: mem_x = y; mem_y = x; mem_w = h; mem_h = w; break;
+    case 2: mem_x = (width() - w) - x; break;
+    case 3: mem_x = height() - y - h; mem_y = x; mem_w = h; mem_h = w; break;
+  }
+  uint16_t *column = nullptr;
+  if(_rotation & 1) {
+    column = (uint16_t *)_scratchAlloc(mem_w * 2);
+    if(!column) return; // failed to allocate.
+  }
+  check2dBusy();
+  // Remember the active window so we can put it back
+  uint32_t aw_x, aw_y, aw_w, aw_h;
+  bool aw_known = _regShadowValue(RA8876_AWUL_X0, 2, aw_x) && _regShadowValue(RA8876_AWUL_Y0, 2, aw_y) &&
+                  _regShadowValue(RA8876_AW_WTH0, 2, aw_w) && _regShadowValue(RA8876_AW_HT0, 2, aw_h);
+  graphicMode(true);
+  activeWindowXY(mem_x, mem_y);
+  activeWindowWH(mem_w, mem_h);
+  // Memory coordinates already, not through setPixelCursor()
+  lcdRegDataWrite(RA8876_CURH0,mem_x); //5fh
+  lcdRegDataWrite(RA8876_CURH1,mem_x>>8);//60h
+  lcdRegDataWrite(RA8876_CURV0,mem_y);//61h
+  lcdRegDataWrite(RA8876_CURV1,mem_y>>8);//62h
+  if(_damageTracking) _damageMemWriteCovered = true;	// only reading
+  ramAccessPrepare();
+  lcdDataRead();	// first read after setting the address is a dummy
+
+  for(int16_t row = 0; row < mem_h; row++) {
+    uint16_t *dst = column ? column : pcolors + row * w;
+    checkReadFifoNotEmpty();
+    startSend();
+    _bus->readDataBuffer(dst, mem_w * 2);
+    endSend(true);
+    if(_rotation == 2) {
+      for(int16_t i = 0, j = w - 1; i < j; i++, j--) swapvals(dst[i], dst[j]);
+    } else if(column) {
+      for(int16_t j = 0; j < h; j++) pcolors[j * w + row] = column[j];
     }
   }
+
+  if(aw_known) {
+    activeWindowXY(aw_x, aw_y);
+    activeWindowWH(aw_w, aw_h);
+  } else {
+    _updateActiveWindow(false);
+  }
+  if(column) _scratchFree(column);
 }
 
 //**************************************************************//
@@ -1529,6 +1865,10 @@ void  RA8876_t3::drawPixel(ru16 x,ru16 y,ru16 color)
 {
 	graphicMode(true);
 	setPixelCursor(x,y);
+	if(_damageTracking) {
+		_damageAdd(x, y, x, y);
+		_damageMemWriteCovered = true;	// only this pixel, not the whole active window
+	}
 	ramAccessPrepare();
 	lcdDataWrite(color);
 	lcdDataWrite(color>>8);
@@ -2466,6 +2806,7 @@ void RA8876_t3::drawLine(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 color)
 	}
 	
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2482,6 +2823,7 @@ void RA8876_t3::drawLine(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 color)
   lcdRegDataWrite(RA8876_DLVER0,y1, false);//6eh
   lcdRegDataWrite(RA8876_DLVER1,y1>>8, false);//6fh        
   lcdRegDataWrite(RA8876_DCR0,RA8876_DRAW_LINE, true);//67h,0x80
+  endRegBatch();
 }
 
 
@@ -2510,6 +2852,7 @@ void RA8876_t3::drawSquare(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 color)
 	if (y_end > _displayclipy2) y_end = _displayclipy2;
 	
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2526,7 +2869,7 @@ void RA8876_t3::drawSquare(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 color)
   lcdRegDataWrite(RA8876_DLVER0,y1, false);//6eh
   lcdRegDataWrite(RA8876_DLVER1,y_end>>8, false);//6fh     
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_SQUARE, true);//76h,0xa0
-
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2555,6 +2898,7 @@ void RA8876_t3::drawSquareFill(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 color)
 	if (y_end > _displayclipy2) y_end = _displayclipy2;
 
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
   switch (_rotation) {
@@ -2570,7 +2914,8 @@ void RA8876_t3::drawSquareFill(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 color)
   lcdRegDataWrite(RA8876_DLHER1,x_end>>8, false);//6dh
   lcdRegDataWrite(RA8876_DLVER0,y_end, false);//6eh
   lcdRegDataWrite(RA8876_DLVER1,y_end>>8, false);//6fh     
-  lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_SQUARE_FILL, true);//76h,0xE0  
+  lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_SQUARE_FILL, true);//76h,0xE0
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2600,6 +2945,7 @@ void RA8876_t3::drawCircleSquare(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 xr, ru
 	if (y_end > _displayclipy2) y_end = _displayclipy2;	
 
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2620,6 +2966,7 @@ void RA8876_t3::drawCircleSquare(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 xr, ru
   lcdRegDataWrite(RA8876_ELL_B0,yr, false);//7ah    
   lcdRegDataWrite(RA8876_ELL_B1,yr>>8, false);//7bh
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_CIRCLE_SQUARE, true);//76h,0xb0
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2649,6 +2996,7 @@ void RA8876_t3::drawCircleSquareFill(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 xr
 	if (y_end > _displayclipy2) y_end = _displayclipy2;
 	
   check2dBusy();
+  beginRegBatch();
   //graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2669,6 +3017,7 @@ void RA8876_t3::drawCircleSquareFill(ru16 x0, ru16 y0, ru16 x1, ru16 y1, ru16 xr
   lcdRegDataWrite(RA8876_ELL_B0,yr, false);//79h    
   lcdRegDataWrite(RA8876_ELL_B1,yr>>8, false);//7ah
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_CIRCLE_SQUARE_FILL, true);//76h,0xf0
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2696,6 +3045,7 @@ void RA8876_t3::drawTriangle(ru16 x0,ru16 y0,ru16 x1,ru16 y1,ru16 x2,ru16 y2,ru1
   	}
 
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
   lcdRegDataWrite(RA8876_DLHSR0,x0, false);//68h point 0
@@ -2711,6 +3061,7 @@ void RA8876_t3::drawTriangle(ru16 x0,ru16 y0,ru16 x1,ru16 y1,ru16 x2,ru16 y2,ru1
   lcdRegDataWrite(RA8876_DTPV0,y2, false);//72h point 2
   lcdRegDataWrite(RA8876_DTPV1,y2>>8, false);//73h  point 2
   lcdRegDataWrite(RA8876_DCR0,RA8876_DRAW_TRIANGLE, false);//67h,0x82
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2738,6 +3089,7 @@ void RA8876_t3::drawTriangleFill(ru16 x0,ru16 y0,ru16 x1,ru16 y1,ru16 x2,ru16 y2
   	}
 
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
   lcdRegDataWrite(RA8876_DLHSR0,x0, false);//68h
@@ -2753,6 +3105,7 @@ void RA8876_t3::drawTriangleFill(ru16 x0,ru16 y0,ru16 x1,ru16 y1,ru16 x2,ru16 y2
   lcdRegDataWrite(RA8876_DTPV0,y2, false);//72h
   lcdRegDataWrite(RA8876_DTPV1,y2>>8, false);//73h  
   lcdRegDataWrite(RA8876_DCR0,RA8876_DRAW_TRIANGLE_FILL, true);//67h,0xa2
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2774,6 +3127,7 @@ void RA8876_t3::drawCircle(ru16 x0,ru16 y0,ru16 r,ru16 color)
 	if (r > _height / 2) r = (_height / 2) - 1;//this is the (undocumented) hardware limit of RA8875
 	
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2792,6 +3146,7 @@ void RA8876_t3::drawCircle(ru16 x0,ru16 y0,ru16 r,ru16 color)
   lcdRegDataWrite(RA8876_ELL_B1,r>>8, false);//7ah
 //  lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_BOTTOM_LEFT_CURVE);//76h,0x90 (arc test)
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_CIRCLE, true);//76h,0x80
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2813,6 +3168,7 @@ void RA8876_t3::drawCircleFill(ru16 x0,ru16 y0,ru16 r,ru16 color)
 	if (r > _height / 2) r = (_height / 2) - 1;//this is the (undocumented) hardware limit of RA8875
 	
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2830,6 +3186,7 @@ void RA8876_t3::drawCircleFill(ru16 x0,ru16 y0,ru16 r,ru16 color)
   lcdRegDataWrite(RA8876_ELL_B1,r>>8, false);//7ah
 //  lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_BOTTOM_LEFT_CURVE_FILL);//76h,0xd0 (arc test)
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_CIRCLE_FILL, false);//76h,0xc0
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2860,6 +3217,7 @@ void RA8876_t3::drawEllipse(ru16 x0,ru16 y0,ru16 xr,ru16 yr,ru16 color)
 	
 	
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2876,6 +3234,7 @@ void RA8876_t3::drawEllipse(ru16 x0,ru16 y0,ru16 xr,ru16 yr,ru16 color)
   lcdRegDataWrite(RA8876_ELL_B0,yr, false);//79h    
   lcdRegDataWrite(RA8876_ELL_B1,yr>>8, false);//7ah
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_ELLIPSE, true);//76h,0x80
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -2904,6 +3263,7 @@ void RA8876_t3::drawEllipseFill(ru16 x0,ru16 y0,ru16 xr,ru16 yr,ru16 color)
 	}
 	
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   foreGroundColor16bpp(color);
 	switch (_rotation) {
@@ -2920,12 +3280,18 @@ void RA8876_t3::drawEllipseFill(ru16 x0,ru16 y0,ru16 xr,ru16 yr,ru16 color)
   lcdRegDataWrite(RA8876_ELL_B0,yr, false);//79h    
   lcdRegDataWrite(RA8876_ELL_B1,yr>>8, false);//7ah
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_ELLIPSE_FILL, true);//76h,0xc0
+  endRegBatch();
 }
 
 //*************************************************************//
 // Scroll Screen up
 //*************************************************************//
 void RA8876_t3::scroll(void) { // No arguments for now
+	if (_hwScroll(_FNTheight*_scaleY)) {
+		drawSquareFill(_scrollXL, _scrollYB-(_FNTheight*_scaleY), _scrollXR-1, _scrollYB-1, _TXTBackColor);
+		textColor(_TXTForeColor,_TXTBackColor);
+		return;
+	}
 	bteMemoryCopy(currentPage,SCREEN_WIDTH, _scrollXL, _scrollYT+(_FNTheight*_scaleY),	//Source
 				  currentPage,SCREEN_WIDTH, _scrollXL, pageOffset+_scrollYT,	//Desination
 				  _scrollXR-_scrollXL, _scrollYB-_scrollYT-(_FNTheight*_scaleY)); //Copy Width, Height
@@ -2938,18 +3304,101 @@ void RA8876_t3::scroll(void) { // No arguments for now
 // Scroll Screen down
 //*************************************************************//
 void RA8876_t3::scrollDown(void) { // No arguments for now
-	bteMemoryCopy(currentPage,SCREEN_WIDTH, _scrollXL, _scrollYT,	//Source
-				  PAGE10_START_ADDR,SCREEN_WIDTH, _scrollXL, _scrollYT,	//Desination
-				  _scrollXR-_scrollXL, (_scrollYB-_scrollYT)-(_FNTheight*_scaleY)); //Copy Width, Height
-	bteMemoryCopy(PAGE10_START_ADDR,SCREEN_WIDTH, _scrollXL, _scrollYT,	//Source
-				  currentPage,SCREEN_WIDTH, _scrollXL, _scrollYT+(_FNTheight*_scaleY),	//Desination
-				  _scrollXR-_scrollXL, (_scrollYB-_scrollYT)-_FNTheight); //Copy Width, Height
+	if (_hwScroll(-(_FNTheight*_scaleY))) {
+		drawSquareFill(_scrollXL, _scrollYT, _scrollXR-1,_scrollYT+(_FNTheight*_scaleY), _TXTBackColor);
+		textColor(_TXTForeColor,_TXTBackColor);
+		return;
+	}
+	bteMove(currentPage,SCREEN_WIDTH, _scrollXL, _scrollYT,	//Source
+			_scrollXL, _scrollYT+(_FNTheight*_scaleY),	//Desination
+			_scrollXR-_scrollXL, (_scrollYB-_scrollYT)-(_FNTheight*_scaleY)); //Move Width, Height
 	// Clear top text line
 	drawSquareFill(_scrollXL, _scrollYT, _scrollXR-1,_scrollYT+(_FNTheight*_scaleY), _TXTBackColor);
 	textColor(_TXTForeColor,_TXTBackColor);
 
 }
 
+//*************************************************************//
+// Hardware scroll: the screen is a window onto a ring of
+// RA8876_SCROLL_RING_ROWS rows. Scrolling a line moves the display
+// and canvas start address by that many rows, everything drawn
+// after that lands in the right place without any other changes.
+// Only when the window reaches the end of the ring is the screen
+// copied back to the other end.
+//*************************************************************//
+bool RA8876_t3::useHardwareScroll(bool on) {
+	if (on == hardwareScrollActive()) return true;
+	if (on) {
+		if ((_rotation != 0) || _swapBuffers || _damageTracking || (_surfaceSelected >= 0)) {
+			Serial.println("useHardwareScroll: needs rotation 0 and no canvas, swap chain or surface");
+			return false;
+		}
+		int16_t ring = surfaceAlloc(SCREEN_WIDTH, RA8876_SCROLL_RING_ROWS);
+		if (ring < 0) {
+			Serial.println("useHardwareScroll: not enough SDRAM for the ring");
+			return false;
+		}
+		_hwScrollPage = currentPage;
+		bteMemoryCopy(currentPage, SCREEN_WIDTH, 0, 0, surfaceAddress(ring), SCREEN_WIDTH, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+		_hwScrollSurface = ring;
+		_hwScrollRow = 0;
+	} else {
+		bteMemoryCopy(surfaceAddress(_hwScrollSurface), SCREEN_WIDTH, 0, _hwScrollRow,
+					  _hwScrollPage, SCREEN_WIDTH, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+		surfaceFree(_hwScrollSurface);
+		_hwScrollSurface = -1;
+	}
+	_hwScrollApply();
+	return true;
+}
+
+// Point the display and the canvas at the top of the screen in the ring
+void RA8876_t3::_hwScrollApply(void) {
+	uint32_t addr = hardwareScrollActive() ?
+		surfaceAddress(_hwScrollSurface) + (uint32_t)_hwScrollRow * SCREEN_WIDTH * 2 : _hwScrollPage;
+	check2dBusy();
+	displayImageStartAddress(addr);
+	displayImageWidth(SCREEN_WIDTH);
+	displayWindowStartXY(0,0);
+	canvasImageStartAddress(addr);
+	canvasImageWidth(SCREEN_WIDTH);
+	currentPage = addr;
+	pageOffset = addr;
+	ramAccessPrepare();
+}
+
+// Copy rows within the ring, they may overlap
+void RA8876_t3::_hwScrollCopyRows(uint16_t src_row, uint16_t dst_row, uint16_t rows) {
+	bteMove(surfaceAddress(_hwScrollSurface), SCREEN_WIDTH, 0, src_row, 0, dst_row, SCREEN_WIDTH, rows);
+}
+
+// Scroll the region up (rows > 0) or down. Returns false if scroll()
+// has to do it by copying instead.
+bool RA8876_t3::_hwScroll(int16_t rows) {
+	if (!hardwareScrollActive()) return false;
+	if ((_scrollXL != 0) || (_scrollXR != SCREEN_WIDTH) || (_rotation != 0)) return false;
+	uint16_t top = _scrollYT;				// rows above the scroll region
+	uint16_t bottom = _scrollYB;			// first row below it
+	if (rows > 0) {
+		if ((_hwScrollRow + SCREEN_HEIGHT + rows) > RA8876_SCROLL_RING_ROWS) {
+			_hwScrollCopyRows(_hwScrollRow, 0, SCREEN_HEIGHT);
+			_hwScrollRow = 0;
+		}
+	} else {
+		if (_hwScrollRow < -rows) {
+			_hwScrollCopyRows(_hwScrollRow, RA8876_SCROLL_RING_ROWS - SCREEN_HEIGHT, SCREEN_HEIGHT);
+			_hwScrollRow = RA8876_SCROLL_RING_ROWS - SCREEN_HEIGHT;
+		}
+	}
+	// The rows outside the scroll region stay where they are on the screen
+	uint16_t row = _hwScrollRow + rows;
+	_hwScrollCopyRows(_hwScrollRow, row, top);
+	_hwScrollCopyRows(_hwScrollRow + bottom, row + bottom, SCREEN_HEIGHT - bottom);
+	_hwScrollRow = row;
+	_hwScrollApply();
+	return true;
+}
+
 //*************************************************************//
 // Put a section of current screen page to another screen page.
 // x0,y0 is upper left start coordinates of section
@@ -2991,6 +3440,7 @@ void RA8876_t3::bteMemoryCopy(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0
 								ru16 copy_width,ru16 copy_height)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_Source0_MemoryStartAddr(s0_addr);
   bte_Source0_ImageWidth(s0_image_width);
@@ -3009,8 +3459,60 @@ void RA8876_t3::bteMemoryCopy(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0
 //  lcdRegDataWrite(RA8876_BTE_CTRL1,RA8876_BTE_ROP_CODE_12<<4|3);//91h
   lcdRegDataWrite(RA8876_BTE_COLR,(RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP) & 0x7f);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
+  endRegBatch();
 } 
 
+//**************************************************************//
+// Move a rectangle within one image, like memmove the source and
+// destination may overlap. The BTE copies top to bottom and left
+// to right, which is only safe moving up, or left along the same
+// rows. Moving down (or right) over itself the move is split into
+// bands no taller (wider) than the distance moved, copied from the
+// far end back, so no band is overwritten before it is copied.
+// If that takes more than RA8876_MOVE_MAX_BANDS copies each band
+// goes through a temporary surface instead, twice the traffic but
+// far fewer BTE operations.
+//**************************************************************//
+void RA8876_t3::bteMove(ru32 addr,ru16 image_width,ru16 s_x,ru16 s_y,ru16 d_x,ru16 d_y,ru16 move_width,ru16 move_height)
+{
+  if(!move_width || !move_height || ((s_x == d_x) && (s_y == d_y))) return;
+  bool overlap = (d_x < s_x + move_width) && (s_x < d_x + move_width) &&
+                 (d_y < s_y + move_height) && (s_y < d_y + move_height);
+  bool down = d_y > s_y;
+  bool right = (d_y == s_y) && (d_x > s_x);
+  if(!overlap || (!down && !right)) {
+    bteMemoryCopy(addr, image_width, s_x, s_y, addr, image_width, d_x, d_y, move_width, move_height);
+    return;
+  }
+  ru16 size = down ? move_height : move_width;		// along the direction split up
+  ru16 band = down ? d_y - s_y : d_x - s_x;
+  int16_t temp = -1;
+  if(((size + band - 1) / band) > RA8876_MOVE_MAX_BANDS) {
+    band = (size + RA8876_MOVE_MAX_BANDS - 1) / RA8876_MOVE_MAX_BANDS;
+    temp = down ? surfaceAlloc(move_width, band) : surfaceAlloc(band, move_height);
+    if(temp < 0) band = down ? d_y - s_y : d_x - s_x;	// no room, lots of bands it is
+  }
+  ru16 temp_width = surfaceImageWidth(temp);
+  ru32 temp_addr = surfaceAddress(temp);
+  while(size) {
+    ru16 n = min(band, size);
+    size -= n;
+    ru16 sx = s_x, sy = s_y, dx = d_x, dy = d_y, w = move_width, h = move_height;
+    if(down) { sy += size; dy += size; h = n; }
+    else { sx += size; dx += size; w = n; }
+    if(temp >= 0) {
+      bteMemoryCopy(addr, image_width, sx, sy, temp_addr, temp_width, 0, 0, w, h);
+      bteMemoryCopy(temp_addr, temp_width, 0, 0, addr, image_width, dx, dy, w, h);
+    } else {
+      bteMemoryCopy(addr, image_width, sx, sy, addr, image_width, dx, dy, w, h);
+    }
+  }
+  if(temp >= 0) {
+    check2dBusy();
+    surfaceFree(temp);
+  }
+}
+
 //**************************************************************//
 // Memory copy with Raster OPeration blend from two sources
 // One source may be the destination, if blending with something already on the screen
@@ -3022,6 +3524,7 @@ void RA8876_t3::bteMemoryCopyWithROP(
     ru16 copy_width,ru16 copy_height,ru8 rop_code)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_Source0_MemoryStartAddr(s0_addr);
   bte_Source0_ImageWidth(s0_image_width);
@@ -3036,6 +3539,7 @@ void RA8876_t3::bteMemoryCopyWithROP(
   lcdRegDataWrite(RA8876_BTE_CTRL1,rop_code<<4|RA8876_BTE_MEMORY_COPY_WITH_ROP);//91h
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
+  endRegBatch();
 } 
 //**************************************************************//
 // Memory copy with one color set to transparent
@@ -3046,6 +3550,7 @@ void RA8876_t3::bteMemoryCopyWithChromaKey(
 		ru16 copy_width, ru16 copy_height, ru16 chromakey_color)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_Source0_MemoryStartAddr(s0_addr);
   bte_Source0_ImageWidth(s0_image_width);
@@ -3058,6 +3563,7 @@ void RA8876_t3::bteMemoryCopyWithChromaKey(
   lcdRegDataWrite(RA8876_BTE_CTRL1,RA8876_BTE_MEMORY_COPY_WITH_CHROMA);//91h
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
+  endRegBatch();
 }
 //**************************************************************//
 // Blend two source images with a simple transparency 0-32
@@ -3069,6 +3575,7 @@ void RA8876_t3::bteMemoryCopyWindowAlpha(
 		ru16 copy_width, ru16 copy_height, ru8 alpha)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_Source0_MemoryStartAddr(s0_addr);
   bte_Source0_ImageWidth(s0_image_width);
@@ -3084,6 +3591,7 @@ void RA8876_t3::bteMemoryCopyWindowAlpha(
   lcdRegDataWrite(RA8876_BTE_CTRL1,RA8876_BTE_MEMORY_COPY_WITH_OPACITY);//91h
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -3096,19 +3604,7 @@ ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru8 rop_code,const unsigned char *d
 {
   bteMpuWriteWithROP(s1_addr, s1_image_width, s1_x, s1_y, des_addr, des_image_width, des_x, des_y, width, height, rop_code);
   
-  startSend();
-  _pspi->transfer(RA8876_SPI_DATAWRITE);
-
-#ifdef SPI_HAS_TRANSFER_ASYNC
-  activeDMA = true;
-  _pspi->transfer(data, NULL, width*height*2, finishedDMAEvent);
-#else
-  //If you try _pspi->transfer(data, length) then this tries to write received data into the data buffer
-  //but if we were given a PROGMEM (unwriteable) data pointer then _pspi->transfer will lock up totally.
-  //So we explicitly tell it we don't care about any return data.
-  _pspi->transfer(data, NULL, width*height*2);
-  endSend(true);
-#endif
+  lcdDataWriteBurst(data, width*height*2);
 }
 //**************************************************************//
 // For 16-bit byte-reversed data.
@@ -3123,13 +3619,11 @@ ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru8 rop_code,const unsigned short *
   bteMpuWriteWithROP(s1_addr, s1_image_width, s1_x, s1_y, des_addr, des_image_width, des_x, des_y, width, height, rop_code);
 
   startSend();
-  _pspi->transfer(RA8876_SPI_DATAWRITE);
-  
   for(j=0;j<height;j++)
   {
     for(i=0;i<width;i++)
     {
-	  _pspi->transfer16(*data);	  
+	  _bus->writeData16(*data);
       data++;
     }
   } 
@@ -3142,6 +3636,7 @@ ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru8 rop_code,const unsigned short *
 void RA8876_t3::bteMpuWriteWithROP(ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,ru32 des_addr,ru16 des_image_width,ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru8 rop_code)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_Source1_MemoryStartAddr(s1_addr);
   bte_Source1_ImageWidth(s1_image_width);
@@ -3154,6 +3649,7 @@ void RA8876_t3::bteMpuWriteWithROP(ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
   ramAccessPrepare();
+  endRegBatch();
 }
 
 //**************************************************************//
@@ -3164,16 +3660,7 @@ void RA8876_t3::bteMpuWriteWithChromaKeyData8(ru32 des_addr,ru16 des_image_width
 {
   bteMpuWriteWithChromaKey(des_addr, des_image_width, des_x, des_y, width, height, chromakey_color);  
 
-  startSend();
-  _pspi->transfer(RA8876_SPI_DATAWRITE);
-
-#ifdef SPI_HAS_TRANSFER_ASYNC
-  activeDMA = true;
-  _pspi->transfer(data, NULL, width*height*2, finishedDMAEvent);
-#else
-  _pspi->transfer(data, NULL, width*height*2);
-  endSend(true);
-#endif
+  lcdDataWriteBurst(data, width*height*2);
 }
 //**************************************************************//
 // Chromakey for 16-bit byte-reversed data. (Slower than 8-bit.)
@@ -3184,12 +3671,11 @@ void RA8876_t3::bteMpuWriteWithChromaKeyData16(ru32 des_addr,ru16 des_image_widt
   bteMpuWriteWithChromaKey(des_addr, des_image_width, des_x, des_y, width, height, chromakey_color);
   
   startSend();
-  _pspi->transfer(RA8876_SPI_DATAWRITE);
   for(j=0;j<height;j++)
   {
     for(i=0;i<width;i++)
     {
-	  _pspi->transfer16(*data);
+	  _bus->writeData16(*data);
       data++;
     }
   } 
@@ -3202,6 +3688,7 @@ void RA8876_t3::bteMpuWriteWithChromaKeyData16(ru32 des_addr,ru16 des_image_widt
 void RA8876_t3::bteMpuWriteWithChromaKey(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 chromakey_color)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_DestinationMemoryStartAddr(des_addr);
   bte_DestinationImageWidth(des_image_width);
@@ -3212,14 +3699,15 @@ void RA8876_t3::bteMpuWriteWithChromaKey(ru32 des_addr,ru16 des_image_width, ru1
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
   ramAccessPrepare();
+  endRegBatch();
 }
 
 //**************************************************************//
 //**************************************************************//
 void RA8876_t3::bteMpuWriteColorExpansionData(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 foreground_color,ru16 background_color,const unsigned char *data)
 {
-  ru16 i,j;
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_DestinationMemoryStartAddr(des_addr);
   bte_DestinationImageWidth(des_image_width);
@@ -3231,15 +3719,14 @@ void RA8876_t3::bteMpuWriteColorExpansionData(ru32 des_addr,ru16 des_image_width
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
   ramAccessPrepare();
+  endRegBatch();
   
-  for(i=0;i< height;i++)
-  {	
-    for(j=0;j< ((width+7)/8);j++)
-    {
-      lcdDataWrite(*data, false);
-      data++;
-    }
-  }
+  // Rows are padded out to whole bytes. It is all data until CS goes
+  // high, so send it as one frame instead of a data cycle per byte.
+  startSend();
+  _bus->writeDataBuffer(data, ((width+7)/8) * height);
+  endSend(true);
+  _coreTaskPending |= CORE_TASK_MEMWRITE;
   lcdStatusRead();
 }
 //**************************************************************//
@@ -3248,6 +3735,7 @@ void RA8876_t3::bteMpuWriteColorExpansionData(ru32 des_addr,ru16 des_image_width
 void RA8876_t3::bteMpuWriteColorExpansion(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 foreground_color,ru16 background_color)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_DestinationMemoryStartAddr(des_addr);
   bte_DestinationImageWidth(des_image_width);
@@ -3259,14 +3747,15 @@ void RA8876_t3::bteMpuWriteColorExpansion(ru32 des_addr,ru16 des_image_width, ru
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
   ramAccessPrepare();
+  endRegBatch();
 }
 //**************************************************************//
 /*background_color do not set the same as foreground_color*/
 //**************************************************************//
 void RA8876_t3::bteMpuWriteColorExpansionWithChromaKeyData(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 foreground_color,ru16 background_color, const unsigned char *data)
 {
-  ru16 i,j;
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_DestinationMemoryStartAddr(des_addr);
   bte_DestinationImageWidth(des_image_width);
@@ -3278,15 +3767,14 @@ void RA8876_t3::bteMpuWriteColorExpansionWithChromaKeyData(ru32 des_addr,ru16 de
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
   ramAccessPrepare();
+  endRegBatch();
   
-  for(i=0;i< height;i++)
-  {	
-    for(j=0;j< ((width+7)/8);j++)
-    {
-      lcdDataWrite(*data, false);
-      data++;
-    }
-  }
+  // Rows are padded out to whole bytes. It is all data until CS goes
+  // high, so send it as one frame instead of a data cycle per byte.
+  startSend();
+  _bus->writeDataBuffer(data, ((width+7)/8) * height);
+  endSend(true);
+  _coreTaskPending |= CORE_TASK_MEMWRITE;
   lcdStatusRead();
 }
 //**************************************************************//
@@ -3296,6 +3784,7 @@ void RA8876_t3::bteMpuWriteColorExpansionWithChromaKeyData(ru32 des_addr,ru16 de
 void RA8876_t3::bteMpuWriteColorExpansionWithChromaKey(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 foreground_color,ru16 background_color)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_DestinationMemoryStartAddr(des_addr);
   bte_DestinationImageWidth(des_image_width);
@@ -3307,6 +3796,7 @@ void RA8876_t3::bteMpuWriteColorExpansionWithChromaKey(ru32 des_addr,ru16 des_im
   lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
   lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
   ramAccessPrepare();
+  endRegBatch();
 }
 //**************************************************************//
 //**************************************************************//
@@ -3314,6 +3804,7 @@ void  RA8876_t3::btePatternFill(ru8 p8x8or16x16, ru32 s0_addr,ru16 s0_image_widt
                                  ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height)
 { 
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_Source0_MemoryStartAddr(s0_addr);
   bte_Source0_ImageWidth(s0_image_width);
@@ -3329,13 +3820,31 @@ void  RA8876_t3::btePatternFill(ru8 p8x8or16x16, ru32 s0_addr,ru16 s0_image_widt
     lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4|RA8876_PATTERN_FORMAT8X8);//90h
   else
     lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4|RA8876_PATTERN_FORMAT16X16);//90h
-   
+  endRegBatch();
+}
+//**************************************************************//
+//**************************************************************//
+void  RA8876_t3::bteSolidFill(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 color)
+{
+  check2dBusy();
+  beginRegBatch();
+  graphicMode(true);
+  bte_DestinationMemoryStartAddr(des_addr);
+  bte_DestinationImageWidth(des_image_width);
+  bte_DestinationWindowStartXY(des_x,des_y);
+  bte_WindowSize(width,height);
+  foreGroundColor16bpp(color);
+  lcdRegDataWrite(RA8876_BTE_CTRL1,RA8876_BTE_SOLID_FILL);//91h
+  lcdRegDataWrite(RA8876_BTE_COLR,RA8876_S0_COLOR_DEPTH_16BPP<<5|RA8876_S1_COLOR_DEPTH_16BPP<<2|RA8876_DESTINATION_COLOR_DEPTH_16BPP);//92h
+  lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4);//90h
+  endRegBatch();
 }
 //**************************************************************//
 //**************************************************************//
 void  RA8876_t3::btePatternFillWithChromaKey(ru8 p8x8or16x16, ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 chromakey_color)
 {
   check2dBusy();
+  beginRegBatch();
   graphicMode(true);
   bte_Source0_MemoryStartAddr(s0_addr);
   bte_Source0_ImageWidth(s0_image_width);
@@ -3352,46 +3861,198 @@ void  RA8876_t3::btePatternFillWithChromaKey(ru8 p8x8or16x16, ru32 s0_addr,ru16
     lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4|RA8876_PATTERN_FORMAT8X8);//90h
   else
     lcdRegDataWrite(RA8876_BTE_CTRL0,RA8876_BTE_ENABLE<<4|RA8876_PATTERN_FORMAT16X16);//90h
-
+  endRegBatch();
 }
 
- /*DMA Function*/
- //**************************************************************//
- /*If used 32bit address serial flash through ra8876, must be set command to serial flash to enter 4bytes mode first.
- only needs set one times after power on */
- //**************************************************************//
- void  RA8876_t3::setSerialFlash4BytesMode(ru8 scs_select)
- {
-  if(scs_select==0)
-  {
-  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_0<<5|RA8876_SPIM_MODE0);//b9h
-  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_0<<5|RA8876_SPIM_NSS_ACTIVE<<4|RA8876_SPIM_MODE0);//b9h 
-  lcdRegWrite( RA8876_SPIDR);//b8h
-  delay(1);
-  lcdDataWrite(0xB7);//
-  delay(1);
-  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_0<<5|RA8876_SPIM_NSS_INACTIVE<<4|RA8876_SPIM_MODE0);//b9h 
-  }
-  if(scs_select==1)
-  {
-  lcdRegDataWrite( RA8876_SPIMCR2 ,RA8876_SPIM_NSS_SELECT_1<<5|RA8876_SPIM_MODE0);//b9h
-  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_1<<5|RA8876_SPIM_NSS_ACTIVE<<4|RA8876_SPIM_MODE0);//b9h
-  lcdRegWrite( RA8876_SPIDR);//b8h
-  delay(1);
-  lcdDataWrite(0xB7);//
-  delay(1);
-  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_1<<5|RA8876_SPIM_NSS_INACTIVE<<4|RA8876_SPIM_MODE0);//b9h 
-  } 
- }
 //**************************************************************//
-/* scs = 0 : select scs0, scs = 1 : select scs1, */
+// BTE job queue. The bteQueue functions save the operation and
+// return, bteService() starts the next one whenever the 2D engine
+// is free so the CPU can get on with other work in between.
 //**************************************************************//
- void  RA8876_t3::dma_24bitAddressBlockMode(ru8 scs_select,ru8 clk_div,ru16 x0,ru16 y0,ru16 width,ru16 height,ru16 picture_width,ru32 addr)
- {
-   if(scs_select==0)
-    lcdRegDataWrite(RA8876_SFL_CTRL,RA8876_SERIAL_FLASH_SELECT0<<7|RA8876_SERIAL_FLASH_DMA_MODE<<6|RA8876_SERIAL_FLASH_ADDR_24BIT<<5|RA8876_FOLLOW_RA8876_MODE<<4|RA8876_SPI_FAST_READ_8DUMMY);//b7h
-   if(scs_select==1)
-    lcdRegDataWrite(RA8876_SFL_CTRL,RA8876_SERIAL_FLASH_SELECT1<<7|RA8876_SERIAL_FLASH_DMA_MODE<<6|RA8876_SERIAL_FLASH_ADDR_24BIT<<5|RA8876_FOLLOW_RA8876_MODE<<4|RA8876_SPI_FAST_READ_8DUMMY);//b7h
+bteJob_t *RA8876_t3::_bteQueueAlloc(uint8_t op)
+{
+  // If full we have to wait for the engine to take one
+  while(_bteJobCount == RA8876_BTE_QUEUE_SIZE) {
+    _bteInService = true;
+    check2dBusy();
+    _bteInService = false;
+    bteService();
+  }
+  bteJob_t *job = &_bteJobs[(_bteJobHead + _bteJobCount) % RA8876_BTE_QUEUE_SIZE];
+  job->op = op;
+  return job;
+}
+
+void RA8876_t3::bteQueueMemoryCopy(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
+								ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,
+								ru16 copy_width,ru16 copy_height)
+{
+  bteJob_t *job = _bteQueueAlloc(BTE_JOB_MEMORY_COPY);
+  job->s0_addr = s0_addr; job->s0_image_width = s0_image_width; job->s0_x = s0_x; job->s0_y = s0_y;
+  job->des_addr = des_addr; job->des_image_width = des_image_width; job->des_x = des_x; job->des_y = des_y;
+  job->width = copy_width; job->height = copy_height;
+  _bteJobCount++;
+  bteService();
+}
+
+void RA8876_t3::bteQueueMemoryCopyWithROP(
+	ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
+	ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,
+    ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,
+    ru16 copy_width,ru16 copy_height,ru8 rop_code)
+{
+  bteJob_t *job = _bteQueueAlloc(BTE_JOB_MEMORY_COPY_WITH_ROP);
+  job->s0_addr = s0_addr; job->s0_image_width = s0_image_width; job->s0_x = s0_x; job->s0_y = s0_y;
+  job->s1_addr = s1_addr; job->s1_image_width = s1_image_width; job->s1_x = s1_x; job->s1_y = s1_y;
+  job->des_addr = des_addr; job->des_image_width = des_image_width; job->des_x = des_x; job->des_y = des_y;
+  job->width = copy_width; job->height = copy_height;
+  job->rop_or_pattern = rop_code;
+  _bteJobCount++;
+  bteService();
+}
+
+void RA8876_t3::bteQueuePatternFill(ru8 p8x8or16x16, ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
+                                 ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height)
+{
+  bteJob_t *job = _bteQueueAlloc(BTE_JOB_PATTERN_FILL);
+  job->s0_addr = s0_addr; job->s0_image_width = s0_image_width; job->s0_x = s0_x; job->s0_y = s0_y;
+  job->des_addr = des_addr; job->des_image_width = des_image_width; job->des_x = des_x; job->des_y = des_y;
+  job->width = width; job->height = height;
+  job->rop_or_pattern = p8x8or16x16;
+  _bteJobCount++;
+  bteService();
+}
+
+void RA8876_t3::bteQueueMemoryCopyWithChromaKey(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
+								ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,
+								ru16 copy_width,ru16 copy_height,ru16 chromakey_color)
+{
+  bteJob_t *job = _bteQueueAlloc(BTE_JOB_MEMORY_COPY_WITH_CHROMA);
+  job->s0_addr = s0_addr; job->s0_image_width = s0_image_width; job->s0_x = s0_x; job->s0_y = s0_y;
+  job->des_addr = des_addr; job->des_image_width = des_image_width; job->des_x = des_x; job->des_y = des_y;
+  job->width = copy_width; job->height = copy_height;
+  job->chromakey = chromakey_color;
+  _bteJobCount++;
+  bteService();
+}
+
+void RA8876_t3::bteQueueMemoryCopyWindowAlpha(
+	ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
+	ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,
+    ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,
+    ru16 copy_width,ru16 copy_height,ru8 alpha)
+{
+  bteJob_t *job = _bteQueueAlloc(BTE_JOB_MEMORY_COPY_WINDOW_ALPHA);
+  job->s0_addr = s0_addr; job->s0_image_width = s0_image_width; job->s0_x = s0_x; job->s0_y = s0_y;
+  job->s1_addr = s1_addr; job->s1_image_width = s1_image_width; job->s1_x = s1_x; job->s1_y = s1_y;
+  job->des_addr = des_addr; job->des_image_width = des_image_width; job->des_x = des_x; job->des_y = des_y;
+  job->width = copy_width; job->height = copy_height;
+  job->rop_or_pattern = alpha;
+  _bteJobCount++;
+  bteService();
+}
+
+//**************************************************************//
+// Start the next queued BTE operation if the engine is free.
+// Never waits. Returns the number of operations still queued.
+//**************************************************************//
+uint8_t RA8876_t3::bteService(void)
+{
+  if(!_bteJobCount || _bteInService) return _bteJobCount;
+  if(coreBusy()) return _bteJobCount;
+  
+  _bteInService = true;
+  bteJob_t *job = &_bteJobs[_bteJobHead];
+  _bteJobHead = (_bteJobHead + 1) % RA8876_BTE_QUEUE_SIZE;
+  _bteJobCount--;
+  _bteRunJob(job);
+  _bteInService = false;
+  return _bteJobCount;
+}
+
+//**************************************************************//
+// Wait for all of the queued BTE operations to be started
+//**************************************************************//
+void RA8876_t3::bteQueueFlush(void)
+{
+  while(_bteJobCount) {
+    _bteInService = true;
+    check2dBusy();
+    _bteInService = false;
+    bteService();
+  }
+}
+
+void RA8876_t3::_bteRunJob(const bteJob_t *job)
+{
+  switch(job->op) {
+    case BTE_JOB_MEMORY_COPY:
+      bteMemoryCopy(job->s0_addr, job->s0_image_width, job->s0_x, job->s0_y,
+                    job->des_addr, job->des_image_width, job->des_x, job->des_y,
+                    job->width, job->height);
+      break;
+    case BTE_JOB_MEMORY_COPY_WITH_ROP:
+      bteMemoryCopyWithROP(job->s0_addr, job->s0_image_width, job->s0_x, job->s0_y,
+                    job->s1_addr, job->s1_image_width, job->s1_x, job->s1_y,
+                    job->des_addr, job->des_image_width, job->des_x, job->des_y,
+                    job->width, job->height, job->rop_or_pattern);
+      break;
+    case BTE_JOB_PATTERN_FILL:
+      btePatternFill(job->rop_or_pattern, job->s0_addr, job->s0_image_width, job->s0_x, job->s0_y,
+                    job->des_addr, job->des_image_width, job->des_x, job->des_y,
+                    job->width, job->height);
+      break;
+    case BTE_JOB_MEMORY_COPY_WITH_CHROMA:
+      bteMemoryCopyWithChromaKey(job->s0_addr, job->s0_image_width, job->s0_x, job->s0_y,
+                    job->des_addr, job->des_image_width, job->des_x, job->des_y,
+                    job->width, job->height, job->chromakey);
+      break;
+    case BTE_JOB_MEMORY_COPY_WINDOW_ALPHA:
+      bteMemoryCopyWindowAlpha(job->s0_addr, job->s0_image_width, job->s0_x, job->s0_y,
+                    job->s1_addr, job->s1_image_width, job->s1_x, job->s1_y,
+                    job->des_addr, job->des_image_width, job->des_x, job->des_y,
+                    job->width, job->height, job->rop_or_pattern);
+      break;
+  }
+}
+
+ /*DMA Function*/
+ //**************************************************************//
+ /*If used 32bit address serial flash through ra8876, must be set command to serial flash to enter 4bytes mode first.
+ only needs set one times after power on */
+ //**************************************************************//
+ void  RA8876_t3::setSerialFlash4BytesMode(ru8 scs_select)
+ {
+  if(scs_select==0)
+  {
+  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_0<<5|RA8876_SPIM_MODE0);//b9h
+  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_0<<5|RA8876_SPIM_NSS_ACTIVE<<4|RA8876_SPIM_MODE0);//b9h 
+  lcdRegWrite( RA8876_SPIDR);//b8h
+  delay(1);
+  lcdDataWrite(0xB7);//
+  delay(1);
+  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_0<<5|RA8876_SPIM_NSS_INACTIVE<<4|RA8876_SPIM_MODE0);//b9h 
+  }
+  if(scs_select==1)
+  {
+  lcdRegDataWrite( RA8876_SPIMCR2 ,RA8876_SPIM_NSS_SELECT_1<<5|RA8876_SPIM_MODE0);//b9h
+  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_1<<5|RA8876_SPIM_NSS_ACTIVE<<4|RA8876_SPIM_MODE0);//b9h
+  lcdRegWrite( RA8876_SPIDR);//b8h
+  delay(1);
+  lcdDataWrite(0xB7);//
+  delay(1);
+  lcdRegDataWrite( RA8876_SPIMCR2, RA8876_SPIM_NSS_SELECT_1<<5|RA8876_SPIM_NSS_INACTIVE<<4|RA8876_SPIM_MODE0);//b9h 
+  } 
+ }
+//**************************************************************//
+/* scs = 0 : select scs0, scs = 1 : select scs1, */
+//**************************************************************//
+ void  RA8876_t3::dma_24bitAddressBlockMode(ru8 scs_select,ru8 clk_div,ru16 x0,ru16 y0,ru16 width,ru16 height,ru16 picture_width,ru32 addr)
+ {
+   if(scs_select==0)
+    lcdRegDataWrite(RA8876_SFL_CTRL,RA8876_SERIAL_FLASH_SELECT0<<7|RA8876_SERIAL_FLASH_DMA_MODE<<6|RA8876_SERIAL_FLASH_ADDR_24BIT<<5|RA8876_FOLLOW_RA8876_MODE<<4|RA8876_SPI_FAST_READ_8DUMMY);//b7h
+   if(scs_select==1)
+    lcdRegDataWrite(RA8876_SFL_CTRL,RA8876_SERIAL_FLASH_SELECT1<<7|RA8876_SERIAL_FLASH_DMA_MODE<<6|RA8876_SERIAL_FLASH_ADDR_24BIT<<5|RA8876_FOLLOW_RA8876_MODE<<4|RA8876_SPI_FAST_READ_8DUMMY);//b7h
   
   lcdRegDataWrite(RA8876_SPI_DIVSOR,clk_div);//bbh  
   lcdRegDataWrite(RA8876_DMA_DX0,x0);//c0h
@@ -3841,6 +4502,16 @@ PIP 2 Window Color Depth Setting
 	lcdRegDataWrite(RA8876_PIPCDEP,temp);
 }
 
+// Saved parameters for the screen page at addr, page 1's for anything
+// that is not the start of pages 1 to 9.
+static tftSave_t *screenPageSave(uint32_t addr) {
+	static tftSave_t * const saves[] = {screenPage1, screenPage2, screenPage3, screenPage4, screenPage5,
+										screenPage6, screenPage7, screenPage8, screenPage9};
+	uint32_t index = addr / (PAGE2_START_ADDR);
+	if ((addr % (PAGE2_START_ADDR)) || (index >= (sizeof(saves) / sizeof(saves[0])))) return screenPage1;
+	return saves[index];
+}
+
 /********************************************************/
 // Select a screen page (Buffer) 1 to 9.
 // ALT + (F1 to F9) using USBHost_t36 Keyboard Driver
@@ -3848,79 +4519,19 @@ PIP 2 Window Color Depth Setting
 // Also, STBASIC Commands: screen 0 to screen 8
 void RA8876_t3::selectScreen(uint32_t screenPage) {
 	check2dBusy();
+	// Back on the page first, or the surface would be saved as page 1
+	surfaceDeselect();
+	// Don't Select the current screen page (the ring while hardware scroll is on)
+	if(screenPage == currentPage)
+		return;
+	useHardwareScroll(false);
+	if(screenPage % (PAGE2_START_ADDR) == 0) _pageClear(screenPage / (PAGE2_START_ADDR));
 	tftSave_t *tempSave, *tempRestore;
-	// Don't Select the current screen page
 	if(screenPage == currentPage)
 		return;
-	switch(currentPage) {
-		case PAGE1_START_ADDR:
-			tempSave = screenPage1; 
-			break;
-		case PAGE2_START_ADDR:
-			tempSave = screenPage2; 
-			break;
-		case PAGE3_START_ADDR:
-			tempSave = screenPage3; 
-			break;
-		case PAGE4_START_ADDR:
-			tempSave = screenPage4; 
-			break;
-		case PAGE5_START_ADDR:
-			tempSave = screenPage5; 
-			break;
-		case PAGE6_START_ADDR:
-			tempSave = screenPage6; 
-			break;
-		case PAGE7_START_ADDR:
-			tempSave = screenPage7; 
-			break;
-		case PAGE8_START_ADDR:
-			tempSave = screenPage8; 
-			break;
-		case PAGE9_START_ADDR:
-			tempSave = screenPage9; 
-			break;
-//		case PAGE10_START_ADDR:
-//			tempSave = screenPage10; 
-//			break;
-		default:
-			tempSave = screenPage1; 
-	}
+	tempSave = screenPageSave(currentPage);
 	// Copy back selected screen page parameters
-	switch(screenPage) {
-		case PAGE1_START_ADDR:
-			tempRestore = screenPage1; 
-			break;
-		case PAGE2_START_ADDR:
-			tempRestore = screenPage2; 
-			break;
-		case PAGE3_START_ADDR:
-			tempRestore = screenPage3; 
-			break;
-		case PAGE4_START_ADDR:
-			tempRestore = screenPage4; 
-			break;
-		case PAGE5_START_ADDR:
-			tempRestore = screenPage5; 
-			break;
-		case PAGE6_START_ADDR:
-			tempRestore = screenPage6; 
-			break;
-		case PAGE7_START_ADDR:
-			tempRestore = screenPage7; 
-			break;
-		case PAGE8_START_ADDR:
-			tempRestore = screenPage8; 
-			break;
-		case PAGE9_START_ADDR:
-			tempRestore = screenPage9; 
-			break;
-//		case PAGE10_START_ADDR:
-//			tempRestore = screenPage10; 
-//			break;
-		default:
-			tempRestore = screenPage1; 
-	}
+	tempRestore = screenPageSave(screenPage);
 	// Save current screen page parameters 
 	saveTFTParams(tempSave);
 	// Restore selected screen page parameters
@@ -4015,6 +4626,9 @@ void RA8876_t3::restoreTFTParams(tftSave_t *screenSave) {
 }
 
 void RA8876_t3::useCanvas(boolean on) {
+  useHardwareScroll(false);
+  _pageClear(1);
+  _swapBuffers = 0;
   if(on) {
     displayImageStartAddress(PAGE1_START_ADDR);
     displayImageWidth(_width);
@@ -4027,6 +4641,9 @@ void RA8876_t3::useCanvas(boolean on) {
     currentPage = PAGE2_START_ADDR;
     pageOffset = PAGE2_START_ADDR;
     check2dBusy();
+    // Don't know what is on the canvas vs the screen, so first update copies it all
+    _damageTracking = _damageEnabled;
+    damageAll();
     ramAccessPrepare();
     
   } else {
@@ -4041,15 +4658,605 @@ void RA8876_t3::useCanvas(boolean on) {
     currentPage = PAGE1_START_ADDR;
     pageOffset = PAGE1_START_ADDR;
     check2dBusy();
+    _damageTracking = false;
+    _damageCount = 0;
     ramAccessPrepare();
     
   }
 }
 
+//**************************************************************//
+// Copy the canvas (PAGE2) to the screen (PAGE1). With damage
+// tracking only the areas drawn on since the last update are copied.
+//**************************************************************//
 void RA8876_t3::updateScreen() {
-	bteMemoryCopy(PAGE2_START_ADDR,_width,0,0,
-				  PAGE1_START_ADDR,_width, 0,0,
-				 _width,_height);
+	if(_swapBuffers) {
+		present(true);
+		return;
+	}
+	if(!_damageTracking) {
+		bteMemoryCopy(PAGE2_START_ADDR,_width,0,0,
+					  PAGE1_START_ADDR,_width, 0,0,
+					 _width,_height);
+		return;
+	}
+	for(uint8_t i = 0; i < _damageCount; i++) {
+		damageRect_t *r = &_damage[i];
+		bteMemoryCopy(PAGE2_START_ADDR,_width,r->x1,r->y1,
+					  PAGE1_START_ADDR,_width,r->x1,r->y1,
+					  r->x2 - r->x1 + 1, r->y2 - r->y1 + 1);
+	}
+	_damageCount = 0;
+}
+
+//**************************************************************//
+// Set up page flipping with 2 or 3 buffers starting at PAGE1.
+// The display shows PAGE1 and drawing goes to PAGE2.
+// 0 (or 1) goes back to drawing directly on PAGE1.
+//**************************************************************//
+void RA8876_t3::useSwapChain(uint8_t buffers) {
+	useHardwareScroll(false);
+	_pageClear(1);
+	_pageClear(2);
+	if(buffers > 3) buffers = 3;
+	if(buffers < 2) {
+		useCanvas(false);
+		return;
+	}
+	if(buffers == 3) _pageClear(3);
+	_damageTracking = false;	// present() never copies
+	_damageCount = 0;
+	_swapBuffers = buffers;
+	_swapFront = 0;
+	displayImageStartAddress(PAGE1_START_ADDR);
+	displayImageWidth(_width);
+	displayWindowStartXY(0,0);
+	_swapSetBack(1);
+}
+
+//**************************************************************//
+// Show the back buffer and move drawing on to the next one.
+// With only 2 buffers the old front buffer becomes the back
+// buffer, so it may still be scanned out for the rest of this
+// frame unless vsync was used.
+//**************************************************************//
+void RA8876_t3::present(bool vsync) {
+	if(!_swapBuffers) {
+		updateScreen();
+		return;
+	}
+	check2dBusy();	// everything drawn so far has to be in the back buffer
+	if(vsync) waitVSync();
+	displayImageStartAddress(_swapPageAddr(_swapBack));
+	_swapFront = _swapBack;
+	_swapSetBack((_swapBack + 1) % _swapBuffers);
+}
+
+//**************************************************************//
+// Wait for the start of the next vertical sync. Returns false if
+// it did not show up within timeout_ms.
+//**************************************************************//
+bool RA8876_t3::waitVSync(uint32_t timeout_ms) {
+	lcdRegDataWrite(RA8876_INTF, 1<<RA8876_INT_VSYNC);	// write 1 to clear the old one
+	uint32_t start = millis();
+	while(!(lcdRegDataRead(RA8876_INTF) & (1<<RA8876_INT_VSYNC))) {
+		_statusPollCount++;
+		if((millis() - start) > timeout_ms) return false;
+	}
+	return true;
+}
+
+void RA8876_t3::_swapSetBack(uint8_t index) {
+	uint32_t addr = _swapPageAddr(index);
+	_swapBack = index;
+	canvasImageStartAddress(addr);
+	canvasImageWidth(_width);
+	activeWindowXY(0, 0);
+	activeWindowWH(_width, _height);
+	currentPage = addr;
+	pageOffset = addr;
+	check2dBusy();
+	ramAccessPrepare();
+}
+
+//**************************************************************//
+// SDRAM surfaces: first fit allocation of off-screen images in
+// the surface heap. Rows are padded out to a multiple of 4 bytes
+// (and of whole pixels) so every surface can be a BTE source or
+// destination, and so surfaceCompact() can move it with a 16bpp
+// BTE memory copy whatever its depth.
+//**************************************************************//
+static uint32_t surfaceAlignUp(uint32_t addr, uint16_t align)
+{
+	return (addr + align - 1) & ~((uint32_t)align - 1);
+}
+
+// Lowest address in the heap where size bytes fit, or 0xffffffff
+uint32_t RA8876_t3::_surfaceFindGap(uint32_t size, uint16_t align)
+{
+	uint32_t addr = surfaceAlignUp(_surfaceHeapStart, align);
+	for (;;) {
+		if ((addr + size) > _surfaceHeapEnd) return 0xffffffff;
+		// The lowest surface in the way, if any, and try again past it
+		int16_t hit = -1;
+		for (int16_t i = 0; i < RA8876_SURFACE_MAX; i++) {
+			if (!_surfaces[i].size) continue;
+			if ((_surfaces[i].addr < (addr + size)) && ((_surfaces[i].addr + _surfaces[i].size) > addr)) {
+				if ((hit < 0) || (_surfaces[i].addr < _surfaces[hit].addr)) hit = i;
+			}
+		}
+		if (hit < 0) return addr;
+		addr = surfaceAlignUp(_surfaces[hit].addr + _surfaces[hit].size, align);
+	}
+}
+
+int16_t RA8876_t3::surfaceAlloc(uint16_t width, uint16_t height, uint8_t bpp, uint16_t align)
+{
+	if (!width || !height || ((bpp != 8) && (bpp != 16) && (bpp != 24))) return -1;
+	if ((align < 4) || (align & (align - 1))) align = 4;
+	uint16_t unit = (bpp == 24) ? 12 : 4;
+	uint32_t stride = (((uint32_t)width * (bpp / 8) + unit - 1) / unit) * unit;
+	// Has to fit in the BTE window registers for surfaceCompact()
+	if (((stride / 2) > 8191) || (height > 8191)) {
+		Serial.println("surfaceAlloc: too big");
+		return -1;
+	}
+	int16_t surface;
+	for (surface = 0; surface < RA8876_SURFACE_MAX; surface++)
+		if (!_surfaces[surface].size) break;
+	if (surface == RA8876_SURFACE_MAX) return -1;
+	uint32_t size = stride * height;
+	uint32_t addr = _surfaceFindGap(size, align);
+	if (addr == 0xffffffff) return -1;
+	surface_t *ps = &_surfaces[surface];
+	ps->addr = addr;
+	ps->size = size;
+	ps->width = width;
+	ps->height = height;
+	ps->stride = stride;
+	ps->align = align;
+	ps->bpp = bpp;
+	return surface;
+}
+
+void RA8876_t3::surfaceFree(int16_t surface)
+{
+	if (!_surfaceValid(surface)) return;
+	if (surface == _surfaceSelected) surfaceDeselect();
+	_surfaces[surface].size = 0;
+}
+
+// Move every surface as far down as it can go, lowest first, so the
+// free space ends up in one piece at the top of the heap.
+void RA8876_t3::surfaceCompact(void)
+{
+	uint32_t next = _surfaceHeapStart;	// end of the last surface moved
+	for (;;) {
+		int16_t lowest = -1;
+		for (int16_t i = 0; i < RA8876_SURFACE_MAX; i++) {
+			if (!_surfaces[i].size || (_surfaces[i].addr < next)) continue;
+			if ((lowest < 0) || (_surfaces[i].addr < _surfaces[lowest].addr)) lowest = i;
+		}
+		if (lowest < 0) break;
+		surface_t *ps = &_surfaces[lowest];
+		uint32_t addr = surfaceAlignUp(next, ps->align);
+		if (addr < ps->addr) {
+			// Destination is below the source, so even when they overlap
+			// the BTE has read each pixel before it is written over.
+			bteMemoryCopy(ps->addr, ps->stride / 2, 0, 0, addr, ps->stride / 2, 0, 0, ps->stride / 2, ps->height);
+			ps->addr = addr;
+			if (lowest == _surfaceSelected) {
+				currentPage = addr;
+				pageOffset = addr;
+				check2dBusy();
+				canvasImageStartAddress(addr);
+			} else if (lowest == _hwScrollSurface) {
+				_hwScrollApply();
+			}
+		}
+		next = ps->addr + ps->size;
+	}
+	check2dBusy();
+}
+
+// The heap can only be moved while it is empty
+bool RA8876_t3::setSurfaceHeap(uint32_t start, uint32_t end)
+{
+	if (surfaceCount() || (start >= end) || (end > MEM_SIZE_MAX)) return false;
+	_surfaceHeapStart = start;
+	_surfaceHeapEnd = end;
+	_pageClearPending &= ~_pageClearMask(start, end);	// surfaces, don't clear under them
+	return true;
+}
+
+uint8_t RA8876_t3::surfaceCount(void)
+{
+	uint8_t count = 0;
+	for (int16_t i = 0; i < RA8876_SURFACE_MAX; i++)
+		if (_surfaces[i].size) count++;
+	return count;
+}
+
+uint32_t RA8876_t3::surfaceBytesUsed(void)
+{
+	uint32_t used = 0;
+	for (int16_t i = 0; i < RA8876_SURFACE_MAX; i++) used += _surfaces[i].size;
+	return used;
+}
+
+uint32_t RA8876_t3::surfaceLargestFree(void)
+{
+	uint32_t largest = 0;
+	uint32_t addr = _surfaceHeapStart;
+	for (;;) {
+		// Next surface at or above addr, the gap below it is free
+		int16_t next = -1;
+		for (int16_t i = 0; i < RA8876_SURFACE_MAX; i++) {
+			if (!_surfaces[i].size || ((_surfaces[i].addr + _surfaces[i].size) <= addr)) continue;
+			if ((next < 0) || (_surfaces[i].addr < _surfaces[next].addr)) next = i;
+		}
+		uint32_t gap_end = (next < 0) ? _surfaceHeapEnd : _surfaces[next].addr;
+		if ((gap_end > addr) && ((gap_end - addr) > largest)) largest = gap_end - addr;
+		if (next < 0) break;
+		addr = _surfaces[next].addr + _surfaces[next].size;
+	}
+	return largest;
+}
+
+bool RA8876_t3::surfaceSelect(int16_t surface)
+{
+	if (!_surfaceValid(surface) || (_surfaces[surface].bpp != 16) || (_rotation != 0)) {
+		Serial.println("surfaceSelect: needs a 16bpp surface and rotation 0");
+		return false;
+	}
+	if (_surfaceSelected < 0) {
+		_surfaceSavedPage = currentPage;
+		_surfaceSavedWidth = _width;
+		_surfaceSavedHeight = _height;
+		_surfaceSavedDamage = _damageEnabled;
+	}
+	// Drawing here is not damage to the page updateScreen() copies
+	_damageEnabled = false;
+	_damageTracking = false;
+	_surfaceSelected = surface;
+	surface_t *ps = &_surfaces[surface];
+	_width = ps->stride / 2;
+	_height = ps->height;
+	currentPage = ps->addr;
+	pageOffset = ps->addr;
+	check2dBusy();
+	canvasImageStartAddress(ps->addr);
+	canvasImageWidth(_width);
+	activeWindowXY(0, 0);
+	activeWindowWH(_width, _height);
+	// _width is the image width the BTE functions use, the padding is clipped off
+	setClipRect(0, 0, ps->width, ps->height);
+	ramAccessPrepare();
+	return true;
+}
+
+void RA8876_t3::surfaceDeselect(void)
+{
+	if (_surfaceSelected < 0) return;
+	_surfaceSelected = -1;
+	_width = _surfaceSavedWidth;
+	_height = _surfaceSavedHeight;
+	currentPage = _surfaceSavedPage;
+	pageOffset = _surfaceSavedPage;
+	_damageEnabled = _surfaceSavedDamage;
+	_damageTracking = _damageEnabled && !_swapBuffers && (currentPage == PAGE2_START_ADDR);
+	check2dBusy();
+	canvasImageStartAddress(currentPage);
+	canvasImageWidth(_width);
+	activeWindowXY(0, 0);
+	activeWindowWH(_width, _height);
+	setClipRect();
+	ramAccessPrepare();
+}
+
+//**************************************************************//
+// Sprites: each one has its image and the background it covers
+// in SDRAM surfaces. spritesUpdate() only queues BTE memory
+// copies, the pixels never go over SPI again after spriteCreate().
+//**************************************************************//
+int8_t RA8876_t3::spriteCreate(uint16_t w, uint16_t h, const uint16_t *pixels, uint16_t chroma_key)
+{
+	if (!_spritesInit) {
+		for (int8_t i = 0; i < RA8876_SPRITE_MAX; i++) _sprites[i].image = -1;
+		_spritesInit = true;
+	}
+	int8_t sprite;
+	for (sprite = 0; sprite < RA8876_SPRITE_MAX; sprite++)
+		if (_sprites[sprite].image < 0) break;
+	if (sprite == RA8876_SPRITE_MAX) return -1;
+	int16_t image = surfaceAlloc(w, h);
+	if (image < 0) return -1;
+	int16_t save_under = surfaceAlloc(w, h);
+	if (save_under < 0) {
+		surfaceFree(image);
+		return -1;
+	}
+	sprite_t *ps = &_sprites[sprite];
+	memset(ps, 0, sizeof(sprite_t));
+	ps->image = image;
+	ps->saveUnder = save_under;
+	ps->chromaKey = chroma_key;
+	ps->alpha = RA8876_SPRITE_OPAQUE;
+	if (pixels) {
+		bteMpuWriteWithROPData8(surfaceAddress(image), surfaceImageWidth(image), 0, 0,
+								surfaceAddress(image), surfaceImageWidth(image), 0, 0, w, h,
+								RA8876_BTE_ROP_CODE_12, (const unsigned char *)pixels);
+		#ifdef SPI_HAS_TRANSFER_ASYNC
+		while(activeDMA) {}; //wait forever while DMA is finishing- the caller may reuse pixels
+		#endif
+	}
+	return sprite;
+}
+
+void RA8876_t3::spriteDestroy(int8_t sprite)
+{
+	if (!_spriteValid(sprite)) return;
+	spriteShow(sprite, false);
+	spritesUpdate();
+	bteQueueFlush();
+	check2dBusy();
+	surfaceFree(_sprites[sprite].image);
+	surfaceFree(_sprites[sprite].saveUnder);
+	_sprites[sprite].image = -1;
+}
+
+void RA8876_t3::spriteMove(int8_t sprite, int16_t x, int16_t y)
+{
+	if (!_spriteValid(sprite)) return;
+	if ((_sprites[sprite].x == x) && (_sprites[sprite].y == y)) return;
+	_sprites[sprite].x = x;
+	_sprites[sprite].y = y;
+	if (_sprites[sprite].visible) _spritesDirty = true;
+}
+
+void RA8876_t3::spriteShow(int8_t sprite, bool visible)
+{
+	if (!_spriteValid(sprite) || (_sprites[sprite].visible == visible)) return;
+	_sprites[sprite].visible = visible;
+	_spritesDirty = true;
+}
+
+void RA8876_t3::spriteSetAlpha(int8_t sprite, uint8_t alpha)
+{
+	if (!_spriteValid(sprite)) return;
+	if (alpha > RA8876_SPRITE_OPAQUE) alpha = RA8876_SPRITE_OPAQUE;
+	_sprites[sprite].alpha = alpha;
+	if (_sprites[sprite].visible) _spritesDirty = true;
+}
+
+// Put back what was under the sprites, the last one drawn first so
+// overlapping sprites unwind properly.
+void RA8876_t3::spritesRestore(void)
+{
+	if (!_spritesInit) return;
+	for (int8_t i = RA8876_SPRITE_MAX - 1; i >= 0; i--) {
+		sprite_t *ps = &_sprites[i];
+		if ((ps->image < 0) || !ps->drawn) continue;
+		bteQueueMemoryCopy(surfaceAddress(ps->saveUnder), surfaceImageWidth(ps->saveUnder), ps->srcX, ps->srcY,
+						   ps->drawnPage, _width, ps->drawnX, ps->drawnY, ps->drawnW, ps->drawnH);
+		ps->drawn = false;
+		if (ps->visible) _spritesDirty = true;
+	}
+}
+
+void RA8876_t3::spritesUpdate(void)
+{
+	if (!_spritesDirty) return;
+	_spritesDirty = false;
+	spritesRestore();
+	_spritesDirty = false;
+	for (int8_t i = 0; i < RA8876_SPRITE_MAX; i++) {
+		sprite_t *ps = &_sprites[i];
+		if ((ps->image < 0) || !ps->visible) continue;
+		// Clip to the page
+		int16_t x = ps->x, y = ps->y;
+		int16_t x_end = x + surfaceWidth(ps->image);
+		int16_t y_end = y + surfaceHeight(ps->image);
+		if (x < 0) x = 0;
+		if (y < 0) y = 0;
+		if (x_end > _width) x_end = _width;
+		if (y_end > _height) y_end = _height;
+		if ((x >= x_end) || (y >= y_end)) continue;
+		ps->drawnPage = currentPage;
+		ps->drawnX = x;
+		ps->drawnY = y;
+		ps->drawnW = x_end - x;
+		ps->drawnH = y_end - y;
+		ps->srcX = x - ps->x;
+		ps->srcY = y - ps->y;
+		ps->drawn = true;
+
+		uint32_t image_addr = surfaceAddress(ps->image);
+		uint16_t image_width = surfaceImageWidth(ps->image);
+		// Save what it will cover at the same spot in saveUnder as the part of the image drawn
+		bteQueueMemoryCopy(currentPage, _width, x, y,
+						   surfaceAddress(ps->saveUnder), surfaceImageWidth(ps->saveUnder), ps->srcX, ps->srcY,
+						   ps->drawnW, ps->drawnH);
+		if (ps->alpha >= RA8876_SPRITE_OPAQUE) {
+			bteQueueMemoryCopyWithChromaKey(image_addr, image_width, ps->srcX, ps->srcY,
+											currentPage, _width, x, y, ps->drawnW, ps->drawnH, ps->chromaKey);
+		} else {
+			bteQueueMemoryCopyWindowAlpha(image_addr, image_width, ps->srcX, ps->srcY,
+										  currentPage, _width, x, y,
+										  currentPage, _width, x, y, ps->drawnW, ps->drawnH, ps->alpha);
+		}
+	}
+}
+
+//**************************************************************//
+// Turn damage tracking on/off. When off updateScreen() always
+// copies the whole canvas.
+//**************************************************************//
+void RA8876_t3::setDamageTracking(bool on) {
+	_damageEnabled = on;
+	_damageTracking = on && !_swapBuffers && (currentPage == PAGE2_START_ADDR);
+	_damageCount = 0;
+	if(_damageTracking) damageAll();
+}
+
+//**************************************************************//
+// Mark an area of the canvas as changed, for things drawn some way
+// the tracking does not see.
+//**************************************************************//
+void RA8876_t3::addDamage(int16_t x, int16_t y, int16_t w, int16_t h) {
+	if(!_damageTracking || (w <= 0) || (h <= 0)) return;
+	_damageAdd(x, y, x + w - 1, y + h - 1);
+}
+
+void RA8876_t3::damageAll(void) {
+	_damageCount = 0;
+	_damageAdd(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1);
+}
+
+//**************************************************************//
+// Add an area to the damage list. Anything touching an existing
+// area is merged with it, and when the list is full the new area
+// is merged with whichever one grows the least.
+//**************************************************************//
+void RA8876_t3::_damageAdd(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+	if(x1 > x2) swapvals(x1, x2);
+	if(y1 > y2) swapvals(y1, y2);
+	if(x1 < 0) x1 = 0;
+	if(y1 < 0) y1 = 0;
+	if(x2 >= SCREEN_WIDTH) x2 = SCREEN_WIDTH - 1;
+	if(y2 >= SCREEN_HEIGHT) y2 = SCREEN_HEIGHT - 1;
+	if((x1 > x2) || (y1 > y2)) return;
+
+	uint8_t i = 0;
+	while(i < _damageCount) {
+		damageRect_t *r = &_damage[i];
+		if((x1 <= r->x2 + 1) && (x2 + 1 >= r->x1) && (y1 <= r->y2 + 1) && (y2 + 1 >= r->y1)) {
+			// Touches, so take it over and start again since the bigger area may touch others
+			if(r->x1 < x1) x1 = r->x1;
+			if(r->y1 < y1) y1 = r->y1;
+			if(r->x2 > x2) x2 = r->x2;
+			if(r->y2 > y2) y2 = r->y2;
+			_damage[i] = _damage[--_damageCount];
+			i = 0;
+			continue;
+		}
+		i++;
+	}
+	if(_damageCount == RA8876_DAMAGE_RECTS) {
+		uint8_t best = 0;
+		uint32_t best_growth = 0xffffffff;
+		for(i = 0; i < _damageCount; i++) {
+			damageRect_t *r = &_damage[i];
+			int32_t ux1 = min(x1, r->x1), uy1 = min(y1, r->y1);
+			int32_t ux2 = max(x2, r->x2), uy2 = max(y2, r->y2);
+			uint32_t growth = (ux2 - ux1 + 1) * (uy2 - uy1 + 1)
+				- (uint32_t)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+			if(growth < best_growth) {
+				best_growth = growth;
+				best = i;
+			}
+		}
+		damageRect_t *r = &_damage[best];
+		int16_t nx1 = min(x1, r->x1), ny1 = min(y1, r->y1);
+		int16_t nx2 = max(x2, r->x2), ny2 = max(y2, r->y2);
+		_damage[best] = _damage[--_damageCount];
+		_damageAdd(nx1, ny1, nx2, ny2);	// may now touch others
+		return;
+	}
+	_damage[_damageCount++] = {x1, y1, x2, y2};
+}
+
+//**************************************************************//
+// Get a multi byte value out of the register shadow, false if we
+// don't know all of it.
+//**************************************************************//
+bool RA8876_t3::_regShadowValue(ru8 reg, uint8_t count, uint32_t &value) {
+	value = 0;
+	for(uint8_t i = 0; i < count; i++) {
+		ru8 r = reg + i;
+		if(!(_regShadowValid[r >> 5] & (1ul << (r & 0x1f)))) return false;
+		value |= (uint32_t)_regShadow[r] << (8 * i);
+	}
+	return true;
+}
+
+//**************************************************************//
+// The engine was just started (DCR0/DCR1/BTE/DMA), work out what
+// part of the canvas it will change from the registers it uses.
+// If we don't know a register, assume the whole page.
+//**************************************************************//
+void RA8876_t3::_damageFromEngine(ru8 reg, ru8 data) {
+	uint32_t addr, v0, v1, v2, v3;
+	if(reg == RA8876_BTE_CTRL0) {
+		if(_regShadowValue(RA8876_DT_STR0, 4, addr) && (addr != PAGE2_START_ADDR)) return;
+		if(_regShadowValue(RA8876_BTE_CTRL1, 1, v0)) {
+			switch(v0 & 0x0f) {
+				case RA8876_BTE_MPU_WRITE_WITH_ROP:
+				case RA8876_BTE_MPU_WRITE_WITH_CHROMA:
+				case RA8876_BTE_MPU_WRITE_COLOR_EXPANSION:
+				case RA8876_BTE_MPU_WRITE_COLOR_EXPANSION_WITH_CHROMA:
+				case RA8876_BTE_MPU_WRITE_WITH_OPACITY:
+					_damageMemWriteCovered = true;	// the data goes in the BTE window
+					break;
+			}
+		}
+		if(_regShadowValue(RA8876_DT_X0, 2, v0) && _regShadowValue(RA8876_DT_Y0, 2, v1) &&
+		   _regShadowValue(RA8876_BTE_WTH0, 2, v2) && _regShadowValue(RA8876_BTE_HIG0, 2, v3)) {
+			_damageAdd(v0, v1, v0 + v2 - 1, v1 + v3 - 1);
+			return;
+		}
+		damageAll();
+		return;
+	}
+
+	// Everything else draws on the canvas
+	if(_regShadowValue(RA8876_CVSSA0, 4, addr) && (addr != PAGE2_START_ADDR)) return;
+	if(reg == RA8876_DMA_CTRL) {
+		damageAll();
+		return;
+	}
+	bool known;
+	if((reg == RA8876_DCR1) && !(data & 0x20)) {
+		// Circle, ellipse and curves: center +/- radius
+		known = _regShadowValue(RA8876_DEHR0, 2, v0) && _regShadowValue(RA8876_DEVR0, 2, v1) &&
+				_regShadowValue(RA8876_ELL_A0, 2, v2) && _regShadowValue(RA8876_ELL_B0, 2, v3);
+		if(known) _damageAdd(v0 - v2, v1 - v3, v0 + v2, v1 + v3);
+	} else {
+		// Lines, triangles, rectangles: bounding box of the points
+		known = _regShadowValue(RA8876_DLHSR0, 2, v0) && _regShadowValue(RA8876_DLVSR0, 2, v1) &&
+				_regShadowValue(RA8876_DLHER0, 2, v2) && _regShadowValue(RA8876_DLVER0, 2, v3);
+		if(known && (reg == RA8876_DCR0) && (data & 0x02)) {
+			uint32_t tx, ty;
+			known = _regShadowValue(RA8876_DTPH0, 2, tx) && _regShadowValue(RA8876_DTPV0, 2, ty);
+			if(known) _damageAdd(min(min(v0, v2), tx), min(min(v1, v3), ty),
+								 max(max(v0, v2), tx), max(max(v1, v3), ty));
+		} else if(known) {
+			_damageAdd(v0, v1, v2, v3);
+		}
+	}
+	if(!known) damageAll();
+}
+
+//**************************************************************//
+// Memory write port selected: the data lands somewhere in the
+// active window. drawPixel() and the BTE MPU writes already
+// handled their area, so they set _damageMemWriteCovered.
+//**************************************************************//
+void RA8876_t3::_damageFromMemWrite(void) {
+	if(_damageMemWriteCovered) {
+		_damageMemWriteCovered = false;
+		return;
+	}
+	uint32_t addr, mode, x, y, w, h;
+	if(_regShadowValue(RA8876_CVSSA0, 4, addr) && (addr != PAGE2_START_ADDR)) return;
+	// Linear addressing mode (AW_COLOR bit 2) could be anywhere
+	if(_regShadowValue(RA8876_AW_COLOR, 1, mode) && !(mode & 0x04) &&
+	   _regShadowValue(RA8876_AWUL_X0, 2, x) && _regShadowValue(RA8876_AWUL_Y0, 2, y) &&
+	   _regShadowValue(RA8876_AW_WTH0, 2, w) && _regShadowValue(RA8876_AW_HT0, 2, h)) {
+		_damageAdd(x, y, x + w - 1, y + h - 1);
+		return;
+	}
+	damageAll();
 }
 
 // Setup text cursor
@@ -4501,8 +5708,9 @@ void RA8876_t3::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,uint16_t col
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_SQUARE, true);//76h,0xa0
 }
 
-// Draw a filled rectangle. Note: damages text color register
-void RA8876_t3::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,uint16_t color) {
+// Origin, clip and rotate a filled rectangle into the corners the
+// geometry engine takes. Returns false if it is all clipped off.
+bool RA8876_t3::_fillRectCorners(int16_t x, int16_t y, int16_t w, int16_t h, int16_t corners[4]) {
 	x += _originx;
 	y += _originy;
 	int16_t x_end = x+w-1;
@@ -4513,204 +5721,811 @@ void RA8876_t3::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,uint16_t col
 		 (y_end < _displayclipy1))  	// Clip top 
 	{
 		// outside the clip rectangle
-		return;
+		return false;
 	}
 	if (x < _displayclipx1) x = _displayclipx1;
 	if (y < _displayclipy1) y = _displayclipy1;
 	if (x_end > _displayclipx2) x_end = _displayclipx2;
 	if (y_end > _displayclipy2) y_end = _displayclipy2;
 	
-  check2dBusy();
-  graphicMode(true);
-  foreGroundColor16bpp(color);
   switch (_rotation) {
   	case 1: swapvals(x,y); swapvals(x_end, y_end); break;
   	case 2: x = _width-x; x_end = _width - x_end;; break;
   	case 3: rotateCCXY(x,y); rotateCCXY(x_end, y_end); break;
   }
+  corners[0] = x;
+  corners[1] = y;
+  corners[2] = x_end;
+  corners[3] = y_end;
+  return true;
+}
 
-  lcdRegDataWrite(RA8876_DLHSR0,x, false);//68h
-  lcdRegDataWrite(RA8876_DLHSR1,x>>8, false);//69h
-  lcdRegDataWrite(RA8876_DLVSR0,y, false);//6ah
-  lcdRegDataWrite(RA8876_DLVSR1,y>>8, false);//6bh
-  lcdRegDataWrite(RA8876_DLHER0,x_end, false);//6ch
-  lcdRegDataWrite(RA8876_DLHER1,x_end>>8, false);//6dh
-  lcdRegDataWrite(RA8876_DLVER0,y_end, false);//6eh
-  lcdRegDataWrite(RA8876_DLVER1,y_end>>8, false);//6fh   
+// Start and end point for the line, triangle and rectangle drawing
+void RA8876_t3::_geometryCorners(const int16_t corners[4]) {
+  lcdRegDataWrite(RA8876_DLHSR0,corners[0], false);//68h
+  lcdRegDataWrite(RA8876_DLHSR1,corners[0]>>8, false);//69h
+  lcdRegDataWrite(RA8876_DLVSR0,corners[1], false);//6ah
+  lcdRegDataWrite(RA8876_DLVSR1,corners[1]>>8, false);//6bh
+  lcdRegDataWrite(RA8876_DLHER0,corners[2], false);//6ch
+  lcdRegDataWrite(RA8876_DLHER1,corners[2]>>8, false);//6dh
+  lcdRegDataWrite(RA8876_DLVER0,corners[3], false);//6eh
+  lcdRegDataWrite(RA8876_DLVER1,corners[3]>>8, false);//6fh   
+}
+
+// Draw a filled rectangle. Note: damages text color register
+void RA8876_t3::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,uint16_t color) {
+  int16_t corners[4];
+  if (!_fillRectCorners(x, y, w, h, corners)) return;
+  check2dBusy();
+  graphicMode(true);
+  foreGroundColor16bpp(color);
+  _geometryCorners(corners);
   lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_SQUARE_FILL, true);//76h,0xE0  
+}
 
+//**************************************************************//
+// Order to draw a batch in so the colors come together: a stable
+// radix sort on the color, low byte then high byte. The color has
+// to be the last member of the item. Returns the order in scratch
+// memory (free it with _scratchFree), or nullptr to go in order.
+//**************************************************************//
+uint16_t *RA8876_t3::_sortByColor(const void *items, uint32_t item_size, uint16_t count) {
+	uint16_t *order = (uint16_t *)_scratchAlloc(count * 2 * 2 + 256 * 2);
+	if (!order) return nullptr;
+	uint16_t *other = order + count;
+	uint16_t *buckets = other + count;
+	const uint8_t *colors = (const uint8_t *)items + item_size - sizeof(uint16_t);
+	for (uint16_t i = 0; i < count; i++) other[i] = i;
+	for (uint8_t shift = 0; shift < 16; shift += 8) {
+		uint16_t *src = (shift == 0) ? other : order;
+		uint16_t *dst = (shift == 0) ? order : other;
+		memset(buckets, 0, 256 * 2);
+		for (uint16_t i = 0; i < count; i++)
+			buckets[(*(const uint16_t *)(colors + i * item_size) >> shift) & 0xff]++;
+		uint16_t start = 0;
+		for (uint16_t b = 0; b < 256; b++) {
+			uint16_t n = buckets[b];
+			buckets[b] = start;
+			start += n;
+		}
+		for (uint16_t i = 0; i < count; i++)
+			dst[buckets[(*(const uint16_t *)(colors + src[i] * item_size) >> shift) & 0xff]++] = src[i];
+	}
+	// Second pass went back into other
+	memcpy(order, other, count * 2);
+	return order;
+}
+
+//**************************************************************//
+// Batched fillRect. Each rectangle's registers go out as one
+// batch, and while the engine fills it the next one is clipped and
+// rotated. Corners or colors shared with the last one are skipped
+// by the register shadow, so a row of bars on one baseline costs
+// little more than the coordinates that change.
+//**************************************************************//
+void RA8876_t3::fillRects(const primRect_t *rects, uint16_t count, bool sort_by_color) {
+  uint16_t *order = sort_by_color ? _sortByColor(rects, sizeof(primRect_t), count) : nullptr;
+  int16_t corners[4];
+  uint16_t i = 0;
+  const primRect_t *pr = nullptr;
+  // Find the first one that is not clipped off
+  for (; i < count; i++) {
+    pr = &rects[order ? order[i] : i];
+    if (_fillRectCorners(pr->x, pr->y, pr->w, pr->h, corners)) break;
+  }
+  while (i < count) {
+    check2dBusy();
+    beginRegBatch();
+    graphicMode(true);
+    foreGroundColor16bpp(pr->color);
+    _geometryCorners(corners);
+    lcdRegDataWrite(RA8876_DCR1,RA8876_DRAW_SQUARE_FILL, true);//76h,0xE0
+    endRegBatch();
+    // The engine is busy with that one, get the next ready
+    for (i++; i < count; i++) {
+      pr = &rects[order ? order[i] : i];
+      if (_fillRectCorners(pr->x, pr->y, pr->w, pr->h, corners)) break;
+    }
+  }
+  _scratchFree(order);
+}
+
+//**************************************************************//
+// Batched drawLine, the same way as fillRects()
+//**************************************************************//
+void RA8876_t3::drawLines(const primLine_t *lines, uint16_t count, bool sort_by_color) {
+  uint16_t *order = sort_by_color ? _sortByColor(lines, sizeof(primLine_t), count) : nullptr;
+  int16_t corners[4];
+  for (uint16_t i = 0; i < count; i++) {
+    const primLine_t *pl = &lines[order ? order[i] : i];
+    corners[0] = pl->x0 + _originx; corners[2] = pl->x1 + _originx;
+    corners[1] = pl->y0 + _originy; corners[3] = pl->y1 + _originy;
+    if ((corners[0] == corners[2]) && (corners[1] == corners[3])) {
+      drawPixel(corners[0], corners[1], pl->color);
+      continue;
+    }
+    switch (_rotation) {
+      case 1: swapvals(corners[0],corners[1]); swapvals(corners[2],corners[3]); break;
+      case 2: corners[0] = _width-corners[0]; corners[2] = _width-corners[2];break;
+      case 3: rotateCCXY(corners[0],corners[1]); rotateCCXY(corners[2],corners[3]); break;
+    }
+    check2dBusy();
+    beginRegBatch();
+    graphicMode(true);
+    foreGroundColor16bpp(pl->color);
+    _geometryCorners(corners);
+    lcdRegDataWrite(RA8876_DCR0,RA8876_DRAW_LINE, true);//67h,0x80
+    endRegBatch();
+  }
+  _scratchFree(order);
+}
+
+//**************************************************************//
+// Batched drawPixel, with origin, clipping and rotation. Pixels
+// that follow on along a row (at rotation 0) go out as one memory
+// write after a single cursor move.
+//**************************************************************//
+void RA8876_t3::drawPixels(const primPixel_t *pixels, uint16_t count) {
+  uint16_t run[32] __attribute__((aligned(32)));
+  graphicMode(true);
+  uint16_t i = 0;
+  while (i < count) {
+    int16_t x = pixels[i].x + _originx;
+    int16_t y = pixels[i].y + _originy;
+    if ((x < _displayclipx1) || (x >= _displayclipx2) || (y < _displayclipy1) || (y >= _displayclipy2)) {
+      i++;
+      continue;
+    }
+    uint16_t n = 1;
+    run[0] = pixels[i].color;
+    if (_rotation == 0) {
+      while (((i + n) < count) && (n < (sizeof(run) / sizeof(run[0]))) &&
+             ((pixels[i + n].x + _originx) == (x + n)) && ((pixels[i + n].y + _originy) == y) &&
+             ((x + n) < _displayclipx2)) {
+        run[n] = pixels[i + n].color;
+        n++;
+      }
+    }
+    setPixelCursor(x, y);	// rotates it
+    if (_damageTracking) {
+      _damageAdd(x, y, x + n - 1, y);
+      _damageMemWriteCovered = true;	// only these pixels, not the whole active window
+    }
+    ramAccessPrepare();
+    startSend();
+    _bus->writeDataBuffer(run, n * 2);
+    endSend(true);
+    _coreTaskPending |= CORE_TASK_MEMWRITE;
+    i += n;
+  }
 }
 
 // fillRectHGradient	- fills area with horizontal gradient
 void RA8876_t3::fillRectHGradient(int16_t x, int16_t y, int16_t w, int16_t h,
                                             uint16_t color1, uint16_t color2) {
+  // color1 is at the right, the way these have always drawn
+  _fillRectGradient(x, y, w, h, color2, color1, GRADIENT_HORIZONTAL, 0);
+}
+
+// fillRectVGradient	- fills area with vertical gradient
+void RA8876_t3::fillRectVGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+                                            uint16_t color1, uint16_t color2) {
+  // color1 is at the bottom, the way these have always drawn
+  _fillRectGradient(x, y, w, h, color2, color1, GRADIENT_VERTICAL, 0);
+}
+
+// fillRectLinearGradient	- fills area with a gradient at any angle
+void RA8876_t3::fillRectLinearGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+                                            uint16_t color1, uint16_t color2, int16_t angle) {
+  _fillRectGradient(x, y, w, h, color1, color2, GRADIENT_LINEAR, angle);
+}
+
+// fillRectRadialGradient	- fills area with a gradient out from the center
+void RA8876_t3::fillRectRadialGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+                                            uint16_t color1, uint16_t color2) {
+  _fillRectGradient(x, y, w, h, color1, color2, GRADIENT_RADIAL, 0);
+}
+
+// Color at t (0-4096) along the gradient. Channels are 8 bits scaled by 256.
+static inline uint16_t gradientColor(const int32_t *c1, const int32_t *dc, int32_t t,
+                                     bool dither, int16_t px, int16_t py) {
+  int32_t r = c1[0] + ((dc[0] * t) >> 12);
+  int32_t g = c1[1] + ((dc[1] * t) >> 12);
+  int32_t b = c1[2] + ((dc[2] * t) >> 12);
+  if (dither) {
+    // threshold is up to 15/16 of one RGB565 step
+    int32_t d = gradient_bayer4[py & 3][px & 3];
+    r += d << 7;
+    g += d << 6;
+    b += d << 7;
+  } else {
+    r += 1024;	// round to nearest
+    g += 512;
+    b += 1024;
+  }
+  if (r > 0xffff) r = 0xffff;
+  if (g > 0xffff) g = 0xffff;
+  if (b > 0xffff) b = 0xffff;
+  return ((r >> 11) << 11) | ((g >> 10) << 5) | (b >> 11);
+}
+
+//**************************************************************//
+// Gradient fill. Colors are worked out in RAM. Horizontal gradients
+// (and vertical ones when not rotated) only compute one strip (4
+// rows/columns if dithering) and the BTE copies it over the rest of
+// the rectangle. The others are computed a tile of rows at a time
+// into two buffers, so one is being filled while DMA sends the
+// other. Not rotated, they stream into one BTE window for the whole
+// rectangle, rotated each tile goes through writeRect.
+//**************************************************************//
+void RA8876_t3::_fillRectGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+                                  uint16_t color1, uint16_t color2, uint8_t type, int16_t angle) {
   x += _originx;
   y += _originy;
+  // The gradient covers the whole rectangle, even the part clipped off
+  int16_t gx = x, gy = y, gw = w, gh = h;
+
+  // Rectangular clipping
+  if ((x >= _displayclipx2) || (y >= _displayclipy2))
+      return;
+  if (x < _displayclipx1) {
+      w -= (_displayclipx1 - x);
+      x = _displayclipx1;
+  }
+  if (y < _displayclipy1) {
+      h -= (_displayclipy1 - y);
+      y = _displayclipy1;
+  }
+  if ((x + w - 1) >= _displayclipx2)
+      w = _displayclipx2 - x;
+  if ((y + h - 1) >= _displayclipy2)
+      h = _displayclipy2 - y;
+  if ((w <= 0) || (h <= 0)) return;
+
+  int32_t c1[3], dc[3];
+  uint8_t r8, g8, b8;
+  color565toRGB(color1, r8, g8, b8);
+  c1[0] = r8 << 8; c1[1] = g8 << 8; c1[2] = b8 << 8;
+  color565toRGB(color2, r8, g8, b8);
+  dc[0] = (r8 << 8) - c1[0]; dc[1] = (g8 << 8) - c1[1]; dc[2] = (b8 << 8) - c1[2];
+
+  bool dither = _gradientDither;
+  int16_t i, j;
+
+  if ((type == GRADIENT_HORIZONTAL) || ((type == GRADIENT_VERTICAL) && (_rotation == 0))) {
+    bool horizontal = (type == GRADIENT_HORIZONTAL);
+    // Strip of rows (horizontal) or columns (vertical) that repeats
+    int16_t sw = horizontal ? w : (dither ? min(w, (int16_t)4) : 1);
+    int16_t sh = horizontal ? (dither ? min(h, (int16_t)4) : 1) : h;
+    int32_t span = horizontal ? gw - 1 : gh - 1;
+    if (span < 1) span = 1;
+    uint16_t *strip = (uint16_t *)_scratchAlloc(sw * sh * 2);
+    if (!strip) return; // failed to allocate.
+    for (j = 0; j < sh; j++) {
+      for (i = 0; i < sw; i++) {
+        int32_t t = ((horizontal ? (x + i - gx) : (y + j - gy)) * 4096) / span;
+        strip[j * sw + i] = gradientColor(c1, dc, t, dither, x + i, y + j);
+      }
+    }
+    if (_rotation == 0) {
+      // Send it once then keep doubling it with BTE copies
+      writeRect(x, y, sw, sh, strip);
+      int16_t done = horizontal ? sh : sw;
+      int16_t size = horizontal ? h : w;
+      while (done < size) {
+        int16_t n = min(done, (int16_t)(size - done));
+        if (horizontal)
+          bteMemoryCopy(currentPage, _width, x, y, currentPage, _width, x, y + done, w, n);
+        else
+          bteMemoryCopy(currentPage, _width, x, y, currentPage, _width, x + done, y, n, h);
+        done += n;
+      }
+    } else {
+      // writeRect does the rotating, the strip never changes so it can be sent over and over
+      for (j = 0; j < h; j += sh) writeRect(x, y + j, w, min(sh, (int16_t)(h - j)), strip);
+    }
+    #ifdef SPI_HAS_TRANSFER_ASYNC
+    while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+    #endif
+    _scratchFree(strip);
+    return;
+  }
+
+  // Everything else: t changes by dt_dx across a row, dt_dy down a column
+  float dt_dx = 0, dt_dy = 0, t0 = 0;
+  float cx = 0, cy = 0, radius_scale = 0;
+  if (type == GRADIENT_RADIAL) {
+    cx = gx + (gw - 1) / 2.0f;
+    cy = gy + (gh - 1) / 2.0f;
+    float radius = sqrtf(((gw - 1) / 2.0f) * ((gw - 1) / 2.0f) + ((gh - 1) / 2.0f) * ((gh - 1) / 2.0f));
+    radius_scale = (radius > 0) ? 4096.0f / radius : 0;
+  } else {
+    float ca, sa;
+    if (type == GRADIENT_VERTICAL) {
+      ca = 0; sa = 1;
+    } else {
+      ca = cosf(angle * PI / 180.0f);
+      sa = sinf(angle * PI / 180.0f);
+    }
+    // Project the corners onto the gradient direction to find its ends
+    float p[4] = {0, (gw - 1) * ca, (gh - 1) * sa, (gw - 1) * ca + (gh - 1) * sa};
+    float pmin = p[0], pmax = p[0];
+    for (i = 1; i < 4; i++) {
+      if (p[i] < pmin) pmin = p[i];
+      if (p[i] > pmax) pmax = p[i];
+    }
+    float scale = (pmax > pmin) ? 4096.0f / (pmax - pmin) : 0;
+    dt_dx = ca * scale;
+    dt_dy = sa * scale;
+    t0 = -pmin * scale;
+  }
+
+  int16_t rows_per_tile = RA8876_GRADIENT_TILE_PIXELS / w;
+  if (rows_per_tile > h) rows_per_tile = h;
+  // Rotated, leave half the scratch buffer for writeRect to reorder the tiles in
+  if ((_rotation != 0) && (rows_per_tile > (int16_t)(_scratchAvailable() / (w * 8))))
+    rows_per_tile = _scratchAvailable() / (w * 8);
+  // Rotation 3 writeRect mirrors an image of several rows top to bottom
+  // compared with sending it a row at a time, stay with single rows there
+  if (_rotation == 3) rows_per_tile = 1;
+  uint16_t *buffers[2];
+  void *buffer_alloc = _scratchTiles(w, rows_per_tile, buffers);
+  if (!buffer_alloc) return; // failed to allocate.
+  uint8_t buffer_index = 0;
+
+  if (_rotation == 0) {
+    bteMpuWriteWithROP(currentPage, _width, x, y, currentPage, _width, x, y, w, h, RA8876_BTE_ROP_CODE_12);
+  }
+  for (int16_t tile_y = y; tile_y < (y + h); ) {
+    int16_t rows = min(rows_per_tile, (int16_t)(y + h - tile_y));
+    uint16_t *buffer = buffers[buffer_index];
+    buffer_index ^= 1;
+    // This buffer's last DMA finished before the other one was started
+    uint16_t *row = buffer;
+    for (int16_t py = tile_y; py < (tile_y + rows); py++, row += w) {
+      if (type == GRADIENT_RADIAL) {
+        float dy = py - cy;
+        for (i = 0; i < w; i++) {
+          float dx = x + i - cx;
+          int32_t t = sqrtf(dx * dx + dy * dy) * radius_scale;
+          if (t > 4096) t = 4096;
+          row[i] = gradientColor(c1, dc, t, dither, x + i, py);
+        }
+      } else {
+        float t = t0 + (py - gy) * dt_dy + (x - gx) * dt_dx;
+        for (i = 0; i < w; i++, t += dt_dx) {
+          int32_t ti = (int32_t)t;
+          if (ti < 0) ti = 0;
+          if (ti > 4096) ti = 4096;
+          row[i] = gradientColor(c1, dc, ti, dither, x + i, py);
+        }
+      }
+    }
+    if (_rotation == 0) {
+      lcdDataWriteBurst(buffer, rows * w * 2);
+    } else {
+      writeRect(x, tile_y, w, rows, buffer);
+    }
+    tile_y += rows;
+  }
+  #ifdef SPI_HAS_TRANSFER_ASYNC
+  while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+  #endif
+  _scratchFree(buffer_alloc);
+}
+
+
+void RA8876_t3::writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors) {
+	uint16_t start_x = (x != CENTER) ? x : (_width - w) / 2;
+	uint16_t start_y = (y != CENTER) ? y : (_height - h) / 2;
+
+	switch (_rotation) {
+		case 0: // we will just hand off for now to 
+				// unrolled to bte call
+				//Using the BTE function is faster and will use DMA if available
+			    bteMpuWriteWithROPData8(currentPage, width(), start_x, start_y,  //Source 1 is ignored for ROP 12
+                              currentPage, width(), start_x, start_y, w, h,     //destination address, pagewidth, x/y, width/height
+                              RA8876_BTE_ROP_CODE_12,
+                              ( const unsigned char *)pcolors);
+			break;
+		case 1:
+		case 2:
+		case 3:
+			_writeRectRotated(start_x, start_y, w, h, pcolors);
+			break;
+	}
+}
+
+//**************************************************************//
+// writeRectStream: writeRect with the pixels coming from a producer
+// callback. Not rotated, one BTE window is set up for the visible
+// part and the producer fills one buffer while DMA sends the other,
+// so it runs at bus speed with a few KB of RAM. Rotated, each chunk
+// goes through writeRect like _writeRectPalette() does.
+//**************************************************************//
+bool RA8876_t3::writeRectStream(int16_t x, int16_t y, int16_t w, int16_t h, RA8876PixelProducer producer, void *context) {
+	if ((w <= 0) || (h <= 0) || !producer) return false;
+	if (x == CENTER) x = (_width - w) / 2;
+	if (y == CENTER) y = (_height - h) / 2;
+	x += _originx;
+	y += _originy;
+
+	// The producer makes whole rows in order, work out which part shows
+	int16_t skip_rows = (y < _displayclipy1) ? (_displayclipy1 - y) : 0;
+	int16_t end_row = ((y + h) > _displayclipy2) ? (_displayclipy2 - y) : h;
+	int16_t skip_left = (x < _displayclipx1) ? (_displayclipx1 - x) : 0;
+	int16_t vis_w = (((x + w) > _displayclipx2) ? (_displayclipx2 - x) : w) - skip_left;
+	if ((vis_w <= 0) || (end_row <= skip_rows)) return true;
+	int16_t vis_x = x + skip_left;
+
+	int16_t rows_per_tile = RA8876_STREAM_TILE_PIXELS / w;
+	if (rows_per_tile > end_row) rows_per_tile = end_row;
+	// Rotated, leave half the scratch buffer for writeRect to reorder the chunks in
+	if ((_rotation != 0) && (rows_per_tile > (int16_t)(_scratchAvailable() / (w * 8))))
+		rows_per_tile = _scratchAvailable() / (w * 8);
+	uint16_t *buffers[2];
+	void *buffer_alloc = _scratchTiles(w, rows_per_tile, buffers);
+	if (!buffer_alloc) return false; // failed to allocate.
+	uint8_t buffer_index = 0;
+
+	if (_rotation == 0) {
+		bteMpuWriteWithROP(currentPage, _width, vis_x, y + skip_rows, currentPage, _width, vis_x, y + skip_rows,
+		                   vis_w, end_row - skip_rows, RA8876_BTE_ROP_CODE_12);
+	}
+	bool ok = true;
+	for (int16_t row = 0; row < end_row; row += rows_per_tile) {
+		int16_t rows = min(rows_per_tile, (int16_t)(end_row - row));
+		uint16_t *buffer = buffers[buffer_index];
+		buffer_index ^= 1;
+		// This buffer's last DMA finished before the other one was started
+		if (ok) ok = (*producer)(context, buffer, row, rows, w);
+		if (!ok) {
+			if (_rotation != 0) break;
+			// The BTE is still waiting for the rest of the window
+			memset(buffer, 0, rows * w * 2);
+		}
+		int16_t first = (row < skip_rows) ? min((int16_t)(skip_rows - row), rows) : 0;
+		if (first == rows) continue;	// all above the clip rectangle
+		uint16_t *pcolors = buffer + first * w;
+		if (vis_w != w) {
+			// Squeeze the visible part of each row together
+			for (int16_t i = 0; i < rows - first; i++)
+				memmove(buffer + i * vis_w, pcolors + i * w + skip_left, vis_w * 2);
+			pcolors = buffer;
+		}
+		if (_rotation == 0) {
+			lcdDataWriteBurst(pcolors, (rows - first) * vis_w * 2);
+		} else {
+			writeRect(vis_x, y + row + first, vis_w, rows - first, pcolors);
+		}
+	}
+	#ifdef SPI_HAS_TRANSFER_ASYNC
+	while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+	#endif
+	_scratchFree(buffer_alloc);
+	return ok;
+}
+
+//**************************************************************//
+// drawPackedImage: draw an image packed by extras/packimage. At the
+// start of each row the pending run is checked, rows that are all
+// one color are drawn with a solid fill and the rest are decoded
+// into ping-pong buffers and sent with writeRect, so decoding one
+// buffer overlaps the DMA of the other.
+//**************************************************************//
+bool RA8876_t3::drawPackedImage(int16_t x, int16_t y, const uint8_t *image, uint32_t size) {
+	int16_t w, h;
+	packedDecoder_t d;
+	if (!packedImageSize(image, size, w, h) || !_packedBegin(&d, image, size)) {
+		Serial.println("drawPackedImage: not a packed image");
+		return false;
+	}
+	if (x == CENTER) x = (_width - w) / 2;
+	if (y == CENTER) y = (_height - h) / 2;
+	int16_t px = x + _originx;
+	int16_t py = y + _originy;
+	// writeRect does not clip, leave a partly visible image to writeRectStream
+	if ((px < _displayclipx1) || (py < _displayclipy1) || ((px + w) > _displayclipx2) || ((py + h) > _displayclipy2)) {
+		if (writeRectStream(x, y, w, h, _packedProducer, &d)) return true;
+		Serial.println("drawPackedImage: corrupt image");
+		return false;
+	}
+
+	int16_t rows_per_tile = RA8876_STREAM_TILE_PIXELS / w;
+	if (rows_per_tile > h) rows_per_tile = h;
+	// Rotated, leave half the scratch buffer for writeRect to reorder the chunks in
+	if ((_rotation != 0) && (rows_per_tile > (int16_t)(_scratchAvailable() / (w * 8))))
+		rows_per_tile = _scratchAvailable() / (w * 8);
+	uint16_t *buffers[2];
+	void *buffer_alloc = _scratchTiles(w, rows_per_tile, buffers);
+	if (!buffer_alloc) return false; // failed to allocate.
+	uint8_t buffer_index = 0;
+	uint16_t *buffer = buffers[0];
+
+	bool ok = true;
+	int16_t row = 0;
+	int16_t tile_rows = 0;	// rows decoded into buffer so far
+	while (row < h) {
+		uint32_t run_rows = _packedRun(&d) / w;
+		int16_t solid = (run_rows < (uint32_t)(h - row)) ? run_rows : (h - row);
+		if (!solid) {
+			if (!_packedDecode(&d, buffer + tile_rows * w, w)) {
+				ok = false;
+				break;
+			}
+			tile_rows++;
+			row++;
+		}
+		// Send what is decoded before a fill, when the buffer is full and at the end
+		if (tile_rows && (solid || (tile_rows == rows_per_tile) || (row == h))) {
+			writeRect(px, py + row - tile_rows, w, tile_rows, buffer);
+			// This buffer's last DMA finished before the other one was started
+			buffer_index ^= 1;
+			buffer = buffers[buffer_index];
+			tile_rows = 0;
+		}
+		if (solid) {
+			fillRect(x, y + row, w, solid, d.color);
+			d.run -= (uint32_t)solid * w;
+			row += solid;
+		}
+	}
+	#ifdef SPI_HAS_TRANSFER_ASYNC
+	while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+	#endif
+	_scratchFree(buffer_alloc);
+	if (!ok) Serial.println("drawPackedImage: corrupt image");
+	return ok;
+}
+
+//**************************************************************//
+// Width and height from a packed image's header
+//**************************************************************//
+bool RA8876_t3::packedImageSize(const uint8_t *image, uint32_t size, int16_t &w, int16_t &h) {
+	if (!image || (size < RA8876_PACKED_HEADER) || (image[0] != 'R') || (image[1] != 'P')) return false;
+	w = image[4] | (image[5] << 8);
+	h = image[6] | (image[7] << 8);
+	return (w > 0) && (h > 0);
+}
+
+//**************************************************************//
+// Set the decoder up at the first op of a packed image
+//**************************************************************//
+bool RA8876_t3::_packedBegin(packedDecoder_t *d, const uint8_t *image, uint32_t size) {
+	uint32_t header = RA8876_PACKED_HEADER;
+	d->palette = nullptr;
+	d->paletteSize = 0;
+	if (image[2] == RA8876_PACKED_PALETTE) {
+		d->palette = image + header;
+		d->paletteSize = image[3] + 1;
+		header += d->paletteSize * 2;
+	} else if (image[2] != RA8876_PACKED_RGB565) {
+		return false;
+	}
+	if (size < header) return false;
+	d->data = image + header;
+	d->end = image + size;
+	d->run = 0;
+	d->color = 0;
+	d->literals = 0;
+	memset(d->index, 0, sizeof(d->index));
+	return true;
+}
+
+//**************************************************************//
+// Decode the next count pixels, false if the data is bad or ends
+//**************************************************************//
+bool RA8876_t3::_packedDecode(packedDecoder_t *d, uint16_t *pcolors, uint32_t count) {
+	const uint8_t *p = d->data;
+	uint16_t color = d->color;
+	while (count) {
+		if (d->run) {
+			uint32_t n = (d->run < count) ? d->run : count;
+			d->run -= n;
+			count -= n;
+			while (n--) *pcolors++ = color;
+			continue;
+		}
+		if (d->literals) {
+			if (d->palette) {
+				if ((p >= d->end) || (*p >= d->paletteSize)) break;
+				color = d->palette[*p * 2] | (d->palette[*p * 2 + 1] << 8);
+				p++;
+			} else {
+				if ((p + 2) > d->end) break;
+				color = p[0] | (p[1] << 8);
+				p += 2;
+				d->index[RA8876_PACKED_HASH(color)] = color;
+			}
+			d->literals--;
+			*pcolors++ = color;
+			count--;
+			continue;
+		}
+		if (p >= d->end) break;
+		uint8_t op = *p++;
+		if (op < RA8876_PACKED_OP_INDEX) {
+			d->run = (op & 0x3f) + 1;
+		} else if (op < RA8876_PACKED_OP_DIFF) {
+			uint8_t i = op & 0x3f;
+			if (d->palette) {
+				if (i >= d->paletteSize) break;
+				color = d->palette[i * 2] | (d->palette[i * 2 + 1] << 8);
+			} else {
+				color = d->index[i];
+			}
+			*pcolors++ = color;
+			count--;
+		} else if (op < RA8876_PACKED_OP_LITERAL) {
+			if (d->palette) break;
+			// The packer only uses this when no channel wraps
+			color += (((op >> 4) & 3) - 2) * 2048 + (((op >> 2) & 3) - 2) * 32 + ((op & 3) - 2);
+			d->index[RA8876_PACKED_HASH(color)] = color;
+			*pcolors++ = color;
+			count--;
+		} else if (op < RA8876_PACKED_OP_LONGRUN) {
+			d->literals = (op & 0x1f) + 1;
+		} else {
+			if (p >= d->end) break;
+			d->run = (((op & 0x1f) << 8) | *p++) + 65;
+		}
+	}
+	d->data = p;
+	d->color = color;
+	return count == 0;
+}
+
+//**************************************************************//
+// How many more pixels are the last color, taking in the run ops
+// that come next (runs longer than one op are split up)
+//**************************************************************//
+uint32_t RA8876_t3::_packedRun(packedDecoder_t *d) {
+	while (!d->literals && (d->data < d->end)) {
+		uint8_t op = d->data[0];
+		if (op < RA8876_PACKED_OP_INDEX) {
+			d->run += (op & 0x3f) + 1;
+			d->data++;
+		} else if ((op >= RA8876_PACKED_OP_LONGRUN) && ((d->data + 1) < d->end)) {
+			d->run += (((op & 0x1f) << 8) | d->data[1]) + 65;
+			d->data += 2;
+		} else {
+			break;
+		}
+	}
+	return d->run;
+}
 
-  // Rectangular clipping
-  if ((x >= _displayclipx2) || (y >= _displayclipy2))
-      return;
-  if (x < _displayclipx1) {
-      w -= (_displayclipx1 - x);
-      x = _displayclipx1;
-  }
-  if (y < _displayclipy1) {
-      h -= (_displayclipy1 - y);
-      y = _displayclipy1;
-  }
-  if ((x + w - 1) >= _displayclipx2)
-      w = _displayclipx2 - x;
-  if ((y + h - 1) >= _displayclipy2)
-      h = _displayclipy2 - y;
+// writeRectStream producer for a partly visible drawPackedImage()
+bool RA8876_t3::_packedProducer(void *context, uint16_t *pcolors, int16_t first_row, int16_t rows, int16_t w) {
+	return _packedDecode((packedDecoder_t *)context, pcolors, (uint32_t)rows * w);
+}
 
-  int16_t r1, g1, b1, r2, g2, b2, dr, dg, db, r, g, b;
-  uint16_t color;
-  color565toRGB14(color1, r1, g1, b1);
-  color565toRGB14(color2, r2, g2, b2);
-  dr = (r2 - r1) / w;
-  dg = (g2 - g1) / w;
-  db = (b2 - b1) / w;
-  r = r1;
-  g = g1;
-  b = b1;
-  
-  check2dBusy();
-  graphicMode(true);
-  for (uint16_t j = h; j > 0; j--) { //y
-      for (uint16_t i = w; i > 0; i--) { //x
-          color = RGB14tocolor565(r, g, b);
-          drawPixel(x + i, y + j, color);
-          r += dr;
-          g += dg;
-          b += db;
-      }
-      //color = RGB14tocolor565(r, g, b);
-      //drawPixel(x, y, color);
-      r = r1;
-      g = g1;
-      b = b1;
-  }
+//**************************************************************//
+// writeRectAsync: queue up a writeRect that goes out using DMA
+// Returns a fence you can pass to dmaFenceDone()/dmaFenceWait().
+// The callback (if any) is called from the DMA completion interrupt.
+//**************************************************************//
+uint32_t RA8876_t3::writeRectAsync(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors,
+								   RA8876DMACallback callback, void *context) {
+	uint32_t fence = ++_dmaFenceNext;
+#ifdef SPI_HAS_TRANSFER_ASYNC
+	// Wait for a free slot, starting what we can while we wait
+	while (_dmaQueueCount >= RA8876_DMA_QUEUE_SIZE) _dmaKick();
+
+	RA8876DMASlot_t *slot = &_dmaQueue[(_dmaQueueHead + _dmaQueueCount) % RA8876_DMA_QUEUE_SIZE];
+	slot->x = x;
+	slot->y = y;
+	slot->w = w;
+	slot->h = h;
+	slot->pcolors = pcolors;
+	slot->callback = callback;
+	slot->context = context;
+	slot->fence = fence;
+	_dmaQueueCount++;
+
+	_dmaKick();
+#else
+	// No async transfers, so it is done by the time we return
+	writeRect(x, y, w, h, pcolors);
+	_dmaFenceCompleted = fence;
+	if (callback) (*callback)(context, fence);
+#endif
+	return fence;
 }
-    
 
-void RA8876_t3::fillRectVGradient(int16_t x, int16_t y, int16_t w, int16_t h,
-                                            uint16_t color1, uint16_t color2) {
-    x += _originx;
-    y += _originy;
+//**************************************************************//
+// Start the next queued writeRectAsync if the DMA is free
+//**************************************************************//
+void RA8876_t3::dmaService(void) {
+	if (_dmaInService || !_dmaQueueCount || activeDMA) return;
+	_dmaStartNext();
+}
 
-    // Rectangular clipping
-    if ((x >= _displayclipx2) || (y >= _displayclipy2))
-        return;
-    if (x < _displayclipx1) {
-        w -= (_displayclipx1 - x);
-        x = _displayclipx1;
-    }
-    if (y < _displayclipy1) {
-        h -= (_displayclipy1 - y);
-        y = _displayclipy1;
-    }
-    if ((x + w - 1) >= _displayclipx2)
-        w = _displayclipx2 - x;
-    if ((y + h - 1) >= _displayclipy2)
-        h = _displayclipy2 - y;
+//**************************************************************//
+// Wait until the transfer with this fence (and all before it) is done
+//**************************************************************//
+void RA8876_t3::dmaFenceWait(uint32_t fence) {
+	if ((int32_t)(fence - _dmaFenceNext) > 0) return;	// never handed out, don't hang
+	while (!dmaFenceDone(fence)) _dmaKick();
+}
 
-    int16_t r1, g1, b1, r2, g2, b2, dr, dg, db, r, g, b;
-    color565toRGB14(color1, r1, g1, b1);
-    color565toRGB14(color2, r2, g2, b2);
-    dr = (r2 - r1) / h;
-    dg = (g2 - g1) / h;
-    db = (b2 - b1) / h;
-    r = r1;
-    g = g1;
-    b = b1;
-    
-    check2dBusy();
-    graphicMode(true);
-    
-    for (uint16_t j = h; j > 0; j--) {
-        uint16_t color = RGB14tocolor565(r, g, b);
-        for (uint16_t i = w; i > 0; i--) {
-          drawPixel(x + i , y + j, color);
-        }
-        //drawPixel(x + i , y + j, color);
-        r += dr;
-        g += dg;
-        b += db;
-    }
+//**************************************************************//
+// Get everything in the writeRectAsync queue started. The last one
+// may still be in progress when this returns.
+//**************************************************************//
+void RA8876_t3::dmaQueueFlush(void) {
+	while (_dmaQueueCount && !_dmaInService) dmaService();
+}
+
+//**************************************************************//
+// Get the queue moving. On a shared bus this takes its turn with
+// the other arbiter clients instead of going straight ahead.
+//**************************************************************//
+void RA8876_t3::_dmaKick(void) {
+	if (!_arbiter) {
+		dmaService();
+		return;
+	}
+	if (_dmaQueueCount) _arbiter->request(_arbiterId);
+	_arbiter->service();
+}
 
+//**************************************************************//
+// setBusArbiter()
+//**************************************************************//
+bool RA8876_t3::setBusArbiter(RA8876BusArbiter &arbiter, const char *name) {
+	int8_t id = arbiter.attach(name, _arbiterService, _arbiterYield, this);
+	if (id < 0) return false;
+	_arbiter = &arbiter;
+	_arbiterId = id;
+	_bus->setArbiter(&arbiter, id);
+	return true;
 }
 
+// Our turn, start one queued transfer
+void RA8876_t3::_arbiterService(void *context) {
+	RA8876_t3 *tft = (RA8876_t3 *)context;
+	tft->dmaService();
+	if (tft->_dmaQueueCount) tft->_arbiter->request(tft->_arbiterId);
+}
 
-void RA8876_t3::writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors) {
-	uint16_t start_x = (x != CENTER) ? x : (_width - w) / 2;
-	uint16_t start_y = (y != CENTER) ? y : (_height - h) / 2;
+// Someone else wants the bus. If we are only holding the transaction
+// open between calls, close it. A DMA transfer closes it when done.
+void RA8876_t3::_arbiterYield(void *context) {
+	RA8876_t3 *tft = (RA8876_t3 *)context;
+	if (!tft->RA8876_BUSY || tft->activeDMA) return;
+	tft->RA8876_BUSY = false;
+	tft->_bus->endTransaction();
+}
 
-	switch (_rotation) {
-		case 0: // we will just hand off for now to 
-				// unrolled to bte call
-				//Using the BTE function is faster and will use DMA if available
-			    bteMpuWriteWithROPData8(currentPage, width(), start_x, start_y,  //Source 1 is ignored for ROP 12
-                              currentPage, width(), start_x, start_y, w, h,     //destination address, pagewidth, x/y, width/height
-                              RA8876_BTE_ROP_CODE_12,
-                              ( const unsigned char *)pcolors);
-			break;
-		case 1:
-			{
-				while (h) {
-					//Serial.printf("DP %x, %d, %d %d\n", rotated_row, h, start_x, y);
-				    bteMpuWriteWithROPData8(currentPage, height(), start_y, start_x,  //Source 1 is ignored for ROP 12
-	                              currentPage, height(),  start_y, start_x, 1, w,     //destination address, pagewidth, x/y, width/height
-	                              RA8876_BTE_ROP_CODE_12,
-	                              ( const unsigned char *)pcolors);
-				    start_y++;
-				    h--;
-				    pcolors += w;
+void RA8876_t3::_dmaStartNext(void) {
+	_dmaInService = true;
+	_dmaActiveSlot = _dmaQueue[_dmaQueueHead];
+	_dmaQueueHead = (_dmaQueueHead + 1) % RA8876_DMA_QUEUE_SIZE;
+	_dmaQueueCount--;
 
-				}
-			}
+	writeRect(_dmaActiveSlot.x, _dmaActiveSlot.y, _dmaActiveSlot.w, _dmaActiveSlot.h, _dmaActiveSlot.pcolors);
 
-			break;
-		case 2:
-			{
-				uint16_t *rotated_buffer_alloc = (uint16_t*)malloc(w * 2 + 32);
-				if (!rotated_buffer_alloc) return; // failed to allocate. 
-			    uint16_t *rotated_buffer = (uint16_t *)(((uintptr_t)rotated_buffer_alloc + 32) & ~((uintptr_t)(31)));
-				// unrolled to bte call
-				//Using the BTE function is faster and will use DMA if available
-				// We reverse the colors in the row...
-				// lets reverse data per row...
-				while (h) {
-					for (int i = 0; i < w; i++) rotated_buffer[w-i-1] = *pcolors++;
-				    bteMpuWriteWithROPData8(currentPage, width(), start_x, start_y,  //Source 1 is ignored for ROP 12
-                              currentPage, width(), (width()- w) - start_x , start_y, w, 1,     //destination address, pagewidth, x/y, width/height
-                              RA8876_BTE_ROP_CODE_12,
-                              ( const unsigned char *)rotated_buffer);
-				    start_y++;
-				    h--;
-				}
-				#ifdef SPI_HAS_TRANSFER_ASYNC
-				while(activeDMA) {}; //wait forever while DMA is finishing- can't start a new transfer
-				#endif
-				free((void*)rotated_buffer_alloc);
-				endSend(true);
-			}
-			break;
-		case 3:
-			{
-			    start_y += h;
-				while (h) {
-					//Serial.printf("DP %x, %d, %d %d\n", rotated_row, h, start_x, y);
-				    bteMpuWriteWithROPData8(currentPage, height(), start_y, start_x,  //Source 1 is ignored for ROP 12
-                           currentPage, height(), height() - start_y, start_x, 1, w,     //destination address, pagewidth, x/y, width/height
-	                              RA8876_BTE_ROP_CODE_12,
-	                              ( const unsigned char *)pcolors);
-				    start_y--;
-				    h--;
-				    pcolors += w;
-				}
-			}
-			break;
+	// Either the last piece is still going out, in which case the completion
+	// interrupt finishes it, or it is already done (or never used DMA).
+	noInterrupts();
+	if (activeDMA) {
+		_dmaActiveSlotValid = true;
+		interrupts();
+	} else {
+		interrupts();
+		_dmaActiveSlotValid = true;
+		_dmaSlotDone();
 	}
+	_dmaInService = false;
+}
+
+// Called when the transfer for _dmaActiveSlot has finished, may be called from the DMA interrupt
+void RA8876_t3::_dmaSlotDone(void) {
+	if (!_dmaActiveSlotValid) return;	// one of the earlier pieces of a multi piece writeRect
+	_dmaActiveSlotValid = false;
+	_dmaFenceCompleted = _dmaActiveSlot.fence;
+	if (_dmaActiveSlot.callback) (*_dmaActiveSlot.callback)(_dmaActiveSlot.context, _dmaActiveSlot.fence);
 }
 
 uint16_t *RA8876_t3::rotateImageRect(int16_t w, int16_t h, const uint16_t *pcolors, int16_t rotation) 
@@ -4838,19 +6653,7 @@ void RA8876_t3::writeRect8BPP(int16_t x, int16_t y, int16_t w, int16_t h,
         w = _displayclipx2 - x;
         x_clip_right -= w;
     }
-    const uint8_t *pixels_row_start = pixels; // remember our starting position offset into row
-
-    uint16_t buffer[w] __attribute__((aligned(32)));
-
-    for (; h > 0; h--) {
-        pixels = pixels_row_start;            // setup for this row
-        uint16_t *pb = buffer;
-        for (int i = 0; i < w; i++) {*pb++ = palette[*pixels++]; }
-
-        writeRect(x, y, w, 1, buffer);
-        y++;
-        pixels_row_start += w_pixels;
-    }
+    _writeRectPalette(x, y, w, h, 8, pixels, w_pixels, x_clip_left, palette);
 }
 
 
@@ -4907,9 +6710,6 @@ void RA8876_t3::writeRectNBPP(int16_t x, int16_t y, int16_t w, int16_t h,
     uint16_t count_of_bytes_per_row =
         (w + pixels_per_byte - 1) /
         pixels_per_byte; // Round up to handle non multiples
-    uint8_t row_shift_init =
-        8 - bits_per_pixel;                             // We shift down 6 bits by default
-    uint8_t pixel_bit_mask = (1 << bits_per_pixel) - 1; // get mask to use below
     // Rectangular clipping
 
     // See if the whole thing out of bounds...
@@ -4936,44 +6736,176 @@ void RA8876_t3::writeRectNBPP(int16_t x, int16_t y, int16_t w, int16_t h,
 
     // For X see how many items in color array to skip at start of row and
     // likewise end of row
+    uint16_t x_clip_left = 0;
     if (x < _displayclipx1) {
-        uint16_t x_clip_left = _displayclipx1 - x;
+        x_clip_left = _displayclipx1 - x;
         w -= x_clip_left;
         x = _displayclipx1;
-        // Now lets update pixels to the rigth offset and mask
-        uint8_t x_clip_left_bytes_incr = x_clip_left / pixels_per_byte;
-        pixels += x_clip_left_bytes_incr;
-        row_shift_init =
-            8 -
-            (x_clip_left - (x_clip_left_bytes_incr * pixels_per_byte) + 1) *
-                bits_per_pixel;
     }
 
     if ((x + w - 1) >= _displayclipx2) {
         w = _displayclipx2 - x;
     }
 
-    const uint8_t *pixels_row_start = pixels; // remember our starting position offset into row
-
-
-    uint16_t buffer[w] __attribute__((aligned(32)));
-    for (; h > 0; h--) {
-        pixels = pixels_row_start;            // setup for this row
-        uint8_t pixel_shift = row_shift_init; // Setup mask
-        uint16_t *pb = buffer;
-        for (int i = 0; i < w; i++) {
-            *pb++ = palette[((*pixels) >> pixel_shift) & pixel_bit_mask];
-            if (!pixel_shift) {
-                pixel_shift = 8 - bits_per_pixel; // setup next mask
-                pixels++;
-            } else {
-                pixel_shift -= bits_per_pixel;
-            }
+    _writeRectPalette(x, y, w, h, bits_per_pixel, pixels, count_of_bytes_per_row, x_clip_left, palette);
+}
+
+// Look up one row of palette indexes, skip is how many pixels into the row to start
+void RA8876_t3::paletteExpandRow(uint16_t *dst, const uint8_t *src, uint16_t skip, uint16_t w,
+                                 uint8_t bits_per_pixel, const uint16_t *palette) {
+    if (bits_per_pixel == 8) {
+        src += skip;
+        for (; w >= 4; w -= 4) {
+            dst[0] = palette[src[0]];
+            dst[1] = palette[src[1]];
+            dst[2] = palette[src[2]];
+            dst[3] = palette[src[3]];
+            dst += 4;
+            src += 4;
+        }
+        while (w--) *dst++ = palette[*src++];
+        return;
+    }
+    uint8_t pixels_per_byte = 8 / bits_per_pixel;
+    uint8_t pixel_bit_mask = (1 << bits_per_pixel) - 1;
+    src += skip / pixels_per_byte;
+    uint8_t pixel_shift = 8 - ((skip % pixels_per_byte) + 1) * bits_per_pixel;
+    // partial first byte
+    while (w && (pixel_shift != (8 - bits_per_pixel))) {
+        *dst++ = palette[(*src >> pixel_shift) & pixel_bit_mask];
+        w--;
+        if (!pixel_shift) {
+            pixel_shift = 8 - bits_per_pixel;
+            src++;
+        } else {
+            pixel_shift -= bits_per_pixel;
+        }
+    }
+    // whole bytes
+    for (; w >= pixels_per_byte; w -= pixels_per_byte) {
+        uint8_t bits = *src++;
+        switch (bits_per_pixel) {
+            case 4:
+                dst[0] = palette[bits >> 4];
+                dst[1] = palette[bits & 0xf];
+                break;
+            case 2:
+                dst[0] = palette[bits >> 6];
+                dst[1] = palette[(bits >> 4) & 0x3];
+                dst[2] = palette[(bits >> 2) & 0x3];
+                dst[3] = palette[bits & 0x3];
+                break;
+            default:
+                for (uint8_t i = 0; i < pixels_per_byte; i++)
+                    dst[i] = palette[(bits >> (8 - (i + 1) * bits_per_pixel)) & pixel_bit_mask];
+                break;
+        }
+        dst += pixels_per_byte;
+    }
+    // partial last byte
+    for (pixel_shift = 8 - bits_per_pixel; w; w--, pixel_shift -= bits_per_pixel)
+        *dst++ = palette[(*src >> pixel_shift) & pixel_bit_mask];
+}
+
+//**************************************************************//
+// Rotated writeRect. The image is transposed (rotation 1 and 3) or
+// mirrored (rotation 2) in RAM into the order the memory window is
+// filled, so the BTE window is set up once for the whole rectangle.
+// Tiles alternate between two buffers, so one is being filled while
+// DMA sends the other. The BTE ignores the MACR write direction, so
+// the reordering can't be left to the controller.
+//**************************************************************//
+void RA8876_t3::_writeRectRotated(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors) {
+	if ((w <= 0) || (h <= 0)) return;
+	// Memory window and the width of the page in memory
+	int16_t mem_x, mem_y, mem_w, mem_h;
+	uint16_t page_width;
+	switch (_rotation) {
+		case 1:  mem_x = y; mem_y = x; mem_w = h; mem_h = w; page_width = height(); break;
+		case 2:  mem_x = (width() - w) - x; mem_y = y; mem_w = w; mem_h = h; page_width = width(); break;
+		default: mem_x = height() - y - h; mem_y = x; mem_w = h; mem_h = w; page_width = height(); break;
+	}
+	int16_t rows_per_tile = RA8876_ROTATE_TILE_PIXELS / mem_w;
+	if (rows_per_tile > mem_h) rows_per_tile = mem_h;
+	uint16_t *buffers[2];
+	void *buffer_alloc = _scratchTiles(mem_w, rows_per_tile, buffers);
+	if (!buffer_alloc) return; // failed to allocate.
+	uint8_t buffer_index = 0;
+
+	bteMpuWriteWithROP(currentPage, page_width, mem_x, mem_y, currentPage, page_width, mem_x, mem_y,
+	                   mem_w, mem_h, RA8876_BTE_ROP_CODE_12);
+	for (int16_t mem_row = 0; mem_row < mem_h; ) {
+		int16_t rows = min(rows_per_tile, (int16_t)(mem_h - mem_row));
+		uint16_t *buffer = buffers[buffer_index];
+		buffer_index ^= 1;
+		// This buffer's last DMA finished before the other one was started
+		uint16_t *dst = buffer;
+		if (_rotation == 2) {
+			// memory row is the image row, reversed
+			const uint16_t *src = pcolors + mem_row * w;
+			for (int16_t row = 0; row < rows; row++, src += w) {
+				for (int16_t i = w - 1; i >= 0; i--) *dst++ = src[i];
+			}
+		} else {
+			// memory row is an image column, top of the image on the left
+			for (int16_t row = 0; row < rows; row++) {
+				const uint16_t *src = pcolors + mem_row + row;
+				for (int16_t j = 0; j < h; j++, src += w) *dst++ = *src;
+			}
+		}
+		lcdDataWriteBurst(buffer, rows * mem_w * 2);
+		mem_row += rows;
+	}
+	#ifdef SPI_HAS_TRANSFER_ASYNC
+	while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+	#endif
+	_scratchFree(buffer_alloc);
+}
+
+//**************************************************************//
+// Palette image output for writeRect8BPP/writeRectNBPP, already
+// clipped. Not rotated, the BTE window is set up once for the whole
+// rectangle and the rows are expanded a tile at a time into two
+// buffers, so one is being filled while DMA sends the other.
+// Rotated, each tile goes through writeRect.
+//**************************************************************//
+void RA8876_t3::_writeRectPalette(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t bits_per_pixel,
+                                  const uint8_t *pixels, uint16_t row_bytes, uint16_t skip, const uint16_t *palette) {
+    if ((w <= 0) || (h <= 0)) return;
+    int16_t rows_per_tile = RA8876_PALETTE_TILE_PIXELS / w;
+    if (rows_per_tile > h) rows_per_tile = h;
+    // Rotated, leave half the scratch buffer for writeRect to reorder the tiles in
+    if ((_rotation != 0) && (rows_per_tile > (int16_t)(_scratchAvailable() / (w * 8))))
+        rows_per_tile = _scratchAvailable() / (w * 8);
+    uint16_t *buffers[2];
+    void *buffer_alloc = _scratchTiles(w, rows_per_tile, buffers);
+    if (!buffer_alloc) return; // failed to allocate.
+    uint8_t buffer_index = 0;
+
+    if (_rotation == 0) {
+        bteMpuWriteWithROP(currentPage, _width, x, y, currentPage, _width, x, y, w, h, RA8876_BTE_ROP_CODE_12);
+    }
+    while (h > 0) {
+        int16_t rows = min(rows_per_tile, h);
+        uint16_t *buffer = buffers[buffer_index];
+        buffer_index ^= 1;
+        // This buffer's last DMA finished before the other one was started
+        for (int16_t row = 0; row < rows; row++) {
+            paletteExpandRow(buffer + row * w, pixels, skip, w, bits_per_pixel, palette);
+            pixels += row_bytes;
+        }
+        if (_rotation == 0) {
+            lcdDataWriteBurst(buffer, rows * w * 2);
+        } else {
+            writeRect(x, y, w, rows, buffer);
         }
-        writeRect(x, y, w, 1, buffer);
-        y++;
-        pixels_row_start += count_of_bytes_per_row;
+        y += rows;
+        h -= rows;
     }
+    #ifdef SPI_HAS_TRANSFER_ASYNC
+    while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+    #endif
+    _scratchFree(buffer_alloc);
 }
 
 
@@ -5466,7 +7398,8 @@ void RA8876_t3::drawChar(int16_t x, int16_t y, unsigned char c,
     int16_t w =  6 * size_x;
     int16_t h = 8 * size_y;
     int16_t y_char_top = y; // remember the y
-      uint16_t char_buffer[w * h];
+      uint16_t *char_buffer = (uint16_t *)_scratchAlloc(w * h * 2);
+      if (!char_buffer) return;
       uint16_t color;
       uint16_t *pfbPixel_row = char_buffer;
       for (yc = 0; (yc < 8) && (y < _displayclipy2); yc++) {
@@ -5502,6 +7435,10 @@ void RA8876_t3::drawChar(int16_t x, int16_t y, unsigned char c,
         mask = mask << 1;
       }
       writeRect(x_char_start,y_char_top, w, h, char_buffer);
+      #ifdef SPI_HAS_TRANSFER_ASYNC
+      while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+      #endif
+      _scratchFree(char_buffer);
     //writecommand_last(ILI9488_NOP);
 		//_endSend();
 	}
@@ -5612,12 +7549,16 @@ void RA8876_t3::setFont(const GFXfont *f) {
 }
 
 	
-void RA8876_t3::drawFontChar(unsigned int c)
+//**************************************************************//
+// Find a ILI9341_t3 font character and decode its header. Returns
+// the glyph data with bitoffset set to the start of the bits, or
+// nullptr if it is not an encoding we know.
+//**************************************************************//
+const uint8_t *RA8876_t3::_fontGlyphInfo(unsigned int c, uint32_t &bitoffset, uint32_t &width, uint32_t &height,
+										 int32_t &xoffset, int32_t &yoffset, uint32_t &delta)
 {
-	uint32_t bitoffset = 0;
 	const uint8_t *data;
-
-	//Serial.printf("drawFontChar(%c) %d (%d, %d) %x %x %x\n", c, c, _cursorX, _cursorY, _TXTBackColor, _TXTForeColor, _backTransparent);
+	bitoffset = 0;
 
 	if (c >= font->index1_first && c <= font->index1_last) {
 		bitoffset = c - font->index1_first;
@@ -5633,24 +7574,36 @@ void RA8876_t3::drawFontChar(unsigned int c)
 	data = font->data + fetchbits_unsigned(font->index, bitoffset, font->bits_index);
 
 	uint32_t encoding = fetchbits_unsigned(data, 0, 3);
-	if (encoding != 0) return;
-	uint32_t width = fetchbits_unsigned(data, 3, font->bits_width);
+	if (encoding != 0) return nullptr;
+	width = fetchbits_unsigned(data, 3, font->bits_width);
 	bitoffset = font->bits_width + 3;
-	uint32_t height = fetchbits_unsigned(data, bitoffset, font->bits_height);
+	height = fetchbits_unsigned(data, bitoffset, font->bits_height);
 	bitoffset += font->bits_height;
 	//Serial.printf("  size =   %d,%d\n", width, height);
 	//Serial.printf("  line space = %d\n", font->line_space);
 	//Serial.printf("  cap height = %d\n", font->cap_height);
 
-	int32_t xoffset = fetchbits_signed(data, bitoffset, font->bits_xoffset);
+	xoffset = fetchbits_signed(data, bitoffset, font->bits_xoffset);
 	bitoffset += font->bits_xoffset;
-	int32_t yoffset = fetchbits_signed(data, bitoffset, font->bits_yoffset);
+	yoffset = fetchbits_signed(data, bitoffset, font->bits_yoffset);
 	bitoffset += font->bits_yoffset;
 	//Serial.printf("  offset = %d,%d\n", xoffset, yoffset);
 
-	uint32_t delta = fetchbits_unsigned(data, bitoffset, font->bits_delta);
+	delta = fetchbits_unsigned(data, bitoffset, font->bits_delta);
 	bitoffset += font->bits_delta;
 	//Serial.printf("  delta =  %d\n", delta);
+	return data;
+}
+
+void RA8876_t3::drawFontChar(unsigned int c)
+{
+	uint32_t bitoffset, width, height, delta;
+	int32_t xoffset, yoffset;
+
+	//Serial.printf("drawFontChar(%c) %d (%d, %d) %x %x %x\n", c, c, _cursorX, _cursorY, _TXTBackColor, _TXTForeColor, _backTransparent);
+
+	const uint8_t *data = _fontGlyphInfo(c, bitoffset, width, height, xoffset, yoffset, delta);
+	if (!data) return;
 	
 	//horizontally, we draw every pixel, or none at all
 	if (_cursorX < 0) _cursorX = 0;
@@ -5682,6 +7635,19 @@ void RA8876_t3::drawFontChar(unsigned int c)
 	
 	bool opaque = !_backTransparent; //(_TXTBackColor != _TXTForeColor);
 
+	// Normal case, let the BTE color expand the whole glyph in one go
+	if ((fontbpp == 1) && (_rotation == 0) && _fontColorExpansion &&
+		_drawFontGlyphBTE(c, data, bitoffset, width, height, origin_x, origin_y, delta, opaque)) {
+		_cursorX += delta;
+		return;
+	}
+	// Anti-aliased, blend it in RAM and send it in one go
+	if ((fontbpp > 1) && (_rotation == 0) &&
+		_drawFontGlyphAA(data, bitoffset, width, height, origin_x, origin_y, delta, opaque)) {
+		_cursorX += delta;
+		return;
+	}
+
 
 	// Going to try a fast Opaque method which works similar to drawChar, which is near the speed of writerect
 	if (!opaque) {
@@ -6124,6 +8090,356 @@ void RA8876_t3::getTextBounds(const String &str, int16_t x, int16_t y,
 }
 
 
+//**************************************************************//
+// Decode the bits of a 1bpp ILI9341_t3 glyph into buf, a cleared
+// bitmap stride bytes per row, with its top left at gx, gy.
+//**************************************************************//
+void RA8876_t3::_fontGlyphBitmap(const uint8_t *data, uint32_t bitoffset, uint32_t width, uint32_t height,
+								 uint32_t gx, uint32_t gy, uint32_t stride, uint8_t *buf)
+{
+	uint8_t *prow = &buf[gy * stride];
+	int32_t linecount = height;
+	while (linecount > 0) {
+		uint32_t n = 1;
+		if (fetchbit(data, bitoffset++) != 0) {
+			n = fetchbits_unsigned(data, bitoffset, 3) + 2;
+			bitoffset += 3;
+		}
+		uint32_t x = 0;
+		do {
+			uint32_t xsize = width - x;
+			if (xsize > 32) xsize = 32;
+			uint32_t bits = fetchbits_unsigned(data, bitoffset, xsize);
+			bitoffset += xsize;
+			while (bits) {
+				// highest set bit is the left most pixel
+				uint32_t bit = 31 - __builtin_clz(bits);
+				uint32_t px = gx + x + (xsize - 1 - bit);
+				prow[px >> 3] |= 0x80 >> (px & 7);
+				bits &= ~(1ul << bit);
+			}
+			x += xsize;
+		} while (x < width);
+		// rows that repeat
+		for (uint32_t i = 1; i < n; i++) memcpy(prow + i * stride, prow, stride);
+		prow += n * stride;
+		linecount -= n;
+	}
+}
+
+//**************************************************************//
+// Draw a 1bpp ILI9341_t3 glyph by building it as a bitmap in RAM and
+// sending it with one BTE color expansion write. Opaque draws the
+// whole character cell with the background, transparent uses the
+// chroma key version so 0 bits are left alone. With the glyph cache
+// on it goes through SDRAM instead (draw false only fills the cache).
+// Returns false if it can't (clipped or too big), so the caller
+// falls back to drawing runs.
+//**************************************************************//
+bool RA8876_t3::_drawFontGlyphBTE(unsigned int c, const uint8_t *data, uint32_t bitoffset, uint32_t width, uint32_t height,
+								  int32_t origin_x, int32_t origin_y, uint32_t delta, bool opaque, bool draw)
+{
+	int32_t x0, y0, x1, y1;		// cell, x1/y1 are one past the end
+	if (opaque) {
+		x0 = min((int32_t)_cursorX, origin_x);
+		y0 = min((int32_t)_cursorY, origin_y);
+		x1 = max((int32_t)(_cursorX + delta), origin_x + (int32_t)width);
+		y1 = max((int32_t)(_cursorY + font->line_space), origin_y + (int32_t)height);
+	} else {
+		if (!width || !height) return true;	// nothing to draw, like a space
+		x0 = origin_x;
+		y0 = origin_y;
+		x1 = origin_x + width;
+		y1 = origin_y + height;
+	}
+	x0 += _originx; x1 += _originx;
+	y0 += _originy; y1 += _originy;
+	if (draw && ((x0 < _displayclipx1) || (x1 > _displayclipx2) || (y0 < _displayclipy1) || (y1 > _displayclipy2)))
+		return false;
+
+	uint32_t cell_w = x1 - x0;
+	uint32_t cell_h = y1 - y0;
+	uint32_t stride = (cell_w + 7) / 8;
+	if (!cell_w || !cell_h || ((stride * cell_h) > RA8876_GLYPH_BUF_SIZE)) return false;
+
+	bool cached = _glyphCache && (cell_w <= RA8876_GLYPH_CACHE_CELL) && (cell_h <= RA8876_GLYPH_CACHE_CELL);
+	uint16_t bg = opaque ? _TXTBackColor : (uint16_t)~_TXTForeColor;
+	int16_t slot = -1;
+	if (cached) {
+		slot = _glyphCacheFind(font, c, _TXTForeColor, bg, opaque ? 0 : 1, cell_w, cell_h);
+		if (slot >= 0) {
+			if (draw) _glyphCacheDraw(slot, x0, y0);
+			return true;
+		}
+	} else if (!draw) {
+		return false;
+	}
+
+	uint8_t *glyph_buf = (uint8_t *)_scratchAlloc(stride * cell_h);
+	if (!glyph_buf) return false;
+	memset(glyph_buf, 0, stride * cell_h);
+	_fontGlyphBitmap(data, bitoffset, width, height, origin_x + _originx - x0, origin_y + _originy - y0, stride, glyph_buf);
+
+	if (cached) {
+		slot = _glyphCacheStore(font, c, _TXTForeColor, bg, opaque ? 0 : 1, cell_w, cell_h, glyph_buf);
+		if (draw) _glyphCacheDraw(slot, x0, y0);
+	} else if (opaque) {
+		bteMpuWriteColorExpansionData(currentPage, _width, x0, y0, cell_w, cell_h,
+									  _TXTForeColor, _TXTBackColor, glyph_buf);
+	} else {
+		bteMpuWriteColorExpansionWithChromaKeyData(currentPage, _width, x0, y0, cell_w, cell_h,
+												   _TXTForeColor, _TXTBackColor, glyph_buf);
+	}
+	_scratchFree(glyph_buf);
+	return true;
+}
+
+//**************************************************************//
+// Draw an anti-aliased ILI9341_t3 glyph by blending it into a RAM
+// buffer and sending that with one BTE write:
+//  opaque - the whole cell, blended against the background color.
+//  transparent with setFontAlphaBlend - the glyph box is read back,
+//           blended with what is there and written back.
+//  transparent - pixels over half on in the text color, the rest
+//           chroma keyed out (same look as drawing them one by one).
+// Returns false if it can't (clipped or too big).
+//**************************************************************//
+bool RA8876_t3::_drawFontGlyphAA(const uint8_t *data, uint32_t bitoffset, uint32_t width, uint32_t height,
+								 int32_t origin_x, int32_t origin_y, uint32_t delta, bool opaque)
+{
+	int32_t x0, y0, x1, y1;		// cell, x1/y1 are one past the end
+	if (opaque) {
+		x0 = min((int32_t)_cursorX, origin_x);
+		y0 = min((int32_t)_cursorY, origin_y);
+		x1 = max((int32_t)(_cursorX + delta), origin_x + (int32_t)width);
+		y1 = max((int32_t)(_cursorY + font->line_space), origin_y + (int32_t)height);
+	} else {
+		if (!width || !height) return true;	// nothing to draw, like a space
+		x0 = origin_x;
+		y0 = origin_y;
+		x1 = origin_x + width;
+		y1 = origin_y + height;
+	}
+	x0 += _originx; x1 += _originx;
+	y0 += _originy; y1 += _originy;
+	if ((x0 < _displayclipx1) || (x1 > _displayclipx2) || (y0 < _displayclipy1) || (y1 > _displayclipy2))
+		return false;
+	uint32_t cell_w = x1 - x0;
+	uint32_t cell_h = y1 - y0;
+	if (!cell_w || !cell_h || ((cell_w * cell_h) > RA8876_AA_GLYPH_PIXELS)) return false;
+
+	uint16_t *pixels = (uint16_t *)_scratchAlloc(cell_w * cell_h * 2);
+	if (!pixels) return false;
+	uint16_t chroma_key = ~_TXTForeColor;
+	bool blend = !opaque && _fontAlphaBlend;
+	if (opaque) {
+		for (uint32_t i = 0; i < cell_w * cell_h; i++) pixels[i] = _TXTBackColor;
+	} else if (blend) {
+		readRect(x0, y0, cell_w, cell_h, pixels);
+	}
+
+	// The glyph pixels start on a byte boundary and run on from row to row
+	bitoffset = ((bitoffset + 7) & (-8));
+	uint8_t halfalpha = 1 << (fontbpp - 1);
+	uint32_t gx = origin_x + _originx - x0;
+	uint32_t gy = origin_y + _originy - y0;
+	uint32_t xp = 0;
+	for (uint32_t y = 0; y < height; y++) {
+		uint16_t *prow = &pixels[(gy + y) * cell_w + gx];
+		for (uint32_t x = 0; x < width; x++, xp++) {
+			uint8_t alpha = fetchpixel(data, bitoffset + xp * fontbpp, xp);
+			if (opaque) {
+				prow[x] = alphaBlendRGB565Premultiplied(textcolorPrexpanded, textbgcolorPrexpanded, (uint8_t)(alpha * fontalphamx));
+			} else if (blend) {
+				if (alpha) {
+					uint32_t bg = (prow[x] | (prow[x] << 16)) & 0b00000111111000001111100000011111;
+					prow[x] = alphaBlendRGB565Premultiplied(textcolorPrexpanded, bg, (uint8_t)(alpha * fontalphamx));
+				}
+			} else {
+				prow[x] = (alpha >= halfalpha) ? _TXTForeColor : chroma_key;
+			}
+		}
+	}
+
+	if (opaque || blend)
+		writeRect(x0, y0, cell_w, cell_h, pixels);
+	else
+		bteMpuWriteWithChromaKeyData8(currentPage, _width, x0, y0, cell_w, cell_h, chroma_key, (const unsigned char *)pixels);
+	#ifdef SPI_HAS_TRANSFER_ASYNC
+	while(activeDMA) {}; //wait forever while DMA is finishing- can't free the buffer
+	#endif
+	_scratchFree(pixels);
+	return true;
+}
+
+//**************************************************************//
+// Transparent GFX font character through the glyph cache. Returns
+// false if it has to be drawn the normal way.
+//**************************************************************//
+bool RA8876_t3::_drawGFXGlyphCached(unsigned int c, bool draw)
+{
+	if (!_glyphCache || !_backTransparent || (_rotation != 0)) return false;
+	if ((c < gfxFont->first) || (c > gfxFont->last)) return false;
+	GFXglyph *glyph = gfxFont->glyph + (c - gfxFont->first);
+	uint32_t cell_w = glyph->width * textsize_x;
+	uint32_t cell_h = glyph->height * textsize_y;
+	if (!cell_w || !cell_h) return draw;	// nothing to draw, like a space
+	if ((cell_w > RA8876_GLYPH_CACHE_CELL) || (cell_h > RA8876_GLYPH_CACHE_CELL)) return false;
+
+	int16_t yo = glyph->yOffset + gfxFont->yAdvance/2;
+	int32_t x0 = _cursorX + _originx + glyph->xOffset * textsize_x;
+	int32_t y0 = _cursorY + _originy + yo * textsize_y;
+	if (draw && ((x0 < _displayclipx1) || ((x0 + (int32_t)cell_w) > _displayclipx2) ||
+				 (y0 < _displayclipy1) || ((y0 + (int32_t)cell_h) > _displayclipy2)))
+		return false;
+
+	// Text size does not need to be in the key, the cell size already differs
+	uint16_t key = ~_TXTForeColor;
+	int16_t slot = _glyphCacheFind(gfxFont, c, _TXTForeColor, key, 1, cell_w, cell_h);
+	if (slot < 0) {
+		uint32_t stride = (cell_w + 7) / 8;
+		uint8_t *glyph_buf = (uint8_t *)_scratchAlloc(stride * cell_h);
+		if (!glyph_buf) return false;
+		memset(glyph_buf, 0, stride * cell_h);
+		const uint8_t *bitmap = gfxFont->bitmap + glyph->bitmapOffset;
+		uint32_t bit = 0;
+		for (uint32_t yy = 0; yy < glyph->height; yy++) {
+			uint8_t *prow = &glyph_buf[yy * textsize_y * stride];
+			for (uint32_t xx = 0; xx < glyph->width; xx++, bit++) {
+				if (bitmap[bit >> 3] & (0x80 >> (bit & 7))) {
+					for (uint32_t xts = 0; xts < textsize_x; xts++) {
+						uint32_t px = xx * textsize_x + xts;
+						prow[px >> 3] |= 0x80 >> (px & 7);
+					}
+				}
+			}
+			for (uint32_t yts = 1; yts < textsize_y; yts++) memcpy(prow + yts * stride, prow, stride);
+		}
+		slot = _glyphCacheStore(gfxFont, c, _TXTForeColor, key, 1, cell_w, cell_h, glyph_buf);
+		_scratchFree(glyph_buf);
+	}
+	if (draw) _glyphCacheDraw(slot, x0, y0);
+	return true;
+}
+
+//**************************************************************//
+// Glyph cache: turning it on allocates the slot table, the glyphs
+// themselves are kept in SDRAM at RA8876_GLYPH_CACHE_ADDR.
+//**************************************************************//
+void RA8876_t3::glyphCacheEnable(bool on)
+{
+	if (!on) {
+		free(_glyphCache);
+		_glyphCache = nullptr;
+		return;
+	}
+	if (!_glyphCache) {
+		_glyphCache = (glyphCacheEntry_t *)malloc(sizeof(glyphCacheEntry_t) * RA8876_GLYPH_CACHE_SLOTS);
+		if (!_glyphCache) {
+			Serial.println("glyphCacheEnable: out of memory");
+			return;
+		}
+	}
+	glyphCacheClear();
+}
+
+void RA8876_t3::glyphCacheClear(void)
+{
+	if (!_glyphCache) return;
+	memset(_glyphCache, 0, sizeof(glyphCacheEntry_t) * RA8876_GLYPH_CACHE_SLOTS);
+	_glyphCacheTick = 0;
+}
+
+//**************************************************************//
+// Put the characters in chars into the cache using the current
+// font, colors and transparency, without drawing anything.
+//**************************************************************//
+void RA8876_t3::glyphCacheWarm(const char *chars)
+{
+	if (!_glyphCache || !chars) return;
+	for (; *chars; chars++) {
+		unsigned int c = (uint8_t)*chars;
+		if (font) {
+			if (fontbpp != 1) return;
+			uint32_t bitoffset, width, height, delta;
+			int32_t xoffset, yoffset;
+			const uint8_t *data = _fontGlyphInfo(c, bitoffset, width, height, xoffset, yoffset, delta);
+			if (!data) continue;
+			// Only the position relative to the cursor matters, so pretend it is at 0,0
+			int16_t save_x = _cursorX, save_y = _cursorY;
+			_cursorX = 0;
+			_cursorY = 0;
+			_drawFontGlyphBTE(c, data, bitoffset, width, height, xoffset,
+							  font->cap_height - height - yoffset, delta, !_backTransparent, false);
+			_cursorX = save_x;
+			_cursorY = save_y;
+		} else if (gfxFont) {
+			_drawGFXGlyphCached(c, false);
+		}
+	}
+}
+
+int16_t RA8876_t3::_glyphCacheFind(const void *font, uint16_t c, uint16_t fg, uint16_t bg, uint8_t flags, uint8_t w, uint8_t h)
+{
+	for (int16_t i = 0; i < RA8876_GLYPH_CACHE_SLOTS; i++) {
+		glyphCacheEntry_t *e = &_glyphCache[i];
+		if ((e->font == font) && (e->c == c) && (e->fgcolor == fg) && (e->bgcolor == bg) &&
+			(e->flags == flags) && (e->width == w) && (e->height == h)) {
+			e->lastUse = ++_glyphCacheTick;
+			_glyphCacheHits++;
+			return i;
+		}
+	}
+	_glyphCacheMisses++;
+	return -1;
+}
+
+//**************************************************************//
+// Put a glyph bitmap in the least recently used slot, color
+// expanding it into SDRAM. Returns the slot.
+//**************************************************************//
+int16_t RA8876_t3::_glyphCacheStore(const void *font, uint16_t c, uint16_t fg, uint16_t bg, uint8_t flags,
+									uint8_t w, uint8_t h, const uint8_t *bitmap)
+{
+	int16_t slot = 0;
+	for (int16_t i = 0; i < RA8876_GLYPH_CACHE_SLOTS; i++) {
+		if (!_glyphCache[i].font) {
+			slot = i;
+			break;
+		}
+		if (_glyphCache[i].lastUse < _glyphCache[slot].lastUse) slot = i;
+	}
+	glyphCacheEntry_t *e = &_glyphCache[slot];
+	e->font = font;
+	e->c = c;
+	e->fgcolor = fg;
+	e->bgcolor = bg;
+	e->flags = flags;
+	e->width = w;
+	e->height = h;
+	e->lastUse = ++_glyphCacheTick;
+
+	const uint8_t per_row = RA8876_GLYPH_CACHE_WIDTH / RA8876_GLYPH_CACHE_CELL;
+	bteMpuWriteColorExpansionData(RA8876_GLYPH_CACHE_ADDR, RA8876_GLYPH_CACHE_WIDTH,
+								  (slot % per_row) * RA8876_GLYPH_CACHE_CELL, (slot / per_row) * RA8876_GLYPH_CACHE_CELL,
+								  w, h, fg, bg, bitmap);
+	return slot;
+}
+
+void RA8876_t3::_glyphCacheDraw(int16_t slot, int16_t x, int16_t y)
+{
+	const uint8_t per_row = RA8876_GLYPH_CACHE_WIDTH / RA8876_GLYPH_CACHE_CELL;
+	glyphCacheEntry_t *e = &_glyphCache[slot];
+	ru16 sx = (slot % per_row) * RA8876_GLYPH_CACHE_CELL;
+	ru16 sy = (slot / per_row) * RA8876_GLYPH_CACHE_CELL;
+	if (e->flags & 1)
+		bteMemoryCopyWithChromaKey(RA8876_GLYPH_CACHE_ADDR, RA8876_GLYPH_CACHE_WIDTH, sx, sy,
+								   currentPage, _width, x, y, e->width, e->height, e->bgcolor);
+	else
+		bteMemoryCopy(RA8876_GLYPH_CACHE_ADDR, RA8876_GLYPH_CACHE_WIDTH, sx, sy,
+					  currentPage, _width, x, y, e->width, e->height);
+}
+
 void RA8876_t3::drawFontBits(bool opaque, uint32_t bits, uint32_t numbits, int32_t x, int32_t y, uint32_t repeat)
 {
 	//Serial.printf("    drawFontBits: %d %x %x (%d %d) %u\n", opaque, bits, numbits, x, y, repeat);
@@ -6197,6 +8513,12 @@ void RA8876_t3::drawGFXFontChar(unsigned int c) {
         _cursorY += (int16_t)textsize_y * gfxFont->yAdvance;
     }
 
+    // Already in the glyph cache (or can be put there)?
+    if (_drawGFXGlyphCached(c)) {
+        _cursorX += glyph->xAdvance * (int16_t)textsize_x;
+        return;
+    }
+
     // Lets do the work to output the font character
     uint8_t  *bitmap = gfxFont->bitmap;
 
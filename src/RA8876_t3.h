@@ -71,6 +71,7 @@ Version   : v1.0
 #include "Arduino.h"
 #include "SPI.h"
 #include "RA8876Registers.h"
+#include "RA8876Bus.h"
 
 #ifndef _RA8876_T3
 #define _RA8876_T3
@@ -127,15 +128,150 @@ const ru32 SPIspeed = 3000000;
 // Max. size in byte of SDRAM
 const uint32_t MEM_SIZE_MAX	= 16l*1024l*1024l;
 
+// Number of BTE operations that can be waiting in the bteQueue functions
+#ifndef RA8876_BTE_QUEUE_SIZE
+#define RA8876_BTE_QUEUE_SIZE 8
+#endif
+
+// Number of writeRectAsync() transfers that can be waiting behind the active one
+#ifndef RA8876_DMA_QUEUE_SIZE
+#define RA8876_DMA_QUEUE_SIZE 4
+#endif
+
+// Number of register/data pairs beginRegBatch() can hold before
+// they are forced out onto the SPI buss.
+#ifndef RA8876_REG_BATCH_SIZE
+#define RA8876_REG_BATCH_SIZE 32
+#endif
+
+// Number of separate damaged areas useCanvas() mode tracks before merging them
+#ifndef RA8876_DAMAGE_RECTS
+#define RA8876_DAMAGE_RECTS 8
+#endif
+
+// Largest 1bpp glyph cell (in bytes) drawFontChar() builds in RAM for one BTE write
+#ifndef RA8876_GLYPH_BUF_SIZE
+#define RA8876_GLYPH_BUF_SIZE 1024
+#endif
+
+// Bytes of scratch RAM for row/tile buffers, see setScratchBuffer()
+#ifndef RA8876_SCRATCH_SIZE
+#define RA8876_SCRATCH_SIZE 12288
+#endif
+// Define RA8876_SCRATCH_NO_HEAP to have drawing fail instead of using
+// malloc when the scratch buffer is too small. The call that ran out then
+// draws nothing: writeRect() rotated, writeRect8BPP(), writeRectNBPP(),
+// writeRectStream(), drawPackedImage(), the gradient fills and the scaled
+// built in font. Font glyphs fall back to drawing pixel by pixel. Each one
+// is printed and counted in scratchFailures().
+
+// Pixels writeRect8BPP/writeRectNBPP expand per buffer (two buffers are used)
+#ifndef RA8876_PALETTE_TILE_PIXELS
+#define RA8876_PALETTE_TILE_PIXELS 2048
+#endif
+
+// Pixels writeRect reorders per buffer when rotated (two buffers are used)
+#ifndef RA8876_ROTATE_TILE_PIXELS
+#define RA8876_ROTATE_TILE_PIXELS 2048
+#endif
+
+// Pixels writeRectStream() asks the producer for per buffer (two buffers are used)
+#ifndef RA8876_STREAM_TILE_PIXELS
+#define RA8876_STREAM_TILE_PIXELS 2048
+#endif
+
+// Pixels the linear and radial gradient fills compute per buffer (two buffers are used)
+#ifndef RA8876_GRADIENT_TILE_PIXELS
+#define RA8876_GRADIENT_TILE_PIXELS 2048
+#endif
+
+// Largest anti-aliased glyph cell (in pixels) drawFontChar() blends in RAM
+#ifndef RA8876_AA_GLYPH_PIXELS
+#define RA8876_AA_GLYPH_PIXELS 1024
+#endif
+
+#ifdef RA8876_SCRATCH_NO_HEAP
+// Without malloc the scratch buffer has to hold at least two rows of the
+// widest (1024 pixel) panel and the largest glyph cells
+static_assert(RA8876_SCRATCH_SIZE >= 2 * 1024 * 2, "RA8876_SCRATCH_SIZE is too small for two 1024 pixel rows");
+static_assert(RA8876_SCRATCH_SIZE >= RA8876_AA_GLYPH_PIXELS * 2, "RA8876_SCRATCH_SIZE is smaller than RA8876_AA_GLYPH_PIXELS");
+static_assert(RA8876_SCRATCH_SIZE >= RA8876_GLYPH_BUF_SIZE, "RA8876_SCRATCH_SIZE is smaller than RA8876_GLYPH_BUF_SIZE");
+#endif
+
+// Glyph cache lives in SDRAM past PAGE10, split up into square cells
+#ifndef RA8876_GLYPH_CACHE_ADDR
+#define RA8876_GLYPH_CACHE_ADDR (1024*600*2*10)
+#endif
+#ifndef RA8876_GLYPH_CACHE_CELL
+#define RA8876_GLYPH_CACHE_CELL 64
+#endif
+#define RA8876_GLYPH_CACHE_WIDTH 1024
+#define RA8876_GLYPH_CACHE_HEIGHT 600
+#define RA8876_GLYPH_CACHE_SLOTS ((RA8876_GLYPH_CACHE_WIDTH/RA8876_GLYPH_CACHE_CELL)*(RA8876_GLYPH_CACHE_HEIGHT/RA8876_GLYPH_CACHE_CELL))
+
+// SDRAM after the glyph cache is handed out by surfaceAlloc(), see setSurfaceHeap()
+#ifndef RA8876_SURFACE_HEAP_START
+#define RA8876_SURFACE_HEAP_START (RA8876_GLYPH_CACHE_ADDR + RA8876_GLYPH_CACHE_WIDTH*RA8876_GLYPH_CACHE_HEIGHT*2)
+#endif
+#ifndef RA8876_SURFACE_MAX
+#define RA8876_SURFACE_MAX 32
+#endif
+
+// Most BTE copies bteMove() splits an overlapping move into before it
+// bounces it through a temporary surface instead
+#ifndef RA8876_MOVE_MAX_BANDS
+#define RA8876_MOVE_MAX_BANDS 16
+#endif
+
+// Phases begin() times, see printBootTimes()
+#define RA8876_BOOT_RESET	0
+#define RA8876_BOOT_PLL		1
+#define RA8876_BOOT_SDRAM	2
+#define RA8876_BOOT_PANEL	3
+#define RA8876_BOOT_CLEAR	4
+#define RA8876_BOOT_PHASES	5
+
+// Number of sprites, each uses two surfaces
+#ifndef RA8876_SPRITE_MAX
+#define RA8876_SPRITE_MAX 8
+#endif
+#define RA8876_SPRITE_OPAQUE 32
+
+// Rows in the SDRAM ring useHardwareScroll() scrolls through, the more
+// rows past the screen height the less often it has to wrap
+#ifndef RA8876_SCROLL_RING_ROWS
+#define RA8876_SCROLL_RING_ROWS (600*2)
+#endif
+
 #if defined(USE_FT5206_TOUCH)
 #include <Wire.h>
 #endif
 
+// Called when a writeRectAsync() transfer has completed. Note: this is called from
+// the DMA completion interrupt, so keep it short.
+typedef void (*RA8876DMACallback)(void *context, uint32_t fence);
+
+// Fills in rows first_row to first_row + rows - 1 of a writeRectStream() image,
+// w colors per row. Return false to give up, the rest of the rectangle is black.
+typedef bool (*RA8876PixelProducer)(void *context, uint16_t *pcolors, int16_t first_row, int16_t rows, int16_t w);
+
+typedef struct {
+	int16_t				x, y, w, h;
+	const uint16_t		*pcolors;
+	RA8876DMACallback	callback;
+	void				*context;
+	uint32_t			fence;
+} RA8876DMASlot_t;
+
 
 class RA8876_t3 : public Print
 {
 public:
 	RA8876_t3(const uint8_t CSp = 10, const uint8_t RSTp = 8, const uint8_t mosi_pin = 11, const uint8_t sclk_pin = 13, const uint8_t miso_pin = 12);
+	// Use some other host interface, RA8876FlexIOBus or RA8876MockBus.
+	// begin()'s clock goes to bus.begin().
+	RA8876_t3(RA8876Bus &bus, const uint8_t RSTp = 255);
+	RA8876Bus *bus(void) { return _bus; }
 
 	
 	volatile bool	RA8876_BUSY; //This is used to show an SPI transaction is in progress. 
@@ -145,6 +281,16 @@ public:
 	uint8_t		getRotation(); //return the current rotation 0-3
 	/* Initialize RA8876 */
 	boolean begin(uint32_t spi_clock=SPIspeed);
+	// Call before begin() to only clear the page being displayed. The other
+	// pages are cleared the first time selectScreen() (or useCanvas() and
+	// useSwapChain()) uses them, or one at a time by calling pageClearService()
+	// from loop(), which only starts a BTE fill when the engine is free. Pages
+	// something else gets to first, a BTE destination, the canvas or the
+	// surface heap (setSurfaceHeap()), are left as they are.
+	void setFastBoot(bool on) { _fastBoot = on; }
+	bool pageClearService(void);
+	uint32_t bootMicros(uint8_t phase) { return (phase < RA8876_BOOT_PHASES) ? _bootMicros[phase] : 0; }
+	void printBootTimes(Print &pr);
 	boolean ra8876Initialize(); 
 	boolean ra8876PllInitial (void);
 	boolean ra8876SdramInitial(void);
@@ -162,6 +308,43 @@ public:
 	void lcdRegDataWrite(ru8 reg,ru8 data, bool finalize = true);
 	ru8 lcdRegDataRead(ru8 reg, bool finalize = true);
 	void lcdDataWrite16bbp(ru16 data, bool finalize = true); 
+	// Block of data to the selected register (the memory port), with DMA
+	// when the bus can: wait for activeDMA to clear before reusing data.
+	void lcdDataWriteBurst(const void *data, uint32_t len);
+	
+	/* Register write batching */
+	// Between beginRegBatch() and endRegBatch() lcdRegDataWrite() only queues the
+	// register/data pair, the queue is sent in a single SPI transaction when the
+	// outer most endRegBatch() is called, or earlier if anything else needs the buss.
+	void beginRegBatch(void) { _regBatchDepth++; }
+	void endRegBatch(void);
+	void flushRegBatch(bool finalize = true);
+	
+	/* Register shadow cache */
+	// lcdRegDataWrite() skips writes to configuration registers that already
+	// hold the value. Call this if the RA8876 is reset or written behind our back.
+	void invalidateRegCache(void) { memset(_regShadowValid, 0, sizeof(_regShadowValid)); }
+	
+	/* SPI buss statistics */
+	uint32_t spiTransactionCount(void) { return _spiTransactionCount; }
+	uint32_t spiCSAssertCount(void) { return _spiCSAssertCount; }
+	uint32_t regWritesSkipped(void) { return _regWritesSkipped; }
+	uint32_t statusPollCount(void) { return _statusPollCount; }
+	void resetSpiStats(void) { _spiTransactionCount = 0; _spiCSAssertCount = 0; _regWritesSkipped = 0; _statusPollCount = 0; }
+	void printSpiStats(Print &pr);
+	
+	/* Scratch buffer */
+	// Temporary row and tile buffers come out of this, by default a buffer of
+	// RA8876_SCRATCH_SIZE bytes inside the object. Pass a bigger one (DMAMEM or
+	// DTCM) to use that instead, or nullptr to go back to the built in one.
+	// Don't change it while anything is being drawn.
+	void setScratchBuffer(void *buffer, uint32_t size);
+	uint32_t scratchSize(void) { return _scratchSize; }
+	uint32_t scratchHighWater(void) { return _scratchHighWater; }
+	uint32_t scratchHeapAllocs(void) { return _scratchHeapAllocs; }
+	// Drawing calls that were skipped because no buffer could be had, should stay 0
+	uint32_t scratchFailures(void) { return _scratchFailures; }
+	void resetScratchStats(void) { _scratchHighWater = _scratchTop; _scratchHeapAllocs = 0; _scratchFailures = 0; }
 	
 	/*Status*/
 	void checkWriteFifoNotFull(void);
@@ -170,6 +353,8 @@ public:
 	void checkReadFifoFull(void);
 	void checkReadFifoNotEmpty(void);
 	void check2dBusy(void);
+	bool coreBusy(void);
+	void useInterruptPin(uint8_t pin);
 	boolean checkSdramReady(void);
 	ru8 powerSavingStatus(void);
 	boolean checkIcReady(void);//
@@ -290,6 +475,12 @@ public:
 	void Text_Cursor_H_V(unsigned short WX,unsigned short HY);
 	void scroll(void);
 	void scrollDown(void);
+	// scroll()/scrollDown() move where the display and canvas start in a taller
+	// ring of SDRAM instead of copying the screen, only copying it when the ring
+	// wraps. Rows outside _scrollYT.._scrollYB (status lines) are moved along.
+	// Rotation 0, full width scroll region, not with useCanvas()/useSwapChain().
+	bool useHardwareScroll(bool on);
+	bool hardwareScrollActive(void) { return _hwScrollSurface >= 0; }
 	void putString(ru16 x0,ru16 y0, const char *str);
 	void writeStatusLine(ru16 x0, uint16_t fgcolor, uint16_t bgcolor, const char *str);	
 	
@@ -312,6 +503,61 @@ public:
 	/* Pseudo Frame Buffer Support */
 	void useCanvas(boolean on);
 	void updateScreen();
+	// While using the canvas, drawing is watched and updateScreen() only copies
+	// the areas that changed. Coordinates here are in canvas memory, not rotated.
+	void setDamageTracking(bool on);
+	void addDamage(int16_t x, int16_t y, int16_t w, int16_t h);
+	void damageAll(void);
+	uint8_t damageCount(void) { return _damageCount; }
+	// Page flipping: draw into the back buffer then present() just points the
+	// display at it. Uses 2 or 3 of PAGE1..PAGE3, 0 turns it off.
+	// Note: the new back buffer still holds whatever was drawn in it before.
+	void useSwapChain(uint8_t buffers);
+	void present(bool vsync = true);
+	bool waitVSync(uint32_t timeout_ms = 50);
+	uint32_t frontBufferAddress(void) { return _swapPageAddr(_swapFront); }
+	uint32_t backBufferAddress(void) { return _swapPageAddr(_swapBack); }
+	
+	/* SDRAM surfaces */
+	// Off-screen images of any size in the SDRAM past the screen pages and the
+	// glyph cache. Returns a handle, or -1 if it does not fit. surfaceCompact()
+	// moves surfaces down to close the gaps, so look the address up again after
+	// it rather than keeping it. Use surfaceAddress()/surfaceImageWidth() as
+	// the BTE address and image width, or surfaceSelect() to draw into one.
+	// setSurfaceHeap() hands it a different range, for example the unused
+	// screen pages: setSurfaceHeap(PAGE3_START_ADDR, RA8876_GLYPH_CACHE_ADDR).
+	int16_t surfaceAlloc(uint16_t width, uint16_t height, uint8_t bpp = 16, uint16_t align = 4);
+	void surfaceFree(int16_t surface);
+	void surfaceCompact(void);
+	bool setSurfaceHeap(uint32_t start, uint32_t end);
+	uint32_t surfaceAddress(int16_t surface) { return _surfaceValid(surface) ? _surfaces[surface].addr : 0; }
+	uint16_t surfaceImageWidth(int16_t surface) { return _surfaceValid(surface) ? _surfaces[surface].stride / (_surfaces[surface].bpp / 8) : 0; }
+	uint16_t surfaceWidth(int16_t surface) { return _surfaceValid(surface) ? _surfaces[surface].width : 0; }
+	uint16_t surfaceHeight(int16_t surface) { return _surfaceValid(surface) ? _surfaces[surface].height : 0; }
+	uint8_t surfaceCount(void);
+	uint32_t surfaceBytesUsed(void);
+	uint32_t surfaceBytesFree(void) { return (_surfaceHeapEnd - _surfaceHeapStart) - surfaceBytesUsed(); }
+	uint32_t surfaceLargestFree(void);
+	// Point all drawing at a 16bpp surface (rotation 0), surfaceDeselect() goes back
+	// to the page. Resets the clip rectangle both ways.
+	bool surfaceSelect(int16_t surface);
+	void surfaceDeselect(void);
+	
+	/* Sprites */
+	// The image is uploaded once into a surface. spritesUpdate() puts back what
+	// was under each sprite, saves what is under the new spots and draws them
+	// there, all as queued BTE memory copies, so moving a sprite sends no pixels.
+	// Pixels in the chroma key color are transparent, or spriteSetAlpha() blends
+	// the whole sprite. Call spritesRestore() before drawing anything a sprite
+	// might cover. Rotation 0 only, on the current page.
+	int8_t spriteCreate(uint16_t w, uint16_t h, const uint16_t *pixels, uint16_t chroma_key);
+	void spriteDestroy(int8_t sprite);
+	void spriteMove(int8_t sprite, int16_t x, int16_t y);
+	void spriteShow(int8_t sprite, bool visible);
+	void spriteSetAlpha(int8_t sprite, uint8_t alpha);
+	int16_t spriteSurface(int8_t sprite) { return _spriteValid(sprite) ? _sprites[sprite].image : -1; }
+	void spritesUpdate(void);
+	void spritesRestore(void);
 	
 	 
 	/*draw function*/
@@ -332,10 +578,20 @@ public:
   /* New Functions for 2024 */
   void readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pcolors);
   uint16_t readPixel(int16_t x, int16_t y);
+  // color1 at the right going to color2 at the left
   void fillRectHGradient(int16_t x, int16_t y, int16_t w, int16_t h,
                                             uint16_t color1, uint16_t color2);
+  // color1 at the bottom going to color2 at the top
   void fillRectVGradient(int16_t x, int16_t y, int16_t w, int16_t h,
                                             uint16_t color1, uint16_t color2);
+  // angle in degrees, 0 is color1 on the left going right, 90 is color1 on top going down
+  void fillRectLinearGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+                                            uint16_t color1, uint16_t color2, int16_t angle);
+  // color1 in the center out to color2 at the corners
+  void fillRectRadialGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+                                            uint16_t color1, uint16_t color2);
+  // Ordered (4x4 Bayer) dithering of gradients down to RGB565
+  void setGradientDither(bool on) { _gradientDither = on; }
 	 
 	/*BTE function*/
 	void bte_Source0_MemoryStartAddr(ru32 addr);
@@ -352,6 +608,7 @@ public:
 	
 	void bteMemoryCopy(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,ru32 des_addr,ru16 des_image_width, 
 					   ru16 des_x,ru16 des_y,ru16 copy_width,ru16 copy_height);
+	void bteMove(ru32 addr,ru16 image_width,ru16 s_x,ru16 s_y,ru16 d_x,ru16 d_y,ru16 move_width,ru16 move_height);
 	void bteMemoryCopyWithROP(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,
 							   ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 copy_width,ru16 copy_height,ru8 rop_code);
 	void bteMemoryCopyWithChromaKey(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
@@ -364,6 +621,57 @@ public:
 	void bteMpuWriteWithROPData16(ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,ru32 des_addr,ru16 des_image_width,
 							ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru8 rop_code,const unsigned short *data);
 	bool DMAFinished() {return !activeDMA;}
+
+	/* Pipelined DMA writeRect */
+	// writeRectAsync() returns a fence right away, the pixel buffer must not be changed
+	// until dmaFenceDone() says that fence has passed. Transfers go out in order, one
+	// waiting transfer is started each time one completes and dmaService(), dmaFenceWait()
+	// or another writeRectAsync() is called. Anything else using the buss waits for the
+	// queue to drain first.
+	uint32_t writeRectAsync(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors,
+							RA8876DMACallback callback = nullptr, void *context = nullptr);
+	bool dmaFenceDone(uint32_t fence) { return (int32_t)(_dmaFenceCompleted - fence) >= 0; }
+	void dmaFenceWait(uint32_t fence);
+	void dmaService(void);
+	void dmaQueueFlush(void);
+	uint8_t dmaQueueCount(void) { return _dmaQueueCount; }
+	// writeRect() for images that are never all in RAM at once: producer is called
+	// for a few rows at a time, top to bottom, to fill one buffer while DMA sends the
+	// other. Rows clipped off the top are still asked for and thrown away, rows
+	// below the clip rectangle are not. false if the producer gave up.
+	bool writeRectStream(int16_t x, int16_t y, int16_t w, int16_t h, RA8876PixelProducer producer, void *context = nullptr);
+	// Draw an image packed by extras/packimage (size is sizeof the array). Rows all one
+	// color are drawn with a solid fill, the rest is decoded a few rows at a time and
+	// streamed like writeRectStream(). false if it is not a packed image or is corrupt.
+	bool drawPackedImage(int16_t x, int16_t y, const uint8_t *image, uint32_t size);
+	static bool packedImageSize(const uint8_t *image, uint32_t size, int16_t &w, int16_t &h);
+
+	/* Sharing the bus */
+	// Several displays (and other devices) on one bus share a RA8876BusArbiter.
+	// Each one holds the bus from startSend() until the transaction is finalized,
+	// or its DMA transfer completes. Queued writeRectAsync() transfers then take
+	// turns with the other displays' through arbiter.service(), call that from
+	// loop() too. Call before begin().
+	bool setBusArbiter(RA8876BusArbiter &arbiter, const char *name = "RA8876");
+
+	/* BTE job queue */
+	// The bteQueue functions return right away, the operations are started one at a time
+	// by bteService() as the 2D engine becomes free. Call bteService() from loop() or
+	// bteQueueFlush() to wait for all of them. Anything that calls check2dBusy() flushes
+	// the queue first so things stay in order.
+	void bteQueueMemoryCopy(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,ru32 des_addr,ru16 des_image_width, 
+					   ru16 des_x,ru16 des_y,ru16 copy_width,ru16 copy_height);
+	void bteQueueMemoryCopyWithROP(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,
+							   ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 copy_width,ru16 copy_height,ru8 rop_code);
+	void bteQueuePatternFill(ru8 p8x8or16x16, ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
+					   ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height);
+	void bteQueueMemoryCopyWithChromaKey(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
+							   ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 copy_width,ru16 copy_height,ru16 chromakey_color);
+	void bteQueueMemoryCopyWindowAlpha(ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,
+							   ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 copy_width,ru16 copy_height,ru8 alpha);
+	uint8_t bteService(void);
+	void bteQueueFlush(void);
+	uint8_t bteQueueCount(void) { return _bteJobCount; }
 	void bteMpuWriteWithROP(ru32 s1_addr,ru16 s1_image_width,ru16 s1_x,ru16 s1_y,ru32 des_addr,ru16 des_image_width,
 							ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru8 rop_code);                     
 	void bteMpuWriteWithChromaKeyData8(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 chromakey_color,
@@ -382,6 +690,7 @@ public:
 					   ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height);
 	void btePatternFillWithChromaKey(ru8 p8x8or16x16, ru32 s0_addr,ru16 s0_image_width,ru16 s0_x,ru16 s0_y,
 									ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 chromakey_color);
+	void bteSolidFill(ru32 des_addr,ru16 des_image_width, ru16 des_x,ru16 des_y,ru16 width,ru16 height,ru16 color);
 									
 	/*DMA function*/
 	void setSerialFlash4BytesMode(ru8 scs_select);
@@ -465,6 +774,14 @@ public:
 
 	void drawRect(int16_t x, int16_t y, int16_t w, int16_t h,uint16_t color);
 	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,uint16_t color);
+	// Batched versions for charts and the like: the setup is shared, each item
+	// is only its coordinates (and color if it changes), and the next item is
+	// worked out while the engine draws the last one. sort_by_color draws all
+	// of one color together, only use it when the order they overlap in does
+	// not matter. drawPixels() clips and rotates, unlike drawPixel().
+	void fillRects(const primRect_t *rects, uint16_t count, bool sort_by_color = false);
+	void drawLines(const primLine_t *lines, uint16_t count, bool sort_by_color = false);
+	void drawPixels(const primPixel_t *pixels, uint16_t count);
 
 	void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors);
 	// Experiment to see if we get significant speed ups for images if they are already pre processed to 
@@ -511,6 +828,12 @@ public:
                        uint8_t bits_per_pixel, const uint8_t *pixels,
                        const uint16_t *palette);
 
+    // paletteExpandRow - one row of palette lookups, the kernel the two above
+    //					expand each tile with. skip is how many pixels into
+    //					the row to start.
+    static void paletteExpandRow(uint16_t *dst, const uint8_t *src, uint16_t skip, uint16_t w,
+                                 uint8_t bits_per_pixel, const uint16_t *palette);
+
 
 
 	void drawRoundRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t xr, uint16_t yr, uint16_t color);
@@ -664,6 +987,24 @@ public:
 	void inline drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) 
 	    { drawChar(x, y, c, color, bg, size);}
 	void drawFontBits(bool opaque, uint32_t bits, uint32_t numbits, int32_t x, int32_t y, uint32_t repeat);
+
+	// Transparent anti-aliased ILI9341_t3 fonts: read back what is under each glyph
+	// and blend with it, instead of only drawing pixels that are over half on.
+	void setFontAlphaBlend(bool on) { _fontAlphaBlend = on; }
+
+	// 1bpp ILI9341_t3 glyphs go out as one BTE color expansion each. Off, they
+	// are drawn a fillRect per run of bits the way rotated text is.
+	void setFontColorExpansion(bool on) { _fontColorExpansion = on; }
+
+	// Keep rendered ILI9341_t3 (1bpp) and transparent GFX glyphs in SDRAM so
+	// drawing them again is just a BTE copy. Off by default as it uses the
+	// memory at RA8876_GLYPH_CACHE_ADDR.
+	void glyphCacheEnable(bool on);
+	void glyphCacheClear(void);
+	void glyphCacheWarm(const char *chars);	// current font, colors and size
+	uint32_t glyphCacheHits(void) { return _glyphCacheHits; }
+	uint32_t glyphCacheMisses(void) { return _glyphCacheMisses; }
+	void resetGlyphCacheStats(void) { _glyphCacheHits = 0; _glyphCacheMisses = 0; }
 	void Pixel(int16_t x, int16_t y, uint16_t color);
 	
 	void charBounds(char c, int16_t *x, int16_t *y,
@@ -685,41 +1026,29 @@ public:
 	int16_t getCursorY(void);
 	
 //. From Onewire utility files
-	#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x
-	void DIRECT_WRITE_LOW(volatile uint32_t * base, uint32_t mask)  __attribute__((always_inline)) {
-		*(base+34) = mask;
-	}
-	void DIRECT_WRITE_HIGH(volatile uint32_t * base, uint32_t mask)  __attribute__((always_inline)) {
-		*(base+33) = mask;
-	}
-	#endif
-
 	//SPI Functions - should these be private?
 	inline __attribute__((always_inline)) 
 	void startSend(){
 		#ifdef SPI_HAS_TRANSFER_ASYNC
+		if(_dmaQueueCount && !_dmaInService) dmaQueueFlush();	// writeRectAsync() stuff goes first
 		while(activeDMA) {}; //wait forever while DMA is finishing- can't start a new transfer
 		#endif
+		// Anything queued by beginRegBatch() has to go out first to keep things in order
+		if(_regBatchCount) flushRegBatch(false);
 		if(!RA8876_BUSY) {
 	        RA8876_BUSY = true;
-			_pspi->beginTransaction(SPISettings(_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+			_bus->beginTransaction();
+			_spiTransactionCount++;
 		}
-		#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x 
-		DIRECT_WRITE_LOW(_csport, _cspinmask);
-		#else
-			*_csport  &= ~_cspinmask;
-		#endif
+		_spiCSAssertCount++;
+		_bus->select();
 	}
 
 	inline __attribute__((always_inline)) 
 	void endSend(bool finalize){
-		#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x 
-		DIRECT_WRITE_HIGH(_csport, _cspinmask);
-		#else
-		*_csport |= _cspinmask;
-		#endif
+		_bus->deselect();
 		if(finalize) {
-			_pspi->endTransaction();
+			_bus->endTransaction();
 			RA8876_BUSY = false;
 		}
 	} 
@@ -746,40 +1075,141 @@ using Print::write;
 
 private:
 	// int _xnscs, _xnreset;
-	int _mosi;
-	int _miso;
-	int _sclk;
-	int _cs;
 	int _rst;
 	int	_errorCode;
-	SPIClass *_pspi = nullptr;
-//	SPIClass::SPI_Hardware_t *_spi_hardware;
-
-  	uint8_t   	_spi_num;         	// Which buss is this spi on? 
-	uint32_t 	_SPI_CLOCK;			// #define ILI9341_SPICLOCK 30000000
-	uint32_t	_SPI_CLOCK_READ; 	//#define ILI9341_SPICLOCK_READ 2000000
-
-#if defined(KINETISK)
- 	KINETISK_SPI_t *_pkinetisk_spi;
-#elif defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x
- 	IMXRT_LPSPI_t *_pimxrt_spi;
-
-#elif defined(KINETISL)
- 	KINETISL_SPI_t *_pkinetisl_spi;
-#endif
+	RA8876SPIBus	_spiBus;	// used unless the constructor was given a bus
+	RA8876Bus	*_bus = &_spiBus;
+
+	// Register write queue, see beginRegBatch()
+	uint8_t		_regBatchBuf[RA8876_REG_BATCH_SIZE * 2];	// register, value pairs
+	uint16_t	_regBatchCount = 0;		// number of queued register/data pairs
+	uint8_t		_regBatchDepth = 0;
+	uint32_t	_spiTransactionCount = 0;
+	uint32_t	_spiCSAssertCount = 0;
+
+	// Shadow copy of the cacheable registers, see invalidateRegCache()
+	uint8_t		_regShadow[256];
+	uint32_t	_regShadowValid[8] = {0};
+	uint8_t		_regSelected = 0;	// register the last command write selected
+	uint32_t	_regWritesSkipped = 0;
+
+	// What we may have left the core (2D engine) working on, see check2dBusy()
+	volatile uint8_t	_coreTaskPending = 0;
+	uint8_t		_intPin = 0xff;
+	uint32_t	_statusPollCount = 0;
+
+	// BTE job queue
+	bteJob_t	_bteJobs[RA8876_BTE_QUEUE_SIZE];
+	uint8_t		_bteJobHead = 0;
+	uint8_t		_bteJobCount = 0;
+	bool		_bteInService = false;
+	bteJob_t	*_bteQueueAlloc(uint8_t op);
+	void		_bteRunJob(const bteJob_t *job);
+
+	// useCanvas() damage tracking
+	damageRect_t	_damage[RA8876_DAMAGE_RECTS];
+	uint8_t		_damageCount = 0;
+	bool		_damageEnabled = true;
+	bool		_damageTracking = false;	// enabled and the canvas is in use
+	bool		_damageMemWriteCovered = false;	// next MRWDP select already accounted for
+	void		_damageAdd(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+	void		_damageFromEngine(ru8 reg, ru8 data);
+	void		_damageFromMemWrite(void);
+	bool		_regShadowValue(ru8 reg, uint8_t count, uint32_t &value);
+
+	// Scratch buffer, allocations are freed in the reverse order
+	uint8_t		_scratchBuf[RA8876_SCRATCH_SIZE] __attribute__((aligned(32)));
+	uint8_t		*_scratch = _scratchBuf;
+	uint32_t	_scratchSize = RA8876_SCRATCH_SIZE;
+	uint32_t	_scratchTop = 0;
+	uint32_t	_scratchHighWater = 0;
+	uint32_t	_scratchHeapAllocs = 0;
+	uint32_t	_scratchFailures = 0;
+	void		*_scratchAlloc(uint32_t bytes);
+	void		_scratchFree(void *p);
+	uint32_t	_scratchAvailable(void);
+	void		*_scratchTiles(uint32_t row_pixels, int16_t &rows, uint16_t *buffers[2]);
+
+	bool		_fillRectCorners(int16_t x, int16_t y, int16_t w, int16_t h, int16_t corners[4]);
+	void		_geometryCorners(const int16_t corners[4]);
+	uint16_t	*_sortByColor(const void *items, uint32_t item_size, uint16_t count);
+
+	void		_writeRectRotated(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors);
+	void		_writeRectPalette(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t bits_per_pixel,
+								  const uint8_t *pixels, uint16_t row_bytes, uint16_t skip, const uint16_t *palette);
+	bool		_gradientDither = false;
+	void		_fillRectGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+								  uint16_t color1, uint16_t color2, uint8_t type, int16_t angle);
+
+	// useSwapChain()
+	uint8_t		_swapBuffers = 0;	// 0 when not in use
+	uint8_t		_swapFront = 0;
+	uint8_t		_swapBack = 0;
+	uint32_t	_swapPageAddr(uint8_t index) { return (uint32_t)index * PAGE2_START_ADDR; }
+	void		_swapSetBack(uint8_t index);
+
+	// surfaceAlloc()
+	surface_t	_surfaces[RA8876_SURFACE_MAX] = {};
+	uint32_t	_surfaceHeapStart = RA8876_SURFACE_HEAP_START;
+	uint32_t	_surfaceHeapEnd = MEM_SIZE_MAX;
+	int16_t		_surfaceSelected = -1;
+	uint32_t	_surfaceSavedPage;
+	int16_t		_surfaceSavedWidth;
+	int16_t		_surfaceSavedHeight;
+	bool		_surfaceSavedDamage;
+	bool		_surfaceValid(int16_t surface) { return (surface >= 0) && (surface < RA8876_SURFACE_MAX) && _surfaces[surface].size; }
+	uint32_t	_surfaceFindGap(uint32_t size, uint16_t align);
+
+	// setFastBoot()
+	bool		_fastBoot = false;
+	uint16_t	_pageClearPending = 0;	// bit per screen page, PAGE1 is bit 0
+	uint32_t	_bootMicros[RA8876_BOOT_PHASES] = {0};
+	void		_pageClear(uint8_t page);
+	uint16_t	_pageClearMask(uint32_t start, uint32_t end);
+
+	// useHardwareScroll()
+	int16_t		_hwScrollSurface = -1;	// ring buffer surface
+	uint16_t	_hwScrollRow = 0;		// ring row at the top of the screen
+	uint32_t	_hwScrollPage;			// page to go back to
+	void		_hwScrollApply(void);
+	void		_hwScrollCopyRows(uint16_t src_row, uint16_t dst_row, uint16_t rows);
+	bool		_hwScroll(int16_t rows);
+
+	// spriteCreate()
+	sprite_t	_sprites[RA8876_SPRITE_MAX];
+	bool		_spritesInit = false;
+	bool		_spritesDirty = false;	// something moved since spritesUpdate()
+	bool		_spriteValid(int8_t sprite) { return _spritesInit && (sprite >= 0) && (sprite < RA8876_SPRITE_MAX) && (_sprites[sprite].image >= 0); }
 
 #ifdef SPI_HAS_TRANSFER_ASYNC
 	EventResponder finishedDMAEvent;
+	friend void asyncEventResponder(EventResponderRef event_responder);
 #endif
-	// add support to allow only one hardware CS (used for dc)
-#if defined(__IMXRT1052__) || defined(__IMXRT1062__)  // Teensy 4.x
-    uint32_t _cspinmask;
-    volatile uint32_t *_csport;
-    uint32_t _spi_tcr_current;
-#else
-    uint8_t _cspinmask;
-    volatile uint8_t *_csport;
-#endif
+
+	// writeRectAsync() queue
+	RA8876DMASlot_t		_dmaQueue[RA8876_DMA_QUEUE_SIZE];
+	uint8_t				_dmaQueueHead = 0;
+	volatile uint8_t	_dmaQueueCount = 0;
+	bool				_dmaInService = false;
+	uint32_t			_dmaFenceNext = 0;
+	volatile uint32_t	_dmaFenceCompleted = 0;
+	RA8876DMASlot_t		_dmaActiveSlot;
+	volatile bool		_dmaActiveSlotValid = false;
+	void				_dmaStartNext(void);
+	void				_dmaSlotDone(void);
+	void				_dmaKick(void);
+
+	// setBusArbiter()
+	RA8876BusArbiter	*_arbiter = nullptr;
+	int8_t				_arbiterId = -1;
+	static void			_arbiterService(void *context);
+	static void			_arbiterYield(void *context);
+
+	// drawPackedImage()
+	static bool			_packedBegin(packedDecoder_t *d, const uint8_t *image, uint32_t size);
+	static bool			_packedDecode(packedDecoder_t *d, uint16_t *pcolors, uint32_t count);
+	static uint32_t		_packedRun(packedDecoder_t *d);
+	static bool			_packedProducer(void *context, uint16_t *pcolors, int16_t first_row, int16_t rows, int16_t w);
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //    RA8876 Parameters
@@ -872,6 +1302,26 @@ private:
 	uint16_t _combine_color = 0;
 	
 	/* Private Functions */
+	const uint8_t *_fontGlyphInfo(unsigned int c, uint32_t &bitoffset, uint32_t &width, uint32_t &height,
+								  int32_t &xoffset, int32_t &yoffset, uint32_t &delta);
+	void _fontGlyphBitmap(const uint8_t *data, uint32_t bitoffset, uint32_t width, uint32_t height,
+						  uint32_t gx, uint32_t gy, uint32_t stride, uint8_t *buf);
+	bool _drawFontGlyphBTE(unsigned int c, const uint8_t *data, uint32_t bitoffset, uint32_t width, uint32_t height,
+						   int32_t origin_x, int32_t origin_y, uint32_t delta, bool opaque, bool draw = true);
+	bool _drawGFXGlyphCached(unsigned int c, bool draw = true);
+	bool _drawFontGlyphAA(const uint8_t *data, uint32_t bitoffset, uint32_t width, uint32_t height,
+						  int32_t origin_x, int32_t origin_y, uint32_t delta, bool opaque);
+	bool _fontAlphaBlend = false;
+	bool _fontColorExpansion = true;
+	// glyph cache
+	glyphCacheEntry_t *_glyphCache = nullptr;
+	uint32_t	_glyphCacheTick = 0;
+	uint32_t	_glyphCacheHits = 0;
+	uint32_t	_glyphCacheMisses = 0;
+	int16_t		_glyphCacheFind(const void *font, uint16_t c, uint16_t fg, uint16_t bg, uint8_t flags, uint8_t w, uint8_t h);
+	int16_t		_glyphCacheStore(const void *font, uint16_t c, uint16_t fg, uint16_t bg, uint8_t flags,
+								 uint8_t w, uint8_t h, const uint8_t *bitmap);
+	void		_glyphCacheDraw(int16_t slot, int16_t x, int16_t y);
 	uint32_t fetchbit(const uint8_t *p, uint32_t index);
 	uint32_t fetchbits_unsigned(const uint8_t *p, uint32_t index, uint32_t required);
 	uint32_t fetchbits_signed(const uint8_t *p, uint32_t index, uint32_t required);